@@ -1,11 +1,16 @@
 
 #include "fs.h"
 
+/* Blocks accessed since last pass of reclaim clock hand */
+static uint32_t bc_referenced[DISKSIZE / BLKSIZE / 32];
+static blockno_t bc_clock_hand;
+
 /* Return the virtual address of this disk block. */
 void *
 diskaddr(blockno_t blockno) {
     if (blockno == 0 || (super && blockno >= super->s_nblocks))
         panic("bad block number %08x in diskaddr", blockno);
+    SETBIT(bc_referenced, blockno);
     void *r = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
 #ifdef SANITIZE_USER_SHADOW_BASE
     platform_asan_unpoison(r, BLKSIZE);
@@ -60,20 +65,66 @@ flush_block(void *addr) {
         panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
 
     // LAB 10: Your code here DONE
-    void *disk_addr = diskaddr(blockno);
-
     if (!is_page_present(addr) || !is_page_dirty(addr)) {
         return;
     }
 
+    write_block(addr);
+}
+
+/* Write the block containing VA out to disk even if the PTE_D
+ * bit is clear and then clear the bit.  Blocks mapped by clients
+ * with mmap() are modified without setting our PTE_D bit.
+ * The block must be in the block cache. */
+void
+write_block(void *addr) {
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+    void *disk_addr = diskaddr(blockno);
+
+    assert(is_page_present(disk_addr));
+
     int res = ide_write(blockno * BLKSECTS, disk_addr, BLKSECTS);
     assert(res >= 0);
 
-    // To clear the dirty flag
-    res = sys_map_region(0, disk_addr, 0, disk_addr, BLKSIZE, PROT_COMBINE);
+    /* To clear the dirty flag.  The page stays writable,
+     * so that it is not replaced by a fresh copy on the next
+     * write, which would detach it from client mappings */
+    res = sys_map_region(0, disk_addr, 0, disk_addr, BLKSIZE, PROT_RW | PROT_COMBINE);
     assert(res >= 0);
 
-    assert(!is_page_dirty(addr));
+    assert(!is_page_dirty(disk_addr));
+}
+
+/* Drop up to npages clean block cache pages which were not
+ * referenced recently (CLOCK algorithm), they are read back
+ * from disk by bc_pgfault() when needed.
+ * Pages shared with other environments are kept since
+ * unmapping them would not free any memory.
+ * Returns number of pages dropped. */
+size_t
+bc_reclaim(size_t npages) {
+    size_t nfreed = 0;
+    if (!super) return 0;
+
+    /* Second lap finds blocks referenced bits were cleared on the first one */
+    for (size_t i = 0; i < 2 * super->s_nblocks && nfreed < npages; i++) {
+        blockno_t blockno = bc_clock_hand;
+        bc_clock_hand = (bc_clock_hand + 1) % super->s_nblocks;
+
+        /* Don't use diskaddr() here, it marks block referenced */
+        void *addr = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+        if (!blockno || !is_page_present(addr) || is_page_dirty(addr)) continue;
+
+        if (TSTBIT(bc_referenced, blockno)) {
+            CLRBIT(bc_referenced, blockno);
+            continue;
+        }
+
+        if (sys_region_refs(addr, BLKSIZE) > 1) continue;
+        if (!sys_unmap_region(0, addr, BLKSIZE)) nfreed++;
+    }
+
+    return nfreed;
 }
 
 /* Test that the block cache works, by smashing the superblock and
@@ -70,8 +70,13 @@ alloc_block(void) {
     CLRBIT(bitmap, blockno);
     flush_block(bitmap + blockno / (sizeof(bitmap[0]) * 8));
 
-    // TODO: ?
-    memset(diskaddr(blockno), 0, BLKSIZE);
+    /* Map kernel-provided zero page instead of clearing the block
+     * (it is taken from pre-zeroed pool on first write),
+     * then touch it so the block is written out on flush */
+    void *addr = diskaddr(blockno);
+    int res = sys_alloc_region(0, addr, BLKSIZE, PROT_RW);
+    if (res < 0) panic("alloc_block: %i", res);
+    *(volatile uint8_t *)addr = 0;
 
     return blockno;
 }
@@ -390,6 +395,7 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset) {
     if (offset + count > f->f_size)
         if ((res = file_set_size(f, offset + count)) < 0) return res;
 
+    f->f_version++;
     for (off_t pos = offset; pos < offset + count;) {
         char *blk;
         if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
@@ -448,6 +454,7 @@ file_set_size(struct File *f, off_t newsize) {
     if (f->f_size > newsize)
         file_truncate_blocks(f, newsize);
     f->f_size = newsize;
+    f->f_version++;
     flush_block(f);
     return 0;
 }
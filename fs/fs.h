@@ -24,6 +24,8 @@ int ide_write(uint32_t secno, const void *src, size_t nsecs);
 /* bc.c */
 void *diskaddr(blockno_t blockno);
 void flush_block(void *addr);
+void write_block(void *addr);
+size_t bc_reclaim(size_t npages);
 void bc_init(void);
 
 /* fs.c */
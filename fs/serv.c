@@ -288,6 +288,9 @@ serve_stat(envid_t envid, union Fsipc *ipc) {
     strcpy(ret->ret_name, o->o_file->f_name);
     ret->ret_size = o->o_file->f_size;
     ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+    /* File structures never move on disk */
+    ret->ret_ino = (uintptr_t)o->o_file - DISKMAP;
+    ret->ret_version = o->o_file->f_version;
     return 0;
 }
 
@@ -311,52 +314,172 @@ serve_sync(envid_t envid, union Fsipc *req) {
     return 0;
 }
 
+/* Map up to req->req_n bytes of req->req_fileid starting at page aligned
+ * req->req_offset directly from the block cache instead of copying them.
+ * Only blocks contiguous in the block cache can be sent at once,
+ * so fewer bytes than requested may be mapped.
+ * Returns the number of bytes mapped, 0 at end of file or < 0 on error. */
+int
+serve_map(envid_t envid, struct Fsreq_map *req, void **pg_store, size_t *size_store, int *perm_store) {
+    if (debug) {
+        cprintf("serve_map %08x %08x %08x %08x\n", envid, req->req_fileid,
+                (uint32_t)req->req_offset, (uint32_t)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) return res;
+
+    int omode = o->o_fd->fd_omode & O_ACCMODE;
+    if (omode == O_WRONLY) return -E_INVAL;
+    if (req->req_prot & PROT_W && omode == O_RDONLY) return -E_INVAL;
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE) return -E_INVAL;
+
+    struct File *f = o->o_file;
+    if (req->req_offset >= f->f_size) return 0;
+    size_t n = MIN(req->req_n, (size_t)(f->f_size - req->req_offset));
+
+    char *start = NULL;
+    size_t size;
+    for (size = 0; size < n; size += BLKSIZE) {
+        char *blk;
+        if ((res = file_get_block(f, (req->req_offset + size) / BLKSIZE, &blk)) < 0) {
+            if (!size) return res;
+            break;
+        }
+        if (start && blk != start + size) break;
+        if (!start) start = blk;
+
+        /* Only pages present in the block cache can be sent */
+        (void)*(volatile char *)blk;
+    }
+
+    *pg_store = start;
+    *size_store = size;
+    *perm_store = PROT_R | (req->req_prot & PROT_W);
+    return (int)size;
+}
+
+/* Write blocks of ipc->msync.req_fileid in the given range to disk.
+ * They might have been modified through shared mappings
+ * without the block cache noticing it. */
+int
+serve_msync(envid_t envid, union Fsipc *ipc) {
+    struct Fsreq_msync *req = &ipc->msync;
+
+    if (debug) {
+        cprintf("serve_msync %08x %08x %08x %08x\n", envid, req->req_fileid,
+                (uint32_t)req->req_offset, (uint32_t)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) return res;
+    if ((o->o_fd->fd_omode & O_ACCMODE) == O_RDONLY) return -E_INVAL;
+    if (req->req_offset < 0) return -E_INVAL;
+
+    struct File *f = o->o_file;
+    off_t end = (off_t)MIN((size_t)f->f_size, (size_t)req->req_offset + req->req_n);
+    for (off_t pos = ROUNDDOWN(req->req_offset, BLKSIZE); pos < end; pos += BLKSIZE) {
+        blockno_t *pdiskbno;
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+
+        void *blk = diskaddr(*pdiskbno);
+        if (is_page_present(blk)) write_block(blk);
+    }
+
+    /* Contents changed, cached program images are stale */
+    f->f_version++;
+    return 0;
+}
+
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
-        /* Open is handled specially because it passes pages */
+        /* Open and map are handled specially because they pass pages */
         //[FSREQ_OPEN] =   (fshandler)serve_open,
         [FSREQ_READ] = serve_read,
         [FSREQ_STAT] = serve_stat,
         [FSREQ_FLUSH] = serve_flush,
         [FSREQ_WRITE] = serve_write,
         [FSREQ_SET_SIZE] = serve_set_size,
-        [FSREQ_SYNC] = serve_sync};
+        [FSREQ_SYNC] = serve_sync,
+        [FSREQ_MSYNC] = serve_msync};
 #define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
 
+/* Requests small enough to be passed in registers
+ * (see fsipc_short in lib/file.c) instead of the argument page */
+static const bool short_requests[NHANDLERS] = {
+        [FSREQ_FLUSH] = true,
+        [FSREQ_SET_SIZE] = true,
+        [FSREQ_SYNC] = true,
+        [FSREQ_MSYNC] = true};
+
+/* Arguments of the current short request */
+static union Fsipc short_req;
+
 void
 serve(void) {
     uint32_t req, whom;
-    int perm, res;
-    void *pg;
+    int perm, res = 0;
+    void *pg = NULL;
+    envid_t client = 0;  /* Client to reply to, 0 if none */
+    size_t reply_sz = 0; /* Size of region to reply with */
+    int reply_perm = 0;
 
     while (1) {
         perm = 0;
         size_t sz = PAGE_SIZE;
-        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
-        if (debug) {
+        req = ipc_reply_wait(client, res, pg, reply_sz, reply_perm,
+                             (int32_t *)&whom, fsreq, &sz, &perm);
+        client = 0;
+
+        /* Client exited before the reply was delivered */
+        if ((int32_t)req < 0) continue;
+
+        /* Kernel is low on memory */
+        if (whom == RECLAIM_ENVID) {
+            size_t nfreed = bc_reclaim(req);
+            if (debug) cprintf("fs reclaim %d pages: %zu freed\n", req, nfreed);
+            continue;
+        }
+
+        union Fsipc *ipc = fsreq;
+        if (req < NHANDLERS && short_requests[req] && !perm) {
+            memcpy(&short_req, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+            ipc = &short_req;
+
+            if (debug) cprintf("fs short req %d from %08x\n", req, whom);
+        } else if (debug) {
             cprintf("fs req %d from %08x [page %08lx: %s]\n",
                     req, whom, (unsigned long)get_uvpt_entry(fsreq),
                     (char *)fsreq);
         }
 
-        /* All requests must contain an argument page */
-        if (!(perm & PROT_R)) {
+        /* All other requests must contain an argument page */
+        if (ipc == fsreq && !(perm & PROT_R)) {
             cprintf("Invalid request from %08x: no argument page\n", whom);
             continue; /* Just leave it hanging... */
         }
 
         pg = NULL;
+        sz = PAGE_SIZE;
         if (req == FSREQ_OPEN) {
             res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+        } else if (req == FSREQ_MAP) {
+            res = serve_map(whom, &fsreq->map, &pg, &sz, &perm);
         } else if (req < NHANDLERS && handlers[req]) {
-            res = handlers[req](whom, fsreq);
+            res = handlers[req](whom, ipc);
         } else {
             cprintf("Invalid request code %d from %08x\n", req, whom);
             res = -E_INVAL;
         }
-        ipc_send(whom, res, pg, PAGE_SIZE, perm);
-        sys_unmap_region(0, fsreq, PAGE_SIZE);
+
+        /* Reply is sent by the next ipc_reply_wait(),
+         * which also unmaps fsreq if the request was mapped there */
+        client = whom;
+        reply_sz = sz;
+        reply_perm = perm;
     }
 }
 
@@ -373,5 +496,10 @@ umain(int argc, char **argv) {
     serve_init();
     fs_init();
     fs_test();
+
+    /* Clean block cache pages can be dropped on memory pressure */
+    int res = sys_env_set_reclaim(0, 1);
+    if (res < 0) panic("sys_env_set_reclaim: %i", res);
+
     serve();
 }
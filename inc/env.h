@@ -39,6 +39,13 @@ enum {
     ENV_NOT_RUNNABLE
 };
 
+/* Number of words in short IPC messages (see sys_ipc_call_short) */
+#define IPC_NWORDS 5
+
+/* Range of nice levels (see sys_env_set_nice) */
+#define NICE_MIN (-20)
+#define NICE_MAX 19
+
 /* Special environment types */
 enum EnvType {
     ENV_TYPE_IDLE,
@@ -51,10 +58,25 @@ struct List {
     struct List *prev, *next;
 };
 
+/* Memory usage of address space in bytes,
+ * updated on every mapping change.
+ * Filler pages of lazily allocated memory are not counted */
+struct MemStat {
+    size_t resident;  /* Mapped physical memory */
+    size_t shared;    /* Part of resident mapped with PROT_SHARE */
+    size_t lazy;      /* Part of resident to be copied on write */
+    size_t huge;      /* Part of resident mapped by 2MB or larger pages */
+    size_t pagetable; /* Referenced page tables (shared ones too) */
+};
+
 struct AddressSpace {
-    pml4e_t *pml4;     /* Virtual address of pml4 */
-    uintptr_t cr3;     /* Physical address of pml4 */
-    struct Page *root; /* root node of address space tree */
+    pml4e_t *pml4;       /* Virtual address of pml4 */
+    uintptr_t cr3;       /* Physical address of pml4 */
+    struct Page *root;   /* root node of address space tree */
+    uint64_t pcid_gen;   /* PCID generation pcid was allocated in */
+    uint16_t pcid;       /* Process-context identifier */
+    bool pcid_stale;     /* TLB entries tagged with pcid are outdated */
+    struct MemStat stat; /* Memory usage */
 };
 
 
@@ -63,10 +85,20 @@ struct Env {
     struct Env *env_link;    /* Next free Env */
     envid_t env_id;          /* Unique environment identifier */
     envid_t env_parent_id;   /* env_id of this env's parent */
+    envid_t env_image_id;    /* Env whose program this env runs, forks inherit it */
     enum EnvType env_type;   /* Indicates special system environments */
     unsigned env_status;     /* Status of the environment */
     uint32_t env_runs;       /* Number of times environment has run */
 
+    /* Scheduling */
+    int env_nice;                           /* Nice level, lower gets more CPU time */
+    uint32_t env_weight;                    /* CPU share weight derived from env_nice */
+    uint64_t env_runtime;                   /* CPU time used, in TSC cycles */
+    uint64_t env_vruntime;                  /* Runtime scaled by weight, run tree key */
+    uint64_t env_exec_start;                /* TSC value when env was last run */
+    struct Env *env_rq_left, *env_rq_right; /* Run tree links (ENV_RUNNABLE only) */
+    uint32_t env_rq_heap;                   /* Random run tree heap key */
+
     uint8_t *binary; /* Pointer to process ELF image in kernel memory */
 
     /* Address space */
@@ -82,6 +114,29 @@ struct Env {
     uint32_t env_ipc_value;  /* Data value sent to us */
     envid_t env_ipc_from;    /* envid of the sender */
     int env_ipc_perm;        /* Perm of page mapping received */
+    uint64_t env_ipc_words[IPC_NWORDS]; /* Words of short message received */
+
+    /* Blocking send (sys_ipc_send, sys_ipc_call, sys_ipc_reply_wait) */
+    envid_t env_ipc_recv_from;     /* Only receive from this env, 0 for any */
+    bool env_ipc_sending;          /* Env is blocked sending */
+    bool env_ipc_send_recv;        /* Env receives once its message is sent */
+    envid_t env_ipc_send_to;       /* envid of the receiver */
+    uint32_t env_ipc_send_value;   /* Value to send */
+    uintptr_t env_ipc_send_srcva;  /* Region to send */
+    size_t env_ipc_send_size;      /* Size of region to send */
+    int env_ipc_send_perm;         /* Perm of region to send */
+    uint64_t env_ipc_send_words[IPC_NWORDS]; /* Words of short message to send */
+    struct Env *env_ipc_send_next; /* Next sender blocked on the same receiver */
+    struct Env *env_ipc_senders;   /* Senders blocked on this env, oldest first */
+
+    /* Memory reclaim */
+    bool env_reclaim;           /* Env drops its caches on memory pressure */
+    size_t env_reclaim_pending; /* Number of pages requested to be freed */
 };
 
+/* Reclaim requests are delivered to registered environments
+ * as IPC messages from envid RECLAIM_ENVID with value set
+ * to the number of pages kernel would like them to free */
+#define RECLAIM_ENVID 0
+
 #endif /* !JOS_INC_ENV_H */
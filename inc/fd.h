@@ -41,6 +41,8 @@ struct Stat {
     char st_name[MAXNAMELEN];
     off_t st_size;
     int st_isdir;
+    uint64_t st_ino;      /* Unique file identifier (0 if unknown) */
+    uint32_t st_version;  /* Changes when file is modified */
     struct Dev *st_dev;
 };
 
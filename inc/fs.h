@@ -43,6 +43,10 @@ struct File {
             /* A block is allocated iff its value is != 0. */
             blockno_t f_direct[NDIRECT]; /* direct blocks */
             blockno_t f_indirect;        /* indirect block */
+
+            /* Incremented on every modification
+             * (lets clients cache file contents) */
+            uint32_t f_version;
         };
 
         /* Pad out to 256 bytes; must do arithmetic in case we're compiling
@@ -81,7 +85,10 @@ enum {
     FSREQ_STAT,
     FSREQ_FLUSH,
     FSREQ_REMOVE,
-    FSREQ_SYNC
+    FSREQ_SYNC,
+    /* Map returns block cache pages of the file instead of a copy */
+    FSREQ_MAP,
+    FSREQ_MSYNC
 };
 
 union Fsipc {
@@ -112,6 +119,8 @@ union Fsipc {
         char ret_name[MAXNAMELEN];
         off_t ret_size;
         int ret_isdir;
+        uint64_t ret_ino;
+        uint32_t ret_version;
     } statRet;
     struct Fsreq_flush {
         int req_fileid;
@@ -119,6 +128,17 @@ union Fsipc {
     struct Fsreq_remove {
         char req_path[MAXPATHLEN];
     } remove;
+    struct Fsreq_map {
+        int req_fileid;
+        off_t req_offset; /* Page aligned */
+        size_t req_n;
+        int req_prot;
+    } map;
+    struct Fsreq_msync {
+        int req_fileid;
+        off_t req_offset;
+        size_t req_n;
+    } msync;
 
     /* Ensure Fsipc is one page */
     char _pad[PAGE_SIZE];
@@ -21,6 +21,7 @@
 #include <inc/fs.h>
 #include <inc/fd.h>
 #include <inc/args.h>
+#include <inc/spawn.h>
 
 #ifdef SANITIZE_USER_SHADOW_BASE
 /* asan unpoison routine used for whitelisting regions. */
@@ -88,12 +89,19 @@ static envid_t sys_exofork(void);
 int sys_env_set_status(envid_t env, int status);
 int sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int sys_env_set_pgfault_upcall(envid_t env, void *upcall);
+int sys_env_set_reclaim(envid_t env, bool enable);
+int sys_env_set_nice(envid_t env, int nice);
+envid_t sys_spawn(const struct SpawnImage *img);
 int sys_alloc_region(envid_t env, void *pg, size_t size, int perm);
 int sys_map_region(envid_t src_env, void *src_pg,
                    envid_t dst_env, void *dst_pg, size_t size, int perm);
 int sys_unmap_region(envid_t env, void *pg, size_t size);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
+int sys_ipc_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
 int sys_ipc_recv(void *rcv_pg, size_t size);
+int sys_ipc_call(envid_t to_env, uint64_t value, void *pg, size_t size, int perm, void *rcv_pg, size_t rcv_size);
+int sys_ipc_call_short(envid_t to_env, uint64_t value, const uint64_t words[IPC_NWORDS]);
+int sys_ipc_reply_wait(envid_t to_env, uint64_t value, void *pg, size_t size, int perm, void *rcv_pg, size_t rcv_size);
 int sys_gettime(void);
 int sys_virtiogpu_init(uint32_t **fb_holder);
 int sys_virtiogpu_flush();
@@ -114,6 +122,11 @@ sys_exofork(void) {
 /* ipc.c */
 void ipc_send(envid_t to_env, uint32_t value, void *pg, size_t size, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store);
+int32_t ipc_call(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+                 void *rcv_pg, size_t *rcv_size, int *perm_store);
+int32_t ipc_call_short(envid_t to_env, uint32_t value, const uint64_t words[IPC_NWORDS]);
+int32_t ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, size_t size, int perm,
+                       envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store);
 envid_t ipc_find_env(enum EnvType type);
 
 /* fork.c */
@@ -144,6 +157,17 @@ int open(const char *path, int mode);
 int ftruncate(int fd, off_t size);
 int remove(const char *path);
 int sync(void);
+int file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot);
+int file_msync(int fdnum, off_t offset, size_t size);
+
+/* mmap.c */
+#define MAP_SHARED  0x1 /* Changes are written back to the file */
+#define MAP_PRIVATE 0x2 /* Changes are private copy-on-write */
+#define MAP_FAILED  ((void *)-1)
+
+void *mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset);
+int msync(void *addr, size_t len);
+int munmap(void *addr, size_t len);
 
 /* spawn.c */
 envid_t spawn(const char *program, const char **argv);
@@ -47,6 +47,9 @@ int libc_toupper(int ch);
 libc_FILE *libc_fopen(const char *filename, const char *mode);
 void libc_fclose(libc_FILE *libc_FILE);
 
+void *libc_mmap(libc_FILE *libc_FILE, size_t length);
+void libc_munmap(void *addr, size_t length);
+
 long libc_ftell(libc_FILE *libc_FILE);
 
 int libc_rename(const char *oldfilename, const char *newfilename);
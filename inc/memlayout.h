@@ -203,6 +203,14 @@
 /* Used for temporary page mappings.  Typed 'void*' for convenience */
 #define UTEMP ((void *)(2 * HUGE_PAGE_SIZE))
 
+/* Files are mapped here by mmap() */
+#define UMMAP_BASE 0x3000000000
+#define UMMAP_SIZE 0x1000000000
+
+/* Program images are prepared here by spawn() */
+#define USPAWN_STAGING      ((void *)0x6000000000)
+#define USPAWN_STAGING_SIZE 0x100000000
+
 #define MAX_LOW_ADDR_KERN_SIZE 0x3200000
 
 #ifndef __ASSEMBLER__
@@ -139,12 +139,30 @@
 #define CR4_SMAP       0x00200000 /* SMAP Enable */
 #define CR4_PKE        0x00400000 /* Protected Key Enable */
 
+/* CR3 register (with CR4_PCIDE set) */
+#define CR3_PCID_MASK 0xFFFULL    /* Process-context identifier */
+#define CR3_NOFLUSH   (1ULL << 63) /* Preserve TLB entries of the PCID on load */
+
+/* CPUID leaf 1 feature flags */
+#define CPUID_1_ECX_PCID (1U << 17) /* Process-context identifiers */
+#define CPUID_1_EDX_PGE  (1U << 13) /* Global pages */
+#define CPUID_1_EDX_PAT  (1U << 16) /* Page attribute table */
+
 /* x86_64 related changes */
 #define EFER_MSR 0xC0000080
 #define EFER_LME (1ULL << 8)
 #define EFER_LMA (1ULL << 10)
 #define EFER_NXE (1ULL << 11)
 
+/* Page attribute table, entry is selected by PTE_PAT|PTE_PCD|PTE_PWT */
+#define PAT_MSR            0x277
+#define PAT_UC             0x00ULL /* Uncacheable */
+#define PAT_WC             0x01ULL /* Write-combining */
+#define PAT_WT             0x04ULL /* Write-through */
+#define PAT_WB             0x06ULL /* Write-back */
+#define PAT_UCM            0x07ULL /* Uncacheable, can be overridden by MTRR */
+#define PAT_ENTRY(i, type) ((type) << ((i)*8))
+
 /* RFLAGS register */
 #define FL_CF        0x00000001 /* Carry Flag */
 #define FL_PF        0x00000004 /* Parity Flag */
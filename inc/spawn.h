@@ -0,0 +1,60 @@
+#ifndef JOS_INC_SPAWN_H
+#define JOS_INC_SPAWN_H
+
+#include <inc/types.h>
+
+/* Maximal number of entries in SpawnImage lists */
+#define SPAWN_MAX_SEGMENTS 16
+#define SPAWN_MAX_SHARED   256
+
+/* Identity of program file, images with the same key are
+ * cached and reused by sys_spawn() calls of environments running
+ * the program which cached them, its forks included, and their
+ * descendants (see struct Stat and env_image_id) */
+struct SpawnKey {
+    uint64_t ino;     /* Location of the file on disk */
+    uint64_t size;    /* File size, 0 disables caching */
+    uint64_t version; /* Incremented on every modification */
+};
+
+/* Program segment prepared by the caller of sys_spawn() */
+struct SpawnSegment {
+    uintptr_t src; /* Page aligned address in caller (moved to the child) */
+    uintptr_t dst; /* Page aligned address in the child */
+    size_t size;   /* Page aligned size */
+    int prot;
+};
+
+/* Region mapped at the same address in the caller and the child */
+struct SpawnRegion {
+    uintptr_t start;
+    size_t size;
+    int prot;
+};
+
+/*
+ * Description of new environment built by sys_spawn()
+ *
+ * Segments and stack are moved from the caller,
+ * so they are not mapped in its address space afterwards.
+ * Shared regions are mapped in both.
+ *
+ * If key is set, segments are cached and when there are
+ * no segments, they are taken from the cache
+ * (sys_spawn() fails with -E_NOT_FOUND if they are not cached)
+ */
+struct SpawnImage {
+    struct SpawnKey key;
+    uintptr_t entry;
+    /* Stack of USER_STACK_SIZE bytes placed at USER_STACK_TOP - USER_STACK_SIZE
+     * with argc, argv and argument strings already at the top
+     * (rsp is initial stack pointer in the child) */
+    uintptr_t stack;
+    uintptr_t rsp;
+    const struct SpawnSegment *segments;
+    size_t nsegments;
+    const struct SpawnRegion *shared;
+    size_t nshared;
+};
+
+#endif /* !JOS_INC_SPAWN_H */
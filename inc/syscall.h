@@ -17,10 +17,17 @@ enum {
     SYS_env_set_pgfault_upcall,
     SYS_yield,
     SYS_ipc_try_send,
+    SYS_ipc_send,
+    SYS_ipc_call,
+    SYS_ipc_call_short,
+    SYS_ipc_reply_wait,
     SYS_ipc_recv,
     SYS_gettime,
     SYS_virtiogpu_init,
     SYS_virtiogpu_flush,
+    SYS_env_set_reclaim,
+    SYS_spawn,
+    SYS_env_set_nice,
     NSYSCALLS
 };
 
@@ -183,11 +183,16 @@ rdmsr(uint32_t msr) {
 static inline void __attribute__((always_inline))
 wrmsr(uint32_t msr, uint64_t val) {
     uint64_t rax = val & 0xFFFFFFFF, rdx = val >> 32;
-    asm volatile("rdmsr"
-                 : "=a"(rax), "=d"(rdx)
-                 : "c"(msr));
+    asm volatile("wrmsr" ::"a"(rax), "d"(rdx), "c"(msr));
 }
 
+static inline void __attribute__((always_inline))
+wbinvd(void) {
+    asm volatile("wbinvd" ::
+                         : "memory");
+}
+
+
 static inline void __attribute__((always_inline))
 tlbflush(void) {
     uint64_t cr3;
@@ -151,13 +151,18 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 
     /* Set the basic status variables */
     env->env_parent_id = parent_id;
+    env->env_image_id = env->env_id;
 #ifdef CONFIG_KSPACE
     env->env_type = ENV_TYPE_KERNEL;
 #else
     env->env_type = type;
 #endif
-    env->env_status = ENV_RUNNABLE;
     env->env_runs = 0;
+    env->env_runtime = 0;
+    /* Children start where their parent is,
+     * so forking gives no extra CPU time */
+    env->env_vruntime = curenv ? curenv->env_vruntime : 0;
+    sched_set_nice(env, type == ENV_TYPE_FS ? SCHED_NICE_SERVER : SCHED_NICE_DEFAULT);
 
     /* Clear out all the saved register state,
      * to prevent the register values
@@ -199,9 +204,17 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 
     /* Also clear the IPC receiving flag. */
     env->env_ipc_recving = 0;
+    env->env_ipc_recv_from = 0;
+    env->env_ipc_maxsz = 0;
+    env->env_ipc_send_recv = 0;
+
+    /* Environment has to ask for reclaim requests */
+    env->env_reclaim = 0;
+    env->env_reclaim_pending = 0;
 
     /* Commit the allocation */
     env_free_list = env->env_link;
+    env_set_status(env, ENV_RUNNABLE);
     *newenv_store = env;
 
     if (trace_envs) cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
@@ -518,6 +531,37 @@ env_free(struct Env *env) {
     /* Note the environment's demise. */
     if (trace_envs) cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
 
+    /* Senders blocked on env will never be received from
+     * and callers will never get the reply */
+    struct Env *sender;
+    while ((sender = env->env_ipc_senders)) {
+        env->env_ipc_senders = sender->env_ipc_send_next;
+        sender->env_ipc_send_next = NULL;
+        sender->env_ipc_sending = false;
+        sender->env_ipc_send_recv = false;
+        env_set_status(sender, ENV_RUNNABLE);
+        sender->env_tf.tf_regs.reg_rax = -E_BAD_ENV;
+    }
+    for (size_t i = 0; i < NENV; i++) {
+        struct Env *caller = &envs[i];
+        if (caller->env_status == ENV_NOT_RUNNABLE && caller->env_ipc_recving &&
+            caller->env_ipc_recv_from == env->env_id) {
+            caller->env_ipc_recving = false;
+            caller->env_ipc_recv_from = 0;
+            env_set_status(caller, ENV_RUNNABLE);
+            caller->env_tf.tf_regs.reg_rax = -E_BAD_ENV;
+        }
+    }
+
+    /* Leave the queue of receiver env is blocked on */
+    if (env->env_ipc_sending) {
+        struct Env **link = &envs[ENVX(env->env_ipc_send_to)].env_ipc_senders;
+        while (*link != env) link = &(*link)->env_ipc_send_next;
+        *link = env->env_ipc_send_next;
+        env->env_ipc_send_next = NULL;
+        env->env_ipc_sending = false;
+    }
+
 #ifndef CONFIG_KSPACE
     /* If freeing the current environment, switch to kern_pgdir
      * before freeing the page directory, just in case the page
@@ -530,11 +574,59 @@ env_free(struct Env *env) {
 #endif
 
     /* Return the environment to the free list */
-    env->env_status = ENV_FREE;
+    env_set_status(env, ENV_FREE);
     env->env_link = env_free_list;
     env_free_list = env;
 }
 
+/* Fill IPC fields of env with pending reclaim request */
+void
+env_deliver_reclaim(struct Env *env) {
+    assert(env->env_reclaim_pending);
+
+    env->env_ipc_recving = 0;
+    env->env_ipc_from = RECLAIM_ENVID;
+    env->env_ipc_value = MIN(env->env_reclaim_pending, (size_t)~0U);
+    env->env_ipc_maxsz = 0;
+    env->env_ipc_perm = 0;
+    env->env_reclaim_pending = 0;
+}
+
+/* Ask environments registered with sys_env_set_reclaim()
+ * to free npages pages of memory.
+ * Environments blocked in sys_ipc_recv() are woken up,
+ * others get the request on their next sys_ipc_recv() */
+void
+env_request_reclaim(size_t npages) {
+    if (!envs) return;
+
+    for (size_t i = 0; i < NENV; i++) {
+        struct Env *env = &envs[i];
+        if (env->env_status == ENV_FREE || !env->env_reclaim) continue;
+
+        env->env_reclaim_pending = MAX(env->env_reclaim_pending, npages);
+        if (env->env_ipc_recving && !env->env_ipc_recv_from && env->env_status == ENV_NOT_RUNNABLE) {
+            env_deliver_reclaim(env);
+            env_set_status(env, ENV_RUNNABLE);
+            env->env_tf.tf_regs.reg_rax = 0;
+        }
+    }
+}
+
+/* Change status of env keeping run queues up to date,
+ * env_status should not be assigned directly */
+void
+env_set_status(struct Env *env, unsigned status) {
+    if (env->env_status == status) return;
+
+    if (env->env_status == ENV_RUNNING) sched_update_runtime(env);
+    if (env->env_status == ENV_RUNNABLE) sched_dequeue(env);
+    if (status == ENV_RUNNABLE) sched_enqueue(env);
+    if (status == ENV_RUNNING) env->env_exec_start = read_tsc();
+
+    env->env_status = status;
+}
+
 /* Frees environment env
  *
  * If env was the current one, then runs a new environment
@@ -646,12 +738,12 @@ env_run(struct Env *env) {
         if (env != curenv && curenv) {
             // TODO: Maybe save curenv trapframe
             if (curenv->env_status == ENV_RUNNING) {
-                curenv->env_status = ENV_RUNNABLE;
+                env_set_status(curenv, ENV_RUNNABLE);
             }
         }
 
         curenv = env;
-        env->env_status = ENV_RUNNING;
+        env_set_status(env, ENV_RUNNING);
         env->env_runs++;
     }
 
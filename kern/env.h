@@ -18,8 +18,11 @@ int env_alloc(struct Env **penv, envid_t parent_id, enum EnvType type);
 void env_free(struct Env *env);
 void env_create(uint8_t *binary, size_t size, enum EnvType type);
 void env_destroy(struct Env *env);
+void env_set_status(struct Env *env, unsigned status);
 
 int envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+void env_request_reclaim(size_t npages);
+void env_deliver_reclaim(struct Env *env);
 _Noreturn void env_run(struct Env *e);
 _Noreturn void env_pop_tf(struct Trapframe *tf);
 
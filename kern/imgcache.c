@@ -0,0 +1,147 @@
+/* Cache of program images created by sys_spawn() */
+
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+
+#include <kern/env.h>
+#include <kern/imgcache.h>
+#include <kern/pmap.h>
+#include <kern/traceopt.h>
+
+#define IMAGE_CACHE_SLOTS 8
+/* Each image gets its own part of image_space,
+ * segments are kept at slot base + child address */
+#define IMAGE_SLOT_SIZE (4 * GB)
+
+static_assert(IMAGE_CACHE_SLOTS * IMAGE_SLOT_SIZE <= MAX_USER_ADDRESS, "Image cache does not fit into address space");
+
+struct ImageCacheEntry {
+    struct SpawnKey key; /* key.size == 0 for free slots */
+    /* Keys are supplied by the spawning environment, so entries are
+     * only used by environments running its program (the spawner,
+     * like a shell, often is a short-lived fork of it) and their
+     * descendants.  This is env_image_id of the spawner */
+    envid_t owner;
+    uintptr_t entry;
+    uint64_t last_used;
+    size_t nsegments;
+    struct SpawnSegment segments[SPAWN_MAX_SEGMENTS]; /* src is address in image_space */
+};
+
+static struct ImageCacheEntry image_cache[IMAGE_CACHE_SLOTS];
+static uint64_t image_cache_clock;
+
+/* Holds lazy copies of cached segments, so pages of
+ * read-only segments are shared by all instances of
+ * the program and data segments are copied on write */
+static struct AddressSpace image_space;
+
+static void
+image_cache_evict(struct ImageCacheEntry *img) {
+    if (!img->nsegments) return;
+
+    uintptr_t base = (img - image_cache) * IMAGE_SLOT_SIZE;
+    unmap_region(&image_space, base, IMAGE_SLOT_SIZE);
+    memset(img, 0, sizeof(*img));
+}
+
+/* Check that one of ancestors of env runs the program of envid */
+static bool
+image_owner_ok(struct Env *env, envid_t envid) {
+    for (size_t i = 0; i < NENV; i++) {
+        if (!env->env_parent_id) return 0;
+        if (envid2env(env->env_parent_id, &env, 0) < 0) return 0;
+        if (env->env_image_id == envid) return 1;
+    }
+    return 0;
+}
+
+/* Whether the entry can still be used by anyone */
+static bool
+image_owner_alive(struct ImageCacheEntry *img) {
+    struct Env *env;
+    return img->key.size && envid2env(img->owner, &env, 0) >= 0;
+}
+
+/* Map cached image identified by key to env, only images
+ * inserted by programs of ancestors of env are used.
+ * Returns 0 and sets *entry to the entry point on success,
+ * -E_NOT_FOUND if image is not cached, < 0 on other errors */
+int
+image_cache_map(struct Env *env, const struct SpawnKey *key, uintptr_t *entry) {
+    struct ImageCacheEntry *img = NULL;
+    for (size_t i = 0; i < IMAGE_CACHE_SLOTS; i++) {
+        if (image_cache[i].key.size && !memcmp(&image_cache[i].key, key, sizeof(*key)) &&
+            image_owner_ok(env, image_cache[i].owner)) {
+            img = &image_cache[i];
+            break;
+        }
+    }
+    if (!img) return -E_NOT_FOUND;
+
+    for (size_t i = 0; i < img->nsegments; i++) {
+        struct SpawnSegment *seg = &img->segments[i];
+        int res = map_region(&env->address_space, seg->dst, &image_space, seg->src,
+                             seg->size, seg->prot | PROT_LAZY | PROT_USER_);
+        if (res < 0) return res;
+    }
+
+    if (trace_envs) cprintf("[%08x] image %lx cache hit\n", env->env_id, (unsigned long)key->ino);
+
+    img->last_used = ++image_cache_clock;
+    *entry = img->entry;
+    return 0;
+}
+
+/* Remember segments of the image identified by key, which are
+ * already mapped at their destinations in env (built completely
+ * from validated segments), for the program of its parent.
+ * Older versions of the same file, images whose owners have
+ * exited and least recently used images are evicted.
+ * Caching is best effort, so errors are ignored */
+void
+image_cache_insert(struct Env *env, const struct SpawnKey *key, uintptr_t entry,
+                   const struct SpawnSegment *segs, size_t nsegs) {
+    if (!key->size || !nsegs || nsegs > SPAWN_MAX_SEGMENTS) return;
+    for (size_t i = 0; i < nsegs; i++)
+        if (segs[i].dst + segs[i].size > IMAGE_SLOT_SIZE) return;
+
+    if (!image_space.pml4 && init_address_space(&image_space) < 0) return;
+
+    struct Env *parent;
+    if (envid2env(env->env_parent_id, &parent, 0) < 0) return;
+    envid_t owner = parent->env_image_id;
+
+    struct ImageCacheEntry *img = NULL;
+    for (size_t i = 0; i < IMAGE_CACHE_SLOTS; i++) {
+        struct ImageCacheEntry *cur = &image_cache[i];
+        if (cur->key.ino == key->ino && cur->owner == owner) {
+            img = cur;
+            break;
+        }
+        if (!img || (image_owner_alive(img) &&
+                     (!image_owner_alive(cur) || cur->last_used < img->last_used)))
+            img = cur;
+    }
+
+    image_cache_evict(img);
+
+    uintptr_t base = (img - image_cache) * IMAGE_SLOT_SIZE;
+    for (size_t i = 0; i < nsegs; i++) {
+        img->segments[i] = segs[i];
+        img->segments[i].src = base + segs[i].dst;
+        img->nsegments = i + 1;
+
+        if (map_region(&image_space, img->segments[i].src, &env->address_space, segs[i].dst,
+                       segs[i].size, segs[i].prot | PROT_LAZY | PROT_USER_) < 0) {
+            image_cache_evict(img);
+            return;
+        }
+    }
+
+    img->key = *key;
+    img->owner = owner;
+    img->entry = entry;
+    img->last_used = ++image_cache_clock;
+}
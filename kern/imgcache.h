@@ -0,0 +1,16 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_IMGCACHE_H
+#define JOS_KERN_IMGCACHE_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/env.h>
+#include <inc/spawn.h>
+
+int image_cache_map(struct Env *env, const struct SpawnKey *key, uintptr_t *entry);
+void image_cache_insert(struct Env *env, const struct SpawnKey *key, uintptr_t entry,
+                        const struct SpawnSegment *segs, size_t nsegs);
+
+#endif /* !JOS_KERN_IMGCACHE_H */
@@ -0,0 +1,207 @@
+/* General purpose kernel heap allocator
+ *
+ * Requests up to KMEM_MAX_SIZE bytes are rounded up to a power of two
+ * and served from slabs of KMEM_SLAB_SIZE bytes holding objects
+ * of a single size.  Slab header is placed in place of the first
+ * objects and slabs are naturally aligned, so kfree() finds the header
+ * by rounding the address down.  Objects are carved from the slab
+ * lazily, freed ones are kept in per slab free lists.
+ *
+ * Bigger requests are rounded up to a power of two number of pages
+ * and get their own kzalloc_region() region, which is unmapped on
+ * kfree() and reused by the next request of the same size.
+ *
+ * All memory is allocated with ALLOC_NOW, so it can be accessed
+ * anywhere in the kernel, including the page fault path. */
+
+#include <inc/assert.h>
+#include <inc/string.h>
+
+#include <kern/kmalloc.h>
+#include <kern/pmap.h>
+
+#define KMEM_MIN_SHIFT 4  /* 16 bytes */
+#define KMEM_MAX_SHIFT 11 /* 2 KB */
+#define KMEM_MAX_SIZE  (1UL << KMEM_MAX_SHIFT)
+#define KMEM_NCLASSES  (KMEM_MAX_SHIFT - KMEM_MIN_SHIFT + 1)
+#define KMEM_SLAB_SIZE (8 * PAGE_SIZE)
+#define KMEM_MAGIC     0x51AB51ABU
+
+struct KmemObject {
+    struct KmemObject *next;
+};
+
+struct KmemSlab {
+    uint32_t magic;
+    uint16_t class;
+    uint16_t inuse;
+    struct KmemSlab *next;   /* Next slab with free objects */
+    struct KmemObject *free; /* Freed objects */
+    uintptr_t top;           /* Start of never allocated objects */
+};
+
+/* Region of a large allocation */
+struct KmemLarge {
+    uintptr_t start;
+    size_t size;
+    struct KmemLarge *next;
+};
+
+/* Slabs with free objects for every class */
+static struct KmemSlab *kmem_partial[KMEM_NCLASSES];
+static size_t kmem_nslabs[KMEM_NCLASSES];
+static size_t kmem_inuse[KMEM_NCLASSES];
+
+/* Allocated and unmapped large regions */
+static struct KmemLarge *kmem_large, *kmem_large_free;
+
+static size_t
+kmem_class_size(int class) {
+    return 1UL << (class + KMEM_MIN_SHIFT);
+}
+
+static bool
+kmem_slab_full(struct KmemSlab *slab) {
+    return !slab->free && slab->top == (uintptr_t)slab + KMEM_SLAB_SIZE;
+}
+
+static struct KmemSlab *
+kmem_slab_alloc(int class) {
+    kzalloc_region_no_cow = true;
+    struct KmemSlab *slab = kzalloc_region(KMEM_SLAB_SIZE);
+    if (!slab) return NULL;
+    assert(!((uintptr_t)slab & (KMEM_SLAB_SIZE - 1)));
+
+    size_t size = kmem_class_size(class);
+    slab->magic = KMEM_MAGIC;
+    slab->class = class;
+    slab->top = (uintptr_t)slab + ROUNDUP(sizeof(*slab), size);
+    kmem_nslabs[class]++;
+    return slab;
+}
+
+static void *
+kmem_alloc_small(size_t size) {
+    int class = 0;
+    while (kmem_class_size(class) < size) class++;
+
+    struct KmemSlab *slab = kmem_partial[class];
+    if (!slab) {
+        if (!(slab = kmem_slab_alloc(class))) return NULL;
+        kmem_partial[class] = slab;
+    }
+
+    void *res;
+    if (slab->free) {
+        res = slab->free;
+        slab->free = slab->free->next;
+    } else {
+        res = (void *)slab->top;
+        slab->top += kmem_class_size(class);
+    }
+
+    if (kmem_slab_full(slab)) kmem_partial[class] = slab->next;
+    slab->inuse++;
+    kmem_inuse[class]++;
+    return res;
+}
+
+static void *
+kmem_alloc_large(size_t size) {
+    size_t npages = 1;
+    while (npages * PAGE_SIZE < size) npages <<= 1;
+    size = npages * PAGE_SIZE;
+
+    struct KmemLarge **pfree = &kmem_large_free;
+    while (*pfree && (*pfree)->size != size) pfree = &(*pfree)->next;
+
+    struct KmemLarge *large = *pfree;
+    if (large) {
+        if (map_region(&kspace, large->start, NULL, 0, size, PROT_R | PROT_W | ALLOC_ZERO | ALLOC_NOW) < 0)
+            return NULL;
+        *pfree = large->next;
+    } else {
+        if (!(large = kmem_alloc_small(sizeof(*large)))) return NULL;
+        kzalloc_region_no_cow = true;
+        large->start = (uintptr_t)kzalloc_region(size);
+        large->size = size;
+        if (!large->start) {
+            kfree(large);
+            return NULL;
+        }
+    }
+
+    large->next = kmem_large;
+    kmem_large = large;
+    return (void *)large->start;
+}
+
+/* Allocate size bytes of kernel memory.
+ * Returns NULL if size is 0 or memory is exhausted */
+void *
+kmalloc(size_t size) {
+    if (!size) return NULL;
+    return size <= KMEM_MAX_SIZE ? kmem_alloc_small(size) : kmem_alloc_large(size);
+}
+
+/* Allocate size bytes of zero-filled kernel memory */
+void *
+kzalloc(size_t size) {
+    void *res = kmalloc(size);
+    if (res) memset(res, 0, size);
+    return res;
+}
+
+/* Free memory returned by kmalloc() or kzalloc(), ptr may be NULL */
+void
+kfree(void *ptr) {
+    if (!ptr) return;
+
+    /* Large allocations are page aligned */
+    if (!((uintptr_t)ptr & CLASS_MASK(0))) {
+        for (struct KmemLarge **plarge = &kmem_large; *plarge; plarge = &(*plarge)->next) {
+            struct KmemLarge *large = *plarge;
+            if (large->start != (uintptr_t)ptr) continue;
+
+            unmap_region(&kspace, large->start, large->size);
+            *plarge = large->next;
+            large->next = kmem_large_free;
+            kmem_large_free = large;
+            return;
+        }
+    }
+
+    struct KmemSlab *slab = (struct KmemSlab *)ROUNDDOWN((uintptr_t)ptr, KMEM_SLAB_SIZE);
+    if (slab->magic != KMEM_MAGIC || (uintptr_t)ptr & (kmem_class_size(slab->class) - 1) ||
+        (uintptr_t)ptr < (uintptr_t)(slab + 1) || (uintptr_t)ptr >= slab->top)
+        panic("kfree: invalid pointer %p", ptr);
+    assert(slab->inuse);
+
+    /* Slab has free objects again */
+    if (kmem_slab_full(slab)) {
+        slab->next = kmem_partial[slab->class];
+        kmem_partial[slab->class] = slab;
+    }
+
+    struct KmemObject *obj = ptr;
+    obj->next = slab->free;
+    slab->free = obj;
+    slab->inuse--;
+    kmem_inuse[slab->class]--;
+}
+
+void
+dump_kmalloc_usage(void) {
+    for (int class = 0; class < KMEM_NCLASSES; class++) {
+        if (!kmem_nslabs[class]) continue;
+        cprintf("kmalloc-%-4zu %4zu objects in %zu slabs\n", kmem_class_size(class),
+                kmem_inuse[class], kmem_nslabs[class]);
+    }
+
+    size_t nlarge = 0, size = 0;
+    for (struct KmemLarge *large = kmem_large; large; large = large->next) {
+        nlarge++;
+        size += large->size;
+    }
+    cprintf("kmalloc-large %zu regions, %zu KB\n", nlarge, size / 1024);
+}
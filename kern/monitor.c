@@ -7,10 +7,12 @@
 #include <inc/assert.h>
 #include <inc/env.h>
 #include <inc/x86.h>
+#include <inc/uefi.h>
 
 #include <kern/console.h>
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
+#include <kern/kmalloc.h>
 #include <kern/tsc.h>
 #include <kern/timer.h>
 #include <kern/env.h>
@@ -30,8 +32,13 @@ int mon_start(int argc, char **argv, struct Trapframe *tf);
 int mon_stop(int argc, char **argv, struct Trapframe *tf);
 int mon_frequency(int argc, char **argv, struct Trapframe *tf);
 int mon_memory(int argc, char **argv, struct Trapframe *tf);
+int mon_slabinfo(int argc, char **argv, struct Trapframe *tf);
+int mon_faultaround(int argc, char **argv, struct Trapframe *tf);
 int mon_pagetable(int argc, char **argv, struct Trapframe *tf);
 int mon_virt(int argc, char **argv, struct Trapframe *tf);
+int mon_memstat(int argc, char **argv, struct Trapframe *tf);
+int mon_fbbench(int argc, char **argv, struct Trapframe *tf);
+int mon_ksm(int argc, char **argv, struct Trapframe *tf);
 
 struct Command {
     const char *name;
@@ -49,8 +56,13 @@ static struct Command commands[] = {
         {"timer_stop", "Stop timer", mon_stop},
         {"timer_freq", "Retrieve timer frequency", mon_frequency},
         {"dumpmemlst", "Dumps memory lists", mon_memory},
+        {"slabinfo", "Dumps page descriptor cache statistics", mon_slabinfo},
+        {"faultaround", "Show or set number of pages resolved around page fault", mon_faultaround},
         {"dumppt", "Dumps the page table", mon_pagetable},
         {"dumpvirt", "Dumps the virtual page tree", mon_virt},
+        {"memstat", "Show memory usage of environments and kernel heap", mon_memstat},
+        {"fbbench", "Measure full-screen framebuffer fill bandwidth", mon_fbbench},
+        {"ksm", "Enable/disable same page merging (on|off) and show its savings", mon_ksm},
 };
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
 
@@ -208,6 +220,23 @@ mon_frequency(int argc, char **argv, struct Trapframe *tf) {
 int
 mon_memory(int argc, char **argv, struct Trapframe *tf) {
     dump_memory_lists();
+    dump_zero_pools();
+    dump_page_caches();
+
+    return 0;
+}
+
+int
+mon_slabinfo(int argc, char **argv, struct Trapframe *tf) {
+    dump_desc_caches();
+
+    return 0;
+}
+
+int
+mon_faultaround(int argc, char **argv, struct Trapframe *tf) {
+    if (argc >= 2) fault_around_pages = strtol(argv[1], NULL, 0);
+    cprintf("fault-around window: %zu pages\n", fault_around_pages);
 
     return 0;
 }
@@ -229,6 +258,49 @@ mon_virt(int argc, char **argv, struct Trapframe *tf) {
     return 0;
 }
 
+int
+mon_ksm(int argc, char **argv, struct Trapframe *tf) {
+    if (argc >= 2) ksm_set_enabled(!strcmp(argv[1], "on"));
+    dump_ksm_stats();
+
+    return 0;
+}
+
+int
+mon_memstat(int argc, char **argv, struct Trapframe *tf) {
+    dump_memory_usage();
+    dump_kmalloc_usage();
+
+    return 0;
+}
+
+#define FBBENCH_FILLS 64
+
+int
+mon_fbbench(int argc, char **argv, struct Trapframe *tf) {
+    uint32_t *fb = (uint32_t *)FRAMEBUFFER;
+    size_t size = uefi_lp->FrameBufferSize;
+    long fills = argc > 1 ? strtol(argv[1], NULL, 0) : FBBENCH_FILLS;
+
+    if (!size || fills <= 0) {
+        cprintf("Usage: fbbench [fills]\n");
+        return 0;
+    }
+
+    uint64_t start = hpet_get_ms();
+    for (long i = 0; i < fills; i++)
+        nosan_memset(fb, i & 1 ? 0xFF : 0x00, size);
+    uint64_t elapsed = hpet_get_ms() - start;
+
+    /* Console text is lost anyway */
+    nosan_memset(fb, 0, size);
+
+    cprintf("fbbench: %ld fills of %zu KB in %lu ms", fills, size / 1024, (unsigned long)elapsed);
+    if (elapsed) cprintf(" (%lu MB/s)", (unsigned long)(fills * size * 1000 / elapsed / MB));
+    cprintf("\n");
+    return 0;
+}
+
 /* Kernel monitor command interpreter */
 
 static int
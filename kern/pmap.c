@@ -23,11 +23,51 @@
 
 /* for O(1) page allocation */
 static struct List free_classes[MAX_CLASS];
-/* List of descriptor pools */
+/* Bitmap of non-empty free_classes lists */
+static uint64_t free_class_mask;
+/* Number of pages in each of free_classes lists */
+static size_t free_class_count[MAX_CLASS];
+static_assert(MAX_CLASS <= 64, "free_class_mask is too narrow for MAX_CLASS");
+/* Total size of free lists in 4KB pages */
+static size_t free_page_count;
+/* When free memory drops below low watermark registered
+ * environments are asked to free memory up to high watermark */
+static size_t reclaim_low_pages, reclaim_high_pages;
+#define RECLAIM_LOW_DIVISOR 64
+/* List of descriptor pools (slabs) */
 static struct PagePool *first_pool;
-/* List of free descriptors */
+static size_t pool_count;
+/* Depot of free descriptors shared by all descriptor caches */
 static struct List free_descriptors;
 static size_t free_desc_count;
+
+/* Number of descriptors in descriptor cache magazine */
+#define DESC_MAGAZINE_SIZE 64
+
+/*
+ * Descriptor cache. Each cache keeps a magazine --
+ * a LIFO stack of recently freed (and therefore
+ * cache-hot) descriptors in front of the depot,
+ * so most allocations and frees don't touch it.
+ */
+struct DescCache {
+    const char *name;
+    size_t loaded; /* Number of descriptors in magazine */
+    struct Page *magazine[DESC_MAGAZINE_SIZE];
+    /* Statistics */
+    size_t active, allocs, frees, hits, refills, drains;
+};
+
+enum {
+    DESC_CACHE_PHYSICAL,
+    DESC_CACHE_VIRTUAL,
+    NDESC_CACHES,
+};
+
+static struct DescCache desc_caches[NDESC_CACHES] = {
+        [DESC_CACHE_PHYSICAL] = {.name = "physical"},
+        [DESC_CACHE_VIRTUAL] = {.name = "virtual"},
+};
 /* Physical memory size */
 size_t max_memory_map_addr;
 /* Kernel address space */
@@ -36,6 +76,8 @@ struct AddressSpace kspace;
 struct AddressSpace *current_space;
 /* Root node of physical memory tree */
 struct Page root;
+/* 0x00 and 0xFF-filled huge pages used for lazy allocation */
+static struct Page *zero_page, *one_page;
 /* Top address for page pools mappings */
 static uintptr_t metaheaptop;
 
@@ -45,6 +87,8 @@ static uintptr_t metaheaptop;
 static bool nx_supported = 1;
 /* 1GB pages are supported */
 static bool has_1gb_pages = 1;
+/* Kernel half is mapped with PTE_G (CR4.PGE is set) */
+static bool global_pages;
 
 /* Kernel executable end virtual address */
 extern char end[];
@@ -110,38 +154,138 @@ list_del(struct List *list) {
     return list;
 }
 
+/*
+ * Inserts free allocatable page into free list of its class.
+ * free_class_mask and free_class_count are kept in sync
+ * so that alloc_page() never scans empty lists
+ */
+inline static void
+free_list_insert(struct Page *page) {
+    assert(!page->listed && !page->refc);
+    list_append(&free_classes[page->class], (struct List *)page);
+    free_class_count[page->class]++;
+    free_class_mask |= 1ULL << page->class;
+    free_page_count += 1ULL << page->class;
+    page->listed = 1;
+}
+
+/* Removes page from free list if it is there */
+inline static void
+free_list_remove(struct Page *page) {
+    if (!page->listed) return;
+    list_del((struct List *)page);
+    page->listed = 0;
+    free_page_count -= 1ULL << page->class;
+    if (!--free_class_count[page->class])
+        free_class_mask &= ~(1ULL << page->class);
+}
+
 static struct Page *alloc_page(int class, int flags);
+static size_t zero_pool_drain(void);
+static bool page_cache_absorb(struct Page *page);
+static size_t page_caches_drain(void);
+
+inline static struct DescCache *
+desc_cache(enum PageState state) {
+    return &desc_caches[(state & NODE_TYPE_MASK) >= PARTIAL_NODE ?
+                                DESC_CACHE_PHYSICAL :
+                                DESC_CACHE_VIRTUAL];
+}
+
+/* Number of free descriptors in depot and all magazines */
+static size_t
+desc_free_total(void) {
+    size_t res = free_desc_count;
+    for (size_t i = 0; i < NDESC_CACHES; i++)
+        res += desc_caches[i].loaded;
+    return res;
+}
 
 void
 ensure_free_desc(size_t count) {
-    if (free_desc_count < count) {
+    if (desc_free_total() < count) {
         struct Page *res = alloc_page(POOL_CLASS, ALLOC_POOL);
         if (!res) panic("Out of memory\n");
     }
 
-    assert(free_desc_count >= count);
-    assert(!list_empty(&free_descriptors));
+    assert(desc_free_total() >= count);
+}
+
+/* Load half of the magazine from depot */
+static void
+desc_cache_refill(struct DescCache *cache) {
+    cache->refills++;
+    while (cache->loaded < DESC_MAGAZINE_SIZE / 2 && free_desc_count) {
+        cache->magazine[cache->loaded++] = (struct Page *)list_del(free_descriptors.next);
+        free_desc_count--;
+    }
+
+    /* Depot is empty, so the rest of free
+     * descriptors are in other magazines */
+    for (size_t i = 0; !cache->loaded && i < NDESC_CACHES; i++) {
+        if (desc_caches[i].loaded)
+            cache->magazine[cache->loaded++] = desc_caches[i].magazine[--desc_caches[i].loaded];
+    }
+}
+
+/* Return the coldest half of the magazine to depot */
+static void
+desc_cache_drain(struct DescCache *cache) {
+    cache->drains++;
+    size_t count = DESC_MAGAZINE_SIZE / 2;
+    for (size_t i = 0; i < count; i++)
+        list_append(&free_descriptors, (struct List *)cache->magazine[i]);
+    free_desc_count += count;
+
+    cache->loaded -= count;
+    memmove(cache->magazine, cache->magazine + count, cache->loaded * sizeof *cache->magazine);
 }
 
 static struct Page *
 alloc_descriptor(enum PageState state) {
     ensure_free_desc(1);
 
-    struct Page *new = (struct Page *)list_del(free_descriptors.next);
+    struct DescCache *cache = desc_cache(state);
+    if (cache->loaded)
+        cache->hits++;
+    else
+        desc_cache_refill(cache);
+    assert(cache->loaded);
+
+    struct Page *new = cache->magazine[--cache->loaded];
+    cache->allocs++;
+    cache->active++;
 
+    /* Descriptor is exactly one cache line */
     memset(new, 0, sizeof *new);
     list_init((struct List *)new);
     new->state = state;
-    free_desc_count--;
 
     return new;
 }
 
 static void
 free_descriptor(struct Page *page) {
+    struct DescCache *cache = desc_cache(page->state);
     list_del((struct List *)page);
-    list_append(&free_descriptors, (struct List *)page);
-    free_desc_count++;
+
+    if (cache->loaded == DESC_MAGAZINE_SIZE) desc_cache_drain(cache);
+    cache->magazine[cache->loaded++] = page;
+    cache->frees++;
+    cache->active--;
+}
+
+void
+dump_desc_caches(void) {
+    cprintf("Descriptor slabs: %zu of %zu descriptors, %zu free in depot\n",
+            pool_count, (size_t)POOL_ENTRIES_FOR_SIZE(CLASS_SIZE(POOL_CLASS)), free_desc_count);
+    cprintf("%-10s %8s %8s %10s %10s %10s %8s %8s\n", "cache", "active",
+            "loaded", "allocs", "frees", "hits", "refills", "drains");
+    for (size_t i = 0; i < NDESC_CACHES; i++) {
+        struct DescCache *cache = &desc_caches[i];
+        cprintf("%-10s %8zu %8zu %10zu %10zu %10zu %8zu %8zu\n", cache->name, cache->active,
+                cache->loaded, cache->allocs, cache->frees, cache->hits, cache->refills, cache->drains);
+    }
 }
 
 static void
@@ -157,6 +301,7 @@ free_desc_rec(struct Page *p) {
         assert(!p->refc);
         free_desc_rec(p->right);
         struct Page *tmp = p->left;
+        free_list_remove(p);
         free_descriptor(p);
         p = tmp;
     }
@@ -229,8 +374,8 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
                 /* Recalculate free lists for allocatable page */
                 struct Page *other = !right ? node->right : node->left;
                 assert(other->state == ALLOCATABLE_NODE);
-                list_del((struct List *)node);
-                list_append(&free_classes[node->class - 1], (struct List *)other);
+                free_list_remove(node);
+                free_list_insert(other);
             }
 
             if (type != PARTIAL_NODE && node->state != type)
@@ -251,11 +396,12 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
         free_desc_rec(node->left);
         free_desc_rec(node->right);
         node->left = node->right = NULL;
+        free_list_remove(node);
         list_del((struct List *)node);
 
         /* We cannot change RESERVED_NODE memory to ALLOCATABLE_NODE */
         if (type != PARTIAL_NODE && node->state != RESERVED_NODE) node->state = type;
-        if (node->state == ALLOCATABLE_NODE) list_append(&free_classes[node->class], (struct List *)node);
+        if (node->state == ALLOCATABLE_NODE) free_list_insert(node);
 
         if (trace_memory) cprintf("Attaching page (%x) at %p class=%d\n", node->state, (void *)page2pa(node), (int)node->class);
     }
@@ -277,8 +423,8 @@ page_ref(struct Page *node) {
      * so need to reference them recursively
      * when refc transitions from 0 to 1 */
     if (!node->refc++) {
+        free_list_remove(node);
         list_del((struct List *)node);
-        list_init((struct List *)node);
         page_ref(node->left);
         page_ref(node->right);
     }
@@ -294,6 +440,9 @@ page_unref(struct Page *page) {
      * this if statement is important
      * to prevent double frees */
 
+    /* Keep recently freed page in per-CPU cache */
+    if (page->refc == 1 && page_cache_absorb(page)) return;
+
     if (page->refc == 1) {
         page_unref(page->left);
         page_unref(page->right);
@@ -309,23 +458,22 @@ page_unref(struct Page *page) {
             if (par->state == page->state &&
                 PAGE_IS_FREE(par->left) &&
                 PAGE_IS_FREE(par->right)) {
+                free_list_remove(par->left);
                 free_descriptor(par->left);
                 par->left = NULL;
 
+                free_list_remove(par->right);
                 free_descriptor(par->right);
                 par->right = NULL;
 
-                if (par->state == ALLOCATABLE_NODE) {
-                    assert(list_empty((struct List *)par));
-                    list_append(&free_classes[par->class], (struct List *)par);
-                }
+                assert(!par->listed);
                 page = par;
             } else
                 break;
         }
         list_del((struct List *)page);
         if (page->state == ALLOCATABLE_NODE)
-            list_append(&free_classes[page->class], (struct List *)page);
+            free_list_insert(page);
 
 #if SANITIZE_SHADOW_BASE
         if (current_space) {
@@ -367,6 +515,26 @@ alloc_virtual_child(struct Page *parent, struct Page **dst) {
  * HINT: CLASS_MASK() and CLASS_SIZE() macros might be
  * useful here
  */
+/* Filler pages are mapped lazily instead of allocating memory */
+inline static bool
+is_filler_page(struct Page *page) {
+    return page2pa(page) - page2pa(zero_page) < CLASS_SIZE(zero_page->class) ||
+           page2pa(page) - page2pa(one_page) < CLASS_SIZE(one_page->class);
+}
+
+/* Add mapping node to (or remove it from) memory usage counters of spc */
+static void
+account_mapping(struct AddressSpace *spc, struct Page *node, bool add) {
+    if (zero_page && is_filler_page(node->phy)) return;
+
+    /* Unsigned negation makes additions below subtract */
+    size_t size = add ? CLASS_SIZE(node->phy->class) : -CLASS_SIZE(node->phy->class);
+    spc->stat.resident += size;
+    if (node->state & PROT_SHARE) spc->stat.shared += size;
+    if (node->state & PROT_LAZY) spc->stat.lazy += size;
+    if (node->phy->class >= HUGE_PAGE_CLASS) spc->stat.huge += size;
+}
+
 static void
 check_virtual_class(struct Page *node, int class) {
     while (node->parent) class ++, node = node->parent;
@@ -375,8 +543,9 @@ check_virtual_class(struct Page *node, int class) {
 
 /* Lookup virtual address space mapping node with given address and class */
 static struct Page *
-page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
+page_lookup_virtual(struct AddressSpace *spc, uintptr_t addr, int class, int alloc) {
     assert(class >= 0);
+    struct Page *node = spc->root;
     assert_virtual(node);
 
 
@@ -408,6 +577,10 @@ page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
                 alloc_virtual_child(node, &node->right);
                 if (!node->right) return NULL;
 
+                account_mapping(spc, node, 0);
+                account_mapping(spc, node->left, 1);
+                account_mapping(spc, node->right, 1);
+
                 list_del((struct List *)node);
                 page_unref(node->phy);
                 node->phy = NULL;
@@ -452,18 +625,19 @@ attach_region(uintptr_t start, uintptr_t end, enum PageState type) {
 }
 
 static void
-unmap_page_remove(struct Page *node) {
+unmap_page_remove(struct AddressSpace *spc, struct Page *node) {
     if (!node) return;
     assert_virtual(node);
 
     if (node->phy) {
         assert(!node->left && !node->right);
         assert((node->state & NODE_TYPE_MASK) == MAPPING_NODE);
+        account_mapping(spc, node, 0);
         page_unref(node->phy);
     } else {
         assert((node->state & NODE_TYPE_MASK) == INTERMEDIATE_NODE);
-        unmap_page_remove(node->left);
-        unmap_page_remove(node->right);
+        unmap_page_remove(spc, node->left);
+        unmap_page_remove(spc, node->right);
     }
 
     if (node->parent) {
@@ -476,7 +650,7 @@ unmap_page_remove(struct Page *node) {
 }
 
 static void
-remove_pt(pte_t *pt, pte_t base, size_t step, uintptr_t i0, uintptr_t i1) {
+remove_pt(struct AddressSpace *spc, pte_t *pt, pte_t base, size_t step, uintptr_t i0, uintptr_t i1) {
     assert(step == 1 * GB || step == 2 * MB || step == 4 * KB || step == 512 * GB);
     for (size_t i = i0; i < i1; i++) {
         if (!(pt[i] & PTE_P)) continue;
@@ -484,8 +658,11 @@ remove_pt(pte_t *pt, pte_t base, size_t step, uintptr_t i0, uintptr_t i1) {
 
         if (!(pt[i] & PTE_PS) && step > 4 * KB) {
             pte_t *pt2 = KADDR(PTE_ADDR(pt[i]));
-            remove_pt(pt2, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
-            page_unref(page_lookup(NULL, (uintptr_t)PADDR(pt2), 0, PARTIAL_NODE, 0));
+            struct Page *page = page_lookup(NULL, (uintptr_t)PADDR(pt2), 0, PARTIAL_NODE, 0);
+            /* Shared page tables are still used by other address spaces */
+            if (page->refc == 1) remove_pt(spc, pt2, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
+            page_unref(page);
+            spc->stat.pagetable -= CLASS_SIZE(0);
         }
 
         pt[i] = 0;
@@ -549,6 +726,11 @@ check_physical_tree(struct Page *page) {
         assert(page->class == MAX_CLASS);
         assert(page == &root);
     }
+    if (page->listed) {
+        assert(page->state == ALLOCATABLE_NODE);
+        assert(PAGE_IS_FREE(page));
+        assert(free_class_mask & (1ULL << page->class));
+    }
     if (!page->refc) {
         assert(page->head.next && page->head.prev);
         if (!list_empty((struct List *)page)) {
@@ -626,8 +808,9 @@ dump_memory_lists(void) {
     for (int class = 0; class < MAX_CLASS; ++class) {
         struct List *list = &free_classes[class];
         assert(list);
+        assert(!list_empty(list) == !!(free_class_mask & (1ULL << class)));
 
-        cprintf("Memory pages of 0x%llx bytes:\n", CLASS_SIZE(class));
+        cprintf("Memory pages of 0x%llx bytes (%zu free):\n", CLASS_SIZE(class), free_class_count[class]);
 
         for (struct List *node = list->next; node != list; node = node->next) {
             struct Page *page = (struct Page *)node;
@@ -638,6 +821,9 @@ dump_memory_lists(void) {
             cprintf("  [0x%016zx] - state %06x\n", (uintptr_t)(page->addr << CLASS_BASE), page->state);
         }
     }
+
+    cprintf("Free memory: %zu pages (reclaim watermarks: low %zu, high %zu)\n",
+            free_page_count, reclaim_low_pages, reclaim_high_pages);
 }
 
 static void
@@ -702,7 +888,7 @@ dump_page_table(pte_t *pml4) {
 }
 
 inline static int
-alloc_pt(pte_t *dst) {
+alloc_pt(struct AddressSpace *spc, pte_t *dst) {
     if (!(*dst & PTE_P) || (*dst & PTE_PS)) {
         struct Page *page = alloc_page(0, ALLOC_BOOTMEM);
         if (!page) return -E_NO_MEM;
@@ -712,6 +898,7 @@ alloc_pt(pte_t *dst) {
         assert(!page->refc);
         page_ref(page);
         *dst = page2pa(page) | PTE_U | PTE_W | PTE_P;
+        spc->stat.pagetable += CLASS_SIZE(0);
 
 #ifdef SANITIZE_SHADOW_BASE
         if (current_space) platform_asan_unpoison(KADDR(page2pa(page)), CLASS_SIZE(0));
@@ -721,6 +908,63 @@ alloc_pt(pte_t *dst) {
     return 0;
 }
 
+/* Physical page holding page table referenced by entry */
+inline static struct Page *
+pt_page(pte_t entry) {
+    return page_lookup(NULL, PTE_ADDR(entry), 0, PARTIAL_NODE, 0);
+}
+
+/* Software bit of PDEs referencing page tables that were
+ * shared by share_pt_block(), the bit is left set in the last
+ * remaining referencing PDE until it is modified */
+#define PDE_SHARED_PT 0x200
+
+/*
+ * Page tables of user blocks can be shared between address
+ * spaces after fork (see share_pt_block()), such tables
+ * contain no writable entries, so hardware never modifies them.
+ * Any address space modifying shared page table
+ * referenced by *pde needs to get its own copy first
+ */
+static int
+unshare_pt(pde_t *pde) {
+    if (!(*pde & PTE_P) || *pde & PTE_PS || !(*pde & PDE_SHARED_PT)) return 0;
+    struct Page *old = pt_page(*pde);
+    if (old->refc == 1) {
+        *pde &= ~PDE_SHARED_PT;
+        return 0;
+    }
+
+    struct Page *page = alloc_page(0, ALLOC_BOOTMEM);
+    if (!page) return -E_NO_MEM;
+    page_ref(page);
+
+#ifdef SANITIZE_SHADOW_BASE
+    if (current_space) platform_asan_unpoison(KADDR(page2pa(page)), CLASS_SIZE(0));
+#endif
+    memcpy(KADDR(page2pa(page)), KADDR(PTE_ADDR(*pde)), CLASS_SIZE(0));
+    *pde = page2pa(page) | (*pde & ~PTE_ADDR(*pde) & ~PDE_SHARED_PT);
+
+    page_unref(old);
+    return 0;
+}
+
+/* Returns PD entry describing user address va,
+ * allocating PDP and PD if alloc is set */
+static pde_t *
+user_pde(struct AddressSpace *spc, uintptr_t va, bool alloc) {
+    assert(va < MAX_USER_ADDRESS && PML4_INDEX(va) < NUSERPML4);
+
+    pml4e_t *pml4e = spc->pml4 + PML4_INDEX(va);
+    if (!(*pml4e & PTE_P) && (!alloc || alloc_pt(spc, pml4e) < 0)) return NULL;
+
+    pdpe_t *pdpe = (pdpe_t *)KADDR(PTE_ADDR(*pml4e)) + PDP_INDEX(va);
+    if (*pdpe & PTE_PS) return NULL;
+    if (!(*pdpe & PTE_P) && (!alloc || alloc_pt(spc, pdpe) < 0)) return NULL;
+
+    return (pde_t *)KADDR(PTE_ADDR(*pdpe)) + PD_INDEX(va);
+}
+
 static void
 propagate_one_pml4(struct AddressSpace *dst, struct AddressSpace *src) {
     /* Reference level 3 page tables */
@@ -753,7 +997,7 @@ propagate_pml4(struct AddressSpace *spc) {
 }
 
 inline static int
-alloc_fill_pt(pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
+alloc_fill_pt(struct AddressSpace *spc, pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
     assert(i0 != i1);
     bool need_recur = step > 1 * GB || (step == 1 * GB && !has_1gb_pages);
     if (!need_recur && step != 4 * KB) base |= PTE_PS;
@@ -762,9 +1006,9 @@ alloc_fill_pt(pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
 
     for (size_t i = i0; i < i1; i++, base += step) {
         if (need_recur) {
-            int res = alloc_pt(dst + i);
+            int res = alloc_pt(spc, dst + i);
             if (res < 0) return res;
-            res = alloc_fill_pt(dst + i, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
+            res = alloc_fill_pt(spc, dst + i, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
             if (res < 0) return res;
         } else {
             if ((PTE_ADDR(base) & (step - 1))) cprintf("%08lX %08lX\n", (long)PTE_ADDR(base), step);
@@ -776,6 +1020,181 @@ alloc_fill_pt(pte_t *dst, pte_t base, size_t step, size_t i0, size_t i1) {
     return 0;
 }
 
+/* Maximal number of disjoint ranges in TLB gather */
+#define TLB_GATHER_RANGES 16
+
+/*
+ * TLB invalidations gathered during one
+ * map_region()/unmap_region() call
+ * (only current address space entries
+ *  need to be invalidated)
+ */
+static struct {
+    unsigned depth; /* Nesting level of tlb_gather_begin() */
+    bool full;      /* Whole TLB needs to be flushed */
+    bool global;    /* Kernel (global) mappings were changed */
+    struct AddressSpace *spc;
+    size_t npages, nranges;
+    struct {
+        uintptr_t start, end;
+    } ranges[TLB_GATHER_RANGES];
+} tlb_gather;
+
+/* Number of pages above which whole TLB
+ * is flushed instead of invalidating pages one by one */
+size_t tlb_flush_threshold = 32;
+
+/* Number of distinct PCIDs */
+#define NPCID (CR3_PCID_MASK + 1)
+
+/* CR4.PCIDE is set */
+static bool pcid_enabled;
+/* Bumping generation invalidates PCIDs of all address spaces.
+ * (PCID 0 is used during boot and is never handed out) */
+static uint64_t pcid_generation = 1;
+static uint16_t pcid_next = 1;
+
+/* Returns CR3 value for space, allocating PCID if needed.
+ * TLB entries tagged with space PCID are preserved on load
+ * unless the PCID was just (re)allocated or marked stale */
+static uint64_t
+space_cr3(struct AddressSpace *space) {
+    if (!pcid_enabled) return space->cr3;
+
+    if (space->pcid_gen == pcid_generation && !space->pcid_stale)
+        return space->cr3 | space->pcid | CR3_NOFLUSH;
+
+    if (space->pcid_gen != pcid_generation) {
+        if (pcid_next == NPCID) {
+            /* Out of PCIDs, start new generation.
+             * Stale entries of recycled PCIDs get
+             * flushed when they are loaded without CR3_NOFLUSH */
+            pcid_generation++;
+            pcid_next = 1;
+        }
+        space->pcid = pcid_next++;
+        space->pcid_gen = pcid_generation;
+    }
+
+    space->pcid_stale = 0;
+    return space->cr3 | space->pcid;
+}
+
+/* Flush whole TLB of current address space.
+ * CR3 reload does not touch global entries,
+ * so they are dropped by toggling CR4.PGE
+ * (this also flushes entries of all PCIDs) */
+static void
+tlb_flush_all(bool global) {
+    if (global && global_pages) {
+        uint64_t cr4 = rcr4();
+        lcr4(cr4 & ~CR4_PGE);
+        lcr4(cr4);
+    } else {
+        lcr3(rcr3());
+    }
+}
+
+static void
+tlb_flush_range(uintptr_t start, uintptr_t end) {
+    for (; start < end; start += PAGE_SIZE)
+        invlpg((void *)start);
+}
+
+static void
+tlb_gather_reset(void) {
+    tlb_gather.spc = NULL;
+    tlb_gather.full = tlb_gather.global = 0;
+    tlb_gather.npages = tlb_gather.nranges = 0;
+}
+
+/* Perform all gathered invalidations */
+static void
+tlb_gather_flush(void) {
+    /* Gathered space is always current here since
+     * switch_address_space() flushes pending invalidations */
+    if (tlb_gather.spc) {
+        assert(tlb_gather.spc == current_space);
+        if (tlb_gather.full)
+            tlb_flush_all(tlb_gather.global);
+        else {
+            for (size_t i = 0; i < tlb_gather.nranges; i++)
+                tlb_flush_range(tlb_gather.ranges[i].start, tlb_gather.ranges[i].end);
+        }
+    }
+
+    tlb_gather_reset();
+}
+
+static void
+tlb_gather_begin(void) {
+    tlb_gather.depth++;
+}
+
+static void
+tlb_gather_end(void) {
+    assert(tlb_gather.depth);
+    if (!--tlb_gather.depth) tlb_gather_flush();
+}
+
+static void
+tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
+    bool global = 0;
+
+    if (spc == &kspace && current_space) {
+        /* Kernel mappings are shared by all address spaces.
+         * Global entries are invalidated by invlpg in every PCID,
+         * otherwise they are cached separately for every PCID */
+        if (pcid_enabled && !global_pages) {
+            pcid_generation++;
+            pcid_next = 1;
+        }
+        global = 1;
+        spc = current_space;
+    } else if (pcid_enabled && current_space && spc != current_space) {
+        /* Entries survive CR3 reload, so flush them on next switch */
+        spc->pcid_stale = 1;
+        return;
+    }
+
+    if (current_space != spc && current_space) return;
+
+    size_t npages = (end - start) / PAGE_SIZE;
+
+    if (!tlb_gather.depth || !current_space) {
+        /* If we need to invalidate a lot of memory, just flush whole cache */
+        if (npages > tlb_flush_threshold)
+            tlb_flush_all(global);
+        else
+            tlb_flush_range(start, end);
+        return;
+    }
+
+    if (tlb_gather.spc != spc) {
+        tlb_gather_flush();
+        tlb_gather.spc = spc;
+    }
+
+    tlb_gather.npages += npages;
+    tlb_gather.global |= global;
+    if (tlb_gather.full) return;
+
+    size_t n = tlb_gather.nranges;
+    if (tlb_gather.npages > tlb_flush_threshold) {
+        tlb_gather.full = 1;
+    } else if (n && tlb_gather.ranges[n - 1].end == start) {
+        tlb_gather.ranges[n - 1].end = end;
+    } else if (n && tlb_gather.ranges[n - 1].start == end) {
+        tlb_gather.ranges[n - 1].start = start;
+    } else if (n == TLB_GATHER_RANGES) {
+        tlb_gather.full = 1;
+    } else {
+        tlb_gather.ranges[n].start = start;
+        tlb_gather.ranges[n].end = end;
+        tlb_gather.nranges++;
+    }
+}
+
 /* Copy physical page contents to some virtual address
  *
  * To copy physical address you can use linear
@@ -798,51 +1217,35 @@ memcpy_page(struct AddressSpace *dst, uintptr_t va, struct Page *page) {
     // LAB 7: Your code here DONE
 
     struct AddressSpace *old_space = switch_address_space(dst);
+    /* Destination might have been remapped with invalidation deferred */
+    tlb_gather_flush();
     set_wp(0);
     nosan_memcpy((void *)va, KADDR(page2pa(page)), CLASS_SIZE(page->class));
     set_wp(1);
     switch_address_space(old_space);
 }
 
-static void
-tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
-    if (current_space == spc || !current_space) {
-        /* If we need to invalidate a lot of memory, just flush whole cache */
-        if (start - end > 512 * GB)
-            lcr3(rcr3());
-        else {
-            while (start < end) {
-                invlpg((void *)start);
-                start += PAGE_SIZE;
-            }
-        }
-    }
-}
-
-static void
+/* Returns -E_NO_MEM if a page table needs to be
+ * split or unshared and there is no memory for it,
+ * nothing is unmapped then */
+static int
 unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     if (trace_memory) cprintf("<%p> Unmapping [%08lX, %08lX]\n",
                               spc, addr, addr + (long)CLASS_MASK(class));
-    int res;
+    struct Page *node;
     assert(!(addr & CLASS_MASK(class)));
 
-    struct Page *node = page_lookup_virtual(spc->root, addr, class, LOOKUP_ALLOC);
-    if (node) unmap_page_remove(node);
-    /* Disallow root node deallocation */
-    if (node == spc->root)
-        spc->root = alloc_descriptor(INTERMEDIATE_NODE);
-
     uintptr_t end = addr + CLASS_SIZE(class);
     uintptr_t inval_start = addr, inval_end = end;
 
     size_t pml4i0 = PML4_INDEX(addr), pml4i1 = PML4_INDEX(end);
     if (class >= 27) {
-        remove_pt(spc->pml4, addr, 512 * GB, pml4i0, pml4i1);
+        remove_pt(spc, spc->pml4, addr, 512 * GB, pml4i0, pml4i1);
         if (pml4i1 - 1 >= NUSERPML4) propagate_pml4(spc);
         goto finish;
     }
 
-    if (!(spc->pml4[pml4i0] & PTE_P)) return;
+    if (!(spc->pml4[pml4i0] & PTE_P)) goto remove;
     pdpe_t *pdp = KADDR(PTE_ADDR(spc->pml4[pml4i0]));
 
     size_t pdpi0 = PDP_INDEX(addr), pdpi1 = PDP_INDEX(end);
@@ -854,23 +1257,22 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
      * is >= than 1*GB */
 
     if (class >= 18) {
-        remove_pt(pdp, addr, 1 * GB, pdpi0, pdpi1);
+        remove_pt(spc, pdp, addr, 1 * GB, pdpi0, pdpi1);
         goto finish;
     }
 
     /* If page is not present don't need to do anything */
 
     if (!(pdp[pdpi0] & PTE_P))
-        return;
+        goto remove;
     /* otherwise we need to split 1*GB page hw page
      * into smaller 2*MB pages, allocating new page table level */
     else if (pdp[pdpi0] & PTE_PS) {
         pdpe_t old = pdp[pdpi0];
-        res = alloc_pt(pdp + pdpi0);
-        assert(!res);
+        if (alloc_pt(spc, pdp + pdpi0) < 0) return -E_NO_MEM;
         pde_t *pd = KADDR(PTE_ADDR(pdp[pdpi0]));
         // TODO: Maybe shouldn't have fixed this, and left PT_ENTRY_COUNT
-        res = alloc_fill_pt(pd, old & ~PTE_PS, 2 * MB, 0, PD_ENTRY_COUNT);
+        int res = alloc_fill_pt(spc, pd, old & ~PTE_PS, 2 * MB, 0, PD_ENTRY_COUNT);
         inval_start = ROUNDDOWN(inval_start, 1 * GB);
         inval_end = ROUNDUP(inval_end, 1 * GB);
         assert(!res);
@@ -889,7 +1291,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     if (pdi0 > pdi1) pdi1 = PD_ENTRY_COUNT;
 
     if (class >= 9) {
-        remove_pt(pd, addr, 2 * MB, pdi0, pdi1);
+        remove_pt(spc, pd, addr, 2 * MB, pdi0, pdi1);
         goto finish;
     }
 
@@ -903,18 +1305,19 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
 
     // LAB 7: Your code here DONE
     if (!(pd[pdi0] & PTE_P))
-        return;
+        goto remove;
     /* otherwise we need to split 2*MB page hw page
      * into smaller 4*KB pages, allocating new page table level */
     else if (pd[pdi0] & PTE_PS) {
         pde_t old = pd[pdi0];
-        res = alloc_pt(pd + pdi0);
-        assert(!res);
+        if (alloc_pt(spc, pd + pdi0) < 0) return -E_NO_MEM;
         pte_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
-        res = alloc_fill_pt(pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT);
+        int res = alloc_fill_pt(spc, pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT);
         inval_start = ROUNDDOWN(inval_start, 2 * MB);
         inval_end = ROUNDUP(inval_end, 2 * MB);
         assert(!res);
+    } else if (unshare_pt(pd + pdi0) < 0) {
+        return -E_NO_MEM;
     }
     pte_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
 
@@ -922,7 +1325,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     size_t pti0 = PT_INDEX(addr), pti1 = PT_INDEX(end);
     if (pti0 > pti1) pti1 = PT_ENTRY_COUNT;
     if (class >= 0) {
-        remove_pt(pt, addr, 4 * KB, pti0, pti1);
+        remove_pt(spc, pt, addr, 4 * KB, pti0, pti1);
         goto finish;
     }
 
@@ -931,6 +1334,16 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
 
 finish:
     tlb_invalidate_range(spc, inval_start, inval_end);
+
+remove:
+    /* Page tables are updated first since they can fail
+     * to be allocated and virtual tree removal cannot be undone */
+    node = page_lookup_virtual(spc, addr, class, LOOKUP_ALLOC);
+    if (node) unmap_page_remove(spc, node);
+    /* Disallow root node deallocation */
+    if (node == spc->root)
+        spc->root = alloc_descriptor(INTERMEDIATE_NODE);
+    return 0;
 }
 
 static int
@@ -946,13 +1359,18 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
 
     if (!(flags & ALLOC_WEAK)) {
         page_ref(page);
-        unmap_page(spc, addr, page->class);
-        struct Page *mapping = page_lookup_virtual(spc->root, addr, page->class, LOOKUP_ALLOC);
+        int res = unmap_page(spc, addr, page->class);
+        if (res < 0) {
+            page_unref(page);
+            return res;
+        }
+        struct Page *mapping = page_lookup_virtual(spc, addr, page->class, LOOKUP_ALLOC);
         if (!mapping) return -E_NO_MEM;
 
         mapping->phy = page;
         mapping->state = (PAGE_PROT(flags) & ~PROT_COMBINE) | MAPPING_NODE;
         list_append((struct List *)page, (struct List *)mapping);
+        account_mapping(spc, mapping, 1);
     }
 
     if (trace_memory) cprintf("<%p> Mapping [%08lX, %08lX] to [%08lX, %08lX] (class=%d flags=%x)\n", spc,
@@ -964,18 +1382,21 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     uintptr_t end = addr + CLASS_SIZE(page->class);
     uintptr_t base = page2pa(page) | prot2pte(flags);
     assert(!(page2pa(page) & CLASS_MASK(page->class)));
+    /* Kernel half page tables are shared by all address spaces,
+     * so its translations can survive CR3 reloads */
+    if (spc == &kspace && global_pages && PML4_INDEX(addr) >= NUSERPML4) base |= PTE_G;
 
     size_t pml4i0 = PML4_INDEX(addr), pml4i1 = PML4_INDEX(end);
     /* Fill PML4 range if page size is larger than 512GB */
     if (page->class >= 27) {
-        int res = alloc_fill_pt(spc->pml4, base, 512 * GB, pml4i0, pml4i1);
+        int res = alloc_fill_pt(spc, spc->pml4, base, 512 * GB, pml4i0, pml4i1);
         if (pml4i1 - 1 >= NUSERPML4) propagate_pml4(spc);
         return res;
     }
 
     /* Allocate empty pdp if required */
     if (!(spc->pml4[pml4i0] & PTE_P)) {
-        if (alloc_pt(spc->pml4 + pml4i0) < 0) return -E_NO_MEM;
+        if (alloc_pt(spc, spc->pml4 + pml4i0) < 0) return -E_NO_MEM;
         if (pml4i0 >= NUSERPML4) propagate_pml4(spc);
     }
     assert(!(spc->pml4[pml4i0] & PTE_PS)); /* There's (yet) no support for 512GB pages in x86 arch */
@@ -987,17 +1408,17 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     /* Fixup index if pdpi0 == 511 and pdpi1 == 0 (and should be 512) */
     if (pdpi0 > pdpi1) pdpi1 = PDP_ENTRY_COUNT;
     /* Fill PDP range if page size is larger than 1GB */
-    if (page->class >= 18) return alloc_fill_pt(pdp, base, 1 * GB, pdpi0, pdpi1);
+    if (page->class >= 18) return alloc_fill_pt(spc, pdp, base, 1 * GB, pdpi0, pdpi1);
 
     /* Allocate empty pd... */
-    if (!(pdp[pdpi0] & PTE_P) && alloc_pt(pdp + pdpi0) < 0) return -E_NO_MEM;
+    if (!(pdp[pdpi0] & PTE_P) && alloc_pt(spc, pdp + pdpi0) < 0) return -E_NO_MEM;
     /* ...or split 1GB page into 2MB pages if required */
     else if (pdp[pdpi0] & PTE_PS) {
         pdpe_t old = pdp[pdpi0];
-        if (alloc_pt(pdp + pdpi0) < 0) return -E_NO_MEM;
+        if (alloc_pt(spc, pdp + pdpi0) < 0) return -E_NO_MEM;
         pde_t *pd = KADDR(PTE_ADDR(pdp[pdpi0]));
         // TODO: Maybe shouldn't have fixed this, and left PT_ENTRY_COUNT
-        if (alloc_fill_pt(pd, old & ~PTE_PS, 2 * MB, 0, PD_ENTRY_COUNT) < 0) return -E_NO_MEM;
+        if (alloc_fill_pt(spc, pd, old & ~PTE_PS, 2 * MB, 0, PD_ENTRY_COUNT) < 0) return -E_NO_MEM;
     }
     /* Calculate kernel virtual address of page directory */
     pde_t *pd = KADDR(PTE_ADDR(pdp[pdpi0]));
@@ -1010,7 +1431,7 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     // LAB 7: Your code here DONE
     size_t pdi0 = PD_INDEX(addr), pdi1 = PD_INDEX(end);
     if (pdi0 > pdi1) pdpi1 = PD_ENTRY_COUNT;
-    if (page->class >= 9) return alloc_fill_pt(pd, base, 2 * MB, pdi0, pdi1);
+    if (page->class >= 9) return alloc_fill_pt(spc, pd, base, 2 * MB, pdi0, pdi1);
 
     /* Allocate empty pt or split 2MB page into 4KB pages if required and
      * calculate virtual address into pt.
@@ -1018,14 +1439,16 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
      * TIP: Look at the code above doing the same thing for 1GB pages */
 
     /* Allocate empty pt... */
-    if (!(pd[pdi0] & PTE_P) && alloc_pt(pd + pdi0) < 0) return -E_NO_MEM;
+    if (!(pd[pdi0] & PTE_P) && alloc_pt(spc, pd + pdi0) < 0) return -E_NO_MEM;
     /* ...split 2MB page into 4KB pages if required */
     else if (pd[pdi0] & PTE_PS) {
         pde_t old = pd[pdi0];
-        if (alloc_pt(pd + pdi0) < 0) return -E_NO_MEM;
+        if (alloc_pt(spc, pd + pdi0) < 0) return -E_NO_MEM;
         pte_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
-        if (alloc_fill_pt(pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT) < 0) return -E_NO_MEM;
+        if (alloc_fill_pt(spc, pt, old & ~PTE_PS, 4 * KB, 0, PT_ENTRY_COUNT) < 0) return -E_NO_MEM;
     }
+    /* ...or copy page table shared with other address spaces */
+    else if (unshare_pt(pd + pdi0) < 0) return -E_NO_MEM;
     /* Calculate kernel virtual address of page table */
     pte_t *pt = KADDR(PTE_ADDR(pd[pdi0]));
 
@@ -1034,38 +1457,63 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     size_t pti0 = PT_INDEX(addr), pti1 = PT_INDEX(end);
     if (pti0 > pti1) pti1 = PT_ENTRY_COUNT;
     /* Fill PT range if page size is larger than 4KB */
-    if (page->class >= 0) return alloc_fill_pt(pt, base, 4 * KB, pti0, pti1);
+    if (page->class >= 0) return alloc_fill_pt(spc, pt, base, 4 * KB, pti0, pti1);
 
     /* We cannot allocate less than a page */
     panic("Cannot allocate less than a page");
 }
 
-void
+int
 unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
-    int class = 0;
+    int class = 0, res = 0;
 
     uintptr_t start = ROUNDDOWN(dst, 1ULL << CLASS_BASE);
     uintptr_t end = ROUNDUP(dst + size, 1ULL << CLASS_BASE);
 
-    for (; class < MAX_CLASS && start + CLASS_SIZE(class) <= end; class ++) {
+    tlb_gather_begin();
+
+    for (; !res && class < MAX_CLASS && start + CLASS_SIZE(class) <= end; class ++) {
         if (start & CLASS_SIZE(class)) {
-            unmap_page(dspace, start, class);
+            res = unmap_page(dspace, start, class);
             start += CLASS_SIZE(class);
         }
     }
 
-    for (; class >= 0 && start < end; class --) {
+    for (; !res && class >= 0 && start < end; class --) {
         if (start + CLASS_SIZE(class) <= end) {
-            unmap_page(dspace, start, class);
+            res = unmap_page(dspace, start, class);
             start += CLASS_SIZE(class);
         }
     }
+
+    tlb_gather_end();
+    return res;
 }
 
-/* Just allocate page, without mapping it */
+/*
+ * Splits free page down to requested class.
+ * Lower halves are kept and upper halves are
+ * returned to free lists, so there is no need
+ * to descend from the root of physical tree
+ */
 static struct Page *
-alloc_page(int class, int flags) {
-    struct List *li = NULL;
+split_free_page(struct Page *page, int class) {
+    assert(page->state == ALLOCATABLE_NODE && !page->listed);
+    ensure_free_desc((page->class - class) * 2);
+
+    while (page->class > class) {
+        assert(PAGE_IS_FREE(page));
+        alloc_child(page, 0);
+        free_list_insert(alloc_child(page, 1));
+        page = page->left;
+    }
+
+    return page;
+}
+
+/* Allocate page from the buddy tree */
+static struct Page *
+buddy_alloc_page(int class, int flags) {
     struct Page *peer = NULL;
 
     if (flags & ALLOC_POOL) flags |= ALLOC_BOOTMEM;
@@ -1073,20 +1521,35 @@ alloc_page(int class, int flags) {
     if (current_space) flags &= ~ALLOC_BOOTMEM;
 #endif
 
-    /* Find page that is not smaller than requested
-     * (Pool memory should also be within BOOT_MEM_SIZE) */
-    for (int pclass = class; pclass < MAX_CLASS; pclass++, li = NULL) {
-        for (li = free_classes[pclass].next; li != &free_classes[pclass]; li = li->next) {
+    /* Find the smallest non-empty free list not smaller than requested
+     * with a bit scan. Any page from it fits unless memory should
+     * be within BOOT_MEM_SIZE (pool memory), then the list is searched */
+retry:
+    for (uint64_t mask = free_class_mask & ~((1ULL << class) - 1); mask; mask &= mask - 1) {
+        int pclass = __builtin_ctzll(mask);
+        assert(!list_empty(&free_classes[pclass]));
+
+        for (struct List *li = free_classes[pclass].next; li != &free_classes[pclass]; li = li->next) {
             peer = (struct Page *)li;
             assert(peer->state == ALLOCATABLE_NODE);
             assert_physical(peer);
             if (!(flags & ALLOC_BOOTMEM) || page2pa(peer) + CLASS_SIZE(class) < BOOT_MEM_SIZE) goto found;
         }
     }
+
+    /* Pre-zeroed and cached pages are the first to give back
+     * (zero pool pages end up in page caches when drained).
+     * Descriptor pools are allocated while splitting free pages,
+     * which must not be merged back meanwhile */
+    if (!(flags & ALLOC_POOL)) {
+        size_t reclaimed = zero_pool_drain();
+        reclaimed += page_caches_drain();
+        if (reclaimed) goto retry;
+    }
     return NULL;
 
 found:
-    list_del(li);
+    free_list_remove(peer);
 
     size_t ndesc = 0;
     static bool allocating_pool;
@@ -1105,11 +1568,12 @@ found:
         newpool->next = first_pool;
         first_pool = newpool;
         free_desc_count += ndesc;
+        pool_count++;
         if (trace_memory_more) cprintf("Allocated pool of size %zu at [%08lX, %08lX]\n",
                                        ndesc, page2pa(peer), page2pa(peer) + (long)CLASS_MASK(class));
     }
 
-    struct Page *new = page_lookup(peer, page2pa(peer), class, PARTIAL_NODE, 1);
+    struct Page *new = split_free_page(peer, class);
     assert(!new->refc);
 
     if (flags & ALLOC_POOL) {
@@ -1130,20 +1594,341 @@ found:
     return new;
 }
 
+/*
+ * Per-CPU page caches
+ *
+ * Most frequently used classes (4KB and 2MB pages) are
+ * allocated from and freed to small per-CPU stacks of pages
+ * in front of the buddy tree. Freed pages are pushed to the
+ * hot end and allocated from it, pages taken from the buddy
+ * tree in batches are put to the cold end, and the coldest
+ * ones are returned to the tree in batches when the cache
+ * grows over its high watermark.
+ * Every cached page holds one reference, so it is
+ * not merged with its buddy while being cached.
+ */
+
+#define PAGE_CACHE_MAX 64
+
+struct PageCacheList {
+    int class;
+    size_t high, batch;
+    size_t count;
+    struct Page *pages[PAGE_CACHE_MAX]; /* Coldest first */
+    /* Statistics */
+    size_t hits, misses, refills, drains;
+};
+
+static struct PageCache {
+    struct PageCacheList lists[2];
+} page_caches[NCPU] = {
+        [0 ... NCPU - 1] = {{
+                {.class = 0, .high = PAGE_CACHE_MAX, .batch = PAGE_CACHE_MAX / 4},
+                {.class = HUGE_PAGE_CLASS, .high = 4, .batch = 2},
+        }},
+};
+
+/* Pages are returned to buddy tree */
+static bool page_cache_draining;
+
+#define NPAGE_CACHE_LISTS (sizeof(page_caches[0].lists) / sizeof(*page_caches[0].lists))
+
+static struct PageCacheList *
+page_cache_list(int class) {
+    /* There's no SMP yet, so the only CPU is 0 */
+    struct PageCache *cache = &page_caches[0];
+    for (size_t i = 0; i < NPAGE_CACHE_LISTS; i++)
+        if (cache->lists[i].class == class) return &cache->lists[i];
+    return NULL;
+}
+
+/* Return n coldest pages of the list to buddy tree */
+static void
+page_cache_drain(struct PageCacheList *list, size_t n) {
+    n = MIN(n, list->count);
+    if (!n) return;
+
+    struct Page *pages[PAGE_CACHE_MAX];
+    memcpy(pages, list->pages, n * sizeof *pages);
+    memmove(list->pages, list->pages + n, (list->count - n) * sizeof *pages);
+    list->count -= n;
+    list->drains++;
+
+    page_cache_draining = 1;
+    for (size_t i = 0; i < n; i++) page_unref(pages[i]);
+    page_cache_draining = 0;
+}
+
+static size_t
+page_caches_drain(void) {
+    size_t res = 0;
+    for (size_t cpu = 0; cpu < NCPU; cpu++) {
+        for (size_t i = 0; i < NPAGE_CACHE_LISTS; i++) {
+            struct PageCacheList *list = &page_caches[cpu].lists[i];
+            res += list->count;
+            page_cache_drain(list, list->count);
+        }
+    }
+    return res;
+}
+
+/* Fill cold end of the list with a batch of pages from buddy tree */
+static void
+page_cache_refill(struct PageCacheList *list) {
+    struct Page *pages[PAGE_CACHE_MAX];
+    size_t n = 0;
+
+    while (n < list->batch) {
+        struct Page *page = buddy_alloc_page(list->class, 0);
+        if (!page) break;
+        page_ref(page);
+        pages[n++] = page;
+    }
+
+    /* buddy_alloc_page() might have drained the list */
+    assert(list->count + n <= PAGE_CACHE_MAX);
+    memmove(list->pages + n, list->pages, list->count * sizeof *pages);
+    memcpy(list->pages, pages, n * sizeof *pages);
+    list->count += n;
+    list->refills++;
+}
+
+/* Called by page_unref() before the last reference is dropped */
+static bool
+page_cache_absorb(struct Page *page) {
+    if (page_cache_draining || page->state != ALLOCATABLE_NODE ||
+        page->left || page->right) return 0;
+
+    struct PageCacheList *list = page_cache_list(page->class);
+    if (!list) return 0;
+
+    if (list->count == list->high)
+        page_cache_drain(list, list->batch);
+
+    /* Unlink from mappings list just like free page */
+    list_del((struct List *)page);
+#if SANITIZE_SHADOW_BASE
+    if (current_space) platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
+#endif
+    list->pages[list->count++] = page;
+    return 1;
+}
+
+/*
+ * Called before allocations. When free memory drops below low
+ * watermark zero pools are dropped first, then registered
+ * environments are asked to free memory up to high watermark.
+ * Nothing more is done until free memory gets above high
+ * watermark again, so allocations in between stay cheap.
+ * Page caches are not drained here since they would be refilled
+ * by the next allocation (buddy_alloc_page() drains them
+ * when free lists actually run out).
+ */
+static void
+check_memory_pressure(void) {
+    static bool reclaim_requested;
+    if (reclaim_requested) {
+        if (free_page_count >= reclaim_high_pages) reclaim_requested = 0;
+        return;
+    }
+    if (free_page_count >= reclaim_low_pages || !current_space) return;
+    reclaim_requested = 1;
+
+    zero_pool_drain();
+    if (free_page_count < reclaim_low_pages)
+        env_request_reclaim(reclaim_high_pages - free_page_count);
+}
+
+/* Just allocate page, without mapping it */
+static struct Page *
+alloc_page(int class, int flags) {
+    /* NOTE This should be done before allocation since
+     * unreferenced page returned could be merged while
+     * other pages are freed */
+    if (!(flags & ALLOC_POOL)) check_memory_pressure();
+
+    struct PageCacheList *list = page_cache_list(class);
+    if (!list || flags & (ALLOC_POOL | ALLOC_BOOTMEM))
+        return buddy_alloc_page(class, flags);
+
+    if (list->count) {
+        list->hits++;
+    } else {
+        list->misses++;
+        page_cache_refill(list);
+        if (!list->count) return NULL;
+    }
+
+    /* Drop cache reference without freeing page */
+    struct Page *page = list->pages[--list->count];
+    assert(page->refc == 1 && !page->listed);
+    page->refc = 0;
+    return page;
+}
+
+void
+dump_page_caches(void) {
+    cprintf("Per-CPU page caches:\n");
+    cprintf("%-4s %-12s %6s %6s %10s %10s %8s %8s\n",
+            "cpu", "size", "count", "high", "hits", "misses", "refills", "drains");
+    for (size_t cpu = 0; cpu < NCPU; cpu++) {
+        for (size_t i = 0; i < NPAGE_CACHE_LISTS; i++) {
+            struct PageCacheList *list = &page_caches[cpu].lists[i];
+            cprintf("%-4zu 0x%-10llx %6zu %6zu %10zu %10zu %8zu %8zu\n",
+                    cpu, CLASS_SIZE(list->class), list->count, list->high,
+                    list->hits, list->misses, list->refills, list->drains);
+        }
+    }
+}
+
+/*
+ * Pools of pre-zeroed pages
+ *
+ * Pages are cleared in the background on timer ticks and consumed by
+ * zero-filled allocations instead of clearing or copying
+ * memory on the page fault path.
+ * Every pooled page holds one reference.
+ */
+
+#define ZERO_POOL_MAX 64
+
+static struct ZeroPool {
+    int class;
+    size_t size, count;
+    struct Page *pages[ZERO_POOL_MAX];
+    /* Statistics */
+    size_t hits, misses, refills;
+} zero_pools[] = {
+        {.class = 0, .size = ZERO_POOL_MAX},
+        {.class = HUGE_PAGE_CLASS, .size = 2},
+};
+
+#define NZERO_POOLS (sizeof(zero_pools) / sizeof(*zero_pools))
+
+static bool
+is_zero_page(struct Page *page) {
+    return page2pa(page) - page2pa(zero_page) < CLASS_SIZE(zero_page->class);
+}
+
+/* Returns referenced zeroed page of given class or NULL */
+static struct Page *
+zero_pool_get(int class) {
+    for (size_t i = 0; i < NZERO_POOLS; i++) {
+        struct ZeroPool *pool = &zero_pools[i];
+        if (pool->class != class) continue;
+
+        if (!pool->count) {
+            pool->misses++;
+            return NULL;
+        }
+        pool->hits++;
+        return pool->pages[--pool->count];
+    }
+    return NULL;
+}
+
+/* Release all pooled pages, returns number of pages freed */
+static size_t
+zero_pool_drain(void) {
+    size_t res = 0;
+    for (size_t i = 0; i < NZERO_POOLS; i++) {
+        struct ZeroPool *pool = &zero_pools[i];
+        while (pool->count) {
+            page_unref(pool->pages[--pool->count]);
+            res++;
+        }
+    }
+    return res;
+}
+
+/*
+ * Refill pools clearing at most budget
+ * bytes of memory (called on timer ticks)
+ */
+void
+refill_zero_pools(size_t budget) {
+    /* Don't compete with reclaim */
+    if (free_page_count < reclaim_high_pages) return;
+
+    for (size_t i = 0; i < NZERO_POOLS; i++) {
+        struct ZeroPool *pool = &zero_pools[i];
+        while (pool->count < pool->size && budget >= CLASS_SIZE(pool->class)) {
+            struct Page *page = alloc_page(pool->class, 0);
+            if (!page) return;
+
+            page_ref(page);
+            nosan_memset(KADDR(page2pa(page)), 0, CLASS_SIZE(pool->class));
+            pool->pages[pool->count++] = page;
+            pool->refills++;
+            budget -= CLASS_SIZE(pool->class);
+        }
+    }
+}
+
+void
+dump_zero_pools(void) {
+    cprintf("Zero page pools:\n");
+    for (size_t i = 0; i < NZERO_POOLS; i++) {
+        struct ZeroPool *pool = &zero_pools[i];
+        cprintf("  0x%llx bytes: %zu/%zu pages, %zu hits, %zu misses, %zu refilled\n", CLASS_SIZE(pool->class),
+                pool->count, pool->size, pool->hits, pool->misses, pool->refills);
+    }
+}
+
+static void
+dump_space_usage(const char *name, struct AddressSpace *spc) {
+    struct MemStat *st = &spc->stat;
+    cprintf("%10s %10llu %10llu %10llu %10llu %10llu\n", name, st->resident / KB,
+            st->shared / KB, st->lazy / KB, st->huge / KB, st->pagetable / KB);
+}
+
+void
+dump_memory_usage(void) {
+    char name[16];
+
+    cprintf("%10s %10s %10s %10s %10s %10s (KB)\n", "env", "resident",
+            "shared", "lazy", "huge", "pagetable");
+    dump_space_usage("kernel", &kspace);
+    for (size_t i = 0; i < NENV; i++) {
+        if (envs[i].env_status == ENV_FREE) continue;
+        snprintf(name, sizeof name, "%08x", envs[i].env_id);
+        dump_space_usage(name, &envs[i].address_space);
+    }
+}
+
+/* Maximal reference count of pages mapped by the part of
+ * virtual subtree node (of class class, starting at base)
+ * intersecting [start, end). Only nodes overlapping the range
+ * are visited, so a query costs one root-to-leaf path plus
+ * the number of mappings inside the range.
+ *
+ * The tree splits address bits, so its depth is bounded by
+ * MAX_CLASS rather than by the number of mappings: an aligned
+ * one-page range never straddles mid, so a one-page query (pipes,
+ * file server) visits at most MAX_CLASS + 1 = 49 nodes however
+ * large the address space is, and sys_region_refs() at most 98.
+ * Cached per-node maxima would not shorten that path, the leaf
+ * has to be reached to find the page anyway. */
+static int
+region_maxref_node(struct Page *node, int class, uintptr_t base, uintptr_t start, uintptr_t end) {
+    if (!node) return 0;
+    if (node->phy) return node->phy->refc + (node->phy->left || node->phy->right);
+
+    uintptr_t mid = base + CLASS_SIZE(class - 1);
+    int res = 0;
+    if (start < mid) res = region_maxref_node(node->left, class - 1, base, start, end);
+    if (end > mid) res = MAX(res, region_maxref_node(node->right, class - 1, mid, start, end));
+    return res;
+}
+
 int
 region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
-    int res = 0;
-    while (start < end) {
-        struct Page *page = page_lookup_virtual(spc->root, start, 0, LOOKUP_PRESERVE);
-        if (page && page->phy) {
-            res = MAX(res, page->phy->refc + (page->phy->left || page->phy->right));
-            start += CLASS_SIZE(page->phy->class);
-        } else
-            start += CLASS_SIZE(0);
-    }
-    return res;
+    if (start >= end) return 0;
+
+    assert_virtual(spc->root);
+    return region_maxref_node(spc->root, MAX_CLASS, 0, start, end);
 }
 
 inline static int
@@ -1221,8 +2006,9 @@ alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int fl
     return res;
 }
 
-int
-force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+/* Resolve lazy mapping at va, returns -E_NO_MEM if out of memory */
+static int
+do_force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
     int res = -E_FAULT;
     /* FIXME We need to propagate kernel PML4E
      * changes to every AddressSpace or just use KPTI
@@ -1240,8 +2026,8 @@ force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
 
     /* Lookup page mapping such that it's class it not larger than MAX_ALLOCATION_CLASS */
     struct Page *page;
-    if (!(page = page_lookup_virtual(spc->root, va, maxclass, LOOKUP_SPLIT))) goto fault;
-    if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE))) goto fault;
+    if (!(page = page_lookup_virtual(spc, va, maxclass, LOOKUP_SPLIT))) goto fault;
+    if (!(page = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE))) goto fault;
     if (!(page->state & PROT_LAZY)) goto fault;
 
     va &= ~CLASS_MASK(page->phy->class);
@@ -1258,17 +2044,29 @@ force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
         }
 
         struct Page *phy = page->phy;
-        page_ref(phy);
-        res = alloc_composite_page(spc, va, phy->class, page->state & PROT_ALL & ~PROT_LAZY);
-        if (!res) memcpy_page(spc, va, phy);
-        page_unref(phy);
+        struct Page *zpage = is_zero_page(phy) ? zero_pool_get(phy->class) : NULL;
+        if (zpage) {
+            res = map_page(spc, va, zpage, page->state & PROT_ALL & ~PROT_LAZY);
+            page_unref(zpage);
+        } else {
+            page_ref(phy);
+            res = alloc_composite_page(spc, va, phy->class, page->state & PROT_ALL & ~PROT_LAZY);
+            if (!res) memcpy_page(spc, va, phy);
+            page_unref(phy);
+        }
     }
 
 fault:
     switch_address_space(old);
+    return res;
+}
+
+int
+force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    int res = do_force_alloc_page(spc, va, maxclass);
 
     if (res == -E_NO_MEM) {
-        if (spc != &kspace) {
+        if (spc != &kspace && va <= MAX_USER_ADDRESS) {
             struct Env *env = (void *)((uint8_t *)spc - offsetof(struct Env, address_space));
             env_destroy(env);
         } else
@@ -1279,6 +2077,467 @@ fault:
     return res;
 }
 
+/*
+ * Transparent huge pages
+ *
+ * 2MB-aligned block of user memory fully populated with
+ * uniquely referenced writable (not PROT_LAZY/PROT_SHARE)
+ * pages having the same protection is copied into one
+ * huge page and remapped as a single 2MB mapping.
+ */
+
+static_assert(CLASS_SIZE(HUGE_PAGE_CLASS) == HUGE_PAGE_SIZE, "HUGE_PAGE_CLASS does not match HUGE_PAGE_SIZE");
+
+/* Check that virtual subtree is fully populated with
+ * promotable pages, *prot < 0 means any protection */
+static bool
+huge_subtree_ok(struct Page *node, int *prot) {
+    if (!node) return 0;
+
+    if (node->phy) {
+        int flags = node->state & PROT_ALL;
+        if (*prot < 0) *prot = flags;
+        return flags == *prot && !(flags & (PROT_LAZY | PROT_SHARE)) &&
+               PAGE_IS_UNIQ(node->phy) && node->phy->state == ALLOCATABLE_NODE;
+    }
+
+    return huge_subtree_ok(node->left, prot) && huge_subtree_ok(node->right, prot);
+}
+
+static void
+huge_copy_subtree(struct Page *node, int class, uint8_t *dst) {
+    if (node->phy) {
+        nosan_memcpy(dst, KADDR(page2pa(node->phy)), CLASS_SIZE(class));
+        return;
+    }
+
+    huge_copy_subtree(node->left, class - 1, dst);
+    huge_copy_subtree(node->right, class - 1, dst + CLASS_SIZE(class - 1));
+}
+
+/* Returns 1 if all pages of the 2MB block at va were written to,
+ * 0 if none of them were and -1 if dirty bits differ */
+static int
+huge_block_dirty(struct AddressSpace *spc, uintptr_t va) {
+    pde_t *ppde = user_pde(spc, va, 0);
+    if (!ppde) return 0;
+    pde_t pde = *ppde;
+    if (!(pde & PTE_P)) return 0;
+    if (pde & PTE_PS) return !!(pde & PTE_D);
+
+    pte_t *pt = KADDR(PTE_ADDR(pde));
+    size_t ndirty = 0;
+    for (size_t i = 0; i < PT_ENTRY_COUNT; i++)
+        ndirty += !!(pt[i] & PTE_D);
+
+    return ndirty == PT_ENTRY_COUNT ? 1 : ndirty ? -1 : 0;
+}
+
+/* Replace checked subtree node mapped at va with huge page */
+static int
+do_promote_huge_page(struct AddressSpace *spc, uintptr_t va, struct Page *node, int prot) {
+    /* Dirty bit is visible to user (e.g. file server
+     * writeback), so it should survive promotion */
+    int dirty = huge_block_dirty(spc, va);
+    if (dirty < 0) return -E_INVAL;
+
+    struct Page *page = alloc_page(HUGE_PAGE_CLASS, 0);
+    if (!page) return -E_NO_MEM;
+
+    if (trace_memory) cprintf("<%p> Promoting [%08lX, %08lX] to huge page\n",
+                              spc, va, va + (long)CLASS_MASK(HUGE_PAGE_CLASS));
+
+    huge_copy_subtree(node, HUGE_PAGE_CLASS, KADDR(page2pa(page)));
+
+    /* Old pages are freed by map_page() */
+    page_ref(page);
+    int res = map_page(spc, va, page, prot);
+    page_unref(page);
+
+    if (!res && dirty) *user_pde(spc, va, 0) |= PTE_D;
+    return res;
+}
+
+/*
+ * Try to promote 2MB block containing va
+ * after page at va was populated
+ *
+ * Only siblings of the path from page to the
+ * 2MB node are checked, so sequential population
+ * of the block costs O(n log n) node visits overall
+ */
+static int
+promote_huge_page(struct AddressSpace *spc, uintptr_t va) {
+    if (spc == &kspace || va >= MAX_USER_ADDRESS) return -E_INVAL;
+
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    if (!node || !node->phy || node->phy->class >= HUGE_PAGE_CLASS) return -E_INVAL;
+
+    int prot = -1;
+    if (!huge_subtree_ok(node, &prot)) return -E_INVAL;
+
+    for (int class = node->phy->class; class < HUGE_PAGE_CLASS; class ++) {
+        struct Page *parent = node->parent;
+        if (!huge_subtree_ok(parent->left == node ? parent->right : parent->left, &prot))
+            return -E_INVAL;
+        node = parent;
+    }
+
+    return do_promote_huge_page(spc, ROUNDDOWN(va, HUGE_PAGE_SIZE), node, prot);
+}
+
+/* Background scan position */
+static struct {
+    size_t env;
+    uintptr_t va;
+} huge_scan;
+
+static bool
+huge_scan_subtree(struct AddressSpace *spc, struct Page *node, int class, uintptr_t va, size_t *budget) {
+    if (!node || node->phy || va + CLASS_SIZE(class) <= huge_scan.va || va >= MAX_USER_ADDRESS) return 0;
+
+    if (class == HUGE_PAGE_CLASS) {
+        int prot = -1;
+        if (huge_subtree_ok(node, &prot)) do_promote_huge_page(spc, va, node, prot);
+        huge_scan.va = va + CLASS_SIZE(class);
+        return !--*budget;
+    }
+
+    return huge_scan_subtree(spc, node->left, class - 1, va, budget) ||
+           huge_scan_subtree(spc, node->right, class - 1, va + CLASS_SIZE(class - 1), budget);
+}
+
+/*
+ * Background promotion pass called on timer ticks.
+ * Examines at most budget 2MB blocks, continuing
+ * from where previous call stopped.
+ */
+void
+promote_huge_pages(size_t budget) {
+    for (size_t i = 0; i < NENV && budget; i++) {
+        struct Env *env = &envs[huge_scan.env];
+        if (env->env_status != ENV_FREE && env->env_status != ENV_DYING &&
+            huge_scan_subtree(&env->address_space, env->address_space.root, MAX_CLASS, 0, &budget)) break;
+
+        huge_scan.env = (huge_scan.env + 1) % NENV;
+        huge_scan.va = 0;
+    }
+}
+
+/*
+ * Same page merging
+ *
+ * Opt-in background scan of private 4KB user pages.  Pages filled
+ * with zeroes are replaced by lazy mappings of the zero page,
+ * other identical pages are merged into one PROT_LAZY page
+ * which is copied back on write by the usual lazy copying path.
+ *
+ * Candidate pages are found with a direct-mapped hash table.
+ * A slot remembers the last unmerged candidate (by envid and
+ * address, so it is revalidated when it is needed) and the
+ * stable page, which is referenced by the table so that
+ * it is never made writable in place.
+ * Only pages which content did not change since the previous
+ * scan are merged (the hash is kept in the mapping node), ones
+ * changing are likely to be written again.  Dirty bit is visible
+ * to users, so it is carried over to the merged mapping.
+ */
+
+#define KSM_SLOTS 512
+
+bool ksm_enabled;
+
+static struct KsmSlot {
+    uint64_t hash;
+    struct Page *stable; /* Referenced merged page */
+    envid_t envid;       /* Candidate not merged yet */
+    uintptr_t va;
+} ksm_table[KSM_SLOTS];
+
+static struct {
+    size_t env;
+    uintptr_t va;
+    /* Statistics */
+    size_t scanned, unstable, merged, zeroed;
+} ksm_scan;
+
+/* Returns PTE of 4KB user page mapped at va or 0 */
+static pte_t
+user_pte(struct AddressSpace *spc, uintptr_t va) {
+    pde_t *pde = user_pde(spc, va, 0);
+    if (!pde || !(*pde & PTE_P)) return 0;
+    if (*pde & PTE_PS) return *pde;
+    return ((pte_t *)KADDR(PTE_ADDR(*pde)))[PT_INDEX(va)];
+}
+
+/* Check that mapping node at va can be merged */
+static bool
+ksm_candidate(struct AddressSpace *spc, uintptr_t va, struct Page *node) {
+    if (!node || !node->phy || node->phy->class || node->state & PROT_SHARE) return 0;
+    if (!PAGE_IS_UNIQ(node->phy) || node->phy->state != ALLOCATABLE_NODE || is_filler_page(node->phy)) return 0;
+
+    return user_pte(spc, va) & PTE_P;
+}
+
+/* Replace mapping at va with lazy mapping of page keeping its dirty bit */
+static int
+ksm_remap(struct AddressSpace *spc, uintptr_t va, struct Page *page, int prot) {
+    bool dirty = user_pte(spc, va) & PTE_D;
+
+    int res = map_page(spc, va, page, prot);
+    if (!res && dirty) {
+        pde_t *pde = user_pde(spc, va, 0);
+        ((pte_t *)KADDR(PTE_ADDR(*pde)))[PT_INDEX(va)] |= PTE_D;
+    }
+    return res;
+}
+
+/* User pages are not unpoisoned in the kernel mapping,
+ * so they are read in chunks with nosan_memcpy() */
+#define KSM_CHUNK 256
+
+static uint64_t
+ksm_hash(struct Page *page, bool *zero) {
+    const uint8_t *data = KADDR(page2pa(page));
+    uint64_t buf[KSM_CHUNK / sizeof(uint64_t)];
+    uint64_t hash = 0xCBF29CE484222325ULL, any = 0;
+
+    for (size_t offset = 0; offset < PAGE_SIZE; offset += KSM_CHUNK) {
+        nosan_memcpy(buf, (void *)(data + offset), KSM_CHUNK);
+        for (size_t i = 0; i < KSM_CHUNK / sizeof(uint64_t); i++) {
+            hash = (hash ^ buf[i]) * 0x100000001B3ULL;
+            any |= buf[i];
+        }
+    }
+
+    *zero = !any;
+    return hash;
+}
+
+static bool
+ksm_same(struct Page *page1, struct Page *page2) {
+    const uint8_t *data1 = KADDR(page2pa(page1)), *data2 = KADDR(page2pa(page2));
+    uint8_t buf1[KSM_CHUNK], buf2[KSM_CHUNK];
+
+    for (size_t offset = 0; offset < PAGE_SIZE; offset += KSM_CHUNK) {
+        nosan_memcpy(buf1, (void *)(data1 + offset), KSM_CHUNK);
+        nosan_memcpy(buf2, (void *)(data2 + offset), KSM_CHUNK);
+        if (memcmp(buf1, buf2, KSM_CHUNK)) return 0;
+    }
+    return 1;
+}
+
+/* Drop stable page which is not mapped anymore */
+static void
+ksm_release_stale(struct KsmSlot *slot) {
+    if (slot->stable && slot->stable->refc == 1) {
+        page_unref(slot->stable);
+        slot->stable = NULL;
+    }
+}
+
+/* Returns node of candidate remembered in slot if it is
+ * still mergeable and has the same content as page */
+static struct Page *
+ksm_lookup_candidate(struct KsmSlot *slot, struct Page *page, struct AddressSpace **pspc) {
+    if (!slot->envid) return NULL;
+
+    struct Env *env = &envs[ENVX(slot->envid)];
+    if (env->env_id != slot->envid || env->env_status == ENV_FREE || env->env_status == ENV_DYING) return NULL;
+
+    struct Page *node = page_lookup_virtual(&env->address_space, slot->va, 0, LOOKUP_PRESERVE);
+    if (!ksm_candidate(&env->address_space, slot->va, node) ||
+        node->phy == page || !ksm_same(node->phy, page)) return NULL;
+
+    *pspc = &env->address_space;
+    return node;
+}
+
+static void
+ksm_merge_page(struct AddressSpace *spc, struct Env *env, uintptr_t va, struct Page *node) {
+    int prot = (node->state & PROT_ALL) | PROT_LAZY;
+    ksm_scan.scanned++;
+
+    bool zero;
+    uint64_t hash = ksm_hash(node->phy, &zero);
+    if (node->ksm_hash != hash) {
+        node->ksm_hash = hash;
+        ksm_scan.unstable++;
+        return;
+    }
+
+    if (zero) {
+        /* Page is freed by map_page() */
+        struct Page *zpage = page_lookup(zero_page, page2pa(zero_page), 0, PARTIAL_NODE, 1);
+        if (zpage && !ksm_remap(spc, va, zpage, prot)) ksm_scan.zeroed++;
+        return;
+    }
+
+    struct KsmSlot *slot = &ksm_table[hash % KSM_SLOTS];
+    ksm_release_stale(slot);
+
+    if (slot->stable && slot->hash == hash && ksm_same(slot->stable, node->phy)) {
+        if (!ksm_remap(spc, va, slot->stable, prot)) ksm_scan.merged++;
+        return;
+    }
+
+    struct AddressSpace *cspc;
+    struct Page *cnode = slot->stable || slot->hash != hash ? NULL : ksm_lookup_candidate(slot, node->phy, &cspc);
+    if (cnode) {
+        /* Write protect older candidate and make it stable */
+        struct Page *stable = cnode->phy;
+        page_ref(stable);
+        if (ksm_remap(cspc, slot->va, stable, (cnode->state & PROT_ALL) | PROT_LAZY) < 0) {
+            page_unref(stable);
+            return;
+        }
+        slot->stable = stable;
+        slot->envid = 0;
+        if (!ksm_remap(spc, va, stable, prot)) ksm_scan.merged++;
+        return;
+    }
+
+    if (!slot->stable) {
+        slot->hash = hash;
+        slot->envid = env->env_id;
+        slot->va = va;
+    }
+}
+
+static bool
+ksm_scan_subtree(struct Env *env, struct Page *node, int class, uintptr_t va, size_t *budget) {
+    if (!node || va + CLASS_SIZE(class) <= ksm_scan.va || va >= MAX_USER_ADDRESS) return 0;
+
+    if (node->phy) {
+        if (!class && ksm_candidate(&env->address_space, va, node))
+            ksm_merge_page(&env->address_space, env, va, node);
+        ksm_scan.va = va + CLASS_SIZE(class);
+        return !--*budget;
+    }
+
+    return ksm_scan_subtree(env, node->left, class - 1, va, budget) ||
+           ksm_scan_subtree(env, node->right, class - 1, va + CLASS_SIZE(class - 1), budget);
+}
+
+/*
+ * Background merging pass called on timer ticks.
+ * Examines at most budget mappings, continuing
+ * from where previous call stopped.
+ */
+void
+merge_identical_pages(size_t budget) {
+    if (!ksm_enabled) return;
+
+    for (size_t i = 0; i < NENV && budget; i++) {
+        struct Env *env = &envs[ksm_scan.env];
+        if (env->env_status != ENV_FREE && env->env_status != ENV_DYING &&
+            ksm_scan_subtree(env, env->address_space.root, MAX_CLASS, 0, &budget)) break;
+
+        ksm_scan.env = (ksm_scan.env + 1) % NENV;
+        ksm_scan.va = 0;
+        if (!ksm_scan.env) {
+            for (size_t j = 0; j < KSM_SLOTS; j++) ksm_release_stale(&ksm_table[j]);
+        }
+    }
+}
+
+/* Enable or disable merging, disabling releases stable pages
+ * (already merged pages stay merged until written) */
+void
+ksm_set_enabled(bool enable) {
+    ksm_enabled = enable;
+    if (enable) return;
+
+    for (size_t i = 0; i < KSM_SLOTS; i++) {
+        if (ksm_table[i].stable) page_unref(ksm_table[i].stable);
+        ksm_table[i] = (struct KsmSlot){0};
+    }
+}
+
+void
+dump_ksm_stats(void) {
+    size_t nstable = 0, saved = 0;
+    for (size_t i = 0; i < KSM_SLOTS; i++) {
+        struct Page *page = ksm_table[i].stable;
+        if (!page || page->refc < 2) continue;
+        nstable++;
+        /* One reference is held by the table */
+        saved += page->refc - 2;
+    }
+
+    cprintf("Same page merging: %s\n", ksm_enabled ? "enabled" : "disabled");
+    cprintf("  %zu pages scanned, %zu changed since previous scan, %zu merged, %zu zero pages unmapped\n",
+            ksm_scan.scanned, ksm_scan.unstable, ksm_scan.merged, ksm_scan.zeroed);
+    cprintf("  %zu stable pages shared by %zu mappings, saving %llu KB\n",
+            nstable, saved + nstable, saved * PAGE_SIZE / KB);
+}
+
+/* Number of pages in aligned window around faulting
+ * address resolved on each page fault (0 or 1 disables it) */
+size_t fault_around_pages = 16;
+
+/* Split lazy mapping of shared huge page so only
+ * 4KB page at va would be copied on fault.
+ * Returns true if mapping was split */
+static bool
+demote_cow_page(struct AddressSpace *spc, uintptr_t va) {
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    if (!node || !node->phy || !(node->state & PROT_LAZY) || !node->phy->class ||
+        PAGE_IS_UNIQ(node->phy) || node->phy->state != ALLOCATABLE_NODE) return 0;
+
+    return !!page_lookup_virtual(spc, va, 0, LOOKUP_SPLIT);
+}
+
+/* Resolve lazy mappings with protection prot
+ * in the window around va, errors are ignored */
+static void
+fault_around(struct AddressSpace *spc, uintptr_t va, int prot) {
+    size_t window = MIN(fault_around_pages, HUGE_PAGE_SIZE / PAGE_SIZE) * PAGE_SIZE;
+    uintptr_t end = MIN(ROUNDDOWN(va, window) + window, MAX_USER_ADDRESS);
+
+    for (uintptr_t addr = ROUNDDOWN(va, window); addr < end;) {
+        struct Page *node = page_lookup_virtual(spc, addr, 0, LOOKUP_PRESERVE);
+        if (!node || !node->phy || (node->state & PROT_ALL) != prot) {
+            addr += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t next = ROUNDDOWN(addr, CLASS_SIZE(node->phy->class)) + CLASS_SIZE(node->phy->class);
+        if (demote_cow_page(spc, addr)) next = addr + PAGE_SIZE;
+        if (do_force_alloc_page(spc, addr, MAX_ALLOCATION_CLASS) == -E_NO_MEM) break;
+        addr = next;
+    }
+}
+
+/*
+ * Resolve page fault at va
+ *
+ * Copy-on-write faults on shared huge pages copy
+ * only 4KB page containing va, rest of the mapping
+ * stays shared (lazy zero/one-filled regions
+ * are still allocated with huge pages).
+ * Lazy neighbours of the page with the same protection
+ * are resolved too (see fault_around_pages).
+ * Populated block is promoted to huge page if possible.
+ */
+int
+fault_alloc_page(struct AddressSpace *spc, uintptr_t va) {
+    int prot = -1;
+
+    if (spc != &kspace && va < MAX_USER_ADDRESS) {
+        struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+        if (node && node->phy) prot = node->state & PROT_ALL;
+        demote_cow_page(spc, va);
+    }
+
+    int res = force_alloc_page(spc, va, MAX_ALLOCATION_CLASS);
+    if (res) return res;
+
+    if (prot >= 0 && fault_around_pages > 1) fault_around(spc, va, prot);
+    promote_huge_page(spc, va);
+    return 0;
+}
+
 static int
 do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, struct Page *phy, int oldflags, int flags) {
     int res;
@@ -1320,7 +2579,7 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
         res = force_alloc_page(sspace, src, MAX_CLASS);
         if (res < 0 || (sspace == dspace && src == dst)) return res;
 
-        struct Page *newv = page_lookup_virtual(sspace->root, src, class, LOOKUP_PRESERVE);
+        struct Page *newv = page_lookup_virtual(sspace, src, class, LOOKUP_PRESERVE);
         check_virtual_class(newv, class);
         assert(newv && newv->phy);
         phy = newv->phy;
@@ -1344,6 +2603,88 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
     return res;
 }
 
+/* Check that lazily copying every mapping of subtree node with flags
+ * leaves identical page table entries in source and destination */
+static bool
+pt_share_ok(struct Page *node, int flags) {
+    if (!node) return 1;
+
+    if (node->phy) {
+        int oldflags = node->state & PROT_ALL;
+        if (oldflags & PROT_SHARE) return 0;
+        if (flags & PROT_COMBINE) flags &= oldflags | PROT_LAZY;
+        return prot2pte(flags) == prot2pte(oldflags | PROT_LAZY);
+    }
+
+    return pt_share_ok(node->left, flags) && pt_share_ok(node->right, flags);
+}
+
+/* Mark mappings of subtree node lazy in sspace, rewriting their
+ * entries in page table pt, and map them to dspace without
+ * touching its page tables */
+static int
+share_pt_subtree(struct AddressSpace *dspace, struct AddressSpace *sspace, struct Page *node, int class, uintptr_t va, pte_t *pt, int flags) {
+    if (!node) return 0;
+
+    if (node->phy) {
+        int oldflags = node->state & PROT_ALL;
+        if (flags & PROT_COMBINE) flags &= oldflags | PROT_LAZY;
+
+        account_mapping(sspace, node, 0);
+        node->state = (oldflags | PROT_LAZY) | MAPPING_NODE;
+        account_mapping(sspace, node, 1);
+        pte_t base = page2pa(node->phy) | prot2pte(oldflags | PROT_LAZY);
+        for (size_t i = 0; i < CLASS_SIZE(class) / CLASS_SIZE(0); i++)
+            pt[PT_INDEX(va) + i] = base + i * CLASS_SIZE(0);
+
+        struct Page *mapping = page_lookup_virtual(dspace, va, class, LOOKUP_ALLOC);
+        if (!mapping) return -E_NO_MEM;
+        page_ref(node->phy);
+        mapping->phy = node->phy;
+        mapping->state = (PAGE_PROT(flags) & ~PROT_COMBINE) | MAPPING_NODE;
+        list_append((struct List *)node->phy, (struct List *)mapping);
+        account_mapping(dspace, mapping, 1);
+        return 0;
+    }
+
+    int res = share_pt_subtree(dspace, sspace, node->left, class - 1, va, pt, flags);
+    if (res < 0) return res;
+    return share_pt_subtree(dspace, sspace, node->right, class - 1, va + CLASS_SIZE(class - 1), pt, flags);
+}
+
+/*
+ * Lazily copy 2MB user block at va with page table
+ * of sspace referenced from dspace instead of being
+ * filled entry by entry (and copied on first modification).
+ * Returns 1 if the block cannot be copied this way
+ */
+static int
+share_pt_block(struct AddressSpace *dspace, struct AddressSpace *sspace, uintptr_t va, struct Page *node, int flags) {
+    if (dspace == sspace || dspace == &kspace || sspace == &kspace ||
+        va >= MAX_USER_ADDRESS || !(flags & PROT_LAZY)) return 1;
+
+    pde_t *spde = user_pde(sspace, va, 0);
+    if (!spde || !(*spde & PTE_P) || *spde & PTE_PS) return 1;
+
+    /* Destination block should be empty */
+    pde_t *dpde = user_pde(dspace, va, 0);
+    if (dpde && *dpde & PTE_P) return 1;
+
+    if (!pt_share_ok(node, flags)) return 1;
+
+    if (!(dpde = user_pde(dspace, va, 1))) return -E_NO_MEM;
+
+    int res = share_pt_subtree(dspace, sspace, node, HUGE_PAGE_CLASS, va, KADDR(PTE_ADDR(*spde)), flags);
+    tlb_invalidate_range(sspace, va, va + HUGE_PAGE_SIZE);
+    if (res < 0) return res;
+
+    page_ref(pt_page(*spde));
+    *spde |= PDE_SHARED_PT;
+    *dpde = *spde;
+    dspace->stat.pagetable += CLASS_SIZE(0);
+    return 0;
+}
+
 /* Subtree consiting of one or more physical pages */
 static int
 do_map_subtree(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, struct Page *vpage, int class, int flags) {
@@ -1358,6 +2699,11 @@ do_map_subtree(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *
         }
         assert(vpage->state == INTERMEDIATE_NODE);
 
+        /* Fork of whole page table */
+        if (class == HUGE_PAGE_CLASS && dst == src &&
+            (res = share_pt_block(dspace, sspace, dst, vpage, flags)) <= 0) return res;
+        res = 0;
+
         if (vpage->left && (res = do_map_subtree(dspace, dst,
                                                  sspace, src, vpage->left, class - 1, flags)) < 0) break;
 
@@ -1369,7 +2715,31 @@ do_map_subtree(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *
     return res;
 }
 
-static struct Page *zero_page, *one_page;
+/* Allocate page filled with 0x00 or 0xFF (if one is set) and map it */
+static int
+alloc_filled_page(struct AddressSpace *dspace, uintptr_t dst, int class, int prot, bool one) {
+    int res;
+
+    struct Page *page = one ? NULL : zero_pool_get(class);
+    if (page) {
+        res = map_page(dspace, dst, page, prot);
+        page_unref(page);
+        return res;
+    }
+
+    res = alloc_composite_page(dspace, dst, class, prot);
+    if (!res) {
+        assert(current_space);
+        assert(dspace);
+        struct AddressSpace *old = switch_address_space(dspace);
+        tlb_gather_flush();
+        set_wp(0);
+        nosan_memset((void *)dst, one ? 0xFF : 0x00, CLASS_SIZE(class));
+        set_wp(1);
+        switch_address_space(old);
+    }
+    return res;
+}
 
 static int
 do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, int class, int flags) {
@@ -1380,28 +2750,10 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
         if (flags & PROT_SHARE) {
             /* Shared pages cannot be lazily allocated
              * So just allocate them and filled with 0's/FF's */
-            res = alloc_composite_page(dspace, dst, class, flags & PROT_ALL & ~(PROT_LAZY | PROT_COMBINE));
-            if (!res) {
-                assert(current_space);
-                assert(dspace);
-                struct AddressSpace *old = switch_address_space(dspace);
-                set_wp(0);
-                nosan_memset((void *)dst, flags & ALLOC_ONE ? 0xFF : 0x00, CLASS_SIZE(class));
-                set_wp(1);
-                switch_address_space(old);
-            }
+            res = alloc_filled_page(dspace, dst, class, flags & PROT_ALL & ~(PROT_LAZY | PROT_COMBINE), flags & ALLOC_ONE);
         } else if (flags & ALLOC_NOW) {
             // Lazy allocation is explicitly prevented
-            res = alloc_composite_page(dspace, dst, class, flags & PROT_ALL & ~PROT_LAZY);
-            if (!res) {
-                assert(current_space);
-                assert(dspace);
-                struct AddressSpace *old = switch_address_space(dspace);
-                set_wp(0);
-                nosan_memset((void *)dst, flags & ALLOC_ONE ? 0xFF : 0x00, CLASS_SIZE(class));
-                set_wp(1);
-                switch_address_space(old);
-            }
+            res = alloc_filled_page(dspace, dst, class, flags & PROT_ALL & ~PROT_LAZY, flags & ALLOC_ONE);
         } else {
             /* MAP_ZERO and MAP_ONE ignore sspace and source and
              * use special 0x00/0xFF-filled pages */
@@ -1422,7 +2774,7 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
             }
         }
     } else {
-        struct Page *page1 = page_lookup_virtual(sspace->root, src, class, LOOKUP_ALLOC);
+        struct Page *page1 = page_lookup_virtual(sspace, src, class, LOOKUP_ALLOC);
         assert(page1);
         if (page1->phy && page1->phy->class > class) {
             /* We need to split physical page if part of it is remapped */
@@ -1459,14 +2811,15 @@ map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspa
      * remapping overlapping regions to higher addresses */
     assert(sspace != dspace || dst <= src || ABSDIFF(src, dst) >= size);
 
+    /* Invalidate TLB once for the whole region */
+    tlb_gather_begin();
+
     uintptr_t end = dst + size;
-    int max_class = addr_common_class(src, dst), class = 0, res;
+    int max_class = addr_common_class(src, dst), class = 0, res = 0;
     for (; class < max_class && dst + CLASS_SIZE(class) <= end; class ++) {
         if (dst & CLASS_SIZE(class)) {
             res = do_map_region_one_page(dspace, dst, sspace, src, class, flags);
-            if (res < 0){
-                return res;
-            }
+            if (res < 0) goto finish;
             dst += CLASS_SIZE(class);
             src += CLASS_SIZE(class);
         }
@@ -1475,15 +2828,15 @@ map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspa
     for (; class >= 0 && dst < end; class --) {
         while (dst + CLASS_SIZE(class) <= end) {
             res = do_map_region_one_page(dspace, dst, sspace, src, class, flags);
-            if (res < 0){
-                return res;
-            }
+            if (res < 0) goto finish;
             dst += CLASS_SIZE(class);
             src += CLASS_SIZE(class);
         }
     }
 
-    return 0;
+finish:
+    tlb_gather_end();
+    return res;
 }
 
 void
@@ -1531,10 +2884,17 @@ switch_address_space(struct AddressSpace *space) {
         return space;
     }
 
+    /* Without PCIDs pending invalidations of non-global
+     * entries are performed by CR3 reload itself */
+    if (pcid_enabled || tlb_gather.global)
+        tlb_gather_flush();
+    else
+        tlb_gather_reset();
+
     struct AddressSpace *old_space = current_space;
     current_space = space;
 
-    lcr3(space->cr3);
+    lcr3(space_cr3(space));
 
     return old_space;
 }
@@ -1546,7 +2906,7 @@ init_address_space(struct AddressSpace *space) {
     // LAB 8: Your code here DONE
     int res = 0;
 
-    res = alloc_pt(&space->cr3);
+    res = alloc_pt(space, &space->cr3);
     if (res < 0)
         return res;
     
@@ -1648,6 +3008,9 @@ detect_memory(void) {
 
     check_physical_tree(&root);
 
+    reclaim_low_pages = free_page_count / RECLAIM_LOW_DIVISOR;
+    reclaim_high_pages = reclaim_low_pages * 2;
+
     /* Setup constant one/zero pages */
     one_page = page_lookup(NULL, PADDR(one_page_raw), MAX_ALLOCATION_CLASS, PARTIAL_NODE, 1);
     page_ref(one_page);
@@ -1695,10 +3058,16 @@ kzalloc_region(size_t size) {
 
     size = ROUNDUP(size, PAGE_SIZE);
 
-    if (metaheaptop + size > KERN_HEAP_END) panic("Kernel heap overflow\n");
+    /* Align region to the largest page class fitting into it,
+     * so that big regions are mapped with 2M pages
+     * and power of two sized ones with a single page */
+    int class = 0;
+    while (class < MAX_ALLOCATION_CLASS && CLASS_SIZE(class + 1) <= size) class++;
+    uintptr_t res = ROUNDUP(metaheaptop, CLASS_SIZE(class));
+
+    if (res + size > KERN_HEAP_END) panic("Kernel heap overflow\n");
 
-    uintptr_t res = metaheaptop;
-    metaheaptop += size;
+    metaheaptop = res + size;
 
     int r = map_region(&kspace, res, NULL, 0, size,
                        PROT_R | PROT_W | ALLOC_ZERO | extra_flags);
@@ -1808,6 +3177,11 @@ void
 init_memory(void) {
     int res;
 
+    /* Detect paging features before any mapping is created */
+    uint32_t ecx, edx;
+    cpuid(1, NULL, NULL, &ecx, &edx);
+    global_pages = !!(edx & CPUID_1_EDX_PGE);
+
     init_allocator();
     if (trace_init) cprintf("Memory allocator is initiallized\n");
 
@@ -1881,18 +3255,35 @@ init_memory(void) {
     /* Set appropriate cr0 and cr4 bits
      * (In assembly code only minimal set of modes was set)*/
     lcr0(CR0_PE | CR0_PG | CR0_AM | CR0_WP | CR0_NE | CR0_MP);
-    lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
+    lcr4(CR4_PSE | CR4_PAE | CR4_PCE | (global_pages ? CR4_PGE : 0));
 
     /* Enable NX bit (execution protection) */
     uint64_t efer = rdmsr(EFER_MSR);
     efer |= EFER_NXE;
     wrmsr(EFER_MSR, efer);
 
+    /* Program PAT so that PROT_WC (PTE_PWT) selects write-combining
+     * instead of write-through and PROT_CD stays uncacheable.
+     * Entries 4-7 (PTE_PAT set) repeat entries 0-3.
+     * TLB is flushed by switch_address_space() below */
+    if (edx & CPUID_1_EDX_PAT) {
+        uint64_t pat = PAT_ENTRY(0, PAT_WB) | PAT_ENTRY(1, PAT_WC) |
+                       PAT_ENTRY(2, PAT_UCM) | PAT_ENTRY(3, PAT_UC);
+        wrmsr(PAT_MSR, pat | pat << 32);
+        wbinvd();
+    }
+
     for (size_t i = 0; i < CLASS_SIZE(MAX_ALLOCATION_CLASS); i++) assert(!zero_page_raw[i]);
 
     // check_virtual_tree(kspace.root, MAX_CLASS);
     // cprintf(">>> {\n");
     switch_address_space(&kspace);
+
+    /* Enable process-context identifiers (CR3 PCID bits are clear at this point) */
+    if (ecx & CPUID_1_ECX_PCID) {
+        lcr4(rcr4() | CR4_PCIDE);
+        pcid_enabled = 1;
+    }
     // check_physical_tree(&root);
     // check_virtual_tree(kspace.root, MAX_CLASS);
     // cprintf(">>> }\n");
@@ -1996,7 +3387,7 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
         }
 
     while (cur_va < end_va) {
-        struct Page *virtPage = page_lookup_virtual(env->address_space.root, cur_va, 0, false);
+        struct Page *virtPage = page_lookup_virtual(&env->address_space, cur_va, 0, false);
         DEMAND_(virtPage);
 
         struct Page *page = virtPage->phy;
@@ -2034,7 +3425,7 @@ lookup_physaddr(const void *region, size_t size) {
 
     // cprintf(">> 0x%016zx 0x%zx (%d)\n", (uintptr_t)region, size, class);
     // struct Page *page = page_lookup(NULL, (uintptr_t)region, class, PARTIAL_NODE, false);
-    struct Page *page = page_lookup_virtual(kspace.root, (uintptr_t)region, class, false);
+    struct Page *page = page_lookup_virtual(&kspace, (uintptr_t)region, class, false);
     assert(page);
     page = page->phy;
     assert(page);
@@ -68,6 +68,8 @@ void __nosan_memmove(void *, void *, size_t);
 
 /* Maximal size of page allocated on pagefault */
 #define MAX_ALLOCATION_CLASS 9
+/* Class of 2MB hardware page */
+#define HUGE_PAGE_CLASS 9
 
 enum PageState {
     MAPPING_NODE = 0x100000,      /* Memory mapping (part of virtual tree) */
@@ -81,6 +83,10 @@ enum PageState {
 extern __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t zero_page_raw[HUGE_PAGE_SIZE];
 extern __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t one_page_raw[HUGE_PAGE_SIZE];
 
+/* Descriptors are cache line sized and aligned
+ * so that no two of them share a cache line */
+#define PAGE_DESC_ALIGN 64
+
 struct Page {
     struct List head; /* This should be first member */
     struct Page *left, *right, *parent;
@@ -91,13 +97,21 @@ struct Page {
              * Child nodes always have class
              * smaller by 1 than their parents */
             uint32_t refc;
+            /* Page is linked into free list of its class */
+            uint32_t listed;
             uintptr_t class : CLASS_BASE;                        /* = log2(size)-CLASS_BASE */
             uintptr_t addr : sizeof(uintptr_t) * 8 - CLASS_BASE; /* = address >> CLASS_BASE */
         };
         /* mapping */
-        struct Page *phy; /* If phy == NULL this is intemediate page */
+        struct {
+            struct Page *phy; /* If phy == NULL this is intemediate page */
+            /* Content hash seen by previous same page merging scan */
+            uint64_t ksm_hash;
+        };
     };
-};
+} __attribute__((aligned(PAGE_DESC_ALIGN)));
+
+static_assert(sizeof(struct Page) == PAGE_DESC_ALIGN, "Page descriptor should fill exactly one cache line");
 
 struct PagePool {
     struct Page *peer;     /* Page from which memory is taken */
@@ -106,7 +120,7 @@ struct PagePool {
 };
 
 int map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags);
-void unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size);
+int unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size);
 void init_memory(void);
 void release_address_space(struct AddressSpace *space);
 struct AddressSpace *switch_address_space(struct AddressSpace *space);
@@ -115,10 +129,24 @@ int user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 int region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size);
 int force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass);
+int fault_alloc_page(struct AddressSpace *spc, uintptr_t va);
+void promote_huge_pages(size_t budget);
+void refill_zero_pools(size_t budget);
+void merge_identical_pages(size_t budget);
+void ksm_set_enabled(bool enable);
 void dump_page_table(pte_t *pml4);
 void dump_memory_lists(void);
+void dump_desc_caches(void);
+void dump_zero_pools(void);
+void dump_memory_usage(void);
+void dump_ksm_stats(void);
+void dump_page_caches(void);
 void dump_virtual_tree(struct Page *node, int class);
 
+extern size_t tlb_flush_threshold;
+extern size_t fault_around_pages;
+extern bool ksm_enabled;
+
 extern bool kzalloc_region_no_cow;
 void *kzalloc_region(size_t size);
 
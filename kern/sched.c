@@ -2,60 +2,192 @@
 #include <inc/x86.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
 
 
 struct Taskstate cpu_ts;
 _Noreturn void sched_halt(void);
 
+/* Number of 2MB blocks examined for huge page promotion per timer tick */
+#define HUGE_SCAN_BUDGET 4
+/* Number of bytes of pre-zeroed pages cleared per timer tick */
+#define ZERO_POOL_BUDGET HUGE_PAGE_SIZE
+/* Number of mappings examined for same page merging per timer tick */
+#define KSM_SCAN_BUDGET 256
+
+/*
+ * Fair scheduling
+ *
+ * Environments accumulate virtual runtime: used CPU time scaled
+ * by NICE_0_WEIGHT / env_weight, so environments with lower nice
+ * levels age slower and get proportionally more CPU time.
+ * ENV_RUNNABLE environments are kept in a treap ordered
+ * by virtual runtime (the running one is not in it),
+ * the leftmost node is cached and is the one to run next.
+ */
+
+/* Weight of nice level 0, each level changes weight by ~1.25x */
+#define NICE_0_WEIGHT 1024
+
+/* Virtual runtime (in TSC cycles) waking environments may lag
+ * behind the others, so they preempt CPU hogs soon,
+ * but cannot bank CPU time while sleeping */
+#define SCHED_WAKEUP_CREDIT 3000000
+
+static const uint32_t nice_to_weight[NICE_MAX - NICE_MIN + 1] = {
+        /* -20 */ 88761, 71755, 56483, 46273, 36291,
+        /* -15 */ 29154, 23254, 18705, 14949, 11916,
+        /* -10 */ 9548, 7620, 6100, 4904, 3906,
+        /*  -5 */ 3121, 2501, 1991, 1586, 1277,
+        /*   0 */ 1024, 820, 655, 526, 423,
+        /*   5 */ 335, 272, 215, 172, 137,
+        /*  10 */ 110, 87, 70, 56, 45,
+        /*  15 */ 36, 29, 23, 18, 15,
+};
+
+static struct Env *run_root;  /* Root of the run tree */
+static struct Env *run_first; /* Leftmost node of the run tree */
+static uint64_t min_vruntime; /* Non-decreasing minimal vruntime */
+static uint32_t run_seed = 2463534242;
+
+static bool
+vruntime_before(struct Env *a, struct Env *b) {
+    return a->env_vruntime < b->env_vruntime ||
+           (a->env_vruntime == b->env_vruntime && a->env_id < b->env_id);
+}
+
+/* Split tree into nodes running before env and the rest */
+static void
+run_tree_split(struct Env *tree, struct Env *env, struct Env **left, struct Env **right) {
+    while (tree) {
+        if (vruntime_before(tree, env)) {
+            *left = tree;
+            left = &tree->env_rq_right;
+            tree = tree->env_rq_right;
+        } else {
+            *right = tree;
+            right = &tree->env_rq_left;
+            tree = tree->env_rq_left;
+        }
+    }
+    *left = *right = NULL;
+}
+
+/* Merge trees, all nodes of left run before nodes of right */
+static struct Env *
+run_tree_merge(struct Env *left, struct Env *right) {
+    struct Env *tree = NULL, **link = &tree;
+
+    while (left && right) {
+        if (left->env_rq_heap > right->env_rq_heap) {
+            *link = left;
+            link = &left->env_rq_right;
+            left = left->env_rq_right;
+        } else {
+            *link = right;
+            link = &right->env_rq_left;
+            right = right->env_rq_left;
+        }
+    }
+    *link = left ? left : right;
+
+    return tree;
+}
+
+void
+sched_enqueue(struct Env *env) {
+    if (min_vruntime > SCHED_WAKEUP_CREDIT)
+        env->env_vruntime = MAX(env->env_vruntime, min_vruntime - SCHED_WAKEUP_CREDIT);
+
+    /* xorshift32 */
+    run_seed ^= run_seed << 13;
+    run_seed ^= run_seed >> 17;
+    run_seed ^= run_seed << 5;
+    env->env_rq_heap = run_seed;
+
+    struct Env **link = &run_root;
+    while (*link && (*link)->env_rq_heap > env->env_rq_heap)
+        link = vruntime_before(env, *link) ? &(*link)->env_rq_left : &(*link)->env_rq_right;
+    run_tree_split(*link, env, &env->env_rq_left, &env->env_rq_right);
+    *link = env;
+
+    if (!run_first || vruntime_before(env, run_first)) run_first = env;
+}
+
+void
+sched_dequeue(struct Env *env) {
+    struct Env **link = &run_root;
+    while (*link != env) {
+        assert(*link);
+        link = vruntime_before(env, *link) ? &(*link)->env_rq_left : &(*link)->env_rq_right;
+    }
+    *link = run_tree_merge(env->env_rq_left, env->env_rq_right);
+    env->env_rq_left = env->env_rq_right = NULL;
+
+    if (run_first == env) {
+        run_first = run_root;
+        while (run_first && run_first->env_rq_left)
+            run_first = run_first->env_rq_left;
+    }
+}
+
+void
+sched_set_nice(struct Env *env, int nice) {
+    assert(nice >= NICE_MIN && nice <= NICE_MAX);
+    env->env_nice = nice;
+    env->env_weight = nice_to_weight[nice - NICE_MIN];
+}
+
+/* Charge ENV_RUNNING env for the time since it was last charged */
+void
+sched_update_runtime(struct Env *env) {
+    uint64_t now = read_tsc();
+    uint64_t delta = now - env->env_exec_start;
+
+    env->env_exec_start = now;
+    env->env_runtime += delta;
+    env->env_vruntime += delta * NICE_0_WEIGHT / env->env_weight;
+}
+
+/* Move ENV_RUNNING env behind all runnable environments,
+ * so that yielding lets every one of them run first */
+void
+sched_defer(struct Env *env) {
+    struct Env *last = run_root;
+    while (last && last->env_rq_right)
+        last = last->env_rq_right;
+
+    if (last && !vruntime_before(last, env))
+        env->env_vruntime = last->env_vruntime + 1;
+}
+
 /* Choose a user environment to run and run it */
 _Noreturn void
 sched_yield(void) {
-    /* Implement simple round-robin scheduling.
-     *
-     * Search through 'envs' for an ENV_RUNNABLE environment in
-     * circular fashion starting just after the env was
-     * last running.  Switch to the first such environment found.
-     *
-     * If no envs are runnable, but the environment previously
-     * running is still ENV_RUNNING, it's okay to
-     * choose that environment.
+    /* Run the environment with the smallest virtual runtime,
+     * which is either the leftmost one in the run tree or
+     * the environment previously running if it is still
+     * ENV_RUNNING.  env_run() puts the latter back into the tree.
      *
      * If there are no runnable environments,
      * simply drop through to the code
      * below to halt the cpu */
 
-    struct Env *env_initial = curenv ? curenv : envs + NENV - 1;
-    struct Env *env_cur = env_initial;
-
-    /*const char *state[] = {"FREE", "DYING", "RUNNABLE", "RUNNING", "NOT_RUNNABLE"};
-
-    for (unsigned i = 0; i < NENV; ++i) {
-        if (envs[i].env_status == ENV_FREE) {
-            continue;
-        }
-        
-        cprintf("> %08X %s\n",  envs[i].env_id, state[envs[i].env_status]);
-    }*/
-
-    do {
-        env_cur++;
-        if (env_cur >= envs + NENV) {
-            env_cur = envs;
-        }
-
-        // if (env_cur->env_status != ENV_FREE)
-        //     cprintf("Env %08X %s\n",  env_cur->env_id, state[env_cur->env_status]);
+    struct Env *next = run_first;
+    bool running = curenv && curenv->env_status == ENV_RUNNING;
 
-        if (env_cur->env_status == ENV_RUNNABLE) {
-            break;
-        }
-    } while (env_cur != env_initial);
+    if (running) sched_update_runtime(curenv);
 
-    if (env_cur->env_status == ENV_RUNNABLE || env_cur->env_status == ENV_RUNNING) {
-        env_run(env_cur);
+    if (running || next) {
+        uint64_t vruntime = running ? curenv->env_vruntime : next->env_vruntime;
+        if (next) vruntime = MIN(vruntime, next->env_vruntime);
+        min_vruntime = MAX(min_vruntime, vruntime);
     }
 
-    assert(env_cur == env_initial);
+    if (next && (!running || vruntime_before(next, curenv))) env_run(next);
+
+    if (running) env_run(curenv);
 
     /* No runnable environments,
         * so just halt the cpu */
@@ -63,6 +195,23 @@ sched_yield(void) {
     sched_halt();
 }
 
+/* Background memory maintenance, called on every timer tick.
+ * The CPU never idles with environments left (sched_halt() drops
+ * into the monitor once nothing is runnable), so instead of
+ * using idle time it is done in small bounded steps */
+void
+sched_background_work(void) {
+    bool running = curenv && curenv->env_status == ENV_RUNNING;
+    if (running) sched_update_runtime(curenv);
+
+    promote_huge_pages(HUGE_SCAN_BUDGET);
+    refill_zero_pools(ZERO_POOL_BUDGET);
+    merge_identical_pages(KSM_SCAN_BUDGET);
+
+    /* Interrupted environment is not charged for it */
+    if (running) curenv->env_exec_start = read_tsc();
+}
+
 /* Halt this CPU when there is nothing to do. Wait until the
  * timer interrupt wakes it up. This function never returns */
 _Noreturn void
@@ -72,12 +221,7 @@ sched_halt(void) {
 
     /* For debugging and testing purposes, if there are no runnable
      * environments in the system, then drop into the kernel monitor */
-    int i;
-    for (i = 0; i < NENV; i++)
-        if (envs[i].env_status == ENV_RUNNABLE ||
-            envs[i].env_status == ENV_RUNNING) break;
-    
-    if (i == NENV) {
+    if (!run_first) {
         cprintf("No runnable environments in the system!\n");
         for (;;) monitor(NULL);
     }
@@ -6,6 +6,18 @@
 #error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/env.h>
+
+/* Default nice levels of environments */
+#define SCHED_NICE_SERVER  (-5)
+#define SCHED_NICE_DEFAULT 0
+
 _Noreturn void sched_yield(void);
+void sched_enqueue(struct Env *env);
+void sched_dequeue(struct Env *env);
+void sched_set_nice(struct Env *env, int nice);
+void sched_update_runtime(struct Env *env);
+void sched_defer(struct Env *env);
+void sched_background_work(void);
 
 #endif /* !JOS_KERN_SCHED_H */
@@ -4,15 +4,18 @@
 #include <inc/error.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/spawn.h>
 
 #include <kern/console.h>
 #include <kern/env.h>
+#include <kern/imgcache.h>
 #include <kern/kclock.h>
 #include <kern/pmap.h>
 #include <kern/sched.h>
 #include <kern/syscall.h>
 #include <kern/trap.h>
 #include <kern/traceopt.h>
+#include <kern/usercopy.h>
 #include <kern/virtiogpu.h>
 
 /* Print a string to the system console.
@@ -22,10 +25,22 @@ static int
 sys_cputs(const char *s, size_t len) {
     // LAB 8: Your code here DONE
 
-    /* Check that the user has permission to read memory [s, s+len).
-    * Destroy the environment if not. */
-    user_mem_assert(curenv, s, len, PROT_R);
-    
+    /* Short strings are copied without checking [s, s+len) first,
+     * the slow check only reports the faulting address.
+     * Long ones are checked as a whole, so that
+     * nothing is printed if part of the string is invalid.
+     * Destroy the environment if it is not readable. */
+    char buf[256];
+    if (len <= sizeof(buf)) {
+        if (copyin(buf, s, len) < 0) {
+            user_mem_assert(curenv, s, len, PROT_R);
+            return -E_FAULT;
+        }
+        s = buf;
+    } else {
+        user_mem_assert(curenv, s, len, PROT_R);
+    }
+
     while (len > INT32_MAX) {
         cprintf("%.*s", (int)INT32_MAX, s);
         len -= INT32_MAX;
@@ -41,7 +56,11 @@ static int
 sys_cgetc(uint8_t* is_released) {
     // LAB 8: Your code here DONE
 
-    return cons_getc(is_released);
+    uint8_t released = 0;
+    int c = cons_getc(is_released ? &released : NULL);
+    if (c && is_released && copyout(is_released, &released, sizeof(released)) < 0) return -E_FAULT;
+
+    return c;
 }
 
 /* Returns the current environment's envid. */
@@ -85,6 +104,7 @@ sys_env_destroy(envid_t envid) {
 static void
 sys_yield(void) {
     // LAB 9: Your code here DONE
+    sched_defer(curenv);
     sched_yield();
 }
 
@@ -110,7 +130,9 @@ sys_exofork(void) {
     }
     assert(env);
 
-    env->env_status = ENV_NOT_RUNNABLE;
+    env_set_status(env, ENV_NOT_RUNNABLE);
+    sched_set_nice(env, curenv->env_nice);
+    env->env_image_id = curenv->env_image_id;
     env->env_tf = curenv->env_tf;
     env->env_tf.tf_regs.reg_rax = 0;
 
@@ -148,7 +170,7 @@ sys_env_set_status(envid_t envid, int status) {
         return -E_INVAL;
     }
 
-    env->env_status = status;
+    env_set_status(env, status);
 
     return 0;
 }
@@ -178,6 +200,52 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func) {
     return 0;
 }
 
+/* Register (enable != 0) or unregister envid as owner of
+ * memory caches that should be shrunk on memory pressure.
+ * Registered environment receives reclaim requests
+ * as IPC messages from RECLAIM_ENVID (see inc/env.h).
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid. */
+static int
+sys_env_set_reclaim(envid_t envid, int enable) {
+    struct Env *env = NULL;
+
+    int res = envid2env(envid, &env, true);
+    if (res < 0) return res;
+
+    env->env_reclaim = !!enable;
+    if (!enable) env->env_reclaim_pending = 0;
+
+    return 0;
+}
+
+/* Set nice level of envid to nice, environments with lower nice
+ * levels get proportionally more CPU time (each level is ~25%).
+ * Only server environments may lower nice levels,
+ * others can only give their CPU share away.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid,
+ *      or nice is lower than the current level of envid
+ *      and the caller is not a server environment.
+ *  -E_INVAL if nice is out of [NICE_MIN, NICE_MAX] range. */
+static int
+sys_env_set_nice(envid_t envid, int nice) {
+    struct Env *env = NULL;
+
+    int res = envid2env(envid, &env, true);
+    if (res < 0) return res;
+
+    if (nice < NICE_MIN || nice > NICE_MAX) return -E_INVAL;
+    if (nice < env->env_nice && curenv->env_type != ENV_TYPE_FS) return -E_BAD_ENV;
+
+    sched_set_nice(env, nice);
+    return 0;
+}
+
 /* Allocate a region of memory and map it at 'va' with permission
  * 'perm' in the address space of 'envid'.
  * The page's contents are set to 0.
@@ -317,7 +385,9 @@ sys_map_region(envid_t srcenvid, uintptr_t srcva,
  * Return 0 on success, < 0 on error.  Errors are:
  *  -E_BAD_ENV if environment envid doesn't currently exist,
  *      or the caller doesn't have permission to change envid.
- *  -E_INVAL if va >= MAX_USER_ADDRESS, or va is not page-aligned. */
+ *  -E_INVAL if va >= MAX_USER_ADDRESS, or va is not page-aligned.
+ *  -E_NO_MEM if a page table shared with another environment
+ *      could not be copied (the region may be partially unmapped). */
 static int
 sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
     /* Hint: This function is a wrapper around unmap_region(). */
@@ -337,11 +407,202 @@ sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
         return -E_INVAL;
     }
 
-    unmap_region(&env->address_space, va, size);
+    return unmap_region(&env->address_space, va, size);
+}
+
+/* Check that region of env at srcva of size bytes
+ * can be sent via IPC with permissions perm */
+static int
+ipc_check_region(struct Env *env, uintptr_t srcva, size_t size, int perm) {
+    if (srcva & CLASS_MASK(0))
+        return -E_INVAL;
+
+    if (size & CLASS_MASK(0))
+        return -E_INVAL;
+
+    if (user_mem_check(env, (void *)srcva, size, PROT_R | PROT_USER_) < 0)
+        return -E_INVAL;
+
+    if ((perm & PROT_W) && user_mem_check(env, (void *)srcva, size, PROT_W | PROT_USER_) < 0)
+        return -E_INVAL;
+
+    return 0;
+}
+
+/* Check receive region arguments, see sys_ipc_recv() */
+static int
+ipc_check_recv(uintptr_t dstva, size_t maxsize) {
+    if (dstva < MAX_USER_ADDRESS) {
+        if (dstva & CLASS_MASK(0))
+            return -E_INVAL;
+
+        if (!maxsize)
+            return -E_INVAL;
+
+        if (maxsize & CLASS_MASK(0))
+            return -E_INVAL;
+    }
+
+    return 0;
+}
+
+/* Whether env 'to' is blocked receiving and accepts messages from 'from' */
+static bool
+ipc_accepts(struct Env *to, struct Env *from) {
+    return to->env_ipc_recving &&
+           (!to->env_ipc_recv_from || to->env_ipc_recv_from == from->env_id);
+}
+
+/* Pass a message from env 'from' to env 'to', which is
+ * blocked in sys_ipc_recv().  Short message words
+ * are cleared if words is NULL.  Status of 'to' is not changed */
+static int
+ipc_deliver(struct Env *from, struct Env *to, uint32_t value, uintptr_t srcva, size_t size, int perm,
+            const uint64_t *words) {
+    assert(ipc_accepts(to, from));
+
+    if (srcva < MAX_USER_ADDRESS && size) {
+        int res = ipc_check_region(from, srcva, size, perm);
+        if (res < 0)
+            return res;
+
+        size = MIN(size, to->env_ipc_maxsz);
+
+        res = map_region(&to->address_space, to->env_ipc_dstva, &from->address_space, srcva, size, perm | PROT_SHARE | PROT_USER_);
+        if (res < 0)
+            return res;
+
+        to->env_ipc_perm = perm;
+    } else {
+        to->env_ipc_perm = 0;
+        size = 0;
+    }
+
+    if (words)
+        memcpy(to->env_ipc_words, words, sizeof(to->env_ipc_words));
+    else
+        memset(to->env_ipc_words, 0, sizeof(to->env_ipc_words));
+
+    to->env_ipc_from = from->env_id;
+    to->env_ipc_maxsz = size;
+    to->env_ipc_recving = false;
+    to->env_ipc_recv_from = 0;
+    to->env_ipc_value = value;
+
+    return 0;
+}
+
+static int ipc_receive(struct Env *env, envid_t from, uintptr_t dstva, size_t maxsize);
+
+/* Deliver message of sender blocked in one of the sending system calls
+ * to env 'to', and wake the sender up unless it has to receive next and
+ * there is nothing to receive yet.  If the message cannot be delivered
+ * and 'to' waits for this sender only (a reply to ipc_call()),
+ * 'to' stops receiving, the caller has to return the error to it */
+static int
+ipc_deliver_blocked(struct Env *sender, struct Env *to) {
+    int res = ipc_deliver(sender, to, sender->env_ipc_send_value, sender->env_ipc_send_srcva,
+                          sender->env_ipc_send_size, sender->env_ipc_send_perm, sender->env_ipc_send_words);
+    int ret = res;
+
+    if (res < 0 && to->env_ipc_recv_from == sender->env_id) {
+        to->env_ipc_recving = false;
+        to->env_ipc_recv_from = 0;
+    }
+
+    sender->env_ipc_send_next = NULL;
+    sender->env_ipc_sending = false;
+    if (sender->env_ipc_send_recv) {
+        sender->env_ipc_send_recv = false;
+        if (!res) {
+            ret = ipc_receive(sender, sender->env_ipc_recv_from,
+                              sender->env_ipc_dstva, sender->env_ipc_maxsz);
+            if (!ret) return 0;
+            ret = MIN(ret, 0);
+        }
+    }
+
+    env_set_status(sender, ENV_RUNNABLE);
+    sender->env_tf.tf_regs.reg_rax = ret;
+    return res;
+}
+
+/* Make env receive a message from envid 'from' (any if 0) at dstva.
+ * Messages of senders blocked on env are taken right away
+ * (oldest first), otherwise env is left waiting for one.
+ * Returns 1 if a message was received, 0 if env waits for one
+ * and an error if the message of the only sender env waits for
+ * cannot be delivered */
+static int
+ipc_receive(struct Env *env, envid_t from, uintptr_t dstva, size_t maxsize) {
+    /* Memory reclaim requests are delivered without blocking */
+    if (!from && env->env_reclaim_pending) {
+        env_deliver_reclaim(env);
+        return 1;
+    }
+
+    env->env_ipc_dstva     = dstva;
+    env->env_ipc_maxsz     = maxsize;
+    env->env_ipc_recving   = true;
+    env->env_ipc_recv_from = from;
+    env->env_ipc_value     = 0;
+
+    /* Senders whose messages cannot be delivered get the error */
+    struct Env **link = &env->env_ipc_senders;
+    while (*link) {
+        struct Env *sender = *link;
+        if (from && sender->env_id != from) {
+            link = &sender->env_ipc_send_next;
+            continue;
+        }
+
+        *link = sender->env_ipc_send_next;
+        int res = ipc_deliver_blocked(sender, env);
+        if (!res) return 1;
+        if (from) return res;
+    }
 
     return 0;
 }
 
+/* Receive a message into curenv like ipc_receive() does, sleeping if
+ * there is none.  The CPU is given to 'next' if it is runnable then,
+ * the system call returns 0 once a message arrives. */
+static int
+ipc_wait(envid_t from, uintptr_t dstva, size_t maxsize, struct Env *next) {
+    int res = ipc_receive(curenv, from, dstva, maxsize);
+    if (res) return MIN(res, 0);
+
+    env_set_status(curenv, ENV_NOT_RUNNABLE);
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    if (next && next->env_status == ENV_RUNNABLE) env_run(next);
+    sched_yield();
+}
+
+/* Put curenv into the queue of senders of env */
+static _Noreturn void
+ipc_block_sender(struct Env *env, uint32_t value, uintptr_t srcva, size_t size, int perm,
+                 const uint64_t *words) {
+    curenv->env_ipc_sending = true;
+    curenv->env_ipc_send_to = env->env_id;
+    curenv->env_ipc_send_value = value;
+    curenv->env_ipc_send_srcva = srcva;
+    curenv->env_ipc_send_size = size;
+    curenv->env_ipc_send_perm = perm;
+    curenv->env_ipc_send_next = NULL;
+    if (words)
+        memcpy(curenv->env_ipc_send_words, words, sizeof(curenv->env_ipc_send_words));
+    else
+        memset(curenv->env_ipc_send_words, 0, sizeof(curenv->env_ipc_send_words));
+
+    struct Env **link = &env->env_ipc_senders;
+    while (*link) link = &(*link)->env_ipc_send_next;
+    *link = curenv;
+
+    env_set_status(curenv, ENV_NOT_RUNNABLE);
+    sched_yield();
+}
+
 /* Try to send 'value' to the target env 'envid'.
  * If srcva < MAX_USER_ADDRESS, then also send region currently mapped at 'srcva',
  * so receiver also gets mapping.
@@ -395,49 +656,53 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
     }
     assert(env);
 
-    if (!env->env_ipc_recving)
+    if (!ipc_accepts(env, curenv))
         return -E_IPC_NOT_RECV;
-    
-    if (srcva < MAX_USER_ADDRESS && size) {
-        if (srcva & CLASS_MASK(0))
-            return -E_INVAL;
-    
-        // if (!size)
-        //     return -E_INVAL;
 
-        if (size & CLASS_MASK(0))
-            return -E_INVAL;
-        
-        res = user_mem_check(curenv, (void *)srcva, size, PROT_R | PROT_USER_);
-        if (res < 0)
-            return -E_INVAL;
+    res = ipc_deliver(curenv, env, value, srcva, size, perm, NULL);
+    if (res < 0)
+        return res;
 
-        if (perm & PROT_W) {
-            res = user_mem_check(curenv, (void *)srcva, size, PROT_W | PROT_USER_);
-            if (res < 0)
-                return -E_INVAL;
-        }
-        
-        size = MIN(size, env->env_ipc_maxsz);
+    env_set_status(env, ENV_RUNNABLE);
+    env->env_tf.tf_regs.reg_rax = 0;
+    return 0;
+}
 
-        res = map_region(&env->address_space, env->env_ipc_dstva, &curenv->address_space, srcva, size, perm | PROT_SHARE | PROT_USER_);
-        if (res < 0)
-            return res;
-        
-        env->env_ipc_perm = perm;
-    } else {
-        env->env_ipc_perm = 0;
-        size = 0;
+/* Like sys_ipc_try_send(), but if envid is not receiving yet
+ * the caller sleeps in its queue of senders until
+ * envid calls sys_ipc_recv() or exits.
+ * If envid is already receiving, it is run immediately,
+ * using the rest of the caller's time slice.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are the same
+ * as the ones of sys_ipc_try_send() except -E_IPC_NOT_RECV, and
+ *  -E_BAD_ENV if envid exits before receiving the message.
+ *  -E_INVAL if envid is the current environment. */
+static int
+sys_ipc_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm) {
+    struct Env *env = NULL;
+
+    int res = envid2env(envid, &env, false);
+    if (res < 0) return res;
+    if (env == curenv) return -E_INVAL;
+
+    if (ipc_accepts(env, curenv)) {
+        res = ipc_deliver(curenv, env, value, srcva, size, perm, NULL);
+        if (res < 0) return res;
+
+        env_set_status(env, ENV_RUNNABLE);
+        env->env_tf.tf_regs.reg_rax = 0;
+        curenv->env_tf.tf_regs.reg_rax = 0;
+        env_run(env);
     }
 
-    env->env_ipc_from = curenv->env_id;
-    env->env_ipc_maxsz = size;
-    env->env_ipc_recving = false;
-    env->env_ipc_value = value;
+    /* Report bad arguments now rather than on delivery */
+    if (srcva < MAX_USER_ADDRESS && size) {
+        res = ipc_check_region(curenv, srcva, size, perm);
+        if (res < 0) return res;
+    }
 
-    env->env_status = ENV_RUNNABLE;
-    env->env_tf.tf_regs.reg_rax = 0;
-    return 0;
+    ipc_block_sender(env, value, srcva, size, perm, NULL);
 }
 
 /* Block until a value is ready.  Record that you want to receive
@@ -457,26 +722,134 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
 static int
 sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
     // LAB 9: Your code here DONE
-    if (dstva < MAX_USER_ADDRESS) {
-        if (dstva & CLASS_MASK(0))
-            return -E_INVAL;
-        
-        if (!maxsize)
-            return -E_INVAL;
+    int res = ipc_check_recv(dstva, maxsize);
+    if (res < 0)
+        return res;
 
-        if (maxsize & CLASS_MASK(0))
-            return -E_INVAL;
+    return ipc_wait(0, dstva, maxsize, NULL);
+}
+
+/* Send a request to envid and wait for the reply from it (and only
+ * from it) in one system call.  Sending works like sys_ipc_send(),
+ * dstva and maxsize describe the reply region like in sys_ipc_recv().
+ * A receiving envid is run immediately.
+ *
+ * Returns 0 once the reply is received, < 0 on error.  Errors are
+ * the ones of sys_ipc_send() and sys_ipc_recv(), and
+ *  -E_BAD_ENV if envid exits before replying,
+ *  -E_INVAL or -E_NO_MEM if the reply region cannot be mapped. */
+static int
+ipc_call(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm,
+         const uint64_t *words, uintptr_t dstva, size_t maxsize) {
+    struct Env *env = NULL;
+
+    int res = ipc_check_recv(dstva, maxsize);
+    if (res < 0) return res;
+    res = envid2env(envid, &env, false);
+    if (res < 0) return res;
+    if (env == curenv) return -E_INVAL;
+
+    if (ipc_accepts(env, curenv)) {
+        res = ipc_deliver(curenv, env, value, srcva, size, perm, words);
+        if (res < 0) return res;
+
+        env_set_status(env, ENV_RUNNABLE);
+        env->env_tf.tf_regs.reg_rax = 0;
+        return ipc_wait(env->env_id, dstva, maxsize, env);
     }
 
-    curenv->env_ipc_dstva   = dstva;
-    curenv->env_ipc_maxsz   = maxsize;
-    curenv->env_ipc_recving = true;
-    curenv->env_ipc_value   = 0;
+    if (srcva < MAX_USER_ADDRESS && size) {
+        res = ipc_check_region(curenv, srcva, size, perm);
+        if (res < 0) return res;
+    }
 
-    curenv->env_status = ENV_NOT_RUNNABLE;
-    sched_yield();
+    /* Wait for the reply once the request is received */
+    curenv->env_ipc_send_recv = true;
+    curenv->env_ipc_recv_from = env->env_id;
+    curenv->env_ipc_dstva = dstva;
+    curenv->env_ipc_maxsz = maxsize;
 
-    panic("Shouldn't be reachable");
+    ipc_block_sender(env, value, srcva, size, perm, words);
+}
+
+static int
+sys_ipc_call(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm,
+             uintptr_t dstva, size_t maxsize) {
+    return ipc_call(envid, value, srcva, size, perm, NULL, dstva, maxsize);
+}
+
+/* Short message variant of sys_ipc_call(): instead of a region
+ * the request carries IPC_NWORDS words passed in registers,
+ * which the receiver finds in its env_ipc_words.
+ * The reply carries no region either. */
+static int
+sys_ipc_call_short(envid_t envid, uint32_t value, uint64_t w0, uint64_t w1,
+                   uint64_t w2, uint64_t w3, uint64_t w4) {
+    const uint64_t words[IPC_NWORDS] = {w0, w1, w2, w3, w4};
+    static_assert(IPC_NWORDS == 5, "Words are passed in the remaining syscall arguments");
+
+    return ipc_call(envid, value, MAX_USER_ADDRESS, 0, 0, words, MAX_USER_ADDRESS, 0);
+}
+
+/* Reply to envid (if it is not 0) and wait for the next message from
+ * anyone in one system call.  If envid is not receiving yet,
+ * the caller sleeps until it is, like in sys_ipc_send().
+ * Replies to environments that have exited are dropped, a reply
+ * that cannot be delivered otherwise wakes envid with the error.
+ * Region mapped by the previously received message
+ * is unmapped unless it is the one replied with.
+ * Receiving works like sys_ipc_recv(), the CPU is given
+ * to envid if there are no pending messages.
+ *
+ * Returns 0 once a message is received, < 0 on error.  Errors are
+ * the ones of sys_ipc_recv(), and, if the caller had to wait for envid
+ * to receive the reply (nothing is received then),
+ *  -E_BAD_ENV if envid exits meanwhile,
+ *  -E_INVAL or -E_NO_MEM if the reply cannot be delivered. */
+static int
+sys_ipc_reply_wait(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm,
+                   uintptr_t dstva, size_t maxsize) {
+    struct Env *env = NULL;
+
+    int res = ipc_check_recv(dstva, maxsize);
+    if (res < 0) return res;
+
+    /* Replies to exited environments are dropped */
+    if (envid && (envid2env(envid, &env, false) < 0 || env == curenv))
+        env = NULL;
+
+    bool reply_mapped = env && srcva < MAX_USER_ADDRESS && size &&
+                        !ipc_check_region(curenv, srcva, size, perm);
+
+    /* Short messages map nothing, so there is nothing to unmap */
+    uintptr_t prev = curenv->env_ipc_dstva;
+    size_t prev_size = curenv->env_ipc_maxsz;
+    if (prev < MAX_USER_ADDRESS && prev_size &&
+        !user_mem_check(curenv, (void *)prev, prev_size, PROT_USER_) &&
+        !(reply_mapped && srcva < prev + prev_size && prev < srcva + size))
+        unmap_region(&curenv->address_space, prev, prev_size);
+
+    if (env && !ipc_accepts(env, curenv)) {
+        curenv->env_ipc_send_recv = true;
+        curenv->env_ipc_recv_from = 0;
+        curenv->env_ipc_dstva = dstva;
+        curenv->env_ipc_maxsz = maxsize;
+        ipc_block_sender(env, value, srcva, size, perm, NULL);
+    }
+
+    /* A reply that cannot be delivered wakes the caller
+     * with the error instead of leaving it blocked */
+    if (env) {
+        res = ipc_deliver(curenv, env, value, srcva, size, perm, NULL);
+        if (res < 0) {
+            env->env_ipc_recving = false;
+            env->env_ipc_recv_from = 0;
+        }
+        env_set_status(env, ENV_RUNNABLE);
+        env->env_tf.tf_regs.reg_rax = res;
+    }
+
+    return ipc_wait(0, dstva, maxsize, env);
 }
 
 /*
@@ -484,7 +857,7 @@ sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
  * so you need:
  *   -Check environment id to be valid and accessible
  *   -Check argument to be valid memory
- *   -Use nosan_memcpy to copy from usespace
+ *   -Use copyin to copy from usespace
  *   -Prevent privilege escalation by overriding segments
  *   -Only allow program to set safe flags in RFLAGS register
  *   -Force IF to be set in RFLAGS
@@ -502,14 +875,12 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
     }
     assert(env);
 
-    res = user_mem_check(env, tf, sizeof(*tf), PROT_R | PROT_USER_);
+    struct Trapframe kern_tf = {};
+    res = copyin(&kern_tf, tf, sizeof(*tf));
     if (res < 0) {
         return res;
     }
 
-    struct Trapframe kern_tf = {};
-    nosan_memcpy(&kern_tf, tf, sizeof(*tf));
-
     kern_tf.tf_ds = GD_UD | 3;
     kern_tf.tf_es = GD_UD | 3;
     kern_tf.tf_ss = GD_UD | 3;
@@ -525,6 +896,122 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
     return 0;
 }
 
+/* Check that [addr, addr + size) is page aligned user memory range */
+static bool
+user_range_ok(uintptr_t addr, size_t size) {
+    return !(addr & CLASS_MASK(0)) && !(size & CLASS_MASK(0)) &&
+           addr + size >= addr && addr + size <= MAX_USER_ADDRESS;
+}
+
+/* Move region of current environment to env lazily */
+static int
+spawn_move_region(struct Env *env, uintptr_t dst, uintptr_t src, size_t size, int prot) {
+    if (!user_range_ok(src, size) || !user_range_ok(dst, size) ||
+        prot & ~PROT_ALL || prot & PROT_SHARE) return -E_INVAL;
+    if (!size) return 0;
+
+    /* Lazy mapping avoids copying pages which are
+     * freed from the caller right after that */
+    int res = map_region(&env->address_space, dst, &curenv->address_space, src,
+                         size, prot | PROT_LAZY | PROT_USER_);
+    if (res < 0) return res;
+
+    return unmap_region(&curenv->address_space, src, size);
+}
+
+/* Check whether [start, start + size) overlaps destination of any segment */
+static bool
+spawn_segments_overlap(const struct SpawnSegment *segs, size_t nsegs, uintptr_t start, size_t size) {
+    for (size_t i = 0; i < nsegs; i++) {
+        if (start < segs[i].dst + segs[i].size && segs[i].dst < start + size) return 1;
+    }
+    return 0;
+}
+
+/* Create new environment running program image described by
+ * img (see inc/spawn.h) in one call instead of exofork,
+ * one map_region call per segment, stack setup, shared
+ * regions copying, trapframe and status setup.
+ *
+ * Returns envid of new environment on success, < 0 on error.
+ * Errors are:
+ *  -E_INVAL if img is not readable or describes invalid regions.
+ *  -E_NOT_FOUND if img has no segments and its key is not cached
+ *      by the caller or one of its ancestors.
+ *  -E_NO_FREE_ENV if no free environment is available.
+ *  -E_NO_MEM on memory exhaustion. */
+static int
+sys_spawn(const struct SpawnImage *img) {
+    struct SpawnImage kimg;
+    int res = copyin(&kimg, img, sizeof(kimg));
+    if (res < 0) return -E_INVAL;
+
+    if (kimg.nsegments > SPAWN_MAX_SEGMENTS || kimg.nshared > SPAWN_MAX_SHARED) return -E_INVAL;
+
+    struct SpawnSegment segs[SPAWN_MAX_SEGMENTS];
+    if (kimg.nsegments) {
+        res = copyin(segs, kimg.segments, kimg.nsegments * sizeof(*segs));
+        if (res < 0) return -E_INVAL;
+    }
+
+    if (!kimg.nsegments && !kimg.key.size) return -E_INVAL;
+
+    /* Segments are checked before anything is built or cached */
+    for (size_t i = 0; i < kimg.nsegments; i++) {
+        if (!user_range_ok(segs[i].src, segs[i].size) || !user_range_ok(segs[i].dst, segs[i].size) ||
+            segs[i].prot & ~PROT_ALL || segs[i].prot & PROT_SHARE) return -E_INVAL;
+    }
+
+    struct Env *env = NULL;
+    res = env_alloc(&env, curenv->env_id, curenv->env_type);
+    if (res < 0) return res;
+    env_set_status(env, ENV_NOT_RUNNABLE);
+
+    if (!kimg.nsegments) {
+        res = image_cache_map(env, &kimg.key, &kimg.entry);
+        if (res < 0) goto error;
+    }
+
+    for (size_t i = 0; i < kimg.nsegments; i++) {
+        res = spawn_move_region(env, segs[i].dst, segs[i].src, segs[i].size, segs[i].prot);
+        if (res < 0) goto error;
+    }
+
+    res = spawn_move_region(env, USER_STACK_TOP - USER_STACK_SIZE, kimg.stack, USER_STACK_SIZE, PROT_R | PROT_W);
+    if (res < 0) goto error;
+
+    /* Stack and shared pages replacing parts of segments must not be cached */
+    bool cacheable = kimg.nsegments &&
+                     !spawn_segments_overlap(segs, kimg.nsegments, USER_STACK_TOP - USER_STACK_SIZE, USER_STACK_SIZE);
+    for (size_t i = 0; i < kimg.nshared; i++) {
+        struct SpawnRegion reg;
+        if (copyin(&reg, kimg.shared + i, sizeof(reg)) < 0 ||
+            !user_range_ok(reg.start, reg.size) || reg.prot & ~PROT_ALL) {
+            res = -E_INVAL;
+            goto error;
+        }
+        if (!reg.size) continue;
+        if (spawn_segments_overlap(segs, kimg.nsegments, reg.start, reg.size)) cacheable = 0;
+
+        res = map_region(&env->address_space, reg.start, &curenv->address_space,
+                         reg.start, reg.size, reg.prot | PROT_USER_);
+        if (res < 0) goto error;
+    }
+
+    /* Only images of completely built environments are cached */
+    if (cacheable) image_cache_insert(env, &kimg.key, kimg.entry, segs, kimg.nsegments);
+
+    env->env_tf.tf_rip = kimg.entry;
+    env->env_tf.tf_rsp = kimg.rsp;
+    env_set_status(env, ENV_RUNNABLE);
+
+    return env->env_id;
+
+error:
+    env_free(env);
+    return res;
+}
+
 /* Return date and time in UNIX timestamp format: seconds passed
  * from 1970-01-01 00:00:00 UTC. */
 static int
@@ -560,11 +1047,6 @@ static int
 sys_virtiogpu_init(uint32_t **user_fb) {
     int res = 0;
 
-    res = user_mem_check(curenv, user_fb, sizeof(uint32_t), PROT_R | PROT_W | PROT_USER_);
-    if (res < 0) {
-        return res;
-    }
-
     struct AddressSpace *old_space = switch_address_space(&kspace);
     virtio_gpu_init();
     switch_address_space(old_space);
@@ -572,14 +1054,18 @@ sys_virtiogpu_init(uint32_t **user_fb) {
 
     assert(&curenv->address_space != &kspace);
 
+    /* The frame is ordinary RAM which is also mapped write-back
+     * by the kernel, so it must not be mapped write-combining here
+     * (mismatched memory types of aliases are undefined).
+     * The device copies it on flush, so WC would not help anyway,
+     * it only pays off for the GOP framebuffer MMIO */
     res = map_region(&curenv->address_space, (uintptr_t)UVFB, &kspace, (uintptr_t)virtio_gpu_fb, UVFB_SIZE, PROT_R | PROT_W | PROT_USER_);
     if (res < 0) {
         return res;
     }
 
-    *user_fb = (uint32_t *)UVFB;
-
-    return 0;
+    uint32_t *fb = (uint32_t *)UVFB;
+    return copyout(user_fb, &fb, sizeof(fb));
 }
 
 static int
@@ -596,7 +1082,7 @@ sys_virtiogpu_flush() {
 
 /* Dispatches to the correct kernel function, passing the arguments. */
 uintptr_t
-syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6, uintptr_t a7) {
     /* Call the function corresponding to the 'syscallno' parameter.
      * Return any appropriate return value. */
 
@@ -644,6 +1130,18 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
     case SYS_ipc_try_send:
         return sys_ipc_try_send((envid_t)a1, (uint32_t)a2, (uintptr_t)a3, (size_t)a4, (int)a5);
 
+    case SYS_ipc_send:
+        return sys_ipc_send((envid_t)a1, (uint32_t)a2, (uintptr_t)a3, (size_t)a4, (int)a5);
+
+    case SYS_ipc_call:
+        return sys_ipc_call((envid_t)a1, (uint32_t)a2, (uintptr_t)a3, (size_t)a4, (int)a5, (uintptr_t)a6, (size_t)a7);
+
+    case SYS_ipc_call_short:
+        return sys_ipc_call_short((envid_t)a1, (uint32_t)a2, a3, a4, a5, a6, a7);
+
+    case SYS_ipc_reply_wait:
+        return sys_ipc_reply_wait((envid_t)a1, (uint32_t)a2, (uintptr_t)a3, (size_t)a4, (int)a5, (uintptr_t)a6, (size_t)a7);
+
     case SYS_env_set_trapframe:
         return sys_env_set_trapframe((envid_t)a1, (struct Trapframe *)a2);
 
@@ -656,6 +1154,15 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
     case SYS_virtiogpu_flush:
         return sys_virtiogpu_flush();
 
+    case SYS_spawn:
+        return sys_spawn((const struct SpawnImage *)a1);
+
+    case SYS_env_set_reclaim:
+        return sys_env_set_reclaim((envid_t)a1, (int)a2);
+
+    case SYS_env_set_nice:
+        return sys_env_set_nice((envid_t)a1, (int)a2);
+
     case SYS_yield:
         sys_yield();
         panic("Shouldn't be reachable");
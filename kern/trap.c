@@ -16,6 +16,7 @@
 #include <kern/timer.h>
 #include <kern/vsyscall.h>
 #include <kern/traceopt.h>
+#include <kern/usercopy.h>
 #include <kern/virtio.h>
 
 static struct Taskstate ts;
@@ -294,7 +295,8 @@ trap_dispatch(struct Trapframe *tf) {
                 tf->tf_regs.reg_rbx,
                 tf->tf_regs.reg_rdi,
                 tf->tf_regs.reg_rsi,
-                tf->tf_regs.reg_r8);
+                tf->tf_regs.reg_r8,
+                tf->tf_regs.reg_r9);
         return;
     case T_PGFLT:
         /* Handle processor exceptions. */
@@ -328,6 +330,7 @@ trap_dispatch(struct Trapframe *tf) {
         // LAB 5: Your code here DONE
         // LAB 4: Your code here DONE
         timer_for_schedule->handle_interrupts();
+        sched_background_work();
         sched_yield();
         
         return;
@@ -403,7 +406,7 @@ trap(struct Trapframe *tf) {
          * which can happen with curenv == NULL */
 
         /* Read processor's CR2 register to find the faulting address */
-        int res = force_alloc_page(current_space, va, MAX_ALLOCATION_CLASS);
+        int res = fault_alloc_page(current_space, va);
         if (trace_pagefaults) {
             bool can_redir = tf->tf_err & FEC_U && curenv && curenv->env_pgfault_upcall;
             cprintf("<%p> Page fault ip=%08lX va=%08lX err=%c%c%c%c%c -> %s\n", current_space, tf->tf_rip, va,
@@ -418,6 +421,14 @@ trap(struct Trapframe *tf) {
             in_page_fault = 0;
             env_pop_tf(tf);
         }
+
+        /* Faulting user memory accessor (see kern/usercopy.c) */
+        uintptr_t fixup;
+        if (!(tf->tf_err & FEC_U) && (fixup = exception_fixup(tf->tf_rip))) {
+            tf->tf_rip = fixup;
+            in_page_fault = 0;
+            env_pop_tf(tf);
+        }
     }
 
     assert(curenv);
@@ -0,0 +1,71 @@
+/* Copying between kernel and user memory
+ *
+ * Instead of checking user memory with user_mem_check()
+ * before accessing it, which walks the virtual tree,
+ * memory is just accessed and page faults are recovered
+ * from using the exception table. Lazily allocated and copied
+ * pages are resolved by the page fault handler as usual. */
+
+#include <inc/error.h>
+#include <inc/memlayout.h>
+#include <kern/usercopy.h>
+
+struct ExceptionTableEntry {
+    uintptr_t insn;  /* Address of instruction that may fault */
+    uintptr_t fixup; /* Address to continue from */
+};
+
+/* Defined in kernel.ld */
+extern const struct ExceptionTableEntry __ex_table_start[], __ex_table_end[];
+
+/* usercopyasm.S */
+int user_memcpy(void *dst, const void *src, size_t size);
+ssize_t user_strncpy(char *dst, const char *src, size_t size);
+
+/* Kernel memory is accessible to the kernel, so
+ * it needs to be rejected without relying on faults */
+static bool
+user_range_ok(const void *va, size_t size) {
+    uintptr_t addr = (uintptr_t)va;
+    return addr + size >= addr && addr + size <= MAX_USER_ADDRESS;
+}
+
+/* Copy size bytes from user address usrc to dst.
+ * Returns 0 on success, -E_FAULT if usrc is not accessible */
+int
+copyin(void *dst, const void *usrc, size_t size) {
+    if (!user_range_ok(usrc, size)) return -E_FAULT;
+    return user_memcpy(dst, usrc, size) ? -E_FAULT : 0;
+}
+
+/* Copy size bytes from src to user address udst.
+ * Returns 0 on success, -E_FAULT if udst is not writable */
+int
+copyout(void *udst, const void *src, size_t size) {
+    if (!user_range_ok(udst, size)) return -E_FAULT;
+    return user_memcpy(udst, src, size) ? -E_FAULT : 0;
+}
+
+/* Copy NUL-terminated string from user address usrc
+ * to buffer dst of size bytes.
+ * Returns string length on success, -E_FAULT if usrc is not
+ * accessible or -E_INVAL if the string does not fit into dst */
+ssize_t
+copyinstr(char *dst, const char *usrc, size_t size) {
+    if ((uintptr_t)usrc >= MAX_USER_ADDRESS) return -E_FAULT;
+    size_t limit = MIN(size, MAX_USER_ADDRESS - (uintptr_t)usrc);
+
+    ssize_t res = user_strncpy(dst, usrc, limit);
+    if (res < 0) return -E_FAULT;
+    if ((size_t)res == limit) return limit < size ? -E_FAULT : -E_INVAL;
+    return res;
+}
+
+/* Returns address to continue from after page fault
+ * in kernel mode at rip, or 0 if the fault is fatal */
+uintptr_t
+exception_fixup(uintptr_t rip) {
+    for (const struct ExceptionTableEntry *entry = __ex_table_start; entry < __ex_table_end; entry++)
+        if (entry->insn == rip) return entry->fixup;
+    return 0;
+}
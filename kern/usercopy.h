@@ -0,0 +1,17 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_USERCOPY_H
+#define JOS_KERN_USERCOPY_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+int copyin(void *dst, const void *usrc, size_t size);
+int copyout(void *udst, const void *src, size_t size);
+ssize_t copyinstr(char *dst, const char *usrc, size_t size);
+
+uintptr_t exception_fixup(uintptr_t rip);
+
+#endif /* !JOS_KERN_USERCOPY_H */
@@ -5,6 +5,7 @@
 #include <kern/trap.h>
 #include <kern/picirq.h>
 #include <kern/pmap.h>
+#include <kern/kmalloc.h>
 #include <kern/virtio.h>
 
 
@@ -13,14 +14,14 @@
 
 struct virtio_device *virtio_devices = NULL;
 unsigned virtio_num_devices = 0;
+static bool virtio_initialized = false;
 
 
 void
 virtio_init() {
-    assert(virtio_devices == 0);
+    assert(!virtio_initialized);
 
-    kzalloc_region_no_cow = true;
-    virtio_devices = kzalloc_region(sizeof(struct virtio_device) * VIRTIO_MAX_DEVICES);
+    virtio_initialized = true;
     virtio_num_devices = 0;
 
     pic_irq_unmask(IRQ_VIRTIO);
@@ -31,13 +32,22 @@ virtio_init() {
 
 struct virtio_device *
 virtio_create_device() {
-    assert(virtio_devices);
+    assert(virtio_initialized);
 
-    if (virtio_num_devices == VIRTIO_MAX_DEVICES) {
+    struct virtio_device *device = kzalloc(sizeof(*device));
+    if (!device) {
         return NULL;
     }
 
-    return &virtio_devices[virtio_num_devices++];
+    /* Keep devices in creation order */
+    struct virtio_device **pnext = &virtio_devices;
+    while (*pnext) {
+        pnext = &(*pnext)->next;
+    }
+    *pnext = device;
+    device->index = virtio_num_devices++;
+
+    return device;
 }
 
 
@@ -386,12 +396,12 @@ void
 virtio_intr() {
     cprintf("Virtio interrupt hit, that's unexpected\n");
 
-    if (!virtio_devices) {
+    if (!virtio_initialized) {
         panic("Too early, virtio-onii-chan");
     }
 
-    for (unsigned i = 0; i < virtio_num_devices; ++i) {
-        struct virtio_device *device = &virtio_devices[i];
+    for (struct virtio_device *device = virtio_devices; device; device = device->next) {
+        unsigned i = device->index;
 
         uint8_t isr = *device->mmio_isr;
 
@@ -61,7 +61,6 @@
 // VIRTIO_IRQ defined in trap.h
 
 // Arbitrary limits to keep the size small
-#define VIRTIO_MAX_DEVICES 0x8
 #define VIRTIO_MAX_VIRTQS 0x8
 #define VIRTIO_MAX_VQ_SIZE 0x10
 
@@ -200,9 +199,12 @@ struct virtio_device {
 
     // TODO
     void (*on_virtqs_update)(struct virtio_device *device);
+
+    // All devices are kept in a list in creation order
+    struct virtio_device *next;
+    unsigned index;
 };
 
-// TODO: Some way to keep track of all deivces
 extern struct virtio_device *virtio_devices;
 extern unsigned virtio_num_devices;
 
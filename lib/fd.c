@@ -283,6 +283,8 @@ fstat(int fdnum, struct Stat *stat) {
     stat->st_name[0] = 0;
     stat->st_size = 0;
     stat->st_isdir = 0;
+    stat->st_ino = 0;
+    stat->st_version = 0;
     stat->st_dev = dev;
 
     return (*dev->dev_stat)(fd, stat);
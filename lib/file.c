@@ -4,18 +4,23 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PAGE_SIZE)));
 
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+    return fsenv;
+}
+
 /* Send an inter-environment request to the file server, and wait for
  * a reply.  The request body should be in fsipcbuf, and parts of the
  * response may be written back to fsipcbuf.
  * type: request code, passed as the simple integer IPC value.
  * dstva: virtual address at which to receive reply page, 0 if none.
+ * maxsz: maximal size of region received at dstva.
  * Returns result from the file server. */
 static int
-fsipc(unsigned type, void *dstva) {
-    static envid_t fsenv;
-
-    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
-
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
     static_assert(sizeof(fsipcbuf) == PAGE_SIZE, "Invalid fsipcbuf size");
 
     if (debug) {
@@ -23,9 +28,31 @@ fsipc(unsigned type, void *dstva) {
                 thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
     }
 
-    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
-    size_t maxsz = PAGE_SIZE;
-    return ipc_recv(NULL, dstva, &maxsz, NULL);
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+}
+
+static int
+fsipc(unsigned type, void *dstva) {
+    return fsipc_region(type, dstva, PAGE_SIZE);
+}
+
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+    uint64_t words[IPC_NWORDS] = {0};
+
+    assert(size <= sizeof(words));
+    memcpy(words, req, size);
+
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -96,8 +123,8 @@ open(const char *path, int mode) {
  * to disk. */
 static int
 devfile_flush(struct Fd *fd) {
-    fsipcbuf.flush.req_fileid = fd->fd_file.id;
-    return fsipc(FSREQ_FLUSH, NULL);
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
 }
 
 static const bool REPEAT_DEVFILE_RW = true;
@@ -192,6 +219,8 @@ devfile_stat(struct Fd *fd, struct Stat *st) {
     strcpy(st->st_name, fsipcbuf.statRet.ret_name);
     st->st_size = fsipcbuf.statRet.ret_size;
     st->st_isdir = fsipcbuf.statRet.ret_isdir;
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+    st->st_version = fsipcbuf.statRet.ret_version;
 
     return 0;
 }
@@ -199,10 +228,11 @@ devfile_stat(struct Fd *fd, struct Stat *st) {
 /* Truncate or extend an open file to 'size' bytes */
 static int
 devfile_trunc(struct Fd *fd, off_t newsize) {
-    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
-    fsipcbuf.set_size.req_size = newsize;
+    struct Fsreq_set_size req = {
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
 
-    return fsipc(FSREQ_SET_SIZE, NULL);
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
 }
 
 /* Synchronize disk with buffer cache */
@@ -211,5 +241,42 @@ sync(void) {
     /* Ask the file server to update the disk
      * by writing any dirty blocks in the buffer cache. */
 
-    return fsipc(FSREQ_SYNC, NULL);
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+}
+
+/* Map up to 'size' bytes of open file 'fdnum' starting at page aligned
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+    if (res < 0) return res;
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+    fsipcbuf.map.req_offset = offset;
+    fsipcbuf.map.req_n = size;
+    fsipcbuf.map.req_prot = prot;
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+}
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+    if (res < 0) return res;
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+
+    struct Fsreq_msync req = {
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
 }
@@ -2,31 +2,9 @@
 
 #include <inc/lib.h>
 
-/* Receive a value via IPC and return it.
- * If 'pg' is nonnull, then any page sent by the sender will be mapped at
- *    that address.
- * If 'from_env_store' is nonnull, then store the IPC sender's envid in
- *    *from_env_store.
- * If 'perm_store' is nonnull, then store the IPC sender's page permission
- *    in *perm_store (this is nonzero iff a page was successfully
- *    transferred to 'pg').
- * If the system call fails, then store 0 in *fromenv and *perm (if
- *    they're nonnull) and return the error.
- * Otherwise, return the value sent by the sender
- *
- * Hint:
- *   Use 'thisenv' to discover the value and who sent it.
- *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
- *   as meaning "no page".  (Zero is not the right value, since that's
- *   a perfectly valid place to map a page.) */
-int32_t
-ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
-    // LAB 9: Your code here DONE
-    if (!pg) {
-        pg = (void *)MAX_USER_ADDRESS;
-    }
-
-    int res = sys_ipc_recv(pg, size ? *size : 0);
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
     if (res < 0) {
         if (from_env_store) {
             *from_env_store = 0;
@@ -54,13 +32,40 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
     return thisenv->env_ipc_value;
 }
 
-/* Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
- * This function keeps trying until it succeeds.
- * It should panic() on any error other than -E_IPC_NOT_RECV.
+/* Receive a value via IPC and return it.
+ * If 'pg' is nonnull, then any page sent by the sender will be mapped at
+ *    that address.
+ * If 'from_env_store' is nonnull, then store the IPC sender's envid in
+ *    *from_env_store.
+ * If 'perm_store' is nonnull, then store the IPC sender's page permission
+ *    in *perm_store (this is nonzero iff a page was successfully
+ *    transferred to 'pg').
+ * If the system call fails, then store 0 in *fromenv and *perm (if
+ *    they're nonnull) and return the error.
+ * Otherwise, return the value sent by the sender
  *
  * Hint:
- *   Use sys_yield() to be CPU-friendly.
+ *   Use 'thisenv' to discover the value and who sent it.
  *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+    return ipc_result(res, from_env_store, size, perm_store);
+}
+
+/* Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
+ * This function sleeps until 'toenv' receives the message.
+ * It should panic() on any error.
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
  *   as meaning "no page".  (Zero is not the right value.) */
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
@@ -69,13 +74,49 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
         pg = (void *)MAX_USER_ADDRESS;
     }
 
-    int res = 0;
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+    if (res < 0) {
+        panic("ipc_send: %i", res);
+    }
+}
+
+/* Send 'val' (and 'pg' with 'perm', 'size') to 'to_env' like ipc_send()
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
 
-    while ((res = sys_ipc_try_send(to_env, val, pg, size, perm)) < 0) {
-        assert(res == -E_IPC_NOT_RECV);
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+    return ipc_result(res, NULL, rcv_size, perm_store);
+}
 
-        sys_yield();
-    }
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+    int res = sys_ipc_call_short(to_env, val, words);
+    return ipc_result(res, NULL, NULL, NULL);
+}
+
+/* Reply 'val' (and 'pg' with 'perm', 'size') to 'to_env' unless it is 0,
+ * then receive the next message like ipc_recv() in a single system call.
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
 }
 
 /* Find the first environment of the given type.  We'll use this to
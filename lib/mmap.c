@@ -0,0 +1,221 @@
+/* Demand paged file mappings
+ *
+ * Pages of mapped files are not copied: on the first access to a page
+ * the page fault handler asks the file server to map a run of its block
+ * cache pages directly into the region (FSREQ_MAP).
+ *
+ * MAP_SHARED regions share pages with the block cache, so changes
+ * are immediately visible to everybody using the file, they are
+ * written to disk by msync() and munmap().
+ * MAP_PRIVATE regions map block cache pages read-only and copy
+ * a page on the first write to it. */
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+#define MMAP_MAX_REGIONS 32
+/* Maximal number of pages mapped by a single fault */
+#define MMAP_FAULT_PAGES 16
+/* Page used by private copies, not given out by mmap() */
+#define MMAP_SCRATCH (UMMAP_BASE + UMMAP_SIZE - PAGE_SIZE)
+
+struct MmapRegion {
+    uintptr_t start; /* 0 if the slot is free */
+    size_t size;
+    int prot;
+    int flags;
+    int fdnum; /* Private duplicate of the mapped file descriptor */
+    off_t offset;
+};
+
+static struct MmapRegion mmap_regions[MMAP_MAX_REGIONS];
+
+static struct MmapRegion *
+mmap_find(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+    }
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+    bool moved;
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+                moved = 1;
+            }
+        }
+    } while (moved);
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+}
+
+/* Replace shared page at va with its private copy */
+static bool
+mmap_copy_page(uintptr_t va) {
+    void *tmp = (void *)MMAP_SCRATCH;
+
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+    if (res < 0) return 0;
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(tmp, PAGE_SIZE);
+#endif
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+        return mmap_copy_page(va);
+    }
+
+    /* Map ahead, but don't replace private copies */
+    size_t size = PAGE_SIZE;
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+
+/* Map 'len' bytes of open file 'fdnum' starting at page aligned 'offset'.
+ * 'prot' is PROT_R optionally with PROT_W, 'flags' is one of MAP_SHARED
+ * and MAP_PRIVATE.  The region is placed at 'addr' if it is not NULL.
+ * Pages are loaded on the first access to them.
+ * Returns start of the mapping or MAP_FAILED on error. */
+void *
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+    struct Fd *fd, *dupfd;
+
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+    /* Block cache pages are never executable */
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+    int omode = fd->fd_omode & O_ACCMODE;
+    if (omode == O_WRONLY) return MAP_FAILED;
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+
+    len = ROUNDUP(len, PAGE_SIZE);
+    uintptr_t start = (uintptr_t)addr;
+    if (start) {
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+            mmap_place(start, len) != start) return MAP_FAILED;
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+        return MAP_FAILED;
+    }
+
+    struct MmapRegion *reg = NULL;
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+    if (!reg) return MAP_FAILED;
+
+    /* Mapping stays valid after fdnum is closed */
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+    int dupnum = dup(fdnum, fd2num(dupfd));
+    if (dupnum < 0) return MAP_FAILED;
+
+    add_pgfault_handler(mmap_pgfault);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison((void *)start, len);
+#endif
+
+    *reg = (struct MmapRegion){
+            .start = start,
+            .size = len,
+            .prot = prot,
+            .flags = flags,
+            .fdnum = dupnum,
+            .offset = offset};
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+
+    for (uintptr_t va = start; va < end;) {
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+            va += PAGE_SIZE;
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+        if (res < 0) return res;
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+    }
+
+    return 0;
+}
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+        if (res < 0) return res;
+    }
+
+    return 0;
+}
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+    }
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+        if (res < 0) return res;
+
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
@@ -1,92 +1,97 @@
 #include <inc/lib.h>
 #include <inc/elf.h>
 
-#define UTEMP2USTACK(addr) ((void *)(addr) + (USER_STACK_TOP - USER_STACK_SIZE) - UTEMP)
+/* Address in the child of stack byte at addr staged at stack */
+#define STAGE2USTACK(addr, stack) ((uintptr_t)(addr) - (uintptr_t)(stack) + (USER_STACK_TOP - USER_STACK_SIZE))
 
 /* Helper functions for spawn. */
-static int init_stack(envid_t child, const char **argv, struct Trapframe *tf);
-static int map_segment(envid_t child, uintptr_t va, size_t memsz,
-                       int fd, size_t filesz, off_t fileoffset, int perm);
-static int copy_shared_region(void *start, void *end, void *arg);
+static int init_stack(void *stack, const char **argv, uintptr_t *rsp);
+static int load_segments(int fd, struct SpawnImage *img, struct SpawnSegment *segs, size_t *staged);
+static int collect_shared_region(void *start, void *end, void *arg);
+
+struct SharedList {
+    struct SpawnRegion regions[SPAWN_MAX_SHARED];
+    size_t count;
+};
 
 /* Spawn a child process from a program image loaded from the file system.
  * prog: the pathname of the program to run.
  * argv: pointer to null-terminated array of pointers to strings,
  *   which will be passed to the child as its command-line arguments.
- * Returns child envid on success, < 0 on failure. */
+ * Returns child envid on success, < 0 on failure.
+ *
+ * Initial stack and program segments are prepared at USPAWN_STAGING
+ * and the child is created from them by a single sys_spawn() call,
+ * which moves them to the child and maps shared regions.
+ * Kernel caches program images by file identity, so segments
+ * are only read from the file if the image is not cached. */
 int
 spawn(const char *prog, const char **argv) {
-    unsigned char elf_buf[512];
+    struct SpawnSegment segs[SPAWN_MAX_SEGMENTS];
+    static struct SharedList shared;
+    struct Stat st;
     int res;
 
-    /* This code follows this procedure:
-     *
-     *   - Open the program file.
-     *
-     *   - Read the ELF header, as you have before, and sanity check its
-     *     magic number.  (Check out your load_icode!)
-     *
-     *   - Use sys_exofork() to create a new environment.
-     *
-     *   - Set child_tf to an initial struct Trapframe for the child.
-     *
-     *   - Call the init_stack() function above to set up
-     *     the initial stack page for the child environment.
-     *
-     *   - Map all of the program's segments that are of p_type
-     *     ELF_PROG_LOAD into the new environment's address space.
-     *     Use the p_flags field in the Proghdr for each segment
-     *     to determine how to map the segment:
-     *
-     *    * If the ELF flags do not include ELF_PROG_FLAG_WRITE,
-     *      then the segment contains text and read-only data.
-     *      Use read_map() to read the contents of this segment,
-     *      and map the pages it returns directly into the child
-     *        so that multiple instances of the same program
-     *      will share the same copy of the program text.
-     *        Be sure to map the program text read-only in the child.
-     *        Read_map is like read but returns a pointer to the data in
-     *        *blk rather than copying the data into another buffer.
-     *
-     *    * If the ELF segment flags DO include ELF_PROG_FLAG_WRITE,
-     *      then the segment contains read/write data and bss.
-     *      As with load_icode() in Lab 3, such an ELF segment
-     *      occupies p_memsz bytes in memory, but only the FIRST
-     *      p_filesz bytes of the segment are actually loaded
-     *      from the executable file - you must clear the rest to zero.
-     *        For each page to be mapped for a read/write segment,
-     *        allocate a page in the parent temporarily at UTEMP,
-     *        read() the appropriate portion of the file into that page
-     *      and/or use memset() to zero non-loaded portions.
-     *      (You can avoid calling memset(), if you like, if
-     *      page_alloc() returns zeroed pages already.)
-     *        Then insert the page mapping into the child.
-     *        Look at init_stack() for inspiration.
-     *        Be sure you understand why you can't use read_map() here.
-     *
-     *     Note: None of the segment addresses or lengths above
-     *     are guaranteed to be page-aligned, so you must deal with
-     *     these non-page-aligned values appropriately.
-     *     The ELF linker does, however, guarantee that no two segments
-     *     will overlap on the same page; and it guarantees that
-     *     PGOFF(ph->p_offset) == PGOFF(ph->p_va).
-     *
-     *   - Call sys_env_set_trapframe(child, &child_tf) to set up the
-     *     correct initial eip and esp values in the child.
-     *
-     *   - Start the child process running with sys_env_set_status(). */
-
-    // TODO Properly load ELF and check errors
-
     int fd = open(prog, O_RDONLY);
     if (fd < 0) return fd;
 
+    struct SpawnImage img = {
+            .stack = (uintptr_t)USPAWN_STAGING,
+            .shared = shared.regions};
+
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+
+    size_t staged = USER_STACK_SIZE;
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+    if ((res = init_stack(USPAWN_STAGING, argv, &img.rsp)) < 0) goto error;
+
+    /* Collect shared library state. */
+    shared.count = 0;
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+    img.nshared = shared.count;
+
+    /* Try cached image first */
+    if (img.key.size) {
+        res = sys_spawn(&img);
+        if (res != -E_NOT_FOUND) goto done;
+    }
+
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+
+    /* Staging area is moved to the child on success */
+    res = sys_spawn(&img);
+
+done:
+    if (res < 0) goto error;
+    close(fd);
+    return res;
+
+error:
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+error2:
+    close(fd);
+
+    return res;
+}
+
+/* Read ELF program from fd and place its loadable segments into the
+ * staging area after *staged bytes, filling segs and img.
+ *
+ * Note: None of the segment addresses or lengths are guaranteed
+ * to be page-aligned, but the ELF linker guarantees that
+ * no two segments will overlap on the same page and that
+ * PGOFF(ph->p_offset) == PGOFF(ph->p_va). */
+static int
+load_segments(int fd, struct SpawnImage *img, struct SpawnSegment *segs, size_t *staged) {
+    unsigned char elf_buf[512];
+    int res;
+
     /* Read elf header */
     struct Elf *elf = (struct Elf *)elf_buf;
     res = readn(fd, elf_buf, sizeof(elf_buf));
     if (res != sizeof(elf_buf)) {
         cprintf("Wrong ELF header size or read error: %i\n", res);
-        close(fd);
         return -E_NOT_EXEC;
     }
     if (elf->e_magic != ELF_MAGIC ||
@@ -94,77 +99,55 @@ spawn(const char *prog, const char **argv) {
         elf->e_elf[1] != 1 /* little endian */ ||
         elf->e_elf[2] != 1 /* version 1 */ ||
         elf->e_type != ET_EXEC /* executable */ ||
-        elf->e_machine != 0x3E /* amd64 */) {
+        elf->e_machine != 0x3E /* amd64 */ ||
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
         cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
-        close(fd);
         return -E_NOT_EXEC;
     }
 
-    /* Create new child environment */
-    if ((int)(res = sys_exofork()) < 0) goto error2;
-    envid_t child = res;
-
-    /* Set up trap frame, including initial stack. */
-    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
-    child_tf.tf_rip = elf->e_entry;
-
-    if ((res = init_stack(child, argv, &child_tf)) < 0) goto error;
-
-    cprintf("spawning...\n");
-
-    /* Set up program segments as defined in ELF header. */
+    /* Lay out loadable segments in staging area */
+    size_t nsegs = 0, start = *staged, end = start;
     struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
     for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
-        if (ph->p_type != ELF_PROG_LOAD) continue;
-        int perm = 0;
-
-        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
-        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
-        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
-
-        uint64_t left_to_map = ph->p_memsz;
-        uint64_t filesz = ph->p_filesz;
-        uint64_t mapped = 0;
-
-        while (left_to_map) {
-            uint64_t cur_mapping_size = MIN(left_to_map, UTEXT - (uint64_t)UTEMP);
-            uint64_t cur_file_size = MIN(filesz, cur_mapping_size);
-    
-            if ((res = map_segment(child, ph->p_va + mapped, cur_mapping_size,
-                               fd, cur_file_size, ph->p_offset + mapped, perm)) < 0)
-                goto error;
-
-            filesz -= cur_file_size;
-            
-            mapped += cur_mapping_size;
-            left_to_map -= cur_mapping_size;
-        }
-
-        
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+
+        int prot = 0;
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+        segs[nsegs++] = (struct SpawnSegment){
+                .src = (uintptr_t)USPAWN_STAGING + end,
+                .dst = va,
+                .size = size,
+                .prot = prot};
+        end += size;
     }
 
-    cprintf("done\n");
-
-    close(fd);
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
 
-    /* Copy shared library state. */
-    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
-        panic("copy_shared_region: %i", res);
+    /* Memory after file contents is left zero filled */
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+    *staged = end;
 
-    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
-        panic("sys_env_set_trapframe: %i", res);
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
 
-    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
-        panic("sys_env_set_status: %i", res);
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
 
-    return child;
-
-error:
-    sys_env_destroy(child);
-error2:
-    close(fd);
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+    }
 
-    return res;
+    img->entry = elf->e_entry;
+    img->segments = segs;
+    img->nsegments = nsegs;
+    return 0;
 }
 
 /* Spawn, taking command-line arguments array directly on the stack.
@@ -198,17 +181,18 @@ spawnl(const char *prog, const char *arg0, ...) {
     return spawn(prog, argv);
 }
 
-/* Set up the initial stack page for the new child process with envid 'child'
+/* Set up the initial stack for the new child process in
+ * staging buffer stack of USER_STACK_SIZE bytes
  * using the arguments array pointed to by 'argv',
  * which is a null-terminated array of pointers to null-terminated strings.
  *
- * On success, returns 0 and sets *init_esp
+ * On success, returns 0 and sets *rsp
  * to the initial stack pointer with which the child should start.
  * Returns < 0 on failure. */
 static int
-init_stack(envid_t child, const char **argv, struct Trapframe *tf) {
+init_stack(void *stack, const char **argv, uintptr_t *rsp) {
     size_t string_size;
-    int argc, i, res;
+    int argc, i;
     char *string_store;
     uintptr_t *argv_store;
 
@@ -219,127 +203,57 @@ init_stack(envid_t child, const char **argv, struct Trapframe *tf) {
         string_size += strlen(argv[argc]) + 1;
 
     /* Determine where to place the strings and the argv array.
-     * Set up pointers into the temporary page 'UTEMP'; we'll map a page
-     * there later, then remap that page into the child environment
+     * The buffer is moved into the child environment
      * at (USER_STACK_TOP - USER_STACK_SIZE).
      * strings is the topmost thing on the stack. */
-    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
     /* argv is below that.  There's one argument pointer per argument, plus
      * a null pointer. */
     argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
 
     /* Make sure that argv, strings, and the 2 words that hold 'argc'
-     * and 'argv' themselves will all fit in a single stack page. */
-    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
-
-    /* Allocate the stack pages at UTEMP. */
-    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
-
-    /*    * Initialize 'argv_store[i]' to point to argument string i,
-     *      for all 0 <= i < argc.
-     *      Also, copy the argument strings from 'argv' into the
-     *      newly-allocated stack page.
-     *
-     *    * Set 'argv_store[argc]' to 0 to null-terminate the args array.
-     *
-     *    * Push two more words onto the child's stack below 'args',
-     *      containing the argc and argv parameters to be passed
-     *      to the child's umain() function.
-     *      argv should be below argc on the stack.
-     *      (Again, argv should use an address valid in the child's
-     *      environment.)
-     *
-     *    * Set *init_esp to the initial stack pointer for the child,
-     *      (Again, use an address valid in the child's environment.) */
+     * and 'argv' themselves will all fit in the stack. */
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+
+    /* Copy argument strings and point argv entries
+     * to them using addresses valid in the child */
     for (i = 0; i < argc; i++) {
-        argv_store[i] = UTEMP2USTACK(string_store);
+        argv_store[i] = STAGE2USTACK(string_store, stack);
         strcpy(string_store, argv[i]);
         string_store += strlen(argv[i]) + 1;
     }
     argv_store[argc] = 0;
-    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
 
-    argv_store[-1] = UTEMP2USTACK(argv_store);
+    /* argv should be below argc on the stack */
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
     argv_store[-2] = argc;
 
-
-    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
-
-    /* After completing the stack, map it into the child's address space
-     * and unmap it from ours! */
-    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
-                       USER_STACK_SIZE, PROT_RW) < 0) goto error;
-error:
-    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
-    return res;
-}
-
-static int
-copy_shared_region(void *start, void *end, void *arg) {
-    envid_t child = *(envid_t *)arg;
-    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+    return 0;
 }
 
-
+/* Append shared region to SharedList arg merging adjacent regions */
 static int
-map_segment(envid_t child, uintptr_t va, size_t memsz,
-            int fd, size_t filesz, off_t fileoffset, int perm) {
-
-    //cprintf("map_segment %x+%x\n", va, memsz);
-    
-    /* Fixup unaligned destination */
-    int res = PAGE_OFFSET(va);
-    if (res) {
-        va -= res;
-        memsz += res;
-        filesz += res;
-        fileoffset -= res;
-    }
-
-    // LAB 11: Your code here DONE
-
-    if (filesz > memsz) {
-        return -E_INVAL;
-    }
-
-    if (!memsz) {
-        return 0;
-    }
-
-    /* Allocate filesz - memsz in child */
-    // ^ This comment is wrong
-
-    /* Allocate filesz in parent to UTEMP */
-    res = sys_alloc_region(0, UTEMP, memsz, PROT_ALL);
-    if (res < 0) {
-        return res;
-    }
-
-    /* seek() fd to fileoffset  */
-    res = seek(fd, fileoffset);
-    if (res < 0) {
-        return res;
-    }
-
-    /* read filesz to UTEMP */
-    ssize_t res_ = readn(fd, UTEMP, filesz);
-    if (res_ < 0) {
-        assert(res_ >= INT32_MIN);
-        res = (int)res_;
-        return res;
-    }
-
-    /* Map read section contents to child */
-    res = sys_map_region(0, UTEMP, child, (void *)va, memsz, perm);
-    if (res < 0) {
-        return res;
-    }
-
-    /* Unmap it from parent */
-    res = sys_unmap_region(0, UTEMP, memsz);
-    if (res < 0) {
-        return res;
+collect_shared_region(void *start, void *end, void *arg) {
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+
+    if (list->count) {
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+            last->size += end - start;
+            return 0;
+        }
     }
 
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+    list->regions[list->count++] = (struct SpawnRegion){
+            .start = (uintptr_t)start,
+            .size = end - start,
+            .prot = prot};
     return 0;
 }
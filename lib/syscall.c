@@ -4,12 +4,12 @@
 #include <inc/lib.h>
 
 static inline int64_t __attribute__((always_inline))
-syscall(uintptr_t num, bool check, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+syscall(uintptr_t num, bool check, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6, uintptr_t a7) {
     intptr_t ret;
 
     /* Generic system call.
      * Pass system call number in RAX,
-     * Up to six parameters in RDX, RCX, RBX, RDI, RSI and R8.
+     * Up to seven parameters in RDX, RCX, RBX, RDI, RSI, R8 and R9.
      * 
      * Registers are assigned using GCC externsion
      */
@@ -17,7 +17,8 @@ syscall(uintptr_t num, bool check, uintptr_t a1, uintptr_t a2, uintptr_t a3, uin
     register uintptr_t _a0 asm("rax") = num,
                            _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
                            _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
-                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+                           _a7 asm("r9") = a7;
 
     /* Interrupt kernel with T_SYSCALL.
      * 
@@ -31,7 +32,7 @@ syscall(uintptr_t num, bool check, uintptr_t a1, uintptr_t a2, uintptr_t a3, uin
 
     asm volatile("int %1\n"
                  : "=a"(ret)
-                 : "i"(T_SYSCALL), "r"(_a0), "r"(_a1), "r"(_a2), "r"(_a3), "r"(_a4), "r"(_a5), "r"(_a6)
+                 : "i"(T_SYSCALL), "r"(_a0), "r"(_a1), "r"(_a2), "r"(_a3), "r"(_a4), "r"(_a5), "r"(_a6), "r"(_a7)
                  : "cc", "memory");
 
     if (check && ret > 0) {
@@ -43,47 +44,47 @@ syscall(uintptr_t num, bool check, uintptr_t a1, uintptr_t a2, uintptr_t a3, uin
 
 void
 sys_cputs(const char *s, size_t len) {
-    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
 }
 
 int
 sys_cgetc(void) {
-    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
 }
 
 int
 sys_rcgetc(uint8_t* is_released) {
-    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0);
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
 }
 
 int
 sys_env_destroy(envid_t envid) {
-    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
 }
 
 envid_t
 sys_getenvid(void) {
-    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
 }
 
 void
 sys_yield(void) {
-    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
 }
 
 int
 sys_region_refs(void *va, size_t size) {
-    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
 }
 
 int
 sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
-    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
 }
 
 int
 sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
-    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
 #ifdef SANITIZE_USER_SHADOW_BASE
     /* Unpoison the allocated page */
     if (!res && thisenv && envid == CURENVID && ((uintptr_t)va < SANITIZE_USER_SHADOW_BASE ||
@@ -97,7 +98,7 @@ sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
 
 int
 sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
-    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
 #ifdef SANITIZE_USER_SHADOW_BASE
     if (!res && dstenv == CURENVID)
         platform_asan_unpoison(dstva, size);
@@ -107,7 +108,7 @@ sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t
 
 int
 sys_unmap_region(envid_t envid, void *va, size_t size) {
-    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
 #ifdef SANITIZE_USER_SHADOW_BASE
     if (!res && ((uintptr_t)va < SANITIZE_USER_SHADOW_BASE ||
                  (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
@@ -121,27 +122,70 @@ sys_unmap_region(envid_t envid, void *va, size_t size) {
 
 int
 sys_env_set_status(envid_t envid, int status) {
-    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
 }
 
 int
 sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
-    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
 }
 
 int
 sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
-    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+}
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+}
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+}
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
 }
 
 int
 sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
-    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+}
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+}
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+}
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
 }
 
 int
 sys_ipc_recv(void *dstva, size_t size) {
-    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
 #ifdef SANITIZE_USER_SHADOW_BASE
     if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
 #endif
@@ -150,16 +194,16 @@ sys_ipc_recv(void *dstva, size_t size) {
 
 int
 sys_gettime(void) {
-    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
 }
 
 int
 sys_virtiogpu_init(uint32_t **fb_holder) {
-    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0);
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
 }
 
 int
 sys_virtiogpu_flush() {
-    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0);
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
 }
 
@@ -0,0 +1,11383 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 17 2f 00 00       	call   802f3a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ide_wait_ready>:
+}
+
+static inline uint8_t __attribute__((always_inline))
+inb(int port) {
+    uint8_t data;
+    asm volatile("inb %w1,%0"
+  800025:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80002a:	ec                   	in     (%dx),%al
+
+static int
+ide_wait_ready(bool check_error) {
+    int r;
+
+    while (((r = inb(0x1F7)) & (IDE_BSY | IDE_DRDY)) != IDE_DRDY) /* nothing */
+  80002b:	89 c1                	mov    %eax,%ecx
+  80002d:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800030:	80 f9 40             	cmp    $0x40,%cl
+  800033:	75 f5                	jne    80002a <ide_wait_ready+0x5>
+        ;
+
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+    return 0;
+  800035:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+  80003a:	40 84 ff             	test   %dil,%dil
+  80003d:	74 0a                	je     800049 <ide_wait_ready+0x24>
+  80003f:	a8 21                	test   $0x21,%al
+  800041:	0f 95 c2             	setne  %dl
+  800044:	0f b6 d2             	movzbl %dl,%edx
+  800047:	f7 da                	neg    %edx
+}
+  800049:	89 d0                	mov    %edx,%eax
+  80004b:	c3                   	ret
+
+000000000080004c <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void) {
+  80004c:	55                   	push   %rbp
+  80004d:	48 89 e5             	mov    %rsp,%rbp
+  800050:	53                   	push   %rbx
+  800051:	48 83 ec 08          	sub    $0x8,%rsp
+    int x;
+
+    /* Wait for Device 0 to be ready */
+    ide_wait_ready(0);
+  800055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800061:	00 00 00 
+  800064:	ff d0                	call   *%rax
+                 : "memory", "cc");
+}
+
+static inline void __attribute__((always_inline))
+outb(int port, uint8_t data) {
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800066:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80006b:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800070:	ee                   	out    %al,(%dx)
+    asm volatile("inb %w1,%0"
+  800071:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800076:	ec                   	in     (%dx),%al
+
+    /* Switch to Device 1 */
+    outb(0x1F6, 0xE0 | (1 << 4));
+
+    /* Check for Device 1 to be ready for a while */
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  800077:	a8 a1                	test   $0xa1,%al
+  800079:	74 54                	je     8000cf <ide_probe_disk1+0x83>
+  80007b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800080:	83 c1 01             	add    $0x1,%ecx
+  800083:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800089:	74 05                	je     800090 <ide_probe_disk1+0x44>
+  80008b:	ec                   	in     (%dx),%al
+  80008c:	a8 a1                	test   $0xa1,%al
+  80008e:	75 f0                	jne    800080 <ide_probe_disk1+0x34>
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800090:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800095:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80009a:	ee                   	out    %al,(%dx)
+        ;
+
+    /* Switch back to Device 0 */
+    outb(0x1F6, 0xE0 | (0 << 4));
+
+    cprintf("Device 1 presence: %d\n", (x < 1000));
+  80009b:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000a1:	0f 9e c3             	setle  %bl
+  8000a4:	40 0f 9e c6          	setle  %sil
+  8000a8:	40 0f b6 f6          	movzbl %sil,%esi
+  8000ac:	48 bf e0 67 80 00 00 	movabs $0x8067e0,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  8000c2:	00 00 00 
+  8000c5:	ff d2                	call   *%rdx
+    return (x < 1000);
+}
+  8000c7:	89 d8                	mov    %ebx,%eax
+  8000c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000cd:	c9                   	leave
+  8000ce:	c3                   	ret
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  8000cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000d4:	eb ba                	jmp    800090 <ide_probe_disk1+0x44>
+
+00000000008000d6 <ide_set_disk>:
+
+void
+ide_set_disk(int d) {
+    if (d != 0 && d != 1)
+  8000d6:	83 ff 01             	cmp    $0x1,%edi
+  8000d9:	77 0c                	ja     8000e7 <ide_set_disk+0x11>
+        panic("bad disk number");
+    diskno = d;
+  8000db:	89 f8                	mov    %edi,%eax
+  8000dd:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8000e4:	00 00 
+  8000e6:	c3                   	ret
+ide_set_disk(int d) {
+  8000e7:	55                   	push   %rbp
+  8000e8:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad disk number");
+  8000eb:	48 ba f7 67 80 00 00 	movabs $0x8067f7,%rdx
+  8000f2:	00 00 00 
+  8000f5:	be 34 00 00 00       	mov    $0x34,%esi
+  8000fa:	48 bf 07 68 80 00 00 	movabs $0x806807,%rdi
+  800101:	00 00 00 
+  800104:	b8 00 00 00 00       	mov    $0x0,%eax
+  800109:	48 b9 06 30 80 00 00 	movabs $0x803006,%rcx
+  800110:	00 00 00 
+  800113:	ff d1                	call   *%rcx
+
+0000000000800115 <ide_read>:
+}
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs) {
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800122:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  800129:	0f 87 c0 00 00 00    	ja     8001ef <ide_read+0xda>
+  80012f:	41 89 fd             	mov    %edi,%r13d
+  800132:	48 89 f3             	mov    %rsi,%rbx
+  800135:	49 89 d4             	mov    %rdx,%r12
+
+    ide_wait_ready(0);
+  800138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80013d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800144:	00 00 00 
+  800147:	ff d0                	call   *%rax
+  800149:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  80014e:	44 89 e0             	mov    %r12d,%eax
+  800151:	ee                   	out    %al,(%dx)
+  800152:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800157:	44 89 e8             	mov    %r13d,%eax
+  80015a:	ee                   	out    %al,(%dx)
+
+    outb(0x1F2, nsecs);
+    outb(0x1F3, secno & 0xFF);
+    outb(0x1F4, (secno >> 8) & 0xFF);
+  80015b:	44 89 e8             	mov    %r13d,%eax
+  80015e:	c1 e8 08             	shr    $0x8,%eax
+  800161:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800166:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (secno >> 16) & 0xFF);
+  800167:	44 89 e8             	mov    %r13d,%eax
+  80016a:	c1 e8 10             	shr    $0x10,%eax
+  80016d:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800172:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+  800173:	a1 00 80 80 00 00 00 	movabs 0x808000,%eax
+  80017a:	00 00 
+  80017c:	c1 e0 04             	shl    $0x4,%eax
+  80017f:	83 e0 10             	and    $0x10,%eax
+  800182:	41 c1 ed 18          	shr    $0x18,%r13d
+  800186:	41 83 e5 0f          	and    $0xf,%r13d
+  80018a:	44 09 e8             	or     %r13d,%eax
+  80018d:	83 c8 e0             	or     $0xffffffe0,%eax
+  800190:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800195:	ee                   	out    %al,(%dx)
+  800196:	b8 20 00 00 00       	mov    $0x20,%eax
+  80019b:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8001a0:	ee                   	out    %al,(%dx)
+    outb(0x1F7, 0x20); /* CMD 0x20 means read sector */
+
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8001a1:	4d 85 e4             	test   %r12,%r12
+  8001a4:	74 7e                	je     800224 <ide_read+0x10f>
+  8001a6:	49 c1 e4 09          	shl    $0x9,%r12
+  8001aa:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  8001ad:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8001b4:	00 00 00 
+  8001b7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001bc:	41 ff d5             	call   *%r13
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	78 21                	js     8001e4 <ide_read+0xcf>
+    asm volatile("cld\n\trepne\n\tinsl"
+  8001c3:	48 89 df             	mov    %rbx,%rdi
+  8001c6:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8001cb:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8001d0:	fc                   	cld
+  8001d1:	f2 6d                	repnz insl (%dx),%es:(%rdi)
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8001d3:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8001da:	49 39 dc             	cmp    %rbx,%r12
+  8001dd:	75 d8                	jne    8001b7 <ide_read+0xa2>
+        insl(0x1F0, dst, SECTSIZE / 4);
+    }
+
+    return 0;
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001e4:	48 83 c4 08          	add    $0x8,%rsp
+  8001e8:	5b                   	pop    %rbx
+  8001e9:	41 5c                	pop    %r12
+  8001eb:	41 5d                	pop    %r13
+  8001ed:	5d                   	pop    %rbp
+  8001ee:	c3                   	ret
+    assert(nsecs <= 256);
+  8001ef:	48 b9 10 68 80 00 00 	movabs $0x806810,%rcx
+  8001f6:	00 00 00 
+  8001f9:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800200:	00 00 00 
+  800203:	be 3c 00 00 00       	mov    $0x3c,%esi
+  800208:	48 bf 07 68 80 00 00 	movabs $0x806807,%rdi
+  80020f:	00 00 00 
+  800212:	b8 00 00 00 00       	mov    $0x0,%eax
+  800217:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  80021e:	00 00 00 
+  800221:	41 ff d0             	call   *%r8
+    return 0;
+  800224:	b8 00 00 00 00       	mov    $0x0,%eax
+  800229:	eb b9                	jmp    8001e4 <ide_read+0xcf>
+
+000000000080022b <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs) {
+  80022b:	55                   	push   %rbp
+  80022c:	48 89 e5             	mov    %rsp,%rbp
+  80022f:	41 55                	push   %r13
+  800231:	41 54                	push   %r12
+  800233:	53                   	push   %rbx
+  800234:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800238:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  80023f:	0f 87 c0 00 00 00    	ja     800305 <ide_write+0xda>
+  800245:	41 89 fd             	mov    %edi,%r13d
+  800248:	48 89 f3             	mov    %rsi,%rbx
+  80024b:	49 89 d4             	mov    %rdx,%r12
+
+    ide_wait_ready(0);
+  80024e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800253:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  80025f:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800264:	44 89 e0             	mov    %r12d,%eax
+  800267:	ee                   	out    %al,(%dx)
+  800268:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  80026d:	44 89 e8             	mov    %r13d,%eax
+  800270:	ee                   	out    %al,(%dx)
+
+    outb(0x1F2, nsecs);
+    outb(0x1F3, secno & 0xFF);
+    outb(0x1F4, (secno >> 8) & 0xFF);
+  800271:	44 89 e8             	mov    %r13d,%eax
+  800274:	c1 e8 08             	shr    $0x8,%eax
+  800277:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  80027c:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (secno >> 16) & 0xFF);
+  80027d:	44 89 e8             	mov    %r13d,%eax
+  800280:	c1 e8 10             	shr    $0x10,%eax
+  800283:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800288:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+  800289:	a1 00 80 80 00 00 00 	movabs 0x808000,%eax
+  800290:	00 00 
+  800292:	c1 e0 04             	shl    $0x4,%eax
+  800295:	83 e0 10             	and    $0x10,%eax
+  800298:	41 c1 ed 18          	shr    $0x18,%r13d
+  80029c:	41 83 e5 0f          	and    $0xf,%r13d
+  8002a0:	44 09 e8             	or     %r13d,%eax
+  8002a3:	83 c8 e0             	or     $0xffffffe0,%eax
+  8002a6:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8002ab:	ee                   	out    %al,(%dx)
+  8002ac:	b8 30 00 00 00       	mov    $0x30,%eax
+  8002b1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8002b6:	ee                   	out    %al,(%dx)
+    outb(0x1F7, 0x30); /* CMD 0x30 means write sector */
+
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8002b7:	4d 85 e4             	test   %r12,%r12
+  8002ba:	74 7e                	je     80033a <ide_write+0x10f>
+  8002bc:	49 c1 e4 09          	shl    $0x9,%r12
+  8002c0:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  8002c3:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8002ca:	00 00 00 
+  8002cd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8002d2:	41 ff d5             	call   *%r13
+  8002d5:	85 c0                	test   %eax,%eax
+  8002d7:	78 21                	js     8002fa <ide_write+0xcf>
+                 : "cc");
+}
+
+static inline void __attribute__((always_inline))
+outsl(int port, const void *addr, int cnt) {
+    asm volatile("cld\n\trepne\n\toutsl"
+  8002d9:	48 89 de             	mov    %rbx,%rsi
+  8002dc:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8002e1:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8002e6:	fc                   	cld
+  8002e7:	f2 6f                	repnz outsl %ds:(%rsi),(%dx)
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8002e9:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8002f0:	49 39 dc             	cmp    %rbx,%r12
+  8002f3:	75 d8                	jne    8002cd <ide_write+0xa2>
+        outsl(0x1F0, src, SECTSIZE / 4);
+    }
+
+    return 0;
+  8002f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002fa:	48 83 c4 08          	add    $0x8,%rsp
+  8002fe:	5b                   	pop    %rbx
+  8002ff:	41 5c                	pop    %r12
+  800301:	41 5d                	pop    %r13
+  800303:	5d                   	pop    %rbp
+  800304:	c3                   	ret
+    assert(nsecs <= 256);
+  800305:	48 b9 10 68 80 00 00 	movabs $0x806810,%rcx
+  80030c:	00 00 00 
+  80030f:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800316:	00 00 00 
+  800319:	be 53 00 00 00       	mov    $0x53,%esi
+  80031e:	48 bf 07 68 80 00 00 	movabs $0x806807,%rdi
+  800325:	00 00 00 
+  800328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032d:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800334:	00 00 00 
+  800337:	41 ff d0             	call   *%r8
+    return 0;
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	eb b9                	jmp    8002fa <ide_write+0xcf>
+
+0000000000800341 <diskaddr>:
+static uint32_t bc_referenced[DISKSIZE / BLKSIZE / 32];
+static blockno_t bc_clock_hand;
+
+/* Return the virtual address of this disk block. */
+void *
+diskaddr(blockno_t blockno) {
+  800341:	89 f9                	mov    %edi,%ecx
+    if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  800343:	85 ff                	test   %edi,%edi
+  800345:	74 3c                	je     800383 <diskaddr+0x42>
+  800347:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  80034e:	00 00 00 
+  800351:	48 85 c0             	test   %rax,%rax
+  800354:	74 05                	je     80035b <diskaddr+0x1a>
+  800356:	3b 78 04             	cmp    0x4(%rax),%edi
+  800359:	73 28                	jae    800383 <diskaddr+0x42>
+        panic("bad block number %08x in diskaddr", blockno);
+    SETBIT(bc_referenced, blockno);
+  80035b:	89 c8                	mov    %ecx,%eax
+  80035d:	c1 e8 05             	shr    $0x5,%eax
+  800360:	48 be 20 d0 80 00 00 	movabs $0x80d020,%rsi
+  800367:	00 00 00 
+  80036a:	89 c0                	mov    %eax,%eax
+  80036c:	ba 01 00 00 00       	mov    $0x1,%edx
+  800371:	d3 e2                	shl    %cl,%edx
+  800373:	09 14 86             	or     %edx,(%rsi,%rax,4)
+    void *r = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  800376:	89 c8                	mov    %ecx,%eax
+  800378:	48 05 00 00 01 00    	add    $0x10000,%rax
+  80037e:	48 c1 e0 0c          	shl    $0xc,%rax
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(r, BLKSIZE);
+#endif
+    return r;
+}
+  800382:	c3                   	ret
+diskaddr(blockno_t blockno) {
+  800383:	55                   	push   %rbp
+  800384:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad block number %08x in diskaddr", blockno);
+  800387:	48 ba 38 68 80 00 00 	movabs $0x806838,%rdx
+  80038e:	00 00 00 
+  800391:	be 0c 00 00 00       	mov    $0xc,%esi
+  800396:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  80039d:	00 00 00 
+  8003a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a5:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8003ac:	00 00 00 
+  8003af:	41 ff d0             	call   *%r8
+
+00000000008003b2 <bc_pgfault>:
+/* Fault any disk block that is read in to memory by
+ * loading it from disk. */
+static bool
+bc_pgfault(struct UTrapframe *utf) {
+    void *addr = (void *)utf->utf_fault_va;
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  8003b2:	48 8b 3f             	mov    (%rdi),%rdi
+  8003b5:	48 81 ef 00 00 00 10 	sub    $0x10000000,%rdi
+
+    /* Check that the fault was within the block cache region */
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  8003bc:	b8 ff ff ff bf       	mov    $0xbfffffff,%eax
+  8003c1:	48 39 f8             	cmp    %rdi,%rax
+  8003c4:	0f 82 19 01 00 00    	jb     8004e3 <bc_pgfault+0x131>
+bc_pgfault(struct UTrapframe *utf) {
+  8003ca:	55                   	push   %rbp
+  8003cb:	48 89 e5             	mov    %rsp,%rbp
+  8003ce:	41 54                	push   %r12
+  8003d0:	53                   	push   %rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  8003d1:	48 89 fb             	mov    %rdi,%rbx
+  8003d4:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8003d8:	89 df                	mov    %ebx,%edi
+
+    /* Sanity check the block number. */
+    if (super && blockno >= super->s_nblocks)
+  8003da:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  8003e1:	00 00 00 
+  8003e4:	48 85 c0             	test   %rax,%rax
+  8003e7:	74 09                	je     8003f2 <bc_pgfault+0x40>
+  8003e9:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  8003ed:	44 39 c3             	cmp    %r8d,%ebx
+  8003f0:	73 5a                	jae    80044c <bc_pgfault+0x9a>
+     * of the block from the disk into that page.
+     * Hint: first round addr to page boundary. fs/ide.c has code to read
+     * the disk. */
+    // LAB 10: Your code here DONE
+
+    void *disk_addr = diskaddr(blockno);
+  8003f2:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+  8003fe:	49 89 c4             	mov    %rax,%r12
+
+    int res = sys_alloc_region(0, disk_addr, BLKSIZE, PROT_RW);
+  800401:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800406:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80040b:	48 89 c6             	mov    %rax,%rsi
+  80040e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800413:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  80041a:	00 00 00 
+  80041d:	ff d0                	call   *%rax
+    assert(res >= 0);
+  80041f:	85 c0                	test   %eax,%eax
+  800421:	78 56                	js     800479 <bc_pgfault+0xc7>
+    res = ide_read(blockno * BLKSECTS, disk_addr, BLKSECTS);
+  800423:	8d 3c dd 00 00 00 00 	lea    0x0(,%rbx,8),%edi
+  80042a:	ba 08 00 00 00       	mov    $0x8,%edx
+  80042f:	4c 89 e6             	mov    %r12,%rsi
+  800432:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  800439:	00 00 00 
+  80043c:	ff d0                	call   *%rax
+    assert(res >= 0);
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	78 6c                	js     8004ae <bc_pgfault+0xfc>
+
+    return 1;
+  800442:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800447:	5b                   	pop    %rbx
+  800448:	41 5c                	pop    %r12
+  80044a:	5d                   	pop    %rbp
+  80044b:	c3                   	ret
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  80044c:	89 d9                	mov    %ebx,%ecx
+  80044e:	48 ba 60 68 80 00 00 	movabs $0x806860,%rdx
+  800455:	00 00 00 
+  800458:	be 21 00 00 00       	mov    $0x21,%esi
+  80045d:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  800464:	00 00 00 
+  800467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046c:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  800473:	00 00 00 
+  800476:	41 ff d1             	call   *%r9
+    assert(res >= 0);
+  800479:	48 b9 bc 68 80 00 00 	movabs $0x8068bc,%rcx
+  800480:	00 00 00 
+  800483:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  80048a:	00 00 00 
+  80048d:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800492:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  800499:	00 00 00 
+  80049c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a1:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8004a8:	00 00 00 
+  8004ab:	41 ff d0             	call   *%r8
+    assert(res >= 0);
+  8004ae:	48 b9 bc 68 80 00 00 	movabs $0x8068bc,%rcx
+  8004b5:	00 00 00 
+  8004b8:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  8004bf:	00 00 00 
+  8004c2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8004c7:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  8004ce:	00 00 00 
+  8004d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d6:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8004dd:	00 00 00 
+  8004e0:	41 ff d0             	call   *%r8
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  8004e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004e8:	c3                   	ret
+
+00000000008004e9 <write_block>:
+/* Write the block containing VA out to disk even if the PTE_D
+ * bit is clear and then clear the bit.  Blocks mapped by clients
+ * with mmap() are modified without setting our PTE_D bit.
+ * The block must be in the block cache. */
+void
+write_block(void *addr) {
+  8004e9:	55                   	push   %rbp
+  8004ea:	48 89 e5             	mov    %rsp,%rbp
+  8004ed:	41 54                	push   %r12
+  8004ef:	53                   	push   %rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  8004f0:	48 8d 9f 00 00 00 f0 	lea    -0x10000000(%rdi),%rbx
+  8004f7:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8004fb:	89 df                	mov    %ebx,%edi
+    void *disk_addr = diskaddr(blockno);
+  8004fd:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  800504:	00 00 00 
+  800507:	ff d0                	call   *%rax
+  800509:	49 89 c4             	mov    %rax,%r12
+
+    assert(is_page_present(disk_addr));
+  80050c:	48 89 c7             	mov    %rax,%rdi
+  80050f:	48 b8 cd 61 80 00 00 	movabs $0x8061cd,%rax
+  800516:	00 00 00 
+  800519:	ff d0                	call   *%rax
+  80051b:	84 c0                	test   %al,%al
+  80051d:	74 6b                	je     80058a <write_block+0xa1>
+
+    int res = ide_write(blockno * BLKSECTS, disk_addr, BLKSECTS);
+  80051f:	8d 3c dd 00 00 00 00 	lea    0x0(,%rbx,8),%edi
+  800526:	ba 08 00 00 00       	mov    $0x8,%edx
+  80052b:	4c 89 e6             	mov    %r12,%rsi
+  80052e:	48 b8 2b 02 80 00 00 	movabs $0x80022b,%rax
+  800535:	00 00 00 
+  800538:	ff d0                	call   *%rax
+    assert(res >= 0);
+  80053a:	85 c0                	test   %eax,%eax
+  80053c:	78 7c                	js     8005ba <write_block+0xd1>
+
+    /* To clear the dirty flag.  The page stays writable,
+     * so that it is not replaced by a fresh copy on the next
+     * write, which would detach it from client mappings */
+    res = sys_map_region(0, disk_addr, 0, disk_addr, BLKSIZE, PROT_RW | PROT_COMBINE);
+  80053e:	41 b9 06 01 00 00    	mov    $0x106,%r9d
+  800544:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80054a:	4c 89 e1             	mov    %r12,%rcx
+  80054d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800552:	4c 89 e6             	mov    %r12,%rsi
+  800555:	bf 00 00 00 00       	mov    $0x0,%edi
+  80055a:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  800561:	00 00 00 
+  800564:	ff d0                	call   *%rax
+    assert(res >= 0);
+  800566:	85 c0                	test   %eax,%eax
+  800568:	0f 88 81 00 00 00    	js     8005ef <write_block+0x106>
+
+    assert(!is_page_dirty(disk_addr));
+  80056e:	4c 89 e7             	mov    %r12,%rdi
+  800571:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  800578:	00 00 00 
+  80057b:	ff d0                	call   *%rax
+  80057d:	84 c0                	test   %al,%al
+  80057f:	0f 85 9f 00 00 00    	jne    800624 <write_block+0x13b>
+}
+  800585:	5b                   	pop    %rbx
+  800586:	41 5c                	pop    %r12
+  800588:	5d                   	pop    %rbp
+  800589:	c3                   	ret
+    assert(is_page_present(disk_addr));
+  80058a:	48 b9 c5 68 80 00 00 	movabs $0x8068c5,%rcx
+  800591:	00 00 00 
+  800594:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  80059b:	00 00 00 
+  80059e:	be 54 00 00 00       	mov    $0x54,%esi
+  8005a3:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  8005aa:	00 00 00 
+  8005ad:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8005b4:	00 00 00 
+  8005b7:	41 ff d0             	call   *%r8
+    assert(res >= 0);
+  8005ba:	48 b9 bc 68 80 00 00 	movabs $0x8068bc,%rcx
+  8005c1:	00 00 00 
+  8005c4:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  8005cb:	00 00 00 
+  8005ce:	be 57 00 00 00       	mov    $0x57,%esi
+  8005d3:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  8005da:	00 00 00 
+  8005dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e2:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8005e9:	00 00 00 
+  8005ec:	41 ff d0             	call   *%r8
+    assert(res >= 0);
+  8005ef:	48 b9 bc 68 80 00 00 	movabs $0x8068bc,%rcx
+  8005f6:	00 00 00 
+  8005f9:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800600:	00 00 00 
+  800603:	be 5d 00 00 00       	mov    $0x5d,%esi
+  800608:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  80060f:	00 00 00 
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(disk_addr));
+  800624:	48 b9 e0 68 80 00 00 	movabs $0x8068e0,%rcx
+  80062b:	00 00 00 
+  80062e:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800635:	00 00 00 
+  800638:	be 5f 00 00 00       	mov    $0x5f,%esi
+  80063d:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  800644:	00 00 00 
+  800647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064c:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800653:	00 00 00 
+  800656:	41 ff d0             	call   *%r8
+
+0000000000800659 <flush_block>:
+flush_block(void *addr) {
+  800659:	55                   	push   %rbp
+  80065a:	48 89 e5             	mov    %rsp,%rbp
+  80065d:	53                   	push   %rbx
+  80065e:	48 83 ec 08          	sub    $0x8,%rsp
+  800662:	48 89 fb             	mov    %rdi,%rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800665:	48 8d 87 00 00 00 f0 	lea    -0x10000000(%rdi),%rax
+  80066c:	48 89 c2             	mov    %rax,%rdx
+  80066f:	48 c1 ea 0c          	shr    $0xc,%rdx
+    if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
+  800673:	b9 ff ff ff bf       	mov    $0xbfffffff,%ecx
+  800678:	48 39 c1             	cmp    %rax,%rcx
+  80067b:	72 35                	jb     8006b2 <flush_block+0x59>
+    if (blockno && super && blockno >= super->s_nblocks)
+  80067d:	85 d2                	test   %edx,%edx
+  80067f:	74 18                	je     800699 <flush_block+0x40>
+  800681:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  800688:	00 00 00 
+  80068b:	48 85 c0             	test   %rax,%rax
+  80068e:	74 09                	je     800699 <flush_block+0x40>
+  800690:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  800694:	44 39 c2             	cmp    %r8d,%edx
+  800697:	73 47                	jae    8006e0 <flush_block+0x87>
+    if (!is_page_present(addr) || !is_page_dirty(addr)) {
+  800699:	48 89 df             	mov    %rbx,%rdi
+  80069c:	48 b8 cd 61 80 00 00 	movabs $0x8061cd,%rax
+  8006a3:	00 00 00 
+  8006a6:	ff d0                	call   *%rax
+  8006a8:	84 c0                	test   %al,%al
+  8006aa:	75 61                	jne    80070d <flush_block+0xb4>
+}
+  8006ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+        panic("flush_block of bad va %p", addr);
+  8006b2:	48 89 f9             	mov    %rdi,%rcx
+  8006b5:	48 ba fa 68 80 00 00 	movabs $0x8068fa,%rdx
+  8006bc:	00 00 00 
+  8006bf:	be 3f 00 00 00       	mov    $0x3f,%esi
+  8006c4:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8006da:	00 00 00 
+  8006dd:	41 ff d0             	call   *%r8
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  8006e0:	89 d1                	mov    %edx,%ecx
+  8006e2:	48 ba 60 68 80 00 00 	movabs $0x806860,%rdx
+  8006e9:	00 00 00 
+  8006ec:	be 41 00 00 00       	mov    $0x41,%esi
+  8006f1:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  8006f8:	00 00 00 
+  8006fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800700:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  800707:	00 00 00 
+  80070a:	41 ff d1             	call   *%r9
+    if (!is_page_present(addr) || !is_page_dirty(addr)) {
+  80070d:	48 89 df             	mov    %rbx,%rdi
+  800710:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  800717:	00 00 00 
+  80071a:	ff d0                	call   *%rax
+  80071c:	84 c0                	test   %al,%al
+  80071e:	74 8c                	je     8006ac <flush_block+0x53>
+    write_block(addr);
+  800720:	48 89 df             	mov    %rbx,%rdi
+  800723:	48 b8 e9 04 80 00 00 	movabs $0x8004e9,%rax
+  80072a:	00 00 00 
+  80072d:	ff d0                	call   *%rax
+  80072f:	e9 78 ff ff ff       	jmp    8006ac <flush_block+0x53>
+
+0000000000800734 <bc_reclaim>:
+ * from disk by bc_pgfault() when needed.
+ * Pages shared with other environments are kept since
+ * unmapping them would not free any memory.
+ * Returns number of pages dropped. */
+size_t
+bc_reclaim(size_t npages) {
+  800734:	55                   	push   %rbp
+  800735:	48 89 e5             	mov    %rsp,%rbp
+  800738:	41 57                	push   %r15
+  80073a:	41 56                	push   %r14
+  80073c:	41 55                	push   %r13
+  80073e:	41 54                	push   %r12
+  800740:	53                   	push   %rbx
+  800741:	48 83 ec 18          	sub    $0x18,%rsp
+    size_t nfreed = 0;
+    if (!super) return 0;
+  800745:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  80074c:	00 00 00 
+  80074f:	48 85 c0             	test   %rax,%rax
+  800752:	0f 84 22 01 00 00    	je     80087a <bc_reclaim+0x146>
+  800758:	49 89 ff             	mov    %rdi,%r15
+
+    /* Second lap finds blocks referenced bits were cleared on the first one */
+    for (size_t i = 0; i < 2 * super->s_nblocks && nfreed < npages; i++) {
+  80075b:	8b 48 04             	mov    0x4(%rax),%ecx
+  80075e:	89 c8                	mov    %ecx,%eax
+  800760:	01 c0                	add    %eax,%eax
+  800762:	0f 84 2d 01 00 00    	je     800895 <bc_reclaim+0x161>
+  800768:	48 85 ff             	test   %rdi,%rdi
+  80076b:	0f 84 24 01 00 00    	je     800895 <bc_reclaim+0x161>
+  800771:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    size_t nfreed = 0;
+  800777:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80077e:	00 
+        blockno_t blockno = bc_clock_hand;
+  80077f:	49 be 00 d0 80 00 00 	movabs $0x80d000,%r14
+  800786:	00 00 00 
+  800789:	eb 44                	jmp    8007cf <bc_reclaim+0x9b>
+        if (TSTBIT(bc_referenced, blockno)) {
+            CLRBIT(bc_referenced, blockno);
+            continue;
+        }
+
+        if (sys_region_refs(addr, BLKSIZE) > 1) continue;
+  80078b:	be 00 10 00 00       	mov    $0x1000,%esi
+  800790:	4c 89 e7             	mov    %r12,%rdi
+  800793:	48 b8 88 41 80 00 00 	movabs $0x804188,%rax
+  80079a:	00 00 00 
+  80079d:	ff d0                	call   *%rax
+  80079f:	83 f8 01             	cmp    $0x1,%eax
+  8007a2:	0f 8e ac 00 00 00    	jle    800854 <bc_reclaim+0x120>
+    for (size_t i = 0; i < 2 * super->s_nblocks && nfreed < npages; i++) {
+  8007a8:	49 83 c5 01          	add    $0x1,%r13
+  8007ac:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  8007b3:	00 00 00 
+  8007b6:	8b 48 04             	mov    0x4(%rax),%ecx
+  8007b9:	8d 04 09             	lea    (%rcx,%rcx,1),%eax
+  8007bc:	49 39 c5             	cmp    %rax,%r13
+  8007bf:	0f 83 bd 00 00 00    	jae    800882 <bc_reclaim+0x14e>
+  8007c5:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8007c9:	0f 83 b3 00 00 00    	jae    800882 <bc_reclaim+0x14e>
+        blockno_t blockno = bc_clock_hand;
+  8007cf:	41 8b 1e             	mov    (%r14),%ebx
+        bc_clock_hand = (bc_clock_hand + 1) % super->s_nblocks;
+  8007d2:	8d 43 01             	lea    0x1(%rbx),%eax
+  8007d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007da:	f7 f1                	div    %ecx
+  8007dc:	41 89 16             	mov    %edx,(%r14)
+        if (!blockno || !is_page_present(addr) || is_page_dirty(addr)) continue;
+  8007df:	85 db                	test   %ebx,%ebx
+  8007e1:	74 c5                	je     8007a8 <bc_reclaim+0x74>
+        void *addr = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  8007e3:	41 89 dc             	mov    %ebx,%r12d
+  8007e6:	49 81 c4 00 00 01 00 	add    $0x10000,%r12
+  8007ed:	49 c1 e4 0c          	shl    $0xc,%r12
+        if (!blockno || !is_page_present(addr) || is_page_dirty(addr)) continue;
+  8007f1:	4c 89 e7             	mov    %r12,%rdi
+  8007f4:	48 b8 cd 61 80 00 00 	movabs $0x8061cd,%rax
+  8007fb:	00 00 00 
+  8007fe:	ff d0                	call   *%rax
+  800800:	84 c0                	test   %al,%al
+  800802:	74 a4                	je     8007a8 <bc_reclaim+0x74>
+  800804:	4c 89 e7             	mov    %r12,%rdi
+  800807:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  80080e:	00 00 00 
+  800811:	ff d0                	call   *%rax
+  800813:	84 c0                	test   %al,%al
+  800815:	75 91                	jne    8007a8 <bc_reclaim+0x74>
+        if (TSTBIT(bc_referenced, blockno)) {
+  800817:	89 da                	mov    %ebx,%edx
+  800819:	c1 ea 05             	shr    $0x5,%edx
+  80081c:	89 d0                	mov    %edx,%eax
+  80081e:	48 be 20 d0 80 00 00 	movabs $0x80d020,%rsi
+  800825:	00 00 00 
+  800828:	8b 34 86             	mov    (%rsi,%rax,4),%esi
+  80082b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800830:	89 d9                	mov    %ebx,%ecx
+  800832:	d3 e0                	shl    %cl,%eax
+  800834:	85 c6                	test   %eax,%esi
+  800836:	0f 84 4f ff ff ff    	je     80078b <bc_reclaim+0x57>
+            CLRBIT(bc_referenced, blockno);
+  80083c:	89 d2                	mov    %edx,%edx
+  80083e:	f7 d0                	not    %eax
+  800840:	21 f0                	and    %esi,%eax
+  800842:	48 b9 20 d0 80 00 00 	movabs $0x80d020,%rcx
+  800849:	00 00 00 
+  80084c:	89 04 91             	mov    %eax,(%rcx,%rdx,4)
+            continue;
+  80084f:	e9 54 ff ff ff       	jmp    8007a8 <bc_reclaim+0x74>
+        if (!sys_unmap_region(0, addr, BLKSIZE)) nfreed++;
+  800854:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800859:	4c 89 e6             	mov    %r12,%rsi
+  80085c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800861:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  800868:	00 00 00 
+  80086b:	ff d0                	call   *%rax
+  80086d:	83 f8 01             	cmp    $0x1,%eax
+  800870:	48 83 55 c8 00       	adcq   $0x0,-0x38(%rbp)
+  800875:	e9 2e ff ff ff       	jmp    8007a8 <bc_reclaim+0x74>
+    if (!super) return 0;
+  80087a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800881:	00 
+    }
+
+    return nfreed;
+}
+  800882:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800886:	48 83 c4 18          	add    $0x18,%rsp
+  80088a:	5b                   	pop    %rbx
+  80088b:	41 5c                	pop    %r12
+  80088d:	41 5d                	pop    %r13
+  80088f:	41 5e                	pop    %r14
+  800891:	41 5f                	pop    %r15
+  800893:	5d                   	pop    %rbp
+  800894:	c3                   	ret
+    size_t nfreed = 0;
+  800895:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80089c:	00 
+  80089d:	eb e3                	jmp    800882 <bc_reclaim+0x14e>
+
+000000000080089f <bc_init>:
+
+    cprintf("block cache is good\n");
+}
+
+void
+bc_init(void) {
+  80089f:	55                   	push   %rbp
+  8008a0:	48 89 e5             	mov    %rsp,%rbp
+  8008a3:	41 54                	push   %r12
+  8008a5:	53                   	push   %rbx
+  8008a6:	48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    struct Super super;
+    add_pgfault_handler(bc_pgfault);
+  8008ad:	48 bf b2 03 80 00 00 	movabs $0x8003b2,%rdi
+  8008b4:	00 00 00 
+  8008b7:	48 b8 da 48 80 00 00 	movabs $0x8048da,%rax
+  8008be:	00 00 00 
+  8008c1:	ff d0                	call   *%rax
+    memmove(&backup, diskaddr(1), sizeof backup);
+  8008c3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8008c8:	48 bb 41 03 80 00 00 	movabs $0x800341,%rbx
+  8008cf:	00 00 00 
+  8008d2:	ff d3                	call   *%rbx
+  8008d4:	48 89 c6             	mov    %rax,%rsi
+  8008d7:	ba 08 01 00 00       	mov    $0x108,%edx
+  8008dc:	48 8d bd e0 fd ff ff 	lea    -0x220(%rbp),%rdi
+  8008e3:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  8008ea:	00 00 00 
+  8008ed:	ff d0                	call   *%rax
+    strcpy(diskaddr(1), "OOPS!\n");
+  8008ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8008f4:	ff d3                	call   *%rbx
+  8008f6:	48 89 c7             	mov    %rax,%rdi
+  8008f9:	48 be 13 69 80 00 00 	movabs $0x806913,%rsi
+  800900:	00 00 00 
+  800903:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  80090a:	00 00 00 
+  80090d:	ff d0                	call   *%rax
+    flush_block(diskaddr(1));
+  80090f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800914:	ff d3                	call   *%rbx
+  800916:	48 89 c7             	mov    %rax,%rdi
+  800919:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  800920:	00 00 00 
+  800923:	ff d0                	call   *%rax
+    assert(is_page_present(diskaddr(1)));
+  800925:	bf 01 00 00 00       	mov    $0x1,%edi
+  80092a:	ff d3                	call   *%rbx
+  80092c:	48 89 c7             	mov    %rax,%rdi
+  80092f:	48 b8 cd 61 80 00 00 	movabs $0x8061cd,%rax
+  800936:	00 00 00 
+  800939:	ff d0                	call   *%rax
+  80093b:	84 c0                	test   %al,%al
+  80093d:	0f 84 25 01 00 00    	je     800a68 <bc_init+0x1c9>
+    assert(!is_page_dirty(diskaddr(1)));
+  800943:	bf 01 00 00 00       	mov    $0x1,%edi
+  800948:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  80094f:	00 00 00 
+  800952:	ff d0                	call   *%rax
+  800954:	48 89 c7             	mov    %rax,%rdi
+  800957:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  80095e:	00 00 00 
+  800961:	ff d0                	call   *%rax
+  800963:	84 c0                	test   %al,%al
+  800965:	0f 85 2d 01 00 00    	jne    800a98 <bc_init+0x1f9>
+    sys_unmap_region(0, diskaddr(1), PAGE_SIZE);
+  80096b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800970:	48 bb 41 03 80 00 00 	movabs $0x800341,%rbx
+  800977:	00 00 00 
+  80097a:	ff d3                	call   *%rbx
+  80097c:	48 89 c6             	mov    %rax,%rsi
+  80097f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800984:	bf 00 00 00 00       	mov    $0x0,%edi
+  800989:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  800990:	00 00 00 
+  800993:	ff d0                	call   *%rax
+    assert(!is_page_present(diskaddr(1)));
+  800995:	bf 01 00 00 00       	mov    $0x1,%edi
+  80099a:	ff d3                	call   *%rbx
+  80099c:	48 89 c7             	mov    %rax,%rdi
+  80099f:	48 b8 cd 61 80 00 00 	movabs $0x8061cd,%rax
+  8009a6:	00 00 00 
+  8009a9:	ff d0                	call   *%rax
+  8009ab:	84 c0                	test   %al,%al
+  8009ad:	0f 85 1a 01 00 00    	jne    800acd <bc_init+0x22e>
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8009b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009b8:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  8009bf:	00 00 00 
+  8009c2:	ff d0                	call   *%rax
+  8009c4:	48 89 c7             	mov    %rax,%rdi
+  8009c7:	48 be 13 69 80 00 00 	movabs $0x806913,%rsi
+  8009ce:	00 00 00 
+  8009d1:	48 b8 4f 3b 80 00 00 	movabs $0x803b4f,%rax
+  8009d8:	00 00 00 
+  8009db:	ff d0                	call   *%rax
+  8009dd:	85 c0                	test   %eax,%eax
+  8009df:	0f 85 1d 01 00 00    	jne    800b02 <bc_init+0x263>
+    memmove(diskaddr(1), &backup, sizeof backup);
+  8009e5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009ea:	48 bb 41 03 80 00 00 	movabs $0x800341,%rbx
+  8009f1:	00 00 00 
+  8009f4:	ff d3                	call   *%rbx
+  8009f6:	48 89 c7             	mov    %rax,%rdi
+  8009f9:	ba 08 01 00 00       	mov    $0x108,%edx
+  8009fe:	48 8d b5 e0 fd ff ff 	lea    -0x220(%rbp),%rsi
+  800a05:	49 bc dd 3d 80 00 00 	movabs $0x803ddd,%r12
+  800a0c:	00 00 00 
+  800a0f:	41 ff d4             	call   *%r12
+    flush_block(diskaddr(1));
+  800a12:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a17:	ff d3                	call   *%rbx
+  800a19:	48 89 c7             	mov    %rax,%rdi
+  800a1c:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  800a23:	00 00 00 
+  800a26:	ff d0                	call   *%rax
+    cprintf("block cache is good\n");
+  800a28:	48 bf 54 69 80 00 00 	movabs $0x806954,%rdi
+  800a2f:	00 00 00 
+  800a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a37:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  800a3e:	00 00 00 
+  800a41:	ff d2                	call   *%rdx
+    check_bc();
+
+    /* Cache the super block by reading it once */
+    memmove(&super, diskaddr(1), sizeof super);
+  800a43:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a48:	ff d3                	call   *%rbx
+  800a4a:	48 89 c6             	mov    %rax,%rsi
+  800a4d:	ba 08 01 00 00       	mov    $0x108,%edx
+  800a52:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  800a59:	41 ff d4             	call   *%r12
+}
+  800a5c:	48 81 c4 10 02 00 00 	add    $0x210,%rsp
+  800a63:	5b                   	pop    %rbx
+  800a64:	41 5c                	pop    %r12
+  800a66:	5d                   	pop    %rbp
+  800a67:	c3                   	ret
+    assert(is_page_present(diskaddr(1)));
+  800a68:	48 b9 37 69 80 00 00 	movabs $0x806937,%rcx
+  800a6f:	00 00 00 
+  800a72:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800a79:	00 00 00 
+  800a7c:	be 8e 00 00 00       	mov    $0x8e,%esi
+  800a81:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  800a88:	00 00 00 
+  800a8b:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800a92:	00 00 00 
+  800a95:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(diskaddr(1)));
+  800a98:	48 b9 1a 69 80 00 00 	movabs $0x80691a,%rcx
+  800a9f:	00 00 00 
+  800aa2:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800aa9:	00 00 00 
+  800aac:	be 8f 00 00 00       	mov    $0x8f,%esi
+  800ab1:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  800ab8:	00 00 00 
+  800abb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac0:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800ac7:	00 00 00 
+  800aca:	41 ff d0             	call   *%r8
+    assert(!is_page_present(diskaddr(1)));
+  800acd:	48 b9 36 69 80 00 00 	movabs $0x806936,%rcx
+  800ad4:	00 00 00 
+  800ad7:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800ade:	00 00 00 
+  800ae1:	be 93 00 00 00       	mov    $0x93,%esi
+  800ae6:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  800aed:	00 00 00 
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af5:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800afc:	00 00 00 
+  800aff:	41 ff d0             	call   *%r8
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  800b02:	48 b9 90 68 80 00 00 	movabs $0x806890,%rcx
+  800b09:	00 00 00 
+  800b0c:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800b13:	00 00 00 
+  800b16:	be 96 00 00 00       	mov    $0x96,%esi
+  800b1b:	48 bf b4 68 80 00 00 	movabs $0x8068b4,%rdi
+  800b22:	00 00 00 
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2a:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800b31:	00 00 00 
+  800b34:	41 ff d0             	call   *%r8
+
+0000000000800b37 <check_super>:
+ *                         Super block
+ ****************************************************************/
+
+/* Validate the file system super-block. */
+void
+check_super(void) {
+  800b37:	55                   	push   %rbp
+  800b38:	48 89 e5             	mov    %rsp,%rbp
+    if (super->s_magic != FS_MAGIC)
+  800b3b:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  800b42:	00 00 00 
+  800b45:	8b 08                	mov    (%rax),%ecx
+  800b47:	81 f9 ae 30 05 4a    	cmp    $0x4a0530ae,%ecx
+  800b4d:	75 26                	jne    800b75 <check_super+0x3e>
+        panic("bad file system magic number %08x", super->s_magic);
+
+    if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  800b4f:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%rax)
+  800b56:	77 48                	ja     800ba0 <check_super+0x69>
+        panic("file system is too large");
+
+    cprintf("superblock is good\n");
+  800b58:	48 bf b3 69 80 00 00 	movabs $0x8069b3,%rdi
+  800b5f:	00 00 00 
+  800b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b67:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  800b6e:	00 00 00 
+  800b71:	ff d2                	call   *%rdx
+}
+  800b73:	5d                   	pop    %rbp
+  800b74:	c3                   	ret
+        panic("bad file system magic number %08x", super->s_magic);
+  800b75:	48 ba 70 69 80 00 00 	movabs $0x806970,%rdx
+  800b7c:	00 00 00 
+  800b7f:	be 13 00 00 00       	mov    $0x13,%esi
+  800b84:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800b8b:	00 00 00 
+  800b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b93:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800b9a:	00 00 00 
+  800b9d:	41 ff d0             	call   *%r8
+        panic("file system is too large");
+  800ba0:	48 ba 9a 69 80 00 00 	movabs $0x80699a,%rdx
+  800ba7:	00 00 00 
+  800baa:	be 16 00 00 00       	mov    $0x16,%esi
+  800baf:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800bb6:	00 00 00 
+  800bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbe:	48 b9 06 30 80 00 00 	movabs $0x803006,%rcx
+  800bc5:	00 00 00 
+  800bc8:	ff d1                	call   *%rcx
+
+0000000000800bca <block_is_free>:
+
+/* Check to see if the block bitmap indicates that block 'blockno' is free.
+ * Return 1 if the block is free, 0 if not. */
+bool
+block_is_free(uint32_t blockno) {
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  800bca:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  800bd1:	00 00 00 
+  800bd4:	48 85 c0             	test   %rax,%rax
+  800bd7:	74 2d                	je     800c06 <block_is_free+0x3c>
+  800bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bde:	3b 78 04             	cmp    0x4(%rax),%edi
+  800be1:	73 20                	jae    800c03 <block_is_free+0x39>
+    if (TSTBIT(bitmap, blockno)) return 1;
+  800be3:	89 fe                	mov    %edi,%esi
+  800be5:	c1 ee 05             	shr    $0x5,%esi
+  800be8:	89 f6                	mov    %esi,%esi
+  800bea:	ba 01 00 00 00       	mov    $0x1,%edx
+  800bef:	89 f9                	mov    %edi,%ecx
+  800bf1:	d3 e2                	shl    %cl,%edx
+  800bf3:	48 a1 20 50 82 00 00 	movabs 0x825020,%rax
+  800bfa:	00 00 00 
+  800bfd:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  800c00:	0f 95 c2             	setne  %dl
+    return 0;
+}
+  800c03:	89 d0                	mov    %edx,%eax
+  800c05:	c3                   	ret
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  800c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0b:	eb f6                	jmp    800c03 <block_is_free+0x39>
+
+0000000000800c0d <free_block>:
+
+/* Mark a block free in the bitmap */
+void
+free_block(uint32_t blockno) {
+    /* Blockno zero is the null pointer of block numbers. */
+    if (blockno == 0) panic("attempt to free zero block");
+  800c0d:	85 ff                	test   %edi,%edi
+  800c0f:	74 1e                	je     800c2f <free_block+0x22>
+    SETBIT(bitmap, blockno);
+  800c11:	89 fa                	mov    %edi,%edx
+  800c13:	c1 ea 05             	shr    $0x5,%edx
+  800c16:	89 d2                	mov    %edx,%edx
+  800c18:	48 a1 20 50 82 00 00 	movabs 0x825020,%rax
+  800c1f:	00 00 00 
+  800c22:	be 01 00 00 00       	mov    $0x1,%esi
+  800c27:	89 f9                	mov    %edi,%ecx
+  800c29:	d3 e6                	shl    %cl,%esi
+  800c2b:	09 34 90             	or     %esi,(%rax,%rdx,4)
+  800c2e:	c3                   	ret
+free_block(uint32_t blockno) {
+  800c2f:	55                   	push   %rbp
+  800c30:	48 89 e5             	mov    %rsp,%rbp
+    if (blockno == 0) panic("attempt to free zero block");
+  800c33:	48 ba c7 69 80 00 00 	movabs $0x8069c7,%rdx
+  800c3a:	00 00 00 
+  800c3d:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800c42:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800c49:	00 00 00 
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c51:	48 b9 06 30 80 00 00 	movabs $0x803006,%rcx
+  800c58:	00 00 00 
+  800c5b:	ff d1                	call   *%rcx
+
+0000000000800c5d <alloc_block>:
+ * Return block number allocated on success,
+ * 0 if we are out of blocks.
+ *
+ * Hint: use free_block as an example for manipulating the bitmap. */
+blockno_t
+alloc_block(void) {
+  800c5d:	55                   	push   %rbp
+  800c5e:	48 89 e5             	mov    %rsp,%rbp
+  800c61:	41 54                	push   %r12
+  800c63:	53                   	push   %rbx
+     * contains the in-use bits for BLKBITSIZE blocks.  There are
+     * super->s_nblocks blocks in the disk altogether. */
+
+    // LAB 10: Your code here DONE
+    blockno_t blockno = 2;
+    for (; blockno < super->s_nblocks; ++blockno) {
+  800c64:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  800c6b:	00 00 00 
+  800c6e:	8b 58 04             	mov    0x4(%rax),%ebx
+  800c71:	83 fb 02             	cmp    $0x2,%ebx
+  800c74:	0f 86 aa 00 00 00    	jbe    800d24 <alloc_block+0xc7>
+        if (TSTBIT(bitmap, blockno)) {
+  800c7a:	48 a1 20 50 82 00 00 	movabs 0x825020,%rax
+  800c81:	00 00 00 
+  800c84:	f6 00 04             	testb  $0x4,(%rax)
+  800c87:	0f 85 9e 00 00 00    	jne    800d2b <alloc_block+0xce>
+    blockno_t blockno = 2;
+  800c8d:	b9 02 00 00 00       	mov    $0x2,%ecx
+        if (TSTBIT(bitmap, blockno)) {
+  800c92:	bf 01 00 00 00       	mov    $0x1,%edi
+    for (; blockno < super->s_nblocks; ++blockno) {
+  800c97:	83 c1 01             	add    $0x1,%ecx
+  800c9a:	39 d9                	cmp    %ebx,%ecx
+  800c9c:	74 12                	je     800cb0 <alloc_block+0x53>
+        if (TSTBIT(bitmap, blockno)) {
+  800c9e:	89 ce                	mov    %ecx,%esi
+  800ca0:	c1 ee 05             	shr    $0x5,%esi
+  800ca3:	89 f6                	mov    %esi,%esi
+  800ca5:	89 fa                	mov    %edi,%edx
+  800ca7:	d3 e2                	shl    %cl,%edx
+  800ca9:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  800cac:	74 e9                	je     800c97 <alloc_block+0x3a>
+    for (; blockno < super->s_nblocks; ++blockno) {
+  800cae:	89 cb                	mov    %ecx,%ebx
+            break;
+        }
+    }
+
+    CLRBIT(bitmap, blockno);
+  800cb0:	89 df                	mov    %ebx,%edi
+  800cb2:	c1 ef 05             	shr    $0x5,%edi
+  800cb5:	89 ff                	mov    %edi,%edi
+  800cb7:	48 c1 e7 02          	shl    $0x2,%rdi
+  800cbb:	48 ba 20 50 82 00 00 	movabs $0x825020,%rdx
+  800cc2:	00 00 00 
+  800cc5:	48 89 fe             	mov    %rdi,%rsi
+  800cc8:	48 03 32             	add    (%rdx),%rsi
+  800ccb:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  800cd0:	89 d9                	mov    %ebx,%ecx
+  800cd2:	d3 c0                	rol    %cl,%eax
+  800cd4:	21 06                	and    %eax,(%rsi)
+    flush_block(bitmap + blockno / (sizeof(bitmap[0]) * 8));
+  800cd6:	48 03 3a             	add    (%rdx),%rdi
+  800cd9:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  800ce0:	00 00 00 
+  800ce3:	ff d0                	call   *%rax
+
+    /* Map kernel-provided zero page instead of clearing the block
+     * (it is taken from pre-zeroed pool on first write),
+     * then touch it so the block is written out on flush */
+    void *addr = diskaddr(blockno);
+  800ce5:	89 df                	mov    %ebx,%edi
+  800ce7:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  800cee:	00 00 00 
+  800cf1:	ff d0                	call   *%rax
+  800cf3:	49 89 c4             	mov    %rax,%r12
+    int res = sys_alloc_region(0, addr, BLKSIZE, PROT_RW);
+  800cf6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800cfb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d00:	48 89 c6             	mov    %rax,%rsi
+  800d03:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d08:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  800d0f:	00 00 00 
+  800d12:	ff d0                	call   *%rax
+    if (res < 0) panic("alloc_block: %i", res);
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	78 1d                	js     800d35 <alloc_block+0xd8>
+    *(volatile uint8_t *)addr = 0;
+  800d18:	41 c6 04 24 00       	movb   $0x0,(%r12)
+
+    return blockno;
+}
+  800d1d:	89 d8                	mov    %ebx,%eax
+  800d1f:	5b                   	pop    %rbx
+  800d20:	41 5c                	pop    %r12
+  800d22:	5d                   	pop    %rbp
+  800d23:	c3                   	ret
+    blockno_t blockno = 2;
+  800d24:	bb 02 00 00 00       	mov    $0x2,%ebx
+  800d29:	eb 85                	jmp    800cb0 <alloc_block+0x53>
+  800d2b:	bb 02 00 00 00       	mov    $0x2,%ebx
+  800d30:	e9 7b ff ff ff       	jmp    800cb0 <alloc_block+0x53>
+    if (res < 0) panic("alloc_block: %i", res);
+  800d35:	89 c1                	mov    %eax,%ecx
+  800d37:	48 ba e2 69 80 00 00 	movabs $0x8069e2,%rdx
+  800d3e:	00 00 00 
+  800d41:	be 4e 00 00 00       	mov    $0x4e,%esi
+  800d46:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800d4d:	00 00 00 
+  800d50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d55:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800d5c:	00 00 00 
+  800d5f:	41 ff d0             	call   *%r8
+
+0000000000800d62 <check_bitmap>:
+/* Validate the file system bitmap.
+ *
+ * Check that all reserved blocks -- 0, 1, and the bitmap blocks themselves --
+ * are all marked as in-use. */
+void
+check_bitmap(void) {
+  800d62:	55                   	push   %rbp
+  800d63:	48 89 e5             	mov    %rsp,%rbp
+  800d66:	41 55                	push   %r13
+  800d68:	41 54                	push   %r12
+  800d6a:	53                   	push   %rbx
+  800d6b:	48 83 ec 08          	sub    $0x8,%rsp
+
+    /* Make sure all bitmap blocks are marked in-use */
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800d6f:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  800d76:	00 00 00 
+  800d79:	8b 40 04             	mov    0x4(%rax),%eax
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	74 2a                	je     800daa <check_bitmap+0x48>
+  800d80:	41 89 c4             	mov    %eax,%r12d
+  800d83:	bb 00 00 00 00       	mov    $0x0,%ebx
+        assert(!block_is_free(2 + i));
+  800d88:	49 bd ca 0b 80 00 00 	movabs $0x800bca,%r13
+  800d8f:	00 00 00 
+  800d92:	8d 7b 02             	lea    0x2(%rbx),%edi
+  800d95:	41 ff d5             	call   *%r13
+  800d98:	84 c0                	test   %al,%al
+  800d9a:	75 62                	jne    800dfe <check_bitmap+0x9c>
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800d9c:	83 c3 01             	add    $0x1,%ebx
+  800d9f:	89 d8                	mov    %ebx,%eax
+  800da1:	48 c1 e0 0f          	shl    $0xf,%rax
+  800da5:	4c 39 e0             	cmp    %r12,%rax
+  800da8:	7c e8                	jl     800d92 <check_bitmap+0x30>
+
+    /* Make sure the reserved and root blocks are marked in-use. */
+
+    assert(!block_is_free(1));
+  800daa:	bf 01 00 00 00       	mov    $0x1,%edi
+  800daf:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  800db6:	00 00 00 
+  800db9:	ff d0                	call   *%rax
+  800dbb:	84 c0                	test   %al,%al
+  800dbd:	75 74                	jne    800e33 <check_bitmap+0xd1>
+    assert(!block_is_free(0));
+  800dbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc4:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  800dcb:	00 00 00 
+  800dce:	ff d0                	call   *%rax
+  800dd0:	84 c0                	test   %al,%al
+  800dd2:	0f 85 90 00 00 00    	jne    800e68 <check_bitmap+0x106>
+
+    cprintf("bitmap is good\n");
+  800dd8:	48 bf 2c 6a 80 00 00 	movabs $0x806a2c,%rdi
+  800ddf:	00 00 00 
+  800de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de7:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  800dee:	00 00 00 
+  800df1:	ff d2                	call   *%rdx
+}
+  800df3:	48 83 c4 08          	add    $0x8,%rsp
+  800df7:	5b                   	pop    %rbx
+  800df8:	41 5c                	pop    %r12
+  800dfa:	41 5d                	pop    %r13
+  800dfc:	5d                   	pop    %rbp
+  800dfd:	c3                   	ret
+        assert(!block_is_free(2 + i));
+  800dfe:	48 b9 f2 69 80 00 00 	movabs $0x8069f2,%rcx
+  800e05:	00 00 00 
+  800e08:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800e0f:	00 00 00 
+  800e12:	be 5d 00 00 00       	mov    $0x5d,%esi
+  800e17:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800e1e:	00 00 00 
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e26:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800e2d:	00 00 00 
+  800e30:	41 ff d0             	call   *%r8
+    assert(!block_is_free(1));
+  800e33:	48 b9 08 6a 80 00 00 	movabs $0x806a08,%rcx
+  800e3a:	00 00 00 
+  800e3d:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800e44:	00 00 00 
+  800e47:	be 61 00 00 00       	mov    $0x61,%esi
+  800e4c:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800e53:	00 00 00 
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5b:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800e62:	00 00 00 
+  800e65:	41 ff d0             	call   *%r8
+    assert(!block_is_free(0));
+  800e68:	48 b9 1a 6a 80 00 00 	movabs $0x806a1a,%rcx
+  800e6f:	00 00 00 
+  800e72:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800e79:	00 00 00 
+  800e7c:	be 62 00 00 00       	mov    $0x62,%esi
+  800e81:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800e88:	00 00 00 
+  800e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e90:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800e97:	00 00 00 
+  800e9a:	41 ff d0             	call   *%r8
+
+0000000000800e9d <fs_init>:
+ *                    File system structures
+ ****************************************************************/
+
+/* Initialize the file system */
+void
+fs_init(void) {
+  800e9d:	55                   	push   %rbp
+  800e9e:	48 89 e5             	mov    %rsp,%rbp
+  800ea1:	53                   	push   %rbx
+  800ea2:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+
+    /* Find a JOS disk.  Use the second IDE disk (number 1) if availabl */
+    if (ide_probe_disk1())
+  800ea6:	48 b8 4c 00 80 00 00 	movabs $0x80004c,%rax
+  800ead:	00 00 00 
+  800eb0:	ff d0                	call   *%rax
+  800eb2:	84 c0                	test   %al,%al
+  800eb4:	74 67                	je     800f1d <fs_init+0x80>
+        ide_set_disk(1);
+  800eb6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ebb:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  800ec2:	00 00 00 
+  800ec5:	ff d0                	call   *%rax
+    else
+        ide_set_disk(0);
+    bc_init();
+  800ec7:	48 b8 9f 08 80 00 00 	movabs $0x80089f,%rax
+  800ece:	00 00 00 
+  800ed1:	ff d0                	call   *%rax
+
+    /* Set "super" to point to the super block. */
+    super = diskaddr(1);
+  800ed3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ed8:	48 bb 41 03 80 00 00 	movabs $0x800341,%rbx
+  800edf:	00 00 00 
+  800ee2:	ff d3                	call   *%rbx
+  800ee4:	48 a3 28 50 82 00 00 	movabs %rax,0x825028
+  800eeb:	00 00 00 
+    check_super();
+  800eee:	48 b8 37 0b 80 00 00 	movabs $0x800b37,%rax
+  800ef5:	00 00 00 
+  800ef8:	ff d0                	call   *%rax
+
+    /* Set "bitmap" to the beginning of the first bitmap block. */
+    bitmap = diskaddr(2);
+  800efa:	bf 02 00 00 00       	mov    $0x2,%edi
+  800eff:	ff d3                	call   *%rbx
+  800f01:	48 a3 20 50 82 00 00 	movabs %rax,0x825020
+  800f08:	00 00 00 
+
+    check_bitmap();
+  800f0b:	48 b8 62 0d 80 00 00 	movabs $0x800d62,%rax
+  800f12:	00 00 00 
+  800f15:	ff d0                	call   *%rax
+}
+  800f17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f1b:	c9                   	leave
+  800f1c:	c3                   	ret
+        ide_set_disk(0);
+  800f1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f22:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  800f29:	00 00 00 
+  800f2c:	ff d0                	call   *%rax
+  800f2e:	eb 97                	jmp    800ec7 <fs_init+0x2a>
+
+0000000000800f30 <file_block_walk>:
+ *  -E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+ *
+ * Analogy: This is like pgdir_walk for files.
+ * Hint: Don't forget to clear any block you allocate. */
+int
+file_block_walk(struct File *f, uint32_t filebno, blockno_t **ppdiskbno, bool alloc) {
+  800f30:	55                   	push   %rbp
+  800f31:	48 89 e5             	mov    %rsp,%rbp
+  800f34:	41 55                	push   %r13
+  800f36:	41 54                	push   %r12
+  800f38:	53                   	push   %rbx
+  800f39:	48 83 ec 08          	sub    $0x8,%rsp
+    // LAB 10: Your code here DONE
+
+    assert(f);
+  800f3d:	48 85 ff             	test   %rdi,%rdi
+  800f40:	74 73                	je     800fb5 <file_block_walk+0x85>
+  800f42:	49 89 fc             	mov    %rdi,%r12
+  800f45:	89 f3                	mov    %esi,%ebx
+  800f47:	49 89 d5             	mov    %rdx,%r13
+    assert(ppdiskbno);
+  800f4a:	48 85 d2             	test   %rdx,%rdx
+  800f4d:	0f 84 97 00 00 00    	je     800fea <file_block_walk+0xba>
+
+    if (filebno < NDIRECT) {
+  800f53:	83 fe 09             	cmp    $0x9,%esi
+  800f56:	0f 86 c3 00 00 00    	jbe    80101f <file_block_walk+0xef>
+        *ppdiskbno = &f->f_direct[filebno];
+
+        return 0;
+    }
+
+    if (filebno >= NDIRECT + NINDIRECT) {
+  800f5c:	81 fe 09 04 00 00    	cmp    $0x409,%esi
+  800f62:	0f 87 3c 01 00 00    	ja     8010a4 <file_block_walk+0x174>
+        return -E_INVAL;
+    }
+
+    if (alloc && !f->f_indirect) {
+  800f68:	84 c9                	test   %cl,%cl
+  800f6a:	0f 84 ec 00 00 00    	je     80105c <file_block_walk+0x12c>
+  800f70:	83 bf b0 00 00 00 00 	cmpl   $0x0,0xb0(%rdi)
+  800f77:	0f 84 b9 00 00 00    	je     801036 <file_block_walk+0x106>
+        if (!f->f_indirect) {
+            return -E_NO_DISK;
+        }
+    }
+
+    if (!f->f_indirect) {
+  800f7d:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  800f84:	00 
+        return -E_NOT_FOUND;
+    }
+
+    blockno_t *indirect_blocks = (blockno_t *)diskaddr(f->f_indirect);
+  800f85:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  800f8c:	00 00 00 
+  800f8f:	ff d0                	call   *%rax
+    assert(indirect_blocks);
+  800f91:	48 85 c0             	test   %rax,%rax
+  800f94:	0f 84 da 00 00 00    	je     801074 <file_block_walk+0x144>
+
+    *ppdiskbno = &indirect_blocks[filebno - NDIRECT];
+  800f9a:	8d 53 f6             	lea    -0xa(%rbx),%edx
+  800f9d:	48 8d 04 90          	lea    (%rax,%rdx,4),%rax
+  800fa1:	49 89 45 00          	mov    %rax,0x0(%r13)
+
+    return 0;
+  800fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800faa:	48 83 c4 08          	add    $0x8,%rsp
+  800fae:	5b                   	pop    %rbx
+  800faf:	41 5c                	pop    %r12
+  800fb1:	41 5d                	pop    %r13
+  800fb3:	5d                   	pop    %rbp
+  800fb4:	c3                   	ret
+    assert(f);
+  800fb5:	48 b9 0b 6e 80 00 00 	movabs $0x806e0b,%rcx
+  800fbc:	00 00 00 
+  800fbf:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800fc6:	00 00 00 
+  800fc9:	be 95 00 00 00       	mov    $0x95,%esi
+  800fce:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  800fd5:	00 00 00 
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  800fe4:	00 00 00 
+  800fe7:	41 ff d0             	call   *%r8
+    assert(ppdiskbno);
+  800fea:	48 b9 3c 6a 80 00 00 	movabs $0x806a3c,%rcx
+  800ff1:	00 00 00 
+  800ff4:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  800ffb:	00 00 00 
+  800ffe:	be 96 00 00 00       	mov    $0x96,%esi
+  801003:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  80100a:	00 00 00 
+  80100d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801012:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801019:	00 00 00 
+  80101c:	41 ff d0             	call   *%r8
+        *ppdiskbno = &f->f_direct[filebno];
+  80101f:	89 f3                	mov    %esi,%ebx
+  801021:	48 8d 84 9f 88 00 00 	lea    0x88(%rdi,%rbx,4),%rax
+  801028:	00 
+  801029:	48 89 02             	mov    %rax,(%rdx)
+        return 0;
+  80102c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801031:	e9 74 ff ff ff       	jmp    800faa <file_block_walk+0x7a>
+        f->f_indirect = alloc_block();
+  801036:	48 b8 5d 0c 80 00 00 	movabs $0x800c5d,%rax
+  80103d:	00 00 00 
+  801040:	ff d0                	call   *%rax
+  801042:	41 89 84 24 b0 00 00 	mov    %eax,0xb0(%r12)
+  801049:	00 
+        if (!f->f_indirect) {
+  80104a:	85 c0                	test   %eax,%eax
+  80104c:	0f 85 2b ff ff ff    	jne    800f7d <file_block_walk+0x4d>
+            return -E_NO_DISK;
+  801052:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801057:	e9 4e ff ff ff       	jmp    800faa <file_block_walk+0x7a>
+    if (!f->f_indirect) {
+  80105c:	8b bf b0 00 00 00    	mov    0xb0(%rdi),%edi
+  801062:	85 ff                	test   %edi,%edi
+  801064:	0f 85 1b ff ff ff    	jne    800f85 <file_block_walk+0x55>
+        return -E_NOT_FOUND;
+  80106a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80106f:	e9 36 ff ff ff       	jmp    800faa <file_block_walk+0x7a>
+    assert(indirect_blocks);
+  801074:	48 b9 46 6a 80 00 00 	movabs $0x806a46,%rcx
+  80107b:	00 00 00 
+  80107e:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801085:	00 00 00 
+  801088:	be af 00 00 00       	mov    $0xaf,%esi
+  80108d:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  801094:	00 00 00 
+  801097:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  80109e:	00 00 00 
+  8010a1:	41 ff d0             	call   *%r8
+        return -E_INVAL;
+  8010a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010a9:	e9 fc fe ff ff       	jmp    800faa <file_block_walk+0x7a>
+
+00000000008010ae <file_get_block>:
+ *  -E_NO_DISK if a block needed to be allocated but the disk is full.
+ *  -E_INVAL if filebno is out of range.
+ *
+ * Hint: Use file_block_walk and alloc_block. */
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk) {
+  8010ae:	55                   	push   %rbp
+  8010af:	48 89 e5             	mov    %rsp,%rbp
+  8010b2:	41 54                	push   %r12
+  8010b4:	53                   	push   %rbx
+  8010b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8010b9:	48 89 d3             	mov    %rdx,%rbx
+    // LAB 10: Your code here DONE
+    int res = 0;
+    blockno_t *blockno = NULL;
+  8010bc:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8010c3:	00 
+
+    res = file_block_walk(f, filebno, &blockno, true);
+  8010c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8010c9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8010cd:	48 b8 30 0f 80 00 00 	movabs $0x800f30,%rax
+  8010d4:	00 00 00 
+  8010d7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	78 3c                	js     801119 <file_get_block+0x6b>
+        return res;
+    }
+    assert(blockno);
+  8010dd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8010e1:	4d 85 e4             	test   %r12,%r12
+  8010e4:	74 3c                	je     801122 <file_get_block+0x74>
+
+    if (!*blockno) {
+  8010e6:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8010eb:	75 14                	jne    801101 <file_get_block+0x53>
+        *blockno = alloc_block();
+  8010ed:	48 b8 5d 0c 80 00 00 	movabs $0x800c5d,%rax
+  8010f4:	00 00 00 
+  8010f7:	ff d0                	call   *%rax
+  8010f9:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (!*blockno) {
+  8010fd:	85 c0                	test   %eax,%eax
+  8010ff:	74 56                	je     801157 <file_get_block+0xa9>
+            return -E_NO_DISK;
+        }
+    }
+
+    *blk = diskaddr(*blockno);
+  801101:	41 8b 3c 24          	mov    (%r12),%edi
+  801105:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  80110c:	00 00 00 
+  80110f:	ff d0                	call   *%rax
+  801111:	48 89 03             	mov    %rax,(%rbx)
+
+    return 0;
+  801114:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801119:	48 83 c4 10          	add    $0x10,%rsp
+  80111d:	5b                   	pop    %rbx
+  80111e:	41 5c                	pop    %r12
+  801120:	5d                   	pop    %rbp
+  801121:	c3                   	ret
+    assert(blockno);
+  801122:	48 b9 56 6a 80 00 00 	movabs $0x806a56,%rcx
+  801129:	00 00 00 
+  80112c:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801133:	00 00 00 
+  801136:	be c8 00 00 00       	mov    $0xc8,%esi
+  80113b:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  801142:	00 00 00 
+  801145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114a:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801151:	00 00 00 
+  801154:	41 ff d0             	call   *%r8
+            return -E_NO_DISK;
+  801157:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80115c:	eb bb                	jmp    801119 <file_get_block+0x6b>
+
+000000000080115e <walk_path>:
+ * and set *pdir to the directory the file is in.
+ * If we cannot find the file but find the directory
+ * it should be in, set *pdir and copy the final path
+ * element into lastelem. */
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  80115e:	55                   	push   %rbp
+  80115f:	48 89 e5             	mov    %rsp,%rbp
+  801162:	41 57                	push   %r15
+  801164:	41 56                	push   %r14
+  801166:	41 55                	push   %r13
+  801168:	41 54                	push   %r12
+  80116a:	53                   	push   %rbx
+  80116b:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  801172:	48 89 d3             	mov    %rdx,%rbx
+  801175:	49 89 cd             	mov    %rcx,%r13
+    while (*p == '/')
+  801178:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  80117b:	75 09                	jne    801186 <walk_path+0x28>
+        p++;
+  80117d:	48 83 c7 01          	add    $0x1,%rdi
+    while (*p == '/')
+  801181:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  801184:	74 f7                	je     80117d <walk_path+0x1f>
+    int r;
+
+    //if (*path != '/')
+    //    return -E_BAD_PATH;
+    path = skip_slash(path);
+    f = &super->s_root;
+  801186:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  80118d:	00 00 00 
+  801190:	4c 8d 78 08          	lea    0x8(%rax),%r15
+    dir = 0;
+    name[0] = 0;
+  801194:	c6 85 50 ff ff ff 00 	movb   $0x0,-0xb0(%rbp)
+
+    if (pdir)
+  80119b:	48 85 f6             	test   %rsi,%rsi
+  80119e:	74 07                	je     8011a7 <walk_path+0x49>
+        *pdir = 0;
+  8011a0:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *pf = 0;
+  8011a7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+    dir = 0;
+  8011ae:	ba 00 00 00 00       	mov    $0x0,%edx
+            if (strcmp(f[j].f_name, name) == 0) {
+  8011b3:	49 be 4f 3b 80 00 00 	movabs $0x803b4f,%r14
+  8011ba:	00 00 00 
+  8011bd:	48 89 b5 18 ff ff ff 	mov    %rsi,-0xe8(%rbp)
+  8011c4:	48 89 fe             	mov    %rdi,%rsi
+  8011c7:	4c 89 ad 10 ff ff ff 	mov    %r13,-0xf0(%rbp)
+    while (*path != '\0') {
+  8011ce:	e9 90 00 00 00       	jmp    801263 <walk_path+0x105>
+        dir = f;
+        p = path;
+        while (*path != '/' && *path != '\0')
+  8011d3:	49 89 f4             	mov    %rsi,%r12
+            path++;
+        if (path - p >= MAXNAMELEN)
+  8011d6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8011dc:	e9 b9 00 00 00       	jmp    80129a <walk_path+0x13c>
+    while (*p == '/')
+  8011e1:	4c 89 e6             	mov    %r12,%rsi
+  8011e4:	e9 e9 00 00 00       	jmp    8012d2 <walk_path+0x174>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8011e9:	48 b9 5e 6a 80 00 00 	movabs $0x806a5e,%rcx
+  8011f0:	00 00 00 
+  8011f3:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  8011fa:	00 00 00 
+  8011fd:	be e0 00 00 00       	mov    $0xe0,%esi
+  801202:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  801209:	00 00 00 
+  80120c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801211:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801218:	00 00 00 
+  80121b:	41 ff d0             	call   *%r8
+  80121e:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  801225:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  80122c:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+  801233:	eb 1c                	jmp    801251 <walk_path+0xf3>
+    for (blockno_t i = 0; i < nblock; i++) {
+  801235:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  80123c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801241:	eb 0e                	jmp    801251 <walk_path+0xf3>
+  801243:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  80124a:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  801251:	4c 89 fa             	mov    %r15,%rdx
+        path = skip_slash(path);
+
+        if (dir->f_type != FTYPE_DIR)
+            return -E_NOT_FOUND;
+
+        if ((r = dir_lookup(dir, name, &f)) < 0) {
+  801254:	85 c0                	test   %eax,%eax
+  801256:	0f 88 48 01 00 00    	js     8013a4 <walk_path+0x246>
+  80125c:	4c 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%r15
+    while (*path != '\0') {
+  801263:	0f b6 06             	movzbl (%rsi),%eax
+  801266:	84 c0                	test   %al,%al
+  801268:	0f 84 80 01 00 00    	je     8013ee <walk_path+0x290>
+        while (*path != '/' && *path != '\0')
+  80126e:	3c 2f                	cmp    $0x2f,%al
+  801270:	0f 84 5d ff ff ff    	je     8011d3 <walk_path+0x75>
+  801276:	49 89 f4             	mov    %rsi,%r12
+            path++;
+  801279:	49 83 c4 01          	add    $0x1,%r12
+        while (*path != '/' && *path != '\0')
+  80127d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801282:	3c 2f                	cmp    $0x2f,%al
+  801284:	74 04                	je     80128a <walk_path+0x12c>
+  801286:	84 c0                	test   %al,%al
+  801288:	75 ef                	jne    801279 <walk_path+0x11b>
+        if (path - p >= MAXNAMELEN)
+  80128a:	4d 89 e5             	mov    %r12,%r13
+  80128d:	49 29 f5             	sub    %rsi,%r13
+  801290:	49 83 fd 7f          	cmp    $0x7f,%r13
+  801294:	0f 8f 81 01 00 00    	jg     80141b <walk_path+0x2bd>
+        memmove(name, p, path - p);
+  80129a:	4c 89 ea             	mov    %r13,%rdx
+  80129d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8012a4:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  8012ab:	00 00 00 
+  8012ae:	ff d0                	call   *%rax
+        name[path - p] = '\0';
+  8012b0:	42 c6 84 2d 50 ff ff 	movb   $0x0,-0xb0(%rbp,%r13,1)
+  8012b7:	ff 00 
+    while (*p == '/')
+  8012b9:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  8012be:	0f 85 1d ff ff ff    	jne    8011e1 <walk_path+0x83>
+        p++;
+  8012c4:	49 83 c4 01          	add    $0x1,%r12
+    while (*p == '/')
+  8012c8:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  8012cd:	74 f5                	je     8012c4 <walk_path+0x166>
+        p++;
+  8012cf:	4c 89 e6             	mov    %r12,%rsi
+        if (dir->f_type != FTYPE_DIR)
+  8012d2:	41 83 bf 84 00 00 00 	cmpl   $0x1,0x84(%r15)
+  8012d9:	01 
+  8012da:	0f 85 43 01 00 00    	jne    801423 <walk_path+0x2c5>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8012e0:	41 8b 97 80 00 00 00 	mov    0x80(%r15),%edx
+  8012e7:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  8012ed:	0f 85 f6 fe ff ff    	jne    8011e9 <walk_path+0x8b>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  8012f3:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  8012f9:	85 d2                	test   %edx,%edx
+  8012fb:	0f 49 c2             	cmovns %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  8012fe:	c1 f8 0c             	sar    $0xc,%eax
+  801301:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%rbp)
+  801307:	0f 84 28 ff ff ff    	je     801235 <walk_path+0xd7>
+  80130d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            if (strcmp(f[j].f_name, name) == 0) {
+  801313:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+  80131a:	48 89 9d 20 ff ff ff 	mov    %rbx,-0xe0(%rbp)
+        int res = file_get_block(dir, i, &blk);
+  801321:	48 8d 95 48 ff ff ff 	lea    -0xb8(%rbp),%rdx
+  801328:	44 89 e6             	mov    %r12d,%esi
+  80132b:	4c 89 ff             	mov    %r15,%rdi
+  80132e:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  801335:	00 00 00 
+  801338:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80133a:	85 c0                	test   %eax,%eax
+  80133c:	0f 88 dc fe ff ff    	js     80121e <walk_path+0xc0>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  801342:	48 8b 9d 48 ff ff ff 	mov    -0xb8(%rbp),%rbx
+  801349:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+            if (strcmp(f[j].f_name, name) == 0) {
+  801350:	48 89 9d 38 ff ff ff 	mov    %rbx,-0xc8(%rbp)
+  801357:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  80135e:	48 89 df             	mov    %rbx,%rdi
+  801361:	41 ff d6             	call   *%r14
+  801364:	85 c0                	test   %eax,%eax
+  801366:	0f 84 d7 fe ff ff    	je     801243 <walk_path+0xe5>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  80136c:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  801373:	4c 39 eb             	cmp    %r13,%rbx
+  801376:	75 d8                	jne    801350 <walk_path+0x1f2>
+    for (blockno_t i = 0; i < nblock; i++) {
+  801378:	41 83 c4 01          	add    $0x1,%r12d
+  80137c:	44 39 a5 34 ff ff ff 	cmp    %r12d,-0xcc(%rbp)
+  801383:	75 9c                	jne    801321 <walk_path+0x1c3>
+  801385:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  80138c:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  801393:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  80139a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80139f:	e9 ad fe ff ff       	jmp    801251 <walk_path+0xf3>
+            if (r == -E_NOT_FOUND && *path == '\0') {
+  8013a4:	41 89 c4             	mov    %eax,%r12d
+  8013a7:	48 89 f7             	mov    %rsi,%rdi
+  8013aa:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  8013b1:	4c 8b ad 10 ff ff ff 	mov    -0xf0(%rbp),%r13
+  8013b8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013bb:	75 49                	jne    801406 <walk_path+0x2a8>
+  8013bd:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8013c0:	75 44                	jne    801406 <walk_path+0x2a8>
+                if (pdir)
+  8013c2:	48 85 f6             	test   %rsi,%rsi
+  8013c5:	74 03                	je     8013ca <walk_path+0x26c>
+                    *pdir = dir;
+  8013c7:	4c 89 3e             	mov    %r15,(%rsi)
+                if (lastelem)
+  8013ca:	4d 85 ed             	test   %r13,%r13
+  8013cd:	74 16                	je     8013e5 <walk_path+0x287>
+                    strcpy(lastelem, name);
+  8013cf:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8013d6:	4c 89 ef             	mov    %r13,%rdi
+  8013d9:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  8013e0:	00 00 00 
+  8013e3:	ff d0                	call   *%rax
+                *pf = 0;
+  8013e5:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8013ec:	eb 18                	jmp    801406 <walk_path+0x2a8>
+            }
+            return r;
+        }
+    }
+
+    if (pdir)
+  8013ee:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  8013f5:	48 85 f6             	test   %rsi,%rsi
+  8013f8:	74 03                	je     8013fd <walk_path+0x29f>
+        *pdir = dir;
+  8013fa:	48 89 16             	mov    %rdx,(%rsi)
+    *pf = f;
+  8013fd:	4c 89 3b             	mov    %r15,(%rbx)
+    return 0;
+  801400:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+}
+  801406:	44 89 e0             	mov    %r12d,%eax
+  801409:	48 81 c4 c8 00 00 00 	add    $0xc8,%rsp
+  801410:	5b                   	pop    %rbx
+  801411:	41 5c                	pop    %r12
+  801413:	41 5d                	pop    %r13
+  801415:	41 5e                	pop    %r14
+  801417:	41 5f                	pop    %r15
+  801419:	5d                   	pop    %rbp
+  80141a:	c3                   	ret
+            return -E_BAD_PATH;
+  80141b:	41 bc f0 ff ff ff    	mov    $0xfffffff0,%r12d
+  801421:	eb e3                	jmp    801406 <walk_path+0x2a8>
+            return -E_NOT_FOUND;
+  801423:	41 bc f1 ff ff ff    	mov    $0xfffffff1,%r12d
+  801429:	eb db                	jmp    801406 <walk_path+0x2a8>
+
+000000000080142b <file_open>:
+}
+
+/* Open "path".  On success set *pf to point at the file and return 0.
+ * On error return < 0. */
+int
+file_open(const char *path, struct File **pf) {
+  80142b:	55                   	push   %rbp
+  80142c:	48 89 e5             	mov    %rsp,%rbp
+  80142f:	48 89 f2             	mov    %rsi,%rdx
+    return walk_path(path, 0, pf, 0);
+  801432:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  801443:	00 00 00 
+  801446:	ff d0                	call   *%rax
+}
+  801448:	5d                   	pop    %rbp
+  801449:	c3                   	ret
+
+000000000080144a <file_read>:
+
+/* Read count bytes from f into buf, starting from seek position
+ * offset.  This meant to mimic the standard pread function.
+ * Returns the number of bytes read, < 0 on error. */
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	41 57                	push   %r15
+  801450:	41 56                	push   %r14
+  801452:	41 55                	push   %r13
+  801454:	41 54                	push   %r12
+  801456:	53                   	push   %rbx
+  801457:	48 83 ec 28          	sub    $0x28,%rsp
+  80145b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80145f:	89 cb                	mov    %ecx,%ebx
+    char *blk;
+
+    if (offset >= f->f_size)
+  801461:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+        return 0;
+  801467:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (offset >= f->f_size)
+  80146c:	39 d9                	cmp    %ebx,%ecx
+  80146e:	0f 8e 9c 00 00 00    	jle    801510 <file_read+0xc6>
+  801474:	49 89 f5             	mov    %rsi,%r13
+
+    count = MIN(count, f->f_size - offset);
+  801477:	29 d9                	sub    %ebx,%ecx
+  801479:	48 63 c9             	movslq %ecx,%rcx
+  80147c:	48 39 d1             	cmp    %rdx,%rcx
+  80147f:	48 0f 46 d1          	cmovbe %rcx,%rdx
+  801483:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+
+    for (off_t pos = offset; pos < offset + count;) {
+  801487:	4c 63 f3             	movslq %ebx,%r14
+  80148a:	4e 8d 3c 32          	lea    (%rdx,%r14,1),%r15
+  80148e:	4d 39 fe             	cmp    %r15,%r14
+  801491:	73 79                	jae    80150c <file_read+0xc2>
+        int r = file_get_block(f, pos / BLKSIZE, &blk);
+  801493:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801499:	85 db                	test   %ebx,%ebx
+  80149b:	0f 49 f3             	cmovns %ebx,%esi
+  80149e:	c1 fe 0c             	sar    $0xc,%esi
+  8014a1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8014a5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8014a9:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  8014b0:	00 00 00 
+  8014b3:	ff d0                	call   *%rax
+        if (r < 0) return r;
+  8014b5:	85 c0                	test   %eax,%eax
+  8014b7:	78 66                	js     80151f <file_read+0xd5>
+
+        int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  8014b9:	89 d8                	mov    %ebx,%eax
+  8014bb:	c1 f8 1f             	sar    $0x1f,%eax
+  8014be:	c1 e8 14             	shr    $0x14,%eax
+  8014c1:	8d 34 03             	lea    (%rbx,%rax,1),%esi
+  8014c4:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8014ca:	29 c6                	sub    %eax,%esi
+  8014cc:	48 63 f6             	movslq %esi,%rsi
+  8014cf:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  8014d5:	49 29 f4             	sub    %rsi,%r12
+  8014d8:	4c 89 f8             	mov    %r15,%rax
+  8014db:	4c 29 f0             	sub    %r14,%rax
+  8014de:	49 39 c4             	cmp    %rax,%r12
+  8014e1:	4c 0f 47 e0          	cmova  %rax,%r12
+        memmove(buf, blk + pos % BLKSIZE, bn);
+  8014e5:	4d 63 f4             	movslq %r12d,%r14
+  8014e8:	48 03 75 c8          	add    -0x38(%rbp),%rsi
+  8014ec:	4c 89 f2             	mov    %r14,%rdx
+  8014ef:	4c 89 ef             	mov    %r13,%rdi
+  8014f2:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  8014f9:	00 00 00 
+  8014fc:	ff d0                	call   *%rax
+        pos += bn;
+  8014fe:	44 01 e3             	add    %r12d,%ebx
+        buf += bn;
+  801501:	4d 01 f5             	add    %r14,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  801504:	4c 63 f3             	movslq %ebx,%r14
+  801507:	4d 39 fe             	cmp    %r15,%r14
+  80150a:	72 87                	jb     801493 <file_read+0x49>
+    }
+
+    return count;
+  80150c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  801510:	48 83 c4 28          	add    $0x28,%rsp
+  801514:	5b                   	pop    %rbx
+  801515:	41 5c                	pop    %r12
+  801517:	41 5d                	pop    %r13
+  801519:	41 5e                	pop    %r14
+  80151b:	41 5f                	pop    %r15
+  80151d:	5d                   	pop    %rbp
+  80151e:	c3                   	ret
+        if (r < 0) return r;
+  80151f:	48 98                	cltq
+  801521:	eb ed                	jmp    801510 <file_read+0xc6>
+
+0000000000801523 <file_set_size>:
+    }
+}
+
+/* Set the size of file f, truncating or extending as necessary. */
+int
+file_set_size(struct File *f, off_t newsize) {
+  801523:	55                   	push   %rbp
+  801524:	48 89 e5             	mov    %rsp,%rbp
+  801527:	41 57                	push   %r15
+  801529:	41 56                	push   %r14
+  80152b:	41 55                	push   %r13
+  80152d:	41 54                	push   %r12
+  80152f:	53                   	push   %rbx
+  801530:	48 83 ec 28          	sub    $0x28,%rsp
+  801534:	49 89 fc             	mov    %rdi,%r12
+  801537:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    if (f->f_size > newsize)
+  80153a:	8b 87 80 00 00 00    	mov    0x80(%rdi),%eax
+  801540:	39 f0                	cmp    %esi,%eax
+  801542:	7f 37                	jg     80157b <file_set_size+0x58>
+        file_truncate_blocks(f, newsize);
+    f->f_size = newsize;
+  801544:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801547:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80154e:	00 
+    f->f_version++;
+  80154f:	41 83 84 24 b4 00 00 	addl   $0x1,0xb4(%r12)
+  801556:	00 01 
+    flush_block(f);
+  801558:	4c 89 e7             	mov    %r12,%rdi
+  80155b:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  801562:	00 00 00 
+  801565:	ff d0                	call   *%rax
+    return 0;
+}
+  801567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156c:	48 83 c4 28          	add    $0x28,%rsp
+  801570:	5b                   	pop    %rbx
+  801571:	41 5c                	pop    %r12
+  801573:	41 5d                	pop    %r13
+  801575:	41 5e                	pop    %r14
+  801577:	41 5f                	pop    %r15
+  801579:	5d                   	pop    %rbp
+  80157a:	c3                   	ret
+    blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
+  80157b:	48 98                	cltq
+  80157d:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801583:	48 c1 e8 0c          	shr    $0xc,%rax
+  801587:	41 89 c6             	mov    %eax,%r14d
+    blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+  80158a:	48 63 d6             	movslq %esi,%rdx
+  80158d:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801594:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801598:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  80159c:	39 c2                	cmp    %eax,%edx
+  80159e:	73 0e                	jae    8015ae <file_set_size+0x8b>
+  8015a0:	89 d3                	mov    %edx,%ebx
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  8015a2:	49 bf 30 0f 80 00 00 	movabs $0x800f30,%r15
+  8015a9:	00 00 00 
+  8015ac:	eb 54                	jmp    801602 <file_set_size+0xdf>
+    if (new_nblocks <= NDIRECT && f->f_indirect) {
+  8015ae:	83 7d b0 0a          	cmpl   $0xa,-0x50(%rbp)
+  8015b2:	77 90                	ja     801544 <file_set_size+0x21>
+  8015b4:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  8015bb:	00 
+  8015bc:	85 ff                	test   %edi,%edi
+  8015be:	74 84                	je     801544 <file_set_size+0x21>
+        free_block(f->f_indirect);
+  8015c0:	48 b8 0d 0c 80 00 00 	movabs $0x800c0d,%rax
+  8015c7:	00 00 00 
+  8015ca:	ff d0                	call   *%rax
+        f->f_indirect = 0;
+  8015cc:	41 c7 84 24 b0 00 00 	movl   $0x0,0xb0(%r12)
+  8015d3:	00 00 00 00 00 
+  8015d8:	e9 67 ff ff ff       	jmp    801544 <file_set_size+0x21>
+        if (res < 0) cprintf("warning: file_free_block: %i", res);
+  8015dd:	89 c6                	mov    %eax,%esi
+  8015df:	48 bf 7b 6a 80 00 00 	movabs $0x806a7b,%rdi
+  8015e6:	00 00 00 
+  8015e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ee:	48 b9 56 31 80 00 00 	movabs $0x803156,%rcx
+  8015f5:	00 00 00 
+  8015f8:	ff d1                	call   *%rcx
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  8015fa:	83 c3 01             	add    $0x1,%ebx
+  8015fd:	44 39 f3             	cmp    %r14d,%ebx
+  801600:	73 ac                	jae    8015ae <file_set_size+0x8b>
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  801602:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801607:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80160b:	89 de                	mov    %ebx,%esi
+  80160d:	4c 89 e7             	mov    %r12,%rdi
+  801610:	41 ff d7             	call   *%r15
+    if (res < 0) return res;
+  801613:	85 c0                	test   %eax,%eax
+  801615:	78 c6                	js     8015dd <file_set_size+0xba>
+    if (*ptr) {
+  801617:	4c 8b 6d c8          	mov    -0x38(%rbp),%r13
+  80161b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80161f:	85 ff                	test   %edi,%edi
+  801621:	74 d7                	je     8015fa <file_set_size+0xd7>
+        free_block(*ptr);
+  801623:	48 b8 0d 0c 80 00 00 	movabs $0x800c0d,%rax
+  80162a:	00 00 00 
+  80162d:	ff d0                	call   *%rax
+        *ptr = 0;
+  80162f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801636:	00 
+  801637:	eb c1                	jmp    8015fa <file_set_size+0xd7>
+
+0000000000801639 <file_write>:
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+  801639:	55                   	push   %rbp
+  80163a:	48 89 e5             	mov    %rsp,%rbp
+  80163d:	41 57                	push   %r15
+  80163f:	41 56                	push   %r14
+  801641:	41 55                	push   %r13
+  801643:	41 54                	push   %r12
+  801645:	53                   	push   %rbx
+  801646:	48 83 ec 28          	sub    $0x28,%rsp
+  80164a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80164e:	49 89 f5             	mov    %rsi,%r13
+  801651:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801655:	89 cb                	mov    %ecx,%ebx
+    if (offset + count > f->f_size)
+  801657:	4c 63 e1             	movslq %ecx,%r12
+  80165a:	4d 8d 34 14          	lea    (%r12,%rdx,1),%r14
+  80165e:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  801665:	4c 39 f0             	cmp    %r14,%rax
+  801668:	0f 82 a7 00 00 00    	jb     801715 <file_write+0xdc>
+    f->f_version++;
+  80166e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801672:	83 80 b4 00 00 00 01 	addl   $0x1,0xb4(%rax)
+    for (off_t pos = offset; pos < offset + count;) {
+  801679:	4d 39 f4             	cmp    %r14,%r12
+  80167c:	0f 83 80 00 00 00    	jae    801702 <file_write+0xc9>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  801682:	49 bf ae 10 80 00 00 	movabs $0x8010ae,%r15
+  801689:	00 00 00 
+  80168c:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  801692:	85 db                	test   %ebx,%ebx
+  801694:	0f 49 f3             	cmovns %ebx,%esi
+  801697:	c1 fe 0c             	sar    $0xc,%esi
+  80169a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80169e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8016a2:	41 ff d7             	call   *%r15
+  8016a5:	85 c0                	test   %eax,%eax
+  8016a7:	0f 88 86 00 00 00    	js     801733 <file_write+0xfa>
+        uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  8016ad:	89 d8                	mov    %ebx,%eax
+  8016af:	c1 f8 1f             	sar    $0x1f,%eax
+  8016b2:	c1 e8 14             	shr    $0x14,%eax
+  8016b5:	8d 3c 03             	lea    (%rbx,%rax,1),%edi
+  8016b8:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8016be:	29 c7                	sub    %eax,%edi
+  8016c0:	48 63 ff             	movslq %edi,%rdi
+  8016c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016c8:	48 29 fa             	sub    %rdi,%rdx
+  8016cb:	4c 89 f0             	mov    %r14,%rax
+  8016ce:	4c 29 e0             	sub    %r12,%rax
+  8016d1:	48 39 c2             	cmp    %rax,%rdx
+  8016d4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8016d8:	49 89 c4             	mov    %rax,%r12
+        memmove(blk + pos % BLKSIZE, buf, bn);
+  8016db:	48 03 7d c8          	add    -0x38(%rbp),%rdi
+  8016df:	48 89 c2             	mov    %rax,%rdx
+  8016e2:	4c 89 ee             	mov    %r13,%rsi
+  8016e5:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  8016ec:	00 00 00 
+  8016ef:	ff d0                	call   *%rax
+        pos += bn;
+  8016f1:	42 8d 04 23          	lea    (%rbx,%r12,1),%eax
+  8016f5:	89 c3                	mov    %eax,%ebx
+        buf += bn;
+  8016f7:	4d 01 e5             	add    %r12,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  8016fa:	4c 63 e0             	movslq %eax,%r12
+  8016fd:	4d 39 f4             	cmp    %r14,%r12
+  801700:	72 8a                	jb     80168c <file_write+0x53>
+    return count;
+  801702:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  801706:	48 83 c4 28          	add    $0x28,%rsp
+  80170a:	5b                   	pop    %rbx
+  80170b:	41 5c                	pop    %r12
+  80170d:	41 5d                	pop    %r13
+  80170f:	41 5e                	pop    %r14
+  801711:	41 5f                	pop    %r15
+  801713:	5d                   	pop    %rbp
+  801714:	c3                   	ret
+        if ((res = file_set_size(f, offset + count)) < 0) return res;
+  801715:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  801718:	8d 34 01             	lea    (%rcx,%rax,1),%esi
+  80171b:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  801722:	00 00 00 
+  801725:	ff d0                	call   *%rax
+  801727:	85 c0                	test   %eax,%eax
+  801729:	0f 89 3f ff ff ff    	jns    80166e <file_write+0x35>
+  80172f:	48 98                	cltq
+  801731:	eb d3                	jmp    801706 <file_write+0xcd>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  801733:	48 98                	cltq
+  801735:	eb cf                	jmp    801706 <file_write+0xcd>
+
+0000000000801737 <file_flush>:
+/* Flush the contents and metadata of file f out to disk.
+ * Loop over all the blocks in file.
+ * Translate the file block number into a disk block number
+ * and then check whether that disk block is dirty.  If so, write it out. */
+void
+file_flush(struct File *f) {
+  801737:	55                   	push   %rbp
+  801738:	48 89 e5             	mov    %rsp,%rbp
+  80173b:	41 57                	push   %r15
+  80173d:	41 56                	push   %r14
+  80173f:	41 55                	push   %r13
+  801741:	41 54                	push   %r12
+  801743:	53                   	push   %rbx
+  801744:	48 83 ec 18          	sub    $0x18,%rsp
+  801748:	49 89 fc             	mov    %rdi,%r12
+    blockno_t *pdiskbno;
+
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  80174b:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  801752:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801758:	48 c1 e8 0c          	shr    $0xc,%rax
+  80175c:	85 c0                	test   %eax,%eax
+  80175e:	74 6d                	je     8017cd <file_flush+0x96>
+  801760:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  801765:	49 bd 30 0f 80 00 00 	movabs $0x800f30,%r13
+  80176c:	00 00 00 
+            pdiskbno == NULL || *pdiskbno == 0)
+            continue;
+        flush_block(diskaddr(*pdiskbno));
+  80176f:	49 bf 41 03 80 00 00 	movabs $0x800341,%r15
+  801776:	00 00 00 
+  801779:	49 be 59 06 80 00 00 	movabs $0x800659,%r14
+  801780:	00 00 00 
+  801783:	eb 19                	jmp    80179e <file_flush+0x67>
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  801785:	83 c3 01             	add    $0x1,%ebx
+  801788:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  80178f:	00 
+  801790:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801796:	48 c1 e8 0c          	shr    $0xc,%rax
+  80179a:	39 c3                	cmp    %eax,%ebx
+  80179c:	73 2f                	jae    8017cd <file_flush+0x96>
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  80179e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a3:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8017a7:	89 de                	mov    %ebx,%esi
+  8017a9:	4c 89 e7             	mov    %r12,%rdi
+  8017ac:	41 ff d5             	call   *%r13
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 d2                	js     801785 <file_flush+0x4e>
+            pdiskbno == NULL || *pdiskbno == 0)
+  8017b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  8017b7:	48 85 c0             	test   %rax,%rax
+  8017ba:	74 c9                	je     801785 <file_flush+0x4e>
+            pdiskbno == NULL || *pdiskbno == 0)
+  8017bc:	8b 38                	mov    (%rax),%edi
+  8017be:	85 ff                	test   %edi,%edi
+  8017c0:	74 c3                	je     801785 <file_flush+0x4e>
+        flush_block(diskaddr(*pdiskbno));
+  8017c2:	41 ff d7             	call   *%r15
+  8017c5:	48 89 c7             	mov    %rax,%rdi
+  8017c8:	41 ff d6             	call   *%r14
+  8017cb:	eb b8                	jmp    801785 <file_flush+0x4e>
+    }
+    if (f->f_indirect)
+  8017cd:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  8017d4:	00 
+  8017d5:	85 ff                	test   %edi,%edi
+  8017d7:	75 1e                	jne    8017f7 <file_flush+0xc0>
+        flush_block(diskaddr(f->f_indirect));
+    flush_block(f);
+  8017d9:	4c 89 e7             	mov    %r12,%rdi
+  8017dc:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  8017e3:	00 00 00 
+  8017e6:	ff d0                	call   *%rax
+}
+  8017e8:	48 83 c4 18          	add    $0x18,%rsp
+  8017ec:	5b                   	pop    %rbx
+  8017ed:	41 5c                	pop    %r12
+  8017ef:	41 5d                	pop    %r13
+  8017f1:	41 5e                	pop    %r14
+  8017f3:	41 5f                	pop    %r15
+  8017f5:	5d                   	pop    %rbp
+  8017f6:	c3                   	ret
+        flush_block(diskaddr(f->f_indirect));
+  8017f7:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  8017fe:	00 00 00 
+  801801:	ff d0                	call   *%rax
+  801803:	48 89 c7             	mov    %rax,%rdi
+  801806:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  80180d:	00 00 00 
+  801810:	ff d0                	call   *%rax
+  801812:	eb c5                	jmp    8017d9 <file_flush+0xa2>
+
+0000000000801814 <file_create>:
+file_create(const char *path, struct File **pf) {
+  801814:	55                   	push   %rbp
+  801815:	48 89 e5             	mov    %rsp,%rbp
+  801818:	41 57                	push   %r15
+  80181a:	41 56                	push   %r14
+  80181c:	41 55                	push   %r13
+  80181e:	41 54                	push   %r12
+  801820:	53                   	push   %rbx
+  801821:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  801828:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  80182f:	48 8d 8d 50 ff ff ff 	lea    -0xb0(%rbp),%rcx
+  801836:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  80183d:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  801844:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  80184b:	00 00 00 
+  80184e:	ff d0                	call   *%rax
+  801850:	85 c0                	test   %eax,%eax
+  801852:	0f 84 55 01 00 00    	je     8019ad <file_create+0x199>
+  801858:	89 c3                	mov    %eax,%ebx
+    if (res != -E_NOT_FOUND || dir == 0) return res;
+  80185a:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80185d:	0f 85 fd 00 00 00    	jne    801960 <file_create+0x14c>
+  801863:	4c 8b ad 48 ff ff ff 	mov    -0xb8(%rbp),%r13
+  80186a:	4d 85 ed             	test   %r13,%r13
+  80186d:	0f 84 ed 00 00 00    	je     801960 <file_create+0x14c>
+    assert((dir->f_size % BLKSIZE) == 0);
+  801873:	41 8b 85 80 00 00 00 	mov    0x80(%r13),%eax
+  80187a:	89 c3                	mov    %eax,%ebx
+  80187c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  801882:	0f 85 ec 00 00 00    	jne    801974 <file_create+0x160>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  801888:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	0f 48 c2             	cmovs  %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  801893:	c1 f8 0c             	sar    $0xc,%eax
+  801896:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%rbp)
+  80189c:	74 56                	je     8018f4 <file_create+0xe0>
+  80189e:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        int res = file_get_block(dir, i, &blk);
+  8018a4:	49 bf ae 10 80 00 00 	movabs $0x8010ae,%r15
+  8018ab:	00 00 00 
+  8018ae:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  8018b5:	44 89 f6             	mov    %r14d,%esi
+  8018b8:	4c 89 ef             	mov    %r13,%rdi
+  8018bb:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	0f 88 e3 00 00 00    	js     8019a9 <file_create+0x195>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  8018c6:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  8018cd:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+            if (f[j].f_name[0] == '\0') {
+  8018d4:	49 89 c4             	mov    %rax,%r12
+  8018d7:	80 38 00             	cmpb   $0x0,(%rax)
+  8018da:	74 4e                	je     80192a <file_create+0x116>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  8018dc:	48 05 00 01 00 00    	add    $0x100,%rax
+  8018e2:	48 39 d0             	cmp    %rdx,%rax
+  8018e5:	75 ed                	jne    8018d4 <file_create+0xc0>
+    for (blockno_t i = 0; i < nblock; i++) {
+  8018e7:	41 83 c6 01          	add    $0x1,%r14d
+  8018eb:	44 39 b5 24 ff ff ff 	cmp    %r14d,-0xdc(%rbp)
+  8018f2:	75 ba                	jne    8018ae <file_create+0x9a>
+    dir->f_size += BLKSIZE;
+  8018f4:	41 81 85 80 00 00 00 	addl   $0x1000,0x80(%r13)
+  8018fb:	00 10 00 00 
+    int res = file_get_block(dir, nblock, &blk);
+  8018ff:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  801906:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80190c:	4c 89 ef             	mov    %r13,%rdi
+  80190f:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	0f 88 91 00 00 00    	js     8019b4 <file_create+0x1a0>
+    *file = (struct File *)blk;
+  801923:	4c 8b a5 38 ff ff ff 	mov    -0xc8(%rbp),%r12
+  80192a:	4c 89 a5 40 ff ff ff 	mov    %r12,-0xc0(%rbp)
+    strcpy(filp->f_name, name);
+  801931:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  801938:	4c 89 e7             	mov    %r12,%rdi
+  80193b:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  801942:	00 00 00 
+  801945:	ff d0                	call   *%rax
+    *pf = filp;
+  801947:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80194e:	4c 89 20             	mov    %r12,(%rax)
+    file_flush(dir);
+  801951:	4c 89 ef             	mov    %r13,%rdi
+  801954:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  80195b:	00 00 00 
+  80195e:	ff d0                	call   *%rax
+}
+  801960:	89 d8                	mov    %ebx,%eax
+  801962:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  801969:	5b                   	pop    %rbx
+  80196a:	41 5c                	pop    %r12
+  80196c:	41 5d                	pop    %r13
+  80196e:	41 5e                	pop    %r14
+  801970:	41 5f                	pop    %r15
+  801972:	5d                   	pop    %rbp
+  801973:	c3                   	ret
+    assert((dir->f_size % BLKSIZE) == 0);
+  801974:	48 b9 5e 6a 80 00 00 	movabs $0x806a5e,%rcx
+  80197b:	00 00 00 
+  80197e:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801985:	00 00 00 
+  801988:	be f7 00 00 00       	mov    $0xf7,%esi
+  80198d:	48 bf 92 69 80 00 00 	movabs $0x806992,%rdi
+  801994:	00 00 00 
+  801997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199c:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8019a3:	00 00 00 
+  8019a6:	41 ff d0             	call   *%r8
+        int res = file_get_block(dir, i, &blk);
+  8019a9:	89 c3                	mov    %eax,%ebx
+  8019ab:	eb b3                	jmp    801960 <file_create+0x14c>
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  8019ad:	bb ef ff ff ff       	mov    $0xffffffef,%ebx
+  8019b2:	eb ac                	jmp    801960 <file_create+0x14c>
+    if (res < 0) return res;
+  8019b4:	89 c3                	mov    %eax,%ebx
+  8019b6:	eb a8                	jmp    801960 <file_create+0x14c>
+
+00000000008019b8 <fs_sync>:
+
+/* Sync the entire file system.  A big hammer. */
+void
+fs_sync(void) {
+    for (int i = 1; i < super->s_nblocks; i++) {
+  8019b8:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  8019bf:	00 00 00 
+  8019c2:	83 78 04 01          	cmpl   $0x1,0x4(%rax)
+  8019c6:	76 4e                	jbe    801a16 <fs_sync+0x5e>
+fs_sync(void) {
+  8019c8:	55                   	push   %rbp
+  8019c9:	48 89 e5             	mov    %rsp,%rbp
+  8019cc:	41 56                	push   %r14
+  8019ce:	41 55                	push   %r13
+  8019d0:	41 54                	push   %r12
+  8019d2:	53                   	push   %rbx
+    for (int i = 1; i < super->s_nblocks; i++) {
+  8019d3:	bb 01 00 00 00       	mov    $0x1,%ebx
+        flush_block(diskaddr(i));
+  8019d8:	49 be 41 03 80 00 00 	movabs $0x800341,%r14
+  8019df:	00 00 00 
+  8019e2:	49 bd 59 06 80 00 00 	movabs $0x800659,%r13
+  8019e9:	00 00 00 
+    for (int i = 1; i < super->s_nblocks; i++) {
+  8019ec:	49 bc 28 50 82 00 00 	movabs $0x825028,%r12
+  8019f3:	00 00 00 
+        flush_block(diskaddr(i));
+  8019f6:	89 df                	mov    %ebx,%edi
+  8019f8:	41 ff d6             	call   *%r14
+  8019fb:	48 89 c7             	mov    %rax,%rdi
+  8019fe:	41 ff d5             	call   *%r13
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801a01:	83 c3 01             	add    $0x1,%ebx
+  801a04:	49 8b 04 24          	mov    (%r12),%rax
+  801a08:	3b 58 04             	cmp    0x4(%rax),%ebx
+  801a0b:	72 e9                	jb     8019f6 <fs_sync+0x3e>
+    }
+}
+  801a0d:	5b                   	pop    %rbx
+  801a0e:	41 5c                	pop    %r12
+  801a10:	41 5d                	pop    %r13
+  801a12:	41 5e                	pop    %r14
+  801a14:	5d                   	pop    %rbp
+  801a15:	c3                   	ret
+  801a16:	c3                   	ret
+
+0000000000801a17 <serve_sync>:
+    file_flush(o->o_file);
+    return 0;
+}
+
+int
+serve_sync(envid_t envid, union Fsipc *req) {
+  801a17:	55                   	push   %rbp
+  801a18:	48 89 e5             	mov    %rsp,%rbp
+    fs_sync();
+  801a1b:	48 b8 b8 19 80 00 00 	movabs $0x8019b8,%rax
+  801a22:	00 00 00 
+  801a25:	ff d0                	call   *%rax
+    return 0;
+}
+  801a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2c:	5d                   	pop    %rbp
+  801a2d:	c3                   	ret
+
+0000000000801a2e <serve_init>:
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801a2e:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  801a35:	00 00 00 
+  801a38:	b9 00 00 00 00       	mov    $0x0,%ecx
+    uintptr_t va = FILE_BASE;
+  801a3d:	48 b8 00 00 00 00 02 	movabs $0x200000000,%rax
+  801a44:	00 00 00 
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801a47:	48 be 00 00 20 00 02 	movabs $0x200200000,%rsi
+  801a4e:	00 00 00 
+        opentab[i].o_fileid = i;
+  801a51:	89 0a                	mov    %ecx,(%rdx)
+        opentab[i].o_fd = (struct Fd *)va;
+  801a53:	48 89 42 18          	mov    %rax,0x18(%rdx)
+        va += PAGE_SIZE;
+  801a57:	48 05 00 10 00 00    	add    $0x1000,%rax
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801a5d:	48 83 c1 01          	add    $0x1,%rcx
+  801a61:	48 83 c2 20          	add    $0x20,%rdx
+  801a65:	48 39 f0             	cmp    %rsi,%rax
+  801a68:	75 e7                	jne    801a51 <serve_init+0x23>
+}
+  801a6a:	c3                   	ret
+
+0000000000801a6b <openfile_alloc>:
+openfile_alloc(struct OpenFile **o) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	41 56                	push   %r14
+  801a71:	41 55                	push   %r13
+  801a73:	41 54                	push   %r12
+  801a75:	53                   	push   %rbx
+  801a76:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801a79:	49 bd 98 80 80 00 00 	movabs $0x808098,%r13
+  801a80:	00 00 00 
+  801a83:	bb 00 00 00 00       	mov    $0x0,%ebx
+        switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
+  801a88:	49 be 88 41 80 00 00 	movabs $0x804188,%r14
+  801a8f:	00 00 00 
+  801a92:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  801a96:	be 00 10 00 00       	mov    $0x1000,%esi
+  801a9b:	41 ff d6             	call   *%r14
+  801a9e:	85 c0                	test   %eax,%eax
+  801aa0:	74 1d                	je     801abf <openfile_alloc+0x54>
+  801aa2:	83 f8 01             	cmp    $0x1,%eax
+  801aa5:	74 4d                	je     801af4 <openfile_alloc+0x89>
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801aa7:	48 83 c3 01          	add    $0x1,%rbx
+  801aab:	49 83 c5 20          	add    $0x20,%r13
+  801aaf:	48 81 fb 00 02 00 00 	cmp    $0x200,%rbx
+  801ab6:	75 da                	jne    801a92 <openfile_alloc+0x27>
+    return -E_MAX_OPEN;
+  801ab8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+  801abd:	eb 70                	jmp    801b2f <openfile_alloc+0xc4>
+            int res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW);
+  801abf:	48 89 d8             	mov    %rbx,%rax
+  801ac2:	48 c1 e0 05          	shl    $0x5,%rax
+  801ac6:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  801acd:	00 00 00 
+  801ad0:	48 8b 74 02 18       	mov    0x18(%rdx,%rax,1),%rsi
+  801ad5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ada:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801adf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ae4:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  801aeb:	00 00 00 
+  801aee:	ff d0                	call   *%rax
+            if (res < 0) return res;
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	78 3b                	js     801b2f <openfile_alloc+0xc4>
+            opentab[i].o_fileid += MAXOPEN;
+  801af4:	48 c1 e3 05          	shl    $0x5,%rbx
+  801af8:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  801aff:	00 00 00 
+  801b02:	48 01 c3             	add    %rax,%rbx
+  801b05:	81 03 00 02 00 00    	addl   $0x200,(%rbx)
+            *o = &opentab[i];
+  801b0b:	49 89 1c 24          	mov    %rbx,(%r12)
+            memset(opentab[i].o_fd, 0, PAGE_SIZE);
+  801b0f:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  801b13:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b18:	be 00 00 00 00       	mov    $0x0,%esi
+  801b1d:	48 b8 2f 3d 80 00 00 	movabs $0x803d2f,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+            return (*o)->o_fileid;
+  801b29:	49 8b 04 24          	mov    (%r12),%rax
+  801b2d:	8b 00                	mov    (%rax),%eax
+}
+  801b2f:	5b                   	pop    %rbx
+  801b30:	41 5c                	pop    %r12
+  801b32:	41 5d                	pop    %r13
+  801b34:	41 5e                	pop    %r14
+  801b36:	5d                   	pop    %rbp
+  801b37:	c3                   	ret
+
+0000000000801b38 <openfile_lookup>:
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
+  801b38:	55                   	push   %rbp
+  801b39:	48 89 e5             	mov    %rsp,%rbp
+  801b3c:	41 56                	push   %r14
+  801b3e:	41 55                	push   %r13
+  801b40:	41 54                	push   %r12
+  801b42:	53                   	push   %rbx
+  801b43:	41 89 f5             	mov    %esi,%r13d
+  801b46:	49 89 d6             	mov    %rdx,%r14
+    o = &opentab[fileid % MAXOPEN];
+  801b49:	41 89 f4             	mov    %esi,%r12d
+  801b4c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  801b53:	44 89 e3             	mov    %r12d,%ebx
+  801b56:	48 c1 e3 05          	shl    $0x5,%rbx
+  801b5a:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  801b61:	00 00 00 
+  801b64:	48 01 c3             	add    %rax,%rbx
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 1 || o->o_fileid != fileid) {
+  801b67:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  801b6b:	be 00 10 00 00       	mov    $0x1000,%esi
+  801b70:	48 b8 88 41 80 00 00 	movabs $0x804188,%rax
+  801b77:	00 00 00 
+  801b7a:	ff d0                	call   *%rax
+  801b7c:	83 f8 01             	cmp    $0x1,%eax
+  801b7f:	7e 28                	jle    801ba9 <openfile_lookup+0x71>
+  801b81:	45 89 e4             	mov    %r12d,%r12d
+  801b84:	49 c1 e4 05          	shl    $0x5,%r12
+  801b88:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  801b8f:	00 00 00 
+  801b92:	46 39 2c 20          	cmp    %r13d,(%rax,%r12,1)
+  801b96:	75 18                	jne    801bb0 <openfile_lookup+0x78>
+    *po = o;
+  801b98:	49 89 1e             	mov    %rbx,(%r14)
+    return 0;
+  801b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba0:	5b                   	pop    %rbx
+  801ba1:	41 5c                	pop    %r12
+  801ba3:	41 5d                	pop    %r13
+  801ba5:	41 5e                	pop    %r14
+  801ba7:	5d                   	pop    %rbp
+  801ba8:	c3                   	ret
+        return -E_INVAL;
+  801ba9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bae:	eb f0                	jmp    801ba0 <openfile_lookup+0x68>
+  801bb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bb5:	eb e9                	jmp    801ba0 <openfile_lookup+0x68>
+
+0000000000801bb7 <serve_set_size>:
+serve_set_size(envid_t envid, union Fsipc *ipc) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	53                   	push   %rbx
+  801bbc:	48 83 ec 18          	sub    $0x18,%rsp
+  801bc0:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801bc3:	8b 36                	mov    (%rsi),%esi
+  801bc5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801bc9:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  801bd0:	00 00 00 
+  801bd3:	ff d0                	call   *%rax
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	78 17                	js     801bf0 <serve_set_size+0x39>
+    return file_set_size(o->o_file, req->req_size);
+  801bd9:	8b 73 04             	mov    0x4(%rbx),%esi
+  801bdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801be0:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801be4:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  801beb:	00 00 00 
+  801bee:	ff d0                	call   *%rax
+}
+  801bf0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bf4:	c9                   	leave
+  801bf5:	c3                   	ret
+
+0000000000801bf6 <serve_read>:
+serve_read(envid_t envid, union Fsipc *ipc) {
+  801bf6:	55                   	push   %rbp
+  801bf7:	48 89 e5             	mov    %rsp,%rbp
+  801bfa:	41 54                	push   %r12
+  801bfc:	53                   	push   %rbx
+  801bfd:	48 83 ec 10          	sub    $0x10,%rsp
+  801c01:	48 89 f3             	mov    %rsi,%rbx
+    struct OpenFile *o = NULL;
+  801c04:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801c0b:	00 
+    res = openfile_lookup(envid, req->req_fileid, &o);
+  801c0c:	8b 36                	mov    (%rsi),%esi
+  801c0e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c12:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+    if (res < 0) {
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	78 71                	js     801c93 <serve_read+0x9d>
+    assert(o);
+  801c22:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801c26:	48 85 f6             	test   %rsi,%rsi
+  801c29:	74 71                	je     801c9c <serve_read+0xa6>
+    fd = o->o_fd;
+  801c2b:	4c 8b 66 18          	mov    0x18(%rsi),%r12
+    assert(fd);
+  801c2f:	4d 85 e4             	test   %r12,%r12
+  801c32:	0f 84 99 00 00 00    	je     801cd1 <serve_read+0xdb>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c38:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801c3d:	83 e0 03             	and    $0x3,%eax
+  801c40:	83 f8 01             	cmp    $0x1,%eax
+  801c43:	0f 84 27 01 00 00    	je     801d70 <serve_read+0x17a>
+    ssize_t size_read = file_read(o->o_file, &ipc->readRet.ret_buf,
+  801c49:	41 8b 4c 24 04       	mov    0x4(%r12),%ecx
+                                  MIN(sizeof(ipc->readRet.ret_buf), req->req_n),
+  801c4e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801c52:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801c57:	48 39 c2             	cmp    %rax,%rdx
+  801c5a:	48 0f 47 d0          	cmova  %rax,%rdx
+    ssize_t size_read = file_read(o->o_file, &ipc->readRet.ret_buf,
+  801c5e:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  801c62:	48 89 de             	mov    %rbx,%rsi
+  801c65:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+    assert(size_read < INT32_MAX);
+  801c71:	48 3d fe ff ff 7f    	cmp    $0x7ffffffe,%rax
+  801c77:	0f 8f 89 00 00 00    	jg     801d06 <serve_read+0x110>
+    assert(size_read > INT32_MIN);
+  801c7d:	48 3d 01 00 00 80    	cmp    $0xffffffff80000001,%rax
+  801c83:	0f 8c b2 00 00 00    	jl     801d3b <serve_read+0x145>
+    if (size_read < 0) {
+  801c89:	48 85 c0             	test   %rax,%rax
+  801c8c:	78 05                	js     801c93 <serve_read+0x9d>
+    fd->fd_offset += size_read;
+  801c8e:	41 01 44 24 04       	add    %eax,0x4(%r12)
+}
+  801c93:	48 83 c4 10          	add    $0x10,%rsp
+  801c97:	5b                   	pop    %rbx
+  801c98:	41 5c                	pop    %r12
+  801c9a:	5d                   	pop    %rbp
+  801c9b:	c3                   	ret
+    assert(o);
+  801c9c:	48 b9 86 6e 80 00 00 	movabs $0x806e86,%rcx
+  801ca3:	00 00 00 
+  801ca6:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801cad:	00 00 00 
+  801cb0:	be cf 00 00 00       	mov    $0xcf,%esi
+  801cb5:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801cbc:	00 00 00 
+  801cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc4:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801ccb:	00 00 00 
+  801cce:	41 ff d0             	call   *%r8
+    assert(fd);
+  801cd1:	48 b9 a2 6a 80 00 00 	movabs $0x806aa2,%rcx
+  801cd8:	00 00 00 
+  801cdb:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801ce2:	00 00 00 
+  801ce5:	be d2 00 00 00       	mov    $0xd2,%esi
+  801cea:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801cf1:	00 00 00 
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801d00:	00 00 00 
+  801d03:	41 ff d0             	call   *%r8
+    assert(size_read < INT32_MAX);
+  801d06:	48 b9 a5 6a 80 00 00 	movabs $0x806aa5,%rcx
+  801d0d:	00 00 00 
+  801d10:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801d17:	00 00 00 
+  801d1a:	be db 00 00 00       	mov    $0xdb,%esi
+  801d1f:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801d26:	00 00 00 
+  801d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2e:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801d35:	00 00 00 
+  801d38:	41 ff d0             	call   *%r8
+    assert(size_read > INT32_MIN);
+  801d3b:	48 b9 bb 6a 80 00 00 	movabs $0x806abb,%rcx
+  801d42:	00 00 00 
+  801d45:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801d4c:	00 00 00 
+  801d4f:	be dc 00 00 00       	mov    $0xdc,%esi
+  801d54:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801d5b:	00 00 00 
+  801d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d63:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801d6a:	00 00 00 
+  801d6d:	41 ff d0             	call   *%r8
+        return -E_INVAL;
+  801d70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d75:	e9 19 ff ff ff       	jmp    801c93 <serve_read+0x9d>
+
+0000000000801d7a <serve_write>:
+serve_write(envid_t envid, union Fsipc *ipc) {
+  801d7a:	55                   	push   %rbp
+  801d7b:	48 89 e5             	mov    %rsp,%rbp
+  801d7e:	41 54                	push   %r12
+  801d80:	53                   	push   %rbx
+  801d81:	48 83 ec 10          	sub    $0x10,%rsp
+  801d85:	48 89 f3             	mov    %rsi,%rbx
+    struct OpenFile *o = NULL;
+  801d88:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801d8f:	00 
+    res = openfile_lookup(envid, req->req_fileid, &o);
+  801d90:	8b 36                	mov    (%rsi),%esi
+  801d92:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801d96:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  801d9d:	00 00 00 
+  801da0:	ff d0                	call   *%rax
+    if (res < 0) {
+  801da2:	85 c0                	test   %eax,%eax
+  801da4:	78 6d                	js     801e13 <serve_write+0x99>
+    assert(o);
+  801da6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801daa:	48 85 c0             	test   %rax,%rax
+  801dad:	74 6d                	je     801e1c <serve_write+0xa2>
+    fd = o->o_fd;
+  801daf:	4c 8b 60 18          	mov    0x18(%rax),%r12
+    assert(fd);
+  801db3:	4d 85 e4             	test   %r12,%r12
+  801db6:	0f 84 90 00 00 00    	je     801e4c <serve_write+0xd2>
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dbc:	41 f6 44 24 08 03    	testb  $0x3,0x8(%r12)
+  801dc2:	0f 84 23 01 00 00    	je     801eeb <serve_write+0x171>
+    ssize_t size_read = file_write(o->o_file, &req->req_buf,
+  801dc8:	41 8b 4c 24 04       	mov    0x4(%r12),%ecx
+                                   MIN(sizeof(req->req_buf), req->req_n),
+  801dcd:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  801dd1:	be f0 0f 00 00       	mov    $0xff0,%esi
+  801dd6:	48 39 f2             	cmp    %rsi,%rdx
+  801dd9:	48 0f 47 d6          	cmova  %rsi,%rdx
+    ssize_t size_read = file_write(o->o_file, &req->req_buf,
+  801ddd:	48 8d 73 10          	lea    0x10(%rbx),%rsi
+  801de1:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801de5:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  801dec:	00 00 00 
+  801def:	ff d0                	call   *%rax
+    assert(size_read < INT32_MAX);
+  801df1:	48 3d fe ff ff 7f    	cmp    $0x7ffffffe,%rax
+  801df7:	0f 8f 84 00 00 00    	jg     801e81 <serve_write+0x107>
+    assert(size_read > INT32_MIN);
+  801dfd:	48 3d 01 00 00 80    	cmp    $0xffffffff80000001,%rax
+  801e03:	0f 8c ad 00 00 00    	jl     801eb6 <serve_write+0x13c>
+    if (size_read < 0) {
+  801e09:	48 85 c0             	test   %rax,%rax
+  801e0c:	78 05                	js     801e13 <serve_write+0x99>
+    fd->fd_offset += size_read;
+  801e0e:	41 01 44 24 04       	add    %eax,0x4(%r12)
+}
+  801e13:	48 83 c4 10          	add    $0x10,%rsp
+  801e17:	5b                   	pop    %rbx
+  801e18:	41 5c                	pop    %r12
+  801e1a:	5d                   	pop    %rbp
+  801e1b:	c3                   	ret
+    assert(o);
+  801e1c:	48 b9 86 6e 80 00 00 	movabs $0x806e86,%rcx
+  801e23:	00 00 00 
+  801e26:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801e2d:	00 00 00 
+  801e30:	be fb 00 00 00       	mov    $0xfb,%esi
+  801e35:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801e3c:	00 00 00 
+  801e3f:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801e46:	00 00 00 
+  801e49:	41 ff d0             	call   *%r8
+    assert(fd);
+  801e4c:	48 b9 a2 6a 80 00 00 	movabs $0x806aa2,%rcx
+  801e53:	00 00 00 
+  801e56:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801e5d:	00 00 00 
+  801e60:	be fe 00 00 00       	mov    $0xfe,%esi
+  801e65:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801e6c:	00 00 00 
+  801e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e74:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801e7b:	00 00 00 
+  801e7e:	41 ff d0             	call   *%r8
+    assert(size_read < INT32_MAX);
+  801e81:	48 b9 a5 6a 80 00 00 	movabs $0x806aa5,%rcx
+  801e88:	00 00 00 
+  801e8b:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801e92:	00 00 00 
+  801e95:	be 07 01 00 00       	mov    $0x107,%esi
+  801e9a:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801ea1:	00 00 00 
+  801ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea9:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801eb0:	00 00 00 
+  801eb3:	41 ff d0             	call   *%r8
+    assert(size_read > INT32_MIN);
+  801eb6:	48 b9 bb 6a 80 00 00 	movabs $0x806abb,%rcx
+  801ebd:	00 00 00 
+  801ec0:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  801ec7:	00 00 00 
+  801eca:	be 08 01 00 00       	mov    $0x108,%esi
+  801ecf:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  801ed6:	00 00 00 
+  801ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ede:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  801ee5:	00 00 00 
+  801ee8:	41 ff d0             	call   *%r8
+        return -E_INVAL;
+  801eeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef0:	e9 1e ff ff ff       	jmp    801e13 <serve_write+0x99>
+
+0000000000801ef5 <serve_stat>:
+serve_stat(envid_t envid, union Fsipc *ipc) {
+  801ef5:	55                   	push   %rbp
+  801ef6:	48 89 e5             	mov    %rsp,%rbp
+  801ef9:	41 54                	push   %r12
+  801efb:	53                   	push   %rbx
+  801efc:	48 83 ec 10          	sub    $0x10,%rsp
+  801f00:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  801f03:	8b 36                	mov    (%rsi),%esi
+  801f05:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f09:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  801f10:	00 00 00 
+  801f13:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f15:	85 c0                	test   %eax,%eax
+  801f17:	78 69                	js     801f82 <serve_stat+0x8d>
+    strcpy(ret->ret_name, o->o_file->f_name);
+  801f19:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f1d:	49 8b 74 24 08       	mov    0x8(%r12),%rsi
+  801f22:	48 89 df             	mov    %rbx,%rdi
+  801f25:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  801f2c:	00 00 00 
+  801f2f:	ff d0                	call   *%rax
+    ret->ret_size = o->o_file->f_size;
+  801f31:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801f36:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801f3c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  801f42:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801f47:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%rax)
+  801f4e:	0f 94 c0             	sete   %al
+  801f51:	0f b6 c0             	movzbl %al,%eax
+  801f54:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    ret->ret_ino = (uintptr_t)o->o_file - DISKMAP;
+  801f5a:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801f5f:	48 2d 00 00 00 10    	sub    $0x10000000,%rax
+  801f65:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    ret->ret_version = o->o_file->f_version;
+  801f6c:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801f71:	8b 80 b4 00 00 00    	mov    0xb4(%rax),%eax
+  801f77:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  801f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f82:	48 83 c4 10          	add    $0x10,%rsp
+  801f86:	5b                   	pop    %rbx
+  801f87:	41 5c                	pop    %r12
+  801f89:	5d                   	pop    %rbp
+  801f8a:	c3                   	ret
+
+0000000000801f8b <serve_flush>:
+serve_flush(envid_t envid, union Fsipc *ipc) {
+  801f8b:	55                   	push   %rbp
+  801f8c:	48 89 e5             	mov    %rsp,%rbp
+  801f8f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  801f93:	8b 36                	mov    (%rsi),%esi
+  801f95:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  801f99:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  801fa0:	00 00 00 
+  801fa3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	78 19                	js     801fc2 <serve_flush+0x37>
+    file_flush(o->o_file);
+  801fa9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fad:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801fb1:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+    return 0;
+  801fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc2:	c9                   	leave
+  801fc3:	c3                   	ret
+
+0000000000801fc4 <serve_msync>:
+
+/* Write blocks of ipc->msync.req_fileid in the given range to disk.
+ * They might have been modified through shared mappings
+ * without the block cache noticing it. */
+int
+serve_msync(envid_t envid, union Fsipc *ipc) {
+  801fc4:	55                   	push   %rbp
+  801fc5:	48 89 e5             	mov    %rsp,%rbp
+  801fc8:	41 57                	push   %r15
+  801fca:	41 56                	push   %r14
+  801fcc:	41 55                	push   %r13
+  801fce:	41 54                	push   %r12
+  801fd0:	53                   	push   %rbx
+  801fd1:	48 83 ec 28          	sub    $0x28,%rsp
+  801fd5:	49 89 f5             	mov    %rsi,%r13
+        cprintf("serve_msync %08x %08x %08x %08x\n", envid, req->req_fileid,
+                (uint32_t)req->req_offset, (uint32_t)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  801fd8:	8b 36                	mov    (%rsi),%esi
+  801fda:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801fde:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  801fe5:	00 00 00 
+  801fe8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	0f 88 cd 00 00 00    	js     8020bf <serve_msync+0xfb>
+    if ((o->o_fd->fd_omode & O_ACCMODE) == O_RDONLY) return -E_INVAL;
+  801ff2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ff6:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  801ffa:	f6 42 08 03          	testb  $0x3,0x8(%rdx)
+  801ffe:	0f 84 ca 00 00 00    	je     8020ce <serve_msync+0x10a>
+    if (req->req_offset < 0) return -E_INVAL;
+  802004:	41 8b 5d 04          	mov    0x4(%r13),%ebx
+  802008:	85 db                	test   %ebx,%ebx
+  80200a:	0f 88 c5 00 00 00    	js     8020d5 <serve_msync+0x111>
+
+    struct File *f = o->o_file;
+  802010:	4c 8b 60 08          	mov    0x8(%rax),%r12
+    off_t end = (off_t)MIN((size_t)f->f_size, (size_t)req->req_offset + req->req_n);
+  802014:	48 63 c3             	movslq %ebx,%rax
+  802017:	49 03 45 08          	add    0x8(%r13),%rax
+  80201b:	49 63 94 24 80 00 00 	movslq 0x80(%r12),%rdx
+  802022:	00 
+  802023:	48 39 d0             	cmp    %rdx,%rax
+  802026:	48 0f 47 c2          	cmova  %rdx,%rax
+  80202a:	41 89 c5             	mov    %eax,%r13d
+    for (off_t pos = ROUNDDOWN(req->req_offset, BLKSIZE); pos < end; pos += BLKSIZE) {
+  80202d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802033:	39 d8                	cmp    %ebx,%eax
+  802035:	7e 7a                	jle    8020b1 <serve_msync+0xed>
+        blockno_t *pdiskbno;
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+  802037:	49 be 30 0f 80 00 00 	movabs $0x800f30,%r14
+  80203e:	00 00 00 
+
+        void *blk = diskaddr(*pdiskbno);
+  802041:	49 bf 41 03 80 00 00 	movabs $0x800341,%r15
+  802048:	00 00 00 
+  80204b:	eb 0d                	jmp    80205a <serve_msync+0x96>
+    for (off_t pos = ROUNDDOWN(req->req_offset, BLKSIZE); pos < end; pos += BLKSIZE) {
+  80204d:	8d 83 00 10 00 00    	lea    0x1000(%rbx),%eax
+  802053:	89 c3                	mov    %eax,%ebx
+  802055:	41 39 c5             	cmp    %eax,%r13d
+  802058:	7e 57                	jle    8020b1 <serve_msync+0xed>
+        if (file_block_walk(f, pos / BLKSIZE, &pdiskbno, 0) < 0 || !*pdiskbno) continue;
+  80205a:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  802060:	85 db                	test   %ebx,%ebx
+  802062:	0f 49 f3             	cmovns %ebx,%esi
+  802065:	c1 fe 0c             	sar    $0xc,%esi
+  802068:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206d:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  802071:	4c 89 e7             	mov    %r12,%rdi
+  802074:	41 ff d6             	call   *%r14
+  802077:	85 c0                	test   %eax,%eax
+  802079:	78 d2                	js     80204d <serve_msync+0x89>
+  80207b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80207f:	8b 38                	mov    (%rax),%edi
+  802081:	85 ff                	test   %edi,%edi
+  802083:	74 c8                	je     80204d <serve_msync+0x89>
+        void *blk = diskaddr(*pdiskbno);
+  802085:	41 ff d7             	call   *%r15
+  802088:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        if (is_page_present(blk)) write_block(blk);
+  80208c:	48 89 c7             	mov    %rax,%rdi
+  80208f:	48 b8 cd 61 80 00 00 	movabs $0x8061cd,%rax
+  802096:	00 00 00 
+  802099:	ff d0                	call   *%rax
+  80209b:	84 c0                	test   %al,%al
+  80209d:	74 ae                	je     80204d <serve_msync+0x89>
+  80209f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8020a3:	48 b8 e9 04 80 00 00 	movabs $0x8004e9,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+  8020af:	eb 9c                	jmp    80204d <serve_msync+0x89>
+    }
+
+    /* Contents changed, cached program images are stale */
+    f->f_version++;
+  8020b1:	41 83 84 24 b4 00 00 	addl   $0x1,0xb4(%r12)
+  8020b8:	00 01 
+    return 0;
+  8020ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020bf:	48 83 c4 28          	add    $0x28,%rsp
+  8020c3:	5b                   	pop    %rbx
+  8020c4:	41 5c                	pop    %r12
+  8020c6:	41 5d                	pop    %r13
+  8020c8:	41 5e                	pop    %r14
+  8020ca:	41 5f                	pop    %r15
+  8020cc:	5d                   	pop    %rbp
+  8020cd:	c3                   	ret
+    if ((o->o_fd->fd_omode & O_ACCMODE) == O_RDONLY) return -E_INVAL;
+  8020ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020d3:	eb ea                	jmp    8020bf <serve_msync+0xfb>
+    if (req->req_offset < 0) return -E_INVAL;
+  8020d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020da:	eb e3                	jmp    8020bf <serve_msync+0xfb>
+
+00000000008020dc <serve_open>:
+           void **pg_store, int *perm_store) {
+  8020dc:	55                   	push   %rbp
+  8020dd:	48 89 e5             	mov    %rsp,%rbp
+  8020e0:	41 55                	push   %r13
+  8020e2:	41 54                	push   %r12
+  8020e4:	53                   	push   %rbx
+  8020e5:	48 81 ec 18 04 00 00 	sub    $0x418,%rsp
+  8020ec:	48 89 f3             	mov    %rsi,%rbx
+  8020ef:	49 89 d5             	mov    %rdx,%r13
+  8020f2:	49 89 cc             	mov    %rcx,%r12
+    memmove(path, req->req_path, MAXPATHLEN);
+  8020f5:	ba 00 04 00 00       	mov    $0x400,%edx
+  8020fa:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  802101:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  80210d:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+    if ((res = openfile_alloc(&o)) < 0) {
+  802111:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  802118:	48 b8 6b 1a 80 00 00 	movabs $0x801a6b,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+  802124:	85 c0                	test   %eax,%eax
+  802126:	0f 88 fa 00 00 00    	js     802226 <serve_open+0x14a>
+    if (req->req_omode & O_CREAT) {
+  80212c:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%rbx)
+  802133:	74 34                	je     802169 <serve_open+0x8d>
+        if ((res = file_create(path, &f)) < 0) {
+  802135:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  80213c:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  802143:	48 b8 14 18 80 00 00 	movabs $0x801814,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+  80214f:	85 c0                	test   %eax,%eax
+  802151:	79 38                	jns    80218b <serve_open+0xaf>
+            if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
+  802153:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%rbx)
+  80215a:	0f 85 c6 00 00 00    	jne    802226 <serve_open+0x14a>
+  802160:	83 f8 ef             	cmp    $0xffffffef,%eax
+  802163:	0f 85 bd 00 00 00    	jne    802226 <serve_open+0x14a>
+        if ((res = file_open(path, &f)) < 0) {
+  802169:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  802170:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  802177:	48 b8 2b 14 80 00 00 	movabs $0x80142b,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+  802183:	85 c0                	test   %eax,%eax
+  802185:	0f 88 9b 00 00 00    	js     802226 <serve_open+0x14a>
+    if (req->req_omode & O_TRUNC) {
+  80218b:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%rbx)
+  802192:	74 1c                	je     8021b0 <serve_open+0xd4>
+        if ((res = file_set_size(f, 0)) < 0) {
+  802194:	be 00 00 00 00       	mov    $0x0,%esi
+  802199:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  8021a0:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  8021a7:	00 00 00 
+  8021aa:	ff d0                	call   *%rax
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	78 76                	js     802226 <serve_open+0x14a>
+    if ((res = file_open(path, &f)) < 0) {
+  8021b0:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  8021b7:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  8021be:	48 b8 2b 14 80 00 00 	movabs $0x80142b,%rax
+  8021c5:	00 00 00 
+  8021c8:	ff d0                	call   *%rax
+  8021ca:	85 c0                	test   %eax,%eax
+  8021cc:	78 58                	js     802226 <serve_open+0x14a>
+    o->o_file = f;
+  8021ce:	48 8b 95 d0 fb ff ff 	mov    -0x430(%rbp),%rdx
+  8021d5:	48 8b 85 d8 fb ff ff 	mov    -0x428(%rbp),%rax
+  8021dc:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    o->o_fd->fd_file.id = o->o_fileid;
+  8021e0:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  8021e4:	8b 0a                	mov    (%rdx),%ecx
+  8021e6:	89 48 0c             	mov    %ecx,0xc(%rax)
+    o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  8021e9:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  8021ed:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  8021f3:	83 e0 03             	and    $0x3,%eax
+  8021f6:	89 41 08             	mov    %eax,0x8(%rcx)
+    o->o_fd->fd_dev_id = devfile.dev_id;
+  8021f9:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  8021fd:	a1 a0 c0 80 00 00 00 	movabs 0x80c0a0,%eax
+  802204:	00 00 
+  802206:	89 01                	mov    %eax,(%rcx)
+    o->o_mode = req->req_omode;
+  802208:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  80220e:	89 42 10             	mov    %eax,0x10(%rdx)
+    *pg_store = o->o_fd;
+  802211:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  802215:	49 89 45 00          	mov    %rax,0x0(%r13)
+    *perm_store = PROT_RW | PROT_SHARE;
+  802219:	41 c7 04 24 46 00 00 	movl   $0x46,(%r12)
+  802220:	00 
+    return 0;
+  802221:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802226:	48 81 c4 18 04 00 00 	add    $0x418,%rsp
+  80222d:	5b                   	pop    %rbx
+  80222e:	41 5c                	pop    %r12
+  802230:	41 5d                	pop    %r13
+  802232:	5d                   	pop    %rbp
+  802233:	c3                   	ret
+
+0000000000802234 <serve_map>:
+serve_map(envid_t envid, struct Fsreq_map *req, void **pg_store, size_t *size_store, int *perm_store) {
+  802234:	55                   	push   %rbp
+  802235:	48 89 e5             	mov    %rsp,%rbp
+  802238:	41 57                	push   %r15
+  80223a:	41 56                	push   %r14
+  80223c:	41 55                	push   %r13
+  80223e:	41 54                	push   %r12
+  802240:	53                   	push   %rbx
+  802241:	48 83 ec 38          	sub    $0x38,%rsp
+  802245:	49 89 f4             	mov    %rsi,%r12
+  802248:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  80224c:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802250:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  802254:	8b 36                	mov    (%rsi),%esi
+  802256:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80225a:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802266:	85 c0                	test   %eax,%eax
+  802268:	0f 88 f5 00 00 00    	js     802363 <serve_map+0x12f>
+    int omode = o->o_fd->fd_omode & O_ACCMODE;
+  80226e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802272:	48 8b 41 18          	mov    0x18(%rcx),%rax
+  802276:	8b 40 08             	mov    0x8(%rax),%eax
+  802279:	83 e0 03             	and    $0x3,%eax
+    if (omode == O_WRONLY) return -E_INVAL;
+  80227c:	83 f8 01             	cmp    $0x1,%eax
+  80227f:	0f 84 f8 00 00 00    	je     80237d <serve_map+0x149>
+    if (req->req_prot & PROT_W && omode == O_RDONLY) return -E_INVAL;
+  802285:	41 f6 44 24 10 02    	testb  $0x2,0x10(%r12)
+  80228b:	74 08                	je     802295 <serve_map+0x61>
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	0f 84 ef 00 00 00    	je     802384 <serve_map+0x150>
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE) return -E_INVAL;
+  802295:	41 8b 54 24 04       	mov    0x4(%r12),%edx
+  80229a:	85 d2                	test   %edx,%edx
+  80229c:	0f 88 e9 00 00 00    	js     80238b <serve_map+0x157>
+  8022a2:	89 d0                	mov    %edx,%eax
+  8022a4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022a9:	0f 85 e3 00 00 00    	jne    802392 <serve_map+0x15e>
+    struct File *f = o->o_file;
+  8022af:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  8022b3:	48 89 4d b8          	mov    %rcx,-0x48(%rbp)
+    if (req->req_offset >= f->f_size) return 0;
+  8022b7:	44 8b b1 80 00 00 00 	mov    0x80(%rcx),%r14d
+  8022be:	44 39 f2             	cmp    %r14d,%edx
+  8022c1:	0f 8d 9c 00 00 00    	jge    802363 <serve_map+0x12f>
+    size_t n = MIN(req->req_n, (size_t)(f->f_size - req->req_offset));
+  8022c7:	41 29 d6             	sub    %edx,%r14d
+  8022ca:	4d 63 f6             	movslq %r14d,%r14
+  8022cd:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  8022d2:	49 39 c6             	cmp    %rax,%r14
+  8022d5:	4c 0f 47 f0          	cmova  %rax,%r14
+    for (size = 0; size < n; size += BLKSIZE) {
+  8022d9:	4d 85 f6             	test   %r14,%r14
+  8022dc:	0f 84 90 00 00 00    	je     802372 <serve_map+0x13e>
+  8022e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char *start = NULL;
+  8022e7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        if ((res = file_get_block(f, (req->req_offset + size) / BLKSIZE, &blk)) < 0) {
+  8022ed:	49 bf ae 10 80 00 00 	movabs $0x8010ae,%r15
+  8022f4:	00 00 00 
+  8022f7:	eb 1e                	jmp    802317 <serve_map+0xe3>
+            if (!size) return res;
+  8022f9:	48 85 db             	test   %rbx,%rbx
+  8022fc:	75 44                	jne    802342 <serve_map+0x10e>
+  8022fe:	eb 63                	jmp    802363 <serve_map+0x12f>
+        if (!start) start = blk;
+  802300:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+        (void)*(volatile char *)blk;
+  802304:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802308:	0f b6 00             	movzbl (%rax),%eax
+    for (size = 0; size < n; size += BLKSIZE) {
+  80230b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802312:	4c 39 f3             	cmp    %r14,%rbx
+  802315:	73 2b                	jae    802342 <serve_map+0x10e>
+        if ((res = file_get_block(f, (req->req_offset + size) / BLKSIZE, &blk)) < 0) {
+  802317:	49 63 74 24 04       	movslq 0x4(%r12),%rsi
+  80231c:	48 01 de             	add    %rbx,%rsi
+  80231f:	48 c1 ee 0c          	shr    $0xc,%rsi
+  802323:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  802327:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80232b:	41 ff d7             	call   *%r15
+  80232e:	85 c0                	test   %eax,%eax
+  802330:	78 c7                	js     8022f9 <serve_map+0xc5>
+        if (start && blk != start + size) break;
+  802332:	4d 85 ed             	test   %r13,%r13
+  802335:	74 c9                	je     802300 <serve_map+0xcc>
+  802337:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80233c:	48 39 45 c0          	cmp    %rax,-0x40(%rbp)
+  802340:	74 c2                	je     802304 <serve_map+0xd0>
+    *pg_store = start;
+  802342:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802346:	4c 89 28             	mov    %r13,(%rax)
+    *size_store = size;
+  802349:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80234d:	48 89 18             	mov    %rbx,(%rax)
+    *perm_store = PROT_R | (req->req_prot & PROT_W);
+  802350:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802355:	83 e0 02             	and    $0x2,%eax
+  802358:	83 c8 04             	or     $0x4,%eax
+  80235b:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80235f:	89 01                	mov    %eax,(%rcx)
+    return (int)size;
+  802361:	89 d8                	mov    %ebx,%eax
+}
+  802363:	48 83 c4 38          	add    $0x38,%rsp
+  802367:	5b                   	pop    %rbx
+  802368:	41 5c                	pop    %r12
+  80236a:	41 5d                	pop    %r13
+  80236c:	41 5e                	pop    %r14
+  80236e:	41 5f                	pop    %r15
+  802370:	5d                   	pop    %rbp
+  802371:	c3                   	ret
+    for (size = 0; size < n; size += BLKSIZE) {
+  802372:	4c 89 f3             	mov    %r14,%rbx
+    char *start = NULL;
+  802375:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80237b:	eb c5                	jmp    802342 <serve_map+0x10e>
+    if (omode == O_WRONLY) return -E_INVAL;
+  80237d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802382:	eb df                	jmp    802363 <serve_map+0x12f>
+    if (req->req_prot & PROT_W && omode == O_RDONLY) return -E_INVAL;
+  802384:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802389:	eb d8                	jmp    802363 <serve_map+0x12f>
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE) return -E_INVAL;
+  80238b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802390:	eb d1                	jmp    802363 <serve_map+0x12f>
+  802392:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802397:	eb ca                	jmp    802363 <serve_map+0x12f>
+
+0000000000802399 <serve>:
+
+/* Arguments of the current short request */
+static union Fsipc short_req;
+
+void
+serve(void) {
+  802399:	55                   	push   %rbp
+  80239a:	48 89 e5             	mov    %rsp,%rbp
+  80239d:	41 57                	push   %r15
+  80239f:	41 56                	push   %r14
+  8023a1:	41 55                	push   %r13
+  8023a3:	41 54                	push   %r12
+  8023a5:	53                   	push   %rbx
+  8023a6:	48 83 ec 38          	sub    $0x38,%rsp
+    uint32_t req, whom;
+    int perm, res = 0;
+    void *pg = NULL;
+  8023aa:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023b1:	00 
+    envid_t client = 0;  /* Client to reply to, 0 if none */
+    size_t reply_sz = 0; /* Size of region to reply with */
+    int reply_perm = 0;
+  8023b2:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    size_t reply_sz = 0; /* Size of region to reply with */
+  8023b8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    envid_t client = 0;  /* Client to reply to, 0 if none */
+  8023be:	bf 00 00 00 00       	mov    $0x0,%edi
+    int perm, res = 0;
+  8023c3:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%rbp)
+
+    while (1) {
+        perm = 0;
+        size_t sz = PAGE_SIZE;
+        req = ipc_reply_wait(client, res, pg, reply_sz, reply_perm,
+  8023ca:	49 bc 78 80 80 00 00 	movabs $0x808078,%r12
+  8023d1:	00 00 00 
+  8023d4:	49 bf 28 4d 80 00 00 	movabs $0x804d28,%r15
+  8023db:	00 00 00 
+  8023de:	eb 13                	jmp    8023f3 <serve+0x5a>
+        /* Client exited before the reply was delivered */
+        if ((int32_t)req < 0) continue;
+
+        /* Kernel is low on memory */
+        if (whom == RECLAIM_ENVID) {
+            size_t nfreed = bc_reclaim(req);
+  8023e0:	89 c7                	mov    %eax,%edi
+  8023e2:	48 b8 34 07 80 00 00 	movabs $0x800734,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+        client = 0;
+  8023ee:	bf 00 00 00 00       	mov    $0x0,%edi
+        perm = 0;
+  8023f3:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+        size_t sz = PAGE_SIZE;
+  8023fa:	48 c7 45 b8 00 10 00 	movq   $0x1000,-0x48(%rbp)
+  802401:	00 
+        req = ipc_reply_wait(client, res, pg, reply_sz, reply_perm,
+  802402:	48 83 ec 08          	sub    $0x8,%rsp
+  802406:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80240a:	50                   	push   %rax
+  80240b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80240f:	50                   	push   %rax
+  802410:	41 ff 34 24          	push   (%r12)
+  802414:	4c 8d 4d cc          	lea    -0x34(%rbp),%r9
+  802418:	45 89 f0             	mov    %r14d,%r8d
+  80241b:	4c 89 e9             	mov    %r13,%rcx
+  80241e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802422:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  802425:	41 ff d7             	call   *%r15
+  802428:	89 c3                	mov    %eax,%ebx
+        if ((int32_t)req < 0) continue;
+  80242a:	48 83 c4 20          	add    $0x20,%rsp
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	78 bc                	js     8023ee <serve+0x55>
+        if (whom == RECLAIM_ENVID) {
+  802432:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802436:	74 a8                	je     8023e0 <serve+0x47>
+            if (debug) cprintf("fs reclaim %d pages: %zu freed\n", req, nfreed);
+            continue;
+        }
+
+        union Fsipc *ipc = fsreq;
+  802438:	49 8b 34 24          	mov    (%r12),%rsi
+        if (req < NHANDLERS && short_requests[req] && !perm) {
+  80243c:	83 f8 0a             	cmp    $0xa,%eax
+  80243f:	77 18                	ja     802459 <serve+0xc0>
+  802441:	89 c0                	mov    %eax,%eax
+  802443:	48 ba 68 6b 80 00 00 	movabs $0x806b68,%rdx
+  80244a:	00 00 00 
+  80244d:	80 3c 02 00          	cmpb   $0x0,(%rdx,%rax,1)
+  802451:	74 06                	je     802459 <serve+0xc0>
+  802453:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  802457:	74 2c                	je     802485 <serve+0xec>
+  802459:	48 89 f2             	mov    %rsi,%rdx
+                    req, whom, (unsigned long)get_uvpt_entry(fsreq),
+                    (char *)fsreq);
+        }
+
+        /* All other requests must contain an argument page */
+        if (ipc == fsreq && !(perm & PROT_R)) {
+  80245c:	f6 45 c8 04          	testb  $0x4,-0x38(%rbp)
+  802460:	75 6c                	jne    8024ce <serve+0x135>
+            cprintf("Invalid request from %08x: no argument page\n", whom);
+  802462:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802465:	48 bf 10 6b 80 00 00 	movabs $0x806b10,%rdi
+  80246c:	00 00 00 
+  80246f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802474:	48 b9 56 31 80 00 00 	movabs $0x803156,%rcx
+  80247b:	00 00 00 
+  80247e:	ff d1                	call   *%rcx
+            continue; /* Just leave it hanging... */
+  802480:	e9 69 ff ff ff       	jmp    8023ee <serve+0x55>
+            memcpy(&short_req, (void *)thisenv->env_ipc_words, sizeof(thisenv->env_ipc_words));
+  802485:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  80248c:	00 00 00 
+  80248f:	48 8d b0 a0 01 00 00 	lea    0x1a0(%rax),%rsi
+  802496:	ba 28 00 00 00       	mov    $0x28,%edx
+  80249b:	48 bf 40 50 82 00 00 	movabs $0x825040,%rdi
+  8024a2:	00 00 00 
+  8024a5:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+        if (ipc == fsreq && !(perm & PROT_R)) {
+  8024b1:	49 8b 34 24          	mov    (%r12),%rsi
+  8024b5:	48 b8 40 50 82 00 00 	movabs $0x825040,%rax
+  8024bc:	00 00 00 
+  8024bf:	48 39 c6             	cmp    %rax,%rsi
+  8024c2:	74 95                	je     802459 <serve+0xc0>
+            ipc = &short_req;
+  8024c4:	48 ba 40 50 82 00 00 	movabs $0x825040,%rdx
+  8024cb:	00 00 00 
+        }
+
+        pg = NULL;
+  8024ce:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8024d5:	00 
+        sz = PAGE_SIZE;
+  8024d6:	48 c7 45 b8 00 10 00 	movq   $0x1000,-0x48(%rbp)
+  8024dd:	00 
+        if (req == FSREQ_OPEN) {
+  8024de:	83 fb 01             	cmp    $0x1,%ebx
+  8024e1:	74 2c                	je     80250f <serve+0x176>
+            res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+        } else if (req == FSREQ_MAP) {
+  8024e3:	83 fb 09             	cmp    $0x9,%ebx
+  8024e6:	74 43                	je     80252b <serve+0x192>
+            res = serve_map(whom, &fsreq->map, &pg, &sz, &perm);
+        } else if (req < NHANDLERS && handlers[req]) {
+  8024e8:	83 fb 0a             	cmp    $0xa,%ebx
+  8024eb:	77 5e                	ja     80254b <serve+0x1b2>
+  8024ed:	89 d8                	mov    %ebx,%eax
+  8024ef:	48 b9 20 80 80 00 00 	movabs $0x808020,%rcx
+  8024f6:	00 00 00 
+  8024f9:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8024fd:	48 85 c0             	test   %rax,%rax
+  802500:	74 49                	je     80254b <serve+0x1b2>
+            res = handlers[req](whom, ipc);
+  802502:	48 89 d6             	mov    %rdx,%rsi
+  802505:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  802508:	ff d0                	call   *%rax
+  80250a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+  80250d:	eb 63                	jmp    802572 <serve+0x1d9>
+            res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+  80250f:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  802513:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  802517:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80251a:	48 b8 dc 20 80 00 00 	movabs $0x8020dc,%rax
+  802521:	00 00 00 
+  802524:	ff d0                	call   *%rax
+  802526:	89 45 ac             	mov    %eax,-0x54(%rbp)
+  802529:	eb 47                	jmp    802572 <serve+0x1d9>
+            res = serve_map(whom, &fsreq->map, &pg, &sz, &perm);
+  80252b:	4c 8d 45 c8          	lea    -0x38(%rbp),%r8
+  80252f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802533:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  802537:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80253a:	48 b8 34 22 80 00 00 	movabs $0x802234,%rax
+  802541:	00 00 00 
+  802544:	ff d0                	call   *%rax
+  802546:	89 45 ac             	mov    %eax,-0x54(%rbp)
+  802549:	eb 27                	jmp    802572 <serve+0x1d9>
+        } else {
+            cprintf("Invalid request code %d from %08x\n", req, whom);
+  80254b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80254e:	89 de                	mov    %ebx,%esi
+  802550:	48 bf 40 6b 80 00 00 	movabs $0x806b40,%rdi
+  802557:	00 00 00 
+  80255a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255f:	48 b9 56 31 80 00 00 	movabs $0x803156,%rcx
+  802566:	00 00 00 
+  802569:	ff d1                	call   *%rcx
+            res = -E_INVAL;
+  80256b:	c7 45 ac fd ff ff ff 	movl   $0xfffffffd,-0x54(%rbp)
+        }
+
+        /* Reply is sent by the next ipc_reply_wait(),
+         * which also unmaps fsreq if the request was mapped there */
+        client = whom;
+  802572:	8b 7d cc             	mov    -0x34(%rbp),%edi
+        reply_sz = sz;
+  802575:	4c 8b 6d b8          	mov    -0x48(%rbp),%r13
+        reply_perm = perm;
+  802579:	44 8b 75 c8          	mov    -0x38(%rbp),%r14d
+  80257d:	e9 71 fe ff ff       	jmp    8023f3 <serve+0x5a>
+
+0000000000802582 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  802582:	55                   	push   %rbp
+  802583:	48 89 e5             	mov    %rsp,%rbp
+  802586:	53                   	push   %rbx
+  802587:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    binaryname = "fs";
+  80258b:	48 b8 d1 6a 80 00 00 	movabs $0x806ad1,%rax
+  802592:	00 00 00 
+  802595:	48 a3 80 c0 80 00 00 	movabs %rax,0x80c080
+  80259c:	00 00 00 
+    cprintf("FS is running\n");
+  80259f:	48 bf d4 6a 80 00 00 	movabs $0x806ad4,%rdi
+  8025a6:	00 00 00 
+  8025a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ae:	48 bb 56 31 80 00 00 	movabs $0x803156,%rbx
+  8025b5:	00 00 00 
+  8025b8:	ff d3                	call   *%rbx
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  8025ba:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  8025bf:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  8025c4:	66 ef                	out    %ax,(%dx)
+
+    /* Check that we are able to do I/O */
+    outw(0x8A00, 0x8A00);
+    cprintf("FS can do I/O\n");
+  8025c6:	48 bf e3 6a 80 00 00 	movabs $0x806ae3,%rdi
+  8025cd:	00 00 00 
+  8025d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d5:	ff d3                	call   *%rbx
+
+    serve_init();
+  8025d7:	48 b8 2e 1a 80 00 00 	movabs $0x801a2e,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+    fs_init();
+  8025e3:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+    fs_test();
+  8025ef:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+
+    /* Clean block cache pages can be dropped on memory pressure */
+    int res = sys_env_set_reclaim(0, 1);
+  8025fb:	be 01 00 00 00       	mov    $0x1,%esi
+  802600:	bf 00 00 00 00       	mov    $0x0,%edi
+  802605:	48 b8 84 44 80 00 00 	movabs $0x804484,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_env_set_reclaim: %i", res);
+  802611:	85 c0                	test   %eax,%eax
+  802613:	78 0c                	js     802621 <umain+0x9f>
+
+    serve();
+  802615:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_env_set_reclaim: %i", res);
+  802621:	89 c1                	mov    %eax,%ecx
+  802623:	48 ba f2 6a 80 00 00 	movabs $0x806af2,%rdx
+  80262a:	00 00 00 
+  80262d:	be f6 01 00 00       	mov    $0x1f6,%esi
+  802632:	48 bf 98 6a 80 00 00 	movabs $0x806a98,%rdi
+  802639:	00 00 00 
+  80263c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802641:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802648:	00 00 00 
+  80264b:	41 ff d0             	call   *%r8
+
+000000000080264e <check_dir>:
+void
+check_dir(struct File *dir) {
+    uint32_t *blk;
+    struct File *files;
+
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  80264e:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+  802654:	8d 81 ff 0f 00 00    	lea    0xfff(%rcx),%eax
+  80265a:	85 c9                	test   %ecx,%ecx
+  80265c:	0f 49 c1             	cmovns %ecx,%eax
+    for (blockno_t i = 0; i < nblock; ++i) {
+  80265f:	c1 f8 0c             	sar    $0xc,%eax
+  802662:	0f 84 a6 01 00 00    	je     80280e <check_dir+0x1c0>
+check_dir(struct File *dir) {
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+  80266c:	41 57                	push   %r15
+  80266e:	41 56                	push   %r14
+  802670:	41 55                	push   %r13
+  802672:	41 54                	push   %r12
+  802674:	53                   	push   %rbx
+  802675:	48 83 ec 28          	sub    $0x28,%rsp
+  802679:	41 89 c5             	mov    %eax,%r13d
+    for (blockno_t i = 0; i < nblock; ++i) {
+  80267c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                        check_dir(f);
+                    }
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+                        continue;
+                    }
+                    assert(!block_is_free(*pdiskbno));
+  802682:	49 89 fe             	mov    %rdi,%r14
+  802685:	e9 2d 01 00 00       	jmp    8027b7 <check_dir+0x169>
+                        check_dir(f);
+  80268a:	4c 89 e7             	mov    %r12,%rdi
+  80268d:	48 b8 4e 26 80 00 00 	movabs $0x80264e,%rax
+  802694:	00 00 00 
+  802697:	ff d0                	call   *%rax
+  802699:	eb 26                	jmp    8026c1 <check_dir+0x73>
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  80269b:	41 83 c6 01          	add    $0x1,%r14d
+  80269f:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  8026a6:	00 
+  8026a7:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8026ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026b1:	41 39 c6             	cmp    %eax,%r14d
+  8026b4:	73 7e                	jae    802734 <check_dir+0xe6>
+                    if (f->f_type == FTYPE_DIR) {
+  8026b6:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  8026bd:	00 01 
+  8026bf:	74 c9                	je     80268a <check_dir+0x3c>
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+  8026c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c6:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8026ca:	44 89 f6             	mov    %r14d,%esi
+  8026cd:	4c 89 e7             	mov    %r12,%rdi
+  8026d0:	48 b8 30 0f 80 00 00 	movabs $0x800f30,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+  8026dc:	85 c0                	test   %eax,%eax
+  8026de:	78 bb                	js     80269b <check_dir+0x4d>
+  8026e0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026e4:	48 85 c0             	test   %rax,%rax
+  8026e7:	74 b2                	je     80269b <check_dir+0x4d>
+  8026e9:	8b 38                	mov    (%rax),%edi
+  8026eb:	85 ff                	test   %edi,%edi
+  8026ed:	74 ac                	je     80269b <check_dir+0x4d>
+                    assert(!block_is_free(*pdiskbno));
+  8026ef:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+  8026fb:	84 c0                	test   %al,%al
+  8026fd:	74 9c                	je     80269b <check_dir+0x4d>
+  8026ff:	48 b9 91 6b 80 00 00 	movabs $0x806b91,%rcx
+  802706:	00 00 00 
+  802709:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802710:	00 00 00 
+  802713:	be 28 00 00 00       	mov    $0x28,%esi
+  802718:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  80271f:	00 00 00 
+  802722:	b8 00 00 00 00       	mov    $0x0,%eax
+  802727:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  80272e:	00 00 00 
+  802731:	41 ff d0             	call   *%r8
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  802734:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  80273b:	4c 39 fb             	cmp    %r15,%rbx
+  80273e:	74 66                	je     8027a6 <check_dir+0x158>
+            struct File *f = &(files[j]);
+  802740:	49 89 dc             	mov    %rbx,%r12
+            if (strcmp(f->f_name, "\0") != 0) {
+  802743:	48 be 73 6b 80 00 00 	movabs $0x806b73,%rsi
+  80274a:	00 00 00 
+  80274d:	48 89 df             	mov    %rbx,%rdi
+  802750:	48 b8 4f 3b 80 00 00 	movabs $0x803b4f,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	74 d4                	je     802734 <check_dir+0xe6>
+                blockno_t *pdiskbno = NULL;
+  802760:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802767:	00 
+                cprintf("checking consistency of %s\n", f->f_name);
+  802768:	48 89 de             	mov    %rbx,%rsi
+  80276b:	48 bf 75 6b 80 00 00 	movabs $0x806b75,%rdi
+  802772:	00 00 00 
+  802775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277a:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  802781:	00 00 00 
+  802784:	ff d2                	call   *%rdx
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  802786:	48 63 83 80 00 00 00 	movslq 0x80(%rbx),%rax
+  80278d:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  802793:	48 c1 e8 0c          	shr    $0xc,%rax
+  802797:	85 c0                	test   %eax,%eax
+  802799:	74 99                	je     802734 <check_dir+0xe6>
+  80279b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8027a1:	e9 10 ff ff ff       	jmp    8026b6 <check_dir+0x68>
+  8027a6:	44 8b 65 bc          	mov    -0x44(%rbp),%r12d
+  8027aa:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+    for (blockno_t i = 0; i < nblock; ++i) {
+  8027ae:	41 83 c4 01          	add    $0x1,%r12d
+  8027b2:	45 39 e5             	cmp    %r12d,%r13d
+  8027b5:	74 48                	je     8027ff <check_dir+0x1b1>
+        if (file_block_walk(dir, i, &blk, 0) < 0) continue;
+  8027b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027bc:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8027c0:	44 89 e6             	mov    %r12d,%esi
+  8027c3:	4c 89 f7             	mov    %r14,%rdi
+  8027c6:	48 b8 30 0f 80 00 00 	movabs $0x800f30,%rax
+  8027cd:	00 00 00 
+  8027d0:	ff d0                	call   *%rax
+  8027d2:	85 c0                	test   %eax,%eax
+  8027d4:	78 d8                	js     8027ae <check_dir+0x160>
+        files = (struct File *)diskaddr(*blk);
+  8027d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027da:	8b 38                	mov    (%rax),%edi
+  8027dc:	48 b8 41 03 80 00 00 	movabs $0x800341,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+  8027e8:	48 89 c3             	mov    %rax,%rbx
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  8027eb:	4c 8d b8 00 10 00 00 	lea    0x1000(%rax),%r15
+            if (strcmp(f->f_name, "\0") != 0) {
+  8027f2:	44 89 65 bc          	mov    %r12d,-0x44(%rbp)
+  8027f6:	4c 89 75 b0          	mov    %r14,-0x50(%rbp)
+  8027fa:	e9 41 ff ff ff       	jmp    802740 <check_dir+0xf2>
+                }
+            }
+        }
+    }
+}
+  8027ff:	48 83 c4 28          	add    $0x28,%rsp
+  802803:	5b                   	pop    %rbx
+  802804:	41 5c                	pop    %r12
+  802806:	41 5d                	pop    %r13
+  802808:	41 5e                	pop    %r14
+  80280a:	41 5f                	pop    %r15
+  80280c:	5d                   	pop    %rbp
+  80280d:	c3                   	ret
+  80280e:	c3                   	ret
+
+000000000080280f <fs_test>:
+
+void
+fs_test(void) {
+  80280f:	55                   	push   %rbp
+  802810:	48 89 e5             	mov    %rsp,%rbp
+  802813:	53                   	push   %rbx
+  802814:	48 83 ec 18          	sub    $0x18,%rsp
+    int r;
+    char *blk;
+    uint32_t *bits;
+
+    /* Back up bitmap */
+    if ((r = sys_alloc_region(0, (void *)PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+  802818:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80281d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802822:	be 00 10 00 00       	mov    $0x1000,%esi
+  802827:	bf 00 00 00 00       	mov    $0x0,%edi
+  80282c:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  802833:	00 00 00 
+  802836:	ff d0                	call   *%rax
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	0f 88 34 03 00 00    	js     802b74 <fs_test+0x365>
+        panic("sys_page_alloc: %i", r);
+    bits = (uint32_t *)PAGE_SIZE;
+    memmove(bits, bitmap, PAGE_SIZE);
+  802840:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802845:	48 b8 20 50 82 00 00 	movabs $0x825020,%rax
+  80284c:	00 00 00 
+  80284f:	48 8b 30             	mov    (%rax),%rsi
+  802852:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802857:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  80285e:	00 00 00 
+  802861:	ff d0                	call   *%rax
+    /* Allocate block */
+    if (!(r = alloc_block()))
+  802863:	48 b8 5d 0c 80 00 00 	movabs $0x800c5d,%rax
+  80286a:	00 00 00 
+  80286d:	ff d0                	call   *%rax
+  80286f:	89 c1                	mov    %eax,%ecx
+  802871:	85 c0                	test   %eax,%eax
+  802873:	0f 84 28 03 00 00    	je     802ba1 <fs_test+0x392>
+        panic("alloc_block: %i", -E_NO_DISK);
+    /* Check that block was free */
+    assert(TSTBIT(bits, r));
+  802879:	8d 50 1f             	lea    0x1f(%rax),%edx
+  80287c:	0f 49 d0             	cmovns %eax,%edx
+  80287f:	c1 fa 05             	sar    $0x5,%edx
+  802882:	48 63 d2             	movslq %edx,%rdx
+  802885:	b8 01 00 00 00       	mov    $0x1,%eax
+  80288a:	d3 e0                	shl    %cl,%eax
+  80288c:	89 c1                	mov    %eax,%ecx
+  80288e:	23 04 95 00 10 00 00 	and    0x1000(,%rdx,4),%eax
+  802895:	0f 84 36 03 00 00    	je     802bd1 <fs_test+0x3c2>
+    /* And is not free any more */
+    assert(!TSTBIT(bitmap, r));
+  80289b:	48 a1 20 50 82 00 00 	movabs 0x825020,%rax
+  8028a2:	00 00 00 
+  8028a5:	23 0c 90             	and    (%rax,%rdx,4),%ecx
+  8028a8:	0f 85 53 03 00 00    	jne    802c01 <fs_test+0x3f2>
+    cprintf("alloc_block is good\n");
+  8028ae:	48 bf eb 6b 80 00 00 	movabs $0x806beb,%rdi
+  8028b5:	00 00 00 
+  8028b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bd:	48 bb 56 31 80 00 00 	movabs $0x803156,%rbx
+  8028c4:	00 00 00 
+  8028c7:	ff d3                	call   *%rbx
+    check_dir(&super->s_root);
+  8028c9:	48 a1 28 50 82 00 00 	movabs 0x825028,%rax
+  8028d0:	00 00 00 
+  8028d3:	48 8d 78 08          	lea    0x8(%rax),%rdi
+  8028d7:	48 b8 4e 26 80 00 00 	movabs $0x80264e,%rax
+  8028de:	00 00 00 
+  8028e1:	ff d0                	call   *%rax
+    check_consistency();
+    cprintf("fs consistency is good\n");
+  8028e3:	48 bf 00 6c 80 00 00 	movabs $0x806c00,%rdi
+  8028ea:	00 00 00 
+  8028ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f2:	ff d3                	call   *%rbx
+
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  8028f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028f8:	48 bf 18 6c 80 00 00 	movabs $0x806c18,%rdi
+  8028ff:	00 00 00 
+  802902:	48 b8 2b 14 80 00 00 	movabs $0x80142b,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+  80290e:	85 c0                	test   %eax,%eax
+  802910:	0f 88 20 03 00 00    	js     802c36 <fs_test+0x427>
+        panic("file_open /not-found: %i", r);
+    else if (r == 0)
+  802916:	0f 84 50 03 00 00    	je     802c6c <fs_test+0x45d>
+        panic("file_open /not-found succeeded!");
+    if ((r = file_open("/newmotd", &f)) < 0)
+  80291c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802920:	48 bf 3c 6c 80 00 00 	movabs $0x806c3c,%rdi
+  802927:	00 00 00 
+  80292a:	48 b8 2b 14 80 00 00 	movabs $0x80142b,%rax
+  802931:	00 00 00 
+  802934:	ff d0                	call   *%rax
+  802936:	85 c0                	test   %eax,%eax
+  802938:	0f 88 53 03 00 00    	js     802c91 <fs_test+0x482>
+        panic("file_open /newmotd: %i", r);
+    cprintf("file_open is good\n");
+  80293e:	48 bf 5c 6c 80 00 00 	movabs $0x806c5c,%rdi
+  802945:	00 00 00 
+  802948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294d:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  802954:	00 00 00 
+  802957:	ff d2                	call   *%rdx
+
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  802959:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80295d:	be 00 00 00 00       	mov    $0x0,%esi
+  802962:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802966:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	85 c0                	test   %eax,%eax
+  802974:	0f 88 44 03 00 00    	js     802cbe <fs_test+0x4af>
+        panic("file_get_block: %i", r);
+    if (strcmp(blk, msg) != 0)
+  80297a:	48 be 70 6d 80 00 00 	movabs $0x806d70,%rsi
+  802981:	00 00 00 
+  802984:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802988:	48 b8 4f 3b 80 00 00 	movabs $0x803b4f,%rax
+  80298f:	00 00 00 
+  802992:	ff d0                	call   *%rax
+  802994:	85 c0                	test   %eax,%eax
+  802996:	0f 85 4f 03 00 00    	jne    802ceb <fs_test+0x4dc>
+        panic("file_get_block returned wrong data");
+    cprintf("file_get_block is good\n");
+  80299c:	48 bf 82 6c 80 00 00 	movabs $0x806c82,%rdi
+  8029a3:	00 00 00 
+  8029a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ab:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  8029b2:	00 00 00 
+  8029b5:	ff d2                	call   *%rdx
+
+    *(volatile char *)blk = *(volatile char *)blk;
+  8029b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029bb:	0f b6 10             	movzbl (%rax),%edx
+  8029be:	88 10                	mov    %dl,(%rax)
+    assert(is_page_dirty(blk));
+  8029c0:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8029c4:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  8029cb:	00 00 00 
+  8029ce:	ff d0                	call   *%rax
+  8029d0:	84 c0                	test   %al,%al
+  8029d2:	0f 84 3d 03 00 00    	je     802d15 <fs_test+0x506>
+    file_flush(f);
+  8029d8:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8029dc:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  8029e8:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8029ec:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  8029f3:	00 00 00 
+  8029f6:	ff d0                	call   *%rax
+  8029f8:	84 c0                	test   %al,%al
+  8029fa:	0f 85 45 03 00 00    	jne    802d45 <fs_test+0x536>
+    cprintf("file_flush is good\n");
+  802a00:	48 bf ae 6c 80 00 00 	movabs $0x806cae,%rdi
+  802a07:	00 00 00 
+  802a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0f:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  802a16:	00 00 00 
+  802a19:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, 0)) < 0)
+  802a1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a20:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802a24:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+  802a30:	85 c0                	test   %eax,%eax
+  802a32:	0f 88 42 03 00 00    	js     802d7a <fs_test+0x56b>
+        panic("file_set_size: %i", r);
+    assert(f->f_direct[0] == 0);
+  802a38:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802a3c:	83 bf 88 00 00 00 00 	cmpl   $0x0,0x88(%rdi)
+  802a43:	0f 85 5e 03 00 00    	jne    802da7 <fs_test+0x598>
+    assert(!is_page_dirty(f));
+  802a49:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+  802a55:	84 c0                	test   %al,%al
+  802a57:	0f 85 7f 03 00 00    	jne    802ddc <fs_test+0x5cd>
+    cprintf("file_truncate is good\n");
+  802a5d:	48 bf fa 6c 80 00 00 	movabs $0x806cfa,%rdi
+  802a64:	00 00 00 
+  802a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6c:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  802a73:	00 00 00 
+  802a76:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, strlen(msg))) < 0)
+  802a78:	48 bf 70 6d 80 00 00 	movabs $0x806d70,%rdi
+  802a7f:	00 00 00 
+  802a82:	48 b8 4f 3a 80 00 00 	movabs $0x803a4f,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+  802a8e:	89 c6                	mov    %eax,%esi
+  802a90:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802a94:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  802a9b:	00 00 00 
+  802a9e:	ff d0                	call   *%rax
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	0f 88 69 03 00 00    	js     802e11 <fs_test+0x602>
+        panic("file_set_size 2: %i", r);
+    assert(!is_page_dirty(f));
+  802aa8:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802aac:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  802ab3:	00 00 00 
+  802ab6:	ff d0                	call   *%rax
+  802ab8:	84 c0                	test   %al,%al
+  802aba:	0f 85 7e 03 00 00    	jne    802e3e <fs_test+0x62f>
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  802ac0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802ac4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac9:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802acd:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  802ad4:	00 00 00 
+  802ad7:	ff d0                	call   *%rax
+  802ad9:	85 c0                	test   %eax,%eax
+  802adb:	0f 88 92 03 00 00    	js     802e73 <fs_test+0x664>
+        panic("file_get_block 2: %i", r);
+    strcpy(blk, msg);
+  802ae1:	48 be 70 6d 80 00 00 	movabs $0x806d70,%rsi
+  802ae8:	00 00 00 
+  802aeb:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802aef:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+    assert(is_page_dirty(blk));
+  802afb:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802aff:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  802b06:	00 00 00 
+  802b09:	ff d0                	call   *%rax
+  802b0b:	84 c0                	test   %al,%al
+  802b0d:	0f 84 8d 03 00 00    	je     802ea0 <fs_test+0x691>
+    file_flush(f);
+  802b13:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802b17:	48 b8 37 17 80 00 00 	movabs $0x801737,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  802b23:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802b27:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  802b2e:	00 00 00 
+  802b31:	ff d0                	call   *%rax
+  802b33:	84 c0                	test   %al,%al
+  802b35:	0f 85 95 03 00 00    	jne    802ed0 <fs_test+0x6c1>
+    assert(!is_page_dirty(f));
+  802b3b:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802b3f:	48 b8 b4 61 80 00 00 	movabs $0x8061b4,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+  802b4b:	84 c0                	test   %al,%al
+  802b4d:	0f 85 b2 03 00 00    	jne    802f05 <fs_test+0x6f6>
+    cprintf("file rewrite is good\n");
+  802b53:	48 bf 3a 6d 80 00 00 	movabs $0x806d3a,%rdi
+  802b5a:	00 00 00 
+  802b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b62:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  802b69:	00 00 00 
+  802b6c:	ff d2                	call   *%rdx
+}
+  802b6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b72:	c9                   	leave
+  802b73:	c3                   	ret
+        panic("sys_page_alloc: %i", r);
+  802b74:	89 c1                	mov    %eax,%ecx
+  802b76:	48 ba b5 6b 80 00 00 	movabs $0x806bb5,%rdx
+  802b7d:	00 00 00 
+  802b80:	be 38 00 00 00       	mov    $0x38,%esi
+  802b85:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802b8c:	00 00 00 
+  802b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b94:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802b9b:	00 00 00 
+  802b9e:	41 ff d0             	call   *%r8
+        panic("alloc_block: %i", -E_NO_DISK);
+  802ba1:	b9 f3 ff ff ff       	mov    $0xfffffff3,%ecx
+  802ba6:	48 ba e2 69 80 00 00 	movabs $0x8069e2,%rdx
+  802bad:	00 00 00 
+  802bb0:	be 3d 00 00 00       	mov    $0x3d,%esi
+  802bb5:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802bbc:	00 00 00 
+  802bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc4:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802bcb:	00 00 00 
+  802bce:	41 ff d0             	call   *%r8
+    assert(TSTBIT(bits, r));
+  802bd1:	48 b9 c8 6b 80 00 00 	movabs $0x806bc8,%rcx
+  802bd8:	00 00 00 
+  802bdb:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802be2:	00 00 00 
+  802be5:	be 3f 00 00 00       	mov    $0x3f,%esi
+  802bea:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802bf1:	00 00 00 
+  802bf4:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802bfb:	00 00 00 
+  802bfe:	41 ff d0             	call   *%r8
+    assert(!TSTBIT(bitmap, r));
+  802c01:	48 b9 d8 6b 80 00 00 	movabs $0x806bd8,%rcx
+  802c08:	00 00 00 
+  802c0b:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802c12:	00 00 00 
+  802c15:	be 41 00 00 00       	mov    $0x41,%esi
+  802c1a:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802c21:	00 00 00 
+  802c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c29:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802c30:	00 00 00 
+  802c33:	41 ff d0             	call   *%r8
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  802c36:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802c39:	0f 84 dd fc ff ff    	je     80291c <fs_test+0x10d>
+        panic("file_open /not-found: %i", r);
+  802c3f:	89 c1                	mov    %eax,%ecx
+  802c41:	48 ba 23 6c 80 00 00 	movabs $0x806c23,%rdx
+  802c48:	00 00 00 
+  802c4b:	be 47 00 00 00       	mov    $0x47,%esi
+  802c50:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802c57:	00 00 00 
+  802c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5f:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802c66:	00 00 00 
+  802c69:	41 ff d0             	call   *%r8
+        panic("file_open /not-found succeeded!");
+  802c6c:	48 ba 50 6d 80 00 00 	movabs $0x806d50,%rdx
+  802c73:	00 00 00 
+  802c76:	be 49 00 00 00       	mov    $0x49,%esi
+  802c7b:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802c82:	00 00 00 
+  802c85:	48 b9 06 30 80 00 00 	movabs $0x803006,%rcx
+  802c8c:	00 00 00 
+  802c8f:	ff d1                	call   *%rcx
+        panic("file_open /newmotd: %i", r);
+  802c91:	89 c1                	mov    %eax,%ecx
+  802c93:	48 ba 45 6c 80 00 00 	movabs $0x806c45,%rdx
+  802c9a:	00 00 00 
+  802c9d:	be 4b 00 00 00       	mov    $0x4b,%esi
+  802ca2:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802ca9:	00 00 00 
+  802cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb1:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802cb8:	00 00 00 
+  802cbb:	41 ff d0             	call   *%r8
+        panic("file_get_block: %i", r);
+  802cbe:	89 c1                	mov    %eax,%ecx
+  802cc0:	48 ba 6f 6c 80 00 00 	movabs $0x806c6f,%rdx
+  802cc7:	00 00 00 
+  802cca:	be 4f 00 00 00       	mov    $0x4f,%esi
+  802ccf:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802cd6:	00 00 00 
+  802cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cde:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802ce5:	00 00 00 
+  802ce8:	41 ff d0             	call   *%r8
+        panic("file_get_block returned wrong data");
+  802ceb:	48 ba 98 6d 80 00 00 	movabs $0x806d98,%rdx
+  802cf2:	00 00 00 
+  802cf5:	be 51 00 00 00       	mov    $0x51,%esi
+  802cfa:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802d01:	00 00 00 
+  802d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d09:	48 b9 06 30 80 00 00 	movabs $0x803006,%rcx
+  802d10:	00 00 00 
+  802d13:	ff d1                	call   *%rcx
+    assert(is_page_dirty(blk));
+  802d15:	48 b9 9b 6c 80 00 00 	movabs $0x806c9b,%rcx
+  802d1c:	00 00 00 
+  802d1f:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802d26:	00 00 00 
+  802d29:	be 55 00 00 00       	mov    $0x55,%esi
+  802d2e:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802d35:	00 00 00 
+  802d38:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802d3f:	00 00 00 
+  802d42:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  802d45:	48 b9 9a 6c 80 00 00 	movabs $0x806c9a,%rcx
+  802d4c:	00 00 00 
+  802d4f:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802d56:	00 00 00 
+  802d59:	be 57 00 00 00       	mov    $0x57,%esi
+  802d5e:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802d65:	00 00 00 
+  802d68:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6d:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802d74:	00 00 00 
+  802d77:	41 ff d0             	call   *%r8
+        panic("file_set_size: %i", r);
+  802d7a:	89 c1                	mov    %eax,%ecx
+  802d7c:	48 ba c2 6c 80 00 00 	movabs $0x806cc2,%rdx
+  802d83:	00 00 00 
+  802d86:	be 5b 00 00 00       	mov    $0x5b,%esi
+  802d8b:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802d92:	00 00 00 
+  802d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9a:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802da1:	00 00 00 
+  802da4:	41 ff d0             	call   *%r8
+    assert(f->f_direct[0] == 0);
+  802da7:	48 b9 d4 6c 80 00 00 	movabs $0x806cd4,%rcx
+  802dae:	00 00 00 
+  802db1:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802db8:	00 00 00 
+  802dbb:	be 5c 00 00 00       	mov    $0x5c,%esi
+  802dc0:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802dc7:	00 00 00 
+  802dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcf:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802dd6:	00 00 00 
+  802dd9:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  802ddc:	48 b9 e8 6c 80 00 00 	movabs $0x806ce8,%rcx
+  802de3:	00 00 00 
+  802de6:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802ded:	00 00 00 
+  802df0:	be 5d 00 00 00       	mov    $0x5d,%esi
+  802df5:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802dfc:	00 00 00 
+  802dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e04:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802e0b:	00 00 00 
+  802e0e:	41 ff d0             	call   *%r8
+        panic("file_set_size 2: %i", r);
+  802e11:	89 c1                	mov    %eax,%ecx
+  802e13:	48 ba 11 6d 80 00 00 	movabs $0x806d11,%rdx
+  802e1a:	00 00 00 
+  802e1d:	be 61 00 00 00       	mov    $0x61,%esi
+  802e22:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802e29:	00 00 00 
+  802e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e31:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802e38:	00 00 00 
+  802e3b:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  802e3e:	48 b9 e8 6c 80 00 00 	movabs $0x806ce8,%rcx
+  802e45:	00 00 00 
+  802e48:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802e4f:	00 00 00 
+  802e52:	be 62 00 00 00       	mov    $0x62,%esi
+  802e57:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802e5e:	00 00 00 
+  802e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e66:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802e6d:	00 00 00 
+  802e70:	41 ff d0             	call   *%r8
+        panic("file_get_block 2: %i", r);
+  802e73:	89 c1                	mov    %eax,%ecx
+  802e75:	48 ba 25 6d 80 00 00 	movabs $0x806d25,%rdx
+  802e7c:	00 00 00 
+  802e7f:	be 64 00 00 00       	mov    $0x64,%esi
+  802e84:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802e8b:	00 00 00 
+  802e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e93:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802e9a:	00 00 00 
+  802e9d:	41 ff d0             	call   *%r8
+    assert(is_page_dirty(blk));
+  802ea0:	48 b9 9b 6c 80 00 00 	movabs $0x806c9b,%rcx
+  802ea7:	00 00 00 
+  802eaa:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802eb1:	00 00 00 
+  802eb4:	be 66 00 00 00       	mov    $0x66,%esi
+  802eb9:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802ec0:	00 00 00 
+  802ec3:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802eca:	00 00 00 
+  802ecd:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  802ed0:	48 b9 9a 6c 80 00 00 	movabs $0x806c9a,%rcx
+  802ed7:	00 00 00 
+  802eda:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802ee1:	00 00 00 
+  802ee4:	be 68 00 00 00       	mov    $0x68,%esi
+  802ee9:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802ef0:	00 00 00 
+  802ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef8:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802eff:	00 00 00 
+  802f02:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  802f05:	48 b9 e8 6c 80 00 00 	movabs $0x806ce8,%rcx
+  802f0c:	00 00 00 
+  802f0f:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  802f16:	00 00 00 
+  802f19:	be 69 00 00 00       	mov    $0x69,%esi
+  802f1e:	48 bf ab 6b 80 00 00 	movabs $0x806bab,%rdi
+  802f25:	00 00 00 
+  802f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2d:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  802f34:	00 00 00 
+  802f37:	41 ff d0             	call   *%r8
+
+0000000000802f3a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  802f3a:	55                   	push   %rbp
+  802f3b:	48 89 e5             	mov    %rsp,%rbp
+  802f3e:	41 56                	push   %r14
+  802f40:	41 55                	push   %r13
+  802f42:	41 54                	push   %r12
+  802f44:	53                   	push   %rbx
+  802f45:	41 89 fd             	mov    %edi,%r13d
+  802f48:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  802f4b:	48 ba 58 c1 80 00 00 	movabs $0x80c158,%rdx
+  802f52:	00 00 00 
+  802f55:	48 b8 58 c1 80 00 00 	movabs $0x80c158,%rax
+  802f5c:	00 00 00 
+  802f5f:	48 39 c2             	cmp    %rax,%rdx
+  802f62:	73 17                	jae    802f7b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  802f64:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  802f67:	49 89 c4             	mov    %rax,%r12
+  802f6a:	48 83 c3 08          	add    $0x8,%rbx
+  802f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f73:	ff 53 f8             	call   *-0x8(%rbx)
+  802f76:	4c 39 e3             	cmp    %r12,%rbx
+  802f79:	72 ef                	jb     802f6a <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  802f7b:	48 b8 1a 41 80 00 00 	movabs $0x80411a,%rax
+  802f82:	00 00 00 
+  802f85:	ff d0                	call   *%rax
+  802f87:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f8c:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  802f93:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f9a:	00 00 00 
+  802f9d:	48 01 d0             	add    %rdx,%rax
+  802fa0:	48 a3 40 60 82 00 00 	movabs %rax,0x826040
+  802fa7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  802faa:	45 85 ed             	test   %r13d,%r13d
+  802fad:	7e 0d                	jle    802fbc <libmain+0x82>
+  802faf:	49 8b 06             	mov    (%r14),%rax
+  802fb2:	48 a3 80 c0 80 00 00 	movabs %rax,0x80c080
+  802fb9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  802fbc:	4c 89 f6             	mov    %r14,%rsi
+  802fbf:	44 89 ef             	mov    %r13d,%edi
+  802fc2:	48 b8 82 25 80 00 00 	movabs $0x802582,%rax
+  802fc9:	00 00 00 
+  802fcc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  802fce:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  802fd5:	00 00 00 
+  802fd8:	ff d0                	call   *%rax
+#endif
+}
+  802fda:	5b                   	pop    %rbx
+  802fdb:	41 5c                	pop    %r12
+  802fdd:	41 5d                	pop    %r13
+  802fdf:	41 5e                	pop    %r14
+  802fe1:	5d                   	pop    %rbp
+  802fe2:	c3                   	ret
+
+0000000000802fe3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  802fe3:	55                   	push   %rbp
+  802fe4:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  802fe7:	48 b8 0a 50 80 00 00 	movabs $0x80500a,%rax
+  802fee:	00 00 00 
+  802ff1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  802ff3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff8:	48 b8 a9 40 80 00 00 	movabs $0x8040a9,%rax
+  802fff:	00 00 00 
+  803002:	ff d0                	call   *%rax
+}
+  803004:	5d                   	pop    %rbp
+  803005:	c3                   	ret
+
+0000000000803006 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803006:	55                   	push   %rbp
+  803007:	48 89 e5             	mov    %rsp,%rbp
+  80300a:	41 56                	push   %r14
+  80300c:	41 55                	push   %r13
+  80300e:	41 54                	push   %r12
+  803010:	53                   	push   %rbx
+  803011:	48 83 ec 50          	sub    $0x50,%rsp
+  803015:	49 89 fc             	mov    %rdi,%r12
+  803018:	41 89 f5             	mov    %esi,%r13d
+  80301b:	48 89 d3             	mov    %rdx,%rbx
+  80301e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803022:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803026:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80302a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803031:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803035:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803039:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80303d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803041:	48 b8 80 c0 80 00 00 	movabs $0x80c080,%rax
+  803048:	00 00 00 
+  80304b:	4c 8b 30             	mov    (%rax),%r14
+  80304e:	48 b8 1a 41 80 00 00 	movabs $0x80411a,%rax
+  803055:	00 00 00 
+  803058:	ff d0                	call   *%rax
+  80305a:	89 c6                	mov    %eax,%esi
+  80305c:	45 89 e8             	mov    %r13d,%r8d
+  80305f:	4c 89 e1             	mov    %r12,%rcx
+  803062:	4c 89 f2             	mov    %r14,%rdx
+  803065:	48 bf c8 6d 80 00 00 	movabs $0x806dc8,%rdi
+  80306c:	00 00 00 
+  80306f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803074:	49 bc 56 31 80 00 00 	movabs $0x803156,%r12
+  80307b:	00 00 00 
+  80307e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803081:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803085:	48 89 df             	mov    %rbx,%rdi
+  803088:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  80308f:	00 00 00 
+  803092:	ff d0                	call   *%rax
+    cprintf("\n");
+  803094:	48 bf 18 69 80 00 00 	movabs $0x806918,%rdi
+  80309b:	00 00 00 
+  80309e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8030a6:	cc                   	int3
+  8030a7:	eb fd                	jmp    8030a6 <_panic+0xa0>
+
+00000000008030a9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8030a9:	55                   	push   %rbp
+  8030aa:	48 89 e5             	mov    %rsp,%rbp
+  8030ad:	53                   	push   %rbx
+  8030ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8030b2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8030b5:	8b 06                	mov    (%rsi),%eax
+  8030b7:	8d 50 01             	lea    0x1(%rax),%edx
+  8030ba:	89 16                	mov    %edx,(%rsi)
+  8030bc:	48 98                	cltq
+  8030be:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8030c3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8030c9:	74 0a                	je     8030d5 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8030cb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8030cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030d3:	c9                   	leave
+  8030d4:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8030d5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8030d9:	be ff 00 00 00       	mov    $0xff,%esi
+  8030de:	48 b8 0a 40 80 00 00 	movabs $0x80400a,%rax
+  8030e5:	00 00 00 
+  8030e8:	ff d0                	call   *%rax
+        state->offset = 0;
+  8030ea:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8030f0:	eb d9                	jmp    8030cb <putch+0x22>
+
+00000000008030f2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030f2:	55                   	push   %rbp
+  8030f3:	48 89 e5             	mov    %rsp,%rbp
+  8030f6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8030fd:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803100:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803107:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80310c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803111:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803114:	48 89 f1             	mov    %rsi,%rcx
+  803117:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80311e:	48 bf a9 30 80 00 00 	movabs $0x8030a9,%rdi
+  803125:	00 00 00 
+  803128:	48 b8 a6 32 80 00 00 	movabs $0x8032a6,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803134:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80313b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803142:	48 b8 0a 40 80 00 00 	movabs $0x80400a,%rax
+  803149:	00 00 00 
+  80314c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80314e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803154:	c9                   	leave
+  803155:	c3                   	ret
+
+0000000000803156 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803156:	55                   	push   %rbp
+  803157:	48 89 e5             	mov    %rsp,%rbp
+  80315a:	48 83 ec 50          	sub    $0x50,%rsp
+  80315e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803162:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803166:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80316a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80316e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803172:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803179:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80317d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803181:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803185:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  803189:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80318d:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  803194:	00 00 00 
+  803197:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803199:	c9                   	leave
+  80319a:	c3                   	ret
+
+000000000080319b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80319b:	55                   	push   %rbp
+  80319c:	48 89 e5             	mov    %rsp,%rbp
+  80319f:	41 57                	push   %r15
+  8031a1:	41 56                	push   %r14
+  8031a3:	41 55                	push   %r13
+  8031a5:	41 54                	push   %r12
+  8031a7:	53                   	push   %rbx
+  8031a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8031ac:	49 89 fc             	mov    %rdi,%r12
+  8031af:	49 89 f5             	mov    %rsi,%r13
+  8031b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8031b6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8031b9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8031bc:	41 89 cf             	mov    %ecx,%r15d
+  8031bf:	4c 39 fa             	cmp    %r15,%rdx
+  8031c2:	73 5b                	jae    80321f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8031c4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8031c8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8031cc:	85 db                	test   %ebx,%ebx
+  8031ce:	7e 0e                	jle    8031de <print_num+0x43>
+            putch(padc, put_arg);
+  8031d0:	4c 89 ee             	mov    %r13,%rsi
+  8031d3:	44 89 f7             	mov    %r14d,%edi
+  8031d6:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8031d9:	83 eb 01             	sub    $0x1,%ebx
+  8031dc:	75 f2                	jne    8031d0 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8031de:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8031e2:	48 b9 fc 6d 80 00 00 	movabs $0x806dfc,%rcx
+  8031e9:	00 00 00 
+  8031ec:	48 b8 eb 6d 80 00 00 	movabs $0x806deb,%rax
+  8031f3:	00 00 00 
+  8031f6:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8031fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803203:	49 f7 f7             	div    %r15
+  803206:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80320a:	4c 89 ee             	mov    %r13,%rsi
+  80320d:	41 ff d4             	call   *%r12
+}
+  803210:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803214:	5b                   	pop    %rbx
+  803215:	41 5c                	pop    %r12
+  803217:	41 5d                	pop    %r13
+  803219:	41 5e                	pop    %r14
+  80321b:	41 5f                	pop    %r15
+  80321d:	5d                   	pop    %rbp
+  80321e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80321f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803223:	ba 00 00 00 00       	mov    $0x0,%edx
+  803228:	49 f7 f7             	div    %r15
+  80322b:	48 83 ec 08          	sub    $0x8,%rsp
+  80322f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803233:	52                   	push   %rdx
+  803234:	45 0f be c9          	movsbl %r9b,%r9d
+  803238:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80323c:	48 89 c2             	mov    %rax,%rdx
+  80323f:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  803246:	00 00 00 
+  803249:	ff d0                	call   *%rax
+  80324b:	48 83 c4 10          	add    $0x10,%rsp
+  80324f:	eb 8d                	jmp    8031de <print_num+0x43>
+
+0000000000803251 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803251:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803255:	48 8b 06             	mov    (%rsi),%rax
+  803258:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80325c:	73 0a                	jae    803268 <sprintputch+0x17>
+        *state->start++ = ch;
+  80325e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803262:	48 89 16             	mov    %rdx,(%rsi)
+  803265:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  803268:	c3                   	ret
+
+0000000000803269 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803269:	55                   	push   %rbp
+  80326a:	48 89 e5             	mov    %rsp,%rbp
+  80326d:	48 83 ec 50          	sub    $0x50,%rsp
+  803271:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803275:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803279:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80327d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803284:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803288:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80328c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803290:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  803294:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803298:	48 b8 a6 32 80 00 00 	movabs $0x8032a6,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+00000000008032a6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8032a6:	55                   	push   %rbp
+  8032a7:	48 89 e5             	mov    %rsp,%rbp
+  8032aa:	41 57                	push   %r15
+  8032ac:	41 56                	push   %r14
+  8032ae:	41 55                	push   %r13
+  8032b0:	41 54                	push   %r12
+  8032b2:	53                   	push   %rbx
+  8032b3:	48 83 ec 38          	sub    $0x38,%rsp
+  8032b7:	49 89 fe             	mov    %rdi,%r14
+  8032ba:	49 89 f5             	mov    %rsi,%r13
+  8032bd:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8032c0:	48 8b 01             	mov    (%rcx),%rax
+  8032c3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8032c7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8032cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032cf:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8032d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8032d7:	eb 0d                	jmp    8032e6 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8032d9:	40 0f b6 ff          	movzbl %dil,%edi
+  8032dd:	4c 89 ee             	mov    %r13,%rsi
+  8032e0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8032e3:	4c 89 e3             	mov    %r12,%rbx
+  8032e6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8032ea:	0f b6 3b             	movzbl (%rbx),%edi
+  8032ed:	40 80 ff 25          	cmp    $0x25,%dil
+  8032f1:	74 14                	je     803307 <vprintfmt+0x61>
+            if (!ch) return;
+  8032f3:	40 84 ff             	test   %dil,%dil
+  8032f6:	75 e1                	jne    8032d9 <vprintfmt+0x33>
+}
+  8032f8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8032fc:	5b                   	pop    %rbx
+  8032fd:	41 5c                	pop    %r12
+  8032ff:	41 5d                	pop    %r13
+  803301:	41 5e                	pop    %r14
+  803303:	41 5f                	pop    %r15
+  803305:	5d                   	pop    %rbp
+  803306:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  803307:	be 00 00 00 00       	mov    $0x0,%esi
+  80330c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803310:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803315:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80331b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803322:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803326:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80332b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803330:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803333:	83 e8 23             	sub    $0x23,%eax
+  803336:	3c 57                	cmp    $0x57,%al
+  803338:	0f 87 67 06 00 00    	ja     8039a5 <vprintfmt+0x6ff>
+  80333e:	0f b6 c0             	movzbl %al,%eax
+  803341:	48 b9 80 6f 80 00 00 	movabs $0x806f80,%rcx
+  803348:	00 00 00 
+  80334b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80334e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803351:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803355:	eb cf                	jmp    803326 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  803357:	49 89 dc             	mov    %rbx,%r12
+  80335a:	be 01 00 00 00       	mov    $0x1,%esi
+  80335f:	eb c5                	jmp    803326 <vprintfmt+0x80>
+            padc = ch;
+  803361:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803365:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803368:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80336b:	eb b9                	jmp    803326 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80336d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803370:	83 f8 2f             	cmp    $0x2f,%eax
+  803373:	77 24                	ja     803399 <vprintfmt+0xf3>
+  803375:	89 c1                	mov    %eax,%ecx
+  803377:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80337b:	83 c0 08             	add    $0x8,%eax
+  80337e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803381:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  803384:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803387:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80338b:	79 99                	jns    803326 <vprintfmt+0x80>
+                width = precision;
+  80338d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  803391:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803397:	eb 8d                	jmp    803326 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  803399:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80339d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8033a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033a5:	eb da                	jmp    803381 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8033a7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8033ac:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8033b0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8033b6:	3c 39                	cmp    $0x39,%al
+  8033b8:	77 1c                	ja     8033d6 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8033ba:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8033be:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8033c2:	0f b6 c0             	movzbl %al,%eax
+  8033c5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8033ca:	0f b6 03             	movzbl (%rbx),%eax
+  8033cd:	3c 39                	cmp    $0x39,%al
+  8033cf:	76 e9                	jbe    8033ba <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8033d1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8033d4:	eb b1                	jmp    803387 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8033d6:	49 89 dc             	mov    %rbx,%r12
+  8033d9:	eb ac                	jmp    803387 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  8033db:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8033de:	85 c9                	test   %ecx,%ecx
+  8033e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e5:	0f 49 c1             	cmovns %ecx,%eax
+  8033e8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8033eb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8033ee:	e9 33 ff ff ff       	jmp    803326 <vprintfmt+0x80>
+            lflag++;
+  8033f3:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8033f6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8033f9:	e9 28 ff ff ff       	jmp    803326 <vprintfmt+0x80>
+            lflag--;
+  8033fe:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803401:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803404:	e9 1d ff ff ff       	jmp    803326 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  803409:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80340c:	83 f8 2f             	cmp    $0x2f,%eax
+  80340f:	77 19                	ja     80342a <vprintfmt+0x184>
+  803411:	89 c2                	mov    %eax,%edx
+  803413:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803417:	83 c0 08             	add    $0x8,%eax
+  80341a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80341d:	8b 3a                	mov    (%rdx),%edi
+  80341f:	4c 89 ee             	mov    %r13,%rsi
+  803422:	41 ff d6             	call   *%r14
+            break;
+  803425:	e9 bc fe ff ff       	jmp    8032e6 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80342a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80342e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803432:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803436:	eb e5                	jmp    80341d <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  803438:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80343b:	83 f8 2f             	cmp    $0x2f,%eax
+  80343e:	77 5a                	ja     80349a <vprintfmt+0x1f4>
+  803440:	89 c2                	mov    %eax,%edx
+  803442:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803446:	83 c0 08             	add    $0x8,%eax
+  803449:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80344c:	8b 02                	mov    (%rdx),%eax
+  80344e:	89 c1                	mov    %eax,%ecx
+  803450:	f7 d9                	neg    %ecx
+  803452:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803455:	83 f9 13             	cmp    $0x13,%ecx
+  803458:	7f 4e                	jg     8034a8 <vprintfmt+0x202>
+  80345a:	48 63 c1             	movslq %ecx,%rax
+  80345d:	48 ba 40 72 80 00 00 	movabs $0x807240,%rdx
+  803464:	00 00 00 
+  803467:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80346b:	48 85 c0             	test   %rax,%rax
+  80346e:	74 38                	je     8034a8 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  803470:	48 89 c1             	mov    %rax,%rcx
+  803473:	48 ba 2f 68 80 00 00 	movabs $0x80682f,%rdx
+  80347a:	00 00 00 
+  80347d:	4c 89 ee             	mov    %r13,%rsi
+  803480:	4c 89 f7             	mov    %r14,%rdi
+  803483:	b8 00 00 00 00       	mov    $0x0,%eax
+  803488:	49 b8 69 32 80 00 00 	movabs $0x803269,%r8
+  80348f:	00 00 00 
+  803492:	41 ff d0             	call   *%r8
+  803495:	e9 4c fe ff ff       	jmp    8032e6 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  80349a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80349e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8034a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034a6:	eb a4                	jmp    80344c <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8034a8:	48 ba 14 6e 80 00 00 	movabs $0x806e14,%rdx
+  8034af:	00 00 00 
+  8034b2:	4c 89 ee             	mov    %r13,%rsi
+  8034b5:	4c 89 f7             	mov    %r14,%rdi
+  8034b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034bd:	49 b8 69 32 80 00 00 	movabs $0x803269,%r8
+  8034c4:	00 00 00 
+  8034c7:	41 ff d0             	call   *%r8
+  8034ca:	e9 17 fe ff ff       	jmp    8032e6 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8034cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8034d5:	77 6c                	ja     803543 <vprintfmt+0x29d>
+  8034d7:	89 c2                	mov    %eax,%edx
+  8034d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034dd:	83 c0 08             	add    $0x8,%eax
+  8034e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034e3:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8034e6:	48 85 f6             	test   %rsi,%rsi
+  8034e9:	48 b8 0d 6e 80 00 00 	movabs $0x806e0d,%rax
+  8034f0:	00 00 00 
+  8034f3:	48 0f 45 c6          	cmovne %rsi,%rax
+  8034f7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8034fb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8034ff:	7e 06                	jle    803507 <vprintfmt+0x261>
+  803501:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803505:	75 4a                	jne    803551 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803507:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80350b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80350f:	0f b6 00             	movzbl (%rax),%eax
+  803512:	84 c0                	test   %al,%al
+  803514:	0f 85 9a 00 00 00    	jne    8035b4 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  80351a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80351d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803521:	85 c0                	test   %eax,%eax
+  803523:	0f 8e bd fd ff ff    	jle    8032e6 <vprintfmt+0x40>
+  803529:	4c 89 ee             	mov    %r13,%rsi
+  80352c:	bf 20 00 00 00       	mov    $0x20,%edi
+  803531:	41 ff d6             	call   *%r14
+  803534:	41 83 ec 01          	sub    $0x1,%r12d
+  803538:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80353c:	75 eb                	jne    803529 <vprintfmt+0x283>
+  80353e:	e9 a3 fd ff ff       	jmp    8032e6 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  803543:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803547:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80354b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354f:	eb 92                	jmp    8034e3 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  803551:	49 63 f7             	movslq %r15d,%rsi
+  803554:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803558:	48 b8 6a 3a 80 00 00 	movabs $0x803a6a,%rax
+  80355f:	00 00 00 
+  803562:	ff d0                	call   *%rax
+  803564:	48 89 c2             	mov    %rax,%rdx
+  803567:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80356a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80356c:	8d 50 ff             	lea    -0x1(%rax),%edx
+  80356f:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  803572:	85 c0                	test   %eax,%eax
+  803574:	7e 91                	jle    803507 <vprintfmt+0x261>
+  803576:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80357b:	4c 89 ee             	mov    %r13,%rsi
+  80357e:	44 89 e7             	mov    %r12d,%edi
+  803581:	41 ff d6             	call   *%r14
+  803584:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803588:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80358b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80358e:	75 eb                	jne    80357b <vprintfmt+0x2d5>
+  803590:	e9 72 ff ff ff       	jmp    803507 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803595:	0f b6 f8             	movzbl %al,%edi
+  803598:	4c 89 ee             	mov    %r13,%rsi
+  80359b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80359e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8035a2:	49 83 c4 01          	add    $0x1,%r12
+  8035a6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8035ac:	84 c0                	test   %al,%al
+  8035ae:	0f 84 66 ff ff ff    	je     80351a <vprintfmt+0x274>
+  8035b4:	45 85 ff             	test   %r15d,%r15d
+  8035b7:	78 0a                	js     8035c3 <vprintfmt+0x31d>
+  8035b9:	41 83 ef 01          	sub    $0x1,%r15d
+  8035bd:	0f 88 57 ff ff ff    	js     80351a <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8035c3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8035c7:	74 cc                	je     803595 <vprintfmt+0x2ef>
+  8035c9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8035cc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8035d1:	80 fa 5e             	cmp    $0x5e,%dl
+  8035d4:	77 c2                	ja     803598 <vprintfmt+0x2f2>
+  8035d6:	eb bd                	jmp    803595 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  8035d8:	40 84 f6             	test   %sil,%sil
+  8035db:	75 26                	jne    803603 <vprintfmt+0x35d>
+    switch (lflag) {
+  8035dd:	85 d2                	test   %edx,%edx
+  8035df:	74 59                	je     80363a <vprintfmt+0x394>
+  8035e1:	83 fa 01             	cmp    $0x1,%edx
+  8035e4:	74 7b                	je     803661 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  8035e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8035ec:	0f 87 96 00 00 00    	ja     803688 <vprintfmt+0x3e2>
+  8035f2:	89 c2                	mov    %eax,%edx
+  8035f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035f8:	83 c0 08             	add    $0x8,%eax
+  8035fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035fe:	4c 8b 22             	mov    (%rdx),%r12
+  803601:	eb 17                	jmp    80361a <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  803603:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803606:	83 f8 2f             	cmp    $0x2f,%eax
+  803609:	77 21                	ja     80362c <vprintfmt+0x386>
+  80360b:	89 c2                	mov    %eax,%edx
+  80360d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803611:	83 c0 08             	add    $0x8,%eax
+  803614:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803617:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80361a:	4d 85 e4             	test   %r12,%r12
+  80361d:	78 7a                	js     803699 <vprintfmt+0x3f3>
+            num = i;
+  80361f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803622:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803627:	e9 56 02 00 00       	jmp    803882 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80362c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803630:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803634:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803638:	eb dd                	jmp    803617 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  80363a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80363d:	83 f8 2f             	cmp    $0x2f,%eax
+  803640:	77 11                	ja     803653 <vprintfmt+0x3ad>
+  803642:	89 c2                	mov    %eax,%edx
+  803644:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803648:	83 c0 08             	add    $0x8,%eax
+  80364b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80364e:	4c 63 22             	movslq (%rdx),%r12
+  803651:	eb c7                	jmp    80361a <vprintfmt+0x374>
+  803653:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803657:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80365b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80365f:	eb ed                	jmp    80364e <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  803661:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803664:	83 f8 2f             	cmp    $0x2f,%eax
+  803667:	77 11                	ja     80367a <vprintfmt+0x3d4>
+  803669:	89 c2                	mov    %eax,%edx
+  80366b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80366f:	83 c0 08             	add    $0x8,%eax
+  803672:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803675:	4c 8b 22             	mov    (%rdx),%r12
+  803678:	eb a0                	jmp    80361a <vprintfmt+0x374>
+  80367a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80367e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803682:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803686:	eb ed                	jmp    803675 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  803688:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80368c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803690:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803694:	e9 65 ff ff ff       	jmp    8035fe <vprintfmt+0x358>
+                putch('-', put_arg);
+  803699:	4c 89 ee             	mov    %r13,%rsi
+  80369c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8036a1:	41 ff d6             	call   *%r14
+                i = -i;
+  8036a4:	49 f7 dc             	neg    %r12
+  8036a7:	e9 73 ff ff ff       	jmp    80361f <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  8036ac:	40 84 f6             	test   %sil,%sil
+  8036af:	75 2e                	jne    8036df <vprintfmt+0x439>
+    switch (lflag) {
+  8036b1:	85 d2                	test   %edx,%edx
+  8036b3:	7f 59                	jg     80370e <vprintfmt+0x468>
+  8036b5:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8036b8:	7d 7a                	jge    803734 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  8036ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8036c0:	0f 87 aa 00 00 00    	ja     803770 <vprintfmt+0x4ca>
+  8036c6:	89 c2                	mov    %eax,%edx
+  8036c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036cc:	83 c0 08             	add    $0x8,%eax
+  8036cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036d2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8036d5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8036da:	e9 a3 01 00 00       	jmp    803882 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8036e5:	77 19                	ja     803700 <vprintfmt+0x45a>
+  8036e7:	89 c2                	mov    %eax,%edx
+  8036e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036ed:	83 c0 08             	add    $0x8,%eax
+  8036f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036f3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8036f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8036fb:	e9 82 01 00 00       	jmp    803882 <vprintfmt+0x5dc>
+  803700:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803704:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803708:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80370c:	eb e5                	jmp    8036f3 <vprintfmt+0x44d>
+    switch (lflag) {
+  80370e:	83 fa 01             	cmp    $0x1,%edx
+  803711:	75 a7                	jne    8036ba <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  803713:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803716:	83 f8 2f             	cmp    $0x2f,%eax
+  803719:	77 47                	ja     803762 <vprintfmt+0x4bc>
+  80371b:	89 c2                	mov    %eax,%edx
+  80371d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803721:	83 c0 08             	add    $0x8,%eax
+  803724:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803727:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80372a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80372f:	e9 4e 01 00 00       	jmp    803882 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  803734:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803737:	83 f8 2f             	cmp    $0x2f,%eax
+  80373a:	77 18                	ja     803754 <vprintfmt+0x4ae>
+  80373c:	89 c2                	mov    %eax,%edx
+  80373e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803742:	83 c0 08             	add    $0x8,%eax
+  803745:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803748:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80374a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80374f:	e9 2e 01 00 00       	jmp    803882 <vprintfmt+0x5dc>
+  803754:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803758:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80375c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803760:	eb e6                	jmp    803748 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  803762:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803766:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80376a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80376e:	eb b7                	jmp    803727 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  803770:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803774:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80377c:	e9 51 ff ff ff       	jmp    8036d2 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  803781:	40 84 f6             	test   %sil,%sil
+  803784:	75 2e                	jne    8037b4 <vprintfmt+0x50e>
+    switch (lflag) {
+  803786:	85 d2                	test   %edx,%edx
+  803788:	7f 59                	jg     8037e3 <vprintfmt+0x53d>
+  80378a:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80378d:	7d 77                	jge    803806 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  80378f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803792:	83 f8 2f             	cmp    $0x2f,%eax
+  803795:	0f 87 a4 00 00 00    	ja     80383f <vprintfmt+0x599>
+  80379b:	89 c2                	mov    %eax,%edx
+  80379d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037a1:	83 c0 08             	add    $0x8,%eax
+  8037a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037a7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8037aa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8037af:	e9 ce 00 00 00       	jmp    803882 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8037b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8037ba:	77 19                	ja     8037d5 <vprintfmt+0x52f>
+  8037bc:	89 c2                	mov    %eax,%edx
+  8037be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037c2:	83 c0 08             	add    $0x8,%eax
+  8037c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037c8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8037cb:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8037d0:	e9 ad 00 00 00       	jmp    803882 <vprintfmt+0x5dc>
+  8037d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037e1:	eb e5                	jmp    8037c8 <vprintfmt+0x522>
+    switch (lflag) {
+  8037e3:	83 fa 01             	cmp    $0x1,%edx
+  8037e6:	75 a7                	jne    80378f <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8037e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8037ee:	77 41                	ja     803831 <vprintfmt+0x58b>
+  8037f0:	89 c2                	mov    %eax,%edx
+  8037f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037f6:	83 c0 08             	add    $0x8,%eax
+  8037f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037fc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8037ff:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803804:	eb 7c                	jmp    803882 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  803806:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803809:	83 f8 2f             	cmp    $0x2f,%eax
+  80380c:	77 15                	ja     803823 <vprintfmt+0x57d>
+  80380e:	89 c2                	mov    %eax,%edx
+  803810:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803814:	83 c0 08             	add    $0x8,%eax
+  803817:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80381a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80381c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803821:	eb 5f                	jmp    803882 <vprintfmt+0x5dc>
+  803823:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803827:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80382b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80382f:	eb e9                	jmp    80381a <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  803831:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803835:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803839:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80383d:	eb bd                	jmp    8037fc <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80383f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803843:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803847:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80384b:	e9 57 ff ff ff       	jmp    8037a7 <vprintfmt+0x501>
+            putch('0', put_arg);
+  803850:	4c 89 ee             	mov    %r13,%rsi
+  803853:	bf 30 00 00 00       	mov    $0x30,%edi
+  803858:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80385b:	4c 89 ee             	mov    %r13,%rsi
+  80385e:	bf 78 00 00 00       	mov    $0x78,%edi
+  803863:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803866:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803869:	83 f8 2f             	cmp    $0x2f,%eax
+  80386c:	77 47                	ja     8038b5 <vprintfmt+0x60f>
+  80386e:	89 c2                	mov    %eax,%edx
+  803870:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803874:	83 c0 08             	add    $0x8,%eax
+  803877:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80387a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80387d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803882:	48 83 ec 08          	sub    $0x8,%rsp
+  803886:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80388a:	0f 94 c0             	sete   %al
+  80388d:	0f b6 c0             	movzbl %al,%eax
+  803890:	50                   	push   %rax
+  803891:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803896:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80389a:	4c 89 ee             	mov    %r13,%rsi
+  80389d:	4c 89 f7             	mov    %r14,%rdi
+  8038a0:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  8038a7:	00 00 00 
+  8038aa:	ff d0                	call   *%rax
+            break;
+  8038ac:	48 83 c4 10          	add    $0x10,%rsp
+  8038b0:	e9 31 fa ff ff       	jmp    8032e6 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8038b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038c1:	eb b7                	jmp    80387a <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8038c3:	40 84 f6             	test   %sil,%sil
+  8038c6:	75 2b                	jne    8038f3 <vprintfmt+0x64d>
+    switch (lflag) {
+  8038c8:	85 d2                	test   %edx,%edx
+  8038ca:	7f 56                	jg     803922 <vprintfmt+0x67c>
+  8038cc:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8038cf:	7d 77                	jge    803948 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8038d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8038d7:	0f 87 a7 00 00 00    	ja     803984 <vprintfmt+0x6de>
+  8038dd:	89 c2                	mov    %eax,%edx
+  8038df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038e3:	83 c0 08             	add    $0x8,%eax
+  8038e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038e9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038ec:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8038f1:	eb 8f                	jmp    803882 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8038f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8038f9:	77 19                	ja     803914 <vprintfmt+0x66e>
+  8038fb:	89 c2                	mov    %eax,%edx
+  8038fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803901:	83 c0 08             	add    $0x8,%eax
+  803904:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803907:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80390a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80390f:	e9 6e ff ff ff       	jmp    803882 <vprintfmt+0x5dc>
+  803914:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803918:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80391c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803920:	eb e5                	jmp    803907 <vprintfmt+0x661>
+    switch (lflag) {
+  803922:	83 fa 01             	cmp    $0x1,%edx
+  803925:	75 aa                	jne    8038d1 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  803927:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80392a:	83 f8 2f             	cmp    $0x2f,%eax
+  80392d:	77 47                	ja     803976 <vprintfmt+0x6d0>
+  80392f:	89 c2                	mov    %eax,%edx
+  803931:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803935:	83 c0 08             	add    $0x8,%eax
+  803938:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80393b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80393e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803943:	e9 3a ff ff ff       	jmp    803882 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  803948:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80394b:	83 f8 2f             	cmp    $0x2f,%eax
+  80394e:	77 18                	ja     803968 <vprintfmt+0x6c2>
+  803950:	89 c2                	mov    %eax,%edx
+  803952:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803956:	83 c0 08             	add    $0x8,%eax
+  803959:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80395c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80395e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803963:	e9 1a ff ff ff       	jmp    803882 <vprintfmt+0x5dc>
+  803968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80396c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803974:	eb e6                	jmp    80395c <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  803976:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80397a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80397e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803982:	eb b7                	jmp    80393b <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  803984:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803988:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80398c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803990:	e9 54 ff ff ff       	jmp    8038e9 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  803995:	4c 89 ee             	mov    %r13,%rsi
+  803998:	bf 25 00 00 00       	mov    $0x25,%edi
+  80399d:	41 ff d6             	call   *%r14
+            break;
+  8039a0:	e9 41 f9 ff ff       	jmp    8032e6 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8039a5:	4c 89 ee             	mov    %r13,%rsi
+  8039a8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8039ad:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8039b0:	48 83 eb 01          	sub    $0x1,%rbx
+  8039b4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8039b8:	75 f6                	jne    8039b0 <vprintfmt+0x70a>
+  8039ba:	e9 27 f9 ff ff       	jmp    8032e6 <vprintfmt+0x40>
+
+00000000008039bf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8039bf:	55                   	push   %rbp
+  8039c0:	48 89 e5             	mov    %rsp,%rbp
+  8039c3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8039c7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8039cb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8039d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8039d4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8039db:	48 85 ff             	test   %rdi,%rdi
+  8039de:	74 2b                	je     803a0b <vsnprintf+0x4c>
+  8039e0:	48 85 f6             	test   %rsi,%rsi
+  8039e3:	74 26                	je     803a0b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8039e5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8039e9:	48 bf 51 32 80 00 00 	movabs $0x803251,%rdi
+  8039f0:	00 00 00 
+  8039f3:	48 b8 a6 32 80 00 00 	movabs $0x8032a6,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8039ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a03:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803a06:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803a09:	c9                   	leave
+  803a0a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803a0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a10:	eb f7                	jmp    803a09 <vsnprintf+0x4a>
+
+0000000000803a12 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803a12:	55                   	push   %rbp
+  803a13:	48 89 e5             	mov    %rsp,%rbp
+  803a16:	48 83 ec 50          	sub    $0x50,%rsp
+  803a1a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803a1e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803a22:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803a26:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803a2d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a35:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803a39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803a3d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803a41:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  803a48:	00 00 00 
+  803a4b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803a4d:	c9                   	leave
+  803a4e:	c3                   	ret
+
+0000000000803a4f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803a4f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803a52:	74 10                	je     803a64 <strlen+0x15>
+    size_t n = 0;
+  803a54:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803a59:	48 83 c0 01          	add    $0x1,%rax
+  803a5d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803a61:	75 f6                	jne    803a59 <strlen+0xa>
+  803a63:	c3                   	ret
+    size_t n = 0;
+  803a64:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803a69:	c3                   	ret
+
+0000000000803a6a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803a6a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803a6d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803a72:	48 85 f6             	test   %rsi,%rsi
+  803a75:	74 11                	je     803a88 <strnlen+0x1e>
+  803a77:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803a7b:	74 0c                	je     803a89 <strnlen+0x1f>
+  803a7d:	48 83 c2 01          	add    $0x1,%rdx
+  803a81:	48 39 d0             	cmp    %rdx,%rax
+  803a84:	75 f1                	jne    803a77 <strnlen+0xd>
+  803a86:	eb 04                	jmp    803a8c <strnlen+0x22>
+  803a88:	c3                   	ret
+  803a89:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803a8c:	c3                   	ret
+
+0000000000803a8d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803a8d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803a90:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a95:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803a99:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a9c:	48 83 c2 01          	add    $0x1,%rdx
+  803aa0:	84 c9                	test   %cl,%cl
+  803aa2:	75 f1                	jne    803a95 <strcpy+0x8>
+        ;
+    return res;
+}
+  803aa4:	c3                   	ret
+
+0000000000803aa5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803aa5:	55                   	push   %rbp
+  803aa6:	48 89 e5             	mov    %rsp,%rbp
+  803aa9:	41 54                	push   %r12
+  803aab:	53                   	push   %rbx
+  803aac:	48 89 fb             	mov    %rdi,%rbx
+  803aaf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803ab2:	48 b8 4f 3a 80 00 00 	movabs $0x803a4f,%rax
+  803ab9:	00 00 00 
+  803abc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803abe:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803ac2:	4c 89 e6             	mov    %r12,%rsi
+  803ac5:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803acc:	00 00 00 
+  803acf:	ff d0                	call   *%rax
+    return dst;
+}
+  803ad1:	48 89 d8             	mov    %rbx,%rax
+  803ad4:	5b                   	pop    %rbx
+  803ad5:	41 5c                	pop    %r12
+  803ad7:	5d                   	pop    %rbp
+  803ad8:	c3                   	ret
+
+0000000000803ad9 <toupper>:
+
+int
+toupper(int ch) {
+  803ad9:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  803adb:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  803ade:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803ae1:	83 f9 1a             	cmp    $0x1a,%ecx
+  803ae4:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803ae7:	c3                   	ret
+
+0000000000803ae8 <tolower>:
+
+int
+tolower(int ch) {
+  803ae8:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  803aea:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  803aed:	8d 57 20             	lea    0x20(%rdi),%edx
+  803af0:	83 f9 1a             	cmp    $0x1a,%ecx
+  803af3:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803af6:	c3                   	ret
+
+0000000000803af7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803af7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803afa:	48 85 d2             	test   %rdx,%rdx
+  803afd:	74 1f                	je     803b1e <strncpy+0x27>
+  803aff:	48 01 fa             	add    %rdi,%rdx
+  803b02:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803b05:	48 83 c1 01          	add    $0x1,%rcx
+  803b09:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803b0d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803b11:	41 80 f8 01          	cmp    $0x1,%r8b
+  803b15:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803b19:	48 39 ca             	cmp    %rcx,%rdx
+  803b1c:	75 e7                	jne    803b05 <strncpy+0xe>
+    }
+    return ret;
+}
+  803b1e:	c3                   	ret
+
+0000000000803b1f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803b1f:	48 89 f8             	mov    %rdi,%rax
+  803b22:	48 85 d2             	test   %rdx,%rdx
+  803b25:	74 24                	je     803b4b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803b27:	48 83 ea 01          	sub    $0x1,%rdx
+  803b2b:	74 1b                	je     803b48 <strlcpy+0x29>
+  803b2d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803b31:	0f b6 16             	movzbl (%rsi),%edx
+  803b34:	84 d2                	test   %dl,%dl
+  803b36:	74 10                	je     803b48 <strlcpy+0x29>
+            *dst++ = *src++;
+  803b38:	48 83 c6 01          	add    $0x1,%rsi
+  803b3c:	48 83 c0 01          	add    $0x1,%rax
+  803b40:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803b43:	48 39 c8             	cmp    %rcx,%rax
+  803b46:	75 e9                	jne    803b31 <strlcpy+0x12>
+        *dst = '\0';
+  803b48:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803b4b:	48 29 f8             	sub    %rdi,%rax
+}
+  803b4e:	c3                   	ret
+
+0000000000803b4f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803b4f:	0f b6 07             	movzbl (%rdi),%eax
+  803b52:	84 c0                	test   %al,%al
+  803b54:	74 13                	je     803b69 <strcmp+0x1a>
+  803b56:	38 06                	cmp    %al,(%rsi)
+  803b58:	75 0f                	jne    803b69 <strcmp+0x1a>
+  803b5a:	48 83 c7 01          	add    $0x1,%rdi
+  803b5e:	48 83 c6 01          	add    $0x1,%rsi
+  803b62:	0f b6 07             	movzbl (%rdi),%eax
+  803b65:	84 c0                	test   %al,%al
+  803b67:	75 ed                	jne    803b56 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803b69:	0f b6 c0             	movzbl %al,%eax
+  803b6c:	0f b6 16             	movzbl (%rsi),%edx
+  803b6f:	29 d0                	sub    %edx,%eax
+}
+  803b71:	c3                   	ret
+
+0000000000803b72 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803b72:	48 85 d2             	test   %rdx,%rdx
+  803b75:	74 1f                	je     803b96 <strncmp+0x24>
+  803b77:	0f b6 07             	movzbl (%rdi),%eax
+  803b7a:	84 c0                	test   %al,%al
+  803b7c:	74 1e                	je     803b9c <strncmp+0x2a>
+  803b7e:	3a 06                	cmp    (%rsi),%al
+  803b80:	75 1a                	jne    803b9c <strncmp+0x2a>
+  803b82:	48 83 c7 01          	add    $0x1,%rdi
+  803b86:	48 83 c6 01          	add    $0x1,%rsi
+  803b8a:	48 83 ea 01          	sub    $0x1,%rdx
+  803b8e:	75 e7                	jne    803b77 <strncmp+0x5>
+
+    if (!n) return 0;
+  803b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b95:	c3                   	ret
+  803b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9b:	c3                   	ret
+  803b9c:	48 85 d2             	test   %rdx,%rdx
+  803b9f:	74 09                	je     803baa <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ba1:	0f b6 07             	movzbl (%rdi),%eax
+  803ba4:	0f b6 16             	movzbl (%rsi),%edx
+  803ba7:	29 d0                	sub    %edx,%eax
+  803ba9:	c3                   	ret
+    if (!n) return 0;
+  803baa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803baf:	c3                   	ret
+
+0000000000803bb0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803bb0:	0f b6 17             	movzbl (%rdi),%edx
+  803bb3:	84 d2                	test   %dl,%dl
+  803bb5:	74 18                	je     803bcf <strchr+0x1f>
+        if (*str == c) {
+  803bb7:	0f be d2             	movsbl %dl,%edx
+  803bba:	39 f2                	cmp    %esi,%edx
+  803bbc:	74 17                	je     803bd5 <strchr+0x25>
+    for (; *str; str++) {
+  803bbe:	48 83 c7 01          	add    $0x1,%rdi
+  803bc2:	0f b6 17             	movzbl (%rdi),%edx
+  803bc5:	84 d2                	test   %dl,%dl
+  803bc7:	75 ee                	jne    803bb7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bce:	c3                   	ret
+  803bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd4:	c3                   	ret
+  803bd5:	48 89 f8             	mov    %rdi,%rax
+}
+  803bd8:	c3                   	ret
+
+0000000000803bd9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803bd9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803bdc:	0f b6 17             	movzbl (%rdi),%edx
+  803bdf:	84 d2                	test   %dl,%dl
+  803be1:	74 13                	je     803bf6 <strfind+0x1d>
+  803be3:	0f be d2             	movsbl %dl,%edx
+  803be6:	39 f2                	cmp    %esi,%edx
+  803be8:	74 0b                	je     803bf5 <strfind+0x1c>
+  803bea:	48 83 c0 01          	add    $0x1,%rax
+  803bee:	0f b6 10             	movzbl (%rax),%edx
+  803bf1:	84 d2                	test   %dl,%dl
+  803bf3:	75 ee                	jne    803be3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803bf5:	c3                   	ret
+  803bf6:	c3                   	ret
+
+0000000000803bf7 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  803bf7:	48 39 f7             	cmp    %rsi,%rdi
+  803bfa:	74 65                	je     803c61 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  803bfc:	55                   	push   %rbp
+  803bfd:	48 89 e5             	mov    %rsp,%rbp
+  803c00:	41 57                	push   %r15
+  803c02:	41 56                	push   %r14
+  803c04:	41 55                	push   %r13
+  803c06:	41 54                	push   %r12
+  803c08:	53                   	push   %rbx
+  803c09:	48 83 ec 18          	sub    $0x18,%rsp
+  803c0d:	48 89 fb             	mov    %rdi,%rbx
+  803c10:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  803c13:	49 bf e8 3a 80 00 00 	movabs $0x803ae8,%r15
+  803c1a:	00 00 00 
+  803c1d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  803c21:	41 0f b6 fd          	movzbl %r13b,%edi
+  803c25:	41 ff d7             	call   *%r15
+  803c28:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  803c2b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  803c30:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c34:	41 ff d7             	call   *%r15
+  803c37:	89 c2                	mov    %eax,%edx
+  803c39:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803c3c:	29 d0                	sub    %edx,%eax
+  803c3e:	75 12                	jne    803c52 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  803c40:	48 83 c3 01          	add    $0x1,%rbx
+  803c44:	45 84 ed             	test   %r13b,%r13b
+  803c47:	74 09                	je     803c52 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  803c49:	49 83 c4 01          	add    $0x1,%r12
+  803c4d:	45 84 f6             	test   %r14b,%r14b
+  803c50:	75 cb                	jne    803c1d <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  803c52:	48 83 c4 18          	add    $0x18,%rsp
+  803c56:	5b                   	pop    %rbx
+  803c57:	41 5c                	pop    %r12
+  803c59:	41 5d                	pop    %r13
+  803c5b:	41 5e                	pop    %r14
+  803c5d:	41 5f                	pop    %r15
+  803c5f:	5d                   	pop    %rbp
+  803c60:	c3                   	ret
+    if (p1 == p2) return 0;
+  803c61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c66:	c3                   	ret
+
+0000000000803c67 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  803c67:	48 39 f7             	cmp    %rsi,%rdi
+  803c6a:	74 7d                	je     803ce9 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c6c:	55                   	push   %rbp
+  803c6d:	48 89 e5             	mov    %rsp,%rbp
+  803c70:	41 57                	push   %r15
+  803c72:	41 56                	push   %r14
+  803c74:	41 55                	push   %r13
+  803c76:	41 54                	push   %r12
+  803c78:	53                   	push   %rbx
+  803c79:	48 83 ec 18          	sub    $0x18,%rsp
+  803c7d:	48 89 fb             	mov    %rdi,%rbx
+  803c80:	49 89 f4             	mov    %rsi,%r12
+  803c83:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  803c87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  803c8b:	49 bf e8 3a 80 00 00 	movabs $0x803ae8,%r15
+  803c92:	00 00 00 
+    while (n--) {
+  803c95:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c99:	48 39 c3             	cmp    %rax,%rbx
+  803c9c:	74 37                	je     803cd5 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  803c9e:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  803ca2:	41 0f b6 fd          	movzbl %r13b,%edi
+  803ca6:	41 ff d7             	call   *%r15
+  803ca9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  803cac:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  803cb1:	41 0f b6 fe          	movzbl %r14b,%edi
+  803cb5:	41 ff d7             	call   *%r15
+  803cb8:	89 c2                	mov    %eax,%edx
+  803cba:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803cbd:	29 d0                	sub    %edx,%eax
+  803cbf:	75 19                	jne    803cda <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  803cc1:	48 83 c3 01          	add    $0x1,%rbx
+  803cc5:	45 84 ed             	test   %r13b,%r13b
+  803cc8:	74 10                	je     803cda <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  803cca:	49 83 c4 01          	add    $0x1,%r12
+  803cce:	45 84 f6             	test   %r14b,%r14b
+  803cd1:	75 c2                	jne    803c95 <strncasecmp+0x2e>
+  803cd3:	eb 05                	jmp    803cda <strncasecmp+0x73>
+  803cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  803cda:	48 83 c4 18          	add    $0x18,%rsp
+  803cde:	5b                   	pop    %rbx
+  803cdf:	41 5c                	pop    %r12
+  803ce1:	41 5d                	pop    %r13
+  803ce3:	41 5e                	pop    %r14
+  803ce5:	41 5f                	pop    %r15
+  803ce7:	5d                   	pop    %rbp
+  803ce8:	c3                   	ret
+    if (p1 == p2) return 0;
+  803ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cee:	c3                   	ret
+
+0000000000803cef <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  803cef:	83 e7 df             	and    $0xffffffdf,%edi
+  803cf2:	83 ef 41             	sub    $0x41,%edi
+  803cf5:	83 ff 19             	cmp    $0x19,%edi
+  803cf8:	0f 96 c0             	setbe  %al
+}
+  803cfb:	c3                   	ret
+
+0000000000803cfc <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  803cfc:	83 ff 20             	cmp    $0x20,%edi
+  803cff:	0f 94 c0             	sete   %al
+  803d02:	83 ff 09             	cmp    $0x9,%edi
+  803d05:	0f 94 c2             	sete   %dl
+  803d08:	09 d0                	or     %edx,%eax
+}
+  803d0a:	c3                   	ret
+
+0000000000803d0b <ispunct>:
+
+bool
+ispunct(int c)
+{
+  803d0b:	55                   	push   %rbp
+  803d0c:	48 89 e5             	mov    %rsp,%rbp
+  803d0f:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  803d11:	48 bf ff 72 80 00 00 	movabs $0x8072ff,%rdi
+  803d18:	00 00 00 
+  803d1b:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  803d22:	00 00 00 
+  803d25:	ff d0                	call   *%rax
+  803d27:	48 85 c0             	test   %rax,%rax
+  803d2a:	0f 95 c0             	setne  %al
+}
+  803d2d:	5d                   	pop    %rbp
+  803d2e:	c3                   	ret
+
+0000000000803d2f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803d2f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803d32:	48 89 f8             	mov    %rdi,%rax
+  803d35:	48 f7 d8             	neg    %rax
+  803d38:	83 e0 07             	and    $0x7,%eax
+  803d3b:	49 89 d1             	mov    %rdx,%r9
+  803d3e:	49 29 c1             	sub    %rax,%r9
+  803d41:	78 36                	js     803d79 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803d43:	40 0f b6 c6          	movzbl %sil,%eax
+  803d47:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803d4e:	01 01 01 
+  803d51:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803d55:	40 f6 c7 07          	test   $0x7,%dil
+  803d59:	75 38                	jne    803d93 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803d5b:	4c 89 c9             	mov    %r9,%rcx
+  803d5e:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d62:	74 0c                	je     803d70 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d64:	fc                   	cld
+  803d65:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d68:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d6c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d70:	4d 85 c9             	test   %r9,%r9
+  803d73:	75 45                	jne    803dba <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d75:	4c 89 c0             	mov    %r8,%rax
+  803d78:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d79:	48 85 d2             	test   %rdx,%rdx
+  803d7c:	74 f7                	je     803d75 <memset+0x46>
+  803d7e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d81:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d84:	48 83 c0 01          	add    $0x1,%rax
+  803d88:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d8c:	48 39 c2             	cmp    %rax,%rdx
+  803d8f:	75 f3                	jne    803d84 <memset+0x55>
+  803d91:	eb e2                	jmp    803d75 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d93:	40 f6 c7 01          	test   $0x1,%dil
+  803d97:	74 06                	je     803d9f <memset+0x70>
+  803d99:	88 07                	mov    %al,(%rdi)
+  803d9b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d9f:	40 f6 c7 02          	test   $0x2,%dil
+  803da3:	74 07                	je     803dac <memset+0x7d>
+  803da5:	66 89 07             	mov    %ax,(%rdi)
+  803da8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803dac:	40 f6 c7 04          	test   $0x4,%dil
+  803db0:	74 a9                	je     803d5b <memset+0x2c>
+  803db2:	89 07                	mov    %eax,(%rdi)
+  803db4:	48 83 c7 04          	add    $0x4,%rdi
+  803db8:	eb a1                	jmp    803d5b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803dba:	41 f6 c1 04          	test   $0x4,%r9b
+  803dbe:	74 06                	je     803dc6 <memset+0x97>
+  803dc0:	89 07                	mov    %eax,(%rdi)
+  803dc2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803dc6:	41 f6 c1 02          	test   $0x2,%r9b
+  803dca:	74 07                	je     803dd3 <memset+0xa4>
+  803dcc:	66 89 07             	mov    %ax,(%rdi)
+  803dcf:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803dd3:	41 f6 c1 01          	test   $0x1,%r9b
+  803dd7:	74 9c                	je     803d75 <memset+0x46>
+  803dd9:	88 07                	mov    %al,(%rdi)
+  803ddb:	eb 98                	jmp    803d75 <memset+0x46>
+
+0000000000803ddd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803ddd:	48 89 f8             	mov    %rdi,%rax
+  803de0:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803de3:	48 39 fe             	cmp    %rdi,%rsi
+  803de6:	73 3b                	jae    803e23 <memmove+0x46>
+  803de8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803dec:	48 39 d7             	cmp    %rdx,%rdi
+  803def:	73 32                	jae    803e23 <memmove+0x46>
+        s += n;
+        d += n;
+  803df1:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803df5:	48 89 d6             	mov    %rdx,%rsi
+  803df8:	48 09 fe             	or     %rdi,%rsi
+  803dfb:	48 09 ce             	or     %rcx,%rsi
+  803dfe:	40 f6 c6 07          	test   $0x7,%sil
+  803e02:	75 12                	jne    803e16 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803e04:	48 83 ef 08          	sub    $0x8,%rdi
+  803e08:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803e0c:	48 c1 e9 03          	shr    $0x3,%rcx
+  803e10:	fd                   	std
+  803e11:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803e14:	fc                   	cld
+  803e15:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803e16:	48 83 ef 01          	sub    $0x1,%rdi
+  803e1a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803e1e:	fd                   	std
+  803e1f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803e21:	eb f1                	jmp    803e14 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803e23:	48 89 f2             	mov    %rsi,%rdx
+  803e26:	48 09 c2             	or     %rax,%rdx
+  803e29:	48 09 ca             	or     %rcx,%rdx
+  803e2c:	f6 c2 07             	test   $0x7,%dl
+  803e2f:	75 0c                	jne    803e3d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803e31:	48 c1 e9 03          	shr    $0x3,%rcx
+  803e35:	48 89 c7             	mov    %rax,%rdi
+  803e38:	fc                   	cld
+  803e39:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803e3c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803e3d:	48 89 c7             	mov    %rax,%rdi
+  803e40:	fc                   	cld
+  803e41:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803e43:	c3                   	ret
+
+0000000000803e44 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803e44:	55                   	push   %rbp
+  803e45:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803e48:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  803e4f:	00 00 00 
+  803e52:	ff d0                	call   *%rax
+}
+  803e54:	5d                   	pop    %rbp
+  803e55:	c3                   	ret
+
+0000000000803e56 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803e56:	55                   	push   %rbp
+  803e57:	48 89 e5             	mov    %rsp,%rbp
+  803e5a:	41 57                	push   %r15
+  803e5c:	41 56                	push   %r14
+  803e5e:	41 55                	push   %r13
+  803e60:	41 54                	push   %r12
+  803e62:	53                   	push   %rbx
+  803e63:	48 83 ec 08          	sub    $0x8,%rsp
+  803e67:	49 89 fe             	mov    %rdi,%r14
+  803e6a:	49 89 f7             	mov    %rsi,%r15
+  803e6d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e70:	48 89 f7             	mov    %rsi,%rdi
+  803e73:	48 b8 4f 3a 80 00 00 	movabs $0x803a4f,%rax
+  803e7a:	00 00 00 
+  803e7d:	ff d0                	call   *%rax
+  803e7f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e82:	48 89 de             	mov    %rbx,%rsi
+  803e85:	4c 89 f7             	mov    %r14,%rdi
+  803e88:	48 b8 6a 3a 80 00 00 	movabs $0x803a6a,%rax
+  803e8f:	00 00 00 
+  803e92:	ff d0                	call   *%rax
+  803e94:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e97:	48 39 c3             	cmp    %rax,%rbx
+  803e9a:	74 36                	je     803ed2 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e9c:	48 89 d8             	mov    %rbx,%rax
+  803e9f:	4c 29 e8             	sub    %r13,%rax
+  803ea2:	49 39 c4             	cmp    %rax,%r12
+  803ea5:	73 31                	jae    803ed8 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803ea7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803eac:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803eb0:	4c 89 fe             	mov    %r15,%rsi
+  803eb3:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  803eba:	00 00 00 
+  803ebd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803ebf:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803ec3:	48 83 c4 08          	add    $0x8,%rsp
+  803ec7:	5b                   	pop    %rbx
+  803ec8:	41 5c                	pop    %r12
+  803eca:	41 5d                	pop    %r13
+  803ecc:	41 5e                	pop    %r14
+  803ece:	41 5f                	pop    %r15
+  803ed0:	5d                   	pop    %rbp
+  803ed1:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803ed2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803ed6:	eb eb                	jmp    803ec3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803ed8:	48 83 eb 01          	sub    $0x1,%rbx
+  803edc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803ee0:	48 89 da             	mov    %rbx,%rdx
+  803ee3:	4c 89 fe             	mov    %r15,%rsi
+  803ee6:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  803eed:	00 00 00 
+  803ef0:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803ef2:	49 01 de             	add    %rbx,%r14
+  803ef5:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803efa:	eb c3                	jmp    803ebf <strlcat+0x69>
+
+0000000000803efc <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803efc:	48 85 d2             	test   %rdx,%rdx
+  803eff:	74 2d                	je     803f2e <memcmp+0x32>
+  803f01:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803f06:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803f0a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803f0f:	44 38 c1             	cmp    %r8b,%cl
+  803f12:	75 0f                	jne    803f23 <memcmp+0x27>
+    while (n-- > 0) {
+  803f14:	48 83 c0 01          	add    $0x1,%rax
+  803f18:	48 39 c2             	cmp    %rax,%rdx
+  803f1b:	75 e9                	jne    803f06 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f22:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803f23:	0f b6 c1             	movzbl %cl,%eax
+  803f26:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803f2a:	44 29 c0             	sub    %r8d,%eax
+  803f2d:	c3                   	ret
+    return 0;
+  803f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f33:	c3                   	ret
+
+0000000000803f34 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803f34:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803f38:	48 39 c7             	cmp    %rax,%rdi
+  803f3b:	73 0f                	jae    803f4c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803f3d:	40 38 37             	cmp    %sil,(%rdi)
+  803f40:	74 0e                	je     803f50 <memfind+0x1c>
+    for (; src < end; src++) {
+  803f42:	48 83 c7 01          	add    $0x1,%rdi
+  803f46:	48 39 f8             	cmp    %rdi,%rax
+  803f49:	75 f2                	jne    803f3d <memfind+0x9>
+  803f4b:	c3                   	ret
+  803f4c:	48 89 f8             	mov    %rdi,%rax
+  803f4f:	c3                   	ret
+  803f50:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803f53:	c3                   	ret
+
+0000000000803f54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803f54:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803f57:	0f b6 37             	movzbl (%rdi),%esi
+  803f5a:	40 80 fe 20          	cmp    $0x20,%sil
+  803f5e:	74 06                	je     803f66 <strtol+0x12>
+  803f60:	40 80 fe 09          	cmp    $0x9,%sil
+  803f64:	75 13                	jne    803f79 <strtol+0x25>
+  803f66:	48 83 c7 01          	add    $0x1,%rdi
+  803f6a:	0f b6 37             	movzbl (%rdi),%esi
+  803f6d:	40 80 fe 20          	cmp    $0x20,%sil
+  803f71:	74 f3                	je     803f66 <strtol+0x12>
+  803f73:	40 80 fe 09          	cmp    $0x9,%sil
+  803f77:	74 ed                	je     803f66 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f79:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f7c:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f7f:	3c 01                	cmp    $0x1,%al
+  803f81:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f85:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f8b:	75 0f                	jne    803f9c <strtol+0x48>
+  803f8d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f90:	74 14                	je     803fa6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f92:	85 d2                	test   %edx,%edx
+  803f94:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f99:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803fa1:	4c 63 ca             	movslq %edx,%r9
+  803fa4:	eb 36                	jmp    803fdc <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803fa6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803faa:	74 0f                	je     803fbb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803fac:	85 d2                	test   %edx,%edx
+  803fae:	75 ec                	jne    803f9c <strtol+0x48>
+        s++;
+  803fb0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803fb4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803fb9:	eb e1                	jmp    803f9c <strtol+0x48>
+        s += 2;
+  803fbb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803fbf:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803fc4:	eb d6                	jmp    803f9c <strtol+0x48>
+            dig -= '0';
+  803fc6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803fc9:	44 0f b6 c1          	movzbl %cl,%r8d
+  803fcd:	41 39 d0             	cmp    %edx,%r8d
+  803fd0:	7d 21                	jge    803ff3 <strtol+0x9f>
+        val = val * base + dig;
+  803fd2:	49 0f af c1          	imul   %r9,%rax
+  803fd6:	0f b6 c9             	movzbl %cl,%ecx
+  803fd9:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803fdc:	48 83 c7 01          	add    $0x1,%rdi
+  803fe0:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803fe4:	80 f9 39             	cmp    $0x39,%cl
+  803fe7:	76 dd                	jbe    803fc6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803fe9:	80 f9 7b             	cmp    $0x7b,%cl
+  803fec:	77 05                	ja     803ff3 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803fee:	83 e9 57             	sub    $0x57,%ecx
+  803ff1:	eb d6                	jmp    803fc9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803ff3:	4d 85 d2             	test   %r10,%r10
+  803ff6:	74 03                	je     803ffb <strtol+0xa7>
+  803ff8:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803ffb:	48 89 c2             	mov    %rax,%rdx
+  803ffe:	48 f7 da             	neg    %rdx
+  804001:	40 80 fe 2d          	cmp    $0x2d,%sil
+  804005:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  804009:	c3                   	ret
+
+000000000080400a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80400a:	55                   	push   %rbp
+  80400b:	48 89 e5             	mov    %rsp,%rbp
+  80400e:	53                   	push   %rbx
+  80400f:	48 89 fa             	mov    %rdi,%rdx
+  804012:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  804015:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80401a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80401f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804024:	be 00 00 00 00       	mov    $0x0,%esi
+  804029:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80402f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804035:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  804037:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80403b:	c9                   	leave
+  80403c:	c3                   	ret
+
+000000000080403d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80403d:	55                   	push   %rbp
+  80403e:	48 89 e5             	mov    %rsp,%rbp
+  804041:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  804042:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  804047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80404c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804051:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804056:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80405b:	be 00 00 00 00       	mov    $0x0,%esi
+  804060:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  804066:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80406c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80406e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804072:	c9                   	leave
+  804073:	c3                   	ret
+
+0000000000804074 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  804074:	55                   	push   %rbp
+  804075:	48 89 e5             	mov    %rsp,%rbp
+  804078:	53                   	push   %rbx
+  804079:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80407c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  804081:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804086:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80408b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804090:	be 00 00 00 00       	mov    $0x0,%esi
+  804095:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80409b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8040a1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8040a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040a7:	c9                   	leave
+  8040a8:	c3                   	ret
+
+00000000008040a9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8040a9:	55                   	push   %rbp
+  8040aa:	48 89 e5             	mov    %rsp,%rbp
+  8040ad:	53                   	push   %rbx
+  8040ae:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8040b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8040b5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8040ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8040bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8040c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8040ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8040d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8040da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8040dc:	48 85 c0             	test   %rax,%rax
+  8040df:	7f 06                	jg     8040e7 <sys_env_destroy+0x3e>
+}
+  8040e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040e5:	c9                   	leave
+  8040e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8040e7:	49 89 c0             	mov    %rax,%r8
+  8040ea:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8040ef:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  8040f6:	00 00 00 
+  8040f9:	be 27 00 00 00       	mov    $0x27,%esi
+  8040fe:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  804105:	00 00 00 
+  804108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410d:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  804114:	00 00 00 
+  804117:	41 ff d1             	call   *%r9
+
+000000000080411a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80411a:	55                   	push   %rbp
+  80411b:	48 89 e5             	mov    %rsp,%rbp
+  80411e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80411f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  804124:	ba 00 00 00 00       	mov    $0x0,%edx
+  804129:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80412e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804133:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804138:	be 00 00 00 00       	mov    $0x0,%esi
+  80413d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  804143:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804149:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80414b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80414f:	c9                   	leave
+  804150:	c3                   	ret
+
+0000000000804151 <sys_yield>:
+
+void
+sys_yield(void) {
+  804151:	55                   	push   %rbp
+  804152:	48 89 e5             	mov    %rsp,%rbp
+  804155:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  804156:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80415b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804160:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804165:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80416a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80416f:	be 00 00 00 00       	mov    $0x0,%esi
+  804174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80417a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804180:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  804182:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804186:	c9                   	leave
+  804187:	c3                   	ret
+
+0000000000804188 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  804188:	55                   	push   %rbp
+  804189:	48 89 e5             	mov    %rsp,%rbp
+  80418c:	53                   	push   %rbx
+  80418d:	48 89 fa             	mov    %rdi,%rdx
+  804190:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  804193:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804198:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80419f:	00 00 00 
+  8041a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8041a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8041ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8041b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8041b8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8041ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041be:	c9                   	leave
+  8041bf:	c3                   	ret
+
+00000000008041c0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8041c0:	55                   	push   %rbp
+  8041c1:	48 89 e5             	mov    %rsp,%rbp
+  8041c4:	53                   	push   %rbx
+  8041c5:	49 89 f8             	mov    %rdi,%r8
+  8041c8:	48 89 d3             	mov    %rdx,%rbx
+  8041cb:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8041ce:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8041d3:	4c 89 c2             	mov    %r8,%rdx
+  8041d6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8041d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8041de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8041e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8041ea:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8041ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041f0:	c9                   	leave
+  8041f1:	c3                   	ret
+
+00000000008041f2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8041f2:	55                   	push   %rbp
+  8041f3:	48 89 e5             	mov    %rsp,%rbp
+  8041f6:	53                   	push   %rbx
+  8041f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8041fb:	89 f8                	mov    %edi,%eax
+  8041fd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  804200:	48 63 f9             	movslq %ecx,%rdi
+  804203:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  804206:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80420b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80420e:	be 00 00 00 00       	mov    $0x0,%esi
+  804213:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  804219:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80421f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  804221:	48 85 c0             	test   %rax,%rax
+  804224:	7f 06                	jg     80422c <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  804226:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80422a:	c9                   	leave
+  80422b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80422c:	49 89 c0             	mov    %rax,%r8
+  80422f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  804234:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  80423b:	00 00 00 
+  80423e:	be 27 00 00 00       	mov    $0x27,%esi
+  804243:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  80424a:	00 00 00 
+  80424d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804252:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  804259:	00 00 00 
+  80425c:	41 ff d1             	call   *%r9
+
+000000000080425f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80425f:	55                   	push   %rbp
+  804260:	48 89 e5             	mov    %rsp,%rbp
+  804263:	53                   	push   %rbx
+  804264:	48 83 ec 08          	sub    $0x8,%rsp
+  804268:	89 f8                	mov    %edi,%eax
+  80426a:	49 89 f2             	mov    %rsi,%r10
+  80426d:	48 89 cf             	mov    %rcx,%rdi
+  804270:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  804273:	48 63 da             	movslq %edx,%rbx
+  804276:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  804279:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80427e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804281:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  804284:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80428a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80428c:	48 85 c0             	test   %rax,%rax
+  80428f:	7f 06                	jg     804297 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  804291:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804295:	c9                   	leave
+  804296:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  804297:	49 89 c0             	mov    %rax,%r8
+  80429a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80429f:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  8042a6:	00 00 00 
+  8042a9:	be 27 00 00 00       	mov    $0x27,%esi
+  8042ae:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  8042b5:	00 00 00 
+  8042b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042bd:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  8042c4:	00 00 00 
+  8042c7:	41 ff d1             	call   *%r9
+
+00000000008042ca <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8042ca:	55                   	push   %rbp
+  8042cb:	48 89 e5             	mov    %rsp,%rbp
+  8042ce:	53                   	push   %rbx
+  8042cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8042d3:	48 89 f1             	mov    %rsi,%rcx
+  8042d6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8042d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8042dc:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8042e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8042e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8042eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8042f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8042f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8042f9:	48 85 c0             	test   %rax,%rax
+  8042fc:	7f 06                	jg     804304 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8042fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804302:	c9                   	leave
+  804303:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  804304:	49 89 c0             	mov    %rax,%r8
+  804307:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80430c:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  804313:	00 00 00 
+  804316:	be 27 00 00 00       	mov    $0x27,%esi
+  80431b:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  804322:	00 00 00 
+  804325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432a:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  804331:	00 00 00 
+  804334:	41 ff d1             	call   *%r9
+
+0000000000804337 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  804337:	55                   	push   %rbp
+  804338:	48 89 e5             	mov    %rsp,%rbp
+  80433b:	53                   	push   %rbx
+  80433c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  804340:	48 63 ce             	movslq %esi,%rcx
+  804343:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  804346:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80434b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804350:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804355:	be 00 00 00 00       	mov    $0x0,%esi
+  80435a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  804360:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804366:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  804368:	48 85 c0             	test   %rax,%rax
+  80436b:	7f 06                	jg     804373 <sys_env_set_status+0x3c>
+}
+  80436d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804371:	c9                   	leave
+  804372:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  804373:	49 89 c0             	mov    %rax,%r8
+  804376:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80437b:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  804382:	00 00 00 
+  804385:	be 27 00 00 00       	mov    $0x27,%esi
+  80438a:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  804391:	00 00 00 
+  804394:	b8 00 00 00 00       	mov    $0x0,%eax
+  804399:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  8043a0:	00 00 00 
+  8043a3:	41 ff d1             	call   *%r9
+
+00000000008043a6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8043a6:	55                   	push   %rbp
+  8043a7:	48 89 e5             	mov    %rsp,%rbp
+  8043aa:	53                   	push   %rbx
+  8043ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8043af:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8043b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8043b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8043ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8043c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8043c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8043cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8043d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8043d7:	48 85 c0             	test   %rax,%rax
+  8043da:	7f 06                	jg     8043e2 <sys_env_set_trapframe+0x3c>
+}
+  8043dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043e0:	c9                   	leave
+  8043e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8043e2:	49 89 c0             	mov    %rax,%r8
+  8043e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8043ea:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  8043f1:	00 00 00 
+  8043f4:	be 27 00 00 00       	mov    $0x27,%esi
+  8043f9:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  804400:	00 00 00 
+  804403:	b8 00 00 00 00       	mov    $0x0,%eax
+  804408:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  80440f:	00 00 00 
+  804412:	41 ff d1             	call   *%r9
+
+0000000000804415 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  804415:	55                   	push   %rbp
+  804416:	48 89 e5             	mov    %rsp,%rbp
+  804419:	53                   	push   %rbx
+  80441a:	48 83 ec 08          	sub    $0x8,%rsp
+  80441e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  804421:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  804424:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80442e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804433:	be 00 00 00 00       	mov    $0x0,%esi
+  804438:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80443e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804444:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  804446:	48 85 c0             	test   %rax,%rax
+  804449:	7f 06                	jg     804451 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80444b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80444f:	c9                   	leave
+  804450:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  804451:	49 89 c0             	mov    %rax,%r8
+  804454:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  804459:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  804460:	00 00 00 
+  804463:	be 27 00 00 00       	mov    $0x27,%esi
+  804468:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  80446f:	00 00 00 
+  804472:	b8 00 00 00 00       	mov    $0x0,%eax
+  804477:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  80447e:	00 00 00 
+  804481:	41 ff d1             	call   *%r9
+
+0000000000804484 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  804484:	55                   	push   %rbp
+  804485:	48 89 e5             	mov    %rsp,%rbp
+  804488:	53                   	push   %rbx
+  804489:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  80448d:	40 0f b6 ce          	movzbl %sil,%ecx
+  804491:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  804494:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804499:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80449e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8044a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8044a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8044ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8044b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8044b6:	48 85 c0             	test   %rax,%rax
+  8044b9:	7f 06                	jg     8044c1 <sys_env_set_reclaim+0x3d>
+}
+  8044bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8044bf:	c9                   	leave
+  8044c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8044c1:	49 89 c0             	mov    %rax,%r8
+  8044c4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8044c9:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  8044d0:	00 00 00 
+  8044d3:	be 27 00 00 00       	mov    $0x27,%esi
+  8044d8:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  8044df:	00 00 00 
+  8044e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e7:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  8044ee:	00 00 00 
+  8044f1:	41 ff d1             	call   *%r9
+
+00000000008044f4 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8044f4:	55                   	push   %rbp
+  8044f5:	48 89 e5             	mov    %rsp,%rbp
+  8044f8:	53                   	push   %rbx
+  8044f9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  8044fd:	48 63 ce             	movslq %esi,%rcx
+  804500:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  804503:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80450d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804512:	be 00 00 00 00       	mov    $0x0,%esi
+  804517:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80451d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804523:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  804525:	48 85 c0             	test   %rax,%rax
+  804528:	7f 06                	jg     804530 <sys_env_set_nice+0x3c>
+}
+  80452a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80452e:	c9                   	leave
+  80452f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  804530:	49 89 c0             	mov    %rax,%r8
+  804533:	b9 18 00 00 00       	mov    $0x18,%ecx
+  804538:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  80453f:	00 00 00 
+  804542:	be 27 00 00 00       	mov    $0x27,%esi
+  804547:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  80454e:	00 00 00 
+  804551:	b8 00 00 00 00       	mov    $0x0,%eax
+  804556:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  80455d:	00 00 00 
+  804560:	41 ff d1             	call   *%r9
+
+0000000000804563 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  804563:	55                   	push   %rbp
+  804564:	48 89 e5             	mov    %rsp,%rbp
+  804567:	53                   	push   %rbx
+  804568:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80456b:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  804570:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804575:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80457a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80457f:	be 00 00 00 00       	mov    $0x0,%esi
+  804584:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80458a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804590:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  804592:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804596:	c9                   	leave
+  804597:	c3                   	ret
+
+0000000000804598 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  804598:	55                   	push   %rbp
+  804599:	48 89 e5             	mov    %rsp,%rbp
+  80459c:	53                   	push   %rbx
+  80459d:	89 f8                	mov    %edi,%eax
+  80459f:	49 89 f1             	mov    %rsi,%r9
+  8045a2:	48 89 d3             	mov    %rdx,%rbx
+  8045a5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8045a8:	49 63 f0             	movslq %r8d,%rsi
+  8045ab:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8045ae:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8045b3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8045b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8045bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8045c2:	cd 30                	int    $0x30
+}
+  8045c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045c8:	c9                   	leave
+  8045c9:	c3                   	ret
+
+00000000008045ca <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8045ca:	55                   	push   %rbp
+  8045cb:	48 89 e5             	mov    %rsp,%rbp
+  8045ce:	53                   	push   %rbx
+  8045cf:	89 f8                	mov    %edi,%eax
+  8045d1:	49 89 f1             	mov    %rsi,%r9
+  8045d4:	48 89 d3             	mov    %rdx,%rbx
+  8045d7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8045da:	49 63 f0             	movslq %r8d,%rsi
+  8045dd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8045e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8045e5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8045e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8045ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8045f4:	cd 30                	int    $0x30
+}
+  8045f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045fa:	c9                   	leave
+  8045fb:	c3                   	ret
+
+00000000008045fc <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  8045fc:	55                   	push   %rbp
+  8045fd:	48 89 e5             	mov    %rsp,%rbp
+  804600:	53                   	push   %rbx
+  804601:	48 83 ec 08          	sub    $0x8,%rsp
+  804605:	89 f8                	mov    %edi,%eax
+  804607:	49 89 f2             	mov    %rsi,%r10
+  80460a:	48 89 d3             	mov    %rdx,%rbx
+  80460d:	48 89 cf             	mov    %rcx,%rdi
+  804610:	44 89 c6             	mov    %r8d,%esi
+  804613:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  804616:	48 63 f6             	movslq %esi,%rsi
+  804619:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80461c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  804621:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  804624:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  804628:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80462a:	48 85 c0             	test   %rax,%rax
+  80462d:	7f 06                	jg     804635 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80462f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804633:	c9                   	leave
+  804634:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  804635:	49 89 c0             	mov    %rax,%r8
+  804638:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80463d:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  804644:	00 00 00 
+  804647:	be 27 00 00 00       	mov    $0x27,%esi
+  80464c:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  804653:	00 00 00 
+  804656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465b:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  804662:	00 00 00 
+  804665:	41 ff d1             	call   *%r9
+
+0000000000804668 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  804668:	55                   	push   %rbp
+  804669:	48 89 e5             	mov    %rsp,%rbp
+  80466c:	53                   	push   %rbx
+  80466d:	48 83 ec 08          	sub    $0x8,%rsp
+  804671:	48 89 f1             	mov    %rsi,%rcx
+  804674:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  804677:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  80467b:	48 8b 1a             	mov    (%rdx),%rbx
+  80467e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  804681:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804686:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80468a:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  80468e:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  804692:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  804694:	48 85 c0             	test   %rax,%rax
+  804697:	7f 06                	jg     80469f <sys_ipc_call_short+0x37>
+}
+  804699:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80469d:	c9                   	leave
+  80469e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80469f:	49 89 c0             	mov    %rax,%r8
+  8046a2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8046a7:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  8046ae:	00 00 00 
+  8046b1:	be 27 00 00 00       	mov    $0x27,%esi
+  8046b6:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  8046bd:	00 00 00 
+  8046c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c5:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  8046cc:	00 00 00 
+  8046cf:	41 ff d1             	call   *%r9
+
+00000000008046d2 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  8046d2:	55                   	push   %rbp
+  8046d3:	48 89 e5             	mov    %rsp,%rbp
+  8046d6:	53                   	push   %rbx
+  8046d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8046db:	89 f8                	mov    %edi,%eax
+  8046dd:	49 89 f2             	mov    %rsi,%r10
+  8046e0:	48 89 d3             	mov    %rdx,%rbx
+  8046e3:	48 89 cf             	mov    %rcx,%rdi
+  8046e6:	44 89 c6             	mov    %r8d,%esi
+  8046e9:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  8046ec:	48 63 f6             	movslq %esi,%rsi
+  8046ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8046f2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8046f7:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  8046fa:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  8046fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  804700:	48 85 c0             	test   %rax,%rax
+  804703:	7f 06                	jg     80470b <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  804705:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804709:	c9                   	leave
+  80470a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80470b:	49 89 c0             	mov    %rax,%r8
+  80470e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  804713:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  80471a:	00 00 00 
+  80471d:	be 27 00 00 00       	mov    $0x27,%esi
+  804722:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  804729:	00 00 00 
+  80472c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804731:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  804738:	00 00 00 
+  80473b:	41 ff d1             	call   *%r9
+
+000000000080473e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80473e:	55                   	push   %rbp
+  80473f:	48 89 e5             	mov    %rsp,%rbp
+  804742:	53                   	push   %rbx
+  804743:	48 83 ec 08          	sub    $0x8,%rsp
+  804747:	48 89 fa             	mov    %rdi,%rdx
+  80474a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80474d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  804752:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804757:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80475c:	be 00 00 00 00       	mov    $0x0,%esi
+  804761:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  804767:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80476d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80476f:	48 85 c0             	test   %rax,%rax
+  804772:	7f 06                	jg     80477a <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  804774:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804778:	c9                   	leave
+  804779:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80477a:	49 89 c0             	mov    %rax,%r8
+  80477d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  804782:	48 ba 08 73 80 00 00 	movabs $0x807308,%rdx
+  804789:	00 00 00 
+  80478c:	be 27 00 00 00       	mov    $0x27,%esi
+  804791:	48 bf 27 73 80 00 00 	movabs $0x807327,%rdi
+  804798:	00 00 00 
+  80479b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a0:	49 b9 06 30 80 00 00 	movabs $0x803006,%r9
+  8047a7:	00 00 00 
+  8047aa:	41 ff d1             	call   *%r9
+
+00000000008047ad <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8047ad:	55                   	push   %rbp
+  8047ae:	48 89 e5             	mov    %rsp,%rbp
+  8047b1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8047b2:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8047b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8047c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8047cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8047d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8047d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8047dc:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8047de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8047e2:	c9                   	leave
+  8047e3:	c3                   	ret
+
+00000000008047e4 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8047e4:	55                   	push   %rbp
+  8047e5:	48 89 e5             	mov    %rsp,%rbp
+  8047e8:	53                   	push   %rbx
+  8047e9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8047ec:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8047f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8047f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804800:	be 00 00 00 00       	mov    $0x0,%esi
+  804805:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80480b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804811:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  804813:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804817:	c9                   	leave
+  804818:	c3                   	ret
+
+0000000000804819 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  804819:	55                   	push   %rbp
+  80481a:	48 89 e5             	mov    %rsp,%rbp
+  80481d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80481e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  804823:	ba 00 00 00 00       	mov    $0x0,%edx
+  804828:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80482d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804832:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  804837:	be 00 00 00 00       	mov    $0x0,%esi
+  80483c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  804842:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  804848:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80484a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80484e:	c9                   	leave
+  80484f:	c3                   	ret
+
+0000000000804850 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804850:	55                   	push   %rbp
+  804851:	48 89 e5             	mov    %rsp,%rbp
+  804854:	41 56                	push   %r14
+  804856:	41 55                	push   %r13
+  804858:	41 54                	push   %r12
+  80485a:	53                   	push   %rbx
+  80485b:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80485e:	48 b8 a8 60 82 00 00 	movabs $0x8260a8,%rax
+  804865:	00 00 00 
+  804868:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80486c:	74 27                	je     804895 <_handle_vectored_pagefault+0x45>
+  80486e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804873:	49 bd 60 60 82 00 00 	movabs $0x826060,%r13
+  80487a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80487d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804880:	4c 89 e7             	mov    %r12,%rdi
+  804883:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804888:	84 c0                	test   %al,%al
+  80488a:	75 45                	jne    8048d1 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80488c:	48 83 c3 01          	add    $0x1,%rbx
+  804890:	49 3b 1e             	cmp    (%r14),%rbx
+  804893:	72 eb                	jb     804880 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804895:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80489c:	00 
+  80489d:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8048a2:	4d 8b 04 24          	mov    (%r12),%r8
+  8048a6:	48 ba 38 73 80 00 00 	movabs $0x807338,%rdx
+  8048ad:	00 00 00 
+  8048b0:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8048b5:	48 bf 68 73 80 00 00 	movabs $0x807368,%rdi
+  8048bc:	00 00 00 
+  8048bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048c4:	49 ba 06 30 80 00 00 	movabs $0x803006,%r10
+  8048cb:	00 00 00 
+  8048ce:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8048d1:	5b                   	pop    %rbx
+  8048d2:	41 5c                	pop    %r12
+  8048d4:	41 5d                	pop    %r13
+  8048d6:	41 5e                	pop    %r14
+  8048d8:	5d                   	pop    %rbp
+  8048d9:	c3                   	ret
+
+00000000008048da <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8048da:	55                   	push   %rbp
+  8048db:	48 89 e5             	mov    %rsp,%rbp
+  8048de:	53                   	push   %rbx
+  8048df:	48 83 ec 08          	sub    $0x8,%rsp
+  8048e3:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8048e6:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8048eb:	48 b8 a0 60 82 00 00 	movabs $0x8260a0,%rax
+  8048f2:	00 00 00 
+  8048f5:	80 38 00             	cmpb   $0x0,(%rax)
+  8048f8:	74 68                	je     804962 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048fa:	48 b8 a8 60 82 00 00 	movabs $0x8260a8,%rax
+  804901:	00 00 00 
+  804904:	48 8b 08             	mov    (%rax),%rcx
+  804907:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80490c:	48 b8 60 60 82 00 00 	movabs $0x826060,%rax
+  804913:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804916:	48 85 c9             	test   %rcx,%rcx
+  804919:	0f 84 e0 00 00 00    	je     8049ff <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80491f:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  804923:	0f 84 c9 00 00 00    	je     8049f2 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804929:	48 83 c2 01          	add    $0x1,%rdx
+  80492d:	48 39 ca             	cmp    %rcx,%rdx
+  804930:	75 ed                	jne    80491f <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804932:	48 83 f9 08          	cmp    $0x8,%rcx
+  804936:	0f 84 84 00 00 00    	je     8049c0 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80493c:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  804940:	48 a3 a8 60 82 00 00 	movabs %rax,0x8260a8
+  804947:	00 00 00 
+  80494a:	48 b8 60 60 82 00 00 	movabs $0x826060,%rax
+  804951:	00 00 00 
+  804954:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804958:	85 f6                	test   %esi,%esi
+  80495a:	0f 89 97 00 00 00    	jns    8049f7 <add_pgfault_handler+0x11d>
+  804960:	eb 63                	jmp    8049c5 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  804962:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804967:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80496c:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  804973:	00 00 00 
+  804976:	bf 00 00 00 00       	mov    $0x0,%edi
+  80497b:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  804982:	00 00 00 
+  804985:	ff d0                	call   *%rax
+  804987:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  804989:	85 c0                	test   %eax,%eax
+  80498b:	78 38                	js     8049c5 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80498d:	48 be db 4a 80 00 00 	movabs $0x804adb,%rsi
+  804994:	00 00 00 
+  804997:	bf 00 00 00 00       	mov    $0x0,%edi
+  80499c:	48 b8 15 44 80 00 00 	movabs $0x804415,%rax
+  8049a3:	00 00 00 
+  8049a6:	ff d0                	call   *%rax
+  8049a8:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8049aa:	85 c0                	test   %eax,%eax
+  8049ac:	78 17                	js     8049c5 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8049ae:	48 b8 a0 60 82 00 00 	movabs $0x8260a0,%rax
+  8049b5:	00 00 00 
+  8049b8:	c6 00 01             	movb   $0x1,(%rax)
+  8049bb:	e9 3a ff ff ff       	jmp    8048fa <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8049c0:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8049c5:	89 f1                	mov    %esi,%ecx
+  8049c7:	48 ba 76 73 80 00 00 	movabs $0x807376,%rdx
+  8049ce:	00 00 00 
+  8049d1:	be 42 00 00 00       	mov    $0x42,%esi
+  8049d6:	48 bf 68 73 80 00 00 	movabs $0x807368,%rdi
+  8049dd:	00 00 00 
+  8049e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049e5:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8049ec:	00 00 00 
+  8049ef:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8049f2:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8049f7:	89 f0                	mov    %esi,%eax
+  8049f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8049fd:	c9                   	leave
+  8049fe:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8049ff:	48 b8 a8 60 82 00 00 	movabs $0x8260a8,%rax
+  804a06:	00 00 00 
+  804a09:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  804a10:	48 89 d8             	mov    %rbx,%rax
+  804a13:	48 a3 60 60 82 00 00 	movabs %rax,0x826060
+  804a1a:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804a1d:	eb d8                	jmp    8049f7 <add_pgfault_handler+0x11d>
+
+0000000000804a1f <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804a1f:	55                   	push   %rbp
+  804a20:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804a23:	48 b8 a0 60 82 00 00 	movabs $0x8260a0,%rax
+  804a2a:	00 00 00 
+  804a2d:	80 38 00             	cmpb   $0x0,(%rax)
+  804a30:	74 33                	je     804a65 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804a32:	48 a1 a8 60 82 00 00 	movabs 0x8260a8,%rax
+  804a39:	00 00 00 
+  804a3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804a41:	48 ba 60 60 82 00 00 	movabs $0x826060,%rdx
+  804a48:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804a4b:	48 85 c0             	test   %rax,%rax
+  804a4e:	0f 84 85 00 00 00    	je     804ad9 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804a54:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804a58:	74 40                	je     804a9a <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804a5a:	48 83 c1 01          	add    $0x1,%rcx
+  804a5e:	48 39 c1             	cmp    %rax,%rcx
+  804a61:	75 f1                	jne    804a54 <remove_pgfault_handler+0x35>
+  804a63:	eb 74                	jmp    804ad9 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804a65:	48 b9 8e 73 80 00 00 	movabs $0x80738e,%rcx
+  804a6c:	00 00 00 
+  804a6f:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  804a76:	00 00 00 
+  804a79:	be 48 00 00 00       	mov    $0x48,%esi
+  804a7e:	48 bf 68 73 80 00 00 	movabs $0x807368,%rdi
+  804a85:	00 00 00 
+  804a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a8d:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  804a94:	00 00 00 
+  804a97:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804a9a:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804aa1:	00 
+  804aa2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804aa6:	48 29 ca             	sub    %rcx,%rdx
+  804aa9:	48 b8 60 60 82 00 00 	movabs $0x826060,%rax
+  804ab0:	00 00 00 
+  804ab3:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804ab7:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804abc:	48 89 ce             	mov    %rcx,%rsi
+  804abf:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  804ac6:	00 00 00 
+  804ac9:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804acb:	48 b8 a8 60 82 00 00 	movabs $0x8260a8,%rax
+  804ad2:	00 00 00 
+  804ad5:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804ad9:	5d                   	pop    %rbp
+  804ada:	c3                   	ret
+
+0000000000804adb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804adb:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804ade:	48 b8 50 48 80 00 00 	movabs $0x804850,%rax
+  804ae5:	00 00 00 
+    call *%rax
+  804ae8:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  804aea:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  804af1:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  804af2:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  804af9:	00 
+    subq $8, %rcx
+  804afa:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  804afe:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  804b01:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  804b08:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  804b09:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  804b0d:	4c 8b 3c 24          	mov    (%rsp),%r15
+  804b11:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  804b16:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  804b1b:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  804b20:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  804b25:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  804b2a:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  804b2f:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  804b34:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  804b39:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  804b3e:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  804b43:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  804b48:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  804b4d:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  804b52:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  804b57:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  804b5b:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  804b5f:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  804b60:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  804b61:	c3                   	ret
+
+0000000000804b62 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  804b62:	85 ff                	test   %edi,%edi
+  804b64:	78 58                	js     804bbe <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  804b66:	48 85 f6             	test   %rsi,%rsi
+  804b69:	74 12                	je     804b7d <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  804b6b:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  804b72:	00 00 00 
+  804b75:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  804b7b:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  804b7d:	48 85 c9             	test   %rcx,%rcx
+  804b80:	74 12                	je     804b94 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  804b82:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  804b89:	00 00 00 
+  804b8c:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  804b92:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  804b94:	48 85 d2             	test   %rdx,%rdx
+  804b97:	74 14                	je     804bad <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  804b99:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  804ba0:	00 00 00 
+  804ba3:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  804baa:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  804bad:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  804bb4:	00 00 00 
+  804bb7:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  804bbd:	c3                   	ret
+        if (from_env_store) {
+  804bbe:	48 85 f6             	test   %rsi,%rsi
+  804bc1:	74 06                	je     804bc9 <ipc_result+0x67>
+            *from_env_store = 0;
+  804bc3:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  804bc9:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  804bcb:	48 85 c9             	test   %rcx,%rcx
+  804bce:	74 ed                	je     804bbd <ipc_result+0x5b>
+            *perm_store = 0;
+  804bd0:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  804bd6:	c3                   	ret
+
+0000000000804bd7 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804bd7:	55                   	push   %rbp
+  804bd8:	48 89 e5             	mov    %rsp,%rbp
+  804bdb:	41 55                	push   %r13
+  804bdd:	41 54                	push   %r12
+  804bdf:	53                   	push   %rbx
+  804be0:	48 83 ec 08          	sub    $0x8,%rsp
+  804be4:	49 89 fc             	mov    %rdi,%r12
+  804be7:	48 89 f7             	mov    %rsi,%rdi
+  804bea:	48 89 d3             	mov    %rdx,%rbx
+  804bed:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804bf0:	48 85 f6             	test   %rsi,%rsi
+  804bf3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804bfa:	00 00 00 
+  804bfd:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  804c01:	be 00 00 00 00       	mov    $0x0,%esi
+  804c06:	48 85 d2             	test   %rdx,%rdx
+  804c09:	74 03                	je     804c0e <ipc_recv+0x37>
+  804c0b:	48 8b 32             	mov    (%rdx),%rsi
+  804c0e:	48 b8 3e 47 80 00 00 	movabs $0x80473e,%rax
+  804c15:	00 00 00 
+  804c18:	ff d0                	call   *%rax
+  804c1a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  804c1c:	4c 89 e9             	mov    %r13,%rcx
+  804c1f:	48 89 da             	mov    %rbx,%rdx
+  804c22:	4c 89 e6             	mov    %r12,%rsi
+  804c25:	48 b8 62 4b 80 00 00 	movabs $0x804b62,%rax
+  804c2c:	00 00 00 
+  804c2f:	ff d0                	call   *%rax
+}
+  804c31:	48 83 c4 08          	add    $0x8,%rsp
+  804c35:	5b                   	pop    %rbx
+  804c36:	41 5c                	pop    %r12
+  804c38:	41 5d                	pop    %r13
+  804c3a:	5d                   	pop    %rbp
+  804c3b:	c3                   	ret
+
+0000000000804c3c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804c3c:	55                   	push   %rbp
+  804c3d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804c40:	48 85 d2             	test   %rdx,%rdx
+  804c43:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c4a:	00 00 00 
+  804c4d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804c51:	89 f6                	mov    %esi,%esi
+  804c53:	48 b8 ca 45 80 00 00 	movabs $0x8045ca,%rax
+  804c5a:	00 00 00 
+  804c5d:	ff d0                	call   *%rax
+    if (res < 0) {
+  804c5f:	85 c0                	test   %eax,%eax
+  804c61:	78 02                	js     804c65 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  804c63:	5d                   	pop    %rbp
+  804c64:	c3                   	ret
+        panic("ipc_send: %i", res);
+  804c65:	89 c1                	mov    %eax,%ecx
+  804c67:	48 ba a8 73 80 00 00 	movabs $0x8073a8,%rdx
+  804c6e:	00 00 00 
+  804c71:	be 4f 00 00 00       	mov    $0x4f,%esi
+  804c76:	48 bf b5 73 80 00 00 	movabs $0x8073b5,%rdi
+  804c7d:	00 00 00 
+  804c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c85:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  804c8c:	00 00 00 
+  804c8f:	41 ff d0             	call   *%r8
+
+0000000000804c92 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  804c92:	55                   	push   %rbp
+  804c93:	48 89 e5             	mov    %rsp,%rbp
+  804c96:	53                   	push   %rbx
+  804c97:	48 83 ec 08          	sub    $0x8,%rsp
+  804c9b:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804c9f:	48 85 d2             	test   %rdx,%rdx
+  804ca2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ca9:	00 00 00 
+  804cac:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804cb0:	4d 85 c9             	test   %r9,%r9
+  804cb3:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  804cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cbc:	48 85 db             	test   %rbx,%rbx
+  804cbf:	74 03                	je     804cc4 <ipc_call+0x32>
+  804cc1:	48 8b 03             	mov    (%rbx),%rax
+  804cc4:	89 f6                	mov    %esi,%esi
+  804cc6:	48 83 ec 08          	sub    $0x8,%rsp
+  804cca:	50                   	push   %rax
+  804ccb:	48 b8 fc 45 80 00 00 	movabs $0x8045fc,%rax
+  804cd2:	00 00 00 
+  804cd5:	ff d0                	call   *%rax
+  804cd7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  804cd9:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  804cdd:	48 89 da             	mov    %rbx,%rdx
+  804ce0:	be 00 00 00 00       	mov    $0x0,%esi
+  804ce5:	48 b8 62 4b 80 00 00 	movabs $0x804b62,%rax
+  804cec:	00 00 00 
+  804cef:	ff d0                	call   *%rax
+}
+  804cf1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804cf5:	c9                   	leave
+  804cf6:	c3                   	ret
+
+0000000000804cf7 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  804cf7:	55                   	push   %rbp
+  804cf8:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  804cfb:	89 f6                	mov    %esi,%esi
+  804cfd:	48 b8 68 46 80 00 00 	movabs $0x804668,%rax
+  804d04:	00 00 00 
+  804d07:	ff d0                	call   *%rax
+  804d09:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  804d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d15:	be 00 00 00 00       	mov    $0x0,%esi
+  804d1a:	48 b8 62 4b 80 00 00 	movabs $0x804b62,%rax
+  804d21:	00 00 00 
+  804d24:	ff d0                	call   *%rax
+}
+  804d26:	5d                   	pop    %rbp
+  804d27:	c3                   	ret
+
+0000000000804d28 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  804d28:	55                   	push   %rbp
+  804d29:	48 89 e5             	mov    %rsp,%rbp
+  804d2c:	41 54                	push   %r12
+  804d2e:	53                   	push   %rbx
+  804d2f:	4c 89 cb             	mov    %r9,%rbx
+  804d32:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  804d36:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  804d3a:	48 85 d2             	test   %rdx,%rdx
+  804d3d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d44:	00 00 00 
+  804d47:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  804d4b:	4d 85 c9             	test   %r9,%r9
+  804d4e:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  804d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d57:	4d 85 e4             	test   %r12,%r12
+  804d5a:	74 04                	je     804d60 <ipc_reply_wait+0x38>
+  804d5c:	49 8b 04 24          	mov    (%r12),%rax
+  804d60:	89 f6                	mov    %esi,%esi
+  804d62:	48 83 ec 08          	sub    $0x8,%rsp
+  804d66:	50                   	push   %rax
+  804d67:	48 b8 d2 46 80 00 00 	movabs $0x8046d2,%rax
+  804d6e:	00 00 00 
+  804d71:	ff d0                	call   *%rax
+  804d73:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  804d75:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  804d79:	4c 89 e2             	mov    %r12,%rdx
+  804d7c:	48 89 de             	mov    %rbx,%rsi
+  804d7f:	48 b8 62 4b 80 00 00 	movabs $0x804b62,%rax
+  804d86:	00 00 00 
+  804d89:	ff d0                	call   *%rax
+}
+  804d8b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804d8f:	5b                   	pop    %rbx
+  804d90:	41 5c                	pop    %r12
+  804d92:	5d                   	pop    %rbp
+  804d93:	c3                   	ret
+
+0000000000804d94 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804d94:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804d99:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804da0:	00 00 00 
+  804da3:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  804daa:	48 01 ca             	add    %rcx,%rdx
+  804dad:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  804db3:	39 fa                	cmp    %edi,%edx
+  804db5:	74 12                	je     804dc9 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804db7:	48 83 c0 01          	add    $0x1,%rax
+  804dbb:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804dc1:	75 e0                	jne    804da3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dc8:	c3                   	ret
+            return envs[i].env_id;
+  804dc9:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  804dd0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804dd7:	00 00 00 
+  804dda:	48 01 d0             	add    %rdx,%rax
+  804ddd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804de3:	c3                   	ret
+
+0000000000804de4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  804de4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  804deb:	ff ff ff 
+  804dee:	48 01 f8             	add    %rdi,%rax
+  804df1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  804df5:	c3                   	ret
+
+0000000000804df6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  804df6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  804dfd:	ff ff ff 
+  804e00:	48 01 f8             	add    %rdi,%rax
+  804e03:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  804e07:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  804e0d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  804e11:	c3                   	ret
+
+0000000000804e12 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  804e12:	55                   	push   %rbp
+  804e13:	48 89 e5             	mov    %rsp,%rbp
+  804e16:	41 57                	push   %r15
+  804e18:	41 56                	push   %r14
+  804e1a:	41 55                	push   %r13
+  804e1c:	41 54                	push   %r12
+  804e1e:	53                   	push   %rbx
+  804e1f:	48 83 ec 08          	sub    $0x8,%rsp
+  804e23:	49 89 ff             	mov    %rdi,%r15
+  804e26:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  804e2b:	49 bd 6e 61 80 00 00 	movabs $0x80616e,%r13
+  804e32:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  804e35:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  804e3b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  804e3e:	48 89 df             	mov    %rbx,%rdi
+  804e41:	41 ff d5             	call   *%r13
+  804e44:	83 e0 04             	and    $0x4,%eax
+  804e47:	74 17                	je     804e60 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  804e49:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804e50:	4c 39 f3             	cmp    %r14,%rbx
+  804e53:	75 e6                	jne    804e3b <fd_alloc+0x29>
+  804e55:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  804e5b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  804e60:	4d 89 27             	mov    %r12,(%r15)
+}
+  804e63:	48 83 c4 08          	add    $0x8,%rsp
+  804e67:	5b                   	pop    %rbx
+  804e68:	41 5c                	pop    %r12
+  804e6a:	41 5d                	pop    %r13
+  804e6c:	41 5e                	pop    %r14
+  804e6e:	41 5f                	pop    %r15
+  804e70:	5d                   	pop    %rbp
+  804e71:	c3                   	ret
+
+0000000000804e72 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  804e72:	83 ff 1f             	cmp    $0x1f,%edi
+  804e75:	77 39                	ja     804eb0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  804e77:	55                   	push   %rbp
+  804e78:	48 89 e5             	mov    %rsp,%rbp
+  804e7b:	41 54                	push   %r12
+  804e7d:	53                   	push   %rbx
+  804e7e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  804e81:	48 63 df             	movslq %edi,%rbx
+  804e84:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  804e8b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  804e8f:	48 89 df             	mov    %rbx,%rdi
+  804e92:	48 b8 6e 61 80 00 00 	movabs $0x80616e,%rax
+  804e99:	00 00 00 
+  804e9c:	ff d0                	call   *%rax
+  804e9e:	a8 04                	test   $0x4,%al
+  804ea0:	74 14                	je     804eb6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  804ea2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  804ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eab:	5b                   	pop    %rbx
+  804eac:	41 5c                	pop    %r12
+  804eae:	5d                   	pop    %rbp
+  804eaf:	c3                   	ret
+        return -E_INVAL;
+  804eb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  804eb5:	c3                   	ret
+        return -E_INVAL;
+  804eb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804ebb:	eb ee                	jmp    804eab <fd_lookup+0x39>
+
+0000000000804ebd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  804ebd:	55                   	push   %rbp
+  804ebe:	48 89 e5             	mov    %rsp,%rbp
+  804ec1:	41 54                	push   %r12
+  804ec3:	53                   	push   %rbx
+  804ec4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  804ec7:	48 b8 40 74 80 00 00 	movabs $0x807440,%rax
+  804ece:	00 00 00 
+  804ed1:	48 bb a0 c0 80 00 00 	movabs $0x80c0a0,%rbx
+  804ed8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  804edb:	39 3b                	cmp    %edi,(%rbx)
+  804edd:	74 47                	je     804f26 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  804edf:	48 83 c0 08          	add    $0x8,%rax
+  804ee3:	48 8b 18             	mov    (%rax),%rbx
+  804ee6:	48 85 db             	test   %rbx,%rbx
+  804ee9:	75 f0                	jne    804edb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  804eeb:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  804ef2:	00 00 00 
+  804ef5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  804efb:	89 fa                	mov    %edi,%edx
+  804efd:	48 bf c0 73 80 00 00 	movabs $0x8073c0,%rdi
+  804f04:	00 00 00 
+  804f07:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f0c:	48 b9 56 31 80 00 00 	movabs $0x803156,%rcx
+  804f13:	00 00 00 
+  804f16:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  804f18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  804f1d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  804f21:	5b                   	pop    %rbx
+  804f22:	41 5c                	pop    %r12
+  804f24:	5d                   	pop    %rbp
+  804f25:	c3                   	ret
+            return 0;
+  804f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f2b:	eb f0                	jmp    804f1d <dev_lookup+0x60>
+
+0000000000804f2d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  804f2d:	55                   	push   %rbp
+  804f2e:	48 89 e5             	mov    %rsp,%rbp
+  804f31:	41 55                	push   %r13
+  804f33:	41 54                	push   %r12
+  804f35:	53                   	push   %rbx
+  804f36:	48 83 ec 18          	sub    $0x18,%rsp
+  804f3a:	48 89 fb             	mov    %rdi,%rbx
+  804f3d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  804f40:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  804f47:	ff ff ff 
+  804f4a:	48 01 df             	add    %rbx,%rdi
+  804f4d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  804f51:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804f55:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  804f5c:	00 00 00 
+  804f5f:	ff d0                	call   *%rax
+  804f61:	41 89 c5             	mov    %eax,%r13d
+  804f64:	85 c0                	test   %eax,%eax
+  804f66:	78 06                	js     804f6e <fd_close+0x41>
+  804f68:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  804f6c:	74 1a                	je     804f88 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  804f6e:	45 84 e4             	test   %r12b,%r12b
+  804f71:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f76:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  804f7a:	44 89 e8             	mov    %r13d,%eax
+  804f7d:	48 83 c4 18          	add    $0x18,%rsp
+  804f81:	5b                   	pop    %rbx
+  804f82:	41 5c                	pop    %r12
+  804f84:	41 5d                	pop    %r13
+  804f86:	5d                   	pop    %rbp
+  804f87:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  804f88:	8b 3b                	mov    (%rbx),%edi
+  804f8a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804f8e:	48 b8 bd 4e 80 00 00 	movabs $0x804ebd,%rax
+  804f95:	00 00 00 
+  804f98:	ff d0                	call   *%rax
+  804f9a:	41 89 c5             	mov    %eax,%r13d
+  804f9d:	85 c0                	test   %eax,%eax
+  804f9f:	78 1b                	js     804fbc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  804fa1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fa5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  804fa9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804faf:	48 85 c0             	test   %rax,%rax
+  804fb2:	74 08                	je     804fbc <fd_close+0x8f>
+  804fb4:	48 89 df             	mov    %rbx,%rdi
+  804fb7:	ff d0                	call   *%rax
+  804fb9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804fbc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804fc1:	48 89 de             	mov    %rbx,%rsi
+  804fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fc9:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  804fd0:	00 00 00 
+  804fd3:	ff d0                	call   *%rax
+    return res;
+  804fd5:	eb a3                	jmp    804f7a <fd_close+0x4d>
+
+0000000000804fd7 <close>:
+
+int
+close(int fdnum) {
+  804fd7:	55                   	push   %rbp
+  804fd8:	48 89 e5             	mov    %rsp,%rbp
+  804fdb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804fdf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fe3:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  804fea:	00 00 00 
+  804fed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fef:	85 c0                	test   %eax,%eax
+  804ff1:	78 15                	js     805008 <close+0x31>
+
+    return fd_close(fd, 1);
+  804ff3:	be 01 00 00 00       	mov    $0x1,%esi
+  804ff8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804ffc:	48 b8 2d 4f 80 00 00 	movabs $0x804f2d,%rax
+  805003:	00 00 00 
+  805006:	ff d0                	call   *%rax
+}
+  805008:	c9                   	leave
+  805009:	c3                   	ret
+
+000000000080500a <close_all>:
+
+void
+close_all(void) {
+  80500a:	55                   	push   %rbp
+  80500b:	48 89 e5             	mov    %rsp,%rbp
+  80500e:	41 54                	push   %r12
+  805010:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  805011:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805016:	49 bc d7 4f 80 00 00 	movabs $0x804fd7,%r12
+  80501d:	00 00 00 
+  805020:	89 df                	mov    %ebx,%edi
+  805022:	41 ff d4             	call   *%r12
+  805025:	83 c3 01             	add    $0x1,%ebx
+  805028:	83 fb 20             	cmp    $0x20,%ebx
+  80502b:	75 f3                	jne    805020 <close_all+0x16>
+}
+  80502d:	5b                   	pop    %rbx
+  80502e:	41 5c                	pop    %r12
+  805030:	5d                   	pop    %rbp
+  805031:	c3                   	ret
+
+0000000000805032 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  805032:	55                   	push   %rbp
+  805033:	48 89 e5             	mov    %rsp,%rbp
+  805036:	41 57                	push   %r15
+  805038:	41 56                	push   %r14
+  80503a:	41 55                	push   %r13
+  80503c:	41 54                	push   %r12
+  80503e:	53                   	push   %rbx
+  80503f:	48 83 ec 18          	sub    $0x18,%rsp
+  805043:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  805046:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80504a:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  805051:	00 00 00 
+  805054:	ff d0                	call   *%rax
+  805056:	89 c3                	mov    %eax,%ebx
+  805058:	85 c0                	test   %eax,%eax
+  80505a:	0f 88 b8 00 00 00    	js     805118 <dup+0xe6>
+    close(newfdnum);
+  805060:	44 89 e7             	mov    %r12d,%edi
+  805063:	48 b8 d7 4f 80 00 00 	movabs $0x804fd7,%rax
+  80506a:	00 00 00 
+  80506d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80506f:	4d 63 ec             	movslq %r12d,%r13
+  805072:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  805079:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80507d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  805081:	4c 89 ff             	mov    %r15,%rdi
+  805084:	49 be f6 4d 80 00 00 	movabs $0x804df6,%r14
+  80508b:	00 00 00 
+  80508e:	41 ff d6             	call   *%r14
+  805091:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  805094:	4c 89 ef             	mov    %r13,%rdi
+  805097:	41 ff d6             	call   *%r14
+  80509a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80509d:	48 89 df             	mov    %rbx,%rdi
+  8050a0:	48 b8 6e 61 80 00 00 	movabs $0x80616e,%rax
+  8050a7:	00 00 00 
+  8050aa:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8050ac:	a8 04                	test   $0x4,%al
+  8050ae:	74 2b                	je     8050db <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8050b0:	41 89 c1             	mov    %eax,%r9d
+  8050b3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8050b9:	4c 89 f1             	mov    %r14,%rcx
+  8050bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050c1:	48 89 de             	mov    %rbx,%rsi
+  8050c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050c9:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  8050d0:	00 00 00 
+  8050d3:	ff d0                	call   *%rax
+  8050d5:	89 c3                	mov    %eax,%ebx
+  8050d7:	85 c0                	test   %eax,%eax
+  8050d9:	78 4e                	js     805129 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8050db:	4c 89 ff             	mov    %r15,%rdi
+  8050de:	48 b8 6e 61 80 00 00 	movabs $0x80616e,%rax
+  8050e5:	00 00 00 
+  8050e8:	ff d0                	call   *%rax
+  8050ea:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8050ed:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8050f3:	4c 89 e9             	mov    %r13,%rcx
+  8050f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050fb:	4c 89 fe             	mov    %r15,%rsi
+  8050fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  805103:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  80510a:	00 00 00 
+  80510d:	ff d0                	call   *%rax
+  80510f:	89 c3                	mov    %eax,%ebx
+  805111:	85 c0                	test   %eax,%eax
+  805113:	78 14                	js     805129 <dup+0xf7>
+
+    return newfdnum;
+  805115:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  805118:	89 d8                	mov    %ebx,%eax
+  80511a:	48 83 c4 18          	add    $0x18,%rsp
+  80511e:	5b                   	pop    %rbx
+  80511f:	41 5c                	pop    %r12
+  805121:	41 5d                	pop    %r13
+  805123:	41 5e                	pop    %r14
+  805125:	41 5f                	pop    %r15
+  805127:	5d                   	pop    %rbp
+  805128:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  805129:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80512e:	4c 89 ee             	mov    %r13,%rsi
+  805131:	bf 00 00 00 00       	mov    $0x0,%edi
+  805136:	49 bc ca 42 80 00 00 	movabs $0x8042ca,%r12
+  80513d:	00 00 00 
+  805140:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  805143:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805148:	4c 89 f6             	mov    %r14,%rsi
+  80514b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805150:	41 ff d4             	call   *%r12
+    return res;
+  805153:	eb c3                	jmp    805118 <dup+0xe6>
+
+0000000000805155 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  805155:	55                   	push   %rbp
+  805156:	48 89 e5             	mov    %rsp,%rbp
+  805159:	41 56                	push   %r14
+  80515b:	41 55                	push   %r13
+  80515d:	41 54                	push   %r12
+  80515f:	53                   	push   %rbx
+  805160:	48 83 ec 10          	sub    $0x10,%rsp
+  805164:	89 fb                	mov    %edi,%ebx
+  805166:	49 89 f4             	mov    %rsi,%r12
+  805169:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80516c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  805170:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  805177:	00 00 00 
+  80517a:	ff d0                	call   *%rax
+  80517c:	85 c0                	test   %eax,%eax
+  80517e:	78 4c                	js     8051cc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  805180:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  805184:	41 8b 3e             	mov    (%r14),%edi
+  805187:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80518b:	48 b8 bd 4e 80 00 00 	movabs $0x804ebd,%rax
+  805192:	00 00 00 
+  805195:	ff d0                	call   *%rax
+  805197:	85 c0                	test   %eax,%eax
+  805199:	78 35                	js     8051d0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80519b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80519f:	83 e0 03             	and    $0x3,%eax
+  8051a2:	83 f8 01             	cmp    $0x1,%eax
+  8051a5:	74 2d                	je     8051d4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8051a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051ab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051af:	48 85 c0             	test   %rax,%rax
+  8051b2:	74 56                	je     80520a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8051b4:	4c 89 ea             	mov    %r13,%rdx
+  8051b7:	4c 89 e6             	mov    %r12,%rsi
+  8051ba:	4c 89 f7             	mov    %r14,%rdi
+  8051bd:	ff d0                	call   *%rax
+}
+  8051bf:	48 83 c4 10          	add    $0x10,%rsp
+  8051c3:	5b                   	pop    %rbx
+  8051c4:	41 5c                	pop    %r12
+  8051c6:	41 5d                	pop    %r13
+  8051c8:	41 5e                	pop    %r14
+  8051ca:	5d                   	pop    %rbp
+  8051cb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8051cc:	48 98                	cltq
+  8051ce:	eb ef                	jmp    8051bf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8051d0:	48 98                	cltq
+  8051d2:	eb eb                	jmp    8051bf <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8051d4:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  8051db:	00 00 00 
+  8051de:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8051e4:	89 da                	mov    %ebx,%edx
+  8051e6:	48 bf 01 74 80 00 00 	movabs $0x807401,%rdi
+  8051ed:	00 00 00 
+  8051f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f5:	48 b9 56 31 80 00 00 	movabs $0x803156,%rcx
+  8051fc:	00 00 00 
+  8051ff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  805201:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  805208:	eb b5                	jmp    8051bf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80520a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  805211:	eb ac                	jmp    8051bf <read+0x6a>
+
+0000000000805213 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  805213:	55                   	push   %rbp
+  805214:	48 89 e5             	mov    %rsp,%rbp
+  805217:	41 57                	push   %r15
+  805219:	41 56                	push   %r14
+  80521b:	41 55                	push   %r13
+  80521d:	41 54                	push   %r12
+  80521f:	53                   	push   %rbx
+  805220:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  805224:	48 85 d2             	test   %rdx,%rdx
+  805227:	74 54                	je     80527d <readn+0x6a>
+  805229:	41 89 fd             	mov    %edi,%r13d
+  80522c:	49 89 f6             	mov    %rsi,%r14
+  80522f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  805232:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  805237:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80523c:	49 bf 55 51 80 00 00 	movabs $0x805155,%r15
+  805243:	00 00 00 
+  805246:	4c 89 e2             	mov    %r12,%rdx
+  805249:	48 29 f2             	sub    %rsi,%rdx
+  80524c:	4c 01 f6             	add    %r14,%rsi
+  80524f:	44 89 ef             	mov    %r13d,%edi
+  805252:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  805255:	85 c0                	test   %eax,%eax
+  805257:	78 20                	js     805279 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  805259:	01 c3                	add    %eax,%ebx
+  80525b:	85 c0                	test   %eax,%eax
+  80525d:	74 08                	je     805267 <readn+0x54>
+  80525f:	48 63 f3             	movslq %ebx,%rsi
+  805262:	4c 39 e6             	cmp    %r12,%rsi
+  805265:	72 df                	jb     805246 <readn+0x33>
+    }
+    return res;
+  805267:	48 63 c3             	movslq %ebx,%rax
+}
+  80526a:	48 83 c4 08          	add    $0x8,%rsp
+  80526e:	5b                   	pop    %rbx
+  80526f:	41 5c                	pop    %r12
+  805271:	41 5d                	pop    %r13
+  805273:	41 5e                	pop    %r14
+  805275:	41 5f                	pop    %r15
+  805277:	5d                   	pop    %rbp
+  805278:	c3                   	ret
+        if (inc < 0) return inc;
+  805279:	48 98                	cltq
+  80527b:	eb ed                	jmp    80526a <readn+0x57>
+    int inc = 1, res = 0;
+  80527d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805282:	eb e3                	jmp    805267 <readn+0x54>
+
+0000000000805284 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  805284:	55                   	push   %rbp
+  805285:	48 89 e5             	mov    %rsp,%rbp
+  805288:	41 56                	push   %r14
+  80528a:	41 55                	push   %r13
+  80528c:	41 54                	push   %r12
+  80528e:	53                   	push   %rbx
+  80528f:	48 83 ec 10          	sub    $0x10,%rsp
+  805293:	89 fb                	mov    %edi,%ebx
+  805295:	49 89 f4             	mov    %rsi,%r12
+  805298:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80529b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80529f:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  8052a6:	00 00 00 
+  8052a9:	ff d0                	call   *%rax
+  8052ab:	85 c0                	test   %eax,%eax
+  8052ad:	78 47                	js     8052f6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8052af:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8052b3:	41 8b 3e             	mov    (%r14),%edi
+  8052b6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8052ba:	48 b8 bd 4e 80 00 00 	movabs $0x804ebd,%rax
+  8052c1:	00 00 00 
+  8052c4:	ff d0                	call   *%rax
+  8052c6:	85 c0                	test   %eax,%eax
+  8052c8:	78 30                	js     8052fa <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8052ca:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8052cf:	74 2d                	je     8052fe <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8052d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052d5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8052d9:	48 85 c0             	test   %rax,%rax
+  8052dc:	74 56                	je     805334 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8052de:	4c 89 ea             	mov    %r13,%rdx
+  8052e1:	4c 89 e6             	mov    %r12,%rsi
+  8052e4:	4c 89 f7             	mov    %r14,%rdi
+  8052e7:	ff d0                	call   *%rax
+}
+  8052e9:	48 83 c4 10          	add    $0x10,%rsp
+  8052ed:	5b                   	pop    %rbx
+  8052ee:	41 5c                	pop    %r12
+  8052f0:	41 5d                	pop    %r13
+  8052f2:	41 5e                	pop    %r14
+  8052f4:	5d                   	pop    %rbp
+  8052f5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8052f6:	48 98                	cltq
+  8052f8:	eb ef                	jmp    8052e9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8052fa:	48 98                	cltq
+  8052fc:	eb eb                	jmp    8052e9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8052fe:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  805305:	00 00 00 
+  805308:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80530e:	89 da                	mov    %ebx,%edx
+  805310:	48 bf 1d 74 80 00 00 	movabs $0x80741d,%rdi
+  805317:	00 00 00 
+  80531a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80531f:	48 b9 56 31 80 00 00 	movabs $0x803156,%rcx
+  805326:	00 00 00 
+  805329:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80532b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  805332:	eb b5                	jmp    8052e9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  805334:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80533b:	eb ac                	jmp    8052e9 <write+0x65>
+
+000000000080533d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80533d:	55                   	push   %rbp
+  80533e:	48 89 e5             	mov    %rsp,%rbp
+  805341:	53                   	push   %rbx
+  805342:	48 83 ec 18          	sub    $0x18,%rsp
+  805346:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  805348:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80534c:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  805353:	00 00 00 
+  805356:	ff d0                	call   *%rax
+  805358:	85 c0                	test   %eax,%eax
+  80535a:	78 0c                	js     805368 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80535c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805360:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  805363:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80536c:	c9                   	leave
+  80536d:	c3                   	ret
+
+000000000080536e <tell>:
+
+int tell(int fdnum) {
+  80536e:	55                   	push   %rbp
+  80536f:	48 89 e5             	mov    %rsp,%rbp
+  805372:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  805376:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80537a:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  805381:	00 00 00 
+  805384:	ff d0                	call   *%rax
+  805386:	85 c0                	test   %eax,%eax
+  805388:	78 07                	js     805391 <tell+0x23>
+
+    return fd->fd_offset;
+  80538a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80538e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  805391:	c9                   	leave
+  805392:	c3                   	ret
+
+0000000000805393 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  805393:	55                   	push   %rbp
+  805394:	48 89 e5             	mov    %rsp,%rbp
+  805397:	41 55                	push   %r13
+  805399:	41 54                	push   %r12
+  80539b:	53                   	push   %rbx
+  80539c:	48 83 ec 18          	sub    $0x18,%rsp
+  8053a0:	89 fb                	mov    %edi,%ebx
+  8053a2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8053a5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8053a9:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  8053b0:	00 00 00 
+  8053b3:	ff d0                	call   *%rax
+  8053b5:	85 c0                	test   %eax,%eax
+  8053b7:	78 38                	js     8053f1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8053b9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8053bd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8053c1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8053c5:	48 b8 bd 4e 80 00 00 	movabs $0x804ebd,%rax
+  8053cc:	00 00 00 
+  8053cf:	ff d0                	call   *%rax
+  8053d1:	85 c0                	test   %eax,%eax
+  8053d3:	78 1c                	js     8053f1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8053d5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8053da:	74 20                	je     8053fc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8053dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053e0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8053e4:	48 85 c0             	test   %rax,%rax
+  8053e7:	74 47                	je     805430 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8053e9:	44 89 e6             	mov    %r12d,%esi
+  8053ec:	4c 89 ef             	mov    %r13,%rdi
+  8053ef:	ff d0                	call   *%rax
+}
+  8053f1:	48 83 c4 18          	add    $0x18,%rsp
+  8053f5:	5b                   	pop    %rbx
+  8053f6:	41 5c                	pop    %r12
+  8053f8:	41 5d                	pop    %r13
+  8053fa:	5d                   	pop    %rbp
+  8053fb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8053fc:	48 a1 40 60 82 00 00 	movabs 0x826040,%rax
+  805403:	00 00 00 
+  805406:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80540c:	89 da                	mov    %ebx,%edx
+  80540e:	48 bf e0 73 80 00 00 	movabs $0x8073e0,%rdi
+  805415:	00 00 00 
+  805418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80541d:	48 b9 56 31 80 00 00 	movabs $0x803156,%rcx
+  805424:	00 00 00 
+  805427:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  805429:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80542e:	eb c1                	jmp    8053f1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  805430:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805435:	eb ba                	jmp    8053f1 <ftruncate+0x5e>
+
+0000000000805437 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  805437:	55                   	push   %rbp
+  805438:	48 89 e5             	mov    %rsp,%rbp
+  80543b:	41 54                	push   %r12
+  80543d:	53                   	push   %rbx
+  80543e:	48 83 ec 10          	sub    $0x10,%rsp
+  805442:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  805445:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  805449:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  805450:	00 00 00 
+  805453:	ff d0                	call   *%rax
+  805455:	85 c0                	test   %eax,%eax
+  805457:	78 63                	js     8054bc <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  805459:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80545d:	41 8b 3c 24          	mov    (%r12),%edi
+  805461:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  805465:	48 b8 bd 4e 80 00 00 	movabs $0x804ebd,%rax
+  80546c:	00 00 00 
+  80546f:	ff d0                	call   *%rax
+  805471:	85 c0                	test   %eax,%eax
+  805473:	78 47                	js     8054bc <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  805475:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805479:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80547e:	74 45                	je     8054c5 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  805480:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  805483:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80548a:	00 00 00 
+    stat->st_isdir = 0;
+  80548d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  805494:	00 00 00 
+    stat->st_ino = 0;
+  805497:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80549e:	00 00 00 00 
+    stat->st_version = 0;
+  8054a2:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8054a9:	00 00 00 
+    stat->st_dev = dev;
+  8054ac:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8054b3:	48 89 de             	mov    %rbx,%rsi
+  8054b6:	4c 89 e7             	mov    %r12,%rdi
+  8054b9:	ff 50 28             	call   *0x28(%rax)
+}
+  8054bc:	48 83 c4 10          	add    $0x10,%rsp
+  8054c0:	5b                   	pop    %rbx
+  8054c1:	41 5c                	pop    %r12
+  8054c3:	5d                   	pop    %rbp
+  8054c4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8054c5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8054ca:	eb f0                	jmp    8054bc <fstat+0x85>
+
+00000000008054cc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8054cc:	55                   	push   %rbp
+  8054cd:	48 89 e5             	mov    %rsp,%rbp
+  8054d0:	41 54                	push   %r12
+  8054d2:	53                   	push   %rbx
+  8054d3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8054d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8054db:	48 b8 ed 59 80 00 00 	movabs $0x8059ed,%rax
+  8054e2:	00 00 00 
+  8054e5:	ff d0                	call   *%rax
+  8054e7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8054e9:	85 c0                	test   %eax,%eax
+  8054eb:	78 25                	js     805512 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8054ed:	4c 89 e6             	mov    %r12,%rsi
+  8054f0:	89 c7                	mov    %eax,%edi
+  8054f2:	48 b8 37 54 80 00 00 	movabs $0x805437,%rax
+  8054f9:	00 00 00 
+  8054fc:	ff d0                	call   *%rax
+  8054fe:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  805501:	89 df                	mov    %ebx,%edi
+  805503:	48 b8 d7 4f 80 00 00 	movabs $0x804fd7,%rax
+  80550a:	00 00 00 
+  80550d:	ff d0                	call   *%rax
+
+    return res;
+  80550f:	44 89 e3             	mov    %r12d,%ebx
+}
+  805512:	89 d8                	mov    %ebx,%eax
+  805514:	5b                   	pop    %rbx
+  805515:	41 5c                	pop    %r12
+  805517:	5d                   	pop    %rbp
+  805518:	c3                   	ret
+
+0000000000805519 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  805519:	48 b8 00 80 82 00 00 	movabs $0x828000,%rax
+  805520:	00 00 00 
+  805523:	83 38 00             	cmpl   $0x0,(%rax)
+  805526:	74 0a                	je     805532 <fsipc_env+0x19>
+    return fsenv;
+}
+  805528:	a1 00 80 82 00 00 00 	movabs 0x828000,%eax
+  80552f:	00 00 
+  805531:	c3                   	ret
+fsipc_env(void) {
+  805532:	55                   	push   %rbp
+  805533:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  805536:	bf 03 00 00 00       	mov    $0x3,%edi
+  80553b:	48 b8 94 4d 80 00 00 	movabs $0x804d94,%rax
+  805542:	00 00 00 
+  805545:	ff d0                	call   *%rax
+  805547:	a3 00 80 82 00 00 00 	movabs %eax,0x828000
+  80554e:	00 00 
+}
+  805550:	a1 00 80 82 00 00 00 	movabs 0x828000,%eax
+  805557:	00 00 
+  805559:	5d                   	pop    %rbp
+  80555a:	c3                   	ret
+
+000000000080555b <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80555b:	55                   	push   %rbp
+  80555c:	48 89 e5             	mov    %rsp,%rbp
+  80555f:	53                   	push   %rbx
+  805560:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  805564:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80556b:	00 
+  80556c:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  805573:	00 
+  805574:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80557b:	00 
+  80557c:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  805583:	00 
+  805584:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80558b:	00 
+
+    assert(size <= sizeof(words));
+  80558c:	48 83 fa 28          	cmp    $0x28,%rdx
+  805590:	77 38                	ja     8055ca <fsipc_short+0x6f>
+  805592:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  805594:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  805598:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  80559f:	00 00 00 
+  8055a2:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8055a4:	48 b8 19 55 80 00 00 	movabs $0x805519,%rax
+  8055ab:	00 00 00 
+  8055ae:	ff d0                	call   *%rax
+  8055b0:	89 c7                	mov    %eax,%edi
+  8055b2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8055b6:	89 de                	mov    %ebx,%esi
+  8055b8:	48 b8 f7 4c 80 00 00 	movabs $0x804cf7,%rax
+  8055bf:	00 00 00 
+  8055c2:	ff d0                	call   *%rax
+}
+  8055c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055c8:	c9                   	leave
+  8055c9:	c3                   	ret
+    assert(size <= sizeof(words));
+  8055ca:	48 b9 60 74 80 00 00 	movabs $0x807460,%rcx
+  8055d1:	00 00 00 
+  8055d4:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  8055db:	00 00 00 
+  8055de:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8055e3:	48 bf 76 74 80 00 00 	movabs $0x807476,%rdi
+  8055ea:	00 00 00 
+  8055ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055f2:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8055f9:	00 00 00 
+  8055fc:	41 ff d0             	call   *%r8
+
+00000000008055ff <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8055ff:	55                   	push   %rbp
+  805600:	48 89 e5             	mov    %rsp,%rbp
+  805603:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  805607:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80560a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80560d:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  805610:	ba 08 00 00 00       	mov    $0x8,%edx
+  805615:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805619:	bf 02 00 00 00       	mov    $0x2,%edi
+  80561e:	48 b8 5b 55 80 00 00 	movabs $0x80555b,%rax
+  805625:	00 00 00 
+  805628:	ff d0                	call   *%rax
+}
+  80562a:	c9                   	leave
+  80562b:	c3                   	ret
+
+000000000080562c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80562c:	55                   	push   %rbp
+  80562d:	48 89 e5             	mov    %rsp,%rbp
+  805630:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  805634:	8b 47 0c             	mov    0xc(%rdi),%eax
+  805637:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  80563a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80563f:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  805643:	bf 06 00 00 00       	mov    $0x6,%edi
+  805648:	48 b8 5b 55 80 00 00 	movabs $0x80555b,%rax
+  80564f:	00 00 00 
+  805652:	ff d0                	call   *%rax
+}
+  805654:	c9                   	leave
+  805655:	c3                   	ret
+
+0000000000805656 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  805656:	55                   	push   %rbp
+  805657:	48 89 e5             	mov    %rsp,%rbp
+  80565a:	41 54                	push   %r12
+  80565c:	53                   	push   %rbx
+  80565d:	48 83 ec 10          	sub    $0x10,%rsp
+  805661:	89 fb                	mov    %edi,%ebx
+  805663:	49 89 f4             	mov    %rsi,%r12
+  805666:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80566a:	48 b8 19 55 80 00 00 	movabs $0x805519,%rax
+  805671:	00 00 00 
+  805674:	ff d0                	call   *%rax
+  805676:	89 c7                	mov    %eax,%edi
+  805678:	6a 00                	push   $0x0
+  80567a:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80567e:	50                   	push   %rax
+  80567f:	4d 89 e1             	mov    %r12,%r9
+  805682:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  805688:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80568d:	48 ba 00 70 82 00 00 	movabs $0x827000,%rdx
+  805694:	00 00 00 
+  805697:	89 de                	mov    %ebx,%esi
+  805699:	48 b8 92 4c 80 00 00 	movabs $0x804c92,%rax
+  8056a0:	00 00 00 
+  8056a3:	ff d0                	call   *%rax
+}
+  8056a5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8056a9:	5b                   	pop    %rbx
+  8056aa:	41 5c                	pop    %r12
+  8056ac:	5d                   	pop    %rbp
+  8056ad:	c3                   	ret
+
+00000000008056ae <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8056ae:	55                   	push   %rbp
+  8056af:	48 89 e5             	mov    %rsp,%rbp
+  8056b2:	41 54                	push   %r12
+  8056b4:	53                   	push   %rbx
+  8056b5:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8056b8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8056bb:	a3 00 70 82 00 00 00 	movabs %eax,0x827000
+  8056c2:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8056c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8056c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8056ce:	bf 05 00 00 00       	mov    $0x5,%edi
+  8056d3:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  8056da:	00 00 00 
+  8056dd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8056df:	85 c0                	test   %eax,%eax
+  8056e1:	78 5a                	js     80573d <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8056e3:	49 bc 00 70 82 00 00 	movabs $0x827000,%r12
+  8056ea:	00 00 00 
+  8056ed:	4c 89 e6             	mov    %r12,%rsi
+  8056f0:	48 89 df             	mov    %rbx,%rdi
+  8056f3:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  8056fa:	00 00 00 
+  8056fd:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8056ff:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  805706:	00 
+  805707:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80570d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  805714:	00 
+  805715:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  80571b:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  805722:	00 
+  805723:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  80572a:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  805731:	00 
+  805732:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  805738:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80573d:	5b                   	pop    %rbx
+  80573e:	41 5c                	pop    %r12
+  805740:	5d                   	pop    %rbp
+  805741:	c3                   	ret
+
+0000000000805742 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  805742:	55                   	push   %rbp
+  805743:	48 89 e5             	mov    %rsp,%rbp
+  805746:	41 57                	push   %r15
+  805748:	41 56                	push   %r14
+  80574a:	41 55                	push   %r13
+  80574c:	41 54                	push   %r12
+  80574e:	53                   	push   %rbx
+  80574f:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  805753:	48 85 ff             	test   %rdi,%rdi
+  805756:	0f 84 a1 00 00 00    	je     8057fd <devfile_read+0xbb>
+  80575c:	49 89 ff             	mov    %rdi,%r15
+  80575f:	49 89 f5             	mov    %rsi,%r13
+  805762:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  805765:	48 85 f6             	test   %rsi,%rsi
+  805768:	0f 84 c4 00 00 00    	je     805832 <devfile_read+0xf0>
+    size_t total_read = 0;
+  80576e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805775:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  805776:	49 be 00 70 82 00 00 	movabs $0x827000,%r14
+  80577d:	00 00 00 
+  805780:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  805784:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  805787:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80578b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805790:	be 00 00 00 00       	mov    $0x0,%esi
+  805795:	bf 03 00 00 00       	mov    $0x3,%edi
+  80579a:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  8057a1:	00 00 00 
+  8057a4:	ff d0                	call   *%rax
+        if (res < 0) {
+  8057a6:	85 c0                	test   %eax,%eax
+  8057a8:	0f 88 b9 00 00 00    	js     805867 <devfile_read+0x125>
+        assert(res <= n);
+  8057ae:	48 63 d8             	movslq %eax,%rbx
+  8057b1:	49 39 dc             	cmp    %rbx,%r12
+  8057b4:	0f 82 b1 00 00 00    	jb     80586b <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8057ba:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8057bf:	0f 87 db 00 00 00    	ja     8058a0 <devfile_read+0x15e>
+        if (!res) {
+  8057c5:	85 c0                	test   %eax,%eax
+  8057c7:	74 21                	je     8057ea <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8057c9:	48 89 da             	mov    %rbx,%rdx
+  8057cc:	4c 89 f6             	mov    %r14,%rsi
+  8057cf:	4c 89 ef             	mov    %r13,%rdi
+  8057d2:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  8057d9:	00 00 00 
+  8057dc:	ff d0                	call   *%rax
+        total_read += res;
+  8057de:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8057e2:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8057e5:	49 29 dc             	sub    %rbx,%r12
+  8057e8:	75 96                	jne    805780 <devfile_read+0x3e>
+    return total_read;
+  8057ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8057ee:	48 83 c4 18          	add    $0x18,%rsp
+  8057f2:	5b                   	pop    %rbx
+  8057f3:	41 5c                	pop    %r12
+  8057f5:	41 5d                	pop    %r13
+  8057f7:	41 5e                	pop    %r14
+  8057f9:	41 5f                	pop    %r15
+  8057fb:	5d                   	pop    %rbp
+  8057fc:	c3                   	ret
+    assert(fd);
+  8057fd:	48 b9 a2 6a 80 00 00 	movabs $0x806aa2,%rcx
+  805804:	00 00 00 
+  805807:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  80580e:	00 00 00 
+  805811:	be 91 00 00 00       	mov    $0x91,%esi
+  805816:	48 bf 76 74 80 00 00 	movabs $0x807476,%rdi
+  80581d:	00 00 00 
+  805820:	b8 00 00 00 00       	mov    $0x0,%eax
+  805825:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  80582c:	00 00 00 
+  80582f:	41 ff d0             	call   *%r8
+    assert(buf);
+  805832:	48 b9 81 74 80 00 00 	movabs $0x807481,%rcx
+  805839:	00 00 00 
+  80583c:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  805843:	00 00 00 
+  805846:	be 92 00 00 00       	mov    $0x92,%esi
+  80584b:	48 bf 76 74 80 00 00 	movabs $0x807476,%rdi
+  805852:	00 00 00 
+  805855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80585a:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  805861:	00 00 00 
+  805864:	41 ff d0             	call   *%r8
+            return res;
+  805867:	48 98                	cltq
+  805869:	eb 83                	jmp    8057ee <devfile_read+0xac>
+        assert(res <= n);
+  80586b:	48 b9 85 74 80 00 00 	movabs $0x807485,%rcx
+  805872:	00 00 00 
+  805875:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  80587c:	00 00 00 
+  80587f:	be 9e 00 00 00       	mov    $0x9e,%esi
+  805884:	48 bf 76 74 80 00 00 	movabs $0x807476,%rdi
+  80588b:	00 00 00 
+  80588e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805893:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  80589a:	00 00 00 
+  80589d:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8058a0:	48 b9 90 74 80 00 00 	movabs $0x807490,%rcx
+  8058a7:	00 00 00 
+  8058aa:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  8058b1:	00 00 00 
+  8058b4:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8058b9:	48 bf 76 74 80 00 00 	movabs $0x807476,%rdi
+  8058c0:	00 00 00 
+  8058c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058c8:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8058cf:	00 00 00 
+  8058d2:	41 ff d0             	call   *%r8
+
+00000000008058d5 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8058d5:	55                   	push   %rbp
+  8058d6:	48 89 e5             	mov    %rsp,%rbp
+  8058d9:	41 57                	push   %r15
+  8058db:	41 56                	push   %r14
+  8058dd:	41 55                	push   %r13
+  8058df:	41 54                	push   %r12
+  8058e1:	53                   	push   %rbx
+  8058e2:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8058e6:	48 85 ff             	test   %rdi,%rdi
+  8058e9:	0f 84 83 00 00 00    	je     805972 <devfile_write+0x9d>
+  8058ef:	49 89 ff             	mov    %rdi,%r15
+  8058f2:	49 89 f4             	mov    %rsi,%r12
+  8058f5:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8058f8:	48 85 f6             	test   %rsi,%rsi
+  8058fb:	0f 84 a6 00 00 00    	je     8059a7 <devfile_write+0xd2>
+    size_t total_written = 0;
+  805901:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  805907:	49 be 00 70 82 00 00 	movabs $0x827000,%r14
+  80590e:	00 00 00 
+  805911:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  805915:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  805918:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80591c:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  805921:	48 39 d3             	cmp    %rdx,%rbx
+  805924:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  805928:	4c 89 e6             	mov    %r12,%rsi
+  80592b:	48 bf 10 70 82 00 00 	movabs $0x827010,%rdi
+  805932:	00 00 00 
+  805935:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  80593c:	00 00 00 
+  80593f:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  805941:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805946:	be 00 00 00 00       	mov    $0x0,%esi
+  80594b:	bf 04 00 00 00       	mov    $0x4,%edi
+  805950:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  805957:	00 00 00 
+  80595a:	ff d0                	call   *%rax
+        if (res < 0) {
+  80595c:	85 c0                	test   %eax,%eax
+  80595e:	78 7c                	js     8059dc <devfile_write+0x107>
+        total_written += res;
+  805960:	48 98                	cltq
+  805962:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  805965:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  805968:	48 29 c3             	sub    %rax,%rbx
+  80596b:	75 a4                	jne    805911 <devfile_write+0x3c>
+    return total_written;
+  80596d:	4c 89 e8             	mov    %r13,%rax
+  805970:	eb 6c                	jmp    8059de <devfile_write+0x109>
+    assert(fd);
+  805972:	48 b9 a2 6a 80 00 00 	movabs $0x806aa2,%rcx
+  805979:	00 00 00 
+  80597c:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  805983:	00 00 00 
+  805986:	be bd 00 00 00       	mov    $0xbd,%esi
+  80598b:	48 bf 76 74 80 00 00 	movabs $0x807476,%rdi
+  805992:	00 00 00 
+  805995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80599a:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8059a1:	00 00 00 
+  8059a4:	41 ff d0             	call   *%r8
+    assert(buf);
+  8059a7:	48 b9 81 74 80 00 00 	movabs $0x807481,%rcx
+  8059ae:	00 00 00 
+  8059b1:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  8059b8:	00 00 00 
+  8059bb:	be be 00 00 00       	mov    $0xbe,%esi
+  8059c0:	48 bf 76 74 80 00 00 	movabs $0x807476,%rdi
+  8059c7:	00 00 00 
+  8059ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059cf:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  8059d6:	00 00 00 
+  8059d9:	41 ff d0             	call   *%r8
+            return res;
+  8059dc:	48 98                	cltq
+}
+  8059de:	48 83 c4 08          	add    $0x8,%rsp
+  8059e2:	5b                   	pop    %rbx
+  8059e3:	41 5c                	pop    %r12
+  8059e5:	41 5d                	pop    %r13
+  8059e7:	41 5e                	pop    %r14
+  8059e9:	41 5f                	pop    %r15
+  8059eb:	5d                   	pop    %rbp
+  8059ec:	c3                   	ret
+
+00000000008059ed <open>:
+open(const char *path, int mode) {
+  8059ed:	55                   	push   %rbp
+  8059ee:	48 89 e5             	mov    %rsp,%rbp
+  8059f1:	41 55                	push   %r13
+  8059f3:	41 54                	push   %r12
+  8059f5:	53                   	push   %rbx
+  8059f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8059fa:	49 89 fc             	mov    %rdi,%r12
+  8059fd:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  805a00:	48 b8 4f 3a 80 00 00 	movabs $0x803a4f,%rax
+  805a07:	00 00 00 
+  805a0a:	ff d0                	call   *%rax
+  805a0c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  805a12:	0f 87 8f 00 00 00    	ja     805aa7 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805a18:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  805a1c:	48 b8 12 4e 80 00 00 	movabs $0x804e12,%rax
+  805a23:	00 00 00 
+  805a26:	ff d0                	call   *%rax
+  805a28:	89 c3                	mov    %eax,%ebx
+  805a2a:	85 c0                	test   %eax,%eax
+  805a2c:	78 55                	js     805a83 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  805a2e:	4c 89 e6             	mov    %r12,%rsi
+  805a31:	48 bb 00 70 82 00 00 	movabs $0x827000,%rbx
+  805a38:	00 00 00 
+  805a3b:	48 89 df             	mov    %rbx,%rdi
+  805a3e:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  805a45:	00 00 00 
+  805a48:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  805a4a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  805a51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805a56:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  805a5a:	bf 01 00 00 00       	mov    $0x1,%edi
+  805a5f:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  805a66:	00 00 00 
+  805a69:	ff d0                	call   *%rax
+  805a6b:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  805a6d:	85 c0                	test   %eax,%eax
+  805a6f:	78 1f                	js     805a90 <open+0xa3>
+    return fd2num(fd);
+  805a71:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805a75:	48 b8 e4 4d 80 00 00 	movabs $0x804de4,%rax
+  805a7c:	00 00 00 
+  805a7f:	ff d0                	call   *%rax
+  805a81:	89 c3                	mov    %eax,%ebx
+}
+  805a83:	89 d8                	mov    %ebx,%eax
+  805a85:	48 83 c4 18          	add    $0x18,%rsp
+  805a89:	5b                   	pop    %rbx
+  805a8a:	41 5c                	pop    %r12
+  805a8c:	41 5d                	pop    %r13
+  805a8e:	5d                   	pop    %rbp
+  805a8f:	c3                   	ret
+        fd_close(fd, 0);
+  805a90:	be 00 00 00 00       	mov    $0x0,%esi
+  805a95:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805a99:	48 b8 2d 4f 80 00 00 	movabs $0x804f2d,%rax
+  805aa0:	00 00 00 
+  805aa3:	ff d0                	call   *%rax
+        return res;
+  805aa5:	eb dc                	jmp    805a83 <open+0x96>
+        return -E_BAD_PATH;
+  805aa7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  805aac:	eb d5                	jmp    805a83 <open+0x96>
+
+0000000000805aae <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  805aae:	55                   	push   %rbp
+  805aaf:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  805ab2:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ab7:	be 00 00 00 00       	mov    $0x0,%esi
+  805abc:	bf 08 00 00 00       	mov    $0x8,%edi
+  805ac1:	48 b8 5b 55 80 00 00 	movabs $0x80555b,%rax
+  805ac8:	00 00 00 
+  805acb:	ff d0                	call   *%rax
+}
+  805acd:	5d                   	pop    %rbp
+  805ace:	c3                   	ret
+
+0000000000805acf <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  805acf:	55                   	push   %rbp
+  805ad0:	48 89 e5             	mov    %rsp,%rbp
+  805ad3:	41 56                	push   %r14
+  805ad5:	41 55                	push   %r13
+  805ad7:	41 54                	push   %r12
+  805ad9:	53                   	push   %rbx
+  805ada:	48 83 ec 10          	sub    $0x10,%rsp
+  805ade:	41 89 f6             	mov    %esi,%r14d
+  805ae1:	49 89 d4             	mov    %rdx,%r12
+  805ae4:	48 89 cb             	mov    %rcx,%rbx
+  805ae7:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  805aea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  805aee:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  805af5:	00 00 00 
+  805af8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805afa:	85 c0                	test   %eax,%eax
+  805afc:	78 46                	js     805b44 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  805afe:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805b02:	48 b8 a0 c0 80 00 00 	movabs $0x80c0a0,%rax
+  805b09:	00 00 00 
+  805b0c:	8b 00                	mov    (%rax),%eax
+  805b0e:	39 02                	cmp    %eax,(%rdx)
+  805b10:	75 3f                	jne    805b51 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  805b12:	48 b8 00 70 82 00 00 	movabs $0x827000,%rax
+  805b19:	00 00 00 
+  805b1c:	8b 52 0c             	mov    0xc(%rdx),%edx
+  805b1f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  805b21:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  805b25:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  805b29:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  805b2d:	48 89 da             	mov    %rbx,%rdx
+  805b30:	4c 89 e6             	mov    %r12,%rsi
+  805b33:	bf 09 00 00 00       	mov    $0x9,%edi
+  805b38:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  805b3f:	00 00 00 
+  805b42:	ff d0                	call   *%rax
+}
+  805b44:	48 83 c4 10          	add    $0x10,%rsp
+  805b48:	5b                   	pop    %rbx
+  805b49:	41 5c                	pop    %r12
+  805b4b:	41 5d                	pop    %r13
+  805b4d:	41 5e                	pop    %r14
+  805b4f:	5d                   	pop    %rbp
+  805b50:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  805b51:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805b56:	eb ec                	jmp    805b44 <file_map+0x75>
+
+0000000000805b58 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  805b58:	55                   	push   %rbp
+  805b59:	48 89 e5             	mov    %rsp,%rbp
+  805b5c:	41 54                	push   %r12
+  805b5e:	53                   	push   %rbx
+  805b5f:	48 83 ec 20          	sub    $0x20,%rsp
+  805b63:	41 89 f4             	mov    %esi,%r12d
+  805b66:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  805b69:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  805b6d:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  805b74:	00 00 00 
+  805b77:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805b79:	85 c0                	test   %eax,%eax
+  805b7b:	78 3c                	js     805bb9 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  805b7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b81:	48 ba a0 c0 80 00 00 	movabs $0x80c0a0,%rdx
+  805b88:	00 00 00 
+  805b8b:	8b 0a                	mov    (%rdx),%ecx
+  805b8d:	39 08                	cmp    %ecx,(%rax)
+  805b8f:	75 31                	jne    805bc2 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  805b91:	8b 40 0c             	mov    0xc(%rax),%eax
+  805b94:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805b97:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  805b9b:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  805b9f:	ba 10 00 00 00       	mov    $0x10,%edx
+  805ba4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  805ba8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  805bad:	48 b8 5b 55 80 00 00 	movabs $0x80555b,%rax
+  805bb4:	00 00 00 
+  805bb7:	ff d0                	call   *%rax
+}
+  805bb9:	48 83 c4 20          	add    $0x20,%rsp
+  805bbd:	5b                   	pop    %rbx
+  805bbe:	41 5c                	pop    %r12
+  805bc0:	5d                   	pop    %rbp
+  805bc1:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  805bc2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805bc7:	eb f0                	jmp    805bb9 <file_msync+0x61>
+
+0000000000805bc9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805bc9:	55                   	push   %rbp
+  805bca:	48 89 e5             	mov    %rsp,%rbp
+  805bcd:	41 54                	push   %r12
+  805bcf:	53                   	push   %rbx
+  805bd0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805bd3:	48 b8 f6 4d 80 00 00 	movabs $0x804df6,%rax
+  805bda:	00 00 00 
+  805bdd:	ff d0                	call   *%rax
+  805bdf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  805be2:	48 be b8 74 80 00 00 	movabs $0x8074b8,%rsi
+  805be9:	00 00 00 
+  805bec:	48 89 df             	mov    %rbx,%rdi
+  805bef:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  805bf6:	00 00 00 
+  805bf9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  805bfb:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  805c00:	41 2b 04 24          	sub    (%r12),%eax
+  805c04:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  805c0a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  805c11:	00 00 00 
+    stat->st_dev = &devpipe;
+  805c14:	48 b8 e0 c0 80 00 00 	movabs $0x80c0e0,%rax
+  805c1b:	00 00 00 
+  805c1e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  805c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c2a:	5b                   	pop    %rbx
+  805c2b:	41 5c                	pop    %r12
+  805c2d:	5d                   	pop    %rbp
+  805c2e:	c3                   	ret
+
+0000000000805c2f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805c2f:	55                   	push   %rbp
+  805c30:	48 89 e5             	mov    %rsp,%rbp
+  805c33:	41 54                	push   %r12
+  805c35:	53                   	push   %rbx
+  805c36:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  805c39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805c3e:	48 89 fe             	mov    %rdi,%rsi
+  805c41:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c46:	49 bc ca 42 80 00 00 	movabs $0x8042ca,%r12
+  805c4d:	00 00 00 
+  805c50:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  805c53:	48 89 df             	mov    %rbx,%rdi
+  805c56:	48 b8 f6 4d 80 00 00 	movabs $0x804df6,%rax
+  805c5d:	00 00 00 
+  805c60:	ff d0                	call   *%rax
+  805c62:	48 89 c6             	mov    %rax,%rsi
+  805c65:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805c6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c6f:	41 ff d4             	call   *%r12
+}
+  805c72:	5b                   	pop    %rbx
+  805c73:	41 5c                	pop    %r12
+  805c75:	5d                   	pop    %rbp
+  805c76:	c3                   	ret
+
+0000000000805c77 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805c77:	55                   	push   %rbp
+  805c78:	48 89 e5             	mov    %rsp,%rbp
+  805c7b:	41 57                	push   %r15
+  805c7d:	41 56                	push   %r14
+  805c7f:	41 55                	push   %r13
+  805c81:	41 54                	push   %r12
+  805c83:	53                   	push   %rbx
+  805c84:	48 83 ec 18          	sub    $0x18,%rsp
+  805c88:	49 89 fc             	mov    %rdi,%r12
+  805c8b:	49 89 f5             	mov    %rsi,%r13
+  805c8e:	49 89 d7             	mov    %rdx,%r15
+  805c91:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805c95:	48 b8 f6 4d 80 00 00 	movabs $0x804df6,%rax
+  805c9c:	00 00 00 
+  805c9f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  805ca1:	4d 85 ff             	test   %r15,%r15
+  805ca4:	0f 84 af 00 00 00    	je     805d59 <devpipe_write+0xe2>
+  805caa:	48 89 c3             	mov    %rax,%rbx
+  805cad:	4c 89 f8             	mov    %r15,%rax
+  805cb0:	4d 89 ef             	mov    %r13,%r15
+  805cb3:	4c 01 e8             	add    %r13,%rax
+  805cb6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805cba:	49 bd c0 41 80 00 00 	movabs $0x8041c0,%r13
+  805cc1:	00 00 00 
+            sys_yield();
+  805cc4:	49 be 51 41 80 00 00 	movabs $0x804151,%r14
+  805ccb:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  805cce:	8b 73 04             	mov    0x4(%rbx),%esi
+  805cd1:	48 63 ce             	movslq %esi,%rcx
+  805cd4:	48 63 03             	movslq (%rbx),%rax
+  805cd7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  805cdd:	48 39 c1             	cmp    %rax,%rcx
+  805ce0:	72 2e                	jb     805d10 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805ce2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805ce7:	48 89 da             	mov    %rbx,%rdx
+  805cea:	be 00 10 00 00       	mov    $0x1000,%esi
+  805cef:	4c 89 e7             	mov    %r12,%rdi
+  805cf2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  805cf5:	85 c0                	test   %eax,%eax
+  805cf7:	74 66                	je     805d5f <devpipe_write+0xe8>
+            sys_yield();
+  805cf9:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  805cfc:	8b 73 04             	mov    0x4(%rbx),%esi
+  805cff:	48 63 ce             	movslq %esi,%rcx
+  805d02:	48 63 03             	movslq (%rbx),%rax
+  805d05:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  805d0b:	48 39 c1             	cmp    %rax,%rcx
+  805d0e:	73 d2                	jae    805ce2 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805d10:	41 0f b6 3f          	movzbl (%r15),%edi
+  805d14:	48 89 ca             	mov    %rcx,%rdx
+  805d17:	48 c1 ea 03          	shr    $0x3,%rdx
+  805d1b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  805d22:	08 10 20 
+  805d25:	48 f7 e2             	mul    %rdx
+  805d28:	48 c1 ea 06          	shr    $0x6,%rdx
+  805d2c:	48 89 d0             	mov    %rdx,%rax
+  805d2f:	48 c1 e0 09          	shl    $0x9,%rax
+  805d33:	48 29 d0             	sub    %rdx,%rax
+  805d36:	48 c1 e0 03          	shl    $0x3,%rax
+  805d3a:	48 29 c1             	sub    %rax,%rcx
+  805d3d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  805d42:	83 c6 01             	add    $0x1,%esi
+  805d45:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  805d48:	49 83 c7 01          	add    $0x1,%r15
+  805d4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d50:	49 39 c7             	cmp    %rax,%r15
+  805d53:	0f 85 75 ff ff ff    	jne    805cce <devpipe_write+0x57>
+    return n;
+  805d59:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d5d:	eb 05                	jmp    805d64 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  805d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d64:	48 83 c4 18          	add    $0x18,%rsp
+  805d68:	5b                   	pop    %rbx
+  805d69:	41 5c                	pop    %r12
+  805d6b:	41 5d                	pop    %r13
+  805d6d:	41 5e                	pop    %r14
+  805d6f:	41 5f                	pop    %r15
+  805d71:	5d                   	pop    %rbp
+  805d72:	c3                   	ret
+
+0000000000805d73 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  805d73:	55                   	push   %rbp
+  805d74:	48 89 e5             	mov    %rsp,%rbp
+  805d77:	41 57                	push   %r15
+  805d79:	41 56                	push   %r14
+  805d7b:	41 55                	push   %r13
+  805d7d:	41 54                	push   %r12
+  805d7f:	53                   	push   %rbx
+  805d80:	48 83 ec 18          	sub    $0x18,%rsp
+  805d84:	49 89 fc             	mov    %rdi,%r12
+  805d87:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805d8b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805d8f:	48 b8 f6 4d 80 00 00 	movabs $0x804df6,%rax
+  805d96:	00 00 00 
+  805d99:	ff d0                	call   *%rax
+  805d9b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  805d9e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805da4:	49 bd c0 41 80 00 00 	movabs $0x8041c0,%r13
+  805dab:	00 00 00 
+            sys_yield();
+  805dae:	49 be 51 41 80 00 00 	movabs $0x804151,%r14
+  805db5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  805db8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805dbd:	74 7d                	je     805e3c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  805dbf:	8b 03                	mov    (%rbx),%eax
+  805dc1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  805dc4:	75 26                	jne    805dec <devpipe_read+0x79>
+            if (i > 0) return i;
+  805dc6:	4d 85 ff             	test   %r15,%r15
+  805dc9:	75 77                	jne    805e42 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805dcb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805dd0:	48 89 da             	mov    %rbx,%rdx
+  805dd3:	be 00 10 00 00       	mov    $0x1000,%esi
+  805dd8:	4c 89 e7             	mov    %r12,%rdi
+  805ddb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  805dde:	85 c0                	test   %eax,%eax
+  805de0:	74 72                	je     805e54 <devpipe_read+0xe1>
+            sys_yield();
+  805de2:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  805de5:	8b 03                	mov    (%rbx),%eax
+  805de7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  805dea:	74 df                	je     805dcb <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805dec:	48 63 c8             	movslq %eax,%rcx
+  805def:	48 89 ca             	mov    %rcx,%rdx
+  805df2:	48 c1 ea 03          	shr    $0x3,%rdx
+  805df6:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  805dfd:	08 10 20 
+  805e00:	48 89 d0             	mov    %rdx,%rax
+  805e03:	48 f7 e6             	mul    %rsi
+  805e06:	48 c1 ea 06          	shr    $0x6,%rdx
+  805e0a:	48 89 d0             	mov    %rdx,%rax
+  805e0d:	48 c1 e0 09          	shl    $0x9,%rax
+  805e11:	48 29 d0             	sub    %rdx,%rax
+  805e14:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805e1b:	00 
+  805e1c:	48 89 c8             	mov    %rcx,%rax
+  805e1f:	48 29 d0             	sub    %rdx,%rax
+  805e22:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  805e27:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  805e2b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  805e2f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  805e32:	49 83 c7 01          	add    $0x1,%r15
+  805e36:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  805e3a:	75 83                	jne    805dbf <devpipe_read+0x4c>
+    return n;
+  805e3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e40:	eb 03                	jmp    805e45 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  805e42:	4c 89 f8             	mov    %r15,%rax
+}
+  805e45:	48 83 c4 18          	add    $0x18,%rsp
+  805e49:	5b                   	pop    %rbx
+  805e4a:	41 5c                	pop    %r12
+  805e4c:	41 5d                	pop    %r13
+  805e4e:	41 5e                	pop    %r14
+  805e50:	41 5f                	pop    %r15
+  805e52:	5d                   	pop    %rbp
+  805e53:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  805e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e59:	eb ea                	jmp    805e45 <devpipe_read+0xd2>
+
+0000000000805e5b <pipe>:
+pipe(int pfd[2]) {
+  805e5b:	55                   	push   %rbp
+  805e5c:	48 89 e5             	mov    %rsp,%rbp
+  805e5f:	41 55                	push   %r13
+  805e61:	41 54                	push   %r12
+  805e63:	53                   	push   %rbx
+  805e64:	48 83 ec 18          	sub    $0x18,%rsp
+  805e68:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805e6b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  805e6f:	48 b8 12 4e 80 00 00 	movabs $0x804e12,%rax
+  805e76:	00 00 00 
+  805e79:	ff d0                	call   *%rax
+  805e7b:	89 c3                	mov    %eax,%ebx
+  805e7d:	85 c0                	test   %eax,%eax
+  805e7f:	0f 88 a0 01 00 00    	js     806025 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  805e85:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805e8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805e8f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  805e93:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e98:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  805e9f:	00 00 00 
+  805ea2:	ff d0                	call   *%rax
+  805ea4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805ea6:	85 c0                	test   %eax,%eax
+  805ea8:	0f 88 77 01 00 00    	js     806025 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  805eae:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  805eb2:	48 b8 12 4e 80 00 00 	movabs $0x804e12,%rax
+  805eb9:	00 00 00 
+  805ebc:	ff d0                	call   *%rax
+  805ebe:	89 c3                	mov    %eax,%ebx
+  805ec0:	85 c0                	test   %eax,%eax
+  805ec2:	0f 88 43 01 00 00    	js     80600b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  805ec8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805ecd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805ed2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805ed6:	bf 00 00 00 00       	mov    $0x0,%edi
+  805edb:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  805ee2:	00 00 00 
+  805ee5:	ff d0                	call   *%rax
+  805ee7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  805ee9:	85 c0                	test   %eax,%eax
+  805eeb:	0f 88 1a 01 00 00    	js     80600b <pipe+0x1b0>
+    va = fd2data(fd0);
+  805ef1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805ef5:	48 b8 f6 4d 80 00 00 	movabs $0x804df6,%rax
+  805efc:	00 00 00 
+  805eff:	ff d0                	call   *%rax
+  805f01:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  805f04:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805f09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805f0e:	48 89 c6             	mov    %rax,%rsi
+  805f11:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f16:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  805f1d:	00 00 00 
+  805f20:	ff d0                	call   *%rax
+  805f22:	89 c3                	mov    %eax,%ebx
+  805f24:	85 c0                	test   %eax,%eax
+  805f26:	0f 88 c5 00 00 00    	js     805ff1 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  805f2c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  805f30:	48 b8 f6 4d 80 00 00 	movabs $0x804df6,%rax
+  805f37:	00 00 00 
+  805f3a:	ff d0                	call   *%rax
+  805f3c:	48 89 c1             	mov    %rax,%rcx
+  805f3f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  805f45:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f50:	4c 89 ee             	mov    %r13,%rsi
+  805f53:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f58:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  805f5f:	00 00 00 
+  805f62:	ff d0                	call   *%rax
+  805f64:	89 c3                	mov    %eax,%ebx
+  805f66:	85 c0                	test   %eax,%eax
+  805f68:	78 6e                	js     805fd8 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  805f6a:	be 00 10 00 00       	mov    $0x1000,%esi
+  805f6f:	4c 89 ef             	mov    %r13,%rdi
+  805f72:	48 b8 88 41 80 00 00 	movabs $0x804188,%rax
+  805f79:	00 00 00 
+  805f7c:	ff d0                	call   *%rax
+  805f7e:	83 f8 02             	cmp    $0x2,%eax
+  805f81:	0f 85 ab 00 00 00    	jne    806032 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  805f87:	a1 e0 c0 80 00 00 00 	movabs 0x80c0e0,%eax
+  805f8e:	00 00 
+  805f90:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805f94:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  805f96:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805f9a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  805fa1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805fa5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  805fa7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fab:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  805fb2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805fb6:	48 bb e4 4d 80 00 00 	movabs $0x804de4,%rbx
+  805fbd:	00 00 00 
+  805fc0:	ff d3                	call   *%rbx
+  805fc2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  805fc6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  805fca:	ff d3                	call   *%rbx
+  805fcc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  805fd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805fd6:	eb 4d                	jmp    806025 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  805fd8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805fdd:	4c 89 ee             	mov    %r13,%rsi
+  805fe0:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fe5:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  805fec:	00 00 00 
+  805fef:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  805ff1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805ff6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fff:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  806006:	00 00 00 
+  806009:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80600b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  806010:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  806014:	bf 00 00 00 00       	mov    $0x0,%edi
+  806019:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  806020:	00 00 00 
+  806023:	ff d0                	call   *%rax
+}
+  806025:	89 d8                	mov    %ebx,%eax
+  806027:	48 83 c4 18          	add    $0x18,%rsp
+  80602b:	5b                   	pop    %rbx
+  80602c:	41 5c                	pop    %r12
+  80602e:	41 5d                	pop    %r13
+  806030:	5d                   	pop    %rbp
+  806031:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  806032:	48 b9 d0 74 80 00 00 	movabs $0x8074d0,%rcx
+  806039:	00 00 00 
+  80603c:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  806043:	00 00 00 
+  806046:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80604b:	48 bf bf 74 80 00 00 	movabs $0x8074bf,%rdi
+  806052:	00 00 00 
+  806055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80605a:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  806061:	00 00 00 
+  806064:	41 ff d0             	call   *%r8
+
+0000000000806067 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  806067:	55                   	push   %rbp
+  806068:	48 89 e5             	mov    %rsp,%rbp
+  80606b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80606f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  806073:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  80607a:	00 00 00 
+  80607d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80607f:	85 c0                	test   %eax,%eax
+  806081:	78 35                	js     8060b8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  806083:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  806087:	48 b8 f6 4d 80 00 00 	movabs $0x804df6,%rax
+  80608e:	00 00 00 
+  806091:	ff d0                	call   *%rax
+  806093:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  806096:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80609b:	be 00 10 00 00       	mov    $0x1000,%esi
+  8060a0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8060a4:	48 b8 c0 41 80 00 00 	movabs $0x8041c0,%rax
+  8060ab:	00 00 00 
+  8060ae:	ff d0                	call   *%rax
+  8060b0:	85 c0                	test   %eax,%eax
+  8060b2:	0f 94 c0             	sete   %al
+  8060b5:	0f b6 c0             	movzbl %al,%eax
+}
+  8060b8:	c9                   	leave
+  8060b9:	c3                   	ret
+
+00000000008060ba <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8060ba:	48 89 f8             	mov    %rdi,%rax
+  8060bd:	48 c1 e8 27          	shr    $0x27,%rax
+  8060c1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8060c8:	01 00 00 
+  8060cb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8060cf:	f6 c2 01             	test   $0x1,%dl
+  8060d2:	74 6d                	je     806141 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8060d4:	48 89 f8             	mov    %rdi,%rax
+  8060d7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8060db:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8060e2:	01 00 00 
+  8060e5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8060e9:	f6 c2 01             	test   $0x1,%dl
+  8060ec:	74 62                	je     806150 <get_uvpt_entry+0x96>
+  8060ee:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8060f5:	01 00 00 
+  8060f8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8060fc:	f6 c2 80             	test   $0x80,%dl
+  8060ff:	75 4f                	jne    806150 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  806101:	48 89 f8             	mov    %rdi,%rax
+  806104:	48 c1 e8 15          	shr    $0x15,%rax
+  806108:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80610f:	01 00 00 
+  806112:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  806116:	f6 c2 01             	test   $0x1,%dl
+  806119:	74 44                	je     80615f <get_uvpt_entry+0xa5>
+  80611b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  806122:	01 00 00 
+  806125:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  806129:	f6 c2 80             	test   $0x80,%dl
+  80612c:	75 31                	jne    80615f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80612e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  806132:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806139:	01 00 00 
+  80613c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  806140:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  806141:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  806148:	01 00 00 
+  80614b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80614f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  806150:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  806157:	01 00 00 
+  80615a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80615e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80615f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  806166:	01 00 00 
+  806169:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80616d:	c3                   	ret
+
+000000000080616e <get_prot>:
+
+int
+get_prot(void *va) {
+  80616e:	55                   	push   %rbp
+  80616f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  806172:	48 b8 ba 60 80 00 00 	movabs $0x8060ba,%rax
+  806179:	00 00 00 
+  80617c:	ff d0                	call   *%rax
+  80617e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  806181:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  806186:	89 c1                	mov    %eax,%ecx
+  806188:	83 c9 04             	or     $0x4,%ecx
+  80618b:	f6 c2 01             	test   $0x1,%dl
+  80618e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  806191:	89 c1                	mov    %eax,%ecx
+  806193:	83 c9 02             	or     $0x2,%ecx
+  806196:	f6 c2 02             	test   $0x2,%dl
+  806199:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80619c:	89 c1                	mov    %eax,%ecx
+  80619e:	83 c9 01             	or     $0x1,%ecx
+  8061a1:	48 85 d2             	test   %rdx,%rdx
+  8061a4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8061a7:	89 c1                	mov    %eax,%ecx
+  8061a9:	83 c9 40             	or     $0x40,%ecx
+  8061ac:	f6 c6 04             	test   $0x4,%dh
+  8061af:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8061b2:	5d                   	pop    %rbp
+  8061b3:	c3                   	ret
+
+00000000008061b4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8061b4:	55                   	push   %rbp
+  8061b5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8061b8:	48 b8 ba 60 80 00 00 	movabs $0x8060ba,%rax
+  8061bf:	00 00 00 
+  8061c2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8061c4:	48 c1 e8 06          	shr    $0x6,%rax
+  8061c8:	83 e0 01             	and    $0x1,%eax
+}
+  8061cb:	5d                   	pop    %rbp
+  8061cc:	c3                   	ret
+
+00000000008061cd <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8061cd:	55                   	push   %rbp
+  8061ce:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8061d1:	48 b8 ba 60 80 00 00 	movabs $0x8060ba,%rax
+  8061d8:	00 00 00 
+  8061db:	ff d0                	call   *%rax
+  8061dd:	83 e0 01             	and    $0x1,%eax
+}
+  8061e0:	5d                   	pop    %rbp
+  8061e1:	c3                   	ret
+
+00000000008061e2 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8061e2:	55                   	push   %rbp
+  8061e3:	48 89 e5             	mov    %rsp,%rbp
+  8061e6:	41 57                	push   %r15
+  8061e8:	41 56                	push   %r14
+  8061ea:	41 55                	push   %r13
+  8061ec:	41 54                	push   %r12
+  8061ee:	53                   	push   %rbx
+  8061ef:	48 83 ec 28          	sub    $0x28,%rsp
+  8061f3:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8061f7:	48 85 ff             	test   %rdi,%rdi
+  8061fa:	74 1e                	je     80621a <foreach_shared_region+0x38>
+  8061fc:	49 89 ff             	mov    %rdi,%r15
+  8061ff:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  806205:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80620b:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  806212:	01 00 00 
+  806215:	e9 72 02 00 00       	jmp    80648c <foreach_shared_region+0x2aa>
+    assert(fun);
+  80621a:	48 b9 f4 74 80 00 00 	movabs $0x8074f4,%rcx
+  806221:	00 00 00 
+  806224:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  80622b:	00 00 00 
+  80622e:	be 2d 00 00 00       	mov    $0x2d,%esi
+  806233:	48 bf f8 74 80 00 00 	movabs $0x8074f8,%rdi
+  80623a:	00 00 00 
+  80623d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806242:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  806249:	00 00 00 
+  80624c:	41 ff d0             	call   *%r8
+  80624f:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  806256:	eb 6c                	jmp    8062c4 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  806258:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80625f:	ff ff ff 
+  806262:	4c 21 e2             	and    %r12,%rdx
+  806265:	48 89 d8             	mov    %rbx,%rax
+  806268:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80626d:	48 83 c0 01          	add    $0x1,%rax
+  806271:	48 c1 e0 1e          	shl    $0x1e,%rax
+  806275:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80627c:	00 00 00 
+  80627f:	48 21 c8             	and    %rcx,%rax
+  806282:	48 09 d0             	or     %rdx,%rax
+  806285:	49 89 c4             	mov    %rax,%r12
+  806288:	eb 30                	jmp    8062ba <foreach_shared_region+0xd8>
+  80628a:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  806291:	ff ff ff 
+  806294:	4c 21 e2             	and    %r12,%rdx
+  806297:	48 89 d8             	mov    %rbx,%rax
+  80629a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80629f:	48 83 c0 01          	add    $0x1,%rax
+  8062a3:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8062a7:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8062ae:	00 00 00 
+  8062b1:	48 21 c8             	and    %rcx,%rax
+  8062b4:	48 09 d0             	or     %rdx,%rax
+  8062b7:	49 89 c4             	mov    %rax,%r12
+  8062ba:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8062be:	0f 84 99 01 00 00    	je     80645d <foreach_shared_region+0x27b>
+  8062c4:	4c 89 e3             	mov    %r12,%rbx
+  8062c7:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8062cb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8062d2:	01 00 00 
+  8062d5:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8062d9:	a8 01                	test   $0x1,%al
+  8062db:	0f 84 77 ff ff ff    	je     806258 <foreach_shared_region+0x76>
+  8062e1:	a8 80                	test   $0x80,%al
+  8062e3:	74 19                	je     8062fe <foreach_shared_region+0x11c>
+  8062e5:	f6 c4 04             	test   $0x4,%ah
+  8062e8:	74 a0                	je     80628a <foreach_shared_region+0xa8>
+  8062ea:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8062f1:	40 
+  8062f2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8062f6:	4c 89 e7             	mov    %r12,%rdi
+  8062f9:	41 ff d7             	call   *%r15
+  8062fc:	eb 8c                	jmp    80628a <foreach_shared_region+0xa8>
+  8062fe:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  806305:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  806309:	eb 46                	jmp    806351 <foreach_shared_region+0x16f>
+  80630b:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  806312:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  806318:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80631c:	48 c1 e0 15          	shl    $0x15,%rax
+  806320:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  806325:	49 09 c4             	or     %rax,%r12
+  806328:	eb 1d                	jmp    806347 <foreach_shared_region+0x165>
+  80632a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  806331:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  806337:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80633b:	48 c1 e0 15          	shl    $0x15,%rax
+  80633f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  806344:	49 09 c4             	or     %rax,%r12
+  806347:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80634b:	0f 84 d3 00 00 00    	je     806424 <foreach_shared_region+0x242>
+  806351:	4c 89 e3             	mov    %r12,%rbx
+  806354:	48 c1 eb 15          	shr    $0x15,%rbx
+  806358:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80635f:	01 00 00 
+  806362:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  806366:	a8 01                	test   $0x1,%al
+  806368:	74 a1                	je     80630b <foreach_shared_region+0x129>
+  80636a:	a8 80                	test   $0x80,%al
+  80636c:	74 19                	je     806387 <foreach_shared_region+0x1a5>
+  80636e:	f6 c4 04             	test   $0x4,%ah
+  806371:	74 b7                	je     80632a <foreach_shared_region+0x148>
+  806373:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80637a:	00 
+  80637b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80637f:	4c 89 e7             	mov    %r12,%rdi
+  806382:	41 ff d7             	call   *%r15
+  806385:	eb a3                	jmp    80632a <foreach_shared_region+0x148>
+  806387:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80638d:	eb 3b                	jmp    8063ca <foreach_shared_region+0x1e8>
+  80638f:	f6 c4 04             	test   $0x4,%ah
+  806392:	74 12                	je     8063a6 <foreach_shared_region+0x1c4>
+  806394:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80639b:	00 
+  80639c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8063a0:	4c 89 e7             	mov    %r12,%rdi
+  8063a3:	41 ff d7             	call   *%r15
+  8063a6:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8063ad:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8063b3:	48 83 c3 01          	add    $0x1,%rbx
+  8063b7:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8063bb:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8063c1:	49 09 dc             	or     %rbx,%r12
+  8063c4:	41 83 ed 01          	sub    $0x1,%r13d
+  8063c8:	74 2f                	je     8063f9 <foreach_shared_region+0x217>
+  8063ca:	4c 89 e3             	mov    %r12,%rbx
+  8063cd:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8063d1:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8063d5:	a8 01                	test   $0x1,%al
+  8063d7:	75 b6                	jne    80638f <foreach_shared_region+0x1ad>
+  8063d9:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8063e0:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8063e6:	48 83 c3 01          	add    $0x1,%rbx
+  8063ea:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8063ee:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8063f4:	49 09 dc             	or     %rbx,%r12
+  8063f7:	eb cb                	jmp    8063c4 <foreach_shared_region+0x1e2>
+  8063f9:	4c 89 e0             	mov    %r12,%rax
+  8063fc:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  806402:	49 c1 ec 15          	shr    $0x15,%r12
+  806406:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80640d:	49 83 c4 01          	add    $0x1,%r12
+  806411:	49 c1 e4 15          	shl    $0x15,%r12
+  806415:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80641c:	49 09 c4             	or     %rax,%r12
+  80641f:	e9 23 ff ff ff       	jmp    806347 <foreach_shared_region+0x165>
+  806424:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  806428:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80642f:	ff ff ff 
+  806432:	4c 21 e0             	and    %r12,%rax
+  806435:	49 c1 ec 1e          	shr    $0x1e,%r12
+  806439:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  806440:	49 83 c4 01          	add    $0x1,%r12
+  806444:	49 c1 e4 1e          	shl    $0x1e,%r12
+  806448:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  80644f:	00 00 00 
+  806452:	49 21 d4             	and    %rdx,%r12
+  806455:	49 09 c4             	or     %rax,%r12
+  806458:	e9 5d fe ff ff       	jmp    8062ba <foreach_shared_region+0xd8>
+  80645d:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  806464:	00 ff ff 
+  806467:	4c 21 e0             	and    %r12,%rax
+  80646a:	49 c1 ec 27          	shr    $0x27,%r12
+  80646e:	49 83 c4 01          	add    $0x1,%r12
+  806472:	49 c1 e4 27          	shl    $0x27,%r12
+  806476:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80647d:	ff 00 00 
+  806480:	49 21 d4             	and    %rdx,%r12
+  806483:	49 09 c4             	or     %rax,%r12
+  806486:	41 83 ed 01          	sub    $0x1,%r13d
+  80648a:	74 48                	je     8064d4 <foreach_shared_region+0x2f2>
+  80648c:	4c 89 e0             	mov    %r12,%rax
+  80648f:	48 c1 e8 27          	shr    $0x27,%rax
+  806493:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80649a:	01 00 00 
+  80649d:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8064a1:	f6 c2 01             	test   $0x1,%dl
+  8064a4:	0f 85 a5 fd ff ff    	jne    80624f <foreach_shared_region+0x6d>
+  8064aa:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8064b1:	00 ff ff 
+  8064b4:	4c 21 e2             	and    %r12,%rdx
+  8064b7:	48 83 c0 01          	add    $0x1,%rax
+  8064bb:	48 c1 e0 27          	shl    $0x27,%rax
+  8064bf:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8064c6:	ff 00 00 
+  8064c9:	48 21 c8             	and    %rcx,%rax
+  8064cc:	48 09 d0             	or     %rdx,%rax
+  8064cf:	49 89 c4             	mov    %rax,%r12
+  8064d2:	eb b2                	jmp    806486 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8064d4:	4d 85 e4             	test   %r12,%r12
+  8064d7:	75 14                	jne    8064ed <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8064d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064de:	48 83 c4 28          	add    $0x28,%rsp
+  8064e2:	5b                   	pop    %rbx
+  8064e3:	41 5c                	pop    %r12
+  8064e5:	41 5d                	pop    %r13
+  8064e7:	41 5e                	pop    %r14
+  8064e9:	41 5f                	pop    %r15
+  8064eb:	5d                   	pop    %rbp
+  8064ec:	c3                   	ret
+    assert(addr == 0);
+  8064ed:	48 b9 03 75 80 00 00 	movabs $0x807503,%rcx
+  8064f4:	00 00 00 
+  8064f7:	48 ba 1d 68 80 00 00 	movabs $0x80681d,%rdx
+  8064fe:	00 00 00 
+  806501:	be 67 00 00 00       	mov    $0x67,%esi
+  806506:	48 bf f8 74 80 00 00 	movabs $0x8074f8,%rdi
+  80650d:	00 00 00 
+  806510:	b8 00 00 00 00       	mov    $0x0,%eax
+  806515:	49 b8 06 30 80 00 00 	movabs $0x803006,%r8
+  80651c:	00 00 00 
+  80651f:	41 ff d0             	call   *%r8
+
+0000000000806522 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  806522:	b8 00 00 00 00       	mov    $0x0,%eax
+  806527:	c3                   	ret
+
+0000000000806528 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  806528:	55                   	push   %rbp
+  806529:	48 89 e5             	mov    %rsp,%rbp
+  80652c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80652f:	48 be 0d 75 80 00 00 	movabs $0x80750d,%rsi
+  806536:	00 00 00 
+  806539:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  806540:	00 00 00 
+  806543:	ff d0                	call   *%rax
+    return 0;
+}
+  806545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80654a:	5d                   	pop    %rbp
+  80654b:	c3                   	ret
+
+000000000080654c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80654c:	55                   	push   %rbp
+  80654d:	48 89 e5             	mov    %rsp,%rbp
+  806550:	41 57                	push   %r15
+  806552:	41 56                	push   %r14
+  806554:	41 55                	push   %r13
+  806556:	41 54                	push   %r12
+  806558:	53                   	push   %rbx
+  806559:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  806560:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  806567:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80656e:	00 00 00 00 
+  806572:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  806579:	00 00 00 00 
+  80657d:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  806584:	00 00 00 00 
+  806588:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80658f:	00 00 00 00 
+  806593:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  80659a:	00 00 00 00 
+  80659e:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8065a5:	00 00 00 00 
+  8065a9:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8065b0:	00 
+  8065b1:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8065b8:	00 
+  8065b9:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8065c0:	00 
+  8065c1:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8065c8:	00 
+  8065c9:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8065d0:	00 
+  8065d1:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8065d8:	00 
+  8065d9:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8065e0:	00 
+  8065e1:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8065e8:	00 
+  8065e9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8065f0:	00 
+  8065f1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8065f8:	00 
+    for (res = 0; res < n; res += inc) {
+  8065f9:	48 85 d2             	test   %rdx,%rdx
+  8065fc:	74 7a                	je     806678 <devcons_write+0x12c>
+  8065fe:	49 89 d6             	mov    %rdx,%r14
+  806601:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  806607:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80660c:	49 bf dd 3d 80 00 00 	movabs $0x803ddd,%r15
+  806613:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  806616:	4c 89 f3             	mov    %r14,%rbx
+  806619:	48 29 f3             	sub    %rsi,%rbx
+  80661c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  806621:	48 39 c3             	cmp    %rax,%rbx
+  806624:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  806628:	4c 63 eb             	movslq %ebx,%r13
+  80662b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806632:	48 01 c6             	add    %rax,%rsi
+  806635:	4c 89 ea             	mov    %r13,%rdx
+  806638:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80663f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  806642:	4c 89 ee             	mov    %r13,%rsi
+  806645:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80664c:	48 b8 0a 40 80 00 00 	movabs $0x80400a,%rax
+  806653:	00 00 00 
+  806656:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  806658:	41 01 dc             	add    %ebx,%r12d
+  80665b:	49 63 f4             	movslq %r12d,%rsi
+  80665e:	4c 39 f6             	cmp    %r14,%rsi
+  806661:	72 b3                	jb     806616 <devcons_write+0xca>
+    return res;
+  806663:	49 63 c4             	movslq %r12d,%rax
+}
+  806666:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80666d:	5b                   	pop    %rbx
+  80666e:	41 5c                	pop    %r12
+  806670:	41 5d                	pop    %r13
+  806672:	41 5e                	pop    %r14
+  806674:	41 5f                	pop    %r15
+  806676:	5d                   	pop    %rbp
+  806677:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  806678:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80667e:	eb e3                	jmp    806663 <devcons_write+0x117>
+
+0000000000806680 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  806680:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  806683:	ba 00 00 00 00       	mov    $0x0,%edx
+  806688:	48 85 c0             	test   %rax,%rax
+  80668b:	74 55                	je     8066e2 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80668d:	55                   	push   %rbp
+  80668e:	48 89 e5             	mov    %rsp,%rbp
+  806691:	41 55                	push   %r13
+  806693:	41 54                	push   %r12
+  806695:	53                   	push   %rbx
+  806696:	48 83 ec 08          	sub    $0x8,%rsp
+  80669a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80669d:	48 bb 3d 40 80 00 00 	movabs $0x80403d,%rbx
+  8066a4:	00 00 00 
+  8066a7:	49 bc 51 41 80 00 00 	movabs $0x804151,%r12
+  8066ae:	00 00 00 
+  8066b1:	eb 03                	jmp    8066b6 <devcons_read+0x36>
+  8066b3:	41 ff d4             	call   *%r12
+  8066b6:	ff d3                	call   *%rbx
+  8066b8:	85 c0                	test   %eax,%eax
+  8066ba:	74 f7                	je     8066b3 <devcons_read+0x33>
+    if (c < 0) return c;
+  8066bc:	48 63 d0             	movslq %eax,%rdx
+  8066bf:	78 13                	js     8066d4 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8066c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8066c6:	83 f8 04             	cmp    $0x4,%eax
+  8066c9:	74 09                	je     8066d4 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8066cb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8066cf:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8066d4:	48 89 d0             	mov    %rdx,%rax
+  8066d7:	48 83 c4 08          	add    $0x8,%rsp
+  8066db:	5b                   	pop    %rbx
+  8066dc:	41 5c                	pop    %r12
+  8066de:	41 5d                	pop    %r13
+  8066e0:	5d                   	pop    %rbp
+  8066e1:	c3                   	ret
+  8066e2:	48 89 d0             	mov    %rdx,%rax
+  8066e5:	c3                   	ret
+
+00000000008066e6 <cputchar>:
+cputchar(int ch) {
+  8066e6:	55                   	push   %rbp
+  8066e7:	48 89 e5             	mov    %rsp,%rbp
+  8066ea:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8066ee:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8066f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8066f7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8066fb:	48 b8 0a 40 80 00 00 	movabs $0x80400a,%rax
+  806702:	00 00 00 
+  806705:	ff d0                	call   *%rax
+}
+  806707:	c9                   	leave
+  806708:	c3                   	ret
+
+0000000000806709 <getchar>:
+getchar(void) {
+  806709:	55                   	push   %rbp
+  80670a:	48 89 e5             	mov    %rsp,%rbp
+  80670d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  806711:	ba 01 00 00 00       	mov    $0x1,%edx
+  806716:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80671a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80671f:	48 b8 55 51 80 00 00 	movabs $0x805155,%rax
+  806726:	00 00 00 
+  806729:	ff d0                	call   *%rax
+  80672b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80672d:	85 c0                	test   %eax,%eax
+  80672f:	78 06                	js     806737 <getchar+0x2e>
+  806731:	74 08                	je     80673b <getchar+0x32>
+  806733:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  806737:	89 d0                	mov    %edx,%eax
+  806739:	c9                   	leave
+  80673a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80673b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  806740:	eb f5                	jmp    806737 <getchar+0x2e>
+
+0000000000806742 <iscons>:
+iscons(int fdnum) {
+  806742:	55                   	push   %rbp
+  806743:	48 89 e5             	mov    %rsp,%rbp
+  806746:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80674a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80674e:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  806755:	00 00 00 
+  806758:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80675a:	85 c0                	test   %eax,%eax
+  80675c:	78 18                	js     806776 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80675e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806762:	48 b8 20 c1 80 00 00 	movabs $0x80c120,%rax
+  806769:	00 00 00 
+  80676c:	8b 00                	mov    (%rax),%eax
+  80676e:	39 02                	cmp    %eax,(%rdx)
+  806770:	0f 94 c0             	sete   %al
+  806773:	0f b6 c0             	movzbl %al,%eax
+}
+  806776:	c9                   	leave
+  806777:	c3                   	ret
+
+0000000000806778 <opencons>:
+opencons(void) {
+  806778:	55                   	push   %rbp
+  806779:	48 89 e5             	mov    %rsp,%rbp
+  80677c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  806780:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  806784:	48 b8 12 4e 80 00 00 	movabs $0x804e12,%rax
+  80678b:	00 00 00 
+  80678e:	ff d0                	call   *%rax
+  806790:	85 c0                	test   %eax,%eax
+  806792:	78 49                	js     8067dd <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  806794:	b9 46 00 00 00       	mov    $0x46,%ecx
+  806799:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80679e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8067a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8067a7:	48 b8 f2 41 80 00 00 	movabs $0x8041f2,%rax
+  8067ae:	00 00 00 
+  8067b1:	ff d0                	call   *%rax
+  8067b3:	85 c0                	test   %eax,%eax
+  8067b5:	78 26                	js     8067dd <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8067b7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8067bb:	a1 20 c1 80 00 00 00 	movabs 0x80c120,%eax
+  8067c2:	00 00 
+  8067c4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8067c6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8067ca:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8067d1:	48 b8 e4 4d 80 00 00 	movabs $0x804de4,%rax
+  8067d8:	00 00 00 
+  8067db:	ff d0                	call   *%rax
+}
+  8067dd:	c9                   	leave
+  8067de:	c3                   	ret
+  8067df:	90                   	nop
+
+00000000008067e0 <__rodata_start>:
+  8067e0:	44                   	rex.R
+  8067e1:	65 76 69             	gs jbe 80684d <__rodata_start+0x6d>
+  8067e4:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8067e7:	31 20                	xor    %esp,(%rax)
+  8067e9:	70 72                	jo     80685d <__rodata_start+0x7d>
+  8067eb:	65 73 65             	gs jae 806853 <__rodata_start+0x73>
+  8067ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8067ef:	63 65 3a             	movsxd 0x3a(%rbp),%esp
+  8067f2:	20 25 64 0a 00 62    	and    %ah,0x62000a64(%rip)        # 6280725c <__bss_end+0x61fde25c>
+  8067f8:	61                   	(bad)
+  8067f9:	64 20 64 69 73       	and    %ah,%fs:0x73(%rcx,%rbp,2)
+  8067fe:	6b 20 6e             	imul   $0x6e,(%rax),%esp
+  806801:	75 6d                	jne    806870 <__rodata_start+0x90>
+  806803:	62 65                	(bad)
+  806805:	72 00                	jb     806807 <__rodata_start+0x27>
+  806807:	66 73 2f             	data16 jae 806839 <__rodata_start+0x59>
+  80680a:	69 64 65 2e 63 00 6e 	imul   $0x736e0063,0x2e(%rbp,%riz,2),%esp
+  806811:	73 
+  806812:	65 63 73 20          	movsxd %gs:0x20(%rbx),%esi
+  806816:	3c 3d                	cmp    $0x3d,%al
+  806818:	20 32                	and    %dh,(%rdx)
+  80681a:	35 36 00 61 73       	xor    $0x73610036,%eax
+  80681f:	73 65                	jae    806886 <__rodata_start+0xa6>
+  806821:	72 74                	jb     806897 <__rodata_start+0xb7>
+  806823:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  80682a:	6c                   	insb   (%dx),%es:(%rdi)
+  80682b:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  80682f:	25 73 00 66 0f       	and    $0xf660073,%eax
+  806834:	1f                   	(bad)
+  806835:	44 00 00             	add    %r8b,(%rax)
+  806838:	62 61 64 20 62       	(bad)
+  80683d:	6c                   	insb   (%dx),%es:(%rdi)
+  80683e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80683f:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  806842:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806843:	75 6d                	jne    8068b2 <__rodata_start+0xd2>
+  806845:	62 65                	(bad)
+  806847:	72 20                	jb     806869 <__rodata_start+0x89>
+  806849:	25 30 38 78 20       	and    $0x20783830,%eax
+  80684e:	69 6e 20 64 69 73 6b 	imul   $0x6b736964,0x20(%rsi),%ebp
+  806855:	61                   	(bad)
+  806856:	64 64 72 00          	fs fs jb 80685a <__rodata_start+0x7a>
+  80685a:	00 00                	add    %al,(%rax)
+  80685c:	00 00                	add    %al,(%rax)
+  80685e:	00 00                	add    %al,(%rax)
+  806860:	72 65                	jb     8068c7 <__rodata_start+0xe7>
+  806862:	61                   	(bad)
+  806863:	64 69 6e 67 20 6e 6f 	imul   $0x6e6f6e20,%fs:0x67(%rsi),%ebp
+  80686a:	6e 
+  80686b:	2d 65 78 69 73       	sub    $0x73697865,%eax
+  806870:	74 65                	je     8068d7 <__rodata_start+0xf7>
+  806872:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806873:	74 20                	je     806895 <__rodata_start+0xb5>
+  806875:	62                   	(bad)
+  806876:	6c                   	insb   (%dx),%es:(%rdi)
+  806877:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806878:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80687b:	25 30 38 78 20       	and    $0x20783830,%eax
+  806880:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806881:	75 74                	jne    8068f7 <__rodata_start+0x117>
+  806883:	20 6f 66             	and    %ch,0x66(%rdi)
+  806886:	20 25 30 38 78 0a    	and    %ah,0xa783830(%rip)        # af8a0bc <__bss_end+0xa7610bc>
+  80688c:	00 00                	add    %al,(%rax)
+  80688e:	00 00                	add    %al,(%rax)
+  806890:	73 74                	jae    806906 <__rodata_start+0x126>
+  806892:	72 63                	jb     8068f7 <__rodata_start+0x117>
+  806894:	6d                   	insl   (%dx),%es:(%rdi)
+  806895:	70 28                	jo     8068bf <__rodata_start+0xdf>
+  806897:	64 69 73 6b 61 64 64 	imul   $0x72646461,%fs:0x6b(%rbx),%esi
+  80689e:	72 
+  80689f:	28 31                	sub    %dh,(%rcx)
+  8068a1:	29 2c 20             	sub    %ebp,(%rax,%riz,1)
+  8068a4:	22 4f 4f             	and    0x4f(%rdi),%cl
+  8068a7:	50                   	push   %rax
+  8068a8:	53                   	push   %rbx
+  8068a9:	21 5c 6e 22          	and    %ebx,0x22(%rsi,%rbp,2)
+  8068ad:	29 20                	sub    %esp,(%rax)
+  8068af:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  8068b4:	66 73 2f             	data16 jae 8068e6 <__rodata_start+0x106>
+  8068b7:	62 63 2e 63 00       	(bad)
+  8068bc:	72 65                	jb     806923 <__rodata_start+0x143>
+  8068be:	73 20                	jae    8068e0 <__rodata_start+0x100>
+  8068c0:	3e 3d 20 30 00 69    	ds cmp $0x69003020,%eax
+  8068c6:	73 5f                	jae    806927 <__rodata_start+0x147>
+  8068c8:	70 61                	jo     80692b <__rodata_start+0x14b>
+  8068ca:	67 65 5f             	addr32 gs pop %rdi
+  8068cd:	70 72                	jo     806941 <__rodata_start+0x161>
+  8068cf:	65 73 65             	gs jae 806937 <__rodata_start+0x157>
+  8068d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8068d3:	74 28                	je     8068fd <__rodata_start+0x11d>
+  8068d5:	64 69 73 6b 5f 61 64 	imul   $0x6464615f,%fs:0x6b(%rbx),%esi
+  8068dc:	64 
+  8068dd:	72 29                	jb     806908 <__rodata_start+0x128>
+  8068df:	00 21                	add    %ah,(%rcx)
+  8068e1:	69 73 5f 70 61 67 65 	imul   $0x65676170,0x5f(%rbx),%esi
+  8068e8:	5f                   	pop    %rdi
+  8068e9:	64 69 72 74 79 28 64 	imul   $0x69642879,%fs:0x74(%rdx),%esi
+  8068f0:	69 
+  8068f1:	73 6b                	jae    80695e <__rodata_start+0x17e>
+  8068f3:	5f                   	pop    %rdi
+  8068f4:	61                   	(bad)
+  8068f5:	64 64 72 29          	fs fs jb 806922 <__rodata_start+0x142>
+  8068f9:	00 66 6c             	add    %ah,0x6c(%rsi)
+  8068fc:	75 73                	jne    806971 <__rodata_start+0x191>
+  8068fe:	68 5f 62 6c 6f       	push   $0x6f6c625f
+  806903:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  806906:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806907:	66 20 62 61          	data16 and %ah,0x61(%rdx)
+  80690b:	64 20 76 61          	and    %dh,%fs:0x61(%rsi)
+  80690f:	20 25 70 00 4f 4f    	and    %ah,0x4f4f0070(%rip)        # 4fcf6985 <__bss_end+0x4f4cd985>
+  806915:	50                   	push   %rax
+  806916:	53                   	push   %rbx
+  806917:	21 0a                	and    %ecx,(%rdx)
+  806919:	00 21                	add    %ah,(%rcx)
+  80691b:	69 73 5f 70 61 67 65 	imul   $0x65676170,0x5f(%rbx),%esi
+  806922:	5f                   	pop    %rdi
+  806923:	64 69 72 74 79 28 64 	imul   $0x69642879,%fs:0x74(%rdx),%esi
+  80692a:	69 
+  80692b:	73 6b                	jae    806998 <__rodata_start+0x1b8>
+  80692d:	61                   	(bad)
+  80692e:	64 64 72 28          	fs fs jb 80695a <__rodata_start+0x17a>
+  806932:	31 29                	xor    %ebp,(%rcx)
+  806934:	29 00                	sub    %eax,(%rax)
+  806936:	21 69 73             	and    %ebp,0x73(%rcx)
+  806939:	5f                   	pop    %rdi
+  80693a:	70 61                	jo     80699d <__rodata_start+0x1bd>
+  80693c:	67 65 5f             	addr32 gs pop %rdi
+  80693f:	70 72                	jo     8069b3 <__rodata_start+0x1d3>
+  806941:	65 73 65             	gs jae 8069a9 <__rodata_start+0x1c9>
+  806944:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806945:	74 28                	je     80696f <__rodata_start+0x18f>
+  806947:	64 69 73 6b 61 64 64 	imul   $0x72646461,%fs:0x6b(%rbx),%esi
+  80694e:	72 
+  80694f:	28 31                	sub    %dh,(%rcx)
+  806951:	29 29                	sub    %ebp,(%rcx)
+  806953:	00 62 6c             	add    %ah,0x6c(%rdx)
+  806956:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806957:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80695a:	63 61 63             	movsxd 0x63(%rcx),%esp
+  80695d:	68 65 20 69 73       	push   $0x73692065
+  806962:	20 67 6f             	and    %ah,0x6f(%rdi)
+  806965:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806966:	64 0a 00             	or     %fs:(%rax),%al
+  806969:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  806970:	62 61 64 20 66       	(bad)
+  806975:	69 6c 65 20 73 79 73 	imul   $0x74737973,0x20(%rbp,%riz,2),%ebp
+  80697c:	74 
+  80697d:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80697f:	20 6d 61             	and    %ch,0x61(%rbp)
+  806982:	67 69 63 20 6e 75 6d 	imul   $0x626d756e,0x20(%ebx),%esp
+  806989:	62 
+  80698a:	65 72 20             	gs jb  8069ad <__rodata_start+0x1cd>
+  80698d:	25 30 38 78 00       	and    $0x783830,%eax
+  806992:	66 73 2f             	data16 jae 8069c4 <__rodata_start+0x1e4>
+  806995:	66 73 2e             	data16 jae 8069c6 <__rodata_start+0x1e6>
+  806998:	63 00                	movsxd (%rax),%eax
+  80699a:	66 69 6c 65 20 73 79 	imul   $0x7973,0x20(%rbp,%riz,2),%bp
+  8069a1:	73 74                	jae    806a17 <__rodata_start+0x237>
+  8069a3:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8069a5:	20 69 73             	and    %ch,0x73(%rcx)
+  8069a8:	20 74 6f 6f          	and    %dh,0x6f(%rdi,%rbp,2)
+  8069ac:	20 6c 61 72          	and    %ch,0x72(%rcx,%riz,2)
+  8069b0:	67 65 00 73 75       	add    %dh,%gs:0x75(%ebx)
+  8069b5:	70 65                	jo     806a1c <__rodata_start+0x23c>
+  8069b7:	72 62                	jb     806a1b <__rodata_start+0x23b>
+  8069b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8069ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8069bb:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8069be:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  8069c5:	0a 00                	or     (%rax),%al
+  8069c7:	61                   	(bad)
+  8069c8:	74 74                	je     806a3e <__rodata_start+0x25e>
+  8069ca:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8069cc:	70 74                	jo     806a42 <__rodata_start+0x262>
+  8069ce:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  8069d2:	66 72 65             	data16 jb 806a3a <__rodata_start+0x25a>
+  8069d5:	65 20 7a 65          	and    %bh,%gs:0x65(%rdx)
+  8069d9:	72 6f                	jb     806a4a <__rodata_start+0x26a>
+  8069db:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8069de:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8069df:	63 6b 00             	movsxd 0x0(%rbx),%ebp
+  8069e2:	61                   	(bad)
+  8069e3:	6c                   	insb   (%dx),%es:(%rdi)
+  8069e4:	6c                   	insb   (%dx),%es:(%rdi)
+  8069e5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8069e6:	63 5f 62             	movsxd 0x62(%rdi),%ebx
+  8069e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8069ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8069eb:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  8069ee:	20 25 69 00 21 62    	and    %ah,0x62210069(%rip)        # 62a16a5d <__bss_end+0x621eda5d>
+  8069f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8069f5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8069f6:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  8069f9:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  806a00:	28 32                	sub    %dh,(%rdx)
+  806a02:	20 2b                	and    %ch,(%rbx)
+  806a04:	20 69 29             	and    %ch,0x29(%rcx)
+  806a07:	00 21                	add    %ah,(%rcx)
+  806a09:	62                   	(bad)
+  806a0a:	6c                   	insb   (%dx),%es:(%rdi)
+  806a0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806a0c:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  806a0f:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  806a16:	28 31                	sub    %dh,(%rcx)
+  806a18:	29 00                	sub    %eax,(%rax)
+  806a1a:	21 62 6c             	and    %esp,0x6c(%rdx)
+  806a1d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806a1e:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  806a21:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  806a28:	28 30                	sub    %dh,(%rax)
+  806a2a:	29 00                	sub    %eax,(%rax)
+  806a2c:	62                   	(bad)
+  806a2d:	69 74 6d 61 70 20 69 	imul   $0x73692070,0x61(%rbp,%rbp,2),%esi
+  806a34:	73 
+  806a35:	20 67 6f             	and    %ah,0x6f(%rdi)
+  806a38:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806a39:	64 0a 00             	or     %fs:(%rax),%al
+  806a3c:	70 70                	jo     806aae <__rodata_start+0x2ce>
+  806a3e:	64 69 73 6b 62 6e 6f 	imul   $0x6f6e62,%fs:0x6b(%rbx),%esi
+  806a45:	00 
+  806a46:	69 6e 64 69 72 65 63 	imul   $0x63657269,0x64(%rsi),%ebp
+  806a4d:	74 5f                	je     806aae <__rodata_start+0x2ce>
+  806a4f:	62                   	(bad)
+  806a50:	6c                   	insb   (%dx),%es:(%rdi)
+  806a51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806a52:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  806a55:	00 62 6c             	add    %ah,0x6c(%rdx)
+  806a58:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806a59:	63 6b 6e             	movsxd 0x6e(%rbx),%ebp
+  806a5c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806a5d:	00 28                	add    %ch,(%rax)
+  806a5f:	64 69 72 2d 3e 66 5f 	imul   $0x735f663e,%fs:0x2d(%rdx),%esi
+  806a66:	73 
+  806a67:	69 7a 65 20 25 20 42 	imul   $0x42202520,0x65(%rdx),%edi
+  806a6e:	4c                   	rex.WR
+  806a6f:	4b 53                	rex.WXB push %r11
+  806a71:	49 5a                	rex.WB pop %r10
+  806a73:	45 29 20             	sub    %r12d,(%r8)
+  806a76:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  806a7b:	77 61                	ja     806ade <__rodata_start+0x2fe>
+  806a7d:	72 6e                	jb     806aed <__rodata_start+0x30d>
+  806a7f:	69 6e 67 3a 20 66 69 	imul   $0x6966203a,0x67(%rsi),%ebp
+  806a86:	6c                   	insb   (%dx),%es:(%rdi)
+  806a87:	65 5f                	gs pop %rdi
+  806a89:	66 72 65             	data16 jb 806af1 <__rodata_start+0x311>
+  806a8c:	65 5f                	gs pop %rdi
+  806a8e:	62                   	(bad)
+  806a8f:	6c                   	insb   (%dx),%es:(%rdi)
+  806a90:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806a91:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  806a94:	20 25 69 00 66 73    	and    %ah,0x73660069(%rip)        # 73e66b03 <__bss_end+0x7363db03>
+  806a9a:	2f                   	(bad)
+  806a9b:	73 65                	jae    806b02 <__rodata_start+0x322>
+  806a9d:	72 76                	jb     806b15 <__rodata_start+0x335>
+  806a9f:	2e 63 00             	cs movsxd (%rax),%eax
+  806aa2:	66 64 00 73 69       	data16 add %dh,%fs:0x69(%rbx)
+  806aa7:	7a 65                	jp     806b0e <__rodata_start+0x32e>
+  806aa9:	5f                   	pop    %rdi
+  806aaa:	72 65                	jb     806b11 <__rodata_start+0x331>
+  806aac:	61                   	(bad)
+  806aad:	64 20 3c 20          	and    %bh,%fs:(%rax,%riz,1)
+  806ab1:	49                   	rex.WB
+  806ab2:	4e 54                	rex.WRX push %rsp
+  806ab4:	33 32                	xor    (%rdx),%esi
+  806ab6:	5f                   	pop    %rdi
+  806ab7:	4d                   	rex.WRB
+  806ab8:	41 58                	pop    %r8
+  806aba:	00 73 69             	add    %dh,0x69(%rbx)
+  806abd:	7a 65                	jp     806b24 <__rodata_start+0x344>
+  806abf:	5f                   	pop    %rdi
+  806ac0:	72 65                	jb     806b27 <__rodata_start+0x347>
+  806ac2:	61                   	(bad)
+  806ac3:	64 20 3e             	and    %bh,%fs:(%rsi)
+  806ac6:	20 49 4e             	and    %cl,0x4e(%rcx)
+  806ac9:	54                   	push   %rsp
+  806aca:	33 32                	xor    (%rdx),%esi
+  806acc:	5f                   	pop    %rdi
+  806acd:	4d                   	rex.WRB
+  806ace:	49                   	rex.WB
+  806acf:	4e 00 66 73          	rex.WRX add %r12b,0x73(%rsi)
+  806ad3:	00 46 53             	add    %al,0x53(%rsi)
+  806ad6:	20 69 73             	and    %ch,0x73(%rcx)
+  806ad9:	20 72 75             	and    %dh,0x75(%rdx)
+  806adc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806add:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806ade:	69 6e 67 0a 00 46 53 	imul   $0x5346000a,0x67(%rsi),%ebp
+  806ae5:	20 63 61             	and    %ah,0x61(%rbx)
+  806ae8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806ae9:	20 64 6f 20          	and    %ah,0x20(%rdi,%rbp,2)
+  806aed:	49 2f                	rex.WB (bad)
+  806aef:	4f 0a 00             	rex.WRXB or (%r8),%r8b
+  806af2:	73 79                	jae    806b6d <short_requests+0x5>
+  806af4:	73 5f                	jae    806b55 <__rodata_start+0x375>
+  806af6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  806af8:	76 5f                	jbe    806b59 <__rodata_start+0x379>
+  806afa:	73 65                	jae    806b61 <__rodata_start+0x381>
+  806afc:	74 5f                	je     806b5d <__rodata_start+0x37d>
+  806afe:	72 65                	jb     806b65 <__rodata_start+0x385>
+  806b00:	63 6c 61 69          	movsxd 0x69(%rcx,%riz,2),%ebp
+  806b04:	6d                   	insl   (%dx),%es:(%rdi)
+  806b05:	3a 20                	cmp    (%rax),%ah
+  806b07:	25 69 00 66 0f       	and    $0xf660069,%eax
+  806b0c:	1f                   	(bad)
+  806b0d:	44 00 00             	add    %r8b,(%rax)
+  806b10:	49 6e                	rex.WB outsb %ds:(%rsi),(%dx)
+  806b12:	76 61                	jbe    806b75 <short_requests+0xd>
+  806b14:	6c                   	insb   (%dx),%es:(%rdi)
+  806b15:	69 64 20 72 65 71 75 	imul   $0x65757165,0x72(%rax,%riz,1),%esp
+  806b1c:	65 
+  806b1d:	73 74                	jae    806b93 <short_requests+0x2b>
+  806b1f:	20 66 72             	and    %ah,0x72(%rsi)
+  806b22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806b23:	6d                   	insl   (%dx),%es:(%rdi)
+  806b24:	20 25 30 38 78 3a    	and    %ah,0x3a783830(%rip)        # 3af8a35a <__bss_end+0x3a76135a>
+  806b2a:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  806b2d:	20 61 72             	and    %ah,0x72(%rcx)
+  806b30:	67 75 6d             	addr32 jne 806ba0 <short_requests+0x38>
+  806b33:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  806b35:	74 20                	je     806b57 <__rodata_start+0x377>
+  806b37:	70 61                	jo     806b9a <short_requests+0x32>
+  806b39:	67 65 0a 00          	or     %gs:(%eax),%al
+  806b3d:	00 00                	add    %al,(%rax)
+  806b3f:	00 49 6e             	add    %cl,0x6e(%rcx)
+  806b42:	76 61                	jbe    806ba5 <short_requests+0x3d>
+  806b44:	6c                   	insb   (%dx),%es:(%rdi)
+  806b45:	69 64 20 72 65 71 75 	imul   $0x65757165,0x72(%rax,%riz,1),%esp
+  806b4c:	65 
+  806b4d:	73 74                	jae    806bc3 <short_requests+0x5b>
+  806b4f:	20 63 6f             	and    %ah,0x6f(%rbx)
+  806b52:	64 65 20 25 64 20 66 	fs and %ah,%gs:0x72662064(%rip)        # 72e68bbe <__bss_end+0x7263fbbe>
+  806b59:	72 
+  806b5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806b5b:	6d                   	insl   (%dx),%es:(%rdi)
+  806b5c:	20 25 30 38 78 0a    	and    %ah,0xa783830(%rip)        # af8a392 <__bss_end+0xa761392>
+  806b62:	00 0f                	add    %cl,(%rdi)
+  806b64:	1f                   	(bad)
+  806b65:	44 00 00             	add    %r8b,(%rax)
+
+0000000000806b68 <short_requests>:
+  806b68:	00 00 01 00 00 00 01 00 01 00 01 00 00 63 68 65     .............che
+  806b78:	63 6b 69 6e 67 20 63 6f 6e 73 69 73 74 65 6e 63     cking consistenc
+  806b88:	79 20 6f 66 20 25 73 0a 00 21 62 6c 6f 63 6b 5f     y of %s..!block_
+  806b98:	69 73 5f 66 72 65 65 28 2a 70 64 69 73 6b 62 6e     is_free(*pdiskbn
+  806ba8:	6f 29 00 66 73 2f 74 65 73 74 2e 63 00 73 79 73     o).fs/test.c.sys
+  806bb8:	5f 70 61 67 65 5f 61 6c 6c 6f 63 3a 20 25 69 00     _page_alloc: %i.
+  806bc8:	54 53 54 42 49 54 28 62 69 74 73 2c 20 72 29 00     TSTBIT(bits, r).
+  806bd8:	21 54 53 54 42 49 54 28 62 69 74 6d 61 70 2c 20     !TSTBIT(bitmap, 
+  806be8:	72 29 00 61 6c 6c 6f 63 5f 62 6c 6f 63 6b 20 69     r).alloc_block i
+  806bf8:	73 20 67 6f 6f 64 0a 00 66 73 20 63 6f 6e 73 69     s good..fs consi
+  806c08:	73 74 65 6e 63 79 20 69 73 20 67 6f 6f 64 0a 00     stency is good..
+  806c18:	2f 6e 6f 74 2d 66 6f 75 6e 64 00 66 69 6c 65 5f     /not-found.file_
+  806c28:	6f 70 65 6e 20 2f 6e 6f 74 2d 66 6f 75 6e 64 3a     open /not-found:
+  806c38:	20 25 69 00 2f 6e 65 77 6d 6f 74 64 00 66 69 6c      %i./newmotd.fil
+  806c48:	65 5f 6f 70 65 6e 20 2f 6e 65 77 6d 6f 74 64 3a     e_open /newmotd:
+  806c58:	20 25 69 00 66 69 6c 65 5f 6f 70 65 6e 20 69 73      %i.file_open is
+  806c68:	20 67 6f 6f 64 0a 00 66 69 6c 65 5f 67 65 74 5f      good..file_get_
+  806c78:	62 6c 6f 63 6b 3a 20 25 69 00 66 69 6c 65 5f 67     block: %i.file_g
+  806c88:	65 74 5f 62 6c 6f 63 6b 20 69 73 20 67 6f 6f 64     et_block is good
+  806c98:	0a 00 21 69 73 5f 70 61 67 65 5f 64 69 72 74 79     ..!is_page_dirty
+  806ca8:	28 62 6c 6b 29 00 66 69 6c 65 5f 66 6c 75 73 68     (blk).file_flush
+  806cb8:	20 69 73 20 67 6f 6f 64 0a 00 66 69 6c 65 5f 73      is good..file_s
+  806cc8:	65 74 5f 73 69 7a 65 3a 20 25 69 00 66 2d 3e 66     et_size: %i.f->f
+  806cd8:	5f 64 69 72 65 63 74 5b 30 5d 20 3d 3d 20 30 00     _direct[0] == 0.
+  806ce8:	21 69 73 5f 70 61 67 65 5f 64 69 72 74 79 28 66     !is_page_dirty(f
+  806cf8:	29 00 66 69 6c 65 5f 74 72 75 6e 63 61 74 65 20     ).file_truncate 
+  806d08:	69 73 20 67 6f 6f 64 0a 00 66 69 6c 65 5f 73 65     is good..file_se
+  806d18:	74 5f 73 69 7a 65 20 32 3a 20 25 69 00 66 69 6c     t_size 2: %i.fil
+  806d28:	65 5f 67 65 74 5f 62 6c 6f 63 6b 20 32 3a 20 25     e_get_block 2: %
+  806d38:	69 00 66 69 6c 65 20 72 65 77 72 69 74 65 20 69     i.file rewrite i
+  806d48:	73 20 67 6f 6f 64 0a 00 66 69 6c 65 5f 6f 70 65     s good..file_ope
+  806d58:	6e 20 2f 6e 6f 74 2d 66 6f 75 6e 64 20 73 75 63     n /not-found suc
+  806d68:	63 65 65 64 65 64 21 00 54 68 69 73 20 69 73 20     ceeded!.This is 
+  806d78:	74 68 65 20 4e 45 57 20 6d 65 73 73 61 67 65 20     the NEW message 
+  806d88:	6f 66 20 74 68 65 20 64 61 79 21 0a 0a 00 00 00     of the day!.....
+  806d98:	66 69 6c 65 5f 67 65 74 5f 62 6c 6f 63 6b 20 72     file_get_block r
+  806da8:	65 74 75 72 6e 65 64 20 77 72 6f 6e 67 20 64 61     eturned wrong da
+  806db8:	74 61 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 00     ta.<unknown>....
+  806dc8:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806dd8:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806de8:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806df8:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806e08:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806e18:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806e28:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806e38:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806e48:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806e58:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806e68:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806e78:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806e88:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806e98:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806ea8:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806eb8:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806ec8:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806ed8:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806ee8:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806ef8:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806f08:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806f18:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806f28:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806f38:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806f48:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806f58:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806f68:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806f78:	64 00 66 0f 1f 44 00 00 4e 33 80 00 00 00 00 00     d.f..D..N3......
+  806f88:	a5 39 80 00 00 00 00 00 95 39 80 00 00 00 00 00     .9.......9......
+  806f98:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  806fa8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  806fb8:	6d 33 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     m3.......9......
+  806fc8:	a5 39 80 00 00 00 00 00 61 33 80 00 00 00 00 00     .9......a3......
+  806fd8:	db 33 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .3.......9......
+  806fe8:	61 33 80 00 00 00 00 00 a7 33 80 00 00 00 00 00     a3.......3......
+  806ff8:	a7 33 80 00 00 00 00 00 a7 33 80 00 00 00 00 00     .3.......3......
+  807008:	a7 33 80 00 00 00 00 00 a7 33 80 00 00 00 00 00     .3.......3......
+  807018:	a7 33 80 00 00 00 00 00 a7 33 80 00 00 00 00 00     .3.......3......
+  807028:	a7 33 80 00 00 00 00 00 a7 33 80 00 00 00 00 00     .3.......3......
+  807038:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807048:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807058:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807068:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807078:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807088:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807098:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8070a8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8070b8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8070c8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8070d8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8070e8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8070f8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807108:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807118:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807128:	c3 38 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .8.......9......
+  807138:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807148:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807158:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807168:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807178:	a5 39 80 00 00 00 00 00 09 34 80 00 00 00 00 00     .9.......4......
+  807188:	d8 35 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .5.......9......
+  807198:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8071a8:	fe 33 80 00 00 00 00 00 38 34 80 00 00 00 00 00     .3......84......
+  8071b8:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  8071c8:	f3 33 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .3.......9......
+  8071d8:	a5 39 80 00 00 00 00 00 81 37 80 00 00 00 00 00     .9.......7......
+  8071e8:	50 38 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     P8.......9......
+  8071f8:	a5 39 80 00 00 00 00 00 cf 34 80 00 00 00 00 00     .9.......4......
+  807208:	a5 39 80 00 00 00 00 00 ac 36 80 00 00 00 00 00     .9.......6......
+  807218:	a5 39 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .9.......9......
+  807228:	c3 38 80 00 00 00 00 00 a5 39 80 00 00 00 00 00     .8.......9......
+  807238:	57 33 80 00 00 00 00 00                             W3......
+
+0000000000807240 <error_string>:
+	...
+  807248:	1d 6e 80 00 00 00 00 00 2f 6e 80 00 00 00 00 00     .n....../n......
+  807258:	3f 6e 80 00 00 00 00 00 51 6e 80 00 00 00 00 00     ?n......Qn......
+  807268:	5f 6e 80 00 00 00 00 00 73 6e 80 00 00 00 00 00     _n......sn......
+  807278:	88 6e 80 00 00 00 00 00 9b 6e 80 00 00 00 00 00     .n.......n......
+  807288:	ad 6e 80 00 00 00 00 00 c1 6e 80 00 00 00 00 00     .n.......n......
+  807298:	d1 6e 80 00 00 00 00 00 e4 6e 80 00 00 00 00 00     .n.......n......
+  8072a8:	fb 6e 80 00 00 00 00 00 11 6f 80 00 00 00 00 00     .n.......o......
+  8072b8:	29 6f 80 00 00 00 00 00 41 6f 80 00 00 00 00 00     )o......Ao......
+  8072c8:	4e 6f 80 00 00 00 00 00 e0 72 80 00 00 00 00 00     No.......r......
+  8072d8:	62 6f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     bo......file is 
+  8072e8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8072f8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  807308:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  807318:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  807328:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  807338:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  807348:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  807358:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  807368:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  807378:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  807388:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  807398:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8073a8:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8073b8:	2f 69 70 63 2e 63 00 90 5b 25 30 38 78 5d 20 75     /ipc.c..[%08x] u
+  8073c8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8073d8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8073e8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8073f8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  807408:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  807418:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  807428:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  807438:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000807440 <devtab>:
+  807440:	a0 c0 80 00 00 00 00 00 e0 c0 80 00 00 00 00 00     ................
+  807450:	20 c1 80 00 00 00 00 00 00 00 00 00 00 00 00 00      ...............
+  807460:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  807470:	6f 72 64 73 29 00 6c 69 62 2f 66 69 6c 65 2e 63     ords).lib/file.c
+  807480:	00 62 75 66 00 72 65 73 20 3c 3d 20 6e 00 66 90     .buf.res <= n.f.
+  807490:	72 65 73 20 3c 3d 20 73 69 7a 65 6f 66 28 66 73     res <= sizeof(fs
+  8074a0:	69 70 63 62 75 66 2e 72 65 61 64 52 65 74 2e 72     ipcbuf.readRet.r
+  8074b0:	65 74 5f 62 75 66 29 00 3c 70 69 70 65 3e 00 6c     et_buf).<pipe>.l
+  8074c0:	69 62 2f 70 69 70 65 2e 63 00 70 69 70 65 00 90     ib/pipe.c.pipe..
+  8074d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8074e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8074f0:	3d 20 32 00 66 75 6e 00 6c 69 62 2f 75 76 70 74     = 2.fun.lib/uvpt
+  807500:	2e 63 00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f     .c.addr == 0.<co
+  807510:	6e 73 3e 00 63 6f 6e 73 00 66 2e 0f 1f 84 00 00     ns>.cons.f......
+  807520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8075a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8075b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8075c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8075d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8075e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8075f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8076a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8076b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8076c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8076d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8076e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8076f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8077a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8077b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8077c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8077d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8077e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8077f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8078a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8078b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8078c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8078d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8078e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8078f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8079a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8079b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8079c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8079d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8079e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8079f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
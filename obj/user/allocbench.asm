@@ -0,0 +1,10448 @@
+
+obj/user/allocbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 82 24 80 00 00 	movabs $0x802482,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 43 34 80 00 00 	movabs $0x803443,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 43 34 80 00 00 	movabs $0x803443,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 19 3e 80 00 00 	movabs $0x803e19,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 19 3e 80 00 00 	movabs $0x803e19,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 36 17 80 00 00 	movabs $0x801736,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 9f 5e 80 00 00 	movabs $0x805e9f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 a2 22 80 00 00 	movabs $0x8022a2,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 40 58 80 00 00 	movabs $0x805840,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 a2 22 80 00 00 	movabs $0x8022a2,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 42 58 80 00 00 	movabs $0x805842,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 a2 22 80 00 00 	movabs $0x8022a2,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 45 58 80 00 00 	movabs $0x805845,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 a2 22 80 00 00 	movabs $0x8022a2,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 2b 4c 80 00 00 	movabs $0x804c2b,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 02 4f 80 00 00 	movabs $0x804f02,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 2d 35 80 00 00 	movabs $0x80352d,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 fc 34 80 00 00 	movabs $0x8034fc,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 fc 34 80 00 00 	movabs $0x8034fc,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 14 33 80 00 00 	movabs $0x803314,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 43 34 80 00 00 	movabs $0x803443,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 4f 24 80 00 00 	movabs $0x80244f,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 60 58 80 00 00 	movabs $0x805860,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 82 24 80 00 00 	movabs $0x802482,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 4f 24 80 00 00 	movabs $0x80244f,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 00 5b 80 00 00 	movabs $0x805b00,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 4f 24 80 00 00 	movabs $0x80244f,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 4f 24 80 00 00 	movabs $0x80244f,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 80 5d 80 00 00 	movabs $0x805d80,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 80 5d 80 00 00 	movabs $0x805d80,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 8e 01 00 00       	call   80168d <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#define BENCH_VA        ((uint8_t *)0x10000000)
+#define BENCH_ITERS     (1 << 20)
+#define BENCH_MAX_CLASS 4
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 18          	sub    $0x18,%rsp
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+  801512:	83 ff 01             	cmp    $0x1,%edi
+  801515:	0f 8f e1 00 00 00    	jg     8015fc <umain+0xfb>
+    int res;
+
+    uint32_t start = vsys_gettimems();
+  80151b:	48 b8 8f 48 80 00 00 	movabs $0x80488f,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+  801527:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+  80152a:	41 bd 00 00 10 00    	mov    $0x100000,%r13d
+  801530:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (long i = 0; i < iters; i++) {
+        size_t size = PAGE_SIZE << (i % (BENCH_MAX_CLASS + 1));
+
+        if ((res = sys_alloc_region(CURENVID, BENCH_VA, size, PROT_RW)) < 0)
+  801535:	49 bf 45 29 80 00 00 	movabs $0x802945,%r15
+  80153c:	00 00 00 
+
+        /* Memory is allocated lazily, so write
+         * to it to make kernel allocate the page */
+        BENCH_VA[0] = 1;
+
+        if ((res = sys_unmap_region(CURENVID, BENCH_VA, size)) < 0)
+  80153f:	49 be 1d 2a 80 00 00 	movabs $0x802a1d,%r14
+  801546:	00 00 00 
+        size_t size = PAGE_SIZE << (i % (BENCH_MAX_CLASS + 1));
+  801549:	48 b8 67 66 66 66 66 	movabs $0x6666666666666667,%rax
+  801550:	66 66 66 
+  801553:	48 f7 eb             	imul   %rbx
+  801556:	48 d1 fa             	sar    %rdx
+  801559:	48 89 d8             	mov    %rbx,%rax
+  80155c:	48 c1 f8 3f          	sar    $0x3f,%rax
+  801560:	48 29 c2             	sub    %rax,%rdx
+  801563:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  801567:	48 89 d9             	mov    %rbx,%rcx
+  80156a:	48 29 c1             	sub    %rax,%rcx
+  80156d:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  801573:	49 d3 e4             	shl    %cl,%r12
+        if ((res = sys_alloc_region(CURENVID, BENCH_VA, size, PROT_RW)) < 0)
+  801576:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80157b:	4c 89 e2             	mov    %r12,%rdx
+  80157e:	be 00 00 00 10       	mov    $0x10000000,%esi
+  801583:	bf 00 00 00 00       	mov    $0x0,%edi
+  801588:	41 ff d7             	call   *%r15
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	0f 88 a0 00 00 00    	js     801633 <umain+0x132>
+        BENCH_VA[0] = 1;
+  801593:	c6 04 25 00 00 00 10 	movb   $0x1,0x10000000
+  80159a:	01 
+        if ((res = sys_unmap_region(CURENVID, BENCH_VA, size)) < 0)
+  80159b:	4c 89 e2             	mov    %r12,%rdx
+  80159e:	be 00 00 00 10       	mov    $0x10000000,%esi
+  8015a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a8:	41 ff d6             	call   *%r14
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	0f 88 ad 00 00 00    	js     801660 <umain+0x15f>
+    for (long i = 0; i < iters; i++) {
+  8015b3:	48 83 c3 01          	add    $0x1,%rbx
+  8015b7:	4c 39 eb             	cmp    %r13,%rbx
+  8015ba:	75 8d                	jne    801549 <umain+0x48>
+            panic("sys_unmap_region: %i", res);
+    }
+    uint32_t elapsed = vsys_gettimems() - start;
+  8015bc:	48 b8 8f 48 80 00 00 	movabs $0x80488f,%rax
+  8015c3:	00 00 00 
+  8015c6:	ff d0                	call   *%rax
+  8015c8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8015cb:	29 f0                	sub    %esi,%eax
+  8015cd:	89 c2                	mov    %eax,%edx
+
+    cprintf("allocbench: %ld alloc/free pairs in %u ms\n", iters, elapsed);
+  8015cf:	4c 89 ee             	mov    %r13,%rsi
+  8015d2:	48 bf e0 5d 80 00 00 	movabs $0x805de0,%rdi
+  8015d9:	00 00 00 
+  8015dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e1:	48 b9 a9 18 80 00 00 	movabs $0x8018a9,%rcx
+  8015e8:	00 00 00 
+  8015eb:	ff d1                	call   *%rcx
+}
+  8015ed:	48 83 c4 18          	add    $0x18,%rsp
+  8015f1:	5b                   	pop    %rbx
+  8015f2:	41 5c                	pop    %r12
+  8015f4:	41 5d                	pop    %r13
+  8015f6:	41 5e                	pop    %r14
+  8015f8:	41 5f                	pop    %r15
+  8015fa:	5d                   	pop    %rbp
+  8015fb:	c3                   	ret
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+  8015fc:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  801600:	ba 00 00 00 00       	mov    $0x0,%edx
+  801605:	be 00 00 00 00       	mov    $0x0,%esi
+  80160a:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  801611:	00 00 00 
+  801614:	ff d0                	call   *%rax
+  801616:	49 89 c5             	mov    %rax,%r13
+    uint32_t start = vsys_gettimems();
+  801619:	48 b8 8f 48 80 00 00 	movabs $0x80488f,%rax
+  801620:	00 00 00 
+  801623:	ff d0                	call   *%rax
+  801625:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    for (long i = 0; i < iters; i++) {
+  801628:	4d 85 ed             	test   %r13,%r13
+  80162b:	0f 8f ff fe ff ff    	jg     801530 <umain+0x2f>
+  801631:	eb 89                	jmp    8015bc <umain+0xbb>
+            panic("sys_alloc_region: %i", res);
+  801633:	89 c1                	mov    %eax,%ecx
+  801635:	48 ba a2 5d 80 00 00 	movabs $0x805da2,%rdx
+  80163c:	00 00 00 
+  80163f:	be 14 00 00 00       	mov    $0x14,%esi
+  801644:	48 bf b7 5d 80 00 00 	movabs $0x805db7,%rdi
+  80164b:	00 00 00 
+  80164e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801653:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  80165a:	00 00 00 
+  80165d:	41 ff d0             	call   *%r8
+            panic("sys_unmap_region: %i", res);
+  801660:	89 c1                	mov    %eax,%ecx
+  801662:	48 ba c9 5d 80 00 00 	movabs $0x805dc9,%rdx
+  801669:	00 00 00 
+  80166c:	be 1b 00 00 00       	mov    $0x1b,%esi
+  801671:	48 bf b7 5d 80 00 00 	movabs $0x805db7,%rdi
+  801678:	00 00 00 
+  80167b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801680:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  801687:	00 00 00 
+  80168a:	41 ff d0             	call   *%r8
+
+000000000080168d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80168d:	55                   	push   %rbp
+  80168e:	48 89 e5             	mov    %rsp,%rbp
+  801691:	41 56                	push   %r14
+  801693:	41 55                	push   %r13
+  801695:	41 54                	push   %r12
+  801697:	53                   	push   %rbx
+  801698:	41 89 fd             	mov    %edi,%r13d
+  80169b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80169e:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8016a5:	00 00 00 
+  8016a8:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8016af:	00 00 00 
+  8016b2:	48 39 c2             	cmp    %rax,%rdx
+  8016b5:	73 17                	jae    8016ce <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8016b7:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8016ba:	49 89 c4             	mov    %rax,%r12
+  8016bd:	48 83 c3 08          	add    $0x8,%rbx
+  8016c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c6:	ff 53 f8             	call   *-0x8(%rbx)
+  8016c9:	4c 39 e3             	cmp    %r12,%rbx
+  8016cc:	72 ef                	jb     8016bd <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8016ce:	48 b8 6d 28 80 00 00 	movabs $0x80286d,%rax
+  8016d5:	00 00 00 
+  8016d8:	ff d0                	call   *%rax
+  8016da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016df:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8016e6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016ed:	00 00 00 
+  8016f0:	48 01 d0             	add    %rdx,%rax
+  8016f3:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8016fa:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8016fd:	45 85 ed             	test   %r13d,%r13d
+  801700:	7e 0d                	jle    80170f <libmain+0x82>
+  801702:	49 8b 06             	mov    (%r14),%rax
+  801705:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80170c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80170f:	4c 89 f6             	mov    %r14,%rsi
+  801712:	44 89 ef             	mov    %r13d,%edi
+  801715:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80171c:	00 00 00 
+  80171f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801721:	48 b8 36 17 80 00 00 	movabs $0x801736,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+#endif
+}
+  80172d:	5b                   	pop    %rbx
+  80172e:	41 5c                	pop    %r12
+  801730:	41 5d                	pop    %r13
+  801732:	41 5e                	pop    %r14
+  801734:	5d                   	pop    %rbp
+  801735:	c3                   	ret
+
+0000000000801736 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801736:	55                   	push   %rbp
+  801737:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80173a:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  801741:	00 00 00 
+  801744:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801746:	bf 00 00 00 00       	mov    $0x0,%edi
+  80174b:	48 b8 fc 27 80 00 00 	movabs $0x8027fc,%rax
+  801752:	00 00 00 
+  801755:	ff d0                	call   *%rax
+}
+  801757:	5d                   	pop    %rbp
+  801758:	c3                   	ret
+
+0000000000801759 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801759:	55                   	push   %rbp
+  80175a:	48 89 e5             	mov    %rsp,%rbp
+  80175d:	41 56                	push   %r14
+  80175f:	41 55                	push   %r13
+  801761:	41 54                	push   %r12
+  801763:	53                   	push   %rbx
+  801764:	48 83 ec 50          	sub    $0x50,%rsp
+  801768:	49 89 fc             	mov    %rdi,%r12
+  80176b:	41 89 f5             	mov    %esi,%r13d
+  80176e:	48 89 d3             	mov    %rdx,%rbx
+  801771:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801775:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801779:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80177d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801784:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801788:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80178c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801790:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801794:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80179b:	00 00 00 
+  80179e:	4c 8b 30             	mov    (%rax),%r14
+  8017a1:	48 b8 6d 28 80 00 00 	movabs $0x80286d,%rax
+  8017a8:	00 00 00 
+  8017ab:	ff d0                	call   *%rax
+  8017ad:	89 c6                	mov    %eax,%esi
+  8017af:	45 89 e8             	mov    %r13d,%r8d
+  8017b2:	4c 89 e1             	mov    %r12,%rcx
+  8017b5:	4c 89 f2             	mov    %r14,%rdx
+  8017b8:	48 bf 18 5e 80 00 00 	movabs $0x805e18,%rdi
+  8017bf:	00 00 00 
+  8017c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c7:	49 bc a9 18 80 00 00 	movabs $0x8018a9,%r12
+  8017ce:	00 00 00 
+  8017d1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8017d4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8017d8:	48 89 df             	mov    %rbx,%rdi
+  8017db:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  8017e2:	00 00 00 
+  8017e5:	ff d0                	call   *%rax
+    cprintf("\n");
+  8017e7:	48 bf f3 63 80 00 00 	movabs $0x8063f3,%rdi
+  8017ee:	00 00 00 
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f6:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8017f9:	cc                   	int3
+  8017fa:	eb fd                	jmp    8017f9 <_panic+0xa0>
+
+00000000008017fc <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8017fc:	55                   	push   %rbp
+  8017fd:	48 89 e5             	mov    %rsp,%rbp
+  801800:	53                   	push   %rbx
+  801801:	48 83 ec 08          	sub    $0x8,%rsp
+  801805:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801808:	8b 06                	mov    (%rsi),%eax
+  80180a:	8d 50 01             	lea    0x1(%rax),%edx
+  80180d:	89 16                	mov    %edx,(%rsi)
+  80180f:	48 98                	cltq
+  801811:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801816:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80181c:	74 0a                	je     801828 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80181e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801822:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801828:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80182c:	be ff 00 00 00       	mov    $0xff,%esi
+  801831:	48 b8 5d 27 80 00 00 	movabs $0x80275d,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80183d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801843:	eb d9                	jmp    80181e <putch+0x22>
+
+0000000000801845 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801845:	55                   	push   %rbp
+  801846:	48 89 e5             	mov    %rsp,%rbp
+  801849:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801850:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801853:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80185a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80185f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801864:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801867:	48 89 f1             	mov    %rsi,%rcx
+  80186a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801871:	48 bf fc 17 80 00 00 	movabs $0x8017fc,%rdi
+  801878:	00 00 00 
+  80187b:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  801882:	00 00 00 
+  801885:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801887:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80188e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801895:	48 b8 5d 27 80 00 00 	movabs $0x80275d,%rax
+  80189c:	00 00 00 
+  80189f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8018a1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8018a7:	c9                   	leave
+  8018a8:	c3                   	ret
+
+00000000008018a9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8018a9:	55                   	push   %rbp
+  8018aa:	48 89 e5             	mov    %rsp,%rbp
+  8018ad:	48 83 ec 50          	sub    $0x50,%rsp
+  8018b1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8018b5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8018b9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018bd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018c1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8018c5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8018cc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018d4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018d8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8018dc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8018e0:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  8018e7:	00 00 00 
+  8018ea:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8018ec:	c9                   	leave
+  8018ed:	c3                   	ret
+
+00000000008018ee <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	41 57                	push   %r15
+  8018f4:	41 56                	push   %r14
+  8018f6:	41 55                	push   %r13
+  8018f8:	41 54                	push   %r12
+  8018fa:	53                   	push   %rbx
+  8018fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8018ff:	49 89 fc             	mov    %rdi,%r12
+  801902:	49 89 f5             	mov    %rsi,%r13
+  801905:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801909:	8b 45 10             	mov    0x10(%rbp),%eax
+  80190c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80190f:	41 89 cf             	mov    %ecx,%r15d
+  801912:	4c 39 fa             	cmp    %r15,%rdx
+  801915:	73 5b                	jae    801972 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801917:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80191b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80191f:	85 db                	test   %ebx,%ebx
+  801921:	7e 0e                	jle    801931 <print_num+0x43>
+            putch(padc, put_arg);
+  801923:	4c 89 ee             	mov    %r13,%rsi
+  801926:	44 89 f7             	mov    %r14d,%edi
+  801929:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80192c:	83 eb 01             	sub    $0x1,%ebx
+  80192f:	75 f2                	jne    801923 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801931:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801935:	48 b9 4c 5e 80 00 00 	movabs $0x805e4c,%rcx
+  80193c:	00 00 00 
+  80193f:	48 b8 3b 5e 80 00 00 	movabs $0x805e3b,%rax
+  801946:	00 00 00 
+  801949:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80194d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801951:	ba 00 00 00 00       	mov    $0x0,%edx
+  801956:	49 f7 f7             	div    %r15
+  801959:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80195d:	4c 89 ee             	mov    %r13,%rsi
+  801960:	41 ff d4             	call   *%r12
+}
+  801963:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801967:	5b                   	pop    %rbx
+  801968:	41 5c                	pop    %r12
+  80196a:	41 5d                	pop    %r13
+  80196c:	41 5e                	pop    %r14
+  80196e:	41 5f                	pop    %r15
+  801970:	5d                   	pop    %rbp
+  801971:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801972:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801976:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197b:	49 f7 f7             	div    %r15
+  80197e:	48 83 ec 08          	sub    $0x8,%rsp
+  801982:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801986:	52                   	push   %rdx
+  801987:	45 0f be c9          	movsbl %r9b,%r9d
+  80198b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80198f:	48 89 c2             	mov    %rax,%rdx
+  801992:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801999:	00 00 00 
+  80199c:	ff d0                	call   *%rax
+  80199e:	48 83 c4 10          	add    $0x10,%rsp
+  8019a2:	eb 8d                	jmp    801931 <print_num+0x43>
+
+00000000008019a4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8019a4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8019a8:	48 8b 06             	mov    (%rsi),%rax
+  8019ab:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8019af:	73 0a                	jae    8019bb <sprintputch+0x17>
+        *state->start++ = ch;
+  8019b1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019b5:	48 89 16             	mov    %rdx,(%rsi)
+  8019b8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8019bb:	c3                   	ret
+
+00000000008019bc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	48 83 ec 50          	sub    $0x50,%rsp
+  8019c4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019c8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019cc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8019d0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8019d7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019df:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019e3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8019e7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8019eb:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  8019f2:	00 00 00 
+  8019f5:	ff d0                	call   *%rax
+}
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+
+00000000008019f9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	41 57                	push   %r15
+  8019ff:	41 56                	push   %r14
+  801a01:	41 55                	push   %r13
+  801a03:	41 54                	push   %r12
+  801a05:	53                   	push   %rbx
+  801a06:	48 83 ec 38          	sub    $0x38,%rsp
+  801a0a:	49 89 fe             	mov    %rdi,%r14
+  801a0d:	49 89 f5             	mov    %rsi,%r13
+  801a10:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801a13:	48 8b 01             	mov    (%rcx),%rax
+  801a16:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801a1a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801a1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a22:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801a26:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801a2a:	eb 0d                	jmp    801a39 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801a2c:	40 0f b6 ff          	movzbl %dil,%edi
+  801a30:	4c 89 ee             	mov    %r13,%rsi
+  801a33:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801a36:	4c 89 e3             	mov    %r12,%rbx
+  801a39:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801a3d:	0f b6 3b             	movzbl (%rbx),%edi
+  801a40:	40 80 ff 25          	cmp    $0x25,%dil
+  801a44:	74 14                	je     801a5a <vprintfmt+0x61>
+            if (!ch) return;
+  801a46:	40 84 ff             	test   %dil,%dil
+  801a49:	75 e1                	jne    801a2c <vprintfmt+0x33>
+}
+  801a4b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a4f:	5b                   	pop    %rbx
+  801a50:	41 5c                	pop    %r12
+  801a52:	41 5d                	pop    %r13
+  801a54:	41 5e                	pop    %r14
+  801a56:	41 5f                	pop    %r15
+  801a58:	5d                   	pop    %rbp
+  801a59:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a5f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801a63:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801a68:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a6e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801a75:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a79:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801a7e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a83:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a86:	83 e8 23             	sub    $0x23,%eax
+  801a89:	3c 57                	cmp    $0x57,%al
+  801a8b:	0f 87 67 06 00 00    	ja     8020f8 <vprintfmt+0x6ff>
+  801a91:	0f b6 c0             	movzbl %al,%eax
+  801a94:	48 b9 e0 5f 80 00 00 	movabs $0x805fe0,%rcx
+  801a9b:	00 00 00 
+  801a9e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801aa1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801aa4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801aa8:	eb cf                	jmp    801a79 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801aaa:	49 89 dc             	mov    %rbx,%r12
+  801aad:	be 01 00 00 00       	mov    $0x1,%esi
+  801ab2:	eb c5                	jmp    801a79 <vprintfmt+0x80>
+            padc = ch;
+  801ab4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801ab8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801abb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801abe:	eb b9                	jmp    801a79 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801ac0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ac3:	83 f8 2f             	cmp    $0x2f,%eax
+  801ac6:	77 24                	ja     801aec <vprintfmt+0xf3>
+  801ac8:	89 c1                	mov    %eax,%ecx
+  801aca:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801ace:	83 c0 08             	add    $0x8,%eax
+  801ad1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ad4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801ad7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801ada:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ade:	79 99                	jns    801a79 <vprintfmt+0x80>
+                width = precision;
+  801ae0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ae4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801aea:	eb 8d                	jmp    801a79 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801aec:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801af0:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801af4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801af8:	eb da                	jmp    801ad4 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801afa:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801aff:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b03:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801b09:	3c 39                	cmp    $0x39,%al
+  801b0b:	77 1c                	ja     801b29 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801b0d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801b11:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801b15:	0f b6 c0             	movzbl %al,%eax
+  801b18:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b1d:	0f b6 03             	movzbl (%rbx),%eax
+  801b20:	3c 39                	cmp    $0x39,%al
+  801b22:	76 e9                	jbe    801b0d <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801b24:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801b27:	eb b1                	jmp    801ada <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801b29:	49 89 dc             	mov    %rbx,%r12
+  801b2c:	eb ac                	jmp    801ada <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801b2e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801b31:	85 c9                	test   %ecx,%ecx
+  801b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b38:	0f 49 c1             	cmovns %ecx,%eax
+  801b3b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801b3e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b41:	e9 33 ff ff ff       	jmp    801a79 <vprintfmt+0x80>
+            lflag++;
+  801b46:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b49:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b4c:	e9 28 ff ff ff       	jmp    801a79 <vprintfmt+0x80>
+            lflag--;
+  801b51:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b54:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b57:	e9 1d ff ff ff       	jmp    801a79 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801b5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b5f:	83 f8 2f             	cmp    $0x2f,%eax
+  801b62:	77 19                	ja     801b7d <vprintfmt+0x184>
+  801b64:	89 c2                	mov    %eax,%edx
+  801b66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b6a:	83 c0 08             	add    $0x8,%eax
+  801b6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b70:	8b 3a                	mov    (%rdx),%edi
+  801b72:	4c 89 ee             	mov    %r13,%rsi
+  801b75:	41 ff d6             	call   *%r14
+            break;
+  801b78:	e9 bc fe ff ff       	jmp    801a39 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801b7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b89:	eb e5                	jmp    801b70 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801b8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b91:	77 5a                	ja     801bed <vprintfmt+0x1f4>
+  801b93:	89 c2                	mov    %eax,%edx
+  801b95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b99:	83 c0 08             	add    $0x8,%eax
+  801b9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801b9f:	8b 02                	mov    (%rdx),%eax
+  801ba1:	89 c1                	mov    %eax,%ecx
+  801ba3:	f7 d9                	neg    %ecx
+  801ba5:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801ba8:	83 f9 13             	cmp    $0x13,%ecx
+  801bab:	7f 4e                	jg     801bfb <vprintfmt+0x202>
+  801bad:	48 63 c1             	movslq %ecx,%rax
+  801bb0:	48 ba a0 62 80 00 00 	movabs $0x8062a0,%rdx
+  801bb7:	00 00 00 
+  801bba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801bbe:	48 85 c0             	test   %rax,%rax
+  801bc1:	74 38                	je     801bfb <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801bc3:	48 89 c1             	mov    %rax,%rcx
+  801bc6:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  801bcd:	00 00 00 
+  801bd0:	4c 89 ee             	mov    %r13,%rsi
+  801bd3:	4c 89 f7             	mov    %r14,%rdi
+  801bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdb:	49 b8 bc 19 80 00 00 	movabs $0x8019bc,%r8
+  801be2:	00 00 00 
+  801be5:	41 ff d0             	call   *%r8
+  801be8:	e9 4c fe ff ff       	jmp    801a39 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801bed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bf1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf9:	eb a4                	jmp    801b9f <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801bfb:	48 ba 64 5e 80 00 00 	movabs $0x805e64,%rdx
+  801c02:	00 00 00 
+  801c05:	4c 89 ee             	mov    %r13,%rsi
+  801c08:	4c 89 f7             	mov    %r14,%rdi
+  801c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c10:	49 b8 bc 19 80 00 00 	movabs $0x8019bc,%r8
+  801c17:	00 00 00 
+  801c1a:	41 ff d0             	call   *%r8
+  801c1d:	e9 17 fe ff ff       	jmp    801a39 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c25:	83 f8 2f             	cmp    $0x2f,%eax
+  801c28:	77 6c                	ja     801c96 <vprintfmt+0x29d>
+  801c2a:	89 c2                	mov    %eax,%edx
+  801c2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c30:	83 c0 08             	add    $0x8,%eax
+  801c33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c36:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801c39:	48 85 f6             	test   %rsi,%rsi
+  801c3c:	48 b8 5d 5e 80 00 00 	movabs $0x805e5d,%rax
+  801c43:	00 00 00 
+  801c46:	48 0f 45 c6          	cmovne %rsi,%rax
+  801c4a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801c4e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c52:	7e 06                	jle    801c5a <vprintfmt+0x261>
+  801c54:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801c58:	75 4a                	jne    801ca4 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c5a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c5e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801c62:	0f b6 00             	movzbl (%rax),%eax
+  801c65:	84 c0                	test   %al,%al
+  801c67:	0f 85 9a 00 00 00    	jne    801d07 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801c6d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c70:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801c74:	85 c0                	test   %eax,%eax
+  801c76:	0f 8e bd fd ff ff    	jle    801a39 <vprintfmt+0x40>
+  801c7c:	4c 89 ee             	mov    %r13,%rsi
+  801c7f:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c84:	41 ff d6             	call   *%r14
+  801c87:	41 83 ec 01          	sub    $0x1,%r12d
+  801c8b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801c8f:	75 eb                	jne    801c7c <vprintfmt+0x283>
+  801c91:	e9 a3 fd ff ff       	jmp    801a39 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca2:	eb 92                	jmp    801c36 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ca4:	49 63 f7             	movslq %r15d,%rsi
+  801ca7:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801cab:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  801cb2:	00 00 00 
+  801cb5:	ff d0                	call   *%rax
+  801cb7:	48 89 c2             	mov    %rax,%rdx
+  801cba:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cbd:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801cbf:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801cc2:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	7e 91                	jle    801c5a <vprintfmt+0x261>
+  801cc9:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801cce:	4c 89 ee             	mov    %r13,%rsi
+  801cd1:	44 89 e7             	mov    %r12d,%edi
+  801cd4:	41 ff d6             	call   *%r14
+  801cd7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801cdb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cde:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ce1:	75 eb                	jne    801cce <vprintfmt+0x2d5>
+  801ce3:	e9 72 ff ff ff       	jmp    801c5a <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ce8:	0f b6 f8             	movzbl %al,%edi
+  801ceb:	4c 89 ee             	mov    %r13,%rsi
+  801cee:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801cf1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801cf5:	49 83 c4 01          	add    $0x1,%r12
+  801cf9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801cff:	84 c0                	test   %al,%al
+  801d01:	0f 84 66 ff ff ff    	je     801c6d <vprintfmt+0x274>
+  801d07:	45 85 ff             	test   %r15d,%r15d
+  801d0a:	78 0a                	js     801d16 <vprintfmt+0x31d>
+  801d0c:	41 83 ef 01          	sub    $0x1,%r15d
+  801d10:	0f 88 57 ff ff ff    	js     801c6d <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d16:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801d1a:	74 cc                	je     801ce8 <vprintfmt+0x2ef>
+  801d1c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801d1f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d24:	80 fa 5e             	cmp    $0x5e,%dl
+  801d27:	77 c2                	ja     801ceb <vprintfmt+0x2f2>
+  801d29:	eb bd                	jmp    801ce8 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801d2b:	40 84 f6             	test   %sil,%sil
+  801d2e:	75 26                	jne    801d56 <vprintfmt+0x35d>
+    switch (lflag) {
+  801d30:	85 d2                	test   %edx,%edx
+  801d32:	74 59                	je     801d8d <vprintfmt+0x394>
+  801d34:	83 fa 01             	cmp    $0x1,%edx
+  801d37:	74 7b                	je     801db4 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801d39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d3c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3f:	0f 87 96 00 00 00    	ja     801ddb <vprintfmt+0x3e2>
+  801d45:	89 c2                	mov    %eax,%edx
+  801d47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d4b:	83 c0 08             	add    $0x8,%eax
+  801d4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d51:	4c 8b 22             	mov    (%rdx),%r12
+  801d54:	eb 17                	jmp    801d6d <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801d56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d59:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5c:	77 21                	ja     801d7f <vprintfmt+0x386>
+  801d5e:	89 c2                	mov    %eax,%edx
+  801d60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d64:	83 c0 08             	add    $0x8,%eax
+  801d67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d6a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801d6d:	4d 85 e4             	test   %r12,%r12
+  801d70:	78 7a                	js     801dec <vprintfmt+0x3f3>
+            num = i;
+  801d72:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801d75:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801d7a:	e9 56 02 00 00       	jmp    801fd5 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8b:	eb dd                	jmp    801d6a <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801d8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d90:	83 f8 2f             	cmp    $0x2f,%eax
+  801d93:	77 11                	ja     801da6 <vprintfmt+0x3ad>
+  801d95:	89 c2                	mov    %eax,%edx
+  801d97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9b:	83 c0 08             	add    $0x8,%eax
+  801d9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da1:	4c 63 22             	movslq (%rdx),%r12
+  801da4:	eb c7                	jmp    801d6d <vprintfmt+0x374>
+  801da6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801daa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801db2:	eb ed                	jmp    801da1 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801db4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db7:	83 f8 2f             	cmp    $0x2f,%eax
+  801dba:	77 11                	ja     801dcd <vprintfmt+0x3d4>
+  801dbc:	89 c2                	mov    %eax,%edx
+  801dbe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc2:	83 c0 08             	add    $0x8,%eax
+  801dc5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc8:	4c 8b 22             	mov    (%rdx),%r12
+  801dcb:	eb a0                	jmp    801d6d <vprintfmt+0x374>
+  801dcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dd9:	eb ed                	jmp    801dc8 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801ddb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ddf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801de3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801de7:	e9 65 ff ff ff       	jmp    801d51 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801dec:	4c 89 ee             	mov    %r13,%rsi
+  801def:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801df4:	41 ff d6             	call   *%r14
+                i = -i;
+  801df7:	49 f7 dc             	neg    %r12
+  801dfa:	e9 73 ff ff ff       	jmp    801d72 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801dff:	40 84 f6             	test   %sil,%sil
+  801e02:	75 2e                	jne    801e32 <vprintfmt+0x439>
+    switch (lflag) {
+  801e04:	85 d2                	test   %edx,%edx
+  801e06:	7f 59                	jg     801e61 <vprintfmt+0x468>
+  801e08:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e0b:	7d 7a                	jge    801e87 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801e0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e10:	83 f8 2f             	cmp    $0x2f,%eax
+  801e13:	0f 87 aa 00 00 00    	ja     801ec3 <vprintfmt+0x4ca>
+  801e19:	89 c2                	mov    %eax,%edx
+  801e1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e1f:	83 c0 08             	add    $0x8,%eax
+  801e22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e25:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e28:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e2d:	e9 a3 01 00 00       	jmp    801fd5 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e35:	83 f8 2f             	cmp    $0x2f,%eax
+  801e38:	77 19                	ja     801e53 <vprintfmt+0x45a>
+  801e3a:	89 c2                	mov    %eax,%edx
+  801e3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e40:	83 c0 08             	add    $0x8,%eax
+  801e43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e46:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e49:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e4e:	e9 82 01 00 00       	jmp    801fd5 <vprintfmt+0x5dc>
+  801e53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e5f:	eb e5                	jmp    801e46 <vprintfmt+0x44d>
+    switch (lflag) {
+  801e61:	83 fa 01             	cmp    $0x1,%edx
+  801e64:	75 a7                	jne    801e0d <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801e66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e69:	83 f8 2f             	cmp    $0x2f,%eax
+  801e6c:	77 47                	ja     801eb5 <vprintfmt+0x4bc>
+  801e6e:	89 c2                	mov    %eax,%edx
+  801e70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e74:	83 c0 08             	add    $0x8,%eax
+  801e77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e7a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e7d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e82:	e9 4e 01 00 00       	jmp    801fd5 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e8a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8d:	77 18                	ja     801ea7 <vprintfmt+0x4ae>
+  801e8f:	89 c2                	mov    %eax,%edx
+  801e91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e95:	83 c0 08             	add    $0x8,%eax
+  801e98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e9b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801e9d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801ea2:	e9 2e 01 00 00       	jmp    801fd5 <vprintfmt+0x5dc>
+  801ea7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eaf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb3:	eb e6                	jmp    801e9b <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801eb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec1:	eb b7                	jmp    801e7a <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ec3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ecb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ecf:	e9 51 ff ff ff       	jmp    801e25 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ed4:	40 84 f6             	test   %sil,%sil
+  801ed7:	75 2e                	jne    801f07 <vprintfmt+0x50e>
+    switch (lflag) {
+  801ed9:	85 d2                	test   %edx,%edx
+  801edb:	7f 59                	jg     801f36 <vprintfmt+0x53d>
+  801edd:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ee0:	7d 77                	jge    801f59 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ee2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee5:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee8:	0f 87 a4 00 00 00    	ja     801f92 <vprintfmt+0x599>
+  801eee:	89 c2                	mov    %eax,%edx
+  801ef0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef4:	83 c0 08             	add    $0x8,%eax
+  801ef7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801efa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801efd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f02:	e9 ce 00 00 00       	jmp    801fd5 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f0a:	83 f8 2f             	cmp    $0x2f,%eax
+  801f0d:	77 19                	ja     801f28 <vprintfmt+0x52f>
+  801f0f:	89 c2                	mov    %eax,%edx
+  801f11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f15:	83 c0 08             	add    $0x8,%eax
+  801f18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f1e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f23:	e9 ad 00 00 00       	jmp    801fd5 <vprintfmt+0x5dc>
+  801f28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f34:	eb e5                	jmp    801f1b <vprintfmt+0x522>
+    switch (lflag) {
+  801f36:	83 fa 01             	cmp    $0x1,%edx
+  801f39:	75 a7                	jne    801ee2 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801f3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f3e:	83 f8 2f             	cmp    $0x2f,%eax
+  801f41:	77 41                	ja     801f84 <vprintfmt+0x58b>
+  801f43:	89 c2                	mov    %eax,%edx
+  801f45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f49:	83 c0 08             	add    $0x8,%eax
+  801f4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f52:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801f57:	eb 7c                	jmp    801fd5 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f5f:	77 15                	ja     801f76 <vprintfmt+0x57d>
+  801f61:	89 c2                	mov    %eax,%edx
+  801f63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f67:	83 c0 08             	add    $0x8,%eax
+  801f6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f6d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801f6f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801f74:	eb 5f                	jmp    801fd5 <vprintfmt+0x5dc>
+  801f76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f82:	eb e9                	jmp    801f6d <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f90:	eb bd                	jmp    801f4f <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801f92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f9e:	e9 57 ff ff ff       	jmp    801efa <vprintfmt+0x501>
+            putch('0', put_arg);
+  801fa3:	4c 89 ee             	mov    %r13,%rsi
+  801fa6:	bf 30 00 00 00       	mov    $0x30,%edi
+  801fab:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801fae:	4c 89 ee             	mov    %r13,%rsi
+  801fb1:	bf 78 00 00 00       	mov    $0x78,%edi
+  801fb6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801fb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fbc:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbf:	77 47                	ja     802008 <vprintfmt+0x60f>
+  801fc1:	89 c2                	mov    %eax,%edx
+  801fc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc7:	83 c0 08             	add    $0x8,%eax
+  801fca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fcd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fd0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801fd5:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801fdd:	0f 94 c0             	sete   %al
+  801fe0:	0f b6 c0             	movzbl %al,%eax
+  801fe3:	50                   	push   %rax
+  801fe4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801fe9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801fed:	4c 89 ee             	mov    %r13,%rsi
+  801ff0:	4c 89 f7             	mov    %r14,%rdi
+  801ff3:	48 b8 ee 18 80 00 00 	movabs $0x8018ee,%rax
+  801ffa:	00 00 00 
+  801ffd:	ff d0                	call   *%rax
+            break;
+  801fff:	48 83 c4 10          	add    $0x10,%rsp
+  802003:	e9 31 fa ff ff       	jmp    801a39 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802008:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80200c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802010:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802014:	eb b7                	jmp    801fcd <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802016:	40 84 f6             	test   %sil,%sil
+  802019:	75 2b                	jne    802046 <vprintfmt+0x64d>
+    switch (lflag) {
+  80201b:	85 d2                	test   %edx,%edx
+  80201d:	7f 56                	jg     802075 <vprintfmt+0x67c>
+  80201f:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802022:	7d 77                	jge    80209b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802024:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802027:	83 f8 2f             	cmp    $0x2f,%eax
+  80202a:	0f 87 a7 00 00 00    	ja     8020d7 <vprintfmt+0x6de>
+  802030:	89 c2                	mov    %eax,%edx
+  802032:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802036:	83 c0 08             	add    $0x8,%eax
+  802039:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80203c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80203f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802044:	eb 8f                	jmp    801fd5 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802046:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802049:	83 f8 2f             	cmp    $0x2f,%eax
+  80204c:	77 19                	ja     802067 <vprintfmt+0x66e>
+  80204e:	89 c2                	mov    %eax,%edx
+  802050:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802054:	83 c0 08             	add    $0x8,%eax
+  802057:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80205a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80205d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802062:	e9 6e ff ff ff       	jmp    801fd5 <vprintfmt+0x5dc>
+  802067:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80206b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80206f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802073:	eb e5                	jmp    80205a <vprintfmt+0x661>
+    switch (lflag) {
+  802075:	83 fa 01             	cmp    $0x1,%edx
+  802078:	75 aa                	jne    802024 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80207a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80207d:	83 f8 2f             	cmp    $0x2f,%eax
+  802080:	77 47                	ja     8020c9 <vprintfmt+0x6d0>
+  802082:	89 c2                	mov    %eax,%edx
+  802084:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802088:	83 c0 08             	add    $0x8,%eax
+  80208b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80208e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802091:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802096:	e9 3a ff ff ff       	jmp    801fd5 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80209b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80209e:	83 f8 2f             	cmp    $0x2f,%eax
+  8020a1:	77 18                	ja     8020bb <vprintfmt+0x6c2>
+  8020a3:	89 c2                	mov    %eax,%edx
+  8020a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020a9:	83 c0 08             	add    $0x8,%eax
+  8020ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020af:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8020b1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8020b6:	e9 1a ff ff ff       	jmp    801fd5 <vprintfmt+0x5dc>
+  8020bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c7:	eb e6                	jmp    8020af <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8020c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d5:	eb b7                	jmp    80208e <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8020d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e3:	e9 54 ff ff ff       	jmp    80203c <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8020e8:	4c 89 ee             	mov    %r13,%rsi
+  8020eb:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020f0:	41 ff d6             	call   *%r14
+            break;
+  8020f3:	e9 41 f9 ff ff       	jmp    801a39 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8020f8:	4c 89 ee             	mov    %r13,%rsi
+  8020fb:	bf 25 00 00 00       	mov    $0x25,%edi
+  802100:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802103:	48 83 eb 01          	sub    $0x1,%rbx
+  802107:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80210b:	75 f6                	jne    802103 <vprintfmt+0x70a>
+  80210d:	e9 27 f9 ff ff       	jmp    801a39 <vprintfmt+0x40>
+
+0000000000802112 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80211a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80211e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802123:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802127:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80212e:	48 85 ff             	test   %rdi,%rdi
+  802131:	74 2b                	je     80215e <vsnprintf+0x4c>
+  802133:	48 85 f6             	test   %rsi,%rsi
+  802136:	74 26                	je     80215e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802138:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80213c:	48 bf a4 19 80 00 00 	movabs $0x8019a4,%rdi
+  802143:	00 00 00 
+  802146:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802152:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802156:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802159:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80215c:	c9                   	leave
+  80215d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80215e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802163:	eb f7                	jmp    80215c <vsnprintf+0x4a>
+
+0000000000802165 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802165:	55                   	push   %rbp
+  802166:	48 89 e5             	mov    %rsp,%rbp
+  802169:	48 83 ec 50          	sub    $0x50,%rsp
+  80216d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802171:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802175:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802179:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802180:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802184:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802188:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80218c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802190:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802194:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  80219b:	00 00 00 
+  80219e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8021a0:	c9                   	leave
+  8021a1:	c3                   	ret
+
+00000000008021a2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8021a2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8021a5:	74 10                	je     8021b7 <strlen+0x15>
+    size_t n = 0;
+  8021a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8021ac:	48 83 c0 01          	add    $0x1,%rax
+  8021b0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8021b4:	75 f6                	jne    8021ac <strlen+0xa>
+  8021b6:	c3                   	ret
+    size_t n = 0;
+  8021b7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8021bc:	c3                   	ret
+
+00000000008021bd <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8021bd:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8021c0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8021c5:	48 85 f6             	test   %rsi,%rsi
+  8021c8:	74 11                	je     8021db <strnlen+0x1e>
+  8021ca:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8021ce:	74 0c                	je     8021dc <strnlen+0x1f>
+  8021d0:	48 83 c2 01          	add    $0x1,%rdx
+  8021d4:	48 39 d0             	cmp    %rdx,%rax
+  8021d7:	75 f1                	jne    8021ca <strnlen+0xd>
+  8021d9:	eb 04                	jmp    8021df <strnlen+0x22>
+  8021db:	c3                   	ret
+  8021dc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8021df:	c3                   	ret
+
+00000000008021e0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8021e0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8021e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8021ec:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8021ef:	48 83 c2 01          	add    $0x1,%rdx
+  8021f3:	84 c9                	test   %cl,%cl
+  8021f5:	75 f1                	jne    8021e8 <strcpy+0x8>
+        ;
+    return res;
+}
+  8021f7:	c3                   	ret
+
+00000000008021f8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8021f8:	55                   	push   %rbp
+  8021f9:	48 89 e5             	mov    %rsp,%rbp
+  8021fc:	41 54                	push   %r12
+  8021fe:	53                   	push   %rbx
+  8021ff:	48 89 fb             	mov    %rdi,%rbx
+  802202:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802205:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  80220c:	00 00 00 
+  80220f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802211:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802215:	4c 89 e6             	mov    %r12,%rsi
+  802218:	48 b8 e0 21 80 00 00 	movabs $0x8021e0,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+    return dst;
+}
+  802224:	48 89 d8             	mov    %rbx,%rax
+  802227:	5b                   	pop    %rbx
+  802228:	41 5c                	pop    %r12
+  80222a:	5d                   	pop    %rbp
+  80222b:	c3                   	ret
+
+000000000080222c <toupper>:
+
+int
+toupper(int ch) {
+  80222c:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80222e:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802231:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802234:	83 f9 1a             	cmp    $0x1a,%ecx
+  802237:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80223a:	c3                   	ret
+
+000000000080223b <tolower>:
+
+int
+tolower(int ch) {
+  80223b:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80223d:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802240:	8d 57 20             	lea    0x20(%rdi),%edx
+  802243:	83 f9 1a             	cmp    $0x1a,%ecx
+  802246:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802249:	c3                   	ret
+
+000000000080224a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80224a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80224d:	48 85 d2             	test   %rdx,%rdx
+  802250:	74 1f                	je     802271 <strncpy+0x27>
+  802252:	48 01 fa             	add    %rdi,%rdx
+  802255:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802258:	48 83 c1 01          	add    $0x1,%rcx
+  80225c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802260:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802264:	41 80 f8 01          	cmp    $0x1,%r8b
+  802268:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80226c:	48 39 ca             	cmp    %rcx,%rdx
+  80226f:	75 e7                	jne    802258 <strncpy+0xe>
+    }
+    return ret;
+}
+  802271:	c3                   	ret
+
+0000000000802272 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802272:	48 89 f8             	mov    %rdi,%rax
+  802275:	48 85 d2             	test   %rdx,%rdx
+  802278:	74 24                	je     80229e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80227a:	48 83 ea 01          	sub    $0x1,%rdx
+  80227e:	74 1b                	je     80229b <strlcpy+0x29>
+  802280:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802284:	0f b6 16             	movzbl (%rsi),%edx
+  802287:	84 d2                	test   %dl,%dl
+  802289:	74 10                	je     80229b <strlcpy+0x29>
+            *dst++ = *src++;
+  80228b:	48 83 c6 01          	add    $0x1,%rsi
+  80228f:	48 83 c0 01          	add    $0x1,%rax
+  802293:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802296:	48 39 c8             	cmp    %rcx,%rax
+  802299:	75 e9                	jne    802284 <strlcpy+0x12>
+        *dst = '\0';
+  80229b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80229e:	48 29 f8             	sub    %rdi,%rax
+}
+  8022a1:	c3                   	ret
+
+00000000008022a2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8022a2:	0f b6 07             	movzbl (%rdi),%eax
+  8022a5:	84 c0                	test   %al,%al
+  8022a7:	74 13                	je     8022bc <strcmp+0x1a>
+  8022a9:	38 06                	cmp    %al,(%rsi)
+  8022ab:	75 0f                	jne    8022bc <strcmp+0x1a>
+  8022ad:	48 83 c7 01          	add    $0x1,%rdi
+  8022b1:	48 83 c6 01          	add    $0x1,%rsi
+  8022b5:	0f b6 07             	movzbl (%rdi),%eax
+  8022b8:	84 c0                	test   %al,%al
+  8022ba:	75 ed                	jne    8022a9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022bc:	0f b6 c0             	movzbl %al,%eax
+  8022bf:	0f b6 16             	movzbl (%rsi),%edx
+  8022c2:	29 d0                	sub    %edx,%eax
+}
+  8022c4:	c3                   	ret
+
+00000000008022c5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8022c5:	48 85 d2             	test   %rdx,%rdx
+  8022c8:	74 1f                	je     8022e9 <strncmp+0x24>
+  8022ca:	0f b6 07             	movzbl (%rdi),%eax
+  8022cd:	84 c0                	test   %al,%al
+  8022cf:	74 1e                	je     8022ef <strncmp+0x2a>
+  8022d1:	3a 06                	cmp    (%rsi),%al
+  8022d3:	75 1a                	jne    8022ef <strncmp+0x2a>
+  8022d5:	48 83 c7 01          	add    $0x1,%rdi
+  8022d9:	48 83 c6 01          	add    $0x1,%rsi
+  8022dd:	48 83 ea 01          	sub    $0x1,%rdx
+  8022e1:	75 e7                	jne    8022ca <strncmp+0x5>
+
+    if (!n) return 0;
+  8022e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e8:	c3                   	ret
+  8022e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ee:	c3                   	ret
+  8022ef:	48 85 d2             	test   %rdx,%rdx
+  8022f2:	74 09                	je     8022fd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022f4:	0f b6 07             	movzbl (%rdi),%eax
+  8022f7:	0f b6 16             	movzbl (%rsi),%edx
+  8022fa:	29 d0                	sub    %edx,%eax
+  8022fc:	c3                   	ret
+    if (!n) return 0;
+  8022fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802302:	c3                   	ret
+
+0000000000802303 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802303:	0f b6 17             	movzbl (%rdi),%edx
+  802306:	84 d2                	test   %dl,%dl
+  802308:	74 18                	je     802322 <strchr+0x1f>
+        if (*str == c) {
+  80230a:	0f be d2             	movsbl %dl,%edx
+  80230d:	39 f2                	cmp    %esi,%edx
+  80230f:	74 17                	je     802328 <strchr+0x25>
+    for (; *str; str++) {
+  802311:	48 83 c7 01          	add    $0x1,%rdi
+  802315:	0f b6 17             	movzbl (%rdi),%edx
+  802318:	84 d2                	test   %dl,%dl
+  80231a:	75 ee                	jne    80230a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80231c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802321:	c3                   	ret
+  802322:	b8 00 00 00 00       	mov    $0x0,%eax
+  802327:	c3                   	ret
+  802328:	48 89 f8             	mov    %rdi,%rax
+}
+  80232b:	c3                   	ret
+
+000000000080232c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80232c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80232f:	0f b6 17             	movzbl (%rdi),%edx
+  802332:	84 d2                	test   %dl,%dl
+  802334:	74 13                	je     802349 <strfind+0x1d>
+  802336:	0f be d2             	movsbl %dl,%edx
+  802339:	39 f2                	cmp    %esi,%edx
+  80233b:	74 0b                	je     802348 <strfind+0x1c>
+  80233d:	48 83 c0 01          	add    $0x1,%rax
+  802341:	0f b6 10             	movzbl (%rax),%edx
+  802344:	84 d2                	test   %dl,%dl
+  802346:	75 ee                	jne    802336 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802348:	c3                   	ret
+  802349:	c3                   	ret
+
+000000000080234a <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80234a:	48 39 f7             	cmp    %rsi,%rdi
+  80234d:	74 65                	je     8023b4 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80234f:	55                   	push   %rbp
+  802350:	48 89 e5             	mov    %rsp,%rbp
+  802353:	41 57                	push   %r15
+  802355:	41 56                	push   %r14
+  802357:	41 55                	push   %r13
+  802359:	41 54                	push   %r12
+  80235b:	53                   	push   %rbx
+  80235c:	48 83 ec 18          	sub    $0x18,%rsp
+  802360:	48 89 fb             	mov    %rdi,%rbx
+  802363:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802366:	49 bf 3b 22 80 00 00 	movabs $0x80223b,%r15
+  80236d:	00 00 00 
+  802370:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802374:	41 0f b6 fd          	movzbl %r13b,%edi
+  802378:	41 ff d7             	call   *%r15
+  80237b:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80237e:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802383:	41 0f b6 fe          	movzbl %r14b,%edi
+  802387:	41 ff d7             	call   *%r15
+  80238a:	89 c2                	mov    %eax,%edx
+  80238c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80238f:	29 d0                	sub    %edx,%eax
+  802391:	75 12                	jne    8023a5 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802393:	48 83 c3 01          	add    $0x1,%rbx
+  802397:	45 84 ed             	test   %r13b,%r13b
+  80239a:	74 09                	je     8023a5 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80239c:	49 83 c4 01          	add    $0x1,%r12
+  8023a0:	45 84 f6             	test   %r14b,%r14b
+  8023a3:	75 cb                	jne    802370 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8023a5:	48 83 c4 18          	add    $0x18,%rsp
+  8023a9:	5b                   	pop    %rbx
+  8023aa:	41 5c                	pop    %r12
+  8023ac:	41 5d                	pop    %r13
+  8023ae:	41 5e                	pop    %r14
+  8023b0:	41 5f                	pop    %r15
+  8023b2:	5d                   	pop    %rbp
+  8023b3:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023b9:	c3                   	ret
+
+00000000008023ba <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8023ba:	48 39 f7             	cmp    %rsi,%rdi
+  8023bd:	74 7d                	je     80243c <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8023bf:	55                   	push   %rbp
+  8023c0:	48 89 e5             	mov    %rsp,%rbp
+  8023c3:	41 57                	push   %r15
+  8023c5:	41 56                	push   %r14
+  8023c7:	41 55                	push   %r13
+  8023c9:	41 54                	push   %r12
+  8023cb:	53                   	push   %rbx
+  8023cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d0:	48 89 fb             	mov    %rdi,%rbx
+  8023d3:	49 89 f4             	mov    %rsi,%r12
+  8023d6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8023da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023de:	49 bf 3b 22 80 00 00 	movabs $0x80223b,%r15
+  8023e5:	00 00 00 
+    while (n--) {
+  8023e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ec:	48 39 c3             	cmp    %rax,%rbx
+  8023ef:	74 37                	je     802428 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023f1:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8023f5:	41 0f b6 fd          	movzbl %r13b,%edi
+  8023f9:	41 ff d7             	call   *%r15
+  8023fc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8023ff:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802404:	41 0f b6 fe          	movzbl %r14b,%edi
+  802408:	41 ff d7             	call   *%r15
+  80240b:	89 c2                	mov    %eax,%edx
+  80240d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802410:	29 d0                	sub    %edx,%eax
+  802412:	75 19                	jne    80242d <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802414:	48 83 c3 01          	add    $0x1,%rbx
+  802418:	45 84 ed             	test   %r13b,%r13b
+  80241b:	74 10                	je     80242d <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80241d:	49 83 c4 01          	add    $0x1,%r12
+  802421:	45 84 f6             	test   %r14b,%r14b
+  802424:	75 c2                	jne    8023e8 <strncasecmp+0x2e>
+  802426:	eb 05                	jmp    80242d <strncasecmp+0x73>
+  802428:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80242d:	48 83 c4 18          	add    $0x18,%rsp
+  802431:	5b                   	pop    %rbx
+  802432:	41 5c                	pop    %r12
+  802434:	41 5d                	pop    %r13
+  802436:	41 5e                	pop    %r14
+  802438:	41 5f                	pop    %r15
+  80243a:	5d                   	pop    %rbp
+  80243b:	c3                   	ret
+    if (p1 == p2) return 0;
+  80243c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802441:	c3                   	ret
+
+0000000000802442 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802442:	83 e7 df             	and    $0xffffffdf,%edi
+  802445:	83 ef 41             	sub    $0x41,%edi
+  802448:	83 ff 19             	cmp    $0x19,%edi
+  80244b:	0f 96 c0             	setbe  %al
+}
+  80244e:	c3                   	ret
+
+000000000080244f <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80244f:	83 ff 20             	cmp    $0x20,%edi
+  802452:	0f 94 c0             	sete   %al
+  802455:	83 ff 09             	cmp    $0x9,%edi
+  802458:	0f 94 c2             	sete   %dl
+  80245b:	09 d0                	or     %edx,%eax
+}
+  80245d:	c3                   	ret
+
+000000000080245e <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80245e:	55                   	push   %rbp
+  80245f:	48 89 e5             	mov    %rsp,%rbp
+  802462:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802464:	48 bf 5f 63 80 00 00 	movabs $0x80635f,%rdi
+  80246b:	00 00 00 
+  80246e:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+  80247a:	48 85 c0             	test   %rax,%rax
+  80247d:	0f 95 c0             	setne  %al
+}
+  802480:	5d                   	pop    %rbp
+  802481:	c3                   	ret
+
+0000000000802482 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802482:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802485:	48 89 f8             	mov    %rdi,%rax
+  802488:	48 f7 d8             	neg    %rax
+  80248b:	83 e0 07             	and    $0x7,%eax
+  80248e:	49 89 d1             	mov    %rdx,%r9
+  802491:	49 29 c1             	sub    %rax,%r9
+  802494:	78 36                	js     8024cc <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802496:	40 0f b6 c6          	movzbl %sil,%eax
+  80249a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8024a1:	01 01 01 
+  8024a4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8024a8:	40 f6 c7 07          	test   $0x7,%dil
+  8024ac:	75 38                	jne    8024e6 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8024ae:	4c 89 c9             	mov    %r9,%rcx
+  8024b1:	48 c1 f9 03          	sar    $0x3,%rcx
+  8024b5:	74 0c                	je     8024c3 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8024b7:	fc                   	cld
+  8024b8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8024bb:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8024bf:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8024c3:	4d 85 c9             	test   %r9,%r9
+  8024c6:	75 45                	jne    80250d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8024c8:	4c 89 c0             	mov    %r8,%rax
+  8024cb:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8024cc:	48 85 d2             	test   %rdx,%rdx
+  8024cf:	74 f7                	je     8024c8 <memset+0x46>
+  8024d1:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8024d4:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8024d7:	48 83 c0 01          	add    $0x1,%rax
+  8024db:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8024df:	48 39 c2             	cmp    %rax,%rdx
+  8024e2:	75 f3                	jne    8024d7 <memset+0x55>
+  8024e4:	eb e2                	jmp    8024c8 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8024e6:	40 f6 c7 01          	test   $0x1,%dil
+  8024ea:	74 06                	je     8024f2 <memset+0x70>
+  8024ec:	88 07                	mov    %al,(%rdi)
+  8024ee:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8024f2:	40 f6 c7 02          	test   $0x2,%dil
+  8024f6:	74 07                	je     8024ff <memset+0x7d>
+  8024f8:	66 89 07             	mov    %ax,(%rdi)
+  8024fb:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024ff:	40 f6 c7 04          	test   $0x4,%dil
+  802503:	74 a9                	je     8024ae <memset+0x2c>
+  802505:	89 07                	mov    %eax,(%rdi)
+  802507:	48 83 c7 04          	add    $0x4,%rdi
+  80250b:	eb a1                	jmp    8024ae <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80250d:	41 f6 c1 04          	test   $0x4,%r9b
+  802511:	74 06                	je     802519 <memset+0x97>
+  802513:	89 07                	mov    %eax,(%rdi)
+  802515:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802519:	41 f6 c1 02          	test   $0x2,%r9b
+  80251d:	74 07                	je     802526 <memset+0xa4>
+  80251f:	66 89 07             	mov    %ax,(%rdi)
+  802522:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802526:	41 f6 c1 01          	test   $0x1,%r9b
+  80252a:	74 9c                	je     8024c8 <memset+0x46>
+  80252c:	88 07                	mov    %al,(%rdi)
+  80252e:	eb 98                	jmp    8024c8 <memset+0x46>
+
+0000000000802530 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802530:	48 89 f8             	mov    %rdi,%rax
+  802533:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802536:	48 39 fe             	cmp    %rdi,%rsi
+  802539:	73 3b                	jae    802576 <memmove+0x46>
+  80253b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80253f:	48 39 d7             	cmp    %rdx,%rdi
+  802542:	73 32                	jae    802576 <memmove+0x46>
+        s += n;
+        d += n;
+  802544:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802548:	48 89 d6             	mov    %rdx,%rsi
+  80254b:	48 09 fe             	or     %rdi,%rsi
+  80254e:	48 09 ce             	or     %rcx,%rsi
+  802551:	40 f6 c6 07          	test   $0x7,%sil
+  802555:	75 12                	jne    802569 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802557:	48 83 ef 08          	sub    $0x8,%rdi
+  80255b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80255f:	48 c1 e9 03          	shr    $0x3,%rcx
+  802563:	fd                   	std
+  802564:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802567:	fc                   	cld
+  802568:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802569:	48 83 ef 01          	sub    $0x1,%rdi
+  80256d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802571:	fd                   	std
+  802572:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802574:	eb f1                	jmp    802567 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802576:	48 89 f2             	mov    %rsi,%rdx
+  802579:	48 09 c2             	or     %rax,%rdx
+  80257c:	48 09 ca             	or     %rcx,%rdx
+  80257f:	f6 c2 07             	test   $0x7,%dl
+  802582:	75 0c                	jne    802590 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802584:	48 c1 e9 03          	shr    $0x3,%rcx
+  802588:	48 89 c7             	mov    %rax,%rdi
+  80258b:	fc                   	cld
+  80258c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80258f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802590:	48 89 c7             	mov    %rax,%rdi
+  802593:	fc                   	cld
+  802594:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802596:	c3                   	ret
+
+0000000000802597 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802597:	55                   	push   %rbp
+  802598:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80259b:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+}
+  8025a7:	5d                   	pop    %rbp
+  8025a8:	c3                   	ret
+
+00000000008025a9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8025a9:	55                   	push   %rbp
+  8025aa:	48 89 e5             	mov    %rsp,%rbp
+  8025ad:	41 57                	push   %r15
+  8025af:	41 56                	push   %r14
+  8025b1:	41 55                	push   %r13
+  8025b3:	41 54                	push   %r12
+  8025b5:	53                   	push   %rbx
+  8025b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ba:	49 89 fe             	mov    %rdi,%r14
+  8025bd:	49 89 f7             	mov    %rsi,%r15
+  8025c0:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8025c3:	48 89 f7             	mov    %rsi,%rdi
+  8025c6:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  8025cd:	00 00 00 
+  8025d0:	ff d0                	call   *%rax
+  8025d2:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8025d5:	48 89 de             	mov    %rbx,%rsi
+  8025d8:	4c 89 f7             	mov    %r14,%rdi
+  8025db:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  8025e2:	00 00 00 
+  8025e5:	ff d0                	call   *%rax
+  8025e7:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025ea:	48 39 c3             	cmp    %rax,%rbx
+  8025ed:	74 36                	je     802625 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8025ef:	48 89 d8             	mov    %rbx,%rax
+  8025f2:	4c 29 e8             	sub    %r13,%rax
+  8025f5:	49 39 c4             	cmp    %rax,%r12
+  8025f8:	73 31                	jae    80262b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8025fa:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8025ff:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802603:	4c 89 fe             	mov    %r15,%rsi
+  802606:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  80260d:	00 00 00 
+  802610:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802612:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802616:	48 83 c4 08          	add    $0x8,%rsp
+  80261a:	5b                   	pop    %rbx
+  80261b:	41 5c                	pop    %r12
+  80261d:	41 5d                	pop    %r13
+  80261f:	41 5e                	pop    %r14
+  802621:	41 5f                	pop    %r15
+  802623:	5d                   	pop    %rbp
+  802624:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802625:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802629:	eb eb                	jmp    802616 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80262b:	48 83 eb 01          	sub    $0x1,%rbx
+  80262f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802633:	48 89 da             	mov    %rbx,%rdx
+  802636:	4c 89 fe             	mov    %r15,%rsi
+  802639:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802645:	49 01 de             	add    %rbx,%r14
+  802648:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80264d:	eb c3                	jmp    802612 <strlcat+0x69>
+
+000000000080264f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80264f:	48 85 d2             	test   %rdx,%rdx
+  802652:	74 2d                	je     802681 <memcmp+0x32>
+  802654:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802659:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80265d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802662:	44 38 c1             	cmp    %r8b,%cl
+  802665:	75 0f                	jne    802676 <memcmp+0x27>
+    while (n-- > 0) {
+  802667:	48 83 c0 01          	add    $0x1,%rax
+  80266b:	48 39 c2             	cmp    %rax,%rdx
+  80266e:	75 e9                	jne    802659 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802670:	b8 00 00 00 00       	mov    $0x0,%eax
+  802675:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802676:	0f b6 c1             	movzbl %cl,%eax
+  802679:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80267d:	44 29 c0             	sub    %r8d,%eax
+  802680:	c3                   	ret
+    return 0;
+  802681:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802686:	c3                   	ret
+
+0000000000802687 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802687:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80268b:	48 39 c7             	cmp    %rax,%rdi
+  80268e:	73 0f                	jae    80269f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802690:	40 38 37             	cmp    %sil,(%rdi)
+  802693:	74 0e                	je     8026a3 <memfind+0x1c>
+    for (; src < end; src++) {
+  802695:	48 83 c7 01          	add    $0x1,%rdi
+  802699:	48 39 f8             	cmp    %rdi,%rax
+  80269c:	75 f2                	jne    802690 <memfind+0x9>
+  80269e:	c3                   	ret
+  80269f:	48 89 f8             	mov    %rdi,%rax
+  8026a2:	c3                   	ret
+  8026a3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8026a6:	c3                   	ret
+
+00000000008026a7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8026a7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8026aa:	0f b6 37             	movzbl (%rdi),%esi
+  8026ad:	40 80 fe 20          	cmp    $0x20,%sil
+  8026b1:	74 06                	je     8026b9 <strtol+0x12>
+  8026b3:	40 80 fe 09          	cmp    $0x9,%sil
+  8026b7:	75 13                	jne    8026cc <strtol+0x25>
+  8026b9:	48 83 c7 01          	add    $0x1,%rdi
+  8026bd:	0f b6 37             	movzbl (%rdi),%esi
+  8026c0:	40 80 fe 20          	cmp    $0x20,%sil
+  8026c4:	74 f3                	je     8026b9 <strtol+0x12>
+  8026c6:	40 80 fe 09          	cmp    $0x9,%sil
+  8026ca:	74 ed                	je     8026b9 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8026cc:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8026cf:	83 e0 fd             	and    $0xfffffffd,%eax
+  8026d2:	3c 01                	cmp    $0x1,%al
+  8026d4:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026d8:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8026de:	75 0f                	jne    8026ef <strtol+0x48>
+  8026e0:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8026e3:	74 14                	je     8026f9 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8026e5:	85 d2                	test   %edx,%edx
+  8026e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026ec:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8026ef:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8026f4:	4c 63 ca             	movslq %edx,%r9
+  8026f7:	eb 36                	jmp    80272f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026f9:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8026fd:	74 0f                	je     80270e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8026ff:	85 d2                	test   %edx,%edx
+  802701:	75 ec                	jne    8026ef <strtol+0x48>
+        s++;
+  802703:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802707:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80270c:	eb e1                	jmp    8026ef <strtol+0x48>
+        s += 2;
+  80270e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802712:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802717:	eb d6                	jmp    8026ef <strtol+0x48>
+            dig -= '0';
+  802719:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80271c:	44 0f b6 c1          	movzbl %cl,%r8d
+  802720:	41 39 d0             	cmp    %edx,%r8d
+  802723:	7d 21                	jge    802746 <strtol+0x9f>
+        val = val * base + dig;
+  802725:	49 0f af c1          	imul   %r9,%rax
+  802729:	0f b6 c9             	movzbl %cl,%ecx
+  80272c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80272f:	48 83 c7 01          	add    $0x1,%rdi
+  802733:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802737:	80 f9 39             	cmp    $0x39,%cl
+  80273a:	76 dd                	jbe    802719 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80273c:	80 f9 7b             	cmp    $0x7b,%cl
+  80273f:	77 05                	ja     802746 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802741:	83 e9 57             	sub    $0x57,%ecx
+  802744:	eb d6                	jmp    80271c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802746:	4d 85 d2             	test   %r10,%r10
+  802749:	74 03                	je     80274e <strtol+0xa7>
+  80274b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80274e:	48 89 c2             	mov    %rax,%rdx
+  802751:	48 f7 da             	neg    %rdx
+  802754:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802758:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80275c:	c3                   	ret
+
+000000000080275d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80275d:	55                   	push   %rbp
+  80275e:	48 89 e5             	mov    %rsp,%rbp
+  802761:	53                   	push   %rbx
+  802762:	48 89 fa             	mov    %rdi,%rdx
+  802765:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802768:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80276d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802772:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802777:	be 00 00 00 00       	mov    $0x0,%esi
+  80277c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802782:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802788:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80278a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80278e:	c9                   	leave
+  80278f:	c3                   	ret
+
+0000000000802790 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802790:	55                   	push   %rbp
+  802791:	48 89 e5             	mov    %rsp,%rbp
+  802794:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802795:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80279a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027bf:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027c5:	c9                   	leave
+  8027c6:	c3                   	ret
+
+00000000008027c7 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8027c7:	55                   	push   %rbp
+  8027c8:	48 89 e5             	mov    %rsp,%rbp
+  8027cb:	53                   	push   %rbx
+  8027cc:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027cf:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027f4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8027f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027fa:	c9                   	leave
+  8027fb:	c3                   	ret
+
+00000000008027fc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8027fc:	55                   	push   %rbp
+  8027fd:	48 89 e5             	mov    %rsp,%rbp
+  802800:	53                   	push   %rbx
+  802801:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802805:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802808:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80280d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802812:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802817:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80281c:	be 00 00 00 00       	mov    $0x0,%esi
+  802821:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802827:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80282d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80282f:	48 85 c0             	test   %rax,%rax
+  802832:	7f 06                	jg     80283a <sys_env_destroy+0x3e>
+}
+  802834:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80283a:	49 89 c0             	mov    %rax,%r8
+  80283d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802842:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802849:	00 00 00 
+  80284c:	be 27 00 00 00       	mov    $0x27,%esi
+  802851:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802858:	00 00 00 
+  80285b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802860:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802867:	00 00 00 
+  80286a:	41 ff d1             	call   *%r9
+
+000000000080286d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80286d:	55                   	push   %rbp
+  80286e:	48 89 e5             	mov    %rsp,%rbp
+  802871:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802872:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802877:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802881:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802886:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80288b:	be 00 00 00 00       	mov    $0x0,%esi
+  802890:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802896:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80289c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80289e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028a2:	c9                   	leave
+  8028a3:	c3                   	ret
+
+00000000008028a4 <sys_yield>:
+
+void
+sys_yield(void) {
+  8028a4:	55                   	push   %rbp
+  8028a5:	48 89 e5             	mov    %rsp,%rbp
+  8028a8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028d3:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028d9:	c9                   	leave
+  8028da:	c3                   	ret
+
+00000000008028db <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8028db:	55                   	push   %rbp
+  8028dc:	48 89 e5             	mov    %rsp,%rbp
+  8028df:	53                   	push   %rbx
+  8028e0:	48 89 fa             	mov    %rdi,%rdx
+  8028e3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028e6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028eb:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8028f2:	00 00 00 
+  8028f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802905:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80290b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80290d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802911:	c9                   	leave
+  802912:	c3                   	ret
+
+0000000000802913 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802913:	55                   	push   %rbp
+  802914:	48 89 e5             	mov    %rsp,%rbp
+  802917:	53                   	push   %rbx
+  802918:	49 89 f8             	mov    %rdi,%r8
+  80291b:	48 89 d3             	mov    %rdx,%rbx
+  80291e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802921:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802926:	4c 89 c2             	mov    %r8,%rdx
+  802929:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80292c:	be 00 00 00 00       	mov    $0x0,%esi
+  802931:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802937:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80293d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80293f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802943:	c9                   	leave
+  802944:	c3                   	ret
+
+0000000000802945 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802945:	55                   	push   %rbp
+  802946:	48 89 e5             	mov    %rsp,%rbp
+  802949:	53                   	push   %rbx
+  80294a:	48 83 ec 08          	sub    $0x8,%rsp
+  80294e:	89 f8                	mov    %edi,%eax
+  802950:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802953:	48 63 f9             	movslq %ecx,%rdi
+  802956:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802959:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80295e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802961:	be 00 00 00 00       	mov    $0x0,%esi
+  802966:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80296c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802972:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802974:	48 85 c0             	test   %rax,%rax
+  802977:	7f 06                	jg     80297f <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802979:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80297f:	49 89 c0             	mov    %rax,%r8
+  802982:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802987:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  80298e:	00 00 00 
+  802991:	be 27 00 00 00       	mov    $0x27,%esi
+  802996:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  80299d:	00 00 00 
+  8029a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a5:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  8029ac:	00 00 00 
+  8029af:	41 ff d1             	call   *%r9
+
+00000000008029b2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8029b2:	55                   	push   %rbp
+  8029b3:	48 89 e5             	mov    %rsp,%rbp
+  8029b6:	53                   	push   %rbx
+  8029b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029bb:	89 f8                	mov    %edi,%eax
+  8029bd:	49 89 f2             	mov    %rsi,%r10
+  8029c0:	48 89 cf             	mov    %rcx,%rdi
+  8029c3:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8029c6:	48 63 da             	movslq %edx,%rbx
+  8029c9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029cc:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d1:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029d4:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8029d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029df:	48 85 c0             	test   %rax,%rax
+  8029e2:	7f 06                	jg     8029ea <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8029e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e8:	c9                   	leave
+  8029e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029ea:	49 89 c0             	mov    %rax,%r8
+  8029ed:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8029f2:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  8029f9:	00 00 00 
+  8029fc:	be 27 00 00 00       	mov    $0x27,%esi
+  802a01:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802a08:	00 00 00 
+  802a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a10:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802a17:	00 00 00 
+  802a1a:	41 ff d1             	call   *%r9
+
+0000000000802a1d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802a1d:	55                   	push   %rbp
+  802a1e:	48 89 e5             	mov    %rsp,%rbp
+  802a21:	53                   	push   %rbx
+  802a22:	48 83 ec 08          	sub    $0x8,%rsp
+  802a26:	48 89 f1             	mov    %rsi,%rcx
+  802a29:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802a2c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a2f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a34:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a39:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a44:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a4a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a4c:	48 85 c0             	test   %rax,%rax
+  802a4f:	7f 06                	jg     802a57 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802a51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a55:	c9                   	leave
+  802a56:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a57:	49 89 c0             	mov    %rax,%r8
+  802a5a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a5f:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802a66:	00 00 00 
+  802a69:	be 27 00 00 00       	mov    $0x27,%esi
+  802a6e:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802a75:	00 00 00 
+  802a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7d:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802a84:	00 00 00 
+  802a87:	41 ff d1             	call   *%r9
+
+0000000000802a8a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a8a:	55                   	push   %rbp
+  802a8b:	48 89 e5             	mov    %rsp,%rbp
+  802a8e:	53                   	push   %rbx
+  802a8f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802a93:	48 63 ce             	movslq %esi,%rcx
+  802a96:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a99:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa8:	be 00 00 00 00       	mov    $0x0,%esi
+  802aad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802abb:	48 85 c0             	test   %rax,%rax
+  802abe:	7f 06                	jg     802ac6 <sys_env_set_status+0x3c>
+}
+  802ac0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac4:	c9                   	leave
+  802ac5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ac6:	49 89 c0             	mov    %rax,%r8
+  802ac9:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802ace:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802ad5:	00 00 00 
+  802ad8:	be 27 00 00 00       	mov    $0x27,%esi
+  802add:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802ae4:	00 00 00 
+  802ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aec:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802af3:	00 00 00 
+  802af6:	41 ff d1             	call   *%r9
+
+0000000000802af9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802af9:	55                   	push   %rbp
+  802afa:	48 89 e5             	mov    %rsp,%rbp
+  802afd:	53                   	push   %rbx
+  802afe:	48 83 ec 08          	sub    $0x8,%rsp
+  802b02:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802b05:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b08:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b17:	be 00 00 00 00       	mov    $0x0,%esi
+  802b1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b22:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b28:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b2a:	48 85 c0             	test   %rax,%rax
+  802b2d:	7f 06                	jg     802b35 <sys_env_set_trapframe+0x3c>
+}
+  802b2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b33:	c9                   	leave
+  802b34:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b35:	49 89 c0             	mov    %rax,%r8
+  802b38:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802b3d:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802b44:	00 00 00 
+  802b47:	be 27 00 00 00       	mov    $0x27,%esi
+  802b4c:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802b53:	00 00 00 
+  802b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5b:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802b62:	00 00 00 
+  802b65:	41 ff d1             	call   *%r9
+
+0000000000802b68 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802b68:	55                   	push   %rbp
+  802b69:	48 89 e5             	mov    %rsp,%rbp
+  802b6c:	53                   	push   %rbx
+  802b6d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b71:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802b74:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b77:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b81:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b86:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b91:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b97:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b99:	48 85 c0             	test   %rax,%rax
+  802b9c:	7f 06                	jg     802ba4 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802b9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ba2:	c9                   	leave
+  802ba3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ba4:	49 89 c0             	mov    %rax,%r8
+  802ba7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802bac:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802bb3:	00 00 00 
+  802bb6:	be 27 00 00 00       	mov    $0x27,%esi
+  802bbb:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802bc2:	00 00 00 
+  802bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bca:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802bd1:	00 00 00 
+  802bd4:	41 ff d1             	call   *%r9
+
+0000000000802bd7 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802bd7:	55                   	push   %rbp
+  802bd8:	48 89 e5             	mov    %rsp,%rbp
+  802bdb:	53                   	push   %rbx
+  802bdc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802be0:	40 0f b6 ce          	movzbl %sil,%ecx
+  802be4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802be7:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bf6:	be 00 00 00 00       	mov    $0x0,%esi
+  802bfb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c07:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c09:	48 85 c0             	test   %rax,%rax
+  802c0c:	7f 06                	jg     802c14 <sys_env_set_reclaim+0x3d>
+}
+  802c0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c12:	c9                   	leave
+  802c13:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c14:	49 89 c0             	mov    %rax,%r8
+  802c17:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802c1c:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802c23:	00 00 00 
+  802c26:	be 27 00 00 00       	mov    $0x27,%esi
+  802c2b:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802c32:	00 00 00 
+  802c35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3a:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802c41:	00 00 00 
+  802c44:	41 ff d1             	call   *%r9
+
+0000000000802c47 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802c47:	55                   	push   %rbp
+  802c48:	48 89 e5             	mov    %rsp,%rbp
+  802c4b:	53                   	push   %rbx
+  802c4c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802c50:	48 63 ce             	movslq %esi,%rcx
+  802c53:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c56:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c60:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c65:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c76:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c78:	48 85 c0             	test   %rax,%rax
+  802c7b:	7f 06                	jg     802c83 <sys_env_set_nice+0x3c>
+}
+  802c7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c81:	c9                   	leave
+  802c82:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c83:	49 89 c0             	mov    %rax,%r8
+  802c86:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802c8b:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802c92:	00 00 00 
+  802c95:	be 27 00 00 00       	mov    $0x27,%esi
+  802c9a:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802ca1:	00 00 00 
+  802ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca9:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802cb0:	00 00 00 
+  802cb3:	41 ff d1             	call   *%r9
+
+0000000000802cb6 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802cb6:	55                   	push   %rbp
+  802cb7:	48 89 e5             	mov    %rsp,%rbp
+  802cba:	53                   	push   %rbx
+  802cbb:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cbe:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ccd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cd2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cdd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ce3:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ce5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce9:	c9                   	leave
+  802cea:	c3                   	ret
+
+0000000000802ceb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ceb:	55                   	push   %rbp
+  802cec:	48 89 e5             	mov    %rsp,%rbp
+  802cef:	53                   	push   %rbx
+  802cf0:	89 f8                	mov    %edi,%eax
+  802cf2:	49 89 f1             	mov    %rsi,%r9
+  802cf5:	48 89 d3             	mov    %rdx,%rbx
+  802cf8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802cfb:	49 63 f0             	movslq %r8d,%rsi
+  802cfe:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d01:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d06:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d15:	cd 30                	int    $0x30
+}
+  802d17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d1b:	c9                   	leave
+  802d1c:	c3                   	ret
+
+0000000000802d1d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d1d:	55                   	push   %rbp
+  802d1e:	48 89 e5             	mov    %rsp,%rbp
+  802d21:	53                   	push   %rbx
+  802d22:	89 f8                	mov    %edi,%eax
+  802d24:	49 89 f1             	mov    %rsi,%r9
+  802d27:	48 89 d3             	mov    %rdx,%rbx
+  802d2a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d2d:	49 63 f0             	movslq %r8d,%rsi
+  802d30:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d33:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d38:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d47:	cd 30                	int    $0x30
+}
+  802d49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4d:	c9                   	leave
+  802d4e:	c3                   	ret
+
+0000000000802d4f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d4f:	55                   	push   %rbp
+  802d50:	48 89 e5             	mov    %rsp,%rbp
+  802d53:	53                   	push   %rbx
+  802d54:	48 83 ec 08          	sub    $0x8,%rsp
+  802d58:	89 f8                	mov    %edi,%eax
+  802d5a:	49 89 f2             	mov    %rsi,%r10
+  802d5d:	48 89 d3             	mov    %rdx,%rbx
+  802d60:	48 89 cf             	mov    %rcx,%rdi
+  802d63:	44 89 c6             	mov    %r8d,%esi
+  802d66:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d69:	48 63 f6             	movslq %esi,%rsi
+  802d6c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d74:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d77:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d7b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d7d:	48 85 c0             	test   %rax,%rax
+  802d80:	7f 06                	jg     802d88 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d82:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d86:	c9                   	leave
+  802d87:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d88:	49 89 c0             	mov    %rax,%r8
+  802d8b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802d90:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802d97:	00 00 00 
+  802d9a:	be 27 00 00 00       	mov    $0x27,%esi
+  802d9f:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802da6:	00 00 00 
+  802da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dae:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802db5:	00 00 00 
+  802db8:	41 ff d1             	call   *%r9
+
+0000000000802dbb <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802dbb:	55                   	push   %rbp
+  802dbc:	48 89 e5             	mov    %rsp,%rbp
+  802dbf:	53                   	push   %rbx
+  802dc0:	48 83 ec 08          	sub    $0x8,%rsp
+  802dc4:	48 89 f1             	mov    %rsi,%rcx
+  802dc7:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802dca:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802dce:	48 8b 1a             	mov    (%rdx),%rbx
+  802dd1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dd4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dd9:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ddd:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802de1:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802de5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802de7:	48 85 c0             	test   %rax,%rax
+  802dea:	7f 06                	jg     802df2 <sys_ipc_call_short+0x37>
+}
+  802dec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802df0:	c9                   	leave
+  802df1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802df2:	49 89 c0             	mov    %rax,%r8
+  802df5:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802dfa:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802e01:	00 00 00 
+  802e04:	be 27 00 00 00       	mov    $0x27,%esi
+  802e09:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802e10:	00 00 00 
+  802e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e18:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802e1f:	00 00 00 
+  802e22:	41 ff d1             	call   *%r9
+
+0000000000802e25 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e25:	55                   	push   %rbp
+  802e26:	48 89 e5             	mov    %rsp,%rbp
+  802e29:	53                   	push   %rbx
+  802e2a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e2e:	89 f8                	mov    %edi,%eax
+  802e30:	49 89 f2             	mov    %rsi,%r10
+  802e33:	48 89 d3             	mov    %rdx,%rbx
+  802e36:	48 89 cf             	mov    %rcx,%rdi
+  802e39:	44 89 c6             	mov    %r8d,%esi
+  802e3c:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e3f:	48 63 f6             	movslq %esi,%rsi
+  802e42:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e45:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e4a:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e4d:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e51:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e53:	48 85 c0             	test   %rax,%rax
+  802e56:	7f 06                	jg     802e5e <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e5c:	c9                   	leave
+  802e5d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e5e:	49 89 c0             	mov    %rax,%r8
+  802e61:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802e66:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802e6d:	00 00 00 
+  802e70:	be 27 00 00 00       	mov    $0x27,%esi
+  802e75:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802e7c:	00 00 00 
+  802e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e84:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802e8b:	00 00 00 
+  802e8e:	41 ff d1             	call   *%r9
+
+0000000000802e91 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802e91:	55                   	push   %rbp
+  802e92:	48 89 e5             	mov    %rsp,%rbp
+  802e95:	53                   	push   %rbx
+  802e96:	48 83 ec 08          	sub    $0x8,%rsp
+  802e9a:	48 89 fa             	mov    %rdi,%rdx
+  802e9d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802ea0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ea5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eaf:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ec0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ec2:	48 85 c0             	test   %rax,%rax
+  802ec5:	7f 06                	jg     802ecd <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ec7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ecb:	c9                   	leave
+  802ecc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ecd:	49 89 c0             	mov    %rax,%r8
+  802ed0:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ed5:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  802edc:	00 00 00 
+  802edf:	be 27 00 00 00       	mov    $0x27,%esi
+  802ee4:	48 bf 87 63 80 00 00 	movabs $0x806387,%rdi
+  802eeb:	00 00 00 
+  802eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef3:	49 b9 59 17 80 00 00 	movabs $0x801759,%r9
+  802efa:	00 00 00 
+  802efd:	41 ff d1             	call   *%r9
+
+0000000000802f00 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802f00:	55                   	push   %rbp
+  802f01:	48 89 e5             	mov    %rsp,%rbp
+  802f04:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f05:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f19:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f23:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f29:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f2f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f31:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f35:	c9                   	leave
+  802f36:	c3                   	ret
+
+0000000000802f37 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802f37:	55                   	push   %rbp
+  802f38:	48 89 e5             	mov    %rsp,%rbp
+  802f3b:	53                   	push   %rbx
+  802f3c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f3f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f44:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f4e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f53:	be 00 00 00 00       	mov    $0x0,%esi
+  802f58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f64:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802f66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f6a:	c9                   	leave
+  802f6b:	c3                   	ret
+
+0000000000802f6c <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802f6c:	55                   	push   %rbp
+  802f6d:	48 89 e5             	mov    %rsp,%rbp
+  802f70:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f71:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f85:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f95:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f9b:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fa1:	c9                   	leave
+  802fa2:	c3                   	ret
+
+0000000000802fa3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fa3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802faa:	ff ff ff 
+  802fad:	48 01 f8             	add    %rdi,%rax
+  802fb0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802fb4:	c3                   	ret
+
+0000000000802fb5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fb5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802fbc:	ff ff ff 
+  802fbf:	48 01 f8             	add    %rdi,%rax
+  802fc2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802fc6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802fcc:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802fd0:	c3                   	ret
+
+0000000000802fd1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802fd1:	55                   	push   %rbp
+  802fd2:	48 89 e5             	mov    %rsp,%rbp
+  802fd5:	41 57                	push   %r15
+  802fd7:	41 56                	push   %r14
+  802fd9:	41 55                	push   %r13
+  802fdb:	41 54                	push   %r12
+  802fdd:	53                   	push   %rbx
+  802fde:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe2:	49 89 ff             	mov    %rdi,%r15
+  802fe5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802fea:	49 bd d1 44 80 00 00 	movabs $0x8044d1,%r13
+  802ff1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802ff4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802ffa:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802ffd:	48 89 df             	mov    %rbx,%rdi
+  803000:	41 ff d5             	call   *%r13
+  803003:	83 e0 04             	and    $0x4,%eax
+  803006:	74 17                	je     80301f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803008:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80300f:	4c 39 f3             	cmp    %r14,%rbx
+  803012:	75 e6                	jne    802ffa <fd_alloc+0x29>
+  803014:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80301a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80301f:	4d 89 27             	mov    %r12,(%r15)
+}
+  803022:	48 83 c4 08          	add    $0x8,%rsp
+  803026:	5b                   	pop    %rbx
+  803027:	41 5c                	pop    %r12
+  803029:	41 5d                	pop    %r13
+  80302b:	41 5e                	pop    %r14
+  80302d:	41 5f                	pop    %r15
+  80302f:	5d                   	pop    %rbp
+  803030:	c3                   	ret
+
+0000000000803031 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803031:	83 ff 1f             	cmp    $0x1f,%edi
+  803034:	77 39                	ja     80306f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803036:	55                   	push   %rbp
+  803037:	48 89 e5             	mov    %rsp,%rbp
+  80303a:	41 54                	push   %r12
+  80303c:	53                   	push   %rbx
+  80303d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803040:	48 63 df             	movslq %edi,%rbx
+  803043:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80304a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80304e:	48 89 df             	mov    %rbx,%rdi
+  803051:	48 b8 d1 44 80 00 00 	movabs $0x8044d1,%rax
+  803058:	00 00 00 
+  80305b:	ff d0                	call   *%rax
+  80305d:	a8 04                	test   $0x4,%al
+  80305f:	74 14                	je     803075 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803061:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803065:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80306a:	5b                   	pop    %rbx
+  80306b:	41 5c                	pop    %r12
+  80306d:	5d                   	pop    %rbp
+  80306e:	c3                   	ret
+        return -E_INVAL;
+  80306f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803074:	c3                   	ret
+        return -E_INVAL;
+  803075:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80307a:	eb ee                	jmp    80306a <fd_lookup+0x39>
+
+000000000080307c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80307c:	55                   	push   %rbp
+  80307d:	48 89 e5             	mov    %rsp,%rbp
+  803080:	41 54                	push   %r12
+  803082:	53                   	push   %rbx
+  803083:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803086:	48 b8 20 64 80 00 00 	movabs $0x806420,%rax
+  80308d:	00 00 00 
+  803090:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803097:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80309a:	39 3b                	cmp    %edi,(%rbx)
+  80309c:	74 47                	je     8030e5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80309e:	48 83 c0 08          	add    $0x8,%rax
+  8030a2:	48 8b 18             	mov    (%rax),%rbx
+  8030a5:	48 85 db             	test   %rbx,%rbx
+  8030a8:	75 f0                	jne    80309a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8030aa:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8030b1:	00 00 00 
+  8030b4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8030ba:	89 fa                	mov    %edi,%edx
+  8030bc:	48 bf 98 63 80 00 00 	movabs $0x806398,%rdi
+  8030c3:	00 00 00 
+  8030c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cb:	48 b9 a9 18 80 00 00 	movabs $0x8018a9,%rcx
+  8030d2:	00 00 00 
+  8030d5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8030d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8030dc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8030e0:	5b                   	pop    %rbx
+  8030e1:	41 5c                	pop    %r12
+  8030e3:	5d                   	pop    %rbp
+  8030e4:	c3                   	ret
+            return 0;
+  8030e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ea:	eb f0                	jmp    8030dc <dev_lookup+0x60>
+
+00000000008030ec <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8030ec:	55                   	push   %rbp
+  8030ed:	48 89 e5             	mov    %rsp,%rbp
+  8030f0:	41 55                	push   %r13
+  8030f2:	41 54                	push   %r12
+  8030f4:	53                   	push   %rbx
+  8030f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8030f9:	48 89 fb             	mov    %rdi,%rbx
+  8030fc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030ff:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803106:	ff ff ff 
+  803109:	48 01 df             	add    %rbx,%rdi
+  80310c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803110:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803114:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  80311b:	00 00 00 
+  80311e:	ff d0                	call   *%rax
+  803120:	41 89 c5             	mov    %eax,%r13d
+  803123:	85 c0                	test   %eax,%eax
+  803125:	78 06                	js     80312d <fd_close+0x41>
+  803127:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80312b:	74 1a                	je     803147 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80312d:	45 84 e4             	test   %r12b,%r12b
+  803130:	b8 00 00 00 00       	mov    $0x0,%eax
+  803135:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803139:	44 89 e8             	mov    %r13d,%eax
+  80313c:	48 83 c4 18          	add    $0x18,%rsp
+  803140:	5b                   	pop    %rbx
+  803141:	41 5c                	pop    %r12
+  803143:	41 5d                	pop    %r13
+  803145:	5d                   	pop    %rbp
+  803146:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803147:	8b 3b                	mov    (%rbx),%edi
+  803149:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80314d:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  803154:	00 00 00 
+  803157:	ff d0                	call   *%rax
+  803159:	41 89 c5             	mov    %eax,%r13d
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	78 1b                	js     80317b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803160:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803164:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803168:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80316e:	48 85 c0             	test   %rax,%rax
+  803171:	74 08                	je     80317b <fd_close+0x8f>
+  803173:	48 89 df             	mov    %rbx,%rdi
+  803176:	ff d0                	call   *%rax
+  803178:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80317b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803180:	48 89 de             	mov    %rbx,%rsi
+  803183:	bf 00 00 00 00       	mov    $0x0,%edi
+  803188:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  80318f:	00 00 00 
+  803192:	ff d0                	call   *%rax
+    return res;
+  803194:	eb a3                	jmp    803139 <fd_close+0x4d>
+
+0000000000803196 <close>:
+
+int
+close(int fdnum) {
+  803196:	55                   	push   %rbp
+  803197:	48 89 e5             	mov    %rsp,%rbp
+  80319a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80319e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031a2:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  8031a9:	00 00 00 
+  8031ac:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031ae:	85 c0                	test   %eax,%eax
+  8031b0:	78 15                	js     8031c7 <close+0x31>
+
+    return fd_close(fd, 1);
+  8031b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8031b7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031bb:	48 b8 ec 30 80 00 00 	movabs $0x8030ec,%rax
+  8031c2:	00 00 00 
+  8031c5:	ff d0                	call   *%rax
+}
+  8031c7:	c9                   	leave
+  8031c8:	c3                   	ret
+
+00000000008031c9 <close_all>:
+
+void
+close_all(void) {
+  8031c9:	55                   	push   %rbp
+  8031ca:	48 89 e5             	mov    %rsp,%rbp
+  8031cd:	41 54                	push   %r12
+  8031cf:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8031d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031d5:	49 bc 96 31 80 00 00 	movabs $0x803196,%r12
+  8031dc:	00 00 00 
+  8031df:	89 df                	mov    %ebx,%edi
+  8031e1:	41 ff d4             	call   *%r12
+  8031e4:	83 c3 01             	add    $0x1,%ebx
+  8031e7:	83 fb 20             	cmp    $0x20,%ebx
+  8031ea:	75 f3                	jne    8031df <close_all+0x16>
+}
+  8031ec:	5b                   	pop    %rbx
+  8031ed:	41 5c                	pop    %r12
+  8031ef:	5d                   	pop    %rbp
+  8031f0:	c3                   	ret
+
+00000000008031f1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8031f1:	55                   	push   %rbp
+  8031f2:	48 89 e5             	mov    %rsp,%rbp
+  8031f5:	41 57                	push   %r15
+  8031f7:	41 56                	push   %r14
+  8031f9:	41 55                	push   %r13
+  8031fb:	41 54                	push   %r12
+  8031fd:	53                   	push   %rbx
+  8031fe:	48 83 ec 18          	sub    $0x18,%rsp
+  803202:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803205:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803209:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  803210:	00 00 00 
+  803213:	ff d0                	call   *%rax
+  803215:	89 c3                	mov    %eax,%ebx
+  803217:	85 c0                	test   %eax,%eax
+  803219:	0f 88 b8 00 00 00    	js     8032d7 <dup+0xe6>
+    close(newfdnum);
+  80321f:	44 89 e7             	mov    %r12d,%edi
+  803222:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  803229:	00 00 00 
+  80322c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80322e:	4d 63 ec             	movslq %r12d,%r13
+  803231:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803238:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80323c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803240:	4c 89 ff             	mov    %r15,%rdi
+  803243:	49 be b5 2f 80 00 00 	movabs $0x802fb5,%r14
+  80324a:	00 00 00 
+  80324d:	41 ff d6             	call   *%r14
+  803250:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803253:	4c 89 ef             	mov    %r13,%rdi
+  803256:	41 ff d6             	call   *%r14
+  803259:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80325c:	48 89 df             	mov    %rbx,%rdi
+  80325f:	48 b8 d1 44 80 00 00 	movabs $0x8044d1,%rax
+  803266:	00 00 00 
+  803269:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80326b:	a8 04                	test   $0x4,%al
+  80326d:	74 2b                	je     80329a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80326f:	41 89 c1             	mov    %eax,%r9d
+  803272:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803278:	4c 89 f1             	mov    %r14,%rcx
+  80327b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803280:	48 89 de             	mov    %rbx,%rsi
+  803283:	bf 00 00 00 00       	mov    $0x0,%edi
+  803288:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  80328f:	00 00 00 
+  803292:	ff d0                	call   *%rax
+  803294:	89 c3                	mov    %eax,%ebx
+  803296:	85 c0                	test   %eax,%eax
+  803298:	78 4e                	js     8032e8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80329a:	4c 89 ff             	mov    %r15,%rdi
+  80329d:	48 b8 d1 44 80 00 00 	movabs $0x8044d1,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+  8032a9:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8032ac:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032b2:	4c 89 e9             	mov    %r13,%rcx
+  8032b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ba:	4c 89 fe             	mov    %r15,%rsi
+  8032bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c2:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+  8032ce:	89 c3                	mov    %eax,%ebx
+  8032d0:	85 c0                	test   %eax,%eax
+  8032d2:	78 14                	js     8032e8 <dup+0xf7>
+
+    return newfdnum;
+  8032d4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8032d7:	89 d8                	mov    %ebx,%eax
+  8032d9:	48 83 c4 18          	add    $0x18,%rsp
+  8032dd:	5b                   	pop    %rbx
+  8032de:	41 5c                	pop    %r12
+  8032e0:	41 5d                	pop    %r13
+  8032e2:	41 5e                	pop    %r14
+  8032e4:	41 5f                	pop    %r15
+  8032e6:	5d                   	pop    %rbp
+  8032e7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8032e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032ed:	4c 89 ee             	mov    %r13,%rsi
+  8032f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f5:	49 bc 1d 2a 80 00 00 	movabs $0x802a1d,%r12
+  8032fc:	00 00 00 
+  8032ff:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803302:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803307:	4c 89 f6             	mov    %r14,%rsi
+  80330a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330f:	41 ff d4             	call   *%r12
+    return res;
+  803312:	eb c3                	jmp    8032d7 <dup+0xe6>
+
+0000000000803314 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803314:	55                   	push   %rbp
+  803315:	48 89 e5             	mov    %rsp,%rbp
+  803318:	41 56                	push   %r14
+  80331a:	41 55                	push   %r13
+  80331c:	41 54                	push   %r12
+  80331e:	53                   	push   %rbx
+  80331f:	48 83 ec 10          	sub    $0x10,%rsp
+  803323:	89 fb                	mov    %edi,%ebx
+  803325:	49 89 f4             	mov    %rsi,%r12
+  803328:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80332b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80332f:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  803336:	00 00 00 
+  803339:	ff d0                	call   *%rax
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	78 4c                	js     80338b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80333f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803343:	41 8b 3e             	mov    (%r14),%edi
+  803346:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80334a:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+  803356:	85 c0                	test   %eax,%eax
+  803358:	78 35                	js     80338f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80335a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80335e:	83 e0 03             	and    $0x3,%eax
+  803361:	83 f8 01             	cmp    $0x1,%eax
+  803364:	74 2d                	je     803393 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803366:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80336a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80336e:	48 85 c0             	test   %rax,%rax
+  803371:	74 56                	je     8033c9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803373:	4c 89 ea             	mov    %r13,%rdx
+  803376:	4c 89 e6             	mov    %r12,%rsi
+  803379:	4c 89 f7             	mov    %r14,%rdi
+  80337c:	ff d0                	call   *%rax
+}
+  80337e:	48 83 c4 10          	add    $0x10,%rsp
+  803382:	5b                   	pop    %rbx
+  803383:	41 5c                	pop    %r12
+  803385:	41 5d                	pop    %r13
+  803387:	41 5e                	pop    %r14
+  803389:	5d                   	pop    %rbp
+  80338a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80338b:	48 98                	cltq
+  80338d:	eb ef                	jmp    80337e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80338f:	48 98                	cltq
+  803391:	eb eb                	jmp    80337e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803393:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80339a:	00 00 00 
+  80339d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8033a3:	89 da                	mov    %ebx,%edx
+  8033a5:	48 bf d9 63 80 00 00 	movabs $0x8063d9,%rdi
+  8033ac:	00 00 00 
+  8033af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b4:	48 b9 a9 18 80 00 00 	movabs $0x8018a9,%rcx
+  8033bb:	00 00 00 
+  8033be:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033c0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033c7:	eb b5                	jmp    80337e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033c9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033d0:	eb ac                	jmp    80337e <read+0x6a>
+
+00000000008033d2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8033d2:	55                   	push   %rbp
+  8033d3:	48 89 e5             	mov    %rsp,%rbp
+  8033d6:	41 57                	push   %r15
+  8033d8:	41 56                	push   %r14
+  8033da:	41 55                	push   %r13
+  8033dc:	41 54                	push   %r12
+  8033de:	53                   	push   %rbx
+  8033df:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8033e3:	48 85 d2             	test   %rdx,%rdx
+  8033e6:	74 54                	je     80343c <readn+0x6a>
+  8033e8:	41 89 fd             	mov    %edi,%r13d
+  8033eb:	49 89 f6             	mov    %rsi,%r14
+  8033ee:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8033f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8033f6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8033fb:	49 bf 14 33 80 00 00 	movabs $0x803314,%r15
+  803402:	00 00 00 
+  803405:	4c 89 e2             	mov    %r12,%rdx
+  803408:	48 29 f2             	sub    %rsi,%rdx
+  80340b:	4c 01 f6             	add    %r14,%rsi
+  80340e:	44 89 ef             	mov    %r13d,%edi
+  803411:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803414:	85 c0                	test   %eax,%eax
+  803416:	78 20                	js     803438 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803418:	01 c3                	add    %eax,%ebx
+  80341a:	85 c0                	test   %eax,%eax
+  80341c:	74 08                	je     803426 <readn+0x54>
+  80341e:	48 63 f3             	movslq %ebx,%rsi
+  803421:	4c 39 e6             	cmp    %r12,%rsi
+  803424:	72 df                	jb     803405 <readn+0x33>
+    }
+    return res;
+  803426:	48 63 c3             	movslq %ebx,%rax
+}
+  803429:	48 83 c4 08          	add    $0x8,%rsp
+  80342d:	5b                   	pop    %rbx
+  80342e:	41 5c                	pop    %r12
+  803430:	41 5d                	pop    %r13
+  803432:	41 5e                	pop    %r14
+  803434:	41 5f                	pop    %r15
+  803436:	5d                   	pop    %rbp
+  803437:	c3                   	ret
+        if (inc < 0) return inc;
+  803438:	48 98                	cltq
+  80343a:	eb ed                	jmp    803429 <readn+0x57>
+    int inc = 1, res = 0;
+  80343c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803441:	eb e3                	jmp    803426 <readn+0x54>
+
+0000000000803443 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803443:	55                   	push   %rbp
+  803444:	48 89 e5             	mov    %rsp,%rbp
+  803447:	41 56                	push   %r14
+  803449:	41 55                	push   %r13
+  80344b:	41 54                	push   %r12
+  80344d:	53                   	push   %rbx
+  80344e:	48 83 ec 10          	sub    $0x10,%rsp
+  803452:	89 fb                	mov    %edi,%ebx
+  803454:	49 89 f4             	mov    %rsi,%r12
+  803457:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80345a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80345e:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  803465:	00 00 00 
+  803468:	ff d0                	call   *%rax
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	78 47                	js     8034b5 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80346e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803472:	41 8b 3e             	mov    (%r14),%edi
+  803475:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803479:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  803480:	00 00 00 
+  803483:	ff d0                	call   *%rax
+  803485:	85 c0                	test   %eax,%eax
+  803487:	78 30                	js     8034b9 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803489:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80348e:	74 2d                	je     8034bd <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803490:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803494:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803498:	48 85 c0             	test   %rax,%rax
+  80349b:	74 56                	je     8034f3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80349d:	4c 89 ea             	mov    %r13,%rdx
+  8034a0:	4c 89 e6             	mov    %r12,%rsi
+  8034a3:	4c 89 f7             	mov    %r14,%rdi
+  8034a6:	ff d0                	call   *%rax
+}
+  8034a8:	48 83 c4 10          	add    $0x10,%rsp
+  8034ac:	5b                   	pop    %rbx
+  8034ad:	41 5c                	pop    %r12
+  8034af:	41 5d                	pop    %r13
+  8034b1:	41 5e                	pop    %r14
+  8034b3:	5d                   	pop    %rbp
+  8034b4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034b5:	48 98                	cltq
+  8034b7:	eb ef                	jmp    8034a8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034b9:	48 98                	cltq
+  8034bb:	eb eb                	jmp    8034a8 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034bd:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034c4:	00 00 00 
+  8034c7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034cd:	89 da                	mov    %ebx,%edx
+  8034cf:	48 bf f5 63 80 00 00 	movabs $0x8063f5,%rdi
+  8034d6:	00 00 00 
+  8034d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034de:	48 b9 a9 18 80 00 00 	movabs $0x8018a9,%rcx
+  8034e5:	00 00 00 
+  8034e8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8034ea:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034f1:	eb b5                	jmp    8034a8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8034f3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034fa:	eb ac                	jmp    8034a8 <write+0x65>
+
+00000000008034fc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8034fc:	55                   	push   %rbp
+  8034fd:	48 89 e5             	mov    %rsp,%rbp
+  803500:	53                   	push   %rbx
+  803501:	48 83 ec 18          	sub    $0x18,%rsp
+  803505:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803507:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80350b:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+  803517:	85 c0                	test   %eax,%eax
+  803519:	78 0c                	js     803527 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80351b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80351f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803522:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803527:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80352b:	c9                   	leave
+  80352c:	c3                   	ret
+
+000000000080352d <tell>:
+
+int tell(int fdnum) {
+  80352d:	55                   	push   %rbp
+  80352e:	48 89 e5             	mov    %rsp,%rbp
+  803531:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803535:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803539:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  803540:	00 00 00 
+  803543:	ff d0                	call   *%rax
+  803545:	85 c0                	test   %eax,%eax
+  803547:	78 07                	js     803550 <tell+0x23>
+
+    return fd->fd_offset;
+  803549:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80354d:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803550:	c9                   	leave
+  803551:	c3                   	ret
+
+0000000000803552 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803552:	55                   	push   %rbp
+  803553:	48 89 e5             	mov    %rsp,%rbp
+  803556:	41 55                	push   %r13
+  803558:	41 54                	push   %r12
+  80355a:	53                   	push   %rbx
+  80355b:	48 83 ec 18          	sub    $0x18,%rsp
+  80355f:	89 fb                	mov    %edi,%ebx
+  803561:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803564:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803568:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  80356f:	00 00 00 
+  803572:	ff d0                	call   *%rax
+  803574:	85 c0                	test   %eax,%eax
+  803576:	78 38                	js     8035b0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803578:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80357c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803580:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803584:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  80358b:	00 00 00 
+  80358e:	ff d0                	call   *%rax
+  803590:	85 c0                	test   %eax,%eax
+  803592:	78 1c                	js     8035b0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803594:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803599:	74 20                	je     8035bb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80359b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80359f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8035a3:	48 85 c0             	test   %rax,%rax
+  8035a6:	74 47                	je     8035ef <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8035a8:	44 89 e6             	mov    %r12d,%esi
+  8035ab:	4c 89 ef             	mov    %r13,%rdi
+  8035ae:	ff d0                	call   *%rax
+}
+  8035b0:	48 83 c4 18          	add    $0x18,%rsp
+  8035b4:	5b                   	pop    %rbx
+  8035b5:	41 5c                	pop    %r12
+  8035b7:	41 5d                	pop    %r13
+  8035b9:	5d                   	pop    %rbp
+  8035ba:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8035bb:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8035c2:	00 00 00 
+  8035c5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8035cb:	89 da                	mov    %ebx,%edx
+  8035cd:	48 bf b8 63 80 00 00 	movabs $0x8063b8,%rdi
+  8035d4:	00 00 00 
+  8035d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035dc:	48 b9 a9 18 80 00 00 	movabs $0x8018a9,%rcx
+  8035e3:	00 00 00 
+  8035e6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8035e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035ed:	eb c1                	jmp    8035b0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8035ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8035f4:	eb ba                	jmp    8035b0 <ftruncate+0x5e>
+
+00000000008035f6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8035f6:	55                   	push   %rbp
+  8035f7:	48 89 e5             	mov    %rsp,%rbp
+  8035fa:	41 54                	push   %r12
+  8035fc:	53                   	push   %rbx
+  8035fd:	48 83 ec 10          	sub    $0x10,%rsp
+  803601:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803604:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803608:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+  803614:	85 c0                	test   %eax,%eax
+  803616:	78 63                	js     80367b <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803618:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80361c:	41 8b 3c 24          	mov    (%r12),%edi
+  803620:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803624:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  80362b:	00 00 00 
+  80362e:	ff d0                	call   *%rax
+  803630:	85 c0                	test   %eax,%eax
+  803632:	78 47                	js     80367b <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803634:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803638:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80363d:	74 45                	je     803684 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80363f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803642:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803649:	00 00 00 
+    stat->st_isdir = 0;
+  80364c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803653:	00 00 00 
+    stat->st_ino = 0;
+  803656:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80365d:	00 00 00 00 
+    stat->st_version = 0;
+  803661:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803668:	00 00 00 
+    stat->st_dev = dev;
+  80366b:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803672:	48 89 de             	mov    %rbx,%rsi
+  803675:	4c 89 e7             	mov    %r12,%rdi
+  803678:	ff 50 28             	call   *0x28(%rax)
+}
+  80367b:	48 83 c4 10          	add    $0x10,%rsp
+  80367f:	5b                   	pop    %rbx
+  803680:	41 5c                	pop    %r12
+  803682:	5d                   	pop    %rbp
+  803683:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803684:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803689:	eb f0                	jmp    80367b <fstat+0x85>
+
+000000000080368b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80368b:	55                   	push   %rbp
+  80368c:	48 89 e5             	mov    %rsp,%rbp
+  80368f:	41 54                	push   %r12
+  803691:	53                   	push   %rbx
+  803692:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803695:	be 00 00 00 00       	mov    $0x0,%esi
+  80369a:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  8036a1:	00 00 00 
+  8036a4:	ff d0                	call   *%rax
+  8036a6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8036a8:	85 c0                	test   %eax,%eax
+  8036aa:	78 25                	js     8036d1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8036ac:	4c 89 e6             	mov    %r12,%rsi
+  8036af:	89 c7                	mov    %eax,%edi
+  8036b1:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  8036b8:	00 00 00 
+  8036bb:	ff d0                	call   *%rax
+  8036bd:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8036c0:	89 df                	mov    %ebx,%edi
+  8036c2:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  8036c9:	00 00 00 
+  8036cc:	ff d0                	call   *%rax
+
+    return res;
+  8036ce:	44 89 e3             	mov    %r12d,%ebx
+}
+  8036d1:	89 d8                	mov    %ebx,%eax
+  8036d3:	5b                   	pop    %rbx
+  8036d4:	41 5c                	pop    %r12
+  8036d6:	5d                   	pop    %rbp
+  8036d7:	c3                   	ret
+
+00000000008036d8 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036d8:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8036df:	00 00 00 
+  8036e2:	83 38 00             	cmpl   $0x0,(%rax)
+  8036e5:	74 0a                	je     8036f1 <fsipc_env+0x19>
+    return fsenv;
+}
+  8036e7:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8036ee:	00 00 
+  8036f0:	c3                   	ret
+fsipc_env(void) {
+  8036f1:	55                   	push   %rbp
+  8036f2:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036f5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8036fa:	48 b8 ef 57 80 00 00 	movabs $0x8057ef,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+  803706:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80370d:	00 00 
+}
+  80370f:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803716:	00 00 
+  803718:	5d                   	pop    %rbp
+  803719:	c3                   	ret
+
+000000000080371a <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80371a:	55                   	push   %rbp
+  80371b:	48 89 e5             	mov    %rsp,%rbp
+  80371e:	53                   	push   %rbx
+  80371f:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803723:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80372a:	00 
+  80372b:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803732:	00 
+  803733:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80373a:	00 
+  80373b:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803742:	00 
+  803743:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80374a:	00 
+
+    assert(size <= sizeof(words));
+  80374b:	48 83 fa 28          	cmp    $0x28,%rdx
+  80374f:	77 38                	ja     803789 <fsipc_short+0x6f>
+  803751:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803753:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803757:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  80375e:	00 00 00 
+  803761:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803763:	48 b8 d8 36 80 00 00 	movabs $0x8036d8,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+  80376f:	89 c7                	mov    %eax,%edi
+  803771:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803775:	89 de                	mov    %ebx,%esi
+  803777:	48 b8 52 57 80 00 00 	movabs $0x805752,%rax
+  80377e:	00 00 00 
+  803781:	ff d0                	call   *%rax
+}
+  803783:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803787:	c9                   	leave
+  803788:	c3                   	ret
+    assert(size <= sizeof(words));
+  803789:	48 b9 40 64 80 00 00 	movabs $0x806440,%rcx
+  803790:	00 00 00 
+  803793:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  80379a:	00 00 00 
+  80379d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8037a2:	48 bf 6b 64 80 00 00 	movabs $0x80646b,%rdi
+  8037a9:	00 00 00 
+  8037ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b1:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  8037b8:	00 00 00 
+  8037bb:	41 ff d0             	call   *%r8
+
+00000000008037be <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8037be:	55                   	push   %rbp
+  8037bf:	48 89 e5             	mov    %rsp,%rbp
+  8037c2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8037c6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8037c9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8037cc:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8037cf:	ba 08 00 00 00       	mov    $0x8,%edx
+  8037d4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037d8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8037dd:	48 b8 1a 37 80 00 00 	movabs $0x80371a,%rax
+  8037e4:	00 00 00 
+  8037e7:	ff d0                	call   *%rax
+}
+  8037e9:	c9                   	leave
+  8037ea:	c3                   	ret
+
+00000000008037eb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8037eb:	55                   	push   %rbp
+  8037ec:	48 89 e5             	mov    %rsp,%rbp
+  8037ef:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8037f3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8037f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8037f9:	ba 04 00 00 00       	mov    $0x4,%edx
+  8037fe:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803802:	bf 06 00 00 00       	mov    $0x6,%edi
+  803807:	48 b8 1a 37 80 00 00 	movabs $0x80371a,%rax
+  80380e:	00 00 00 
+  803811:	ff d0                	call   *%rax
+}
+  803813:	c9                   	leave
+  803814:	c3                   	ret
+
+0000000000803815 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803815:	55                   	push   %rbp
+  803816:	48 89 e5             	mov    %rsp,%rbp
+  803819:	41 54                	push   %r12
+  80381b:	53                   	push   %rbx
+  80381c:	48 83 ec 10          	sub    $0x10,%rsp
+  803820:	89 fb                	mov    %edi,%ebx
+  803822:	49 89 f4             	mov    %rsi,%r12
+  803825:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803829:	48 b8 d8 36 80 00 00 	movabs $0x8036d8,%rax
+  803830:	00 00 00 
+  803833:	ff d0                	call   *%rax
+  803835:	89 c7                	mov    %eax,%edi
+  803837:	6a 00                	push   $0x0
+  803839:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80383d:	50                   	push   %rax
+  80383e:	4d 89 e1             	mov    %r12,%r9
+  803841:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803847:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80384c:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803853:	00 00 00 
+  803856:	89 de                	mov    %ebx,%esi
+  803858:	48 b8 ed 56 80 00 00 	movabs $0x8056ed,%rax
+  80385f:	00 00 00 
+  803862:	ff d0                	call   *%rax
+}
+  803864:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803868:	5b                   	pop    %rbx
+  803869:	41 5c                	pop    %r12
+  80386b:	5d                   	pop    %rbp
+  80386c:	c3                   	ret
+
+000000000080386d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80386d:	55                   	push   %rbp
+  80386e:	48 89 e5             	mov    %rsp,%rbp
+  803871:	41 54                	push   %r12
+  803873:	53                   	push   %rbx
+  803874:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803877:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80387a:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803881:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803883:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803888:	be 00 00 00 00       	mov    $0x0,%esi
+  80388d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803892:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  803899:	00 00 00 
+  80389c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80389e:	85 c0                	test   %eax,%eax
+  8038a0:	78 5a                	js     8038fc <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8038a2:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8038a9:	00 00 00 
+  8038ac:	4c 89 e6             	mov    %r12,%rsi
+  8038af:	48 89 df             	mov    %rbx,%rdi
+  8038b2:	48 b8 e0 21 80 00 00 	movabs $0x8021e0,%rax
+  8038b9:	00 00 00 
+  8038bc:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8038be:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8038c5:	00 
+  8038c6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8038cc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8038d3:	00 
+  8038d4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8038da:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8038e1:	00 
+  8038e2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8038e9:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8038f0:	00 
+  8038f1:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8038f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038fc:	5b                   	pop    %rbx
+  8038fd:	41 5c                	pop    %r12
+  8038ff:	5d                   	pop    %rbp
+  803900:	c3                   	ret
+
+0000000000803901 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803901:	55                   	push   %rbp
+  803902:	48 89 e5             	mov    %rsp,%rbp
+  803905:	41 57                	push   %r15
+  803907:	41 56                	push   %r14
+  803909:	41 55                	push   %r13
+  80390b:	41 54                	push   %r12
+  80390d:	53                   	push   %rbx
+  80390e:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803912:	48 85 ff             	test   %rdi,%rdi
+  803915:	0f 84 a1 00 00 00    	je     8039bc <devfile_read+0xbb>
+  80391b:	49 89 ff             	mov    %rdi,%r15
+  80391e:	49 89 f5             	mov    %rsi,%r13
+  803921:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803924:	48 85 f6             	test   %rsi,%rsi
+  803927:	0f 84 c4 00 00 00    	je     8039f1 <devfile_read+0xf0>
+    size_t total_read = 0;
+  80392d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803934:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803935:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80393c:	00 00 00 
+  80393f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803943:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803946:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80394a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80394f:	be 00 00 00 00       	mov    $0x0,%esi
+  803954:	bf 03 00 00 00       	mov    $0x3,%edi
+  803959:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  803960:	00 00 00 
+  803963:	ff d0                	call   *%rax
+        if (res < 0) {
+  803965:	85 c0                	test   %eax,%eax
+  803967:	0f 88 b9 00 00 00    	js     803a26 <devfile_read+0x125>
+        assert(res <= n);
+  80396d:	48 63 d8             	movslq %eax,%rbx
+  803970:	49 39 dc             	cmp    %rbx,%r12
+  803973:	0f 82 b1 00 00 00    	jb     803a2a <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803979:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80397e:	0f 87 db 00 00 00    	ja     803a5f <devfile_read+0x15e>
+        if (!res) {
+  803984:	85 c0                	test   %eax,%eax
+  803986:	74 21                	je     8039a9 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803988:	48 89 da             	mov    %rbx,%rdx
+  80398b:	4c 89 f6             	mov    %r14,%rsi
+  80398e:	4c 89 ef             	mov    %r13,%rdi
+  803991:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  803998:	00 00 00 
+  80399b:	ff d0                	call   *%rax
+        total_read += res;
+  80399d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8039a1:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8039a4:	49 29 dc             	sub    %rbx,%r12
+  8039a7:	75 96                	jne    80393f <devfile_read+0x3e>
+    return total_read;
+  8039a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8039ad:	48 83 c4 18          	add    $0x18,%rsp
+  8039b1:	5b                   	pop    %rbx
+  8039b2:	41 5c                	pop    %r12
+  8039b4:	41 5d                	pop    %r13
+  8039b6:	41 5e                	pop    %r14
+  8039b8:	41 5f                	pop    %r15
+  8039ba:	5d                   	pop    %rbp
+  8039bb:	c3                   	ret
+    assert(fd);
+  8039bc:	48 b9 76 64 80 00 00 	movabs $0x806476,%rcx
+  8039c3:	00 00 00 
+  8039c6:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  8039cd:	00 00 00 
+  8039d0:	be 91 00 00 00       	mov    $0x91,%esi
+  8039d5:	48 bf 6b 64 80 00 00 	movabs $0x80646b,%rdi
+  8039dc:	00 00 00 
+  8039df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e4:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  8039eb:	00 00 00 
+  8039ee:	41 ff d0             	call   *%r8
+    assert(buf);
+  8039f1:	48 b9 79 64 80 00 00 	movabs $0x806479,%rcx
+  8039f8:	00 00 00 
+  8039fb:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  803a02:	00 00 00 
+  803a05:	be 92 00 00 00       	mov    $0x92,%esi
+  803a0a:	48 bf 6b 64 80 00 00 	movabs $0x80646b,%rdi
+  803a11:	00 00 00 
+  803a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a19:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  803a20:	00 00 00 
+  803a23:	41 ff d0             	call   *%r8
+            return res;
+  803a26:	48 98                	cltq
+  803a28:	eb 83                	jmp    8039ad <devfile_read+0xac>
+        assert(res <= n);
+  803a2a:	48 b9 7d 64 80 00 00 	movabs $0x80647d,%rcx
+  803a31:	00 00 00 
+  803a34:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  803a3b:	00 00 00 
+  803a3e:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803a43:	48 bf 6b 64 80 00 00 	movabs $0x80646b,%rdi
+  803a4a:	00 00 00 
+  803a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a52:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  803a59:	00 00 00 
+  803a5c:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803a5f:	48 b9 88 64 80 00 00 	movabs $0x806488,%rcx
+  803a66:	00 00 00 
+  803a69:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  803a70:	00 00 00 
+  803a73:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803a78:	48 bf 6b 64 80 00 00 	movabs $0x80646b,%rdi
+  803a7f:	00 00 00 
+  803a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a87:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  803a8e:	00 00 00 
+  803a91:	41 ff d0             	call   *%r8
+
+0000000000803a94 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803a94:	55                   	push   %rbp
+  803a95:	48 89 e5             	mov    %rsp,%rbp
+  803a98:	41 57                	push   %r15
+  803a9a:	41 56                	push   %r14
+  803a9c:	41 55                	push   %r13
+  803a9e:	41 54                	push   %r12
+  803aa0:	53                   	push   %rbx
+  803aa1:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803aa5:	48 85 ff             	test   %rdi,%rdi
+  803aa8:	0f 84 83 00 00 00    	je     803b31 <devfile_write+0x9d>
+  803aae:	49 89 ff             	mov    %rdi,%r15
+  803ab1:	49 89 f4             	mov    %rsi,%r12
+  803ab4:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803ab7:	48 85 f6             	test   %rsi,%rsi
+  803aba:	0f 84 a6 00 00 00    	je     803b66 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803ac0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ac6:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803acd:	00 00 00 
+  803ad0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803ad4:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803ad7:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803adb:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803ae0:	48 39 d3             	cmp    %rdx,%rbx
+  803ae3:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803ae7:	4c 89 e6             	mov    %r12,%rsi
+  803aea:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803af1:	00 00 00 
+  803af4:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  803afb:	00 00 00 
+  803afe:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b05:	be 00 00 00 00       	mov    $0x0,%esi
+  803b0a:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b0f:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+        if (res < 0) {
+  803b1b:	85 c0                	test   %eax,%eax
+  803b1d:	78 7c                	js     803b9b <devfile_write+0x107>
+        total_written += res;
+  803b1f:	48 98                	cltq
+  803b21:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803b24:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803b27:	48 29 c3             	sub    %rax,%rbx
+  803b2a:	75 a4                	jne    803ad0 <devfile_write+0x3c>
+    return total_written;
+  803b2c:	4c 89 e8             	mov    %r13,%rax
+  803b2f:	eb 6c                	jmp    803b9d <devfile_write+0x109>
+    assert(fd);
+  803b31:	48 b9 76 64 80 00 00 	movabs $0x806476,%rcx
+  803b38:	00 00 00 
+  803b3b:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  803b42:	00 00 00 
+  803b45:	be bd 00 00 00       	mov    $0xbd,%esi
+  803b4a:	48 bf 6b 64 80 00 00 	movabs $0x80646b,%rdi
+  803b51:	00 00 00 
+  803b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b59:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  803b60:	00 00 00 
+  803b63:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b66:	48 b9 79 64 80 00 00 	movabs $0x806479,%rcx
+  803b6d:	00 00 00 
+  803b70:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  803b77:	00 00 00 
+  803b7a:	be be 00 00 00       	mov    $0xbe,%esi
+  803b7f:	48 bf 6b 64 80 00 00 	movabs $0x80646b,%rdi
+  803b86:	00 00 00 
+  803b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8e:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  803b95:	00 00 00 
+  803b98:	41 ff d0             	call   *%r8
+            return res;
+  803b9b:	48 98                	cltq
+}
+  803b9d:	48 83 c4 08          	add    $0x8,%rsp
+  803ba1:	5b                   	pop    %rbx
+  803ba2:	41 5c                	pop    %r12
+  803ba4:	41 5d                	pop    %r13
+  803ba6:	41 5e                	pop    %r14
+  803ba8:	41 5f                	pop    %r15
+  803baa:	5d                   	pop    %rbp
+  803bab:	c3                   	ret
+
+0000000000803bac <open>:
+open(const char *path, int mode) {
+  803bac:	55                   	push   %rbp
+  803bad:	48 89 e5             	mov    %rsp,%rbp
+  803bb0:	41 55                	push   %r13
+  803bb2:	41 54                	push   %r12
+  803bb4:	53                   	push   %rbx
+  803bb5:	48 83 ec 18          	sub    $0x18,%rsp
+  803bb9:	49 89 fc             	mov    %rdi,%r12
+  803bbc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803bbf:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  803bc6:	00 00 00 
+  803bc9:	ff d0                	call   *%rax
+  803bcb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803bd1:	0f 87 8f 00 00 00    	ja     803c66 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803bd7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bdb:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  803be2:	00 00 00 
+  803be5:	ff d0                	call   *%rax
+  803be7:	89 c3                	mov    %eax,%ebx
+  803be9:	85 c0                	test   %eax,%eax
+  803beb:	78 55                	js     803c42 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803bed:	4c 89 e6             	mov    %r12,%rsi
+  803bf0:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803bf7:	00 00 00 
+  803bfa:	48 89 df             	mov    %rbx,%rdi
+  803bfd:	48 b8 e0 21 80 00 00 	movabs $0x8021e0,%rax
+  803c04:	00 00 00 
+  803c07:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803c09:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c15:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c19:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c1e:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  803c25:	00 00 00 
+  803c28:	ff d0                	call   *%rax
+  803c2a:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803c2c:	85 c0                	test   %eax,%eax
+  803c2e:	78 1f                	js     803c4f <open+0xa3>
+    return fd2num(fd);
+  803c30:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c34:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  803c3b:	00 00 00 
+  803c3e:	ff d0                	call   *%rax
+  803c40:	89 c3                	mov    %eax,%ebx
+}
+  803c42:	89 d8                	mov    %ebx,%eax
+  803c44:	48 83 c4 18          	add    $0x18,%rsp
+  803c48:	5b                   	pop    %rbx
+  803c49:	41 5c                	pop    %r12
+  803c4b:	41 5d                	pop    %r13
+  803c4d:	5d                   	pop    %rbp
+  803c4e:	c3                   	ret
+        fd_close(fd, 0);
+  803c4f:	be 00 00 00 00       	mov    $0x0,%esi
+  803c54:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c58:	48 b8 ec 30 80 00 00 	movabs $0x8030ec,%rax
+  803c5f:	00 00 00 
+  803c62:	ff d0                	call   *%rax
+        return res;
+  803c64:	eb dc                	jmp    803c42 <open+0x96>
+        return -E_BAD_PATH;
+  803c66:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c6b:	eb d5                	jmp    803c42 <open+0x96>
+
+0000000000803c6d <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803c6d:	55                   	push   %rbp
+  803c6e:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803c71:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c76:	be 00 00 00 00       	mov    $0x0,%esi
+  803c7b:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c80:	48 b8 1a 37 80 00 00 	movabs $0x80371a,%rax
+  803c87:	00 00 00 
+  803c8a:	ff d0                	call   *%rax
+}
+  803c8c:	5d                   	pop    %rbp
+  803c8d:	c3                   	ret
+
+0000000000803c8e <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803c8e:	55                   	push   %rbp
+  803c8f:	48 89 e5             	mov    %rsp,%rbp
+  803c92:	41 56                	push   %r14
+  803c94:	41 55                	push   %r13
+  803c96:	41 54                	push   %r12
+  803c98:	53                   	push   %rbx
+  803c99:	48 83 ec 10          	sub    $0x10,%rsp
+  803c9d:	41 89 f6             	mov    %esi,%r14d
+  803ca0:	49 89 d4             	mov    %rdx,%r12
+  803ca3:	48 89 cb             	mov    %rcx,%rbx
+  803ca6:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ca9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803cad:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  803cb4:	00 00 00 
+  803cb7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cb9:	85 c0                	test   %eax,%eax
+  803cbb:	78 46                	js     803d03 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803cbd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cc1:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803cc8:	00 00 00 
+  803ccb:	8b 00                	mov    (%rax),%eax
+  803ccd:	39 02                	cmp    %eax,(%rdx)
+  803ccf:	75 3f                	jne    803d10 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803cd1:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803cd8:	00 00 00 
+  803cdb:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803cde:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ce0:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ce4:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ce8:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803cec:	48 89 da             	mov    %rbx,%rdx
+  803cef:	4c 89 e6             	mov    %r12,%rsi
+  803cf2:	bf 09 00 00 00       	mov    $0x9,%edi
+  803cf7:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  803cfe:	00 00 00 
+  803d01:	ff d0                	call   *%rax
+}
+  803d03:	48 83 c4 10          	add    $0x10,%rsp
+  803d07:	5b                   	pop    %rbx
+  803d08:	41 5c                	pop    %r12
+  803d0a:	41 5d                	pop    %r13
+  803d0c:	41 5e                	pop    %r14
+  803d0e:	5d                   	pop    %rbp
+  803d0f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d10:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d15:	eb ec                	jmp    803d03 <file_map+0x75>
+
+0000000000803d17 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803d17:	55                   	push   %rbp
+  803d18:	48 89 e5             	mov    %rsp,%rbp
+  803d1b:	41 54                	push   %r12
+  803d1d:	53                   	push   %rbx
+  803d1e:	48 83 ec 20          	sub    $0x20,%rsp
+  803d22:	41 89 f4             	mov    %esi,%r12d
+  803d25:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d28:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d2c:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  803d33:	00 00 00 
+  803d36:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d38:	85 c0                	test   %eax,%eax
+  803d3a:	78 3c                	js     803d78 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d40:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803d47:	00 00 00 
+  803d4a:	8b 0a                	mov    (%rdx),%ecx
+  803d4c:	39 08                	cmp    %ecx,(%rax)
+  803d4e:	75 31                	jne    803d81 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803d50:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d53:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803d56:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803d5a:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803d5e:	ba 10 00 00 00       	mov    $0x10,%edx
+  803d63:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d67:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803d6c:	48 b8 1a 37 80 00 00 	movabs $0x80371a,%rax
+  803d73:	00 00 00 
+  803d76:	ff d0                	call   *%rax
+}
+  803d78:	48 83 c4 20          	add    $0x20,%rsp
+  803d7c:	5b                   	pop    %rbx
+  803d7d:	41 5c                	pop    %r12
+  803d7f:	5d                   	pop    %rbp
+  803d80:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d81:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d86:	eb f0                	jmp    803d78 <file_msync+0x61>
+
+0000000000803d88 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803d88:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803d8c:	7f 01                	jg     803d8f <writebuf+0x7>
+  803d8e:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803d8f:	55                   	push   %rbp
+  803d90:	48 89 e5             	mov    %rsp,%rbp
+  803d93:	53                   	push   %rbx
+  803d94:	48 83 ec 08          	sub    $0x8,%rsp
+  803d98:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803d9b:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803d9f:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803da3:	8b 3f                	mov    (%rdi),%edi
+  803da5:	48 b8 43 34 80 00 00 	movabs $0x803443,%rax
+  803dac:	00 00 00 
+  803daf:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803db1:	48 85 c0             	test   %rax,%rax
+  803db4:	7e 04                	jle    803dba <writebuf+0x32>
+  803db6:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803dba:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803dbe:	48 39 c2             	cmp    %rax,%rdx
+  803dc1:	74 0f                	je     803dd2 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803dc3:	48 85 c0             	test   %rax,%rax
+  803dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dcb:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803dcf:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803dd2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dd6:	c9                   	leave
+  803dd7:	c3                   	ret
+
+0000000000803dd8 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803dd8:	8b 46 04             	mov    0x4(%rsi),%eax
+  803ddb:	8d 50 01             	lea    0x1(%rax),%edx
+  803dde:	89 56 04             	mov    %edx,0x4(%rsi)
+  803de1:	48 98                	cltq
+  803de3:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803de8:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803dee:	74 01                	je     803df1 <putch+0x19>
+  803df0:	c3                   	ret
+putch(int ch, void *arg) {
+  803df1:	55                   	push   %rbp
+  803df2:	48 89 e5             	mov    %rsp,%rbp
+  803df5:	53                   	push   %rbx
+  803df6:	48 83 ec 08          	sub    $0x8,%rsp
+  803dfa:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803dfd:	48 89 f7             	mov    %rsi,%rdi
+  803e00:	48 b8 88 3d 80 00 00 	movabs $0x803d88,%rax
+  803e07:	00 00 00 
+  803e0a:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e0c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e17:	c9                   	leave
+  803e18:	c3                   	ret
+
+0000000000803e19 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e19:	55                   	push   %rbp
+  803e1a:	48 89 e5             	mov    %rsp,%rbp
+  803e1d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803e24:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803e27:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803e2d:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803e34:	00 00 00 
+    state.result = 0;
+  803e37:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803e3e:	00 00 00 00 
+    state.error = 1;
+  803e42:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803e49:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803e4c:	48 89 f2             	mov    %rsi,%rdx
+  803e4f:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803e56:	48 bf d8 3d 80 00 00 	movabs $0x803dd8,%rdi
+  803e5d:	00 00 00 
+  803e60:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  803e67:	00 00 00 
+  803e6a:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803e6c:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803e73:	7f 14                	jg     803e89 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803e75:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803e7c:	48 85 c0             	test   %rax,%rax
+  803e7f:	75 06                	jne    803e87 <vfprintf+0x6e>
+  803e81:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803e87:	c9                   	leave
+  803e88:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803e89:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803e90:	48 b8 88 3d 80 00 00 	movabs $0x803d88,%rax
+  803e97:	00 00 00 
+  803e9a:	ff d0                	call   *%rax
+  803e9c:	eb d7                	jmp    803e75 <vfprintf+0x5c>
+
+0000000000803e9e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803e9e:	55                   	push   %rbp
+  803e9f:	48 89 e5             	mov    %rsp,%rbp
+  803ea2:	48 83 ec 50          	sub    $0x50,%rsp
+  803ea6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803eaa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803eae:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803eb2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803eb6:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803ebd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ec5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ec9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ecd:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ed1:	48 b8 19 3e 80 00 00 	movabs $0x803e19,%rax
+  803ed8:	00 00 00 
+  803edb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803edd:	c9                   	leave
+  803ede:	c3                   	ret
+
+0000000000803edf <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803edf:	55                   	push   %rbp
+  803ee0:	48 89 e5             	mov    %rsp,%rbp
+  803ee3:	48 83 ec 50          	sub    $0x50,%rsp
+  803ee7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803eeb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803eef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ef3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ef7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803efb:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f02:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f0a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f0e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f12:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f16:	48 89 fe             	mov    %rdi,%rsi
+  803f19:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f1e:	48 b8 19 3e 80 00 00 	movabs $0x803e19,%rax
+  803f25:	00 00 00 
+  803f28:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f2a:	c9                   	leave
+  803f2b:	c3                   	ret
+
+0000000000803f2c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f2c:	55                   	push   %rbp
+  803f2d:	48 89 e5             	mov    %rsp,%rbp
+  803f30:	41 54                	push   %r12
+  803f32:	53                   	push   %rbx
+  803f33:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f36:	48 b8 b5 2f 80 00 00 	movabs $0x802fb5,%rax
+  803f3d:	00 00 00 
+  803f40:	ff d0                	call   *%rax
+  803f42:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803f45:	48 be b0 64 80 00 00 	movabs $0x8064b0,%rsi
+  803f4c:	00 00 00 
+  803f4f:	48 89 df             	mov    %rbx,%rdi
+  803f52:	48 b8 e0 21 80 00 00 	movabs $0x8021e0,%rax
+  803f59:	00 00 00 
+  803f5c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803f5e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803f63:	41 2b 04 24          	sub    (%r12),%eax
+  803f67:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803f6d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803f74:	00 00 00 
+    stat->st_dev = &devpipe;
+  803f77:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803f7e:	00 00 00 
+  803f81:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f8d:	5b                   	pop    %rbx
+  803f8e:	41 5c                	pop    %r12
+  803f90:	5d                   	pop    %rbp
+  803f91:	c3                   	ret
+
+0000000000803f92 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803f92:	55                   	push   %rbp
+  803f93:	48 89 e5             	mov    %rsp,%rbp
+  803f96:	41 54                	push   %r12
+  803f98:	53                   	push   %rbx
+  803f99:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803f9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fa1:	48 89 fe             	mov    %rdi,%rsi
+  803fa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fa9:	49 bc 1d 2a 80 00 00 	movabs $0x802a1d,%r12
+  803fb0:	00 00 00 
+  803fb3:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803fb6:	48 89 df             	mov    %rbx,%rdi
+  803fb9:	48 b8 b5 2f 80 00 00 	movabs $0x802fb5,%rax
+  803fc0:	00 00 00 
+  803fc3:	ff d0                	call   *%rax
+  803fc5:	48 89 c6             	mov    %rax,%rsi
+  803fc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd2:	41 ff d4             	call   *%r12
+}
+  803fd5:	5b                   	pop    %rbx
+  803fd6:	41 5c                	pop    %r12
+  803fd8:	5d                   	pop    %rbp
+  803fd9:	c3                   	ret
+
+0000000000803fda <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803fda:	55                   	push   %rbp
+  803fdb:	48 89 e5             	mov    %rsp,%rbp
+  803fde:	41 57                	push   %r15
+  803fe0:	41 56                	push   %r14
+  803fe2:	41 55                	push   %r13
+  803fe4:	41 54                	push   %r12
+  803fe6:	53                   	push   %rbx
+  803fe7:	48 83 ec 18          	sub    $0x18,%rsp
+  803feb:	49 89 fc             	mov    %rdi,%r12
+  803fee:	49 89 f5             	mov    %rsi,%r13
+  803ff1:	49 89 d7             	mov    %rdx,%r15
+  803ff4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ff8:	48 b8 b5 2f 80 00 00 	movabs $0x802fb5,%rax
+  803fff:	00 00 00 
+  804002:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804004:	4d 85 ff             	test   %r15,%r15
+  804007:	0f 84 af 00 00 00    	je     8040bc <devpipe_write+0xe2>
+  80400d:	48 89 c3             	mov    %rax,%rbx
+  804010:	4c 89 f8             	mov    %r15,%rax
+  804013:	4d 89 ef             	mov    %r13,%r15
+  804016:	4c 01 e8             	add    %r13,%rax
+  804019:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80401d:	49 bd 13 29 80 00 00 	movabs $0x802913,%r13
+  804024:	00 00 00 
+            sys_yield();
+  804027:	49 be a4 28 80 00 00 	movabs $0x8028a4,%r14
+  80402e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804031:	8b 73 04             	mov    0x4(%rbx),%esi
+  804034:	48 63 ce             	movslq %esi,%rcx
+  804037:	48 63 03             	movslq (%rbx),%rax
+  80403a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804040:	48 39 c1             	cmp    %rax,%rcx
+  804043:	72 2e                	jb     804073 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804045:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80404a:	48 89 da             	mov    %rbx,%rdx
+  80404d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804052:	4c 89 e7             	mov    %r12,%rdi
+  804055:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804058:	85 c0                	test   %eax,%eax
+  80405a:	74 66                	je     8040c2 <devpipe_write+0xe8>
+            sys_yield();
+  80405c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80405f:	8b 73 04             	mov    0x4(%rbx),%esi
+  804062:	48 63 ce             	movslq %esi,%rcx
+  804065:	48 63 03             	movslq (%rbx),%rax
+  804068:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80406e:	48 39 c1             	cmp    %rax,%rcx
+  804071:	73 d2                	jae    804045 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804073:	41 0f b6 3f          	movzbl (%r15),%edi
+  804077:	48 89 ca             	mov    %rcx,%rdx
+  80407a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80407e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804085:	08 10 20 
+  804088:	48 f7 e2             	mul    %rdx
+  80408b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80408f:	48 89 d0             	mov    %rdx,%rax
+  804092:	48 c1 e0 09          	shl    $0x9,%rax
+  804096:	48 29 d0             	sub    %rdx,%rax
+  804099:	48 c1 e0 03          	shl    $0x3,%rax
+  80409d:	48 29 c1             	sub    %rax,%rcx
+  8040a0:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8040a5:	83 c6 01             	add    $0x1,%esi
+  8040a8:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8040ab:	49 83 c7 01          	add    $0x1,%r15
+  8040af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040b3:	49 39 c7             	cmp    %rax,%r15
+  8040b6:	0f 85 75 ff ff ff    	jne    804031 <devpipe_write+0x57>
+    return n;
+  8040bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040c0:	eb 05                	jmp    8040c7 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8040c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040c7:	48 83 c4 18          	add    $0x18,%rsp
+  8040cb:	5b                   	pop    %rbx
+  8040cc:	41 5c                	pop    %r12
+  8040ce:	41 5d                	pop    %r13
+  8040d0:	41 5e                	pop    %r14
+  8040d2:	41 5f                	pop    %r15
+  8040d4:	5d                   	pop    %rbp
+  8040d5:	c3                   	ret
+
+00000000008040d6 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040d6:	55                   	push   %rbp
+  8040d7:	48 89 e5             	mov    %rsp,%rbp
+  8040da:	41 57                	push   %r15
+  8040dc:	41 56                	push   %r14
+  8040de:	41 55                	push   %r13
+  8040e0:	41 54                	push   %r12
+  8040e2:	53                   	push   %rbx
+  8040e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8040e7:	49 89 fc             	mov    %rdi,%r12
+  8040ea:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8040ee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8040f2:	48 b8 b5 2f 80 00 00 	movabs $0x802fb5,%rax
+  8040f9:	00 00 00 
+  8040fc:	ff d0                	call   *%rax
+  8040fe:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804101:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804107:	49 bd 13 29 80 00 00 	movabs $0x802913,%r13
+  80410e:	00 00 00 
+            sys_yield();
+  804111:	49 be a4 28 80 00 00 	movabs $0x8028a4,%r14
+  804118:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80411b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804120:	74 7d                	je     80419f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804122:	8b 03                	mov    (%rbx),%eax
+  804124:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804127:	75 26                	jne    80414f <devpipe_read+0x79>
+            if (i > 0) return i;
+  804129:	4d 85 ff             	test   %r15,%r15
+  80412c:	75 77                	jne    8041a5 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80412e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804133:	48 89 da             	mov    %rbx,%rdx
+  804136:	be 00 10 00 00       	mov    $0x1000,%esi
+  80413b:	4c 89 e7             	mov    %r12,%rdi
+  80413e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804141:	85 c0                	test   %eax,%eax
+  804143:	74 72                	je     8041b7 <devpipe_read+0xe1>
+            sys_yield();
+  804145:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804148:	8b 03                	mov    (%rbx),%eax
+  80414a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80414d:	74 df                	je     80412e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80414f:	48 63 c8             	movslq %eax,%rcx
+  804152:	48 89 ca             	mov    %rcx,%rdx
+  804155:	48 c1 ea 03          	shr    $0x3,%rdx
+  804159:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804160:	08 10 20 
+  804163:	48 89 d0             	mov    %rdx,%rax
+  804166:	48 f7 e6             	mul    %rsi
+  804169:	48 c1 ea 06          	shr    $0x6,%rdx
+  80416d:	48 89 d0             	mov    %rdx,%rax
+  804170:	48 c1 e0 09          	shl    $0x9,%rax
+  804174:	48 29 d0             	sub    %rdx,%rax
+  804177:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80417e:	00 
+  80417f:	48 89 c8             	mov    %rcx,%rax
+  804182:	48 29 d0             	sub    %rdx,%rax
+  804185:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80418a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80418e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804192:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804195:	49 83 c7 01          	add    $0x1,%r15
+  804199:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80419d:	75 83                	jne    804122 <devpipe_read+0x4c>
+    return n;
+  80419f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041a3:	eb 03                	jmp    8041a8 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8041a5:	4c 89 f8             	mov    %r15,%rax
+}
+  8041a8:	48 83 c4 18          	add    $0x18,%rsp
+  8041ac:	5b                   	pop    %rbx
+  8041ad:	41 5c                	pop    %r12
+  8041af:	41 5d                	pop    %r13
+  8041b1:	41 5e                	pop    %r14
+  8041b3:	41 5f                	pop    %r15
+  8041b5:	5d                   	pop    %rbp
+  8041b6:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8041b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041bc:	eb ea                	jmp    8041a8 <devpipe_read+0xd2>
+
+00000000008041be <pipe>:
+pipe(int pfd[2]) {
+  8041be:	55                   	push   %rbp
+  8041bf:	48 89 e5             	mov    %rsp,%rbp
+  8041c2:	41 55                	push   %r13
+  8041c4:	41 54                	push   %r12
+  8041c6:	53                   	push   %rbx
+  8041c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8041cb:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8041ce:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8041d2:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8041d9:	00 00 00 
+  8041dc:	ff d0                	call   *%rax
+  8041de:	89 c3                	mov    %eax,%ebx
+  8041e0:	85 c0                	test   %eax,%eax
+  8041e2:	0f 88 a0 01 00 00    	js     804388 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8041e8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8041ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041f2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8041f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041fb:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  804202:	00 00 00 
+  804205:	ff d0                	call   *%rax
+  804207:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804209:	85 c0                	test   %eax,%eax
+  80420b:	0f 88 77 01 00 00    	js     804388 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804211:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804215:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  80421c:	00 00 00 
+  80421f:	ff d0                	call   *%rax
+  804221:	89 c3                	mov    %eax,%ebx
+  804223:	85 c0                	test   %eax,%eax
+  804225:	0f 88 43 01 00 00    	js     80436e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80422b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804230:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804235:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80423e:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  804245:	00 00 00 
+  804248:	ff d0                	call   *%rax
+  80424a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80424c:	85 c0                	test   %eax,%eax
+  80424e:	0f 88 1a 01 00 00    	js     80436e <pipe+0x1b0>
+    va = fd2data(fd0);
+  804254:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804258:	48 b8 b5 2f 80 00 00 	movabs $0x802fb5,%rax
+  80425f:	00 00 00 
+  804262:	ff d0                	call   *%rax
+  804264:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804267:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80426c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804271:	48 89 c6             	mov    %rax,%rsi
+  804274:	bf 00 00 00 00       	mov    $0x0,%edi
+  804279:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  804280:	00 00 00 
+  804283:	ff d0                	call   *%rax
+  804285:	89 c3                	mov    %eax,%ebx
+  804287:	85 c0                	test   %eax,%eax
+  804289:	0f 88 c5 00 00 00    	js     804354 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80428f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804293:	48 b8 b5 2f 80 00 00 	movabs $0x802fb5,%rax
+  80429a:	00 00 00 
+  80429d:	ff d0                	call   *%rax
+  80429f:	48 89 c1             	mov    %rax,%rcx
+  8042a2:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8042a8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8042ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042b3:	4c 89 ee             	mov    %r13,%rsi
+  8042b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042bb:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  8042c2:	00 00 00 
+  8042c5:	ff d0                	call   *%rax
+  8042c7:	89 c3                	mov    %eax,%ebx
+  8042c9:	85 c0                	test   %eax,%eax
+  8042cb:	78 6e                	js     80433b <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8042cd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042d2:	4c 89 ef             	mov    %r13,%rdi
+  8042d5:	48 b8 db 28 80 00 00 	movabs $0x8028db,%rax
+  8042dc:	00 00 00 
+  8042df:	ff d0                	call   *%rax
+  8042e1:	83 f8 02             	cmp    $0x2,%eax
+  8042e4:	0f 85 ab 00 00 00    	jne    804395 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8042ea:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8042f1:	00 00 
+  8042f3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042f7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8042f9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042fd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804304:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804308:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80430a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80430e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804315:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804319:	48 bb a3 2f 80 00 00 	movabs $0x802fa3,%rbx
+  804320:	00 00 00 
+  804323:	ff d3                	call   *%rbx
+  804325:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804329:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80432d:	ff d3                	call   *%rbx
+  80432f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804334:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804339:	eb 4d                	jmp    804388 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80433b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804340:	4c 89 ee             	mov    %r13,%rsi
+  804343:	bf 00 00 00 00       	mov    $0x0,%edi
+  804348:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  80434f:	00 00 00 
+  804352:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804354:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804359:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80435d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804362:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  804369:	00 00 00 
+  80436c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80436e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804373:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804377:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437c:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  804383:	00 00 00 
+  804386:	ff d0                	call   *%rax
+}
+  804388:	89 d8                	mov    %ebx,%eax
+  80438a:	48 83 c4 18          	add    $0x18,%rsp
+  80438e:	5b                   	pop    %rbx
+  80438f:	41 5c                	pop    %r12
+  804391:	41 5d                	pop    %r13
+  804393:	5d                   	pop    %rbp
+  804394:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804395:	48 b9 c8 64 80 00 00 	movabs $0x8064c8,%rcx
+  80439c:	00 00 00 
+  80439f:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  8043a6:	00 00 00 
+  8043a9:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8043ae:	48 bf b7 64 80 00 00 	movabs $0x8064b7,%rdi
+  8043b5:	00 00 00 
+  8043b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043bd:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  8043c4:	00 00 00 
+  8043c7:	41 ff d0             	call   *%r8
+
+00000000008043ca <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8043ca:	55                   	push   %rbp
+  8043cb:	48 89 e5             	mov    %rsp,%rbp
+  8043ce:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043d2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043d6:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  8043dd:	00 00 00 
+  8043e0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043e2:	85 c0                	test   %eax,%eax
+  8043e4:	78 35                	js     80441b <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8043e6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043ea:	48 b8 b5 2f 80 00 00 	movabs $0x802fb5,%rax
+  8043f1:	00 00 00 
+  8043f4:	ff d0                	call   *%rax
+  8043f6:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043f9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043fe:	be 00 10 00 00       	mov    $0x1000,%esi
+  804403:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804407:	48 b8 13 29 80 00 00 	movabs $0x802913,%rax
+  80440e:	00 00 00 
+  804411:	ff d0                	call   *%rax
+  804413:	85 c0                	test   %eax,%eax
+  804415:	0f 94 c0             	sete   %al
+  804418:	0f b6 c0             	movzbl %al,%eax
+}
+  80441b:	c9                   	leave
+  80441c:	c3                   	ret
+
+000000000080441d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80441d:	48 89 f8             	mov    %rdi,%rax
+  804420:	48 c1 e8 27          	shr    $0x27,%rax
+  804424:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80442b:	01 00 00 
+  80442e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804432:	f6 c2 01             	test   $0x1,%dl
+  804435:	74 6d                	je     8044a4 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804437:	48 89 f8             	mov    %rdi,%rax
+  80443a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80443e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804445:	01 00 00 
+  804448:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80444c:	f6 c2 01             	test   $0x1,%dl
+  80444f:	74 62                	je     8044b3 <get_uvpt_entry+0x96>
+  804451:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804458:	01 00 00 
+  80445b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80445f:	f6 c2 80             	test   $0x80,%dl
+  804462:	75 4f                	jne    8044b3 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804464:	48 89 f8             	mov    %rdi,%rax
+  804467:	48 c1 e8 15          	shr    $0x15,%rax
+  80446b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804472:	01 00 00 
+  804475:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804479:	f6 c2 01             	test   $0x1,%dl
+  80447c:	74 44                	je     8044c2 <get_uvpt_entry+0xa5>
+  80447e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804485:	01 00 00 
+  804488:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80448c:	f6 c2 80             	test   $0x80,%dl
+  80448f:	75 31                	jne    8044c2 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804491:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804495:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80449c:	01 00 00 
+  80449f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8044a3:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8044a4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8044ab:	01 00 00 
+  8044ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044b2:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044b3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044ba:	01 00 00 
+  8044bd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044c1:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044c2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044c9:	01 00 00 
+  8044cc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044d0:	c3                   	ret
+
+00000000008044d1 <get_prot>:
+
+int
+get_prot(void *va) {
+  8044d1:	55                   	push   %rbp
+  8044d2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044d5:	48 b8 1d 44 80 00 00 	movabs $0x80441d,%rax
+  8044dc:	00 00 00 
+  8044df:	ff d0                	call   *%rax
+  8044e1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8044e4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8044e9:	89 c1                	mov    %eax,%ecx
+  8044eb:	83 c9 04             	or     $0x4,%ecx
+  8044ee:	f6 c2 01             	test   $0x1,%dl
+  8044f1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8044f4:	89 c1                	mov    %eax,%ecx
+  8044f6:	83 c9 02             	or     $0x2,%ecx
+  8044f9:	f6 c2 02             	test   $0x2,%dl
+  8044fc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8044ff:	89 c1                	mov    %eax,%ecx
+  804501:	83 c9 01             	or     $0x1,%ecx
+  804504:	48 85 d2             	test   %rdx,%rdx
+  804507:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80450a:	89 c1                	mov    %eax,%ecx
+  80450c:	83 c9 40             	or     $0x40,%ecx
+  80450f:	f6 c6 04             	test   $0x4,%dh
+  804512:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804515:	5d                   	pop    %rbp
+  804516:	c3                   	ret
+
+0000000000804517 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804517:	55                   	push   %rbp
+  804518:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80451b:	48 b8 1d 44 80 00 00 	movabs $0x80441d,%rax
+  804522:	00 00 00 
+  804525:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804527:	48 c1 e8 06          	shr    $0x6,%rax
+  80452b:	83 e0 01             	and    $0x1,%eax
+}
+  80452e:	5d                   	pop    %rbp
+  80452f:	c3                   	ret
+
+0000000000804530 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804530:	55                   	push   %rbp
+  804531:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804534:	48 b8 1d 44 80 00 00 	movabs $0x80441d,%rax
+  80453b:	00 00 00 
+  80453e:	ff d0                	call   *%rax
+  804540:	83 e0 01             	and    $0x1,%eax
+}
+  804543:	5d                   	pop    %rbp
+  804544:	c3                   	ret
+
+0000000000804545 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804545:	55                   	push   %rbp
+  804546:	48 89 e5             	mov    %rsp,%rbp
+  804549:	41 57                	push   %r15
+  80454b:	41 56                	push   %r14
+  80454d:	41 55                	push   %r13
+  80454f:	41 54                	push   %r12
+  804551:	53                   	push   %rbx
+  804552:	48 83 ec 28          	sub    $0x28,%rsp
+  804556:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80455a:	48 85 ff             	test   %rdi,%rdi
+  80455d:	74 1e                	je     80457d <foreach_shared_region+0x38>
+  80455f:	49 89 ff             	mov    %rdi,%r15
+  804562:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804568:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80456e:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804575:	01 00 00 
+  804578:	e9 72 02 00 00       	jmp    8047ef <foreach_shared_region+0x2aa>
+    assert(fun);
+  80457d:	48 b9 ec 64 80 00 00 	movabs $0x8064ec,%rcx
+  804584:	00 00 00 
+  804587:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  80458e:	00 00 00 
+  804591:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804596:	48 bf f0 64 80 00 00 	movabs $0x8064f0,%rdi
+  80459d:	00 00 00 
+  8045a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a5:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  8045ac:	00 00 00 
+  8045af:	41 ff d0             	call   *%r8
+  8045b2:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8045b9:	eb 6c                	jmp    804627 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8045bb:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8045c2:	ff ff ff 
+  8045c5:	4c 21 e2             	and    %r12,%rdx
+  8045c8:	48 89 d8             	mov    %rbx,%rax
+  8045cb:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8045d0:	48 83 c0 01          	add    $0x1,%rax
+  8045d4:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8045d8:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8045df:	00 00 00 
+  8045e2:	48 21 c8             	and    %rcx,%rax
+  8045e5:	48 09 d0             	or     %rdx,%rax
+  8045e8:	49 89 c4             	mov    %rax,%r12
+  8045eb:	eb 30                	jmp    80461d <foreach_shared_region+0xd8>
+  8045ed:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8045f4:	ff ff ff 
+  8045f7:	4c 21 e2             	and    %r12,%rdx
+  8045fa:	48 89 d8             	mov    %rbx,%rax
+  8045fd:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804602:	48 83 c0 01          	add    $0x1,%rax
+  804606:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80460a:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804611:	00 00 00 
+  804614:	48 21 c8             	and    %rcx,%rax
+  804617:	48 09 d0             	or     %rdx,%rax
+  80461a:	49 89 c4             	mov    %rax,%r12
+  80461d:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804621:	0f 84 99 01 00 00    	je     8047c0 <foreach_shared_region+0x27b>
+  804627:	4c 89 e3             	mov    %r12,%rbx
+  80462a:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80462e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804635:	01 00 00 
+  804638:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80463c:	a8 01                	test   $0x1,%al
+  80463e:	0f 84 77 ff ff ff    	je     8045bb <foreach_shared_region+0x76>
+  804644:	a8 80                	test   $0x80,%al
+  804646:	74 19                	je     804661 <foreach_shared_region+0x11c>
+  804648:	f6 c4 04             	test   $0x4,%ah
+  80464b:	74 a0                	je     8045ed <foreach_shared_region+0xa8>
+  80464d:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804654:	40 
+  804655:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804659:	4c 89 e7             	mov    %r12,%rdi
+  80465c:	41 ff d7             	call   *%r15
+  80465f:	eb 8c                	jmp    8045ed <foreach_shared_region+0xa8>
+  804661:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804668:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80466c:	eb 46                	jmp    8046b4 <foreach_shared_region+0x16f>
+  80466e:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804675:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80467b:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80467f:	48 c1 e0 15          	shl    $0x15,%rax
+  804683:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804688:	49 09 c4             	or     %rax,%r12
+  80468b:	eb 1d                	jmp    8046aa <foreach_shared_region+0x165>
+  80468d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804694:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80469a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80469e:	48 c1 e0 15          	shl    $0x15,%rax
+  8046a2:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8046a7:	49 09 c4             	or     %rax,%r12
+  8046aa:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8046ae:	0f 84 d3 00 00 00    	je     804787 <foreach_shared_region+0x242>
+  8046b4:	4c 89 e3             	mov    %r12,%rbx
+  8046b7:	48 c1 eb 15          	shr    $0x15,%rbx
+  8046bb:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8046c2:	01 00 00 
+  8046c5:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8046c9:	a8 01                	test   $0x1,%al
+  8046cb:	74 a1                	je     80466e <foreach_shared_region+0x129>
+  8046cd:	a8 80                	test   $0x80,%al
+  8046cf:	74 19                	je     8046ea <foreach_shared_region+0x1a5>
+  8046d1:	f6 c4 04             	test   $0x4,%ah
+  8046d4:	74 b7                	je     80468d <foreach_shared_region+0x148>
+  8046d6:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8046dd:	00 
+  8046de:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046e2:	4c 89 e7             	mov    %r12,%rdi
+  8046e5:	41 ff d7             	call   *%r15
+  8046e8:	eb a3                	jmp    80468d <foreach_shared_region+0x148>
+  8046ea:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8046f0:	eb 3b                	jmp    80472d <foreach_shared_region+0x1e8>
+  8046f2:	f6 c4 04             	test   $0x4,%ah
+  8046f5:	74 12                	je     804709 <foreach_shared_region+0x1c4>
+  8046f7:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8046fe:	00 
+  8046ff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804703:	4c 89 e7             	mov    %r12,%rdi
+  804706:	41 ff d7             	call   *%r15
+  804709:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804710:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804716:	48 83 c3 01          	add    $0x1,%rbx
+  80471a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80471e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804724:	49 09 dc             	or     %rbx,%r12
+  804727:	41 83 ed 01          	sub    $0x1,%r13d
+  80472b:	74 2f                	je     80475c <foreach_shared_region+0x217>
+  80472d:	4c 89 e3             	mov    %r12,%rbx
+  804730:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804734:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804738:	a8 01                	test   $0x1,%al
+  80473a:	75 b6                	jne    8046f2 <foreach_shared_region+0x1ad>
+  80473c:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804743:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804749:	48 83 c3 01          	add    $0x1,%rbx
+  80474d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804751:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804757:	49 09 dc             	or     %rbx,%r12
+  80475a:	eb cb                	jmp    804727 <foreach_shared_region+0x1e2>
+  80475c:	4c 89 e0             	mov    %r12,%rax
+  80475f:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804765:	49 c1 ec 15          	shr    $0x15,%r12
+  804769:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804770:	49 83 c4 01          	add    $0x1,%r12
+  804774:	49 c1 e4 15          	shl    $0x15,%r12
+  804778:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80477f:	49 09 c4             	or     %rax,%r12
+  804782:	e9 23 ff ff ff       	jmp    8046aa <foreach_shared_region+0x165>
+  804787:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80478b:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804792:	ff ff ff 
+  804795:	4c 21 e0             	and    %r12,%rax
+  804798:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80479c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8047a3:	49 83 c4 01          	add    $0x1,%r12
+  8047a7:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8047ab:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8047b2:	00 00 00 
+  8047b5:	49 21 d4             	and    %rdx,%r12
+  8047b8:	49 09 c4             	or     %rax,%r12
+  8047bb:	e9 5d fe ff ff       	jmp    80461d <foreach_shared_region+0xd8>
+  8047c0:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8047c7:	00 ff ff 
+  8047ca:	4c 21 e0             	and    %r12,%rax
+  8047cd:	49 c1 ec 27          	shr    $0x27,%r12
+  8047d1:	49 83 c4 01          	add    $0x1,%r12
+  8047d5:	49 c1 e4 27          	shl    $0x27,%r12
+  8047d9:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8047e0:	ff 00 00 
+  8047e3:	49 21 d4             	and    %rdx,%r12
+  8047e6:	49 09 c4             	or     %rax,%r12
+  8047e9:	41 83 ed 01          	sub    $0x1,%r13d
+  8047ed:	74 48                	je     804837 <foreach_shared_region+0x2f2>
+  8047ef:	4c 89 e0             	mov    %r12,%rax
+  8047f2:	48 c1 e8 27          	shr    $0x27,%rax
+  8047f6:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8047fd:	01 00 00 
+  804800:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804804:	f6 c2 01             	test   $0x1,%dl
+  804807:	0f 85 a5 fd ff ff    	jne    8045b2 <foreach_shared_region+0x6d>
+  80480d:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804814:	00 ff ff 
+  804817:	4c 21 e2             	and    %r12,%rdx
+  80481a:	48 83 c0 01          	add    $0x1,%rax
+  80481e:	48 c1 e0 27          	shl    $0x27,%rax
+  804822:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804829:	ff 00 00 
+  80482c:	48 21 c8             	and    %rcx,%rax
+  80482f:	48 09 d0             	or     %rdx,%rax
+  804832:	49 89 c4             	mov    %rax,%r12
+  804835:	eb b2                	jmp    8047e9 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804837:	4d 85 e4             	test   %r12,%r12
+  80483a:	75 14                	jne    804850 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80483c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804841:	48 83 c4 28          	add    $0x28,%rsp
+  804845:	5b                   	pop    %rbx
+  804846:	41 5c                	pop    %r12
+  804848:	41 5d                	pop    %r13
+  80484a:	41 5e                	pop    %r14
+  80484c:	41 5f                	pop    %r15
+  80484e:	5d                   	pop    %rbp
+  80484f:	c3                   	ret
+    assert(addr == 0);
+  804850:	48 b9 fb 64 80 00 00 	movabs $0x8064fb,%rcx
+  804857:	00 00 00 
+  80485a:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  804861:	00 00 00 
+  804864:	be 67 00 00 00       	mov    $0x67,%esi
+  804869:	48 bf f0 64 80 00 00 	movabs $0x8064f0,%rdi
+  804870:	00 00 00 
+  804873:	b8 00 00 00 00       	mov    $0x0,%eax
+  804878:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  80487f:	00 00 00 
+  804882:	41 ff d0             	call   *%r8
+
+0000000000804885 <vsys_gettime>:
+    // LAB 12: Your code here DONE
+    if (num < 0 || num >= NVSYSCALLS) {
+        return -E_NO_SYS;
+    }
+
+    return vsys[num];
+  804885:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  80488c:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  80488e:	c3                   	ret
+
+000000000080488f <vsys_gettimems>:
+    return vsys[num];
+  80488f:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  804896:	00 00 
+
+uint32_t
+vsys_gettimems() {
+    return (uint32_t)vsyscall(VSYS_gettimems);
+}
+  804898:	c3                   	ret
+
+0000000000804899 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804899:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8048a0:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8048a3:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8048a9:	eb 33                	jmp    8048de <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8048ab:	48 83 c0 20          	add    $0x20,%rax
+  8048af:	4c 39 c0             	cmp    %r8,%rax
+  8048b2:	74 25                	je     8048d9 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8048b4:	48 8b 10             	mov    (%rax),%rdx
+  8048b7:	48 85 d2             	test   %rdx,%rdx
+  8048ba:	74 ef                	je     8048ab <mmap_place+0x12>
+  8048bc:	48 89 d1             	mov    %rdx,%rcx
+  8048bf:	48 03 48 08          	add    0x8(%rax),%rcx
+  8048c3:	48 39 cf             	cmp    %rcx,%rdi
+  8048c6:	73 e3                	jae    8048ab <mmap_place+0x12>
+  8048c8:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8048cc:	4c 39 ca             	cmp    %r9,%rdx
+  8048cf:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8048d3:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8048d7:	eb d2                	jmp    8048ab <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8048d9:	45 84 d2             	test   %r10b,%r10b
+  8048dc:	74 12                	je     8048f0 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8048de:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8048e5:	00 00 00 
+        moved = 0;
+  8048e8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8048ee:	eb c4                	jmp    8048b4 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8048f0:	48 01 fe             	add    %rdi,%rsi
+  8048f3:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8048fa:	00 00 00 
+  8048fd:	48 39 f0             	cmp    %rsi,%rax
+  804900:	b8 00 00 00 00       	mov    $0x0,%eax
+  804905:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804909:	c3                   	ret
+
+000000000080490a <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  80490a:	55                   	push   %rbp
+  80490b:	48 89 e5             	mov    %rsp,%rbp
+  80490e:	41 57                	push   %r15
+  804910:	41 56                	push   %r14
+  804912:	41 55                	push   %r13
+  804914:	41 54                	push   %r12
+  804916:	53                   	push   %rbx
+  804917:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80491b:	48 8b 1f             	mov    (%rdi),%rbx
+  80491e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804925:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80492c:	00 00 00 
+  80492f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804934:	eb 12                	jmp    804948 <mmap_pgfault+0x3e>
+  804936:	48 83 c2 01          	add    $0x1,%rdx
+  80493a:	48 83 c0 20          	add    $0x20,%rax
+  80493e:	48 83 fa 20          	cmp    $0x20,%rdx
+  804942:	0f 84 04 01 00 00    	je     804a4c <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804948:	48 8b 08             	mov    (%rax),%rcx
+  80494b:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80494f:	48 39 de             	cmp    %rbx,%rsi
+  804952:	73 e2                	jae    804936 <mmap_pgfault+0x2c>
+  804954:	48 03 48 08          	add    0x8(%rax),%rcx
+  804958:	48 39 cb             	cmp    %rcx,%rbx
+  80495b:	73 d9                	jae    804936 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80495d:	48 c1 e2 05          	shl    $0x5,%rdx
+  804961:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804968:	00 00 00 
+  80496b:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80496f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804973:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804977:	f6 c2 01             	test   $0x1,%dl
+  80497a:	0f 84 e0 00 00 00    	je     804a60 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804980:	b8 00 00 00 00       	mov    $0x0,%eax
+  804985:	f6 c2 02             	test   $0x2,%dl
+  804988:	0f 84 c3 00 00 00    	je     804a51 <mmap_pgfault+0x147>
+  80498e:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804995:	ff ff ff 
+  804998:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80499c:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  8049a3:	00 00 00 
+  8049a6:	48 39 ca             	cmp    %rcx,%rdx
+  8049a9:	0f 85 a2 00 00 00    	jne    804a51 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8049af:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8049b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049b9:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8049c0:	00 00 00 
+  8049c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049c8:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  8049cf:	00 00 00 
+  8049d2:	ff d0                	call   *%rax
+  8049d4:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8049d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049db:	85 d2                	test   %edx,%edx
+  8049dd:	78 72                	js     804a51 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8049df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049e4:	48 89 de             	mov    %rbx,%rsi
+  8049e7:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8049ee:	00 00 00 
+  8049f1:	4c 89 e7             	mov    %r12,%rdi
+  8049f4:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  8049fb:	00 00 00 
+  8049fe:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804a00:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804a06:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a0c:	48 89 d9             	mov    %rbx,%rcx
+  804a0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a14:	4c 89 e6             	mov    %r12,%rsi
+  804a17:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a1c:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  804a23:	00 00 00 
+  804a26:	ff d0                	call   *%rax
+  804a28:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804a2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a2f:	4c 89 e6             	mov    %r12,%rsi
+  804a32:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a37:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  804a3e:	00 00 00 
+  804a41:	ff d0                	call   *%rax
+    return res >= 0;
+  804a43:	89 d8                	mov    %ebx,%eax
+  804a45:	f7 d0                	not    %eax
+  804a47:	c1 e8 1f             	shr    $0x1f,%eax
+  804a4a:	eb 05                	jmp    804a51 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804a51:	48 83 c4 18          	add    $0x18,%rsp
+  804a55:	5b                   	pop    %rbx
+  804a56:	41 5c                	pop    %r12
+  804a58:	41 5d                	pop    %r13
+  804a5a:	41 5e                	pop    %r14
+  804a5c:	41 5f                	pop    %r15
+  804a5e:	5d                   	pop    %rbp
+  804a5f:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804a60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a64:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804a68:	4c 03 30             	add    (%rax),%r14
+  804a6b:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804a72:	49 39 c6             	cmp    %rax,%r14
+  804a75:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a79:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804a80:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a86:	49 bf 30 45 80 00 00 	movabs $0x804530,%r15
+  804a8d:	00 00 00 
+  804a90:	4d 39 f4             	cmp    %r14,%r12
+  804a93:	73 1d                	jae    804ab2 <mmap_pgfault+0x1a8>
+  804a95:	4c 89 e7             	mov    %r12,%rdi
+  804a98:	41 ff d7             	call   *%r15
+  804a9b:	84 c0                	test   %al,%al
+  804a9d:	75 13                	jne    804ab2 <mmap_pgfault+0x1a8>
+  804a9f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804aa6:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804aad:	4d 39 f4             	cmp    %r14,%r12
+  804ab0:	72 e3                	jb     804a95 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804ab2:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804ab8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804abc:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804ac0:	74 2a                	je     804aec <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804ac2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ac6:	89 de                	mov    %ebx,%esi
+  804ac8:	2b 30                	sub    (%rax),%esi
+  804aca:	03 70 1c             	add    0x1c(%rax),%esi
+  804acd:	8b 78 18             	mov    0x18(%rax),%edi
+  804ad0:	4c 89 e9             	mov    %r13,%rcx
+  804ad3:	48 89 da             	mov    %rbx,%rdx
+  804ad6:	48 b8 8e 3c 80 00 00 	movabs $0x803c8e,%rax
+  804add:	00 00 00 
+  804ae0:	ff d0                	call   *%rax
+    return res > 0;
+  804ae2:	85 c0                	test   %eax,%eax
+  804ae4:	0f 9f c0             	setg   %al
+  804ae7:	e9 65 ff ff ff       	jmp    804a51 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804aec:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804af0:	eb d0                	jmp    804ac2 <mmap_pgfault+0x1b8>
+
+0000000000804af2 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804af2:	55                   	push   %rbp
+  804af3:	48 89 e5             	mov    %rsp,%rbp
+  804af6:	41 57                	push   %r15
+  804af8:	41 56                	push   %r14
+  804afa:	41 55                	push   %r13
+  804afc:	41 54                	push   %r12
+  804afe:	53                   	push   %rbx
+  804aff:	48 83 ec 28          	sub    $0x28,%rsp
+  804b03:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804b07:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804b0a:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804b11:	ff ff ff 
+  804b14:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b1d:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804b24:	00 00 00 
+  804b27:	48 39 ca             	cmp    %rcx,%rdx
+  804b2a:	0f 85 e5 00 00 00    	jne    804c15 <mmap_writeback+0x123>
+  804b30:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804b33:	4c 39 ee             	cmp    %r13,%rsi
+  804b36:	0f 83 e8 00 00 00    	jae    804c24 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b3c:	49 be 30 45 80 00 00 	movabs $0x804530,%r14
+  804b43:	00 00 00 
+  804b46:	49 bf 17 45 80 00 00 	movabs $0x804517,%r15
+  804b4d:	00 00 00 
+  804b50:	eb 10                	jmp    804b62 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804b52:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804b59:	4d 39 ec             	cmp    %r13,%r12
+  804b5c:	0f 83 ae 00 00 00    	jae    804c10 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b62:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804b66:	4c 89 e7             	mov    %r12,%rdi
+  804b69:	41 ff d6             	call   *%r14
+  804b6c:	84 c0                	test   %al,%al
+  804b6e:	74 e2                	je     804b52 <mmap_writeback+0x60>
+  804b70:	4c 89 e7             	mov    %r12,%rdi
+  804b73:	41 ff d7             	call   *%r15
+  804b76:	84 c0                	test   %al,%al
+  804b78:	74 d8                	je     804b52 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804b7a:	4c 89 e3             	mov    %r12,%rbx
+  804b7d:	4d 39 ec             	cmp    %r13,%r12
+  804b80:	73 20                	jae    804ba2 <mmap_writeback+0xb0>
+  804b82:	48 89 df             	mov    %rbx,%rdi
+  804b85:	41 ff d6             	call   *%r14
+  804b88:	84 c0                	test   %al,%al
+  804b8a:	74 16                	je     804ba2 <mmap_writeback+0xb0>
+  804b8c:	48 89 df             	mov    %rbx,%rdi
+  804b8f:	41 ff d7             	call   *%r15
+  804b92:	84 c0                	test   %al,%al
+  804b94:	74 0c                	je     804ba2 <mmap_writeback+0xb0>
+  804b96:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804b9d:	4c 39 eb             	cmp    %r13,%rbx
+  804ba0:	72 e0                	jb     804b82 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804ba2:	48 89 d9             	mov    %rbx,%rcx
+  804ba5:	4c 29 e1             	sub    %r12,%rcx
+  804ba8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bac:	44 89 e6             	mov    %r12d,%esi
+  804baf:	2b 30                	sub    (%rax),%esi
+  804bb1:	49 89 c4             	mov    %rax,%r12
+  804bb4:	03 70 1c             	add    0x1c(%rax),%esi
+  804bb7:	8b 78 18             	mov    0x18(%rax),%edi
+  804bba:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804bbe:	48 89 ca             	mov    %rcx,%rdx
+  804bc1:	48 b8 17 3d 80 00 00 	movabs $0x803d17,%rax
+  804bc8:	00 00 00 
+  804bcb:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804bcd:	85 c0                	test   %eax,%eax
+  804bcf:	78 44                	js     804c15 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804bd1:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804bd6:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804bd9:	41 89 c1             	mov    %eax,%r9d
+  804bdc:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804be3:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804be7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804beb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bf0:	48 89 ce             	mov    %rcx,%rsi
+  804bf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bf8:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  804bff:	00 00 00 
+  804c02:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804c04:	85 c0                	test   %eax,%eax
+  804c06:	78 0d                	js     804c15 <mmap_writeback+0x123>
+  804c08:	49 89 dc             	mov    %rbx,%r12
+  804c0b:	e9 49 ff ff ff       	jmp    804b59 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804c10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c15:	48 83 c4 28          	add    $0x28,%rsp
+  804c19:	5b                   	pop    %rbx
+  804c1a:	41 5c                	pop    %r12
+  804c1c:	41 5d                	pop    %r13
+  804c1e:	41 5e                	pop    %r14
+  804c20:	41 5f                	pop    %r15
+  804c22:	5d                   	pop    %rbp
+  804c23:	c3                   	ret
+    return 0;
+  804c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c29:	eb ea                	jmp    804c15 <mmap_writeback+0x123>
+
+0000000000804c2b <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804c2b:	55                   	push   %rbp
+  804c2c:	48 89 e5             	mov    %rsp,%rbp
+  804c2f:	41 57                	push   %r15
+  804c31:	41 56                	push   %r14
+  804c33:	41 55                	push   %r13
+  804c35:	41 54                	push   %r12
+  804c37:	53                   	push   %rbx
+  804c38:	48 83 ec 38          	sub    $0x38,%rsp
+  804c3c:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c40:	48 85 f6             	test   %rsi,%rsi
+  804c43:	0f 84 0c 02 00 00    	je     804e55 <mmap+0x22a>
+  804c49:	49 89 ff             	mov    %rdi,%r15
+  804c4c:	49 89 f4             	mov    %rsi,%r12
+  804c4f:	41 89 d5             	mov    %edx,%r13d
+  804c52:	41 89 ce             	mov    %ecx,%r14d
+  804c55:	44 89 cb             	mov    %r9d,%ebx
+  804c58:	45 85 c9             	test   %r9d,%r9d
+  804c5b:	0f 88 f4 01 00 00    	js     804e55 <mmap+0x22a>
+  804c61:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c68:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804c6f:	0f 85 e7 01 00 00    	jne    804e5c <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804c75:	83 e2 fd             	and    $0xfffffffd,%edx
+  804c78:	83 fa 04             	cmp    $0x4,%edx
+  804c7b:	0f 85 db 01 00 00    	jne    804e5c <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804c81:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804c84:	83 fa 01             	cmp    $0x1,%edx
+  804c87:	0f 87 cf 01 00 00    	ja     804e5c <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804c8d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804c91:	44 89 c7             	mov    %r8d,%edi
+  804c94:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  804c9b:	00 00 00 
+  804c9e:	ff d0                	call   *%rax
+  804ca0:	89 c2                	mov    %eax,%edx
+  804ca2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ca9:	85 d2                	test   %edx,%edx
+  804cab:	0f 88 ab 01 00 00    	js     804e5c <mmap+0x231>
+  804cb1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804cb5:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804cbc:	00 00 00 
+  804cbf:	8b 09                	mov    (%rcx),%ecx
+  804cc1:	39 0a                	cmp    %ecx,(%rdx)
+  804cc3:	0f 85 93 01 00 00    	jne    804e5c <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804cc9:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ccc:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ccf:	83 fa 01             	cmp    $0x1,%edx
+  804cd2:	0f 84 84 01 00 00    	je     804e5c <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804cd8:	41 83 fe 01          	cmp    $0x1,%r14d
+  804cdc:	74 42                	je     804d20 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804cde:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804ce5:	4c 89 e6             	mov    %r12,%rsi
+  804ce8:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804cef:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804cf3:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804cf7:	4d 85 ff             	test   %r15,%r15
+  804cfa:	74 67                	je     804d63 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804cfc:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804d03:	75 0f                	jne    804d14 <mmap+0xe9>
+  804d05:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804d0c:	00 00 00 
+  804d0f:	49 39 c7             	cmp    %rax,%r15
+  804d12:	77 1b                	ja     804d2f <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d14:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d1b:	e9 3c 01 00 00       	jmp    804e5c <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d20:	41 f6 c5 02          	test   $0x2,%r13b
+  804d24:	74 b8                	je     804cde <mmap+0xb3>
+  804d26:	85 d2                	test   %edx,%edx
+  804d28:	75 b4                	jne    804cde <mmap+0xb3>
+  804d2a:	e9 2d 01 00 00       	jmp    804e5c <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d2f:	4c 89 ff             	mov    %r15,%rdi
+  804d32:	48 b8 99 48 80 00 00 	movabs $0x804899,%rax
+  804d39:	00 00 00 
+  804d3c:	ff d0                	call   *%rax
+  804d3e:	48 89 c2             	mov    %rax,%rdx
+  804d41:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d48:	49 39 d7             	cmp    %rdx,%r15
+  804d4b:	0f 85 0b 01 00 00    	jne    804e5c <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d51:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d58:	00 00 00 
+  804d5b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d61:	eb 44                	jmp    804da7 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d63:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804d67:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804d6e:	00 00 00 
+  804d71:	48 b8 99 48 80 00 00 	movabs $0x804899,%rax
+  804d78:	00 00 00 
+  804d7b:	ff d0                	call   *%rax
+  804d7d:	48 89 c7             	mov    %rax,%rdi
+  804d80:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804d84:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d8b:	48 85 ff             	test   %rdi,%rdi
+  804d8e:	75 c1                	jne    804d51 <mmap+0x126>
+  804d90:	e9 c7 00 00 00       	jmp    804e5c <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d95:	49 83 c4 01          	add    $0x1,%r12
+  804d99:	48 83 c0 20          	add    $0x20,%rax
+  804d9d:	49 83 fc 20          	cmp    $0x20,%r12
+  804da1:	0f 84 a5 00 00 00    	je     804e4c <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804da7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804dab:	75 e8                	jne    804d95 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804dad:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804db1:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  804db8:	00 00 00 
+  804dbb:	ff d0                	call   *%rax
+  804dbd:	89 c2                	mov    %eax,%edx
+  804dbf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804dc6:	85 d2                	test   %edx,%edx
+  804dc8:	0f 88 8e 00 00 00    	js     804e5c <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804dce:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804dd2:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  804dd9:	00 00 00 
+  804ddc:	ff d0                	call   *%rax
+  804dde:	89 c6                	mov    %eax,%esi
+  804de0:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804de3:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  804dea:	00 00 00 
+  804ded:	ff d0                	call   *%rax
+  804def:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804df2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804df9:	45 85 ff             	test   %r15d,%r15d
+  804dfc:	78 5e                	js     804e5c <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804dfe:	49 c1 e4 05          	shl    $0x5,%r12
+  804e02:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e09:	00 00 00 
+  804e0c:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804e0f:	48 bf 0a 49 80 00 00 	movabs $0x80490a,%rdi
+  804e16:	00 00 00 
+  804e19:	48 b8 35 53 80 00 00 	movabs $0x805335,%rax
+  804e20:	00 00 00 
+  804e23:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804e25:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e29:	49 89 04 24          	mov    %rax,(%r12)
+  804e2d:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804e31:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804e36:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804e3b:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804e40:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804e45:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804e4a:	eb 10                	jmp    804e5c <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804e4c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e53:	eb 07                	jmp    804e5c <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804e55:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804e5c:	48 83 c4 38          	add    $0x38,%rsp
+  804e60:	5b                   	pop    %rbx
+  804e61:	41 5c                	pop    %r12
+  804e63:	41 5d                	pop    %r13
+  804e65:	41 5e                	pop    %r14
+  804e67:	41 5f                	pop    %r15
+  804e69:	5d                   	pop    %rbp
+  804e6a:	c3                   	ret
+
+0000000000804e6b <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804e6b:	55                   	push   %rbp
+  804e6c:	48 89 e5             	mov    %rsp,%rbp
+  804e6f:	41 57                	push   %r15
+  804e71:	41 56                	push   %r14
+  804e73:	41 55                	push   %r13
+  804e75:	41 54                	push   %r12
+  804e77:	53                   	push   %rbx
+  804e78:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804e7c:	49 89 fe             	mov    %rdi,%r14
+  804e7f:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804e86:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804e8d:	00 
+  804e8e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e95:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804e9c:	00 00 00 
+  804e9f:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ea6:	49 bf f2 4a 80 00 00 	movabs $0x804af2,%r15
+  804ead:	00 00 00 
+  804eb0:	eb 09                	jmp    804ebb <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804eb2:	48 83 c3 20          	add    $0x20,%rbx
+  804eb6:	4c 39 eb             	cmp    %r13,%rbx
+  804eb9:	74 33                	je     804eee <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ebb:	48 89 df             	mov    %rbx,%rdi
+  804ebe:	48 8b 33             	mov    (%rbx),%rsi
+  804ec1:	4c 39 e6             	cmp    %r12,%rsi
+  804ec4:	73 ec                	jae    804eb2 <msync+0x47>
+  804ec6:	48 85 f6             	test   %rsi,%rsi
+  804ec9:	74 e7                	je     804eb2 <msync+0x47>
+  804ecb:	48 89 f2             	mov    %rsi,%rdx
+  804ece:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804ed2:	49 39 d6             	cmp    %rdx,%r14
+  804ed5:	73 db                	jae    804eb2 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ed7:	4c 39 e2             	cmp    %r12,%rdx
+  804eda:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ede:	4c 39 f6             	cmp    %r14,%rsi
+  804ee1:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ee5:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804ee8:	85 c0                	test   %eax,%eax
+  804eea:	79 c6                	jns    804eb2 <msync+0x47>
+  804eec:	eb 05                	jmp    804ef3 <msync+0x88>
+    }
+
+    return 0;
+  804eee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ef3:	48 83 c4 08          	add    $0x8,%rsp
+  804ef7:	5b                   	pop    %rbx
+  804ef8:	41 5c                	pop    %r12
+  804efa:	41 5d                	pop    %r13
+  804efc:	41 5e                	pop    %r14
+  804efe:	41 5f                	pop    %r15
+  804f00:	5d                   	pop    %rbp
+  804f01:	c3                   	ret
+
+0000000000804f02 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804f02:	55                   	push   %rbp
+  804f03:	48 89 e5             	mov    %rsp,%rbp
+  804f06:	41 57                	push   %r15
+  804f08:	41 56                	push   %r14
+  804f0a:	41 55                	push   %r13
+  804f0c:	41 54                	push   %r12
+  804f0e:	53                   	push   %rbx
+  804f0f:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804f13:	49 89 ff             	mov    %rdi,%r15
+  804f16:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f1d:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f24:	00 
+  804f25:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f2c:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804f33:	00 00 00 
+  804f36:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f3d:	48 89 d8             	mov    %rbx,%rax
+  804f40:	eb 09                	jmp    804f4b <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f42:	48 83 c0 20          	add    $0x20,%rax
+  804f46:	4c 39 f0             	cmp    %r14,%rax
+  804f49:	74 40                	je     804f8b <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f4b:	48 8b 10             	mov    (%rax),%rdx
+  804f4e:	4c 39 e2             	cmp    %r12,%rdx
+  804f51:	73 ef                	jae    804f42 <munmap+0x40>
+  804f53:	48 85 d2             	test   %rdx,%rdx
+  804f56:	74 ea                	je     804f42 <munmap+0x40>
+  804f58:	48 89 d7             	mov    %rdx,%rdi
+  804f5b:	48 03 78 08          	add    0x8(%rax),%rdi
+  804f5f:	49 39 ff             	cmp    %rdi,%r15
+  804f62:	73 de                	jae    804f42 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804f64:	49 39 fc             	cmp    %rdi,%r12
+  804f67:	72 05                	jb     804f6e <munmap+0x6c>
+  804f69:	4c 39 fa             	cmp    %r15,%rdx
+  804f6c:	73 d4                	jae    804f42 <munmap+0x40>
+  804f6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804f73:	48 83 c4 08          	add    $0x8,%rsp
+  804f77:	5b                   	pop    %rbx
+  804f78:	41 5c                	pop    %r12
+  804f7a:	41 5d                	pop    %r13
+  804f7c:	41 5e                	pop    %r14
+  804f7e:	41 5f                	pop    %r15
+  804f80:	5d                   	pop    %rbp
+  804f81:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f82:	48 83 c3 20          	add    $0x20,%rbx
+  804f86:	4c 39 f3             	cmp    %r14,%rbx
+  804f89:	74 5c                	je     804fe7 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f8b:	48 8b 33             	mov    (%rbx),%rsi
+  804f8e:	4c 39 e6             	cmp    %r12,%rsi
+  804f91:	73 ef                	jae    804f82 <munmap+0x80>
+  804f93:	48 85 f6             	test   %rsi,%rsi
+  804f96:	74 ea                	je     804f82 <munmap+0x80>
+  804f98:	48 89 f2             	mov    %rsi,%rdx
+  804f9b:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804f9f:	49 39 d7             	cmp    %rdx,%r15
+  804fa2:	73 de                	jae    804f82 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804fa4:	48 89 df             	mov    %rbx,%rdi
+  804fa7:	48 b8 f2 4a 80 00 00 	movabs $0x804af2,%rax
+  804fae:	00 00 00 
+  804fb1:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804fb3:	85 c0                	test   %eax,%eax
+  804fb5:	78 bc                	js     804f73 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804fb7:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804fbb:	48 8b 33             	mov    (%rbx),%rsi
+  804fbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fc3:	48 b8 1d 2a 80 00 00 	movabs $0x802a1d,%rax
+  804fca:	00 00 00 
+  804fcd:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804fcf:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804fd2:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  804fd9:	00 00 00 
+  804fdc:	ff d0                	call   *%rax
+        reg->start = 0;
+  804fde:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804fe5:	eb 9b                	jmp    804f82 <munmap+0x80>
+    return 0;
+  804fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fec:	eb 85                	jmp    804f73 <munmap+0x71>
+
+0000000000804fee <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff3:	c3                   	ret
+
+0000000000804ff4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804ff4:	55                   	push   %rbp
+  804ff5:	48 89 e5             	mov    %rsp,%rbp
+  804ff8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804ffb:	48 be 05 65 80 00 00 	movabs $0x806505,%rsi
+  805002:	00 00 00 
+  805005:	48 b8 e0 21 80 00 00 	movabs $0x8021e0,%rax
+  80500c:	00 00 00 
+  80500f:	ff d0                	call   *%rax
+    return 0;
+}
+  805011:	b8 00 00 00 00       	mov    $0x0,%eax
+  805016:	5d                   	pop    %rbp
+  805017:	c3                   	ret
+
+0000000000805018 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805018:	55                   	push   %rbp
+  805019:	48 89 e5             	mov    %rsp,%rbp
+  80501c:	41 57                	push   %r15
+  80501e:	41 56                	push   %r14
+  805020:	41 55                	push   %r13
+  805022:	41 54                	push   %r12
+  805024:	53                   	push   %rbx
+  805025:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80502c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805033:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80503a:	00 00 00 00 
+  80503e:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805045:	00 00 00 00 
+  805049:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805050:	00 00 00 00 
+  805054:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80505b:	00 00 00 00 
+  80505f:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805066:	00 00 00 00 
+  80506a:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805071:	00 00 00 00 
+  805075:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80507c:	00 
+  80507d:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805084:	00 
+  805085:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80508c:	00 
+  80508d:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805094:	00 
+  805095:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80509c:	00 
+  80509d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8050a4:	00 
+  8050a5:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8050ac:	00 
+  8050ad:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8050b4:	00 
+  8050b5:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8050bc:	00 
+  8050bd:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8050c4:	00 
+    for (res = 0; res < n; res += inc) {
+  8050c5:	48 85 d2             	test   %rdx,%rdx
+  8050c8:	74 7a                	je     805144 <devcons_write+0x12c>
+  8050ca:	49 89 d6             	mov    %rdx,%r14
+  8050cd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050d3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8050d8:	49 bf 30 25 80 00 00 	movabs $0x802530,%r15
+  8050df:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8050e2:	4c 89 f3             	mov    %r14,%rbx
+  8050e5:	48 29 f3             	sub    %rsi,%rbx
+  8050e8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8050ed:	48 39 c3             	cmp    %rax,%rbx
+  8050f0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8050f4:	4c 63 eb             	movslq %ebx,%r13
+  8050f7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8050fe:	48 01 c6             	add    %rax,%rsi
+  805101:	4c 89 ea             	mov    %r13,%rdx
+  805104:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80510b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80510e:	4c 89 ee             	mov    %r13,%rsi
+  805111:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805118:	48 b8 5d 27 80 00 00 	movabs $0x80275d,%rax
+  80511f:	00 00 00 
+  805122:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805124:	41 01 dc             	add    %ebx,%r12d
+  805127:	49 63 f4             	movslq %r12d,%rsi
+  80512a:	4c 39 f6             	cmp    %r14,%rsi
+  80512d:	72 b3                	jb     8050e2 <devcons_write+0xca>
+    return res;
+  80512f:	49 63 c4             	movslq %r12d,%rax
+}
+  805132:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805139:	5b                   	pop    %rbx
+  80513a:	41 5c                	pop    %r12
+  80513c:	41 5d                	pop    %r13
+  80513e:	41 5e                	pop    %r14
+  805140:	41 5f                	pop    %r15
+  805142:	5d                   	pop    %rbp
+  805143:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805144:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80514a:	eb e3                	jmp    80512f <devcons_write+0x117>
+
+000000000080514c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80514c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80514f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805154:	48 85 c0             	test   %rax,%rax
+  805157:	74 55                	je     8051ae <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805159:	55                   	push   %rbp
+  80515a:	48 89 e5             	mov    %rsp,%rbp
+  80515d:	41 55                	push   %r13
+  80515f:	41 54                	push   %r12
+  805161:	53                   	push   %rbx
+  805162:	48 83 ec 08          	sub    $0x8,%rsp
+  805166:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805169:	48 bb 90 27 80 00 00 	movabs $0x802790,%rbx
+  805170:	00 00 00 
+  805173:	49 bc a4 28 80 00 00 	movabs $0x8028a4,%r12
+  80517a:	00 00 00 
+  80517d:	eb 03                	jmp    805182 <devcons_read+0x36>
+  80517f:	41 ff d4             	call   *%r12
+  805182:	ff d3                	call   *%rbx
+  805184:	85 c0                	test   %eax,%eax
+  805186:	74 f7                	je     80517f <devcons_read+0x33>
+    if (c < 0) return c;
+  805188:	48 63 d0             	movslq %eax,%rdx
+  80518b:	78 13                	js     8051a0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80518d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805192:	83 f8 04             	cmp    $0x4,%eax
+  805195:	74 09                	je     8051a0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805197:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80519b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8051a0:	48 89 d0             	mov    %rdx,%rax
+  8051a3:	48 83 c4 08          	add    $0x8,%rsp
+  8051a7:	5b                   	pop    %rbx
+  8051a8:	41 5c                	pop    %r12
+  8051aa:	41 5d                	pop    %r13
+  8051ac:	5d                   	pop    %rbp
+  8051ad:	c3                   	ret
+  8051ae:	48 89 d0             	mov    %rdx,%rax
+  8051b1:	c3                   	ret
+
+00000000008051b2 <cputchar>:
+cputchar(int ch) {
+  8051b2:	55                   	push   %rbp
+  8051b3:	48 89 e5             	mov    %rsp,%rbp
+  8051b6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8051ba:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8051be:	be 01 00 00 00       	mov    $0x1,%esi
+  8051c3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8051c7:	48 b8 5d 27 80 00 00 	movabs $0x80275d,%rax
+  8051ce:	00 00 00 
+  8051d1:	ff d0                	call   *%rax
+}
+  8051d3:	c9                   	leave
+  8051d4:	c3                   	ret
+
+00000000008051d5 <getchar>:
+getchar(void) {
+  8051d5:	55                   	push   %rbp
+  8051d6:	48 89 e5             	mov    %rsp,%rbp
+  8051d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8051dd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8051e2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8051e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051eb:	48 b8 14 33 80 00 00 	movabs $0x803314,%rax
+  8051f2:	00 00 00 
+  8051f5:	ff d0                	call   *%rax
+  8051f7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8051f9:	85 c0                	test   %eax,%eax
+  8051fb:	78 06                	js     805203 <getchar+0x2e>
+  8051fd:	74 08                	je     805207 <getchar+0x32>
+  8051ff:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805203:	89 d0                	mov    %edx,%eax
+  805205:	c9                   	leave
+  805206:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805207:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80520c:	eb f5                	jmp    805203 <getchar+0x2e>
+
+000000000080520e <iscons>:
+iscons(int fdnum) {
+  80520e:	55                   	push   %rbp
+  80520f:	48 89 e5             	mov    %rsp,%rbp
+  805212:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805216:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80521a:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  805221:	00 00 00 
+  805224:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805226:	85 c0                	test   %eax,%eax
+  805228:	78 18                	js     805242 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80522a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80522e:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805235:	00 00 00 
+  805238:	8b 00                	mov    (%rax),%eax
+  80523a:	39 02                	cmp    %eax,(%rdx)
+  80523c:	0f 94 c0             	sete   %al
+  80523f:	0f b6 c0             	movzbl %al,%eax
+}
+  805242:	c9                   	leave
+  805243:	c3                   	ret
+
+0000000000805244 <opencons>:
+opencons(void) {
+  805244:	55                   	push   %rbp
+  805245:	48 89 e5             	mov    %rsp,%rbp
+  805248:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80524c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805250:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  805257:	00 00 00 
+  80525a:	ff d0                	call   *%rax
+  80525c:	85 c0                	test   %eax,%eax
+  80525e:	78 49                	js     8052a9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805260:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805265:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80526a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80526e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805273:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  80527a:	00 00 00 
+  80527d:	ff d0                	call   *%rax
+  80527f:	85 c0                	test   %eax,%eax
+  805281:	78 26                	js     8052a9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805283:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805287:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80528e:	00 00 
+  805290:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805292:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805296:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80529d:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  8052a4:	00 00 00 
+  8052a7:	ff d0                	call   *%rax
+}
+  8052a9:	c9                   	leave
+  8052aa:	c3                   	ret
+
+00000000008052ab <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8052ab:	55                   	push   %rbp
+  8052ac:	48 89 e5             	mov    %rsp,%rbp
+  8052af:	41 56                	push   %r14
+  8052b1:	41 55                	push   %r13
+  8052b3:	41 54                	push   %r12
+  8052b5:	53                   	push   %rbx
+  8052b6:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052b9:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052c0:	00 00 00 
+  8052c3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8052c7:	74 27                	je     8052f0 <_handle_vectored_pagefault+0x45>
+  8052c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8052ce:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8052d5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052d8:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8052db:	4c 89 e7             	mov    %r12,%rdi
+  8052de:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8052e3:	84 c0                	test   %al,%al
+  8052e5:	75 45                	jne    80532c <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052e7:	48 83 c3 01          	add    $0x1,%rbx
+  8052eb:	49 3b 1e             	cmp    (%r14),%rbx
+  8052ee:	72 eb                	jb     8052db <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8052f0:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8052f7:	00 
+  8052f8:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8052fd:	4d 8b 04 24          	mov    (%r12),%r8
+  805301:	48 ba 18 65 80 00 00 	movabs $0x806518,%rdx
+  805308:	00 00 00 
+  80530b:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805310:	48 bf 48 65 80 00 00 	movabs $0x806548,%rdi
+  805317:	00 00 00 
+  80531a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80531f:	49 ba 59 17 80 00 00 	movabs $0x801759,%r10
+  805326:	00 00 00 
+  805329:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80532c:	5b                   	pop    %rbx
+  80532d:	41 5c                	pop    %r12
+  80532f:	41 5d                	pop    %r13
+  805331:	41 5e                	pop    %r14
+  805333:	5d                   	pop    %rbp
+  805334:	c3                   	ret
+
+0000000000805335 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805335:	55                   	push   %rbp
+  805336:	48 89 e5             	mov    %rsp,%rbp
+  805339:	53                   	push   %rbx
+  80533a:	48 83 ec 08          	sub    $0x8,%rsp
+  80533e:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805341:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805346:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80534d:	00 00 00 
+  805350:	80 38 00             	cmpb   $0x0,(%rax)
+  805353:	74 68                	je     8053bd <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805355:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80535c:	00 00 00 
+  80535f:	48 8b 08             	mov    (%rax),%rcx
+  805362:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805367:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80536e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805371:	48 85 c9             	test   %rcx,%rcx
+  805374:	0f 84 e0 00 00 00    	je     80545a <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80537a:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80537e:	0f 84 c9 00 00 00    	je     80544d <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805384:	48 83 c2 01          	add    $0x1,%rdx
+  805388:	48 39 ca             	cmp    %rcx,%rdx
+  80538b:	75 ed                	jne    80537a <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80538d:	48 83 f9 08          	cmp    $0x8,%rcx
+  805391:	0f 84 84 00 00 00    	je     80541b <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805397:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80539b:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8053a2:	00 00 00 
+  8053a5:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8053ac:	00 00 00 
+  8053af:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8053b3:	85 f6                	test   %esi,%esi
+  8053b5:	0f 89 97 00 00 00    	jns    805452 <add_pgfault_handler+0x11d>
+  8053bb:	eb 63                	jmp    805420 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8053bd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8053c2:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8053c7:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8053ce:	00 00 00 
+  8053d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053d6:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  8053dd:	00 00 00 
+  8053e0:	ff d0                	call   *%rax
+  8053e2:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8053e4:	85 c0                	test   %eax,%eax
+  8053e6:	78 38                	js     805420 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8053e8:	48 be 36 55 80 00 00 	movabs $0x805536,%rsi
+  8053ef:	00 00 00 
+  8053f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053f7:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  8053fe:	00 00 00 
+  805401:	ff d0                	call   *%rax
+  805403:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805405:	85 c0                	test   %eax,%eax
+  805407:	78 17                	js     805420 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805409:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805410:	00 00 00 
+  805413:	c6 00 01             	movb   $0x1,(%rax)
+  805416:	e9 3a ff ff ff       	jmp    805355 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80541b:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805420:	89 f1                	mov    %esi,%ecx
+  805422:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  805429:	00 00 00 
+  80542c:	be 42 00 00 00       	mov    $0x42,%esi
+  805431:	48 bf 48 65 80 00 00 	movabs $0x806548,%rdi
+  805438:	00 00 00 
+  80543b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805440:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  805447:	00 00 00 
+  80544a:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80544d:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805452:	89 f0                	mov    %esi,%eax
+  805454:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805458:	c9                   	leave
+  805459:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80545a:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805461:	00 00 00 
+  805464:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80546b:	48 89 d8             	mov    %rbx,%rax
+  80546e:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805475:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805478:	eb d8                	jmp    805452 <add_pgfault_handler+0x11d>
+
+000000000080547a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80547a:	55                   	push   %rbp
+  80547b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80547e:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805485:	00 00 00 
+  805488:	80 38 00             	cmpb   $0x0,(%rax)
+  80548b:	74 33                	je     8054c0 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80548d:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805494:	00 00 00 
+  805497:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80549c:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8054a3:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8054a6:	48 85 c0             	test   %rax,%rax
+  8054a9:	0f 84 85 00 00 00    	je     805534 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8054af:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8054b3:	74 40                	je     8054f5 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8054b5:	48 83 c1 01          	add    $0x1,%rcx
+  8054b9:	48 39 c1             	cmp    %rax,%rcx
+  8054bc:	75 f1                	jne    8054af <remove_pgfault_handler+0x35>
+  8054be:	eb 74                	jmp    805534 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8054c0:	48 b9 6e 65 80 00 00 	movabs $0x80656e,%rcx
+  8054c7:	00 00 00 
+  8054ca:	48 ba 56 64 80 00 00 	movabs $0x806456,%rdx
+  8054d1:	00 00 00 
+  8054d4:	be 48 00 00 00       	mov    $0x48,%esi
+  8054d9:	48 bf 48 65 80 00 00 	movabs $0x806548,%rdi
+  8054e0:	00 00 00 
+  8054e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054e8:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  8054ef:	00 00 00 
+  8054f2:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8054f5:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8054fc:	00 
+  8054fd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805501:	48 29 ca             	sub    %rcx,%rdx
+  805504:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80550b:	00 00 00 
+  80550e:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805512:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805517:	48 89 ce             	mov    %rcx,%rsi
+  80551a:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  805521:	00 00 00 
+  805524:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805526:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80552d:	00 00 00 
+  805530:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805534:	5d                   	pop    %rbp
+  805535:	c3                   	ret
+
+0000000000805536 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805536:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805539:	48 b8 ab 52 80 00 00 	movabs $0x8052ab,%rax
+  805540:	00 00 00 
+    call *%rax
+  805543:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805545:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80554c:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80554d:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805554:	00 
+    subq $8, %rcx
+  805555:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805559:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80555c:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805563:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805564:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805568:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80556c:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805571:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805576:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80557b:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805580:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805585:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80558a:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80558f:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805594:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805599:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80559e:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8055a3:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8055a8:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8055ad:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8055b2:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8055b6:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8055ba:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8055bb:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8055bc:	c3                   	ret
+
+00000000008055bd <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8055bd:	85 ff                	test   %edi,%edi
+  8055bf:	78 58                	js     805619 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8055c1:	48 85 f6             	test   %rsi,%rsi
+  8055c4:	74 12                	je     8055d8 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8055c6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8055cd:	00 00 00 
+  8055d0:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8055d6:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8055d8:	48 85 c9             	test   %rcx,%rcx
+  8055db:	74 12                	je     8055ef <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8055dd:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8055e4:	00 00 00 
+  8055e7:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8055ed:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8055ef:	48 85 d2             	test   %rdx,%rdx
+  8055f2:	74 14                	je     805608 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8055f4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8055fb:	00 00 00 
+  8055fe:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805605:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805608:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80560f:	00 00 00 
+  805612:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805618:	c3                   	ret
+        if (from_env_store) {
+  805619:	48 85 f6             	test   %rsi,%rsi
+  80561c:	74 06                	je     805624 <ipc_result+0x67>
+            *from_env_store = 0;
+  80561e:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805624:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805626:	48 85 c9             	test   %rcx,%rcx
+  805629:	74 ed                	je     805618 <ipc_result+0x5b>
+            *perm_store = 0;
+  80562b:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805631:	c3                   	ret
+
+0000000000805632 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805632:	55                   	push   %rbp
+  805633:	48 89 e5             	mov    %rsp,%rbp
+  805636:	41 55                	push   %r13
+  805638:	41 54                	push   %r12
+  80563a:	53                   	push   %rbx
+  80563b:	48 83 ec 08          	sub    $0x8,%rsp
+  80563f:	49 89 fc             	mov    %rdi,%r12
+  805642:	48 89 f7             	mov    %rsi,%rdi
+  805645:	48 89 d3             	mov    %rdx,%rbx
+  805648:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80564b:	48 85 f6             	test   %rsi,%rsi
+  80564e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805655:	00 00 00 
+  805658:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80565c:	be 00 00 00 00       	mov    $0x0,%esi
+  805661:	48 85 d2             	test   %rdx,%rdx
+  805664:	74 03                	je     805669 <ipc_recv+0x37>
+  805666:	48 8b 32             	mov    (%rdx),%rsi
+  805669:	48 b8 91 2e 80 00 00 	movabs $0x802e91,%rax
+  805670:	00 00 00 
+  805673:	ff d0                	call   *%rax
+  805675:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805677:	4c 89 e9             	mov    %r13,%rcx
+  80567a:	48 89 da             	mov    %rbx,%rdx
+  80567d:	4c 89 e6             	mov    %r12,%rsi
+  805680:	48 b8 bd 55 80 00 00 	movabs $0x8055bd,%rax
+  805687:	00 00 00 
+  80568a:	ff d0                	call   *%rax
+}
+  80568c:	48 83 c4 08          	add    $0x8,%rsp
+  805690:	5b                   	pop    %rbx
+  805691:	41 5c                	pop    %r12
+  805693:	41 5d                	pop    %r13
+  805695:	5d                   	pop    %rbp
+  805696:	c3                   	ret
+
+0000000000805697 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805697:	55                   	push   %rbp
+  805698:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80569b:	48 85 d2             	test   %rdx,%rdx
+  80569e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056a5:	00 00 00 
+  8056a8:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8056ac:	89 f6                	mov    %esi,%esi
+  8056ae:	48 b8 1d 2d 80 00 00 	movabs $0x802d1d,%rax
+  8056b5:	00 00 00 
+  8056b8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8056ba:	85 c0                	test   %eax,%eax
+  8056bc:	78 02                	js     8056c0 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8056be:	5d                   	pop    %rbp
+  8056bf:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8056c0:	89 c1                	mov    %eax,%ecx
+  8056c2:	48 ba 88 65 80 00 00 	movabs $0x806588,%rdx
+  8056c9:	00 00 00 
+  8056cc:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8056d1:	48 bf 95 65 80 00 00 	movabs $0x806595,%rdi
+  8056d8:	00 00 00 
+  8056db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056e0:	49 b8 59 17 80 00 00 	movabs $0x801759,%r8
+  8056e7:	00 00 00 
+  8056ea:	41 ff d0             	call   *%r8
+
+00000000008056ed <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8056ed:	55                   	push   %rbp
+  8056ee:	48 89 e5             	mov    %rsp,%rbp
+  8056f1:	53                   	push   %rbx
+  8056f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8056f6:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056fa:	48 85 d2             	test   %rdx,%rdx
+  8056fd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805704:	00 00 00 
+  805707:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80570b:	4d 85 c9             	test   %r9,%r9
+  80570e:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805712:	b8 00 00 00 00       	mov    $0x0,%eax
+  805717:	48 85 db             	test   %rbx,%rbx
+  80571a:	74 03                	je     80571f <ipc_call+0x32>
+  80571c:	48 8b 03             	mov    (%rbx),%rax
+  80571f:	89 f6                	mov    %esi,%esi
+  805721:	48 83 ec 08          	sub    $0x8,%rsp
+  805725:	50                   	push   %rax
+  805726:	48 b8 4f 2d 80 00 00 	movabs $0x802d4f,%rax
+  80572d:	00 00 00 
+  805730:	ff d0                	call   *%rax
+  805732:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805734:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805738:	48 89 da             	mov    %rbx,%rdx
+  80573b:	be 00 00 00 00       	mov    $0x0,%esi
+  805740:	48 b8 bd 55 80 00 00 	movabs $0x8055bd,%rax
+  805747:	00 00 00 
+  80574a:	ff d0                	call   *%rax
+}
+  80574c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805750:	c9                   	leave
+  805751:	c3                   	ret
+
+0000000000805752 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805752:	55                   	push   %rbp
+  805753:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805756:	89 f6                	mov    %esi,%esi
+  805758:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  80575f:	00 00 00 
+  805762:	ff d0                	call   *%rax
+  805764:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805766:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80576b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805770:	be 00 00 00 00       	mov    $0x0,%esi
+  805775:	48 b8 bd 55 80 00 00 	movabs $0x8055bd,%rax
+  80577c:	00 00 00 
+  80577f:	ff d0                	call   *%rax
+}
+  805781:	5d                   	pop    %rbp
+  805782:	c3                   	ret
+
+0000000000805783 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805783:	55                   	push   %rbp
+  805784:	48 89 e5             	mov    %rsp,%rbp
+  805787:	41 54                	push   %r12
+  805789:	53                   	push   %rbx
+  80578a:	4c 89 cb             	mov    %r9,%rbx
+  80578d:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805791:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805795:	48 85 d2             	test   %rdx,%rdx
+  805798:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80579f:	00 00 00 
+  8057a2:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8057a6:	4d 85 c9             	test   %r9,%r9
+  8057a9:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8057ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057b2:	4d 85 e4             	test   %r12,%r12
+  8057b5:	74 04                	je     8057bb <ipc_reply_wait+0x38>
+  8057b7:	49 8b 04 24          	mov    (%r12),%rax
+  8057bb:	89 f6                	mov    %esi,%esi
+  8057bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8057c1:	50                   	push   %rax
+  8057c2:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  8057c9:	00 00 00 
+  8057cc:	ff d0                	call   *%rax
+  8057ce:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8057d0:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8057d4:	4c 89 e2             	mov    %r12,%rdx
+  8057d7:	48 89 de             	mov    %rbx,%rsi
+  8057da:	48 b8 bd 55 80 00 00 	movabs $0x8055bd,%rax
+  8057e1:	00 00 00 
+  8057e4:	ff d0                	call   *%rax
+}
+  8057e6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8057ea:	5b                   	pop    %rbx
+  8057eb:	41 5c                	pop    %r12
+  8057ed:	5d                   	pop    %rbp
+  8057ee:	c3                   	ret
+
+00000000008057ef <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8057ef:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8057f4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8057fb:	00 00 00 
+  8057fe:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805805:	48 01 ca             	add    %rcx,%rdx
+  805808:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80580e:	39 fa                	cmp    %edi,%edx
+  805810:	74 12                	je     805824 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805812:	48 83 c0 01          	add    $0x1,%rax
+  805816:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80581c:	75 e0                	jne    8057fe <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80581e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805823:	c3                   	ret
+            return envs[i].env_id;
+  805824:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80582b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805832:	00 00 00 
+  805835:	48 01 d0             	add    %rdx,%rax
+  805838:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80583e:	c3                   	ret
+  80583f:	90                   	nop
+
+0000000000805840 <__rodata_start>:
+  805840:	77 00                	ja     805842 <__rodata_start+0x2>
+  805842:	72 62                	jb     8058a6 <__rodata_start+0x66>
+  805844:	00 77 62             	add    %dh,0x62(%rdi)
+  805847:	00 66 2e             	add    %ah,0x2e(%rsi)
+  80584a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805851:	00 
+  805852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805859:	00 00 00 
+  80585c:	0f 1f 40 00          	nopl   0x0(%rax)
+  805860:	b3 09                	mov    $0x9,%bl
+  805862:	80 00 00             	addb   $0x0,(%rax)
+  805865:	00 00                	add    %al,(%rax)
+  805867:	00 ed                	add    %ch,%ch
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80588d:	00 00                	add    %al,(%rax)
+  80588f:	00 ed                	add    %ch,%ch
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	8c 0a                	mov    %cs,(%rdx)
+  8058ba:	80 00 00             	addb   $0x0,(%rax)
+  8058bd:	00 00                	add    %al,(%rax)
+  8058bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	8c 0a                	mov    %cs,(%rdx)
+  8058ca:	80 00 00             	addb   $0x0,(%rax)
+  8058cd:	00 00                	add    %al,(%rax)
+  8058cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	8c 0a                	mov    %cs,(%rdx)
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	8c 0a                	mov    %cs,(%rdx)
+  8058ea:	80 00 00             	addb   $0x0,(%rax)
+  8058ed:	00 00                	add    %al,(%rax)
+  8058ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	8c 0a                	mov    %cs,(%rdx)
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	ed                   	in     (%dx),%eax
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ed                   	in     (%dx),%eax
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	ed                   	in     (%dx),%eax
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	ed                   	in     (%dx),%eax
+  8059d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059de:	00 00                	add    %al,(%rax)
+  8059e0:	ed                   	in     (%dx),%eax
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	ed                   	in     (%dx),%eax
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	f4                   	hlt
+  8059f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8059ff:	00 ed                	add    %ch,%ch
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	2c 0b                	sub    $0xb,%al
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 ed                	add    %ch,%ch
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805a53:	00 00                	add    %al,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 cb                	add    %cl,%bl
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	6a 0a                	push   $0xa
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 ed                	add    %ch,%ch
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	3c 0a                	cmp    $0xa,%al
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 ed                	add    %ch,%ch
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805aab:	00 00                	add    %al,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 29                	add    %ch,(%rcx)
+  805ab9:	0c 80                	or     $0x80,%al
+  805abb:	00 00                	add    %al,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 ed                	add    %ch,%ch
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	1a 0b                	sbb    (%rbx),%cl
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 ed                	add    %ch,%ch
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ce                   	(bad)
+  805ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ae7:	00 ed                	add    %ch,%ch
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	f4                   	hlt
+  805af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805aff:	00 37                	add    %dh,(%rdi)
+  805b01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 37                	add    %dh,(%rdi)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805b2b:	00 00                	add    %al,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 d2                	add    %dl,%dl
+  805b31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b37:	00 d2                	add    %dl,%dl
+  805b39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b3f:	00 d2                	add    %dl,%dl
+  805b41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b47:	00 d2                	add    %dl,%dl
+  805b49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b4f:	00 d2                	add    %dl,%dl
+  805b51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b57:	00 d2                	add    %dl,%dl
+  805b59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b5f:	00 d2                	add    %dl,%dl
+  805b61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b67:	00 f6                	add    %dh,%dh
+  805b69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b6f:	00 f6                	add    %dh,%dh
+  805b71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 22                	add    %ah,(%rdx)
+  805bb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bb7:	00 22                	add    %ah,(%rdx)
+  805bb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bbf:	00 22                	add    %ah,(%rdx)
+  805bc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bc7:	00 22                	add    %ah,(%rdx)
+  805bc9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bcf:	00 22                	add    %ah,(%rdx)
+  805bd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bd7:	00 22                	add    %ah,(%rdx)
+  805bd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 46 12             	add    %al,0x12(%rsi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 22                	add    %ah,(%rdx)
+  805cb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cb7:	00 22                	add    %ah,(%rdx)
+  805cb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cbf:	00 22                	add    %ah,(%rdx)
+  805cc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cc7:	00 22                	add    %ah,(%rdx)
+  805cc9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ccf:	00 22                	add    %ah,(%rdx)
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 22                	add    %ah,(%rdx)
+  805cd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 46 12             	add    %al,0x12(%rsi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805d80 <basefix.0>:
+  805d80:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805d90:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805da0:	10 00 73 79 73 5f 61 6c 6c 6f 63 5f 72 65 67 69     ..sys_alloc_regi
+  805db0:	6f 6e 3a 20 25 69 00 75 73 65 72 2f 61 6c 6c 6f     on: %i.user/allo
+  805dc0:	63 62 65 6e 63 68 2e 63 00 73 79 73 5f 75 6e 6d     cbench.c.sys_unm
+  805dd0:	61 70 5f 72 65 67 69 6f 6e 3a 20 25 69 00 66 90     ap_region: %i.f.
+  805de0:	61 6c 6c 6f 63 62 65 6e 63 68 3a 20 25 6c 64 20     allocbench: %ld 
+  805df0:	61 6c 6c 6f 63 2f 66 72 65 65 20 70 61 69 72 73     alloc/free pairs
+  805e00:	20 69 6e 20 25 75 20 6d 73 0a 00 3c 75 6e 6b 6e      in %u ms..<unkn
+  805e10:	6f 77 6e 3e 00 0f 1f 00 5b 25 30 38 78 5d 20 75     own>....[%08x] u
+  805e20:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  805e30:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  805e40:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  805e50:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  805e60:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  805e70:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  805e80:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  805e90:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  805ea0:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  805eb0:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  805ec0:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  805ed0:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  805ee0:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  805ef0:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  805f00:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  805f10:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  805f20:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  805f30:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  805f40:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  805f50:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  805f60:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  805f70:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  805f80:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  805f90:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  805fa0:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  805fb0:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  805fc0:	73 75 70 70 6f 72 74 65 64 00 66 2e 0f 1f 84 00     supported.f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  805fe0:	a1 1a 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     ......... ......
+  805ff0:	e8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806000:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806010:	f8 20 80 00 00 00 00 00 c0 1a 80 00 00 00 00 00     . ..............
+  806020:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806030:	b4 1a 80 00 00 00 00 00 2e 1b 80 00 00 00 00 00     ................
+  806040:	f8 20 80 00 00 00 00 00 b4 1a 80 00 00 00 00 00     . ..............
+  806050:	fa 1a 80 00 00 00 00 00 fa 1a 80 00 00 00 00 00     ................
+  806060:	fa 1a 80 00 00 00 00 00 fa 1a 80 00 00 00 00 00     ................
+  806070:	fa 1a 80 00 00 00 00 00 fa 1a 80 00 00 00 00 00     ................
+  806080:	fa 1a 80 00 00 00 00 00 fa 1a 80 00 00 00 00 00     ................
+  806090:	fa 1a 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     ......... ......
+  8060a0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8060b0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8060c0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8060d0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8060e0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8060f0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806100:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806110:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806120:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806130:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806140:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806150:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806160:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806170:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806180:	f8 20 80 00 00 00 00 00 16 20 80 00 00 00 00 00     . ....... ......
+  806190:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8061a0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8061b0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8061c0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8061d0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  8061e0:	5c 1b 80 00 00 00 00 00 2b 1d 80 00 00 00 00 00     \.......+.......
+  8061f0:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806200:	f8 20 80 00 00 00 00 00 51 1b 80 00 00 00 00 00     . ......Q.......
+  806210:	8b 1b 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     ......... ......
+  806220:	f8 20 80 00 00 00 00 00 46 1b 80 00 00 00 00 00     . ......F.......
+  806230:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806240:	d4 1e 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806250:	f8 20 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     . ....... ......
+  806260:	22 1c 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     "........ ......
+  806270:	ff 1d 80 00 00 00 00 00 f8 20 80 00 00 00 00 00     ......... ......
+  806280:	f8 20 80 00 00 00 00 00 16 20 80 00 00 00 00 00     . ....... ......
+  806290:	f8 20 80 00 00 00 00 00 aa 1a 80 00 00 00 00 00     . ..............
+
+00000000008062a0 <error_string>:
+	...
+  8062a8:	6d 5e 80 00 00 00 00 00 7f 5e 80 00 00 00 00 00     m^.......^......
+  8062b8:	8f 5e 80 00 00 00 00 00 a1 5e 80 00 00 00 00 00     .^.......^......
+  8062c8:	af 5e 80 00 00 00 00 00 c3 5e 80 00 00 00 00 00     .^.......^......
+  8062d8:	d8 5e 80 00 00 00 00 00 eb 5e 80 00 00 00 00 00     .^.......^......
+  8062e8:	fd 5e 80 00 00 00 00 00 11 5f 80 00 00 00 00 00     .^......._......
+  8062f8:	21 5f 80 00 00 00 00 00 34 5f 80 00 00 00 00 00     !_......4_......
+  806308:	4b 5f 80 00 00 00 00 00 61 5f 80 00 00 00 00 00     K_......a_......
+  806318:	79 5f 80 00 00 00 00 00 91 5f 80 00 00 00 00 00     y_......._......
+  806328:	9e 5f 80 00 00 00 00 00 40 63 80 00 00 00 00 00     ._......@c......
+  806338:	b2 5f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ._......file is 
+  806348:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806358:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806368:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806378:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806388:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806398:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8063a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8063b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8063c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8063d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8063e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8063f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806408:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806418:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806420 <devtab>:
+  806420:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806430:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806440:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806450:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806460:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806470:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806480:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806490:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8064a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8064b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8064c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8064d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8064e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8064f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806500:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806510:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806520:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806530:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806540:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806550:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806560:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806570:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806580:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806590:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  8065a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,10692 @@
+
+obj/user/allocstress:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 17 26 80 00 00 	movabs $0x802617,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 98 24 80 00 00 	movabs $0x802498,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 da 19 80 00 00 	movabs $0x8019da,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 a7 22 80 00 00 	movabs $0x8022a7,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 a7 22 80 00 00 	movabs $0x8022a7,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 cb 18 80 00 00 	movabs $0x8018cb,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 87 62 80 00 00 	movabs $0x806287,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 f3 3e 80 00 00 	movabs $0x803ef3,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 30 5c 80 00 00 	movabs $0x805c30,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 f3 3e 80 00 00 	movabs $0x803ef3,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 32 5c 80 00 00 	movabs $0x805c32,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 f3 3e 80 00 00 	movabs $0x803ef3,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 35 5c 80 00 00 	movabs $0x805c35,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 f3 3e 80 00 00 	movabs $0x803ef3,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 17 50 80 00 00 	movabs $0x805017,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 ee 52 80 00 00 	movabs $0x8052ee,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 dd 34 80 00 00 	movabs $0x8034dd,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 74 38 80 00 00 	movabs $0x803874,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 3d 39 80 00 00 	movabs $0x80393d,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 43 38 80 00 00 	movabs $0x803843,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 43 38 80 00 00 	movabs $0x803843,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 f3 3e 80 00 00 	movabs $0x803ef3,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 dd 34 80 00 00 	movabs $0x8034dd,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb e4 25 80 00 00 	movabs $0x8025e4,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 5c 80 00 00 	movabs $0x805c40,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 e4 25 80 00 00 	movabs $0x8025e4,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 17 26 80 00 00 	movabs $0x802617,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc e4 25 80 00 00 	movabs $0x8025e4,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 5e 80 00 00 	movabs $0x805ee0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf e4 25 80 00 00 	movabs $0x8025e4,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf e4 25 80 00 00 	movabs $0x8025e4,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 3c 28 80 00 00 	movabs $0x80283c,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 3c 28 80 00 00 	movabs $0x80283c,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 23 03 00 00       	call   801822 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+    for (int slot = 0; slot < STRESS_SLOTS; slot++)
+        if (slots[slot]) sys_unmap_region(CURENVID, slots[slot], sizes[slot]);
+}
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  801515:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    envid_t children[STRESS_ENVS];
+
+    for (int i = 0; i < STRESS_ENVS; i++) {
+        if ((children[i] = fork()) < 0)
+  80151b:	49 bc 38 31 80 00 00 	movabs $0x803138,%r12
+  801522:	00 00 00 
+  801525:	41 ff d4             	call   *%r12
+  801528:	42 89 44 ad c0       	mov    %eax,-0x40(%rbp,%r13,4)
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	78 5d                	js     80158e <umain+0x8d>
+            panic("fork: %i", children[i]);
+        if (!children[i]) {
+  801531:	0f 84 84 00 00 00    	je     8015bb <umain+0xba>
+    for (int i = 0; i < STRESS_ENVS; i++) {
+  801537:	49 83 c5 01          	add    $0x1,%r13
+  80153b:	49 83 fd 04          	cmp    $0x4,%r13
+  80153f:	75 e4                	jne    801525 <umain+0x24>
+  801541:	48 8d 5d c0          	lea    -0x40(%rbp),%rbx
+  801545:	4c 8d 6d d0          	lea    -0x30(%rbp),%r13
+            return;
+        }
+    }
+
+    for (int i = 0; i < STRESS_ENVS; i++)
+        wait(children[i]);
+  801549:	49 bc 64 47 80 00 00 	movabs $0x804764,%r12
+  801550:	00 00 00 
+  801553:	8b 3b                	mov    (%rbx),%edi
+  801555:	41 ff d4             	call   *%r12
+    for (int i = 0; i < STRESS_ENVS; i++)
+  801558:	48 83 c3 04          	add    $0x4,%rbx
+  80155c:	4c 39 eb             	cmp    %r13,%rbx
+  80155f:	75 f2                	jne    801553 <umain+0x52>
+
+    cprintf("allocstress: OK\n");
+  801561:	48 bf bf 61 80 00 00 	movabs $0x8061bf,%rdi
+  801568:	00 00 00 
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801570:	48 ba 3e 1a 80 00 00 	movabs $0x801a3e,%rdx
+  801577:	00 00 00 
+  80157a:	ff d2                	call   *%rdx
+}
+  80157c:	48 81 c4 c8 00 00 00 	add    $0xc8,%rsp
+  801583:	5b                   	pop    %rbx
+  801584:	41 5c                	pop    %r12
+  801586:	41 5d                	pop    %r13
+  801588:	41 5e                	pop    %r14
+  80158a:	41 5f                	pop    %r15
+  80158c:	5d                   	pop    %rbp
+  80158d:	c3                   	ret
+            panic("fork: %i", children[i]);
+  80158e:	89 c1                	mov    %eax,%ecx
+  801590:	48 ba 7c 67 80 00 00 	movabs $0x80677c,%rdx
+  801597:	00 00 00 
+  80159a:	be 39 00 00 00       	mov    $0x39,%esi
+  80159f:	48 bf 82 61 80 00 00 	movabs $0x806182,%rdi
+  8015a6:	00 00 00 
+  8015a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ae:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  8015b5:	00 00 00 
+  8015b8:	41 ff d0             	call   *%r8
+    uint8_t *slots[STRESS_SLOTS] = {0};
+  8015bb:	89 c3                	mov    %eax,%ebx
+  8015bd:	48 8d bd 40 ff ff ff 	lea    -0xc0(%rbp),%rdi
+  8015c4:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8015c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+        uint8_t tag = (uint8_t)(id * STRESS_ITERS + i);
+  8015d1:	ba d0 ff ff ff       	mov    $0xffffffd0,%edx
+  8015d6:	89 d0                	mov    %edx,%eax
+  8015d8:	41 0f af c5          	imul   %r13d,%eax
+  8015dc:	88 85 27 ff ff ff    	mov    %al,-0xd9(%rbp)
+  8015e2:	45 89 ec             	mov    %r13d,%r12d
+            if ((res = sys_unmap_region(CURENVID, va, size)) < 0)
+  8015e5:	4c 89 ad 18 ff ff ff 	mov    %r13,-0xe8(%rbp)
+  8015ec:	e9 1b 01 00 00       	jmp    80170c <umain+0x20b>
+                panic("allocstress: env %d slot %d corrupted", id, slot);
+  8015f1:	4c 8b ad 18 ff ff ff 	mov    -0xe8(%rbp),%r13
+  8015f8:	45 89 f8             	mov    %r15d,%r8d
+  8015fb:	44 89 e9             	mov    %r13d,%ecx
+  8015fe:	48 ba d0 61 80 00 00 	movabs $0x8061d0,%rdx
+  801605:	00 00 00 
+  801608:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80160d:	48 bf 82 61 80 00 00 	movabs $0x806182,%rdi
+  801614:	00 00 00 
+  801617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161c:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  801623:	00 00 00 
+  801626:	41 ff d1             	call   *%r9
+                panic("sys_unmap_region: %i", res);
+  801629:	89 c1                	mov    %eax,%ecx
+  80162b:	48 ba 95 61 80 00 00 	movabs $0x806195,%rdx
+  801632:	00 00 00 
+  801635:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80163a:	48 bf 82 61 80 00 00 	movabs $0x806182,%rdi
+  801641:	00 00 00 
+  801644:	b8 00 00 00 00       	mov    $0x0,%eax
+  801649:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  801650:	00 00 00 
+  801653:	41 ff d0             	call   *%r8
+        size_t size = i % 5 ? PAGE_SIZE : HUGE_PAGE_SIZE;
+  801656:	48 63 c3             	movslq %ebx,%rax
+  801659:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  801660:	48 c1 f8 21          	sar    $0x21,%rax
+  801664:	89 da                	mov    %ebx,%edx
+  801666:	c1 fa 1f             	sar    $0x1f,%edx
+  801669:	29 d0                	sub    %edx,%eax
+  80166b:	8d 14 80             	lea    (%rax,%rax,4),%edx
+  80166e:	89 d8                	mov    %ebx,%eax
+  801670:	29 d0                	sub    %edx,%eax
+  801672:	83 f8 01             	cmp    $0x1,%eax
+  801675:	48 19 c0             	sbb    %rax,%rax
+  801678:	25 00 f0 1f 00       	and    $0x1ff000,%eax
+  80167d:	48 05 00 10 00 00    	add    $0x1000,%rax
+  801683:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+        if ((res = sys_alloc_region(CURENVID, va, size, PROT_RW)) < 0)
+  80168a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80168f:	48 89 c2             	mov    %rax,%rdx
+  801692:	4c 89 f6             	mov    %r14,%rsi
+  801695:	bf 00 00 00 00       	mov    $0x0,%edi
+  80169a:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  8016a1:	00 00 00 
+  8016a4:	ff d0                	call   *%rax
+  8016a6:	85 c0                	test   %eax,%eax
+  8016a8:	0f 88 fb 00 00 00    	js     8017a9 <umain+0x2a8>
+        uint8_t tag = (uint8_t)(id * STRESS_ITERS + i);
+  8016ae:	0f b6 85 27 ff ff ff 	movzbl -0xd9(%rbp),%eax
+  8016b5:	01 d8                	add    %ebx,%eax
+        va[0] = va[size / 2] = va[size - 1] = tag;
+  8016b7:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  8016be:	41 88 44 36 ff       	mov    %al,-0x1(%r14,%rsi,1)
+  8016c3:	48 89 f2             	mov    %rsi,%rdx
+  8016c6:	48 d1 ea             	shr    %rdx
+  8016c9:	41 88 84 15 00 00 00 	mov    %al,0x10000000(%r13,%rdx,1)
+  8016d0:	10 
+  8016d1:	41 88 85 00 00 00 10 	mov    %al,0x10000000(%r13)
+        slots[slot] = va;
+  8016d8:	4d 63 ff             	movslq %r15d,%r15
+  8016db:	4e 89 b4 fd 40 ff ff 	mov    %r14,-0xc0(%rbp,%r15,8)
+  8016e2:	ff 
+        sizes[slot] = size;
+  8016e3:	4a 89 74 fd 80       	mov    %rsi,-0x80(%rbp,%r15,8)
+        tags[slot] = tag;
+  8016e8:	42 88 84 3d 38 ff ff 	mov    %al,-0xc8(%rbp,%r15,1)
+  8016ef:	ff 
+        if (!(i % 64)) sys_yield();
+  8016f0:	f6 c3 3f             	test   $0x3f,%bl
+  8016f3:	0f 84 dd 00 00 00    	je     8017d6 <umain+0x2d5>
+    for (int i = 0; i < STRESS_ITERS; i++) {
+  8016f9:	83 c3 01             	add    $0x1,%ebx
+  8016fc:	41 83 c4 07          	add    $0x7,%r12d
+  801700:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  801706:	0f 84 db 00 00 00    	je     8017e7 <umain+0x2e6>
+        int slot = (i * 7 + id) % STRESS_SLOTS;
+  80170c:	44 89 e0             	mov    %r12d,%eax
+  80170f:	c1 f8 1f             	sar    $0x1f,%eax
+  801712:	c1 e8 1d             	shr    $0x1d,%eax
+  801715:	45 8d 3c 04          	lea    (%r12,%rax,1),%r15d
+  801719:	41 83 e7 07          	and    $0x7,%r15d
+  80171d:	41 29 c7             	sub    %eax,%r15d
+        uint8_t *va = STRESS_VA + slot * HUGE_PAGE_SIZE;
+  801720:	49 63 c7             	movslq %r15d,%rax
+  801723:	49 89 c5             	mov    %rax,%r13
+  801726:	49 c1 e5 15          	shl    $0x15,%r13
+  80172a:	4d 8d b5 00 00 00 10 	lea    0x10000000(%r13),%r14
+        if (slots[slot]) {
+  801731:	48 83 bc c5 40 ff ff 	cmpq   $0x0,-0xc0(%rbp,%rax,8)
+  801738:	ff 00 
+  80173a:	0f 84 16 ff ff ff    	je     801656 <umain+0x155>
+            size_t size = sizes[slot];
+  801740:	48 8b 54 c5 80       	mov    -0x80(%rbp,%rax,8),%rdx
+            uint8_t expect = tags[slot];
+  801745:	0f b6 84 05 38 ff ff 	movzbl -0xc8(%rbp,%rax,1),%eax
+  80174c:	ff 
+            if (va[0] != expect || va[size / 2] != expect || va[size - 1] != expect)
+  80174d:	41 3a 85 00 00 00 10 	cmp    0x10000000(%r13),%al
+  801754:	0f 85 97 fe ff ff    	jne    8015f1 <umain+0xf0>
+  80175a:	48 89 d1             	mov    %rdx,%rcx
+  80175d:	48 d1 e9             	shr    %rcx
+  801760:	41 3a 84 0d 00 00 00 	cmp    0x10000000(%r13,%rcx,1),%al
+  801767:	10 
+  801768:	0f 85 83 fe ff ff    	jne    8015f1 <umain+0xf0>
+  80176e:	41 3a 44 16 ff       	cmp    -0x1(%r14,%rdx,1),%al
+  801773:	0f 85 78 fe ff ff    	jne    8015f1 <umain+0xf0>
+            if ((res = sys_unmap_region(CURENVID, va, size)) < 0)
+  801779:	4c 89 f6             	mov    %r14,%rsi
+  80177c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801781:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  801788:	00 00 00 
+  80178b:	ff d0                	call   *%rax
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	0f 88 94 fe ff ff    	js     801629 <umain+0x128>
+            slots[slot] = NULL;
+  801795:	4d 63 ff             	movslq %r15d,%r15
+  801798:	4a c7 84 fd 40 ff ff 	movq   $0x0,-0xc0(%rbp,%r15,8)
+  80179f:	ff 00 00 00 00 
+            continue;
+  8017a4:	e9 50 ff ff ff       	jmp    8016f9 <umain+0x1f8>
+            panic("sys_alloc_region: %i", res);
+  8017a9:	89 c1                	mov    %eax,%ecx
+  8017ab:	48 ba aa 61 80 00 00 	movabs $0x8061aa,%rdx
+  8017b2:	00 00 00 
+  8017b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ba:	48 bf 82 61 80 00 00 	movabs $0x806182,%rdi
+  8017c1:	00 00 00 
+  8017c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c9:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  8017d0:	00 00 00 
+  8017d3:	41 ff d0             	call   *%r8
+        if (!(i % 64)) sys_yield();
+  8017d6:	48 b8 39 2a 80 00 00 	movabs $0x802a39,%rax
+  8017dd:	00 00 00 
+  8017e0:	ff d0                	call   *%rax
+  8017e2:	e9 12 ff ff ff       	jmp    8016f9 <umain+0x1f8>
+  8017e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (slots[slot]) sys_unmap_region(CURENVID, slots[slot], sizes[slot]);
+  8017ec:	49 bc b2 2b 80 00 00 	movabs $0x802bb2,%r12
+  8017f3:	00 00 00 
+  8017f6:	eb 1b                	jmp    801813 <umain+0x312>
+  8017f8:	48 8b 54 1d 80       	mov    -0x80(%rbp,%rbx,1),%rdx
+  8017fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801802:	41 ff d4             	call   *%r12
+    for (int slot = 0; slot < STRESS_SLOTS; slot++)
+  801805:	48 83 c3 08          	add    $0x8,%rbx
+  801809:	48 83 fb 40          	cmp    $0x40,%rbx
+  80180d:	0f 84 69 fd ff ff    	je     80157c <umain+0x7b>
+        if (slots[slot]) sys_unmap_region(CURENVID, slots[slot], sizes[slot]);
+  801813:	48 8b b4 1d 40 ff ff 	mov    -0xc0(%rbp,%rbx,1),%rsi
+  80181a:	ff 
+  80181b:	48 85 f6             	test   %rsi,%rsi
+  80181e:	75 d8                	jne    8017f8 <umain+0x2f7>
+  801820:	eb e3                	jmp    801805 <umain+0x304>
+
+0000000000801822 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801822:	55                   	push   %rbp
+  801823:	48 89 e5             	mov    %rsp,%rbp
+  801826:	41 56                	push   %r14
+  801828:	41 55                	push   %r13
+  80182a:	41 54                	push   %r12
+  80182c:	53                   	push   %rbx
+  80182d:	41 89 fd             	mov    %edi,%r13d
+  801830:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801833:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80183a:	00 00 00 
+  80183d:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801844:	00 00 00 
+  801847:	48 39 c2             	cmp    %rax,%rdx
+  80184a:	73 17                	jae    801863 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80184c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80184f:	49 89 c4             	mov    %rax,%r12
+  801852:	48 83 c3 08          	add    $0x8,%rbx
+  801856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185b:	ff 53 f8             	call   *-0x8(%rbx)
+  80185e:	4c 39 e3             	cmp    %r12,%rbx
+  801861:	72 ef                	jb     801852 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801863:	48 b8 02 2a 80 00 00 	movabs $0x802a02,%rax
+  80186a:	00 00 00 
+  80186d:	ff d0                	call   *%rax
+  80186f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801874:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80187b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801882:	00 00 00 
+  801885:	48 01 d0             	add    %rdx,%rax
+  801888:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80188f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801892:	45 85 ed             	test   %r13d,%r13d
+  801895:	7e 0d                	jle    8018a4 <libmain+0x82>
+  801897:	49 8b 06             	mov    (%r14),%rax
+  80189a:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8018a1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8018a4:	4c 89 f6             	mov    %r14,%rsi
+  8018a7:	44 89 ef             	mov    %r13d,%edi
+  8018aa:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8018b1:	00 00 00 
+  8018b4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8018b6:	48 b8 cb 18 80 00 00 	movabs $0x8018cb,%rax
+  8018bd:	00 00 00 
+  8018c0:	ff d0                	call   *%rax
+#endif
+}
+  8018c2:	5b                   	pop    %rbx
+  8018c3:	41 5c                	pop    %r12
+  8018c5:	41 5d                	pop    %r13
+  8018c7:	41 5e                	pop    %r14
+  8018c9:	5d                   	pop    %rbp
+  8018ca:	c3                   	ret
+
+00000000008018cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8018cb:	55                   	push   %rbp
+  8018cc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8018cf:	48 b8 10 35 80 00 00 	movabs $0x803510,%rax
+  8018d6:	00 00 00 
+  8018d9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8018db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e0:	48 b8 91 29 80 00 00 	movabs $0x802991,%rax
+  8018e7:	00 00 00 
+  8018ea:	ff d0                	call   *%rax
+}
+  8018ec:	5d                   	pop    %rbp
+  8018ed:	c3                   	ret
+
+00000000008018ee <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8018ee:	55                   	push   %rbp
+  8018ef:	48 89 e5             	mov    %rsp,%rbp
+  8018f2:	41 56                	push   %r14
+  8018f4:	41 55                	push   %r13
+  8018f6:	41 54                	push   %r12
+  8018f8:	53                   	push   %rbx
+  8018f9:	48 83 ec 50          	sub    $0x50,%rsp
+  8018fd:	49 89 fc             	mov    %rdi,%r12
+  801900:	41 89 f5             	mov    %esi,%r13d
+  801903:	48 89 d3             	mov    %rdx,%rbx
+  801906:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80190a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80190e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801912:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801919:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80191d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801921:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801925:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801929:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801930:	00 00 00 
+  801933:	4c 8b 30             	mov    (%rax),%r14
+  801936:	48 b8 02 2a 80 00 00 	movabs $0x802a02,%rax
+  80193d:	00 00 00 
+  801940:	ff d0                	call   *%rax
+  801942:	89 c6                	mov    %eax,%esi
+  801944:	45 89 e8             	mov    %r13d,%r8d
+  801947:	4c 89 e1             	mov    %r12,%rcx
+  80194a:	4c 89 f2             	mov    %r14,%rdx
+  80194d:	48 bf 00 62 80 00 00 	movabs $0x806200,%rdi
+  801954:	00 00 00 
+  801957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195c:	49 bc 3e 1a 80 00 00 	movabs $0x801a3e,%r12
+  801963:	00 00 00 
+  801966:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801969:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80196d:	48 89 df             	mov    %rbx,%rdi
+  801970:	48 b8 da 19 80 00 00 	movabs $0x8019da,%rax
+  801977:	00 00 00 
+  80197a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80197c:	48 bf ce 61 80 00 00 	movabs $0x8061ce,%rdi
+  801983:	00 00 00 
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80198e:	cc                   	int3
+  80198f:	eb fd                	jmp    80198e <_panic+0xa0>
+
+0000000000801991 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801991:	55                   	push   %rbp
+  801992:	48 89 e5             	mov    %rsp,%rbp
+  801995:	53                   	push   %rbx
+  801996:	48 83 ec 08          	sub    $0x8,%rsp
+  80199a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80199d:	8b 06                	mov    (%rsi),%eax
+  80199f:	8d 50 01             	lea    0x1(%rax),%edx
+  8019a2:	89 16                	mov    %edx,(%rsi)
+  8019a4:	48 98                	cltq
+  8019a6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8019ab:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8019b1:	74 0a                	je     8019bd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8019b3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8019b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019bb:	c9                   	leave
+  8019bc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8019bd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8019c1:	be ff 00 00 00       	mov    $0xff,%esi
+  8019c6:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  8019cd:	00 00 00 
+  8019d0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8019d2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8019d8:	eb d9                	jmp    8019b3 <putch+0x22>
+
+00000000008019da <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8019da:	55                   	push   %rbp
+  8019db:	48 89 e5             	mov    %rsp,%rbp
+  8019de:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8019e5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8019e8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8019ef:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8019f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8019fc:	48 89 f1             	mov    %rsi,%rcx
+  8019ff:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a06:	48 bf 91 19 80 00 00 	movabs $0x801991,%rdi
+  801a0d:	00 00 00 
+  801a10:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  801a17:	00 00 00 
+  801a1a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a1c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a23:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a2a:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801a36:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801a3c:	c9                   	leave
+  801a3d:	c3                   	ret
+
+0000000000801a3e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801a3e:	55                   	push   %rbp
+  801a3f:	48 89 e5             	mov    %rsp,%rbp
+  801a42:	48 83 ec 50          	sub    $0x50,%rsp
+  801a46:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801a4a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801a4e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a52:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a56:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a5a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a61:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a69:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a6d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a71:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a75:	48 b8 da 19 80 00 00 	movabs $0x8019da,%rax
+  801a7c:	00 00 00 
+  801a7f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a81:	c9                   	leave
+  801a82:	c3                   	ret
+
+0000000000801a83 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a83:	55                   	push   %rbp
+  801a84:	48 89 e5             	mov    %rsp,%rbp
+  801a87:	41 57                	push   %r15
+  801a89:	41 56                	push   %r14
+  801a8b:	41 55                	push   %r13
+  801a8d:	41 54                	push   %r12
+  801a8f:	53                   	push   %rbx
+  801a90:	48 83 ec 18          	sub    $0x18,%rsp
+  801a94:	49 89 fc             	mov    %rdi,%r12
+  801a97:	49 89 f5             	mov    %rsi,%r13
+  801a9a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a9e:	8b 45 10             	mov    0x10(%rbp),%eax
+  801aa1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801aa4:	41 89 cf             	mov    %ecx,%r15d
+  801aa7:	4c 39 fa             	cmp    %r15,%rdx
+  801aaa:	73 5b                	jae    801b07 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801aac:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801ab0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ab4:	85 db                	test   %ebx,%ebx
+  801ab6:	7e 0e                	jle    801ac6 <print_num+0x43>
+            putch(padc, put_arg);
+  801ab8:	4c 89 ee             	mov    %r13,%rsi
+  801abb:	44 89 f7             	mov    %r14d,%edi
+  801abe:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ac1:	83 eb 01             	sub    $0x1,%ebx
+  801ac4:	75 f2                	jne    801ab8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801ac6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801aca:	48 b9 34 62 80 00 00 	movabs $0x806234,%rcx
+  801ad1:	00 00 00 
+  801ad4:	48 b8 23 62 80 00 00 	movabs $0x806223,%rax
+  801adb:	00 00 00 
+  801ade:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801ae2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ae6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aeb:	49 f7 f7             	div    %r15
+  801aee:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801af2:	4c 89 ee             	mov    %r13,%rsi
+  801af5:	41 ff d4             	call   *%r12
+}
+  801af8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801afc:	5b                   	pop    %rbx
+  801afd:	41 5c                	pop    %r12
+  801aff:	41 5d                	pop    %r13
+  801b01:	41 5e                	pop    %r14
+  801b03:	41 5f                	pop    %r15
+  801b05:	5d                   	pop    %rbp
+  801b06:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b10:	49 f7 f7             	div    %r15
+  801b13:	48 83 ec 08          	sub    $0x8,%rsp
+  801b17:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b1b:	52                   	push   %rdx
+  801b1c:	45 0f be c9          	movsbl %r9b,%r9d
+  801b20:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b24:	48 89 c2             	mov    %rax,%rdx
+  801b27:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  801b2e:	00 00 00 
+  801b31:	ff d0                	call   *%rax
+  801b33:	48 83 c4 10          	add    $0x10,%rsp
+  801b37:	eb 8d                	jmp    801ac6 <print_num+0x43>
+
+0000000000801b39 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801b39:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801b3d:	48 8b 06             	mov    (%rsi),%rax
+  801b40:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801b44:	73 0a                	jae    801b50 <sprintputch+0x17>
+        *state->start++ = ch;
+  801b46:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b4a:	48 89 16             	mov    %rdx,(%rsi)
+  801b4d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801b50:	c3                   	ret
+
+0000000000801b51 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801b51:	55                   	push   %rbp
+  801b52:	48 89 e5             	mov    %rsp,%rbp
+  801b55:	48 83 ec 50          	sub    $0x50,%rsp
+  801b59:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b5d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b61:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b65:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b74:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b7c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b80:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  801b87:	00 00 00 
+  801b8a:	ff d0                	call   *%rax
+}
+  801b8c:	c9                   	leave
+  801b8d:	c3                   	ret
+
+0000000000801b8e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801b8e:	55                   	push   %rbp
+  801b8f:	48 89 e5             	mov    %rsp,%rbp
+  801b92:	41 57                	push   %r15
+  801b94:	41 56                	push   %r14
+  801b96:	41 55                	push   %r13
+  801b98:	41 54                	push   %r12
+  801b9a:	53                   	push   %rbx
+  801b9b:	48 83 ec 38          	sub    $0x38,%rsp
+  801b9f:	49 89 fe             	mov    %rdi,%r14
+  801ba2:	49 89 f5             	mov    %rsi,%r13
+  801ba5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ba8:	48 8b 01             	mov    (%rcx),%rax
+  801bab:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801baf:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bb7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801bbb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801bbf:	eb 0d                	jmp    801bce <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801bc1:	40 0f b6 ff          	movzbl %dil,%edi
+  801bc5:	4c 89 ee             	mov    %r13,%rsi
+  801bc8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801bcb:	4c 89 e3             	mov    %r12,%rbx
+  801bce:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801bd2:	0f b6 3b             	movzbl (%rbx),%edi
+  801bd5:	40 80 ff 25          	cmp    $0x25,%dil
+  801bd9:	74 14                	je     801bef <vprintfmt+0x61>
+            if (!ch) return;
+  801bdb:	40 84 ff             	test   %dil,%dil
+  801bde:	75 e1                	jne    801bc1 <vprintfmt+0x33>
+}
+  801be0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801be4:	5b                   	pop    %rbx
+  801be5:	41 5c                	pop    %r12
+  801be7:	41 5d                	pop    %r13
+  801be9:	41 5e                	pop    %r14
+  801beb:	41 5f                	pop    %r15
+  801bed:	5d                   	pop    %rbp
+  801bee:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801bef:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801bfd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c03:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c0a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c0e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c13:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c18:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c1b:	83 e8 23             	sub    $0x23,%eax
+  801c1e:	3c 57                	cmp    $0x57,%al
+  801c20:	0f 87 67 06 00 00    	ja     80228d <vprintfmt+0x6ff>
+  801c26:	0f b6 c0             	movzbl %al,%eax
+  801c29:	48 b9 c0 63 80 00 00 	movabs $0x8063c0,%rcx
+  801c30:	00 00 00 
+  801c33:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801c36:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801c39:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801c3d:	eb cf                	jmp    801c0e <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801c3f:	49 89 dc             	mov    %rbx,%r12
+  801c42:	be 01 00 00 00       	mov    $0x1,%esi
+  801c47:	eb c5                	jmp    801c0e <vprintfmt+0x80>
+            padc = ch;
+  801c49:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801c4d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c50:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c53:	eb b9                	jmp    801c0e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c58:	83 f8 2f             	cmp    $0x2f,%eax
+  801c5b:	77 24                	ja     801c81 <vprintfmt+0xf3>
+  801c5d:	89 c1                	mov    %eax,%ecx
+  801c5f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c63:	83 c0 08             	add    $0x8,%eax
+  801c66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c69:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c6c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c6f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c73:	79 99                	jns    801c0e <vprintfmt+0x80>
+                width = precision;
+  801c75:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c79:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c7f:	eb 8d                	jmp    801c0e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c81:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c85:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c8d:	eb da                	jmp    801c69 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801c8f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801c94:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c98:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801c9e:	3c 39                	cmp    $0x39,%al
+  801ca0:	77 1c                	ja     801cbe <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801ca2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ca6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801caa:	0f b6 c0             	movzbl %al,%eax
+  801cad:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cb2:	0f b6 03             	movzbl (%rbx),%eax
+  801cb5:	3c 39                	cmp    $0x39,%al
+  801cb7:	76 e9                	jbe    801ca2 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801cb9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801cbc:	eb b1                	jmp    801c6f <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801cbe:	49 89 dc             	mov    %rbx,%r12
+  801cc1:	eb ac                	jmp    801c6f <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801cc3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801cc6:	85 c9                	test   %ecx,%ecx
+  801cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccd:	0f 49 c1             	cmovns %ecx,%eax
+  801cd0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801cd3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cd6:	e9 33 ff ff ff       	jmp    801c0e <vprintfmt+0x80>
+            lflag++;
+  801cdb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801cde:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ce1:	e9 28 ff ff ff       	jmp    801c0e <vprintfmt+0x80>
+            lflag--;
+  801ce6:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ce9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cec:	e9 1d ff ff ff       	jmp    801c0e <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801cf1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cf4:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf7:	77 19                	ja     801d12 <vprintfmt+0x184>
+  801cf9:	89 c2                	mov    %eax,%edx
+  801cfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cff:	83 c0 08             	add    $0x8,%eax
+  801d02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d05:	8b 3a                	mov    (%rdx),%edi
+  801d07:	4c 89 ee             	mov    %r13,%rsi
+  801d0a:	41 ff d6             	call   *%r14
+            break;
+  801d0d:	e9 bc fe ff ff       	jmp    801bce <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d1e:	eb e5                	jmp    801d05 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d23:	83 f8 2f             	cmp    $0x2f,%eax
+  801d26:	77 5a                	ja     801d82 <vprintfmt+0x1f4>
+  801d28:	89 c2                	mov    %eax,%edx
+  801d2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d2e:	83 c0 08             	add    $0x8,%eax
+  801d31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801d34:	8b 02                	mov    (%rdx),%eax
+  801d36:	89 c1                	mov    %eax,%ecx
+  801d38:	f7 d9                	neg    %ecx
+  801d3a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801d3d:	83 f9 13             	cmp    $0x13,%ecx
+  801d40:	7f 4e                	jg     801d90 <vprintfmt+0x202>
+  801d42:	48 63 c1             	movslq %ecx,%rax
+  801d45:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  801d4c:	00 00 00 
+  801d4f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d53:	48 85 c0             	test   %rax,%rax
+  801d56:	74 38                	je     801d90 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d58:	48 89 c1             	mov    %rax,%rcx
+  801d5b:	48 ba c8 68 80 00 00 	movabs $0x8068c8,%rdx
+  801d62:	00 00 00 
+  801d65:	4c 89 ee             	mov    %r13,%rsi
+  801d68:	4c 89 f7             	mov    %r14,%rdi
+  801d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d70:	49 b8 51 1b 80 00 00 	movabs $0x801b51,%r8
+  801d77:	00 00 00 
+  801d7a:	41 ff d0             	call   *%r8
+  801d7d:	e9 4c fe ff ff       	jmp    801bce <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8e:	eb a4                	jmp    801d34 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801d90:	48 ba 4c 62 80 00 00 	movabs $0x80624c,%rdx
+  801d97:	00 00 00 
+  801d9a:	4c 89 ee             	mov    %r13,%rsi
+  801d9d:	4c 89 f7             	mov    %r14,%rdi
+  801da0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da5:	49 b8 51 1b 80 00 00 	movabs $0x801b51,%r8
+  801dac:	00 00 00 
+  801daf:	41 ff d0             	call   *%r8
+  801db2:	e9 17 fe ff ff       	jmp    801bce <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801db7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dba:	83 f8 2f             	cmp    $0x2f,%eax
+  801dbd:	77 6c                	ja     801e2b <vprintfmt+0x29d>
+  801dbf:	89 c2                	mov    %eax,%edx
+  801dc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc5:	83 c0 08             	add    $0x8,%eax
+  801dc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dcb:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801dce:	48 85 f6             	test   %rsi,%rsi
+  801dd1:	48 b8 45 62 80 00 00 	movabs $0x806245,%rax
+  801dd8:	00 00 00 
+  801ddb:	48 0f 45 c6          	cmovne %rsi,%rax
+  801ddf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801de3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801de7:	7e 06                	jle    801def <vprintfmt+0x261>
+  801de9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ded:	75 4a                	jne    801e39 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801def:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801df3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801df7:	0f b6 00             	movzbl (%rax),%eax
+  801dfa:	84 c0                	test   %al,%al
+  801dfc:	0f 85 9a 00 00 00    	jne    801e9c <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e05:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e09:	85 c0                	test   %eax,%eax
+  801e0b:	0f 8e bd fd ff ff    	jle    801bce <vprintfmt+0x40>
+  801e11:	4c 89 ee             	mov    %r13,%rsi
+  801e14:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e19:	41 ff d6             	call   *%r14
+  801e1c:	41 83 ec 01          	sub    $0x1,%r12d
+  801e20:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e24:	75 eb                	jne    801e11 <vprintfmt+0x283>
+  801e26:	e9 a3 fd ff ff       	jmp    801bce <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e37:	eb 92                	jmp    801dcb <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801e39:	49 63 f7             	movslq %r15d,%rsi
+  801e3c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801e40:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  801e47:	00 00 00 
+  801e4a:	ff d0                	call   *%rax
+  801e4c:	48 89 c2             	mov    %rax,%rdx
+  801e4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e52:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e54:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e57:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e5a:	85 c0                	test   %eax,%eax
+  801e5c:	7e 91                	jle    801def <vprintfmt+0x261>
+  801e5e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e63:	4c 89 ee             	mov    %r13,%rsi
+  801e66:	44 89 e7             	mov    %r12d,%edi
+  801e69:	41 ff d6             	call   *%r14
+  801e6c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e70:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e73:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e76:	75 eb                	jne    801e63 <vprintfmt+0x2d5>
+  801e78:	e9 72 ff ff ff       	jmp    801def <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e7d:	0f b6 f8             	movzbl %al,%edi
+  801e80:	4c 89 ee             	mov    %r13,%rsi
+  801e83:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e86:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e8a:	49 83 c4 01          	add    $0x1,%r12
+  801e8e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801e94:	84 c0                	test   %al,%al
+  801e96:	0f 84 66 ff ff ff    	je     801e02 <vprintfmt+0x274>
+  801e9c:	45 85 ff             	test   %r15d,%r15d
+  801e9f:	78 0a                	js     801eab <vprintfmt+0x31d>
+  801ea1:	41 83 ef 01          	sub    $0x1,%r15d
+  801ea5:	0f 88 57 ff ff ff    	js     801e02 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801eab:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801eaf:	74 cc                	je     801e7d <vprintfmt+0x2ef>
+  801eb1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801eb4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801eb9:	80 fa 5e             	cmp    $0x5e,%dl
+  801ebc:	77 c2                	ja     801e80 <vprintfmt+0x2f2>
+  801ebe:	eb bd                	jmp    801e7d <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801ec0:	40 84 f6             	test   %sil,%sil
+  801ec3:	75 26                	jne    801eeb <vprintfmt+0x35d>
+    switch (lflag) {
+  801ec5:	85 d2                	test   %edx,%edx
+  801ec7:	74 59                	je     801f22 <vprintfmt+0x394>
+  801ec9:	83 fa 01             	cmp    $0x1,%edx
+  801ecc:	74 7b                	je     801f49 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801ece:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed1:	83 f8 2f             	cmp    $0x2f,%eax
+  801ed4:	0f 87 96 00 00 00    	ja     801f70 <vprintfmt+0x3e2>
+  801eda:	89 c2                	mov    %eax,%edx
+  801edc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee0:	83 c0 08             	add    $0x8,%eax
+  801ee3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ee6:	4c 8b 22             	mov    (%rdx),%r12
+  801ee9:	eb 17                	jmp    801f02 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801eeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eee:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef1:	77 21                	ja     801f14 <vprintfmt+0x386>
+  801ef3:	89 c2                	mov    %eax,%edx
+  801ef5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef9:	83 c0 08             	add    $0x8,%eax
+  801efc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eff:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f02:	4d 85 e4             	test   %r12,%r12
+  801f05:	78 7a                	js     801f81 <vprintfmt+0x3f3>
+            num = i;
+  801f07:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f0f:	e9 56 02 00 00       	jmp    80216a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f20:	eb dd                	jmp    801eff <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f25:	83 f8 2f             	cmp    $0x2f,%eax
+  801f28:	77 11                	ja     801f3b <vprintfmt+0x3ad>
+  801f2a:	89 c2                	mov    %eax,%edx
+  801f2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f30:	83 c0 08             	add    $0x8,%eax
+  801f33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f36:	4c 63 22             	movslq (%rdx),%r12
+  801f39:	eb c7                	jmp    801f02 <vprintfmt+0x374>
+  801f3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f47:	eb ed                	jmp    801f36 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801f49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f4c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f4f:	77 11                	ja     801f62 <vprintfmt+0x3d4>
+  801f51:	89 c2                	mov    %eax,%edx
+  801f53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f57:	83 c0 08             	add    $0x8,%eax
+  801f5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f5d:	4c 8b 22             	mov    (%rdx),%r12
+  801f60:	eb a0                	jmp    801f02 <vprintfmt+0x374>
+  801f62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f6e:	eb ed                	jmp    801f5d <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7c:	e9 65 ff ff ff       	jmp    801ee6 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f81:	4c 89 ee             	mov    %r13,%rsi
+  801f84:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f89:	41 ff d6             	call   *%r14
+                i = -i;
+  801f8c:	49 f7 dc             	neg    %r12
+  801f8f:	e9 73 ff ff ff       	jmp    801f07 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801f94:	40 84 f6             	test   %sil,%sil
+  801f97:	75 2e                	jne    801fc7 <vprintfmt+0x439>
+    switch (lflag) {
+  801f99:	85 d2                	test   %edx,%edx
+  801f9b:	7f 59                	jg     801ff6 <vprintfmt+0x468>
+  801f9d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fa0:	7d 7a                	jge    80201c <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801fa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fa5:	83 f8 2f             	cmp    $0x2f,%eax
+  801fa8:	0f 87 aa 00 00 00    	ja     802058 <vprintfmt+0x4ca>
+  801fae:	89 c2                	mov    %eax,%edx
+  801fb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb4:	83 c0 08             	add    $0x8,%eax
+  801fb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fbd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fc2:	e9 a3 01 00 00       	jmp    80216a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fca:	83 f8 2f             	cmp    $0x2f,%eax
+  801fcd:	77 19                	ja     801fe8 <vprintfmt+0x45a>
+  801fcf:	89 c2                	mov    %eax,%edx
+  801fd1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd5:	83 c0 08             	add    $0x8,%eax
+  801fd8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fdb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801fe3:	e9 82 01 00 00       	jmp    80216a <vprintfmt+0x5dc>
+  801fe8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ff0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ff4:	eb e5                	jmp    801fdb <vprintfmt+0x44d>
+    switch (lflag) {
+  801ff6:	83 fa 01             	cmp    $0x1,%edx
+  801ff9:	75 a7                	jne    801fa2 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801ffb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ffe:	83 f8 2f             	cmp    $0x2f,%eax
+  802001:	77 47                	ja     80204a <vprintfmt+0x4bc>
+  802003:	89 c2                	mov    %eax,%edx
+  802005:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802009:	83 c0 08             	add    $0x8,%eax
+  80200c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80200f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802012:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802017:	e9 4e 01 00 00       	jmp    80216a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80201c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80201f:	83 f8 2f             	cmp    $0x2f,%eax
+  802022:	77 18                	ja     80203c <vprintfmt+0x4ae>
+  802024:	89 c2                	mov    %eax,%edx
+  802026:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80202a:	83 c0 08             	add    $0x8,%eax
+  80202d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802030:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802032:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802037:	e9 2e 01 00 00       	jmp    80216a <vprintfmt+0x5dc>
+  80203c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802040:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802044:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802048:	eb e6                	jmp    802030 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  80204a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80204e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802052:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802056:	eb b7                	jmp    80200f <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802058:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80205c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802060:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802064:	e9 51 ff ff ff       	jmp    801fba <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802069:	40 84 f6             	test   %sil,%sil
+  80206c:	75 2e                	jne    80209c <vprintfmt+0x50e>
+    switch (lflag) {
+  80206e:	85 d2                	test   %edx,%edx
+  802070:	7f 59                	jg     8020cb <vprintfmt+0x53d>
+  802072:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802075:	7d 77                	jge    8020ee <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802077:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80207a:	83 f8 2f             	cmp    $0x2f,%eax
+  80207d:	0f 87 a4 00 00 00    	ja     802127 <vprintfmt+0x599>
+  802083:	89 c2                	mov    %eax,%edx
+  802085:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802089:	83 c0 08             	add    $0x8,%eax
+  80208c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80208f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802092:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802097:	e9 ce 00 00 00       	jmp    80216a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80209c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80209f:	83 f8 2f             	cmp    $0x2f,%eax
+  8020a2:	77 19                	ja     8020bd <vprintfmt+0x52f>
+  8020a4:	89 c2                	mov    %eax,%edx
+  8020a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020aa:	83 c0 08             	add    $0x8,%eax
+  8020ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020b0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020b3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020b8:	e9 ad 00 00 00       	jmp    80216a <vprintfmt+0x5dc>
+  8020bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c9:	eb e5                	jmp    8020b0 <vprintfmt+0x522>
+    switch (lflag) {
+  8020cb:	83 fa 01             	cmp    $0x1,%edx
+  8020ce:	75 a7                	jne    802077 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8020d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8020d6:	77 41                	ja     802119 <vprintfmt+0x58b>
+  8020d8:	89 c2                	mov    %eax,%edx
+  8020da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020de:	83 c0 08             	add    $0x8,%eax
+  8020e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020e4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020e7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8020ec:	eb 7c                	jmp    80216a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8020ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8020f4:	77 15                	ja     80210b <vprintfmt+0x57d>
+  8020f6:	89 c2                	mov    %eax,%edx
+  8020f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020fc:	83 c0 08             	add    $0x8,%eax
+  8020ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802102:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802104:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802109:	eb 5f                	jmp    80216a <vprintfmt+0x5dc>
+  80210b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80210f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802113:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802117:	eb e9                	jmp    802102 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802119:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80211d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802121:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802125:	eb bd                	jmp    8020e4 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802127:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80212b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80212f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802133:	e9 57 ff ff ff       	jmp    80208f <vprintfmt+0x501>
+            putch('0', put_arg);
+  802138:	4c 89 ee             	mov    %r13,%rsi
+  80213b:	bf 30 00 00 00       	mov    $0x30,%edi
+  802140:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802143:	4c 89 ee             	mov    %r13,%rsi
+  802146:	bf 78 00 00 00       	mov    $0x78,%edi
+  80214b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80214e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802151:	83 f8 2f             	cmp    $0x2f,%eax
+  802154:	77 47                	ja     80219d <vprintfmt+0x60f>
+  802156:	89 c2                	mov    %eax,%edx
+  802158:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80215c:	83 c0 08             	add    $0x8,%eax
+  80215f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802162:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802165:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80216a:	48 83 ec 08          	sub    $0x8,%rsp
+  80216e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802172:	0f 94 c0             	sete   %al
+  802175:	0f b6 c0             	movzbl %al,%eax
+  802178:	50                   	push   %rax
+  802179:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80217e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802182:	4c 89 ee             	mov    %r13,%rsi
+  802185:	4c 89 f7             	mov    %r14,%rdi
+  802188:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  80218f:	00 00 00 
+  802192:	ff d0                	call   *%rax
+            break;
+  802194:	48 83 c4 10          	add    $0x10,%rsp
+  802198:	e9 31 fa ff ff       	jmp    801bce <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80219d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a9:	eb b7                	jmp    802162 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8021ab:	40 84 f6             	test   %sil,%sil
+  8021ae:	75 2b                	jne    8021db <vprintfmt+0x64d>
+    switch (lflag) {
+  8021b0:	85 d2                	test   %edx,%edx
+  8021b2:	7f 56                	jg     80220a <vprintfmt+0x67c>
+  8021b4:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8021b7:	7d 77                	jge    802230 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8021b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8021bf:	0f 87 a7 00 00 00    	ja     80226c <vprintfmt+0x6de>
+  8021c5:	89 c2                	mov    %eax,%edx
+  8021c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021cb:	83 c0 08             	add    $0x8,%eax
+  8021ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021d9:	eb 8f                	jmp    80216a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8021db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021de:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e1:	77 19                	ja     8021fc <vprintfmt+0x66e>
+  8021e3:	89 c2                	mov    %eax,%edx
+  8021e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e9:	83 c0 08             	add    $0x8,%eax
+  8021ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021ef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021f7:	e9 6e ff ff ff       	jmp    80216a <vprintfmt+0x5dc>
+  8021fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802200:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802204:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802208:	eb e5                	jmp    8021ef <vprintfmt+0x661>
+    switch (lflag) {
+  80220a:	83 fa 01             	cmp    $0x1,%edx
+  80220d:	75 aa                	jne    8021b9 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80220f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802212:	83 f8 2f             	cmp    $0x2f,%eax
+  802215:	77 47                	ja     80225e <vprintfmt+0x6d0>
+  802217:	89 c2                	mov    %eax,%edx
+  802219:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80221d:	83 c0 08             	add    $0x8,%eax
+  802220:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802223:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802226:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80222b:	e9 3a ff ff ff       	jmp    80216a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802230:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802233:	83 f8 2f             	cmp    $0x2f,%eax
+  802236:	77 18                	ja     802250 <vprintfmt+0x6c2>
+  802238:	89 c2                	mov    %eax,%edx
+  80223a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80223e:	83 c0 08             	add    $0x8,%eax
+  802241:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802244:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802246:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80224b:	e9 1a ff ff ff       	jmp    80216a <vprintfmt+0x5dc>
+  802250:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802254:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802258:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225c:	eb e6                	jmp    802244 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80225e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802262:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802266:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80226a:	eb b7                	jmp    802223 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80226c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802270:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802274:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802278:	e9 54 ff ff ff       	jmp    8021d1 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  80227d:	4c 89 ee             	mov    %r13,%rsi
+  802280:	bf 25 00 00 00       	mov    $0x25,%edi
+  802285:	41 ff d6             	call   *%r14
+            break;
+  802288:	e9 41 f9 ff ff       	jmp    801bce <vprintfmt+0x40>
+            putch('%', put_arg);
+  80228d:	4c 89 ee             	mov    %r13,%rsi
+  802290:	bf 25 00 00 00       	mov    $0x25,%edi
+  802295:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802298:	48 83 eb 01          	sub    $0x1,%rbx
+  80229c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8022a0:	75 f6                	jne    802298 <vprintfmt+0x70a>
+  8022a2:	e9 27 f9 ff ff       	jmp    801bce <vprintfmt+0x40>
+
+00000000008022a7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8022a7:	55                   	push   %rbp
+  8022a8:	48 89 e5             	mov    %rsp,%rbp
+  8022ab:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8022af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022b3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8022b8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8022bc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8022c3:	48 85 ff             	test   %rdi,%rdi
+  8022c6:	74 2b                	je     8022f3 <vsnprintf+0x4c>
+  8022c8:	48 85 f6             	test   %rsi,%rsi
+  8022cb:	74 26                	je     8022f3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8022cd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022d1:	48 bf 39 1b 80 00 00 	movabs $0x801b39,%rdi
+  8022d8:	00 00 00 
+  8022db:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  8022e2:	00 00 00 
+  8022e5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8022e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022eb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8022ee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8022f1:	c9                   	leave
+  8022f2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8022f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022f8:	eb f7                	jmp    8022f1 <vsnprintf+0x4a>
+
+00000000008022fa <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8022fa:	55                   	push   %rbp
+  8022fb:	48 89 e5             	mov    %rsp,%rbp
+  8022fe:	48 83 ec 50          	sub    $0x50,%rsp
+  802302:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802306:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80230a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80230e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802315:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802319:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80231d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802321:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802325:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802329:	48 b8 a7 22 80 00 00 	movabs $0x8022a7,%rax
+  802330:	00 00 00 
+  802333:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802335:	c9                   	leave
+  802336:	c3                   	ret
+
+0000000000802337 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802337:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80233a:	74 10                	je     80234c <strlen+0x15>
+    size_t n = 0;
+  80233c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802341:	48 83 c0 01          	add    $0x1,%rax
+  802345:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802349:	75 f6                	jne    802341 <strlen+0xa>
+  80234b:	c3                   	ret
+    size_t n = 0;
+  80234c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802351:	c3                   	ret
+
+0000000000802352 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802352:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802355:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80235a:	48 85 f6             	test   %rsi,%rsi
+  80235d:	74 11                	je     802370 <strnlen+0x1e>
+  80235f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802363:	74 0c                	je     802371 <strnlen+0x1f>
+  802365:	48 83 c2 01          	add    $0x1,%rdx
+  802369:	48 39 d0             	cmp    %rdx,%rax
+  80236c:	75 f1                	jne    80235f <strnlen+0xd>
+  80236e:	eb 04                	jmp    802374 <strnlen+0x22>
+  802370:	c3                   	ret
+  802371:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802374:	c3                   	ret
+
+0000000000802375 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802375:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802381:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802384:	48 83 c2 01          	add    $0x1,%rdx
+  802388:	84 c9                	test   %cl,%cl
+  80238a:	75 f1                	jne    80237d <strcpy+0x8>
+        ;
+    return res;
+}
+  80238c:	c3                   	ret
+
+000000000080238d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80238d:	55                   	push   %rbp
+  80238e:	48 89 e5             	mov    %rsp,%rbp
+  802391:	41 54                	push   %r12
+  802393:	53                   	push   %rbx
+  802394:	48 89 fb             	mov    %rdi,%rbx
+  802397:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80239a:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8023a6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8023aa:	4c 89 e6             	mov    %r12,%rsi
+  8023ad:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+    return dst;
+}
+  8023b9:	48 89 d8             	mov    %rbx,%rax
+  8023bc:	5b                   	pop    %rbx
+  8023bd:	41 5c                	pop    %r12
+  8023bf:	5d                   	pop    %rbp
+  8023c0:	c3                   	ret
+
+00000000008023c1 <toupper>:
+
+int
+toupper(int ch) {
+  8023c1:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8023c3:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8023c6:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8023c9:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023cc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023cf:	c3                   	ret
+
+00000000008023d0 <tolower>:
+
+int
+tolower(int ch) {
+  8023d0:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8023d2:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8023d5:	8d 57 20             	lea    0x20(%rdi),%edx
+  8023d8:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023db:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023de:	c3                   	ret
+
+00000000008023df <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8023df:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8023e2:	48 85 d2             	test   %rdx,%rdx
+  8023e5:	74 1f                	je     802406 <strncpy+0x27>
+  8023e7:	48 01 fa             	add    %rdi,%rdx
+  8023ea:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8023ed:	48 83 c1 01          	add    $0x1,%rcx
+  8023f1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8023f5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8023f9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8023fd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802401:	48 39 ca             	cmp    %rcx,%rdx
+  802404:	75 e7                	jne    8023ed <strncpy+0xe>
+    }
+    return ret;
+}
+  802406:	c3                   	ret
+
+0000000000802407 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802407:	48 89 f8             	mov    %rdi,%rax
+  80240a:	48 85 d2             	test   %rdx,%rdx
+  80240d:	74 24                	je     802433 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80240f:	48 83 ea 01          	sub    $0x1,%rdx
+  802413:	74 1b                	je     802430 <strlcpy+0x29>
+  802415:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802419:	0f b6 16             	movzbl (%rsi),%edx
+  80241c:	84 d2                	test   %dl,%dl
+  80241e:	74 10                	je     802430 <strlcpy+0x29>
+            *dst++ = *src++;
+  802420:	48 83 c6 01          	add    $0x1,%rsi
+  802424:	48 83 c0 01          	add    $0x1,%rax
+  802428:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80242b:	48 39 c8             	cmp    %rcx,%rax
+  80242e:	75 e9                	jne    802419 <strlcpy+0x12>
+        *dst = '\0';
+  802430:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802433:	48 29 f8             	sub    %rdi,%rax
+}
+  802436:	c3                   	ret
+
+0000000000802437 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802437:	0f b6 07             	movzbl (%rdi),%eax
+  80243a:	84 c0                	test   %al,%al
+  80243c:	74 13                	je     802451 <strcmp+0x1a>
+  80243e:	38 06                	cmp    %al,(%rsi)
+  802440:	75 0f                	jne    802451 <strcmp+0x1a>
+  802442:	48 83 c7 01          	add    $0x1,%rdi
+  802446:	48 83 c6 01          	add    $0x1,%rsi
+  80244a:	0f b6 07             	movzbl (%rdi),%eax
+  80244d:	84 c0                	test   %al,%al
+  80244f:	75 ed                	jne    80243e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802451:	0f b6 c0             	movzbl %al,%eax
+  802454:	0f b6 16             	movzbl (%rsi),%edx
+  802457:	29 d0                	sub    %edx,%eax
+}
+  802459:	c3                   	ret
+
+000000000080245a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80245a:	48 85 d2             	test   %rdx,%rdx
+  80245d:	74 1f                	je     80247e <strncmp+0x24>
+  80245f:	0f b6 07             	movzbl (%rdi),%eax
+  802462:	84 c0                	test   %al,%al
+  802464:	74 1e                	je     802484 <strncmp+0x2a>
+  802466:	3a 06                	cmp    (%rsi),%al
+  802468:	75 1a                	jne    802484 <strncmp+0x2a>
+  80246a:	48 83 c7 01          	add    $0x1,%rdi
+  80246e:	48 83 c6 01          	add    $0x1,%rsi
+  802472:	48 83 ea 01          	sub    $0x1,%rdx
+  802476:	75 e7                	jne    80245f <strncmp+0x5>
+
+    if (!n) return 0;
+  802478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247d:	c3                   	ret
+  80247e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802483:	c3                   	ret
+  802484:	48 85 d2             	test   %rdx,%rdx
+  802487:	74 09                	je     802492 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802489:	0f b6 07             	movzbl (%rdi),%eax
+  80248c:	0f b6 16             	movzbl (%rsi),%edx
+  80248f:	29 d0                	sub    %edx,%eax
+  802491:	c3                   	ret
+    if (!n) return 0;
+  802492:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802497:	c3                   	ret
+
+0000000000802498 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802498:	0f b6 17             	movzbl (%rdi),%edx
+  80249b:	84 d2                	test   %dl,%dl
+  80249d:	74 18                	je     8024b7 <strchr+0x1f>
+        if (*str == c) {
+  80249f:	0f be d2             	movsbl %dl,%edx
+  8024a2:	39 f2                	cmp    %esi,%edx
+  8024a4:	74 17                	je     8024bd <strchr+0x25>
+    for (; *str; str++) {
+  8024a6:	48 83 c7 01          	add    $0x1,%rdi
+  8024aa:	0f b6 17             	movzbl (%rdi),%edx
+  8024ad:	84 d2                	test   %dl,%dl
+  8024af:	75 ee                	jne    80249f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8024b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b6:	c3                   	ret
+  8024b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bc:	c3                   	ret
+  8024bd:	48 89 f8             	mov    %rdi,%rax
+}
+  8024c0:	c3                   	ret
+
+00000000008024c1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8024c1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8024c4:	0f b6 17             	movzbl (%rdi),%edx
+  8024c7:	84 d2                	test   %dl,%dl
+  8024c9:	74 13                	je     8024de <strfind+0x1d>
+  8024cb:	0f be d2             	movsbl %dl,%edx
+  8024ce:	39 f2                	cmp    %esi,%edx
+  8024d0:	74 0b                	je     8024dd <strfind+0x1c>
+  8024d2:	48 83 c0 01          	add    $0x1,%rax
+  8024d6:	0f b6 10             	movzbl (%rax),%edx
+  8024d9:	84 d2                	test   %dl,%dl
+  8024db:	75 ee                	jne    8024cb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8024dd:	c3                   	ret
+  8024de:	c3                   	ret
+
+00000000008024df <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024df:	48 39 f7             	cmp    %rsi,%rdi
+  8024e2:	74 65                	je     802549 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8024e4:	55                   	push   %rbp
+  8024e5:	48 89 e5             	mov    %rsp,%rbp
+  8024e8:	41 57                	push   %r15
+  8024ea:	41 56                	push   %r14
+  8024ec:	41 55                	push   %r13
+  8024ee:	41 54                	push   %r12
+  8024f0:	53                   	push   %rbx
+  8024f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8024f5:	48 89 fb             	mov    %rdi,%rbx
+  8024f8:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8024fb:	49 bf d0 23 80 00 00 	movabs $0x8023d0,%r15
+  802502:	00 00 00 
+  802505:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802509:	41 0f b6 fd          	movzbl %r13b,%edi
+  80250d:	41 ff d7             	call   *%r15
+  802510:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802513:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802518:	41 0f b6 fe          	movzbl %r14b,%edi
+  80251c:	41 ff d7             	call   *%r15
+  80251f:	89 c2                	mov    %eax,%edx
+  802521:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802524:	29 d0                	sub    %edx,%eax
+  802526:	75 12                	jne    80253a <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802528:	48 83 c3 01          	add    $0x1,%rbx
+  80252c:	45 84 ed             	test   %r13b,%r13b
+  80252f:	74 09                	je     80253a <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802531:	49 83 c4 01          	add    $0x1,%r12
+  802535:	45 84 f6             	test   %r14b,%r14b
+  802538:	75 cb                	jne    802505 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80253a:	48 83 c4 18          	add    $0x18,%rsp
+  80253e:	5b                   	pop    %rbx
+  80253f:	41 5c                	pop    %r12
+  802541:	41 5d                	pop    %r13
+  802543:	41 5e                	pop    %r14
+  802545:	41 5f                	pop    %r15
+  802547:	5d                   	pop    %rbp
+  802548:	c3                   	ret
+    if (p1 == p2) return 0;
+  802549:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80254e:	c3                   	ret
+
+000000000080254f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80254f:	48 39 f7             	cmp    %rsi,%rdi
+  802552:	74 7d                	je     8025d1 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802554:	55                   	push   %rbp
+  802555:	48 89 e5             	mov    %rsp,%rbp
+  802558:	41 57                	push   %r15
+  80255a:	41 56                	push   %r14
+  80255c:	41 55                	push   %r13
+  80255e:	41 54                	push   %r12
+  802560:	53                   	push   %rbx
+  802561:	48 83 ec 18          	sub    $0x18,%rsp
+  802565:	48 89 fb             	mov    %rdi,%rbx
+  802568:	49 89 f4             	mov    %rsi,%r12
+  80256b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80256f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802573:	49 bf d0 23 80 00 00 	movabs $0x8023d0,%r15
+  80257a:	00 00 00 
+    while (n--) {
+  80257d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802581:	48 39 c3             	cmp    %rax,%rbx
+  802584:	74 37                	je     8025bd <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802586:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80258a:	41 0f b6 fd          	movzbl %r13b,%edi
+  80258e:	41 ff d7             	call   *%r15
+  802591:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802594:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802599:	41 0f b6 fe          	movzbl %r14b,%edi
+  80259d:	41 ff d7             	call   *%r15
+  8025a0:	89 c2                	mov    %eax,%edx
+  8025a2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8025a5:	29 d0                	sub    %edx,%eax
+  8025a7:	75 19                	jne    8025c2 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8025a9:	48 83 c3 01          	add    $0x1,%rbx
+  8025ad:	45 84 ed             	test   %r13b,%r13b
+  8025b0:	74 10                	je     8025c2 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8025b2:	49 83 c4 01          	add    $0x1,%r12
+  8025b6:	45 84 f6             	test   %r14b,%r14b
+  8025b9:	75 c2                	jne    80257d <strncasecmp+0x2e>
+  8025bb:	eb 05                	jmp    8025c2 <strncasecmp+0x73>
+  8025bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8025c2:	48 83 c4 18          	add    $0x18,%rsp
+  8025c6:	5b                   	pop    %rbx
+  8025c7:	41 5c                	pop    %r12
+  8025c9:	41 5d                	pop    %r13
+  8025cb:	41 5e                	pop    %r14
+  8025cd:	41 5f                	pop    %r15
+  8025cf:	5d                   	pop    %rbp
+  8025d0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8025d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d6:	c3                   	ret
+
+00000000008025d7 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8025d7:	83 e7 df             	and    $0xffffffdf,%edi
+  8025da:	83 ef 41             	sub    $0x41,%edi
+  8025dd:	83 ff 19             	cmp    $0x19,%edi
+  8025e0:	0f 96 c0             	setbe  %al
+}
+  8025e3:	c3                   	ret
+
+00000000008025e4 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8025e4:	83 ff 20             	cmp    $0x20,%edi
+  8025e7:	0f 94 c0             	sete   %al
+  8025ea:	83 ff 09             	cmp    $0x9,%edi
+  8025ed:	0f 94 c2             	sete   %dl
+  8025f0:	09 d0                	or     %edx,%eax
+}
+  8025f2:	c3                   	ret
+
+00000000008025f3 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8025f3:	55                   	push   %rbp
+  8025f4:	48 89 e5             	mov    %rsp,%rbp
+  8025f7:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8025f9:	48 bf 3f 67 80 00 00 	movabs $0x80673f,%rdi
+  802600:	00 00 00 
+  802603:	48 b8 98 24 80 00 00 	movabs $0x802498,%rax
+  80260a:	00 00 00 
+  80260d:	ff d0                	call   *%rax
+  80260f:	48 85 c0             	test   %rax,%rax
+  802612:	0f 95 c0             	setne  %al
+}
+  802615:	5d                   	pop    %rbp
+  802616:	c3                   	ret
+
+0000000000802617 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802617:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80261a:	48 89 f8             	mov    %rdi,%rax
+  80261d:	48 f7 d8             	neg    %rax
+  802620:	83 e0 07             	and    $0x7,%eax
+  802623:	49 89 d1             	mov    %rdx,%r9
+  802626:	49 29 c1             	sub    %rax,%r9
+  802629:	78 36                	js     802661 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80262b:	40 0f b6 c6          	movzbl %sil,%eax
+  80262f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802636:	01 01 01 
+  802639:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80263d:	40 f6 c7 07          	test   $0x7,%dil
+  802641:	75 38                	jne    80267b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802643:	4c 89 c9             	mov    %r9,%rcx
+  802646:	48 c1 f9 03          	sar    $0x3,%rcx
+  80264a:	74 0c                	je     802658 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80264c:	fc                   	cld
+  80264d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802650:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802654:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802658:	4d 85 c9             	test   %r9,%r9
+  80265b:	75 45                	jne    8026a2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80265d:	4c 89 c0             	mov    %r8,%rax
+  802660:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802661:	48 85 d2             	test   %rdx,%rdx
+  802664:	74 f7                	je     80265d <memset+0x46>
+  802666:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802669:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80266c:	48 83 c0 01          	add    $0x1,%rax
+  802670:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802674:	48 39 c2             	cmp    %rax,%rdx
+  802677:	75 f3                	jne    80266c <memset+0x55>
+  802679:	eb e2                	jmp    80265d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80267b:	40 f6 c7 01          	test   $0x1,%dil
+  80267f:	74 06                	je     802687 <memset+0x70>
+  802681:	88 07                	mov    %al,(%rdi)
+  802683:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802687:	40 f6 c7 02          	test   $0x2,%dil
+  80268b:	74 07                	je     802694 <memset+0x7d>
+  80268d:	66 89 07             	mov    %ax,(%rdi)
+  802690:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802694:	40 f6 c7 04          	test   $0x4,%dil
+  802698:	74 a9                	je     802643 <memset+0x2c>
+  80269a:	89 07                	mov    %eax,(%rdi)
+  80269c:	48 83 c7 04          	add    $0x4,%rdi
+  8026a0:	eb a1                	jmp    802643 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026a2:	41 f6 c1 04          	test   $0x4,%r9b
+  8026a6:	74 06                	je     8026ae <memset+0x97>
+  8026a8:	89 07                	mov    %eax,(%rdi)
+  8026aa:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026ae:	41 f6 c1 02          	test   $0x2,%r9b
+  8026b2:	74 07                	je     8026bb <memset+0xa4>
+  8026b4:	66 89 07             	mov    %ax,(%rdi)
+  8026b7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8026bb:	41 f6 c1 01          	test   $0x1,%r9b
+  8026bf:	74 9c                	je     80265d <memset+0x46>
+  8026c1:	88 07                	mov    %al,(%rdi)
+  8026c3:	eb 98                	jmp    80265d <memset+0x46>
+
+00000000008026c5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8026c5:	48 89 f8             	mov    %rdi,%rax
+  8026c8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8026cb:	48 39 fe             	cmp    %rdi,%rsi
+  8026ce:	73 3b                	jae    80270b <memmove+0x46>
+  8026d0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8026d4:	48 39 d7             	cmp    %rdx,%rdi
+  8026d7:	73 32                	jae    80270b <memmove+0x46>
+        s += n;
+        d += n;
+  8026d9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026dd:	48 89 d6             	mov    %rdx,%rsi
+  8026e0:	48 09 fe             	or     %rdi,%rsi
+  8026e3:	48 09 ce             	or     %rcx,%rsi
+  8026e6:	40 f6 c6 07          	test   $0x7,%sil
+  8026ea:	75 12                	jne    8026fe <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8026ec:	48 83 ef 08          	sub    $0x8,%rdi
+  8026f0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8026f4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026f8:	fd                   	std
+  8026f9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8026fc:	fc                   	cld
+  8026fd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8026fe:	48 83 ef 01          	sub    $0x1,%rdi
+  802702:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802706:	fd                   	std
+  802707:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802709:	eb f1                	jmp    8026fc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80270b:	48 89 f2             	mov    %rsi,%rdx
+  80270e:	48 09 c2             	or     %rax,%rdx
+  802711:	48 09 ca             	or     %rcx,%rdx
+  802714:	f6 c2 07             	test   $0x7,%dl
+  802717:	75 0c                	jne    802725 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802719:	48 c1 e9 03          	shr    $0x3,%rcx
+  80271d:	48 89 c7             	mov    %rax,%rdi
+  802720:	fc                   	cld
+  802721:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802724:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802725:	48 89 c7             	mov    %rax,%rdi
+  802728:	fc                   	cld
+  802729:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80272b:	c3                   	ret
+
+000000000080272c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80272c:	55                   	push   %rbp
+  80272d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802730:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  802737:	00 00 00 
+  80273a:	ff d0                	call   *%rax
+}
+  80273c:	5d                   	pop    %rbp
+  80273d:	c3                   	ret
+
+000000000080273e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80273e:	55                   	push   %rbp
+  80273f:	48 89 e5             	mov    %rsp,%rbp
+  802742:	41 57                	push   %r15
+  802744:	41 56                	push   %r14
+  802746:	41 55                	push   %r13
+  802748:	41 54                	push   %r12
+  80274a:	53                   	push   %rbx
+  80274b:	48 83 ec 08          	sub    $0x8,%rsp
+  80274f:	49 89 fe             	mov    %rdi,%r14
+  802752:	49 89 f7             	mov    %rsi,%r15
+  802755:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802758:	48 89 f7             	mov    %rsi,%rdi
+  80275b:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  802762:	00 00 00 
+  802765:	ff d0                	call   *%rax
+  802767:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80276a:	48 89 de             	mov    %rbx,%rsi
+  80276d:	4c 89 f7             	mov    %r14,%rdi
+  802770:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  802777:	00 00 00 
+  80277a:	ff d0                	call   *%rax
+  80277c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80277f:	48 39 c3             	cmp    %rax,%rbx
+  802782:	74 36                	je     8027ba <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802784:	48 89 d8             	mov    %rbx,%rax
+  802787:	4c 29 e8             	sub    %r13,%rax
+  80278a:	49 39 c4             	cmp    %rax,%r12
+  80278d:	73 31                	jae    8027c0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80278f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802794:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802798:	4c 89 fe             	mov    %r15,%rsi
+  80279b:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  8027a2:	00 00 00 
+  8027a5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8027a7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8027ab:	48 83 c4 08          	add    $0x8,%rsp
+  8027af:	5b                   	pop    %rbx
+  8027b0:	41 5c                	pop    %r12
+  8027b2:	41 5d                	pop    %r13
+  8027b4:	41 5e                	pop    %r14
+  8027b6:	41 5f                	pop    %r15
+  8027b8:	5d                   	pop    %rbp
+  8027b9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027ba:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8027be:	eb eb                	jmp    8027ab <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8027c0:	48 83 eb 01          	sub    $0x1,%rbx
+  8027c4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027c8:	48 89 da             	mov    %rbx,%rdx
+  8027cb:	4c 89 fe             	mov    %r15,%rsi
+  8027ce:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  8027d5:	00 00 00 
+  8027d8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8027da:	49 01 de             	add    %rbx,%r14
+  8027dd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8027e2:	eb c3                	jmp    8027a7 <strlcat+0x69>
+
+00000000008027e4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8027e4:	48 85 d2             	test   %rdx,%rdx
+  8027e7:	74 2d                	je     802816 <memcmp+0x32>
+  8027e9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8027ee:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8027f2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8027f7:	44 38 c1             	cmp    %r8b,%cl
+  8027fa:	75 0f                	jne    80280b <memcmp+0x27>
+    while (n-- > 0) {
+  8027fc:	48 83 c0 01          	add    $0x1,%rax
+  802800:	48 39 c2             	cmp    %rax,%rdx
+  802803:	75 e9                	jne    8027ee <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80280b:	0f b6 c1             	movzbl %cl,%eax
+  80280e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802812:	44 29 c0             	sub    %r8d,%eax
+  802815:	c3                   	ret
+    return 0;
+  802816:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80281b:	c3                   	ret
+
+000000000080281c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80281c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802820:	48 39 c7             	cmp    %rax,%rdi
+  802823:	73 0f                	jae    802834 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802825:	40 38 37             	cmp    %sil,(%rdi)
+  802828:	74 0e                	je     802838 <memfind+0x1c>
+    for (; src < end; src++) {
+  80282a:	48 83 c7 01          	add    $0x1,%rdi
+  80282e:	48 39 f8             	cmp    %rdi,%rax
+  802831:	75 f2                	jne    802825 <memfind+0x9>
+  802833:	c3                   	ret
+  802834:	48 89 f8             	mov    %rdi,%rax
+  802837:	c3                   	ret
+  802838:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80283b:	c3                   	ret
+
+000000000080283c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80283c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80283f:	0f b6 37             	movzbl (%rdi),%esi
+  802842:	40 80 fe 20          	cmp    $0x20,%sil
+  802846:	74 06                	je     80284e <strtol+0x12>
+  802848:	40 80 fe 09          	cmp    $0x9,%sil
+  80284c:	75 13                	jne    802861 <strtol+0x25>
+  80284e:	48 83 c7 01          	add    $0x1,%rdi
+  802852:	0f b6 37             	movzbl (%rdi),%esi
+  802855:	40 80 fe 20          	cmp    $0x20,%sil
+  802859:	74 f3                	je     80284e <strtol+0x12>
+  80285b:	40 80 fe 09          	cmp    $0x9,%sil
+  80285f:	74 ed                	je     80284e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802861:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802864:	83 e0 fd             	and    $0xfffffffd,%eax
+  802867:	3c 01                	cmp    $0x1,%al
+  802869:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80286d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802873:	75 0f                	jne    802884 <strtol+0x48>
+  802875:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802878:	74 14                	je     80288e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80287a:	85 d2                	test   %edx,%edx
+  80287c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802881:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802884:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802889:	4c 63 ca             	movslq %edx,%r9
+  80288c:	eb 36                	jmp    8028c4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80288e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802892:	74 0f                	je     8028a3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802894:	85 d2                	test   %edx,%edx
+  802896:	75 ec                	jne    802884 <strtol+0x48>
+        s++;
+  802898:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80289c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8028a1:	eb e1                	jmp    802884 <strtol+0x48>
+        s += 2;
+  8028a3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8028a7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8028ac:	eb d6                	jmp    802884 <strtol+0x48>
+            dig -= '0';
+  8028ae:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8028b1:	44 0f b6 c1          	movzbl %cl,%r8d
+  8028b5:	41 39 d0             	cmp    %edx,%r8d
+  8028b8:	7d 21                	jge    8028db <strtol+0x9f>
+        val = val * base + dig;
+  8028ba:	49 0f af c1          	imul   %r9,%rax
+  8028be:	0f b6 c9             	movzbl %cl,%ecx
+  8028c1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8028c4:	48 83 c7 01          	add    $0x1,%rdi
+  8028c8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8028cc:	80 f9 39             	cmp    $0x39,%cl
+  8028cf:	76 dd                	jbe    8028ae <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8028d1:	80 f9 7b             	cmp    $0x7b,%cl
+  8028d4:	77 05                	ja     8028db <strtol+0x9f>
+            dig -= 'a' - 10;
+  8028d6:	83 e9 57             	sub    $0x57,%ecx
+  8028d9:	eb d6                	jmp    8028b1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8028db:	4d 85 d2             	test   %r10,%r10
+  8028de:	74 03                	je     8028e3 <strtol+0xa7>
+  8028e0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8028e3:	48 89 c2             	mov    %rax,%rdx
+  8028e6:	48 f7 da             	neg    %rdx
+  8028e9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8028ed:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8028f1:	c3                   	ret
+
+00000000008028f2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+  8028f6:	53                   	push   %rbx
+  8028f7:	48 89 fa             	mov    %rdi,%rdx
+  8028fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802902:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802907:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80290c:	be 00 00 00 00       	mov    $0x0,%esi
+  802911:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802917:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80291d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80291f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+0000000000802925 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802925:	55                   	push   %rbp
+  802926:	48 89 e5             	mov    %rsp,%rbp
+  802929:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80292a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80292f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802934:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802939:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80293e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802943:	be 00 00 00 00       	mov    $0x0,%esi
+  802948:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80294e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802954:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802956:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80295a:	c9                   	leave
+  80295b:	c3                   	ret
+
+000000000080295c <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80295c:	55                   	push   %rbp
+  80295d:	48 89 e5             	mov    %rsp,%rbp
+  802960:	53                   	push   %rbx
+  802961:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802964:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802969:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80296e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802973:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802978:	be 00 00 00 00       	mov    $0x0,%esi
+  80297d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802983:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802989:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  80298b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80298f:	c9                   	leave
+  802990:	c3                   	ret
+
+0000000000802991 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802991:	55                   	push   %rbp
+  802992:	48 89 e5             	mov    %rsp,%rbp
+  802995:	53                   	push   %rbx
+  802996:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  80299a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80299d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029c4:	48 85 c0             	test   %rax,%rax
+  8029c7:	7f 06                	jg     8029cf <sys_env_destroy+0x3e>
+}
+  8029c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029cf:	49 89 c0             	mov    %rax,%r8
+  8029d2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8029d7:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  8029de:	00 00 00 
+  8029e1:	be 27 00 00 00       	mov    $0x27,%esi
+  8029e6:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  8029ed:	00 00 00 
+  8029f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f5:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  8029fc:	00 00 00 
+  8029ff:	41 ff d1             	call   *%r9
+
+0000000000802a02 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a02:	55                   	push   %rbp
+  802a03:	48 89 e5             	mov    %rsp,%rbp
+  802a06:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a07:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a11:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a20:	be 00 00 00 00       	mov    $0x0,%esi
+  802a25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a2b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a31:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a37:	c9                   	leave
+  802a38:	c3                   	ret
+
+0000000000802a39 <sys_yield>:
+
+void
+sys_yield(void) {
+  802a39:	55                   	push   %rbp
+  802a3a:	48 89 e5             	mov    %rsp,%rbp
+  802a3d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a3e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a43:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a48:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a52:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a57:	be 00 00 00 00       	mov    $0x0,%esi
+  802a5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a68:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a6e:	c9                   	leave
+  802a6f:	c3                   	ret
+
+0000000000802a70 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a70:	55                   	push   %rbp
+  802a71:	48 89 e5             	mov    %rsp,%rbp
+  802a74:	53                   	push   %rbx
+  802a75:	48 89 fa             	mov    %rdi,%rdx
+  802a78:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a7b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a80:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a87:	00 00 00 
+  802a8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aa0:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802aa2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+
+0000000000802aa8 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	53                   	push   %rbx
+  802aad:	49 89 f8             	mov    %rdi,%r8
+  802ab0:	48 89 d3             	mov    %rdx,%rbx
+  802ab3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802ab6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802abb:	4c 89 c2             	mov    %r8,%rdx
+  802abe:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802acc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802ad4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ad8:	c9                   	leave
+  802ad9:	c3                   	ret
+
+0000000000802ada <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802ada:	55                   	push   %rbp
+  802adb:	48 89 e5             	mov    %rsp,%rbp
+  802ade:	53                   	push   %rbx
+  802adf:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae3:	89 f8                	mov    %edi,%eax
+  802ae5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802ae8:	48 63 f9             	movslq %ecx,%rdi
+  802aeb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aee:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802af3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802af6:	be 00 00 00 00       	mov    $0x0,%esi
+  802afb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b07:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b09:	48 85 c0             	test   %rax,%rax
+  802b0c:	7f 06                	jg     802b14 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b12:	c9                   	leave
+  802b13:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b14:	49 89 c0             	mov    %rax,%r8
+  802b17:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b1c:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802b23:	00 00 00 
+  802b26:	be 27 00 00 00       	mov    $0x27,%esi
+  802b2b:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802b32:	00 00 00 
+  802b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3a:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802b41:	00 00 00 
+  802b44:	41 ff d1             	call   *%r9
+
+0000000000802b47 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802b47:	55                   	push   %rbp
+  802b48:	48 89 e5             	mov    %rsp,%rbp
+  802b4b:	53                   	push   %rbx
+  802b4c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b50:	89 f8                	mov    %edi,%eax
+  802b52:	49 89 f2             	mov    %rsi,%r10
+  802b55:	48 89 cf             	mov    %rcx,%rdi
+  802b58:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b5b:	48 63 da             	movslq %edx,%rbx
+  802b5e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b61:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b66:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b69:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b72:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b74:	48 85 c0             	test   %rax,%rax
+  802b77:	7f 06                	jg     802b7f <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7d:	c9                   	leave
+  802b7e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b7f:	49 89 c0             	mov    %rax,%r8
+  802b82:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b87:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802b8e:	00 00 00 
+  802b91:	be 27 00 00 00       	mov    $0x27,%esi
+  802b96:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802b9d:	00 00 00 
+  802ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba5:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802bac:	00 00 00 
+  802baf:	41 ff d1             	call   *%r9
+
+0000000000802bb2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	53                   	push   %rbx
+  802bb7:	48 83 ec 08          	sub    $0x8,%rsp
+  802bbb:	48 89 f1             	mov    %rsi,%rcx
+  802bbe:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802bc1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bc9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bce:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bd9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bdf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be1:	48 85 c0             	test   %rax,%rax
+  802be4:	7f 06                	jg     802bec <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802be6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bea:	c9                   	leave
+  802beb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bec:	49 89 c0             	mov    %rax,%r8
+  802bef:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802bf4:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802bfb:	00 00 00 
+  802bfe:	be 27 00 00 00       	mov    $0x27,%esi
+  802c03:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802c0a:	00 00 00 
+  802c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c12:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802c19:	00 00 00 
+  802c1c:	41 ff d1             	call   *%r9
+
+0000000000802c1f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c1f:	55                   	push   %rbp
+  802c20:	48 89 e5             	mov    %rsp,%rbp
+  802c23:	53                   	push   %rbx
+  802c24:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c28:	48 63 ce             	movslq %esi,%rcx
+  802c2b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c2e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c38:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c3d:	be 00 00 00 00       	mov    $0x0,%esi
+  802c42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c48:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c4e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c50:	48 85 c0             	test   %rax,%rax
+  802c53:	7f 06                	jg     802c5b <sys_env_set_status+0x3c>
+}
+  802c55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c59:	c9                   	leave
+  802c5a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5b:	49 89 c0             	mov    %rax,%r8
+  802c5e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c63:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802c6a:	00 00 00 
+  802c6d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c72:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802c79:	00 00 00 
+  802c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c81:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802c88:	00 00 00 
+  802c8b:	41 ff d1             	call   *%r9
+
+0000000000802c8e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802c8e:	55                   	push   %rbp
+  802c8f:	48 89 e5             	mov    %rsp,%rbp
+  802c92:	53                   	push   %rbx
+  802c93:	48 83 ec 08          	sub    $0x8,%rsp
+  802c97:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802c9a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cac:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cbf:	48 85 c0             	test   %rax,%rax
+  802cc2:	7f 06                	jg     802cca <sys_env_set_trapframe+0x3c>
+}
+  802cc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cca:	49 89 c0             	mov    %rax,%r8
+  802ccd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802cd2:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802cd9:	00 00 00 
+  802cdc:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce1:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802ce8:	00 00 00 
+  802ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf0:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802cf7:	00 00 00 
+  802cfa:	41 ff d1             	call   *%r9
+
+0000000000802cfd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802cfd:	55                   	push   %rbp
+  802cfe:	48 89 e5             	mov    %rsp,%rbp
+  802d01:	53                   	push   %rbx
+  802d02:	48 83 ec 08          	sub    $0x8,%rsp
+  802d06:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d09:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d0c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d2e:	48 85 c0             	test   %rax,%rax
+  802d31:	7f 06                	jg     802d39 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802d33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d37:	c9                   	leave
+  802d38:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d39:	49 89 c0             	mov    %rax,%r8
+  802d3c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802d41:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802d48:	00 00 00 
+  802d4b:	be 27 00 00 00       	mov    $0x27,%esi
+  802d50:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802d57:	00 00 00 
+  802d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5f:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802d66:	00 00 00 
+  802d69:	41 ff d1             	call   *%r9
+
+0000000000802d6c <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d6c:	55                   	push   %rbp
+  802d6d:	48 89 e5             	mov    %rsp,%rbp
+  802d70:	53                   	push   %rbx
+  802d71:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d75:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d79:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d86:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d8b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d9c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d9e:	48 85 c0             	test   %rax,%rax
+  802da1:	7f 06                	jg     802da9 <sys_env_set_reclaim+0x3d>
+}
+  802da3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da7:	c9                   	leave
+  802da8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802da9:	49 89 c0             	mov    %rax,%r8
+  802dac:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802db1:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802db8:	00 00 00 
+  802dbb:	be 27 00 00 00       	mov    $0x27,%esi
+  802dc0:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802dc7:	00 00 00 
+  802dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcf:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802dd6:	00 00 00 
+  802dd9:	41 ff d1             	call   *%r9
+
+0000000000802ddc <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802ddc:	55                   	push   %rbp
+  802ddd:	48 89 e5             	mov    %rsp,%rbp
+  802de0:	53                   	push   %rbx
+  802de1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802de5:	48 63 ce             	movslq %esi,%rcx
+  802de8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802deb:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dfa:	be 00 00 00 00       	mov    $0x0,%esi
+  802dff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e0b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e0d:	48 85 c0             	test   %rax,%rax
+  802e10:	7f 06                	jg     802e18 <sys_env_set_nice+0x3c>
+}
+  802e12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e16:	c9                   	leave
+  802e17:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e18:	49 89 c0             	mov    %rax,%r8
+  802e1b:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e20:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802e27:	00 00 00 
+  802e2a:	be 27 00 00 00       	mov    $0x27,%esi
+  802e2f:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802e36:	00 00 00 
+  802e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3e:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802e45:	00 00 00 
+  802e48:	41 ff d1             	call   *%r9
+
+0000000000802e4b <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802e4b:	55                   	push   %rbp
+  802e4c:	48 89 e5             	mov    %rsp,%rbp
+  802e4f:	53                   	push   %rbx
+  802e50:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e53:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e58:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e67:	be 00 00 00 00       	mov    $0x0,%esi
+  802e6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e78:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e7e:	c9                   	leave
+  802e7f:	c3                   	ret
+
+0000000000802e80 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e80:	55                   	push   %rbp
+  802e81:	48 89 e5             	mov    %rsp,%rbp
+  802e84:	53                   	push   %rbx
+  802e85:	89 f8                	mov    %edi,%eax
+  802e87:	49 89 f1             	mov    %rsi,%r9
+  802e8a:	48 89 d3             	mov    %rdx,%rbx
+  802e8d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e90:	49 63 f0             	movslq %r8d,%rsi
+  802e93:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e96:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e9b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ea4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802eaa:	cd 30                	int    $0x30
+}
+  802eac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eb0:	c9                   	leave
+  802eb1:	c3                   	ret
+
+0000000000802eb2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802eb2:	55                   	push   %rbp
+  802eb3:	48 89 e5             	mov    %rsp,%rbp
+  802eb6:	53                   	push   %rbx
+  802eb7:	89 f8                	mov    %edi,%eax
+  802eb9:	49 89 f1             	mov    %rsi,%r9
+  802ebc:	48 89 d3             	mov    %rdx,%rbx
+  802ebf:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ec2:	49 63 f0             	movslq %r8d,%rsi
+  802ec5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ec8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ecd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ed0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ed6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802edc:	cd 30                	int    $0x30
+}
+  802ede:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ee2:	c9                   	leave
+  802ee3:	c3                   	ret
+
+0000000000802ee4 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802ee4:	55                   	push   %rbp
+  802ee5:	48 89 e5             	mov    %rsp,%rbp
+  802ee8:	53                   	push   %rbx
+  802ee9:	48 83 ec 08          	sub    $0x8,%rsp
+  802eed:	89 f8                	mov    %edi,%eax
+  802eef:	49 89 f2             	mov    %rsi,%r10
+  802ef2:	48 89 d3             	mov    %rdx,%rbx
+  802ef5:	48 89 cf             	mov    %rcx,%rdi
+  802ef8:	44 89 c6             	mov    %r8d,%esi
+  802efb:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802efe:	48 63 f6             	movslq %esi,%rsi
+  802f01:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f04:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f09:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f0c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f10:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f12:	48 85 c0             	test   %rax,%rax
+  802f15:	7f 06                	jg     802f1d <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f1b:	c9                   	leave
+  802f1c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f1d:	49 89 c0             	mov    %rax,%r8
+  802f20:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f25:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802f2c:	00 00 00 
+  802f2f:	be 27 00 00 00       	mov    $0x27,%esi
+  802f34:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802f3b:	00 00 00 
+  802f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f43:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802f4a:	00 00 00 
+  802f4d:	41 ff d1             	call   *%r9
+
+0000000000802f50 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802f50:	55                   	push   %rbp
+  802f51:	48 89 e5             	mov    %rsp,%rbp
+  802f54:	53                   	push   %rbx
+  802f55:	48 83 ec 08          	sub    $0x8,%rsp
+  802f59:	48 89 f1             	mov    %rsi,%rcx
+  802f5c:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f5f:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f63:	48 8b 1a             	mov    (%rdx),%rbx
+  802f66:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f69:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f6e:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f72:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f76:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f7a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f7c:	48 85 c0             	test   %rax,%rax
+  802f7f:	7f 06                	jg     802f87 <sys_ipc_call_short+0x37>
+}
+  802f81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f85:	c9                   	leave
+  802f86:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f87:	49 89 c0             	mov    %rax,%r8
+  802f8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802f8f:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  802f96:	00 00 00 
+  802f99:	be 27 00 00 00       	mov    $0x27,%esi
+  802f9e:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  802fa5:	00 00 00 
+  802fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fad:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  802fb4:	00 00 00 
+  802fb7:	41 ff d1             	call   *%r9
+
+0000000000802fba <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802fba:	55                   	push   %rbp
+  802fbb:	48 89 e5             	mov    %rsp,%rbp
+  802fbe:	53                   	push   %rbx
+  802fbf:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc3:	89 f8                	mov    %edi,%eax
+  802fc5:	49 89 f2             	mov    %rsi,%r10
+  802fc8:	48 89 d3             	mov    %rdx,%rbx
+  802fcb:	48 89 cf             	mov    %rcx,%rdi
+  802fce:	44 89 c6             	mov    %r8d,%esi
+  802fd1:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802fd4:	48 63 f6             	movslq %esi,%rsi
+  802fd7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fda:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fdf:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802fe2:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802fe6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fe8:	48 85 c0             	test   %rax,%rax
+  802feb:	7f 06                	jg     802ff3 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802fed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff1:	c9                   	leave
+  802ff2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ff3:	49 89 c0             	mov    %rax,%r8
+  802ff6:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802ffb:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  803002:	00 00 00 
+  803005:	be 27 00 00 00       	mov    $0x27,%esi
+  80300a:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  803011:	00 00 00 
+  803014:	b8 00 00 00 00       	mov    $0x0,%eax
+  803019:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  803020:	00 00 00 
+  803023:	41 ff d1             	call   *%r9
+
+0000000000803026 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803026:	55                   	push   %rbp
+  803027:	48 89 e5             	mov    %rsp,%rbp
+  80302a:	53                   	push   %rbx
+  80302b:	48 83 ec 08          	sub    $0x8,%rsp
+  80302f:	48 89 fa             	mov    %rdi,%rdx
+  803032:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803035:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80303a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80303f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803044:	be 00 00 00 00       	mov    $0x0,%esi
+  803049:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80304f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803055:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803057:	48 85 c0             	test   %rax,%rax
+  80305a:	7f 06                	jg     803062 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80305c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803060:	c9                   	leave
+  803061:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803062:	49 89 c0             	mov    %rax,%r8
+  803065:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80306a:	48 ba 48 67 80 00 00 	movabs $0x806748,%rdx
+  803071:	00 00 00 
+  803074:	be 27 00 00 00       	mov    $0x27,%esi
+  803079:	48 bf 67 67 80 00 00 	movabs $0x806767,%rdi
+  803080:	00 00 00 
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+  803088:	49 b9 ee 18 80 00 00 	movabs $0x8018ee,%r9
+  80308f:	00 00 00 
+  803092:	41 ff d1             	call   *%r9
+
+0000000000803095 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803095:	55                   	push   %rbp
+  803096:	48 89 e5             	mov    %rsp,%rbp
+  803099:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80309a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80309f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030c4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030ca:	c9                   	leave
+  8030cb:	c3                   	ret
+
+00000000008030cc <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8030cc:	55                   	push   %rbp
+  8030cd:	48 89 e5             	mov    %rsp,%rbp
+  8030d0:	53                   	push   %rbx
+  8030d1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030d4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030f9:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  8030fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030ff:	c9                   	leave
+  803100:	c3                   	ret
+
+0000000000803101 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803101:	55                   	push   %rbp
+  803102:	48 89 e5             	mov    %rsp,%rbp
+  803105:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803106:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80310b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803110:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80311a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80311f:	be 00 00 00 00       	mov    $0x0,%esi
+  803124:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80312a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803130:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803132:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803136:	c9                   	leave
+  803137:	c3                   	ret
+
+0000000000803138 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  803138:	55                   	push   %rbp
+  803139:	48 89 e5             	mov    %rsp,%rbp
+  80313c:	53                   	push   %rbx
+  80313d:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803141:	b8 08 00 00 00       	mov    $0x8,%eax
+  803146:	cd 30                	int    $0x30
+  803148:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  80314a:	85 c0                	test   %eax,%eax
+  80314c:	0f 88 85 00 00 00    	js     8031d7 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803152:	0f 84 ac 00 00 00    	je     803204 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  803158:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80315e:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  803165:	00 00 00 
+  803168:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80316d:	89 c2                	mov    %eax,%edx
+  80316f:	be 00 00 00 00       	mov    $0x0,%esi
+  803174:	bf 00 00 00 00       	mov    $0x0,%edi
+  803179:	48 b8 47 2b 80 00 00 	movabs $0x802b47,%rax
+  803180:	00 00 00 
+  803183:	ff d0                	call   *%rax
+  803185:	85 c0                	test   %eax,%eax
+  803187:	0f 88 a8 00 00 00    	js     803235 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  80318d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803194:	00 00 00 
+  803197:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  80319e:	89 df                	mov    %ebx,%edi
+  8031a0:	48 b8 fd 2c 80 00 00 	movabs $0x802cfd,%rax
+  8031a7:	00 00 00 
+  8031aa:	ff d0                	call   *%rax
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	0f 88 ae 00 00 00    	js     803262 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8031b4:	be 02 00 00 00       	mov    $0x2,%esi
+  8031b9:	89 df                	mov    %ebx,%edi
+  8031bb:	48 b8 1f 2c 80 00 00 	movabs $0x802c1f,%rax
+  8031c2:	00 00 00 
+  8031c5:	ff d0                	call   *%rax
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	0f 88 c0 00 00 00    	js     80328f <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  8031cf:	89 d8                	mov    %ebx,%eax
+  8031d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031d5:	c9                   	leave
+  8031d6:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  8031d7:	89 c1                	mov    %eax,%ecx
+  8031d9:	48 ba 75 67 80 00 00 	movabs $0x806775,%rdx
+  8031e0:	00 00 00 
+  8031e3:	be 20 00 00 00       	mov    $0x20,%esi
+  8031e8:	48 bf 85 67 80 00 00 	movabs $0x806785,%rdi
+  8031ef:	00 00 00 
+  8031f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f7:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  8031fe:	00 00 00 
+  803201:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803204:	48 b8 02 2a 80 00 00 	movabs $0x802a02,%rax
+  80320b:	00 00 00 
+  80320e:	ff d0                	call   *%rax
+  803210:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803215:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80321c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803223:	00 00 00 
+  803226:	48 01 d0             	add    %rdx,%rax
+  803229:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  803230:	00 00 00 
+        return 0;
+  803233:	eb 9a                	jmp    8031cf <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803235:	89 c1                	mov    %eax,%ecx
+  803237:	48 ba 90 67 80 00 00 	movabs $0x806790,%rdx
+  80323e:	00 00 00 
+  803241:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803246:	48 bf 85 67 80 00 00 	movabs $0x806785,%rdi
+  80324d:	00 00 00 
+  803250:	b8 00 00 00 00       	mov    $0x0,%eax
+  803255:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  80325c:	00 00 00 
+  80325f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803262:	89 c1                	mov    %eax,%ecx
+  803264:	48 ba d8 67 80 00 00 	movabs $0x8067d8,%rdx
+  80326b:	00 00 00 
+  80326e:	be 32 00 00 00       	mov    $0x32,%esi
+  803273:	48 bf 85 67 80 00 00 	movabs $0x806785,%rdi
+  80327a:	00 00 00 
+  80327d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803282:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803289:	00 00 00 
+  80328c:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  80328f:	89 c1                	mov    %eax,%ecx
+  803291:	48 ba a3 67 80 00 00 	movabs $0x8067a3,%rdx
+  803298:	00 00 00 
+  80329b:	be 37 00 00 00       	mov    $0x37,%esi
+  8032a0:	48 bf 85 67 80 00 00 	movabs $0x806785,%rdi
+  8032a7:	00 00 00 
+  8032aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032af:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  8032b6:	00 00 00 
+  8032b9:	41 ff d0             	call   *%r8
+
+00000000008032bc <sfork>:
+
+envid_t
+sfork() {
+  8032bc:	55                   	push   %rbp
+  8032bd:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8032c0:	48 ba ba 67 80 00 00 	movabs $0x8067ba,%rdx
+  8032c7:	00 00 00 
+  8032ca:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8032cf:	48 bf 85 67 80 00 00 	movabs $0x806785,%rdi
+  8032d6:	00 00 00 
+  8032d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032de:	48 b9 ee 18 80 00 00 	movabs $0x8018ee,%rcx
+  8032e5:	00 00 00 
+  8032e8:	ff d1                	call   *%rcx
+
+00000000008032ea <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8032ea:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8032f1:	ff ff ff 
+  8032f4:	48 01 f8             	add    %rdi,%rax
+  8032f7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8032fb:	c3                   	ret
+
+00000000008032fc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8032fc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803303:	ff ff ff 
+  803306:	48 01 f8             	add    %rdi,%rax
+  803309:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80330d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803313:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803317:	c3                   	ret
+
+0000000000803318 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803318:	55                   	push   %rbp
+  803319:	48 89 e5             	mov    %rsp,%rbp
+  80331c:	41 57                	push   %r15
+  80331e:	41 56                	push   %r14
+  803320:	41 55                	push   %r13
+  803322:	41 54                	push   %r12
+  803324:	53                   	push   %rbx
+  803325:	48 83 ec 08          	sub    $0x8,%rsp
+  803329:	49 89 ff             	mov    %rdi,%r15
+  80332c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803331:	49 bd d1 48 80 00 00 	movabs $0x8048d1,%r13
+  803338:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80333b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803341:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803344:	48 89 df             	mov    %rbx,%rdi
+  803347:	41 ff d5             	call   *%r13
+  80334a:	83 e0 04             	and    $0x4,%eax
+  80334d:	74 17                	je     803366 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80334f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803356:	4c 39 f3             	cmp    %r14,%rbx
+  803359:	75 e6                	jne    803341 <fd_alloc+0x29>
+  80335b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803361:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803366:	4d 89 27             	mov    %r12,(%r15)
+}
+  803369:	48 83 c4 08          	add    $0x8,%rsp
+  80336d:	5b                   	pop    %rbx
+  80336e:	41 5c                	pop    %r12
+  803370:	41 5d                	pop    %r13
+  803372:	41 5e                	pop    %r14
+  803374:	41 5f                	pop    %r15
+  803376:	5d                   	pop    %rbp
+  803377:	c3                   	ret
+
+0000000000803378 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803378:	83 ff 1f             	cmp    $0x1f,%edi
+  80337b:	77 39                	ja     8033b6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80337d:	55                   	push   %rbp
+  80337e:	48 89 e5             	mov    %rsp,%rbp
+  803381:	41 54                	push   %r12
+  803383:	53                   	push   %rbx
+  803384:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803387:	48 63 df             	movslq %edi,%rbx
+  80338a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803391:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803395:	48 89 df             	mov    %rbx,%rdi
+  803398:	48 b8 d1 48 80 00 00 	movabs $0x8048d1,%rax
+  80339f:	00 00 00 
+  8033a2:	ff d0                	call   *%rax
+  8033a4:	a8 04                	test   $0x4,%al
+  8033a6:	74 14                	je     8033bc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8033a8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8033ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033b1:	5b                   	pop    %rbx
+  8033b2:	41 5c                	pop    %r12
+  8033b4:	5d                   	pop    %rbp
+  8033b5:	c3                   	ret
+        return -E_INVAL;
+  8033b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8033bb:	c3                   	ret
+        return -E_INVAL;
+  8033bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c1:	eb ee                	jmp    8033b1 <fd_lookup+0x39>
+
+00000000008033c3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8033c3:	55                   	push   %rbp
+  8033c4:	48 89 e5             	mov    %rsp,%rbp
+  8033c7:	41 54                	push   %r12
+  8033c9:	53                   	push   %rbx
+  8033ca:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8033cd:	48 b8 80 68 80 00 00 	movabs $0x806880,%rax
+  8033d4:	00 00 00 
+  8033d7:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8033de:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8033e1:	39 3b                	cmp    %edi,(%rbx)
+  8033e3:	74 47                	je     80342c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8033e5:	48 83 c0 08          	add    $0x8,%rax
+  8033e9:	48 8b 18             	mov    (%rax),%rbx
+  8033ec:	48 85 db             	test   %rbx,%rbx
+  8033ef:	75 f0                	jne    8033e1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8033f1:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033f8:	00 00 00 
+  8033fb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803401:	89 fa                	mov    %edi,%edx
+  803403:	48 bf f8 67 80 00 00 	movabs $0x8067f8,%rdi
+  80340a:	00 00 00 
+  80340d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803412:	48 b9 3e 1a 80 00 00 	movabs $0x801a3e,%rcx
+  803419:	00 00 00 
+  80341c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80341e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803423:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803427:	5b                   	pop    %rbx
+  803428:	41 5c                	pop    %r12
+  80342a:	5d                   	pop    %rbp
+  80342b:	c3                   	ret
+            return 0;
+  80342c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803431:	eb f0                	jmp    803423 <dev_lookup+0x60>
+
+0000000000803433 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803433:	55                   	push   %rbp
+  803434:	48 89 e5             	mov    %rsp,%rbp
+  803437:	41 55                	push   %r13
+  803439:	41 54                	push   %r12
+  80343b:	53                   	push   %rbx
+  80343c:	48 83 ec 18          	sub    $0x18,%rsp
+  803440:	48 89 fb             	mov    %rdi,%rbx
+  803443:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803446:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80344d:	ff ff ff 
+  803450:	48 01 df             	add    %rbx,%rdi
+  803453:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803457:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80345b:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  803462:	00 00 00 
+  803465:	ff d0                	call   *%rax
+  803467:	41 89 c5             	mov    %eax,%r13d
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	78 06                	js     803474 <fd_close+0x41>
+  80346e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803472:	74 1a                	je     80348e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803474:	45 84 e4             	test   %r12b,%r12b
+  803477:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803480:	44 89 e8             	mov    %r13d,%eax
+  803483:	48 83 c4 18          	add    $0x18,%rsp
+  803487:	5b                   	pop    %rbx
+  803488:	41 5c                	pop    %r12
+  80348a:	41 5d                	pop    %r13
+  80348c:	5d                   	pop    %rbp
+  80348d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80348e:	8b 3b                	mov    (%rbx),%edi
+  803490:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803494:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+  8034a0:	41 89 c5             	mov    %eax,%r13d
+  8034a3:	85 c0                	test   %eax,%eax
+  8034a5:	78 1b                	js     8034c2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8034a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034ab:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034af:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8034b5:	48 85 c0             	test   %rax,%rax
+  8034b8:	74 08                	je     8034c2 <fd_close+0x8f>
+  8034ba:	48 89 df             	mov    %rbx,%rdi
+  8034bd:	ff d0                	call   *%rax
+  8034bf:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8034c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034c7:	48 89 de             	mov    %rbx,%rsi
+  8034ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cf:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  8034d6:	00 00 00 
+  8034d9:	ff d0                	call   *%rax
+    return res;
+  8034db:	eb a3                	jmp    803480 <fd_close+0x4d>
+
+00000000008034dd <close>:
+
+int
+close(int fdnum) {
+  8034dd:	55                   	push   %rbp
+  8034de:	48 89 e5             	mov    %rsp,%rbp
+  8034e1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034e9:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  8034f0:	00 00 00 
+  8034f3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	78 15                	js     80350e <close+0x31>
+
+    return fd_close(fd, 1);
+  8034f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8034fe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803502:	48 b8 33 34 80 00 00 	movabs $0x803433,%rax
+  803509:	00 00 00 
+  80350c:	ff d0                	call   *%rax
+}
+  80350e:	c9                   	leave
+  80350f:	c3                   	ret
+
+0000000000803510 <close_all>:
+
+void
+close_all(void) {
+  803510:	55                   	push   %rbp
+  803511:	48 89 e5             	mov    %rsp,%rbp
+  803514:	41 54                	push   %r12
+  803516:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80351c:	49 bc dd 34 80 00 00 	movabs $0x8034dd,%r12
+  803523:	00 00 00 
+  803526:	89 df                	mov    %ebx,%edi
+  803528:	41 ff d4             	call   *%r12
+  80352b:	83 c3 01             	add    $0x1,%ebx
+  80352e:	83 fb 20             	cmp    $0x20,%ebx
+  803531:	75 f3                	jne    803526 <close_all+0x16>
+}
+  803533:	5b                   	pop    %rbx
+  803534:	41 5c                	pop    %r12
+  803536:	5d                   	pop    %rbp
+  803537:	c3                   	ret
+
+0000000000803538 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803538:	55                   	push   %rbp
+  803539:	48 89 e5             	mov    %rsp,%rbp
+  80353c:	41 57                	push   %r15
+  80353e:	41 56                	push   %r14
+  803540:	41 55                	push   %r13
+  803542:	41 54                	push   %r12
+  803544:	53                   	push   %rbx
+  803545:	48 83 ec 18          	sub    $0x18,%rsp
+  803549:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80354c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803550:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  803557:	00 00 00 
+  80355a:	ff d0                	call   *%rax
+  80355c:	89 c3                	mov    %eax,%ebx
+  80355e:	85 c0                	test   %eax,%eax
+  803560:	0f 88 b8 00 00 00    	js     80361e <dup+0xe6>
+    close(newfdnum);
+  803566:	44 89 e7             	mov    %r12d,%edi
+  803569:	48 b8 dd 34 80 00 00 	movabs $0x8034dd,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803575:	4d 63 ec             	movslq %r12d,%r13
+  803578:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80357f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803583:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803587:	4c 89 ff             	mov    %r15,%rdi
+  80358a:	49 be fc 32 80 00 00 	movabs $0x8032fc,%r14
+  803591:	00 00 00 
+  803594:	41 ff d6             	call   *%r14
+  803597:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80359a:	4c 89 ef             	mov    %r13,%rdi
+  80359d:	41 ff d6             	call   *%r14
+  8035a0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8035a3:	48 89 df             	mov    %rbx,%rdi
+  8035a6:	48 b8 d1 48 80 00 00 	movabs $0x8048d1,%rax
+  8035ad:	00 00 00 
+  8035b0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8035b2:	a8 04                	test   $0x4,%al
+  8035b4:	74 2b                	je     8035e1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8035b6:	41 89 c1             	mov    %eax,%r9d
+  8035b9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035bf:	4c 89 f1             	mov    %r14,%rcx
+  8035c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c7:	48 89 de             	mov    %rbx,%rsi
+  8035ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035cf:	48 b8 47 2b 80 00 00 	movabs $0x802b47,%rax
+  8035d6:	00 00 00 
+  8035d9:	ff d0                	call   *%rax
+  8035db:	89 c3                	mov    %eax,%ebx
+  8035dd:	85 c0                	test   %eax,%eax
+  8035df:	78 4e                	js     80362f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8035e1:	4c 89 ff             	mov    %r15,%rdi
+  8035e4:	48 b8 d1 48 80 00 00 	movabs $0x8048d1,%rax
+  8035eb:	00 00 00 
+  8035ee:	ff d0                	call   *%rax
+  8035f0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8035f3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035f9:	4c 89 e9             	mov    %r13,%rcx
+  8035fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803601:	4c 89 fe             	mov    %r15,%rsi
+  803604:	bf 00 00 00 00       	mov    $0x0,%edi
+  803609:	48 b8 47 2b 80 00 00 	movabs $0x802b47,%rax
+  803610:	00 00 00 
+  803613:	ff d0                	call   *%rax
+  803615:	89 c3                	mov    %eax,%ebx
+  803617:	85 c0                	test   %eax,%eax
+  803619:	78 14                	js     80362f <dup+0xf7>
+
+    return newfdnum;
+  80361b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80361e:	89 d8                	mov    %ebx,%eax
+  803620:	48 83 c4 18          	add    $0x18,%rsp
+  803624:	5b                   	pop    %rbx
+  803625:	41 5c                	pop    %r12
+  803627:	41 5d                	pop    %r13
+  803629:	41 5e                	pop    %r14
+  80362b:	41 5f                	pop    %r15
+  80362d:	5d                   	pop    %rbp
+  80362e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80362f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803634:	4c 89 ee             	mov    %r13,%rsi
+  803637:	bf 00 00 00 00       	mov    $0x0,%edi
+  80363c:	49 bc b2 2b 80 00 00 	movabs $0x802bb2,%r12
+  803643:	00 00 00 
+  803646:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803649:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80364e:	4c 89 f6             	mov    %r14,%rsi
+  803651:	bf 00 00 00 00       	mov    $0x0,%edi
+  803656:	41 ff d4             	call   *%r12
+    return res;
+  803659:	eb c3                	jmp    80361e <dup+0xe6>
+
+000000000080365b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80365b:	55                   	push   %rbp
+  80365c:	48 89 e5             	mov    %rsp,%rbp
+  80365f:	41 56                	push   %r14
+  803661:	41 55                	push   %r13
+  803663:	41 54                	push   %r12
+  803665:	53                   	push   %rbx
+  803666:	48 83 ec 10          	sub    $0x10,%rsp
+  80366a:	89 fb                	mov    %edi,%ebx
+  80366c:	49 89 f4             	mov    %rsi,%r12
+  80366f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803672:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803676:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  80367d:	00 00 00 
+  803680:	ff d0                	call   *%rax
+  803682:	85 c0                	test   %eax,%eax
+  803684:	78 4c                	js     8036d2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803686:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80368a:	41 8b 3e             	mov    (%r14),%edi
+  80368d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803691:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  803698:	00 00 00 
+  80369b:	ff d0                	call   *%rax
+  80369d:	85 c0                	test   %eax,%eax
+  80369f:	78 35                	js     8036d6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8036a1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8036a5:	83 e0 03             	and    $0x3,%eax
+  8036a8:	83 f8 01             	cmp    $0x1,%eax
+  8036ab:	74 2d                	je     8036da <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036b1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8036b5:	48 85 c0             	test   %rax,%rax
+  8036b8:	74 56                	je     803710 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8036ba:	4c 89 ea             	mov    %r13,%rdx
+  8036bd:	4c 89 e6             	mov    %r12,%rsi
+  8036c0:	4c 89 f7             	mov    %r14,%rdi
+  8036c3:	ff d0                	call   *%rax
+}
+  8036c5:	48 83 c4 10          	add    $0x10,%rsp
+  8036c9:	5b                   	pop    %rbx
+  8036ca:	41 5c                	pop    %r12
+  8036cc:	41 5d                	pop    %r13
+  8036ce:	41 5e                	pop    %r14
+  8036d0:	5d                   	pop    %rbp
+  8036d1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036d2:	48 98                	cltq
+  8036d4:	eb ef                	jmp    8036c5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036d6:	48 98                	cltq
+  8036d8:	eb eb                	jmp    8036c5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8036da:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8036e1:	00 00 00 
+  8036e4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8036ea:	89 da                	mov    %ebx,%edx
+  8036ec:	48 bf 39 68 80 00 00 	movabs $0x806839,%rdi
+  8036f3:	00 00 00 
+  8036f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fb:	48 b9 3e 1a 80 00 00 	movabs $0x801a3e,%rcx
+  803702:	00 00 00 
+  803705:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803707:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80370e:	eb b5                	jmp    8036c5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803710:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803717:	eb ac                	jmp    8036c5 <read+0x6a>
+
+0000000000803719 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803719:	55                   	push   %rbp
+  80371a:	48 89 e5             	mov    %rsp,%rbp
+  80371d:	41 57                	push   %r15
+  80371f:	41 56                	push   %r14
+  803721:	41 55                	push   %r13
+  803723:	41 54                	push   %r12
+  803725:	53                   	push   %rbx
+  803726:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80372a:	48 85 d2             	test   %rdx,%rdx
+  80372d:	74 54                	je     803783 <readn+0x6a>
+  80372f:	41 89 fd             	mov    %edi,%r13d
+  803732:	49 89 f6             	mov    %rsi,%r14
+  803735:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803738:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80373d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803742:	49 bf 5b 36 80 00 00 	movabs $0x80365b,%r15
+  803749:	00 00 00 
+  80374c:	4c 89 e2             	mov    %r12,%rdx
+  80374f:	48 29 f2             	sub    %rsi,%rdx
+  803752:	4c 01 f6             	add    %r14,%rsi
+  803755:	44 89 ef             	mov    %r13d,%edi
+  803758:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80375b:	85 c0                	test   %eax,%eax
+  80375d:	78 20                	js     80377f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80375f:	01 c3                	add    %eax,%ebx
+  803761:	85 c0                	test   %eax,%eax
+  803763:	74 08                	je     80376d <readn+0x54>
+  803765:	48 63 f3             	movslq %ebx,%rsi
+  803768:	4c 39 e6             	cmp    %r12,%rsi
+  80376b:	72 df                	jb     80374c <readn+0x33>
+    }
+    return res;
+  80376d:	48 63 c3             	movslq %ebx,%rax
+}
+  803770:	48 83 c4 08          	add    $0x8,%rsp
+  803774:	5b                   	pop    %rbx
+  803775:	41 5c                	pop    %r12
+  803777:	41 5d                	pop    %r13
+  803779:	41 5e                	pop    %r14
+  80377b:	41 5f                	pop    %r15
+  80377d:	5d                   	pop    %rbp
+  80377e:	c3                   	ret
+        if (inc < 0) return inc;
+  80377f:	48 98                	cltq
+  803781:	eb ed                	jmp    803770 <readn+0x57>
+    int inc = 1, res = 0;
+  803783:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803788:	eb e3                	jmp    80376d <readn+0x54>
+
+000000000080378a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80378a:	55                   	push   %rbp
+  80378b:	48 89 e5             	mov    %rsp,%rbp
+  80378e:	41 56                	push   %r14
+  803790:	41 55                	push   %r13
+  803792:	41 54                	push   %r12
+  803794:	53                   	push   %rbx
+  803795:	48 83 ec 10          	sub    $0x10,%rsp
+  803799:	89 fb                	mov    %edi,%ebx
+  80379b:	49 89 f4             	mov    %rsi,%r12
+  80379e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037a1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037a5:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  8037ac:	00 00 00 
+  8037af:	ff d0                	call   *%rax
+  8037b1:	85 c0                	test   %eax,%eax
+  8037b3:	78 47                	js     8037fc <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037b5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8037b9:	41 8b 3e             	mov    (%r14),%edi
+  8037bc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037c0:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8037c7:	00 00 00 
+  8037ca:	ff d0                	call   *%rax
+  8037cc:	85 c0                	test   %eax,%eax
+  8037ce:	78 30                	js     803800 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037d0:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8037d5:	74 2d                	je     803804 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8037d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037db:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8037df:	48 85 c0             	test   %rax,%rax
+  8037e2:	74 56                	je     80383a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8037e4:	4c 89 ea             	mov    %r13,%rdx
+  8037e7:	4c 89 e6             	mov    %r12,%rsi
+  8037ea:	4c 89 f7             	mov    %r14,%rdi
+  8037ed:	ff d0                	call   *%rax
+}
+  8037ef:	48 83 c4 10          	add    $0x10,%rsp
+  8037f3:	5b                   	pop    %rbx
+  8037f4:	41 5c                	pop    %r12
+  8037f6:	41 5d                	pop    %r13
+  8037f8:	41 5e                	pop    %r14
+  8037fa:	5d                   	pop    %rbp
+  8037fb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037fc:	48 98                	cltq
+  8037fe:	eb ef                	jmp    8037ef <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803800:	48 98                	cltq
+  803802:	eb eb                	jmp    8037ef <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803804:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80380b:	00 00 00 
+  80380e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803814:	89 da                	mov    %ebx,%edx
+  803816:	48 bf 55 68 80 00 00 	movabs $0x806855,%rdi
+  80381d:	00 00 00 
+  803820:	b8 00 00 00 00       	mov    $0x0,%eax
+  803825:	48 b9 3e 1a 80 00 00 	movabs $0x801a3e,%rcx
+  80382c:	00 00 00 
+  80382f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803831:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803838:	eb b5                	jmp    8037ef <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80383a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803841:	eb ac                	jmp    8037ef <write+0x65>
+
+0000000000803843 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803843:	55                   	push   %rbp
+  803844:	48 89 e5             	mov    %rsp,%rbp
+  803847:	53                   	push   %rbx
+  803848:	48 83 ec 18          	sub    $0x18,%rsp
+  80384c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80384e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803852:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  803859:	00 00 00 
+  80385c:	ff d0                	call   *%rax
+  80385e:	85 c0                	test   %eax,%eax
+  803860:	78 0c                	js     80386e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803866:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803869:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80386e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803872:	c9                   	leave
+  803873:	c3                   	ret
+
+0000000000803874 <tell>:
+
+int tell(int fdnum) {
+  803874:	55                   	push   %rbp
+  803875:	48 89 e5             	mov    %rsp,%rbp
+  803878:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80387c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803880:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  803887:	00 00 00 
+  80388a:	ff d0                	call   *%rax
+  80388c:	85 c0                	test   %eax,%eax
+  80388e:	78 07                	js     803897 <tell+0x23>
+
+    return fd->fd_offset;
+  803890:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803894:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803897:	c9                   	leave
+  803898:	c3                   	ret
+
+0000000000803899 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803899:	55                   	push   %rbp
+  80389a:	48 89 e5             	mov    %rsp,%rbp
+  80389d:	41 55                	push   %r13
+  80389f:	41 54                	push   %r12
+  8038a1:	53                   	push   %rbx
+  8038a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a6:	89 fb                	mov    %edi,%ebx
+  8038a8:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038af:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  8038b6:	00 00 00 
+  8038b9:	ff d0                	call   *%rax
+  8038bb:	85 c0                	test   %eax,%eax
+  8038bd:	78 38                	js     8038f7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038bf:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8038c3:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8038c7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038cb:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8038d2:	00 00 00 
+  8038d5:	ff d0                	call   *%rax
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	78 1c                	js     8038f7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038db:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8038e0:	74 20                	je     803902 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8038e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038e6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8038ea:	48 85 c0             	test   %rax,%rax
+  8038ed:	74 47                	je     803936 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8038ef:	44 89 e6             	mov    %r12d,%esi
+  8038f2:	4c 89 ef             	mov    %r13,%rdi
+  8038f5:	ff d0                	call   *%rax
+}
+  8038f7:	48 83 c4 18          	add    $0x18,%rsp
+  8038fb:	5b                   	pop    %rbx
+  8038fc:	41 5c                	pop    %r12
+  8038fe:	41 5d                	pop    %r13
+  803900:	5d                   	pop    %rbp
+  803901:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803902:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803909:	00 00 00 
+  80390c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803912:	89 da                	mov    %ebx,%edx
+  803914:	48 bf 18 68 80 00 00 	movabs $0x806818,%rdi
+  80391b:	00 00 00 
+  80391e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803923:	48 b9 3e 1a 80 00 00 	movabs $0x801a3e,%rcx
+  80392a:	00 00 00 
+  80392d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80392f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803934:	eb c1                	jmp    8038f7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803936:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80393b:	eb ba                	jmp    8038f7 <ftruncate+0x5e>
+
+000000000080393d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80393d:	55                   	push   %rbp
+  80393e:	48 89 e5             	mov    %rsp,%rbp
+  803941:	41 54                	push   %r12
+  803943:	53                   	push   %rbx
+  803944:	48 83 ec 10          	sub    $0x10,%rsp
+  803948:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80394b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80394f:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  803956:	00 00 00 
+  803959:	ff d0                	call   *%rax
+  80395b:	85 c0                	test   %eax,%eax
+  80395d:	78 63                	js     8039c2 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80395f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803963:	41 8b 3c 24          	mov    (%r12),%edi
+  803967:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80396b:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  803972:	00 00 00 
+  803975:	ff d0                	call   *%rax
+  803977:	85 c0                	test   %eax,%eax
+  803979:	78 47                	js     8039c2 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80397b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80397f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803984:	74 45                	je     8039cb <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803986:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803989:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803990:	00 00 00 
+    stat->st_isdir = 0;
+  803993:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80399a:	00 00 00 
+    stat->st_ino = 0;
+  80399d:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8039a4:	00 00 00 00 
+    stat->st_version = 0;
+  8039a8:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8039af:	00 00 00 
+    stat->st_dev = dev;
+  8039b2:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8039b9:	48 89 de             	mov    %rbx,%rsi
+  8039bc:	4c 89 e7             	mov    %r12,%rdi
+  8039bf:	ff 50 28             	call   *0x28(%rax)
+}
+  8039c2:	48 83 c4 10          	add    $0x10,%rsp
+  8039c6:	5b                   	pop    %rbx
+  8039c7:	41 5c                	pop    %r12
+  8039c9:	5d                   	pop    %rbp
+  8039ca:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039cb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039d0:	eb f0                	jmp    8039c2 <fstat+0x85>
+
+00000000008039d2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8039d2:	55                   	push   %rbp
+  8039d3:	48 89 e5             	mov    %rsp,%rbp
+  8039d6:	41 54                	push   %r12
+  8039d8:	53                   	push   %rbx
+  8039d9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8039dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8039e1:	48 b8 f3 3e 80 00 00 	movabs $0x803ef3,%rax
+  8039e8:	00 00 00 
+  8039eb:	ff d0                	call   *%rax
+  8039ed:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8039ef:	85 c0                	test   %eax,%eax
+  8039f1:	78 25                	js     803a18 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8039f3:	4c 89 e6             	mov    %r12,%rsi
+  8039f6:	89 c7                	mov    %eax,%edi
+  8039f8:	48 b8 3d 39 80 00 00 	movabs $0x80393d,%rax
+  8039ff:	00 00 00 
+  803a02:	ff d0                	call   *%rax
+  803a04:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803a07:	89 df                	mov    %ebx,%edi
+  803a09:	48 b8 dd 34 80 00 00 	movabs $0x8034dd,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+
+    return res;
+  803a15:	44 89 e3             	mov    %r12d,%ebx
+}
+  803a18:	89 d8                	mov    %ebx,%eax
+  803a1a:	5b                   	pop    %rbx
+  803a1b:	41 5c                	pop    %r12
+  803a1d:	5d                   	pop    %rbp
+  803a1e:	c3                   	ret
+
+0000000000803a1f <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a1f:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803a26:	00 00 00 
+  803a29:	83 38 00             	cmpl   $0x0,(%rax)
+  803a2c:	74 0a                	je     803a38 <fsipc_env+0x19>
+    return fsenv;
+}
+  803a2e:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a35:	00 00 
+  803a37:	c3                   	ret
+fsipc_env(void) {
+  803a38:	55                   	push   %rbp
+  803a39:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a3c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a41:	48 b8 db 5b 80 00 00 	movabs $0x805bdb,%rax
+  803a48:	00 00 00 
+  803a4b:	ff d0                	call   *%rax
+  803a4d:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803a54:	00 00 
+}
+  803a56:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a5d:	00 00 
+  803a5f:	5d                   	pop    %rbp
+  803a60:	c3                   	ret
+
+0000000000803a61 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803a61:	55                   	push   %rbp
+  803a62:	48 89 e5             	mov    %rsp,%rbp
+  803a65:	53                   	push   %rbx
+  803a66:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803a6a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a71:	00 
+  803a72:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803a79:	00 
+  803a7a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803a81:	00 
+  803a82:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803a89:	00 
+  803a8a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803a91:	00 
+
+    assert(size <= sizeof(words));
+  803a92:	48 83 fa 28          	cmp    $0x28,%rdx
+  803a96:	77 38                	ja     803ad0 <fsipc_short+0x6f>
+  803a98:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803a9a:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803a9e:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  803aa5:	00 00 00 
+  803aa8:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803aaa:	48 b8 1f 3a 80 00 00 	movabs $0x803a1f,%rax
+  803ab1:	00 00 00 
+  803ab4:	ff d0                	call   *%rax
+  803ab6:	89 c7                	mov    %eax,%edi
+  803ab8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803abc:	89 de                	mov    %ebx,%esi
+  803abe:	48 b8 3e 5b 80 00 00 	movabs $0x805b3e,%rax
+  803ac5:	00 00 00 
+  803ac8:	ff d0                	call   *%rax
+}
+  803aca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ace:	c9                   	leave
+  803acf:	c3                   	ret
+    assert(size <= sizeof(words));
+  803ad0:	48 b9 a0 68 80 00 00 	movabs $0x8068a0,%rcx
+  803ad7:	00 00 00 
+  803ada:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803ae1:	00 00 00 
+  803ae4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803ae9:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803af0:	00 00 00 
+  803af3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af8:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803aff:	00 00 00 
+  803b02:	41 ff d0             	call   *%r8
+
+0000000000803b05 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803b05:	55                   	push   %rbp
+  803b06:	48 89 e5             	mov    %rsp,%rbp
+  803b09:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803b0d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b10:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803b13:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b16:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b1b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b1f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b24:	48 b8 61 3a 80 00 00 	movabs $0x803a61,%rax
+  803b2b:	00 00 00 
+  803b2e:	ff d0                	call   *%rax
+}
+  803b30:	c9                   	leave
+  803b31:	c3                   	ret
+
+0000000000803b32 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803b32:	55                   	push   %rbp
+  803b33:	48 89 e5             	mov    %rsp,%rbp
+  803b36:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803b3a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b3d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803b40:	ba 04 00 00 00       	mov    $0x4,%edx
+  803b45:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803b49:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b4e:	48 b8 61 3a 80 00 00 	movabs $0x803a61,%rax
+  803b55:	00 00 00 
+  803b58:	ff d0                	call   *%rax
+}
+  803b5a:	c9                   	leave
+  803b5b:	c3                   	ret
+
+0000000000803b5c <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803b5c:	55                   	push   %rbp
+  803b5d:	48 89 e5             	mov    %rsp,%rbp
+  803b60:	41 54                	push   %r12
+  803b62:	53                   	push   %rbx
+  803b63:	48 83 ec 10          	sub    $0x10,%rsp
+  803b67:	89 fb                	mov    %edi,%ebx
+  803b69:	49 89 f4             	mov    %rsi,%r12
+  803b6c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b70:	48 b8 1f 3a 80 00 00 	movabs $0x803a1f,%rax
+  803b77:	00 00 00 
+  803b7a:	ff d0                	call   *%rax
+  803b7c:	89 c7                	mov    %eax,%edi
+  803b7e:	6a 00                	push   $0x0
+  803b80:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803b84:	50                   	push   %rax
+  803b85:	4d 89 e1             	mov    %r12,%r9
+  803b88:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803b8e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b93:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803b9a:	00 00 00 
+  803b9d:	89 de                	mov    %ebx,%esi
+  803b9f:	48 b8 d9 5a 80 00 00 	movabs $0x805ad9,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+}
+  803bab:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803baf:	5b                   	pop    %rbx
+  803bb0:	41 5c                	pop    %r12
+  803bb2:	5d                   	pop    %rbp
+  803bb3:	c3                   	ret
+
+0000000000803bb4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803bb4:	55                   	push   %rbp
+  803bb5:	48 89 e5             	mov    %rsp,%rbp
+  803bb8:	41 54                	push   %r12
+  803bba:	53                   	push   %rbx
+  803bbb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803bbe:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bc1:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803bc8:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bcf:	be 00 00 00 00       	mov    $0x0,%esi
+  803bd4:	bf 05 00 00 00       	mov    $0x5,%edi
+  803bd9:	48 b8 5c 3b 80 00 00 	movabs $0x803b5c,%rax
+  803be0:	00 00 00 
+  803be3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803be5:	85 c0                	test   %eax,%eax
+  803be7:	78 5a                	js     803c43 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803be9:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803bf0:	00 00 00 
+  803bf3:	4c 89 e6             	mov    %r12,%rsi
+  803bf6:	48 89 df             	mov    %rbx,%rdi
+  803bf9:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803c05:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803c0c:	00 
+  803c0d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c13:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803c1a:	00 
+  803c1b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803c21:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803c28:	00 
+  803c29:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803c30:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803c37:	00 
+  803c38:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c43:	5b                   	pop    %rbx
+  803c44:	41 5c                	pop    %r12
+  803c46:	5d                   	pop    %rbp
+  803c47:	c3                   	ret
+
+0000000000803c48 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c48:	55                   	push   %rbp
+  803c49:	48 89 e5             	mov    %rsp,%rbp
+  803c4c:	41 57                	push   %r15
+  803c4e:	41 56                	push   %r14
+  803c50:	41 55                	push   %r13
+  803c52:	41 54                	push   %r12
+  803c54:	53                   	push   %rbx
+  803c55:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803c59:	48 85 ff             	test   %rdi,%rdi
+  803c5c:	0f 84 a1 00 00 00    	je     803d03 <devfile_read+0xbb>
+  803c62:	49 89 ff             	mov    %rdi,%r15
+  803c65:	49 89 f5             	mov    %rsi,%r13
+  803c68:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803c6b:	48 85 f6             	test   %rsi,%rsi
+  803c6e:	0f 84 c4 00 00 00    	je     803d38 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803c74:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803c7b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803c7c:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c83:	00 00 00 
+  803c86:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c8a:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803c8d:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c96:	be 00 00 00 00       	mov    $0x0,%esi
+  803c9b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ca0:	48 b8 5c 3b 80 00 00 	movabs $0x803b5c,%rax
+  803ca7:	00 00 00 
+  803caa:	ff d0                	call   *%rax
+        if (res < 0) {
+  803cac:	85 c0                	test   %eax,%eax
+  803cae:	0f 88 b9 00 00 00    	js     803d6d <devfile_read+0x125>
+        assert(res <= n);
+  803cb4:	48 63 d8             	movslq %eax,%rbx
+  803cb7:	49 39 dc             	cmp    %rbx,%r12
+  803cba:	0f 82 b1 00 00 00    	jb     803d71 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803cc0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803cc5:	0f 87 db 00 00 00    	ja     803da6 <devfile_read+0x15e>
+        if (!res) {
+  803ccb:	85 c0                	test   %eax,%eax
+  803ccd:	74 21                	je     803cf0 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803ccf:	48 89 da             	mov    %rbx,%rdx
+  803cd2:	4c 89 f6             	mov    %r14,%rsi
+  803cd5:	4c 89 ef             	mov    %r13,%rdi
+  803cd8:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+        total_read += res;
+  803ce4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803ce8:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803ceb:	49 29 dc             	sub    %rbx,%r12
+  803cee:	75 96                	jne    803c86 <devfile_read+0x3e>
+    return total_read;
+  803cf0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803cf4:	48 83 c4 18          	add    $0x18,%rsp
+  803cf8:	5b                   	pop    %rbx
+  803cf9:	41 5c                	pop    %r12
+  803cfb:	41 5d                	pop    %r13
+  803cfd:	41 5e                	pop    %r14
+  803cff:	41 5f                	pop    %r15
+  803d01:	5d                   	pop    %rbp
+  803d02:	c3                   	ret
+    assert(fd);
+  803d03:	48 b9 d6 68 80 00 00 	movabs $0x8068d6,%rcx
+  803d0a:	00 00 00 
+  803d0d:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803d14:	00 00 00 
+  803d17:	be 91 00 00 00       	mov    $0x91,%esi
+  803d1c:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803d23:	00 00 00 
+  803d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d2b:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803d32:	00 00 00 
+  803d35:	41 ff d0             	call   *%r8
+    assert(buf);
+  803d38:	48 b9 d9 68 80 00 00 	movabs $0x8068d9,%rcx
+  803d3f:	00 00 00 
+  803d42:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803d49:	00 00 00 
+  803d4c:	be 92 00 00 00       	mov    $0x92,%esi
+  803d51:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803d58:	00 00 00 
+  803d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d60:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803d67:	00 00 00 
+  803d6a:	41 ff d0             	call   *%r8
+            return res;
+  803d6d:	48 98                	cltq
+  803d6f:	eb 83                	jmp    803cf4 <devfile_read+0xac>
+        assert(res <= n);
+  803d71:	48 b9 dd 68 80 00 00 	movabs $0x8068dd,%rcx
+  803d78:	00 00 00 
+  803d7b:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803d82:	00 00 00 
+  803d85:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803d8a:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803d91:	00 00 00 
+  803d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d99:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803da0:	00 00 00 
+  803da3:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803da6:	48 b9 e8 68 80 00 00 	movabs $0x8068e8,%rcx
+  803dad:	00 00 00 
+  803db0:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803db7:	00 00 00 
+  803dba:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803dbf:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803dc6:	00 00 00 
+  803dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dce:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803dd5:	00 00 00 
+  803dd8:	41 ff d0             	call   *%r8
+
+0000000000803ddb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803ddb:	55                   	push   %rbp
+  803ddc:	48 89 e5             	mov    %rsp,%rbp
+  803ddf:	41 57                	push   %r15
+  803de1:	41 56                	push   %r14
+  803de3:	41 55                	push   %r13
+  803de5:	41 54                	push   %r12
+  803de7:	53                   	push   %rbx
+  803de8:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803dec:	48 85 ff             	test   %rdi,%rdi
+  803def:	0f 84 83 00 00 00    	je     803e78 <devfile_write+0x9d>
+  803df5:	49 89 ff             	mov    %rdi,%r15
+  803df8:	49 89 f4             	mov    %rsi,%r12
+  803dfb:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803dfe:	48 85 f6             	test   %rsi,%rsi
+  803e01:	0f 84 a6 00 00 00    	je     803ead <devfile_write+0xd2>
+    size_t total_written = 0;
+  803e07:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803e0d:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803e14:	00 00 00 
+  803e17:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e1b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803e1e:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803e22:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803e27:	48 39 d3             	cmp    %rdx,%rbx
+  803e2a:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803e2e:	4c 89 e6             	mov    %r12,%rsi
+  803e31:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803e38:	00 00 00 
+  803e3b:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  803e42:	00 00 00 
+  803e45:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  803e51:	bf 04 00 00 00       	mov    $0x4,%edi
+  803e56:	48 b8 5c 3b 80 00 00 	movabs $0x803b5c,%rax
+  803e5d:	00 00 00 
+  803e60:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e62:	85 c0                	test   %eax,%eax
+  803e64:	78 7c                	js     803ee2 <devfile_write+0x107>
+        total_written += res;
+  803e66:	48 98                	cltq
+  803e68:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803e6b:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e6e:	48 29 c3             	sub    %rax,%rbx
+  803e71:	75 a4                	jne    803e17 <devfile_write+0x3c>
+    return total_written;
+  803e73:	4c 89 e8             	mov    %r13,%rax
+  803e76:	eb 6c                	jmp    803ee4 <devfile_write+0x109>
+    assert(fd);
+  803e78:	48 b9 d6 68 80 00 00 	movabs $0x8068d6,%rcx
+  803e7f:	00 00 00 
+  803e82:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803e89:	00 00 00 
+  803e8c:	be bd 00 00 00       	mov    $0xbd,%esi
+  803e91:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803e98:	00 00 00 
+  803e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea0:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803ea7:	00 00 00 
+  803eaa:	41 ff d0             	call   *%r8
+    assert(buf);
+  803ead:	48 b9 d9 68 80 00 00 	movabs $0x8068d9,%rcx
+  803eb4:	00 00 00 
+  803eb7:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803ebe:	00 00 00 
+  803ec1:	be be 00 00 00       	mov    $0xbe,%esi
+  803ec6:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803ecd:	00 00 00 
+  803ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed5:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  803edc:	00 00 00 
+  803edf:	41 ff d0             	call   *%r8
+            return res;
+  803ee2:	48 98                	cltq
+}
+  803ee4:	48 83 c4 08          	add    $0x8,%rsp
+  803ee8:	5b                   	pop    %rbx
+  803ee9:	41 5c                	pop    %r12
+  803eeb:	41 5d                	pop    %r13
+  803eed:	41 5e                	pop    %r14
+  803eef:	41 5f                	pop    %r15
+  803ef1:	5d                   	pop    %rbp
+  803ef2:	c3                   	ret
+
+0000000000803ef3 <open>:
+open(const char *path, int mode) {
+  803ef3:	55                   	push   %rbp
+  803ef4:	48 89 e5             	mov    %rsp,%rbp
+  803ef7:	41 55                	push   %r13
+  803ef9:	41 54                	push   %r12
+  803efb:	53                   	push   %rbx
+  803efc:	48 83 ec 18          	sub    $0x18,%rsp
+  803f00:	49 89 fc             	mov    %rdi,%r12
+  803f03:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f06:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  803f0d:	00 00 00 
+  803f10:	ff d0                	call   *%rax
+  803f12:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f18:	0f 87 8f 00 00 00    	ja     803fad <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f1e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f22:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  803f29:	00 00 00 
+  803f2c:	ff d0                	call   *%rax
+  803f2e:	89 c3                	mov    %eax,%ebx
+  803f30:	85 c0                	test   %eax,%eax
+  803f32:	78 55                	js     803f89 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f34:	4c 89 e6             	mov    %r12,%rsi
+  803f37:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803f3e:	00 00 00 
+  803f41:	48 89 df             	mov    %rbx,%rdi
+  803f44:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  803f4b:	00 00 00 
+  803f4e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f50:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f5c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f60:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f65:	48 b8 5c 3b 80 00 00 	movabs $0x803b5c,%rax
+  803f6c:	00 00 00 
+  803f6f:	ff d0                	call   *%rax
+  803f71:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f73:	85 c0                	test   %eax,%eax
+  803f75:	78 1f                	js     803f96 <open+0xa3>
+    return fd2num(fd);
+  803f77:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f7b:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  803f82:	00 00 00 
+  803f85:	ff d0                	call   *%rax
+  803f87:	89 c3                	mov    %eax,%ebx
+}
+  803f89:	89 d8                	mov    %ebx,%eax
+  803f8b:	48 83 c4 18          	add    $0x18,%rsp
+  803f8f:	5b                   	pop    %rbx
+  803f90:	41 5c                	pop    %r12
+  803f92:	41 5d                	pop    %r13
+  803f94:	5d                   	pop    %rbp
+  803f95:	c3                   	ret
+        fd_close(fd, 0);
+  803f96:	be 00 00 00 00       	mov    $0x0,%esi
+  803f9b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f9f:	48 b8 33 34 80 00 00 	movabs $0x803433,%rax
+  803fa6:	00 00 00 
+  803fa9:	ff d0                	call   *%rax
+        return res;
+  803fab:	eb dc                	jmp    803f89 <open+0x96>
+        return -E_BAD_PATH;
+  803fad:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803fb2:	eb d5                	jmp    803f89 <open+0x96>
+
+0000000000803fb4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803fb4:	55                   	push   %rbp
+  803fb5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  803fc2:	bf 08 00 00 00       	mov    $0x8,%edi
+  803fc7:	48 b8 61 3a 80 00 00 	movabs $0x803a61,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+}
+  803fd3:	5d                   	pop    %rbp
+  803fd4:	c3                   	ret
+
+0000000000803fd5 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803fd5:	55                   	push   %rbp
+  803fd6:	48 89 e5             	mov    %rsp,%rbp
+  803fd9:	41 56                	push   %r14
+  803fdb:	41 55                	push   %r13
+  803fdd:	41 54                	push   %r12
+  803fdf:	53                   	push   %rbx
+  803fe0:	48 83 ec 10          	sub    $0x10,%rsp
+  803fe4:	41 89 f6             	mov    %esi,%r14d
+  803fe7:	49 89 d4             	mov    %rdx,%r12
+  803fea:	48 89 cb             	mov    %rcx,%rbx
+  803fed:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ff0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ff4:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  803ffb:	00 00 00 
+  803ffe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804000:	85 c0                	test   %eax,%eax
+  804002:	78 46                	js     80404a <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804004:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804008:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80400f:	00 00 00 
+  804012:	8b 00                	mov    (%rax),%eax
+  804014:	39 02                	cmp    %eax,(%rdx)
+  804016:	75 3f                	jne    804057 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804018:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  80401f:	00 00 00 
+  804022:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804025:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804027:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80402b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  80402f:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804033:	48 89 da             	mov    %rbx,%rdx
+  804036:	4c 89 e6             	mov    %r12,%rsi
+  804039:	bf 09 00 00 00       	mov    $0x9,%edi
+  80403e:	48 b8 5c 3b 80 00 00 	movabs $0x803b5c,%rax
+  804045:	00 00 00 
+  804048:	ff d0                	call   *%rax
+}
+  80404a:	48 83 c4 10          	add    $0x10,%rsp
+  80404e:	5b                   	pop    %rbx
+  80404f:	41 5c                	pop    %r12
+  804051:	41 5d                	pop    %r13
+  804053:	41 5e                	pop    %r14
+  804055:	5d                   	pop    %rbp
+  804056:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804057:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80405c:	eb ec                	jmp    80404a <file_map+0x75>
+
+000000000080405e <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80405e:	55                   	push   %rbp
+  80405f:	48 89 e5             	mov    %rsp,%rbp
+  804062:	41 54                	push   %r12
+  804064:	53                   	push   %rbx
+  804065:	48 83 ec 20          	sub    $0x20,%rsp
+  804069:	41 89 f4             	mov    %esi,%r12d
+  80406c:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80406f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804073:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  80407a:	00 00 00 
+  80407d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80407f:	85 c0                	test   %eax,%eax
+  804081:	78 3c                	js     8040bf <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804083:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804087:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80408e:	00 00 00 
+  804091:	8b 0a                	mov    (%rdx),%ecx
+  804093:	39 08                	cmp    %ecx,(%rax)
+  804095:	75 31                	jne    8040c8 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804097:	8b 40 0c             	mov    0xc(%rax),%eax
+  80409a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80409d:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8040a1:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8040a5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040aa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040ae:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8040b3:	48 b8 61 3a 80 00 00 	movabs $0x803a61,%rax
+  8040ba:	00 00 00 
+  8040bd:	ff d0                	call   *%rax
+}
+  8040bf:	48 83 c4 20          	add    $0x20,%rsp
+  8040c3:	5b                   	pop    %rbx
+  8040c4:	41 5c                	pop    %r12
+  8040c6:	5d                   	pop    %rbp
+  8040c7:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040c8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8040cd:	eb f0                	jmp    8040bf <file_msync+0x61>
+
+00000000008040cf <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8040cf:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8040d3:	7f 01                	jg     8040d6 <writebuf+0x7>
+  8040d5:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8040d6:	55                   	push   %rbp
+  8040d7:	48 89 e5             	mov    %rsp,%rbp
+  8040da:	53                   	push   %rbx
+  8040db:	48 83 ec 08          	sub    $0x8,%rsp
+  8040df:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8040e2:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8040e6:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8040ea:	8b 3f                	mov    (%rdi),%edi
+  8040ec:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  8040f3:	00 00 00 
+  8040f6:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8040f8:	48 85 c0             	test   %rax,%rax
+  8040fb:	7e 04                	jle    804101 <writebuf+0x32>
+  8040fd:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804101:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804105:	48 39 c2             	cmp    %rax,%rdx
+  804108:	74 0f                	je     804119 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80410a:	48 85 c0             	test   %rax,%rax
+  80410d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804112:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804116:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804119:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80411d:	c9                   	leave
+  80411e:	c3                   	ret
+
+000000000080411f <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80411f:	8b 46 04             	mov    0x4(%rsi),%eax
+  804122:	8d 50 01             	lea    0x1(%rax),%edx
+  804125:	89 56 04             	mov    %edx,0x4(%rsi)
+  804128:	48 98                	cltq
+  80412a:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80412f:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804135:	74 01                	je     804138 <putch+0x19>
+  804137:	c3                   	ret
+putch(int ch, void *arg) {
+  804138:	55                   	push   %rbp
+  804139:	48 89 e5             	mov    %rsp,%rbp
+  80413c:	53                   	push   %rbx
+  80413d:	48 83 ec 08          	sub    $0x8,%rsp
+  804141:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804144:	48 89 f7             	mov    %rsi,%rdi
+  804147:	48 b8 cf 40 80 00 00 	movabs $0x8040cf,%rax
+  80414e:	00 00 00 
+  804151:	ff d0                	call   *%rax
+        state->offset = 0;
+  804153:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80415a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80415e:	c9                   	leave
+  80415f:	c3                   	ret
+
+0000000000804160 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804160:	55                   	push   %rbp
+  804161:	48 89 e5             	mov    %rsp,%rbp
+  804164:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80416b:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80416e:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804174:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80417b:	00 00 00 
+    state.result = 0;
+  80417e:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804185:	00 00 00 00 
+    state.error = 1;
+  804189:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804190:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804193:	48 89 f2             	mov    %rsi,%rdx
+  804196:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80419d:	48 bf 1f 41 80 00 00 	movabs $0x80411f,%rdi
+  8041a4:	00 00 00 
+  8041a7:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  8041ae:	00 00 00 
+  8041b1:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8041b3:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8041ba:	7f 14                	jg     8041d0 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8041bc:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8041c3:	48 85 c0             	test   %rax,%rax
+  8041c6:	75 06                	jne    8041ce <vfprintf+0x6e>
+  8041c8:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8041ce:	c9                   	leave
+  8041cf:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8041d0:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8041d7:	48 b8 cf 40 80 00 00 	movabs $0x8040cf,%rax
+  8041de:	00 00 00 
+  8041e1:	ff d0                	call   *%rax
+  8041e3:	eb d7                	jmp    8041bc <vfprintf+0x5c>
+
+00000000008041e5 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8041e5:	55                   	push   %rbp
+  8041e6:	48 89 e5             	mov    %rsp,%rbp
+  8041e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8041ed:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8041f1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8041f5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8041f9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8041fd:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804204:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804208:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80420c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804210:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804214:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804218:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80421f:	00 00 00 
+  804222:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804224:	c9                   	leave
+  804225:	c3                   	ret
+
+0000000000804226 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804226:	55                   	push   %rbp
+  804227:	48 89 e5             	mov    %rsp,%rbp
+  80422a:	48 83 ec 50          	sub    $0x50,%rsp
+  80422e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804232:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804236:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80423a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80423e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804242:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804249:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80424d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804251:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804255:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804259:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80425d:	48 89 fe             	mov    %rdi,%rsi
+  804260:	bf 01 00 00 00       	mov    $0x1,%edi
+  804265:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  80426c:	00 00 00 
+  80426f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804271:	c9                   	leave
+  804272:	c3                   	ret
+
+0000000000804273 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804273:	55                   	push   %rbp
+  804274:	48 89 e5             	mov    %rsp,%rbp
+  804277:	41 54                	push   %r12
+  804279:	53                   	push   %rbx
+  80427a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80427d:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  804284:	00 00 00 
+  804287:	ff d0                	call   *%rax
+  804289:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80428c:	48 be 10 69 80 00 00 	movabs $0x806910,%rsi
+  804293:	00 00 00 
+  804296:	48 89 df             	mov    %rbx,%rdi
+  804299:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  8042a0:	00 00 00 
+  8042a3:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8042a5:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8042aa:	41 2b 04 24          	sub    (%r12),%eax
+  8042ae:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8042b4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8042bb:	00 00 00 
+    stat->st_dev = &devpipe;
+  8042be:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8042c5:	00 00 00 
+  8042c8:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8042cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d4:	5b                   	pop    %rbx
+  8042d5:	41 5c                	pop    %r12
+  8042d7:	5d                   	pop    %rbp
+  8042d8:	c3                   	ret
+
+00000000008042d9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8042d9:	55                   	push   %rbp
+  8042da:	48 89 e5             	mov    %rsp,%rbp
+  8042dd:	41 54                	push   %r12
+  8042df:	53                   	push   %rbx
+  8042e0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8042e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042e8:	48 89 fe             	mov    %rdi,%rsi
+  8042eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042f0:	49 bc b2 2b 80 00 00 	movabs $0x802bb2,%r12
+  8042f7:	00 00 00 
+  8042fa:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8042fd:	48 89 df             	mov    %rbx,%rdi
+  804300:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  804307:	00 00 00 
+  80430a:	ff d0                	call   *%rax
+  80430c:	48 89 c6             	mov    %rax,%rsi
+  80430f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804314:	bf 00 00 00 00       	mov    $0x0,%edi
+  804319:	41 ff d4             	call   *%r12
+}
+  80431c:	5b                   	pop    %rbx
+  80431d:	41 5c                	pop    %r12
+  80431f:	5d                   	pop    %rbp
+  804320:	c3                   	ret
+
+0000000000804321 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804321:	55                   	push   %rbp
+  804322:	48 89 e5             	mov    %rsp,%rbp
+  804325:	41 57                	push   %r15
+  804327:	41 56                	push   %r14
+  804329:	41 55                	push   %r13
+  80432b:	41 54                	push   %r12
+  80432d:	53                   	push   %rbx
+  80432e:	48 83 ec 18          	sub    $0x18,%rsp
+  804332:	49 89 fc             	mov    %rdi,%r12
+  804335:	49 89 f5             	mov    %rsi,%r13
+  804338:	49 89 d7             	mov    %rdx,%r15
+  80433b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80433f:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  804346:	00 00 00 
+  804349:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80434b:	4d 85 ff             	test   %r15,%r15
+  80434e:	0f 84 af 00 00 00    	je     804403 <devpipe_write+0xe2>
+  804354:	48 89 c3             	mov    %rax,%rbx
+  804357:	4c 89 f8             	mov    %r15,%rax
+  80435a:	4d 89 ef             	mov    %r13,%r15
+  80435d:	4c 01 e8             	add    %r13,%rax
+  804360:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804364:	49 bd a8 2a 80 00 00 	movabs $0x802aa8,%r13
+  80436b:	00 00 00 
+            sys_yield();
+  80436e:	49 be 39 2a 80 00 00 	movabs $0x802a39,%r14
+  804375:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804378:	8b 73 04             	mov    0x4(%rbx),%esi
+  80437b:	48 63 ce             	movslq %esi,%rcx
+  80437e:	48 63 03             	movslq (%rbx),%rax
+  804381:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804387:	48 39 c1             	cmp    %rax,%rcx
+  80438a:	72 2e                	jb     8043ba <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80438c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804391:	48 89 da             	mov    %rbx,%rdx
+  804394:	be 00 10 00 00       	mov    $0x1000,%esi
+  804399:	4c 89 e7             	mov    %r12,%rdi
+  80439c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80439f:	85 c0                	test   %eax,%eax
+  8043a1:	74 66                	je     804409 <devpipe_write+0xe8>
+            sys_yield();
+  8043a3:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043a6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043a9:	48 63 ce             	movslq %esi,%rcx
+  8043ac:	48 63 03             	movslq (%rbx),%rax
+  8043af:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043b5:	48 39 c1             	cmp    %rax,%rcx
+  8043b8:	73 d2                	jae    80438c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8043ba:	41 0f b6 3f          	movzbl (%r15),%edi
+  8043be:	48 89 ca             	mov    %rcx,%rdx
+  8043c1:	48 c1 ea 03          	shr    $0x3,%rdx
+  8043c5:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8043cc:	08 10 20 
+  8043cf:	48 f7 e2             	mul    %rdx
+  8043d2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8043d6:	48 89 d0             	mov    %rdx,%rax
+  8043d9:	48 c1 e0 09          	shl    $0x9,%rax
+  8043dd:	48 29 d0             	sub    %rdx,%rax
+  8043e0:	48 c1 e0 03          	shl    $0x3,%rax
+  8043e4:	48 29 c1             	sub    %rax,%rcx
+  8043e7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8043ec:	83 c6 01             	add    $0x1,%esi
+  8043ef:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8043f2:	49 83 c7 01          	add    $0x1,%r15
+  8043f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043fa:	49 39 c7             	cmp    %rax,%r15
+  8043fd:	0f 85 75 ff ff ff    	jne    804378 <devpipe_write+0x57>
+    return n;
+  804403:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804407:	eb 05                	jmp    80440e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804409:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80440e:	48 83 c4 18          	add    $0x18,%rsp
+  804412:	5b                   	pop    %rbx
+  804413:	41 5c                	pop    %r12
+  804415:	41 5d                	pop    %r13
+  804417:	41 5e                	pop    %r14
+  804419:	41 5f                	pop    %r15
+  80441b:	5d                   	pop    %rbp
+  80441c:	c3                   	ret
+
+000000000080441d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80441d:	55                   	push   %rbp
+  80441e:	48 89 e5             	mov    %rsp,%rbp
+  804421:	41 57                	push   %r15
+  804423:	41 56                	push   %r14
+  804425:	41 55                	push   %r13
+  804427:	41 54                	push   %r12
+  804429:	53                   	push   %rbx
+  80442a:	48 83 ec 18          	sub    $0x18,%rsp
+  80442e:	49 89 fc             	mov    %rdi,%r12
+  804431:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804435:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804439:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  804440:	00 00 00 
+  804443:	ff d0                	call   *%rax
+  804445:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804448:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80444e:	49 bd a8 2a 80 00 00 	movabs $0x802aa8,%r13
+  804455:	00 00 00 
+            sys_yield();
+  804458:	49 be 39 2a 80 00 00 	movabs $0x802a39,%r14
+  80445f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804462:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804467:	74 7d                	je     8044e6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804469:	8b 03                	mov    (%rbx),%eax
+  80446b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80446e:	75 26                	jne    804496 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804470:	4d 85 ff             	test   %r15,%r15
+  804473:	75 77                	jne    8044ec <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804475:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80447a:	48 89 da             	mov    %rbx,%rdx
+  80447d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804482:	4c 89 e7             	mov    %r12,%rdi
+  804485:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804488:	85 c0                	test   %eax,%eax
+  80448a:	74 72                	je     8044fe <devpipe_read+0xe1>
+            sys_yield();
+  80448c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80448f:	8b 03                	mov    (%rbx),%eax
+  804491:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804494:	74 df                	je     804475 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804496:	48 63 c8             	movslq %eax,%rcx
+  804499:	48 89 ca             	mov    %rcx,%rdx
+  80449c:	48 c1 ea 03          	shr    $0x3,%rdx
+  8044a0:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8044a7:	08 10 20 
+  8044aa:	48 89 d0             	mov    %rdx,%rax
+  8044ad:	48 f7 e6             	mul    %rsi
+  8044b0:	48 c1 ea 06          	shr    $0x6,%rdx
+  8044b4:	48 89 d0             	mov    %rdx,%rax
+  8044b7:	48 c1 e0 09          	shl    $0x9,%rax
+  8044bb:	48 29 d0             	sub    %rdx,%rax
+  8044be:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8044c5:	00 
+  8044c6:	48 89 c8             	mov    %rcx,%rax
+  8044c9:	48 29 d0             	sub    %rdx,%rax
+  8044cc:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8044d1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8044d5:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8044d9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8044dc:	49 83 c7 01          	add    $0x1,%r15
+  8044e0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8044e4:	75 83                	jne    804469 <devpipe_read+0x4c>
+    return n;
+  8044e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044ea:	eb 03                	jmp    8044ef <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8044ec:	4c 89 f8             	mov    %r15,%rax
+}
+  8044ef:	48 83 c4 18          	add    $0x18,%rsp
+  8044f3:	5b                   	pop    %rbx
+  8044f4:	41 5c                	pop    %r12
+  8044f6:	41 5d                	pop    %r13
+  8044f8:	41 5e                	pop    %r14
+  8044fa:	41 5f                	pop    %r15
+  8044fc:	5d                   	pop    %rbp
+  8044fd:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8044fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804503:	eb ea                	jmp    8044ef <devpipe_read+0xd2>
+
+0000000000804505 <pipe>:
+pipe(int pfd[2]) {
+  804505:	55                   	push   %rbp
+  804506:	48 89 e5             	mov    %rsp,%rbp
+  804509:	41 55                	push   %r13
+  80450b:	41 54                	push   %r12
+  80450d:	53                   	push   %rbx
+  80450e:	48 83 ec 18          	sub    $0x18,%rsp
+  804512:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804515:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804519:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  804520:	00 00 00 
+  804523:	ff d0                	call   *%rax
+  804525:	89 c3                	mov    %eax,%ebx
+  804527:	85 c0                	test   %eax,%eax
+  804529:	0f 88 a0 01 00 00    	js     8046cf <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80452f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804534:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804539:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80453d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804542:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  804549:	00 00 00 
+  80454c:	ff d0                	call   *%rax
+  80454e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804550:	85 c0                	test   %eax,%eax
+  804552:	0f 88 77 01 00 00    	js     8046cf <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804558:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80455c:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  804563:	00 00 00 
+  804566:	ff d0                	call   *%rax
+  804568:	89 c3                	mov    %eax,%ebx
+  80456a:	85 c0                	test   %eax,%eax
+  80456c:	0f 88 43 01 00 00    	js     8046b5 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804572:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804577:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80457c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804580:	bf 00 00 00 00       	mov    $0x0,%edi
+  804585:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  80458c:	00 00 00 
+  80458f:	ff d0                	call   *%rax
+  804591:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804593:	85 c0                	test   %eax,%eax
+  804595:	0f 88 1a 01 00 00    	js     8046b5 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80459b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80459f:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  8045a6:	00 00 00 
+  8045a9:	ff d0                	call   *%rax
+  8045ab:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8045ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045b8:	48 89 c6             	mov    %rax,%rsi
+  8045bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045c0:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  8045c7:	00 00 00 
+  8045ca:	ff d0                	call   *%rax
+  8045cc:	89 c3                	mov    %eax,%ebx
+  8045ce:	85 c0                	test   %eax,%eax
+  8045d0:	0f 88 c5 00 00 00    	js     80469b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8045d6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8045da:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  8045e1:	00 00 00 
+  8045e4:	ff d0                	call   *%rax
+  8045e6:	48 89 c1             	mov    %rax,%rcx
+  8045e9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8045ef:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8045f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045fa:	4c 89 ee             	mov    %r13,%rsi
+  8045fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804602:	48 b8 47 2b 80 00 00 	movabs $0x802b47,%rax
+  804609:	00 00 00 
+  80460c:	ff d0                	call   *%rax
+  80460e:	89 c3                	mov    %eax,%ebx
+  804610:	85 c0                	test   %eax,%eax
+  804612:	78 6e                	js     804682 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804614:	be 00 10 00 00       	mov    $0x1000,%esi
+  804619:	4c 89 ef             	mov    %r13,%rdi
+  80461c:	48 b8 70 2a 80 00 00 	movabs $0x802a70,%rax
+  804623:	00 00 00 
+  804626:	ff d0                	call   *%rax
+  804628:	83 f8 02             	cmp    $0x2,%eax
+  80462b:	0f 85 ab 00 00 00    	jne    8046dc <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804631:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804638:	00 00 
+  80463a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80463e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804640:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804644:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80464b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80464f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804651:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804655:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80465c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804660:	48 bb ea 32 80 00 00 	movabs $0x8032ea,%rbx
+  804667:	00 00 00 
+  80466a:	ff d3                	call   *%rbx
+  80466c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804670:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804674:	ff d3                	call   *%rbx
+  804676:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80467b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804680:	eb 4d                	jmp    8046cf <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804682:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804687:	4c 89 ee             	mov    %r13,%rsi
+  80468a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80468f:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  804696:	00 00 00 
+  804699:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80469b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046a0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8046a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046a9:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  8046b0:	00 00 00 
+  8046b3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8046b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046ba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8046be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c3:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  8046ca:	00 00 00 
+  8046cd:	ff d0                	call   *%rax
+}
+  8046cf:	89 d8                	mov    %ebx,%eax
+  8046d1:	48 83 c4 18          	add    $0x18,%rsp
+  8046d5:	5b                   	pop    %rbx
+  8046d6:	41 5c                	pop    %r12
+  8046d8:	41 5d                	pop    %r13
+  8046da:	5d                   	pop    %rbp
+  8046db:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046dc:	48 b9 28 69 80 00 00 	movabs $0x806928,%rcx
+  8046e3:	00 00 00 
+  8046e6:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  8046ed:	00 00 00 
+  8046f0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8046f5:	48 bf 17 69 80 00 00 	movabs $0x806917,%rdi
+  8046fc:	00 00 00 
+  8046ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804704:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  80470b:	00 00 00 
+  80470e:	41 ff d0             	call   *%r8
+
+0000000000804711 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804711:	55                   	push   %rbp
+  804712:	48 89 e5             	mov    %rsp,%rbp
+  804715:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804719:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80471d:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  804724:	00 00 00 
+  804727:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804729:	85 c0                	test   %eax,%eax
+  80472b:	78 35                	js     804762 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80472d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804731:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  804738:	00 00 00 
+  80473b:	ff d0                	call   *%rax
+  80473d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804740:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804745:	be 00 10 00 00       	mov    $0x1000,%esi
+  80474a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80474e:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  804755:	00 00 00 
+  804758:	ff d0                	call   *%rax
+  80475a:	85 c0                	test   %eax,%eax
+  80475c:	0f 94 c0             	sete   %al
+  80475f:	0f b6 c0             	movzbl %al,%eax
+}
+  804762:	c9                   	leave
+  804763:	c3                   	ret
+
+0000000000804764 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804764:	55                   	push   %rbp
+  804765:	48 89 e5             	mov    %rsp,%rbp
+  804768:	41 55                	push   %r13
+  80476a:	41 54                	push   %r12
+  80476c:	53                   	push   %rbx
+  80476d:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  804771:	85 ff                	test   %edi,%edi
+  804773:	74 73                	je     8047e8 <wait+0x84>
+  804775:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804778:	89 f8                	mov    %edi,%eax
+  80477a:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80477f:	89 f9                	mov    %edi,%ecx
+  804781:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804787:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  80478e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804795:	00 00 00 
+  804798:	48 01 ca             	add    %rcx,%rdx
+  80479b:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8047a1:	39 d7                	cmp    %edx,%edi
+  8047a3:	75 38                	jne    8047dd <wait+0x79>
+           env->env_status != ENV_FREE) {
+  8047a5:	48 98                	cltq
+  8047a7:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8047ae:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8047b5:	00 00 00 
+  8047b8:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  8047bb:	49 bd 39 2a 80 00 00 	movabs $0x802a39,%r13
+  8047c2:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8047c5:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  8047cb:	85 c0                	test   %eax,%eax
+  8047cd:	74 0e                	je     8047dd <wait+0x79>
+        sys_yield();
+  8047cf:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8047d2:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8047d8:	44 39 e0             	cmp    %r12d,%eax
+  8047db:	74 e8                	je     8047c5 <wait+0x61>
+    }
+}
+  8047dd:	48 83 c4 08          	add    $0x8,%rsp
+  8047e1:	5b                   	pop    %rbx
+  8047e2:	41 5c                	pop    %r12
+  8047e4:	41 5d                	pop    %r13
+  8047e6:	5d                   	pop    %rbp
+  8047e7:	c3                   	ret
+    assert(envid != 0);
+  8047e8:	48 b9 4c 69 80 00 00 	movabs $0x80694c,%rcx
+  8047ef:	00 00 00 
+  8047f2:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  8047f9:	00 00 00 
+  8047fc:	be 06 00 00 00       	mov    $0x6,%esi
+  804801:	48 bf 57 69 80 00 00 	movabs $0x806957,%rdi
+  804808:	00 00 00 
+  80480b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804810:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  804817:	00 00 00 
+  80481a:	41 ff d0             	call   *%r8
+
+000000000080481d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80481d:	48 89 f8             	mov    %rdi,%rax
+  804820:	48 c1 e8 27          	shr    $0x27,%rax
+  804824:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80482b:	01 00 00 
+  80482e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804832:	f6 c2 01             	test   $0x1,%dl
+  804835:	74 6d                	je     8048a4 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804837:	48 89 f8             	mov    %rdi,%rax
+  80483a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80483e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804845:	01 00 00 
+  804848:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80484c:	f6 c2 01             	test   $0x1,%dl
+  80484f:	74 62                	je     8048b3 <get_uvpt_entry+0x96>
+  804851:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804858:	01 00 00 
+  80485b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80485f:	f6 c2 80             	test   $0x80,%dl
+  804862:	75 4f                	jne    8048b3 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804864:	48 89 f8             	mov    %rdi,%rax
+  804867:	48 c1 e8 15          	shr    $0x15,%rax
+  80486b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804872:	01 00 00 
+  804875:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804879:	f6 c2 01             	test   $0x1,%dl
+  80487c:	74 44                	je     8048c2 <get_uvpt_entry+0xa5>
+  80487e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804885:	01 00 00 
+  804888:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80488c:	f6 c2 80             	test   $0x80,%dl
+  80488f:	75 31                	jne    8048c2 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804891:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804895:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80489c:	01 00 00 
+  80489f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8048a3:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8048a4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8048ab:	01 00 00 
+  8048ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048b2:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8048b3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8048ba:	01 00 00 
+  8048bd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048c1:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8048c2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048c9:	01 00 00 
+  8048cc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048d0:	c3                   	ret
+
+00000000008048d1 <get_prot>:
+
+int
+get_prot(void *va) {
+  8048d1:	55                   	push   %rbp
+  8048d2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8048d5:	48 b8 1d 48 80 00 00 	movabs $0x80481d,%rax
+  8048dc:	00 00 00 
+  8048df:	ff d0                	call   *%rax
+  8048e1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8048e4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8048e9:	89 c1                	mov    %eax,%ecx
+  8048eb:	83 c9 04             	or     $0x4,%ecx
+  8048ee:	f6 c2 01             	test   $0x1,%dl
+  8048f1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8048f4:	89 c1                	mov    %eax,%ecx
+  8048f6:	83 c9 02             	or     $0x2,%ecx
+  8048f9:	f6 c2 02             	test   $0x2,%dl
+  8048fc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8048ff:	89 c1                	mov    %eax,%ecx
+  804901:	83 c9 01             	or     $0x1,%ecx
+  804904:	48 85 d2             	test   %rdx,%rdx
+  804907:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80490a:	89 c1                	mov    %eax,%ecx
+  80490c:	83 c9 40             	or     $0x40,%ecx
+  80490f:	f6 c6 04             	test   $0x4,%dh
+  804912:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804915:	5d                   	pop    %rbp
+  804916:	c3                   	ret
+
+0000000000804917 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804917:	55                   	push   %rbp
+  804918:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80491b:	48 b8 1d 48 80 00 00 	movabs $0x80481d,%rax
+  804922:	00 00 00 
+  804925:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804927:	48 c1 e8 06          	shr    $0x6,%rax
+  80492b:	83 e0 01             	and    $0x1,%eax
+}
+  80492e:	5d                   	pop    %rbp
+  80492f:	c3                   	ret
+
+0000000000804930 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804930:	55                   	push   %rbp
+  804931:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804934:	48 b8 1d 48 80 00 00 	movabs $0x80481d,%rax
+  80493b:	00 00 00 
+  80493e:	ff d0                	call   *%rax
+  804940:	83 e0 01             	and    $0x1,%eax
+}
+  804943:	5d                   	pop    %rbp
+  804944:	c3                   	ret
+
+0000000000804945 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804945:	55                   	push   %rbp
+  804946:	48 89 e5             	mov    %rsp,%rbp
+  804949:	41 57                	push   %r15
+  80494b:	41 56                	push   %r14
+  80494d:	41 55                	push   %r13
+  80494f:	41 54                	push   %r12
+  804951:	53                   	push   %rbx
+  804952:	48 83 ec 28          	sub    $0x28,%rsp
+  804956:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80495a:	48 85 ff             	test   %rdi,%rdi
+  80495d:	74 1e                	je     80497d <foreach_shared_region+0x38>
+  80495f:	49 89 ff             	mov    %rdi,%r15
+  804962:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804968:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80496e:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804975:	01 00 00 
+  804978:	e9 72 02 00 00       	jmp    804bef <foreach_shared_region+0x2aa>
+    assert(fun);
+  80497d:	48 b9 62 69 80 00 00 	movabs $0x806962,%rcx
+  804984:	00 00 00 
+  804987:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  80498e:	00 00 00 
+  804991:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804996:	48 bf 66 69 80 00 00 	movabs $0x806966,%rdi
+  80499d:	00 00 00 
+  8049a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049a5:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  8049ac:	00 00 00 
+  8049af:	41 ff d0             	call   *%r8
+  8049b2:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8049b9:	eb 6c                	jmp    804a27 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8049bb:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049c2:	ff ff ff 
+  8049c5:	4c 21 e2             	and    %r12,%rdx
+  8049c8:	48 89 d8             	mov    %rbx,%rax
+  8049cb:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8049d0:	48 83 c0 01          	add    $0x1,%rax
+  8049d4:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8049d8:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8049df:	00 00 00 
+  8049e2:	48 21 c8             	and    %rcx,%rax
+  8049e5:	48 09 d0             	or     %rdx,%rax
+  8049e8:	49 89 c4             	mov    %rax,%r12
+  8049eb:	eb 30                	jmp    804a1d <foreach_shared_region+0xd8>
+  8049ed:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049f4:	ff ff ff 
+  8049f7:	4c 21 e2             	and    %r12,%rdx
+  8049fa:	48 89 d8             	mov    %rbx,%rax
+  8049fd:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a02:	48 83 c0 01          	add    $0x1,%rax
+  804a06:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804a0a:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804a11:	00 00 00 
+  804a14:	48 21 c8             	and    %rcx,%rax
+  804a17:	48 09 d0             	or     %rdx,%rax
+  804a1a:	49 89 c4             	mov    %rax,%r12
+  804a1d:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804a21:	0f 84 99 01 00 00    	je     804bc0 <foreach_shared_region+0x27b>
+  804a27:	4c 89 e3             	mov    %r12,%rbx
+  804a2a:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804a2e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804a35:	01 00 00 
+  804a38:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a3c:	a8 01                	test   $0x1,%al
+  804a3e:	0f 84 77 ff ff ff    	je     8049bb <foreach_shared_region+0x76>
+  804a44:	a8 80                	test   $0x80,%al
+  804a46:	74 19                	je     804a61 <foreach_shared_region+0x11c>
+  804a48:	f6 c4 04             	test   $0x4,%ah
+  804a4b:	74 a0                	je     8049ed <foreach_shared_region+0xa8>
+  804a4d:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804a54:	40 
+  804a55:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a59:	4c 89 e7             	mov    %r12,%rdi
+  804a5c:	41 ff d7             	call   *%r15
+  804a5f:	eb 8c                	jmp    8049ed <foreach_shared_region+0xa8>
+  804a61:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804a68:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804a6c:	eb 46                	jmp    804ab4 <foreach_shared_region+0x16f>
+  804a6e:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a75:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a7b:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a7f:	48 c1 e0 15          	shl    $0x15,%rax
+  804a83:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a88:	49 09 c4             	or     %rax,%r12
+  804a8b:	eb 1d                	jmp    804aaa <foreach_shared_region+0x165>
+  804a8d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a94:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a9a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a9e:	48 c1 e0 15          	shl    $0x15,%rax
+  804aa2:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804aa7:	49 09 c4             	or     %rax,%r12
+  804aaa:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804aae:	0f 84 d3 00 00 00    	je     804b87 <foreach_shared_region+0x242>
+  804ab4:	4c 89 e3             	mov    %r12,%rbx
+  804ab7:	48 c1 eb 15          	shr    $0x15,%rbx
+  804abb:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804ac2:	01 00 00 
+  804ac5:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804ac9:	a8 01                	test   $0x1,%al
+  804acb:	74 a1                	je     804a6e <foreach_shared_region+0x129>
+  804acd:	a8 80                	test   $0x80,%al
+  804acf:	74 19                	je     804aea <foreach_shared_region+0x1a5>
+  804ad1:	f6 c4 04             	test   $0x4,%ah
+  804ad4:	74 b7                	je     804a8d <foreach_shared_region+0x148>
+  804ad6:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804add:	00 
+  804ade:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ae2:	4c 89 e7             	mov    %r12,%rdi
+  804ae5:	41 ff d7             	call   *%r15
+  804ae8:	eb a3                	jmp    804a8d <foreach_shared_region+0x148>
+  804aea:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804af0:	eb 3b                	jmp    804b2d <foreach_shared_region+0x1e8>
+  804af2:	f6 c4 04             	test   $0x4,%ah
+  804af5:	74 12                	je     804b09 <foreach_shared_region+0x1c4>
+  804af7:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804afe:	00 
+  804aff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b03:	4c 89 e7             	mov    %r12,%rdi
+  804b06:	41 ff d7             	call   *%r15
+  804b09:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b10:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b16:	48 83 c3 01          	add    $0x1,%rbx
+  804b1a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b1e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b24:	49 09 dc             	or     %rbx,%r12
+  804b27:	41 83 ed 01          	sub    $0x1,%r13d
+  804b2b:	74 2f                	je     804b5c <foreach_shared_region+0x217>
+  804b2d:	4c 89 e3             	mov    %r12,%rbx
+  804b30:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804b34:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804b38:	a8 01                	test   $0x1,%al
+  804b3a:	75 b6                	jne    804af2 <foreach_shared_region+0x1ad>
+  804b3c:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b43:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b49:	48 83 c3 01          	add    $0x1,%rbx
+  804b4d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b51:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b57:	49 09 dc             	or     %rbx,%r12
+  804b5a:	eb cb                	jmp    804b27 <foreach_shared_region+0x1e2>
+  804b5c:	4c 89 e0             	mov    %r12,%rax
+  804b5f:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804b65:	49 c1 ec 15          	shr    $0x15,%r12
+  804b69:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b70:	49 83 c4 01          	add    $0x1,%r12
+  804b74:	49 c1 e4 15          	shl    $0x15,%r12
+  804b78:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804b7f:	49 09 c4             	or     %rax,%r12
+  804b82:	e9 23 ff ff ff       	jmp    804aaa <foreach_shared_region+0x165>
+  804b87:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804b8b:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804b92:	ff ff ff 
+  804b95:	4c 21 e0             	and    %r12,%rax
+  804b98:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804b9c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804ba3:	49 83 c4 01          	add    $0x1,%r12
+  804ba7:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804bab:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804bb2:	00 00 00 
+  804bb5:	49 21 d4             	and    %rdx,%r12
+  804bb8:	49 09 c4             	or     %rax,%r12
+  804bbb:	e9 5d fe ff ff       	jmp    804a1d <foreach_shared_region+0xd8>
+  804bc0:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804bc7:	00 ff ff 
+  804bca:	4c 21 e0             	and    %r12,%rax
+  804bcd:	49 c1 ec 27          	shr    $0x27,%r12
+  804bd1:	49 83 c4 01          	add    $0x1,%r12
+  804bd5:	49 c1 e4 27          	shl    $0x27,%r12
+  804bd9:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804be0:	ff 00 00 
+  804be3:	49 21 d4             	and    %rdx,%r12
+  804be6:	49 09 c4             	or     %rax,%r12
+  804be9:	41 83 ed 01          	sub    $0x1,%r13d
+  804bed:	74 48                	je     804c37 <foreach_shared_region+0x2f2>
+  804bef:	4c 89 e0             	mov    %r12,%rax
+  804bf2:	48 c1 e8 27          	shr    $0x27,%rax
+  804bf6:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804bfd:	01 00 00 
+  804c00:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804c04:	f6 c2 01             	test   $0x1,%dl
+  804c07:	0f 85 a5 fd ff ff    	jne    8049b2 <foreach_shared_region+0x6d>
+  804c0d:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804c14:	00 ff ff 
+  804c17:	4c 21 e2             	and    %r12,%rdx
+  804c1a:	48 83 c0 01          	add    $0x1,%rax
+  804c1e:	48 c1 e0 27          	shl    $0x27,%rax
+  804c22:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804c29:	ff 00 00 
+  804c2c:	48 21 c8             	and    %rcx,%rax
+  804c2f:	48 09 d0             	or     %rdx,%rax
+  804c32:	49 89 c4             	mov    %rax,%r12
+  804c35:	eb b2                	jmp    804be9 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804c37:	4d 85 e4             	test   %r12,%r12
+  804c3a:	75 14                	jne    804c50 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c41:	48 83 c4 28          	add    $0x28,%rsp
+  804c45:	5b                   	pop    %rbx
+  804c46:	41 5c                	pop    %r12
+  804c48:	41 5d                	pop    %r13
+  804c4a:	41 5e                	pop    %r14
+  804c4c:	41 5f                	pop    %r15
+  804c4e:	5d                   	pop    %rbp
+  804c4f:	c3                   	ret
+    assert(addr == 0);
+  804c50:	48 b9 71 69 80 00 00 	movabs $0x806971,%rcx
+  804c57:	00 00 00 
+  804c5a:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  804c61:	00 00 00 
+  804c64:	be 67 00 00 00       	mov    $0x67,%esi
+  804c69:	48 bf 66 69 80 00 00 	movabs $0x806966,%rdi
+  804c70:	00 00 00 
+  804c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c78:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  804c7f:	00 00 00 
+  804c82:	41 ff d0             	call   *%r8
+
+0000000000804c85 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804c85:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804c8c:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804c8f:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804c95:	eb 33                	jmp    804cca <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c97:	48 83 c0 20          	add    $0x20,%rax
+  804c9b:	4c 39 c0             	cmp    %r8,%rax
+  804c9e:	74 25                	je     804cc5 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804ca0:	48 8b 10             	mov    (%rax),%rdx
+  804ca3:	48 85 d2             	test   %rdx,%rdx
+  804ca6:	74 ef                	je     804c97 <mmap_place+0x12>
+  804ca8:	48 89 d1             	mov    %rdx,%rcx
+  804cab:	48 03 48 08          	add    0x8(%rax),%rcx
+  804caf:	48 39 cf             	cmp    %rcx,%rdi
+  804cb2:	73 e3                	jae    804c97 <mmap_place+0x12>
+  804cb4:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804cb8:	4c 39 ca             	cmp    %r9,%rdx
+  804cbb:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804cbf:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804cc3:	eb d2                	jmp    804c97 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804cc5:	45 84 d2             	test   %r10b,%r10b
+  804cc8:	74 12                	je     804cdc <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cca:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cd1:	00 00 00 
+        moved = 0;
+  804cd4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804cda:	eb c4                	jmp    804ca0 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804cdc:	48 01 fe             	add    %rdi,%rsi
+  804cdf:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804ce6:	00 00 00 
+  804ce9:	48 39 f0             	cmp    %rsi,%rax
+  804cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf1:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804cf5:	c3                   	ret
+
+0000000000804cf6 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804cf6:	55                   	push   %rbp
+  804cf7:	48 89 e5             	mov    %rsp,%rbp
+  804cfa:	41 57                	push   %r15
+  804cfc:	41 56                	push   %r14
+  804cfe:	41 55                	push   %r13
+  804d00:	41 54                	push   %r12
+  804d02:	53                   	push   %rbx
+  804d03:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804d07:	48 8b 1f             	mov    (%rdi),%rbx
+  804d0a:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d11:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d18:	00 00 00 
+  804d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d20:	eb 12                	jmp    804d34 <mmap_pgfault+0x3e>
+  804d22:	48 83 c2 01          	add    $0x1,%rdx
+  804d26:	48 83 c0 20          	add    $0x20,%rax
+  804d2a:	48 83 fa 20          	cmp    $0x20,%rdx
+  804d2e:	0f 84 04 01 00 00    	je     804e38 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804d34:	48 8b 08             	mov    (%rax),%rcx
+  804d37:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804d3b:	48 39 de             	cmp    %rbx,%rsi
+  804d3e:	73 e2                	jae    804d22 <mmap_pgfault+0x2c>
+  804d40:	48 03 48 08          	add    0x8(%rax),%rcx
+  804d44:	48 39 cb             	cmp    %rcx,%rbx
+  804d47:	73 d9                	jae    804d22 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804d49:	48 c1 e2 05          	shl    $0x5,%rdx
+  804d4d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d54:	00 00 00 
+  804d57:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804d5b:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804d5f:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804d63:	f6 c2 01             	test   $0x1,%dl
+  804d66:	0f 84 e0 00 00 00    	je     804e4c <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d71:	f6 c2 02             	test   $0x2,%dl
+  804d74:	0f 84 c3 00 00 00    	je     804e3d <mmap_pgfault+0x147>
+  804d7a:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804d81:	ff ff ff 
+  804d84:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804d88:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804d8f:	00 00 00 
+  804d92:	48 39 ca             	cmp    %rcx,%rdx
+  804d95:	0f 85 a2 00 00 00    	jne    804e3d <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804d9b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804da0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804da5:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804dac:	00 00 00 
+  804daf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804db4:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  804dbb:	00 00 00 
+  804dbe:	ff d0                	call   *%rax
+  804dc0:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dc7:	85 d2                	test   %edx,%edx
+  804dc9:	78 72                	js     804e3d <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804dcb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dd0:	48 89 de             	mov    %rbx,%rsi
+  804dd3:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804dda:	00 00 00 
+  804ddd:	4c 89 e7             	mov    %r12,%rdi
+  804de0:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  804de7:	00 00 00 
+  804dea:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804dec:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804df2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804df8:	48 89 d9             	mov    %rbx,%rcx
+  804dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e00:	4c 89 e6             	mov    %r12,%rsi
+  804e03:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e08:	48 b8 47 2b 80 00 00 	movabs $0x802b47,%rax
+  804e0f:	00 00 00 
+  804e12:	ff d0                	call   *%rax
+  804e14:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804e16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e1b:	4c 89 e6             	mov    %r12,%rsi
+  804e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e23:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  804e2a:	00 00 00 
+  804e2d:	ff d0                	call   *%rax
+    return res >= 0;
+  804e2f:	89 d8                	mov    %ebx,%eax
+  804e31:	f7 d0                	not    %eax
+  804e33:	c1 e8 1f             	shr    $0x1f,%eax
+  804e36:	eb 05                	jmp    804e3d <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804e38:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804e3d:	48 83 c4 18          	add    $0x18,%rsp
+  804e41:	5b                   	pop    %rbx
+  804e42:	41 5c                	pop    %r12
+  804e44:	41 5d                	pop    %r13
+  804e46:	41 5e                	pop    %r14
+  804e48:	41 5f                	pop    %r15
+  804e4a:	5d                   	pop    %rbp
+  804e4b:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804e4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e50:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804e54:	4c 03 30             	add    (%rax),%r14
+  804e57:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804e5e:	49 39 c6             	cmp    %rax,%r14
+  804e61:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e65:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804e6c:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e72:	49 bf 30 49 80 00 00 	movabs $0x804930,%r15
+  804e79:	00 00 00 
+  804e7c:	4d 39 f4             	cmp    %r14,%r12
+  804e7f:	73 1d                	jae    804e9e <mmap_pgfault+0x1a8>
+  804e81:	4c 89 e7             	mov    %r12,%rdi
+  804e84:	41 ff d7             	call   *%r15
+  804e87:	84 c0                	test   %al,%al
+  804e89:	75 13                	jne    804e9e <mmap_pgfault+0x1a8>
+  804e8b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804e92:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804e99:	4d 39 f4             	cmp    %r14,%r12
+  804e9c:	72 e3                	jb     804e81 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e9e:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804ea4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ea8:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804eac:	74 2a                	je     804ed8 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804eae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804eb2:	89 de                	mov    %ebx,%esi
+  804eb4:	2b 30                	sub    (%rax),%esi
+  804eb6:	03 70 1c             	add    0x1c(%rax),%esi
+  804eb9:	8b 78 18             	mov    0x18(%rax),%edi
+  804ebc:	4c 89 e9             	mov    %r13,%rcx
+  804ebf:	48 89 da             	mov    %rbx,%rdx
+  804ec2:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  804ec9:	00 00 00 
+  804ecc:	ff d0                	call   *%rax
+    return res > 0;
+  804ece:	85 c0                	test   %eax,%eax
+  804ed0:	0f 9f c0             	setg   %al
+  804ed3:	e9 65 ff ff ff       	jmp    804e3d <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804ed8:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804edc:	eb d0                	jmp    804eae <mmap_pgfault+0x1b8>
+
+0000000000804ede <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804ede:	55                   	push   %rbp
+  804edf:	48 89 e5             	mov    %rsp,%rbp
+  804ee2:	41 57                	push   %r15
+  804ee4:	41 56                	push   %r14
+  804ee6:	41 55                	push   %r13
+  804ee8:	41 54                	push   %r12
+  804eea:	53                   	push   %rbx
+  804eeb:	48 83 ec 28          	sub    $0x28,%rsp
+  804eef:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804ef3:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804ef6:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804efd:	ff ff ff 
+  804f00:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f09:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804f10:	00 00 00 
+  804f13:	48 39 ca             	cmp    %rcx,%rdx
+  804f16:	0f 85 e5 00 00 00    	jne    805001 <mmap_writeback+0x123>
+  804f1c:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804f1f:	4c 39 ee             	cmp    %r13,%rsi
+  804f22:	0f 83 e8 00 00 00    	jae    805010 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f28:	49 be 30 49 80 00 00 	movabs $0x804930,%r14
+  804f2f:	00 00 00 
+  804f32:	49 bf 17 49 80 00 00 	movabs $0x804917,%r15
+  804f39:	00 00 00 
+  804f3c:	eb 10                	jmp    804f4e <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804f3e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804f45:	4d 39 ec             	cmp    %r13,%r12
+  804f48:	0f 83 ae 00 00 00    	jae    804ffc <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f4e:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804f52:	4c 89 e7             	mov    %r12,%rdi
+  804f55:	41 ff d6             	call   *%r14
+  804f58:	84 c0                	test   %al,%al
+  804f5a:	74 e2                	je     804f3e <mmap_writeback+0x60>
+  804f5c:	4c 89 e7             	mov    %r12,%rdi
+  804f5f:	41 ff d7             	call   *%r15
+  804f62:	84 c0                	test   %al,%al
+  804f64:	74 d8                	je     804f3e <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804f66:	4c 89 e3             	mov    %r12,%rbx
+  804f69:	4d 39 ec             	cmp    %r13,%r12
+  804f6c:	73 20                	jae    804f8e <mmap_writeback+0xb0>
+  804f6e:	48 89 df             	mov    %rbx,%rdi
+  804f71:	41 ff d6             	call   *%r14
+  804f74:	84 c0                	test   %al,%al
+  804f76:	74 16                	je     804f8e <mmap_writeback+0xb0>
+  804f78:	48 89 df             	mov    %rbx,%rdi
+  804f7b:	41 ff d7             	call   *%r15
+  804f7e:	84 c0                	test   %al,%al
+  804f80:	74 0c                	je     804f8e <mmap_writeback+0xb0>
+  804f82:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804f89:	4c 39 eb             	cmp    %r13,%rbx
+  804f8c:	72 e0                	jb     804f6e <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804f8e:	48 89 d9             	mov    %rbx,%rcx
+  804f91:	4c 29 e1             	sub    %r12,%rcx
+  804f94:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f98:	44 89 e6             	mov    %r12d,%esi
+  804f9b:	2b 30                	sub    (%rax),%esi
+  804f9d:	49 89 c4             	mov    %rax,%r12
+  804fa0:	03 70 1c             	add    0x1c(%rax),%esi
+  804fa3:	8b 78 18             	mov    0x18(%rax),%edi
+  804fa6:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804faa:	48 89 ca             	mov    %rcx,%rdx
+  804fad:	48 b8 5e 40 80 00 00 	movabs $0x80405e,%rax
+  804fb4:	00 00 00 
+  804fb7:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804fb9:	85 c0                	test   %eax,%eax
+  804fbb:	78 44                	js     805001 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804fbd:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804fc2:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804fc5:	41 89 c1             	mov    %eax,%r9d
+  804fc8:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804fcf:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804fd3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804fd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fdc:	48 89 ce             	mov    %rcx,%rsi
+  804fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fe4:	48 b8 47 2b 80 00 00 	movabs $0x802b47,%rax
+  804feb:	00 00 00 
+  804fee:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804ff0:	85 c0                	test   %eax,%eax
+  804ff2:	78 0d                	js     805001 <mmap_writeback+0x123>
+  804ff4:	49 89 dc             	mov    %rbx,%r12
+  804ff7:	e9 49 ff ff ff       	jmp    804f45 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805001:	48 83 c4 28          	add    $0x28,%rsp
+  805005:	5b                   	pop    %rbx
+  805006:	41 5c                	pop    %r12
+  805008:	41 5d                	pop    %r13
+  80500a:	41 5e                	pop    %r14
+  80500c:	41 5f                	pop    %r15
+  80500e:	5d                   	pop    %rbp
+  80500f:	c3                   	ret
+    return 0;
+  805010:	b8 00 00 00 00       	mov    $0x0,%eax
+  805015:	eb ea                	jmp    805001 <mmap_writeback+0x123>
+
+0000000000805017 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805017:	55                   	push   %rbp
+  805018:	48 89 e5             	mov    %rsp,%rbp
+  80501b:	41 57                	push   %r15
+  80501d:	41 56                	push   %r14
+  80501f:	41 55                	push   %r13
+  805021:	41 54                	push   %r12
+  805023:	53                   	push   %rbx
+  805024:	48 83 ec 38          	sub    $0x38,%rsp
+  805028:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80502c:	48 85 f6             	test   %rsi,%rsi
+  80502f:	0f 84 0c 02 00 00    	je     805241 <mmap+0x22a>
+  805035:	49 89 ff             	mov    %rdi,%r15
+  805038:	49 89 f4             	mov    %rsi,%r12
+  80503b:	41 89 d5             	mov    %edx,%r13d
+  80503e:	41 89 ce             	mov    %ecx,%r14d
+  805041:	44 89 cb             	mov    %r9d,%ebx
+  805044:	45 85 c9             	test   %r9d,%r9d
+  805047:	0f 88 f4 01 00 00    	js     805241 <mmap+0x22a>
+  80504d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805054:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80505b:	0f 85 e7 01 00 00    	jne    805248 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805061:	83 e2 fd             	and    $0xfffffffd,%edx
+  805064:	83 fa 04             	cmp    $0x4,%edx
+  805067:	0f 85 db 01 00 00    	jne    805248 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  80506d:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805070:	83 fa 01             	cmp    $0x1,%edx
+  805073:	0f 87 cf 01 00 00    	ja     805248 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805079:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80507d:	44 89 c7             	mov    %r8d,%edi
+  805080:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  805087:	00 00 00 
+  80508a:	ff d0                	call   *%rax
+  80508c:	89 c2                	mov    %eax,%edx
+  80508e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805095:	85 d2                	test   %edx,%edx
+  805097:	0f 88 ab 01 00 00    	js     805248 <mmap+0x231>
+  80509d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8050a1:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8050a8:	00 00 00 
+  8050ab:	8b 09                	mov    (%rcx),%ecx
+  8050ad:	39 0a                	cmp    %ecx,(%rdx)
+  8050af:	0f 85 93 01 00 00    	jne    805248 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8050b5:	8b 52 08             	mov    0x8(%rdx),%edx
+  8050b8:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8050bb:	83 fa 01             	cmp    $0x1,%edx
+  8050be:	0f 84 84 01 00 00    	je     805248 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8050c4:	41 83 fe 01          	cmp    $0x1,%r14d
+  8050c8:	74 42                	je     80510c <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8050ca:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8050d1:	4c 89 e6             	mov    %r12,%rsi
+  8050d4:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8050db:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8050df:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8050e3:	4d 85 ff             	test   %r15,%r15
+  8050e6:	74 67                	je     80514f <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050e8:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8050ef:	75 0f                	jne    805100 <mmap+0xe9>
+  8050f1:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8050f8:	00 00 00 
+  8050fb:	49 39 c7             	cmp    %rax,%r15
+  8050fe:	77 1b                	ja     80511b <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805100:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805107:	e9 3c 01 00 00       	jmp    805248 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80510c:	41 f6 c5 02          	test   $0x2,%r13b
+  805110:	74 b8                	je     8050ca <mmap+0xb3>
+  805112:	85 d2                	test   %edx,%edx
+  805114:	75 b4                	jne    8050ca <mmap+0xb3>
+  805116:	e9 2d 01 00 00       	jmp    805248 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80511b:	4c 89 ff             	mov    %r15,%rdi
+  80511e:	48 b8 85 4c 80 00 00 	movabs $0x804c85,%rax
+  805125:	00 00 00 
+  805128:	ff d0                	call   *%rax
+  80512a:	48 89 c2             	mov    %rax,%rdx
+  80512d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805134:	49 39 d7             	cmp    %rdx,%r15
+  805137:	0f 85 0b 01 00 00    	jne    805248 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80513d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805144:	00 00 00 
+  805147:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80514d:	eb 44                	jmp    805193 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80514f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805153:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  80515a:	00 00 00 
+  80515d:	48 b8 85 4c 80 00 00 	movabs $0x804c85,%rax
+  805164:	00 00 00 
+  805167:	ff d0                	call   *%rax
+  805169:	48 89 c7             	mov    %rax,%rdi
+  80516c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805170:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805177:	48 85 ff             	test   %rdi,%rdi
+  80517a:	75 c1                	jne    80513d <mmap+0x126>
+  80517c:	e9 c7 00 00 00       	jmp    805248 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805181:	49 83 c4 01          	add    $0x1,%r12
+  805185:	48 83 c0 20          	add    $0x20,%rax
+  805189:	49 83 fc 20          	cmp    $0x20,%r12
+  80518d:	0f 84 a5 00 00 00    	je     805238 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805193:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805197:	75 e8                	jne    805181 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805199:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80519d:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  8051a4:	00 00 00 
+  8051a7:	ff d0                	call   *%rax
+  8051a9:	89 c2                	mov    %eax,%edx
+  8051ab:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051b2:	85 d2                	test   %edx,%edx
+  8051b4:	0f 88 8e 00 00 00    	js     805248 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8051ba:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8051be:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  8051c5:	00 00 00 
+  8051c8:	ff d0                	call   *%rax
+  8051ca:	89 c6                	mov    %eax,%esi
+  8051cc:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8051cf:	48 b8 38 35 80 00 00 	movabs $0x803538,%rax
+  8051d6:	00 00 00 
+  8051d9:	ff d0                	call   *%rax
+  8051db:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8051de:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051e5:	45 85 ff             	test   %r15d,%r15d
+  8051e8:	78 5e                	js     805248 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8051ea:	49 c1 e4 05          	shl    $0x5,%r12
+  8051ee:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8051f5:	00 00 00 
+  8051f8:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8051fb:	48 bf f6 4c 80 00 00 	movabs $0x804cf6,%rdi
+  805202:	00 00 00 
+  805205:	48 b8 21 57 80 00 00 	movabs $0x805721,%rax
+  80520c:	00 00 00 
+  80520f:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805211:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805215:	49 89 04 24          	mov    %rax,(%r12)
+  805219:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80521d:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805222:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805227:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80522c:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805231:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805236:	eb 10                	jmp    805248 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805238:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80523f:	eb 07                	jmp    805248 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805241:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805248:	48 83 c4 38          	add    $0x38,%rsp
+  80524c:	5b                   	pop    %rbx
+  80524d:	41 5c                	pop    %r12
+  80524f:	41 5d                	pop    %r13
+  805251:	41 5e                	pop    %r14
+  805253:	41 5f                	pop    %r15
+  805255:	5d                   	pop    %rbp
+  805256:	c3                   	ret
+
+0000000000805257 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805257:	55                   	push   %rbp
+  805258:	48 89 e5             	mov    %rsp,%rbp
+  80525b:	41 57                	push   %r15
+  80525d:	41 56                	push   %r14
+  80525f:	41 55                	push   %r13
+  805261:	41 54                	push   %r12
+  805263:	53                   	push   %rbx
+  805264:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805268:	49 89 fe             	mov    %rdi,%r14
+  80526b:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805272:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805279:	00 
+  80527a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805281:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805288:	00 00 00 
+  80528b:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805292:	49 bf de 4e 80 00 00 	movabs $0x804ede,%r15
+  805299:	00 00 00 
+  80529c:	eb 09                	jmp    8052a7 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80529e:	48 83 c3 20          	add    $0x20,%rbx
+  8052a2:	4c 39 eb             	cmp    %r13,%rbx
+  8052a5:	74 33                	je     8052da <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052a7:	48 89 df             	mov    %rbx,%rdi
+  8052aa:	48 8b 33             	mov    (%rbx),%rsi
+  8052ad:	4c 39 e6             	cmp    %r12,%rsi
+  8052b0:	73 ec                	jae    80529e <msync+0x47>
+  8052b2:	48 85 f6             	test   %rsi,%rsi
+  8052b5:	74 e7                	je     80529e <msync+0x47>
+  8052b7:	48 89 f2             	mov    %rsi,%rdx
+  8052ba:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8052be:	49 39 d6             	cmp    %rdx,%r14
+  8052c1:	73 db                	jae    80529e <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8052c3:	4c 39 e2             	cmp    %r12,%rdx
+  8052c6:	49 0f 47 d4          	cmova  %r12,%rdx
+  8052ca:	4c 39 f6             	cmp    %r14,%rsi
+  8052cd:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8052d1:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8052d4:	85 c0                	test   %eax,%eax
+  8052d6:	79 c6                	jns    80529e <msync+0x47>
+  8052d8:	eb 05                	jmp    8052df <msync+0x88>
+    }
+
+    return 0;
+  8052da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052df:	48 83 c4 08          	add    $0x8,%rsp
+  8052e3:	5b                   	pop    %rbx
+  8052e4:	41 5c                	pop    %r12
+  8052e6:	41 5d                	pop    %r13
+  8052e8:	41 5e                	pop    %r14
+  8052ea:	41 5f                	pop    %r15
+  8052ec:	5d                   	pop    %rbp
+  8052ed:	c3                   	ret
+
+00000000008052ee <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8052ee:	55                   	push   %rbp
+  8052ef:	48 89 e5             	mov    %rsp,%rbp
+  8052f2:	41 57                	push   %r15
+  8052f4:	41 56                	push   %r14
+  8052f6:	41 55                	push   %r13
+  8052f8:	41 54                	push   %r12
+  8052fa:	53                   	push   %rbx
+  8052fb:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8052ff:	49 89 ff             	mov    %rdi,%r15
+  805302:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805309:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805310:	00 
+  805311:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805318:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80531f:	00 00 00 
+  805322:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805329:	48 89 d8             	mov    %rbx,%rax
+  80532c:	eb 09                	jmp    805337 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80532e:	48 83 c0 20          	add    $0x20,%rax
+  805332:	4c 39 f0             	cmp    %r14,%rax
+  805335:	74 40                	je     805377 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805337:	48 8b 10             	mov    (%rax),%rdx
+  80533a:	4c 39 e2             	cmp    %r12,%rdx
+  80533d:	73 ef                	jae    80532e <munmap+0x40>
+  80533f:	48 85 d2             	test   %rdx,%rdx
+  805342:	74 ea                	je     80532e <munmap+0x40>
+  805344:	48 89 d7             	mov    %rdx,%rdi
+  805347:	48 03 78 08          	add    0x8(%rax),%rdi
+  80534b:	49 39 ff             	cmp    %rdi,%r15
+  80534e:	73 de                	jae    80532e <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805350:	49 39 fc             	cmp    %rdi,%r12
+  805353:	72 05                	jb     80535a <munmap+0x6c>
+  805355:	4c 39 fa             	cmp    %r15,%rdx
+  805358:	73 d4                	jae    80532e <munmap+0x40>
+  80535a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80535f:	48 83 c4 08          	add    $0x8,%rsp
+  805363:	5b                   	pop    %rbx
+  805364:	41 5c                	pop    %r12
+  805366:	41 5d                	pop    %r13
+  805368:	41 5e                	pop    %r14
+  80536a:	41 5f                	pop    %r15
+  80536c:	5d                   	pop    %rbp
+  80536d:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80536e:	48 83 c3 20          	add    $0x20,%rbx
+  805372:	4c 39 f3             	cmp    %r14,%rbx
+  805375:	74 5c                	je     8053d3 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805377:	48 8b 33             	mov    (%rbx),%rsi
+  80537a:	4c 39 e6             	cmp    %r12,%rsi
+  80537d:	73 ef                	jae    80536e <munmap+0x80>
+  80537f:	48 85 f6             	test   %rsi,%rsi
+  805382:	74 ea                	je     80536e <munmap+0x80>
+  805384:	48 89 f2             	mov    %rsi,%rdx
+  805387:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80538b:	49 39 d7             	cmp    %rdx,%r15
+  80538e:	73 de                	jae    80536e <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805390:	48 89 df             	mov    %rbx,%rdi
+  805393:	48 b8 de 4e 80 00 00 	movabs $0x804ede,%rax
+  80539a:	00 00 00 
+  80539d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80539f:	85 c0                	test   %eax,%eax
+  8053a1:	78 bc                	js     80535f <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8053a3:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8053a7:	48 8b 33             	mov    (%rbx),%rsi
+  8053aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053af:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  8053b6:	00 00 00 
+  8053b9:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8053bb:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8053be:	48 b8 dd 34 80 00 00 	movabs $0x8034dd,%rax
+  8053c5:	00 00 00 
+  8053c8:	ff d0                	call   *%rax
+        reg->start = 0;
+  8053ca:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8053d1:	eb 9b                	jmp    80536e <munmap+0x80>
+    return 0;
+  8053d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053d8:	eb 85                	jmp    80535f <munmap+0x71>
+
+00000000008053da <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8053da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053df:	c3                   	ret
+
+00000000008053e0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8053e0:	55                   	push   %rbp
+  8053e1:	48 89 e5             	mov    %rsp,%rbp
+  8053e4:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8053e7:	48 be 7b 69 80 00 00 	movabs $0x80697b,%rsi
+  8053ee:	00 00 00 
+  8053f1:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  8053f8:	00 00 00 
+  8053fb:	ff d0                	call   *%rax
+    return 0;
+}
+  8053fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805402:	5d                   	pop    %rbp
+  805403:	c3                   	ret
+
+0000000000805404 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805404:	55                   	push   %rbp
+  805405:	48 89 e5             	mov    %rsp,%rbp
+  805408:	41 57                	push   %r15
+  80540a:	41 56                	push   %r14
+  80540c:	41 55                	push   %r13
+  80540e:	41 54                	push   %r12
+  805410:	53                   	push   %rbx
+  805411:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805418:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80541f:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805426:	00 00 00 00 
+  80542a:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805431:	00 00 00 00 
+  805435:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80543c:	00 00 00 00 
+  805440:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805447:	00 00 00 00 
+  80544b:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805452:	00 00 00 00 
+  805456:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  80545d:	00 00 00 00 
+  805461:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805468:	00 
+  805469:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805470:	00 
+  805471:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805478:	00 
+  805479:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805480:	00 
+  805481:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805488:	00 
+  805489:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805490:	00 
+  805491:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805498:	00 
+  805499:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8054a0:	00 
+  8054a1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8054a8:	00 
+  8054a9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8054b0:	00 
+    for (res = 0; res < n; res += inc) {
+  8054b1:	48 85 d2             	test   %rdx,%rdx
+  8054b4:	74 7a                	je     805530 <devcons_write+0x12c>
+  8054b6:	49 89 d6             	mov    %rdx,%r14
+  8054b9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054bf:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8054c4:	49 bf c5 26 80 00 00 	movabs $0x8026c5,%r15
+  8054cb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8054ce:	4c 89 f3             	mov    %r14,%rbx
+  8054d1:	48 29 f3             	sub    %rsi,%rbx
+  8054d4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8054d9:	48 39 c3             	cmp    %rax,%rbx
+  8054dc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8054e0:	4c 63 eb             	movslq %ebx,%r13
+  8054e3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8054ea:	48 01 c6             	add    %rax,%rsi
+  8054ed:	4c 89 ea             	mov    %r13,%rdx
+  8054f0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8054f7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8054fa:	4c 89 ee             	mov    %r13,%rsi
+  8054fd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805504:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  80550b:	00 00 00 
+  80550e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805510:	41 01 dc             	add    %ebx,%r12d
+  805513:	49 63 f4             	movslq %r12d,%rsi
+  805516:	4c 39 f6             	cmp    %r14,%rsi
+  805519:	72 b3                	jb     8054ce <devcons_write+0xca>
+    return res;
+  80551b:	49 63 c4             	movslq %r12d,%rax
+}
+  80551e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805525:	5b                   	pop    %rbx
+  805526:	41 5c                	pop    %r12
+  805528:	41 5d                	pop    %r13
+  80552a:	41 5e                	pop    %r14
+  80552c:	41 5f                	pop    %r15
+  80552e:	5d                   	pop    %rbp
+  80552f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805530:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805536:	eb e3                	jmp    80551b <devcons_write+0x117>
+
+0000000000805538 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805538:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80553b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805540:	48 85 c0             	test   %rax,%rax
+  805543:	74 55                	je     80559a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805545:	55                   	push   %rbp
+  805546:	48 89 e5             	mov    %rsp,%rbp
+  805549:	41 55                	push   %r13
+  80554b:	41 54                	push   %r12
+  80554d:	53                   	push   %rbx
+  80554e:	48 83 ec 08          	sub    $0x8,%rsp
+  805552:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805555:	48 bb 25 29 80 00 00 	movabs $0x802925,%rbx
+  80555c:	00 00 00 
+  80555f:	49 bc 39 2a 80 00 00 	movabs $0x802a39,%r12
+  805566:	00 00 00 
+  805569:	eb 03                	jmp    80556e <devcons_read+0x36>
+  80556b:	41 ff d4             	call   *%r12
+  80556e:	ff d3                	call   *%rbx
+  805570:	85 c0                	test   %eax,%eax
+  805572:	74 f7                	je     80556b <devcons_read+0x33>
+    if (c < 0) return c;
+  805574:	48 63 d0             	movslq %eax,%rdx
+  805577:	78 13                	js     80558c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80557e:	83 f8 04             	cmp    $0x4,%eax
+  805581:	74 09                	je     80558c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805583:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805587:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80558c:	48 89 d0             	mov    %rdx,%rax
+  80558f:	48 83 c4 08          	add    $0x8,%rsp
+  805593:	5b                   	pop    %rbx
+  805594:	41 5c                	pop    %r12
+  805596:	41 5d                	pop    %r13
+  805598:	5d                   	pop    %rbp
+  805599:	c3                   	ret
+  80559a:	48 89 d0             	mov    %rdx,%rax
+  80559d:	c3                   	ret
+
+000000000080559e <cputchar>:
+cputchar(int ch) {
+  80559e:	55                   	push   %rbp
+  80559f:	48 89 e5             	mov    %rsp,%rbp
+  8055a2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8055a6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8055aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8055af:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8055b3:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  8055ba:	00 00 00 
+  8055bd:	ff d0                	call   *%rax
+}
+  8055bf:	c9                   	leave
+  8055c0:	c3                   	ret
+
+00000000008055c1 <getchar>:
+getchar(void) {
+  8055c1:	55                   	push   %rbp
+  8055c2:	48 89 e5             	mov    %rsp,%rbp
+  8055c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8055c9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8055ce:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8055d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055d7:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  8055de:	00 00 00 
+  8055e1:	ff d0                	call   *%rax
+  8055e3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8055e5:	85 c0                	test   %eax,%eax
+  8055e7:	78 06                	js     8055ef <getchar+0x2e>
+  8055e9:	74 08                	je     8055f3 <getchar+0x32>
+  8055eb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8055ef:	89 d0                	mov    %edx,%eax
+  8055f1:	c9                   	leave
+  8055f2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8055f3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8055f8:	eb f5                	jmp    8055ef <getchar+0x2e>
+
+00000000008055fa <iscons>:
+iscons(int fdnum) {
+  8055fa:	55                   	push   %rbp
+  8055fb:	48 89 e5             	mov    %rsp,%rbp
+  8055fe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805602:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805606:	48 b8 78 33 80 00 00 	movabs $0x803378,%rax
+  80560d:	00 00 00 
+  805610:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805612:	85 c0                	test   %eax,%eax
+  805614:	78 18                	js     80562e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805616:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80561a:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805621:	00 00 00 
+  805624:	8b 00                	mov    (%rax),%eax
+  805626:	39 02                	cmp    %eax,(%rdx)
+  805628:	0f 94 c0             	sete   %al
+  80562b:	0f b6 c0             	movzbl %al,%eax
+}
+  80562e:	c9                   	leave
+  80562f:	c3                   	ret
+
+0000000000805630 <opencons>:
+opencons(void) {
+  805630:	55                   	push   %rbp
+  805631:	48 89 e5             	mov    %rsp,%rbp
+  805634:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805638:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80563c:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  805643:	00 00 00 
+  805646:	ff d0                	call   *%rax
+  805648:	85 c0                	test   %eax,%eax
+  80564a:	78 49                	js     805695 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80564c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805651:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805656:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80565a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80565f:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  805666:	00 00 00 
+  805669:	ff d0                	call   *%rax
+  80566b:	85 c0                	test   %eax,%eax
+  80566d:	78 26                	js     805695 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80566f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805673:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80567a:	00 00 
+  80567c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80567e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805682:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805689:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  805690:	00 00 00 
+  805693:	ff d0                	call   *%rax
+}
+  805695:	c9                   	leave
+  805696:	c3                   	ret
+
+0000000000805697 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805697:	55                   	push   %rbp
+  805698:	48 89 e5             	mov    %rsp,%rbp
+  80569b:	41 56                	push   %r14
+  80569d:	41 55                	push   %r13
+  80569f:	41 54                	push   %r12
+  8056a1:	53                   	push   %rbx
+  8056a2:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056a5:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056ac:	00 00 00 
+  8056af:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8056b3:	74 27                	je     8056dc <_handle_vectored_pagefault+0x45>
+  8056b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8056ba:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8056c1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056c4:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8056c7:	4c 89 e7             	mov    %r12,%rdi
+  8056ca:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8056cf:	84 c0                	test   %al,%al
+  8056d1:	75 45                	jne    805718 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056d3:	48 83 c3 01          	add    $0x1,%rbx
+  8056d7:	49 3b 1e             	cmp    (%r14),%rbx
+  8056da:	72 eb                	jb     8056c7 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8056dc:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8056e3:	00 
+  8056e4:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8056e9:	4d 8b 04 24          	mov    (%r12),%r8
+  8056ed:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  8056f4:	00 00 00 
+  8056f7:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8056fc:	48 bf b8 69 80 00 00 	movabs $0x8069b8,%rdi
+  805703:	00 00 00 
+  805706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80570b:	49 ba ee 18 80 00 00 	movabs $0x8018ee,%r10
+  805712:	00 00 00 
+  805715:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805718:	5b                   	pop    %rbx
+  805719:	41 5c                	pop    %r12
+  80571b:	41 5d                	pop    %r13
+  80571d:	41 5e                	pop    %r14
+  80571f:	5d                   	pop    %rbp
+  805720:	c3                   	ret
+
+0000000000805721 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805721:	55                   	push   %rbp
+  805722:	48 89 e5             	mov    %rsp,%rbp
+  805725:	53                   	push   %rbx
+  805726:	48 83 ec 08          	sub    $0x8,%rsp
+  80572a:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80572d:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805732:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805739:	00 00 00 
+  80573c:	80 38 00             	cmpb   $0x0,(%rax)
+  80573f:	74 68                	je     8057a9 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805741:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805748:	00 00 00 
+  80574b:	48 8b 08             	mov    (%rax),%rcx
+  80574e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805753:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80575a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80575d:	48 85 c9             	test   %rcx,%rcx
+  805760:	0f 84 e0 00 00 00    	je     805846 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805766:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80576a:	0f 84 c9 00 00 00    	je     805839 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805770:	48 83 c2 01          	add    $0x1,%rdx
+  805774:	48 39 ca             	cmp    %rcx,%rdx
+  805777:	75 ed                	jne    805766 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805779:	48 83 f9 08          	cmp    $0x8,%rcx
+  80577d:	0f 84 84 00 00 00    	je     805807 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805783:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805787:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80578e:	00 00 00 
+  805791:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805798:	00 00 00 
+  80579b:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80579f:	85 f6                	test   %esi,%esi
+  8057a1:	0f 89 97 00 00 00    	jns    80583e <add_pgfault_handler+0x11d>
+  8057a7:	eb 63                	jmp    80580c <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8057a9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8057ae:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8057b3:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8057ba:	00 00 00 
+  8057bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057c2:	48 b8 da 2a 80 00 00 	movabs $0x802ada,%rax
+  8057c9:	00 00 00 
+  8057cc:	ff d0                	call   *%rax
+  8057ce:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057d0:	85 c0                	test   %eax,%eax
+  8057d2:	78 38                	js     80580c <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8057d4:	48 be 22 59 80 00 00 	movabs $0x805922,%rsi
+  8057db:	00 00 00 
+  8057de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057e3:	48 b8 fd 2c 80 00 00 	movabs $0x802cfd,%rax
+  8057ea:	00 00 00 
+  8057ed:	ff d0                	call   *%rax
+  8057ef:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057f1:	85 c0                	test   %eax,%eax
+  8057f3:	78 17                	js     80580c <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8057f5:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8057fc:	00 00 00 
+  8057ff:	c6 00 01             	movb   $0x1,(%rax)
+  805802:	e9 3a ff ff ff       	jmp    805741 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805807:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80580c:	89 f1                	mov    %esi,%ecx
+  80580e:	48 ba c6 69 80 00 00 	movabs $0x8069c6,%rdx
+  805815:	00 00 00 
+  805818:	be 42 00 00 00       	mov    $0x42,%esi
+  80581d:	48 bf b8 69 80 00 00 	movabs $0x8069b8,%rdi
+  805824:	00 00 00 
+  805827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80582c:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  805833:	00 00 00 
+  805836:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805839:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  80583e:	89 f0                	mov    %esi,%eax
+  805840:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805844:	c9                   	leave
+  805845:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805846:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80584d:	00 00 00 
+  805850:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805857:	48 89 d8             	mov    %rbx,%rax
+  80585a:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805861:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805864:	eb d8                	jmp    80583e <add_pgfault_handler+0x11d>
+
+0000000000805866 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805866:	55                   	push   %rbp
+  805867:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80586a:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805871:	00 00 00 
+  805874:	80 38 00             	cmpb   $0x0,(%rax)
+  805877:	74 33                	je     8058ac <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805879:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805880:	00 00 00 
+  805883:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805888:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80588f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805892:	48 85 c0             	test   %rax,%rax
+  805895:	0f 84 85 00 00 00    	je     805920 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80589b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80589f:	74 40                	je     8058e1 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8058a1:	48 83 c1 01          	add    $0x1,%rcx
+  8058a5:	48 39 c1             	cmp    %rax,%rcx
+  8058a8:	75 f1                	jne    80589b <remove_pgfault_handler+0x35>
+  8058aa:	eb 74                	jmp    805920 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8058ac:	48 b9 de 69 80 00 00 	movabs $0x8069de,%rcx
+  8058b3:	00 00 00 
+  8058b6:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  8058bd:	00 00 00 
+  8058c0:	be 48 00 00 00       	mov    $0x48,%esi
+  8058c5:	48 bf b8 69 80 00 00 	movabs $0x8069b8,%rdi
+  8058cc:	00 00 00 
+  8058cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058d4:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  8058db:	00 00 00 
+  8058de:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8058e1:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8058e8:	00 
+  8058e9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8058ed:	48 29 ca             	sub    %rcx,%rdx
+  8058f0:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8058f7:	00 00 00 
+  8058fa:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8058fe:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805903:	48 89 ce             	mov    %rcx,%rsi
+  805906:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  80590d:	00 00 00 
+  805910:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805912:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805919:	00 00 00 
+  80591c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805920:	5d                   	pop    %rbp
+  805921:	c3                   	ret
+
+0000000000805922 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805922:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805925:	48 b8 97 56 80 00 00 	movabs $0x805697,%rax
+  80592c:	00 00 00 
+    call *%rax
+  80592f:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805931:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805938:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805939:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805940:	00 
+    subq $8, %rcx
+  805941:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805945:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805948:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80594f:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805950:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805954:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805958:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80595d:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805962:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805967:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80596c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805971:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805976:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80597b:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805980:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805985:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80598a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80598f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805994:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805999:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80599e:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8059a2:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8059a6:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8059a7:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8059a8:	c3                   	ret
+
+00000000008059a9 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8059a9:	85 ff                	test   %edi,%edi
+  8059ab:	78 58                	js     805a05 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8059ad:	48 85 f6             	test   %rsi,%rsi
+  8059b0:	74 12                	je     8059c4 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8059b2:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8059b9:	00 00 00 
+  8059bc:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8059c2:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8059c4:	48 85 c9             	test   %rcx,%rcx
+  8059c7:	74 12                	je     8059db <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8059c9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8059d0:	00 00 00 
+  8059d3:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8059d9:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8059db:	48 85 d2             	test   %rdx,%rdx
+  8059de:	74 14                	je     8059f4 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8059e0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8059e7:	00 00 00 
+  8059ea:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8059f1:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8059f4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8059fb:	00 00 00 
+  8059fe:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805a04:	c3                   	ret
+        if (from_env_store) {
+  805a05:	48 85 f6             	test   %rsi,%rsi
+  805a08:	74 06                	je     805a10 <ipc_result+0x67>
+            *from_env_store = 0;
+  805a0a:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805a10:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805a12:	48 85 c9             	test   %rcx,%rcx
+  805a15:	74 ed                	je     805a04 <ipc_result+0x5b>
+            *perm_store = 0;
+  805a17:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805a1d:	c3                   	ret
+
+0000000000805a1e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805a1e:	55                   	push   %rbp
+  805a1f:	48 89 e5             	mov    %rsp,%rbp
+  805a22:	41 55                	push   %r13
+  805a24:	41 54                	push   %r12
+  805a26:	53                   	push   %rbx
+  805a27:	48 83 ec 08          	sub    $0x8,%rsp
+  805a2b:	49 89 fc             	mov    %rdi,%r12
+  805a2e:	48 89 f7             	mov    %rsi,%rdi
+  805a31:	48 89 d3             	mov    %rdx,%rbx
+  805a34:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805a37:	48 85 f6             	test   %rsi,%rsi
+  805a3a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a41:	00 00 00 
+  805a44:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805a48:	be 00 00 00 00       	mov    $0x0,%esi
+  805a4d:	48 85 d2             	test   %rdx,%rdx
+  805a50:	74 03                	je     805a55 <ipc_recv+0x37>
+  805a52:	48 8b 32             	mov    (%rdx),%rsi
+  805a55:	48 b8 26 30 80 00 00 	movabs $0x803026,%rax
+  805a5c:	00 00 00 
+  805a5f:	ff d0                	call   *%rax
+  805a61:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805a63:	4c 89 e9             	mov    %r13,%rcx
+  805a66:	48 89 da             	mov    %rbx,%rdx
+  805a69:	4c 89 e6             	mov    %r12,%rsi
+  805a6c:	48 b8 a9 59 80 00 00 	movabs $0x8059a9,%rax
+  805a73:	00 00 00 
+  805a76:	ff d0                	call   *%rax
+}
+  805a78:	48 83 c4 08          	add    $0x8,%rsp
+  805a7c:	5b                   	pop    %rbx
+  805a7d:	41 5c                	pop    %r12
+  805a7f:	41 5d                	pop    %r13
+  805a81:	5d                   	pop    %rbp
+  805a82:	c3                   	ret
+
+0000000000805a83 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805a83:	55                   	push   %rbp
+  805a84:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805a87:	48 85 d2             	test   %rdx,%rdx
+  805a8a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a91:	00 00 00 
+  805a94:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805a98:	89 f6                	mov    %esi,%esi
+  805a9a:	48 b8 b2 2e 80 00 00 	movabs $0x802eb2,%rax
+  805aa1:	00 00 00 
+  805aa4:	ff d0                	call   *%rax
+    if (res < 0) {
+  805aa6:	85 c0                	test   %eax,%eax
+  805aa8:	78 02                	js     805aac <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805aaa:	5d                   	pop    %rbp
+  805aab:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805aac:	89 c1                	mov    %eax,%ecx
+  805aae:	48 ba f8 69 80 00 00 	movabs $0x8069f8,%rdx
+  805ab5:	00 00 00 
+  805ab8:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805abd:	48 bf 05 6a 80 00 00 	movabs $0x806a05,%rdi
+  805ac4:	00 00 00 
+  805ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805acc:	49 b8 ee 18 80 00 00 	movabs $0x8018ee,%r8
+  805ad3:	00 00 00 
+  805ad6:	41 ff d0             	call   *%r8
+
+0000000000805ad9 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805ad9:	55                   	push   %rbp
+  805ada:	48 89 e5             	mov    %rsp,%rbp
+  805add:	53                   	push   %rbx
+  805ade:	48 83 ec 08          	sub    $0x8,%rsp
+  805ae2:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805ae6:	48 85 d2             	test   %rdx,%rdx
+  805ae9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805af0:	00 00 00 
+  805af3:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805af7:	4d 85 c9             	test   %r9,%r9
+  805afa:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b03:	48 85 db             	test   %rbx,%rbx
+  805b06:	74 03                	je     805b0b <ipc_call+0x32>
+  805b08:	48 8b 03             	mov    (%rbx),%rax
+  805b0b:	89 f6                	mov    %esi,%esi
+  805b0d:	48 83 ec 08          	sub    $0x8,%rsp
+  805b11:	50                   	push   %rax
+  805b12:	48 b8 e4 2e 80 00 00 	movabs $0x802ee4,%rax
+  805b19:	00 00 00 
+  805b1c:	ff d0                	call   *%rax
+  805b1e:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805b20:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805b24:	48 89 da             	mov    %rbx,%rdx
+  805b27:	be 00 00 00 00       	mov    $0x0,%esi
+  805b2c:	48 b8 a9 59 80 00 00 	movabs $0x8059a9,%rax
+  805b33:	00 00 00 
+  805b36:	ff d0                	call   *%rax
+}
+  805b38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805b3c:	c9                   	leave
+  805b3d:	c3                   	ret
+
+0000000000805b3e <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805b3e:	55                   	push   %rbp
+  805b3f:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805b42:	89 f6                	mov    %esi,%esi
+  805b44:	48 b8 50 2f 80 00 00 	movabs $0x802f50,%rax
+  805b4b:	00 00 00 
+  805b4e:	ff d0                	call   *%rax
+  805b50:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805b52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b5c:	be 00 00 00 00       	mov    $0x0,%esi
+  805b61:	48 b8 a9 59 80 00 00 	movabs $0x8059a9,%rax
+  805b68:	00 00 00 
+  805b6b:	ff d0                	call   *%rax
+}
+  805b6d:	5d                   	pop    %rbp
+  805b6e:	c3                   	ret
+
+0000000000805b6f <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805b6f:	55                   	push   %rbp
+  805b70:	48 89 e5             	mov    %rsp,%rbp
+  805b73:	41 54                	push   %r12
+  805b75:	53                   	push   %rbx
+  805b76:	4c 89 cb             	mov    %r9,%rbx
+  805b79:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805b7d:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805b81:	48 85 d2             	test   %rdx,%rdx
+  805b84:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b8b:	00 00 00 
+  805b8e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805b92:	4d 85 c9             	test   %r9,%r9
+  805b95:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b9e:	4d 85 e4             	test   %r12,%r12
+  805ba1:	74 04                	je     805ba7 <ipc_reply_wait+0x38>
+  805ba3:	49 8b 04 24          	mov    (%r12),%rax
+  805ba7:	89 f6                	mov    %esi,%esi
+  805ba9:	48 83 ec 08          	sub    $0x8,%rsp
+  805bad:	50                   	push   %rax
+  805bae:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  805bb5:	00 00 00 
+  805bb8:	ff d0                	call   *%rax
+  805bba:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805bbc:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805bc0:	4c 89 e2             	mov    %r12,%rdx
+  805bc3:	48 89 de             	mov    %rbx,%rsi
+  805bc6:	48 b8 a9 59 80 00 00 	movabs $0x8059a9,%rax
+  805bcd:	00 00 00 
+  805bd0:	ff d0                	call   *%rax
+}
+  805bd2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805bd6:	5b                   	pop    %rbx
+  805bd7:	41 5c                	pop    %r12
+  805bd9:	5d                   	pop    %rbp
+  805bda:	c3                   	ret
+
+0000000000805bdb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805be0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805be7:	00 00 00 
+  805bea:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805bf1:	48 01 ca             	add    %rcx,%rdx
+  805bf4:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805bfa:	39 fa                	cmp    %edi,%edx
+  805bfc:	74 12                	je     805c10 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805bfe:	48 83 c0 01          	add    $0x1,%rax
+  805c02:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805c08:	75 e0                	jne    805bea <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c0f:	c3                   	ret
+            return envs[i].env_id;
+  805c10:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805c17:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805c1e:	00 00 00 
+  805c21:	48 01 d0             	add    %rdx,%rax
+  805c24:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805c2a:	c3                   	ret
+  805c2b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805c30 <__rodata_start>:
+  805c30:	77 00                	ja     805c32 <__rodata_start+0x2>
+  805c32:	72 62                	jb     805c96 <__rodata_start+0x66>
+  805c34:	00 77 62             	add    %dh,0x62(%rdi)
+  805c37:	00 0f                	add    %cl,(%rdi)
+  805c39:	1f                   	(bad)
+  805c3a:	84 00                	test   %al,(%rax)
+  805c3c:	00 00                	add    %al,(%rax)
+  805c3e:	00 00                	add    %al,(%rax)
+  805c40:	b3 09                	mov    $0x9,%bl
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 ed                	add    %ch,%ch
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	ed                   	in     (%dx),%eax
+  805c59:	0d 80 00 00 00       	or     $0x80,%eax
+  805c5e:	00 00                	add    %al,(%rax)
+  805c60:	ed                   	in     (%dx),%eax
+  805c61:	0d 80 00 00 00       	or     $0x80,%eax
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 ed                	add    %ch,%ch
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	ed                   	in     (%dx),%eax
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ed                   	in     (%dx),%eax
+  805c81:	0d 80 00 00 00       	or     $0x80,%eax
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	8c 0a                	mov    %cs,(%rdx)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	8c 0a                	mov    %cs,(%rdx)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	8c 0a                	mov    %cs,(%rdx)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805cc6:	00 00                	add    %al,(%rax)
+  805cc8:	8c 0a                	mov    %cs,(%rdx)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	8c 0a                	mov    %cs,(%rdx)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	ed                   	in     (%dx),%eax
+  805ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cee:	00 00                	add    %al,(%rax)
+  805cf0:	ed                   	in     (%dx),%eax
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	ed                   	in     (%dx),%eax
+  805d19:	0d 80 00 00 00       	or     $0x80,%eax
+  805d1e:	00 00                	add    %al,(%rax)
+  805d20:	ed                   	in     (%dx),%eax
+  805d21:	0d 80 00 00 00       	or     $0x80,%eax
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	ed                   	in     (%dx),%eax
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	ed                   	in     (%dx),%eax
+  805d31:	0d 80 00 00 00       	or     $0x80,%eax
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	ed                   	in     (%dx),%eax
+  805d39:	0d 80 00 00 00       	or     $0x80,%eax
+  805d3e:	00 00                	add    %al,(%rax)
+  805d40:	ed                   	in     (%dx),%eax
+  805d41:	0d 80 00 00 00       	or     $0x80,%eax
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	ed                   	in     (%dx),%eax
+  805d49:	0d 80 00 00 00       	or     $0x80,%eax
+  805d4e:	00 00                	add    %al,(%rax)
+  805d50:	ed                   	in     (%dx),%eax
+  805d51:	0d 80 00 00 00       	or     $0x80,%eax
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	ed                   	in     (%dx),%eax
+  805d59:	0d 80 00 00 00       	or     $0x80,%eax
+  805d5e:	00 00                	add    %al,(%rax)
+  805d60:	ed                   	in     (%dx),%eax
+  805d61:	0d 80 00 00 00       	or     $0x80,%eax
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	ed                   	in     (%dx),%eax
+  805d71:	0d 80 00 00 00       	or     $0x80,%eax
+  805d76:	00 00                	add    %al,(%rax)
+  805d78:	ed                   	in     (%dx),%eax
+  805d79:	0d 80 00 00 00       	or     $0x80,%eax
+  805d7e:	00 00                	add    %al,(%rax)
+  805d80:	ed                   	in     (%dx),%eax
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	ed                   	in     (%dx),%eax
+  805d91:	0d 80 00 00 00       	or     $0x80,%eax
+  805d96:	00 00                	add    %al,(%rax)
+  805d98:	ed                   	in     (%dx),%eax
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ed                   	in     (%dx),%eax
+  805da1:	0d 80 00 00 00       	or     $0x80,%eax
+  805da6:	00 00                	add    %al,(%rax)
+  805da8:	ed                   	in     (%dx),%eax
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	ed                   	in     (%dx),%eax
+  805db9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dbe:	00 00                	add    %al,(%rax)
+  805dc0:	ed                   	in     (%dx),%eax
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	ed                   	in     (%dx),%eax
+  805dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dce:	00 00                	add    %al,(%rax)
+  805dd0:	ed                   	in     (%dx),%eax
+  805dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dd6:	00 00                	add    %al,(%rax)
+  805dd8:	f4                   	hlt
+  805dd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ddf:	00 ed                	add    %ch,%ch
+  805de1:	0d 80 00 00 00       	or     $0x80,%eax
+  805de6:	00 00                	add    %al,(%rax)
+  805de8:	ed                   	in     (%dx),%eax
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	2c 0b                	sub    $0xb,%al
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 ed                	add    %ch,%ch
+  805df9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dfe:	00 00                	add    %al,(%rax)
+  805e00:	ed                   	in     (%dx),%eax
+  805e01:	0d 80 00 00 00       	or     $0x80,%eax
+  805e06:	00 00                	add    %al,(%rax)
+  805e08:	ed                   	in     (%dx),%eax
+  805e09:	0d 80 00 00 00       	or     $0x80,%eax
+  805e0e:	00 00                	add    %al,(%rax)
+  805e10:	ed                   	in     (%dx),%eax
+  805e11:	0d 80 00 00 00       	or     $0x80,%eax
+  805e16:	00 00                	add    %al,(%rax)
+  805e18:	ed                   	in     (%dx),%eax
+  805e19:	0d 80 00 00 00       	or     $0x80,%eax
+  805e1e:	00 00                	add    %al,(%rax)
+  805e20:	ed                   	in     (%dx),%eax
+  805e21:	0d 80 00 00 00       	or     $0x80,%eax
+  805e26:	00 00                	add    %al,(%rax)
+  805e28:	ed                   	in     (%dx),%eax
+  805e29:	0d 80 00 00 00       	or     $0x80,%eax
+  805e2e:	00 00                	add    %al,(%rax)
+  805e30:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805e33:	00 00                	add    %al,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 cb                	add    %cl,%bl
+  805e39:	0d 80 00 00 00       	or     $0x80,%eax
+  805e3e:	00 00                	add    %al,(%rax)
+  805e40:	ed                   	in     (%dx),%eax
+  805e41:	0d 80 00 00 00       	or     $0x80,%eax
+  805e46:	00 00                	add    %al,(%rax)
+  805e48:	ed                   	in     (%dx),%eax
+  805e49:	0d 80 00 00 00       	or     $0x80,%eax
+  805e4e:	00 00                	add    %al,(%rax)
+  805e50:	ed                   	in     (%dx),%eax
+  805e51:	0d 80 00 00 00       	or     $0x80,%eax
+  805e56:	00 00                	add    %al,(%rax)
+  805e58:	6a 0a                	push   $0xa
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 ed                	add    %ch,%ch
+  805e69:	0d 80 00 00 00       	or     $0x80,%eax
+  805e6e:	00 00                	add    %al,(%rax)
+  805e70:	ed                   	in     (%dx),%eax
+  805e71:	0d 80 00 00 00       	or     $0x80,%eax
+  805e76:	00 00                	add    %al,(%rax)
+  805e78:	3c 0a                	cmp    $0xa,%al
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 ed                	add    %ch,%ch
+  805e81:	0d 80 00 00 00       	or     $0x80,%eax
+  805e86:	00 00                	add    %al,(%rax)
+  805e88:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805e8b:	00 00                	add    %al,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 29                	add    %ch,(%rcx)
+  805e99:	0c 80                	or     $0x80,%al
+  805e9b:	00 00                	add    %al,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 ed                	add    %ch,%ch
+  805ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eae:	00 00                	add    %al,(%rax)
+  805eb0:	1a 0b                	sbb    (%rbx),%cl
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 ed                	add    %ch,%ch
+  805eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ebe:	00 00                	add    %al,(%rax)
+  805ec0:	ce                   	(bad)
+  805ec1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ec7:	00 ed                	add    %ch,%ch
+  805ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ece:	00 00                	add    %al,(%rax)
+  805ed0:	ed                   	in     (%dx),%eax
+  805ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ed6:	00 00                	add    %al,(%rax)
+  805ed8:	f4                   	hlt
+  805ed9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805edf:	00 37                	add    %dh,(%rdi)
+  805ee1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 37                	add    %dh,(%rdi)
+  805ef1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ef7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805f0b:	00 00                	add    %al,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 d2                	add    %dl,%dl
+  805f11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f17:	00 d2                	add    %dl,%dl
+  805f19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f1f:	00 d2                	add    %dl,%dl
+  805f21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f27:	00 d2                	add    %dl,%dl
+  805f29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f2f:	00 d2                	add    %dl,%dl
+  805f31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f37:	00 d2                	add    %dl,%dl
+  805f39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f3f:	00 d2                	add    %dl,%dl
+  805f41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f47:	00 f6                	add    %dh,%dh
+  805f49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f4f:	00 f6                	add    %dh,%dh
+  805f51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f5a:	80 00 00             	addb   $0x0,(%rax)
+  805f5d:	00 00                	add    %al,(%rax)
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f72:	80 00 00             	addb   $0x0,(%rax)
+  805f75:	00 00                	add    %al,(%rax)
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f8a:	80 00 00             	addb   $0x0,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 22                	add    %ah,(%rdx)
+  805f91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f97:	00 22                	add    %ah,(%rdx)
+  805f99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f9f:	00 22                	add    %ah,(%rdx)
+  805fa1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fa7:	00 22                	add    %ah,(%rdx)
+  805fa9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805faf:	00 22                	add    %ah,(%rdx)
+  805fb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fb7:	00 22                	add    %ah,(%rdx)
+  805fb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fc2:	80 00 00             	addb   $0x0,(%rax)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fd2:	80 00 00             	addb   $0x0,(%rax)
+  805fd5:	00 00                	add    %al,(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ffa:	80 00 00             	addb   $0x0,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806012:	80 00 00             	addb   $0x0,(%rax)
+  806015:	00 00                	add    %al,(%rax)
+  806017:	00 5f 12             	add    %bl,0x12(%rdi)
+  80601a:	80 00 00             	addb   $0x0,(%rax)
+  80601d:	00 00                	add    %al,(%rax)
+  80601f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 5f 12             	add    %bl,0x12(%rdi)
+  80602a:	80 00 00             	addb   $0x0,(%rax)
+  80602d:	00 00                	add    %al,(%rax)
+  80602f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806032:	80 00 00             	addb   $0x0,(%rax)
+  806035:	00 00                	add    %al,(%rax)
+  806037:	00 5f 12             	add    %bl,0x12(%rdi)
+  80603a:	80 00 00             	addb   $0x0,(%rax)
+  80603d:	00 00                	add    %al,(%rax)
+  80603f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806042:	80 00 00             	addb   $0x0,(%rax)
+  806045:	00 00                	add    %al,(%rax)
+  806047:	00 46 12             	add    %al,0x12(%rsi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806052:	80 00 00             	addb   $0x0,(%rax)
+  806055:	00 00                	add    %al,(%rax)
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 5f 12             	add    %bl,0x12(%rdi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 22                	add    %ah,(%rdx)
+  806091:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806097:	00 22                	add    %ah,(%rdx)
+  806099:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80609f:	00 22                	add    %ah,(%rdx)
+  8060a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060a7:	00 22                	add    %ah,(%rdx)
+  8060a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060af:	00 22                	add    %ah,(%rdx)
+  8060b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060b7:	00 22                	add    %ah,(%rdx)
+  8060b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060c2:	80 00 00             	addb   $0x0,(%rax)
+  8060c5:	00 00                	add    %al,(%rax)
+  8060c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ca:	80 00 00             	addb   $0x0,(%rax)
+  8060cd:	00 00                	add    %al,(%rax)
+  8060cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060d2:	80 00 00             	addb   $0x0,(%rax)
+  8060d5:	00 00                	add    %al,(%rax)
+  8060d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060da:	80 00 00             	addb   $0x0,(%rax)
+  8060dd:	00 00                	add    %al,(%rax)
+  8060df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060e2:	80 00 00             	addb   $0x0,(%rax)
+  8060e5:	00 00                	add    %al,(%rax)
+  8060e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ea:	80 00 00             	addb   $0x0,(%rax)
+  8060ed:	00 00                	add    %al,(%rax)
+  8060ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060f2:	80 00 00             	addb   $0x0,(%rax)
+  8060f5:	00 00                	add    %al,(%rax)
+  8060f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060fa:	80 00 00             	addb   $0x0,(%rax)
+  8060fd:	00 00                	add    %al,(%rax)
+  8060ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806102:	80 00 00             	addb   $0x0,(%rax)
+  806105:	00 00                	add    %al,(%rax)
+  806107:	00 5f 12             	add    %bl,0x12(%rdi)
+  80610a:	80 00 00             	addb   $0x0,(%rax)
+  80610d:	00 00                	add    %al,(%rax)
+  80610f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806112:	80 00 00             	addb   $0x0,(%rax)
+  806115:	00 00                	add    %al,(%rax)
+  806117:	00 5f 12             	add    %bl,0x12(%rdi)
+  80611a:	80 00 00             	addb   $0x0,(%rax)
+  80611d:	00 00                	add    %al,(%rax)
+  80611f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806122:	80 00 00             	addb   $0x0,(%rax)
+  806125:	00 00                	add    %al,(%rax)
+  806127:	00 5f 12             	add    %bl,0x12(%rdi)
+  80612a:	80 00 00             	addb   $0x0,(%rax)
+  80612d:	00 00                	add    %al,(%rax)
+  80612f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806132:	80 00 00             	addb   $0x0,(%rax)
+  806135:	00 00                	add    %al,(%rax)
+  806137:	00 5f 12             	add    %bl,0x12(%rdi)
+  80613a:	80 00 00             	addb   $0x0,(%rax)
+  80613d:	00 00                	add    %al,(%rax)
+  80613f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806142:	80 00 00             	addb   $0x0,(%rax)
+  806145:	00 00                	add    %al,(%rax)
+  806147:	00 46 12             	add    %al,0x12(%rsi)
+  80614a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806160 <basefix.0>:
+  806160:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806170:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806180:	10 00 75 73 65 72 2f 61 6c 6c 6f 63 73 74 72 65     ..user/allocstre
+  806190:	73 73 2e 63 00 73 79 73 5f 75 6e 6d 61 70 5f 72     ss.c.sys_unmap_r
+  8061a0:	65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 61 6c     egion: %i.sys_al
+  8061b0:	6c 6f 63 5f 72 65 67 69 6f 6e 3a 20 25 69 00 61     loc_region: %i.a
+  8061c0:	6c 6c 6f 63 73 74 72 65 73 73 3a 20 4f 4b 0a 00     llocstress: OK..
+  8061d0:	61 6c 6c 6f 63 73 74 72 65 73 73 3a 20 65 6e 76     allocstress: env
+  8061e0:	20 25 64 20 73 6c 6f 74 20 25 64 20 63 6f 72 72      %d slot %d corr
+  8061f0:	75 70 74 65 64 00 3c 75 6e 6b 6e 6f 77 6e 3e 00     upted.<unknown>.
+  806200:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806210:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806220:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806230:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806240:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806250:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806260:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806270:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806280:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806290:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8062a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8062b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8062c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8062d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8062e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8062f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806300:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806310:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806320:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806330:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806340:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806350:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806360:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806370:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806380:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806390:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8063a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8063b0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  8063c0:	36 1c 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     6........"......
+  8063d0:	7d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     }"......."......
+  8063e0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8063f0:	8d 22 80 00 00 00 00 00 55 1c 80 00 00 00 00 00     ."......U.......
+  806400:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806410:	49 1c 80 00 00 00 00 00 c3 1c 80 00 00 00 00 00     I...............
+  806420:	8d 22 80 00 00 00 00 00 49 1c 80 00 00 00 00 00     ."......I.......
+  806430:	8f 1c 80 00 00 00 00 00 8f 1c 80 00 00 00 00 00     ................
+  806440:	8f 1c 80 00 00 00 00 00 8f 1c 80 00 00 00 00 00     ................
+  806450:	8f 1c 80 00 00 00 00 00 8f 1c 80 00 00 00 00 00     ................
+  806460:	8f 1c 80 00 00 00 00 00 8f 1c 80 00 00 00 00 00     ................
+  806470:	8f 1c 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ........."......
+  806480:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806490:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8064a0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8064b0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8064c0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8064d0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8064e0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8064f0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806500:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806510:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806520:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806530:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806540:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806550:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806560:	8d 22 80 00 00 00 00 00 ab 21 80 00 00 00 00 00     .".......!......
+  806570:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806580:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806590:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8065a0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8065b0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8065c0:	f1 1c 80 00 00 00 00 00 c0 1e 80 00 00 00 00 00     ................
+  8065d0:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  8065e0:	8d 22 80 00 00 00 00 00 e6 1c 80 00 00 00 00 00     ."..............
+  8065f0:	20 1d 80 00 00 00 00 00 8d 22 80 00 00 00 00 00      ........"......
+  806600:	8d 22 80 00 00 00 00 00 db 1c 80 00 00 00 00 00     ."..............
+  806610:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806620:	69 20 80 00 00 00 00 00 38 21 80 00 00 00 00 00     i ......8!......
+  806630:	8d 22 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ."......."......
+  806640:	b7 1d 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ........."......
+  806650:	94 1f 80 00 00 00 00 00 8d 22 80 00 00 00 00 00     ........."......
+  806660:	8d 22 80 00 00 00 00 00 ab 21 80 00 00 00 00 00     .".......!......
+  806670:	8d 22 80 00 00 00 00 00 3f 1c 80 00 00 00 00 00     ."......?.......
+
+0000000000806680 <error_string>:
+	...
+  806688:	55 62 80 00 00 00 00 00 67 62 80 00 00 00 00 00     Ub......gb......
+  806698:	77 62 80 00 00 00 00 00 89 62 80 00 00 00 00 00     wb.......b......
+  8066a8:	97 62 80 00 00 00 00 00 ab 62 80 00 00 00 00 00     .b.......b......
+  8066b8:	c0 62 80 00 00 00 00 00 d3 62 80 00 00 00 00 00     .b.......b......
+  8066c8:	e5 62 80 00 00 00 00 00 f9 62 80 00 00 00 00 00     .b.......b......
+  8066d8:	09 63 80 00 00 00 00 00 1c 63 80 00 00 00 00 00     .c.......c......
+  8066e8:	33 63 80 00 00 00 00 00 49 63 80 00 00 00 00 00     3c......Ic......
+  8066f8:	61 63 80 00 00 00 00 00 79 63 80 00 00 00 00 00     ac......yc......
+  806708:	86 63 80 00 00 00 00 00 20 67 80 00 00 00 00 00     .c...... g......
+  806718:	9a 63 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .c......file is 
+  806728:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806738:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806748:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806758:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806768:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806778:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806788:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806798:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8067a8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8067b8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8067c8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8067d8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  8067e8:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  8067f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806808:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806818:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806828:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806838:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806848:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806858:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806868:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806878:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806880 <devtab>:
+  806880:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806890:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8068a0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8068b0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8068c0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8068d0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8068e0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8068f0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806900:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806910:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806920:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806930:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806940:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  806950:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  806960:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  806970:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  806980:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  806990:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8069a0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8069b0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8069c0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8069d0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8069e0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8069f0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806a00:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,10312 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 5a 22 80 00 00 	movabs $0x80225a,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 db 20 80 00 00 	movabs $0x8020db,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 1b 32 80 00 00 	movabs $0x80321b,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 1b 32 80 00 00 	movabs $0x80321b,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 1d 16 80 00 00 	movabs $0x80161d,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 70 5c 80 00 00 	movabs $0x805c70,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 7a 20 80 00 00 	movabs $0x80207a,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 84 39 80 00 00 	movabs $0x803984,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be a8 56 80 00 00 	movabs $0x8056a8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 7a 20 80 00 00 	movabs $0x80207a,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 84 39 80 00 00 	movabs $0x803984,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be aa 56 80 00 00 	movabs $0x8056aa,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 7a 20 80 00 00 	movabs $0x80207a,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 84 39 80 00 00 	movabs $0x803984,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be ad 56 80 00 00 	movabs $0x8056ad,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 7a 20 80 00 00 	movabs $0x80207a,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 84 39 80 00 00 	movabs $0x803984,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 ef 49 80 00 00 	movabs $0x8049ef,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 c6 4c 80 00 00 	movabs $0x804cc6,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 6e 2f 80 00 00 	movabs $0x802f6e,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 05 33 80 00 00 	movabs $0x803305,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 ce 33 80 00 00 	movabs $0x8033ce,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 ec 30 80 00 00 	movabs $0x8030ec,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 1b 32 80 00 00 	movabs $0x80321b,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 84 39 80 00 00 	movabs $0x803984,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 6e 2f 80 00 00 	movabs $0x802f6e,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 27 22 80 00 00 	movabs $0x802227,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 27 22 80 00 00 	movabs $0x802227,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 5a 22 80 00 00 	movabs $0x80225a,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 27 22 80 00 00 	movabs $0x802227,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 59 80 00 00 	movabs $0x805960,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 27 22 80 00 00 	movabs $0x802227,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 27 22 80 00 00 	movabs $0x802227,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 7f 24 80 00 00 	movabs $0x80247f,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 7f 24 80 00 00 	movabs $0x80247f,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 09 00 00 00       	call   801508 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    /* Try to load the kernel's TSS selector into the DS register. */
+    asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  801501:	66 b8 38 00          	mov    $0x38,%ax
+  801505:	8e d8                	mov    %eax,%ds
+}
+  801507:	c3                   	ret
+
+0000000000801508 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801508:	55                   	push   %rbp
+  801509:	48 89 e5             	mov    %rsp,%rbp
+  80150c:	41 56                	push   %r14
+  80150e:	41 55                	push   %r13
+  801510:	41 54                	push   %r12
+  801512:	53                   	push   %rbx
+  801513:	41 89 fd             	mov    %edi,%r13d
+  801516:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801519:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801520:	00 00 00 
+  801523:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80152a:	00 00 00 
+  80152d:	48 39 c2             	cmp    %rax,%rdx
+  801530:	73 17                	jae    801549 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801532:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801535:	49 89 c4             	mov    %rax,%r12
+  801538:	48 83 c3 08          	add    $0x8,%rbx
+  80153c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801541:	ff 53 f8             	call   *-0x8(%rbx)
+  801544:	4c 39 e3             	cmp    %r12,%rbx
+  801547:	72 ef                	jb     801538 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801549:	48 b8 45 26 80 00 00 	movabs $0x802645,%rax
+  801550:	00 00 00 
+  801553:	ff d0                	call   *%rax
+  801555:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80155a:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801561:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801568:	00 00 00 
+  80156b:	48 01 d0             	add    %rdx,%rax
+  80156e:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801575:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801578:	45 85 ed             	test   %r13d,%r13d
+  80157b:	7e 0d                	jle    80158a <libmain+0x82>
+  80157d:	49 8b 06             	mov    (%r14),%rax
+  801580:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801587:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80158a:	4c 89 f6             	mov    %r14,%rsi
+  80158d:	44 89 ef             	mov    %r13d,%edi
+  801590:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801597:	00 00 00 
+  80159a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80159c:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8015a3:	00 00 00 
+  8015a6:	ff d0                	call   *%rax
+#endif
+}
+  8015a8:	5b                   	pop    %rbx
+  8015a9:	41 5c                	pop    %r12
+  8015ab:	41 5d                	pop    %r13
+  8015ad:	41 5e                	pop    %r14
+  8015af:	5d                   	pop    %rbp
+  8015b0:	c3                   	ret
+
+00000000008015b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015b1:	55                   	push   %rbp
+  8015b2:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015b5:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  8015bc:	00 00 00 
+  8015bf:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c6:	48 b8 d4 25 80 00 00 	movabs $0x8025d4,%rax
+  8015cd:	00 00 00 
+  8015d0:	ff d0                	call   *%rax
+}
+  8015d2:	5d                   	pop    %rbp
+  8015d3:	c3                   	ret
+
+00000000008015d4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015d4:	55                   	push   %rbp
+  8015d5:	48 89 e5             	mov    %rsp,%rbp
+  8015d8:	53                   	push   %rbx
+  8015d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015dd:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015e0:	8b 06                	mov    (%rsi),%eax
+  8015e2:	8d 50 01             	lea    0x1(%rax),%edx
+  8015e5:	89 16                	mov    %edx,(%rsi)
+  8015e7:	48 98                	cltq
+  8015e9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8015ee:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8015f4:	74 0a                	je     801600 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8015f6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8015fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fe:	c9                   	leave
+  8015ff:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801600:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801604:	be ff 00 00 00       	mov    $0xff,%esi
+  801609:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  801610:	00 00 00 
+  801613:	ff d0                	call   *%rax
+        state->offset = 0;
+  801615:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80161b:	eb d9                	jmp    8015f6 <putch+0x22>
+
+000000000080161d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80161d:	55                   	push   %rbp
+  80161e:	48 89 e5             	mov    %rsp,%rbp
+  801621:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801628:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80162b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801632:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80163f:	48 89 f1             	mov    %rsi,%rcx
+  801642:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801649:	48 bf d4 15 80 00 00 	movabs $0x8015d4,%rdi
+  801650:	00 00 00 
+  801653:	48 b8 d1 17 80 00 00 	movabs $0x8017d1,%rax
+  80165a:	00 00 00 
+  80165d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80165f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801666:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80166d:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  801674:	00 00 00 
+  801677:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801679:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+
+0000000000801681 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801681:	55                   	push   %rbp
+  801682:	48 89 e5             	mov    %rsp,%rbp
+  801685:	48 83 ec 50          	sub    $0x50,%rsp
+  801689:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80168d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801691:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801695:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801699:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80169d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016ac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016b4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016b8:	48 b8 1d 16 80 00 00 	movabs $0x80161d,%rax
+  8016bf:	00 00 00 
+  8016c2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016c4:	c9                   	leave
+  8016c5:	c3                   	ret
+
+00000000008016c6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016c6:	55                   	push   %rbp
+  8016c7:	48 89 e5             	mov    %rsp,%rbp
+  8016ca:	41 57                	push   %r15
+  8016cc:	41 56                	push   %r14
+  8016ce:	41 55                	push   %r13
+  8016d0:	41 54                	push   %r12
+  8016d2:	53                   	push   %rbx
+  8016d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8016d7:	49 89 fc             	mov    %rdi,%r12
+  8016da:	49 89 f5             	mov    %rsi,%r13
+  8016dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016e1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8016e4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8016e7:	41 89 cf             	mov    %ecx,%r15d
+  8016ea:	4c 39 fa             	cmp    %r15,%rdx
+  8016ed:	73 5b                	jae    80174a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8016ef:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8016f3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8016f7:	85 db                	test   %ebx,%ebx
+  8016f9:	7e 0e                	jle    801709 <print_num+0x43>
+            putch(padc, put_arg);
+  8016fb:	4c 89 ee             	mov    %r13,%rsi
+  8016fe:	44 89 f7             	mov    %r14d,%edi
+  801701:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801704:	83 eb 01             	sub    $0x1,%ebx
+  801707:	75 f2                	jne    8016fb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801709:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80170d:	48 b9 1d 5c 80 00 00 	movabs $0x805c1d,%rcx
+  801714:	00 00 00 
+  801717:	48 b8 0c 5c 80 00 00 	movabs $0x805c0c,%rax
+  80171e:	00 00 00 
+  801721:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801725:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801729:	ba 00 00 00 00       	mov    $0x0,%edx
+  80172e:	49 f7 f7             	div    %r15
+  801731:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801735:	4c 89 ee             	mov    %r13,%rsi
+  801738:	41 ff d4             	call   *%r12
+}
+  80173b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80173f:	5b                   	pop    %rbx
+  801740:	41 5c                	pop    %r12
+  801742:	41 5d                	pop    %r13
+  801744:	41 5e                	pop    %r14
+  801746:	41 5f                	pop    %r15
+  801748:	5d                   	pop    %rbp
+  801749:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80174a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801753:	49 f7 f7             	div    %r15
+  801756:	48 83 ec 08          	sub    $0x8,%rsp
+  80175a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80175e:	52                   	push   %rdx
+  80175f:	45 0f be c9          	movsbl %r9b,%r9d
+  801763:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801767:	48 89 c2             	mov    %rax,%rdx
+  80176a:	48 b8 c6 16 80 00 00 	movabs $0x8016c6,%rax
+  801771:	00 00 00 
+  801774:	ff d0                	call   *%rax
+  801776:	48 83 c4 10          	add    $0x10,%rsp
+  80177a:	eb 8d                	jmp    801709 <print_num+0x43>
+
+000000000080177c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80177c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801780:	48 8b 06             	mov    (%rsi),%rax
+  801783:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801787:	73 0a                	jae    801793 <sprintputch+0x17>
+        *state->start++ = ch;
+  801789:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80178d:	48 89 16             	mov    %rdx,(%rsi)
+  801790:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801793:	c3                   	ret
+
+0000000000801794 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801794:	55                   	push   %rbp
+  801795:	48 89 e5             	mov    %rsp,%rbp
+  801798:	48 83 ec 50          	sub    $0x50,%rsp
+  80179c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017a0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017a4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017a8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017b7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017bb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017bf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017c3:	48 b8 d1 17 80 00 00 	movabs $0x8017d1,%rax
+  8017ca:	00 00 00 
+  8017cd:	ff d0                	call   *%rax
+}
+  8017cf:	c9                   	leave
+  8017d0:	c3                   	ret
+
+00000000008017d1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017d1:	55                   	push   %rbp
+  8017d2:	48 89 e5             	mov    %rsp,%rbp
+  8017d5:	41 57                	push   %r15
+  8017d7:	41 56                	push   %r14
+  8017d9:	41 55                	push   %r13
+  8017db:	41 54                	push   %r12
+  8017dd:	53                   	push   %rbx
+  8017de:	48 83 ec 38          	sub    $0x38,%rsp
+  8017e2:	49 89 fe             	mov    %rdi,%r14
+  8017e5:	49 89 f5             	mov    %rsi,%r13
+  8017e8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8017eb:	48 8b 01             	mov    (%rcx),%rax
+  8017ee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8017f2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8017f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017fa:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8017fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801802:	eb 0d                	jmp    801811 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801804:	40 0f b6 ff          	movzbl %dil,%edi
+  801808:	4c 89 ee             	mov    %r13,%rsi
+  80180b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80180e:	4c 89 e3             	mov    %r12,%rbx
+  801811:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801815:	0f b6 3b             	movzbl (%rbx),%edi
+  801818:	40 80 ff 25          	cmp    $0x25,%dil
+  80181c:	74 14                	je     801832 <vprintfmt+0x61>
+            if (!ch) return;
+  80181e:	40 84 ff             	test   %dil,%dil
+  801821:	75 e1                	jne    801804 <vprintfmt+0x33>
+}
+  801823:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801827:	5b                   	pop    %rbx
+  801828:	41 5c                	pop    %r12
+  80182a:	41 5d                	pop    %r13
+  80182c:	41 5e                	pop    %r14
+  80182e:	41 5f                	pop    %r15
+  801830:	5d                   	pop    %rbp
+  801831:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801832:	be 00 00 00 00       	mov    $0x0,%esi
+  801837:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80183b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801840:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801846:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80184d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801851:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801856:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80185b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80185e:	83 e8 23             	sub    $0x23,%eax
+  801861:	3c 57                	cmp    $0x57,%al
+  801863:	0f 87 67 06 00 00    	ja     801ed0 <vprintfmt+0x6ff>
+  801869:	0f b6 c0             	movzbl %al,%eax
+  80186c:	48 b9 a0 5d 80 00 00 	movabs $0x805da0,%rcx
+  801873:	00 00 00 
+  801876:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801879:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80187c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801880:	eb cf                	jmp    801851 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801882:	49 89 dc             	mov    %rbx,%r12
+  801885:	be 01 00 00 00       	mov    $0x1,%esi
+  80188a:	eb c5                	jmp    801851 <vprintfmt+0x80>
+            padc = ch;
+  80188c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801890:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801893:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801896:	eb b9                	jmp    801851 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801898:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80189b:	83 f8 2f             	cmp    $0x2f,%eax
+  80189e:	77 24                	ja     8018c4 <vprintfmt+0xf3>
+  8018a0:	89 c1                	mov    %eax,%ecx
+  8018a2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018a6:	83 c0 08             	add    $0x8,%eax
+  8018a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018ac:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018af:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018b2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018b6:	79 99                	jns    801851 <vprintfmt+0x80>
+                width = precision;
+  8018b8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018bc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018c2:	eb 8d                	jmp    801851 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018c4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018c8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018d0:	eb da                	jmp    8018ac <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018d2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018d7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018db:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018e1:	3c 39                	cmp    $0x39,%al
+  8018e3:	77 1c                	ja     801901 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8018e5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8018e9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8018ed:	0f b6 c0             	movzbl %al,%eax
+  8018f0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018f5:	0f b6 03             	movzbl (%rbx),%eax
+  8018f8:	3c 39                	cmp    $0x39,%al
+  8018fa:	76 e9                	jbe    8018e5 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8018fc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8018ff:	eb b1                	jmp    8018b2 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801901:	49 89 dc             	mov    %rbx,%r12
+  801904:	eb ac                	jmp    8018b2 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801906:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801909:	85 c9                	test   %ecx,%ecx
+  80190b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801910:	0f 49 c1             	cmovns %ecx,%eax
+  801913:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801916:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801919:	e9 33 ff ff ff       	jmp    801851 <vprintfmt+0x80>
+            lflag++;
+  80191e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801921:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801924:	e9 28 ff ff ff       	jmp    801851 <vprintfmt+0x80>
+            lflag--;
+  801929:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80192c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80192f:	e9 1d ff ff ff       	jmp    801851 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801934:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801937:	83 f8 2f             	cmp    $0x2f,%eax
+  80193a:	77 19                	ja     801955 <vprintfmt+0x184>
+  80193c:	89 c2                	mov    %eax,%edx
+  80193e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801942:	83 c0 08             	add    $0x8,%eax
+  801945:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801948:	8b 3a                	mov    (%rdx),%edi
+  80194a:	4c 89 ee             	mov    %r13,%rsi
+  80194d:	41 ff d6             	call   *%r14
+            break;
+  801950:	e9 bc fe ff ff       	jmp    801811 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801955:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801959:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80195d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801961:	eb e5                	jmp    801948 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801966:	83 f8 2f             	cmp    $0x2f,%eax
+  801969:	77 5a                	ja     8019c5 <vprintfmt+0x1f4>
+  80196b:	89 c2                	mov    %eax,%edx
+  80196d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801971:	83 c0 08             	add    $0x8,%eax
+  801974:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801977:	8b 02                	mov    (%rdx),%eax
+  801979:	89 c1                	mov    %eax,%ecx
+  80197b:	f7 d9                	neg    %ecx
+  80197d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801980:	83 f9 13             	cmp    $0x13,%ecx
+  801983:	7f 4e                	jg     8019d3 <vprintfmt+0x202>
+  801985:	48 63 c1             	movslq %ecx,%rax
+  801988:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  80198f:	00 00 00 
+  801992:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801996:	48 85 c0             	test   %rax,%rax
+  801999:	74 38                	je     8019d3 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  80199b:	48 89 c1             	mov    %rax,%rcx
+  80199e:	48 ba 28 62 80 00 00 	movabs $0x806228,%rdx
+  8019a5:	00 00 00 
+  8019a8:	4c 89 ee             	mov    %r13,%rsi
+  8019ab:	4c 89 f7             	mov    %r14,%rdi
+  8019ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b3:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  8019ba:	00 00 00 
+  8019bd:	41 ff d0             	call   *%r8
+  8019c0:	e9 4c fe ff ff       	jmp    801811 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019d1:	eb a4                	jmp    801977 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019d3:	48 ba 35 5c 80 00 00 	movabs $0x805c35,%rdx
+  8019da:	00 00 00 
+  8019dd:	4c 89 ee             	mov    %r13,%rsi
+  8019e0:	4c 89 f7             	mov    %r14,%rdi
+  8019e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e8:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  8019ef:	00 00 00 
+  8019f2:	41 ff d0             	call   *%r8
+  8019f5:	e9 17 fe ff ff       	jmp    801811 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8019fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019fd:	83 f8 2f             	cmp    $0x2f,%eax
+  801a00:	77 6c                	ja     801a6e <vprintfmt+0x29d>
+  801a02:	89 c2                	mov    %eax,%edx
+  801a04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a08:	83 c0 08             	add    $0x8,%eax
+  801a0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a0e:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a11:	48 85 f6             	test   %rsi,%rsi
+  801a14:	48 b8 2e 5c 80 00 00 	movabs $0x805c2e,%rax
+  801a1b:	00 00 00 
+  801a1e:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a22:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a26:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a2a:	7e 06                	jle    801a32 <vprintfmt+0x261>
+  801a2c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a30:	75 4a                	jne    801a7c <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a32:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a36:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a3a:	0f b6 00             	movzbl (%rax),%eax
+  801a3d:	84 c0                	test   %al,%al
+  801a3f:	0f 85 9a 00 00 00    	jne    801adf <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a45:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a48:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	0f 8e bd fd ff ff    	jle    801811 <vprintfmt+0x40>
+  801a54:	4c 89 ee             	mov    %r13,%rsi
+  801a57:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a5c:	41 ff d6             	call   *%r14
+  801a5f:	41 83 ec 01          	sub    $0x1,%r12d
+  801a63:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a67:	75 eb                	jne    801a54 <vprintfmt+0x283>
+  801a69:	e9 a3 fd ff ff       	jmp    801811 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a7a:	eb 92                	jmp    801a0e <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a7c:	49 63 f7             	movslq %r15d,%rsi
+  801a7f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801a83:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  801a8a:	00 00 00 
+  801a8d:	ff d0                	call   *%rax
+  801a8f:	48 89 c2             	mov    %rax,%rdx
+  801a92:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a95:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801a97:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801a9a:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	7e 91                	jle    801a32 <vprintfmt+0x261>
+  801aa1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801aa6:	4c 89 ee             	mov    %r13,%rsi
+  801aa9:	44 89 e7             	mov    %r12d,%edi
+  801aac:	41 ff d6             	call   *%r14
+  801aaf:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ab3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ab9:	75 eb                	jne    801aa6 <vprintfmt+0x2d5>
+  801abb:	e9 72 ff ff ff       	jmp    801a32 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ac0:	0f b6 f8             	movzbl %al,%edi
+  801ac3:	4c 89 ee             	mov    %r13,%rsi
+  801ac6:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ac9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801acd:	49 83 c4 01          	add    $0x1,%r12
+  801ad1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ad7:	84 c0                	test   %al,%al
+  801ad9:	0f 84 66 ff ff ff    	je     801a45 <vprintfmt+0x274>
+  801adf:	45 85 ff             	test   %r15d,%r15d
+  801ae2:	78 0a                	js     801aee <vprintfmt+0x31d>
+  801ae4:	41 83 ef 01          	sub    $0x1,%r15d
+  801ae8:	0f 88 57 ff ff ff    	js     801a45 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801aee:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801af2:	74 cc                	je     801ac0 <vprintfmt+0x2ef>
+  801af4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801af7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801afc:	80 fa 5e             	cmp    $0x5e,%dl
+  801aff:	77 c2                	ja     801ac3 <vprintfmt+0x2f2>
+  801b01:	eb bd                	jmp    801ac0 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b03:	40 84 f6             	test   %sil,%sil
+  801b06:	75 26                	jne    801b2e <vprintfmt+0x35d>
+    switch (lflag) {
+  801b08:	85 d2                	test   %edx,%edx
+  801b0a:	74 59                	je     801b65 <vprintfmt+0x394>
+  801b0c:	83 fa 01             	cmp    $0x1,%edx
+  801b0f:	74 7b                	je     801b8c <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b14:	83 f8 2f             	cmp    $0x2f,%eax
+  801b17:	0f 87 96 00 00 00    	ja     801bb3 <vprintfmt+0x3e2>
+  801b1d:	89 c2                	mov    %eax,%edx
+  801b1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b23:	83 c0 08             	add    $0x8,%eax
+  801b26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b29:	4c 8b 22             	mov    (%rdx),%r12
+  801b2c:	eb 17                	jmp    801b45 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b31:	83 f8 2f             	cmp    $0x2f,%eax
+  801b34:	77 21                	ja     801b57 <vprintfmt+0x386>
+  801b36:	89 c2                	mov    %eax,%edx
+  801b38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b3c:	83 c0 08             	add    $0x8,%eax
+  801b3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b42:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b45:	4d 85 e4             	test   %r12,%r12
+  801b48:	78 7a                	js     801bc4 <vprintfmt+0x3f3>
+            num = i;
+  801b4a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b4d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b52:	e9 56 02 00 00       	jmp    801dad <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b63:	eb dd                	jmp    801b42 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b68:	83 f8 2f             	cmp    $0x2f,%eax
+  801b6b:	77 11                	ja     801b7e <vprintfmt+0x3ad>
+  801b6d:	89 c2                	mov    %eax,%edx
+  801b6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b73:	83 c0 08             	add    $0x8,%eax
+  801b76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b79:	4c 63 22             	movslq (%rdx),%r12
+  801b7c:	eb c7                	jmp    801b45 <vprintfmt+0x374>
+  801b7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b8a:	eb ed                	jmp    801b79 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801b8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8f:	83 f8 2f             	cmp    $0x2f,%eax
+  801b92:	77 11                	ja     801ba5 <vprintfmt+0x3d4>
+  801b94:	89 c2                	mov    %eax,%edx
+  801b96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b9a:	83 c0 08             	add    $0x8,%eax
+  801b9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ba0:	4c 8b 22             	mov    (%rdx),%r12
+  801ba3:	eb a0                	jmp    801b45 <vprintfmt+0x374>
+  801ba5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bb1:	eb ed                	jmp    801ba0 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbf:	e9 65 ff ff ff       	jmp    801b29 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bc4:	4c 89 ee             	mov    %r13,%rsi
+  801bc7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bcc:	41 ff d6             	call   *%r14
+                i = -i;
+  801bcf:	49 f7 dc             	neg    %r12
+  801bd2:	e9 73 ff ff ff       	jmp    801b4a <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bd7:	40 84 f6             	test   %sil,%sil
+  801bda:	75 2e                	jne    801c0a <vprintfmt+0x439>
+    switch (lflag) {
+  801bdc:	85 d2                	test   %edx,%edx
+  801bde:	7f 59                	jg     801c39 <vprintfmt+0x468>
+  801be0:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801be3:	7d 7a                	jge    801c5f <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801be5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801be8:	83 f8 2f             	cmp    $0x2f,%eax
+  801beb:	0f 87 aa 00 00 00    	ja     801c9b <vprintfmt+0x4ca>
+  801bf1:	89 c2                	mov    %eax,%edx
+  801bf3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bf7:	83 c0 08             	add    $0x8,%eax
+  801bfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bfd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c00:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c05:	e9 a3 01 00 00       	jmp    801dad <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c0d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c10:	77 19                	ja     801c2b <vprintfmt+0x45a>
+  801c12:	89 c2                	mov    %eax,%edx
+  801c14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c18:	83 c0 08             	add    $0x8,%eax
+  801c1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c1e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c21:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c26:	e9 82 01 00 00       	jmp    801dad <vprintfmt+0x5dc>
+  801c2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c37:	eb e5                	jmp    801c1e <vprintfmt+0x44d>
+    switch (lflag) {
+  801c39:	83 fa 01             	cmp    $0x1,%edx
+  801c3c:	75 a7                	jne    801be5 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c41:	83 f8 2f             	cmp    $0x2f,%eax
+  801c44:	77 47                	ja     801c8d <vprintfmt+0x4bc>
+  801c46:	89 c2                	mov    %eax,%edx
+  801c48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c4c:	83 c0 08             	add    $0x8,%eax
+  801c4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c52:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c55:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c5a:	e9 4e 01 00 00       	jmp    801dad <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c62:	83 f8 2f             	cmp    $0x2f,%eax
+  801c65:	77 18                	ja     801c7f <vprintfmt+0x4ae>
+  801c67:	89 c2                	mov    %eax,%edx
+  801c69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c6d:	83 c0 08             	add    $0x8,%eax
+  801c70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c73:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c75:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c7a:	e9 2e 01 00 00       	jmp    801dad <vprintfmt+0x5dc>
+  801c7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c8b:	eb e6                	jmp    801c73 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801c8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c99:	eb b7                	jmp    801c52 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801c9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca7:	e9 51 ff ff ff       	jmp    801bfd <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cac:	40 84 f6             	test   %sil,%sil
+  801caf:	75 2e                	jne    801cdf <vprintfmt+0x50e>
+    switch (lflag) {
+  801cb1:	85 d2                	test   %edx,%edx
+  801cb3:	7f 59                	jg     801d0e <vprintfmt+0x53d>
+  801cb5:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cb8:	7d 77                	jge    801d31 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cbd:	83 f8 2f             	cmp    $0x2f,%eax
+  801cc0:	0f 87 a4 00 00 00    	ja     801d6a <vprintfmt+0x599>
+  801cc6:	89 c2                	mov    %eax,%edx
+  801cc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ccc:	83 c0 08             	add    $0x8,%eax
+  801ccf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cd2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cd5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cda:	e9 ce 00 00 00       	jmp    801dad <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cdf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ce2:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce5:	77 19                	ja     801d00 <vprintfmt+0x52f>
+  801ce7:	89 c2                	mov    %eax,%edx
+  801ce9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ced:	83 c0 08             	add    $0x8,%eax
+  801cf0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cf6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801cfb:	e9 ad 00 00 00       	jmp    801dad <vprintfmt+0x5dc>
+  801d00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d0c:	eb e5                	jmp    801cf3 <vprintfmt+0x522>
+    switch (lflag) {
+  801d0e:	83 fa 01             	cmp    $0x1,%edx
+  801d11:	75 a7                	jne    801cba <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d16:	83 f8 2f             	cmp    $0x2f,%eax
+  801d19:	77 41                	ja     801d5c <vprintfmt+0x58b>
+  801d1b:	89 c2                	mov    %eax,%edx
+  801d1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d21:	83 c0 08             	add    $0x8,%eax
+  801d24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d27:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d2a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d2f:	eb 7c                	jmp    801dad <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d34:	83 f8 2f             	cmp    $0x2f,%eax
+  801d37:	77 15                	ja     801d4e <vprintfmt+0x57d>
+  801d39:	89 c2                	mov    %eax,%edx
+  801d3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d3f:	83 c0 08             	add    $0x8,%eax
+  801d42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d45:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d47:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d4c:	eb 5f                	jmp    801dad <vprintfmt+0x5dc>
+  801d4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d5a:	eb e9                	jmp    801d45 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d68:	eb bd                	jmp    801d27 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d76:	e9 57 ff ff ff       	jmp    801cd2 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d7b:	4c 89 ee             	mov    %r13,%rsi
+  801d7e:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d83:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801d86:	4c 89 ee             	mov    %r13,%rsi
+  801d89:	bf 78 00 00 00       	mov    $0x78,%edi
+  801d8e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801d91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d94:	83 f8 2f             	cmp    $0x2f,%eax
+  801d97:	77 47                	ja     801de0 <vprintfmt+0x60f>
+  801d99:	89 c2                	mov    %eax,%edx
+  801d9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9f:	83 c0 08             	add    $0x8,%eax
+  801da2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801da8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dad:	48 83 ec 08          	sub    $0x8,%rsp
+  801db1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801db5:	0f 94 c0             	sete   %al
+  801db8:	0f b6 c0             	movzbl %al,%eax
+  801dbb:	50                   	push   %rax
+  801dbc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801dc1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801dc5:	4c 89 ee             	mov    %r13,%rsi
+  801dc8:	4c 89 f7             	mov    %r14,%rdi
+  801dcb:	48 b8 c6 16 80 00 00 	movabs $0x8016c6,%rax
+  801dd2:	00 00 00 
+  801dd5:	ff d0                	call   *%rax
+            break;
+  801dd7:	48 83 c4 10          	add    $0x10,%rsp
+  801ddb:	e9 31 fa ff ff       	jmp    801811 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801de0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801de4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801de8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dec:	eb b7                	jmp    801da5 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801dee:	40 84 f6             	test   %sil,%sil
+  801df1:	75 2b                	jne    801e1e <vprintfmt+0x64d>
+    switch (lflag) {
+  801df3:	85 d2                	test   %edx,%edx
+  801df5:	7f 56                	jg     801e4d <vprintfmt+0x67c>
+  801df7:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801dfa:	7d 77                	jge    801e73 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801dfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dff:	83 f8 2f             	cmp    $0x2f,%eax
+  801e02:	0f 87 a7 00 00 00    	ja     801eaf <vprintfmt+0x6de>
+  801e08:	89 c2                	mov    %eax,%edx
+  801e0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e0e:	83 c0 08             	add    $0x8,%eax
+  801e11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e17:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e1c:	eb 8f                	jmp    801dad <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e21:	83 f8 2f             	cmp    $0x2f,%eax
+  801e24:	77 19                	ja     801e3f <vprintfmt+0x66e>
+  801e26:	89 c2                	mov    %eax,%edx
+  801e28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2c:	83 c0 08             	add    $0x8,%eax
+  801e2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e32:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e35:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e3a:	e9 6e ff ff ff       	jmp    801dad <vprintfmt+0x5dc>
+  801e3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e4b:	eb e5                	jmp    801e32 <vprintfmt+0x661>
+    switch (lflag) {
+  801e4d:	83 fa 01             	cmp    $0x1,%edx
+  801e50:	75 aa                	jne    801dfc <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e55:	83 f8 2f             	cmp    $0x2f,%eax
+  801e58:	77 47                	ja     801ea1 <vprintfmt+0x6d0>
+  801e5a:	89 c2                	mov    %eax,%edx
+  801e5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e60:	83 c0 08             	add    $0x8,%eax
+  801e63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e66:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e69:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e6e:	e9 3a ff ff ff       	jmp    801dad <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e76:	83 f8 2f             	cmp    $0x2f,%eax
+  801e79:	77 18                	ja     801e93 <vprintfmt+0x6c2>
+  801e7b:	89 c2                	mov    %eax,%edx
+  801e7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e81:	83 c0 08             	add    $0x8,%eax
+  801e84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e87:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801e89:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801e8e:	e9 1a ff ff ff       	jmp    801dad <vprintfmt+0x5dc>
+  801e93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9f:	eb e6                	jmp    801e87 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ea1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ead:	eb b7                	jmp    801e66 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801eaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ebb:	e9 54 ff ff ff       	jmp    801e14 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ec0:	4c 89 ee             	mov    %r13,%rsi
+  801ec3:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ec8:	41 ff d6             	call   *%r14
+            break;
+  801ecb:	e9 41 f9 ff ff       	jmp    801811 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ed0:	4c 89 ee             	mov    %r13,%rsi
+  801ed3:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ed8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801edb:	48 83 eb 01          	sub    $0x1,%rbx
+  801edf:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801ee3:	75 f6                	jne    801edb <vprintfmt+0x70a>
+  801ee5:	e9 27 f9 ff ff       	jmp    801811 <vprintfmt+0x40>
+
+0000000000801eea <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801eea:	55                   	push   %rbp
+  801eeb:	48 89 e5             	mov    %rsp,%rbp
+  801eee:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801ef2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ef6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801efb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801eff:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f06:	48 85 ff             	test   %rdi,%rdi
+  801f09:	74 2b                	je     801f36 <vsnprintf+0x4c>
+  801f0b:	48 85 f6             	test   %rsi,%rsi
+  801f0e:	74 26                	je     801f36 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f10:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f14:	48 bf 7c 17 80 00 00 	movabs $0x80177c,%rdi
+  801f1b:	00 00 00 
+  801f1e:	48 b8 d1 17 80 00 00 	movabs $0x8017d1,%rax
+  801f25:	00 00 00 
+  801f28:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f2e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f31:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f34:	c9                   	leave
+  801f35:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f3b:	eb f7                	jmp    801f34 <vsnprintf+0x4a>
+
+0000000000801f3d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f3d:	55                   	push   %rbp
+  801f3e:	48 89 e5             	mov    %rsp,%rbp
+  801f41:	48 83 ec 50          	sub    $0x50,%rsp
+  801f45:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f49:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f4d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f51:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f58:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f60:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f68:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f6c:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+
+0000000000801f7a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f7a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f7d:	74 10                	je     801f8f <strlen+0x15>
+    size_t n = 0;
+  801f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801f84:	48 83 c0 01          	add    $0x1,%rax
+  801f88:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801f8c:	75 f6                	jne    801f84 <strlen+0xa>
+  801f8e:	c3                   	ret
+    size_t n = 0;
+  801f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801f94:	c3                   	ret
+
+0000000000801f95 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801f95:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801f98:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801f9d:	48 85 f6             	test   %rsi,%rsi
+  801fa0:	74 11                	je     801fb3 <strnlen+0x1e>
+  801fa2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fa6:	74 0c                	je     801fb4 <strnlen+0x1f>
+  801fa8:	48 83 c2 01          	add    $0x1,%rdx
+  801fac:	48 39 d0             	cmp    %rdx,%rax
+  801faf:	75 f1                	jne    801fa2 <strnlen+0xd>
+  801fb1:	eb 04                	jmp    801fb7 <strnlen+0x22>
+  801fb3:	c3                   	ret
+  801fb4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fb7:	c3                   	ret
+
+0000000000801fb8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fb8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fc4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fc7:	48 83 c2 01          	add    $0x1,%rdx
+  801fcb:	84 c9                	test   %cl,%cl
+  801fcd:	75 f1                	jne    801fc0 <strcpy+0x8>
+        ;
+    return res;
+}
+  801fcf:	c3                   	ret
+
+0000000000801fd0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fd0:	55                   	push   %rbp
+  801fd1:	48 89 e5             	mov    %rsp,%rbp
+  801fd4:	41 54                	push   %r12
+  801fd6:	53                   	push   %rbx
+  801fd7:	48 89 fb             	mov    %rdi,%rbx
+  801fda:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801fdd:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  801fe4:	00 00 00 
+  801fe7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801fe9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801fed:	4c 89 e6             	mov    %r12,%rsi
+  801ff0:	48 b8 b8 1f 80 00 00 	movabs $0x801fb8,%rax
+  801ff7:	00 00 00 
+  801ffa:	ff d0                	call   *%rax
+    return dst;
+}
+  801ffc:	48 89 d8             	mov    %rbx,%rax
+  801fff:	5b                   	pop    %rbx
+  802000:	41 5c                	pop    %r12
+  802002:	5d                   	pop    %rbp
+  802003:	c3                   	ret
+
+0000000000802004 <toupper>:
+
+int
+toupper(int ch) {
+  802004:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802006:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802009:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80200c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80200f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802012:	c3                   	ret
+
+0000000000802013 <tolower>:
+
+int
+tolower(int ch) {
+  802013:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802015:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802018:	8d 57 20             	lea    0x20(%rdi),%edx
+  80201b:	83 f9 1a             	cmp    $0x1a,%ecx
+  80201e:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802021:	c3                   	ret
+
+0000000000802022 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802022:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802025:	48 85 d2             	test   %rdx,%rdx
+  802028:	74 1f                	je     802049 <strncpy+0x27>
+  80202a:	48 01 fa             	add    %rdi,%rdx
+  80202d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802030:	48 83 c1 01          	add    $0x1,%rcx
+  802034:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802038:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80203c:	41 80 f8 01          	cmp    $0x1,%r8b
+  802040:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802044:	48 39 ca             	cmp    %rcx,%rdx
+  802047:	75 e7                	jne    802030 <strncpy+0xe>
+    }
+    return ret;
+}
+  802049:	c3                   	ret
+
+000000000080204a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80204a:	48 89 f8             	mov    %rdi,%rax
+  80204d:	48 85 d2             	test   %rdx,%rdx
+  802050:	74 24                	je     802076 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802052:	48 83 ea 01          	sub    $0x1,%rdx
+  802056:	74 1b                	je     802073 <strlcpy+0x29>
+  802058:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80205c:	0f b6 16             	movzbl (%rsi),%edx
+  80205f:	84 d2                	test   %dl,%dl
+  802061:	74 10                	je     802073 <strlcpy+0x29>
+            *dst++ = *src++;
+  802063:	48 83 c6 01          	add    $0x1,%rsi
+  802067:	48 83 c0 01          	add    $0x1,%rax
+  80206b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80206e:	48 39 c8             	cmp    %rcx,%rax
+  802071:	75 e9                	jne    80205c <strlcpy+0x12>
+        *dst = '\0';
+  802073:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802076:	48 29 f8             	sub    %rdi,%rax
+}
+  802079:	c3                   	ret
+
+000000000080207a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80207a:	0f b6 07             	movzbl (%rdi),%eax
+  80207d:	84 c0                	test   %al,%al
+  80207f:	74 13                	je     802094 <strcmp+0x1a>
+  802081:	38 06                	cmp    %al,(%rsi)
+  802083:	75 0f                	jne    802094 <strcmp+0x1a>
+  802085:	48 83 c7 01          	add    $0x1,%rdi
+  802089:	48 83 c6 01          	add    $0x1,%rsi
+  80208d:	0f b6 07             	movzbl (%rdi),%eax
+  802090:	84 c0                	test   %al,%al
+  802092:	75 ed                	jne    802081 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802094:	0f b6 c0             	movzbl %al,%eax
+  802097:	0f b6 16             	movzbl (%rsi),%edx
+  80209a:	29 d0                	sub    %edx,%eax
+}
+  80209c:	c3                   	ret
+
+000000000080209d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80209d:	48 85 d2             	test   %rdx,%rdx
+  8020a0:	74 1f                	je     8020c1 <strncmp+0x24>
+  8020a2:	0f b6 07             	movzbl (%rdi),%eax
+  8020a5:	84 c0                	test   %al,%al
+  8020a7:	74 1e                	je     8020c7 <strncmp+0x2a>
+  8020a9:	3a 06                	cmp    (%rsi),%al
+  8020ab:	75 1a                	jne    8020c7 <strncmp+0x2a>
+  8020ad:	48 83 c7 01          	add    $0x1,%rdi
+  8020b1:	48 83 c6 01          	add    $0x1,%rsi
+  8020b5:	48 83 ea 01          	sub    $0x1,%rdx
+  8020b9:	75 e7                	jne    8020a2 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c0:	c3                   	ret
+  8020c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c6:	c3                   	ret
+  8020c7:	48 85 d2             	test   %rdx,%rdx
+  8020ca:	74 09                	je     8020d5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020cc:	0f b6 07             	movzbl (%rdi),%eax
+  8020cf:	0f b6 16             	movzbl (%rsi),%edx
+  8020d2:	29 d0                	sub    %edx,%eax
+  8020d4:	c3                   	ret
+    if (!n) return 0;
+  8020d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020da:	c3                   	ret
+
+00000000008020db <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020db:	0f b6 17             	movzbl (%rdi),%edx
+  8020de:	84 d2                	test   %dl,%dl
+  8020e0:	74 18                	je     8020fa <strchr+0x1f>
+        if (*str == c) {
+  8020e2:	0f be d2             	movsbl %dl,%edx
+  8020e5:	39 f2                	cmp    %esi,%edx
+  8020e7:	74 17                	je     802100 <strchr+0x25>
+    for (; *str; str++) {
+  8020e9:	48 83 c7 01          	add    $0x1,%rdi
+  8020ed:	0f b6 17             	movzbl (%rdi),%edx
+  8020f0:	84 d2                	test   %dl,%dl
+  8020f2:	75 ee                	jne    8020e2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8020f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f9:	c3                   	ret
+  8020fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ff:	c3                   	ret
+  802100:	48 89 f8             	mov    %rdi,%rax
+}
+  802103:	c3                   	ret
+
+0000000000802104 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802104:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802107:	0f b6 17             	movzbl (%rdi),%edx
+  80210a:	84 d2                	test   %dl,%dl
+  80210c:	74 13                	je     802121 <strfind+0x1d>
+  80210e:	0f be d2             	movsbl %dl,%edx
+  802111:	39 f2                	cmp    %esi,%edx
+  802113:	74 0b                	je     802120 <strfind+0x1c>
+  802115:	48 83 c0 01          	add    $0x1,%rax
+  802119:	0f b6 10             	movzbl (%rax),%edx
+  80211c:	84 d2                	test   %dl,%dl
+  80211e:	75 ee                	jne    80210e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802120:	c3                   	ret
+  802121:	c3                   	ret
+
+0000000000802122 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802122:	48 39 f7             	cmp    %rsi,%rdi
+  802125:	74 65                	je     80218c <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802127:	55                   	push   %rbp
+  802128:	48 89 e5             	mov    %rsp,%rbp
+  80212b:	41 57                	push   %r15
+  80212d:	41 56                	push   %r14
+  80212f:	41 55                	push   %r13
+  802131:	41 54                	push   %r12
+  802133:	53                   	push   %rbx
+  802134:	48 83 ec 18          	sub    $0x18,%rsp
+  802138:	48 89 fb             	mov    %rdi,%rbx
+  80213b:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80213e:	49 bf 13 20 80 00 00 	movabs $0x802013,%r15
+  802145:	00 00 00 
+  802148:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80214c:	41 0f b6 fd          	movzbl %r13b,%edi
+  802150:	41 ff d7             	call   *%r15
+  802153:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802156:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80215b:	41 0f b6 fe          	movzbl %r14b,%edi
+  80215f:	41 ff d7             	call   *%r15
+  802162:	89 c2                	mov    %eax,%edx
+  802164:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802167:	29 d0                	sub    %edx,%eax
+  802169:	75 12                	jne    80217d <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80216b:	48 83 c3 01          	add    $0x1,%rbx
+  80216f:	45 84 ed             	test   %r13b,%r13b
+  802172:	74 09                	je     80217d <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802174:	49 83 c4 01          	add    $0x1,%r12
+  802178:	45 84 f6             	test   %r14b,%r14b
+  80217b:	75 cb                	jne    802148 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80217d:	48 83 c4 18          	add    $0x18,%rsp
+  802181:	5b                   	pop    %rbx
+  802182:	41 5c                	pop    %r12
+  802184:	41 5d                	pop    %r13
+  802186:	41 5e                	pop    %r14
+  802188:	41 5f                	pop    %r15
+  80218a:	5d                   	pop    %rbp
+  80218b:	c3                   	ret
+    if (p1 == p2) return 0;
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802191:	c3                   	ret
+
+0000000000802192 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802192:	48 39 f7             	cmp    %rsi,%rdi
+  802195:	74 7d                	je     802214 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802197:	55                   	push   %rbp
+  802198:	48 89 e5             	mov    %rsp,%rbp
+  80219b:	41 57                	push   %r15
+  80219d:	41 56                	push   %r14
+  80219f:	41 55                	push   %r13
+  8021a1:	41 54                	push   %r12
+  8021a3:	53                   	push   %rbx
+  8021a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a8:	48 89 fb             	mov    %rdi,%rbx
+  8021ab:	49 89 f4             	mov    %rsi,%r12
+  8021ae:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021b6:	49 bf 13 20 80 00 00 	movabs $0x802013,%r15
+  8021bd:	00 00 00 
+    while (n--) {
+  8021c0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021c4:	48 39 c3             	cmp    %rax,%rbx
+  8021c7:	74 37                	je     802200 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021c9:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021cd:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021d1:	41 ff d7             	call   *%r15
+  8021d4:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021d7:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021dc:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021e0:	41 ff d7             	call   *%r15
+  8021e3:	89 c2                	mov    %eax,%edx
+  8021e5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021e8:	29 d0                	sub    %edx,%eax
+  8021ea:	75 19                	jne    802205 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8021ec:	48 83 c3 01          	add    $0x1,%rbx
+  8021f0:	45 84 ed             	test   %r13b,%r13b
+  8021f3:	74 10                	je     802205 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8021f5:	49 83 c4 01          	add    $0x1,%r12
+  8021f9:	45 84 f6             	test   %r14b,%r14b
+  8021fc:	75 c2                	jne    8021c0 <strncasecmp+0x2e>
+  8021fe:	eb 05                	jmp    802205 <strncasecmp+0x73>
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802205:	48 83 c4 18          	add    $0x18,%rsp
+  802209:	5b                   	pop    %rbx
+  80220a:	41 5c                	pop    %r12
+  80220c:	41 5d                	pop    %r13
+  80220e:	41 5e                	pop    %r14
+  802210:	41 5f                	pop    %r15
+  802212:	5d                   	pop    %rbp
+  802213:	c3                   	ret
+    if (p1 == p2) return 0;
+  802214:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802219:	c3                   	ret
+
+000000000080221a <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80221a:	83 e7 df             	and    $0xffffffdf,%edi
+  80221d:	83 ef 41             	sub    $0x41,%edi
+  802220:	83 ff 19             	cmp    $0x19,%edi
+  802223:	0f 96 c0             	setbe  %al
+}
+  802226:	c3                   	ret
+
+0000000000802227 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802227:	83 ff 20             	cmp    $0x20,%edi
+  80222a:	0f 94 c0             	sete   %al
+  80222d:	83 ff 09             	cmp    $0x9,%edi
+  802230:	0f 94 c2             	sete   %dl
+  802233:	09 d0                	or     %edx,%eax
+}
+  802235:	c3                   	ret
+
+0000000000802236 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802236:	55                   	push   %rbp
+  802237:	48 89 e5             	mov    %rsp,%rbp
+  80223a:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80223c:	48 bf 1f 61 80 00 00 	movabs $0x80611f,%rdi
+  802243:	00 00 00 
+  802246:	48 b8 db 20 80 00 00 	movabs $0x8020db,%rax
+  80224d:	00 00 00 
+  802250:	ff d0                	call   *%rax
+  802252:	48 85 c0             	test   %rax,%rax
+  802255:	0f 95 c0             	setne  %al
+}
+  802258:	5d                   	pop    %rbp
+  802259:	c3                   	ret
+
+000000000080225a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80225a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80225d:	48 89 f8             	mov    %rdi,%rax
+  802260:	48 f7 d8             	neg    %rax
+  802263:	83 e0 07             	and    $0x7,%eax
+  802266:	49 89 d1             	mov    %rdx,%r9
+  802269:	49 29 c1             	sub    %rax,%r9
+  80226c:	78 36                	js     8022a4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80226e:	40 0f b6 c6          	movzbl %sil,%eax
+  802272:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802279:	01 01 01 
+  80227c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802280:	40 f6 c7 07          	test   $0x7,%dil
+  802284:	75 38                	jne    8022be <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802286:	4c 89 c9             	mov    %r9,%rcx
+  802289:	48 c1 f9 03          	sar    $0x3,%rcx
+  80228d:	74 0c                	je     80229b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80228f:	fc                   	cld
+  802290:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802293:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802297:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80229b:	4d 85 c9             	test   %r9,%r9
+  80229e:	75 45                	jne    8022e5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022a0:	4c 89 c0             	mov    %r8,%rax
+  8022a3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022a4:	48 85 d2             	test   %rdx,%rdx
+  8022a7:	74 f7                	je     8022a0 <memset+0x46>
+  8022a9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022ac:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022af:	48 83 c0 01          	add    $0x1,%rax
+  8022b3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022b7:	48 39 c2             	cmp    %rax,%rdx
+  8022ba:	75 f3                	jne    8022af <memset+0x55>
+  8022bc:	eb e2                	jmp    8022a0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022be:	40 f6 c7 01          	test   $0x1,%dil
+  8022c2:	74 06                	je     8022ca <memset+0x70>
+  8022c4:	88 07                	mov    %al,(%rdi)
+  8022c6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022ca:	40 f6 c7 02          	test   $0x2,%dil
+  8022ce:	74 07                	je     8022d7 <memset+0x7d>
+  8022d0:	66 89 07             	mov    %ax,(%rdi)
+  8022d3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022d7:	40 f6 c7 04          	test   $0x4,%dil
+  8022db:	74 a9                	je     802286 <memset+0x2c>
+  8022dd:	89 07                	mov    %eax,(%rdi)
+  8022df:	48 83 c7 04          	add    $0x4,%rdi
+  8022e3:	eb a1                	jmp    802286 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022e5:	41 f6 c1 04          	test   $0x4,%r9b
+  8022e9:	74 06                	je     8022f1 <memset+0x97>
+  8022eb:	89 07                	mov    %eax,(%rdi)
+  8022ed:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022f1:	41 f6 c1 02          	test   $0x2,%r9b
+  8022f5:	74 07                	je     8022fe <memset+0xa4>
+  8022f7:	66 89 07             	mov    %ax,(%rdi)
+  8022fa:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8022fe:	41 f6 c1 01          	test   $0x1,%r9b
+  802302:	74 9c                	je     8022a0 <memset+0x46>
+  802304:	88 07                	mov    %al,(%rdi)
+  802306:	eb 98                	jmp    8022a0 <memset+0x46>
+
+0000000000802308 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802308:	48 89 f8             	mov    %rdi,%rax
+  80230b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80230e:	48 39 fe             	cmp    %rdi,%rsi
+  802311:	73 3b                	jae    80234e <memmove+0x46>
+  802313:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802317:	48 39 d7             	cmp    %rdx,%rdi
+  80231a:	73 32                	jae    80234e <memmove+0x46>
+        s += n;
+        d += n;
+  80231c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802320:	48 89 d6             	mov    %rdx,%rsi
+  802323:	48 09 fe             	or     %rdi,%rsi
+  802326:	48 09 ce             	or     %rcx,%rsi
+  802329:	40 f6 c6 07          	test   $0x7,%sil
+  80232d:	75 12                	jne    802341 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80232f:	48 83 ef 08          	sub    $0x8,%rdi
+  802333:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802337:	48 c1 e9 03          	shr    $0x3,%rcx
+  80233b:	fd                   	std
+  80233c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80233f:	fc                   	cld
+  802340:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802341:	48 83 ef 01          	sub    $0x1,%rdi
+  802345:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802349:	fd                   	std
+  80234a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80234c:	eb f1                	jmp    80233f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80234e:	48 89 f2             	mov    %rsi,%rdx
+  802351:	48 09 c2             	or     %rax,%rdx
+  802354:	48 09 ca             	or     %rcx,%rdx
+  802357:	f6 c2 07             	test   $0x7,%dl
+  80235a:	75 0c                	jne    802368 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80235c:	48 c1 e9 03          	shr    $0x3,%rcx
+  802360:	48 89 c7             	mov    %rax,%rdi
+  802363:	fc                   	cld
+  802364:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802367:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802368:	48 89 c7             	mov    %rax,%rdi
+  80236b:	fc                   	cld
+  80236c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80236e:	c3                   	ret
+
+000000000080236f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80236f:	55                   	push   %rbp
+  802370:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802373:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  80237a:	00 00 00 
+  80237d:	ff d0                	call   *%rax
+}
+  80237f:	5d                   	pop    %rbp
+  802380:	c3                   	ret
+
+0000000000802381 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802381:	55                   	push   %rbp
+  802382:	48 89 e5             	mov    %rsp,%rbp
+  802385:	41 57                	push   %r15
+  802387:	41 56                	push   %r14
+  802389:	41 55                	push   %r13
+  80238b:	41 54                	push   %r12
+  80238d:	53                   	push   %rbx
+  80238e:	48 83 ec 08          	sub    $0x8,%rsp
+  802392:	49 89 fe             	mov    %rdi,%r14
+  802395:	49 89 f7             	mov    %rsi,%r15
+  802398:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80239b:	48 89 f7             	mov    %rsi,%rdi
+  80239e:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  8023a5:	00 00 00 
+  8023a8:	ff d0                	call   *%rax
+  8023aa:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023ad:	48 89 de             	mov    %rbx,%rsi
+  8023b0:	4c 89 f7             	mov    %r14,%rdi
+  8023b3:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  8023ba:	00 00 00 
+  8023bd:	ff d0                	call   *%rax
+  8023bf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023c2:	48 39 c3             	cmp    %rax,%rbx
+  8023c5:	74 36                	je     8023fd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023c7:	48 89 d8             	mov    %rbx,%rax
+  8023ca:	4c 29 e8             	sub    %r13,%rax
+  8023cd:	49 39 c4             	cmp    %rax,%r12
+  8023d0:	73 31                	jae    802403 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023d2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023d7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023db:	4c 89 fe             	mov    %r15,%rsi
+  8023de:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8023ea:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8023ee:	48 83 c4 08          	add    $0x8,%rsp
+  8023f2:	5b                   	pop    %rbx
+  8023f3:	41 5c                	pop    %r12
+  8023f5:	41 5d                	pop    %r13
+  8023f7:	41 5e                	pop    %r14
+  8023f9:	41 5f                	pop    %r15
+  8023fb:	5d                   	pop    %rbp
+  8023fc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023fd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802401:	eb eb                	jmp    8023ee <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802403:	48 83 eb 01          	sub    $0x1,%rbx
+  802407:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80240b:	48 89 da             	mov    %rbx,%rdx
+  80240e:	4c 89 fe             	mov    %r15,%rsi
+  802411:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80241d:	49 01 de             	add    %rbx,%r14
+  802420:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802425:	eb c3                	jmp    8023ea <strlcat+0x69>
+
+0000000000802427 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802427:	48 85 d2             	test   %rdx,%rdx
+  80242a:	74 2d                	je     802459 <memcmp+0x32>
+  80242c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802431:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802435:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80243a:	44 38 c1             	cmp    %r8b,%cl
+  80243d:	75 0f                	jne    80244e <memcmp+0x27>
+    while (n-- > 0) {
+  80243f:	48 83 c0 01          	add    $0x1,%rax
+  802443:	48 39 c2             	cmp    %rax,%rdx
+  802446:	75 e9                	jne    802431 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80244e:	0f b6 c1             	movzbl %cl,%eax
+  802451:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802455:	44 29 c0             	sub    %r8d,%eax
+  802458:	c3                   	ret
+    return 0;
+  802459:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80245e:	c3                   	ret
+
+000000000080245f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80245f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802463:	48 39 c7             	cmp    %rax,%rdi
+  802466:	73 0f                	jae    802477 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802468:	40 38 37             	cmp    %sil,(%rdi)
+  80246b:	74 0e                	je     80247b <memfind+0x1c>
+    for (; src < end; src++) {
+  80246d:	48 83 c7 01          	add    $0x1,%rdi
+  802471:	48 39 f8             	cmp    %rdi,%rax
+  802474:	75 f2                	jne    802468 <memfind+0x9>
+  802476:	c3                   	ret
+  802477:	48 89 f8             	mov    %rdi,%rax
+  80247a:	c3                   	ret
+  80247b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80247e:	c3                   	ret
+
+000000000080247f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80247f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802482:	0f b6 37             	movzbl (%rdi),%esi
+  802485:	40 80 fe 20          	cmp    $0x20,%sil
+  802489:	74 06                	je     802491 <strtol+0x12>
+  80248b:	40 80 fe 09          	cmp    $0x9,%sil
+  80248f:	75 13                	jne    8024a4 <strtol+0x25>
+  802491:	48 83 c7 01          	add    $0x1,%rdi
+  802495:	0f b6 37             	movzbl (%rdi),%esi
+  802498:	40 80 fe 20          	cmp    $0x20,%sil
+  80249c:	74 f3                	je     802491 <strtol+0x12>
+  80249e:	40 80 fe 09          	cmp    $0x9,%sil
+  8024a2:	74 ed                	je     802491 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024a4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024a7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024aa:	3c 01                	cmp    $0x1,%al
+  8024ac:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024b0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024b6:	75 0f                	jne    8024c7 <strtol+0x48>
+  8024b8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024bb:	74 14                	je     8024d1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024bd:	85 d2                	test   %edx,%edx
+  8024bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024c4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024c7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024cc:	4c 63 ca             	movslq %edx,%r9
+  8024cf:	eb 36                	jmp    802507 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024d1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024d5:	74 0f                	je     8024e6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024d7:	85 d2                	test   %edx,%edx
+  8024d9:	75 ec                	jne    8024c7 <strtol+0x48>
+        s++;
+  8024db:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024df:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8024e4:	eb e1                	jmp    8024c7 <strtol+0x48>
+        s += 2;
+  8024e6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8024ea:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8024ef:	eb d6                	jmp    8024c7 <strtol+0x48>
+            dig -= '0';
+  8024f1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8024f4:	44 0f b6 c1          	movzbl %cl,%r8d
+  8024f8:	41 39 d0             	cmp    %edx,%r8d
+  8024fb:	7d 21                	jge    80251e <strtol+0x9f>
+        val = val * base + dig;
+  8024fd:	49 0f af c1          	imul   %r9,%rax
+  802501:	0f b6 c9             	movzbl %cl,%ecx
+  802504:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802507:	48 83 c7 01          	add    $0x1,%rdi
+  80250b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80250f:	80 f9 39             	cmp    $0x39,%cl
+  802512:	76 dd                	jbe    8024f1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802514:	80 f9 7b             	cmp    $0x7b,%cl
+  802517:	77 05                	ja     80251e <strtol+0x9f>
+            dig -= 'a' - 10;
+  802519:	83 e9 57             	sub    $0x57,%ecx
+  80251c:	eb d6                	jmp    8024f4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80251e:	4d 85 d2             	test   %r10,%r10
+  802521:	74 03                	je     802526 <strtol+0xa7>
+  802523:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802526:	48 89 c2             	mov    %rax,%rdx
+  802529:	48 f7 da             	neg    %rdx
+  80252c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802530:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802534:	c3                   	ret
+
+0000000000802535 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802535:	55                   	push   %rbp
+  802536:	48 89 e5             	mov    %rsp,%rbp
+  802539:	53                   	push   %rbx
+  80253a:	48 89 fa             	mov    %rdi,%rdx
+  80253d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802545:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80254a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80254f:	be 00 00 00 00       	mov    $0x0,%esi
+  802554:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80255a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802560:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802562:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802566:	c9                   	leave
+  802567:	c3                   	ret
+
+0000000000802568 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802568:	55                   	push   %rbp
+  802569:	48 89 e5             	mov    %rsp,%rbp
+  80256c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80256d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802572:	ba 00 00 00 00       	mov    $0x0,%edx
+  802577:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80257c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802581:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802586:	be 00 00 00 00       	mov    $0x0,%esi
+  80258b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802591:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802597:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802599:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+000000000080259f <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	53                   	push   %rbx
+  8025a4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025a7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025cc:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d2:	c9                   	leave
+  8025d3:	c3                   	ret
+
+00000000008025d4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025d4:	55                   	push   %rbp
+  8025d5:	48 89 e5             	mov    %rsp,%rbp
+  8025d8:	53                   	push   %rbx
+  8025d9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025e0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802605:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802607:	48 85 c0             	test   %rax,%rax
+  80260a:	7f 06                	jg     802612 <sys_env_destroy+0x3e>
+}
+  80260c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802612:	49 89 c0             	mov    %rax,%r8
+  802615:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80261a:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802621:	00 00 00 
+  802624:	be 27 00 00 00       	mov    $0x27,%esi
+  802629:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802630:	00 00 00 
+  802633:	b8 00 00 00 00       	mov    $0x0,%eax
+  802638:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  80263f:	00 00 00 
+  802642:	41 ff d1             	call   *%r9
+
+0000000000802645 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802645:	55                   	push   %rbp
+  802646:	48 89 e5             	mov    %rsp,%rbp
+  802649:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80264a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80264f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802654:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802659:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80265e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802663:	be 00 00 00 00       	mov    $0x0,%esi
+  802668:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80266e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802674:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802676:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+
+000000000080267c <sys_yield>:
+
+void
+sys_yield(void) {
+  80267c:	55                   	push   %rbp
+  80267d:	48 89 e5             	mov    %rsp,%rbp
+  802680:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802681:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802686:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802690:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802695:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80269a:	be 00 00 00 00       	mov    $0x0,%esi
+  80269f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026ab:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+
+00000000008026b3 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026b3:	55                   	push   %rbp
+  8026b4:	48 89 e5             	mov    %rsp,%rbp
+  8026b7:	53                   	push   %rbx
+  8026b8:	48 89 fa             	mov    %rdi,%rdx
+  8026bb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026be:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026c3:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026ca:	00 00 00 
+  8026cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026e3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8026e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e9:	c9                   	leave
+  8026ea:	c3                   	ret
+
+00000000008026eb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8026eb:	55                   	push   %rbp
+  8026ec:	48 89 e5             	mov    %rsp,%rbp
+  8026ef:	53                   	push   %rbx
+  8026f0:	49 89 f8             	mov    %rdi,%r8
+  8026f3:	48 89 d3             	mov    %rdx,%rbx
+  8026f6:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8026f9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026fe:	4c 89 c2             	mov    %r8,%rdx
+  802701:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802704:	be 00 00 00 00       	mov    $0x0,%esi
+  802709:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80270f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802715:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802717:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80271b:	c9                   	leave
+  80271c:	c3                   	ret
+
+000000000080271d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80271d:	55                   	push   %rbp
+  80271e:	48 89 e5             	mov    %rsp,%rbp
+  802721:	53                   	push   %rbx
+  802722:	48 83 ec 08          	sub    $0x8,%rsp
+  802726:	89 f8                	mov    %edi,%eax
+  802728:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80272b:	48 63 f9             	movslq %ecx,%rdi
+  80272e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802731:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802736:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802739:	be 00 00 00 00       	mov    $0x0,%esi
+  80273e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802744:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80274a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80274c:	48 85 c0             	test   %rax,%rax
+  80274f:	7f 06                	jg     802757 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802751:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802755:	c9                   	leave
+  802756:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802757:	49 89 c0             	mov    %rax,%r8
+  80275a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80275f:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802766:	00 00 00 
+  802769:	be 27 00 00 00       	mov    $0x27,%esi
+  80276e:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802775:	00 00 00 
+  802778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277d:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  802784:	00 00 00 
+  802787:	41 ff d1             	call   *%r9
+
+000000000080278a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80278a:	55                   	push   %rbp
+  80278b:	48 89 e5             	mov    %rsp,%rbp
+  80278e:	53                   	push   %rbx
+  80278f:	48 83 ec 08          	sub    $0x8,%rsp
+  802793:	89 f8                	mov    %edi,%eax
+  802795:	49 89 f2             	mov    %rsi,%r10
+  802798:	48 89 cf             	mov    %rcx,%rdi
+  80279b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80279e:	48 63 da             	movslq %edx,%rbx
+  8027a1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a4:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027a9:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027ac:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027b7:	48 85 c0             	test   %rax,%rax
+  8027ba:	7f 06                	jg     8027c2 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027c2:	49 89 c0             	mov    %rax,%r8
+  8027c5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027ca:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8027d1:	00 00 00 
+  8027d4:	be 27 00 00 00       	mov    $0x27,%esi
+  8027d9:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8027e0:	00 00 00 
+  8027e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e8:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  8027ef:	00 00 00 
+  8027f2:	41 ff d1             	call   *%r9
+
+00000000008027f5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8027f5:	55                   	push   %rbp
+  8027f6:	48 89 e5             	mov    %rsp,%rbp
+  8027f9:	53                   	push   %rbx
+  8027fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fe:	48 89 f1             	mov    %rsi,%rcx
+  802801:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802804:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802807:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80280c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802811:	be 00 00 00 00       	mov    $0x0,%esi
+  802816:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80281c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802822:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802824:	48 85 c0             	test   %rax,%rax
+  802827:	7f 06                	jg     80282f <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802829:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80282d:	c9                   	leave
+  80282e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80282f:	49 89 c0             	mov    %rax,%r8
+  802832:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802837:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80283e:	00 00 00 
+  802841:	be 27 00 00 00       	mov    $0x27,%esi
+  802846:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80284d:	00 00 00 
+  802850:	b8 00 00 00 00       	mov    $0x0,%eax
+  802855:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  80285c:	00 00 00 
+  80285f:	41 ff d1             	call   *%r9
+
+0000000000802862 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802862:	55                   	push   %rbp
+  802863:	48 89 e5             	mov    %rsp,%rbp
+  802866:	53                   	push   %rbx
+  802867:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80286b:	48 63 ce             	movslq %esi,%rcx
+  80286e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802871:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802876:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80287b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802880:	be 00 00 00 00       	mov    $0x0,%esi
+  802885:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80288b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802891:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802893:	48 85 c0             	test   %rax,%rax
+  802896:	7f 06                	jg     80289e <sys_env_set_status+0x3c>
+}
+  802898:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80289c:	c9                   	leave
+  80289d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80289e:	49 89 c0             	mov    %rax,%r8
+  8028a1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028a6:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8028ad:	00 00 00 
+  8028b0:	be 27 00 00 00       	mov    $0x27,%esi
+  8028b5:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8028bc:	00 00 00 
+  8028bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c4:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  8028cb:	00 00 00 
+  8028ce:	41 ff d1             	call   *%r9
+
+00000000008028d1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028d1:	55                   	push   %rbp
+  8028d2:	48 89 e5             	mov    %rsp,%rbp
+  8028d5:	53                   	push   %rbx
+  8028d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8028da:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802900:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802902:	48 85 c0             	test   %rax,%rax
+  802905:	7f 06                	jg     80290d <sys_env_set_trapframe+0x3c>
+}
+  802907:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80290b:	c9                   	leave
+  80290c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80290d:	49 89 c0             	mov    %rax,%r8
+  802910:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802915:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80291c:	00 00 00 
+  80291f:	be 27 00 00 00       	mov    $0x27,%esi
+  802924:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80292b:	00 00 00 
+  80292e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802933:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  80293a:	00 00 00 
+  80293d:	41 ff d1             	call   *%r9
+
+0000000000802940 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802940:	55                   	push   %rbp
+  802941:	48 89 e5             	mov    %rsp,%rbp
+  802944:	53                   	push   %rbx
+  802945:	48 83 ec 08          	sub    $0x8,%rsp
+  802949:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  80294c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80294f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802954:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802959:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80295e:	be 00 00 00 00       	mov    $0x0,%esi
+  802963:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802969:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80296f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802971:	48 85 c0             	test   %rax,%rax
+  802974:	7f 06                	jg     80297c <sys_env_set_pgfault_upcall+0x3c>
+}
+  802976:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80297a:	c9                   	leave
+  80297b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80297c:	49 89 c0             	mov    %rax,%r8
+  80297f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802984:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80298b:	00 00 00 
+  80298e:	be 27 00 00 00       	mov    $0x27,%esi
+  802993:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80299a:	00 00 00 
+  80299d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a2:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  8029a9:	00 00 00 
+  8029ac:	41 ff d1             	call   *%r9
+
+00000000008029af <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+  8029b3:	53                   	push   %rbx
+  8029b4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029b8:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029bf:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029e1:	48 85 c0             	test   %rax,%rax
+  8029e4:	7f 06                	jg     8029ec <sys_env_set_reclaim+0x3d>
+}
+  8029e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ea:	c9                   	leave
+  8029eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029ec:	49 89 c0             	mov    %rax,%r8
+  8029ef:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8029f4:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8029fb:	00 00 00 
+  8029fe:	be 27 00 00 00       	mov    $0x27,%esi
+  802a03:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a0a:	00 00 00 
+  802a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a12:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  802a19:	00 00 00 
+  802a1c:	41 ff d1             	call   *%r9
+
+0000000000802a1f <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a1f:	55                   	push   %rbp
+  802a20:	48 89 e5             	mov    %rsp,%rbp
+  802a23:	53                   	push   %rbx
+  802a24:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a28:	48 63 ce             	movslq %esi,%rcx
+  802a2b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a2e:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a38:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a3d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a48:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a4e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a50:	48 85 c0             	test   %rax,%rax
+  802a53:	7f 06                	jg     802a5b <sys_env_set_nice+0x3c>
+}
+  802a55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a59:	c9                   	leave
+  802a5a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a5b:	49 89 c0             	mov    %rax,%r8
+  802a5e:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a63:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802a6a:	00 00 00 
+  802a6d:	be 27 00 00 00       	mov    $0x27,%esi
+  802a72:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a79:	00 00 00 
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a81:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  802a88:	00 00 00 
+  802a8b:	41 ff d1             	call   *%r9
+
+0000000000802a8e <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802a8e:	55                   	push   %rbp
+  802a8f:	48 89 e5             	mov    %rsp,%rbp
+  802a92:	53                   	push   %rbx
+  802a93:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a96:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aa0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aaa:	be 00 00 00 00       	mov    $0x0,%esi
+  802aaf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802abb:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802abd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac1:	c9                   	leave
+  802ac2:	c3                   	ret
+
+0000000000802ac3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ac3:	55                   	push   %rbp
+  802ac4:	48 89 e5             	mov    %rsp,%rbp
+  802ac7:	53                   	push   %rbx
+  802ac8:	89 f8                	mov    %edi,%eax
+  802aca:	49 89 f1             	mov    %rsi,%r9
+  802acd:	48 89 d3             	mov    %rdx,%rbx
+  802ad0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ad3:	49 63 f0             	movslq %r8d,%rsi
+  802ad6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ad9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ade:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ae1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aed:	cd 30                	int    $0x30
+}
+  802aef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802af3:	c9                   	leave
+  802af4:	c3                   	ret
+
+0000000000802af5 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802af5:	55                   	push   %rbp
+  802af6:	48 89 e5             	mov    %rsp,%rbp
+  802af9:	53                   	push   %rbx
+  802afa:	89 f8                	mov    %edi,%eax
+  802afc:	49 89 f1             	mov    %rsi,%r9
+  802aff:	48 89 d3             	mov    %rdx,%rbx
+  802b02:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b05:	49 63 f0             	movslq %r8d,%rsi
+  802b08:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b0b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b10:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1f:	cd 30                	int    $0x30
+}
+  802b21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+
+0000000000802b27 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b27:	55                   	push   %rbp
+  802b28:	48 89 e5             	mov    %rsp,%rbp
+  802b2b:	53                   	push   %rbx
+  802b2c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b30:	89 f8                	mov    %edi,%eax
+  802b32:	49 89 f2             	mov    %rsi,%r10
+  802b35:	48 89 d3             	mov    %rdx,%rbx
+  802b38:	48 89 cf             	mov    %rcx,%rdi
+  802b3b:	44 89 c6             	mov    %r8d,%esi
+  802b3e:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b41:	48 63 f6             	movslq %esi,%rsi
+  802b44:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b47:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b4c:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b4f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b53:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b55:	48 85 c0             	test   %rax,%rax
+  802b58:	7f 06                	jg     802b60 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b5e:	c9                   	leave
+  802b5f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b60:	49 89 c0             	mov    %rax,%r8
+  802b63:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b68:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802b6f:	00 00 00 
+  802b72:	be 27 00 00 00       	mov    $0x27,%esi
+  802b77:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802b7e:	00 00 00 
+  802b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b86:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  802b8d:	00 00 00 
+  802b90:	41 ff d1             	call   *%r9
+
+0000000000802b93 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802b93:	55                   	push   %rbp
+  802b94:	48 89 e5             	mov    %rsp,%rbp
+  802b97:	53                   	push   %rbx
+  802b98:	48 83 ec 08          	sub    $0x8,%rsp
+  802b9c:	48 89 f1             	mov    %rsi,%rcx
+  802b9f:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802ba2:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802ba6:	48 8b 1a             	mov    (%rdx),%rbx
+  802ba9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bac:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bb1:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bb5:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bb9:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bbd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bbf:	48 85 c0             	test   %rax,%rax
+  802bc2:	7f 06                	jg     802bca <sys_ipc_call_short+0x37>
+}
+  802bc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bc8:	c9                   	leave
+  802bc9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bca:	49 89 c0             	mov    %rax,%r8
+  802bcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bd2:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802bd9:	00 00 00 
+  802bdc:	be 27 00 00 00       	mov    $0x27,%esi
+  802be1:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802be8:	00 00 00 
+  802beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf0:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  802bf7:	00 00 00 
+  802bfa:	41 ff d1             	call   *%r9
+
+0000000000802bfd <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	53                   	push   %rbx
+  802c02:	48 83 ec 08          	sub    $0x8,%rsp
+  802c06:	89 f8                	mov    %edi,%eax
+  802c08:	49 89 f2             	mov    %rsi,%r10
+  802c0b:	48 89 d3             	mov    %rdx,%rbx
+  802c0e:	48 89 cf             	mov    %rcx,%rdi
+  802c11:	44 89 c6             	mov    %r8d,%esi
+  802c14:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c17:	48 63 f6             	movslq %esi,%rsi
+  802c1a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c1d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c22:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c25:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c29:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c2b:	48 85 c0             	test   %rax,%rax
+  802c2e:	7f 06                	jg     802c36 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c34:	c9                   	leave
+  802c35:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c36:	49 89 c0             	mov    %rax,%r8
+  802c39:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c3e:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802c45:	00 00 00 
+  802c48:	be 27 00 00 00       	mov    $0x27,%esi
+  802c4d:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802c54:	00 00 00 
+  802c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5c:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  802c63:	00 00 00 
+  802c66:	41 ff d1             	call   *%r9
+
+0000000000802c69 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c69:	55                   	push   %rbp
+  802c6a:	48 89 e5             	mov    %rsp,%rbp
+  802c6d:	53                   	push   %rbx
+  802c6e:	48 83 ec 08          	sub    $0x8,%rsp
+  802c72:	48 89 fa             	mov    %rdi,%rdx
+  802c75:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c78:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c87:	be 00 00 00 00       	mov    $0x0,%esi
+  802c8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c92:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c98:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c9a:	48 85 c0             	test   %rax,%rax
+  802c9d:	7f 06                	jg     802ca5 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca3:	c9                   	leave
+  802ca4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ca5:	49 89 c0             	mov    %rax,%r8
+  802ca8:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cad:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802cb4:	00 00 00 
+  802cb7:	be 27 00 00 00       	mov    $0x27,%esi
+  802cbc:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802cc3:	00 00 00 
+  802cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ccb:	49 b9 6f 50 80 00 00 	movabs $0x80506f,%r9
+  802cd2:	00 00 00 
+  802cd5:	41 ff d1             	call   *%r9
+
+0000000000802cd8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cd8:	55                   	push   %rbp
+  802cd9:	48 89 e5             	mov    %rsp,%rbp
+  802cdc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cdd:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cf1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cf6:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d07:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d0d:	c9                   	leave
+  802d0e:	c3                   	ret
+
+0000000000802d0f <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d0f:	55                   	push   %rbp
+  802d10:	48 89 e5             	mov    %rsp,%rbp
+  802d13:	53                   	push   %rbx
+  802d14:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d17:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d26:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d36:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d3c:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d42:	c9                   	leave
+  802d43:	c3                   	ret
+
+0000000000802d44 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d44:	55                   	push   %rbp
+  802d45:	48 89 e5             	mov    %rsp,%rbp
+  802d48:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d49:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d53:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d62:	be 00 00 00 00       	mov    $0x0,%esi
+  802d67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d6d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d73:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+
+0000000000802d7b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d7b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d82:	ff ff ff 
+  802d85:	48 01 f8             	add    %rdi,%rax
+  802d88:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802d8c:	c3                   	ret
+
+0000000000802d8d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d8d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d94:	ff ff ff 
+  802d97:	48 01 f8             	add    %rdi,%rax
+  802d9a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802d9e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802da4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802da8:	c3                   	ret
+
+0000000000802da9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802da9:	55                   	push   %rbp
+  802daa:	48 89 e5             	mov    %rsp,%rbp
+  802dad:	41 57                	push   %r15
+  802daf:	41 56                	push   %r14
+  802db1:	41 55                	push   %r13
+  802db3:	41 54                	push   %r12
+  802db5:	53                   	push   %rbx
+  802db6:	48 83 ec 08          	sub    $0x8,%rsp
+  802dba:	49 89 ff             	mov    %rdi,%r15
+  802dbd:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802dc2:	49 bd a9 42 80 00 00 	movabs $0x8042a9,%r13
+  802dc9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802dcc:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802dd2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802dd5:	48 89 df             	mov    %rbx,%rdi
+  802dd8:	41 ff d5             	call   *%r13
+  802ddb:	83 e0 04             	and    $0x4,%eax
+  802dde:	74 17                	je     802df7 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802de0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802de7:	4c 39 f3             	cmp    %r14,%rbx
+  802dea:	75 e6                	jne    802dd2 <fd_alloc+0x29>
+  802dec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802df2:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802df7:	4d 89 27             	mov    %r12,(%r15)
+}
+  802dfa:	48 83 c4 08          	add    $0x8,%rsp
+  802dfe:	5b                   	pop    %rbx
+  802dff:	41 5c                	pop    %r12
+  802e01:	41 5d                	pop    %r13
+  802e03:	41 5e                	pop    %r14
+  802e05:	41 5f                	pop    %r15
+  802e07:	5d                   	pop    %rbp
+  802e08:	c3                   	ret
+
+0000000000802e09 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e09:	83 ff 1f             	cmp    $0x1f,%edi
+  802e0c:	77 39                	ja     802e47 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e0e:	55                   	push   %rbp
+  802e0f:	48 89 e5             	mov    %rsp,%rbp
+  802e12:	41 54                	push   %r12
+  802e14:	53                   	push   %rbx
+  802e15:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e18:	48 63 df             	movslq %edi,%rbx
+  802e1b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e22:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e26:	48 89 df             	mov    %rbx,%rdi
+  802e29:	48 b8 a9 42 80 00 00 	movabs $0x8042a9,%rax
+  802e30:	00 00 00 
+  802e33:	ff d0                	call   *%rax
+  802e35:	a8 04                	test   $0x4,%al
+  802e37:	74 14                	je     802e4d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e39:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e42:	5b                   	pop    %rbx
+  802e43:	41 5c                	pop    %r12
+  802e45:	5d                   	pop    %rbp
+  802e46:	c3                   	ret
+        return -E_INVAL;
+  802e47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e4c:	c3                   	ret
+        return -E_INVAL;
+  802e4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e52:	eb ee                	jmp    802e42 <fd_lookup+0x39>
+
+0000000000802e54 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e54:	55                   	push   %rbp
+  802e55:	48 89 e5             	mov    %rsp,%rbp
+  802e58:	41 54                	push   %r12
+  802e5a:	53                   	push   %rbx
+  802e5b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e5e:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802e65:	00 00 00 
+  802e68:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e6f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e72:	39 3b                	cmp    %edi,(%rbx)
+  802e74:	74 47                	je     802ebd <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e76:	48 83 c0 08          	add    $0x8,%rax
+  802e7a:	48 8b 18             	mov    (%rax),%rbx
+  802e7d:	48 85 db             	test   %rbx,%rbx
+  802e80:	75 f0                	jne    802e72 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e82:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e89:	00 00 00 
+  802e8c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e92:	89 fa                	mov    %edi,%edx
+  802e94:	48 bf 58 61 80 00 00 	movabs $0x806158,%rdi
+  802e9b:	00 00 00 
+  802e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea3:	48 b9 81 16 80 00 00 	movabs $0x801681,%rcx
+  802eaa:	00 00 00 
+  802ead:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802eaf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802eb4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802eb8:	5b                   	pop    %rbx
+  802eb9:	41 5c                	pop    %r12
+  802ebb:	5d                   	pop    %rbp
+  802ebc:	c3                   	ret
+            return 0;
+  802ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec2:	eb f0                	jmp    802eb4 <dev_lookup+0x60>
+
+0000000000802ec4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ec4:	55                   	push   %rbp
+  802ec5:	48 89 e5             	mov    %rsp,%rbp
+  802ec8:	41 55                	push   %r13
+  802eca:	41 54                	push   %r12
+  802ecc:	53                   	push   %rbx
+  802ecd:	48 83 ec 18          	sub    $0x18,%rsp
+  802ed1:	48 89 fb             	mov    %rdi,%rbx
+  802ed4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ed7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802ede:	ff ff ff 
+  802ee1:	48 01 df             	add    %rbx,%rdi
+  802ee4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802ee8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802eec:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  802ef3:	00 00 00 
+  802ef6:	ff d0                	call   *%rax
+  802ef8:	41 89 c5             	mov    %eax,%r13d
+  802efb:	85 c0                	test   %eax,%eax
+  802efd:	78 06                	js     802f05 <fd_close+0x41>
+  802eff:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f03:	74 1a                	je     802f1f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f05:	45 84 e4             	test   %r12b,%r12b
+  802f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f11:	44 89 e8             	mov    %r13d,%eax
+  802f14:	48 83 c4 18          	add    $0x18,%rsp
+  802f18:	5b                   	pop    %rbx
+  802f19:	41 5c                	pop    %r12
+  802f1b:	41 5d                	pop    %r13
+  802f1d:	5d                   	pop    %rbp
+  802f1e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f1f:	8b 3b                	mov    (%rbx),%edi
+  802f21:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f25:	48 b8 54 2e 80 00 00 	movabs $0x802e54,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+  802f31:	41 89 c5             	mov    %eax,%r13d
+  802f34:	85 c0                	test   %eax,%eax
+  802f36:	78 1b                	js     802f53 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f3c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f40:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f46:	48 85 c0             	test   %rax,%rax
+  802f49:	74 08                	je     802f53 <fd_close+0x8f>
+  802f4b:	48 89 df             	mov    %rbx,%rdi
+  802f4e:	ff d0                	call   *%rax
+  802f50:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f58:	48 89 de             	mov    %rbx,%rsi
+  802f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f60:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  802f67:	00 00 00 
+  802f6a:	ff d0                	call   *%rax
+    return res;
+  802f6c:	eb a3                	jmp    802f11 <fd_close+0x4d>
+
+0000000000802f6e <close>:
+
+int
+close(int fdnum) {
+  802f6e:	55                   	push   %rbp
+  802f6f:	48 89 e5             	mov    %rsp,%rbp
+  802f72:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f76:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f7a:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  802f81:	00 00 00 
+  802f84:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f86:	85 c0                	test   %eax,%eax
+  802f88:	78 15                	js     802f9f <close+0x31>
+
+    return fd_close(fd, 1);
+  802f8a:	be 01 00 00 00       	mov    $0x1,%esi
+  802f8f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f93:	48 b8 c4 2e 80 00 00 	movabs $0x802ec4,%rax
+  802f9a:	00 00 00 
+  802f9d:	ff d0                	call   *%rax
+}
+  802f9f:	c9                   	leave
+  802fa0:	c3                   	ret
+
+0000000000802fa1 <close_all>:
+
+void
+close_all(void) {
+  802fa1:	55                   	push   %rbp
+  802fa2:	48 89 e5             	mov    %rsp,%rbp
+  802fa5:	41 54                	push   %r12
+  802fa7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fad:	49 bc 6e 2f 80 00 00 	movabs $0x802f6e,%r12
+  802fb4:	00 00 00 
+  802fb7:	89 df                	mov    %ebx,%edi
+  802fb9:	41 ff d4             	call   *%r12
+  802fbc:	83 c3 01             	add    $0x1,%ebx
+  802fbf:	83 fb 20             	cmp    $0x20,%ebx
+  802fc2:	75 f3                	jne    802fb7 <close_all+0x16>
+}
+  802fc4:	5b                   	pop    %rbx
+  802fc5:	41 5c                	pop    %r12
+  802fc7:	5d                   	pop    %rbp
+  802fc8:	c3                   	ret
+
+0000000000802fc9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fc9:	55                   	push   %rbp
+  802fca:	48 89 e5             	mov    %rsp,%rbp
+  802fcd:	41 57                	push   %r15
+  802fcf:	41 56                	push   %r14
+  802fd1:	41 55                	push   %r13
+  802fd3:	41 54                	push   %r12
+  802fd5:	53                   	push   %rbx
+  802fd6:	48 83 ec 18          	sub    $0x18,%rsp
+  802fda:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802fdd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802fe1:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  802fe8:	00 00 00 
+  802feb:	ff d0                	call   *%rax
+  802fed:	89 c3                	mov    %eax,%ebx
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	0f 88 b8 00 00 00    	js     8030af <dup+0xe6>
+    close(newfdnum);
+  802ff7:	44 89 e7             	mov    %r12d,%edi
+  802ffa:	48 b8 6e 2f 80 00 00 	movabs $0x802f6e,%rax
+  803001:	00 00 00 
+  803004:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803006:	4d 63 ec             	movslq %r12d,%r13
+  803009:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803010:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803014:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803018:	4c 89 ff             	mov    %r15,%rdi
+  80301b:	49 be 8d 2d 80 00 00 	movabs $0x802d8d,%r14
+  803022:	00 00 00 
+  803025:	41 ff d6             	call   *%r14
+  803028:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80302b:	4c 89 ef             	mov    %r13,%rdi
+  80302e:	41 ff d6             	call   *%r14
+  803031:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803034:	48 89 df             	mov    %rbx,%rdi
+  803037:	48 b8 a9 42 80 00 00 	movabs $0x8042a9,%rax
+  80303e:	00 00 00 
+  803041:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803043:	a8 04                	test   $0x4,%al
+  803045:	74 2b                	je     803072 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803047:	41 89 c1             	mov    %eax,%r9d
+  80304a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803050:	4c 89 f1             	mov    %r14,%rcx
+  803053:	ba 00 00 00 00       	mov    $0x0,%edx
+  803058:	48 89 de             	mov    %rbx,%rsi
+  80305b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803060:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  803067:	00 00 00 
+  80306a:	ff d0                	call   *%rax
+  80306c:	89 c3                	mov    %eax,%ebx
+  80306e:	85 c0                	test   %eax,%eax
+  803070:	78 4e                	js     8030c0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803072:	4c 89 ff             	mov    %r15,%rdi
+  803075:	48 b8 a9 42 80 00 00 	movabs $0x8042a9,%rax
+  80307c:	00 00 00 
+  80307f:	ff d0                	call   *%rax
+  803081:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803084:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80308a:	4c 89 e9             	mov    %r13,%rcx
+  80308d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803092:	4c 89 fe             	mov    %r15,%rsi
+  803095:	bf 00 00 00 00       	mov    $0x0,%edi
+  80309a:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  8030a1:	00 00 00 
+  8030a4:	ff d0                	call   *%rax
+  8030a6:	89 c3                	mov    %eax,%ebx
+  8030a8:	85 c0                	test   %eax,%eax
+  8030aa:	78 14                	js     8030c0 <dup+0xf7>
+
+    return newfdnum;
+  8030ac:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030af:	89 d8                	mov    %ebx,%eax
+  8030b1:	48 83 c4 18          	add    $0x18,%rsp
+  8030b5:	5b                   	pop    %rbx
+  8030b6:	41 5c                	pop    %r12
+  8030b8:	41 5d                	pop    %r13
+  8030ba:	41 5e                	pop    %r14
+  8030bc:	41 5f                	pop    %r15
+  8030be:	5d                   	pop    %rbp
+  8030bf:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030c5:	4c 89 ee             	mov    %r13,%rsi
+  8030c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030cd:	49 bc f5 27 80 00 00 	movabs $0x8027f5,%r12
+  8030d4:	00 00 00 
+  8030d7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030df:	4c 89 f6             	mov    %r14,%rsi
+  8030e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e7:	41 ff d4             	call   *%r12
+    return res;
+  8030ea:	eb c3                	jmp    8030af <dup+0xe6>
+
+00000000008030ec <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030ec:	55                   	push   %rbp
+  8030ed:	48 89 e5             	mov    %rsp,%rbp
+  8030f0:	41 56                	push   %r14
+  8030f2:	41 55                	push   %r13
+  8030f4:	41 54                	push   %r12
+  8030f6:	53                   	push   %rbx
+  8030f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8030fb:	89 fb                	mov    %edi,%ebx
+  8030fd:	49 89 f4             	mov    %rsi,%r12
+  803100:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803103:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803107:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+  803113:	85 c0                	test   %eax,%eax
+  803115:	78 4c                	js     803163 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803117:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80311b:	41 8b 3e             	mov    (%r14),%edi
+  80311e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803122:	48 b8 54 2e 80 00 00 	movabs $0x802e54,%rax
+  803129:	00 00 00 
+  80312c:	ff d0                	call   *%rax
+  80312e:	85 c0                	test   %eax,%eax
+  803130:	78 35                	js     803167 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803132:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803136:	83 e0 03             	and    $0x3,%eax
+  803139:	83 f8 01             	cmp    $0x1,%eax
+  80313c:	74 2d                	je     80316b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80313e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803142:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803146:	48 85 c0             	test   %rax,%rax
+  803149:	74 56                	je     8031a1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80314b:	4c 89 ea             	mov    %r13,%rdx
+  80314e:	4c 89 e6             	mov    %r12,%rsi
+  803151:	4c 89 f7             	mov    %r14,%rdi
+  803154:	ff d0                	call   *%rax
+}
+  803156:	48 83 c4 10          	add    $0x10,%rsp
+  80315a:	5b                   	pop    %rbx
+  80315b:	41 5c                	pop    %r12
+  80315d:	41 5d                	pop    %r13
+  80315f:	41 5e                	pop    %r14
+  803161:	5d                   	pop    %rbp
+  803162:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803163:	48 98                	cltq
+  803165:	eb ef                	jmp    803156 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803167:	48 98                	cltq
+  803169:	eb eb                	jmp    803156 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80316b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803172:	00 00 00 
+  803175:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80317b:	89 da                	mov    %ebx,%edx
+  80317d:	48 bf 99 61 80 00 00 	movabs $0x806199,%rdi
+  803184:	00 00 00 
+  803187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80318c:	48 b9 81 16 80 00 00 	movabs $0x801681,%rcx
+  803193:	00 00 00 
+  803196:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803198:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80319f:	eb b5                	jmp    803156 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031a1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031a8:	eb ac                	jmp    803156 <read+0x6a>
+
+00000000008031aa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031aa:	55                   	push   %rbp
+  8031ab:	48 89 e5             	mov    %rsp,%rbp
+  8031ae:	41 57                	push   %r15
+  8031b0:	41 56                	push   %r14
+  8031b2:	41 55                	push   %r13
+  8031b4:	41 54                	push   %r12
+  8031b6:	53                   	push   %rbx
+  8031b7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031bb:	48 85 d2             	test   %rdx,%rdx
+  8031be:	74 54                	je     803214 <readn+0x6a>
+  8031c0:	41 89 fd             	mov    %edi,%r13d
+  8031c3:	49 89 f6             	mov    %rsi,%r14
+  8031c6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031ce:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031d3:	49 bf ec 30 80 00 00 	movabs $0x8030ec,%r15
+  8031da:	00 00 00 
+  8031dd:	4c 89 e2             	mov    %r12,%rdx
+  8031e0:	48 29 f2             	sub    %rsi,%rdx
+  8031e3:	4c 01 f6             	add    %r14,%rsi
+  8031e6:	44 89 ef             	mov    %r13d,%edi
+  8031e9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8031ec:	85 c0                	test   %eax,%eax
+  8031ee:	78 20                	js     803210 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8031f0:	01 c3                	add    %eax,%ebx
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	74 08                	je     8031fe <readn+0x54>
+  8031f6:	48 63 f3             	movslq %ebx,%rsi
+  8031f9:	4c 39 e6             	cmp    %r12,%rsi
+  8031fc:	72 df                	jb     8031dd <readn+0x33>
+    }
+    return res;
+  8031fe:	48 63 c3             	movslq %ebx,%rax
+}
+  803201:	48 83 c4 08          	add    $0x8,%rsp
+  803205:	5b                   	pop    %rbx
+  803206:	41 5c                	pop    %r12
+  803208:	41 5d                	pop    %r13
+  80320a:	41 5e                	pop    %r14
+  80320c:	41 5f                	pop    %r15
+  80320e:	5d                   	pop    %rbp
+  80320f:	c3                   	ret
+        if (inc < 0) return inc;
+  803210:	48 98                	cltq
+  803212:	eb ed                	jmp    803201 <readn+0x57>
+    int inc = 1, res = 0;
+  803214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803219:	eb e3                	jmp    8031fe <readn+0x54>
+
+000000000080321b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80321b:	55                   	push   %rbp
+  80321c:	48 89 e5             	mov    %rsp,%rbp
+  80321f:	41 56                	push   %r14
+  803221:	41 55                	push   %r13
+  803223:	41 54                	push   %r12
+  803225:	53                   	push   %rbx
+  803226:	48 83 ec 10          	sub    $0x10,%rsp
+  80322a:	89 fb                	mov    %edi,%ebx
+  80322c:	49 89 f4             	mov    %rsi,%r12
+  80322f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803232:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803236:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+  803242:	85 c0                	test   %eax,%eax
+  803244:	78 47                	js     80328d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803246:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80324a:	41 8b 3e             	mov    (%r14),%edi
+  80324d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803251:	48 b8 54 2e 80 00 00 	movabs $0x802e54,%rax
+  803258:	00 00 00 
+  80325b:	ff d0                	call   *%rax
+  80325d:	85 c0                	test   %eax,%eax
+  80325f:	78 30                	js     803291 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803261:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803266:	74 2d                	je     803295 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803268:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80326c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803270:	48 85 c0             	test   %rax,%rax
+  803273:	74 56                	je     8032cb <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803275:	4c 89 ea             	mov    %r13,%rdx
+  803278:	4c 89 e6             	mov    %r12,%rsi
+  80327b:	4c 89 f7             	mov    %r14,%rdi
+  80327e:	ff d0                	call   *%rax
+}
+  803280:	48 83 c4 10          	add    $0x10,%rsp
+  803284:	5b                   	pop    %rbx
+  803285:	41 5c                	pop    %r12
+  803287:	41 5d                	pop    %r13
+  803289:	41 5e                	pop    %r14
+  80328b:	5d                   	pop    %rbp
+  80328c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80328d:	48 98                	cltq
+  80328f:	eb ef                	jmp    803280 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803291:	48 98                	cltq
+  803293:	eb eb                	jmp    803280 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803295:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80329c:	00 00 00 
+  80329f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032a5:	89 da                	mov    %ebx,%edx
+  8032a7:	48 bf b5 61 80 00 00 	movabs $0x8061b5,%rdi
+  8032ae:	00 00 00 
+  8032b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b6:	48 b9 81 16 80 00 00 	movabs $0x801681,%rcx
+  8032bd:	00 00 00 
+  8032c0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032c2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032c9:	eb b5                	jmp    803280 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032cb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032d2:	eb ac                	jmp    803280 <write+0x65>
+
+00000000008032d4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	53                   	push   %rbx
+  8032d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8032dd:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032df:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032e3:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  8032ea:	00 00 00 
+  8032ed:	ff d0                	call   *%rax
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	78 0c                	js     8032ff <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8032f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8032fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803303:	c9                   	leave
+  803304:	c3                   	ret
+
+0000000000803305 <tell>:
+
+int tell(int fdnum) {
+  803305:	55                   	push   %rbp
+  803306:	48 89 e5             	mov    %rsp,%rbp
+  803309:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80330d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803311:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	78 07                	js     803328 <tell+0x23>
+
+    return fd->fd_offset;
+  803321:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803325:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803328:	c9                   	leave
+  803329:	c3                   	ret
+
+000000000080332a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80332a:	55                   	push   %rbp
+  80332b:	48 89 e5             	mov    %rsp,%rbp
+  80332e:	41 55                	push   %r13
+  803330:	41 54                	push   %r12
+  803332:	53                   	push   %rbx
+  803333:	48 83 ec 18          	sub    $0x18,%rsp
+  803337:	89 fb                	mov    %edi,%ebx
+  803339:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80333c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803340:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  803347:	00 00 00 
+  80334a:	ff d0                	call   *%rax
+  80334c:	85 c0                	test   %eax,%eax
+  80334e:	78 38                	js     803388 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803350:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803354:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803358:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80335c:	48 b8 54 2e 80 00 00 	movabs $0x802e54,%rax
+  803363:	00 00 00 
+  803366:	ff d0                	call   *%rax
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	78 1c                	js     803388 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80336c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803371:	74 20                	je     803393 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803373:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803377:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80337b:	48 85 c0             	test   %rax,%rax
+  80337e:	74 47                	je     8033c7 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803380:	44 89 e6             	mov    %r12d,%esi
+  803383:	4c 89 ef             	mov    %r13,%rdi
+  803386:	ff d0                	call   *%rax
+}
+  803388:	48 83 c4 18          	add    $0x18,%rsp
+  80338c:	5b                   	pop    %rbx
+  80338d:	41 5c                	pop    %r12
+  80338f:	41 5d                	pop    %r13
+  803391:	5d                   	pop    %rbp
+  803392:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803393:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80339a:	00 00 00 
+  80339d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033a3:	89 da                	mov    %ebx,%edx
+  8033a5:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  8033ac:	00 00 00 
+  8033af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b4:	48 b9 81 16 80 00 00 	movabs $0x801681,%rcx
+  8033bb:	00 00 00 
+  8033be:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c5:	eb c1                	jmp    803388 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033c7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033cc:	eb ba                	jmp    803388 <ftruncate+0x5e>
+
+00000000008033ce <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033ce:	55                   	push   %rbp
+  8033cf:	48 89 e5             	mov    %rsp,%rbp
+  8033d2:	41 54                	push   %r12
+  8033d4:	53                   	push   %rbx
+  8033d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d9:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033dc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033e0:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  8033e7:	00 00 00 
+  8033ea:	ff d0                	call   *%rax
+  8033ec:	85 c0                	test   %eax,%eax
+  8033ee:	78 63                	js     803453 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033f0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8033f4:	41 8b 3c 24          	mov    (%r12),%edi
+  8033f8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8033fc:	48 b8 54 2e 80 00 00 	movabs $0x802e54,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	78 47                	js     803453 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80340c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803410:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803415:	74 45                	je     80345c <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803417:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80341a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803421:	00 00 00 
+    stat->st_isdir = 0;
+  803424:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80342b:	00 00 00 
+    stat->st_ino = 0;
+  80342e:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803435:	00 00 00 00 
+    stat->st_version = 0;
+  803439:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803440:	00 00 00 
+    stat->st_dev = dev;
+  803443:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80344a:	48 89 de             	mov    %rbx,%rsi
+  80344d:	4c 89 e7             	mov    %r12,%rdi
+  803450:	ff 50 28             	call   *0x28(%rax)
+}
+  803453:	48 83 c4 10          	add    $0x10,%rsp
+  803457:	5b                   	pop    %rbx
+  803458:	41 5c                	pop    %r12
+  80345a:	5d                   	pop    %rbp
+  80345b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80345c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803461:	eb f0                	jmp    803453 <fstat+0x85>
+
+0000000000803463 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803463:	55                   	push   %rbp
+  803464:	48 89 e5             	mov    %rsp,%rbp
+  803467:	41 54                	push   %r12
+  803469:	53                   	push   %rbx
+  80346a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80346d:	be 00 00 00 00       	mov    $0x0,%esi
+  803472:	48 b8 84 39 80 00 00 	movabs $0x803984,%rax
+  803479:	00 00 00 
+  80347c:	ff d0                	call   *%rax
+  80347e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803480:	85 c0                	test   %eax,%eax
+  803482:	78 25                	js     8034a9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803484:	4c 89 e6             	mov    %r12,%rsi
+  803487:	89 c7                	mov    %eax,%edi
+  803489:	48 b8 ce 33 80 00 00 	movabs $0x8033ce,%rax
+  803490:	00 00 00 
+  803493:	ff d0                	call   *%rax
+  803495:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803498:	89 df                	mov    %ebx,%edi
+  80349a:	48 b8 6e 2f 80 00 00 	movabs $0x802f6e,%rax
+  8034a1:	00 00 00 
+  8034a4:	ff d0                	call   *%rax
+
+    return res;
+  8034a6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034a9:	89 d8                	mov    %ebx,%eax
+  8034ab:	5b                   	pop    %rbx
+  8034ac:	41 5c                	pop    %r12
+  8034ae:	5d                   	pop    %rbp
+  8034af:	c3                   	ret
+
+00000000008034b0 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034b0:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034b7:	00 00 00 
+  8034ba:	83 38 00             	cmpl   $0x0,(%rax)
+  8034bd:	74 0a                	je     8034c9 <fsipc_env+0x19>
+    return fsenv;
+}
+  8034bf:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034c6:	00 00 
+  8034c8:	c3                   	ret
+fsipc_env(void) {
+  8034c9:	55                   	push   %rbp
+  8034ca:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034cd:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034d2:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  8034d9:	00 00 00 
+  8034dc:	ff d0                	call   *%rax
+  8034de:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8034e5:	00 00 
+}
+  8034e7:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034ee:	00 00 
+  8034f0:	5d                   	pop    %rbp
+  8034f1:	c3                   	ret
+
+00000000008034f2 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8034f2:	55                   	push   %rbp
+  8034f3:	48 89 e5             	mov    %rsp,%rbp
+  8034f6:	53                   	push   %rbx
+  8034f7:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8034fb:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803502:	00 
+  803503:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80350a:	00 
+  80350b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803512:	00 
+  803513:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80351a:	00 
+  80351b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803522:	00 
+
+    assert(size <= sizeof(words));
+  803523:	48 83 fa 28          	cmp    $0x28,%rdx
+  803527:	77 38                	ja     803561 <fsipc_short+0x6f>
+  803529:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80352b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80352f:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  803536:	00 00 00 
+  803539:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80353b:	48 b8 b0 34 80 00 00 	movabs $0x8034b0,%rax
+  803542:	00 00 00 
+  803545:	ff d0                	call   *%rax
+  803547:	89 c7                	mov    %eax,%edi
+  803549:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80354d:	89 de                	mov    %ebx,%esi
+  80354f:	48 b8 b9 55 80 00 00 	movabs $0x8055b9,%rax
+  803556:	00 00 00 
+  803559:	ff d0                	call   *%rax
+}
+  80355b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80355f:	c9                   	leave
+  803560:	c3                   	ret
+    assert(size <= sizeof(words));
+  803561:	48 b9 00 62 80 00 00 	movabs $0x806200,%rcx
+  803568:	00 00 00 
+  80356b:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803572:	00 00 00 
+  803575:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80357a:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803581:	00 00 00 
+  803584:	b8 00 00 00 00       	mov    $0x0,%eax
+  803589:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  803590:	00 00 00 
+  803593:	41 ff d0             	call   *%r8
+
+0000000000803596 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803596:	55                   	push   %rbp
+  803597:	48 89 e5             	mov    %rsp,%rbp
+  80359a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  80359e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035a1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035a4:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035a7:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035ac:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035b0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035b5:	48 b8 f2 34 80 00 00 	movabs $0x8034f2,%rax
+  8035bc:	00 00 00 
+  8035bf:	ff d0                	call   *%rax
+}
+  8035c1:	c9                   	leave
+  8035c2:	c3                   	ret
+
+00000000008035c3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035c3:	55                   	push   %rbp
+  8035c4:	48 89 e5             	mov    %rsp,%rbp
+  8035c7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035cb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035d1:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035d6:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035da:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035df:	48 b8 f2 34 80 00 00 	movabs $0x8034f2,%rax
+  8035e6:	00 00 00 
+  8035e9:	ff d0                	call   *%rax
+}
+  8035eb:	c9                   	leave
+  8035ec:	c3                   	ret
+
+00000000008035ed <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8035ed:	55                   	push   %rbp
+  8035ee:	48 89 e5             	mov    %rsp,%rbp
+  8035f1:	41 54                	push   %r12
+  8035f3:	53                   	push   %rbx
+  8035f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f8:	89 fb                	mov    %edi,%ebx
+  8035fa:	49 89 f4             	mov    %rsi,%r12
+  8035fd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803601:	48 b8 b0 34 80 00 00 	movabs $0x8034b0,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+  80360d:	89 c7                	mov    %eax,%edi
+  80360f:	6a 00                	push   $0x0
+  803611:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803615:	50                   	push   %rax
+  803616:	4d 89 e1             	mov    %r12,%r9
+  803619:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80361f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803624:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80362b:	00 00 00 
+  80362e:	89 de                	mov    %ebx,%esi
+  803630:	48 b8 54 55 80 00 00 	movabs $0x805554,%rax
+  803637:	00 00 00 
+  80363a:	ff d0                	call   *%rax
+}
+  80363c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803640:	5b                   	pop    %rbx
+  803641:	41 5c                	pop    %r12
+  803643:	5d                   	pop    %rbp
+  803644:	c3                   	ret
+
+0000000000803645 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803645:	55                   	push   %rbp
+  803646:	48 89 e5             	mov    %rsp,%rbp
+  803649:	41 54                	push   %r12
+  80364b:	53                   	push   %rbx
+  80364c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80364f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803652:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803659:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80365b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803660:	be 00 00 00 00       	mov    $0x0,%esi
+  803665:	bf 05 00 00 00       	mov    $0x5,%edi
+  80366a:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  803671:	00 00 00 
+  803674:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803676:	85 c0                	test   %eax,%eax
+  803678:	78 5a                	js     8036d4 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80367a:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803681:	00 00 00 
+  803684:	4c 89 e6             	mov    %r12,%rsi
+  803687:	48 89 df             	mov    %rbx,%rdi
+  80368a:	48 b8 b8 1f 80 00 00 	movabs $0x801fb8,%rax
+  803691:	00 00 00 
+  803694:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803696:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80369d:	00 
+  80369e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036a4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036ab:	00 
+  8036ac:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036b2:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036b9:	00 
+  8036ba:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036c1:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036c8:	00 
+  8036c9:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036d4:	5b                   	pop    %rbx
+  8036d5:	41 5c                	pop    %r12
+  8036d7:	5d                   	pop    %rbp
+  8036d8:	c3                   	ret
+
+00000000008036d9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036d9:	55                   	push   %rbp
+  8036da:	48 89 e5             	mov    %rsp,%rbp
+  8036dd:	41 57                	push   %r15
+  8036df:	41 56                	push   %r14
+  8036e1:	41 55                	push   %r13
+  8036e3:	41 54                	push   %r12
+  8036e5:	53                   	push   %rbx
+  8036e6:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8036ea:	48 85 ff             	test   %rdi,%rdi
+  8036ed:	0f 84 a1 00 00 00    	je     803794 <devfile_read+0xbb>
+  8036f3:	49 89 ff             	mov    %rdi,%r15
+  8036f6:	49 89 f5             	mov    %rsi,%r13
+  8036f9:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8036fc:	48 85 f6             	test   %rsi,%rsi
+  8036ff:	0f 84 c4 00 00 00    	je     8037c9 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803705:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80370c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80370d:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803714:	00 00 00 
+  803717:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80371b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80371e:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803722:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803727:	be 00 00 00 00       	mov    $0x0,%esi
+  80372c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803731:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  803738:	00 00 00 
+  80373b:	ff d0                	call   *%rax
+        if (res < 0) {
+  80373d:	85 c0                	test   %eax,%eax
+  80373f:	0f 88 b9 00 00 00    	js     8037fe <devfile_read+0x125>
+        assert(res <= n);
+  803745:	48 63 d8             	movslq %eax,%rbx
+  803748:	49 39 dc             	cmp    %rbx,%r12
+  80374b:	0f 82 b1 00 00 00    	jb     803802 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803751:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803756:	0f 87 db 00 00 00    	ja     803837 <devfile_read+0x15e>
+        if (!res) {
+  80375c:	85 c0                	test   %eax,%eax
+  80375e:	74 21                	je     803781 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803760:	48 89 da             	mov    %rbx,%rdx
+  803763:	4c 89 f6             	mov    %r14,%rsi
+  803766:	4c 89 ef             	mov    %r13,%rdi
+  803769:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  803770:	00 00 00 
+  803773:	ff d0                	call   *%rax
+        total_read += res;
+  803775:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803779:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  80377c:	49 29 dc             	sub    %rbx,%r12
+  80377f:	75 96                	jne    803717 <devfile_read+0x3e>
+    return total_read;
+  803781:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803785:	48 83 c4 18          	add    $0x18,%rsp
+  803789:	5b                   	pop    %rbx
+  80378a:	41 5c                	pop    %r12
+  80378c:	41 5d                	pop    %r13
+  80378e:	41 5e                	pop    %r14
+  803790:	41 5f                	pop    %r15
+  803792:	5d                   	pop    %rbp
+  803793:	c3                   	ret
+    assert(fd);
+  803794:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  80379b:	00 00 00 
+  80379e:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037a5:	00 00 00 
+  8037a8:	be 91 00 00 00       	mov    $0x91,%esi
+  8037ad:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037b4:	00 00 00 
+  8037b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037bc:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  8037c3:	00 00 00 
+  8037c6:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037c9:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  8037d0:	00 00 00 
+  8037d3:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037da:	00 00 00 
+  8037dd:	be 92 00 00 00       	mov    $0x92,%esi
+  8037e2:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037e9:	00 00 00 
+  8037ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f1:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  8037f8:	00 00 00 
+  8037fb:	41 ff d0             	call   *%r8
+            return res;
+  8037fe:	48 98                	cltq
+  803800:	eb 83                	jmp    803785 <devfile_read+0xac>
+        assert(res <= n);
+  803802:	48 b9 3d 62 80 00 00 	movabs $0x80623d,%rcx
+  803809:	00 00 00 
+  80380c:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803813:	00 00 00 
+  803816:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80381b:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803822:	00 00 00 
+  803825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80382a:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  803831:	00 00 00 
+  803834:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803837:	48 b9 48 62 80 00 00 	movabs $0x806248,%rcx
+  80383e:	00 00 00 
+  803841:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803848:	00 00 00 
+  80384b:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803850:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803857:	00 00 00 
+  80385a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385f:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  803866:	00 00 00 
+  803869:	41 ff d0             	call   *%r8
+
+000000000080386c <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80386c:	55                   	push   %rbp
+  80386d:	48 89 e5             	mov    %rsp,%rbp
+  803870:	41 57                	push   %r15
+  803872:	41 56                	push   %r14
+  803874:	41 55                	push   %r13
+  803876:	41 54                	push   %r12
+  803878:	53                   	push   %rbx
+  803879:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  80387d:	48 85 ff             	test   %rdi,%rdi
+  803880:	0f 84 83 00 00 00    	je     803909 <devfile_write+0x9d>
+  803886:	49 89 ff             	mov    %rdi,%r15
+  803889:	49 89 f4             	mov    %rsi,%r12
+  80388c:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  80388f:	48 85 f6             	test   %rsi,%rsi
+  803892:	0f 84 a6 00 00 00    	je     80393e <devfile_write+0xd2>
+    size_t total_written = 0;
+  803898:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80389e:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038a5:	00 00 00 
+  8038a8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038ac:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038af:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038b3:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038b8:	48 39 d3             	cmp    %rdx,%rbx
+  8038bb:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038bf:	4c 89 e6             	mov    %r12,%rsi
+  8038c2:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038c9:	00 00 00 
+  8038cc:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8038d3:	00 00 00 
+  8038d6:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8038e2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8038e7:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  8038ee:	00 00 00 
+  8038f1:	ff d0                	call   *%rax
+        if (res < 0) {
+  8038f3:	85 c0                	test   %eax,%eax
+  8038f5:	78 7c                	js     803973 <devfile_write+0x107>
+        total_written += res;
+  8038f7:	48 98                	cltq
+  8038f9:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8038fc:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8038ff:	48 29 c3             	sub    %rax,%rbx
+  803902:	75 a4                	jne    8038a8 <devfile_write+0x3c>
+    return total_written;
+  803904:	4c 89 e8             	mov    %r13,%rax
+  803907:	eb 6c                	jmp    803975 <devfile_write+0x109>
+    assert(fd);
+  803909:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  803910:	00 00 00 
+  803913:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80391a:	00 00 00 
+  80391d:	be bd 00 00 00       	mov    $0xbd,%esi
+  803922:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803929:	00 00 00 
+  80392c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803931:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  803938:	00 00 00 
+  80393b:	41 ff d0             	call   *%r8
+    assert(buf);
+  80393e:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  803945:	00 00 00 
+  803948:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80394f:	00 00 00 
+  803952:	be be 00 00 00       	mov    $0xbe,%esi
+  803957:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80395e:	00 00 00 
+  803961:	b8 00 00 00 00       	mov    $0x0,%eax
+  803966:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  80396d:	00 00 00 
+  803970:	41 ff d0             	call   *%r8
+            return res;
+  803973:	48 98                	cltq
+}
+  803975:	48 83 c4 08          	add    $0x8,%rsp
+  803979:	5b                   	pop    %rbx
+  80397a:	41 5c                	pop    %r12
+  80397c:	41 5d                	pop    %r13
+  80397e:	41 5e                	pop    %r14
+  803980:	41 5f                	pop    %r15
+  803982:	5d                   	pop    %rbp
+  803983:	c3                   	ret
+
+0000000000803984 <open>:
+open(const char *path, int mode) {
+  803984:	55                   	push   %rbp
+  803985:	48 89 e5             	mov    %rsp,%rbp
+  803988:	41 55                	push   %r13
+  80398a:	41 54                	push   %r12
+  80398c:	53                   	push   %rbx
+  80398d:	48 83 ec 18          	sub    $0x18,%rsp
+  803991:	49 89 fc             	mov    %rdi,%r12
+  803994:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803997:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  80399e:	00 00 00 
+  8039a1:	ff d0                	call   *%rax
+  8039a3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039a9:	0f 87 8f 00 00 00    	ja     803a3e <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039af:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039b3:	48 b8 a9 2d 80 00 00 	movabs $0x802da9,%rax
+  8039ba:	00 00 00 
+  8039bd:	ff d0                	call   *%rax
+  8039bf:	89 c3                	mov    %eax,%ebx
+  8039c1:	85 c0                	test   %eax,%eax
+  8039c3:	78 55                	js     803a1a <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039c5:	4c 89 e6             	mov    %r12,%rsi
+  8039c8:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039cf:	00 00 00 
+  8039d2:	48 89 df             	mov    %rbx,%rdi
+  8039d5:	48 b8 b8 1f 80 00 00 	movabs $0x801fb8,%rax
+  8039dc:	00 00 00 
+  8039df:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039e1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039ed:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8039f1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8039f6:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  8039fd:	00 00 00 
+  803a00:	ff d0                	call   *%rax
+  803a02:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a04:	85 c0                	test   %eax,%eax
+  803a06:	78 1f                	js     803a27 <open+0xa3>
+    return fd2num(fd);
+  803a08:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a0c:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  803a13:	00 00 00 
+  803a16:	ff d0                	call   *%rax
+  803a18:	89 c3                	mov    %eax,%ebx
+}
+  803a1a:	89 d8                	mov    %ebx,%eax
+  803a1c:	48 83 c4 18          	add    $0x18,%rsp
+  803a20:	5b                   	pop    %rbx
+  803a21:	41 5c                	pop    %r12
+  803a23:	41 5d                	pop    %r13
+  803a25:	5d                   	pop    %rbp
+  803a26:	c3                   	ret
+        fd_close(fd, 0);
+  803a27:	be 00 00 00 00       	mov    $0x0,%esi
+  803a2c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a30:	48 b8 c4 2e 80 00 00 	movabs $0x802ec4,%rax
+  803a37:	00 00 00 
+  803a3a:	ff d0                	call   *%rax
+        return res;
+  803a3c:	eb dc                	jmp    803a1a <open+0x96>
+        return -E_BAD_PATH;
+  803a3e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a43:	eb d5                	jmp    803a1a <open+0x96>
+
+0000000000803a45 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a45:	55                   	push   %rbp
+  803a46:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a49:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a4e:	be 00 00 00 00       	mov    $0x0,%esi
+  803a53:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a58:	48 b8 f2 34 80 00 00 	movabs $0x8034f2,%rax
+  803a5f:	00 00 00 
+  803a62:	ff d0                	call   *%rax
+}
+  803a64:	5d                   	pop    %rbp
+  803a65:	c3                   	ret
+
+0000000000803a66 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a66:	55                   	push   %rbp
+  803a67:	48 89 e5             	mov    %rsp,%rbp
+  803a6a:	41 56                	push   %r14
+  803a6c:	41 55                	push   %r13
+  803a6e:	41 54                	push   %r12
+  803a70:	53                   	push   %rbx
+  803a71:	48 83 ec 10          	sub    $0x10,%rsp
+  803a75:	41 89 f6             	mov    %esi,%r14d
+  803a78:	49 89 d4             	mov    %rdx,%r12
+  803a7b:	48 89 cb             	mov    %rcx,%rbx
+  803a7e:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a81:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a85:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  803a8c:	00 00 00 
+  803a8f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a91:	85 c0                	test   %eax,%eax
+  803a93:	78 46                	js     803adb <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803a95:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a99:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803aa0:	00 00 00 
+  803aa3:	8b 00                	mov    (%rax),%eax
+  803aa5:	39 02                	cmp    %eax,(%rdx)
+  803aa7:	75 3f                	jne    803ae8 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803aa9:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ab0:	00 00 00 
+  803ab3:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ab6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ab8:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803abc:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ac0:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ac4:	48 89 da             	mov    %rbx,%rdx
+  803ac7:	4c 89 e6             	mov    %r12,%rsi
+  803aca:	bf 09 00 00 00       	mov    $0x9,%edi
+  803acf:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  803ad6:	00 00 00 
+  803ad9:	ff d0                	call   *%rax
+}
+  803adb:	48 83 c4 10          	add    $0x10,%rsp
+  803adf:	5b                   	pop    %rbx
+  803ae0:	41 5c                	pop    %r12
+  803ae2:	41 5d                	pop    %r13
+  803ae4:	41 5e                	pop    %r14
+  803ae6:	5d                   	pop    %rbp
+  803ae7:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ae8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803aed:	eb ec                	jmp    803adb <file_map+0x75>
+
+0000000000803aef <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803aef:	55                   	push   %rbp
+  803af0:	48 89 e5             	mov    %rsp,%rbp
+  803af3:	41 54                	push   %r12
+  803af5:	53                   	push   %rbx
+  803af6:	48 83 ec 20          	sub    $0x20,%rsp
+  803afa:	41 89 f4             	mov    %esi,%r12d
+  803afd:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b00:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b04:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  803b0b:	00 00 00 
+  803b0e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b10:	85 c0                	test   %eax,%eax
+  803b12:	78 3c                	js     803b50 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b18:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b1f:	00 00 00 
+  803b22:	8b 0a                	mov    (%rdx),%ecx
+  803b24:	39 08                	cmp    %ecx,(%rax)
+  803b26:	75 31                	jne    803b59 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b28:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b2b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b2e:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b32:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b36:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b3b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b3f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b44:	48 b8 f2 34 80 00 00 	movabs $0x8034f2,%rax
+  803b4b:	00 00 00 
+  803b4e:	ff d0                	call   *%rax
+}
+  803b50:	48 83 c4 20          	add    $0x20,%rsp
+  803b54:	5b                   	pop    %rbx
+  803b55:	41 5c                	pop    %r12
+  803b57:	5d                   	pop    %rbp
+  803b58:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b59:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b5e:	eb f0                	jmp    803b50 <file_msync+0x61>
+
+0000000000803b60 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b60:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b64:	7f 01                	jg     803b67 <writebuf+0x7>
+  803b66:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b67:	55                   	push   %rbp
+  803b68:	48 89 e5             	mov    %rsp,%rbp
+  803b6b:	53                   	push   %rbx
+  803b6c:	48 83 ec 08          	sub    $0x8,%rsp
+  803b70:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b73:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b77:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b7b:	8b 3f                	mov    (%rdi),%edi
+  803b7d:	48 b8 1b 32 80 00 00 	movabs $0x80321b,%rax
+  803b84:	00 00 00 
+  803b87:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803b89:	48 85 c0             	test   %rax,%rax
+  803b8c:	7e 04                	jle    803b92 <writebuf+0x32>
+  803b8e:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803b92:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803b96:	48 39 c2             	cmp    %rax,%rdx
+  803b99:	74 0f                	je     803baa <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803b9b:	48 85 c0             	test   %rax,%rax
+  803b9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ba3:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803ba7:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803baa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bae:	c9                   	leave
+  803baf:	c3                   	ret
+
+0000000000803bb0 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bb0:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bb3:	8d 50 01             	lea    0x1(%rax),%edx
+  803bb6:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bb9:	48 98                	cltq
+  803bbb:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bc0:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bc6:	74 01                	je     803bc9 <putch+0x19>
+  803bc8:	c3                   	ret
+putch(int ch, void *arg) {
+  803bc9:	55                   	push   %rbp
+  803bca:	48 89 e5             	mov    %rsp,%rbp
+  803bcd:	53                   	push   %rbx
+  803bce:	48 83 ec 08          	sub    $0x8,%rsp
+  803bd2:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bd5:	48 89 f7             	mov    %rsi,%rdi
+  803bd8:	48 b8 60 3b 80 00 00 	movabs $0x803b60,%rax
+  803bdf:	00 00 00 
+  803be2:	ff d0                	call   *%rax
+        state->offset = 0;
+  803be4:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803beb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bef:	c9                   	leave
+  803bf0:	c3                   	ret
+
+0000000000803bf1 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803bf1:	55                   	push   %rbp
+  803bf2:	48 89 e5             	mov    %rsp,%rbp
+  803bf5:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803bfc:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803bff:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c05:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c0c:	00 00 00 
+    state.result = 0;
+  803c0f:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c16:	00 00 00 00 
+    state.error = 1;
+  803c1a:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c21:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c24:	48 89 f2             	mov    %rsi,%rdx
+  803c27:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c2e:	48 bf b0 3b 80 00 00 	movabs $0x803bb0,%rdi
+  803c35:	00 00 00 
+  803c38:	48 b8 d1 17 80 00 00 	movabs $0x8017d1,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c44:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c4b:	7f 14                	jg     803c61 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c4d:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c54:	48 85 c0             	test   %rax,%rax
+  803c57:	75 06                	jne    803c5f <vfprintf+0x6e>
+  803c59:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c5f:	c9                   	leave
+  803c60:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c61:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c68:	48 b8 60 3b 80 00 00 	movabs $0x803b60,%rax
+  803c6f:	00 00 00 
+  803c72:	ff d0                	call   *%rax
+  803c74:	eb d7                	jmp    803c4d <vfprintf+0x5c>
+
+0000000000803c76 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c76:	55                   	push   %rbp
+  803c77:	48 89 e5             	mov    %rsp,%rbp
+  803c7a:	48 83 ec 50          	sub    $0x50,%rsp
+  803c7e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c82:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803c86:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c8a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803c8e:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803c95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c9d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ca1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ca5:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ca9:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cb5:	c9                   	leave
+  803cb6:	c3                   	ret
+
+0000000000803cb7 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cb7:	55                   	push   %rbp
+  803cb8:	48 89 e5             	mov    %rsp,%rbp
+  803cbb:	48 83 ec 50          	sub    $0x50,%rsp
+  803cbf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cc3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cc7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ccb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ccf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cd3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cda:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ce2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ce6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803cea:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cee:	48 89 fe             	mov    %rdi,%rsi
+  803cf1:	bf 01 00 00 00       	mov    $0x1,%edi
+  803cf6:	48 b8 f1 3b 80 00 00 	movabs $0x803bf1,%rax
+  803cfd:	00 00 00 
+  803d00:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d02:	c9                   	leave
+  803d03:	c3                   	ret
+
+0000000000803d04 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d04:	55                   	push   %rbp
+  803d05:	48 89 e5             	mov    %rsp,%rbp
+  803d08:	41 54                	push   %r12
+  803d0a:	53                   	push   %rbx
+  803d0b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d0e:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  803d15:	00 00 00 
+  803d18:	ff d0                	call   *%rax
+  803d1a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d1d:	48 be 70 62 80 00 00 	movabs $0x806270,%rsi
+  803d24:	00 00 00 
+  803d27:	48 89 df             	mov    %rbx,%rdi
+  803d2a:	48 b8 b8 1f 80 00 00 	movabs $0x801fb8,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d36:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d3b:	41 2b 04 24          	sub    (%r12),%eax
+  803d3f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d4c:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d4f:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d56:	00 00 00 
+  803d59:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d65:	5b                   	pop    %rbx
+  803d66:	41 5c                	pop    %r12
+  803d68:	5d                   	pop    %rbp
+  803d69:	c3                   	ret
+
+0000000000803d6a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d6a:	55                   	push   %rbp
+  803d6b:	48 89 e5             	mov    %rsp,%rbp
+  803d6e:	41 54                	push   %r12
+  803d70:	53                   	push   %rbx
+  803d71:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d79:	48 89 fe             	mov    %rdi,%rsi
+  803d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d81:	49 bc f5 27 80 00 00 	movabs $0x8027f5,%r12
+  803d88:	00 00 00 
+  803d8b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803d8e:	48 89 df             	mov    %rbx,%rdi
+  803d91:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  803d98:	00 00 00 
+  803d9b:	ff d0                	call   *%rax
+  803d9d:	48 89 c6             	mov    %rax,%rsi
+  803da0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803daa:	41 ff d4             	call   *%r12
+}
+  803dad:	5b                   	pop    %rbx
+  803dae:	41 5c                	pop    %r12
+  803db0:	5d                   	pop    %rbp
+  803db1:	c3                   	ret
+
+0000000000803db2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803db2:	55                   	push   %rbp
+  803db3:	48 89 e5             	mov    %rsp,%rbp
+  803db6:	41 57                	push   %r15
+  803db8:	41 56                	push   %r14
+  803dba:	41 55                	push   %r13
+  803dbc:	41 54                	push   %r12
+  803dbe:	53                   	push   %rbx
+  803dbf:	48 83 ec 18          	sub    $0x18,%rsp
+  803dc3:	49 89 fc             	mov    %rdi,%r12
+  803dc6:	49 89 f5             	mov    %rsi,%r13
+  803dc9:	49 89 d7             	mov    %rdx,%r15
+  803dcc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dd0:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  803dd7:	00 00 00 
+  803dda:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803ddc:	4d 85 ff             	test   %r15,%r15
+  803ddf:	0f 84 af 00 00 00    	je     803e94 <devpipe_write+0xe2>
+  803de5:	48 89 c3             	mov    %rax,%rbx
+  803de8:	4c 89 f8             	mov    %r15,%rax
+  803deb:	4d 89 ef             	mov    %r13,%r15
+  803dee:	4c 01 e8             	add    %r13,%rax
+  803df1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803df5:	49 bd eb 26 80 00 00 	movabs $0x8026eb,%r13
+  803dfc:	00 00 00 
+            sys_yield();
+  803dff:	49 be 7c 26 80 00 00 	movabs $0x80267c,%r14
+  803e06:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e09:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e0c:	48 63 ce             	movslq %esi,%rcx
+  803e0f:	48 63 03             	movslq (%rbx),%rax
+  803e12:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e18:	48 39 c1             	cmp    %rax,%rcx
+  803e1b:	72 2e                	jb     803e4b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e1d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e22:	48 89 da             	mov    %rbx,%rdx
+  803e25:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e2a:	4c 89 e7             	mov    %r12,%rdi
+  803e2d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e30:	85 c0                	test   %eax,%eax
+  803e32:	74 66                	je     803e9a <devpipe_write+0xe8>
+            sys_yield();
+  803e34:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e37:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e3a:	48 63 ce             	movslq %esi,%rcx
+  803e3d:	48 63 03             	movslq (%rbx),%rax
+  803e40:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e46:	48 39 c1             	cmp    %rax,%rcx
+  803e49:	73 d2                	jae    803e1d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e4b:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e4f:	48 89 ca             	mov    %rcx,%rdx
+  803e52:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e56:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e5d:	08 10 20 
+  803e60:	48 f7 e2             	mul    %rdx
+  803e63:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e67:	48 89 d0             	mov    %rdx,%rax
+  803e6a:	48 c1 e0 09          	shl    $0x9,%rax
+  803e6e:	48 29 d0             	sub    %rdx,%rax
+  803e71:	48 c1 e0 03          	shl    $0x3,%rax
+  803e75:	48 29 c1             	sub    %rax,%rcx
+  803e78:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e7d:	83 c6 01             	add    $0x1,%esi
+  803e80:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e83:	49 83 c7 01          	add    $0x1,%r15
+  803e87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e8b:	49 39 c7             	cmp    %rax,%r15
+  803e8e:	0f 85 75 ff ff ff    	jne    803e09 <devpipe_write+0x57>
+    return n;
+  803e94:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e98:	eb 05                	jmp    803e9f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9f:	48 83 c4 18          	add    $0x18,%rsp
+  803ea3:	5b                   	pop    %rbx
+  803ea4:	41 5c                	pop    %r12
+  803ea6:	41 5d                	pop    %r13
+  803ea8:	41 5e                	pop    %r14
+  803eaa:	41 5f                	pop    %r15
+  803eac:	5d                   	pop    %rbp
+  803ead:	c3                   	ret
+
+0000000000803eae <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803eae:	55                   	push   %rbp
+  803eaf:	48 89 e5             	mov    %rsp,%rbp
+  803eb2:	41 57                	push   %r15
+  803eb4:	41 56                	push   %r14
+  803eb6:	41 55                	push   %r13
+  803eb8:	41 54                	push   %r12
+  803eba:	53                   	push   %rbx
+  803ebb:	48 83 ec 18          	sub    $0x18,%rsp
+  803ebf:	49 89 fc             	mov    %rdi,%r12
+  803ec2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ec6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803eca:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  803ed1:	00 00 00 
+  803ed4:	ff d0                	call   *%rax
+  803ed6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ed9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803edf:	49 bd eb 26 80 00 00 	movabs $0x8026eb,%r13
+  803ee6:	00 00 00 
+            sys_yield();
+  803ee9:	49 be 7c 26 80 00 00 	movabs $0x80267c,%r14
+  803ef0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803ef3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ef8:	74 7d                	je     803f77 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803efa:	8b 03                	mov    (%rbx),%eax
+  803efc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803eff:	75 26                	jne    803f27 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f01:	4d 85 ff             	test   %r15,%r15
+  803f04:	75 77                	jne    803f7d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f06:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f0b:	48 89 da             	mov    %rbx,%rdx
+  803f0e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f13:	4c 89 e7             	mov    %r12,%rdi
+  803f16:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f19:	85 c0                	test   %eax,%eax
+  803f1b:	74 72                	je     803f8f <devpipe_read+0xe1>
+            sys_yield();
+  803f1d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f20:	8b 03                	mov    (%rbx),%eax
+  803f22:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f25:	74 df                	je     803f06 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f27:	48 63 c8             	movslq %eax,%rcx
+  803f2a:	48 89 ca             	mov    %rcx,%rdx
+  803f2d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f31:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f38:	08 10 20 
+  803f3b:	48 89 d0             	mov    %rdx,%rax
+  803f3e:	48 f7 e6             	mul    %rsi
+  803f41:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f45:	48 89 d0             	mov    %rdx,%rax
+  803f48:	48 c1 e0 09          	shl    $0x9,%rax
+  803f4c:	48 29 d0             	sub    %rdx,%rax
+  803f4f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f56:	00 
+  803f57:	48 89 c8             	mov    %rcx,%rax
+  803f5a:	48 29 d0             	sub    %rdx,%rax
+  803f5d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f62:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f66:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f6a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f6d:	49 83 c7 01          	add    $0x1,%r15
+  803f71:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f75:	75 83                	jne    803efa <devpipe_read+0x4c>
+    return n;
+  803f77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f7b:	eb 03                	jmp    803f80 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f7d:	4c 89 f8             	mov    %r15,%rax
+}
+  803f80:	48 83 c4 18          	add    $0x18,%rsp
+  803f84:	5b                   	pop    %rbx
+  803f85:	41 5c                	pop    %r12
+  803f87:	41 5d                	pop    %r13
+  803f89:	41 5e                	pop    %r14
+  803f8b:	41 5f                	pop    %r15
+  803f8d:	5d                   	pop    %rbp
+  803f8e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f94:	eb ea                	jmp    803f80 <devpipe_read+0xd2>
+
+0000000000803f96 <pipe>:
+pipe(int pfd[2]) {
+  803f96:	55                   	push   %rbp
+  803f97:	48 89 e5             	mov    %rsp,%rbp
+  803f9a:	41 55                	push   %r13
+  803f9c:	41 54                	push   %r12
+  803f9e:	53                   	push   %rbx
+  803f9f:	48 83 ec 18          	sub    $0x18,%rsp
+  803fa3:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fa6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803faa:	48 b8 a9 2d 80 00 00 	movabs $0x802da9,%rax
+  803fb1:	00 00 00 
+  803fb4:	ff d0                	call   *%rax
+  803fb6:	89 c3                	mov    %eax,%ebx
+  803fb8:	85 c0                	test   %eax,%eax
+  803fba:	0f 88 a0 01 00 00    	js     804160 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fc0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fc5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fca:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd3:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  803fda:	00 00 00 
+  803fdd:	ff d0                	call   *%rax
+  803fdf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fe1:	85 c0                	test   %eax,%eax
+  803fe3:	0f 88 77 01 00 00    	js     804160 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fe9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803fed:	48 b8 a9 2d 80 00 00 	movabs $0x802da9,%rax
+  803ff4:	00 00 00 
+  803ff7:	ff d0                	call   *%rax
+  803ff9:	89 c3                	mov    %eax,%ebx
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	0f 88 43 01 00 00    	js     804146 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804003:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804008:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80400d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804011:	bf 00 00 00 00       	mov    $0x0,%edi
+  804016:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  80401d:	00 00 00 
+  804020:	ff d0                	call   *%rax
+  804022:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804024:	85 c0                	test   %eax,%eax
+  804026:	0f 88 1a 01 00 00    	js     804146 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80402c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804030:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  804037:	00 00 00 
+  80403a:	ff d0                	call   *%rax
+  80403c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80403f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804044:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804049:	48 89 c6             	mov    %rax,%rsi
+  80404c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804051:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  804058:	00 00 00 
+  80405b:	ff d0                	call   *%rax
+  80405d:	89 c3                	mov    %eax,%ebx
+  80405f:	85 c0                	test   %eax,%eax
+  804061:	0f 88 c5 00 00 00    	js     80412c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804067:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80406b:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  804072:	00 00 00 
+  804075:	ff d0                	call   *%rax
+  804077:	48 89 c1             	mov    %rax,%rcx
+  80407a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804080:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804086:	ba 00 00 00 00       	mov    $0x0,%edx
+  80408b:	4c 89 ee             	mov    %r13,%rsi
+  80408e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804093:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  80409a:	00 00 00 
+  80409d:	ff d0                	call   *%rax
+  80409f:	89 c3                	mov    %eax,%ebx
+  8040a1:	85 c0                	test   %eax,%eax
+  8040a3:	78 6e                	js     804113 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040aa:	4c 89 ef             	mov    %r13,%rdi
+  8040ad:	48 b8 b3 26 80 00 00 	movabs $0x8026b3,%rax
+  8040b4:	00 00 00 
+  8040b7:	ff d0                	call   *%rax
+  8040b9:	83 f8 02             	cmp    $0x2,%eax
+  8040bc:	0f 85 ab 00 00 00    	jne    80416d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040c2:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040c9:	00 00 
+  8040cb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040cf:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040d1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040d5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040dc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040e0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040e6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040ed:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040f1:	48 bb 7b 2d 80 00 00 	movabs $0x802d7b,%rbx
+  8040f8:	00 00 00 
+  8040fb:	ff d3                	call   *%rbx
+  8040fd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804101:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804105:	ff d3                	call   *%rbx
+  804107:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80410c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804111:	eb 4d                	jmp    804160 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804113:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804118:	4c 89 ee             	mov    %r13,%rsi
+  80411b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804120:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  804127:	00 00 00 
+  80412a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80412c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804131:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804135:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413a:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  804141:	00 00 00 
+  804144:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804146:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80414b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80414f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804154:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  80415b:	00 00 00 
+  80415e:	ff d0                	call   *%rax
+}
+  804160:	89 d8                	mov    %ebx,%eax
+  804162:	48 83 c4 18          	add    $0x18,%rsp
+  804166:	5b                   	pop    %rbx
+  804167:	41 5c                	pop    %r12
+  804169:	41 5d                	pop    %r13
+  80416b:	5d                   	pop    %rbp
+  80416c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80416d:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  804174:	00 00 00 
+  804177:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80417e:	00 00 00 
+  804181:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804186:	48 bf 77 62 80 00 00 	movabs $0x806277,%rdi
+  80418d:	00 00 00 
+  804190:	b8 00 00 00 00       	mov    $0x0,%eax
+  804195:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  80419c:	00 00 00 
+  80419f:	41 ff d0             	call   *%r8
+
+00000000008041a2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041a2:	55                   	push   %rbp
+  8041a3:	48 89 e5             	mov    %rsp,%rbp
+  8041a6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041aa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041ae:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  8041b5:	00 00 00 
+  8041b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041ba:	85 c0                	test   %eax,%eax
+  8041bc:	78 35                	js     8041f3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041be:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041c2:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  8041c9:	00 00 00 
+  8041cc:	ff d0                	call   *%rax
+  8041ce:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041d1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041db:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041df:	48 b8 eb 26 80 00 00 	movabs $0x8026eb,%rax
+  8041e6:	00 00 00 
+  8041e9:	ff d0                	call   *%rax
+  8041eb:	85 c0                	test   %eax,%eax
+  8041ed:	0f 94 c0             	sete   %al
+  8041f0:	0f b6 c0             	movzbl %al,%eax
+}
+  8041f3:	c9                   	leave
+  8041f4:	c3                   	ret
+
+00000000008041f5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8041f5:	48 89 f8             	mov    %rdi,%rax
+  8041f8:	48 c1 e8 27          	shr    $0x27,%rax
+  8041fc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804203:	01 00 00 
+  804206:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80420a:	f6 c2 01             	test   $0x1,%dl
+  80420d:	74 6d                	je     80427c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80420f:	48 89 f8             	mov    %rdi,%rax
+  804212:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804216:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80421d:	01 00 00 
+  804220:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804224:	f6 c2 01             	test   $0x1,%dl
+  804227:	74 62                	je     80428b <get_uvpt_entry+0x96>
+  804229:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804230:	01 00 00 
+  804233:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804237:	f6 c2 80             	test   $0x80,%dl
+  80423a:	75 4f                	jne    80428b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80423c:	48 89 f8             	mov    %rdi,%rax
+  80423f:	48 c1 e8 15          	shr    $0x15,%rax
+  804243:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80424a:	01 00 00 
+  80424d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804251:	f6 c2 01             	test   $0x1,%dl
+  804254:	74 44                	je     80429a <get_uvpt_entry+0xa5>
+  804256:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80425d:	01 00 00 
+  804260:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804264:	f6 c2 80             	test   $0x80,%dl
+  804267:	75 31                	jne    80429a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804269:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80426d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804274:	01 00 00 
+  804277:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80427b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80427c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804283:	01 00 00 
+  804286:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80428a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80428b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804292:	01 00 00 
+  804295:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804299:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80429a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042a1:	01 00 00 
+  8042a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042a8:	c3                   	ret
+
+00000000008042a9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042a9:	55                   	push   %rbp
+  8042aa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042ad:	48 b8 f5 41 80 00 00 	movabs $0x8041f5,%rax
+  8042b4:	00 00 00 
+  8042b7:	ff d0                	call   *%rax
+  8042b9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042bc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042c1:	89 c1                	mov    %eax,%ecx
+  8042c3:	83 c9 04             	or     $0x4,%ecx
+  8042c6:	f6 c2 01             	test   $0x1,%dl
+  8042c9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042cc:	89 c1                	mov    %eax,%ecx
+  8042ce:	83 c9 02             	or     $0x2,%ecx
+  8042d1:	f6 c2 02             	test   $0x2,%dl
+  8042d4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042d7:	89 c1                	mov    %eax,%ecx
+  8042d9:	83 c9 01             	or     $0x1,%ecx
+  8042dc:	48 85 d2             	test   %rdx,%rdx
+  8042df:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042e2:	89 c1                	mov    %eax,%ecx
+  8042e4:	83 c9 40             	or     $0x40,%ecx
+  8042e7:	f6 c6 04             	test   $0x4,%dh
+  8042ea:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8042ed:	5d                   	pop    %rbp
+  8042ee:	c3                   	ret
+
+00000000008042ef <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8042ef:	55                   	push   %rbp
+  8042f0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042f3:	48 b8 f5 41 80 00 00 	movabs $0x8041f5,%rax
+  8042fa:	00 00 00 
+  8042fd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8042ff:	48 c1 e8 06          	shr    $0x6,%rax
+  804303:	83 e0 01             	and    $0x1,%eax
+}
+  804306:	5d                   	pop    %rbp
+  804307:	c3                   	ret
+
+0000000000804308 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804308:	55                   	push   %rbp
+  804309:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80430c:	48 b8 f5 41 80 00 00 	movabs $0x8041f5,%rax
+  804313:	00 00 00 
+  804316:	ff d0                	call   *%rax
+  804318:	83 e0 01             	and    $0x1,%eax
+}
+  80431b:	5d                   	pop    %rbp
+  80431c:	c3                   	ret
+
+000000000080431d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80431d:	55                   	push   %rbp
+  80431e:	48 89 e5             	mov    %rsp,%rbp
+  804321:	41 57                	push   %r15
+  804323:	41 56                	push   %r14
+  804325:	41 55                	push   %r13
+  804327:	41 54                	push   %r12
+  804329:	53                   	push   %rbx
+  80432a:	48 83 ec 28          	sub    $0x28,%rsp
+  80432e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804332:	48 85 ff             	test   %rdi,%rdi
+  804335:	74 1e                	je     804355 <foreach_shared_region+0x38>
+  804337:	49 89 ff             	mov    %rdi,%r15
+  80433a:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804340:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804346:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80434d:	01 00 00 
+  804350:	e9 72 02 00 00       	jmp    8045c7 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804355:	48 b9 ac 62 80 00 00 	movabs $0x8062ac,%rcx
+  80435c:	00 00 00 
+  80435f:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804366:	00 00 00 
+  804369:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80436e:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  804375:	00 00 00 
+  804378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80437d:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  804384:	00 00 00 
+  804387:	41 ff d0             	call   *%r8
+  80438a:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804391:	eb 6c                	jmp    8043ff <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804393:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80439a:	ff ff ff 
+  80439d:	4c 21 e2             	and    %r12,%rdx
+  8043a0:	48 89 d8             	mov    %rbx,%rax
+  8043a3:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043a8:	48 83 c0 01          	add    $0x1,%rax
+  8043ac:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043b0:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043b7:	00 00 00 
+  8043ba:	48 21 c8             	and    %rcx,%rax
+  8043bd:	48 09 d0             	or     %rdx,%rax
+  8043c0:	49 89 c4             	mov    %rax,%r12
+  8043c3:	eb 30                	jmp    8043f5 <foreach_shared_region+0xd8>
+  8043c5:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043cc:	ff ff ff 
+  8043cf:	4c 21 e2             	and    %r12,%rdx
+  8043d2:	48 89 d8             	mov    %rbx,%rax
+  8043d5:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043da:	48 83 c0 01          	add    $0x1,%rax
+  8043de:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043e2:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043e9:	00 00 00 
+  8043ec:	48 21 c8             	and    %rcx,%rax
+  8043ef:	48 09 d0             	or     %rdx,%rax
+  8043f2:	49 89 c4             	mov    %rax,%r12
+  8043f5:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8043f9:	0f 84 99 01 00 00    	je     804598 <foreach_shared_region+0x27b>
+  8043ff:	4c 89 e3             	mov    %r12,%rbx
+  804402:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804406:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80440d:	01 00 00 
+  804410:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804414:	a8 01                	test   $0x1,%al
+  804416:	0f 84 77 ff ff ff    	je     804393 <foreach_shared_region+0x76>
+  80441c:	a8 80                	test   $0x80,%al
+  80441e:	74 19                	je     804439 <foreach_shared_region+0x11c>
+  804420:	f6 c4 04             	test   $0x4,%ah
+  804423:	74 a0                	je     8043c5 <foreach_shared_region+0xa8>
+  804425:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80442c:	40 
+  80442d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804431:	4c 89 e7             	mov    %r12,%rdi
+  804434:	41 ff d7             	call   *%r15
+  804437:	eb 8c                	jmp    8043c5 <foreach_shared_region+0xa8>
+  804439:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804440:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804444:	eb 46                	jmp    80448c <foreach_shared_region+0x16f>
+  804446:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80444d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804453:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804457:	48 c1 e0 15          	shl    $0x15,%rax
+  80445b:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804460:	49 09 c4             	or     %rax,%r12
+  804463:	eb 1d                	jmp    804482 <foreach_shared_region+0x165>
+  804465:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80446c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804472:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804476:	48 c1 e0 15          	shl    $0x15,%rax
+  80447a:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80447f:	49 09 c4             	or     %rax,%r12
+  804482:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804486:	0f 84 d3 00 00 00    	je     80455f <foreach_shared_region+0x242>
+  80448c:	4c 89 e3             	mov    %r12,%rbx
+  80448f:	48 c1 eb 15          	shr    $0x15,%rbx
+  804493:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80449a:	01 00 00 
+  80449d:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044a1:	a8 01                	test   $0x1,%al
+  8044a3:	74 a1                	je     804446 <foreach_shared_region+0x129>
+  8044a5:	a8 80                	test   $0x80,%al
+  8044a7:	74 19                	je     8044c2 <foreach_shared_region+0x1a5>
+  8044a9:	f6 c4 04             	test   $0x4,%ah
+  8044ac:	74 b7                	je     804465 <foreach_shared_region+0x148>
+  8044ae:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044b5:	00 
+  8044b6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044ba:	4c 89 e7             	mov    %r12,%rdi
+  8044bd:	41 ff d7             	call   *%r15
+  8044c0:	eb a3                	jmp    804465 <foreach_shared_region+0x148>
+  8044c2:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044c8:	eb 3b                	jmp    804505 <foreach_shared_region+0x1e8>
+  8044ca:	f6 c4 04             	test   $0x4,%ah
+  8044cd:	74 12                	je     8044e1 <foreach_shared_region+0x1c4>
+  8044cf:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044d6:	00 
+  8044d7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044db:	4c 89 e7             	mov    %r12,%rdi
+  8044de:	41 ff d7             	call   *%r15
+  8044e1:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8044e8:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044ee:	48 83 c3 01          	add    $0x1,%rbx
+  8044f2:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8044f6:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8044fc:	49 09 dc             	or     %rbx,%r12
+  8044ff:	41 83 ed 01          	sub    $0x1,%r13d
+  804503:	74 2f                	je     804534 <foreach_shared_region+0x217>
+  804505:	4c 89 e3             	mov    %r12,%rbx
+  804508:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80450c:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804510:	a8 01                	test   $0x1,%al
+  804512:	75 b6                	jne    8044ca <foreach_shared_region+0x1ad>
+  804514:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80451b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804521:	48 83 c3 01          	add    $0x1,%rbx
+  804525:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804529:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80452f:	49 09 dc             	or     %rbx,%r12
+  804532:	eb cb                	jmp    8044ff <foreach_shared_region+0x1e2>
+  804534:	4c 89 e0             	mov    %r12,%rax
+  804537:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80453d:	49 c1 ec 15          	shr    $0x15,%r12
+  804541:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804548:	49 83 c4 01          	add    $0x1,%r12
+  80454c:	49 c1 e4 15          	shl    $0x15,%r12
+  804550:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804557:	49 09 c4             	or     %rax,%r12
+  80455a:	e9 23 ff ff ff       	jmp    804482 <foreach_shared_region+0x165>
+  80455f:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804563:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80456a:	ff ff ff 
+  80456d:	4c 21 e0             	and    %r12,%rax
+  804570:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804574:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80457b:	49 83 c4 01          	add    $0x1,%r12
+  80457f:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804583:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  80458a:	00 00 00 
+  80458d:	49 21 d4             	and    %rdx,%r12
+  804590:	49 09 c4             	or     %rax,%r12
+  804593:	e9 5d fe ff ff       	jmp    8043f5 <foreach_shared_region+0xd8>
+  804598:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80459f:	00 ff ff 
+  8045a2:	4c 21 e0             	and    %r12,%rax
+  8045a5:	49 c1 ec 27          	shr    $0x27,%r12
+  8045a9:	49 83 c4 01          	add    $0x1,%r12
+  8045ad:	49 c1 e4 27          	shl    $0x27,%r12
+  8045b1:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045b8:	ff 00 00 
+  8045bb:	49 21 d4             	and    %rdx,%r12
+  8045be:	49 09 c4             	or     %rax,%r12
+  8045c1:	41 83 ed 01          	sub    $0x1,%r13d
+  8045c5:	74 48                	je     80460f <foreach_shared_region+0x2f2>
+  8045c7:	4c 89 e0             	mov    %r12,%rax
+  8045ca:	48 c1 e8 27          	shr    $0x27,%rax
+  8045ce:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045d5:	01 00 00 
+  8045d8:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045dc:	f6 c2 01             	test   $0x1,%dl
+  8045df:	0f 85 a5 fd ff ff    	jne    80438a <foreach_shared_region+0x6d>
+  8045e5:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8045ec:	00 ff ff 
+  8045ef:	4c 21 e2             	and    %r12,%rdx
+  8045f2:	48 83 c0 01          	add    $0x1,%rax
+  8045f6:	48 c1 e0 27          	shl    $0x27,%rax
+  8045fa:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804601:	ff 00 00 
+  804604:	48 21 c8             	and    %rcx,%rax
+  804607:	48 09 d0             	or     %rdx,%rax
+  80460a:	49 89 c4             	mov    %rax,%r12
+  80460d:	eb b2                	jmp    8045c1 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80460f:	4d 85 e4             	test   %r12,%r12
+  804612:	75 14                	jne    804628 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804614:	b8 00 00 00 00       	mov    $0x0,%eax
+  804619:	48 83 c4 28          	add    $0x28,%rsp
+  80461d:	5b                   	pop    %rbx
+  80461e:	41 5c                	pop    %r12
+  804620:	41 5d                	pop    %r13
+  804622:	41 5e                	pop    %r14
+  804624:	41 5f                	pop    %r15
+  804626:	5d                   	pop    %rbp
+  804627:	c3                   	ret
+    assert(addr == 0);
+  804628:	48 b9 bb 62 80 00 00 	movabs $0x8062bb,%rcx
+  80462f:	00 00 00 
+  804632:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804639:	00 00 00 
+  80463c:	be 67 00 00 00       	mov    $0x67,%esi
+  804641:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  804648:	00 00 00 
+  80464b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804650:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  804657:	00 00 00 
+  80465a:	41 ff d0             	call   *%r8
+
+000000000080465d <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80465d:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804664:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804667:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80466d:	eb 33                	jmp    8046a2 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80466f:	48 83 c0 20          	add    $0x20,%rax
+  804673:	4c 39 c0             	cmp    %r8,%rax
+  804676:	74 25                	je     80469d <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804678:	48 8b 10             	mov    (%rax),%rdx
+  80467b:	48 85 d2             	test   %rdx,%rdx
+  80467e:	74 ef                	je     80466f <mmap_place+0x12>
+  804680:	48 89 d1             	mov    %rdx,%rcx
+  804683:	48 03 48 08          	add    0x8(%rax),%rcx
+  804687:	48 39 cf             	cmp    %rcx,%rdi
+  80468a:	73 e3                	jae    80466f <mmap_place+0x12>
+  80468c:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804690:	4c 39 ca             	cmp    %r9,%rdx
+  804693:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804697:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  80469b:	eb d2                	jmp    80466f <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  80469d:	45 84 d2             	test   %r10b,%r10b
+  8046a0:	74 12                	je     8046b4 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046a2:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046a9:	00 00 00 
+        moved = 0;
+  8046ac:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046b2:	eb c4                	jmp    804678 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046b4:	48 01 fe             	add    %rdi,%rsi
+  8046b7:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046be:	00 00 00 
+  8046c1:	48 39 f0             	cmp    %rsi,%rax
+  8046c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c9:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046cd:	c3                   	ret
+
+00000000008046ce <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046ce:	55                   	push   %rbp
+  8046cf:	48 89 e5             	mov    %rsp,%rbp
+  8046d2:	41 57                	push   %r15
+  8046d4:	41 56                	push   %r14
+  8046d6:	41 55                	push   %r13
+  8046d8:	41 54                	push   %r12
+  8046da:	53                   	push   %rbx
+  8046db:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046df:	48 8b 1f             	mov    (%rdi),%rbx
+  8046e2:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046e9:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046f0:	00 00 00 
+  8046f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046f8:	eb 12                	jmp    80470c <mmap_pgfault+0x3e>
+  8046fa:	48 83 c2 01          	add    $0x1,%rdx
+  8046fe:	48 83 c0 20          	add    $0x20,%rax
+  804702:	48 83 fa 20          	cmp    $0x20,%rdx
+  804706:	0f 84 04 01 00 00    	je     804810 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80470c:	48 8b 08             	mov    (%rax),%rcx
+  80470f:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804713:	48 39 de             	cmp    %rbx,%rsi
+  804716:	73 e2                	jae    8046fa <mmap_pgfault+0x2c>
+  804718:	48 03 48 08          	add    0x8(%rax),%rcx
+  80471c:	48 39 cb             	cmp    %rcx,%rbx
+  80471f:	73 d9                	jae    8046fa <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804721:	48 c1 e2 05          	shl    $0x5,%rdx
+  804725:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80472c:	00 00 00 
+  80472f:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804733:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804737:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80473b:	f6 c2 01             	test   $0x1,%dl
+  80473e:	0f 84 e0 00 00 00    	je     804824 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804744:	b8 00 00 00 00       	mov    $0x0,%eax
+  804749:	f6 c2 02             	test   $0x2,%dl
+  80474c:	0f 84 c3 00 00 00    	je     804815 <mmap_pgfault+0x147>
+  804752:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804759:	ff ff ff 
+  80475c:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804760:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804767:	00 00 00 
+  80476a:	48 39 ca             	cmp    %rcx,%rdx
+  80476d:	0f 85 a2 00 00 00    	jne    804815 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804773:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804778:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80477d:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804784:	00 00 00 
+  804787:	bf 00 00 00 00       	mov    $0x0,%edi
+  80478c:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  804793:	00 00 00 
+  804796:	ff d0                	call   *%rax
+  804798:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  80479a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479f:	85 d2                	test   %edx,%edx
+  8047a1:	78 72                	js     804815 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a8:	48 89 de             	mov    %rbx,%rsi
+  8047ab:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047b2:	00 00 00 
+  8047b5:	4c 89 e7             	mov    %r12,%rdi
+  8047b8:	48 b8 6f 23 80 00 00 	movabs $0x80236f,%rax
+  8047bf:	00 00 00 
+  8047c2:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047c4:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047ca:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047d0:	48 89 d9             	mov    %rbx,%rcx
+  8047d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d8:	4c 89 e6             	mov    %r12,%rsi
+  8047db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047e0:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  8047e7:	00 00 00 
+  8047ea:	ff d0                	call   *%rax
+  8047ec:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8047ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047f3:	4c 89 e6             	mov    %r12,%rsi
+  8047f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047fb:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  804802:	00 00 00 
+  804805:	ff d0                	call   *%rax
+    return res >= 0;
+  804807:	89 d8                	mov    %ebx,%eax
+  804809:	f7 d0                	not    %eax
+  80480b:	c1 e8 1f             	shr    $0x1f,%eax
+  80480e:	eb 05                	jmp    804815 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804810:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804815:	48 83 c4 18          	add    $0x18,%rsp
+  804819:	5b                   	pop    %rbx
+  80481a:	41 5c                	pop    %r12
+  80481c:	41 5d                	pop    %r13
+  80481e:	41 5e                	pop    %r14
+  804820:	41 5f                	pop    %r15
+  804822:	5d                   	pop    %rbp
+  804823:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804824:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804828:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  80482c:	4c 03 30             	add    (%rax),%r14
+  80482f:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804836:	49 39 c6             	cmp    %rax,%r14
+  804839:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80483d:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804844:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80484a:	49 bf 08 43 80 00 00 	movabs $0x804308,%r15
+  804851:	00 00 00 
+  804854:	4d 39 f4             	cmp    %r14,%r12
+  804857:	73 1d                	jae    804876 <mmap_pgfault+0x1a8>
+  804859:	4c 89 e7             	mov    %r12,%rdi
+  80485c:	41 ff d7             	call   *%r15
+  80485f:	84 c0                	test   %al,%al
+  804861:	75 13                	jne    804876 <mmap_pgfault+0x1a8>
+  804863:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80486a:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804871:	4d 39 f4             	cmp    %r14,%r12
+  804874:	72 e3                	jb     804859 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804876:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  80487c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804880:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804884:	74 2a                	je     8048b0 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804886:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80488a:	89 de                	mov    %ebx,%esi
+  80488c:	2b 30                	sub    (%rax),%esi
+  80488e:	03 70 1c             	add    0x1c(%rax),%esi
+  804891:	8b 78 18             	mov    0x18(%rax),%edi
+  804894:	4c 89 e9             	mov    %r13,%rcx
+  804897:	48 89 da             	mov    %rbx,%rdx
+  80489a:	48 b8 66 3a 80 00 00 	movabs $0x803a66,%rax
+  8048a1:	00 00 00 
+  8048a4:	ff d0                	call   *%rax
+    return res > 0;
+  8048a6:	85 c0                	test   %eax,%eax
+  8048a8:	0f 9f c0             	setg   %al
+  8048ab:	e9 65 ff ff ff       	jmp    804815 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048b0:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048b4:	eb d0                	jmp    804886 <mmap_pgfault+0x1b8>
+
+00000000008048b6 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048b6:	55                   	push   %rbp
+  8048b7:	48 89 e5             	mov    %rsp,%rbp
+  8048ba:	41 57                	push   %r15
+  8048bc:	41 56                	push   %r14
+  8048be:	41 55                	push   %r13
+  8048c0:	41 54                	push   %r12
+  8048c2:	53                   	push   %rbx
+  8048c3:	48 83 ec 28          	sub    $0x28,%rsp
+  8048c7:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048cb:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048ce:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048d5:	ff ff ff 
+  8048d8:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048e1:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8048e8:	00 00 00 
+  8048eb:	48 39 ca             	cmp    %rcx,%rdx
+  8048ee:	0f 85 e5 00 00 00    	jne    8049d9 <mmap_writeback+0x123>
+  8048f4:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8048f7:	4c 39 ee             	cmp    %r13,%rsi
+  8048fa:	0f 83 e8 00 00 00    	jae    8049e8 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804900:	49 be 08 43 80 00 00 	movabs $0x804308,%r14
+  804907:	00 00 00 
+  80490a:	49 bf ef 42 80 00 00 	movabs $0x8042ef,%r15
+  804911:	00 00 00 
+  804914:	eb 10                	jmp    804926 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804916:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80491d:	4d 39 ec             	cmp    %r13,%r12
+  804920:	0f 83 ae 00 00 00    	jae    8049d4 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804926:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80492a:	4c 89 e7             	mov    %r12,%rdi
+  80492d:	41 ff d6             	call   *%r14
+  804930:	84 c0                	test   %al,%al
+  804932:	74 e2                	je     804916 <mmap_writeback+0x60>
+  804934:	4c 89 e7             	mov    %r12,%rdi
+  804937:	41 ff d7             	call   *%r15
+  80493a:	84 c0                	test   %al,%al
+  80493c:	74 d8                	je     804916 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80493e:	4c 89 e3             	mov    %r12,%rbx
+  804941:	4d 39 ec             	cmp    %r13,%r12
+  804944:	73 20                	jae    804966 <mmap_writeback+0xb0>
+  804946:	48 89 df             	mov    %rbx,%rdi
+  804949:	41 ff d6             	call   *%r14
+  80494c:	84 c0                	test   %al,%al
+  80494e:	74 16                	je     804966 <mmap_writeback+0xb0>
+  804950:	48 89 df             	mov    %rbx,%rdi
+  804953:	41 ff d7             	call   *%r15
+  804956:	84 c0                	test   %al,%al
+  804958:	74 0c                	je     804966 <mmap_writeback+0xb0>
+  80495a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804961:	4c 39 eb             	cmp    %r13,%rbx
+  804964:	72 e0                	jb     804946 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804966:	48 89 d9             	mov    %rbx,%rcx
+  804969:	4c 29 e1             	sub    %r12,%rcx
+  80496c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804970:	44 89 e6             	mov    %r12d,%esi
+  804973:	2b 30                	sub    (%rax),%esi
+  804975:	49 89 c4             	mov    %rax,%r12
+  804978:	03 70 1c             	add    0x1c(%rax),%esi
+  80497b:	8b 78 18             	mov    0x18(%rax),%edi
+  80497e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804982:	48 89 ca             	mov    %rcx,%rdx
+  804985:	48 b8 ef 3a 80 00 00 	movabs $0x803aef,%rax
+  80498c:	00 00 00 
+  80498f:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804991:	85 c0                	test   %eax,%eax
+  804993:	78 44                	js     8049d9 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804995:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80499a:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  80499d:	41 89 c1             	mov    %eax,%r9d
+  8049a0:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049a7:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049ab:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049b4:	48 89 ce             	mov    %rcx,%rsi
+  8049b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049bc:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  8049c3:	00 00 00 
+  8049c6:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049c8:	85 c0                	test   %eax,%eax
+  8049ca:	78 0d                	js     8049d9 <mmap_writeback+0x123>
+  8049cc:	49 89 dc             	mov    %rbx,%r12
+  8049cf:	e9 49 ff ff ff       	jmp    80491d <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049d9:	48 83 c4 28          	add    $0x28,%rsp
+  8049dd:	5b                   	pop    %rbx
+  8049de:	41 5c                	pop    %r12
+  8049e0:	41 5d                	pop    %r13
+  8049e2:	41 5e                	pop    %r14
+  8049e4:	41 5f                	pop    %r15
+  8049e6:	5d                   	pop    %rbp
+  8049e7:	c3                   	ret
+    return 0;
+  8049e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049ed:	eb ea                	jmp    8049d9 <mmap_writeback+0x123>
+
+00000000008049ef <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8049ef:	55                   	push   %rbp
+  8049f0:	48 89 e5             	mov    %rsp,%rbp
+  8049f3:	41 57                	push   %r15
+  8049f5:	41 56                	push   %r14
+  8049f7:	41 55                	push   %r13
+  8049f9:	41 54                	push   %r12
+  8049fb:	53                   	push   %rbx
+  8049fc:	48 83 ec 38          	sub    $0x38,%rsp
+  804a00:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a04:	48 85 f6             	test   %rsi,%rsi
+  804a07:	0f 84 0c 02 00 00    	je     804c19 <mmap+0x22a>
+  804a0d:	49 89 ff             	mov    %rdi,%r15
+  804a10:	49 89 f4             	mov    %rsi,%r12
+  804a13:	41 89 d5             	mov    %edx,%r13d
+  804a16:	41 89 ce             	mov    %ecx,%r14d
+  804a19:	44 89 cb             	mov    %r9d,%ebx
+  804a1c:	45 85 c9             	test   %r9d,%r9d
+  804a1f:	0f 88 f4 01 00 00    	js     804c19 <mmap+0x22a>
+  804a25:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a2c:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a33:	0f 85 e7 01 00 00    	jne    804c20 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a39:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a3c:	83 fa 04             	cmp    $0x4,%edx
+  804a3f:	0f 85 db 01 00 00    	jne    804c20 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a45:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a48:	83 fa 01             	cmp    $0x1,%edx
+  804a4b:	0f 87 cf 01 00 00    	ja     804c20 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a51:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a55:	44 89 c7             	mov    %r8d,%edi
+  804a58:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  804a5f:	00 00 00 
+  804a62:	ff d0                	call   *%rax
+  804a64:	89 c2                	mov    %eax,%edx
+  804a66:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a6d:	85 d2                	test   %edx,%edx
+  804a6f:	0f 88 ab 01 00 00    	js     804c20 <mmap+0x231>
+  804a75:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a79:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a80:	00 00 00 
+  804a83:	8b 09                	mov    (%rcx),%ecx
+  804a85:	39 0a                	cmp    %ecx,(%rdx)
+  804a87:	0f 85 93 01 00 00    	jne    804c20 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804a8d:	8b 52 08             	mov    0x8(%rdx),%edx
+  804a90:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804a93:	83 fa 01             	cmp    $0x1,%edx
+  804a96:	0f 84 84 01 00 00    	je     804c20 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804a9c:	41 83 fe 01          	cmp    $0x1,%r14d
+  804aa0:	74 42                	je     804ae4 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804aa2:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804aa9:	4c 89 e6             	mov    %r12,%rsi
+  804aac:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ab3:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ab7:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804abb:	4d 85 ff             	test   %r15,%r15
+  804abe:	74 67                	je     804b27 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ac0:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ac7:	75 0f                	jne    804ad8 <mmap+0xe9>
+  804ac9:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804ad0:	00 00 00 
+  804ad3:	49 39 c7             	cmp    %rax,%r15
+  804ad6:	77 1b                	ja     804af3 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804ad8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804adf:	e9 3c 01 00 00       	jmp    804c20 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ae4:	41 f6 c5 02          	test   $0x2,%r13b
+  804ae8:	74 b8                	je     804aa2 <mmap+0xb3>
+  804aea:	85 d2                	test   %edx,%edx
+  804aec:	75 b4                	jne    804aa2 <mmap+0xb3>
+  804aee:	e9 2d 01 00 00       	jmp    804c20 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804af3:	4c 89 ff             	mov    %r15,%rdi
+  804af6:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  804afd:	00 00 00 
+  804b00:	ff d0                	call   *%rax
+  804b02:	48 89 c2             	mov    %rax,%rdx
+  804b05:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b0c:	49 39 d7             	cmp    %rdx,%r15
+  804b0f:	0f 85 0b 01 00 00    	jne    804c20 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b15:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b1c:	00 00 00 
+  804b1f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b25:	eb 44                	jmp    804b6b <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b27:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b2b:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b32:	00 00 00 
+  804b35:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  804b3c:	00 00 00 
+  804b3f:	ff d0                	call   *%rax
+  804b41:	48 89 c7             	mov    %rax,%rdi
+  804b44:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b48:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b4f:	48 85 ff             	test   %rdi,%rdi
+  804b52:	75 c1                	jne    804b15 <mmap+0x126>
+  804b54:	e9 c7 00 00 00       	jmp    804c20 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b59:	49 83 c4 01          	add    $0x1,%r12
+  804b5d:	48 83 c0 20          	add    $0x20,%rax
+  804b61:	49 83 fc 20          	cmp    $0x20,%r12
+  804b65:	0f 84 a5 00 00 00    	je     804c10 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b6b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b6f:	75 e8                	jne    804b59 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b71:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b75:	48 b8 a9 2d 80 00 00 	movabs $0x802da9,%rax
+  804b7c:	00 00 00 
+  804b7f:	ff d0                	call   *%rax
+  804b81:	89 c2                	mov    %eax,%edx
+  804b83:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b8a:	85 d2                	test   %edx,%edx
+  804b8c:	0f 88 8e 00 00 00    	js     804c20 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804b92:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804b96:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  804b9d:	00 00 00 
+  804ba0:	ff d0                	call   *%rax
+  804ba2:	89 c6                	mov    %eax,%esi
+  804ba4:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804ba7:	48 b8 c9 2f 80 00 00 	movabs $0x802fc9,%rax
+  804bae:	00 00 00 
+  804bb1:	ff d0                	call   *%rax
+  804bb3:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bb6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bbd:	45 85 ff             	test   %r15d,%r15d
+  804bc0:	78 5e                	js     804c20 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bc2:	49 c1 e4 05          	shl    $0x5,%r12
+  804bc6:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bcd:	00 00 00 
+  804bd0:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bd3:	48 bf ce 46 80 00 00 	movabs $0x8046ce,%rdi
+  804bda:	00 00 00 
+  804bdd:	48 b8 9c 51 80 00 00 	movabs $0x80519c,%rax
+  804be4:	00 00 00 
+  804be7:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804be9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bed:	49 89 04 24          	mov    %rax,(%r12)
+  804bf1:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804bf5:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804bfa:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804bff:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c04:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c09:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c0e:	eb 10                	jmp    804c20 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c10:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c17:	eb 07                	jmp    804c20 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c19:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c20:	48 83 c4 38          	add    $0x38,%rsp
+  804c24:	5b                   	pop    %rbx
+  804c25:	41 5c                	pop    %r12
+  804c27:	41 5d                	pop    %r13
+  804c29:	41 5e                	pop    %r14
+  804c2b:	41 5f                	pop    %r15
+  804c2d:	5d                   	pop    %rbp
+  804c2e:	c3                   	ret
+
+0000000000804c2f <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c2f:	55                   	push   %rbp
+  804c30:	48 89 e5             	mov    %rsp,%rbp
+  804c33:	41 57                	push   %r15
+  804c35:	41 56                	push   %r14
+  804c37:	41 55                	push   %r13
+  804c39:	41 54                	push   %r12
+  804c3b:	53                   	push   %rbx
+  804c3c:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c40:	49 89 fe             	mov    %rdi,%r14
+  804c43:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c4a:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c51:	00 
+  804c52:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c59:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c60:	00 00 00 
+  804c63:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c6a:	49 bf b6 48 80 00 00 	movabs $0x8048b6,%r15
+  804c71:	00 00 00 
+  804c74:	eb 09                	jmp    804c7f <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c76:	48 83 c3 20          	add    $0x20,%rbx
+  804c7a:	4c 39 eb             	cmp    %r13,%rbx
+  804c7d:	74 33                	je     804cb2 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c7f:	48 89 df             	mov    %rbx,%rdi
+  804c82:	48 8b 33             	mov    (%rbx),%rsi
+  804c85:	4c 39 e6             	cmp    %r12,%rsi
+  804c88:	73 ec                	jae    804c76 <msync+0x47>
+  804c8a:	48 85 f6             	test   %rsi,%rsi
+  804c8d:	74 e7                	je     804c76 <msync+0x47>
+  804c8f:	48 89 f2             	mov    %rsi,%rdx
+  804c92:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804c96:	49 39 d6             	cmp    %rdx,%r14
+  804c99:	73 db                	jae    804c76 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c9b:	4c 39 e2             	cmp    %r12,%rdx
+  804c9e:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ca2:	4c 39 f6             	cmp    %r14,%rsi
+  804ca5:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ca9:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cac:	85 c0                	test   %eax,%eax
+  804cae:	79 c6                	jns    804c76 <msync+0x47>
+  804cb0:	eb 05                	jmp    804cb7 <msync+0x88>
+    }
+
+    return 0;
+  804cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cb7:	48 83 c4 08          	add    $0x8,%rsp
+  804cbb:	5b                   	pop    %rbx
+  804cbc:	41 5c                	pop    %r12
+  804cbe:	41 5d                	pop    %r13
+  804cc0:	41 5e                	pop    %r14
+  804cc2:	41 5f                	pop    %r15
+  804cc4:	5d                   	pop    %rbp
+  804cc5:	c3                   	ret
+
+0000000000804cc6 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cc6:	55                   	push   %rbp
+  804cc7:	48 89 e5             	mov    %rsp,%rbp
+  804cca:	41 57                	push   %r15
+  804ccc:	41 56                	push   %r14
+  804cce:	41 55                	push   %r13
+  804cd0:	41 54                	push   %r12
+  804cd2:	53                   	push   %rbx
+  804cd3:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cd7:	49 89 ff             	mov    %rdi,%r15
+  804cda:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804ce1:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804ce8:	00 
+  804ce9:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cf0:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804cf7:	00 00 00 
+  804cfa:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d01:	48 89 d8             	mov    %rbx,%rax
+  804d04:	eb 09                	jmp    804d0f <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d06:	48 83 c0 20          	add    $0x20,%rax
+  804d0a:	4c 39 f0             	cmp    %r14,%rax
+  804d0d:	74 40                	je     804d4f <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d0f:	48 8b 10             	mov    (%rax),%rdx
+  804d12:	4c 39 e2             	cmp    %r12,%rdx
+  804d15:	73 ef                	jae    804d06 <munmap+0x40>
+  804d17:	48 85 d2             	test   %rdx,%rdx
+  804d1a:	74 ea                	je     804d06 <munmap+0x40>
+  804d1c:	48 89 d7             	mov    %rdx,%rdi
+  804d1f:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d23:	49 39 ff             	cmp    %rdi,%r15
+  804d26:	73 de                	jae    804d06 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d28:	49 39 fc             	cmp    %rdi,%r12
+  804d2b:	72 05                	jb     804d32 <munmap+0x6c>
+  804d2d:	4c 39 fa             	cmp    %r15,%rdx
+  804d30:	73 d4                	jae    804d06 <munmap+0x40>
+  804d32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d37:	48 83 c4 08          	add    $0x8,%rsp
+  804d3b:	5b                   	pop    %rbx
+  804d3c:	41 5c                	pop    %r12
+  804d3e:	41 5d                	pop    %r13
+  804d40:	41 5e                	pop    %r14
+  804d42:	41 5f                	pop    %r15
+  804d44:	5d                   	pop    %rbp
+  804d45:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d46:	48 83 c3 20          	add    $0x20,%rbx
+  804d4a:	4c 39 f3             	cmp    %r14,%rbx
+  804d4d:	74 5c                	je     804dab <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d4f:	48 8b 33             	mov    (%rbx),%rsi
+  804d52:	4c 39 e6             	cmp    %r12,%rsi
+  804d55:	73 ef                	jae    804d46 <munmap+0x80>
+  804d57:	48 85 f6             	test   %rsi,%rsi
+  804d5a:	74 ea                	je     804d46 <munmap+0x80>
+  804d5c:	48 89 f2             	mov    %rsi,%rdx
+  804d5f:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d63:	49 39 d7             	cmp    %rdx,%r15
+  804d66:	73 de                	jae    804d46 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d68:	48 89 df             	mov    %rbx,%rdi
+  804d6b:	48 b8 b6 48 80 00 00 	movabs $0x8048b6,%rax
+  804d72:	00 00 00 
+  804d75:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d77:	85 c0                	test   %eax,%eax
+  804d79:	78 bc                	js     804d37 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d7b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d7f:	48 8b 33             	mov    (%rbx),%rsi
+  804d82:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d87:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  804d8e:	00 00 00 
+  804d91:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804d93:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804d96:	48 b8 6e 2f 80 00 00 	movabs $0x802f6e,%rax
+  804d9d:	00 00 00 
+  804da0:	ff d0                	call   *%rax
+        reg->start = 0;
+  804da2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804da9:	eb 9b                	jmp    804d46 <munmap+0x80>
+    return 0;
+  804dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db0:	eb 85                	jmp    804d37 <munmap+0x71>
+
+0000000000804db2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db7:	c3                   	ret
+
+0000000000804db8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804db8:	55                   	push   %rbp
+  804db9:	48 89 e5             	mov    %rsp,%rbp
+  804dbc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dbf:	48 be c5 62 80 00 00 	movabs $0x8062c5,%rsi
+  804dc6:	00 00 00 
+  804dc9:	48 b8 b8 1f 80 00 00 	movabs $0x801fb8,%rax
+  804dd0:	00 00 00 
+  804dd3:	ff d0                	call   *%rax
+    return 0;
+}
+  804dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dda:	5d                   	pop    %rbp
+  804ddb:	c3                   	ret
+
+0000000000804ddc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804ddc:	55                   	push   %rbp
+  804ddd:	48 89 e5             	mov    %rsp,%rbp
+  804de0:	41 57                	push   %r15
+  804de2:	41 56                	push   %r14
+  804de4:	41 55                	push   %r13
+  804de6:	41 54                	push   %r12
+  804de8:	53                   	push   %rbx
+  804de9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804df0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804df7:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804dfe:	00 00 00 00 
+  804e02:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e09:	00 00 00 00 
+  804e0d:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e14:	00 00 00 00 
+  804e18:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e1f:	00 00 00 00 
+  804e23:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e2a:	00 00 00 00 
+  804e2e:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e35:	00 00 00 00 
+  804e39:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e40:	00 
+  804e41:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e48:	00 
+  804e49:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e50:	00 
+  804e51:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e58:	00 
+  804e59:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e60:	00 
+  804e61:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e68:	00 
+  804e69:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e70:	00 
+  804e71:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e78:	00 
+  804e79:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e80:	00 
+  804e81:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804e88:	00 
+    for (res = 0; res < n; res += inc) {
+  804e89:	48 85 d2             	test   %rdx,%rdx
+  804e8c:	74 7a                	je     804f08 <devcons_write+0x12c>
+  804e8e:	49 89 d6             	mov    %rdx,%r14
+  804e91:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e97:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804e9c:	49 bf 08 23 80 00 00 	movabs $0x802308,%r15
+  804ea3:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ea6:	4c 89 f3             	mov    %r14,%rbx
+  804ea9:	48 29 f3             	sub    %rsi,%rbx
+  804eac:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804eb1:	48 39 c3             	cmp    %rax,%rbx
+  804eb4:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804eb8:	4c 63 eb             	movslq %ebx,%r13
+  804ebb:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ec2:	48 01 c6             	add    %rax,%rsi
+  804ec5:	4c 89 ea             	mov    %r13,%rdx
+  804ec8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ecf:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ed2:	4c 89 ee             	mov    %r13,%rsi
+  804ed5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804edc:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  804ee3:	00 00 00 
+  804ee6:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804ee8:	41 01 dc             	add    %ebx,%r12d
+  804eeb:	49 63 f4             	movslq %r12d,%rsi
+  804eee:	4c 39 f6             	cmp    %r14,%rsi
+  804ef1:	72 b3                	jb     804ea6 <devcons_write+0xca>
+    return res;
+  804ef3:	49 63 c4             	movslq %r12d,%rax
+}
+  804ef6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804efd:	5b                   	pop    %rbx
+  804efe:	41 5c                	pop    %r12
+  804f00:	41 5d                	pop    %r13
+  804f02:	41 5e                	pop    %r14
+  804f04:	41 5f                	pop    %r15
+  804f06:	5d                   	pop    %rbp
+  804f07:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f08:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f0e:	eb e3                	jmp    804ef3 <devcons_write+0x117>
+
+0000000000804f10 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f10:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f13:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f18:	48 85 c0             	test   %rax,%rax
+  804f1b:	74 55                	je     804f72 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f1d:	55                   	push   %rbp
+  804f1e:	48 89 e5             	mov    %rsp,%rbp
+  804f21:	41 55                	push   %r13
+  804f23:	41 54                	push   %r12
+  804f25:	53                   	push   %rbx
+  804f26:	48 83 ec 08          	sub    $0x8,%rsp
+  804f2a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f2d:	48 bb 68 25 80 00 00 	movabs $0x802568,%rbx
+  804f34:	00 00 00 
+  804f37:	49 bc 7c 26 80 00 00 	movabs $0x80267c,%r12
+  804f3e:	00 00 00 
+  804f41:	eb 03                	jmp    804f46 <devcons_read+0x36>
+  804f43:	41 ff d4             	call   *%r12
+  804f46:	ff d3                	call   *%rbx
+  804f48:	85 c0                	test   %eax,%eax
+  804f4a:	74 f7                	je     804f43 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f4c:	48 63 d0             	movslq %eax,%rdx
+  804f4f:	78 13                	js     804f64 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f56:	83 f8 04             	cmp    $0x4,%eax
+  804f59:	74 09                	je     804f64 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f5b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f5f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f64:	48 89 d0             	mov    %rdx,%rax
+  804f67:	48 83 c4 08          	add    $0x8,%rsp
+  804f6b:	5b                   	pop    %rbx
+  804f6c:	41 5c                	pop    %r12
+  804f6e:	41 5d                	pop    %r13
+  804f70:	5d                   	pop    %rbp
+  804f71:	c3                   	ret
+  804f72:	48 89 d0             	mov    %rdx,%rax
+  804f75:	c3                   	ret
+
+0000000000804f76 <cputchar>:
+cputchar(int ch) {
+  804f76:	55                   	push   %rbp
+  804f77:	48 89 e5             	mov    %rsp,%rbp
+  804f7a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f7e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f82:	be 01 00 00 00       	mov    $0x1,%esi
+  804f87:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804f8b:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  804f92:	00 00 00 
+  804f95:	ff d0                	call   *%rax
+}
+  804f97:	c9                   	leave
+  804f98:	c3                   	ret
+
+0000000000804f99 <getchar>:
+getchar(void) {
+  804f99:	55                   	push   %rbp
+  804f9a:	48 89 e5             	mov    %rsp,%rbp
+  804f9d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fa1:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fa6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804faa:	bf 00 00 00 00       	mov    $0x0,%edi
+  804faf:	48 b8 ec 30 80 00 00 	movabs $0x8030ec,%rax
+  804fb6:	00 00 00 
+  804fb9:	ff d0                	call   *%rax
+  804fbb:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fbd:	85 c0                	test   %eax,%eax
+  804fbf:	78 06                	js     804fc7 <getchar+0x2e>
+  804fc1:	74 08                	je     804fcb <getchar+0x32>
+  804fc3:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fc7:	89 d0                	mov    %edx,%eax
+  804fc9:	c9                   	leave
+  804fca:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fcb:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fd0:	eb f5                	jmp    804fc7 <getchar+0x2e>
+
+0000000000804fd2 <iscons>:
+iscons(int fdnum) {
+  804fd2:	55                   	push   %rbp
+  804fd3:	48 89 e5             	mov    %rsp,%rbp
+  804fd6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804fda:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fde:	48 b8 09 2e 80 00 00 	movabs $0x802e09,%rax
+  804fe5:	00 00 00 
+  804fe8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fea:	85 c0                	test   %eax,%eax
+  804fec:	78 18                	js     805006 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804fee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ff2:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804ff9:	00 00 00 
+  804ffc:	8b 00                	mov    (%rax),%eax
+  804ffe:	39 02                	cmp    %eax,(%rdx)
+  805000:	0f 94 c0             	sete   %al
+  805003:	0f b6 c0             	movzbl %al,%eax
+}
+  805006:	c9                   	leave
+  805007:	c3                   	ret
+
+0000000000805008 <opencons>:
+opencons(void) {
+  805008:	55                   	push   %rbp
+  805009:	48 89 e5             	mov    %rsp,%rbp
+  80500c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805010:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805014:	48 b8 a9 2d 80 00 00 	movabs $0x802da9,%rax
+  80501b:	00 00 00 
+  80501e:	ff d0                	call   *%rax
+  805020:	85 c0                	test   %eax,%eax
+  805022:	78 49                	js     80506d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805024:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805029:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80502e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805032:	bf 00 00 00 00       	mov    $0x0,%edi
+  805037:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  80503e:	00 00 00 
+  805041:	ff d0                	call   *%rax
+  805043:	85 c0                	test   %eax,%eax
+  805045:	78 26                	js     80506d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805047:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80504b:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805052:	00 00 
+  805054:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805056:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80505a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805061:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  805068:	00 00 00 
+  80506b:	ff d0                	call   *%rax
+}
+  80506d:	c9                   	leave
+  80506e:	c3                   	ret
+
+000000000080506f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80506f:	55                   	push   %rbp
+  805070:	48 89 e5             	mov    %rsp,%rbp
+  805073:	41 56                	push   %r14
+  805075:	41 55                	push   %r13
+  805077:	41 54                	push   %r12
+  805079:	53                   	push   %rbx
+  80507a:	48 83 ec 50          	sub    $0x50,%rsp
+  80507e:	49 89 fc             	mov    %rdi,%r12
+  805081:	41 89 f5             	mov    %esi,%r13d
+  805084:	48 89 d3             	mov    %rdx,%rbx
+  805087:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80508b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80508f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  805093:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80509a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80509e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050a2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050a6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050aa:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050b1:	00 00 00 
+  8050b4:	4c 8b 30             	mov    (%rax),%r14
+  8050b7:	48 b8 45 26 80 00 00 	movabs $0x802645,%rax
+  8050be:	00 00 00 
+  8050c1:	ff d0                	call   *%rax
+  8050c3:	89 c6                	mov    %eax,%esi
+  8050c5:	45 89 e8             	mov    %r13d,%r8d
+  8050c8:	4c 89 e1             	mov    %r12,%rcx
+  8050cb:	4c 89 f2             	mov    %r14,%rdx
+  8050ce:	48 bf d8 62 80 00 00 	movabs $0x8062d8,%rdi
+  8050d5:	00 00 00 
+  8050d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050dd:	49 bc 81 16 80 00 00 	movabs $0x801681,%r12
+  8050e4:	00 00 00 
+  8050e7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8050ea:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8050ee:	48 89 df             	mov    %rbx,%rdi
+  8050f1:	48 b8 1d 16 80 00 00 	movabs $0x80161d,%rax
+  8050f8:	00 00 00 
+  8050fb:	ff d0                	call   *%rax
+    cprintf("\n");
+  8050fd:	48 bf b3 61 80 00 00 	movabs $0x8061b3,%rdi
+  805104:	00 00 00 
+  805107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80510c:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80510f:	cc                   	int3
+  805110:	eb fd                	jmp    80510f <_panic+0xa0>
+
+0000000000805112 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805112:	55                   	push   %rbp
+  805113:	48 89 e5             	mov    %rsp,%rbp
+  805116:	41 56                	push   %r14
+  805118:	41 55                	push   %r13
+  80511a:	41 54                	push   %r12
+  80511c:	53                   	push   %rbx
+  80511d:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805120:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805127:	00 00 00 
+  80512a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80512e:	74 27                	je     805157 <_handle_vectored_pagefault+0x45>
+  805130:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805135:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80513c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80513f:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805142:	4c 89 e7             	mov    %r12,%rdi
+  805145:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80514a:	84 c0                	test   %al,%al
+  80514c:	75 45                	jne    805193 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80514e:	48 83 c3 01          	add    $0x1,%rbx
+  805152:	49 3b 1e             	cmp    (%r14),%rbx
+  805155:	72 eb                	jb     805142 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805157:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80515e:	00 
+  80515f:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805164:	4d 8b 04 24          	mov    (%r12),%r8
+  805168:	48 ba 00 63 80 00 00 	movabs $0x806300,%rdx
+  80516f:	00 00 00 
+  805172:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805177:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  80517e:	00 00 00 
+  805181:	b8 00 00 00 00       	mov    $0x0,%eax
+  805186:	49 ba 6f 50 80 00 00 	movabs $0x80506f,%r10
+  80518d:	00 00 00 
+  805190:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805193:	5b                   	pop    %rbx
+  805194:	41 5c                	pop    %r12
+  805196:	41 5d                	pop    %r13
+  805198:	41 5e                	pop    %r14
+  80519a:	5d                   	pop    %rbp
+  80519b:	c3                   	ret
+
+000000000080519c <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80519c:	55                   	push   %rbp
+  80519d:	48 89 e5             	mov    %rsp,%rbp
+  8051a0:	53                   	push   %rbx
+  8051a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8051a5:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051a8:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051ad:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051b4:	00 00 00 
+  8051b7:	80 38 00             	cmpb   $0x0,(%rax)
+  8051ba:	74 68                	je     805224 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051bc:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051c3:	00 00 00 
+  8051c6:	48 8b 08             	mov    (%rax),%rcx
+  8051c9:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051ce:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051d5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051d8:	48 85 c9             	test   %rcx,%rcx
+  8051db:	0f 84 e0 00 00 00    	je     8052c1 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051e1:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8051e5:	0f 84 c9 00 00 00    	je     8052b4 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051eb:	48 83 c2 01          	add    $0x1,%rdx
+  8051ef:	48 39 ca             	cmp    %rcx,%rdx
+  8051f2:	75 ed                	jne    8051e1 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8051f4:	48 83 f9 08          	cmp    $0x8,%rcx
+  8051f8:	0f 84 84 00 00 00    	je     805282 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8051fe:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805202:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805209:	00 00 00 
+  80520c:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805213:	00 00 00 
+  805216:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80521a:	85 f6                	test   %esi,%esi
+  80521c:	0f 89 97 00 00 00    	jns    8052b9 <add_pgfault_handler+0x11d>
+  805222:	eb 63                	jmp    805287 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805224:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805229:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80522e:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805235:	00 00 00 
+  805238:	bf 00 00 00 00       	mov    $0x0,%edi
+  80523d:	48 b8 1d 27 80 00 00 	movabs $0x80271d,%rax
+  805244:	00 00 00 
+  805247:	ff d0                	call   *%rax
+  805249:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80524b:	85 c0                	test   %eax,%eax
+  80524d:	78 38                	js     805287 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80524f:	48 be 9d 53 80 00 00 	movabs $0x80539d,%rsi
+  805256:	00 00 00 
+  805259:	bf 00 00 00 00       	mov    $0x0,%edi
+  80525e:	48 b8 40 29 80 00 00 	movabs $0x802940,%rax
+  805265:	00 00 00 
+  805268:	ff d0                	call   *%rax
+  80526a:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80526c:	85 c0                	test   %eax,%eax
+  80526e:	78 17                	js     805287 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805270:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805277:	00 00 00 
+  80527a:	c6 00 01             	movb   $0x1,(%rax)
+  80527d:	e9 3a ff ff ff       	jmp    8051bc <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805282:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805287:	89 f1                	mov    %esi,%ecx
+  805289:	48 ba 3e 63 80 00 00 	movabs $0x80633e,%rdx
+  805290:	00 00 00 
+  805293:	be 42 00 00 00       	mov    $0x42,%esi
+  805298:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  80529f:	00 00 00 
+  8052a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052a7:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  8052ae:	00 00 00 
+  8052b1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052b4:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052b9:	89 f0                	mov    %esi,%eax
+  8052bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052bf:	c9                   	leave
+  8052c0:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052c1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052c8:	00 00 00 
+  8052cb:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052d2:	48 89 d8             	mov    %rbx,%rax
+  8052d5:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052dc:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052df:	eb d8                	jmp    8052b9 <add_pgfault_handler+0x11d>
+
+00000000008052e1 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052e1:	55                   	push   %rbp
+  8052e2:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8052e5:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052ec:	00 00 00 
+  8052ef:	80 38 00             	cmpb   $0x0,(%rax)
+  8052f2:	74 33                	je     805327 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8052f4:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8052fb:	00 00 00 
+  8052fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805303:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80530a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80530d:	48 85 c0             	test   %rax,%rax
+  805310:	0f 84 85 00 00 00    	je     80539b <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805316:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80531a:	74 40                	je     80535c <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80531c:	48 83 c1 01          	add    $0x1,%rcx
+  805320:	48 39 c1             	cmp    %rax,%rcx
+  805323:	75 f1                	jne    805316 <remove_pgfault_handler+0x35>
+  805325:	eb 74                	jmp    80539b <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805327:	48 b9 56 63 80 00 00 	movabs $0x806356,%rcx
+  80532e:	00 00 00 
+  805331:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  805338:	00 00 00 
+  80533b:	be 48 00 00 00       	mov    $0x48,%esi
+  805340:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  805347:	00 00 00 
+  80534a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80534f:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  805356:	00 00 00 
+  805359:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80535c:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805363:	00 
+  805364:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805368:	48 29 ca             	sub    %rcx,%rdx
+  80536b:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805372:	00 00 00 
+  805375:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805379:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80537e:	48 89 ce             	mov    %rcx,%rsi
+  805381:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  805388:	00 00 00 
+  80538b:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80538d:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805394:	00 00 00 
+  805397:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80539b:	5d                   	pop    %rbp
+  80539c:	c3                   	ret
+
+000000000080539d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80539d:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053a0:	48 b8 12 51 80 00 00 	movabs $0x805112,%rax
+  8053a7:	00 00 00 
+    call *%rax
+  8053aa:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053ac:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053b3:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053b4:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053bb:	00 
+    subq $8, %rcx
+  8053bc:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053c0:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053c3:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053ca:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053cb:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053cf:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053d3:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053d8:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053dd:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053e2:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8053e7:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8053ec:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8053f1:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8053f6:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8053fb:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805400:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805405:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80540a:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80540f:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805414:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805419:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80541d:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805421:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805422:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805423:	c3                   	ret
+
+0000000000805424 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805424:	85 ff                	test   %edi,%edi
+  805426:	78 58                	js     805480 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805428:	48 85 f6             	test   %rsi,%rsi
+  80542b:	74 12                	je     80543f <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80542d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805434:	00 00 00 
+  805437:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80543d:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80543f:	48 85 c9             	test   %rcx,%rcx
+  805442:	74 12                	je     805456 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805444:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80544b:	00 00 00 
+  80544e:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805454:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805456:	48 85 d2             	test   %rdx,%rdx
+  805459:	74 14                	je     80546f <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80545b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805462:	00 00 00 
+  805465:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80546c:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80546f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805476:	00 00 00 
+  805479:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80547f:	c3                   	ret
+        if (from_env_store) {
+  805480:	48 85 f6             	test   %rsi,%rsi
+  805483:	74 06                	je     80548b <ipc_result+0x67>
+            *from_env_store = 0;
+  805485:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80548b:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80548d:	48 85 c9             	test   %rcx,%rcx
+  805490:	74 ed                	je     80547f <ipc_result+0x5b>
+            *perm_store = 0;
+  805492:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805498:	c3                   	ret
+
+0000000000805499 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805499:	55                   	push   %rbp
+  80549a:	48 89 e5             	mov    %rsp,%rbp
+  80549d:	41 55                	push   %r13
+  80549f:	41 54                	push   %r12
+  8054a1:	53                   	push   %rbx
+  8054a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8054a6:	49 89 fc             	mov    %rdi,%r12
+  8054a9:	48 89 f7             	mov    %rsi,%rdi
+  8054ac:	48 89 d3             	mov    %rdx,%rbx
+  8054af:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054b2:	48 85 f6             	test   %rsi,%rsi
+  8054b5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054bc:	00 00 00 
+  8054bf:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8054c8:	48 85 d2             	test   %rdx,%rdx
+  8054cb:	74 03                	je     8054d0 <ipc_recv+0x37>
+  8054cd:	48 8b 32             	mov    (%rdx),%rsi
+  8054d0:	48 b8 69 2c 80 00 00 	movabs $0x802c69,%rax
+  8054d7:	00 00 00 
+  8054da:	ff d0                	call   *%rax
+  8054dc:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054de:	4c 89 e9             	mov    %r13,%rcx
+  8054e1:	48 89 da             	mov    %rbx,%rdx
+  8054e4:	4c 89 e6             	mov    %r12,%rsi
+  8054e7:	48 b8 24 54 80 00 00 	movabs $0x805424,%rax
+  8054ee:	00 00 00 
+  8054f1:	ff d0                	call   *%rax
+}
+  8054f3:	48 83 c4 08          	add    $0x8,%rsp
+  8054f7:	5b                   	pop    %rbx
+  8054f8:	41 5c                	pop    %r12
+  8054fa:	41 5d                	pop    %r13
+  8054fc:	5d                   	pop    %rbp
+  8054fd:	c3                   	ret
+
+00000000008054fe <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8054fe:	55                   	push   %rbp
+  8054ff:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805502:	48 85 d2             	test   %rdx,%rdx
+  805505:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80550c:	00 00 00 
+  80550f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805513:	89 f6                	mov    %esi,%esi
+  805515:	48 b8 f5 2a 80 00 00 	movabs $0x802af5,%rax
+  80551c:	00 00 00 
+  80551f:	ff d0                	call   *%rax
+    if (res < 0) {
+  805521:	85 c0                	test   %eax,%eax
+  805523:	78 02                	js     805527 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805525:	5d                   	pop    %rbp
+  805526:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805527:	89 c1                	mov    %eax,%ecx
+  805529:	48 ba 70 63 80 00 00 	movabs $0x806370,%rdx
+  805530:	00 00 00 
+  805533:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805538:	48 bf 7d 63 80 00 00 	movabs $0x80637d,%rdi
+  80553f:	00 00 00 
+  805542:	b8 00 00 00 00       	mov    $0x0,%eax
+  805547:	49 b8 6f 50 80 00 00 	movabs $0x80506f,%r8
+  80554e:	00 00 00 
+  805551:	41 ff d0             	call   *%r8
+
+0000000000805554 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805554:	55                   	push   %rbp
+  805555:	48 89 e5             	mov    %rsp,%rbp
+  805558:	53                   	push   %rbx
+  805559:	48 83 ec 08          	sub    $0x8,%rsp
+  80555d:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805561:	48 85 d2             	test   %rdx,%rdx
+  805564:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80556b:	00 00 00 
+  80556e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805572:	4d 85 c9             	test   %r9,%r9
+  805575:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80557e:	48 85 db             	test   %rbx,%rbx
+  805581:	74 03                	je     805586 <ipc_call+0x32>
+  805583:	48 8b 03             	mov    (%rbx),%rax
+  805586:	89 f6                	mov    %esi,%esi
+  805588:	48 83 ec 08          	sub    $0x8,%rsp
+  80558c:	50                   	push   %rax
+  80558d:	48 b8 27 2b 80 00 00 	movabs $0x802b27,%rax
+  805594:	00 00 00 
+  805597:	ff d0                	call   *%rax
+  805599:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  80559b:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80559f:	48 89 da             	mov    %rbx,%rdx
+  8055a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8055a7:	48 b8 24 54 80 00 00 	movabs $0x805424,%rax
+  8055ae:	00 00 00 
+  8055b1:	ff d0                	call   *%rax
+}
+  8055b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055b7:	c9                   	leave
+  8055b8:	c3                   	ret
+
+00000000008055b9 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055b9:	55                   	push   %rbp
+  8055ba:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055bd:	89 f6                	mov    %esi,%esi
+  8055bf:	48 b8 93 2b 80 00 00 	movabs $0x802b93,%rax
+  8055c6:	00 00 00 
+  8055c9:	ff d0                	call   *%rax
+  8055cb:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8055dc:	48 b8 24 54 80 00 00 	movabs $0x805424,%rax
+  8055e3:	00 00 00 
+  8055e6:	ff d0                	call   *%rax
+}
+  8055e8:	5d                   	pop    %rbp
+  8055e9:	c3                   	ret
+
+00000000008055ea <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8055ea:	55                   	push   %rbp
+  8055eb:	48 89 e5             	mov    %rsp,%rbp
+  8055ee:	41 54                	push   %r12
+  8055f0:	53                   	push   %rbx
+  8055f1:	4c 89 cb             	mov    %r9,%rbx
+  8055f4:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8055f8:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8055fc:	48 85 d2             	test   %rdx,%rdx
+  8055ff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805606:	00 00 00 
+  805609:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80560d:	4d 85 c9             	test   %r9,%r9
+  805610:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805614:	b8 00 00 00 00       	mov    $0x0,%eax
+  805619:	4d 85 e4             	test   %r12,%r12
+  80561c:	74 04                	je     805622 <ipc_reply_wait+0x38>
+  80561e:	49 8b 04 24          	mov    (%r12),%rax
+  805622:	89 f6                	mov    %esi,%esi
+  805624:	48 83 ec 08          	sub    $0x8,%rsp
+  805628:	50                   	push   %rax
+  805629:	48 b8 fd 2b 80 00 00 	movabs $0x802bfd,%rax
+  805630:	00 00 00 
+  805633:	ff d0                	call   *%rax
+  805635:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805637:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80563b:	4c 89 e2             	mov    %r12,%rdx
+  80563e:	48 89 de             	mov    %rbx,%rsi
+  805641:	48 b8 24 54 80 00 00 	movabs $0x805424,%rax
+  805648:	00 00 00 
+  80564b:	ff d0                	call   *%rax
+}
+  80564d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805651:	5b                   	pop    %rbx
+  805652:	41 5c                	pop    %r12
+  805654:	5d                   	pop    %rbp
+  805655:	c3                   	ret
+
+0000000000805656 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805656:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80565b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805662:	00 00 00 
+  805665:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80566c:	48 01 ca             	add    %rcx,%rdx
+  80566f:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805675:	39 fa                	cmp    %edi,%edx
+  805677:	74 12                	je     80568b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805679:	48 83 c0 01          	add    $0x1,%rax
+  80567d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805683:	75 e0                	jne    805665 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80568a:	c3                   	ret
+            return envs[i].env_id;
+  80568b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805692:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805699:	00 00 00 
+  80569c:	48 01 d0             	add    %rdx,%rax
+  80569f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056a5:	c3                   	ret
+  8056a6:	66 90                	xchg   %ax,%ax
+
+00000000008056a8 <__rodata_start>:
+  8056a8:	77 00                	ja     8056aa <__rodata_start+0x2>
+  8056aa:	72 62                	jb     80570e <__rodata_start+0x66>
+  8056ac:	00 77 62             	add    %dh,0x62(%rdi)
+  8056af:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056b2:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056b9:	00 
+  8056ba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8056c0:	b3 09                	mov    $0x9,%bl
+  8056c2:	80 00 00             	addb   $0x0,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 ed                	add    %ch,%ch
+  8056c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ce:	00 00                	add    %al,(%rax)
+  8056d0:	ed                   	in     (%dx),%eax
+  8056d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056d6:	00 00                	add    %al,(%rax)
+  8056d8:	ed                   	in     (%dx),%eax
+  8056d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	ed                   	in     (%dx),%eax
+  8056e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056e6:	00 00                	add    %al,(%rax)
+  8056e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 ed                	add    %ch,%ch
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	ed                   	in     (%dx),%eax
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	8c 0a                	mov    %cs,(%rdx)
+  80571a:	80 00 00             	addb   $0x0,(%rax)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805726:	00 00                	add    %al,(%rax)
+  805728:	8c 0a                	mov    %cs,(%rdx)
+  80572a:	80 00 00             	addb   $0x0,(%rax)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	ed                   	in     (%dx),%eax
+  805769:	0d 80 00 00 00       	or     $0x80,%eax
+  80576e:	00 00                	add    %al,(%rax)
+  805770:	ed                   	in     (%dx),%eax
+  805771:	0d 80 00 00 00       	or     $0x80,%eax
+  805776:	00 00                	add    %al,(%rax)
+  805778:	ed                   	in     (%dx),%eax
+  805779:	0d 80 00 00 00       	or     $0x80,%eax
+  80577e:	00 00                	add    %al,(%rax)
+  805780:	ed                   	in     (%dx),%eax
+  805781:	0d 80 00 00 00       	or     $0x80,%eax
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	f4                   	hlt
+  805859:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80585f:	00 ed                	add    %ch,%ch
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	2c 0b                	sub    $0xb,%al
+  805872:	80 00 00             	addb   $0x0,(%rax)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 ed                	add    %ch,%ch
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058b3:	00 00                	add    %al,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 cb                	add    %cl,%bl
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	6a 0a                	push   $0xa
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 ed                	add    %ch,%ch
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	3c 0a                	cmp    $0xa,%al
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 ed                	add    %ch,%ch
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80590b:	00 00                	add    %al,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 29                	add    %ch,(%rcx)
+  805919:	0c 80                	or     $0x80,%al
+  80591b:	00 00                	add    %al,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805922:	80 00 00             	addb   $0x0,(%rax)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	1a 0b                	sbb    (%rbx),%cl
+  805932:	80 00 00             	addb   $0x0,(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 ed                	add    %ch,%ch
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ce                   	(bad)
+  805941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	f4                   	hlt
+  805959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80595f:	00 37                	add    %dh,(%rdi)
+  805961:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805967:	00 5f 12             	add    %bl,0x12(%rdi)
+  80596a:	80 00 00             	addb   $0x0,(%rax)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 37                	add    %dh,(%rdi)
+  805971:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805977:	00 5f 12             	add    %bl,0x12(%rdi)
+  80597a:	80 00 00             	addb   $0x0,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80598b:	00 00                	add    %al,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 d2                	add    %dl,%dl
+  805991:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805997:	00 d2                	add    %dl,%dl
+  805999:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80599f:	00 d2                	add    %dl,%dl
+  8059a1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059a7:	00 d2                	add    %dl,%dl
+  8059a9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 f6                	add    %dh,%dh
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 f6                	add    %dh,%dh
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 22                	add    %ah,(%rdx)
+  805a11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a17:	00 22                	add    %ah,(%rdx)
+  805a19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a1f:	00 22                	add    %ah,(%rdx)
+  805a21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a27:	00 22                	add    %ah,(%rdx)
+  805a29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 46 12             	add    %al,0x12(%rsi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 22                	add    %ah,(%rdx)
+  805b21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b27:	00 22                	add    %ah,(%rdx)
+  805b29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 46 12             	add    %al,0x12(%rsi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805be0 <basefix.0>:
+  805be0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805bf0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c00:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c10:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c20:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c30:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c40:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c50:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c60:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c70:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805c80:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805c90:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805ca0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cb0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805cc0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cd0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805ce0:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805cf0:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d00:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d10:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d20:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d30:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d40:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d50:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d60:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d70:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805d80:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805d90:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805da0:	79 18 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     y...............
+  805db0:	c0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805dc0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805dd0:	d0 1e 80 00 00 00 00 00 98 18 80 00 00 00 00 00     ................
+  805de0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805df0:	8c 18 80 00 00 00 00 00 06 19 80 00 00 00 00 00     ................
+  805e00:	d0 1e 80 00 00 00 00 00 8c 18 80 00 00 00 00 00     ................
+  805e10:	d2 18 80 00 00 00 00 00 d2 18 80 00 00 00 00 00     ................
+  805e20:	d2 18 80 00 00 00 00 00 d2 18 80 00 00 00 00 00     ................
+  805e30:	d2 18 80 00 00 00 00 00 d2 18 80 00 00 00 00 00     ................
+  805e40:	d2 18 80 00 00 00 00 00 d2 18 80 00 00 00 00 00     ................
+  805e50:	d2 18 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805e60:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805e70:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805e80:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805e90:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805ea0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805eb0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805ec0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805ed0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805ee0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805ef0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f00:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f10:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f20:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f30:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f40:	d0 1e 80 00 00 00 00 00 ee 1d 80 00 00 00 00 00     ................
+  805f50:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f60:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f70:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f80:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805f90:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805fa0:	34 19 80 00 00 00 00 00 03 1b 80 00 00 00 00 00     4...............
+  805fb0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  805fc0:	d0 1e 80 00 00 00 00 00 29 19 80 00 00 00 00 00     ........).......
+  805fd0:	63 19 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     c...............
+  805fe0:	d0 1e 80 00 00 00 00 00 1e 19 80 00 00 00 00 00     ................
+  805ff0:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  806000:	ac 1c 80 00 00 00 00 00 7b 1d 80 00 00 00 00 00     ........{.......
+  806010:	d0 1e 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  806020:	fa 19 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  806030:	d7 1b 80 00 00 00 00 00 d0 1e 80 00 00 00 00 00     ................
+  806040:	d0 1e 80 00 00 00 00 00 ee 1d 80 00 00 00 00 00     ................
+  806050:	d0 1e 80 00 00 00 00 00 82 18 80 00 00 00 00 00     ................
+
+0000000000806060 <error_string>:
+	...
+  806068:	3e 5c 80 00 00 00 00 00 50 5c 80 00 00 00 00 00     >\......P\......
+  806078:	60 5c 80 00 00 00 00 00 72 5c 80 00 00 00 00 00     `\......r\......
+  806088:	80 5c 80 00 00 00 00 00 94 5c 80 00 00 00 00 00     .\.......\......
+  806098:	a9 5c 80 00 00 00 00 00 bc 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	ce 5c 80 00 00 00 00 00 e2 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	f2 5c 80 00 00 00 00 00 05 5d 80 00 00 00 00 00     .\.......]......
+  8060c8:	1c 5d 80 00 00 00 00 00 32 5d 80 00 00 00 00 00     .]......2]......
+  8060d8:	4a 5d 80 00 00 00 00 00 62 5d 80 00 00 00 00 00     J]......b]......
+  8060e8:	6f 5d 80 00 00 00 00 00 00 61 80 00 00 00 00 00     o].......a......
+  8060f8:	83 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806108:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806118:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806128:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806138:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806148:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806158:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806168:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806178:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806188:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806198:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008061e0 <devtab>:
+  8061e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8061f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806200:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806210:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806220:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806230:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806240:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806250:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806260:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806270:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806280:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806290:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062b0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062c0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062d0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8062e0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8062f0:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806300:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806310:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806320:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806330:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806340:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806350:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806360:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806370:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806380:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806390:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8063e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,10324 @@
+
+obj/user/bounds:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 8b 22 80 00 00 	movabs $0x80228b,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 4c 32 80 00 00 	movabs $0x80324c,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 4c 32 80 00 00 	movabs $0x80324c,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 22 3c 80 00 00 	movabs $0x803c22,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 1b 1f 80 00 00 	movabs $0x801f1b,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 22 3c 80 00 00 	movabs $0x803c22,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 1b 1f 80 00 00 	movabs $0x801f1b,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 94 5c 80 00 00 	movabs $0x805c94,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be d8 56 80 00 00 	movabs $0x8056d8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be da 56 80 00 00 	movabs $0x8056da,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be dd 56 80 00 00 	movabs $0x8056dd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 20 4a 80 00 00 	movabs $0x804a20,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 f7 4c 80 00 00 	movabs $0x804cf7,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 36 33 80 00 00 	movabs $0x803336,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 ff 33 80 00 00 	movabs $0x8033ff,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 05 33 80 00 00 	movabs $0x803305,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 05 33 80 00 00 	movabs $0x803305,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 4c 32 80 00 00 	movabs $0x80324c,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 58 22 80 00 00 	movabs $0x802258,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 8b 22 80 00 00 	movabs $0x80228b,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 58 22 80 00 00 	movabs $0x802258,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 58 22 80 00 00 	movabs $0x802258,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 58 22 80 00 00 	movabs $0x802258,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 b0 24 80 00 00 	movabs $0x8024b0,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 b0 24 80 00 00 	movabs $0x8024b0,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 3a 00 00 00       	call   801539 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+/* Test for UBSAN support - accessing array element with an out-of-borders index */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	48 83 ec 10          	sub    $0x10,%rsp
+    int a[4] = {0};
+    /* Trying to print the value of the fifth element of the array (which causes undefined behavior).
+     * The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+     * The access operator ([]) is not used because it will trigger -Warray-bounds option of Clang,
+     * which will make this test unrunnable because of -Werror flag which is specified in GNUmakefile. */
+    cprintf("%d\n", *(a + 5));
+  801509:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801510:	00 
+  801511:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801518:	00 
+  801519:	8b 75 04             	mov    0x4(%rbp),%esi
+  80151c:	48 bf 22 5c 80 00 00 	movabs $0x805c22,%rdi
+  801523:	00 00 00 
+  801526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152b:	48 ba b2 16 80 00 00 	movabs $0x8016b2,%rdx
+  801532:	00 00 00 
+  801535:	ff d2                	call   *%rdx
+}
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+
+0000000000801539 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+  80153d:	41 56                	push   %r14
+  80153f:	41 55                	push   %r13
+  801541:	41 54                	push   %r12
+  801543:	53                   	push   %rbx
+  801544:	41 89 fd             	mov    %edi,%r13d
+  801547:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80154a:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801551:	00 00 00 
+  801554:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80155b:	00 00 00 
+  80155e:	48 39 c2             	cmp    %rax,%rdx
+  801561:	73 17                	jae    80157a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801563:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801566:	49 89 c4             	mov    %rax,%r12
+  801569:	48 83 c3 08          	add    $0x8,%rbx
+  80156d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801572:	ff 53 f8             	call   *-0x8(%rbx)
+  801575:	4c 39 e3             	cmp    %r12,%rbx
+  801578:	72 ef                	jb     801569 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80157a:	48 b8 76 26 80 00 00 	movabs $0x802676,%rax
+  801581:	00 00 00 
+  801584:	ff d0                	call   *%rax
+  801586:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80158b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801592:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801599:	00 00 00 
+  80159c:	48 01 d0             	add    %rdx,%rax
+  80159f:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8015a6:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8015a9:	45 85 ed             	test   %r13d,%r13d
+  8015ac:	7e 0d                	jle    8015bb <libmain+0x82>
+  8015ae:	49 8b 06             	mov    (%r14),%rax
+  8015b1:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015b8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015bb:	4c 89 f6             	mov    %r14,%rsi
+  8015be:	44 89 ef             	mov    %r13d,%edi
+  8015c1:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015c8:	00 00 00 
+  8015cb:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015cd:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  8015d4:	00 00 00 
+  8015d7:	ff d0                	call   *%rax
+#endif
+}
+  8015d9:	5b                   	pop    %rbx
+  8015da:	41 5c                	pop    %r12
+  8015dc:	41 5d                	pop    %r13
+  8015de:	41 5e                	pop    %r14
+  8015e0:	5d                   	pop    %rbp
+  8015e1:	c3                   	ret
+
+00000000008015e2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015e2:	55                   	push   %rbp
+  8015e3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015e6:	48 b8 d2 2f 80 00 00 	movabs $0x802fd2,%rax
+  8015ed:	00 00 00 
+  8015f0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015f7:	48 b8 05 26 80 00 00 	movabs $0x802605,%rax
+  8015fe:	00 00 00 
+  801601:	ff d0                	call   *%rax
+}
+  801603:	5d                   	pop    %rbp
+  801604:	c3                   	ret
+
+0000000000801605 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	53                   	push   %rbx
+  80160a:	48 83 ec 08          	sub    $0x8,%rsp
+  80160e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801611:	8b 06                	mov    (%rsi),%eax
+  801613:	8d 50 01             	lea    0x1(%rax),%edx
+  801616:	89 16                	mov    %edx,(%rsi)
+  801618:	48 98                	cltq
+  80161a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80161f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801625:	74 0a                	je     801631 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801627:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80162b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801631:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801635:	be ff 00 00 00       	mov    $0xff,%esi
+  80163a:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  801641:	00 00 00 
+  801644:	ff d0                	call   *%rax
+        state->offset = 0;
+  801646:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80164c:	eb d9                	jmp    801627 <putch+0x22>
+
+000000000080164e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80164e:	55                   	push   %rbp
+  80164f:	48 89 e5             	mov    %rsp,%rbp
+  801652:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801659:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80165c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801663:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801670:	48 89 f1             	mov    %rsi,%rcx
+  801673:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80167a:	48 bf 05 16 80 00 00 	movabs $0x801605,%rdi
+  801681:	00 00 00 
+  801684:	48 b8 02 18 80 00 00 	movabs $0x801802,%rax
+  80168b:	00 00 00 
+  80168e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801690:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801697:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80169e:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  8016a5:	00 00 00 
+  8016a8:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8016aa:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016b0:	c9                   	leave
+  8016b1:	c3                   	ret
+
+00000000008016b2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016b2:	55                   	push   %rbp
+  8016b3:	48 89 e5             	mov    %rsp,%rbp
+  8016b6:	48 83 ec 50          	sub    $0x50,%rsp
+  8016ba:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016be:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016ce:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016e5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016e9:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  8016f0:	00 00 00 
+  8016f3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016f5:	c9                   	leave
+  8016f6:	c3                   	ret
+
+00000000008016f7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016f7:	55                   	push   %rbp
+  8016f8:	48 89 e5             	mov    %rsp,%rbp
+  8016fb:	41 57                	push   %r15
+  8016fd:	41 56                	push   %r14
+  8016ff:	41 55                	push   %r13
+  801701:	41 54                	push   %r12
+  801703:	53                   	push   %rbx
+  801704:	48 83 ec 18          	sub    $0x18,%rsp
+  801708:	49 89 fc             	mov    %rdi,%r12
+  80170b:	49 89 f5             	mov    %rsi,%r13
+  80170e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801712:	8b 45 10             	mov    0x10(%rbp),%eax
+  801715:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801718:	41 89 cf             	mov    %ecx,%r15d
+  80171b:	4c 39 fa             	cmp    %r15,%rdx
+  80171e:	73 5b                	jae    80177b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801720:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801724:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801728:	85 db                	test   %ebx,%ebx
+  80172a:	7e 0e                	jle    80173a <print_num+0x43>
+            putch(padc, put_arg);
+  80172c:	4c 89 ee             	mov    %r13,%rsi
+  80172f:	44 89 f7             	mov    %r14d,%edi
+  801732:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801735:	83 eb 01             	sub    $0x1,%ebx
+  801738:	75 f2                	jne    80172c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80173a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80173e:	48 b9 41 5c 80 00 00 	movabs $0x805c41,%rcx
+  801745:	00 00 00 
+  801748:	48 b8 30 5c 80 00 00 	movabs $0x805c30,%rax
+  80174f:	00 00 00 
+  801752:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801756:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175f:	49 f7 f7             	div    %r15
+  801762:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801766:	4c 89 ee             	mov    %r13,%rsi
+  801769:	41 ff d4             	call   *%r12
+}
+  80176c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801770:	5b                   	pop    %rbx
+  801771:	41 5c                	pop    %r12
+  801773:	41 5d                	pop    %r13
+  801775:	41 5e                	pop    %r14
+  801777:	41 5f                	pop    %r15
+  801779:	5d                   	pop    %rbp
+  80177a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80177b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80177f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801784:	49 f7 f7             	div    %r15
+  801787:	48 83 ec 08          	sub    $0x8,%rsp
+  80178b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80178f:	52                   	push   %rdx
+  801790:	45 0f be c9          	movsbl %r9b,%r9d
+  801794:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801798:	48 89 c2             	mov    %rax,%rdx
+  80179b:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  8017a2:	00 00 00 
+  8017a5:	ff d0                	call   *%rax
+  8017a7:	48 83 c4 10          	add    $0x10,%rsp
+  8017ab:	eb 8d                	jmp    80173a <print_num+0x43>
+
+00000000008017ad <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017ad:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017b1:	48 8b 06             	mov    (%rsi),%rax
+  8017b4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017b8:	73 0a                	jae    8017c4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017ba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017be:	48 89 16             	mov    %rdx,(%rsi)
+  8017c1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017c4:	c3                   	ret
+
+00000000008017c5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017c5:	55                   	push   %rbp
+  8017c6:	48 89 e5             	mov    %rsp,%rbp
+  8017c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8017cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017d1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017d5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017d9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017e8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017f0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017f4:	48 b8 02 18 80 00 00 	movabs $0x801802,%rax
+  8017fb:	00 00 00 
+  8017fe:	ff d0                	call   *%rax
+}
+  801800:	c9                   	leave
+  801801:	c3                   	ret
+
+0000000000801802 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801802:	55                   	push   %rbp
+  801803:	48 89 e5             	mov    %rsp,%rbp
+  801806:	41 57                	push   %r15
+  801808:	41 56                	push   %r14
+  80180a:	41 55                	push   %r13
+  80180c:	41 54                	push   %r12
+  80180e:	53                   	push   %rbx
+  80180f:	48 83 ec 38          	sub    $0x38,%rsp
+  801813:	49 89 fe             	mov    %rdi,%r14
+  801816:	49 89 f5             	mov    %rsi,%r13
+  801819:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80181c:	48 8b 01             	mov    (%rcx),%rax
+  80181f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801823:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801827:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80182b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80182f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801833:	eb 0d                	jmp    801842 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801835:	40 0f b6 ff          	movzbl %dil,%edi
+  801839:	4c 89 ee             	mov    %r13,%rsi
+  80183c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80183f:	4c 89 e3             	mov    %r12,%rbx
+  801842:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801846:	0f b6 3b             	movzbl (%rbx),%edi
+  801849:	40 80 ff 25          	cmp    $0x25,%dil
+  80184d:	74 14                	je     801863 <vprintfmt+0x61>
+            if (!ch) return;
+  80184f:	40 84 ff             	test   %dil,%dil
+  801852:	75 e1                	jne    801835 <vprintfmt+0x33>
+}
+  801854:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801858:	5b                   	pop    %rbx
+  801859:	41 5c                	pop    %r12
+  80185b:	41 5d                	pop    %r13
+  80185d:	41 5e                	pop    %r14
+  80185f:	41 5f                	pop    %r15
+  801861:	5d                   	pop    %rbp
+  801862:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801863:	be 00 00 00 00       	mov    $0x0,%esi
+  801868:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80186c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801871:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801877:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80187e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801882:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801887:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80188c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80188f:	83 e8 23             	sub    $0x23,%eax
+  801892:	3c 57                	cmp    $0x57,%al
+  801894:	0f 87 67 06 00 00    	ja     801f01 <vprintfmt+0x6ff>
+  80189a:	0f b6 c0             	movzbl %al,%eax
+  80189d:	48 b9 c0 5d 80 00 00 	movabs $0x805dc0,%rcx
+  8018a4:	00 00 00 
+  8018a7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8018aa:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018ad:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018b1:	eb cf                	jmp    801882 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018b3:	49 89 dc             	mov    %rbx,%r12
+  8018b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8018bb:	eb c5                	jmp    801882 <vprintfmt+0x80>
+            padc = ch;
+  8018bd:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018c1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018c4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018c7:	eb b9                	jmp    801882 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8018cf:	77 24                	ja     8018f5 <vprintfmt+0xf3>
+  8018d1:	89 c1                	mov    %eax,%ecx
+  8018d3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018d7:	83 c0 08             	add    $0x8,%eax
+  8018da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018dd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018e0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018e3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018e7:	79 99                	jns    801882 <vprintfmt+0x80>
+                width = precision;
+  8018e9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018ed:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018f3:	eb 8d                	jmp    801882 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018f5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018f9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801901:	eb da                	jmp    8018dd <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801903:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801908:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80190c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801912:	3c 39                	cmp    $0x39,%al
+  801914:	77 1c                	ja     801932 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801916:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80191a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80191e:	0f b6 c0             	movzbl %al,%eax
+  801921:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801926:	0f b6 03             	movzbl (%rbx),%eax
+  801929:	3c 39                	cmp    $0x39,%al
+  80192b:	76 e9                	jbe    801916 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  80192d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801930:	eb b1                	jmp    8018e3 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801932:	49 89 dc             	mov    %rbx,%r12
+  801935:	eb ac                	jmp    8018e3 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801937:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80193a:	85 c9                	test   %ecx,%ecx
+  80193c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801941:	0f 49 c1             	cmovns %ecx,%eax
+  801944:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801947:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80194a:	e9 33 ff ff ff       	jmp    801882 <vprintfmt+0x80>
+            lflag++;
+  80194f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801952:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801955:	e9 28 ff ff ff       	jmp    801882 <vprintfmt+0x80>
+            lflag--;
+  80195a:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80195d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801960:	e9 1d ff ff ff       	jmp    801882 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801965:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801968:	83 f8 2f             	cmp    $0x2f,%eax
+  80196b:	77 19                	ja     801986 <vprintfmt+0x184>
+  80196d:	89 c2                	mov    %eax,%edx
+  80196f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801973:	83 c0 08             	add    $0x8,%eax
+  801976:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801979:	8b 3a                	mov    (%rdx),%edi
+  80197b:	4c 89 ee             	mov    %r13,%rsi
+  80197e:	41 ff d6             	call   *%r14
+            break;
+  801981:	e9 bc fe ff ff       	jmp    801842 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801986:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80198a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80198e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801992:	eb e5                	jmp    801979 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801994:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801997:	83 f8 2f             	cmp    $0x2f,%eax
+  80199a:	77 5a                	ja     8019f6 <vprintfmt+0x1f4>
+  80199c:	89 c2                	mov    %eax,%edx
+  80199e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019a2:	83 c0 08             	add    $0x8,%eax
+  8019a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8019a8:	8b 02                	mov    (%rdx),%eax
+  8019aa:	89 c1                	mov    %eax,%ecx
+  8019ac:	f7 d9                	neg    %ecx
+  8019ae:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019b1:	83 f9 13             	cmp    $0x13,%ecx
+  8019b4:	7f 4e                	jg     801a04 <vprintfmt+0x202>
+  8019b6:	48 63 c1             	movslq %ecx,%rax
+  8019b9:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8019c0:	00 00 00 
+  8019c3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019c7:	48 85 c0             	test   %rax,%rax
+  8019ca:	74 38                	je     801a04 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019cc:	48 89 c1             	mov    %rax,%rcx
+  8019cf:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8019d6:	00 00 00 
+  8019d9:	4c 89 ee             	mov    %r13,%rsi
+  8019dc:	4c 89 f7             	mov    %r14,%rdi
+  8019df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e4:	49 b8 c5 17 80 00 00 	movabs $0x8017c5,%r8
+  8019eb:	00 00 00 
+  8019ee:	41 ff d0             	call   *%r8
+  8019f1:	e9 4c fe ff ff       	jmp    801842 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a02:	eb a4                	jmp    8019a8 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801a04:	48 ba 59 5c 80 00 00 	movabs $0x805c59,%rdx
+  801a0b:	00 00 00 
+  801a0e:	4c 89 ee             	mov    %r13,%rsi
+  801a11:	4c 89 f7             	mov    %r14,%rdi
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a19:	49 b8 c5 17 80 00 00 	movabs $0x8017c5,%r8
+  801a20:	00 00 00 
+  801a23:	41 ff d0             	call   *%r8
+  801a26:	e9 17 fe ff ff       	jmp    801842 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a2e:	83 f8 2f             	cmp    $0x2f,%eax
+  801a31:	77 6c                	ja     801a9f <vprintfmt+0x29d>
+  801a33:	89 c2                	mov    %eax,%edx
+  801a35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a39:	83 c0 08             	add    $0x8,%eax
+  801a3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a3f:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a42:	48 85 f6             	test   %rsi,%rsi
+  801a45:	48 b8 52 5c 80 00 00 	movabs $0x805c52,%rax
+  801a4c:	00 00 00 
+  801a4f:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a53:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a57:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a5b:	7e 06                	jle    801a63 <vprintfmt+0x261>
+  801a5d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a61:	75 4a                	jne    801aad <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a63:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a67:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a6b:	0f b6 00             	movzbl (%rax),%eax
+  801a6e:	84 c0                	test   %al,%al
+  801a70:	0f 85 9a 00 00 00    	jne    801b10 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a76:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a79:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	0f 8e bd fd ff ff    	jle    801842 <vprintfmt+0x40>
+  801a85:	4c 89 ee             	mov    %r13,%rsi
+  801a88:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a8d:	41 ff d6             	call   *%r14
+  801a90:	41 83 ec 01          	sub    $0x1,%r12d
+  801a94:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a98:	75 eb                	jne    801a85 <vprintfmt+0x283>
+  801a9a:	e9 a3 fd ff ff       	jmp    801842 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801aa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aab:	eb 92                	jmp    801a3f <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801aad:	49 63 f7             	movslq %r15d,%rsi
+  801ab0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801ab4:	48 b8 c6 1f 80 00 00 	movabs $0x801fc6,%rax
+  801abb:	00 00 00 
+  801abe:	ff d0                	call   *%rax
+  801ac0:	48 89 c2             	mov    %rax,%rdx
+  801ac3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ac6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ac8:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801acb:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	7e 91                	jle    801a63 <vprintfmt+0x261>
+  801ad2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ad7:	4c 89 ee             	mov    %r13,%rsi
+  801ada:	44 89 e7             	mov    %r12d,%edi
+  801add:	41 ff d6             	call   *%r14
+  801ae0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ae4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ae7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801aea:	75 eb                	jne    801ad7 <vprintfmt+0x2d5>
+  801aec:	e9 72 ff ff ff       	jmp    801a63 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801af1:	0f b6 f8             	movzbl %al,%edi
+  801af4:	4c 89 ee             	mov    %r13,%rsi
+  801af7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801afa:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801afe:	49 83 c4 01          	add    $0x1,%r12
+  801b02:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801b08:	84 c0                	test   %al,%al
+  801b0a:	0f 84 66 ff ff ff    	je     801a76 <vprintfmt+0x274>
+  801b10:	45 85 ff             	test   %r15d,%r15d
+  801b13:	78 0a                	js     801b1f <vprintfmt+0x31d>
+  801b15:	41 83 ef 01          	sub    $0x1,%r15d
+  801b19:	0f 88 57 ff ff ff    	js     801a76 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b1f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b23:	74 cc                	je     801af1 <vprintfmt+0x2ef>
+  801b25:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b28:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b2d:	80 fa 5e             	cmp    $0x5e,%dl
+  801b30:	77 c2                	ja     801af4 <vprintfmt+0x2f2>
+  801b32:	eb bd                	jmp    801af1 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b34:	40 84 f6             	test   %sil,%sil
+  801b37:	75 26                	jne    801b5f <vprintfmt+0x35d>
+    switch (lflag) {
+  801b39:	85 d2                	test   %edx,%edx
+  801b3b:	74 59                	je     801b96 <vprintfmt+0x394>
+  801b3d:	83 fa 01             	cmp    $0x1,%edx
+  801b40:	74 7b                	je     801bbd <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b45:	83 f8 2f             	cmp    $0x2f,%eax
+  801b48:	0f 87 96 00 00 00    	ja     801be4 <vprintfmt+0x3e2>
+  801b4e:	89 c2                	mov    %eax,%edx
+  801b50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b54:	83 c0 08             	add    $0x8,%eax
+  801b57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b5a:	4c 8b 22             	mov    (%rdx),%r12
+  801b5d:	eb 17                	jmp    801b76 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b62:	83 f8 2f             	cmp    $0x2f,%eax
+  801b65:	77 21                	ja     801b88 <vprintfmt+0x386>
+  801b67:	89 c2                	mov    %eax,%edx
+  801b69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b6d:	83 c0 08             	add    $0x8,%eax
+  801b70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b73:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b76:	4d 85 e4             	test   %r12,%r12
+  801b79:	78 7a                	js     801bf5 <vprintfmt+0x3f3>
+            num = i;
+  801b7b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b83:	e9 56 02 00 00       	jmp    801dde <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b94:	eb dd                	jmp    801b73 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b99:	83 f8 2f             	cmp    $0x2f,%eax
+  801b9c:	77 11                	ja     801baf <vprintfmt+0x3ad>
+  801b9e:	89 c2                	mov    %eax,%edx
+  801ba0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ba4:	83 c0 08             	add    $0x8,%eax
+  801ba7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801baa:	4c 63 22             	movslq (%rdx),%r12
+  801bad:	eb c7                	jmp    801b76 <vprintfmt+0x374>
+  801baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbb:	eb ed                	jmp    801baa <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bc0:	83 f8 2f             	cmp    $0x2f,%eax
+  801bc3:	77 11                	ja     801bd6 <vprintfmt+0x3d4>
+  801bc5:	89 c2                	mov    %eax,%edx
+  801bc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bcb:	83 c0 08             	add    $0x8,%eax
+  801bce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bd1:	4c 8b 22             	mov    (%rdx),%r12
+  801bd4:	eb a0                	jmp    801b76 <vprintfmt+0x374>
+  801bd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be2:	eb ed                	jmp    801bd1 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801be4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801be8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf0:	e9 65 ff ff ff       	jmp    801b5a <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bf5:	4c 89 ee             	mov    %r13,%rsi
+  801bf8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bfd:	41 ff d6             	call   *%r14
+                i = -i;
+  801c00:	49 f7 dc             	neg    %r12
+  801c03:	e9 73 ff ff ff       	jmp    801b7b <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801c08:	40 84 f6             	test   %sil,%sil
+  801c0b:	75 2e                	jne    801c3b <vprintfmt+0x439>
+    switch (lflag) {
+  801c0d:	85 d2                	test   %edx,%edx
+  801c0f:	7f 59                	jg     801c6a <vprintfmt+0x468>
+  801c11:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c14:	7d 7a                	jge    801c90 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c19:	83 f8 2f             	cmp    $0x2f,%eax
+  801c1c:	0f 87 aa 00 00 00    	ja     801ccc <vprintfmt+0x4ca>
+  801c22:	89 c2                	mov    %eax,%edx
+  801c24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c28:	83 c0 08             	add    $0x8,%eax
+  801c2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c2e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c31:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c36:	e9 a3 01 00 00       	jmp    801dde <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c3e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c41:	77 19                	ja     801c5c <vprintfmt+0x45a>
+  801c43:	89 c2                	mov    %eax,%edx
+  801c45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c49:	83 c0 08             	add    $0x8,%eax
+  801c4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c4f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c52:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c57:	e9 82 01 00 00       	jmp    801dde <vprintfmt+0x5dc>
+  801c5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c68:	eb e5                	jmp    801c4f <vprintfmt+0x44d>
+    switch (lflag) {
+  801c6a:	83 fa 01             	cmp    $0x1,%edx
+  801c6d:	75 a7                	jne    801c16 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c72:	83 f8 2f             	cmp    $0x2f,%eax
+  801c75:	77 47                	ja     801cbe <vprintfmt+0x4bc>
+  801c77:	89 c2                	mov    %eax,%edx
+  801c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c7d:	83 c0 08             	add    $0x8,%eax
+  801c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c83:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c8b:	e9 4e 01 00 00       	jmp    801dde <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c93:	83 f8 2f             	cmp    $0x2f,%eax
+  801c96:	77 18                	ja     801cb0 <vprintfmt+0x4ae>
+  801c98:	89 c2                	mov    %eax,%edx
+  801c9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c9e:	83 c0 08             	add    $0x8,%eax
+  801ca1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ca4:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801ca6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801cab:	e9 2e 01 00 00       	jmp    801dde <vprintfmt+0x5dc>
+  801cb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbc:	eb e6                	jmp    801ca4 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cca:	eb b7                	jmp    801c83 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ccc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cd8:	e9 51 ff ff ff       	jmp    801c2e <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cdd:	40 84 f6             	test   %sil,%sil
+  801ce0:	75 2e                	jne    801d10 <vprintfmt+0x50e>
+    switch (lflag) {
+  801ce2:	85 d2                	test   %edx,%edx
+  801ce4:	7f 59                	jg     801d3f <vprintfmt+0x53d>
+  801ce6:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ce9:	7d 77                	jge    801d62 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ceb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cee:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf1:	0f 87 a4 00 00 00    	ja     801d9b <vprintfmt+0x599>
+  801cf7:	89 c2                	mov    %eax,%edx
+  801cf9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cfd:	83 c0 08             	add    $0x8,%eax
+  801d00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d03:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d06:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d0b:	e9 ce 00 00 00       	jmp    801dde <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d13:	83 f8 2f             	cmp    $0x2f,%eax
+  801d16:	77 19                	ja     801d31 <vprintfmt+0x52f>
+  801d18:	89 c2                	mov    %eax,%edx
+  801d1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d1e:	83 c0 08             	add    $0x8,%eax
+  801d21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d27:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d2c:	e9 ad 00 00 00       	jmp    801dde <vprintfmt+0x5dc>
+  801d31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d3d:	eb e5                	jmp    801d24 <vprintfmt+0x522>
+    switch (lflag) {
+  801d3f:	83 fa 01             	cmp    $0x1,%edx
+  801d42:	75 a7                	jne    801ceb <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d47:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4a:	77 41                	ja     801d8d <vprintfmt+0x58b>
+  801d4c:	89 c2                	mov    %eax,%edx
+  801d4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d52:	83 c0 08             	add    $0x8,%eax
+  801d55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d5b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d60:	eb 7c                	jmp    801dde <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d65:	83 f8 2f             	cmp    $0x2f,%eax
+  801d68:	77 15                	ja     801d7f <vprintfmt+0x57d>
+  801d6a:	89 c2                	mov    %eax,%edx
+  801d6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d70:	83 c0 08             	add    $0x8,%eax
+  801d73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d76:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d78:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d7d:	eb 5f                	jmp    801dde <vprintfmt+0x5dc>
+  801d7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8b:	eb e9                	jmp    801d76 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d99:	eb bd                	jmp    801d58 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801da3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da7:	e9 57 ff ff ff       	jmp    801d03 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801dac:	4c 89 ee             	mov    %r13,%rsi
+  801daf:	bf 30 00 00 00       	mov    $0x30,%edi
+  801db4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801db7:	4c 89 ee             	mov    %r13,%rsi
+  801dba:	bf 78 00 00 00       	mov    $0x78,%edi
+  801dbf:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801dc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc5:	83 f8 2f             	cmp    $0x2f,%eax
+  801dc8:	77 47                	ja     801e11 <vprintfmt+0x60f>
+  801dca:	89 c2                	mov    %eax,%edx
+  801dcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd0:	83 c0 08             	add    $0x8,%eax
+  801dd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dd6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dd9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dde:	48 83 ec 08          	sub    $0x8,%rsp
+  801de2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801de6:	0f 94 c0             	sete   %al
+  801de9:	0f b6 c0             	movzbl %al,%eax
+  801dec:	50                   	push   %rax
+  801ded:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801df2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801df6:	4c 89 ee             	mov    %r13,%rsi
+  801df9:	4c 89 f7             	mov    %r14,%rdi
+  801dfc:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  801e03:	00 00 00 
+  801e06:	ff d0                	call   *%rax
+            break;
+  801e08:	48 83 c4 10          	add    $0x10,%rsp
+  801e0c:	e9 31 fa ff ff       	jmp    801842 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e1d:	eb b7                	jmp    801dd6 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e1f:	40 84 f6             	test   %sil,%sil
+  801e22:	75 2b                	jne    801e4f <vprintfmt+0x64d>
+    switch (lflag) {
+  801e24:	85 d2                	test   %edx,%edx
+  801e26:	7f 56                	jg     801e7e <vprintfmt+0x67c>
+  801e28:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e2b:	7d 77                	jge    801ea4 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e30:	83 f8 2f             	cmp    $0x2f,%eax
+  801e33:	0f 87 a7 00 00 00    	ja     801ee0 <vprintfmt+0x6de>
+  801e39:	89 c2                	mov    %eax,%edx
+  801e3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e3f:	83 c0 08             	add    $0x8,%eax
+  801e42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e45:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e48:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e4d:	eb 8f                	jmp    801dde <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e52:	83 f8 2f             	cmp    $0x2f,%eax
+  801e55:	77 19                	ja     801e70 <vprintfmt+0x66e>
+  801e57:	89 c2                	mov    %eax,%edx
+  801e59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e5d:	83 c0 08             	add    $0x8,%eax
+  801e60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e66:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e6b:	e9 6e ff ff ff       	jmp    801dde <vprintfmt+0x5dc>
+  801e70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e7c:	eb e5                	jmp    801e63 <vprintfmt+0x661>
+    switch (lflag) {
+  801e7e:	83 fa 01             	cmp    $0x1,%edx
+  801e81:	75 aa                	jne    801e2d <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e86:	83 f8 2f             	cmp    $0x2f,%eax
+  801e89:	77 47                	ja     801ed2 <vprintfmt+0x6d0>
+  801e8b:	89 c2                	mov    %eax,%edx
+  801e8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e91:	83 c0 08             	add    $0x8,%eax
+  801e94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e9f:	e9 3a ff ff ff       	jmp    801dde <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801ea4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ea7:	83 f8 2f             	cmp    $0x2f,%eax
+  801eaa:	77 18                	ja     801ec4 <vprintfmt+0x6c2>
+  801eac:	89 c2                	mov    %eax,%edx
+  801eae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eb2:	83 c0 08             	add    $0x8,%eax
+  801eb5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eb8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801eba:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ebf:	e9 1a ff ff ff       	jmp    801dde <vprintfmt+0x5dc>
+  801ec4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ecc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed0:	eb e6                	jmp    801eb8 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ed2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ede:	eb b7                	jmp    801e97 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ee0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ee8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eec:	e9 54 ff ff ff       	jmp    801e45 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ef1:	4c 89 ee             	mov    %r13,%rsi
+  801ef4:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ef9:	41 ff d6             	call   *%r14
+            break;
+  801efc:	e9 41 f9 ff ff       	jmp    801842 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801f01:	4c 89 ee             	mov    %r13,%rsi
+  801f04:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f09:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f0c:	48 83 eb 01          	sub    $0x1,%rbx
+  801f10:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f14:	75 f6                	jne    801f0c <vprintfmt+0x70a>
+  801f16:	e9 27 f9 ff ff       	jmp    801842 <vprintfmt+0x40>
+
+0000000000801f1b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f1b:	55                   	push   %rbp
+  801f1c:	48 89 e5             	mov    %rsp,%rbp
+  801f1f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f27:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f30:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f37:	48 85 ff             	test   %rdi,%rdi
+  801f3a:	74 2b                	je     801f67 <vsnprintf+0x4c>
+  801f3c:	48 85 f6             	test   %rsi,%rsi
+  801f3f:	74 26                	je     801f67 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f41:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f45:	48 bf ad 17 80 00 00 	movabs $0x8017ad,%rdi
+  801f4c:	00 00 00 
+  801f4f:	48 b8 02 18 80 00 00 	movabs $0x801802,%rax
+  801f56:	00 00 00 
+  801f59:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f5f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f65:	c9                   	leave
+  801f66:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6c:	eb f7                	jmp    801f65 <vsnprintf+0x4a>
+
+0000000000801f6e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f6e:	55                   	push   %rbp
+  801f6f:	48 89 e5             	mov    %rsp,%rbp
+  801f72:	48 83 ec 50          	sub    $0x50,%rsp
+  801f76:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f7a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f7e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f82:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f89:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f91:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f99:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f9d:	48 b8 1b 1f 80 00 00 	movabs $0x801f1b,%rax
+  801fa4:	00 00 00 
+  801fa7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+0000000000801fab <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801fab:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fae:	74 10                	je     801fc0 <strlen+0x15>
+    size_t n = 0;
+  801fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fb5:	48 83 c0 01          	add    $0x1,%rax
+  801fb9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fbd:	75 f6                	jne    801fb5 <strlen+0xa>
+  801fbf:	c3                   	ret
+    size_t n = 0;
+  801fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fc5:	c3                   	ret
+
+0000000000801fc6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fc6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fce:	48 85 f6             	test   %rsi,%rsi
+  801fd1:	74 11                	je     801fe4 <strnlen+0x1e>
+  801fd3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fd7:	74 0c                	je     801fe5 <strnlen+0x1f>
+  801fd9:	48 83 c2 01          	add    $0x1,%rdx
+  801fdd:	48 39 d0             	cmp    %rdx,%rax
+  801fe0:	75 f1                	jne    801fd3 <strnlen+0xd>
+  801fe2:	eb 04                	jmp    801fe8 <strnlen+0x22>
+  801fe4:	c3                   	ret
+  801fe5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fe8:	c3                   	ret
+
+0000000000801fe9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fe9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801ff5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801ff8:	48 83 c2 01          	add    $0x1,%rdx
+  801ffc:	84 c9                	test   %cl,%cl
+  801ffe:	75 f1                	jne    801ff1 <strcpy+0x8>
+        ;
+    return res;
+}
+  802000:	c3                   	ret
+
+0000000000802001 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802001:	55                   	push   %rbp
+  802002:	48 89 e5             	mov    %rsp,%rbp
+  802005:	41 54                	push   %r12
+  802007:	53                   	push   %rbx
+  802008:	48 89 fb             	mov    %rdi,%rbx
+  80200b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80200e:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  802015:	00 00 00 
+  802018:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80201a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80201e:	4c 89 e6             	mov    %r12,%rsi
+  802021:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+    return dst;
+}
+  80202d:	48 89 d8             	mov    %rbx,%rax
+  802030:	5b                   	pop    %rbx
+  802031:	41 5c                	pop    %r12
+  802033:	5d                   	pop    %rbp
+  802034:	c3                   	ret
+
+0000000000802035 <toupper>:
+
+int
+toupper(int ch) {
+  802035:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802037:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80203a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80203d:	83 f9 1a             	cmp    $0x1a,%ecx
+  802040:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802043:	c3                   	ret
+
+0000000000802044 <tolower>:
+
+int
+tolower(int ch) {
+  802044:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802046:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802049:	8d 57 20             	lea    0x20(%rdi),%edx
+  80204c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80204f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802052:	c3                   	ret
+
+0000000000802053 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802053:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802056:	48 85 d2             	test   %rdx,%rdx
+  802059:	74 1f                	je     80207a <strncpy+0x27>
+  80205b:	48 01 fa             	add    %rdi,%rdx
+  80205e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802061:	48 83 c1 01          	add    $0x1,%rcx
+  802065:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802069:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80206d:	41 80 f8 01          	cmp    $0x1,%r8b
+  802071:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802075:	48 39 ca             	cmp    %rcx,%rdx
+  802078:	75 e7                	jne    802061 <strncpy+0xe>
+    }
+    return ret;
+}
+  80207a:	c3                   	ret
+
+000000000080207b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80207b:	48 89 f8             	mov    %rdi,%rax
+  80207e:	48 85 d2             	test   %rdx,%rdx
+  802081:	74 24                	je     8020a7 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802083:	48 83 ea 01          	sub    $0x1,%rdx
+  802087:	74 1b                	je     8020a4 <strlcpy+0x29>
+  802089:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80208d:	0f b6 16             	movzbl (%rsi),%edx
+  802090:	84 d2                	test   %dl,%dl
+  802092:	74 10                	je     8020a4 <strlcpy+0x29>
+            *dst++ = *src++;
+  802094:	48 83 c6 01          	add    $0x1,%rsi
+  802098:	48 83 c0 01          	add    $0x1,%rax
+  80209c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80209f:	48 39 c8             	cmp    %rcx,%rax
+  8020a2:	75 e9                	jne    80208d <strlcpy+0x12>
+        *dst = '\0';
+  8020a4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8020a7:	48 29 f8             	sub    %rdi,%rax
+}
+  8020aa:	c3                   	ret
+
+00000000008020ab <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8020ab:	0f b6 07             	movzbl (%rdi),%eax
+  8020ae:	84 c0                	test   %al,%al
+  8020b0:	74 13                	je     8020c5 <strcmp+0x1a>
+  8020b2:	38 06                	cmp    %al,(%rsi)
+  8020b4:	75 0f                	jne    8020c5 <strcmp+0x1a>
+  8020b6:	48 83 c7 01          	add    $0x1,%rdi
+  8020ba:	48 83 c6 01          	add    $0x1,%rsi
+  8020be:	0f b6 07             	movzbl (%rdi),%eax
+  8020c1:	84 c0                	test   %al,%al
+  8020c3:	75 ed                	jne    8020b2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020c5:	0f b6 c0             	movzbl %al,%eax
+  8020c8:	0f b6 16             	movzbl (%rsi),%edx
+  8020cb:	29 d0                	sub    %edx,%eax
+}
+  8020cd:	c3                   	ret
+
+00000000008020ce <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020ce:	48 85 d2             	test   %rdx,%rdx
+  8020d1:	74 1f                	je     8020f2 <strncmp+0x24>
+  8020d3:	0f b6 07             	movzbl (%rdi),%eax
+  8020d6:	84 c0                	test   %al,%al
+  8020d8:	74 1e                	je     8020f8 <strncmp+0x2a>
+  8020da:	3a 06                	cmp    (%rsi),%al
+  8020dc:	75 1a                	jne    8020f8 <strncmp+0x2a>
+  8020de:	48 83 c7 01          	add    $0x1,%rdi
+  8020e2:	48 83 c6 01          	add    $0x1,%rsi
+  8020e6:	48 83 ea 01          	sub    $0x1,%rdx
+  8020ea:	75 e7                	jne    8020d3 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f1:	c3                   	ret
+  8020f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f7:	c3                   	ret
+  8020f8:	48 85 d2             	test   %rdx,%rdx
+  8020fb:	74 09                	je     802106 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020fd:	0f b6 07             	movzbl (%rdi),%eax
+  802100:	0f b6 16             	movzbl (%rsi),%edx
+  802103:	29 d0                	sub    %edx,%eax
+  802105:	c3                   	ret
+    if (!n) return 0;
+  802106:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80210b:	c3                   	ret
+
+000000000080210c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80210c:	0f b6 17             	movzbl (%rdi),%edx
+  80210f:	84 d2                	test   %dl,%dl
+  802111:	74 18                	je     80212b <strchr+0x1f>
+        if (*str == c) {
+  802113:	0f be d2             	movsbl %dl,%edx
+  802116:	39 f2                	cmp    %esi,%edx
+  802118:	74 17                	je     802131 <strchr+0x25>
+    for (; *str; str++) {
+  80211a:	48 83 c7 01          	add    $0x1,%rdi
+  80211e:	0f b6 17             	movzbl (%rdi),%edx
+  802121:	84 d2                	test   %dl,%dl
+  802123:	75 ee                	jne    802113 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212a:	c3                   	ret
+  80212b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802130:	c3                   	ret
+  802131:	48 89 f8             	mov    %rdi,%rax
+}
+  802134:	c3                   	ret
+
+0000000000802135 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802135:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802138:	0f b6 17             	movzbl (%rdi),%edx
+  80213b:	84 d2                	test   %dl,%dl
+  80213d:	74 13                	je     802152 <strfind+0x1d>
+  80213f:	0f be d2             	movsbl %dl,%edx
+  802142:	39 f2                	cmp    %esi,%edx
+  802144:	74 0b                	je     802151 <strfind+0x1c>
+  802146:	48 83 c0 01          	add    $0x1,%rax
+  80214a:	0f b6 10             	movzbl (%rax),%edx
+  80214d:	84 d2                	test   %dl,%dl
+  80214f:	75 ee                	jne    80213f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802151:	c3                   	ret
+  802152:	c3                   	ret
+
+0000000000802153 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802153:	48 39 f7             	cmp    %rsi,%rdi
+  802156:	74 65                	je     8021bd <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+  80215c:	41 57                	push   %r15
+  80215e:	41 56                	push   %r14
+  802160:	41 55                	push   %r13
+  802162:	41 54                	push   %r12
+  802164:	53                   	push   %rbx
+  802165:	48 83 ec 18          	sub    $0x18,%rsp
+  802169:	48 89 fb             	mov    %rdi,%rbx
+  80216c:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80216f:	49 bf 44 20 80 00 00 	movabs $0x802044,%r15
+  802176:	00 00 00 
+  802179:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80217d:	41 0f b6 fd          	movzbl %r13b,%edi
+  802181:	41 ff d7             	call   *%r15
+  802184:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802187:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80218c:	41 0f b6 fe          	movzbl %r14b,%edi
+  802190:	41 ff d7             	call   *%r15
+  802193:	89 c2                	mov    %eax,%edx
+  802195:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802198:	29 d0                	sub    %edx,%eax
+  80219a:	75 12                	jne    8021ae <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80219c:	48 83 c3 01          	add    $0x1,%rbx
+  8021a0:	45 84 ed             	test   %r13b,%r13b
+  8021a3:	74 09                	je     8021ae <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8021a5:	49 83 c4 01          	add    $0x1,%r12
+  8021a9:	45 84 f6             	test   %r14b,%r14b
+  8021ac:	75 cb                	jne    802179 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021ae:	48 83 c4 18          	add    $0x18,%rsp
+  8021b2:	5b                   	pop    %rbx
+  8021b3:	41 5c                	pop    %r12
+  8021b5:	41 5d                	pop    %r13
+  8021b7:	41 5e                	pop    %r14
+  8021b9:	41 5f                	pop    %r15
+  8021bb:	5d                   	pop    %rbp
+  8021bc:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c2:	c3                   	ret
+
+00000000008021c3 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021c3:	48 39 f7             	cmp    %rsi,%rdi
+  8021c6:	74 7d                	je     802245 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021c8:	55                   	push   %rbp
+  8021c9:	48 89 e5             	mov    %rsp,%rbp
+  8021cc:	41 57                	push   %r15
+  8021ce:	41 56                	push   %r14
+  8021d0:	41 55                	push   %r13
+  8021d2:	41 54                	push   %r12
+  8021d4:	53                   	push   %rbx
+  8021d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8021d9:	48 89 fb             	mov    %rdi,%rbx
+  8021dc:	49 89 f4             	mov    %rsi,%r12
+  8021df:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021e7:	49 bf 44 20 80 00 00 	movabs $0x802044,%r15
+  8021ee:	00 00 00 
+    while (n--) {
+  8021f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f5:	48 39 c3             	cmp    %rax,%rbx
+  8021f8:	74 37                	je     802231 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021fa:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021fe:	41 0f b6 fd          	movzbl %r13b,%edi
+  802202:	41 ff d7             	call   *%r15
+  802205:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802208:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80220d:	41 0f b6 fe          	movzbl %r14b,%edi
+  802211:	41 ff d7             	call   *%r15
+  802214:	89 c2                	mov    %eax,%edx
+  802216:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802219:	29 d0                	sub    %edx,%eax
+  80221b:	75 19                	jne    802236 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80221d:	48 83 c3 01          	add    $0x1,%rbx
+  802221:	45 84 ed             	test   %r13b,%r13b
+  802224:	74 10                	je     802236 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802226:	49 83 c4 01          	add    $0x1,%r12
+  80222a:	45 84 f6             	test   %r14b,%r14b
+  80222d:	75 c2                	jne    8021f1 <strncasecmp+0x2e>
+  80222f:	eb 05                	jmp    802236 <strncasecmp+0x73>
+  802231:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802236:	48 83 c4 18          	add    $0x18,%rsp
+  80223a:	5b                   	pop    %rbx
+  80223b:	41 5c                	pop    %r12
+  80223d:	41 5d                	pop    %r13
+  80223f:	41 5e                	pop    %r14
+  802241:	41 5f                	pop    %r15
+  802243:	5d                   	pop    %rbp
+  802244:	c3                   	ret
+    if (p1 == p2) return 0;
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224a:	c3                   	ret
+
+000000000080224b <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80224b:	83 e7 df             	and    $0xffffffdf,%edi
+  80224e:	83 ef 41             	sub    $0x41,%edi
+  802251:	83 ff 19             	cmp    $0x19,%edi
+  802254:	0f 96 c0             	setbe  %al
+}
+  802257:	c3                   	ret
+
+0000000000802258 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802258:	83 ff 20             	cmp    $0x20,%edi
+  80225b:	0f 94 c0             	sete   %al
+  80225e:	83 ff 09             	cmp    $0x9,%edi
+  802261:	0f 94 c2             	sete   %dl
+  802264:	09 d0                	or     %edx,%eax
+}
+  802266:	c3                   	ret
+
+0000000000802267 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802267:	55                   	push   %rbp
+  802268:	48 89 e5             	mov    %rsp,%rbp
+  80226b:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80226d:	48 bf 3f 61 80 00 00 	movabs $0x80613f,%rdi
+  802274:	00 00 00 
+  802277:	48 b8 0c 21 80 00 00 	movabs $0x80210c,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+  802283:	48 85 c0             	test   %rax,%rax
+  802286:	0f 95 c0             	setne  %al
+}
+  802289:	5d                   	pop    %rbp
+  80228a:	c3                   	ret
+
+000000000080228b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80228b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80228e:	48 89 f8             	mov    %rdi,%rax
+  802291:	48 f7 d8             	neg    %rax
+  802294:	83 e0 07             	and    $0x7,%eax
+  802297:	49 89 d1             	mov    %rdx,%r9
+  80229a:	49 29 c1             	sub    %rax,%r9
+  80229d:	78 36                	js     8022d5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80229f:	40 0f b6 c6          	movzbl %sil,%eax
+  8022a3:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8022aa:	01 01 01 
+  8022ad:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022b1:	40 f6 c7 07          	test   $0x7,%dil
+  8022b5:	75 38                	jne    8022ef <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022b7:	4c 89 c9             	mov    %r9,%rcx
+  8022ba:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022be:	74 0c                	je     8022cc <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022c0:	fc                   	cld
+  8022c1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022c4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022c8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022cc:	4d 85 c9             	test   %r9,%r9
+  8022cf:	75 45                	jne    802316 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022d1:	4c 89 c0             	mov    %r8,%rax
+  8022d4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022d5:	48 85 d2             	test   %rdx,%rdx
+  8022d8:	74 f7                	je     8022d1 <memset+0x46>
+  8022da:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022dd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022e0:	48 83 c0 01          	add    $0x1,%rax
+  8022e4:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022e8:	48 39 c2             	cmp    %rax,%rdx
+  8022eb:	75 f3                	jne    8022e0 <memset+0x55>
+  8022ed:	eb e2                	jmp    8022d1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022ef:	40 f6 c7 01          	test   $0x1,%dil
+  8022f3:	74 06                	je     8022fb <memset+0x70>
+  8022f5:	88 07                	mov    %al,(%rdi)
+  8022f7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022fb:	40 f6 c7 02          	test   $0x2,%dil
+  8022ff:	74 07                	je     802308 <memset+0x7d>
+  802301:	66 89 07             	mov    %ax,(%rdi)
+  802304:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802308:	40 f6 c7 04          	test   $0x4,%dil
+  80230c:	74 a9                	je     8022b7 <memset+0x2c>
+  80230e:	89 07                	mov    %eax,(%rdi)
+  802310:	48 83 c7 04          	add    $0x4,%rdi
+  802314:	eb a1                	jmp    8022b7 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802316:	41 f6 c1 04          	test   $0x4,%r9b
+  80231a:	74 06                	je     802322 <memset+0x97>
+  80231c:	89 07                	mov    %eax,(%rdi)
+  80231e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802322:	41 f6 c1 02          	test   $0x2,%r9b
+  802326:	74 07                	je     80232f <memset+0xa4>
+  802328:	66 89 07             	mov    %ax,(%rdi)
+  80232b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80232f:	41 f6 c1 01          	test   $0x1,%r9b
+  802333:	74 9c                	je     8022d1 <memset+0x46>
+  802335:	88 07                	mov    %al,(%rdi)
+  802337:	eb 98                	jmp    8022d1 <memset+0x46>
+
+0000000000802339 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802339:	48 89 f8             	mov    %rdi,%rax
+  80233c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80233f:	48 39 fe             	cmp    %rdi,%rsi
+  802342:	73 3b                	jae    80237f <memmove+0x46>
+  802344:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802348:	48 39 d7             	cmp    %rdx,%rdi
+  80234b:	73 32                	jae    80237f <memmove+0x46>
+        s += n;
+        d += n;
+  80234d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802351:	48 89 d6             	mov    %rdx,%rsi
+  802354:	48 09 fe             	or     %rdi,%rsi
+  802357:	48 09 ce             	or     %rcx,%rsi
+  80235a:	40 f6 c6 07          	test   $0x7,%sil
+  80235e:	75 12                	jne    802372 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802360:	48 83 ef 08          	sub    $0x8,%rdi
+  802364:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802368:	48 c1 e9 03          	shr    $0x3,%rcx
+  80236c:	fd                   	std
+  80236d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802370:	fc                   	cld
+  802371:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802372:	48 83 ef 01          	sub    $0x1,%rdi
+  802376:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80237a:	fd                   	std
+  80237b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80237d:	eb f1                	jmp    802370 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80237f:	48 89 f2             	mov    %rsi,%rdx
+  802382:	48 09 c2             	or     %rax,%rdx
+  802385:	48 09 ca             	or     %rcx,%rdx
+  802388:	f6 c2 07             	test   $0x7,%dl
+  80238b:	75 0c                	jne    802399 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80238d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802391:	48 89 c7             	mov    %rax,%rdi
+  802394:	fc                   	cld
+  802395:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802398:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802399:	48 89 c7             	mov    %rax,%rdi
+  80239c:	fc                   	cld
+  80239d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80239f:	c3                   	ret
+
+00000000008023a0 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8023a0:	55                   	push   %rbp
+  8023a1:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8023a4:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+}
+  8023b0:	5d                   	pop    %rbp
+  8023b1:	c3                   	ret
+
+00000000008023b2 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	41 57                	push   %r15
+  8023b8:	41 56                	push   %r14
+  8023ba:	41 55                	push   %r13
+  8023bc:	41 54                	push   %r12
+  8023be:	53                   	push   %rbx
+  8023bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c3:	49 89 fe             	mov    %rdi,%r14
+  8023c6:	49 89 f7             	mov    %rsi,%r15
+  8023c9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023cc:	48 89 f7             	mov    %rsi,%rdi
+  8023cf:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+  8023db:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023de:	48 89 de             	mov    %rbx,%rsi
+  8023e1:	4c 89 f7             	mov    %r14,%rdi
+  8023e4:	48 b8 c6 1f 80 00 00 	movabs $0x801fc6,%rax
+  8023eb:	00 00 00 
+  8023ee:	ff d0                	call   *%rax
+  8023f0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023f3:	48 39 c3             	cmp    %rax,%rbx
+  8023f6:	74 36                	je     80242e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023f8:	48 89 d8             	mov    %rbx,%rax
+  8023fb:	4c 29 e8             	sub    %r13,%rax
+  8023fe:	49 39 c4             	cmp    %rax,%r12
+  802401:	73 31                	jae    802434 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802403:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802408:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80240c:	4c 89 fe             	mov    %r15,%rsi
+  80240f:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80241b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80241f:	48 83 c4 08          	add    $0x8,%rsp
+  802423:	5b                   	pop    %rbx
+  802424:	41 5c                	pop    %r12
+  802426:	41 5d                	pop    %r13
+  802428:	41 5e                	pop    %r14
+  80242a:	41 5f                	pop    %r15
+  80242c:	5d                   	pop    %rbp
+  80242d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80242e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802432:	eb eb                	jmp    80241f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802434:	48 83 eb 01          	sub    $0x1,%rbx
+  802438:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80243c:	48 89 da             	mov    %rbx,%rdx
+  80243f:	4c 89 fe             	mov    %r15,%rsi
+  802442:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80244e:	49 01 de             	add    %rbx,%r14
+  802451:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802456:	eb c3                	jmp    80241b <strlcat+0x69>
+
+0000000000802458 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802458:	48 85 d2             	test   %rdx,%rdx
+  80245b:	74 2d                	je     80248a <memcmp+0x32>
+  80245d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802462:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802466:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80246b:	44 38 c1             	cmp    %r8b,%cl
+  80246e:	75 0f                	jne    80247f <memcmp+0x27>
+    while (n-- > 0) {
+  802470:	48 83 c0 01          	add    $0x1,%rax
+  802474:	48 39 c2             	cmp    %rax,%rdx
+  802477:	75 e9                	jne    802462 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80247f:	0f b6 c1             	movzbl %cl,%eax
+  802482:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802486:	44 29 c0             	sub    %r8d,%eax
+  802489:	c3                   	ret
+    return 0;
+  80248a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80248f:	c3                   	ret
+
+0000000000802490 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802490:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802494:	48 39 c7             	cmp    %rax,%rdi
+  802497:	73 0f                	jae    8024a8 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802499:	40 38 37             	cmp    %sil,(%rdi)
+  80249c:	74 0e                	je     8024ac <memfind+0x1c>
+    for (; src < end; src++) {
+  80249e:	48 83 c7 01          	add    $0x1,%rdi
+  8024a2:	48 39 f8             	cmp    %rdi,%rax
+  8024a5:	75 f2                	jne    802499 <memfind+0x9>
+  8024a7:	c3                   	ret
+  8024a8:	48 89 f8             	mov    %rdi,%rax
+  8024ab:	c3                   	ret
+  8024ac:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024af:	c3                   	ret
+
+00000000008024b0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024b0:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024b3:	0f b6 37             	movzbl (%rdi),%esi
+  8024b6:	40 80 fe 20          	cmp    $0x20,%sil
+  8024ba:	74 06                	je     8024c2 <strtol+0x12>
+  8024bc:	40 80 fe 09          	cmp    $0x9,%sil
+  8024c0:	75 13                	jne    8024d5 <strtol+0x25>
+  8024c2:	48 83 c7 01          	add    $0x1,%rdi
+  8024c6:	0f b6 37             	movzbl (%rdi),%esi
+  8024c9:	40 80 fe 20          	cmp    $0x20,%sil
+  8024cd:	74 f3                	je     8024c2 <strtol+0x12>
+  8024cf:	40 80 fe 09          	cmp    $0x9,%sil
+  8024d3:	74 ed                	je     8024c2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024d5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024d8:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024db:	3c 01                	cmp    $0x1,%al
+  8024dd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024e1:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024e7:	75 0f                	jne    8024f8 <strtol+0x48>
+  8024e9:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024ec:	74 14                	je     802502 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024ee:	85 d2                	test   %edx,%edx
+  8024f0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024f5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024f8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024fd:	4c 63 ca             	movslq %edx,%r9
+  802500:	eb 36                	jmp    802538 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802502:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802506:	74 0f                	je     802517 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802508:	85 d2                	test   %edx,%edx
+  80250a:	75 ec                	jne    8024f8 <strtol+0x48>
+        s++;
+  80250c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802510:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802515:	eb e1                	jmp    8024f8 <strtol+0x48>
+        s += 2;
+  802517:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80251b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802520:	eb d6                	jmp    8024f8 <strtol+0x48>
+            dig -= '0';
+  802522:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802525:	44 0f b6 c1          	movzbl %cl,%r8d
+  802529:	41 39 d0             	cmp    %edx,%r8d
+  80252c:	7d 21                	jge    80254f <strtol+0x9f>
+        val = val * base + dig;
+  80252e:	49 0f af c1          	imul   %r9,%rax
+  802532:	0f b6 c9             	movzbl %cl,%ecx
+  802535:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802538:	48 83 c7 01          	add    $0x1,%rdi
+  80253c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802540:	80 f9 39             	cmp    $0x39,%cl
+  802543:	76 dd                	jbe    802522 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802545:	80 f9 7b             	cmp    $0x7b,%cl
+  802548:	77 05                	ja     80254f <strtol+0x9f>
+            dig -= 'a' - 10;
+  80254a:	83 e9 57             	sub    $0x57,%ecx
+  80254d:	eb d6                	jmp    802525 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80254f:	4d 85 d2             	test   %r10,%r10
+  802552:	74 03                	je     802557 <strtol+0xa7>
+  802554:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802557:	48 89 c2             	mov    %rax,%rdx
+  80255a:	48 f7 da             	neg    %rdx
+  80255d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802561:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802565:	c3                   	ret
+
+0000000000802566 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802566:	55                   	push   %rbp
+  802567:	48 89 e5             	mov    %rsp,%rbp
+  80256a:	53                   	push   %rbx
+  80256b:	48 89 fa             	mov    %rdi,%rdx
+  80256e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802571:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802576:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80257b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802580:	be 00 00 00 00       	mov    $0x0,%esi
+  802585:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80258b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802591:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802593:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802597:	c9                   	leave
+  802598:	c3                   	ret
+
+0000000000802599 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802599:	55                   	push   %rbp
+  80259a:	48 89 e5             	mov    %rsp,%rbp
+  80259d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80259e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025c8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ce:	c9                   	leave
+  8025cf:	c3                   	ret
+
+00000000008025d0 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025d0:	55                   	push   %rbp
+  8025d1:	48 89 e5             	mov    %rsp,%rbp
+  8025d4:	53                   	push   %rbx
+  8025d5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025d8:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025fd:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802603:	c9                   	leave
+  802604:	c3                   	ret
+
+0000000000802605 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802605:	55                   	push   %rbp
+  802606:	48 89 e5             	mov    %rsp,%rbp
+  802609:	53                   	push   %rbx
+  80260a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  80260e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802611:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802616:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80261b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802620:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802625:	be 00 00 00 00       	mov    $0x0,%esi
+  80262a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802630:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802636:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802638:	48 85 c0             	test   %rax,%rax
+  80263b:	7f 06                	jg     802643 <sys_env_destroy+0x3e>
+}
+  80263d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802641:	c9                   	leave
+  802642:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802643:	49 89 c0             	mov    %rax,%r8
+  802646:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80264b:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802652:	00 00 00 
+  802655:	be 27 00 00 00       	mov    $0x27,%esi
+  80265a:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802661:	00 00 00 
+  802664:	b8 00 00 00 00       	mov    $0x0,%eax
+  802669:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802670:	00 00 00 
+  802673:	41 ff d1             	call   *%r9
+
+0000000000802676 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802676:	55                   	push   %rbp
+  802677:	48 89 e5             	mov    %rsp,%rbp
+  80267a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80267b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802680:	ba 00 00 00 00       	mov    $0x0,%edx
+  802685:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80268a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80268f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802694:	be 00 00 00 00       	mov    $0x0,%esi
+  802699:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80269f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026a5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ab:	c9                   	leave
+  8026ac:	c3                   	ret
+
+00000000008026ad <sys_yield>:
+
+void
+sys_yield(void) {
+  8026ad:	55                   	push   %rbp
+  8026ae:	48 89 e5             	mov    %rsp,%rbp
+  8026b1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026b2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026dc:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e2:	c9                   	leave
+  8026e3:	c3                   	ret
+
+00000000008026e4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026e4:	55                   	push   %rbp
+  8026e5:	48 89 e5             	mov    %rsp,%rbp
+  8026e8:	53                   	push   %rbx
+  8026e9:	48 89 fa             	mov    %rdi,%rdx
+  8026ec:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026ef:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026f4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026fb:	00 00 00 
+  8026fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802703:	be 00 00 00 00       	mov    $0x0,%esi
+  802708:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80270e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802714:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802716:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80271a:	c9                   	leave
+  80271b:	c3                   	ret
+
+000000000080271c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80271c:	55                   	push   %rbp
+  80271d:	48 89 e5             	mov    %rsp,%rbp
+  802720:	53                   	push   %rbx
+  802721:	49 89 f8             	mov    %rdi,%r8
+  802724:	48 89 d3             	mov    %rdx,%rbx
+  802727:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80272a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80272f:	4c 89 c2             	mov    %r8,%rdx
+  802732:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802735:	be 00 00 00 00       	mov    $0x0,%esi
+  80273a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802740:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802746:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802748:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+000000000080274e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	53                   	push   %rbx
+  802753:	48 83 ec 08          	sub    $0x8,%rsp
+  802757:	89 f8                	mov    %edi,%eax
+  802759:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80275c:	48 63 f9             	movslq %ecx,%rdi
+  80275f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802762:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802767:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80276a:	be 00 00 00 00       	mov    $0x0,%esi
+  80276f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802775:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80277b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80277d:	48 85 c0             	test   %rax,%rax
+  802780:	7f 06                	jg     802788 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802782:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802786:	c9                   	leave
+  802787:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802788:	49 89 c0             	mov    %rax,%r8
+  80278b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802790:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802797:	00 00 00 
+  80279a:	be 27 00 00 00       	mov    $0x27,%esi
+  80279f:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8027a6:	00 00 00 
+  8027a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ae:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  8027b5:	00 00 00 
+  8027b8:	41 ff d1             	call   *%r9
+
+00000000008027bb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027bb:	55                   	push   %rbp
+  8027bc:	48 89 e5             	mov    %rsp,%rbp
+  8027bf:	53                   	push   %rbx
+  8027c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c4:	89 f8                	mov    %edi,%eax
+  8027c6:	49 89 f2             	mov    %rsi,%r10
+  8027c9:	48 89 cf             	mov    %rcx,%rdi
+  8027cc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027cf:	48 63 da             	movslq %edx,%rbx
+  8027d2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027d5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027da:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027dd:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027e8:	48 85 c0             	test   %rax,%rax
+  8027eb:	7f 06                	jg     8027f3 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f1:	c9                   	leave
+  8027f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027f3:	49 89 c0             	mov    %rax,%r8
+  8027f6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027fb:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802802:	00 00 00 
+  802805:	be 27 00 00 00       	mov    $0x27,%esi
+  80280a:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802811:	00 00 00 
+  802814:	b8 00 00 00 00       	mov    $0x0,%eax
+  802819:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802820:	00 00 00 
+  802823:	41 ff d1             	call   *%r9
+
+0000000000802826 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802826:	55                   	push   %rbp
+  802827:	48 89 e5             	mov    %rsp,%rbp
+  80282a:	53                   	push   %rbx
+  80282b:	48 83 ec 08          	sub    $0x8,%rsp
+  80282f:	48 89 f1             	mov    %rsi,%rcx
+  802832:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802835:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802838:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80283d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802842:	be 00 00 00 00       	mov    $0x0,%esi
+  802847:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80284d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802853:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802855:	48 85 c0             	test   %rax,%rax
+  802858:	7f 06                	jg     802860 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80285a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80285e:	c9                   	leave
+  80285f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802860:	49 89 c0             	mov    %rax,%r8
+  802863:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802868:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80286f:	00 00 00 
+  802872:	be 27 00 00 00       	mov    $0x27,%esi
+  802877:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80287e:	00 00 00 
+  802881:	b8 00 00 00 00       	mov    $0x0,%eax
+  802886:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  80288d:	00 00 00 
+  802890:	41 ff d1             	call   *%r9
+
+0000000000802893 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802893:	55                   	push   %rbp
+  802894:	48 89 e5             	mov    %rsp,%rbp
+  802897:	53                   	push   %rbx
+  802898:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80289c:	48 63 ce             	movslq %esi,%rcx
+  80289f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028a2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028c4:	48 85 c0             	test   %rax,%rax
+  8028c7:	7f 06                	jg     8028cf <sys_env_set_status+0x3c>
+}
+  8028c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028cd:	c9                   	leave
+  8028ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028cf:	49 89 c0             	mov    %rax,%r8
+  8028d2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028d7:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8028de:	00 00 00 
+  8028e1:	be 27 00 00 00       	mov    $0x27,%esi
+  8028e6:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8028ed:	00 00 00 
+  8028f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f5:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  8028fc:	00 00 00 
+  8028ff:	41 ff d1             	call   *%r9
+
+0000000000802902 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802902:	55                   	push   %rbp
+  802903:	48 89 e5             	mov    %rsp,%rbp
+  802906:	53                   	push   %rbx
+  802907:	48 83 ec 08          	sub    $0x8,%rsp
+  80290b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  80290e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802911:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802916:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802920:	be 00 00 00 00       	mov    $0x0,%esi
+  802925:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80292b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802931:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802933:	48 85 c0             	test   %rax,%rax
+  802936:	7f 06                	jg     80293e <sys_env_set_trapframe+0x3c>
+}
+  802938:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80293c:	c9                   	leave
+  80293d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80293e:	49 89 c0             	mov    %rax,%r8
+  802941:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802946:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80294d:	00 00 00 
+  802950:	be 27 00 00 00       	mov    $0x27,%esi
+  802955:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80295c:	00 00 00 
+  80295f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802964:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  80296b:	00 00 00 
+  80296e:	41 ff d1             	call   *%r9
+
+0000000000802971 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802971:	55                   	push   %rbp
+  802972:	48 89 e5             	mov    %rsp,%rbp
+  802975:	53                   	push   %rbx
+  802976:	48 83 ec 08          	sub    $0x8,%rsp
+  80297a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  80297d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802980:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802985:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80298a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80298f:	be 00 00 00 00       	mov    $0x0,%esi
+  802994:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80299a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029a2:	48 85 c0             	test   %rax,%rax
+  8029a5:	7f 06                	jg     8029ad <sys_env_set_pgfault_upcall+0x3c>
+}
+  8029a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ab:	c9                   	leave
+  8029ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029ad:	49 89 c0             	mov    %rax,%r8
+  8029b0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029b5:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8029bc:	00 00 00 
+  8029bf:	be 27 00 00 00       	mov    $0x27,%esi
+  8029c4:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8029cb:	00 00 00 
+  8029ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d3:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  8029da:	00 00 00 
+  8029dd:	41 ff d1             	call   *%r9
+
+00000000008029e0 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029e0:	55                   	push   %rbp
+  8029e1:	48 89 e5             	mov    %rsp,%rbp
+  8029e4:	53                   	push   %rbx
+  8029e5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029e9:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029f0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802a04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a10:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a12:	48 85 c0             	test   %rax,%rax
+  802a15:	7f 06                	jg     802a1d <sys_env_set_reclaim+0x3d>
+}
+  802a17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a1b:	c9                   	leave
+  802a1c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a1d:	49 89 c0             	mov    %rax,%r8
+  802a20:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a25:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a2c:	00 00 00 
+  802a2f:	be 27 00 00 00       	mov    $0x27,%esi
+  802a34:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a3b:	00 00 00 
+  802a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a43:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802a4a:	00 00 00 
+  802a4d:	41 ff d1             	call   *%r9
+
+0000000000802a50 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a50:	55                   	push   %rbp
+  802a51:	48 89 e5             	mov    %rsp,%rbp
+  802a54:	53                   	push   %rbx
+  802a55:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a59:	48 63 ce             	movslq %esi,%rcx
+  802a5c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a5f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a6e:	be 00 00 00 00       	mov    $0x0,%esi
+  802a73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a7f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a81:	48 85 c0             	test   %rax,%rax
+  802a84:	7f 06                	jg     802a8c <sys_env_set_nice+0x3c>
+}
+  802a86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a8a:	c9                   	leave
+  802a8b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a8c:	49 89 c0             	mov    %rax,%r8
+  802a8f:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a94:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a9b:	00 00 00 
+  802a9e:	be 27 00 00 00       	mov    $0x27,%esi
+  802aa3:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802aaa:	00 00 00 
+  802aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab2:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802ab9:	00 00 00 
+  802abc:	41 ff d1             	call   *%r9
+
+0000000000802abf <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802abf:	55                   	push   %rbp
+  802ac0:	48 89 e5             	mov    %rsp,%rbp
+  802ac3:	53                   	push   %rbx
+  802ac4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ac7:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802acc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ad1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802adb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aec:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802aee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802af2:	c9                   	leave
+  802af3:	c3                   	ret
+
+0000000000802af4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802af4:	55                   	push   %rbp
+  802af5:	48 89 e5             	mov    %rsp,%rbp
+  802af8:	53                   	push   %rbx
+  802af9:	89 f8                	mov    %edi,%eax
+  802afb:	49 89 f1             	mov    %rsi,%r9
+  802afe:	48 89 d3             	mov    %rdx,%rbx
+  802b01:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b04:	49 63 f0             	movslq %r8d,%rsi
+  802b07:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b0a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b0f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1e:	cd 30                	int    $0x30
+}
+  802b20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b24:	c9                   	leave
+  802b25:	c3                   	ret
+
+0000000000802b26 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b26:	55                   	push   %rbp
+  802b27:	48 89 e5             	mov    %rsp,%rbp
+  802b2a:	53                   	push   %rbx
+  802b2b:	89 f8                	mov    %edi,%eax
+  802b2d:	49 89 f1             	mov    %rsi,%r9
+  802b30:	48 89 d3             	mov    %rdx,%rbx
+  802b33:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b36:	49 63 f0             	movslq %r8d,%rsi
+  802b39:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b3c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b41:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b4a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b50:	cd 30                	int    $0x30
+}
+  802b52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b56:	c9                   	leave
+  802b57:	c3                   	ret
+
+0000000000802b58 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b58:	55                   	push   %rbp
+  802b59:	48 89 e5             	mov    %rsp,%rbp
+  802b5c:	53                   	push   %rbx
+  802b5d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b61:	89 f8                	mov    %edi,%eax
+  802b63:	49 89 f2             	mov    %rsi,%r10
+  802b66:	48 89 d3             	mov    %rdx,%rbx
+  802b69:	48 89 cf             	mov    %rcx,%rdi
+  802b6c:	44 89 c6             	mov    %r8d,%esi
+  802b6f:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b72:	48 63 f6             	movslq %esi,%rsi
+  802b75:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b78:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b7d:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b80:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b84:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b86:	48 85 c0             	test   %rax,%rax
+  802b89:	7f 06                	jg     802b91 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b8f:	c9                   	leave
+  802b90:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b91:	49 89 c0             	mov    %rax,%r8
+  802b94:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b99:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802ba0:	00 00 00 
+  802ba3:	be 27 00 00 00       	mov    $0x27,%esi
+  802ba8:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802baf:	00 00 00 
+  802bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb7:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802bbe:	00 00 00 
+  802bc1:	41 ff d1             	call   *%r9
+
+0000000000802bc4 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bc4:	55                   	push   %rbp
+  802bc5:	48 89 e5             	mov    %rsp,%rbp
+  802bc8:	53                   	push   %rbx
+  802bc9:	48 83 ec 08          	sub    $0x8,%rsp
+  802bcd:	48 89 f1             	mov    %rsi,%rcx
+  802bd0:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bd3:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bd7:	48 8b 1a             	mov    (%rdx),%rbx
+  802bda:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bdd:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802be2:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be6:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bea:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bf0:	48 85 c0             	test   %rax,%rax
+  802bf3:	7f 06                	jg     802bfb <sys_ipc_call_short+0x37>
+}
+  802bf5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bf9:	c9                   	leave
+  802bfa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bfb:	49 89 c0             	mov    %rax,%r8
+  802bfe:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802c03:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802c0a:	00 00 00 
+  802c0d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c12:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c19:	00 00 00 
+  802c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c21:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802c28:	00 00 00 
+  802c2b:	41 ff d1             	call   *%r9
+
+0000000000802c2e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c2e:	55                   	push   %rbp
+  802c2f:	48 89 e5             	mov    %rsp,%rbp
+  802c32:	53                   	push   %rbx
+  802c33:	48 83 ec 08          	sub    $0x8,%rsp
+  802c37:	89 f8                	mov    %edi,%eax
+  802c39:	49 89 f2             	mov    %rsi,%r10
+  802c3c:	48 89 d3             	mov    %rdx,%rbx
+  802c3f:	48 89 cf             	mov    %rcx,%rdi
+  802c42:	44 89 c6             	mov    %r8d,%esi
+  802c45:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c48:	48 63 f6             	movslq %esi,%rsi
+  802c4b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c4e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c53:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c56:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c5a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c5c:	48 85 c0             	test   %rax,%rax
+  802c5f:	7f 06                	jg     802c67 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c65:	c9                   	leave
+  802c66:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c67:	49 89 c0             	mov    %rax,%r8
+  802c6a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c6f:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802c76:	00 00 00 
+  802c79:	be 27 00 00 00       	mov    $0x27,%esi
+  802c7e:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c85:	00 00 00 
+  802c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8d:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802c94:	00 00 00 
+  802c97:	41 ff d1             	call   *%r9
+
+0000000000802c9a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c9a:	55                   	push   %rbp
+  802c9b:	48 89 e5             	mov    %rsp,%rbp
+  802c9e:	53                   	push   %rbx
+  802c9f:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca3:	48 89 fa             	mov    %rdi,%rdx
+  802ca6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802ca9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cb3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cb8:	be 00 00 00 00       	mov    $0x0,%esi
+  802cbd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cc3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cc9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ccb:	48 85 c0             	test   %rax,%rax
+  802cce:	7f 06                	jg     802cd6 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cd6:	49 89 c0             	mov    %rax,%r8
+  802cd9:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cde:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802ce5:	00 00 00 
+  802ce8:	be 27 00 00 00       	mov    $0x27,%esi
+  802ced:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802cf4:	00 00 00 
+  802cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfc:	49 b9 a0 50 80 00 00 	movabs $0x8050a0,%r9
+  802d03:	00 00 00 
+  802d06:	41 ff d1             	call   *%r9
+
+0000000000802d09 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802d09:	55                   	push   %rbp
+  802d0a:	48 89 e5             	mov    %rsp,%rbp
+  802d0d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d0e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d13:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d18:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d22:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d27:	be 00 00 00 00       	mov    $0x0,%esi
+  802d2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d32:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d38:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3e:	c9                   	leave
+  802d3f:	c3                   	ret
+
+0000000000802d40 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d40:	55                   	push   %rbp
+  802d41:	48 89 e5             	mov    %rsp,%rbp
+  802d44:	53                   	push   %rbx
+  802d45:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d48:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d57:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d67:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d6d:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d73:	c9                   	leave
+  802d74:	c3                   	ret
+
+0000000000802d75 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d75:	55                   	push   %rbp
+  802d76:	48 89 e5             	mov    %rsp,%rbp
+  802d79:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d8e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d93:	be 00 00 00 00       	mov    $0x0,%esi
+  802d98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da4:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802da6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802daa:	c9                   	leave
+  802dab:	c3                   	ret
+
+0000000000802dac <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dac:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802db3:	ff ff ff 
+  802db6:	48 01 f8             	add    %rdi,%rax
+  802db9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802dbd:	c3                   	ret
+
+0000000000802dbe <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dbe:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dc5:	ff ff ff 
+  802dc8:	48 01 f8             	add    %rdi,%rax
+  802dcb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802dcf:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dd5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dd9:	c3                   	ret
+
+0000000000802dda <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	41 57                	push   %r15
+  802de0:	41 56                	push   %r14
+  802de2:	41 55                	push   %r13
+  802de4:	41 54                	push   %r12
+  802de6:	53                   	push   %rbx
+  802de7:	48 83 ec 08          	sub    $0x8,%rsp
+  802deb:	49 89 ff             	mov    %rdi,%r15
+  802dee:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802df3:	49 bd da 42 80 00 00 	movabs $0x8042da,%r13
+  802dfa:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802dfd:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802e03:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802e06:	48 89 df             	mov    %rbx,%rdi
+  802e09:	41 ff d5             	call   *%r13
+  802e0c:	83 e0 04             	and    $0x4,%eax
+  802e0f:	74 17                	je     802e28 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e11:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e18:	4c 39 f3             	cmp    %r14,%rbx
+  802e1b:	75 e6                	jne    802e03 <fd_alloc+0x29>
+  802e1d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e23:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e28:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e2b:	48 83 c4 08          	add    $0x8,%rsp
+  802e2f:	5b                   	pop    %rbx
+  802e30:	41 5c                	pop    %r12
+  802e32:	41 5d                	pop    %r13
+  802e34:	41 5e                	pop    %r14
+  802e36:	41 5f                	pop    %r15
+  802e38:	5d                   	pop    %rbp
+  802e39:	c3                   	ret
+
+0000000000802e3a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e3a:	83 ff 1f             	cmp    $0x1f,%edi
+  802e3d:	77 39                	ja     802e78 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e3f:	55                   	push   %rbp
+  802e40:	48 89 e5             	mov    %rsp,%rbp
+  802e43:	41 54                	push   %r12
+  802e45:	53                   	push   %rbx
+  802e46:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e49:	48 63 df             	movslq %edi,%rbx
+  802e4c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e53:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e57:	48 89 df             	mov    %rbx,%rdi
+  802e5a:	48 b8 da 42 80 00 00 	movabs $0x8042da,%rax
+  802e61:	00 00 00 
+  802e64:	ff d0                	call   *%rax
+  802e66:	a8 04                	test   $0x4,%al
+  802e68:	74 14                	je     802e7e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e6a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e73:	5b                   	pop    %rbx
+  802e74:	41 5c                	pop    %r12
+  802e76:	5d                   	pop    %rbp
+  802e77:	c3                   	ret
+        return -E_INVAL;
+  802e78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e7d:	c3                   	ret
+        return -E_INVAL;
+  802e7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e83:	eb ee                	jmp    802e73 <fd_lookup+0x39>
+
+0000000000802e85 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	41 54                	push   %r12
+  802e8b:	53                   	push   %rbx
+  802e8c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e8f:	48 b8 00 62 80 00 00 	movabs $0x806200,%rax
+  802e96:	00 00 00 
+  802e99:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802ea0:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802ea3:	39 3b                	cmp    %edi,(%rbx)
+  802ea5:	74 47                	je     802eee <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802ea7:	48 83 c0 08          	add    $0x8,%rax
+  802eab:	48 8b 18             	mov    (%rax),%rbx
+  802eae:	48 85 db             	test   %rbx,%rbx
+  802eb1:	75 f0                	jne    802ea3 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802eb3:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802eba:	00 00 00 
+  802ebd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ec3:	89 fa                	mov    %edi,%edx
+  802ec5:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  802ecc:	00 00 00 
+  802ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed4:	48 b9 b2 16 80 00 00 	movabs $0x8016b2,%rcx
+  802edb:	00 00 00 
+  802ede:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ee0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ee5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ee9:	5b                   	pop    %rbx
+  802eea:	41 5c                	pop    %r12
+  802eec:	5d                   	pop    %rbp
+  802eed:	c3                   	ret
+            return 0;
+  802eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef3:	eb f0                	jmp    802ee5 <dev_lookup+0x60>
+
+0000000000802ef5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ef5:	55                   	push   %rbp
+  802ef6:	48 89 e5             	mov    %rsp,%rbp
+  802ef9:	41 55                	push   %r13
+  802efb:	41 54                	push   %r12
+  802efd:	53                   	push   %rbx
+  802efe:	48 83 ec 18          	sub    $0x18,%rsp
+  802f02:	48 89 fb             	mov    %rdi,%rbx
+  802f05:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f08:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f0f:	ff ff ff 
+  802f12:	48 01 df             	add    %rbx,%rdi
+  802f15:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f1d:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  802f24:	00 00 00 
+  802f27:	ff d0                	call   *%rax
+  802f29:	41 89 c5             	mov    %eax,%r13d
+  802f2c:	85 c0                	test   %eax,%eax
+  802f2e:	78 06                	js     802f36 <fd_close+0x41>
+  802f30:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f34:	74 1a                	je     802f50 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f36:	45 84 e4             	test   %r12b,%r12b
+  802f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f42:	44 89 e8             	mov    %r13d,%eax
+  802f45:	48 83 c4 18          	add    $0x18,%rsp
+  802f49:	5b                   	pop    %rbx
+  802f4a:	41 5c                	pop    %r12
+  802f4c:	41 5d                	pop    %r13
+  802f4e:	5d                   	pop    %rbp
+  802f4f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f50:	8b 3b                	mov    (%rbx),%edi
+  802f52:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f56:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  802f5d:	00 00 00 
+  802f60:	ff d0                	call   *%rax
+  802f62:	41 89 c5             	mov    %eax,%r13d
+  802f65:	85 c0                	test   %eax,%eax
+  802f67:	78 1b                	js     802f84 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f6d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f71:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f77:	48 85 c0             	test   %rax,%rax
+  802f7a:	74 08                	je     802f84 <fd_close+0x8f>
+  802f7c:	48 89 df             	mov    %rbx,%rdi
+  802f7f:	ff d0                	call   *%rax
+  802f81:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f89:	48 89 de             	mov    %rbx,%rsi
+  802f8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f91:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  802f98:	00 00 00 
+  802f9b:	ff d0                	call   *%rax
+    return res;
+  802f9d:	eb a3                	jmp    802f42 <fd_close+0x4d>
+
+0000000000802f9f <close>:
+
+int
+close(int fdnum) {
+  802f9f:	55                   	push   %rbp
+  802fa0:	48 89 e5             	mov    %rsp,%rbp
+  802fa3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802fa7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fab:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  802fb2:	00 00 00 
+  802fb5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fb7:	85 c0                	test   %eax,%eax
+  802fb9:	78 15                	js     802fd0 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fbb:	be 01 00 00 00       	mov    $0x1,%esi
+  802fc0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fc4:	48 b8 f5 2e 80 00 00 	movabs $0x802ef5,%rax
+  802fcb:	00 00 00 
+  802fce:	ff d0                	call   *%rax
+}
+  802fd0:	c9                   	leave
+  802fd1:	c3                   	ret
+
+0000000000802fd2 <close_all>:
+
+void
+close_all(void) {
+  802fd2:	55                   	push   %rbp
+  802fd3:	48 89 e5             	mov    %rsp,%rbp
+  802fd6:	41 54                	push   %r12
+  802fd8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fde:	49 bc 9f 2f 80 00 00 	movabs $0x802f9f,%r12
+  802fe5:	00 00 00 
+  802fe8:	89 df                	mov    %ebx,%edi
+  802fea:	41 ff d4             	call   *%r12
+  802fed:	83 c3 01             	add    $0x1,%ebx
+  802ff0:	83 fb 20             	cmp    $0x20,%ebx
+  802ff3:	75 f3                	jne    802fe8 <close_all+0x16>
+}
+  802ff5:	5b                   	pop    %rbx
+  802ff6:	41 5c                	pop    %r12
+  802ff8:	5d                   	pop    %rbp
+  802ff9:	c3                   	ret
+
+0000000000802ffa <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802ffa:	55                   	push   %rbp
+  802ffb:	48 89 e5             	mov    %rsp,%rbp
+  802ffe:	41 57                	push   %r15
+  803000:	41 56                	push   %r14
+  803002:	41 55                	push   %r13
+  803004:	41 54                	push   %r12
+  803006:	53                   	push   %rbx
+  803007:	48 83 ec 18          	sub    $0x18,%rsp
+  80300b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80300e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803012:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  803019:	00 00 00 
+  80301c:	ff d0                	call   *%rax
+  80301e:	89 c3                	mov    %eax,%ebx
+  803020:	85 c0                	test   %eax,%eax
+  803022:	0f 88 b8 00 00 00    	js     8030e0 <dup+0xe6>
+    close(newfdnum);
+  803028:	44 89 e7             	mov    %r12d,%edi
+  80302b:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  803032:	00 00 00 
+  803035:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803037:	4d 63 ec             	movslq %r12d,%r13
+  80303a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803041:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803045:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803049:	4c 89 ff             	mov    %r15,%rdi
+  80304c:	49 be be 2d 80 00 00 	movabs $0x802dbe,%r14
+  803053:	00 00 00 
+  803056:	41 ff d6             	call   *%r14
+  803059:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80305c:	4c 89 ef             	mov    %r13,%rdi
+  80305f:	41 ff d6             	call   *%r14
+  803062:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803065:	48 89 df             	mov    %rbx,%rdi
+  803068:	48 b8 da 42 80 00 00 	movabs $0x8042da,%rax
+  80306f:	00 00 00 
+  803072:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803074:	a8 04                	test   $0x4,%al
+  803076:	74 2b                	je     8030a3 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803078:	41 89 c1             	mov    %eax,%r9d
+  80307b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803081:	4c 89 f1             	mov    %r14,%rcx
+  803084:	ba 00 00 00 00       	mov    $0x0,%edx
+  803089:	48 89 de             	mov    %rbx,%rsi
+  80308c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803091:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  803098:	00 00 00 
+  80309b:	ff d0                	call   *%rax
+  80309d:	89 c3                	mov    %eax,%ebx
+  80309f:	85 c0                	test   %eax,%eax
+  8030a1:	78 4e                	js     8030f1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8030a3:	4c 89 ff             	mov    %r15,%rdi
+  8030a6:	48 b8 da 42 80 00 00 	movabs $0x8042da,%rax
+  8030ad:	00 00 00 
+  8030b0:	ff d0                	call   *%rax
+  8030b2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030b5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030bb:	4c 89 e9             	mov    %r13,%rcx
+  8030be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c3:	4c 89 fe             	mov    %r15,%rsi
+  8030c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030cb:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  8030d2:	00 00 00 
+  8030d5:	ff d0                	call   *%rax
+  8030d7:	89 c3                	mov    %eax,%ebx
+  8030d9:	85 c0                	test   %eax,%eax
+  8030db:	78 14                	js     8030f1 <dup+0xf7>
+
+    return newfdnum;
+  8030dd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030e0:	89 d8                	mov    %ebx,%eax
+  8030e2:	48 83 c4 18          	add    $0x18,%rsp
+  8030e6:	5b                   	pop    %rbx
+  8030e7:	41 5c                	pop    %r12
+  8030e9:	41 5d                	pop    %r13
+  8030eb:	41 5e                	pop    %r14
+  8030ed:	41 5f                	pop    %r15
+  8030ef:	5d                   	pop    %rbp
+  8030f0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030f6:	4c 89 ee             	mov    %r13,%rsi
+  8030f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030fe:	49 bc 26 28 80 00 00 	movabs $0x802826,%r12
+  803105:	00 00 00 
+  803108:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80310b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803110:	4c 89 f6             	mov    %r14,%rsi
+  803113:	bf 00 00 00 00       	mov    $0x0,%edi
+  803118:	41 ff d4             	call   *%r12
+    return res;
+  80311b:	eb c3                	jmp    8030e0 <dup+0xe6>
+
+000000000080311d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80311d:	55                   	push   %rbp
+  80311e:	48 89 e5             	mov    %rsp,%rbp
+  803121:	41 56                	push   %r14
+  803123:	41 55                	push   %r13
+  803125:	41 54                	push   %r12
+  803127:	53                   	push   %rbx
+  803128:	48 83 ec 10          	sub    $0x10,%rsp
+  80312c:	89 fb                	mov    %edi,%ebx
+  80312e:	49 89 f4             	mov    %rsi,%r12
+  803131:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803134:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803138:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  80313f:	00 00 00 
+  803142:	ff d0                	call   *%rax
+  803144:	85 c0                	test   %eax,%eax
+  803146:	78 4c                	js     803194 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803148:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80314c:	41 8b 3e             	mov    (%r14),%edi
+  80314f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803153:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  80315a:	00 00 00 
+  80315d:	ff d0                	call   *%rax
+  80315f:	85 c0                	test   %eax,%eax
+  803161:	78 35                	js     803198 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803163:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803167:	83 e0 03             	and    $0x3,%eax
+  80316a:	83 f8 01             	cmp    $0x1,%eax
+  80316d:	74 2d                	je     80319c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80316f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803173:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803177:	48 85 c0             	test   %rax,%rax
+  80317a:	74 56                	je     8031d2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80317c:	4c 89 ea             	mov    %r13,%rdx
+  80317f:	4c 89 e6             	mov    %r12,%rsi
+  803182:	4c 89 f7             	mov    %r14,%rdi
+  803185:	ff d0                	call   *%rax
+}
+  803187:	48 83 c4 10          	add    $0x10,%rsp
+  80318b:	5b                   	pop    %rbx
+  80318c:	41 5c                	pop    %r12
+  80318e:	41 5d                	pop    %r13
+  803190:	41 5e                	pop    %r14
+  803192:	5d                   	pop    %rbp
+  803193:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803194:	48 98                	cltq
+  803196:	eb ef                	jmp    803187 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803198:	48 98                	cltq
+  80319a:	eb eb                	jmp    803187 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80319c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031a3:	00 00 00 
+  8031a6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031ac:	89 da                	mov    %ebx,%edx
+  8031ae:	48 bf b9 61 80 00 00 	movabs $0x8061b9,%rdi
+  8031b5:	00 00 00 
+  8031b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bd:	48 b9 b2 16 80 00 00 	movabs $0x8016b2,%rcx
+  8031c4:	00 00 00 
+  8031c7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031c9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031d0:	eb b5                	jmp    803187 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031d2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031d9:	eb ac                	jmp    803187 <read+0x6a>
+
+00000000008031db <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031db:	55                   	push   %rbp
+  8031dc:	48 89 e5             	mov    %rsp,%rbp
+  8031df:	41 57                	push   %r15
+  8031e1:	41 56                	push   %r14
+  8031e3:	41 55                	push   %r13
+  8031e5:	41 54                	push   %r12
+  8031e7:	53                   	push   %rbx
+  8031e8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031ec:	48 85 d2             	test   %rdx,%rdx
+  8031ef:	74 54                	je     803245 <readn+0x6a>
+  8031f1:	41 89 fd             	mov    %edi,%r13d
+  8031f4:	49 89 f6             	mov    %rsi,%r14
+  8031f7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031ff:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803204:	49 bf 1d 31 80 00 00 	movabs $0x80311d,%r15
+  80320b:	00 00 00 
+  80320e:	4c 89 e2             	mov    %r12,%rdx
+  803211:	48 29 f2             	sub    %rsi,%rdx
+  803214:	4c 01 f6             	add    %r14,%rsi
+  803217:	44 89 ef             	mov    %r13d,%edi
+  80321a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80321d:	85 c0                	test   %eax,%eax
+  80321f:	78 20                	js     803241 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803221:	01 c3                	add    %eax,%ebx
+  803223:	85 c0                	test   %eax,%eax
+  803225:	74 08                	je     80322f <readn+0x54>
+  803227:	48 63 f3             	movslq %ebx,%rsi
+  80322a:	4c 39 e6             	cmp    %r12,%rsi
+  80322d:	72 df                	jb     80320e <readn+0x33>
+    }
+    return res;
+  80322f:	48 63 c3             	movslq %ebx,%rax
+}
+  803232:	48 83 c4 08          	add    $0x8,%rsp
+  803236:	5b                   	pop    %rbx
+  803237:	41 5c                	pop    %r12
+  803239:	41 5d                	pop    %r13
+  80323b:	41 5e                	pop    %r14
+  80323d:	41 5f                	pop    %r15
+  80323f:	5d                   	pop    %rbp
+  803240:	c3                   	ret
+        if (inc < 0) return inc;
+  803241:	48 98                	cltq
+  803243:	eb ed                	jmp    803232 <readn+0x57>
+    int inc = 1, res = 0;
+  803245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80324a:	eb e3                	jmp    80322f <readn+0x54>
+
+000000000080324c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80324c:	55                   	push   %rbp
+  80324d:	48 89 e5             	mov    %rsp,%rbp
+  803250:	41 56                	push   %r14
+  803252:	41 55                	push   %r13
+  803254:	41 54                	push   %r12
+  803256:	53                   	push   %rbx
+  803257:	48 83 ec 10          	sub    $0x10,%rsp
+  80325b:	89 fb                	mov    %edi,%ebx
+  80325d:	49 89 f4             	mov    %rsi,%r12
+  803260:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803263:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803267:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  80326e:	00 00 00 
+  803271:	ff d0                	call   *%rax
+  803273:	85 c0                	test   %eax,%eax
+  803275:	78 47                	js     8032be <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803277:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80327b:	41 8b 3e             	mov    (%r14),%edi
+  80327e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803282:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  803289:	00 00 00 
+  80328c:	ff d0                	call   *%rax
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	78 30                	js     8032c2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803292:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803297:	74 2d                	je     8032c6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803299:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80329d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032a1:	48 85 c0             	test   %rax,%rax
+  8032a4:	74 56                	je     8032fc <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8032a6:	4c 89 ea             	mov    %r13,%rdx
+  8032a9:	4c 89 e6             	mov    %r12,%rsi
+  8032ac:	4c 89 f7             	mov    %r14,%rdi
+  8032af:	ff d0                	call   *%rax
+}
+  8032b1:	48 83 c4 10          	add    $0x10,%rsp
+  8032b5:	5b                   	pop    %rbx
+  8032b6:	41 5c                	pop    %r12
+  8032b8:	41 5d                	pop    %r13
+  8032ba:	41 5e                	pop    %r14
+  8032bc:	5d                   	pop    %rbp
+  8032bd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032be:	48 98                	cltq
+  8032c0:	eb ef                	jmp    8032b1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032c2:	48 98                	cltq
+  8032c4:	eb eb                	jmp    8032b1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032c6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032cd:	00 00 00 
+  8032d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032d6:	89 da                	mov    %ebx,%edx
+  8032d8:	48 bf d5 61 80 00 00 	movabs $0x8061d5,%rdi
+  8032df:	00 00 00 
+  8032e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e7:	48 b9 b2 16 80 00 00 	movabs $0x8016b2,%rcx
+  8032ee:	00 00 00 
+  8032f1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032fa:	eb b5                	jmp    8032b1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032fc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803303:	eb ac                	jmp    8032b1 <write+0x65>
+
+0000000000803305 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803305:	55                   	push   %rbp
+  803306:	48 89 e5             	mov    %rsp,%rbp
+  803309:	53                   	push   %rbx
+  80330a:	48 83 ec 18          	sub    $0x18,%rsp
+  80330e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803310:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803314:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  80331b:	00 00 00 
+  80331e:	ff d0                	call   *%rax
+  803320:	85 c0                	test   %eax,%eax
+  803322:	78 0c                	js     803330 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803328:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80332b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803330:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803334:	c9                   	leave
+  803335:	c3                   	ret
+
+0000000000803336 <tell>:
+
+int tell(int fdnum) {
+  803336:	55                   	push   %rbp
+  803337:	48 89 e5             	mov    %rsp,%rbp
+  80333a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80333e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803342:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  803349:	00 00 00 
+  80334c:	ff d0                	call   *%rax
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	78 07                	js     803359 <tell+0x23>
+
+    return fd->fd_offset;
+  803352:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803356:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803359:	c9                   	leave
+  80335a:	c3                   	ret
+
+000000000080335b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80335b:	55                   	push   %rbp
+  80335c:	48 89 e5             	mov    %rsp,%rbp
+  80335f:	41 55                	push   %r13
+  803361:	41 54                	push   %r12
+  803363:	53                   	push   %rbx
+  803364:	48 83 ec 18          	sub    $0x18,%rsp
+  803368:	89 fb                	mov    %edi,%ebx
+  80336a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80336d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803371:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  803378:	00 00 00 
+  80337b:	ff d0                	call   *%rax
+  80337d:	85 c0                	test   %eax,%eax
+  80337f:	78 38                	js     8033b9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803381:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803385:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803389:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80338d:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  803394:	00 00 00 
+  803397:	ff d0                	call   *%rax
+  803399:	85 c0                	test   %eax,%eax
+  80339b:	78 1c                	js     8033b9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80339d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8033a2:	74 20                	je     8033c4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033a8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033ac:	48 85 c0             	test   %rax,%rax
+  8033af:	74 47                	je     8033f8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8033b1:	44 89 e6             	mov    %r12d,%esi
+  8033b4:	4c 89 ef             	mov    %r13,%rdi
+  8033b7:	ff d0                	call   *%rax
+}
+  8033b9:	48 83 c4 18          	add    $0x18,%rsp
+  8033bd:	5b                   	pop    %rbx
+  8033be:	41 5c                	pop    %r12
+  8033c0:	41 5d                	pop    %r13
+  8033c2:	5d                   	pop    %rbp
+  8033c3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033c4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033cb:	00 00 00 
+  8033ce:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033d4:	89 da                	mov    %ebx,%edx
+  8033d6:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  8033dd:	00 00 00 
+  8033e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e5:	48 b9 b2 16 80 00 00 	movabs $0x8016b2,%rcx
+  8033ec:	00 00 00 
+  8033ef:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033f6:	eb c1                	jmp    8033b9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033f8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033fd:	eb ba                	jmp    8033b9 <ftruncate+0x5e>
+
+00000000008033ff <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033ff:	55                   	push   %rbp
+  803400:	48 89 e5             	mov    %rsp,%rbp
+  803403:	41 54                	push   %r12
+  803405:	53                   	push   %rbx
+  803406:	48 83 ec 10          	sub    $0x10,%rsp
+  80340a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80340d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803411:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  803418:	00 00 00 
+  80341b:	ff d0                	call   *%rax
+  80341d:	85 c0                	test   %eax,%eax
+  80341f:	78 63                	js     803484 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803421:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803425:	41 8b 3c 24          	mov    (%r12),%edi
+  803429:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80342d:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  803434:	00 00 00 
+  803437:	ff d0                	call   *%rax
+  803439:	85 c0                	test   %eax,%eax
+  80343b:	78 47                	js     803484 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80343d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803441:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803446:	74 45                	je     80348d <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803448:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80344b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803452:	00 00 00 
+    stat->st_isdir = 0;
+  803455:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80345c:	00 00 00 
+    stat->st_ino = 0;
+  80345f:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803466:	00 00 00 00 
+    stat->st_version = 0;
+  80346a:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803471:	00 00 00 
+    stat->st_dev = dev;
+  803474:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80347b:	48 89 de             	mov    %rbx,%rsi
+  80347e:	4c 89 e7             	mov    %r12,%rdi
+  803481:	ff 50 28             	call   *0x28(%rax)
+}
+  803484:	48 83 c4 10          	add    $0x10,%rsp
+  803488:	5b                   	pop    %rbx
+  803489:	41 5c                	pop    %r12
+  80348b:	5d                   	pop    %rbp
+  80348c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80348d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803492:	eb f0                	jmp    803484 <fstat+0x85>
+
+0000000000803494 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803494:	55                   	push   %rbp
+  803495:	48 89 e5             	mov    %rsp,%rbp
+  803498:	41 54                	push   %r12
+  80349a:	53                   	push   %rbx
+  80349b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80349e:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a3:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  8034aa:	00 00 00 
+  8034ad:	ff d0                	call   *%rax
+  8034af:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034b1:	85 c0                	test   %eax,%eax
+  8034b3:	78 25                	js     8034da <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034b5:	4c 89 e6             	mov    %r12,%rsi
+  8034b8:	89 c7                	mov    %eax,%edi
+  8034ba:	48 b8 ff 33 80 00 00 	movabs $0x8033ff,%rax
+  8034c1:	00 00 00 
+  8034c4:	ff d0                	call   *%rax
+  8034c6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034c9:	89 df                	mov    %ebx,%edi
+  8034cb:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  8034d2:	00 00 00 
+  8034d5:	ff d0                	call   *%rax
+
+    return res;
+  8034d7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034da:	89 d8                	mov    %ebx,%eax
+  8034dc:	5b                   	pop    %rbx
+  8034dd:	41 5c                	pop    %r12
+  8034df:	5d                   	pop    %rbp
+  8034e0:	c3                   	ret
+
+00000000008034e1 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034e1:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034e8:	00 00 00 
+  8034eb:	83 38 00             	cmpl   $0x0,(%rax)
+  8034ee:	74 0a                	je     8034fa <fsipc_env+0x19>
+    return fsenv;
+}
+  8034f0:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034f7:	00 00 
+  8034f9:	c3                   	ret
+fsipc_env(void) {
+  8034fa:	55                   	push   %rbp
+  8034fb:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  803503:	48 b8 87 56 80 00 00 	movabs $0x805687,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+  80350f:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803516:	00 00 
+}
+  803518:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80351f:	00 00 
+  803521:	5d                   	pop    %rbp
+  803522:	c3                   	ret
+
+0000000000803523 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803523:	55                   	push   %rbp
+  803524:	48 89 e5             	mov    %rsp,%rbp
+  803527:	53                   	push   %rbx
+  803528:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80352c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803533:	00 
+  803534:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80353b:	00 
+  80353c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803543:	00 
+  803544:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80354b:	00 
+  80354c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803553:	00 
+
+    assert(size <= sizeof(words));
+  803554:	48 83 fa 28          	cmp    $0x28,%rdx
+  803558:	77 38                	ja     803592 <fsipc_short+0x6f>
+  80355a:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80355c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803560:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  803567:	00 00 00 
+  80356a:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80356c:	48 b8 e1 34 80 00 00 	movabs $0x8034e1,%rax
+  803573:	00 00 00 
+  803576:	ff d0                	call   *%rax
+  803578:	89 c7                	mov    %eax,%edi
+  80357a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80357e:	89 de                	mov    %ebx,%esi
+  803580:	48 b8 ea 55 80 00 00 	movabs $0x8055ea,%rax
+  803587:	00 00 00 
+  80358a:	ff d0                	call   *%rax
+}
+  80358c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803590:	c9                   	leave
+  803591:	c3                   	ret
+    assert(size <= sizeof(words));
+  803592:	48 b9 20 62 80 00 00 	movabs $0x806220,%rcx
+  803599:	00 00 00 
+  80359c:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8035a3:	00 00 00 
+  8035a6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8035ab:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8035b2:	00 00 00 
+  8035b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ba:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  8035c1:	00 00 00 
+  8035c4:	41 ff d0             	call   *%r8
+
+00000000008035c7 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035c7:	55                   	push   %rbp
+  8035c8:	48 89 e5             	mov    %rsp,%rbp
+  8035cb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035cf:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035d2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035d5:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035d8:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035e1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035e6:	48 b8 23 35 80 00 00 	movabs $0x803523,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+}
+  8035f2:	c9                   	leave
+  8035f3:	c3                   	ret
+
+00000000008035f4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035f4:	55                   	push   %rbp
+  8035f5:	48 89 e5             	mov    %rsp,%rbp
+  8035f8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035fc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803602:	ba 04 00 00 00       	mov    $0x4,%edx
+  803607:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80360b:	bf 06 00 00 00       	mov    $0x6,%edi
+  803610:	48 b8 23 35 80 00 00 	movabs $0x803523,%rax
+  803617:	00 00 00 
+  80361a:	ff d0                	call   *%rax
+}
+  80361c:	c9                   	leave
+  80361d:	c3                   	ret
+
+000000000080361e <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80361e:	55                   	push   %rbp
+  80361f:	48 89 e5             	mov    %rsp,%rbp
+  803622:	41 54                	push   %r12
+  803624:	53                   	push   %rbx
+  803625:	48 83 ec 10          	sub    $0x10,%rsp
+  803629:	89 fb                	mov    %edi,%ebx
+  80362b:	49 89 f4             	mov    %rsi,%r12
+  80362e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803632:	48 b8 e1 34 80 00 00 	movabs $0x8034e1,%rax
+  803639:	00 00 00 
+  80363c:	ff d0                	call   *%rax
+  80363e:	89 c7                	mov    %eax,%edi
+  803640:	6a 00                	push   $0x0
+  803642:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803646:	50                   	push   %rax
+  803647:	4d 89 e1             	mov    %r12,%r9
+  80364a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803650:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803655:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80365c:	00 00 00 
+  80365f:	89 de                	mov    %ebx,%esi
+  803661:	48 b8 85 55 80 00 00 	movabs $0x805585,%rax
+  803668:	00 00 00 
+  80366b:	ff d0                	call   *%rax
+}
+  80366d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803671:	5b                   	pop    %rbx
+  803672:	41 5c                	pop    %r12
+  803674:	5d                   	pop    %rbp
+  803675:	c3                   	ret
+
+0000000000803676 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	41 54                	push   %r12
+  80367c:	53                   	push   %rbx
+  80367d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803680:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803683:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80368a:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80368c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803691:	be 00 00 00 00       	mov    $0x0,%esi
+  803696:	bf 05 00 00 00       	mov    $0x5,%edi
+  80369b:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  8036a2:	00 00 00 
+  8036a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036a7:	85 c0                	test   %eax,%eax
+  8036a9:	78 5a                	js     803705 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8036ab:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036b2:	00 00 00 
+  8036b5:	4c 89 e6             	mov    %r12,%rsi
+  8036b8:	48 89 df             	mov    %rbx,%rdi
+  8036bb:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036c7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036ce:	00 
+  8036cf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036d5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036dc:	00 
+  8036dd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036e3:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036ea:	00 
+  8036eb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036f2:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036f9:	00 
+  8036fa:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803700:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803705:	5b                   	pop    %rbx
+  803706:	41 5c                	pop    %r12
+  803708:	5d                   	pop    %rbp
+  803709:	c3                   	ret
+
+000000000080370a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80370a:	55                   	push   %rbp
+  80370b:	48 89 e5             	mov    %rsp,%rbp
+  80370e:	41 57                	push   %r15
+  803710:	41 56                	push   %r14
+  803712:	41 55                	push   %r13
+  803714:	41 54                	push   %r12
+  803716:	53                   	push   %rbx
+  803717:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80371b:	48 85 ff             	test   %rdi,%rdi
+  80371e:	0f 84 a1 00 00 00    	je     8037c5 <devfile_read+0xbb>
+  803724:	49 89 ff             	mov    %rdi,%r15
+  803727:	49 89 f5             	mov    %rsi,%r13
+  80372a:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  80372d:	48 85 f6             	test   %rsi,%rsi
+  803730:	0f 84 c4 00 00 00    	je     8037fa <devfile_read+0xf0>
+    size_t total_read = 0;
+  803736:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80373d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80373e:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803745:	00 00 00 
+  803748:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80374c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80374f:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803753:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803758:	be 00 00 00 00       	mov    $0x0,%esi
+  80375d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803762:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  803769:	00 00 00 
+  80376c:	ff d0                	call   *%rax
+        if (res < 0) {
+  80376e:	85 c0                	test   %eax,%eax
+  803770:	0f 88 b9 00 00 00    	js     80382f <devfile_read+0x125>
+        assert(res <= n);
+  803776:	48 63 d8             	movslq %eax,%rbx
+  803779:	49 39 dc             	cmp    %rbx,%r12
+  80377c:	0f 82 b1 00 00 00    	jb     803833 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803782:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803787:	0f 87 db 00 00 00    	ja     803868 <devfile_read+0x15e>
+        if (!res) {
+  80378d:	85 c0                	test   %eax,%eax
+  80378f:	74 21                	je     8037b2 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803791:	48 89 da             	mov    %rbx,%rdx
+  803794:	4c 89 f6             	mov    %r14,%rsi
+  803797:	4c 89 ef             	mov    %r13,%rdi
+  80379a:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  8037a1:	00 00 00 
+  8037a4:	ff d0                	call   *%rax
+        total_read += res;
+  8037a6:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8037aa:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8037ad:	49 29 dc             	sub    %rbx,%r12
+  8037b0:	75 96                	jne    803748 <devfile_read+0x3e>
+    return total_read;
+  8037b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037b6:	48 83 c4 18          	add    $0x18,%rsp
+  8037ba:	5b                   	pop    %rbx
+  8037bb:	41 5c                	pop    %r12
+  8037bd:	41 5d                	pop    %r13
+  8037bf:	41 5e                	pop    %r14
+  8037c1:	41 5f                	pop    %r15
+  8037c3:	5d                   	pop    %rbp
+  8037c4:	c3                   	ret
+    assert(fd);
+  8037c5:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  8037cc:	00 00 00 
+  8037cf:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037d6:	00 00 00 
+  8037d9:	be 91 00 00 00       	mov    $0x91,%esi
+  8037de:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8037e5:	00 00 00 
+  8037e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ed:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  8037f4:	00 00 00 
+  8037f7:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037fa:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  803801:	00 00 00 
+  803804:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80380b:	00 00 00 
+  80380e:	be 92 00 00 00       	mov    $0x92,%esi
+  803813:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80381a:	00 00 00 
+  80381d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803822:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  803829:	00 00 00 
+  80382c:	41 ff d0             	call   *%r8
+            return res;
+  80382f:	48 98                	cltq
+  803831:	eb 83                	jmp    8037b6 <devfile_read+0xac>
+        assert(res <= n);
+  803833:	48 b9 5d 62 80 00 00 	movabs $0x80625d,%rcx
+  80383a:	00 00 00 
+  80383d:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803844:	00 00 00 
+  803847:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80384c:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803853:	00 00 00 
+  803856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385b:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  803862:	00 00 00 
+  803865:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803868:	48 b9 68 62 80 00 00 	movabs $0x806268,%rcx
+  80386f:	00 00 00 
+  803872:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803879:	00 00 00 
+  80387c:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803881:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803888:	00 00 00 
+  80388b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803890:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  803897:	00 00 00 
+  80389a:	41 ff d0             	call   *%r8
+
+000000000080389d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80389d:	55                   	push   %rbp
+  80389e:	48 89 e5             	mov    %rsp,%rbp
+  8038a1:	41 57                	push   %r15
+  8038a3:	41 56                	push   %r14
+  8038a5:	41 55                	push   %r13
+  8038a7:	41 54                	push   %r12
+  8038a9:	53                   	push   %rbx
+  8038aa:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8038ae:	48 85 ff             	test   %rdi,%rdi
+  8038b1:	0f 84 83 00 00 00    	je     80393a <devfile_write+0x9d>
+  8038b7:	49 89 ff             	mov    %rdi,%r15
+  8038ba:	49 89 f4             	mov    %rsi,%r12
+  8038bd:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038c0:	48 85 f6             	test   %rsi,%rsi
+  8038c3:	0f 84 a6 00 00 00    	je     80396f <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038c9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038cf:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038d6:	00 00 00 
+  8038d9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038dd:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038e0:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038e4:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038e9:	48 39 d3             	cmp    %rdx,%rbx
+  8038ec:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038f0:	4c 89 e6             	mov    %r12,%rsi
+  8038f3:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038fa:	00 00 00 
+  8038fd:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  803904:	00 00 00 
+  803907:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803909:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80390e:	be 00 00 00 00       	mov    $0x0,%esi
+  803913:	bf 04 00 00 00       	mov    $0x4,%edi
+  803918:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  80391f:	00 00 00 
+  803922:	ff d0                	call   *%rax
+        if (res < 0) {
+  803924:	85 c0                	test   %eax,%eax
+  803926:	78 7c                	js     8039a4 <devfile_write+0x107>
+        total_written += res;
+  803928:	48 98                	cltq
+  80392a:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  80392d:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803930:	48 29 c3             	sub    %rax,%rbx
+  803933:	75 a4                	jne    8038d9 <devfile_write+0x3c>
+    return total_written;
+  803935:	4c 89 e8             	mov    %r13,%rax
+  803938:	eb 6c                	jmp    8039a6 <devfile_write+0x109>
+    assert(fd);
+  80393a:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  803941:	00 00 00 
+  803944:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80394b:	00 00 00 
+  80394e:	be bd 00 00 00       	mov    $0xbd,%esi
+  803953:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80395a:	00 00 00 
+  80395d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803962:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  803969:	00 00 00 
+  80396c:	41 ff d0             	call   *%r8
+    assert(buf);
+  80396f:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  803976:	00 00 00 
+  803979:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803980:	00 00 00 
+  803983:	be be 00 00 00       	mov    $0xbe,%esi
+  803988:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80398f:	00 00 00 
+  803992:	b8 00 00 00 00       	mov    $0x0,%eax
+  803997:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  80399e:	00 00 00 
+  8039a1:	41 ff d0             	call   *%r8
+            return res;
+  8039a4:	48 98                	cltq
+}
+  8039a6:	48 83 c4 08          	add    $0x8,%rsp
+  8039aa:	5b                   	pop    %rbx
+  8039ab:	41 5c                	pop    %r12
+  8039ad:	41 5d                	pop    %r13
+  8039af:	41 5e                	pop    %r14
+  8039b1:	41 5f                	pop    %r15
+  8039b3:	5d                   	pop    %rbp
+  8039b4:	c3                   	ret
+
+00000000008039b5 <open>:
+open(const char *path, int mode) {
+  8039b5:	55                   	push   %rbp
+  8039b6:	48 89 e5             	mov    %rsp,%rbp
+  8039b9:	41 55                	push   %r13
+  8039bb:	41 54                	push   %r12
+  8039bd:	53                   	push   %rbx
+  8039be:	48 83 ec 18          	sub    $0x18,%rsp
+  8039c2:	49 89 fc             	mov    %rdi,%r12
+  8039c5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039c8:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+  8039d4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039da:	0f 87 8f 00 00 00    	ja     803a6f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039e0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039e4:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  8039eb:	00 00 00 
+  8039ee:	ff d0                	call   *%rax
+  8039f0:	89 c3                	mov    %eax,%ebx
+  8039f2:	85 c0                	test   %eax,%eax
+  8039f4:	78 55                	js     803a4b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039f6:	4c 89 e6             	mov    %r12,%rsi
+  8039f9:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803a00:	00 00 00 
+  803a03:	48 89 df             	mov    %rbx,%rdi
+  803a06:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  803a0d:	00 00 00 
+  803a10:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a12:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a19:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a1e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a22:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a27:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  803a2e:	00 00 00 
+  803a31:	ff d0                	call   *%rax
+  803a33:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a35:	85 c0                	test   %eax,%eax
+  803a37:	78 1f                	js     803a58 <open+0xa3>
+    return fd2num(fd);
+  803a39:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a3d:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  803a44:	00 00 00 
+  803a47:	ff d0                	call   *%rax
+  803a49:	89 c3                	mov    %eax,%ebx
+}
+  803a4b:	89 d8                	mov    %ebx,%eax
+  803a4d:	48 83 c4 18          	add    $0x18,%rsp
+  803a51:	5b                   	pop    %rbx
+  803a52:	41 5c                	pop    %r12
+  803a54:	41 5d                	pop    %r13
+  803a56:	5d                   	pop    %rbp
+  803a57:	c3                   	ret
+        fd_close(fd, 0);
+  803a58:	be 00 00 00 00       	mov    $0x0,%esi
+  803a5d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a61:	48 b8 f5 2e 80 00 00 	movabs $0x802ef5,%rax
+  803a68:	00 00 00 
+  803a6b:	ff d0                	call   *%rax
+        return res;
+  803a6d:	eb dc                	jmp    803a4b <open+0x96>
+        return -E_BAD_PATH;
+  803a6f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a74:	eb d5                	jmp    803a4b <open+0x96>
+
+0000000000803a76 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a76:	55                   	push   %rbp
+  803a77:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a7f:	be 00 00 00 00       	mov    $0x0,%esi
+  803a84:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a89:	48 b8 23 35 80 00 00 	movabs $0x803523,%rax
+  803a90:	00 00 00 
+  803a93:	ff d0                	call   *%rax
+}
+  803a95:	5d                   	pop    %rbp
+  803a96:	c3                   	ret
+
+0000000000803a97 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a97:	55                   	push   %rbp
+  803a98:	48 89 e5             	mov    %rsp,%rbp
+  803a9b:	41 56                	push   %r14
+  803a9d:	41 55                	push   %r13
+  803a9f:	41 54                	push   %r12
+  803aa1:	53                   	push   %rbx
+  803aa2:	48 83 ec 10          	sub    $0x10,%rsp
+  803aa6:	41 89 f6             	mov    %esi,%r14d
+  803aa9:	49 89 d4             	mov    %rdx,%r12
+  803aac:	48 89 cb             	mov    %rcx,%rbx
+  803aaf:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ab2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ab6:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  803abd:	00 00 00 
+  803ac0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ac2:	85 c0                	test   %eax,%eax
+  803ac4:	78 46                	js     803b0c <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ac6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803aca:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ad1:	00 00 00 
+  803ad4:	8b 00                	mov    (%rax),%eax
+  803ad6:	39 02                	cmp    %eax,(%rdx)
+  803ad8:	75 3f                	jne    803b19 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803ada:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ae1:	00 00 00 
+  803ae4:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ae7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ae9:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803aed:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803af1:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803af5:	48 89 da             	mov    %rbx,%rdx
+  803af8:	4c 89 e6             	mov    %r12,%rsi
+  803afb:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b00:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  803b07:	00 00 00 
+  803b0a:	ff d0                	call   *%rax
+}
+  803b0c:	48 83 c4 10          	add    $0x10,%rsp
+  803b10:	5b                   	pop    %rbx
+  803b11:	41 5c                	pop    %r12
+  803b13:	41 5d                	pop    %r13
+  803b15:	41 5e                	pop    %r14
+  803b17:	5d                   	pop    %rbp
+  803b18:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b19:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b1e:	eb ec                	jmp    803b0c <file_map+0x75>
+
+0000000000803b20 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b20:	55                   	push   %rbp
+  803b21:	48 89 e5             	mov    %rsp,%rbp
+  803b24:	41 54                	push   %r12
+  803b26:	53                   	push   %rbx
+  803b27:	48 83 ec 20          	sub    $0x20,%rsp
+  803b2b:	41 89 f4             	mov    %esi,%r12d
+  803b2e:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b31:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b35:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  803b3c:	00 00 00 
+  803b3f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b41:	85 c0                	test   %eax,%eax
+  803b43:	78 3c                	js     803b81 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b49:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b50:	00 00 00 
+  803b53:	8b 0a                	mov    (%rdx),%ecx
+  803b55:	39 08                	cmp    %ecx,(%rax)
+  803b57:	75 31                	jne    803b8a <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b59:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b5c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b5f:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b63:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b67:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b6c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b70:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b75:	48 b8 23 35 80 00 00 	movabs $0x803523,%rax
+  803b7c:	00 00 00 
+  803b7f:	ff d0                	call   *%rax
+}
+  803b81:	48 83 c4 20          	add    $0x20,%rsp
+  803b85:	5b                   	pop    %rbx
+  803b86:	41 5c                	pop    %r12
+  803b88:	5d                   	pop    %rbp
+  803b89:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b8a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b8f:	eb f0                	jmp    803b81 <file_msync+0x61>
+
+0000000000803b91 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b91:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b95:	7f 01                	jg     803b98 <writebuf+0x7>
+  803b97:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b98:	55                   	push   %rbp
+  803b99:	48 89 e5             	mov    %rsp,%rbp
+  803b9c:	53                   	push   %rbx
+  803b9d:	48 83 ec 08          	sub    $0x8,%rsp
+  803ba1:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803ba4:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803ba8:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803bac:	8b 3f                	mov    (%rdi),%edi
+  803bae:	48 b8 4c 32 80 00 00 	movabs $0x80324c,%rax
+  803bb5:	00 00 00 
+  803bb8:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803bba:	48 85 c0             	test   %rax,%rax
+  803bbd:	7e 04                	jle    803bc3 <writebuf+0x32>
+  803bbf:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bc3:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bc7:	48 39 c2             	cmp    %rax,%rdx
+  803bca:	74 0f                	je     803bdb <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bcc:	48 85 c0             	test   %rax,%rax
+  803bcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bd4:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bd8:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bdb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bdf:	c9                   	leave
+  803be0:	c3                   	ret
+
+0000000000803be1 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803be1:	8b 46 04             	mov    0x4(%rsi),%eax
+  803be4:	8d 50 01             	lea    0x1(%rax),%edx
+  803be7:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bea:	48 98                	cltq
+  803bec:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bf1:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bf7:	74 01                	je     803bfa <putch+0x19>
+  803bf9:	c3                   	ret
+putch(int ch, void *arg) {
+  803bfa:	55                   	push   %rbp
+  803bfb:	48 89 e5             	mov    %rsp,%rbp
+  803bfe:	53                   	push   %rbx
+  803bff:	48 83 ec 08          	sub    $0x8,%rsp
+  803c03:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803c06:	48 89 f7             	mov    %rsi,%rdi
+  803c09:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  803c10:	00 00 00 
+  803c13:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c15:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c20:	c9                   	leave
+  803c21:	c3                   	ret
+
+0000000000803c22 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c22:	55                   	push   %rbp
+  803c23:	48 89 e5             	mov    %rsp,%rbp
+  803c26:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c2d:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c30:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c36:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c3d:	00 00 00 
+    state.result = 0;
+  803c40:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c47:	00 00 00 00 
+    state.error = 1;
+  803c4b:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c52:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c55:	48 89 f2             	mov    %rsi,%rdx
+  803c58:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c5f:	48 bf e1 3b 80 00 00 	movabs $0x803be1,%rdi
+  803c66:	00 00 00 
+  803c69:	48 b8 02 18 80 00 00 	movabs $0x801802,%rax
+  803c70:	00 00 00 
+  803c73:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c75:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c7c:	7f 14                	jg     803c92 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c7e:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c85:	48 85 c0             	test   %rax,%rax
+  803c88:	75 06                	jne    803c90 <vfprintf+0x6e>
+  803c8a:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c90:	c9                   	leave
+  803c91:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c92:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c99:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  803ca0:	00 00 00 
+  803ca3:	ff d0                	call   *%rax
+  803ca5:	eb d7                	jmp    803c7e <vfprintf+0x5c>
+
+0000000000803ca7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803ca7:	55                   	push   %rbp
+  803ca8:	48 89 e5             	mov    %rsp,%rbp
+  803cab:	48 83 ec 50          	sub    $0x50,%rsp
+  803caf:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cb3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cb7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cbb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cbf:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cc6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cd2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cd6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cda:	48 b8 22 3c 80 00 00 	movabs $0x803c22,%rax
+  803ce1:	00 00 00 
+  803ce4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ce6:	c9                   	leave
+  803ce7:	c3                   	ret
+
+0000000000803ce8 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803ce8:	55                   	push   %rbp
+  803ce9:	48 89 e5             	mov    %rsp,%rbp
+  803cec:	48 83 ec 50          	sub    $0x50,%rsp
+  803cf0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cf4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cf8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cfc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d00:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d04:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d0b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d13:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d17:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d1b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d1f:	48 89 fe             	mov    %rdi,%rsi
+  803d22:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d27:	48 b8 22 3c 80 00 00 	movabs $0x803c22,%rax
+  803d2e:	00 00 00 
+  803d31:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d33:	c9                   	leave
+  803d34:	c3                   	ret
+
+0000000000803d35 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d35:	55                   	push   %rbp
+  803d36:	48 89 e5             	mov    %rsp,%rbp
+  803d39:	41 54                	push   %r12
+  803d3b:	53                   	push   %rbx
+  803d3c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d3f:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  803d46:	00 00 00 
+  803d49:	ff d0                	call   *%rax
+  803d4b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d4e:	48 be 90 62 80 00 00 	movabs $0x806290,%rsi
+  803d55:	00 00 00 
+  803d58:	48 89 df             	mov    %rbx,%rdi
+  803d5b:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  803d62:	00 00 00 
+  803d65:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d67:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d6c:	41 2b 04 24          	sub    (%r12),%eax
+  803d70:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d76:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d7d:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d80:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d87:	00 00 00 
+  803d8a:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d96:	5b                   	pop    %rbx
+  803d97:	41 5c                	pop    %r12
+  803d99:	5d                   	pop    %rbp
+  803d9a:	c3                   	ret
+
+0000000000803d9b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d9b:	55                   	push   %rbp
+  803d9c:	48 89 e5             	mov    %rsp,%rbp
+  803d9f:	41 54                	push   %r12
+  803da1:	53                   	push   %rbx
+  803da2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803da5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803daa:	48 89 fe             	mov    %rdi,%rsi
+  803dad:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db2:	49 bc 26 28 80 00 00 	movabs $0x802826,%r12
+  803db9:	00 00 00 
+  803dbc:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803dbf:	48 89 df             	mov    %rbx,%rdi
+  803dc2:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  803dc9:	00 00 00 
+  803dcc:	ff d0                	call   *%rax
+  803dce:	48 89 c6             	mov    %rax,%rsi
+  803dd1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ddb:	41 ff d4             	call   *%r12
+}
+  803dde:	5b                   	pop    %rbx
+  803ddf:	41 5c                	pop    %r12
+  803de1:	5d                   	pop    %rbp
+  803de2:	c3                   	ret
+
+0000000000803de3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803de3:	55                   	push   %rbp
+  803de4:	48 89 e5             	mov    %rsp,%rbp
+  803de7:	41 57                	push   %r15
+  803de9:	41 56                	push   %r14
+  803deb:	41 55                	push   %r13
+  803ded:	41 54                	push   %r12
+  803def:	53                   	push   %rbx
+  803df0:	48 83 ec 18          	sub    $0x18,%rsp
+  803df4:	49 89 fc             	mov    %rdi,%r12
+  803df7:	49 89 f5             	mov    %rsi,%r13
+  803dfa:	49 89 d7             	mov    %rdx,%r15
+  803dfd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e01:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  803e08:	00 00 00 
+  803e0b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e0d:	4d 85 ff             	test   %r15,%r15
+  803e10:	0f 84 af 00 00 00    	je     803ec5 <devpipe_write+0xe2>
+  803e16:	48 89 c3             	mov    %rax,%rbx
+  803e19:	4c 89 f8             	mov    %r15,%rax
+  803e1c:	4d 89 ef             	mov    %r13,%r15
+  803e1f:	4c 01 e8             	add    %r13,%rax
+  803e22:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e26:	49 bd 1c 27 80 00 00 	movabs $0x80271c,%r13
+  803e2d:	00 00 00 
+            sys_yield();
+  803e30:	49 be ad 26 80 00 00 	movabs $0x8026ad,%r14
+  803e37:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e3a:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e3d:	48 63 ce             	movslq %esi,%rcx
+  803e40:	48 63 03             	movslq (%rbx),%rax
+  803e43:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e49:	48 39 c1             	cmp    %rax,%rcx
+  803e4c:	72 2e                	jb     803e7c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e4e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e53:	48 89 da             	mov    %rbx,%rdx
+  803e56:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e5b:	4c 89 e7             	mov    %r12,%rdi
+  803e5e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e61:	85 c0                	test   %eax,%eax
+  803e63:	74 66                	je     803ecb <devpipe_write+0xe8>
+            sys_yield();
+  803e65:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e68:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e6b:	48 63 ce             	movslq %esi,%rcx
+  803e6e:	48 63 03             	movslq (%rbx),%rax
+  803e71:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e77:	48 39 c1             	cmp    %rax,%rcx
+  803e7a:	73 d2                	jae    803e4e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e7c:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e80:	48 89 ca             	mov    %rcx,%rdx
+  803e83:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e87:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e8e:	08 10 20 
+  803e91:	48 f7 e2             	mul    %rdx
+  803e94:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e98:	48 89 d0             	mov    %rdx,%rax
+  803e9b:	48 c1 e0 09          	shl    $0x9,%rax
+  803e9f:	48 29 d0             	sub    %rdx,%rax
+  803ea2:	48 c1 e0 03          	shl    $0x3,%rax
+  803ea6:	48 29 c1             	sub    %rax,%rcx
+  803ea9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803eae:	83 c6 01             	add    $0x1,%esi
+  803eb1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803eb4:	49 83 c7 01          	add    $0x1,%r15
+  803eb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ebc:	49 39 c7             	cmp    %rax,%r15
+  803ebf:	0f 85 75 ff ff ff    	jne    803e3a <devpipe_write+0x57>
+    return n;
+  803ec5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ec9:	eb 05                	jmp    803ed0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed0:	48 83 c4 18          	add    $0x18,%rsp
+  803ed4:	5b                   	pop    %rbx
+  803ed5:	41 5c                	pop    %r12
+  803ed7:	41 5d                	pop    %r13
+  803ed9:	41 5e                	pop    %r14
+  803edb:	41 5f                	pop    %r15
+  803edd:	5d                   	pop    %rbp
+  803ede:	c3                   	ret
+
+0000000000803edf <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803edf:	55                   	push   %rbp
+  803ee0:	48 89 e5             	mov    %rsp,%rbp
+  803ee3:	41 57                	push   %r15
+  803ee5:	41 56                	push   %r14
+  803ee7:	41 55                	push   %r13
+  803ee9:	41 54                	push   %r12
+  803eeb:	53                   	push   %rbx
+  803eec:	48 83 ec 18          	sub    $0x18,%rsp
+  803ef0:	49 89 fc             	mov    %rdi,%r12
+  803ef3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ef7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803efb:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  803f02:	00 00 00 
+  803f05:	ff d0                	call   *%rax
+  803f07:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803f0a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f10:	49 bd 1c 27 80 00 00 	movabs $0x80271c,%r13
+  803f17:	00 00 00 
+            sys_yield();
+  803f1a:	49 be ad 26 80 00 00 	movabs $0x8026ad,%r14
+  803f21:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f24:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f29:	74 7d                	je     803fa8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f2b:	8b 03                	mov    (%rbx),%eax
+  803f2d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f30:	75 26                	jne    803f58 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f32:	4d 85 ff             	test   %r15,%r15
+  803f35:	75 77                	jne    803fae <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f37:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f3c:	48 89 da             	mov    %rbx,%rdx
+  803f3f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f44:	4c 89 e7             	mov    %r12,%rdi
+  803f47:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f4a:	85 c0                	test   %eax,%eax
+  803f4c:	74 72                	je     803fc0 <devpipe_read+0xe1>
+            sys_yield();
+  803f4e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f51:	8b 03                	mov    (%rbx),%eax
+  803f53:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f56:	74 df                	je     803f37 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f58:	48 63 c8             	movslq %eax,%rcx
+  803f5b:	48 89 ca             	mov    %rcx,%rdx
+  803f5e:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f62:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f69:	08 10 20 
+  803f6c:	48 89 d0             	mov    %rdx,%rax
+  803f6f:	48 f7 e6             	mul    %rsi
+  803f72:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f76:	48 89 d0             	mov    %rdx,%rax
+  803f79:	48 c1 e0 09          	shl    $0x9,%rax
+  803f7d:	48 29 d0             	sub    %rdx,%rax
+  803f80:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f87:	00 
+  803f88:	48 89 c8             	mov    %rcx,%rax
+  803f8b:	48 29 d0             	sub    %rdx,%rax
+  803f8e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f93:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f97:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f9b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f9e:	49 83 c7 01          	add    $0x1,%r15
+  803fa2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803fa6:	75 83                	jne    803f2b <devpipe_read+0x4c>
+    return n;
+  803fa8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fac:	eb 03                	jmp    803fb1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803fae:	4c 89 f8             	mov    %r15,%rax
+}
+  803fb1:	48 83 c4 18          	add    $0x18,%rsp
+  803fb5:	5b                   	pop    %rbx
+  803fb6:	41 5c                	pop    %r12
+  803fb8:	41 5d                	pop    %r13
+  803fba:	41 5e                	pop    %r14
+  803fbc:	41 5f                	pop    %r15
+  803fbe:	5d                   	pop    %rbp
+  803fbf:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc5:	eb ea                	jmp    803fb1 <devpipe_read+0xd2>
+
+0000000000803fc7 <pipe>:
+pipe(int pfd[2]) {
+  803fc7:	55                   	push   %rbp
+  803fc8:	48 89 e5             	mov    %rsp,%rbp
+  803fcb:	41 55                	push   %r13
+  803fcd:	41 54                	push   %r12
+  803fcf:	53                   	push   %rbx
+  803fd0:	48 83 ec 18          	sub    $0x18,%rsp
+  803fd4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fd7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fdb:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  803fe2:	00 00 00 
+  803fe5:	ff d0                	call   *%rax
+  803fe7:	89 c3                	mov    %eax,%ebx
+  803fe9:	85 c0                	test   %eax,%eax
+  803feb:	0f 88 a0 01 00 00    	js     804191 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ff1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ff6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ffb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fff:	bf 00 00 00 00       	mov    $0x0,%edi
+  804004:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  80400b:	00 00 00 
+  80400e:	ff d0                	call   *%rax
+  804010:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804012:	85 c0                	test   %eax,%eax
+  804014:	0f 88 77 01 00 00    	js     804191 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80401a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80401e:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  804025:	00 00 00 
+  804028:	ff d0                	call   *%rax
+  80402a:	89 c3                	mov    %eax,%ebx
+  80402c:	85 c0                	test   %eax,%eax
+  80402e:	0f 88 43 01 00 00    	js     804177 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804034:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804039:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80403e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804042:	bf 00 00 00 00       	mov    $0x0,%edi
+  804047:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  80404e:	00 00 00 
+  804051:	ff d0                	call   *%rax
+  804053:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804055:	85 c0                	test   %eax,%eax
+  804057:	0f 88 1a 01 00 00    	js     804177 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80405d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804061:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  804068:	00 00 00 
+  80406b:	ff d0                	call   *%rax
+  80406d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804070:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804075:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80407a:	48 89 c6             	mov    %rax,%rsi
+  80407d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804082:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  804089:	00 00 00 
+  80408c:	ff d0                	call   *%rax
+  80408e:	89 c3                	mov    %eax,%ebx
+  804090:	85 c0                	test   %eax,%eax
+  804092:	0f 88 c5 00 00 00    	js     80415d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804098:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80409c:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  8040a3:	00 00 00 
+  8040a6:	ff d0                	call   *%rax
+  8040a8:	48 89 c1             	mov    %rax,%rcx
+  8040ab:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040b1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040bc:	4c 89 ee             	mov    %r13,%rsi
+  8040bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c4:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  8040cb:	00 00 00 
+  8040ce:	ff d0                	call   *%rax
+  8040d0:	89 c3                	mov    %eax,%ebx
+  8040d2:	85 c0                	test   %eax,%eax
+  8040d4:	78 6e                	js     804144 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040db:	4c 89 ef             	mov    %r13,%rdi
+  8040de:	48 b8 e4 26 80 00 00 	movabs $0x8026e4,%rax
+  8040e5:	00 00 00 
+  8040e8:	ff d0                	call   *%rax
+  8040ea:	83 f8 02             	cmp    $0x2,%eax
+  8040ed:	0f 85 ab 00 00 00    	jne    80419e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040f3:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040fa:	00 00 
+  8040fc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804100:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804102:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804106:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80410d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804111:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804113:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804117:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80411e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804122:	48 bb ac 2d 80 00 00 	movabs $0x802dac,%rbx
+  804129:	00 00 00 
+  80412c:	ff d3                	call   *%rbx
+  80412e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804132:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804136:	ff d3                	call   *%rbx
+  804138:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80413d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804142:	eb 4d                	jmp    804191 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804144:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804149:	4c 89 ee             	mov    %r13,%rsi
+  80414c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804151:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  804158:	00 00 00 
+  80415b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80415d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804162:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804166:	bf 00 00 00 00       	mov    $0x0,%edi
+  80416b:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  804172:	00 00 00 
+  804175:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804177:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80417c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804180:	bf 00 00 00 00       	mov    $0x0,%edi
+  804185:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  80418c:	00 00 00 
+  80418f:	ff d0                	call   *%rax
+}
+  804191:	89 d8                	mov    %ebx,%eax
+  804193:	48 83 c4 18          	add    $0x18,%rsp
+  804197:	5b                   	pop    %rbx
+  804198:	41 5c                	pop    %r12
+  80419a:	41 5d                	pop    %r13
+  80419c:	5d                   	pop    %rbp
+  80419d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80419e:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  8041a5:	00 00 00 
+  8041a8:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8041af:	00 00 00 
+  8041b2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041b7:	48 bf 97 62 80 00 00 	movabs $0x806297,%rdi
+  8041be:	00 00 00 
+  8041c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c6:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  8041cd:	00 00 00 
+  8041d0:	41 ff d0             	call   *%r8
+
+00000000008041d3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041d3:	55                   	push   %rbp
+  8041d4:	48 89 e5             	mov    %rsp,%rbp
+  8041d7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041df:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  8041e6:	00 00 00 
+  8041e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041eb:	85 c0                	test   %eax,%eax
+  8041ed:	78 35                	js     804224 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041f3:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  8041fa:	00 00 00 
+  8041fd:	ff d0                	call   *%rax
+  8041ff:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804202:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804207:	be 00 10 00 00       	mov    $0x1000,%esi
+  80420c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804210:	48 b8 1c 27 80 00 00 	movabs $0x80271c,%rax
+  804217:	00 00 00 
+  80421a:	ff d0                	call   *%rax
+  80421c:	85 c0                	test   %eax,%eax
+  80421e:	0f 94 c0             	sete   %al
+  804221:	0f b6 c0             	movzbl %al,%eax
+}
+  804224:	c9                   	leave
+  804225:	c3                   	ret
+
+0000000000804226 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804226:	48 89 f8             	mov    %rdi,%rax
+  804229:	48 c1 e8 27          	shr    $0x27,%rax
+  80422d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804234:	01 00 00 
+  804237:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80423b:	f6 c2 01             	test   $0x1,%dl
+  80423e:	74 6d                	je     8042ad <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804240:	48 89 f8             	mov    %rdi,%rax
+  804243:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804247:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80424e:	01 00 00 
+  804251:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804255:	f6 c2 01             	test   $0x1,%dl
+  804258:	74 62                	je     8042bc <get_uvpt_entry+0x96>
+  80425a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804261:	01 00 00 
+  804264:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804268:	f6 c2 80             	test   $0x80,%dl
+  80426b:	75 4f                	jne    8042bc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80426d:	48 89 f8             	mov    %rdi,%rax
+  804270:	48 c1 e8 15          	shr    $0x15,%rax
+  804274:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80427b:	01 00 00 
+  80427e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804282:	f6 c2 01             	test   $0x1,%dl
+  804285:	74 44                	je     8042cb <get_uvpt_entry+0xa5>
+  804287:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80428e:	01 00 00 
+  804291:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804295:	f6 c2 80             	test   $0x80,%dl
+  804298:	75 31                	jne    8042cb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80429a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80429e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8042a5:	01 00 00 
+  8042a8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8042ac:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042ad:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042b4:	01 00 00 
+  8042b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042bb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042bc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042c3:	01 00 00 
+  8042c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ca:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042cb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042d2:	01 00 00 
+  8042d5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042d9:	c3                   	ret
+
+00000000008042da <get_prot>:
+
+int
+get_prot(void *va) {
+  8042da:	55                   	push   %rbp
+  8042db:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042de:	48 b8 26 42 80 00 00 	movabs $0x804226,%rax
+  8042e5:	00 00 00 
+  8042e8:	ff d0                	call   *%rax
+  8042ea:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042ed:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042f2:	89 c1                	mov    %eax,%ecx
+  8042f4:	83 c9 04             	or     $0x4,%ecx
+  8042f7:	f6 c2 01             	test   $0x1,%dl
+  8042fa:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042fd:	89 c1                	mov    %eax,%ecx
+  8042ff:	83 c9 02             	or     $0x2,%ecx
+  804302:	f6 c2 02             	test   $0x2,%dl
+  804305:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804308:	89 c1                	mov    %eax,%ecx
+  80430a:	83 c9 01             	or     $0x1,%ecx
+  80430d:	48 85 d2             	test   %rdx,%rdx
+  804310:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804313:	89 c1                	mov    %eax,%ecx
+  804315:	83 c9 40             	or     $0x40,%ecx
+  804318:	f6 c6 04             	test   $0x4,%dh
+  80431b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80431e:	5d                   	pop    %rbp
+  80431f:	c3                   	ret
+
+0000000000804320 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804320:	55                   	push   %rbp
+  804321:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804324:	48 b8 26 42 80 00 00 	movabs $0x804226,%rax
+  80432b:	00 00 00 
+  80432e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804330:	48 c1 e8 06          	shr    $0x6,%rax
+  804334:	83 e0 01             	and    $0x1,%eax
+}
+  804337:	5d                   	pop    %rbp
+  804338:	c3                   	ret
+
+0000000000804339 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804339:	55                   	push   %rbp
+  80433a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80433d:	48 b8 26 42 80 00 00 	movabs $0x804226,%rax
+  804344:	00 00 00 
+  804347:	ff d0                	call   *%rax
+  804349:	83 e0 01             	and    $0x1,%eax
+}
+  80434c:	5d                   	pop    %rbp
+  80434d:	c3                   	ret
+
+000000000080434e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80434e:	55                   	push   %rbp
+  80434f:	48 89 e5             	mov    %rsp,%rbp
+  804352:	41 57                	push   %r15
+  804354:	41 56                	push   %r14
+  804356:	41 55                	push   %r13
+  804358:	41 54                	push   %r12
+  80435a:	53                   	push   %rbx
+  80435b:	48 83 ec 28          	sub    $0x28,%rsp
+  80435f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804363:	48 85 ff             	test   %rdi,%rdi
+  804366:	74 1e                	je     804386 <foreach_shared_region+0x38>
+  804368:	49 89 ff             	mov    %rdi,%r15
+  80436b:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804371:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804377:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80437e:	01 00 00 
+  804381:	e9 72 02 00 00       	jmp    8045f8 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804386:	48 b9 cc 62 80 00 00 	movabs $0x8062cc,%rcx
+  80438d:	00 00 00 
+  804390:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804397:	00 00 00 
+  80439a:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80439f:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  8043a6:	00 00 00 
+  8043a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ae:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  8043b5:	00 00 00 
+  8043b8:	41 ff d0             	call   *%r8
+  8043bb:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043c2:	eb 6c                	jmp    804430 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043c4:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043cb:	ff ff ff 
+  8043ce:	4c 21 e2             	and    %r12,%rdx
+  8043d1:	48 89 d8             	mov    %rbx,%rax
+  8043d4:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043d9:	48 83 c0 01          	add    $0x1,%rax
+  8043dd:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043e1:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043e8:	00 00 00 
+  8043eb:	48 21 c8             	and    %rcx,%rax
+  8043ee:	48 09 d0             	or     %rdx,%rax
+  8043f1:	49 89 c4             	mov    %rax,%r12
+  8043f4:	eb 30                	jmp    804426 <foreach_shared_region+0xd8>
+  8043f6:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043fd:	ff ff ff 
+  804400:	4c 21 e2             	and    %r12,%rdx
+  804403:	48 89 d8             	mov    %rbx,%rax
+  804406:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80440b:	48 83 c0 01          	add    $0x1,%rax
+  80440f:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804413:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80441a:	00 00 00 
+  80441d:	48 21 c8             	and    %rcx,%rax
+  804420:	48 09 d0             	or     %rdx,%rax
+  804423:	49 89 c4             	mov    %rax,%r12
+  804426:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80442a:	0f 84 99 01 00 00    	je     8045c9 <foreach_shared_region+0x27b>
+  804430:	4c 89 e3             	mov    %r12,%rbx
+  804433:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804437:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80443e:	01 00 00 
+  804441:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804445:	a8 01                	test   $0x1,%al
+  804447:	0f 84 77 ff ff ff    	je     8043c4 <foreach_shared_region+0x76>
+  80444d:	a8 80                	test   $0x80,%al
+  80444f:	74 19                	je     80446a <foreach_shared_region+0x11c>
+  804451:	f6 c4 04             	test   $0x4,%ah
+  804454:	74 a0                	je     8043f6 <foreach_shared_region+0xa8>
+  804456:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80445d:	40 
+  80445e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804462:	4c 89 e7             	mov    %r12,%rdi
+  804465:	41 ff d7             	call   *%r15
+  804468:	eb 8c                	jmp    8043f6 <foreach_shared_region+0xa8>
+  80446a:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804471:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804475:	eb 46                	jmp    8044bd <foreach_shared_region+0x16f>
+  804477:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80447e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804484:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804488:	48 c1 e0 15          	shl    $0x15,%rax
+  80448c:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804491:	49 09 c4             	or     %rax,%r12
+  804494:	eb 1d                	jmp    8044b3 <foreach_shared_region+0x165>
+  804496:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80449d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044a3:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8044a7:	48 c1 e0 15          	shl    $0x15,%rax
+  8044ab:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044b0:	49 09 c4             	or     %rax,%r12
+  8044b3:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044b7:	0f 84 d3 00 00 00    	je     804590 <foreach_shared_region+0x242>
+  8044bd:	4c 89 e3             	mov    %r12,%rbx
+  8044c0:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044c4:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044cb:	01 00 00 
+  8044ce:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044d2:	a8 01                	test   $0x1,%al
+  8044d4:	74 a1                	je     804477 <foreach_shared_region+0x129>
+  8044d6:	a8 80                	test   $0x80,%al
+  8044d8:	74 19                	je     8044f3 <foreach_shared_region+0x1a5>
+  8044da:	f6 c4 04             	test   $0x4,%ah
+  8044dd:	74 b7                	je     804496 <foreach_shared_region+0x148>
+  8044df:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044e6:	00 
+  8044e7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044eb:	4c 89 e7             	mov    %r12,%rdi
+  8044ee:	41 ff d7             	call   *%r15
+  8044f1:	eb a3                	jmp    804496 <foreach_shared_region+0x148>
+  8044f3:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044f9:	eb 3b                	jmp    804536 <foreach_shared_region+0x1e8>
+  8044fb:	f6 c4 04             	test   $0x4,%ah
+  8044fe:	74 12                	je     804512 <foreach_shared_region+0x1c4>
+  804500:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804507:	00 
+  804508:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80450c:	4c 89 e7             	mov    %r12,%rdi
+  80450f:	41 ff d7             	call   *%r15
+  804512:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804519:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80451f:	48 83 c3 01          	add    $0x1,%rbx
+  804523:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804527:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80452d:	49 09 dc             	or     %rbx,%r12
+  804530:	41 83 ed 01          	sub    $0x1,%r13d
+  804534:	74 2f                	je     804565 <foreach_shared_region+0x217>
+  804536:	4c 89 e3             	mov    %r12,%rbx
+  804539:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80453d:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804541:	a8 01                	test   $0x1,%al
+  804543:	75 b6                	jne    8044fb <foreach_shared_region+0x1ad>
+  804545:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80454c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804552:	48 83 c3 01          	add    $0x1,%rbx
+  804556:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80455a:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804560:	49 09 dc             	or     %rbx,%r12
+  804563:	eb cb                	jmp    804530 <foreach_shared_region+0x1e2>
+  804565:	4c 89 e0             	mov    %r12,%rax
+  804568:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80456e:	49 c1 ec 15          	shr    $0x15,%r12
+  804572:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804579:	49 83 c4 01          	add    $0x1,%r12
+  80457d:	49 c1 e4 15          	shl    $0x15,%r12
+  804581:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804588:	49 09 c4             	or     %rax,%r12
+  80458b:	e9 23 ff ff ff       	jmp    8044b3 <foreach_shared_region+0x165>
+  804590:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804594:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80459b:	ff ff ff 
+  80459e:	4c 21 e0             	and    %r12,%rax
+  8045a1:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8045a5:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8045ac:	49 83 c4 01          	add    $0x1,%r12
+  8045b0:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045b4:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045bb:	00 00 00 
+  8045be:	49 21 d4             	and    %rdx,%r12
+  8045c1:	49 09 c4             	or     %rax,%r12
+  8045c4:	e9 5d fe ff ff       	jmp    804426 <foreach_shared_region+0xd8>
+  8045c9:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045d0:	00 ff ff 
+  8045d3:	4c 21 e0             	and    %r12,%rax
+  8045d6:	49 c1 ec 27          	shr    $0x27,%r12
+  8045da:	49 83 c4 01          	add    $0x1,%r12
+  8045de:	49 c1 e4 27          	shl    $0x27,%r12
+  8045e2:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045e9:	ff 00 00 
+  8045ec:	49 21 d4             	and    %rdx,%r12
+  8045ef:	49 09 c4             	or     %rax,%r12
+  8045f2:	41 83 ed 01          	sub    $0x1,%r13d
+  8045f6:	74 48                	je     804640 <foreach_shared_region+0x2f2>
+  8045f8:	4c 89 e0             	mov    %r12,%rax
+  8045fb:	48 c1 e8 27          	shr    $0x27,%rax
+  8045ff:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804606:	01 00 00 
+  804609:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  80460d:	f6 c2 01             	test   $0x1,%dl
+  804610:	0f 85 a5 fd ff ff    	jne    8043bb <foreach_shared_region+0x6d>
+  804616:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  80461d:	00 ff ff 
+  804620:	4c 21 e2             	and    %r12,%rdx
+  804623:	48 83 c0 01          	add    $0x1,%rax
+  804627:	48 c1 e0 27          	shl    $0x27,%rax
+  80462b:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804632:	ff 00 00 
+  804635:	48 21 c8             	and    %rcx,%rax
+  804638:	48 09 d0             	or     %rdx,%rax
+  80463b:	49 89 c4             	mov    %rax,%r12
+  80463e:	eb b2                	jmp    8045f2 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804640:	4d 85 e4             	test   %r12,%r12
+  804643:	75 14                	jne    804659 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464a:	48 83 c4 28          	add    $0x28,%rsp
+  80464e:	5b                   	pop    %rbx
+  80464f:	41 5c                	pop    %r12
+  804651:	41 5d                	pop    %r13
+  804653:	41 5e                	pop    %r14
+  804655:	41 5f                	pop    %r15
+  804657:	5d                   	pop    %rbp
+  804658:	c3                   	ret
+    assert(addr == 0);
+  804659:	48 b9 db 62 80 00 00 	movabs $0x8062db,%rcx
+  804660:	00 00 00 
+  804663:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80466a:	00 00 00 
+  80466d:	be 67 00 00 00       	mov    $0x67,%esi
+  804672:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  804679:	00 00 00 
+  80467c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804681:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  804688:	00 00 00 
+  80468b:	41 ff d0             	call   *%r8
+
+000000000080468e <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80468e:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804695:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804698:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80469e:	eb 33                	jmp    8046d3 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046a0:	48 83 c0 20          	add    $0x20,%rax
+  8046a4:	4c 39 c0             	cmp    %r8,%rax
+  8046a7:	74 25                	je     8046ce <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8046a9:	48 8b 10             	mov    (%rax),%rdx
+  8046ac:	48 85 d2             	test   %rdx,%rdx
+  8046af:	74 ef                	je     8046a0 <mmap_place+0x12>
+  8046b1:	48 89 d1             	mov    %rdx,%rcx
+  8046b4:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046b8:	48 39 cf             	cmp    %rcx,%rdi
+  8046bb:	73 e3                	jae    8046a0 <mmap_place+0x12>
+  8046bd:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046c1:	4c 39 ca             	cmp    %r9,%rdx
+  8046c4:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046c8:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046cc:	eb d2                	jmp    8046a0 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046ce:	45 84 d2             	test   %r10b,%r10b
+  8046d1:	74 12                	je     8046e5 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046d3:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046da:	00 00 00 
+        moved = 0;
+  8046dd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046e3:	eb c4                	jmp    8046a9 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046e5:	48 01 fe             	add    %rdi,%rsi
+  8046e8:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046ef:	00 00 00 
+  8046f2:	48 39 f0             	cmp    %rsi,%rax
+  8046f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fa:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046fe:	c3                   	ret
+
+00000000008046ff <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046ff:	55                   	push   %rbp
+  804700:	48 89 e5             	mov    %rsp,%rbp
+  804703:	41 57                	push   %r15
+  804705:	41 56                	push   %r14
+  804707:	41 55                	push   %r13
+  804709:	41 54                	push   %r12
+  80470b:	53                   	push   %rbx
+  80470c:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804710:	48 8b 1f             	mov    (%rdi),%rbx
+  804713:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80471a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804721:	00 00 00 
+  804724:	ba 00 00 00 00       	mov    $0x0,%edx
+  804729:	eb 12                	jmp    80473d <mmap_pgfault+0x3e>
+  80472b:	48 83 c2 01          	add    $0x1,%rdx
+  80472f:	48 83 c0 20          	add    $0x20,%rax
+  804733:	48 83 fa 20          	cmp    $0x20,%rdx
+  804737:	0f 84 04 01 00 00    	je     804841 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80473d:	48 8b 08             	mov    (%rax),%rcx
+  804740:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804744:	48 39 de             	cmp    %rbx,%rsi
+  804747:	73 e2                	jae    80472b <mmap_pgfault+0x2c>
+  804749:	48 03 48 08          	add    0x8(%rax),%rcx
+  80474d:	48 39 cb             	cmp    %rcx,%rbx
+  804750:	73 d9                	jae    80472b <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804752:	48 c1 e2 05          	shl    $0x5,%rdx
+  804756:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80475d:	00 00 00 
+  804760:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804764:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804768:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80476c:	f6 c2 01             	test   $0x1,%dl
+  80476f:	0f 84 e0 00 00 00    	je     804855 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80477a:	f6 c2 02             	test   $0x2,%dl
+  80477d:	0f 84 c3 00 00 00    	je     804846 <mmap_pgfault+0x147>
+  804783:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80478a:	ff ff ff 
+  80478d:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804791:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804798:	00 00 00 
+  80479b:	48 39 ca             	cmp    %rcx,%rdx
+  80479e:	0f 85 a2 00 00 00    	jne    804846 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8047a4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8047a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ae:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047b5:	00 00 00 
+  8047b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047bd:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  8047c4:	00 00 00 
+  8047c7:	ff d0                	call   *%rax
+  8047c9:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047d0:	85 d2                	test   %edx,%edx
+  8047d2:	78 72                	js     804846 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047d9:	48 89 de             	mov    %rbx,%rsi
+  8047dc:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047e3:	00 00 00 
+  8047e6:	4c 89 e7             	mov    %r12,%rdi
+  8047e9:	48 b8 a0 23 80 00 00 	movabs $0x8023a0,%rax
+  8047f0:	00 00 00 
+  8047f3:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047f5:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047fb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804801:	48 89 d9             	mov    %rbx,%rcx
+  804804:	ba 00 00 00 00       	mov    $0x0,%edx
+  804809:	4c 89 e6             	mov    %r12,%rsi
+  80480c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804811:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  804818:	00 00 00 
+  80481b:	ff d0                	call   *%rax
+  80481d:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  80481f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804824:	4c 89 e6             	mov    %r12,%rsi
+  804827:	bf 00 00 00 00       	mov    $0x0,%edi
+  80482c:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  804833:	00 00 00 
+  804836:	ff d0                	call   *%rax
+    return res >= 0;
+  804838:	89 d8                	mov    %ebx,%eax
+  80483a:	f7 d0                	not    %eax
+  80483c:	c1 e8 1f             	shr    $0x1f,%eax
+  80483f:	eb 05                	jmp    804846 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804841:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804846:	48 83 c4 18          	add    $0x18,%rsp
+  80484a:	5b                   	pop    %rbx
+  80484b:	41 5c                	pop    %r12
+  80484d:	41 5d                	pop    %r13
+  80484f:	41 5e                	pop    %r14
+  804851:	41 5f                	pop    %r15
+  804853:	5d                   	pop    %rbp
+  804854:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804855:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804859:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  80485d:	4c 03 30             	add    (%rax),%r14
+  804860:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804867:	49 39 c6             	cmp    %rax,%r14
+  80486a:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80486e:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804875:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80487b:	49 bf 39 43 80 00 00 	movabs $0x804339,%r15
+  804882:	00 00 00 
+  804885:	4d 39 f4             	cmp    %r14,%r12
+  804888:	73 1d                	jae    8048a7 <mmap_pgfault+0x1a8>
+  80488a:	4c 89 e7             	mov    %r12,%rdi
+  80488d:	41 ff d7             	call   *%r15
+  804890:	84 c0                	test   %al,%al
+  804892:	75 13                	jne    8048a7 <mmap_pgfault+0x1a8>
+  804894:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80489b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8048a2:	4d 39 f4             	cmp    %r14,%r12
+  8048a5:	72 e3                	jb     80488a <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048a7:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8048ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048b1:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048b5:	74 2a                	je     8048e1 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048bb:	89 de                	mov    %ebx,%esi
+  8048bd:	2b 30                	sub    (%rax),%esi
+  8048bf:	03 70 1c             	add    0x1c(%rax),%esi
+  8048c2:	8b 78 18             	mov    0x18(%rax),%edi
+  8048c5:	4c 89 e9             	mov    %r13,%rcx
+  8048c8:	48 89 da             	mov    %rbx,%rdx
+  8048cb:	48 b8 97 3a 80 00 00 	movabs $0x803a97,%rax
+  8048d2:	00 00 00 
+  8048d5:	ff d0                	call   *%rax
+    return res > 0;
+  8048d7:	85 c0                	test   %eax,%eax
+  8048d9:	0f 9f c0             	setg   %al
+  8048dc:	e9 65 ff ff ff       	jmp    804846 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048e1:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048e5:	eb d0                	jmp    8048b7 <mmap_pgfault+0x1b8>
+
+00000000008048e7 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048e7:	55                   	push   %rbp
+  8048e8:	48 89 e5             	mov    %rsp,%rbp
+  8048eb:	41 57                	push   %r15
+  8048ed:	41 56                	push   %r14
+  8048ef:	41 55                	push   %r13
+  8048f1:	41 54                	push   %r12
+  8048f3:	53                   	push   %rbx
+  8048f4:	48 83 ec 28          	sub    $0x28,%rsp
+  8048f8:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048fc:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048ff:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804906:	ff ff ff 
+  804909:	48 23 57 10          	and    0x10(%rdi),%rdx
+  80490d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804912:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804919:	00 00 00 
+  80491c:	48 39 ca             	cmp    %rcx,%rdx
+  80491f:	0f 85 e5 00 00 00    	jne    804a0a <mmap_writeback+0x123>
+  804925:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804928:	4c 39 ee             	cmp    %r13,%rsi
+  80492b:	0f 83 e8 00 00 00    	jae    804a19 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804931:	49 be 39 43 80 00 00 	movabs $0x804339,%r14
+  804938:	00 00 00 
+  80493b:	49 bf 20 43 80 00 00 	movabs $0x804320,%r15
+  804942:	00 00 00 
+  804945:	eb 10                	jmp    804957 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804947:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80494e:	4d 39 ec             	cmp    %r13,%r12
+  804951:	0f 83 ae 00 00 00    	jae    804a05 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804957:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80495b:	4c 89 e7             	mov    %r12,%rdi
+  80495e:	41 ff d6             	call   *%r14
+  804961:	84 c0                	test   %al,%al
+  804963:	74 e2                	je     804947 <mmap_writeback+0x60>
+  804965:	4c 89 e7             	mov    %r12,%rdi
+  804968:	41 ff d7             	call   *%r15
+  80496b:	84 c0                	test   %al,%al
+  80496d:	74 d8                	je     804947 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80496f:	4c 89 e3             	mov    %r12,%rbx
+  804972:	4d 39 ec             	cmp    %r13,%r12
+  804975:	73 20                	jae    804997 <mmap_writeback+0xb0>
+  804977:	48 89 df             	mov    %rbx,%rdi
+  80497a:	41 ff d6             	call   *%r14
+  80497d:	84 c0                	test   %al,%al
+  80497f:	74 16                	je     804997 <mmap_writeback+0xb0>
+  804981:	48 89 df             	mov    %rbx,%rdi
+  804984:	41 ff d7             	call   *%r15
+  804987:	84 c0                	test   %al,%al
+  804989:	74 0c                	je     804997 <mmap_writeback+0xb0>
+  80498b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804992:	4c 39 eb             	cmp    %r13,%rbx
+  804995:	72 e0                	jb     804977 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804997:	48 89 d9             	mov    %rbx,%rcx
+  80499a:	4c 29 e1             	sub    %r12,%rcx
+  80499d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8049a1:	44 89 e6             	mov    %r12d,%esi
+  8049a4:	2b 30                	sub    (%rax),%esi
+  8049a6:	49 89 c4             	mov    %rax,%r12
+  8049a9:	03 70 1c             	add    0x1c(%rax),%esi
+  8049ac:	8b 78 18             	mov    0x18(%rax),%edi
+  8049af:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049b3:	48 89 ca             	mov    %rcx,%rdx
+  8049b6:	48 b8 20 3b 80 00 00 	movabs $0x803b20,%rax
+  8049bd:	00 00 00 
+  8049c0:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049c2:	85 c0                	test   %eax,%eax
+  8049c4:	78 44                	js     804a0a <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049c6:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049cb:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049ce:	41 89 c1             	mov    %eax,%r9d
+  8049d1:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049d8:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049dc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049e5:	48 89 ce             	mov    %rcx,%rsi
+  8049e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ed:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  8049f4:	00 00 00 
+  8049f7:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049f9:	85 c0                	test   %eax,%eax
+  8049fb:	78 0d                	js     804a0a <mmap_writeback+0x123>
+  8049fd:	49 89 dc             	mov    %rbx,%r12
+  804a00:	e9 49 ff ff ff       	jmp    80494e <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804a05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a0a:	48 83 c4 28          	add    $0x28,%rsp
+  804a0e:	5b                   	pop    %rbx
+  804a0f:	41 5c                	pop    %r12
+  804a11:	41 5d                	pop    %r13
+  804a13:	41 5e                	pop    %r14
+  804a15:	41 5f                	pop    %r15
+  804a17:	5d                   	pop    %rbp
+  804a18:	c3                   	ret
+    return 0;
+  804a19:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a1e:	eb ea                	jmp    804a0a <mmap_writeback+0x123>
+
+0000000000804a20 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a20:	55                   	push   %rbp
+  804a21:	48 89 e5             	mov    %rsp,%rbp
+  804a24:	41 57                	push   %r15
+  804a26:	41 56                	push   %r14
+  804a28:	41 55                	push   %r13
+  804a2a:	41 54                	push   %r12
+  804a2c:	53                   	push   %rbx
+  804a2d:	48 83 ec 38          	sub    $0x38,%rsp
+  804a31:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a35:	48 85 f6             	test   %rsi,%rsi
+  804a38:	0f 84 0c 02 00 00    	je     804c4a <mmap+0x22a>
+  804a3e:	49 89 ff             	mov    %rdi,%r15
+  804a41:	49 89 f4             	mov    %rsi,%r12
+  804a44:	41 89 d5             	mov    %edx,%r13d
+  804a47:	41 89 ce             	mov    %ecx,%r14d
+  804a4a:	44 89 cb             	mov    %r9d,%ebx
+  804a4d:	45 85 c9             	test   %r9d,%r9d
+  804a50:	0f 88 f4 01 00 00    	js     804c4a <mmap+0x22a>
+  804a56:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a5d:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a64:	0f 85 e7 01 00 00    	jne    804c51 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a6a:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a6d:	83 fa 04             	cmp    $0x4,%edx
+  804a70:	0f 85 db 01 00 00    	jne    804c51 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a76:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a79:	83 fa 01             	cmp    $0x1,%edx
+  804a7c:	0f 87 cf 01 00 00    	ja     804c51 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a82:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a86:	44 89 c7             	mov    %r8d,%edi
+  804a89:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  804a90:	00 00 00 
+  804a93:	ff d0                	call   *%rax
+  804a95:	89 c2                	mov    %eax,%edx
+  804a97:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a9e:	85 d2                	test   %edx,%edx
+  804aa0:	0f 88 ab 01 00 00    	js     804c51 <mmap+0x231>
+  804aa6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804aaa:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804ab1:	00 00 00 
+  804ab4:	8b 09                	mov    (%rcx),%ecx
+  804ab6:	39 0a                	cmp    %ecx,(%rdx)
+  804ab8:	0f 85 93 01 00 00    	jne    804c51 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804abe:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ac1:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ac4:	83 fa 01             	cmp    $0x1,%edx
+  804ac7:	0f 84 84 01 00 00    	je     804c51 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804acd:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ad1:	74 42                	je     804b15 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ad3:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804ada:	4c 89 e6             	mov    %r12,%rsi
+  804add:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ae4:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ae8:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804aec:	4d 85 ff             	test   %r15,%r15
+  804aef:	74 67                	je     804b58 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804af1:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804af8:	75 0f                	jne    804b09 <mmap+0xe9>
+  804afa:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804b01:	00 00 00 
+  804b04:	49 39 c7             	cmp    %rax,%r15
+  804b07:	77 1b                	ja     804b24 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b09:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b10:	e9 3c 01 00 00       	jmp    804c51 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b15:	41 f6 c5 02          	test   $0x2,%r13b
+  804b19:	74 b8                	je     804ad3 <mmap+0xb3>
+  804b1b:	85 d2                	test   %edx,%edx
+  804b1d:	75 b4                	jne    804ad3 <mmap+0xb3>
+  804b1f:	e9 2d 01 00 00       	jmp    804c51 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b24:	4c 89 ff             	mov    %r15,%rdi
+  804b27:	48 b8 8e 46 80 00 00 	movabs $0x80468e,%rax
+  804b2e:	00 00 00 
+  804b31:	ff d0                	call   *%rax
+  804b33:	48 89 c2             	mov    %rax,%rdx
+  804b36:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b3d:	49 39 d7             	cmp    %rdx,%r15
+  804b40:	0f 85 0b 01 00 00    	jne    804c51 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b46:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b4d:	00 00 00 
+  804b50:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b56:	eb 44                	jmp    804b9c <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b58:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b5c:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b63:	00 00 00 
+  804b66:	48 b8 8e 46 80 00 00 	movabs $0x80468e,%rax
+  804b6d:	00 00 00 
+  804b70:	ff d0                	call   *%rax
+  804b72:	48 89 c7             	mov    %rax,%rdi
+  804b75:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b79:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b80:	48 85 ff             	test   %rdi,%rdi
+  804b83:	75 c1                	jne    804b46 <mmap+0x126>
+  804b85:	e9 c7 00 00 00       	jmp    804c51 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b8a:	49 83 c4 01          	add    $0x1,%r12
+  804b8e:	48 83 c0 20          	add    $0x20,%rax
+  804b92:	49 83 fc 20          	cmp    $0x20,%r12
+  804b96:	0f 84 a5 00 00 00    	je     804c41 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b9c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804ba0:	75 e8                	jne    804b8a <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804ba2:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804ba6:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  804bad:	00 00 00 
+  804bb0:	ff d0                	call   *%rax
+  804bb2:	89 c2                	mov    %eax,%edx
+  804bb4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bbb:	85 d2                	test   %edx,%edx
+  804bbd:	0f 88 8e 00 00 00    	js     804c51 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bc3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bc7:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  804bce:	00 00 00 
+  804bd1:	ff d0                	call   *%rax
+  804bd3:	89 c6                	mov    %eax,%esi
+  804bd5:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bd8:	48 b8 fa 2f 80 00 00 	movabs $0x802ffa,%rax
+  804bdf:	00 00 00 
+  804be2:	ff d0                	call   *%rax
+  804be4:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804be7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bee:	45 85 ff             	test   %r15d,%r15d
+  804bf1:	78 5e                	js     804c51 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bf3:	49 c1 e4 05          	shl    $0x5,%r12
+  804bf7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bfe:	00 00 00 
+  804c01:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804c04:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  804c0b:	00 00 00 
+  804c0e:	48 b8 cd 51 80 00 00 	movabs $0x8051cd,%rax
+  804c15:	00 00 00 
+  804c18:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c1a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c1e:	49 89 04 24          	mov    %rax,(%r12)
+  804c22:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c26:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c2b:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c30:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c35:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c3a:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c3f:	eb 10                	jmp    804c51 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c41:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c48:	eb 07                	jmp    804c51 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c4a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c51:	48 83 c4 38          	add    $0x38,%rsp
+  804c55:	5b                   	pop    %rbx
+  804c56:	41 5c                	pop    %r12
+  804c58:	41 5d                	pop    %r13
+  804c5a:	41 5e                	pop    %r14
+  804c5c:	41 5f                	pop    %r15
+  804c5e:	5d                   	pop    %rbp
+  804c5f:	c3                   	ret
+
+0000000000804c60 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c60:	55                   	push   %rbp
+  804c61:	48 89 e5             	mov    %rsp,%rbp
+  804c64:	41 57                	push   %r15
+  804c66:	41 56                	push   %r14
+  804c68:	41 55                	push   %r13
+  804c6a:	41 54                	push   %r12
+  804c6c:	53                   	push   %rbx
+  804c6d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c71:	49 89 fe             	mov    %rdi,%r14
+  804c74:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c7b:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c82:	00 
+  804c83:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c8a:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c91:	00 00 00 
+  804c94:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c9b:	49 bf e7 48 80 00 00 	movabs $0x8048e7,%r15
+  804ca2:	00 00 00 
+  804ca5:	eb 09                	jmp    804cb0 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ca7:	48 83 c3 20          	add    $0x20,%rbx
+  804cab:	4c 39 eb             	cmp    %r13,%rbx
+  804cae:	74 33                	je     804ce3 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804cb0:	48 89 df             	mov    %rbx,%rdi
+  804cb3:	48 8b 33             	mov    (%rbx),%rsi
+  804cb6:	4c 39 e6             	cmp    %r12,%rsi
+  804cb9:	73 ec                	jae    804ca7 <msync+0x47>
+  804cbb:	48 85 f6             	test   %rsi,%rsi
+  804cbe:	74 e7                	je     804ca7 <msync+0x47>
+  804cc0:	48 89 f2             	mov    %rsi,%rdx
+  804cc3:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cc7:	49 39 d6             	cmp    %rdx,%r14
+  804cca:	73 db                	jae    804ca7 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ccc:	4c 39 e2             	cmp    %r12,%rdx
+  804ccf:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cd3:	4c 39 f6             	cmp    %r14,%rsi
+  804cd6:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cda:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cdd:	85 c0                	test   %eax,%eax
+  804cdf:	79 c6                	jns    804ca7 <msync+0x47>
+  804ce1:	eb 05                	jmp    804ce8 <msync+0x88>
+    }
+
+    return 0;
+  804ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ce8:	48 83 c4 08          	add    $0x8,%rsp
+  804cec:	5b                   	pop    %rbx
+  804ced:	41 5c                	pop    %r12
+  804cef:	41 5d                	pop    %r13
+  804cf1:	41 5e                	pop    %r14
+  804cf3:	41 5f                	pop    %r15
+  804cf5:	5d                   	pop    %rbp
+  804cf6:	c3                   	ret
+
+0000000000804cf7 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cf7:	55                   	push   %rbp
+  804cf8:	48 89 e5             	mov    %rsp,%rbp
+  804cfb:	41 57                	push   %r15
+  804cfd:	41 56                	push   %r14
+  804cff:	41 55                	push   %r13
+  804d01:	41 54                	push   %r12
+  804d03:	53                   	push   %rbx
+  804d04:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804d08:	49 89 ff             	mov    %rdi,%r15
+  804d0b:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d12:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d19:	00 
+  804d1a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d21:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d28:	00 00 00 
+  804d2b:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d32:	48 89 d8             	mov    %rbx,%rax
+  804d35:	eb 09                	jmp    804d40 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d37:	48 83 c0 20          	add    $0x20,%rax
+  804d3b:	4c 39 f0             	cmp    %r14,%rax
+  804d3e:	74 40                	je     804d80 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d40:	48 8b 10             	mov    (%rax),%rdx
+  804d43:	4c 39 e2             	cmp    %r12,%rdx
+  804d46:	73 ef                	jae    804d37 <munmap+0x40>
+  804d48:	48 85 d2             	test   %rdx,%rdx
+  804d4b:	74 ea                	je     804d37 <munmap+0x40>
+  804d4d:	48 89 d7             	mov    %rdx,%rdi
+  804d50:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d54:	49 39 ff             	cmp    %rdi,%r15
+  804d57:	73 de                	jae    804d37 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d59:	49 39 fc             	cmp    %rdi,%r12
+  804d5c:	72 05                	jb     804d63 <munmap+0x6c>
+  804d5e:	4c 39 fa             	cmp    %r15,%rdx
+  804d61:	73 d4                	jae    804d37 <munmap+0x40>
+  804d63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d68:	48 83 c4 08          	add    $0x8,%rsp
+  804d6c:	5b                   	pop    %rbx
+  804d6d:	41 5c                	pop    %r12
+  804d6f:	41 5d                	pop    %r13
+  804d71:	41 5e                	pop    %r14
+  804d73:	41 5f                	pop    %r15
+  804d75:	5d                   	pop    %rbp
+  804d76:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d77:	48 83 c3 20          	add    $0x20,%rbx
+  804d7b:	4c 39 f3             	cmp    %r14,%rbx
+  804d7e:	74 5c                	je     804ddc <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d80:	48 8b 33             	mov    (%rbx),%rsi
+  804d83:	4c 39 e6             	cmp    %r12,%rsi
+  804d86:	73 ef                	jae    804d77 <munmap+0x80>
+  804d88:	48 85 f6             	test   %rsi,%rsi
+  804d8b:	74 ea                	je     804d77 <munmap+0x80>
+  804d8d:	48 89 f2             	mov    %rsi,%rdx
+  804d90:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d94:	49 39 d7             	cmp    %rdx,%r15
+  804d97:	73 de                	jae    804d77 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d99:	48 89 df             	mov    %rbx,%rdi
+  804d9c:	48 b8 e7 48 80 00 00 	movabs $0x8048e7,%rax
+  804da3:	00 00 00 
+  804da6:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804da8:	85 c0                	test   %eax,%eax
+  804daa:	78 bc                	js     804d68 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804dac:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804db0:	48 8b 33             	mov    (%rbx),%rsi
+  804db3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804db8:	48 b8 26 28 80 00 00 	movabs $0x802826,%rax
+  804dbf:	00 00 00 
+  804dc2:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804dc4:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804dc7:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  804dce:	00 00 00 
+  804dd1:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dd3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dda:	eb 9b                	jmp    804d77 <munmap+0x80>
+    return 0;
+  804ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de1:	eb 85                	jmp    804d68 <munmap+0x71>
+
+0000000000804de3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de8:	c3                   	ret
+
+0000000000804de9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804de9:	55                   	push   %rbp
+  804dea:	48 89 e5             	mov    %rsp,%rbp
+  804ded:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804df0:	48 be e5 62 80 00 00 	movabs $0x8062e5,%rsi
+  804df7:	00 00 00 
+  804dfa:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  804e01:	00 00 00 
+  804e04:	ff d0                	call   *%rax
+    return 0;
+}
+  804e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e0b:	5d                   	pop    %rbp
+  804e0c:	c3                   	ret
+
+0000000000804e0d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e0d:	55                   	push   %rbp
+  804e0e:	48 89 e5             	mov    %rsp,%rbp
+  804e11:	41 57                	push   %r15
+  804e13:	41 56                	push   %r14
+  804e15:	41 55                	push   %r13
+  804e17:	41 54                	push   %r12
+  804e19:	53                   	push   %rbx
+  804e1a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e21:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e28:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e2f:	00 00 00 00 
+  804e33:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e3a:	00 00 00 00 
+  804e3e:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e45:	00 00 00 00 
+  804e49:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e50:	00 00 00 00 
+  804e54:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e5b:	00 00 00 00 
+  804e5f:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e66:	00 00 00 00 
+  804e6a:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e71:	00 
+  804e72:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e79:	00 
+  804e7a:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e81:	00 
+  804e82:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e89:	00 
+  804e8a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e91:	00 
+  804e92:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e99:	00 
+  804e9a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804ea1:	00 
+  804ea2:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804ea9:	00 
+  804eaa:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804eb1:	00 
+  804eb2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804eb9:	00 
+    for (res = 0; res < n; res += inc) {
+  804eba:	48 85 d2             	test   %rdx,%rdx
+  804ebd:	74 7a                	je     804f39 <devcons_write+0x12c>
+  804ebf:	49 89 d6             	mov    %rdx,%r14
+  804ec2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ec8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ecd:	49 bf 39 23 80 00 00 	movabs $0x802339,%r15
+  804ed4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ed7:	4c 89 f3             	mov    %r14,%rbx
+  804eda:	48 29 f3             	sub    %rsi,%rbx
+  804edd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ee2:	48 39 c3             	cmp    %rax,%rbx
+  804ee5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ee9:	4c 63 eb             	movslq %ebx,%r13
+  804eec:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ef3:	48 01 c6             	add    %rax,%rsi
+  804ef6:	4c 89 ea             	mov    %r13,%rdx
+  804ef9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f00:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804f03:	4c 89 ee             	mov    %r13,%rsi
+  804f06:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f0d:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  804f14:	00 00 00 
+  804f17:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f19:	41 01 dc             	add    %ebx,%r12d
+  804f1c:	49 63 f4             	movslq %r12d,%rsi
+  804f1f:	4c 39 f6             	cmp    %r14,%rsi
+  804f22:	72 b3                	jb     804ed7 <devcons_write+0xca>
+    return res;
+  804f24:	49 63 c4             	movslq %r12d,%rax
+}
+  804f27:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f2e:	5b                   	pop    %rbx
+  804f2f:	41 5c                	pop    %r12
+  804f31:	41 5d                	pop    %r13
+  804f33:	41 5e                	pop    %r14
+  804f35:	41 5f                	pop    %r15
+  804f37:	5d                   	pop    %rbp
+  804f38:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f39:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f3f:	eb e3                	jmp    804f24 <devcons_write+0x117>
+
+0000000000804f41 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f41:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f49:	48 85 c0             	test   %rax,%rax
+  804f4c:	74 55                	je     804fa3 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f4e:	55                   	push   %rbp
+  804f4f:	48 89 e5             	mov    %rsp,%rbp
+  804f52:	41 55                	push   %r13
+  804f54:	41 54                	push   %r12
+  804f56:	53                   	push   %rbx
+  804f57:	48 83 ec 08          	sub    $0x8,%rsp
+  804f5b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f5e:	48 bb 99 25 80 00 00 	movabs $0x802599,%rbx
+  804f65:	00 00 00 
+  804f68:	49 bc ad 26 80 00 00 	movabs $0x8026ad,%r12
+  804f6f:	00 00 00 
+  804f72:	eb 03                	jmp    804f77 <devcons_read+0x36>
+  804f74:	41 ff d4             	call   *%r12
+  804f77:	ff d3                	call   *%rbx
+  804f79:	85 c0                	test   %eax,%eax
+  804f7b:	74 f7                	je     804f74 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f7d:	48 63 d0             	movslq %eax,%rdx
+  804f80:	78 13                	js     804f95 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f82:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f87:	83 f8 04             	cmp    $0x4,%eax
+  804f8a:	74 09                	je     804f95 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f8c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f90:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f95:	48 89 d0             	mov    %rdx,%rax
+  804f98:	48 83 c4 08          	add    $0x8,%rsp
+  804f9c:	5b                   	pop    %rbx
+  804f9d:	41 5c                	pop    %r12
+  804f9f:	41 5d                	pop    %r13
+  804fa1:	5d                   	pop    %rbp
+  804fa2:	c3                   	ret
+  804fa3:	48 89 d0             	mov    %rdx,%rax
+  804fa6:	c3                   	ret
+
+0000000000804fa7 <cputchar>:
+cputchar(int ch) {
+  804fa7:	55                   	push   %rbp
+  804fa8:	48 89 e5             	mov    %rsp,%rbp
+  804fab:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804faf:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fb3:	be 01 00 00 00       	mov    $0x1,%esi
+  804fb8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fbc:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  804fc3:	00 00 00 
+  804fc6:	ff d0                	call   *%rax
+}
+  804fc8:	c9                   	leave
+  804fc9:	c3                   	ret
+
+0000000000804fca <getchar>:
+getchar(void) {
+  804fca:	55                   	push   %rbp
+  804fcb:	48 89 e5             	mov    %rsp,%rbp
+  804fce:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fd2:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fd7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fe0:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  804fe7:	00 00 00 
+  804fea:	ff d0                	call   *%rax
+  804fec:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fee:	85 c0                	test   %eax,%eax
+  804ff0:	78 06                	js     804ff8 <getchar+0x2e>
+  804ff2:	74 08                	je     804ffc <getchar+0x32>
+  804ff4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804ff8:	89 d0                	mov    %edx,%eax
+  804ffa:	c9                   	leave
+  804ffb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804ffc:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805001:	eb f5                	jmp    804ff8 <getchar+0x2e>
+
+0000000000805003 <iscons>:
+iscons(int fdnum) {
+  805003:	55                   	push   %rbp
+  805004:	48 89 e5             	mov    %rsp,%rbp
+  805007:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80500b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80500f:	48 b8 3a 2e 80 00 00 	movabs $0x802e3a,%rax
+  805016:	00 00 00 
+  805019:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80501b:	85 c0                	test   %eax,%eax
+  80501d:	78 18                	js     805037 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80501f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805023:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80502a:	00 00 00 
+  80502d:	8b 00                	mov    (%rax),%eax
+  80502f:	39 02                	cmp    %eax,(%rdx)
+  805031:	0f 94 c0             	sete   %al
+  805034:	0f b6 c0             	movzbl %al,%eax
+}
+  805037:	c9                   	leave
+  805038:	c3                   	ret
+
+0000000000805039 <opencons>:
+opencons(void) {
+  805039:	55                   	push   %rbp
+  80503a:	48 89 e5             	mov    %rsp,%rbp
+  80503d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805041:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805045:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  80504c:	00 00 00 
+  80504f:	ff d0                	call   *%rax
+  805051:	85 c0                	test   %eax,%eax
+  805053:	78 49                	js     80509e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805055:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80505a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80505f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805063:	bf 00 00 00 00       	mov    $0x0,%edi
+  805068:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  80506f:	00 00 00 
+  805072:	ff d0                	call   *%rax
+  805074:	85 c0                	test   %eax,%eax
+  805076:	78 26                	js     80509e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805078:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80507c:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805083:	00 00 
+  805085:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805087:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80508b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805092:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  805099:	00 00 00 
+  80509c:	ff d0                	call   *%rax
+}
+  80509e:	c9                   	leave
+  80509f:	c3                   	ret
+
+00000000008050a0 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8050a0:	55                   	push   %rbp
+  8050a1:	48 89 e5             	mov    %rsp,%rbp
+  8050a4:	41 56                	push   %r14
+  8050a6:	41 55                	push   %r13
+  8050a8:	41 54                	push   %r12
+  8050aa:	53                   	push   %rbx
+  8050ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8050af:	49 89 fc             	mov    %rdi,%r12
+  8050b2:	41 89 f5             	mov    %esi,%r13d
+  8050b5:	48 89 d3             	mov    %rdx,%rbx
+  8050b8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050bc:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050c0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050c4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050cf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050d3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050d7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050db:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050e2:	00 00 00 
+  8050e5:	4c 8b 30             	mov    (%rax),%r14
+  8050e8:	48 b8 76 26 80 00 00 	movabs $0x802676,%rax
+  8050ef:	00 00 00 
+  8050f2:	ff d0                	call   *%rax
+  8050f4:	89 c6                	mov    %eax,%esi
+  8050f6:	45 89 e8             	mov    %r13d,%r8d
+  8050f9:	4c 89 e1             	mov    %r12,%rcx
+  8050fc:	4c 89 f2             	mov    %r14,%rdx
+  8050ff:	48 bf f8 62 80 00 00 	movabs $0x8062f8,%rdi
+  805106:	00 00 00 
+  805109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80510e:	49 bc b2 16 80 00 00 	movabs $0x8016b2,%r12
+  805115:	00 00 00 
+  805118:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80511b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80511f:	48 89 df             	mov    %rbx,%rdi
+  805122:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  805129:	00 00 00 
+  80512c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80512e:	48 bf 24 5c 80 00 00 	movabs $0x805c24,%rdi
+  805135:	00 00 00 
+  805138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80513d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805140:	cc                   	int3
+  805141:	eb fd                	jmp    805140 <_panic+0xa0>
+
+0000000000805143 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805143:	55                   	push   %rbp
+  805144:	48 89 e5             	mov    %rsp,%rbp
+  805147:	41 56                	push   %r14
+  805149:	41 55                	push   %r13
+  80514b:	41 54                	push   %r12
+  80514d:	53                   	push   %rbx
+  80514e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805151:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805158:	00 00 00 
+  80515b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80515f:	74 27                	je     805188 <_handle_vectored_pagefault+0x45>
+  805161:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805166:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80516d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805170:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805173:	4c 89 e7             	mov    %r12,%rdi
+  805176:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80517b:	84 c0                	test   %al,%al
+  80517d:	75 45                	jne    8051c4 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80517f:	48 83 c3 01          	add    $0x1,%rbx
+  805183:	49 3b 1e             	cmp    (%r14),%rbx
+  805186:	72 eb                	jb     805173 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805188:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80518f:	00 
+  805190:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805195:	4d 8b 04 24          	mov    (%r12),%r8
+  805199:	48 ba 20 63 80 00 00 	movabs $0x806320,%rdx
+  8051a0:	00 00 00 
+  8051a3:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8051a8:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8051af:	00 00 00 
+  8051b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051b7:	49 ba a0 50 80 00 00 	movabs $0x8050a0,%r10
+  8051be:	00 00 00 
+  8051c1:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051c4:	5b                   	pop    %rbx
+  8051c5:	41 5c                	pop    %r12
+  8051c7:	41 5d                	pop    %r13
+  8051c9:	41 5e                	pop    %r14
+  8051cb:	5d                   	pop    %rbp
+  8051cc:	c3                   	ret
+
+00000000008051cd <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051cd:	55                   	push   %rbp
+  8051ce:	48 89 e5             	mov    %rsp,%rbp
+  8051d1:	53                   	push   %rbx
+  8051d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8051d6:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051d9:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051de:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051e5:	00 00 00 
+  8051e8:	80 38 00             	cmpb   $0x0,(%rax)
+  8051eb:	74 68                	je     805255 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051ed:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051f4:	00 00 00 
+  8051f7:	48 8b 08             	mov    (%rax),%rcx
+  8051fa:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051ff:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805206:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805209:	48 85 c9             	test   %rcx,%rcx
+  80520c:	0f 84 e0 00 00 00    	je     8052f2 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805212:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805216:	0f 84 c9 00 00 00    	je     8052e5 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80521c:	48 83 c2 01          	add    $0x1,%rdx
+  805220:	48 39 ca             	cmp    %rcx,%rdx
+  805223:	75 ed                	jne    805212 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805225:	48 83 f9 08          	cmp    $0x8,%rcx
+  805229:	0f 84 84 00 00 00    	je     8052b3 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80522f:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805233:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80523a:	00 00 00 
+  80523d:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805244:	00 00 00 
+  805247:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80524b:	85 f6                	test   %esi,%esi
+  80524d:	0f 89 97 00 00 00    	jns    8052ea <add_pgfault_handler+0x11d>
+  805253:	eb 63                	jmp    8052b8 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805255:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80525a:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80525f:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805266:	00 00 00 
+  805269:	bf 00 00 00 00       	mov    $0x0,%edi
+  80526e:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  805275:	00 00 00 
+  805278:	ff d0                	call   *%rax
+  80527a:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80527c:	85 c0                	test   %eax,%eax
+  80527e:	78 38                	js     8052b8 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805280:	48 be ce 53 80 00 00 	movabs $0x8053ce,%rsi
+  805287:	00 00 00 
+  80528a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80528f:	48 b8 71 29 80 00 00 	movabs $0x802971,%rax
+  805296:	00 00 00 
+  805299:	ff d0                	call   *%rax
+  80529b:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80529d:	85 c0                	test   %eax,%eax
+  80529f:	78 17                	js     8052b8 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8052a1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052a8:	00 00 00 
+  8052ab:	c6 00 01             	movb   $0x1,(%rax)
+  8052ae:	e9 3a ff ff ff       	jmp    8051ed <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052b3:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052b8:	89 f1                	mov    %esi,%ecx
+  8052ba:	48 ba 5e 63 80 00 00 	movabs $0x80635e,%rdx
+  8052c1:	00 00 00 
+  8052c4:	be 42 00 00 00       	mov    $0x42,%esi
+  8052c9:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8052d0:	00 00 00 
+  8052d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d8:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  8052df:	00 00 00 
+  8052e2:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052e5:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052ea:	89 f0                	mov    %esi,%eax
+  8052ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052f0:	c9                   	leave
+  8052f1:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052f2:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052f9:	00 00 00 
+  8052fc:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805303:	48 89 d8             	mov    %rbx,%rax
+  805306:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  80530d:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805310:	eb d8                	jmp    8052ea <add_pgfault_handler+0x11d>
+
+0000000000805312 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805312:	55                   	push   %rbp
+  805313:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805316:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80531d:	00 00 00 
+  805320:	80 38 00             	cmpb   $0x0,(%rax)
+  805323:	74 33                	je     805358 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805325:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80532c:	00 00 00 
+  80532f:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805334:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80533b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80533e:	48 85 c0             	test   %rax,%rax
+  805341:	0f 84 85 00 00 00    	je     8053cc <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805347:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80534b:	74 40                	je     80538d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80534d:	48 83 c1 01          	add    $0x1,%rcx
+  805351:	48 39 c1             	cmp    %rax,%rcx
+  805354:	75 f1                	jne    805347 <remove_pgfault_handler+0x35>
+  805356:	eb 74                	jmp    8053cc <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805358:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  80535f:	00 00 00 
+  805362:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  805369:	00 00 00 
+  80536c:	be 48 00 00 00       	mov    $0x48,%esi
+  805371:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  805378:	00 00 00 
+  80537b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805380:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  805387:	00 00 00 
+  80538a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80538d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805394:	00 
+  805395:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805399:	48 29 ca             	sub    %rcx,%rdx
+  80539c:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8053a3:	00 00 00 
+  8053a6:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8053aa:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053af:	48 89 ce             	mov    %rcx,%rsi
+  8053b2:	48 b8 39 23 80 00 00 	movabs $0x802339,%rax
+  8053b9:	00 00 00 
+  8053bc:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053be:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053c5:	00 00 00 
+  8053c8:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053cc:	5d                   	pop    %rbp
+  8053cd:	c3                   	ret
+
+00000000008053ce <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053ce:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053d1:	48 b8 43 51 80 00 00 	movabs $0x805143,%rax
+  8053d8:	00 00 00 
+    call *%rax
+  8053db:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053dd:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053e4:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053e5:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053ec:	00 
+    subq $8, %rcx
+  8053ed:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053f1:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053f4:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053fb:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053fc:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805400:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805404:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805409:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80540e:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805413:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805418:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80541d:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805422:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805427:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80542c:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805431:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805436:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80543b:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805440:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805445:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80544a:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80544e:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805452:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805453:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805454:	c3                   	ret
+
+0000000000805455 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805455:	85 ff                	test   %edi,%edi
+  805457:	78 58                	js     8054b1 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805459:	48 85 f6             	test   %rsi,%rsi
+  80545c:	74 12                	je     805470 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80545e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805465:	00 00 00 
+  805468:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80546e:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805470:	48 85 c9             	test   %rcx,%rcx
+  805473:	74 12                	je     805487 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805475:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80547c:	00 00 00 
+  80547f:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805485:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805487:	48 85 d2             	test   %rdx,%rdx
+  80548a:	74 14                	je     8054a0 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80548c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805493:	00 00 00 
+  805496:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80549d:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8054a0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054a7:	00 00 00 
+  8054aa:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054b0:	c3                   	ret
+        if (from_env_store) {
+  8054b1:	48 85 f6             	test   %rsi,%rsi
+  8054b4:	74 06                	je     8054bc <ipc_result+0x67>
+            *from_env_store = 0;
+  8054b6:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054bc:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054be:	48 85 c9             	test   %rcx,%rcx
+  8054c1:	74 ed                	je     8054b0 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054c3:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054c9:	c3                   	ret
+
+00000000008054ca <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054ca:	55                   	push   %rbp
+  8054cb:	48 89 e5             	mov    %rsp,%rbp
+  8054ce:	41 55                	push   %r13
+  8054d0:	41 54                	push   %r12
+  8054d2:	53                   	push   %rbx
+  8054d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8054d7:	49 89 fc             	mov    %rdi,%r12
+  8054da:	48 89 f7             	mov    %rsi,%rdi
+  8054dd:	48 89 d3             	mov    %rdx,%rbx
+  8054e0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054e3:	48 85 f6             	test   %rsi,%rsi
+  8054e6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054ed:	00 00 00 
+  8054f0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8054f9:	48 85 d2             	test   %rdx,%rdx
+  8054fc:	74 03                	je     805501 <ipc_recv+0x37>
+  8054fe:	48 8b 32             	mov    (%rdx),%rsi
+  805501:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  805508:	00 00 00 
+  80550b:	ff d0                	call   *%rax
+  80550d:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80550f:	4c 89 e9             	mov    %r13,%rcx
+  805512:	48 89 da             	mov    %rbx,%rdx
+  805515:	4c 89 e6             	mov    %r12,%rsi
+  805518:	48 b8 55 54 80 00 00 	movabs $0x805455,%rax
+  80551f:	00 00 00 
+  805522:	ff d0                	call   *%rax
+}
+  805524:	48 83 c4 08          	add    $0x8,%rsp
+  805528:	5b                   	pop    %rbx
+  805529:	41 5c                	pop    %r12
+  80552b:	41 5d                	pop    %r13
+  80552d:	5d                   	pop    %rbp
+  80552e:	c3                   	ret
+
+000000000080552f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80552f:	55                   	push   %rbp
+  805530:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805533:	48 85 d2             	test   %rdx,%rdx
+  805536:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80553d:	00 00 00 
+  805540:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805544:	89 f6                	mov    %esi,%esi
+  805546:	48 b8 26 2b 80 00 00 	movabs $0x802b26,%rax
+  80554d:	00 00 00 
+  805550:	ff d0                	call   *%rax
+    if (res < 0) {
+  805552:	85 c0                	test   %eax,%eax
+  805554:	78 02                	js     805558 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805556:	5d                   	pop    %rbp
+  805557:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805558:	89 c1                	mov    %eax,%ecx
+  80555a:	48 ba 90 63 80 00 00 	movabs $0x806390,%rdx
+  805561:	00 00 00 
+  805564:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805569:	48 bf 9d 63 80 00 00 	movabs $0x80639d,%rdi
+  805570:	00 00 00 
+  805573:	b8 00 00 00 00       	mov    $0x0,%eax
+  805578:	49 b8 a0 50 80 00 00 	movabs $0x8050a0,%r8
+  80557f:	00 00 00 
+  805582:	41 ff d0             	call   *%r8
+
+0000000000805585 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805585:	55                   	push   %rbp
+  805586:	48 89 e5             	mov    %rsp,%rbp
+  805589:	53                   	push   %rbx
+  80558a:	48 83 ec 08          	sub    $0x8,%rsp
+  80558e:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805592:	48 85 d2             	test   %rdx,%rdx
+  805595:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80559c:	00 00 00 
+  80559f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8055a3:	4d 85 c9             	test   %r9,%r9
+  8055a6:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8055aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055af:	48 85 db             	test   %rbx,%rbx
+  8055b2:	74 03                	je     8055b7 <ipc_call+0x32>
+  8055b4:	48 8b 03             	mov    (%rbx),%rax
+  8055b7:	89 f6                	mov    %esi,%esi
+  8055b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8055bd:	50                   	push   %rax
+  8055be:	48 b8 58 2b 80 00 00 	movabs $0x802b58,%rax
+  8055c5:	00 00 00 
+  8055c8:	ff d0                	call   *%rax
+  8055ca:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055cc:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055d0:	48 89 da             	mov    %rbx,%rdx
+  8055d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8055d8:	48 b8 55 54 80 00 00 	movabs $0x805455,%rax
+  8055df:	00 00 00 
+  8055e2:	ff d0                	call   *%rax
+}
+  8055e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055e8:	c9                   	leave
+  8055e9:	c3                   	ret
+
+00000000008055ea <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055ea:	55                   	push   %rbp
+  8055eb:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055ee:	89 f6                	mov    %esi,%esi
+  8055f0:	48 b8 c4 2b 80 00 00 	movabs $0x802bc4,%rax
+  8055f7:	00 00 00 
+  8055fa:	ff d0                	call   *%rax
+  8055fc:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805603:	ba 00 00 00 00       	mov    $0x0,%edx
+  805608:	be 00 00 00 00       	mov    $0x0,%esi
+  80560d:	48 b8 55 54 80 00 00 	movabs $0x805455,%rax
+  805614:	00 00 00 
+  805617:	ff d0                	call   *%rax
+}
+  805619:	5d                   	pop    %rbp
+  80561a:	c3                   	ret
+
+000000000080561b <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80561b:	55                   	push   %rbp
+  80561c:	48 89 e5             	mov    %rsp,%rbp
+  80561f:	41 54                	push   %r12
+  805621:	53                   	push   %rbx
+  805622:	4c 89 cb             	mov    %r9,%rbx
+  805625:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805629:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80562d:	48 85 d2             	test   %rdx,%rdx
+  805630:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805637:	00 00 00 
+  80563a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80563e:	4d 85 c9             	test   %r9,%r9
+  805641:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80564a:	4d 85 e4             	test   %r12,%r12
+  80564d:	74 04                	je     805653 <ipc_reply_wait+0x38>
+  80564f:	49 8b 04 24          	mov    (%r12),%rax
+  805653:	89 f6                	mov    %esi,%esi
+  805655:	48 83 ec 08          	sub    $0x8,%rsp
+  805659:	50                   	push   %rax
+  80565a:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  805661:	00 00 00 
+  805664:	ff d0                	call   *%rax
+  805666:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805668:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80566c:	4c 89 e2             	mov    %r12,%rdx
+  80566f:	48 89 de             	mov    %rbx,%rsi
+  805672:	48 b8 55 54 80 00 00 	movabs $0x805455,%rax
+  805679:	00 00 00 
+  80567c:	ff d0                	call   *%rax
+}
+  80567e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805682:	5b                   	pop    %rbx
+  805683:	41 5c                	pop    %r12
+  805685:	5d                   	pop    %rbp
+  805686:	c3                   	ret
+
+0000000000805687 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805687:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80568c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805693:	00 00 00 
+  805696:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80569d:	48 01 ca             	add    %rcx,%rdx
+  8056a0:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8056a6:	39 fa                	cmp    %edi,%edx
+  8056a8:	74 12                	je     8056bc <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8056aa:	48 83 c0 01          	add    $0x1,%rax
+  8056ae:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056b4:	75 e0                	jne    805696 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056bb:	c3                   	ret
+            return envs[i].env_id;
+  8056bc:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056c3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056ca:	00 00 00 
+  8056cd:	48 01 d0             	add    %rdx,%rax
+  8056d0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056d6:	c3                   	ret
+  8056d7:	90                   	nop
+
+00000000008056d8 <__rodata_start>:
+  8056d8:	77 00                	ja     8056da <__rodata_start+0x2>
+  8056da:	72 62                	jb     80573e <__rodata_start+0x66>
+  8056dc:	00 77 62             	add    %dh,0x62(%rdi)
+  8056df:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 25 64 0a 00 3c 75 6e 6b 6e 6f 77 6e 3e 00     ..%d..<unknown>.
+  805c30:	30 31 32 33 34 35 36 37 38 39 41 42 43 44 45 46     0123456789ABCDEF
+  805c40:	00 30 31 32 33 34 35 36 37 38 39 61 62 63 64 65     .0123456789abcde
+  805c50:	66 00 28 6e 75 6c 6c 29 00 65 72 72 6f 72 20 25     f.(null).error %
+  805c60:	64 00 75 6e 73 70 65 63 69 66 69 65 64 20 65 72     d.unspecified er
+  805c70:	72 6f 72 00 62 61 64 20 65 6e 76 69 72 6f 6e 6d     ror.bad environm
+  805c80:	65 6e 74 00 69 6e 76 61 6c 69 64 20 70 61 72 61     ent.invalid para
+  805c90:	6d 65 74 65 72 00 6f 75 74 20 6f 66 20 6d 65 6d     meter.out of mem
+  805ca0:	6f 72 79 00 6f 75 74 20 6f 66 20 65 6e 76 69 72     ory.out of envir
+  805cb0:	6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75 70 74 65     onments.corrupte
+  805cc0:	64 20 64 65 62 75 67 20 69 6e 66 6f 00 73 65 67     d debug info.seg
+  805cd0:	6d 65 6e 74 61 74 69 6f 6e 20 66 61 75 6c 74 00     mentation fault.
+  805ce0:	69 6e 76 61 6c 69 64 20 45 4c 46 20 69 6d 61 67     invalid ELF imag
+  805cf0:	65 00 6e 6f 20 73 75 63 68 20 73 79 73 74 65 6d     e.no such system
+  805d00:	20 63 61 6c 6c 00 65 6e 74 72 79 20 6e 6f 74 20      call.entry not 
+  805d10:	66 6f 75 6e 64 00 65 6e 76 20 69 73 20 6e 6f 74     found.env is not
+  805d20:	20 72 65 63 76 69 6e 67 00 75 6e 65 78 70 65 63      recving.unexpec
+  805d30:	74 65 64 20 65 6e 64 20 6f 66 20 66 69 6c 65 00     ted end of file.
+  805d40:	6e 6f 20 66 72 65 65 20 73 70 61 63 65 20 6f 6e     no free space on
+  805d50:	20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e 79 20 66      disk.too many f
+  805d60:	69 6c 65 73 20 61 72 65 20 6f 70 65 6e 00 66 69     iles are open.fi
+  805d70:	6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e 6f 74 20     le or block not 
+  805d80:	66 6f 75 6e 64 00 69 6e 76 61 6c 69 64 20 70 61     found.invalid pa
+  805d90:	74 68 00 66 69 6c 65 20 61 6c 72 65 61 64 79 20     th.file already 
+  805da0:	65 78 69 73 74 73 00 6f 70 65 72 61 74 69 6f 6e     exists.operation
+  805db0:	20 6e 6f 74 20 73 75 70 70 6f 72 74 65 64 00 90      not supported..
+  805dc0:	aa 18 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805dd0:	f1 1e 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805de0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805df0:	01 1f 80 00 00 00 00 00 c9 18 80 00 00 00 00 00     ................
+  805e00:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805e10:	bd 18 80 00 00 00 00 00 37 19 80 00 00 00 00 00     ........7.......
+  805e20:	01 1f 80 00 00 00 00 00 bd 18 80 00 00 00 00 00     ................
+  805e30:	03 19 80 00 00 00 00 00 03 19 80 00 00 00 00 00     ................
+  805e40:	03 19 80 00 00 00 00 00 03 19 80 00 00 00 00 00     ................
+  805e50:	03 19 80 00 00 00 00 00 03 19 80 00 00 00 00 00     ................
+  805e60:	03 19 80 00 00 00 00 00 03 19 80 00 00 00 00 00     ................
+  805e70:	03 19 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805e80:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805e90:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805ea0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805eb0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805ec0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805ed0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805ee0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805ef0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f00:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f10:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f20:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f30:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f40:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f50:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f60:	01 1f 80 00 00 00 00 00 1f 1e 80 00 00 00 00 00     ................
+  805f70:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f80:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805f90:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805fa0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805fb0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805fc0:	65 19 80 00 00 00 00 00 34 1b 80 00 00 00 00 00     e.......4.......
+  805fd0:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  805fe0:	01 1f 80 00 00 00 00 00 5a 19 80 00 00 00 00 00     ........Z.......
+  805ff0:	94 19 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  806000:	01 1f 80 00 00 00 00 00 4f 19 80 00 00 00 00 00     ........O.......
+  806010:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  806020:	dd 1c 80 00 00 00 00 00 ac 1d 80 00 00 00 00 00     ................
+  806030:	01 1f 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  806040:	2b 1a 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     +...............
+  806050:	08 1c 80 00 00 00 00 00 01 1f 80 00 00 00 00 00     ................
+  806060:	01 1f 80 00 00 00 00 00 1f 1e 80 00 00 00 00 00     ................
+  806070:	01 1f 80 00 00 00 00 00 b3 18 80 00 00 00 00 00     ................
+
+0000000000806080 <error_string>:
+	...
+  806088:	62 5c 80 00 00 00 00 00 74 5c 80 00 00 00 00 00     b\......t\......
+  806098:	84 5c 80 00 00 00 00 00 96 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	a4 5c 80 00 00 00 00 00 b8 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	cd 5c 80 00 00 00 00 00 e0 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	f2 5c 80 00 00 00 00 00 06 5d 80 00 00 00 00 00     .\.......]......
+  8060d8:	16 5d 80 00 00 00 00 00 29 5d 80 00 00 00 00 00     .]......)]......
+  8060e8:	40 5d 80 00 00 00 00 00 56 5d 80 00 00 00 00 00     @]......V]......
+  8060f8:	6e 5d 80 00 00 00 00 00 86 5d 80 00 00 00 00 00     n].......]......
+  806108:	93 5d 80 00 00 00 00 00 20 61 80 00 00 00 00 00     .]...... a......
+  806118:	a7 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806128:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806138:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806148:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806158:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806168:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806178:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806188:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806198:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806200 <devtab>:
+  806200:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806210:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806220:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806230:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806240:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806250:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806260:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806270:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806280:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806290:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062f0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806300:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806310:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806320:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806330:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806340:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806350:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806360:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806370:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806380:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806390:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063a0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,10311 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 55 22 80 00 00 	movabs $0x802255,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 75 1f 80 00 00 	movabs $0x801f75,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 d6 20 80 00 00 	movabs $0x8020d6,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 75 1f 80 00 00 	movabs $0x801f75,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 18 16 80 00 00 	movabs $0x801618,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 ec 3b 80 00 00 	movabs $0x803bec,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 ec 3b 80 00 00 	movabs $0x803bec,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 ac 15 80 00 00 	movabs $0x8015ac,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 70 5c 80 00 00 	movabs $0x805c70,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 7f 39 80 00 00 	movabs $0x80397f,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be a8 56 80 00 00 	movabs $0x8056a8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 7f 39 80 00 00 	movabs $0x80397f,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be aa 56 80 00 00 	movabs $0x8056aa,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 7f 39 80 00 00 	movabs $0x80397f,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be ad 56 80 00 00 	movabs $0x8056ad,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 7f 39 80 00 00 	movabs $0x80397f,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 c1 4c 80 00 00 	movabs $0x804cc1,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 69 2f 80 00 00 	movabs $0x802f69,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 00 33 80 00 00 	movabs $0x803300,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 c9 33 80 00 00 	movabs $0x8033c9,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 cf 32 80 00 00 	movabs $0x8032cf,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 cf 32 80 00 00 	movabs $0x8032cf,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 e7 30 80 00 00 	movabs $0x8030e7,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 7f 39 80 00 00 	movabs $0x80397f,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 69 2f 80 00 00 	movabs $0x802f69,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 75 1f 80 00 00 	movabs $0x801f75,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 22 22 80 00 00 	movabs $0x802222,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 22 22 80 00 00 	movabs $0x802222,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 55 22 80 00 00 	movabs $0x802255,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 22 22 80 00 00 	movabs $0x802222,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 59 80 00 00 	movabs $0x805960,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 22 22 80 00 00 	movabs $0x802222,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 22 22 80 00 00 	movabs $0x802222,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 7a 24 80 00 00 	movabs $0x80247a,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 7a 24 80 00 00 	movabs $0x80247a,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 04 00 00 00       	call   801503 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $3");
+  801501:	cc                   	int3
+}
+  801502:	c3                   	ret
+
+0000000000801503 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801503:	55                   	push   %rbp
+  801504:	48 89 e5             	mov    %rsp,%rbp
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	41 89 fd             	mov    %edi,%r13d
+  801511:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801514:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80151b:	00 00 00 
+  80151e:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801525:	00 00 00 
+  801528:	48 39 c2             	cmp    %rax,%rdx
+  80152b:	73 17                	jae    801544 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80152d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801530:	49 89 c4             	mov    %rax,%r12
+  801533:	48 83 c3 08          	add    $0x8,%rbx
+  801537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153c:	ff 53 f8             	call   *-0x8(%rbx)
+  80153f:	4c 39 e3             	cmp    %r12,%rbx
+  801542:	72 ef                	jb     801533 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801544:	48 b8 40 26 80 00 00 	movabs $0x802640,%rax
+  80154b:	00 00 00 
+  80154e:	ff d0                	call   *%rax
+  801550:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801555:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80155c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801563:	00 00 00 
+  801566:	48 01 d0             	add    %rdx,%rax
+  801569:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801570:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801573:	45 85 ed             	test   %r13d,%r13d
+  801576:	7e 0d                	jle    801585 <libmain+0x82>
+  801578:	49 8b 06             	mov    (%r14),%rax
+  80157b:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801582:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801585:	4c 89 f6             	mov    %r14,%rsi
+  801588:	44 89 ef             	mov    %r13d,%edi
+  80158b:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801592:	00 00 00 
+  801595:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801597:	48 b8 ac 15 80 00 00 	movabs $0x8015ac,%rax
+  80159e:	00 00 00 
+  8015a1:	ff d0                	call   *%rax
+#endif
+}
+  8015a3:	5b                   	pop    %rbx
+  8015a4:	41 5c                	pop    %r12
+  8015a6:	41 5d                	pop    %r13
+  8015a8:	41 5e                	pop    %r14
+  8015aa:	5d                   	pop    %rbp
+  8015ab:	c3                   	ret
+
+00000000008015ac <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015ac:	55                   	push   %rbp
+  8015ad:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015b0:	48 b8 9c 2f 80 00 00 	movabs $0x802f9c,%rax
+  8015b7:	00 00 00 
+  8015ba:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c1:	48 b8 cf 25 80 00 00 	movabs $0x8025cf,%rax
+  8015c8:	00 00 00 
+  8015cb:	ff d0                	call   *%rax
+}
+  8015cd:	5d                   	pop    %rbp
+  8015ce:	c3                   	ret
+
+00000000008015cf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015cf:	55                   	push   %rbp
+  8015d0:	48 89 e5             	mov    %rsp,%rbp
+  8015d3:	53                   	push   %rbx
+  8015d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015db:	8b 06                	mov    (%rsi),%eax
+  8015dd:	8d 50 01             	lea    0x1(%rax),%edx
+  8015e0:	89 16                	mov    %edx,(%rsi)
+  8015e2:	48 98                	cltq
+  8015e4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8015e9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8015ef:	74 0a                	je     8015fb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8015f1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8015f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8015fb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8015ff:	be ff 00 00 00       	mov    $0xff,%esi
+  801604:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  80160b:	00 00 00 
+  80160e:	ff d0                	call   *%rax
+        state->offset = 0;
+  801610:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801616:	eb d9                	jmp    8015f1 <putch+0x22>
+
+0000000000801618 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801618:	55                   	push   %rbp
+  801619:	48 89 e5             	mov    %rsp,%rbp
+  80161c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801623:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801626:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80162d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801632:	b8 00 00 00 00       	mov    $0x0,%eax
+  801637:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80163a:	48 89 f1             	mov    %rsi,%rcx
+  80163d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801644:	48 bf cf 15 80 00 00 	movabs $0x8015cf,%rdi
+  80164b:	00 00 00 
+  80164e:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801655:	00 00 00 
+  801658:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80165a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801661:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801668:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  80166f:	00 00 00 
+  801672:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801674:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80167a:	c9                   	leave
+  80167b:	c3                   	ret
+
+000000000080167c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80167c:	55                   	push   %rbp
+  80167d:	48 89 e5             	mov    %rsp,%rbp
+  801680:	48 83 ec 50          	sub    $0x50,%rsp
+  801684:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801688:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80168c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801690:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801694:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801698:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80169f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016a7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016af:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016b3:	48 b8 18 16 80 00 00 	movabs $0x801618,%rax
+  8016ba:	00 00 00 
+  8016bd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016bf:	c9                   	leave
+  8016c0:	c3                   	ret
+
+00000000008016c1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016c1:	55                   	push   %rbp
+  8016c2:	48 89 e5             	mov    %rsp,%rbp
+  8016c5:	41 57                	push   %r15
+  8016c7:	41 56                	push   %r14
+  8016c9:	41 55                	push   %r13
+  8016cb:	41 54                	push   %r12
+  8016cd:	53                   	push   %rbx
+  8016ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8016d2:	49 89 fc             	mov    %rdi,%r12
+  8016d5:	49 89 f5             	mov    %rsi,%r13
+  8016d8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016dc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8016df:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8016e2:	41 89 cf             	mov    %ecx,%r15d
+  8016e5:	4c 39 fa             	cmp    %r15,%rdx
+  8016e8:	73 5b                	jae    801745 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8016ea:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8016ee:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8016f2:	85 db                	test   %ebx,%ebx
+  8016f4:	7e 0e                	jle    801704 <print_num+0x43>
+            putch(padc, put_arg);
+  8016f6:	4c 89 ee             	mov    %r13,%rsi
+  8016f9:	44 89 f7             	mov    %r14d,%edi
+  8016fc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8016ff:	83 eb 01             	sub    $0x1,%ebx
+  801702:	75 f2                	jne    8016f6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801704:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801708:	48 b9 1d 5c 80 00 00 	movabs $0x805c1d,%rcx
+  80170f:	00 00 00 
+  801712:	48 b8 0c 5c 80 00 00 	movabs $0x805c0c,%rax
+  801719:	00 00 00 
+  80171c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801720:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801724:	ba 00 00 00 00       	mov    $0x0,%edx
+  801729:	49 f7 f7             	div    %r15
+  80172c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801730:	4c 89 ee             	mov    %r13,%rsi
+  801733:	41 ff d4             	call   *%r12
+}
+  801736:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80173a:	5b                   	pop    %rbx
+  80173b:	41 5c                	pop    %r12
+  80173d:	41 5d                	pop    %r13
+  80173f:	41 5e                	pop    %r14
+  801741:	41 5f                	pop    %r15
+  801743:	5d                   	pop    %rbp
+  801744:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801745:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801749:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174e:	49 f7 f7             	div    %r15
+  801751:	48 83 ec 08          	sub    $0x8,%rsp
+  801755:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801759:	52                   	push   %rdx
+  80175a:	45 0f be c9          	movsbl %r9b,%r9d
+  80175e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801762:	48 89 c2             	mov    %rax,%rdx
+  801765:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  80176c:	00 00 00 
+  80176f:	ff d0                	call   *%rax
+  801771:	48 83 c4 10          	add    $0x10,%rsp
+  801775:	eb 8d                	jmp    801704 <print_num+0x43>
+
+0000000000801777 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801777:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80177b:	48 8b 06             	mov    (%rsi),%rax
+  80177e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801782:	73 0a                	jae    80178e <sprintputch+0x17>
+        *state->start++ = ch;
+  801784:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801788:	48 89 16             	mov    %rdx,(%rsi)
+  80178b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80178e:	c3                   	ret
+
+000000000080178f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80178f:	55                   	push   %rbp
+  801790:	48 89 e5             	mov    %rsp,%rbp
+  801793:	48 83 ec 50          	sub    $0x50,%rsp
+  801797:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80179b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80179f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017a3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017aa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017b2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017ba:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017be:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  8017c5:	00 00 00 
+  8017c8:	ff d0                	call   *%rax
+}
+  8017ca:	c9                   	leave
+  8017cb:	c3                   	ret
+
+00000000008017cc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017cc:	55                   	push   %rbp
+  8017cd:	48 89 e5             	mov    %rsp,%rbp
+  8017d0:	41 57                	push   %r15
+  8017d2:	41 56                	push   %r14
+  8017d4:	41 55                	push   %r13
+  8017d6:	41 54                	push   %r12
+  8017d8:	53                   	push   %rbx
+  8017d9:	48 83 ec 38          	sub    $0x38,%rsp
+  8017dd:	49 89 fe             	mov    %rdi,%r14
+  8017e0:	49 89 f5             	mov    %rsi,%r13
+  8017e3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8017e6:	48 8b 01             	mov    (%rcx),%rax
+  8017e9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8017ed:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8017f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017f5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8017f9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8017fd:	eb 0d                	jmp    80180c <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8017ff:	40 0f b6 ff          	movzbl %dil,%edi
+  801803:	4c 89 ee             	mov    %r13,%rsi
+  801806:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801809:	4c 89 e3             	mov    %r12,%rbx
+  80180c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801810:	0f b6 3b             	movzbl (%rbx),%edi
+  801813:	40 80 ff 25          	cmp    $0x25,%dil
+  801817:	74 14                	je     80182d <vprintfmt+0x61>
+            if (!ch) return;
+  801819:	40 84 ff             	test   %dil,%dil
+  80181c:	75 e1                	jne    8017ff <vprintfmt+0x33>
+}
+  80181e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801822:	5b                   	pop    %rbx
+  801823:	41 5c                	pop    %r12
+  801825:	41 5d                	pop    %r13
+  801827:	41 5e                	pop    %r14
+  801829:	41 5f                	pop    %r15
+  80182b:	5d                   	pop    %rbp
+  80182c:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  80182d:	be 00 00 00 00       	mov    $0x0,%esi
+  801832:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801836:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80183b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801841:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801848:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80184c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801851:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801856:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801859:	83 e8 23             	sub    $0x23,%eax
+  80185c:	3c 57                	cmp    $0x57,%al
+  80185e:	0f 87 67 06 00 00    	ja     801ecb <vprintfmt+0x6ff>
+  801864:	0f b6 c0             	movzbl %al,%eax
+  801867:	48 b9 a0 5d 80 00 00 	movabs $0x805da0,%rcx
+  80186e:	00 00 00 
+  801871:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801874:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801877:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80187b:	eb cf                	jmp    80184c <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80187d:	49 89 dc             	mov    %rbx,%r12
+  801880:	be 01 00 00 00       	mov    $0x1,%esi
+  801885:	eb c5                	jmp    80184c <vprintfmt+0x80>
+            padc = ch;
+  801887:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80188b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80188e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801891:	eb b9                	jmp    80184c <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801893:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801896:	83 f8 2f             	cmp    $0x2f,%eax
+  801899:	77 24                	ja     8018bf <vprintfmt+0xf3>
+  80189b:	89 c1                	mov    %eax,%ecx
+  80189d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018a1:	83 c0 08             	add    $0x8,%eax
+  8018a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018a7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018aa:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018ad:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018b1:	79 99                	jns    80184c <vprintfmt+0x80>
+                width = precision;
+  8018b3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018b7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018bd:	eb 8d                	jmp    80184c <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018bf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018c3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018cb:	eb da                	jmp    8018a7 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018cd:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018d2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018d6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018dc:	3c 39                	cmp    $0x39,%al
+  8018de:	77 1c                	ja     8018fc <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8018e0:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8018e4:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8018e8:	0f b6 c0             	movzbl %al,%eax
+  8018eb:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018f0:	0f b6 03             	movzbl (%rbx),%eax
+  8018f3:	3c 39                	cmp    $0x39,%al
+  8018f5:	76 e9                	jbe    8018e0 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8018f7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8018fa:	eb b1                	jmp    8018ad <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8018fc:	49 89 dc             	mov    %rbx,%r12
+  8018ff:	eb ac                	jmp    8018ad <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801901:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801904:	85 c9                	test   %ecx,%ecx
+  801906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190b:	0f 49 c1             	cmovns %ecx,%eax
+  80190e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801911:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801914:	e9 33 ff ff ff       	jmp    80184c <vprintfmt+0x80>
+            lflag++;
+  801919:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80191c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80191f:	e9 28 ff ff ff       	jmp    80184c <vprintfmt+0x80>
+            lflag--;
+  801924:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801927:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80192a:	e9 1d ff ff ff       	jmp    80184c <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  80192f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801932:	83 f8 2f             	cmp    $0x2f,%eax
+  801935:	77 19                	ja     801950 <vprintfmt+0x184>
+  801937:	89 c2                	mov    %eax,%edx
+  801939:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80193d:	83 c0 08             	add    $0x8,%eax
+  801940:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801943:	8b 3a                	mov    (%rdx),%edi
+  801945:	4c 89 ee             	mov    %r13,%rsi
+  801948:	41 ff d6             	call   *%r14
+            break;
+  80194b:	e9 bc fe ff ff       	jmp    80180c <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801950:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801954:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801958:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80195c:	eb e5                	jmp    801943 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  80195e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801961:	83 f8 2f             	cmp    $0x2f,%eax
+  801964:	77 5a                	ja     8019c0 <vprintfmt+0x1f4>
+  801966:	89 c2                	mov    %eax,%edx
+  801968:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80196c:	83 c0 08             	add    $0x8,%eax
+  80196f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801972:	8b 02                	mov    (%rdx),%eax
+  801974:	89 c1                	mov    %eax,%ecx
+  801976:	f7 d9                	neg    %ecx
+  801978:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80197b:	83 f9 13             	cmp    $0x13,%ecx
+  80197e:	7f 4e                	jg     8019ce <vprintfmt+0x202>
+  801980:	48 63 c1             	movslq %ecx,%rax
+  801983:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  80198a:	00 00 00 
+  80198d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801991:	48 85 c0             	test   %rax,%rax
+  801994:	74 38                	je     8019ce <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801996:	48 89 c1             	mov    %rax,%rcx
+  801999:	48 ba 28 62 80 00 00 	movabs $0x806228,%rdx
+  8019a0:	00 00 00 
+  8019a3:	4c 89 ee             	mov    %r13,%rsi
+  8019a6:	4c 89 f7             	mov    %r14,%rdi
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ae:	49 b8 8f 17 80 00 00 	movabs $0x80178f,%r8
+  8019b5:	00 00 00 
+  8019b8:	41 ff d0             	call   *%r8
+  8019bb:	e9 4c fe ff ff       	jmp    80180c <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019cc:	eb a4                	jmp    801972 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019ce:	48 ba 35 5c 80 00 00 	movabs $0x805c35,%rdx
+  8019d5:	00 00 00 
+  8019d8:	4c 89 ee             	mov    %r13,%rsi
+  8019db:	4c 89 f7             	mov    %r14,%rdi
+  8019de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e3:	49 b8 8f 17 80 00 00 	movabs $0x80178f,%r8
+  8019ea:	00 00 00 
+  8019ed:	41 ff d0             	call   *%r8
+  8019f0:	e9 17 fe ff ff       	jmp    80180c <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8019f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8019fb:	77 6c                	ja     801a69 <vprintfmt+0x29d>
+  8019fd:	89 c2                	mov    %eax,%edx
+  8019ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a03:	83 c0 08             	add    $0x8,%eax
+  801a06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a09:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a0c:	48 85 f6             	test   %rsi,%rsi
+  801a0f:	48 b8 2e 5c 80 00 00 	movabs $0x805c2e,%rax
+  801a16:	00 00 00 
+  801a19:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a1d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a21:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a25:	7e 06                	jle    801a2d <vprintfmt+0x261>
+  801a27:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a2b:	75 4a                	jne    801a77 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a2d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a31:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a35:	0f b6 00             	movzbl (%rax),%eax
+  801a38:	84 c0                	test   %al,%al
+  801a3a:	0f 85 9a 00 00 00    	jne    801ada <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a40:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a43:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	0f 8e bd fd ff ff    	jle    80180c <vprintfmt+0x40>
+  801a4f:	4c 89 ee             	mov    %r13,%rsi
+  801a52:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a57:	41 ff d6             	call   *%r14
+  801a5a:	41 83 ec 01          	sub    $0x1,%r12d
+  801a5e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a62:	75 eb                	jne    801a4f <vprintfmt+0x283>
+  801a64:	e9 a3 fd ff ff       	jmp    80180c <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a75:	eb 92                	jmp    801a09 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a77:	49 63 f7             	movslq %r15d,%rsi
+  801a7a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801a7e:	48 b8 90 1f 80 00 00 	movabs $0x801f90,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+  801a8a:	48 89 c2             	mov    %rax,%rdx
+  801a8d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a90:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801a92:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801a95:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	7e 91                	jle    801a2d <vprintfmt+0x261>
+  801a9c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801aa1:	4c 89 ee             	mov    %r13,%rsi
+  801aa4:	44 89 e7             	mov    %r12d,%edi
+  801aa7:	41 ff d6             	call   *%r14
+  801aaa:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801aae:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ab4:	75 eb                	jne    801aa1 <vprintfmt+0x2d5>
+  801ab6:	e9 72 ff ff ff       	jmp    801a2d <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801abb:	0f b6 f8             	movzbl %al,%edi
+  801abe:	4c 89 ee             	mov    %r13,%rsi
+  801ac1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ac4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ac8:	49 83 c4 01          	add    $0x1,%r12
+  801acc:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ad2:	84 c0                	test   %al,%al
+  801ad4:	0f 84 66 ff ff ff    	je     801a40 <vprintfmt+0x274>
+  801ada:	45 85 ff             	test   %r15d,%r15d
+  801add:	78 0a                	js     801ae9 <vprintfmt+0x31d>
+  801adf:	41 83 ef 01          	sub    $0x1,%r15d
+  801ae3:	0f 88 57 ff ff ff    	js     801a40 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ae9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801aed:	74 cc                	je     801abb <vprintfmt+0x2ef>
+  801aef:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801af2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801af7:	80 fa 5e             	cmp    $0x5e,%dl
+  801afa:	77 c2                	ja     801abe <vprintfmt+0x2f2>
+  801afc:	eb bd                	jmp    801abb <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801afe:	40 84 f6             	test   %sil,%sil
+  801b01:	75 26                	jne    801b29 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b03:	85 d2                	test   %edx,%edx
+  801b05:	74 59                	je     801b60 <vprintfmt+0x394>
+  801b07:	83 fa 01             	cmp    $0x1,%edx
+  801b0a:	74 7b                	je     801b87 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  801b12:	0f 87 96 00 00 00    	ja     801bae <vprintfmt+0x3e2>
+  801b18:	89 c2                	mov    %eax,%edx
+  801b1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b1e:	83 c0 08             	add    $0x8,%eax
+  801b21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b24:	4c 8b 22             	mov    (%rdx),%r12
+  801b27:	eb 17                	jmp    801b40 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  801b2f:	77 21                	ja     801b52 <vprintfmt+0x386>
+  801b31:	89 c2                	mov    %eax,%edx
+  801b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b37:	83 c0 08             	add    $0x8,%eax
+  801b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b3d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b40:	4d 85 e4             	test   %r12,%r12
+  801b43:	78 7a                	js     801bbf <vprintfmt+0x3f3>
+            num = i;
+  801b45:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b48:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b4d:	e9 56 02 00 00       	jmp    801da8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b5e:	eb dd                	jmp    801b3d <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b63:	83 f8 2f             	cmp    $0x2f,%eax
+  801b66:	77 11                	ja     801b79 <vprintfmt+0x3ad>
+  801b68:	89 c2                	mov    %eax,%edx
+  801b6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b6e:	83 c0 08             	add    $0x8,%eax
+  801b71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b74:	4c 63 22             	movslq (%rdx),%r12
+  801b77:	eb c7                	jmp    801b40 <vprintfmt+0x374>
+  801b79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b85:	eb ed                	jmp    801b74 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801b87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8a:	83 f8 2f             	cmp    $0x2f,%eax
+  801b8d:	77 11                	ja     801ba0 <vprintfmt+0x3d4>
+  801b8f:	89 c2                	mov    %eax,%edx
+  801b91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b95:	83 c0 08             	add    $0x8,%eax
+  801b98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b9b:	4c 8b 22             	mov    (%rdx),%r12
+  801b9e:	eb a0                	jmp    801b40 <vprintfmt+0x374>
+  801ba0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bac:	eb ed                	jmp    801b9b <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bba:	e9 65 ff ff ff       	jmp    801b24 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bbf:	4c 89 ee             	mov    %r13,%rsi
+  801bc2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bc7:	41 ff d6             	call   *%r14
+                i = -i;
+  801bca:	49 f7 dc             	neg    %r12
+  801bcd:	e9 73 ff ff ff       	jmp    801b45 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bd2:	40 84 f6             	test   %sil,%sil
+  801bd5:	75 2e                	jne    801c05 <vprintfmt+0x439>
+    switch (lflag) {
+  801bd7:	85 d2                	test   %edx,%edx
+  801bd9:	7f 59                	jg     801c34 <vprintfmt+0x468>
+  801bdb:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801bde:	7d 7a                	jge    801c5a <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801be0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801be3:	83 f8 2f             	cmp    $0x2f,%eax
+  801be6:	0f 87 aa 00 00 00    	ja     801c96 <vprintfmt+0x4ca>
+  801bec:	89 c2                	mov    %eax,%edx
+  801bee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bf2:	83 c0 08             	add    $0x8,%eax
+  801bf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bf8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801bfb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c00:	e9 a3 01 00 00       	jmp    801da8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c08:	83 f8 2f             	cmp    $0x2f,%eax
+  801c0b:	77 19                	ja     801c26 <vprintfmt+0x45a>
+  801c0d:	89 c2                	mov    %eax,%edx
+  801c0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c13:	83 c0 08             	add    $0x8,%eax
+  801c16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c19:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c1c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c21:	e9 82 01 00 00       	jmp    801da8 <vprintfmt+0x5dc>
+  801c26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c32:	eb e5                	jmp    801c19 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c34:	83 fa 01             	cmp    $0x1,%edx
+  801c37:	75 a7                	jne    801be0 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c3c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c3f:	77 47                	ja     801c88 <vprintfmt+0x4bc>
+  801c41:	89 c2                	mov    %eax,%edx
+  801c43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c47:	83 c0 08             	add    $0x8,%eax
+  801c4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c4d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c50:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c55:	e9 4e 01 00 00       	jmp    801da8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c5d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c60:	77 18                	ja     801c7a <vprintfmt+0x4ae>
+  801c62:	89 c2                	mov    %eax,%edx
+  801c64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c68:	83 c0 08             	add    $0x8,%eax
+  801c6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c6e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c70:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c75:	e9 2e 01 00 00       	jmp    801da8 <vprintfmt+0x5dc>
+  801c7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c86:	eb e6                	jmp    801c6e <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801c88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c94:	eb b7                	jmp    801c4d <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801c96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca2:	e9 51 ff ff ff       	jmp    801bf8 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ca7:	40 84 f6             	test   %sil,%sil
+  801caa:	75 2e                	jne    801cda <vprintfmt+0x50e>
+    switch (lflag) {
+  801cac:	85 d2                	test   %edx,%edx
+  801cae:	7f 59                	jg     801d09 <vprintfmt+0x53d>
+  801cb0:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cb3:	7d 77                	jge    801d2c <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb8:	83 f8 2f             	cmp    $0x2f,%eax
+  801cbb:	0f 87 a4 00 00 00    	ja     801d65 <vprintfmt+0x599>
+  801cc1:	89 c2                	mov    %eax,%edx
+  801cc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cc7:	83 c0 08             	add    $0x8,%eax
+  801cca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ccd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cd0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cd5:	e9 ce 00 00 00       	jmp    801da8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cdd:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce0:	77 19                	ja     801cfb <vprintfmt+0x52f>
+  801ce2:	89 c2                	mov    %eax,%edx
+  801ce4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ce8:	83 c0 08             	add    $0x8,%eax
+  801ceb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cf1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801cf6:	e9 ad 00 00 00       	jmp    801da8 <vprintfmt+0x5dc>
+  801cfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d07:	eb e5                	jmp    801cee <vprintfmt+0x522>
+    switch (lflag) {
+  801d09:	83 fa 01             	cmp    $0x1,%edx
+  801d0c:	75 a7                	jne    801cb5 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d11:	83 f8 2f             	cmp    $0x2f,%eax
+  801d14:	77 41                	ja     801d57 <vprintfmt+0x58b>
+  801d16:	89 c2                	mov    %eax,%edx
+  801d18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d1c:	83 c0 08             	add    $0x8,%eax
+  801d1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d22:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d25:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d2a:	eb 7c                	jmp    801da8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d2f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d32:	77 15                	ja     801d49 <vprintfmt+0x57d>
+  801d34:	89 c2                	mov    %eax,%edx
+  801d36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d3a:	83 c0 08             	add    $0x8,%eax
+  801d3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d40:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d42:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d47:	eb 5f                	jmp    801da8 <vprintfmt+0x5dc>
+  801d49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d55:	eb e9                	jmp    801d40 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d63:	eb bd                	jmp    801d22 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d71:	e9 57 ff ff ff       	jmp    801ccd <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d76:	4c 89 ee             	mov    %r13,%rsi
+  801d79:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d7e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801d81:	4c 89 ee             	mov    %r13,%rsi
+  801d84:	bf 78 00 00 00       	mov    $0x78,%edi
+  801d89:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801d8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d8f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d92:	77 47                	ja     801ddb <vprintfmt+0x60f>
+  801d94:	89 c2                	mov    %eax,%edx
+  801d96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9a:	83 c0 08             	add    $0x8,%eax
+  801d9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801da3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801da8:	48 83 ec 08          	sub    $0x8,%rsp
+  801dac:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801db0:	0f 94 c0             	sete   %al
+  801db3:	0f b6 c0             	movzbl %al,%eax
+  801db6:	50                   	push   %rax
+  801db7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801dbc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801dc0:	4c 89 ee             	mov    %r13,%rsi
+  801dc3:	4c 89 f7             	mov    %r14,%rdi
+  801dc6:	48 b8 c1 16 80 00 00 	movabs $0x8016c1,%rax
+  801dcd:	00 00 00 
+  801dd0:	ff d0                	call   *%rax
+            break;
+  801dd2:	48 83 c4 10          	add    $0x10,%rsp
+  801dd6:	e9 31 fa ff ff       	jmp    80180c <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801ddb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ddf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801de3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801de7:	eb b7                	jmp    801da0 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801de9:	40 84 f6             	test   %sil,%sil
+  801dec:	75 2b                	jne    801e19 <vprintfmt+0x64d>
+    switch (lflag) {
+  801dee:	85 d2                	test   %edx,%edx
+  801df0:	7f 56                	jg     801e48 <vprintfmt+0x67c>
+  801df2:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801df5:	7d 77                	jge    801e6e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801df7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dfa:	83 f8 2f             	cmp    $0x2f,%eax
+  801dfd:	0f 87 a7 00 00 00    	ja     801eaa <vprintfmt+0x6de>
+  801e03:	89 c2                	mov    %eax,%edx
+  801e05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e09:	83 c0 08             	add    $0x8,%eax
+  801e0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e12:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e17:	eb 8f                	jmp    801da8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1c:	83 f8 2f             	cmp    $0x2f,%eax
+  801e1f:	77 19                	ja     801e3a <vprintfmt+0x66e>
+  801e21:	89 c2                	mov    %eax,%edx
+  801e23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e27:	83 c0 08             	add    $0x8,%eax
+  801e2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e2d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e30:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e35:	e9 6e ff ff ff       	jmp    801da8 <vprintfmt+0x5dc>
+  801e3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e46:	eb e5                	jmp    801e2d <vprintfmt+0x661>
+    switch (lflag) {
+  801e48:	83 fa 01             	cmp    $0x1,%edx
+  801e4b:	75 aa                	jne    801df7 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e50:	83 f8 2f             	cmp    $0x2f,%eax
+  801e53:	77 47                	ja     801e9c <vprintfmt+0x6d0>
+  801e55:	89 c2                	mov    %eax,%edx
+  801e57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e5b:	83 c0 08             	add    $0x8,%eax
+  801e5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e61:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e64:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e69:	e9 3a ff ff ff       	jmp    801da8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e71:	83 f8 2f             	cmp    $0x2f,%eax
+  801e74:	77 18                	ja     801e8e <vprintfmt+0x6c2>
+  801e76:	89 c2                	mov    %eax,%edx
+  801e78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e7c:	83 c0 08             	add    $0x8,%eax
+  801e7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e82:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801e84:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801e89:	e9 1a ff ff ff       	jmp    801da8 <vprintfmt+0x5dc>
+  801e8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9a:	eb e6                	jmp    801e82 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801e9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea8:	eb b7                	jmp    801e61 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801eaa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb6:	e9 54 ff ff ff       	jmp    801e0f <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ebb:	4c 89 ee             	mov    %r13,%rsi
+  801ebe:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ec3:	41 ff d6             	call   *%r14
+            break;
+  801ec6:	e9 41 f9 ff ff       	jmp    80180c <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ecb:	4c 89 ee             	mov    %r13,%rsi
+  801ece:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ed3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ed6:	48 83 eb 01          	sub    $0x1,%rbx
+  801eda:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801ede:	75 f6                	jne    801ed6 <vprintfmt+0x70a>
+  801ee0:	e9 27 f9 ff ff       	jmp    80180c <vprintfmt+0x40>
+
+0000000000801ee5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801ee5:	55                   	push   %rbp
+  801ee6:	48 89 e5             	mov    %rsp,%rbp
+  801ee9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801eed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ef1:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801ef6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801efa:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f01:	48 85 ff             	test   %rdi,%rdi
+  801f04:	74 2b                	je     801f31 <vsnprintf+0x4c>
+  801f06:	48 85 f6             	test   %rsi,%rsi
+  801f09:	74 26                	je     801f31 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f0b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f0f:	48 bf 77 17 80 00 00 	movabs $0x801777,%rdi
+  801f16:	00 00 00 
+  801f19:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  801f20:	00 00 00 
+  801f23:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f29:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f2c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f2f:	c9                   	leave
+  801f30:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f36:	eb f7                	jmp    801f2f <vsnprintf+0x4a>
+
+0000000000801f38 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f38:	55                   	push   %rbp
+  801f39:	48 89 e5             	mov    %rsp,%rbp
+  801f3c:	48 83 ec 50          	sub    $0x50,%rsp
+  801f40:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f44:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f48:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f4c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f53:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f5b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f5f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f63:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f67:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f73:	c9                   	leave
+  801f74:	c3                   	ret
+
+0000000000801f75 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f75:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f78:	74 10                	je     801f8a <strlen+0x15>
+    size_t n = 0;
+  801f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801f7f:	48 83 c0 01          	add    $0x1,%rax
+  801f83:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801f87:	75 f6                	jne    801f7f <strlen+0xa>
+  801f89:	c3                   	ret
+    size_t n = 0;
+  801f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801f8f:	c3                   	ret
+
+0000000000801f90 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801f90:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801f93:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801f98:	48 85 f6             	test   %rsi,%rsi
+  801f9b:	74 11                	je     801fae <strnlen+0x1e>
+  801f9d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fa1:	74 0c                	je     801faf <strnlen+0x1f>
+  801fa3:	48 83 c2 01          	add    $0x1,%rdx
+  801fa7:	48 39 d0             	cmp    %rdx,%rax
+  801faa:	75 f1                	jne    801f9d <strnlen+0xd>
+  801fac:	eb 04                	jmp    801fb2 <strnlen+0x22>
+  801fae:	c3                   	ret
+  801faf:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fb2:	c3                   	ret
+
+0000000000801fb3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fb3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fbf:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fc2:	48 83 c2 01          	add    $0x1,%rdx
+  801fc6:	84 c9                	test   %cl,%cl
+  801fc8:	75 f1                	jne    801fbb <strcpy+0x8>
+        ;
+    return res;
+}
+  801fca:	c3                   	ret
+
+0000000000801fcb <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fcb:	55                   	push   %rbp
+  801fcc:	48 89 e5             	mov    %rsp,%rbp
+  801fcf:	41 54                	push   %r12
+  801fd1:	53                   	push   %rbx
+  801fd2:	48 89 fb             	mov    %rdi,%rbx
+  801fd5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801fd8:	48 b8 75 1f 80 00 00 	movabs $0x801f75,%rax
+  801fdf:	00 00 00 
+  801fe2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801fe4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801fe8:	4c 89 e6             	mov    %r12,%rsi
+  801feb:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  801ff2:	00 00 00 
+  801ff5:	ff d0                	call   *%rax
+    return dst;
+}
+  801ff7:	48 89 d8             	mov    %rbx,%rax
+  801ffa:	5b                   	pop    %rbx
+  801ffb:	41 5c                	pop    %r12
+  801ffd:	5d                   	pop    %rbp
+  801ffe:	c3                   	ret
+
+0000000000801fff <toupper>:
+
+int
+toupper(int ch) {
+  801fff:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802001:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802004:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802007:	83 f9 1a             	cmp    $0x1a,%ecx
+  80200a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80200d:	c3                   	ret
+
+000000000080200e <tolower>:
+
+int
+tolower(int ch) {
+  80200e:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802010:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802013:	8d 57 20             	lea    0x20(%rdi),%edx
+  802016:	83 f9 1a             	cmp    $0x1a,%ecx
+  802019:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80201c:	c3                   	ret
+
+000000000080201d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80201d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802020:	48 85 d2             	test   %rdx,%rdx
+  802023:	74 1f                	je     802044 <strncpy+0x27>
+  802025:	48 01 fa             	add    %rdi,%rdx
+  802028:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80202b:	48 83 c1 01          	add    $0x1,%rcx
+  80202f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802033:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802037:	41 80 f8 01          	cmp    $0x1,%r8b
+  80203b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80203f:	48 39 ca             	cmp    %rcx,%rdx
+  802042:	75 e7                	jne    80202b <strncpy+0xe>
+    }
+    return ret;
+}
+  802044:	c3                   	ret
+
+0000000000802045 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802045:	48 89 f8             	mov    %rdi,%rax
+  802048:	48 85 d2             	test   %rdx,%rdx
+  80204b:	74 24                	je     802071 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80204d:	48 83 ea 01          	sub    $0x1,%rdx
+  802051:	74 1b                	je     80206e <strlcpy+0x29>
+  802053:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802057:	0f b6 16             	movzbl (%rsi),%edx
+  80205a:	84 d2                	test   %dl,%dl
+  80205c:	74 10                	je     80206e <strlcpy+0x29>
+            *dst++ = *src++;
+  80205e:	48 83 c6 01          	add    $0x1,%rsi
+  802062:	48 83 c0 01          	add    $0x1,%rax
+  802066:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802069:	48 39 c8             	cmp    %rcx,%rax
+  80206c:	75 e9                	jne    802057 <strlcpy+0x12>
+        *dst = '\0';
+  80206e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802071:	48 29 f8             	sub    %rdi,%rax
+}
+  802074:	c3                   	ret
+
+0000000000802075 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802075:	0f b6 07             	movzbl (%rdi),%eax
+  802078:	84 c0                	test   %al,%al
+  80207a:	74 13                	je     80208f <strcmp+0x1a>
+  80207c:	38 06                	cmp    %al,(%rsi)
+  80207e:	75 0f                	jne    80208f <strcmp+0x1a>
+  802080:	48 83 c7 01          	add    $0x1,%rdi
+  802084:	48 83 c6 01          	add    $0x1,%rsi
+  802088:	0f b6 07             	movzbl (%rdi),%eax
+  80208b:	84 c0                	test   %al,%al
+  80208d:	75 ed                	jne    80207c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80208f:	0f b6 c0             	movzbl %al,%eax
+  802092:	0f b6 16             	movzbl (%rsi),%edx
+  802095:	29 d0                	sub    %edx,%eax
+}
+  802097:	c3                   	ret
+
+0000000000802098 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802098:	48 85 d2             	test   %rdx,%rdx
+  80209b:	74 1f                	je     8020bc <strncmp+0x24>
+  80209d:	0f b6 07             	movzbl (%rdi),%eax
+  8020a0:	84 c0                	test   %al,%al
+  8020a2:	74 1e                	je     8020c2 <strncmp+0x2a>
+  8020a4:	3a 06                	cmp    (%rsi),%al
+  8020a6:	75 1a                	jne    8020c2 <strncmp+0x2a>
+  8020a8:	48 83 c7 01          	add    $0x1,%rdi
+  8020ac:	48 83 c6 01          	add    $0x1,%rsi
+  8020b0:	48 83 ea 01          	sub    $0x1,%rdx
+  8020b4:	75 e7                	jne    80209d <strncmp+0x5>
+
+    if (!n) return 0;
+  8020b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bb:	c3                   	ret
+  8020bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c1:	c3                   	ret
+  8020c2:	48 85 d2             	test   %rdx,%rdx
+  8020c5:	74 09                	je     8020d0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020c7:	0f b6 07             	movzbl (%rdi),%eax
+  8020ca:	0f b6 16             	movzbl (%rsi),%edx
+  8020cd:	29 d0                	sub    %edx,%eax
+  8020cf:	c3                   	ret
+    if (!n) return 0;
+  8020d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d5:	c3                   	ret
+
+00000000008020d6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020d6:	0f b6 17             	movzbl (%rdi),%edx
+  8020d9:	84 d2                	test   %dl,%dl
+  8020db:	74 18                	je     8020f5 <strchr+0x1f>
+        if (*str == c) {
+  8020dd:	0f be d2             	movsbl %dl,%edx
+  8020e0:	39 f2                	cmp    %esi,%edx
+  8020e2:	74 17                	je     8020fb <strchr+0x25>
+    for (; *str; str++) {
+  8020e4:	48 83 c7 01          	add    $0x1,%rdi
+  8020e8:	0f b6 17             	movzbl (%rdi),%edx
+  8020eb:	84 d2                	test   %dl,%dl
+  8020ed:	75 ee                	jne    8020dd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f4:	c3                   	ret
+  8020f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fa:	c3                   	ret
+  8020fb:	48 89 f8             	mov    %rdi,%rax
+}
+  8020fe:	c3                   	ret
+
+00000000008020ff <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8020ff:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802102:	0f b6 17             	movzbl (%rdi),%edx
+  802105:	84 d2                	test   %dl,%dl
+  802107:	74 13                	je     80211c <strfind+0x1d>
+  802109:	0f be d2             	movsbl %dl,%edx
+  80210c:	39 f2                	cmp    %esi,%edx
+  80210e:	74 0b                	je     80211b <strfind+0x1c>
+  802110:	48 83 c0 01          	add    $0x1,%rax
+  802114:	0f b6 10             	movzbl (%rax),%edx
+  802117:	84 d2                	test   %dl,%dl
+  802119:	75 ee                	jne    802109 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80211b:	c3                   	ret
+  80211c:	c3                   	ret
+
+000000000080211d <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80211d:	48 39 f7             	cmp    %rsi,%rdi
+  802120:	74 65                	je     802187 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802122:	55                   	push   %rbp
+  802123:	48 89 e5             	mov    %rsp,%rbp
+  802126:	41 57                	push   %r15
+  802128:	41 56                	push   %r14
+  80212a:	41 55                	push   %r13
+  80212c:	41 54                	push   %r12
+  80212e:	53                   	push   %rbx
+  80212f:	48 83 ec 18          	sub    $0x18,%rsp
+  802133:	48 89 fb             	mov    %rdi,%rbx
+  802136:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802139:	49 bf 0e 20 80 00 00 	movabs $0x80200e,%r15
+  802140:	00 00 00 
+  802143:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802147:	41 0f b6 fd          	movzbl %r13b,%edi
+  80214b:	41 ff d7             	call   *%r15
+  80214e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802151:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802156:	41 0f b6 fe          	movzbl %r14b,%edi
+  80215a:	41 ff d7             	call   *%r15
+  80215d:	89 c2                	mov    %eax,%edx
+  80215f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802162:	29 d0                	sub    %edx,%eax
+  802164:	75 12                	jne    802178 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802166:	48 83 c3 01          	add    $0x1,%rbx
+  80216a:	45 84 ed             	test   %r13b,%r13b
+  80216d:	74 09                	je     802178 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80216f:	49 83 c4 01          	add    $0x1,%r12
+  802173:	45 84 f6             	test   %r14b,%r14b
+  802176:	75 cb                	jne    802143 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802178:	48 83 c4 18          	add    $0x18,%rsp
+  80217c:	5b                   	pop    %rbx
+  80217d:	41 5c                	pop    %r12
+  80217f:	41 5d                	pop    %r13
+  802181:	41 5e                	pop    %r14
+  802183:	41 5f                	pop    %r15
+  802185:	5d                   	pop    %rbp
+  802186:	c3                   	ret
+    if (p1 == p2) return 0;
+  802187:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80218c:	c3                   	ret
+
+000000000080218d <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80218d:	48 39 f7             	cmp    %rsi,%rdi
+  802190:	74 7d                	je     80220f <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802192:	55                   	push   %rbp
+  802193:	48 89 e5             	mov    %rsp,%rbp
+  802196:	41 57                	push   %r15
+  802198:	41 56                	push   %r14
+  80219a:	41 55                	push   %r13
+  80219c:	41 54                	push   %r12
+  80219e:	53                   	push   %rbx
+  80219f:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a3:	48 89 fb             	mov    %rdi,%rbx
+  8021a6:	49 89 f4             	mov    %rsi,%r12
+  8021a9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021b1:	49 bf 0e 20 80 00 00 	movabs $0x80200e,%r15
+  8021b8:	00 00 00 
+    while (n--) {
+  8021bb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021bf:	48 39 c3             	cmp    %rax,%rbx
+  8021c2:	74 37                	je     8021fb <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021c4:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021c8:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021cc:	41 ff d7             	call   *%r15
+  8021cf:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021d2:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021d7:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021db:	41 ff d7             	call   *%r15
+  8021de:	89 c2                	mov    %eax,%edx
+  8021e0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021e3:	29 d0                	sub    %edx,%eax
+  8021e5:	75 19                	jne    802200 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8021e7:	48 83 c3 01          	add    $0x1,%rbx
+  8021eb:	45 84 ed             	test   %r13b,%r13b
+  8021ee:	74 10                	je     802200 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8021f0:	49 83 c4 01          	add    $0x1,%r12
+  8021f4:	45 84 f6             	test   %r14b,%r14b
+  8021f7:	75 c2                	jne    8021bb <strncasecmp+0x2e>
+  8021f9:	eb 05                	jmp    802200 <strncasecmp+0x73>
+  8021fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802200:	48 83 c4 18          	add    $0x18,%rsp
+  802204:	5b                   	pop    %rbx
+  802205:	41 5c                	pop    %r12
+  802207:	41 5d                	pop    %r13
+  802209:	41 5e                	pop    %r14
+  80220b:	41 5f                	pop    %r15
+  80220d:	5d                   	pop    %rbp
+  80220e:	c3                   	ret
+    if (p1 == p2) return 0;
+  80220f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802214:	c3                   	ret
+
+0000000000802215 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802215:	83 e7 df             	and    $0xffffffdf,%edi
+  802218:	83 ef 41             	sub    $0x41,%edi
+  80221b:	83 ff 19             	cmp    $0x19,%edi
+  80221e:	0f 96 c0             	setbe  %al
+}
+  802221:	c3                   	ret
+
+0000000000802222 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802222:	83 ff 20             	cmp    $0x20,%edi
+  802225:	0f 94 c0             	sete   %al
+  802228:	83 ff 09             	cmp    $0x9,%edi
+  80222b:	0f 94 c2             	sete   %dl
+  80222e:	09 d0                	or     %edx,%eax
+}
+  802230:	c3                   	ret
+
+0000000000802231 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802231:	55                   	push   %rbp
+  802232:	48 89 e5             	mov    %rsp,%rbp
+  802235:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802237:	48 bf 1f 61 80 00 00 	movabs $0x80611f,%rdi
+  80223e:	00 00 00 
+  802241:	48 b8 d6 20 80 00 00 	movabs $0x8020d6,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+  80224d:	48 85 c0             	test   %rax,%rax
+  802250:	0f 95 c0             	setne  %al
+}
+  802253:	5d                   	pop    %rbp
+  802254:	c3                   	ret
+
+0000000000802255 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802255:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802258:	48 89 f8             	mov    %rdi,%rax
+  80225b:	48 f7 d8             	neg    %rax
+  80225e:	83 e0 07             	and    $0x7,%eax
+  802261:	49 89 d1             	mov    %rdx,%r9
+  802264:	49 29 c1             	sub    %rax,%r9
+  802267:	78 36                	js     80229f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802269:	40 0f b6 c6          	movzbl %sil,%eax
+  80226d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802274:	01 01 01 
+  802277:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80227b:	40 f6 c7 07          	test   $0x7,%dil
+  80227f:	75 38                	jne    8022b9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802281:	4c 89 c9             	mov    %r9,%rcx
+  802284:	48 c1 f9 03          	sar    $0x3,%rcx
+  802288:	74 0c                	je     802296 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80228a:	fc                   	cld
+  80228b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80228e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802292:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802296:	4d 85 c9             	test   %r9,%r9
+  802299:	75 45                	jne    8022e0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80229b:	4c 89 c0             	mov    %r8,%rax
+  80229e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80229f:	48 85 d2             	test   %rdx,%rdx
+  8022a2:	74 f7                	je     80229b <memset+0x46>
+  8022a4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022a7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022aa:	48 83 c0 01          	add    $0x1,%rax
+  8022ae:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022b2:	48 39 c2             	cmp    %rax,%rdx
+  8022b5:	75 f3                	jne    8022aa <memset+0x55>
+  8022b7:	eb e2                	jmp    80229b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022b9:	40 f6 c7 01          	test   $0x1,%dil
+  8022bd:	74 06                	je     8022c5 <memset+0x70>
+  8022bf:	88 07                	mov    %al,(%rdi)
+  8022c1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022c5:	40 f6 c7 02          	test   $0x2,%dil
+  8022c9:	74 07                	je     8022d2 <memset+0x7d>
+  8022cb:	66 89 07             	mov    %ax,(%rdi)
+  8022ce:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022d2:	40 f6 c7 04          	test   $0x4,%dil
+  8022d6:	74 a9                	je     802281 <memset+0x2c>
+  8022d8:	89 07                	mov    %eax,(%rdi)
+  8022da:	48 83 c7 04          	add    $0x4,%rdi
+  8022de:	eb a1                	jmp    802281 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022e0:	41 f6 c1 04          	test   $0x4,%r9b
+  8022e4:	74 06                	je     8022ec <memset+0x97>
+  8022e6:	89 07                	mov    %eax,(%rdi)
+  8022e8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022ec:	41 f6 c1 02          	test   $0x2,%r9b
+  8022f0:	74 07                	je     8022f9 <memset+0xa4>
+  8022f2:	66 89 07             	mov    %ax,(%rdi)
+  8022f5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8022f9:	41 f6 c1 01          	test   $0x1,%r9b
+  8022fd:	74 9c                	je     80229b <memset+0x46>
+  8022ff:	88 07                	mov    %al,(%rdi)
+  802301:	eb 98                	jmp    80229b <memset+0x46>
+
+0000000000802303 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802303:	48 89 f8             	mov    %rdi,%rax
+  802306:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802309:	48 39 fe             	cmp    %rdi,%rsi
+  80230c:	73 3b                	jae    802349 <memmove+0x46>
+  80230e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802312:	48 39 d7             	cmp    %rdx,%rdi
+  802315:	73 32                	jae    802349 <memmove+0x46>
+        s += n;
+        d += n;
+  802317:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80231b:	48 89 d6             	mov    %rdx,%rsi
+  80231e:	48 09 fe             	or     %rdi,%rsi
+  802321:	48 09 ce             	or     %rcx,%rsi
+  802324:	40 f6 c6 07          	test   $0x7,%sil
+  802328:	75 12                	jne    80233c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80232a:	48 83 ef 08          	sub    $0x8,%rdi
+  80232e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802332:	48 c1 e9 03          	shr    $0x3,%rcx
+  802336:	fd                   	std
+  802337:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80233a:	fc                   	cld
+  80233b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80233c:	48 83 ef 01          	sub    $0x1,%rdi
+  802340:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802344:	fd                   	std
+  802345:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802347:	eb f1                	jmp    80233a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802349:	48 89 f2             	mov    %rsi,%rdx
+  80234c:	48 09 c2             	or     %rax,%rdx
+  80234f:	48 09 ca             	or     %rcx,%rdx
+  802352:	f6 c2 07             	test   $0x7,%dl
+  802355:	75 0c                	jne    802363 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802357:	48 c1 e9 03          	shr    $0x3,%rcx
+  80235b:	48 89 c7             	mov    %rax,%rdi
+  80235e:	fc                   	cld
+  80235f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802362:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802363:	48 89 c7             	mov    %rax,%rdi
+  802366:	fc                   	cld
+  802367:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802369:	c3                   	ret
+
+000000000080236a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80236a:	55                   	push   %rbp
+  80236b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80236e:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+}
+  80237a:	5d                   	pop    %rbp
+  80237b:	c3                   	ret
+
+000000000080237c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80237c:	55                   	push   %rbp
+  80237d:	48 89 e5             	mov    %rsp,%rbp
+  802380:	41 57                	push   %r15
+  802382:	41 56                	push   %r14
+  802384:	41 55                	push   %r13
+  802386:	41 54                	push   %r12
+  802388:	53                   	push   %rbx
+  802389:	48 83 ec 08          	sub    $0x8,%rsp
+  80238d:	49 89 fe             	mov    %rdi,%r14
+  802390:	49 89 f7             	mov    %rsi,%r15
+  802393:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802396:	48 89 f7             	mov    %rsi,%rdi
+  802399:	48 b8 75 1f 80 00 00 	movabs $0x801f75,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+  8023a5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023a8:	48 89 de             	mov    %rbx,%rsi
+  8023ab:	4c 89 f7             	mov    %r14,%rdi
+  8023ae:	48 b8 90 1f 80 00 00 	movabs $0x801f90,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+  8023ba:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023bd:	48 39 c3             	cmp    %rax,%rbx
+  8023c0:	74 36                	je     8023f8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023c2:	48 89 d8             	mov    %rbx,%rax
+  8023c5:	4c 29 e8             	sub    %r13,%rax
+  8023c8:	49 39 c4             	cmp    %rax,%r12
+  8023cb:	73 31                	jae    8023fe <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023cd:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023d2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023d6:	4c 89 fe             	mov    %r15,%rsi
+  8023d9:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8023e5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8023e9:	48 83 c4 08          	add    $0x8,%rsp
+  8023ed:	5b                   	pop    %rbx
+  8023ee:	41 5c                	pop    %r12
+  8023f0:	41 5d                	pop    %r13
+  8023f2:	41 5e                	pop    %r14
+  8023f4:	41 5f                	pop    %r15
+  8023f6:	5d                   	pop    %rbp
+  8023f7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023f8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8023fc:	eb eb                	jmp    8023e9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8023fe:	48 83 eb 01          	sub    $0x1,%rbx
+  802402:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802406:	48 89 da             	mov    %rbx,%rdx
+  802409:	4c 89 fe             	mov    %r15,%rsi
+  80240c:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  802413:	00 00 00 
+  802416:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802418:	49 01 de             	add    %rbx,%r14
+  80241b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802420:	eb c3                	jmp    8023e5 <strlcat+0x69>
+
+0000000000802422 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802422:	48 85 d2             	test   %rdx,%rdx
+  802425:	74 2d                	je     802454 <memcmp+0x32>
+  802427:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80242c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802430:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802435:	44 38 c1             	cmp    %r8b,%cl
+  802438:	75 0f                	jne    802449 <memcmp+0x27>
+    while (n-- > 0) {
+  80243a:	48 83 c0 01          	add    $0x1,%rax
+  80243e:	48 39 c2             	cmp    %rax,%rdx
+  802441:	75 e9                	jne    80242c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802443:	b8 00 00 00 00       	mov    $0x0,%eax
+  802448:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802449:	0f b6 c1             	movzbl %cl,%eax
+  80244c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802450:	44 29 c0             	sub    %r8d,%eax
+  802453:	c3                   	ret
+    return 0;
+  802454:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802459:	c3                   	ret
+
+000000000080245a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80245a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80245e:	48 39 c7             	cmp    %rax,%rdi
+  802461:	73 0f                	jae    802472 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802463:	40 38 37             	cmp    %sil,(%rdi)
+  802466:	74 0e                	je     802476 <memfind+0x1c>
+    for (; src < end; src++) {
+  802468:	48 83 c7 01          	add    $0x1,%rdi
+  80246c:	48 39 f8             	cmp    %rdi,%rax
+  80246f:	75 f2                	jne    802463 <memfind+0x9>
+  802471:	c3                   	ret
+  802472:	48 89 f8             	mov    %rdi,%rax
+  802475:	c3                   	ret
+  802476:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802479:	c3                   	ret
+
+000000000080247a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80247a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80247d:	0f b6 37             	movzbl (%rdi),%esi
+  802480:	40 80 fe 20          	cmp    $0x20,%sil
+  802484:	74 06                	je     80248c <strtol+0x12>
+  802486:	40 80 fe 09          	cmp    $0x9,%sil
+  80248a:	75 13                	jne    80249f <strtol+0x25>
+  80248c:	48 83 c7 01          	add    $0x1,%rdi
+  802490:	0f b6 37             	movzbl (%rdi),%esi
+  802493:	40 80 fe 20          	cmp    $0x20,%sil
+  802497:	74 f3                	je     80248c <strtol+0x12>
+  802499:	40 80 fe 09          	cmp    $0x9,%sil
+  80249d:	74 ed                	je     80248c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80249f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024a2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024a5:	3c 01                	cmp    $0x1,%al
+  8024a7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024ab:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024b1:	75 0f                	jne    8024c2 <strtol+0x48>
+  8024b3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024b6:	74 14                	je     8024cc <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024b8:	85 d2                	test   %edx,%edx
+  8024ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024bf:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024c2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024c7:	4c 63 ca             	movslq %edx,%r9
+  8024ca:	eb 36                	jmp    802502 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024cc:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024d0:	74 0f                	je     8024e1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024d2:	85 d2                	test   %edx,%edx
+  8024d4:	75 ec                	jne    8024c2 <strtol+0x48>
+        s++;
+  8024d6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024da:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8024df:	eb e1                	jmp    8024c2 <strtol+0x48>
+        s += 2;
+  8024e1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8024e5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8024ea:	eb d6                	jmp    8024c2 <strtol+0x48>
+            dig -= '0';
+  8024ec:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8024ef:	44 0f b6 c1          	movzbl %cl,%r8d
+  8024f3:	41 39 d0             	cmp    %edx,%r8d
+  8024f6:	7d 21                	jge    802519 <strtol+0x9f>
+        val = val * base + dig;
+  8024f8:	49 0f af c1          	imul   %r9,%rax
+  8024fc:	0f b6 c9             	movzbl %cl,%ecx
+  8024ff:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802502:	48 83 c7 01          	add    $0x1,%rdi
+  802506:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80250a:	80 f9 39             	cmp    $0x39,%cl
+  80250d:	76 dd                	jbe    8024ec <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80250f:	80 f9 7b             	cmp    $0x7b,%cl
+  802512:	77 05                	ja     802519 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802514:	83 e9 57             	sub    $0x57,%ecx
+  802517:	eb d6                	jmp    8024ef <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802519:	4d 85 d2             	test   %r10,%r10
+  80251c:	74 03                	je     802521 <strtol+0xa7>
+  80251e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802521:	48 89 c2             	mov    %rax,%rdx
+  802524:	48 f7 da             	neg    %rdx
+  802527:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80252b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80252f:	c3                   	ret
+
+0000000000802530 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802530:	55                   	push   %rbp
+  802531:	48 89 e5             	mov    %rsp,%rbp
+  802534:	53                   	push   %rbx
+  802535:	48 89 fa             	mov    %rdi,%rdx
+  802538:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80253b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802540:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802545:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80254a:	be 00 00 00 00       	mov    $0x0,%esi
+  80254f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802555:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80255b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80255d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802561:	c9                   	leave
+  802562:	c3                   	ret
+
+0000000000802563 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802563:	55                   	push   %rbp
+  802564:	48 89 e5             	mov    %rsp,%rbp
+  802567:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802568:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80256d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802572:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802577:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80257c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802581:	be 00 00 00 00       	mov    $0x0,%esi
+  802586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80258c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802592:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802594:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802598:	c9                   	leave
+  802599:	c3                   	ret
+
+000000000080259a <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80259a:	55                   	push   %rbp
+  80259b:	48 89 e5             	mov    %rsp,%rbp
+  80259e:	53                   	push   %rbx
+  80259f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025a2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025c7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025cd:	c9                   	leave
+  8025ce:	c3                   	ret
+
+00000000008025cf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025cf:	55                   	push   %rbp
+  8025d0:	48 89 e5             	mov    %rsp,%rbp
+  8025d3:	53                   	push   %rbx
+  8025d4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025d8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025db:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802600:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802602:	48 85 c0             	test   %rax,%rax
+  802605:	7f 06                	jg     80260d <sys_env_destroy+0x3e>
+}
+  802607:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80260b:	c9                   	leave
+  80260c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80260d:	49 89 c0             	mov    %rax,%r8
+  802610:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802615:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80261c:	00 00 00 
+  80261f:	be 27 00 00 00       	mov    $0x27,%esi
+  802624:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80262b:	00 00 00 
+  80262e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802633:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  80263a:	00 00 00 
+  80263d:	41 ff d1             	call   *%r9
+
+0000000000802640 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802640:	55                   	push   %rbp
+  802641:	48 89 e5             	mov    %rsp,%rbp
+  802644:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802645:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80264a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802659:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80265e:	be 00 00 00 00       	mov    $0x0,%esi
+  802663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802669:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80266f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802671:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802675:	c9                   	leave
+  802676:	c3                   	ret
+
+0000000000802677 <sys_yield>:
+
+void
+sys_yield(void) {
+  802677:	55                   	push   %rbp
+  802678:	48 89 e5             	mov    %rsp,%rbp
+  80267b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80267c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802681:	ba 00 00 00 00       	mov    $0x0,%edx
+  802686:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80268b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802690:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802695:	be 00 00 00 00       	mov    $0x0,%esi
+  80269a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026a6:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ac:	c9                   	leave
+  8026ad:	c3                   	ret
+
+00000000008026ae <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026ae:	55                   	push   %rbp
+  8026af:	48 89 e5             	mov    %rsp,%rbp
+  8026b2:	53                   	push   %rbx
+  8026b3:	48 89 fa             	mov    %rdi,%rdx
+  8026b6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026b9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026be:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026c5:	00 00 00 
+  8026c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026de:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8026e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e4:	c9                   	leave
+  8026e5:	c3                   	ret
+
+00000000008026e6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8026e6:	55                   	push   %rbp
+  8026e7:	48 89 e5             	mov    %rsp,%rbp
+  8026ea:	53                   	push   %rbx
+  8026eb:	49 89 f8             	mov    %rdi,%r8
+  8026ee:	48 89 d3             	mov    %rdx,%rbx
+  8026f1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8026f4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026f9:	4c 89 c2             	mov    %r8,%rdx
+  8026fc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802704:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80270a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802710:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802712:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802716:	c9                   	leave
+  802717:	c3                   	ret
+
+0000000000802718 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802718:	55                   	push   %rbp
+  802719:	48 89 e5             	mov    %rsp,%rbp
+  80271c:	53                   	push   %rbx
+  80271d:	48 83 ec 08          	sub    $0x8,%rsp
+  802721:	89 f8                	mov    %edi,%eax
+  802723:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802726:	48 63 f9             	movslq %ecx,%rdi
+  802729:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80272c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802731:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802734:	be 00 00 00 00       	mov    $0x0,%esi
+  802739:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80273f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802745:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802747:	48 85 c0             	test   %rax,%rax
+  80274a:	7f 06                	jg     802752 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80274c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802752:	49 89 c0             	mov    %rax,%r8
+  802755:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80275a:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802761:	00 00 00 
+  802764:	be 27 00 00 00       	mov    $0x27,%esi
+  802769:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802770:	00 00 00 
+  802773:	b8 00 00 00 00       	mov    $0x0,%eax
+  802778:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  80277f:	00 00 00 
+  802782:	41 ff d1             	call   *%r9
+
+0000000000802785 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802785:	55                   	push   %rbp
+  802786:	48 89 e5             	mov    %rsp,%rbp
+  802789:	53                   	push   %rbx
+  80278a:	48 83 ec 08          	sub    $0x8,%rsp
+  80278e:	89 f8                	mov    %edi,%eax
+  802790:	49 89 f2             	mov    %rsi,%r10
+  802793:	48 89 cf             	mov    %rcx,%rdi
+  802796:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802799:	48 63 da             	movslq %edx,%rbx
+  80279c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80279f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027a4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027a7:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027b2:	48 85 c0             	test   %rax,%rax
+  8027b5:	7f 06                	jg     8027bd <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027bb:	c9                   	leave
+  8027bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027bd:	49 89 c0             	mov    %rax,%r8
+  8027c0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027c5:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8027cc:	00 00 00 
+  8027cf:	be 27 00 00 00       	mov    $0x27,%esi
+  8027d4:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8027db:	00 00 00 
+  8027de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e3:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  8027ea:	00 00 00 
+  8027ed:	41 ff d1             	call   *%r9
+
+00000000008027f0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8027f0:	55                   	push   %rbp
+  8027f1:	48 89 e5             	mov    %rsp,%rbp
+  8027f4:	53                   	push   %rbx
+  8027f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f9:	48 89 f1             	mov    %rsi,%rcx
+  8027fc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8027ff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802802:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802807:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80280c:	be 00 00 00 00       	mov    $0x0,%esi
+  802811:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802817:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80281d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80281f:	48 85 c0             	test   %rax,%rax
+  802822:	7f 06                	jg     80282a <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802824:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802828:	c9                   	leave
+  802829:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80282a:	49 89 c0             	mov    %rax,%r8
+  80282d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802832:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802839:	00 00 00 
+  80283c:	be 27 00 00 00       	mov    $0x27,%esi
+  802841:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802848:	00 00 00 
+  80284b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802850:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802857:	00 00 00 
+  80285a:	41 ff d1             	call   *%r9
+
+000000000080285d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80285d:	55                   	push   %rbp
+  80285e:	48 89 e5             	mov    %rsp,%rbp
+  802861:	53                   	push   %rbx
+  802862:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802866:	48 63 ce             	movslq %esi,%rcx
+  802869:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80286c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802871:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802876:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80287b:	be 00 00 00 00       	mov    $0x0,%esi
+  802880:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802886:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80288c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80288e:	48 85 c0             	test   %rax,%rax
+  802891:	7f 06                	jg     802899 <sys_env_set_status+0x3c>
+}
+  802893:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802897:	c9                   	leave
+  802898:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802899:	49 89 c0             	mov    %rax,%r8
+  80289c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028a1:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8028a8:	00 00 00 
+  8028ab:	be 27 00 00 00       	mov    $0x27,%esi
+  8028b0:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8028b7:	00 00 00 
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bf:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  8028c6:	00 00 00 
+  8028c9:	41 ff d1             	call   *%r9
+
+00000000008028cc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028cc:	55                   	push   %rbp
+  8028cd:	48 89 e5             	mov    %rsp,%rbp
+  8028d0:	53                   	push   %rbx
+  8028d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028d8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028db:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028fd:	48 85 c0             	test   %rax,%rax
+  802900:	7f 06                	jg     802908 <sys_env_set_trapframe+0x3c>
+}
+  802902:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802906:	c9                   	leave
+  802907:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802908:	49 89 c0             	mov    %rax,%r8
+  80290b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802910:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802917:	00 00 00 
+  80291a:	be 27 00 00 00       	mov    $0x27,%esi
+  80291f:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802926:	00 00 00 
+  802929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292e:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802935:	00 00 00 
+  802938:	41 ff d1             	call   *%r9
+
+000000000080293b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80293b:	55                   	push   %rbp
+  80293c:	48 89 e5             	mov    %rsp,%rbp
+  80293f:	53                   	push   %rbx
+  802940:	48 83 ec 08          	sub    $0x8,%rsp
+  802944:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802947:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80294a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80294f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802954:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802959:	be 00 00 00 00       	mov    $0x0,%esi
+  80295e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802964:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80296a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80296c:	48 85 c0             	test   %rax,%rax
+  80296f:	7f 06                	jg     802977 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802971:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802977:	49 89 c0             	mov    %rax,%r8
+  80297a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80297f:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802986:	00 00 00 
+  802989:	be 27 00 00 00       	mov    $0x27,%esi
+  80298e:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802995:	00 00 00 
+  802998:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299d:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  8029a4:	00 00 00 
+  8029a7:	41 ff d1             	call   *%r9
+
+00000000008029aa <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029aa:	55                   	push   %rbp
+  8029ab:	48 89 e5             	mov    %rsp,%rbp
+  8029ae:	53                   	push   %rbx
+  8029af:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029b3:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029b7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029ba:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029dc:	48 85 c0             	test   %rax,%rax
+  8029df:	7f 06                	jg     8029e7 <sys_env_set_reclaim+0x3d>
+}
+  8029e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e7:	49 89 c0             	mov    %rax,%r8
+  8029ea:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8029ef:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8029f6:	00 00 00 
+  8029f9:	be 27 00 00 00       	mov    $0x27,%esi
+  8029fe:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a05:	00 00 00 
+  802a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0d:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802a14:	00 00 00 
+  802a17:	41 ff d1             	call   *%r9
+
+0000000000802a1a <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a1a:	55                   	push   %rbp
+  802a1b:	48 89 e5             	mov    %rsp,%rbp
+  802a1e:	53                   	push   %rbx
+  802a1f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a23:	48 63 ce             	movslq %esi,%rcx
+  802a26:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a29:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a33:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a38:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a43:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a49:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a4b:	48 85 c0             	test   %rax,%rax
+  802a4e:	7f 06                	jg     802a56 <sys_env_set_nice+0x3c>
+}
+  802a50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a54:	c9                   	leave
+  802a55:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a56:	49 89 c0             	mov    %rax,%r8
+  802a59:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a5e:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802a65:	00 00 00 
+  802a68:	be 27 00 00 00       	mov    $0x27,%esi
+  802a6d:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a74:	00 00 00 
+  802a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7c:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802a83:	00 00 00 
+  802a86:	41 ff d1             	call   *%r9
+
+0000000000802a89 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802a89:	55                   	push   %rbp
+  802a8a:	48 89 e5             	mov    %rsp,%rbp
+  802a8d:	53                   	push   %rbx
+  802a8e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a91:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aaa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab6:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ab8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802abc:	c9                   	leave
+  802abd:	c3                   	ret
+
+0000000000802abe <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802abe:	55                   	push   %rbp
+  802abf:	48 89 e5             	mov    %rsp,%rbp
+  802ac2:	53                   	push   %rbx
+  802ac3:	89 f8                	mov    %edi,%eax
+  802ac5:	49 89 f1             	mov    %rsi,%r9
+  802ac8:	48 89 d3             	mov    %rdx,%rbx
+  802acb:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ace:	49 63 f0             	movslq %r8d,%rsi
+  802ad1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ad4:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ad9:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802adc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ae8:	cd 30                	int    $0x30
+}
+  802aea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aee:	c9                   	leave
+  802aef:	c3                   	ret
+
+0000000000802af0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802af0:	55                   	push   %rbp
+  802af1:	48 89 e5             	mov    %rsp,%rbp
+  802af4:	53                   	push   %rbx
+  802af5:	89 f8                	mov    %edi,%eax
+  802af7:	49 89 f1             	mov    %rsi,%r9
+  802afa:	48 89 d3             	mov    %rdx,%rbx
+  802afd:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b00:	49 63 f0             	movslq %r8d,%rsi
+  802b03:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b06:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b0b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b14:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1a:	cd 30                	int    $0x30
+}
+  802b1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b20:	c9                   	leave
+  802b21:	c3                   	ret
+
+0000000000802b22 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b22:	55                   	push   %rbp
+  802b23:	48 89 e5             	mov    %rsp,%rbp
+  802b26:	53                   	push   %rbx
+  802b27:	48 83 ec 08          	sub    $0x8,%rsp
+  802b2b:	89 f8                	mov    %edi,%eax
+  802b2d:	49 89 f2             	mov    %rsi,%r10
+  802b30:	48 89 d3             	mov    %rdx,%rbx
+  802b33:	48 89 cf             	mov    %rcx,%rdi
+  802b36:	44 89 c6             	mov    %r8d,%esi
+  802b39:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b3c:	48 63 f6             	movslq %esi,%rsi
+  802b3f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b42:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b47:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b4a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b4e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b50:	48 85 c0             	test   %rax,%rax
+  802b53:	7f 06                	jg     802b5b <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b59:	c9                   	leave
+  802b5a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b5b:	49 89 c0             	mov    %rax,%r8
+  802b5e:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b63:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802b6a:	00 00 00 
+  802b6d:	be 27 00 00 00       	mov    $0x27,%esi
+  802b72:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802b79:	00 00 00 
+  802b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b81:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802b88:	00 00 00 
+  802b8b:	41 ff d1             	call   *%r9
+
+0000000000802b8e <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+  802b92:	53                   	push   %rbx
+  802b93:	48 83 ec 08          	sub    $0x8,%rsp
+  802b97:	48 89 f1             	mov    %rsi,%rcx
+  802b9a:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802b9d:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802ba1:	48 8b 1a             	mov    (%rdx),%rbx
+  802ba4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ba7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bac:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bb0:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bb4:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bb8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bba:	48 85 c0             	test   %rax,%rax
+  802bbd:	7f 06                	jg     802bc5 <sys_ipc_call_short+0x37>
+}
+  802bbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bc3:	c9                   	leave
+  802bc4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bc5:	49 89 c0             	mov    %rax,%r8
+  802bc8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bcd:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802bd4:	00 00 00 
+  802bd7:	be 27 00 00 00       	mov    $0x27,%esi
+  802bdc:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802be3:	00 00 00 
+  802be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802beb:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802bf2:	00 00 00 
+  802bf5:	41 ff d1             	call   *%r9
+
+0000000000802bf8 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802bf8:	55                   	push   %rbp
+  802bf9:	48 89 e5             	mov    %rsp,%rbp
+  802bfc:	53                   	push   %rbx
+  802bfd:	48 83 ec 08          	sub    $0x8,%rsp
+  802c01:	89 f8                	mov    %edi,%eax
+  802c03:	49 89 f2             	mov    %rsi,%r10
+  802c06:	48 89 d3             	mov    %rdx,%rbx
+  802c09:	48 89 cf             	mov    %rcx,%rdi
+  802c0c:	44 89 c6             	mov    %r8d,%esi
+  802c0f:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c12:	48 63 f6             	movslq %esi,%rsi
+  802c15:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c18:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1d:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c20:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c24:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c26:	48 85 c0             	test   %rax,%rax
+  802c29:	7f 06                	jg     802c31 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c2f:	c9                   	leave
+  802c30:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c31:	49 89 c0             	mov    %rax,%r8
+  802c34:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c39:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802c40:	00 00 00 
+  802c43:	be 27 00 00 00       	mov    $0x27,%esi
+  802c48:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802c4f:	00 00 00 
+  802c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c57:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802c5e:	00 00 00 
+  802c61:	41 ff d1             	call   *%r9
+
+0000000000802c64 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c64:	55                   	push   %rbp
+  802c65:	48 89 e5             	mov    %rsp,%rbp
+  802c68:	53                   	push   %rbx
+  802c69:	48 83 ec 08          	sub    $0x8,%rsp
+  802c6d:	48 89 fa             	mov    %rdi,%rdx
+  802c70:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c73:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c7d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c82:	be 00 00 00 00       	mov    $0x0,%esi
+  802c87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c93:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c95:	48 85 c0             	test   %rax,%rax
+  802c98:	7f 06                	jg     802ca0 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c9e:	c9                   	leave
+  802c9f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ca0:	49 89 c0             	mov    %rax,%r8
+  802ca3:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ca8:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802caf:	00 00 00 
+  802cb2:	be 27 00 00 00       	mov    $0x27,%esi
+  802cb7:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802cbe:	00 00 00 
+  802cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc6:	49 b9 6a 50 80 00 00 	movabs $0x80506a,%r9
+  802ccd:	00 00 00 
+  802cd0:	41 ff d1             	call   *%r9
+
+0000000000802cd3 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cd3:	55                   	push   %rbp
+  802cd4:	48 89 e5             	mov    %rsp,%rbp
+  802cd7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cd8:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ce7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cf1:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cfc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d02:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d08:	c9                   	leave
+  802d09:	c3                   	ret
+
+0000000000802d0a <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d0a:	55                   	push   %rbp
+  802d0b:	48 89 e5             	mov    %rsp,%rbp
+  802d0e:	53                   	push   %rbx
+  802d0f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d12:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d17:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d21:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d26:	be 00 00 00 00       	mov    $0x0,%esi
+  802d2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d37:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3d:	c9                   	leave
+  802d3e:	c3                   	ret
+
+0000000000802d3f <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d3f:	55                   	push   %rbp
+  802d40:	48 89 e5             	mov    %rsp,%rbp
+  802d43:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d44:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d6e:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+0000000000802d76 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d76:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d7d:	ff ff ff 
+  802d80:	48 01 f8             	add    %rdi,%rax
+  802d83:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802d87:	c3                   	ret
+
+0000000000802d88 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d88:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d8f:	ff ff ff 
+  802d92:	48 01 f8             	add    %rdi,%rax
+  802d95:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802d99:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802d9f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802da3:	c3                   	ret
+
+0000000000802da4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802da4:	55                   	push   %rbp
+  802da5:	48 89 e5             	mov    %rsp,%rbp
+  802da8:	41 57                	push   %r15
+  802daa:	41 56                	push   %r14
+  802dac:	41 55                	push   %r13
+  802dae:	41 54                	push   %r12
+  802db0:	53                   	push   %rbx
+  802db1:	48 83 ec 08          	sub    $0x8,%rsp
+  802db5:	49 89 ff             	mov    %rdi,%r15
+  802db8:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802dbd:	49 bd a4 42 80 00 00 	movabs $0x8042a4,%r13
+  802dc4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802dc7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802dcd:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802dd0:	48 89 df             	mov    %rbx,%rdi
+  802dd3:	41 ff d5             	call   *%r13
+  802dd6:	83 e0 04             	and    $0x4,%eax
+  802dd9:	74 17                	je     802df2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802ddb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802de2:	4c 39 f3             	cmp    %r14,%rbx
+  802de5:	75 e6                	jne    802dcd <fd_alloc+0x29>
+  802de7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802ded:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802df2:	4d 89 27             	mov    %r12,(%r15)
+}
+  802df5:	48 83 c4 08          	add    $0x8,%rsp
+  802df9:	5b                   	pop    %rbx
+  802dfa:	41 5c                	pop    %r12
+  802dfc:	41 5d                	pop    %r13
+  802dfe:	41 5e                	pop    %r14
+  802e00:	41 5f                	pop    %r15
+  802e02:	5d                   	pop    %rbp
+  802e03:	c3                   	ret
+
+0000000000802e04 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e04:	83 ff 1f             	cmp    $0x1f,%edi
+  802e07:	77 39                	ja     802e42 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e09:	55                   	push   %rbp
+  802e0a:	48 89 e5             	mov    %rsp,%rbp
+  802e0d:	41 54                	push   %r12
+  802e0f:	53                   	push   %rbx
+  802e10:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e13:	48 63 df             	movslq %edi,%rbx
+  802e16:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e1d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e21:	48 89 df             	mov    %rbx,%rdi
+  802e24:	48 b8 a4 42 80 00 00 	movabs $0x8042a4,%rax
+  802e2b:	00 00 00 
+  802e2e:	ff d0                	call   *%rax
+  802e30:	a8 04                	test   $0x4,%al
+  802e32:	74 14                	je     802e48 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e34:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e3d:	5b                   	pop    %rbx
+  802e3e:	41 5c                	pop    %r12
+  802e40:	5d                   	pop    %rbp
+  802e41:	c3                   	ret
+        return -E_INVAL;
+  802e42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e47:	c3                   	ret
+        return -E_INVAL;
+  802e48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e4d:	eb ee                	jmp    802e3d <fd_lookup+0x39>
+
+0000000000802e4f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e4f:	55                   	push   %rbp
+  802e50:	48 89 e5             	mov    %rsp,%rbp
+  802e53:	41 54                	push   %r12
+  802e55:	53                   	push   %rbx
+  802e56:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e59:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802e60:	00 00 00 
+  802e63:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e6a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e6d:	39 3b                	cmp    %edi,(%rbx)
+  802e6f:	74 47                	je     802eb8 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e71:	48 83 c0 08          	add    $0x8,%rax
+  802e75:	48 8b 18             	mov    (%rax),%rbx
+  802e78:	48 85 db             	test   %rbx,%rbx
+  802e7b:	75 f0                	jne    802e6d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e7d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e84:	00 00 00 
+  802e87:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e8d:	89 fa                	mov    %edi,%edx
+  802e8f:	48 bf 58 61 80 00 00 	movabs $0x806158,%rdi
+  802e96:	00 00 00 
+  802e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9e:	48 b9 7c 16 80 00 00 	movabs $0x80167c,%rcx
+  802ea5:	00 00 00 
+  802ea8:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802eaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802eaf:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802eb3:	5b                   	pop    %rbx
+  802eb4:	41 5c                	pop    %r12
+  802eb6:	5d                   	pop    %rbp
+  802eb7:	c3                   	ret
+            return 0;
+  802eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebd:	eb f0                	jmp    802eaf <dev_lookup+0x60>
+
+0000000000802ebf <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ebf:	55                   	push   %rbp
+  802ec0:	48 89 e5             	mov    %rsp,%rbp
+  802ec3:	41 55                	push   %r13
+  802ec5:	41 54                	push   %r12
+  802ec7:	53                   	push   %rbx
+  802ec8:	48 83 ec 18          	sub    $0x18,%rsp
+  802ecc:	48 89 fb             	mov    %rdi,%rbx
+  802ecf:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ed2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802ed9:	ff ff ff 
+  802edc:	48 01 df             	add    %rbx,%rdi
+  802edf:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802ee3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ee7:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  802eee:	00 00 00 
+  802ef1:	ff d0                	call   *%rax
+  802ef3:	41 89 c5             	mov    %eax,%r13d
+  802ef6:	85 c0                	test   %eax,%eax
+  802ef8:	78 06                	js     802f00 <fd_close+0x41>
+  802efa:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802efe:	74 1a                	je     802f1a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f00:	45 84 e4             	test   %r12b,%r12b
+  802f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f08:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f0c:	44 89 e8             	mov    %r13d,%eax
+  802f0f:	48 83 c4 18          	add    $0x18,%rsp
+  802f13:	5b                   	pop    %rbx
+  802f14:	41 5c                	pop    %r12
+  802f16:	41 5d                	pop    %r13
+  802f18:	5d                   	pop    %rbp
+  802f19:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f1a:	8b 3b                	mov    (%rbx),%edi
+  802f1c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f20:	48 b8 4f 2e 80 00 00 	movabs $0x802e4f,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+  802f2c:	41 89 c5             	mov    %eax,%r13d
+  802f2f:	85 c0                	test   %eax,%eax
+  802f31:	78 1b                	js     802f4e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f37:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f3b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f41:	48 85 c0             	test   %rax,%rax
+  802f44:	74 08                	je     802f4e <fd_close+0x8f>
+  802f46:	48 89 df             	mov    %rbx,%rdi
+  802f49:	ff d0                	call   *%rax
+  802f4b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f53:	48 89 de             	mov    %rbx,%rsi
+  802f56:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5b:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  802f62:	00 00 00 
+  802f65:	ff d0                	call   *%rax
+    return res;
+  802f67:	eb a3                	jmp    802f0c <fd_close+0x4d>
+
+0000000000802f69 <close>:
+
+int
+close(int fdnum) {
+  802f69:	55                   	push   %rbp
+  802f6a:	48 89 e5             	mov    %rsp,%rbp
+  802f6d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f71:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f75:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  802f7c:	00 00 00 
+  802f7f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f81:	85 c0                	test   %eax,%eax
+  802f83:	78 15                	js     802f9a <close+0x31>
+
+    return fd_close(fd, 1);
+  802f85:	be 01 00 00 00       	mov    $0x1,%esi
+  802f8a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f8e:	48 b8 bf 2e 80 00 00 	movabs $0x802ebf,%rax
+  802f95:	00 00 00 
+  802f98:	ff d0                	call   *%rax
+}
+  802f9a:	c9                   	leave
+  802f9b:	c3                   	ret
+
+0000000000802f9c <close_all>:
+
+void
+close_all(void) {
+  802f9c:	55                   	push   %rbp
+  802f9d:	48 89 e5             	mov    %rsp,%rbp
+  802fa0:	41 54                	push   %r12
+  802fa2:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fa3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa8:	49 bc 69 2f 80 00 00 	movabs $0x802f69,%r12
+  802faf:	00 00 00 
+  802fb2:	89 df                	mov    %ebx,%edi
+  802fb4:	41 ff d4             	call   *%r12
+  802fb7:	83 c3 01             	add    $0x1,%ebx
+  802fba:	83 fb 20             	cmp    $0x20,%ebx
+  802fbd:	75 f3                	jne    802fb2 <close_all+0x16>
+}
+  802fbf:	5b                   	pop    %rbx
+  802fc0:	41 5c                	pop    %r12
+  802fc2:	5d                   	pop    %rbp
+  802fc3:	c3                   	ret
+
+0000000000802fc4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fc4:	55                   	push   %rbp
+  802fc5:	48 89 e5             	mov    %rsp,%rbp
+  802fc8:	41 57                	push   %r15
+  802fca:	41 56                	push   %r14
+  802fcc:	41 55                	push   %r13
+  802fce:	41 54                	push   %r12
+  802fd0:	53                   	push   %rbx
+  802fd1:	48 83 ec 18          	sub    $0x18,%rsp
+  802fd5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802fd8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802fdc:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  802fe3:	00 00 00 
+  802fe6:	ff d0                	call   *%rax
+  802fe8:	89 c3                	mov    %eax,%ebx
+  802fea:	85 c0                	test   %eax,%eax
+  802fec:	0f 88 b8 00 00 00    	js     8030aa <dup+0xe6>
+    close(newfdnum);
+  802ff2:	44 89 e7             	mov    %r12d,%edi
+  802ff5:	48 b8 69 2f 80 00 00 	movabs $0x802f69,%rax
+  802ffc:	00 00 00 
+  802fff:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803001:	4d 63 ec             	movslq %r12d,%r13
+  803004:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80300b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80300f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803013:	4c 89 ff             	mov    %r15,%rdi
+  803016:	49 be 88 2d 80 00 00 	movabs $0x802d88,%r14
+  80301d:	00 00 00 
+  803020:	41 ff d6             	call   *%r14
+  803023:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803026:	4c 89 ef             	mov    %r13,%rdi
+  803029:	41 ff d6             	call   *%r14
+  80302c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80302f:	48 89 df             	mov    %rbx,%rdi
+  803032:	48 b8 a4 42 80 00 00 	movabs $0x8042a4,%rax
+  803039:	00 00 00 
+  80303c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80303e:	a8 04                	test   $0x4,%al
+  803040:	74 2b                	je     80306d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803042:	41 89 c1             	mov    %eax,%r9d
+  803045:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80304b:	4c 89 f1             	mov    %r14,%rcx
+  80304e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803053:	48 89 de             	mov    %rbx,%rsi
+  803056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80305b:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+  803067:	89 c3                	mov    %eax,%ebx
+  803069:	85 c0                	test   %eax,%eax
+  80306b:	78 4e                	js     8030bb <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80306d:	4c 89 ff             	mov    %r15,%rdi
+  803070:	48 b8 a4 42 80 00 00 	movabs $0x8042a4,%rax
+  803077:	00 00 00 
+  80307a:	ff d0                	call   *%rax
+  80307c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80307f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803085:	4c 89 e9             	mov    %r13,%rcx
+  803088:	ba 00 00 00 00       	mov    $0x0,%edx
+  80308d:	4c 89 fe             	mov    %r15,%rsi
+  803090:	bf 00 00 00 00       	mov    $0x0,%edi
+  803095:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  80309c:	00 00 00 
+  80309f:	ff d0                	call   *%rax
+  8030a1:	89 c3                	mov    %eax,%ebx
+  8030a3:	85 c0                	test   %eax,%eax
+  8030a5:	78 14                	js     8030bb <dup+0xf7>
+
+    return newfdnum;
+  8030a7:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030aa:	89 d8                	mov    %ebx,%eax
+  8030ac:	48 83 c4 18          	add    $0x18,%rsp
+  8030b0:	5b                   	pop    %rbx
+  8030b1:	41 5c                	pop    %r12
+  8030b3:	41 5d                	pop    %r13
+  8030b5:	41 5e                	pop    %r14
+  8030b7:	41 5f                	pop    %r15
+  8030b9:	5d                   	pop    %rbp
+  8030ba:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030c0:	4c 89 ee             	mov    %r13,%rsi
+  8030c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c8:	49 bc f0 27 80 00 00 	movabs $0x8027f0,%r12
+  8030cf:	00 00 00 
+  8030d2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030da:	4c 89 f6             	mov    %r14,%rsi
+  8030dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e2:	41 ff d4             	call   *%r12
+    return res;
+  8030e5:	eb c3                	jmp    8030aa <dup+0xe6>
+
+00000000008030e7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030e7:	55                   	push   %rbp
+  8030e8:	48 89 e5             	mov    %rsp,%rbp
+  8030eb:	41 56                	push   %r14
+  8030ed:	41 55                	push   %r13
+  8030ef:	41 54                	push   %r12
+  8030f1:	53                   	push   %rbx
+  8030f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8030f6:	89 fb                	mov    %edi,%ebx
+  8030f8:	49 89 f4             	mov    %rsi,%r12
+  8030fb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030fe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803102:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+  80310e:	85 c0                	test   %eax,%eax
+  803110:	78 4c                	js     80315e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803112:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803116:	41 8b 3e             	mov    (%r14),%edi
+  803119:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80311d:	48 b8 4f 2e 80 00 00 	movabs $0x802e4f,%rax
+  803124:	00 00 00 
+  803127:	ff d0                	call   *%rax
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	78 35                	js     803162 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80312d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803131:	83 e0 03             	and    $0x3,%eax
+  803134:	83 f8 01             	cmp    $0x1,%eax
+  803137:	74 2d                	je     803166 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803139:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803141:	48 85 c0             	test   %rax,%rax
+  803144:	74 56                	je     80319c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803146:	4c 89 ea             	mov    %r13,%rdx
+  803149:	4c 89 e6             	mov    %r12,%rsi
+  80314c:	4c 89 f7             	mov    %r14,%rdi
+  80314f:	ff d0                	call   *%rax
+}
+  803151:	48 83 c4 10          	add    $0x10,%rsp
+  803155:	5b                   	pop    %rbx
+  803156:	41 5c                	pop    %r12
+  803158:	41 5d                	pop    %r13
+  80315a:	41 5e                	pop    %r14
+  80315c:	5d                   	pop    %rbp
+  80315d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80315e:	48 98                	cltq
+  803160:	eb ef                	jmp    803151 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803162:	48 98                	cltq
+  803164:	eb eb                	jmp    803151 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803166:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80316d:	00 00 00 
+  803170:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803176:	89 da                	mov    %ebx,%edx
+  803178:	48 bf 99 61 80 00 00 	movabs $0x806199,%rdi
+  80317f:	00 00 00 
+  803182:	b8 00 00 00 00       	mov    $0x0,%eax
+  803187:	48 b9 7c 16 80 00 00 	movabs $0x80167c,%rcx
+  80318e:	00 00 00 
+  803191:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803193:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80319a:	eb b5                	jmp    803151 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80319c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031a3:	eb ac                	jmp    803151 <read+0x6a>
+
+00000000008031a5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031a5:	55                   	push   %rbp
+  8031a6:	48 89 e5             	mov    %rsp,%rbp
+  8031a9:	41 57                	push   %r15
+  8031ab:	41 56                	push   %r14
+  8031ad:	41 55                	push   %r13
+  8031af:	41 54                	push   %r12
+  8031b1:	53                   	push   %rbx
+  8031b2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031b6:	48 85 d2             	test   %rdx,%rdx
+  8031b9:	74 54                	je     80320f <readn+0x6a>
+  8031bb:	41 89 fd             	mov    %edi,%r13d
+  8031be:	49 89 f6             	mov    %rsi,%r14
+  8031c1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031c9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031ce:	49 bf e7 30 80 00 00 	movabs $0x8030e7,%r15
+  8031d5:	00 00 00 
+  8031d8:	4c 89 e2             	mov    %r12,%rdx
+  8031db:	48 29 f2             	sub    %rsi,%rdx
+  8031de:	4c 01 f6             	add    %r14,%rsi
+  8031e1:	44 89 ef             	mov    %r13d,%edi
+  8031e4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	78 20                	js     80320b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8031eb:	01 c3                	add    %eax,%ebx
+  8031ed:	85 c0                	test   %eax,%eax
+  8031ef:	74 08                	je     8031f9 <readn+0x54>
+  8031f1:	48 63 f3             	movslq %ebx,%rsi
+  8031f4:	4c 39 e6             	cmp    %r12,%rsi
+  8031f7:	72 df                	jb     8031d8 <readn+0x33>
+    }
+    return res;
+  8031f9:	48 63 c3             	movslq %ebx,%rax
+}
+  8031fc:	48 83 c4 08          	add    $0x8,%rsp
+  803200:	5b                   	pop    %rbx
+  803201:	41 5c                	pop    %r12
+  803203:	41 5d                	pop    %r13
+  803205:	41 5e                	pop    %r14
+  803207:	41 5f                	pop    %r15
+  803209:	5d                   	pop    %rbp
+  80320a:	c3                   	ret
+        if (inc < 0) return inc;
+  80320b:	48 98                	cltq
+  80320d:	eb ed                	jmp    8031fc <readn+0x57>
+    int inc = 1, res = 0;
+  80320f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803214:	eb e3                	jmp    8031f9 <readn+0x54>
+
+0000000000803216 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803216:	55                   	push   %rbp
+  803217:	48 89 e5             	mov    %rsp,%rbp
+  80321a:	41 56                	push   %r14
+  80321c:	41 55                	push   %r13
+  80321e:	41 54                	push   %r12
+  803220:	53                   	push   %rbx
+  803221:	48 83 ec 10          	sub    $0x10,%rsp
+  803225:	89 fb                	mov    %edi,%ebx
+  803227:	49 89 f4             	mov    %rsi,%r12
+  80322a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80322d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803231:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  803238:	00 00 00 
+  80323b:	ff d0                	call   *%rax
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	78 47                	js     803288 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803241:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803245:	41 8b 3e             	mov    (%r14),%edi
+  803248:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80324c:	48 b8 4f 2e 80 00 00 	movabs $0x802e4f,%rax
+  803253:	00 00 00 
+  803256:	ff d0                	call   *%rax
+  803258:	85 c0                	test   %eax,%eax
+  80325a:	78 30                	js     80328c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80325c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803261:	74 2d                	je     803290 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803263:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803267:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80326b:	48 85 c0             	test   %rax,%rax
+  80326e:	74 56                	je     8032c6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803270:	4c 89 ea             	mov    %r13,%rdx
+  803273:	4c 89 e6             	mov    %r12,%rsi
+  803276:	4c 89 f7             	mov    %r14,%rdi
+  803279:	ff d0                	call   *%rax
+}
+  80327b:	48 83 c4 10          	add    $0x10,%rsp
+  80327f:	5b                   	pop    %rbx
+  803280:	41 5c                	pop    %r12
+  803282:	41 5d                	pop    %r13
+  803284:	41 5e                	pop    %r14
+  803286:	5d                   	pop    %rbp
+  803287:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803288:	48 98                	cltq
+  80328a:	eb ef                	jmp    80327b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80328c:	48 98                	cltq
+  80328e:	eb eb                	jmp    80327b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803290:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803297:	00 00 00 
+  80329a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032a0:	89 da                	mov    %ebx,%edx
+  8032a2:	48 bf b5 61 80 00 00 	movabs $0x8061b5,%rdi
+  8032a9:	00 00 00 
+  8032ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b1:	48 b9 7c 16 80 00 00 	movabs $0x80167c,%rcx
+  8032b8:	00 00 00 
+  8032bb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032bd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032c4:	eb b5                	jmp    80327b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032c6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032cd:	eb ac                	jmp    80327b <write+0x65>
+
+00000000008032cf <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032cf:	55                   	push   %rbp
+  8032d0:	48 89 e5             	mov    %rsp,%rbp
+  8032d3:	53                   	push   %rbx
+  8032d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8032d8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032da:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032de:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  8032e5:	00 00 00 
+  8032e8:	ff d0                	call   *%rax
+  8032ea:	85 c0                	test   %eax,%eax
+  8032ec:	78 0c                	js     8032fa <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8032ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8032f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032fe:	c9                   	leave
+  8032ff:	c3                   	ret
+
+0000000000803300 <tell>:
+
+int tell(int fdnum) {
+  803300:	55                   	push   %rbp
+  803301:	48 89 e5             	mov    %rsp,%rbp
+  803304:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803308:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80330c:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  803313:	00 00 00 
+  803316:	ff d0                	call   *%rax
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	78 07                	js     803323 <tell+0x23>
+
+    return fd->fd_offset;
+  80331c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803320:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803323:	c9                   	leave
+  803324:	c3                   	ret
+
+0000000000803325 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803325:	55                   	push   %rbp
+  803326:	48 89 e5             	mov    %rsp,%rbp
+  803329:	41 55                	push   %r13
+  80332b:	41 54                	push   %r12
+  80332d:	53                   	push   %rbx
+  80332e:	48 83 ec 18          	sub    $0x18,%rsp
+  803332:	89 fb                	mov    %edi,%ebx
+  803334:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803337:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80333b:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  803342:	00 00 00 
+  803345:	ff d0                	call   *%rax
+  803347:	85 c0                	test   %eax,%eax
+  803349:	78 38                	js     803383 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80334b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80334f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803353:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803357:	48 b8 4f 2e 80 00 00 	movabs $0x802e4f,%rax
+  80335e:	00 00 00 
+  803361:	ff d0                	call   *%rax
+  803363:	85 c0                	test   %eax,%eax
+  803365:	78 1c                	js     803383 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803367:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80336c:	74 20                	je     80338e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80336e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803372:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803376:	48 85 c0             	test   %rax,%rax
+  803379:	74 47                	je     8033c2 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80337b:	44 89 e6             	mov    %r12d,%esi
+  80337e:	4c 89 ef             	mov    %r13,%rdi
+  803381:	ff d0                	call   *%rax
+}
+  803383:	48 83 c4 18          	add    $0x18,%rsp
+  803387:	5b                   	pop    %rbx
+  803388:	41 5c                	pop    %r12
+  80338a:	41 5d                	pop    %r13
+  80338c:	5d                   	pop    %rbp
+  80338d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80338e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803395:	00 00 00 
+  803398:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80339e:	89 da                	mov    %ebx,%edx
+  8033a0:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  8033a7:	00 00 00 
+  8033aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033af:	48 b9 7c 16 80 00 00 	movabs $0x80167c,%rcx
+  8033b6:	00 00 00 
+  8033b9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c0:	eb c1                	jmp    803383 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033c2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033c7:	eb ba                	jmp    803383 <ftruncate+0x5e>
+
+00000000008033c9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033c9:	55                   	push   %rbp
+  8033ca:	48 89 e5             	mov    %rsp,%rbp
+  8033cd:	41 54                	push   %r12
+  8033cf:	53                   	push   %rbx
+  8033d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033d7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033db:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  8033e2:	00 00 00 
+  8033e5:	ff d0                	call   *%rax
+  8033e7:	85 c0                	test   %eax,%eax
+  8033e9:	78 63                	js     80344e <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033eb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8033ef:	41 8b 3c 24          	mov    (%r12),%edi
+  8033f3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8033f7:	48 b8 4f 2e 80 00 00 	movabs $0x802e4f,%rax
+  8033fe:	00 00 00 
+  803401:	ff d0                	call   *%rax
+  803403:	85 c0                	test   %eax,%eax
+  803405:	78 47                	js     80344e <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803407:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80340b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803410:	74 45                	je     803457 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803412:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803415:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80341c:	00 00 00 
+    stat->st_isdir = 0;
+  80341f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803426:	00 00 00 
+    stat->st_ino = 0;
+  803429:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803430:	00 00 00 00 
+    stat->st_version = 0;
+  803434:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80343b:	00 00 00 
+    stat->st_dev = dev;
+  80343e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803445:	48 89 de             	mov    %rbx,%rsi
+  803448:	4c 89 e7             	mov    %r12,%rdi
+  80344b:	ff 50 28             	call   *0x28(%rax)
+}
+  80344e:	48 83 c4 10          	add    $0x10,%rsp
+  803452:	5b                   	pop    %rbx
+  803453:	41 5c                	pop    %r12
+  803455:	5d                   	pop    %rbp
+  803456:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803457:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80345c:	eb f0                	jmp    80344e <fstat+0x85>
+
+000000000080345e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80345e:	55                   	push   %rbp
+  80345f:	48 89 e5             	mov    %rsp,%rbp
+  803462:	41 54                	push   %r12
+  803464:	53                   	push   %rbx
+  803465:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803468:	be 00 00 00 00       	mov    $0x0,%esi
+  80346d:	48 b8 7f 39 80 00 00 	movabs $0x80397f,%rax
+  803474:	00 00 00 
+  803477:	ff d0                	call   *%rax
+  803479:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80347b:	85 c0                	test   %eax,%eax
+  80347d:	78 25                	js     8034a4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80347f:	4c 89 e6             	mov    %r12,%rsi
+  803482:	89 c7                	mov    %eax,%edi
+  803484:	48 b8 c9 33 80 00 00 	movabs $0x8033c9,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+  803490:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803493:	89 df                	mov    %ebx,%edi
+  803495:	48 b8 69 2f 80 00 00 	movabs $0x802f69,%rax
+  80349c:	00 00 00 
+  80349f:	ff d0                	call   *%rax
+
+    return res;
+  8034a1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034a4:	89 d8                	mov    %ebx,%eax
+  8034a6:	5b                   	pop    %rbx
+  8034a7:	41 5c                	pop    %r12
+  8034a9:	5d                   	pop    %rbp
+  8034aa:	c3                   	ret
+
+00000000008034ab <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ab:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034b2:	00 00 00 
+  8034b5:	83 38 00             	cmpl   $0x0,(%rax)
+  8034b8:	74 0a                	je     8034c4 <fsipc_env+0x19>
+    return fsenv;
+}
+  8034ba:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034c1:	00 00 
+  8034c3:	c3                   	ret
+fsipc_env(void) {
+  8034c4:	55                   	push   %rbp
+  8034c5:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034c8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034cd:	48 b8 51 56 80 00 00 	movabs $0x805651,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+  8034d9:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8034e0:	00 00 
+}
+  8034e2:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034e9:	00 00 
+  8034eb:	5d                   	pop    %rbp
+  8034ec:	c3                   	ret
+
+00000000008034ed <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8034ed:	55                   	push   %rbp
+  8034ee:	48 89 e5             	mov    %rsp,%rbp
+  8034f1:	53                   	push   %rbx
+  8034f2:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8034f6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8034fd:	00 
+  8034fe:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803505:	00 
+  803506:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80350d:	00 
+  80350e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803515:	00 
+  803516:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80351d:	00 
+
+    assert(size <= sizeof(words));
+  80351e:	48 83 fa 28          	cmp    $0x28,%rdx
+  803522:	77 38                	ja     80355c <fsipc_short+0x6f>
+  803524:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803526:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80352a:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  803531:	00 00 00 
+  803534:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803536:	48 b8 ab 34 80 00 00 	movabs $0x8034ab,%rax
+  80353d:	00 00 00 
+  803540:	ff d0                	call   *%rax
+  803542:	89 c7                	mov    %eax,%edi
+  803544:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803548:	89 de                	mov    %ebx,%esi
+  80354a:	48 b8 b4 55 80 00 00 	movabs $0x8055b4,%rax
+  803551:	00 00 00 
+  803554:	ff d0                	call   *%rax
+}
+  803556:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80355a:	c9                   	leave
+  80355b:	c3                   	ret
+    assert(size <= sizeof(words));
+  80355c:	48 b9 00 62 80 00 00 	movabs $0x806200,%rcx
+  803563:	00 00 00 
+  803566:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80356d:	00 00 00 
+  803570:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803575:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80357c:	00 00 00 
+  80357f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803584:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  80358b:	00 00 00 
+  80358e:	41 ff d0             	call   *%r8
+
+0000000000803591 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803591:	55                   	push   %rbp
+  803592:	48 89 e5             	mov    %rsp,%rbp
+  803595:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803599:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80359c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80359f:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035a2:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035a7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035ab:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035b0:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  8035b7:	00 00 00 
+  8035ba:	ff d0                	call   *%rax
+}
+  8035bc:	c9                   	leave
+  8035bd:	c3                   	ret
+
+00000000008035be <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035be:	55                   	push   %rbp
+  8035bf:	48 89 e5             	mov    %rsp,%rbp
+  8035c2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035c6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035cc:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035d1:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035d5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035da:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  8035e1:	00 00 00 
+  8035e4:	ff d0                	call   *%rax
+}
+  8035e6:	c9                   	leave
+  8035e7:	c3                   	ret
+
+00000000008035e8 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8035e8:	55                   	push   %rbp
+  8035e9:	48 89 e5             	mov    %rsp,%rbp
+  8035ec:	41 54                	push   %r12
+  8035ee:	53                   	push   %rbx
+  8035ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f3:	89 fb                	mov    %edi,%ebx
+  8035f5:	49 89 f4             	mov    %rsi,%r12
+  8035f8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8035fc:	48 b8 ab 34 80 00 00 	movabs $0x8034ab,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+  803608:	89 c7                	mov    %eax,%edi
+  80360a:	6a 00                	push   $0x0
+  80360c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803610:	50                   	push   %rax
+  803611:	4d 89 e1             	mov    %r12,%r9
+  803614:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80361a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80361f:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803626:	00 00 00 
+  803629:	89 de                	mov    %ebx,%esi
+  80362b:	48 b8 4f 55 80 00 00 	movabs $0x80554f,%rax
+  803632:	00 00 00 
+  803635:	ff d0                	call   *%rax
+}
+  803637:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80363b:	5b                   	pop    %rbx
+  80363c:	41 5c                	pop    %r12
+  80363e:	5d                   	pop    %rbp
+  80363f:	c3                   	ret
+
+0000000000803640 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803640:	55                   	push   %rbp
+  803641:	48 89 e5             	mov    %rsp,%rbp
+  803644:	41 54                	push   %r12
+  803646:	53                   	push   %rbx
+  803647:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80364a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80364d:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803654:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803656:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80365b:	be 00 00 00 00       	mov    $0x0,%esi
+  803660:	bf 05 00 00 00       	mov    $0x5,%edi
+  803665:	48 b8 e8 35 80 00 00 	movabs $0x8035e8,%rax
+  80366c:	00 00 00 
+  80366f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803671:	85 c0                	test   %eax,%eax
+  803673:	78 5a                	js     8036cf <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803675:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80367c:	00 00 00 
+  80367f:	4c 89 e6             	mov    %r12,%rsi
+  803682:	48 89 df             	mov    %rbx,%rdi
+  803685:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  80368c:	00 00 00 
+  80368f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803691:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803698:	00 
+  803699:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80369f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036a6:	00 
+  8036a7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036ad:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036b4:	00 
+  8036b5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036bc:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036c3:	00 
+  8036c4:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036cf:	5b                   	pop    %rbx
+  8036d0:	41 5c                	pop    %r12
+  8036d2:	5d                   	pop    %rbp
+  8036d3:	c3                   	ret
+
+00000000008036d4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036d4:	55                   	push   %rbp
+  8036d5:	48 89 e5             	mov    %rsp,%rbp
+  8036d8:	41 57                	push   %r15
+  8036da:	41 56                	push   %r14
+  8036dc:	41 55                	push   %r13
+  8036de:	41 54                	push   %r12
+  8036e0:	53                   	push   %rbx
+  8036e1:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8036e5:	48 85 ff             	test   %rdi,%rdi
+  8036e8:	0f 84 a1 00 00 00    	je     80378f <devfile_read+0xbb>
+  8036ee:	49 89 ff             	mov    %rdi,%r15
+  8036f1:	49 89 f5             	mov    %rsi,%r13
+  8036f4:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8036f7:	48 85 f6             	test   %rsi,%rsi
+  8036fa:	0f 84 c4 00 00 00    	je     8037c4 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803700:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803707:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803708:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80370f:	00 00 00 
+  803712:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803716:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803719:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80371d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803722:	be 00 00 00 00       	mov    $0x0,%esi
+  803727:	bf 03 00 00 00       	mov    $0x3,%edi
+  80372c:	48 b8 e8 35 80 00 00 	movabs $0x8035e8,%rax
+  803733:	00 00 00 
+  803736:	ff d0                	call   *%rax
+        if (res < 0) {
+  803738:	85 c0                	test   %eax,%eax
+  80373a:	0f 88 b9 00 00 00    	js     8037f9 <devfile_read+0x125>
+        assert(res <= n);
+  803740:	48 63 d8             	movslq %eax,%rbx
+  803743:	49 39 dc             	cmp    %rbx,%r12
+  803746:	0f 82 b1 00 00 00    	jb     8037fd <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80374c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803751:	0f 87 db 00 00 00    	ja     803832 <devfile_read+0x15e>
+        if (!res) {
+  803757:	85 c0                	test   %eax,%eax
+  803759:	74 21                	je     80377c <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80375b:	48 89 da             	mov    %rbx,%rdx
+  80375e:	4c 89 f6             	mov    %r14,%rsi
+  803761:	4c 89 ef             	mov    %r13,%rdi
+  803764:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  80376b:	00 00 00 
+  80376e:	ff d0                	call   *%rax
+        total_read += res;
+  803770:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803774:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803777:	49 29 dc             	sub    %rbx,%r12
+  80377a:	75 96                	jne    803712 <devfile_read+0x3e>
+    return total_read;
+  80377c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803780:	48 83 c4 18          	add    $0x18,%rsp
+  803784:	5b                   	pop    %rbx
+  803785:	41 5c                	pop    %r12
+  803787:	41 5d                	pop    %r13
+  803789:	41 5e                	pop    %r14
+  80378b:	41 5f                	pop    %r15
+  80378d:	5d                   	pop    %rbp
+  80378e:	c3                   	ret
+    assert(fd);
+  80378f:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  803796:	00 00 00 
+  803799:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037a0:	00 00 00 
+  8037a3:	be 91 00 00 00       	mov    $0x91,%esi
+  8037a8:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037af:	00 00 00 
+  8037b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b7:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  8037be:	00 00 00 
+  8037c1:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037c4:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  8037cb:	00 00 00 
+  8037ce:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037d5:	00 00 00 
+  8037d8:	be 92 00 00 00       	mov    $0x92,%esi
+  8037dd:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037e4:	00 00 00 
+  8037e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ec:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  8037f3:	00 00 00 
+  8037f6:	41 ff d0             	call   *%r8
+            return res;
+  8037f9:	48 98                	cltq
+  8037fb:	eb 83                	jmp    803780 <devfile_read+0xac>
+        assert(res <= n);
+  8037fd:	48 b9 3d 62 80 00 00 	movabs $0x80623d,%rcx
+  803804:	00 00 00 
+  803807:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80380e:	00 00 00 
+  803811:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803816:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80381d:	00 00 00 
+  803820:	b8 00 00 00 00       	mov    $0x0,%eax
+  803825:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  80382c:	00 00 00 
+  80382f:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803832:	48 b9 48 62 80 00 00 	movabs $0x806248,%rcx
+  803839:	00 00 00 
+  80383c:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803843:	00 00 00 
+  803846:	be 9f 00 00 00       	mov    $0x9f,%esi
+  80384b:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803852:	00 00 00 
+  803855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385a:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  803861:	00 00 00 
+  803864:	41 ff d0             	call   *%r8
+
+0000000000803867 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803867:	55                   	push   %rbp
+  803868:	48 89 e5             	mov    %rsp,%rbp
+  80386b:	41 57                	push   %r15
+  80386d:	41 56                	push   %r14
+  80386f:	41 55                	push   %r13
+  803871:	41 54                	push   %r12
+  803873:	53                   	push   %rbx
+  803874:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803878:	48 85 ff             	test   %rdi,%rdi
+  80387b:	0f 84 83 00 00 00    	je     803904 <devfile_write+0x9d>
+  803881:	49 89 ff             	mov    %rdi,%r15
+  803884:	49 89 f4             	mov    %rsi,%r12
+  803887:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  80388a:	48 85 f6             	test   %rsi,%rsi
+  80388d:	0f 84 a6 00 00 00    	je     803939 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803893:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803899:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038a0:	00 00 00 
+  8038a3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038a7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038aa:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038ae:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038b3:	48 39 d3             	cmp    %rdx,%rbx
+  8038b6:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038ba:	4c 89 e6             	mov    %r12,%rsi
+  8038bd:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038c4:	00 00 00 
+  8038c7:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  8038ce:	00 00 00 
+  8038d1:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8038dd:	bf 04 00 00 00       	mov    $0x4,%edi
+  8038e2:	48 b8 e8 35 80 00 00 	movabs $0x8035e8,%rax
+  8038e9:	00 00 00 
+  8038ec:	ff d0                	call   *%rax
+        if (res < 0) {
+  8038ee:	85 c0                	test   %eax,%eax
+  8038f0:	78 7c                	js     80396e <devfile_write+0x107>
+        total_written += res;
+  8038f2:	48 98                	cltq
+  8038f4:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8038f7:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8038fa:	48 29 c3             	sub    %rax,%rbx
+  8038fd:	75 a4                	jne    8038a3 <devfile_write+0x3c>
+    return total_written;
+  8038ff:	4c 89 e8             	mov    %r13,%rax
+  803902:	eb 6c                	jmp    803970 <devfile_write+0x109>
+    assert(fd);
+  803904:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  80390b:	00 00 00 
+  80390e:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803915:	00 00 00 
+  803918:	be bd 00 00 00       	mov    $0xbd,%esi
+  80391d:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803924:	00 00 00 
+  803927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392c:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  803933:	00 00 00 
+  803936:	41 ff d0             	call   *%r8
+    assert(buf);
+  803939:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  803940:	00 00 00 
+  803943:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80394a:	00 00 00 
+  80394d:	be be 00 00 00       	mov    $0xbe,%esi
+  803952:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803959:	00 00 00 
+  80395c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803961:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  803968:	00 00 00 
+  80396b:	41 ff d0             	call   *%r8
+            return res;
+  80396e:	48 98                	cltq
+}
+  803970:	48 83 c4 08          	add    $0x8,%rsp
+  803974:	5b                   	pop    %rbx
+  803975:	41 5c                	pop    %r12
+  803977:	41 5d                	pop    %r13
+  803979:	41 5e                	pop    %r14
+  80397b:	41 5f                	pop    %r15
+  80397d:	5d                   	pop    %rbp
+  80397e:	c3                   	ret
+
+000000000080397f <open>:
+open(const char *path, int mode) {
+  80397f:	55                   	push   %rbp
+  803980:	48 89 e5             	mov    %rsp,%rbp
+  803983:	41 55                	push   %r13
+  803985:	41 54                	push   %r12
+  803987:	53                   	push   %rbx
+  803988:	48 83 ec 18          	sub    $0x18,%rsp
+  80398c:	49 89 fc             	mov    %rdi,%r12
+  80398f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803992:	48 b8 75 1f 80 00 00 	movabs $0x801f75,%rax
+  803999:	00 00 00 
+  80399c:	ff d0                	call   *%rax
+  80399e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039a4:	0f 87 8f 00 00 00    	ja     803a39 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039aa:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039ae:	48 b8 a4 2d 80 00 00 	movabs $0x802da4,%rax
+  8039b5:	00 00 00 
+  8039b8:	ff d0                	call   *%rax
+  8039ba:	89 c3                	mov    %eax,%ebx
+  8039bc:	85 c0                	test   %eax,%eax
+  8039be:	78 55                	js     803a15 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039c0:	4c 89 e6             	mov    %r12,%rsi
+  8039c3:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039ca:	00 00 00 
+  8039cd:	48 89 df             	mov    %rbx,%rdi
+  8039d0:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039dc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039e8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8039ec:	bf 01 00 00 00       	mov    $0x1,%edi
+  8039f1:	48 b8 e8 35 80 00 00 	movabs $0x8035e8,%rax
+  8039f8:	00 00 00 
+  8039fb:	ff d0                	call   *%rax
+  8039fd:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8039ff:	85 c0                	test   %eax,%eax
+  803a01:	78 1f                	js     803a22 <open+0xa3>
+    return fd2num(fd);
+  803a03:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a07:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  803a0e:	00 00 00 
+  803a11:	ff d0                	call   *%rax
+  803a13:	89 c3                	mov    %eax,%ebx
+}
+  803a15:	89 d8                	mov    %ebx,%eax
+  803a17:	48 83 c4 18          	add    $0x18,%rsp
+  803a1b:	5b                   	pop    %rbx
+  803a1c:	41 5c                	pop    %r12
+  803a1e:	41 5d                	pop    %r13
+  803a20:	5d                   	pop    %rbp
+  803a21:	c3                   	ret
+        fd_close(fd, 0);
+  803a22:	be 00 00 00 00       	mov    $0x0,%esi
+  803a27:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a2b:	48 b8 bf 2e 80 00 00 	movabs $0x802ebf,%rax
+  803a32:	00 00 00 
+  803a35:	ff d0                	call   *%rax
+        return res;
+  803a37:	eb dc                	jmp    803a15 <open+0x96>
+        return -E_BAD_PATH;
+  803a39:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a3e:	eb d5                	jmp    803a15 <open+0x96>
+
+0000000000803a40 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a40:	55                   	push   %rbp
+  803a41:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a44:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a49:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a53:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  803a5a:	00 00 00 
+  803a5d:	ff d0                	call   *%rax
+}
+  803a5f:	5d                   	pop    %rbp
+  803a60:	c3                   	ret
+
+0000000000803a61 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a61:	55                   	push   %rbp
+  803a62:	48 89 e5             	mov    %rsp,%rbp
+  803a65:	41 56                	push   %r14
+  803a67:	41 55                	push   %r13
+  803a69:	41 54                	push   %r12
+  803a6b:	53                   	push   %rbx
+  803a6c:	48 83 ec 10          	sub    $0x10,%rsp
+  803a70:	41 89 f6             	mov    %esi,%r14d
+  803a73:	49 89 d4             	mov    %rdx,%r12
+  803a76:	48 89 cb             	mov    %rcx,%rbx
+  803a79:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a7c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a80:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  803a87:	00 00 00 
+  803a8a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a8c:	85 c0                	test   %eax,%eax
+  803a8e:	78 46                	js     803ad6 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803a90:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a94:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803a9b:	00 00 00 
+  803a9e:	8b 00                	mov    (%rax),%eax
+  803aa0:	39 02                	cmp    %eax,(%rdx)
+  803aa2:	75 3f                	jne    803ae3 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803aa4:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803aab:	00 00 00 
+  803aae:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ab1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ab3:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ab7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803abb:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803abf:	48 89 da             	mov    %rbx,%rdx
+  803ac2:	4c 89 e6             	mov    %r12,%rsi
+  803ac5:	bf 09 00 00 00       	mov    $0x9,%edi
+  803aca:	48 b8 e8 35 80 00 00 	movabs $0x8035e8,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+}
+  803ad6:	48 83 c4 10          	add    $0x10,%rsp
+  803ada:	5b                   	pop    %rbx
+  803adb:	41 5c                	pop    %r12
+  803add:	41 5d                	pop    %r13
+  803adf:	41 5e                	pop    %r14
+  803ae1:	5d                   	pop    %rbp
+  803ae2:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ae3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ae8:	eb ec                	jmp    803ad6 <file_map+0x75>
+
+0000000000803aea <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803aea:	55                   	push   %rbp
+  803aeb:	48 89 e5             	mov    %rsp,%rbp
+  803aee:	41 54                	push   %r12
+  803af0:	53                   	push   %rbx
+  803af1:	48 83 ec 20          	sub    $0x20,%rsp
+  803af5:	41 89 f4             	mov    %esi,%r12d
+  803af8:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803afb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803aff:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  803b06:	00 00 00 
+  803b09:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b0b:	85 c0                	test   %eax,%eax
+  803b0d:	78 3c                	js     803b4b <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b13:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b1a:	00 00 00 
+  803b1d:	8b 0a                	mov    (%rdx),%ecx
+  803b1f:	39 08                	cmp    %ecx,(%rax)
+  803b21:	75 31                	jne    803b54 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b23:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b26:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b29:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b2d:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b31:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b36:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b3a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b3f:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  803b46:	00 00 00 
+  803b49:	ff d0                	call   *%rax
+}
+  803b4b:	48 83 c4 20          	add    $0x20,%rsp
+  803b4f:	5b                   	pop    %rbx
+  803b50:	41 5c                	pop    %r12
+  803b52:	5d                   	pop    %rbp
+  803b53:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b54:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b59:	eb f0                	jmp    803b4b <file_msync+0x61>
+
+0000000000803b5b <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b5b:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b5f:	7f 01                	jg     803b62 <writebuf+0x7>
+  803b61:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b62:	55                   	push   %rbp
+  803b63:	48 89 e5             	mov    %rsp,%rbp
+  803b66:	53                   	push   %rbx
+  803b67:	48 83 ec 08          	sub    $0x8,%rsp
+  803b6b:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b6e:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b72:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b76:	8b 3f                	mov    (%rdi),%edi
+  803b78:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  803b7f:	00 00 00 
+  803b82:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803b84:	48 85 c0             	test   %rax,%rax
+  803b87:	7e 04                	jle    803b8d <writebuf+0x32>
+  803b89:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803b8d:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803b91:	48 39 c2             	cmp    %rax,%rdx
+  803b94:	74 0f                	je     803ba5 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803b96:	48 85 c0             	test   %rax,%rax
+  803b99:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b9e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803ba2:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803ba5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ba9:	c9                   	leave
+  803baa:	c3                   	ret
+
+0000000000803bab <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bab:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bae:	8d 50 01             	lea    0x1(%rax),%edx
+  803bb1:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bb4:	48 98                	cltq
+  803bb6:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bbb:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bc1:	74 01                	je     803bc4 <putch+0x19>
+  803bc3:	c3                   	ret
+putch(int ch, void *arg) {
+  803bc4:	55                   	push   %rbp
+  803bc5:	48 89 e5             	mov    %rsp,%rbp
+  803bc8:	53                   	push   %rbx
+  803bc9:	48 83 ec 08          	sub    $0x8,%rsp
+  803bcd:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bd0:	48 89 f7             	mov    %rsi,%rdi
+  803bd3:	48 b8 5b 3b 80 00 00 	movabs $0x803b5b,%rax
+  803bda:	00 00 00 
+  803bdd:	ff d0                	call   *%rax
+        state->offset = 0;
+  803bdf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803be6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bea:	c9                   	leave
+  803beb:	c3                   	ret
+
+0000000000803bec <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803bec:	55                   	push   %rbp
+  803bed:	48 89 e5             	mov    %rsp,%rbp
+  803bf0:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803bf7:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803bfa:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c00:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c07:	00 00 00 
+    state.result = 0;
+  803c0a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c11:	00 00 00 00 
+    state.error = 1;
+  803c15:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c1c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c1f:	48 89 f2             	mov    %rsi,%rdx
+  803c22:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c29:	48 bf ab 3b 80 00 00 	movabs $0x803bab,%rdi
+  803c30:	00 00 00 
+  803c33:	48 b8 cc 17 80 00 00 	movabs $0x8017cc,%rax
+  803c3a:	00 00 00 
+  803c3d:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c3f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c46:	7f 14                	jg     803c5c <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c48:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c4f:	48 85 c0             	test   %rax,%rax
+  803c52:	75 06                	jne    803c5a <vfprintf+0x6e>
+  803c54:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c5a:	c9                   	leave
+  803c5b:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c5c:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c63:	48 b8 5b 3b 80 00 00 	movabs $0x803b5b,%rax
+  803c6a:	00 00 00 
+  803c6d:	ff d0                	call   *%rax
+  803c6f:	eb d7                	jmp    803c48 <vfprintf+0x5c>
+
+0000000000803c71 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c71:	55                   	push   %rbp
+  803c72:	48 89 e5             	mov    %rsp,%rbp
+  803c75:	48 83 ec 50          	sub    $0x50,%rsp
+  803c79:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803c81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803c89:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803c90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803c9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ca0:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ca4:	48 b8 ec 3b 80 00 00 	movabs $0x803bec,%rax
+  803cab:	00 00 00 
+  803cae:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cb0:	c9                   	leave
+  803cb1:	c3                   	ret
+
+0000000000803cb2 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cb2:	55                   	push   %rbp
+  803cb3:	48 89 e5             	mov    %rsp,%rbp
+  803cb6:	48 83 ec 50          	sub    $0x50,%rsp
+  803cba:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cbe:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cc2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cc6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cce:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cd5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cdd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ce1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803ce5:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ce9:	48 89 fe             	mov    %rdi,%rsi
+  803cec:	bf 01 00 00 00       	mov    $0x1,%edi
+  803cf1:	48 b8 ec 3b 80 00 00 	movabs $0x803bec,%rax
+  803cf8:	00 00 00 
+  803cfb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cfd:	c9                   	leave
+  803cfe:	c3                   	ret
+
+0000000000803cff <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803cff:	55                   	push   %rbp
+  803d00:	48 89 e5             	mov    %rsp,%rbp
+  803d03:	41 54                	push   %r12
+  803d05:	53                   	push   %rbx
+  803d06:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d09:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+  803d15:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d18:	48 be 70 62 80 00 00 	movabs $0x806270,%rsi
+  803d1f:	00 00 00 
+  803d22:	48 89 df             	mov    %rbx,%rdi
+  803d25:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  803d2c:	00 00 00 
+  803d2f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d31:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d36:	41 2b 04 24          	sub    (%r12),%eax
+  803d3a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d47:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d4a:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d51:	00 00 00 
+  803d54:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d60:	5b                   	pop    %rbx
+  803d61:	41 5c                	pop    %r12
+  803d63:	5d                   	pop    %rbp
+  803d64:	c3                   	ret
+
+0000000000803d65 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d65:	55                   	push   %rbp
+  803d66:	48 89 e5             	mov    %rsp,%rbp
+  803d69:	41 54                	push   %r12
+  803d6b:	53                   	push   %rbx
+  803d6c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d74:	48 89 fe             	mov    %rdi,%rsi
+  803d77:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7c:	49 bc f0 27 80 00 00 	movabs $0x8027f0,%r12
+  803d83:	00 00 00 
+  803d86:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803d89:	48 89 df             	mov    %rbx,%rdi
+  803d8c:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  803d93:	00 00 00 
+  803d96:	ff d0                	call   *%rax
+  803d98:	48 89 c6             	mov    %rax,%rsi
+  803d9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da5:	41 ff d4             	call   *%r12
+}
+  803da8:	5b                   	pop    %rbx
+  803da9:	41 5c                	pop    %r12
+  803dab:	5d                   	pop    %rbp
+  803dac:	c3                   	ret
+
+0000000000803dad <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dad:	55                   	push   %rbp
+  803dae:	48 89 e5             	mov    %rsp,%rbp
+  803db1:	41 57                	push   %r15
+  803db3:	41 56                	push   %r14
+  803db5:	41 55                	push   %r13
+  803db7:	41 54                	push   %r12
+  803db9:	53                   	push   %rbx
+  803dba:	48 83 ec 18          	sub    $0x18,%rsp
+  803dbe:	49 89 fc             	mov    %rdi,%r12
+  803dc1:	49 89 f5             	mov    %rsi,%r13
+  803dc4:	49 89 d7             	mov    %rdx,%r15
+  803dc7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dcb:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  803dd2:	00 00 00 
+  803dd5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803dd7:	4d 85 ff             	test   %r15,%r15
+  803dda:	0f 84 af 00 00 00    	je     803e8f <devpipe_write+0xe2>
+  803de0:	48 89 c3             	mov    %rax,%rbx
+  803de3:	4c 89 f8             	mov    %r15,%rax
+  803de6:	4d 89 ef             	mov    %r13,%r15
+  803de9:	4c 01 e8             	add    %r13,%rax
+  803dec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803df0:	49 bd e6 26 80 00 00 	movabs $0x8026e6,%r13
+  803df7:	00 00 00 
+            sys_yield();
+  803dfa:	49 be 77 26 80 00 00 	movabs $0x802677,%r14
+  803e01:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e04:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e07:	48 63 ce             	movslq %esi,%rcx
+  803e0a:	48 63 03             	movslq (%rbx),%rax
+  803e0d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e13:	48 39 c1             	cmp    %rax,%rcx
+  803e16:	72 2e                	jb     803e46 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e18:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e1d:	48 89 da             	mov    %rbx,%rdx
+  803e20:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e25:	4c 89 e7             	mov    %r12,%rdi
+  803e28:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e2b:	85 c0                	test   %eax,%eax
+  803e2d:	74 66                	je     803e95 <devpipe_write+0xe8>
+            sys_yield();
+  803e2f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e32:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e35:	48 63 ce             	movslq %esi,%rcx
+  803e38:	48 63 03             	movslq (%rbx),%rax
+  803e3b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e41:	48 39 c1             	cmp    %rax,%rcx
+  803e44:	73 d2                	jae    803e18 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e46:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e4a:	48 89 ca             	mov    %rcx,%rdx
+  803e4d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e51:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e58:	08 10 20 
+  803e5b:	48 f7 e2             	mul    %rdx
+  803e5e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e62:	48 89 d0             	mov    %rdx,%rax
+  803e65:	48 c1 e0 09          	shl    $0x9,%rax
+  803e69:	48 29 d0             	sub    %rdx,%rax
+  803e6c:	48 c1 e0 03          	shl    $0x3,%rax
+  803e70:	48 29 c1             	sub    %rax,%rcx
+  803e73:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e78:	83 c6 01             	add    $0x1,%esi
+  803e7b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e7e:	49 83 c7 01          	add    $0x1,%r15
+  803e82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e86:	49 39 c7             	cmp    %rax,%r15
+  803e89:	0f 85 75 ff ff ff    	jne    803e04 <devpipe_write+0x57>
+    return n;
+  803e8f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e93:	eb 05                	jmp    803e9a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9a:	48 83 c4 18          	add    $0x18,%rsp
+  803e9e:	5b                   	pop    %rbx
+  803e9f:	41 5c                	pop    %r12
+  803ea1:	41 5d                	pop    %r13
+  803ea3:	41 5e                	pop    %r14
+  803ea5:	41 5f                	pop    %r15
+  803ea7:	5d                   	pop    %rbp
+  803ea8:	c3                   	ret
+
+0000000000803ea9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ea9:	55                   	push   %rbp
+  803eaa:	48 89 e5             	mov    %rsp,%rbp
+  803ead:	41 57                	push   %r15
+  803eaf:	41 56                	push   %r14
+  803eb1:	41 55                	push   %r13
+  803eb3:	41 54                	push   %r12
+  803eb5:	53                   	push   %rbx
+  803eb6:	48 83 ec 18          	sub    $0x18,%rsp
+  803eba:	49 89 fc             	mov    %rdi,%r12
+  803ebd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ec1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ec5:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  803ecc:	00 00 00 
+  803ecf:	ff d0                	call   *%rax
+  803ed1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ed4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803eda:	49 bd e6 26 80 00 00 	movabs $0x8026e6,%r13
+  803ee1:	00 00 00 
+            sys_yield();
+  803ee4:	49 be 77 26 80 00 00 	movabs $0x802677,%r14
+  803eeb:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803eee:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ef3:	74 7d                	je     803f72 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803ef5:	8b 03                	mov    (%rbx),%eax
+  803ef7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803efa:	75 26                	jne    803f22 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803efc:	4d 85 ff             	test   %r15,%r15
+  803eff:	75 77                	jne    803f78 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f01:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f06:	48 89 da             	mov    %rbx,%rdx
+  803f09:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f0e:	4c 89 e7             	mov    %r12,%rdi
+  803f11:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f14:	85 c0                	test   %eax,%eax
+  803f16:	74 72                	je     803f8a <devpipe_read+0xe1>
+            sys_yield();
+  803f18:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f1b:	8b 03                	mov    (%rbx),%eax
+  803f1d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f20:	74 df                	je     803f01 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f22:	48 63 c8             	movslq %eax,%rcx
+  803f25:	48 89 ca             	mov    %rcx,%rdx
+  803f28:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f2c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f33:	08 10 20 
+  803f36:	48 89 d0             	mov    %rdx,%rax
+  803f39:	48 f7 e6             	mul    %rsi
+  803f3c:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f40:	48 89 d0             	mov    %rdx,%rax
+  803f43:	48 c1 e0 09          	shl    $0x9,%rax
+  803f47:	48 29 d0             	sub    %rdx,%rax
+  803f4a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f51:	00 
+  803f52:	48 89 c8             	mov    %rcx,%rax
+  803f55:	48 29 d0             	sub    %rdx,%rax
+  803f58:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f5d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f61:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f65:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f68:	49 83 c7 01          	add    $0x1,%r15
+  803f6c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f70:	75 83                	jne    803ef5 <devpipe_read+0x4c>
+    return n;
+  803f72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f76:	eb 03                	jmp    803f7b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f78:	4c 89 f8             	mov    %r15,%rax
+}
+  803f7b:	48 83 c4 18          	add    $0x18,%rsp
+  803f7f:	5b                   	pop    %rbx
+  803f80:	41 5c                	pop    %r12
+  803f82:	41 5d                	pop    %r13
+  803f84:	41 5e                	pop    %r14
+  803f86:	41 5f                	pop    %r15
+  803f88:	5d                   	pop    %rbp
+  803f89:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f8f:	eb ea                	jmp    803f7b <devpipe_read+0xd2>
+
+0000000000803f91 <pipe>:
+pipe(int pfd[2]) {
+  803f91:	55                   	push   %rbp
+  803f92:	48 89 e5             	mov    %rsp,%rbp
+  803f95:	41 55                	push   %r13
+  803f97:	41 54                	push   %r12
+  803f99:	53                   	push   %rbx
+  803f9a:	48 83 ec 18          	sub    $0x18,%rsp
+  803f9e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fa1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fa5:	48 b8 a4 2d 80 00 00 	movabs $0x802da4,%rax
+  803fac:	00 00 00 
+  803faf:	ff d0                	call   *%rax
+  803fb1:	89 c3                	mov    %eax,%ebx
+  803fb3:	85 c0                	test   %eax,%eax
+  803fb5:	0f 88 a0 01 00 00    	js     80415b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fbb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fce:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  803fd5:	00 00 00 
+  803fd8:	ff d0                	call   *%rax
+  803fda:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fdc:	85 c0                	test   %eax,%eax
+  803fde:	0f 88 77 01 00 00    	js     80415b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fe4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803fe8:	48 b8 a4 2d 80 00 00 	movabs $0x802da4,%rax
+  803fef:	00 00 00 
+  803ff2:	ff d0                	call   *%rax
+  803ff4:	89 c3                	mov    %eax,%ebx
+  803ff6:	85 c0                	test   %eax,%eax
+  803ff8:	0f 88 43 01 00 00    	js     804141 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ffe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804003:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804008:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80400c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804011:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  804018:	00 00 00 
+  80401b:	ff d0                	call   *%rax
+  80401d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80401f:	85 c0                	test   %eax,%eax
+  804021:	0f 88 1a 01 00 00    	js     804141 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804027:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80402b:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  804032:	00 00 00 
+  804035:	ff d0                	call   *%rax
+  804037:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80403a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80403f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804044:	48 89 c6             	mov    %rax,%rsi
+  804047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80404c:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  804053:	00 00 00 
+  804056:	ff d0                	call   *%rax
+  804058:	89 c3                	mov    %eax,%ebx
+  80405a:	85 c0                	test   %eax,%eax
+  80405c:	0f 88 c5 00 00 00    	js     804127 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804062:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804066:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  80406d:	00 00 00 
+  804070:	ff d0                	call   *%rax
+  804072:	48 89 c1             	mov    %rax,%rcx
+  804075:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80407b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804081:	ba 00 00 00 00       	mov    $0x0,%edx
+  804086:	4c 89 ee             	mov    %r13,%rsi
+  804089:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408e:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  804095:	00 00 00 
+  804098:	ff d0                	call   *%rax
+  80409a:	89 c3                	mov    %eax,%ebx
+  80409c:	85 c0                	test   %eax,%eax
+  80409e:	78 6e                	js     80410e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040a0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040a5:	4c 89 ef             	mov    %r13,%rdi
+  8040a8:	48 b8 ae 26 80 00 00 	movabs $0x8026ae,%rax
+  8040af:	00 00 00 
+  8040b2:	ff d0                	call   *%rax
+  8040b4:	83 f8 02             	cmp    $0x2,%eax
+  8040b7:	0f 85 ab 00 00 00    	jne    804168 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040bd:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040c4:	00 00 
+  8040c6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040ca:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040d0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040d7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040db:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040e1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040e8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040ec:	48 bb 76 2d 80 00 00 	movabs $0x802d76,%rbx
+  8040f3:	00 00 00 
+  8040f6:	ff d3                	call   *%rbx
+  8040f8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8040fc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804100:	ff d3                	call   *%rbx
+  804102:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804107:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80410c:	eb 4d                	jmp    80415b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80410e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804113:	4c 89 ee             	mov    %r13,%rsi
+  804116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80411b:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  804122:	00 00 00 
+  804125:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804127:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80412c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804130:	bf 00 00 00 00       	mov    $0x0,%edi
+  804135:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  80413c:	00 00 00 
+  80413f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804141:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804146:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80414a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80414f:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  804156:	00 00 00 
+  804159:	ff d0                	call   *%rax
+}
+  80415b:	89 d8                	mov    %ebx,%eax
+  80415d:	48 83 c4 18          	add    $0x18,%rsp
+  804161:	5b                   	pop    %rbx
+  804162:	41 5c                	pop    %r12
+  804164:	41 5d                	pop    %r13
+  804166:	5d                   	pop    %rbp
+  804167:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804168:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  80416f:	00 00 00 
+  804172:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804179:	00 00 00 
+  80417c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804181:	48 bf 77 62 80 00 00 	movabs $0x806277,%rdi
+  804188:	00 00 00 
+  80418b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804190:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  804197:	00 00 00 
+  80419a:	41 ff d0             	call   *%r8
+
+000000000080419d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80419d:	55                   	push   %rbp
+  80419e:	48 89 e5             	mov    %rsp,%rbp
+  8041a1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041a5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041a9:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  8041b0:	00 00 00 
+  8041b3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041b5:	85 c0                	test   %eax,%eax
+  8041b7:	78 35                	js     8041ee <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041b9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041bd:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  8041c4:	00 00 00 
+  8041c7:	ff d0                	call   *%rax
+  8041c9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041cc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041d1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041d6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041da:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  8041e1:	00 00 00 
+  8041e4:	ff d0                	call   *%rax
+  8041e6:	85 c0                	test   %eax,%eax
+  8041e8:	0f 94 c0             	sete   %al
+  8041eb:	0f b6 c0             	movzbl %al,%eax
+}
+  8041ee:	c9                   	leave
+  8041ef:	c3                   	ret
+
+00000000008041f0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8041f0:	48 89 f8             	mov    %rdi,%rax
+  8041f3:	48 c1 e8 27          	shr    $0x27,%rax
+  8041f7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8041fe:	01 00 00 
+  804201:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804205:	f6 c2 01             	test   $0x1,%dl
+  804208:	74 6d                	je     804277 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80420a:	48 89 f8             	mov    %rdi,%rax
+  80420d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804211:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804218:	01 00 00 
+  80421b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80421f:	f6 c2 01             	test   $0x1,%dl
+  804222:	74 62                	je     804286 <get_uvpt_entry+0x96>
+  804224:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80422b:	01 00 00 
+  80422e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804232:	f6 c2 80             	test   $0x80,%dl
+  804235:	75 4f                	jne    804286 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804237:	48 89 f8             	mov    %rdi,%rax
+  80423a:	48 c1 e8 15          	shr    $0x15,%rax
+  80423e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804245:	01 00 00 
+  804248:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80424c:	f6 c2 01             	test   $0x1,%dl
+  80424f:	74 44                	je     804295 <get_uvpt_entry+0xa5>
+  804251:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804258:	01 00 00 
+  80425b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80425f:	f6 c2 80             	test   $0x80,%dl
+  804262:	75 31                	jne    804295 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804264:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804268:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80426f:	01 00 00 
+  804272:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804276:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804277:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80427e:	01 00 00 
+  804281:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804285:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804286:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80428d:	01 00 00 
+  804290:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804294:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804295:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80429c:	01 00 00 
+  80429f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042a3:	c3                   	ret
+
+00000000008042a4 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042a4:	55                   	push   %rbp
+  8042a5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042a8:	48 b8 f0 41 80 00 00 	movabs $0x8041f0,%rax
+  8042af:	00 00 00 
+  8042b2:	ff d0                	call   *%rax
+  8042b4:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042b7:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042bc:	89 c1                	mov    %eax,%ecx
+  8042be:	83 c9 04             	or     $0x4,%ecx
+  8042c1:	f6 c2 01             	test   $0x1,%dl
+  8042c4:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042c7:	89 c1                	mov    %eax,%ecx
+  8042c9:	83 c9 02             	or     $0x2,%ecx
+  8042cc:	f6 c2 02             	test   $0x2,%dl
+  8042cf:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042d2:	89 c1                	mov    %eax,%ecx
+  8042d4:	83 c9 01             	or     $0x1,%ecx
+  8042d7:	48 85 d2             	test   %rdx,%rdx
+  8042da:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042dd:	89 c1                	mov    %eax,%ecx
+  8042df:	83 c9 40             	or     $0x40,%ecx
+  8042e2:	f6 c6 04             	test   $0x4,%dh
+  8042e5:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8042e8:	5d                   	pop    %rbp
+  8042e9:	c3                   	ret
+
+00000000008042ea <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8042ea:	55                   	push   %rbp
+  8042eb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042ee:	48 b8 f0 41 80 00 00 	movabs $0x8041f0,%rax
+  8042f5:	00 00 00 
+  8042f8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8042fa:	48 c1 e8 06          	shr    $0x6,%rax
+  8042fe:	83 e0 01             	and    $0x1,%eax
+}
+  804301:	5d                   	pop    %rbp
+  804302:	c3                   	ret
+
+0000000000804303 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804307:	48 b8 f0 41 80 00 00 	movabs $0x8041f0,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+  804313:	83 e0 01             	and    $0x1,%eax
+}
+  804316:	5d                   	pop    %rbp
+  804317:	c3                   	ret
+
+0000000000804318 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804318:	55                   	push   %rbp
+  804319:	48 89 e5             	mov    %rsp,%rbp
+  80431c:	41 57                	push   %r15
+  80431e:	41 56                	push   %r14
+  804320:	41 55                	push   %r13
+  804322:	41 54                	push   %r12
+  804324:	53                   	push   %rbx
+  804325:	48 83 ec 28          	sub    $0x28,%rsp
+  804329:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80432d:	48 85 ff             	test   %rdi,%rdi
+  804330:	74 1e                	je     804350 <foreach_shared_region+0x38>
+  804332:	49 89 ff             	mov    %rdi,%r15
+  804335:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80433b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804341:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804348:	01 00 00 
+  80434b:	e9 72 02 00 00       	jmp    8045c2 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804350:	48 b9 ac 62 80 00 00 	movabs $0x8062ac,%rcx
+  804357:	00 00 00 
+  80435a:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804361:	00 00 00 
+  804364:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804369:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  804370:	00 00 00 
+  804373:	b8 00 00 00 00       	mov    $0x0,%eax
+  804378:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  80437f:	00 00 00 
+  804382:	41 ff d0             	call   *%r8
+  804385:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80438c:	eb 6c                	jmp    8043fa <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80438e:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804395:	ff ff ff 
+  804398:	4c 21 e2             	and    %r12,%rdx
+  80439b:	48 89 d8             	mov    %rbx,%rax
+  80439e:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043a3:	48 83 c0 01          	add    $0x1,%rax
+  8043a7:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043ab:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043b2:	00 00 00 
+  8043b5:	48 21 c8             	and    %rcx,%rax
+  8043b8:	48 09 d0             	or     %rdx,%rax
+  8043bb:	49 89 c4             	mov    %rax,%r12
+  8043be:	eb 30                	jmp    8043f0 <foreach_shared_region+0xd8>
+  8043c0:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043c7:	ff ff ff 
+  8043ca:	4c 21 e2             	and    %r12,%rdx
+  8043cd:	48 89 d8             	mov    %rbx,%rax
+  8043d0:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043d5:	48 83 c0 01          	add    $0x1,%rax
+  8043d9:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043dd:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043e4:	00 00 00 
+  8043e7:	48 21 c8             	and    %rcx,%rax
+  8043ea:	48 09 d0             	or     %rdx,%rax
+  8043ed:	49 89 c4             	mov    %rax,%r12
+  8043f0:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8043f4:	0f 84 99 01 00 00    	je     804593 <foreach_shared_region+0x27b>
+  8043fa:	4c 89 e3             	mov    %r12,%rbx
+  8043fd:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804401:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804408:	01 00 00 
+  80440b:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80440f:	a8 01                	test   $0x1,%al
+  804411:	0f 84 77 ff ff ff    	je     80438e <foreach_shared_region+0x76>
+  804417:	a8 80                	test   $0x80,%al
+  804419:	74 19                	je     804434 <foreach_shared_region+0x11c>
+  80441b:	f6 c4 04             	test   $0x4,%ah
+  80441e:	74 a0                	je     8043c0 <foreach_shared_region+0xa8>
+  804420:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804427:	40 
+  804428:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80442c:	4c 89 e7             	mov    %r12,%rdi
+  80442f:	41 ff d7             	call   *%r15
+  804432:	eb 8c                	jmp    8043c0 <foreach_shared_region+0xa8>
+  804434:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80443b:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80443f:	eb 46                	jmp    804487 <foreach_shared_region+0x16f>
+  804441:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804448:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80444e:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804452:	48 c1 e0 15          	shl    $0x15,%rax
+  804456:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80445b:	49 09 c4             	or     %rax,%r12
+  80445e:	eb 1d                	jmp    80447d <foreach_shared_region+0x165>
+  804460:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804467:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80446d:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804471:	48 c1 e0 15          	shl    $0x15,%rax
+  804475:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80447a:	49 09 c4             	or     %rax,%r12
+  80447d:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804481:	0f 84 d3 00 00 00    	je     80455a <foreach_shared_region+0x242>
+  804487:	4c 89 e3             	mov    %r12,%rbx
+  80448a:	48 c1 eb 15          	shr    $0x15,%rbx
+  80448e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804495:	01 00 00 
+  804498:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80449c:	a8 01                	test   $0x1,%al
+  80449e:	74 a1                	je     804441 <foreach_shared_region+0x129>
+  8044a0:	a8 80                	test   $0x80,%al
+  8044a2:	74 19                	je     8044bd <foreach_shared_region+0x1a5>
+  8044a4:	f6 c4 04             	test   $0x4,%ah
+  8044a7:	74 b7                	je     804460 <foreach_shared_region+0x148>
+  8044a9:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044b0:	00 
+  8044b1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044b5:	4c 89 e7             	mov    %r12,%rdi
+  8044b8:	41 ff d7             	call   *%r15
+  8044bb:	eb a3                	jmp    804460 <foreach_shared_region+0x148>
+  8044bd:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044c3:	eb 3b                	jmp    804500 <foreach_shared_region+0x1e8>
+  8044c5:	f6 c4 04             	test   $0x4,%ah
+  8044c8:	74 12                	je     8044dc <foreach_shared_region+0x1c4>
+  8044ca:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044d1:	00 
+  8044d2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044d6:	4c 89 e7             	mov    %r12,%rdi
+  8044d9:	41 ff d7             	call   *%r15
+  8044dc:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8044e3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044e9:	48 83 c3 01          	add    $0x1,%rbx
+  8044ed:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8044f1:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8044f7:	49 09 dc             	or     %rbx,%r12
+  8044fa:	41 83 ed 01          	sub    $0x1,%r13d
+  8044fe:	74 2f                	je     80452f <foreach_shared_region+0x217>
+  804500:	4c 89 e3             	mov    %r12,%rbx
+  804503:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804507:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80450b:	a8 01                	test   $0x1,%al
+  80450d:	75 b6                	jne    8044c5 <foreach_shared_region+0x1ad>
+  80450f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804516:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80451c:	48 83 c3 01          	add    $0x1,%rbx
+  804520:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804524:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80452a:	49 09 dc             	or     %rbx,%r12
+  80452d:	eb cb                	jmp    8044fa <foreach_shared_region+0x1e2>
+  80452f:	4c 89 e0             	mov    %r12,%rax
+  804532:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804538:	49 c1 ec 15          	shr    $0x15,%r12
+  80453c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804543:	49 83 c4 01          	add    $0x1,%r12
+  804547:	49 c1 e4 15          	shl    $0x15,%r12
+  80454b:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804552:	49 09 c4             	or     %rax,%r12
+  804555:	e9 23 ff ff ff       	jmp    80447d <foreach_shared_region+0x165>
+  80455a:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80455e:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804565:	ff ff ff 
+  804568:	4c 21 e0             	and    %r12,%rax
+  80456b:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80456f:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804576:	49 83 c4 01          	add    $0x1,%r12
+  80457a:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80457e:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804585:	00 00 00 
+  804588:	49 21 d4             	and    %rdx,%r12
+  80458b:	49 09 c4             	or     %rax,%r12
+  80458e:	e9 5d fe ff ff       	jmp    8043f0 <foreach_shared_region+0xd8>
+  804593:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80459a:	00 ff ff 
+  80459d:	4c 21 e0             	and    %r12,%rax
+  8045a0:	49 c1 ec 27          	shr    $0x27,%r12
+  8045a4:	49 83 c4 01          	add    $0x1,%r12
+  8045a8:	49 c1 e4 27          	shl    $0x27,%r12
+  8045ac:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045b3:	ff 00 00 
+  8045b6:	49 21 d4             	and    %rdx,%r12
+  8045b9:	49 09 c4             	or     %rax,%r12
+  8045bc:	41 83 ed 01          	sub    $0x1,%r13d
+  8045c0:	74 48                	je     80460a <foreach_shared_region+0x2f2>
+  8045c2:	4c 89 e0             	mov    %r12,%rax
+  8045c5:	48 c1 e8 27          	shr    $0x27,%rax
+  8045c9:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045d0:	01 00 00 
+  8045d3:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045d7:	f6 c2 01             	test   $0x1,%dl
+  8045da:	0f 85 a5 fd ff ff    	jne    804385 <foreach_shared_region+0x6d>
+  8045e0:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8045e7:	00 ff ff 
+  8045ea:	4c 21 e2             	and    %r12,%rdx
+  8045ed:	48 83 c0 01          	add    $0x1,%rax
+  8045f1:	48 c1 e0 27          	shl    $0x27,%rax
+  8045f5:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8045fc:	ff 00 00 
+  8045ff:	48 21 c8             	and    %rcx,%rax
+  804602:	48 09 d0             	or     %rdx,%rax
+  804605:	49 89 c4             	mov    %rax,%r12
+  804608:	eb b2                	jmp    8045bc <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80460a:	4d 85 e4             	test   %r12,%r12
+  80460d:	75 14                	jne    804623 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80460f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804614:	48 83 c4 28          	add    $0x28,%rsp
+  804618:	5b                   	pop    %rbx
+  804619:	41 5c                	pop    %r12
+  80461b:	41 5d                	pop    %r13
+  80461d:	41 5e                	pop    %r14
+  80461f:	41 5f                	pop    %r15
+  804621:	5d                   	pop    %rbp
+  804622:	c3                   	ret
+    assert(addr == 0);
+  804623:	48 b9 bb 62 80 00 00 	movabs $0x8062bb,%rcx
+  80462a:	00 00 00 
+  80462d:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804634:	00 00 00 
+  804637:	be 67 00 00 00       	mov    $0x67,%esi
+  80463c:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  804643:	00 00 00 
+  804646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464b:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  804652:	00 00 00 
+  804655:	41 ff d0             	call   *%r8
+
+0000000000804658 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804658:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  80465f:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804662:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804668:	eb 33                	jmp    80469d <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80466a:	48 83 c0 20          	add    $0x20,%rax
+  80466e:	4c 39 c0             	cmp    %r8,%rax
+  804671:	74 25                	je     804698 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804673:	48 8b 10             	mov    (%rax),%rdx
+  804676:	48 85 d2             	test   %rdx,%rdx
+  804679:	74 ef                	je     80466a <mmap_place+0x12>
+  80467b:	48 89 d1             	mov    %rdx,%rcx
+  80467e:	48 03 48 08          	add    0x8(%rax),%rcx
+  804682:	48 39 cf             	cmp    %rcx,%rdi
+  804685:	73 e3                	jae    80466a <mmap_place+0x12>
+  804687:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80468b:	4c 39 ca             	cmp    %r9,%rdx
+  80468e:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804692:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804696:	eb d2                	jmp    80466a <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804698:	45 84 d2             	test   %r10b,%r10b
+  80469b:	74 12                	je     8046af <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80469d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046a4:	00 00 00 
+        moved = 0;
+  8046a7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046ad:	eb c4                	jmp    804673 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046af:	48 01 fe             	add    %rdi,%rsi
+  8046b2:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046b9:	00 00 00 
+  8046bc:	48 39 f0             	cmp    %rsi,%rax
+  8046bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c4:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046c8:	c3                   	ret
+
+00000000008046c9 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046c9:	55                   	push   %rbp
+  8046ca:	48 89 e5             	mov    %rsp,%rbp
+  8046cd:	41 57                	push   %r15
+  8046cf:	41 56                	push   %r14
+  8046d1:	41 55                	push   %r13
+  8046d3:	41 54                	push   %r12
+  8046d5:	53                   	push   %rbx
+  8046d6:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046da:	48 8b 1f             	mov    (%rdi),%rbx
+  8046dd:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046e4:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046eb:	00 00 00 
+  8046ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046f3:	eb 12                	jmp    804707 <mmap_pgfault+0x3e>
+  8046f5:	48 83 c2 01          	add    $0x1,%rdx
+  8046f9:	48 83 c0 20          	add    $0x20,%rax
+  8046fd:	48 83 fa 20          	cmp    $0x20,%rdx
+  804701:	0f 84 04 01 00 00    	je     80480b <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804707:	48 8b 08             	mov    (%rax),%rcx
+  80470a:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80470e:	48 39 de             	cmp    %rbx,%rsi
+  804711:	73 e2                	jae    8046f5 <mmap_pgfault+0x2c>
+  804713:	48 03 48 08          	add    0x8(%rax),%rcx
+  804717:	48 39 cb             	cmp    %rcx,%rbx
+  80471a:	73 d9                	jae    8046f5 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80471c:	48 c1 e2 05          	shl    $0x5,%rdx
+  804720:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804727:	00 00 00 
+  80472a:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80472e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804732:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804736:	f6 c2 01             	test   $0x1,%dl
+  804739:	0f 84 e0 00 00 00    	je     80481f <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80473f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804744:	f6 c2 02             	test   $0x2,%dl
+  804747:	0f 84 c3 00 00 00    	je     804810 <mmap_pgfault+0x147>
+  80474d:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804754:	ff ff ff 
+  804757:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80475b:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804762:	00 00 00 
+  804765:	48 39 ca             	cmp    %rcx,%rdx
+  804768:	0f 85 a2 00 00 00    	jne    804810 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80476e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804773:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804778:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80477f:	00 00 00 
+  804782:	bf 00 00 00 00       	mov    $0x0,%edi
+  804787:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  80478e:	00 00 00 
+  804791:	ff d0                	call   *%rax
+  804793:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479a:	85 d2                	test   %edx,%edx
+  80479c:	78 72                	js     804810 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  80479e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a3:	48 89 de             	mov    %rbx,%rsi
+  8047a6:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047ad:	00 00 00 
+  8047b0:	4c 89 e7             	mov    %r12,%rdi
+  8047b3:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  8047ba:	00 00 00 
+  8047bd:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047bf:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047c5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047cb:	48 89 d9             	mov    %rbx,%rcx
+  8047ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d3:	4c 89 e6             	mov    %r12,%rsi
+  8047d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047db:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  8047e2:	00 00 00 
+  8047e5:	ff d0                	call   *%rax
+  8047e7:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8047e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ee:	4c 89 e6             	mov    %r12,%rsi
+  8047f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047f6:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  8047fd:	00 00 00 
+  804800:	ff d0                	call   *%rax
+    return res >= 0;
+  804802:	89 d8                	mov    %ebx,%eax
+  804804:	f7 d0                	not    %eax
+  804806:	c1 e8 1f             	shr    $0x1f,%eax
+  804809:	eb 05                	jmp    804810 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80480b:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804810:	48 83 c4 18          	add    $0x18,%rsp
+  804814:	5b                   	pop    %rbx
+  804815:	41 5c                	pop    %r12
+  804817:	41 5d                	pop    %r13
+  804819:	41 5e                	pop    %r14
+  80481b:	41 5f                	pop    %r15
+  80481d:	5d                   	pop    %rbp
+  80481e:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80481f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804823:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804827:	4c 03 30             	add    (%rax),%r14
+  80482a:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804831:	49 39 c6             	cmp    %rax,%r14
+  804834:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804838:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80483f:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804845:	49 bf 03 43 80 00 00 	movabs $0x804303,%r15
+  80484c:	00 00 00 
+  80484f:	4d 39 f4             	cmp    %r14,%r12
+  804852:	73 1d                	jae    804871 <mmap_pgfault+0x1a8>
+  804854:	4c 89 e7             	mov    %r12,%rdi
+  804857:	41 ff d7             	call   *%r15
+  80485a:	84 c0                	test   %al,%al
+  80485c:	75 13                	jne    804871 <mmap_pgfault+0x1a8>
+  80485e:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804865:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80486c:	4d 39 f4             	cmp    %r14,%r12
+  80486f:	72 e3                	jb     804854 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804871:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804877:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80487b:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80487f:	74 2a                	je     8048ab <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804881:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804885:	89 de                	mov    %ebx,%esi
+  804887:	2b 30                	sub    (%rax),%esi
+  804889:	03 70 1c             	add    0x1c(%rax),%esi
+  80488c:	8b 78 18             	mov    0x18(%rax),%edi
+  80488f:	4c 89 e9             	mov    %r13,%rcx
+  804892:	48 89 da             	mov    %rbx,%rdx
+  804895:	48 b8 61 3a 80 00 00 	movabs $0x803a61,%rax
+  80489c:	00 00 00 
+  80489f:	ff d0                	call   *%rax
+    return res > 0;
+  8048a1:	85 c0                	test   %eax,%eax
+  8048a3:	0f 9f c0             	setg   %al
+  8048a6:	e9 65 ff ff ff       	jmp    804810 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048ab:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048af:	eb d0                	jmp    804881 <mmap_pgfault+0x1b8>
+
+00000000008048b1 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048b1:	55                   	push   %rbp
+  8048b2:	48 89 e5             	mov    %rsp,%rbp
+  8048b5:	41 57                	push   %r15
+  8048b7:	41 56                	push   %r14
+  8048b9:	41 55                	push   %r13
+  8048bb:	41 54                	push   %r12
+  8048bd:	53                   	push   %rbx
+  8048be:	48 83 ec 28          	sub    $0x28,%rsp
+  8048c2:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048c6:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048c9:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048d0:	ff ff ff 
+  8048d3:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048dc:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8048e3:	00 00 00 
+  8048e6:	48 39 ca             	cmp    %rcx,%rdx
+  8048e9:	0f 85 e5 00 00 00    	jne    8049d4 <mmap_writeback+0x123>
+  8048ef:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8048f2:	4c 39 ee             	cmp    %r13,%rsi
+  8048f5:	0f 83 e8 00 00 00    	jae    8049e3 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8048fb:	49 be 03 43 80 00 00 	movabs $0x804303,%r14
+  804902:	00 00 00 
+  804905:	49 bf ea 42 80 00 00 	movabs $0x8042ea,%r15
+  80490c:	00 00 00 
+  80490f:	eb 10                	jmp    804921 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804911:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804918:	4d 39 ec             	cmp    %r13,%r12
+  80491b:	0f 83 ae 00 00 00    	jae    8049cf <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804921:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804925:	4c 89 e7             	mov    %r12,%rdi
+  804928:	41 ff d6             	call   *%r14
+  80492b:	84 c0                	test   %al,%al
+  80492d:	74 e2                	je     804911 <mmap_writeback+0x60>
+  80492f:	4c 89 e7             	mov    %r12,%rdi
+  804932:	41 ff d7             	call   *%r15
+  804935:	84 c0                	test   %al,%al
+  804937:	74 d8                	je     804911 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804939:	4c 89 e3             	mov    %r12,%rbx
+  80493c:	4d 39 ec             	cmp    %r13,%r12
+  80493f:	73 20                	jae    804961 <mmap_writeback+0xb0>
+  804941:	48 89 df             	mov    %rbx,%rdi
+  804944:	41 ff d6             	call   *%r14
+  804947:	84 c0                	test   %al,%al
+  804949:	74 16                	je     804961 <mmap_writeback+0xb0>
+  80494b:	48 89 df             	mov    %rbx,%rdi
+  80494e:	41 ff d7             	call   *%r15
+  804951:	84 c0                	test   %al,%al
+  804953:	74 0c                	je     804961 <mmap_writeback+0xb0>
+  804955:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80495c:	4c 39 eb             	cmp    %r13,%rbx
+  80495f:	72 e0                	jb     804941 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804961:	48 89 d9             	mov    %rbx,%rcx
+  804964:	4c 29 e1             	sub    %r12,%rcx
+  804967:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80496b:	44 89 e6             	mov    %r12d,%esi
+  80496e:	2b 30                	sub    (%rax),%esi
+  804970:	49 89 c4             	mov    %rax,%r12
+  804973:	03 70 1c             	add    0x1c(%rax),%esi
+  804976:	8b 78 18             	mov    0x18(%rax),%edi
+  804979:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80497d:	48 89 ca             	mov    %rcx,%rdx
+  804980:	48 b8 ea 3a 80 00 00 	movabs $0x803aea,%rax
+  804987:	00 00 00 
+  80498a:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80498c:	85 c0                	test   %eax,%eax
+  80498e:	78 44                	js     8049d4 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804990:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804995:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804998:	41 89 c1             	mov    %eax,%r9d
+  80499b:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049a2:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049a6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049af:	48 89 ce             	mov    %rcx,%rsi
+  8049b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049b7:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  8049be:	00 00 00 
+  8049c1:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049c3:	85 c0                	test   %eax,%eax
+  8049c5:	78 0d                	js     8049d4 <mmap_writeback+0x123>
+  8049c7:	49 89 dc             	mov    %rbx,%r12
+  8049ca:	e9 49 ff ff ff       	jmp    804918 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049d4:	48 83 c4 28          	add    $0x28,%rsp
+  8049d8:	5b                   	pop    %rbx
+  8049d9:	41 5c                	pop    %r12
+  8049db:	41 5d                	pop    %r13
+  8049dd:	41 5e                	pop    %r14
+  8049df:	41 5f                	pop    %r15
+  8049e1:	5d                   	pop    %rbp
+  8049e2:	c3                   	ret
+    return 0;
+  8049e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049e8:	eb ea                	jmp    8049d4 <mmap_writeback+0x123>
+
+00000000008049ea <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8049ea:	55                   	push   %rbp
+  8049eb:	48 89 e5             	mov    %rsp,%rbp
+  8049ee:	41 57                	push   %r15
+  8049f0:	41 56                	push   %r14
+  8049f2:	41 55                	push   %r13
+  8049f4:	41 54                	push   %r12
+  8049f6:	53                   	push   %rbx
+  8049f7:	48 83 ec 38          	sub    $0x38,%rsp
+  8049fb:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8049ff:	48 85 f6             	test   %rsi,%rsi
+  804a02:	0f 84 0c 02 00 00    	je     804c14 <mmap+0x22a>
+  804a08:	49 89 ff             	mov    %rdi,%r15
+  804a0b:	49 89 f4             	mov    %rsi,%r12
+  804a0e:	41 89 d5             	mov    %edx,%r13d
+  804a11:	41 89 ce             	mov    %ecx,%r14d
+  804a14:	44 89 cb             	mov    %r9d,%ebx
+  804a17:	45 85 c9             	test   %r9d,%r9d
+  804a1a:	0f 88 f4 01 00 00    	js     804c14 <mmap+0x22a>
+  804a20:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a27:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a2e:	0f 85 e7 01 00 00    	jne    804c1b <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a34:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a37:	83 fa 04             	cmp    $0x4,%edx
+  804a3a:	0f 85 db 01 00 00    	jne    804c1b <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a40:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a43:	83 fa 01             	cmp    $0x1,%edx
+  804a46:	0f 87 cf 01 00 00    	ja     804c1b <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a4c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a50:	44 89 c7             	mov    %r8d,%edi
+  804a53:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  804a5a:	00 00 00 
+  804a5d:	ff d0                	call   *%rax
+  804a5f:	89 c2                	mov    %eax,%edx
+  804a61:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a68:	85 d2                	test   %edx,%edx
+  804a6a:	0f 88 ab 01 00 00    	js     804c1b <mmap+0x231>
+  804a70:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a74:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a7b:	00 00 00 
+  804a7e:	8b 09                	mov    (%rcx),%ecx
+  804a80:	39 0a                	cmp    %ecx,(%rdx)
+  804a82:	0f 85 93 01 00 00    	jne    804c1b <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804a88:	8b 52 08             	mov    0x8(%rdx),%edx
+  804a8b:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804a8e:	83 fa 01             	cmp    $0x1,%edx
+  804a91:	0f 84 84 01 00 00    	je     804c1b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804a97:	41 83 fe 01          	cmp    $0x1,%r14d
+  804a9b:	74 42                	je     804adf <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804a9d:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804aa4:	4c 89 e6             	mov    %r12,%rsi
+  804aa7:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804aae:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ab2:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ab6:	4d 85 ff             	test   %r15,%r15
+  804ab9:	74 67                	je     804b22 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804abb:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ac2:	75 0f                	jne    804ad3 <mmap+0xe9>
+  804ac4:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804acb:	00 00 00 
+  804ace:	49 39 c7             	cmp    %rax,%r15
+  804ad1:	77 1b                	ja     804aee <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804ad3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ada:	e9 3c 01 00 00       	jmp    804c1b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804adf:	41 f6 c5 02          	test   $0x2,%r13b
+  804ae3:	74 b8                	je     804a9d <mmap+0xb3>
+  804ae5:	85 d2                	test   %edx,%edx
+  804ae7:	75 b4                	jne    804a9d <mmap+0xb3>
+  804ae9:	e9 2d 01 00 00       	jmp    804c1b <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804aee:	4c 89 ff             	mov    %r15,%rdi
+  804af1:	48 b8 58 46 80 00 00 	movabs $0x804658,%rax
+  804af8:	00 00 00 
+  804afb:	ff d0                	call   *%rax
+  804afd:	48 89 c2             	mov    %rax,%rdx
+  804b00:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b07:	49 39 d7             	cmp    %rdx,%r15
+  804b0a:	0f 85 0b 01 00 00    	jne    804c1b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b10:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b17:	00 00 00 
+  804b1a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b20:	eb 44                	jmp    804b66 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b22:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b26:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b2d:	00 00 00 
+  804b30:	48 b8 58 46 80 00 00 	movabs $0x804658,%rax
+  804b37:	00 00 00 
+  804b3a:	ff d0                	call   *%rax
+  804b3c:	48 89 c7             	mov    %rax,%rdi
+  804b3f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b43:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b4a:	48 85 ff             	test   %rdi,%rdi
+  804b4d:	75 c1                	jne    804b10 <mmap+0x126>
+  804b4f:	e9 c7 00 00 00       	jmp    804c1b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b54:	49 83 c4 01          	add    $0x1,%r12
+  804b58:	48 83 c0 20          	add    $0x20,%rax
+  804b5c:	49 83 fc 20          	cmp    $0x20,%r12
+  804b60:	0f 84 a5 00 00 00    	je     804c0b <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b66:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b6a:	75 e8                	jne    804b54 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b6c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b70:	48 b8 a4 2d 80 00 00 	movabs $0x802da4,%rax
+  804b77:	00 00 00 
+  804b7a:	ff d0                	call   *%rax
+  804b7c:	89 c2                	mov    %eax,%edx
+  804b7e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b85:	85 d2                	test   %edx,%edx
+  804b87:	0f 88 8e 00 00 00    	js     804c1b <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804b8d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804b91:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  804b98:	00 00 00 
+  804b9b:	ff d0                	call   *%rax
+  804b9d:	89 c6                	mov    %eax,%esi
+  804b9f:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804ba2:	48 b8 c4 2f 80 00 00 	movabs $0x802fc4,%rax
+  804ba9:	00 00 00 
+  804bac:	ff d0                	call   *%rax
+  804bae:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bb1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bb8:	45 85 ff             	test   %r15d,%r15d
+  804bbb:	78 5e                	js     804c1b <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bbd:	49 c1 e4 05          	shl    $0x5,%r12
+  804bc1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bc8:	00 00 00 
+  804bcb:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bce:	48 bf c9 46 80 00 00 	movabs $0x8046c9,%rdi
+  804bd5:	00 00 00 
+  804bd8:	48 b8 97 51 80 00 00 	movabs $0x805197,%rax
+  804bdf:	00 00 00 
+  804be2:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804be4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804be8:	49 89 04 24          	mov    %rax,(%r12)
+  804bec:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804bf0:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804bf5:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804bfa:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804bff:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c04:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c09:	eb 10                	jmp    804c1b <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c0b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c12:	eb 07                	jmp    804c1b <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c14:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c1b:	48 83 c4 38          	add    $0x38,%rsp
+  804c1f:	5b                   	pop    %rbx
+  804c20:	41 5c                	pop    %r12
+  804c22:	41 5d                	pop    %r13
+  804c24:	41 5e                	pop    %r14
+  804c26:	41 5f                	pop    %r15
+  804c28:	5d                   	pop    %rbp
+  804c29:	c3                   	ret
+
+0000000000804c2a <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c2a:	55                   	push   %rbp
+  804c2b:	48 89 e5             	mov    %rsp,%rbp
+  804c2e:	41 57                	push   %r15
+  804c30:	41 56                	push   %r14
+  804c32:	41 55                	push   %r13
+  804c34:	41 54                	push   %r12
+  804c36:	53                   	push   %rbx
+  804c37:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c3b:	49 89 fe             	mov    %rdi,%r14
+  804c3e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c45:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c4c:	00 
+  804c4d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c54:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c5b:	00 00 00 
+  804c5e:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c65:	49 bf b1 48 80 00 00 	movabs $0x8048b1,%r15
+  804c6c:	00 00 00 
+  804c6f:	eb 09                	jmp    804c7a <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c71:	48 83 c3 20          	add    $0x20,%rbx
+  804c75:	4c 39 eb             	cmp    %r13,%rbx
+  804c78:	74 33                	je     804cad <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c7a:	48 89 df             	mov    %rbx,%rdi
+  804c7d:	48 8b 33             	mov    (%rbx),%rsi
+  804c80:	4c 39 e6             	cmp    %r12,%rsi
+  804c83:	73 ec                	jae    804c71 <msync+0x47>
+  804c85:	48 85 f6             	test   %rsi,%rsi
+  804c88:	74 e7                	je     804c71 <msync+0x47>
+  804c8a:	48 89 f2             	mov    %rsi,%rdx
+  804c8d:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804c91:	49 39 d6             	cmp    %rdx,%r14
+  804c94:	73 db                	jae    804c71 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c96:	4c 39 e2             	cmp    %r12,%rdx
+  804c99:	49 0f 47 d4          	cmova  %r12,%rdx
+  804c9d:	4c 39 f6             	cmp    %r14,%rsi
+  804ca0:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ca4:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804ca7:	85 c0                	test   %eax,%eax
+  804ca9:	79 c6                	jns    804c71 <msync+0x47>
+  804cab:	eb 05                	jmp    804cb2 <msync+0x88>
+    }
+
+    return 0;
+  804cad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cb2:	48 83 c4 08          	add    $0x8,%rsp
+  804cb6:	5b                   	pop    %rbx
+  804cb7:	41 5c                	pop    %r12
+  804cb9:	41 5d                	pop    %r13
+  804cbb:	41 5e                	pop    %r14
+  804cbd:	41 5f                	pop    %r15
+  804cbf:	5d                   	pop    %rbp
+  804cc0:	c3                   	ret
+
+0000000000804cc1 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cc1:	55                   	push   %rbp
+  804cc2:	48 89 e5             	mov    %rsp,%rbp
+  804cc5:	41 57                	push   %r15
+  804cc7:	41 56                	push   %r14
+  804cc9:	41 55                	push   %r13
+  804ccb:	41 54                	push   %r12
+  804ccd:	53                   	push   %rbx
+  804cce:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cd2:	49 89 ff             	mov    %rdi,%r15
+  804cd5:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cdc:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804ce3:	00 
+  804ce4:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ceb:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804cf2:	00 00 00 
+  804cf5:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cfc:	48 89 d8             	mov    %rbx,%rax
+  804cff:	eb 09                	jmp    804d0a <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d01:	48 83 c0 20          	add    $0x20,%rax
+  804d05:	4c 39 f0             	cmp    %r14,%rax
+  804d08:	74 40                	je     804d4a <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d0a:	48 8b 10             	mov    (%rax),%rdx
+  804d0d:	4c 39 e2             	cmp    %r12,%rdx
+  804d10:	73 ef                	jae    804d01 <munmap+0x40>
+  804d12:	48 85 d2             	test   %rdx,%rdx
+  804d15:	74 ea                	je     804d01 <munmap+0x40>
+  804d17:	48 89 d7             	mov    %rdx,%rdi
+  804d1a:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d1e:	49 39 ff             	cmp    %rdi,%r15
+  804d21:	73 de                	jae    804d01 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d23:	49 39 fc             	cmp    %rdi,%r12
+  804d26:	72 05                	jb     804d2d <munmap+0x6c>
+  804d28:	4c 39 fa             	cmp    %r15,%rdx
+  804d2b:	73 d4                	jae    804d01 <munmap+0x40>
+  804d2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d32:	48 83 c4 08          	add    $0x8,%rsp
+  804d36:	5b                   	pop    %rbx
+  804d37:	41 5c                	pop    %r12
+  804d39:	41 5d                	pop    %r13
+  804d3b:	41 5e                	pop    %r14
+  804d3d:	41 5f                	pop    %r15
+  804d3f:	5d                   	pop    %rbp
+  804d40:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d41:	48 83 c3 20          	add    $0x20,%rbx
+  804d45:	4c 39 f3             	cmp    %r14,%rbx
+  804d48:	74 5c                	je     804da6 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d4a:	48 8b 33             	mov    (%rbx),%rsi
+  804d4d:	4c 39 e6             	cmp    %r12,%rsi
+  804d50:	73 ef                	jae    804d41 <munmap+0x80>
+  804d52:	48 85 f6             	test   %rsi,%rsi
+  804d55:	74 ea                	je     804d41 <munmap+0x80>
+  804d57:	48 89 f2             	mov    %rsi,%rdx
+  804d5a:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d5e:	49 39 d7             	cmp    %rdx,%r15
+  804d61:	73 de                	jae    804d41 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d63:	48 89 df             	mov    %rbx,%rdi
+  804d66:	48 b8 b1 48 80 00 00 	movabs $0x8048b1,%rax
+  804d6d:	00 00 00 
+  804d70:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d72:	85 c0                	test   %eax,%eax
+  804d74:	78 bc                	js     804d32 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d76:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d7a:	48 8b 33             	mov    (%rbx),%rsi
+  804d7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d82:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  804d89:	00 00 00 
+  804d8c:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804d8e:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804d91:	48 b8 69 2f 80 00 00 	movabs $0x802f69,%rax
+  804d98:	00 00 00 
+  804d9b:	ff d0                	call   *%rax
+        reg->start = 0;
+  804d9d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804da4:	eb 9b                	jmp    804d41 <munmap+0x80>
+    return 0;
+  804da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dab:	eb 85                	jmp    804d32 <munmap+0x71>
+
+0000000000804dad <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db2:	c3                   	ret
+
+0000000000804db3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804db3:	55                   	push   %rbp
+  804db4:	48 89 e5             	mov    %rsp,%rbp
+  804db7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dba:	48 be c5 62 80 00 00 	movabs $0x8062c5,%rsi
+  804dc1:	00 00 00 
+  804dc4:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  804dcb:	00 00 00 
+  804dce:	ff d0                	call   *%rax
+    return 0;
+}
+  804dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd5:	5d                   	pop    %rbp
+  804dd6:	c3                   	ret
+
+0000000000804dd7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804dd7:	55                   	push   %rbp
+  804dd8:	48 89 e5             	mov    %rsp,%rbp
+  804ddb:	41 57                	push   %r15
+  804ddd:	41 56                	push   %r14
+  804ddf:	41 55                	push   %r13
+  804de1:	41 54                	push   %r12
+  804de3:	53                   	push   %rbx
+  804de4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804deb:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804df2:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804df9:	00 00 00 00 
+  804dfd:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e04:	00 00 00 00 
+  804e08:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e0f:	00 00 00 00 
+  804e13:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e1a:	00 00 00 00 
+  804e1e:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e25:	00 00 00 00 
+  804e29:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e30:	00 00 00 00 
+  804e34:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e3b:	00 
+  804e3c:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e43:	00 
+  804e44:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e4b:	00 
+  804e4c:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e53:	00 
+  804e54:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e5b:	00 
+  804e5c:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e63:	00 
+  804e64:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e6b:	00 
+  804e6c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e73:	00 
+  804e74:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e7b:	00 
+  804e7c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804e83:	00 
+    for (res = 0; res < n; res += inc) {
+  804e84:	48 85 d2             	test   %rdx,%rdx
+  804e87:	74 7a                	je     804f03 <devcons_write+0x12c>
+  804e89:	49 89 d6             	mov    %rdx,%r14
+  804e8c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e92:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804e97:	49 bf 03 23 80 00 00 	movabs $0x802303,%r15
+  804e9e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ea1:	4c 89 f3             	mov    %r14,%rbx
+  804ea4:	48 29 f3             	sub    %rsi,%rbx
+  804ea7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804eac:	48 39 c3             	cmp    %rax,%rbx
+  804eaf:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804eb3:	4c 63 eb             	movslq %ebx,%r13
+  804eb6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ebd:	48 01 c6             	add    %rax,%rsi
+  804ec0:	4c 89 ea             	mov    %r13,%rdx
+  804ec3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804eca:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ecd:	4c 89 ee             	mov    %r13,%rsi
+  804ed0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ed7:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  804ede:	00 00 00 
+  804ee1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804ee3:	41 01 dc             	add    %ebx,%r12d
+  804ee6:	49 63 f4             	movslq %r12d,%rsi
+  804ee9:	4c 39 f6             	cmp    %r14,%rsi
+  804eec:	72 b3                	jb     804ea1 <devcons_write+0xca>
+    return res;
+  804eee:	49 63 c4             	movslq %r12d,%rax
+}
+  804ef1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804ef8:	5b                   	pop    %rbx
+  804ef9:	41 5c                	pop    %r12
+  804efb:	41 5d                	pop    %r13
+  804efd:	41 5e                	pop    %r14
+  804eff:	41 5f                	pop    %r15
+  804f01:	5d                   	pop    %rbp
+  804f02:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f03:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f09:	eb e3                	jmp    804eee <devcons_write+0x117>
+
+0000000000804f0b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f0b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f13:	48 85 c0             	test   %rax,%rax
+  804f16:	74 55                	je     804f6d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f18:	55                   	push   %rbp
+  804f19:	48 89 e5             	mov    %rsp,%rbp
+  804f1c:	41 55                	push   %r13
+  804f1e:	41 54                	push   %r12
+  804f20:	53                   	push   %rbx
+  804f21:	48 83 ec 08          	sub    $0x8,%rsp
+  804f25:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f28:	48 bb 63 25 80 00 00 	movabs $0x802563,%rbx
+  804f2f:	00 00 00 
+  804f32:	49 bc 77 26 80 00 00 	movabs $0x802677,%r12
+  804f39:	00 00 00 
+  804f3c:	eb 03                	jmp    804f41 <devcons_read+0x36>
+  804f3e:	41 ff d4             	call   *%r12
+  804f41:	ff d3                	call   *%rbx
+  804f43:	85 c0                	test   %eax,%eax
+  804f45:	74 f7                	je     804f3e <devcons_read+0x33>
+    if (c < 0) return c;
+  804f47:	48 63 d0             	movslq %eax,%rdx
+  804f4a:	78 13                	js     804f5f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f51:	83 f8 04             	cmp    $0x4,%eax
+  804f54:	74 09                	je     804f5f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f56:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f5a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f5f:	48 89 d0             	mov    %rdx,%rax
+  804f62:	48 83 c4 08          	add    $0x8,%rsp
+  804f66:	5b                   	pop    %rbx
+  804f67:	41 5c                	pop    %r12
+  804f69:	41 5d                	pop    %r13
+  804f6b:	5d                   	pop    %rbp
+  804f6c:	c3                   	ret
+  804f6d:	48 89 d0             	mov    %rdx,%rax
+  804f70:	c3                   	ret
+
+0000000000804f71 <cputchar>:
+cputchar(int ch) {
+  804f71:	55                   	push   %rbp
+  804f72:	48 89 e5             	mov    %rsp,%rbp
+  804f75:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f79:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f7d:	be 01 00 00 00       	mov    $0x1,%esi
+  804f82:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804f86:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  804f8d:	00 00 00 
+  804f90:	ff d0                	call   *%rax
+}
+  804f92:	c9                   	leave
+  804f93:	c3                   	ret
+
+0000000000804f94 <getchar>:
+getchar(void) {
+  804f94:	55                   	push   %rbp
+  804f95:	48 89 e5             	mov    %rsp,%rbp
+  804f98:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804f9c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fa1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804faa:	48 b8 e7 30 80 00 00 	movabs $0x8030e7,%rax
+  804fb1:	00 00 00 
+  804fb4:	ff d0                	call   *%rax
+  804fb6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fb8:	85 c0                	test   %eax,%eax
+  804fba:	78 06                	js     804fc2 <getchar+0x2e>
+  804fbc:	74 08                	je     804fc6 <getchar+0x32>
+  804fbe:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fc2:	89 d0                	mov    %edx,%eax
+  804fc4:	c9                   	leave
+  804fc5:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fc6:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fcb:	eb f5                	jmp    804fc2 <getchar+0x2e>
+
+0000000000804fcd <iscons>:
+iscons(int fdnum) {
+  804fcd:	55                   	push   %rbp
+  804fce:	48 89 e5             	mov    %rsp,%rbp
+  804fd1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804fd5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fd9:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  804fe0:	00 00 00 
+  804fe3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fe5:	85 c0                	test   %eax,%eax
+  804fe7:	78 18                	js     805001 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804fe9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804fed:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804ff4:	00 00 00 
+  804ff7:	8b 00                	mov    (%rax),%eax
+  804ff9:	39 02                	cmp    %eax,(%rdx)
+  804ffb:	0f 94 c0             	sete   %al
+  804ffe:	0f b6 c0             	movzbl %al,%eax
+}
+  805001:	c9                   	leave
+  805002:	c3                   	ret
+
+0000000000805003 <opencons>:
+opencons(void) {
+  805003:	55                   	push   %rbp
+  805004:	48 89 e5             	mov    %rsp,%rbp
+  805007:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80500b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80500f:	48 b8 a4 2d 80 00 00 	movabs $0x802da4,%rax
+  805016:	00 00 00 
+  805019:	ff d0                	call   *%rax
+  80501b:	85 c0                	test   %eax,%eax
+  80501d:	78 49                	js     805068 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80501f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805024:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805029:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80502d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805032:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  805039:	00 00 00 
+  80503c:	ff d0                	call   *%rax
+  80503e:	85 c0                	test   %eax,%eax
+  805040:	78 26                	js     805068 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805042:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805046:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80504d:	00 00 
+  80504f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805051:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805055:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80505c:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  805063:	00 00 00 
+  805066:	ff d0                	call   *%rax
+}
+  805068:	c9                   	leave
+  805069:	c3                   	ret
+
+000000000080506a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80506a:	55                   	push   %rbp
+  80506b:	48 89 e5             	mov    %rsp,%rbp
+  80506e:	41 56                	push   %r14
+  805070:	41 55                	push   %r13
+  805072:	41 54                	push   %r12
+  805074:	53                   	push   %rbx
+  805075:	48 83 ec 50          	sub    $0x50,%rsp
+  805079:	49 89 fc             	mov    %rdi,%r12
+  80507c:	41 89 f5             	mov    %esi,%r13d
+  80507f:	48 89 d3             	mov    %rdx,%rbx
+  805082:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805086:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80508a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80508e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805095:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805099:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80509d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050a1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050a5:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050ac:	00 00 00 
+  8050af:	4c 8b 30             	mov    (%rax),%r14
+  8050b2:	48 b8 40 26 80 00 00 	movabs $0x802640,%rax
+  8050b9:	00 00 00 
+  8050bc:	ff d0                	call   *%rax
+  8050be:	89 c6                	mov    %eax,%esi
+  8050c0:	45 89 e8             	mov    %r13d,%r8d
+  8050c3:	4c 89 e1             	mov    %r12,%rcx
+  8050c6:	4c 89 f2             	mov    %r14,%rdx
+  8050c9:	48 bf d8 62 80 00 00 	movabs $0x8062d8,%rdi
+  8050d0:	00 00 00 
+  8050d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050d8:	49 bc 7c 16 80 00 00 	movabs $0x80167c,%r12
+  8050df:	00 00 00 
+  8050e2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8050e5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8050e9:	48 89 df             	mov    %rbx,%rdi
+  8050ec:	48 b8 18 16 80 00 00 	movabs $0x801618,%rax
+  8050f3:	00 00 00 
+  8050f6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8050f8:	48 bf b3 61 80 00 00 	movabs $0x8061b3,%rdi
+  8050ff:	00 00 00 
+  805102:	b8 00 00 00 00       	mov    $0x0,%eax
+  805107:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80510a:	cc                   	int3
+  80510b:	eb fd                	jmp    80510a <_panic+0xa0>
+
+000000000080510d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80510d:	55                   	push   %rbp
+  80510e:	48 89 e5             	mov    %rsp,%rbp
+  805111:	41 56                	push   %r14
+  805113:	41 55                	push   %r13
+  805115:	41 54                	push   %r12
+  805117:	53                   	push   %rbx
+  805118:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80511b:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805122:	00 00 00 
+  805125:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805129:	74 27                	je     805152 <_handle_vectored_pagefault+0x45>
+  80512b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805130:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805137:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80513a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80513d:	4c 89 e7             	mov    %r12,%rdi
+  805140:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805145:	84 c0                	test   %al,%al
+  805147:	75 45                	jne    80518e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805149:	48 83 c3 01          	add    $0x1,%rbx
+  80514d:	49 3b 1e             	cmp    (%r14),%rbx
+  805150:	72 eb                	jb     80513d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805152:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805159:	00 
+  80515a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80515f:	4d 8b 04 24          	mov    (%r12),%r8
+  805163:	48 ba 00 63 80 00 00 	movabs $0x806300,%rdx
+  80516a:	00 00 00 
+  80516d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805172:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  805179:	00 00 00 
+  80517c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805181:	49 ba 6a 50 80 00 00 	movabs $0x80506a,%r10
+  805188:	00 00 00 
+  80518b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80518e:	5b                   	pop    %rbx
+  80518f:	41 5c                	pop    %r12
+  805191:	41 5d                	pop    %r13
+  805193:	41 5e                	pop    %r14
+  805195:	5d                   	pop    %rbp
+  805196:	c3                   	ret
+
+0000000000805197 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805197:	55                   	push   %rbp
+  805198:	48 89 e5             	mov    %rsp,%rbp
+  80519b:	53                   	push   %rbx
+  80519c:	48 83 ec 08          	sub    $0x8,%rsp
+  8051a0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051a3:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051a8:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051af:	00 00 00 
+  8051b2:	80 38 00             	cmpb   $0x0,(%rax)
+  8051b5:	74 68                	je     80521f <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051b7:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051be:	00 00 00 
+  8051c1:	48 8b 08             	mov    (%rax),%rcx
+  8051c4:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051c9:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051d0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051d3:	48 85 c9             	test   %rcx,%rcx
+  8051d6:	0f 84 e0 00 00 00    	je     8052bc <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051dc:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8051e0:	0f 84 c9 00 00 00    	je     8052af <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051e6:	48 83 c2 01          	add    $0x1,%rdx
+  8051ea:	48 39 ca             	cmp    %rcx,%rdx
+  8051ed:	75 ed                	jne    8051dc <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8051ef:	48 83 f9 08          	cmp    $0x8,%rcx
+  8051f3:	0f 84 84 00 00 00    	je     80527d <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8051f9:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8051fd:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805204:	00 00 00 
+  805207:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80520e:	00 00 00 
+  805211:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805215:	85 f6                	test   %esi,%esi
+  805217:	0f 89 97 00 00 00    	jns    8052b4 <add_pgfault_handler+0x11d>
+  80521d:	eb 63                	jmp    805282 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80521f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805224:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805229:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805230:	00 00 00 
+  805233:	bf 00 00 00 00       	mov    $0x0,%edi
+  805238:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  80523f:	00 00 00 
+  805242:	ff d0                	call   *%rax
+  805244:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805246:	85 c0                	test   %eax,%eax
+  805248:	78 38                	js     805282 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80524a:	48 be 98 53 80 00 00 	movabs $0x805398,%rsi
+  805251:	00 00 00 
+  805254:	bf 00 00 00 00       	mov    $0x0,%edi
+  805259:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  805260:	00 00 00 
+  805263:	ff d0                	call   *%rax
+  805265:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805267:	85 c0                	test   %eax,%eax
+  805269:	78 17                	js     805282 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80526b:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805272:	00 00 00 
+  805275:	c6 00 01             	movb   $0x1,(%rax)
+  805278:	e9 3a ff ff ff       	jmp    8051b7 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80527d:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805282:	89 f1                	mov    %esi,%ecx
+  805284:	48 ba 3e 63 80 00 00 	movabs $0x80633e,%rdx
+  80528b:	00 00 00 
+  80528e:	be 42 00 00 00       	mov    $0x42,%esi
+  805293:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  80529a:	00 00 00 
+  80529d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052a2:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  8052a9:	00 00 00 
+  8052ac:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052af:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052b4:	89 f0                	mov    %esi,%eax
+  8052b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052ba:	c9                   	leave
+  8052bb:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052bc:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052c3:	00 00 00 
+  8052c6:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052cd:	48 89 d8             	mov    %rbx,%rax
+  8052d0:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052d7:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052da:	eb d8                	jmp    8052b4 <add_pgfault_handler+0x11d>
+
+00000000008052dc <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052dc:	55                   	push   %rbp
+  8052dd:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8052e0:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052e7:	00 00 00 
+  8052ea:	80 38 00             	cmpb   $0x0,(%rax)
+  8052ed:	74 33                	je     805322 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8052ef:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8052f6:	00 00 00 
+  8052f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8052fe:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805305:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805308:	48 85 c0             	test   %rax,%rax
+  80530b:	0f 84 85 00 00 00    	je     805396 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805311:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805315:	74 40                	je     805357 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805317:	48 83 c1 01          	add    $0x1,%rcx
+  80531b:	48 39 c1             	cmp    %rax,%rcx
+  80531e:	75 f1                	jne    805311 <remove_pgfault_handler+0x35>
+  805320:	eb 74                	jmp    805396 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805322:	48 b9 56 63 80 00 00 	movabs $0x806356,%rcx
+  805329:	00 00 00 
+  80532c:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  805333:	00 00 00 
+  805336:	be 48 00 00 00       	mov    $0x48,%esi
+  80533b:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  805342:	00 00 00 
+  805345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80534a:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  805351:	00 00 00 
+  805354:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805357:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80535e:	00 
+  80535f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805363:	48 29 ca             	sub    %rcx,%rdx
+  805366:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80536d:	00 00 00 
+  805370:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805374:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805379:	48 89 ce             	mov    %rcx,%rsi
+  80537c:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  805383:	00 00 00 
+  805386:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805388:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80538f:	00 00 00 
+  805392:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805396:	5d                   	pop    %rbp
+  805397:	c3                   	ret
+
+0000000000805398 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805398:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80539b:	48 b8 0d 51 80 00 00 	movabs $0x80510d,%rax
+  8053a2:	00 00 00 
+    call *%rax
+  8053a5:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053a7:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053ae:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053af:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053b6:	00 
+    subq $8, %rcx
+  8053b7:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053bb:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053be:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053c5:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053c6:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053ca:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053ce:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053d3:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053d8:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053dd:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8053e2:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8053e7:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8053ec:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8053f1:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8053f6:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8053fb:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805400:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805405:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80540a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80540f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805414:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805418:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80541c:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80541d:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80541e:	c3                   	ret
+
+000000000080541f <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80541f:	85 ff                	test   %edi,%edi
+  805421:	78 58                	js     80547b <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805423:	48 85 f6             	test   %rsi,%rsi
+  805426:	74 12                	je     80543a <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805428:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80542f:	00 00 00 
+  805432:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805438:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80543a:	48 85 c9             	test   %rcx,%rcx
+  80543d:	74 12                	je     805451 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80543f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805446:	00 00 00 
+  805449:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80544f:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805451:	48 85 d2             	test   %rdx,%rdx
+  805454:	74 14                	je     80546a <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805456:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80545d:	00 00 00 
+  805460:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805467:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80546a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805471:	00 00 00 
+  805474:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80547a:	c3                   	ret
+        if (from_env_store) {
+  80547b:	48 85 f6             	test   %rsi,%rsi
+  80547e:	74 06                	je     805486 <ipc_result+0x67>
+            *from_env_store = 0;
+  805480:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805486:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805488:	48 85 c9             	test   %rcx,%rcx
+  80548b:	74 ed                	je     80547a <ipc_result+0x5b>
+            *perm_store = 0;
+  80548d:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805493:	c3                   	ret
+
+0000000000805494 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805494:	55                   	push   %rbp
+  805495:	48 89 e5             	mov    %rsp,%rbp
+  805498:	41 55                	push   %r13
+  80549a:	41 54                	push   %r12
+  80549c:	53                   	push   %rbx
+  80549d:	48 83 ec 08          	sub    $0x8,%rsp
+  8054a1:	49 89 fc             	mov    %rdi,%r12
+  8054a4:	48 89 f7             	mov    %rsi,%rdi
+  8054a7:	48 89 d3             	mov    %rdx,%rbx
+  8054aa:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054ad:	48 85 f6             	test   %rsi,%rsi
+  8054b0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054b7:	00 00 00 
+  8054ba:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054be:	be 00 00 00 00       	mov    $0x0,%esi
+  8054c3:	48 85 d2             	test   %rdx,%rdx
+  8054c6:	74 03                	je     8054cb <ipc_recv+0x37>
+  8054c8:	48 8b 32             	mov    (%rdx),%rsi
+  8054cb:	48 b8 64 2c 80 00 00 	movabs $0x802c64,%rax
+  8054d2:	00 00 00 
+  8054d5:	ff d0                	call   *%rax
+  8054d7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054d9:	4c 89 e9             	mov    %r13,%rcx
+  8054dc:	48 89 da             	mov    %rbx,%rdx
+  8054df:	4c 89 e6             	mov    %r12,%rsi
+  8054e2:	48 b8 1f 54 80 00 00 	movabs $0x80541f,%rax
+  8054e9:	00 00 00 
+  8054ec:	ff d0                	call   *%rax
+}
+  8054ee:	48 83 c4 08          	add    $0x8,%rsp
+  8054f2:	5b                   	pop    %rbx
+  8054f3:	41 5c                	pop    %r12
+  8054f5:	41 5d                	pop    %r13
+  8054f7:	5d                   	pop    %rbp
+  8054f8:	c3                   	ret
+
+00000000008054f9 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8054f9:	55                   	push   %rbp
+  8054fa:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054fd:	48 85 d2             	test   %rdx,%rdx
+  805500:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805507:	00 00 00 
+  80550a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80550e:	89 f6                	mov    %esi,%esi
+  805510:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  805517:	00 00 00 
+  80551a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80551c:	85 c0                	test   %eax,%eax
+  80551e:	78 02                	js     805522 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805520:	5d                   	pop    %rbp
+  805521:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805522:	89 c1                	mov    %eax,%ecx
+  805524:	48 ba 70 63 80 00 00 	movabs $0x806370,%rdx
+  80552b:	00 00 00 
+  80552e:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805533:	48 bf 7d 63 80 00 00 	movabs $0x80637d,%rdi
+  80553a:	00 00 00 
+  80553d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805542:	49 b8 6a 50 80 00 00 	movabs $0x80506a,%r8
+  805549:	00 00 00 
+  80554c:	41 ff d0             	call   *%r8
+
+000000000080554f <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80554f:	55                   	push   %rbp
+  805550:	48 89 e5             	mov    %rsp,%rbp
+  805553:	53                   	push   %rbx
+  805554:	48 83 ec 08          	sub    $0x8,%rsp
+  805558:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80555c:	48 85 d2             	test   %rdx,%rdx
+  80555f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805566:	00 00 00 
+  805569:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80556d:	4d 85 c9             	test   %r9,%r9
+  805570:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805574:	b8 00 00 00 00       	mov    $0x0,%eax
+  805579:	48 85 db             	test   %rbx,%rbx
+  80557c:	74 03                	je     805581 <ipc_call+0x32>
+  80557e:	48 8b 03             	mov    (%rbx),%rax
+  805581:	89 f6                	mov    %esi,%esi
+  805583:	48 83 ec 08          	sub    $0x8,%rsp
+  805587:	50                   	push   %rax
+  805588:	48 b8 22 2b 80 00 00 	movabs $0x802b22,%rax
+  80558f:	00 00 00 
+  805592:	ff d0                	call   *%rax
+  805594:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805596:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80559a:	48 89 da             	mov    %rbx,%rdx
+  80559d:	be 00 00 00 00       	mov    $0x0,%esi
+  8055a2:	48 b8 1f 54 80 00 00 	movabs $0x80541f,%rax
+  8055a9:	00 00 00 
+  8055ac:	ff d0                	call   *%rax
+}
+  8055ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055b2:	c9                   	leave
+  8055b3:	c3                   	ret
+
+00000000008055b4 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055b4:	55                   	push   %rbp
+  8055b5:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055b8:	89 f6                	mov    %esi,%esi
+  8055ba:	48 b8 8e 2b 80 00 00 	movabs $0x802b8e,%rax
+  8055c1:	00 00 00 
+  8055c4:	ff d0                	call   *%rax
+  8055c6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8055d7:	48 b8 1f 54 80 00 00 	movabs $0x80541f,%rax
+  8055de:	00 00 00 
+  8055e1:	ff d0                	call   *%rax
+}
+  8055e3:	5d                   	pop    %rbp
+  8055e4:	c3                   	ret
+
+00000000008055e5 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8055e5:	55                   	push   %rbp
+  8055e6:	48 89 e5             	mov    %rsp,%rbp
+  8055e9:	41 54                	push   %r12
+  8055eb:	53                   	push   %rbx
+  8055ec:	4c 89 cb             	mov    %r9,%rbx
+  8055ef:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8055f3:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8055f7:	48 85 d2             	test   %rdx,%rdx
+  8055fa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805601:	00 00 00 
+  805604:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805608:	4d 85 c9             	test   %r9,%r9
+  80560b:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80560f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805614:	4d 85 e4             	test   %r12,%r12
+  805617:	74 04                	je     80561d <ipc_reply_wait+0x38>
+  805619:	49 8b 04 24          	mov    (%r12),%rax
+  80561d:	89 f6                	mov    %esi,%esi
+  80561f:	48 83 ec 08          	sub    $0x8,%rsp
+  805623:	50                   	push   %rax
+  805624:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  80562b:	00 00 00 
+  80562e:	ff d0                	call   *%rax
+  805630:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805632:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805636:	4c 89 e2             	mov    %r12,%rdx
+  805639:	48 89 de             	mov    %rbx,%rsi
+  80563c:	48 b8 1f 54 80 00 00 	movabs $0x80541f,%rax
+  805643:	00 00 00 
+  805646:	ff d0                	call   *%rax
+}
+  805648:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80564c:	5b                   	pop    %rbx
+  80564d:	41 5c                	pop    %r12
+  80564f:	5d                   	pop    %rbp
+  805650:	c3                   	ret
+
+0000000000805651 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805651:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805656:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80565d:	00 00 00 
+  805660:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805667:	48 01 ca             	add    %rcx,%rdx
+  80566a:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805670:	39 fa                	cmp    %edi,%edx
+  805672:	74 12                	je     805686 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805674:	48 83 c0 01          	add    $0x1,%rax
+  805678:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80567e:	75 e0                	jne    805660 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805680:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805685:	c3                   	ret
+            return envs[i].env_id;
+  805686:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80568d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805694:	00 00 00 
+  805697:	48 01 d0             	add    %rdx,%rax
+  80569a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056a0:	c3                   	ret
+  8056a1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008056a8 <__rodata_start>:
+  8056a8:	77 00                	ja     8056aa <__rodata_start+0x2>
+  8056aa:	72 62                	jb     80570e <__rodata_start+0x66>
+  8056ac:	00 77 62             	add    %dh,0x62(%rdi)
+  8056af:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056b2:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056b9:	00 
+  8056ba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8056c0:	b3 09                	mov    $0x9,%bl
+  8056c2:	80 00 00             	addb   $0x0,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 ed                	add    %ch,%ch
+  8056c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ce:	00 00                	add    %al,(%rax)
+  8056d0:	ed                   	in     (%dx),%eax
+  8056d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056d6:	00 00                	add    %al,(%rax)
+  8056d8:	ed                   	in     (%dx),%eax
+  8056d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	ed                   	in     (%dx),%eax
+  8056e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056e6:	00 00                	add    %al,(%rax)
+  8056e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 ed                	add    %ch,%ch
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	ed                   	in     (%dx),%eax
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	8c 0a                	mov    %cs,(%rdx)
+  80571a:	80 00 00             	addb   $0x0,(%rax)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805726:	00 00                	add    %al,(%rax)
+  805728:	8c 0a                	mov    %cs,(%rdx)
+  80572a:	80 00 00             	addb   $0x0,(%rax)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	ed                   	in     (%dx),%eax
+  805769:	0d 80 00 00 00       	or     $0x80,%eax
+  80576e:	00 00                	add    %al,(%rax)
+  805770:	ed                   	in     (%dx),%eax
+  805771:	0d 80 00 00 00       	or     $0x80,%eax
+  805776:	00 00                	add    %al,(%rax)
+  805778:	ed                   	in     (%dx),%eax
+  805779:	0d 80 00 00 00       	or     $0x80,%eax
+  80577e:	00 00                	add    %al,(%rax)
+  805780:	ed                   	in     (%dx),%eax
+  805781:	0d 80 00 00 00       	or     $0x80,%eax
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	f4                   	hlt
+  805859:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80585f:	00 ed                	add    %ch,%ch
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	2c 0b                	sub    $0xb,%al
+  805872:	80 00 00             	addb   $0x0,(%rax)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 ed                	add    %ch,%ch
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058b3:	00 00                	add    %al,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 cb                	add    %cl,%bl
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	6a 0a                	push   $0xa
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 ed                	add    %ch,%ch
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	3c 0a                	cmp    $0xa,%al
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 ed                	add    %ch,%ch
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80590b:	00 00                	add    %al,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 29                	add    %ch,(%rcx)
+  805919:	0c 80                	or     $0x80,%al
+  80591b:	00 00                	add    %al,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805922:	80 00 00             	addb   $0x0,(%rax)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	1a 0b                	sbb    (%rbx),%cl
+  805932:	80 00 00             	addb   $0x0,(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 ed                	add    %ch,%ch
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ce                   	(bad)
+  805941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	f4                   	hlt
+  805959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80595f:	00 37                	add    %dh,(%rdi)
+  805961:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805967:	00 5f 12             	add    %bl,0x12(%rdi)
+  80596a:	80 00 00             	addb   $0x0,(%rax)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 37                	add    %dh,(%rdi)
+  805971:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805977:	00 5f 12             	add    %bl,0x12(%rdi)
+  80597a:	80 00 00             	addb   $0x0,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80598b:	00 00                	add    %al,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 d2                	add    %dl,%dl
+  805991:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805997:	00 d2                	add    %dl,%dl
+  805999:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80599f:	00 d2                	add    %dl,%dl
+  8059a1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059a7:	00 d2                	add    %dl,%dl
+  8059a9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 f6                	add    %dh,%dh
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 f6                	add    %dh,%dh
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 22                	add    %ah,(%rdx)
+  805a11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a17:	00 22                	add    %ah,(%rdx)
+  805a19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a1f:	00 22                	add    %ah,(%rdx)
+  805a21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a27:	00 22                	add    %ah,(%rdx)
+  805a29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 46 12             	add    %al,0x12(%rsi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 22                	add    %ah,(%rdx)
+  805b21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b27:	00 22                	add    %ah,(%rdx)
+  805b29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 46 12             	add    %al,0x12(%rsi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805be0 <basefix.0>:
+  805be0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805bf0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c00:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c10:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c20:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c30:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c40:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c50:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c60:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c70:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805c80:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805c90:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805ca0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cb0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805cc0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cd0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805ce0:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805cf0:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d00:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d10:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d20:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d30:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d40:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d50:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d60:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d70:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805d80:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805d90:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805da0:	74 18 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     t...............
+  805db0:	bb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805dc0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805dd0:	cb 1e 80 00 00 00 00 00 93 18 80 00 00 00 00 00     ................
+  805de0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805df0:	87 18 80 00 00 00 00 00 01 19 80 00 00 00 00 00     ................
+  805e00:	cb 1e 80 00 00 00 00 00 87 18 80 00 00 00 00 00     ................
+  805e10:	cd 18 80 00 00 00 00 00 cd 18 80 00 00 00 00 00     ................
+  805e20:	cd 18 80 00 00 00 00 00 cd 18 80 00 00 00 00 00     ................
+  805e30:	cd 18 80 00 00 00 00 00 cd 18 80 00 00 00 00 00     ................
+  805e40:	cd 18 80 00 00 00 00 00 cd 18 80 00 00 00 00 00     ................
+  805e50:	cd 18 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805e60:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805e70:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805e80:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805e90:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805ea0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805eb0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805ec0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805ed0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805ee0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805ef0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f00:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f10:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f20:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f30:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f40:	cb 1e 80 00 00 00 00 00 e9 1d 80 00 00 00 00 00     ................
+  805f50:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f60:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f70:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f80:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805f90:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805fa0:	2f 19 80 00 00 00 00 00 fe 1a 80 00 00 00 00 00     /...............
+  805fb0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  805fc0:	cb 1e 80 00 00 00 00 00 24 19 80 00 00 00 00 00     ........$.......
+  805fd0:	5e 19 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ^...............
+  805fe0:	cb 1e 80 00 00 00 00 00 19 19 80 00 00 00 00 00     ................
+  805ff0:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  806000:	a7 1c 80 00 00 00 00 00 76 1d 80 00 00 00 00 00     ........v.......
+  806010:	cb 1e 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  806020:	f5 19 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  806030:	d2 1b 80 00 00 00 00 00 cb 1e 80 00 00 00 00 00     ................
+  806040:	cb 1e 80 00 00 00 00 00 e9 1d 80 00 00 00 00 00     ................
+  806050:	cb 1e 80 00 00 00 00 00 7d 18 80 00 00 00 00 00     ........}.......
+
+0000000000806060 <error_string>:
+	...
+  806068:	3e 5c 80 00 00 00 00 00 50 5c 80 00 00 00 00 00     >\......P\......
+  806078:	60 5c 80 00 00 00 00 00 72 5c 80 00 00 00 00 00     `\......r\......
+  806088:	80 5c 80 00 00 00 00 00 94 5c 80 00 00 00 00 00     .\.......\......
+  806098:	a9 5c 80 00 00 00 00 00 bc 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	ce 5c 80 00 00 00 00 00 e2 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	f2 5c 80 00 00 00 00 00 05 5d 80 00 00 00 00 00     .\.......]......
+  8060c8:	1c 5d 80 00 00 00 00 00 32 5d 80 00 00 00 00 00     .]......2]......
+  8060d8:	4a 5d 80 00 00 00 00 00 62 5d 80 00 00 00 00 00     J]......b]......
+  8060e8:	6f 5d 80 00 00 00 00 00 00 61 80 00 00 00 00 00     o].......a......
+  8060f8:	83 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806108:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806118:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806128:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806138:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806148:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806158:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806168:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806178:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806188:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806198:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008061e0 <devtab>:
+  8061e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8061f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806200:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806210:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806220:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806230:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806240:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806250:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806260:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806270:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806280:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806290:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062b0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062c0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062d0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8062e0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8062f0:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806300:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806310:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806320:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806330:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806340:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806350:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806360:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806370:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806380:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806390:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8063e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
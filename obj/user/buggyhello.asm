@@ -0,0 +1,10319 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 30 32 80 00 00 	movabs $0x803230,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 30 32 80 00 00 	movabs $0x803230,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 06 3c 80 00 00 	movabs $0x803c06,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 ff 1e 80 00 00 	movabs $0x801eff,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 06 3c 80 00 00 	movabs $0x803c06,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 ff 1e 80 00 00 	movabs $0x801eff,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 90 5c 80 00 00 	movabs $0x805c90,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 99 39 80 00 00 	movabs $0x803999,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 99 39 80 00 00 	movabs $0x803999,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be c2 56 80 00 00 	movabs $0x8056c2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 99 39 80 00 00 	movabs $0x803999,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be c5 56 80 00 00 	movabs $0x8056c5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 99 39 80 00 00 	movabs $0x803999,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 04 4a 80 00 00 	movabs $0x804a04,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 db 4c 80 00 00 	movabs $0x804cdb,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 83 2f 80 00 00 	movabs $0x802f83,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 e3 33 80 00 00 	movabs $0x8033e3,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 01 31 80 00 00 	movabs $0x803101,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 30 32 80 00 00 	movabs $0x803230,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 99 39 80 00 00 	movabs $0x803999,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 83 2f 80 00 00 	movabs $0x802f83,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 3c 22 80 00 00 	movabs $0x80223c,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 3c 22 80 00 00 	movabs $0x80223c,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 3c 22 80 00 00 	movabs $0x80223c,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 3c 22 80 00 00 	movabs $0x80223c,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 3c 22 80 00 00 	movabs $0x80223c,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 94 24 80 00 00 	movabs $0x802494,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 94 24 80 00 00 	movabs $0x802494,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 1e 00 00 00       	call   80151d <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs((char *)1, 1);
+  801505:	be 01 00 00 00       	mov    $0x1,%esi
+  80150a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80150f:	48 b8 4a 25 80 00 00 	movabs $0x80254a,%rax
+  801516:	00 00 00 
+  801519:	ff d0                	call   *%rax
+}
+  80151b:	5d                   	pop    %rbp
+  80151c:	c3                   	ret
+
+000000000080151d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80151d:	55                   	push   %rbp
+  80151e:	48 89 e5             	mov    %rsp,%rbp
+  801521:	41 56                	push   %r14
+  801523:	41 55                	push   %r13
+  801525:	41 54                	push   %r12
+  801527:	53                   	push   %rbx
+  801528:	41 89 fd             	mov    %edi,%r13d
+  80152b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80152e:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801535:	00 00 00 
+  801538:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80153f:	00 00 00 
+  801542:	48 39 c2             	cmp    %rax,%rdx
+  801545:	73 17                	jae    80155e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801547:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80154a:	49 89 c4             	mov    %rax,%r12
+  80154d:	48 83 c3 08          	add    $0x8,%rbx
+  801551:	b8 00 00 00 00       	mov    $0x0,%eax
+  801556:	ff 53 f8             	call   *-0x8(%rbx)
+  801559:	4c 39 e3             	cmp    %r12,%rbx
+  80155c:	72 ef                	jb     80154d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80155e:	48 b8 5a 26 80 00 00 	movabs $0x80265a,%rax
+  801565:	00 00 00 
+  801568:	ff d0                	call   *%rax
+  80156a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80156f:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801576:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80157d:	00 00 00 
+  801580:	48 01 d0             	add    %rdx,%rax
+  801583:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80158a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80158d:	45 85 ed             	test   %r13d,%r13d
+  801590:	7e 0d                	jle    80159f <libmain+0x82>
+  801592:	49 8b 06             	mov    (%r14),%rax
+  801595:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80159c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80159f:	4c 89 f6             	mov    %r14,%rsi
+  8015a2:	44 89 ef             	mov    %r13d,%edi
+  8015a5:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015ac:	00 00 00 
+  8015af:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015b1:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  8015b8:	00 00 00 
+  8015bb:	ff d0                	call   *%rax
+#endif
+}
+  8015bd:	5b                   	pop    %rbx
+  8015be:	41 5c                	pop    %r12
+  8015c0:	41 5d                	pop    %r13
+  8015c2:	41 5e                	pop    %r14
+  8015c4:	5d                   	pop    %rbp
+  8015c5:	c3                   	ret
+
+00000000008015c6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015c6:	55                   	push   %rbp
+  8015c7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015ca:	48 b8 b6 2f 80 00 00 	movabs $0x802fb6,%rax
+  8015d1:	00 00 00 
+  8015d4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015db:	48 b8 e9 25 80 00 00 	movabs $0x8025e9,%rax
+  8015e2:	00 00 00 
+  8015e5:	ff d0                	call   *%rax
+}
+  8015e7:	5d                   	pop    %rbp
+  8015e8:	c3                   	ret
+
+00000000008015e9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015e9:	55                   	push   %rbp
+  8015ea:	48 89 e5             	mov    %rsp,%rbp
+  8015ed:	53                   	push   %rbx
+  8015ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015f5:	8b 06                	mov    (%rsi),%eax
+  8015f7:	8d 50 01             	lea    0x1(%rax),%edx
+  8015fa:	89 16                	mov    %edx,(%rsi)
+  8015fc:	48 98                	cltq
+  8015fe:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801603:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801609:	74 0a                	je     801615 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80160b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80160f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801615:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801619:	be ff 00 00 00       	mov    $0xff,%esi
+  80161e:	48 b8 4a 25 80 00 00 	movabs $0x80254a,%rax
+  801625:	00 00 00 
+  801628:	ff d0                	call   *%rax
+        state->offset = 0;
+  80162a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801630:	eb d9                	jmp    80160b <putch+0x22>
+
+0000000000801632 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801632:	55                   	push   %rbp
+  801633:	48 89 e5             	mov    %rsp,%rbp
+  801636:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80163d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801640:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801647:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80164c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801651:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801654:	48 89 f1             	mov    %rsi,%rcx
+  801657:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80165e:	48 bf e9 15 80 00 00 	movabs $0x8015e9,%rdi
+  801665:	00 00 00 
+  801668:	48 b8 e6 17 80 00 00 	movabs $0x8017e6,%rax
+  80166f:	00 00 00 
+  801672:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801674:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80167b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801682:	48 b8 4a 25 80 00 00 	movabs $0x80254a,%rax
+  801689:	00 00 00 
+  80168c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80168e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801694:	c9                   	leave
+  801695:	c3                   	ret
+
+0000000000801696 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801696:	55                   	push   %rbp
+  801697:	48 89 e5             	mov    %rsp,%rbp
+  80169a:	48 83 ec 50          	sub    $0x50,%rsp
+  80169e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016a2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016aa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016ae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016b2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016c1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016c9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016cd:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016d9:	c9                   	leave
+  8016da:	c3                   	ret
+
+00000000008016db <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016db:	55                   	push   %rbp
+  8016dc:	48 89 e5             	mov    %rsp,%rbp
+  8016df:	41 57                	push   %r15
+  8016e1:	41 56                	push   %r14
+  8016e3:	41 55                	push   %r13
+  8016e5:	41 54                	push   %r12
+  8016e7:	53                   	push   %rbx
+  8016e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8016ec:	49 89 fc             	mov    %rdi,%r12
+  8016ef:	49 89 f5             	mov    %rsi,%r13
+  8016f2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016f6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8016f9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8016fc:	41 89 cf             	mov    %ecx,%r15d
+  8016ff:	4c 39 fa             	cmp    %r15,%rdx
+  801702:	73 5b                	jae    80175f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801704:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801708:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80170c:	85 db                	test   %ebx,%ebx
+  80170e:	7e 0e                	jle    80171e <print_num+0x43>
+            putch(padc, put_arg);
+  801710:	4c 89 ee             	mov    %r13,%rsi
+  801713:	44 89 f7             	mov    %r14d,%edi
+  801716:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801719:	83 eb 01             	sub    $0x1,%ebx
+  80171c:	75 f2                	jne    801710 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80171e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801722:	48 b9 3d 5c 80 00 00 	movabs $0x805c3d,%rcx
+  801729:	00 00 00 
+  80172c:	48 b8 2c 5c 80 00 00 	movabs $0x805c2c,%rax
+  801733:	00 00 00 
+  801736:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80173a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80173e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801743:	49 f7 f7             	div    %r15
+  801746:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80174a:	4c 89 ee             	mov    %r13,%rsi
+  80174d:	41 ff d4             	call   *%r12
+}
+  801750:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801754:	5b                   	pop    %rbx
+  801755:	41 5c                	pop    %r12
+  801757:	41 5d                	pop    %r13
+  801759:	41 5e                	pop    %r14
+  80175b:	41 5f                	pop    %r15
+  80175d:	5d                   	pop    %rbp
+  80175e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80175f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801763:	ba 00 00 00 00       	mov    $0x0,%edx
+  801768:	49 f7 f7             	div    %r15
+  80176b:	48 83 ec 08          	sub    $0x8,%rsp
+  80176f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801773:	52                   	push   %rdx
+  801774:	45 0f be c9          	movsbl %r9b,%r9d
+  801778:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80177c:	48 89 c2             	mov    %rax,%rdx
+  80177f:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801786:	00 00 00 
+  801789:	ff d0                	call   *%rax
+  80178b:	48 83 c4 10          	add    $0x10,%rsp
+  80178f:	eb 8d                	jmp    80171e <print_num+0x43>
+
+0000000000801791 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801791:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801795:	48 8b 06             	mov    (%rsi),%rax
+  801798:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80179c:	73 0a                	jae    8017a8 <sprintputch+0x17>
+        *state->start++ = ch;
+  80179e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017a2:	48 89 16             	mov    %rdx,(%rsi)
+  8017a5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017a8:	c3                   	ret
+
+00000000008017a9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017a9:	55                   	push   %rbp
+  8017aa:	48 89 e5             	mov    %rsp,%rbp
+  8017ad:	48 83 ec 50          	sub    $0x50,%rsp
+  8017b1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017b5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017b9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017bd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017c4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017cc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017d0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017d4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017d8:	48 b8 e6 17 80 00 00 	movabs $0x8017e6,%rax
+  8017df:	00 00 00 
+  8017e2:	ff d0                	call   *%rax
+}
+  8017e4:	c9                   	leave
+  8017e5:	c3                   	ret
+
+00000000008017e6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017e6:	55                   	push   %rbp
+  8017e7:	48 89 e5             	mov    %rsp,%rbp
+  8017ea:	41 57                	push   %r15
+  8017ec:	41 56                	push   %r14
+  8017ee:	41 55                	push   %r13
+  8017f0:	41 54                	push   %r12
+  8017f2:	53                   	push   %rbx
+  8017f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8017f7:	49 89 fe             	mov    %rdi,%r14
+  8017fa:	49 89 f5             	mov    %rsi,%r13
+  8017fd:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801800:	48 8b 01             	mov    (%rcx),%rax
+  801803:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801807:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80180b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80180f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801813:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801817:	eb 0d                	jmp    801826 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801819:	40 0f b6 ff          	movzbl %dil,%edi
+  80181d:	4c 89 ee             	mov    %r13,%rsi
+  801820:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801823:	4c 89 e3             	mov    %r12,%rbx
+  801826:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80182a:	0f b6 3b             	movzbl (%rbx),%edi
+  80182d:	40 80 ff 25          	cmp    $0x25,%dil
+  801831:	74 14                	je     801847 <vprintfmt+0x61>
+            if (!ch) return;
+  801833:	40 84 ff             	test   %dil,%dil
+  801836:	75 e1                	jne    801819 <vprintfmt+0x33>
+}
+  801838:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80183c:	5b                   	pop    %rbx
+  80183d:	41 5c                	pop    %r12
+  80183f:	41 5d                	pop    %r13
+  801841:	41 5e                	pop    %r14
+  801843:	41 5f                	pop    %r15
+  801845:	5d                   	pop    %rbp
+  801846:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801847:	be 00 00 00 00       	mov    $0x0,%esi
+  80184c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801850:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801855:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80185b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801862:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801866:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80186b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801870:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801873:	83 e8 23             	sub    $0x23,%eax
+  801876:	3c 57                	cmp    $0x57,%al
+  801878:	0f 87 67 06 00 00    	ja     801ee5 <vprintfmt+0x6ff>
+  80187e:	0f b6 c0             	movzbl %al,%eax
+  801881:	48 b9 c0 5d 80 00 00 	movabs $0x805dc0,%rcx
+  801888:	00 00 00 
+  80188b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80188e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801891:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801895:	eb cf                	jmp    801866 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801897:	49 89 dc             	mov    %rbx,%r12
+  80189a:	be 01 00 00 00       	mov    $0x1,%esi
+  80189f:	eb c5                	jmp    801866 <vprintfmt+0x80>
+            padc = ch;
+  8018a1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018a5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018a8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018ab:	eb b9                	jmp    801866 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8018b3:	77 24                	ja     8018d9 <vprintfmt+0xf3>
+  8018b5:	89 c1                	mov    %eax,%ecx
+  8018b7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018bb:	83 c0 08             	add    $0x8,%eax
+  8018be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018c1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018c4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018c7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018cb:	79 99                	jns    801866 <vprintfmt+0x80>
+                width = precision;
+  8018cd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018d1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018d7:	eb 8d                	jmp    801866 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018d9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018dd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018e5:	eb da                	jmp    8018c1 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018e7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018ec:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018f0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018f6:	3c 39                	cmp    $0x39,%al
+  8018f8:	77 1c                	ja     801916 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8018fa:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8018fe:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801902:	0f b6 c0             	movzbl %al,%eax
+  801905:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80190a:	0f b6 03             	movzbl (%rbx),%eax
+  80190d:	3c 39                	cmp    $0x39,%al
+  80190f:	76 e9                	jbe    8018fa <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801911:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801914:	eb b1                	jmp    8018c7 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801916:	49 89 dc             	mov    %rbx,%r12
+  801919:	eb ac                	jmp    8018c7 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80191b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80191e:	85 c9                	test   %ecx,%ecx
+  801920:	b8 00 00 00 00       	mov    $0x0,%eax
+  801925:	0f 49 c1             	cmovns %ecx,%eax
+  801928:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80192b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80192e:	e9 33 ff ff ff       	jmp    801866 <vprintfmt+0x80>
+            lflag++;
+  801933:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801936:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801939:	e9 28 ff ff ff       	jmp    801866 <vprintfmt+0x80>
+            lflag--;
+  80193e:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801941:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801944:	e9 1d ff ff ff       	jmp    801866 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801949:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80194c:	83 f8 2f             	cmp    $0x2f,%eax
+  80194f:	77 19                	ja     80196a <vprintfmt+0x184>
+  801951:	89 c2                	mov    %eax,%edx
+  801953:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801957:	83 c0 08             	add    $0x8,%eax
+  80195a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80195d:	8b 3a                	mov    (%rdx),%edi
+  80195f:	4c 89 ee             	mov    %r13,%rsi
+  801962:	41 ff d6             	call   *%r14
+            break;
+  801965:	e9 bc fe ff ff       	jmp    801826 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80196a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80196e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801972:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801976:	eb e5                	jmp    80195d <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801978:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80197b:	83 f8 2f             	cmp    $0x2f,%eax
+  80197e:	77 5a                	ja     8019da <vprintfmt+0x1f4>
+  801980:	89 c2                	mov    %eax,%edx
+  801982:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801986:	83 c0 08             	add    $0x8,%eax
+  801989:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80198c:	8b 02                	mov    (%rdx),%eax
+  80198e:	89 c1                	mov    %eax,%ecx
+  801990:	f7 d9                	neg    %ecx
+  801992:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801995:	83 f9 13             	cmp    $0x13,%ecx
+  801998:	7f 4e                	jg     8019e8 <vprintfmt+0x202>
+  80199a:	48 63 c1             	movslq %ecx,%rax
+  80199d:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8019a4:	00 00 00 
+  8019a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019ab:	48 85 c0             	test   %rax,%rax
+  8019ae:	74 38                	je     8019e8 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019b0:	48 89 c1             	mov    %rax,%rcx
+  8019b3:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8019ba:	00 00 00 
+  8019bd:	4c 89 ee             	mov    %r13,%rsi
+  8019c0:	4c 89 f7             	mov    %r14,%rdi
+  8019c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c8:	49 b8 a9 17 80 00 00 	movabs $0x8017a9,%r8
+  8019cf:	00 00 00 
+  8019d2:	41 ff d0             	call   *%r8
+  8019d5:	e9 4c fe ff ff       	jmp    801826 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019e6:	eb a4                	jmp    80198c <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019e8:	48 ba 55 5c 80 00 00 	movabs $0x805c55,%rdx
+  8019ef:	00 00 00 
+  8019f2:	4c 89 ee             	mov    %r13,%rsi
+  8019f5:	4c 89 f7             	mov    %r14,%rdi
+  8019f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fd:	49 b8 a9 17 80 00 00 	movabs $0x8017a9,%r8
+  801a04:	00 00 00 
+  801a07:	41 ff d0             	call   *%r8
+  801a0a:	e9 17 fe ff ff       	jmp    801826 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a12:	83 f8 2f             	cmp    $0x2f,%eax
+  801a15:	77 6c                	ja     801a83 <vprintfmt+0x29d>
+  801a17:	89 c2                	mov    %eax,%edx
+  801a19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a1d:	83 c0 08             	add    $0x8,%eax
+  801a20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a23:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a26:	48 85 f6             	test   %rsi,%rsi
+  801a29:	48 b8 4e 5c 80 00 00 	movabs $0x805c4e,%rax
+  801a30:	00 00 00 
+  801a33:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a37:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a3b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a3f:	7e 06                	jle    801a47 <vprintfmt+0x261>
+  801a41:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a45:	75 4a                	jne    801a91 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a47:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a4b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a4f:	0f b6 00             	movzbl (%rax),%eax
+  801a52:	84 c0                	test   %al,%al
+  801a54:	0f 85 9a 00 00 00    	jne    801af4 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a5a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a5d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	0f 8e bd fd ff ff    	jle    801826 <vprintfmt+0x40>
+  801a69:	4c 89 ee             	mov    %r13,%rsi
+  801a6c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a71:	41 ff d6             	call   *%r14
+  801a74:	41 83 ec 01          	sub    $0x1,%r12d
+  801a78:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a7c:	75 eb                	jne    801a69 <vprintfmt+0x283>
+  801a7e:	e9 a3 fd ff ff       	jmp    801826 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a8f:	eb 92                	jmp    801a23 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a91:	49 63 f7             	movslq %r15d,%rsi
+  801a94:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801a98:	48 b8 aa 1f 80 00 00 	movabs $0x801faa,%rax
+  801a9f:	00 00 00 
+  801aa2:	ff d0                	call   *%rax
+  801aa4:	48 89 c2             	mov    %rax,%rdx
+  801aa7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801aaa:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801aac:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801aaf:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	7e 91                	jle    801a47 <vprintfmt+0x261>
+  801ab6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801abb:	4c 89 ee             	mov    %r13,%rsi
+  801abe:	44 89 e7             	mov    %r12d,%edi
+  801ac1:	41 ff d6             	call   *%r14
+  801ac4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ac8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801acb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ace:	75 eb                	jne    801abb <vprintfmt+0x2d5>
+  801ad0:	e9 72 ff ff ff       	jmp    801a47 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ad5:	0f b6 f8             	movzbl %al,%edi
+  801ad8:	4c 89 ee             	mov    %r13,%rsi
+  801adb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ade:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ae2:	49 83 c4 01          	add    $0x1,%r12
+  801ae6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801aec:	84 c0                	test   %al,%al
+  801aee:	0f 84 66 ff ff ff    	je     801a5a <vprintfmt+0x274>
+  801af4:	45 85 ff             	test   %r15d,%r15d
+  801af7:	78 0a                	js     801b03 <vprintfmt+0x31d>
+  801af9:	41 83 ef 01          	sub    $0x1,%r15d
+  801afd:	0f 88 57 ff ff ff    	js     801a5a <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b03:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b07:	74 cc                	je     801ad5 <vprintfmt+0x2ef>
+  801b09:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b0c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b11:	80 fa 5e             	cmp    $0x5e,%dl
+  801b14:	77 c2                	ja     801ad8 <vprintfmt+0x2f2>
+  801b16:	eb bd                	jmp    801ad5 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b18:	40 84 f6             	test   %sil,%sil
+  801b1b:	75 26                	jne    801b43 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b1d:	85 d2                	test   %edx,%edx
+  801b1f:	74 59                	je     801b7a <vprintfmt+0x394>
+  801b21:	83 fa 01             	cmp    $0x1,%edx
+  801b24:	74 7b                	je     801ba1 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b29:	83 f8 2f             	cmp    $0x2f,%eax
+  801b2c:	0f 87 96 00 00 00    	ja     801bc8 <vprintfmt+0x3e2>
+  801b32:	89 c2                	mov    %eax,%edx
+  801b34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b38:	83 c0 08             	add    $0x8,%eax
+  801b3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b3e:	4c 8b 22             	mov    (%rdx),%r12
+  801b41:	eb 17                	jmp    801b5a <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b46:	83 f8 2f             	cmp    $0x2f,%eax
+  801b49:	77 21                	ja     801b6c <vprintfmt+0x386>
+  801b4b:	89 c2                	mov    %eax,%edx
+  801b4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b51:	83 c0 08             	add    $0x8,%eax
+  801b54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b57:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b5a:	4d 85 e4             	test   %r12,%r12
+  801b5d:	78 7a                	js     801bd9 <vprintfmt+0x3f3>
+            num = i;
+  801b5f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b62:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b67:	e9 56 02 00 00       	jmp    801dc2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b78:	eb dd                	jmp    801b57 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b7d:	83 f8 2f             	cmp    $0x2f,%eax
+  801b80:	77 11                	ja     801b93 <vprintfmt+0x3ad>
+  801b82:	89 c2                	mov    %eax,%edx
+  801b84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b88:	83 c0 08             	add    $0x8,%eax
+  801b8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b8e:	4c 63 22             	movslq (%rdx),%r12
+  801b91:	eb c7                	jmp    801b5a <vprintfmt+0x374>
+  801b93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b9f:	eb ed                	jmp    801b8e <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801ba1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ba4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ba7:	77 11                	ja     801bba <vprintfmt+0x3d4>
+  801ba9:	89 c2                	mov    %eax,%edx
+  801bab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801baf:	83 c0 08             	add    $0x8,%eax
+  801bb2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bb5:	4c 8b 22             	mov    (%rdx),%r12
+  801bb8:	eb a0                	jmp    801b5a <vprintfmt+0x374>
+  801bba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bc6:	eb ed                	jmp    801bb5 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bc8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bcc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd4:	e9 65 ff ff ff       	jmp    801b3e <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bd9:	4c 89 ee             	mov    %r13,%rsi
+  801bdc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801be1:	41 ff d6             	call   *%r14
+                i = -i;
+  801be4:	49 f7 dc             	neg    %r12
+  801be7:	e9 73 ff ff ff       	jmp    801b5f <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bec:	40 84 f6             	test   %sil,%sil
+  801bef:	75 2e                	jne    801c1f <vprintfmt+0x439>
+    switch (lflag) {
+  801bf1:	85 d2                	test   %edx,%edx
+  801bf3:	7f 59                	jg     801c4e <vprintfmt+0x468>
+  801bf5:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801bf8:	7d 7a                	jge    801c74 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801bfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bfd:	83 f8 2f             	cmp    $0x2f,%eax
+  801c00:	0f 87 aa 00 00 00    	ja     801cb0 <vprintfmt+0x4ca>
+  801c06:	89 c2                	mov    %eax,%edx
+  801c08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c0c:	83 c0 08             	add    $0x8,%eax
+  801c0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c12:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c15:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c1a:	e9 a3 01 00 00       	jmp    801dc2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c22:	83 f8 2f             	cmp    $0x2f,%eax
+  801c25:	77 19                	ja     801c40 <vprintfmt+0x45a>
+  801c27:	89 c2                	mov    %eax,%edx
+  801c29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c2d:	83 c0 08             	add    $0x8,%eax
+  801c30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c33:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c3b:	e9 82 01 00 00       	jmp    801dc2 <vprintfmt+0x5dc>
+  801c40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c4c:	eb e5                	jmp    801c33 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c4e:	83 fa 01             	cmp    $0x1,%edx
+  801c51:	75 a7                	jne    801bfa <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c56:	83 f8 2f             	cmp    $0x2f,%eax
+  801c59:	77 47                	ja     801ca2 <vprintfmt+0x4bc>
+  801c5b:	89 c2                	mov    %eax,%edx
+  801c5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c61:	83 c0 08             	add    $0x8,%eax
+  801c64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c67:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c6a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c6f:	e9 4e 01 00 00       	jmp    801dc2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c77:	83 f8 2f             	cmp    $0x2f,%eax
+  801c7a:	77 18                	ja     801c94 <vprintfmt+0x4ae>
+  801c7c:	89 c2                	mov    %eax,%edx
+  801c7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c82:	83 c0 08             	add    $0x8,%eax
+  801c85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c88:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c8a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c8f:	e9 2e 01 00 00       	jmp    801dc2 <vprintfmt+0x5dc>
+  801c94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca0:	eb e6                	jmp    801c88 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801ca2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cae:	eb b7                	jmp    801c67 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbc:	e9 51 ff ff ff       	jmp    801c12 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cc1:	40 84 f6             	test   %sil,%sil
+  801cc4:	75 2e                	jne    801cf4 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cc6:	85 d2                	test   %edx,%edx
+  801cc8:	7f 59                	jg     801d23 <vprintfmt+0x53d>
+  801cca:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ccd:	7d 77                	jge    801d46 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ccf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cd2:	83 f8 2f             	cmp    $0x2f,%eax
+  801cd5:	0f 87 a4 00 00 00    	ja     801d7f <vprintfmt+0x599>
+  801cdb:	89 c2                	mov    %eax,%edx
+  801cdd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ce1:	83 c0 08             	add    $0x8,%eax
+  801ce4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ce7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cea:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cef:	e9 ce 00 00 00       	jmp    801dc2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cf4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cf7:	83 f8 2f             	cmp    $0x2f,%eax
+  801cfa:	77 19                	ja     801d15 <vprintfmt+0x52f>
+  801cfc:	89 c2                	mov    %eax,%edx
+  801cfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d02:	83 c0 08             	add    $0x8,%eax
+  801d05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d0b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d10:	e9 ad 00 00 00       	jmp    801dc2 <vprintfmt+0x5dc>
+  801d15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d21:	eb e5                	jmp    801d08 <vprintfmt+0x522>
+    switch (lflag) {
+  801d23:	83 fa 01             	cmp    $0x1,%edx
+  801d26:	75 a7                	jne    801ccf <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d2b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d2e:	77 41                	ja     801d71 <vprintfmt+0x58b>
+  801d30:	89 c2                	mov    %eax,%edx
+  801d32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d36:	83 c0 08             	add    $0x8,%eax
+  801d39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d3f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d44:	eb 7c                	jmp    801dc2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d49:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4c:	77 15                	ja     801d63 <vprintfmt+0x57d>
+  801d4e:	89 c2                	mov    %eax,%edx
+  801d50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d54:	83 c0 08             	add    $0x8,%eax
+  801d57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d5c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d61:	eb 5f                	jmp    801dc2 <vprintfmt+0x5dc>
+  801d63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d6f:	eb e9                	jmp    801d5a <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7d:	eb bd                	jmp    801d3c <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8b:	e9 57 ff ff ff       	jmp    801ce7 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d90:	4c 89 ee             	mov    %r13,%rsi
+  801d93:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d98:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801d9b:	4c 89 ee             	mov    %r13,%rsi
+  801d9e:	bf 78 00 00 00       	mov    $0x78,%edi
+  801da3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801da6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801da9:	83 f8 2f             	cmp    $0x2f,%eax
+  801dac:	77 47                	ja     801df5 <vprintfmt+0x60f>
+  801dae:	89 c2                	mov    %eax,%edx
+  801db0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801db4:	83 c0 08             	add    $0x8,%eax
+  801db7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dbd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dc2:	48 83 ec 08          	sub    $0x8,%rsp
+  801dc6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dca:	0f 94 c0             	sete   %al
+  801dcd:	0f b6 c0             	movzbl %al,%eax
+  801dd0:	50                   	push   %rax
+  801dd1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801dd6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801dda:	4c 89 ee             	mov    %r13,%rsi
+  801ddd:	4c 89 f7             	mov    %r14,%rdi
+  801de0:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  801de7:	00 00 00 
+  801dea:	ff d0                	call   *%rax
+            break;
+  801dec:	48 83 c4 10          	add    $0x10,%rsp
+  801df0:	e9 31 fa ff ff       	jmp    801826 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801df5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801df9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e01:	eb b7                	jmp    801dba <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e03:	40 84 f6             	test   %sil,%sil
+  801e06:	75 2b                	jne    801e33 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e08:	85 d2                	test   %edx,%edx
+  801e0a:	7f 56                	jg     801e62 <vprintfmt+0x67c>
+  801e0c:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e0f:	7d 77                	jge    801e88 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e14:	83 f8 2f             	cmp    $0x2f,%eax
+  801e17:	0f 87 a7 00 00 00    	ja     801ec4 <vprintfmt+0x6de>
+  801e1d:	89 c2                	mov    %eax,%edx
+  801e1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e23:	83 c0 08             	add    $0x8,%eax
+  801e26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e2c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e31:	eb 8f                	jmp    801dc2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e36:	83 f8 2f             	cmp    $0x2f,%eax
+  801e39:	77 19                	ja     801e54 <vprintfmt+0x66e>
+  801e3b:	89 c2                	mov    %eax,%edx
+  801e3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e41:	83 c0 08             	add    $0x8,%eax
+  801e44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e4a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e4f:	e9 6e ff ff ff       	jmp    801dc2 <vprintfmt+0x5dc>
+  801e54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e60:	eb e5                	jmp    801e47 <vprintfmt+0x661>
+    switch (lflag) {
+  801e62:	83 fa 01             	cmp    $0x1,%edx
+  801e65:	75 aa                	jne    801e11 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e6a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e6d:	77 47                	ja     801eb6 <vprintfmt+0x6d0>
+  801e6f:	89 c2                	mov    %eax,%edx
+  801e71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e75:	83 c0 08             	add    $0x8,%eax
+  801e78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e7b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e7e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e83:	e9 3a ff ff ff       	jmp    801dc2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e8b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8e:	77 18                	ja     801ea8 <vprintfmt+0x6c2>
+  801e90:	89 c2                	mov    %eax,%edx
+  801e92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e96:	83 c0 08             	add    $0x8,%eax
+  801e99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e9c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801e9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ea3:	e9 1a ff ff ff       	jmp    801dc2 <vprintfmt+0x5dc>
+  801ea8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb4:	eb e6                	jmp    801e9c <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801eb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec2:	eb b7                	jmp    801e7b <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ec4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ecc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed0:	e9 54 ff ff ff       	jmp    801e29 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ed5:	4c 89 ee             	mov    %r13,%rsi
+  801ed8:	bf 25 00 00 00       	mov    $0x25,%edi
+  801edd:	41 ff d6             	call   *%r14
+            break;
+  801ee0:	e9 41 f9 ff ff       	jmp    801826 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ee5:	4c 89 ee             	mov    %r13,%rsi
+  801ee8:	bf 25 00 00 00       	mov    $0x25,%edi
+  801eed:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ef0:	48 83 eb 01          	sub    $0x1,%rbx
+  801ef4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801ef8:	75 f6                	jne    801ef0 <vprintfmt+0x70a>
+  801efa:	e9 27 f9 ff ff       	jmp    801826 <vprintfmt+0x40>
+
+0000000000801eff <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801eff:	55                   	push   %rbp
+  801f00:	48 89 e5             	mov    %rsp,%rbp
+  801f03:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f07:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f0b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f14:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f1b:	48 85 ff             	test   %rdi,%rdi
+  801f1e:	74 2b                	je     801f4b <vsnprintf+0x4c>
+  801f20:	48 85 f6             	test   %rsi,%rsi
+  801f23:	74 26                	je     801f4b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f25:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f29:	48 bf 91 17 80 00 00 	movabs $0x801791,%rdi
+  801f30:	00 00 00 
+  801f33:	48 b8 e6 17 80 00 00 	movabs $0x8017e6,%rax
+  801f3a:	00 00 00 
+  801f3d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f43:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f46:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f49:	c9                   	leave
+  801f4a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f50:	eb f7                	jmp    801f49 <vsnprintf+0x4a>
+
+0000000000801f52 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f52:	55                   	push   %rbp
+  801f53:	48 89 e5             	mov    %rsp,%rbp
+  801f56:	48 83 ec 50          	sub    $0x50,%rsp
+  801f5a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f5e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f62:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f66:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f75:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f79:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f7d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f81:	48 b8 ff 1e 80 00 00 	movabs $0x801eff,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+0000000000801f8f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f8f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f92:	74 10                	je     801fa4 <strlen+0x15>
+    size_t n = 0;
+  801f94:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801f99:	48 83 c0 01          	add    $0x1,%rax
+  801f9d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fa1:	75 f6                	jne    801f99 <strlen+0xa>
+  801fa3:	c3                   	ret
+    size_t n = 0;
+  801fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fa9:	c3                   	ret
+
+0000000000801faa <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801faa:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fad:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fb2:	48 85 f6             	test   %rsi,%rsi
+  801fb5:	74 11                	je     801fc8 <strnlen+0x1e>
+  801fb7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fbb:	74 0c                	je     801fc9 <strnlen+0x1f>
+  801fbd:	48 83 c2 01          	add    $0x1,%rdx
+  801fc1:	48 39 d0             	cmp    %rdx,%rax
+  801fc4:	75 f1                	jne    801fb7 <strnlen+0xd>
+  801fc6:	eb 04                	jmp    801fcc <strnlen+0x22>
+  801fc8:	c3                   	ret
+  801fc9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fcc:	c3                   	ret
+
+0000000000801fcd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fcd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fd9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fdc:	48 83 c2 01          	add    $0x1,%rdx
+  801fe0:	84 c9                	test   %cl,%cl
+  801fe2:	75 f1                	jne    801fd5 <strcpy+0x8>
+        ;
+    return res;
+}
+  801fe4:	c3                   	ret
+
+0000000000801fe5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fe5:	55                   	push   %rbp
+  801fe6:	48 89 e5             	mov    %rsp,%rbp
+  801fe9:	41 54                	push   %r12
+  801feb:	53                   	push   %rbx
+  801fec:	48 89 fb             	mov    %rdi,%rbx
+  801fef:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801ff2:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  801ff9:	00 00 00 
+  801ffc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801ffe:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802002:	4c 89 e6             	mov    %r12,%rsi
+  802005:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+    return dst;
+}
+  802011:	48 89 d8             	mov    %rbx,%rax
+  802014:	5b                   	pop    %rbx
+  802015:	41 5c                	pop    %r12
+  802017:	5d                   	pop    %rbp
+  802018:	c3                   	ret
+
+0000000000802019 <toupper>:
+
+int
+toupper(int ch) {
+  802019:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80201b:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80201e:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802021:	83 f9 1a             	cmp    $0x1a,%ecx
+  802024:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802027:	c3                   	ret
+
+0000000000802028 <tolower>:
+
+int
+tolower(int ch) {
+  802028:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80202a:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80202d:	8d 57 20             	lea    0x20(%rdi),%edx
+  802030:	83 f9 1a             	cmp    $0x1a,%ecx
+  802033:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802036:	c3                   	ret
+
+0000000000802037 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802037:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80203a:	48 85 d2             	test   %rdx,%rdx
+  80203d:	74 1f                	je     80205e <strncpy+0x27>
+  80203f:	48 01 fa             	add    %rdi,%rdx
+  802042:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802045:	48 83 c1 01          	add    $0x1,%rcx
+  802049:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80204d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802051:	41 80 f8 01          	cmp    $0x1,%r8b
+  802055:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802059:	48 39 ca             	cmp    %rcx,%rdx
+  80205c:	75 e7                	jne    802045 <strncpy+0xe>
+    }
+    return ret;
+}
+  80205e:	c3                   	ret
+
+000000000080205f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80205f:	48 89 f8             	mov    %rdi,%rax
+  802062:	48 85 d2             	test   %rdx,%rdx
+  802065:	74 24                	je     80208b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802067:	48 83 ea 01          	sub    $0x1,%rdx
+  80206b:	74 1b                	je     802088 <strlcpy+0x29>
+  80206d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802071:	0f b6 16             	movzbl (%rsi),%edx
+  802074:	84 d2                	test   %dl,%dl
+  802076:	74 10                	je     802088 <strlcpy+0x29>
+            *dst++ = *src++;
+  802078:	48 83 c6 01          	add    $0x1,%rsi
+  80207c:	48 83 c0 01          	add    $0x1,%rax
+  802080:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802083:	48 39 c8             	cmp    %rcx,%rax
+  802086:	75 e9                	jne    802071 <strlcpy+0x12>
+        *dst = '\0';
+  802088:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80208b:	48 29 f8             	sub    %rdi,%rax
+}
+  80208e:	c3                   	ret
+
+000000000080208f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80208f:	0f b6 07             	movzbl (%rdi),%eax
+  802092:	84 c0                	test   %al,%al
+  802094:	74 13                	je     8020a9 <strcmp+0x1a>
+  802096:	38 06                	cmp    %al,(%rsi)
+  802098:	75 0f                	jne    8020a9 <strcmp+0x1a>
+  80209a:	48 83 c7 01          	add    $0x1,%rdi
+  80209e:	48 83 c6 01          	add    $0x1,%rsi
+  8020a2:	0f b6 07             	movzbl (%rdi),%eax
+  8020a5:	84 c0                	test   %al,%al
+  8020a7:	75 ed                	jne    802096 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020a9:	0f b6 c0             	movzbl %al,%eax
+  8020ac:	0f b6 16             	movzbl (%rsi),%edx
+  8020af:	29 d0                	sub    %edx,%eax
+}
+  8020b1:	c3                   	ret
+
+00000000008020b2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020b2:	48 85 d2             	test   %rdx,%rdx
+  8020b5:	74 1f                	je     8020d6 <strncmp+0x24>
+  8020b7:	0f b6 07             	movzbl (%rdi),%eax
+  8020ba:	84 c0                	test   %al,%al
+  8020bc:	74 1e                	je     8020dc <strncmp+0x2a>
+  8020be:	3a 06                	cmp    (%rsi),%al
+  8020c0:	75 1a                	jne    8020dc <strncmp+0x2a>
+  8020c2:	48 83 c7 01          	add    $0x1,%rdi
+  8020c6:	48 83 c6 01          	add    $0x1,%rsi
+  8020ca:	48 83 ea 01          	sub    $0x1,%rdx
+  8020ce:	75 e7                	jne    8020b7 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d5:	c3                   	ret
+  8020d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020db:	c3                   	ret
+  8020dc:	48 85 d2             	test   %rdx,%rdx
+  8020df:	74 09                	je     8020ea <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020e1:	0f b6 07             	movzbl (%rdi),%eax
+  8020e4:	0f b6 16             	movzbl (%rsi),%edx
+  8020e7:	29 d0                	sub    %edx,%eax
+  8020e9:	c3                   	ret
+    if (!n) return 0;
+  8020ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ef:	c3                   	ret
+
+00000000008020f0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020f0:	0f b6 17             	movzbl (%rdi),%edx
+  8020f3:	84 d2                	test   %dl,%dl
+  8020f5:	74 18                	je     80210f <strchr+0x1f>
+        if (*str == c) {
+  8020f7:	0f be d2             	movsbl %dl,%edx
+  8020fa:	39 f2                	cmp    %esi,%edx
+  8020fc:	74 17                	je     802115 <strchr+0x25>
+    for (; *str; str++) {
+  8020fe:	48 83 c7 01          	add    $0x1,%rdi
+  802102:	0f b6 17             	movzbl (%rdi),%edx
+  802105:	84 d2                	test   %dl,%dl
+  802107:	75 ee                	jne    8020f7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210e:	c3                   	ret
+  80210f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802114:	c3                   	ret
+  802115:	48 89 f8             	mov    %rdi,%rax
+}
+  802118:	c3                   	ret
+
+0000000000802119 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802119:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80211c:	0f b6 17             	movzbl (%rdi),%edx
+  80211f:	84 d2                	test   %dl,%dl
+  802121:	74 13                	je     802136 <strfind+0x1d>
+  802123:	0f be d2             	movsbl %dl,%edx
+  802126:	39 f2                	cmp    %esi,%edx
+  802128:	74 0b                	je     802135 <strfind+0x1c>
+  80212a:	48 83 c0 01          	add    $0x1,%rax
+  80212e:	0f b6 10             	movzbl (%rax),%edx
+  802131:	84 d2                	test   %dl,%dl
+  802133:	75 ee                	jne    802123 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802135:	c3                   	ret
+  802136:	c3                   	ret
+
+0000000000802137 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802137:	48 39 f7             	cmp    %rsi,%rdi
+  80213a:	74 65                	je     8021a1 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80213c:	55                   	push   %rbp
+  80213d:	48 89 e5             	mov    %rsp,%rbp
+  802140:	41 57                	push   %r15
+  802142:	41 56                	push   %r14
+  802144:	41 55                	push   %r13
+  802146:	41 54                	push   %r12
+  802148:	53                   	push   %rbx
+  802149:	48 83 ec 18          	sub    $0x18,%rsp
+  80214d:	48 89 fb             	mov    %rdi,%rbx
+  802150:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802153:	49 bf 28 20 80 00 00 	movabs $0x802028,%r15
+  80215a:	00 00 00 
+  80215d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802161:	41 0f b6 fd          	movzbl %r13b,%edi
+  802165:	41 ff d7             	call   *%r15
+  802168:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80216b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802170:	41 0f b6 fe          	movzbl %r14b,%edi
+  802174:	41 ff d7             	call   *%r15
+  802177:	89 c2                	mov    %eax,%edx
+  802179:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80217c:	29 d0                	sub    %edx,%eax
+  80217e:	75 12                	jne    802192 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802180:	48 83 c3 01          	add    $0x1,%rbx
+  802184:	45 84 ed             	test   %r13b,%r13b
+  802187:	74 09                	je     802192 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802189:	49 83 c4 01          	add    $0x1,%r12
+  80218d:	45 84 f6             	test   %r14b,%r14b
+  802190:	75 cb                	jne    80215d <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802192:	48 83 c4 18          	add    $0x18,%rsp
+  802196:	5b                   	pop    %rbx
+  802197:	41 5c                	pop    %r12
+  802199:	41 5d                	pop    %r13
+  80219b:	41 5e                	pop    %r14
+  80219d:	41 5f                	pop    %r15
+  80219f:	5d                   	pop    %rbp
+  8021a0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021a6:	c3                   	ret
+
+00000000008021a7 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021a7:	48 39 f7             	cmp    %rsi,%rdi
+  8021aa:	74 7d                	je     802229 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021ac:	55                   	push   %rbp
+  8021ad:	48 89 e5             	mov    %rsp,%rbp
+  8021b0:	41 57                	push   %r15
+  8021b2:	41 56                	push   %r14
+  8021b4:	41 55                	push   %r13
+  8021b6:	41 54                	push   %r12
+  8021b8:	53                   	push   %rbx
+  8021b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021bd:	48 89 fb             	mov    %rdi,%rbx
+  8021c0:	49 89 f4             	mov    %rsi,%r12
+  8021c3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021cb:	49 bf 28 20 80 00 00 	movabs $0x802028,%r15
+  8021d2:	00 00 00 
+    while (n--) {
+  8021d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021d9:	48 39 c3             	cmp    %rax,%rbx
+  8021dc:	74 37                	je     802215 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021de:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021e2:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021e6:	41 ff d7             	call   *%r15
+  8021e9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021ec:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021f1:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021f5:	41 ff d7             	call   *%r15
+  8021f8:	89 c2                	mov    %eax,%edx
+  8021fa:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021fd:	29 d0                	sub    %edx,%eax
+  8021ff:	75 19                	jne    80221a <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802201:	48 83 c3 01          	add    $0x1,%rbx
+  802205:	45 84 ed             	test   %r13b,%r13b
+  802208:	74 10                	je     80221a <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80220a:	49 83 c4 01          	add    $0x1,%r12
+  80220e:	45 84 f6             	test   %r14b,%r14b
+  802211:	75 c2                	jne    8021d5 <strncasecmp+0x2e>
+  802213:	eb 05                	jmp    80221a <strncasecmp+0x73>
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80221a:	48 83 c4 18          	add    $0x18,%rsp
+  80221e:	5b                   	pop    %rbx
+  80221f:	41 5c                	pop    %r12
+  802221:	41 5d                	pop    %r13
+  802223:	41 5e                	pop    %r14
+  802225:	41 5f                	pop    %r15
+  802227:	5d                   	pop    %rbp
+  802228:	c3                   	ret
+    if (p1 == p2) return 0;
+  802229:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222e:	c3                   	ret
+
+000000000080222f <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80222f:	83 e7 df             	and    $0xffffffdf,%edi
+  802232:	83 ef 41             	sub    $0x41,%edi
+  802235:	83 ff 19             	cmp    $0x19,%edi
+  802238:	0f 96 c0             	setbe  %al
+}
+  80223b:	c3                   	ret
+
+000000000080223c <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80223c:	83 ff 20             	cmp    $0x20,%edi
+  80223f:	0f 94 c0             	sete   %al
+  802242:	83 ff 09             	cmp    $0x9,%edi
+  802245:	0f 94 c2             	sete   %dl
+  802248:	09 d0                	or     %edx,%eax
+}
+  80224a:	c3                   	ret
+
+000000000080224b <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80224b:	55                   	push   %rbp
+  80224c:	48 89 e5             	mov    %rsp,%rbp
+  80224f:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802251:	48 bf 3f 61 80 00 00 	movabs $0x80613f,%rdi
+  802258:	00 00 00 
+  80225b:	48 b8 f0 20 80 00 00 	movabs $0x8020f0,%rax
+  802262:	00 00 00 
+  802265:	ff d0                	call   *%rax
+  802267:	48 85 c0             	test   %rax,%rax
+  80226a:	0f 95 c0             	setne  %al
+}
+  80226d:	5d                   	pop    %rbp
+  80226e:	c3                   	ret
+
+000000000080226f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80226f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802272:	48 89 f8             	mov    %rdi,%rax
+  802275:	48 f7 d8             	neg    %rax
+  802278:	83 e0 07             	and    $0x7,%eax
+  80227b:	49 89 d1             	mov    %rdx,%r9
+  80227e:	49 29 c1             	sub    %rax,%r9
+  802281:	78 36                	js     8022b9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802283:	40 0f b6 c6          	movzbl %sil,%eax
+  802287:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80228e:	01 01 01 
+  802291:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802295:	40 f6 c7 07          	test   $0x7,%dil
+  802299:	75 38                	jne    8022d3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80229b:	4c 89 c9             	mov    %r9,%rcx
+  80229e:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022a2:	74 0c                	je     8022b0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022a4:	fc                   	cld
+  8022a5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022a8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022ac:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022b0:	4d 85 c9             	test   %r9,%r9
+  8022b3:	75 45                	jne    8022fa <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022b5:	4c 89 c0             	mov    %r8,%rax
+  8022b8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022b9:	48 85 d2             	test   %rdx,%rdx
+  8022bc:	74 f7                	je     8022b5 <memset+0x46>
+  8022be:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022c1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022c4:	48 83 c0 01          	add    $0x1,%rax
+  8022c8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022cc:	48 39 c2             	cmp    %rax,%rdx
+  8022cf:	75 f3                	jne    8022c4 <memset+0x55>
+  8022d1:	eb e2                	jmp    8022b5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022d3:	40 f6 c7 01          	test   $0x1,%dil
+  8022d7:	74 06                	je     8022df <memset+0x70>
+  8022d9:	88 07                	mov    %al,(%rdi)
+  8022db:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022df:	40 f6 c7 02          	test   $0x2,%dil
+  8022e3:	74 07                	je     8022ec <memset+0x7d>
+  8022e5:	66 89 07             	mov    %ax,(%rdi)
+  8022e8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022ec:	40 f6 c7 04          	test   $0x4,%dil
+  8022f0:	74 a9                	je     80229b <memset+0x2c>
+  8022f2:	89 07                	mov    %eax,(%rdi)
+  8022f4:	48 83 c7 04          	add    $0x4,%rdi
+  8022f8:	eb a1                	jmp    80229b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022fa:	41 f6 c1 04          	test   $0x4,%r9b
+  8022fe:	74 06                	je     802306 <memset+0x97>
+  802300:	89 07                	mov    %eax,(%rdi)
+  802302:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802306:	41 f6 c1 02          	test   $0x2,%r9b
+  80230a:	74 07                	je     802313 <memset+0xa4>
+  80230c:	66 89 07             	mov    %ax,(%rdi)
+  80230f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802313:	41 f6 c1 01          	test   $0x1,%r9b
+  802317:	74 9c                	je     8022b5 <memset+0x46>
+  802319:	88 07                	mov    %al,(%rdi)
+  80231b:	eb 98                	jmp    8022b5 <memset+0x46>
+
+000000000080231d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80231d:	48 89 f8             	mov    %rdi,%rax
+  802320:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802323:	48 39 fe             	cmp    %rdi,%rsi
+  802326:	73 3b                	jae    802363 <memmove+0x46>
+  802328:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80232c:	48 39 d7             	cmp    %rdx,%rdi
+  80232f:	73 32                	jae    802363 <memmove+0x46>
+        s += n;
+        d += n;
+  802331:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802335:	48 89 d6             	mov    %rdx,%rsi
+  802338:	48 09 fe             	or     %rdi,%rsi
+  80233b:	48 09 ce             	or     %rcx,%rsi
+  80233e:	40 f6 c6 07          	test   $0x7,%sil
+  802342:	75 12                	jne    802356 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802344:	48 83 ef 08          	sub    $0x8,%rdi
+  802348:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80234c:	48 c1 e9 03          	shr    $0x3,%rcx
+  802350:	fd                   	std
+  802351:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802354:	fc                   	cld
+  802355:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802356:	48 83 ef 01          	sub    $0x1,%rdi
+  80235a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80235e:	fd                   	std
+  80235f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802361:	eb f1                	jmp    802354 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802363:	48 89 f2             	mov    %rsi,%rdx
+  802366:	48 09 c2             	or     %rax,%rdx
+  802369:	48 09 ca             	or     %rcx,%rdx
+  80236c:	f6 c2 07             	test   $0x7,%dl
+  80236f:	75 0c                	jne    80237d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802371:	48 c1 e9 03          	shr    $0x3,%rcx
+  802375:	48 89 c7             	mov    %rax,%rdi
+  802378:	fc                   	cld
+  802379:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80237c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80237d:	48 89 c7             	mov    %rax,%rdi
+  802380:	fc                   	cld
+  802381:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802383:	c3                   	ret
+
+0000000000802384 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802384:	55                   	push   %rbp
+  802385:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802388:	48 b8 1d 23 80 00 00 	movabs $0x80231d,%rax
+  80238f:	00 00 00 
+  802392:	ff d0                	call   *%rax
+}
+  802394:	5d                   	pop    %rbp
+  802395:	c3                   	ret
+
+0000000000802396 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802396:	55                   	push   %rbp
+  802397:	48 89 e5             	mov    %rsp,%rbp
+  80239a:	41 57                	push   %r15
+  80239c:	41 56                	push   %r14
+  80239e:	41 55                	push   %r13
+  8023a0:	41 54                	push   %r12
+  8023a2:	53                   	push   %rbx
+  8023a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a7:	49 89 fe             	mov    %rdi,%r14
+  8023aa:	49 89 f7             	mov    %rsi,%r15
+  8023ad:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023b0:	48 89 f7             	mov    %rsi,%rdi
+  8023b3:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  8023ba:	00 00 00 
+  8023bd:	ff d0                	call   *%rax
+  8023bf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023c2:	48 89 de             	mov    %rbx,%rsi
+  8023c5:	4c 89 f7             	mov    %r14,%rdi
+  8023c8:	48 b8 aa 1f 80 00 00 	movabs $0x801faa,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+  8023d4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023d7:	48 39 c3             	cmp    %rax,%rbx
+  8023da:	74 36                	je     802412 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023dc:	48 89 d8             	mov    %rbx,%rax
+  8023df:	4c 29 e8             	sub    %r13,%rax
+  8023e2:	49 39 c4             	cmp    %rax,%r12
+  8023e5:	73 31                	jae    802418 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023e7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023ec:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023f0:	4c 89 fe             	mov    %r15,%rsi
+  8023f3:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  8023fa:	00 00 00 
+  8023fd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8023ff:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802403:	48 83 c4 08          	add    $0x8,%rsp
+  802407:	5b                   	pop    %rbx
+  802408:	41 5c                	pop    %r12
+  80240a:	41 5d                	pop    %r13
+  80240c:	41 5e                	pop    %r14
+  80240e:	41 5f                	pop    %r15
+  802410:	5d                   	pop    %rbp
+  802411:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802412:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802416:	eb eb                	jmp    802403 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802418:	48 83 eb 01          	sub    $0x1,%rbx
+  80241c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802420:	48 89 da             	mov    %rbx,%rdx
+  802423:	4c 89 fe             	mov    %r15,%rsi
+  802426:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802432:	49 01 de             	add    %rbx,%r14
+  802435:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80243a:	eb c3                	jmp    8023ff <strlcat+0x69>
+
+000000000080243c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80243c:	48 85 d2             	test   %rdx,%rdx
+  80243f:	74 2d                	je     80246e <memcmp+0x32>
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802446:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80244a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80244f:	44 38 c1             	cmp    %r8b,%cl
+  802452:	75 0f                	jne    802463 <memcmp+0x27>
+    while (n-- > 0) {
+  802454:	48 83 c0 01          	add    $0x1,%rax
+  802458:	48 39 c2             	cmp    %rax,%rdx
+  80245b:	75 e9                	jne    802446 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80245d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802462:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802463:	0f b6 c1             	movzbl %cl,%eax
+  802466:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80246a:	44 29 c0             	sub    %r8d,%eax
+  80246d:	c3                   	ret
+    return 0;
+  80246e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802473:	c3                   	ret
+
+0000000000802474 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802474:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802478:	48 39 c7             	cmp    %rax,%rdi
+  80247b:	73 0f                	jae    80248c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80247d:	40 38 37             	cmp    %sil,(%rdi)
+  802480:	74 0e                	je     802490 <memfind+0x1c>
+    for (; src < end; src++) {
+  802482:	48 83 c7 01          	add    $0x1,%rdi
+  802486:	48 39 f8             	cmp    %rdi,%rax
+  802489:	75 f2                	jne    80247d <memfind+0x9>
+  80248b:	c3                   	ret
+  80248c:	48 89 f8             	mov    %rdi,%rax
+  80248f:	c3                   	ret
+  802490:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802493:	c3                   	ret
+
+0000000000802494 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802494:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802497:	0f b6 37             	movzbl (%rdi),%esi
+  80249a:	40 80 fe 20          	cmp    $0x20,%sil
+  80249e:	74 06                	je     8024a6 <strtol+0x12>
+  8024a0:	40 80 fe 09          	cmp    $0x9,%sil
+  8024a4:	75 13                	jne    8024b9 <strtol+0x25>
+  8024a6:	48 83 c7 01          	add    $0x1,%rdi
+  8024aa:	0f b6 37             	movzbl (%rdi),%esi
+  8024ad:	40 80 fe 20          	cmp    $0x20,%sil
+  8024b1:	74 f3                	je     8024a6 <strtol+0x12>
+  8024b3:	40 80 fe 09          	cmp    $0x9,%sil
+  8024b7:	74 ed                	je     8024a6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024b9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024bc:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024bf:	3c 01                	cmp    $0x1,%al
+  8024c1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024c5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024cb:	75 0f                	jne    8024dc <strtol+0x48>
+  8024cd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024d0:	74 14                	je     8024e6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024d2:	85 d2                	test   %edx,%edx
+  8024d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024d9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024dc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024e1:	4c 63 ca             	movslq %edx,%r9
+  8024e4:	eb 36                	jmp    80251c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024e6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024ea:	74 0f                	je     8024fb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024ec:	85 d2                	test   %edx,%edx
+  8024ee:	75 ec                	jne    8024dc <strtol+0x48>
+        s++;
+  8024f0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024f4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8024f9:	eb e1                	jmp    8024dc <strtol+0x48>
+        s += 2;
+  8024fb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8024ff:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802504:	eb d6                	jmp    8024dc <strtol+0x48>
+            dig -= '0';
+  802506:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802509:	44 0f b6 c1          	movzbl %cl,%r8d
+  80250d:	41 39 d0             	cmp    %edx,%r8d
+  802510:	7d 21                	jge    802533 <strtol+0x9f>
+        val = val * base + dig;
+  802512:	49 0f af c1          	imul   %r9,%rax
+  802516:	0f b6 c9             	movzbl %cl,%ecx
+  802519:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80251c:	48 83 c7 01          	add    $0x1,%rdi
+  802520:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802524:	80 f9 39             	cmp    $0x39,%cl
+  802527:	76 dd                	jbe    802506 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802529:	80 f9 7b             	cmp    $0x7b,%cl
+  80252c:	77 05                	ja     802533 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80252e:	83 e9 57             	sub    $0x57,%ecx
+  802531:	eb d6                	jmp    802509 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802533:	4d 85 d2             	test   %r10,%r10
+  802536:	74 03                	je     80253b <strtol+0xa7>
+  802538:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80253b:	48 89 c2             	mov    %rax,%rdx
+  80253e:	48 f7 da             	neg    %rdx
+  802541:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802545:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802549:	c3                   	ret
+
+000000000080254a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80254a:	55                   	push   %rbp
+  80254b:	48 89 e5             	mov    %rsp,%rbp
+  80254e:	53                   	push   %rbx
+  80254f:	48 89 fa             	mov    %rdi,%rdx
+  802552:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802555:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80255a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80255f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802564:	be 00 00 00 00       	mov    $0x0,%esi
+  802569:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80256f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802575:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802577:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80257b:	c9                   	leave
+  80257c:	c3                   	ret
+
+000000000080257d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802582:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802596:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80259b:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025ac:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025b2:	c9                   	leave
+  8025b3:	c3                   	ret
+
+00000000008025b4 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025b4:	55                   	push   %rbp
+  8025b5:	48 89 e5             	mov    %rsp,%rbp
+  8025b8:	53                   	push   %rbx
+  8025b9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025bc:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025e1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025e7:	c9                   	leave
+  8025e8:	c3                   	ret
+
+00000000008025e9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025e9:	55                   	push   %rbp
+  8025ea:	48 89 e5             	mov    %rsp,%rbp
+  8025ed:	53                   	push   %rbx
+  8025ee:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025f5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802604:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802609:	be 00 00 00 00       	mov    $0x0,%esi
+  80260e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802614:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80261a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80261c:	48 85 c0             	test   %rax,%rax
+  80261f:	7f 06                	jg     802627 <sys_env_destroy+0x3e>
+}
+  802621:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802625:	c9                   	leave
+  802626:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802627:	49 89 c0             	mov    %rax,%r8
+  80262a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80262f:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802636:	00 00 00 
+  802639:	be 27 00 00 00       	mov    $0x27,%esi
+  80263e:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802645:	00 00 00 
+  802648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264d:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802654:	00 00 00 
+  802657:	41 ff d1             	call   *%r9
+
+000000000080265a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80265a:	55                   	push   %rbp
+  80265b:	48 89 e5             	mov    %rsp,%rbp
+  80265e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80265f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802664:	ba 00 00 00 00       	mov    $0x0,%edx
+  802669:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80266e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802673:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802678:	be 00 00 00 00       	mov    $0x0,%esi
+  80267d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802683:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802689:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80268b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80268f:	c9                   	leave
+  802690:	c3                   	ret
+
+0000000000802691 <sys_yield>:
+
+void
+sys_yield(void) {
+  802691:	55                   	push   %rbp
+  802692:	48 89 e5             	mov    %rsp,%rbp
+  802695:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802696:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80269b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026af:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026c0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026c6:	c9                   	leave
+  8026c7:	c3                   	ret
+
+00000000008026c8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026c8:	55                   	push   %rbp
+  8026c9:	48 89 e5             	mov    %rsp,%rbp
+  8026cc:	53                   	push   %rbx
+  8026cd:	48 89 fa             	mov    %rdi,%rdx
+  8026d0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026d3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026d8:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026df:	00 00 00 
+  8026e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026f8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8026fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026fe:	c9                   	leave
+  8026ff:	c3                   	ret
+
+0000000000802700 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802700:	55                   	push   %rbp
+  802701:	48 89 e5             	mov    %rsp,%rbp
+  802704:	53                   	push   %rbx
+  802705:	49 89 f8             	mov    %rdi,%r8
+  802708:	48 89 d3             	mov    %rdx,%rbx
+  80270b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80270e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802713:	4c 89 c2             	mov    %r8,%rdx
+  802716:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802719:	be 00 00 00 00       	mov    $0x0,%esi
+  80271e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802724:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80272a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80272c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802730:	c9                   	leave
+  802731:	c3                   	ret
+
+0000000000802732 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802732:	55                   	push   %rbp
+  802733:	48 89 e5             	mov    %rsp,%rbp
+  802736:	53                   	push   %rbx
+  802737:	48 83 ec 08          	sub    $0x8,%rsp
+  80273b:	89 f8                	mov    %edi,%eax
+  80273d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802740:	48 63 f9             	movslq %ecx,%rdi
+  802743:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802746:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80274b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80274e:	be 00 00 00 00       	mov    $0x0,%esi
+  802753:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802759:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80275f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802761:	48 85 c0             	test   %rax,%rax
+  802764:	7f 06                	jg     80276c <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802766:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80276a:	c9                   	leave
+  80276b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80276c:	49 89 c0             	mov    %rax,%r8
+  80276f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802774:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80277b:	00 00 00 
+  80277e:	be 27 00 00 00       	mov    $0x27,%esi
+  802783:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80278a:	00 00 00 
+  80278d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802792:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802799:	00 00 00 
+  80279c:	41 ff d1             	call   *%r9
+
+000000000080279f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+  8027a3:	53                   	push   %rbx
+  8027a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a8:	89 f8                	mov    %edi,%eax
+  8027aa:	49 89 f2             	mov    %rsi,%r10
+  8027ad:	48 89 cf             	mov    %rcx,%rdi
+  8027b0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027b3:	48 63 da             	movslq %edx,%rbx
+  8027b6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027b9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027be:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c1:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027cc:	48 85 c0             	test   %rax,%rax
+  8027cf:	7f 06                	jg     8027d7 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d5:	c9                   	leave
+  8027d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027d7:	49 89 c0             	mov    %rax,%r8
+  8027da:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027df:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8027e6:	00 00 00 
+  8027e9:	be 27 00 00 00       	mov    $0x27,%esi
+  8027ee:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8027f5:	00 00 00 
+  8027f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fd:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802804:	00 00 00 
+  802807:	41 ff d1             	call   *%r9
+
+000000000080280a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80280a:	55                   	push   %rbp
+  80280b:	48 89 e5             	mov    %rsp,%rbp
+  80280e:	53                   	push   %rbx
+  80280f:	48 83 ec 08          	sub    $0x8,%rsp
+  802813:	48 89 f1             	mov    %rsi,%rcx
+  802816:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802819:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80281c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802821:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802826:	be 00 00 00 00       	mov    $0x0,%esi
+  80282b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802831:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802837:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802839:	48 85 c0             	test   %rax,%rax
+  80283c:	7f 06                	jg     802844 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80283e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802842:	c9                   	leave
+  802843:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802844:	49 89 c0             	mov    %rax,%r8
+  802847:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80284c:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802853:	00 00 00 
+  802856:	be 27 00 00 00       	mov    $0x27,%esi
+  80285b:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802862:	00 00 00 
+  802865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286a:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802871:	00 00 00 
+  802874:	41 ff d1             	call   *%r9
+
+0000000000802877 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802877:	55                   	push   %rbp
+  802878:	48 89 e5             	mov    %rsp,%rbp
+  80287b:	53                   	push   %rbx
+  80287c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802880:	48 63 ce             	movslq %esi,%rcx
+  802883:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802886:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80288b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802890:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802895:	be 00 00 00 00       	mov    $0x0,%esi
+  80289a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028a8:	48 85 c0             	test   %rax,%rax
+  8028ab:	7f 06                	jg     8028b3 <sys_env_set_status+0x3c>
+}
+  8028ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b1:	c9                   	leave
+  8028b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028b3:	49 89 c0             	mov    %rax,%r8
+  8028b6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028bb:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8028c2:	00 00 00 
+  8028c5:	be 27 00 00 00       	mov    $0x27,%esi
+  8028ca:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8028d1:	00 00 00 
+  8028d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d9:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  8028e0:	00 00 00 
+  8028e3:	41 ff d1             	call   *%r9
+
+00000000008028e6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028e6:	55                   	push   %rbp
+  8028e7:	48 89 e5             	mov    %rsp,%rbp
+  8028ea:	53                   	push   %rbx
+  8028eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ef:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802904:	be 00 00 00 00       	mov    $0x0,%esi
+  802909:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80290f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802915:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802917:	48 85 c0             	test   %rax,%rax
+  80291a:	7f 06                	jg     802922 <sys_env_set_trapframe+0x3c>
+}
+  80291c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802920:	c9                   	leave
+  802921:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802922:	49 89 c0             	mov    %rax,%r8
+  802925:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80292a:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802931:	00 00 00 
+  802934:	be 27 00 00 00       	mov    $0x27,%esi
+  802939:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802940:	00 00 00 
+  802943:	b8 00 00 00 00       	mov    $0x0,%eax
+  802948:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  80294f:	00 00 00 
+  802952:	41 ff d1             	call   *%r9
+
+0000000000802955 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802955:	55                   	push   %rbp
+  802956:	48 89 e5             	mov    %rsp,%rbp
+  802959:	53                   	push   %rbx
+  80295a:	48 83 ec 08          	sub    $0x8,%rsp
+  80295e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802961:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802964:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802969:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80296e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802973:	be 00 00 00 00       	mov    $0x0,%esi
+  802978:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80297e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802984:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802986:	48 85 c0             	test   %rax,%rax
+  802989:	7f 06                	jg     802991 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80298b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80298f:	c9                   	leave
+  802990:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802991:	49 89 c0             	mov    %rax,%r8
+  802994:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802999:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8029a0:	00 00 00 
+  8029a3:	be 27 00 00 00       	mov    $0x27,%esi
+  8029a8:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8029af:	00 00 00 
+  8029b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b7:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  8029be:	00 00 00 
+  8029c1:	41 ff d1             	call   *%r9
+
+00000000008029c4 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029c4:	55                   	push   %rbp
+  8029c5:	48 89 e5             	mov    %rsp,%rbp
+  8029c8:	53                   	push   %rbx
+  8029c9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029cd:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029f6:	48 85 c0             	test   %rax,%rax
+  8029f9:	7f 06                	jg     802a01 <sys_env_set_reclaim+0x3d>
+}
+  8029fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ff:	c9                   	leave
+  802a00:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a01:	49 89 c0             	mov    %rax,%r8
+  802a04:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a09:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a10:	00 00 00 
+  802a13:	be 27 00 00 00       	mov    $0x27,%esi
+  802a18:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a1f:	00 00 00 
+  802a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a27:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802a2e:	00 00 00 
+  802a31:	41 ff d1             	call   *%r9
+
+0000000000802a34 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a34:	55                   	push   %rbp
+  802a35:	48 89 e5             	mov    %rsp,%rbp
+  802a38:	53                   	push   %rbx
+  802a39:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a3d:	48 63 ce             	movslq %esi,%rcx
+  802a40:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a43:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a4d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a52:	be 00 00 00 00       	mov    $0x0,%esi
+  802a57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a63:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a65:	48 85 c0             	test   %rax,%rax
+  802a68:	7f 06                	jg     802a70 <sys_env_set_nice+0x3c>
+}
+  802a6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a6e:	c9                   	leave
+  802a6f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a70:	49 89 c0             	mov    %rax,%r8
+  802a73:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a78:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a7f:	00 00 00 
+  802a82:	be 27 00 00 00       	mov    $0x27,%esi
+  802a87:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a8e:	00 00 00 
+  802a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a96:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802a9d:	00 00 00 
+  802aa0:	41 ff d1             	call   *%r9
+
+0000000000802aa3 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802aa3:	55                   	push   %rbp
+  802aa4:	48 89 e5             	mov    %rsp,%rbp
+  802aa7:	53                   	push   %rbx
+  802aa8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aab:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ab5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802abf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad0:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ad2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ad6:	c9                   	leave
+  802ad7:	c3                   	ret
+
+0000000000802ad8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ad8:	55                   	push   %rbp
+  802ad9:	48 89 e5             	mov    %rsp,%rbp
+  802adc:	53                   	push   %rbx
+  802add:	89 f8                	mov    %edi,%eax
+  802adf:	49 89 f1             	mov    %rsi,%r9
+  802ae2:	48 89 d3             	mov    %rdx,%rbx
+  802ae5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ae8:	49 63 f0             	movslq %r8d,%rsi
+  802aeb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aee:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802af3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802af6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802afc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b02:	cd 30                	int    $0x30
+}
+  802b04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b08:	c9                   	leave
+  802b09:	c3                   	ret
+
+0000000000802b0a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b0a:	55                   	push   %rbp
+  802b0b:	48 89 e5             	mov    %rsp,%rbp
+  802b0e:	53                   	push   %rbx
+  802b0f:	89 f8                	mov    %edi,%eax
+  802b11:	49 89 f1             	mov    %rsi,%r9
+  802b14:	48 89 d3             	mov    %rdx,%rbx
+  802b17:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b1a:	49 63 f0             	movslq %r8d,%rsi
+  802b1d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b20:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b25:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b2e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b34:	cd 30                	int    $0x30
+}
+  802b36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b3a:	c9                   	leave
+  802b3b:	c3                   	ret
+
+0000000000802b3c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b3c:	55                   	push   %rbp
+  802b3d:	48 89 e5             	mov    %rsp,%rbp
+  802b40:	53                   	push   %rbx
+  802b41:	48 83 ec 08          	sub    $0x8,%rsp
+  802b45:	89 f8                	mov    %edi,%eax
+  802b47:	49 89 f2             	mov    %rsi,%r10
+  802b4a:	48 89 d3             	mov    %rdx,%rbx
+  802b4d:	48 89 cf             	mov    %rcx,%rdi
+  802b50:	44 89 c6             	mov    %r8d,%esi
+  802b53:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b56:	48 63 f6             	movslq %esi,%rsi
+  802b59:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b5c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b61:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b64:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b68:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b6a:	48 85 c0             	test   %rax,%rax
+  802b6d:	7f 06                	jg     802b75 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b73:	c9                   	leave
+  802b74:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b75:	49 89 c0             	mov    %rax,%r8
+  802b78:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b7d:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802b84:	00 00 00 
+  802b87:	be 27 00 00 00       	mov    $0x27,%esi
+  802b8c:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802b93:	00 00 00 
+  802b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9b:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802ba2:	00 00 00 
+  802ba5:	41 ff d1             	call   *%r9
+
+0000000000802ba8 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802ba8:	55                   	push   %rbp
+  802ba9:	48 89 e5             	mov    %rsp,%rbp
+  802bac:	53                   	push   %rbx
+  802bad:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb1:	48 89 f1             	mov    %rsi,%rcx
+  802bb4:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bb7:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bbb:	48 8b 1a             	mov    (%rdx),%rbx
+  802bbe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bc6:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bca:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bce:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bd2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bd4:	48 85 c0             	test   %rax,%rax
+  802bd7:	7f 06                	jg     802bdf <sys_ipc_call_short+0x37>
+}
+  802bd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bdf:	49 89 c0             	mov    %rax,%r8
+  802be2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802be7:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802bee:	00 00 00 
+  802bf1:	be 27 00 00 00       	mov    $0x27,%esi
+  802bf6:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802bfd:	00 00 00 
+  802c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c05:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802c0c:	00 00 00 
+  802c0f:	41 ff d1             	call   *%r9
+
+0000000000802c12 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c12:	55                   	push   %rbp
+  802c13:	48 89 e5             	mov    %rsp,%rbp
+  802c16:	53                   	push   %rbx
+  802c17:	48 83 ec 08          	sub    $0x8,%rsp
+  802c1b:	89 f8                	mov    %edi,%eax
+  802c1d:	49 89 f2             	mov    %rsi,%r10
+  802c20:	48 89 d3             	mov    %rdx,%rbx
+  802c23:	48 89 cf             	mov    %rcx,%rdi
+  802c26:	44 89 c6             	mov    %r8d,%esi
+  802c29:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c2c:	48 63 f6             	movslq %esi,%rsi
+  802c2f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c32:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c37:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c3a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c3e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c40:	48 85 c0             	test   %rax,%rax
+  802c43:	7f 06                	jg     802c4b <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c49:	c9                   	leave
+  802c4a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c4b:	49 89 c0             	mov    %rax,%r8
+  802c4e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c53:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802c5a:	00 00 00 
+  802c5d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c62:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c69:	00 00 00 
+  802c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c71:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802c78:	00 00 00 
+  802c7b:	41 ff d1             	call   *%r9
+
+0000000000802c7e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c7e:	55                   	push   %rbp
+  802c7f:	48 89 e5             	mov    %rsp,%rbp
+  802c82:	53                   	push   %rbx
+  802c83:	48 83 ec 08          	sub    $0x8,%rsp
+  802c87:	48 89 fa             	mov    %rdi,%rdx
+  802c8a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c8d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c97:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c9c:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ca7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802caf:	48 85 c0             	test   %rax,%rax
+  802cb2:	7f 06                	jg     802cba <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cb4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cb8:	c9                   	leave
+  802cb9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cba:	49 89 c0             	mov    %rax,%r8
+  802cbd:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cc2:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802cc9:	00 00 00 
+  802ccc:	be 27 00 00 00       	mov    $0x27,%esi
+  802cd1:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802cd8:	00 00 00 
+  802cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce0:	49 b9 84 50 80 00 00 	movabs $0x805084,%r9
+  802ce7:	00 00 00 
+  802cea:	41 ff d1             	call   *%r9
+
+0000000000802ced <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802ced:	55                   	push   %rbp
+  802cee:	48 89 e5             	mov    %rsp,%rbp
+  802cf1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cf2:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cf7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d06:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d0b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d16:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d1c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d1e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d22:	c9                   	leave
+  802d23:	c3                   	ret
+
+0000000000802d24 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d24:	55                   	push   %rbp
+  802d25:	48 89 e5             	mov    %rsp,%rbp
+  802d28:	53                   	push   %rbx
+  802d29:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d2c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d31:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d40:	be 00 00 00 00       	mov    $0x0,%esi
+  802d45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d4b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d51:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d53:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d57:	c9                   	leave
+  802d58:	c3                   	ret
+
+0000000000802d59 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d59:	55                   	push   %rbp
+  802d5a:	48 89 e5             	mov    %rsp,%rbp
+  802d5d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d5e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d63:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d68:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d72:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d77:	be 00 00 00 00       	mov    $0x0,%esi
+  802d7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d88:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d8e:	c9                   	leave
+  802d8f:	c3                   	ret
+
+0000000000802d90 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d90:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d97:	ff ff ff 
+  802d9a:	48 01 f8             	add    %rdi,%rax
+  802d9d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802da1:	c3                   	ret
+
+0000000000802da2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802da2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802da9:	ff ff ff 
+  802dac:	48 01 f8             	add    %rdi,%rax
+  802daf:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802db3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802db9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dbd:	c3                   	ret
+
+0000000000802dbe <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dbe:	55                   	push   %rbp
+  802dbf:	48 89 e5             	mov    %rsp,%rbp
+  802dc2:	41 57                	push   %r15
+  802dc4:	41 56                	push   %r14
+  802dc6:	41 55                	push   %r13
+  802dc8:	41 54                	push   %r12
+  802dca:	53                   	push   %rbx
+  802dcb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dcf:	49 89 ff             	mov    %rdi,%r15
+  802dd2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802dd7:	49 bd be 42 80 00 00 	movabs $0x8042be,%r13
+  802dde:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802de1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802de7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802dea:	48 89 df             	mov    %rbx,%rdi
+  802ded:	41 ff d5             	call   *%r13
+  802df0:	83 e0 04             	and    $0x4,%eax
+  802df3:	74 17                	je     802e0c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802df5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802dfc:	4c 39 f3             	cmp    %r14,%rbx
+  802dff:	75 e6                	jne    802de7 <fd_alloc+0x29>
+  802e01:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e07:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e0c:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e0f:	48 83 c4 08          	add    $0x8,%rsp
+  802e13:	5b                   	pop    %rbx
+  802e14:	41 5c                	pop    %r12
+  802e16:	41 5d                	pop    %r13
+  802e18:	41 5e                	pop    %r14
+  802e1a:	41 5f                	pop    %r15
+  802e1c:	5d                   	pop    %rbp
+  802e1d:	c3                   	ret
+
+0000000000802e1e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e1e:	83 ff 1f             	cmp    $0x1f,%edi
+  802e21:	77 39                	ja     802e5c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e23:	55                   	push   %rbp
+  802e24:	48 89 e5             	mov    %rsp,%rbp
+  802e27:	41 54                	push   %r12
+  802e29:	53                   	push   %rbx
+  802e2a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e2d:	48 63 df             	movslq %edi,%rbx
+  802e30:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e37:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e3b:	48 89 df             	mov    %rbx,%rdi
+  802e3e:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  802e45:	00 00 00 
+  802e48:	ff d0                	call   *%rax
+  802e4a:	a8 04                	test   $0x4,%al
+  802e4c:	74 14                	je     802e62 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e4e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e57:	5b                   	pop    %rbx
+  802e58:	41 5c                	pop    %r12
+  802e5a:	5d                   	pop    %rbp
+  802e5b:	c3                   	ret
+        return -E_INVAL;
+  802e5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e61:	c3                   	ret
+        return -E_INVAL;
+  802e62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e67:	eb ee                	jmp    802e57 <fd_lookup+0x39>
+
+0000000000802e69 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e69:	55                   	push   %rbp
+  802e6a:	48 89 e5             	mov    %rsp,%rbp
+  802e6d:	41 54                	push   %r12
+  802e6f:	53                   	push   %rbx
+  802e70:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e73:	48 b8 00 62 80 00 00 	movabs $0x806200,%rax
+  802e7a:	00 00 00 
+  802e7d:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e84:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e87:	39 3b                	cmp    %edi,(%rbx)
+  802e89:	74 47                	je     802ed2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e8b:	48 83 c0 08          	add    $0x8,%rax
+  802e8f:	48 8b 18             	mov    (%rax),%rbx
+  802e92:	48 85 db             	test   %rbx,%rbx
+  802e95:	75 f0                	jne    802e87 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e97:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e9e:	00 00 00 
+  802ea1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ea7:	89 fa                	mov    %edi,%edx
+  802ea9:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  802eb0:	00 00 00 
+  802eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb8:	48 b9 96 16 80 00 00 	movabs $0x801696,%rcx
+  802ebf:	00 00 00 
+  802ec2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ec4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ec9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ecd:	5b                   	pop    %rbx
+  802ece:	41 5c                	pop    %r12
+  802ed0:	5d                   	pop    %rbp
+  802ed1:	c3                   	ret
+            return 0;
+  802ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed7:	eb f0                	jmp    802ec9 <dev_lookup+0x60>
+
+0000000000802ed9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ed9:	55                   	push   %rbp
+  802eda:	48 89 e5             	mov    %rsp,%rbp
+  802edd:	41 55                	push   %r13
+  802edf:	41 54                	push   %r12
+  802ee1:	53                   	push   %rbx
+  802ee2:	48 83 ec 18          	sub    $0x18,%rsp
+  802ee6:	48 89 fb             	mov    %rdi,%rbx
+  802ee9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802eec:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802ef3:	ff ff ff 
+  802ef6:	48 01 df             	add    %rbx,%rdi
+  802ef9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802efd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f01:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  802f08:	00 00 00 
+  802f0b:	ff d0                	call   *%rax
+  802f0d:	41 89 c5             	mov    %eax,%r13d
+  802f10:	85 c0                	test   %eax,%eax
+  802f12:	78 06                	js     802f1a <fd_close+0x41>
+  802f14:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f18:	74 1a                	je     802f34 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f1a:	45 84 e4             	test   %r12b,%r12b
+  802f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f22:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f26:	44 89 e8             	mov    %r13d,%eax
+  802f29:	48 83 c4 18          	add    $0x18,%rsp
+  802f2d:	5b                   	pop    %rbx
+  802f2e:	41 5c                	pop    %r12
+  802f30:	41 5d                	pop    %r13
+  802f32:	5d                   	pop    %rbp
+  802f33:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f34:	8b 3b                	mov    (%rbx),%edi
+  802f36:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f3a:	48 b8 69 2e 80 00 00 	movabs $0x802e69,%rax
+  802f41:	00 00 00 
+  802f44:	ff d0                	call   *%rax
+  802f46:	41 89 c5             	mov    %eax,%r13d
+  802f49:	85 c0                	test   %eax,%eax
+  802f4b:	78 1b                	js     802f68 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f51:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f55:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f5b:	48 85 c0             	test   %rax,%rax
+  802f5e:	74 08                	je     802f68 <fd_close+0x8f>
+  802f60:	48 89 df             	mov    %rbx,%rdi
+  802f63:	ff d0                	call   *%rax
+  802f65:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f6d:	48 89 de             	mov    %rbx,%rsi
+  802f70:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f75:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  802f7c:	00 00 00 
+  802f7f:	ff d0                	call   *%rax
+    return res;
+  802f81:	eb a3                	jmp    802f26 <fd_close+0x4d>
+
+0000000000802f83 <close>:
+
+int
+close(int fdnum) {
+  802f83:	55                   	push   %rbp
+  802f84:	48 89 e5             	mov    %rsp,%rbp
+  802f87:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f8b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f8f:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  802f96:	00 00 00 
+  802f99:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f9b:	85 c0                	test   %eax,%eax
+  802f9d:	78 15                	js     802fb4 <close+0x31>
+
+    return fd_close(fd, 1);
+  802f9f:	be 01 00 00 00       	mov    $0x1,%esi
+  802fa4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fa8:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+}
+  802fb4:	c9                   	leave
+  802fb5:	c3                   	ret
+
+0000000000802fb6 <close_all>:
+
+void
+close_all(void) {
+  802fb6:	55                   	push   %rbp
+  802fb7:	48 89 e5             	mov    %rsp,%rbp
+  802fba:	41 54                	push   %r12
+  802fbc:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fc2:	49 bc 83 2f 80 00 00 	movabs $0x802f83,%r12
+  802fc9:	00 00 00 
+  802fcc:	89 df                	mov    %ebx,%edi
+  802fce:	41 ff d4             	call   *%r12
+  802fd1:	83 c3 01             	add    $0x1,%ebx
+  802fd4:	83 fb 20             	cmp    $0x20,%ebx
+  802fd7:	75 f3                	jne    802fcc <close_all+0x16>
+}
+  802fd9:	5b                   	pop    %rbx
+  802fda:	41 5c                	pop    %r12
+  802fdc:	5d                   	pop    %rbp
+  802fdd:	c3                   	ret
+
+0000000000802fde <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fde:	55                   	push   %rbp
+  802fdf:	48 89 e5             	mov    %rsp,%rbp
+  802fe2:	41 57                	push   %r15
+  802fe4:	41 56                	push   %r14
+  802fe6:	41 55                	push   %r13
+  802fe8:	41 54                	push   %r12
+  802fea:	53                   	push   %rbx
+  802feb:	48 83 ec 18          	sub    $0x18,%rsp
+  802fef:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802ff2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ff6:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  802ffd:	00 00 00 
+  803000:	ff d0                	call   *%rax
+  803002:	89 c3                	mov    %eax,%ebx
+  803004:	85 c0                	test   %eax,%eax
+  803006:	0f 88 b8 00 00 00    	js     8030c4 <dup+0xe6>
+    close(newfdnum);
+  80300c:	44 89 e7             	mov    %r12d,%edi
+  80300f:	48 b8 83 2f 80 00 00 	movabs $0x802f83,%rax
+  803016:	00 00 00 
+  803019:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80301b:	4d 63 ec             	movslq %r12d,%r13
+  80301e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803025:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803029:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80302d:	4c 89 ff             	mov    %r15,%rdi
+  803030:	49 be a2 2d 80 00 00 	movabs $0x802da2,%r14
+  803037:	00 00 00 
+  80303a:	41 ff d6             	call   *%r14
+  80303d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803040:	4c 89 ef             	mov    %r13,%rdi
+  803043:	41 ff d6             	call   *%r14
+  803046:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803049:	48 89 df             	mov    %rbx,%rdi
+  80304c:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  803053:	00 00 00 
+  803056:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803058:	a8 04                	test   $0x4,%al
+  80305a:	74 2b                	je     803087 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80305c:	41 89 c1             	mov    %eax,%r9d
+  80305f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803065:	4c 89 f1             	mov    %r14,%rcx
+  803068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80306d:	48 89 de             	mov    %rbx,%rsi
+  803070:	bf 00 00 00 00       	mov    $0x0,%edi
+  803075:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  80307c:	00 00 00 
+  80307f:	ff d0                	call   *%rax
+  803081:	89 c3                	mov    %eax,%ebx
+  803083:	85 c0                	test   %eax,%eax
+  803085:	78 4e                	js     8030d5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803087:	4c 89 ff             	mov    %r15,%rdi
+  80308a:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  803091:	00 00 00 
+  803094:	ff d0                	call   *%rax
+  803096:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803099:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80309f:	4c 89 e9             	mov    %r13,%rcx
+  8030a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a7:	4c 89 fe             	mov    %r15,%rsi
+  8030aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030af:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  8030b6:	00 00 00 
+  8030b9:	ff d0                	call   *%rax
+  8030bb:	89 c3                	mov    %eax,%ebx
+  8030bd:	85 c0                	test   %eax,%eax
+  8030bf:	78 14                	js     8030d5 <dup+0xf7>
+
+    return newfdnum;
+  8030c1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030c4:	89 d8                	mov    %ebx,%eax
+  8030c6:	48 83 c4 18          	add    $0x18,%rsp
+  8030ca:	5b                   	pop    %rbx
+  8030cb:	41 5c                	pop    %r12
+  8030cd:	41 5d                	pop    %r13
+  8030cf:	41 5e                	pop    %r14
+  8030d1:	41 5f                	pop    %r15
+  8030d3:	5d                   	pop    %rbp
+  8030d4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030da:	4c 89 ee             	mov    %r13,%rsi
+  8030dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e2:	49 bc 0a 28 80 00 00 	movabs $0x80280a,%r12
+  8030e9:	00 00 00 
+  8030ec:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030f4:	4c 89 f6             	mov    %r14,%rsi
+  8030f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030fc:	41 ff d4             	call   *%r12
+    return res;
+  8030ff:	eb c3                	jmp    8030c4 <dup+0xe6>
+
+0000000000803101 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803101:	55                   	push   %rbp
+  803102:	48 89 e5             	mov    %rsp,%rbp
+  803105:	41 56                	push   %r14
+  803107:	41 55                	push   %r13
+  803109:	41 54                	push   %r12
+  80310b:	53                   	push   %rbx
+  80310c:	48 83 ec 10          	sub    $0x10,%rsp
+  803110:	89 fb                	mov    %edi,%ebx
+  803112:	49 89 f4             	mov    %rsi,%r12
+  803115:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803118:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80311c:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  803123:	00 00 00 
+  803126:	ff d0                	call   *%rax
+  803128:	85 c0                	test   %eax,%eax
+  80312a:	78 4c                	js     803178 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80312c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803130:	41 8b 3e             	mov    (%r14),%edi
+  803133:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803137:	48 b8 69 2e 80 00 00 	movabs $0x802e69,%rax
+  80313e:	00 00 00 
+  803141:	ff d0                	call   *%rax
+  803143:	85 c0                	test   %eax,%eax
+  803145:	78 35                	js     80317c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803147:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80314b:	83 e0 03             	and    $0x3,%eax
+  80314e:	83 f8 01             	cmp    $0x1,%eax
+  803151:	74 2d                	je     803180 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803153:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803157:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80315b:	48 85 c0             	test   %rax,%rax
+  80315e:	74 56                	je     8031b6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803160:	4c 89 ea             	mov    %r13,%rdx
+  803163:	4c 89 e6             	mov    %r12,%rsi
+  803166:	4c 89 f7             	mov    %r14,%rdi
+  803169:	ff d0                	call   *%rax
+}
+  80316b:	48 83 c4 10          	add    $0x10,%rsp
+  80316f:	5b                   	pop    %rbx
+  803170:	41 5c                	pop    %r12
+  803172:	41 5d                	pop    %r13
+  803174:	41 5e                	pop    %r14
+  803176:	5d                   	pop    %rbp
+  803177:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803178:	48 98                	cltq
+  80317a:	eb ef                	jmp    80316b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80317c:	48 98                	cltq
+  80317e:	eb eb                	jmp    80316b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803180:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803187:	00 00 00 
+  80318a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803190:	89 da                	mov    %ebx,%edx
+  803192:	48 bf b9 61 80 00 00 	movabs $0x8061b9,%rdi
+  803199:	00 00 00 
+  80319c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a1:	48 b9 96 16 80 00 00 	movabs $0x801696,%rcx
+  8031a8:	00 00 00 
+  8031ab:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031ad:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031b4:	eb b5                	jmp    80316b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031b6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031bd:	eb ac                	jmp    80316b <read+0x6a>
+
+00000000008031bf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031bf:	55                   	push   %rbp
+  8031c0:	48 89 e5             	mov    %rsp,%rbp
+  8031c3:	41 57                	push   %r15
+  8031c5:	41 56                	push   %r14
+  8031c7:	41 55                	push   %r13
+  8031c9:	41 54                	push   %r12
+  8031cb:	53                   	push   %rbx
+  8031cc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031d0:	48 85 d2             	test   %rdx,%rdx
+  8031d3:	74 54                	je     803229 <readn+0x6a>
+  8031d5:	41 89 fd             	mov    %edi,%r13d
+  8031d8:	49 89 f6             	mov    %rsi,%r14
+  8031db:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031de:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031e3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031e8:	49 bf 01 31 80 00 00 	movabs $0x803101,%r15
+  8031ef:	00 00 00 
+  8031f2:	4c 89 e2             	mov    %r12,%rdx
+  8031f5:	48 29 f2             	sub    %rsi,%rdx
+  8031f8:	4c 01 f6             	add    %r14,%rsi
+  8031fb:	44 89 ef             	mov    %r13d,%edi
+  8031fe:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803201:	85 c0                	test   %eax,%eax
+  803203:	78 20                	js     803225 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803205:	01 c3                	add    %eax,%ebx
+  803207:	85 c0                	test   %eax,%eax
+  803209:	74 08                	je     803213 <readn+0x54>
+  80320b:	48 63 f3             	movslq %ebx,%rsi
+  80320e:	4c 39 e6             	cmp    %r12,%rsi
+  803211:	72 df                	jb     8031f2 <readn+0x33>
+    }
+    return res;
+  803213:	48 63 c3             	movslq %ebx,%rax
+}
+  803216:	48 83 c4 08          	add    $0x8,%rsp
+  80321a:	5b                   	pop    %rbx
+  80321b:	41 5c                	pop    %r12
+  80321d:	41 5d                	pop    %r13
+  80321f:	41 5e                	pop    %r14
+  803221:	41 5f                	pop    %r15
+  803223:	5d                   	pop    %rbp
+  803224:	c3                   	ret
+        if (inc < 0) return inc;
+  803225:	48 98                	cltq
+  803227:	eb ed                	jmp    803216 <readn+0x57>
+    int inc = 1, res = 0;
+  803229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80322e:	eb e3                	jmp    803213 <readn+0x54>
+
+0000000000803230 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803230:	55                   	push   %rbp
+  803231:	48 89 e5             	mov    %rsp,%rbp
+  803234:	41 56                	push   %r14
+  803236:	41 55                	push   %r13
+  803238:	41 54                	push   %r12
+  80323a:	53                   	push   %rbx
+  80323b:	48 83 ec 10          	sub    $0x10,%rsp
+  80323f:	89 fb                	mov    %edi,%ebx
+  803241:	49 89 f4             	mov    %rsi,%r12
+  803244:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803247:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80324b:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  803252:	00 00 00 
+  803255:	ff d0                	call   *%rax
+  803257:	85 c0                	test   %eax,%eax
+  803259:	78 47                	js     8032a2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80325b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80325f:	41 8b 3e             	mov    (%r14),%edi
+  803262:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803266:	48 b8 69 2e 80 00 00 	movabs $0x802e69,%rax
+  80326d:	00 00 00 
+  803270:	ff d0                	call   *%rax
+  803272:	85 c0                	test   %eax,%eax
+  803274:	78 30                	js     8032a6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803276:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80327b:	74 2d                	je     8032aa <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80327d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803281:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803285:	48 85 c0             	test   %rax,%rax
+  803288:	74 56                	je     8032e0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80328a:	4c 89 ea             	mov    %r13,%rdx
+  80328d:	4c 89 e6             	mov    %r12,%rsi
+  803290:	4c 89 f7             	mov    %r14,%rdi
+  803293:	ff d0                	call   *%rax
+}
+  803295:	48 83 c4 10          	add    $0x10,%rsp
+  803299:	5b                   	pop    %rbx
+  80329a:	41 5c                	pop    %r12
+  80329c:	41 5d                	pop    %r13
+  80329e:	41 5e                	pop    %r14
+  8032a0:	5d                   	pop    %rbp
+  8032a1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032a2:	48 98                	cltq
+  8032a4:	eb ef                	jmp    803295 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032a6:	48 98                	cltq
+  8032a8:	eb eb                	jmp    803295 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032aa:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032b1:	00 00 00 
+  8032b4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032ba:	89 da                	mov    %ebx,%edx
+  8032bc:	48 bf d5 61 80 00 00 	movabs $0x8061d5,%rdi
+  8032c3:	00 00 00 
+  8032c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cb:	48 b9 96 16 80 00 00 	movabs $0x801696,%rcx
+  8032d2:	00 00 00 
+  8032d5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032d7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032de:	eb b5                	jmp    803295 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032e0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032e7:	eb ac                	jmp    803295 <write+0x65>
+
+00000000008032e9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032e9:	55                   	push   %rbp
+  8032ea:	48 89 e5             	mov    %rsp,%rbp
+  8032ed:	53                   	push   %rbx
+  8032ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8032f2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032f8:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  8032ff:	00 00 00 
+  803302:	ff d0                	call   *%rax
+  803304:	85 c0                	test   %eax,%eax
+  803306:	78 0c                	js     803314 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803308:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80330c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80330f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803318:	c9                   	leave
+  803319:	c3                   	ret
+
+000000000080331a <tell>:
+
+int tell(int fdnum) {
+  80331a:	55                   	push   %rbp
+  80331b:	48 89 e5             	mov    %rsp,%rbp
+  80331e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803322:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803326:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  80332d:	00 00 00 
+  803330:	ff d0                	call   *%rax
+  803332:	85 c0                	test   %eax,%eax
+  803334:	78 07                	js     80333d <tell+0x23>
+
+    return fd->fd_offset;
+  803336:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80333a:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80333d:	c9                   	leave
+  80333e:	c3                   	ret
+
+000000000080333f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80333f:	55                   	push   %rbp
+  803340:	48 89 e5             	mov    %rsp,%rbp
+  803343:	41 55                	push   %r13
+  803345:	41 54                	push   %r12
+  803347:	53                   	push   %rbx
+  803348:	48 83 ec 18          	sub    $0x18,%rsp
+  80334c:	89 fb                	mov    %edi,%ebx
+  80334e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803351:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803355:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  80335c:	00 00 00 
+  80335f:	ff d0                	call   *%rax
+  803361:	85 c0                	test   %eax,%eax
+  803363:	78 38                	js     80339d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803365:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803369:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80336d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803371:	48 b8 69 2e 80 00 00 	movabs $0x802e69,%rax
+  803378:	00 00 00 
+  80337b:	ff d0                	call   *%rax
+  80337d:	85 c0                	test   %eax,%eax
+  80337f:	78 1c                	js     80339d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803381:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803386:	74 20                	je     8033a8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803388:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80338c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803390:	48 85 c0             	test   %rax,%rax
+  803393:	74 47                	je     8033dc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803395:	44 89 e6             	mov    %r12d,%esi
+  803398:	4c 89 ef             	mov    %r13,%rdi
+  80339b:	ff d0                	call   *%rax
+}
+  80339d:	48 83 c4 18          	add    $0x18,%rsp
+  8033a1:	5b                   	pop    %rbx
+  8033a2:	41 5c                	pop    %r12
+  8033a4:	41 5d                	pop    %r13
+  8033a6:	5d                   	pop    %rbp
+  8033a7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033a8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033af:	00 00 00 
+  8033b2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033b8:	89 da                	mov    %ebx,%edx
+  8033ba:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  8033c1:	00 00 00 
+  8033c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c9:	48 b9 96 16 80 00 00 	movabs $0x801696,%rcx
+  8033d0:	00 00 00 
+  8033d3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033da:	eb c1                	jmp    80339d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033dc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033e1:	eb ba                	jmp    80339d <ftruncate+0x5e>
+
+00000000008033e3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033e3:	55                   	push   %rbp
+  8033e4:	48 89 e5             	mov    %rsp,%rbp
+  8033e7:	41 54                	push   %r12
+  8033e9:	53                   	push   %rbx
+  8033ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8033ee:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033f1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033f5:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  8033fc:	00 00 00 
+  8033ff:	ff d0                	call   *%rax
+  803401:	85 c0                	test   %eax,%eax
+  803403:	78 63                	js     803468 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803405:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803409:	41 8b 3c 24          	mov    (%r12),%edi
+  80340d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803411:	48 b8 69 2e 80 00 00 	movabs $0x802e69,%rax
+  803418:	00 00 00 
+  80341b:	ff d0                	call   *%rax
+  80341d:	85 c0                	test   %eax,%eax
+  80341f:	78 47                	js     803468 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803421:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803425:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80342a:	74 45                	je     803471 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80342c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80342f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803436:	00 00 00 
+    stat->st_isdir = 0;
+  803439:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803440:	00 00 00 
+    stat->st_ino = 0;
+  803443:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80344a:	00 00 00 00 
+    stat->st_version = 0;
+  80344e:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803455:	00 00 00 
+    stat->st_dev = dev;
+  803458:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80345f:	48 89 de             	mov    %rbx,%rsi
+  803462:	4c 89 e7             	mov    %r12,%rdi
+  803465:	ff 50 28             	call   *0x28(%rax)
+}
+  803468:	48 83 c4 10          	add    $0x10,%rsp
+  80346c:	5b                   	pop    %rbx
+  80346d:	41 5c                	pop    %r12
+  80346f:	5d                   	pop    %rbp
+  803470:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803471:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803476:	eb f0                	jmp    803468 <fstat+0x85>
+
+0000000000803478 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803478:	55                   	push   %rbp
+  803479:	48 89 e5             	mov    %rsp,%rbp
+  80347c:	41 54                	push   %r12
+  80347e:	53                   	push   %rbx
+  80347f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803482:	be 00 00 00 00       	mov    $0x0,%esi
+  803487:	48 b8 99 39 80 00 00 	movabs $0x803999,%rax
+  80348e:	00 00 00 
+  803491:	ff d0                	call   *%rax
+  803493:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803495:	85 c0                	test   %eax,%eax
+  803497:	78 25                	js     8034be <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803499:	4c 89 e6             	mov    %r12,%rsi
+  80349c:	89 c7                	mov    %eax,%edi
+  80349e:	48 b8 e3 33 80 00 00 	movabs $0x8033e3,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+  8034aa:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034ad:	89 df                	mov    %ebx,%edi
+  8034af:	48 b8 83 2f 80 00 00 	movabs $0x802f83,%rax
+  8034b6:	00 00 00 
+  8034b9:	ff d0                	call   *%rax
+
+    return res;
+  8034bb:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034be:	89 d8                	mov    %ebx,%eax
+  8034c0:	5b                   	pop    %rbx
+  8034c1:	41 5c                	pop    %r12
+  8034c3:	5d                   	pop    %rbp
+  8034c4:	c3                   	ret
+
+00000000008034c5 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034c5:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034cc:	00 00 00 
+  8034cf:	83 38 00             	cmpl   $0x0,(%rax)
+  8034d2:	74 0a                	je     8034de <fsipc_env+0x19>
+    return fsenv;
+}
+  8034d4:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034db:	00 00 
+  8034dd:	c3                   	ret
+fsipc_env(void) {
+  8034de:	55                   	push   %rbp
+  8034df:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034e2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034e7:	48 b8 6b 56 80 00 00 	movabs $0x80566b,%rax
+  8034ee:	00 00 00 
+  8034f1:	ff d0                	call   *%rax
+  8034f3:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8034fa:	00 00 
+}
+  8034fc:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803503:	00 00 
+  803505:	5d                   	pop    %rbp
+  803506:	c3                   	ret
+
+0000000000803507 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803507:	55                   	push   %rbp
+  803508:	48 89 e5             	mov    %rsp,%rbp
+  80350b:	53                   	push   %rbx
+  80350c:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803510:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803517:	00 
+  803518:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80351f:	00 
+  803520:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803527:	00 
+  803528:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80352f:	00 
+  803530:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803537:	00 
+
+    assert(size <= sizeof(words));
+  803538:	48 83 fa 28          	cmp    $0x28,%rdx
+  80353c:	77 38                	ja     803576 <fsipc_short+0x6f>
+  80353e:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803540:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803544:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803550:	48 b8 c5 34 80 00 00 	movabs $0x8034c5,%rax
+  803557:	00 00 00 
+  80355a:	ff d0                	call   *%rax
+  80355c:	89 c7                	mov    %eax,%edi
+  80355e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803562:	89 de                	mov    %ebx,%esi
+  803564:	48 b8 ce 55 80 00 00 	movabs $0x8055ce,%rax
+  80356b:	00 00 00 
+  80356e:	ff d0                	call   *%rax
+}
+  803570:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803574:	c9                   	leave
+  803575:	c3                   	ret
+    assert(size <= sizeof(words));
+  803576:	48 b9 20 62 80 00 00 	movabs $0x806220,%rcx
+  80357d:	00 00 00 
+  803580:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803587:	00 00 00 
+  80358a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80358f:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803596:	00 00 00 
+  803599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359e:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  8035a5:	00 00 00 
+  8035a8:	41 ff d0             	call   *%r8
+
+00000000008035ab <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035ab:	55                   	push   %rbp
+  8035ac:	48 89 e5             	mov    %rsp,%rbp
+  8035af:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035b3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035b6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035b9:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035bc:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035c1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035c5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035ca:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+}
+  8035d6:	c9                   	leave
+  8035d7:	c3                   	ret
+
+00000000008035d8 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035d8:	55                   	push   %rbp
+  8035d9:	48 89 e5             	mov    %rsp,%rbp
+  8035dc:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035e0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035e6:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035eb:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035ef:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035f4:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  8035fb:	00 00 00 
+  8035fe:	ff d0                	call   *%rax
+}
+  803600:	c9                   	leave
+  803601:	c3                   	ret
+
+0000000000803602 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803602:	55                   	push   %rbp
+  803603:	48 89 e5             	mov    %rsp,%rbp
+  803606:	41 54                	push   %r12
+  803608:	53                   	push   %rbx
+  803609:	48 83 ec 10          	sub    $0x10,%rsp
+  80360d:	89 fb                	mov    %edi,%ebx
+  80360f:	49 89 f4             	mov    %rsi,%r12
+  803612:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803616:	48 b8 c5 34 80 00 00 	movabs $0x8034c5,%rax
+  80361d:	00 00 00 
+  803620:	ff d0                	call   *%rax
+  803622:	89 c7                	mov    %eax,%edi
+  803624:	6a 00                	push   $0x0
+  803626:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80362a:	50                   	push   %rax
+  80362b:	4d 89 e1             	mov    %r12,%r9
+  80362e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803634:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803639:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803640:	00 00 00 
+  803643:	89 de                	mov    %ebx,%esi
+  803645:	48 b8 69 55 80 00 00 	movabs $0x805569,%rax
+  80364c:	00 00 00 
+  80364f:	ff d0                	call   *%rax
+}
+  803651:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803655:	5b                   	pop    %rbx
+  803656:	41 5c                	pop    %r12
+  803658:	5d                   	pop    %rbp
+  803659:	c3                   	ret
+
+000000000080365a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80365a:	55                   	push   %rbp
+  80365b:	48 89 e5             	mov    %rsp,%rbp
+  80365e:	41 54                	push   %r12
+  803660:	53                   	push   %rbx
+  803661:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803664:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803667:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80366e:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803670:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803675:	be 00 00 00 00       	mov    $0x0,%esi
+  80367a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80367f:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  803686:	00 00 00 
+  803689:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80368b:	85 c0                	test   %eax,%eax
+  80368d:	78 5a                	js     8036e9 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80368f:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803696:	00 00 00 
+  803699:	4c 89 e6             	mov    %r12,%rsi
+  80369c:	48 89 df             	mov    %rbx,%rdi
+  80369f:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  8036a6:	00 00 00 
+  8036a9:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036ab:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036b2:	00 
+  8036b3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036b9:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036c0:	00 
+  8036c1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036c7:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036ce:	00 
+  8036cf:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036d6:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036dd:	00 
+  8036de:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036e9:	5b                   	pop    %rbx
+  8036ea:	41 5c                	pop    %r12
+  8036ec:	5d                   	pop    %rbp
+  8036ed:	c3                   	ret
+
+00000000008036ee <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036ee:	55                   	push   %rbp
+  8036ef:	48 89 e5             	mov    %rsp,%rbp
+  8036f2:	41 57                	push   %r15
+  8036f4:	41 56                	push   %r14
+  8036f6:	41 55                	push   %r13
+  8036f8:	41 54                	push   %r12
+  8036fa:	53                   	push   %rbx
+  8036fb:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8036ff:	48 85 ff             	test   %rdi,%rdi
+  803702:	0f 84 a1 00 00 00    	je     8037a9 <devfile_read+0xbb>
+  803708:	49 89 ff             	mov    %rdi,%r15
+  80370b:	49 89 f5             	mov    %rsi,%r13
+  80370e:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803711:	48 85 f6             	test   %rsi,%rsi
+  803714:	0f 84 c4 00 00 00    	je     8037de <devfile_read+0xf0>
+    size_t total_read = 0;
+  80371a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803721:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803722:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803729:	00 00 00 
+  80372c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803730:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803733:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803737:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80373c:	be 00 00 00 00       	mov    $0x0,%esi
+  803741:	bf 03 00 00 00       	mov    $0x3,%edi
+  803746:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  80374d:	00 00 00 
+  803750:	ff d0                	call   *%rax
+        if (res < 0) {
+  803752:	85 c0                	test   %eax,%eax
+  803754:	0f 88 b9 00 00 00    	js     803813 <devfile_read+0x125>
+        assert(res <= n);
+  80375a:	48 63 d8             	movslq %eax,%rbx
+  80375d:	49 39 dc             	cmp    %rbx,%r12
+  803760:	0f 82 b1 00 00 00    	jb     803817 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803766:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80376b:	0f 87 db 00 00 00    	ja     80384c <devfile_read+0x15e>
+        if (!res) {
+  803771:	85 c0                	test   %eax,%eax
+  803773:	74 21                	je     803796 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803775:	48 89 da             	mov    %rbx,%rdx
+  803778:	4c 89 f6             	mov    %r14,%rsi
+  80377b:	4c 89 ef             	mov    %r13,%rdi
+  80377e:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  803785:	00 00 00 
+  803788:	ff d0                	call   *%rax
+        total_read += res;
+  80378a:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  80378e:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803791:	49 29 dc             	sub    %rbx,%r12
+  803794:	75 96                	jne    80372c <devfile_read+0x3e>
+    return total_read;
+  803796:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80379a:	48 83 c4 18          	add    $0x18,%rsp
+  80379e:	5b                   	pop    %rbx
+  80379f:	41 5c                	pop    %r12
+  8037a1:	41 5d                	pop    %r13
+  8037a3:	41 5e                	pop    %r14
+  8037a5:	41 5f                	pop    %r15
+  8037a7:	5d                   	pop    %rbp
+  8037a8:	c3                   	ret
+    assert(fd);
+  8037a9:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  8037b0:	00 00 00 
+  8037b3:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037ba:	00 00 00 
+  8037bd:	be 91 00 00 00       	mov    $0x91,%esi
+  8037c2:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8037c9:	00 00 00 
+  8037cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d1:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  8037d8:	00 00 00 
+  8037db:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037de:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  8037e5:	00 00 00 
+  8037e8:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037ef:	00 00 00 
+  8037f2:	be 92 00 00 00       	mov    $0x92,%esi
+  8037f7:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8037fe:	00 00 00 
+  803801:	b8 00 00 00 00       	mov    $0x0,%eax
+  803806:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  80380d:	00 00 00 
+  803810:	41 ff d0             	call   *%r8
+            return res;
+  803813:	48 98                	cltq
+  803815:	eb 83                	jmp    80379a <devfile_read+0xac>
+        assert(res <= n);
+  803817:	48 b9 5d 62 80 00 00 	movabs $0x80625d,%rcx
+  80381e:	00 00 00 
+  803821:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803828:	00 00 00 
+  80382b:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803830:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803837:	00 00 00 
+  80383a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383f:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  803846:	00 00 00 
+  803849:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80384c:	48 b9 68 62 80 00 00 	movabs $0x806268,%rcx
+  803853:	00 00 00 
+  803856:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80385d:	00 00 00 
+  803860:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803865:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80386c:	00 00 00 
+  80386f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803874:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  80387b:	00 00 00 
+  80387e:	41 ff d0             	call   *%r8
+
+0000000000803881 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803881:	55                   	push   %rbp
+  803882:	48 89 e5             	mov    %rsp,%rbp
+  803885:	41 57                	push   %r15
+  803887:	41 56                	push   %r14
+  803889:	41 55                	push   %r13
+  80388b:	41 54                	push   %r12
+  80388d:	53                   	push   %rbx
+  80388e:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803892:	48 85 ff             	test   %rdi,%rdi
+  803895:	0f 84 83 00 00 00    	je     80391e <devfile_write+0x9d>
+  80389b:	49 89 ff             	mov    %rdi,%r15
+  80389e:	49 89 f4             	mov    %rsi,%r12
+  8038a1:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038a4:	48 85 f6             	test   %rsi,%rsi
+  8038a7:	0f 84 a6 00 00 00    	je     803953 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038ad:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038b3:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038ba:	00 00 00 
+  8038bd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038c1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038c4:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038c8:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038cd:	48 39 d3             	cmp    %rdx,%rbx
+  8038d0:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038d4:	4c 89 e6             	mov    %r12,%rsi
+  8038d7:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038de:	00 00 00 
+  8038e1:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  8038e8:	00 00 00 
+  8038eb:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8038f7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8038fc:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  803903:	00 00 00 
+  803906:	ff d0                	call   *%rax
+        if (res < 0) {
+  803908:	85 c0                	test   %eax,%eax
+  80390a:	78 7c                	js     803988 <devfile_write+0x107>
+        total_written += res;
+  80390c:	48 98                	cltq
+  80390e:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803911:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803914:	48 29 c3             	sub    %rax,%rbx
+  803917:	75 a4                	jne    8038bd <devfile_write+0x3c>
+    return total_written;
+  803919:	4c 89 e8             	mov    %r13,%rax
+  80391c:	eb 6c                	jmp    80398a <devfile_write+0x109>
+    assert(fd);
+  80391e:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  803925:	00 00 00 
+  803928:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80392f:	00 00 00 
+  803932:	be bd 00 00 00       	mov    $0xbd,%esi
+  803937:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80393e:	00 00 00 
+  803941:	b8 00 00 00 00       	mov    $0x0,%eax
+  803946:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  80394d:	00 00 00 
+  803950:	41 ff d0             	call   *%r8
+    assert(buf);
+  803953:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  80395a:	00 00 00 
+  80395d:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803964:	00 00 00 
+  803967:	be be 00 00 00       	mov    $0xbe,%esi
+  80396c:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803973:	00 00 00 
+  803976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397b:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  803982:	00 00 00 
+  803985:	41 ff d0             	call   *%r8
+            return res;
+  803988:	48 98                	cltq
+}
+  80398a:	48 83 c4 08          	add    $0x8,%rsp
+  80398e:	5b                   	pop    %rbx
+  80398f:	41 5c                	pop    %r12
+  803991:	41 5d                	pop    %r13
+  803993:	41 5e                	pop    %r14
+  803995:	41 5f                	pop    %r15
+  803997:	5d                   	pop    %rbp
+  803998:	c3                   	ret
+
+0000000000803999 <open>:
+open(const char *path, int mode) {
+  803999:	55                   	push   %rbp
+  80399a:	48 89 e5             	mov    %rsp,%rbp
+  80399d:	41 55                	push   %r13
+  80399f:	41 54                	push   %r12
+  8039a1:	53                   	push   %rbx
+  8039a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8039a6:	49 89 fc             	mov    %rdi,%r12
+  8039a9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039ac:	48 b8 8f 1f 80 00 00 	movabs $0x801f8f,%rax
+  8039b3:	00 00 00 
+  8039b6:	ff d0                	call   *%rax
+  8039b8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039be:	0f 87 8f 00 00 00    	ja     803a53 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039c4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039c8:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+  8039d4:	89 c3                	mov    %eax,%ebx
+  8039d6:	85 c0                	test   %eax,%eax
+  8039d8:	78 55                	js     803a2f <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039da:	4c 89 e6             	mov    %r12,%rsi
+  8039dd:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039e4:	00 00 00 
+  8039e7:	48 89 df             	mov    %rbx,%rdi
+  8039ea:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  8039f1:	00 00 00 
+  8039f4:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039f6:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a02:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a06:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a0b:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  803a12:	00 00 00 
+  803a15:	ff d0                	call   *%rax
+  803a17:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a19:	85 c0                	test   %eax,%eax
+  803a1b:	78 1f                	js     803a3c <open+0xa3>
+    return fd2num(fd);
+  803a1d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a21:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  803a28:	00 00 00 
+  803a2b:	ff d0                	call   *%rax
+  803a2d:	89 c3                	mov    %eax,%ebx
+}
+  803a2f:	89 d8                	mov    %ebx,%eax
+  803a31:	48 83 c4 18          	add    $0x18,%rsp
+  803a35:	5b                   	pop    %rbx
+  803a36:	41 5c                	pop    %r12
+  803a38:	41 5d                	pop    %r13
+  803a3a:	5d                   	pop    %rbp
+  803a3b:	c3                   	ret
+        fd_close(fd, 0);
+  803a3c:	be 00 00 00 00       	mov    $0x0,%esi
+  803a41:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a45:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  803a4c:	00 00 00 
+  803a4f:	ff d0                	call   *%rax
+        return res;
+  803a51:	eb dc                	jmp    803a2f <open+0x96>
+        return -E_BAD_PATH;
+  803a53:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a58:	eb d5                	jmp    803a2f <open+0x96>
+
+0000000000803a5a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a5a:	55                   	push   %rbp
+  803a5b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a63:	be 00 00 00 00       	mov    $0x0,%esi
+  803a68:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a6d:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  803a74:	00 00 00 
+  803a77:	ff d0                	call   *%rax
+}
+  803a79:	5d                   	pop    %rbp
+  803a7a:	c3                   	ret
+
+0000000000803a7b <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a7b:	55                   	push   %rbp
+  803a7c:	48 89 e5             	mov    %rsp,%rbp
+  803a7f:	41 56                	push   %r14
+  803a81:	41 55                	push   %r13
+  803a83:	41 54                	push   %r12
+  803a85:	53                   	push   %rbx
+  803a86:	48 83 ec 10          	sub    $0x10,%rsp
+  803a8a:	41 89 f6             	mov    %esi,%r14d
+  803a8d:	49 89 d4             	mov    %rdx,%r12
+  803a90:	48 89 cb             	mov    %rcx,%rbx
+  803a93:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a96:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a9a:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  803aa1:	00 00 00 
+  803aa4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803aa6:	85 c0                	test   %eax,%eax
+  803aa8:	78 46                	js     803af0 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803aaa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803aae:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ab5:	00 00 00 
+  803ab8:	8b 00                	mov    (%rax),%eax
+  803aba:	39 02                	cmp    %eax,(%rdx)
+  803abc:	75 3f                	jne    803afd <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803abe:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ac5:	00 00 00 
+  803ac8:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803acb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803acd:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ad1:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ad5:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ad9:	48 89 da             	mov    %rbx,%rdx
+  803adc:	4c 89 e6             	mov    %r12,%rsi
+  803adf:	bf 09 00 00 00       	mov    $0x9,%edi
+  803ae4:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+}
+  803af0:	48 83 c4 10          	add    $0x10,%rsp
+  803af4:	5b                   	pop    %rbx
+  803af5:	41 5c                	pop    %r12
+  803af7:	41 5d                	pop    %r13
+  803af9:	41 5e                	pop    %r14
+  803afb:	5d                   	pop    %rbp
+  803afc:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803afd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b02:	eb ec                	jmp    803af0 <file_map+0x75>
+
+0000000000803b04 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b04:	55                   	push   %rbp
+  803b05:	48 89 e5             	mov    %rsp,%rbp
+  803b08:	41 54                	push   %r12
+  803b0a:	53                   	push   %rbx
+  803b0b:	48 83 ec 20          	sub    $0x20,%rsp
+  803b0f:	41 89 f4             	mov    %esi,%r12d
+  803b12:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b15:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b19:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  803b20:	00 00 00 
+  803b23:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b25:	85 c0                	test   %eax,%eax
+  803b27:	78 3c                	js     803b65 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b2d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b34:	00 00 00 
+  803b37:	8b 0a                	mov    (%rdx),%ecx
+  803b39:	39 08                	cmp    %ecx,(%rax)
+  803b3b:	75 31                	jne    803b6e <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b3d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b40:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b43:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b47:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b4b:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b50:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b54:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b59:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  803b60:	00 00 00 
+  803b63:	ff d0                	call   *%rax
+}
+  803b65:	48 83 c4 20          	add    $0x20,%rsp
+  803b69:	5b                   	pop    %rbx
+  803b6a:	41 5c                	pop    %r12
+  803b6c:	5d                   	pop    %rbp
+  803b6d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b6e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b73:	eb f0                	jmp    803b65 <file_msync+0x61>
+
+0000000000803b75 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b75:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b79:	7f 01                	jg     803b7c <writebuf+0x7>
+  803b7b:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b7c:	55                   	push   %rbp
+  803b7d:	48 89 e5             	mov    %rsp,%rbp
+  803b80:	53                   	push   %rbx
+  803b81:	48 83 ec 08          	sub    $0x8,%rsp
+  803b85:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b88:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b8c:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b90:	8b 3f                	mov    (%rdi),%edi
+  803b92:	48 b8 30 32 80 00 00 	movabs $0x803230,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803b9e:	48 85 c0             	test   %rax,%rax
+  803ba1:	7e 04                	jle    803ba7 <writebuf+0x32>
+  803ba3:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803ba7:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bab:	48 39 c2             	cmp    %rax,%rdx
+  803bae:	74 0f                	je     803bbf <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bb0:	48 85 c0             	test   %rax,%rax
+  803bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bb8:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bbc:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bc3:	c9                   	leave
+  803bc4:	c3                   	ret
+
+0000000000803bc5 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bc5:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bc8:	8d 50 01             	lea    0x1(%rax),%edx
+  803bcb:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bce:	48 98                	cltq
+  803bd0:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bd5:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bdb:	74 01                	je     803bde <putch+0x19>
+  803bdd:	c3                   	ret
+putch(int ch, void *arg) {
+  803bde:	55                   	push   %rbp
+  803bdf:	48 89 e5             	mov    %rsp,%rbp
+  803be2:	53                   	push   %rbx
+  803be3:	48 83 ec 08          	sub    $0x8,%rsp
+  803be7:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bea:	48 89 f7             	mov    %rsi,%rdi
+  803bed:	48 b8 75 3b 80 00 00 	movabs $0x803b75,%rax
+  803bf4:	00 00 00 
+  803bf7:	ff d0                	call   *%rax
+        state->offset = 0;
+  803bf9:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c04:	c9                   	leave
+  803c05:	c3                   	ret
+
+0000000000803c06 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c06:	55                   	push   %rbp
+  803c07:	48 89 e5             	mov    %rsp,%rbp
+  803c0a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c11:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c14:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c1a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c21:	00 00 00 
+    state.result = 0;
+  803c24:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c2b:	00 00 00 00 
+    state.error = 1;
+  803c2f:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c36:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c39:	48 89 f2             	mov    %rsi,%rdx
+  803c3c:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c43:	48 bf c5 3b 80 00 00 	movabs $0x803bc5,%rdi
+  803c4a:	00 00 00 
+  803c4d:	48 b8 e6 17 80 00 00 	movabs $0x8017e6,%rax
+  803c54:	00 00 00 
+  803c57:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c59:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c60:	7f 14                	jg     803c76 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c62:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c69:	48 85 c0             	test   %rax,%rax
+  803c6c:	75 06                	jne    803c74 <vfprintf+0x6e>
+  803c6e:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c74:	c9                   	leave
+  803c75:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c76:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c7d:	48 b8 75 3b 80 00 00 	movabs $0x803b75,%rax
+  803c84:	00 00 00 
+  803c87:	ff d0                	call   *%rax
+  803c89:	eb d7                	jmp    803c62 <vfprintf+0x5c>
+
+0000000000803c8b <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c8b:	55                   	push   %rbp
+  803c8c:	48 89 e5             	mov    %rsp,%rbp
+  803c8f:	48 83 ec 50          	sub    $0x50,%rsp
+  803c93:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c97:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803c9b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c9f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ca3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803caa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cb2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cb6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cba:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cbe:	48 b8 06 3c 80 00 00 	movabs $0x803c06,%rax
+  803cc5:	00 00 00 
+  803cc8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cca:	c9                   	leave
+  803ccb:	c3                   	ret
+
+0000000000803ccc <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803ccc:	55                   	push   %rbp
+  803ccd:	48 89 e5             	mov    %rsp,%rbp
+  803cd0:	48 83 ec 50          	sub    $0x50,%rsp
+  803cd4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cd8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cdc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ce0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ce4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ce8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cf3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cf7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cfb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803cff:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d03:	48 89 fe             	mov    %rdi,%rsi
+  803d06:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d0b:	48 b8 06 3c 80 00 00 	movabs $0x803c06,%rax
+  803d12:	00 00 00 
+  803d15:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d17:	c9                   	leave
+  803d18:	c3                   	ret
+
+0000000000803d19 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d19:	55                   	push   %rbp
+  803d1a:	48 89 e5             	mov    %rsp,%rbp
+  803d1d:	41 54                	push   %r12
+  803d1f:	53                   	push   %rbx
+  803d20:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d23:	48 b8 a2 2d 80 00 00 	movabs $0x802da2,%rax
+  803d2a:	00 00 00 
+  803d2d:	ff d0                	call   *%rax
+  803d2f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d32:	48 be 90 62 80 00 00 	movabs $0x806290,%rsi
+  803d39:	00 00 00 
+  803d3c:	48 89 df             	mov    %rbx,%rdi
+  803d3f:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  803d46:	00 00 00 
+  803d49:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d4b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d50:	41 2b 04 24          	sub    (%r12),%eax
+  803d54:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d5a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d61:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d64:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d6b:	00 00 00 
+  803d6e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d75:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d7a:	5b                   	pop    %rbx
+  803d7b:	41 5c                	pop    %r12
+  803d7d:	5d                   	pop    %rbp
+  803d7e:	c3                   	ret
+
+0000000000803d7f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d7f:	55                   	push   %rbp
+  803d80:	48 89 e5             	mov    %rsp,%rbp
+  803d83:	41 54                	push   %r12
+  803d85:	53                   	push   %rbx
+  803d86:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d8e:	48 89 fe             	mov    %rdi,%rsi
+  803d91:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d96:	49 bc 0a 28 80 00 00 	movabs $0x80280a,%r12
+  803d9d:	00 00 00 
+  803da0:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803da3:	48 89 df             	mov    %rbx,%rdi
+  803da6:	48 b8 a2 2d 80 00 00 	movabs $0x802da2,%rax
+  803dad:	00 00 00 
+  803db0:	ff d0                	call   *%rax
+  803db2:	48 89 c6             	mov    %rax,%rsi
+  803db5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dbf:	41 ff d4             	call   *%r12
+}
+  803dc2:	5b                   	pop    %rbx
+  803dc3:	41 5c                	pop    %r12
+  803dc5:	5d                   	pop    %rbp
+  803dc6:	c3                   	ret
+
+0000000000803dc7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dc7:	55                   	push   %rbp
+  803dc8:	48 89 e5             	mov    %rsp,%rbp
+  803dcb:	41 57                	push   %r15
+  803dcd:	41 56                	push   %r14
+  803dcf:	41 55                	push   %r13
+  803dd1:	41 54                	push   %r12
+  803dd3:	53                   	push   %rbx
+  803dd4:	48 83 ec 18          	sub    $0x18,%rsp
+  803dd8:	49 89 fc             	mov    %rdi,%r12
+  803ddb:	49 89 f5             	mov    %rsi,%r13
+  803dde:	49 89 d7             	mov    %rdx,%r15
+  803de1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803de5:	48 b8 a2 2d 80 00 00 	movabs $0x802da2,%rax
+  803dec:	00 00 00 
+  803def:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803df1:	4d 85 ff             	test   %r15,%r15
+  803df4:	0f 84 af 00 00 00    	je     803ea9 <devpipe_write+0xe2>
+  803dfa:	48 89 c3             	mov    %rax,%rbx
+  803dfd:	4c 89 f8             	mov    %r15,%rax
+  803e00:	4d 89 ef             	mov    %r13,%r15
+  803e03:	4c 01 e8             	add    %r13,%rax
+  803e06:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e0a:	49 bd 00 27 80 00 00 	movabs $0x802700,%r13
+  803e11:	00 00 00 
+            sys_yield();
+  803e14:	49 be 91 26 80 00 00 	movabs $0x802691,%r14
+  803e1b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e1e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e21:	48 63 ce             	movslq %esi,%rcx
+  803e24:	48 63 03             	movslq (%rbx),%rax
+  803e27:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e2d:	48 39 c1             	cmp    %rax,%rcx
+  803e30:	72 2e                	jb     803e60 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e32:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e37:	48 89 da             	mov    %rbx,%rdx
+  803e3a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e3f:	4c 89 e7             	mov    %r12,%rdi
+  803e42:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e45:	85 c0                	test   %eax,%eax
+  803e47:	74 66                	je     803eaf <devpipe_write+0xe8>
+            sys_yield();
+  803e49:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e4c:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e4f:	48 63 ce             	movslq %esi,%rcx
+  803e52:	48 63 03             	movslq (%rbx),%rax
+  803e55:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e5b:	48 39 c1             	cmp    %rax,%rcx
+  803e5e:	73 d2                	jae    803e32 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e60:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e64:	48 89 ca             	mov    %rcx,%rdx
+  803e67:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e6b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e72:	08 10 20 
+  803e75:	48 f7 e2             	mul    %rdx
+  803e78:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e7c:	48 89 d0             	mov    %rdx,%rax
+  803e7f:	48 c1 e0 09          	shl    $0x9,%rax
+  803e83:	48 29 d0             	sub    %rdx,%rax
+  803e86:	48 c1 e0 03          	shl    $0x3,%rax
+  803e8a:	48 29 c1             	sub    %rax,%rcx
+  803e8d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e92:	83 c6 01             	add    $0x1,%esi
+  803e95:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e98:	49 83 c7 01          	add    $0x1,%r15
+  803e9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ea0:	49 39 c7             	cmp    %rax,%r15
+  803ea3:	0f 85 75 ff ff ff    	jne    803e1e <devpipe_write+0x57>
+    return n;
+  803ea9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ead:	eb 05                	jmp    803eb4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eb4:	48 83 c4 18          	add    $0x18,%rsp
+  803eb8:	5b                   	pop    %rbx
+  803eb9:	41 5c                	pop    %r12
+  803ebb:	41 5d                	pop    %r13
+  803ebd:	41 5e                	pop    %r14
+  803ebf:	41 5f                	pop    %r15
+  803ec1:	5d                   	pop    %rbp
+  803ec2:	c3                   	ret
+
+0000000000803ec3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ec3:	55                   	push   %rbp
+  803ec4:	48 89 e5             	mov    %rsp,%rbp
+  803ec7:	41 57                	push   %r15
+  803ec9:	41 56                	push   %r14
+  803ecb:	41 55                	push   %r13
+  803ecd:	41 54                	push   %r12
+  803ecf:	53                   	push   %rbx
+  803ed0:	48 83 ec 18          	sub    $0x18,%rsp
+  803ed4:	49 89 fc             	mov    %rdi,%r12
+  803ed7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803edb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803edf:	48 b8 a2 2d 80 00 00 	movabs $0x802da2,%rax
+  803ee6:	00 00 00 
+  803ee9:	ff d0                	call   *%rax
+  803eeb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803eee:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ef4:	49 bd 00 27 80 00 00 	movabs $0x802700,%r13
+  803efb:	00 00 00 
+            sys_yield();
+  803efe:	49 be 91 26 80 00 00 	movabs $0x802691,%r14
+  803f05:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f08:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f0d:	74 7d                	je     803f8c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f0f:	8b 03                	mov    (%rbx),%eax
+  803f11:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f14:	75 26                	jne    803f3c <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f16:	4d 85 ff             	test   %r15,%r15
+  803f19:	75 77                	jne    803f92 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f1b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f20:	48 89 da             	mov    %rbx,%rdx
+  803f23:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f28:	4c 89 e7             	mov    %r12,%rdi
+  803f2b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f2e:	85 c0                	test   %eax,%eax
+  803f30:	74 72                	je     803fa4 <devpipe_read+0xe1>
+            sys_yield();
+  803f32:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f35:	8b 03                	mov    (%rbx),%eax
+  803f37:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f3a:	74 df                	je     803f1b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f3c:	48 63 c8             	movslq %eax,%rcx
+  803f3f:	48 89 ca             	mov    %rcx,%rdx
+  803f42:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f46:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f4d:	08 10 20 
+  803f50:	48 89 d0             	mov    %rdx,%rax
+  803f53:	48 f7 e6             	mul    %rsi
+  803f56:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f5a:	48 89 d0             	mov    %rdx,%rax
+  803f5d:	48 c1 e0 09          	shl    $0x9,%rax
+  803f61:	48 29 d0             	sub    %rdx,%rax
+  803f64:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f6b:	00 
+  803f6c:	48 89 c8             	mov    %rcx,%rax
+  803f6f:	48 29 d0             	sub    %rdx,%rax
+  803f72:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f77:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f7b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f7f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f82:	49 83 c7 01          	add    $0x1,%r15
+  803f86:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f8a:	75 83                	jne    803f0f <devpipe_read+0x4c>
+    return n;
+  803f8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f90:	eb 03                	jmp    803f95 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f92:	4c 89 f8             	mov    %r15,%rax
+}
+  803f95:	48 83 c4 18          	add    $0x18,%rsp
+  803f99:	5b                   	pop    %rbx
+  803f9a:	41 5c                	pop    %r12
+  803f9c:	41 5d                	pop    %r13
+  803f9e:	41 5e                	pop    %r14
+  803fa0:	41 5f                	pop    %r15
+  803fa2:	5d                   	pop    %rbp
+  803fa3:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa9:	eb ea                	jmp    803f95 <devpipe_read+0xd2>
+
+0000000000803fab <pipe>:
+pipe(int pfd[2]) {
+  803fab:	55                   	push   %rbp
+  803fac:	48 89 e5             	mov    %rsp,%rbp
+  803faf:	41 55                	push   %r13
+  803fb1:	41 54                	push   %r12
+  803fb3:	53                   	push   %rbx
+  803fb4:	48 83 ec 18          	sub    $0x18,%rsp
+  803fb8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fbb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fbf:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  803fc6:	00 00 00 
+  803fc9:	ff d0                	call   *%rax
+  803fcb:	89 c3                	mov    %eax,%ebx
+  803fcd:	85 c0                	test   %eax,%eax
+  803fcf:	0f 88 a0 01 00 00    	js     804175 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fd5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fdf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fe3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fe8:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  803fef:	00 00 00 
+  803ff2:	ff d0                	call   *%rax
+  803ff4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ff6:	85 c0                	test   %eax,%eax
+  803ff8:	0f 88 77 01 00 00    	js     804175 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ffe:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804002:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  804009:	00 00 00 
+  80400c:	ff d0                	call   *%rax
+  80400e:	89 c3                	mov    %eax,%ebx
+  804010:	85 c0                	test   %eax,%eax
+  804012:	0f 88 43 01 00 00    	js     80415b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804018:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80401d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804022:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804026:	bf 00 00 00 00       	mov    $0x0,%edi
+  80402b:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  804032:	00 00 00 
+  804035:	ff d0                	call   *%rax
+  804037:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804039:	85 c0                	test   %eax,%eax
+  80403b:	0f 88 1a 01 00 00    	js     80415b <pipe+0x1b0>
+    va = fd2data(fd0);
+  804041:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804045:	48 b8 a2 2d 80 00 00 	movabs $0x802da2,%rax
+  80404c:	00 00 00 
+  80404f:	ff d0                	call   *%rax
+  804051:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804054:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804059:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80405e:	48 89 c6             	mov    %rax,%rsi
+  804061:	bf 00 00 00 00       	mov    $0x0,%edi
+  804066:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  80406d:	00 00 00 
+  804070:	ff d0                	call   *%rax
+  804072:	89 c3                	mov    %eax,%ebx
+  804074:	85 c0                	test   %eax,%eax
+  804076:	0f 88 c5 00 00 00    	js     804141 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80407c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804080:	48 b8 a2 2d 80 00 00 	movabs $0x802da2,%rax
+  804087:	00 00 00 
+  80408a:	ff d0                	call   *%rax
+  80408c:	48 89 c1             	mov    %rax,%rcx
+  80408f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804095:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80409b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a0:	4c 89 ee             	mov    %r13,%rsi
+  8040a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040a8:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  8040af:	00 00 00 
+  8040b2:	ff d0                	call   *%rax
+  8040b4:	89 c3                	mov    %eax,%ebx
+  8040b6:	85 c0                	test   %eax,%eax
+  8040b8:	78 6e                	js     804128 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040ba:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040bf:	4c 89 ef             	mov    %r13,%rdi
+  8040c2:	48 b8 c8 26 80 00 00 	movabs $0x8026c8,%rax
+  8040c9:	00 00 00 
+  8040cc:	ff d0                	call   *%rax
+  8040ce:	83 f8 02             	cmp    $0x2,%eax
+  8040d1:	0f 85 ab 00 00 00    	jne    804182 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040d7:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040de:	00 00 
+  8040e0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040e4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040e6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040ea:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040f1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040f5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040fb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804102:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804106:	48 bb 90 2d 80 00 00 	movabs $0x802d90,%rbx
+  80410d:	00 00 00 
+  804110:	ff d3                	call   *%rbx
+  804112:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804116:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80411a:	ff d3                	call   *%rbx
+  80411c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804121:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804126:	eb 4d                	jmp    804175 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804128:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80412d:	4c 89 ee             	mov    %r13,%rsi
+  804130:	bf 00 00 00 00       	mov    $0x0,%edi
+  804135:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  80413c:	00 00 00 
+  80413f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804141:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804146:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80414a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80414f:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  804156:	00 00 00 
+  804159:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80415b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804160:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804164:	bf 00 00 00 00       	mov    $0x0,%edi
+  804169:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  804170:	00 00 00 
+  804173:	ff d0                	call   *%rax
+}
+  804175:	89 d8                	mov    %ebx,%eax
+  804177:	48 83 c4 18          	add    $0x18,%rsp
+  80417b:	5b                   	pop    %rbx
+  80417c:	41 5c                	pop    %r12
+  80417e:	41 5d                	pop    %r13
+  804180:	5d                   	pop    %rbp
+  804181:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804182:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  804189:	00 00 00 
+  80418c:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804193:	00 00 00 
+  804196:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80419b:	48 bf 97 62 80 00 00 	movabs $0x806297,%rdi
+  8041a2:	00 00 00 
+  8041a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041aa:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  8041b1:	00 00 00 
+  8041b4:	41 ff d0             	call   *%r8
+
+00000000008041b7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041b7:	55                   	push   %rbp
+  8041b8:	48 89 e5             	mov    %rsp,%rbp
+  8041bb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041bf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041c3:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  8041ca:	00 00 00 
+  8041cd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041cf:	85 c0                	test   %eax,%eax
+  8041d1:	78 35                	js     804208 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041d3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041d7:	48 b8 a2 2d 80 00 00 	movabs $0x802da2,%rax
+  8041de:	00 00 00 
+  8041e1:	ff d0                	call   *%rax
+  8041e3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041e6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041eb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041f0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041f4:	48 b8 00 27 80 00 00 	movabs $0x802700,%rax
+  8041fb:	00 00 00 
+  8041fe:	ff d0                	call   *%rax
+  804200:	85 c0                	test   %eax,%eax
+  804202:	0f 94 c0             	sete   %al
+  804205:	0f b6 c0             	movzbl %al,%eax
+}
+  804208:	c9                   	leave
+  804209:	c3                   	ret
+
+000000000080420a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80420a:	48 89 f8             	mov    %rdi,%rax
+  80420d:	48 c1 e8 27          	shr    $0x27,%rax
+  804211:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804218:	01 00 00 
+  80421b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80421f:	f6 c2 01             	test   $0x1,%dl
+  804222:	74 6d                	je     804291 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804224:	48 89 f8             	mov    %rdi,%rax
+  804227:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80422b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804232:	01 00 00 
+  804235:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804239:	f6 c2 01             	test   $0x1,%dl
+  80423c:	74 62                	je     8042a0 <get_uvpt_entry+0x96>
+  80423e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804245:	01 00 00 
+  804248:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80424c:	f6 c2 80             	test   $0x80,%dl
+  80424f:	75 4f                	jne    8042a0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804251:	48 89 f8             	mov    %rdi,%rax
+  804254:	48 c1 e8 15          	shr    $0x15,%rax
+  804258:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80425f:	01 00 00 
+  804262:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804266:	f6 c2 01             	test   $0x1,%dl
+  804269:	74 44                	je     8042af <get_uvpt_entry+0xa5>
+  80426b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804272:	01 00 00 
+  804275:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804279:	f6 c2 80             	test   $0x80,%dl
+  80427c:	75 31                	jne    8042af <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80427e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804282:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804289:	01 00 00 
+  80428c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804290:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804291:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804298:	01 00 00 
+  80429b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80429f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042a0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042a7:	01 00 00 
+  8042aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ae:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042af:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042b6:	01 00 00 
+  8042b9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042bd:	c3                   	ret
+
+00000000008042be <get_prot>:
+
+int
+get_prot(void *va) {
+  8042be:	55                   	push   %rbp
+  8042bf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042c2:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  8042c9:	00 00 00 
+  8042cc:	ff d0                	call   *%rax
+  8042ce:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042d1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042d6:	89 c1                	mov    %eax,%ecx
+  8042d8:	83 c9 04             	or     $0x4,%ecx
+  8042db:	f6 c2 01             	test   $0x1,%dl
+  8042de:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042e1:	89 c1                	mov    %eax,%ecx
+  8042e3:	83 c9 02             	or     $0x2,%ecx
+  8042e6:	f6 c2 02             	test   $0x2,%dl
+  8042e9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042ec:	89 c1                	mov    %eax,%ecx
+  8042ee:	83 c9 01             	or     $0x1,%ecx
+  8042f1:	48 85 d2             	test   %rdx,%rdx
+  8042f4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042f7:	89 c1                	mov    %eax,%ecx
+  8042f9:	83 c9 40             	or     $0x40,%ecx
+  8042fc:	f6 c6 04             	test   $0x4,%dh
+  8042ff:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804302:	5d                   	pop    %rbp
+  804303:	c3                   	ret
+
+0000000000804304 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804304:	55                   	push   %rbp
+  804305:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804308:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  80430f:	00 00 00 
+  804312:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804314:	48 c1 e8 06          	shr    $0x6,%rax
+  804318:	83 e0 01             	and    $0x1,%eax
+}
+  80431b:	5d                   	pop    %rbp
+  80431c:	c3                   	ret
+
+000000000080431d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80431d:	55                   	push   %rbp
+  80431e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804321:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  804328:	00 00 00 
+  80432b:	ff d0                	call   *%rax
+  80432d:	83 e0 01             	and    $0x1,%eax
+}
+  804330:	5d                   	pop    %rbp
+  804331:	c3                   	ret
+
+0000000000804332 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804332:	55                   	push   %rbp
+  804333:	48 89 e5             	mov    %rsp,%rbp
+  804336:	41 57                	push   %r15
+  804338:	41 56                	push   %r14
+  80433a:	41 55                	push   %r13
+  80433c:	41 54                	push   %r12
+  80433e:	53                   	push   %rbx
+  80433f:	48 83 ec 28          	sub    $0x28,%rsp
+  804343:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804347:	48 85 ff             	test   %rdi,%rdi
+  80434a:	74 1e                	je     80436a <foreach_shared_region+0x38>
+  80434c:	49 89 ff             	mov    %rdi,%r15
+  80434f:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804355:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80435b:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804362:	01 00 00 
+  804365:	e9 72 02 00 00       	jmp    8045dc <foreach_shared_region+0x2aa>
+    assert(fun);
+  80436a:	48 b9 cc 62 80 00 00 	movabs $0x8062cc,%rcx
+  804371:	00 00 00 
+  804374:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80437b:	00 00 00 
+  80437e:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804383:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  80438a:	00 00 00 
+  80438d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804392:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  804399:	00 00 00 
+  80439c:	41 ff d0             	call   *%r8
+  80439f:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043a6:	eb 6c                	jmp    804414 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043a8:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043af:	ff ff ff 
+  8043b2:	4c 21 e2             	and    %r12,%rdx
+  8043b5:	48 89 d8             	mov    %rbx,%rax
+  8043b8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043bd:	48 83 c0 01          	add    $0x1,%rax
+  8043c1:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043c5:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043cc:	00 00 00 
+  8043cf:	48 21 c8             	and    %rcx,%rax
+  8043d2:	48 09 d0             	or     %rdx,%rax
+  8043d5:	49 89 c4             	mov    %rax,%r12
+  8043d8:	eb 30                	jmp    80440a <foreach_shared_region+0xd8>
+  8043da:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043e1:	ff ff ff 
+  8043e4:	4c 21 e2             	and    %r12,%rdx
+  8043e7:	48 89 d8             	mov    %rbx,%rax
+  8043ea:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043ef:	48 83 c0 01          	add    $0x1,%rax
+  8043f3:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043f7:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043fe:	00 00 00 
+  804401:	48 21 c8             	and    %rcx,%rax
+  804404:	48 09 d0             	or     %rdx,%rax
+  804407:	49 89 c4             	mov    %rax,%r12
+  80440a:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80440e:	0f 84 99 01 00 00    	je     8045ad <foreach_shared_region+0x27b>
+  804414:	4c 89 e3             	mov    %r12,%rbx
+  804417:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80441b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804422:	01 00 00 
+  804425:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804429:	a8 01                	test   $0x1,%al
+  80442b:	0f 84 77 ff ff ff    	je     8043a8 <foreach_shared_region+0x76>
+  804431:	a8 80                	test   $0x80,%al
+  804433:	74 19                	je     80444e <foreach_shared_region+0x11c>
+  804435:	f6 c4 04             	test   $0x4,%ah
+  804438:	74 a0                	je     8043da <foreach_shared_region+0xa8>
+  80443a:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804441:	40 
+  804442:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804446:	4c 89 e7             	mov    %r12,%rdi
+  804449:	41 ff d7             	call   *%r15
+  80444c:	eb 8c                	jmp    8043da <foreach_shared_region+0xa8>
+  80444e:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804455:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804459:	eb 46                	jmp    8044a1 <foreach_shared_region+0x16f>
+  80445b:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804462:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804468:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80446c:	48 c1 e0 15          	shl    $0x15,%rax
+  804470:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804475:	49 09 c4             	or     %rax,%r12
+  804478:	eb 1d                	jmp    804497 <foreach_shared_region+0x165>
+  80447a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804481:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804487:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80448b:	48 c1 e0 15          	shl    $0x15,%rax
+  80448f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804494:	49 09 c4             	or     %rax,%r12
+  804497:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80449b:	0f 84 d3 00 00 00    	je     804574 <foreach_shared_region+0x242>
+  8044a1:	4c 89 e3             	mov    %r12,%rbx
+  8044a4:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044a8:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044af:	01 00 00 
+  8044b2:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044b6:	a8 01                	test   $0x1,%al
+  8044b8:	74 a1                	je     80445b <foreach_shared_region+0x129>
+  8044ba:	a8 80                	test   $0x80,%al
+  8044bc:	74 19                	je     8044d7 <foreach_shared_region+0x1a5>
+  8044be:	f6 c4 04             	test   $0x4,%ah
+  8044c1:	74 b7                	je     80447a <foreach_shared_region+0x148>
+  8044c3:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044ca:	00 
+  8044cb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044cf:	4c 89 e7             	mov    %r12,%rdi
+  8044d2:	41 ff d7             	call   *%r15
+  8044d5:	eb a3                	jmp    80447a <foreach_shared_region+0x148>
+  8044d7:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044dd:	eb 3b                	jmp    80451a <foreach_shared_region+0x1e8>
+  8044df:	f6 c4 04             	test   $0x4,%ah
+  8044e2:	74 12                	je     8044f6 <foreach_shared_region+0x1c4>
+  8044e4:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044eb:	00 
+  8044ec:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044f0:	4c 89 e7             	mov    %r12,%rdi
+  8044f3:	41 ff d7             	call   *%r15
+  8044f6:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8044fd:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804503:	48 83 c3 01          	add    $0x1,%rbx
+  804507:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80450b:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804511:	49 09 dc             	or     %rbx,%r12
+  804514:	41 83 ed 01          	sub    $0x1,%r13d
+  804518:	74 2f                	je     804549 <foreach_shared_region+0x217>
+  80451a:	4c 89 e3             	mov    %r12,%rbx
+  80451d:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804521:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804525:	a8 01                	test   $0x1,%al
+  804527:	75 b6                	jne    8044df <foreach_shared_region+0x1ad>
+  804529:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804530:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804536:	48 83 c3 01          	add    $0x1,%rbx
+  80453a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80453e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804544:	49 09 dc             	or     %rbx,%r12
+  804547:	eb cb                	jmp    804514 <foreach_shared_region+0x1e2>
+  804549:	4c 89 e0             	mov    %r12,%rax
+  80454c:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804552:	49 c1 ec 15          	shr    $0x15,%r12
+  804556:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80455d:	49 83 c4 01          	add    $0x1,%r12
+  804561:	49 c1 e4 15          	shl    $0x15,%r12
+  804565:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80456c:	49 09 c4             	or     %rax,%r12
+  80456f:	e9 23 ff ff ff       	jmp    804497 <foreach_shared_region+0x165>
+  804574:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804578:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80457f:	ff ff ff 
+  804582:	4c 21 e0             	and    %r12,%rax
+  804585:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804589:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804590:	49 83 c4 01          	add    $0x1,%r12
+  804594:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804598:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  80459f:	00 00 00 
+  8045a2:	49 21 d4             	and    %rdx,%r12
+  8045a5:	49 09 c4             	or     %rax,%r12
+  8045a8:	e9 5d fe ff ff       	jmp    80440a <foreach_shared_region+0xd8>
+  8045ad:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045b4:	00 ff ff 
+  8045b7:	4c 21 e0             	and    %r12,%rax
+  8045ba:	49 c1 ec 27          	shr    $0x27,%r12
+  8045be:	49 83 c4 01          	add    $0x1,%r12
+  8045c2:	49 c1 e4 27          	shl    $0x27,%r12
+  8045c6:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045cd:	ff 00 00 
+  8045d0:	49 21 d4             	and    %rdx,%r12
+  8045d3:	49 09 c4             	or     %rax,%r12
+  8045d6:	41 83 ed 01          	sub    $0x1,%r13d
+  8045da:	74 48                	je     804624 <foreach_shared_region+0x2f2>
+  8045dc:	4c 89 e0             	mov    %r12,%rax
+  8045df:	48 c1 e8 27          	shr    $0x27,%rax
+  8045e3:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045ea:	01 00 00 
+  8045ed:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045f1:	f6 c2 01             	test   $0x1,%dl
+  8045f4:	0f 85 a5 fd ff ff    	jne    80439f <foreach_shared_region+0x6d>
+  8045fa:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804601:	00 ff ff 
+  804604:	4c 21 e2             	and    %r12,%rdx
+  804607:	48 83 c0 01          	add    $0x1,%rax
+  80460b:	48 c1 e0 27          	shl    $0x27,%rax
+  80460f:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804616:	ff 00 00 
+  804619:	48 21 c8             	and    %rcx,%rax
+  80461c:	48 09 d0             	or     %rdx,%rax
+  80461f:	49 89 c4             	mov    %rax,%r12
+  804622:	eb b2                	jmp    8045d6 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804624:	4d 85 e4             	test   %r12,%r12
+  804627:	75 14                	jne    80463d <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80462e:	48 83 c4 28          	add    $0x28,%rsp
+  804632:	5b                   	pop    %rbx
+  804633:	41 5c                	pop    %r12
+  804635:	41 5d                	pop    %r13
+  804637:	41 5e                	pop    %r14
+  804639:	41 5f                	pop    %r15
+  80463b:	5d                   	pop    %rbp
+  80463c:	c3                   	ret
+    assert(addr == 0);
+  80463d:	48 b9 db 62 80 00 00 	movabs $0x8062db,%rcx
+  804644:	00 00 00 
+  804647:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80464e:	00 00 00 
+  804651:	be 67 00 00 00       	mov    $0x67,%esi
+  804656:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  80465d:	00 00 00 
+  804660:	b8 00 00 00 00       	mov    $0x0,%eax
+  804665:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  80466c:	00 00 00 
+  80466f:	41 ff d0             	call   *%r8
+
+0000000000804672 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804672:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804679:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80467c:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804682:	eb 33                	jmp    8046b7 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804684:	48 83 c0 20          	add    $0x20,%rax
+  804688:	4c 39 c0             	cmp    %r8,%rax
+  80468b:	74 25                	je     8046b2 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80468d:	48 8b 10             	mov    (%rax),%rdx
+  804690:	48 85 d2             	test   %rdx,%rdx
+  804693:	74 ef                	je     804684 <mmap_place+0x12>
+  804695:	48 89 d1             	mov    %rdx,%rcx
+  804698:	48 03 48 08          	add    0x8(%rax),%rcx
+  80469c:	48 39 cf             	cmp    %rcx,%rdi
+  80469f:	73 e3                	jae    804684 <mmap_place+0x12>
+  8046a1:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046a5:	4c 39 ca             	cmp    %r9,%rdx
+  8046a8:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046ac:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046b0:	eb d2                	jmp    804684 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046b2:	45 84 d2             	test   %r10b,%r10b
+  8046b5:	74 12                	je     8046c9 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046b7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046be:	00 00 00 
+        moved = 0;
+  8046c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046c7:	eb c4                	jmp    80468d <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046c9:	48 01 fe             	add    %rdi,%rsi
+  8046cc:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046d3:	00 00 00 
+  8046d6:	48 39 f0             	cmp    %rsi,%rax
+  8046d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046de:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046e2:	c3                   	ret
+
+00000000008046e3 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046e3:	55                   	push   %rbp
+  8046e4:	48 89 e5             	mov    %rsp,%rbp
+  8046e7:	41 57                	push   %r15
+  8046e9:	41 56                	push   %r14
+  8046eb:	41 55                	push   %r13
+  8046ed:	41 54                	push   %r12
+  8046ef:	53                   	push   %rbx
+  8046f0:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046f4:	48 8b 1f             	mov    (%rdi),%rbx
+  8046f7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046fe:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804705:	00 00 00 
+  804708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80470d:	eb 12                	jmp    804721 <mmap_pgfault+0x3e>
+  80470f:	48 83 c2 01          	add    $0x1,%rdx
+  804713:	48 83 c0 20          	add    $0x20,%rax
+  804717:	48 83 fa 20          	cmp    $0x20,%rdx
+  80471b:	0f 84 04 01 00 00    	je     804825 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804721:	48 8b 08             	mov    (%rax),%rcx
+  804724:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804728:	48 39 de             	cmp    %rbx,%rsi
+  80472b:	73 e2                	jae    80470f <mmap_pgfault+0x2c>
+  80472d:	48 03 48 08          	add    0x8(%rax),%rcx
+  804731:	48 39 cb             	cmp    %rcx,%rbx
+  804734:	73 d9                	jae    80470f <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804736:	48 c1 e2 05          	shl    $0x5,%rdx
+  80473a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804741:	00 00 00 
+  804744:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804748:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80474c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804750:	f6 c2 01             	test   $0x1,%dl
+  804753:	0f 84 e0 00 00 00    	je     804839 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80475e:	f6 c2 02             	test   $0x2,%dl
+  804761:	0f 84 c3 00 00 00    	je     80482a <mmap_pgfault+0x147>
+  804767:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80476e:	ff ff ff 
+  804771:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804775:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80477c:	00 00 00 
+  80477f:	48 39 ca             	cmp    %rcx,%rdx
+  804782:	0f 85 a2 00 00 00    	jne    80482a <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804788:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80478d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804792:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804799:	00 00 00 
+  80479c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047a1:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  8047a8:	00 00 00 
+  8047ab:	ff d0                	call   *%rax
+  8047ad:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b4:	85 d2                	test   %edx,%edx
+  8047b6:	78 72                	js     80482a <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047bd:	48 89 de             	mov    %rbx,%rsi
+  8047c0:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047c7:	00 00 00 
+  8047ca:	4c 89 e7             	mov    %r12,%rdi
+  8047cd:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  8047d4:	00 00 00 
+  8047d7:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047d9:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047df:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047e5:	48 89 d9             	mov    %rbx,%rcx
+  8047e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047ed:	4c 89 e6             	mov    %r12,%rsi
+  8047f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047f5:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  8047fc:	00 00 00 
+  8047ff:	ff d0                	call   *%rax
+  804801:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804803:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804808:	4c 89 e6             	mov    %r12,%rsi
+  80480b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804810:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  804817:	00 00 00 
+  80481a:	ff d0                	call   *%rax
+    return res >= 0;
+  80481c:	89 d8                	mov    %ebx,%eax
+  80481e:	f7 d0                	not    %eax
+  804820:	c1 e8 1f             	shr    $0x1f,%eax
+  804823:	eb 05                	jmp    80482a <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804825:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80482a:	48 83 c4 18          	add    $0x18,%rsp
+  80482e:	5b                   	pop    %rbx
+  80482f:	41 5c                	pop    %r12
+  804831:	41 5d                	pop    %r13
+  804833:	41 5e                	pop    %r14
+  804835:	41 5f                	pop    %r15
+  804837:	5d                   	pop    %rbp
+  804838:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804839:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80483d:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804841:	4c 03 30             	add    (%rax),%r14
+  804844:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80484b:	49 39 c6             	cmp    %rax,%r14
+  80484e:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804852:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804859:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80485f:	49 bf 1d 43 80 00 00 	movabs $0x80431d,%r15
+  804866:	00 00 00 
+  804869:	4d 39 f4             	cmp    %r14,%r12
+  80486c:	73 1d                	jae    80488b <mmap_pgfault+0x1a8>
+  80486e:	4c 89 e7             	mov    %r12,%rdi
+  804871:	41 ff d7             	call   *%r15
+  804874:	84 c0                	test   %al,%al
+  804876:	75 13                	jne    80488b <mmap_pgfault+0x1a8>
+  804878:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80487f:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804886:	4d 39 f4             	cmp    %r14,%r12
+  804889:	72 e3                	jb     80486e <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80488b:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804891:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804895:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804899:	74 2a                	je     8048c5 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80489b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80489f:	89 de                	mov    %ebx,%esi
+  8048a1:	2b 30                	sub    (%rax),%esi
+  8048a3:	03 70 1c             	add    0x1c(%rax),%esi
+  8048a6:	8b 78 18             	mov    0x18(%rax),%edi
+  8048a9:	4c 89 e9             	mov    %r13,%rcx
+  8048ac:	48 89 da             	mov    %rbx,%rdx
+  8048af:	48 b8 7b 3a 80 00 00 	movabs $0x803a7b,%rax
+  8048b6:	00 00 00 
+  8048b9:	ff d0                	call   *%rax
+    return res > 0;
+  8048bb:	85 c0                	test   %eax,%eax
+  8048bd:	0f 9f c0             	setg   %al
+  8048c0:	e9 65 ff ff ff       	jmp    80482a <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048c5:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048c9:	eb d0                	jmp    80489b <mmap_pgfault+0x1b8>
+
+00000000008048cb <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048cb:	55                   	push   %rbp
+  8048cc:	48 89 e5             	mov    %rsp,%rbp
+  8048cf:	41 57                	push   %r15
+  8048d1:	41 56                	push   %r14
+  8048d3:	41 55                	push   %r13
+  8048d5:	41 54                	push   %r12
+  8048d7:	53                   	push   %rbx
+  8048d8:	48 83 ec 28          	sub    $0x28,%rsp
+  8048dc:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048e0:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048e3:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048ea:	ff ff ff 
+  8048ed:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f6:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8048fd:	00 00 00 
+  804900:	48 39 ca             	cmp    %rcx,%rdx
+  804903:	0f 85 e5 00 00 00    	jne    8049ee <mmap_writeback+0x123>
+  804909:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80490c:	4c 39 ee             	cmp    %r13,%rsi
+  80490f:	0f 83 e8 00 00 00    	jae    8049fd <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804915:	49 be 1d 43 80 00 00 	movabs $0x80431d,%r14
+  80491c:	00 00 00 
+  80491f:	49 bf 04 43 80 00 00 	movabs $0x804304,%r15
+  804926:	00 00 00 
+  804929:	eb 10                	jmp    80493b <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80492b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804932:	4d 39 ec             	cmp    %r13,%r12
+  804935:	0f 83 ae 00 00 00    	jae    8049e9 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80493b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80493f:	4c 89 e7             	mov    %r12,%rdi
+  804942:	41 ff d6             	call   *%r14
+  804945:	84 c0                	test   %al,%al
+  804947:	74 e2                	je     80492b <mmap_writeback+0x60>
+  804949:	4c 89 e7             	mov    %r12,%rdi
+  80494c:	41 ff d7             	call   *%r15
+  80494f:	84 c0                	test   %al,%al
+  804951:	74 d8                	je     80492b <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804953:	4c 89 e3             	mov    %r12,%rbx
+  804956:	4d 39 ec             	cmp    %r13,%r12
+  804959:	73 20                	jae    80497b <mmap_writeback+0xb0>
+  80495b:	48 89 df             	mov    %rbx,%rdi
+  80495e:	41 ff d6             	call   *%r14
+  804961:	84 c0                	test   %al,%al
+  804963:	74 16                	je     80497b <mmap_writeback+0xb0>
+  804965:	48 89 df             	mov    %rbx,%rdi
+  804968:	41 ff d7             	call   *%r15
+  80496b:	84 c0                	test   %al,%al
+  80496d:	74 0c                	je     80497b <mmap_writeback+0xb0>
+  80496f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804976:	4c 39 eb             	cmp    %r13,%rbx
+  804979:	72 e0                	jb     80495b <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80497b:	48 89 d9             	mov    %rbx,%rcx
+  80497e:	4c 29 e1             	sub    %r12,%rcx
+  804981:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804985:	44 89 e6             	mov    %r12d,%esi
+  804988:	2b 30                	sub    (%rax),%esi
+  80498a:	49 89 c4             	mov    %rax,%r12
+  80498d:	03 70 1c             	add    0x1c(%rax),%esi
+  804990:	8b 78 18             	mov    0x18(%rax),%edi
+  804993:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804997:	48 89 ca             	mov    %rcx,%rdx
+  80499a:	48 b8 04 3b 80 00 00 	movabs $0x803b04,%rax
+  8049a1:	00 00 00 
+  8049a4:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049a6:	85 c0                	test   %eax,%eax
+  8049a8:	78 44                	js     8049ee <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049aa:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049af:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049b2:	41 89 c1             	mov    %eax,%r9d
+  8049b5:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049bc:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049c0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049c9:	48 89 ce             	mov    %rcx,%rsi
+  8049cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049d1:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  8049d8:	00 00 00 
+  8049db:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049dd:	85 c0                	test   %eax,%eax
+  8049df:	78 0d                	js     8049ee <mmap_writeback+0x123>
+  8049e1:	49 89 dc             	mov    %rbx,%r12
+  8049e4:	e9 49 ff ff ff       	jmp    804932 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049ee:	48 83 c4 28          	add    $0x28,%rsp
+  8049f2:	5b                   	pop    %rbx
+  8049f3:	41 5c                	pop    %r12
+  8049f5:	41 5d                	pop    %r13
+  8049f7:	41 5e                	pop    %r14
+  8049f9:	41 5f                	pop    %r15
+  8049fb:	5d                   	pop    %rbp
+  8049fc:	c3                   	ret
+    return 0;
+  8049fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a02:	eb ea                	jmp    8049ee <mmap_writeback+0x123>
+
+0000000000804a04 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a04:	55                   	push   %rbp
+  804a05:	48 89 e5             	mov    %rsp,%rbp
+  804a08:	41 57                	push   %r15
+  804a0a:	41 56                	push   %r14
+  804a0c:	41 55                	push   %r13
+  804a0e:	41 54                	push   %r12
+  804a10:	53                   	push   %rbx
+  804a11:	48 83 ec 38          	sub    $0x38,%rsp
+  804a15:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a19:	48 85 f6             	test   %rsi,%rsi
+  804a1c:	0f 84 0c 02 00 00    	je     804c2e <mmap+0x22a>
+  804a22:	49 89 ff             	mov    %rdi,%r15
+  804a25:	49 89 f4             	mov    %rsi,%r12
+  804a28:	41 89 d5             	mov    %edx,%r13d
+  804a2b:	41 89 ce             	mov    %ecx,%r14d
+  804a2e:	44 89 cb             	mov    %r9d,%ebx
+  804a31:	45 85 c9             	test   %r9d,%r9d
+  804a34:	0f 88 f4 01 00 00    	js     804c2e <mmap+0x22a>
+  804a3a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a41:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a48:	0f 85 e7 01 00 00    	jne    804c35 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a4e:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a51:	83 fa 04             	cmp    $0x4,%edx
+  804a54:	0f 85 db 01 00 00    	jne    804c35 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a5a:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a5d:	83 fa 01             	cmp    $0x1,%edx
+  804a60:	0f 87 cf 01 00 00    	ja     804c35 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a66:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a6a:	44 89 c7             	mov    %r8d,%edi
+  804a6d:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  804a74:	00 00 00 
+  804a77:	ff d0                	call   *%rax
+  804a79:	89 c2                	mov    %eax,%edx
+  804a7b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a82:	85 d2                	test   %edx,%edx
+  804a84:	0f 88 ab 01 00 00    	js     804c35 <mmap+0x231>
+  804a8a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a8e:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a95:	00 00 00 
+  804a98:	8b 09                	mov    (%rcx),%ecx
+  804a9a:	39 0a                	cmp    %ecx,(%rdx)
+  804a9c:	0f 85 93 01 00 00    	jne    804c35 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804aa2:	8b 52 08             	mov    0x8(%rdx),%edx
+  804aa5:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804aa8:	83 fa 01             	cmp    $0x1,%edx
+  804aab:	0f 84 84 01 00 00    	je     804c35 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ab1:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ab5:	74 42                	je     804af9 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ab7:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804abe:	4c 89 e6             	mov    %r12,%rsi
+  804ac1:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ac8:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804acc:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ad0:	4d 85 ff             	test   %r15,%r15
+  804ad3:	74 67                	je     804b3c <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ad5:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804adc:	75 0f                	jne    804aed <mmap+0xe9>
+  804ade:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804ae5:	00 00 00 
+  804ae8:	49 39 c7             	cmp    %rax,%r15
+  804aeb:	77 1b                	ja     804b08 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804aed:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804af4:	e9 3c 01 00 00       	jmp    804c35 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804af9:	41 f6 c5 02          	test   $0x2,%r13b
+  804afd:	74 b8                	je     804ab7 <mmap+0xb3>
+  804aff:	85 d2                	test   %edx,%edx
+  804b01:	75 b4                	jne    804ab7 <mmap+0xb3>
+  804b03:	e9 2d 01 00 00       	jmp    804c35 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b08:	4c 89 ff             	mov    %r15,%rdi
+  804b0b:	48 b8 72 46 80 00 00 	movabs $0x804672,%rax
+  804b12:	00 00 00 
+  804b15:	ff d0                	call   *%rax
+  804b17:	48 89 c2             	mov    %rax,%rdx
+  804b1a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b21:	49 39 d7             	cmp    %rdx,%r15
+  804b24:	0f 85 0b 01 00 00    	jne    804c35 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b2a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b31:	00 00 00 
+  804b34:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b3a:	eb 44                	jmp    804b80 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b3c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b40:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b47:	00 00 00 
+  804b4a:	48 b8 72 46 80 00 00 	movabs $0x804672,%rax
+  804b51:	00 00 00 
+  804b54:	ff d0                	call   *%rax
+  804b56:	48 89 c7             	mov    %rax,%rdi
+  804b59:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b5d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b64:	48 85 ff             	test   %rdi,%rdi
+  804b67:	75 c1                	jne    804b2a <mmap+0x126>
+  804b69:	e9 c7 00 00 00       	jmp    804c35 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b6e:	49 83 c4 01          	add    $0x1,%r12
+  804b72:	48 83 c0 20          	add    $0x20,%rax
+  804b76:	49 83 fc 20          	cmp    $0x20,%r12
+  804b7a:	0f 84 a5 00 00 00    	je     804c25 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b80:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b84:	75 e8                	jne    804b6e <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b86:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b8a:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  804b91:	00 00 00 
+  804b94:	ff d0                	call   *%rax
+  804b96:	89 c2                	mov    %eax,%edx
+  804b98:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b9f:	85 d2                	test   %edx,%edx
+  804ba1:	0f 88 8e 00 00 00    	js     804c35 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804ba7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bab:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  804bb2:	00 00 00 
+  804bb5:	ff d0                	call   *%rax
+  804bb7:	89 c6                	mov    %eax,%esi
+  804bb9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bbc:	48 b8 de 2f 80 00 00 	movabs $0x802fde,%rax
+  804bc3:	00 00 00 
+  804bc6:	ff d0                	call   *%rax
+  804bc8:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bcb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bd2:	45 85 ff             	test   %r15d,%r15d
+  804bd5:	78 5e                	js     804c35 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bd7:	49 c1 e4 05          	shl    $0x5,%r12
+  804bdb:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804be2:	00 00 00 
+  804be5:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804be8:	48 bf e3 46 80 00 00 	movabs $0x8046e3,%rdi
+  804bef:	00 00 00 
+  804bf2:	48 b8 b1 51 80 00 00 	movabs $0x8051b1,%rax
+  804bf9:	00 00 00 
+  804bfc:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804bfe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c02:	49 89 04 24          	mov    %rax,(%r12)
+  804c06:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c0a:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c0f:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c14:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c19:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c1e:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c23:	eb 10                	jmp    804c35 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c25:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c2c:	eb 07                	jmp    804c35 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c2e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c35:	48 83 c4 38          	add    $0x38,%rsp
+  804c39:	5b                   	pop    %rbx
+  804c3a:	41 5c                	pop    %r12
+  804c3c:	41 5d                	pop    %r13
+  804c3e:	41 5e                	pop    %r14
+  804c40:	41 5f                	pop    %r15
+  804c42:	5d                   	pop    %rbp
+  804c43:	c3                   	ret
+
+0000000000804c44 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c44:	55                   	push   %rbp
+  804c45:	48 89 e5             	mov    %rsp,%rbp
+  804c48:	41 57                	push   %r15
+  804c4a:	41 56                	push   %r14
+  804c4c:	41 55                	push   %r13
+  804c4e:	41 54                	push   %r12
+  804c50:	53                   	push   %rbx
+  804c51:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c55:	49 89 fe             	mov    %rdi,%r14
+  804c58:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c5f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c66:	00 
+  804c67:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c6e:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c75:	00 00 00 
+  804c78:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c7f:	49 bf cb 48 80 00 00 	movabs $0x8048cb,%r15
+  804c86:	00 00 00 
+  804c89:	eb 09                	jmp    804c94 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c8b:	48 83 c3 20          	add    $0x20,%rbx
+  804c8f:	4c 39 eb             	cmp    %r13,%rbx
+  804c92:	74 33                	je     804cc7 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c94:	48 89 df             	mov    %rbx,%rdi
+  804c97:	48 8b 33             	mov    (%rbx),%rsi
+  804c9a:	4c 39 e6             	cmp    %r12,%rsi
+  804c9d:	73 ec                	jae    804c8b <msync+0x47>
+  804c9f:	48 85 f6             	test   %rsi,%rsi
+  804ca2:	74 e7                	je     804c8b <msync+0x47>
+  804ca4:	48 89 f2             	mov    %rsi,%rdx
+  804ca7:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cab:	49 39 d6             	cmp    %rdx,%r14
+  804cae:	73 db                	jae    804c8b <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cb0:	4c 39 e2             	cmp    %r12,%rdx
+  804cb3:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cb7:	4c 39 f6             	cmp    %r14,%rsi
+  804cba:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cbe:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cc1:	85 c0                	test   %eax,%eax
+  804cc3:	79 c6                	jns    804c8b <msync+0x47>
+  804cc5:	eb 05                	jmp    804ccc <msync+0x88>
+    }
+
+    return 0;
+  804cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ccc:	48 83 c4 08          	add    $0x8,%rsp
+  804cd0:	5b                   	pop    %rbx
+  804cd1:	41 5c                	pop    %r12
+  804cd3:	41 5d                	pop    %r13
+  804cd5:	41 5e                	pop    %r14
+  804cd7:	41 5f                	pop    %r15
+  804cd9:	5d                   	pop    %rbp
+  804cda:	c3                   	ret
+
+0000000000804cdb <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cdb:	55                   	push   %rbp
+  804cdc:	48 89 e5             	mov    %rsp,%rbp
+  804cdf:	41 57                	push   %r15
+  804ce1:	41 56                	push   %r14
+  804ce3:	41 55                	push   %r13
+  804ce5:	41 54                	push   %r12
+  804ce7:	53                   	push   %rbx
+  804ce8:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cec:	49 89 ff             	mov    %rdi,%r15
+  804cef:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cf6:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804cfd:	00 
+  804cfe:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d05:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d0c:	00 00 00 
+  804d0f:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d16:	48 89 d8             	mov    %rbx,%rax
+  804d19:	eb 09                	jmp    804d24 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d1b:	48 83 c0 20          	add    $0x20,%rax
+  804d1f:	4c 39 f0             	cmp    %r14,%rax
+  804d22:	74 40                	je     804d64 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d24:	48 8b 10             	mov    (%rax),%rdx
+  804d27:	4c 39 e2             	cmp    %r12,%rdx
+  804d2a:	73 ef                	jae    804d1b <munmap+0x40>
+  804d2c:	48 85 d2             	test   %rdx,%rdx
+  804d2f:	74 ea                	je     804d1b <munmap+0x40>
+  804d31:	48 89 d7             	mov    %rdx,%rdi
+  804d34:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d38:	49 39 ff             	cmp    %rdi,%r15
+  804d3b:	73 de                	jae    804d1b <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d3d:	49 39 fc             	cmp    %rdi,%r12
+  804d40:	72 05                	jb     804d47 <munmap+0x6c>
+  804d42:	4c 39 fa             	cmp    %r15,%rdx
+  804d45:	73 d4                	jae    804d1b <munmap+0x40>
+  804d47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d4c:	48 83 c4 08          	add    $0x8,%rsp
+  804d50:	5b                   	pop    %rbx
+  804d51:	41 5c                	pop    %r12
+  804d53:	41 5d                	pop    %r13
+  804d55:	41 5e                	pop    %r14
+  804d57:	41 5f                	pop    %r15
+  804d59:	5d                   	pop    %rbp
+  804d5a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d5b:	48 83 c3 20          	add    $0x20,%rbx
+  804d5f:	4c 39 f3             	cmp    %r14,%rbx
+  804d62:	74 5c                	je     804dc0 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d64:	48 8b 33             	mov    (%rbx),%rsi
+  804d67:	4c 39 e6             	cmp    %r12,%rsi
+  804d6a:	73 ef                	jae    804d5b <munmap+0x80>
+  804d6c:	48 85 f6             	test   %rsi,%rsi
+  804d6f:	74 ea                	je     804d5b <munmap+0x80>
+  804d71:	48 89 f2             	mov    %rsi,%rdx
+  804d74:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d78:	49 39 d7             	cmp    %rdx,%r15
+  804d7b:	73 de                	jae    804d5b <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d7d:	48 89 df             	mov    %rbx,%rdi
+  804d80:	48 b8 cb 48 80 00 00 	movabs $0x8048cb,%rax
+  804d87:	00 00 00 
+  804d8a:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d8c:	85 c0                	test   %eax,%eax
+  804d8e:	78 bc                	js     804d4c <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d90:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d94:	48 8b 33             	mov    (%rbx),%rsi
+  804d97:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d9c:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  804da3:	00 00 00 
+  804da6:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804da8:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804dab:	48 b8 83 2f 80 00 00 	movabs $0x802f83,%rax
+  804db2:	00 00 00 
+  804db5:	ff d0                	call   *%rax
+        reg->start = 0;
+  804db7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dbe:	eb 9b                	jmp    804d5b <munmap+0x80>
+    return 0;
+  804dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dc5:	eb 85                	jmp    804d4c <munmap+0x71>
+
+0000000000804dc7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcc:	c3                   	ret
+
+0000000000804dcd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dcd:	55                   	push   %rbp
+  804dce:	48 89 e5             	mov    %rsp,%rbp
+  804dd1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dd4:	48 be e5 62 80 00 00 	movabs $0x8062e5,%rsi
+  804ddb:	00 00 00 
+  804dde:	48 b8 cd 1f 80 00 00 	movabs $0x801fcd,%rax
+  804de5:	00 00 00 
+  804de8:	ff d0                	call   *%rax
+    return 0;
+}
+  804dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  804def:	5d                   	pop    %rbp
+  804df0:	c3                   	ret
+
+0000000000804df1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804df1:	55                   	push   %rbp
+  804df2:	48 89 e5             	mov    %rsp,%rbp
+  804df5:	41 57                	push   %r15
+  804df7:	41 56                	push   %r14
+  804df9:	41 55                	push   %r13
+  804dfb:	41 54                	push   %r12
+  804dfd:	53                   	push   %rbx
+  804dfe:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e05:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e0c:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e13:	00 00 00 00 
+  804e17:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e1e:	00 00 00 00 
+  804e22:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e29:	00 00 00 00 
+  804e2d:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e34:	00 00 00 00 
+  804e38:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e3f:	00 00 00 00 
+  804e43:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e4a:	00 00 00 00 
+  804e4e:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e55:	00 
+  804e56:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e5d:	00 
+  804e5e:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e65:	00 
+  804e66:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e6d:	00 
+  804e6e:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e75:	00 
+  804e76:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e7d:	00 
+  804e7e:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e85:	00 
+  804e86:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e8d:	00 
+  804e8e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e95:	00 
+  804e96:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804e9d:	00 
+    for (res = 0; res < n; res += inc) {
+  804e9e:	48 85 d2             	test   %rdx,%rdx
+  804ea1:	74 7a                	je     804f1d <devcons_write+0x12c>
+  804ea3:	49 89 d6             	mov    %rdx,%r14
+  804ea6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804eac:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804eb1:	49 bf 1d 23 80 00 00 	movabs $0x80231d,%r15
+  804eb8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ebb:	4c 89 f3             	mov    %r14,%rbx
+  804ebe:	48 29 f3             	sub    %rsi,%rbx
+  804ec1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ec6:	48 39 c3             	cmp    %rax,%rbx
+  804ec9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ecd:	4c 63 eb             	movslq %ebx,%r13
+  804ed0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ed7:	48 01 c6             	add    %rax,%rsi
+  804eda:	4c 89 ea             	mov    %r13,%rdx
+  804edd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ee4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ee7:	4c 89 ee             	mov    %r13,%rsi
+  804eea:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ef1:	48 b8 4a 25 80 00 00 	movabs $0x80254a,%rax
+  804ef8:	00 00 00 
+  804efb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804efd:	41 01 dc             	add    %ebx,%r12d
+  804f00:	49 63 f4             	movslq %r12d,%rsi
+  804f03:	4c 39 f6             	cmp    %r14,%rsi
+  804f06:	72 b3                	jb     804ebb <devcons_write+0xca>
+    return res;
+  804f08:	49 63 c4             	movslq %r12d,%rax
+}
+  804f0b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f12:	5b                   	pop    %rbx
+  804f13:	41 5c                	pop    %r12
+  804f15:	41 5d                	pop    %r13
+  804f17:	41 5e                	pop    %r14
+  804f19:	41 5f                	pop    %r15
+  804f1b:	5d                   	pop    %rbp
+  804f1c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f1d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f23:	eb e3                	jmp    804f08 <devcons_write+0x117>
+
+0000000000804f25 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f25:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f28:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f2d:	48 85 c0             	test   %rax,%rax
+  804f30:	74 55                	je     804f87 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f32:	55                   	push   %rbp
+  804f33:	48 89 e5             	mov    %rsp,%rbp
+  804f36:	41 55                	push   %r13
+  804f38:	41 54                	push   %r12
+  804f3a:	53                   	push   %rbx
+  804f3b:	48 83 ec 08          	sub    $0x8,%rsp
+  804f3f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f42:	48 bb 7d 25 80 00 00 	movabs $0x80257d,%rbx
+  804f49:	00 00 00 
+  804f4c:	49 bc 91 26 80 00 00 	movabs $0x802691,%r12
+  804f53:	00 00 00 
+  804f56:	eb 03                	jmp    804f5b <devcons_read+0x36>
+  804f58:	41 ff d4             	call   *%r12
+  804f5b:	ff d3                	call   *%rbx
+  804f5d:	85 c0                	test   %eax,%eax
+  804f5f:	74 f7                	je     804f58 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f61:	48 63 d0             	movslq %eax,%rdx
+  804f64:	78 13                	js     804f79 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f6b:	83 f8 04             	cmp    $0x4,%eax
+  804f6e:	74 09                	je     804f79 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f70:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f74:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f79:	48 89 d0             	mov    %rdx,%rax
+  804f7c:	48 83 c4 08          	add    $0x8,%rsp
+  804f80:	5b                   	pop    %rbx
+  804f81:	41 5c                	pop    %r12
+  804f83:	41 5d                	pop    %r13
+  804f85:	5d                   	pop    %rbp
+  804f86:	c3                   	ret
+  804f87:	48 89 d0             	mov    %rdx,%rax
+  804f8a:	c3                   	ret
+
+0000000000804f8b <cputchar>:
+cputchar(int ch) {
+  804f8b:	55                   	push   %rbp
+  804f8c:	48 89 e5             	mov    %rsp,%rbp
+  804f8f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f93:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f97:	be 01 00 00 00       	mov    $0x1,%esi
+  804f9c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fa0:	48 b8 4a 25 80 00 00 	movabs $0x80254a,%rax
+  804fa7:	00 00 00 
+  804faa:	ff d0                	call   *%rax
+}
+  804fac:	c9                   	leave
+  804fad:	c3                   	ret
+
+0000000000804fae <getchar>:
+getchar(void) {
+  804fae:	55                   	push   %rbp
+  804faf:	48 89 e5             	mov    %rsp,%rbp
+  804fb2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fb6:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fbb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fc4:	48 b8 01 31 80 00 00 	movabs $0x803101,%rax
+  804fcb:	00 00 00 
+  804fce:	ff d0                	call   *%rax
+  804fd0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fd2:	85 c0                	test   %eax,%eax
+  804fd4:	78 06                	js     804fdc <getchar+0x2e>
+  804fd6:	74 08                	je     804fe0 <getchar+0x32>
+  804fd8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fdc:	89 d0                	mov    %edx,%eax
+  804fde:	c9                   	leave
+  804fdf:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fe0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fe5:	eb f5                	jmp    804fdc <getchar+0x2e>
+
+0000000000804fe7 <iscons>:
+iscons(int fdnum) {
+  804fe7:	55                   	push   %rbp
+  804fe8:	48 89 e5             	mov    %rsp,%rbp
+  804feb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804fef:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804ff3:	48 b8 1e 2e 80 00 00 	movabs $0x802e1e,%rax
+  804ffa:	00 00 00 
+  804ffd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fff:	85 c0                	test   %eax,%eax
+  805001:	78 18                	js     80501b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805003:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805007:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80500e:	00 00 00 
+  805011:	8b 00                	mov    (%rax),%eax
+  805013:	39 02                	cmp    %eax,(%rdx)
+  805015:	0f 94 c0             	sete   %al
+  805018:	0f b6 c0             	movzbl %al,%eax
+}
+  80501b:	c9                   	leave
+  80501c:	c3                   	ret
+
+000000000080501d <opencons>:
+opencons(void) {
+  80501d:	55                   	push   %rbp
+  80501e:	48 89 e5             	mov    %rsp,%rbp
+  805021:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805025:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805029:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  805030:	00 00 00 
+  805033:	ff d0                	call   *%rax
+  805035:	85 c0                	test   %eax,%eax
+  805037:	78 49                	js     805082 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805039:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80503e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805043:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80504c:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  805053:	00 00 00 
+  805056:	ff d0                	call   *%rax
+  805058:	85 c0                	test   %eax,%eax
+  80505a:	78 26                	js     805082 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80505c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805060:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805067:	00 00 
+  805069:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80506b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80506f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805076:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  80507d:	00 00 00 
+  805080:	ff d0                	call   *%rax
+}
+  805082:	c9                   	leave
+  805083:	c3                   	ret
+
+0000000000805084 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805084:	55                   	push   %rbp
+  805085:	48 89 e5             	mov    %rsp,%rbp
+  805088:	41 56                	push   %r14
+  80508a:	41 55                	push   %r13
+  80508c:	41 54                	push   %r12
+  80508e:	53                   	push   %rbx
+  80508f:	48 83 ec 50          	sub    $0x50,%rsp
+  805093:	49 89 fc             	mov    %rdi,%r12
+  805096:	41 89 f5             	mov    %esi,%r13d
+  805099:	48 89 d3             	mov    %rdx,%rbx
+  80509c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050a0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050a4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050a8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050b3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050b7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050bb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050bf:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050c6:	00 00 00 
+  8050c9:	4c 8b 30             	mov    (%rax),%r14
+  8050cc:	48 b8 5a 26 80 00 00 	movabs $0x80265a,%rax
+  8050d3:	00 00 00 
+  8050d6:	ff d0                	call   *%rax
+  8050d8:	89 c6                	mov    %eax,%esi
+  8050da:	45 89 e8             	mov    %r13d,%r8d
+  8050dd:	4c 89 e1             	mov    %r12,%rcx
+  8050e0:	4c 89 f2             	mov    %r14,%rdx
+  8050e3:	48 bf f8 62 80 00 00 	movabs $0x8062f8,%rdi
+  8050ea:	00 00 00 
+  8050ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050f2:	49 bc 96 16 80 00 00 	movabs $0x801696,%r12
+  8050f9:	00 00 00 
+  8050fc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8050ff:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805103:	48 89 df             	mov    %rbx,%rdi
+  805106:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  80510d:	00 00 00 
+  805110:	ff d0                	call   *%rax
+    cprintf("\n");
+  805112:	48 bf d3 61 80 00 00 	movabs $0x8061d3,%rdi
+  805119:	00 00 00 
+  80511c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805121:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805124:	cc                   	int3
+  805125:	eb fd                	jmp    805124 <_panic+0xa0>
+
+0000000000805127 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805127:	55                   	push   %rbp
+  805128:	48 89 e5             	mov    %rsp,%rbp
+  80512b:	41 56                	push   %r14
+  80512d:	41 55                	push   %r13
+  80512f:	41 54                	push   %r12
+  805131:	53                   	push   %rbx
+  805132:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805135:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80513c:	00 00 00 
+  80513f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805143:	74 27                	je     80516c <_handle_vectored_pagefault+0x45>
+  805145:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80514a:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805151:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805154:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805157:	4c 89 e7             	mov    %r12,%rdi
+  80515a:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80515f:	84 c0                	test   %al,%al
+  805161:	75 45                	jne    8051a8 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805163:	48 83 c3 01          	add    $0x1,%rbx
+  805167:	49 3b 1e             	cmp    (%r14),%rbx
+  80516a:	72 eb                	jb     805157 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80516c:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805173:	00 
+  805174:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805179:	4d 8b 04 24          	mov    (%r12),%r8
+  80517d:	48 ba 20 63 80 00 00 	movabs $0x806320,%rdx
+  805184:	00 00 00 
+  805187:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80518c:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  805193:	00 00 00 
+  805196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80519b:	49 ba 84 50 80 00 00 	movabs $0x805084,%r10
+  8051a2:	00 00 00 
+  8051a5:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051a8:	5b                   	pop    %rbx
+  8051a9:	41 5c                	pop    %r12
+  8051ab:	41 5d                	pop    %r13
+  8051ad:	41 5e                	pop    %r14
+  8051af:	5d                   	pop    %rbp
+  8051b0:	c3                   	ret
+
+00000000008051b1 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051b1:	55                   	push   %rbp
+  8051b2:	48 89 e5             	mov    %rsp,%rbp
+  8051b5:	53                   	push   %rbx
+  8051b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8051ba:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051bd:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051c2:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051c9:	00 00 00 
+  8051cc:	80 38 00             	cmpb   $0x0,(%rax)
+  8051cf:	74 68                	je     805239 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051d1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051d8:	00 00 00 
+  8051db:	48 8b 08             	mov    (%rax),%rcx
+  8051de:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051e3:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051ea:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051ed:	48 85 c9             	test   %rcx,%rcx
+  8051f0:	0f 84 e0 00 00 00    	je     8052d6 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051f6:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8051fa:	0f 84 c9 00 00 00    	je     8052c9 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805200:	48 83 c2 01          	add    $0x1,%rdx
+  805204:	48 39 ca             	cmp    %rcx,%rdx
+  805207:	75 ed                	jne    8051f6 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805209:	48 83 f9 08          	cmp    $0x8,%rcx
+  80520d:	0f 84 84 00 00 00    	je     805297 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805213:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805217:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80521e:	00 00 00 
+  805221:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805228:	00 00 00 
+  80522b:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80522f:	85 f6                	test   %esi,%esi
+  805231:	0f 89 97 00 00 00    	jns    8052ce <add_pgfault_handler+0x11d>
+  805237:	eb 63                	jmp    80529c <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805239:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80523e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805243:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80524a:	00 00 00 
+  80524d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805252:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  805259:	00 00 00 
+  80525c:	ff d0                	call   *%rax
+  80525e:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805260:	85 c0                	test   %eax,%eax
+  805262:	78 38                	js     80529c <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805264:	48 be b2 53 80 00 00 	movabs $0x8053b2,%rsi
+  80526b:	00 00 00 
+  80526e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805273:	48 b8 55 29 80 00 00 	movabs $0x802955,%rax
+  80527a:	00 00 00 
+  80527d:	ff d0                	call   *%rax
+  80527f:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805281:	85 c0                	test   %eax,%eax
+  805283:	78 17                	js     80529c <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805285:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80528c:	00 00 00 
+  80528f:	c6 00 01             	movb   $0x1,(%rax)
+  805292:	e9 3a ff ff ff       	jmp    8051d1 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805297:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80529c:	89 f1                	mov    %esi,%ecx
+  80529e:	48 ba 5e 63 80 00 00 	movabs $0x80635e,%rdx
+  8052a5:	00 00 00 
+  8052a8:	be 42 00 00 00       	mov    $0x42,%esi
+  8052ad:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8052b4:	00 00 00 
+  8052b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052bc:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  8052c3:	00 00 00 
+  8052c6:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052c9:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052ce:	89 f0                	mov    %esi,%eax
+  8052d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052d4:	c9                   	leave
+  8052d5:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052d6:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052dd:	00 00 00 
+  8052e0:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052e7:	48 89 d8             	mov    %rbx,%rax
+  8052ea:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052f1:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052f4:	eb d8                	jmp    8052ce <add_pgfault_handler+0x11d>
+
+00000000008052f6 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052f6:	55                   	push   %rbp
+  8052f7:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8052fa:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805301:	00 00 00 
+  805304:	80 38 00             	cmpb   $0x0,(%rax)
+  805307:	74 33                	je     80533c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805309:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805310:	00 00 00 
+  805313:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805318:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80531f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805322:	48 85 c0             	test   %rax,%rax
+  805325:	0f 84 85 00 00 00    	je     8053b0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80532b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80532f:	74 40                	je     805371 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805331:	48 83 c1 01          	add    $0x1,%rcx
+  805335:	48 39 c1             	cmp    %rax,%rcx
+  805338:	75 f1                	jne    80532b <remove_pgfault_handler+0x35>
+  80533a:	eb 74                	jmp    8053b0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80533c:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  805343:	00 00 00 
+  805346:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80534d:	00 00 00 
+  805350:	be 48 00 00 00       	mov    $0x48,%esi
+  805355:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  80535c:	00 00 00 
+  80535f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805364:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  80536b:	00 00 00 
+  80536e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805371:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805378:	00 
+  805379:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80537d:	48 29 ca             	sub    %rcx,%rdx
+  805380:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805387:	00 00 00 
+  80538a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80538e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805393:	48 89 ce             	mov    %rcx,%rsi
+  805396:	48 b8 1d 23 80 00 00 	movabs $0x80231d,%rax
+  80539d:	00 00 00 
+  8053a0:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053a2:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053a9:	00 00 00 
+  8053ac:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053b0:	5d                   	pop    %rbp
+  8053b1:	c3                   	ret
+
+00000000008053b2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053b2:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053b5:	48 b8 27 51 80 00 00 	movabs $0x805127,%rax
+  8053bc:	00 00 00 
+    call *%rax
+  8053bf:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053c1:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053c8:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053c9:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053d0:	00 
+    subq $8, %rcx
+  8053d1:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053d5:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053d8:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053df:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053e0:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053e4:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053e8:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053ed:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053f2:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053f7:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8053fc:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805401:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805406:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80540b:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805410:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805415:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80541a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80541f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805424:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805429:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80542e:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805432:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805436:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805437:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805438:	c3                   	ret
+
+0000000000805439 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805439:	85 ff                	test   %edi,%edi
+  80543b:	78 58                	js     805495 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80543d:	48 85 f6             	test   %rsi,%rsi
+  805440:	74 12                	je     805454 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805442:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805449:	00 00 00 
+  80544c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805452:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805454:	48 85 c9             	test   %rcx,%rcx
+  805457:	74 12                	je     80546b <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805459:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805460:	00 00 00 
+  805463:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805469:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80546b:	48 85 d2             	test   %rdx,%rdx
+  80546e:	74 14                	je     805484 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805470:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805477:	00 00 00 
+  80547a:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805481:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805484:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80548b:	00 00 00 
+  80548e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805494:	c3                   	ret
+        if (from_env_store) {
+  805495:	48 85 f6             	test   %rsi,%rsi
+  805498:	74 06                	je     8054a0 <ipc_result+0x67>
+            *from_env_store = 0;
+  80549a:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054a0:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054a2:	48 85 c9             	test   %rcx,%rcx
+  8054a5:	74 ed                	je     805494 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054a7:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054ad:	c3                   	ret
+
+00000000008054ae <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054ae:	55                   	push   %rbp
+  8054af:	48 89 e5             	mov    %rsp,%rbp
+  8054b2:	41 55                	push   %r13
+  8054b4:	41 54                	push   %r12
+  8054b6:	53                   	push   %rbx
+  8054b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8054bb:	49 89 fc             	mov    %rdi,%r12
+  8054be:	48 89 f7             	mov    %rsi,%rdi
+  8054c1:	48 89 d3             	mov    %rdx,%rbx
+  8054c4:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054c7:	48 85 f6             	test   %rsi,%rsi
+  8054ca:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054d1:	00 00 00 
+  8054d4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8054dd:	48 85 d2             	test   %rdx,%rdx
+  8054e0:	74 03                	je     8054e5 <ipc_recv+0x37>
+  8054e2:	48 8b 32             	mov    (%rdx),%rsi
+  8054e5:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  8054ec:	00 00 00 
+  8054ef:	ff d0                	call   *%rax
+  8054f1:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054f3:	4c 89 e9             	mov    %r13,%rcx
+  8054f6:	48 89 da             	mov    %rbx,%rdx
+  8054f9:	4c 89 e6             	mov    %r12,%rsi
+  8054fc:	48 b8 39 54 80 00 00 	movabs $0x805439,%rax
+  805503:	00 00 00 
+  805506:	ff d0                	call   *%rax
+}
+  805508:	48 83 c4 08          	add    $0x8,%rsp
+  80550c:	5b                   	pop    %rbx
+  80550d:	41 5c                	pop    %r12
+  80550f:	41 5d                	pop    %r13
+  805511:	5d                   	pop    %rbp
+  805512:	c3                   	ret
+
+0000000000805513 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805513:	55                   	push   %rbp
+  805514:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805517:	48 85 d2             	test   %rdx,%rdx
+  80551a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805521:	00 00 00 
+  805524:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805528:	89 f6                	mov    %esi,%esi
+  80552a:	48 b8 0a 2b 80 00 00 	movabs $0x802b0a,%rax
+  805531:	00 00 00 
+  805534:	ff d0                	call   *%rax
+    if (res < 0) {
+  805536:	85 c0                	test   %eax,%eax
+  805538:	78 02                	js     80553c <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80553a:	5d                   	pop    %rbp
+  80553b:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80553c:	89 c1                	mov    %eax,%ecx
+  80553e:	48 ba 90 63 80 00 00 	movabs $0x806390,%rdx
+  805545:	00 00 00 
+  805548:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80554d:	48 bf 9d 63 80 00 00 	movabs $0x80639d,%rdi
+  805554:	00 00 00 
+  805557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80555c:	49 b8 84 50 80 00 00 	movabs $0x805084,%r8
+  805563:	00 00 00 
+  805566:	41 ff d0             	call   *%r8
+
+0000000000805569 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805569:	55                   	push   %rbp
+  80556a:	48 89 e5             	mov    %rsp,%rbp
+  80556d:	53                   	push   %rbx
+  80556e:	48 83 ec 08          	sub    $0x8,%rsp
+  805572:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805576:	48 85 d2             	test   %rdx,%rdx
+  805579:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805580:	00 00 00 
+  805583:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805587:	4d 85 c9             	test   %r9,%r9
+  80558a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80558e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805593:	48 85 db             	test   %rbx,%rbx
+  805596:	74 03                	je     80559b <ipc_call+0x32>
+  805598:	48 8b 03             	mov    (%rbx),%rax
+  80559b:	89 f6                	mov    %esi,%esi
+  80559d:	48 83 ec 08          	sub    $0x8,%rsp
+  8055a1:	50                   	push   %rax
+  8055a2:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  8055a9:	00 00 00 
+  8055ac:	ff d0                	call   *%rax
+  8055ae:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055b0:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055b4:	48 89 da             	mov    %rbx,%rdx
+  8055b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8055bc:	48 b8 39 54 80 00 00 	movabs $0x805439,%rax
+  8055c3:	00 00 00 
+  8055c6:	ff d0                	call   *%rax
+}
+  8055c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055cc:	c9                   	leave
+  8055cd:	c3                   	ret
+
+00000000008055ce <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055ce:	55                   	push   %rbp
+  8055cf:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055d2:	89 f6                	mov    %esi,%esi
+  8055d4:	48 b8 a8 2b 80 00 00 	movabs $0x802ba8,%rax
+  8055db:	00 00 00 
+  8055de:	ff d0                	call   *%rax
+  8055e0:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8055f1:	48 b8 39 54 80 00 00 	movabs $0x805439,%rax
+  8055f8:	00 00 00 
+  8055fb:	ff d0                	call   *%rax
+}
+  8055fd:	5d                   	pop    %rbp
+  8055fe:	c3                   	ret
+
+00000000008055ff <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8055ff:	55                   	push   %rbp
+  805600:	48 89 e5             	mov    %rsp,%rbp
+  805603:	41 54                	push   %r12
+  805605:	53                   	push   %rbx
+  805606:	4c 89 cb             	mov    %r9,%rbx
+  805609:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80560d:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805611:	48 85 d2             	test   %rdx,%rdx
+  805614:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80561b:	00 00 00 
+  80561e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805622:	4d 85 c9             	test   %r9,%r9
+  805625:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80562e:	4d 85 e4             	test   %r12,%r12
+  805631:	74 04                	je     805637 <ipc_reply_wait+0x38>
+  805633:	49 8b 04 24          	mov    (%r12),%rax
+  805637:	89 f6                	mov    %esi,%esi
+  805639:	48 83 ec 08          	sub    $0x8,%rsp
+  80563d:	50                   	push   %rax
+  80563e:	48 b8 12 2c 80 00 00 	movabs $0x802c12,%rax
+  805645:	00 00 00 
+  805648:	ff d0                	call   *%rax
+  80564a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80564c:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805650:	4c 89 e2             	mov    %r12,%rdx
+  805653:	48 89 de             	mov    %rbx,%rsi
+  805656:	48 b8 39 54 80 00 00 	movabs $0x805439,%rax
+  80565d:	00 00 00 
+  805660:	ff d0                	call   *%rax
+}
+  805662:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805666:	5b                   	pop    %rbx
+  805667:	41 5c                	pop    %r12
+  805669:	5d                   	pop    %rbp
+  80566a:	c3                   	ret
+
+000000000080566b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80566b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805670:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805677:	00 00 00 
+  80567a:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805681:	48 01 ca             	add    %rcx,%rdx
+  805684:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80568a:	39 fa                	cmp    %edi,%edx
+  80568c:	74 12                	je     8056a0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80568e:	48 83 c0 01          	add    $0x1,%rax
+  805692:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805698:	75 e0                	jne    80567a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80569a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80569f:	c3                   	ret
+            return envs[i].env_id;
+  8056a0:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056a7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056ae:	00 00 00 
+  8056b1:	48 01 d0             	add    %rdx,%rax
+  8056b4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056ba:	c3                   	ret
+  8056bb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008056c0 <__rodata_start>:
+  8056c0:	77 00                	ja     8056c2 <__rodata_start+0x2>
+  8056c2:	72 62                	jb     805726 <__rodata_start+0x66>
+  8056c4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056c7:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056ca:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056d1:	00 
+  8056d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056d9:	00 00 00 
+  8056dc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c30:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c40:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c50:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c60:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c70:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c80:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c90:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805ca0:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805cb0:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805cc0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cd0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805ce0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cf0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805d00:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805d10:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d20:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d30:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d40:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d50:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d60:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d70:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d80:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d90:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805da0:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805db0:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805dc0:	8e 18 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805dd0:	d5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805de0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805df0:	e5 1e 80 00 00 00 00 00 ad 18 80 00 00 00 00 00     ................
+  805e00:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805e10:	a1 18 80 00 00 00 00 00 1b 19 80 00 00 00 00 00     ................
+  805e20:	e5 1e 80 00 00 00 00 00 a1 18 80 00 00 00 00 00     ................
+  805e30:	e7 18 80 00 00 00 00 00 e7 18 80 00 00 00 00 00     ................
+  805e40:	e7 18 80 00 00 00 00 00 e7 18 80 00 00 00 00 00     ................
+  805e50:	e7 18 80 00 00 00 00 00 e7 18 80 00 00 00 00 00     ................
+  805e60:	e7 18 80 00 00 00 00 00 e7 18 80 00 00 00 00 00     ................
+  805e70:	e7 18 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805e80:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805e90:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805ea0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805eb0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805ec0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805ed0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805ee0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805ef0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f00:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f10:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f20:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f30:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f40:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f50:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f60:	e5 1e 80 00 00 00 00 00 03 1e 80 00 00 00 00 00     ................
+  805f70:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f80:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805f90:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805fa0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805fb0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805fc0:	49 19 80 00 00 00 00 00 18 1b 80 00 00 00 00 00     I...............
+  805fd0:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  805fe0:	e5 1e 80 00 00 00 00 00 3e 19 80 00 00 00 00 00     ........>.......
+  805ff0:	78 19 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     x...............
+  806000:	e5 1e 80 00 00 00 00 00 33 19 80 00 00 00 00 00     ........3.......
+  806010:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  806020:	c1 1c 80 00 00 00 00 00 90 1d 80 00 00 00 00 00     ................
+  806030:	e5 1e 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  806040:	0f 1a 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  806050:	ec 1b 80 00 00 00 00 00 e5 1e 80 00 00 00 00 00     ................
+  806060:	e5 1e 80 00 00 00 00 00 03 1e 80 00 00 00 00 00     ................
+  806070:	e5 1e 80 00 00 00 00 00 97 18 80 00 00 00 00 00     ................
+
+0000000000806080 <error_string>:
+	...
+  806088:	5e 5c 80 00 00 00 00 00 70 5c 80 00 00 00 00 00     ^\......p\......
+  806098:	80 5c 80 00 00 00 00 00 92 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	a0 5c 80 00 00 00 00 00 b4 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	c9 5c 80 00 00 00 00 00 dc 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	ee 5c 80 00 00 00 00 00 02 5d 80 00 00 00 00 00     .\.......]......
+  8060d8:	12 5d 80 00 00 00 00 00 25 5d 80 00 00 00 00 00     .]......%]......
+  8060e8:	3c 5d 80 00 00 00 00 00 52 5d 80 00 00 00 00 00     <]......R]......
+  8060f8:	6a 5d 80 00 00 00 00 00 82 5d 80 00 00 00 00 00     j].......]......
+  806108:	8f 5d 80 00 00 00 00 00 20 61 80 00 00 00 00 00     .]...... a......
+  806118:	a3 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806128:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806138:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806148:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806158:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806168:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806178:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806188:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806198:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806200 <devtab>:
+  806200:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806210:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806220:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806230:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806240:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806250:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806260:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806270:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806280:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806290:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062f0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806300:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806310:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806320:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806330:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806340:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806350:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806360:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806370:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806380:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806390:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063a0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,10319 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 77 22 80 00 00 	movabs $0x802277,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 f8 20 80 00 00 	movabs $0x8020f8,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 38 32 80 00 00 	movabs $0x803238,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 38 32 80 00 00 	movabs $0x803238,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 3a 16 80 00 00 	movabs $0x80163a,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 0e 3c 80 00 00 	movabs $0x803c0e,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 07 1f 80 00 00 	movabs $0x801f07,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 0e 3c 80 00 00 	movabs $0x803c0e,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 07 1f 80 00 00 	movabs $0x801f07,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 ce 15 80 00 00 	movabs $0x8015ce,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 9e 5c 80 00 00 	movabs $0x805c9e,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 a1 39 80 00 00 	movabs $0x8039a1,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be c8 56 80 00 00 	movabs $0x8056c8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 a1 39 80 00 00 	movabs $0x8039a1,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be ca 56 80 00 00 	movabs $0x8056ca,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 a1 39 80 00 00 	movabs $0x8039a1,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be cd 56 80 00 00 	movabs $0x8056cd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 a1 39 80 00 00 	movabs $0x8039a1,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 0c 4a 80 00 00 	movabs $0x804a0c,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 e3 4c 80 00 00 	movabs $0x804ce3,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 8b 2f 80 00 00 	movabs $0x802f8b,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 22 33 80 00 00 	movabs $0x803322,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 eb 33 80 00 00 	movabs $0x8033eb,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 09 31 80 00 00 	movabs $0x803109,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 38 32 80 00 00 	movabs $0x803238,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 a1 39 80 00 00 	movabs $0x8039a1,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 8b 2f 80 00 00 	movabs $0x802f8b,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 44 22 80 00 00 	movabs $0x802244,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 44 22 80 00 00 	movabs $0x802244,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 77 22 80 00 00 	movabs $0x802277,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 44 22 80 00 00 	movabs $0x802244,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 44 22 80 00 00 	movabs $0x802244,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 44 22 80 00 00 	movabs $0x802244,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 26 00 00 00       	call   801525 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs(hello, 1024 * 1024);
+  801505:	be 00 00 10 00       	mov    $0x100000,%esi
+  80150a:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801511:	00 00 00 
+  801514:	48 8b 38             	mov    (%rax),%rdi
+  801517:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+}
+  801523:	5d                   	pop    %rbp
+  801524:	c3                   	ret
+
+0000000000801525 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801525:	55                   	push   %rbp
+  801526:	48 89 e5             	mov    %rsp,%rbp
+  801529:	41 56                	push   %r14
+  80152b:	41 55                	push   %r13
+  80152d:	41 54                	push   %r12
+  80152f:	53                   	push   %rbx
+  801530:	41 89 fd             	mov    %edi,%r13d
+  801533:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801536:	48 ba 18 71 80 00 00 	movabs $0x807118,%rdx
+  80153d:	00 00 00 
+  801540:	48 b8 18 71 80 00 00 	movabs $0x807118,%rax
+  801547:	00 00 00 
+  80154a:	48 39 c2             	cmp    %rax,%rdx
+  80154d:	73 17                	jae    801566 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80154f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801552:	49 89 c4             	mov    %rax,%r12
+  801555:	48 83 c3 08          	add    $0x8,%rbx
+  801559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155e:	ff 53 f8             	call   *-0x8(%rbx)
+  801561:	4c 39 e3             	cmp    %r12,%rbx
+  801564:	72 ef                	jb     801555 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801566:	48 b8 62 26 80 00 00 	movabs $0x802662,%rax
+  80156d:	00 00 00 
+  801570:	ff d0                	call   *%rax
+  801572:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801577:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80157e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801585:	00 00 00 
+  801588:	48 01 d0             	add    %rdx,%rax
+  80158b:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801592:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801595:	45 85 ed             	test   %r13d,%r13d
+  801598:	7e 0d                	jle    8015a7 <libmain+0x82>
+  80159a:	49 8b 06             	mov    (%r14),%rax
+  80159d:	48 a3 40 70 80 00 00 	movabs %rax,0x807040
+  8015a4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015a7:	4c 89 f6             	mov    %r14,%rsi
+  8015aa:	44 89 ef             	mov    %r13d,%edi
+  8015ad:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015b4:	00 00 00 
+  8015b7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015b9:	48 b8 ce 15 80 00 00 	movabs $0x8015ce,%rax
+  8015c0:	00 00 00 
+  8015c3:	ff d0                	call   *%rax
+#endif
+}
+  8015c5:	5b                   	pop    %rbx
+  8015c6:	41 5c                	pop    %r12
+  8015c8:	41 5d                	pop    %r13
+  8015ca:	41 5e                	pop    %r14
+  8015cc:	5d                   	pop    %rbp
+  8015cd:	c3                   	ret
+
+00000000008015ce <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015ce:	55                   	push   %rbp
+  8015cf:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015d2:	48 b8 be 2f 80 00 00 	movabs $0x802fbe,%rax
+  8015d9:	00 00 00 
+  8015dc:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e3:	48 b8 f1 25 80 00 00 	movabs $0x8025f1,%rax
+  8015ea:	00 00 00 
+  8015ed:	ff d0                	call   *%rax
+}
+  8015ef:	5d                   	pop    %rbp
+  8015f0:	c3                   	ret
+
+00000000008015f1 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015f1:	55                   	push   %rbp
+  8015f2:	48 89 e5             	mov    %rsp,%rbp
+  8015f5:	53                   	push   %rbx
+  8015f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fa:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015fd:	8b 06                	mov    (%rsi),%eax
+  8015ff:	8d 50 01             	lea    0x1(%rax),%edx
+  801602:	89 16                	mov    %edx,(%rsi)
+  801604:	48 98                	cltq
+  801606:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80160b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801611:	74 0a                	je     80161d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801613:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801617:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80161d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801621:	be ff 00 00 00       	mov    $0xff,%esi
+  801626:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  80162d:	00 00 00 
+  801630:	ff d0                	call   *%rax
+        state->offset = 0;
+  801632:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801638:	eb d9                	jmp    801613 <putch+0x22>
+
+000000000080163a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80163a:	55                   	push   %rbp
+  80163b:	48 89 e5             	mov    %rsp,%rbp
+  80163e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801645:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801648:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80164f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801654:	b8 00 00 00 00       	mov    $0x0,%eax
+  801659:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80165c:	48 89 f1             	mov    %rsi,%rcx
+  80165f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801666:	48 bf f1 15 80 00 00 	movabs $0x8015f1,%rdi
+  80166d:	00 00 00 
+  801670:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  801677:	00 00 00 
+  80167a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80167c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801683:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80168a:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  801691:	00 00 00 
+  801694:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801696:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80169c:	c9                   	leave
+  80169d:	c3                   	ret
+
+000000000080169e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80169e:	55                   	push   %rbp
+  80169f:	48 89 e5             	mov    %rsp,%rbp
+  8016a2:	48 83 ec 50          	sub    $0x50,%rsp
+  8016a6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016aa:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016b2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016b6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016ba:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016c9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016d1:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016d5:	48 b8 3a 16 80 00 00 	movabs $0x80163a,%rax
+  8016dc:	00 00 00 
+  8016df:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016e1:	c9                   	leave
+  8016e2:	c3                   	ret
+
+00000000008016e3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	41 57                	push   %r15
+  8016e9:	41 56                	push   %r14
+  8016eb:	41 55                	push   %r13
+  8016ed:	41 54                	push   %r12
+  8016ef:	53                   	push   %rbx
+  8016f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8016f4:	49 89 fc             	mov    %rdi,%r12
+  8016f7:	49 89 f5             	mov    %rsi,%r13
+  8016fa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016fe:	8b 45 10             	mov    0x10(%rbp),%eax
+  801701:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801704:	41 89 cf             	mov    %ecx,%r15d
+  801707:	4c 39 fa             	cmp    %r15,%rdx
+  80170a:	73 5b                	jae    801767 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80170c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801710:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801714:	85 db                	test   %ebx,%ebx
+  801716:	7e 0e                	jle    801726 <print_num+0x43>
+            putch(padc, put_arg);
+  801718:	4c 89 ee             	mov    %r13,%rsi
+  80171b:	44 89 f7             	mov    %r14d,%edi
+  80171e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801721:	83 eb 01             	sub    $0x1,%ebx
+  801724:	75 f2                	jne    801718 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801726:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80172a:	48 b9 4b 5c 80 00 00 	movabs $0x805c4b,%rcx
+  801731:	00 00 00 
+  801734:	48 b8 3a 5c 80 00 00 	movabs $0x805c3a,%rax
+  80173b:	00 00 00 
+  80173e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801742:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801746:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174b:	49 f7 f7             	div    %r15
+  80174e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801752:	4c 89 ee             	mov    %r13,%rsi
+  801755:	41 ff d4             	call   *%r12
+}
+  801758:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80175c:	5b                   	pop    %rbx
+  80175d:	41 5c                	pop    %r12
+  80175f:	41 5d                	pop    %r13
+  801761:	41 5e                	pop    %r14
+  801763:	41 5f                	pop    %r15
+  801765:	5d                   	pop    %rbp
+  801766:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801767:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801770:	49 f7 f7             	div    %r15
+  801773:	48 83 ec 08          	sub    $0x8,%rsp
+  801777:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80177b:	52                   	push   %rdx
+  80177c:	45 0f be c9          	movsbl %r9b,%r9d
+  801780:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801784:	48 89 c2             	mov    %rax,%rdx
+  801787:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  80178e:	00 00 00 
+  801791:	ff d0                	call   *%rax
+  801793:	48 83 c4 10          	add    $0x10,%rsp
+  801797:	eb 8d                	jmp    801726 <print_num+0x43>
+
+0000000000801799 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801799:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80179d:	48 8b 06             	mov    (%rsi),%rax
+  8017a0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017a4:	73 0a                	jae    8017b0 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017a6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017aa:	48 89 16             	mov    %rdx,(%rsi)
+  8017ad:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017b0:	c3                   	ret
+
+00000000008017b1 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017b1:	55                   	push   %rbp
+  8017b2:	48 89 e5             	mov    %rsp,%rbp
+  8017b5:	48 83 ec 50          	sub    $0x50,%rsp
+  8017b9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017bd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017c1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017c5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017cc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017d4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017d8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017dc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017e0:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  8017e7:	00 00 00 
+  8017ea:	ff d0                	call   *%rax
+}
+  8017ec:	c9                   	leave
+  8017ed:	c3                   	ret
+
+00000000008017ee <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017ee:	55                   	push   %rbp
+  8017ef:	48 89 e5             	mov    %rsp,%rbp
+  8017f2:	41 57                	push   %r15
+  8017f4:	41 56                	push   %r14
+  8017f6:	41 55                	push   %r13
+  8017f8:	41 54                	push   %r12
+  8017fa:	53                   	push   %rbx
+  8017fb:	48 83 ec 38          	sub    $0x38,%rsp
+  8017ff:	49 89 fe             	mov    %rdi,%r14
+  801802:	49 89 f5             	mov    %rsi,%r13
+  801805:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801808:	48 8b 01             	mov    (%rcx),%rax
+  80180b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80180f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801813:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801817:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80181b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80181f:	eb 0d                	jmp    80182e <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801821:	40 0f b6 ff          	movzbl %dil,%edi
+  801825:	4c 89 ee             	mov    %r13,%rsi
+  801828:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80182b:	4c 89 e3             	mov    %r12,%rbx
+  80182e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801832:	0f b6 3b             	movzbl (%rbx),%edi
+  801835:	40 80 ff 25          	cmp    $0x25,%dil
+  801839:	74 14                	je     80184f <vprintfmt+0x61>
+            if (!ch) return;
+  80183b:	40 84 ff             	test   %dil,%dil
+  80183e:	75 e1                	jne    801821 <vprintfmt+0x33>
+}
+  801840:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801844:	5b                   	pop    %rbx
+  801845:	41 5c                	pop    %r12
+  801847:	41 5d                	pop    %r13
+  801849:	41 5e                	pop    %r14
+  80184b:	41 5f                	pop    %r15
+  80184d:	5d                   	pop    %rbp
+  80184e:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  80184f:	be 00 00 00 00       	mov    $0x0,%esi
+  801854:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801858:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80185d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801863:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80186a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80186e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801873:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801878:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80187b:	83 e8 23             	sub    $0x23,%eax
+  80187e:	3c 57                	cmp    $0x57,%al
+  801880:	0f 87 67 06 00 00    	ja     801eed <vprintfmt+0x6ff>
+  801886:	0f b6 c0             	movzbl %al,%eax
+  801889:	48 b9 e0 5d 80 00 00 	movabs $0x805de0,%rcx
+  801890:	00 00 00 
+  801893:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801896:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801899:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80189d:	eb cf                	jmp    80186e <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80189f:	49 89 dc             	mov    %rbx,%r12
+  8018a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8018a7:	eb c5                	jmp    80186e <vprintfmt+0x80>
+            padc = ch;
+  8018a9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018ad:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018b0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018b3:	eb b9                	jmp    80186e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8018bb:	77 24                	ja     8018e1 <vprintfmt+0xf3>
+  8018bd:	89 c1                	mov    %eax,%ecx
+  8018bf:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018c3:	83 c0 08             	add    $0x8,%eax
+  8018c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018c9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018cc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018cf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018d3:	79 99                	jns    80186e <vprintfmt+0x80>
+                width = precision;
+  8018d5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018d9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018df:	eb 8d                	jmp    80186e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018e1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018e5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018ed:	eb da                	jmp    8018c9 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018ef:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018f4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018f8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018fe:	3c 39                	cmp    $0x39,%al
+  801900:	77 1c                	ja     80191e <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801902:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801906:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80190a:	0f b6 c0             	movzbl %al,%eax
+  80190d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801912:	0f b6 03             	movzbl (%rbx),%eax
+  801915:	3c 39                	cmp    $0x39,%al
+  801917:	76 e9                	jbe    801902 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801919:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80191c:	eb b1                	jmp    8018cf <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  80191e:	49 89 dc             	mov    %rbx,%r12
+  801921:	eb ac                	jmp    8018cf <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801923:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801926:	85 c9                	test   %ecx,%ecx
+  801928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192d:	0f 49 c1             	cmovns %ecx,%eax
+  801930:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801933:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801936:	e9 33 ff ff ff       	jmp    80186e <vprintfmt+0x80>
+            lflag++;
+  80193b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80193e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801941:	e9 28 ff ff ff       	jmp    80186e <vprintfmt+0x80>
+            lflag--;
+  801946:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801949:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80194c:	e9 1d ff ff ff       	jmp    80186e <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801951:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801954:	83 f8 2f             	cmp    $0x2f,%eax
+  801957:	77 19                	ja     801972 <vprintfmt+0x184>
+  801959:	89 c2                	mov    %eax,%edx
+  80195b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80195f:	83 c0 08             	add    $0x8,%eax
+  801962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801965:	8b 3a                	mov    (%rdx),%edi
+  801967:	4c 89 ee             	mov    %r13,%rsi
+  80196a:	41 ff d6             	call   *%r14
+            break;
+  80196d:	e9 bc fe ff ff       	jmp    80182e <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80197a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80197e:	eb e5                	jmp    801965 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801983:	83 f8 2f             	cmp    $0x2f,%eax
+  801986:	77 5a                	ja     8019e2 <vprintfmt+0x1f4>
+  801988:	89 c2                	mov    %eax,%edx
+  80198a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80198e:	83 c0 08             	add    $0x8,%eax
+  801991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801994:	8b 02                	mov    (%rdx),%eax
+  801996:	89 c1                	mov    %eax,%ecx
+  801998:	f7 d9                	neg    %ecx
+  80199a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80199d:	83 f9 13             	cmp    $0x13,%ecx
+  8019a0:	7f 4e                	jg     8019f0 <vprintfmt+0x202>
+  8019a2:	48 63 c1             	movslq %ecx,%rax
+  8019a5:	48 ba a0 60 80 00 00 	movabs $0x8060a0,%rdx
+  8019ac:	00 00 00 
+  8019af:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019b3:	48 85 c0             	test   %rax,%rax
+  8019b6:	74 38                	je     8019f0 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019b8:	48 89 c1             	mov    %rax,%rcx
+  8019bb:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  8019c2:	00 00 00 
+  8019c5:	4c 89 ee             	mov    %r13,%rsi
+  8019c8:	4c 89 f7             	mov    %r14,%rdi
+  8019cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d0:	49 b8 b1 17 80 00 00 	movabs $0x8017b1,%r8
+  8019d7:	00 00 00 
+  8019da:	41 ff d0             	call   *%r8
+  8019dd:	e9 4c fe ff ff       	jmp    80182e <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019ee:	eb a4                	jmp    801994 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019f0:	48 ba 63 5c 80 00 00 	movabs $0x805c63,%rdx
+  8019f7:	00 00 00 
+  8019fa:	4c 89 ee             	mov    %r13,%rsi
+  8019fd:	4c 89 f7             	mov    %r14,%rdi
+  801a00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a05:	49 b8 b1 17 80 00 00 	movabs $0x8017b1,%r8
+  801a0c:	00 00 00 
+  801a0f:	41 ff d0             	call   *%r8
+  801a12:	e9 17 fe ff ff       	jmp    80182e <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a1a:	83 f8 2f             	cmp    $0x2f,%eax
+  801a1d:	77 6c                	ja     801a8b <vprintfmt+0x29d>
+  801a1f:	89 c2                	mov    %eax,%edx
+  801a21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a25:	83 c0 08             	add    $0x8,%eax
+  801a28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a2b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a2e:	48 85 f6             	test   %rsi,%rsi
+  801a31:	48 b8 5c 5c 80 00 00 	movabs $0x805c5c,%rax
+  801a38:	00 00 00 
+  801a3b:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a3f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a43:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a47:	7e 06                	jle    801a4f <vprintfmt+0x261>
+  801a49:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a4d:	75 4a                	jne    801a99 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a4f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a53:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a57:	0f b6 00             	movzbl (%rax),%eax
+  801a5a:	84 c0                	test   %al,%al
+  801a5c:	0f 85 9a 00 00 00    	jne    801afc <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a62:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a65:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	0f 8e bd fd ff ff    	jle    80182e <vprintfmt+0x40>
+  801a71:	4c 89 ee             	mov    %r13,%rsi
+  801a74:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a79:	41 ff d6             	call   *%r14
+  801a7c:	41 83 ec 01          	sub    $0x1,%r12d
+  801a80:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a84:	75 eb                	jne    801a71 <vprintfmt+0x283>
+  801a86:	e9 a3 fd ff ff       	jmp    80182e <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a97:	eb 92                	jmp    801a2b <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a99:	49 63 f7             	movslq %r15d,%rsi
+  801a9c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801aa0:	48 b8 b2 1f 80 00 00 	movabs $0x801fb2,%rax
+  801aa7:	00 00 00 
+  801aaa:	ff d0                	call   *%rax
+  801aac:	48 89 c2             	mov    %rax,%rdx
+  801aaf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ab4:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ab7:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	7e 91                	jle    801a4f <vprintfmt+0x261>
+  801abe:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ac3:	4c 89 ee             	mov    %r13,%rsi
+  801ac6:	44 89 e7             	mov    %r12d,%edi
+  801ac9:	41 ff d6             	call   *%r14
+  801acc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ad3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ad6:	75 eb                	jne    801ac3 <vprintfmt+0x2d5>
+  801ad8:	e9 72 ff ff ff       	jmp    801a4f <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801add:	0f b6 f8             	movzbl %al,%edi
+  801ae0:	4c 89 ee             	mov    %r13,%rsi
+  801ae3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ae6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801aea:	49 83 c4 01          	add    $0x1,%r12
+  801aee:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801af4:	84 c0                	test   %al,%al
+  801af6:	0f 84 66 ff ff ff    	je     801a62 <vprintfmt+0x274>
+  801afc:	45 85 ff             	test   %r15d,%r15d
+  801aff:	78 0a                	js     801b0b <vprintfmt+0x31d>
+  801b01:	41 83 ef 01          	sub    $0x1,%r15d
+  801b05:	0f 88 57 ff ff ff    	js     801a62 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b0b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b0f:	74 cc                	je     801add <vprintfmt+0x2ef>
+  801b11:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b14:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b19:	80 fa 5e             	cmp    $0x5e,%dl
+  801b1c:	77 c2                	ja     801ae0 <vprintfmt+0x2f2>
+  801b1e:	eb bd                	jmp    801add <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b20:	40 84 f6             	test   %sil,%sil
+  801b23:	75 26                	jne    801b4b <vprintfmt+0x35d>
+    switch (lflag) {
+  801b25:	85 d2                	test   %edx,%edx
+  801b27:	74 59                	je     801b82 <vprintfmt+0x394>
+  801b29:	83 fa 01             	cmp    $0x1,%edx
+  801b2c:	74 7b                	je     801ba9 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b31:	83 f8 2f             	cmp    $0x2f,%eax
+  801b34:	0f 87 96 00 00 00    	ja     801bd0 <vprintfmt+0x3e2>
+  801b3a:	89 c2                	mov    %eax,%edx
+  801b3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b40:	83 c0 08             	add    $0x8,%eax
+  801b43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b46:	4c 8b 22             	mov    (%rdx),%r12
+  801b49:	eb 17                	jmp    801b62 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b4e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b51:	77 21                	ja     801b74 <vprintfmt+0x386>
+  801b53:	89 c2                	mov    %eax,%edx
+  801b55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b59:	83 c0 08             	add    $0x8,%eax
+  801b5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b5f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b62:	4d 85 e4             	test   %r12,%r12
+  801b65:	78 7a                	js     801be1 <vprintfmt+0x3f3>
+            num = i;
+  801b67:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b6a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b6f:	e9 56 02 00 00       	jmp    801dca <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b80:	eb dd                	jmp    801b5f <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b85:	83 f8 2f             	cmp    $0x2f,%eax
+  801b88:	77 11                	ja     801b9b <vprintfmt+0x3ad>
+  801b8a:	89 c2                	mov    %eax,%edx
+  801b8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b90:	83 c0 08             	add    $0x8,%eax
+  801b93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b96:	4c 63 22             	movslq (%rdx),%r12
+  801b99:	eb c7                	jmp    801b62 <vprintfmt+0x374>
+  801b9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba7:	eb ed                	jmp    801b96 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801ba9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bac:	83 f8 2f             	cmp    $0x2f,%eax
+  801baf:	77 11                	ja     801bc2 <vprintfmt+0x3d4>
+  801bb1:	89 c2                	mov    %eax,%edx
+  801bb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bb7:	83 c0 08             	add    $0x8,%eax
+  801bba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bbd:	4c 8b 22             	mov    (%rdx),%r12
+  801bc0:	eb a0                	jmp    801b62 <vprintfmt+0x374>
+  801bc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bce:	eb ed                	jmp    801bbd <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bdc:	e9 65 ff ff ff       	jmp    801b46 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801be1:	4c 89 ee             	mov    %r13,%rsi
+  801be4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801be9:	41 ff d6             	call   *%r14
+                i = -i;
+  801bec:	49 f7 dc             	neg    %r12
+  801bef:	e9 73 ff ff ff       	jmp    801b67 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bf4:	40 84 f6             	test   %sil,%sil
+  801bf7:	75 2e                	jne    801c27 <vprintfmt+0x439>
+    switch (lflag) {
+  801bf9:	85 d2                	test   %edx,%edx
+  801bfb:	7f 59                	jg     801c56 <vprintfmt+0x468>
+  801bfd:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c00:	7d 7a                	jge    801c7c <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c05:	83 f8 2f             	cmp    $0x2f,%eax
+  801c08:	0f 87 aa 00 00 00    	ja     801cb8 <vprintfmt+0x4ca>
+  801c0e:	89 c2                	mov    %eax,%edx
+  801c10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c14:	83 c0 08             	add    $0x8,%eax
+  801c17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c1a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c1d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c22:	e9 a3 01 00 00       	jmp    801dca <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c2a:	83 f8 2f             	cmp    $0x2f,%eax
+  801c2d:	77 19                	ja     801c48 <vprintfmt+0x45a>
+  801c2f:	89 c2                	mov    %eax,%edx
+  801c31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c35:	83 c0 08             	add    $0x8,%eax
+  801c38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c3b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c43:	e9 82 01 00 00       	jmp    801dca <vprintfmt+0x5dc>
+  801c48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c54:	eb e5                	jmp    801c3b <vprintfmt+0x44d>
+    switch (lflag) {
+  801c56:	83 fa 01             	cmp    $0x1,%edx
+  801c59:	75 a7                	jne    801c02 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c61:	77 47                	ja     801caa <vprintfmt+0x4bc>
+  801c63:	89 c2                	mov    %eax,%edx
+  801c65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c69:	83 c0 08             	add    $0x8,%eax
+  801c6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c6f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c72:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c77:	e9 4e 01 00 00       	jmp    801dca <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c7f:	83 f8 2f             	cmp    $0x2f,%eax
+  801c82:	77 18                	ja     801c9c <vprintfmt+0x4ae>
+  801c84:	89 c2                	mov    %eax,%edx
+  801c86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c8a:	83 c0 08             	add    $0x8,%eax
+  801c8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c90:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c92:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c97:	e9 2e 01 00 00       	jmp    801dca <vprintfmt+0x5dc>
+  801c9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca8:	eb e6                	jmp    801c90 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801caa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb6:	eb b7                	jmp    801c6f <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cc4:	e9 51 ff ff ff       	jmp    801c1a <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cc9:	40 84 f6             	test   %sil,%sil
+  801ccc:	75 2e                	jne    801cfc <vprintfmt+0x50e>
+    switch (lflag) {
+  801cce:	85 d2                	test   %edx,%edx
+  801cd0:	7f 59                	jg     801d2b <vprintfmt+0x53d>
+  801cd2:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cd5:	7d 77                	jge    801d4e <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cda:	83 f8 2f             	cmp    $0x2f,%eax
+  801cdd:	0f 87 a4 00 00 00    	ja     801d87 <vprintfmt+0x599>
+  801ce3:	89 c2                	mov    %eax,%edx
+  801ce5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ce9:	83 c0 08             	add    $0x8,%eax
+  801cec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cf2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cf7:	e9 ce 00 00 00       	jmp    801dca <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cff:	83 f8 2f             	cmp    $0x2f,%eax
+  801d02:	77 19                	ja     801d1d <vprintfmt+0x52f>
+  801d04:	89 c2                	mov    %eax,%edx
+  801d06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d0a:	83 c0 08             	add    $0x8,%eax
+  801d0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d13:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d18:	e9 ad 00 00 00       	jmp    801dca <vprintfmt+0x5dc>
+  801d1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d29:	eb e5                	jmp    801d10 <vprintfmt+0x522>
+    switch (lflag) {
+  801d2b:	83 fa 01             	cmp    $0x1,%edx
+  801d2e:	75 a7                	jne    801cd7 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d33:	83 f8 2f             	cmp    $0x2f,%eax
+  801d36:	77 41                	ja     801d79 <vprintfmt+0x58b>
+  801d38:	89 c2                	mov    %eax,%edx
+  801d3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d3e:	83 c0 08             	add    $0x8,%eax
+  801d41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d47:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d4c:	eb 7c                	jmp    801dca <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d51:	83 f8 2f             	cmp    $0x2f,%eax
+  801d54:	77 15                	ja     801d6b <vprintfmt+0x57d>
+  801d56:	89 c2                	mov    %eax,%edx
+  801d58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d5c:	83 c0 08             	add    $0x8,%eax
+  801d5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d62:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d64:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d69:	eb 5f                	jmp    801dca <vprintfmt+0x5dc>
+  801d6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d77:	eb e9                	jmp    801d62 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d85:	eb bd                	jmp    801d44 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d93:	e9 57 ff ff ff       	jmp    801cef <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d98:	4c 89 ee             	mov    %r13,%rsi
+  801d9b:	bf 30 00 00 00       	mov    $0x30,%edi
+  801da0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801da3:	4c 89 ee             	mov    %r13,%rsi
+  801da6:	bf 78 00 00 00       	mov    $0x78,%edi
+  801dab:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801dae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db1:	83 f8 2f             	cmp    $0x2f,%eax
+  801db4:	77 47                	ja     801dfd <vprintfmt+0x60f>
+  801db6:	89 c2                	mov    %eax,%edx
+  801db8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dbc:	83 c0 08             	add    $0x8,%eax
+  801dbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dc5:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dca:	48 83 ec 08          	sub    $0x8,%rsp
+  801dce:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dd2:	0f 94 c0             	sete   %al
+  801dd5:	0f b6 c0             	movzbl %al,%eax
+  801dd8:	50                   	push   %rax
+  801dd9:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801dde:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801de2:	4c 89 ee             	mov    %r13,%rsi
+  801de5:	4c 89 f7             	mov    %r14,%rdi
+  801de8:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  801def:	00 00 00 
+  801df2:	ff d0                	call   *%rax
+            break;
+  801df4:	48 83 c4 10          	add    $0x10,%rsp
+  801df8:	e9 31 fa ff ff       	jmp    80182e <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801dfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e09:	eb b7                	jmp    801dc2 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e0b:	40 84 f6             	test   %sil,%sil
+  801e0e:	75 2b                	jne    801e3b <vprintfmt+0x64d>
+    switch (lflag) {
+  801e10:	85 d2                	test   %edx,%edx
+  801e12:	7f 56                	jg     801e6a <vprintfmt+0x67c>
+  801e14:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e17:	7d 77                	jge    801e90 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1c:	83 f8 2f             	cmp    $0x2f,%eax
+  801e1f:	0f 87 a7 00 00 00    	ja     801ecc <vprintfmt+0x6de>
+  801e25:	89 c2                	mov    %eax,%edx
+  801e27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2b:	83 c0 08             	add    $0x8,%eax
+  801e2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e34:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e39:	eb 8f                	jmp    801dca <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e3e:	83 f8 2f             	cmp    $0x2f,%eax
+  801e41:	77 19                	ja     801e5c <vprintfmt+0x66e>
+  801e43:	89 c2                	mov    %eax,%edx
+  801e45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e49:	83 c0 08             	add    $0x8,%eax
+  801e4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e52:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e57:	e9 6e ff ff ff       	jmp    801dca <vprintfmt+0x5dc>
+  801e5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e68:	eb e5                	jmp    801e4f <vprintfmt+0x661>
+    switch (lflag) {
+  801e6a:	83 fa 01             	cmp    $0x1,%edx
+  801e6d:	75 aa                	jne    801e19 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e72:	83 f8 2f             	cmp    $0x2f,%eax
+  801e75:	77 47                	ja     801ebe <vprintfmt+0x6d0>
+  801e77:	89 c2                	mov    %eax,%edx
+  801e79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e7d:	83 c0 08             	add    $0x8,%eax
+  801e80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e86:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e8b:	e9 3a ff ff ff       	jmp    801dca <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e93:	83 f8 2f             	cmp    $0x2f,%eax
+  801e96:	77 18                	ja     801eb0 <vprintfmt+0x6c2>
+  801e98:	89 c2                	mov    %eax,%edx
+  801e9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e9e:	83 c0 08             	add    $0x8,%eax
+  801ea1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ea4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ea6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801eab:	e9 1a ff ff ff       	jmp    801dca <vprintfmt+0x5dc>
+  801eb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ebc:	eb e6                	jmp    801ea4 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ebe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eca:	eb b7                	jmp    801e83 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ecc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed8:	e9 54 ff ff ff       	jmp    801e31 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801edd:	4c 89 ee             	mov    %r13,%rsi
+  801ee0:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ee5:	41 ff d6             	call   *%r14
+            break;
+  801ee8:	e9 41 f9 ff ff       	jmp    80182e <vprintfmt+0x40>
+            putch('%', put_arg);
+  801eed:	4c 89 ee             	mov    %r13,%rsi
+  801ef0:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ef5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ef8:	48 83 eb 01          	sub    $0x1,%rbx
+  801efc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f00:	75 f6                	jne    801ef8 <vprintfmt+0x70a>
+  801f02:	e9 27 f9 ff ff       	jmp    80182e <vprintfmt+0x40>
+
+0000000000801f07 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f07:	55                   	push   %rbp
+  801f08:	48 89 e5             	mov    %rsp,%rbp
+  801f0b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f13:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f18:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f1c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f23:	48 85 ff             	test   %rdi,%rdi
+  801f26:	74 2b                	je     801f53 <vsnprintf+0x4c>
+  801f28:	48 85 f6             	test   %rsi,%rsi
+  801f2b:	74 26                	je     801f53 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f2d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f31:	48 bf 99 17 80 00 00 	movabs $0x801799,%rdi
+  801f38:	00 00 00 
+  801f3b:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f4b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f4e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f58:	eb f7                	jmp    801f51 <vsnprintf+0x4a>
+
+0000000000801f5a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f5a:	55                   	push   %rbp
+  801f5b:	48 89 e5             	mov    %rsp,%rbp
+  801f5e:	48 83 ec 50          	sub    $0x50,%rsp
+  801f62:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f66:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f6a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f6e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f75:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f81:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f85:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f89:	48 b8 07 1f 80 00 00 	movabs $0x801f07,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f95:	c9                   	leave
+  801f96:	c3                   	ret
+
+0000000000801f97 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f97:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f9a:	74 10                	je     801fac <strlen+0x15>
+    size_t n = 0;
+  801f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fa1:	48 83 c0 01          	add    $0x1,%rax
+  801fa5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fa9:	75 f6                	jne    801fa1 <strlen+0xa>
+  801fab:	c3                   	ret
+    size_t n = 0;
+  801fac:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fb1:	c3                   	ret
+
+0000000000801fb2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fb2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fb5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fba:	48 85 f6             	test   %rsi,%rsi
+  801fbd:	74 11                	je     801fd0 <strnlen+0x1e>
+  801fbf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fc3:	74 0c                	je     801fd1 <strnlen+0x1f>
+  801fc5:	48 83 c2 01          	add    $0x1,%rdx
+  801fc9:	48 39 d0             	cmp    %rdx,%rax
+  801fcc:	75 f1                	jne    801fbf <strnlen+0xd>
+  801fce:	eb 04                	jmp    801fd4 <strnlen+0x22>
+  801fd0:	c3                   	ret
+  801fd1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fd4:	c3                   	ret
+
+0000000000801fd5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fd5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fe1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fe4:	48 83 c2 01          	add    $0x1,%rdx
+  801fe8:	84 c9                	test   %cl,%cl
+  801fea:	75 f1                	jne    801fdd <strcpy+0x8>
+        ;
+    return res;
+}
+  801fec:	c3                   	ret
+
+0000000000801fed <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fed:	55                   	push   %rbp
+  801fee:	48 89 e5             	mov    %rsp,%rbp
+  801ff1:	41 54                	push   %r12
+  801ff3:	53                   	push   %rbx
+  801ff4:	48 89 fb             	mov    %rdi,%rbx
+  801ff7:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801ffa:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802006:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80200a:	4c 89 e6             	mov    %r12,%rsi
+  80200d:	48 b8 d5 1f 80 00 00 	movabs $0x801fd5,%rax
+  802014:	00 00 00 
+  802017:	ff d0                	call   *%rax
+    return dst;
+}
+  802019:	48 89 d8             	mov    %rbx,%rax
+  80201c:	5b                   	pop    %rbx
+  80201d:	41 5c                	pop    %r12
+  80201f:	5d                   	pop    %rbp
+  802020:	c3                   	ret
+
+0000000000802021 <toupper>:
+
+int
+toupper(int ch) {
+  802021:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802023:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802026:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802029:	83 f9 1a             	cmp    $0x1a,%ecx
+  80202c:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80202f:	c3                   	ret
+
+0000000000802030 <tolower>:
+
+int
+tolower(int ch) {
+  802030:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802032:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802035:	8d 57 20             	lea    0x20(%rdi),%edx
+  802038:	83 f9 1a             	cmp    $0x1a,%ecx
+  80203b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80203e:	c3                   	ret
+
+000000000080203f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80203f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802042:	48 85 d2             	test   %rdx,%rdx
+  802045:	74 1f                	je     802066 <strncpy+0x27>
+  802047:	48 01 fa             	add    %rdi,%rdx
+  80204a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80204d:	48 83 c1 01          	add    $0x1,%rcx
+  802051:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802055:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802059:	41 80 f8 01          	cmp    $0x1,%r8b
+  80205d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802061:	48 39 ca             	cmp    %rcx,%rdx
+  802064:	75 e7                	jne    80204d <strncpy+0xe>
+    }
+    return ret;
+}
+  802066:	c3                   	ret
+
+0000000000802067 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802067:	48 89 f8             	mov    %rdi,%rax
+  80206a:	48 85 d2             	test   %rdx,%rdx
+  80206d:	74 24                	je     802093 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80206f:	48 83 ea 01          	sub    $0x1,%rdx
+  802073:	74 1b                	je     802090 <strlcpy+0x29>
+  802075:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802079:	0f b6 16             	movzbl (%rsi),%edx
+  80207c:	84 d2                	test   %dl,%dl
+  80207e:	74 10                	je     802090 <strlcpy+0x29>
+            *dst++ = *src++;
+  802080:	48 83 c6 01          	add    $0x1,%rsi
+  802084:	48 83 c0 01          	add    $0x1,%rax
+  802088:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80208b:	48 39 c8             	cmp    %rcx,%rax
+  80208e:	75 e9                	jne    802079 <strlcpy+0x12>
+        *dst = '\0';
+  802090:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802093:	48 29 f8             	sub    %rdi,%rax
+}
+  802096:	c3                   	ret
+
+0000000000802097 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802097:	0f b6 07             	movzbl (%rdi),%eax
+  80209a:	84 c0                	test   %al,%al
+  80209c:	74 13                	je     8020b1 <strcmp+0x1a>
+  80209e:	38 06                	cmp    %al,(%rsi)
+  8020a0:	75 0f                	jne    8020b1 <strcmp+0x1a>
+  8020a2:	48 83 c7 01          	add    $0x1,%rdi
+  8020a6:	48 83 c6 01          	add    $0x1,%rsi
+  8020aa:	0f b6 07             	movzbl (%rdi),%eax
+  8020ad:	84 c0                	test   %al,%al
+  8020af:	75 ed                	jne    80209e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020b1:	0f b6 c0             	movzbl %al,%eax
+  8020b4:	0f b6 16             	movzbl (%rsi),%edx
+  8020b7:	29 d0                	sub    %edx,%eax
+}
+  8020b9:	c3                   	ret
+
+00000000008020ba <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020ba:	48 85 d2             	test   %rdx,%rdx
+  8020bd:	74 1f                	je     8020de <strncmp+0x24>
+  8020bf:	0f b6 07             	movzbl (%rdi),%eax
+  8020c2:	84 c0                	test   %al,%al
+  8020c4:	74 1e                	je     8020e4 <strncmp+0x2a>
+  8020c6:	3a 06                	cmp    (%rsi),%al
+  8020c8:	75 1a                	jne    8020e4 <strncmp+0x2a>
+  8020ca:	48 83 c7 01          	add    $0x1,%rdi
+  8020ce:	48 83 c6 01          	add    $0x1,%rsi
+  8020d2:	48 83 ea 01          	sub    $0x1,%rdx
+  8020d6:	75 e7                	jne    8020bf <strncmp+0x5>
+
+    if (!n) return 0;
+  8020d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dd:	c3                   	ret
+  8020de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e3:	c3                   	ret
+  8020e4:	48 85 d2             	test   %rdx,%rdx
+  8020e7:	74 09                	je     8020f2 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020e9:	0f b6 07             	movzbl (%rdi),%eax
+  8020ec:	0f b6 16             	movzbl (%rsi),%edx
+  8020ef:	29 d0                	sub    %edx,%eax
+  8020f1:	c3                   	ret
+    if (!n) return 0;
+  8020f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f7:	c3                   	ret
+
+00000000008020f8 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020f8:	0f b6 17             	movzbl (%rdi),%edx
+  8020fb:	84 d2                	test   %dl,%dl
+  8020fd:	74 18                	je     802117 <strchr+0x1f>
+        if (*str == c) {
+  8020ff:	0f be d2             	movsbl %dl,%edx
+  802102:	39 f2                	cmp    %esi,%edx
+  802104:	74 17                	je     80211d <strchr+0x25>
+    for (; *str; str++) {
+  802106:	48 83 c7 01          	add    $0x1,%rdi
+  80210a:	0f b6 17             	movzbl (%rdi),%edx
+  80210d:	84 d2                	test   %dl,%dl
+  80210f:	75 ee                	jne    8020ff <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802111:	b8 00 00 00 00       	mov    $0x0,%eax
+  802116:	c3                   	ret
+  802117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211c:	c3                   	ret
+  80211d:	48 89 f8             	mov    %rdi,%rax
+}
+  802120:	c3                   	ret
+
+0000000000802121 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802121:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802124:	0f b6 17             	movzbl (%rdi),%edx
+  802127:	84 d2                	test   %dl,%dl
+  802129:	74 13                	je     80213e <strfind+0x1d>
+  80212b:	0f be d2             	movsbl %dl,%edx
+  80212e:	39 f2                	cmp    %esi,%edx
+  802130:	74 0b                	je     80213d <strfind+0x1c>
+  802132:	48 83 c0 01          	add    $0x1,%rax
+  802136:	0f b6 10             	movzbl (%rax),%edx
+  802139:	84 d2                	test   %dl,%dl
+  80213b:	75 ee                	jne    80212b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80213d:	c3                   	ret
+  80213e:	c3                   	ret
+
+000000000080213f <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80213f:	48 39 f7             	cmp    %rsi,%rdi
+  802142:	74 65                	je     8021a9 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+  802148:	41 57                	push   %r15
+  80214a:	41 56                	push   %r14
+  80214c:	41 55                	push   %r13
+  80214e:	41 54                	push   %r12
+  802150:	53                   	push   %rbx
+  802151:	48 83 ec 18          	sub    $0x18,%rsp
+  802155:	48 89 fb             	mov    %rdi,%rbx
+  802158:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80215b:	49 bf 30 20 80 00 00 	movabs $0x802030,%r15
+  802162:	00 00 00 
+  802165:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802169:	41 0f b6 fd          	movzbl %r13b,%edi
+  80216d:	41 ff d7             	call   *%r15
+  802170:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802173:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802178:	41 0f b6 fe          	movzbl %r14b,%edi
+  80217c:	41 ff d7             	call   *%r15
+  80217f:	89 c2                	mov    %eax,%edx
+  802181:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802184:	29 d0                	sub    %edx,%eax
+  802186:	75 12                	jne    80219a <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802188:	48 83 c3 01          	add    $0x1,%rbx
+  80218c:	45 84 ed             	test   %r13b,%r13b
+  80218f:	74 09                	je     80219a <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802191:	49 83 c4 01          	add    $0x1,%r12
+  802195:	45 84 f6             	test   %r14b,%r14b
+  802198:	75 cb                	jne    802165 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80219a:	48 83 c4 18          	add    $0x18,%rsp
+  80219e:	5b                   	pop    %rbx
+  80219f:	41 5c                	pop    %r12
+  8021a1:	41 5d                	pop    %r13
+  8021a3:	41 5e                	pop    %r14
+  8021a5:	41 5f                	pop    %r15
+  8021a7:	5d                   	pop    %rbp
+  8021a8:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ae:	c3                   	ret
+
+00000000008021af <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021af:	48 39 f7             	cmp    %rsi,%rdi
+  8021b2:	74 7d                	je     802231 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021b4:	55                   	push   %rbp
+  8021b5:	48 89 e5             	mov    %rsp,%rbp
+  8021b8:	41 57                	push   %r15
+  8021ba:	41 56                	push   %r14
+  8021bc:	41 55                	push   %r13
+  8021be:	41 54                	push   %r12
+  8021c0:	53                   	push   %rbx
+  8021c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8021c5:	48 89 fb             	mov    %rdi,%rbx
+  8021c8:	49 89 f4             	mov    %rsi,%r12
+  8021cb:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021d3:	49 bf 30 20 80 00 00 	movabs $0x802030,%r15
+  8021da:	00 00 00 
+    while (n--) {
+  8021dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e1:	48 39 c3             	cmp    %rax,%rbx
+  8021e4:	74 37                	je     80221d <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021e6:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021ea:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021ee:	41 ff d7             	call   *%r15
+  8021f1:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021f4:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021f9:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021fd:	41 ff d7             	call   *%r15
+  802200:	89 c2                	mov    %eax,%edx
+  802202:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802205:	29 d0                	sub    %edx,%eax
+  802207:	75 19                	jne    802222 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802209:	48 83 c3 01          	add    $0x1,%rbx
+  80220d:	45 84 ed             	test   %r13b,%r13b
+  802210:	74 10                	je     802222 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802212:	49 83 c4 01          	add    $0x1,%r12
+  802216:	45 84 f6             	test   %r14b,%r14b
+  802219:	75 c2                	jne    8021dd <strncasecmp+0x2e>
+  80221b:	eb 05                	jmp    802222 <strncasecmp+0x73>
+  80221d:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802222:	48 83 c4 18          	add    $0x18,%rsp
+  802226:	5b                   	pop    %rbx
+  802227:	41 5c                	pop    %r12
+  802229:	41 5d                	pop    %r13
+  80222b:	41 5e                	pop    %r14
+  80222d:	41 5f                	pop    %r15
+  80222f:	5d                   	pop    %rbp
+  802230:	c3                   	ret
+    if (p1 == p2) return 0;
+  802231:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802236:	c3                   	ret
+
+0000000000802237 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802237:	83 e7 df             	and    $0xffffffdf,%edi
+  80223a:	83 ef 41             	sub    $0x41,%edi
+  80223d:	83 ff 19             	cmp    $0x19,%edi
+  802240:	0f 96 c0             	setbe  %al
+}
+  802243:	c3                   	ret
+
+0000000000802244 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802244:	83 ff 20             	cmp    $0x20,%edi
+  802247:	0f 94 c0             	sete   %al
+  80224a:	83 ff 09             	cmp    $0x9,%edi
+  80224d:	0f 94 c2             	sete   %dl
+  802250:	09 d0                	or     %edx,%eax
+}
+  802252:	c3                   	ret
+
+0000000000802253 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802253:	55                   	push   %rbp
+  802254:	48 89 e5             	mov    %rsp,%rbp
+  802257:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802259:	48 bf 5f 61 80 00 00 	movabs $0x80615f,%rdi
+  802260:	00 00 00 
+  802263:	48 b8 f8 20 80 00 00 	movabs $0x8020f8,%rax
+  80226a:	00 00 00 
+  80226d:	ff d0                	call   *%rax
+  80226f:	48 85 c0             	test   %rax,%rax
+  802272:	0f 95 c0             	setne  %al
+}
+  802275:	5d                   	pop    %rbp
+  802276:	c3                   	ret
+
+0000000000802277 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802277:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80227a:	48 89 f8             	mov    %rdi,%rax
+  80227d:	48 f7 d8             	neg    %rax
+  802280:	83 e0 07             	and    $0x7,%eax
+  802283:	49 89 d1             	mov    %rdx,%r9
+  802286:	49 29 c1             	sub    %rax,%r9
+  802289:	78 36                	js     8022c1 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80228b:	40 0f b6 c6          	movzbl %sil,%eax
+  80228f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802296:	01 01 01 
+  802299:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80229d:	40 f6 c7 07          	test   $0x7,%dil
+  8022a1:	75 38                	jne    8022db <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022a3:	4c 89 c9             	mov    %r9,%rcx
+  8022a6:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022aa:	74 0c                	je     8022b8 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022ac:	fc                   	cld
+  8022ad:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022b0:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022b4:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022b8:	4d 85 c9             	test   %r9,%r9
+  8022bb:	75 45                	jne    802302 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022bd:	4c 89 c0             	mov    %r8,%rax
+  8022c0:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022c1:	48 85 d2             	test   %rdx,%rdx
+  8022c4:	74 f7                	je     8022bd <memset+0x46>
+  8022c6:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022c9:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022cc:	48 83 c0 01          	add    $0x1,%rax
+  8022d0:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022d4:	48 39 c2             	cmp    %rax,%rdx
+  8022d7:	75 f3                	jne    8022cc <memset+0x55>
+  8022d9:	eb e2                	jmp    8022bd <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022db:	40 f6 c7 01          	test   $0x1,%dil
+  8022df:	74 06                	je     8022e7 <memset+0x70>
+  8022e1:	88 07                	mov    %al,(%rdi)
+  8022e3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022e7:	40 f6 c7 02          	test   $0x2,%dil
+  8022eb:	74 07                	je     8022f4 <memset+0x7d>
+  8022ed:	66 89 07             	mov    %ax,(%rdi)
+  8022f0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022f4:	40 f6 c7 04          	test   $0x4,%dil
+  8022f8:	74 a9                	je     8022a3 <memset+0x2c>
+  8022fa:	89 07                	mov    %eax,(%rdi)
+  8022fc:	48 83 c7 04          	add    $0x4,%rdi
+  802300:	eb a1                	jmp    8022a3 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802302:	41 f6 c1 04          	test   $0x4,%r9b
+  802306:	74 06                	je     80230e <memset+0x97>
+  802308:	89 07                	mov    %eax,(%rdi)
+  80230a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80230e:	41 f6 c1 02          	test   $0x2,%r9b
+  802312:	74 07                	je     80231b <memset+0xa4>
+  802314:	66 89 07             	mov    %ax,(%rdi)
+  802317:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80231b:	41 f6 c1 01          	test   $0x1,%r9b
+  80231f:	74 9c                	je     8022bd <memset+0x46>
+  802321:	88 07                	mov    %al,(%rdi)
+  802323:	eb 98                	jmp    8022bd <memset+0x46>
+
+0000000000802325 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802325:	48 89 f8             	mov    %rdi,%rax
+  802328:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80232b:	48 39 fe             	cmp    %rdi,%rsi
+  80232e:	73 3b                	jae    80236b <memmove+0x46>
+  802330:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802334:	48 39 d7             	cmp    %rdx,%rdi
+  802337:	73 32                	jae    80236b <memmove+0x46>
+        s += n;
+        d += n;
+  802339:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80233d:	48 89 d6             	mov    %rdx,%rsi
+  802340:	48 09 fe             	or     %rdi,%rsi
+  802343:	48 09 ce             	or     %rcx,%rsi
+  802346:	40 f6 c6 07          	test   $0x7,%sil
+  80234a:	75 12                	jne    80235e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80234c:	48 83 ef 08          	sub    $0x8,%rdi
+  802350:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802354:	48 c1 e9 03          	shr    $0x3,%rcx
+  802358:	fd                   	std
+  802359:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80235c:	fc                   	cld
+  80235d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80235e:	48 83 ef 01          	sub    $0x1,%rdi
+  802362:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802366:	fd                   	std
+  802367:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802369:	eb f1                	jmp    80235c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80236b:	48 89 f2             	mov    %rsi,%rdx
+  80236e:	48 09 c2             	or     %rax,%rdx
+  802371:	48 09 ca             	or     %rcx,%rdx
+  802374:	f6 c2 07             	test   $0x7,%dl
+  802377:	75 0c                	jne    802385 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802379:	48 c1 e9 03          	shr    $0x3,%rcx
+  80237d:	48 89 c7             	mov    %rax,%rdi
+  802380:	fc                   	cld
+  802381:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802384:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802385:	48 89 c7             	mov    %rax,%rdi
+  802388:	fc                   	cld
+  802389:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80238b:	c3                   	ret
+
+000000000080238c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80238c:	55                   	push   %rbp
+  80238d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802390:	48 b8 25 23 80 00 00 	movabs $0x802325,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+}
+  80239c:	5d                   	pop    %rbp
+  80239d:	c3                   	ret
+
+000000000080239e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80239e:	55                   	push   %rbp
+  80239f:	48 89 e5             	mov    %rsp,%rbp
+  8023a2:	41 57                	push   %r15
+  8023a4:	41 56                	push   %r14
+  8023a6:	41 55                	push   %r13
+  8023a8:	41 54                	push   %r12
+  8023aa:	53                   	push   %rbx
+  8023ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8023af:	49 89 fe             	mov    %rdi,%r14
+  8023b2:	49 89 f7             	mov    %rsi,%r15
+  8023b5:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023b8:	48 89 f7             	mov    %rsi,%rdi
+  8023bb:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+  8023c7:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023ca:	48 89 de             	mov    %rbx,%rsi
+  8023cd:	4c 89 f7             	mov    %r14,%rdi
+  8023d0:	48 b8 b2 1f 80 00 00 	movabs $0x801fb2,%rax
+  8023d7:	00 00 00 
+  8023da:	ff d0                	call   *%rax
+  8023dc:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023df:	48 39 c3             	cmp    %rax,%rbx
+  8023e2:	74 36                	je     80241a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023e4:	48 89 d8             	mov    %rbx,%rax
+  8023e7:	4c 29 e8             	sub    %r13,%rax
+  8023ea:	49 39 c4             	cmp    %rax,%r12
+  8023ed:	73 31                	jae    802420 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023ef:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023f4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023f8:	4c 89 fe             	mov    %r15,%rsi
+  8023fb:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  802402:	00 00 00 
+  802405:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802407:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80240b:	48 83 c4 08          	add    $0x8,%rsp
+  80240f:	5b                   	pop    %rbx
+  802410:	41 5c                	pop    %r12
+  802412:	41 5d                	pop    %r13
+  802414:	41 5e                	pop    %r14
+  802416:	41 5f                	pop    %r15
+  802418:	5d                   	pop    %rbp
+  802419:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80241a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80241e:	eb eb                	jmp    80240b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802420:	48 83 eb 01          	sub    $0x1,%rbx
+  802424:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802428:	48 89 da             	mov    %rbx,%rdx
+  80242b:	4c 89 fe             	mov    %r15,%rsi
+  80242e:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  802435:	00 00 00 
+  802438:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80243a:	49 01 de             	add    %rbx,%r14
+  80243d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802442:	eb c3                	jmp    802407 <strlcat+0x69>
+
+0000000000802444 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802444:	48 85 d2             	test   %rdx,%rdx
+  802447:	74 2d                	je     802476 <memcmp+0x32>
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80244e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802452:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802457:	44 38 c1             	cmp    %r8b,%cl
+  80245a:	75 0f                	jne    80246b <memcmp+0x27>
+    while (n-- > 0) {
+  80245c:	48 83 c0 01          	add    $0x1,%rax
+  802460:	48 39 c2             	cmp    %rax,%rdx
+  802463:	75 e9                	jne    80244e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80246b:	0f b6 c1             	movzbl %cl,%eax
+  80246e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802472:	44 29 c0             	sub    %r8d,%eax
+  802475:	c3                   	ret
+    return 0;
+  802476:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247b:	c3                   	ret
+
+000000000080247c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80247c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802480:	48 39 c7             	cmp    %rax,%rdi
+  802483:	73 0f                	jae    802494 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802485:	40 38 37             	cmp    %sil,(%rdi)
+  802488:	74 0e                	je     802498 <memfind+0x1c>
+    for (; src < end; src++) {
+  80248a:	48 83 c7 01          	add    $0x1,%rdi
+  80248e:	48 39 f8             	cmp    %rdi,%rax
+  802491:	75 f2                	jne    802485 <memfind+0x9>
+  802493:	c3                   	ret
+  802494:	48 89 f8             	mov    %rdi,%rax
+  802497:	c3                   	ret
+  802498:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80249b:	c3                   	ret
+
+000000000080249c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80249c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80249f:	0f b6 37             	movzbl (%rdi),%esi
+  8024a2:	40 80 fe 20          	cmp    $0x20,%sil
+  8024a6:	74 06                	je     8024ae <strtol+0x12>
+  8024a8:	40 80 fe 09          	cmp    $0x9,%sil
+  8024ac:	75 13                	jne    8024c1 <strtol+0x25>
+  8024ae:	48 83 c7 01          	add    $0x1,%rdi
+  8024b2:	0f b6 37             	movzbl (%rdi),%esi
+  8024b5:	40 80 fe 20          	cmp    $0x20,%sil
+  8024b9:	74 f3                	je     8024ae <strtol+0x12>
+  8024bb:	40 80 fe 09          	cmp    $0x9,%sil
+  8024bf:	74 ed                	je     8024ae <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024c1:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024c4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024c7:	3c 01                	cmp    $0x1,%al
+  8024c9:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024cd:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024d3:	75 0f                	jne    8024e4 <strtol+0x48>
+  8024d5:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024d8:	74 14                	je     8024ee <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024da:	85 d2                	test   %edx,%edx
+  8024dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024e1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024e4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024e9:	4c 63 ca             	movslq %edx,%r9
+  8024ec:	eb 36                	jmp    802524 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024ee:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024f2:	74 0f                	je     802503 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024f4:	85 d2                	test   %edx,%edx
+  8024f6:	75 ec                	jne    8024e4 <strtol+0x48>
+        s++;
+  8024f8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024fc:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802501:	eb e1                	jmp    8024e4 <strtol+0x48>
+        s += 2;
+  802503:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802507:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80250c:	eb d6                	jmp    8024e4 <strtol+0x48>
+            dig -= '0';
+  80250e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802511:	44 0f b6 c1          	movzbl %cl,%r8d
+  802515:	41 39 d0             	cmp    %edx,%r8d
+  802518:	7d 21                	jge    80253b <strtol+0x9f>
+        val = val * base + dig;
+  80251a:	49 0f af c1          	imul   %r9,%rax
+  80251e:	0f b6 c9             	movzbl %cl,%ecx
+  802521:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802524:	48 83 c7 01          	add    $0x1,%rdi
+  802528:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80252c:	80 f9 39             	cmp    $0x39,%cl
+  80252f:	76 dd                	jbe    80250e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802531:	80 f9 7b             	cmp    $0x7b,%cl
+  802534:	77 05                	ja     80253b <strtol+0x9f>
+            dig -= 'a' - 10;
+  802536:	83 e9 57             	sub    $0x57,%ecx
+  802539:	eb d6                	jmp    802511 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80253b:	4d 85 d2             	test   %r10,%r10
+  80253e:	74 03                	je     802543 <strtol+0xa7>
+  802540:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802543:	48 89 c2             	mov    %rax,%rdx
+  802546:	48 f7 da             	neg    %rdx
+  802549:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80254d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802551:	c3                   	ret
+
+0000000000802552 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802552:	55                   	push   %rbp
+  802553:	48 89 e5             	mov    %rsp,%rbp
+  802556:	53                   	push   %rbx
+  802557:	48 89 fa             	mov    %rdi,%rdx
+  80255a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80255d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802567:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80256c:	be 00 00 00 00       	mov    $0x0,%esi
+  802571:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802577:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80257d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80257f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802583:	c9                   	leave
+  802584:	c3                   	ret
+
+0000000000802585 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802585:	55                   	push   %rbp
+  802586:	48 89 e5             	mov    %rsp,%rbp
+  802589:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80258a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80258f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802594:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802599:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80259e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025b4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ba:	c9                   	leave
+  8025bb:	c3                   	ret
+
+00000000008025bc <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025bc:	55                   	push   %rbp
+  8025bd:	48 89 e5             	mov    %rsp,%rbp
+  8025c0:	53                   	push   %rbx
+  8025c1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025c4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025e9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ef:	c9                   	leave
+  8025f0:	c3                   	ret
+
+00000000008025f1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025f1:	55                   	push   %rbp
+  8025f2:	48 89 e5             	mov    %rsp,%rbp
+  8025f5:	53                   	push   %rbx
+  8025f6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025fa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025fd:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802602:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802607:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80260c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802611:	be 00 00 00 00       	mov    $0x0,%esi
+  802616:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80261c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802622:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802624:	48 85 c0             	test   %rax,%rax
+  802627:	7f 06                	jg     80262f <sys_env_destroy+0x3e>
+}
+  802629:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80262d:	c9                   	leave
+  80262e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80262f:	49 89 c0             	mov    %rax,%r8
+  802632:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802637:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  80263e:	00 00 00 
+  802641:	be 27 00 00 00       	mov    $0x27,%esi
+  802646:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  80264d:	00 00 00 
+  802650:	b8 00 00 00 00       	mov    $0x0,%eax
+  802655:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  80265c:	00 00 00 
+  80265f:	41 ff d1             	call   *%r9
+
+0000000000802662 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802662:	55                   	push   %rbp
+  802663:	48 89 e5             	mov    %rsp,%rbp
+  802666:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802667:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80266c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802671:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802676:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80267b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802680:	be 00 00 00 00       	mov    $0x0,%esi
+  802685:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80268b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802691:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802693:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802697:	c9                   	leave
+  802698:	c3                   	ret
+
+0000000000802699 <sys_yield>:
+
+void
+sys_yield(void) {
+  802699:	55                   	push   %rbp
+  80269a:	48 89 e5             	mov    %rsp,%rbp
+  80269d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80269e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026c8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ce:	c9                   	leave
+  8026cf:	c3                   	ret
+
+00000000008026d0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026d0:	55                   	push   %rbp
+  8026d1:	48 89 e5             	mov    %rsp,%rbp
+  8026d4:	53                   	push   %rbx
+  8026d5:	48 89 fa             	mov    %rdi,%rdx
+  8026d8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026db:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026e7:	00 00 00 
+  8026ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802700:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802702:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802706:	c9                   	leave
+  802707:	c3                   	ret
+
+0000000000802708 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802708:	55                   	push   %rbp
+  802709:	48 89 e5             	mov    %rsp,%rbp
+  80270c:	53                   	push   %rbx
+  80270d:	49 89 f8             	mov    %rdi,%r8
+  802710:	48 89 d3             	mov    %rdx,%rbx
+  802713:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802716:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80271b:	4c 89 c2             	mov    %r8,%rdx
+  80271e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802721:	be 00 00 00 00       	mov    $0x0,%esi
+  802726:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80272c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802732:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802734:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802738:	c9                   	leave
+  802739:	c3                   	ret
+
+000000000080273a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+  80273e:	53                   	push   %rbx
+  80273f:	48 83 ec 08          	sub    $0x8,%rsp
+  802743:	89 f8                	mov    %edi,%eax
+  802745:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802748:	48 63 f9             	movslq %ecx,%rdi
+  80274b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80274e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802753:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802756:	be 00 00 00 00       	mov    $0x0,%esi
+  80275b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802761:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802767:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802769:	48 85 c0             	test   %rax,%rax
+  80276c:	7f 06                	jg     802774 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80276e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802772:	c9                   	leave
+  802773:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802774:	49 89 c0             	mov    %rax,%r8
+  802777:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80277c:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802783:	00 00 00 
+  802786:	be 27 00 00 00       	mov    $0x27,%esi
+  80278b:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802792:	00 00 00 
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279a:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  8027a1:	00 00 00 
+  8027a4:	41 ff d1             	call   *%r9
+
+00000000008027a7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027a7:	55                   	push   %rbp
+  8027a8:	48 89 e5             	mov    %rsp,%rbp
+  8027ab:	53                   	push   %rbx
+  8027ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b0:	89 f8                	mov    %edi,%eax
+  8027b2:	49 89 f2             	mov    %rsi,%r10
+  8027b5:	48 89 cf             	mov    %rcx,%rdi
+  8027b8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027bb:	48 63 da             	movslq %edx,%rbx
+  8027be:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027c6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c9:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027d4:	48 85 c0             	test   %rax,%rax
+  8027d7:	7f 06                	jg     8027df <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027dd:	c9                   	leave
+  8027de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027df:	49 89 c0             	mov    %rax,%r8
+  8027e2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027e7:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8027ee:	00 00 00 
+  8027f1:	be 27 00 00 00       	mov    $0x27,%esi
+  8027f6:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  8027fd:	00 00 00 
+  802800:	b8 00 00 00 00       	mov    $0x0,%eax
+  802805:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  80280c:	00 00 00 
+  80280f:	41 ff d1             	call   *%r9
+
+0000000000802812 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802812:	55                   	push   %rbp
+  802813:	48 89 e5             	mov    %rsp,%rbp
+  802816:	53                   	push   %rbx
+  802817:	48 83 ec 08          	sub    $0x8,%rsp
+  80281b:	48 89 f1             	mov    %rsi,%rcx
+  80281e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802821:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802824:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802829:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80282e:	be 00 00 00 00       	mov    $0x0,%esi
+  802833:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802839:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80283f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802841:	48 85 c0             	test   %rax,%rax
+  802844:	7f 06                	jg     80284c <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802846:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80284a:	c9                   	leave
+  80284b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80284c:	49 89 c0             	mov    %rax,%r8
+  80284f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802854:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  80285b:	00 00 00 
+  80285e:	be 27 00 00 00       	mov    $0x27,%esi
+  802863:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  80286a:	00 00 00 
+  80286d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802872:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802879:	00 00 00 
+  80287c:	41 ff d1             	call   *%r9
+
+000000000080287f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80287f:	55                   	push   %rbp
+  802880:	48 89 e5             	mov    %rsp,%rbp
+  802883:	53                   	push   %rbx
+  802884:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802888:	48 63 ce             	movslq %esi,%rcx
+  80288b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80288e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802893:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802898:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80289d:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028b0:	48 85 c0             	test   %rax,%rax
+  8028b3:	7f 06                	jg     8028bb <sys_env_set_status+0x3c>
+}
+  8028b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b9:	c9                   	leave
+  8028ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028bb:	49 89 c0             	mov    %rax,%r8
+  8028be:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028c3:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8028ca:	00 00 00 
+  8028cd:	be 27 00 00 00       	mov    $0x27,%esi
+  8028d2:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  8028d9:	00 00 00 
+  8028dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e1:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  8028e8:	00 00 00 
+  8028eb:	41 ff d1             	call   *%r9
+
+00000000008028ee <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028ee:	55                   	push   %rbp
+  8028ef:	48 89 e5             	mov    %rsp,%rbp
+  8028f2:	53                   	push   %rbx
+  8028f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028fa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802902:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802907:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80290c:	be 00 00 00 00       	mov    $0x0,%esi
+  802911:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802917:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80291d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80291f:	48 85 c0             	test   %rax,%rax
+  802922:	7f 06                	jg     80292a <sys_env_set_trapframe+0x3c>
+}
+  802924:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802928:	c9                   	leave
+  802929:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80292a:	49 89 c0             	mov    %rax,%r8
+  80292d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802932:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802939:	00 00 00 
+  80293c:	be 27 00 00 00       	mov    $0x27,%esi
+  802941:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802948:	00 00 00 
+  80294b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802950:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802957:	00 00 00 
+  80295a:	41 ff d1             	call   *%r9
+
+000000000080295d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80295d:	55                   	push   %rbp
+  80295e:	48 89 e5             	mov    %rsp,%rbp
+  802961:	53                   	push   %rbx
+  802962:	48 83 ec 08          	sub    $0x8,%rsp
+  802966:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802969:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80296c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802971:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802976:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297b:	be 00 00 00 00       	mov    $0x0,%esi
+  802980:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802986:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80298c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80298e:	48 85 c0             	test   %rax,%rax
+  802991:	7f 06                	jg     802999 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802993:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802997:	c9                   	leave
+  802998:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802999:	49 89 c0             	mov    %rax,%r8
+  80299c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029a1:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8029a8:	00 00 00 
+  8029ab:	be 27 00 00 00       	mov    $0x27,%esi
+  8029b0:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  8029b7:	00 00 00 
+  8029ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bf:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  8029c6:	00 00 00 
+  8029c9:	41 ff d1             	call   *%r9
+
+00000000008029cc <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029cc:	55                   	push   %rbp
+  8029cd:	48 89 e5             	mov    %rsp,%rbp
+  8029d0:	53                   	push   %rbx
+  8029d1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029d5:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029dc:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029fe:	48 85 c0             	test   %rax,%rax
+  802a01:	7f 06                	jg     802a09 <sys_env_set_reclaim+0x3d>
+}
+  802a03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a07:	c9                   	leave
+  802a08:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a09:	49 89 c0             	mov    %rax,%r8
+  802a0c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a11:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802a18:	00 00 00 
+  802a1b:	be 27 00 00 00       	mov    $0x27,%esi
+  802a20:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802a27:	00 00 00 
+  802a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2f:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802a36:	00 00 00 
+  802a39:	41 ff d1             	call   *%r9
+
+0000000000802a3c <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a3c:	55                   	push   %rbp
+  802a3d:	48 89 e5             	mov    %rsp,%rbp
+  802a40:	53                   	push   %rbx
+  802a41:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a45:	48 63 ce             	movslq %esi,%rcx
+  802a48:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a4b:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a55:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a65:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a6b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a6d:	48 85 c0             	test   %rax,%rax
+  802a70:	7f 06                	jg     802a78 <sys_env_set_nice+0x3c>
+}
+  802a72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a76:	c9                   	leave
+  802a77:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a78:	49 89 c0             	mov    %rax,%r8
+  802a7b:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a80:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802a87:	00 00 00 
+  802a8a:	be 27 00 00 00       	mov    $0x27,%esi
+  802a8f:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802a96:	00 00 00 
+  802a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9e:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802aa5:	00 00 00 
+  802aa8:	41 ff d1             	call   *%r9
+
+0000000000802aab <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802aab:	55                   	push   %rbp
+  802aac:	48 89 e5             	mov    %rsp,%rbp
+  802aaf:	53                   	push   %rbx
+  802ab0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ab3:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ab8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802abd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac7:	be 00 00 00 00       	mov    $0x0,%esi
+  802acc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ad2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad8:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ada:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+0000000000802ae0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ae0:	55                   	push   %rbp
+  802ae1:	48 89 e5             	mov    %rsp,%rbp
+  802ae4:	53                   	push   %rbx
+  802ae5:	89 f8                	mov    %edi,%eax
+  802ae7:	49 89 f1             	mov    %rsi,%r9
+  802aea:	48 89 d3             	mov    %rdx,%rbx
+  802aed:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802af0:	49 63 f0             	movslq %r8d,%rsi
+  802af3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802af6:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802afb:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802afe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b04:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b0a:	cd 30                	int    $0x30
+}
+  802b0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b10:	c9                   	leave
+  802b11:	c3                   	ret
+
+0000000000802b12 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b12:	55                   	push   %rbp
+  802b13:	48 89 e5             	mov    %rsp,%rbp
+  802b16:	53                   	push   %rbx
+  802b17:	89 f8                	mov    %edi,%eax
+  802b19:	49 89 f1             	mov    %rsi,%r9
+  802b1c:	48 89 d3             	mov    %rdx,%rbx
+  802b1f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b22:	49 63 f0             	movslq %r8d,%rsi
+  802b25:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b28:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b2d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b36:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b3c:	cd 30                	int    $0x30
+}
+  802b3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b42:	c9                   	leave
+  802b43:	c3                   	ret
+
+0000000000802b44 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b44:	55                   	push   %rbp
+  802b45:	48 89 e5             	mov    %rsp,%rbp
+  802b48:	53                   	push   %rbx
+  802b49:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4d:	89 f8                	mov    %edi,%eax
+  802b4f:	49 89 f2             	mov    %rsi,%r10
+  802b52:	48 89 d3             	mov    %rdx,%rbx
+  802b55:	48 89 cf             	mov    %rcx,%rdi
+  802b58:	44 89 c6             	mov    %r8d,%esi
+  802b5b:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b5e:	48 63 f6             	movslq %esi,%rsi
+  802b61:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b64:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b69:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b6c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b70:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b72:	48 85 c0             	test   %rax,%rax
+  802b75:	7f 06                	jg     802b7d <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b7d:	49 89 c0             	mov    %rax,%r8
+  802b80:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b85:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802b8c:	00 00 00 
+  802b8f:	be 27 00 00 00       	mov    $0x27,%esi
+  802b94:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802b9b:	00 00 00 
+  802b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba3:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802baa:	00 00 00 
+  802bad:	41 ff d1             	call   *%r9
+
+0000000000802bb0 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bb0:	55                   	push   %rbp
+  802bb1:	48 89 e5             	mov    %rsp,%rbp
+  802bb4:	53                   	push   %rbx
+  802bb5:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb9:	48 89 f1             	mov    %rsi,%rcx
+  802bbc:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bbf:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bc3:	48 8b 1a             	mov    (%rdx),%rbx
+  802bc6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bce:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd2:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bd6:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bda:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bdc:	48 85 c0             	test   %rax,%rax
+  802bdf:	7f 06                	jg     802be7 <sys_ipc_call_short+0x37>
+}
+  802be1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be5:	c9                   	leave
+  802be6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802be7:	49 89 c0             	mov    %rax,%r8
+  802bea:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bef:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802bf6:	00 00 00 
+  802bf9:	be 27 00 00 00       	mov    $0x27,%esi
+  802bfe:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802c05:	00 00 00 
+  802c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0d:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802c14:	00 00 00 
+  802c17:	41 ff d1             	call   *%r9
+
+0000000000802c1a <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c1a:	55                   	push   %rbp
+  802c1b:	48 89 e5             	mov    %rsp,%rbp
+  802c1e:	53                   	push   %rbx
+  802c1f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c23:	89 f8                	mov    %edi,%eax
+  802c25:	49 89 f2             	mov    %rsi,%r10
+  802c28:	48 89 d3             	mov    %rdx,%rbx
+  802c2b:	48 89 cf             	mov    %rcx,%rdi
+  802c2e:	44 89 c6             	mov    %r8d,%esi
+  802c31:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c34:	48 63 f6             	movslq %esi,%rsi
+  802c37:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c3a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c3f:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c42:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c46:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c48:	48 85 c0             	test   %rax,%rax
+  802c4b:	7f 06                	jg     802c53 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c51:	c9                   	leave
+  802c52:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c53:	49 89 c0             	mov    %rax,%r8
+  802c56:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c5b:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802c62:	00 00 00 
+  802c65:	be 27 00 00 00       	mov    $0x27,%esi
+  802c6a:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802c71:	00 00 00 
+  802c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c79:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802c80:	00 00 00 
+  802c83:	41 ff d1             	call   *%r9
+
+0000000000802c86 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c86:	55                   	push   %rbp
+  802c87:	48 89 e5             	mov    %rsp,%rbp
+  802c8a:	53                   	push   %rbx
+  802c8b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c8f:	48 89 fa             	mov    %rdi,%rdx
+  802c92:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c95:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ca4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802caf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cb5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cb7:	48 85 c0             	test   %rax,%rax
+  802cba:	7f 06                	jg     802cc2 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc0:	c9                   	leave
+  802cc1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cc2:	49 89 c0             	mov    %rax,%r8
+  802cc5:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cca:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802cd1:	00 00 00 
+  802cd4:	be 27 00 00 00       	mov    $0x27,%esi
+  802cd9:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802ce0:	00 00 00 
+  802ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce8:	49 b9 8c 50 80 00 00 	movabs $0x80508c,%r9
+  802cef:	00 00 00 
+  802cf2:	41 ff d1             	call   *%r9
+
+0000000000802cf5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cf5:	55                   	push   %rbp
+  802cf6:	48 89 e5             	mov    %rsp,%rbp
+  802cf9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cfa:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d04:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d13:	be 00 00 00 00       	mov    $0x0,%esi
+  802d18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d24:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+
+0000000000802d2c <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d2c:	55                   	push   %rbp
+  802d2d:	48 89 e5             	mov    %rsp,%rbp
+  802d30:	53                   	push   %rbx
+  802d31:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d34:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d39:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d43:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d48:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d53:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d59:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d5b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d5f:	c9                   	leave
+  802d60:	c3                   	ret
+
+0000000000802d61 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d61:	55                   	push   %rbp
+  802d62:	48 89 e5             	mov    %rsp,%rbp
+  802d65:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d66:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d70:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d7f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d90:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+
+0000000000802d98 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d98:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d9f:	ff ff ff 
+  802da2:	48 01 f8             	add    %rdi,%rax
+  802da5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802da9:	c3                   	ret
+
+0000000000802daa <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802daa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802db1:	ff ff ff 
+  802db4:	48 01 f8             	add    %rdi,%rax
+  802db7:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802dbb:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dc1:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dc5:	c3                   	ret
+
+0000000000802dc6 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dc6:	55                   	push   %rbp
+  802dc7:	48 89 e5             	mov    %rsp,%rbp
+  802dca:	41 57                	push   %r15
+  802dcc:	41 56                	push   %r14
+  802dce:	41 55                	push   %r13
+  802dd0:	41 54                	push   %r12
+  802dd2:	53                   	push   %rbx
+  802dd3:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd7:	49 89 ff             	mov    %rdi,%r15
+  802dda:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802ddf:	49 bd c6 42 80 00 00 	movabs $0x8042c6,%r13
+  802de6:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802de9:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802def:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802df2:	48 89 df             	mov    %rbx,%rdi
+  802df5:	41 ff d5             	call   *%r13
+  802df8:	83 e0 04             	and    $0x4,%eax
+  802dfb:	74 17                	je     802e14 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802dfd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e04:	4c 39 f3             	cmp    %r14,%rbx
+  802e07:	75 e6                	jne    802def <fd_alloc+0x29>
+  802e09:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e0f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e14:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e17:	48 83 c4 08          	add    $0x8,%rsp
+  802e1b:	5b                   	pop    %rbx
+  802e1c:	41 5c                	pop    %r12
+  802e1e:	41 5d                	pop    %r13
+  802e20:	41 5e                	pop    %r14
+  802e22:	41 5f                	pop    %r15
+  802e24:	5d                   	pop    %rbp
+  802e25:	c3                   	ret
+
+0000000000802e26 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e26:	83 ff 1f             	cmp    $0x1f,%edi
+  802e29:	77 39                	ja     802e64 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e2b:	55                   	push   %rbp
+  802e2c:	48 89 e5             	mov    %rsp,%rbp
+  802e2f:	41 54                	push   %r12
+  802e31:	53                   	push   %rbx
+  802e32:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e35:	48 63 df             	movslq %edi,%rbx
+  802e38:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e3f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e43:	48 89 df             	mov    %rbx,%rdi
+  802e46:	48 b8 c6 42 80 00 00 	movabs $0x8042c6,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+  802e52:	a8 04                	test   $0x4,%al
+  802e54:	74 14                	je     802e6a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e56:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e5f:	5b                   	pop    %rbx
+  802e60:	41 5c                	pop    %r12
+  802e62:	5d                   	pop    %rbp
+  802e63:	c3                   	ret
+        return -E_INVAL;
+  802e64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e69:	c3                   	ret
+        return -E_INVAL;
+  802e6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e6f:	eb ee                	jmp    802e5f <fd_lookup+0x39>
+
+0000000000802e71 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e71:	55                   	push   %rbp
+  802e72:	48 89 e5             	mov    %rsp,%rbp
+  802e75:	41 54                	push   %r12
+  802e77:	53                   	push   %rbx
+  802e78:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e7b:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  802e82:	00 00 00 
+  802e85:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  802e8c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e8f:	39 3b                	cmp    %edi,(%rbx)
+  802e91:	74 47                	je     802eda <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e93:	48 83 c0 08          	add    $0x8,%rax
+  802e97:	48 8b 18             	mov    (%rax),%rbx
+  802e9a:	48 85 db             	test   %rbx,%rbx
+  802e9d:	75 f0                	jne    802e8f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e9f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ea6:	00 00 00 
+  802ea9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802eaf:	89 fa                	mov    %edi,%edx
+  802eb1:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  802eb8:	00 00 00 
+  802ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec0:	48 b9 9e 16 80 00 00 	movabs $0x80169e,%rcx
+  802ec7:	00 00 00 
+  802eca:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ecc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ed1:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ed5:	5b                   	pop    %rbx
+  802ed6:	41 5c                	pop    %r12
+  802ed8:	5d                   	pop    %rbp
+  802ed9:	c3                   	ret
+            return 0;
+  802eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edf:	eb f0                	jmp    802ed1 <dev_lookup+0x60>
+
+0000000000802ee1 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ee1:	55                   	push   %rbp
+  802ee2:	48 89 e5             	mov    %rsp,%rbp
+  802ee5:	41 55                	push   %r13
+  802ee7:	41 54                	push   %r12
+  802ee9:	53                   	push   %rbx
+  802eea:	48 83 ec 18          	sub    $0x18,%rsp
+  802eee:	48 89 fb             	mov    %rdi,%rbx
+  802ef1:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ef4:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802efb:	ff ff ff 
+  802efe:	48 01 df             	add    %rbx,%rdi
+  802f01:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f05:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f09:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+  802f15:	41 89 c5             	mov    %eax,%r13d
+  802f18:	85 c0                	test   %eax,%eax
+  802f1a:	78 06                	js     802f22 <fd_close+0x41>
+  802f1c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f20:	74 1a                	je     802f3c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f22:	45 84 e4             	test   %r12b,%r12b
+  802f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f2e:	44 89 e8             	mov    %r13d,%eax
+  802f31:	48 83 c4 18          	add    $0x18,%rsp
+  802f35:	5b                   	pop    %rbx
+  802f36:	41 5c                	pop    %r12
+  802f38:	41 5d                	pop    %r13
+  802f3a:	5d                   	pop    %rbp
+  802f3b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f3c:	8b 3b                	mov    (%rbx),%edi
+  802f3e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f42:	48 b8 71 2e 80 00 00 	movabs $0x802e71,%rax
+  802f49:	00 00 00 
+  802f4c:	ff d0                	call   *%rax
+  802f4e:	41 89 c5             	mov    %eax,%r13d
+  802f51:	85 c0                	test   %eax,%eax
+  802f53:	78 1b                	js     802f70 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f59:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f5d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f63:	48 85 c0             	test   %rax,%rax
+  802f66:	74 08                	je     802f70 <fd_close+0x8f>
+  802f68:	48 89 df             	mov    %rbx,%rdi
+  802f6b:	ff d0                	call   *%rax
+  802f6d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f75:	48 89 de             	mov    %rbx,%rsi
+  802f78:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7d:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802f84:	00 00 00 
+  802f87:	ff d0                	call   *%rax
+    return res;
+  802f89:	eb a3                	jmp    802f2e <fd_close+0x4d>
+
+0000000000802f8b <close>:
+
+int
+close(int fdnum) {
+  802f8b:	55                   	push   %rbp
+  802f8c:	48 89 e5             	mov    %rsp,%rbp
+  802f8f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f93:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f97:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  802f9e:	00 00 00 
+  802fa1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	78 15                	js     802fbc <close+0x31>
+
+    return fd_close(fd, 1);
+  802fa7:	be 01 00 00 00       	mov    $0x1,%esi
+  802fac:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb0:	48 b8 e1 2e 80 00 00 	movabs $0x802ee1,%rax
+  802fb7:	00 00 00 
+  802fba:	ff d0                	call   *%rax
+}
+  802fbc:	c9                   	leave
+  802fbd:	c3                   	ret
+
+0000000000802fbe <close_all>:
+
+void
+close_all(void) {
+  802fbe:	55                   	push   %rbp
+  802fbf:	48 89 e5             	mov    %rsp,%rbp
+  802fc2:	41 54                	push   %r12
+  802fc4:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fca:	49 bc 8b 2f 80 00 00 	movabs $0x802f8b,%r12
+  802fd1:	00 00 00 
+  802fd4:	89 df                	mov    %ebx,%edi
+  802fd6:	41 ff d4             	call   *%r12
+  802fd9:	83 c3 01             	add    $0x1,%ebx
+  802fdc:	83 fb 20             	cmp    $0x20,%ebx
+  802fdf:	75 f3                	jne    802fd4 <close_all+0x16>
+}
+  802fe1:	5b                   	pop    %rbx
+  802fe2:	41 5c                	pop    %r12
+  802fe4:	5d                   	pop    %rbp
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fe6:	55                   	push   %rbp
+  802fe7:	48 89 e5             	mov    %rsp,%rbp
+  802fea:	41 57                	push   %r15
+  802fec:	41 56                	push   %r14
+  802fee:	41 55                	push   %r13
+  802ff0:	41 54                	push   %r12
+  802ff2:	53                   	push   %rbx
+  802ff3:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff7:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802ffa:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ffe:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  803005:	00 00 00 
+  803008:	ff d0                	call   *%rax
+  80300a:	89 c3                	mov    %eax,%ebx
+  80300c:	85 c0                	test   %eax,%eax
+  80300e:	0f 88 b8 00 00 00    	js     8030cc <dup+0xe6>
+    close(newfdnum);
+  803014:	44 89 e7             	mov    %r12d,%edi
+  803017:	48 b8 8b 2f 80 00 00 	movabs $0x802f8b,%rax
+  80301e:	00 00 00 
+  803021:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803023:	4d 63 ec             	movslq %r12d,%r13
+  803026:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80302d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803031:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803035:	4c 89 ff             	mov    %r15,%rdi
+  803038:	49 be aa 2d 80 00 00 	movabs $0x802daa,%r14
+  80303f:	00 00 00 
+  803042:	41 ff d6             	call   *%r14
+  803045:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803048:	4c 89 ef             	mov    %r13,%rdi
+  80304b:	41 ff d6             	call   *%r14
+  80304e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803051:	48 89 df             	mov    %rbx,%rdi
+  803054:	48 b8 c6 42 80 00 00 	movabs $0x8042c6,%rax
+  80305b:	00 00 00 
+  80305e:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803060:	a8 04                	test   $0x4,%al
+  803062:	74 2b                	je     80308f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803064:	41 89 c1             	mov    %eax,%r9d
+  803067:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80306d:	4c 89 f1             	mov    %r14,%rcx
+  803070:	ba 00 00 00 00       	mov    $0x0,%edx
+  803075:	48 89 de             	mov    %rbx,%rsi
+  803078:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307d:	48 b8 a7 27 80 00 00 	movabs $0x8027a7,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+  803089:	89 c3                	mov    %eax,%ebx
+  80308b:	85 c0                	test   %eax,%eax
+  80308d:	78 4e                	js     8030dd <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80308f:	4c 89 ff             	mov    %r15,%rdi
+  803092:	48 b8 c6 42 80 00 00 	movabs $0x8042c6,%rax
+  803099:	00 00 00 
+  80309c:	ff d0                	call   *%rax
+  80309e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030a1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030a7:	4c 89 e9             	mov    %r13,%rcx
+  8030aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030af:	4c 89 fe             	mov    %r15,%rsi
+  8030b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b7:	48 b8 a7 27 80 00 00 	movabs $0x8027a7,%rax
+  8030be:	00 00 00 
+  8030c1:	ff d0                	call   *%rax
+  8030c3:	89 c3                	mov    %eax,%ebx
+  8030c5:	85 c0                	test   %eax,%eax
+  8030c7:	78 14                	js     8030dd <dup+0xf7>
+
+    return newfdnum;
+  8030c9:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030cc:	89 d8                	mov    %ebx,%eax
+  8030ce:	48 83 c4 18          	add    $0x18,%rsp
+  8030d2:	5b                   	pop    %rbx
+  8030d3:	41 5c                	pop    %r12
+  8030d5:	41 5d                	pop    %r13
+  8030d7:	41 5e                	pop    %r14
+  8030d9:	41 5f                	pop    %r15
+  8030db:	5d                   	pop    %rbp
+  8030dc:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e2:	4c 89 ee             	mov    %r13,%rsi
+  8030e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ea:	49 bc 12 28 80 00 00 	movabs $0x802812,%r12
+  8030f1:	00 00 00 
+  8030f4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030fc:	4c 89 f6             	mov    %r14,%rsi
+  8030ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  803104:	41 ff d4             	call   *%r12
+    return res;
+  803107:	eb c3                	jmp    8030cc <dup+0xe6>
+
+0000000000803109 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803109:	55                   	push   %rbp
+  80310a:	48 89 e5             	mov    %rsp,%rbp
+  80310d:	41 56                	push   %r14
+  80310f:	41 55                	push   %r13
+  803111:	41 54                	push   %r12
+  803113:	53                   	push   %rbx
+  803114:	48 83 ec 10          	sub    $0x10,%rsp
+  803118:	89 fb                	mov    %edi,%ebx
+  80311a:	49 89 f4             	mov    %rsi,%r12
+  80311d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803120:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803124:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  80312b:	00 00 00 
+  80312e:	ff d0                	call   *%rax
+  803130:	85 c0                	test   %eax,%eax
+  803132:	78 4c                	js     803180 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803134:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803138:	41 8b 3e             	mov    (%r14),%edi
+  80313b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80313f:	48 b8 71 2e 80 00 00 	movabs $0x802e71,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+  80314b:	85 c0                	test   %eax,%eax
+  80314d:	78 35                	js     803184 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80314f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803153:	83 e0 03             	and    $0x3,%eax
+  803156:	83 f8 01             	cmp    $0x1,%eax
+  803159:	74 2d                	je     803188 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80315b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80315f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803163:	48 85 c0             	test   %rax,%rax
+  803166:	74 56                	je     8031be <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803168:	4c 89 ea             	mov    %r13,%rdx
+  80316b:	4c 89 e6             	mov    %r12,%rsi
+  80316e:	4c 89 f7             	mov    %r14,%rdi
+  803171:	ff d0                	call   *%rax
+}
+  803173:	48 83 c4 10          	add    $0x10,%rsp
+  803177:	5b                   	pop    %rbx
+  803178:	41 5c                	pop    %r12
+  80317a:	41 5d                	pop    %r13
+  80317c:	41 5e                	pop    %r14
+  80317e:	5d                   	pop    %rbp
+  80317f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803180:	48 98                	cltq
+  803182:	eb ef                	jmp    803173 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803184:	48 98                	cltq
+  803186:	eb eb                	jmp    803173 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803188:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80318f:	00 00 00 
+  803192:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803198:	89 da                	mov    %ebx,%edx
+  80319a:	48 bf d9 61 80 00 00 	movabs $0x8061d9,%rdi
+  8031a1:	00 00 00 
+  8031a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a9:	48 b9 9e 16 80 00 00 	movabs $0x80169e,%rcx
+  8031b0:	00 00 00 
+  8031b3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031b5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031bc:	eb b5                	jmp    803173 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031be:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031c5:	eb ac                	jmp    803173 <read+0x6a>
+
+00000000008031c7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031c7:	55                   	push   %rbp
+  8031c8:	48 89 e5             	mov    %rsp,%rbp
+  8031cb:	41 57                	push   %r15
+  8031cd:	41 56                	push   %r14
+  8031cf:	41 55                	push   %r13
+  8031d1:	41 54                	push   %r12
+  8031d3:	53                   	push   %rbx
+  8031d4:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031d8:	48 85 d2             	test   %rdx,%rdx
+  8031db:	74 54                	je     803231 <readn+0x6a>
+  8031dd:	41 89 fd             	mov    %edi,%r13d
+  8031e0:	49 89 f6             	mov    %rsi,%r14
+  8031e3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031eb:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031f0:	49 bf 09 31 80 00 00 	movabs $0x803109,%r15
+  8031f7:	00 00 00 
+  8031fa:	4c 89 e2             	mov    %r12,%rdx
+  8031fd:	48 29 f2             	sub    %rsi,%rdx
+  803200:	4c 01 f6             	add    %r14,%rsi
+  803203:	44 89 ef             	mov    %r13d,%edi
+  803206:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803209:	85 c0                	test   %eax,%eax
+  80320b:	78 20                	js     80322d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80320d:	01 c3                	add    %eax,%ebx
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	74 08                	je     80321b <readn+0x54>
+  803213:	48 63 f3             	movslq %ebx,%rsi
+  803216:	4c 39 e6             	cmp    %r12,%rsi
+  803219:	72 df                	jb     8031fa <readn+0x33>
+    }
+    return res;
+  80321b:	48 63 c3             	movslq %ebx,%rax
+}
+  80321e:	48 83 c4 08          	add    $0x8,%rsp
+  803222:	5b                   	pop    %rbx
+  803223:	41 5c                	pop    %r12
+  803225:	41 5d                	pop    %r13
+  803227:	41 5e                	pop    %r14
+  803229:	41 5f                	pop    %r15
+  80322b:	5d                   	pop    %rbp
+  80322c:	c3                   	ret
+        if (inc < 0) return inc;
+  80322d:	48 98                	cltq
+  80322f:	eb ed                	jmp    80321e <readn+0x57>
+    int inc = 1, res = 0;
+  803231:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803236:	eb e3                	jmp    80321b <readn+0x54>
+
+0000000000803238 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803238:	55                   	push   %rbp
+  803239:	48 89 e5             	mov    %rsp,%rbp
+  80323c:	41 56                	push   %r14
+  80323e:	41 55                	push   %r13
+  803240:	41 54                	push   %r12
+  803242:	53                   	push   %rbx
+  803243:	48 83 ec 10          	sub    $0x10,%rsp
+  803247:	89 fb                	mov    %edi,%ebx
+  803249:	49 89 f4             	mov    %rsi,%r12
+  80324c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80324f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803253:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  80325a:	00 00 00 
+  80325d:	ff d0                	call   *%rax
+  80325f:	85 c0                	test   %eax,%eax
+  803261:	78 47                	js     8032aa <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803263:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803267:	41 8b 3e             	mov    (%r14),%edi
+  80326a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80326e:	48 b8 71 2e 80 00 00 	movabs $0x802e71,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+  80327a:	85 c0                	test   %eax,%eax
+  80327c:	78 30                	js     8032ae <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80327e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803283:	74 2d                	je     8032b2 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803285:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803289:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80328d:	48 85 c0             	test   %rax,%rax
+  803290:	74 56                	je     8032e8 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803292:	4c 89 ea             	mov    %r13,%rdx
+  803295:	4c 89 e6             	mov    %r12,%rsi
+  803298:	4c 89 f7             	mov    %r14,%rdi
+  80329b:	ff d0                	call   *%rax
+}
+  80329d:	48 83 c4 10          	add    $0x10,%rsp
+  8032a1:	5b                   	pop    %rbx
+  8032a2:	41 5c                	pop    %r12
+  8032a4:	41 5d                	pop    %r13
+  8032a6:	41 5e                	pop    %r14
+  8032a8:	5d                   	pop    %rbp
+  8032a9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032aa:	48 98                	cltq
+  8032ac:	eb ef                	jmp    80329d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032ae:	48 98                	cltq
+  8032b0:	eb eb                	jmp    80329d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032b2:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032b9:	00 00 00 
+  8032bc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032c2:	89 da                	mov    %ebx,%edx
+  8032c4:	48 bf f5 61 80 00 00 	movabs $0x8061f5,%rdi
+  8032cb:	00 00 00 
+  8032ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d3:	48 b9 9e 16 80 00 00 	movabs $0x80169e,%rcx
+  8032da:	00 00 00 
+  8032dd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032df:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032e6:	eb b5                	jmp    80329d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032e8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032ef:	eb ac                	jmp    80329d <write+0x65>
+
+00000000008032f1 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032f1:	55                   	push   %rbp
+  8032f2:	48 89 e5             	mov    %rsp,%rbp
+  8032f5:	53                   	push   %rbx
+  8032f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8032fa:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032fc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803300:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  803307:	00 00 00 
+  80330a:	ff d0                	call   *%rax
+  80330c:	85 c0                	test   %eax,%eax
+  80330e:	78 0c                	js     80331c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803314:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803317:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803320:	c9                   	leave
+  803321:	c3                   	ret
+
+0000000000803322 <tell>:
+
+int tell(int fdnum) {
+  803322:	55                   	push   %rbp
+  803323:	48 89 e5             	mov    %rsp,%rbp
+  803326:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80332a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80332e:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  803335:	00 00 00 
+  803338:	ff d0                	call   *%rax
+  80333a:	85 c0                	test   %eax,%eax
+  80333c:	78 07                	js     803345 <tell+0x23>
+
+    return fd->fd_offset;
+  80333e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803342:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803345:	c9                   	leave
+  803346:	c3                   	ret
+
+0000000000803347 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803347:	55                   	push   %rbp
+  803348:	48 89 e5             	mov    %rsp,%rbp
+  80334b:	41 55                	push   %r13
+  80334d:	41 54                	push   %r12
+  80334f:	53                   	push   %rbx
+  803350:	48 83 ec 18          	sub    $0x18,%rsp
+  803354:	89 fb                	mov    %edi,%ebx
+  803356:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803359:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80335d:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  803364:	00 00 00 
+  803367:	ff d0                	call   *%rax
+  803369:	85 c0                	test   %eax,%eax
+  80336b:	78 38                	js     8033a5 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80336d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803371:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803375:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803379:	48 b8 71 2e 80 00 00 	movabs $0x802e71,%rax
+  803380:	00 00 00 
+  803383:	ff d0                	call   *%rax
+  803385:	85 c0                	test   %eax,%eax
+  803387:	78 1c                	js     8033a5 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803389:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80338e:	74 20                	je     8033b0 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803390:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803394:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803398:	48 85 c0             	test   %rax,%rax
+  80339b:	74 47                	je     8033e4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80339d:	44 89 e6             	mov    %r12d,%esi
+  8033a0:	4c 89 ef             	mov    %r13,%rdi
+  8033a3:	ff d0                	call   *%rax
+}
+  8033a5:	48 83 c4 18          	add    $0x18,%rsp
+  8033a9:	5b                   	pop    %rbx
+  8033aa:	41 5c                	pop    %r12
+  8033ac:	41 5d                	pop    %r13
+  8033ae:	5d                   	pop    %rbp
+  8033af:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033b0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033b7:	00 00 00 
+  8033ba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033c0:	89 da                	mov    %ebx,%edx
+  8033c2:	48 bf b8 61 80 00 00 	movabs $0x8061b8,%rdi
+  8033c9:	00 00 00 
+  8033cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d1:	48 b9 9e 16 80 00 00 	movabs $0x80169e,%rcx
+  8033d8:	00 00 00 
+  8033db:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033e2:	eb c1                	jmp    8033a5 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033e4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033e9:	eb ba                	jmp    8033a5 <ftruncate+0x5e>
+
+00000000008033eb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033eb:	55                   	push   %rbp
+  8033ec:	48 89 e5             	mov    %rsp,%rbp
+  8033ef:	41 54                	push   %r12
+  8033f1:	53                   	push   %rbx
+  8033f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8033f6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033fd:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  803404:	00 00 00 
+  803407:	ff d0                	call   *%rax
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	78 63                	js     803470 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80340d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803411:	41 8b 3c 24          	mov    (%r12),%edi
+  803415:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803419:	48 b8 71 2e 80 00 00 	movabs $0x802e71,%rax
+  803420:	00 00 00 
+  803423:	ff d0                	call   *%rax
+  803425:	85 c0                	test   %eax,%eax
+  803427:	78 47                	js     803470 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803429:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80342d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803432:	74 45                	je     803479 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803434:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803437:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80343e:	00 00 00 
+    stat->st_isdir = 0;
+  803441:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803448:	00 00 00 
+    stat->st_ino = 0;
+  80344b:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803452:	00 00 00 00 
+    stat->st_version = 0;
+  803456:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80345d:	00 00 00 
+    stat->st_dev = dev;
+  803460:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803467:	48 89 de             	mov    %rbx,%rsi
+  80346a:	4c 89 e7             	mov    %r12,%rdi
+  80346d:	ff 50 28             	call   *0x28(%rax)
+}
+  803470:	48 83 c4 10          	add    $0x10,%rsp
+  803474:	5b                   	pop    %rbx
+  803475:	41 5c                	pop    %r12
+  803477:	5d                   	pop    %rbp
+  803478:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803479:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80347e:	eb f0                	jmp    803470 <fstat+0x85>
+
+0000000000803480 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803480:	55                   	push   %rbp
+  803481:	48 89 e5             	mov    %rsp,%rbp
+  803484:	41 54                	push   %r12
+  803486:	53                   	push   %rbx
+  803487:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80348a:	be 00 00 00 00       	mov    $0x0,%esi
+  80348f:	48 b8 a1 39 80 00 00 	movabs $0x8039a1,%rax
+  803496:	00 00 00 
+  803499:	ff d0                	call   *%rax
+  80349b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80349d:	85 c0                	test   %eax,%eax
+  80349f:	78 25                	js     8034c6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034a1:	4c 89 e6             	mov    %r12,%rsi
+  8034a4:	89 c7                	mov    %eax,%edi
+  8034a6:	48 b8 eb 33 80 00 00 	movabs $0x8033eb,%rax
+  8034ad:	00 00 00 
+  8034b0:	ff d0                	call   *%rax
+  8034b2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034b5:	89 df                	mov    %ebx,%edi
+  8034b7:	48 b8 8b 2f 80 00 00 	movabs $0x802f8b,%rax
+  8034be:	00 00 00 
+  8034c1:	ff d0                	call   *%rax
+
+    return res;
+  8034c3:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034c6:	89 d8                	mov    %ebx,%eax
+  8034c8:	5b                   	pop    %rbx
+  8034c9:	41 5c                	pop    %r12
+  8034cb:	5d                   	pop    %rbp
+  8034cc:	c3                   	ret
+
+00000000008034cd <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034cd:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034d4:	00 00 00 
+  8034d7:	83 38 00             	cmpl   $0x0,(%rax)
+  8034da:	74 0a                	je     8034e6 <fsipc_env+0x19>
+    return fsenv;
+}
+  8034dc:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034e3:	00 00 
+  8034e5:	c3                   	ret
+fsipc_env(void) {
+  8034e6:	55                   	push   %rbp
+  8034e7:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034ef:	48 b8 73 56 80 00 00 	movabs $0x805673,%rax
+  8034f6:	00 00 00 
+  8034f9:	ff d0                	call   *%rax
+  8034fb:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803502:	00 00 
+}
+  803504:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80350b:	00 00 
+  80350d:	5d                   	pop    %rbp
+  80350e:	c3                   	ret
+
+000000000080350f <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80350f:	55                   	push   %rbp
+  803510:	48 89 e5             	mov    %rsp,%rbp
+  803513:	53                   	push   %rbx
+  803514:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803518:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80351f:	00 
+  803520:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803527:	00 
+  803528:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80352f:	00 
+  803530:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803537:	00 
+  803538:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80353f:	00 
+
+    assert(size <= sizeof(words));
+  803540:	48 83 fa 28          	cmp    $0x28,%rdx
+  803544:	77 38                	ja     80357e <fsipc_short+0x6f>
+  803546:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803548:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80354c:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803558:	48 b8 cd 34 80 00 00 	movabs $0x8034cd,%rax
+  80355f:	00 00 00 
+  803562:	ff d0                	call   *%rax
+  803564:	89 c7                	mov    %eax,%edi
+  803566:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80356a:	89 de                	mov    %ebx,%esi
+  80356c:	48 b8 d6 55 80 00 00 	movabs $0x8055d6,%rax
+  803573:	00 00 00 
+  803576:	ff d0                	call   *%rax
+}
+  803578:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80357c:	c9                   	leave
+  80357d:	c3                   	ret
+    assert(size <= sizeof(words));
+  80357e:	48 b9 40 62 80 00 00 	movabs $0x806240,%rcx
+  803585:	00 00 00 
+  803588:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80358f:	00 00 00 
+  803592:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803597:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80359e:	00 00 00 
+  8035a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a6:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  8035ad:	00 00 00 
+  8035b0:	41 ff d0             	call   *%r8
+
+00000000008035b3 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035b3:	55                   	push   %rbp
+  8035b4:	48 89 e5             	mov    %rsp,%rbp
+  8035b7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035bb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035be:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035c1:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035c4:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035c9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035cd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035d2:	48 b8 0f 35 80 00 00 	movabs $0x80350f,%rax
+  8035d9:	00 00 00 
+  8035dc:	ff d0                	call   *%rax
+}
+  8035de:	c9                   	leave
+  8035df:	c3                   	ret
+
+00000000008035e0 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035e0:	55                   	push   %rbp
+  8035e1:	48 89 e5             	mov    %rsp,%rbp
+  8035e4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035e8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035ee:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035f3:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035f7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035fc:	48 b8 0f 35 80 00 00 	movabs $0x80350f,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+}
+  803608:	c9                   	leave
+  803609:	c3                   	ret
+
+000000000080360a <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80360a:	55                   	push   %rbp
+  80360b:	48 89 e5             	mov    %rsp,%rbp
+  80360e:	41 54                	push   %r12
+  803610:	53                   	push   %rbx
+  803611:	48 83 ec 10          	sub    $0x10,%rsp
+  803615:	89 fb                	mov    %edi,%ebx
+  803617:	49 89 f4             	mov    %rsi,%r12
+  80361a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80361e:	48 b8 cd 34 80 00 00 	movabs $0x8034cd,%rax
+  803625:	00 00 00 
+  803628:	ff d0                	call   *%rax
+  80362a:	89 c7                	mov    %eax,%edi
+  80362c:	6a 00                	push   $0x0
+  80362e:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803632:	50                   	push   %rax
+  803633:	4d 89 e1             	mov    %r12,%r9
+  803636:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80363c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803641:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803648:	00 00 00 
+  80364b:	89 de                	mov    %ebx,%esi
+  80364d:	48 b8 71 55 80 00 00 	movabs $0x805571,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+}
+  803659:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80365d:	5b                   	pop    %rbx
+  80365e:	41 5c                	pop    %r12
+  803660:	5d                   	pop    %rbp
+  803661:	c3                   	ret
+
+0000000000803662 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803662:	55                   	push   %rbp
+  803663:	48 89 e5             	mov    %rsp,%rbp
+  803666:	41 54                	push   %r12
+  803668:	53                   	push   %rbx
+  803669:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80366c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80366f:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803676:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803678:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80367d:	be 00 00 00 00       	mov    $0x0,%esi
+  803682:	bf 05 00 00 00       	mov    $0x5,%edi
+  803687:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  80368e:	00 00 00 
+  803691:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803693:	85 c0                	test   %eax,%eax
+  803695:	78 5a                	js     8036f1 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803697:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80369e:	00 00 00 
+  8036a1:	4c 89 e6             	mov    %r12,%rsi
+  8036a4:	48 89 df             	mov    %rbx,%rdi
+  8036a7:	48 b8 d5 1f 80 00 00 	movabs $0x801fd5,%rax
+  8036ae:	00 00 00 
+  8036b1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036b3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036ba:	00 
+  8036bb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036c1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036c8:	00 
+  8036c9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036cf:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036d6:	00 
+  8036d7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036de:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036e5:	00 
+  8036e6:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f1:	5b                   	pop    %rbx
+  8036f2:	41 5c                	pop    %r12
+  8036f4:	5d                   	pop    %rbp
+  8036f5:	c3                   	ret
+
+00000000008036f6 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036f6:	55                   	push   %rbp
+  8036f7:	48 89 e5             	mov    %rsp,%rbp
+  8036fa:	41 57                	push   %r15
+  8036fc:	41 56                	push   %r14
+  8036fe:	41 55                	push   %r13
+  803700:	41 54                	push   %r12
+  803702:	53                   	push   %rbx
+  803703:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803707:	48 85 ff             	test   %rdi,%rdi
+  80370a:	0f 84 a1 00 00 00    	je     8037b1 <devfile_read+0xbb>
+  803710:	49 89 ff             	mov    %rdi,%r15
+  803713:	49 89 f5             	mov    %rsi,%r13
+  803716:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803719:	48 85 f6             	test   %rsi,%rsi
+  80371c:	0f 84 c4 00 00 00    	je     8037e6 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803722:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803729:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80372a:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803731:	00 00 00 
+  803734:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803738:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80373b:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80373f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803744:	be 00 00 00 00       	mov    $0x0,%esi
+  803749:	bf 03 00 00 00       	mov    $0x3,%edi
+  80374e:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  803755:	00 00 00 
+  803758:	ff d0                	call   *%rax
+        if (res < 0) {
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	0f 88 b9 00 00 00    	js     80381b <devfile_read+0x125>
+        assert(res <= n);
+  803762:	48 63 d8             	movslq %eax,%rbx
+  803765:	49 39 dc             	cmp    %rbx,%r12
+  803768:	0f 82 b1 00 00 00    	jb     80381f <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80376e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803773:	0f 87 db 00 00 00    	ja     803854 <devfile_read+0x15e>
+        if (!res) {
+  803779:	85 c0                	test   %eax,%eax
+  80377b:	74 21                	je     80379e <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80377d:	48 89 da             	mov    %rbx,%rdx
+  803780:	4c 89 f6             	mov    %r14,%rsi
+  803783:	4c 89 ef             	mov    %r13,%rdi
+  803786:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+        total_read += res;
+  803792:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803796:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803799:	49 29 dc             	sub    %rbx,%r12
+  80379c:	75 96                	jne    803734 <devfile_read+0x3e>
+    return total_read;
+  80379e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037a2:	48 83 c4 18          	add    $0x18,%rsp
+  8037a6:	5b                   	pop    %rbx
+  8037a7:	41 5c                	pop    %r12
+  8037a9:	41 5d                	pop    %r13
+  8037ab:	41 5e                	pop    %r14
+  8037ad:	41 5f                	pop    %r15
+  8037af:	5d                   	pop    %rbp
+  8037b0:	c3                   	ret
+    assert(fd);
+  8037b1:	48 b9 76 62 80 00 00 	movabs $0x806276,%rcx
+  8037b8:	00 00 00 
+  8037bb:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8037c2:	00 00 00 
+  8037c5:	be 91 00 00 00       	mov    $0x91,%esi
+  8037ca:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  8037d1:	00 00 00 
+  8037d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d9:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  8037e0:	00 00 00 
+  8037e3:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037e6:	48 b9 79 62 80 00 00 	movabs $0x806279,%rcx
+  8037ed:	00 00 00 
+  8037f0:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8037f7:	00 00 00 
+  8037fa:	be 92 00 00 00       	mov    $0x92,%esi
+  8037ff:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  803806:	00 00 00 
+  803809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380e:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  803815:	00 00 00 
+  803818:	41 ff d0             	call   *%r8
+            return res;
+  80381b:	48 98                	cltq
+  80381d:	eb 83                	jmp    8037a2 <devfile_read+0xac>
+        assert(res <= n);
+  80381f:	48 b9 7d 62 80 00 00 	movabs $0x80627d,%rcx
+  803826:	00 00 00 
+  803829:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803830:	00 00 00 
+  803833:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803838:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80383f:	00 00 00 
+  803842:	b8 00 00 00 00       	mov    $0x0,%eax
+  803847:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  80384e:	00 00 00 
+  803851:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803854:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  80385b:	00 00 00 
+  80385e:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803865:	00 00 00 
+  803868:	be 9f 00 00 00       	mov    $0x9f,%esi
+  80386d:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  803874:	00 00 00 
+  803877:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387c:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  803883:	00 00 00 
+  803886:	41 ff d0             	call   *%r8
+
+0000000000803889 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803889:	55                   	push   %rbp
+  80388a:	48 89 e5             	mov    %rsp,%rbp
+  80388d:	41 57                	push   %r15
+  80388f:	41 56                	push   %r14
+  803891:	41 55                	push   %r13
+  803893:	41 54                	push   %r12
+  803895:	53                   	push   %rbx
+  803896:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  80389a:	48 85 ff             	test   %rdi,%rdi
+  80389d:	0f 84 83 00 00 00    	je     803926 <devfile_write+0x9d>
+  8038a3:	49 89 ff             	mov    %rdi,%r15
+  8038a6:	49 89 f4             	mov    %rsi,%r12
+  8038a9:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038ac:	48 85 f6             	test   %rsi,%rsi
+  8038af:	0f 84 a6 00 00 00    	je     80395b <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038b5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038bb:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038c2:	00 00 00 
+  8038c5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038c9:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038cc:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038d0:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038d5:	48 39 d3             	cmp    %rdx,%rbx
+  8038d8:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038dc:	4c 89 e6             	mov    %r12,%rsi
+  8038df:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038e6:	00 00 00 
+  8038e9:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  8038f0:	00 00 00 
+  8038f3:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ff:	bf 04 00 00 00       	mov    $0x4,%edi
+  803904:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  80390b:	00 00 00 
+  80390e:	ff d0                	call   *%rax
+        if (res < 0) {
+  803910:	85 c0                	test   %eax,%eax
+  803912:	78 7c                	js     803990 <devfile_write+0x107>
+        total_written += res;
+  803914:	48 98                	cltq
+  803916:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803919:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  80391c:	48 29 c3             	sub    %rax,%rbx
+  80391f:	75 a4                	jne    8038c5 <devfile_write+0x3c>
+    return total_written;
+  803921:	4c 89 e8             	mov    %r13,%rax
+  803924:	eb 6c                	jmp    803992 <devfile_write+0x109>
+    assert(fd);
+  803926:	48 b9 76 62 80 00 00 	movabs $0x806276,%rcx
+  80392d:	00 00 00 
+  803930:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803937:	00 00 00 
+  80393a:	be bd 00 00 00       	mov    $0xbd,%esi
+  80393f:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  803946:	00 00 00 
+  803949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394e:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  803955:	00 00 00 
+  803958:	41 ff d0             	call   *%r8
+    assert(buf);
+  80395b:	48 b9 79 62 80 00 00 	movabs $0x806279,%rcx
+  803962:	00 00 00 
+  803965:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80396c:	00 00 00 
+  80396f:	be be 00 00 00       	mov    $0xbe,%esi
+  803974:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80397b:	00 00 00 
+  80397e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803983:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  80398a:	00 00 00 
+  80398d:	41 ff d0             	call   *%r8
+            return res;
+  803990:	48 98                	cltq
+}
+  803992:	48 83 c4 08          	add    $0x8,%rsp
+  803996:	5b                   	pop    %rbx
+  803997:	41 5c                	pop    %r12
+  803999:	41 5d                	pop    %r13
+  80399b:	41 5e                	pop    %r14
+  80399d:	41 5f                	pop    %r15
+  80399f:	5d                   	pop    %rbp
+  8039a0:	c3                   	ret
+
+00000000008039a1 <open>:
+open(const char *path, int mode) {
+  8039a1:	55                   	push   %rbp
+  8039a2:	48 89 e5             	mov    %rsp,%rbp
+  8039a5:	41 55                	push   %r13
+  8039a7:	41 54                	push   %r12
+  8039a9:	53                   	push   %rbx
+  8039aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ae:	49 89 fc             	mov    %rdi,%r12
+  8039b1:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039b4:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  8039bb:	00 00 00 
+  8039be:	ff d0                	call   *%rax
+  8039c0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039c6:	0f 87 8f 00 00 00    	ja     803a5b <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039cc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039d0:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+  8039dc:	89 c3                	mov    %eax,%ebx
+  8039de:	85 c0                	test   %eax,%eax
+  8039e0:	78 55                	js     803a37 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039e2:	4c 89 e6             	mov    %r12,%rsi
+  8039e5:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039ec:	00 00 00 
+  8039ef:	48 89 df             	mov    %rbx,%rdi
+  8039f2:	48 b8 d5 1f 80 00 00 	movabs $0x801fd5,%rax
+  8039f9:	00 00 00 
+  8039fc:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039fe:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a0a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a13:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  803a1a:	00 00 00 
+  803a1d:	ff d0                	call   *%rax
+  803a1f:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a21:	85 c0                	test   %eax,%eax
+  803a23:	78 1f                	js     803a44 <open+0xa3>
+    return fd2num(fd);
+  803a25:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a29:	48 b8 98 2d 80 00 00 	movabs $0x802d98,%rax
+  803a30:	00 00 00 
+  803a33:	ff d0                	call   *%rax
+  803a35:	89 c3                	mov    %eax,%ebx
+}
+  803a37:	89 d8                	mov    %ebx,%eax
+  803a39:	48 83 c4 18          	add    $0x18,%rsp
+  803a3d:	5b                   	pop    %rbx
+  803a3e:	41 5c                	pop    %r12
+  803a40:	41 5d                	pop    %r13
+  803a42:	5d                   	pop    %rbp
+  803a43:	c3                   	ret
+        fd_close(fd, 0);
+  803a44:	be 00 00 00 00       	mov    $0x0,%esi
+  803a49:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a4d:	48 b8 e1 2e 80 00 00 	movabs $0x802ee1,%rax
+  803a54:	00 00 00 
+  803a57:	ff d0                	call   *%rax
+        return res;
+  803a59:	eb dc                	jmp    803a37 <open+0x96>
+        return -E_BAD_PATH;
+  803a5b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a60:	eb d5                	jmp    803a37 <open+0x96>
+
+0000000000803a62 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a62:	55                   	push   %rbp
+  803a63:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a6b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a70:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a75:	48 b8 0f 35 80 00 00 	movabs $0x80350f,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+}
+  803a81:	5d                   	pop    %rbp
+  803a82:	c3                   	ret
+
+0000000000803a83 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a83:	55                   	push   %rbp
+  803a84:	48 89 e5             	mov    %rsp,%rbp
+  803a87:	41 56                	push   %r14
+  803a89:	41 55                	push   %r13
+  803a8b:	41 54                	push   %r12
+  803a8d:	53                   	push   %rbx
+  803a8e:	48 83 ec 10          	sub    $0x10,%rsp
+  803a92:	41 89 f6             	mov    %esi,%r14d
+  803a95:	49 89 d4             	mov    %rdx,%r12
+  803a98:	48 89 cb             	mov    %rcx,%rbx
+  803a9b:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a9e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aa2:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  803aa9:	00 00 00 
+  803aac:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803aae:	85 c0                	test   %eax,%eax
+  803ab0:	78 46                	js     803af8 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ab2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ab6:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803abd:	00 00 00 
+  803ac0:	8b 00                	mov    (%rax),%eax
+  803ac2:	39 02                	cmp    %eax,(%rdx)
+  803ac4:	75 3f                	jne    803b05 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803ac6:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803acd:	00 00 00 
+  803ad0:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ad3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ad5:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ad9:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803add:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ae1:	48 89 da             	mov    %rbx,%rdx
+  803ae4:	4c 89 e6             	mov    %r12,%rsi
+  803ae7:	bf 09 00 00 00       	mov    $0x9,%edi
+  803aec:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  803af3:	00 00 00 
+  803af6:	ff d0                	call   *%rax
+}
+  803af8:	48 83 c4 10          	add    $0x10,%rsp
+  803afc:	5b                   	pop    %rbx
+  803afd:	41 5c                	pop    %r12
+  803aff:	41 5d                	pop    %r13
+  803b01:	41 5e                	pop    %r14
+  803b03:	5d                   	pop    %rbp
+  803b04:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b05:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b0a:	eb ec                	jmp    803af8 <file_map+0x75>
+
+0000000000803b0c <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b0c:	55                   	push   %rbp
+  803b0d:	48 89 e5             	mov    %rsp,%rbp
+  803b10:	41 54                	push   %r12
+  803b12:	53                   	push   %rbx
+  803b13:	48 83 ec 20          	sub    $0x20,%rsp
+  803b17:	41 89 f4             	mov    %esi,%r12d
+  803b1a:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b1d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b21:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  803b28:	00 00 00 
+  803b2b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b2d:	85 c0                	test   %eax,%eax
+  803b2f:	78 3c                	js     803b6d <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b35:	48 ba 60 70 80 00 00 	movabs $0x807060,%rdx
+  803b3c:	00 00 00 
+  803b3f:	8b 0a                	mov    (%rdx),%ecx
+  803b41:	39 08                	cmp    %ecx,(%rax)
+  803b43:	75 31                	jne    803b76 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b45:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b48:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b4b:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b4f:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b53:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b58:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b5c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b61:	48 b8 0f 35 80 00 00 	movabs $0x80350f,%rax
+  803b68:	00 00 00 
+  803b6b:	ff d0                	call   *%rax
+}
+  803b6d:	48 83 c4 20          	add    $0x20,%rsp
+  803b71:	5b                   	pop    %rbx
+  803b72:	41 5c                	pop    %r12
+  803b74:	5d                   	pop    %rbp
+  803b75:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b76:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b7b:	eb f0                	jmp    803b6d <file_msync+0x61>
+
+0000000000803b7d <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b7d:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b81:	7f 01                	jg     803b84 <writebuf+0x7>
+  803b83:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b84:	55                   	push   %rbp
+  803b85:	48 89 e5             	mov    %rsp,%rbp
+  803b88:	53                   	push   %rbx
+  803b89:	48 83 ec 08          	sub    $0x8,%rsp
+  803b8d:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b90:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b94:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b98:	8b 3f                	mov    (%rdi),%edi
+  803b9a:	48 b8 38 32 80 00 00 	movabs $0x803238,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803ba6:	48 85 c0             	test   %rax,%rax
+  803ba9:	7e 04                	jle    803baf <writebuf+0x32>
+  803bab:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803baf:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bb3:	48 39 c2             	cmp    %rax,%rdx
+  803bb6:	74 0f                	je     803bc7 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bb8:	48 85 c0             	test   %rax,%rax
+  803bbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc0:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bc4:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bc7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bcb:	c9                   	leave
+  803bcc:	c3                   	ret
+
+0000000000803bcd <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bcd:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bd0:	8d 50 01             	lea    0x1(%rax),%edx
+  803bd3:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bd6:	48 98                	cltq
+  803bd8:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bdd:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803be3:	74 01                	je     803be6 <putch+0x19>
+  803be5:	c3                   	ret
+putch(int ch, void *arg) {
+  803be6:	55                   	push   %rbp
+  803be7:	48 89 e5             	mov    %rsp,%rbp
+  803bea:	53                   	push   %rbx
+  803beb:	48 83 ec 08          	sub    $0x8,%rsp
+  803bef:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bf2:	48 89 f7             	mov    %rsi,%rdi
+  803bf5:	48 b8 7d 3b 80 00 00 	movabs $0x803b7d,%rax
+  803bfc:	00 00 00 
+  803bff:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c01:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c0c:	c9                   	leave
+  803c0d:	c3                   	ret
+
+0000000000803c0e <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c0e:	55                   	push   %rbp
+  803c0f:	48 89 e5             	mov    %rsp,%rbp
+  803c12:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c19:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c1c:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c22:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c29:	00 00 00 
+    state.result = 0;
+  803c2c:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c33:	00 00 00 00 
+    state.error = 1;
+  803c37:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c3e:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c41:	48 89 f2             	mov    %rsi,%rdx
+  803c44:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c4b:	48 bf cd 3b 80 00 00 	movabs $0x803bcd,%rdi
+  803c52:	00 00 00 
+  803c55:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  803c5c:	00 00 00 
+  803c5f:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c61:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c68:	7f 14                	jg     803c7e <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c6a:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c71:	48 85 c0             	test   %rax,%rax
+  803c74:	75 06                	jne    803c7c <vfprintf+0x6e>
+  803c76:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c7c:	c9                   	leave
+  803c7d:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c7e:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c85:	48 b8 7d 3b 80 00 00 	movabs $0x803b7d,%rax
+  803c8c:	00 00 00 
+  803c8f:	ff d0                	call   *%rax
+  803c91:	eb d7                	jmp    803c6a <vfprintf+0x5c>
+
+0000000000803c93 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c93:	55                   	push   %rbp
+  803c94:	48 89 e5             	mov    %rsp,%rbp
+  803c97:	48 83 ec 50          	sub    $0x50,%rsp
+  803c9b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c9f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ca3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ca7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cab:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cb2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cba:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cbe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cc2:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cc6:	48 b8 0e 3c 80 00 00 	movabs $0x803c0e,%rax
+  803ccd:	00 00 00 
+  803cd0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cd2:	c9                   	leave
+  803cd3:	c3                   	ret
+
+0000000000803cd4 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cd4:	55                   	push   %rbp
+  803cd5:	48 89 e5             	mov    %rsp,%rbp
+  803cd8:	48 83 ec 50          	sub    $0x50,%rsp
+  803cdc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ce0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ce4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ce8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cf0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cf7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d03:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d07:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d0b:	48 89 fe             	mov    %rdi,%rsi
+  803d0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d13:	48 b8 0e 3c 80 00 00 	movabs $0x803c0e,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d1f:	c9                   	leave
+  803d20:	c3                   	ret
+
+0000000000803d21 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d21:	55                   	push   %rbp
+  803d22:	48 89 e5             	mov    %rsp,%rbp
+  803d25:	41 54                	push   %r12
+  803d27:	53                   	push   %rbx
+  803d28:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d2b:	48 b8 aa 2d 80 00 00 	movabs $0x802daa,%rax
+  803d32:	00 00 00 
+  803d35:	ff d0                	call   *%rax
+  803d37:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d3a:	48 be b0 62 80 00 00 	movabs $0x8062b0,%rsi
+  803d41:	00 00 00 
+  803d44:	48 89 df             	mov    %rbx,%rdi
+  803d47:	48 b8 d5 1f 80 00 00 	movabs $0x801fd5,%rax
+  803d4e:	00 00 00 
+  803d51:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d53:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d58:	41 2b 04 24          	sub    (%r12),%eax
+  803d5c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d62:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d69:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d6c:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  803d73:	00 00 00 
+  803d76:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d82:	5b                   	pop    %rbx
+  803d83:	41 5c                	pop    %r12
+  803d85:	5d                   	pop    %rbp
+  803d86:	c3                   	ret
+
+0000000000803d87 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d87:	55                   	push   %rbp
+  803d88:	48 89 e5             	mov    %rsp,%rbp
+  803d8b:	41 54                	push   %r12
+  803d8d:	53                   	push   %rbx
+  803d8e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d96:	48 89 fe             	mov    %rdi,%rsi
+  803d99:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d9e:	49 bc 12 28 80 00 00 	movabs $0x802812,%r12
+  803da5:	00 00 00 
+  803da8:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803dab:	48 89 df             	mov    %rbx,%rdi
+  803dae:	48 b8 aa 2d 80 00 00 	movabs $0x802daa,%rax
+  803db5:	00 00 00 
+  803db8:	ff d0                	call   *%rax
+  803dba:	48 89 c6             	mov    %rax,%rsi
+  803dbd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc7:	41 ff d4             	call   *%r12
+}
+  803dca:	5b                   	pop    %rbx
+  803dcb:	41 5c                	pop    %r12
+  803dcd:	5d                   	pop    %rbp
+  803dce:	c3                   	ret
+
+0000000000803dcf <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dcf:	55                   	push   %rbp
+  803dd0:	48 89 e5             	mov    %rsp,%rbp
+  803dd3:	41 57                	push   %r15
+  803dd5:	41 56                	push   %r14
+  803dd7:	41 55                	push   %r13
+  803dd9:	41 54                	push   %r12
+  803ddb:	53                   	push   %rbx
+  803ddc:	48 83 ec 18          	sub    $0x18,%rsp
+  803de0:	49 89 fc             	mov    %rdi,%r12
+  803de3:	49 89 f5             	mov    %rsi,%r13
+  803de6:	49 89 d7             	mov    %rdx,%r15
+  803de9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ded:	48 b8 aa 2d 80 00 00 	movabs $0x802daa,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803df9:	4d 85 ff             	test   %r15,%r15
+  803dfc:	0f 84 af 00 00 00    	je     803eb1 <devpipe_write+0xe2>
+  803e02:	48 89 c3             	mov    %rax,%rbx
+  803e05:	4c 89 f8             	mov    %r15,%rax
+  803e08:	4d 89 ef             	mov    %r13,%r15
+  803e0b:	4c 01 e8             	add    %r13,%rax
+  803e0e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e12:	49 bd 08 27 80 00 00 	movabs $0x802708,%r13
+  803e19:	00 00 00 
+            sys_yield();
+  803e1c:	49 be 99 26 80 00 00 	movabs $0x802699,%r14
+  803e23:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e26:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e29:	48 63 ce             	movslq %esi,%rcx
+  803e2c:	48 63 03             	movslq (%rbx),%rax
+  803e2f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e35:	48 39 c1             	cmp    %rax,%rcx
+  803e38:	72 2e                	jb     803e68 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e3a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e3f:	48 89 da             	mov    %rbx,%rdx
+  803e42:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e47:	4c 89 e7             	mov    %r12,%rdi
+  803e4a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e4d:	85 c0                	test   %eax,%eax
+  803e4f:	74 66                	je     803eb7 <devpipe_write+0xe8>
+            sys_yield();
+  803e51:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e54:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e57:	48 63 ce             	movslq %esi,%rcx
+  803e5a:	48 63 03             	movslq (%rbx),%rax
+  803e5d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e63:	48 39 c1             	cmp    %rax,%rcx
+  803e66:	73 d2                	jae    803e3a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e68:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e6c:	48 89 ca             	mov    %rcx,%rdx
+  803e6f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e73:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e7a:	08 10 20 
+  803e7d:	48 f7 e2             	mul    %rdx
+  803e80:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e84:	48 89 d0             	mov    %rdx,%rax
+  803e87:	48 c1 e0 09          	shl    $0x9,%rax
+  803e8b:	48 29 d0             	sub    %rdx,%rax
+  803e8e:	48 c1 e0 03          	shl    $0x3,%rax
+  803e92:	48 29 c1             	sub    %rax,%rcx
+  803e95:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e9a:	83 c6 01             	add    $0x1,%esi
+  803e9d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ea0:	49 83 c7 01          	add    $0x1,%r15
+  803ea4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ea8:	49 39 c7             	cmp    %rax,%r15
+  803eab:	0f 85 75 ff ff ff    	jne    803e26 <devpipe_write+0x57>
+    return n;
+  803eb1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eb5:	eb 05                	jmp    803ebc <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ebc:	48 83 c4 18          	add    $0x18,%rsp
+  803ec0:	5b                   	pop    %rbx
+  803ec1:	41 5c                	pop    %r12
+  803ec3:	41 5d                	pop    %r13
+  803ec5:	41 5e                	pop    %r14
+  803ec7:	41 5f                	pop    %r15
+  803ec9:	5d                   	pop    %rbp
+  803eca:	c3                   	ret
+
+0000000000803ecb <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ecb:	55                   	push   %rbp
+  803ecc:	48 89 e5             	mov    %rsp,%rbp
+  803ecf:	41 57                	push   %r15
+  803ed1:	41 56                	push   %r14
+  803ed3:	41 55                	push   %r13
+  803ed5:	41 54                	push   %r12
+  803ed7:	53                   	push   %rbx
+  803ed8:	48 83 ec 18          	sub    $0x18,%rsp
+  803edc:	49 89 fc             	mov    %rdi,%r12
+  803edf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ee3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ee7:	48 b8 aa 2d 80 00 00 	movabs $0x802daa,%rax
+  803eee:	00 00 00 
+  803ef1:	ff d0                	call   *%rax
+  803ef3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ef6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803efc:	49 bd 08 27 80 00 00 	movabs $0x802708,%r13
+  803f03:	00 00 00 
+            sys_yield();
+  803f06:	49 be 99 26 80 00 00 	movabs $0x802699,%r14
+  803f0d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f10:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f15:	74 7d                	je     803f94 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f17:	8b 03                	mov    (%rbx),%eax
+  803f19:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f1c:	75 26                	jne    803f44 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f1e:	4d 85 ff             	test   %r15,%r15
+  803f21:	75 77                	jne    803f9a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f23:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f28:	48 89 da             	mov    %rbx,%rdx
+  803f2b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f30:	4c 89 e7             	mov    %r12,%rdi
+  803f33:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f36:	85 c0                	test   %eax,%eax
+  803f38:	74 72                	je     803fac <devpipe_read+0xe1>
+            sys_yield();
+  803f3a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f3d:	8b 03                	mov    (%rbx),%eax
+  803f3f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f42:	74 df                	je     803f23 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f44:	48 63 c8             	movslq %eax,%rcx
+  803f47:	48 89 ca             	mov    %rcx,%rdx
+  803f4a:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f4e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f55:	08 10 20 
+  803f58:	48 89 d0             	mov    %rdx,%rax
+  803f5b:	48 f7 e6             	mul    %rsi
+  803f5e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f62:	48 89 d0             	mov    %rdx,%rax
+  803f65:	48 c1 e0 09          	shl    $0x9,%rax
+  803f69:	48 29 d0             	sub    %rdx,%rax
+  803f6c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f73:	00 
+  803f74:	48 89 c8             	mov    %rcx,%rax
+  803f77:	48 29 d0             	sub    %rdx,%rax
+  803f7a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f7f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f83:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f87:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f8a:	49 83 c7 01          	add    $0x1,%r15
+  803f8e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f92:	75 83                	jne    803f17 <devpipe_read+0x4c>
+    return n;
+  803f94:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f98:	eb 03                	jmp    803f9d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f9a:	4c 89 f8             	mov    %r15,%rax
+}
+  803f9d:	48 83 c4 18          	add    $0x18,%rsp
+  803fa1:	5b                   	pop    %rbx
+  803fa2:	41 5c                	pop    %r12
+  803fa4:	41 5d                	pop    %r13
+  803fa6:	41 5e                	pop    %r14
+  803fa8:	41 5f                	pop    %r15
+  803faa:	5d                   	pop    %rbp
+  803fab:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb1:	eb ea                	jmp    803f9d <devpipe_read+0xd2>
+
+0000000000803fb3 <pipe>:
+pipe(int pfd[2]) {
+  803fb3:	55                   	push   %rbp
+  803fb4:	48 89 e5             	mov    %rsp,%rbp
+  803fb7:	41 55                	push   %r13
+  803fb9:	41 54                	push   %r12
+  803fbb:	53                   	push   %rbx
+  803fbc:	48 83 ec 18          	sub    $0x18,%rsp
+  803fc0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fc3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fc7:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+  803fd3:	89 c3                	mov    %eax,%ebx
+  803fd5:	85 c0                	test   %eax,%eax
+  803fd7:	0f 88 a0 01 00 00    	js     80417d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fdd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fe2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803feb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff0:	48 b8 3a 27 80 00 00 	movabs $0x80273a,%rax
+  803ff7:	00 00 00 
+  803ffa:	ff d0                	call   *%rax
+  803ffc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	0f 88 77 01 00 00    	js     80417d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804006:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80400a:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  804011:	00 00 00 
+  804014:	ff d0                	call   *%rax
+  804016:	89 c3                	mov    %eax,%ebx
+  804018:	85 c0                	test   %eax,%eax
+  80401a:	0f 88 43 01 00 00    	js     804163 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804020:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804025:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80402a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80402e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804033:	48 b8 3a 27 80 00 00 	movabs $0x80273a,%rax
+  80403a:	00 00 00 
+  80403d:	ff d0                	call   *%rax
+  80403f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804041:	85 c0                	test   %eax,%eax
+  804043:	0f 88 1a 01 00 00    	js     804163 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804049:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80404d:	48 b8 aa 2d 80 00 00 	movabs $0x802daa,%rax
+  804054:	00 00 00 
+  804057:	ff d0                	call   *%rax
+  804059:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80405c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804061:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804066:	48 89 c6             	mov    %rax,%rsi
+  804069:	bf 00 00 00 00       	mov    $0x0,%edi
+  80406e:	48 b8 3a 27 80 00 00 	movabs $0x80273a,%rax
+  804075:	00 00 00 
+  804078:	ff d0                	call   *%rax
+  80407a:	89 c3                	mov    %eax,%ebx
+  80407c:	85 c0                	test   %eax,%eax
+  80407e:	0f 88 c5 00 00 00    	js     804149 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804084:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804088:	48 b8 aa 2d 80 00 00 	movabs $0x802daa,%rax
+  80408f:	00 00 00 
+  804092:	ff d0                	call   *%rax
+  804094:	48 89 c1             	mov    %rax,%rcx
+  804097:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80409d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a8:	4c 89 ee             	mov    %r13,%rsi
+  8040ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b0:	48 b8 a7 27 80 00 00 	movabs $0x8027a7,%rax
+  8040b7:	00 00 00 
+  8040ba:	ff d0                	call   *%rax
+  8040bc:	89 c3                	mov    %eax,%ebx
+  8040be:	85 c0                	test   %eax,%eax
+  8040c0:	78 6e                	js     804130 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040c2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040c7:	4c 89 ef             	mov    %r13,%rdi
+  8040ca:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  8040d1:	00 00 00 
+  8040d4:	ff d0                	call   *%rax
+  8040d6:	83 f8 02             	cmp    $0x2,%eax
+  8040d9:	0f 85 ab 00 00 00    	jne    80418a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040df:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  8040e6:	00 00 
+  8040e8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040ec:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040ee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040fd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804103:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80410a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80410e:	48 bb 98 2d 80 00 00 	movabs $0x802d98,%rbx
+  804115:	00 00 00 
+  804118:	ff d3                	call   *%rbx
+  80411a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80411e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804122:	ff d3                	call   *%rbx
+  804124:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804129:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80412e:	eb 4d                	jmp    80417d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804130:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804135:	4c 89 ee             	mov    %r13,%rsi
+  804138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413d:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  804144:	00 00 00 
+  804147:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804149:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80414e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804152:	bf 00 00 00 00       	mov    $0x0,%edi
+  804157:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  80415e:	00 00 00 
+  804161:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804163:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804168:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80416c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804171:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  804178:	00 00 00 
+  80417b:	ff d0                	call   *%rax
+}
+  80417d:	89 d8                	mov    %ebx,%eax
+  80417f:	48 83 c4 18          	add    $0x18,%rsp
+  804183:	5b                   	pop    %rbx
+  804184:	41 5c                	pop    %r12
+  804186:	41 5d                	pop    %r13
+  804188:	5d                   	pop    %rbp
+  804189:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80418a:	48 b9 c8 62 80 00 00 	movabs $0x8062c8,%rcx
+  804191:	00 00 00 
+  804194:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80419b:	00 00 00 
+  80419e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041a3:	48 bf b7 62 80 00 00 	movabs $0x8062b7,%rdi
+  8041aa:	00 00 00 
+  8041ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b2:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  8041b9:	00 00 00 
+  8041bc:	41 ff d0             	call   *%r8
+
+00000000008041bf <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041bf:	55                   	push   %rbp
+  8041c0:	48 89 e5             	mov    %rsp,%rbp
+  8041c3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041c7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041cb:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  8041d2:	00 00 00 
+  8041d5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041d7:	85 c0                	test   %eax,%eax
+  8041d9:	78 35                	js     804210 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041db:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041df:	48 b8 aa 2d 80 00 00 	movabs $0x802daa,%rax
+  8041e6:	00 00 00 
+  8041e9:	ff d0                	call   *%rax
+  8041eb:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041ee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041f3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041f8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041fc:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  804203:	00 00 00 
+  804206:	ff d0                	call   *%rax
+  804208:	85 c0                	test   %eax,%eax
+  80420a:	0f 94 c0             	sete   %al
+  80420d:	0f b6 c0             	movzbl %al,%eax
+}
+  804210:	c9                   	leave
+  804211:	c3                   	ret
+
+0000000000804212 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804212:	48 89 f8             	mov    %rdi,%rax
+  804215:	48 c1 e8 27          	shr    $0x27,%rax
+  804219:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804220:	01 00 00 
+  804223:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804227:	f6 c2 01             	test   $0x1,%dl
+  80422a:	74 6d                	je     804299 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80422c:	48 89 f8             	mov    %rdi,%rax
+  80422f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804233:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80423a:	01 00 00 
+  80423d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804241:	f6 c2 01             	test   $0x1,%dl
+  804244:	74 62                	je     8042a8 <get_uvpt_entry+0x96>
+  804246:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80424d:	01 00 00 
+  804250:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804254:	f6 c2 80             	test   $0x80,%dl
+  804257:	75 4f                	jne    8042a8 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804259:	48 89 f8             	mov    %rdi,%rax
+  80425c:	48 c1 e8 15          	shr    $0x15,%rax
+  804260:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804267:	01 00 00 
+  80426a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80426e:	f6 c2 01             	test   $0x1,%dl
+  804271:	74 44                	je     8042b7 <get_uvpt_entry+0xa5>
+  804273:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80427a:	01 00 00 
+  80427d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804281:	f6 c2 80             	test   $0x80,%dl
+  804284:	75 31                	jne    8042b7 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804286:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80428a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804291:	01 00 00 
+  804294:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804298:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804299:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042a0:	01 00 00 
+  8042a3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042a7:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042a8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042af:	01 00 00 
+  8042b2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042b6:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042b7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042be:	01 00 00 
+  8042c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042c5:	c3                   	ret
+
+00000000008042c6 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042c6:	55                   	push   %rbp
+  8042c7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042ca:	48 b8 12 42 80 00 00 	movabs $0x804212,%rax
+  8042d1:	00 00 00 
+  8042d4:	ff d0                	call   *%rax
+  8042d6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042d9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042de:	89 c1                	mov    %eax,%ecx
+  8042e0:	83 c9 04             	or     $0x4,%ecx
+  8042e3:	f6 c2 01             	test   $0x1,%dl
+  8042e6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042e9:	89 c1                	mov    %eax,%ecx
+  8042eb:	83 c9 02             	or     $0x2,%ecx
+  8042ee:	f6 c2 02             	test   $0x2,%dl
+  8042f1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042f4:	89 c1                	mov    %eax,%ecx
+  8042f6:	83 c9 01             	or     $0x1,%ecx
+  8042f9:	48 85 d2             	test   %rdx,%rdx
+  8042fc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042ff:	89 c1                	mov    %eax,%ecx
+  804301:	83 c9 40             	or     $0x40,%ecx
+  804304:	f6 c6 04             	test   $0x4,%dh
+  804307:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80430a:	5d                   	pop    %rbp
+  80430b:	c3                   	ret
+
+000000000080430c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80430c:	55                   	push   %rbp
+  80430d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804310:	48 b8 12 42 80 00 00 	movabs $0x804212,%rax
+  804317:	00 00 00 
+  80431a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80431c:	48 c1 e8 06          	shr    $0x6,%rax
+  804320:	83 e0 01             	and    $0x1,%eax
+}
+  804323:	5d                   	pop    %rbp
+  804324:	c3                   	ret
+
+0000000000804325 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804325:	55                   	push   %rbp
+  804326:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804329:	48 b8 12 42 80 00 00 	movabs $0x804212,%rax
+  804330:	00 00 00 
+  804333:	ff d0                	call   *%rax
+  804335:	83 e0 01             	and    $0x1,%eax
+}
+  804338:	5d                   	pop    %rbp
+  804339:	c3                   	ret
+
+000000000080433a <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80433a:	55                   	push   %rbp
+  80433b:	48 89 e5             	mov    %rsp,%rbp
+  80433e:	41 57                	push   %r15
+  804340:	41 56                	push   %r14
+  804342:	41 55                	push   %r13
+  804344:	41 54                	push   %r12
+  804346:	53                   	push   %rbx
+  804347:	48 83 ec 28          	sub    $0x28,%rsp
+  80434b:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80434f:	48 85 ff             	test   %rdi,%rdi
+  804352:	74 1e                	je     804372 <foreach_shared_region+0x38>
+  804354:	49 89 ff             	mov    %rdi,%r15
+  804357:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80435d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804363:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80436a:	01 00 00 
+  80436d:	e9 72 02 00 00       	jmp    8045e4 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804372:	48 b9 ec 62 80 00 00 	movabs $0x8062ec,%rcx
+  804379:	00 00 00 
+  80437c:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  804383:	00 00 00 
+  804386:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80438b:	48 bf f0 62 80 00 00 	movabs $0x8062f0,%rdi
+  804392:	00 00 00 
+  804395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439a:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  8043a1:	00 00 00 
+  8043a4:	41 ff d0             	call   *%r8
+  8043a7:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043ae:	eb 6c                	jmp    80441c <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043b0:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043b7:	ff ff ff 
+  8043ba:	4c 21 e2             	and    %r12,%rdx
+  8043bd:	48 89 d8             	mov    %rbx,%rax
+  8043c0:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043c5:	48 83 c0 01          	add    $0x1,%rax
+  8043c9:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043cd:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043d4:	00 00 00 
+  8043d7:	48 21 c8             	and    %rcx,%rax
+  8043da:	48 09 d0             	or     %rdx,%rax
+  8043dd:	49 89 c4             	mov    %rax,%r12
+  8043e0:	eb 30                	jmp    804412 <foreach_shared_region+0xd8>
+  8043e2:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043e9:	ff ff ff 
+  8043ec:	4c 21 e2             	and    %r12,%rdx
+  8043ef:	48 89 d8             	mov    %rbx,%rax
+  8043f2:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043f7:	48 83 c0 01          	add    $0x1,%rax
+  8043fb:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043ff:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804406:	00 00 00 
+  804409:	48 21 c8             	and    %rcx,%rax
+  80440c:	48 09 d0             	or     %rdx,%rax
+  80440f:	49 89 c4             	mov    %rax,%r12
+  804412:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804416:	0f 84 99 01 00 00    	je     8045b5 <foreach_shared_region+0x27b>
+  80441c:	4c 89 e3             	mov    %r12,%rbx
+  80441f:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804423:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80442a:	01 00 00 
+  80442d:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804431:	a8 01                	test   $0x1,%al
+  804433:	0f 84 77 ff ff ff    	je     8043b0 <foreach_shared_region+0x76>
+  804439:	a8 80                	test   $0x80,%al
+  80443b:	74 19                	je     804456 <foreach_shared_region+0x11c>
+  80443d:	f6 c4 04             	test   $0x4,%ah
+  804440:	74 a0                	je     8043e2 <foreach_shared_region+0xa8>
+  804442:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804449:	40 
+  80444a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80444e:	4c 89 e7             	mov    %r12,%rdi
+  804451:	41 ff d7             	call   *%r15
+  804454:	eb 8c                	jmp    8043e2 <foreach_shared_region+0xa8>
+  804456:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80445d:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804461:	eb 46                	jmp    8044a9 <foreach_shared_region+0x16f>
+  804463:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80446a:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804470:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804474:	48 c1 e0 15          	shl    $0x15,%rax
+  804478:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80447d:	49 09 c4             	or     %rax,%r12
+  804480:	eb 1d                	jmp    80449f <foreach_shared_region+0x165>
+  804482:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804489:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80448f:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804493:	48 c1 e0 15          	shl    $0x15,%rax
+  804497:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80449c:	49 09 c4             	or     %rax,%r12
+  80449f:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044a3:	0f 84 d3 00 00 00    	je     80457c <foreach_shared_region+0x242>
+  8044a9:	4c 89 e3             	mov    %r12,%rbx
+  8044ac:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044b0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044b7:	01 00 00 
+  8044ba:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044be:	a8 01                	test   $0x1,%al
+  8044c0:	74 a1                	je     804463 <foreach_shared_region+0x129>
+  8044c2:	a8 80                	test   $0x80,%al
+  8044c4:	74 19                	je     8044df <foreach_shared_region+0x1a5>
+  8044c6:	f6 c4 04             	test   $0x4,%ah
+  8044c9:	74 b7                	je     804482 <foreach_shared_region+0x148>
+  8044cb:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044d2:	00 
+  8044d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044d7:	4c 89 e7             	mov    %r12,%rdi
+  8044da:	41 ff d7             	call   *%r15
+  8044dd:	eb a3                	jmp    804482 <foreach_shared_region+0x148>
+  8044df:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044e5:	eb 3b                	jmp    804522 <foreach_shared_region+0x1e8>
+  8044e7:	f6 c4 04             	test   $0x4,%ah
+  8044ea:	74 12                	je     8044fe <foreach_shared_region+0x1c4>
+  8044ec:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044f3:	00 
+  8044f4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044f8:	4c 89 e7             	mov    %r12,%rdi
+  8044fb:	41 ff d7             	call   *%r15
+  8044fe:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804505:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80450b:	48 83 c3 01          	add    $0x1,%rbx
+  80450f:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804513:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804519:	49 09 dc             	or     %rbx,%r12
+  80451c:	41 83 ed 01          	sub    $0x1,%r13d
+  804520:	74 2f                	je     804551 <foreach_shared_region+0x217>
+  804522:	4c 89 e3             	mov    %r12,%rbx
+  804525:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804529:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80452d:	a8 01                	test   $0x1,%al
+  80452f:	75 b6                	jne    8044e7 <foreach_shared_region+0x1ad>
+  804531:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804538:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80453e:	48 83 c3 01          	add    $0x1,%rbx
+  804542:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804546:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80454c:	49 09 dc             	or     %rbx,%r12
+  80454f:	eb cb                	jmp    80451c <foreach_shared_region+0x1e2>
+  804551:	4c 89 e0             	mov    %r12,%rax
+  804554:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80455a:	49 c1 ec 15          	shr    $0x15,%r12
+  80455e:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804565:	49 83 c4 01          	add    $0x1,%r12
+  804569:	49 c1 e4 15          	shl    $0x15,%r12
+  80456d:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804574:	49 09 c4             	or     %rax,%r12
+  804577:	e9 23 ff ff ff       	jmp    80449f <foreach_shared_region+0x165>
+  80457c:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804580:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804587:	ff ff ff 
+  80458a:	4c 21 e0             	and    %r12,%rax
+  80458d:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804591:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804598:	49 83 c4 01          	add    $0x1,%r12
+  80459c:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045a0:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045a7:	00 00 00 
+  8045aa:	49 21 d4             	and    %rdx,%r12
+  8045ad:	49 09 c4             	or     %rax,%r12
+  8045b0:	e9 5d fe ff ff       	jmp    804412 <foreach_shared_region+0xd8>
+  8045b5:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045bc:	00 ff ff 
+  8045bf:	4c 21 e0             	and    %r12,%rax
+  8045c2:	49 c1 ec 27          	shr    $0x27,%r12
+  8045c6:	49 83 c4 01          	add    $0x1,%r12
+  8045ca:	49 c1 e4 27          	shl    $0x27,%r12
+  8045ce:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045d5:	ff 00 00 
+  8045d8:	49 21 d4             	and    %rdx,%r12
+  8045db:	49 09 c4             	or     %rax,%r12
+  8045de:	41 83 ed 01          	sub    $0x1,%r13d
+  8045e2:	74 48                	je     80462c <foreach_shared_region+0x2f2>
+  8045e4:	4c 89 e0             	mov    %r12,%rax
+  8045e7:	48 c1 e8 27          	shr    $0x27,%rax
+  8045eb:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045f2:	01 00 00 
+  8045f5:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045f9:	f6 c2 01             	test   $0x1,%dl
+  8045fc:	0f 85 a5 fd ff ff    	jne    8043a7 <foreach_shared_region+0x6d>
+  804602:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804609:	00 ff ff 
+  80460c:	4c 21 e2             	and    %r12,%rdx
+  80460f:	48 83 c0 01          	add    $0x1,%rax
+  804613:	48 c1 e0 27          	shl    $0x27,%rax
+  804617:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80461e:	ff 00 00 
+  804621:	48 21 c8             	and    %rcx,%rax
+  804624:	48 09 d0             	or     %rdx,%rax
+  804627:	49 89 c4             	mov    %rax,%r12
+  80462a:	eb b2                	jmp    8045de <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80462c:	4d 85 e4             	test   %r12,%r12
+  80462f:	75 14                	jne    804645 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804631:	b8 00 00 00 00       	mov    $0x0,%eax
+  804636:	48 83 c4 28          	add    $0x28,%rsp
+  80463a:	5b                   	pop    %rbx
+  80463b:	41 5c                	pop    %r12
+  80463d:	41 5d                	pop    %r13
+  80463f:	41 5e                	pop    %r14
+  804641:	41 5f                	pop    %r15
+  804643:	5d                   	pop    %rbp
+  804644:	c3                   	ret
+    assert(addr == 0);
+  804645:	48 b9 fb 62 80 00 00 	movabs $0x8062fb,%rcx
+  80464c:	00 00 00 
+  80464f:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  804656:	00 00 00 
+  804659:	be 67 00 00 00       	mov    $0x67,%esi
+  80465e:	48 bf f0 62 80 00 00 	movabs $0x8062f0,%rdi
+  804665:	00 00 00 
+  804668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80466d:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  804674:	00 00 00 
+  804677:	41 ff d0             	call   *%r8
+
+000000000080467a <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80467a:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804681:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804684:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80468a:	eb 33                	jmp    8046bf <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80468c:	48 83 c0 20          	add    $0x20,%rax
+  804690:	4c 39 c0             	cmp    %r8,%rax
+  804693:	74 25                	je     8046ba <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804695:	48 8b 10             	mov    (%rax),%rdx
+  804698:	48 85 d2             	test   %rdx,%rdx
+  80469b:	74 ef                	je     80468c <mmap_place+0x12>
+  80469d:	48 89 d1             	mov    %rdx,%rcx
+  8046a0:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046a4:	48 39 cf             	cmp    %rcx,%rdi
+  8046a7:	73 e3                	jae    80468c <mmap_place+0x12>
+  8046a9:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046ad:	4c 39 ca             	cmp    %r9,%rdx
+  8046b0:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046b4:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046b8:	eb d2                	jmp    80468c <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046ba:	45 84 d2             	test   %r10b,%r10b
+  8046bd:	74 12                	je     8046d1 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046bf:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046c6:	00 00 00 
+        moved = 0;
+  8046c9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046cf:	eb c4                	jmp    804695 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046d1:	48 01 fe             	add    %rdi,%rsi
+  8046d4:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046db:	00 00 00 
+  8046de:	48 39 f0             	cmp    %rsi,%rax
+  8046e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e6:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046ea:	c3                   	ret
+
+00000000008046eb <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046eb:	55                   	push   %rbp
+  8046ec:	48 89 e5             	mov    %rsp,%rbp
+  8046ef:	41 57                	push   %r15
+  8046f1:	41 56                	push   %r14
+  8046f3:	41 55                	push   %r13
+  8046f5:	41 54                	push   %r12
+  8046f7:	53                   	push   %rbx
+  8046f8:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046fc:	48 8b 1f             	mov    (%rdi),%rbx
+  8046ff:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804706:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80470d:	00 00 00 
+  804710:	ba 00 00 00 00       	mov    $0x0,%edx
+  804715:	eb 12                	jmp    804729 <mmap_pgfault+0x3e>
+  804717:	48 83 c2 01          	add    $0x1,%rdx
+  80471b:	48 83 c0 20          	add    $0x20,%rax
+  80471f:	48 83 fa 20          	cmp    $0x20,%rdx
+  804723:	0f 84 04 01 00 00    	je     80482d <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804729:	48 8b 08             	mov    (%rax),%rcx
+  80472c:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804730:	48 39 de             	cmp    %rbx,%rsi
+  804733:	73 e2                	jae    804717 <mmap_pgfault+0x2c>
+  804735:	48 03 48 08          	add    0x8(%rax),%rcx
+  804739:	48 39 cb             	cmp    %rcx,%rbx
+  80473c:	73 d9                	jae    804717 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80473e:	48 c1 e2 05          	shl    $0x5,%rdx
+  804742:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804749:	00 00 00 
+  80474c:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804750:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804754:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804758:	f6 c2 01             	test   $0x1,%dl
+  80475b:	0f 84 e0 00 00 00    	je     804841 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804761:	b8 00 00 00 00       	mov    $0x0,%eax
+  804766:	f6 c2 02             	test   $0x2,%dl
+  804769:	0f 84 c3 00 00 00    	je     804832 <mmap_pgfault+0x147>
+  80476f:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804776:	ff ff ff 
+  804779:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80477d:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804784:	00 00 00 
+  804787:	48 39 ca             	cmp    %rcx,%rdx
+  80478a:	0f 85 a2 00 00 00    	jne    804832 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804790:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804795:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80479a:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047a1:	00 00 00 
+  8047a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047a9:	48 b8 3a 27 80 00 00 	movabs $0x80273a,%rax
+  8047b0:	00 00 00 
+  8047b3:	ff d0                	call   *%rax
+  8047b5:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047bc:	85 d2                	test   %edx,%edx
+  8047be:	78 72                	js     804832 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c5:	48 89 de             	mov    %rbx,%rsi
+  8047c8:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047cf:	00 00 00 
+  8047d2:	4c 89 e7             	mov    %r12,%rdi
+  8047d5:	48 b8 8c 23 80 00 00 	movabs $0x80238c,%rax
+  8047dc:	00 00 00 
+  8047df:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047e1:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047e7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047ed:	48 89 d9             	mov    %rbx,%rcx
+  8047f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047f5:	4c 89 e6             	mov    %r12,%rsi
+  8047f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047fd:	48 b8 a7 27 80 00 00 	movabs $0x8027a7,%rax
+  804804:	00 00 00 
+  804807:	ff d0                	call   *%rax
+  804809:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  80480b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804810:	4c 89 e6             	mov    %r12,%rsi
+  804813:	bf 00 00 00 00       	mov    $0x0,%edi
+  804818:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  80481f:	00 00 00 
+  804822:	ff d0                	call   *%rax
+    return res >= 0;
+  804824:	89 d8                	mov    %ebx,%eax
+  804826:	f7 d0                	not    %eax
+  804828:	c1 e8 1f             	shr    $0x1f,%eax
+  80482b:	eb 05                	jmp    804832 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80482d:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804832:	48 83 c4 18          	add    $0x18,%rsp
+  804836:	5b                   	pop    %rbx
+  804837:	41 5c                	pop    %r12
+  804839:	41 5d                	pop    %r13
+  80483b:	41 5e                	pop    %r14
+  80483d:	41 5f                	pop    %r15
+  80483f:	5d                   	pop    %rbp
+  804840:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804841:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804845:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804849:	4c 03 30             	add    (%rax),%r14
+  80484c:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804853:	49 39 c6             	cmp    %rax,%r14
+  804856:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80485a:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804861:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804867:	49 bf 25 43 80 00 00 	movabs $0x804325,%r15
+  80486e:	00 00 00 
+  804871:	4d 39 f4             	cmp    %r14,%r12
+  804874:	73 1d                	jae    804893 <mmap_pgfault+0x1a8>
+  804876:	4c 89 e7             	mov    %r12,%rdi
+  804879:	41 ff d7             	call   *%r15
+  80487c:	84 c0                	test   %al,%al
+  80487e:	75 13                	jne    804893 <mmap_pgfault+0x1a8>
+  804880:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804887:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80488e:	4d 39 f4             	cmp    %r14,%r12
+  804891:	72 e3                	jb     804876 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804893:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804899:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80489d:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048a1:	74 2a                	je     8048cd <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a7:	89 de                	mov    %ebx,%esi
+  8048a9:	2b 30                	sub    (%rax),%esi
+  8048ab:	03 70 1c             	add    0x1c(%rax),%esi
+  8048ae:	8b 78 18             	mov    0x18(%rax),%edi
+  8048b1:	4c 89 e9             	mov    %r13,%rcx
+  8048b4:	48 89 da             	mov    %rbx,%rdx
+  8048b7:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  8048be:	00 00 00 
+  8048c1:	ff d0                	call   *%rax
+    return res > 0;
+  8048c3:	85 c0                	test   %eax,%eax
+  8048c5:	0f 9f c0             	setg   %al
+  8048c8:	e9 65 ff ff ff       	jmp    804832 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048cd:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048d1:	eb d0                	jmp    8048a3 <mmap_pgfault+0x1b8>
+
+00000000008048d3 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048d3:	55                   	push   %rbp
+  8048d4:	48 89 e5             	mov    %rsp,%rbp
+  8048d7:	41 57                	push   %r15
+  8048d9:	41 56                	push   %r14
+  8048db:	41 55                	push   %r13
+  8048dd:	41 54                	push   %r12
+  8048df:	53                   	push   %rbx
+  8048e0:	48 83 ec 28          	sub    $0x28,%rsp
+  8048e4:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048e8:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048eb:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048f2:	ff ff ff 
+  8048f5:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048fe:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804905:	00 00 00 
+  804908:	48 39 ca             	cmp    %rcx,%rdx
+  80490b:	0f 85 e5 00 00 00    	jne    8049f6 <mmap_writeback+0x123>
+  804911:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804914:	4c 39 ee             	cmp    %r13,%rsi
+  804917:	0f 83 e8 00 00 00    	jae    804a05 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80491d:	49 be 25 43 80 00 00 	movabs $0x804325,%r14
+  804924:	00 00 00 
+  804927:	49 bf 0c 43 80 00 00 	movabs $0x80430c,%r15
+  80492e:	00 00 00 
+  804931:	eb 10                	jmp    804943 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804933:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80493a:	4d 39 ec             	cmp    %r13,%r12
+  80493d:	0f 83 ae 00 00 00    	jae    8049f1 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804943:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804947:	4c 89 e7             	mov    %r12,%rdi
+  80494a:	41 ff d6             	call   *%r14
+  80494d:	84 c0                	test   %al,%al
+  80494f:	74 e2                	je     804933 <mmap_writeback+0x60>
+  804951:	4c 89 e7             	mov    %r12,%rdi
+  804954:	41 ff d7             	call   *%r15
+  804957:	84 c0                	test   %al,%al
+  804959:	74 d8                	je     804933 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80495b:	4c 89 e3             	mov    %r12,%rbx
+  80495e:	4d 39 ec             	cmp    %r13,%r12
+  804961:	73 20                	jae    804983 <mmap_writeback+0xb0>
+  804963:	48 89 df             	mov    %rbx,%rdi
+  804966:	41 ff d6             	call   *%r14
+  804969:	84 c0                	test   %al,%al
+  80496b:	74 16                	je     804983 <mmap_writeback+0xb0>
+  80496d:	48 89 df             	mov    %rbx,%rdi
+  804970:	41 ff d7             	call   *%r15
+  804973:	84 c0                	test   %al,%al
+  804975:	74 0c                	je     804983 <mmap_writeback+0xb0>
+  804977:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80497e:	4c 39 eb             	cmp    %r13,%rbx
+  804981:	72 e0                	jb     804963 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804983:	48 89 d9             	mov    %rbx,%rcx
+  804986:	4c 29 e1             	sub    %r12,%rcx
+  804989:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80498d:	44 89 e6             	mov    %r12d,%esi
+  804990:	2b 30                	sub    (%rax),%esi
+  804992:	49 89 c4             	mov    %rax,%r12
+  804995:	03 70 1c             	add    0x1c(%rax),%esi
+  804998:	8b 78 18             	mov    0x18(%rax),%edi
+  80499b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80499f:	48 89 ca             	mov    %rcx,%rdx
+  8049a2:	48 b8 0c 3b 80 00 00 	movabs $0x803b0c,%rax
+  8049a9:	00 00 00 
+  8049ac:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049ae:	85 c0                	test   %eax,%eax
+  8049b0:	78 44                	js     8049f6 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049b2:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049b7:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049ba:	41 89 c1             	mov    %eax,%r9d
+  8049bd:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049c4:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049c8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d1:	48 89 ce             	mov    %rcx,%rsi
+  8049d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049d9:	48 b8 a7 27 80 00 00 	movabs $0x8027a7,%rax
+  8049e0:	00 00 00 
+  8049e3:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049e5:	85 c0                	test   %eax,%eax
+  8049e7:	78 0d                	js     8049f6 <mmap_writeback+0x123>
+  8049e9:	49 89 dc             	mov    %rbx,%r12
+  8049ec:	e9 49 ff ff ff       	jmp    80493a <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049f6:	48 83 c4 28          	add    $0x28,%rsp
+  8049fa:	5b                   	pop    %rbx
+  8049fb:	41 5c                	pop    %r12
+  8049fd:	41 5d                	pop    %r13
+  8049ff:	41 5e                	pop    %r14
+  804a01:	41 5f                	pop    %r15
+  804a03:	5d                   	pop    %rbp
+  804a04:	c3                   	ret
+    return 0;
+  804a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a0a:	eb ea                	jmp    8049f6 <mmap_writeback+0x123>
+
+0000000000804a0c <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a0c:	55                   	push   %rbp
+  804a0d:	48 89 e5             	mov    %rsp,%rbp
+  804a10:	41 57                	push   %r15
+  804a12:	41 56                	push   %r14
+  804a14:	41 55                	push   %r13
+  804a16:	41 54                	push   %r12
+  804a18:	53                   	push   %rbx
+  804a19:	48 83 ec 38          	sub    $0x38,%rsp
+  804a1d:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a21:	48 85 f6             	test   %rsi,%rsi
+  804a24:	0f 84 0c 02 00 00    	je     804c36 <mmap+0x22a>
+  804a2a:	49 89 ff             	mov    %rdi,%r15
+  804a2d:	49 89 f4             	mov    %rsi,%r12
+  804a30:	41 89 d5             	mov    %edx,%r13d
+  804a33:	41 89 ce             	mov    %ecx,%r14d
+  804a36:	44 89 cb             	mov    %r9d,%ebx
+  804a39:	45 85 c9             	test   %r9d,%r9d
+  804a3c:	0f 88 f4 01 00 00    	js     804c36 <mmap+0x22a>
+  804a42:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a49:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a50:	0f 85 e7 01 00 00    	jne    804c3d <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a56:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a59:	83 fa 04             	cmp    $0x4,%edx
+  804a5c:	0f 85 db 01 00 00    	jne    804c3d <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a62:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a65:	83 fa 01             	cmp    $0x1,%edx
+  804a68:	0f 87 cf 01 00 00    	ja     804c3d <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a6e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a72:	44 89 c7             	mov    %r8d,%edi
+  804a75:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  804a7c:	00 00 00 
+  804a7f:	ff d0                	call   *%rax
+  804a81:	89 c2                	mov    %eax,%edx
+  804a83:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a8a:	85 d2                	test   %edx,%edx
+  804a8c:	0f 88 ab 01 00 00    	js     804c3d <mmap+0x231>
+  804a92:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a96:	48 b9 60 70 80 00 00 	movabs $0x807060,%rcx
+  804a9d:	00 00 00 
+  804aa0:	8b 09                	mov    (%rcx),%ecx
+  804aa2:	39 0a                	cmp    %ecx,(%rdx)
+  804aa4:	0f 85 93 01 00 00    	jne    804c3d <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804aaa:	8b 52 08             	mov    0x8(%rdx),%edx
+  804aad:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ab0:	83 fa 01             	cmp    $0x1,%edx
+  804ab3:	0f 84 84 01 00 00    	je     804c3d <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ab9:	41 83 fe 01          	cmp    $0x1,%r14d
+  804abd:	74 42                	je     804b01 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804abf:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804ac6:	4c 89 e6             	mov    %r12,%rsi
+  804ac9:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ad0:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ad4:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ad8:	4d 85 ff             	test   %r15,%r15
+  804adb:	74 67                	je     804b44 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804add:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ae4:	75 0f                	jne    804af5 <mmap+0xe9>
+  804ae6:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804aed:	00 00 00 
+  804af0:	49 39 c7             	cmp    %rax,%r15
+  804af3:	77 1b                	ja     804b10 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804af5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804afc:	e9 3c 01 00 00       	jmp    804c3d <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b01:	41 f6 c5 02          	test   $0x2,%r13b
+  804b05:	74 b8                	je     804abf <mmap+0xb3>
+  804b07:	85 d2                	test   %edx,%edx
+  804b09:	75 b4                	jne    804abf <mmap+0xb3>
+  804b0b:	e9 2d 01 00 00       	jmp    804c3d <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b10:	4c 89 ff             	mov    %r15,%rdi
+  804b13:	48 b8 7a 46 80 00 00 	movabs $0x80467a,%rax
+  804b1a:	00 00 00 
+  804b1d:	ff d0                	call   *%rax
+  804b1f:	48 89 c2             	mov    %rax,%rdx
+  804b22:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b29:	49 39 d7             	cmp    %rdx,%r15
+  804b2c:	0f 85 0b 01 00 00    	jne    804c3d <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b32:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b39:	00 00 00 
+  804b3c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b42:	eb 44                	jmp    804b88 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b44:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b48:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b4f:	00 00 00 
+  804b52:	48 b8 7a 46 80 00 00 	movabs $0x80467a,%rax
+  804b59:	00 00 00 
+  804b5c:	ff d0                	call   *%rax
+  804b5e:	48 89 c7             	mov    %rax,%rdi
+  804b61:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b65:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b6c:	48 85 ff             	test   %rdi,%rdi
+  804b6f:	75 c1                	jne    804b32 <mmap+0x126>
+  804b71:	e9 c7 00 00 00       	jmp    804c3d <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b76:	49 83 c4 01          	add    $0x1,%r12
+  804b7a:	48 83 c0 20          	add    $0x20,%rax
+  804b7e:	49 83 fc 20          	cmp    $0x20,%r12
+  804b82:	0f 84 a5 00 00 00    	je     804c2d <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b88:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b8c:	75 e8                	jne    804b76 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b8e:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b92:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  804b99:	00 00 00 
+  804b9c:	ff d0                	call   *%rax
+  804b9e:	89 c2                	mov    %eax,%edx
+  804ba0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ba7:	85 d2                	test   %edx,%edx
+  804ba9:	0f 88 8e 00 00 00    	js     804c3d <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804baf:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bb3:	48 b8 98 2d 80 00 00 	movabs $0x802d98,%rax
+  804bba:	00 00 00 
+  804bbd:	ff d0                	call   *%rax
+  804bbf:	89 c6                	mov    %eax,%esi
+  804bc1:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bc4:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  804bcb:	00 00 00 
+  804bce:	ff d0                	call   *%rax
+  804bd0:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bd3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bda:	45 85 ff             	test   %r15d,%r15d
+  804bdd:	78 5e                	js     804c3d <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bdf:	49 c1 e4 05          	shl    $0x5,%r12
+  804be3:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bea:	00 00 00 
+  804bed:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bf0:	48 bf eb 46 80 00 00 	movabs $0x8046eb,%rdi
+  804bf7:	00 00 00 
+  804bfa:	48 b8 b9 51 80 00 00 	movabs $0x8051b9,%rax
+  804c01:	00 00 00 
+  804c04:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c06:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c0a:	49 89 04 24          	mov    %rax,(%r12)
+  804c0e:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c12:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c17:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c1c:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c21:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c26:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c2b:	eb 10                	jmp    804c3d <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c2d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c34:	eb 07                	jmp    804c3d <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c36:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c3d:	48 83 c4 38          	add    $0x38,%rsp
+  804c41:	5b                   	pop    %rbx
+  804c42:	41 5c                	pop    %r12
+  804c44:	41 5d                	pop    %r13
+  804c46:	41 5e                	pop    %r14
+  804c48:	41 5f                	pop    %r15
+  804c4a:	5d                   	pop    %rbp
+  804c4b:	c3                   	ret
+
+0000000000804c4c <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c4c:	55                   	push   %rbp
+  804c4d:	48 89 e5             	mov    %rsp,%rbp
+  804c50:	41 57                	push   %r15
+  804c52:	41 56                	push   %r14
+  804c54:	41 55                	push   %r13
+  804c56:	41 54                	push   %r12
+  804c58:	53                   	push   %rbx
+  804c59:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c5d:	49 89 fe             	mov    %rdi,%r14
+  804c60:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c67:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c6e:	00 
+  804c6f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c76:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c7d:	00 00 00 
+  804c80:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c87:	49 bf d3 48 80 00 00 	movabs $0x8048d3,%r15
+  804c8e:	00 00 00 
+  804c91:	eb 09                	jmp    804c9c <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c93:	48 83 c3 20          	add    $0x20,%rbx
+  804c97:	4c 39 eb             	cmp    %r13,%rbx
+  804c9a:	74 33                	je     804ccf <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c9c:	48 89 df             	mov    %rbx,%rdi
+  804c9f:	48 8b 33             	mov    (%rbx),%rsi
+  804ca2:	4c 39 e6             	cmp    %r12,%rsi
+  804ca5:	73 ec                	jae    804c93 <msync+0x47>
+  804ca7:	48 85 f6             	test   %rsi,%rsi
+  804caa:	74 e7                	je     804c93 <msync+0x47>
+  804cac:	48 89 f2             	mov    %rsi,%rdx
+  804caf:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cb3:	49 39 d6             	cmp    %rdx,%r14
+  804cb6:	73 db                	jae    804c93 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cb8:	4c 39 e2             	cmp    %r12,%rdx
+  804cbb:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cbf:	4c 39 f6             	cmp    %r14,%rsi
+  804cc2:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cc6:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cc9:	85 c0                	test   %eax,%eax
+  804ccb:	79 c6                	jns    804c93 <msync+0x47>
+  804ccd:	eb 05                	jmp    804cd4 <msync+0x88>
+    }
+
+    return 0;
+  804ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cd4:	48 83 c4 08          	add    $0x8,%rsp
+  804cd8:	5b                   	pop    %rbx
+  804cd9:	41 5c                	pop    %r12
+  804cdb:	41 5d                	pop    %r13
+  804cdd:	41 5e                	pop    %r14
+  804cdf:	41 5f                	pop    %r15
+  804ce1:	5d                   	pop    %rbp
+  804ce2:	c3                   	ret
+
+0000000000804ce3 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804ce3:	55                   	push   %rbp
+  804ce4:	48 89 e5             	mov    %rsp,%rbp
+  804ce7:	41 57                	push   %r15
+  804ce9:	41 56                	push   %r14
+  804ceb:	41 55                	push   %r13
+  804ced:	41 54                	push   %r12
+  804cef:	53                   	push   %rbx
+  804cf0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cf4:	49 89 ff             	mov    %rdi,%r15
+  804cf7:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cfe:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d05:	00 
+  804d06:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d0d:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d14:	00 00 00 
+  804d17:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d1e:	48 89 d8             	mov    %rbx,%rax
+  804d21:	eb 09                	jmp    804d2c <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d23:	48 83 c0 20          	add    $0x20,%rax
+  804d27:	4c 39 f0             	cmp    %r14,%rax
+  804d2a:	74 40                	je     804d6c <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d2c:	48 8b 10             	mov    (%rax),%rdx
+  804d2f:	4c 39 e2             	cmp    %r12,%rdx
+  804d32:	73 ef                	jae    804d23 <munmap+0x40>
+  804d34:	48 85 d2             	test   %rdx,%rdx
+  804d37:	74 ea                	je     804d23 <munmap+0x40>
+  804d39:	48 89 d7             	mov    %rdx,%rdi
+  804d3c:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d40:	49 39 ff             	cmp    %rdi,%r15
+  804d43:	73 de                	jae    804d23 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d45:	49 39 fc             	cmp    %rdi,%r12
+  804d48:	72 05                	jb     804d4f <munmap+0x6c>
+  804d4a:	4c 39 fa             	cmp    %r15,%rdx
+  804d4d:	73 d4                	jae    804d23 <munmap+0x40>
+  804d4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d54:	48 83 c4 08          	add    $0x8,%rsp
+  804d58:	5b                   	pop    %rbx
+  804d59:	41 5c                	pop    %r12
+  804d5b:	41 5d                	pop    %r13
+  804d5d:	41 5e                	pop    %r14
+  804d5f:	41 5f                	pop    %r15
+  804d61:	5d                   	pop    %rbp
+  804d62:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d63:	48 83 c3 20          	add    $0x20,%rbx
+  804d67:	4c 39 f3             	cmp    %r14,%rbx
+  804d6a:	74 5c                	je     804dc8 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d6c:	48 8b 33             	mov    (%rbx),%rsi
+  804d6f:	4c 39 e6             	cmp    %r12,%rsi
+  804d72:	73 ef                	jae    804d63 <munmap+0x80>
+  804d74:	48 85 f6             	test   %rsi,%rsi
+  804d77:	74 ea                	je     804d63 <munmap+0x80>
+  804d79:	48 89 f2             	mov    %rsi,%rdx
+  804d7c:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d80:	49 39 d7             	cmp    %rdx,%r15
+  804d83:	73 de                	jae    804d63 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d85:	48 89 df             	mov    %rbx,%rdi
+  804d88:	48 b8 d3 48 80 00 00 	movabs $0x8048d3,%rax
+  804d8f:	00 00 00 
+  804d92:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d94:	85 c0                	test   %eax,%eax
+  804d96:	78 bc                	js     804d54 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d98:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d9c:	48 8b 33             	mov    (%rbx),%rsi
+  804d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804da4:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  804dab:	00 00 00 
+  804dae:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804db0:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804db3:	48 b8 8b 2f 80 00 00 	movabs $0x802f8b,%rax
+  804dba:	00 00 00 
+  804dbd:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dbf:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dc6:	eb 9b                	jmp    804d63 <munmap+0x80>
+    return 0;
+  804dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcd:	eb 85                	jmp    804d54 <munmap+0x71>
+
+0000000000804dcf <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd4:	c3                   	ret
+
+0000000000804dd5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dd5:	55                   	push   %rbp
+  804dd6:	48 89 e5             	mov    %rsp,%rbp
+  804dd9:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804ddc:	48 be 05 63 80 00 00 	movabs $0x806305,%rsi
+  804de3:	00 00 00 
+  804de6:	48 b8 d5 1f 80 00 00 	movabs $0x801fd5,%rax
+  804ded:	00 00 00 
+  804df0:	ff d0                	call   *%rax
+    return 0;
+}
+  804df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df7:	5d                   	pop    %rbp
+  804df8:	c3                   	ret
+
+0000000000804df9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804df9:	55                   	push   %rbp
+  804dfa:	48 89 e5             	mov    %rsp,%rbp
+  804dfd:	41 57                	push   %r15
+  804dff:	41 56                	push   %r14
+  804e01:	41 55                	push   %r13
+  804e03:	41 54                	push   %r12
+  804e05:	53                   	push   %rbx
+  804e06:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e0d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e14:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e1b:	00 00 00 00 
+  804e1f:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e26:	00 00 00 00 
+  804e2a:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e31:	00 00 00 00 
+  804e35:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e3c:	00 00 00 00 
+  804e40:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e47:	00 00 00 00 
+  804e4b:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e52:	00 00 00 00 
+  804e56:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e5d:	00 
+  804e5e:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e65:	00 
+  804e66:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e6d:	00 
+  804e6e:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e75:	00 
+  804e76:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e7d:	00 
+  804e7e:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e85:	00 
+  804e86:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e8d:	00 
+  804e8e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e95:	00 
+  804e96:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e9d:	00 
+  804e9e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804ea5:	00 
+    for (res = 0; res < n; res += inc) {
+  804ea6:	48 85 d2             	test   %rdx,%rdx
+  804ea9:	74 7a                	je     804f25 <devcons_write+0x12c>
+  804eab:	49 89 d6             	mov    %rdx,%r14
+  804eae:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804eb4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804eb9:	49 bf 25 23 80 00 00 	movabs $0x802325,%r15
+  804ec0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ec3:	4c 89 f3             	mov    %r14,%rbx
+  804ec6:	48 29 f3             	sub    %rsi,%rbx
+  804ec9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ece:	48 39 c3             	cmp    %rax,%rbx
+  804ed1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ed5:	4c 63 eb             	movslq %ebx,%r13
+  804ed8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804edf:	48 01 c6             	add    %rax,%rsi
+  804ee2:	4c 89 ea             	mov    %r13,%rdx
+  804ee5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804eec:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804eef:	4c 89 ee             	mov    %r13,%rsi
+  804ef2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ef9:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  804f00:	00 00 00 
+  804f03:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f05:	41 01 dc             	add    %ebx,%r12d
+  804f08:	49 63 f4             	movslq %r12d,%rsi
+  804f0b:	4c 39 f6             	cmp    %r14,%rsi
+  804f0e:	72 b3                	jb     804ec3 <devcons_write+0xca>
+    return res;
+  804f10:	49 63 c4             	movslq %r12d,%rax
+}
+  804f13:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f1a:	5b                   	pop    %rbx
+  804f1b:	41 5c                	pop    %r12
+  804f1d:	41 5d                	pop    %r13
+  804f1f:	41 5e                	pop    %r14
+  804f21:	41 5f                	pop    %r15
+  804f23:	5d                   	pop    %rbp
+  804f24:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f25:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f2b:	eb e3                	jmp    804f10 <devcons_write+0x117>
+
+0000000000804f2d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f2d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f30:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f35:	48 85 c0             	test   %rax,%rax
+  804f38:	74 55                	je     804f8f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f3a:	55                   	push   %rbp
+  804f3b:	48 89 e5             	mov    %rsp,%rbp
+  804f3e:	41 55                	push   %r13
+  804f40:	41 54                	push   %r12
+  804f42:	53                   	push   %rbx
+  804f43:	48 83 ec 08          	sub    $0x8,%rsp
+  804f47:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f4a:	48 bb 85 25 80 00 00 	movabs $0x802585,%rbx
+  804f51:	00 00 00 
+  804f54:	49 bc 99 26 80 00 00 	movabs $0x802699,%r12
+  804f5b:	00 00 00 
+  804f5e:	eb 03                	jmp    804f63 <devcons_read+0x36>
+  804f60:	41 ff d4             	call   *%r12
+  804f63:	ff d3                	call   *%rbx
+  804f65:	85 c0                	test   %eax,%eax
+  804f67:	74 f7                	je     804f60 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f69:	48 63 d0             	movslq %eax,%rdx
+  804f6c:	78 13                	js     804f81 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f73:	83 f8 04             	cmp    $0x4,%eax
+  804f76:	74 09                	je     804f81 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f78:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f7c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f81:	48 89 d0             	mov    %rdx,%rax
+  804f84:	48 83 c4 08          	add    $0x8,%rsp
+  804f88:	5b                   	pop    %rbx
+  804f89:	41 5c                	pop    %r12
+  804f8b:	41 5d                	pop    %r13
+  804f8d:	5d                   	pop    %rbp
+  804f8e:	c3                   	ret
+  804f8f:	48 89 d0             	mov    %rdx,%rax
+  804f92:	c3                   	ret
+
+0000000000804f93 <cputchar>:
+cputchar(int ch) {
+  804f93:	55                   	push   %rbp
+  804f94:	48 89 e5             	mov    %rsp,%rbp
+  804f97:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f9b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f9f:	be 01 00 00 00       	mov    $0x1,%esi
+  804fa4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fa8:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  804faf:	00 00 00 
+  804fb2:	ff d0                	call   *%rax
+}
+  804fb4:	c9                   	leave
+  804fb5:	c3                   	ret
+
+0000000000804fb6 <getchar>:
+getchar(void) {
+  804fb6:	55                   	push   %rbp
+  804fb7:	48 89 e5             	mov    %rsp,%rbp
+  804fba:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fbe:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fc3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fcc:	48 b8 09 31 80 00 00 	movabs $0x803109,%rax
+  804fd3:	00 00 00 
+  804fd6:	ff d0                	call   *%rax
+  804fd8:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fda:	85 c0                	test   %eax,%eax
+  804fdc:	78 06                	js     804fe4 <getchar+0x2e>
+  804fde:	74 08                	je     804fe8 <getchar+0x32>
+  804fe0:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fe4:	89 d0                	mov    %edx,%eax
+  804fe6:	c9                   	leave
+  804fe7:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fe8:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fed:	eb f5                	jmp    804fe4 <getchar+0x2e>
+
+0000000000804fef <iscons>:
+iscons(int fdnum) {
+  804fef:	55                   	push   %rbp
+  804ff0:	48 89 e5             	mov    %rsp,%rbp
+  804ff3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ff7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804ffb:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  805002:	00 00 00 
+  805005:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805007:	85 c0                	test   %eax,%eax
+  805009:	78 18                	js     805023 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80500b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80500f:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  805016:	00 00 00 
+  805019:	8b 00                	mov    (%rax),%eax
+  80501b:	39 02                	cmp    %eax,(%rdx)
+  80501d:	0f 94 c0             	sete   %al
+  805020:	0f b6 c0             	movzbl %al,%eax
+}
+  805023:	c9                   	leave
+  805024:	c3                   	ret
+
+0000000000805025 <opencons>:
+opencons(void) {
+  805025:	55                   	push   %rbp
+  805026:	48 89 e5             	mov    %rsp,%rbp
+  805029:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80502d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805031:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  805038:	00 00 00 
+  80503b:	ff d0                	call   *%rax
+  80503d:	85 c0                	test   %eax,%eax
+  80503f:	78 49                	js     80508a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805041:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805046:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80504b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80504f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805054:	48 b8 3a 27 80 00 00 	movabs $0x80273a,%rax
+  80505b:	00 00 00 
+  80505e:	ff d0                	call   *%rax
+  805060:	85 c0                	test   %eax,%eax
+  805062:	78 26                	js     80508a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805064:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805068:	a1 e0 70 80 00 00 00 	movabs 0x8070e0,%eax
+  80506f:	00 00 
+  805071:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805073:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805077:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80507e:	48 b8 98 2d 80 00 00 	movabs $0x802d98,%rax
+  805085:	00 00 00 
+  805088:	ff d0                	call   *%rax
+}
+  80508a:	c9                   	leave
+  80508b:	c3                   	ret
+
+000000000080508c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80508c:	55                   	push   %rbp
+  80508d:	48 89 e5             	mov    %rsp,%rbp
+  805090:	41 56                	push   %r14
+  805092:	41 55                	push   %r13
+  805094:	41 54                	push   %r12
+  805096:	53                   	push   %rbx
+  805097:	48 83 ec 50          	sub    $0x50,%rsp
+  80509b:	49 89 fc             	mov    %rdi,%r12
+  80509e:	41 89 f5             	mov    %esi,%r13d
+  8050a1:	48 89 d3             	mov    %rdx,%rbx
+  8050a4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050a8:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050ac:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050b0:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050b7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050bb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050bf:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050c3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050c7:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8050ce:	00 00 00 
+  8050d1:	4c 8b 30             	mov    (%rax),%r14
+  8050d4:	48 b8 62 26 80 00 00 	movabs $0x802662,%rax
+  8050db:	00 00 00 
+  8050de:	ff d0                	call   *%rax
+  8050e0:	89 c6                	mov    %eax,%esi
+  8050e2:	45 89 e8             	mov    %r13d,%r8d
+  8050e5:	4c 89 e1             	mov    %r12,%rcx
+  8050e8:	4c 89 f2             	mov    %r14,%rdx
+  8050eb:	48 bf 18 63 80 00 00 	movabs $0x806318,%rdi
+  8050f2:	00 00 00 
+  8050f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050fa:	49 bc 9e 16 80 00 00 	movabs $0x80169e,%r12
+  805101:	00 00 00 
+  805104:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805107:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80510b:	48 89 df             	mov    %rbx,%rdi
+  80510e:	48 b8 3a 16 80 00 00 	movabs $0x80163a,%rax
+  805115:	00 00 00 
+  805118:	ff d0                	call   *%rax
+    cprintf("\n");
+  80511a:	48 bf 2e 5c 80 00 00 	movabs $0x805c2e,%rdi
+  805121:	00 00 00 
+  805124:	b8 00 00 00 00       	mov    $0x0,%eax
+  805129:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80512c:	cc                   	int3
+  80512d:	eb fd                	jmp    80512c <_panic+0xa0>
+
+000000000080512f <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80512f:	55                   	push   %rbp
+  805130:	48 89 e5             	mov    %rsp,%rbp
+  805133:	41 56                	push   %r14
+  805135:	41 55                	push   %r13
+  805137:	41 54                	push   %r12
+  805139:	53                   	push   %rbx
+  80513a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80513d:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805144:	00 00 00 
+  805147:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80514b:	74 27                	je     805174 <_handle_vectored_pagefault+0x45>
+  80514d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805152:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805159:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80515c:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80515f:	4c 89 e7             	mov    %r12,%rdi
+  805162:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805167:	84 c0                	test   %al,%al
+  805169:	75 45                	jne    8051b0 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80516b:	48 83 c3 01          	add    $0x1,%rbx
+  80516f:	49 3b 1e             	cmp    (%r14),%rbx
+  805172:	72 eb                	jb     80515f <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805174:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80517b:	00 
+  80517c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805181:	4d 8b 04 24          	mov    (%r12),%r8
+  805185:	48 ba 40 63 80 00 00 	movabs $0x806340,%rdx
+  80518c:	00 00 00 
+  80518f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805194:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  80519b:	00 00 00 
+  80519e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a3:	49 ba 8c 50 80 00 00 	movabs $0x80508c,%r10
+  8051aa:	00 00 00 
+  8051ad:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051b0:	5b                   	pop    %rbx
+  8051b1:	41 5c                	pop    %r12
+  8051b3:	41 5d                	pop    %r13
+  8051b5:	41 5e                	pop    %r14
+  8051b7:	5d                   	pop    %rbp
+  8051b8:	c3                   	ret
+
+00000000008051b9 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051b9:	55                   	push   %rbp
+  8051ba:	48 89 e5             	mov    %rsp,%rbp
+  8051bd:	53                   	push   %rbx
+  8051be:	48 83 ec 08          	sub    $0x8,%rsp
+  8051c2:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051c5:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051ca:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051d1:	00 00 00 
+  8051d4:	80 38 00             	cmpb   $0x0,(%rax)
+  8051d7:	74 68                	je     805241 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051d9:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051e0:	00 00 00 
+  8051e3:	48 8b 08             	mov    (%rax),%rcx
+  8051e6:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051eb:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051f2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f5:	48 85 c9             	test   %rcx,%rcx
+  8051f8:	0f 84 e0 00 00 00    	je     8052de <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051fe:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805202:	0f 84 c9 00 00 00    	je     8052d1 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805208:	48 83 c2 01          	add    $0x1,%rdx
+  80520c:	48 39 ca             	cmp    %rcx,%rdx
+  80520f:	75 ed                	jne    8051fe <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805211:	48 83 f9 08          	cmp    $0x8,%rcx
+  805215:	0f 84 84 00 00 00    	je     80529f <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80521b:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80521f:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805226:	00 00 00 
+  805229:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805230:	00 00 00 
+  805233:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805237:	85 f6                	test   %esi,%esi
+  805239:	0f 89 97 00 00 00    	jns    8052d6 <add_pgfault_handler+0x11d>
+  80523f:	eb 63                	jmp    8052a4 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805241:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805246:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80524b:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805252:	00 00 00 
+  805255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80525a:	48 b8 3a 27 80 00 00 	movabs $0x80273a,%rax
+  805261:	00 00 00 
+  805264:	ff d0                	call   *%rax
+  805266:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805268:	85 c0                	test   %eax,%eax
+  80526a:	78 38                	js     8052a4 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80526c:	48 be ba 53 80 00 00 	movabs $0x8053ba,%rsi
+  805273:	00 00 00 
+  805276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80527b:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  805282:	00 00 00 
+  805285:	ff d0                	call   *%rax
+  805287:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805289:	85 c0                	test   %eax,%eax
+  80528b:	78 17                	js     8052a4 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80528d:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805294:	00 00 00 
+  805297:	c6 00 01             	movb   $0x1,(%rax)
+  80529a:	e9 3a ff ff ff       	jmp    8051d9 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80529f:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052a4:	89 f1                	mov    %esi,%ecx
+  8052a6:	48 ba 7e 63 80 00 00 	movabs $0x80637e,%rdx
+  8052ad:	00 00 00 
+  8052b0:	be 42 00 00 00       	mov    $0x42,%esi
+  8052b5:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  8052bc:	00 00 00 
+  8052bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052c4:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  8052cb:	00 00 00 
+  8052ce:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052d1:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052d6:	89 f0                	mov    %esi,%eax
+  8052d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052dc:	c9                   	leave
+  8052dd:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052de:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052e5:	00 00 00 
+  8052e8:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052ef:	48 89 d8             	mov    %rbx,%rax
+  8052f2:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052f9:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052fc:	eb d8                	jmp    8052d6 <add_pgfault_handler+0x11d>
+
+00000000008052fe <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052fe:	55                   	push   %rbp
+  8052ff:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805302:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805309:	00 00 00 
+  80530c:	80 38 00             	cmpb   $0x0,(%rax)
+  80530f:	74 33                	je     805344 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805311:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805318:	00 00 00 
+  80531b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805320:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805327:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80532a:	48 85 c0             	test   %rax,%rax
+  80532d:	0f 84 85 00 00 00    	je     8053b8 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805333:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805337:	74 40                	je     805379 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805339:	48 83 c1 01          	add    $0x1,%rcx
+  80533d:	48 39 c1             	cmp    %rax,%rcx
+  805340:	75 f1                	jne    805333 <remove_pgfault_handler+0x35>
+  805342:	eb 74                	jmp    8053b8 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805344:	48 b9 96 63 80 00 00 	movabs $0x806396,%rcx
+  80534b:	00 00 00 
+  80534e:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  805355:	00 00 00 
+  805358:	be 48 00 00 00       	mov    $0x48,%esi
+  80535d:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  805364:	00 00 00 
+  805367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80536c:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  805373:	00 00 00 
+  805376:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805379:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805380:	00 
+  805381:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805385:	48 29 ca             	sub    %rcx,%rdx
+  805388:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80538f:	00 00 00 
+  805392:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805396:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80539b:	48 89 ce             	mov    %rcx,%rsi
+  80539e:	48 b8 25 23 80 00 00 	movabs $0x802325,%rax
+  8053a5:	00 00 00 
+  8053a8:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053aa:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053b1:	00 00 00 
+  8053b4:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053b8:	5d                   	pop    %rbp
+  8053b9:	c3                   	ret
+
+00000000008053ba <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053ba:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053bd:	48 b8 2f 51 80 00 00 	movabs $0x80512f,%rax
+  8053c4:	00 00 00 
+    call *%rax
+  8053c7:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053c9:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053d0:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053d1:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053d8:	00 
+    subq $8, %rcx
+  8053d9:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053dd:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053e0:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053e7:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053e8:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053ec:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053f0:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053f5:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053fa:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053ff:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805404:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805409:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80540e:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805413:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805418:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80541d:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805422:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805427:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80542c:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805431:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805436:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80543a:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80543e:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80543f:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805440:	c3                   	ret
+
+0000000000805441 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805441:	85 ff                	test   %edi,%edi
+  805443:	78 58                	js     80549d <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805445:	48 85 f6             	test   %rsi,%rsi
+  805448:	74 12                	je     80545c <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80544a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805451:	00 00 00 
+  805454:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80545a:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80545c:	48 85 c9             	test   %rcx,%rcx
+  80545f:	74 12                	je     805473 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805461:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805468:	00 00 00 
+  80546b:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805471:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805473:	48 85 d2             	test   %rdx,%rdx
+  805476:	74 14                	je     80548c <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805478:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80547f:	00 00 00 
+  805482:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805489:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80548c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805493:	00 00 00 
+  805496:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80549c:	c3                   	ret
+        if (from_env_store) {
+  80549d:	48 85 f6             	test   %rsi,%rsi
+  8054a0:	74 06                	je     8054a8 <ipc_result+0x67>
+            *from_env_store = 0;
+  8054a2:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054a8:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054aa:	48 85 c9             	test   %rcx,%rcx
+  8054ad:	74 ed                	je     80549c <ipc_result+0x5b>
+            *perm_store = 0;
+  8054af:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054b5:	c3                   	ret
+
+00000000008054b6 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054b6:	55                   	push   %rbp
+  8054b7:	48 89 e5             	mov    %rsp,%rbp
+  8054ba:	41 55                	push   %r13
+  8054bc:	41 54                	push   %r12
+  8054be:	53                   	push   %rbx
+  8054bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8054c3:	49 89 fc             	mov    %rdi,%r12
+  8054c6:	48 89 f7             	mov    %rsi,%rdi
+  8054c9:	48 89 d3             	mov    %rdx,%rbx
+  8054cc:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054cf:	48 85 f6             	test   %rsi,%rsi
+  8054d2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054d9:	00 00 00 
+  8054dc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8054e5:	48 85 d2             	test   %rdx,%rdx
+  8054e8:	74 03                	je     8054ed <ipc_recv+0x37>
+  8054ea:	48 8b 32             	mov    (%rdx),%rsi
+  8054ed:	48 b8 86 2c 80 00 00 	movabs $0x802c86,%rax
+  8054f4:	00 00 00 
+  8054f7:	ff d0                	call   *%rax
+  8054f9:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054fb:	4c 89 e9             	mov    %r13,%rcx
+  8054fe:	48 89 da             	mov    %rbx,%rdx
+  805501:	4c 89 e6             	mov    %r12,%rsi
+  805504:	48 b8 41 54 80 00 00 	movabs $0x805441,%rax
+  80550b:	00 00 00 
+  80550e:	ff d0                	call   *%rax
+}
+  805510:	48 83 c4 08          	add    $0x8,%rsp
+  805514:	5b                   	pop    %rbx
+  805515:	41 5c                	pop    %r12
+  805517:	41 5d                	pop    %r13
+  805519:	5d                   	pop    %rbp
+  80551a:	c3                   	ret
+
+000000000080551b <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80551b:	55                   	push   %rbp
+  80551c:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80551f:	48 85 d2             	test   %rdx,%rdx
+  805522:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805529:	00 00 00 
+  80552c:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805530:	89 f6                	mov    %esi,%esi
+  805532:	48 b8 12 2b 80 00 00 	movabs $0x802b12,%rax
+  805539:	00 00 00 
+  80553c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80553e:	85 c0                	test   %eax,%eax
+  805540:	78 02                	js     805544 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805542:	5d                   	pop    %rbp
+  805543:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805544:	89 c1                	mov    %eax,%ecx
+  805546:	48 ba b0 63 80 00 00 	movabs $0x8063b0,%rdx
+  80554d:	00 00 00 
+  805550:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805555:	48 bf bd 63 80 00 00 	movabs $0x8063bd,%rdi
+  80555c:	00 00 00 
+  80555f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805564:	49 b8 8c 50 80 00 00 	movabs $0x80508c,%r8
+  80556b:	00 00 00 
+  80556e:	41 ff d0             	call   *%r8
+
+0000000000805571 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805571:	55                   	push   %rbp
+  805572:	48 89 e5             	mov    %rsp,%rbp
+  805575:	53                   	push   %rbx
+  805576:	48 83 ec 08          	sub    $0x8,%rsp
+  80557a:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80557e:	48 85 d2             	test   %rdx,%rdx
+  805581:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805588:	00 00 00 
+  80558b:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80558f:	4d 85 c9             	test   %r9,%r9
+  805592:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80559b:	48 85 db             	test   %rbx,%rbx
+  80559e:	74 03                	je     8055a3 <ipc_call+0x32>
+  8055a0:	48 8b 03             	mov    (%rbx),%rax
+  8055a3:	89 f6                	mov    %esi,%esi
+  8055a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8055a9:	50                   	push   %rax
+  8055aa:	48 b8 44 2b 80 00 00 	movabs $0x802b44,%rax
+  8055b1:	00 00 00 
+  8055b4:	ff d0                	call   *%rax
+  8055b6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055b8:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055bc:	48 89 da             	mov    %rbx,%rdx
+  8055bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8055c4:	48 b8 41 54 80 00 00 	movabs $0x805441,%rax
+  8055cb:	00 00 00 
+  8055ce:	ff d0                	call   *%rax
+}
+  8055d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055d4:	c9                   	leave
+  8055d5:	c3                   	ret
+
+00000000008055d6 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055d6:	55                   	push   %rbp
+  8055d7:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055da:	89 f6                	mov    %esi,%esi
+  8055dc:	48 b8 b0 2b 80 00 00 	movabs $0x802bb0,%rax
+  8055e3:	00 00 00 
+  8055e6:	ff d0                	call   *%rax
+  8055e8:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8055f9:	48 b8 41 54 80 00 00 	movabs $0x805441,%rax
+  805600:	00 00 00 
+  805603:	ff d0                	call   *%rax
+}
+  805605:	5d                   	pop    %rbp
+  805606:	c3                   	ret
+
+0000000000805607 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805607:	55                   	push   %rbp
+  805608:	48 89 e5             	mov    %rsp,%rbp
+  80560b:	41 54                	push   %r12
+  80560d:	53                   	push   %rbx
+  80560e:	4c 89 cb             	mov    %r9,%rbx
+  805611:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805615:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805619:	48 85 d2             	test   %rdx,%rdx
+  80561c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805623:	00 00 00 
+  805626:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80562a:	4d 85 c9             	test   %r9,%r9
+  80562d:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805631:	b8 00 00 00 00       	mov    $0x0,%eax
+  805636:	4d 85 e4             	test   %r12,%r12
+  805639:	74 04                	je     80563f <ipc_reply_wait+0x38>
+  80563b:	49 8b 04 24          	mov    (%r12),%rax
+  80563f:	89 f6                	mov    %esi,%esi
+  805641:	48 83 ec 08          	sub    $0x8,%rsp
+  805645:	50                   	push   %rax
+  805646:	48 b8 1a 2c 80 00 00 	movabs $0x802c1a,%rax
+  80564d:	00 00 00 
+  805650:	ff d0                	call   *%rax
+  805652:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805654:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805658:	4c 89 e2             	mov    %r12,%rdx
+  80565b:	48 89 de             	mov    %rbx,%rsi
+  80565e:	48 b8 41 54 80 00 00 	movabs $0x805441,%rax
+  805665:	00 00 00 
+  805668:	ff d0                	call   *%rax
+}
+  80566a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80566e:	5b                   	pop    %rbx
+  80566f:	41 5c                	pop    %r12
+  805671:	5d                   	pop    %rbp
+  805672:	c3                   	ret
+
+0000000000805673 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805673:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805678:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80567f:	00 00 00 
+  805682:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805689:	48 01 ca             	add    %rcx,%rdx
+  80568c:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805692:	39 fa                	cmp    %edi,%edx
+  805694:	74 12                	je     8056a8 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805696:	48 83 c0 01          	add    $0x1,%rax
+  80569a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056a0:	75 e0                	jne    805682 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056a7:	c3                   	ret
+            return envs[i].env_id;
+  8056a8:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056af:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056b6:	00 00 00 
+  8056b9:	48 01 d0             	add    %rdx,%rax
+  8056bc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056c2:	c3                   	ret
+  8056c3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008056c8 <__rodata_start>:
+  8056c8:	77 00                	ja     8056ca <__rodata_start+0x2>
+  8056ca:	72 62                	jb     80572e <__rodata_start+0x66>
+  8056cc:	00 77 62             	add    %dh,0x62(%rdi)
+  8056cf:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056d2:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056d9:	00 
+  8056da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 68 65 6c 6c 6f 2c 20 77 6f 72 6c 64 0a 00     ..hello, world..
+  805c30:	3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35     <unknown>.012345
+  805c40:	36 37 38 39 41 42 43 44 45 46 00 30 31 32 33 34     6789ABCDEF.01234
+  805c50:	35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75 6c     56789abcdef.(nul
+  805c60:	6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73 70     l).error %d.unsp
+  805c70:	65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62 61     ecified error.ba
+  805c80:	64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e     d environment.in
+  805c90:	76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72 00     valid parameter.
+  805ca0:	6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75     out of memory.ou
+  805cb0:	74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74     t of environment
+  805cc0:	73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62 75     s.corrupted debu
+  805cd0:	67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74     g info.segmentat
+  805ce0:	69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69     ion fault.invali
+  805cf0:	64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73     d ELF image.no s
+  805d00:	75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00     uch system call.
+  805d10:	65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00     entry not found.
+  805d20:	65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76 69     env is not recvi
+  805d30:	6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65 6e     ng.unexpected en
+  805d40:	64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65     d of file.no fre
+  805d50:	65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00     e space on disk.
+  805d60:	74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61     too many files a
+  805d70:	72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20     re open.file or 
+  805d80:	62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00     block not found.
+  805d90:	69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69 6c     invalid path.fil
+  805da0:	65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74 73     e already exists
+  805db0:	00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73     .operation not s
+  805dc0:	75 70 70 6f 72 74 65 64 00 66 2e 0f 1f 84 00 00     upported.f......
+  805dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
+  805de0:	96 18 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805df0:	dd 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805e00:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805e10:	ed 1e 80 00 00 00 00 00 b5 18 80 00 00 00 00 00     ................
+  805e20:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805e30:	a9 18 80 00 00 00 00 00 23 19 80 00 00 00 00 00     ........#.......
+  805e40:	ed 1e 80 00 00 00 00 00 a9 18 80 00 00 00 00 00     ................
+  805e50:	ef 18 80 00 00 00 00 00 ef 18 80 00 00 00 00 00     ................
+  805e60:	ef 18 80 00 00 00 00 00 ef 18 80 00 00 00 00 00     ................
+  805e70:	ef 18 80 00 00 00 00 00 ef 18 80 00 00 00 00 00     ................
+  805e80:	ef 18 80 00 00 00 00 00 ef 18 80 00 00 00 00 00     ................
+  805e90:	ef 18 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805ea0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805eb0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805ec0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805ed0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805ee0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805ef0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f00:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f10:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f20:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f30:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f40:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f50:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f60:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f70:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805f80:	ed 1e 80 00 00 00 00 00 0b 1e 80 00 00 00 00 00     ................
+  805f90:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805fa0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805fb0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805fc0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805fd0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  805fe0:	51 19 80 00 00 00 00 00 20 1b 80 00 00 00 00 00     Q....... .......
+  805ff0:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  806000:	ed 1e 80 00 00 00 00 00 46 19 80 00 00 00 00 00     ........F.......
+  806010:	80 19 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  806020:	ed 1e 80 00 00 00 00 00 3b 19 80 00 00 00 00 00     ........;.......
+  806030:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  806040:	c9 1c 80 00 00 00 00 00 98 1d 80 00 00 00 00 00     ................
+  806050:	ed 1e 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  806060:	17 1a 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  806070:	f4 1b 80 00 00 00 00 00 ed 1e 80 00 00 00 00 00     ................
+  806080:	ed 1e 80 00 00 00 00 00 0b 1e 80 00 00 00 00 00     ................
+  806090:	ed 1e 80 00 00 00 00 00 9f 18 80 00 00 00 00 00     ................
+
+00000000008060a0 <error_string>:
+	...
+  8060a8:	6c 5c 80 00 00 00 00 00 7e 5c 80 00 00 00 00 00     l\......~\......
+  8060b8:	8e 5c 80 00 00 00 00 00 a0 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	ae 5c 80 00 00 00 00 00 c2 5c 80 00 00 00 00 00     .\.......\......
+  8060d8:	d7 5c 80 00 00 00 00 00 ea 5c 80 00 00 00 00 00     .\.......\......
+  8060e8:	fc 5c 80 00 00 00 00 00 10 5d 80 00 00 00 00 00     .\.......]......
+  8060f8:	20 5d 80 00 00 00 00 00 33 5d 80 00 00 00 00 00      ]......3]......
+  806108:	4a 5d 80 00 00 00 00 00 60 5d 80 00 00 00 00 00     J]......`]......
+  806118:	78 5d 80 00 00 00 00 00 90 5d 80 00 00 00 00 00     x].......]......
+  806128:	9d 5d 80 00 00 00 00 00 40 61 80 00 00 00 00 00     .]......@a......
+  806138:	b1 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806148:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806158:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806168:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806178:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806188:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806198:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8061a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8061b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806208:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806218:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806220 <devtab>:
+  806220:	60 70 80 00 00 00 00 00 a0 70 80 00 00 00 00 00     `p.......p......
+  806230:	e0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806240:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806250:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806260:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806270:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806280:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806290:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8062a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8062b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806300:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806310:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806320:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806330:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806340:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806350:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806360:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806370:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806380:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806390:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8063a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8063b0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063c0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806400:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806410:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806420:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806430:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806440:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806450:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806460:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,10445 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 9a 24 80 00 00 	movabs $0x80249a,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 1b 23 80 00 00 	movabs $0x80231b,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 31 3e 80 00 00 	movabs $0x803e31,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 2a 21 80 00 00 	movabs $0x80212a,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 31 3e 80 00 00 	movabs $0x803e31,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 2a 21 80 00 00 	movabs $0x80212a,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 4e 17 80 00 00 	movabs $0x80174e,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 8f 5e 80 00 00 	movabs $0x805e8f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 c4 3b 80 00 00 	movabs $0x803bc4,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 48 58 80 00 00 	movabs $0x805848,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 c4 3b 80 00 00 	movabs $0x803bc4,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 4a 58 80 00 00 	movabs $0x80584a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 c4 3b 80 00 00 	movabs $0x803bc4,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 4d 58 80 00 00 	movabs $0x80584d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 c4 3b 80 00 00 	movabs $0x803bc4,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 2f 4c 80 00 00 	movabs $0x804c2f,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 06 4f 80 00 00 	movabs $0x804f06,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 45 35 80 00 00 	movabs $0x803545,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 14 35 80 00 00 	movabs $0x803514,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 14 35 80 00 00 	movabs $0x803514,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 2c 33 80 00 00 	movabs $0x80332c,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 c4 3b 80 00 00 	movabs $0x803bc4,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 67 24 80 00 00 	movabs $0x802467,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 60 58 80 00 00 	movabs $0x805860,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 9a 24 80 00 00 	movabs $0x80249a,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 67 24 80 00 00 	movabs $0x802467,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 00 5b 80 00 00 	movabs $0x805b00,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 67 24 80 00 00 	movabs $0x802467,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 67 24 80 00 00 	movabs $0x802467,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 80 5d 80 00 00 	movabs $0x805d80,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 80 5d 80 00 00 	movabs $0x805d80,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 bf 26 80 00 00 	movabs $0x8026bf,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 bf 26 80 00 00 	movabs $0x8026bf,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 a6 01 00 00       	call   8016a5 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <cat>:
+#include <inc/lib.h>
+
+char buf[8192];
+
+void
+cat(int f, char *s) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 18          	sub    $0x18,%rsp
+  801512:	41 89 fd             	mov    %edi,%r13d
+  801515:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    long n;
+    int r;
+
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  801519:	49 bc 20 80 80 01 00 	movabs $0x1808020,%r12
+  801520:	00 00 00 
+  801523:	49 be 2c 33 80 00 00 	movabs $0x80332c,%r14
+  80152a:	00 00 00 
+        if ((r = write(1, buf, n)) != n)
+  80152d:	49 bf 5b 34 80 00 00 	movabs $0x80345b,%r15
+  801534:	00 00 00 
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  801537:	ba 00 20 00 00       	mov    $0x2000,%edx
+  80153c:	4c 89 e6             	mov    %r12,%rsi
+  80153f:	44 89 ef             	mov    %r13d,%edi
+  801542:	41 ff d6             	call   *%r14
+  801545:	48 89 c3             	mov    %rax,%rbx
+  801548:	48 85 c0             	test   %rax,%rax
+  80154b:	7e 48                	jle    801595 <cat+0x94>
+        if ((r = write(1, buf, n)) != n)
+  80154d:	48 89 da             	mov    %rbx,%rdx
+  801550:	4c 89 e6             	mov    %r12,%rsi
+  801553:	bf 01 00 00 00       	mov    $0x1,%edi
+  801558:	41 ff d7             	call   *%r15
+  80155b:	48 63 d0             	movslq %eax,%rdx
+  80155e:	48 39 da             	cmp    %rbx,%rdx
+  801561:	74 d4                	je     801537 <cat+0x36>
+            panic("write error copying %s: %i", s, r);
+  801563:	41 89 c0             	mov    %eax,%r8d
+  801566:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80156a:	48 ba a2 5d 80 00 00 	movabs $0x805da2,%rdx
+  801571:	00 00 00 
+  801574:	be 0c 00 00 00       	mov    $0xc,%esi
+  801579:	48 bf bd 5d 80 00 00 	movabs $0x805dbd,%rdi
+  801580:	00 00 00 
+  801583:	b8 00 00 00 00       	mov    $0x0,%eax
+  801588:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  80158f:	00 00 00 
+  801592:	41 ff d1             	call   *%r9
+    if (n < 0)
+  801595:	78 0f                	js     8015a6 <cat+0xa5>
+        panic("error reading %s: %i", s, (int)n);
+}
+  801597:	48 83 c4 18          	add    $0x18,%rsp
+  80159b:	5b                   	pop    %rbx
+  80159c:	41 5c                	pop    %r12
+  80159e:	41 5d                	pop    %r13
+  8015a0:	41 5e                	pop    %r14
+  8015a2:	41 5f                	pop    %r15
+  8015a4:	5d                   	pop    %rbp
+  8015a5:	c3                   	ret
+        panic("error reading %s: %i", s, (int)n);
+  8015a6:	41 89 c0             	mov    %eax,%r8d
+  8015a9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8015ad:	48 ba c8 5d 80 00 00 	movabs $0x805dc8,%rdx
+  8015b4:	00 00 00 
+  8015b7:	be 0e 00 00 00       	mov    $0xe,%esi
+  8015bc:	48 bf bd 5d 80 00 00 	movabs $0x805dbd,%rdi
+  8015c3:	00 00 00 
+  8015c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cb:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  8015d2:	00 00 00 
+  8015d5:	41 ff d1             	call   *%r9
+
+00000000008015d8 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8015d8:	55                   	push   %rbp
+  8015d9:	48 89 e5             	mov    %rsp,%rbp
+  8015dc:	41 57                	push   %r15
+  8015de:	41 56                	push   %r14
+  8015e0:	41 55                	push   %r13
+  8015e2:	41 54                	push   %r12
+  8015e4:	53                   	push   %rbx
+  8015e5:	48 83 ec 08          	sub    $0x8,%rsp
+    int f, i;
+
+    binaryname = "cat";
+  8015e9:	48 b8 dd 5d 80 00 00 	movabs $0x805ddd,%rax
+  8015f0:	00 00 00 
+  8015f3:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015fa:	00 00 00 
+    if (argc == 1)
+  8015fd:	83 ff 01             	cmp    $0x1,%edi
+  801600:	74 24                	je     801626 <umain+0x4e>
+        cat(0, "<stdin>");
+    else
+        for (i = 1; i < argc; i++) {
+  801602:	7e 3d                	jle    801641 <umain+0x69>
+  801604:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  801608:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80160b:	4c 8d 74 c6 10       	lea    0x10(%rsi,%rax,8),%r14
+            f = open(argv[i], O_RDONLY);
+  801610:	49 bd c4 3b 80 00 00 	movabs $0x803bc4,%r13
+  801617:	00 00 00 
+            if (f < 0)
+                printf("can't open %s: %i\n", argv[i], f);
+            else {
+                cat(f, argv[i]);
+  80161a:	49 bf 01 15 80 00 00 	movabs $0x801501,%r15
+  801621:	00 00 00 
+  801624:	eb 54                	jmp    80167a <umain+0xa2>
+        cat(0, "<stdin>");
+  801626:	48 be e1 5d 80 00 00 	movabs $0x805de1,%rsi
+  80162d:	00 00 00 
+  801630:	bf 00 00 00 00       	mov    $0x0,%edi
+  801635:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80163c:	00 00 00 
+  80163f:	ff d0                	call   *%rax
+                close(f);
+            }
+        }
+}
+  801641:	48 83 c4 08          	add    $0x8,%rsp
+  801645:	5b                   	pop    %rbx
+  801646:	41 5c                	pop    %r12
+  801648:	41 5d                	pop    %r13
+  80164a:	41 5e                	pop    %r14
+  80164c:	41 5f                	pop    %r15
+  80164e:	5d                   	pop    %rbp
+  80164f:	c3                   	ret
+                printf("can't open %s: %i\n", argv[i], f);
+  801650:	49 8b 34 24          	mov    (%r12),%rsi
+  801654:	89 c2                	mov    %eax,%edx
+  801656:	48 bf e9 5d 80 00 00 	movabs $0x805de9,%rdi
+  80165d:	00 00 00 
+  801660:	b8 00 00 00 00       	mov    $0x0,%eax
+  801665:	48 b9 f7 3e 80 00 00 	movabs $0x803ef7,%rcx
+  80166c:	00 00 00 
+  80166f:	ff d1                	call   *%rcx
+        for (i = 1; i < argc; i++) {
+  801671:	49 83 c4 08          	add    $0x8,%r12
+  801675:	4d 39 f4             	cmp    %r14,%r12
+  801678:	74 c7                	je     801641 <umain+0x69>
+            f = open(argv[i], O_RDONLY);
+  80167a:	49 8b 3c 24          	mov    (%r12),%rdi
+  80167e:	be 00 00 00 00       	mov    $0x0,%esi
+  801683:	41 ff d5             	call   *%r13
+  801686:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  801688:	85 c0                	test   %eax,%eax
+  80168a:	78 c4                	js     801650 <umain+0x78>
+                cat(f, argv[i]);
+  80168c:	49 8b 34 24          	mov    (%r12),%rsi
+  801690:	89 c7                	mov    %eax,%edi
+  801692:	41 ff d7             	call   *%r15
+                close(f);
+  801695:	89 df                	mov    %ebx,%edi
+  801697:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  80169e:	00 00 00 
+  8016a1:	ff d0                	call   *%rax
+  8016a3:	eb cc                	jmp    801671 <umain+0x99>
+
+00000000008016a5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8016a5:	55                   	push   %rbp
+  8016a6:	48 89 e5             	mov    %rsp,%rbp
+  8016a9:	41 56                	push   %r14
+  8016ab:	41 55                	push   %r13
+  8016ad:	41 54                	push   %r12
+  8016af:	53                   	push   %rbx
+  8016b0:	41 89 fd             	mov    %edi,%r13d
+  8016b3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8016b6:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8016bd:	00 00 00 
+  8016c0:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8016c7:	00 00 00 
+  8016ca:	48 39 c2             	cmp    %rax,%rdx
+  8016cd:	73 17                	jae    8016e6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8016cf:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8016d2:	49 89 c4             	mov    %rax,%r12
+  8016d5:	48 83 c3 08          	add    $0x8,%rbx
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016de:	ff 53 f8             	call   *-0x8(%rbx)
+  8016e1:	4c 39 e3             	cmp    %r12,%rbx
+  8016e4:	72 ef                	jb     8016d5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8016e6:	48 b8 85 28 80 00 00 	movabs $0x802885,%rax
+  8016ed:	00 00 00 
+  8016f0:	ff d0                	call   *%rax
+  8016f2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016f7:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8016fe:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801705:	00 00 00 
+  801708:	48 01 d0             	add    %rdx,%rax
+  80170b:	48 a3 20 a0 80 01 00 	movabs %rax,0x180a020
+  801712:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801715:	45 85 ed             	test   %r13d,%r13d
+  801718:	7e 0d                	jle    801727 <libmain+0x82>
+  80171a:	49 8b 06             	mov    (%r14),%rax
+  80171d:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801724:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801727:	4c 89 f6             	mov    %r14,%rsi
+  80172a:	44 89 ef             	mov    %r13d,%edi
+  80172d:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801734:	00 00 00 
+  801737:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801739:	48 b8 4e 17 80 00 00 	movabs $0x80174e,%rax
+  801740:	00 00 00 
+  801743:	ff d0                	call   *%rax
+#endif
+}
+  801745:	5b                   	pop    %rbx
+  801746:	41 5c                	pop    %r12
+  801748:	41 5d                	pop    %r13
+  80174a:	41 5e                	pop    %r14
+  80174c:	5d                   	pop    %rbp
+  80174d:	c3                   	ret
+
+000000000080174e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80174e:	55                   	push   %rbp
+  80174f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801752:	48 b8 e1 31 80 00 00 	movabs $0x8031e1,%rax
+  801759:	00 00 00 
+  80175c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80175e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801763:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  80176a:	00 00 00 
+  80176d:	ff d0                	call   *%rax
+}
+  80176f:	5d                   	pop    %rbp
+  801770:	c3                   	ret
+
+0000000000801771 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801771:	55                   	push   %rbp
+  801772:	48 89 e5             	mov    %rsp,%rbp
+  801775:	41 56                	push   %r14
+  801777:	41 55                	push   %r13
+  801779:	41 54                	push   %r12
+  80177b:	53                   	push   %rbx
+  80177c:	48 83 ec 50          	sub    $0x50,%rsp
+  801780:	49 89 fc             	mov    %rdi,%r12
+  801783:	41 89 f5             	mov    %esi,%r13d
+  801786:	48 89 d3             	mov    %rdx,%rbx
+  801789:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80178d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801791:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801795:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80179c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017a0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8017a4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8017a8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8017ac:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8017b3:	00 00 00 
+  8017b6:	4c 8b 30             	mov    (%rax),%r14
+  8017b9:	48 b8 85 28 80 00 00 	movabs $0x802885,%rax
+  8017c0:	00 00 00 
+  8017c3:	ff d0                	call   *%rax
+  8017c5:	89 c6                	mov    %eax,%esi
+  8017c7:	45 89 e8             	mov    %r13d,%r8d
+  8017ca:	4c 89 e1             	mov    %r12,%rcx
+  8017cd:	4c 89 f2             	mov    %r14,%rdx
+  8017d0:	48 bf 08 5e 80 00 00 	movabs $0x805e08,%rdi
+  8017d7:	00 00 00 
+  8017da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017df:	49 bc c1 18 80 00 00 	movabs $0x8018c1,%r12
+  8017e6:	00 00 00 
+  8017e9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8017ec:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8017f0:	48 89 df             	mov    %rbx,%rdi
+  8017f3:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8017fa:	00 00 00 
+  8017fd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8017ff:	48 bf d3 63 80 00 00 	movabs $0x8063d3,%rdi
+  801806:	00 00 00 
+  801809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801811:	cc                   	int3
+  801812:	eb fd                	jmp    801811 <_panic+0xa0>
+
+0000000000801814 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801814:	55                   	push   %rbp
+  801815:	48 89 e5             	mov    %rsp,%rbp
+  801818:	53                   	push   %rbx
+  801819:	48 83 ec 08          	sub    $0x8,%rsp
+  80181d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801820:	8b 06                	mov    (%rsi),%eax
+  801822:	8d 50 01             	lea    0x1(%rax),%edx
+  801825:	89 16                	mov    %edx,(%rsi)
+  801827:	48 98                	cltq
+  801829:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80182e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801834:	74 0a                	je     801840 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801836:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80183a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80183e:	c9                   	leave
+  80183f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801840:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801844:	be ff 00 00 00       	mov    $0xff,%esi
+  801849:	48 b8 75 27 80 00 00 	movabs $0x802775,%rax
+  801850:	00 00 00 
+  801853:	ff d0                	call   *%rax
+        state->offset = 0;
+  801855:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80185b:	eb d9                	jmp    801836 <putch+0x22>
+
+000000000080185d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+  801861:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801868:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80186b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801872:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801877:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80187f:	48 89 f1             	mov    %rsi,%rcx
+  801882:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801889:	48 bf 14 18 80 00 00 	movabs $0x801814,%rdi
+  801890:	00 00 00 
+  801893:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  80189a:	00 00 00 
+  80189d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80189f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8018a6:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8018ad:	48 b8 75 27 80 00 00 	movabs $0x802775,%rax
+  8018b4:	00 00 00 
+  8018b7:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8018b9:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8018bf:	c9                   	leave
+  8018c0:	c3                   	ret
+
+00000000008018c1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8018c1:	55                   	push   %rbp
+  8018c2:	48 89 e5             	mov    %rsp,%rbp
+  8018c5:	48 83 ec 50          	sub    $0x50,%rsp
+  8018c9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8018cd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8018d1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018d5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018d9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8018dd:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8018e4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018ec:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018f0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8018f4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8018f8:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8018ff:	00 00 00 
+  801902:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801904:	c9                   	leave
+  801905:	c3                   	ret
+
+0000000000801906 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801906:	55                   	push   %rbp
+  801907:	48 89 e5             	mov    %rsp,%rbp
+  80190a:	41 57                	push   %r15
+  80190c:	41 56                	push   %r14
+  80190e:	41 55                	push   %r13
+  801910:	41 54                	push   %r12
+  801912:	53                   	push   %rbx
+  801913:	48 83 ec 18          	sub    $0x18,%rsp
+  801917:	49 89 fc             	mov    %rdi,%r12
+  80191a:	49 89 f5             	mov    %rsi,%r13
+  80191d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801921:	8b 45 10             	mov    0x10(%rbp),%eax
+  801924:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801927:	41 89 cf             	mov    %ecx,%r15d
+  80192a:	4c 39 fa             	cmp    %r15,%rdx
+  80192d:	73 5b                	jae    80198a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80192f:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801933:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801937:	85 db                	test   %ebx,%ebx
+  801939:	7e 0e                	jle    801949 <print_num+0x43>
+            putch(padc, put_arg);
+  80193b:	4c 89 ee             	mov    %r13,%rsi
+  80193e:	44 89 f7             	mov    %r14d,%edi
+  801941:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801944:	83 eb 01             	sub    $0x1,%ebx
+  801947:	75 f2                	jne    80193b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801949:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80194d:	48 b9 3c 5e 80 00 00 	movabs $0x805e3c,%rcx
+  801954:	00 00 00 
+  801957:	48 b8 2b 5e 80 00 00 	movabs $0x805e2b,%rax
+  80195e:	00 00 00 
+  801961:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801965:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801969:	ba 00 00 00 00       	mov    $0x0,%edx
+  80196e:	49 f7 f7             	div    %r15
+  801971:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801975:	4c 89 ee             	mov    %r13,%rsi
+  801978:	41 ff d4             	call   *%r12
+}
+  80197b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80197f:	5b                   	pop    %rbx
+  801980:	41 5c                	pop    %r12
+  801982:	41 5d                	pop    %r13
+  801984:	41 5e                	pop    %r14
+  801986:	41 5f                	pop    %r15
+  801988:	5d                   	pop    %rbp
+  801989:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80198a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80198e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801993:	49 f7 f7             	div    %r15
+  801996:	48 83 ec 08          	sub    $0x8,%rsp
+  80199a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80199e:	52                   	push   %rdx
+  80199f:	45 0f be c9          	movsbl %r9b,%r9d
+  8019a3:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8019a7:	48 89 c2             	mov    %rax,%rdx
+  8019aa:	48 b8 06 19 80 00 00 	movabs $0x801906,%rax
+  8019b1:	00 00 00 
+  8019b4:	ff d0                	call   *%rax
+  8019b6:	48 83 c4 10          	add    $0x10,%rsp
+  8019ba:	eb 8d                	jmp    801949 <print_num+0x43>
+
+00000000008019bc <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8019bc:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8019c0:	48 8b 06             	mov    (%rsi),%rax
+  8019c3:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8019c7:	73 0a                	jae    8019d3 <sprintputch+0x17>
+        *state->start++ = ch;
+  8019c9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019cd:	48 89 16             	mov    %rdx,(%rsi)
+  8019d0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8019d3:	c3                   	ret
+
+00000000008019d4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+  8019d8:	48 83 ec 50          	sub    $0x50,%rsp
+  8019dc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019e0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019e4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8019e8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8019ef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019f7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019fb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8019ff:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801a03:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801a0a:	00 00 00 
+  801a0d:	ff d0                	call   *%rax
+}
+  801a0f:	c9                   	leave
+  801a10:	c3                   	ret
+
+0000000000801a11 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+  801a15:	41 57                	push   %r15
+  801a17:	41 56                	push   %r14
+  801a19:	41 55                	push   %r13
+  801a1b:	41 54                	push   %r12
+  801a1d:	53                   	push   %rbx
+  801a1e:	48 83 ec 38          	sub    $0x38,%rsp
+  801a22:	49 89 fe             	mov    %rdi,%r14
+  801a25:	49 89 f5             	mov    %rsi,%r13
+  801a28:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801a2b:	48 8b 01             	mov    (%rcx),%rax
+  801a2e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801a32:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801a36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a3a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801a3e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801a42:	eb 0d                	jmp    801a51 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801a44:	40 0f b6 ff          	movzbl %dil,%edi
+  801a48:	4c 89 ee             	mov    %r13,%rsi
+  801a4b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801a4e:	4c 89 e3             	mov    %r12,%rbx
+  801a51:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801a55:	0f b6 3b             	movzbl (%rbx),%edi
+  801a58:	40 80 ff 25          	cmp    $0x25,%dil
+  801a5c:	74 14                	je     801a72 <vprintfmt+0x61>
+            if (!ch) return;
+  801a5e:	40 84 ff             	test   %dil,%dil
+  801a61:	75 e1                	jne    801a44 <vprintfmt+0x33>
+}
+  801a63:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a67:	5b                   	pop    %rbx
+  801a68:	41 5c                	pop    %r12
+  801a6a:	41 5d                	pop    %r13
+  801a6c:	41 5e                	pop    %r14
+  801a6e:	41 5f                	pop    %r15
+  801a70:	5d                   	pop    %rbp
+  801a71:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801a72:	be 00 00 00 00       	mov    $0x0,%esi
+  801a77:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801a7b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801a80:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a86:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801a8d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a91:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801a96:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a9b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a9e:	83 e8 23             	sub    $0x23,%eax
+  801aa1:	3c 57                	cmp    $0x57,%al
+  801aa3:	0f 87 67 06 00 00    	ja     802110 <vprintfmt+0x6ff>
+  801aa9:	0f b6 c0             	movzbl %al,%eax
+  801aac:	48 b9 c0 5f 80 00 00 	movabs $0x805fc0,%rcx
+  801ab3:	00 00 00 
+  801ab6:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801ab9:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801abc:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801ac0:	eb cf                	jmp    801a91 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801ac2:	49 89 dc             	mov    %rbx,%r12
+  801ac5:	be 01 00 00 00       	mov    $0x1,%esi
+  801aca:	eb c5                	jmp    801a91 <vprintfmt+0x80>
+            padc = ch;
+  801acc:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801ad0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801ad3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ad6:	eb b9                	jmp    801a91 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801adb:	83 f8 2f             	cmp    $0x2f,%eax
+  801ade:	77 24                	ja     801b04 <vprintfmt+0xf3>
+  801ae0:	89 c1                	mov    %eax,%ecx
+  801ae2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801ae6:	83 c0 08             	add    $0x8,%eax
+  801ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801aec:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801aef:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801af2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801af6:	79 99                	jns    801a91 <vprintfmt+0x80>
+                width = precision;
+  801af8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801afc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801b02:	eb 8d                	jmp    801a91 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801b04:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801b08:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801b0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b10:	eb da                	jmp    801aec <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801b12:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801b17:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b1b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801b21:	3c 39                	cmp    $0x39,%al
+  801b23:	77 1c                	ja     801b41 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801b25:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801b29:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801b2d:	0f b6 c0             	movzbl %al,%eax
+  801b30:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b35:	0f b6 03             	movzbl (%rbx),%eax
+  801b38:	3c 39                	cmp    $0x39,%al
+  801b3a:	76 e9                	jbe    801b25 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801b3c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801b3f:	eb b1                	jmp    801af2 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801b41:	49 89 dc             	mov    %rbx,%r12
+  801b44:	eb ac                	jmp    801af2 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801b46:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801b49:	85 c9                	test   %ecx,%ecx
+  801b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b50:	0f 49 c1             	cmovns %ecx,%eax
+  801b53:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801b56:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b59:	e9 33 ff ff ff       	jmp    801a91 <vprintfmt+0x80>
+            lflag++;
+  801b5e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b61:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b64:	e9 28 ff ff ff       	jmp    801a91 <vprintfmt+0x80>
+            lflag--;
+  801b69:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b6c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b6f:	e9 1d ff ff ff       	jmp    801a91 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801b74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b77:	83 f8 2f             	cmp    $0x2f,%eax
+  801b7a:	77 19                	ja     801b95 <vprintfmt+0x184>
+  801b7c:	89 c2                	mov    %eax,%edx
+  801b7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b82:	83 c0 08             	add    $0x8,%eax
+  801b85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b88:	8b 3a                	mov    (%rdx),%edi
+  801b8a:	4c 89 ee             	mov    %r13,%rsi
+  801b8d:	41 ff d6             	call   *%r14
+            break;
+  801b90:	e9 bc fe ff ff       	jmp    801a51 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801b95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba1:	eb e5                	jmp    801b88 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801ba3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ba6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ba9:	77 5a                	ja     801c05 <vprintfmt+0x1f4>
+  801bab:	89 c2                	mov    %eax,%edx
+  801bad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bb1:	83 c0 08             	add    $0x8,%eax
+  801bb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801bb7:	8b 02                	mov    (%rdx),%eax
+  801bb9:	89 c1                	mov    %eax,%ecx
+  801bbb:	f7 d9                	neg    %ecx
+  801bbd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801bc0:	83 f9 13             	cmp    $0x13,%ecx
+  801bc3:	7f 4e                	jg     801c13 <vprintfmt+0x202>
+  801bc5:	48 63 c1             	movslq %ecx,%rax
+  801bc8:	48 ba 80 62 80 00 00 	movabs $0x806280,%rdx
+  801bcf:	00 00 00 
+  801bd2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801bd6:	48 85 c0             	test   %rax,%rax
+  801bd9:	74 38                	je     801c13 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801bdb:	48 89 c1             	mov    %rax,%rcx
+  801bde:	48 ba 48 64 80 00 00 	movabs $0x806448,%rdx
+  801be5:	00 00 00 
+  801be8:	4c 89 ee             	mov    %r13,%rsi
+  801beb:	4c 89 f7             	mov    %r14,%rdi
+  801bee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf3:	49 b8 d4 19 80 00 00 	movabs $0x8019d4,%r8
+  801bfa:	00 00 00 
+  801bfd:	41 ff d0             	call   *%r8
+  801c00:	e9 4c fe ff ff       	jmp    801a51 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801c05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c11:	eb a4                	jmp    801bb7 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801c13:	48 ba 54 5e 80 00 00 	movabs $0x805e54,%rdx
+  801c1a:	00 00 00 
+  801c1d:	4c 89 ee             	mov    %r13,%rsi
+  801c20:	4c 89 f7             	mov    %r14,%rdi
+  801c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c28:	49 b8 d4 19 80 00 00 	movabs $0x8019d4,%r8
+  801c2f:	00 00 00 
+  801c32:	41 ff d0             	call   *%r8
+  801c35:	e9 17 fe ff ff       	jmp    801a51 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c3d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c40:	77 6c                	ja     801cae <vprintfmt+0x29d>
+  801c42:	89 c2                	mov    %eax,%edx
+  801c44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c48:	83 c0 08             	add    $0x8,%eax
+  801c4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c4e:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801c51:	48 85 f6             	test   %rsi,%rsi
+  801c54:	48 b8 4d 5e 80 00 00 	movabs $0x805e4d,%rax
+  801c5b:	00 00 00 
+  801c5e:	48 0f 45 c6          	cmovne %rsi,%rax
+  801c62:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801c66:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c6a:	7e 06                	jle    801c72 <vprintfmt+0x261>
+  801c6c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801c70:	75 4a                	jne    801cbc <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c72:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c76:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801c7a:	0f b6 00             	movzbl (%rax),%eax
+  801c7d:	84 c0                	test   %al,%al
+  801c7f:	0f 85 9a 00 00 00    	jne    801d1f <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801c85:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c88:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	0f 8e bd fd ff ff    	jle    801a51 <vprintfmt+0x40>
+  801c94:	4c 89 ee             	mov    %r13,%rsi
+  801c97:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c9c:	41 ff d6             	call   *%r14
+  801c9f:	41 83 ec 01          	sub    $0x1,%r12d
+  801ca3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801ca7:	75 eb                	jne    801c94 <vprintfmt+0x283>
+  801ca9:	e9 a3 fd ff ff       	jmp    801a51 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801cae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cba:	eb 92                	jmp    801c4e <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801cbc:	49 63 f7             	movslq %r15d,%rsi
+  801cbf:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801cc3:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  801cca:	00 00 00 
+  801ccd:	ff d0                	call   *%rax
+  801ccf:	48 89 c2             	mov    %rax,%rdx
+  801cd2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cd5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801cd7:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801cda:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	7e 91                	jle    801c72 <vprintfmt+0x261>
+  801ce1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ce6:	4c 89 ee             	mov    %r13,%rsi
+  801ce9:	44 89 e7             	mov    %r12d,%edi
+  801cec:	41 ff d6             	call   *%r14
+  801cef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801cf3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cf6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801cf9:	75 eb                	jne    801ce6 <vprintfmt+0x2d5>
+  801cfb:	e9 72 ff ff ff       	jmp    801c72 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d00:	0f b6 f8             	movzbl %al,%edi
+  801d03:	4c 89 ee             	mov    %r13,%rsi
+  801d06:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801d09:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801d0d:	49 83 c4 01          	add    $0x1,%r12
+  801d11:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801d17:	84 c0                	test   %al,%al
+  801d19:	0f 84 66 ff ff ff    	je     801c85 <vprintfmt+0x274>
+  801d1f:	45 85 ff             	test   %r15d,%r15d
+  801d22:	78 0a                	js     801d2e <vprintfmt+0x31d>
+  801d24:	41 83 ef 01          	sub    $0x1,%r15d
+  801d28:	0f 88 57 ff ff ff    	js     801c85 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d2e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801d32:	74 cc                	je     801d00 <vprintfmt+0x2ef>
+  801d34:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801d37:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d3c:	80 fa 5e             	cmp    $0x5e,%dl
+  801d3f:	77 c2                	ja     801d03 <vprintfmt+0x2f2>
+  801d41:	eb bd                	jmp    801d00 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801d43:	40 84 f6             	test   %sil,%sil
+  801d46:	75 26                	jne    801d6e <vprintfmt+0x35d>
+    switch (lflag) {
+  801d48:	85 d2                	test   %edx,%edx
+  801d4a:	74 59                	je     801da5 <vprintfmt+0x394>
+  801d4c:	83 fa 01             	cmp    $0x1,%edx
+  801d4f:	74 7b                	je     801dcc <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801d51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d54:	83 f8 2f             	cmp    $0x2f,%eax
+  801d57:	0f 87 96 00 00 00    	ja     801df3 <vprintfmt+0x3e2>
+  801d5d:	89 c2                	mov    %eax,%edx
+  801d5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d63:	83 c0 08             	add    $0x8,%eax
+  801d66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d69:	4c 8b 22             	mov    (%rdx),%r12
+  801d6c:	eb 17                	jmp    801d85 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801d6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d71:	83 f8 2f             	cmp    $0x2f,%eax
+  801d74:	77 21                	ja     801d97 <vprintfmt+0x386>
+  801d76:	89 c2                	mov    %eax,%edx
+  801d78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d7c:	83 c0 08             	add    $0x8,%eax
+  801d7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d82:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801d85:	4d 85 e4             	test   %r12,%r12
+  801d88:	78 7a                	js     801e04 <vprintfmt+0x3f3>
+            num = i;
+  801d8a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801d8d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801d92:	e9 56 02 00 00       	jmp    801fed <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da3:	eb dd                	jmp    801d82 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801da5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801da8:	83 f8 2f             	cmp    $0x2f,%eax
+  801dab:	77 11                	ja     801dbe <vprintfmt+0x3ad>
+  801dad:	89 c2                	mov    %eax,%edx
+  801daf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801db3:	83 c0 08             	add    $0x8,%eax
+  801db6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801db9:	4c 63 22             	movslq (%rdx),%r12
+  801dbc:	eb c7                	jmp    801d85 <vprintfmt+0x374>
+  801dbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dca:	eb ed                	jmp    801db9 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801dcc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dcf:	83 f8 2f             	cmp    $0x2f,%eax
+  801dd2:	77 11                	ja     801de5 <vprintfmt+0x3d4>
+  801dd4:	89 c2                	mov    %eax,%edx
+  801dd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dda:	83 c0 08             	add    $0x8,%eax
+  801ddd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801de0:	4c 8b 22             	mov    (%rdx),%r12
+  801de3:	eb a0                	jmp    801d85 <vprintfmt+0x374>
+  801de5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801de9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ded:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801df1:	eb ed                	jmp    801de0 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801df3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801df7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dff:	e9 65 ff ff ff       	jmp    801d69 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801e04:	4c 89 ee             	mov    %r13,%rsi
+  801e07:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801e0c:	41 ff d6             	call   *%r14
+                i = -i;
+  801e0f:	49 f7 dc             	neg    %r12
+  801e12:	e9 73 ff ff ff       	jmp    801d8a <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801e17:	40 84 f6             	test   %sil,%sil
+  801e1a:	75 2e                	jne    801e4a <vprintfmt+0x439>
+    switch (lflag) {
+  801e1c:	85 d2                	test   %edx,%edx
+  801e1e:	7f 59                	jg     801e79 <vprintfmt+0x468>
+  801e20:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e23:	7d 7a                	jge    801e9f <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801e25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e28:	83 f8 2f             	cmp    $0x2f,%eax
+  801e2b:	0f 87 aa 00 00 00    	ja     801edb <vprintfmt+0x4ca>
+  801e31:	89 c2                	mov    %eax,%edx
+  801e33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e37:	83 c0 08             	add    $0x8,%eax
+  801e3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e3d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e40:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e45:	e9 a3 01 00 00       	jmp    801fed <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e4d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e50:	77 19                	ja     801e6b <vprintfmt+0x45a>
+  801e52:	89 c2                	mov    %eax,%edx
+  801e54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e58:	83 c0 08             	add    $0x8,%eax
+  801e5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e5e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e61:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e66:	e9 82 01 00 00       	jmp    801fed <vprintfmt+0x5dc>
+  801e6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e77:	eb e5                	jmp    801e5e <vprintfmt+0x44d>
+    switch (lflag) {
+  801e79:	83 fa 01             	cmp    $0x1,%edx
+  801e7c:	75 a7                	jne    801e25 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801e7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e81:	83 f8 2f             	cmp    $0x2f,%eax
+  801e84:	77 47                	ja     801ecd <vprintfmt+0x4bc>
+  801e86:	89 c2                	mov    %eax,%edx
+  801e88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e8c:	83 c0 08             	add    $0x8,%eax
+  801e8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e92:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e95:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e9a:	e9 4e 01 00 00       	jmp    801fed <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ea2:	83 f8 2f             	cmp    $0x2f,%eax
+  801ea5:	77 18                	ja     801ebf <vprintfmt+0x4ae>
+  801ea7:	89 c2                	mov    %eax,%edx
+  801ea9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ead:	83 c0 08             	add    $0x8,%eax
+  801eb0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eb3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801eb5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801eba:	e9 2e 01 00 00       	jmp    801fed <vprintfmt+0x5dc>
+  801ebf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ecb:	eb e6                	jmp    801eb3 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801ecd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed9:	eb b7                	jmp    801e92 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801edb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801edf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ee3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee7:	e9 51 ff ff ff       	jmp    801e3d <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801eec:	40 84 f6             	test   %sil,%sil
+  801eef:	75 2e                	jne    801f1f <vprintfmt+0x50e>
+    switch (lflag) {
+  801ef1:	85 d2                	test   %edx,%edx
+  801ef3:	7f 59                	jg     801f4e <vprintfmt+0x53d>
+  801ef5:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ef8:	7d 77                	jge    801f71 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801efa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801efd:	83 f8 2f             	cmp    $0x2f,%eax
+  801f00:	0f 87 a4 00 00 00    	ja     801faa <vprintfmt+0x599>
+  801f06:	89 c2                	mov    %eax,%edx
+  801f08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f0c:	83 c0 08             	add    $0x8,%eax
+  801f0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f15:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f1a:	e9 ce 00 00 00       	jmp    801fed <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f22:	83 f8 2f             	cmp    $0x2f,%eax
+  801f25:	77 19                	ja     801f40 <vprintfmt+0x52f>
+  801f27:	89 c2                	mov    %eax,%edx
+  801f29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f2d:	83 c0 08             	add    $0x8,%eax
+  801f30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f36:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f3b:	e9 ad 00 00 00       	jmp    801fed <vprintfmt+0x5dc>
+  801f40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f4c:	eb e5                	jmp    801f33 <vprintfmt+0x522>
+    switch (lflag) {
+  801f4e:	83 fa 01             	cmp    $0x1,%edx
+  801f51:	75 a7                	jne    801efa <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801f53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f56:	83 f8 2f             	cmp    $0x2f,%eax
+  801f59:	77 41                	ja     801f9c <vprintfmt+0x58b>
+  801f5b:	89 c2                	mov    %eax,%edx
+  801f5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f61:	83 c0 08             	add    $0x8,%eax
+  801f64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801f6f:	eb 7c                	jmp    801fed <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f74:	83 f8 2f             	cmp    $0x2f,%eax
+  801f77:	77 15                	ja     801f8e <vprintfmt+0x57d>
+  801f79:	89 c2                	mov    %eax,%edx
+  801f7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f7f:	83 c0 08             	add    $0x8,%eax
+  801f82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f85:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801f87:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801f8c:	eb 5f                	jmp    801fed <vprintfmt+0x5dc>
+  801f8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f9a:	eb e9                	jmp    801f85 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fa0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fa4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa8:	eb bd                	jmp    801f67 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801faa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fb6:	e9 57 ff ff ff       	jmp    801f12 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801fbb:	4c 89 ee             	mov    %r13,%rsi
+  801fbe:	bf 30 00 00 00       	mov    $0x30,%edi
+  801fc3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801fc6:	4c 89 ee             	mov    %r13,%rsi
+  801fc9:	bf 78 00 00 00       	mov    $0x78,%edi
+  801fce:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801fd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fd4:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd7:	77 47                	ja     802020 <vprintfmt+0x60f>
+  801fd9:	89 c2                	mov    %eax,%edx
+  801fdb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fdf:	83 c0 08             	add    $0x8,%eax
+  801fe2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fe5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fe8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801fed:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801ff5:	0f 94 c0             	sete   %al
+  801ff8:	0f b6 c0             	movzbl %al,%eax
+  801ffb:	50                   	push   %rax
+  801ffc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802001:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802005:	4c 89 ee             	mov    %r13,%rsi
+  802008:	4c 89 f7             	mov    %r14,%rdi
+  80200b:	48 b8 06 19 80 00 00 	movabs $0x801906,%rax
+  802012:	00 00 00 
+  802015:	ff d0                	call   *%rax
+            break;
+  802017:	48 83 c4 10          	add    $0x10,%rsp
+  80201b:	e9 31 fa ff ff       	jmp    801a51 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802020:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802024:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802028:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80202c:	eb b7                	jmp    801fe5 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80202e:	40 84 f6             	test   %sil,%sil
+  802031:	75 2b                	jne    80205e <vprintfmt+0x64d>
+    switch (lflag) {
+  802033:	85 d2                	test   %edx,%edx
+  802035:	7f 56                	jg     80208d <vprintfmt+0x67c>
+  802037:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80203a:	7d 77                	jge    8020b3 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80203c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80203f:	83 f8 2f             	cmp    $0x2f,%eax
+  802042:	0f 87 a7 00 00 00    	ja     8020ef <vprintfmt+0x6de>
+  802048:	89 c2                	mov    %eax,%edx
+  80204a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80204e:	83 c0 08             	add    $0x8,%eax
+  802051:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802054:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802057:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80205c:	eb 8f                	jmp    801fed <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80205e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802061:	83 f8 2f             	cmp    $0x2f,%eax
+  802064:	77 19                	ja     80207f <vprintfmt+0x66e>
+  802066:	89 c2                	mov    %eax,%edx
+  802068:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80206c:	83 c0 08             	add    $0x8,%eax
+  80206f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802072:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802075:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80207a:	e9 6e ff ff ff       	jmp    801fed <vprintfmt+0x5dc>
+  80207f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802083:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802087:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80208b:	eb e5                	jmp    802072 <vprintfmt+0x661>
+    switch (lflag) {
+  80208d:	83 fa 01             	cmp    $0x1,%edx
+  802090:	75 aa                	jne    80203c <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802092:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802095:	83 f8 2f             	cmp    $0x2f,%eax
+  802098:	77 47                	ja     8020e1 <vprintfmt+0x6d0>
+  80209a:	89 c2                	mov    %eax,%edx
+  80209c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020a0:	83 c0 08             	add    $0x8,%eax
+  8020a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020a6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8020a9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8020ae:	e9 3a ff ff ff       	jmp    801fed <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8020b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8020b9:	77 18                	ja     8020d3 <vprintfmt+0x6c2>
+  8020bb:	89 c2                	mov    %eax,%edx
+  8020bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020c1:	83 c0 08             	add    $0x8,%eax
+  8020c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020c7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8020c9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8020ce:	e9 1a ff ff ff       	jmp    801fed <vprintfmt+0x5dc>
+  8020d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020df:	eb e6                	jmp    8020c7 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8020e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020ed:	eb b7                	jmp    8020a6 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8020ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020fb:	e9 54 ff ff ff       	jmp    802054 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802100:	4c 89 ee             	mov    %r13,%rsi
+  802103:	bf 25 00 00 00       	mov    $0x25,%edi
+  802108:	41 ff d6             	call   *%r14
+            break;
+  80210b:	e9 41 f9 ff ff       	jmp    801a51 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802110:	4c 89 ee             	mov    %r13,%rsi
+  802113:	bf 25 00 00 00       	mov    $0x25,%edi
+  802118:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80211b:	48 83 eb 01          	sub    $0x1,%rbx
+  80211f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802123:	75 f6                	jne    80211b <vprintfmt+0x70a>
+  802125:	e9 27 f9 ff ff       	jmp    801a51 <vprintfmt+0x40>
+
+000000000080212a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80212a:	55                   	push   %rbp
+  80212b:	48 89 e5             	mov    %rsp,%rbp
+  80212e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802132:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802136:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80213b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80213f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802146:	48 85 ff             	test   %rdi,%rdi
+  802149:	74 2b                	je     802176 <vsnprintf+0x4c>
+  80214b:	48 85 f6             	test   %rsi,%rsi
+  80214e:	74 26                	je     802176 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802150:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802154:	48 bf bc 19 80 00 00 	movabs $0x8019bc,%rdi
+  80215b:	00 00 00 
+  80215e:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80216a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80216e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802171:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802174:	c9                   	leave
+  802175:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802176:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80217b:	eb f7                	jmp    802174 <vsnprintf+0x4a>
+
+000000000080217d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80217d:	55                   	push   %rbp
+  80217e:	48 89 e5             	mov    %rsp,%rbp
+  802181:	48 83 ec 50          	sub    $0x50,%rsp
+  802185:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802189:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80218d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802191:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802198:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80219c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8021a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8021a8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8021ac:	48 b8 2a 21 80 00 00 	movabs $0x80212a,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8021b8:	c9                   	leave
+  8021b9:	c3                   	ret
+
+00000000008021ba <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8021ba:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8021bd:	74 10                	je     8021cf <strlen+0x15>
+    size_t n = 0;
+  8021bf:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8021c4:	48 83 c0 01          	add    $0x1,%rax
+  8021c8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8021cc:	75 f6                	jne    8021c4 <strlen+0xa>
+  8021ce:	c3                   	ret
+    size_t n = 0;
+  8021cf:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8021d4:	c3                   	ret
+
+00000000008021d5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8021d5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8021d8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8021dd:	48 85 f6             	test   %rsi,%rsi
+  8021e0:	74 11                	je     8021f3 <strnlen+0x1e>
+  8021e2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8021e6:	74 0c                	je     8021f4 <strnlen+0x1f>
+  8021e8:	48 83 c2 01          	add    $0x1,%rdx
+  8021ec:	48 39 d0             	cmp    %rdx,%rax
+  8021ef:	75 f1                	jne    8021e2 <strnlen+0xd>
+  8021f1:	eb 04                	jmp    8021f7 <strnlen+0x22>
+  8021f3:	c3                   	ret
+  8021f4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8021f7:	c3                   	ret
+
+00000000008021f8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8021f8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8021fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802200:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802204:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802207:	48 83 c2 01          	add    $0x1,%rdx
+  80220b:	84 c9                	test   %cl,%cl
+  80220d:	75 f1                	jne    802200 <strcpy+0x8>
+        ;
+    return res;
+}
+  80220f:	c3                   	ret
+
+0000000000802210 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802210:	55                   	push   %rbp
+  802211:	48 89 e5             	mov    %rsp,%rbp
+  802214:	41 54                	push   %r12
+  802216:	53                   	push   %rbx
+  802217:	48 89 fb             	mov    %rdi,%rbx
+  80221a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80221d:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  802224:	00 00 00 
+  802227:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802229:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80222d:	4c 89 e6             	mov    %r12,%rsi
+  802230:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+    return dst;
+}
+  80223c:	48 89 d8             	mov    %rbx,%rax
+  80223f:	5b                   	pop    %rbx
+  802240:	41 5c                	pop    %r12
+  802242:	5d                   	pop    %rbp
+  802243:	c3                   	ret
+
+0000000000802244 <toupper>:
+
+int
+toupper(int ch) {
+  802244:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802246:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802249:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80224c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80224f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802252:	c3                   	ret
+
+0000000000802253 <tolower>:
+
+int
+tolower(int ch) {
+  802253:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802255:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802258:	8d 57 20             	lea    0x20(%rdi),%edx
+  80225b:	83 f9 1a             	cmp    $0x1a,%ecx
+  80225e:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802261:	c3                   	ret
+
+0000000000802262 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802262:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802265:	48 85 d2             	test   %rdx,%rdx
+  802268:	74 1f                	je     802289 <strncpy+0x27>
+  80226a:	48 01 fa             	add    %rdi,%rdx
+  80226d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802270:	48 83 c1 01          	add    $0x1,%rcx
+  802274:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802278:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80227c:	41 80 f8 01          	cmp    $0x1,%r8b
+  802280:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802284:	48 39 ca             	cmp    %rcx,%rdx
+  802287:	75 e7                	jne    802270 <strncpy+0xe>
+    }
+    return ret;
+}
+  802289:	c3                   	ret
+
+000000000080228a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80228a:	48 89 f8             	mov    %rdi,%rax
+  80228d:	48 85 d2             	test   %rdx,%rdx
+  802290:	74 24                	je     8022b6 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802292:	48 83 ea 01          	sub    $0x1,%rdx
+  802296:	74 1b                	je     8022b3 <strlcpy+0x29>
+  802298:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80229c:	0f b6 16             	movzbl (%rsi),%edx
+  80229f:	84 d2                	test   %dl,%dl
+  8022a1:	74 10                	je     8022b3 <strlcpy+0x29>
+            *dst++ = *src++;
+  8022a3:	48 83 c6 01          	add    $0x1,%rsi
+  8022a7:	48 83 c0 01          	add    $0x1,%rax
+  8022ab:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8022ae:	48 39 c8             	cmp    %rcx,%rax
+  8022b1:	75 e9                	jne    80229c <strlcpy+0x12>
+        *dst = '\0';
+  8022b3:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8022b6:	48 29 f8             	sub    %rdi,%rax
+}
+  8022b9:	c3                   	ret
+
+00000000008022ba <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8022ba:	0f b6 07             	movzbl (%rdi),%eax
+  8022bd:	84 c0                	test   %al,%al
+  8022bf:	74 13                	je     8022d4 <strcmp+0x1a>
+  8022c1:	38 06                	cmp    %al,(%rsi)
+  8022c3:	75 0f                	jne    8022d4 <strcmp+0x1a>
+  8022c5:	48 83 c7 01          	add    $0x1,%rdi
+  8022c9:	48 83 c6 01          	add    $0x1,%rsi
+  8022cd:	0f b6 07             	movzbl (%rdi),%eax
+  8022d0:	84 c0                	test   %al,%al
+  8022d2:	75 ed                	jne    8022c1 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022d4:	0f b6 c0             	movzbl %al,%eax
+  8022d7:	0f b6 16             	movzbl (%rsi),%edx
+  8022da:	29 d0                	sub    %edx,%eax
+}
+  8022dc:	c3                   	ret
+
+00000000008022dd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8022dd:	48 85 d2             	test   %rdx,%rdx
+  8022e0:	74 1f                	je     802301 <strncmp+0x24>
+  8022e2:	0f b6 07             	movzbl (%rdi),%eax
+  8022e5:	84 c0                	test   %al,%al
+  8022e7:	74 1e                	je     802307 <strncmp+0x2a>
+  8022e9:	3a 06                	cmp    (%rsi),%al
+  8022eb:	75 1a                	jne    802307 <strncmp+0x2a>
+  8022ed:	48 83 c7 01          	add    $0x1,%rdi
+  8022f1:	48 83 c6 01          	add    $0x1,%rsi
+  8022f5:	48 83 ea 01          	sub    $0x1,%rdx
+  8022f9:	75 e7                	jne    8022e2 <strncmp+0x5>
+
+    if (!n) return 0;
+  8022fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802300:	c3                   	ret
+  802301:	b8 00 00 00 00       	mov    $0x0,%eax
+  802306:	c3                   	ret
+  802307:	48 85 d2             	test   %rdx,%rdx
+  80230a:	74 09                	je     802315 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80230c:	0f b6 07             	movzbl (%rdi),%eax
+  80230f:	0f b6 16             	movzbl (%rsi),%edx
+  802312:	29 d0                	sub    %edx,%eax
+  802314:	c3                   	ret
+    if (!n) return 0;
+  802315:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80231a:	c3                   	ret
+
+000000000080231b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80231b:	0f b6 17             	movzbl (%rdi),%edx
+  80231e:	84 d2                	test   %dl,%dl
+  802320:	74 18                	je     80233a <strchr+0x1f>
+        if (*str == c) {
+  802322:	0f be d2             	movsbl %dl,%edx
+  802325:	39 f2                	cmp    %esi,%edx
+  802327:	74 17                	je     802340 <strchr+0x25>
+    for (; *str; str++) {
+  802329:	48 83 c7 01          	add    $0x1,%rdi
+  80232d:	0f b6 17             	movzbl (%rdi),%edx
+  802330:	84 d2                	test   %dl,%dl
+  802332:	75 ee                	jne    802322 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802334:	b8 00 00 00 00       	mov    $0x0,%eax
+  802339:	c3                   	ret
+  80233a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233f:	c3                   	ret
+  802340:	48 89 f8             	mov    %rdi,%rax
+}
+  802343:	c3                   	ret
+
+0000000000802344 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802344:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802347:	0f b6 17             	movzbl (%rdi),%edx
+  80234a:	84 d2                	test   %dl,%dl
+  80234c:	74 13                	je     802361 <strfind+0x1d>
+  80234e:	0f be d2             	movsbl %dl,%edx
+  802351:	39 f2                	cmp    %esi,%edx
+  802353:	74 0b                	je     802360 <strfind+0x1c>
+  802355:	48 83 c0 01          	add    $0x1,%rax
+  802359:	0f b6 10             	movzbl (%rax),%edx
+  80235c:	84 d2                	test   %dl,%dl
+  80235e:	75 ee                	jne    80234e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802360:	c3                   	ret
+  802361:	c3                   	ret
+
+0000000000802362 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802362:	48 39 f7             	cmp    %rsi,%rdi
+  802365:	74 65                	je     8023cc <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802367:	55                   	push   %rbp
+  802368:	48 89 e5             	mov    %rsp,%rbp
+  80236b:	41 57                	push   %r15
+  80236d:	41 56                	push   %r14
+  80236f:	41 55                	push   %r13
+  802371:	41 54                	push   %r12
+  802373:	53                   	push   %rbx
+  802374:	48 83 ec 18          	sub    $0x18,%rsp
+  802378:	48 89 fb             	mov    %rdi,%rbx
+  80237b:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80237e:	49 bf 53 22 80 00 00 	movabs $0x802253,%r15
+  802385:	00 00 00 
+  802388:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80238c:	41 0f b6 fd          	movzbl %r13b,%edi
+  802390:	41 ff d7             	call   *%r15
+  802393:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802396:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80239b:	41 0f b6 fe          	movzbl %r14b,%edi
+  80239f:	41 ff d7             	call   *%r15
+  8023a2:	89 c2                	mov    %eax,%edx
+  8023a4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8023a7:	29 d0                	sub    %edx,%eax
+  8023a9:	75 12                	jne    8023bd <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8023ab:	48 83 c3 01          	add    $0x1,%rbx
+  8023af:	45 84 ed             	test   %r13b,%r13b
+  8023b2:	74 09                	je     8023bd <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8023b4:	49 83 c4 01          	add    $0x1,%r12
+  8023b8:	45 84 f6             	test   %r14b,%r14b
+  8023bb:	75 cb                	jne    802388 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8023bd:	48 83 c4 18          	add    $0x18,%rsp
+  8023c1:	5b                   	pop    %rbx
+  8023c2:	41 5c                	pop    %r12
+  8023c4:	41 5d                	pop    %r13
+  8023c6:	41 5e                	pop    %r14
+  8023c8:	41 5f                	pop    %r15
+  8023ca:	5d                   	pop    %rbp
+  8023cb:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d1:	c3                   	ret
+
+00000000008023d2 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8023d2:	48 39 f7             	cmp    %rsi,%rdi
+  8023d5:	74 7d                	je     802454 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8023d7:	55                   	push   %rbp
+  8023d8:	48 89 e5             	mov    %rsp,%rbp
+  8023db:	41 57                	push   %r15
+  8023dd:	41 56                	push   %r14
+  8023df:	41 55                	push   %r13
+  8023e1:	41 54                	push   %r12
+  8023e3:	53                   	push   %rbx
+  8023e4:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e8:	48 89 fb             	mov    %rdi,%rbx
+  8023eb:	49 89 f4             	mov    %rsi,%r12
+  8023ee:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8023f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023f6:	49 bf 53 22 80 00 00 	movabs $0x802253,%r15
+  8023fd:	00 00 00 
+    while (n--) {
+  802400:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802404:	48 39 c3             	cmp    %rax,%rbx
+  802407:	74 37                	je     802440 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802409:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80240d:	41 0f b6 fd          	movzbl %r13b,%edi
+  802411:	41 ff d7             	call   *%r15
+  802414:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802417:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80241c:	41 0f b6 fe          	movzbl %r14b,%edi
+  802420:	41 ff d7             	call   *%r15
+  802423:	89 c2                	mov    %eax,%edx
+  802425:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802428:	29 d0                	sub    %edx,%eax
+  80242a:	75 19                	jne    802445 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80242c:	48 83 c3 01          	add    $0x1,%rbx
+  802430:	45 84 ed             	test   %r13b,%r13b
+  802433:	74 10                	je     802445 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802435:	49 83 c4 01          	add    $0x1,%r12
+  802439:	45 84 f6             	test   %r14b,%r14b
+  80243c:	75 c2                	jne    802400 <strncasecmp+0x2e>
+  80243e:	eb 05                	jmp    802445 <strncasecmp+0x73>
+  802440:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802445:	48 83 c4 18          	add    $0x18,%rsp
+  802449:	5b                   	pop    %rbx
+  80244a:	41 5c                	pop    %r12
+  80244c:	41 5d                	pop    %r13
+  80244e:	41 5e                	pop    %r14
+  802450:	41 5f                	pop    %r15
+  802452:	5d                   	pop    %rbp
+  802453:	c3                   	ret
+    if (p1 == p2) return 0;
+  802454:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802459:	c3                   	ret
+
+000000000080245a <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80245a:	83 e7 df             	and    $0xffffffdf,%edi
+  80245d:	83 ef 41             	sub    $0x41,%edi
+  802460:	83 ff 19             	cmp    $0x19,%edi
+  802463:	0f 96 c0             	setbe  %al
+}
+  802466:	c3                   	ret
+
+0000000000802467 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802467:	83 ff 20             	cmp    $0x20,%edi
+  80246a:	0f 94 c0             	sete   %al
+  80246d:	83 ff 09             	cmp    $0x9,%edi
+  802470:	0f 94 c2             	sete   %dl
+  802473:	09 d0                	or     %edx,%eax
+}
+  802475:	c3                   	ret
+
+0000000000802476 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802476:	55                   	push   %rbp
+  802477:	48 89 e5             	mov    %rsp,%rbp
+  80247a:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80247c:	48 bf 3f 63 80 00 00 	movabs $0x80633f,%rdi
+  802483:	00 00 00 
+  802486:	48 b8 1b 23 80 00 00 	movabs $0x80231b,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+  802492:	48 85 c0             	test   %rax,%rax
+  802495:	0f 95 c0             	setne  %al
+}
+  802498:	5d                   	pop    %rbp
+  802499:	c3                   	ret
+
+000000000080249a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80249a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80249d:	48 89 f8             	mov    %rdi,%rax
+  8024a0:	48 f7 d8             	neg    %rax
+  8024a3:	83 e0 07             	and    $0x7,%eax
+  8024a6:	49 89 d1             	mov    %rdx,%r9
+  8024a9:	49 29 c1             	sub    %rax,%r9
+  8024ac:	78 36                	js     8024e4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8024ae:	40 0f b6 c6          	movzbl %sil,%eax
+  8024b2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8024b9:	01 01 01 
+  8024bc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8024c0:	40 f6 c7 07          	test   $0x7,%dil
+  8024c4:	75 38                	jne    8024fe <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8024c6:	4c 89 c9             	mov    %r9,%rcx
+  8024c9:	48 c1 f9 03          	sar    $0x3,%rcx
+  8024cd:	74 0c                	je     8024db <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8024cf:	fc                   	cld
+  8024d0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8024d3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8024d7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8024db:	4d 85 c9             	test   %r9,%r9
+  8024de:	75 45                	jne    802525 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8024e0:	4c 89 c0             	mov    %r8,%rax
+  8024e3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8024e4:	48 85 d2             	test   %rdx,%rdx
+  8024e7:	74 f7                	je     8024e0 <memset+0x46>
+  8024e9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8024ec:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8024ef:	48 83 c0 01          	add    $0x1,%rax
+  8024f3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8024f7:	48 39 c2             	cmp    %rax,%rdx
+  8024fa:	75 f3                	jne    8024ef <memset+0x55>
+  8024fc:	eb e2                	jmp    8024e0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8024fe:	40 f6 c7 01          	test   $0x1,%dil
+  802502:	74 06                	je     80250a <memset+0x70>
+  802504:	88 07                	mov    %al,(%rdi)
+  802506:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80250a:	40 f6 c7 02          	test   $0x2,%dil
+  80250e:	74 07                	je     802517 <memset+0x7d>
+  802510:	66 89 07             	mov    %ax,(%rdi)
+  802513:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802517:	40 f6 c7 04          	test   $0x4,%dil
+  80251b:	74 a9                	je     8024c6 <memset+0x2c>
+  80251d:	89 07                	mov    %eax,(%rdi)
+  80251f:	48 83 c7 04          	add    $0x4,%rdi
+  802523:	eb a1                	jmp    8024c6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802525:	41 f6 c1 04          	test   $0x4,%r9b
+  802529:	74 06                	je     802531 <memset+0x97>
+  80252b:	89 07                	mov    %eax,(%rdi)
+  80252d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802531:	41 f6 c1 02          	test   $0x2,%r9b
+  802535:	74 07                	je     80253e <memset+0xa4>
+  802537:	66 89 07             	mov    %ax,(%rdi)
+  80253a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80253e:	41 f6 c1 01          	test   $0x1,%r9b
+  802542:	74 9c                	je     8024e0 <memset+0x46>
+  802544:	88 07                	mov    %al,(%rdi)
+  802546:	eb 98                	jmp    8024e0 <memset+0x46>
+
+0000000000802548 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802548:	48 89 f8             	mov    %rdi,%rax
+  80254b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80254e:	48 39 fe             	cmp    %rdi,%rsi
+  802551:	73 3b                	jae    80258e <memmove+0x46>
+  802553:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802557:	48 39 d7             	cmp    %rdx,%rdi
+  80255a:	73 32                	jae    80258e <memmove+0x46>
+        s += n;
+        d += n;
+  80255c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802560:	48 89 d6             	mov    %rdx,%rsi
+  802563:	48 09 fe             	or     %rdi,%rsi
+  802566:	48 09 ce             	or     %rcx,%rsi
+  802569:	40 f6 c6 07          	test   $0x7,%sil
+  80256d:	75 12                	jne    802581 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80256f:	48 83 ef 08          	sub    $0x8,%rdi
+  802573:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802577:	48 c1 e9 03          	shr    $0x3,%rcx
+  80257b:	fd                   	std
+  80257c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80257f:	fc                   	cld
+  802580:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802581:	48 83 ef 01          	sub    $0x1,%rdi
+  802585:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802589:	fd                   	std
+  80258a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80258c:	eb f1                	jmp    80257f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80258e:	48 89 f2             	mov    %rsi,%rdx
+  802591:	48 09 c2             	or     %rax,%rdx
+  802594:	48 09 ca             	or     %rcx,%rdx
+  802597:	f6 c2 07             	test   $0x7,%dl
+  80259a:	75 0c                	jne    8025a8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80259c:	48 c1 e9 03          	shr    $0x3,%rcx
+  8025a0:	48 89 c7             	mov    %rax,%rdi
+  8025a3:	fc                   	cld
+  8025a4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8025a7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8025a8:	48 89 c7             	mov    %rax,%rdi
+  8025ab:	fc                   	cld
+  8025ac:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8025ae:	c3                   	ret
+
+00000000008025af <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8025af:	55                   	push   %rbp
+  8025b0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8025b3:	48 b8 48 25 80 00 00 	movabs $0x802548,%rax
+  8025ba:	00 00 00 
+  8025bd:	ff d0                	call   *%rax
+}
+  8025bf:	5d                   	pop    %rbp
+  8025c0:	c3                   	ret
+
+00000000008025c1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8025c1:	55                   	push   %rbp
+  8025c2:	48 89 e5             	mov    %rsp,%rbp
+  8025c5:	41 57                	push   %r15
+  8025c7:	41 56                	push   %r14
+  8025c9:	41 55                	push   %r13
+  8025cb:	41 54                	push   %r12
+  8025cd:	53                   	push   %rbx
+  8025ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d2:	49 89 fe             	mov    %rdi,%r14
+  8025d5:	49 89 f7             	mov    %rsi,%r15
+  8025d8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8025db:	48 89 f7             	mov    %rsi,%rdi
+  8025de:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+  8025ea:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8025ed:	48 89 de             	mov    %rbx,%rsi
+  8025f0:	4c 89 f7             	mov    %r14,%rdi
+  8025f3:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  8025fa:	00 00 00 
+  8025fd:	ff d0                	call   *%rax
+  8025ff:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802602:	48 39 c3             	cmp    %rax,%rbx
+  802605:	74 36                	je     80263d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802607:	48 89 d8             	mov    %rbx,%rax
+  80260a:	4c 29 e8             	sub    %r13,%rax
+  80260d:	49 39 c4             	cmp    %rax,%r12
+  802610:	73 31                	jae    802643 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802612:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802617:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80261b:	4c 89 fe             	mov    %r15,%rsi
+  80261e:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80262a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80262e:	48 83 c4 08          	add    $0x8,%rsp
+  802632:	5b                   	pop    %rbx
+  802633:	41 5c                	pop    %r12
+  802635:	41 5d                	pop    %r13
+  802637:	41 5e                	pop    %r14
+  802639:	41 5f                	pop    %r15
+  80263b:	5d                   	pop    %rbp
+  80263c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80263d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802641:	eb eb                	jmp    80262e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802643:	48 83 eb 01          	sub    $0x1,%rbx
+  802647:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80264b:	48 89 da             	mov    %rbx,%rdx
+  80264e:	4c 89 fe             	mov    %r15,%rsi
+  802651:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  802658:	00 00 00 
+  80265b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80265d:	49 01 de             	add    %rbx,%r14
+  802660:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802665:	eb c3                	jmp    80262a <strlcat+0x69>
+
+0000000000802667 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802667:	48 85 d2             	test   %rdx,%rdx
+  80266a:	74 2d                	je     802699 <memcmp+0x32>
+  80266c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802671:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802675:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80267a:	44 38 c1             	cmp    %r8b,%cl
+  80267d:	75 0f                	jne    80268e <memcmp+0x27>
+    while (n-- > 0) {
+  80267f:	48 83 c0 01          	add    $0x1,%rax
+  802683:	48 39 c2             	cmp    %rax,%rdx
+  802686:	75 e9                	jne    802671 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80268e:	0f b6 c1             	movzbl %cl,%eax
+  802691:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802695:	44 29 c0             	sub    %r8d,%eax
+  802698:	c3                   	ret
+    return 0;
+  802699:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80269e:	c3                   	ret
+
+000000000080269f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80269f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8026a3:	48 39 c7             	cmp    %rax,%rdi
+  8026a6:	73 0f                	jae    8026b7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8026a8:	40 38 37             	cmp    %sil,(%rdi)
+  8026ab:	74 0e                	je     8026bb <memfind+0x1c>
+    for (; src < end; src++) {
+  8026ad:	48 83 c7 01          	add    $0x1,%rdi
+  8026b1:	48 39 f8             	cmp    %rdi,%rax
+  8026b4:	75 f2                	jne    8026a8 <memfind+0x9>
+  8026b6:	c3                   	ret
+  8026b7:	48 89 f8             	mov    %rdi,%rax
+  8026ba:	c3                   	ret
+  8026bb:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8026be:	c3                   	ret
+
+00000000008026bf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8026bf:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8026c2:	0f b6 37             	movzbl (%rdi),%esi
+  8026c5:	40 80 fe 20          	cmp    $0x20,%sil
+  8026c9:	74 06                	je     8026d1 <strtol+0x12>
+  8026cb:	40 80 fe 09          	cmp    $0x9,%sil
+  8026cf:	75 13                	jne    8026e4 <strtol+0x25>
+  8026d1:	48 83 c7 01          	add    $0x1,%rdi
+  8026d5:	0f b6 37             	movzbl (%rdi),%esi
+  8026d8:	40 80 fe 20          	cmp    $0x20,%sil
+  8026dc:	74 f3                	je     8026d1 <strtol+0x12>
+  8026de:	40 80 fe 09          	cmp    $0x9,%sil
+  8026e2:	74 ed                	je     8026d1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8026e4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8026e7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8026ea:	3c 01                	cmp    $0x1,%al
+  8026ec:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026f0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8026f6:	75 0f                	jne    802707 <strtol+0x48>
+  8026f8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8026fb:	74 14                	je     802711 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8026fd:	85 d2                	test   %edx,%edx
+  8026ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802704:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802707:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80270c:	4c 63 ca             	movslq %edx,%r9
+  80270f:	eb 36                	jmp    802747 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802711:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802715:	74 0f                	je     802726 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802717:	85 d2                	test   %edx,%edx
+  802719:	75 ec                	jne    802707 <strtol+0x48>
+        s++;
+  80271b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80271f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802724:	eb e1                	jmp    802707 <strtol+0x48>
+        s += 2;
+  802726:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80272a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80272f:	eb d6                	jmp    802707 <strtol+0x48>
+            dig -= '0';
+  802731:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802734:	44 0f b6 c1          	movzbl %cl,%r8d
+  802738:	41 39 d0             	cmp    %edx,%r8d
+  80273b:	7d 21                	jge    80275e <strtol+0x9f>
+        val = val * base + dig;
+  80273d:	49 0f af c1          	imul   %r9,%rax
+  802741:	0f b6 c9             	movzbl %cl,%ecx
+  802744:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802747:	48 83 c7 01          	add    $0x1,%rdi
+  80274b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80274f:	80 f9 39             	cmp    $0x39,%cl
+  802752:	76 dd                	jbe    802731 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802754:	80 f9 7b             	cmp    $0x7b,%cl
+  802757:	77 05                	ja     80275e <strtol+0x9f>
+            dig -= 'a' - 10;
+  802759:	83 e9 57             	sub    $0x57,%ecx
+  80275c:	eb d6                	jmp    802734 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80275e:	4d 85 d2             	test   %r10,%r10
+  802761:	74 03                	je     802766 <strtol+0xa7>
+  802763:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802766:	48 89 c2             	mov    %rax,%rdx
+  802769:	48 f7 da             	neg    %rdx
+  80276c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802770:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802774:	c3                   	ret
+
+0000000000802775 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802775:	55                   	push   %rbp
+  802776:	48 89 e5             	mov    %rsp,%rbp
+  802779:	53                   	push   %rbx
+  80277a:	48 89 fa             	mov    %rdi,%rdx
+  80277d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802780:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802785:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80278a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80278f:	be 00 00 00 00       	mov    $0x0,%esi
+  802794:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80279a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027a0:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8027a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027a6:	c9                   	leave
+  8027a7:	c3                   	ret
+
+00000000008027a8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8027a8:	55                   	push   %rbp
+  8027a9:	48 89 e5             	mov    %rsp,%rbp
+  8027ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ad:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027dd:	c9                   	leave
+  8027de:	c3                   	ret
+
+00000000008027df <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8027df:	55                   	push   %rbp
+  8027e0:	48 89 e5             	mov    %rsp,%rbp
+  8027e3:	53                   	push   %rbx
+  8027e4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027e7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802800:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802806:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80280c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  80280e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+
+0000000000802814 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802814:	55                   	push   %rbp
+  802815:	48 89 e5             	mov    %rsp,%rbp
+  802818:	53                   	push   %rbx
+  802819:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  80281d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802820:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802825:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80282a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80282f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802834:	be 00 00 00 00       	mov    $0x0,%esi
+  802839:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80283f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802845:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802847:	48 85 c0             	test   %rax,%rax
+  80284a:	7f 06                	jg     802852 <sys_env_destroy+0x3e>
+}
+  80284c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802850:	c9                   	leave
+  802851:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802852:	49 89 c0             	mov    %rax,%r8
+  802855:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80285a:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802861:	00 00 00 
+  802864:	be 27 00 00 00       	mov    $0x27,%esi
+  802869:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802870:	00 00 00 
+  802873:	b8 00 00 00 00       	mov    $0x0,%eax
+  802878:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  80287f:	00 00 00 
+  802882:	41 ff d1             	call   *%r9
+
+0000000000802885 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802885:	55                   	push   %rbp
+  802886:	48 89 e5             	mov    %rsp,%rbp
+  802889:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80288a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80288f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802894:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802899:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80289e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+
+00000000008028bc <sys_yield>:
+
+void
+sys_yield(void) {
+  8028bc:	55                   	push   %rbp
+  8028bd:	48 89 e5             	mov    %rsp,%rbp
+  8028c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028c1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028da:	be 00 00 00 00       	mov    $0x0,%esi
+  8028df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028eb:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028f1:	c9                   	leave
+  8028f2:	c3                   	ret
+
+00000000008028f3 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8028f3:	55                   	push   %rbp
+  8028f4:	48 89 e5             	mov    %rsp,%rbp
+  8028f7:	53                   	push   %rbx
+  8028f8:	48 89 fa             	mov    %rdi,%rdx
+  8028fb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028fe:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802903:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80290a:	00 00 00 
+  80290d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802912:	be 00 00 00 00       	mov    $0x0,%esi
+  802917:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80291d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802923:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802925:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802929:	c9                   	leave
+  80292a:	c3                   	ret
+
+000000000080292b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80292b:	55                   	push   %rbp
+  80292c:	48 89 e5             	mov    %rsp,%rbp
+  80292f:	53                   	push   %rbx
+  802930:	49 89 f8             	mov    %rdi,%r8
+  802933:	48 89 d3             	mov    %rdx,%rbx
+  802936:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802939:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80293e:	4c 89 c2             	mov    %r8,%rdx
+  802941:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802944:	be 00 00 00 00       	mov    $0x0,%esi
+  802949:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80294f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802955:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802957:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80295b:	c9                   	leave
+  80295c:	c3                   	ret
+
+000000000080295d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80295d:	55                   	push   %rbp
+  80295e:	48 89 e5             	mov    %rsp,%rbp
+  802961:	53                   	push   %rbx
+  802962:	48 83 ec 08          	sub    $0x8,%rsp
+  802966:	89 f8                	mov    %edi,%eax
+  802968:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80296b:	48 63 f9             	movslq %ecx,%rdi
+  80296e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802971:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802976:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802979:	be 00 00 00 00       	mov    $0x0,%esi
+  80297e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802984:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80298a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80298c:	48 85 c0             	test   %rax,%rax
+  80298f:	7f 06                	jg     802997 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802991:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802997:	49 89 c0             	mov    %rax,%r8
+  80299a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80299f:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  8029a6:	00 00 00 
+  8029a9:	be 27 00 00 00       	mov    $0x27,%esi
+  8029ae:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  8029b5:	00 00 00 
+  8029b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bd:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  8029c4:	00 00 00 
+  8029c7:	41 ff d1             	call   *%r9
+
+00000000008029ca <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8029ca:	55                   	push   %rbp
+  8029cb:	48 89 e5             	mov    %rsp,%rbp
+  8029ce:	53                   	push   %rbx
+  8029cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d3:	89 f8                	mov    %edi,%eax
+  8029d5:	49 89 f2             	mov    %rsi,%r10
+  8029d8:	48 89 cf             	mov    %rcx,%rdi
+  8029db:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8029de:	48 63 da             	movslq %edx,%rbx
+  8029e1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029e4:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029e9:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ec:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8029ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029f7:	48 85 c0             	test   %rax,%rax
+  8029fa:	7f 06                	jg     802a02 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8029fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a02:	49 89 c0             	mov    %rax,%r8
+  802a05:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802a0a:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802a11:	00 00 00 
+  802a14:	be 27 00 00 00       	mov    $0x27,%esi
+  802a19:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802a20:	00 00 00 
+  802a23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a28:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802a2f:	00 00 00 
+  802a32:	41 ff d1             	call   *%r9
+
+0000000000802a35 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802a35:	55                   	push   %rbp
+  802a36:	48 89 e5             	mov    %rsp,%rbp
+  802a39:	53                   	push   %rbx
+  802a3a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3e:	48 89 f1             	mov    %rsi,%rcx
+  802a41:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802a44:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a47:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a4c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a51:	be 00 00 00 00       	mov    $0x0,%esi
+  802a56:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a62:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a64:	48 85 c0             	test   %rax,%rax
+  802a67:	7f 06                	jg     802a6f <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802a69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a6d:	c9                   	leave
+  802a6e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a6f:	49 89 c0             	mov    %rax,%r8
+  802a72:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a77:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802a7e:	00 00 00 
+  802a81:	be 27 00 00 00       	mov    $0x27,%esi
+  802a86:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802a8d:	00 00 00 
+  802a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a95:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802a9c:	00 00 00 
+  802a9f:	41 ff d1             	call   *%r9
+
+0000000000802aa2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802aa2:	55                   	push   %rbp
+  802aa3:	48 89 e5             	mov    %rsp,%rbp
+  802aa6:	53                   	push   %rbx
+  802aa7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802aab:	48 63 ce             	movslq %esi,%rcx
+  802aae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ab1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ab6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802abb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802acb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ad3:	48 85 c0             	test   %rax,%rax
+  802ad6:	7f 06                	jg     802ade <sys_env_set_status+0x3c>
+}
+  802ad8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802adc:	c9                   	leave
+  802add:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ade:	49 89 c0             	mov    %rax,%r8
+  802ae1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802ae6:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802aed:	00 00 00 
+  802af0:	be 27 00 00 00       	mov    $0x27,%esi
+  802af5:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802afc:	00 00 00 
+  802aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b04:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802b0b:	00 00 00 
+  802b0e:	41 ff d1             	call   *%r9
+
+0000000000802b11 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802b11:	55                   	push   %rbp
+  802b12:	48 89 e5             	mov    %rsp,%rbp
+  802b15:	53                   	push   %rbx
+  802b16:	48 83 ec 08          	sub    $0x8,%rsp
+  802b1a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802b1d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b20:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b2a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b40:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b42:	48 85 c0             	test   %rax,%rax
+  802b45:	7f 06                	jg     802b4d <sys_env_set_trapframe+0x3c>
+}
+  802b47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4b:	c9                   	leave
+  802b4c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b4d:	49 89 c0             	mov    %rax,%r8
+  802b50:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802b55:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802b5c:	00 00 00 
+  802b5f:	be 27 00 00 00       	mov    $0x27,%esi
+  802b64:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802b6b:	00 00 00 
+  802b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b73:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802b7a:	00 00 00 
+  802b7d:	41 ff d1             	call   *%r9
+
+0000000000802b80 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802b80:	55                   	push   %rbp
+  802b81:	48 89 e5             	mov    %rsp,%rbp
+  802b84:	53                   	push   %rbx
+  802b85:	48 83 ec 08          	sub    $0x8,%rsp
+  802b89:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802b8c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b8f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b99:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b9e:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ba9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802baf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bb1:	48 85 c0             	test   %rax,%rax
+  802bb4:	7f 06                	jg     802bbc <sys_env_set_pgfault_upcall+0x3c>
+}
+  802bb6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bba:	c9                   	leave
+  802bbb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bbc:	49 89 c0             	mov    %rax,%r8
+  802bbf:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802bc4:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802bcb:	00 00 00 
+  802bce:	be 27 00 00 00       	mov    $0x27,%esi
+  802bd3:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802bda:	00 00 00 
+  802bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be2:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802be9:	00 00 00 
+  802bec:	41 ff d1             	call   *%r9
+
+0000000000802bef <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802bef:	55                   	push   %rbp
+  802bf0:	48 89 e5             	mov    %rsp,%rbp
+  802bf3:	53                   	push   %rbx
+  802bf4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802bf8:	40 0f b6 ce          	movzbl %sil,%ecx
+  802bfc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bff:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c09:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c0e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c1f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c21:	48 85 c0             	test   %rax,%rax
+  802c24:	7f 06                	jg     802c2c <sys_env_set_reclaim+0x3d>
+}
+  802c26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c2a:	c9                   	leave
+  802c2b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c2c:	49 89 c0             	mov    %rax,%r8
+  802c2f:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802c34:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802c3b:	00 00 00 
+  802c3e:	be 27 00 00 00       	mov    $0x27,%esi
+  802c43:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802c4a:	00 00 00 
+  802c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c52:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802c59:	00 00 00 
+  802c5c:	41 ff d1             	call   *%r9
+
+0000000000802c5f <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802c5f:	55                   	push   %rbp
+  802c60:	48 89 e5             	mov    %rsp,%rbp
+  802c63:	53                   	push   %rbx
+  802c64:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802c68:	48 63 ce             	movslq %esi,%rcx
+  802c6b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c6e:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802c82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c8e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c90:	48 85 c0             	test   %rax,%rax
+  802c93:	7f 06                	jg     802c9b <sys_env_set_nice+0x3c>
+}
+  802c95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c99:	c9                   	leave
+  802c9a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c9b:	49 89 c0             	mov    %rax,%r8
+  802c9e:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802ca3:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802caa:	00 00 00 
+  802cad:	be 27 00 00 00       	mov    $0x27,%esi
+  802cb2:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802cb9:	00 00 00 
+  802cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc1:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802cc8:	00 00 00 
+  802ccb:	41 ff d1             	call   *%r9
+
+0000000000802cce <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802cce:	55                   	push   %rbp
+  802ccf:	48 89 e5             	mov    %rsp,%rbp
+  802cd2:	53                   	push   %rbx
+  802cd3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cd6:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ce0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cea:	be 00 00 00 00       	mov    $0x0,%esi
+  802cef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cf5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cfb:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802cfd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+
+0000000000802d03 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	53                   	push   %rbx
+  802d08:	89 f8                	mov    %edi,%eax
+  802d0a:	49 89 f1             	mov    %rsi,%r9
+  802d0d:	48 89 d3             	mov    %rdx,%rbx
+  802d10:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d13:	49 63 f0             	movslq %r8d,%rsi
+  802d16:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d19:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d1e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2d:	cd 30                	int    $0x30
+}
+  802d2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d33:	c9                   	leave
+  802d34:	c3                   	ret
+
+0000000000802d35 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d35:	55                   	push   %rbp
+  802d36:	48 89 e5             	mov    %rsp,%rbp
+  802d39:	53                   	push   %rbx
+  802d3a:	89 f8                	mov    %edi,%eax
+  802d3c:	49 89 f1             	mov    %rsi,%r9
+  802d3f:	48 89 d3             	mov    %rdx,%rbx
+  802d42:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d45:	49 63 f0             	movslq %r8d,%rsi
+  802d48:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d4b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d50:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d59:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d5f:	cd 30                	int    $0x30
+}
+  802d61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d65:	c9                   	leave
+  802d66:	c3                   	ret
+
+0000000000802d67 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d67:	55                   	push   %rbp
+  802d68:	48 89 e5             	mov    %rsp,%rbp
+  802d6b:	53                   	push   %rbx
+  802d6c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d70:	89 f8                	mov    %edi,%eax
+  802d72:	49 89 f2             	mov    %rsi,%r10
+  802d75:	48 89 d3             	mov    %rdx,%rbx
+  802d78:	48 89 cf             	mov    %rcx,%rdi
+  802d7b:	44 89 c6             	mov    %r8d,%esi
+  802d7e:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d81:	48 63 f6             	movslq %esi,%rsi
+  802d84:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d87:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d8c:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d8f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d93:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d95:	48 85 c0             	test   %rax,%rax
+  802d98:	7f 06                	jg     802da0 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d9e:	c9                   	leave
+  802d9f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802da0:	49 89 c0             	mov    %rax,%r8
+  802da3:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802da8:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802daf:	00 00 00 
+  802db2:	be 27 00 00 00       	mov    $0x27,%esi
+  802db7:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802dbe:	00 00 00 
+  802dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc6:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802dcd:	00 00 00 
+  802dd0:	41 ff d1             	call   *%r9
+
+0000000000802dd3 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802dd3:	55                   	push   %rbp
+  802dd4:	48 89 e5             	mov    %rsp,%rbp
+  802dd7:	53                   	push   %rbx
+  802dd8:	48 83 ec 08          	sub    $0x8,%rsp
+  802ddc:	48 89 f1             	mov    %rsi,%rcx
+  802ddf:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802de2:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802de6:	48 8b 1a             	mov    (%rdx),%rbx
+  802de9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dec:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df1:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802df5:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802df9:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802dfd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dff:	48 85 c0             	test   %rax,%rax
+  802e02:	7f 06                	jg     802e0a <sys_ipc_call_short+0x37>
+}
+  802e04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e08:	c9                   	leave
+  802e09:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e0a:	49 89 c0             	mov    %rax,%r8
+  802e0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802e12:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802e19:	00 00 00 
+  802e1c:	be 27 00 00 00       	mov    $0x27,%esi
+  802e21:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802e28:	00 00 00 
+  802e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e30:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802e37:	00 00 00 
+  802e3a:	41 ff d1             	call   *%r9
+
+0000000000802e3d <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e3d:	55                   	push   %rbp
+  802e3e:	48 89 e5             	mov    %rsp,%rbp
+  802e41:	53                   	push   %rbx
+  802e42:	48 83 ec 08          	sub    $0x8,%rsp
+  802e46:	89 f8                	mov    %edi,%eax
+  802e48:	49 89 f2             	mov    %rsi,%r10
+  802e4b:	48 89 d3             	mov    %rdx,%rbx
+  802e4e:	48 89 cf             	mov    %rcx,%rdi
+  802e51:	44 89 c6             	mov    %r8d,%esi
+  802e54:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e57:	48 63 f6             	movslq %esi,%rsi
+  802e5a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e5d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e62:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e65:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e69:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e6b:	48 85 c0             	test   %rax,%rax
+  802e6e:	7f 06                	jg     802e76 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e74:	c9                   	leave
+  802e75:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e76:	49 89 c0             	mov    %rax,%r8
+  802e79:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802e7e:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802e85:	00 00 00 
+  802e88:	be 27 00 00 00       	mov    $0x27,%esi
+  802e8d:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802e94:	00 00 00 
+  802e97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9c:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802ea3:	00 00 00 
+  802ea6:	41 ff d1             	call   *%r9
+
+0000000000802ea9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802ea9:	55                   	push   %rbp
+  802eaa:	48 89 e5             	mov    %rsp,%rbp
+  802ead:	53                   	push   %rbx
+  802eae:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb2:	48 89 fa             	mov    %rdi,%rdx
+  802eb5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802eb8:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ebd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  802ecc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ed2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ed8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802eda:	48 85 c0             	test   %rax,%rax
+  802edd:	7f 06                	jg     802ee5 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802edf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ee3:	c9                   	leave
+  802ee4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ee5:	49 89 c0             	mov    %rax,%r8
+  802ee8:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802eed:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802ef4:	00 00 00 
+  802ef7:	be 27 00 00 00       	mov    $0x27,%esi
+  802efc:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802f03:	00 00 00 
+  802f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0b:	49 b9 71 17 80 00 00 	movabs $0x801771,%r9
+  802f12:	00 00 00 
+  802f15:	41 ff d1             	call   *%r9
+
+0000000000802f18 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802f18:	55                   	push   %rbp
+  802f19:	48 89 e5             	mov    %rsp,%rbp
+  802f1c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f1d:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f31:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f36:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f47:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f4d:	c9                   	leave
+  802f4e:	c3                   	ret
+
+0000000000802f4f <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802f4f:	55                   	push   %rbp
+  802f50:	48 89 e5             	mov    %rsp,%rbp
+  802f53:	53                   	push   %rbx
+  802f54:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f57:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f66:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f6b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f70:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f76:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f7c:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802f7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f82:	c9                   	leave
+  802f83:	c3                   	ret
+
+0000000000802f84 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802f84:	55                   	push   %rbp
+  802f85:	48 89 e5             	mov    %rsp,%rbp
+  802f88:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f89:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f93:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fa2:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fb3:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802fb5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fb9:	c9                   	leave
+  802fba:	c3                   	ret
+
+0000000000802fbb <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fbb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802fc2:	ff ff ff 
+  802fc5:	48 01 f8             	add    %rdi,%rax
+  802fc8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802fcc:	c3                   	ret
+
+0000000000802fcd <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fcd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802fd4:	ff ff ff 
+  802fd7:	48 01 f8             	add    %rdi,%rax
+  802fda:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802fde:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802fe4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802fe8:	c3                   	ret
+
+0000000000802fe9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802fe9:	55                   	push   %rbp
+  802fea:	48 89 e5             	mov    %rsp,%rbp
+  802fed:	41 57                	push   %r15
+  802fef:	41 56                	push   %r14
+  802ff1:	41 55                	push   %r13
+  802ff3:	41 54                	push   %r12
+  802ff5:	53                   	push   %rbx
+  802ff6:	48 83 ec 08          	sub    $0x8,%rsp
+  802ffa:	49 89 ff             	mov    %rdi,%r15
+  802ffd:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803002:	49 bd e9 44 80 00 00 	movabs $0x8044e9,%r13
+  803009:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80300c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803012:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803015:	48 89 df             	mov    %rbx,%rdi
+  803018:	41 ff d5             	call   *%r13
+  80301b:	83 e0 04             	and    $0x4,%eax
+  80301e:	74 17                	je     803037 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803020:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803027:	4c 39 f3             	cmp    %r14,%rbx
+  80302a:	75 e6                	jne    803012 <fd_alloc+0x29>
+  80302c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803032:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803037:	4d 89 27             	mov    %r12,(%r15)
+}
+  80303a:	48 83 c4 08          	add    $0x8,%rsp
+  80303e:	5b                   	pop    %rbx
+  80303f:	41 5c                	pop    %r12
+  803041:	41 5d                	pop    %r13
+  803043:	41 5e                	pop    %r14
+  803045:	41 5f                	pop    %r15
+  803047:	5d                   	pop    %rbp
+  803048:	c3                   	ret
+
+0000000000803049 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803049:	83 ff 1f             	cmp    $0x1f,%edi
+  80304c:	77 39                	ja     803087 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80304e:	55                   	push   %rbp
+  80304f:	48 89 e5             	mov    %rsp,%rbp
+  803052:	41 54                	push   %r12
+  803054:	53                   	push   %rbx
+  803055:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803058:	48 63 df             	movslq %edi,%rbx
+  80305b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803062:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803066:	48 89 df             	mov    %rbx,%rdi
+  803069:	48 b8 e9 44 80 00 00 	movabs $0x8044e9,%rax
+  803070:	00 00 00 
+  803073:	ff d0                	call   *%rax
+  803075:	a8 04                	test   $0x4,%al
+  803077:	74 14                	je     80308d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803079:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80307d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803082:	5b                   	pop    %rbx
+  803083:	41 5c                	pop    %r12
+  803085:	5d                   	pop    %rbp
+  803086:	c3                   	ret
+        return -E_INVAL;
+  803087:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80308c:	c3                   	ret
+        return -E_INVAL;
+  80308d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803092:	eb ee                	jmp    803082 <fd_lookup+0x39>
+
+0000000000803094 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803094:	55                   	push   %rbp
+  803095:	48 89 e5             	mov    %rsp,%rbp
+  803098:	41 54                	push   %r12
+  80309a:	53                   	push   %rbx
+  80309b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80309e:	48 b8 00 64 80 00 00 	movabs $0x806400,%rax
+  8030a5:	00 00 00 
+  8030a8:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8030af:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8030b2:	39 3b                	cmp    %edi,(%rbx)
+  8030b4:	74 47                	je     8030fd <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8030b6:	48 83 c0 08          	add    $0x8,%rax
+  8030ba:	48 8b 18             	mov    (%rax),%rbx
+  8030bd:	48 85 db             	test   %rbx,%rbx
+  8030c0:	75 f0                	jne    8030b2 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8030c2:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  8030c9:	00 00 00 
+  8030cc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8030d2:	89 fa                	mov    %edi,%edx
+  8030d4:	48 bf 78 63 80 00 00 	movabs $0x806378,%rdi
+  8030db:	00 00 00 
+  8030de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e3:	48 b9 c1 18 80 00 00 	movabs $0x8018c1,%rcx
+  8030ea:	00 00 00 
+  8030ed:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8030ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8030f4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8030f8:	5b                   	pop    %rbx
+  8030f9:	41 5c                	pop    %r12
+  8030fb:	5d                   	pop    %rbp
+  8030fc:	c3                   	ret
+            return 0;
+  8030fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803102:	eb f0                	jmp    8030f4 <dev_lookup+0x60>
+
+0000000000803104 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803104:	55                   	push   %rbp
+  803105:	48 89 e5             	mov    %rsp,%rbp
+  803108:	41 55                	push   %r13
+  80310a:	41 54                	push   %r12
+  80310c:	53                   	push   %rbx
+  80310d:	48 83 ec 18          	sub    $0x18,%rsp
+  803111:	48 89 fb             	mov    %rdi,%rbx
+  803114:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803117:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80311e:	ff ff ff 
+  803121:	48 01 df             	add    %rbx,%rdi
+  803124:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803128:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80312c:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803133:	00 00 00 
+  803136:	ff d0                	call   *%rax
+  803138:	41 89 c5             	mov    %eax,%r13d
+  80313b:	85 c0                	test   %eax,%eax
+  80313d:	78 06                	js     803145 <fd_close+0x41>
+  80313f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803143:	74 1a                	je     80315f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803145:	45 84 e4             	test   %r12b,%r12b
+  803148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803151:	44 89 e8             	mov    %r13d,%eax
+  803154:	48 83 c4 18          	add    $0x18,%rsp
+  803158:	5b                   	pop    %rbx
+  803159:	41 5c                	pop    %r12
+  80315b:	41 5d                	pop    %r13
+  80315d:	5d                   	pop    %rbp
+  80315e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80315f:	8b 3b                	mov    (%rbx),%edi
+  803161:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803165:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  80316c:	00 00 00 
+  80316f:	ff d0                	call   *%rax
+  803171:	41 89 c5             	mov    %eax,%r13d
+  803174:	85 c0                	test   %eax,%eax
+  803176:	78 1b                	js     803193 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803178:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80317c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803180:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803186:	48 85 c0             	test   %rax,%rax
+  803189:	74 08                	je     803193 <fd_close+0x8f>
+  80318b:	48 89 df             	mov    %rbx,%rdi
+  80318e:	ff d0                	call   *%rax
+  803190:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803193:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803198:	48 89 de             	mov    %rbx,%rsi
+  80319b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a0:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  8031a7:	00 00 00 
+  8031aa:	ff d0                	call   *%rax
+    return res;
+  8031ac:	eb a3                	jmp    803151 <fd_close+0x4d>
+
+00000000008031ae <close>:
+
+int
+close(int fdnum) {
+  8031ae:	55                   	push   %rbp
+  8031af:	48 89 e5             	mov    %rsp,%rbp
+  8031b2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8031b6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031ba:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031c6:	85 c0                	test   %eax,%eax
+  8031c8:	78 15                	js     8031df <close+0x31>
+
+    return fd_close(fd, 1);
+  8031ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8031cf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031d3:	48 b8 04 31 80 00 00 	movabs $0x803104,%rax
+  8031da:	00 00 00 
+  8031dd:	ff d0                	call   *%rax
+}
+  8031df:	c9                   	leave
+  8031e0:	c3                   	ret
+
+00000000008031e1 <close_all>:
+
+void
+close_all(void) {
+  8031e1:	55                   	push   %rbp
+  8031e2:	48 89 e5             	mov    %rsp,%rbp
+  8031e5:	41 54                	push   %r12
+  8031e7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8031e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031ed:	49 bc ae 31 80 00 00 	movabs $0x8031ae,%r12
+  8031f4:	00 00 00 
+  8031f7:	89 df                	mov    %ebx,%edi
+  8031f9:	41 ff d4             	call   *%r12
+  8031fc:	83 c3 01             	add    $0x1,%ebx
+  8031ff:	83 fb 20             	cmp    $0x20,%ebx
+  803202:	75 f3                	jne    8031f7 <close_all+0x16>
+}
+  803204:	5b                   	pop    %rbx
+  803205:	41 5c                	pop    %r12
+  803207:	5d                   	pop    %rbp
+  803208:	c3                   	ret
+
+0000000000803209 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803209:	55                   	push   %rbp
+  80320a:	48 89 e5             	mov    %rsp,%rbp
+  80320d:	41 57                	push   %r15
+  80320f:	41 56                	push   %r14
+  803211:	41 55                	push   %r13
+  803213:	41 54                	push   %r12
+  803215:	53                   	push   %rbx
+  803216:	48 83 ec 18          	sub    $0x18,%rsp
+  80321a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80321d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803221:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803228:	00 00 00 
+  80322b:	ff d0                	call   *%rax
+  80322d:	89 c3                	mov    %eax,%ebx
+  80322f:	85 c0                	test   %eax,%eax
+  803231:	0f 88 b8 00 00 00    	js     8032ef <dup+0xe6>
+    close(newfdnum);
+  803237:	44 89 e7             	mov    %r12d,%edi
+  80323a:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  803241:	00 00 00 
+  803244:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803246:	4d 63 ec             	movslq %r12d,%r13
+  803249:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803250:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803254:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803258:	4c 89 ff             	mov    %r15,%rdi
+  80325b:	49 be cd 2f 80 00 00 	movabs $0x802fcd,%r14
+  803262:	00 00 00 
+  803265:	41 ff d6             	call   *%r14
+  803268:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80326b:	4c 89 ef             	mov    %r13,%rdi
+  80326e:	41 ff d6             	call   *%r14
+  803271:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803274:	48 89 df             	mov    %rbx,%rdi
+  803277:	48 b8 e9 44 80 00 00 	movabs $0x8044e9,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803283:	a8 04                	test   $0x4,%al
+  803285:	74 2b                	je     8032b2 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803287:	41 89 c1             	mov    %eax,%r9d
+  80328a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803290:	4c 89 f1             	mov    %r14,%rcx
+  803293:	ba 00 00 00 00       	mov    $0x0,%edx
+  803298:	48 89 de             	mov    %rbx,%rsi
+  80329b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032a0:	48 b8 ca 29 80 00 00 	movabs $0x8029ca,%rax
+  8032a7:	00 00 00 
+  8032aa:	ff d0                	call   *%rax
+  8032ac:	89 c3                	mov    %eax,%ebx
+  8032ae:	85 c0                	test   %eax,%eax
+  8032b0:	78 4e                	js     803300 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8032b2:	4c 89 ff             	mov    %r15,%rdi
+  8032b5:	48 b8 e9 44 80 00 00 	movabs $0x8044e9,%rax
+  8032bc:	00 00 00 
+  8032bf:	ff d0                	call   *%rax
+  8032c1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8032c4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032ca:	4c 89 e9             	mov    %r13,%rcx
+  8032cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d2:	4c 89 fe             	mov    %r15,%rsi
+  8032d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032da:	48 b8 ca 29 80 00 00 	movabs $0x8029ca,%rax
+  8032e1:	00 00 00 
+  8032e4:	ff d0                	call   *%rax
+  8032e6:	89 c3                	mov    %eax,%ebx
+  8032e8:	85 c0                	test   %eax,%eax
+  8032ea:	78 14                	js     803300 <dup+0xf7>
+
+    return newfdnum;
+  8032ec:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8032ef:	89 d8                	mov    %ebx,%eax
+  8032f1:	48 83 c4 18          	add    $0x18,%rsp
+  8032f5:	5b                   	pop    %rbx
+  8032f6:	41 5c                	pop    %r12
+  8032f8:	41 5d                	pop    %r13
+  8032fa:	41 5e                	pop    %r14
+  8032fc:	41 5f                	pop    %r15
+  8032fe:	5d                   	pop    %rbp
+  8032ff:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803300:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803305:	4c 89 ee             	mov    %r13,%rsi
+  803308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330d:	49 bc 35 2a 80 00 00 	movabs $0x802a35,%r12
+  803314:	00 00 00 
+  803317:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80331a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80331f:	4c 89 f6             	mov    %r14,%rsi
+  803322:	bf 00 00 00 00       	mov    $0x0,%edi
+  803327:	41 ff d4             	call   *%r12
+    return res;
+  80332a:	eb c3                	jmp    8032ef <dup+0xe6>
+
+000000000080332c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80332c:	55                   	push   %rbp
+  80332d:	48 89 e5             	mov    %rsp,%rbp
+  803330:	41 56                	push   %r14
+  803332:	41 55                	push   %r13
+  803334:	41 54                	push   %r12
+  803336:	53                   	push   %rbx
+  803337:	48 83 ec 10          	sub    $0x10,%rsp
+  80333b:	89 fb                	mov    %edi,%ebx
+  80333d:	49 89 f4             	mov    %rsi,%r12
+  803340:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803343:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803347:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  80334e:	00 00 00 
+  803351:	ff d0                	call   *%rax
+  803353:	85 c0                	test   %eax,%eax
+  803355:	78 4c                	js     8033a3 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803357:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80335b:	41 8b 3e             	mov    (%r14),%edi
+  80335e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803362:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  803369:	00 00 00 
+  80336c:	ff d0                	call   *%rax
+  80336e:	85 c0                	test   %eax,%eax
+  803370:	78 35                	js     8033a7 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803372:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803376:	83 e0 03             	and    $0x3,%eax
+  803379:	83 f8 01             	cmp    $0x1,%eax
+  80337c:	74 2d                	je     8033ab <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80337e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803382:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803386:	48 85 c0             	test   %rax,%rax
+  803389:	74 56                	je     8033e1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80338b:	4c 89 ea             	mov    %r13,%rdx
+  80338e:	4c 89 e6             	mov    %r12,%rsi
+  803391:	4c 89 f7             	mov    %r14,%rdi
+  803394:	ff d0                	call   *%rax
+}
+  803396:	48 83 c4 10          	add    $0x10,%rsp
+  80339a:	5b                   	pop    %rbx
+  80339b:	41 5c                	pop    %r12
+  80339d:	41 5d                	pop    %r13
+  80339f:	41 5e                	pop    %r14
+  8033a1:	5d                   	pop    %rbp
+  8033a2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033a3:	48 98                	cltq
+  8033a5:	eb ef                	jmp    803396 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033a7:	48 98                	cltq
+  8033a9:	eb eb                	jmp    803396 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8033ab:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  8033b2:	00 00 00 
+  8033b5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8033bb:	89 da                	mov    %ebx,%edx
+  8033bd:	48 bf b9 63 80 00 00 	movabs $0x8063b9,%rdi
+  8033c4:	00 00 00 
+  8033c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cc:	48 b9 c1 18 80 00 00 	movabs $0x8018c1,%rcx
+  8033d3:	00 00 00 
+  8033d6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033d8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033df:	eb b5                	jmp    803396 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033e1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033e8:	eb ac                	jmp    803396 <read+0x6a>
+
+00000000008033ea <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8033ea:	55                   	push   %rbp
+  8033eb:	48 89 e5             	mov    %rsp,%rbp
+  8033ee:	41 57                	push   %r15
+  8033f0:	41 56                	push   %r14
+  8033f2:	41 55                	push   %r13
+  8033f4:	41 54                	push   %r12
+  8033f6:	53                   	push   %rbx
+  8033f7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8033fb:	48 85 d2             	test   %rdx,%rdx
+  8033fe:	74 54                	je     803454 <readn+0x6a>
+  803400:	41 89 fd             	mov    %edi,%r13d
+  803403:	49 89 f6             	mov    %rsi,%r14
+  803406:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803409:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80340e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803413:	49 bf 2c 33 80 00 00 	movabs $0x80332c,%r15
+  80341a:	00 00 00 
+  80341d:	4c 89 e2             	mov    %r12,%rdx
+  803420:	48 29 f2             	sub    %rsi,%rdx
+  803423:	4c 01 f6             	add    %r14,%rsi
+  803426:	44 89 ef             	mov    %r13d,%edi
+  803429:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	78 20                	js     803450 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803430:	01 c3                	add    %eax,%ebx
+  803432:	85 c0                	test   %eax,%eax
+  803434:	74 08                	je     80343e <readn+0x54>
+  803436:	48 63 f3             	movslq %ebx,%rsi
+  803439:	4c 39 e6             	cmp    %r12,%rsi
+  80343c:	72 df                	jb     80341d <readn+0x33>
+    }
+    return res;
+  80343e:	48 63 c3             	movslq %ebx,%rax
+}
+  803441:	48 83 c4 08          	add    $0x8,%rsp
+  803445:	5b                   	pop    %rbx
+  803446:	41 5c                	pop    %r12
+  803448:	41 5d                	pop    %r13
+  80344a:	41 5e                	pop    %r14
+  80344c:	41 5f                	pop    %r15
+  80344e:	5d                   	pop    %rbp
+  80344f:	c3                   	ret
+        if (inc < 0) return inc;
+  803450:	48 98                	cltq
+  803452:	eb ed                	jmp    803441 <readn+0x57>
+    int inc = 1, res = 0;
+  803454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803459:	eb e3                	jmp    80343e <readn+0x54>
+
+000000000080345b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80345b:	55                   	push   %rbp
+  80345c:	48 89 e5             	mov    %rsp,%rbp
+  80345f:	41 56                	push   %r14
+  803461:	41 55                	push   %r13
+  803463:	41 54                	push   %r12
+  803465:	53                   	push   %rbx
+  803466:	48 83 ec 10          	sub    $0x10,%rsp
+  80346a:	89 fb                	mov    %edi,%ebx
+  80346c:	49 89 f4             	mov    %rsi,%r12
+  80346f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803472:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803476:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  80347d:	00 00 00 
+  803480:	ff d0                	call   *%rax
+  803482:	85 c0                	test   %eax,%eax
+  803484:	78 47                	js     8034cd <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803486:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80348a:	41 8b 3e             	mov    (%r14),%edi
+  80348d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803491:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+  80349d:	85 c0                	test   %eax,%eax
+  80349f:	78 30                	js     8034d1 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8034a1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8034a6:	74 2d                	je     8034d5 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8034a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034ac:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8034b0:	48 85 c0             	test   %rax,%rax
+  8034b3:	74 56                	je     80350b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8034b5:	4c 89 ea             	mov    %r13,%rdx
+  8034b8:	4c 89 e6             	mov    %r12,%rsi
+  8034bb:	4c 89 f7             	mov    %r14,%rdi
+  8034be:	ff d0                	call   *%rax
+}
+  8034c0:	48 83 c4 10          	add    $0x10,%rsp
+  8034c4:	5b                   	pop    %rbx
+  8034c5:	41 5c                	pop    %r12
+  8034c7:	41 5d                	pop    %r13
+  8034c9:	41 5e                	pop    %r14
+  8034cb:	5d                   	pop    %rbp
+  8034cc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034cd:	48 98                	cltq
+  8034cf:	eb ef                	jmp    8034c0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034d1:	48 98                	cltq
+  8034d3:	eb eb                	jmp    8034c0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034d5:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  8034dc:	00 00 00 
+  8034df:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034e5:	89 da                	mov    %ebx,%edx
+  8034e7:	48 bf d5 63 80 00 00 	movabs $0x8063d5,%rdi
+  8034ee:	00 00 00 
+  8034f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f6:	48 b9 c1 18 80 00 00 	movabs $0x8018c1,%rcx
+  8034fd:	00 00 00 
+  803500:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803502:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803509:	eb b5                	jmp    8034c0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80350b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803512:	eb ac                	jmp    8034c0 <write+0x65>
+
+0000000000803514 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803514:	55                   	push   %rbp
+  803515:	48 89 e5             	mov    %rsp,%rbp
+  803518:	53                   	push   %rbx
+  803519:	48 83 ec 18          	sub    $0x18,%rsp
+  80351d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80351f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803523:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  80352a:	00 00 00 
+  80352d:	ff d0                	call   *%rax
+  80352f:	85 c0                	test   %eax,%eax
+  803531:	78 0c                	js     80353f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803533:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803537:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80353a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80353f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803543:	c9                   	leave
+  803544:	c3                   	ret
+
+0000000000803545 <tell>:
+
+int tell(int fdnum) {
+  803545:	55                   	push   %rbp
+  803546:	48 89 e5             	mov    %rsp,%rbp
+  803549:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80354d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803551:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803558:	00 00 00 
+  80355b:	ff d0                	call   *%rax
+  80355d:	85 c0                	test   %eax,%eax
+  80355f:	78 07                	js     803568 <tell+0x23>
+
+    return fd->fd_offset;
+  803561:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803565:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803568:	c9                   	leave
+  803569:	c3                   	ret
+
+000000000080356a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80356a:	55                   	push   %rbp
+  80356b:	48 89 e5             	mov    %rsp,%rbp
+  80356e:	41 55                	push   %r13
+  803570:	41 54                	push   %r12
+  803572:	53                   	push   %rbx
+  803573:	48 83 ec 18          	sub    $0x18,%rsp
+  803577:	89 fb                	mov    %edi,%ebx
+  803579:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80357c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803580:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803587:	00 00 00 
+  80358a:	ff d0                	call   *%rax
+  80358c:	85 c0                	test   %eax,%eax
+  80358e:	78 38                	js     8035c8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803590:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803594:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803598:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80359c:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  8035a3:	00 00 00 
+  8035a6:	ff d0                	call   *%rax
+  8035a8:	85 c0                	test   %eax,%eax
+  8035aa:	78 1c                	js     8035c8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035ac:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8035b1:	74 20                	je     8035d3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8035b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035b7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8035bb:	48 85 c0             	test   %rax,%rax
+  8035be:	74 47                	je     803607 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8035c0:	44 89 e6             	mov    %r12d,%esi
+  8035c3:	4c 89 ef             	mov    %r13,%rdi
+  8035c6:	ff d0                	call   *%rax
+}
+  8035c8:	48 83 c4 18          	add    $0x18,%rsp
+  8035cc:	5b                   	pop    %rbx
+  8035cd:	41 5c                	pop    %r12
+  8035cf:	41 5d                	pop    %r13
+  8035d1:	5d                   	pop    %rbp
+  8035d2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8035d3:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  8035da:	00 00 00 
+  8035dd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8035e3:	89 da                	mov    %ebx,%edx
+  8035e5:	48 bf 98 63 80 00 00 	movabs $0x806398,%rdi
+  8035ec:	00 00 00 
+  8035ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f4:	48 b9 c1 18 80 00 00 	movabs $0x8018c1,%rcx
+  8035fb:	00 00 00 
+  8035fe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803600:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803605:	eb c1                	jmp    8035c8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803607:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80360c:	eb ba                	jmp    8035c8 <ftruncate+0x5e>
+
+000000000080360e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80360e:	55                   	push   %rbp
+  80360f:	48 89 e5             	mov    %rsp,%rbp
+  803612:	41 54                	push   %r12
+  803614:	53                   	push   %rbx
+  803615:	48 83 ec 10          	sub    $0x10,%rsp
+  803619:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80361c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803620:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803627:	00 00 00 
+  80362a:	ff d0                	call   *%rax
+  80362c:	85 c0                	test   %eax,%eax
+  80362e:	78 63                	js     803693 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803630:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803634:	41 8b 3c 24          	mov    (%r12),%edi
+  803638:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80363c:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  803643:	00 00 00 
+  803646:	ff d0                	call   *%rax
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	78 47                	js     803693 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80364c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803650:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803655:	74 45                	je     80369c <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803657:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80365a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803661:	00 00 00 
+    stat->st_isdir = 0;
+  803664:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80366b:	00 00 00 
+    stat->st_ino = 0;
+  80366e:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803675:	00 00 00 00 
+    stat->st_version = 0;
+  803679:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803680:	00 00 00 
+    stat->st_dev = dev;
+  803683:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80368a:	48 89 de             	mov    %rbx,%rsi
+  80368d:	4c 89 e7             	mov    %r12,%rdi
+  803690:	ff 50 28             	call   *0x28(%rax)
+}
+  803693:	48 83 c4 10          	add    $0x10,%rsp
+  803697:	5b                   	pop    %rbx
+  803698:	41 5c                	pop    %r12
+  80369a:	5d                   	pop    %rbp
+  80369b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80369c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8036a1:	eb f0                	jmp    803693 <fstat+0x85>
+
+00000000008036a3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8036a3:	55                   	push   %rbp
+  8036a4:	48 89 e5             	mov    %rsp,%rbp
+  8036a7:	41 54                	push   %r12
+  8036a9:	53                   	push   %rbx
+  8036aa:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8036ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b2:	48 b8 c4 3b 80 00 00 	movabs $0x803bc4,%rax
+  8036b9:	00 00 00 
+  8036bc:	ff d0                	call   *%rax
+  8036be:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8036c0:	85 c0                	test   %eax,%eax
+  8036c2:	78 25                	js     8036e9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8036c4:	4c 89 e6             	mov    %r12,%rsi
+  8036c7:	89 c7                	mov    %eax,%edi
+  8036c9:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  8036d0:	00 00 00 
+  8036d3:	ff d0                	call   *%rax
+  8036d5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8036d8:	89 df                	mov    %ebx,%edi
+  8036da:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  8036e1:	00 00 00 
+  8036e4:	ff d0                	call   *%rax
+
+    return res;
+  8036e6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8036e9:	89 d8                	mov    %ebx,%eax
+  8036eb:	5b                   	pop    %rbx
+  8036ec:	41 5c                	pop    %r12
+  8036ee:	5d                   	pop    %rbp
+  8036ef:	c3                   	ret
+
+00000000008036f0 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036f0:	48 b8 00 c0 80 01 00 	movabs $0x180c000,%rax
+  8036f7:	00 00 00 
+  8036fa:	83 38 00             	cmpl   $0x0,(%rax)
+  8036fd:	74 0a                	je     803709 <fsipc_env+0x19>
+    return fsenv;
+}
+  8036ff:	a1 00 c0 80 01 00 00 	movabs 0x180c000,%eax
+  803706:	00 00 
+  803708:	c3                   	ret
+fsipc_env(void) {
+  803709:	55                   	push   %rbp
+  80370a:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80370d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803712:	48 b8 f3 57 80 00 00 	movabs $0x8057f3,%rax
+  803719:	00 00 00 
+  80371c:	ff d0                	call   *%rax
+  80371e:	a3 00 c0 80 01 00 00 	movabs %eax,0x180c000
+  803725:	00 00 
+}
+  803727:	a1 00 c0 80 01 00 00 	movabs 0x180c000,%eax
+  80372e:	00 00 
+  803730:	5d                   	pop    %rbp
+  803731:	c3                   	ret
+
+0000000000803732 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803732:	55                   	push   %rbp
+  803733:	48 89 e5             	mov    %rsp,%rbp
+  803736:	53                   	push   %rbx
+  803737:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80373b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803742:	00 
+  803743:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80374a:	00 
+  80374b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803752:	00 
+  803753:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80375a:	00 
+  80375b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803762:	00 
+
+    assert(size <= sizeof(words));
+  803763:	48 83 fa 28          	cmp    $0x28,%rdx
+  803767:	77 38                	ja     8037a1 <fsipc_short+0x6f>
+  803769:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80376b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80376f:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  803776:	00 00 00 
+  803779:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80377b:	48 b8 f0 36 80 00 00 	movabs $0x8036f0,%rax
+  803782:	00 00 00 
+  803785:	ff d0                	call   *%rax
+  803787:	89 c7                	mov    %eax,%edi
+  803789:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80378d:	89 de                	mov    %ebx,%esi
+  80378f:	48 b8 56 57 80 00 00 	movabs $0x805756,%rax
+  803796:	00 00 00 
+  803799:	ff d0                	call   *%rax
+}
+  80379b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80379f:	c9                   	leave
+  8037a0:	c3                   	ret
+    assert(size <= sizeof(words));
+  8037a1:	48 b9 20 64 80 00 00 	movabs $0x806420,%rcx
+  8037a8:	00 00 00 
+  8037ab:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  8037b2:	00 00 00 
+  8037b5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8037ba:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  8037c1:	00 00 00 
+  8037c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c9:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  8037d0:	00 00 00 
+  8037d3:	41 ff d0             	call   *%r8
+
+00000000008037d6 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8037d6:	55                   	push   %rbp
+  8037d7:	48 89 e5             	mov    %rsp,%rbp
+  8037da:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8037de:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8037e1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8037e4:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8037e7:	ba 08 00 00 00       	mov    $0x8,%edx
+  8037ec:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037f0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8037f5:	48 b8 32 37 80 00 00 	movabs $0x803732,%rax
+  8037fc:	00 00 00 
+  8037ff:	ff d0                	call   *%rax
+}
+  803801:	c9                   	leave
+  803802:	c3                   	ret
+
+0000000000803803 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803803:	55                   	push   %rbp
+  803804:	48 89 e5             	mov    %rsp,%rbp
+  803807:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  80380b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80380e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803811:	ba 04 00 00 00       	mov    $0x4,%edx
+  803816:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80381a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80381f:	48 b8 32 37 80 00 00 	movabs $0x803732,%rax
+  803826:	00 00 00 
+  803829:	ff d0                	call   *%rax
+}
+  80382b:	c9                   	leave
+  80382c:	c3                   	ret
+
+000000000080382d <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80382d:	55                   	push   %rbp
+  80382e:	48 89 e5             	mov    %rsp,%rbp
+  803831:	41 54                	push   %r12
+  803833:	53                   	push   %rbx
+  803834:	48 83 ec 10          	sub    $0x10,%rsp
+  803838:	89 fb                	mov    %edi,%ebx
+  80383a:	49 89 f4             	mov    %rsi,%r12
+  80383d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803841:	48 b8 f0 36 80 00 00 	movabs $0x8036f0,%rax
+  803848:	00 00 00 
+  80384b:	ff d0                	call   *%rax
+  80384d:	89 c7                	mov    %eax,%edi
+  80384f:	6a 00                	push   $0x0
+  803851:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803855:	50                   	push   %rax
+  803856:	4d 89 e1             	mov    %r12,%r9
+  803859:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80385f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803864:	48 ba 00 b0 80 01 00 	movabs $0x180b000,%rdx
+  80386b:	00 00 00 
+  80386e:	89 de                	mov    %ebx,%esi
+  803870:	48 b8 f1 56 80 00 00 	movabs $0x8056f1,%rax
+  803877:	00 00 00 
+  80387a:	ff d0                	call   *%rax
+}
+  80387c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803880:	5b                   	pop    %rbx
+  803881:	41 5c                	pop    %r12
+  803883:	5d                   	pop    %rbp
+  803884:	c3                   	ret
+
+0000000000803885 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803885:	55                   	push   %rbp
+  803886:	48 89 e5             	mov    %rsp,%rbp
+  803889:	41 54                	push   %r12
+  80388b:	53                   	push   %rbx
+  80388c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80388f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803892:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  803899:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80389b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8038a5:	bf 05 00 00 00       	mov    $0x5,%edi
+  8038aa:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  8038b1:	00 00 00 
+  8038b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038b6:	85 c0                	test   %eax,%eax
+  8038b8:	78 5a                	js     803914 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8038ba:	49 bc 00 b0 80 01 00 	movabs $0x180b000,%r12
+  8038c1:	00 00 00 
+  8038c4:	4c 89 e6             	mov    %r12,%rsi
+  8038c7:	48 89 df             	mov    %rbx,%rdi
+  8038ca:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  8038d1:	00 00 00 
+  8038d4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8038d6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8038dd:	00 
+  8038de:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8038e4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8038eb:	00 
+  8038ec:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8038f2:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8038f9:	00 
+  8038fa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803901:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803908:	00 
+  803909:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  80390f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803914:	5b                   	pop    %rbx
+  803915:	41 5c                	pop    %r12
+  803917:	5d                   	pop    %rbp
+  803918:	c3                   	ret
+
+0000000000803919 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803919:	55                   	push   %rbp
+  80391a:	48 89 e5             	mov    %rsp,%rbp
+  80391d:	41 57                	push   %r15
+  80391f:	41 56                	push   %r14
+  803921:	41 55                	push   %r13
+  803923:	41 54                	push   %r12
+  803925:	53                   	push   %rbx
+  803926:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80392a:	48 85 ff             	test   %rdi,%rdi
+  80392d:	0f 84 a1 00 00 00    	je     8039d4 <devfile_read+0xbb>
+  803933:	49 89 ff             	mov    %rdi,%r15
+  803936:	49 89 f5             	mov    %rsi,%r13
+  803939:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  80393c:	48 85 f6             	test   %rsi,%rsi
+  80393f:	0f 84 c4 00 00 00    	je     803a09 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803945:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80394c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80394d:	49 be 00 b0 80 01 00 	movabs $0x180b000,%r14
+  803954:	00 00 00 
+  803957:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80395b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80395e:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803962:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803967:	be 00 00 00 00       	mov    $0x0,%esi
+  80396c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803971:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803978:	00 00 00 
+  80397b:	ff d0                	call   *%rax
+        if (res < 0) {
+  80397d:	85 c0                	test   %eax,%eax
+  80397f:	0f 88 b9 00 00 00    	js     803a3e <devfile_read+0x125>
+        assert(res <= n);
+  803985:	48 63 d8             	movslq %eax,%rbx
+  803988:	49 39 dc             	cmp    %rbx,%r12
+  80398b:	0f 82 b1 00 00 00    	jb     803a42 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803991:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803996:	0f 87 db 00 00 00    	ja     803a77 <devfile_read+0x15e>
+        if (!res) {
+  80399c:	85 c0                	test   %eax,%eax
+  80399e:	74 21                	je     8039c1 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8039a0:	48 89 da             	mov    %rbx,%rdx
+  8039a3:	4c 89 f6             	mov    %r14,%rsi
+  8039a6:	4c 89 ef             	mov    %r13,%rdi
+  8039a9:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  8039b0:	00 00 00 
+  8039b3:	ff d0                	call   *%rax
+        total_read += res;
+  8039b5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8039b9:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8039bc:	49 29 dc             	sub    %rbx,%r12
+  8039bf:	75 96                	jne    803957 <devfile_read+0x3e>
+    return total_read;
+  8039c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8039c5:	48 83 c4 18          	add    $0x18,%rsp
+  8039c9:	5b                   	pop    %rbx
+  8039ca:	41 5c                	pop    %r12
+  8039cc:	41 5d                	pop    %r13
+  8039ce:	41 5e                	pop    %r14
+  8039d0:	41 5f                	pop    %r15
+  8039d2:	5d                   	pop    %rbp
+  8039d3:	c3                   	ret
+    assert(fd);
+  8039d4:	48 b9 56 64 80 00 00 	movabs $0x806456,%rcx
+  8039db:	00 00 00 
+  8039de:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  8039e5:	00 00 00 
+  8039e8:	be 91 00 00 00       	mov    $0x91,%esi
+  8039ed:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  8039f4:	00 00 00 
+  8039f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039fc:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  803a03:	00 00 00 
+  803a06:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a09:	48 b9 59 64 80 00 00 	movabs $0x806459,%rcx
+  803a10:	00 00 00 
+  803a13:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803a1a:	00 00 00 
+  803a1d:	be 92 00 00 00       	mov    $0x92,%esi
+  803a22:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803a29:	00 00 00 
+  803a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a31:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  803a38:	00 00 00 
+  803a3b:	41 ff d0             	call   *%r8
+            return res;
+  803a3e:	48 98                	cltq
+  803a40:	eb 83                	jmp    8039c5 <devfile_read+0xac>
+        assert(res <= n);
+  803a42:	48 b9 5d 64 80 00 00 	movabs $0x80645d,%rcx
+  803a49:	00 00 00 
+  803a4c:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803a53:	00 00 00 
+  803a56:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803a5b:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803a62:	00 00 00 
+  803a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6a:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  803a71:	00 00 00 
+  803a74:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803a77:	48 b9 68 64 80 00 00 	movabs $0x806468,%rcx
+  803a7e:	00 00 00 
+  803a81:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803a88:	00 00 00 
+  803a8b:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803a90:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803a97:	00 00 00 
+  803a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a9f:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  803aa6:	00 00 00 
+  803aa9:	41 ff d0             	call   *%r8
+
+0000000000803aac <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803aac:	55                   	push   %rbp
+  803aad:	48 89 e5             	mov    %rsp,%rbp
+  803ab0:	41 57                	push   %r15
+  803ab2:	41 56                	push   %r14
+  803ab4:	41 55                	push   %r13
+  803ab6:	41 54                	push   %r12
+  803ab8:	53                   	push   %rbx
+  803ab9:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803abd:	48 85 ff             	test   %rdi,%rdi
+  803ac0:	0f 84 83 00 00 00    	je     803b49 <devfile_write+0x9d>
+  803ac6:	49 89 ff             	mov    %rdi,%r15
+  803ac9:	49 89 f4             	mov    %rsi,%r12
+  803acc:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803acf:	48 85 f6             	test   %rsi,%rsi
+  803ad2:	0f 84 a6 00 00 00    	je     803b7e <devfile_write+0xd2>
+    size_t total_written = 0;
+  803ad8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ade:	49 be 00 b0 80 01 00 	movabs $0x180b000,%r14
+  803ae5:	00 00 00 
+  803ae8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803aec:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803aef:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803af3:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803af8:	48 39 d3             	cmp    %rdx,%rbx
+  803afb:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803aff:	4c 89 e6             	mov    %r12,%rsi
+  803b02:	48 bf 10 b0 80 01 00 	movabs $0x180b010,%rdi
+  803b09:	00 00 00 
+  803b0c:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  803b13:	00 00 00 
+  803b16:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b1d:	be 00 00 00 00       	mov    $0x0,%esi
+  803b22:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b27:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803b2e:	00 00 00 
+  803b31:	ff d0                	call   *%rax
+        if (res < 0) {
+  803b33:	85 c0                	test   %eax,%eax
+  803b35:	78 7c                	js     803bb3 <devfile_write+0x107>
+        total_written += res;
+  803b37:	48 98                	cltq
+  803b39:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803b3c:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803b3f:	48 29 c3             	sub    %rax,%rbx
+  803b42:	75 a4                	jne    803ae8 <devfile_write+0x3c>
+    return total_written;
+  803b44:	4c 89 e8             	mov    %r13,%rax
+  803b47:	eb 6c                	jmp    803bb5 <devfile_write+0x109>
+    assert(fd);
+  803b49:	48 b9 56 64 80 00 00 	movabs $0x806456,%rcx
+  803b50:	00 00 00 
+  803b53:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803b5a:	00 00 00 
+  803b5d:	be bd 00 00 00       	mov    $0xbd,%esi
+  803b62:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803b69:	00 00 00 
+  803b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b71:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  803b78:	00 00 00 
+  803b7b:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b7e:	48 b9 59 64 80 00 00 	movabs $0x806459,%rcx
+  803b85:	00 00 00 
+  803b88:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803b8f:	00 00 00 
+  803b92:	be be 00 00 00       	mov    $0xbe,%esi
+  803b97:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803b9e:	00 00 00 
+  803ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba6:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  803bad:	00 00 00 
+  803bb0:	41 ff d0             	call   *%r8
+            return res;
+  803bb3:	48 98                	cltq
+}
+  803bb5:	48 83 c4 08          	add    $0x8,%rsp
+  803bb9:	5b                   	pop    %rbx
+  803bba:	41 5c                	pop    %r12
+  803bbc:	41 5d                	pop    %r13
+  803bbe:	41 5e                	pop    %r14
+  803bc0:	41 5f                	pop    %r15
+  803bc2:	5d                   	pop    %rbp
+  803bc3:	c3                   	ret
+
+0000000000803bc4 <open>:
+open(const char *path, int mode) {
+  803bc4:	55                   	push   %rbp
+  803bc5:	48 89 e5             	mov    %rsp,%rbp
+  803bc8:	41 55                	push   %r13
+  803bca:	41 54                	push   %r12
+  803bcc:	53                   	push   %rbx
+  803bcd:	48 83 ec 18          	sub    $0x18,%rsp
+  803bd1:	49 89 fc             	mov    %rdi,%r12
+  803bd4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803bd7:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803bde:	00 00 00 
+  803be1:	ff d0                	call   *%rax
+  803be3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803be9:	0f 87 8f 00 00 00    	ja     803c7e <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803bef:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bf3:	48 b8 e9 2f 80 00 00 	movabs $0x802fe9,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+  803bff:	89 c3                	mov    %eax,%ebx
+  803c01:	85 c0                	test   %eax,%eax
+  803c03:	78 55                	js     803c5a <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803c05:	4c 89 e6             	mov    %r12,%rsi
+  803c08:	48 bb 00 b0 80 01 00 	movabs $0x180b000,%rbx
+  803c0f:	00 00 00 
+  803c12:	48 89 df             	mov    %rbx,%rdi
+  803c15:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  803c1c:	00 00 00 
+  803c1f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803c21:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c2d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c31:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c36:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803c3d:	00 00 00 
+  803c40:	ff d0                	call   *%rax
+  803c42:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803c44:	85 c0                	test   %eax,%eax
+  803c46:	78 1f                	js     803c67 <open+0xa3>
+    return fd2num(fd);
+  803c48:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c4c:	48 b8 bb 2f 80 00 00 	movabs $0x802fbb,%rax
+  803c53:	00 00 00 
+  803c56:	ff d0                	call   *%rax
+  803c58:	89 c3                	mov    %eax,%ebx
+}
+  803c5a:	89 d8                	mov    %ebx,%eax
+  803c5c:	48 83 c4 18          	add    $0x18,%rsp
+  803c60:	5b                   	pop    %rbx
+  803c61:	41 5c                	pop    %r12
+  803c63:	41 5d                	pop    %r13
+  803c65:	5d                   	pop    %rbp
+  803c66:	c3                   	ret
+        fd_close(fd, 0);
+  803c67:	be 00 00 00 00       	mov    $0x0,%esi
+  803c6c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c70:	48 b8 04 31 80 00 00 	movabs $0x803104,%rax
+  803c77:	00 00 00 
+  803c7a:	ff d0                	call   *%rax
+        return res;
+  803c7c:	eb dc                	jmp    803c5a <open+0x96>
+        return -E_BAD_PATH;
+  803c7e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c83:	eb d5                	jmp    803c5a <open+0x96>
+
+0000000000803c85 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803c85:	55                   	push   %rbp
+  803c86:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803c89:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8e:	be 00 00 00 00       	mov    $0x0,%esi
+  803c93:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c98:	48 b8 32 37 80 00 00 	movabs $0x803732,%rax
+  803c9f:	00 00 00 
+  803ca2:	ff d0                	call   *%rax
+}
+  803ca4:	5d                   	pop    %rbp
+  803ca5:	c3                   	ret
+
+0000000000803ca6 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803ca6:	55                   	push   %rbp
+  803ca7:	48 89 e5             	mov    %rsp,%rbp
+  803caa:	41 56                	push   %r14
+  803cac:	41 55                	push   %r13
+  803cae:	41 54                	push   %r12
+  803cb0:	53                   	push   %rbx
+  803cb1:	48 83 ec 10          	sub    $0x10,%rsp
+  803cb5:	41 89 f6             	mov    %esi,%r14d
+  803cb8:	49 89 d4             	mov    %rdx,%r12
+  803cbb:	48 89 cb             	mov    %rcx,%rbx
+  803cbe:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803cc1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803cc5:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803ccc:	00 00 00 
+  803ccf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cd1:	85 c0                	test   %eax,%eax
+  803cd3:	78 46                	js     803d1b <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803cd5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cd9:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ce0:	00 00 00 
+  803ce3:	8b 00                	mov    (%rax),%eax
+  803ce5:	39 02                	cmp    %eax,(%rdx)
+  803ce7:	75 3f                	jne    803d28 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803ce9:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  803cf0:	00 00 00 
+  803cf3:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803cf6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803cf8:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803cfc:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803d00:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803d04:	48 89 da             	mov    %rbx,%rdx
+  803d07:	4c 89 e6             	mov    %r12,%rsi
+  803d0a:	bf 09 00 00 00       	mov    $0x9,%edi
+  803d0f:	48 b8 2d 38 80 00 00 	movabs $0x80382d,%rax
+  803d16:	00 00 00 
+  803d19:	ff d0                	call   *%rax
+}
+  803d1b:	48 83 c4 10          	add    $0x10,%rsp
+  803d1f:	5b                   	pop    %rbx
+  803d20:	41 5c                	pop    %r12
+  803d22:	41 5d                	pop    %r13
+  803d24:	41 5e                	pop    %r14
+  803d26:	5d                   	pop    %rbp
+  803d27:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d28:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d2d:	eb ec                	jmp    803d1b <file_map+0x75>
+
+0000000000803d2f <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803d2f:	55                   	push   %rbp
+  803d30:	48 89 e5             	mov    %rsp,%rbp
+  803d33:	41 54                	push   %r12
+  803d35:	53                   	push   %rbx
+  803d36:	48 83 ec 20          	sub    $0x20,%rsp
+  803d3a:	41 89 f4             	mov    %esi,%r12d
+  803d3d:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d40:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d44:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803d4b:	00 00 00 
+  803d4e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d50:	85 c0                	test   %eax,%eax
+  803d52:	78 3c                	js     803d90 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d58:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803d5f:	00 00 00 
+  803d62:	8b 0a                	mov    (%rdx),%ecx
+  803d64:	39 08                	cmp    %ecx,(%rax)
+  803d66:	75 31                	jne    803d99 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803d68:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d6b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803d6e:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803d72:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803d76:	ba 10 00 00 00       	mov    $0x10,%edx
+  803d7b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d7f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803d84:	48 b8 32 37 80 00 00 	movabs $0x803732,%rax
+  803d8b:	00 00 00 
+  803d8e:	ff d0                	call   *%rax
+}
+  803d90:	48 83 c4 20          	add    $0x20,%rsp
+  803d94:	5b                   	pop    %rbx
+  803d95:	41 5c                	pop    %r12
+  803d97:	5d                   	pop    %rbp
+  803d98:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d99:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d9e:	eb f0                	jmp    803d90 <file_msync+0x61>
+
+0000000000803da0 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803da0:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803da4:	7f 01                	jg     803da7 <writebuf+0x7>
+  803da6:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803da7:	55                   	push   %rbp
+  803da8:	48 89 e5             	mov    %rsp,%rbp
+  803dab:	53                   	push   %rbx
+  803dac:	48 83 ec 08          	sub    $0x8,%rsp
+  803db0:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803db3:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803db7:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803dbb:	8b 3f                	mov    (%rdi),%edi
+  803dbd:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  803dc4:	00 00 00 
+  803dc7:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803dc9:	48 85 c0             	test   %rax,%rax
+  803dcc:	7e 04                	jle    803dd2 <writebuf+0x32>
+  803dce:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803dd2:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803dd6:	48 39 c2             	cmp    %rax,%rdx
+  803dd9:	74 0f                	je     803dea <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803ddb:	48 85 c0             	test   %rax,%rax
+  803dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  803de3:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803de7:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803dea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dee:	c9                   	leave
+  803def:	c3                   	ret
+
+0000000000803df0 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803df0:	8b 46 04             	mov    0x4(%rsi),%eax
+  803df3:	8d 50 01             	lea    0x1(%rax),%edx
+  803df6:	89 56 04             	mov    %edx,0x4(%rsi)
+  803df9:	48 98                	cltq
+  803dfb:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803e00:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e06:	74 01                	je     803e09 <putch+0x19>
+  803e08:	c3                   	ret
+putch(int ch, void *arg) {
+  803e09:	55                   	push   %rbp
+  803e0a:	48 89 e5             	mov    %rsp,%rbp
+  803e0d:	53                   	push   %rbx
+  803e0e:	48 83 ec 08          	sub    $0x8,%rsp
+  803e12:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e15:	48 89 f7             	mov    %rsi,%rdi
+  803e18:	48 b8 a0 3d 80 00 00 	movabs $0x803da0,%rax
+  803e1f:	00 00 00 
+  803e22:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e24:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e2f:	c9                   	leave
+  803e30:	c3                   	ret
+
+0000000000803e31 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e31:	55                   	push   %rbp
+  803e32:	48 89 e5             	mov    %rsp,%rbp
+  803e35:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803e3c:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803e3f:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803e45:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803e4c:	00 00 00 
+    state.result = 0;
+  803e4f:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803e56:	00 00 00 00 
+    state.error = 1;
+  803e5a:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803e61:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803e64:	48 89 f2             	mov    %rsi,%rdx
+  803e67:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803e6e:	48 bf f0 3d 80 00 00 	movabs $0x803df0,%rdi
+  803e75:	00 00 00 
+  803e78:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  803e7f:	00 00 00 
+  803e82:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803e84:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803e8b:	7f 14                	jg     803ea1 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803e8d:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803e94:	48 85 c0             	test   %rax,%rax
+  803e97:	75 06                	jne    803e9f <vfprintf+0x6e>
+  803e99:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803e9f:	c9                   	leave
+  803ea0:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803ea1:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803ea8:	48 b8 a0 3d 80 00 00 	movabs $0x803da0,%rax
+  803eaf:	00 00 00 
+  803eb2:	ff d0                	call   *%rax
+  803eb4:	eb d7                	jmp    803e8d <vfprintf+0x5c>
+
+0000000000803eb6 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803eb6:	55                   	push   %rbp
+  803eb7:	48 89 e5             	mov    %rsp,%rbp
+  803eba:	48 83 ec 50          	sub    $0x50,%rsp
+  803ebe:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ec2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ec6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803eca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ece:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803ed5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ed9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803edd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ee1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ee5:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ee9:	48 b8 31 3e 80 00 00 	movabs $0x803e31,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ef5:	c9                   	leave
+  803ef6:	c3                   	ret
+
+0000000000803ef7 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803ef7:	55                   	push   %rbp
+  803ef8:	48 89 e5             	mov    %rsp,%rbp
+  803efb:	48 83 ec 50          	sub    $0x50,%rsp
+  803eff:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f03:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f07:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f0b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f0f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f13:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f1a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f22:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f26:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f2a:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f2e:	48 89 fe             	mov    %rdi,%rsi
+  803f31:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f36:	48 b8 31 3e 80 00 00 	movabs $0x803e31,%rax
+  803f3d:	00 00 00 
+  803f40:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f42:	c9                   	leave
+  803f43:	c3                   	ret
+
+0000000000803f44 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f44:	55                   	push   %rbp
+  803f45:	48 89 e5             	mov    %rsp,%rbp
+  803f48:	41 54                	push   %r12
+  803f4a:	53                   	push   %rbx
+  803f4b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f4e:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  803f55:	00 00 00 
+  803f58:	ff d0                	call   *%rax
+  803f5a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803f5d:	48 be 90 64 80 00 00 	movabs $0x806490,%rsi
+  803f64:	00 00 00 
+  803f67:	48 89 df             	mov    %rbx,%rdi
+  803f6a:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  803f71:	00 00 00 
+  803f74:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803f76:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803f7b:	41 2b 04 24          	sub    (%r12),%eax
+  803f7f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803f85:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803f8c:	00 00 00 
+    stat->st_dev = &devpipe;
+  803f8f:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803f96:	00 00 00 
+  803f99:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa5:	5b                   	pop    %rbx
+  803fa6:	41 5c                	pop    %r12
+  803fa8:	5d                   	pop    %rbp
+  803fa9:	c3                   	ret
+
+0000000000803faa <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803faa:	55                   	push   %rbp
+  803fab:	48 89 e5             	mov    %rsp,%rbp
+  803fae:	41 54                	push   %r12
+  803fb0:	53                   	push   %rbx
+  803fb1:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803fb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fb9:	48 89 fe             	mov    %rdi,%rsi
+  803fbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc1:	49 bc 35 2a 80 00 00 	movabs $0x802a35,%r12
+  803fc8:	00 00 00 
+  803fcb:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803fce:	48 89 df             	mov    %rbx,%rdi
+  803fd1:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  803fd8:	00 00 00 
+  803fdb:	ff d0                	call   *%rax
+  803fdd:	48 89 c6             	mov    %rax,%rsi
+  803fe0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fea:	41 ff d4             	call   *%r12
+}
+  803fed:	5b                   	pop    %rbx
+  803fee:	41 5c                	pop    %r12
+  803ff0:	5d                   	pop    %rbp
+  803ff1:	c3                   	ret
+
+0000000000803ff2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ff2:	55                   	push   %rbp
+  803ff3:	48 89 e5             	mov    %rsp,%rbp
+  803ff6:	41 57                	push   %r15
+  803ff8:	41 56                	push   %r14
+  803ffa:	41 55                	push   %r13
+  803ffc:	41 54                	push   %r12
+  803ffe:	53                   	push   %rbx
+  803fff:	48 83 ec 18          	sub    $0x18,%rsp
+  804003:	49 89 fc             	mov    %rdi,%r12
+  804006:	49 89 f5             	mov    %rsi,%r13
+  804009:	49 89 d7             	mov    %rdx,%r15
+  80400c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804010:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  804017:	00 00 00 
+  80401a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80401c:	4d 85 ff             	test   %r15,%r15
+  80401f:	0f 84 af 00 00 00    	je     8040d4 <devpipe_write+0xe2>
+  804025:	48 89 c3             	mov    %rax,%rbx
+  804028:	4c 89 f8             	mov    %r15,%rax
+  80402b:	4d 89 ef             	mov    %r13,%r15
+  80402e:	4c 01 e8             	add    %r13,%rax
+  804031:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804035:	49 bd 2b 29 80 00 00 	movabs $0x80292b,%r13
+  80403c:	00 00 00 
+            sys_yield();
+  80403f:	49 be bc 28 80 00 00 	movabs $0x8028bc,%r14
+  804046:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804049:	8b 73 04             	mov    0x4(%rbx),%esi
+  80404c:	48 63 ce             	movslq %esi,%rcx
+  80404f:	48 63 03             	movslq (%rbx),%rax
+  804052:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804058:	48 39 c1             	cmp    %rax,%rcx
+  80405b:	72 2e                	jb     80408b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80405d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804062:	48 89 da             	mov    %rbx,%rdx
+  804065:	be 00 10 00 00       	mov    $0x1000,%esi
+  80406a:	4c 89 e7             	mov    %r12,%rdi
+  80406d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804070:	85 c0                	test   %eax,%eax
+  804072:	74 66                	je     8040da <devpipe_write+0xe8>
+            sys_yield();
+  804074:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804077:	8b 73 04             	mov    0x4(%rbx),%esi
+  80407a:	48 63 ce             	movslq %esi,%rcx
+  80407d:	48 63 03             	movslq (%rbx),%rax
+  804080:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804086:	48 39 c1             	cmp    %rax,%rcx
+  804089:	73 d2                	jae    80405d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80408b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80408f:	48 89 ca             	mov    %rcx,%rdx
+  804092:	48 c1 ea 03          	shr    $0x3,%rdx
+  804096:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80409d:	08 10 20 
+  8040a0:	48 f7 e2             	mul    %rdx
+  8040a3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8040a7:	48 89 d0             	mov    %rdx,%rax
+  8040aa:	48 c1 e0 09          	shl    $0x9,%rax
+  8040ae:	48 29 d0             	sub    %rdx,%rax
+  8040b1:	48 c1 e0 03          	shl    $0x3,%rax
+  8040b5:	48 29 c1             	sub    %rax,%rcx
+  8040b8:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8040bd:	83 c6 01             	add    $0x1,%esi
+  8040c0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8040c3:	49 83 c7 01          	add    $0x1,%r15
+  8040c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040cb:	49 39 c7             	cmp    %rax,%r15
+  8040ce:	0f 85 75 ff ff ff    	jne    804049 <devpipe_write+0x57>
+    return n;
+  8040d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040d8:	eb 05                	jmp    8040df <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8040da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040df:	48 83 c4 18          	add    $0x18,%rsp
+  8040e3:	5b                   	pop    %rbx
+  8040e4:	41 5c                	pop    %r12
+  8040e6:	41 5d                	pop    %r13
+  8040e8:	41 5e                	pop    %r14
+  8040ea:	41 5f                	pop    %r15
+  8040ec:	5d                   	pop    %rbp
+  8040ed:	c3                   	ret
+
+00000000008040ee <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040ee:	55                   	push   %rbp
+  8040ef:	48 89 e5             	mov    %rsp,%rbp
+  8040f2:	41 57                	push   %r15
+  8040f4:	41 56                	push   %r14
+  8040f6:	41 55                	push   %r13
+  8040f8:	41 54                	push   %r12
+  8040fa:	53                   	push   %rbx
+  8040fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8040ff:	49 89 fc             	mov    %rdi,%r12
+  804102:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804106:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80410a:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  804111:	00 00 00 
+  804114:	ff d0                	call   *%rax
+  804116:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804119:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80411f:	49 bd 2b 29 80 00 00 	movabs $0x80292b,%r13
+  804126:	00 00 00 
+            sys_yield();
+  804129:	49 be bc 28 80 00 00 	movabs $0x8028bc,%r14
+  804130:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804133:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804138:	74 7d                	je     8041b7 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80413a:	8b 03                	mov    (%rbx),%eax
+  80413c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80413f:	75 26                	jne    804167 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804141:	4d 85 ff             	test   %r15,%r15
+  804144:	75 77                	jne    8041bd <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804146:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80414b:	48 89 da             	mov    %rbx,%rdx
+  80414e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804153:	4c 89 e7             	mov    %r12,%rdi
+  804156:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804159:	85 c0                	test   %eax,%eax
+  80415b:	74 72                	je     8041cf <devpipe_read+0xe1>
+            sys_yield();
+  80415d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804160:	8b 03                	mov    (%rbx),%eax
+  804162:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804165:	74 df                	je     804146 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804167:	48 63 c8             	movslq %eax,%rcx
+  80416a:	48 89 ca             	mov    %rcx,%rdx
+  80416d:	48 c1 ea 03          	shr    $0x3,%rdx
+  804171:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804178:	08 10 20 
+  80417b:	48 89 d0             	mov    %rdx,%rax
+  80417e:	48 f7 e6             	mul    %rsi
+  804181:	48 c1 ea 06          	shr    $0x6,%rdx
+  804185:	48 89 d0             	mov    %rdx,%rax
+  804188:	48 c1 e0 09          	shl    $0x9,%rax
+  80418c:	48 29 d0             	sub    %rdx,%rax
+  80418f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804196:	00 
+  804197:	48 89 c8             	mov    %rcx,%rax
+  80419a:	48 29 d0             	sub    %rdx,%rax
+  80419d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8041a2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041a6:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8041aa:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041ad:	49 83 c7 01          	add    $0x1,%r15
+  8041b1:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8041b5:	75 83                	jne    80413a <devpipe_read+0x4c>
+    return n;
+  8041b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041bb:	eb 03                	jmp    8041c0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8041bd:	4c 89 f8             	mov    %r15,%rax
+}
+  8041c0:	48 83 c4 18          	add    $0x18,%rsp
+  8041c4:	5b                   	pop    %rbx
+  8041c5:	41 5c                	pop    %r12
+  8041c7:	41 5d                	pop    %r13
+  8041c9:	41 5e                	pop    %r14
+  8041cb:	41 5f                	pop    %r15
+  8041cd:	5d                   	pop    %rbp
+  8041ce:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8041cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d4:	eb ea                	jmp    8041c0 <devpipe_read+0xd2>
+
+00000000008041d6 <pipe>:
+pipe(int pfd[2]) {
+  8041d6:	55                   	push   %rbp
+  8041d7:	48 89 e5             	mov    %rsp,%rbp
+  8041da:	41 55                	push   %r13
+  8041dc:	41 54                	push   %r12
+  8041de:	53                   	push   %rbx
+  8041df:	48 83 ec 18          	sub    $0x18,%rsp
+  8041e3:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8041e6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8041ea:	48 b8 e9 2f 80 00 00 	movabs $0x802fe9,%rax
+  8041f1:	00 00 00 
+  8041f4:	ff d0                	call   *%rax
+  8041f6:	89 c3                	mov    %eax,%ebx
+  8041f8:	85 c0                	test   %eax,%eax
+  8041fa:	0f 88 a0 01 00 00    	js     8043a0 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804200:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804205:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80420a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80420e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804213:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  80421a:	00 00 00 
+  80421d:	ff d0                	call   *%rax
+  80421f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804221:	85 c0                	test   %eax,%eax
+  804223:	0f 88 77 01 00 00    	js     8043a0 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804229:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80422d:	48 b8 e9 2f 80 00 00 	movabs $0x802fe9,%rax
+  804234:	00 00 00 
+  804237:	ff d0                	call   *%rax
+  804239:	89 c3                	mov    %eax,%ebx
+  80423b:	85 c0                	test   %eax,%eax
+  80423d:	0f 88 43 01 00 00    	js     804386 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804243:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804248:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80424d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804251:	bf 00 00 00 00       	mov    $0x0,%edi
+  804256:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  80425d:	00 00 00 
+  804260:	ff d0                	call   *%rax
+  804262:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804264:	85 c0                	test   %eax,%eax
+  804266:	0f 88 1a 01 00 00    	js     804386 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80426c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804270:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  804277:	00 00 00 
+  80427a:	ff d0                	call   *%rax
+  80427c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80427f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804284:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804289:	48 89 c6             	mov    %rax,%rsi
+  80428c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804291:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  804298:	00 00 00 
+  80429b:	ff d0                	call   *%rax
+  80429d:	89 c3                	mov    %eax,%ebx
+  80429f:	85 c0                	test   %eax,%eax
+  8042a1:	0f 88 c5 00 00 00    	js     80436c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8042a7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8042ab:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  8042b2:	00 00 00 
+  8042b5:	ff d0                	call   *%rax
+  8042b7:	48 89 c1             	mov    %rax,%rcx
+  8042ba:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8042c0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8042c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042cb:	4c 89 ee             	mov    %r13,%rsi
+  8042ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042d3:	48 b8 ca 29 80 00 00 	movabs $0x8029ca,%rax
+  8042da:	00 00 00 
+  8042dd:	ff d0                	call   *%rax
+  8042df:	89 c3                	mov    %eax,%ebx
+  8042e1:	85 c0                	test   %eax,%eax
+  8042e3:	78 6e                	js     804353 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8042e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042ea:	4c 89 ef             	mov    %r13,%rdi
+  8042ed:	48 b8 f3 28 80 00 00 	movabs $0x8028f3,%rax
+  8042f4:	00 00 00 
+  8042f7:	ff d0                	call   *%rax
+  8042f9:	83 f8 02             	cmp    $0x2,%eax
+  8042fc:	0f 85 ab 00 00 00    	jne    8043ad <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804302:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804309:	00 00 
+  80430b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80430f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804311:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804315:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80431c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804320:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804322:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804326:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80432d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804331:	48 bb bb 2f 80 00 00 	movabs $0x802fbb,%rbx
+  804338:	00 00 00 
+  80433b:	ff d3                	call   *%rbx
+  80433d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804341:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804345:	ff d3                	call   *%rbx
+  804347:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80434c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804351:	eb 4d                	jmp    8043a0 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804353:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804358:	4c 89 ee             	mov    %r13,%rsi
+  80435b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804360:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  804367:	00 00 00 
+  80436a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80436c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804371:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804375:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437a:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  804381:	00 00 00 
+  804384:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804386:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80438b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80438f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804394:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  80439b:	00 00 00 
+  80439e:	ff d0                	call   *%rax
+}
+  8043a0:	89 d8                	mov    %ebx,%eax
+  8043a2:	48 83 c4 18          	add    $0x18,%rsp
+  8043a6:	5b                   	pop    %rbx
+  8043a7:	41 5c                	pop    %r12
+  8043a9:	41 5d                	pop    %r13
+  8043ab:	5d                   	pop    %rbp
+  8043ac:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8043ad:	48 b9 a8 64 80 00 00 	movabs $0x8064a8,%rcx
+  8043b4:	00 00 00 
+  8043b7:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  8043be:	00 00 00 
+  8043c1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8043c6:	48 bf 97 64 80 00 00 	movabs $0x806497,%rdi
+  8043cd:	00 00 00 
+  8043d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d5:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  8043dc:	00 00 00 
+  8043df:	41 ff d0             	call   *%r8
+
+00000000008043e2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8043e2:	55                   	push   %rbp
+  8043e3:	48 89 e5             	mov    %rsp,%rbp
+  8043e6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043ea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043ee:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  8043f5:	00 00 00 
+  8043f8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043fa:	85 c0                	test   %eax,%eax
+  8043fc:	78 35                	js     804433 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8043fe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804402:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  804409:	00 00 00 
+  80440c:	ff d0                	call   *%rax
+  80440e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804411:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804416:	be 00 10 00 00       	mov    $0x1000,%esi
+  80441b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80441f:	48 b8 2b 29 80 00 00 	movabs $0x80292b,%rax
+  804426:	00 00 00 
+  804429:	ff d0                	call   *%rax
+  80442b:	85 c0                	test   %eax,%eax
+  80442d:	0f 94 c0             	sete   %al
+  804430:	0f b6 c0             	movzbl %al,%eax
+}
+  804433:	c9                   	leave
+  804434:	c3                   	ret
+
+0000000000804435 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804435:	48 89 f8             	mov    %rdi,%rax
+  804438:	48 c1 e8 27          	shr    $0x27,%rax
+  80443c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804443:	01 00 00 
+  804446:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80444a:	f6 c2 01             	test   $0x1,%dl
+  80444d:	74 6d                	je     8044bc <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80444f:	48 89 f8             	mov    %rdi,%rax
+  804452:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804456:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80445d:	01 00 00 
+  804460:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804464:	f6 c2 01             	test   $0x1,%dl
+  804467:	74 62                	je     8044cb <get_uvpt_entry+0x96>
+  804469:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804470:	01 00 00 
+  804473:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804477:	f6 c2 80             	test   $0x80,%dl
+  80447a:	75 4f                	jne    8044cb <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80447c:	48 89 f8             	mov    %rdi,%rax
+  80447f:	48 c1 e8 15          	shr    $0x15,%rax
+  804483:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80448a:	01 00 00 
+  80448d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804491:	f6 c2 01             	test   $0x1,%dl
+  804494:	74 44                	je     8044da <get_uvpt_entry+0xa5>
+  804496:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80449d:	01 00 00 
+  8044a0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044a4:	f6 c2 80             	test   $0x80,%dl
+  8044a7:	75 31                	jne    8044da <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8044a9:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8044ad:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8044b4:	01 00 00 
+  8044b7:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8044bb:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8044bc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8044c3:	01 00 00 
+  8044c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044ca:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044cb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044d2:	01 00 00 
+  8044d5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044d9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044da:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044e1:	01 00 00 
+  8044e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044e8:	c3                   	ret
+
+00000000008044e9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8044e9:	55                   	push   %rbp
+  8044ea:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044ed:	48 b8 35 44 80 00 00 	movabs $0x804435,%rax
+  8044f4:	00 00 00 
+  8044f7:	ff d0                	call   *%rax
+  8044f9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8044fc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804501:	89 c1                	mov    %eax,%ecx
+  804503:	83 c9 04             	or     $0x4,%ecx
+  804506:	f6 c2 01             	test   $0x1,%dl
+  804509:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80450c:	89 c1                	mov    %eax,%ecx
+  80450e:	83 c9 02             	or     $0x2,%ecx
+  804511:	f6 c2 02             	test   $0x2,%dl
+  804514:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804517:	89 c1                	mov    %eax,%ecx
+  804519:	83 c9 01             	or     $0x1,%ecx
+  80451c:	48 85 d2             	test   %rdx,%rdx
+  80451f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804522:	89 c1                	mov    %eax,%ecx
+  804524:	83 c9 40             	or     $0x40,%ecx
+  804527:	f6 c6 04             	test   $0x4,%dh
+  80452a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80452d:	5d                   	pop    %rbp
+  80452e:	c3                   	ret
+
+000000000080452f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80452f:	55                   	push   %rbp
+  804530:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804533:	48 b8 35 44 80 00 00 	movabs $0x804435,%rax
+  80453a:	00 00 00 
+  80453d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80453f:	48 c1 e8 06          	shr    $0x6,%rax
+  804543:	83 e0 01             	and    $0x1,%eax
+}
+  804546:	5d                   	pop    %rbp
+  804547:	c3                   	ret
+
+0000000000804548 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804548:	55                   	push   %rbp
+  804549:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80454c:	48 b8 35 44 80 00 00 	movabs $0x804435,%rax
+  804553:	00 00 00 
+  804556:	ff d0                	call   *%rax
+  804558:	83 e0 01             	and    $0x1,%eax
+}
+  80455b:	5d                   	pop    %rbp
+  80455c:	c3                   	ret
+
+000000000080455d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80455d:	55                   	push   %rbp
+  80455e:	48 89 e5             	mov    %rsp,%rbp
+  804561:	41 57                	push   %r15
+  804563:	41 56                	push   %r14
+  804565:	41 55                	push   %r13
+  804567:	41 54                	push   %r12
+  804569:	53                   	push   %rbx
+  80456a:	48 83 ec 28          	sub    $0x28,%rsp
+  80456e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804572:	48 85 ff             	test   %rdi,%rdi
+  804575:	74 1e                	je     804595 <foreach_shared_region+0x38>
+  804577:	49 89 ff             	mov    %rdi,%r15
+  80457a:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804580:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804586:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80458d:	01 00 00 
+  804590:	e9 72 02 00 00       	jmp    804807 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804595:	48 b9 cc 64 80 00 00 	movabs $0x8064cc,%rcx
+  80459c:	00 00 00 
+  80459f:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  8045a6:	00 00 00 
+  8045a9:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8045ae:	48 bf d0 64 80 00 00 	movabs $0x8064d0,%rdi
+  8045b5:	00 00 00 
+  8045b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045bd:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  8045c4:	00 00 00 
+  8045c7:	41 ff d0             	call   *%r8
+  8045ca:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8045d1:	eb 6c                	jmp    80463f <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8045d3:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8045da:	ff ff ff 
+  8045dd:	4c 21 e2             	and    %r12,%rdx
+  8045e0:	48 89 d8             	mov    %rbx,%rax
+  8045e3:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8045e8:	48 83 c0 01          	add    $0x1,%rax
+  8045ec:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8045f0:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8045f7:	00 00 00 
+  8045fa:	48 21 c8             	and    %rcx,%rax
+  8045fd:	48 09 d0             	or     %rdx,%rax
+  804600:	49 89 c4             	mov    %rax,%r12
+  804603:	eb 30                	jmp    804635 <foreach_shared_region+0xd8>
+  804605:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80460c:	ff ff ff 
+  80460f:	4c 21 e2             	and    %r12,%rdx
+  804612:	48 89 d8             	mov    %rbx,%rax
+  804615:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80461a:	48 83 c0 01          	add    $0x1,%rax
+  80461e:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804622:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804629:	00 00 00 
+  80462c:	48 21 c8             	and    %rcx,%rax
+  80462f:	48 09 d0             	or     %rdx,%rax
+  804632:	49 89 c4             	mov    %rax,%r12
+  804635:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804639:	0f 84 99 01 00 00    	je     8047d8 <foreach_shared_region+0x27b>
+  80463f:	4c 89 e3             	mov    %r12,%rbx
+  804642:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804646:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80464d:	01 00 00 
+  804650:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804654:	a8 01                	test   $0x1,%al
+  804656:	0f 84 77 ff ff ff    	je     8045d3 <foreach_shared_region+0x76>
+  80465c:	a8 80                	test   $0x80,%al
+  80465e:	74 19                	je     804679 <foreach_shared_region+0x11c>
+  804660:	f6 c4 04             	test   $0x4,%ah
+  804663:	74 a0                	je     804605 <foreach_shared_region+0xa8>
+  804665:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80466c:	40 
+  80466d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804671:	4c 89 e7             	mov    %r12,%rdi
+  804674:	41 ff d7             	call   *%r15
+  804677:	eb 8c                	jmp    804605 <foreach_shared_region+0xa8>
+  804679:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804680:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804684:	eb 46                	jmp    8046cc <foreach_shared_region+0x16f>
+  804686:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80468d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804693:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804697:	48 c1 e0 15          	shl    $0x15,%rax
+  80469b:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8046a0:	49 09 c4             	or     %rax,%r12
+  8046a3:	eb 1d                	jmp    8046c2 <foreach_shared_region+0x165>
+  8046a5:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8046ac:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8046b2:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8046b6:	48 c1 e0 15          	shl    $0x15,%rax
+  8046ba:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8046bf:	49 09 c4             	or     %rax,%r12
+  8046c2:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8046c6:	0f 84 d3 00 00 00    	je     80479f <foreach_shared_region+0x242>
+  8046cc:	4c 89 e3             	mov    %r12,%rbx
+  8046cf:	48 c1 eb 15          	shr    $0x15,%rbx
+  8046d3:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8046da:	01 00 00 
+  8046dd:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8046e1:	a8 01                	test   $0x1,%al
+  8046e3:	74 a1                	je     804686 <foreach_shared_region+0x129>
+  8046e5:	a8 80                	test   $0x80,%al
+  8046e7:	74 19                	je     804702 <foreach_shared_region+0x1a5>
+  8046e9:	f6 c4 04             	test   $0x4,%ah
+  8046ec:	74 b7                	je     8046a5 <foreach_shared_region+0x148>
+  8046ee:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8046f5:	00 
+  8046f6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046fa:	4c 89 e7             	mov    %r12,%rdi
+  8046fd:	41 ff d7             	call   *%r15
+  804700:	eb a3                	jmp    8046a5 <foreach_shared_region+0x148>
+  804702:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804708:	eb 3b                	jmp    804745 <foreach_shared_region+0x1e8>
+  80470a:	f6 c4 04             	test   $0x4,%ah
+  80470d:	74 12                	je     804721 <foreach_shared_region+0x1c4>
+  80470f:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804716:	00 
+  804717:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80471b:	4c 89 e7             	mov    %r12,%rdi
+  80471e:	41 ff d7             	call   *%r15
+  804721:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804728:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80472e:	48 83 c3 01          	add    $0x1,%rbx
+  804732:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804736:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80473c:	49 09 dc             	or     %rbx,%r12
+  80473f:	41 83 ed 01          	sub    $0x1,%r13d
+  804743:	74 2f                	je     804774 <foreach_shared_region+0x217>
+  804745:	4c 89 e3             	mov    %r12,%rbx
+  804748:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80474c:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804750:	a8 01                	test   $0x1,%al
+  804752:	75 b6                	jne    80470a <foreach_shared_region+0x1ad>
+  804754:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80475b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804761:	48 83 c3 01          	add    $0x1,%rbx
+  804765:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804769:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80476f:	49 09 dc             	or     %rbx,%r12
+  804772:	eb cb                	jmp    80473f <foreach_shared_region+0x1e2>
+  804774:	4c 89 e0             	mov    %r12,%rax
+  804777:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80477d:	49 c1 ec 15          	shr    $0x15,%r12
+  804781:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804788:	49 83 c4 01          	add    $0x1,%r12
+  80478c:	49 c1 e4 15          	shl    $0x15,%r12
+  804790:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804797:	49 09 c4             	or     %rax,%r12
+  80479a:	e9 23 ff ff ff       	jmp    8046c2 <foreach_shared_region+0x165>
+  80479f:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8047a3:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8047aa:	ff ff ff 
+  8047ad:	4c 21 e0             	and    %r12,%rax
+  8047b0:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8047b4:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8047bb:	49 83 c4 01          	add    $0x1,%r12
+  8047bf:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8047c3:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8047ca:	00 00 00 
+  8047cd:	49 21 d4             	and    %rdx,%r12
+  8047d0:	49 09 c4             	or     %rax,%r12
+  8047d3:	e9 5d fe ff ff       	jmp    804635 <foreach_shared_region+0xd8>
+  8047d8:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8047df:	00 ff ff 
+  8047e2:	4c 21 e0             	and    %r12,%rax
+  8047e5:	49 c1 ec 27          	shr    $0x27,%r12
+  8047e9:	49 83 c4 01          	add    $0x1,%r12
+  8047ed:	49 c1 e4 27          	shl    $0x27,%r12
+  8047f1:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8047f8:	ff 00 00 
+  8047fb:	49 21 d4             	and    %rdx,%r12
+  8047fe:	49 09 c4             	or     %rax,%r12
+  804801:	41 83 ed 01          	sub    $0x1,%r13d
+  804805:	74 48                	je     80484f <foreach_shared_region+0x2f2>
+  804807:	4c 89 e0             	mov    %r12,%rax
+  80480a:	48 c1 e8 27          	shr    $0x27,%rax
+  80480e:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804815:	01 00 00 
+  804818:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  80481c:	f6 c2 01             	test   $0x1,%dl
+  80481f:	0f 85 a5 fd ff ff    	jne    8045ca <foreach_shared_region+0x6d>
+  804825:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  80482c:	00 ff ff 
+  80482f:	4c 21 e2             	and    %r12,%rdx
+  804832:	48 83 c0 01          	add    $0x1,%rax
+  804836:	48 c1 e0 27          	shl    $0x27,%rax
+  80483a:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804841:	ff 00 00 
+  804844:	48 21 c8             	and    %rcx,%rax
+  804847:	48 09 d0             	or     %rdx,%rax
+  80484a:	49 89 c4             	mov    %rax,%r12
+  80484d:	eb b2                	jmp    804801 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80484f:	4d 85 e4             	test   %r12,%r12
+  804852:	75 14                	jne    804868 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804854:	b8 00 00 00 00       	mov    $0x0,%eax
+  804859:	48 83 c4 28          	add    $0x28,%rsp
+  80485d:	5b                   	pop    %rbx
+  80485e:	41 5c                	pop    %r12
+  804860:	41 5d                	pop    %r13
+  804862:	41 5e                	pop    %r14
+  804864:	41 5f                	pop    %r15
+  804866:	5d                   	pop    %rbp
+  804867:	c3                   	ret
+    assert(addr == 0);
+  804868:	48 b9 db 64 80 00 00 	movabs $0x8064db,%rcx
+  80486f:	00 00 00 
+  804872:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  804879:	00 00 00 
+  80487c:	be 67 00 00 00       	mov    $0x67,%esi
+  804881:	48 bf d0 64 80 00 00 	movabs $0x8064d0,%rdi
+  804888:	00 00 00 
+  80488b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804890:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  804897:	00 00 00 
+  80489a:	41 ff d0             	call   *%r8
+
+000000000080489d <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80489d:	49 b8 20 c4 80 01 00 	movabs $0x180c420,%r8
+  8048a4:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8048a7:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8048ad:	eb 33                	jmp    8048e2 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8048af:	48 83 c0 20          	add    $0x20,%rax
+  8048b3:	4c 39 c0             	cmp    %r8,%rax
+  8048b6:	74 25                	je     8048dd <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8048b8:	48 8b 10             	mov    (%rax),%rdx
+  8048bb:	48 85 d2             	test   %rdx,%rdx
+  8048be:	74 ef                	je     8048af <mmap_place+0x12>
+  8048c0:	48 89 d1             	mov    %rdx,%rcx
+  8048c3:	48 03 48 08          	add    0x8(%rax),%rcx
+  8048c7:	48 39 cf             	cmp    %rcx,%rdi
+  8048ca:	73 e3                	jae    8048af <mmap_place+0x12>
+  8048cc:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8048d0:	4c 39 ca             	cmp    %r9,%rdx
+  8048d3:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8048d7:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8048db:	eb d2                	jmp    8048af <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8048dd:	45 84 d2             	test   %r10b,%r10b
+  8048e0:	74 12                	je     8048f4 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8048e2:	48 b8 20 c0 80 01 00 	movabs $0x180c020,%rax
+  8048e9:	00 00 00 
+        moved = 0;
+  8048ec:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8048f2:	eb c4                	jmp    8048b8 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8048f4:	48 01 fe             	add    %rdi,%rsi
+  8048f7:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8048fe:	00 00 00 
+  804901:	48 39 f0             	cmp    %rsi,%rax
+  804904:	b8 00 00 00 00       	mov    $0x0,%eax
+  804909:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  80490d:	c3                   	ret
+
+000000000080490e <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  80490e:	55                   	push   %rbp
+  80490f:	48 89 e5             	mov    %rsp,%rbp
+  804912:	41 57                	push   %r15
+  804914:	41 56                	push   %r14
+  804916:	41 55                	push   %r13
+  804918:	41 54                	push   %r12
+  80491a:	53                   	push   %rbx
+  80491b:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80491f:	48 8b 1f             	mov    (%rdi),%rbx
+  804922:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804929:	48 b8 20 c0 80 01 00 	movabs $0x180c020,%rax
+  804930:	00 00 00 
+  804933:	ba 00 00 00 00       	mov    $0x0,%edx
+  804938:	eb 12                	jmp    80494c <mmap_pgfault+0x3e>
+  80493a:	48 83 c2 01          	add    $0x1,%rdx
+  80493e:	48 83 c0 20          	add    $0x20,%rax
+  804942:	48 83 fa 20          	cmp    $0x20,%rdx
+  804946:	0f 84 04 01 00 00    	je     804a50 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80494c:	48 8b 08             	mov    (%rax),%rcx
+  80494f:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804953:	48 39 de             	cmp    %rbx,%rsi
+  804956:	73 e2                	jae    80493a <mmap_pgfault+0x2c>
+  804958:	48 03 48 08          	add    0x8(%rax),%rcx
+  80495c:	48 39 cb             	cmp    %rcx,%rbx
+  80495f:	73 d9                	jae    80493a <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804961:	48 c1 e2 05          	shl    $0x5,%rdx
+  804965:	48 b8 20 c0 80 01 00 	movabs $0x180c020,%rax
+  80496c:	00 00 00 
+  80496f:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804973:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804977:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80497b:	f6 c2 01             	test   $0x1,%dl
+  80497e:	0f 84 e0 00 00 00    	je     804a64 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804984:	b8 00 00 00 00       	mov    $0x0,%eax
+  804989:	f6 c2 02             	test   $0x2,%dl
+  80498c:	0f 84 c3 00 00 00    	je     804a55 <mmap_pgfault+0x147>
+  804992:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804999:	ff ff ff 
+  80499c:	48 23 56 10          	and    0x10(%rsi),%rdx
+  8049a0:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  8049a7:	00 00 00 
+  8049aa:	48 39 ca             	cmp    %rcx,%rdx
+  8049ad:	0f 85 a2 00 00 00    	jne    804a55 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8049b3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8049b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049bd:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8049c4:	00 00 00 
+  8049c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049cc:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  8049d3:	00 00 00 
+  8049d6:	ff d0                	call   *%rax
+  8049d8:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8049da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049df:	85 d2                	test   %edx,%edx
+  8049e1:	78 72                	js     804a55 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8049e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049e8:	48 89 de             	mov    %rbx,%rsi
+  8049eb:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8049f2:	00 00 00 
+  8049f5:	4c 89 e7             	mov    %r12,%rdi
+  8049f8:	48 b8 af 25 80 00 00 	movabs $0x8025af,%rax
+  8049ff:	00 00 00 
+  804a02:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804a04:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804a0a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a10:	48 89 d9             	mov    %rbx,%rcx
+  804a13:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a18:	4c 89 e6             	mov    %r12,%rsi
+  804a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a20:	48 b8 ca 29 80 00 00 	movabs $0x8029ca,%rax
+  804a27:	00 00 00 
+  804a2a:	ff d0                	call   *%rax
+  804a2c:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804a2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a33:	4c 89 e6             	mov    %r12,%rsi
+  804a36:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a3b:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  804a42:	00 00 00 
+  804a45:	ff d0                	call   *%rax
+    return res >= 0;
+  804a47:	89 d8                	mov    %ebx,%eax
+  804a49:	f7 d0                	not    %eax
+  804a4b:	c1 e8 1f             	shr    $0x1f,%eax
+  804a4e:	eb 05                	jmp    804a55 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804a50:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804a55:	48 83 c4 18          	add    $0x18,%rsp
+  804a59:	5b                   	pop    %rbx
+  804a5a:	41 5c                	pop    %r12
+  804a5c:	41 5d                	pop    %r13
+  804a5e:	41 5e                	pop    %r14
+  804a60:	41 5f                	pop    %r15
+  804a62:	5d                   	pop    %rbp
+  804a63:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804a64:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a68:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804a6c:	4c 03 30             	add    (%rax),%r14
+  804a6f:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804a76:	49 39 c6             	cmp    %rax,%r14
+  804a79:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a7d:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804a84:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a8a:	49 bf 48 45 80 00 00 	movabs $0x804548,%r15
+  804a91:	00 00 00 
+  804a94:	4d 39 f4             	cmp    %r14,%r12
+  804a97:	73 1d                	jae    804ab6 <mmap_pgfault+0x1a8>
+  804a99:	4c 89 e7             	mov    %r12,%rdi
+  804a9c:	41 ff d7             	call   *%r15
+  804a9f:	84 c0                	test   %al,%al
+  804aa1:	75 13                	jne    804ab6 <mmap_pgfault+0x1a8>
+  804aa3:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804aaa:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804ab1:	4d 39 f4             	cmp    %r14,%r12
+  804ab4:	72 e3                	jb     804a99 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804ab6:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804abc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ac0:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804ac4:	74 2a                	je     804af0 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804ac6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aca:	89 de                	mov    %ebx,%esi
+  804acc:	2b 30                	sub    (%rax),%esi
+  804ace:	03 70 1c             	add    0x1c(%rax),%esi
+  804ad1:	8b 78 18             	mov    0x18(%rax),%edi
+  804ad4:	4c 89 e9             	mov    %r13,%rcx
+  804ad7:	48 89 da             	mov    %rbx,%rdx
+  804ada:	48 b8 a6 3c 80 00 00 	movabs $0x803ca6,%rax
+  804ae1:	00 00 00 
+  804ae4:	ff d0                	call   *%rax
+    return res > 0;
+  804ae6:	85 c0                	test   %eax,%eax
+  804ae8:	0f 9f c0             	setg   %al
+  804aeb:	e9 65 ff ff ff       	jmp    804a55 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804af0:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804af4:	eb d0                	jmp    804ac6 <mmap_pgfault+0x1b8>
+
+0000000000804af6 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804af6:	55                   	push   %rbp
+  804af7:	48 89 e5             	mov    %rsp,%rbp
+  804afa:	41 57                	push   %r15
+  804afc:	41 56                	push   %r14
+  804afe:	41 55                	push   %r13
+  804b00:	41 54                	push   %r12
+  804b02:	53                   	push   %rbx
+  804b03:	48 83 ec 28          	sub    $0x28,%rsp
+  804b07:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804b0b:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804b0e:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804b15:	ff ff ff 
+  804b18:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b21:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804b28:	00 00 00 
+  804b2b:	48 39 ca             	cmp    %rcx,%rdx
+  804b2e:	0f 85 e5 00 00 00    	jne    804c19 <mmap_writeback+0x123>
+  804b34:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804b37:	4c 39 ee             	cmp    %r13,%rsi
+  804b3a:	0f 83 e8 00 00 00    	jae    804c28 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b40:	49 be 48 45 80 00 00 	movabs $0x804548,%r14
+  804b47:	00 00 00 
+  804b4a:	49 bf 2f 45 80 00 00 	movabs $0x80452f,%r15
+  804b51:	00 00 00 
+  804b54:	eb 10                	jmp    804b66 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804b56:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804b5d:	4d 39 ec             	cmp    %r13,%r12
+  804b60:	0f 83 ae 00 00 00    	jae    804c14 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b66:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804b6a:	4c 89 e7             	mov    %r12,%rdi
+  804b6d:	41 ff d6             	call   *%r14
+  804b70:	84 c0                	test   %al,%al
+  804b72:	74 e2                	je     804b56 <mmap_writeback+0x60>
+  804b74:	4c 89 e7             	mov    %r12,%rdi
+  804b77:	41 ff d7             	call   *%r15
+  804b7a:	84 c0                	test   %al,%al
+  804b7c:	74 d8                	je     804b56 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804b7e:	4c 89 e3             	mov    %r12,%rbx
+  804b81:	4d 39 ec             	cmp    %r13,%r12
+  804b84:	73 20                	jae    804ba6 <mmap_writeback+0xb0>
+  804b86:	48 89 df             	mov    %rbx,%rdi
+  804b89:	41 ff d6             	call   *%r14
+  804b8c:	84 c0                	test   %al,%al
+  804b8e:	74 16                	je     804ba6 <mmap_writeback+0xb0>
+  804b90:	48 89 df             	mov    %rbx,%rdi
+  804b93:	41 ff d7             	call   *%r15
+  804b96:	84 c0                	test   %al,%al
+  804b98:	74 0c                	je     804ba6 <mmap_writeback+0xb0>
+  804b9a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804ba1:	4c 39 eb             	cmp    %r13,%rbx
+  804ba4:	72 e0                	jb     804b86 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804ba6:	48 89 d9             	mov    %rbx,%rcx
+  804ba9:	4c 29 e1             	sub    %r12,%rcx
+  804bac:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bb0:	44 89 e6             	mov    %r12d,%esi
+  804bb3:	2b 30                	sub    (%rax),%esi
+  804bb5:	49 89 c4             	mov    %rax,%r12
+  804bb8:	03 70 1c             	add    0x1c(%rax),%esi
+  804bbb:	8b 78 18             	mov    0x18(%rax),%edi
+  804bbe:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804bc2:	48 89 ca             	mov    %rcx,%rdx
+  804bc5:	48 b8 2f 3d 80 00 00 	movabs $0x803d2f,%rax
+  804bcc:	00 00 00 
+  804bcf:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804bd1:	85 c0                	test   %eax,%eax
+  804bd3:	78 44                	js     804c19 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804bd5:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804bda:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804bdd:	41 89 c1             	mov    %eax,%r9d
+  804be0:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804be7:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804beb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804bef:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bf4:	48 89 ce             	mov    %rcx,%rsi
+  804bf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bfc:	48 b8 ca 29 80 00 00 	movabs $0x8029ca,%rax
+  804c03:	00 00 00 
+  804c06:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804c08:	85 c0                	test   %eax,%eax
+  804c0a:	78 0d                	js     804c19 <mmap_writeback+0x123>
+  804c0c:	49 89 dc             	mov    %rbx,%r12
+  804c0f:	e9 49 ff ff ff       	jmp    804b5d <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804c14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c19:	48 83 c4 28          	add    $0x28,%rsp
+  804c1d:	5b                   	pop    %rbx
+  804c1e:	41 5c                	pop    %r12
+  804c20:	41 5d                	pop    %r13
+  804c22:	41 5e                	pop    %r14
+  804c24:	41 5f                	pop    %r15
+  804c26:	5d                   	pop    %rbp
+  804c27:	c3                   	ret
+    return 0;
+  804c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c2d:	eb ea                	jmp    804c19 <mmap_writeback+0x123>
+
+0000000000804c2f <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804c2f:	55                   	push   %rbp
+  804c30:	48 89 e5             	mov    %rsp,%rbp
+  804c33:	41 57                	push   %r15
+  804c35:	41 56                	push   %r14
+  804c37:	41 55                	push   %r13
+  804c39:	41 54                	push   %r12
+  804c3b:	53                   	push   %rbx
+  804c3c:	48 83 ec 38          	sub    $0x38,%rsp
+  804c40:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c44:	48 85 f6             	test   %rsi,%rsi
+  804c47:	0f 84 0c 02 00 00    	je     804e59 <mmap+0x22a>
+  804c4d:	49 89 ff             	mov    %rdi,%r15
+  804c50:	49 89 f4             	mov    %rsi,%r12
+  804c53:	41 89 d5             	mov    %edx,%r13d
+  804c56:	41 89 ce             	mov    %ecx,%r14d
+  804c59:	44 89 cb             	mov    %r9d,%ebx
+  804c5c:	45 85 c9             	test   %r9d,%r9d
+  804c5f:	0f 88 f4 01 00 00    	js     804e59 <mmap+0x22a>
+  804c65:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c6c:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804c73:	0f 85 e7 01 00 00    	jne    804e60 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804c79:	83 e2 fd             	and    $0xfffffffd,%edx
+  804c7c:	83 fa 04             	cmp    $0x4,%edx
+  804c7f:	0f 85 db 01 00 00    	jne    804e60 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804c85:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804c88:	83 fa 01             	cmp    $0x1,%edx
+  804c8b:	0f 87 cf 01 00 00    	ja     804e60 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804c91:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804c95:	44 89 c7             	mov    %r8d,%edi
+  804c98:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  804c9f:	00 00 00 
+  804ca2:	ff d0                	call   *%rax
+  804ca4:	89 c2                	mov    %eax,%edx
+  804ca6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cad:	85 d2                	test   %edx,%edx
+  804caf:	0f 88 ab 01 00 00    	js     804e60 <mmap+0x231>
+  804cb5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804cb9:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804cc0:	00 00 00 
+  804cc3:	8b 09                	mov    (%rcx),%ecx
+  804cc5:	39 0a                	cmp    %ecx,(%rdx)
+  804cc7:	0f 85 93 01 00 00    	jne    804e60 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804ccd:	8b 52 08             	mov    0x8(%rdx),%edx
+  804cd0:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804cd3:	83 fa 01             	cmp    $0x1,%edx
+  804cd6:	0f 84 84 01 00 00    	je     804e60 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804cdc:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ce0:	74 42                	je     804d24 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ce2:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804ce9:	4c 89 e6             	mov    %r12,%rsi
+  804cec:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804cf3:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804cf7:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804cfb:	4d 85 ff             	test   %r15,%r15
+  804cfe:	74 67                	je     804d67 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d00:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804d07:	75 0f                	jne    804d18 <mmap+0xe9>
+  804d09:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804d10:	00 00 00 
+  804d13:	49 39 c7             	cmp    %rax,%r15
+  804d16:	77 1b                	ja     804d33 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d18:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d1f:	e9 3c 01 00 00       	jmp    804e60 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d24:	41 f6 c5 02          	test   $0x2,%r13b
+  804d28:	74 b8                	je     804ce2 <mmap+0xb3>
+  804d2a:	85 d2                	test   %edx,%edx
+  804d2c:	75 b4                	jne    804ce2 <mmap+0xb3>
+  804d2e:	e9 2d 01 00 00       	jmp    804e60 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d33:	4c 89 ff             	mov    %r15,%rdi
+  804d36:	48 b8 9d 48 80 00 00 	movabs $0x80489d,%rax
+  804d3d:	00 00 00 
+  804d40:	ff d0                	call   *%rax
+  804d42:	48 89 c2             	mov    %rax,%rdx
+  804d45:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d4c:	49 39 d7             	cmp    %rdx,%r15
+  804d4f:	0f 85 0b 01 00 00    	jne    804e60 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d55:	48 b8 20 c0 80 01 00 	movabs $0x180c020,%rax
+  804d5c:	00 00 00 
+  804d5f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d65:	eb 44                	jmp    804dab <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d67:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804d6b:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804d72:	00 00 00 
+  804d75:	48 b8 9d 48 80 00 00 	movabs $0x80489d,%rax
+  804d7c:	00 00 00 
+  804d7f:	ff d0                	call   *%rax
+  804d81:	48 89 c7             	mov    %rax,%rdi
+  804d84:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804d88:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d8f:	48 85 ff             	test   %rdi,%rdi
+  804d92:	75 c1                	jne    804d55 <mmap+0x126>
+  804d94:	e9 c7 00 00 00       	jmp    804e60 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d99:	49 83 c4 01          	add    $0x1,%r12
+  804d9d:	48 83 c0 20          	add    $0x20,%rax
+  804da1:	49 83 fc 20          	cmp    $0x20,%r12
+  804da5:	0f 84 a5 00 00 00    	je     804e50 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804dab:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804daf:	75 e8                	jne    804d99 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804db1:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804db5:	48 b8 e9 2f 80 00 00 	movabs $0x802fe9,%rax
+  804dbc:	00 00 00 
+  804dbf:	ff d0                	call   *%rax
+  804dc1:	89 c2                	mov    %eax,%edx
+  804dc3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804dca:	85 d2                	test   %edx,%edx
+  804dcc:	0f 88 8e 00 00 00    	js     804e60 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804dd2:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804dd6:	48 b8 bb 2f 80 00 00 	movabs $0x802fbb,%rax
+  804ddd:	00 00 00 
+  804de0:	ff d0                	call   *%rax
+  804de2:	89 c6                	mov    %eax,%esi
+  804de4:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804de7:	48 b8 09 32 80 00 00 	movabs $0x803209,%rax
+  804dee:	00 00 00 
+  804df1:	ff d0                	call   *%rax
+  804df3:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804df6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804dfd:	45 85 ff             	test   %r15d,%r15d
+  804e00:	78 5e                	js     804e60 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e02:	49 c1 e4 05          	shl    $0x5,%r12
+  804e06:	48 b8 20 c0 80 01 00 	movabs $0x180c020,%rax
+  804e0d:	00 00 00 
+  804e10:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804e13:	48 bf 0e 49 80 00 00 	movabs $0x80490e,%rdi
+  804e1a:	00 00 00 
+  804e1d:	48 b8 39 53 80 00 00 	movabs $0x805339,%rax
+  804e24:	00 00 00 
+  804e27:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804e29:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e2d:	49 89 04 24          	mov    %rax,(%r12)
+  804e31:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804e35:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804e3a:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804e3f:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804e44:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804e49:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804e4e:	eb 10                	jmp    804e60 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804e50:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e57:	eb 07                	jmp    804e60 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804e59:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804e60:	48 83 c4 38          	add    $0x38,%rsp
+  804e64:	5b                   	pop    %rbx
+  804e65:	41 5c                	pop    %r12
+  804e67:	41 5d                	pop    %r13
+  804e69:	41 5e                	pop    %r14
+  804e6b:	41 5f                	pop    %r15
+  804e6d:	5d                   	pop    %rbp
+  804e6e:	c3                   	ret
+
+0000000000804e6f <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804e6f:	55                   	push   %rbp
+  804e70:	48 89 e5             	mov    %rsp,%rbp
+  804e73:	41 57                	push   %r15
+  804e75:	41 56                	push   %r14
+  804e77:	41 55                	push   %r13
+  804e79:	41 54                	push   %r12
+  804e7b:	53                   	push   %rbx
+  804e7c:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804e80:	49 89 fe             	mov    %rdi,%r14
+  804e83:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804e8a:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804e91:	00 
+  804e92:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e99:	48 bb 20 c0 80 01 00 	movabs $0x180c020,%rbx
+  804ea0:	00 00 00 
+  804ea3:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804eaa:	49 bf f6 4a 80 00 00 	movabs $0x804af6,%r15
+  804eb1:	00 00 00 
+  804eb4:	eb 09                	jmp    804ebf <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804eb6:	48 83 c3 20          	add    $0x20,%rbx
+  804eba:	4c 39 eb             	cmp    %r13,%rbx
+  804ebd:	74 33                	je     804ef2 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ebf:	48 89 df             	mov    %rbx,%rdi
+  804ec2:	48 8b 33             	mov    (%rbx),%rsi
+  804ec5:	4c 39 e6             	cmp    %r12,%rsi
+  804ec8:	73 ec                	jae    804eb6 <msync+0x47>
+  804eca:	48 85 f6             	test   %rsi,%rsi
+  804ecd:	74 e7                	je     804eb6 <msync+0x47>
+  804ecf:	48 89 f2             	mov    %rsi,%rdx
+  804ed2:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804ed6:	49 39 d6             	cmp    %rdx,%r14
+  804ed9:	73 db                	jae    804eb6 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804edb:	4c 39 e2             	cmp    %r12,%rdx
+  804ede:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ee2:	4c 39 f6             	cmp    %r14,%rsi
+  804ee5:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ee9:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804eec:	85 c0                	test   %eax,%eax
+  804eee:	79 c6                	jns    804eb6 <msync+0x47>
+  804ef0:	eb 05                	jmp    804ef7 <msync+0x88>
+    }
+
+    return 0;
+  804ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ef7:	48 83 c4 08          	add    $0x8,%rsp
+  804efb:	5b                   	pop    %rbx
+  804efc:	41 5c                	pop    %r12
+  804efe:	41 5d                	pop    %r13
+  804f00:	41 5e                	pop    %r14
+  804f02:	41 5f                	pop    %r15
+  804f04:	5d                   	pop    %rbp
+  804f05:	c3                   	ret
+
+0000000000804f06 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804f06:	55                   	push   %rbp
+  804f07:	48 89 e5             	mov    %rsp,%rbp
+  804f0a:	41 57                	push   %r15
+  804f0c:	41 56                	push   %r14
+  804f0e:	41 55                	push   %r13
+  804f10:	41 54                	push   %r12
+  804f12:	53                   	push   %rbx
+  804f13:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804f17:	49 89 ff             	mov    %rdi,%r15
+  804f1a:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f21:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f28:	00 
+  804f29:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f30:	48 bb 20 c0 80 01 00 	movabs $0x180c020,%rbx
+  804f37:	00 00 00 
+  804f3a:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f41:	48 89 d8             	mov    %rbx,%rax
+  804f44:	eb 09                	jmp    804f4f <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f46:	48 83 c0 20          	add    $0x20,%rax
+  804f4a:	4c 39 f0             	cmp    %r14,%rax
+  804f4d:	74 40                	je     804f8f <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f4f:	48 8b 10             	mov    (%rax),%rdx
+  804f52:	4c 39 e2             	cmp    %r12,%rdx
+  804f55:	73 ef                	jae    804f46 <munmap+0x40>
+  804f57:	48 85 d2             	test   %rdx,%rdx
+  804f5a:	74 ea                	je     804f46 <munmap+0x40>
+  804f5c:	48 89 d7             	mov    %rdx,%rdi
+  804f5f:	48 03 78 08          	add    0x8(%rax),%rdi
+  804f63:	49 39 ff             	cmp    %rdi,%r15
+  804f66:	73 de                	jae    804f46 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804f68:	49 39 fc             	cmp    %rdi,%r12
+  804f6b:	72 05                	jb     804f72 <munmap+0x6c>
+  804f6d:	4c 39 fa             	cmp    %r15,%rdx
+  804f70:	73 d4                	jae    804f46 <munmap+0x40>
+  804f72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804f77:	48 83 c4 08          	add    $0x8,%rsp
+  804f7b:	5b                   	pop    %rbx
+  804f7c:	41 5c                	pop    %r12
+  804f7e:	41 5d                	pop    %r13
+  804f80:	41 5e                	pop    %r14
+  804f82:	41 5f                	pop    %r15
+  804f84:	5d                   	pop    %rbp
+  804f85:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f86:	48 83 c3 20          	add    $0x20,%rbx
+  804f8a:	4c 39 f3             	cmp    %r14,%rbx
+  804f8d:	74 5c                	je     804feb <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f8f:	48 8b 33             	mov    (%rbx),%rsi
+  804f92:	4c 39 e6             	cmp    %r12,%rsi
+  804f95:	73 ef                	jae    804f86 <munmap+0x80>
+  804f97:	48 85 f6             	test   %rsi,%rsi
+  804f9a:	74 ea                	je     804f86 <munmap+0x80>
+  804f9c:	48 89 f2             	mov    %rsi,%rdx
+  804f9f:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804fa3:	49 39 d7             	cmp    %rdx,%r15
+  804fa6:	73 de                	jae    804f86 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804fa8:	48 89 df             	mov    %rbx,%rdi
+  804fab:	48 b8 f6 4a 80 00 00 	movabs $0x804af6,%rax
+  804fb2:	00 00 00 
+  804fb5:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804fb7:	85 c0                	test   %eax,%eax
+  804fb9:	78 bc                	js     804f77 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804fbb:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804fbf:	48 8b 33             	mov    (%rbx),%rsi
+  804fc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fc7:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  804fce:	00 00 00 
+  804fd1:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804fd3:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804fd6:	48 b8 ae 31 80 00 00 	movabs $0x8031ae,%rax
+  804fdd:	00 00 00 
+  804fe0:	ff d0                	call   *%rax
+        reg->start = 0;
+  804fe2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804fe9:	eb 9b                	jmp    804f86 <munmap+0x80>
+    return 0;
+  804feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff0:	eb 85                	jmp    804f77 <munmap+0x71>
+
+0000000000804ff2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff7:	c3                   	ret
+
+0000000000804ff8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804ff8:	55                   	push   %rbp
+  804ff9:	48 89 e5             	mov    %rsp,%rbp
+  804ffc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804fff:	48 be e5 64 80 00 00 	movabs $0x8064e5,%rsi
+  805006:	00 00 00 
+  805009:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  805010:	00 00 00 
+  805013:	ff d0                	call   *%rax
+    return 0;
+}
+  805015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501a:	5d                   	pop    %rbp
+  80501b:	c3                   	ret
+
+000000000080501c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80501c:	55                   	push   %rbp
+  80501d:	48 89 e5             	mov    %rsp,%rbp
+  805020:	41 57                	push   %r15
+  805022:	41 56                	push   %r14
+  805024:	41 55                	push   %r13
+  805026:	41 54                	push   %r12
+  805028:	53                   	push   %rbx
+  805029:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805030:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805037:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80503e:	00 00 00 00 
+  805042:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805049:	00 00 00 00 
+  80504d:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805054:	00 00 00 00 
+  805058:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80505f:	00 00 00 00 
+  805063:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  80506a:	00 00 00 00 
+  80506e:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805075:	00 00 00 00 
+  805079:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805080:	00 
+  805081:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805088:	00 
+  805089:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805090:	00 
+  805091:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805098:	00 
+  805099:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8050a0:	00 
+  8050a1:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8050a8:	00 
+  8050a9:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8050b0:	00 
+  8050b1:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8050b8:	00 
+  8050b9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8050c0:	00 
+  8050c1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8050c8:	00 
+    for (res = 0; res < n; res += inc) {
+  8050c9:	48 85 d2             	test   %rdx,%rdx
+  8050cc:	74 7a                	je     805148 <devcons_write+0x12c>
+  8050ce:	49 89 d6             	mov    %rdx,%r14
+  8050d1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050d7:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8050dc:	49 bf 48 25 80 00 00 	movabs $0x802548,%r15
+  8050e3:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8050e6:	4c 89 f3             	mov    %r14,%rbx
+  8050e9:	48 29 f3             	sub    %rsi,%rbx
+  8050ec:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8050f1:	48 39 c3             	cmp    %rax,%rbx
+  8050f4:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8050f8:	4c 63 eb             	movslq %ebx,%r13
+  8050fb:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805102:	48 01 c6             	add    %rax,%rsi
+  805105:	4c 89 ea             	mov    %r13,%rdx
+  805108:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80510f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805112:	4c 89 ee             	mov    %r13,%rsi
+  805115:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80511c:	48 b8 75 27 80 00 00 	movabs $0x802775,%rax
+  805123:	00 00 00 
+  805126:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805128:	41 01 dc             	add    %ebx,%r12d
+  80512b:	49 63 f4             	movslq %r12d,%rsi
+  80512e:	4c 39 f6             	cmp    %r14,%rsi
+  805131:	72 b3                	jb     8050e6 <devcons_write+0xca>
+    return res;
+  805133:	49 63 c4             	movslq %r12d,%rax
+}
+  805136:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80513d:	5b                   	pop    %rbx
+  80513e:	41 5c                	pop    %r12
+  805140:	41 5d                	pop    %r13
+  805142:	41 5e                	pop    %r14
+  805144:	41 5f                	pop    %r15
+  805146:	5d                   	pop    %rbp
+  805147:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805148:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80514e:	eb e3                	jmp    805133 <devcons_write+0x117>
+
+0000000000805150 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805150:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805153:	ba 00 00 00 00       	mov    $0x0,%edx
+  805158:	48 85 c0             	test   %rax,%rax
+  80515b:	74 55                	je     8051b2 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80515d:	55                   	push   %rbp
+  80515e:	48 89 e5             	mov    %rsp,%rbp
+  805161:	41 55                	push   %r13
+  805163:	41 54                	push   %r12
+  805165:	53                   	push   %rbx
+  805166:	48 83 ec 08          	sub    $0x8,%rsp
+  80516a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80516d:	48 bb a8 27 80 00 00 	movabs $0x8027a8,%rbx
+  805174:	00 00 00 
+  805177:	49 bc bc 28 80 00 00 	movabs $0x8028bc,%r12
+  80517e:	00 00 00 
+  805181:	eb 03                	jmp    805186 <devcons_read+0x36>
+  805183:	41 ff d4             	call   *%r12
+  805186:	ff d3                	call   *%rbx
+  805188:	85 c0                	test   %eax,%eax
+  80518a:	74 f7                	je     805183 <devcons_read+0x33>
+    if (c < 0) return c;
+  80518c:	48 63 d0             	movslq %eax,%rdx
+  80518f:	78 13                	js     8051a4 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805191:	ba 00 00 00 00       	mov    $0x0,%edx
+  805196:	83 f8 04             	cmp    $0x4,%eax
+  805199:	74 09                	je     8051a4 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80519b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80519f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8051a4:	48 89 d0             	mov    %rdx,%rax
+  8051a7:	48 83 c4 08          	add    $0x8,%rsp
+  8051ab:	5b                   	pop    %rbx
+  8051ac:	41 5c                	pop    %r12
+  8051ae:	41 5d                	pop    %r13
+  8051b0:	5d                   	pop    %rbp
+  8051b1:	c3                   	ret
+  8051b2:	48 89 d0             	mov    %rdx,%rax
+  8051b5:	c3                   	ret
+
+00000000008051b6 <cputchar>:
+cputchar(int ch) {
+  8051b6:	55                   	push   %rbp
+  8051b7:	48 89 e5             	mov    %rsp,%rbp
+  8051ba:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8051be:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8051c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8051c7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8051cb:	48 b8 75 27 80 00 00 	movabs $0x802775,%rax
+  8051d2:	00 00 00 
+  8051d5:	ff d0                	call   *%rax
+}
+  8051d7:	c9                   	leave
+  8051d8:	c3                   	ret
+
+00000000008051d9 <getchar>:
+getchar(void) {
+  8051d9:	55                   	push   %rbp
+  8051da:	48 89 e5             	mov    %rsp,%rbp
+  8051dd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8051e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8051e6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8051ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051ef:	48 b8 2c 33 80 00 00 	movabs $0x80332c,%rax
+  8051f6:	00 00 00 
+  8051f9:	ff d0                	call   *%rax
+  8051fb:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8051fd:	85 c0                	test   %eax,%eax
+  8051ff:	78 06                	js     805207 <getchar+0x2e>
+  805201:	74 08                	je     80520b <getchar+0x32>
+  805203:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805207:	89 d0                	mov    %edx,%eax
+  805209:	c9                   	leave
+  80520a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80520b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805210:	eb f5                	jmp    805207 <getchar+0x2e>
+
+0000000000805212 <iscons>:
+iscons(int fdnum) {
+  805212:	55                   	push   %rbp
+  805213:	48 89 e5             	mov    %rsp,%rbp
+  805216:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80521a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80521e:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  805225:	00 00 00 
+  805228:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80522a:	85 c0                	test   %eax,%eax
+  80522c:	78 18                	js     805246 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80522e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805232:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805239:	00 00 00 
+  80523c:	8b 00                	mov    (%rax),%eax
+  80523e:	39 02                	cmp    %eax,(%rdx)
+  805240:	0f 94 c0             	sete   %al
+  805243:	0f b6 c0             	movzbl %al,%eax
+}
+  805246:	c9                   	leave
+  805247:	c3                   	ret
+
+0000000000805248 <opencons>:
+opencons(void) {
+  805248:	55                   	push   %rbp
+  805249:	48 89 e5             	mov    %rsp,%rbp
+  80524c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805250:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805254:	48 b8 e9 2f 80 00 00 	movabs $0x802fe9,%rax
+  80525b:	00 00 00 
+  80525e:	ff d0                	call   *%rax
+  805260:	85 c0                	test   %eax,%eax
+  805262:	78 49                	js     8052ad <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805264:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805269:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80526e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805272:	bf 00 00 00 00       	mov    $0x0,%edi
+  805277:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  80527e:	00 00 00 
+  805281:	ff d0                	call   *%rax
+  805283:	85 c0                	test   %eax,%eax
+  805285:	78 26                	js     8052ad <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805287:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80528b:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805292:	00 00 
+  805294:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805296:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80529a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8052a1:	48 b8 bb 2f 80 00 00 	movabs $0x802fbb,%rax
+  8052a8:	00 00 00 
+  8052ab:	ff d0                	call   *%rax
+}
+  8052ad:	c9                   	leave
+  8052ae:	c3                   	ret
+
+00000000008052af <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8052af:	55                   	push   %rbp
+  8052b0:	48 89 e5             	mov    %rsp,%rbp
+  8052b3:	41 56                	push   %r14
+  8052b5:	41 55                	push   %r13
+  8052b7:	41 54                	push   %r12
+  8052b9:	53                   	push   %rbx
+  8052ba:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052bd:	48 b8 68 c4 80 01 00 	movabs $0x180c468,%rax
+  8052c4:	00 00 00 
+  8052c7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8052cb:	74 27                	je     8052f4 <_handle_vectored_pagefault+0x45>
+  8052cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8052d2:	49 bd 20 c4 80 01 00 	movabs $0x180c420,%r13
+  8052d9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052dc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8052df:	4c 89 e7             	mov    %r12,%rdi
+  8052e2:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8052e7:	84 c0                	test   %al,%al
+  8052e9:	75 45                	jne    805330 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052eb:	48 83 c3 01          	add    $0x1,%rbx
+  8052ef:	49 3b 1e             	cmp    (%r14),%rbx
+  8052f2:	72 eb                	jb     8052df <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8052f4:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8052fb:	00 
+  8052fc:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805301:	4d 8b 04 24          	mov    (%r12),%r8
+  805305:	48 ba f8 64 80 00 00 	movabs $0x8064f8,%rdx
+  80530c:	00 00 00 
+  80530f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805314:	48 bf 28 65 80 00 00 	movabs $0x806528,%rdi
+  80531b:	00 00 00 
+  80531e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805323:	49 ba 71 17 80 00 00 	movabs $0x801771,%r10
+  80532a:	00 00 00 
+  80532d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805330:	5b                   	pop    %rbx
+  805331:	41 5c                	pop    %r12
+  805333:	41 5d                	pop    %r13
+  805335:	41 5e                	pop    %r14
+  805337:	5d                   	pop    %rbp
+  805338:	c3                   	ret
+
+0000000000805339 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805339:	55                   	push   %rbp
+  80533a:	48 89 e5             	mov    %rsp,%rbp
+  80533d:	53                   	push   %rbx
+  80533e:	48 83 ec 08          	sub    $0x8,%rsp
+  805342:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805345:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  80534a:	48 b8 60 c4 80 01 00 	movabs $0x180c460,%rax
+  805351:	00 00 00 
+  805354:	80 38 00             	cmpb   $0x0,(%rax)
+  805357:	74 68                	je     8053c1 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805359:	48 b8 68 c4 80 01 00 	movabs $0x180c468,%rax
+  805360:	00 00 00 
+  805363:	48 8b 08             	mov    (%rax),%rcx
+  805366:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80536b:	48 b8 20 c4 80 01 00 	movabs $0x180c420,%rax
+  805372:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805375:	48 85 c9             	test   %rcx,%rcx
+  805378:	0f 84 e0 00 00 00    	je     80545e <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80537e:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805382:	0f 84 c9 00 00 00    	je     805451 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805388:	48 83 c2 01          	add    $0x1,%rdx
+  80538c:	48 39 ca             	cmp    %rcx,%rdx
+  80538f:	75 ed                	jne    80537e <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805391:	48 83 f9 08          	cmp    $0x8,%rcx
+  805395:	0f 84 84 00 00 00    	je     80541f <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80539b:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80539f:	48 a3 68 c4 80 01 00 	movabs %rax,0x180c468
+  8053a6:	00 00 00 
+  8053a9:	48 b8 20 c4 80 01 00 	movabs $0x180c420,%rax
+  8053b0:	00 00 00 
+  8053b3:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8053b7:	85 f6                	test   %esi,%esi
+  8053b9:	0f 89 97 00 00 00    	jns    805456 <add_pgfault_handler+0x11d>
+  8053bf:	eb 63                	jmp    805424 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8053c1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8053c6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8053cb:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8053d2:	00 00 00 
+  8053d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053da:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  8053e1:	00 00 00 
+  8053e4:	ff d0                	call   *%rax
+  8053e6:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8053e8:	85 c0                	test   %eax,%eax
+  8053ea:	78 38                	js     805424 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8053ec:	48 be 3a 55 80 00 00 	movabs $0x80553a,%rsi
+  8053f3:	00 00 00 
+  8053f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053fb:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  805402:	00 00 00 
+  805405:	ff d0                	call   *%rax
+  805407:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805409:	85 c0                	test   %eax,%eax
+  80540b:	78 17                	js     805424 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80540d:	48 b8 60 c4 80 01 00 	movabs $0x180c460,%rax
+  805414:	00 00 00 
+  805417:	c6 00 01             	movb   $0x1,(%rax)
+  80541a:	e9 3a ff ff ff       	jmp    805359 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80541f:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805424:	89 f1                	mov    %esi,%ecx
+  805426:	48 ba 36 65 80 00 00 	movabs $0x806536,%rdx
+  80542d:	00 00 00 
+  805430:	be 42 00 00 00       	mov    $0x42,%esi
+  805435:	48 bf 28 65 80 00 00 	movabs $0x806528,%rdi
+  80543c:	00 00 00 
+  80543f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805444:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  80544b:	00 00 00 
+  80544e:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805451:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805456:	89 f0                	mov    %esi,%eax
+  805458:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80545c:	c9                   	leave
+  80545d:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80545e:	48 b8 68 c4 80 01 00 	movabs $0x180c468,%rax
+  805465:	00 00 00 
+  805468:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80546f:	48 89 d8             	mov    %rbx,%rax
+  805472:	48 a3 20 c4 80 01 00 	movabs %rax,0x180c420
+  805479:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80547c:	eb d8                	jmp    805456 <add_pgfault_handler+0x11d>
+
+000000000080547e <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80547e:	55                   	push   %rbp
+  80547f:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805482:	48 b8 60 c4 80 01 00 	movabs $0x180c460,%rax
+  805489:	00 00 00 
+  80548c:	80 38 00             	cmpb   $0x0,(%rax)
+  80548f:	74 33                	je     8054c4 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805491:	48 a1 68 c4 80 01 00 	movabs 0x180c468,%rax
+  805498:	00 00 00 
+  80549b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8054a0:	48 ba 20 c4 80 01 00 	movabs $0x180c420,%rdx
+  8054a7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8054aa:	48 85 c0             	test   %rax,%rax
+  8054ad:	0f 84 85 00 00 00    	je     805538 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8054b3:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8054b7:	74 40                	je     8054f9 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8054b9:	48 83 c1 01          	add    $0x1,%rcx
+  8054bd:	48 39 c1             	cmp    %rax,%rcx
+  8054c0:	75 f1                	jne    8054b3 <remove_pgfault_handler+0x35>
+  8054c2:	eb 74                	jmp    805538 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8054c4:	48 b9 4e 65 80 00 00 	movabs $0x80654e,%rcx
+  8054cb:	00 00 00 
+  8054ce:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  8054d5:	00 00 00 
+  8054d8:	be 48 00 00 00       	mov    $0x48,%esi
+  8054dd:	48 bf 28 65 80 00 00 	movabs $0x806528,%rdi
+  8054e4:	00 00 00 
+  8054e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054ec:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  8054f3:	00 00 00 
+  8054f6:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8054f9:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805500:	00 
+  805501:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805505:	48 29 ca             	sub    %rcx,%rdx
+  805508:	48 b8 20 c4 80 01 00 	movabs $0x180c420,%rax
+  80550f:	00 00 00 
+  805512:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805516:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80551b:	48 89 ce             	mov    %rcx,%rsi
+  80551e:	48 b8 48 25 80 00 00 	movabs $0x802548,%rax
+  805525:	00 00 00 
+  805528:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80552a:	48 b8 68 c4 80 01 00 	movabs $0x180c468,%rax
+  805531:	00 00 00 
+  805534:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805538:	5d                   	pop    %rbp
+  805539:	c3                   	ret
+
+000000000080553a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80553a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80553d:	48 b8 af 52 80 00 00 	movabs $0x8052af,%rax
+  805544:	00 00 00 
+    call *%rax
+  805547:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805549:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805550:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805551:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805558:	00 
+    subq $8, %rcx
+  805559:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80555d:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805560:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805567:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805568:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  80556c:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805570:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805575:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80557a:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80557f:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805584:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805589:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80558e:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805593:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805598:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80559d:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8055a2:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8055a7:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8055ac:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8055b1:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8055b6:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8055ba:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8055be:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8055bf:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8055c0:	c3                   	ret
+
+00000000008055c1 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8055c1:	85 ff                	test   %edi,%edi
+  8055c3:	78 58                	js     80561d <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8055c5:	48 85 f6             	test   %rsi,%rsi
+  8055c8:	74 12                	je     8055dc <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8055ca:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  8055d1:	00 00 00 
+  8055d4:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8055da:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8055dc:	48 85 c9             	test   %rcx,%rcx
+  8055df:	74 12                	je     8055f3 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8055e1:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  8055e8:	00 00 00 
+  8055eb:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8055f1:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8055f3:	48 85 d2             	test   %rdx,%rdx
+  8055f6:	74 14                	je     80560c <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8055f8:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  8055ff:	00 00 00 
+  805602:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805609:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80560c:	48 a1 20 a0 80 01 00 	movabs 0x180a020,%rax
+  805613:	00 00 00 
+  805616:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80561c:	c3                   	ret
+        if (from_env_store) {
+  80561d:	48 85 f6             	test   %rsi,%rsi
+  805620:	74 06                	je     805628 <ipc_result+0x67>
+            *from_env_store = 0;
+  805622:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805628:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80562a:	48 85 c9             	test   %rcx,%rcx
+  80562d:	74 ed                	je     80561c <ipc_result+0x5b>
+            *perm_store = 0;
+  80562f:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805635:	c3                   	ret
+
+0000000000805636 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805636:	55                   	push   %rbp
+  805637:	48 89 e5             	mov    %rsp,%rbp
+  80563a:	41 55                	push   %r13
+  80563c:	41 54                	push   %r12
+  80563e:	53                   	push   %rbx
+  80563f:	48 83 ec 08          	sub    $0x8,%rsp
+  805643:	49 89 fc             	mov    %rdi,%r12
+  805646:	48 89 f7             	mov    %rsi,%rdi
+  805649:	48 89 d3             	mov    %rdx,%rbx
+  80564c:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80564f:	48 85 f6             	test   %rsi,%rsi
+  805652:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805659:	00 00 00 
+  80565c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805660:	be 00 00 00 00       	mov    $0x0,%esi
+  805665:	48 85 d2             	test   %rdx,%rdx
+  805668:	74 03                	je     80566d <ipc_recv+0x37>
+  80566a:	48 8b 32             	mov    (%rdx),%rsi
+  80566d:	48 b8 a9 2e 80 00 00 	movabs $0x802ea9,%rax
+  805674:	00 00 00 
+  805677:	ff d0                	call   *%rax
+  805679:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80567b:	4c 89 e9             	mov    %r13,%rcx
+  80567e:	48 89 da             	mov    %rbx,%rdx
+  805681:	4c 89 e6             	mov    %r12,%rsi
+  805684:	48 b8 c1 55 80 00 00 	movabs $0x8055c1,%rax
+  80568b:	00 00 00 
+  80568e:	ff d0                	call   *%rax
+}
+  805690:	48 83 c4 08          	add    $0x8,%rsp
+  805694:	5b                   	pop    %rbx
+  805695:	41 5c                	pop    %r12
+  805697:	41 5d                	pop    %r13
+  805699:	5d                   	pop    %rbp
+  80569a:	c3                   	ret
+
+000000000080569b <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80569b:	55                   	push   %rbp
+  80569c:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80569f:	48 85 d2             	test   %rdx,%rdx
+  8056a2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056a9:	00 00 00 
+  8056ac:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8056b0:	89 f6                	mov    %esi,%esi
+  8056b2:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  8056b9:	00 00 00 
+  8056bc:	ff d0                	call   *%rax
+    if (res < 0) {
+  8056be:	85 c0                	test   %eax,%eax
+  8056c0:	78 02                	js     8056c4 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8056c2:	5d                   	pop    %rbp
+  8056c3:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8056c4:	89 c1                	mov    %eax,%ecx
+  8056c6:	48 ba 68 65 80 00 00 	movabs $0x806568,%rdx
+  8056cd:	00 00 00 
+  8056d0:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8056d5:	48 bf 75 65 80 00 00 	movabs $0x806575,%rdi
+  8056dc:	00 00 00 
+  8056df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056e4:	49 b8 71 17 80 00 00 	movabs $0x801771,%r8
+  8056eb:	00 00 00 
+  8056ee:	41 ff d0             	call   *%r8
+
+00000000008056f1 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8056f1:	55                   	push   %rbp
+  8056f2:	48 89 e5             	mov    %rsp,%rbp
+  8056f5:	53                   	push   %rbx
+  8056f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8056fa:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056fe:	48 85 d2             	test   %rdx,%rdx
+  805701:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805708:	00 00 00 
+  80570b:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80570f:	4d 85 c9             	test   %r9,%r9
+  805712:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80571b:	48 85 db             	test   %rbx,%rbx
+  80571e:	74 03                	je     805723 <ipc_call+0x32>
+  805720:	48 8b 03             	mov    (%rbx),%rax
+  805723:	89 f6                	mov    %esi,%esi
+  805725:	48 83 ec 08          	sub    $0x8,%rsp
+  805729:	50                   	push   %rax
+  80572a:	48 b8 67 2d 80 00 00 	movabs $0x802d67,%rax
+  805731:	00 00 00 
+  805734:	ff d0                	call   *%rax
+  805736:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805738:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80573c:	48 89 da             	mov    %rbx,%rdx
+  80573f:	be 00 00 00 00       	mov    $0x0,%esi
+  805744:	48 b8 c1 55 80 00 00 	movabs $0x8055c1,%rax
+  80574b:	00 00 00 
+  80574e:	ff d0                	call   *%rax
+}
+  805750:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805754:	c9                   	leave
+  805755:	c3                   	ret
+
+0000000000805756 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805756:	55                   	push   %rbp
+  805757:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  80575a:	89 f6                	mov    %esi,%esi
+  80575c:	48 b8 d3 2d 80 00 00 	movabs $0x802dd3,%rax
+  805763:	00 00 00 
+  805766:	ff d0                	call   *%rax
+  805768:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  80576a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80576f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805774:	be 00 00 00 00       	mov    $0x0,%esi
+  805779:	48 b8 c1 55 80 00 00 	movabs $0x8055c1,%rax
+  805780:	00 00 00 
+  805783:	ff d0                	call   *%rax
+}
+  805785:	5d                   	pop    %rbp
+  805786:	c3                   	ret
+
+0000000000805787 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805787:	55                   	push   %rbp
+  805788:	48 89 e5             	mov    %rsp,%rbp
+  80578b:	41 54                	push   %r12
+  80578d:	53                   	push   %rbx
+  80578e:	4c 89 cb             	mov    %r9,%rbx
+  805791:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805795:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805799:	48 85 d2             	test   %rdx,%rdx
+  80579c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057a3:	00 00 00 
+  8057a6:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8057aa:	4d 85 c9             	test   %r9,%r9
+  8057ad:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8057b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057b6:	4d 85 e4             	test   %r12,%r12
+  8057b9:	74 04                	je     8057bf <ipc_reply_wait+0x38>
+  8057bb:	49 8b 04 24          	mov    (%r12),%rax
+  8057bf:	89 f6                	mov    %esi,%esi
+  8057c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8057c5:	50                   	push   %rax
+  8057c6:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  8057cd:	00 00 00 
+  8057d0:	ff d0                	call   *%rax
+  8057d2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8057d4:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8057d8:	4c 89 e2             	mov    %r12,%rdx
+  8057db:	48 89 de             	mov    %rbx,%rsi
+  8057de:	48 b8 c1 55 80 00 00 	movabs $0x8055c1,%rax
+  8057e5:	00 00 00 
+  8057e8:	ff d0                	call   *%rax
+}
+  8057ea:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8057ee:	5b                   	pop    %rbx
+  8057ef:	41 5c                	pop    %r12
+  8057f1:	5d                   	pop    %rbp
+  8057f2:	c3                   	ret
+
+00000000008057f3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8057f3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8057f8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8057ff:	00 00 00 
+  805802:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805809:	48 01 ca             	add    %rcx,%rdx
+  80580c:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805812:	39 fa                	cmp    %edi,%edx
+  805814:	74 12                	je     805828 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805816:	48 83 c0 01          	add    $0x1,%rax
+  80581a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805820:	75 e0                	jne    805802 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805822:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805827:	c3                   	ret
+            return envs[i].env_id;
+  805828:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80582f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805836:	00 00 00 
+  805839:	48 01 d0             	add    %rdx,%rax
+  80583c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805842:	c3                   	ret
+  805843:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805848 <__rodata_start>:
+  805848:	77 00                	ja     80584a <__rodata_start+0x2>
+  80584a:	72 62                	jb     8058ae <__rodata_start+0x66>
+  80584c:	00 77 62             	add    %dh,0x62(%rdi)
+  80584f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805852:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805859:	00 
+  80585a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  805860:	b3 09                	mov    $0x9,%bl
+  805862:	80 00 00             	addb   $0x0,(%rax)
+  805865:	00 00                	add    %al,(%rax)
+  805867:	00 ed                	add    %ch,%ch
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80588d:	00 00                	add    %al,(%rax)
+  80588f:	00 ed                	add    %ch,%ch
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	8c 0a                	mov    %cs,(%rdx)
+  8058ba:	80 00 00             	addb   $0x0,(%rax)
+  8058bd:	00 00                	add    %al,(%rax)
+  8058bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	8c 0a                	mov    %cs,(%rdx)
+  8058ca:	80 00 00             	addb   $0x0,(%rax)
+  8058cd:	00 00                	add    %al,(%rax)
+  8058cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	8c 0a                	mov    %cs,(%rdx)
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	8c 0a                	mov    %cs,(%rdx)
+  8058ea:	80 00 00             	addb   $0x0,(%rax)
+  8058ed:	00 00                	add    %al,(%rax)
+  8058ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	8c 0a                	mov    %cs,(%rdx)
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	ed                   	in     (%dx),%eax
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ed                   	in     (%dx),%eax
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	ed                   	in     (%dx),%eax
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	ed                   	in     (%dx),%eax
+  8059d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059de:	00 00                	add    %al,(%rax)
+  8059e0:	ed                   	in     (%dx),%eax
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	ed                   	in     (%dx),%eax
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	f4                   	hlt
+  8059f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8059ff:	00 ed                	add    %ch,%ch
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	2c 0b                	sub    $0xb,%al
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 ed                	add    %ch,%ch
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805a53:	00 00                	add    %al,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 cb                	add    %cl,%bl
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	6a 0a                	push   $0xa
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 ed                	add    %ch,%ch
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	3c 0a                	cmp    $0xa,%al
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 ed                	add    %ch,%ch
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805aab:	00 00                	add    %al,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 29                	add    %ch,(%rcx)
+  805ab9:	0c 80                	or     $0x80,%al
+  805abb:	00 00                	add    %al,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 ed                	add    %ch,%ch
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	1a 0b                	sbb    (%rbx),%cl
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 ed                	add    %ch,%ch
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ce                   	(bad)
+  805ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ae7:	00 ed                	add    %ch,%ch
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	f4                   	hlt
+  805af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805aff:	00 37                	add    %dh,(%rdi)
+  805b01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 37                	add    %dh,(%rdi)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805b2b:	00 00                	add    %al,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 d2                	add    %dl,%dl
+  805b31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b37:	00 d2                	add    %dl,%dl
+  805b39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b3f:	00 d2                	add    %dl,%dl
+  805b41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b47:	00 d2                	add    %dl,%dl
+  805b49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b4f:	00 d2                	add    %dl,%dl
+  805b51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b57:	00 d2                	add    %dl,%dl
+  805b59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b5f:	00 d2                	add    %dl,%dl
+  805b61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b67:	00 f6                	add    %dh,%dh
+  805b69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b6f:	00 f6                	add    %dh,%dh
+  805b71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 22                	add    %ah,(%rdx)
+  805bb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bb7:	00 22                	add    %ah,(%rdx)
+  805bb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bbf:	00 22                	add    %ah,(%rdx)
+  805bc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bc7:	00 22                	add    %ah,(%rdx)
+  805bc9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bcf:	00 22                	add    %ah,(%rdx)
+  805bd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bd7:	00 22                	add    %ah,(%rdx)
+  805bd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 46 12             	add    %al,0x12(%rsi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 22                	add    %ah,(%rdx)
+  805cb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cb7:	00 22                	add    %ah,(%rdx)
+  805cb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cbf:	00 22                	add    %ah,(%rdx)
+  805cc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cc7:	00 22                	add    %ah,(%rdx)
+  805cc9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ccf:	00 22                	add    %ah,(%rdx)
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 22                	add    %ah,(%rdx)
+  805cd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 46 12             	add    %al,0x12(%rsi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805d80 <basefix.0>:
+  805d80:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805d90:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805da0:	10 00 77 72 69 74 65 20 65 72 72 6f 72 20 63 6f     ..write error co
+  805db0:	70 79 69 6e 67 20 25 73 3a 20 25 69 00 75 73 65     pying %s: %i.use
+  805dc0:	72 2f 63 61 74 2e 63 00 65 72 72 6f 72 20 72 65     r/cat.c.error re
+  805dd0:	61 64 69 6e 67 20 25 73 3a 20 25 69 00 63 61 74     ading %s: %i.cat
+  805de0:	00 3c 73 74 64 69 6e 3e 00 63 61 6e 27 74 20 6f     .<stdin>.can't o
+  805df0:	70 65 6e 20 25 73 3a 20 25 69 0a 00 3c 75 6e 6b     pen %s: %i..<unk
+  805e00:	6e 6f 77 6e 3e 00 66 90 5b 25 30 38 78 5d 20 75     nown>.f.[%08x] u
+  805e10:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  805e20:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  805e30:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  805e40:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  805e50:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  805e60:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  805e70:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  805e80:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  805e90:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  805ea0:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  805eb0:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  805ec0:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  805ed0:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  805ee0:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  805ef0:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  805f00:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  805f10:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  805f20:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  805f30:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  805f40:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  805f50:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  805f60:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  805f70:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  805f80:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  805f90:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  805fa0:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  805fb0:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  805fc0:	b9 1a 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .........!......
+  805fd0:	00 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  805fe0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  805ff0:	10 21 80 00 00 00 00 00 d8 1a 80 00 00 00 00 00     .!..............
+  806000:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806010:	cc 1a 80 00 00 00 00 00 46 1b 80 00 00 00 00 00     ........F.......
+  806020:	10 21 80 00 00 00 00 00 cc 1a 80 00 00 00 00 00     .!..............
+  806030:	12 1b 80 00 00 00 00 00 12 1b 80 00 00 00 00 00     ................
+  806040:	12 1b 80 00 00 00 00 00 12 1b 80 00 00 00 00 00     ................
+  806050:	12 1b 80 00 00 00 00 00 12 1b 80 00 00 00 00 00     ................
+  806060:	12 1b 80 00 00 00 00 00 12 1b 80 00 00 00 00 00     ................
+  806070:	12 1b 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .........!......
+  806080:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806090:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8060a0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8060b0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8060c0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8060d0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8060e0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8060f0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806100:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806110:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806120:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806130:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806140:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806150:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806160:	10 21 80 00 00 00 00 00 2e 20 80 00 00 00 00 00     .!....... ......
+  806170:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806180:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806190:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8061a0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8061b0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8061c0:	74 1b 80 00 00 00 00 00 43 1d 80 00 00 00 00 00     t.......C.......
+  8061d0:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  8061e0:	10 21 80 00 00 00 00 00 69 1b 80 00 00 00 00 00     .!......i.......
+  8061f0:	a3 1b 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .........!......
+  806200:	10 21 80 00 00 00 00 00 5e 1b 80 00 00 00 00 00     .!......^.......
+  806210:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806220:	ec 1e 80 00 00 00 00 00 bb 1f 80 00 00 00 00 00     ................
+  806230:	10 21 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .!.......!......
+  806240:	3a 1c 80 00 00 00 00 00 10 21 80 00 00 00 00 00     :........!......
+  806250:	17 1e 80 00 00 00 00 00 10 21 80 00 00 00 00 00     .........!......
+  806260:	10 21 80 00 00 00 00 00 2e 20 80 00 00 00 00 00     .!....... ......
+  806270:	10 21 80 00 00 00 00 00 c2 1a 80 00 00 00 00 00     .!..............
+
+0000000000806280 <error_string>:
+	...
+  806288:	5d 5e 80 00 00 00 00 00 6f 5e 80 00 00 00 00 00     ]^......o^......
+  806298:	7f 5e 80 00 00 00 00 00 91 5e 80 00 00 00 00 00     .^.......^......
+  8062a8:	9f 5e 80 00 00 00 00 00 b3 5e 80 00 00 00 00 00     .^.......^......
+  8062b8:	c8 5e 80 00 00 00 00 00 db 5e 80 00 00 00 00 00     .^.......^......
+  8062c8:	ed 5e 80 00 00 00 00 00 01 5f 80 00 00 00 00 00     .^......._......
+  8062d8:	11 5f 80 00 00 00 00 00 24 5f 80 00 00 00 00 00     ._......$_......
+  8062e8:	3b 5f 80 00 00 00 00 00 51 5f 80 00 00 00 00 00     ;_......Q_......
+  8062f8:	69 5f 80 00 00 00 00 00 81 5f 80 00 00 00 00 00     i_......._......
+  806308:	8e 5f 80 00 00 00 00 00 20 63 80 00 00 00 00 00     ._...... c......
+  806318:	a2 5f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ._......file is 
+  806328:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806338:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806348:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806358:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806368:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806378:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806388:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806398:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8063a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8063b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8063c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8063d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8063e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8063f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806400 <devtab>:
+  806400:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806410:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806420:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806430:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806440:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806450:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806460:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806470:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806480:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806490:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8064a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8064b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8064c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8064d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8064e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8064f0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806500:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806510:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806520:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806530:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806540:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806550:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806560:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806570:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
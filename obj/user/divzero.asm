@@ -0,0 +1,10325 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 8e 22 80 00 00 	movabs $0x80228e,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 0f 21 80 00 00 	movabs $0x80210f,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 4f 32 80 00 00 	movabs $0x80324f,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 4f 32 80 00 00 	movabs $0x80324f,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 25 3c 80 00 00 	movabs $0x803c25,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 1e 1f 80 00 00 	movabs $0x801f1e,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 25 3c 80 00 00 	movabs $0x803c25,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 1e 1f 80 00 00 	movabs $0x801f1e,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 e5 15 80 00 00 	movabs $0x8015e5,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be c1 5c 80 00 00 	movabs $0x805cc1,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be e2 56 80 00 00 	movabs $0x8056e2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be e5 56 80 00 00 	movabs $0x8056e5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 23 4a 80 00 00 	movabs $0x804a23,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 fa 4c 80 00 00 	movabs $0x804cfa,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 a2 2f 80 00 00 	movabs $0x802fa2,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 02 34 80 00 00 	movabs $0x803402,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 08 33 80 00 00 	movabs $0x803308,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 08 33 80 00 00 	movabs $0x803308,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 4f 32 80 00 00 	movabs $0x80324f,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 a2 2f 80 00 00 	movabs $0x802fa2,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 5b 22 80 00 00 	movabs $0x80225b,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 8e 22 80 00 00 	movabs $0x80228e,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 5b 22 80 00 00 	movabs $0x80225b,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be a0 59 80 00 00 	movabs $0x8059a0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 5b 22 80 00 00 	movabs $0x80225b,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 5b 22 80 00 00 	movabs $0x80225b,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 20 5c 80 00 00 	movabs $0x805c20,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 20 5c 80 00 00 	movabs $0x805c20,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 3d 00 00 00       	call   80153c <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("1337/0 is %08x!\n", 1337 / zero);
+  801505:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  80150c:	00 00 00 
+  80150f:	8b 08                	mov    (%rax),%ecx
+  801511:	b8 39 05 00 00       	mov    $0x539,%eax
+  801516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151b:	f7 f9                	idiv   %ecx
+  80151d:	89 c6                	mov    %eax,%esi
+  80151f:	48 bf 42 5c 80 00 00 	movabs $0x805c42,%rdi
+  801526:	00 00 00 
+  801529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152e:	48 ba b5 16 80 00 00 	movabs $0x8016b5,%rdx
+  801535:	00 00 00 
+  801538:	ff d2                	call   *%rdx
+}
+  80153a:	5d                   	pop    %rbp
+  80153b:	c3                   	ret
+
+000000000080153c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80153c:	55                   	push   %rbp
+  80153d:	48 89 e5             	mov    %rsp,%rbp
+  801540:	41 56                	push   %r14
+  801542:	41 55                	push   %r13
+  801544:	41 54                	push   %r12
+  801546:	53                   	push   %rbx
+  801547:	41 89 fd             	mov    %edi,%r13d
+  80154a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80154d:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801554:	00 00 00 
+  801557:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80155e:	00 00 00 
+  801561:	48 39 c2             	cmp    %rax,%rdx
+  801564:	73 17                	jae    80157d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801566:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801569:	49 89 c4             	mov    %rax,%r12
+  80156c:	48 83 c3 08          	add    $0x8,%rbx
+  801570:	b8 00 00 00 00       	mov    $0x0,%eax
+  801575:	ff 53 f8             	call   *-0x8(%rbx)
+  801578:	4c 39 e3             	cmp    %r12,%rbx
+  80157b:	72 ef                	jb     80156c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80157d:	48 b8 79 26 80 00 00 	movabs $0x802679,%rax
+  801584:	00 00 00 
+  801587:	ff d0                	call   *%rax
+  801589:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80158e:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801595:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80159c:	00 00 00 
+  80159f:	48 01 d0             	add    %rdx,%rax
+  8015a2:	48 a3 28 80 80 01 00 	movabs %rax,0x1808028
+  8015a9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8015ac:	45 85 ed             	test   %r13d,%r13d
+  8015af:	7e 0d                	jle    8015be <libmain+0x82>
+  8015b1:	49 8b 06             	mov    (%r14),%rax
+  8015b4:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015bb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015be:	4c 89 f6             	mov    %r14,%rsi
+  8015c1:	44 89 ef             	mov    %r13d,%edi
+  8015c4:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015cb:	00 00 00 
+  8015ce:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015d0:	48 b8 e5 15 80 00 00 	movabs $0x8015e5,%rax
+  8015d7:	00 00 00 
+  8015da:	ff d0                	call   *%rax
+#endif
+}
+  8015dc:	5b                   	pop    %rbx
+  8015dd:	41 5c                	pop    %r12
+  8015df:	41 5d                	pop    %r13
+  8015e1:	41 5e                	pop    %r14
+  8015e3:	5d                   	pop    %rbp
+  8015e4:	c3                   	ret
+
+00000000008015e5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015e5:	55                   	push   %rbp
+  8015e6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015e9:	48 b8 d5 2f 80 00 00 	movabs $0x802fd5,%rax
+  8015f0:	00 00 00 
+  8015f3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015fa:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  801601:	00 00 00 
+  801604:	ff d0                	call   *%rax
+}
+  801606:	5d                   	pop    %rbp
+  801607:	c3                   	ret
+
+0000000000801608 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801608:	55                   	push   %rbp
+  801609:	48 89 e5             	mov    %rsp,%rbp
+  80160c:	53                   	push   %rbx
+  80160d:	48 83 ec 08          	sub    $0x8,%rsp
+  801611:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801614:	8b 06                	mov    (%rsi),%eax
+  801616:	8d 50 01             	lea    0x1(%rax),%edx
+  801619:	89 16                	mov    %edx,(%rsi)
+  80161b:	48 98                	cltq
+  80161d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801622:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801628:	74 0a                	je     801634 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80162a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80162e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801632:	c9                   	leave
+  801633:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801634:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801638:	be ff 00 00 00       	mov    $0xff,%esi
+  80163d:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  801644:	00 00 00 
+  801647:	ff d0                	call   *%rax
+        state->offset = 0;
+  801649:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80164f:	eb d9                	jmp    80162a <putch+0x22>
+
+0000000000801651 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801651:	55                   	push   %rbp
+  801652:	48 89 e5             	mov    %rsp,%rbp
+  801655:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80165c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80165f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801666:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80166b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801670:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801673:	48 89 f1             	mov    %rsi,%rcx
+  801676:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80167d:	48 bf 08 16 80 00 00 	movabs $0x801608,%rdi
+  801684:	00 00 00 
+  801687:	48 b8 05 18 80 00 00 	movabs $0x801805,%rax
+  80168e:	00 00 00 
+  801691:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801693:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80169a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8016a1:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8016a8:	00 00 00 
+  8016ab:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8016ad:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016b3:	c9                   	leave
+  8016b4:	c3                   	ret
+
+00000000008016b5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016b5:	55                   	push   %rbp
+  8016b6:	48 89 e5             	mov    %rsp,%rbp
+  8016b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8016bd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016c1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016c9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016cd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016d1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016e0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016e8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016ec:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  8016f3:	00 00 00 
+  8016f6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016f8:	c9                   	leave
+  8016f9:	c3                   	ret
+
+00000000008016fa <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016fa:	55                   	push   %rbp
+  8016fb:	48 89 e5             	mov    %rsp,%rbp
+  8016fe:	41 57                	push   %r15
+  801700:	41 56                	push   %r14
+  801702:	41 55                	push   %r13
+  801704:	41 54                	push   %r12
+  801706:	53                   	push   %rbx
+  801707:	48 83 ec 18          	sub    $0x18,%rsp
+  80170b:	49 89 fc             	mov    %rdi,%r12
+  80170e:	49 89 f5             	mov    %rsi,%r13
+  801711:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801715:	8b 45 10             	mov    0x10(%rbp),%eax
+  801718:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80171b:	41 89 cf             	mov    %ecx,%r15d
+  80171e:	4c 39 fa             	cmp    %r15,%rdx
+  801721:	73 5b                	jae    80177e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801723:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801727:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80172b:	85 db                	test   %ebx,%ebx
+  80172d:	7e 0e                	jle    80173d <print_num+0x43>
+            putch(padc, put_arg);
+  80172f:	4c 89 ee             	mov    %r13,%rsi
+  801732:	44 89 f7             	mov    %r14d,%edi
+  801735:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801738:	83 eb 01             	sub    $0x1,%ebx
+  80173b:	75 f2                	jne    80172f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80173d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801741:	48 b9 6e 5c 80 00 00 	movabs $0x805c6e,%rcx
+  801748:	00 00 00 
+  80174b:	48 b8 5d 5c 80 00 00 	movabs $0x805c5d,%rax
+  801752:	00 00 00 
+  801755:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801759:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801762:	49 f7 f7             	div    %r15
+  801765:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801769:	4c 89 ee             	mov    %r13,%rsi
+  80176c:	41 ff d4             	call   *%r12
+}
+  80176f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801773:	5b                   	pop    %rbx
+  801774:	41 5c                	pop    %r12
+  801776:	41 5d                	pop    %r13
+  801778:	41 5e                	pop    %r14
+  80177a:	41 5f                	pop    %r15
+  80177c:	5d                   	pop    %rbp
+  80177d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80177e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801782:	ba 00 00 00 00       	mov    $0x0,%edx
+  801787:	49 f7 f7             	div    %r15
+  80178a:	48 83 ec 08          	sub    $0x8,%rsp
+  80178e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801792:	52                   	push   %rdx
+  801793:	45 0f be c9          	movsbl %r9b,%r9d
+  801797:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80179b:	48 89 c2             	mov    %rax,%rdx
+  80179e:	48 b8 fa 16 80 00 00 	movabs $0x8016fa,%rax
+  8017a5:	00 00 00 
+  8017a8:	ff d0                	call   *%rax
+  8017aa:	48 83 c4 10          	add    $0x10,%rsp
+  8017ae:	eb 8d                	jmp    80173d <print_num+0x43>
+
+00000000008017b0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017b0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017b4:	48 8b 06             	mov    (%rsi),%rax
+  8017b7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017bb:	73 0a                	jae    8017c7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017bd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017c1:	48 89 16             	mov    %rdx,(%rsi)
+  8017c4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017c7:	c3                   	ret
+
+00000000008017c8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017c8:	55                   	push   %rbp
+  8017c9:	48 89 e5             	mov    %rsp,%rbp
+  8017cc:	48 83 ec 50          	sub    $0x50,%rsp
+  8017d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017d4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017d8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017dc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017eb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017f3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017f7:	48 b8 05 18 80 00 00 	movabs $0x801805,%rax
+  8017fe:	00 00 00 
+  801801:	ff d0                	call   *%rax
+}
+  801803:	c9                   	leave
+  801804:	c3                   	ret
+
+0000000000801805 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801805:	55                   	push   %rbp
+  801806:	48 89 e5             	mov    %rsp,%rbp
+  801809:	41 57                	push   %r15
+  80180b:	41 56                	push   %r14
+  80180d:	41 55                	push   %r13
+  80180f:	41 54                	push   %r12
+  801811:	53                   	push   %rbx
+  801812:	48 83 ec 38          	sub    $0x38,%rsp
+  801816:	49 89 fe             	mov    %rdi,%r14
+  801819:	49 89 f5             	mov    %rsi,%r13
+  80181c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80181f:	48 8b 01             	mov    (%rcx),%rax
+  801822:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801826:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80182a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80182e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801832:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801836:	eb 0d                	jmp    801845 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801838:	40 0f b6 ff          	movzbl %dil,%edi
+  80183c:	4c 89 ee             	mov    %r13,%rsi
+  80183f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801842:	4c 89 e3             	mov    %r12,%rbx
+  801845:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801849:	0f b6 3b             	movzbl (%rbx),%edi
+  80184c:	40 80 ff 25          	cmp    $0x25,%dil
+  801850:	74 14                	je     801866 <vprintfmt+0x61>
+            if (!ch) return;
+  801852:	40 84 ff             	test   %dil,%dil
+  801855:	75 e1                	jne    801838 <vprintfmt+0x33>
+}
+  801857:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80185b:	5b                   	pop    %rbx
+  80185c:	41 5c                	pop    %r12
+  80185e:	41 5d                	pop    %r13
+  801860:	41 5e                	pop    %r14
+  801862:	41 5f                	pop    %r15
+  801864:	5d                   	pop    %rbp
+  801865:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801866:	be 00 00 00 00       	mov    $0x0,%esi
+  80186b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80186f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801874:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80187a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801881:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801885:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80188a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80188f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801892:	83 e8 23             	sub    $0x23,%eax
+  801895:	3c 57                	cmp    $0x57,%al
+  801897:	0f 87 67 06 00 00    	ja     801f04 <vprintfmt+0x6ff>
+  80189d:	0f b6 c0             	movzbl %al,%eax
+  8018a0:	48 b9 00 5e 80 00 00 	movabs $0x805e00,%rcx
+  8018a7:	00 00 00 
+  8018aa:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8018ad:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018b0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018b4:	eb cf                	jmp    801885 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018b6:	49 89 dc             	mov    %rbx,%r12
+  8018b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8018be:	eb c5                	jmp    801885 <vprintfmt+0x80>
+            padc = ch;
+  8018c0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018c4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018c7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018ca:	eb b9                	jmp    801885 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8018d2:	77 24                	ja     8018f8 <vprintfmt+0xf3>
+  8018d4:	89 c1                	mov    %eax,%ecx
+  8018d6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018da:	83 c0 08             	add    $0x8,%eax
+  8018dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018e0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018e3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018e6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018ea:	79 99                	jns    801885 <vprintfmt+0x80>
+                width = precision;
+  8018ec:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018f0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018f6:	eb 8d                	jmp    801885 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018f8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018fc:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801900:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801904:	eb da                	jmp    8018e0 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801906:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80190b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80190f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801915:	3c 39                	cmp    $0x39,%al
+  801917:	77 1c                	ja     801935 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801919:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80191d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801921:	0f b6 c0             	movzbl %al,%eax
+  801924:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801929:	0f b6 03             	movzbl (%rbx),%eax
+  80192c:	3c 39                	cmp    $0x39,%al
+  80192e:	76 e9                	jbe    801919 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801930:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801933:	eb b1                	jmp    8018e6 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801935:	49 89 dc             	mov    %rbx,%r12
+  801938:	eb ac                	jmp    8018e6 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80193a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80193d:	85 c9                	test   %ecx,%ecx
+  80193f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801944:	0f 49 c1             	cmovns %ecx,%eax
+  801947:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80194a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80194d:	e9 33 ff ff ff       	jmp    801885 <vprintfmt+0x80>
+            lflag++;
+  801952:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801955:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801958:	e9 28 ff ff ff       	jmp    801885 <vprintfmt+0x80>
+            lflag--;
+  80195d:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801960:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801963:	e9 1d ff ff ff       	jmp    801885 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801968:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80196b:	83 f8 2f             	cmp    $0x2f,%eax
+  80196e:	77 19                	ja     801989 <vprintfmt+0x184>
+  801970:	89 c2                	mov    %eax,%edx
+  801972:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801976:	83 c0 08             	add    $0x8,%eax
+  801979:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80197c:	8b 3a                	mov    (%rdx),%edi
+  80197e:	4c 89 ee             	mov    %r13,%rsi
+  801981:	41 ff d6             	call   *%r14
+            break;
+  801984:	e9 bc fe ff ff       	jmp    801845 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801989:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80198d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801991:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801995:	eb e5                	jmp    80197c <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801997:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80199a:	83 f8 2f             	cmp    $0x2f,%eax
+  80199d:	77 5a                	ja     8019f9 <vprintfmt+0x1f4>
+  80199f:	89 c2                	mov    %eax,%edx
+  8019a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019a5:	83 c0 08             	add    $0x8,%eax
+  8019a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8019ab:	8b 02                	mov    (%rdx),%eax
+  8019ad:	89 c1                	mov    %eax,%ecx
+  8019af:	f7 d9                	neg    %ecx
+  8019b1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019b4:	83 f9 13             	cmp    $0x13,%ecx
+  8019b7:	7f 4e                	jg     801a07 <vprintfmt+0x202>
+  8019b9:	48 63 c1             	movslq %ecx,%rax
+  8019bc:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8019c3:	00 00 00 
+  8019c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019ca:	48 85 c0             	test   %rax,%rax
+  8019cd:	74 38                	je     801a07 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019cf:	48 89 c1             	mov    %rax,%rcx
+  8019d2:	48 ba 88 62 80 00 00 	movabs $0x806288,%rdx
+  8019d9:	00 00 00 
+  8019dc:	4c 89 ee             	mov    %r13,%rsi
+  8019df:	4c 89 f7             	mov    %r14,%rdi
+  8019e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e7:	49 b8 c8 17 80 00 00 	movabs $0x8017c8,%r8
+  8019ee:	00 00 00 
+  8019f1:	41 ff d0             	call   *%r8
+  8019f4:	e9 4c fe ff ff       	jmp    801845 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a05:	eb a4                	jmp    8019ab <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801a07:	48 ba 86 5c 80 00 00 	movabs $0x805c86,%rdx
+  801a0e:	00 00 00 
+  801a11:	4c 89 ee             	mov    %r13,%rsi
+  801a14:	4c 89 f7             	mov    %r14,%rdi
+  801a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1c:	49 b8 c8 17 80 00 00 	movabs $0x8017c8,%r8
+  801a23:	00 00 00 
+  801a26:	41 ff d0             	call   *%r8
+  801a29:	e9 17 fe ff ff       	jmp    801845 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a31:	83 f8 2f             	cmp    $0x2f,%eax
+  801a34:	77 6c                	ja     801aa2 <vprintfmt+0x29d>
+  801a36:	89 c2                	mov    %eax,%edx
+  801a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a3c:	83 c0 08             	add    $0x8,%eax
+  801a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a42:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a45:	48 85 f6             	test   %rsi,%rsi
+  801a48:	48 b8 7f 5c 80 00 00 	movabs $0x805c7f,%rax
+  801a4f:	00 00 00 
+  801a52:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a56:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a5a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a5e:	7e 06                	jle    801a66 <vprintfmt+0x261>
+  801a60:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a64:	75 4a                	jne    801ab0 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a66:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a6a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a6e:	0f b6 00             	movzbl (%rax),%eax
+  801a71:	84 c0                	test   %al,%al
+  801a73:	0f 85 9a 00 00 00    	jne    801b13 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a79:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a7c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	0f 8e bd fd ff ff    	jle    801845 <vprintfmt+0x40>
+  801a88:	4c 89 ee             	mov    %r13,%rsi
+  801a8b:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a90:	41 ff d6             	call   *%r14
+  801a93:	41 83 ec 01          	sub    $0x1,%r12d
+  801a97:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a9b:	75 eb                	jne    801a88 <vprintfmt+0x283>
+  801a9d:	e9 a3 fd ff ff       	jmp    801845 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801aa2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801aa6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801aaa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aae:	eb 92                	jmp    801a42 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ab0:	49 63 f7             	movslq %r15d,%rsi
+  801ab3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801ab7:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  801abe:	00 00 00 
+  801ac1:	ff d0                	call   *%rax
+  801ac3:	48 89 c2             	mov    %rax,%rdx
+  801ac6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ac9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801acb:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ace:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ad1:	85 c0                	test   %eax,%eax
+  801ad3:	7e 91                	jle    801a66 <vprintfmt+0x261>
+  801ad5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ada:	4c 89 ee             	mov    %r13,%rsi
+  801add:	44 89 e7             	mov    %r12d,%edi
+  801ae0:	41 ff d6             	call   *%r14
+  801ae3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ae7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801aea:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801aed:	75 eb                	jne    801ada <vprintfmt+0x2d5>
+  801aef:	e9 72 ff ff ff       	jmp    801a66 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801af4:	0f b6 f8             	movzbl %al,%edi
+  801af7:	4c 89 ee             	mov    %r13,%rsi
+  801afa:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801afd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b01:	49 83 c4 01          	add    $0x1,%r12
+  801b05:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801b0b:	84 c0                	test   %al,%al
+  801b0d:	0f 84 66 ff ff ff    	je     801a79 <vprintfmt+0x274>
+  801b13:	45 85 ff             	test   %r15d,%r15d
+  801b16:	78 0a                	js     801b22 <vprintfmt+0x31d>
+  801b18:	41 83 ef 01          	sub    $0x1,%r15d
+  801b1c:	0f 88 57 ff ff ff    	js     801a79 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b22:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b26:	74 cc                	je     801af4 <vprintfmt+0x2ef>
+  801b28:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b2b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b30:	80 fa 5e             	cmp    $0x5e,%dl
+  801b33:	77 c2                	ja     801af7 <vprintfmt+0x2f2>
+  801b35:	eb bd                	jmp    801af4 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b37:	40 84 f6             	test   %sil,%sil
+  801b3a:	75 26                	jne    801b62 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b3c:	85 d2                	test   %edx,%edx
+  801b3e:	74 59                	je     801b99 <vprintfmt+0x394>
+  801b40:	83 fa 01             	cmp    $0x1,%edx
+  801b43:	74 7b                	je     801bc0 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b48:	83 f8 2f             	cmp    $0x2f,%eax
+  801b4b:	0f 87 96 00 00 00    	ja     801be7 <vprintfmt+0x3e2>
+  801b51:	89 c2                	mov    %eax,%edx
+  801b53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b57:	83 c0 08             	add    $0x8,%eax
+  801b5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b5d:	4c 8b 22             	mov    (%rdx),%r12
+  801b60:	eb 17                	jmp    801b79 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b65:	83 f8 2f             	cmp    $0x2f,%eax
+  801b68:	77 21                	ja     801b8b <vprintfmt+0x386>
+  801b6a:	89 c2                	mov    %eax,%edx
+  801b6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b70:	83 c0 08             	add    $0x8,%eax
+  801b73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b76:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b79:	4d 85 e4             	test   %r12,%r12
+  801b7c:	78 7a                	js     801bf8 <vprintfmt+0x3f3>
+            num = i;
+  801b7e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b81:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b86:	e9 56 02 00 00       	jmp    801de1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b97:	eb dd                	jmp    801b76 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b9c:	83 f8 2f             	cmp    $0x2f,%eax
+  801b9f:	77 11                	ja     801bb2 <vprintfmt+0x3ad>
+  801ba1:	89 c2                	mov    %eax,%edx
+  801ba3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ba7:	83 c0 08             	add    $0x8,%eax
+  801baa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bad:	4c 63 22             	movslq (%rdx),%r12
+  801bb0:	eb c7                	jmp    801b79 <vprintfmt+0x374>
+  801bb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbe:	eb ed                	jmp    801bad <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bc0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bc3:	83 f8 2f             	cmp    $0x2f,%eax
+  801bc6:	77 11                	ja     801bd9 <vprintfmt+0x3d4>
+  801bc8:	89 c2                	mov    %eax,%edx
+  801bca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bce:	83 c0 08             	add    $0x8,%eax
+  801bd1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bd4:	4c 8b 22             	mov    (%rdx),%r12
+  801bd7:	eb a0                	jmp    801b79 <vprintfmt+0x374>
+  801bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be5:	eb ed                	jmp    801bd4 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801be7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801beb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf3:	e9 65 ff ff ff       	jmp    801b5d <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bf8:	4c 89 ee             	mov    %r13,%rsi
+  801bfb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801c00:	41 ff d6             	call   *%r14
+                i = -i;
+  801c03:	49 f7 dc             	neg    %r12
+  801c06:	e9 73 ff ff ff       	jmp    801b7e <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801c0b:	40 84 f6             	test   %sil,%sil
+  801c0e:	75 2e                	jne    801c3e <vprintfmt+0x439>
+    switch (lflag) {
+  801c10:	85 d2                	test   %edx,%edx
+  801c12:	7f 59                	jg     801c6d <vprintfmt+0x468>
+  801c14:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c17:	7d 7a                	jge    801c93 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c1c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c1f:	0f 87 aa 00 00 00    	ja     801ccf <vprintfmt+0x4ca>
+  801c25:	89 c2                	mov    %eax,%edx
+  801c27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c2b:	83 c0 08             	add    $0x8,%eax
+  801c2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c31:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c34:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c39:	e9 a3 01 00 00       	jmp    801de1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c41:	83 f8 2f             	cmp    $0x2f,%eax
+  801c44:	77 19                	ja     801c5f <vprintfmt+0x45a>
+  801c46:	89 c2                	mov    %eax,%edx
+  801c48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c4c:	83 c0 08             	add    $0x8,%eax
+  801c4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c52:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c55:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c5a:	e9 82 01 00 00       	jmp    801de1 <vprintfmt+0x5dc>
+  801c5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c6b:	eb e5                	jmp    801c52 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c6d:	83 fa 01             	cmp    $0x1,%edx
+  801c70:	75 a7                	jne    801c19 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c75:	83 f8 2f             	cmp    $0x2f,%eax
+  801c78:	77 47                	ja     801cc1 <vprintfmt+0x4bc>
+  801c7a:	89 c2                	mov    %eax,%edx
+  801c7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c80:	83 c0 08             	add    $0x8,%eax
+  801c83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c86:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c89:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c8e:	e9 4e 01 00 00       	jmp    801de1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c96:	83 f8 2f             	cmp    $0x2f,%eax
+  801c99:	77 18                	ja     801cb3 <vprintfmt+0x4ae>
+  801c9b:	89 c2                	mov    %eax,%edx
+  801c9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ca1:	83 c0 08             	add    $0x8,%eax
+  801ca4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ca7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801ca9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801cae:	e9 2e 01 00 00       	jmp    801de1 <vprintfmt+0x5dc>
+  801cb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbf:	eb e6                	jmp    801ca7 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ccd:	eb b7                	jmp    801c86 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ccf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cdb:	e9 51 ff ff ff       	jmp    801c31 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ce0:	40 84 f6             	test   %sil,%sil
+  801ce3:	75 2e                	jne    801d13 <vprintfmt+0x50e>
+    switch (lflag) {
+  801ce5:	85 d2                	test   %edx,%edx
+  801ce7:	7f 59                	jg     801d42 <vprintfmt+0x53d>
+  801ce9:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cec:	7d 77                	jge    801d65 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cf1:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf4:	0f 87 a4 00 00 00    	ja     801d9e <vprintfmt+0x599>
+  801cfa:	89 c2                	mov    %eax,%edx
+  801cfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d00:	83 c0 08             	add    $0x8,%eax
+  801d03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d06:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d09:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d0e:	e9 ce 00 00 00       	jmp    801de1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d16:	83 f8 2f             	cmp    $0x2f,%eax
+  801d19:	77 19                	ja     801d34 <vprintfmt+0x52f>
+  801d1b:	89 c2                	mov    %eax,%edx
+  801d1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d21:	83 c0 08             	add    $0x8,%eax
+  801d24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d27:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d2a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d2f:	e9 ad 00 00 00       	jmp    801de1 <vprintfmt+0x5dc>
+  801d34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d40:	eb e5                	jmp    801d27 <vprintfmt+0x522>
+    switch (lflag) {
+  801d42:	83 fa 01             	cmp    $0x1,%edx
+  801d45:	75 a7                	jne    801cee <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4d:	77 41                	ja     801d90 <vprintfmt+0x58b>
+  801d4f:	89 c2                	mov    %eax,%edx
+  801d51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d55:	83 c0 08             	add    $0x8,%eax
+  801d58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d5e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d63:	eb 7c                	jmp    801de1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d68:	83 f8 2f             	cmp    $0x2f,%eax
+  801d6b:	77 15                	ja     801d82 <vprintfmt+0x57d>
+  801d6d:	89 c2                	mov    %eax,%edx
+  801d6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d73:	83 c0 08             	add    $0x8,%eax
+  801d76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d79:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d7b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d80:	eb 5f                	jmp    801de1 <vprintfmt+0x5dc>
+  801d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8e:	eb e9                	jmp    801d79 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9c:	eb bd                	jmp    801d5b <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801da2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801da6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801daa:	e9 57 ff ff ff       	jmp    801d06 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801daf:	4c 89 ee             	mov    %r13,%rsi
+  801db2:	bf 30 00 00 00       	mov    $0x30,%edi
+  801db7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801dba:	4c 89 ee             	mov    %r13,%rsi
+  801dbd:	bf 78 00 00 00       	mov    $0x78,%edi
+  801dc2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801dc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc8:	83 f8 2f             	cmp    $0x2f,%eax
+  801dcb:	77 47                	ja     801e14 <vprintfmt+0x60f>
+  801dcd:	89 c2                	mov    %eax,%edx
+  801dcf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd3:	83 c0 08             	add    $0x8,%eax
+  801dd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dd9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ddc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801de1:	48 83 ec 08          	sub    $0x8,%rsp
+  801de5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801de9:	0f 94 c0             	sete   %al
+  801dec:	0f b6 c0             	movzbl %al,%eax
+  801def:	50                   	push   %rax
+  801df0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801df5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801df9:	4c 89 ee             	mov    %r13,%rsi
+  801dfc:	4c 89 f7             	mov    %r14,%rdi
+  801dff:	48 b8 fa 16 80 00 00 	movabs $0x8016fa,%rax
+  801e06:	00 00 00 
+  801e09:	ff d0                	call   *%rax
+            break;
+  801e0b:	48 83 c4 10          	add    $0x10,%rsp
+  801e0f:	e9 31 fa ff ff       	jmp    801845 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e20:	eb b7                	jmp    801dd9 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e22:	40 84 f6             	test   %sil,%sil
+  801e25:	75 2b                	jne    801e52 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e27:	85 d2                	test   %edx,%edx
+  801e29:	7f 56                	jg     801e81 <vprintfmt+0x67c>
+  801e2b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e2e:	7d 77                	jge    801ea7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e33:	83 f8 2f             	cmp    $0x2f,%eax
+  801e36:	0f 87 a7 00 00 00    	ja     801ee3 <vprintfmt+0x6de>
+  801e3c:	89 c2                	mov    %eax,%edx
+  801e3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e42:	83 c0 08             	add    $0x8,%eax
+  801e45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e4b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e50:	eb 8f                	jmp    801de1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e55:	83 f8 2f             	cmp    $0x2f,%eax
+  801e58:	77 19                	ja     801e73 <vprintfmt+0x66e>
+  801e5a:	89 c2                	mov    %eax,%edx
+  801e5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e60:	83 c0 08             	add    $0x8,%eax
+  801e63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e66:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e69:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e6e:	e9 6e ff ff ff       	jmp    801de1 <vprintfmt+0x5dc>
+  801e73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e7f:	eb e5                	jmp    801e66 <vprintfmt+0x661>
+    switch (lflag) {
+  801e81:	83 fa 01             	cmp    $0x1,%edx
+  801e84:	75 aa                	jne    801e30 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e89:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8c:	77 47                	ja     801ed5 <vprintfmt+0x6d0>
+  801e8e:	89 c2                	mov    %eax,%edx
+  801e90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e94:	83 c0 08             	add    $0x8,%eax
+  801e97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e9a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e9d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801ea2:	e9 3a ff ff ff       	jmp    801de1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801ea7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eaa:	83 f8 2f             	cmp    $0x2f,%eax
+  801ead:	77 18                	ja     801ec7 <vprintfmt+0x6c2>
+  801eaf:	89 c2                	mov    %eax,%edx
+  801eb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eb5:	83 c0 08             	add    $0x8,%eax
+  801eb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ebb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ebd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ec2:	e9 1a ff ff ff       	jmp    801de1 <vprintfmt+0x5dc>
+  801ec7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ecb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ecf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed3:	eb e6                	jmp    801ebb <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ed5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801edd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee1:	eb b7                	jmp    801e9a <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ee3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eeb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eef:	e9 54 ff ff ff       	jmp    801e48 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ef4:	4c 89 ee             	mov    %r13,%rsi
+  801ef7:	bf 25 00 00 00       	mov    $0x25,%edi
+  801efc:	41 ff d6             	call   *%r14
+            break;
+  801eff:	e9 41 f9 ff ff       	jmp    801845 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801f04:	4c 89 ee             	mov    %r13,%rsi
+  801f07:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f0c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f0f:	48 83 eb 01          	sub    $0x1,%rbx
+  801f13:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f17:	75 f6                	jne    801f0f <vprintfmt+0x70a>
+  801f19:	e9 27 f9 ff ff       	jmp    801845 <vprintfmt+0x40>
+
+0000000000801f1e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f1e:	55                   	push   %rbp
+  801f1f:	48 89 e5             	mov    %rsp,%rbp
+  801f22:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f2a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f2f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f33:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f3a:	48 85 ff             	test   %rdi,%rdi
+  801f3d:	74 2b                	je     801f6a <vsnprintf+0x4c>
+  801f3f:	48 85 f6             	test   %rsi,%rsi
+  801f42:	74 26                	je     801f6a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f44:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f48:	48 bf b0 17 80 00 00 	movabs $0x8017b0,%rdi
+  801f4f:	00 00 00 
+  801f52:	48 b8 05 18 80 00 00 	movabs $0x801805,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f62:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f65:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f68:	c9                   	leave
+  801f69:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6f:	eb f7                	jmp    801f68 <vsnprintf+0x4a>
+
+0000000000801f71 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f71:	55                   	push   %rbp
+  801f72:	48 89 e5             	mov    %rsp,%rbp
+  801f75:	48 83 ec 50          	sub    $0x50,%rsp
+  801f79:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f7d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f81:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f85:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f8c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f94:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f98:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f9c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801fa0:	48 b8 1e 1f 80 00 00 	movabs $0x801f1e,%rax
+  801fa7:	00 00 00 
+  801faa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801fac:	c9                   	leave
+  801fad:	c3                   	ret
+
+0000000000801fae <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801fae:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fb1:	74 10                	je     801fc3 <strlen+0x15>
+    size_t n = 0;
+  801fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fb8:	48 83 c0 01          	add    $0x1,%rax
+  801fbc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fc0:	75 f6                	jne    801fb8 <strlen+0xa>
+  801fc2:	c3                   	ret
+    size_t n = 0;
+  801fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fc8:	c3                   	ret
+
+0000000000801fc9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fc9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fcc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fd1:	48 85 f6             	test   %rsi,%rsi
+  801fd4:	74 11                	je     801fe7 <strnlen+0x1e>
+  801fd6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fda:	74 0c                	je     801fe8 <strnlen+0x1f>
+  801fdc:	48 83 c2 01          	add    $0x1,%rdx
+  801fe0:	48 39 d0             	cmp    %rdx,%rax
+  801fe3:	75 f1                	jne    801fd6 <strnlen+0xd>
+  801fe5:	eb 04                	jmp    801feb <strnlen+0x22>
+  801fe7:	c3                   	ret
+  801fe8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801feb:	c3                   	ret
+
+0000000000801fec <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fec:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801ff8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801ffb:	48 83 c2 01          	add    $0x1,%rdx
+  801fff:	84 c9                	test   %cl,%cl
+  802001:	75 f1                	jne    801ff4 <strcpy+0x8>
+        ;
+    return res;
+}
+  802003:	c3                   	ret
+
+0000000000802004 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802004:	55                   	push   %rbp
+  802005:	48 89 e5             	mov    %rsp,%rbp
+  802008:	41 54                	push   %r12
+  80200a:	53                   	push   %rbx
+  80200b:	48 89 fb             	mov    %rdi,%rbx
+  80200e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802011:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80201d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802021:	4c 89 e6             	mov    %r12,%rsi
+  802024:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  80202b:	00 00 00 
+  80202e:	ff d0                	call   *%rax
+    return dst;
+}
+  802030:	48 89 d8             	mov    %rbx,%rax
+  802033:	5b                   	pop    %rbx
+  802034:	41 5c                	pop    %r12
+  802036:	5d                   	pop    %rbp
+  802037:	c3                   	ret
+
+0000000000802038 <toupper>:
+
+int
+toupper(int ch) {
+  802038:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80203a:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80203d:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802040:	83 f9 1a             	cmp    $0x1a,%ecx
+  802043:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802046:	c3                   	ret
+
+0000000000802047 <tolower>:
+
+int
+tolower(int ch) {
+  802047:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802049:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80204c:	8d 57 20             	lea    0x20(%rdi),%edx
+  80204f:	83 f9 1a             	cmp    $0x1a,%ecx
+  802052:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802055:	c3                   	ret
+
+0000000000802056 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802056:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802059:	48 85 d2             	test   %rdx,%rdx
+  80205c:	74 1f                	je     80207d <strncpy+0x27>
+  80205e:	48 01 fa             	add    %rdi,%rdx
+  802061:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802064:	48 83 c1 01          	add    $0x1,%rcx
+  802068:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80206c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802070:	41 80 f8 01          	cmp    $0x1,%r8b
+  802074:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802078:	48 39 ca             	cmp    %rcx,%rdx
+  80207b:	75 e7                	jne    802064 <strncpy+0xe>
+    }
+    return ret;
+}
+  80207d:	c3                   	ret
+
+000000000080207e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80207e:	48 89 f8             	mov    %rdi,%rax
+  802081:	48 85 d2             	test   %rdx,%rdx
+  802084:	74 24                	je     8020aa <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802086:	48 83 ea 01          	sub    $0x1,%rdx
+  80208a:	74 1b                	je     8020a7 <strlcpy+0x29>
+  80208c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802090:	0f b6 16             	movzbl (%rsi),%edx
+  802093:	84 d2                	test   %dl,%dl
+  802095:	74 10                	je     8020a7 <strlcpy+0x29>
+            *dst++ = *src++;
+  802097:	48 83 c6 01          	add    $0x1,%rsi
+  80209b:	48 83 c0 01          	add    $0x1,%rax
+  80209f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8020a2:	48 39 c8             	cmp    %rcx,%rax
+  8020a5:	75 e9                	jne    802090 <strlcpy+0x12>
+        *dst = '\0';
+  8020a7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8020aa:	48 29 f8             	sub    %rdi,%rax
+}
+  8020ad:	c3                   	ret
+
+00000000008020ae <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8020ae:	0f b6 07             	movzbl (%rdi),%eax
+  8020b1:	84 c0                	test   %al,%al
+  8020b3:	74 13                	je     8020c8 <strcmp+0x1a>
+  8020b5:	38 06                	cmp    %al,(%rsi)
+  8020b7:	75 0f                	jne    8020c8 <strcmp+0x1a>
+  8020b9:	48 83 c7 01          	add    $0x1,%rdi
+  8020bd:	48 83 c6 01          	add    $0x1,%rsi
+  8020c1:	0f b6 07             	movzbl (%rdi),%eax
+  8020c4:	84 c0                	test   %al,%al
+  8020c6:	75 ed                	jne    8020b5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020c8:	0f b6 c0             	movzbl %al,%eax
+  8020cb:	0f b6 16             	movzbl (%rsi),%edx
+  8020ce:	29 d0                	sub    %edx,%eax
+}
+  8020d0:	c3                   	ret
+
+00000000008020d1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020d1:	48 85 d2             	test   %rdx,%rdx
+  8020d4:	74 1f                	je     8020f5 <strncmp+0x24>
+  8020d6:	0f b6 07             	movzbl (%rdi),%eax
+  8020d9:	84 c0                	test   %al,%al
+  8020db:	74 1e                	je     8020fb <strncmp+0x2a>
+  8020dd:	3a 06                	cmp    (%rsi),%al
+  8020df:	75 1a                	jne    8020fb <strncmp+0x2a>
+  8020e1:	48 83 c7 01          	add    $0x1,%rdi
+  8020e5:	48 83 c6 01          	add    $0x1,%rsi
+  8020e9:	48 83 ea 01          	sub    $0x1,%rdx
+  8020ed:	75 e7                	jne    8020d6 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f4:	c3                   	ret
+  8020f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fa:	c3                   	ret
+  8020fb:	48 85 d2             	test   %rdx,%rdx
+  8020fe:	74 09                	je     802109 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802100:	0f b6 07             	movzbl (%rdi),%eax
+  802103:	0f b6 16             	movzbl (%rsi),%edx
+  802106:	29 d0                	sub    %edx,%eax
+  802108:	c3                   	ret
+    if (!n) return 0;
+  802109:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80210e:	c3                   	ret
+
+000000000080210f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80210f:	0f b6 17             	movzbl (%rdi),%edx
+  802112:	84 d2                	test   %dl,%dl
+  802114:	74 18                	je     80212e <strchr+0x1f>
+        if (*str == c) {
+  802116:	0f be d2             	movsbl %dl,%edx
+  802119:	39 f2                	cmp    %esi,%edx
+  80211b:	74 17                	je     802134 <strchr+0x25>
+    for (; *str; str++) {
+  80211d:	48 83 c7 01          	add    $0x1,%rdi
+  802121:	0f b6 17             	movzbl (%rdi),%edx
+  802124:	84 d2                	test   %dl,%dl
+  802126:	75 ee                	jne    802116 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212d:	c3                   	ret
+  80212e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802133:	c3                   	ret
+  802134:	48 89 f8             	mov    %rdi,%rax
+}
+  802137:	c3                   	ret
+
+0000000000802138 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802138:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80213b:	0f b6 17             	movzbl (%rdi),%edx
+  80213e:	84 d2                	test   %dl,%dl
+  802140:	74 13                	je     802155 <strfind+0x1d>
+  802142:	0f be d2             	movsbl %dl,%edx
+  802145:	39 f2                	cmp    %esi,%edx
+  802147:	74 0b                	je     802154 <strfind+0x1c>
+  802149:	48 83 c0 01          	add    $0x1,%rax
+  80214d:	0f b6 10             	movzbl (%rax),%edx
+  802150:	84 d2                	test   %dl,%dl
+  802152:	75 ee                	jne    802142 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802154:	c3                   	ret
+  802155:	c3                   	ret
+
+0000000000802156 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802156:	48 39 f7             	cmp    %rsi,%rdi
+  802159:	74 65                	je     8021c0 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80215b:	55                   	push   %rbp
+  80215c:	48 89 e5             	mov    %rsp,%rbp
+  80215f:	41 57                	push   %r15
+  802161:	41 56                	push   %r14
+  802163:	41 55                	push   %r13
+  802165:	41 54                	push   %r12
+  802167:	53                   	push   %rbx
+  802168:	48 83 ec 18          	sub    $0x18,%rsp
+  80216c:	48 89 fb             	mov    %rdi,%rbx
+  80216f:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802172:	49 bf 47 20 80 00 00 	movabs $0x802047,%r15
+  802179:	00 00 00 
+  80217c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802180:	41 0f b6 fd          	movzbl %r13b,%edi
+  802184:	41 ff d7             	call   *%r15
+  802187:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80218a:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80218f:	41 0f b6 fe          	movzbl %r14b,%edi
+  802193:	41 ff d7             	call   *%r15
+  802196:	89 c2                	mov    %eax,%edx
+  802198:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80219b:	29 d0                	sub    %edx,%eax
+  80219d:	75 12                	jne    8021b1 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80219f:	48 83 c3 01          	add    $0x1,%rbx
+  8021a3:	45 84 ed             	test   %r13b,%r13b
+  8021a6:	74 09                	je     8021b1 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8021a8:	49 83 c4 01          	add    $0x1,%r12
+  8021ac:	45 84 f6             	test   %r14b,%r14b
+  8021af:	75 cb                	jne    80217c <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021b1:	48 83 c4 18          	add    $0x18,%rsp
+  8021b5:	5b                   	pop    %rbx
+  8021b6:	41 5c                	pop    %r12
+  8021b8:	41 5d                	pop    %r13
+  8021ba:	41 5e                	pop    %r14
+  8021bc:	41 5f                	pop    %r15
+  8021be:	5d                   	pop    %rbp
+  8021bf:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c5:	c3                   	ret
+
+00000000008021c6 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021c6:	48 39 f7             	cmp    %rsi,%rdi
+  8021c9:	74 7d                	je     802248 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021cb:	55                   	push   %rbp
+  8021cc:	48 89 e5             	mov    %rsp,%rbp
+  8021cf:	41 57                	push   %r15
+  8021d1:	41 56                	push   %r14
+  8021d3:	41 55                	push   %r13
+  8021d5:	41 54                	push   %r12
+  8021d7:	53                   	push   %rbx
+  8021d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8021dc:	48 89 fb             	mov    %rdi,%rbx
+  8021df:	49 89 f4             	mov    %rsi,%r12
+  8021e2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021ea:	49 bf 47 20 80 00 00 	movabs $0x802047,%r15
+  8021f1:	00 00 00 
+    while (n--) {
+  8021f4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f8:	48 39 c3             	cmp    %rax,%rbx
+  8021fb:	74 37                	je     802234 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021fd:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802201:	41 0f b6 fd          	movzbl %r13b,%edi
+  802205:	41 ff d7             	call   *%r15
+  802208:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80220b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802210:	41 0f b6 fe          	movzbl %r14b,%edi
+  802214:	41 ff d7             	call   *%r15
+  802217:	89 c2                	mov    %eax,%edx
+  802219:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80221c:	29 d0                	sub    %edx,%eax
+  80221e:	75 19                	jne    802239 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802220:	48 83 c3 01          	add    $0x1,%rbx
+  802224:	45 84 ed             	test   %r13b,%r13b
+  802227:	74 10                	je     802239 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802229:	49 83 c4 01          	add    $0x1,%r12
+  80222d:	45 84 f6             	test   %r14b,%r14b
+  802230:	75 c2                	jne    8021f4 <strncasecmp+0x2e>
+  802232:	eb 05                	jmp    802239 <strncasecmp+0x73>
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802239:	48 83 c4 18          	add    $0x18,%rsp
+  80223d:	5b                   	pop    %rbx
+  80223e:	41 5c                	pop    %r12
+  802240:	41 5d                	pop    %r13
+  802242:	41 5e                	pop    %r14
+  802244:	41 5f                	pop    %r15
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+    if (p1 == p2) return 0;
+  802248:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224d:	c3                   	ret
+
+000000000080224e <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80224e:	83 e7 df             	and    $0xffffffdf,%edi
+  802251:	83 ef 41             	sub    $0x41,%edi
+  802254:	83 ff 19             	cmp    $0x19,%edi
+  802257:	0f 96 c0             	setbe  %al
+}
+  80225a:	c3                   	ret
+
+000000000080225b <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80225b:	83 ff 20             	cmp    $0x20,%edi
+  80225e:	0f 94 c0             	sete   %al
+  802261:	83 ff 09             	cmp    $0x9,%edi
+  802264:	0f 94 c2             	sete   %dl
+  802267:	09 d0                	or     %edx,%eax
+}
+  802269:	c3                   	ret
+
+000000000080226a <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80226a:	55                   	push   %rbp
+  80226b:	48 89 e5             	mov    %rsp,%rbp
+  80226e:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802270:	48 bf 7f 61 80 00 00 	movabs $0x80617f,%rdi
+  802277:	00 00 00 
+  80227a:	48 b8 0f 21 80 00 00 	movabs $0x80210f,%rax
+  802281:	00 00 00 
+  802284:	ff d0                	call   *%rax
+  802286:	48 85 c0             	test   %rax,%rax
+  802289:	0f 95 c0             	setne  %al
+}
+  80228c:	5d                   	pop    %rbp
+  80228d:	c3                   	ret
+
+000000000080228e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80228e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802291:	48 89 f8             	mov    %rdi,%rax
+  802294:	48 f7 d8             	neg    %rax
+  802297:	83 e0 07             	and    $0x7,%eax
+  80229a:	49 89 d1             	mov    %rdx,%r9
+  80229d:	49 29 c1             	sub    %rax,%r9
+  8022a0:	78 36                	js     8022d8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8022a2:	40 0f b6 c6          	movzbl %sil,%eax
+  8022a6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8022ad:	01 01 01 
+  8022b0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022b4:	40 f6 c7 07          	test   $0x7,%dil
+  8022b8:	75 38                	jne    8022f2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022ba:	4c 89 c9             	mov    %r9,%rcx
+  8022bd:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022c1:	74 0c                	je     8022cf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022c3:	fc                   	cld
+  8022c4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022c7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022cb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022cf:	4d 85 c9             	test   %r9,%r9
+  8022d2:	75 45                	jne    802319 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022d4:	4c 89 c0             	mov    %r8,%rax
+  8022d7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022d8:	48 85 d2             	test   %rdx,%rdx
+  8022db:	74 f7                	je     8022d4 <memset+0x46>
+  8022dd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022e0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022e3:	48 83 c0 01          	add    $0x1,%rax
+  8022e7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022eb:	48 39 c2             	cmp    %rax,%rdx
+  8022ee:	75 f3                	jne    8022e3 <memset+0x55>
+  8022f0:	eb e2                	jmp    8022d4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022f2:	40 f6 c7 01          	test   $0x1,%dil
+  8022f6:	74 06                	je     8022fe <memset+0x70>
+  8022f8:	88 07                	mov    %al,(%rdi)
+  8022fa:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022fe:	40 f6 c7 02          	test   $0x2,%dil
+  802302:	74 07                	je     80230b <memset+0x7d>
+  802304:	66 89 07             	mov    %ax,(%rdi)
+  802307:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80230b:	40 f6 c7 04          	test   $0x4,%dil
+  80230f:	74 a9                	je     8022ba <memset+0x2c>
+  802311:	89 07                	mov    %eax,(%rdi)
+  802313:	48 83 c7 04          	add    $0x4,%rdi
+  802317:	eb a1                	jmp    8022ba <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802319:	41 f6 c1 04          	test   $0x4,%r9b
+  80231d:	74 06                	je     802325 <memset+0x97>
+  80231f:	89 07                	mov    %eax,(%rdi)
+  802321:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802325:	41 f6 c1 02          	test   $0x2,%r9b
+  802329:	74 07                	je     802332 <memset+0xa4>
+  80232b:	66 89 07             	mov    %ax,(%rdi)
+  80232e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802332:	41 f6 c1 01          	test   $0x1,%r9b
+  802336:	74 9c                	je     8022d4 <memset+0x46>
+  802338:	88 07                	mov    %al,(%rdi)
+  80233a:	eb 98                	jmp    8022d4 <memset+0x46>
+
+000000000080233c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80233c:	48 89 f8             	mov    %rdi,%rax
+  80233f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802342:	48 39 fe             	cmp    %rdi,%rsi
+  802345:	73 3b                	jae    802382 <memmove+0x46>
+  802347:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80234b:	48 39 d7             	cmp    %rdx,%rdi
+  80234e:	73 32                	jae    802382 <memmove+0x46>
+        s += n;
+        d += n;
+  802350:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802354:	48 89 d6             	mov    %rdx,%rsi
+  802357:	48 09 fe             	or     %rdi,%rsi
+  80235a:	48 09 ce             	or     %rcx,%rsi
+  80235d:	40 f6 c6 07          	test   $0x7,%sil
+  802361:	75 12                	jne    802375 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802363:	48 83 ef 08          	sub    $0x8,%rdi
+  802367:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80236b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80236f:	fd                   	std
+  802370:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802373:	fc                   	cld
+  802374:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802375:	48 83 ef 01          	sub    $0x1,%rdi
+  802379:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80237d:	fd                   	std
+  80237e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802380:	eb f1                	jmp    802373 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802382:	48 89 f2             	mov    %rsi,%rdx
+  802385:	48 09 c2             	or     %rax,%rdx
+  802388:	48 09 ca             	or     %rcx,%rdx
+  80238b:	f6 c2 07             	test   $0x7,%dl
+  80238e:	75 0c                	jne    80239c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802390:	48 c1 e9 03          	shr    $0x3,%rcx
+  802394:	48 89 c7             	mov    %rax,%rdi
+  802397:	fc                   	cld
+  802398:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80239b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80239c:	48 89 c7             	mov    %rax,%rdi
+  80239f:	fc                   	cld
+  8023a0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8023a2:	c3                   	ret
+
+00000000008023a3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8023a3:	55                   	push   %rbp
+  8023a4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8023a7:	48 b8 3c 23 80 00 00 	movabs $0x80233c,%rax
+  8023ae:	00 00 00 
+  8023b1:	ff d0                	call   *%rax
+}
+  8023b3:	5d                   	pop    %rbp
+  8023b4:	c3                   	ret
+
+00000000008023b5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023b5:	55                   	push   %rbp
+  8023b6:	48 89 e5             	mov    %rsp,%rbp
+  8023b9:	41 57                	push   %r15
+  8023bb:	41 56                	push   %r14
+  8023bd:	41 55                	push   %r13
+  8023bf:	41 54                	push   %r12
+  8023c1:	53                   	push   %rbx
+  8023c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c6:	49 89 fe             	mov    %rdi,%r14
+  8023c9:	49 89 f7             	mov    %rsi,%r15
+  8023cc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023cf:	48 89 f7             	mov    %rsi,%rdi
+  8023d2:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  8023d9:	00 00 00 
+  8023dc:	ff d0                	call   *%rax
+  8023de:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023e1:	48 89 de             	mov    %rbx,%rsi
+  8023e4:	4c 89 f7             	mov    %r14,%rdi
+  8023e7:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  8023ee:	00 00 00 
+  8023f1:	ff d0                	call   *%rax
+  8023f3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023f6:	48 39 c3             	cmp    %rax,%rbx
+  8023f9:	74 36                	je     802431 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023fb:	48 89 d8             	mov    %rbx,%rax
+  8023fe:	4c 29 e8             	sub    %r13,%rax
+  802401:	49 39 c4             	cmp    %rax,%r12
+  802404:	73 31                	jae    802437 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802406:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80240b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80240f:	4c 89 fe             	mov    %r15,%rsi
+  802412:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  802419:	00 00 00 
+  80241c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80241e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802422:	48 83 c4 08          	add    $0x8,%rsp
+  802426:	5b                   	pop    %rbx
+  802427:	41 5c                	pop    %r12
+  802429:	41 5d                	pop    %r13
+  80242b:	41 5e                	pop    %r14
+  80242d:	41 5f                	pop    %r15
+  80242f:	5d                   	pop    %rbp
+  802430:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802431:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802435:	eb eb                	jmp    802422 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802437:	48 83 eb 01          	sub    $0x1,%rbx
+  80243b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80243f:	48 89 da             	mov    %rbx,%rdx
+  802442:	4c 89 fe             	mov    %r15,%rsi
+  802445:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  80244c:	00 00 00 
+  80244f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802451:	49 01 de             	add    %rbx,%r14
+  802454:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802459:	eb c3                	jmp    80241e <strlcat+0x69>
+
+000000000080245b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80245b:	48 85 d2             	test   %rdx,%rdx
+  80245e:	74 2d                	je     80248d <memcmp+0x32>
+  802460:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802465:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802469:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80246e:	44 38 c1             	cmp    %r8b,%cl
+  802471:	75 0f                	jne    802482 <memcmp+0x27>
+    while (n-- > 0) {
+  802473:	48 83 c0 01          	add    $0x1,%rax
+  802477:	48 39 c2             	cmp    %rax,%rdx
+  80247a:	75 e9                	jne    802465 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80247c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802481:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802482:	0f b6 c1             	movzbl %cl,%eax
+  802485:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802489:	44 29 c0             	sub    %r8d,%eax
+  80248c:	c3                   	ret
+    return 0;
+  80248d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802492:	c3                   	ret
+
+0000000000802493 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802493:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802497:	48 39 c7             	cmp    %rax,%rdi
+  80249a:	73 0f                	jae    8024ab <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80249c:	40 38 37             	cmp    %sil,(%rdi)
+  80249f:	74 0e                	je     8024af <memfind+0x1c>
+    for (; src < end; src++) {
+  8024a1:	48 83 c7 01          	add    $0x1,%rdi
+  8024a5:	48 39 f8             	cmp    %rdi,%rax
+  8024a8:	75 f2                	jne    80249c <memfind+0x9>
+  8024aa:	c3                   	ret
+  8024ab:	48 89 f8             	mov    %rdi,%rax
+  8024ae:	c3                   	ret
+  8024af:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024b2:	c3                   	ret
+
+00000000008024b3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024b3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024b6:	0f b6 37             	movzbl (%rdi),%esi
+  8024b9:	40 80 fe 20          	cmp    $0x20,%sil
+  8024bd:	74 06                	je     8024c5 <strtol+0x12>
+  8024bf:	40 80 fe 09          	cmp    $0x9,%sil
+  8024c3:	75 13                	jne    8024d8 <strtol+0x25>
+  8024c5:	48 83 c7 01          	add    $0x1,%rdi
+  8024c9:	0f b6 37             	movzbl (%rdi),%esi
+  8024cc:	40 80 fe 20          	cmp    $0x20,%sil
+  8024d0:	74 f3                	je     8024c5 <strtol+0x12>
+  8024d2:	40 80 fe 09          	cmp    $0x9,%sil
+  8024d6:	74 ed                	je     8024c5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024d8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024db:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024de:	3c 01                	cmp    $0x1,%al
+  8024e0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024e4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024ea:	75 0f                	jne    8024fb <strtol+0x48>
+  8024ec:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024ef:	74 14                	je     802505 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024f1:	85 d2                	test   %edx,%edx
+  8024f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024f8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024fb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802500:	4c 63 ca             	movslq %edx,%r9
+  802503:	eb 36                	jmp    80253b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802505:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802509:	74 0f                	je     80251a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80250b:	85 d2                	test   %edx,%edx
+  80250d:	75 ec                	jne    8024fb <strtol+0x48>
+        s++;
+  80250f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802513:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802518:	eb e1                	jmp    8024fb <strtol+0x48>
+        s += 2;
+  80251a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80251e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802523:	eb d6                	jmp    8024fb <strtol+0x48>
+            dig -= '0';
+  802525:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802528:	44 0f b6 c1          	movzbl %cl,%r8d
+  80252c:	41 39 d0             	cmp    %edx,%r8d
+  80252f:	7d 21                	jge    802552 <strtol+0x9f>
+        val = val * base + dig;
+  802531:	49 0f af c1          	imul   %r9,%rax
+  802535:	0f b6 c9             	movzbl %cl,%ecx
+  802538:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80253b:	48 83 c7 01          	add    $0x1,%rdi
+  80253f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802543:	80 f9 39             	cmp    $0x39,%cl
+  802546:	76 dd                	jbe    802525 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802548:	80 f9 7b             	cmp    $0x7b,%cl
+  80254b:	77 05                	ja     802552 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80254d:	83 e9 57             	sub    $0x57,%ecx
+  802550:	eb d6                	jmp    802528 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802552:	4d 85 d2             	test   %r10,%r10
+  802555:	74 03                	je     80255a <strtol+0xa7>
+  802557:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80255a:	48 89 c2             	mov    %rax,%rdx
+  80255d:	48 f7 da             	neg    %rdx
+  802560:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802564:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802568:	c3                   	ret
+
+0000000000802569 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802569:	55                   	push   %rbp
+  80256a:	48 89 e5             	mov    %rsp,%rbp
+  80256d:	53                   	push   %rbx
+  80256e:	48 89 fa             	mov    %rdi,%rdx
+  802571:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802574:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802579:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80257e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802583:	be 00 00 00 00       	mov    $0x0,%esi
+  802588:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80258e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802594:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802596:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+000000000080259c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80259c:	55                   	push   %rbp
+  80259d:	48 89 e5             	mov    %rsp,%rbp
+  8025a0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8025a1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025cb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d1:	c9                   	leave
+  8025d2:	c3                   	ret
+
+00000000008025d3 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025d3:	55                   	push   %rbp
+  8025d4:	48 89 e5             	mov    %rsp,%rbp
+  8025d7:	53                   	push   %rbx
+  8025d8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025db:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802600:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802606:	c9                   	leave
+  802607:	c3                   	ret
+
+0000000000802608 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802608:	55                   	push   %rbp
+  802609:	48 89 e5             	mov    %rsp,%rbp
+  80260c:	53                   	push   %rbx
+  80260d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802611:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802614:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802619:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80261e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802623:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802628:	be 00 00 00 00       	mov    $0x0,%esi
+  80262d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802633:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802639:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80263b:	48 85 c0             	test   %rax,%rax
+  80263e:	7f 06                	jg     802646 <sys_env_destroy+0x3e>
+}
+  802640:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802644:	c9                   	leave
+  802645:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802646:	49 89 c0             	mov    %rax,%r8
+  802649:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80264e:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802655:	00 00 00 
+  802658:	be 27 00 00 00       	mov    $0x27,%esi
+  80265d:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802664:	00 00 00 
+  802667:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266c:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802673:	00 00 00 
+  802676:	41 ff d1             	call   *%r9
+
+0000000000802679 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802679:	55                   	push   %rbp
+  80267a:	48 89 e5             	mov    %rsp,%rbp
+  80267d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80267e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802683:	ba 00 00 00 00       	mov    $0x0,%edx
+  802688:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80268d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802692:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802697:	be 00 00 00 00       	mov    $0x0,%esi
+  80269c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026a8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ae:	c9                   	leave
+  8026af:	c3                   	ret
+
+00000000008026b0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8026b0:	55                   	push   %rbp
+  8026b1:	48 89 e5             	mov    %rsp,%rbp
+  8026b4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026b5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026df:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e5:	c9                   	leave
+  8026e6:	c3                   	ret
+
+00000000008026e7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026e7:	55                   	push   %rbp
+  8026e8:	48 89 e5             	mov    %rsp,%rbp
+  8026eb:	53                   	push   %rbx
+  8026ec:	48 89 fa             	mov    %rdi,%rdx
+  8026ef:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026f2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026f7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026fe:	00 00 00 
+  802701:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802706:	be 00 00 00 00       	mov    $0x0,%esi
+  80270b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802711:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802717:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802719:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80271d:	c9                   	leave
+  80271e:	c3                   	ret
+
+000000000080271f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80271f:	55                   	push   %rbp
+  802720:	48 89 e5             	mov    %rsp,%rbp
+  802723:	53                   	push   %rbx
+  802724:	49 89 f8             	mov    %rdi,%r8
+  802727:	48 89 d3             	mov    %rdx,%rbx
+  80272a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80272d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802732:	4c 89 c2             	mov    %r8,%rdx
+  802735:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802738:	be 00 00 00 00       	mov    $0x0,%esi
+  80273d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802743:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802749:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80274b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80274f:	c9                   	leave
+  802750:	c3                   	ret
+
+0000000000802751 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802751:	55                   	push   %rbp
+  802752:	48 89 e5             	mov    %rsp,%rbp
+  802755:	53                   	push   %rbx
+  802756:	48 83 ec 08          	sub    $0x8,%rsp
+  80275a:	89 f8                	mov    %edi,%eax
+  80275c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80275f:	48 63 f9             	movslq %ecx,%rdi
+  802762:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802765:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80276a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80276d:	be 00 00 00 00       	mov    $0x0,%esi
+  802772:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802778:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80277e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802780:	48 85 c0             	test   %rax,%rax
+  802783:	7f 06                	jg     80278b <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802785:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80278b:	49 89 c0             	mov    %rax,%r8
+  80278e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802793:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  80279a:	00 00 00 
+  80279d:	be 27 00 00 00       	mov    $0x27,%esi
+  8027a2:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  8027a9:	00 00 00 
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b1:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  8027b8:	00 00 00 
+  8027bb:	41 ff d1             	call   *%r9
+
+00000000008027be <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027be:	55                   	push   %rbp
+  8027bf:	48 89 e5             	mov    %rsp,%rbp
+  8027c2:	53                   	push   %rbx
+  8027c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c7:	89 f8                	mov    %edi,%eax
+  8027c9:	49 89 f2             	mov    %rsi,%r10
+  8027cc:	48 89 cf             	mov    %rcx,%rdi
+  8027cf:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027d2:	48 63 da             	movslq %edx,%rbx
+  8027d5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027d8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027dd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027e0:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027eb:	48 85 c0             	test   %rax,%rax
+  8027ee:	7f 06                	jg     8027f6 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f4:	c9                   	leave
+  8027f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027f6:	49 89 c0             	mov    %rax,%r8
+  8027f9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027fe:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802805:	00 00 00 
+  802808:	be 27 00 00 00       	mov    $0x27,%esi
+  80280d:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802814:	00 00 00 
+  802817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281c:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802823:	00 00 00 
+  802826:	41 ff d1             	call   *%r9
+
+0000000000802829 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802829:	55                   	push   %rbp
+  80282a:	48 89 e5             	mov    %rsp,%rbp
+  80282d:	53                   	push   %rbx
+  80282e:	48 83 ec 08          	sub    $0x8,%rsp
+  802832:	48 89 f1             	mov    %rsi,%rcx
+  802835:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802838:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80283b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802840:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802845:	be 00 00 00 00       	mov    $0x0,%esi
+  80284a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802850:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802856:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802858:	48 85 c0             	test   %rax,%rax
+  80285b:	7f 06                	jg     802863 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80285d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802861:	c9                   	leave
+  802862:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802863:	49 89 c0             	mov    %rax,%r8
+  802866:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80286b:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802872:	00 00 00 
+  802875:	be 27 00 00 00       	mov    $0x27,%esi
+  80287a:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802881:	00 00 00 
+  802884:	b8 00 00 00 00       	mov    $0x0,%eax
+  802889:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802890:	00 00 00 
+  802893:	41 ff d1             	call   *%r9
+
+0000000000802896 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802896:	55                   	push   %rbp
+  802897:	48 89 e5             	mov    %rsp,%rbp
+  80289a:	53                   	push   %rbx
+  80289b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80289f:	48 63 ce             	movslq %esi,%rcx
+  8028a2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028a5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028c7:	48 85 c0             	test   %rax,%rax
+  8028ca:	7f 06                	jg     8028d2 <sys_env_set_status+0x3c>
+}
+  8028cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028d2:	49 89 c0             	mov    %rax,%r8
+  8028d5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028da:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8028e1:	00 00 00 
+  8028e4:	be 27 00 00 00       	mov    $0x27,%esi
+  8028e9:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  8028f0:	00 00 00 
+  8028f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f8:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  8028ff:	00 00 00 
+  802902:	41 ff d1             	call   *%r9
+
+0000000000802905 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+  802909:	53                   	push   %rbx
+  80290a:	48 83 ec 08          	sub    $0x8,%rsp
+  80290e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802911:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802914:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802919:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802923:	be 00 00 00 00       	mov    $0x0,%esi
+  802928:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80292e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802934:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802936:	48 85 c0             	test   %rax,%rax
+  802939:	7f 06                	jg     802941 <sys_env_set_trapframe+0x3c>
+}
+  80293b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80293f:	c9                   	leave
+  802940:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802941:	49 89 c0             	mov    %rax,%r8
+  802944:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802949:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802950:	00 00 00 
+  802953:	be 27 00 00 00       	mov    $0x27,%esi
+  802958:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  80295f:	00 00 00 
+  802962:	b8 00 00 00 00       	mov    $0x0,%eax
+  802967:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  80296e:	00 00 00 
+  802971:	41 ff d1             	call   *%r9
+
+0000000000802974 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802974:	55                   	push   %rbp
+  802975:	48 89 e5             	mov    %rsp,%rbp
+  802978:	53                   	push   %rbx
+  802979:	48 83 ec 08          	sub    $0x8,%rsp
+  80297d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802980:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802983:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802988:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80298d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802992:	be 00 00 00 00       	mov    $0x0,%esi
+  802997:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80299d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029a5:	48 85 c0             	test   %rax,%rax
+  8029a8:	7f 06                	jg     8029b0 <sys_env_set_pgfault_upcall+0x3c>
+}
+  8029aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ae:	c9                   	leave
+  8029af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029b0:	49 89 c0             	mov    %rax,%r8
+  8029b3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029b8:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8029bf:	00 00 00 
+  8029c2:	be 27 00 00 00       	mov    $0x27,%esi
+  8029c7:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  8029ce:	00 00 00 
+  8029d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d6:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  8029dd:	00 00 00 
+  8029e0:	41 ff d1             	call   *%r9
+
+00000000008029e3 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029e3:	55                   	push   %rbp
+  8029e4:	48 89 e5             	mov    %rsp,%rbp
+  8029e7:	53                   	push   %rbx
+  8029e8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029ec:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029f3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a02:	be 00 00 00 00       	mov    $0x0,%esi
+  802a07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a0d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a13:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a15:	48 85 c0             	test   %rax,%rax
+  802a18:	7f 06                	jg     802a20 <sys_env_set_reclaim+0x3d>
+}
+  802a1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a1e:	c9                   	leave
+  802a1f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a20:	49 89 c0             	mov    %rax,%r8
+  802a23:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a28:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802a2f:	00 00 00 
+  802a32:	be 27 00 00 00       	mov    $0x27,%esi
+  802a37:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802a3e:	00 00 00 
+  802a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a46:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802a4d:	00 00 00 
+  802a50:	41 ff d1             	call   *%r9
+
+0000000000802a53 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a53:	55                   	push   %rbp
+  802a54:	48 89 e5             	mov    %rsp,%rbp
+  802a57:	53                   	push   %rbx
+  802a58:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a5c:	48 63 ce             	movslq %esi,%rcx
+  802a5f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a62:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a71:	be 00 00 00 00       	mov    $0x0,%esi
+  802a76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a7c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a82:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a84:	48 85 c0             	test   %rax,%rax
+  802a87:	7f 06                	jg     802a8f <sys_env_set_nice+0x3c>
+}
+  802a89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a8d:	c9                   	leave
+  802a8e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a8f:	49 89 c0             	mov    %rax,%r8
+  802a92:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a97:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802a9e:	00 00 00 
+  802aa1:	be 27 00 00 00       	mov    $0x27,%esi
+  802aa6:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802aad:	00 00 00 
+  802ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab5:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802abc:	00 00 00 
+  802abf:	41 ff d1             	call   *%r9
+
+0000000000802ac2 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ac2:	55                   	push   %rbp
+  802ac3:	48 89 e5             	mov    %rsp,%rbp
+  802ac6:	53                   	push   %rbx
+  802ac7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aca:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802acf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ad4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ade:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aef:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802af1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+
+0000000000802af7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802af7:	55                   	push   %rbp
+  802af8:	48 89 e5             	mov    %rsp,%rbp
+  802afb:	53                   	push   %rbx
+  802afc:	89 f8                	mov    %edi,%eax
+  802afe:	49 89 f1             	mov    %rsi,%r9
+  802b01:	48 89 d3             	mov    %rdx,%rbx
+  802b04:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b07:	49 63 f0             	movslq %r8d,%rsi
+  802b0a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b0d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b12:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b21:	cd 30                	int    $0x30
+}
+  802b23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b27:	c9                   	leave
+  802b28:	c3                   	ret
+
+0000000000802b29 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b29:	55                   	push   %rbp
+  802b2a:	48 89 e5             	mov    %rsp,%rbp
+  802b2d:	53                   	push   %rbx
+  802b2e:	89 f8                	mov    %edi,%eax
+  802b30:	49 89 f1             	mov    %rsi,%r9
+  802b33:	48 89 d3             	mov    %rdx,%rbx
+  802b36:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b39:	49 63 f0             	movslq %r8d,%rsi
+  802b3c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b3f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b44:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b4d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b53:	cd 30                	int    $0x30
+}
+  802b55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b59:	c9                   	leave
+  802b5a:	c3                   	ret
+
+0000000000802b5b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b5b:	55                   	push   %rbp
+  802b5c:	48 89 e5             	mov    %rsp,%rbp
+  802b5f:	53                   	push   %rbx
+  802b60:	48 83 ec 08          	sub    $0x8,%rsp
+  802b64:	89 f8                	mov    %edi,%eax
+  802b66:	49 89 f2             	mov    %rsi,%r10
+  802b69:	48 89 d3             	mov    %rdx,%rbx
+  802b6c:	48 89 cf             	mov    %rcx,%rdi
+  802b6f:	44 89 c6             	mov    %r8d,%esi
+  802b72:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b75:	48 63 f6             	movslq %esi,%rsi
+  802b78:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b7b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b80:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b83:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b87:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b89:	48 85 c0             	test   %rax,%rax
+  802b8c:	7f 06                	jg     802b94 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b8e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b92:	c9                   	leave
+  802b93:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b94:	49 89 c0             	mov    %rax,%r8
+  802b97:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b9c:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802ba3:	00 00 00 
+  802ba6:	be 27 00 00 00       	mov    $0x27,%esi
+  802bab:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802bb2:	00 00 00 
+  802bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bba:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802bc1:	00 00 00 
+  802bc4:	41 ff d1             	call   *%r9
+
+0000000000802bc7 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bc7:	55                   	push   %rbp
+  802bc8:	48 89 e5             	mov    %rsp,%rbp
+  802bcb:	53                   	push   %rbx
+  802bcc:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd0:	48 89 f1             	mov    %rsi,%rcx
+  802bd3:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bd6:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bda:	48 8b 1a             	mov    (%rdx),%rbx
+  802bdd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802be0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802be5:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be9:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bed:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bf1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bf3:	48 85 c0             	test   %rax,%rax
+  802bf6:	7f 06                	jg     802bfe <sys_ipc_call_short+0x37>
+}
+  802bf8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bfc:	c9                   	leave
+  802bfd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bfe:	49 89 c0             	mov    %rax,%r8
+  802c01:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802c06:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802c0d:	00 00 00 
+  802c10:	be 27 00 00 00       	mov    $0x27,%esi
+  802c15:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802c1c:	00 00 00 
+  802c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c24:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802c2b:	00 00 00 
+  802c2e:	41 ff d1             	call   *%r9
+
+0000000000802c31 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c31:	55                   	push   %rbp
+  802c32:	48 89 e5             	mov    %rsp,%rbp
+  802c35:	53                   	push   %rbx
+  802c36:	48 83 ec 08          	sub    $0x8,%rsp
+  802c3a:	89 f8                	mov    %edi,%eax
+  802c3c:	49 89 f2             	mov    %rsi,%r10
+  802c3f:	48 89 d3             	mov    %rdx,%rbx
+  802c42:	48 89 cf             	mov    %rcx,%rdi
+  802c45:	44 89 c6             	mov    %r8d,%esi
+  802c48:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c4b:	48 63 f6             	movslq %esi,%rsi
+  802c4e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c51:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c56:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c59:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c5d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c5f:	48 85 c0             	test   %rax,%rax
+  802c62:	7f 06                	jg     802c6a <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c6a:	49 89 c0             	mov    %rax,%r8
+  802c6d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c72:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802c79:	00 00 00 
+  802c7c:	be 27 00 00 00       	mov    $0x27,%esi
+  802c81:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802c88:	00 00 00 
+  802c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c90:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802c97:	00 00 00 
+  802c9a:	41 ff d1             	call   *%r9
+
+0000000000802c9d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c9d:	55                   	push   %rbp
+  802c9e:	48 89 e5             	mov    %rsp,%rbp
+  802ca1:	53                   	push   %rbx
+  802ca2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca6:	48 89 fa             	mov    %rdi,%rdx
+  802ca9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802cac:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cb6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cbb:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cc6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ccc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cce:	48 85 c0             	test   %rax,%rax
+  802cd1:	7f 06                	jg     802cd9 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd7:	c9                   	leave
+  802cd8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cd9:	49 89 c0             	mov    %rax,%r8
+  802cdc:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ce1:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802ce8:	00 00 00 
+  802ceb:	be 27 00 00 00       	mov    $0x27,%esi
+  802cf0:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802cf7:	00 00 00 
+  802cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cff:	49 b9 a3 50 80 00 00 	movabs $0x8050a3,%r9
+  802d06:	00 00 00 
+  802d09:	41 ff d1             	call   *%r9
+
+0000000000802d0c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802d0c:	55                   	push   %rbp
+  802d0d:	48 89 e5             	mov    %rsp,%rbp
+  802d10:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d11:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d16:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d25:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d2a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d35:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d3b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d41:	c9                   	leave
+  802d42:	c3                   	ret
+
+0000000000802d43 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d43:	55                   	push   %rbp
+  802d44:	48 89 e5             	mov    %rsp,%rbp
+  802d47:	53                   	push   %rbx
+  802d48:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d4b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d64:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d6a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d70:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d76:	c9                   	leave
+  802d77:	c3                   	ret
+
+0000000000802d78 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d78:	55                   	push   %rbp
+  802d79:	48 89 e5             	mov    %rsp,%rbp
+  802d7c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d82:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d87:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d91:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d96:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802da1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da7:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802da9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dad:	c9                   	leave
+  802dae:	c3                   	ret
+
+0000000000802daf <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802daf:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802db6:	ff ff ff 
+  802db9:	48 01 f8             	add    %rdi,%rax
+  802dbc:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802dc0:	c3                   	ret
+
+0000000000802dc1 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dc1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dc8:	ff ff ff 
+  802dcb:	48 01 f8             	add    %rdi,%rax
+  802dce:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802dd2:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dd8:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802ddc:	c3                   	ret
+
+0000000000802ddd <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802ddd:	55                   	push   %rbp
+  802dde:	48 89 e5             	mov    %rsp,%rbp
+  802de1:	41 57                	push   %r15
+  802de3:	41 56                	push   %r14
+  802de5:	41 55                	push   %r13
+  802de7:	41 54                	push   %r12
+  802de9:	53                   	push   %rbx
+  802dea:	48 83 ec 08          	sub    $0x8,%rsp
+  802dee:	49 89 ff             	mov    %rdi,%r15
+  802df1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802df6:	49 bd dd 42 80 00 00 	movabs $0x8042dd,%r13
+  802dfd:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802e00:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802e06:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802e09:	48 89 df             	mov    %rbx,%rdi
+  802e0c:	41 ff d5             	call   *%r13
+  802e0f:	83 e0 04             	and    $0x4,%eax
+  802e12:	74 17                	je     802e2b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e14:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e1b:	4c 39 f3             	cmp    %r14,%rbx
+  802e1e:	75 e6                	jne    802e06 <fd_alloc+0x29>
+  802e20:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e26:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e2b:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e2e:	48 83 c4 08          	add    $0x8,%rsp
+  802e32:	5b                   	pop    %rbx
+  802e33:	41 5c                	pop    %r12
+  802e35:	41 5d                	pop    %r13
+  802e37:	41 5e                	pop    %r14
+  802e39:	41 5f                	pop    %r15
+  802e3b:	5d                   	pop    %rbp
+  802e3c:	c3                   	ret
+
+0000000000802e3d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e3d:	83 ff 1f             	cmp    $0x1f,%edi
+  802e40:	77 39                	ja     802e7b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e42:	55                   	push   %rbp
+  802e43:	48 89 e5             	mov    %rsp,%rbp
+  802e46:	41 54                	push   %r12
+  802e48:	53                   	push   %rbx
+  802e49:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e4c:	48 63 df             	movslq %edi,%rbx
+  802e4f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e56:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e5a:	48 89 df             	mov    %rbx,%rdi
+  802e5d:	48 b8 dd 42 80 00 00 	movabs $0x8042dd,%rax
+  802e64:	00 00 00 
+  802e67:	ff d0                	call   *%rax
+  802e69:	a8 04                	test   $0x4,%al
+  802e6b:	74 14                	je     802e81 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e6d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e76:	5b                   	pop    %rbx
+  802e77:	41 5c                	pop    %r12
+  802e79:	5d                   	pop    %rbp
+  802e7a:	c3                   	ret
+        return -E_INVAL;
+  802e7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e80:	c3                   	ret
+        return -E_INVAL;
+  802e81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e86:	eb ee                	jmp    802e76 <fd_lookup+0x39>
+
+0000000000802e88 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e88:	55                   	push   %rbp
+  802e89:	48 89 e5             	mov    %rsp,%rbp
+  802e8c:	41 54                	push   %r12
+  802e8e:	53                   	push   %rbx
+  802e8f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e92:	48 b8 40 62 80 00 00 	movabs $0x806240,%rax
+  802e99:	00 00 00 
+  802e9c:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802ea3:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802ea6:	39 3b                	cmp    %edi,(%rbx)
+  802ea8:	74 47                	je     802ef1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802eaa:	48 83 c0 08          	add    $0x8,%rax
+  802eae:	48 8b 18             	mov    (%rax),%rbx
+  802eb1:	48 85 db             	test   %rbx,%rbx
+  802eb4:	75 f0                	jne    802ea6 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802eb6:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  802ebd:	00 00 00 
+  802ec0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ec6:	89 fa                	mov    %edi,%edx
+  802ec8:	48 bf b8 61 80 00 00 	movabs $0x8061b8,%rdi
+  802ecf:	00 00 00 
+  802ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed7:	48 b9 b5 16 80 00 00 	movabs $0x8016b5,%rcx
+  802ede:	00 00 00 
+  802ee1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ee3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ee8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802eec:	5b                   	pop    %rbx
+  802eed:	41 5c                	pop    %r12
+  802eef:	5d                   	pop    %rbp
+  802ef0:	c3                   	ret
+            return 0;
+  802ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef6:	eb f0                	jmp    802ee8 <dev_lookup+0x60>
+
+0000000000802ef8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ef8:	55                   	push   %rbp
+  802ef9:	48 89 e5             	mov    %rsp,%rbp
+  802efc:	41 55                	push   %r13
+  802efe:	41 54                	push   %r12
+  802f00:	53                   	push   %rbx
+  802f01:	48 83 ec 18          	sub    $0x18,%rsp
+  802f05:	48 89 fb             	mov    %rdi,%rbx
+  802f08:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f0b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f12:	ff ff ff 
+  802f15:	48 01 df             	add    %rbx,%rdi
+  802f18:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f1c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f20:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+  802f2c:	41 89 c5             	mov    %eax,%r13d
+  802f2f:	85 c0                	test   %eax,%eax
+  802f31:	78 06                	js     802f39 <fd_close+0x41>
+  802f33:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f37:	74 1a                	je     802f53 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f39:	45 84 e4             	test   %r12b,%r12b
+  802f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f41:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f45:	44 89 e8             	mov    %r13d,%eax
+  802f48:	48 83 c4 18          	add    $0x18,%rsp
+  802f4c:	5b                   	pop    %rbx
+  802f4d:	41 5c                	pop    %r12
+  802f4f:	41 5d                	pop    %r13
+  802f51:	5d                   	pop    %rbp
+  802f52:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f53:	8b 3b                	mov    (%rbx),%edi
+  802f55:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f59:	48 b8 88 2e 80 00 00 	movabs $0x802e88,%rax
+  802f60:	00 00 00 
+  802f63:	ff d0                	call   *%rax
+  802f65:	41 89 c5             	mov    %eax,%r13d
+  802f68:	85 c0                	test   %eax,%eax
+  802f6a:	78 1b                	js     802f87 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f6c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f70:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f74:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f7a:	48 85 c0             	test   %rax,%rax
+  802f7d:	74 08                	je     802f87 <fd_close+0x8f>
+  802f7f:	48 89 df             	mov    %rbx,%rdi
+  802f82:	ff d0                	call   *%rax
+  802f84:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f8c:	48 89 de             	mov    %rbx,%rsi
+  802f8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f94:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  802f9b:	00 00 00 
+  802f9e:	ff d0                	call   *%rax
+    return res;
+  802fa0:	eb a3                	jmp    802f45 <fd_close+0x4d>
+
+0000000000802fa2 <close>:
+
+int
+close(int fdnum) {
+  802fa2:	55                   	push   %rbp
+  802fa3:	48 89 e5             	mov    %rsp,%rbp
+  802fa6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802faa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fae:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fba:	85 c0                	test   %eax,%eax
+  802fbc:	78 15                	js     802fd3 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fbe:	be 01 00 00 00       	mov    $0x1,%esi
+  802fc3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fc7:	48 b8 f8 2e 80 00 00 	movabs $0x802ef8,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+}
+  802fd3:	c9                   	leave
+  802fd4:	c3                   	ret
+
+0000000000802fd5 <close_all>:
+
+void
+close_all(void) {
+  802fd5:	55                   	push   %rbp
+  802fd6:	48 89 e5             	mov    %rsp,%rbp
+  802fd9:	41 54                	push   %r12
+  802fdb:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fe1:	49 bc a2 2f 80 00 00 	movabs $0x802fa2,%r12
+  802fe8:	00 00 00 
+  802feb:	89 df                	mov    %ebx,%edi
+  802fed:	41 ff d4             	call   *%r12
+  802ff0:	83 c3 01             	add    $0x1,%ebx
+  802ff3:	83 fb 20             	cmp    $0x20,%ebx
+  802ff6:	75 f3                	jne    802feb <close_all+0x16>
+}
+  802ff8:	5b                   	pop    %rbx
+  802ff9:	41 5c                	pop    %r12
+  802ffb:	5d                   	pop    %rbp
+  802ffc:	c3                   	ret
+
+0000000000802ffd <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802ffd:	55                   	push   %rbp
+  802ffe:	48 89 e5             	mov    %rsp,%rbp
+  803001:	41 57                	push   %r15
+  803003:	41 56                	push   %r14
+  803005:	41 55                	push   %r13
+  803007:	41 54                	push   %r12
+  803009:	53                   	push   %rbx
+  80300a:	48 83 ec 18          	sub    $0x18,%rsp
+  80300e:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803011:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803015:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+  803021:	89 c3                	mov    %eax,%ebx
+  803023:	85 c0                	test   %eax,%eax
+  803025:	0f 88 b8 00 00 00    	js     8030e3 <dup+0xe6>
+    close(newfdnum);
+  80302b:	44 89 e7             	mov    %r12d,%edi
+  80302e:	48 b8 a2 2f 80 00 00 	movabs $0x802fa2,%rax
+  803035:	00 00 00 
+  803038:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80303a:	4d 63 ec             	movslq %r12d,%r13
+  80303d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803044:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803048:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80304c:	4c 89 ff             	mov    %r15,%rdi
+  80304f:	49 be c1 2d 80 00 00 	movabs $0x802dc1,%r14
+  803056:	00 00 00 
+  803059:	41 ff d6             	call   *%r14
+  80305c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80305f:	4c 89 ef             	mov    %r13,%rdi
+  803062:	41 ff d6             	call   *%r14
+  803065:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803068:	48 89 df             	mov    %rbx,%rdi
+  80306b:	48 b8 dd 42 80 00 00 	movabs $0x8042dd,%rax
+  803072:	00 00 00 
+  803075:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803077:	a8 04                	test   $0x4,%al
+  803079:	74 2b                	je     8030a6 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80307b:	41 89 c1             	mov    %eax,%r9d
+  80307e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803084:	4c 89 f1             	mov    %r14,%rcx
+  803087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80308c:	48 89 de             	mov    %rbx,%rsi
+  80308f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803094:	48 b8 be 27 80 00 00 	movabs $0x8027be,%rax
+  80309b:	00 00 00 
+  80309e:	ff d0                	call   *%rax
+  8030a0:	89 c3                	mov    %eax,%ebx
+  8030a2:	85 c0                	test   %eax,%eax
+  8030a4:	78 4e                	js     8030f4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8030a6:	4c 89 ff             	mov    %r15,%rdi
+  8030a9:	48 b8 dd 42 80 00 00 	movabs $0x8042dd,%rax
+  8030b0:	00 00 00 
+  8030b3:	ff d0                	call   *%rax
+  8030b5:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030b8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030be:	4c 89 e9             	mov    %r13,%rcx
+  8030c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c6:	4c 89 fe             	mov    %r15,%rsi
+  8030c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ce:	48 b8 be 27 80 00 00 	movabs $0x8027be,%rax
+  8030d5:	00 00 00 
+  8030d8:	ff d0                	call   *%rax
+  8030da:	89 c3                	mov    %eax,%ebx
+  8030dc:	85 c0                	test   %eax,%eax
+  8030de:	78 14                	js     8030f4 <dup+0xf7>
+
+    return newfdnum;
+  8030e0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030e3:	89 d8                	mov    %ebx,%eax
+  8030e5:	48 83 c4 18          	add    $0x18,%rsp
+  8030e9:	5b                   	pop    %rbx
+  8030ea:	41 5c                	pop    %r12
+  8030ec:	41 5d                	pop    %r13
+  8030ee:	41 5e                	pop    %r14
+  8030f0:	41 5f                	pop    %r15
+  8030f2:	5d                   	pop    %rbp
+  8030f3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030f9:	4c 89 ee             	mov    %r13,%rsi
+  8030fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803101:	49 bc 29 28 80 00 00 	movabs $0x802829,%r12
+  803108:	00 00 00 
+  80310b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80310e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803113:	4c 89 f6             	mov    %r14,%rsi
+  803116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311b:	41 ff d4             	call   *%r12
+    return res;
+  80311e:	eb c3                	jmp    8030e3 <dup+0xe6>
+
+0000000000803120 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803120:	55                   	push   %rbp
+  803121:	48 89 e5             	mov    %rsp,%rbp
+  803124:	41 56                	push   %r14
+  803126:	41 55                	push   %r13
+  803128:	41 54                	push   %r12
+  80312a:	53                   	push   %rbx
+  80312b:	48 83 ec 10          	sub    $0x10,%rsp
+  80312f:	89 fb                	mov    %edi,%ebx
+  803131:	49 89 f4             	mov    %rsi,%r12
+  803134:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803137:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80313b:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  803142:	00 00 00 
+  803145:	ff d0                	call   *%rax
+  803147:	85 c0                	test   %eax,%eax
+  803149:	78 4c                	js     803197 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80314b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80314f:	41 8b 3e             	mov    (%r14),%edi
+  803152:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803156:	48 b8 88 2e 80 00 00 	movabs $0x802e88,%rax
+  80315d:	00 00 00 
+  803160:	ff d0                	call   *%rax
+  803162:	85 c0                	test   %eax,%eax
+  803164:	78 35                	js     80319b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803166:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80316a:	83 e0 03             	and    $0x3,%eax
+  80316d:	83 f8 01             	cmp    $0x1,%eax
+  803170:	74 2d                	je     80319f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803172:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803176:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80317a:	48 85 c0             	test   %rax,%rax
+  80317d:	74 56                	je     8031d5 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80317f:	4c 89 ea             	mov    %r13,%rdx
+  803182:	4c 89 e6             	mov    %r12,%rsi
+  803185:	4c 89 f7             	mov    %r14,%rdi
+  803188:	ff d0                	call   *%rax
+}
+  80318a:	48 83 c4 10          	add    $0x10,%rsp
+  80318e:	5b                   	pop    %rbx
+  80318f:	41 5c                	pop    %r12
+  803191:	41 5d                	pop    %r13
+  803193:	41 5e                	pop    %r14
+  803195:	5d                   	pop    %rbp
+  803196:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803197:	48 98                	cltq
+  803199:	eb ef                	jmp    80318a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80319b:	48 98                	cltq
+  80319d:	eb eb                	jmp    80318a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80319f:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8031a6:	00 00 00 
+  8031a9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031af:	89 da                	mov    %ebx,%edx
+  8031b1:	48 bf f9 61 80 00 00 	movabs $0x8061f9,%rdi
+  8031b8:	00 00 00 
+  8031bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c0:	48 b9 b5 16 80 00 00 	movabs $0x8016b5,%rcx
+  8031c7:	00 00 00 
+  8031ca:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031cc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031d3:	eb b5                	jmp    80318a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031d5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031dc:	eb ac                	jmp    80318a <read+0x6a>
+
+00000000008031de <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031de:	55                   	push   %rbp
+  8031df:	48 89 e5             	mov    %rsp,%rbp
+  8031e2:	41 57                	push   %r15
+  8031e4:	41 56                	push   %r14
+  8031e6:	41 55                	push   %r13
+  8031e8:	41 54                	push   %r12
+  8031ea:	53                   	push   %rbx
+  8031eb:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031ef:	48 85 d2             	test   %rdx,%rdx
+  8031f2:	74 54                	je     803248 <readn+0x6a>
+  8031f4:	41 89 fd             	mov    %edi,%r13d
+  8031f7:	49 89 f6             	mov    %rsi,%r14
+  8031fa:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803202:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803207:	49 bf 20 31 80 00 00 	movabs $0x803120,%r15
+  80320e:	00 00 00 
+  803211:	4c 89 e2             	mov    %r12,%rdx
+  803214:	48 29 f2             	sub    %rsi,%rdx
+  803217:	4c 01 f6             	add    %r14,%rsi
+  80321a:	44 89 ef             	mov    %r13d,%edi
+  80321d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803220:	85 c0                	test   %eax,%eax
+  803222:	78 20                	js     803244 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803224:	01 c3                	add    %eax,%ebx
+  803226:	85 c0                	test   %eax,%eax
+  803228:	74 08                	je     803232 <readn+0x54>
+  80322a:	48 63 f3             	movslq %ebx,%rsi
+  80322d:	4c 39 e6             	cmp    %r12,%rsi
+  803230:	72 df                	jb     803211 <readn+0x33>
+    }
+    return res;
+  803232:	48 63 c3             	movslq %ebx,%rax
+}
+  803235:	48 83 c4 08          	add    $0x8,%rsp
+  803239:	5b                   	pop    %rbx
+  80323a:	41 5c                	pop    %r12
+  80323c:	41 5d                	pop    %r13
+  80323e:	41 5e                	pop    %r14
+  803240:	41 5f                	pop    %r15
+  803242:	5d                   	pop    %rbp
+  803243:	c3                   	ret
+        if (inc < 0) return inc;
+  803244:	48 98                	cltq
+  803246:	eb ed                	jmp    803235 <readn+0x57>
+    int inc = 1, res = 0;
+  803248:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80324d:	eb e3                	jmp    803232 <readn+0x54>
+
+000000000080324f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80324f:	55                   	push   %rbp
+  803250:	48 89 e5             	mov    %rsp,%rbp
+  803253:	41 56                	push   %r14
+  803255:	41 55                	push   %r13
+  803257:	41 54                	push   %r12
+  803259:	53                   	push   %rbx
+  80325a:	48 83 ec 10          	sub    $0x10,%rsp
+  80325e:	89 fb                	mov    %edi,%ebx
+  803260:	49 89 f4             	mov    %rsi,%r12
+  803263:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803266:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80326a:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  803271:	00 00 00 
+  803274:	ff d0                	call   *%rax
+  803276:	85 c0                	test   %eax,%eax
+  803278:	78 47                	js     8032c1 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80327a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80327e:	41 8b 3e             	mov    (%r14),%edi
+  803281:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803285:	48 b8 88 2e 80 00 00 	movabs $0x802e88,%rax
+  80328c:	00 00 00 
+  80328f:	ff d0                	call   *%rax
+  803291:	85 c0                	test   %eax,%eax
+  803293:	78 30                	js     8032c5 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803295:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80329a:	74 2d                	je     8032c9 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80329c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032a0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032a4:	48 85 c0             	test   %rax,%rax
+  8032a7:	74 56                	je     8032ff <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8032a9:	4c 89 ea             	mov    %r13,%rdx
+  8032ac:	4c 89 e6             	mov    %r12,%rsi
+  8032af:	4c 89 f7             	mov    %r14,%rdi
+  8032b2:	ff d0                	call   *%rax
+}
+  8032b4:	48 83 c4 10          	add    $0x10,%rsp
+  8032b8:	5b                   	pop    %rbx
+  8032b9:	41 5c                	pop    %r12
+  8032bb:	41 5d                	pop    %r13
+  8032bd:	41 5e                	pop    %r14
+  8032bf:	5d                   	pop    %rbp
+  8032c0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032c1:	48 98                	cltq
+  8032c3:	eb ef                	jmp    8032b4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032c5:	48 98                	cltq
+  8032c7:	eb eb                	jmp    8032b4 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032c9:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8032d0:	00 00 00 
+  8032d3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032d9:	89 da                	mov    %ebx,%edx
+  8032db:	48 bf 15 62 80 00 00 	movabs $0x806215,%rdi
+  8032e2:	00 00 00 
+  8032e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ea:	48 b9 b5 16 80 00 00 	movabs $0x8016b5,%rcx
+  8032f1:	00 00 00 
+  8032f4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032f6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032fd:	eb b5                	jmp    8032b4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032ff:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803306:	eb ac                	jmp    8032b4 <write+0x65>
+
+0000000000803308 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803308:	55                   	push   %rbp
+  803309:	48 89 e5             	mov    %rsp,%rbp
+  80330c:	53                   	push   %rbx
+  80330d:	48 83 ec 18          	sub    $0x18,%rsp
+  803311:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803313:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803317:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  80331e:	00 00 00 
+  803321:	ff d0                	call   *%rax
+  803323:	85 c0                	test   %eax,%eax
+  803325:	78 0c                	js     803333 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803327:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80332b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80332e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803333:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+
+0000000000803339 <tell>:
+
+int tell(int fdnum) {
+  803339:	55                   	push   %rbp
+  80333a:	48 89 e5             	mov    %rsp,%rbp
+  80333d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803341:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803345:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  80334c:	00 00 00 
+  80334f:	ff d0                	call   *%rax
+  803351:	85 c0                	test   %eax,%eax
+  803353:	78 07                	js     80335c <tell+0x23>
+
+    return fd->fd_offset;
+  803355:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803359:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80335c:	c9                   	leave
+  80335d:	c3                   	ret
+
+000000000080335e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80335e:	55                   	push   %rbp
+  80335f:	48 89 e5             	mov    %rsp,%rbp
+  803362:	41 55                	push   %r13
+  803364:	41 54                	push   %r12
+  803366:	53                   	push   %rbx
+  803367:	48 83 ec 18          	sub    $0x18,%rsp
+  80336b:	89 fb                	mov    %edi,%ebx
+  80336d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803370:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803374:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  80337b:	00 00 00 
+  80337e:	ff d0                	call   *%rax
+  803380:	85 c0                	test   %eax,%eax
+  803382:	78 38                	js     8033bc <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803384:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803388:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80338c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803390:	48 b8 88 2e 80 00 00 	movabs $0x802e88,%rax
+  803397:	00 00 00 
+  80339a:	ff d0                	call   *%rax
+  80339c:	85 c0                	test   %eax,%eax
+  80339e:	78 1c                	js     8033bc <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033a0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8033a5:	74 20                	je     8033c7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033ab:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033af:	48 85 c0             	test   %rax,%rax
+  8033b2:	74 47                	je     8033fb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8033b4:	44 89 e6             	mov    %r12d,%esi
+  8033b7:	4c 89 ef             	mov    %r13,%rdi
+  8033ba:	ff d0                	call   *%rax
+}
+  8033bc:	48 83 c4 18          	add    $0x18,%rsp
+  8033c0:	5b                   	pop    %rbx
+  8033c1:	41 5c                	pop    %r12
+  8033c3:	41 5d                	pop    %r13
+  8033c5:	5d                   	pop    %rbp
+  8033c6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033c7:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8033ce:	00 00 00 
+  8033d1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033d7:	89 da                	mov    %ebx,%edx
+  8033d9:	48 bf d8 61 80 00 00 	movabs $0x8061d8,%rdi
+  8033e0:	00 00 00 
+  8033e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e8:	48 b9 b5 16 80 00 00 	movabs $0x8016b5,%rcx
+  8033ef:	00 00 00 
+  8033f2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033f9:	eb c1                	jmp    8033bc <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033fb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803400:	eb ba                	jmp    8033bc <ftruncate+0x5e>
+
+0000000000803402 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803402:	55                   	push   %rbp
+  803403:	48 89 e5             	mov    %rsp,%rbp
+  803406:	41 54                	push   %r12
+  803408:	53                   	push   %rbx
+  803409:	48 83 ec 10          	sub    $0x10,%rsp
+  80340d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803410:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803414:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  80341b:	00 00 00 
+  80341e:	ff d0                	call   *%rax
+  803420:	85 c0                	test   %eax,%eax
+  803422:	78 63                	js     803487 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803424:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803428:	41 8b 3c 24          	mov    (%r12),%edi
+  80342c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803430:	48 b8 88 2e 80 00 00 	movabs $0x802e88,%rax
+  803437:	00 00 00 
+  80343a:	ff d0                	call   *%rax
+  80343c:	85 c0                	test   %eax,%eax
+  80343e:	78 47                	js     803487 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803440:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803444:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803449:	74 45                	je     803490 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80344b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80344e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803455:	00 00 00 
+    stat->st_isdir = 0;
+  803458:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80345f:	00 00 00 
+    stat->st_ino = 0;
+  803462:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803469:	00 00 00 00 
+    stat->st_version = 0;
+  80346d:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803474:	00 00 00 
+    stat->st_dev = dev;
+  803477:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80347e:	48 89 de             	mov    %rbx,%rsi
+  803481:	4c 89 e7             	mov    %r12,%rdi
+  803484:	ff 50 28             	call   *0x28(%rax)
+}
+  803487:	48 83 c4 10          	add    $0x10,%rsp
+  80348b:	5b                   	pop    %rbx
+  80348c:	41 5c                	pop    %r12
+  80348e:	5d                   	pop    %rbp
+  80348f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803490:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803495:	eb f0                	jmp    803487 <fstat+0x85>
+
+0000000000803497 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803497:	55                   	push   %rbp
+  803498:	48 89 e5             	mov    %rsp,%rbp
+  80349b:	41 54                	push   %r12
+  80349d:	53                   	push   %rbx
+  80349e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8034a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a6:	48 b8 b8 39 80 00 00 	movabs $0x8039b8,%rax
+  8034ad:	00 00 00 
+  8034b0:	ff d0                	call   *%rax
+  8034b2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034b4:	85 c0                	test   %eax,%eax
+  8034b6:	78 25                	js     8034dd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034b8:	4c 89 e6             	mov    %r12,%rsi
+  8034bb:	89 c7                	mov    %eax,%edi
+  8034bd:	48 b8 02 34 80 00 00 	movabs $0x803402,%rax
+  8034c4:	00 00 00 
+  8034c7:	ff d0                	call   *%rax
+  8034c9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034cc:	89 df                	mov    %ebx,%edi
+  8034ce:	48 b8 a2 2f 80 00 00 	movabs $0x802fa2,%rax
+  8034d5:	00 00 00 
+  8034d8:	ff d0                	call   *%rax
+
+    return res;
+  8034da:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034dd:	89 d8                	mov    %ebx,%eax
+  8034df:	5b                   	pop    %rbx
+  8034e0:	41 5c                	pop    %r12
+  8034e2:	5d                   	pop    %rbp
+  8034e3:	c3                   	ret
+
+00000000008034e4 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034e4:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034eb:	00 00 00 
+  8034ee:	83 38 00             	cmpl   $0x0,(%rax)
+  8034f1:	74 0a                	je     8034fd <fsipc_env+0x19>
+    return fsenv;
+}
+  8034f3:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034fa:	00 00 
+  8034fc:	c3                   	ret
+fsipc_env(void) {
+  8034fd:	55                   	push   %rbp
+  8034fe:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803501:	bf 03 00 00 00       	mov    $0x3,%edi
+  803506:	48 b8 8a 56 80 00 00 	movabs $0x80568a,%rax
+  80350d:	00 00 00 
+  803510:	ff d0                	call   *%rax
+  803512:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803519:	00 00 
+}
+  80351b:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803522:	00 00 
+  803524:	5d                   	pop    %rbp
+  803525:	c3                   	ret
+
+0000000000803526 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803526:	55                   	push   %rbp
+  803527:	48 89 e5             	mov    %rsp,%rbp
+  80352a:	53                   	push   %rbx
+  80352b:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80352f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803536:	00 
+  803537:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80353e:	00 
+  80353f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803546:	00 
+  803547:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80354e:	00 
+  80354f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803556:	00 
+
+    assert(size <= sizeof(words));
+  803557:	48 83 fa 28          	cmp    $0x28,%rdx
+  80355b:	77 38                	ja     803595 <fsipc_short+0x6f>
+  80355d:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80355f:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803563:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  80356a:	00 00 00 
+  80356d:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80356f:	48 b8 e4 34 80 00 00 	movabs $0x8034e4,%rax
+  803576:	00 00 00 
+  803579:	ff d0                	call   *%rax
+  80357b:	89 c7                	mov    %eax,%edi
+  80357d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803581:	89 de                	mov    %ebx,%esi
+  803583:	48 b8 ed 55 80 00 00 	movabs $0x8055ed,%rax
+  80358a:	00 00 00 
+  80358d:	ff d0                	call   *%rax
+}
+  80358f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803593:	c9                   	leave
+  803594:	c3                   	ret
+    assert(size <= sizeof(words));
+  803595:	48 b9 60 62 80 00 00 	movabs $0x806260,%rcx
+  80359c:	00 00 00 
+  80359f:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8035a6:	00 00 00 
+  8035a9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8035ae:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  8035b5:	00 00 00 
+  8035b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bd:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  8035c4:	00 00 00 
+  8035c7:	41 ff d0             	call   *%r8
+
+00000000008035ca <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035ca:	55                   	push   %rbp
+  8035cb:	48 89 e5             	mov    %rsp,%rbp
+  8035ce:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035d2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035d5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035d8:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035db:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035e4:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035e9:	48 b8 26 35 80 00 00 	movabs $0x803526,%rax
+  8035f0:	00 00 00 
+  8035f3:	ff d0                	call   *%rax
+}
+  8035f5:	c9                   	leave
+  8035f6:	c3                   	ret
+
+00000000008035f7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035f7:	55                   	push   %rbp
+  8035f8:	48 89 e5             	mov    %rsp,%rbp
+  8035fb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035ff:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803602:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803605:	ba 04 00 00 00       	mov    $0x4,%edx
+  80360a:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80360e:	bf 06 00 00 00       	mov    $0x6,%edi
+  803613:	48 b8 26 35 80 00 00 	movabs $0x803526,%rax
+  80361a:	00 00 00 
+  80361d:	ff d0                	call   *%rax
+}
+  80361f:	c9                   	leave
+  803620:	c3                   	ret
+
+0000000000803621 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803621:	55                   	push   %rbp
+  803622:	48 89 e5             	mov    %rsp,%rbp
+  803625:	41 54                	push   %r12
+  803627:	53                   	push   %rbx
+  803628:	48 83 ec 10          	sub    $0x10,%rsp
+  80362c:	89 fb                	mov    %edi,%ebx
+  80362e:	49 89 f4             	mov    %rsi,%r12
+  803631:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803635:	48 b8 e4 34 80 00 00 	movabs $0x8034e4,%rax
+  80363c:	00 00 00 
+  80363f:	ff d0                	call   *%rax
+  803641:	89 c7                	mov    %eax,%edi
+  803643:	6a 00                	push   $0x0
+  803645:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803649:	50                   	push   %rax
+  80364a:	4d 89 e1             	mov    %r12,%r9
+  80364d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803653:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803658:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80365f:	00 00 00 
+  803662:	89 de                	mov    %ebx,%esi
+  803664:	48 b8 88 55 80 00 00 	movabs $0x805588,%rax
+  80366b:	00 00 00 
+  80366e:	ff d0                	call   *%rax
+}
+  803670:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803674:	5b                   	pop    %rbx
+  803675:	41 5c                	pop    %r12
+  803677:	5d                   	pop    %rbp
+  803678:	c3                   	ret
+
+0000000000803679 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803679:	55                   	push   %rbp
+  80367a:	48 89 e5             	mov    %rsp,%rbp
+  80367d:	41 54                	push   %r12
+  80367f:	53                   	push   %rbx
+  803680:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803683:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803686:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80368d:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80368f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803694:	be 00 00 00 00       	mov    $0x0,%esi
+  803699:	bf 05 00 00 00       	mov    $0x5,%edi
+  80369e:	48 b8 21 36 80 00 00 	movabs $0x803621,%rax
+  8036a5:	00 00 00 
+  8036a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036aa:	85 c0                	test   %eax,%eax
+  8036ac:	78 5a                	js     803708 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8036ae:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036b5:	00 00 00 
+  8036b8:	4c 89 e6             	mov    %r12,%rsi
+  8036bb:	48 89 df             	mov    %rbx,%rdi
+  8036be:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8036c5:	00 00 00 
+  8036c8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036ca:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036d1:	00 
+  8036d2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036d8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036df:	00 
+  8036e0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036e6:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036ed:	00 
+  8036ee:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036f5:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036fc:	00 
+  8036fd:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803703:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803708:	5b                   	pop    %rbx
+  803709:	41 5c                	pop    %r12
+  80370b:	5d                   	pop    %rbp
+  80370c:	c3                   	ret
+
+000000000080370d <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80370d:	55                   	push   %rbp
+  80370e:	48 89 e5             	mov    %rsp,%rbp
+  803711:	41 57                	push   %r15
+  803713:	41 56                	push   %r14
+  803715:	41 55                	push   %r13
+  803717:	41 54                	push   %r12
+  803719:	53                   	push   %rbx
+  80371a:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80371e:	48 85 ff             	test   %rdi,%rdi
+  803721:	0f 84 a1 00 00 00    	je     8037c8 <devfile_read+0xbb>
+  803727:	49 89 ff             	mov    %rdi,%r15
+  80372a:	49 89 f5             	mov    %rsi,%r13
+  80372d:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803730:	48 85 f6             	test   %rsi,%rsi
+  803733:	0f 84 c4 00 00 00    	je     8037fd <devfile_read+0xf0>
+    size_t total_read = 0;
+  803739:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803740:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803741:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803748:	00 00 00 
+  80374b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80374f:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803752:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803756:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80375b:	be 00 00 00 00       	mov    $0x0,%esi
+  803760:	bf 03 00 00 00       	mov    $0x3,%edi
+  803765:	48 b8 21 36 80 00 00 	movabs $0x803621,%rax
+  80376c:	00 00 00 
+  80376f:	ff d0                	call   *%rax
+        if (res < 0) {
+  803771:	85 c0                	test   %eax,%eax
+  803773:	0f 88 b9 00 00 00    	js     803832 <devfile_read+0x125>
+        assert(res <= n);
+  803779:	48 63 d8             	movslq %eax,%rbx
+  80377c:	49 39 dc             	cmp    %rbx,%r12
+  80377f:	0f 82 b1 00 00 00    	jb     803836 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803785:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80378a:	0f 87 db 00 00 00    	ja     80386b <devfile_read+0x15e>
+        if (!res) {
+  803790:	85 c0                	test   %eax,%eax
+  803792:	74 21                	je     8037b5 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803794:	48 89 da             	mov    %rbx,%rdx
+  803797:	4c 89 f6             	mov    %r14,%rsi
+  80379a:	4c 89 ef             	mov    %r13,%rdi
+  80379d:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  8037a4:	00 00 00 
+  8037a7:	ff d0                	call   *%rax
+        total_read += res;
+  8037a9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8037ad:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8037b0:	49 29 dc             	sub    %rbx,%r12
+  8037b3:	75 96                	jne    80374b <devfile_read+0x3e>
+    return total_read;
+  8037b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037b9:	48 83 c4 18          	add    $0x18,%rsp
+  8037bd:	5b                   	pop    %rbx
+  8037be:	41 5c                	pop    %r12
+  8037c0:	41 5d                	pop    %r13
+  8037c2:	41 5e                	pop    %r14
+  8037c4:	41 5f                	pop    %r15
+  8037c6:	5d                   	pop    %rbp
+  8037c7:	c3                   	ret
+    assert(fd);
+  8037c8:	48 b9 96 62 80 00 00 	movabs $0x806296,%rcx
+  8037cf:	00 00 00 
+  8037d2:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8037d9:	00 00 00 
+  8037dc:	be 91 00 00 00       	mov    $0x91,%esi
+  8037e1:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  8037e8:	00 00 00 
+  8037eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f0:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  8037f7:	00 00 00 
+  8037fa:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037fd:	48 b9 99 62 80 00 00 	movabs $0x806299,%rcx
+  803804:	00 00 00 
+  803807:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80380e:	00 00 00 
+  803811:	be 92 00 00 00       	mov    $0x92,%esi
+  803816:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80381d:	00 00 00 
+  803820:	b8 00 00 00 00       	mov    $0x0,%eax
+  803825:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  80382c:	00 00 00 
+  80382f:	41 ff d0             	call   *%r8
+            return res;
+  803832:	48 98                	cltq
+  803834:	eb 83                	jmp    8037b9 <devfile_read+0xac>
+        assert(res <= n);
+  803836:	48 b9 9d 62 80 00 00 	movabs $0x80629d,%rcx
+  80383d:	00 00 00 
+  803840:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803847:	00 00 00 
+  80384a:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80384f:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  803856:	00 00 00 
+  803859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385e:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  803865:	00 00 00 
+  803868:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80386b:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  803872:	00 00 00 
+  803875:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80387c:	00 00 00 
+  80387f:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803884:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80388b:	00 00 00 
+  80388e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803893:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  80389a:	00 00 00 
+  80389d:	41 ff d0             	call   *%r8
+
+00000000008038a0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8038a0:	55                   	push   %rbp
+  8038a1:	48 89 e5             	mov    %rsp,%rbp
+  8038a4:	41 57                	push   %r15
+  8038a6:	41 56                	push   %r14
+  8038a8:	41 55                	push   %r13
+  8038aa:	41 54                	push   %r12
+  8038ac:	53                   	push   %rbx
+  8038ad:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8038b1:	48 85 ff             	test   %rdi,%rdi
+  8038b4:	0f 84 83 00 00 00    	je     80393d <devfile_write+0x9d>
+  8038ba:	49 89 ff             	mov    %rdi,%r15
+  8038bd:	49 89 f4             	mov    %rsi,%r12
+  8038c0:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038c3:	48 85 f6             	test   %rsi,%rsi
+  8038c6:	0f 84 a6 00 00 00    	je     803972 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038cc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038d2:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038d9:	00 00 00 
+  8038dc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038e0:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038e3:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038e7:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038ec:	48 39 d3             	cmp    %rdx,%rbx
+  8038ef:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038f3:	4c 89 e6             	mov    %r12,%rsi
+  8038f6:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038fd:	00 00 00 
+  803900:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  803907:	00 00 00 
+  80390a:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80390c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803911:	be 00 00 00 00       	mov    $0x0,%esi
+  803916:	bf 04 00 00 00       	mov    $0x4,%edi
+  80391b:	48 b8 21 36 80 00 00 	movabs $0x803621,%rax
+  803922:	00 00 00 
+  803925:	ff d0                	call   *%rax
+        if (res < 0) {
+  803927:	85 c0                	test   %eax,%eax
+  803929:	78 7c                	js     8039a7 <devfile_write+0x107>
+        total_written += res;
+  80392b:	48 98                	cltq
+  80392d:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803930:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803933:	48 29 c3             	sub    %rax,%rbx
+  803936:	75 a4                	jne    8038dc <devfile_write+0x3c>
+    return total_written;
+  803938:	4c 89 e8             	mov    %r13,%rax
+  80393b:	eb 6c                	jmp    8039a9 <devfile_write+0x109>
+    assert(fd);
+  80393d:	48 b9 96 62 80 00 00 	movabs $0x806296,%rcx
+  803944:	00 00 00 
+  803947:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80394e:	00 00 00 
+  803951:	be bd 00 00 00       	mov    $0xbd,%esi
+  803956:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80395d:	00 00 00 
+  803960:	b8 00 00 00 00       	mov    $0x0,%eax
+  803965:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  80396c:	00 00 00 
+  80396f:	41 ff d0             	call   *%r8
+    assert(buf);
+  803972:	48 b9 99 62 80 00 00 	movabs $0x806299,%rcx
+  803979:	00 00 00 
+  80397c:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803983:	00 00 00 
+  803986:	be be 00 00 00       	mov    $0xbe,%esi
+  80398b:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  803992:	00 00 00 
+  803995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80399a:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  8039a1:	00 00 00 
+  8039a4:	41 ff d0             	call   *%r8
+            return res;
+  8039a7:	48 98                	cltq
+}
+  8039a9:	48 83 c4 08          	add    $0x8,%rsp
+  8039ad:	5b                   	pop    %rbx
+  8039ae:	41 5c                	pop    %r12
+  8039b0:	41 5d                	pop    %r13
+  8039b2:	41 5e                	pop    %r14
+  8039b4:	41 5f                	pop    %r15
+  8039b6:	5d                   	pop    %rbp
+  8039b7:	c3                   	ret
+
+00000000008039b8 <open>:
+open(const char *path, int mode) {
+  8039b8:	55                   	push   %rbp
+  8039b9:	48 89 e5             	mov    %rsp,%rbp
+  8039bc:	41 55                	push   %r13
+  8039be:	41 54                	push   %r12
+  8039c0:	53                   	push   %rbx
+  8039c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8039c5:	49 89 fc             	mov    %rdi,%r12
+  8039c8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039cb:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  8039d2:	00 00 00 
+  8039d5:	ff d0                	call   *%rax
+  8039d7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039dd:	0f 87 8f 00 00 00    	ja     803a72 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039e3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039e7:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  8039ee:	00 00 00 
+  8039f1:	ff d0                	call   *%rax
+  8039f3:	89 c3                	mov    %eax,%ebx
+  8039f5:	85 c0                	test   %eax,%eax
+  8039f7:	78 55                	js     803a4e <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039f9:	4c 89 e6             	mov    %r12,%rsi
+  8039fc:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803a03:	00 00 00 
+  803a06:	48 89 df             	mov    %rbx,%rdi
+  803a09:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a15:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a21:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a25:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a2a:	48 b8 21 36 80 00 00 	movabs $0x803621,%rax
+  803a31:	00 00 00 
+  803a34:	ff d0                	call   *%rax
+  803a36:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a38:	85 c0                	test   %eax,%eax
+  803a3a:	78 1f                	js     803a5b <open+0xa3>
+    return fd2num(fd);
+  803a3c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a40:	48 b8 af 2d 80 00 00 	movabs $0x802daf,%rax
+  803a47:	00 00 00 
+  803a4a:	ff d0                	call   *%rax
+  803a4c:	89 c3                	mov    %eax,%ebx
+}
+  803a4e:	89 d8                	mov    %ebx,%eax
+  803a50:	48 83 c4 18          	add    $0x18,%rsp
+  803a54:	5b                   	pop    %rbx
+  803a55:	41 5c                	pop    %r12
+  803a57:	41 5d                	pop    %r13
+  803a59:	5d                   	pop    %rbp
+  803a5a:	c3                   	ret
+        fd_close(fd, 0);
+  803a5b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a60:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a64:	48 b8 f8 2e 80 00 00 	movabs $0x802ef8,%rax
+  803a6b:	00 00 00 
+  803a6e:	ff d0                	call   *%rax
+        return res;
+  803a70:	eb dc                	jmp    803a4e <open+0x96>
+        return -E_BAD_PATH;
+  803a72:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a77:	eb d5                	jmp    803a4e <open+0x96>
+
+0000000000803a79 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a79:	55                   	push   %rbp
+  803a7a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a82:	be 00 00 00 00       	mov    $0x0,%esi
+  803a87:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a8c:	48 b8 26 35 80 00 00 	movabs $0x803526,%rax
+  803a93:	00 00 00 
+  803a96:	ff d0                	call   *%rax
+}
+  803a98:	5d                   	pop    %rbp
+  803a99:	c3                   	ret
+
+0000000000803a9a <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a9a:	55                   	push   %rbp
+  803a9b:	48 89 e5             	mov    %rsp,%rbp
+  803a9e:	41 56                	push   %r14
+  803aa0:	41 55                	push   %r13
+  803aa2:	41 54                	push   %r12
+  803aa4:	53                   	push   %rbx
+  803aa5:	48 83 ec 10          	sub    $0x10,%rsp
+  803aa9:	41 89 f6             	mov    %esi,%r14d
+  803aac:	49 89 d4             	mov    %rdx,%r12
+  803aaf:	48 89 cb             	mov    %rcx,%rbx
+  803ab2:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ab5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ab9:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  803ac0:	00 00 00 
+  803ac3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ac5:	85 c0                	test   %eax,%eax
+  803ac7:	78 46                	js     803b0f <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ac9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803acd:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ad4:	00 00 00 
+  803ad7:	8b 00                	mov    (%rax),%eax
+  803ad9:	39 02                	cmp    %eax,(%rdx)
+  803adb:	75 3f                	jne    803b1c <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803add:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ae4:	00 00 00 
+  803ae7:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803aea:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803aec:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803af0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803af4:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803af8:	48 89 da             	mov    %rbx,%rdx
+  803afb:	4c 89 e6             	mov    %r12,%rsi
+  803afe:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b03:	48 b8 21 36 80 00 00 	movabs $0x803621,%rax
+  803b0a:	00 00 00 
+  803b0d:	ff d0                	call   *%rax
+}
+  803b0f:	48 83 c4 10          	add    $0x10,%rsp
+  803b13:	5b                   	pop    %rbx
+  803b14:	41 5c                	pop    %r12
+  803b16:	41 5d                	pop    %r13
+  803b18:	41 5e                	pop    %r14
+  803b1a:	5d                   	pop    %rbp
+  803b1b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b1c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b21:	eb ec                	jmp    803b0f <file_map+0x75>
+
+0000000000803b23 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b23:	55                   	push   %rbp
+  803b24:	48 89 e5             	mov    %rsp,%rbp
+  803b27:	41 54                	push   %r12
+  803b29:	53                   	push   %rbx
+  803b2a:	48 83 ec 20          	sub    $0x20,%rsp
+  803b2e:	41 89 f4             	mov    %esi,%r12d
+  803b31:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b34:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b38:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  803b3f:	00 00 00 
+  803b42:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b44:	85 c0                	test   %eax,%eax
+  803b46:	78 3c                	js     803b84 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b4c:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b53:	00 00 00 
+  803b56:	8b 0a                	mov    (%rdx),%ecx
+  803b58:	39 08                	cmp    %ecx,(%rax)
+  803b5a:	75 31                	jne    803b8d <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b5c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b5f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b62:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b66:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b6a:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b6f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b73:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b78:	48 b8 26 35 80 00 00 	movabs $0x803526,%rax
+  803b7f:	00 00 00 
+  803b82:	ff d0                	call   *%rax
+}
+  803b84:	48 83 c4 20          	add    $0x20,%rsp
+  803b88:	5b                   	pop    %rbx
+  803b89:	41 5c                	pop    %r12
+  803b8b:	5d                   	pop    %rbp
+  803b8c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b8d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b92:	eb f0                	jmp    803b84 <file_msync+0x61>
+
+0000000000803b94 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b94:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b98:	7f 01                	jg     803b9b <writebuf+0x7>
+  803b9a:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b9b:	55                   	push   %rbp
+  803b9c:	48 89 e5             	mov    %rsp,%rbp
+  803b9f:	53                   	push   %rbx
+  803ba0:	48 83 ec 08          	sub    $0x8,%rsp
+  803ba4:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803ba7:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803bab:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803baf:	8b 3f                	mov    (%rdi),%edi
+  803bb1:	48 b8 4f 32 80 00 00 	movabs $0x80324f,%rax
+  803bb8:	00 00 00 
+  803bbb:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803bbd:	48 85 c0             	test   %rax,%rax
+  803bc0:	7e 04                	jle    803bc6 <writebuf+0x32>
+  803bc2:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bc6:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bca:	48 39 c2             	cmp    %rax,%rdx
+  803bcd:	74 0f                	je     803bde <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bcf:	48 85 c0             	test   %rax,%rax
+  803bd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bd7:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bdb:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803be2:	c9                   	leave
+  803be3:	c3                   	ret
+
+0000000000803be4 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803be4:	8b 46 04             	mov    0x4(%rsi),%eax
+  803be7:	8d 50 01             	lea    0x1(%rax),%edx
+  803bea:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bed:	48 98                	cltq
+  803bef:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bf4:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bfa:	74 01                	je     803bfd <putch+0x19>
+  803bfc:	c3                   	ret
+putch(int ch, void *arg) {
+  803bfd:	55                   	push   %rbp
+  803bfe:	48 89 e5             	mov    %rsp,%rbp
+  803c01:	53                   	push   %rbx
+  803c02:	48 83 ec 08          	sub    $0x8,%rsp
+  803c06:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803c09:	48 89 f7             	mov    %rsi,%rdi
+  803c0c:	48 b8 94 3b 80 00 00 	movabs $0x803b94,%rax
+  803c13:	00 00 00 
+  803c16:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c18:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c23:	c9                   	leave
+  803c24:	c3                   	ret
+
+0000000000803c25 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c25:	55                   	push   %rbp
+  803c26:	48 89 e5             	mov    %rsp,%rbp
+  803c29:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c30:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c33:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c39:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c40:	00 00 00 
+    state.result = 0;
+  803c43:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c4a:	00 00 00 00 
+    state.error = 1;
+  803c4e:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c55:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c58:	48 89 f2             	mov    %rsi,%rdx
+  803c5b:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c62:	48 bf e4 3b 80 00 00 	movabs $0x803be4,%rdi
+  803c69:	00 00 00 
+  803c6c:	48 b8 05 18 80 00 00 	movabs $0x801805,%rax
+  803c73:	00 00 00 
+  803c76:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c78:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c7f:	7f 14                	jg     803c95 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c81:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c88:	48 85 c0             	test   %rax,%rax
+  803c8b:	75 06                	jne    803c93 <vfprintf+0x6e>
+  803c8d:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c93:	c9                   	leave
+  803c94:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c95:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c9c:	48 b8 94 3b 80 00 00 	movabs $0x803b94,%rax
+  803ca3:	00 00 00 
+  803ca6:	ff d0                	call   *%rax
+  803ca8:	eb d7                	jmp    803c81 <vfprintf+0x5c>
+
+0000000000803caa <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803caa:	55                   	push   %rbp
+  803cab:	48 89 e5             	mov    %rsp,%rbp
+  803cae:	48 83 ec 50          	sub    $0x50,%rsp
+  803cb2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cb6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cbe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cc2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cc9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ccd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cd1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cd5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cd9:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cdd:	48 b8 25 3c 80 00 00 	movabs $0x803c25,%rax
+  803ce4:	00 00 00 
+  803ce7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ce9:	c9                   	leave
+  803cea:	c3                   	ret
+
+0000000000803ceb <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803ceb:	55                   	push   %rbp
+  803cec:	48 89 e5             	mov    %rsp,%rbp
+  803cef:	48 83 ec 50          	sub    $0x50,%rsp
+  803cf3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cf7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cfb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d03:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d07:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d0e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d16:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d1a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d1e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d22:	48 89 fe             	mov    %rdi,%rsi
+  803d25:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d2a:	48 b8 25 3c 80 00 00 	movabs $0x803c25,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d36:	c9                   	leave
+  803d37:	c3                   	ret
+
+0000000000803d38 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d38:	55                   	push   %rbp
+  803d39:	48 89 e5             	mov    %rsp,%rbp
+  803d3c:	41 54                	push   %r12
+  803d3e:	53                   	push   %rbx
+  803d3f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d42:	48 b8 c1 2d 80 00 00 	movabs $0x802dc1,%rax
+  803d49:	00 00 00 
+  803d4c:	ff d0                	call   *%rax
+  803d4e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d51:	48 be d0 62 80 00 00 	movabs $0x8062d0,%rsi
+  803d58:	00 00 00 
+  803d5b:	48 89 df             	mov    %rbx,%rdi
+  803d5e:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  803d65:	00 00 00 
+  803d68:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d6a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d6f:	41 2b 04 24          	sub    (%r12),%eax
+  803d73:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d79:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d80:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d83:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d8a:	00 00 00 
+  803d8d:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d99:	5b                   	pop    %rbx
+  803d9a:	41 5c                	pop    %r12
+  803d9c:	5d                   	pop    %rbp
+  803d9d:	c3                   	ret
+
+0000000000803d9e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d9e:	55                   	push   %rbp
+  803d9f:	48 89 e5             	mov    %rsp,%rbp
+  803da2:	41 54                	push   %r12
+  803da4:	53                   	push   %rbx
+  803da5:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803da8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dad:	48 89 fe             	mov    %rdi,%rsi
+  803db0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db5:	49 bc 29 28 80 00 00 	movabs $0x802829,%r12
+  803dbc:	00 00 00 
+  803dbf:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803dc2:	48 89 df             	mov    %rbx,%rdi
+  803dc5:	48 b8 c1 2d 80 00 00 	movabs $0x802dc1,%rax
+  803dcc:	00 00 00 
+  803dcf:	ff d0                	call   *%rax
+  803dd1:	48 89 c6             	mov    %rax,%rsi
+  803dd4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dde:	41 ff d4             	call   *%r12
+}
+  803de1:	5b                   	pop    %rbx
+  803de2:	41 5c                	pop    %r12
+  803de4:	5d                   	pop    %rbp
+  803de5:	c3                   	ret
+
+0000000000803de6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803de6:	55                   	push   %rbp
+  803de7:	48 89 e5             	mov    %rsp,%rbp
+  803dea:	41 57                	push   %r15
+  803dec:	41 56                	push   %r14
+  803dee:	41 55                	push   %r13
+  803df0:	41 54                	push   %r12
+  803df2:	53                   	push   %rbx
+  803df3:	48 83 ec 18          	sub    $0x18,%rsp
+  803df7:	49 89 fc             	mov    %rdi,%r12
+  803dfa:	49 89 f5             	mov    %rsi,%r13
+  803dfd:	49 89 d7             	mov    %rdx,%r15
+  803e00:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e04:	48 b8 c1 2d 80 00 00 	movabs $0x802dc1,%rax
+  803e0b:	00 00 00 
+  803e0e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e10:	4d 85 ff             	test   %r15,%r15
+  803e13:	0f 84 af 00 00 00    	je     803ec8 <devpipe_write+0xe2>
+  803e19:	48 89 c3             	mov    %rax,%rbx
+  803e1c:	4c 89 f8             	mov    %r15,%rax
+  803e1f:	4d 89 ef             	mov    %r13,%r15
+  803e22:	4c 01 e8             	add    %r13,%rax
+  803e25:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e29:	49 bd 1f 27 80 00 00 	movabs $0x80271f,%r13
+  803e30:	00 00 00 
+            sys_yield();
+  803e33:	49 be b0 26 80 00 00 	movabs $0x8026b0,%r14
+  803e3a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e3d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e40:	48 63 ce             	movslq %esi,%rcx
+  803e43:	48 63 03             	movslq (%rbx),%rax
+  803e46:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e4c:	48 39 c1             	cmp    %rax,%rcx
+  803e4f:	72 2e                	jb     803e7f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e51:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e56:	48 89 da             	mov    %rbx,%rdx
+  803e59:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e5e:	4c 89 e7             	mov    %r12,%rdi
+  803e61:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e64:	85 c0                	test   %eax,%eax
+  803e66:	74 66                	je     803ece <devpipe_write+0xe8>
+            sys_yield();
+  803e68:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e6b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e6e:	48 63 ce             	movslq %esi,%rcx
+  803e71:	48 63 03             	movslq (%rbx),%rax
+  803e74:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e7a:	48 39 c1             	cmp    %rax,%rcx
+  803e7d:	73 d2                	jae    803e51 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e7f:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e83:	48 89 ca             	mov    %rcx,%rdx
+  803e86:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e8a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e91:	08 10 20 
+  803e94:	48 f7 e2             	mul    %rdx
+  803e97:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e9b:	48 89 d0             	mov    %rdx,%rax
+  803e9e:	48 c1 e0 09          	shl    $0x9,%rax
+  803ea2:	48 29 d0             	sub    %rdx,%rax
+  803ea5:	48 c1 e0 03          	shl    $0x3,%rax
+  803ea9:	48 29 c1             	sub    %rax,%rcx
+  803eac:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803eb1:	83 c6 01             	add    $0x1,%esi
+  803eb4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803eb7:	49 83 c7 01          	add    $0x1,%r15
+  803ebb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ebf:	49 39 c7             	cmp    %rax,%r15
+  803ec2:	0f 85 75 ff ff ff    	jne    803e3d <devpipe_write+0x57>
+    return n;
+  803ec8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ecc:	eb 05                	jmp    803ed3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ece:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed3:	48 83 c4 18          	add    $0x18,%rsp
+  803ed7:	5b                   	pop    %rbx
+  803ed8:	41 5c                	pop    %r12
+  803eda:	41 5d                	pop    %r13
+  803edc:	41 5e                	pop    %r14
+  803ede:	41 5f                	pop    %r15
+  803ee0:	5d                   	pop    %rbp
+  803ee1:	c3                   	ret
+
+0000000000803ee2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ee2:	55                   	push   %rbp
+  803ee3:	48 89 e5             	mov    %rsp,%rbp
+  803ee6:	41 57                	push   %r15
+  803ee8:	41 56                	push   %r14
+  803eea:	41 55                	push   %r13
+  803eec:	41 54                	push   %r12
+  803eee:	53                   	push   %rbx
+  803eef:	48 83 ec 18          	sub    $0x18,%rsp
+  803ef3:	49 89 fc             	mov    %rdi,%r12
+  803ef6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803efa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803efe:	48 b8 c1 2d 80 00 00 	movabs $0x802dc1,%rax
+  803f05:	00 00 00 
+  803f08:	ff d0                	call   *%rax
+  803f0a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803f0d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f13:	49 bd 1f 27 80 00 00 	movabs $0x80271f,%r13
+  803f1a:	00 00 00 
+            sys_yield();
+  803f1d:	49 be b0 26 80 00 00 	movabs $0x8026b0,%r14
+  803f24:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f27:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f2c:	74 7d                	je     803fab <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f2e:	8b 03                	mov    (%rbx),%eax
+  803f30:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f33:	75 26                	jne    803f5b <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f35:	4d 85 ff             	test   %r15,%r15
+  803f38:	75 77                	jne    803fb1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f3a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f3f:	48 89 da             	mov    %rbx,%rdx
+  803f42:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f47:	4c 89 e7             	mov    %r12,%rdi
+  803f4a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f4d:	85 c0                	test   %eax,%eax
+  803f4f:	74 72                	je     803fc3 <devpipe_read+0xe1>
+            sys_yield();
+  803f51:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f54:	8b 03                	mov    (%rbx),%eax
+  803f56:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f59:	74 df                	je     803f3a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f5b:	48 63 c8             	movslq %eax,%rcx
+  803f5e:	48 89 ca             	mov    %rcx,%rdx
+  803f61:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f65:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f6c:	08 10 20 
+  803f6f:	48 89 d0             	mov    %rdx,%rax
+  803f72:	48 f7 e6             	mul    %rsi
+  803f75:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f79:	48 89 d0             	mov    %rdx,%rax
+  803f7c:	48 c1 e0 09          	shl    $0x9,%rax
+  803f80:	48 29 d0             	sub    %rdx,%rax
+  803f83:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f8a:	00 
+  803f8b:	48 89 c8             	mov    %rcx,%rax
+  803f8e:	48 29 d0             	sub    %rdx,%rax
+  803f91:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f96:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f9a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f9e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803fa1:	49 83 c7 01          	add    $0x1,%r15
+  803fa5:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803fa9:	75 83                	jne    803f2e <devpipe_read+0x4c>
+    return n;
+  803fab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803faf:	eb 03                	jmp    803fb4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803fb1:	4c 89 f8             	mov    %r15,%rax
+}
+  803fb4:	48 83 c4 18          	add    $0x18,%rsp
+  803fb8:	5b                   	pop    %rbx
+  803fb9:	41 5c                	pop    %r12
+  803fbb:	41 5d                	pop    %r13
+  803fbd:	41 5e                	pop    %r14
+  803fbf:	41 5f                	pop    %r15
+  803fc1:	5d                   	pop    %rbp
+  803fc2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc8:	eb ea                	jmp    803fb4 <devpipe_read+0xd2>
+
+0000000000803fca <pipe>:
+pipe(int pfd[2]) {
+  803fca:	55                   	push   %rbp
+  803fcb:	48 89 e5             	mov    %rsp,%rbp
+  803fce:	41 55                	push   %r13
+  803fd0:	41 54                	push   %r12
+  803fd2:	53                   	push   %rbx
+  803fd3:	48 83 ec 18          	sub    $0x18,%rsp
+  803fd7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fda:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fde:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  803fe5:	00 00 00 
+  803fe8:	ff d0                	call   *%rax
+  803fea:	89 c3                	mov    %eax,%ebx
+  803fec:	85 c0                	test   %eax,%eax
+  803fee:	0f 88 a0 01 00 00    	js     804194 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ff4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ff9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ffe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804002:	bf 00 00 00 00       	mov    $0x0,%edi
+  804007:	48 b8 51 27 80 00 00 	movabs $0x802751,%rax
+  80400e:	00 00 00 
+  804011:	ff d0                	call   *%rax
+  804013:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804015:	85 c0                	test   %eax,%eax
+  804017:	0f 88 77 01 00 00    	js     804194 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80401d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804021:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  804028:	00 00 00 
+  80402b:	ff d0                	call   *%rax
+  80402d:	89 c3                	mov    %eax,%ebx
+  80402f:	85 c0                	test   %eax,%eax
+  804031:	0f 88 43 01 00 00    	js     80417a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804037:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80403c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804041:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804045:	bf 00 00 00 00       	mov    $0x0,%edi
+  80404a:	48 b8 51 27 80 00 00 	movabs $0x802751,%rax
+  804051:	00 00 00 
+  804054:	ff d0                	call   *%rax
+  804056:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804058:	85 c0                	test   %eax,%eax
+  80405a:	0f 88 1a 01 00 00    	js     80417a <pipe+0x1b0>
+    va = fd2data(fd0);
+  804060:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804064:	48 b8 c1 2d 80 00 00 	movabs $0x802dc1,%rax
+  80406b:	00 00 00 
+  80406e:	ff d0                	call   *%rax
+  804070:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804073:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804078:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80407d:	48 89 c6             	mov    %rax,%rsi
+  804080:	bf 00 00 00 00       	mov    $0x0,%edi
+  804085:	48 b8 51 27 80 00 00 	movabs $0x802751,%rax
+  80408c:	00 00 00 
+  80408f:	ff d0                	call   *%rax
+  804091:	89 c3                	mov    %eax,%ebx
+  804093:	85 c0                	test   %eax,%eax
+  804095:	0f 88 c5 00 00 00    	js     804160 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80409b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80409f:	48 b8 c1 2d 80 00 00 	movabs $0x802dc1,%rax
+  8040a6:	00 00 00 
+  8040a9:	ff d0                	call   *%rax
+  8040ab:	48 89 c1             	mov    %rax,%rcx
+  8040ae:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040b4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040bf:	4c 89 ee             	mov    %r13,%rsi
+  8040c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c7:	48 b8 be 27 80 00 00 	movabs $0x8027be,%rax
+  8040ce:	00 00 00 
+  8040d1:	ff d0                	call   *%rax
+  8040d3:	89 c3                	mov    %eax,%ebx
+  8040d5:	85 c0                	test   %eax,%eax
+  8040d7:	78 6e                	js     804147 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040d9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040de:	4c 89 ef             	mov    %r13,%rdi
+  8040e1:	48 b8 e7 26 80 00 00 	movabs $0x8026e7,%rax
+  8040e8:	00 00 00 
+  8040eb:	ff d0                	call   *%rax
+  8040ed:	83 f8 02             	cmp    $0x2,%eax
+  8040f0:	0f 85 ab 00 00 00    	jne    8041a1 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040f6:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040fd:	00 00 
+  8040ff:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804103:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804105:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804109:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804110:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804114:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804116:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80411a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804121:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804125:	48 bb af 2d 80 00 00 	movabs $0x802daf,%rbx
+  80412c:	00 00 00 
+  80412f:	ff d3                	call   *%rbx
+  804131:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804135:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804139:	ff d3                	call   *%rbx
+  80413b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804140:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804145:	eb 4d                	jmp    804194 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804147:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80414c:	4c 89 ee             	mov    %r13,%rsi
+  80414f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804154:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  80415b:	00 00 00 
+  80415e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804160:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804165:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80416e:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  804175:	00 00 00 
+  804178:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80417a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80417f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804183:	bf 00 00 00 00       	mov    $0x0,%edi
+  804188:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  80418f:	00 00 00 
+  804192:	ff d0                	call   *%rax
+}
+  804194:	89 d8                	mov    %ebx,%eax
+  804196:	48 83 c4 18          	add    $0x18,%rsp
+  80419a:	5b                   	pop    %rbx
+  80419b:	41 5c                	pop    %r12
+  80419d:	41 5d                	pop    %r13
+  80419f:	5d                   	pop    %rbp
+  8041a0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8041a1:	48 b9 e8 62 80 00 00 	movabs $0x8062e8,%rcx
+  8041a8:	00 00 00 
+  8041ab:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8041b2:	00 00 00 
+  8041b5:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041ba:	48 bf d7 62 80 00 00 	movabs $0x8062d7,%rdi
+  8041c1:	00 00 00 
+  8041c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c9:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  8041d0:	00 00 00 
+  8041d3:	41 ff d0             	call   *%r8
+
+00000000008041d6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041d6:	55                   	push   %rbp
+  8041d7:	48 89 e5             	mov    %rsp,%rbp
+  8041da:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041de:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041e2:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  8041e9:	00 00 00 
+  8041ec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041ee:	85 c0                	test   %eax,%eax
+  8041f0:	78 35                	js     804227 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041f2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041f6:	48 b8 c1 2d 80 00 00 	movabs $0x802dc1,%rax
+  8041fd:	00 00 00 
+  804200:	ff d0                	call   *%rax
+  804202:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804205:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80420a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80420f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804213:	48 b8 1f 27 80 00 00 	movabs $0x80271f,%rax
+  80421a:	00 00 00 
+  80421d:	ff d0                	call   *%rax
+  80421f:	85 c0                	test   %eax,%eax
+  804221:	0f 94 c0             	sete   %al
+  804224:	0f b6 c0             	movzbl %al,%eax
+}
+  804227:	c9                   	leave
+  804228:	c3                   	ret
+
+0000000000804229 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804229:	48 89 f8             	mov    %rdi,%rax
+  80422c:	48 c1 e8 27          	shr    $0x27,%rax
+  804230:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804237:	01 00 00 
+  80423a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80423e:	f6 c2 01             	test   $0x1,%dl
+  804241:	74 6d                	je     8042b0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804243:	48 89 f8             	mov    %rdi,%rax
+  804246:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80424a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804251:	01 00 00 
+  804254:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804258:	f6 c2 01             	test   $0x1,%dl
+  80425b:	74 62                	je     8042bf <get_uvpt_entry+0x96>
+  80425d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804264:	01 00 00 
+  804267:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80426b:	f6 c2 80             	test   $0x80,%dl
+  80426e:	75 4f                	jne    8042bf <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804270:	48 89 f8             	mov    %rdi,%rax
+  804273:	48 c1 e8 15          	shr    $0x15,%rax
+  804277:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80427e:	01 00 00 
+  804281:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804285:	f6 c2 01             	test   $0x1,%dl
+  804288:	74 44                	je     8042ce <get_uvpt_entry+0xa5>
+  80428a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804291:	01 00 00 
+  804294:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804298:	f6 c2 80             	test   $0x80,%dl
+  80429b:	75 31                	jne    8042ce <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80429d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8042a1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8042a8:	01 00 00 
+  8042ab:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8042af:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042b0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042b7:	01 00 00 
+  8042ba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042be:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042bf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042c6:	01 00 00 
+  8042c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042cd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042ce:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042d5:	01 00 00 
+  8042d8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042dc:	c3                   	ret
+
+00000000008042dd <get_prot>:
+
+int
+get_prot(void *va) {
+  8042dd:	55                   	push   %rbp
+  8042de:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042e1:	48 b8 29 42 80 00 00 	movabs $0x804229,%rax
+  8042e8:	00 00 00 
+  8042eb:	ff d0                	call   *%rax
+  8042ed:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042f0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042f5:	89 c1                	mov    %eax,%ecx
+  8042f7:	83 c9 04             	or     $0x4,%ecx
+  8042fa:	f6 c2 01             	test   $0x1,%dl
+  8042fd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804300:	89 c1                	mov    %eax,%ecx
+  804302:	83 c9 02             	or     $0x2,%ecx
+  804305:	f6 c2 02             	test   $0x2,%dl
+  804308:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80430b:	89 c1                	mov    %eax,%ecx
+  80430d:	83 c9 01             	or     $0x1,%ecx
+  804310:	48 85 d2             	test   %rdx,%rdx
+  804313:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804316:	89 c1                	mov    %eax,%ecx
+  804318:	83 c9 40             	or     $0x40,%ecx
+  80431b:	f6 c6 04             	test   $0x4,%dh
+  80431e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804321:	5d                   	pop    %rbp
+  804322:	c3                   	ret
+
+0000000000804323 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804323:	55                   	push   %rbp
+  804324:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804327:	48 b8 29 42 80 00 00 	movabs $0x804229,%rax
+  80432e:	00 00 00 
+  804331:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804333:	48 c1 e8 06          	shr    $0x6,%rax
+  804337:	83 e0 01             	and    $0x1,%eax
+}
+  80433a:	5d                   	pop    %rbp
+  80433b:	c3                   	ret
+
+000000000080433c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80433c:	55                   	push   %rbp
+  80433d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804340:	48 b8 29 42 80 00 00 	movabs $0x804229,%rax
+  804347:	00 00 00 
+  80434a:	ff d0                	call   *%rax
+  80434c:	83 e0 01             	and    $0x1,%eax
+}
+  80434f:	5d                   	pop    %rbp
+  804350:	c3                   	ret
+
+0000000000804351 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804351:	55                   	push   %rbp
+  804352:	48 89 e5             	mov    %rsp,%rbp
+  804355:	41 57                	push   %r15
+  804357:	41 56                	push   %r14
+  804359:	41 55                	push   %r13
+  80435b:	41 54                	push   %r12
+  80435d:	53                   	push   %rbx
+  80435e:	48 83 ec 28          	sub    $0x28,%rsp
+  804362:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804366:	48 85 ff             	test   %rdi,%rdi
+  804369:	74 1e                	je     804389 <foreach_shared_region+0x38>
+  80436b:	49 89 ff             	mov    %rdi,%r15
+  80436e:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804374:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80437a:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804381:	01 00 00 
+  804384:	e9 72 02 00 00       	jmp    8045fb <foreach_shared_region+0x2aa>
+    assert(fun);
+  804389:	48 b9 0c 63 80 00 00 	movabs $0x80630c,%rcx
+  804390:	00 00 00 
+  804393:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80439a:	00 00 00 
+  80439d:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8043a2:	48 bf 10 63 80 00 00 	movabs $0x806310,%rdi
+  8043a9:	00 00 00 
+  8043ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b1:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  8043b8:	00 00 00 
+  8043bb:	41 ff d0             	call   *%r8
+  8043be:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043c5:	eb 6c                	jmp    804433 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043c7:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043ce:	ff ff ff 
+  8043d1:	4c 21 e2             	and    %r12,%rdx
+  8043d4:	48 89 d8             	mov    %rbx,%rax
+  8043d7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043dc:	48 83 c0 01          	add    $0x1,%rax
+  8043e0:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043e4:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043eb:	00 00 00 
+  8043ee:	48 21 c8             	and    %rcx,%rax
+  8043f1:	48 09 d0             	or     %rdx,%rax
+  8043f4:	49 89 c4             	mov    %rax,%r12
+  8043f7:	eb 30                	jmp    804429 <foreach_shared_region+0xd8>
+  8043f9:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804400:	ff ff ff 
+  804403:	4c 21 e2             	and    %r12,%rdx
+  804406:	48 89 d8             	mov    %rbx,%rax
+  804409:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80440e:	48 83 c0 01          	add    $0x1,%rax
+  804412:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804416:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80441d:	00 00 00 
+  804420:	48 21 c8             	and    %rcx,%rax
+  804423:	48 09 d0             	or     %rdx,%rax
+  804426:	49 89 c4             	mov    %rax,%r12
+  804429:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80442d:	0f 84 99 01 00 00    	je     8045cc <foreach_shared_region+0x27b>
+  804433:	4c 89 e3             	mov    %r12,%rbx
+  804436:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80443a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804441:	01 00 00 
+  804444:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804448:	a8 01                	test   $0x1,%al
+  80444a:	0f 84 77 ff ff ff    	je     8043c7 <foreach_shared_region+0x76>
+  804450:	a8 80                	test   $0x80,%al
+  804452:	74 19                	je     80446d <foreach_shared_region+0x11c>
+  804454:	f6 c4 04             	test   $0x4,%ah
+  804457:	74 a0                	je     8043f9 <foreach_shared_region+0xa8>
+  804459:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804460:	40 
+  804461:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804465:	4c 89 e7             	mov    %r12,%rdi
+  804468:	41 ff d7             	call   *%r15
+  80446b:	eb 8c                	jmp    8043f9 <foreach_shared_region+0xa8>
+  80446d:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804474:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804478:	eb 46                	jmp    8044c0 <foreach_shared_region+0x16f>
+  80447a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804481:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804487:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80448b:	48 c1 e0 15          	shl    $0x15,%rax
+  80448f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804494:	49 09 c4             	or     %rax,%r12
+  804497:	eb 1d                	jmp    8044b6 <foreach_shared_region+0x165>
+  804499:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8044a0:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044a6:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8044aa:	48 c1 e0 15          	shl    $0x15,%rax
+  8044ae:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044b3:	49 09 c4             	or     %rax,%r12
+  8044b6:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044ba:	0f 84 d3 00 00 00    	je     804593 <foreach_shared_region+0x242>
+  8044c0:	4c 89 e3             	mov    %r12,%rbx
+  8044c3:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044c7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044ce:	01 00 00 
+  8044d1:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044d5:	a8 01                	test   $0x1,%al
+  8044d7:	74 a1                	je     80447a <foreach_shared_region+0x129>
+  8044d9:	a8 80                	test   $0x80,%al
+  8044db:	74 19                	je     8044f6 <foreach_shared_region+0x1a5>
+  8044dd:	f6 c4 04             	test   $0x4,%ah
+  8044e0:	74 b7                	je     804499 <foreach_shared_region+0x148>
+  8044e2:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044e9:	00 
+  8044ea:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044ee:	4c 89 e7             	mov    %r12,%rdi
+  8044f1:	41 ff d7             	call   *%r15
+  8044f4:	eb a3                	jmp    804499 <foreach_shared_region+0x148>
+  8044f6:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044fc:	eb 3b                	jmp    804539 <foreach_shared_region+0x1e8>
+  8044fe:	f6 c4 04             	test   $0x4,%ah
+  804501:	74 12                	je     804515 <foreach_shared_region+0x1c4>
+  804503:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80450a:	00 
+  80450b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80450f:	4c 89 e7             	mov    %r12,%rdi
+  804512:	41 ff d7             	call   *%r15
+  804515:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80451c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804522:	48 83 c3 01          	add    $0x1,%rbx
+  804526:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80452a:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804530:	49 09 dc             	or     %rbx,%r12
+  804533:	41 83 ed 01          	sub    $0x1,%r13d
+  804537:	74 2f                	je     804568 <foreach_shared_region+0x217>
+  804539:	4c 89 e3             	mov    %r12,%rbx
+  80453c:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804540:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804544:	a8 01                	test   $0x1,%al
+  804546:	75 b6                	jne    8044fe <foreach_shared_region+0x1ad>
+  804548:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80454f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804555:	48 83 c3 01          	add    $0x1,%rbx
+  804559:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80455d:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804563:	49 09 dc             	or     %rbx,%r12
+  804566:	eb cb                	jmp    804533 <foreach_shared_region+0x1e2>
+  804568:	4c 89 e0             	mov    %r12,%rax
+  80456b:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804571:	49 c1 ec 15          	shr    $0x15,%r12
+  804575:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80457c:	49 83 c4 01          	add    $0x1,%r12
+  804580:	49 c1 e4 15          	shl    $0x15,%r12
+  804584:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80458b:	49 09 c4             	or     %rax,%r12
+  80458e:	e9 23 ff ff ff       	jmp    8044b6 <foreach_shared_region+0x165>
+  804593:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804597:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80459e:	ff ff ff 
+  8045a1:	4c 21 e0             	and    %r12,%rax
+  8045a4:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8045a8:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8045af:	49 83 c4 01          	add    $0x1,%r12
+  8045b3:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045b7:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045be:	00 00 00 
+  8045c1:	49 21 d4             	and    %rdx,%r12
+  8045c4:	49 09 c4             	or     %rax,%r12
+  8045c7:	e9 5d fe ff ff       	jmp    804429 <foreach_shared_region+0xd8>
+  8045cc:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045d3:	00 ff ff 
+  8045d6:	4c 21 e0             	and    %r12,%rax
+  8045d9:	49 c1 ec 27          	shr    $0x27,%r12
+  8045dd:	49 83 c4 01          	add    $0x1,%r12
+  8045e1:	49 c1 e4 27          	shl    $0x27,%r12
+  8045e5:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045ec:	ff 00 00 
+  8045ef:	49 21 d4             	and    %rdx,%r12
+  8045f2:	49 09 c4             	or     %rax,%r12
+  8045f5:	41 83 ed 01          	sub    $0x1,%r13d
+  8045f9:	74 48                	je     804643 <foreach_shared_region+0x2f2>
+  8045fb:	4c 89 e0             	mov    %r12,%rax
+  8045fe:	48 c1 e8 27          	shr    $0x27,%rax
+  804602:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804609:	01 00 00 
+  80460c:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804610:	f6 c2 01             	test   $0x1,%dl
+  804613:	0f 85 a5 fd ff ff    	jne    8043be <foreach_shared_region+0x6d>
+  804619:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804620:	00 ff ff 
+  804623:	4c 21 e2             	and    %r12,%rdx
+  804626:	48 83 c0 01          	add    $0x1,%rax
+  80462a:	48 c1 e0 27          	shl    $0x27,%rax
+  80462e:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804635:	ff 00 00 
+  804638:	48 21 c8             	and    %rcx,%rax
+  80463b:	48 09 d0             	or     %rdx,%rax
+  80463e:	49 89 c4             	mov    %rax,%r12
+  804641:	eb b2                	jmp    8045f5 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804643:	4d 85 e4             	test   %r12,%r12
+  804646:	75 14                	jne    80465c <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464d:	48 83 c4 28          	add    $0x28,%rsp
+  804651:	5b                   	pop    %rbx
+  804652:	41 5c                	pop    %r12
+  804654:	41 5d                	pop    %r13
+  804656:	41 5e                	pop    %r14
+  804658:	41 5f                	pop    %r15
+  80465a:	5d                   	pop    %rbp
+  80465b:	c3                   	ret
+    assert(addr == 0);
+  80465c:	48 b9 1b 63 80 00 00 	movabs $0x80631b,%rcx
+  804663:	00 00 00 
+  804666:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80466d:	00 00 00 
+  804670:	be 67 00 00 00       	mov    $0x67,%esi
+  804675:	48 bf 10 63 80 00 00 	movabs $0x806310,%rdi
+  80467c:	00 00 00 
+  80467f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804684:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  80468b:	00 00 00 
+  80468e:	41 ff d0             	call   *%r8
+
+0000000000804691 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804691:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804698:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80469b:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8046a1:	eb 33                	jmp    8046d6 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046a3:	48 83 c0 20          	add    $0x20,%rax
+  8046a7:	4c 39 c0             	cmp    %r8,%rax
+  8046aa:	74 25                	je     8046d1 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8046ac:	48 8b 10             	mov    (%rax),%rdx
+  8046af:	48 85 d2             	test   %rdx,%rdx
+  8046b2:	74 ef                	je     8046a3 <mmap_place+0x12>
+  8046b4:	48 89 d1             	mov    %rdx,%rcx
+  8046b7:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046bb:	48 39 cf             	cmp    %rcx,%rdi
+  8046be:	73 e3                	jae    8046a3 <mmap_place+0x12>
+  8046c0:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046c4:	4c 39 ca             	cmp    %r9,%rdx
+  8046c7:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046cb:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046cf:	eb d2                	jmp    8046a3 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046d1:	45 84 d2             	test   %r10b,%r10b
+  8046d4:	74 12                	je     8046e8 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046d6:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046dd:	00 00 00 
+        moved = 0;
+  8046e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046e6:	eb c4                	jmp    8046ac <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046e8:	48 01 fe             	add    %rdi,%rsi
+  8046eb:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046f2:	00 00 00 
+  8046f5:	48 39 f0             	cmp    %rsi,%rax
+  8046f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fd:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804701:	c3                   	ret
+
+0000000000804702 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804702:	55                   	push   %rbp
+  804703:	48 89 e5             	mov    %rsp,%rbp
+  804706:	41 57                	push   %r15
+  804708:	41 56                	push   %r14
+  80470a:	41 55                	push   %r13
+  80470c:	41 54                	push   %r12
+  80470e:	53                   	push   %rbx
+  80470f:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804713:	48 8b 1f             	mov    (%rdi),%rbx
+  804716:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80471d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804724:	00 00 00 
+  804727:	ba 00 00 00 00       	mov    $0x0,%edx
+  80472c:	eb 12                	jmp    804740 <mmap_pgfault+0x3e>
+  80472e:	48 83 c2 01          	add    $0x1,%rdx
+  804732:	48 83 c0 20          	add    $0x20,%rax
+  804736:	48 83 fa 20          	cmp    $0x20,%rdx
+  80473a:	0f 84 04 01 00 00    	je     804844 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804740:	48 8b 08             	mov    (%rax),%rcx
+  804743:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804747:	48 39 de             	cmp    %rbx,%rsi
+  80474a:	73 e2                	jae    80472e <mmap_pgfault+0x2c>
+  80474c:	48 03 48 08          	add    0x8(%rax),%rcx
+  804750:	48 39 cb             	cmp    %rcx,%rbx
+  804753:	73 d9                	jae    80472e <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804755:	48 c1 e2 05          	shl    $0x5,%rdx
+  804759:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804760:	00 00 00 
+  804763:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804767:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80476b:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80476f:	f6 c2 01             	test   $0x1,%dl
+  804772:	0f 84 e0 00 00 00    	je     804858 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80477d:	f6 c2 02             	test   $0x2,%dl
+  804780:	0f 84 c3 00 00 00    	je     804849 <mmap_pgfault+0x147>
+  804786:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80478d:	ff ff ff 
+  804790:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804794:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80479b:	00 00 00 
+  80479e:	48 39 ca             	cmp    %rcx,%rdx
+  8047a1:	0f 85 a2 00 00 00    	jne    804849 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8047a7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8047ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047b1:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047b8:	00 00 00 
+  8047bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047c0:	48 b8 51 27 80 00 00 	movabs $0x802751,%rax
+  8047c7:	00 00 00 
+  8047ca:	ff d0                	call   *%rax
+  8047cc:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047d3:	85 d2                	test   %edx,%edx
+  8047d5:	78 72                	js     804849 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047dc:	48 89 de             	mov    %rbx,%rsi
+  8047df:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047e6:	00 00 00 
+  8047e9:	4c 89 e7             	mov    %r12,%rdi
+  8047ec:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  8047f3:	00 00 00 
+  8047f6:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047f8:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047fe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804804:	48 89 d9             	mov    %rbx,%rcx
+  804807:	ba 00 00 00 00       	mov    $0x0,%edx
+  80480c:	4c 89 e6             	mov    %r12,%rsi
+  80480f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804814:	48 b8 be 27 80 00 00 	movabs $0x8027be,%rax
+  80481b:	00 00 00 
+  80481e:	ff d0                	call   *%rax
+  804820:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804822:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804827:	4c 89 e6             	mov    %r12,%rsi
+  80482a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80482f:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  804836:	00 00 00 
+  804839:	ff d0                	call   *%rax
+    return res >= 0;
+  80483b:	89 d8                	mov    %ebx,%eax
+  80483d:	f7 d0                	not    %eax
+  80483f:	c1 e8 1f             	shr    $0x1f,%eax
+  804842:	eb 05                	jmp    804849 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804844:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804849:	48 83 c4 18          	add    $0x18,%rsp
+  80484d:	5b                   	pop    %rbx
+  80484e:	41 5c                	pop    %r12
+  804850:	41 5d                	pop    %r13
+  804852:	41 5e                	pop    %r14
+  804854:	41 5f                	pop    %r15
+  804856:	5d                   	pop    %rbp
+  804857:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804858:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80485c:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804860:	4c 03 30             	add    (%rax),%r14
+  804863:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80486a:	49 39 c6             	cmp    %rax,%r14
+  80486d:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804871:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804878:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80487e:	49 bf 3c 43 80 00 00 	movabs $0x80433c,%r15
+  804885:	00 00 00 
+  804888:	4d 39 f4             	cmp    %r14,%r12
+  80488b:	73 1d                	jae    8048aa <mmap_pgfault+0x1a8>
+  80488d:	4c 89 e7             	mov    %r12,%rdi
+  804890:	41 ff d7             	call   *%r15
+  804893:	84 c0                	test   %al,%al
+  804895:	75 13                	jne    8048aa <mmap_pgfault+0x1a8>
+  804897:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80489e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8048a5:	4d 39 f4             	cmp    %r14,%r12
+  8048a8:	72 e3                	jb     80488d <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048aa:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8048b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048b4:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048b8:	74 2a                	je     8048e4 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048be:	89 de                	mov    %ebx,%esi
+  8048c0:	2b 30                	sub    (%rax),%esi
+  8048c2:	03 70 1c             	add    0x1c(%rax),%esi
+  8048c5:	8b 78 18             	mov    0x18(%rax),%edi
+  8048c8:	4c 89 e9             	mov    %r13,%rcx
+  8048cb:	48 89 da             	mov    %rbx,%rdx
+  8048ce:	48 b8 9a 3a 80 00 00 	movabs $0x803a9a,%rax
+  8048d5:	00 00 00 
+  8048d8:	ff d0                	call   *%rax
+    return res > 0;
+  8048da:	85 c0                	test   %eax,%eax
+  8048dc:	0f 9f c0             	setg   %al
+  8048df:	e9 65 ff ff ff       	jmp    804849 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048e4:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048e8:	eb d0                	jmp    8048ba <mmap_pgfault+0x1b8>
+
+00000000008048ea <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048ea:	55                   	push   %rbp
+  8048eb:	48 89 e5             	mov    %rsp,%rbp
+  8048ee:	41 57                	push   %r15
+  8048f0:	41 56                	push   %r14
+  8048f2:	41 55                	push   %r13
+  8048f4:	41 54                	push   %r12
+  8048f6:	53                   	push   %rbx
+  8048f7:	48 83 ec 28          	sub    $0x28,%rsp
+  8048fb:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048ff:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804902:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804909:	ff ff ff 
+  80490c:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804910:	b8 00 00 00 00       	mov    $0x0,%eax
+  804915:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80491c:	00 00 00 
+  80491f:	48 39 ca             	cmp    %rcx,%rdx
+  804922:	0f 85 e5 00 00 00    	jne    804a0d <mmap_writeback+0x123>
+  804928:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80492b:	4c 39 ee             	cmp    %r13,%rsi
+  80492e:	0f 83 e8 00 00 00    	jae    804a1c <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804934:	49 be 3c 43 80 00 00 	movabs $0x80433c,%r14
+  80493b:	00 00 00 
+  80493e:	49 bf 23 43 80 00 00 	movabs $0x804323,%r15
+  804945:	00 00 00 
+  804948:	eb 10                	jmp    80495a <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80494a:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804951:	4d 39 ec             	cmp    %r13,%r12
+  804954:	0f 83 ae 00 00 00    	jae    804a08 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80495a:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80495e:	4c 89 e7             	mov    %r12,%rdi
+  804961:	41 ff d6             	call   *%r14
+  804964:	84 c0                	test   %al,%al
+  804966:	74 e2                	je     80494a <mmap_writeback+0x60>
+  804968:	4c 89 e7             	mov    %r12,%rdi
+  80496b:	41 ff d7             	call   *%r15
+  80496e:	84 c0                	test   %al,%al
+  804970:	74 d8                	je     80494a <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804972:	4c 89 e3             	mov    %r12,%rbx
+  804975:	4d 39 ec             	cmp    %r13,%r12
+  804978:	73 20                	jae    80499a <mmap_writeback+0xb0>
+  80497a:	48 89 df             	mov    %rbx,%rdi
+  80497d:	41 ff d6             	call   *%r14
+  804980:	84 c0                	test   %al,%al
+  804982:	74 16                	je     80499a <mmap_writeback+0xb0>
+  804984:	48 89 df             	mov    %rbx,%rdi
+  804987:	41 ff d7             	call   *%r15
+  80498a:	84 c0                	test   %al,%al
+  80498c:	74 0c                	je     80499a <mmap_writeback+0xb0>
+  80498e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804995:	4c 39 eb             	cmp    %r13,%rbx
+  804998:	72 e0                	jb     80497a <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80499a:	48 89 d9             	mov    %rbx,%rcx
+  80499d:	4c 29 e1             	sub    %r12,%rcx
+  8049a0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8049a4:	44 89 e6             	mov    %r12d,%esi
+  8049a7:	2b 30                	sub    (%rax),%esi
+  8049a9:	49 89 c4             	mov    %rax,%r12
+  8049ac:	03 70 1c             	add    0x1c(%rax),%esi
+  8049af:	8b 78 18             	mov    0x18(%rax),%edi
+  8049b2:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049b6:	48 89 ca             	mov    %rcx,%rdx
+  8049b9:	48 b8 23 3b 80 00 00 	movabs $0x803b23,%rax
+  8049c0:	00 00 00 
+  8049c3:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049c5:	85 c0                	test   %eax,%eax
+  8049c7:	78 44                	js     804a0d <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049c9:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049ce:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049d1:	41 89 c1             	mov    %eax,%r9d
+  8049d4:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049db:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049df:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049e8:	48 89 ce             	mov    %rcx,%rsi
+  8049eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049f0:	48 b8 be 27 80 00 00 	movabs $0x8027be,%rax
+  8049f7:	00 00 00 
+  8049fa:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049fc:	85 c0                	test   %eax,%eax
+  8049fe:	78 0d                	js     804a0d <mmap_writeback+0x123>
+  804a00:	49 89 dc             	mov    %rbx,%r12
+  804a03:	e9 49 ff ff ff       	jmp    804951 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804a08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a0d:	48 83 c4 28          	add    $0x28,%rsp
+  804a11:	5b                   	pop    %rbx
+  804a12:	41 5c                	pop    %r12
+  804a14:	41 5d                	pop    %r13
+  804a16:	41 5e                	pop    %r14
+  804a18:	41 5f                	pop    %r15
+  804a1a:	5d                   	pop    %rbp
+  804a1b:	c3                   	ret
+    return 0;
+  804a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a21:	eb ea                	jmp    804a0d <mmap_writeback+0x123>
+
+0000000000804a23 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a23:	55                   	push   %rbp
+  804a24:	48 89 e5             	mov    %rsp,%rbp
+  804a27:	41 57                	push   %r15
+  804a29:	41 56                	push   %r14
+  804a2b:	41 55                	push   %r13
+  804a2d:	41 54                	push   %r12
+  804a2f:	53                   	push   %rbx
+  804a30:	48 83 ec 38          	sub    $0x38,%rsp
+  804a34:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a38:	48 85 f6             	test   %rsi,%rsi
+  804a3b:	0f 84 0c 02 00 00    	je     804c4d <mmap+0x22a>
+  804a41:	49 89 ff             	mov    %rdi,%r15
+  804a44:	49 89 f4             	mov    %rsi,%r12
+  804a47:	41 89 d5             	mov    %edx,%r13d
+  804a4a:	41 89 ce             	mov    %ecx,%r14d
+  804a4d:	44 89 cb             	mov    %r9d,%ebx
+  804a50:	45 85 c9             	test   %r9d,%r9d
+  804a53:	0f 88 f4 01 00 00    	js     804c4d <mmap+0x22a>
+  804a59:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a60:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a67:	0f 85 e7 01 00 00    	jne    804c54 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a6d:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a70:	83 fa 04             	cmp    $0x4,%edx
+  804a73:	0f 85 db 01 00 00    	jne    804c54 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a79:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a7c:	83 fa 01             	cmp    $0x1,%edx
+  804a7f:	0f 87 cf 01 00 00    	ja     804c54 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a85:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a89:	44 89 c7             	mov    %r8d,%edi
+  804a8c:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  804a93:	00 00 00 
+  804a96:	ff d0                	call   *%rax
+  804a98:	89 c2                	mov    %eax,%edx
+  804a9a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804aa1:	85 d2                	test   %edx,%edx
+  804aa3:	0f 88 ab 01 00 00    	js     804c54 <mmap+0x231>
+  804aa9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804aad:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804ab4:	00 00 00 
+  804ab7:	8b 09                	mov    (%rcx),%ecx
+  804ab9:	39 0a                	cmp    %ecx,(%rdx)
+  804abb:	0f 85 93 01 00 00    	jne    804c54 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804ac1:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ac4:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ac7:	83 fa 01             	cmp    $0x1,%edx
+  804aca:	0f 84 84 01 00 00    	je     804c54 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ad0:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ad4:	74 42                	je     804b18 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ad6:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804add:	4c 89 e6             	mov    %r12,%rsi
+  804ae0:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ae7:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804aeb:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804aef:	4d 85 ff             	test   %r15,%r15
+  804af2:	74 67                	je     804b5b <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804af4:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804afb:	75 0f                	jne    804b0c <mmap+0xe9>
+  804afd:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804b04:	00 00 00 
+  804b07:	49 39 c7             	cmp    %rax,%r15
+  804b0a:	77 1b                	ja     804b27 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b0c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b13:	e9 3c 01 00 00       	jmp    804c54 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b18:	41 f6 c5 02          	test   $0x2,%r13b
+  804b1c:	74 b8                	je     804ad6 <mmap+0xb3>
+  804b1e:	85 d2                	test   %edx,%edx
+  804b20:	75 b4                	jne    804ad6 <mmap+0xb3>
+  804b22:	e9 2d 01 00 00       	jmp    804c54 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b27:	4c 89 ff             	mov    %r15,%rdi
+  804b2a:	48 b8 91 46 80 00 00 	movabs $0x804691,%rax
+  804b31:	00 00 00 
+  804b34:	ff d0                	call   *%rax
+  804b36:	48 89 c2             	mov    %rax,%rdx
+  804b39:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b40:	49 39 d7             	cmp    %rdx,%r15
+  804b43:	0f 85 0b 01 00 00    	jne    804c54 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b49:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b50:	00 00 00 
+  804b53:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b59:	eb 44                	jmp    804b9f <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b5b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b5f:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b66:	00 00 00 
+  804b69:	48 b8 91 46 80 00 00 	movabs $0x804691,%rax
+  804b70:	00 00 00 
+  804b73:	ff d0                	call   *%rax
+  804b75:	48 89 c7             	mov    %rax,%rdi
+  804b78:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b7c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b83:	48 85 ff             	test   %rdi,%rdi
+  804b86:	75 c1                	jne    804b49 <mmap+0x126>
+  804b88:	e9 c7 00 00 00       	jmp    804c54 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b8d:	49 83 c4 01          	add    $0x1,%r12
+  804b91:	48 83 c0 20          	add    $0x20,%rax
+  804b95:	49 83 fc 20          	cmp    $0x20,%r12
+  804b99:	0f 84 a5 00 00 00    	je     804c44 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b9f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804ba3:	75 e8                	jne    804b8d <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804ba5:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804ba9:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  804bb0:	00 00 00 
+  804bb3:	ff d0                	call   *%rax
+  804bb5:	89 c2                	mov    %eax,%edx
+  804bb7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bbe:	85 d2                	test   %edx,%edx
+  804bc0:	0f 88 8e 00 00 00    	js     804c54 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bc6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bca:	48 b8 af 2d 80 00 00 	movabs $0x802daf,%rax
+  804bd1:	00 00 00 
+  804bd4:	ff d0                	call   *%rax
+  804bd6:	89 c6                	mov    %eax,%esi
+  804bd8:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bdb:	48 b8 fd 2f 80 00 00 	movabs $0x802ffd,%rax
+  804be2:	00 00 00 
+  804be5:	ff d0                	call   *%rax
+  804be7:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bea:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bf1:	45 85 ff             	test   %r15d,%r15d
+  804bf4:	78 5e                	js     804c54 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bf6:	49 c1 e4 05          	shl    $0x5,%r12
+  804bfa:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c01:	00 00 00 
+  804c04:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804c07:	48 bf 02 47 80 00 00 	movabs $0x804702,%rdi
+  804c0e:	00 00 00 
+  804c11:	48 b8 d0 51 80 00 00 	movabs $0x8051d0,%rax
+  804c18:	00 00 00 
+  804c1b:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c1d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c21:	49 89 04 24          	mov    %rax,(%r12)
+  804c25:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c29:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c2e:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c33:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c38:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c3d:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c42:	eb 10                	jmp    804c54 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c44:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c4b:	eb 07                	jmp    804c54 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c4d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c54:	48 83 c4 38          	add    $0x38,%rsp
+  804c58:	5b                   	pop    %rbx
+  804c59:	41 5c                	pop    %r12
+  804c5b:	41 5d                	pop    %r13
+  804c5d:	41 5e                	pop    %r14
+  804c5f:	41 5f                	pop    %r15
+  804c61:	5d                   	pop    %rbp
+  804c62:	c3                   	ret
+
+0000000000804c63 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c63:	55                   	push   %rbp
+  804c64:	48 89 e5             	mov    %rsp,%rbp
+  804c67:	41 57                	push   %r15
+  804c69:	41 56                	push   %r14
+  804c6b:	41 55                	push   %r13
+  804c6d:	41 54                	push   %r12
+  804c6f:	53                   	push   %rbx
+  804c70:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c74:	49 89 fe             	mov    %rdi,%r14
+  804c77:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c7e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c85:	00 
+  804c86:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c8d:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c94:	00 00 00 
+  804c97:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c9e:	49 bf ea 48 80 00 00 	movabs $0x8048ea,%r15
+  804ca5:	00 00 00 
+  804ca8:	eb 09                	jmp    804cb3 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804caa:	48 83 c3 20          	add    $0x20,%rbx
+  804cae:	4c 39 eb             	cmp    %r13,%rbx
+  804cb1:	74 33                	je     804ce6 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804cb3:	48 89 df             	mov    %rbx,%rdi
+  804cb6:	48 8b 33             	mov    (%rbx),%rsi
+  804cb9:	4c 39 e6             	cmp    %r12,%rsi
+  804cbc:	73 ec                	jae    804caa <msync+0x47>
+  804cbe:	48 85 f6             	test   %rsi,%rsi
+  804cc1:	74 e7                	je     804caa <msync+0x47>
+  804cc3:	48 89 f2             	mov    %rsi,%rdx
+  804cc6:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cca:	49 39 d6             	cmp    %rdx,%r14
+  804ccd:	73 db                	jae    804caa <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ccf:	4c 39 e2             	cmp    %r12,%rdx
+  804cd2:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cd6:	4c 39 f6             	cmp    %r14,%rsi
+  804cd9:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cdd:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804ce0:	85 c0                	test   %eax,%eax
+  804ce2:	79 c6                	jns    804caa <msync+0x47>
+  804ce4:	eb 05                	jmp    804ceb <msync+0x88>
+    }
+
+    return 0;
+  804ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ceb:	48 83 c4 08          	add    $0x8,%rsp
+  804cef:	5b                   	pop    %rbx
+  804cf0:	41 5c                	pop    %r12
+  804cf2:	41 5d                	pop    %r13
+  804cf4:	41 5e                	pop    %r14
+  804cf6:	41 5f                	pop    %r15
+  804cf8:	5d                   	pop    %rbp
+  804cf9:	c3                   	ret
+
+0000000000804cfa <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cfa:	55                   	push   %rbp
+  804cfb:	48 89 e5             	mov    %rsp,%rbp
+  804cfe:	41 57                	push   %r15
+  804d00:	41 56                	push   %r14
+  804d02:	41 55                	push   %r13
+  804d04:	41 54                	push   %r12
+  804d06:	53                   	push   %rbx
+  804d07:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804d0b:	49 89 ff             	mov    %rdi,%r15
+  804d0e:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d15:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d1c:	00 
+  804d1d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d24:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d2b:	00 00 00 
+  804d2e:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d35:	48 89 d8             	mov    %rbx,%rax
+  804d38:	eb 09                	jmp    804d43 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d3a:	48 83 c0 20          	add    $0x20,%rax
+  804d3e:	4c 39 f0             	cmp    %r14,%rax
+  804d41:	74 40                	je     804d83 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d43:	48 8b 10             	mov    (%rax),%rdx
+  804d46:	4c 39 e2             	cmp    %r12,%rdx
+  804d49:	73 ef                	jae    804d3a <munmap+0x40>
+  804d4b:	48 85 d2             	test   %rdx,%rdx
+  804d4e:	74 ea                	je     804d3a <munmap+0x40>
+  804d50:	48 89 d7             	mov    %rdx,%rdi
+  804d53:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d57:	49 39 ff             	cmp    %rdi,%r15
+  804d5a:	73 de                	jae    804d3a <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d5c:	49 39 fc             	cmp    %rdi,%r12
+  804d5f:	72 05                	jb     804d66 <munmap+0x6c>
+  804d61:	4c 39 fa             	cmp    %r15,%rdx
+  804d64:	73 d4                	jae    804d3a <munmap+0x40>
+  804d66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d6b:	48 83 c4 08          	add    $0x8,%rsp
+  804d6f:	5b                   	pop    %rbx
+  804d70:	41 5c                	pop    %r12
+  804d72:	41 5d                	pop    %r13
+  804d74:	41 5e                	pop    %r14
+  804d76:	41 5f                	pop    %r15
+  804d78:	5d                   	pop    %rbp
+  804d79:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d7a:	48 83 c3 20          	add    $0x20,%rbx
+  804d7e:	4c 39 f3             	cmp    %r14,%rbx
+  804d81:	74 5c                	je     804ddf <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d83:	48 8b 33             	mov    (%rbx),%rsi
+  804d86:	4c 39 e6             	cmp    %r12,%rsi
+  804d89:	73 ef                	jae    804d7a <munmap+0x80>
+  804d8b:	48 85 f6             	test   %rsi,%rsi
+  804d8e:	74 ea                	je     804d7a <munmap+0x80>
+  804d90:	48 89 f2             	mov    %rsi,%rdx
+  804d93:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d97:	49 39 d7             	cmp    %rdx,%r15
+  804d9a:	73 de                	jae    804d7a <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d9c:	48 89 df             	mov    %rbx,%rdi
+  804d9f:	48 b8 ea 48 80 00 00 	movabs $0x8048ea,%rax
+  804da6:	00 00 00 
+  804da9:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804dab:	85 c0                	test   %eax,%eax
+  804dad:	78 bc                	js     804d6b <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804daf:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804db3:	48 8b 33             	mov    (%rbx),%rsi
+  804db6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dbb:	48 b8 29 28 80 00 00 	movabs $0x802829,%rax
+  804dc2:	00 00 00 
+  804dc5:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804dc7:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804dca:	48 b8 a2 2f 80 00 00 	movabs $0x802fa2,%rax
+  804dd1:	00 00 00 
+  804dd4:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dd6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804ddd:	eb 9b                	jmp    804d7a <munmap+0x80>
+    return 0;
+  804ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de4:	eb 85                	jmp    804d6b <munmap+0x71>
+
+0000000000804de6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804deb:	c3                   	ret
+
+0000000000804dec <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dec:	55                   	push   %rbp
+  804ded:	48 89 e5             	mov    %rsp,%rbp
+  804df0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804df3:	48 be 25 63 80 00 00 	movabs $0x806325,%rsi
+  804dfa:	00 00 00 
+  804dfd:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  804e04:	00 00 00 
+  804e07:	ff d0                	call   *%rax
+    return 0;
+}
+  804e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e0e:	5d                   	pop    %rbp
+  804e0f:	c3                   	ret
+
+0000000000804e10 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e10:	55                   	push   %rbp
+  804e11:	48 89 e5             	mov    %rsp,%rbp
+  804e14:	41 57                	push   %r15
+  804e16:	41 56                	push   %r14
+  804e18:	41 55                	push   %r13
+  804e1a:	41 54                	push   %r12
+  804e1c:	53                   	push   %rbx
+  804e1d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e24:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e2b:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e32:	00 00 00 00 
+  804e36:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e3d:	00 00 00 00 
+  804e41:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e48:	00 00 00 00 
+  804e4c:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e53:	00 00 00 00 
+  804e57:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e5e:	00 00 00 00 
+  804e62:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e69:	00 00 00 00 
+  804e6d:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e74:	00 
+  804e75:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e7c:	00 
+  804e7d:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e84:	00 
+  804e85:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e8c:	00 
+  804e8d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e94:	00 
+  804e95:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e9c:	00 
+  804e9d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804ea4:	00 
+  804ea5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804eac:	00 
+  804ead:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804eb4:	00 
+  804eb5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804ebc:	00 
+    for (res = 0; res < n; res += inc) {
+  804ebd:	48 85 d2             	test   %rdx,%rdx
+  804ec0:	74 7a                	je     804f3c <devcons_write+0x12c>
+  804ec2:	49 89 d6             	mov    %rdx,%r14
+  804ec5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ecb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ed0:	49 bf 3c 23 80 00 00 	movabs $0x80233c,%r15
+  804ed7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804eda:	4c 89 f3             	mov    %r14,%rbx
+  804edd:	48 29 f3             	sub    %rsi,%rbx
+  804ee0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ee5:	48 39 c3             	cmp    %rax,%rbx
+  804ee8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804eec:	4c 63 eb             	movslq %ebx,%r13
+  804eef:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ef6:	48 01 c6             	add    %rax,%rsi
+  804ef9:	4c 89 ea             	mov    %r13,%rdx
+  804efc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f03:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804f06:	4c 89 ee             	mov    %r13,%rsi
+  804f09:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f10:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  804f17:	00 00 00 
+  804f1a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f1c:	41 01 dc             	add    %ebx,%r12d
+  804f1f:	49 63 f4             	movslq %r12d,%rsi
+  804f22:	4c 39 f6             	cmp    %r14,%rsi
+  804f25:	72 b3                	jb     804eda <devcons_write+0xca>
+    return res;
+  804f27:	49 63 c4             	movslq %r12d,%rax
+}
+  804f2a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f31:	5b                   	pop    %rbx
+  804f32:	41 5c                	pop    %r12
+  804f34:	41 5d                	pop    %r13
+  804f36:	41 5e                	pop    %r14
+  804f38:	41 5f                	pop    %r15
+  804f3a:	5d                   	pop    %rbp
+  804f3b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f3c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f42:	eb e3                	jmp    804f27 <devcons_write+0x117>
+
+0000000000804f44 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f44:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f47:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f4c:	48 85 c0             	test   %rax,%rax
+  804f4f:	74 55                	je     804fa6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f51:	55                   	push   %rbp
+  804f52:	48 89 e5             	mov    %rsp,%rbp
+  804f55:	41 55                	push   %r13
+  804f57:	41 54                	push   %r12
+  804f59:	53                   	push   %rbx
+  804f5a:	48 83 ec 08          	sub    $0x8,%rsp
+  804f5e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f61:	48 bb 9c 25 80 00 00 	movabs $0x80259c,%rbx
+  804f68:	00 00 00 
+  804f6b:	49 bc b0 26 80 00 00 	movabs $0x8026b0,%r12
+  804f72:	00 00 00 
+  804f75:	eb 03                	jmp    804f7a <devcons_read+0x36>
+  804f77:	41 ff d4             	call   *%r12
+  804f7a:	ff d3                	call   *%rbx
+  804f7c:	85 c0                	test   %eax,%eax
+  804f7e:	74 f7                	je     804f77 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f80:	48 63 d0             	movslq %eax,%rdx
+  804f83:	78 13                	js     804f98 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f85:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f8a:	83 f8 04             	cmp    $0x4,%eax
+  804f8d:	74 09                	je     804f98 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f8f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f93:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f98:	48 89 d0             	mov    %rdx,%rax
+  804f9b:	48 83 c4 08          	add    $0x8,%rsp
+  804f9f:	5b                   	pop    %rbx
+  804fa0:	41 5c                	pop    %r12
+  804fa2:	41 5d                	pop    %r13
+  804fa4:	5d                   	pop    %rbp
+  804fa5:	c3                   	ret
+  804fa6:	48 89 d0             	mov    %rdx,%rax
+  804fa9:	c3                   	ret
+
+0000000000804faa <cputchar>:
+cputchar(int ch) {
+  804faa:	55                   	push   %rbp
+  804fab:	48 89 e5             	mov    %rsp,%rbp
+  804fae:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804fb2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fb6:	be 01 00 00 00       	mov    $0x1,%esi
+  804fbb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fbf:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  804fc6:	00 00 00 
+  804fc9:	ff d0                	call   *%rax
+}
+  804fcb:	c9                   	leave
+  804fcc:	c3                   	ret
+
+0000000000804fcd <getchar>:
+getchar(void) {
+  804fcd:	55                   	push   %rbp
+  804fce:	48 89 e5             	mov    %rsp,%rbp
+  804fd1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fd5:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fda:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fde:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fe3:	48 b8 20 31 80 00 00 	movabs $0x803120,%rax
+  804fea:	00 00 00 
+  804fed:	ff d0                	call   *%rax
+  804fef:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804ff1:	85 c0                	test   %eax,%eax
+  804ff3:	78 06                	js     804ffb <getchar+0x2e>
+  804ff5:	74 08                	je     804fff <getchar+0x32>
+  804ff7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804ffb:	89 d0                	mov    %edx,%eax
+  804ffd:	c9                   	leave
+  804ffe:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fff:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805004:	eb f5                	jmp    804ffb <getchar+0x2e>
+
+0000000000805006 <iscons>:
+iscons(int fdnum) {
+  805006:	55                   	push   %rbp
+  805007:	48 89 e5             	mov    %rsp,%rbp
+  80500a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80500e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805012:	48 b8 3d 2e 80 00 00 	movabs $0x802e3d,%rax
+  805019:	00 00 00 
+  80501c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80501e:	85 c0                	test   %eax,%eax
+  805020:	78 18                	js     80503a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805022:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805026:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80502d:	00 00 00 
+  805030:	8b 00                	mov    (%rax),%eax
+  805032:	39 02                	cmp    %eax,(%rdx)
+  805034:	0f 94 c0             	sete   %al
+  805037:	0f b6 c0             	movzbl %al,%eax
+}
+  80503a:	c9                   	leave
+  80503b:	c3                   	ret
+
+000000000080503c <opencons>:
+opencons(void) {
+  80503c:	55                   	push   %rbp
+  80503d:	48 89 e5             	mov    %rsp,%rbp
+  805040:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805044:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805048:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  80504f:	00 00 00 
+  805052:	ff d0                	call   *%rax
+  805054:	85 c0                	test   %eax,%eax
+  805056:	78 49                	js     8050a1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805058:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80505d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805062:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80506b:	48 b8 51 27 80 00 00 	movabs $0x802751,%rax
+  805072:	00 00 00 
+  805075:	ff d0                	call   *%rax
+  805077:	85 c0                	test   %eax,%eax
+  805079:	78 26                	js     8050a1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80507b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80507f:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805086:	00 00 
+  805088:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80508a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80508e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805095:	48 b8 af 2d 80 00 00 	movabs $0x802daf,%rax
+  80509c:	00 00 00 
+  80509f:	ff d0                	call   *%rax
+}
+  8050a1:	c9                   	leave
+  8050a2:	c3                   	ret
+
+00000000008050a3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8050a3:	55                   	push   %rbp
+  8050a4:	48 89 e5             	mov    %rsp,%rbp
+  8050a7:	41 56                	push   %r14
+  8050a9:	41 55                	push   %r13
+  8050ab:	41 54                	push   %r12
+  8050ad:	53                   	push   %rbx
+  8050ae:	48 83 ec 50          	sub    $0x50,%rsp
+  8050b2:	49 89 fc             	mov    %rdi,%r12
+  8050b5:	41 89 f5             	mov    %esi,%r13d
+  8050b8:	48 89 d3             	mov    %rdx,%rbx
+  8050bb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050bf:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050c3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050c7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050ce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050d2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050d6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050da:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050de:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050e5:	00 00 00 
+  8050e8:	4c 8b 30             	mov    (%rax),%r14
+  8050eb:	48 b8 79 26 80 00 00 	movabs $0x802679,%rax
+  8050f2:	00 00 00 
+  8050f5:	ff d0                	call   *%rax
+  8050f7:	89 c6                	mov    %eax,%esi
+  8050f9:	45 89 e8             	mov    %r13d,%r8d
+  8050fc:	4c 89 e1             	mov    %r12,%rcx
+  8050ff:	4c 89 f2             	mov    %r14,%rdx
+  805102:	48 bf 38 63 80 00 00 	movabs $0x806338,%rdi
+  805109:	00 00 00 
+  80510c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805111:	49 bc b5 16 80 00 00 	movabs $0x8016b5,%r12
+  805118:	00 00 00 
+  80511b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80511e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805122:	48 89 df             	mov    %rbx,%rdi
+  805125:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  80512c:	00 00 00 
+  80512f:	ff d0                	call   *%rax
+    cprintf("\n");
+  805131:	48 bf 51 5c 80 00 00 	movabs $0x805c51,%rdi
+  805138:	00 00 00 
+  80513b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805140:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805143:	cc                   	int3
+  805144:	eb fd                	jmp    805143 <_panic+0xa0>
+
+0000000000805146 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805146:	55                   	push   %rbp
+  805147:	48 89 e5             	mov    %rsp,%rbp
+  80514a:	41 56                	push   %r14
+  80514c:	41 55                	push   %r13
+  80514e:	41 54                	push   %r12
+  805150:	53                   	push   %rbx
+  805151:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805154:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80515b:	00 00 00 
+  80515e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805162:	74 27                	je     80518b <_handle_vectored_pagefault+0x45>
+  805164:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805169:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805170:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805173:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805176:	4c 89 e7             	mov    %r12,%rdi
+  805179:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80517e:	84 c0                	test   %al,%al
+  805180:	75 45                	jne    8051c7 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805182:	48 83 c3 01          	add    $0x1,%rbx
+  805186:	49 3b 1e             	cmp    (%r14),%rbx
+  805189:	72 eb                	jb     805176 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80518b:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805192:	00 
+  805193:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805198:	4d 8b 04 24          	mov    (%r12),%r8
+  80519c:	48 ba 60 63 80 00 00 	movabs $0x806360,%rdx
+  8051a3:	00 00 00 
+  8051a6:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8051ab:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  8051b2:	00 00 00 
+  8051b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ba:	49 ba a3 50 80 00 00 	movabs $0x8050a3,%r10
+  8051c1:	00 00 00 
+  8051c4:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051c7:	5b                   	pop    %rbx
+  8051c8:	41 5c                	pop    %r12
+  8051ca:	41 5d                	pop    %r13
+  8051cc:	41 5e                	pop    %r14
+  8051ce:	5d                   	pop    %rbp
+  8051cf:	c3                   	ret
+
+00000000008051d0 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051d0:	55                   	push   %rbp
+  8051d1:	48 89 e5             	mov    %rsp,%rbp
+  8051d4:	53                   	push   %rbx
+  8051d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8051d9:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051dc:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051e1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051e8:	00 00 00 
+  8051eb:	80 38 00             	cmpb   $0x0,(%rax)
+  8051ee:	74 68                	je     805258 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f0:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051f7:	00 00 00 
+  8051fa:	48 8b 08             	mov    (%rax),%rcx
+  8051fd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805202:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805209:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80520c:	48 85 c9             	test   %rcx,%rcx
+  80520f:	0f 84 e0 00 00 00    	je     8052f5 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805215:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805219:	0f 84 c9 00 00 00    	je     8052e8 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80521f:	48 83 c2 01          	add    $0x1,%rdx
+  805223:	48 39 ca             	cmp    %rcx,%rdx
+  805226:	75 ed                	jne    805215 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805228:	48 83 f9 08          	cmp    $0x8,%rcx
+  80522c:	0f 84 84 00 00 00    	je     8052b6 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805232:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805236:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80523d:	00 00 00 
+  805240:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805247:	00 00 00 
+  80524a:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80524e:	85 f6                	test   %esi,%esi
+  805250:	0f 89 97 00 00 00    	jns    8052ed <add_pgfault_handler+0x11d>
+  805256:	eb 63                	jmp    8052bb <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805258:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80525d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805262:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805269:	00 00 00 
+  80526c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805271:	48 b8 51 27 80 00 00 	movabs $0x802751,%rax
+  805278:	00 00 00 
+  80527b:	ff d0                	call   *%rax
+  80527d:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80527f:	85 c0                	test   %eax,%eax
+  805281:	78 38                	js     8052bb <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805283:	48 be d1 53 80 00 00 	movabs $0x8053d1,%rsi
+  80528a:	00 00 00 
+  80528d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805292:	48 b8 74 29 80 00 00 	movabs $0x802974,%rax
+  805299:	00 00 00 
+  80529c:	ff d0                	call   *%rax
+  80529e:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8052a0:	85 c0                	test   %eax,%eax
+  8052a2:	78 17                	js     8052bb <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8052a4:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052ab:	00 00 00 
+  8052ae:	c6 00 01             	movb   $0x1,(%rax)
+  8052b1:	e9 3a ff ff ff       	jmp    8051f0 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052b6:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052bb:	89 f1                	mov    %esi,%ecx
+  8052bd:	48 ba 9e 63 80 00 00 	movabs $0x80639e,%rdx
+  8052c4:	00 00 00 
+  8052c7:	be 42 00 00 00       	mov    $0x42,%esi
+  8052cc:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  8052d3:	00 00 00 
+  8052d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052db:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  8052e2:	00 00 00 
+  8052e5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052e8:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052ed:	89 f0                	mov    %esi,%eax
+  8052ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052f3:	c9                   	leave
+  8052f4:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052f5:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052fc:	00 00 00 
+  8052ff:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805306:	48 89 d8             	mov    %rbx,%rax
+  805309:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805310:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805313:	eb d8                	jmp    8052ed <add_pgfault_handler+0x11d>
+
+0000000000805315 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805315:	55                   	push   %rbp
+  805316:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805319:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805320:	00 00 00 
+  805323:	80 38 00             	cmpb   $0x0,(%rax)
+  805326:	74 33                	je     80535b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805328:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80532f:	00 00 00 
+  805332:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805337:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80533e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805341:	48 85 c0             	test   %rax,%rax
+  805344:	0f 84 85 00 00 00    	je     8053cf <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80534a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80534e:	74 40                	je     805390 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805350:	48 83 c1 01          	add    $0x1,%rcx
+  805354:	48 39 c1             	cmp    %rax,%rcx
+  805357:	75 f1                	jne    80534a <remove_pgfault_handler+0x35>
+  805359:	eb 74                	jmp    8053cf <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80535b:	48 b9 b6 63 80 00 00 	movabs $0x8063b6,%rcx
+  805362:	00 00 00 
+  805365:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80536c:	00 00 00 
+  80536f:	be 48 00 00 00       	mov    $0x48,%esi
+  805374:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  80537b:	00 00 00 
+  80537e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805383:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  80538a:	00 00 00 
+  80538d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805390:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805397:	00 
+  805398:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80539c:	48 29 ca             	sub    %rcx,%rdx
+  80539f:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8053a6:	00 00 00 
+  8053a9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8053ad:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053b2:	48 89 ce             	mov    %rcx,%rsi
+  8053b5:	48 b8 3c 23 80 00 00 	movabs $0x80233c,%rax
+  8053bc:	00 00 00 
+  8053bf:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053c1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053c8:	00 00 00 
+  8053cb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053cf:	5d                   	pop    %rbp
+  8053d0:	c3                   	ret
+
+00000000008053d1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053d1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053d4:	48 b8 46 51 80 00 00 	movabs $0x805146,%rax
+  8053db:	00 00 00 
+    call *%rax
+  8053de:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053e0:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053e7:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053e8:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053ef:	00 
+    subq $8, %rcx
+  8053f0:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053f4:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053f7:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053fe:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053ff:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805403:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805407:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80540c:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805411:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805416:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80541b:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805420:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805425:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80542a:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80542f:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805434:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805439:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80543e:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805443:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805448:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80544d:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805451:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805455:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805456:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805457:	c3                   	ret
+
+0000000000805458 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805458:	85 ff                	test   %edi,%edi
+  80545a:	78 58                	js     8054b4 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80545c:	48 85 f6             	test   %rsi,%rsi
+  80545f:	74 12                	je     805473 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805461:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805468:	00 00 00 
+  80546b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805471:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805473:	48 85 c9             	test   %rcx,%rcx
+  805476:	74 12                	je     80548a <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805478:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80547f:	00 00 00 
+  805482:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805488:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80548a:	48 85 d2             	test   %rdx,%rdx
+  80548d:	74 14                	je     8054a3 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80548f:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805496:	00 00 00 
+  805499:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8054a0:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8054a3:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8054aa:	00 00 00 
+  8054ad:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054b3:	c3                   	ret
+        if (from_env_store) {
+  8054b4:	48 85 f6             	test   %rsi,%rsi
+  8054b7:	74 06                	je     8054bf <ipc_result+0x67>
+            *from_env_store = 0;
+  8054b9:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054bf:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054c1:	48 85 c9             	test   %rcx,%rcx
+  8054c4:	74 ed                	je     8054b3 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054c6:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054cc:	c3                   	ret
+
+00000000008054cd <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054cd:	55                   	push   %rbp
+  8054ce:	48 89 e5             	mov    %rsp,%rbp
+  8054d1:	41 55                	push   %r13
+  8054d3:	41 54                	push   %r12
+  8054d5:	53                   	push   %rbx
+  8054d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8054da:	49 89 fc             	mov    %rdi,%r12
+  8054dd:	48 89 f7             	mov    %rsi,%rdi
+  8054e0:	48 89 d3             	mov    %rdx,%rbx
+  8054e3:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054e6:	48 85 f6             	test   %rsi,%rsi
+  8054e9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054f0:	00 00 00 
+  8054f3:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8054fc:	48 85 d2             	test   %rdx,%rdx
+  8054ff:	74 03                	je     805504 <ipc_recv+0x37>
+  805501:	48 8b 32             	mov    (%rdx),%rsi
+  805504:	48 b8 9d 2c 80 00 00 	movabs $0x802c9d,%rax
+  80550b:	00 00 00 
+  80550e:	ff d0                	call   *%rax
+  805510:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805512:	4c 89 e9             	mov    %r13,%rcx
+  805515:	48 89 da             	mov    %rbx,%rdx
+  805518:	4c 89 e6             	mov    %r12,%rsi
+  80551b:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  805522:	00 00 00 
+  805525:	ff d0                	call   *%rax
+}
+  805527:	48 83 c4 08          	add    $0x8,%rsp
+  80552b:	5b                   	pop    %rbx
+  80552c:	41 5c                	pop    %r12
+  80552e:	41 5d                	pop    %r13
+  805530:	5d                   	pop    %rbp
+  805531:	c3                   	ret
+
+0000000000805532 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805532:	55                   	push   %rbp
+  805533:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805536:	48 85 d2             	test   %rdx,%rdx
+  805539:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805540:	00 00 00 
+  805543:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805547:	89 f6                	mov    %esi,%esi
+  805549:	48 b8 29 2b 80 00 00 	movabs $0x802b29,%rax
+  805550:	00 00 00 
+  805553:	ff d0                	call   *%rax
+    if (res < 0) {
+  805555:	85 c0                	test   %eax,%eax
+  805557:	78 02                	js     80555b <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805559:	5d                   	pop    %rbp
+  80555a:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80555b:	89 c1                	mov    %eax,%ecx
+  80555d:	48 ba d0 63 80 00 00 	movabs $0x8063d0,%rdx
+  805564:	00 00 00 
+  805567:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80556c:	48 bf dd 63 80 00 00 	movabs $0x8063dd,%rdi
+  805573:	00 00 00 
+  805576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80557b:	49 b8 a3 50 80 00 00 	movabs $0x8050a3,%r8
+  805582:	00 00 00 
+  805585:	41 ff d0             	call   *%r8
+
+0000000000805588 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805588:	55                   	push   %rbp
+  805589:	48 89 e5             	mov    %rsp,%rbp
+  80558c:	53                   	push   %rbx
+  80558d:	48 83 ec 08          	sub    $0x8,%rsp
+  805591:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805595:	48 85 d2             	test   %rdx,%rdx
+  805598:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80559f:	00 00 00 
+  8055a2:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8055a6:	4d 85 c9             	test   %r9,%r9
+  8055a9:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8055ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055b2:	48 85 db             	test   %rbx,%rbx
+  8055b5:	74 03                	je     8055ba <ipc_call+0x32>
+  8055b7:	48 8b 03             	mov    (%rbx),%rax
+  8055ba:	89 f6                	mov    %esi,%esi
+  8055bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8055c0:	50                   	push   %rax
+  8055c1:	48 b8 5b 2b 80 00 00 	movabs $0x802b5b,%rax
+  8055c8:	00 00 00 
+  8055cb:	ff d0                	call   *%rax
+  8055cd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055cf:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055d3:	48 89 da             	mov    %rbx,%rdx
+  8055d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8055db:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  8055e2:	00 00 00 
+  8055e5:	ff d0                	call   *%rax
+}
+  8055e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055eb:	c9                   	leave
+  8055ec:	c3                   	ret
+
+00000000008055ed <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055ed:	55                   	push   %rbp
+  8055ee:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055f1:	89 f6                	mov    %esi,%esi
+  8055f3:	48 b8 c7 2b 80 00 00 	movabs $0x802bc7,%rax
+  8055fa:	00 00 00 
+  8055fd:	ff d0                	call   *%rax
+  8055ff:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805601:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805606:	ba 00 00 00 00       	mov    $0x0,%edx
+  80560b:	be 00 00 00 00       	mov    $0x0,%esi
+  805610:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  805617:	00 00 00 
+  80561a:	ff d0                	call   *%rax
+}
+  80561c:	5d                   	pop    %rbp
+  80561d:	c3                   	ret
+
+000000000080561e <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80561e:	55                   	push   %rbp
+  80561f:	48 89 e5             	mov    %rsp,%rbp
+  805622:	41 54                	push   %r12
+  805624:	53                   	push   %rbx
+  805625:	4c 89 cb             	mov    %r9,%rbx
+  805628:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80562c:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805630:	48 85 d2             	test   %rdx,%rdx
+  805633:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80563a:	00 00 00 
+  80563d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805641:	4d 85 c9             	test   %r9,%r9
+  805644:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80564d:	4d 85 e4             	test   %r12,%r12
+  805650:	74 04                	je     805656 <ipc_reply_wait+0x38>
+  805652:	49 8b 04 24          	mov    (%r12),%rax
+  805656:	89 f6                	mov    %esi,%esi
+  805658:	48 83 ec 08          	sub    $0x8,%rsp
+  80565c:	50                   	push   %rax
+  80565d:	48 b8 31 2c 80 00 00 	movabs $0x802c31,%rax
+  805664:	00 00 00 
+  805667:	ff d0                	call   *%rax
+  805669:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80566b:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80566f:	4c 89 e2             	mov    %r12,%rdx
+  805672:	48 89 de             	mov    %rbx,%rsi
+  805675:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  80567c:	00 00 00 
+  80567f:	ff d0                	call   *%rax
+}
+  805681:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805685:	5b                   	pop    %rbx
+  805686:	41 5c                	pop    %r12
+  805688:	5d                   	pop    %rbp
+  805689:	c3                   	ret
+
+000000000080568a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80568a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80568f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805696:	00 00 00 
+  805699:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8056a0:	48 01 ca             	add    %rcx,%rdx
+  8056a3:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8056a9:	39 fa                	cmp    %edi,%edx
+  8056ab:	74 12                	je     8056bf <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8056ad:	48 83 c0 01          	add    $0x1,%rax
+  8056b1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056b7:	75 e0                	jne    805699 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056be:	c3                   	ret
+            return envs[i].env_id;
+  8056bf:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056c6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056cd:	00 00 00 
+  8056d0:	48 01 d0             	add    %rdx,%rax
+  8056d3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056d9:	c3                   	ret
+  8056da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008056e0 <__rodata_start>:
+  8056e0:	77 00                	ja     8056e2 <__rodata_start+0x2>
+  8056e2:	72 62                	jb     805746 <__rodata_start+0x66>
+  8056e4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056e7:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056ea:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056f1:	00 
+  8056f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056f9:	00 00 00 
+  8056fc:	0f 1f 40 00          	nopl   0x0(%rax)
+  805700:	b3 09                	mov    $0x9,%bl
+  805702:	80 00 00             	addb   $0x0,(%rax)
+  805705:	00 00                	add    %al,(%rax)
+  805707:	00 ed                	add    %ch,%ch
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 ed                	add    %ch,%ch
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	ed                   	in     (%dx),%eax
+  805739:	0d 80 00 00 00       	or     $0x80,%eax
+  80573e:	00 00                	add    %al,(%rax)
+  805740:	ed                   	in     (%dx),%eax
+  805741:	0d 80 00 00 00       	or     $0x80,%eax
+  805746:	00 00                	add    %al,(%rax)
+  805748:	ed                   	in     (%dx),%eax
+  805749:	0d 80 00 00 00       	or     $0x80,%eax
+  80574e:	00 00                	add    %al,(%rax)
+  805750:	ed                   	in     (%dx),%eax
+  805751:	0d 80 00 00 00       	or     $0x80,%eax
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	8c 0a                	mov    %cs,(%rdx)
+  80578a:	80 00 00             	addb   $0x0,(%rax)
+  80578d:	00 00                	add    %al,(%rax)
+  80578f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805796:	00 00                	add    %al,(%rax)
+  805798:	8c 0a                	mov    %cs,(%rdx)
+  80579a:	80 00 00             	addb   $0x0,(%rax)
+  80579d:	00 00                	add    %al,(%rax)
+  80579f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	f4                   	hlt
+  805899:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80589f:	00 ed                	add    %ch,%ch
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	2c 0b                	sub    $0xb,%al
+  8058b2:	80 00 00             	addb   $0x0,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 ed                	add    %ch,%ch
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058f3:	00 00                	add    %al,(%rax)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 cb                	add    %cl,%bl
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	6a 0a                	push   $0xa
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	3c 0a                	cmp    $0xa,%al
+  80593a:	80 00 00             	addb   $0x0,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 ed                	add    %ch,%ch
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80594b:	00 00                	add    %al,(%rax)
+  80594d:	00 00                	add    %al,(%rax)
+  80594f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 29                	add    %ch,(%rcx)
+  805959:	0c 80                	or     $0x80,%al
+  80595b:	00 00                	add    %al,(%rax)
+  80595d:	00 00                	add    %al,(%rax)
+  80595f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805962:	80 00 00             	addb   $0x0,(%rax)
+  805965:	00 00                	add    %al,(%rax)
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	1a 0b                	sbb    (%rbx),%cl
+  805972:	80 00 00             	addb   $0x0,(%rax)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 ed                	add    %ch,%ch
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ce                   	(bad)
+  805981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805987:	00 ed                	add    %ch,%ch
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	f4                   	hlt
+  805999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80599f:	00 37                	add    %dh,(%rdi)
+  8059a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059aa:	80 00 00             	addb   $0x0,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 37                	add    %dh,(%rdi)
+  8059b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059c2:	80 00 00             	addb   $0x0,(%rax)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059cb:	00 00                	add    %al,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 d2                	add    %dl,%dl
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 d2                	add    %dl,%dl
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 d2                	add    %dl,%dl
+  8059f9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ff:	00 d2                	add    %dl,%dl
+  805a01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a07:	00 f6                	add    %dh,%dh
+  805a09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a0f:	00 f6                	add    %dh,%dh
+  805a11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a32:	80 00 00             	addb   $0x0,(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 22                	add    %ah,(%rdx)
+  805a61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a67:	00 22                	add    %ah,(%rdx)
+  805a69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a6f:	00 22                	add    %ah,(%rdx)
+  805a71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a77:	00 22                	add    %ah,(%rdx)
+  805a79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 46 12             	add    %al,0x12(%rsi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 22                	add    %ah,(%rdx)
+  805b61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b67:	00 22                	add    %ah,(%rdx)
+  805b69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b6f:	00 22                	add    %ah,(%rdx)
+  805b71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b77:	00 22                	add    %ah,(%rdx)
+  805b79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 46 12             	add    %al,0x12(%rsi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c20 <basefix.0>:
+  805c20:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c30:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c40:	10 00 31 33 33 37 2f 30 20 69 73 20 25 30 38 78     ..1337/0 is %08x
+  805c50:	21 0a 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32     !..<unknown>.012
+  805c60:	33 34 35 36 37 38 39 41 42 43 44 45 46 00 30 31     3456789ABCDEF.01
+  805c70:	32 33 34 35 36 37 38 39 61 62 63 64 65 66 00 28     23456789abcdef.(
+  805c80:	6e 75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75     null).error %d.u
+  805c90:	6e 73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72     nspecified error
+  805ca0:	00 62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74     .bad environment
+  805cb0:	00 69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74     .invalid paramet
+  805cc0:	65 72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79     er.out of memory
+  805cd0:	00 6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d     .out of environm
+  805ce0:	65 6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64     ents.corrupted d
+  805cf0:	65 62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e     ebug info.segmen
+  805d00:	74 61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76     tation fault.inv
+  805d10:	61 6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e     alid ELF image.n
+  805d20:	6f 20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61     o such system ca
+  805d30:	6c 6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75     ll.entry not fou
+  805d40:	6e 64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65     nd.env is not re
+  805d50:	63 76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64     cving.unexpected
+  805d60:	20 65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20      end of file.no 
+  805d70:	66 72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69     free space on di
+  805d80:	73 6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65     sk.too many file
+  805d90:	73 20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20     s are open.file 
+  805da0:	6f 72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75     or block not fou
+  805db0:	6e 64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00     nd.invalid path.
+  805dc0:	66 69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69     file already exi
+  805dd0:	73 74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f     sts.operation no
+  805de0:	74 20 73 75 70 70 6f 72 74 65 64 00 66 2e 0f 1f     t supported.f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	ad 18 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805e10:	f4 1e 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805e20:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805e30:	04 1f 80 00 00 00 00 00 cc 18 80 00 00 00 00 00     ................
+  805e40:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805e50:	c0 18 80 00 00 00 00 00 3a 19 80 00 00 00 00 00     ........:.......
+  805e60:	04 1f 80 00 00 00 00 00 c0 18 80 00 00 00 00 00     ................
+  805e70:	06 19 80 00 00 00 00 00 06 19 80 00 00 00 00 00     ................
+  805e80:	06 19 80 00 00 00 00 00 06 19 80 00 00 00 00 00     ................
+  805e90:	06 19 80 00 00 00 00 00 06 19 80 00 00 00 00 00     ................
+  805ea0:	06 19 80 00 00 00 00 00 06 19 80 00 00 00 00 00     ................
+  805eb0:	06 19 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805ec0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805ed0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805ee0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805ef0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f00:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f10:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f20:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f30:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f40:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f50:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f60:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f70:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f80:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805f90:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805fa0:	04 1f 80 00 00 00 00 00 22 1e 80 00 00 00 00 00     ........".......
+  805fb0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805fc0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805fd0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805fe0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  805ff0:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  806000:	68 19 80 00 00 00 00 00 37 1b 80 00 00 00 00 00     h.......7.......
+  806010:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  806020:	04 1f 80 00 00 00 00 00 5d 19 80 00 00 00 00 00     ........].......
+  806030:	97 19 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  806040:	04 1f 80 00 00 00 00 00 52 19 80 00 00 00 00 00     ........R.......
+  806050:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  806060:	e0 1c 80 00 00 00 00 00 af 1d 80 00 00 00 00 00     ................
+  806070:	04 1f 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  806080:	2e 1a 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  806090:	0b 1c 80 00 00 00 00 00 04 1f 80 00 00 00 00 00     ................
+  8060a0:	04 1f 80 00 00 00 00 00 22 1e 80 00 00 00 00 00     ........".......
+  8060b0:	04 1f 80 00 00 00 00 00 b6 18 80 00 00 00 00 00     ................
+
+00000000008060c0 <error_string>:
+	...
+  8060c8:	8f 5c 80 00 00 00 00 00 a1 5c 80 00 00 00 00 00     .\.......\......
+  8060d8:	b1 5c 80 00 00 00 00 00 c3 5c 80 00 00 00 00 00     .\.......\......
+  8060e8:	d1 5c 80 00 00 00 00 00 e5 5c 80 00 00 00 00 00     .\.......\......
+  8060f8:	fa 5c 80 00 00 00 00 00 0d 5d 80 00 00 00 00 00     .\.......]......
+  806108:	1f 5d 80 00 00 00 00 00 33 5d 80 00 00 00 00 00     .]......3]......
+  806118:	43 5d 80 00 00 00 00 00 56 5d 80 00 00 00 00 00     C]......V]......
+  806128:	6d 5d 80 00 00 00 00 00 83 5d 80 00 00 00 00 00     m].......]......
+  806138:	9b 5d 80 00 00 00 00 00 b3 5d 80 00 00 00 00 00     .].......]......
+  806148:	c0 5d 80 00 00 00 00 00 60 61 80 00 00 00 00 00     .]......`a......
+  806158:	d4 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806168:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806178:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806188:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806198:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8061a8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8061b8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8061c8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8061d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806208:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806218:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806228:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806238:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806240 <devtab>:
+  806240:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806250:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806260:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806270:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806280:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806290:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8062a0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8062b0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8062c0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8062d0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062e0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062f0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806300:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806310:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806320:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806330:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806340:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806350:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806360:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806370:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806380:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806390:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8063a0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8063b0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8063c0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8063d0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063e0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806400:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806410:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806420:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806430:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806440:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806450:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806460:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806470:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806480:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806490:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,10437 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 75 24 80 00 00 	movabs $0x802475,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 36 34 80 00 00 	movabs $0x803436,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 36 34 80 00 00 	movabs $0x803436,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 0c 3e 80 00 00 	movabs $0x803e0c,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 05 21 80 00 00 	movabs $0x802105,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 0c 3e 80 00 00 	movabs $0x803e0c,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 05 21 80 00 00 	movabs $0x802105,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 29 17 80 00 00 	movabs $0x801729,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 6f 5e 80 00 00 	movabs $0x805e6f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 95 22 80 00 00 	movabs $0x802295,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 9f 3b 80 00 00 	movabs $0x803b9f,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 20 58 80 00 00 	movabs $0x805820,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 95 22 80 00 00 	movabs $0x802295,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 9f 3b 80 00 00 	movabs $0x803b9f,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 22 58 80 00 00 	movabs $0x805822,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 95 22 80 00 00 	movabs $0x802295,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 9f 3b 80 00 00 	movabs $0x803b9f,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 25 58 80 00 00 	movabs $0x805825,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 95 22 80 00 00 	movabs $0x802295,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 9f 3b 80 00 00 	movabs $0x803b9f,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 0a 4c 80 00 00 	movabs $0x804c0a,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 e1 4e 80 00 00 	movabs $0x804ee1,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 89 31 80 00 00 	movabs $0x803189,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 20 35 80 00 00 	movabs $0x803520,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 07 33 80 00 00 	movabs $0x803307,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 36 34 80 00 00 	movabs $0x803436,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 9f 3b 80 00 00 	movabs $0x803b9f,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 89 31 80 00 00 	movabs $0x803189,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 42 24 80 00 00 	movabs $0x802442,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 58 80 00 00 	movabs $0x805840,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 75 24 80 00 00 	movabs $0x802475,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 42 24 80 00 00 	movabs $0x802442,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 5a 80 00 00 	movabs $0x805ae0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 42 24 80 00 00 	movabs $0x802442,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 42 24 80 00 00 	movabs $0x802442,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 5d 80 00 00 	movabs $0x805d60,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 5d 80 00 00 	movabs $0x805d60,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 9a 26 80 00 00 	movabs $0x80269a,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 9a 26 80 00 00 	movabs $0x80269a,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 81 01 00 00       	call   801680 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <dumbfork>:
+        sys_yield();
+    }
+}
+
+envid_t
+dumbfork(void) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80150a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80150f:	cd 30                	int    $0x30
+  801511:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  801513:	85 c0                	test   %eax,%eax
+  801515:	78 4e                	js     801565 <dumbfork+0x64>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  801517:	74 79                	je     801592 <dumbfork+0x91>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801519:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80151f:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801526:	00 00 00 
+  801529:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80152e:	89 c2                	mov    %eax,%edx
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	bf 00 00 00 00       	mov    $0x0,%edi
+  80153a:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  801541:	00 00 00 
+  801544:	ff d0                	call   *%rax
+
+    /* Start the child environment running */
+    if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  801546:	be 02 00 00 00       	mov    $0x2,%esi
+  80154b:	89 df                	mov    %ebx,%edi
+  80154d:	48 b8 7d 2a 80 00 00 	movabs $0x802a7d,%rax
+  801554:	00 00 00 
+  801557:	ff d0                	call   *%rax
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	78 66                	js     8015c3 <dumbfork+0xc2>
+        panic("sys_env_set_status: %i", r);
+
+    return envid;
+}
+  80155d:	89 d8                	mov    %ebx,%eax
+  80155f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801563:	c9                   	leave
+  801564:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  801565:	89 c1                	mov    %eax,%ecx
+  801567:	48 ba 82 5d 80 00 00 	movabs $0x805d82,%rdx
+  80156e:	00 00 00 
+  801571:	be 23 00 00 00       	mov    $0x23,%esi
+  801576:	48 bf 92 5d 80 00 00 	movabs $0x805d92,%rdi
+  80157d:	00 00 00 
+  801580:	b8 00 00 00 00       	mov    $0x0,%eax
+  801585:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  80158c:	00 00 00 
+  80158f:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801592:	48 b8 60 28 80 00 00 	movabs $0x802860,%rax
+  801599:	00 00 00 
+  80159c:	ff d0                	call   *%rax
+  80159e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015a3:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8015aa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8015b1:	00 00 00 
+  8015b4:	48 01 d0             	add    %rdx,%rax
+  8015b7:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8015be:	00 00 00 
+        return 0;
+  8015c1:	eb 9a                	jmp    80155d <dumbfork+0x5c>
+        panic("sys_env_set_status: %i", r);
+  8015c3:	89 c1                	mov    %eax,%ecx
+  8015c5:	48 ba a2 5d 80 00 00 	movabs $0x805da2,%rdx
+  8015cc:	00 00 00 
+  8015cf:	be 33 00 00 00       	mov    $0x33,%esi
+  8015d4:	48 bf 92 5d 80 00 00 	movabs $0x805d92,%rdi
+  8015db:	00 00 00 
+  8015de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e3:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  8015ea:	00 00 00 
+  8015ed:	41 ff d0             	call   *%r8
+
+00000000008015f0 <umain>:
+umain(int argc, char **argv) {
+  8015f0:	55                   	push   %rbp
+  8015f1:	48 89 e5             	mov    %rsp,%rbp
+  8015f4:	41 57                	push   %r15
+  8015f6:	41 56                	push   %r14
+  8015f8:	41 55                	push   %r13
+  8015fa:	41 54                	push   %r12
+  8015fc:	53                   	push   %rbx
+  8015fd:	48 83 ec 08          	sub    $0x8,%rsp
+    who = dumbfork();
+  801601:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801608:	00 00 00 
+  80160b:	ff d0                	call   *%rax
+  80160d:	41 89 c4             	mov    %eax,%r12d
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  801610:	85 c0                	test   %eax,%eax
+  801612:	49 bd b9 5d 80 00 00 	movabs $0x805db9,%r13
+  801619:	00 00 00 
+  80161c:	48 b8 c0 5d 80 00 00 	movabs $0x805dc0,%rax
+  801623:	00 00 00 
+  801626:	4c 0f 44 e8          	cmove  %rax,%r13
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80162f:	49 bf 9c 18 80 00 00 	movabs $0x80189c,%r15
+  801636:	00 00 00 
+        sys_yield();
+  801639:	49 be 97 28 80 00 00 	movabs $0x802897,%r14
+  801640:	00 00 00 
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  801643:	eb 22                	jmp    801667 <umain+0x77>
+  801645:	83 fb 13             	cmp    $0x13,%ebx
+  801648:	7f 27                	jg     801671 <umain+0x81>
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80164a:	4c 89 ea             	mov    %r13,%rdx
+  80164d:	89 de                	mov    %ebx,%esi
+  80164f:	48 bf c6 5d 80 00 00 	movabs $0x805dc6,%rdi
+  801656:	00 00 00 
+  801659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165e:	41 ff d7             	call   *%r15
+        sys_yield();
+  801661:	41 ff d6             	call   *%r14
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  801664:	83 c3 01             	add    $0x1,%ebx
+  801667:	45 85 e4             	test   %r12d,%r12d
+  80166a:	74 d9                	je     801645 <umain+0x55>
+  80166c:	83 fb 09             	cmp    $0x9,%ebx
+  80166f:	7e d9                	jle    80164a <umain+0x5a>
+}
+  801671:	48 83 c4 08          	add    $0x8,%rsp
+  801675:	5b                   	pop    %rbx
+  801676:	41 5c                	pop    %r12
+  801678:	41 5d                	pop    %r13
+  80167a:	41 5e                	pop    %r14
+  80167c:	41 5f                	pop    %r15
+  80167e:	5d                   	pop    %rbp
+  80167f:	c3                   	ret
+
+0000000000801680 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801680:	55                   	push   %rbp
+  801681:	48 89 e5             	mov    %rsp,%rbp
+  801684:	41 56                	push   %r14
+  801686:	41 55                	push   %r13
+  801688:	41 54                	push   %r12
+  80168a:	53                   	push   %rbx
+  80168b:	41 89 fd             	mov    %edi,%r13d
+  80168e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801691:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801698:	00 00 00 
+  80169b:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8016a2:	00 00 00 
+  8016a5:	48 39 c2             	cmp    %rax,%rdx
+  8016a8:	73 17                	jae    8016c1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8016aa:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8016ad:	49 89 c4             	mov    %rax,%r12
+  8016b0:	48 83 c3 08          	add    $0x8,%rbx
+  8016b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b9:	ff 53 f8             	call   *-0x8(%rbx)
+  8016bc:	4c 39 e3             	cmp    %r12,%rbx
+  8016bf:	72 ef                	jb     8016b0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8016c1:	48 b8 60 28 80 00 00 	movabs $0x802860,%rax
+  8016c8:	00 00 00 
+  8016cb:	ff d0                	call   *%rax
+  8016cd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016d2:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8016d9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016e0:	00 00 00 
+  8016e3:	48 01 d0             	add    %rdx,%rax
+  8016e6:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8016ed:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8016f0:	45 85 ed             	test   %r13d,%r13d
+  8016f3:	7e 0d                	jle    801702 <libmain+0x82>
+  8016f5:	49 8b 06             	mov    (%r14),%rax
+  8016f8:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8016ff:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801702:	4c 89 f6             	mov    %r14,%rsi
+  801705:	44 89 ef             	mov    %r13d,%edi
+  801708:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  80170f:	00 00 00 
+  801712:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801714:	48 b8 29 17 80 00 00 	movabs $0x801729,%rax
+  80171b:	00 00 00 
+  80171e:	ff d0                	call   *%rax
+#endif
+}
+  801720:	5b                   	pop    %rbx
+  801721:	41 5c                	pop    %r12
+  801723:	41 5d                	pop    %r13
+  801725:	41 5e                	pop    %r14
+  801727:	5d                   	pop    %rbp
+  801728:	c3                   	ret
+
+0000000000801729 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801729:	55                   	push   %rbp
+  80172a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80172d:	48 b8 bc 31 80 00 00 	movabs $0x8031bc,%rax
+  801734:	00 00 00 
+  801737:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801739:	bf 00 00 00 00       	mov    $0x0,%edi
+  80173e:	48 b8 ef 27 80 00 00 	movabs $0x8027ef,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+}
+  80174a:	5d                   	pop    %rbp
+  80174b:	c3                   	ret
+
+000000000080174c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80174c:	55                   	push   %rbp
+  80174d:	48 89 e5             	mov    %rsp,%rbp
+  801750:	41 56                	push   %r14
+  801752:	41 55                	push   %r13
+  801754:	41 54                	push   %r12
+  801756:	53                   	push   %rbx
+  801757:	48 83 ec 50          	sub    $0x50,%rsp
+  80175b:	49 89 fc             	mov    %rdi,%r12
+  80175e:	41 89 f5             	mov    %esi,%r13d
+  801761:	48 89 d3             	mov    %rdx,%rbx
+  801764:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801768:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80176c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801770:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801777:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80177b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80177f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801783:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801787:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80178e:	00 00 00 
+  801791:	4c 8b 30             	mov    (%rax),%r14
+  801794:	48 b8 60 28 80 00 00 	movabs $0x802860,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+  8017a0:	89 c6                	mov    %eax,%esi
+  8017a2:	45 89 e8             	mov    %r13d,%r8d
+  8017a5:	4c 89 e1             	mov    %r12,%rcx
+  8017a8:	4c 89 f2             	mov    %r14,%rdx
+  8017ab:	48 bf e8 5d 80 00 00 	movabs $0x805de8,%rdi
+  8017b2:	00 00 00 
+  8017b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ba:	49 bc 9c 18 80 00 00 	movabs $0x80189c,%r12
+  8017c1:	00 00 00 
+  8017c4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8017c7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8017cb:	48 89 df             	mov    %rbx,%rdi
+  8017ce:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  8017d5:	00 00 00 
+  8017d8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8017da:	48 bf d6 5d 80 00 00 	movabs $0x805dd6,%rdi
+  8017e1:	00 00 00 
+  8017e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8017ec:	cc                   	int3
+  8017ed:	eb fd                	jmp    8017ec <_panic+0xa0>
+
+00000000008017ef <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8017ef:	55                   	push   %rbp
+  8017f0:	48 89 e5             	mov    %rsp,%rbp
+  8017f3:	53                   	push   %rbx
+  8017f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8017f8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8017fb:	8b 06                	mov    (%rsi),%eax
+  8017fd:	8d 50 01             	lea    0x1(%rax),%edx
+  801800:	89 16                	mov    %edx,(%rsi)
+  801802:	48 98                	cltq
+  801804:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801809:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80180f:	74 0a                	je     80181b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801811:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801815:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801819:	c9                   	leave
+  80181a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80181b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80181f:	be ff 00 00 00       	mov    $0xff,%esi
+  801824:	48 b8 50 27 80 00 00 	movabs $0x802750,%rax
+  80182b:	00 00 00 
+  80182e:	ff d0                	call   *%rax
+        state->offset = 0;
+  801830:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801836:	eb d9                	jmp    801811 <putch+0x22>
+
+0000000000801838 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801838:	55                   	push   %rbp
+  801839:	48 89 e5             	mov    %rsp,%rbp
+  80183c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801843:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801846:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80184d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801852:	b8 00 00 00 00       	mov    $0x0,%eax
+  801857:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80185a:	48 89 f1             	mov    %rsi,%rcx
+  80185d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801864:	48 bf ef 17 80 00 00 	movabs $0x8017ef,%rdi
+  80186b:	00 00 00 
+  80186e:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  801875:	00 00 00 
+  801878:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80187a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801881:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801888:	48 b8 50 27 80 00 00 	movabs $0x802750,%rax
+  80188f:	00 00 00 
+  801892:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801894:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80189a:	c9                   	leave
+  80189b:	c3                   	ret
+
+000000000080189c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80189c:	55                   	push   %rbp
+  80189d:	48 89 e5             	mov    %rsp,%rbp
+  8018a0:	48 83 ec 50          	sub    $0x50,%rsp
+  8018a4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8018a8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8018ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8018b8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8018bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8018cf:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8018d3:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8018df:	c9                   	leave
+  8018e0:	c3                   	ret
+
+00000000008018e1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8018e1:	55                   	push   %rbp
+  8018e2:	48 89 e5             	mov    %rsp,%rbp
+  8018e5:	41 57                	push   %r15
+  8018e7:	41 56                	push   %r14
+  8018e9:	41 55                	push   %r13
+  8018eb:	41 54                	push   %r12
+  8018ed:	53                   	push   %rbx
+  8018ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8018f2:	49 89 fc             	mov    %rdi,%r12
+  8018f5:	49 89 f5             	mov    %rsi,%r13
+  8018f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018fc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8018ff:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801902:	41 89 cf             	mov    %ecx,%r15d
+  801905:	4c 39 fa             	cmp    %r15,%rdx
+  801908:	73 5b                	jae    801965 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80190a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80190e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801912:	85 db                	test   %ebx,%ebx
+  801914:	7e 0e                	jle    801924 <print_num+0x43>
+            putch(padc, put_arg);
+  801916:	4c 89 ee             	mov    %r13,%rsi
+  801919:	44 89 f7             	mov    %r14d,%edi
+  80191c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80191f:	83 eb 01             	sub    $0x1,%ebx
+  801922:	75 f2                	jne    801916 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801924:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801928:	48 b9 1c 5e 80 00 00 	movabs $0x805e1c,%rcx
+  80192f:	00 00 00 
+  801932:	48 b8 0b 5e 80 00 00 	movabs $0x805e0b,%rax
+  801939:	00 00 00 
+  80193c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801940:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801944:	ba 00 00 00 00       	mov    $0x0,%edx
+  801949:	49 f7 f7             	div    %r15
+  80194c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801950:	4c 89 ee             	mov    %r13,%rsi
+  801953:	41 ff d4             	call   *%r12
+}
+  801956:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80195a:	5b                   	pop    %rbx
+  80195b:	41 5c                	pop    %r12
+  80195d:	41 5d                	pop    %r13
+  80195f:	41 5e                	pop    %r14
+  801961:	41 5f                	pop    %r15
+  801963:	5d                   	pop    %rbp
+  801964:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801965:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801969:	ba 00 00 00 00       	mov    $0x0,%edx
+  80196e:	49 f7 f7             	div    %r15
+  801971:	48 83 ec 08          	sub    $0x8,%rsp
+  801975:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801979:	52                   	push   %rdx
+  80197a:	45 0f be c9          	movsbl %r9b,%r9d
+  80197e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801982:	48 89 c2             	mov    %rax,%rdx
+  801985:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  80198c:	00 00 00 
+  80198f:	ff d0                	call   *%rax
+  801991:	48 83 c4 10          	add    $0x10,%rsp
+  801995:	eb 8d                	jmp    801924 <print_num+0x43>
+
+0000000000801997 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801997:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80199b:	48 8b 06             	mov    (%rsi),%rax
+  80199e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8019a2:	73 0a                	jae    8019ae <sprintputch+0x17>
+        *state->start++ = ch;
+  8019a4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019a8:	48 89 16             	mov    %rdx,(%rsi)
+  8019ab:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8019ae:	c3                   	ret
+
+00000000008019af <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8019af:	55                   	push   %rbp
+  8019b0:	48 89 e5             	mov    %rsp,%rbp
+  8019b3:	48 83 ec 50          	sub    $0x50,%rsp
+  8019b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019bb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019bf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8019c3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8019ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019d2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8019da:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8019de:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  8019e5:	00 00 00 
+  8019e8:	ff d0                	call   *%rax
+}
+  8019ea:	c9                   	leave
+  8019eb:	c3                   	ret
+
+00000000008019ec <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8019ec:	55                   	push   %rbp
+  8019ed:	48 89 e5             	mov    %rsp,%rbp
+  8019f0:	41 57                	push   %r15
+  8019f2:	41 56                	push   %r14
+  8019f4:	41 55                	push   %r13
+  8019f6:	41 54                	push   %r12
+  8019f8:	53                   	push   %rbx
+  8019f9:	48 83 ec 38          	sub    $0x38,%rsp
+  8019fd:	49 89 fe             	mov    %rdi,%r14
+  801a00:	49 89 f5             	mov    %rsi,%r13
+  801a03:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801a06:	48 8b 01             	mov    (%rcx),%rax
+  801a09:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801a0d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a15:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801a19:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801a1d:	eb 0d                	jmp    801a2c <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801a1f:	40 0f b6 ff          	movzbl %dil,%edi
+  801a23:	4c 89 ee             	mov    %r13,%rsi
+  801a26:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801a29:	4c 89 e3             	mov    %r12,%rbx
+  801a2c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801a30:	0f b6 3b             	movzbl (%rbx),%edi
+  801a33:	40 80 ff 25          	cmp    $0x25,%dil
+  801a37:	74 14                	je     801a4d <vprintfmt+0x61>
+            if (!ch) return;
+  801a39:	40 84 ff             	test   %dil,%dil
+  801a3c:	75 e1                	jne    801a1f <vprintfmt+0x33>
+}
+  801a3e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a42:	5b                   	pop    %rbx
+  801a43:	41 5c                	pop    %r12
+  801a45:	41 5d                	pop    %r13
+  801a47:	41 5e                	pop    %r14
+  801a49:	41 5f                	pop    %r15
+  801a4b:	5d                   	pop    %rbp
+  801a4c:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801a4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a52:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801a56:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801a5b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a61:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801a68:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a6c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801a71:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a76:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a79:	83 e8 23             	sub    $0x23,%eax
+  801a7c:	3c 57                	cmp    $0x57,%al
+  801a7e:	0f 87 67 06 00 00    	ja     8020eb <vprintfmt+0x6ff>
+  801a84:	0f b6 c0             	movzbl %al,%eax
+  801a87:	48 b9 a0 5f 80 00 00 	movabs $0x805fa0,%rcx
+  801a8e:	00 00 00 
+  801a91:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801a94:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801a97:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801a9b:	eb cf                	jmp    801a6c <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801a9d:	49 89 dc             	mov    %rbx,%r12
+  801aa0:	be 01 00 00 00       	mov    $0x1,%esi
+  801aa5:	eb c5                	jmp    801a6c <vprintfmt+0x80>
+            padc = ch;
+  801aa7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801aab:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801aae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ab1:	eb b9                	jmp    801a6c <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801ab3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ab6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ab9:	77 24                	ja     801adf <vprintfmt+0xf3>
+  801abb:	89 c1                	mov    %eax,%ecx
+  801abd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801ac1:	83 c0 08             	add    $0x8,%eax
+  801ac4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ac7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801aca:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801acd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ad1:	79 99                	jns    801a6c <vprintfmt+0x80>
+                width = precision;
+  801ad3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ad7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801add:	eb 8d                	jmp    801a6c <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801adf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801ae3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801ae7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aeb:	eb da                	jmp    801ac7 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801aed:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801af2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801af6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801afc:	3c 39                	cmp    $0x39,%al
+  801afe:	77 1c                	ja     801b1c <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801b00:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801b04:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801b08:	0f b6 c0             	movzbl %al,%eax
+  801b0b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b10:	0f b6 03             	movzbl (%rbx),%eax
+  801b13:	3c 39                	cmp    $0x39,%al
+  801b15:	76 e9                	jbe    801b00 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801b17:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801b1a:	eb b1                	jmp    801acd <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801b1c:	49 89 dc             	mov    %rbx,%r12
+  801b1f:	eb ac                	jmp    801acd <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801b21:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801b24:	85 c9                	test   %ecx,%ecx
+  801b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2b:	0f 49 c1             	cmovns %ecx,%eax
+  801b2e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801b31:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b34:	e9 33 ff ff ff       	jmp    801a6c <vprintfmt+0x80>
+            lflag++;
+  801b39:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b3c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b3f:	e9 28 ff ff ff       	jmp    801a6c <vprintfmt+0x80>
+            lflag--;
+  801b44:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b47:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b4a:	e9 1d ff ff ff       	jmp    801a6c <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801b4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b52:	83 f8 2f             	cmp    $0x2f,%eax
+  801b55:	77 19                	ja     801b70 <vprintfmt+0x184>
+  801b57:	89 c2                	mov    %eax,%edx
+  801b59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b5d:	83 c0 08             	add    $0x8,%eax
+  801b60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b63:	8b 3a                	mov    (%rdx),%edi
+  801b65:	4c 89 ee             	mov    %r13,%rsi
+  801b68:	41 ff d6             	call   *%r14
+            break;
+  801b6b:	e9 bc fe ff ff       	jmp    801a2c <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801b70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b7c:	eb e5                	jmp    801b63 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801b7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b81:	83 f8 2f             	cmp    $0x2f,%eax
+  801b84:	77 5a                	ja     801be0 <vprintfmt+0x1f4>
+  801b86:	89 c2                	mov    %eax,%edx
+  801b88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b8c:	83 c0 08             	add    $0x8,%eax
+  801b8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801b92:	8b 02                	mov    (%rdx),%eax
+  801b94:	89 c1                	mov    %eax,%ecx
+  801b96:	f7 d9                	neg    %ecx
+  801b98:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801b9b:	83 f9 13             	cmp    $0x13,%ecx
+  801b9e:	7f 4e                	jg     801bee <vprintfmt+0x202>
+  801ba0:	48 63 c1             	movslq %ecx,%rax
+  801ba3:	48 ba 60 62 80 00 00 	movabs $0x806260,%rdx
+  801baa:	00 00 00 
+  801bad:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801bb1:	48 85 c0             	test   %rax,%rax
+  801bb4:	74 38                	je     801bee <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801bb6:	48 89 c1             	mov    %rax,%rcx
+  801bb9:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  801bc0:	00 00 00 
+  801bc3:	4c 89 ee             	mov    %r13,%rsi
+  801bc6:	4c 89 f7             	mov    %r14,%rdi
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bce:	49 b8 af 19 80 00 00 	movabs $0x8019af,%r8
+  801bd5:	00 00 00 
+  801bd8:	41 ff d0             	call   *%r8
+  801bdb:	e9 4c fe ff ff       	jmp    801a2c <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801be0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801be4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801be8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bec:	eb a4                	jmp    801b92 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801bee:	48 ba 34 5e 80 00 00 	movabs $0x805e34,%rdx
+  801bf5:	00 00 00 
+  801bf8:	4c 89 ee             	mov    %r13,%rsi
+  801bfb:	4c 89 f7             	mov    %r14,%rdi
+  801bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c03:	49 b8 af 19 80 00 00 	movabs $0x8019af,%r8
+  801c0a:	00 00 00 
+  801c0d:	41 ff d0             	call   *%r8
+  801c10:	e9 17 fe ff ff       	jmp    801a2c <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c18:	83 f8 2f             	cmp    $0x2f,%eax
+  801c1b:	77 6c                	ja     801c89 <vprintfmt+0x29d>
+  801c1d:	89 c2                	mov    %eax,%edx
+  801c1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c23:	83 c0 08             	add    $0x8,%eax
+  801c26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c29:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801c2c:	48 85 f6             	test   %rsi,%rsi
+  801c2f:	48 b8 2d 5e 80 00 00 	movabs $0x805e2d,%rax
+  801c36:	00 00 00 
+  801c39:	48 0f 45 c6          	cmovne %rsi,%rax
+  801c3d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801c41:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c45:	7e 06                	jle    801c4d <vprintfmt+0x261>
+  801c47:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801c4b:	75 4a                	jne    801c97 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c4d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c51:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801c55:	0f b6 00             	movzbl (%rax),%eax
+  801c58:	84 c0                	test   %al,%al
+  801c5a:	0f 85 9a 00 00 00    	jne    801cfa <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801c60:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c63:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801c67:	85 c0                	test   %eax,%eax
+  801c69:	0f 8e bd fd ff ff    	jle    801a2c <vprintfmt+0x40>
+  801c6f:	4c 89 ee             	mov    %r13,%rsi
+  801c72:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c77:	41 ff d6             	call   *%r14
+  801c7a:	41 83 ec 01          	sub    $0x1,%r12d
+  801c7e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801c82:	75 eb                	jne    801c6f <vprintfmt+0x283>
+  801c84:	e9 a3 fd ff ff       	jmp    801a2c <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c95:	eb 92                	jmp    801c29 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801c97:	49 63 f7             	movslq %r15d,%rsi
+  801c9a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801c9e:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  801ca5:	00 00 00 
+  801ca8:	ff d0                	call   *%rax
+  801caa:	48 89 c2             	mov    %rax,%rdx
+  801cad:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cb0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801cb2:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801cb5:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801cb8:	85 c0                	test   %eax,%eax
+  801cba:	7e 91                	jle    801c4d <vprintfmt+0x261>
+  801cbc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801cc1:	4c 89 ee             	mov    %r13,%rsi
+  801cc4:	44 89 e7             	mov    %r12d,%edi
+  801cc7:	41 ff d6             	call   *%r14
+  801cca:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801cce:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cd1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801cd4:	75 eb                	jne    801cc1 <vprintfmt+0x2d5>
+  801cd6:	e9 72 ff ff ff       	jmp    801c4d <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801cdb:	0f b6 f8             	movzbl %al,%edi
+  801cde:	4c 89 ee             	mov    %r13,%rsi
+  801ce1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ce4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ce8:	49 83 c4 01          	add    $0x1,%r12
+  801cec:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801cf2:	84 c0                	test   %al,%al
+  801cf4:	0f 84 66 ff ff ff    	je     801c60 <vprintfmt+0x274>
+  801cfa:	45 85 ff             	test   %r15d,%r15d
+  801cfd:	78 0a                	js     801d09 <vprintfmt+0x31d>
+  801cff:	41 83 ef 01          	sub    $0x1,%r15d
+  801d03:	0f 88 57 ff ff ff    	js     801c60 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d09:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801d0d:	74 cc                	je     801cdb <vprintfmt+0x2ef>
+  801d0f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801d12:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d17:	80 fa 5e             	cmp    $0x5e,%dl
+  801d1a:	77 c2                	ja     801cde <vprintfmt+0x2f2>
+  801d1c:	eb bd                	jmp    801cdb <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801d1e:	40 84 f6             	test   %sil,%sil
+  801d21:	75 26                	jne    801d49 <vprintfmt+0x35d>
+    switch (lflag) {
+  801d23:	85 d2                	test   %edx,%edx
+  801d25:	74 59                	je     801d80 <vprintfmt+0x394>
+  801d27:	83 fa 01             	cmp    $0x1,%edx
+  801d2a:	74 7b                	je     801da7 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801d2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d2f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d32:	0f 87 96 00 00 00    	ja     801dce <vprintfmt+0x3e2>
+  801d38:	89 c2                	mov    %eax,%edx
+  801d3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d3e:	83 c0 08             	add    $0x8,%eax
+  801d41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d44:	4c 8b 22             	mov    (%rdx),%r12
+  801d47:	eb 17                	jmp    801d60 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4f:	77 21                	ja     801d72 <vprintfmt+0x386>
+  801d51:	89 c2                	mov    %eax,%edx
+  801d53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d57:	83 c0 08             	add    $0x8,%eax
+  801d5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801d60:	4d 85 e4             	test   %r12,%r12
+  801d63:	78 7a                	js     801ddf <vprintfmt+0x3f3>
+            num = i;
+  801d65:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801d68:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801d6d:	e9 56 02 00 00       	jmp    801fc8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7e:	eb dd                	jmp    801d5d <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801d80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d83:	83 f8 2f             	cmp    $0x2f,%eax
+  801d86:	77 11                	ja     801d99 <vprintfmt+0x3ad>
+  801d88:	89 c2                	mov    %eax,%edx
+  801d8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d8e:	83 c0 08             	add    $0x8,%eax
+  801d91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d94:	4c 63 22             	movslq (%rdx),%r12
+  801d97:	eb c7                	jmp    801d60 <vprintfmt+0x374>
+  801d99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801da1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da5:	eb ed                	jmp    801d94 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801da7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801daa:	83 f8 2f             	cmp    $0x2f,%eax
+  801dad:	77 11                	ja     801dc0 <vprintfmt+0x3d4>
+  801daf:	89 c2                	mov    %eax,%edx
+  801db1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801db5:	83 c0 08             	add    $0x8,%eax
+  801db8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dbb:	4c 8b 22             	mov    (%rdx),%r12
+  801dbe:	eb a0                	jmp    801d60 <vprintfmt+0x374>
+  801dc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dcc:	eb ed                	jmp    801dbb <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801dce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dd2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dda:	e9 65 ff ff ff       	jmp    801d44 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801ddf:	4c 89 ee             	mov    %r13,%rsi
+  801de2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801de7:	41 ff d6             	call   *%r14
+                i = -i;
+  801dea:	49 f7 dc             	neg    %r12
+  801ded:	e9 73 ff ff ff       	jmp    801d65 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801df2:	40 84 f6             	test   %sil,%sil
+  801df5:	75 2e                	jne    801e25 <vprintfmt+0x439>
+    switch (lflag) {
+  801df7:	85 d2                	test   %edx,%edx
+  801df9:	7f 59                	jg     801e54 <vprintfmt+0x468>
+  801dfb:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801dfe:	7d 7a                	jge    801e7a <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801e00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e03:	83 f8 2f             	cmp    $0x2f,%eax
+  801e06:	0f 87 aa 00 00 00    	ja     801eb6 <vprintfmt+0x4ca>
+  801e0c:	89 c2                	mov    %eax,%edx
+  801e0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e12:	83 c0 08             	add    $0x8,%eax
+  801e15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e18:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e1b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e20:	e9 a3 01 00 00       	jmp    801fc8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e28:	83 f8 2f             	cmp    $0x2f,%eax
+  801e2b:	77 19                	ja     801e46 <vprintfmt+0x45a>
+  801e2d:	89 c2                	mov    %eax,%edx
+  801e2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e33:	83 c0 08             	add    $0x8,%eax
+  801e36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e39:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e3c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e41:	e9 82 01 00 00       	jmp    801fc8 <vprintfmt+0x5dc>
+  801e46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e52:	eb e5                	jmp    801e39 <vprintfmt+0x44d>
+    switch (lflag) {
+  801e54:	83 fa 01             	cmp    $0x1,%edx
+  801e57:	75 a7                	jne    801e00 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801e59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e5c:	83 f8 2f             	cmp    $0x2f,%eax
+  801e5f:	77 47                	ja     801ea8 <vprintfmt+0x4bc>
+  801e61:	89 c2                	mov    %eax,%edx
+  801e63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e67:	83 c0 08             	add    $0x8,%eax
+  801e6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e6d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e70:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e75:	e9 4e 01 00 00       	jmp    801fc8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e80:	77 18                	ja     801e9a <vprintfmt+0x4ae>
+  801e82:	89 c2                	mov    %eax,%edx
+  801e84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e88:	83 c0 08             	add    $0x8,%eax
+  801e8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801e90:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801e95:	e9 2e 01 00 00       	jmp    801fc8 <vprintfmt+0x5dc>
+  801e9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea6:	eb e6                	jmp    801e8e <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801ea8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb4:	eb b7                	jmp    801e6d <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801eb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec2:	e9 51 ff ff ff       	jmp    801e18 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ec7:	40 84 f6             	test   %sil,%sil
+  801eca:	75 2e                	jne    801efa <vprintfmt+0x50e>
+    switch (lflag) {
+  801ecc:	85 d2                	test   %edx,%edx
+  801ece:	7f 59                	jg     801f29 <vprintfmt+0x53d>
+  801ed0:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ed3:	7d 77                	jge    801f4c <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ed5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed8:	83 f8 2f             	cmp    $0x2f,%eax
+  801edb:	0f 87 a4 00 00 00    	ja     801f85 <vprintfmt+0x599>
+  801ee1:	89 c2                	mov    %eax,%edx
+  801ee3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee7:	83 c0 08             	add    $0x8,%eax
+  801eea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eed:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ef0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801ef5:	e9 ce 00 00 00       	jmp    801fc8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801efa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801efd:	83 f8 2f             	cmp    $0x2f,%eax
+  801f00:	77 19                	ja     801f1b <vprintfmt+0x52f>
+  801f02:	89 c2                	mov    %eax,%edx
+  801f04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f08:	83 c0 08             	add    $0x8,%eax
+  801f0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f11:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f16:	e9 ad 00 00 00       	jmp    801fc8 <vprintfmt+0x5dc>
+  801f1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f27:	eb e5                	jmp    801f0e <vprintfmt+0x522>
+    switch (lflag) {
+  801f29:	83 fa 01             	cmp    $0x1,%edx
+  801f2c:	75 a7                	jne    801ed5 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801f2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f31:	83 f8 2f             	cmp    $0x2f,%eax
+  801f34:	77 41                	ja     801f77 <vprintfmt+0x58b>
+  801f36:	89 c2                	mov    %eax,%edx
+  801f38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f3c:	83 c0 08             	add    $0x8,%eax
+  801f3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f45:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801f4a:	eb 7c                	jmp    801fc8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f4f:	83 f8 2f             	cmp    $0x2f,%eax
+  801f52:	77 15                	ja     801f69 <vprintfmt+0x57d>
+  801f54:	89 c2                	mov    %eax,%edx
+  801f56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f5a:	83 c0 08             	add    $0x8,%eax
+  801f5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f60:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801f62:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801f67:	eb 5f                	jmp    801fc8 <vprintfmt+0x5dc>
+  801f69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f75:	eb e9                	jmp    801f60 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f83:	eb bd                	jmp    801f42 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801f85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f91:	e9 57 ff ff ff       	jmp    801eed <vprintfmt+0x501>
+            putch('0', put_arg);
+  801f96:	4c 89 ee             	mov    %r13,%rsi
+  801f99:	bf 30 00 00 00       	mov    $0x30,%edi
+  801f9e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801fa1:	4c 89 ee             	mov    %r13,%rsi
+  801fa4:	bf 78 00 00 00       	mov    $0x78,%edi
+  801fa9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801fac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801faf:	83 f8 2f             	cmp    $0x2f,%eax
+  801fb2:	77 47                	ja     801ffb <vprintfmt+0x60f>
+  801fb4:	89 c2                	mov    %eax,%edx
+  801fb6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fba:	83 c0 08             	add    $0x8,%eax
+  801fbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fc3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801fc8:	48 83 ec 08          	sub    $0x8,%rsp
+  801fcc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801fd0:	0f 94 c0             	sete   %al
+  801fd3:	0f b6 c0             	movzbl %al,%eax
+  801fd6:	50                   	push   %rax
+  801fd7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801fdc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801fe0:	4c 89 ee             	mov    %r13,%rsi
+  801fe3:	4c 89 f7             	mov    %r14,%rdi
+  801fe6:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801fed:	00 00 00 
+  801ff0:	ff d0                	call   *%rax
+            break;
+  801ff2:	48 83 c4 10          	add    $0x10,%rsp
+  801ff6:	e9 31 fa ff ff       	jmp    801a2c <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801ffb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802003:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802007:	eb b7                	jmp    801fc0 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802009:	40 84 f6             	test   %sil,%sil
+  80200c:	75 2b                	jne    802039 <vprintfmt+0x64d>
+    switch (lflag) {
+  80200e:	85 d2                	test   %edx,%edx
+  802010:	7f 56                	jg     802068 <vprintfmt+0x67c>
+  802012:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802015:	7d 77                	jge    80208e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802017:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80201a:	83 f8 2f             	cmp    $0x2f,%eax
+  80201d:	0f 87 a7 00 00 00    	ja     8020ca <vprintfmt+0x6de>
+  802023:	89 c2                	mov    %eax,%edx
+  802025:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802029:	83 c0 08             	add    $0x8,%eax
+  80202c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80202f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802032:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802037:	eb 8f                	jmp    801fc8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802039:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80203c:	83 f8 2f             	cmp    $0x2f,%eax
+  80203f:	77 19                	ja     80205a <vprintfmt+0x66e>
+  802041:	89 c2                	mov    %eax,%edx
+  802043:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802047:	83 c0 08             	add    $0x8,%eax
+  80204a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80204d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802050:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802055:	e9 6e ff ff ff       	jmp    801fc8 <vprintfmt+0x5dc>
+  80205a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80205e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802062:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802066:	eb e5                	jmp    80204d <vprintfmt+0x661>
+    switch (lflag) {
+  802068:	83 fa 01             	cmp    $0x1,%edx
+  80206b:	75 aa                	jne    802017 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80206d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802070:	83 f8 2f             	cmp    $0x2f,%eax
+  802073:	77 47                	ja     8020bc <vprintfmt+0x6d0>
+  802075:	89 c2                	mov    %eax,%edx
+  802077:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80207b:	83 c0 08             	add    $0x8,%eax
+  80207e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802081:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802084:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802089:	e9 3a ff ff ff       	jmp    801fc8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80208e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802091:	83 f8 2f             	cmp    $0x2f,%eax
+  802094:	77 18                	ja     8020ae <vprintfmt+0x6c2>
+  802096:	89 c2                	mov    %eax,%edx
+  802098:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80209c:	83 c0 08             	add    $0x8,%eax
+  80209f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020a2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8020a4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8020a9:	e9 1a ff ff ff       	jmp    801fc8 <vprintfmt+0x5dc>
+  8020ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020ba:	eb e6                	jmp    8020a2 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8020bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c8:	eb b7                	jmp    802081 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8020ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d6:	e9 54 ff ff ff       	jmp    80202f <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8020db:	4c 89 ee             	mov    %r13,%rsi
+  8020de:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020e3:	41 ff d6             	call   *%r14
+            break;
+  8020e6:	e9 41 f9 ff ff       	jmp    801a2c <vprintfmt+0x40>
+            putch('%', put_arg);
+  8020eb:	4c 89 ee             	mov    %r13,%rsi
+  8020ee:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020f3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8020f6:	48 83 eb 01          	sub    $0x1,%rbx
+  8020fa:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8020fe:	75 f6                	jne    8020f6 <vprintfmt+0x70a>
+  802100:	e9 27 f9 ff ff       	jmp    801a2c <vprintfmt+0x40>
+
+0000000000802105 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802105:	55                   	push   %rbp
+  802106:	48 89 e5             	mov    %rsp,%rbp
+  802109:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80210d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802111:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802116:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80211a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802121:	48 85 ff             	test   %rdi,%rdi
+  802124:	74 2b                	je     802151 <vsnprintf+0x4c>
+  802126:	48 85 f6             	test   %rsi,%rsi
+  802129:	74 26                	je     802151 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80212b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80212f:	48 bf 97 19 80 00 00 	movabs $0x801997,%rdi
+  802136:	00 00 00 
+  802139:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  802140:	00 00 00 
+  802143:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802145:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802149:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80214c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802151:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802156:	eb f7                	jmp    80214f <vsnprintf+0x4a>
+
+0000000000802158 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+  80215c:	48 83 ec 50          	sub    $0x50,%rsp
+  802160:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802164:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802168:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80216c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802173:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802177:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80217b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80217f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802183:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802187:	48 b8 05 21 80 00 00 	movabs $0x802105,%rax
+  80218e:	00 00 00 
+  802191:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802193:	c9                   	leave
+  802194:	c3                   	ret
+
+0000000000802195 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802195:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802198:	74 10                	je     8021aa <strlen+0x15>
+    size_t n = 0;
+  80219a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80219f:	48 83 c0 01          	add    $0x1,%rax
+  8021a3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8021a7:	75 f6                	jne    80219f <strlen+0xa>
+  8021a9:	c3                   	ret
+    size_t n = 0;
+  8021aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8021af:	c3                   	ret
+
+00000000008021b0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8021b0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8021b3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8021b8:	48 85 f6             	test   %rsi,%rsi
+  8021bb:	74 11                	je     8021ce <strnlen+0x1e>
+  8021bd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8021c1:	74 0c                	je     8021cf <strnlen+0x1f>
+  8021c3:	48 83 c2 01          	add    $0x1,%rdx
+  8021c7:	48 39 d0             	cmp    %rdx,%rax
+  8021ca:	75 f1                	jne    8021bd <strnlen+0xd>
+  8021cc:	eb 04                	jmp    8021d2 <strnlen+0x22>
+  8021ce:	c3                   	ret
+  8021cf:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8021d2:	c3                   	ret
+
+00000000008021d3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8021d3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8021d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021db:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8021df:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8021e2:	48 83 c2 01          	add    $0x1,%rdx
+  8021e6:	84 c9                	test   %cl,%cl
+  8021e8:	75 f1                	jne    8021db <strcpy+0x8>
+        ;
+    return res;
+}
+  8021ea:	c3                   	ret
+
+00000000008021eb <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+  8021ef:	41 54                	push   %r12
+  8021f1:	53                   	push   %rbx
+  8021f2:	48 89 fb             	mov    %rdi,%rbx
+  8021f5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8021f8:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8021ff:	00 00 00 
+  802202:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802204:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802208:	4c 89 e6             	mov    %r12,%rsi
+  80220b:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+    return dst;
+}
+  802217:	48 89 d8             	mov    %rbx,%rax
+  80221a:	5b                   	pop    %rbx
+  80221b:	41 5c                	pop    %r12
+  80221d:	5d                   	pop    %rbp
+  80221e:	c3                   	ret
+
+000000000080221f <toupper>:
+
+int
+toupper(int ch) {
+  80221f:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802221:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802224:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802227:	83 f9 1a             	cmp    $0x1a,%ecx
+  80222a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80222d:	c3                   	ret
+
+000000000080222e <tolower>:
+
+int
+tolower(int ch) {
+  80222e:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802230:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802233:	8d 57 20             	lea    0x20(%rdi),%edx
+  802236:	83 f9 1a             	cmp    $0x1a,%ecx
+  802239:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80223c:	c3                   	ret
+
+000000000080223d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80223d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802240:	48 85 d2             	test   %rdx,%rdx
+  802243:	74 1f                	je     802264 <strncpy+0x27>
+  802245:	48 01 fa             	add    %rdi,%rdx
+  802248:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80224b:	48 83 c1 01          	add    $0x1,%rcx
+  80224f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802253:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802257:	41 80 f8 01          	cmp    $0x1,%r8b
+  80225b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80225f:	48 39 ca             	cmp    %rcx,%rdx
+  802262:	75 e7                	jne    80224b <strncpy+0xe>
+    }
+    return ret;
+}
+  802264:	c3                   	ret
+
+0000000000802265 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802265:	48 89 f8             	mov    %rdi,%rax
+  802268:	48 85 d2             	test   %rdx,%rdx
+  80226b:	74 24                	je     802291 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80226d:	48 83 ea 01          	sub    $0x1,%rdx
+  802271:	74 1b                	je     80228e <strlcpy+0x29>
+  802273:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802277:	0f b6 16             	movzbl (%rsi),%edx
+  80227a:	84 d2                	test   %dl,%dl
+  80227c:	74 10                	je     80228e <strlcpy+0x29>
+            *dst++ = *src++;
+  80227e:	48 83 c6 01          	add    $0x1,%rsi
+  802282:	48 83 c0 01          	add    $0x1,%rax
+  802286:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802289:	48 39 c8             	cmp    %rcx,%rax
+  80228c:	75 e9                	jne    802277 <strlcpy+0x12>
+        *dst = '\0';
+  80228e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802291:	48 29 f8             	sub    %rdi,%rax
+}
+  802294:	c3                   	ret
+
+0000000000802295 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802295:	0f b6 07             	movzbl (%rdi),%eax
+  802298:	84 c0                	test   %al,%al
+  80229a:	74 13                	je     8022af <strcmp+0x1a>
+  80229c:	38 06                	cmp    %al,(%rsi)
+  80229e:	75 0f                	jne    8022af <strcmp+0x1a>
+  8022a0:	48 83 c7 01          	add    $0x1,%rdi
+  8022a4:	48 83 c6 01          	add    $0x1,%rsi
+  8022a8:	0f b6 07             	movzbl (%rdi),%eax
+  8022ab:	84 c0                	test   %al,%al
+  8022ad:	75 ed                	jne    80229c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022af:	0f b6 c0             	movzbl %al,%eax
+  8022b2:	0f b6 16             	movzbl (%rsi),%edx
+  8022b5:	29 d0                	sub    %edx,%eax
+}
+  8022b7:	c3                   	ret
+
+00000000008022b8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8022b8:	48 85 d2             	test   %rdx,%rdx
+  8022bb:	74 1f                	je     8022dc <strncmp+0x24>
+  8022bd:	0f b6 07             	movzbl (%rdi),%eax
+  8022c0:	84 c0                	test   %al,%al
+  8022c2:	74 1e                	je     8022e2 <strncmp+0x2a>
+  8022c4:	3a 06                	cmp    (%rsi),%al
+  8022c6:	75 1a                	jne    8022e2 <strncmp+0x2a>
+  8022c8:	48 83 c7 01          	add    $0x1,%rdi
+  8022cc:	48 83 c6 01          	add    $0x1,%rsi
+  8022d0:	48 83 ea 01          	sub    $0x1,%rdx
+  8022d4:	75 e7                	jne    8022bd <strncmp+0x5>
+
+    if (!n) return 0;
+  8022d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022db:	c3                   	ret
+  8022dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e1:	c3                   	ret
+  8022e2:	48 85 d2             	test   %rdx,%rdx
+  8022e5:	74 09                	je     8022f0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022e7:	0f b6 07             	movzbl (%rdi),%eax
+  8022ea:	0f b6 16             	movzbl (%rsi),%edx
+  8022ed:	29 d0                	sub    %edx,%eax
+  8022ef:	c3                   	ret
+    if (!n) return 0;
+  8022f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f5:	c3                   	ret
+
+00000000008022f6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8022f6:	0f b6 17             	movzbl (%rdi),%edx
+  8022f9:	84 d2                	test   %dl,%dl
+  8022fb:	74 18                	je     802315 <strchr+0x1f>
+        if (*str == c) {
+  8022fd:	0f be d2             	movsbl %dl,%edx
+  802300:	39 f2                	cmp    %esi,%edx
+  802302:	74 17                	je     80231b <strchr+0x25>
+    for (; *str; str++) {
+  802304:	48 83 c7 01          	add    $0x1,%rdi
+  802308:	0f b6 17             	movzbl (%rdi),%edx
+  80230b:	84 d2                	test   %dl,%dl
+  80230d:	75 ee                	jne    8022fd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80230f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802314:	c3                   	ret
+  802315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231a:	c3                   	ret
+  80231b:	48 89 f8             	mov    %rdi,%rax
+}
+  80231e:	c3                   	ret
+
+000000000080231f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80231f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802322:	0f b6 17             	movzbl (%rdi),%edx
+  802325:	84 d2                	test   %dl,%dl
+  802327:	74 13                	je     80233c <strfind+0x1d>
+  802329:	0f be d2             	movsbl %dl,%edx
+  80232c:	39 f2                	cmp    %esi,%edx
+  80232e:	74 0b                	je     80233b <strfind+0x1c>
+  802330:	48 83 c0 01          	add    $0x1,%rax
+  802334:	0f b6 10             	movzbl (%rax),%edx
+  802337:	84 d2                	test   %dl,%dl
+  802339:	75 ee                	jne    802329 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80233b:	c3                   	ret
+  80233c:	c3                   	ret
+
+000000000080233d <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80233d:	48 39 f7             	cmp    %rsi,%rdi
+  802340:	74 65                	je     8023a7 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802342:	55                   	push   %rbp
+  802343:	48 89 e5             	mov    %rsp,%rbp
+  802346:	41 57                	push   %r15
+  802348:	41 56                	push   %r14
+  80234a:	41 55                	push   %r13
+  80234c:	41 54                	push   %r12
+  80234e:	53                   	push   %rbx
+  80234f:	48 83 ec 18          	sub    $0x18,%rsp
+  802353:	48 89 fb             	mov    %rdi,%rbx
+  802356:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802359:	49 bf 2e 22 80 00 00 	movabs $0x80222e,%r15
+  802360:	00 00 00 
+  802363:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802367:	41 0f b6 fd          	movzbl %r13b,%edi
+  80236b:	41 ff d7             	call   *%r15
+  80236e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802371:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802376:	41 0f b6 fe          	movzbl %r14b,%edi
+  80237a:	41 ff d7             	call   *%r15
+  80237d:	89 c2                	mov    %eax,%edx
+  80237f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802382:	29 d0                	sub    %edx,%eax
+  802384:	75 12                	jne    802398 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802386:	48 83 c3 01          	add    $0x1,%rbx
+  80238a:	45 84 ed             	test   %r13b,%r13b
+  80238d:	74 09                	je     802398 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80238f:	49 83 c4 01          	add    $0x1,%r12
+  802393:	45 84 f6             	test   %r14b,%r14b
+  802396:	75 cb                	jne    802363 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802398:	48 83 c4 18          	add    $0x18,%rsp
+  80239c:	5b                   	pop    %rbx
+  80239d:	41 5c                	pop    %r12
+  80239f:	41 5d                	pop    %r13
+  8023a1:	41 5e                	pop    %r14
+  8023a3:	41 5f                	pop    %r15
+  8023a5:	5d                   	pop    %rbp
+  8023a6:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ac:	c3                   	ret
+
+00000000008023ad <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8023ad:	48 39 f7             	cmp    %rsi,%rdi
+  8023b0:	74 7d                	je     80242f <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	41 57                	push   %r15
+  8023b8:	41 56                	push   %r14
+  8023ba:	41 55                	push   %r13
+  8023bc:	41 54                	push   %r12
+  8023be:	53                   	push   %rbx
+  8023bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8023c3:	48 89 fb             	mov    %rdi,%rbx
+  8023c6:	49 89 f4             	mov    %rsi,%r12
+  8023c9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8023cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023d1:	49 bf 2e 22 80 00 00 	movabs $0x80222e,%r15
+  8023d8:	00 00 00 
+    while (n--) {
+  8023db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023df:	48 39 c3             	cmp    %rax,%rbx
+  8023e2:	74 37                	je     80241b <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023e4:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8023e8:	41 0f b6 fd          	movzbl %r13b,%edi
+  8023ec:	41 ff d7             	call   *%r15
+  8023ef:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8023f2:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8023f7:	41 0f b6 fe          	movzbl %r14b,%edi
+  8023fb:	41 ff d7             	call   *%r15
+  8023fe:	89 c2                	mov    %eax,%edx
+  802400:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802403:	29 d0                	sub    %edx,%eax
+  802405:	75 19                	jne    802420 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802407:	48 83 c3 01          	add    $0x1,%rbx
+  80240b:	45 84 ed             	test   %r13b,%r13b
+  80240e:	74 10                	je     802420 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802410:	49 83 c4 01          	add    $0x1,%r12
+  802414:	45 84 f6             	test   %r14b,%r14b
+  802417:	75 c2                	jne    8023db <strncasecmp+0x2e>
+  802419:	eb 05                	jmp    802420 <strncasecmp+0x73>
+  80241b:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802420:	48 83 c4 18          	add    $0x18,%rsp
+  802424:	5b                   	pop    %rbx
+  802425:	41 5c                	pop    %r12
+  802427:	41 5d                	pop    %r13
+  802429:	41 5e                	pop    %r14
+  80242b:	41 5f                	pop    %r15
+  80242d:	5d                   	pop    %rbp
+  80242e:	c3                   	ret
+    if (p1 == p2) return 0;
+  80242f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802434:	c3                   	ret
+
+0000000000802435 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802435:	83 e7 df             	and    $0xffffffdf,%edi
+  802438:	83 ef 41             	sub    $0x41,%edi
+  80243b:	83 ff 19             	cmp    $0x19,%edi
+  80243e:	0f 96 c0             	setbe  %al
+}
+  802441:	c3                   	ret
+
+0000000000802442 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802442:	83 ff 20             	cmp    $0x20,%edi
+  802445:	0f 94 c0             	sete   %al
+  802448:	83 ff 09             	cmp    $0x9,%edi
+  80244b:	0f 94 c2             	sete   %dl
+  80244e:	09 d0                	or     %edx,%eax
+}
+  802450:	c3                   	ret
+
+0000000000802451 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802451:	55                   	push   %rbp
+  802452:	48 89 e5             	mov    %rsp,%rbp
+  802455:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802457:	48 bf 1f 63 80 00 00 	movabs $0x80631f,%rdi
+  80245e:	00 00 00 
+  802461:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802468:	00 00 00 
+  80246b:	ff d0                	call   *%rax
+  80246d:	48 85 c0             	test   %rax,%rax
+  802470:	0f 95 c0             	setne  %al
+}
+  802473:	5d                   	pop    %rbp
+  802474:	c3                   	ret
+
+0000000000802475 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802475:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802478:	48 89 f8             	mov    %rdi,%rax
+  80247b:	48 f7 d8             	neg    %rax
+  80247e:	83 e0 07             	and    $0x7,%eax
+  802481:	49 89 d1             	mov    %rdx,%r9
+  802484:	49 29 c1             	sub    %rax,%r9
+  802487:	78 36                	js     8024bf <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802489:	40 0f b6 c6          	movzbl %sil,%eax
+  80248d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802494:	01 01 01 
+  802497:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80249b:	40 f6 c7 07          	test   $0x7,%dil
+  80249f:	75 38                	jne    8024d9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8024a1:	4c 89 c9             	mov    %r9,%rcx
+  8024a4:	48 c1 f9 03          	sar    $0x3,%rcx
+  8024a8:	74 0c                	je     8024b6 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8024aa:	fc                   	cld
+  8024ab:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8024ae:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8024b2:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8024b6:	4d 85 c9             	test   %r9,%r9
+  8024b9:	75 45                	jne    802500 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8024bb:	4c 89 c0             	mov    %r8,%rax
+  8024be:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8024bf:	48 85 d2             	test   %rdx,%rdx
+  8024c2:	74 f7                	je     8024bb <memset+0x46>
+  8024c4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8024c7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8024ca:	48 83 c0 01          	add    $0x1,%rax
+  8024ce:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8024d2:	48 39 c2             	cmp    %rax,%rdx
+  8024d5:	75 f3                	jne    8024ca <memset+0x55>
+  8024d7:	eb e2                	jmp    8024bb <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8024d9:	40 f6 c7 01          	test   $0x1,%dil
+  8024dd:	74 06                	je     8024e5 <memset+0x70>
+  8024df:	88 07                	mov    %al,(%rdi)
+  8024e1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8024e5:	40 f6 c7 02          	test   $0x2,%dil
+  8024e9:	74 07                	je     8024f2 <memset+0x7d>
+  8024eb:	66 89 07             	mov    %ax,(%rdi)
+  8024ee:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024f2:	40 f6 c7 04          	test   $0x4,%dil
+  8024f6:	74 a9                	je     8024a1 <memset+0x2c>
+  8024f8:	89 07                	mov    %eax,(%rdi)
+  8024fa:	48 83 c7 04          	add    $0x4,%rdi
+  8024fe:	eb a1                	jmp    8024a1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802500:	41 f6 c1 04          	test   $0x4,%r9b
+  802504:	74 06                	je     80250c <memset+0x97>
+  802506:	89 07                	mov    %eax,(%rdi)
+  802508:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80250c:	41 f6 c1 02          	test   $0x2,%r9b
+  802510:	74 07                	je     802519 <memset+0xa4>
+  802512:	66 89 07             	mov    %ax,(%rdi)
+  802515:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802519:	41 f6 c1 01          	test   $0x1,%r9b
+  80251d:	74 9c                	je     8024bb <memset+0x46>
+  80251f:	88 07                	mov    %al,(%rdi)
+  802521:	eb 98                	jmp    8024bb <memset+0x46>
+
+0000000000802523 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802523:	48 89 f8             	mov    %rdi,%rax
+  802526:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802529:	48 39 fe             	cmp    %rdi,%rsi
+  80252c:	73 3b                	jae    802569 <memmove+0x46>
+  80252e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802532:	48 39 d7             	cmp    %rdx,%rdi
+  802535:	73 32                	jae    802569 <memmove+0x46>
+        s += n;
+        d += n;
+  802537:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80253b:	48 89 d6             	mov    %rdx,%rsi
+  80253e:	48 09 fe             	or     %rdi,%rsi
+  802541:	48 09 ce             	or     %rcx,%rsi
+  802544:	40 f6 c6 07          	test   $0x7,%sil
+  802548:	75 12                	jne    80255c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80254a:	48 83 ef 08          	sub    $0x8,%rdi
+  80254e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802552:	48 c1 e9 03          	shr    $0x3,%rcx
+  802556:	fd                   	std
+  802557:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80255a:	fc                   	cld
+  80255b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80255c:	48 83 ef 01          	sub    $0x1,%rdi
+  802560:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802564:	fd                   	std
+  802565:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802567:	eb f1                	jmp    80255a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802569:	48 89 f2             	mov    %rsi,%rdx
+  80256c:	48 09 c2             	or     %rax,%rdx
+  80256f:	48 09 ca             	or     %rcx,%rdx
+  802572:	f6 c2 07             	test   $0x7,%dl
+  802575:	75 0c                	jne    802583 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802577:	48 c1 e9 03          	shr    $0x3,%rcx
+  80257b:	48 89 c7             	mov    %rax,%rdi
+  80257e:	fc                   	cld
+  80257f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802582:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802583:	48 89 c7             	mov    %rax,%rdi
+  802586:	fc                   	cld
+  802587:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802589:	c3                   	ret
+
+000000000080258a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80258a:	55                   	push   %rbp
+  80258b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80258e:	48 b8 23 25 80 00 00 	movabs $0x802523,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+}
+  80259a:	5d                   	pop    %rbp
+  80259b:	c3                   	ret
+
+000000000080259c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80259c:	55                   	push   %rbp
+  80259d:	48 89 e5             	mov    %rsp,%rbp
+  8025a0:	41 57                	push   %r15
+  8025a2:	41 56                	push   %r14
+  8025a4:	41 55                	push   %r13
+  8025a6:	41 54                	push   %r12
+  8025a8:	53                   	push   %rbx
+  8025a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ad:	49 89 fe             	mov    %rdi,%r14
+  8025b0:	49 89 f7             	mov    %rsi,%r15
+  8025b3:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8025b6:	48 89 f7             	mov    %rsi,%rdi
+  8025b9:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+  8025c5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8025c8:	48 89 de             	mov    %rbx,%rsi
+  8025cb:	4c 89 f7             	mov    %r14,%rdi
+  8025ce:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025dd:	48 39 c3             	cmp    %rax,%rbx
+  8025e0:	74 36                	je     802618 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8025e2:	48 89 d8             	mov    %rbx,%rax
+  8025e5:	4c 29 e8             	sub    %r13,%rax
+  8025e8:	49 39 c4             	cmp    %rax,%r12
+  8025eb:	73 31                	jae    80261e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8025ed:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8025f2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8025f6:	4c 89 fe             	mov    %r15,%rsi
+  8025f9:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  802600:	00 00 00 
+  802603:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802605:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802609:	48 83 c4 08          	add    $0x8,%rsp
+  80260d:	5b                   	pop    %rbx
+  80260e:	41 5c                	pop    %r12
+  802610:	41 5d                	pop    %r13
+  802612:	41 5e                	pop    %r14
+  802614:	41 5f                	pop    %r15
+  802616:	5d                   	pop    %rbp
+  802617:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802618:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80261c:	eb eb                	jmp    802609 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80261e:	48 83 eb 01          	sub    $0x1,%rbx
+  802622:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802626:	48 89 da             	mov    %rbx,%rdx
+  802629:	4c 89 fe             	mov    %r15,%rsi
+  80262c:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802638:	49 01 de             	add    %rbx,%r14
+  80263b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802640:	eb c3                	jmp    802605 <strlcat+0x69>
+
+0000000000802642 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802642:	48 85 d2             	test   %rdx,%rdx
+  802645:	74 2d                	je     802674 <memcmp+0x32>
+  802647:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80264c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802650:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802655:	44 38 c1             	cmp    %r8b,%cl
+  802658:	75 0f                	jne    802669 <memcmp+0x27>
+    while (n-- > 0) {
+  80265a:	48 83 c0 01          	add    $0x1,%rax
+  80265e:	48 39 c2             	cmp    %rax,%rdx
+  802661:	75 e9                	jne    80264c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802663:	b8 00 00 00 00       	mov    $0x0,%eax
+  802668:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802669:	0f b6 c1             	movzbl %cl,%eax
+  80266c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802670:	44 29 c0             	sub    %r8d,%eax
+  802673:	c3                   	ret
+    return 0;
+  802674:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802679:	c3                   	ret
+
+000000000080267a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80267a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80267e:	48 39 c7             	cmp    %rax,%rdi
+  802681:	73 0f                	jae    802692 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802683:	40 38 37             	cmp    %sil,(%rdi)
+  802686:	74 0e                	je     802696 <memfind+0x1c>
+    for (; src < end; src++) {
+  802688:	48 83 c7 01          	add    $0x1,%rdi
+  80268c:	48 39 f8             	cmp    %rdi,%rax
+  80268f:	75 f2                	jne    802683 <memfind+0x9>
+  802691:	c3                   	ret
+  802692:	48 89 f8             	mov    %rdi,%rax
+  802695:	c3                   	ret
+  802696:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802699:	c3                   	ret
+
+000000000080269a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80269a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80269d:	0f b6 37             	movzbl (%rdi),%esi
+  8026a0:	40 80 fe 20          	cmp    $0x20,%sil
+  8026a4:	74 06                	je     8026ac <strtol+0x12>
+  8026a6:	40 80 fe 09          	cmp    $0x9,%sil
+  8026aa:	75 13                	jne    8026bf <strtol+0x25>
+  8026ac:	48 83 c7 01          	add    $0x1,%rdi
+  8026b0:	0f b6 37             	movzbl (%rdi),%esi
+  8026b3:	40 80 fe 20          	cmp    $0x20,%sil
+  8026b7:	74 f3                	je     8026ac <strtol+0x12>
+  8026b9:	40 80 fe 09          	cmp    $0x9,%sil
+  8026bd:	74 ed                	je     8026ac <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8026bf:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8026c2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8026c5:	3c 01                	cmp    $0x1,%al
+  8026c7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026cb:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8026d1:	75 0f                	jne    8026e2 <strtol+0x48>
+  8026d3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8026d6:	74 14                	je     8026ec <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8026d8:	85 d2                	test   %edx,%edx
+  8026da:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026df:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8026e2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8026e7:	4c 63 ca             	movslq %edx,%r9
+  8026ea:	eb 36                	jmp    802722 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026ec:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8026f0:	74 0f                	je     802701 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8026f2:	85 d2                	test   %edx,%edx
+  8026f4:	75 ec                	jne    8026e2 <strtol+0x48>
+        s++;
+  8026f6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8026fa:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8026ff:	eb e1                	jmp    8026e2 <strtol+0x48>
+        s += 2;
+  802701:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802705:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80270a:	eb d6                	jmp    8026e2 <strtol+0x48>
+            dig -= '0';
+  80270c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80270f:	44 0f b6 c1          	movzbl %cl,%r8d
+  802713:	41 39 d0             	cmp    %edx,%r8d
+  802716:	7d 21                	jge    802739 <strtol+0x9f>
+        val = val * base + dig;
+  802718:	49 0f af c1          	imul   %r9,%rax
+  80271c:	0f b6 c9             	movzbl %cl,%ecx
+  80271f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802722:	48 83 c7 01          	add    $0x1,%rdi
+  802726:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80272a:	80 f9 39             	cmp    $0x39,%cl
+  80272d:	76 dd                	jbe    80270c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80272f:	80 f9 7b             	cmp    $0x7b,%cl
+  802732:	77 05                	ja     802739 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802734:	83 e9 57             	sub    $0x57,%ecx
+  802737:	eb d6                	jmp    80270f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802739:	4d 85 d2             	test   %r10,%r10
+  80273c:	74 03                	je     802741 <strtol+0xa7>
+  80273e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802741:	48 89 c2             	mov    %rax,%rdx
+  802744:	48 f7 da             	neg    %rdx
+  802747:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80274b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80274f:	c3                   	ret
+
+0000000000802750 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802750:	55                   	push   %rbp
+  802751:	48 89 e5             	mov    %rsp,%rbp
+  802754:	53                   	push   %rbx
+  802755:	48 89 fa             	mov    %rdi,%rdx
+  802758:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80275b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802760:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802765:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80276a:	be 00 00 00 00       	mov    $0x0,%esi
+  80276f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802775:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80277b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80277d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802781:	c9                   	leave
+  802782:	c3                   	ret
+
+0000000000802783 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802783:	55                   	push   %rbp
+  802784:	48 89 e5             	mov    %rsp,%rbp
+  802787:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802788:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80278d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802792:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802797:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80279c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027b8:	c9                   	leave
+  8027b9:	c3                   	ret
+
+00000000008027ba <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8027ba:	55                   	push   %rbp
+  8027bb:	48 89 e5             	mov    %rsp,%rbp
+  8027be:	53                   	push   %rbx
+  8027bf:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027e7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8027e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027ed:	c9                   	leave
+  8027ee:	c3                   	ret
+
+00000000008027ef <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8027ef:	55                   	push   %rbp
+  8027f0:	48 89 e5             	mov    %rsp,%rbp
+  8027f3:	53                   	push   %rbx
+  8027f4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8027f8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027fb:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802800:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802805:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80280a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80280f:	be 00 00 00 00       	mov    $0x0,%esi
+  802814:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80281a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802820:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802822:	48 85 c0             	test   %rax,%rax
+  802825:	7f 06                	jg     80282d <sys_env_destroy+0x3e>
+}
+  802827:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80282b:	c9                   	leave
+  80282c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80282d:	49 89 c0             	mov    %rax,%r8
+  802830:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802835:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  80283c:	00 00 00 
+  80283f:	be 27 00 00 00       	mov    $0x27,%esi
+  802844:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  80284b:	00 00 00 
+  80284e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802853:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  80285a:	00 00 00 
+  80285d:	41 ff d1             	call   *%r9
+
+0000000000802860 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802860:	55                   	push   %rbp
+  802861:	48 89 e5             	mov    %rsp,%rbp
+  802864:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802865:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80286a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802874:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802879:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80287e:	be 00 00 00 00       	mov    $0x0,%esi
+  802883:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802889:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80288f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802891:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802895:	c9                   	leave
+  802896:	c3                   	ret
+
+0000000000802897 <sys_yield>:
+
+void
+sys_yield(void) {
+  802897:	55                   	push   %rbp
+  802898:	48 89 e5             	mov    %rsp,%rbp
+  80289b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80289c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028c6:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028cc:	c9                   	leave
+  8028cd:	c3                   	ret
+
+00000000008028ce <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8028ce:	55                   	push   %rbp
+  8028cf:	48 89 e5             	mov    %rsp,%rbp
+  8028d2:	53                   	push   %rbx
+  8028d3:	48 89 fa             	mov    %rdi,%rdx
+  8028d6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028d9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028de:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8028e5:	00 00 00 
+  8028e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028fe:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802900:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802904:	c9                   	leave
+  802905:	c3                   	ret
+
+0000000000802906 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  80290a:	53                   	push   %rbx
+  80290b:	49 89 f8             	mov    %rdi,%r8
+  80290e:	48 89 d3             	mov    %rdx,%rbx
+  802911:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802914:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802919:	4c 89 c2             	mov    %r8,%rdx
+  80291c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80291f:	be 00 00 00 00       	mov    $0x0,%esi
+  802924:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80292a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802930:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802932:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802936:	c9                   	leave
+  802937:	c3                   	ret
+
+0000000000802938 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802938:	55                   	push   %rbp
+  802939:	48 89 e5             	mov    %rsp,%rbp
+  80293c:	53                   	push   %rbx
+  80293d:	48 83 ec 08          	sub    $0x8,%rsp
+  802941:	89 f8                	mov    %edi,%eax
+  802943:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802946:	48 63 f9             	movslq %ecx,%rdi
+  802949:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80294c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802951:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802954:	be 00 00 00 00       	mov    $0x0,%esi
+  802959:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80295f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802965:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802967:	48 85 c0             	test   %rax,%rax
+  80296a:	7f 06                	jg     802972 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80296c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802972:	49 89 c0             	mov    %rax,%r8
+  802975:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80297a:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802981:	00 00 00 
+  802984:	be 27 00 00 00       	mov    $0x27,%esi
+  802989:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802990:	00 00 00 
+  802993:	b8 00 00 00 00       	mov    $0x0,%eax
+  802998:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  80299f:	00 00 00 
+  8029a2:	41 ff d1             	call   *%r9
+
+00000000008029a5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8029a5:	55                   	push   %rbp
+  8029a6:	48 89 e5             	mov    %rsp,%rbp
+  8029a9:	53                   	push   %rbx
+  8029aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ae:	89 f8                	mov    %edi,%eax
+  8029b0:	49 89 f2             	mov    %rsi,%r10
+  8029b3:	48 89 cf             	mov    %rcx,%rdi
+  8029b6:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8029b9:	48 63 da             	movslq %edx,%rbx
+  8029bc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029bf:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029c4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c7:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8029ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029d2:	48 85 c0             	test   %rax,%rax
+  8029d5:	7f 06                	jg     8029dd <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8029d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029db:	c9                   	leave
+  8029dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029dd:	49 89 c0             	mov    %rax,%r8
+  8029e0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8029e5:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  8029ec:	00 00 00 
+  8029ef:	be 27 00 00 00       	mov    $0x27,%esi
+  8029f4:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  8029fb:	00 00 00 
+  8029fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a03:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802a0a:	00 00 00 
+  802a0d:	41 ff d1             	call   *%r9
+
+0000000000802a10 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802a10:	55                   	push   %rbp
+  802a11:	48 89 e5             	mov    %rsp,%rbp
+  802a14:	53                   	push   %rbx
+  802a15:	48 83 ec 08          	sub    $0x8,%rsp
+  802a19:	48 89 f1             	mov    %rsi,%rcx
+  802a1c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802a1f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a22:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a2c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a37:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a3d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a3f:	48 85 c0             	test   %rax,%rax
+  802a42:	7f 06                	jg     802a4a <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802a44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a48:	c9                   	leave
+  802a49:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a4a:	49 89 c0             	mov    %rax,%r8
+  802a4d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a52:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802a59:	00 00 00 
+  802a5c:	be 27 00 00 00       	mov    $0x27,%esi
+  802a61:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802a68:	00 00 00 
+  802a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a70:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802a77:	00 00 00 
+  802a7a:	41 ff d1             	call   *%r9
+
+0000000000802a7d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a7d:	55                   	push   %rbp
+  802a7e:	48 89 e5             	mov    %rsp,%rbp
+  802a81:	53                   	push   %rbx
+  802a82:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802a86:	48 63 ce             	movslq %esi,%rcx
+  802a89:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a8c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a96:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a9b:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aa6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802aae:	48 85 c0             	test   %rax,%rax
+  802ab1:	7f 06                	jg     802ab9 <sys_env_set_status+0x3c>
+}
+  802ab3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ab9:	49 89 c0             	mov    %rax,%r8
+  802abc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802ac1:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802ac8:	00 00 00 
+  802acb:	be 27 00 00 00       	mov    $0x27,%esi
+  802ad0:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802ad7:	00 00 00 
+  802ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adf:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802ae6:	00 00 00 
+  802ae9:	41 ff d1             	call   *%r9
+
+0000000000802aec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802aec:	55                   	push   %rbp
+  802aed:	48 89 e5             	mov    %rsp,%rbp
+  802af0:	53                   	push   %rbx
+  802af1:	48 83 ec 08          	sub    $0x8,%rsp
+  802af5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802af8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802afb:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b05:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b0a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b15:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b1d:	48 85 c0             	test   %rax,%rax
+  802b20:	7f 06                	jg     802b28 <sys_env_set_trapframe+0x3c>
+}
+  802b22:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b26:	c9                   	leave
+  802b27:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b28:	49 89 c0             	mov    %rax,%r8
+  802b2b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802b30:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802b37:	00 00 00 
+  802b3a:	be 27 00 00 00       	mov    $0x27,%esi
+  802b3f:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802b46:	00 00 00 
+  802b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4e:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802b55:	00 00 00 
+  802b58:	41 ff d1             	call   *%r9
+
+0000000000802b5b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802b5b:	55                   	push   %rbp
+  802b5c:	48 89 e5             	mov    %rsp,%rbp
+  802b5f:	53                   	push   %rbx
+  802b60:	48 83 ec 08          	sub    $0x8,%rsp
+  802b64:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802b67:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b6a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b74:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b79:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b8a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b8c:	48 85 c0             	test   %rax,%rax
+  802b8f:	7f 06                	jg     802b97 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802b91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b95:	c9                   	leave
+  802b96:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b97:	49 89 c0             	mov    %rax,%r8
+  802b9a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802b9f:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802ba6:	00 00 00 
+  802ba9:	be 27 00 00 00       	mov    $0x27,%esi
+  802bae:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802bb5:	00 00 00 
+  802bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbd:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802bc4:	00 00 00 
+  802bc7:	41 ff d1             	call   *%r9
+
+0000000000802bca <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802bca:	55                   	push   %rbp
+  802bcb:	48 89 e5             	mov    %rsp,%rbp
+  802bce:	53                   	push   %rbx
+  802bcf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802bd3:	40 0f b6 ce          	movzbl %sil,%ecx
+  802bd7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bda:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802be4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be9:	be 00 00 00 00       	mov    $0x0,%esi
+  802bee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bf4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bfa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bfc:	48 85 c0             	test   %rax,%rax
+  802bff:	7f 06                	jg     802c07 <sys_env_set_reclaim+0x3d>
+}
+  802c01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c07:	49 89 c0             	mov    %rax,%r8
+  802c0a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802c0f:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802c16:	00 00 00 
+  802c19:	be 27 00 00 00       	mov    $0x27,%esi
+  802c1e:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802c25:	00 00 00 
+  802c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2d:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802c34:	00 00 00 
+  802c37:	41 ff d1             	call   *%r9
+
+0000000000802c3a <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802c3a:	55                   	push   %rbp
+  802c3b:	48 89 e5             	mov    %rsp,%rbp
+  802c3e:	53                   	push   %rbx
+  802c3f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802c43:	48 63 ce             	movslq %esi,%rcx
+  802c46:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c49:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c53:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c58:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c69:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c6b:	48 85 c0             	test   %rax,%rax
+  802c6e:	7f 06                	jg     802c76 <sys_env_set_nice+0x3c>
+}
+  802c70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c74:	c9                   	leave
+  802c75:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c76:	49 89 c0             	mov    %rax,%r8
+  802c79:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802c7e:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802c85:	00 00 00 
+  802c88:	be 27 00 00 00       	mov    $0x27,%esi
+  802c8d:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802c94:	00 00 00 
+  802c97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c9c:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802ca3:	00 00 00 
+  802ca6:	41 ff d1             	call   *%r9
+
+0000000000802ca9 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ca9:	55                   	push   %rbp
+  802caa:	48 89 e5             	mov    %rsp,%rbp
+  802cad:	53                   	push   %rbx
+  802cae:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb1:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cc0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cc5:	be 00 00 00 00       	mov    $0x0,%esi
+  802cca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cd0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cd6:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802cd8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cdc:	c9                   	leave
+  802cdd:	c3                   	ret
+
+0000000000802cde <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802cde:	55                   	push   %rbp
+  802cdf:	48 89 e5             	mov    %rsp,%rbp
+  802ce2:	53                   	push   %rbx
+  802ce3:	89 f8                	mov    %edi,%eax
+  802ce5:	49 89 f1             	mov    %rsi,%r9
+  802ce8:	48 89 d3             	mov    %rdx,%rbx
+  802ceb:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802cee:	49 63 f0             	movslq %r8d,%rsi
+  802cf1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cf4:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cf9:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cfc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d02:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d08:	cd 30                	int    $0x30
+}
+  802d0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d0e:	c9                   	leave
+  802d0f:	c3                   	ret
+
+0000000000802d10 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d10:	55                   	push   %rbp
+  802d11:	48 89 e5             	mov    %rsp,%rbp
+  802d14:	53                   	push   %rbx
+  802d15:	89 f8                	mov    %edi,%eax
+  802d17:	49 89 f1             	mov    %rsi,%r9
+  802d1a:	48 89 d3             	mov    %rdx,%rbx
+  802d1d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d20:	49 63 f0             	movslq %r8d,%rsi
+  802d23:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d26:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d2b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d3a:	cd 30                	int    $0x30
+}
+  802d3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d40:	c9                   	leave
+  802d41:	c3                   	ret
+
+0000000000802d42 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d42:	55                   	push   %rbp
+  802d43:	48 89 e5             	mov    %rsp,%rbp
+  802d46:	53                   	push   %rbx
+  802d47:	48 83 ec 08          	sub    $0x8,%rsp
+  802d4b:	89 f8                	mov    %edi,%eax
+  802d4d:	49 89 f2             	mov    %rsi,%r10
+  802d50:	48 89 d3             	mov    %rdx,%rbx
+  802d53:	48 89 cf             	mov    %rcx,%rdi
+  802d56:	44 89 c6             	mov    %r8d,%esi
+  802d59:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d5c:	48 63 f6             	movslq %esi,%rsi
+  802d5f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d62:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d67:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d6a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d6e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d70:	48 85 c0             	test   %rax,%rax
+  802d73:	7f 06                	jg     802d7b <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d7b:	49 89 c0             	mov    %rax,%r8
+  802d7e:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802d83:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802d8a:	00 00 00 
+  802d8d:	be 27 00 00 00       	mov    $0x27,%esi
+  802d92:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802d99:	00 00 00 
+  802d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da1:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802da8:	00 00 00 
+  802dab:	41 ff d1             	call   *%r9
+
+0000000000802dae <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802dae:	55                   	push   %rbp
+  802daf:	48 89 e5             	mov    %rsp,%rbp
+  802db2:	53                   	push   %rbx
+  802db3:	48 83 ec 08          	sub    $0x8,%rsp
+  802db7:	48 89 f1             	mov    %rsi,%rcx
+  802dba:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802dbd:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802dc1:	48 8b 1a             	mov    (%rdx),%rbx
+  802dc4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dc7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dcc:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dd0:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802dd4:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802dd8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dda:	48 85 c0             	test   %rax,%rax
+  802ddd:	7f 06                	jg     802de5 <sys_ipc_call_short+0x37>
+}
+  802ddf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de3:	c9                   	leave
+  802de4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802de5:	49 89 c0             	mov    %rax,%r8
+  802de8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802ded:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802df4:	00 00 00 
+  802df7:	be 27 00 00 00       	mov    $0x27,%esi
+  802dfc:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802e03:	00 00 00 
+  802e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0b:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802e12:	00 00 00 
+  802e15:	41 ff d1             	call   *%r9
+
+0000000000802e18 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e18:	55                   	push   %rbp
+  802e19:	48 89 e5             	mov    %rsp,%rbp
+  802e1c:	53                   	push   %rbx
+  802e1d:	48 83 ec 08          	sub    $0x8,%rsp
+  802e21:	89 f8                	mov    %edi,%eax
+  802e23:	49 89 f2             	mov    %rsi,%r10
+  802e26:	48 89 d3             	mov    %rdx,%rbx
+  802e29:	48 89 cf             	mov    %rcx,%rdi
+  802e2c:	44 89 c6             	mov    %r8d,%esi
+  802e2f:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e32:	48 63 f6             	movslq %esi,%rsi
+  802e35:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e38:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e3d:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e40:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e44:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e46:	48 85 c0             	test   %rax,%rax
+  802e49:	7f 06                	jg     802e51 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e4f:	c9                   	leave
+  802e50:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e51:	49 89 c0             	mov    %rax,%r8
+  802e54:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802e59:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802e60:	00 00 00 
+  802e63:	be 27 00 00 00       	mov    $0x27,%esi
+  802e68:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802e6f:	00 00 00 
+  802e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e77:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802e7e:	00 00 00 
+  802e81:	41 ff d1             	call   *%r9
+
+0000000000802e84 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+  802e88:	53                   	push   %rbx
+  802e89:	48 83 ec 08          	sub    $0x8,%rsp
+  802e8d:	48 89 fa             	mov    %rdi,%rdx
+  802e90:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802e93:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ea2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ead:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802eb3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802eb5:	48 85 c0             	test   %rax,%rax
+  802eb8:	7f 06                	jg     802ec0 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802eba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ebe:	c9                   	leave
+  802ebf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ec0:	49 89 c0             	mov    %rax,%r8
+  802ec3:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ec8:	48 ba 28 63 80 00 00 	movabs $0x806328,%rdx
+  802ecf:	00 00 00 
+  802ed2:	be 27 00 00 00       	mov    $0x27,%esi
+  802ed7:	48 bf 47 63 80 00 00 	movabs $0x806347,%rdi
+  802ede:	00 00 00 
+  802ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee6:	49 b9 4c 17 80 00 00 	movabs $0x80174c,%r9
+  802eed:	00 00 00 
+  802ef0:	41 ff d1             	call   *%r9
+
+0000000000802ef3 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802ef3:	55                   	push   %rbp
+  802ef4:	48 89 e5             	mov    %rsp,%rbp
+  802ef7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802ef8:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802efd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f02:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f0c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f11:	be 00 00 00 00       	mov    $0x0,%esi
+  802f16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f22:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f28:	c9                   	leave
+  802f29:	c3                   	ret
+
+0000000000802f2a <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802f2a:	55                   	push   %rbp
+  802f2b:	48 89 e5             	mov    %rsp,%rbp
+  802f2e:	53                   	push   %rbx
+  802f2f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f32:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f37:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f41:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f46:	be 00 00 00 00       	mov    $0x0,%esi
+  802f4b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f51:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f57:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802f59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f5d:	c9                   	leave
+  802f5e:	c3                   	ret
+
+0000000000802f5f <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802f5f:	55                   	push   %rbp
+  802f60:	48 89 e5             	mov    %rsp,%rbp
+  802f63:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f64:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f8e:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f94:	c9                   	leave
+  802f95:	c3                   	ret
+
+0000000000802f96 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f96:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802f9d:	ff ff ff 
+  802fa0:	48 01 f8             	add    %rdi,%rax
+  802fa3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802fa7:	c3                   	ret
+
+0000000000802fa8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fa8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802faf:	ff ff ff 
+  802fb2:	48 01 f8             	add    %rdi,%rax
+  802fb5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802fb9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802fbf:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802fc3:	c3                   	ret
+
+0000000000802fc4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802fc4:	55                   	push   %rbp
+  802fc5:	48 89 e5             	mov    %rsp,%rbp
+  802fc8:	41 57                	push   %r15
+  802fca:	41 56                	push   %r14
+  802fcc:	41 55                	push   %r13
+  802fce:	41 54                	push   %r12
+  802fd0:	53                   	push   %rbx
+  802fd1:	48 83 ec 08          	sub    $0x8,%rsp
+  802fd5:	49 89 ff             	mov    %rdi,%r15
+  802fd8:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802fdd:	49 bd c4 44 80 00 00 	movabs $0x8044c4,%r13
+  802fe4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802fe7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802fed:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802ff0:	48 89 df             	mov    %rbx,%rdi
+  802ff3:	41 ff d5             	call   *%r13
+  802ff6:	83 e0 04             	and    $0x4,%eax
+  802ff9:	74 17                	je     803012 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802ffb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803002:	4c 39 f3             	cmp    %r14,%rbx
+  803005:	75 e6                	jne    802fed <fd_alloc+0x29>
+  803007:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80300d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803012:	4d 89 27             	mov    %r12,(%r15)
+}
+  803015:	48 83 c4 08          	add    $0x8,%rsp
+  803019:	5b                   	pop    %rbx
+  80301a:	41 5c                	pop    %r12
+  80301c:	41 5d                	pop    %r13
+  80301e:	41 5e                	pop    %r14
+  803020:	41 5f                	pop    %r15
+  803022:	5d                   	pop    %rbp
+  803023:	c3                   	ret
+
+0000000000803024 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803024:	83 ff 1f             	cmp    $0x1f,%edi
+  803027:	77 39                	ja     803062 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803029:	55                   	push   %rbp
+  80302a:	48 89 e5             	mov    %rsp,%rbp
+  80302d:	41 54                	push   %r12
+  80302f:	53                   	push   %rbx
+  803030:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803033:	48 63 df             	movslq %edi,%rbx
+  803036:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80303d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803041:	48 89 df             	mov    %rbx,%rdi
+  803044:	48 b8 c4 44 80 00 00 	movabs $0x8044c4,%rax
+  80304b:	00 00 00 
+  80304e:	ff d0                	call   *%rax
+  803050:	a8 04                	test   $0x4,%al
+  803052:	74 14                	je     803068 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803054:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803058:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80305d:	5b                   	pop    %rbx
+  80305e:	41 5c                	pop    %r12
+  803060:	5d                   	pop    %rbp
+  803061:	c3                   	ret
+        return -E_INVAL;
+  803062:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803067:	c3                   	ret
+        return -E_INVAL;
+  803068:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80306d:	eb ee                	jmp    80305d <fd_lookup+0x39>
+
+000000000080306f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80306f:	55                   	push   %rbp
+  803070:	48 89 e5             	mov    %rsp,%rbp
+  803073:	41 54                	push   %r12
+  803075:	53                   	push   %rbx
+  803076:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803079:	48 b8 e0 63 80 00 00 	movabs $0x8063e0,%rax
+  803080:	00 00 00 
+  803083:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  80308a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80308d:	39 3b                	cmp    %edi,(%rbx)
+  80308f:	74 47                	je     8030d8 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803091:	48 83 c0 08          	add    $0x8,%rax
+  803095:	48 8b 18             	mov    (%rax),%rbx
+  803098:	48 85 db             	test   %rbx,%rbx
+  80309b:	75 f0                	jne    80308d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80309d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8030a4:	00 00 00 
+  8030a7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8030ad:	89 fa                	mov    %edi,%edx
+  8030af:	48 bf 58 63 80 00 00 	movabs $0x806358,%rdi
+  8030b6:	00 00 00 
+  8030b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030be:	48 b9 9c 18 80 00 00 	movabs $0x80189c,%rcx
+  8030c5:	00 00 00 
+  8030c8:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8030ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8030cf:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8030d3:	5b                   	pop    %rbx
+  8030d4:	41 5c                	pop    %r12
+  8030d6:	5d                   	pop    %rbp
+  8030d7:	c3                   	ret
+            return 0;
+  8030d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030dd:	eb f0                	jmp    8030cf <dev_lookup+0x60>
+
+00000000008030df <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8030df:	55                   	push   %rbp
+  8030e0:	48 89 e5             	mov    %rsp,%rbp
+  8030e3:	41 55                	push   %r13
+  8030e5:	41 54                	push   %r12
+  8030e7:	53                   	push   %rbx
+  8030e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8030ec:	48 89 fb             	mov    %rdi,%rbx
+  8030ef:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030f2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8030f9:	ff ff ff 
+  8030fc:	48 01 df             	add    %rbx,%rdi
+  8030ff:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803103:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803107:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+  803113:	41 89 c5             	mov    %eax,%r13d
+  803116:	85 c0                	test   %eax,%eax
+  803118:	78 06                	js     803120 <fd_close+0x41>
+  80311a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80311e:	74 1a                	je     80313a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803120:	45 84 e4             	test   %r12b,%r12b
+  803123:	b8 00 00 00 00       	mov    $0x0,%eax
+  803128:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80312c:	44 89 e8             	mov    %r13d,%eax
+  80312f:	48 83 c4 18          	add    $0x18,%rsp
+  803133:	5b                   	pop    %rbx
+  803134:	41 5c                	pop    %r12
+  803136:	41 5d                	pop    %r13
+  803138:	5d                   	pop    %rbp
+  803139:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80313a:	8b 3b                	mov    (%rbx),%edi
+  80313c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803140:	48 b8 6f 30 80 00 00 	movabs $0x80306f,%rax
+  803147:	00 00 00 
+  80314a:	ff d0                	call   *%rax
+  80314c:	41 89 c5             	mov    %eax,%r13d
+  80314f:	85 c0                	test   %eax,%eax
+  803151:	78 1b                	js     80316e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803153:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803157:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80315b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803161:	48 85 c0             	test   %rax,%rax
+  803164:	74 08                	je     80316e <fd_close+0x8f>
+  803166:	48 89 df             	mov    %rbx,%rdi
+  803169:	ff d0                	call   *%rax
+  80316b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80316e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803173:	48 89 de             	mov    %rbx,%rsi
+  803176:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317b:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  803182:	00 00 00 
+  803185:	ff d0                	call   *%rax
+    return res;
+  803187:	eb a3                	jmp    80312c <fd_close+0x4d>
+
+0000000000803189 <close>:
+
+int
+close(int fdnum) {
+  803189:	55                   	push   %rbp
+  80318a:	48 89 e5             	mov    %rsp,%rbp
+  80318d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803191:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803195:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  80319c:	00 00 00 
+  80319f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031a1:	85 c0                	test   %eax,%eax
+  8031a3:	78 15                	js     8031ba <close+0x31>
+
+    return fd_close(fd, 1);
+  8031a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8031aa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031ae:	48 b8 df 30 80 00 00 	movabs $0x8030df,%rax
+  8031b5:	00 00 00 
+  8031b8:	ff d0                	call   *%rax
+}
+  8031ba:	c9                   	leave
+  8031bb:	c3                   	ret
+
+00000000008031bc <close_all>:
+
+void
+close_all(void) {
+  8031bc:	55                   	push   %rbp
+  8031bd:	48 89 e5             	mov    %rsp,%rbp
+  8031c0:	41 54                	push   %r12
+  8031c2:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8031c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031c8:	49 bc 89 31 80 00 00 	movabs $0x803189,%r12
+  8031cf:	00 00 00 
+  8031d2:	89 df                	mov    %ebx,%edi
+  8031d4:	41 ff d4             	call   *%r12
+  8031d7:	83 c3 01             	add    $0x1,%ebx
+  8031da:	83 fb 20             	cmp    $0x20,%ebx
+  8031dd:	75 f3                	jne    8031d2 <close_all+0x16>
+}
+  8031df:	5b                   	pop    %rbx
+  8031e0:	41 5c                	pop    %r12
+  8031e2:	5d                   	pop    %rbp
+  8031e3:	c3                   	ret
+
+00000000008031e4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8031e4:	55                   	push   %rbp
+  8031e5:	48 89 e5             	mov    %rsp,%rbp
+  8031e8:	41 57                	push   %r15
+  8031ea:	41 56                	push   %r14
+  8031ec:	41 55                	push   %r13
+  8031ee:	41 54                	push   %r12
+  8031f0:	53                   	push   %rbx
+  8031f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8031f5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8031f8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8031fc:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803203:	00 00 00 
+  803206:	ff d0                	call   *%rax
+  803208:	89 c3                	mov    %eax,%ebx
+  80320a:	85 c0                	test   %eax,%eax
+  80320c:	0f 88 b8 00 00 00    	js     8032ca <dup+0xe6>
+    close(newfdnum);
+  803212:	44 89 e7             	mov    %r12d,%edi
+  803215:	48 b8 89 31 80 00 00 	movabs $0x803189,%rax
+  80321c:	00 00 00 
+  80321f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803221:	4d 63 ec             	movslq %r12d,%r13
+  803224:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80322b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80322f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803233:	4c 89 ff             	mov    %r15,%rdi
+  803236:	49 be a8 2f 80 00 00 	movabs $0x802fa8,%r14
+  80323d:	00 00 00 
+  803240:	41 ff d6             	call   *%r14
+  803243:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803246:	4c 89 ef             	mov    %r13,%rdi
+  803249:	41 ff d6             	call   *%r14
+  80324c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80324f:	48 89 df             	mov    %rbx,%rdi
+  803252:	48 b8 c4 44 80 00 00 	movabs $0x8044c4,%rax
+  803259:	00 00 00 
+  80325c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80325e:	a8 04                	test   $0x4,%al
+  803260:	74 2b                	je     80328d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803262:	41 89 c1             	mov    %eax,%r9d
+  803265:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80326b:	4c 89 f1             	mov    %r14,%rcx
+  80326e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803273:	48 89 de             	mov    %rbx,%rsi
+  803276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80327b:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+  803287:	89 c3                	mov    %eax,%ebx
+  803289:	85 c0                	test   %eax,%eax
+  80328b:	78 4e                	js     8032db <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80328d:	4c 89 ff             	mov    %r15,%rdi
+  803290:	48 b8 c4 44 80 00 00 	movabs $0x8044c4,%rax
+  803297:	00 00 00 
+  80329a:	ff d0                	call   *%rax
+  80329c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80329f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032a5:	4c 89 e9             	mov    %r13,%rcx
+  8032a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ad:	4c 89 fe             	mov    %r15,%rsi
+  8032b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b5:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  8032bc:	00 00 00 
+  8032bf:	ff d0                	call   *%rax
+  8032c1:	89 c3                	mov    %eax,%ebx
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	78 14                	js     8032db <dup+0xf7>
+
+    return newfdnum;
+  8032c7:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8032ca:	89 d8                	mov    %ebx,%eax
+  8032cc:	48 83 c4 18          	add    $0x18,%rsp
+  8032d0:	5b                   	pop    %rbx
+  8032d1:	41 5c                	pop    %r12
+  8032d3:	41 5d                	pop    %r13
+  8032d5:	41 5e                	pop    %r14
+  8032d7:	41 5f                	pop    %r15
+  8032d9:	5d                   	pop    %rbp
+  8032da:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8032db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032e0:	4c 89 ee             	mov    %r13,%rsi
+  8032e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e8:	49 bc 10 2a 80 00 00 	movabs $0x802a10,%r12
+  8032ef:	00 00 00 
+  8032f2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8032f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032fa:	4c 89 f6             	mov    %r14,%rsi
+  8032fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803302:	41 ff d4             	call   *%r12
+    return res;
+  803305:	eb c3                	jmp    8032ca <dup+0xe6>
+
+0000000000803307 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803307:	55                   	push   %rbp
+  803308:	48 89 e5             	mov    %rsp,%rbp
+  80330b:	41 56                	push   %r14
+  80330d:	41 55                	push   %r13
+  80330f:	41 54                	push   %r12
+  803311:	53                   	push   %rbx
+  803312:	48 83 ec 10          	sub    $0x10,%rsp
+  803316:	89 fb                	mov    %edi,%ebx
+  803318:	49 89 f4             	mov    %rsi,%r12
+  80331b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80331e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803322:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803329:	00 00 00 
+  80332c:	ff d0                	call   *%rax
+  80332e:	85 c0                	test   %eax,%eax
+  803330:	78 4c                	js     80337e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803332:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803336:	41 8b 3e             	mov    (%r14),%edi
+  803339:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80333d:	48 b8 6f 30 80 00 00 	movabs $0x80306f,%rax
+  803344:	00 00 00 
+  803347:	ff d0                	call   *%rax
+  803349:	85 c0                	test   %eax,%eax
+  80334b:	78 35                	js     803382 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80334d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803351:	83 e0 03             	and    $0x3,%eax
+  803354:	83 f8 01             	cmp    $0x1,%eax
+  803357:	74 2d                	je     803386 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803359:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80335d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803361:	48 85 c0             	test   %rax,%rax
+  803364:	74 56                	je     8033bc <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803366:	4c 89 ea             	mov    %r13,%rdx
+  803369:	4c 89 e6             	mov    %r12,%rsi
+  80336c:	4c 89 f7             	mov    %r14,%rdi
+  80336f:	ff d0                	call   *%rax
+}
+  803371:	48 83 c4 10          	add    $0x10,%rsp
+  803375:	5b                   	pop    %rbx
+  803376:	41 5c                	pop    %r12
+  803378:	41 5d                	pop    %r13
+  80337a:	41 5e                	pop    %r14
+  80337c:	5d                   	pop    %rbp
+  80337d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80337e:	48 98                	cltq
+  803380:	eb ef                	jmp    803371 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803382:	48 98                	cltq
+  803384:	eb eb                	jmp    803371 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803386:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80338d:	00 00 00 
+  803390:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803396:	89 da                	mov    %ebx,%edx
+  803398:	48 bf 99 63 80 00 00 	movabs $0x806399,%rdi
+  80339f:	00 00 00 
+  8033a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a7:	48 b9 9c 18 80 00 00 	movabs $0x80189c,%rcx
+  8033ae:	00 00 00 
+  8033b1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033b3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033ba:	eb b5                	jmp    803371 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033bc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033c3:	eb ac                	jmp    803371 <read+0x6a>
+
+00000000008033c5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8033c5:	55                   	push   %rbp
+  8033c6:	48 89 e5             	mov    %rsp,%rbp
+  8033c9:	41 57                	push   %r15
+  8033cb:	41 56                	push   %r14
+  8033cd:	41 55                	push   %r13
+  8033cf:	41 54                	push   %r12
+  8033d1:	53                   	push   %rbx
+  8033d2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8033d6:	48 85 d2             	test   %rdx,%rdx
+  8033d9:	74 54                	je     80342f <readn+0x6a>
+  8033db:	41 89 fd             	mov    %edi,%r13d
+  8033de:	49 89 f6             	mov    %rsi,%r14
+  8033e1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8033e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8033e9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8033ee:	49 bf 07 33 80 00 00 	movabs $0x803307,%r15
+  8033f5:	00 00 00 
+  8033f8:	4c 89 e2             	mov    %r12,%rdx
+  8033fb:	48 29 f2             	sub    %rsi,%rdx
+  8033fe:	4c 01 f6             	add    %r14,%rsi
+  803401:	44 89 ef             	mov    %r13d,%edi
+  803404:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803407:	85 c0                	test   %eax,%eax
+  803409:	78 20                	js     80342b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80340b:	01 c3                	add    %eax,%ebx
+  80340d:	85 c0                	test   %eax,%eax
+  80340f:	74 08                	je     803419 <readn+0x54>
+  803411:	48 63 f3             	movslq %ebx,%rsi
+  803414:	4c 39 e6             	cmp    %r12,%rsi
+  803417:	72 df                	jb     8033f8 <readn+0x33>
+    }
+    return res;
+  803419:	48 63 c3             	movslq %ebx,%rax
+}
+  80341c:	48 83 c4 08          	add    $0x8,%rsp
+  803420:	5b                   	pop    %rbx
+  803421:	41 5c                	pop    %r12
+  803423:	41 5d                	pop    %r13
+  803425:	41 5e                	pop    %r14
+  803427:	41 5f                	pop    %r15
+  803429:	5d                   	pop    %rbp
+  80342a:	c3                   	ret
+        if (inc < 0) return inc;
+  80342b:	48 98                	cltq
+  80342d:	eb ed                	jmp    80341c <readn+0x57>
+    int inc = 1, res = 0;
+  80342f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803434:	eb e3                	jmp    803419 <readn+0x54>
+
+0000000000803436 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803436:	55                   	push   %rbp
+  803437:	48 89 e5             	mov    %rsp,%rbp
+  80343a:	41 56                	push   %r14
+  80343c:	41 55                	push   %r13
+  80343e:	41 54                	push   %r12
+  803440:	53                   	push   %rbx
+  803441:	48 83 ec 10          	sub    $0x10,%rsp
+  803445:	89 fb                	mov    %edi,%ebx
+  803447:	49 89 f4             	mov    %rsi,%r12
+  80344a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80344d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803451:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803458:	00 00 00 
+  80345b:	ff d0                	call   *%rax
+  80345d:	85 c0                	test   %eax,%eax
+  80345f:	78 47                	js     8034a8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803461:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803465:	41 8b 3e             	mov    (%r14),%edi
+  803468:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80346c:	48 b8 6f 30 80 00 00 	movabs $0x80306f,%rax
+  803473:	00 00 00 
+  803476:	ff d0                	call   *%rax
+  803478:	85 c0                	test   %eax,%eax
+  80347a:	78 30                	js     8034ac <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80347c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803481:	74 2d                	je     8034b0 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803483:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803487:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80348b:	48 85 c0             	test   %rax,%rax
+  80348e:	74 56                	je     8034e6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803490:	4c 89 ea             	mov    %r13,%rdx
+  803493:	4c 89 e6             	mov    %r12,%rsi
+  803496:	4c 89 f7             	mov    %r14,%rdi
+  803499:	ff d0                	call   *%rax
+}
+  80349b:	48 83 c4 10          	add    $0x10,%rsp
+  80349f:	5b                   	pop    %rbx
+  8034a0:	41 5c                	pop    %r12
+  8034a2:	41 5d                	pop    %r13
+  8034a4:	41 5e                	pop    %r14
+  8034a6:	5d                   	pop    %rbp
+  8034a7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034a8:	48 98                	cltq
+  8034aa:	eb ef                	jmp    80349b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034ac:	48 98                	cltq
+  8034ae:	eb eb                	jmp    80349b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034b0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034b7:	00 00 00 
+  8034ba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034c0:	89 da                	mov    %ebx,%edx
+  8034c2:	48 bf b5 63 80 00 00 	movabs $0x8063b5,%rdi
+  8034c9:	00 00 00 
+  8034cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d1:	48 b9 9c 18 80 00 00 	movabs $0x80189c,%rcx
+  8034d8:	00 00 00 
+  8034db:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8034dd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034e4:	eb b5                	jmp    80349b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8034e6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034ed:	eb ac                	jmp    80349b <write+0x65>
+
+00000000008034ef <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+  8034f3:	53                   	push   %rbx
+  8034f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8034f8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034fa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8034fe:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803505:	00 00 00 
+  803508:	ff d0                	call   *%rax
+  80350a:	85 c0                	test   %eax,%eax
+  80350c:	78 0c                	js     80351a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80350e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803512:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80351a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80351e:	c9                   	leave
+  80351f:	c3                   	ret
+
+0000000000803520 <tell>:
+
+int tell(int fdnum) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803528:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80352c:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803533:	00 00 00 
+  803536:	ff d0                	call   *%rax
+  803538:	85 c0                	test   %eax,%eax
+  80353a:	78 07                	js     803543 <tell+0x23>
+
+    return fd->fd_offset;
+  80353c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803540:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803543:	c9                   	leave
+  803544:	c3                   	ret
+
+0000000000803545 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803545:	55                   	push   %rbp
+  803546:	48 89 e5             	mov    %rsp,%rbp
+  803549:	41 55                	push   %r13
+  80354b:	41 54                	push   %r12
+  80354d:	53                   	push   %rbx
+  80354e:	48 83 ec 18          	sub    $0x18,%rsp
+  803552:	89 fb                	mov    %edi,%ebx
+  803554:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803557:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80355b:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803562:	00 00 00 
+  803565:	ff d0                	call   *%rax
+  803567:	85 c0                	test   %eax,%eax
+  803569:	78 38                	js     8035a3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80356b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80356f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803573:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803577:	48 b8 6f 30 80 00 00 	movabs $0x80306f,%rax
+  80357e:	00 00 00 
+  803581:	ff d0                	call   *%rax
+  803583:	85 c0                	test   %eax,%eax
+  803585:	78 1c                	js     8035a3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803587:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80358c:	74 20                	je     8035ae <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80358e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803592:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803596:	48 85 c0             	test   %rax,%rax
+  803599:	74 47                	je     8035e2 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80359b:	44 89 e6             	mov    %r12d,%esi
+  80359e:	4c 89 ef             	mov    %r13,%rdi
+  8035a1:	ff d0                	call   *%rax
+}
+  8035a3:	48 83 c4 18          	add    $0x18,%rsp
+  8035a7:	5b                   	pop    %rbx
+  8035a8:	41 5c                	pop    %r12
+  8035aa:	41 5d                	pop    %r13
+  8035ac:	5d                   	pop    %rbp
+  8035ad:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8035ae:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8035b5:	00 00 00 
+  8035b8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8035be:	89 da                	mov    %ebx,%edx
+  8035c0:	48 bf 78 63 80 00 00 	movabs $0x806378,%rdi
+  8035c7:	00 00 00 
+  8035ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035cf:	48 b9 9c 18 80 00 00 	movabs $0x80189c,%rcx
+  8035d6:	00 00 00 
+  8035d9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8035db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035e0:	eb c1                	jmp    8035a3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8035e2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8035e7:	eb ba                	jmp    8035a3 <ftruncate+0x5e>
+
+00000000008035e9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	41 54                	push   %r12
+  8035ef:	53                   	push   %rbx
+  8035f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035f7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035fb:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803602:	00 00 00 
+  803605:	ff d0                	call   *%rax
+  803607:	85 c0                	test   %eax,%eax
+  803609:	78 63                	js     80366e <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80360b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80360f:	41 8b 3c 24          	mov    (%r12),%edi
+  803613:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803617:	48 b8 6f 30 80 00 00 	movabs $0x80306f,%rax
+  80361e:	00 00 00 
+  803621:	ff d0                	call   *%rax
+  803623:	85 c0                	test   %eax,%eax
+  803625:	78 47                	js     80366e <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803627:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80362b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803630:	74 45                	je     803677 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803632:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803635:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80363c:	00 00 00 
+    stat->st_isdir = 0;
+  80363f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803646:	00 00 00 
+    stat->st_ino = 0;
+  803649:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803650:	00 00 00 00 
+    stat->st_version = 0;
+  803654:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80365b:	00 00 00 
+    stat->st_dev = dev;
+  80365e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803665:	48 89 de             	mov    %rbx,%rsi
+  803668:	4c 89 e7             	mov    %r12,%rdi
+  80366b:	ff 50 28             	call   *0x28(%rax)
+}
+  80366e:	48 83 c4 10          	add    $0x10,%rsp
+  803672:	5b                   	pop    %rbx
+  803673:	41 5c                	pop    %r12
+  803675:	5d                   	pop    %rbp
+  803676:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803677:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80367c:	eb f0                	jmp    80366e <fstat+0x85>
+
+000000000080367e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80367e:	55                   	push   %rbp
+  80367f:	48 89 e5             	mov    %rsp,%rbp
+  803682:	41 54                	push   %r12
+  803684:	53                   	push   %rbx
+  803685:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803688:	be 00 00 00 00       	mov    $0x0,%esi
+  80368d:	48 b8 9f 3b 80 00 00 	movabs $0x803b9f,%rax
+  803694:	00 00 00 
+  803697:	ff d0                	call   *%rax
+  803699:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80369b:	85 c0                	test   %eax,%eax
+  80369d:	78 25                	js     8036c4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80369f:	4c 89 e6             	mov    %r12,%rsi
+  8036a2:	89 c7                	mov    %eax,%edi
+  8036a4:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+  8036b0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8036b3:	89 df                	mov    %ebx,%edi
+  8036b5:	48 b8 89 31 80 00 00 	movabs $0x803189,%rax
+  8036bc:	00 00 00 
+  8036bf:	ff d0                	call   *%rax
+
+    return res;
+  8036c1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8036c4:	89 d8                	mov    %ebx,%eax
+  8036c6:	5b                   	pop    %rbx
+  8036c7:	41 5c                	pop    %r12
+  8036c9:	5d                   	pop    %rbp
+  8036ca:	c3                   	ret
+
+00000000008036cb <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036cb:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8036d2:	00 00 00 
+  8036d5:	83 38 00             	cmpl   $0x0,(%rax)
+  8036d8:	74 0a                	je     8036e4 <fsipc_env+0x19>
+    return fsenv;
+}
+  8036da:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8036e1:	00 00 
+  8036e3:	c3                   	ret
+fsipc_env(void) {
+  8036e4:	55                   	push   %rbp
+  8036e5:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036e8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8036ed:	48 b8 ce 57 80 00 00 	movabs $0x8057ce,%rax
+  8036f4:	00 00 00 
+  8036f7:	ff d0                	call   *%rax
+  8036f9:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803700:	00 00 
+}
+  803702:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803709:	00 00 
+  80370b:	5d                   	pop    %rbp
+  80370c:	c3                   	ret
+
+000000000080370d <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80370d:	55                   	push   %rbp
+  80370e:	48 89 e5             	mov    %rsp,%rbp
+  803711:	53                   	push   %rbx
+  803712:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803716:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80371d:	00 
+  80371e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803725:	00 
+  803726:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80372d:	00 
+  80372e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803735:	00 
+  803736:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80373d:	00 
+
+    assert(size <= sizeof(words));
+  80373e:	48 83 fa 28          	cmp    $0x28,%rdx
+  803742:	77 38                	ja     80377c <fsipc_short+0x6f>
+  803744:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803746:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80374a:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  803751:	00 00 00 
+  803754:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803756:	48 b8 cb 36 80 00 00 	movabs $0x8036cb,%rax
+  80375d:	00 00 00 
+  803760:	ff d0                	call   *%rax
+  803762:	89 c7                	mov    %eax,%edi
+  803764:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803768:	89 de                	mov    %ebx,%esi
+  80376a:	48 b8 31 57 80 00 00 	movabs $0x805731,%rax
+  803771:	00 00 00 
+  803774:	ff d0                	call   *%rax
+}
+  803776:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80377a:	c9                   	leave
+  80377b:	c3                   	ret
+    assert(size <= sizeof(words));
+  80377c:	48 b9 00 64 80 00 00 	movabs $0x806400,%rcx
+  803783:	00 00 00 
+  803786:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  80378d:	00 00 00 
+  803790:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803795:	48 bf 2b 64 80 00 00 	movabs $0x80642b,%rdi
+  80379c:	00 00 00 
+  80379f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a4:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  8037ab:	00 00 00 
+  8037ae:	41 ff d0             	call   *%r8
+
+00000000008037b1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8037b1:	55                   	push   %rbp
+  8037b2:	48 89 e5             	mov    %rsp,%rbp
+  8037b5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8037b9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8037bc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8037bf:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8037c2:	ba 08 00 00 00       	mov    $0x8,%edx
+  8037c7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037cb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8037d0:	48 b8 0d 37 80 00 00 	movabs $0x80370d,%rax
+  8037d7:	00 00 00 
+  8037da:	ff d0                	call   *%rax
+}
+  8037dc:	c9                   	leave
+  8037dd:	c3                   	ret
+
+00000000008037de <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8037de:	55                   	push   %rbp
+  8037df:	48 89 e5             	mov    %rsp,%rbp
+  8037e2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8037e6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8037e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8037ec:	ba 04 00 00 00       	mov    $0x4,%edx
+  8037f1:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8037f5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037fa:	48 b8 0d 37 80 00 00 	movabs $0x80370d,%rax
+  803801:	00 00 00 
+  803804:	ff d0                	call   *%rax
+}
+  803806:	c9                   	leave
+  803807:	c3                   	ret
+
+0000000000803808 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803808:	55                   	push   %rbp
+  803809:	48 89 e5             	mov    %rsp,%rbp
+  80380c:	41 54                	push   %r12
+  80380e:	53                   	push   %rbx
+  80380f:	48 83 ec 10          	sub    $0x10,%rsp
+  803813:	89 fb                	mov    %edi,%ebx
+  803815:	49 89 f4             	mov    %rsi,%r12
+  803818:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80381c:	48 b8 cb 36 80 00 00 	movabs $0x8036cb,%rax
+  803823:	00 00 00 
+  803826:	ff d0                	call   *%rax
+  803828:	89 c7                	mov    %eax,%edi
+  80382a:	6a 00                	push   $0x0
+  80382c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803830:	50                   	push   %rax
+  803831:	4d 89 e1             	mov    %r12,%r9
+  803834:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80383a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80383f:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803846:	00 00 00 
+  803849:	89 de                	mov    %ebx,%esi
+  80384b:	48 b8 cc 56 80 00 00 	movabs $0x8056cc,%rax
+  803852:	00 00 00 
+  803855:	ff d0                	call   *%rax
+}
+  803857:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80385b:	5b                   	pop    %rbx
+  80385c:	41 5c                	pop    %r12
+  80385e:	5d                   	pop    %rbp
+  80385f:	c3                   	ret
+
+0000000000803860 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803860:	55                   	push   %rbp
+  803861:	48 89 e5             	mov    %rsp,%rbp
+  803864:	41 54                	push   %r12
+  803866:	53                   	push   %rbx
+  803867:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80386a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80386d:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803874:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803876:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80387b:	be 00 00 00 00       	mov    $0x0,%esi
+  803880:	bf 05 00 00 00       	mov    $0x5,%edi
+  803885:	48 b8 08 38 80 00 00 	movabs $0x803808,%rax
+  80388c:	00 00 00 
+  80388f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803891:	85 c0                	test   %eax,%eax
+  803893:	78 5a                	js     8038ef <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803895:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80389c:	00 00 00 
+  80389f:	4c 89 e6             	mov    %r12,%rsi
+  8038a2:	48 89 df             	mov    %rbx,%rdi
+  8038a5:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  8038ac:	00 00 00 
+  8038af:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8038b1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8038b8:	00 
+  8038b9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8038bf:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8038c6:	00 
+  8038c7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8038cd:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8038d4:	00 
+  8038d5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8038dc:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8038e3:	00 
+  8038e4:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8038ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ef:	5b                   	pop    %rbx
+  8038f0:	41 5c                	pop    %r12
+  8038f2:	5d                   	pop    %rbp
+  8038f3:	c3                   	ret
+
+00000000008038f4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8038f4:	55                   	push   %rbp
+  8038f5:	48 89 e5             	mov    %rsp,%rbp
+  8038f8:	41 57                	push   %r15
+  8038fa:	41 56                	push   %r14
+  8038fc:	41 55                	push   %r13
+  8038fe:	41 54                	push   %r12
+  803900:	53                   	push   %rbx
+  803901:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803905:	48 85 ff             	test   %rdi,%rdi
+  803908:	0f 84 a1 00 00 00    	je     8039af <devfile_read+0xbb>
+  80390e:	49 89 ff             	mov    %rdi,%r15
+  803911:	49 89 f5             	mov    %rsi,%r13
+  803914:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803917:	48 85 f6             	test   %rsi,%rsi
+  80391a:	0f 84 c4 00 00 00    	je     8039e4 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803920:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803927:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803928:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80392f:	00 00 00 
+  803932:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803936:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803939:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80393d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803942:	be 00 00 00 00       	mov    $0x0,%esi
+  803947:	bf 03 00 00 00       	mov    $0x3,%edi
+  80394c:	48 b8 08 38 80 00 00 	movabs $0x803808,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+        if (res < 0) {
+  803958:	85 c0                	test   %eax,%eax
+  80395a:	0f 88 b9 00 00 00    	js     803a19 <devfile_read+0x125>
+        assert(res <= n);
+  803960:	48 63 d8             	movslq %eax,%rbx
+  803963:	49 39 dc             	cmp    %rbx,%r12
+  803966:	0f 82 b1 00 00 00    	jb     803a1d <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80396c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803971:	0f 87 db 00 00 00    	ja     803a52 <devfile_read+0x15e>
+        if (!res) {
+  803977:	85 c0                	test   %eax,%eax
+  803979:	74 21                	je     80399c <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80397b:	48 89 da             	mov    %rbx,%rdx
+  80397e:	4c 89 f6             	mov    %r14,%rsi
+  803981:	4c 89 ef             	mov    %r13,%rdi
+  803984:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  80398b:	00 00 00 
+  80398e:	ff d0                	call   *%rax
+        total_read += res;
+  803990:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803994:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803997:	49 29 dc             	sub    %rbx,%r12
+  80399a:	75 96                	jne    803932 <devfile_read+0x3e>
+    return total_read;
+  80399c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8039a0:	48 83 c4 18          	add    $0x18,%rsp
+  8039a4:	5b                   	pop    %rbx
+  8039a5:	41 5c                	pop    %r12
+  8039a7:	41 5d                	pop    %r13
+  8039a9:	41 5e                	pop    %r14
+  8039ab:	41 5f                	pop    %r15
+  8039ad:	5d                   	pop    %rbp
+  8039ae:	c3                   	ret
+    assert(fd);
+  8039af:	48 b9 36 64 80 00 00 	movabs $0x806436,%rcx
+  8039b6:	00 00 00 
+  8039b9:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  8039c0:	00 00 00 
+  8039c3:	be 91 00 00 00       	mov    $0x91,%esi
+  8039c8:	48 bf 2b 64 80 00 00 	movabs $0x80642b,%rdi
+  8039cf:	00 00 00 
+  8039d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039d7:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  8039de:	00 00 00 
+  8039e1:	41 ff d0             	call   *%r8
+    assert(buf);
+  8039e4:	48 b9 39 64 80 00 00 	movabs $0x806439,%rcx
+  8039eb:	00 00 00 
+  8039ee:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  8039f5:	00 00 00 
+  8039f8:	be 92 00 00 00       	mov    $0x92,%esi
+  8039fd:	48 bf 2b 64 80 00 00 	movabs $0x80642b,%rdi
+  803a04:	00 00 00 
+  803a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a0c:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  803a13:	00 00 00 
+  803a16:	41 ff d0             	call   *%r8
+            return res;
+  803a19:	48 98                	cltq
+  803a1b:	eb 83                	jmp    8039a0 <devfile_read+0xac>
+        assert(res <= n);
+  803a1d:	48 b9 3d 64 80 00 00 	movabs $0x80643d,%rcx
+  803a24:	00 00 00 
+  803a27:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  803a2e:	00 00 00 
+  803a31:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803a36:	48 bf 2b 64 80 00 00 	movabs $0x80642b,%rdi
+  803a3d:	00 00 00 
+  803a40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a45:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  803a4c:	00 00 00 
+  803a4f:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803a52:	48 b9 48 64 80 00 00 	movabs $0x806448,%rcx
+  803a59:	00 00 00 
+  803a5c:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  803a63:	00 00 00 
+  803a66:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803a6b:	48 bf 2b 64 80 00 00 	movabs $0x80642b,%rdi
+  803a72:	00 00 00 
+  803a75:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a7a:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  803a81:	00 00 00 
+  803a84:	41 ff d0             	call   *%r8
+
+0000000000803a87 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803a87:	55                   	push   %rbp
+  803a88:	48 89 e5             	mov    %rsp,%rbp
+  803a8b:	41 57                	push   %r15
+  803a8d:	41 56                	push   %r14
+  803a8f:	41 55                	push   %r13
+  803a91:	41 54                	push   %r12
+  803a93:	53                   	push   %rbx
+  803a94:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803a98:	48 85 ff             	test   %rdi,%rdi
+  803a9b:	0f 84 83 00 00 00    	je     803b24 <devfile_write+0x9d>
+  803aa1:	49 89 ff             	mov    %rdi,%r15
+  803aa4:	49 89 f4             	mov    %rsi,%r12
+  803aa7:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803aaa:	48 85 f6             	test   %rsi,%rsi
+  803aad:	0f 84 a6 00 00 00    	je     803b59 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803ab3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ab9:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803ac0:	00 00 00 
+  803ac3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803ac7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803aca:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803ace:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803ad3:	48 39 d3             	cmp    %rdx,%rbx
+  803ad6:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803ada:	4c 89 e6             	mov    %r12,%rsi
+  803add:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803ae4:	00 00 00 
+  803ae7:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  803aee:	00 00 00 
+  803af1:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803af3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af8:	be 00 00 00 00       	mov    $0x0,%esi
+  803afd:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b02:	48 b8 08 38 80 00 00 	movabs $0x803808,%rax
+  803b09:	00 00 00 
+  803b0c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803b0e:	85 c0                	test   %eax,%eax
+  803b10:	78 7c                	js     803b8e <devfile_write+0x107>
+        total_written += res;
+  803b12:	48 98                	cltq
+  803b14:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803b17:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803b1a:	48 29 c3             	sub    %rax,%rbx
+  803b1d:	75 a4                	jne    803ac3 <devfile_write+0x3c>
+    return total_written;
+  803b1f:	4c 89 e8             	mov    %r13,%rax
+  803b22:	eb 6c                	jmp    803b90 <devfile_write+0x109>
+    assert(fd);
+  803b24:	48 b9 36 64 80 00 00 	movabs $0x806436,%rcx
+  803b2b:	00 00 00 
+  803b2e:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  803b35:	00 00 00 
+  803b38:	be bd 00 00 00       	mov    $0xbd,%esi
+  803b3d:	48 bf 2b 64 80 00 00 	movabs $0x80642b,%rdi
+  803b44:	00 00 00 
+  803b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b4c:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  803b53:	00 00 00 
+  803b56:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b59:	48 b9 39 64 80 00 00 	movabs $0x806439,%rcx
+  803b60:	00 00 00 
+  803b63:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  803b6a:	00 00 00 
+  803b6d:	be be 00 00 00       	mov    $0xbe,%esi
+  803b72:	48 bf 2b 64 80 00 00 	movabs $0x80642b,%rdi
+  803b79:	00 00 00 
+  803b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b81:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  803b88:	00 00 00 
+  803b8b:	41 ff d0             	call   *%r8
+            return res;
+  803b8e:	48 98                	cltq
+}
+  803b90:	48 83 c4 08          	add    $0x8,%rsp
+  803b94:	5b                   	pop    %rbx
+  803b95:	41 5c                	pop    %r12
+  803b97:	41 5d                	pop    %r13
+  803b99:	41 5e                	pop    %r14
+  803b9b:	41 5f                	pop    %r15
+  803b9d:	5d                   	pop    %rbp
+  803b9e:	c3                   	ret
+
+0000000000803b9f <open>:
+open(const char *path, int mode) {
+  803b9f:	55                   	push   %rbp
+  803ba0:	48 89 e5             	mov    %rsp,%rbp
+  803ba3:	41 55                	push   %r13
+  803ba5:	41 54                	push   %r12
+  803ba7:	53                   	push   %rbx
+  803ba8:	48 83 ec 18          	sub    $0x18,%rsp
+  803bac:	49 89 fc             	mov    %rdi,%r12
+  803baf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803bb2:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  803bb9:	00 00 00 
+  803bbc:	ff d0                	call   *%rax
+  803bbe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803bc4:	0f 87 8f 00 00 00    	ja     803c59 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803bca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bce:	48 b8 c4 2f 80 00 00 	movabs $0x802fc4,%rax
+  803bd5:	00 00 00 
+  803bd8:	ff d0                	call   *%rax
+  803bda:	89 c3                	mov    %eax,%ebx
+  803bdc:	85 c0                	test   %eax,%eax
+  803bde:	78 55                	js     803c35 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803be0:	4c 89 e6             	mov    %r12,%rsi
+  803be3:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803bea:	00 00 00 
+  803bed:	48 89 df             	mov    %rbx,%rdi
+  803bf0:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  803bf7:	00 00 00 
+  803bfa:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803bfc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c08:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c0c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c11:	48 b8 08 38 80 00 00 	movabs $0x803808,%rax
+  803c18:	00 00 00 
+  803c1b:	ff d0                	call   *%rax
+  803c1d:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803c1f:	85 c0                	test   %eax,%eax
+  803c21:	78 1f                	js     803c42 <open+0xa3>
+    return fd2num(fd);
+  803c23:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c27:	48 b8 96 2f 80 00 00 	movabs $0x802f96,%rax
+  803c2e:	00 00 00 
+  803c31:	ff d0                	call   *%rax
+  803c33:	89 c3                	mov    %eax,%ebx
+}
+  803c35:	89 d8                	mov    %ebx,%eax
+  803c37:	48 83 c4 18          	add    $0x18,%rsp
+  803c3b:	5b                   	pop    %rbx
+  803c3c:	41 5c                	pop    %r12
+  803c3e:	41 5d                	pop    %r13
+  803c40:	5d                   	pop    %rbp
+  803c41:	c3                   	ret
+        fd_close(fd, 0);
+  803c42:	be 00 00 00 00       	mov    $0x0,%esi
+  803c47:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c4b:	48 b8 df 30 80 00 00 	movabs $0x8030df,%rax
+  803c52:	00 00 00 
+  803c55:	ff d0                	call   *%rax
+        return res;
+  803c57:	eb dc                	jmp    803c35 <open+0x96>
+        return -E_BAD_PATH;
+  803c59:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c5e:	eb d5                	jmp    803c35 <open+0x96>
+
+0000000000803c60 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803c60:	55                   	push   %rbp
+  803c61:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803c64:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c69:	be 00 00 00 00       	mov    $0x0,%esi
+  803c6e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c73:	48 b8 0d 37 80 00 00 	movabs $0x80370d,%rax
+  803c7a:	00 00 00 
+  803c7d:	ff d0                	call   *%rax
+}
+  803c7f:	5d                   	pop    %rbp
+  803c80:	c3                   	ret
+
+0000000000803c81 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803c81:	55                   	push   %rbp
+  803c82:	48 89 e5             	mov    %rsp,%rbp
+  803c85:	41 56                	push   %r14
+  803c87:	41 55                	push   %r13
+  803c89:	41 54                	push   %r12
+  803c8b:	53                   	push   %rbx
+  803c8c:	48 83 ec 10          	sub    $0x10,%rsp
+  803c90:	41 89 f6             	mov    %esi,%r14d
+  803c93:	49 89 d4             	mov    %rdx,%r12
+  803c96:	48 89 cb             	mov    %rcx,%rbx
+  803c99:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803c9c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ca0:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803ca7:	00 00 00 
+  803caa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cac:	85 c0                	test   %eax,%eax
+  803cae:	78 46                	js     803cf6 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803cb0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cb4:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803cbb:	00 00 00 
+  803cbe:	8b 00                	mov    (%rax),%eax
+  803cc0:	39 02                	cmp    %eax,(%rdx)
+  803cc2:	75 3f                	jne    803d03 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803cc4:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ccb:	00 00 00 
+  803cce:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803cd1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803cd3:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803cd7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803cdb:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803cdf:	48 89 da             	mov    %rbx,%rdx
+  803ce2:	4c 89 e6             	mov    %r12,%rsi
+  803ce5:	bf 09 00 00 00       	mov    $0x9,%edi
+  803cea:	48 b8 08 38 80 00 00 	movabs $0x803808,%rax
+  803cf1:	00 00 00 
+  803cf4:	ff d0                	call   *%rax
+}
+  803cf6:	48 83 c4 10          	add    $0x10,%rsp
+  803cfa:	5b                   	pop    %rbx
+  803cfb:	41 5c                	pop    %r12
+  803cfd:	41 5d                	pop    %r13
+  803cff:	41 5e                	pop    %r14
+  803d01:	5d                   	pop    %rbp
+  803d02:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d03:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d08:	eb ec                	jmp    803cf6 <file_map+0x75>
+
+0000000000803d0a <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803d0a:	55                   	push   %rbp
+  803d0b:	48 89 e5             	mov    %rsp,%rbp
+  803d0e:	41 54                	push   %r12
+  803d10:	53                   	push   %rbx
+  803d11:	48 83 ec 20          	sub    $0x20,%rsp
+  803d15:	41 89 f4             	mov    %esi,%r12d
+  803d18:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d1b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d1f:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  803d26:	00 00 00 
+  803d29:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d2b:	85 c0                	test   %eax,%eax
+  803d2d:	78 3c                	js     803d6b <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d33:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803d3a:	00 00 00 
+  803d3d:	8b 0a                	mov    (%rdx),%ecx
+  803d3f:	39 08                	cmp    %ecx,(%rax)
+  803d41:	75 31                	jne    803d74 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803d43:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d46:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803d49:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803d4d:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803d51:	ba 10 00 00 00       	mov    $0x10,%edx
+  803d56:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d5a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803d5f:	48 b8 0d 37 80 00 00 	movabs $0x80370d,%rax
+  803d66:	00 00 00 
+  803d69:	ff d0                	call   *%rax
+}
+  803d6b:	48 83 c4 20          	add    $0x20,%rsp
+  803d6f:	5b                   	pop    %rbx
+  803d70:	41 5c                	pop    %r12
+  803d72:	5d                   	pop    %rbp
+  803d73:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d74:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d79:	eb f0                	jmp    803d6b <file_msync+0x61>
+
+0000000000803d7b <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803d7b:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803d7f:	7f 01                	jg     803d82 <writebuf+0x7>
+  803d81:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803d82:	55                   	push   %rbp
+  803d83:	48 89 e5             	mov    %rsp,%rbp
+  803d86:	53                   	push   %rbx
+  803d87:	48 83 ec 08          	sub    $0x8,%rsp
+  803d8b:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803d8e:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803d92:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803d96:	8b 3f                	mov    (%rdi),%edi
+  803d98:	48 b8 36 34 80 00 00 	movabs $0x803436,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803da4:	48 85 c0             	test   %rax,%rax
+  803da7:	7e 04                	jle    803dad <writebuf+0x32>
+  803da9:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803dad:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803db1:	48 39 c2             	cmp    %rax,%rdx
+  803db4:	74 0f                	je     803dc5 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803db6:	48 85 c0             	test   %rax,%rax
+  803db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dbe:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803dc2:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803dc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dc9:	c9                   	leave
+  803dca:	c3                   	ret
+
+0000000000803dcb <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803dcb:	8b 46 04             	mov    0x4(%rsi),%eax
+  803dce:	8d 50 01             	lea    0x1(%rax),%edx
+  803dd1:	89 56 04             	mov    %edx,0x4(%rsi)
+  803dd4:	48 98                	cltq
+  803dd6:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803ddb:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803de1:	74 01                	je     803de4 <putch+0x19>
+  803de3:	c3                   	ret
+putch(int ch, void *arg) {
+  803de4:	55                   	push   %rbp
+  803de5:	48 89 e5             	mov    %rsp,%rbp
+  803de8:	53                   	push   %rbx
+  803de9:	48 83 ec 08          	sub    $0x8,%rsp
+  803ded:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803df0:	48 89 f7             	mov    %rsi,%rdi
+  803df3:	48 b8 7b 3d 80 00 00 	movabs $0x803d7b,%rax
+  803dfa:	00 00 00 
+  803dfd:	ff d0                	call   *%rax
+        state->offset = 0;
+  803dff:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e0a:	c9                   	leave
+  803e0b:	c3                   	ret
+
+0000000000803e0c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e0c:	55                   	push   %rbp
+  803e0d:	48 89 e5             	mov    %rsp,%rbp
+  803e10:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803e17:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803e1a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803e20:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803e27:	00 00 00 
+    state.result = 0;
+  803e2a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803e31:	00 00 00 00 
+    state.error = 1;
+  803e35:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803e3c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803e3f:	48 89 f2             	mov    %rsi,%rdx
+  803e42:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803e49:	48 bf cb 3d 80 00 00 	movabs $0x803dcb,%rdi
+  803e50:	00 00 00 
+  803e53:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  803e5a:	00 00 00 
+  803e5d:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803e5f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803e66:	7f 14                	jg     803e7c <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803e68:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803e6f:	48 85 c0             	test   %rax,%rax
+  803e72:	75 06                	jne    803e7a <vfprintf+0x6e>
+  803e74:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803e7a:	c9                   	leave
+  803e7b:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803e7c:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803e83:	48 b8 7b 3d 80 00 00 	movabs $0x803d7b,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+  803e8f:	eb d7                	jmp    803e68 <vfprintf+0x5c>
+
+0000000000803e91 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803e91:	55                   	push   %rbp
+  803e92:	48 89 e5             	mov    %rsp,%rbp
+  803e95:	48 83 ec 50          	sub    $0x50,%rsp
+  803e99:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803e9d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ea1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ea5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ea9:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803eb0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803eb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803eb8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ebc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ec0:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ec4:	48 b8 0c 3e 80 00 00 	movabs $0x803e0c,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ed0:	c9                   	leave
+  803ed1:	c3                   	ret
+
+0000000000803ed2 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803ed2:	55                   	push   %rbp
+  803ed3:	48 89 e5             	mov    %rsp,%rbp
+  803ed6:	48 83 ec 50          	sub    $0x50,%rsp
+  803eda:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ede:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ee2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ee6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803eea:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803eee:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803ef5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ef9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803efd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f01:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f05:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f09:	48 89 fe             	mov    %rdi,%rsi
+  803f0c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f11:	48 b8 0c 3e 80 00 00 	movabs $0x803e0c,%rax
+  803f18:	00 00 00 
+  803f1b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f1d:	c9                   	leave
+  803f1e:	c3                   	ret
+
+0000000000803f1f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f1f:	55                   	push   %rbp
+  803f20:	48 89 e5             	mov    %rsp,%rbp
+  803f23:	41 54                	push   %r12
+  803f25:	53                   	push   %rbx
+  803f26:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f29:	48 b8 a8 2f 80 00 00 	movabs $0x802fa8,%rax
+  803f30:	00 00 00 
+  803f33:	ff d0                	call   *%rax
+  803f35:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803f38:	48 be 70 64 80 00 00 	movabs $0x806470,%rsi
+  803f3f:	00 00 00 
+  803f42:	48 89 df             	mov    %rbx,%rdi
+  803f45:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  803f4c:	00 00 00 
+  803f4f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803f51:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803f56:	41 2b 04 24          	sub    (%r12),%eax
+  803f5a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803f60:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803f67:	00 00 00 
+    stat->st_dev = &devpipe;
+  803f6a:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803f71:	00 00 00 
+  803f74:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f80:	5b                   	pop    %rbx
+  803f81:	41 5c                	pop    %r12
+  803f83:	5d                   	pop    %rbp
+  803f84:	c3                   	ret
+
+0000000000803f85 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803f85:	55                   	push   %rbp
+  803f86:	48 89 e5             	mov    %rsp,%rbp
+  803f89:	41 54                	push   %r12
+  803f8b:	53                   	push   %rbx
+  803f8c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803f8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f94:	48 89 fe             	mov    %rdi,%rsi
+  803f97:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f9c:	49 bc 10 2a 80 00 00 	movabs $0x802a10,%r12
+  803fa3:	00 00 00 
+  803fa6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803fa9:	48 89 df             	mov    %rbx,%rdi
+  803fac:	48 b8 a8 2f 80 00 00 	movabs $0x802fa8,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+  803fb8:	48 89 c6             	mov    %rax,%rsi
+  803fbb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc5:	41 ff d4             	call   *%r12
+}
+  803fc8:	5b                   	pop    %rbx
+  803fc9:	41 5c                	pop    %r12
+  803fcb:	5d                   	pop    %rbp
+  803fcc:	c3                   	ret
+
+0000000000803fcd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803fcd:	55                   	push   %rbp
+  803fce:	48 89 e5             	mov    %rsp,%rbp
+  803fd1:	41 57                	push   %r15
+  803fd3:	41 56                	push   %r14
+  803fd5:	41 55                	push   %r13
+  803fd7:	41 54                	push   %r12
+  803fd9:	53                   	push   %rbx
+  803fda:	48 83 ec 18          	sub    $0x18,%rsp
+  803fde:	49 89 fc             	mov    %rdi,%r12
+  803fe1:	49 89 f5             	mov    %rsi,%r13
+  803fe4:	49 89 d7             	mov    %rdx,%r15
+  803fe7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803feb:	48 b8 a8 2f 80 00 00 	movabs $0x802fa8,%rax
+  803ff2:	00 00 00 
+  803ff5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803ff7:	4d 85 ff             	test   %r15,%r15
+  803ffa:	0f 84 af 00 00 00    	je     8040af <devpipe_write+0xe2>
+  804000:	48 89 c3             	mov    %rax,%rbx
+  804003:	4c 89 f8             	mov    %r15,%rax
+  804006:	4d 89 ef             	mov    %r13,%r15
+  804009:	4c 01 e8             	add    %r13,%rax
+  80400c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804010:	49 bd 06 29 80 00 00 	movabs $0x802906,%r13
+  804017:	00 00 00 
+            sys_yield();
+  80401a:	49 be 97 28 80 00 00 	movabs $0x802897,%r14
+  804021:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804024:	8b 73 04             	mov    0x4(%rbx),%esi
+  804027:	48 63 ce             	movslq %esi,%rcx
+  80402a:	48 63 03             	movslq (%rbx),%rax
+  80402d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804033:	48 39 c1             	cmp    %rax,%rcx
+  804036:	72 2e                	jb     804066 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804038:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80403d:	48 89 da             	mov    %rbx,%rdx
+  804040:	be 00 10 00 00       	mov    $0x1000,%esi
+  804045:	4c 89 e7             	mov    %r12,%rdi
+  804048:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80404b:	85 c0                	test   %eax,%eax
+  80404d:	74 66                	je     8040b5 <devpipe_write+0xe8>
+            sys_yield();
+  80404f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804052:	8b 73 04             	mov    0x4(%rbx),%esi
+  804055:	48 63 ce             	movslq %esi,%rcx
+  804058:	48 63 03             	movslq (%rbx),%rax
+  80405b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804061:	48 39 c1             	cmp    %rax,%rcx
+  804064:	73 d2                	jae    804038 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804066:	41 0f b6 3f          	movzbl (%r15),%edi
+  80406a:	48 89 ca             	mov    %rcx,%rdx
+  80406d:	48 c1 ea 03          	shr    $0x3,%rdx
+  804071:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804078:	08 10 20 
+  80407b:	48 f7 e2             	mul    %rdx
+  80407e:	48 c1 ea 06          	shr    $0x6,%rdx
+  804082:	48 89 d0             	mov    %rdx,%rax
+  804085:	48 c1 e0 09          	shl    $0x9,%rax
+  804089:	48 29 d0             	sub    %rdx,%rax
+  80408c:	48 c1 e0 03          	shl    $0x3,%rax
+  804090:	48 29 c1             	sub    %rax,%rcx
+  804093:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804098:	83 c6 01             	add    $0x1,%esi
+  80409b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80409e:	49 83 c7 01          	add    $0x1,%r15
+  8040a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040a6:	49 39 c7             	cmp    %rax,%r15
+  8040a9:	0f 85 75 ff ff ff    	jne    804024 <devpipe_write+0x57>
+    return n;
+  8040af:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040b3:	eb 05                	jmp    8040ba <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8040b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040ba:	48 83 c4 18          	add    $0x18,%rsp
+  8040be:	5b                   	pop    %rbx
+  8040bf:	41 5c                	pop    %r12
+  8040c1:	41 5d                	pop    %r13
+  8040c3:	41 5e                	pop    %r14
+  8040c5:	41 5f                	pop    %r15
+  8040c7:	5d                   	pop    %rbp
+  8040c8:	c3                   	ret
+
+00000000008040c9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040c9:	55                   	push   %rbp
+  8040ca:	48 89 e5             	mov    %rsp,%rbp
+  8040cd:	41 57                	push   %r15
+  8040cf:	41 56                	push   %r14
+  8040d1:	41 55                	push   %r13
+  8040d3:	41 54                	push   %r12
+  8040d5:	53                   	push   %rbx
+  8040d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8040da:	49 89 fc             	mov    %rdi,%r12
+  8040dd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8040e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8040e5:	48 b8 a8 2f 80 00 00 	movabs $0x802fa8,%rax
+  8040ec:	00 00 00 
+  8040ef:	ff d0                	call   *%rax
+  8040f1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8040f4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040fa:	49 bd 06 29 80 00 00 	movabs $0x802906,%r13
+  804101:	00 00 00 
+            sys_yield();
+  804104:	49 be 97 28 80 00 00 	movabs $0x802897,%r14
+  80410b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80410e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804113:	74 7d                	je     804192 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804115:	8b 03                	mov    (%rbx),%eax
+  804117:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80411a:	75 26                	jne    804142 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80411c:	4d 85 ff             	test   %r15,%r15
+  80411f:	75 77                	jne    804198 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804121:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804126:	48 89 da             	mov    %rbx,%rdx
+  804129:	be 00 10 00 00       	mov    $0x1000,%esi
+  80412e:	4c 89 e7             	mov    %r12,%rdi
+  804131:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804134:	85 c0                	test   %eax,%eax
+  804136:	74 72                	je     8041aa <devpipe_read+0xe1>
+            sys_yield();
+  804138:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80413b:	8b 03                	mov    (%rbx),%eax
+  80413d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804140:	74 df                	je     804121 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804142:	48 63 c8             	movslq %eax,%rcx
+  804145:	48 89 ca             	mov    %rcx,%rdx
+  804148:	48 c1 ea 03          	shr    $0x3,%rdx
+  80414c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804153:	08 10 20 
+  804156:	48 89 d0             	mov    %rdx,%rax
+  804159:	48 f7 e6             	mul    %rsi
+  80415c:	48 c1 ea 06          	shr    $0x6,%rdx
+  804160:	48 89 d0             	mov    %rdx,%rax
+  804163:	48 c1 e0 09          	shl    $0x9,%rax
+  804167:	48 29 d0             	sub    %rdx,%rax
+  80416a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804171:	00 
+  804172:	48 89 c8             	mov    %rcx,%rax
+  804175:	48 29 d0             	sub    %rdx,%rax
+  804178:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80417d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804181:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804185:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804188:	49 83 c7 01          	add    $0x1,%r15
+  80418c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804190:	75 83                	jne    804115 <devpipe_read+0x4c>
+    return n;
+  804192:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804196:	eb 03                	jmp    80419b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804198:	4c 89 f8             	mov    %r15,%rax
+}
+  80419b:	48 83 c4 18          	add    $0x18,%rsp
+  80419f:	5b                   	pop    %rbx
+  8041a0:	41 5c                	pop    %r12
+  8041a2:	41 5d                	pop    %r13
+  8041a4:	41 5e                	pop    %r14
+  8041a6:	41 5f                	pop    %r15
+  8041a8:	5d                   	pop    %rbp
+  8041a9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8041aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041af:	eb ea                	jmp    80419b <devpipe_read+0xd2>
+
+00000000008041b1 <pipe>:
+pipe(int pfd[2]) {
+  8041b1:	55                   	push   %rbp
+  8041b2:	48 89 e5             	mov    %rsp,%rbp
+  8041b5:	41 55                	push   %r13
+  8041b7:	41 54                	push   %r12
+  8041b9:	53                   	push   %rbx
+  8041ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8041be:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8041c1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8041c5:	48 b8 c4 2f 80 00 00 	movabs $0x802fc4,%rax
+  8041cc:	00 00 00 
+  8041cf:	ff d0                	call   *%rax
+  8041d1:	89 c3                	mov    %eax,%ebx
+  8041d3:	85 c0                	test   %eax,%eax
+  8041d5:	0f 88 a0 01 00 00    	js     80437b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8041db:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8041e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041e5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8041e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ee:	48 b8 38 29 80 00 00 	movabs $0x802938,%rax
+  8041f5:	00 00 00 
+  8041f8:	ff d0                	call   *%rax
+  8041fa:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8041fc:	85 c0                	test   %eax,%eax
+  8041fe:	0f 88 77 01 00 00    	js     80437b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804204:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804208:	48 b8 c4 2f 80 00 00 	movabs $0x802fc4,%rax
+  80420f:	00 00 00 
+  804212:	ff d0                	call   *%rax
+  804214:	89 c3                	mov    %eax,%ebx
+  804216:	85 c0                	test   %eax,%eax
+  804218:	0f 88 43 01 00 00    	js     804361 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80421e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804223:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804228:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80422c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804231:	48 b8 38 29 80 00 00 	movabs $0x802938,%rax
+  804238:	00 00 00 
+  80423b:	ff d0                	call   *%rax
+  80423d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80423f:	85 c0                	test   %eax,%eax
+  804241:	0f 88 1a 01 00 00    	js     804361 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804247:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80424b:	48 b8 a8 2f 80 00 00 	movabs $0x802fa8,%rax
+  804252:	00 00 00 
+  804255:	ff d0                	call   *%rax
+  804257:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80425a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80425f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804264:	48 89 c6             	mov    %rax,%rsi
+  804267:	bf 00 00 00 00       	mov    $0x0,%edi
+  80426c:	48 b8 38 29 80 00 00 	movabs $0x802938,%rax
+  804273:	00 00 00 
+  804276:	ff d0                	call   *%rax
+  804278:	89 c3                	mov    %eax,%ebx
+  80427a:	85 c0                	test   %eax,%eax
+  80427c:	0f 88 c5 00 00 00    	js     804347 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804282:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804286:	48 b8 a8 2f 80 00 00 	movabs $0x802fa8,%rax
+  80428d:	00 00 00 
+  804290:	ff d0                	call   *%rax
+  804292:	48 89 c1             	mov    %rax,%rcx
+  804295:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80429b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8042a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042a6:	4c 89 ee             	mov    %r13,%rsi
+  8042a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ae:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  8042b5:	00 00 00 
+  8042b8:	ff d0                	call   *%rax
+  8042ba:	89 c3                	mov    %eax,%ebx
+  8042bc:	85 c0                	test   %eax,%eax
+  8042be:	78 6e                	js     80432e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8042c0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042c5:	4c 89 ef             	mov    %r13,%rdi
+  8042c8:	48 b8 ce 28 80 00 00 	movabs $0x8028ce,%rax
+  8042cf:	00 00 00 
+  8042d2:	ff d0                	call   *%rax
+  8042d4:	83 f8 02             	cmp    $0x2,%eax
+  8042d7:	0f 85 ab 00 00 00    	jne    804388 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8042dd:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8042e4:	00 00 
+  8042e6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042ea:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8042ec:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8042f7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8042fb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8042fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804301:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804308:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80430c:	48 bb 96 2f 80 00 00 	movabs $0x802f96,%rbx
+  804313:	00 00 00 
+  804316:	ff d3                	call   *%rbx
+  804318:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80431c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804320:	ff d3                	call   *%rbx
+  804322:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804327:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80432c:	eb 4d                	jmp    80437b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80432e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804333:	4c 89 ee             	mov    %r13,%rsi
+  804336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80433b:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  804342:	00 00 00 
+  804345:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804347:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80434c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804350:	bf 00 00 00 00       	mov    $0x0,%edi
+  804355:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  80435c:	00 00 00 
+  80435f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804361:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804366:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80436a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80436f:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  804376:	00 00 00 
+  804379:	ff d0                	call   *%rax
+}
+  80437b:	89 d8                	mov    %ebx,%eax
+  80437d:	48 83 c4 18          	add    $0x18,%rsp
+  804381:	5b                   	pop    %rbx
+  804382:	41 5c                	pop    %r12
+  804384:	41 5d                	pop    %r13
+  804386:	5d                   	pop    %rbp
+  804387:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804388:	48 b9 88 64 80 00 00 	movabs $0x806488,%rcx
+  80438f:	00 00 00 
+  804392:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  804399:	00 00 00 
+  80439c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8043a1:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  8043a8:	00 00 00 
+  8043ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b0:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  8043b7:	00 00 00 
+  8043ba:	41 ff d0             	call   *%r8
+
+00000000008043bd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8043bd:	55                   	push   %rbp
+  8043be:	48 89 e5             	mov    %rsp,%rbp
+  8043c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043c9:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  8043d0:	00 00 00 
+  8043d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043d5:	85 c0                	test   %eax,%eax
+  8043d7:	78 35                	js     80440e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8043d9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043dd:	48 b8 a8 2f 80 00 00 	movabs $0x802fa8,%rax
+  8043e4:	00 00 00 
+  8043e7:	ff d0                	call   *%rax
+  8043e9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043ec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043f1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043f6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043fa:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  804401:	00 00 00 
+  804404:	ff d0                	call   *%rax
+  804406:	85 c0                	test   %eax,%eax
+  804408:	0f 94 c0             	sete   %al
+  80440b:	0f b6 c0             	movzbl %al,%eax
+}
+  80440e:	c9                   	leave
+  80440f:	c3                   	ret
+
+0000000000804410 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804410:	48 89 f8             	mov    %rdi,%rax
+  804413:	48 c1 e8 27          	shr    $0x27,%rax
+  804417:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80441e:	01 00 00 
+  804421:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804425:	f6 c2 01             	test   $0x1,%dl
+  804428:	74 6d                	je     804497 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80442a:	48 89 f8             	mov    %rdi,%rax
+  80442d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804431:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804438:	01 00 00 
+  80443b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80443f:	f6 c2 01             	test   $0x1,%dl
+  804442:	74 62                	je     8044a6 <get_uvpt_entry+0x96>
+  804444:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80444b:	01 00 00 
+  80444e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804452:	f6 c2 80             	test   $0x80,%dl
+  804455:	75 4f                	jne    8044a6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804457:	48 89 f8             	mov    %rdi,%rax
+  80445a:	48 c1 e8 15          	shr    $0x15,%rax
+  80445e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804465:	01 00 00 
+  804468:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80446c:	f6 c2 01             	test   $0x1,%dl
+  80446f:	74 44                	je     8044b5 <get_uvpt_entry+0xa5>
+  804471:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804478:	01 00 00 
+  80447b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80447f:	f6 c2 80             	test   $0x80,%dl
+  804482:	75 31                	jne    8044b5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804484:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804488:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80448f:	01 00 00 
+  804492:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804496:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804497:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80449e:	01 00 00 
+  8044a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044a5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044a6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044ad:	01 00 00 
+  8044b0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044b4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044b5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044bc:	01 00 00 
+  8044bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044c3:	c3                   	ret
+
+00000000008044c4 <get_prot>:
+
+int
+get_prot(void *va) {
+  8044c4:	55                   	push   %rbp
+  8044c5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044c8:	48 b8 10 44 80 00 00 	movabs $0x804410,%rax
+  8044cf:	00 00 00 
+  8044d2:	ff d0                	call   *%rax
+  8044d4:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8044d7:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8044dc:	89 c1                	mov    %eax,%ecx
+  8044de:	83 c9 04             	or     $0x4,%ecx
+  8044e1:	f6 c2 01             	test   $0x1,%dl
+  8044e4:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8044e7:	89 c1                	mov    %eax,%ecx
+  8044e9:	83 c9 02             	or     $0x2,%ecx
+  8044ec:	f6 c2 02             	test   $0x2,%dl
+  8044ef:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8044f2:	89 c1                	mov    %eax,%ecx
+  8044f4:	83 c9 01             	or     $0x1,%ecx
+  8044f7:	48 85 d2             	test   %rdx,%rdx
+  8044fa:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8044fd:	89 c1                	mov    %eax,%ecx
+  8044ff:	83 c9 40             	or     $0x40,%ecx
+  804502:	f6 c6 04             	test   $0x4,%dh
+  804505:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804508:	5d                   	pop    %rbp
+  804509:	c3                   	ret
+
+000000000080450a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80450a:	55                   	push   %rbp
+  80450b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80450e:	48 b8 10 44 80 00 00 	movabs $0x804410,%rax
+  804515:	00 00 00 
+  804518:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80451a:	48 c1 e8 06          	shr    $0x6,%rax
+  80451e:	83 e0 01             	and    $0x1,%eax
+}
+  804521:	5d                   	pop    %rbp
+  804522:	c3                   	ret
+
+0000000000804523 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804523:	55                   	push   %rbp
+  804524:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804527:	48 b8 10 44 80 00 00 	movabs $0x804410,%rax
+  80452e:	00 00 00 
+  804531:	ff d0                	call   *%rax
+  804533:	83 e0 01             	and    $0x1,%eax
+}
+  804536:	5d                   	pop    %rbp
+  804537:	c3                   	ret
+
+0000000000804538 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804538:	55                   	push   %rbp
+  804539:	48 89 e5             	mov    %rsp,%rbp
+  80453c:	41 57                	push   %r15
+  80453e:	41 56                	push   %r14
+  804540:	41 55                	push   %r13
+  804542:	41 54                	push   %r12
+  804544:	53                   	push   %rbx
+  804545:	48 83 ec 28          	sub    $0x28,%rsp
+  804549:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80454d:	48 85 ff             	test   %rdi,%rdi
+  804550:	74 1e                	je     804570 <foreach_shared_region+0x38>
+  804552:	49 89 ff             	mov    %rdi,%r15
+  804555:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80455b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804561:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804568:	01 00 00 
+  80456b:	e9 72 02 00 00       	jmp    8047e2 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804570:	48 b9 ac 64 80 00 00 	movabs $0x8064ac,%rcx
+  804577:	00 00 00 
+  80457a:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  804581:	00 00 00 
+  804584:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804589:	48 bf b0 64 80 00 00 	movabs $0x8064b0,%rdi
+  804590:	00 00 00 
+  804593:	b8 00 00 00 00       	mov    $0x0,%eax
+  804598:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  80459f:	00 00 00 
+  8045a2:	41 ff d0             	call   *%r8
+  8045a5:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8045ac:	eb 6c                	jmp    80461a <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8045ae:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8045b5:	ff ff ff 
+  8045b8:	4c 21 e2             	and    %r12,%rdx
+  8045bb:	48 89 d8             	mov    %rbx,%rax
+  8045be:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8045c3:	48 83 c0 01          	add    $0x1,%rax
+  8045c7:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8045cb:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8045d2:	00 00 00 
+  8045d5:	48 21 c8             	and    %rcx,%rax
+  8045d8:	48 09 d0             	or     %rdx,%rax
+  8045db:	49 89 c4             	mov    %rax,%r12
+  8045de:	eb 30                	jmp    804610 <foreach_shared_region+0xd8>
+  8045e0:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8045e7:	ff ff ff 
+  8045ea:	4c 21 e2             	and    %r12,%rdx
+  8045ed:	48 89 d8             	mov    %rbx,%rax
+  8045f0:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8045f5:	48 83 c0 01          	add    $0x1,%rax
+  8045f9:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8045fd:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804604:	00 00 00 
+  804607:	48 21 c8             	and    %rcx,%rax
+  80460a:	48 09 d0             	or     %rdx,%rax
+  80460d:	49 89 c4             	mov    %rax,%r12
+  804610:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804614:	0f 84 99 01 00 00    	je     8047b3 <foreach_shared_region+0x27b>
+  80461a:	4c 89 e3             	mov    %r12,%rbx
+  80461d:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804621:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804628:	01 00 00 
+  80462b:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80462f:	a8 01                	test   $0x1,%al
+  804631:	0f 84 77 ff ff ff    	je     8045ae <foreach_shared_region+0x76>
+  804637:	a8 80                	test   $0x80,%al
+  804639:	74 19                	je     804654 <foreach_shared_region+0x11c>
+  80463b:	f6 c4 04             	test   $0x4,%ah
+  80463e:	74 a0                	je     8045e0 <foreach_shared_region+0xa8>
+  804640:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804647:	40 
+  804648:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80464c:	4c 89 e7             	mov    %r12,%rdi
+  80464f:	41 ff d7             	call   *%r15
+  804652:	eb 8c                	jmp    8045e0 <foreach_shared_region+0xa8>
+  804654:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80465b:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80465f:	eb 46                	jmp    8046a7 <foreach_shared_region+0x16f>
+  804661:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804668:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80466e:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804672:	48 c1 e0 15          	shl    $0x15,%rax
+  804676:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80467b:	49 09 c4             	or     %rax,%r12
+  80467e:	eb 1d                	jmp    80469d <foreach_shared_region+0x165>
+  804680:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804687:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80468d:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804691:	48 c1 e0 15          	shl    $0x15,%rax
+  804695:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80469a:	49 09 c4             	or     %rax,%r12
+  80469d:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8046a1:	0f 84 d3 00 00 00    	je     80477a <foreach_shared_region+0x242>
+  8046a7:	4c 89 e3             	mov    %r12,%rbx
+  8046aa:	48 c1 eb 15          	shr    $0x15,%rbx
+  8046ae:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8046b5:	01 00 00 
+  8046b8:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8046bc:	a8 01                	test   $0x1,%al
+  8046be:	74 a1                	je     804661 <foreach_shared_region+0x129>
+  8046c0:	a8 80                	test   $0x80,%al
+  8046c2:	74 19                	je     8046dd <foreach_shared_region+0x1a5>
+  8046c4:	f6 c4 04             	test   $0x4,%ah
+  8046c7:	74 b7                	je     804680 <foreach_shared_region+0x148>
+  8046c9:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8046d0:	00 
+  8046d1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046d5:	4c 89 e7             	mov    %r12,%rdi
+  8046d8:	41 ff d7             	call   *%r15
+  8046db:	eb a3                	jmp    804680 <foreach_shared_region+0x148>
+  8046dd:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8046e3:	eb 3b                	jmp    804720 <foreach_shared_region+0x1e8>
+  8046e5:	f6 c4 04             	test   $0x4,%ah
+  8046e8:	74 12                	je     8046fc <foreach_shared_region+0x1c4>
+  8046ea:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8046f1:	00 
+  8046f2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046f6:	4c 89 e7             	mov    %r12,%rdi
+  8046f9:	41 ff d7             	call   *%r15
+  8046fc:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804703:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804709:	48 83 c3 01          	add    $0x1,%rbx
+  80470d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804711:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804717:	49 09 dc             	or     %rbx,%r12
+  80471a:	41 83 ed 01          	sub    $0x1,%r13d
+  80471e:	74 2f                	je     80474f <foreach_shared_region+0x217>
+  804720:	4c 89 e3             	mov    %r12,%rbx
+  804723:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804727:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80472b:	a8 01                	test   $0x1,%al
+  80472d:	75 b6                	jne    8046e5 <foreach_shared_region+0x1ad>
+  80472f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804736:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80473c:	48 83 c3 01          	add    $0x1,%rbx
+  804740:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804744:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80474a:	49 09 dc             	or     %rbx,%r12
+  80474d:	eb cb                	jmp    80471a <foreach_shared_region+0x1e2>
+  80474f:	4c 89 e0             	mov    %r12,%rax
+  804752:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804758:	49 c1 ec 15          	shr    $0x15,%r12
+  80475c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804763:	49 83 c4 01          	add    $0x1,%r12
+  804767:	49 c1 e4 15          	shl    $0x15,%r12
+  80476b:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804772:	49 09 c4             	or     %rax,%r12
+  804775:	e9 23 ff ff ff       	jmp    80469d <foreach_shared_region+0x165>
+  80477a:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80477e:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804785:	ff ff ff 
+  804788:	4c 21 e0             	and    %r12,%rax
+  80478b:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80478f:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804796:	49 83 c4 01          	add    $0x1,%r12
+  80479a:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80479e:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8047a5:	00 00 00 
+  8047a8:	49 21 d4             	and    %rdx,%r12
+  8047ab:	49 09 c4             	or     %rax,%r12
+  8047ae:	e9 5d fe ff ff       	jmp    804610 <foreach_shared_region+0xd8>
+  8047b3:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8047ba:	00 ff ff 
+  8047bd:	4c 21 e0             	and    %r12,%rax
+  8047c0:	49 c1 ec 27          	shr    $0x27,%r12
+  8047c4:	49 83 c4 01          	add    $0x1,%r12
+  8047c8:	49 c1 e4 27          	shl    $0x27,%r12
+  8047cc:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8047d3:	ff 00 00 
+  8047d6:	49 21 d4             	and    %rdx,%r12
+  8047d9:	49 09 c4             	or     %rax,%r12
+  8047dc:	41 83 ed 01          	sub    $0x1,%r13d
+  8047e0:	74 48                	je     80482a <foreach_shared_region+0x2f2>
+  8047e2:	4c 89 e0             	mov    %r12,%rax
+  8047e5:	48 c1 e8 27          	shr    $0x27,%rax
+  8047e9:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8047f0:	01 00 00 
+  8047f3:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8047f7:	f6 c2 01             	test   $0x1,%dl
+  8047fa:	0f 85 a5 fd ff ff    	jne    8045a5 <foreach_shared_region+0x6d>
+  804800:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804807:	00 ff ff 
+  80480a:	4c 21 e2             	and    %r12,%rdx
+  80480d:	48 83 c0 01          	add    $0x1,%rax
+  804811:	48 c1 e0 27          	shl    $0x27,%rax
+  804815:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80481c:	ff 00 00 
+  80481f:	48 21 c8             	and    %rcx,%rax
+  804822:	48 09 d0             	or     %rdx,%rax
+  804825:	49 89 c4             	mov    %rax,%r12
+  804828:	eb b2                	jmp    8047dc <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80482a:	4d 85 e4             	test   %r12,%r12
+  80482d:	75 14                	jne    804843 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80482f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804834:	48 83 c4 28          	add    $0x28,%rsp
+  804838:	5b                   	pop    %rbx
+  804839:	41 5c                	pop    %r12
+  80483b:	41 5d                	pop    %r13
+  80483d:	41 5e                	pop    %r14
+  80483f:	41 5f                	pop    %r15
+  804841:	5d                   	pop    %rbp
+  804842:	c3                   	ret
+    assert(addr == 0);
+  804843:	48 b9 bb 64 80 00 00 	movabs $0x8064bb,%rcx
+  80484a:	00 00 00 
+  80484d:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  804854:	00 00 00 
+  804857:	be 67 00 00 00       	mov    $0x67,%esi
+  80485c:	48 bf b0 64 80 00 00 	movabs $0x8064b0,%rdi
+  804863:	00 00 00 
+  804866:	b8 00 00 00 00       	mov    $0x0,%eax
+  80486b:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  804872:	00 00 00 
+  804875:	41 ff d0             	call   *%r8
+
+0000000000804878 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804878:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  80487f:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804882:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804888:	eb 33                	jmp    8048bd <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80488a:	48 83 c0 20          	add    $0x20,%rax
+  80488e:	4c 39 c0             	cmp    %r8,%rax
+  804891:	74 25                	je     8048b8 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804893:	48 8b 10             	mov    (%rax),%rdx
+  804896:	48 85 d2             	test   %rdx,%rdx
+  804899:	74 ef                	je     80488a <mmap_place+0x12>
+  80489b:	48 89 d1             	mov    %rdx,%rcx
+  80489e:	48 03 48 08          	add    0x8(%rax),%rcx
+  8048a2:	48 39 cf             	cmp    %rcx,%rdi
+  8048a5:	73 e3                	jae    80488a <mmap_place+0x12>
+  8048a7:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8048ab:	4c 39 ca             	cmp    %r9,%rdx
+  8048ae:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8048b2:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8048b6:	eb d2                	jmp    80488a <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8048b8:	45 84 d2             	test   %r10b,%r10b
+  8048bb:	74 12                	je     8048cf <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8048bd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8048c4:	00 00 00 
+        moved = 0;
+  8048c7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8048cd:	eb c4                	jmp    804893 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8048cf:	48 01 fe             	add    %rdi,%rsi
+  8048d2:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8048d9:	00 00 00 
+  8048dc:	48 39 f0             	cmp    %rsi,%rax
+  8048df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048e4:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8048e8:	c3                   	ret
+
+00000000008048e9 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8048e9:	55                   	push   %rbp
+  8048ea:	48 89 e5             	mov    %rsp,%rbp
+  8048ed:	41 57                	push   %r15
+  8048ef:	41 56                	push   %r14
+  8048f1:	41 55                	push   %r13
+  8048f3:	41 54                	push   %r12
+  8048f5:	53                   	push   %rbx
+  8048f6:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8048fa:	48 8b 1f             	mov    (%rdi),%rbx
+  8048fd:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804904:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80490b:	00 00 00 
+  80490e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804913:	eb 12                	jmp    804927 <mmap_pgfault+0x3e>
+  804915:	48 83 c2 01          	add    $0x1,%rdx
+  804919:	48 83 c0 20          	add    $0x20,%rax
+  80491d:	48 83 fa 20          	cmp    $0x20,%rdx
+  804921:	0f 84 04 01 00 00    	je     804a2b <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804927:	48 8b 08             	mov    (%rax),%rcx
+  80492a:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80492e:	48 39 de             	cmp    %rbx,%rsi
+  804931:	73 e2                	jae    804915 <mmap_pgfault+0x2c>
+  804933:	48 03 48 08          	add    0x8(%rax),%rcx
+  804937:	48 39 cb             	cmp    %rcx,%rbx
+  80493a:	73 d9                	jae    804915 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80493c:	48 c1 e2 05          	shl    $0x5,%rdx
+  804940:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804947:	00 00 00 
+  80494a:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80494e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804952:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804956:	f6 c2 01             	test   $0x1,%dl
+  804959:	0f 84 e0 00 00 00    	je     804a3f <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80495f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804964:	f6 c2 02             	test   $0x2,%dl
+  804967:	0f 84 c3 00 00 00    	je     804a30 <mmap_pgfault+0x147>
+  80496d:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804974:	ff ff ff 
+  804977:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80497b:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804982:	00 00 00 
+  804985:	48 39 ca             	cmp    %rcx,%rdx
+  804988:	0f 85 a2 00 00 00    	jne    804a30 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80498e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804993:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804998:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80499f:	00 00 00 
+  8049a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049a7:	48 b8 38 29 80 00 00 	movabs $0x802938,%rax
+  8049ae:	00 00 00 
+  8049b1:	ff d0                	call   *%rax
+  8049b3:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8049b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049ba:	85 d2                	test   %edx,%edx
+  8049bc:	78 72                	js     804a30 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8049be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049c3:	48 89 de             	mov    %rbx,%rsi
+  8049c6:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8049cd:	00 00 00 
+  8049d0:	4c 89 e7             	mov    %r12,%rdi
+  8049d3:	48 b8 8a 25 80 00 00 	movabs $0x80258a,%rax
+  8049da:	00 00 00 
+  8049dd:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8049df:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8049e5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8049eb:	48 89 d9             	mov    %rbx,%rcx
+  8049ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f3:	4c 89 e6             	mov    %r12,%rsi
+  8049f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049fb:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  804a02:	00 00 00 
+  804a05:	ff d0                	call   *%rax
+  804a07:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804a09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a0e:	4c 89 e6             	mov    %r12,%rsi
+  804a11:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a16:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  804a1d:	00 00 00 
+  804a20:	ff d0                	call   *%rax
+    return res >= 0;
+  804a22:	89 d8                	mov    %ebx,%eax
+  804a24:	f7 d0                	not    %eax
+  804a26:	c1 e8 1f             	shr    $0x1f,%eax
+  804a29:	eb 05                	jmp    804a30 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804a30:	48 83 c4 18          	add    $0x18,%rsp
+  804a34:	5b                   	pop    %rbx
+  804a35:	41 5c                	pop    %r12
+  804a37:	41 5d                	pop    %r13
+  804a39:	41 5e                	pop    %r14
+  804a3b:	41 5f                	pop    %r15
+  804a3d:	5d                   	pop    %rbp
+  804a3e:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804a3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a43:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804a47:	4c 03 30             	add    (%rax),%r14
+  804a4a:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804a51:	49 39 c6             	cmp    %rax,%r14
+  804a54:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a58:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804a5f:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a65:	49 bf 23 45 80 00 00 	movabs $0x804523,%r15
+  804a6c:	00 00 00 
+  804a6f:	4d 39 f4             	cmp    %r14,%r12
+  804a72:	73 1d                	jae    804a91 <mmap_pgfault+0x1a8>
+  804a74:	4c 89 e7             	mov    %r12,%rdi
+  804a77:	41 ff d7             	call   *%r15
+  804a7a:	84 c0                	test   %al,%al
+  804a7c:	75 13                	jne    804a91 <mmap_pgfault+0x1a8>
+  804a7e:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804a85:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804a8c:	4d 39 f4             	cmp    %r14,%r12
+  804a8f:	72 e3                	jb     804a74 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804a91:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804a97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a9b:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804a9f:	74 2a                	je     804acb <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804aa1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aa5:	89 de                	mov    %ebx,%esi
+  804aa7:	2b 30                	sub    (%rax),%esi
+  804aa9:	03 70 1c             	add    0x1c(%rax),%esi
+  804aac:	8b 78 18             	mov    0x18(%rax),%edi
+  804aaf:	4c 89 e9             	mov    %r13,%rcx
+  804ab2:	48 89 da             	mov    %rbx,%rdx
+  804ab5:	48 b8 81 3c 80 00 00 	movabs $0x803c81,%rax
+  804abc:	00 00 00 
+  804abf:	ff d0                	call   *%rax
+    return res > 0;
+  804ac1:	85 c0                	test   %eax,%eax
+  804ac3:	0f 9f c0             	setg   %al
+  804ac6:	e9 65 ff ff ff       	jmp    804a30 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804acb:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804acf:	eb d0                	jmp    804aa1 <mmap_pgfault+0x1b8>
+
+0000000000804ad1 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804ad1:	55                   	push   %rbp
+  804ad2:	48 89 e5             	mov    %rsp,%rbp
+  804ad5:	41 57                	push   %r15
+  804ad7:	41 56                	push   %r14
+  804ad9:	41 55                	push   %r13
+  804adb:	41 54                	push   %r12
+  804add:	53                   	push   %rbx
+  804ade:	48 83 ec 28          	sub    $0x28,%rsp
+  804ae2:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804ae6:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804ae9:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804af0:	ff ff ff 
+  804af3:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804afc:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804b03:	00 00 00 
+  804b06:	48 39 ca             	cmp    %rcx,%rdx
+  804b09:	0f 85 e5 00 00 00    	jne    804bf4 <mmap_writeback+0x123>
+  804b0f:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804b12:	4c 39 ee             	cmp    %r13,%rsi
+  804b15:	0f 83 e8 00 00 00    	jae    804c03 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b1b:	49 be 23 45 80 00 00 	movabs $0x804523,%r14
+  804b22:	00 00 00 
+  804b25:	49 bf 0a 45 80 00 00 	movabs $0x80450a,%r15
+  804b2c:	00 00 00 
+  804b2f:	eb 10                	jmp    804b41 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804b31:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804b38:	4d 39 ec             	cmp    %r13,%r12
+  804b3b:	0f 83 ae 00 00 00    	jae    804bef <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b41:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804b45:	4c 89 e7             	mov    %r12,%rdi
+  804b48:	41 ff d6             	call   *%r14
+  804b4b:	84 c0                	test   %al,%al
+  804b4d:	74 e2                	je     804b31 <mmap_writeback+0x60>
+  804b4f:	4c 89 e7             	mov    %r12,%rdi
+  804b52:	41 ff d7             	call   *%r15
+  804b55:	84 c0                	test   %al,%al
+  804b57:	74 d8                	je     804b31 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804b59:	4c 89 e3             	mov    %r12,%rbx
+  804b5c:	4d 39 ec             	cmp    %r13,%r12
+  804b5f:	73 20                	jae    804b81 <mmap_writeback+0xb0>
+  804b61:	48 89 df             	mov    %rbx,%rdi
+  804b64:	41 ff d6             	call   *%r14
+  804b67:	84 c0                	test   %al,%al
+  804b69:	74 16                	je     804b81 <mmap_writeback+0xb0>
+  804b6b:	48 89 df             	mov    %rbx,%rdi
+  804b6e:	41 ff d7             	call   *%r15
+  804b71:	84 c0                	test   %al,%al
+  804b73:	74 0c                	je     804b81 <mmap_writeback+0xb0>
+  804b75:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804b7c:	4c 39 eb             	cmp    %r13,%rbx
+  804b7f:	72 e0                	jb     804b61 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804b81:	48 89 d9             	mov    %rbx,%rcx
+  804b84:	4c 29 e1             	sub    %r12,%rcx
+  804b87:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804b8b:	44 89 e6             	mov    %r12d,%esi
+  804b8e:	2b 30                	sub    (%rax),%esi
+  804b90:	49 89 c4             	mov    %rax,%r12
+  804b93:	03 70 1c             	add    0x1c(%rax),%esi
+  804b96:	8b 78 18             	mov    0x18(%rax),%edi
+  804b99:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804b9d:	48 89 ca             	mov    %rcx,%rdx
+  804ba0:	48 b8 0a 3d 80 00 00 	movabs $0x803d0a,%rax
+  804ba7:	00 00 00 
+  804baa:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804bac:	85 c0                	test   %eax,%eax
+  804bae:	78 44                	js     804bf4 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804bb0:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804bb5:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804bb8:	41 89 c1             	mov    %eax,%r9d
+  804bbb:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804bc2:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804bc6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bcf:	48 89 ce             	mov    %rcx,%rsi
+  804bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bd7:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  804bde:	00 00 00 
+  804be1:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804be3:	85 c0                	test   %eax,%eax
+  804be5:	78 0d                	js     804bf4 <mmap_writeback+0x123>
+  804be7:	49 89 dc             	mov    %rbx,%r12
+  804bea:	e9 49 ff ff ff       	jmp    804b38 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804bef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804bf4:	48 83 c4 28          	add    $0x28,%rsp
+  804bf8:	5b                   	pop    %rbx
+  804bf9:	41 5c                	pop    %r12
+  804bfb:	41 5d                	pop    %r13
+  804bfd:	41 5e                	pop    %r14
+  804bff:	41 5f                	pop    %r15
+  804c01:	5d                   	pop    %rbp
+  804c02:	c3                   	ret
+    return 0;
+  804c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c08:	eb ea                	jmp    804bf4 <mmap_writeback+0x123>
+
+0000000000804c0a <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804c0a:	55                   	push   %rbp
+  804c0b:	48 89 e5             	mov    %rsp,%rbp
+  804c0e:	41 57                	push   %r15
+  804c10:	41 56                	push   %r14
+  804c12:	41 55                	push   %r13
+  804c14:	41 54                	push   %r12
+  804c16:	53                   	push   %rbx
+  804c17:	48 83 ec 38          	sub    $0x38,%rsp
+  804c1b:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c1f:	48 85 f6             	test   %rsi,%rsi
+  804c22:	0f 84 0c 02 00 00    	je     804e34 <mmap+0x22a>
+  804c28:	49 89 ff             	mov    %rdi,%r15
+  804c2b:	49 89 f4             	mov    %rsi,%r12
+  804c2e:	41 89 d5             	mov    %edx,%r13d
+  804c31:	41 89 ce             	mov    %ecx,%r14d
+  804c34:	44 89 cb             	mov    %r9d,%ebx
+  804c37:	45 85 c9             	test   %r9d,%r9d
+  804c3a:	0f 88 f4 01 00 00    	js     804e34 <mmap+0x22a>
+  804c40:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c47:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804c4e:	0f 85 e7 01 00 00    	jne    804e3b <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804c54:	83 e2 fd             	and    $0xfffffffd,%edx
+  804c57:	83 fa 04             	cmp    $0x4,%edx
+  804c5a:	0f 85 db 01 00 00    	jne    804e3b <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804c60:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804c63:	83 fa 01             	cmp    $0x1,%edx
+  804c66:	0f 87 cf 01 00 00    	ja     804e3b <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804c6c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804c70:	44 89 c7             	mov    %r8d,%edi
+  804c73:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  804c7a:	00 00 00 
+  804c7d:	ff d0                	call   *%rax
+  804c7f:	89 c2                	mov    %eax,%edx
+  804c81:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c88:	85 d2                	test   %edx,%edx
+  804c8a:	0f 88 ab 01 00 00    	js     804e3b <mmap+0x231>
+  804c90:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c94:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804c9b:	00 00 00 
+  804c9e:	8b 09                	mov    (%rcx),%ecx
+  804ca0:	39 0a                	cmp    %ecx,(%rdx)
+  804ca2:	0f 85 93 01 00 00    	jne    804e3b <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804ca8:	8b 52 08             	mov    0x8(%rdx),%edx
+  804cab:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804cae:	83 fa 01             	cmp    $0x1,%edx
+  804cb1:	0f 84 84 01 00 00    	je     804e3b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804cb7:	41 83 fe 01          	cmp    $0x1,%r14d
+  804cbb:	74 42                	je     804cff <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804cbd:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804cc4:	4c 89 e6             	mov    %r12,%rsi
+  804cc7:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804cce:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804cd2:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804cd6:	4d 85 ff             	test   %r15,%r15
+  804cd9:	74 67                	je     804d42 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804cdb:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ce2:	75 0f                	jne    804cf3 <mmap+0xe9>
+  804ce4:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804ceb:	00 00 00 
+  804cee:	49 39 c7             	cmp    %rax,%r15
+  804cf1:	77 1b                	ja     804d0e <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804cf3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cfa:	e9 3c 01 00 00       	jmp    804e3b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804cff:	41 f6 c5 02          	test   $0x2,%r13b
+  804d03:	74 b8                	je     804cbd <mmap+0xb3>
+  804d05:	85 d2                	test   %edx,%edx
+  804d07:	75 b4                	jne    804cbd <mmap+0xb3>
+  804d09:	e9 2d 01 00 00       	jmp    804e3b <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d0e:	4c 89 ff             	mov    %r15,%rdi
+  804d11:	48 b8 78 48 80 00 00 	movabs $0x804878,%rax
+  804d18:	00 00 00 
+  804d1b:	ff d0                	call   *%rax
+  804d1d:	48 89 c2             	mov    %rax,%rdx
+  804d20:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d27:	49 39 d7             	cmp    %rdx,%r15
+  804d2a:	0f 85 0b 01 00 00    	jne    804e3b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d30:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d37:	00 00 00 
+  804d3a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d40:	eb 44                	jmp    804d86 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d42:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804d46:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804d4d:	00 00 00 
+  804d50:	48 b8 78 48 80 00 00 	movabs $0x804878,%rax
+  804d57:	00 00 00 
+  804d5a:	ff d0                	call   *%rax
+  804d5c:	48 89 c7             	mov    %rax,%rdi
+  804d5f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804d63:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d6a:	48 85 ff             	test   %rdi,%rdi
+  804d6d:	75 c1                	jne    804d30 <mmap+0x126>
+  804d6f:	e9 c7 00 00 00       	jmp    804e3b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d74:	49 83 c4 01          	add    $0x1,%r12
+  804d78:	48 83 c0 20          	add    $0x20,%rax
+  804d7c:	49 83 fc 20          	cmp    $0x20,%r12
+  804d80:	0f 84 a5 00 00 00    	je     804e2b <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804d86:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804d8a:	75 e8                	jne    804d74 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804d8c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804d90:	48 b8 c4 2f 80 00 00 	movabs $0x802fc4,%rax
+  804d97:	00 00 00 
+  804d9a:	ff d0                	call   *%rax
+  804d9c:	89 c2                	mov    %eax,%edx
+  804d9e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804da5:	85 d2                	test   %edx,%edx
+  804da7:	0f 88 8e 00 00 00    	js     804e3b <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804dad:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804db1:	48 b8 96 2f 80 00 00 	movabs $0x802f96,%rax
+  804db8:	00 00 00 
+  804dbb:	ff d0                	call   *%rax
+  804dbd:	89 c6                	mov    %eax,%esi
+  804dbf:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804dc2:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  804dc9:	00 00 00 
+  804dcc:	ff d0                	call   *%rax
+  804dce:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804dd1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804dd8:	45 85 ff             	test   %r15d,%r15d
+  804ddb:	78 5e                	js     804e3b <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804ddd:	49 c1 e4 05          	shl    $0x5,%r12
+  804de1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804de8:	00 00 00 
+  804deb:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804dee:	48 bf e9 48 80 00 00 	movabs $0x8048e9,%rdi
+  804df5:	00 00 00 
+  804df8:	48 b8 14 53 80 00 00 	movabs $0x805314,%rax
+  804dff:	00 00 00 
+  804e02:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804e04:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e08:	49 89 04 24          	mov    %rax,(%r12)
+  804e0c:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804e10:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804e15:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804e1a:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804e1f:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804e24:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804e29:	eb 10                	jmp    804e3b <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804e2b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e32:	eb 07                	jmp    804e3b <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804e34:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804e3b:	48 83 c4 38          	add    $0x38,%rsp
+  804e3f:	5b                   	pop    %rbx
+  804e40:	41 5c                	pop    %r12
+  804e42:	41 5d                	pop    %r13
+  804e44:	41 5e                	pop    %r14
+  804e46:	41 5f                	pop    %r15
+  804e48:	5d                   	pop    %rbp
+  804e49:	c3                   	ret
+
+0000000000804e4a <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804e4a:	55                   	push   %rbp
+  804e4b:	48 89 e5             	mov    %rsp,%rbp
+  804e4e:	41 57                	push   %r15
+  804e50:	41 56                	push   %r14
+  804e52:	41 55                	push   %r13
+  804e54:	41 54                	push   %r12
+  804e56:	53                   	push   %rbx
+  804e57:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804e5b:	49 89 fe             	mov    %rdi,%r14
+  804e5e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804e65:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804e6c:	00 
+  804e6d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e74:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804e7b:	00 00 00 
+  804e7e:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804e85:	49 bf d1 4a 80 00 00 	movabs $0x804ad1,%r15
+  804e8c:	00 00 00 
+  804e8f:	eb 09                	jmp    804e9a <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e91:	48 83 c3 20          	add    $0x20,%rbx
+  804e95:	4c 39 eb             	cmp    %r13,%rbx
+  804e98:	74 33                	je     804ecd <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804e9a:	48 89 df             	mov    %rbx,%rdi
+  804e9d:	48 8b 33             	mov    (%rbx),%rsi
+  804ea0:	4c 39 e6             	cmp    %r12,%rsi
+  804ea3:	73 ec                	jae    804e91 <msync+0x47>
+  804ea5:	48 85 f6             	test   %rsi,%rsi
+  804ea8:	74 e7                	je     804e91 <msync+0x47>
+  804eaa:	48 89 f2             	mov    %rsi,%rdx
+  804ead:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804eb1:	49 39 d6             	cmp    %rdx,%r14
+  804eb4:	73 db                	jae    804e91 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804eb6:	4c 39 e2             	cmp    %r12,%rdx
+  804eb9:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ebd:	4c 39 f6             	cmp    %r14,%rsi
+  804ec0:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ec4:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804ec7:	85 c0                	test   %eax,%eax
+  804ec9:	79 c6                	jns    804e91 <msync+0x47>
+  804ecb:	eb 05                	jmp    804ed2 <msync+0x88>
+    }
+
+    return 0;
+  804ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ed2:	48 83 c4 08          	add    $0x8,%rsp
+  804ed6:	5b                   	pop    %rbx
+  804ed7:	41 5c                	pop    %r12
+  804ed9:	41 5d                	pop    %r13
+  804edb:	41 5e                	pop    %r14
+  804edd:	41 5f                	pop    %r15
+  804edf:	5d                   	pop    %rbp
+  804ee0:	c3                   	ret
+
+0000000000804ee1 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804ee1:	55                   	push   %rbp
+  804ee2:	48 89 e5             	mov    %rsp,%rbp
+  804ee5:	41 57                	push   %r15
+  804ee7:	41 56                	push   %r14
+  804ee9:	41 55                	push   %r13
+  804eeb:	41 54                	push   %r12
+  804eed:	53                   	push   %rbx
+  804eee:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804ef2:	49 89 ff             	mov    %rdi,%r15
+  804ef5:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804efc:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f03:	00 
+  804f04:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f0b:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804f12:	00 00 00 
+  804f15:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f1c:	48 89 d8             	mov    %rbx,%rax
+  804f1f:	eb 09                	jmp    804f2a <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f21:	48 83 c0 20          	add    $0x20,%rax
+  804f25:	4c 39 f0             	cmp    %r14,%rax
+  804f28:	74 40                	je     804f6a <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f2a:	48 8b 10             	mov    (%rax),%rdx
+  804f2d:	4c 39 e2             	cmp    %r12,%rdx
+  804f30:	73 ef                	jae    804f21 <munmap+0x40>
+  804f32:	48 85 d2             	test   %rdx,%rdx
+  804f35:	74 ea                	je     804f21 <munmap+0x40>
+  804f37:	48 89 d7             	mov    %rdx,%rdi
+  804f3a:	48 03 78 08          	add    0x8(%rax),%rdi
+  804f3e:	49 39 ff             	cmp    %rdi,%r15
+  804f41:	73 de                	jae    804f21 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804f43:	49 39 fc             	cmp    %rdi,%r12
+  804f46:	72 05                	jb     804f4d <munmap+0x6c>
+  804f48:	4c 39 fa             	cmp    %r15,%rdx
+  804f4b:	73 d4                	jae    804f21 <munmap+0x40>
+  804f4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804f52:	48 83 c4 08          	add    $0x8,%rsp
+  804f56:	5b                   	pop    %rbx
+  804f57:	41 5c                	pop    %r12
+  804f59:	41 5d                	pop    %r13
+  804f5b:	41 5e                	pop    %r14
+  804f5d:	41 5f                	pop    %r15
+  804f5f:	5d                   	pop    %rbp
+  804f60:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f61:	48 83 c3 20          	add    $0x20,%rbx
+  804f65:	4c 39 f3             	cmp    %r14,%rbx
+  804f68:	74 5c                	je     804fc6 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f6a:	48 8b 33             	mov    (%rbx),%rsi
+  804f6d:	4c 39 e6             	cmp    %r12,%rsi
+  804f70:	73 ef                	jae    804f61 <munmap+0x80>
+  804f72:	48 85 f6             	test   %rsi,%rsi
+  804f75:	74 ea                	je     804f61 <munmap+0x80>
+  804f77:	48 89 f2             	mov    %rsi,%rdx
+  804f7a:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804f7e:	49 39 d7             	cmp    %rdx,%r15
+  804f81:	73 de                	jae    804f61 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804f83:	48 89 df             	mov    %rbx,%rdi
+  804f86:	48 b8 d1 4a 80 00 00 	movabs $0x804ad1,%rax
+  804f8d:	00 00 00 
+  804f90:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804f92:	85 c0                	test   %eax,%eax
+  804f94:	78 bc                	js     804f52 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804f96:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804f9a:	48 8b 33             	mov    (%rbx),%rsi
+  804f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fa2:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  804fa9:	00 00 00 
+  804fac:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804fae:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804fb1:	48 b8 89 31 80 00 00 	movabs $0x803189,%rax
+  804fb8:	00 00 00 
+  804fbb:	ff d0                	call   *%rax
+        reg->start = 0;
+  804fbd:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804fc4:	eb 9b                	jmp    804f61 <munmap+0x80>
+    return 0;
+  804fc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fcb:	eb 85                	jmp    804f52 <munmap+0x71>
+
+0000000000804fcd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fd2:	c3                   	ret
+
+0000000000804fd3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804fd3:	55                   	push   %rbp
+  804fd4:	48 89 e5             	mov    %rsp,%rbp
+  804fd7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804fda:	48 be c5 64 80 00 00 	movabs $0x8064c5,%rsi
+  804fe1:	00 00 00 
+  804fe4:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  804feb:	00 00 00 
+  804fee:	ff d0                	call   *%rax
+    return 0;
+}
+  804ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff5:	5d                   	pop    %rbp
+  804ff6:	c3                   	ret
+
+0000000000804ff7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804ff7:	55                   	push   %rbp
+  804ff8:	48 89 e5             	mov    %rsp,%rbp
+  804ffb:	41 57                	push   %r15
+  804ffd:	41 56                	push   %r14
+  804fff:	41 55                	push   %r13
+  805001:	41 54                	push   %r12
+  805003:	53                   	push   %rbx
+  805004:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80500b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805012:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805019:	00 00 00 00 
+  80501d:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805024:	00 00 00 00 
+  805028:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80502f:	00 00 00 00 
+  805033:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80503a:	00 00 00 00 
+  80503e:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805045:	00 00 00 00 
+  805049:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805050:	00 00 00 00 
+  805054:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80505b:	00 
+  80505c:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805063:	00 
+  805064:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80506b:	00 
+  80506c:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805073:	00 
+  805074:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80507b:	00 
+  80507c:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805083:	00 
+  805084:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80508b:	00 
+  80508c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805093:	00 
+  805094:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80509b:	00 
+  80509c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8050a3:	00 
+    for (res = 0; res < n; res += inc) {
+  8050a4:	48 85 d2             	test   %rdx,%rdx
+  8050a7:	74 7a                	je     805123 <devcons_write+0x12c>
+  8050a9:	49 89 d6             	mov    %rdx,%r14
+  8050ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050b2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8050b7:	49 bf 23 25 80 00 00 	movabs $0x802523,%r15
+  8050be:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8050c1:	4c 89 f3             	mov    %r14,%rbx
+  8050c4:	48 29 f3             	sub    %rsi,%rbx
+  8050c7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8050cc:	48 39 c3             	cmp    %rax,%rbx
+  8050cf:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8050d3:	4c 63 eb             	movslq %ebx,%r13
+  8050d6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8050dd:	48 01 c6             	add    %rax,%rsi
+  8050e0:	4c 89 ea             	mov    %r13,%rdx
+  8050e3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8050ea:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8050ed:	4c 89 ee             	mov    %r13,%rsi
+  8050f0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8050f7:	48 b8 50 27 80 00 00 	movabs $0x802750,%rax
+  8050fe:	00 00 00 
+  805101:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805103:	41 01 dc             	add    %ebx,%r12d
+  805106:	49 63 f4             	movslq %r12d,%rsi
+  805109:	4c 39 f6             	cmp    %r14,%rsi
+  80510c:	72 b3                	jb     8050c1 <devcons_write+0xca>
+    return res;
+  80510e:	49 63 c4             	movslq %r12d,%rax
+}
+  805111:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805118:	5b                   	pop    %rbx
+  805119:	41 5c                	pop    %r12
+  80511b:	41 5d                	pop    %r13
+  80511d:	41 5e                	pop    %r14
+  80511f:	41 5f                	pop    %r15
+  805121:	5d                   	pop    %rbp
+  805122:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805123:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805129:	eb e3                	jmp    80510e <devcons_write+0x117>
+
+000000000080512b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80512b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80512e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805133:	48 85 c0             	test   %rax,%rax
+  805136:	74 55                	je     80518d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805138:	55                   	push   %rbp
+  805139:	48 89 e5             	mov    %rsp,%rbp
+  80513c:	41 55                	push   %r13
+  80513e:	41 54                	push   %r12
+  805140:	53                   	push   %rbx
+  805141:	48 83 ec 08          	sub    $0x8,%rsp
+  805145:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805148:	48 bb 83 27 80 00 00 	movabs $0x802783,%rbx
+  80514f:	00 00 00 
+  805152:	49 bc 97 28 80 00 00 	movabs $0x802897,%r12
+  805159:	00 00 00 
+  80515c:	eb 03                	jmp    805161 <devcons_read+0x36>
+  80515e:	41 ff d4             	call   *%r12
+  805161:	ff d3                	call   *%rbx
+  805163:	85 c0                	test   %eax,%eax
+  805165:	74 f7                	je     80515e <devcons_read+0x33>
+    if (c < 0) return c;
+  805167:	48 63 d0             	movslq %eax,%rdx
+  80516a:	78 13                	js     80517f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80516c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805171:	83 f8 04             	cmp    $0x4,%eax
+  805174:	74 09                	je     80517f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805176:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80517a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80517f:	48 89 d0             	mov    %rdx,%rax
+  805182:	48 83 c4 08          	add    $0x8,%rsp
+  805186:	5b                   	pop    %rbx
+  805187:	41 5c                	pop    %r12
+  805189:	41 5d                	pop    %r13
+  80518b:	5d                   	pop    %rbp
+  80518c:	c3                   	ret
+  80518d:	48 89 d0             	mov    %rdx,%rax
+  805190:	c3                   	ret
+
+0000000000805191 <cputchar>:
+cputchar(int ch) {
+  805191:	55                   	push   %rbp
+  805192:	48 89 e5             	mov    %rsp,%rbp
+  805195:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805199:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80519d:	be 01 00 00 00       	mov    $0x1,%esi
+  8051a2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8051a6:	48 b8 50 27 80 00 00 	movabs $0x802750,%rax
+  8051ad:	00 00 00 
+  8051b0:	ff d0                	call   *%rax
+}
+  8051b2:	c9                   	leave
+  8051b3:	c3                   	ret
+
+00000000008051b4 <getchar>:
+getchar(void) {
+  8051b4:	55                   	push   %rbp
+  8051b5:	48 89 e5             	mov    %rsp,%rbp
+  8051b8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8051bc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8051c1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8051c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051ca:	48 b8 07 33 80 00 00 	movabs $0x803307,%rax
+  8051d1:	00 00 00 
+  8051d4:	ff d0                	call   *%rax
+  8051d6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8051d8:	85 c0                	test   %eax,%eax
+  8051da:	78 06                	js     8051e2 <getchar+0x2e>
+  8051dc:	74 08                	je     8051e6 <getchar+0x32>
+  8051de:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8051e2:	89 d0                	mov    %edx,%eax
+  8051e4:	c9                   	leave
+  8051e5:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8051e6:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8051eb:	eb f5                	jmp    8051e2 <getchar+0x2e>
+
+00000000008051ed <iscons>:
+iscons(int fdnum) {
+  8051ed:	55                   	push   %rbp
+  8051ee:	48 89 e5             	mov    %rsp,%rbp
+  8051f1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8051f5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8051f9:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  805200:	00 00 00 
+  805203:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805205:	85 c0                	test   %eax,%eax
+  805207:	78 18                	js     805221 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805209:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80520d:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805214:	00 00 00 
+  805217:	8b 00                	mov    (%rax),%eax
+  805219:	39 02                	cmp    %eax,(%rdx)
+  80521b:	0f 94 c0             	sete   %al
+  80521e:	0f b6 c0             	movzbl %al,%eax
+}
+  805221:	c9                   	leave
+  805222:	c3                   	ret
+
+0000000000805223 <opencons>:
+opencons(void) {
+  805223:	55                   	push   %rbp
+  805224:	48 89 e5             	mov    %rsp,%rbp
+  805227:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80522b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80522f:	48 b8 c4 2f 80 00 00 	movabs $0x802fc4,%rax
+  805236:	00 00 00 
+  805239:	ff d0                	call   *%rax
+  80523b:	85 c0                	test   %eax,%eax
+  80523d:	78 49                	js     805288 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80523f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805244:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805249:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80524d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805252:	48 b8 38 29 80 00 00 	movabs $0x802938,%rax
+  805259:	00 00 00 
+  80525c:	ff d0                	call   *%rax
+  80525e:	85 c0                	test   %eax,%eax
+  805260:	78 26                	js     805288 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805262:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805266:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80526d:	00 00 
+  80526f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805271:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805275:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80527c:	48 b8 96 2f 80 00 00 	movabs $0x802f96,%rax
+  805283:	00 00 00 
+  805286:	ff d0                	call   *%rax
+}
+  805288:	c9                   	leave
+  805289:	c3                   	ret
+
+000000000080528a <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80528a:	55                   	push   %rbp
+  80528b:	48 89 e5             	mov    %rsp,%rbp
+  80528e:	41 56                	push   %r14
+  805290:	41 55                	push   %r13
+  805292:	41 54                	push   %r12
+  805294:	53                   	push   %rbx
+  805295:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805298:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80529f:	00 00 00 
+  8052a2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8052a6:	74 27                	je     8052cf <_handle_vectored_pagefault+0x45>
+  8052a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8052ad:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8052b4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052b7:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8052ba:	4c 89 e7             	mov    %r12,%rdi
+  8052bd:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8052c2:	84 c0                	test   %al,%al
+  8052c4:	75 45                	jne    80530b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052c6:	48 83 c3 01          	add    $0x1,%rbx
+  8052ca:	49 3b 1e             	cmp    (%r14),%rbx
+  8052cd:	72 eb                	jb     8052ba <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8052cf:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8052d6:	00 
+  8052d7:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8052dc:	4d 8b 04 24          	mov    (%r12),%r8
+  8052e0:	48 ba d8 64 80 00 00 	movabs $0x8064d8,%rdx
+  8052e7:	00 00 00 
+  8052ea:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8052ef:	48 bf 08 65 80 00 00 	movabs $0x806508,%rdi
+  8052f6:	00 00 00 
+  8052f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052fe:	49 ba 4c 17 80 00 00 	movabs $0x80174c,%r10
+  805305:	00 00 00 
+  805308:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80530b:	5b                   	pop    %rbx
+  80530c:	41 5c                	pop    %r12
+  80530e:	41 5d                	pop    %r13
+  805310:	41 5e                	pop    %r14
+  805312:	5d                   	pop    %rbp
+  805313:	c3                   	ret
+
+0000000000805314 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805314:	55                   	push   %rbp
+  805315:	48 89 e5             	mov    %rsp,%rbp
+  805318:	53                   	push   %rbx
+  805319:	48 83 ec 08          	sub    $0x8,%rsp
+  80531d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805320:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805325:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80532c:	00 00 00 
+  80532f:	80 38 00             	cmpb   $0x0,(%rax)
+  805332:	74 68                	je     80539c <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805334:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80533b:	00 00 00 
+  80533e:	48 8b 08             	mov    (%rax),%rcx
+  805341:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805346:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80534d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805350:	48 85 c9             	test   %rcx,%rcx
+  805353:	0f 84 e0 00 00 00    	je     805439 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805359:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80535d:	0f 84 c9 00 00 00    	je     80542c <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805363:	48 83 c2 01          	add    $0x1,%rdx
+  805367:	48 39 ca             	cmp    %rcx,%rdx
+  80536a:	75 ed                	jne    805359 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80536c:	48 83 f9 08          	cmp    $0x8,%rcx
+  805370:	0f 84 84 00 00 00    	je     8053fa <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805376:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80537a:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805381:	00 00 00 
+  805384:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80538b:	00 00 00 
+  80538e:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805392:	85 f6                	test   %esi,%esi
+  805394:	0f 89 97 00 00 00    	jns    805431 <add_pgfault_handler+0x11d>
+  80539a:	eb 63                	jmp    8053ff <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80539c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8053a1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8053a6:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8053ad:	00 00 00 
+  8053b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053b5:	48 b8 38 29 80 00 00 	movabs $0x802938,%rax
+  8053bc:	00 00 00 
+  8053bf:	ff d0                	call   *%rax
+  8053c1:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8053c3:	85 c0                	test   %eax,%eax
+  8053c5:	78 38                	js     8053ff <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8053c7:	48 be 15 55 80 00 00 	movabs $0x805515,%rsi
+  8053ce:	00 00 00 
+  8053d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053d6:	48 b8 5b 2b 80 00 00 	movabs $0x802b5b,%rax
+  8053dd:	00 00 00 
+  8053e0:	ff d0                	call   *%rax
+  8053e2:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8053e4:	85 c0                	test   %eax,%eax
+  8053e6:	78 17                	js     8053ff <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8053e8:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8053ef:	00 00 00 
+  8053f2:	c6 00 01             	movb   $0x1,(%rax)
+  8053f5:	e9 3a ff ff ff       	jmp    805334 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8053fa:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8053ff:	89 f1                	mov    %esi,%ecx
+  805401:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  805408:	00 00 00 
+  80540b:	be 42 00 00 00       	mov    $0x42,%esi
+  805410:	48 bf 08 65 80 00 00 	movabs $0x806508,%rdi
+  805417:	00 00 00 
+  80541a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80541f:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  805426:	00 00 00 
+  805429:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80542c:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805431:	89 f0                	mov    %esi,%eax
+  805433:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805437:	c9                   	leave
+  805438:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805439:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805440:	00 00 00 
+  805443:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80544a:	48 89 d8             	mov    %rbx,%rax
+  80544d:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805454:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805457:	eb d8                	jmp    805431 <add_pgfault_handler+0x11d>
+
+0000000000805459 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805459:	55                   	push   %rbp
+  80545a:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80545d:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805464:	00 00 00 
+  805467:	80 38 00             	cmpb   $0x0,(%rax)
+  80546a:	74 33                	je     80549f <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80546c:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805473:	00 00 00 
+  805476:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80547b:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805482:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805485:	48 85 c0             	test   %rax,%rax
+  805488:	0f 84 85 00 00 00    	je     805513 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80548e:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805492:	74 40                	je     8054d4 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805494:	48 83 c1 01          	add    $0x1,%rcx
+  805498:	48 39 c1             	cmp    %rax,%rcx
+  80549b:	75 f1                	jne    80548e <remove_pgfault_handler+0x35>
+  80549d:	eb 74                	jmp    805513 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80549f:	48 b9 2e 65 80 00 00 	movabs $0x80652e,%rcx
+  8054a6:	00 00 00 
+  8054a9:	48 ba 16 64 80 00 00 	movabs $0x806416,%rdx
+  8054b0:	00 00 00 
+  8054b3:	be 48 00 00 00       	mov    $0x48,%esi
+  8054b8:	48 bf 08 65 80 00 00 	movabs $0x806508,%rdi
+  8054bf:	00 00 00 
+  8054c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054c7:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  8054ce:	00 00 00 
+  8054d1:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8054d4:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8054db:	00 
+  8054dc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8054e0:	48 29 ca             	sub    %rcx,%rdx
+  8054e3:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8054ea:	00 00 00 
+  8054ed:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8054f1:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8054f6:	48 89 ce             	mov    %rcx,%rsi
+  8054f9:	48 b8 23 25 80 00 00 	movabs $0x802523,%rax
+  805500:	00 00 00 
+  805503:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805505:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80550c:	00 00 00 
+  80550f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805513:	5d                   	pop    %rbp
+  805514:	c3                   	ret
+
+0000000000805515 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805515:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805518:	48 b8 8a 52 80 00 00 	movabs $0x80528a,%rax
+  80551f:	00 00 00 
+    call *%rax
+  805522:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805524:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80552b:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80552c:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805533:	00 
+    subq $8, %rcx
+  805534:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805538:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80553b:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805542:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805543:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805547:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80554b:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805550:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805555:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80555a:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80555f:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805564:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805569:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80556e:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805573:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805578:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80557d:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805582:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805587:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80558c:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805591:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805595:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805599:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80559a:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80559b:	c3                   	ret
+
+000000000080559c <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80559c:	85 ff                	test   %edi,%edi
+  80559e:	78 58                	js     8055f8 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8055a0:	48 85 f6             	test   %rsi,%rsi
+  8055a3:	74 12                	je     8055b7 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8055a5:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8055ac:	00 00 00 
+  8055af:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8055b5:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8055b7:	48 85 c9             	test   %rcx,%rcx
+  8055ba:	74 12                	je     8055ce <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8055bc:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8055c3:	00 00 00 
+  8055c6:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8055cc:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8055ce:	48 85 d2             	test   %rdx,%rdx
+  8055d1:	74 14                	je     8055e7 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8055d3:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8055da:	00 00 00 
+  8055dd:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8055e4:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8055e7:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8055ee:	00 00 00 
+  8055f1:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8055f7:	c3                   	ret
+        if (from_env_store) {
+  8055f8:	48 85 f6             	test   %rsi,%rsi
+  8055fb:	74 06                	je     805603 <ipc_result+0x67>
+            *from_env_store = 0;
+  8055fd:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805603:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805605:	48 85 c9             	test   %rcx,%rcx
+  805608:	74 ed                	je     8055f7 <ipc_result+0x5b>
+            *perm_store = 0;
+  80560a:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805610:	c3                   	ret
+
+0000000000805611 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805611:	55                   	push   %rbp
+  805612:	48 89 e5             	mov    %rsp,%rbp
+  805615:	41 55                	push   %r13
+  805617:	41 54                	push   %r12
+  805619:	53                   	push   %rbx
+  80561a:	48 83 ec 08          	sub    $0x8,%rsp
+  80561e:	49 89 fc             	mov    %rdi,%r12
+  805621:	48 89 f7             	mov    %rsi,%rdi
+  805624:	48 89 d3             	mov    %rdx,%rbx
+  805627:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80562a:	48 85 f6             	test   %rsi,%rsi
+  80562d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805634:	00 00 00 
+  805637:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80563b:	be 00 00 00 00       	mov    $0x0,%esi
+  805640:	48 85 d2             	test   %rdx,%rdx
+  805643:	74 03                	je     805648 <ipc_recv+0x37>
+  805645:	48 8b 32             	mov    (%rdx),%rsi
+  805648:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  80564f:	00 00 00 
+  805652:	ff d0                	call   *%rax
+  805654:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805656:	4c 89 e9             	mov    %r13,%rcx
+  805659:	48 89 da             	mov    %rbx,%rdx
+  80565c:	4c 89 e6             	mov    %r12,%rsi
+  80565f:	48 b8 9c 55 80 00 00 	movabs $0x80559c,%rax
+  805666:	00 00 00 
+  805669:	ff d0                	call   *%rax
+}
+  80566b:	48 83 c4 08          	add    $0x8,%rsp
+  80566f:	5b                   	pop    %rbx
+  805670:	41 5c                	pop    %r12
+  805672:	41 5d                	pop    %r13
+  805674:	5d                   	pop    %rbp
+  805675:	c3                   	ret
+
+0000000000805676 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805676:	55                   	push   %rbp
+  805677:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80567a:	48 85 d2             	test   %rdx,%rdx
+  80567d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805684:	00 00 00 
+  805687:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80568b:	89 f6                	mov    %esi,%esi
+  80568d:	48 b8 10 2d 80 00 00 	movabs $0x802d10,%rax
+  805694:	00 00 00 
+  805697:	ff d0                	call   *%rax
+    if (res < 0) {
+  805699:	85 c0                	test   %eax,%eax
+  80569b:	78 02                	js     80569f <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80569d:	5d                   	pop    %rbp
+  80569e:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80569f:	89 c1                	mov    %eax,%ecx
+  8056a1:	48 ba 48 65 80 00 00 	movabs $0x806548,%rdx
+  8056a8:	00 00 00 
+  8056ab:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8056b0:	48 bf 55 65 80 00 00 	movabs $0x806555,%rdi
+  8056b7:	00 00 00 
+  8056ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056bf:	49 b8 4c 17 80 00 00 	movabs $0x80174c,%r8
+  8056c6:	00 00 00 
+  8056c9:	41 ff d0             	call   *%r8
+
+00000000008056cc <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8056cc:	55                   	push   %rbp
+  8056cd:	48 89 e5             	mov    %rsp,%rbp
+  8056d0:	53                   	push   %rbx
+  8056d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8056d5:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056d9:	48 85 d2             	test   %rdx,%rdx
+  8056dc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056e3:	00 00 00 
+  8056e6:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8056ea:	4d 85 c9             	test   %r9,%r9
+  8056ed:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8056f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056f6:	48 85 db             	test   %rbx,%rbx
+  8056f9:	74 03                	je     8056fe <ipc_call+0x32>
+  8056fb:	48 8b 03             	mov    (%rbx),%rax
+  8056fe:	89 f6                	mov    %esi,%esi
+  805700:	48 83 ec 08          	sub    $0x8,%rsp
+  805704:	50                   	push   %rax
+  805705:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  80570c:	00 00 00 
+  80570f:	ff d0                	call   *%rax
+  805711:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805713:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805717:	48 89 da             	mov    %rbx,%rdx
+  80571a:	be 00 00 00 00       	mov    $0x0,%esi
+  80571f:	48 b8 9c 55 80 00 00 	movabs $0x80559c,%rax
+  805726:	00 00 00 
+  805729:	ff d0                	call   *%rax
+}
+  80572b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80572f:	c9                   	leave
+  805730:	c3                   	ret
+
+0000000000805731 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805731:	55                   	push   %rbp
+  805732:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805735:	89 f6                	mov    %esi,%esi
+  805737:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  80573e:	00 00 00 
+  805741:	ff d0                	call   *%rax
+  805743:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805745:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80574a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80574f:	be 00 00 00 00       	mov    $0x0,%esi
+  805754:	48 b8 9c 55 80 00 00 	movabs $0x80559c,%rax
+  80575b:	00 00 00 
+  80575e:	ff d0                	call   *%rax
+}
+  805760:	5d                   	pop    %rbp
+  805761:	c3                   	ret
+
+0000000000805762 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805762:	55                   	push   %rbp
+  805763:	48 89 e5             	mov    %rsp,%rbp
+  805766:	41 54                	push   %r12
+  805768:	53                   	push   %rbx
+  805769:	4c 89 cb             	mov    %r9,%rbx
+  80576c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805770:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805774:	48 85 d2             	test   %rdx,%rdx
+  805777:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80577e:	00 00 00 
+  805781:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805785:	4d 85 c9             	test   %r9,%r9
+  805788:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80578c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805791:	4d 85 e4             	test   %r12,%r12
+  805794:	74 04                	je     80579a <ipc_reply_wait+0x38>
+  805796:	49 8b 04 24          	mov    (%r12),%rax
+  80579a:	89 f6                	mov    %esi,%esi
+  80579c:	48 83 ec 08          	sub    $0x8,%rsp
+  8057a0:	50                   	push   %rax
+  8057a1:	48 b8 18 2e 80 00 00 	movabs $0x802e18,%rax
+  8057a8:	00 00 00 
+  8057ab:	ff d0                	call   *%rax
+  8057ad:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8057af:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8057b3:	4c 89 e2             	mov    %r12,%rdx
+  8057b6:	48 89 de             	mov    %rbx,%rsi
+  8057b9:	48 b8 9c 55 80 00 00 	movabs $0x80559c,%rax
+  8057c0:	00 00 00 
+  8057c3:	ff d0                	call   *%rax
+}
+  8057c5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8057c9:	5b                   	pop    %rbx
+  8057ca:	41 5c                	pop    %r12
+  8057cc:	5d                   	pop    %rbp
+  8057cd:	c3                   	ret
+
+00000000008057ce <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8057ce:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8057d3:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8057da:	00 00 00 
+  8057dd:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8057e4:	48 01 ca             	add    %rcx,%rdx
+  8057e7:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8057ed:	39 fa                	cmp    %edi,%edx
+  8057ef:	74 12                	je     805803 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8057f1:	48 83 c0 01          	add    $0x1,%rax
+  8057f5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8057fb:	75 e0                	jne    8057dd <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8057fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805802:	c3                   	ret
+            return envs[i].env_id;
+  805803:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80580a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805811:	00 00 00 
+  805814:	48 01 d0             	add    %rdx,%rax
+  805817:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80581d:	c3                   	ret
+  80581e:	66 90                	xchg   %ax,%ax
+
+0000000000805820 <__rodata_start>:
+  805820:	77 00                	ja     805822 <__rodata_start+0x2>
+  805822:	72 62                	jb     805886 <__rodata_start+0x66>
+  805824:	00 77 62             	add    %dh,0x62(%rdi)
+  805827:	00 66 2e             	add    %ah,0x2e(%rsi)
+  80582a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805831:	00 
+  805832:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805839:	00 00 00 
+  80583c:	0f 1f 40 00          	nopl   0x0(%rax)
+  805840:	b3 09                	mov    $0x9,%bl
+  805842:	80 00 00             	addb   $0x0,(%rax)
+  805845:	00 00                	add    %al,(%rax)
+  805847:	00 ed                	add    %ch,%ch
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80586d:	00 00                	add    %al,(%rax)
+  80586f:	00 ed                	add    %ch,%ch
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	8c 0a                	mov    %cs,(%rdx)
+  80589a:	80 00 00             	addb   $0x0,(%rax)
+  80589d:	00 00                	add    %al,(%rax)
+  80589f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	8c 0a                	mov    %cs,(%rdx)
+  8058aa:	80 00 00             	addb   $0x0,(%rax)
+  8058ad:	00 00                	add    %al,(%rax)
+  8058af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	8c 0a                	mov    %cs,(%rdx)
+  8058ba:	80 00 00             	addb   $0x0,(%rax)
+  8058bd:	00 00                	add    %al,(%rax)
+  8058bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	8c 0a                	mov    %cs,(%rdx)
+  8058ca:	80 00 00             	addb   $0x0,(%rax)
+  8058cd:	00 00                	add    %al,(%rax)
+  8058cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	8c 0a                	mov    %cs,(%rdx)
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	ed                   	in     (%dx),%eax
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ed                   	in     (%dx),%eax
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	ed                   	in     (%dx),%eax
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	f4                   	hlt
+  8059d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8059df:	00 ed                	add    %ch,%ch
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	ed                   	in     (%dx),%eax
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	2c 0b                	sub    $0xb,%al
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 ed                	add    %ch,%ch
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ed                   	in     (%dx),%eax
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	ed                   	in     (%dx),%eax
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805a33:	00 00                	add    %al,(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 cb                	add    %cl,%bl
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	6a 0a                	push   $0xa
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 ed                	add    %ch,%ch
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	3c 0a                	cmp    $0xa,%al
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 ed                	add    %ch,%ch
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805a8b:	00 00                	add    %al,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 29                	add    %ch,(%rcx)
+  805a99:	0c 80                	or     $0x80,%al
+  805a9b:	00 00                	add    %al,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 ed                	add    %ch,%ch
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	1a 0b                	sbb    (%rbx),%cl
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 ed                	add    %ch,%ch
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ce                   	(bad)
+  805ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ac7:	00 ed                	add    %ch,%ch
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	f4                   	hlt
+  805ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805adf:	00 37                	add    %dh,(%rdi)
+  805ae1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 37                	add    %dh,(%rdi)
+  805af1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805b0b:	00 00                	add    %al,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 d2                	add    %dl,%dl
+  805b11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b17:	00 d2                	add    %dl,%dl
+  805b19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b1f:	00 d2                	add    %dl,%dl
+  805b21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b27:	00 d2                	add    %dl,%dl
+  805b29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b2f:	00 d2                	add    %dl,%dl
+  805b31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b37:	00 d2                	add    %dl,%dl
+  805b39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b3f:	00 d2                	add    %dl,%dl
+  805b41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b47:	00 f6                	add    %dh,%dh
+  805b49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b4f:	00 f6                	add    %dh,%dh
+  805b51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 22                	add    %ah,(%rdx)
+  805b91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b97:	00 22                	add    %ah,(%rdx)
+  805b99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b9f:	00 22                	add    %ah,(%rdx)
+  805ba1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ba7:	00 22                	add    %ah,(%rdx)
+  805ba9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805baf:	00 22                	add    %ah,(%rdx)
+  805bb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bb7:	00 22                	add    %ah,(%rdx)
+  805bb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 46 12             	add    %al,0x12(%rsi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 22                	add    %ah,(%rdx)
+  805c91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c97:	00 22                	add    %ah,(%rdx)
+  805c99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c9f:	00 22                	add    %ah,(%rdx)
+  805ca1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ca7:	00 22                	add    %ah,(%rdx)
+  805ca9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805caf:	00 22                	add    %ah,(%rdx)
+  805cb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cb7:	00 22                	add    %ah,(%rdx)
+  805cb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cd2:	80 00 00             	addb   $0x0,(%rax)
+  805cd5:	00 00                	add    %al,(%rax)
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 46 12             	add    %al,0x12(%rsi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805d60 <basefix.0>:
+  805d60:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805d70:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805d80:	10 00 73 79 73 5f 65 78 6f 66 6f 72 6b 3a 20 25     ..sys_exofork: %
+  805d90:	69 00 75 73 65 72 2f 64 75 6d 62 66 6f 72 6b 2e     i.user/dumbfork.
+  805da0:	63 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 73 74     c.sys_env_set_st
+  805db0:	61 74 75 73 3a 20 25 69 00 70 61 72 65 6e 74 00     atus: %i.parent.
+  805dc0:	63 68 69 6c 64 00 25 64 3a 20 49 20 61 6d 20 74     child.%d: I am t
+  805dd0:	68 65 20 25 73 21 0a 00 3c 75 6e 6b 6e 6f 77 6e     he %s!..<unknown
+  805de0:	3e 00 66 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     >.f..D..[%08x] u
+  805df0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  805e00:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  805e10:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  805e20:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  805e30:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  805e40:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  805e50:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  805e60:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  805e70:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  805e80:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  805e90:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  805ea0:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  805eb0:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  805ec0:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  805ed0:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  805ee0:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  805ef0:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  805f00:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  805f10:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  805f20:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  805f30:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  805f40:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  805f50:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  805f60:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  805f70:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  805f80:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  805f90:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  805fa0:	94 1a 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     ......... ......
+  805fb0:	db 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  805fc0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  805fd0:	eb 20 80 00 00 00 00 00 b3 1a 80 00 00 00 00 00     . ..............
+  805fe0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  805ff0:	a7 1a 80 00 00 00 00 00 21 1b 80 00 00 00 00 00     ........!.......
+  806000:	eb 20 80 00 00 00 00 00 a7 1a 80 00 00 00 00 00     . ..............
+  806010:	ed 1a 80 00 00 00 00 00 ed 1a 80 00 00 00 00 00     ................
+  806020:	ed 1a 80 00 00 00 00 00 ed 1a 80 00 00 00 00 00     ................
+  806030:	ed 1a 80 00 00 00 00 00 ed 1a 80 00 00 00 00 00     ................
+  806040:	ed 1a 80 00 00 00 00 00 ed 1a 80 00 00 00 00 00     ................
+  806050:	ed 1a 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     ......... ......
+  806060:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806070:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806080:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806090:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8060a0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8060b0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8060c0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8060d0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8060e0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8060f0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806100:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806110:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806120:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806130:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806140:	eb 20 80 00 00 00 00 00 09 20 80 00 00 00 00 00     . ....... ......
+  806150:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806160:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806170:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806180:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806190:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8061a0:	4f 1b 80 00 00 00 00 00 1e 1d 80 00 00 00 00 00     O...............
+  8061b0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  8061c0:	eb 20 80 00 00 00 00 00 44 1b 80 00 00 00 00 00     . ......D.......
+  8061d0:	7e 1b 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     ~........ ......
+  8061e0:	eb 20 80 00 00 00 00 00 39 1b 80 00 00 00 00 00     . ......9.......
+  8061f0:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806200:	c7 1e 80 00 00 00 00 00 96 1f 80 00 00 00 00 00     ................
+  806210:	eb 20 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     . ....... ......
+  806220:	15 1c 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     ......... ......
+  806230:	f2 1d 80 00 00 00 00 00 eb 20 80 00 00 00 00 00     ......... ......
+  806240:	eb 20 80 00 00 00 00 00 09 20 80 00 00 00 00 00     . ....... ......
+  806250:	eb 20 80 00 00 00 00 00 9d 1a 80 00 00 00 00 00     . ..............
+
+0000000000806260 <error_string>:
+	...
+  806268:	3d 5e 80 00 00 00 00 00 4f 5e 80 00 00 00 00 00     =^......O^......
+  806278:	5f 5e 80 00 00 00 00 00 71 5e 80 00 00 00 00 00     _^......q^......
+  806288:	7f 5e 80 00 00 00 00 00 93 5e 80 00 00 00 00 00     .^.......^......
+  806298:	a8 5e 80 00 00 00 00 00 bb 5e 80 00 00 00 00 00     .^.......^......
+  8062a8:	cd 5e 80 00 00 00 00 00 e1 5e 80 00 00 00 00 00     .^.......^......
+  8062b8:	f1 5e 80 00 00 00 00 00 04 5f 80 00 00 00 00 00     .^......._......
+  8062c8:	1b 5f 80 00 00 00 00 00 31 5f 80 00 00 00 00 00     ._......1_......
+  8062d8:	49 5f 80 00 00 00 00 00 61 5f 80 00 00 00 00 00     I_......a_......
+  8062e8:	6e 5f 80 00 00 00 00 00 00 63 80 00 00 00 00 00     n_.......c......
+  8062f8:	82 5f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ._......file is 
+  806308:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806318:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806328:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806338:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806348:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806358:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806368:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806378:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806388:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806398:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8063a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8063b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8063c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8063d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008063e0 <devtab>:
+  8063e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8063f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806400:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806410:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806420:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806430:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806440:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806450:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806460:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806470:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806480:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806490:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8064a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8064b0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8064c0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8064d0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  8064e0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8064f0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806500:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806510:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806520:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806530:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806540:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806550:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
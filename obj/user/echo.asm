@@ -0,0 +1,10386 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 02 33 80 00 00 	movabs $0x803302,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 02 33 80 00 00 	movabs $0x803302,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 04 17 80 00 00 	movabs $0x801704,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 d8 3c 80 00 00 	movabs $0x803cd8,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 d8 3c 80 00 00 	movabs $0x803cd8,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 98 16 80 00 00 	movabs $0x801698,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 55 5d 80 00 00 	movabs $0x805d55,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 90 57 80 00 00 	movabs $0x805790,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 92 57 80 00 00 	movabs $0x805792,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 95 57 80 00 00 	movabs $0x805795,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 d6 4a 80 00 00 	movabs $0x804ad6,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 ad 4d 80 00 00 	movabs $0x804dad,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 55 30 80 00 00 	movabs $0x803055,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 b5 34 80 00 00 	movabs $0x8034b5,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 bb 33 80 00 00 	movabs $0x8033bb,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 bb 33 80 00 00 	movabs $0x8033bb,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 d3 31 80 00 00 	movabs $0x8031d3,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 02 33 80 00 00 	movabs $0x803302,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 55 30 80 00 00 	movabs $0x803055,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 0e 23 80 00 00 	movabs $0x80230e,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 0e 23 80 00 00 	movabs $0x80230e,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 40 5a 80 00 00 	movabs $0x805a40,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 0e 23 80 00 00 	movabs $0x80230e,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 0e 23 80 00 00 	movabs $0x80230e,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 c0 5c 80 00 00 	movabs $0x805cc0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 c0 5c 80 00 00 	movabs $0x805cc0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 66 25 80 00 00 	movabs $0x802566,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 f0 00 00 00       	call   8015ef <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, nflag;
+
+    nflag = 0;
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  801512:	83 ff 01             	cmp    $0x1,%edi
+  801515:	7f 25                	jg     80153c <umain+0x3b>
+        if (i > 1)
+            write(1, " ", 1);
+        write(1, argv[i], strlen(argv[i]));
+    }
+    if (!nflag)
+        write(1, "\n", 1);
+  801517:	ba 01 00 00 00       	mov    $0x1,%edx
+  80151c:	48 be 93 62 80 00 00 	movabs $0x806293,%rsi
+  801523:	00 00 00 
+  801526:	bf 01 00 00 00       	mov    $0x1,%edi
+  80152b:	48 b8 02 33 80 00 00 	movabs $0x803302,%rax
+  801532:	00 00 00 
+  801535:	ff d0                	call   *%rax
+}
+  801537:	e9 a4 00 00 00       	jmp    8015e0 <umain+0xdf>
+  80153c:	41 89 fe             	mov    %edi,%r14d
+  80153f:	49 89 f4             	mov    %rsi,%r12
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  801542:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  801546:	48 be e2 5c 80 00 00 	movabs $0x805ce2,%rsi
+  80154d:	00 00 00 
+  801550:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  801557:	00 00 00 
+  80155a:	ff d0                	call   *%rax
+  80155c:	85 c0                	test   %eax,%eax
+  80155e:	75 30                	jne    801590 <umain+0x8f>
+        argc--;
+  801560:	41 83 ee 01          	sub    $0x1,%r14d
+        argv++;
+  801564:	49 83 c4 08          	add    $0x8,%r12
+    for (i = 1; i < argc; i++) {
+  801568:	41 83 fe 01          	cmp    $0x1,%r14d
+  80156c:	7e 72                	jle    8015e0 <umain+0xdf>
+        nflag = 1;
+  80156e:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%rbp)
+  801575:	bb 01 00 00 00       	mov    $0x1,%ebx
+            write(1, " ", 1);
+  80157a:	49 bd 02 33 80 00 00 	movabs $0x803302,%r13
+  801581:	00 00 00 
+        write(1, argv[i], strlen(argv[i]));
+  801584:	49 bf 61 20 80 00 00 	movabs $0x802061,%r15
+  80158b:	00 00 00 
+  80158e:	eb 28                	jmp    8015b8 <umain+0xb7>
+    nflag = 0;
+  801590:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  801597:	eb dc                	jmp    801575 <umain+0x74>
+        write(1, argv[i], strlen(argv[i]));
+  801599:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  80159d:	41 ff d7             	call   *%r15
+  8015a0:	48 89 c2             	mov    %rax,%rdx
+  8015a3:	49 8b 34 dc          	mov    (%r12,%rbx,8),%rsi
+  8015a7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8015ac:	41 ff d5             	call   *%r13
+    for (i = 1; i < argc; i++) {
+  8015af:	48 83 c3 01          	add    $0x1,%rbx
+  8015b3:	41 39 de             	cmp    %ebx,%r14d
+  8015b6:	7e 1e                	jle    8015d6 <umain+0xd5>
+        if (i > 1)
+  8015b8:	83 fb 01             	cmp    $0x1,%ebx
+  8015bb:	7e dc                	jle    801599 <umain+0x98>
+            write(1, " ", 1);
+  8015bd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8015c2:	48 be e5 5c 80 00 00 	movabs $0x805ce5,%rsi
+  8015c9:	00 00 00 
+  8015cc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8015d1:	41 ff d5             	call   *%r13
+  8015d4:	eb c3                	jmp    801599 <umain+0x98>
+    if (!nflag)
+  8015d6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8015da:	0f 84 37 ff ff ff    	je     801517 <umain+0x16>
+}
+  8015e0:	48 83 c4 18          	add    $0x18,%rsp
+  8015e4:	5b                   	pop    %rbx
+  8015e5:	41 5c                	pop    %r12
+  8015e7:	41 5d                	pop    %r13
+  8015e9:	41 5e                	pop    %r14
+  8015eb:	41 5f                	pop    %r15
+  8015ed:	5d                   	pop    %rbp
+  8015ee:	c3                   	ret
+
+00000000008015ef <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8015ef:	55                   	push   %rbp
+  8015f0:	48 89 e5             	mov    %rsp,%rbp
+  8015f3:	41 56                	push   %r14
+  8015f5:	41 55                	push   %r13
+  8015f7:	41 54                	push   %r12
+  8015f9:	53                   	push   %rbx
+  8015fa:	41 89 fd             	mov    %edi,%r13d
+  8015fd:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801600:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801607:	00 00 00 
+  80160a:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801611:	00 00 00 
+  801614:	48 39 c2             	cmp    %rax,%rdx
+  801617:	73 17                	jae    801630 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801619:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80161c:	49 89 c4             	mov    %rax,%r12
+  80161f:	48 83 c3 08          	add    $0x8,%rbx
+  801623:	b8 00 00 00 00       	mov    $0x0,%eax
+  801628:	ff 53 f8             	call   *-0x8(%rbx)
+  80162b:	4c 39 e3             	cmp    %r12,%rbx
+  80162e:	72 ef                	jb     80161f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801630:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  801637:	00 00 00 
+  80163a:	ff d0                	call   *%rax
+  80163c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801641:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801648:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80164f:	00 00 00 
+  801652:	48 01 d0             	add    %rdx,%rax
+  801655:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80165c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80165f:	45 85 ed             	test   %r13d,%r13d
+  801662:	7e 0d                	jle    801671 <libmain+0x82>
+  801664:	49 8b 06             	mov    (%r14),%rax
+  801667:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80166e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801671:	4c 89 f6             	mov    %r14,%rsi
+  801674:	44 89 ef             	mov    %r13d,%edi
+  801677:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80167e:	00 00 00 
+  801681:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801683:	48 b8 98 16 80 00 00 	movabs $0x801698,%rax
+  80168a:	00 00 00 
+  80168d:	ff d0                	call   *%rax
+#endif
+}
+  80168f:	5b                   	pop    %rbx
+  801690:	41 5c                	pop    %r12
+  801692:	41 5d                	pop    %r13
+  801694:	41 5e                	pop    %r14
+  801696:	5d                   	pop    %rbp
+  801697:	c3                   	ret
+
+0000000000801698 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801698:	55                   	push   %rbp
+  801699:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80169c:	48 b8 88 30 80 00 00 	movabs $0x803088,%rax
+  8016a3:	00 00 00 
+  8016a6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8016a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ad:	48 b8 bb 26 80 00 00 	movabs $0x8026bb,%rax
+  8016b4:	00 00 00 
+  8016b7:	ff d0                	call   *%rax
+}
+  8016b9:	5d                   	pop    %rbp
+  8016ba:	c3                   	ret
+
+00000000008016bb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8016bb:	55                   	push   %rbp
+  8016bc:	48 89 e5             	mov    %rsp,%rbp
+  8016bf:	53                   	push   %rbx
+  8016c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8016c7:	8b 06                	mov    (%rsi),%eax
+  8016c9:	8d 50 01             	lea    0x1(%rax),%edx
+  8016cc:	89 16                	mov    %edx,(%rsi)
+  8016ce:	48 98                	cltq
+  8016d0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8016d5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8016db:	74 0a                	je     8016e7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8016dd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8016e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8016e7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8016eb:	be ff 00 00 00       	mov    $0xff,%esi
+  8016f0:	48 b8 1c 26 80 00 00 	movabs $0x80261c,%rax
+  8016f7:	00 00 00 
+  8016fa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8016fc:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801702:	eb d9                	jmp    8016dd <putch+0x22>
+
+0000000000801704 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801704:	55                   	push   %rbp
+  801705:	48 89 e5             	mov    %rsp,%rbp
+  801708:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80170f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801712:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801719:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80171e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801723:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801726:	48 89 f1             	mov    %rsi,%rcx
+  801729:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801730:	48 bf bb 16 80 00 00 	movabs $0x8016bb,%rdi
+  801737:	00 00 00 
+  80173a:	48 b8 b8 18 80 00 00 	movabs $0x8018b8,%rax
+  801741:	00 00 00 
+  801744:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801746:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80174d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801754:	48 b8 1c 26 80 00 00 	movabs $0x80261c,%rax
+  80175b:	00 00 00 
+  80175e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801760:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+0000000000801768 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+  80176c:	48 83 ec 50          	sub    $0x50,%rsp
+  801770:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801774:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801778:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80177c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801780:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801784:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80178b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80178f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801793:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801797:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80179b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80179f:	48 b8 04 17 80 00 00 	movabs $0x801704,%rax
+  8017a6:	00 00 00 
+  8017a9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8017ab:	c9                   	leave
+  8017ac:	c3                   	ret
+
+00000000008017ad <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8017ad:	55                   	push   %rbp
+  8017ae:	48 89 e5             	mov    %rsp,%rbp
+  8017b1:	41 57                	push   %r15
+  8017b3:	41 56                	push   %r14
+  8017b5:	41 55                	push   %r13
+  8017b7:	41 54                	push   %r12
+  8017b9:	53                   	push   %rbx
+  8017ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8017be:	49 89 fc             	mov    %rdi,%r12
+  8017c1:	49 89 f5             	mov    %rsi,%r13
+  8017c4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017c8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8017cb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8017ce:	41 89 cf             	mov    %ecx,%r15d
+  8017d1:	4c 39 fa             	cmp    %r15,%rdx
+  8017d4:	73 5b                	jae    801831 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8017d6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8017da:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8017de:	85 db                	test   %ebx,%ebx
+  8017e0:	7e 0e                	jle    8017f0 <print_num+0x43>
+            putch(padc, put_arg);
+  8017e2:	4c 89 ee             	mov    %r13,%rsi
+  8017e5:	44 89 f7             	mov    %r14d,%edi
+  8017e8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8017eb:	83 eb 01             	sub    $0x1,%ebx
+  8017ee:	75 f2                	jne    8017e2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8017f0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8017f4:	48 b9 02 5d 80 00 00 	movabs $0x805d02,%rcx
+  8017fb:	00 00 00 
+  8017fe:	48 b8 f1 5c 80 00 00 	movabs $0x805cf1,%rax
+  801805:	00 00 00 
+  801808:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80180c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801810:	ba 00 00 00 00       	mov    $0x0,%edx
+  801815:	49 f7 f7             	div    %r15
+  801818:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80181c:	4c 89 ee             	mov    %r13,%rsi
+  80181f:	41 ff d4             	call   *%r12
+}
+  801822:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801826:	5b                   	pop    %rbx
+  801827:	41 5c                	pop    %r12
+  801829:	41 5d                	pop    %r13
+  80182b:	41 5e                	pop    %r14
+  80182d:	41 5f                	pop    %r15
+  80182f:	5d                   	pop    %rbp
+  801830:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801831:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801835:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183a:	49 f7 f7             	div    %r15
+  80183d:	48 83 ec 08          	sub    $0x8,%rsp
+  801841:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801845:	52                   	push   %rdx
+  801846:	45 0f be c9          	movsbl %r9b,%r9d
+  80184a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80184e:	48 89 c2             	mov    %rax,%rdx
+  801851:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801858:	00 00 00 
+  80185b:	ff d0                	call   *%rax
+  80185d:	48 83 c4 10          	add    $0x10,%rsp
+  801861:	eb 8d                	jmp    8017f0 <print_num+0x43>
+
+0000000000801863 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801863:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801867:	48 8b 06             	mov    (%rsi),%rax
+  80186a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80186e:	73 0a                	jae    80187a <sprintputch+0x17>
+        *state->start++ = ch;
+  801870:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801874:	48 89 16             	mov    %rdx,(%rsi)
+  801877:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80187a:	c3                   	ret
+
+000000000080187b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80187b:	55                   	push   %rbp
+  80187c:	48 89 e5             	mov    %rsp,%rbp
+  80187f:	48 83 ec 50          	sub    $0x50,%rsp
+  801883:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801887:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80188b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80188f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801896:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80189a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80189e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8018a6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8018aa:	48 b8 b8 18 80 00 00 	movabs $0x8018b8,%rax
+  8018b1:	00 00 00 
+  8018b4:	ff d0                	call   *%rax
+}
+  8018b6:	c9                   	leave
+  8018b7:	c3                   	ret
+
+00000000008018b8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8018b8:	55                   	push   %rbp
+  8018b9:	48 89 e5             	mov    %rsp,%rbp
+  8018bc:	41 57                	push   %r15
+  8018be:	41 56                	push   %r14
+  8018c0:	41 55                	push   %r13
+  8018c2:	41 54                	push   %r12
+  8018c4:	53                   	push   %rbx
+  8018c5:	48 83 ec 38          	sub    $0x38,%rsp
+  8018c9:	49 89 fe             	mov    %rdi,%r14
+  8018cc:	49 89 f5             	mov    %rsi,%r13
+  8018cf:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8018d2:	48 8b 01             	mov    (%rcx),%rax
+  8018d5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8018d9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8018dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018e1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8018e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8018e9:	eb 0d                	jmp    8018f8 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8018eb:	40 0f b6 ff          	movzbl %dil,%edi
+  8018ef:	4c 89 ee             	mov    %r13,%rsi
+  8018f2:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8018f5:	4c 89 e3             	mov    %r12,%rbx
+  8018f8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8018fc:	0f b6 3b             	movzbl (%rbx),%edi
+  8018ff:	40 80 ff 25          	cmp    $0x25,%dil
+  801903:	74 14                	je     801919 <vprintfmt+0x61>
+            if (!ch) return;
+  801905:	40 84 ff             	test   %dil,%dil
+  801908:	75 e1                	jne    8018eb <vprintfmt+0x33>
+}
+  80190a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80190e:	5b                   	pop    %rbx
+  80190f:	41 5c                	pop    %r12
+  801911:	41 5d                	pop    %r13
+  801913:	41 5e                	pop    %r14
+  801915:	41 5f                	pop    %r15
+  801917:	5d                   	pop    %rbp
+  801918:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801919:	be 00 00 00 00       	mov    $0x0,%esi
+  80191e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801922:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801927:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80192d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801934:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801938:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80193d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801942:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801945:	83 e8 23             	sub    $0x23,%eax
+  801948:	3c 57                	cmp    $0x57,%al
+  80194a:	0f 87 67 06 00 00    	ja     801fb7 <vprintfmt+0x6ff>
+  801950:	0f b6 c0             	movzbl %al,%eax
+  801953:	48 b9 80 5e 80 00 00 	movabs $0x805e80,%rcx
+  80195a:	00 00 00 
+  80195d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801960:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801963:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801967:	eb cf                	jmp    801938 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801969:	49 89 dc             	mov    %rbx,%r12
+  80196c:	be 01 00 00 00       	mov    $0x1,%esi
+  801971:	eb c5                	jmp    801938 <vprintfmt+0x80>
+            padc = ch;
+  801973:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801977:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80197a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80197d:	eb b9                	jmp    801938 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80197f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801982:	83 f8 2f             	cmp    $0x2f,%eax
+  801985:	77 24                	ja     8019ab <vprintfmt+0xf3>
+  801987:	89 c1                	mov    %eax,%ecx
+  801989:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80198d:	83 c0 08             	add    $0x8,%eax
+  801990:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801993:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801996:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801999:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80199d:	79 99                	jns    801938 <vprintfmt+0x80>
+                width = precision;
+  80199f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8019a3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8019a9:	eb 8d                	jmp    801938 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019ab:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8019af:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8019b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019b7:	eb da                	jmp    801993 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8019b9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8019be:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019c2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8019c8:	3c 39                	cmp    $0x39,%al
+  8019ca:	77 1c                	ja     8019e8 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8019cc:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8019d0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8019d4:	0f b6 c0             	movzbl %al,%eax
+  8019d7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019dc:	0f b6 03             	movzbl (%rbx),%eax
+  8019df:	3c 39                	cmp    $0x39,%al
+  8019e1:	76 e9                	jbe    8019cc <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8019e3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8019e6:	eb b1                	jmp    801999 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8019e8:	49 89 dc             	mov    %rbx,%r12
+  8019eb:	eb ac                	jmp    801999 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  8019ed:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8019f0:	85 c9                	test   %ecx,%ecx
+  8019f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f7:	0f 49 c1             	cmovns %ecx,%eax
+  8019fa:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8019fd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a00:	e9 33 ff ff ff       	jmp    801938 <vprintfmt+0x80>
+            lflag++;
+  801a05:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a08:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a0b:	e9 28 ff ff ff       	jmp    801938 <vprintfmt+0x80>
+            lflag--;
+  801a10:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a13:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a16:	e9 1d ff ff ff       	jmp    801938 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801a1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a1e:	83 f8 2f             	cmp    $0x2f,%eax
+  801a21:	77 19                	ja     801a3c <vprintfmt+0x184>
+  801a23:	89 c2                	mov    %eax,%edx
+  801a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a29:	83 c0 08             	add    $0x8,%eax
+  801a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a2f:	8b 3a                	mov    (%rdx),%edi
+  801a31:	4c 89 ee             	mov    %r13,%rsi
+  801a34:	41 ff d6             	call   *%r14
+            break;
+  801a37:	e9 bc fe ff ff       	jmp    8018f8 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a48:	eb e5                	jmp    801a2f <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801a4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a4d:	83 f8 2f             	cmp    $0x2f,%eax
+  801a50:	77 5a                	ja     801aac <vprintfmt+0x1f4>
+  801a52:	89 c2                	mov    %eax,%edx
+  801a54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a58:	83 c0 08             	add    $0x8,%eax
+  801a5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801a5e:	8b 02                	mov    (%rdx),%eax
+  801a60:	89 c1                	mov    %eax,%ecx
+  801a62:	f7 d9                	neg    %ecx
+  801a64:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801a67:	83 f9 13             	cmp    $0x13,%ecx
+  801a6a:	7f 4e                	jg     801aba <vprintfmt+0x202>
+  801a6c:	48 63 c1             	movslq %ecx,%rax
+  801a6f:	48 ba 40 61 80 00 00 	movabs $0x806140,%rdx
+  801a76:	00 00 00 
+  801a79:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801a7d:	48 85 c0             	test   %rax,%rax
+  801a80:	74 38                	je     801aba <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801a82:	48 89 c1             	mov    %rax,%rcx
+  801a85:	48 ba 08 63 80 00 00 	movabs $0x806308,%rdx
+  801a8c:	00 00 00 
+  801a8f:	4c 89 ee             	mov    %r13,%rsi
+  801a92:	4c 89 f7             	mov    %r14,%rdi
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	49 b8 7b 18 80 00 00 	movabs $0x80187b,%r8
+  801aa1:	00 00 00 
+  801aa4:	41 ff d0             	call   *%r8
+  801aa7:	e9 4c fe ff ff       	jmp    8018f8 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801aac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ab0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ab4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ab8:	eb a4                	jmp    801a5e <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801aba:	48 ba 1a 5d 80 00 00 	movabs $0x805d1a,%rdx
+  801ac1:	00 00 00 
+  801ac4:	4c 89 ee             	mov    %r13,%rsi
+  801ac7:	4c 89 f7             	mov    %r14,%rdi
+  801aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acf:	49 b8 7b 18 80 00 00 	movabs $0x80187b,%r8
+  801ad6:	00 00 00 
+  801ad9:	41 ff d0             	call   *%r8
+  801adc:	e9 17 fe ff ff       	jmp    8018f8 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ae1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ae4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ae7:	77 6c                	ja     801b55 <vprintfmt+0x29d>
+  801ae9:	89 c2                	mov    %eax,%edx
+  801aeb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801aef:	83 c0 08             	add    $0x8,%eax
+  801af2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801af5:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801af8:	48 85 f6             	test   %rsi,%rsi
+  801afb:	48 b8 13 5d 80 00 00 	movabs $0x805d13,%rax
+  801b02:	00 00 00 
+  801b05:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b09:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801b0d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b11:	7e 06                	jle    801b19 <vprintfmt+0x261>
+  801b13:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801b17:	75 4a                	jne    801b63 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b19:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801b1d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801b21:	0f b6 00             	movzbl (%rax),%eax
+  801b24:	84 c0                	test   %al,%al
+  801b26:	0f 85 9a 00 00 00    	jne    801bc6 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801b2c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b2f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	0f 8e bd fd ff ff    	jle    8018f8 <vprintfmt+0x40>
+  801b3b:	4c 89 ee             	mov    %r13,%rsi
+  801b3e:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b43:	41 ff d6             	call   *%r14
+  801b46:	41 83 ec 01          	sub    $0x1,%r12d
+  801b4a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b4e:	75 eb                	jne    801b3b <vprintfmt+0x283>
+  801b50:	e9 a3 fd ff ff       	jmp    8018f8 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b61:	eb 92                	jmp    801af5 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801b63:	49 63 f7             	movslq %r15d,%rsi
+  801b66:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801b6a:	48 b8 7c 20 80 00 00 	movabs $0x80207c,%rax
+  801b71:	00 00 00 
+  801b74:	ff d0                	call   *%rax
+  801b76:	48 89 c2             	mov    %rax,%rdx
+  801b79:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b7c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801b7e:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801b81:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	7e 91                	jle    801b19 <vprintfmt+0x261>
+  801b88:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801b8d:	4c 89 ee             	mov    %r13,%rsi
+  801b90:	44 89 e7             	mov    %r12d,%edi
+  801b93:	41 ff d6             	call   *%r14
+  801b96:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b9a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b9d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ba0:	75 eb                	jne    801b8d <vprintfmt+0x2d5>
+  801ba2:	e9 72 ff ff ff       	jmp    801b19 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ba7:	0f b6 f8             	movzbl %al,%edi
+  801baa:	4c 89 ee             	mov    %r13,%rsi
+  801bad:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801bb0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801bb4:	49 83 c4 01          	add    $0x1,%r12
+  801bb8:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801bbe:	84 c0                	test   %al,%al
+  801bc0:	0f 84 66 ff ff ff    	je     801b2c <vprintfmt+0x274>
+  801bc6:	45 85 ff             	test   %r15d,%r15d
+  801bc9:	78 0a                	js     801bd5 <vprintfmt+0x31d>
+  801bcb:	41 83 ef 01          	sub    $0x1,%r15d
+  801bcf:	0f 88 57 ff ff ff    	js     801b2c <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801bd5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801bd9:	74 cc                	je     801ba7 <vprintfmt+0x2ef>
+  801bdb:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801bde:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801be3:	80 fa 5e             	cmp    $0x5e,%dl
+  801be6:	77 c2                	ja     801baa <vprintfmt+0x2f2>
+  801be8:	eb bd                	jmp    801ba7 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801bea:	40 84 f6             	test   %sil,%sil
+  801bed:	75 26                	jne    801c15 <vprintfmt+0x35d>
+    switch (lflag) {
+  801bef:	85 d2                	test   %edx,%edx
+  801bf1:	74 59                	je     801c4c <vprintfmt+0x394>
+  801bf3:	83 fa 01             	cmp    $0x1,%edx
+  801bf6:	74 7b                	je     801c73 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801bf8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bfb:	83 f8 2f             	cmp    $0x2f,%eax
+  801bfe:	0f 87 96 00 00 00    	ja     801c9a <vprintfmt+0x3e2>
+  801c04:	89 c2                	mov    %eax,%edx
+  801c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c0a:	83 c0 08             	add    $0x8,%eax
+  801c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c10:	4c 8b 22             	mov    (%rdx),%r12
+  801c13:	eb 17                	jmp    801c2c <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801c15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c18:	83 f8 2f             	cmp    $0x2f,%eax
+  801c1b:	77 21                	ja     801c3e <vprintfmt+0x386>
+  801c1d:	89 c2                	mov    %eax,%edx
+  801c1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c23:	83 c0 08             	add    $0x8,%eax
+  801c26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c29:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801c2c:	4d 85 e4             	test   %r12,%r12
+  801c2f:	78 7a                	js     801cab <vprintfmt+0x3f3>
+            num = i;
+  801c31:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c34:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c39:	e9 56 02 00 00       	jmp    801e94 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c4a:	eb dd                	jmp    801c29 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801c4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c4f:	83 f8 2f             	cmp    $0x2f,%eax
+  801c52:	77 11                	ja     801c65 <vprintfmt+0x3ad>
+  801c54:	89 c2                	mov    %eax,%edx
+  801c56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c5a:	83 c0 08             	add    $0x8,%eax
+  801c5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c60:	4c 63 22             	movslq (%rdx),%r12
+  801c63:	eb c7                	jmp    801c2c <vprintfmt+0x374>
+  801c65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c71:	eb ed                	jmp    801c60 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801c73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c76:	83 f8 2f             	cmp    $0x2f,%eax
+  801c79:	77 11                	ja     801c8c <vprintfmt+0x3d4>
+  801c7b:	89 c2                	mov    %eax,%edx
+  801c7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c81:	83 c0 08             	add    $0x8,%eax
+  801c84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c87:	4c 8b 22             	mov    (%rdx),%r12
+  801c8a:	eb a0                	jmp    801c2c <vprintfmt+0x374>
+  801c8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c98:	eb ed                	jmp    801c87 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801c9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca6:	e9 65 ff ff ff       	jmp    801c10 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801cab:	4c 89 ee             	mov    %r13,%rsi
+  801cae:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801cb3:	41 ff d6             	call   *%r14
+                i = -i;
+  801cb6:	49 f7 dc             	neg    %r12
+  801cb9:	e9 73 ff ff ff       	jmp    801c31 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801cbe:	40 84 f6             	test   %sil,%sil
+  801cc1:	75 2e                	jne    801cf1 <vprintfmt+0x439>
+    switch (lflag) {
+  801cc3:	85 d2                	test   %edx,%edx
+  801cc5:	7f 59                	jg     801d20 <vprintfmt+0x468>
+  801cc7:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cca:	7d 7a                	jge    801d46 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801ccc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ccf:	83 f8 2f             	cmp    $0x2f,%eax
+  801cd2:	0f 87 aa 00 00 00    	ja     801d82 <vprintfmt+0x4ca>
+  801cd8:	89 c2                	mov    %eax,%edx
+  801cda:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cde:	83 c0 08             	add    $0x8,%eax
+  801ce1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ce4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801ce7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cec:	e9 a3 01 00 00       	jmp    801e94 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cf1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cf4:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf7:	77 19                	ja     801d12 <vprintfmt+0x45a>
+  801cf9:	89 c2                	mov    %eax,%edx
+  801cfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cff:	83 c0 08             	add    $0x8,%eax
+  801d02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d0d:	e9 82 01 00 00       	jmp    801e94 <vprintfmt+0x5dc>
+  801d12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d1e:	eb e5                	jmp    801d05 <vprintfmt+0x44d>
+    switch (lflag) {
+  801d20:	83 fa 01             	cmp    $0x1,%edx
+  801d23:	75 a7                	jne    801ccc <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801d25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d28:	83 f8 2f             	cmp    $0x2f,%eax
+  801d2b:	77 47                	ja     801d74 <vprintfmt+0x4bc>
+  801d2d:	89 c2                	mov    %eax,%edx
+  801d2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d33:	83 c0 08             	add    $0x8,%eax
+  801d36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d39:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d3c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d41:	e9 4e 01 00 00       	jmp    801e94 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d49:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4c:	77 18                	ja     801d66 <vprintfmt+0x4ae>
+  801d4e:	89 c2                	mov    %eax,%edx
+  801d50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d54:	83 c0 08             	add    $0x8,%eax
+  801d57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801d5c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801d61:	e9 2e 01 00 00       	jmp    801e94 <vprintfmt+0x5dc>
+  801d66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d72:	eb e6                	jmp    801d5a <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801d74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d80:	eb b7                	jmp    801d39 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8e:	e9 51 ff ff ff       	jmp    801ce4 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801d93:	40 84 f6             	test   %sil,%sil
+  801d96:	75 2e                	jne    801dc6 <vprintfmt+0x50e>
+    switch (lflag) {
+  801d98:	85 d2                	test   %edx,%edx
+  801d9a:	7f 59                	jg     801df5 <vprintfmt+0x53d>
+  801d9c:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d9f:	7d 77                	jge    801e18 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801da1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801da4:	83 f8 2f             	cmp    $0x2f,%eax
+  801da7:	0f 87 a4 00 00 00    	ja     801e51 <vprintfmt+0x599>
+  801dad:	89 c2                	mov    %eax,%edx
+  801daf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801db3:	83 c0 08             	add    $0x8,%eax
+  801db6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801db9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801dbc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801dc1:	e9 ce 00 00 00       	jmp    801e94 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801dc6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc9:	83 f8 2f             	cmp    $0x2f,%eax
+  801dcc:	77 19                	ja     801de7 <vprintfmt+0x52f>
+  801dce:	89 c2                	mov    %eax,%edx
+  801dd0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd4:	83 c0 08             	add    $0x8,%eax
+  801dd7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dda:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ddd:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801de2:	e9 ad 00 00 00       	jmp    801e94 <vprintfmt+0x5dc>
+  801de7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801deb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801def:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801df3:	eb e5                	jmp    801dda <vprintfmt+0x522>
+    switch (lflag) {
+  801df5:	83 fa 01             	cmp    $0x1,%edx
+  801df8:	75 a7                	jne    801da1 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801dfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dfd:	83 f8 2f             	cmp    $0x2f,%eax
+  801e00:	77 41                	ja     801e43 <vprintfmt+0x58b>
+  801e02:	89 c2                	mov    %eax,%edx
+  801e04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e08:	83 c0 08             	add    $0x8,%eax
+  801e0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e11:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801e16:	eb 7c                	jmp    801e94 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e1e:	77 15                	ja     801e35 <vprintfmt+0x57d>
+  801e20:	89 c2                	mov    %eax,%edx
+  801e22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e26:	83 c0 08             	add    $0x8,%eax
+  801e29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e2c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e2e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e33:	eb 5f                	jmp    801e94 <vprintfmt+0x5dc>
+  801e35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e41:	eb e9                	jmp    801e2c <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e4f:	eb bd                	jmp    801e0e <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801e51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e5d:	e9 57 ff ff ff       	jmp    801db9 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801e62:	4c 89 ee             	mov    %r13,%rsi
+  801e65:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e6a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801e6d:	4c 89 ee             	mov    %r13,%rsi
+  801e70:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e75:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801e78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7e:	77 47                	ja     801ec7 <vprintfmt+0x60f>
+  801e80:	89 c2                	mov    %eax,%edx
+  801e82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e86:	83 c0 08             	add    $0x8,%eax
+  801e89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801e94:	48 83 ec 08          	sub    $0x8,%rsp
+  801e98:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801e9c:	0f 94 c0             	sete   %al
+  801e9f:	0f b6 c0             	movzbl %al,%eax
+  801ea2:	50                   	push   %rax
+  801ea3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801ea8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801eac:	4c 89 ee             	mov    %r13,%rsi
+  801eaf:	4c 89 f7             	mov    %r14,%rdi
+  801eb2:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+            break;
+  801ebe:	48 83 c4 10          	add    $0x10,%rsp
+  801ec2:	e9 31 fa ff ff       	jmp    8018f8 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801ec7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ecb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ecf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed3:	eb b7                	jmp    801e8c <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801ed5:	40 84 f6             	test   %sil,%sil
+  801ed8:	75 2b                	jne    801f05 <vprintfmt+0x64d>
+    switch (lflag) {
+  801eda:	85 d2                	test   %edx,%edx
+  801edc:	7f 56                	jg     801f34 <vprintfmt+0x67c>
+  801ede:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ee1:	7d 77                	jge    801f5a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801ee3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee9:	0f 87 a7 00 00 00    	ja     801f96 <vprintfmt+0x6de>
+  801eef:	89 c2                	mov    %eax,%edx
+  801ef1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef5:	83 c0 08             	add    $0x8,%eax
+  801ef8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801efb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801efe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f03:	eb 8f                	jmp    801e94 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f08:	83 f8 2f             	cmp    $0x2f,%eax
+  801f0b:	77 19                	ja     801f26 <vprintfmt+0x66e>
+  801f0d:	89 c2                	mov    %eax,%edx
+  801f0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f13:	83 c0 08             	add    $0x8,%eax
+  801f16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f19:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f1c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f21:	e9 6e ff ff ff       	jmp    801e94 <vprintfmt+0x5dc>
+  801f26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f32:	eb e5                	jmp    801f19 <vprintfmt+0x661>
+    switch (lflag) {
+  801f34:	83 fa 01             	cmp    $0x1,%edx
+  801f37:	75 aa                	jne    801ee3 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f3c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f3f:	77 47                	ja     801f88 <vprintfmt+0x6d0>
+  801f41:	89 c2                	mov    %eax,%edx
+  801f43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f47:	83 c0 08             	add    $0x8,%eax
+  801f4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f50:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801f55:	e9 3a ff ff ff       	jmp    801e94 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5d:	83 f8 2f             	cmp    $0x2f,%eax
+  801f60:	77 18                	ja     801f7a <vprintfmt+0x6c2>
+  801f62:	89 c2                	mov    %eax,%edx
+  801f64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f68:	83 c0 08             	add    $0x8,%eax
+  801f6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f6e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801f70:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801f75:	e9 1a ff ff ff       	jmp    801e94 <vprintfmt+0x5dc>
+  801f7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f86:	eb e6                	jmp    801f6e <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801f88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f94:	eb b7                	jmp    801f4d <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801f96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa2:	e9 54 ff ff ff       	jmp    801efb <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801fa7:	4c 89 ee             	mov    %r13,%rsi
+  801faa:	bf 25 00 00 00       	mov    $0x25,%edi
+  801faf:	41 ff d6             	call   *%r14
+            break;
+  801fb2:	e9 41 f9 ff ff       	jmp    8018f8 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801fb7:	4c 89 ee             	mov    %r13,%rsi
+  801fba:	bf 25 00 00 00       	mov    $0x25,%edi
+  801fbf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801fc2:	48 83 eb 01          	sub    $0x1,%rbx
+  801fc6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801fca:	75 f6                	jne    801fc2 <vprintfmt+0x70a>
+  801fcc:	e9 27 f9 ff ff       	jmp    8018f8 <vprintfmt+0x40>
+
+0000000000801fd1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801fd1:	55                   	push   %rbp
+  801fd2:	48 89 e5             	mov    %rsp,%rbp
+  801fd5:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801fd9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801fdd:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801fe2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801fe6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801fed:	48 85 ff             	test   %rdi,%rdi
+  801ff0:	74 2b                	je     80201d <vsnprintf+0x4c>
+  801ff2:	48 85 f6             	test   %rsi,%rsi
+  801ff5:	74 26                	je     80201d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801ff7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ffb:	48 bf 63 18 80 00 00 	movabs $0x801863,%rdi
+  802002:	00 00 00 
+  802005:	48 b8 b8 18 80 00 00 	movabs $0x8018b8,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802011:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802015:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802018:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80201b:	c9                   	leave
+  80201c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80201d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802022:	eb f7                	jmp    80201b <vsnprintf+0x4a>
+
+0000000000802024 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802024:	55                   	push   %rbp
+  802025:	48 89 e5             	mov    %rsp,%rbp
+  802028:	48 83 ec 50          	sub    $0x50,%rsp
+  80202c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802030:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802034:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802038:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80203f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802043:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802047:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80204b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80204f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802053:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80205f:	c9                   	leave
+  802060:	c3                   	ret
+
+0000000000802061 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802061:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802064:	74 10                	je     802076 <strlen+0x15>
+    size_t n = 0;
+  802066:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80206b:	48 83 c0 01          	add    $0x1,%rax
+  80206f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802073:	75 f6                	jne    80206b <strlen+0xa>
+  802075:	c3                   	ret
+    size_t n = 0;
+  802076:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80207b:	c3                   	ret
+
+000000000080207c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80207c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80207f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802084:	48 85 f6             	test   %rsi,%rsi
+  802087:	74 11                	je     80209a <strnlen+0x1e>
+  802089:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80208d:	74 0c                	je     80209b <strnlen+0x1f>
+  80208f:	48 83 c2 01          	add    $0x1,%rdx
+  802093:	48 39 d0             	cmp    %rdx,%rax
+  802096:	75 f1                	jne    802089 <strnlen+0xd>
+  802098:	eb 04                	jmp    80209e <strnlen+0x22>
+  80209a:	c3                   	ret
+  80209b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80209e:	c3                   	ret
+
+000000000080209f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80209f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8020a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8020ab:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8020ae:	48 83 c2 01          	add    $0x1,%rdx
+  8020b2:	84 c9                	test   %cl,%cl
+  8020b4:	75 f1                	jne    8020a7 <strcpy+0x8>
+        ;
+    return res;
+}
+  8020b6:	c3                   	ret
+
+00000000008020b7 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8020b7:	55                   	push   %rbp
+  8020b8:	48 89 e5             	mov    %rsp,%rbp
+  8020bb:	41 54                	push   %r12
+  8020bd:	53                   	push   %rbx
+  8020be:	48 89 fb             	mov    %rdi,%rbx
+  8020c1:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8020c4:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  8020cb:	00 00 00 
+  8020ce:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8020d0:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8020d4:	4c 89 e6             	mov    %r12,%rsi
+  8020d7:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+    return dst;
+}
+  8020e3:	48 89 d8             	mov    %rbx,%rax
+  8020e6:	5b                   	pop    %rbx
+  8020e7:	41 5c                	pop    %r12
+  8020e9:	5d                   	pop    %rbp
+  8020ea:	c3                   	ret
+
+00000000008020eb <toupper>:
+
+int
+toupper(int ch) {
+  8020eb:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8020ed:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8020f0:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8020f3:	83 f9 1a             	cmp    $0x1a,%ecx
+  8020f6:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8020f9:	c3                   	ret
+
+00000000008020fa <tolower>:
+
+int
+tolower(int ch) {
+  8020fa:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8020fc:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8020ff:	8d 57 20             	lea    0x20(%rdi),%edx
+  802102:	83 f9 1a             	cmp    $0x1a,%ecx
+  802105:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802108:	c3                   	ret
+
+0000000000802109 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802109:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80210c:	48 85 d2             	test   %rdx,%rdx
+  80210f:	74 1f                	je     802130 <strncpy+0x27>
+  802111:	48 01 fa             	add    %rdi,%rdx
+  802114:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802117:	48 83 c1 01          	add    $0x1,%rcx
+  80211b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80211f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802123:	41 80 f8 01          	cmp    $0x1,%r8b
+  802127:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80212b:	48 39 ca             	cmp    %rcx,%rdx
+  80212e:	75 e7                	jne    802117 <strncpy+0xe>
+    }
+    return ret;
+}
+  802130:	c3                   	ret
+
+0000000000802131 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802131:	48 89 f8             	mov    %rdi,%rax
+  802134:	48 85 d2             	test   %rdx,%rdx
+  802137:	74 24                	je     80215d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802139:	48 83 ea 01          	sub    $0x1,%rdx
+  80213d:	74 1b                	je     80215a <strlcpy+0x29>
+  80213f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802143:	0f b6 16             	movzbl (%rsi),%edx
+  802146:	84 d2                	test   %dl,%dl
+  802148:	74 10                	je     80215a <strlcpy+0x29>
+            *dst++ = *src++;
+  80214a:	48 83 c6 01          	add    $0x1,%rsi
+  80214e:	48 83 c0 01          	add    $0x1,%rax
+  802152:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802155:	48 39 c8             	cmp    %rcx,%rax
+  802158:	75 e9                	jne    802143 <strlcpy+0x12>
+        *dst = '\0';
+  80215a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80215d:	48 29 f8             	sub    %rdi,%rax
+}
+  802160:	c3                   	ret
+
+0000000000802161 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802161:	0f b6 07             	movzbl (%rdi),%eax
+  802164:	84 c0                	test   %al,%al
+  802166:	74 13                	je     80217b <strcmp+0x1a>
+  802168:	38 06                	cmp    %al,(%rsi)
+  80216a:	75 0f                	jne    80217b <strcmp+0x1a>
+  80216c:	48 83 c7 01          	add    $0x1,%rdi
+  802170:	48 83 c6 01          	add    $0x1,%rsi
+  802174:	0f b6 07             	movzbl (%rdi),%eax
+  802177:	84 c0                	test   %al,%al
+  802179:	75 ed                	jne    802168 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80217b:	0f b6 c0             	movzbl %al,%eax
+  80217e:	0f b6 16             	movzbl (%rsi),%edx
+  802181:	29 d0                	sub    %edx,%eax
+}
+  802183:	c3                   	ret
+
+0000000000802184 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802184:	48 85 d2             	test   %rdx,%rdx
+  802187:	74 1f                	je     8021a8 <strncmp+0x24>
+  802189:	0f b6 07             	movzbl (%rdi),%eax
+  80218c:	84 c0                	test   %al,%al
+  80218e:	74 1e                	je     8021ae <strncmp+0x2a>
+  802190:	3a 06                	cmp    (%rsi),%al
+  802192:	75 1a                	jne    8021ae <strncmp+0x2a>
+  802194:	48 83 c7 01          	add    $0x1,%rdi
+  802198:	48 83 c6 01          	add    $0x1,%rsi
+  80219c:	48 83 ea 01          	sub    $0x1,%rdx
+  8021a0:	75 e7                	jne    802189 <strncmp+0x5>
+
+    if (!n) return 0;
+  8021a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a7:	c3                   	ret
+  8021a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ad:	c3                   	ret
+  8021ae:	48 85 d2             	test   %rdx,%rdx
+  8021b1:	74 09                	je     8021bc <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8021b3:	0f b6 07             	movzbl (%rdi),%eax
+  8021b6:	0f b6 16             	movzbl (%rsi),%edx
+  8021b9:	29 d0                	sub    %edx,%eax
+  8021bb:	c3                   	ret
+    if (!n) return 0;
+  8021bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c1:	c3                   	ret
+
+00000000008021c2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8021c2:	0f b6 17             	movzbl (%rdi),%edx
+  8021c5:	84 d2                	test   %dl,%dl
+  8021c7:	74 18                	je     8021e1 <strchr+0x1f>
+        if (*str == c) {
+  8021c9:	0f be d2             	movsbl %dl,%edx
+  8021cc:	39 f2                	cmp    %esi,%edx
+  8021ce:	74 17                	je     8021e7 <strchr+0x25>
+    for (; *str; str++) {
+  8021d0:	48 83 c7 01          	add    $0x1,%rdi
+  8021d4:	0f b6 17             	movzbl (%rdi),%edx
+  8021d7:	84 d2                	test   %dl,%dl
+  8021d9:	75 ee                	jne    8021c9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8021db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e0:	c3                   	ret
+  8021e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e6:	c3                   	ret
+  8021e7:	48 89 f8             	mov    %rdi,%rax
+}
+  8021ea:	c3                   	ret
+
+00000000008021eb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8021eb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8021ee:	0f b6 17             	movzbl (%rdi),%edx
+  8021f1:	84 d2                	test   %dl,%dl
+  8021f3:	74 13                	je     802208 <strfind+0x1d>
+  8021f5:	0f be d2             	movsbl %dl,%edx
+  8021f8:	39 f2                	cmp    %esi,%edx
+  8021fa:	74 0b                	je     802207 <strfind+0x1c>
+  8021fc:	48 83 c0 01          	add    $0x1,%rax
+  802200:	0f b6 10             	movzbl (%rax),%edx
+  802203:	84 d2                	test   %dl,%dl
+  802205:	75 ee                	jne    8021f5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802207:	c3                   	ret
+  802208:	c3                   	ret
+
+0000000000802209 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802209:	48 39 f7             	cmp    %rsi,%rdi
+  80220c:	74 65                	je     802273 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80220e:	55                   	push   %rbp
+  80220f:	48 89 e5             	mov    %rsp,%rbp
+  802212:	41 57                	push   %r15
+  802214:	41 56                	push   %r14
+  802216:	41 55                	push   %r13
+  802218:	41 54                	push   %r12
+  80221a:	53                   	push   %rbx
+  80221b:	48 83 ec 18          	sub    $0x18,%rsp
+  80221f:	48 89 fb             	mov    %rdi,%rbx
+  802222:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802225:	49 bf fa 20 80 00 00 	movabs $0x8020fa,%r15
+  80222c:	00 00 00 
+  80222f:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802233:	41 0f b6 fd          	movzbl %r13b,%edi
+  802237:	41 ff d7             	call   *%r15
+  80223a:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80223d:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802242:	41 0f b6 fe          	movzbl %r14b,%edi
+  802246:	41 ff d7             	call   *%r15
+  802249:	89 c2                	mov    %eax,%edx
+  80224b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80224e:	29 d0                	sub    %edx,%eax
+  802250:	75 12                	jne    802264 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802252:	48 83 c3 01          	add    $0x1,%rbx
+  802256:	45 84 ed             	test   %r13b,%r13b
+  802259:	74 09                	je     802264 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80225b:	49 83 c4 01          	add    $0x1,%r12
+  80225f:	45 84 f6             	test   %r14b,%r14b
+  802262:	75 cb                	jne    80222f <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802264:	48 83 c4 18          	add    $0x18,%rsp
+  802268:	5b                   	pop    %rbx
+  802269:	41 5c                	pop    %r12
+  80226b:	41 5d                	pop    %r13
+  80226d:	41 5e                	pop    %r14
+  80226f:	41 5f                	pop    %r15
+  802271:	5d                   	pop    %rbp
+  802272:	c3                   	ret
+    if (p1 == p2) return 0;
+  802273:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802278:	c3                   	ret
+
+0000000000802279 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802279:	48 39 f7             	cmp    %rsi,%rdi
+  80227c:	74 7d                	je     8022fb <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80227e:	55                   	push   %rbp
+  80227f:	48 89 e5             	mov    %rsp,%rbp
+  802282:	41 57                	push   %r15
+  802284:	41 56                	push   %r14
+  802286:	41 55                	push   %r13
+  802288:	41 54                	push   %r12
+  80228a:	53                   	push   %rbx
+  80228b:	48 83 ec 18          	sub    $0x18,%rsp
+  80228f:	48 89 fb             	mov    %rdi,%rbx
+  802292:	49 89 f4             	mov    %rsi,%r12
+  802295:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802299:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80229d:	49 bf fa 20 80 00 00 	movabs $0x8020fa,%r15
+  8022a4:	00 00 00 
+    while (n--) {
+  8022a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022ab:	48 39 c3             	cmp    %rax,%rbx
+  8022ae:	74 37                	je     8022e7 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022b0:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022b4:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022b8:	41 ff d7             	call   *%r15
+  8022bb:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022be:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8022c3:	41 0f b6 fe          	movzbl %r14b,%edi
+  8022c7:	41 ff d7             	call   *%r15
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022cf:	29 d0                	sub    %edx,%eax
+  8022d1:	75 19                	jne    8022ec <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8022d3:	48 83 c3 01          	add    $0x1,%rbx
+  8022d7:	45 84 ed             	test   %r13b,%r13b
+  8022da:	74 10                	je     8022ec <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8022dc:	49 83 c4 01          	add    $0x1,%r12
+  8022e0:	45 84 f6             	test   %r14b,%r14b
+  8022e3:	75 c2                	jne    8022a7 <strncasecmp+0x2e>
+  8022e5:	eb 05                	jmp    8022ec <strncasecmp+0x73>
+  8022e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8022ec:	48 83 c4 18          	add    $0x18,%rsp
+  8022f0:	5b                   	pop    %rbx
+  8022f1:	41 5c                	pop    %r12
+  8022f3:	41 5d                	pop    %r13
+  8022f5:	41 5e                	pop    %r14
+  8022f7:	41 5f                	pop    %r15
+  8022f9:	5d                   	pop    %rbp
+  8022fa:	c3                   	ret
+    if (p1 == p2) return 0;
+  8022fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802300:	c3                   	ret
+
+0000000000802301 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802301:	83 e7 df             	and    $0xffffffdf,%edi
+  802304:	83 ef 41             	sub    $0x41,%edi
+  802307:	83 ff 19             	cmp    $0x19,%edi
+  80230a:	0f 96 c0             	setbe  %al
+}
+  80230d:	c3                   	ret
+
+000000000080230e <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80230e:	83 ff 20             	cmp    $0x20,%edi
+  802311:	0f 94 c0             	sete   %al
+  802314:	83 ff 09             	cmp    $0x9,%edi
+  802317:	0f 94 c2             	sete   %dl
+  80231a:	09 d0                	or     %edx,%eax
+}
+  80231c:	c3                   	ret
+
+000000000080231d <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80231d:	55                   	push   %rbp
+  80231e:	48 89 e5             	mov    %rsp,%rbp
+  802321:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802323:	48 bf ff 61 80 00 00 	movabs $0x8061ff,%rdi
+  80232a:	00 00 00 
+  80232d:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+  802339:	48 85 c0             	test   %rax,%rax
+  80233c:	0f 95 c0             	setne  %al
+}
+  80233f:	5d                   	pop    %rbp
+  802340:	c3                   	ret
+
+0000000000802341 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802341:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802344:	48 89 f8             	mov    %rdi,%rax
+  802347:	48 f7 d8             	neg    %rax
+  80234a:	83 e0 07             	and    $0x7,%eax
+  80234d:	49 89 d1             	mov    %rdx,%r9
+  802350:	49 29 c1             	sub    %rax,%r9
+  802353:	78 36                	js     80238b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802355:	40 0f b6 c6          	movzbl %sil,%eax
+  802359:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802360:	01 01 01 
+  802363:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802367:	40 f6 c7 07          	test   $0x7,%dil
+  80236b:	75 38                	jne    8023a5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80236d:	4c 89 c9             	mov    %r9,%rcx
+  802370:	48 c1 f9 03          	sar    $0x3,%rcx
+  802374:	74 0c                	je     802382 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802376:	fc                   	cld
+  802377:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80237a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80237e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802382:	4d 85 c9             	test   %r9,%r9
+  802385:	75 45                	jne    8023cc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802387:	4c 89 c0             	mov    %r8,%rax
+  80238a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80238b:	48 85 d2             	test   %rdx,%rdx
+  80238e:	74 f7                	je     802387 <memset+0x46>
+  802390:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802393:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802396:	48 83 c0 01          	add    $0x1,%rax
+  80239a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80239e:	48 39 c2             	cmp    %rax,%rdx
+  8023a1:	75 f3                	jne    802396 <memset+0x55>
+  8023a3:	eb e2                	jmp    802387 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8023a5:	40 f6 c7 01          	test   $0x1,%dil
+  8023a9:	74 06                	je     8023b1 <memset+0x70>
+  8023ab:	88 07                	mov    %al,(%rdi)
+  8023ad:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023b1:	40 f6 c7 02          	test   $0x2,%dil
+  8023b5:	74 07                	je     8023be <memset+0x7d>
+  8023b7:	66 89 07             	mov    %ax,(%rdi)
+  8023ba:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023be:	40 f6 c7 04          	test   $0x4,%dil
+  8023c2:	74 a9                	je     80236d <memset+0x2c>
+  8023c4:	89 07                	mov    %eax,(%rdi)
+  8023c6:	48 83 c7 04          	add    $0x4,%rdi
+  8023ca:	eb a1                	jmp    80236d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023cc:	41 f6 c1 04          	test   $0x4,%r9b
+  8023d0:	74 06                	je     8023d8 <memset+0x97>
+  8023d2:	89 07                	mov    %eax,(%rdi)
+  8023d4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023d8:	41 f6 c1 02          	test   $0x2,%r9b
+  8023dc:	74 07                	je     8023e5 <memset+0xa4>
+  8023de:	66 89 07             	mov    %ax,(%rdi)
+  8023e1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8023e5:	41 f6 c1 01          	test   $0x1,%r9b
+  8023e9:	74 9c                	je     802387 <memset+0x46>
+  8023eb:	88 07                	mov    %al,(%rdi)
+  8023ed:	eb 98                	jmp    802387 <memset+0x46>
+
+00000000008023ef <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8023ef:	48 89 f8             	mov    %rdi,%rax
+  8023f2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8023f5:	48 39 fe             	cmp    %rdi,%rsi
+  8023f8:	73 3b                	jae    802435 <memmove+0x46>
+  8023fa:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8023fe:	48 39 d7             	cmp    %rdx,%rdi
+  802401:	73 32                	jae    802435 <memmove+0x46>
+        s += n;
+        d += n;
+  802403:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802407:	48 89 d6             	mov    %rdx,%rsi
+  80240a:	48 09 fe             	or     %rdi,%rsi
+  80240d:	48 09 ce             	or     %rcx,%rsi
+  802410:	40 f6 c6 07          	test   $0x7,%sil
+  802414:	75 12                	jne    802428 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802416:	48 83 ef 08          	sub    $0x8,%rdi
+  80241a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80241e:	48 c1 e9 03          	shr    $0x3,%rcx
+  802422:	fd                   	std
+  802423:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802426:	fc                   	cld
+  802427:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802428:	48 83 ef 01          	sub    $0x1,%rdi
+  80242c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802430:	fd                   	std
+  802431:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802433:	eb f1                	jmp    802426 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802435:	48 89 f2             	mov    %rsi,%rdx
+  802438:	48 09 c2             	or     %rax,%rdx
+  80243b:	48 09 ca             	or     %rcx,%rdx
+  80243e:	f6 c2 07             	test   $0x7,%dl
+  802441:	75 0c                	jne    80244f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802443:	48 c1 e9 03          	shr    $0x3,%rcx
+  802447:	48 89 c7             	mov    %rax,%rdi
+  80244a:	fc                   	cld
+  80244b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80244e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80244f:	48 89 c7             	mov    %rax,%rdi
+  802452:	fc                   	cld
+  802453:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802455:	c3                   	ret
+
+0000000000802456 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802456:	55                   	push   %rbp
+  802457:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80245a:	48 b8 ef 23 80 00 00 	movabs $0x8023ef,%rax
+  802461:	00 00 00 
+  802464:	ff d0                	call   *%rax
+}
+  802466:	5d                   	pop    %rbp
+  802467:	c3                   	ret
+
+0000000000802468 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802468:	55                   	push   %rbp
+  802469:	48 89 e5             	mov    %rsp,%rbp
+  80246c:	41 57                	push   %r15
+  80246e:	41 56                	push   %r14
+  802470:	41 55                	push   %r13
+  802472:	41 54                	push   %r12
+  802474:	53                   	push   %rbx
+  802475:	48 83 ec 08          	sub    $0x8,%rsp
+  802479:	49 89 fe             	mov    %rdi,%r14
+  80247c:	49 89 f7             	mov    %rsi,%r15
+  80247f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802482:	48 89 f7             	mov    %rsi,%rdi
+  802485:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  80248c:	00 00 00 
+  80248f:	ff d0                	call   *%rax
+  802491:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802494:	48 89 de             	mov    %rbx,%rsi
+  802497:	4c 89 f7             	mov    %r14,%rdi
+  80249a:	48 b8 7c 20 80 00 00 	movabs $0x80207c,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+  8024a6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024a9:	48 39 c3             	cmp    %rax,%rbx
+  8024ac:	74 36                	je     8024e4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8024ae:	48 89 d8             	mov    %rbx,%rax
+  8024b1:	4c 29 e8             	sub    %r13,%rax
+  8024b4:	49 39 c4             	cmp    %rax,%r12
+  8024b7:	73 31                	jae    8024ea <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8024b9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8024be:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024c2:	4c 89 fe             	mov    %r15,%rsi
+  8024c5:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8024d1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8024d5:	48 83 c4 08          	add    $0x8,%rsp
+  8024d9:	5b                   	pop    %rbx
+  8024da:	41 5c                	pop    %r12
+  8024dc:	41 5d                	pop    %r13
+  8024de:	41 5e                	pop    %r14
+  8024e0:	41 5f                	pop    %r15
+  8024e2:	5d                   	pop    %rbp
+  8024e3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024e4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8024e8:	eb eb                	jmp    8024d5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8024ea:	48 83 eb 01          	sub    $0x1,%rbx
+  8024ee:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024f2:	48 89 da             	mov    %rbx,%rdx
+  8024f5:	4c 89 fe             	mov    %r15,%rsi
+  8024f8:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802504:	49 01 de             	add    %rbx,%r14
+  802507:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80250c:	eb c3                	jmp    8024d1 <strlcat+0x69>
+
+000000000080250e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80250e:	48 85 d2             	test   %rdx,%rdx
+  802511:	74 2d                	je     802540 <memcmp+0x32>
+  802513:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802518:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80251c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802521:	44 38 c1             	cmp    %r8b,%cl
+  802524:	75 0f                	jne    802535 <memcmp+0x27>
+    while (n-- > 0) {
+  802526:	48 83 c0 01          	add    $0x1,%rax
+  80252a:	48 39 c2             	cmp    %rax,%rdx
+  80252d:	75 e9                	jne    802518 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80252f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802534:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802535:	0f b6 c1             	movzbl %cl,%eax
+  802538:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80253c:	44 29 c0             	sub    %r8d,%eax
+  80253f:	c3                   	ret
+    return 0;
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802545:	c3                   	ret
+
+0000000000802546 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802546:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80254a:	48 39 c7             	cmp    %rax,%rdi
+  80254d:	73 0f                	jae    80255e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80254f:	40 38 37             	cmp    %sil,(%rdi)
+  802552:	74 0e                	je     802562 <memfind+0x1c>
+    for (; src < end; src++) {
+  802554:	48 83 c7 01          	add    $0x1,%rdi
+  802558:	48 39 f8             	cmp    %rdi,%rax
+  80255b:	75 f2                	jne    80254f <memfind+0x9>
+  80255d:	c3                   	ret
+  80255e:	48 89 f8             	mov    %rdi,%rax
+  802561:	c3                   	ret
+  802562:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802565:	c3                   	ret
+
+0000000000802566 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802566:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802569:	0f b6 37             	movzbl (%rdi),%esi
+  80256c:	40 80 fe 20          	cmp    $0x20,%sil
+  802570:	74 06                	je     802578 <strtol+0x12>
+  802572:	40 80 fe 09          	cmp    $0x9,%sil
+  802576:	75 13                	jne    80258b <strtol+0x25>
+  802578:	48 83 c7 01          	add    $0x1,%rdi
+  80257c:	0f b6 37             	movzbl (%rdi),%esi
+  80257f:	40 80 fe 20          	cmp    $0x20,%sil
+  802583:	74 f3                	je     802578 <strtol+0x12>
+  802585:	40 80 fe 09          	cmp    $0x9,%sil
+  802589:	74 ed                	je     802578 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80258b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80258e:	83 e0 fd             	and    $0xfffffffd,%eax
+  802591:	3c 01                	cmp    $0x1,%al
+  802593:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802597:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80259d:	75 0f                	jne    8025ae <strtol+0x48>
+  80259f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8025a2:	74 14                	je     8025b8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8025a4:	85 d2                	test   %edx,%edx
+  8025a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025ab:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8025ae:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8025b3:	4c 63 ca             	movslq %edx,%r9
+  8025b6:	eb 36                	jmp    8025ee <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025b8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8025bc:	74 0f                	je     8025cd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8025be:	85 d2                	test   %edx,%edx
+  8025c0:	75 ec                	jne    8025ae <strtol+0x48>
+        s++;
+  8025c2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8025c6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8025cb:	eb e1                	jmp    8025ae <strtol+0x48>
+        s += 2;
+  8025cd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8025d1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8025d6:	eb d6                	jmp    8025ae <strtol+0x48>
+            dig -= '0';
+  8025d8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8025db:	44 0f b6 c1          	movzbl %cl,%r8d
+  8025df:	41 39 d0             	cmp    %edx,%r8d
+  8025e2:	7d 21                	jge    802605 <strtol+0x9f>
+        val = val * base + dig;
+  8025e4:	49 0f af c1          	imul   %r9,%rax
+  8025e8:	0f b6 c9             	movzbl %cl,%ecx
+  8025eb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8025ee:	48 83 c7 01          	add    $0x1,%rdi
+  8025f2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8025f6:	80 f9 39             	cmp    $0x39,%cl
+  8025f9:	76 dd                	jbe    8025d8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8025fb:	80 f9 7b             	cmp    $0x7b,%cl
+  8025fe:	77 05                	ja     802605 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802600:	83 e9 57             	sub    $0x57,%ecx
+  802603:	eb d6                	jmp    8025db <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802605:	4d 85 d2             	test   %r10,%r10
+  802608:	74 03                	je     80260d <strtol+0xa7>
+  80260a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80260d:	48 89 c2             	mov    %rax,%rdx
+  802610:	48 f7 da             	neg    %rdx
+  802613:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802617:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80261b:	c3                   	ret
+
+000000000080261c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80261c:	55                   	push   %rbp
+  80261d:	48 89 e5             	mov    %rsp,%rbp
+  802620:	53                   	push   %rbx
+  802621:	48 89 fa             	mov    %rdi,%rdx
+  802624:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802627:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80262c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802631:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802636:	be 00 00 00 00       	mov    $0x0,%esi
+  80263b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802641:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802647:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802649:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80264d:	c9                   	leave
+  80264e:	c3                   	ret
+
+000000000080264f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80264f:	55                   	push   %rbp
+  802650:	48 89 e5             	mov    %rsp,%rbp
+  802653:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802654:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802659:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802663:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802668:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80266d:	be 00 00 00 00       	mov    $0x0,%esi
+  802672:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802678:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80267e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802680:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802684:	c9                   	leave
+  802685:	c3                   	ret
+
+0000000000802686 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	53                   	push   %rbx
+  80268b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80268e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802693:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802698:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80269d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026b3:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8026b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026b9:	c9                   	leave
+  8026ba:	c3                   	ret
+
+00000000008026bb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8026bb:	55                   	push   %rbp
+  8026bc:	48 89 e5             	mov    %rsp,%rbp
+  8026bf:	53                   	push   %rbx
+  8026c0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8026c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8026c7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026db:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8026ee:	48 85 c0             	test   %rax,%rax
+  8026f1:	7f 06                	jg     8026f9 <sys_env_destroy+0x3e>
+}
+  8026f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026f7:	c9                   	leave
+  8026f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8026f9:	49 89 c0             	mov    %rax,%r8
+  8026fc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802701:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802708:	00 00 00 
+  80270b:	be 27 00 00 00       	mov    $0x27,%esi
+  802710:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802717:	00 00 00 
+  80271a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271f:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802726:	00 00 00 
+  802729:	41 ff d1             	call   *%r9
+
+000000000080272c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80272c:	55                   	push   %rbp
+  80272d:	48 89 e5             	mov    %rsp,%rbp
+  802730:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802731:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802736:	ba 00 00 00 00       	mov    $0x0,%edx
+  80273b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802740:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802745:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80274a:	be 00 00 00 00       	mov    $0x0,%esi
+  80274f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802755:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80275b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80275d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802761:	c9                   	leave
+  802762:	c3                   	ret
+
+0000000000802763 <sys_yield>:
+
+void
+sys_yield(void) {
+  802763:	55                   	push   %rbp
+  802764:	48 89 e5             	mov    %rsp,%rbp
+  802767:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802768:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80276d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802772:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802777:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80277c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802781:	be 00 00 00 00       	mov    $0x0,%esi
+  802786:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80278c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802792:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802794:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802798:	c9                   	leave
+  802799:	c3                   	ret
+
+000000000080279a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+  80279e:	53                   	push   %rbx
+  80279f:	48 89 fa             	mov    %rdi,%rdx
+  8027a2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027aa:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027b1:	00 00 00 
+  8027b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ca:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8027cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d0:	c9                   	leave
+  8027d1:	c3                   	ret
+
+00000000008027d2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8027d2:	55                   	push   %rbp
+  8027d3:	48 89 e5             	mov    %rsp,%rbp
+  8027d6:	53                   	push   %rbx
+  8027d7:	49 89 f8             	mov    %rdi,%r8
+  8027da:	48 89 d3             	mov    %rdx,%rbx
+  8027dd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8027e0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027e5:	4c 89 c2             	mov    %r8,%rdx
+  8027e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027fc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8027fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802802:	c9                   	leave
+  802803:	c3                   	ret
+
+0000000000802804 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802804:	55                   	push   %rbp
+  802805:	48 89 e5             	mov    %rsp,%rbp
+  802808:	53                   	push   %rbx
+  802809:	48 83 ec 08          	sub    $0x8,%rsp
+  80280d:	89 f8                	mov    %edi,%eax
+  80280f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802812:	48 63 f9             	movslq %ecx,%rdi
+  802815:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802818:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80281d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802820:	be 00 00 00 00       	mov    $0x0,%esi
+  802825:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80282b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802831:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802833:	48 85 c0             	test   %rax,%rax
+  802836:	7f 06                	jg     80283e <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802838:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80283c:	c9                   	leave
+  80283d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80283e:	49 89 c0             	mov    %rax,%r8
+  802841:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802846:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  80284d:	00 00 00 
+  802850:	be 27 00 00 00       	mov    $0x27,%esi
+  802855:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  80285c:	00 00 00 
+  80285f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802864:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  80286b:	00 00 00 
+  80286e:	41 ff d1             	call   *%r9
+
+0000000000802871 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802871:	55                   	push   %rbp
+  802872:	48 89 e5             	mov    %rsp,%rbp
+  802875:	53                   	push   %rbx
+  802876:	48 83 ec 08          	sub    $0x8,%rsp
+  80287a:	89 f8                	mov    %edi,%eax
+  80287c:	49 89 f2             	mov    %rsi,%r10
+  80287f:	48 89 cf             	mov    %rcx,%rdi
+  802882:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802885:	48 63 da             	movslq %edx,%rbx
+  802888:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80288b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802890:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802893:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802896:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80289c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80289e:	48 85 c0             	test   %rax,%rax
+  8028a1:	7f 06                	jg     8028a9 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8028a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028a7:	c9                   	leave
+  8028a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028a9:	49 89 c0             	mov    %rax,%r8
+  8028ac:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8028b1:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  8028b8:	00 00 00 
+  8028bb:	be 27 00 00 00       	mov    $0x27,%esi
+  8028c0:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  8028c7:	00 00 00 
+  8028ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cf:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  8028d6:	00 00 00 
+  8028d9:	41 ff d1             	call   *%r9
+
+00000000008028dc <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8028dc:	55                   	push   %rbp
+  8028dd:	48 89 e5             	mov    %rsp,%rbp
+  8028e0:	53                   	push   %rbx
+  8028e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e5:	48 89 f1             	mov    %rsi,%rcx
+  8028e8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8028eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028ee:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802903:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802909:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80290b:	48 85 c0             	test   %rax,%rax
+  80290e:	7f 06                	jg     802916 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802910:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802914:	c9                   	leave
+  802915:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802916:	49 89 c0             	mov    %rax,%r8
+  802919:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80291e:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802925:	00 00 00 
+  802928:	be 27 00 00 00       	mov    $0x27,%esi
+  80292d:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802934:	00 00 00 
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293c:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802943:	00 00 00 
+  802946:	41 ff d1             	call   *%r9
+
+0000000000802949 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802949:	55                   	push   %rbp
+  80294a:	48 89 e5             	mov    %rsp,%rbp
+  80294d:	53                   	push   %rbx
+  80294e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802952:	48 63 ce             	movslq %esi,%rcx
+  802955:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802958:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80295d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802962:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802967:	be 00 00 00 00       	mov    $0x0,%esi
+  80296c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802972:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802978:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80297a:	48 85 c0             	test   %rax,%rax
+  80297d:	7f 06                	jg     802985 <sys_env_set_status+0x3c>
+}
+  80297f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802983:	c9                   	leave
+  802984:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802985:	49 89 c0             	mov    %rax,%r8
+  802988:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80298d:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802994:	00 00 00 
+  802997:	be 27 00 00 00       	mov    $0x27,%esi
+  80299c:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  8029a3:	00 00 00 
+  8029a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ab:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  8029b2:	00 00 00 
+  8029b5:	41 ff d1             	call   *%r9
+
+00000000008029b8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8029b8:	55                   	push   %rbp
+  8029b9:	48 89 e5             	mov    %rsp,%rbp
+  8029bc:	53                   	push   %rbx
+  8029bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8029c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029c7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029e9:	48 85 c0             	test   %rax,%rax
+  8029ec:	7f 06                	jg     8029f4 <sys_env_set_trapframe+0x3c>
+}
+  8029ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029f2:	c9                   	leave
+  8029f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029f4:	49 89 c0             	mov    %rax,%r8
+  8029f7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8029fc:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802a03:	00 00 00 
+  802a06:	be 27 00 00 00       	mov    $0x27,%esi
+  802a0b:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802a12:	00 00 00 
+  802a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1a:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802a21:	00 00 00 
+  802a24:	41 ff d1             	call   *%r9
+
+0000000000802a27 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802a27:	55                   	push   %rbp
+  802a28:	48 89 e5             	mov    %rsp,%rbp
+  802a2b:	53                   	push   %rbx
+  802a2c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a30:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a33:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a36:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a45:	be 00 00 00 00       	mov    $0x0,%esi
+  802a4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a56:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a58:	48 85 c0             	test   %rax,%rax
+  802a5b:	7f 06                	jg     802a63 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802a5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a63:	49 89 c0             	mov    %rax,%r8
+  802a66:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802a6b:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802a72:	00 00 00 
+  802a75:	be 27 00 00 00       	mov    $0x27,%esi
+  802a7a:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802a81:	00 00 00 
+  802a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a89:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802a90:	00 00 00 
+  802a93:	41 ff d1             	call   *%r9
+
+0000000000802a96 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+  802a9a:	53                   	push   %rbx
+  802a9b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802a9f:	40 0f b6 ce          	movzbl %sil,%ecx
+  802aa3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aa6:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ab0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ab5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ac0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ac6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ac8:	48 85 c0             	test   %rax,%rax
+  802acb:	7f 06                	jg     802ad3 <sys_env_set_reclaim+0x3d>
+}
+  802acd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ad1:	c9                   	leave
+  802ad2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ad3:	49 89 c0             	mov    %rax,%r8
+  802ad6:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802adb:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802ae2:	00 00 00 
+  802ae5:	be 27 00 00 00       	mov    $0x27,%esi
+  802aea:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802af1:	00 00 00 
+  802af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af9:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802b00:	00 00 00 
+  802b03:	41 ff d1             	call   *%r9
+
+0000000000802b06 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	53                   	push   %rbx
+  802b0b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802b0f:	48 63 ce             	movslq %esi,%rcx
+  802b12:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b15:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b1f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b24:	be 00 00 00 00       	mov    $0x0,%esi
+  802b29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b2f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b35:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b37:	48 85 c0             	test   %rax,%rax
+  802b3a:	7f 06                	jg     802b42 <sys_env_set_nice+0x3c>
+}
+  802b3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b40:	c9                   	leave
+  802b41:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b42:	49 89 c0             	mov    %rax,%r8
+  802b45:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802b4a:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802b51:	00 00 00 
+  802b54:	be 27 00 00 00       	mov    $0x27,%esi
+  802b59:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802b60:	00 00 00 
+  802b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b68:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802b6f:	00 00 00 
+  802b72:	41 ff d1             	call   *%r9
+
+0000000000802b75 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802b75:	55                   	push   %rbp
+  802b76:	48 89 e5             	mov    %rsp,%rbp
+  802b79:	53                   	push   %rbx
+  802b7a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b7d:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b82:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b91:	be 00 00 00 00       	mov    $0x0,%esi
+  802b96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b9c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ba2:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ba4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ba8:	c9                   	leave
+  802ba9:	c3                   	ret
+
+0000000000802baa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802baa:	55                   	push   %rbp
+  802bab:	48 89 e5             	mov    %rsp,%rbp
+  802bae:	53                   	push   %rbx
+  802baf:	89 f8                	mov    %edi,%eax
+  802bb1:	49 89 f1             	mov    %rsi,%r9
+  802bb4:	48 89 d3             	mov    %rdx,%rbx
+  802bb7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bba:	49 63 f0             	movslq %r8d,%rsi
+  802bbd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc0:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bc5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bd4:	cd 30                	int    $0x30
+}
+  802bd6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+
+0000000000802bdc <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+  802be0:	53                   	push   %rbx
+  802be1:	89 f8                	mov    %edi,%eax
+  802be3:	49 89 f1             	mov    %rsi,%r9
+  802be6:	48 89 d3             	mov    %rdx,%rbx
+  802be9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bec:	49 63 f0             	movslq %r8d,%rsi
+  802bef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bf2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bf7:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bfa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c00:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c06:	cd 30                	int    $0x30
+}
+  802c08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c0c:	c9                   	leave
+  802c0d:	c3                   	ret
+
+0000000000802c0e <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c0e:	55                   	push   %rbp
+  802c0f:	48 89 e5             	mov    %rsp,%rbp
+  802c12:	53                   	push   %rbx
+  802c13:	48 83 ec 08          	sub    $0x8,%rsp
+  802c17:	89 f8                	mov    %edi,%eax
+  802c19:	49 89 f2             	mov    %rsi,%r10
+  802c1c:	48 89 d3             	mov    %rdx,%rbx
+  802c1f:	48 89 cf             	mov    %rcx,%rdi
+  802c22:	44 89 c6             	mov    %r8d,%esi
+  802c25:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c28:	48 63 f6             	movslq %esi,%rsi
+  802c2b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c2e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c33:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c36:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c3a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c3c:	48 85 c0             	test   %rax,%rax
+  802c3f:	7f 06                	jg     802c47 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c47:	49 89 c0             	mov    %rax,%r8
+  802c4a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802c4f:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802c56:	00 00 00 
+  802c59:	be 27 00 00 00       	mov    $0x27,%esi
+  802c5e:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802c65:	00 00 00 
+  802c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6d:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802c74:	00 00 00 
+  802c77:	41 ff d1             	call   *%r9
+
+0000000000802c7a <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802c7a:	55                   	push   %rbp
+  802c7b:	48 89 e5             	mov    %rsp,%rbp
+  802c7e:	53                   	push   %rbx
+  802c7f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c83:	48 89 f1             	mov    %rsi,%rcx
+  802c86:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802c89:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802c8d:	48 8b 1a             	mov    (%rdx),%rbx
+  802c90:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c93:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c98:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c9c:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802ca0:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802ca4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ca6:	48 85 c0             	test   %rax,%rax
+  802ca9:	7f 06                	jg     802cb1 <sys_ipc_call_short+0x37>
+}
+  802cab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802caf:	c9                   	leave
+  802cb0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cb1:	49 89 c0             	mov    %rax,%r8
+  802cb4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802cb9:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802cc0:	00 00 00 
+  802cc3:	be 27 00 00 00       	mov    $0x27,%esi
+  802cc8:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802ccf:	00 00 00 
+  802cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd7:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802cde:	00 00 00 
+  802ce1:	41 ff d1             	call   *%r9
+
+0000000000802ce4 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802ce4:	55                   	push   %rbp
+  802ce5:	48 89 e5             	mov    %rsp,%rbp
+  802ce8:	53                   	push   %rbx
+  802ce9:	48 83 ec 08          	sub    $0x8,%rsp
+  802ced:	89 f8                	mov    %edi,%eax
+  802cef:	49 89 f2             	mov    %rsi,%r10
+  802cf2:	48 89 d3             	mov    %rdx,%rbx
+  802cf5:	48 89 cf             	mov    %rcx,%rdi
+  802cf8:	44 89 c6             	mov    %r8d,%esi
+  802cfb:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802cfe:	48 63 f6             	movslq %esi,%rsi
+  802d01:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d04:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d09:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d0c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d10:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d12:	48 85 c0             	test   %rax,%rax
+  802d15:	7f 06                	jg     802d1d <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d1b:	c9                   	leave
+  802d1c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d1d:	49 89 c0             	mov    %rax,%r8
+  802d20:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802d25:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802d2c:	00 00 00 
+  802d2f:	be 27 00 00 00       	mov    $0x27,%esi
+  802d34:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802d3b:	00 00 00 
+  802d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d43:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802d4a:	00 00 00 
+  802d4d:	41 ff d1             	call   *%r9
+
+0000000000802d50 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802d50:	55                   	push   %rbp
+  802d51:	48 89 e5             	mov    %rsp,%rbp
+  802d54:	53                   	push   %rbx
+  802d55:	48 83 ec 08          	sub    $0x8,%rsp
+  802d59:	48 89 fa             	mov    %rdi,%rdx
+  802d5c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d5f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d6e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d7f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d81:	48 85 c0             	test   %rax,%rax
+  802d84:	7f 06                	jg     802d8c <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d8a:	c9                   	leave
+  802d8b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d8c:	49 89 c0             	mov    %rax,%r8
+  802d8f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802d94:	48 ba 08 62 80 00 00 	movabs $0x806208,%rdx
+  802d9b:	00 00 00 
+  802d9e:	be 27 00 00 00       	mov    $0x27,%esi
+  802da3:	48 bf 27 62 80 00 00 	movabs $0x806227,%rdi
+  802daa:	00 00 00 
+  802dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db2:	49 b9 56 51 80 00 00 	movabs $0x805156,%r9
+  802db9:	00 00 00 
+  802dbc:	41 ff d1             	call   *%r9
+
+0000000000802dbf <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802dbf:	55                   	push   %rbp
+  802dc0:	48 89 e5             	mov    %rsp,%rbp
+  802dc3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802dc4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dd8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ddd:	be 00 00 00 00       	mov    $0x0,%esi
+  802de2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802de8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dee:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802df0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802df4:	c9                   	leave
+  802df5:	c3                   	ret
+
+0000000000802df6 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802df6:	55                   	push   %rbp
+  802df7:	48 89 e5             	mov    %rsp,%rbp
+  802dfa:	53                   	push   %rbx
+  802dfb:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dfe:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e03:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e0d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e12:	be 00 00 00 00       	mov    $0x0,%esi
+  802e17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e1d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e23:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802e25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e29:	c9                   	leave
+  802e2a:	c3                   	ret
+
+0000000000802e2b <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802e2b:	55                   	push   %rbp
+  802e2c:	48 89 e5             	mov    %rsp,%rbp
+  802e2f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e30:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e35:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e44:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e49:	be 00 00 00 00       	mov    $0x0,%esi
+  802e4e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e54:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e5a:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e60:	c9                   	leave
+  802e61:	c3                   	ret
+
+0000000000802e62 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e62:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802e69:	ff ff ff 
+  802e6c:	48 01 f8             	add    %rdi,%rax
+  802e6f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802e73:	c3                   	ret
+
+0000000000802e74 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e74:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802e7b:	ff ff ff 
+  802e7e:	48 01 f8             	add    %rdi,%rax
+  802e81:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802e85:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802e8b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802e8f:	c3                   	ret
+
+0000000000802e90 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	41 57                	push   %r15
+  802e96:	41 56                	push   %r14
+  802e98:	41 55                	push   %r13
+  802e9a:	41 54                	push   %r12
+  802e9c:	53                   	push   %rbx
+  802e9d:	48 83 ec 08          	sub    $0x8,%rsp
+  802ea1:	49 89 ff             	mov    %rdi,%r15
+  802ea4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802ea9:	49 bd 90 43 80 00 00 	movabs $0x804390,%r13
+  802eb0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802eb3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802eb9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802ebc:	48 89 df             	mov    %rbx,%rdi
+  802ebf:	41 ff d5             	call   *%r13
+  802ec2:	83 e0 04             	and    $0x4,%eax
+  802ec5:	74 17                	je     802ede <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802ec7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ece:	4c 39 f3             	cmp    %r14,%rbx
+  802ed1:	75 e6                	jne    802eb9 <fd_alloc+0x29>
+  802ed3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802ed9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802ede:	4d 89 27             	mov    %r12,(%r15)
+}
+  802ee1:	48 83 c4 08          	add    $0x8,%rsp
+  802ee5:	5b                   	pop    %rbx
+  802ee6:	41 5c                	pop    %r12
+  802ee8:	41 5d                	pop    %r13
+  802eea:	41 5e                	pop    %r14
+  802eec:	41 5f                	pop    %r15
+  802eee:	5d                   	pop    %rbp
+  802eef:	c3                   	ret
+
+0000000000802ef0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802ef0:	83 ff 1f             	cmp    $0x1f,%edi
+  802ef3:	77 39                	ja     802f2e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802ef5:	55                   	push   %rbp
+  802ef6:	48 89 e5             	mov    %rsp,%rbp
+  802ef9:	41 54                	push   %r12
+  802efb:	53                   	push   %rbx
+  802efc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802eff:	48 63 df             	movslq %edi,%rbx
+  802f02:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802f09:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802f0d:	48 89 df             	mov    %rbx,%rdi
+  802f10:	48 b8 90 43 80 00 00 	movabs $0x804390,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+  802f1c:	a8 04                	test   $0x4,%al
+  802f1e:	74 14                	je     802f34 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802f20:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802f24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f29:	5b                   	pop    %rbx
+  802f2a:	41 5c                	pop    %r12
+  802f2c:	5d                   	pop    %rbp
+  802f2d:	c3                   	ret
+        return -E_INVAL;
+  802f2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802f33:	c3                   	ret
+        return -E_INVAL;
+  802f34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f39:	eb ee                	jmp    802f29 <fd_lookup+0x39>
+
+0000000000802f3b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802f3b:	55                   	push   %rbp
+  802f3c:	48 89 e5             	mov    %rsp,%rbp
+  802f3f:	41 54                	push   %r12
+  802f41:	53                   	push   %rbx
+  802f42:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802f45:	48 b8 c0 62 80 00 00 	movabs $0x8062c0,%rax
+  802f4c:	00 00 00 
+  802f4f:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802f56:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802f59:	39 3b                	cmp    %edi,(%rbx)
+  802f5b:	74 47                	je     802fa4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802f5d:	48 83 c0 08          	add    $0x8,%rax
+  802f61:	48 8b 18             	mov    (%rax),%rbx
+  802f64:	48 85 db             	test   %rbx,%rbx
+  802f67:	75 f0                	jne    802f59 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802f69:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802f70:	00 00 00 
+  802f73:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802f79:	89 fa                	mov    %edi,%edx
+  802f7b:	48 bf 38 62 80 00 00 	movabs $0x806238,%rdi
+  802f82:	00 00 00 
+  802f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8a:	48 b9 68 17 80 00 00 	movabs $0x801768,%rcx
+  802f91:	00 00 00 
+  802f94:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802f96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802f9b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802f9f:	5b                   	pop    %rbx
+  802fa0:	41 5c                	pop    %r12
+  802fa2:	5d                   	pop    %rbp
+  802fa3:	c3                   	ret
+            return 0;
+  802fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa9:	eb f0                	jmp    802f9b <dev_lookup+0x60>
+
+0000000000802fab <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802fab:	55                   	push   %rbp
+  802fac:	48 89 e5             	mov    %rsp,%rbp
+  802faf:	41 55                	push   %r13
+  802fb1:	41 54                	push   %r12
+  802fb3:	53                   	push   %rbx
+  802fb4:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb8:	48 89 fb             	mov    %rdi,%rbx
+  802fbb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fbe:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802fc5:	ff ff ff 
+  802fc8:	48 01 df             	add    %rbx,%rdi
+  802fcb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802fcf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802fd3:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  802fda:	00 00 00 
+  802fdd:	ff d0                	call   *%rax
+  802fdf:	41 89 c5             	mov    %eax,%r13d
+  802fe2:	85 c0                	test   %eax,%eax
+  802fe4:	78 06                	js     802fec <fd_close+0x41>
+  802fe6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802fea:	74 1a                	je     803006 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802fec:	45 84 e4             	test   %r12b,%r12b
+  802fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802ff8:	44 89 e8             	mov    %r13d,%eax
+  802ffb:	48 83 c4 18          	add    $0x18,%rsp
+  802fff:	5b                   	pop    %rbx
+  803000:	41 5c                	pop    %r12
+  803002:	41 5d                	pop    %r13
+  803004:	5d                   	pop    %rbp
+  803005:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803006:	8b 3b                	mov    (%rbx),%edi
+  803008:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80300c:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+  803018:	41 89 c5             	mov    %eax,%r13d
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	78 1b                	js     80303a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80301f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803023:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803027:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80302d:	48 85 c0             	test   %rax,%rax
+  803030:	74 08                	je     80303a <fd_close+0x8f>
+  803032:	48 89 df             	mov    %rbx,%rdi
+  803035:	ff d0                	call   *%rax
+  803037:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80303a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80303f:	48 89 de             	mov    %rbx,%rsi
+  803042:	bf 00 00 00 00       	mov    $0x0,%edi
+  803047:	48 b8 dc 28 80 00 00 	movabs $0x8028dc,%rax
+  80304e:	00 00 00 
+  803051:	ff d0                	call   *%rax
+    return res;
+  803053:	eb a3                	jmp    802ff8 <fd_close+0x4d>
+
+0000000000803055 <close>:
+
+int
+close(int fdnum) {
+  803055:	55                   	push   %rbp
+  803056:	48 89 e5             	mov    %rsp,%rbp
+  803059:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80305d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803061:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  803068:	00 00 00 
+  80306b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80306d:	85 c0                	test   %eax,%eax
+  80306f:	78 15                	js     803086 <close+0x31>
+
+    return fd_close(fd, 1);
+  803071:	be 01 00 00 00       	mov    $0x1,%esi
+  803076:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80307a:	48 b8 ab 2f 80 00 00 	movabs $0x802fab,%rax
+  803081:	00 00 00 
+  803084:	ff d0                	call   *%rax
+}
+  803086:	c9                   	leave
+  803087:	c3                   	ret
+
+0000000000803088 <close_all>:
+
+void
+close_all(void) {
+  803088:	55                   	push   %rbp
+  803089:	48 89 e5             	mov    %rsp,%rbp
+  80308c:	41 54                	push   %r12
+  80308e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80308f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803094:	49 bc 55 30 80 00 00 	movabs $0x803055,%r12
+  80309b:	00 00 00 
+  80309e:	89 df                	mov    %ebx,%edi
+  8030a0:	41 ff d4             	call   *%r12
+  8030a3:	83 c3 01             	add    $0x1,%ebx
+  8030a6:	83 fb 20             	cmp    $0x20,%ebx
+  8030a9:	75 f3                	jne    80309e <close_all+0x16>
+}
+  8030ab:	5b                   	pop    %rbx
+  8030ac:	41 5c                	pop    %r12
+  8030ae:	5d                   	pop    %rbp
+  8030af:	c3                   	ret
+
+00000000008030b0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8030b0:	55                   	push   %rbp
+  8030b1:	48 89 e5             	mov    %rsp,%rbp
+  8030b4:	41 57                	push   %r15
+  8030b6:	41 56                	push   %r14
+  8030b8:	41 55                	push   %r13
+  8030ba:	41 54                	push   %r12
+  8030bc:	53                   	push   %rbx
+  8030bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8030c1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8030c4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8030c8:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  8030cf:	00 00 00 
+  8030d2:	ff d0                	call   *%rax
+  8030d4:	89 c3                	mov    %eax,%ebx
+  8030d6:	85 c0                	test   %eax,%eax
+  8030d8:	0f 88 b8 00 00 00    	js     803196 <dup+0xe6>
+    close(newfdnum);
+  8030de:	44 89 e7             	mov    %r12d,%edi
+  8030e1:	48 b8 55 30 80 00 00 	movabs $0x803055,%rax
+  8030e8:	00 00 00 
+  8030eb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8030ed:	4d 63 ec             	movslq %r12d,%r13
+  8030f0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8030f7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8030fb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8030ff:	4c 89 ff             	mov    %r15,%rdi
+  803102:	49 be 74 2e 80 00 00 	movabs $0x802e74,%r14
+  803109:	00 00 00 
+  80310c:	41 ff d6             	call   *%r14
+  80310f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803112:	4c 89 ef             	mov    %r13,%rdi
+  803115:	41 ff d6             	call   *%r14
+  803118:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80311b:	48 89 df             	mov    %rbx,%rdi
+  80311e:	48 b8 90 43 80 00 00 	movabs $0x804390,%rax
+  803125:	00 00 00 
+  803128:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80312a:	a8 04                	test   $0x4,%al
+  80312c:	74 2b                	je     803159 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80312e:	41 89 c1             	mov    %eax,%r9d
+  803131:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803137:	4c 89 f1             	mov    %r14,%rcx
+  80313a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313f:	48 89 de             	mov    %rbx,%rsi
+  803142:	bf 00 00 00 00       	mov    $0x0,%edi
+  803147:	48 b8 71 28 80 00 00 	movabs $0x802871,%rax
+  80314e:	00 00 00 
+  803151:	ff d0                	call   *%rax
+  803153:	89 c3                	mov    %eax,%ebx
+  803155:	85 c0                	test   %eax,%eax
+  803157:	78 4e                	js     8031a7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803159:	4c 89 ff             	mov    %r15,%rdi
+  80315c:	48 b8 90 43 80 00 00 	movabs $0x804390,%rax
+  803163:	00 00 00 
+  803166:	ff d0                	call   *%rax
+  803168:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80316b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803171:	4c 89 e9             	mov    %r13,%rcx
+  803174:	ba 00 00 00 00       	mov    $0x0,%edx
+  803179:	4c 89 fe             	mov    %r15,%rsi
+  80317c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803181:	48 b8 71 28 80 00 00 	movabs $0x802871,%rax
+  803188:	00 00 00 
+  80318b:	ff d0                	call   *%rax
+  80318d:	89 c3                	mov    %eax,%ebx
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	78 14                	js     8031a7 <dup+0xf7>
+
+    return newfdnum;
+  803193:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803196:	89 d8                	mov    %ebx,%eax
+  803198:	48 83 c4 18          	add    $0x18,%rsp
+  80319c:	5b                   	pop    %rbx
+  80319d:	41 5c                	pop    %r12
+  80319f:	41 5d                	pop    %r13
+  8031a1:	41 5e                	pop    %r14
+  8031a3:	41 5f                	pop    %r15
+  8031a5:	5d                   	pop    %rbp
+  8031a6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8031a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ac:	4c 89 ee             	mov    %r13,%rsi
+  8031af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031b4:	49 bc dc 28 80 00 00 	movabs $0x8028dc,%r12
+  8031bb:	00 00 00 
+  8031be:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8031c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c6:	4c 89 f6             	mov    %r14,%rsi
+  8031c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ce:	41 ff d4             	call   *%r12
+    return res;
+  8031d1:	eb c3                	jmp    803196 <dup+0xe6>
+
+00000000008031d3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8031d3:	55                   	push   %rbp
+  8031d4:	48 89 e5             	mov    %rsp,%rbp
+  8031d7:	41 56                	push   %r14
+  8031d9:	41 55                	push   %r13
+  8031db:	41 54                	push   %r12
+  8031dd:	53                   	push   %rbx
+  8031de:	48 83 ec 10          	sub    $0x10,%rsp
+  8031e2:	89 fb                	mov    %edi,%ebx
+  8031e4:	49 89 f4             	mov    %rsi,%r12
+  8031e7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031ee:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  8031f5:	00 00 00 
+  8031f8:	ff d0                	call   *%rax
+  8031fa:	85 c0                	test   %eax,%eax
+  8031fc:	78 4c                	js     80324a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8031fe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803202:	41 8b 3e             	mov    (%r14),%edi
+  803205:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803209:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  803210:	00 00 00 
+  803213:	ff d0                	call   *%rax
+  803215:	85 c0                	test   %eax,%eax
+  803217:	78 35                	js     80324e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803219:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80321d:	83 e0 03             	and    $0x3,%eax
+  803220:	83 f8 01             	cmp    $0x1,%eax
+  803223:	74 2d                	je     803252 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803225:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803229:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80322d:	48 85 c0             	test   %rax,%rax
+  803230:	74 56                	je     803288 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803232:	4c 89 ea             	mov    %r13,%rdx
+  803235:	4c 89 e6             	mov    %r12,%rsi
+  803238:	4c 89 f7             	mov    %r14,%rdi
+  80323b:	ff d0                	call   *%rax
+}
+  80323d:	48 83 c4 10          	add    $0x10,%rsp
+  803241:	5b                   	pop    %rbx
+  803242:	41 5c                	pop    %r12
+  803244:	41 5d                	pop    %r13
+  803246:	41 5e                	pop    %r14
+  803248:	5d                   	pop    %rbp
+  803249:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80324a:	48 98                	cltq
+  80324c:	eb ef                	jmp    80323d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80324e:	48 98                	cltq
+  803250:	eb eb                	jmp    80323d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803252:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803259:	00 00 00 
+  80325c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803262:	89 da                	mov    %ebx,%edx
+  803264:	48 bf 79 62 80 00 00 	movabs $0x806279,%rdi
+  80326b:	00 00 00 
+  80326e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803273:	48 b9 68 17 80 00 00 	movabs $0x801768,%rcx
+  80327a:	00 00 00 
+  80327d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80327f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803286:	eb b5                	jmp    80323d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803288:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80328f:	eb ac                	jmp    80323d <read+0x6a>
+
+0000000000803291 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803291:	55                   	push   %rbp
+  803292:	48 89 e5             	mov    %rsp,%rbp
+  803295:	41 57                	push   %r15
+  803297:	41 56                	push   %r14
+  803299:	41 55                	push   %r13
+  80329b:	41 54                	push   %r12
+  80329d:	53                   	push   %rbx
+  80329e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8032a2:	48 85 d2             	test   %rdx,%rdx
+  8032a5:	74 54                	je     8032fb <readn+0x6a>
+  8032a7:	41 89 fd             	mov    %edi,%r13d
+  8032aa:	49 89 f6             	mov    %rsi,%r14
+  8032ad:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8032b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8032b5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8032ba:	49 bf d3 31 80 00 00 	movabs $0x8031d3,%r15
+  8032c1:	00 00 00 
+  8032c4:	4c 89 e2             	mov    %r12,%rdx
+  8032c7:	48 29 f2             	sub    %rsi,%rdx
+  8032ca:	4c 01 f6             	add    %r14,%rsi
+  8032cd:	44 89 ef             	mov    %r13d,%edi
+  8032d0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	78 20                	js     8032f7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8032d7:	01 c3                	add    %eax,%ebx
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	74 08                	je     8032e5 <readn+0x54>
+  8032dd:	48 63 f3             	movslq %ebx,%rsi
+  8032e0:	4c 39 e6             	cmp    %r12,%rsi
+  8032e3:	72 df                	jb     8032c4 <readn+0x33>
+    }
+    return res;
+  8032e5:	48 63 c3             	movslq %ebx,%rax
+}
+  8032e8:	48 83 c4 08          	add    $0x8,%rsp
+  8032ec:	5b                   	pop    %rbx
+  8032ed:	41 5c                	pop    %r12
+  8032ef:	41 5d                	pop    %r13
+  8032f1:	41 5e                	pop    %r14
+  8032f3:	41 5f                	pop    %r15
+  8032f5:	5d                   	pop    %rbp
+  8032f6:	c3                   	ret
+        if (inc < 0) return inc;
+  8032f7:	48 98                	cltq
+  8032f9:	eb ed                	jmp    8032e8 <readn+0x57>
+    int inc = 1, res = 0;
+  8032fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803300:	eb e3                	jmp    8032e5 <readn+0x54>
+
+0000000000803302 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803302:	55                   	push   %rbp
+  803303:	48 89 e5             	mov    %rsp,%rbp
+  803306:	41 56                	push   %r14
+  803308:	41 55                	push   %r13
+  80330a:	41 54                	push   %r12
+  80330c:	53                   	push   %rbx
+  80330d:	48 83 ec 10          	sub    $0x10,%rsp
+  803311:	89 fb                	mov    %edi,%ebx
+  803313:	49 89 f4             	mov    %rsi,%r12
+  803316:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803319:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80331d:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  803324:	00 00 00 
+  803327:	ff d0                	call   *%rax
+  803329:	85 c0                	test   %eax,%eax
+  80332b:	78 47                	js     803374 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80332d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803331:	41 8b 3e             	mov    (%r14),%edi
+  803334:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803338:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  80333f:	00 00 00 
+  803342:	ff d0                	call   *%rax
+  803344:	85 c0                	test   %eax,%eax
+  803346:	78 30                	js     803378 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803348:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80334d:	74 2d                	je     80337c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80334f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803353:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803357:	48 85 c0             	test   %rax,%rax
+  80335a:	74 56                	je     8033b2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80335c:	4c 89 ea             	mov    %r13,%rdx
+  80335f:	4c 89 e6             	mov    %r12,%rsi
+  803362:	4c 89 f7             	mov    %r14,%rdi
+  803365:	ff d0                	call   *%rax
+}
+  803367:	48 83 c4 10          	add    $0x10,%rsp
+  80336b:	5b                   	pop    %rbx
+  80336c:	41 5c                	pop    %r12
+  80336e:	41 5d                	pop    %r13
+  803370:	41 5e                	pop    %r14
+  803372:	5d                   	pop    %rbp
+  803373:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803374:	48 98                	cltq
+  803376:	eb ef                	jmp    803367 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803378:	48 98                	cltq
+  80337a:	eb eb                	jmp    803367 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80337c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803383:	00 00 00 
+  803386:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80338c:	89 da                	mov    %ebx,%edx
+  80338e:	48 bf 95 62 80 00 00 	movabs $0x806295,%rdi
+  803395:	00 00 00 
+  803398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339d:	48 b9 68 17 80 00 00 	movabs $0x801768,%rcx
+  8033a4:	00 00 00 
+  8033a7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033a9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033b0:	eb b5                	jmp    803367 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8033b2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033b9:	eb ac                	jmp    803367 <write+0x65>
+
+00000000008033bb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8033bb:	55                   	push   %rbp
+  8033bc:	48 89 e5             	mov    %rsp,%rbp
+  8033bf:	53                   	push   %rbx
+  8033c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8033c4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033ca:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  8033d1:	00 00 00 
+  8033d4:	ff d0                	call   *%rax
+  8033d6:	85 c0                	test   %eax,%eax
+  8033d8:	78 0c                	js     8033e6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8033da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033de:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8033e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ea:	c9                   	leave
+  8033eb:	c3                   	ret
+
+00000000008033ec <tell>:
+
+int tell(int fdnum) {
+  8033ec:	55                   	push   %rbp
+  8033ed:	48 89 e5             	mov    %rsp,%rbp
+  8033f0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033f8:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  8033ff:	00 00 00 
+  803402:	ff d0                	call   *%rax
+  803404:	85 c0                	test   %eax,%eax
+  803406:	78 07                	js     80340f <tell+0x23>
+
+    return fd->fd_offset;
+  803408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80340c:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80340f:	c9                   	leave
+  803410:	c3                   	ret
+
+0000000000803411 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803411:	55                   	push   %rbp
+  803412:	48 89 e5             	mov    %rsp,%rbp
+  803415:	41 55                	push   %r13
+  803417:	41 54                	push   %r12
+  803419:	53                   	push   %rbx
+  80341a:	48 83 ec 18          	sub    $0x18,%rsp
+  80341e:	89 fb                	mov    %edi,%ebx
+  803420:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803423:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803427:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  80342e:	00 00 00 
+  803431:	ff d0                	call   *%rax
+  803433:	85 c0                	test   %eax,%eax
+  803435:	78 38                	js     80346f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803437:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80343b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80343f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803443:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  80344a:	00 00 00 
+  80344d:	ff d0                	call   *%rax
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	78 1c                	js     80346f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803453:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803458:	74 20                	je     80347a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80345a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80345e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803462:	48 85 c0             	test   %rax,%rax
+  803465:	74 47                	je     8034ae <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803467:	44 89 e6             	mov    %r12d,%esi
+  80346a:	4c 89 ef             	mov    %r13,%rdi
+  80346d:	ff d0                	call   *%rax
+}
+  80346f:	48 83 c4 18          	add    $0x18,%rsp
+  803473:	5b                   	pop    %rbx
+  803474:	41 5c                	pop    %r12
+  803476:	41 5d                	pop    %r13
+  803478:	5d                   	pop    %rbp
+  803479:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80347a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803481:	00 00 00 
+  803484:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80348a:	89 da                	mov    %ebx,%edx
+  80348c:	48 bf 58 62 80 00 00 	movabs $0x806258,%rdi
+  803493:	00 00 00 
+  803496:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349b:	48 b9 68 17 80 00 00 	movabs $0x801768,%rcx
+  8034a2:	00 00 00 
+  8034a5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8034a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034ac:	eb c1                	jmp    80346f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8034ae:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8034b3:	eb ba                	jmp    80346f <ftruncate+0x5e>
+
+00000000008034b5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8034b5:	55                   	push   %rbp
+  8034b6:	48 89 e5             	mov    %rsp,%rbp
+  8034b9:	41 54                	push   %r12
+  8034bb:	53                   	push   %rbx
+  8034bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8034c0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034c3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8034c7:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  8034ce:	00 00 00 
+  8034d1:	ff d0                	call   *%rax
+  8034d3:	85 c0                	test   %eax,%eax
+  8034d5:	78 63                	js     80353a <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034d7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8034db:	41 8b 3c 24          	mov    (%r12),%edi
+  8034df:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8034e3:	48 b8 3b 2f 80 00 00 	movabs $0x802f3b,%rax
+  8034ea:	00 00 00 
+  8034ed:	ff d0                	call   *%rax
+  8034ef:	85 c0                	test   %eax,%eax
+  8034f1:	78 47                	js     80353a <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8034f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034f7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8034fc:	74 45                	je     803543 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8034fe:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803501:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803508:	00 00 00 
+    stat->st_isdir = 0;
+  80350b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803512:	00 00 00 
+    stat->st_ino = 0;
+  803515:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80351c:	00 00 00 00 
+    stat->st_version = 0;
+  803520:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803527:	00 00 00 
+    stat->st_dev = dev;
+  80352a:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803531:	48 89 de             	mov    %rbx,%rsi
+  803534:	4c 89 e7             	mov    %r12,%rdi
+  803537:	ff 50 28             	call   *0x28(%rax)
+}
+  80353a:	48 83 c4 10          	add    $0x10,%rsp
+  80353e:	5b                   	pop    %rbx
+  80353f:	41 5c                	pop    %r12
+  803541:	5d                   	pop    %rbp
+  803542:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803543:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803548:	eb f0                	jmp    80353a <fstat+0x85>
+
+000000000080354a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80354a:	55                   	push   %rbp
+  80354b:	48 89 e5             	mov    %rsp,%rbp
+  80354e:	41 54                	push   %r12
+  803550:	53                   	push   %rbx
+  803551:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803554:	be 00 00 00 00       	mov    $0x0,%esi
+  803559:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  803560:	00 00 00 
+  803563:	ff d0                	call   *%rax
+  803565:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803567:	85 c0                	test   %eax,%eax
+  803569:	78 25                	js     803590 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80356b:	4c 89 e6             	mov    %r12,%rsi
+  80356e:	89 c7                	mov    %eax,%edi
+  803570:	48 b8 b5 34 80 00 00 	movabs $0x8034b5,%rax
+  803577:	00 00 00 
+  80357a:	ff d0                	call   *%rax
+  80357c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80357f:	89 df                	mov    %ebx,%edi
+  803581:	48 b8 55 30 80 00 00 	movabs $0x803055,%rax
+  803588:	00 00 00 
+  80358b:	ff d0                	call   *%rax
+
+    return res;
+  80358d:	44 89 e3             	mov    %r12d,%ebx
+}
+  803590:	89 d8                	mov    %ebx,%eax
+  803592:	5b                   	pop    %rbx
+  803593:	41 5c                	pop    %r12
+  803595:	5d                   	pop    %rbp
+  803596:	c3                   	ret
+
+0000000000803597 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803597:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80359e:	00 00 00 
+  8035a1:	83 38 00             	cmpl   $0x0,(%rax)
+  8035a4:	74 0a                	je     8035b0 <fsipc_env+0x19>
+    return fsenv;
+}
+  8035a6:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8035ad:	00 00 
+  8035af:	c3                   	ret
+fsipc_env(void) {
+  8035b0:	55                   	push   %rbp
+  8035b1:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035b4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8035b9:	48 b8 3d 57 80 00 00 	movabs $0x80573d,%rax
+  8035c0:	00 00 00 
+  8035c3:	ff d0                	call   *%rax
+  8035c5:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8035cc:	00 00 
+}
+  8035ce:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8035d5:	00 00 
+  8035d7:	5d                   	pop    %rbp
+  8035d8:	c3                   	ret
+
+00000000008035d9 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8035d9:	55                   	push   %rbp
+  8035da:	48 89 e5             	mov    %rsp,%rbp
+  8035dd:	53                   	push   %rbx
+  8035de:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8035e2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8035e9:	00 
+  8035ea:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8035f1:	00 
+  8035f2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8035f9:	00 
+  8035fa:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803601:	00 
+  803602:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803609:	00 
+
+    assert(size <= sizeof(words));
+  80360a:	48 83 fa 28          	cmp    $0x28,%rdx
+  80360e:	77 38                	ja     803648 <fsipc_short+0x6f>
+  803610:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803612:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803616:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  80361d:	00 00 00 
+  803620:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803622:	48 b8 97 35 80 00 00 	movabs $0x803597,%rax
+  803629:	00 00 00 
+  80362c:	ff d0                	call   *%rax
+  80362e:	89 c7                	mov    %eax,%edi
+  803630:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803634:	89 de                	mov    %ebx,%esi
+  803636:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  80363d:	00 00 00 
+  803640:	ff d0                	call   *%rax
+}
+  803642:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803646:	c9                   	leave
+  803647:	c3                   	ret
+    assert(size <= sizeof(words));
+  803648:	48 b9 e0 62 80 00 00 	movabs $0x8062e0,%rcx
+  80364f:	00 00 00 
+  803652:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  803659:	00 00 00 
+  80365c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803661:	48 bf 0b 63 80 00 00 	movabs $0x80630b,%rdi
+  803668:	00 00 00 
+  80366b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803670:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  803677:	00 00 00 
+  80367a:	41 ff d0             	call   *%r8
+
+000000000080367d <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80367d:	55                   	push   %rbp
+  80367e:	48 89 e5             	mov    %rsp,%rbp
+  803681:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803685:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803688:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80368b:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  80368e:	ba 08 00 00 00       	mov    $0x8,%edx
+  803693:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803697:	bf 02 00 00 00       	mov    $0x2,%edi
+  80369c:	48 b8 d9 35 80 00 00 	movabs $0x8035d9,%rax
+  8036a3:	00 00 00 
+  8036a6:	ff d0                	call   *%rax
+}
+  8036a8:	c9                   	leave
+  8036a9:	c3                   	ret
+
+00000000008036aa <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8036aa:	55                   	push   %rbp
+  8036ab:	48 89 e5             	mov    %rsp,%rbp
+  8036ae:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8036b2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8036b5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8036b8:	ba 04 00 00 00       	mov    $0x4,%edx
+  8036bd:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8036c1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8036c6:	48 b8 d9 35 80 00 00 	movabs $0x8035d9,%rax
+  8036cd:	00 00 00 
+  8036d0:	ff d0                	call   *%rax
+}
+  8036d2:	c9                   	leave
+  8036d3:	c3                   	ret
+
+00000000008036d4 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8036d4:	55                   	push   %rbp
+  8036d5:	48 89 e5             	mov    %rsp,%rbp
+  8036d8:	41 54                	push   %r12
+  8036da:	53                   	push   %rbx
+  8036db:	48 83 ec 10          	sub    $0x10,%rsp
+  8036df:	89 fb                	mov    %edi,%ebx
+  8036e1:	49 89 f4             	mov    %rsi,%r12
+  8036e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8036e8:	48 b8 97 35 80 00 00 	movabs $0x803597,%rax
+  8036ef:	00 00 00 
+  8036f2:	ff d0                	call   *%rax
+  8036f4:	89 c7                	mov    %eax,%edi
+  8036f6:	6a 00                	push   $0x0
+  8036f8:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8036fc:	50                   	push   %rax
+  8036fd:	4d 89 e1             	mov    %r12,%r9
+  803700:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803706:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80370b:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803712:	00 00 00 
+  803715:	89 de                	mov    %ebx,%esi
+  803717:	48 b8 3b 56 80 00 00 	movabs $0x80563b,%rax
+  80371e:	00 00 00 
+  803721:	ff d0                	call   *%rax
+}
+  803723:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803727:	5b                   	pop    %rbx
+  803728:	41 5c                	pop    %r12
+  80372a:	5d                   	pop    %rbp
+  80372b:	c3                   	ret
+
+000000000080372c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80372c:	55                   	push   %rbp
+  80372d:	48 89 e5             	mov    %rsp,%rbp
+  803730:	41 54                	push   %r12
+  803732:	53                   	push   %rbx
+  803733:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803736:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803739:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803740:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803742:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803747:	be 00 00 00 00       	mov    $0x0,%esi
+  80374c:	bf 05 00 00 00       	mov    $0x5,%edi
+  803751:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80375d:	85 c0                	test   %eax,%eax
+  80375f:	78 5a                	js     8037bb <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803761:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803768:	00 00 00 
+  80376b:	4c 89 e6             	mov    %r12,%rsi
+  80376e:	48 89 df             	mov    %rbx,%rdi
+  803771:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  803778:	00 00 00 
+  80377b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80377d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803784:	00 
+  803785:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80378b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803792:	00 
+  803793:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803799:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8037a0:	00 
+  8037a1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8037a8:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8037af:	00 
+  8037b0:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8037b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037bb:	5b                   	pop    %rbx
+  8037bc:	41 5c                	pop    %r12
+  8037be:	5d                   	pop    %rbp
+  8037bf:	c3                   	ret
+
+00000000008037c0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8037c0:	55                   	push   %rbp
+  8037c1:	48 89 e5             	mov    %rsp,%rbp
+  8037c4:	41 57                	push   %r15
+  8037c6:	41 56                	push   %r14
+  8037c8:	41 55                	push   %r13
+  8037ca:	41 54                	push   %r12
+  8037cc:	53                   	push   %rbx
+  8037cd:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8037d1:	48 85 ff             	test   %rdi,%rdi
+  8037d4:	0f 84 a1 00 00 00    	je     80387b <devfile_read+0xbb>
+  8037da:	49 89 ff             	mov    %rdi,%r15
+  8037dd:	49 89 f5             	mov    %rsi,%r13
+  8037e0:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8037e3:	48 85 f6             	test   %rsi,%rsi
+  8037e6:	0f 84 c4 00 00 00    	je     8038b0 <devfile_read+0xf0>
+    size_t total_read = 0;
+  8037ec:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8037f3:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037f4:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8037fb:	00 00 00 
+  8037fe:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803802:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803805:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803809:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80380e:	be 00 00 00 00       	mov    $0x0,%esi
+  803813:	bf 03 00 00 00       	mov    $0x3,%edi
+  803818:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  80381f:	00 00 00 
+  803822:	ff d0                	call   *%rax
+        if (res < 0) {
+  803824:	85 c0                	test   %eax,%eax
+  803826:	0f 88 b9 00 00 00    	js     8038e5 <devfile_read+0x125>
+        assert(res <= n);
+  80382c:	48 63 d8             	movslq %eax,%rbx
+  80382f:	49 39 dc             	cmp    %rbx,%r12
+  803832:	0f 82 b1 00 00 00    	jb     8038e9 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803838:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80383d:	0f 87 db 00 00 00    	ja     80391e <devfile_read+0x15e>
+        if (!res) {
+  803843:	85 c0                	test   %eax,%eax
+  803845:	74 21                	je     803868 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803847:	48 89 da             	mov    %rbx,%rdx
+  80384a:	4c 89 f6             	mov    %r14,%rsi
+  80384d:	4c 89 ef             	mov    %r13,%rdi
+  803850:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  803857:	00 00 00 
+  80385a:	ff d0                	call   *%rax
+        total_read += res;
+  80385c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803860:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803863:	49 29 dc             	sub    %rbx,%r12
+  803866:	75 96                	jne    8037fe <devfile_read+0x3e>
+    return total_read;
+  803868:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80386c:	48 83 c4 18          	add    $0x18,%rsp
+  803870:	5b                   	pop    %rbx
+  803871:	41 5c                	pop    %r12
+  803873:	41 5d                	pop    %r13
+  803875:	41 5e                	pop    %r14
+  803877:	41 5f                	pop    %r15
+  803879:	5d                   	pop    %rbp
+  80387a:	c3                   	ret
+    assert(fd);
+  80387b:	48 b9 16 63 80 00 00 	movabs $0x806316,%rcx
+  803882:	00 00 00 
+  803885:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  80388c:	00 00 00 
+  80388f:	be 91 00 00 00       	mov    $0x91,%esi
+  803894:	48 bf 0b 63 80 00 00 	movabs $0x80630b,%rdi
+  80389b:	00 00 00 
+  80389e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a3:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  8038aa:	00 00 00 
+  8038ad:	41 ff d0             	call   *%r8
+    assert(buf);
+  8038b0:	48 b9 19 63 80 00 00 	movabs $0x806319,%rcx
+  8038b7:	00 00 00 
+  8038ba:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  8038c1:	00 00 00 
+  8038c4:	be 92 00 00 00       	mov    $0x92,%esi
+  8038c9:	48 bf 0b 63 80 00 00 	movabs $0x80630b,%rdi
+  8038d0:	00 00 00 
+  8038d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d8:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  8038df:	00 00 00 
+  8038e2:	41 ff d0             	call   *%r8
+            return res;
+  8038e5:	48 98                	cltq
+  8038e7:	eb 83                	jmp    80386c <devfile_read+0xac>
+        assert(res <= n);
+  8038e9:	48 b9 1d 63 80 00 00 	movabs $0x80631d,%rcx
+  8038f0:	00 00 00 
+  8038f3:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  8038fa:	00 00 00 
+  8038fd:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803902:	48 bf 0b 63 80 00 00 	movabs $0x80630b,%rdi
+  803909:	00 00 00 
+  80390c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803911:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  803918:	00 00 00 
+  80391b:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80391e:	48 b9 28 63 80 00 00 	movabs $0x806328,%rcx
+  803925:	00 00 00 
+  803928:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  80392f:	00 00 00 
+  803932:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803937:	48 bf 0b 63 80 00 00 	movabs $0x80630b,%rdi
+  80393e:	00 00 00 
+  803941:	b8 00 00 00 00       	mov    $0x0,%eax
+  803946:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  80394d:	00 00 00 
+  803950:	41 ff d0             	call   *%r8
+
+0000000000803953 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803953:	55                   	push   %rbp
+  803954:	48 89 e5             	mov    %rsp,%rbp
+  803957:	41 57                	push   %r15
+  803959:	41 56                	push   %r14
+  80395b:	41 55                	push   %r13
+  80395d:	41 54                	push   %r12
+  80395f:	53                   	push   %rbx
+  803960:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803964:	48 85 ff             	test   %rdi,%rdi
+  803967:	0f 84 83 00 00 00    	je     8039f0 <devfile_write+0x9d>
+  80396d:	49 89 ff             	mov    %rdi,%r15
+  803970:	49 89 f4             	mov    %rsi,%r12
+  803973:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803976:	48 85 f6             	test   %rsi,%rsi
+  803979:	0f 84 a6 00 00 00    	je     803a25 <devfile_write+0xd2>
+    size_t total_written = 0;
+  80397f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803985:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80398c:	00 00 00 
+  80398f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803993:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803996:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80399a:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80399f:	48 39 d3             	cmp    %rdx,%rbx
+  8039a2:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8039a6:	4c 89 e6             	mov    %r12,%rsi
+  8039a9:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8039b0:	00 00 00 
+  8039b3:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  8039ba:	00 00 00 
+  8039bd:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8039c9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8039ce:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  8039d5:	00 00 00 
+  8039d8:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039da:	85 c0                	test   %eax,%eax
+  8039dc:	78 7c                	js     803a5a <devfile_write+0x107>
+        total_written += res;
+  8039de:	48 98                	cltq
+  8039e0:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8039e3:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8039e6:	48 29 c3             	sub    %rax,%rbx
+  8039e9:	75 a4                	jne    80398f <devfile_write+0x3c>
+    return total_written;
+  8039eb:	4c 89 e8             	mov    %r13,%rax
+  8039ee:	eb 6c                	jmp    803a5c <devfile_write+0x109>
+    assert(fd);
+  8039f0:	48 b9 16 63 80 00 00 	movabs $0x806316,%rcx
+  8039f7:	00 00 00 
+  8039fa:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  803a01:	00 00 00 
+  803a04:	be bd 00 00 00       	mov    $0xbd,%esi
+  803a09:	48 bf 0b 63 80 00 00 	movabs $0x80630b,%rdi
+  803a10:	00 00 00 
+  803a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a18:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  803a1f:	00 00 00 
+  803a22:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a25:	48 b9 19 63 80 00 00 	movabs $0x806319,%rcx
+  803a2c:	00 00 00 
+  803a2f:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  803a36:	00 00 00 
+  803a39:	be be 00 00 00       	mov    $0xbe,%esi
+  803a3e:	48 bf 0b 63 80 00 00 	movabs $0x80630b,%rdi
+  803a45:	00 00 00 
+  803a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a4d:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  803a54:	00 00 00 
+  803a57:	41 ff d0             	call   *%r8
+            return res;
+  803a5a:	48 98                	cltq
+}
+  803a5c:	48 83 c4 08          	add    $0x8,%rsp
+  803a60:	5b                   	pop    %rbx
+  803a61:	41 5c                	pop    %r12
+  803a63:	41 5d                	pop    %r13
+  803a65:	41 5e                	pop    %r14
+  803a67:	41 5f                	pop    %r15
+  803a69:	5d                   	pop    %rbp
+  803a6a:	c3                   	ret
+
+0000000000803a6b <open>:
+open(const char *path, int mode) {
+  803a6b:	55                   	push   %rbp
+  803a6c:	48 89 e5             	mov    %rsp,%rbp
+  803a6f:	41 55                	push   %r13
+  803a71:	41 54                	push   %r12
+  803a73:	53                   	push   %rbx
+  803a74:	48 83 ec 18          	sub    $0x18,%rsp
+  803a78:	49 89 fc             	mov    %rdi,%r12
+  803a7b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803a7e:	48 b8 61 20 80 00 00 	movabs $0x802061,%rax
+  803a85:	00 00 00 
+  803a88:	ff d0                	call   *%rax
+  803a8a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803a90:	0f 87 8f 00 00 00    	ja     803b25 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803a96:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803a9a:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  803aa1:	00 00 00 
+  803aa4:	ff d0                	call   *%rax
+  803aa6:	89 c3                	mov    %eax,%ebx
+  803aa8:	85 c0                	test   %eax,%eax
+  803aaa:	78 55                	js     803b01 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803aac:	4c 89 e6             	mov    %r12,%rsi
+  803aaf:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803ab6:	00 00 00 
+  803ab9:	48 89 df             	mov    %rbx,%rdi
+  803abc:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  803ac3:	00 00 00 
+  803ac6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803ac8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803acf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ad4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ad8:	bf 01 00 00 00       	mov    $0x1,%edi
+  803add:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803ae4:	00 00 00 
+  803ae7:	ff d0                	call   *%rax
+  803ae9:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803aeb:	85 c0                	test   %eax,%eax
+  803aed:	78 1f                	js     803b0e <open+0xa3>
+    return fd2num(fd);
+  803aef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803af3:	48 b8 62 2e 80 00 00 	movabs $0x802e62,%rax
+  803afa:	00 00 00 
+  803afd:	ff d0                	call   *%rax
+  803aff:	89 c3                	mov    %eax,%ebx
+}
+  803b01:	89 d8                	mov    %ebx,%eax
+  803b03:	48 83 c4 18          	add    $0x18,%rsp
+  803b07:	5b                   	pop    %rbx
+  803b08:	41 5c                	pop    %r12
+  803b0a:	41 5d                	pop    %r13
+  803b0c:	5d                   	pop    %rbp
+  803b0d:	c3                   	ret
+        fd_close(fd, 0);
+  803b0e:	be 00 00 00 00       	mov    $0x0,%esi
+  803b13:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b17:	48 b8 ab 2f 80 00 00 	movabs $0x802fab,%rax
+  803b1e:	00 00 00 
+  803b21:	ff d0                	call   *%rax
+        return res;
+  803b23:	eb dc                	jmp    803b01 <open+0x96>
+        return -E_BAD_PATH;
+  803b25:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b2a:	eb d5                	jmp    803b01 <open+0x96>
+
+0000000000803b2c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803b2c:	55                   	push   %rbp
+  803b2d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803b30:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b35:	be 00 00 00 00       	mov    $0x0,%esi
+  803b3a:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b3f:	48 b8 d9 35 80 00 00 	movabs $0x8035d9,%rax
+  803b46:	00 00 00 
+  803b49:	ff d0                	call   *%rax
+}
+  803b4b:	5d                   	pop    %rbp
+  803b4c:	c3                   	ret
+
+0000000000803b4d <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803b4d:	55                   	push   %rbp
+  803b4e:	48 89 e5             	mov    %rsp,%rbp
+  803b51:	41 56                	push   %r14
+  803b53:	41 55                	push   %r13
+  803b55:	41 54                	push   %r12
+  803b57:	53                   	push   %rbx
+  803b58:	48 83 ec 10          	sub    $0x10,%rsp
+  803b5c:	41 89 f6             	mov    %esi,%r14d
+  803b5f:	49 89 d4             	mov    %rdx,%r12
+  803b62:	48 89 cb             	mov    %rcx,%rbx
+  803b65:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b68:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b6c:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  803b73:	00 00 00 
+  803b76:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b78:	85 c0                	test   %eax,%eax
+  803b7a:	78 46                	js     803bc2 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b7c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b80:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803b87:	00 00 00 
+  803b8a:	8b 00                	mov    (%rax),%eax
+  803b8c:	39 02                	cmp    %eax,(%rdx)
+  803b8e:	75 3f                	jne    803bcf <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803b90:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803b97:	00 00 00 
+  803b9a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803b9d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803b9f:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ba3:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ba7:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803bab:	48 89 da             	mov    %rbx,%rdx
+  803bae:	4c 89 e6             	mov    %r12,%rsi
+  803bb1:	bf 09 00 00 00       	mov    $0x9,%edi
+  803bb6:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803bbd:	00 00 00 
+  803bc0:	ff d0                	call   *%rax
+}
+  803bc2:	48 83 c4 10          	add    $0x10,%rsp
+  803bc6:	5b                   	pop    %rbx
+  803bc7:	41 5c                	pop    %r12
+  803bc9:	41 5d                	pop    %r13
+  803bcb:	41 5e                	pop    %r14
+  803bcd:	5d                   	pop    %rbp
+  803bce:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803bcf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803bd4:	eb ec                	jmp    803bc2 <file_map+0x75>
+
+0000000000803bd6 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803bd6:	55                   	push   %rbp
+  803bd7:	48 89 e5             	mov    %rsp,%rbp
+  803bda:	41 54                	push   %r12
+  803bdc:	53                   	push   %rbx
+  803bdd:	48 83 ec 20          	sub    $0x20,%rsp
+  803be1:	41 89 f4             	mov    %esi,%r12d
+  803be4:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803be7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803beb:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  803bf2:	00 00 00 
+  803bf5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bf7:	85 c0                	test   %eax,%eax
+  803bf9:	78 3c                	js     803c37 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803bfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bff:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803c06:	00 00 00 
+  803c09:	8b 0a                	mov    (%rdx),%ecx
+  803c0b:	39 08                	cmp    %ecx,(%rax)
+  803c0d:	75 31                	jne    803c40 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803c0f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c12:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803c15:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803c19:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803c1d:	ba 10 00 00 00       	mov    $0x10,%edx
+  803c22:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803c26:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803c2b:	48 b8 d9 35 80 00 00 	movabs $0x8035d9,%rax
+  803c32:	00 00 00 
+  803c35:	ff d0                	call   *%rax
+}
+  803c37:	48 83 c4 20          	add    $0x20,%rsp
+  803c3b:	5b                   	pop    %rbx
+  803c3c:	41 5c                	pop    %r12
+  803c3e:	5d                   	pop    %rbp
+  803c3f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c40:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c45:	eb f0                	jmp    803c37 <file_msync+0x61>
+
+0000000000803c47 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803c47:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803c4b:	7f 01                	jg     803c4e <writebuf+0x7>
+  803c4d:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803c4e:	55                   	push   %rbp
+  803c4f:	48 89 e5             	mov    %rsp,%rbp
+  803c52:	53                   	push   %rbx
+  803c53:	48 83 ec 08          	sub    $0x8,%rsp
+  803c57:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803c5a:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803c5e:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803c62:	8b 3f                	mov    (%rdi),%edi
+  803c64:	48 b8 02 33 80 00 00 	movabs $0x803302,%rax
+  803c6b:	00 00 00 
+  803c6e:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803c70:	48 85 c0             	test   %rax,%rax
+  803c73:	7e 04                	jle    803c79 <writebuf+0x32>
+  803c75:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803c79:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803c7d:	48 39 c2             	cmp    %rax,%rdx
+  803c80:	74 0f                	je     803c91 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803c82:	48 85 c0             	test   %rax,%rax
+  803c85:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8a:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803c8e:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803c91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c95:	c9                   	leave
+  803c96:	c3                   	ret
+
+0000000000803c97 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803c97:	8b 46 04             	mov    0x4(%rsi),%eax
+  803c9a:	8d 50 01             	lea    0x1(%rax),%edx
+  803c9d:	89 56 04             	mov    %edx,0x4(%rsi)
+  803ca0:	48 98                	cltq
+  803ca2:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803ca7:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803cad:	74 01                	je     803cb0 <putch+0x19>
+  803caf:	c3                   	ret
+putch(int ch, void *arg) {
+  803cb0:	55                   	push   %rbp
+  803cb1:	48 89 e5             	mov    %rsp,%rbp
+  803cb4:	53                   	push   %rbx
+  803cb5:	48 83 ec 08          	sub    $0x8,%rsp
+  803cb9:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803cbc:	48 89 f7             	mov    %rsi,%rdi
+  803cbf:	48 b8 47 3c 80 00 00 	movabs $0x803c47,%rax
+  803cc6:	00 00 00 
+  803cc9:	ff d0                	call   *%rax
+        state->offset = 0;
+  803ccb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803cd2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cd6:	c9                   	leave
+  803cd7:	c3                   	ret
+
+0000000000803cd8 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803cd8:	55                   	push   %rbp
+  803cd9:	48 89 e5             	mov    %rsp,%rbp
+  803cdc:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803ce3:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803ce6:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803cec:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803cf3:	00 00 00 
+    state.result = 0;
+  803cf6:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803cfd:	00 00 00 00 
+    state.error = 1;
+  803d01:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803d08:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803d0b:	48 89 f2             	mov    %rsi,%rdx
+  803d0e:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803d15:	48 bf 97 3c 80 00 00 	movabs $0x803c97,%rdi
+  803d1c:	00 00 00 
+  803d1f:	48 b8 b8 18 80 00 00 	movabs $0x8018b8,%rax
+  803d26:	00 00 00 
+  803d29:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803d2b:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803d32:	7f 14                	jg     803d48 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803d34:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803d3b:	48 85 c0             	test   %rax,%rax
+  803d3e:	75 06                	jne    803d46 <vfprintf+0x6e>
+  803d40:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803d46:	c9                   	leave
+  803d47:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803d48:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803d4f:	48 b8 47 3c 80 00 00 	movabs $0x803c47,%rax
+  803d56:	00 00 00 
+  803d59:	ff d0                	call   *%rax
+  803d5b:	eb d7                	jmp    803d34 <vfprintf+0x5c>
+
+0000000000803d5d <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803d5d:	55                   	push   %rbp
+  803d5e:	48 89 e5             	mov    %rsp,%rbp
+  803d61:	48 83 ec 50          	sub    $0x50,%rsp
+  803d65:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d69:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d6d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d71:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d75:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803d7c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d84:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d88:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803d8c:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d90:	48 b8 d8 3c 80 00 00 	movabs $0x803cd8,%rax
+  803d97:	00 00 00 
+  803d9a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d9c:	c9                   	leave
+  803d9d:	c3                   	ret
+
+0000000000803d9e <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803d9e:	55                   	push   %rbp
+  803d9f:	48 89 e5             	mov    %rsp,%rbp
+  803da2:	48 83 ec 50          	sub    $0x50,%rsp
+  803da6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803daa:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803dae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803db2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803db6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803dba:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803dc1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803dc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803dc9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803dcd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803dd1:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803dd5:	48 89 fe             	mov    %rdi,%rsi
+  803dd8:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ddd:	48 b8 d8 3c 80 00 00 	movabs $0x803cd8,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803de9:	c9                   	leave
+  803dea:	c3                   	ret
+
+0000000000803deb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803deb:	55                   	push   %rbp
+  803dec:	48 89 e5             	mov    %rsp,%rbp
+  803def:	41 54                	push   %r12
+  803df1:	53                   	push   %rbx
+  803df2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803df5:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  803dfc:	00 00 00 
+  803dff:	ff d0                	call   *%rax
+  803e01:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803e04:	48 be 50 63 80 00 00 	movabs $0x806350,%rsi
+  803e0b:	00 00 00 
+  803e0e:	48 89 df             	mov    %rbx,%rdi
+  803e11:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  803e18:	00 00 00 
+  803e1b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803e1d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803e22:	41 2b 04 24          	sub    (%r12),%eax
+  803e26:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803e2c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803e33:	00 00 00 
+    stat->st_dev = &devpipe;
+  803e36:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803e3d:	00 00 00 
+  803e40:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4c:	5b                   	pop    %rbx
+  803e4d:	41 5c                	pop    %r12
+  803e4f:	5d                   	pop    %rbp
+  803e50:	c3                   	ret
+
+0000000000803e51 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803e51:	55                   	push   %rbp
+  803e52:	48 89 e5             	mov    %rsp,%rbp
+  803e55:	41 54                	push   %r12
+  803e57:	53                   	push   %rbx
+  803e58:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803e5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e60:	48 89 fe             	mov    %rdi,%rsi
+  803e63:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e68:	49 bc dc 28 80 00 00 	movabs $0x8028dc,%r12
+  803e6f:	00 00 00 
+  803e72:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803e75:	48 89 df             	mov    %rbx,%rdi
+  803e78:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  803e7f:	00 00 00 
+  803e82:	ff d0                	call   *%rax
+  803e84:	48 89 c6             	mov    %rax,%rsi
+  803e87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e91:	41 ff d4             	call   *%r12
+}
+  803e94:	5b                   	pop    %rbx
+  803e95:	41 5c                	pop    %r12
+  803e97:	5d                   	pop    %rbp
+  803e98:	c3                   	ret
+
+0000000000803e99 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e99:	55                   	push   %rbp
+  803e9a:	48 89 e5             	mov    %rsp,%rbp
+  803e9d:	41 57                	push   %r15
+  803e9f:	41 56                	push   %r14
+  803ea1:	41 55                	push   %r13
+  803ea3:	41 54                	push   %r12
+  803ea5:	53                   	push   %rbx
+  803ea6:	48 83 ec 18          	sub    $0x18,%rsp
+  803eaa:	49 89 fc             	mov    %rdi,%r12
+  803ead:	49 89 f5             	mov    %rsi,%r13
+  803eb0:	49 89 d7             	mov    %rdx,%r15
+  803eb3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803eb7:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  803ebe:	00 00 00 
+  803ec1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803ec3:	4d 85 ff             	test   %r15,%r15
+  803ec6:	0f 84 af 00 00 00    	je     803f7b <devpipe_write+0xe2>
+  803ecc:	48 89 c3             	mov    %rax,%rbx
+  803ecf:	4c 89 f8             	mov    %r15,%rax
+  803ed2:	4d 89 ef             	mov    %r13,%r15
+  803ed5:	4c 01 e8             	add    %r13,%rax
+  803ed8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803edc:	49 bd d2 27 80 00 00 	movabs $0x8027d2,%r13
+  803ee3:	00 00 00 
+            sys_yield();
+  803ee6:	49 be 63 27 80 00 00 	movabs $0x802763,%r14
+  803eed:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ef0:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ef3:	48 63 ce             	movslq %esi,%rcx
+  803ef6:	48 63 03             	movslq (%rbx),%rax
+  803ef9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803eff:	48 39 c1             	cmp    %rax,%rcx
+  803f02:	72 2e                	jb     803f32 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f04:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f09:	48 89 da             	mov    %rbx,%rdx
+  803f0c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f11:	4c 89 e7             	mov    %r12,%rdi
+  803f14:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f17:	85 c0                	test   %eax,%eax
+  803f19:	74 66                	je     803f81 <devpipe_write+0xe8>
+            sys_yield();
+  803f1b:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803f1e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803f21:	48 63 ce             	movslq %esi,%rcx
+  803f24:	48 63 03             	movslq (%rbx),%rax
+  803f27:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803f2d:	48 39 c1             	cmp    %rax,%rcx
+  803f30:	73 d2                	jae    803f04 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803f32:	41 0f b6 3f          	movzbl (%r15),%edi
+  803f36:	48 89 ca             	mov    %rcx,%rdx
+  803f39:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f3d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803f44:	08 10 20 
+  803f47:	48 f7 e2             	mul    %rdx
+  803f4a:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f4e:	48 89 d0             	mov    %rdx,%rax
+  803f51:	48 c1 e0 09          	shl    $0x9,%rax
+  803f55:	48 29 d0             	sub    %rdx,%rax
+  803f58:	48 c1 e0 03          	shl    $0x3,%rax
+  803f5c:	48 29 c1             	sub    %rax,%rcx
+  803f5f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803f64:	83 c6 01             	add    $0x1,%esi
+  803f67:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f6a:	49 83 c7 01          	add    $0x1,%r15
+  803f6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f72:	49 39 c7             	cmp    %rax,%r15
+  803f75:	0f 85 75 ff ff ff    	jne    803ef0 <devpipe_write+0x57>
+    return n;
+  803f7b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f7f:	eb 05                	jmp    803f86 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803f81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f86:	48 83 c4 18          	add    $0x18,%rsp
+  803f8a:	5b                   	pop    %rbx
+  803f8b:	41 5c                	pop    %r12
+  803f8d:	41 5d                	pop    %r13
+  803f8f:	41 5e                	pop    %r14
+  803f91:	41 5f                	pop    %r15
+  803f93:	5d                   	pop    %rbp
+  803f94:	c3                   	ret
+
+0000000000803f95 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f95:	55                   	push   %rbp
+  803f96:	48 89 e5             	mov    %rsp,%rbp
+  803f99:	41 57                	push   %r15
+  803f9b:	41 56                	push   %r14
+  803f9d:	41 55                	push   %r13
+  803f9f:	41 54                	push   %r12
+  803fa1:	53                   	push   %rbx
+  803fa2:	48 83 ec 18          	sub    $0x18,%rsp
+  803fa6:	49 89 fc             	mov    %rdi,%r12
+  803fa9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803fad:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fb1:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  803fb8:	00 00 00 
+  803fbb:	ff d0                	call   *%rax
+  803fbd:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803fc0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fc6:	49 bd d2 27 80 00 00 	movabs $0x8027d2,%r13
+  803fcd:	00 00 00 
+            sys_yield();
+  803fd0:	49 be 63 27 80 00 00 	movabs $0x802763,%r14
+  803fd7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803fda:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803fdf:	74 7d                	je     80405e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803fe1:	8b 03                	mov    (%rbx),%eax
+  803fe3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803fe6:	75 26                	jne    80400e <devpipe_read+0x79>
+            if (i > 0) return i;
+  803fe8:	4d 85 ff             	test   %r15,%r15
+  803feb:	75 77                	jne    804064 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fed:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ff2:	48 89 da             	mov    %rbx,%rdx
+  803ff5:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ffa:	4c 89 e7             	mov    %r12,%rdi
+  803ffd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804000:	85 c0                	test   %eax,%eax
+  804002:	74 72                	je     804076 <devpipe_read+0xe1>
+            sys_yield();
+  804004:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804007:	8b 03                	mov    (%rbx),%eax
+  804009:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80400c:	74 df                	je     803fed <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80400e:	48 63 c8             	movslq %eax,%rcx
+  804011:	48 89 ca             	mov    %rcx,%rdx
+  804014:	48 c1 ea 03          	shr    $0x3,%rdx
+  804018:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80401f:	08 10 20 
+  804022:	48 89 d0             	mov    %rdx,%rax
+  804025:	48 f7 e6             	mul    %rsi
+  804028:	48 c1 ea 06          	shr    $0x6,%rdx
+  80402c:	48 89 d0             	mov    %rdx,%rax
+  80402f:	48 c1 e0 09          	shl    $0x9,%rax
+  804033:	48 29 d0             	sub    %rdx,%rax
+  804036:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80403d:	00 
+  80403e:	48 89 c8             	mov    %rcx,%rax
+  804041:	48 29 d0             	sub    %rdx,%rax
+  804044:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804049:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80404d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804051:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804054:	49 83 c7 01          	add    $0x1,%r15
+  804058:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80405c:	75 83                	jne    803fe1 <devpipe_read+0x4c>
+    return n;
+  80405e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804062:	eb 03                	jmp    804067 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804064:	4c 89 f8             	mov    %r15,%rax
+}
+  804067:	48 83 c4 18          	add    $0x18,%rsp
+  80406b:	5b                   	pop    %rbx
+  80406c:	41 5c                	pop    %r12
+  80406e:	41 5d                	pop    %r13
+  804070:	41 5e                	pop    %r14
+  804072:	41 5f                	pop    %r15
+  804074:	5d                   	pop    %rbp
+  804075:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80407b:	eb ea                	jmp    804067 <devpipe_read+0xd2>
+
+000000000080407d <pipe>:
+pipe(int pfd[2]) {
+  80407d:	55                   	push   %rbp
+  80407e:	48 89 e5             	mov    %rsp,%rbp
+  804081:	41 55                	push   %r13
+  804083:	41 54                	push   %r12
+  804085:	53                   	push   %rbx
+  804086:	48 83 ec 18          	sub    $0x18,%rsp
+  80408a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80408d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804091:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  804098:	00 00 00 
+  80409b:	ff d0                	call   *%rax
+  80409d:	89 c3                	mov    %eax,%ebx
+  80409f:	85 c0                	test   %eax,%eax
+  8040a1:	0f 88 a0 01 00 00    	js     804247 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8040a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040b1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8040b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ba:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  8040c1:	00 00 00 
+  8040c4:	ff d0                	call   *%rax
+  8040c6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8040c8:	85 c0                	test   %eax,%eax
+  8040ca:	0f 88 77 01 00 00    	js     804247 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8040d0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8040d4:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  8040db:	00 00 00 
+  8040de:	ff d0                	call   *%rax
+  8040e0:	89 c3                	mov    %eax,%ebx
+  8040e2:	85 c0                	test   %eax,%eax
+  8040e4:	0f 88 43 01 00 00    	js     80422d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8040ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040f4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8040f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040fd:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  804104:	00 00 00 
+  804107:	ff d0                	call   *%rax
+  804109:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	0f 88 1a 01 00 00    	js     80422d <pipe+0x1b0>
+    va = fd2data(fd0);
+  804113:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804117:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  80411e:	00 00 00 
+  804121:	ff d0                	call   *%rax
+  804123:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804126:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80412b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804130:	48 89 c6             	mov    %rax,%rsi
+  804133:	bf 00 00 00 00       	mov    $0x0,%edi
+  804138:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  80413f:	00 00 00 
+  804142:	ff d0                	call   *%rax
+  804144:	89 c3                	mov    %eax,%ebx
+  804146:	85 c0                	test   %eax,%eax
+  804148:	0f 88 c5 00 00 00    	js     804213 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80414e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804152:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  804159:	00 00 00 
+  80415c:	ff d0                	call   *%rax
+  80415e:	48 89 c1             	mov    %rax,%rcx
+  804161:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804167:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80416d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804172:	4c 89 ee             	mov    %r13,%rsi
+  804175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80417a:	48 b8 71 28 80 00 00 	movabs $0x802871,%rax
+  804181:	00 00 00 
+  804184:	ff d0                	call   *%rax
+  804186:	89 c3                	mov    %eax,%ebx
+  804188:	85 c0                	test   %eax,%eax
+  80418a:	78 6e                	js     8041fa <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80418c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804191:	4c 89 ef             	mov    %r13,%rdi
+  804194:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  80419b:	00 00 00 
+  80419e:	ff d0                	call   *%rax
+  8041a0:	83 f8 02             	cmp    $0x2,%eax
+  8041a3:	0f 85 ab 00 00 00    	jne    804254 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8041a9:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8041b0:	00 00 
+  8041b2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8041b6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8041b8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8041bc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8041c3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8041c7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8041c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041cd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8041d4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8041d8:	48 bb 62 2e 80 00 00 	movabs $0x802e62,%rbx
+  8041df:	00 00 00 
+  8041e2:	ff d3                	call   *%rbx
+  8041e4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8041e8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8041ec:	ff d3                	call   *%rbx
+  8041ee:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8041f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041f8:	eb 4d                	jmp    804247 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8041fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041ff:	4c 89 ee             	mov    %r13,%rsi
+  804202:	bf 00 00 00 00       	mov    $0x0,%edi
+  804207:	48 b8 dc 28 80 00 00 	movabs $0x8028dc,%rax
+  80420e:	00 00 00 
+  804211:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804213:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804218:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80421c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804221:	48 b8 dc 28 80 00 00 	movabs $0x8028dc,%rax
+  804228:	00 00 00 
+  80422b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80422d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804232:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804236:	bf 00 00 00 00       	mov    $0x0,%edi
+  80423b:	48 b8 dc 28 80 00 00 	movabs $0x8028dc,%rax
+  804242:	00 00 00 
+  804245:	ff d0                	call   *%rax
+}
+  804247:	89 d8                	mov    %ebx,%eax
+  804249:	48 83 c4 18          	add    $0x18,%rsp
+  80424d:	5b                   	pop    %rbx
+  80424e:	41 5c                	pop    %r12
+  804250:	41 5d                	pop    %r13
+  804252:	5d                   	pop    %rbp
+  804253:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804254:	48 b9 68 63 80 00 00 	movabs $0x806368,%rcx
+  80425b:	00 00 00 
+  80425e:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  804265:	00 00 00 
+  804268:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80426d:	48 bf 57 63 80 00 00 	movabs $0x806357,%rdi
+  804274:	00 00 00 
+  804277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427c:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  804283:	00 00 00 
+  804286:	41 ff d0             	call   *%r8
+
+0000000000804289 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804289:	55                   	push   %rbp
+  80428a:	48 89 e5             	mov    %rsp,%rbp
+  80428d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804291:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804295:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  80429c:	00 00 00 
+  80429f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042a1:	85 c0                	test   %eax,%eax
+  8042a3:	78 35                	js     8042da <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8042a5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8042a9:	48 b8 74 2e 80 00 00 	movabs $0x802e74,%rax
+  8042b0:	00 00 00 
+  8042b3:	ff d0                	call   *%rax
+  8042b5:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8042b8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8042bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042c2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8042c6:	48 b8 d2 27 80 00 00 	movabs $0x8027d2,%rax
+  8042cd:	00 00 00 
+  8042d0:	ff d0                	call   *%rax
+  8042d2:	85 c0                	test   %eax,%eax
+  8042d4:	0f 94 c0             	sete   %al
+  8042d7:	0f b6 c0             	movzbl %al,%eax
+}
+  8042da:	c9                   	leave
+  8042db:	c3                   	ret
+
+00000000008042dc <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042dc:	48 89 f8             	mov    %rdi,%rax
+  8042df:	48 c1 e8 27          	shr    $0x27,%rax
+  8042e3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042ea:	01 00 00 
+  8042ed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042f1:	f6 c2 01             	test   $0x1,%dl
+  8042f4:	74 6d                	je     804363 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042f6:	48 89 f8             	mov    %rdi,%rax
+  8042f9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042fd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804304:	01 00 00 
+  804307:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80430b:	f6 c2 01             	test   $0x1,%dl
+  80430e:	74 62                	je     804372 <get_uvpt_entry+0x96>
+  804310:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804317:	01 00 00 
+  80431a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80431e:	f6 c2 80             	test   $0x80,%dl
+  804321:	75 4f                	jne    804372 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804323:	48 89 f8             	mov    %rdi,%rax
+  804326:	48 c1 e8 15          	shr    $0x15,%rax
+  80432a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804331:	01 00 00 
+  804334:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804338:	f6 c2 01             	test   $0x1,%dl
+  80433b:	74 44                	je     804381 <get_uvpt_entry+0xa5>
+  80433d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804344:	01 00 00 
+  804347:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80434b:	f6 c2 80             	test   $0x80,%dl
+  80434e:	75 31                	jne    804381 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804350:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804354:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80435b:	01 00 00 
+  80435e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804362:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804363:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80436a:	01 00 00 
+  80436d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804371:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804372:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804379:	01 00 00 
+  80437c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804380:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804381:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804388:	01 00 00 
+  80438b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80438f:	c3                   	ret
+
+0000000000804390 <get_prot>:
+
+int
+get_prot(void *va) {
+  804390:	55                   	push   %rbp
+  804391:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804394:	48 b8 dc 42 80 00 00 	movabs $0x8042dc,%rax
+  80439b:	00 00 00 
+  80439e:	ff d0                	call   *%rax
+  8043a0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8043a3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8043a8:	89 c1                	mov    %eax,%ecx
+  8043aa:	83 c9 04             	or     $0x4,%ecx
+  8043ad:	f6 c2 01             	test   $0x1,%dl
+  8043b0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8043b3:	89 c1                	mov    %eax,%ecx
+  8043b5:	83 c9 02             	or     $0x2,%ecx
+  8043b8:	f6 c2 02             	test   $0x2,%dl
+  8043bb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8043be:	89 c1                	mov    %eax,%ecx
+  8043c0:	83 c9 01             	or     $0x1,%ecx
+  8043c3:	48 85 d2             	test   %rdx,%rdx
+  8043c6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8043c9:	89 c1                	mov    %eax,%ecx
+  8043cb:	83 c9 40             	or     $0x40,%ecx
+  8043ce:	f6 c6 04             	test   $0x4,%dh
+  8043d1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8043d4:	5d                   	pop    %rbp
+  8043d5:	c3                   	ret
+
+00000000008043d6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8043d6:	55                   	push   %rbp
+  8043d7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8043da:	48 b8 dc 42 80 00 00 	movabs $0x8042dc,%rax
+  8043e1:	00 00 00 
+  8043e4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8043e6:	48 c1 e8 06          	shr    $0x6,%rax
+  8043ea:	83 e0 01             	and    $0x1,%eax
+}
+  8043ed:	5d                   	pop    %rbp
+  8043ee:	c3                   	ret
+
+00000000008043ef <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8043ef:	55                   	push   %rbp
+  8043f0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8043f3:	48 b8 dc 42 80 00 00 	movabs $0x8042dc,%rax
+  8043fa:	00 00 00 
+  8043fd:	ff d0                	call   *%rax
+  8043ff:	83 e0 01             	and    $0x1,%eax
+}
+  804402:	5d                   	pop    %rbp
+  804403:	c3                   	ret
+
+0000000000804404 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804404:	55                   	push   %rbp
+  804405:	48 89 e5             	mov    %rsp,%rbp
+  804408:	41 57                	push   %r15
+  80440a:	41 56                	push   %r14
+  80440c:	41 55                	push   %r13
+  80440e:	41 54                	push   %r12
+  804410:	53                   	push   %rbx
+  804411:	48 83 ec 28          	sub    $0x28,%rsp
+  804415:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804419:	48 85 ff             	test   %rdi,%rdi
+  80441c:	74 1e                	je     80443c <foreach_shared_region+0x38>
+  80441e:	49 89 ff             	mov    %rdi,%r15
+  804421:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804427:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80442d:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804434:	01 00 00 
+  804437:	e9 72 02 00 00       	jmp    8046ae <foreach_shared_region+0x2aa>
+    assert(fun);
+  80443c:	48 b9 8c 63 80 00 00 	movabs $0x80638c,%rcx
+  804443:	00 00 00 
+  804446:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  80444d:	00 00 00 
+  804450:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804455:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  80445c:	00 00 00 
+  80445f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804464:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  80446b:	00 00 00 
+  80446e:	41 ff d0             	call   *%r8
+  804471:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804478:	eb 6c                	jmp    8044e6 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80447a:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804481:	ff ff ff 
+  804484:	4c 21 e2             	and    %r12,%rdx
+  804487:	48 89 d8             	mov    %rbx,%rax
+  80448a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80448f:	48 83 c0 01          	add    $0x1,%rax
+  804493:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804497:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80449e:	00 00 00 
+  8044a1:	48 21 c8             	and    %rcx,%rax
+  8044a4:	48 09 d0             	or     %rdx,%rax
+  8044a7:	49 89 c4             	mov    %rax,%r12
+  8044aa:	eb 30                	jmp    8044dc <foreach_shared_region+0xd8>
+  8044ac:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8044b3:	ff ff ff 
+  8044b6:	4c 21 e2             	and    %r12,%rdx
+  8044b9:	48 89 d8             	mov    %rbx,%rax
+  8044bc:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8044c1:	48 83 c0 01          	add    $0x1,%rax
+  8044c5:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8044c9:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8044d0:	00 00 00 
+  8044d3:	48 21 c8             	and    %rcx,%rax
+  8044d6:	48 09 d0             	or     %rdx,%rax
+  8044d9:	49 89 c4             	mov    %rax,%r12
+  8044dc:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8044e0:	0f 84 99 01 00 00    	je     80467f <foreach_shared_region+0x27b>
+  8044e6:	4c 89 e3             	mov    %r12,%rbx
+  8044e9:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8044ed:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8044f4:	01 00 00 
+  8044f7:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044fb:	a8 01                	test   $0x1,%al
+  8044fd:	0f 84 77 ff ff ff    	je     80447a <foreach_shared_region+0x76>
+  804503:	a8 80                	test   $0x80,%al
+  804505:	74 19                	je     804520 <foreach_shared_region+0x11c>
+  804507:	f6 c4 04             	test   $0x4,%ah
+  80450a:	74 a0                	je     8044ac <foreach_shared_region+0xa8>
+  80450c:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804513:	40 
+  804514:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804518:	4c 89 e7             	mov    %r12,%rdi
+  80451b:	41 ff d7             	call   *%r15
+  80451e:	eb 8c                	jmp    8044ac <foreach_shared_region+0xa8>
+  804520:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804527:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80452b:	eb 46                	jmp    804573 <foreach_shared_region+0x16f>
+  80452d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804534:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80453a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80453e:	48 c1 e0 15          	shl    $0x15,%rax
+  804542:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804547:	49 09 c4             	or     %rax,%r12
+  80454a:	eb 1d                	jmp    804569 <foreach_shared_region+0x165>
+  80454c:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804553:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804559:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80455d:	48 c1 e0 15          	shl    $0x15,%rax
+  804561:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804566:	49 09 c4             	or     %rax,%r12
+  804569:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80456d:	0f 84 d3 00 00 00    	je     804646 <foreach_shared_region+0x242>
+  804573:	4c 89 e3             	mov    %r12,%rbx
+  804576:	48 c1 eb 15          	shr    $0x15,%rbx
+  80457a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804581:	01 00 00 
+  804584:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804588:	a8 01                	test   $0x1,%al
+  80458a:	74 a1                	je     80452d <foreach_shared_region+0x129>
+  80458c:	a8 80                	test   $0x80,%al
+  80458e:	74 19                	je     8045a9 <foreach_shared_region+0x1a5>
+  804590:	f6 c4 04             	test   $0x4,%ah
+  804593:	74 b7                	je     80454c <foreach_shared_region+0x148>
+  804595:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80459c:	00 
+  80459d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045a1:	4c 89 e7             	mov    %r12,%rdi
+  8045a4:	41 ff d7             	call   *%r15
+  8045a7:	eb a3                	jmp    80454c <foreach_shared_region+0x148>
+  8045a9:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8045af:	eb 3b                	jmp    8045ec <foreach_shared_region+0x1e8>
+  8045b1:	f6 c4 04             	test   $0x4,%ah
+  8045b4:	74 12                	je     8045c8 <foreach_shared_region+0x1c4>
+  8045b6:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8045bd:	00 
+  8045be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045c2:	4c 89 e7             	mov    %r12,%rdi
+  8045c5:	41 ff d7             	call   *%r15
+  8045c8:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8045cf:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8045d5:	48 83 c3 01          	add    $0x1,%rbx
+  8045d9:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8045dd:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8045e3:	49 09 dc             	or     %rbx,%r12
+  8045e6:	41 83 ed 01          	sub    $0x1,%r13d
+  8045ea:	74 2f                	je     80461b <foreach_shared_region+0x217>
+  8045ec:	4c 89 e3             	mov    %r12,%rbx
+  8045ef:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8045f3:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8045f7:	a8 01                	test   $0x1,%al
+  8045f9:	75 b6                	jne    8045b1 <foreach_shared_region+0x1ad>
+  8045fb:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804602:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804608:	48 83 c3 01          	add    $0x1,%rbx
+  80460c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804610:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804616:	49 09 dc             	or     %rbx,%r12
+  804619:	eb cb                	jmp    8045e6 <foreach_shared_region+0x1e2>
+  80461b:	4c 89 e0             	mov    %r12,%rax
+  80461e:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804624:	49 c1 ec 15          	shr    $0x15,%r12
+  804628:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80462f:	49 83 c4 01          	add    $0x1,%r12
+  804633:	49 c1 e4 15          	shl    $0x15,%r12
+  804637:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80463e:	49 09 c4             	or     %rax,%r12
+  804641:	e9 23 ff ff ff       	jmp    804569 <foreach_shared_region+0x165>
+  804646:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80464a:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804651:	ff ff ff 
+  804654:	4c 21 e0             	and    %r12,%rax
+  804657:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80465b:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804662:	49 83 c4 01          	add    $0x1,%r12
+  804666:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80466a:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804671:	00 00 00 
+  804674:	49 21 d4             	and    %rdx,%r12
+  804677:	49 09 c4             	or     %rax,%r12
+  80467a:	e9 5d fe ff ff       	jmp    8044dc <foreach_shared_region+0xd8>
+  80467f:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804686:	00 ff ff 
+  804689:	4c 21 e0             	and    %r12,%rax
+  80468c:	49 c1 ec 27          	shr    $0x27,%r12
+  804690:	49 83 c4 01          	add    $0x1,%r12
+  804694:	49 c1 e4 27          	shl    $0x27,%r12
+  804698:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80469f:	ff 00 00 
+  8046a2:	49 21 d4             	and    %rdx,%r12
+  8046a5:	49 09 c4             	or     %rax,%r12
+  8046a8:	41 83 ed 01          	sub    $0x1,%r13d
+  8046ac:	74 48                	je     8046f6 <foreach_shared_region+0x2f2>
+  8046ae:	4c 89 e0             	mov    %r12,%rax
+  8046b1:	48 c1 e8 27          	shr    $0x27,%rax
+  8046b5:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8046bc:	01 00 00 
+  8046bf:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8046c3:	f6 c2 01             	test   $0x1,%dl
+  8046c6:	0f 85 a5 fd ff ff    	jne    804471 <foreach_shared_region+0x6d>
+  8046cc:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8046d3:	00 ff ff 
+  8046d6:	4c 21 e2             	and    %r12,%rdx
+  8046d9:	48 83 c0 01          	add    $0x1,%rax
+  8046dd:	48 c1 e0 27          	shl    $0x27,%rax
+  8046e1:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8046e8:	ff 00 00 
+  8046eb:	48 21 c8             	and    %rcx,%rax
+  8046ee:	48 09 d0             	or     %rdx,%rax
+  8046f1:	49 89 c4             	mov    %rax,%r12
+  8046f4:	eb b2                	jmp    8046a8 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8046f6:	4d 85 e4             	test   %r12,%r12
+  8046f9:	75 14                	jne    80470f <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8046fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804700:	48 83 c4 28          	add    $0x28,%rsp
+  804704:	5b                   	pop    %rbx
+  804705:	41 5c                	pop    %r12
+  804707:	41 5d                	pop    %r13
+  804709:	41 5e                	pop    %r14
+  80470b:	41 5f                	pop    %r15
+  80470d:	5d                   	pop    %rbp
+  80470e:	c3                   	ret
+    assert(addr == 0);
+  80470f:	48 b9 9b 63 80 00 00 	movabs $0x80639b,%rcx
+  804716:	00 00 00 
+  804719:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  804720:	00 00 00 
+  804723:	be 67 00 00 00       	mov    $0x67,%esi
+  804728:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  80472f:	00 00 00 
+  804732:	b8 00 00 00 00       	mov    $0x0,%eax
+  804737:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  80473e:	00 00 00 
+  804741:	41 ff d0             	call   *%r8
+
+0000000000804744 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804744:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  80474b:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80474e:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804754:	eb 33                	jmp    804789 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804756:	48 83 c0 20          	add    $0x20,%rax
+  80475a:	4c 39 c0             	cmp    %r8,%rax
+  80475d:	74 25                	je     804784 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80475f:	48 8b 10             	mov    (%rax),%rdx
+  804762:	48 85 d2             	test   %rdx,%rdx
+  804765:	74 ef                	je     804756 <mmap_place+0x12>
+  804767:	48 89 d1             	mov    %rdx,%rcx
+  80476a:	48 03 48 08          	add    0x8(%rax),%rcx
+  80476e:	48 39 cf             	cmp    %rcx,%rdi
+  804771:	73 e3                	jae    804756 <mmap_place+0x12>
+  804773:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804777:	4c 39 ca             	cmp    %r9,%rdx
+  80477a:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  80477e:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804782:	eb d2                	jmp    804756 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804784:	45 84 d2             	test   %r10b,%r10b
+  804787:	74 12                	je     80479b <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804789:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804790:	00 00 00 
+        moved = 0;
+  804793:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804799:	eb c4                	jmp    80475f <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  80479b:	48 01 fe             	add    %rdi,%rsi
+  80479e:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8047a5:	00 00 00 
+  8047a8:	48 39 f0             	cmp    %rsi,%rax
+  8047ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b0:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8047b4:	c3                   	ret
+
+00000000008047b5 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8047b5:	55                   	push   %rbp
+  8047b6:	48 89 e5             	mov    %rsp,%rbp
+  8047b9:	41 57                	push   %r15
+  8047bb:	41 56                	push   %r14
+  8047bd:	41 55                	push   %r13
+  8047bf:	41 54                	push   %r12
+  8047c1:	53                   	push   %rbx
+  8047c2:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8047c6:	48 8b 1f             	mov    (%rdi),%rbx
+  8047c9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8047d0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8047d7:	00 00 00 
+  8047da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047df:	eb 12                	jmp    8047f3 <mmap_pgfault+0x3e>
+  8047e1:	48 83 c2 01          	add    $0x1,%rdx
+  8047e5:	48 83 c0 20          	add    $0x20,%rax
+  8047e9:	48 83 fa 20          	cmp    $0x20,%rdx
+  8047ed:	0f 84 04 01 00 00    	je     8048f7 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8047f3:	48 8b 08             	mov    (%rax),%rcx
+  8047f6:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8047fa:	48 39 de             	cmp    %rbx,%rsi
+  8047fd:	73 e2                	jae    8047e1 <mmap_pgfault+0x2c>
+  8047ff:	48 03 48 08          	add    0x8(%rax),%rcx
+  804803:	48 39 cb             	cmp    %rcx,%rbx
+  804806:	73 d9                	jae    8047e1 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804808:	48 c1 e2 05          	shl    $0x5,%rdx
+  80480c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804813:	00 00 00 
+  804816:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80481a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80481e:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804822:	f6 c2 01             	test   $0x1,%dl
+  804825:	0f 84 e0 00 00 00    	je     80490b <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80482b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804830:	f6 c2 02             	test   $0x2,%dl
+  804833:	0f 84 c3 00 00 00    	je     8048fc <mmap_pgfault+0x147>
+  804839:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804840:	ff ff ff 
+  804843:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804847:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80484e:	00 00 00 
+  804851:	48 39 ca             	cmp    %rcx,%rdx
+  804854:	0f 85 a2 00 00 00    	jne    8048fc <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80485a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80485f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804864:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80486b:	00 00 00 
+  80486e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804873:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  80487a:	00 00 00 
+  80487d:	ff d0                	call   *%rax
+  80487f:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804881:	b8 00 00 00 00       	mov    $0x0,%eax
+  804886:	85 d2                	test   %edx,%edx
+  804888:	78 72                	js     8048fc <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  80488a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80488f:	48 89 de             	mov    %rbx,%rsi
+  804892:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804899:	00 00 00 
+  80489c:	4c 89 e7             	mov    %r12,%rdi
+  80489f:	48 b8 56 24 80 00 00 	movabs $0x802456,%rax
+  8048a6:	00 00 00 
+  8048a9:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8048ab:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8048b1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8048b7:	48 89 d9             	mov    %rbx,%rcx
+  8048ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048bf:	4c 89 e6             	mov    %r12,%rsi
+  8048c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048c7:	48 b8 71 28 80 00 00 	movabs $0x802871,%rax
+  8048ce:	00 00 00 
+  8048d1:	ff d0                	call   *%rax
+  8048d3:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8048d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048da:	4c 89 e6             	mov    %r12,%rsi
+  8048dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048e2:	48 b8 dc 28 80 00 00 	movabs $0x8028dc,%rax
+  8048e9:	00 00 00 
+  8048ec:	ff d0                	call   *%rax
+    return res >= 0;
+  8048ee:	89 d8                	mov    %ebx,%eax
+  8048f0:	f7 d0                	not    %eax
+  8048f2:	c1 e8 1f             	shr    $0x1f,%eax
+  8048f5:	eb 05                	jmp    8048fc <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  8048f7:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  8048fc:	48 83 c4 18          	add    $0x18,%rsp
+  804900:	5b                   	pop    %rbx
+  804901:	41 5c                	pop    %r12
+  804903:	41 5d                	pop    %r13
+  804905:	41 5e                	pop    %r14
+  804907:	41 5f                	pop    %r15
+  804909:	5d                   	pop    %rbp
+  80490a:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80490b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80490f:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804913:	4c 03 30             	add    (%rax),%r14
+  804916:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80491d:	49 39 c6             	cmp    %rax,%r14
+  804920:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804924:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80492b:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804931:	49 bf ef 43 80 00 00 	movabs $0x8043ef,%r15
+  804938:	00 00 00 
+  80493b:	4d 39 f4             	cmp    %r14,%r12
+  80493e:	73 1d                	jae    80495d <mmap_pgfault+0x1a8>
+  804940:	4c 89 e7             	mov    %r12,%rdi
+  804943:	41 ff d7             	call   *%r15
+  804946:	84 c0                	test   %al,%al
+  804948:	75 13                	jne    80495d <mmap_pgfault+0x1a8>
+  80494a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804951:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804958:	4d 39 f4             	cmp    %r14,%r12
+  80495b:	72 e3                	jb     804940 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80495d:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804963:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804967:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80496b:	74 2a                	je     804997 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80496d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804971:	89 de                	mov    %ebx,%esi
+  804973:	2b 30                	sub    (%rax),%esi
+  804975:	03 70 1c             	add    0x1c(%rax),%esi
+  804978:	8b 78 18             	mov    0x18(%rax),%edi
+  80497b:	4c 89 e9             	mov    %r13,%rcx
+  80497e:	48 89 da             	mov    %rbx,%rdx
+  804981:	48 b8 4d 3b 80 00 00 	movabs $0x803b4d,%rax
+  804988:	00 00 00 
+  80498b:	ff d0                	call   *%rax
+    return res > 0;
+  80498d:	85 c0                	test   %eax,%eax
+  80498f:	0f 9f c0             	setg   %al
+  804992:	e9 65 ff ff ff       	jmp    8048fc <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804997:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  80499b:	eb d0                	jmp    80496d <mmap_pgfault+0x1b8>
+
+000000000080499d <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  80499d:	55                   	push   %rbp
+  80499e:	48 89 e5             	mov    %rsp,%rbp
+  8049a1:	41 57                	push   %r15
+  8049a3:	41 56                	push   %r14
+  8049a5:	41 55                	push   %r13
+  8049a7:	41 54                	push   %r12
+  8049a9:	53                   	push   %rbx
+  8049aa:	48 83 ec 28          	sub    $0x28,%rsp
+  8049ae:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8049b2:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8049b5:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8049bc:	ff ff ff 
+  8049bf:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8049c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049c8:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8049cf:	00 00 00 
+  8049d2:	48 39 ca             	cmp    %rcx,%rdx
+  8049d5:	0f 85 e5 00 00 00    	jne    804ac0 <mmap_writeback+0x123>
+  8049db:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8049de:	4c 39 ee             	cmp    %r13,%rsi
+  8049e1:	0f 83 e8 00 00 00    	jae    804acf <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8049e7:	49 be ef 43 80 00 00 	movabs $0x8043ef,%r14
+  8049ee:	00 00 00 
+  8049f1:	49 bf d6 43 80 00 00 	movabs $0x8043d6,%r15
+  8049f8:	00 00 00 
+  8049fb:	eb 10                	jmp    804a0d <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  8049fd:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804a04:	4d 39 ec             	cmp    %r13,%r12
+  804a07:	0f 83 ae 00 00 00    	jae    804abb <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804a0d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804a11:	4c 89 e7             	mov    %r12,%rdi
+  804a14:	41 ff d6             	call   *%r14
+  804a17:	84 c0                	test   %al,%al
+  804a19:	74 e2                	je     8049fd <mmap_writeback+0x60>
+  804a1b:	4c 89 e7             	mov    %r12,%rdi
+  804a1e:	41 ff d7             	call   *%r15
+  804a21:	84 c0                	test   %al,%al
+  804a23:	74 d8                	je     8049fd <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804a25:	4c 89 e3             	mov    %r12,%rbx
+  804a28:	4d 39 ec             	cmp    %r13,%r12
+  804a2b:	73 20                	jae    804a4d <mmap_writeback+0xb0>
+  804a2d:	48 89 df             	mov    %rbx,%rdi
+  804a30:	41 ff d6             	call   *%r14
+  804a33:	84 c0                	test   %al,%al
+  804a35:	74 16                	je     804a4d <mmap_writeback+0xb0>
+  804a37:	48 89 df             	mov    %rbx,%rdi
+  804a3a:	41 ff d7             	call   *%r15
+  804a3d:	84 c0                	test   %al,%al
+  804a3f:	74 0c                	je     804a4d <mmap_writeback+0xb0>
+  804a41:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804a48:	4c 39 eb             	cmp    %r13,%rbx
+  804a4b:	72 e0                	jb     804a2d <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804a4d:	48 89 d9             	mov    %rbx,%rcx
+  804a50:	4c 29 e1             	sub    %r12,%rcx
+  804a53:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804a57:	44 89 e6             	mov    %r12d,%esi
+  804a5a:	2b 30                	sub    (%rax),%esi
+  804a5c:	49 89 c4             	mov    %rax,%r12
+  804a5f:	03 70 1c             	add    0x1c(%rax),%esi
+  804a62:	8b 78 18             	mov    0x18(%rax),%edi
+  804a65:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804a69:	48 89 ca             	mov    %rcx,%rdx
+  804a6c:	48 b8 d6 3b 80 00 00 	movabs $0x803bd6,%rax
+  804a73:	00 00 00 
+  804a76:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804a78:	85 c0                	test   %eax,%eax
+  804a7a:	78 44                	js     804ac0 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804a7c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804a81:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804a84:	41 89 c1             	mov    %eax,%r9d
+  804a87:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804a8e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804a92:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804a96:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a9b:	48 89 ce             	mov    %rcx,%rsi
+  804a9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aa3:	48 b8 71 28 80 00 00 	movabs $0x802871,%rax
+  804aaa:	00 00 00 
+  804aad:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804aaf:	85 c0                	test   %eax,%eax
+  804ab1:	78 0d                	js     804ac0 <mmap_writeback+0x123>
+  804ab3:	49 89 dc             	mov    %rbx,%r12
+  804ab6:	e9 49 ff ff ff       	jmp    804a04 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804abb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ac0:	48 83 c4 28          	add    $0x28,%rsp
+  804ac4:	5b                   	pop    %rbx
+  804ac5:	41 5c                	pop    %r12
+  804ac7:	41 5d                	pop    %r13
+  804ac9:	41 5e                	pop    %r14
+  804acb:	41 5f                	pop    %r15
+  804acd:	5d                   	pop    %rbp
+  804ace:	c3                   	ret
+    return 0;
+  804acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ad4:	eb ea                	jmp    804ac0 <mmap_writeback+0x123>
+
+0000000000804ad6 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804ad6:	55                   	push   %rbp
+  804ad7:	48 89 e5             	mov    %rsp,%rbp
+  804ada:	41 57                	push   %r15
+  804adc:	41 56                	push   %r14
+  804ade:	41 55                	push   %r13
+  804ae0:	41 54                	push   %r12
+  804ae2:	53                   	push   %rbx
+  804ae3:	48 83 ec 38          	sub    $0x38,%rsp
+  804ae7:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804aeb:	48 85 f6             	test   %rsi,%rsi
+  804aee:	0f 84 0c 02 00 00    	je     804d00 <mmap+0x22a>
+  804af4:	49 89 ff             	mov    %rdi,%r15
+  804af7:	49 89 f4             	mov    %rsi,%r12
+  804afa:	41 89 d5             	mov    %edx,%r13d
+  804afd:	41 89 ce             	mov    %ecx,%r14d
+  804b00:	44 89 cb             	mov    %r9d,%ebx
+  804b03:	45 85 c9             	test   %r9d,%r9d
+  804b06:	0f 88 f4 01 00 00    	js     804d00 <mmap+0x22a>
+  804b0c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b13:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804b1a:	0f 85 e7 01 00 00    	jne    804d07 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804b20:	83 e2 fd             	and    $0xfffffffd,%edx
+  804b23:	83 fa 04             	cmp    $0x4,%edx
+  804b26:	0f 85 db 01 00 00    	jne    804d07 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804b2c:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804b2f:	83 fa 01             	cmp    $0x1,%edx
+  804b32:	0f 87 cf 01 00 00    	ja     804d07 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804b38:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804b3c:	44 89 c7             	mov    %r8d,%edi
+  804b3f:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  804b46:	00 00 00 
+  804b49:	ff d0                	call   *%rax
+  804b4b:	89 c2                	mov    %eax,%edx
+  804b4d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b54:	85 d2                	test   %edx,%edx
+  804b56:	0f 88 ab 01 00 00    	js     804d07 <mmap+0x231>
+  804b5c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b60:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804b67:	00 00 00 
+  804b6a:	8b 09                	mov    (%rcx),%ecx
+  804b6c:	39 0a                	cmp    %ecx,(%rdx)
+  804b6e:	0f 85 93 01 00 00    	jne    804d07 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804b74:	8b 52 08             	mov    0x8(%rdx),%edx
+  804b77:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804b7a:	83 fa 01             	cmp    $0x1,%edx
+  804b7d:	0f 84 84 01 00 00    	je     804d07 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b83:	41 83 fe 01          	cmp    $0x1,%r14d
+  804b87:	74 42                	je     804bcb <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804b89:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804b90:	4c 89 e6             	mov    %r12,%rsi
+  804b93:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804b9a:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804b9e:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ba2:	4d 85 ff             	test   %r15,%r15
+  804ba5:	74 67                	je     804c0e <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ba7:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804bae:	75 0f                	jne    804bbf <mmap+0xe9>
+  804bb0:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804bb7:	00 00 00 
+  804bba:	49 39 c7             	cmp    %rax,%r15
+  804bbd:	77 1b                	ja     804bda <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804bbf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bc6:	e9 3c 01 00 00       	jmp    804d07 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804bcb:	41 f6 c5 02          	test   $0x2,%r13b
+  804bcf:	74 b8                	je     804b89 <mmap+0xb3>
+  804bd1:	85 d2                	test   %edx,%edx
+  804bd3:	75 b4                	jne    804b89 <mmap+0xb3>
+  804bd5:	e9 2d 01 00 00       	jmp    804d07 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804bda:	4c 89 ff             	mov    %r15,%rdi
+  804bdd:	48 b8 44 47 80 00 00 	movabs $0x804744,%rax
+  804be4:	00 00 00 
+  804be7:	ff d0                	call   *%rax
+  804be9:	48 89 c2             	mov    %rax,%rdx
+  804bec:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804bf3:	49 39 d7             	cmp    %rdx,%r15
+  804bf6:	0f 85 0b 01 00 00    	jne    804d07 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804bfc:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c03:	00 00 00 
+  804c06:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804c0c:	eb 44                	jmp    804c52 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804c0e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804c12:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804c19:	00 00 00 
+  804c1c:	48 b8 44 47 80 00 00 	movabs $0x804744,%rax
+  804c23:	00 00 00 
+  804c26:	ff d0                	call   *%rax
+  804c28:	48 89 c7             	mov    %rax,%rdi
+  804c2b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804c2f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804c36:	48 85 ff             	test   %rdi,%rdi
+  804c39:	75 c1                	jne    804bfc <mmap+0x126>
+  804c3b:	e9 c7 00 00 00       	jmp    804d07 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804c40:	49 83 c4 01          	add    $0x1,%r12
+  804c44:	48 83 c0 20          	add    $0x20,%rax
+  804c48:	49 83 fc 20          	cmp    $0x20,%r12
+  804c4c:	0f 84 a5 00 00 00    	je     804cf7 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804c52:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804c56:	75 e8                	jne    804c40 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804c58:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804c5c:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  804c63:	00 00 00 
+  804c66:	ff d0                	call   *%rax
+  804c68:	89 c2                	mov    %eax,%edx
+  804c6a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c71:	85 d2                	test   %edx,%edx
+  804c73:	0f 88 8e 00 00 00    	js     804d07 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804c79:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804c7d:	48 b8 62 2e 80 00 00 	movabs $0x802e62,%rax
+  804c84:	00 00 00 
+  804c87:	ff d0                	call   *%rax
+  804c89:	89 c6                	mov    %eax,%esi
+  804c8b:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804c8e:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  804c95:	00 00 00 
+  804c98:	ff d0                	call   *%rax
+  804c9a:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804c9d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ca4:	45 85 ff             	test   %r15d,%r15d
+  804ca7:	78 5e                	js     804d07 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804ca9:	49 c1 e4 05          	shl    $0x5,%r12
+  804cad:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cb4:	00 00 00 
+  804cb7:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804cba:	48 bf b5 47 80 00 00 	movabs $0x8047b5,%rdi
+  804cc1:	00 00 00 
+  804cc4:	48 b8 83 52 80 00 00 	movabs $0x805283,%rax
+  804ccb:	00 00 00 
+  804cce:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804cd0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804cd4:	49 89 04 24          	mov    %rax,(%r12)
+  804cd8:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804cdc:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804ce1:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804ce6:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804ceb:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804cf0:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804cf5:	eb 10                	jmp    804d07 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804cf7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cfe:	eb 07                	jmp    804d07 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804d00:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804d07:	48 83 c4 38          	add    $0x38,%rsp
+  804d0b:	5b                   	pop    %rbx
+  804d0c:	41 5c                	pop    %r12
+  804d0e:	41 5d                	pop    %r13
+  804d10:	41 5e                	pop    %r14
+  804d12:	41 5f                	pop    %r15
+  804d14:	5d                   	pop    %rbp
+  804d15:	c3                   	ret
+
+0000000000804d16 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804d16:	55                   	push   %rbp
+  804d17:	48 89 e5             	mov    %rsp,%rbp
+  804d1a:	41 57                	push   %r15
+  804d1c:	41 56                	push   %r14
+  804d1e:	41 55                	push   %r13
+  804d20:	41 54                	push   %r12
+  804d22:	53                   	push   %rbx
+  804d23:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804d27:	49 89 fe             	mov    %rdi,%r14
+  804d2a:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d31:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d38:	00 
+  804d39:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d40:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d47:	00 00 00 
+  804d4a:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804d51:	49 bf 9d 49 80 00 00 	movabs $0x80499d,%r15
+  804d58:	00 00 00 
+  804d5b:	eb 09                	jmp    804d66 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d5d:	48 83 c3 20          	add    $0x20,%rbx
+  804d61:	4c 39 eb             	cmp    %r13,%rbx
+  804d64:	74 33                	je     804d99 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d66:	48 89 df             	mov    %rbx,%rdi
+  804d69:	48 8b 33             	mov    (%rbx),%rsi
+  804d6c:	4c 39 e6             	cmp    %r12,%rsi
+  804d6f:	73 ec                	jae    804d5d <msync+0x47>
+  804d71:	48 85 f6             	test   %rsi,%rsi
+  804d74:	74 e7                	je     804d5d <msync+0x47>
+  804d76:	48 89 f2             	mov    %rsi,%rdx
+  804d79:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d7d:	49 39 d6             	cmp    %rdx,%r14
+  804d80:	73 db                	jae    804d5d <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804d82:	4c 39 e2             	cmp    %r12,%rdx
+  804d85:	49 0f 47 d4          	cmova  %r12,%rdx
+  804d89:	4c 39 f6             	cmp    %r14,%rsi
+  804d8c:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804d90:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804d93:	85 c0                	test   %eax,%eax
+  804d95:	79 c6                	jns    804d5d <msync+0x47>
+  804d97:	eb 05                	jmp    804d9e <msync+0x88>
+    }
+
+    return 0;
+  804d99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d9e:	48 83 c4 08          	add    $0x8,%rsp
+  804da2:	5b                   	pop    %rbx
+  804da3:	41 5c                	pop    %r12
+  804da5:	41 5d                	pop    %r13
+  804da7:	41 5e                	pop    %r14
+  804da9:	41 5f                	pop    %r15
+  804dab:	5d                   	pop    %rbp
+  804dac:	c3                   	ret
+
+0000000000804dad <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804dad:	55                   	push   %rbp
+  804dae:	48 89 e5             	mov    %rsp,%rbp
+  804db1:	41 57                	push   %r15
+  804db3:	41 56                	push   %r14
+  804db5:	41 55                	push   %r13
+  804db7:	41 54                	push   %r12
+  804db9:	53                   	push   %rbx
+  804dba:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804dbe:	49 89 ff             	mov    %rdi,%r15
+  804dc1:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804dc8:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804dcf:	00 
+  804dd0:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804dd7:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804dde:	00 00 00 
+  804de1:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804de8:	48 89 d8             	mov    %rbx,%rax
+  804deb:	eb 09                	jmp    804df6 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ded:	48 83 c0 20          	add    $0x20,%rax
+  804df1:	4c 39 f0             	cmp    %r14,%rax
+  804df4:	74 40                	je     804e36 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804df6:	48 8b 10             	mov    (%rax),%rdx
+  804df9:	4c 39 e2             	cmp    %r12,%rdx
+  804dfc:	73 ef                	jae    804ded <munmap+0x40>
+  804dfe:	48 85 d2             	test   %rdx,%rdx
+  804e01:	74 ea                	je     804ded <munmap+0x40>
+  804e03:	48 89 d7             	mov    %rdx,%rdi
+  804e06:	48 03 78 08          	add    0x8(%rax),%rdi
+  804e0a:	49 39 ff             	cmp    %rdi,%r15
+  804e0d:	73 de                	jae    804ded <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804e0f:	49 39 fc             	cmp    %rdi,%r12
+  804e12:	72 05                	jb     804e19 <munmap+0x6c>
+  804e14:	4c 39 fa             	cmp    %r15,%rdx
+  804e17:	73 d4                	jae    804ded <munmap+0x40>
+  804e19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804e1e:	48 83 c4 08          	add    $0x8,%rsp
+  804e22:	5b                   	pop    %rbx
+  804e23:	41 5c                	pop    %r12
+  804e25:	41 5d                	pop    %r13
+  804e27:	41 5e                	pop    %r14
+  804e29:	41 5f                	pop    %r15
+  804e2b:	5d                   	pop    %rbp
+  804e2c:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e2d:	48 83 c3 20          	add    $0x20,%rbx
+  804e31:	4c 39 f3             	cmp    %r14,%rbx
+  804e34:	74 5c                	je     804e92 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804e36:	48 8b 33             	mov    (%rbx),%rsi
+  804e39:	4c 39 e6             	cmp    %r12,%rsi
+  804e3c:	73 ef                	jae    804e2d <munmap+0x80>
+  804e3e:	48 85 f6             	test   %rsi,%rsi
+  804e41:	74 ea                	je     804e2d <munmap+0x80>
+  804e43:	48 89 f2             	mov    %rsi,%rdx
+  804e46:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804e4a:	49 39 d7             	cmp    %rdx,%r15
+  804e4d:	73 de                	jae    804e2d <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804e4f:	48 89 df             	mov    %rbx,%rdi
+  804e52:	48 b8 9d 49 80 00 00 	movabs $0x80499d,%rax
+  804e59:	00 00 00 
+  804e5c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804e5e:	85 c0                	test   %eax,%eax
+  804e60:	78 bc                	js     804e1e <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804e62:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804e66:	48 8b 33             	mov    (%rbx),%rsi
+  804e69:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e6e:	48 b8 dc 28 80 00 00 	movabs $0x8028dc,%rax
+  804e75:	00 00 00 
+  804e78:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804e7a:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804e7d:	48 b8 55 30 80 00 00 	movabs $0x803055,%rax
+  804e84:	00 00 00 
+  804e87:	ff d0                	call   *%rax
+        reg->start = 0;
+  804e89:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804e90:	eb 9b                	jmp    804e2d <munmap+0x80>
+    return 0;
+  804e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e97:	eb 85                	jmp    804e1e <munmap+0x71>
+
+0000000000804e99 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e9e:	c3                   	ret
+
+0000000000804e9f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804e9f:	55                   	push   %rbp
+  804ea0:	48 89 e5             	mov    %rsp,%rbp
+  804ea3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804ea6:	48 be a5 63 80 00 00 	movabs $0x8063a5,%rsi
+  804ead:	00 00 00 
+  804eb0:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  804eb7:	00 00 00 
+  804eba:	ff d0                	call   *%rax
+    return 0;
+}
+  804ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ec1:	5d                   	pop    %rbp
+  804ec2:	c3                   	ret
+
+0000000000804ec3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804ec3:	55                   	push   %rbp
+  804ec4:	48 89 e5             	mov    %rsp,%rbp
+  804ec7:	41 57                	push   %r15
+  804ec9:	41 56                	push   %r14
+  804ecb:	41 55                	push   %r13
+  804ecd:	41 54                	push   %r12
+  804ecf:	53                   	push   %rbx
+  804ed0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804ed7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804ede:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804ee5:	00 00 00 00 
+  804ee9:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804ef0:	00 00 00 00 
+  804ef4:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804efb:	00 00 00 00 
+  804eff:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804f06:	00 00 00 00 
+  804f0a:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804f11:	00 00 00 00 
+  804f15:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804f1c:	00 00 00 00 
+  804f20:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804f27:	00 
+  804f28:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804f2f:	00 
+  804f30:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804f37:	00 
+  804f38:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804f3f:	00 
+  804f40:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804f47:	00 
+  804f48:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804f4f:	00 
+  804f50:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804f57:	00 
+  804f58:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804f5f:	00 
+  804f60:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804f67:	00 
+  804f68:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804f6f:	00 
+    for (res = 0; res < n; res += inc) {
+  804f70:	48 85 d2             	test   %rdx,%rdx
+  804f73:	74 7a                	je     804fef <devcons_write+0x12c>
+  804f75:	49 89 d6             	mov    %rdx,%r14
+  804f78:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f7e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804f83:	49 bf ef 23 80 00 00 	movabs $0x8023ef,%r15
+  804f8a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804f8d:	4c 89 f3             	mov    %r14,%rbx
+  804f90:	48 29 f3             	sub    %rsi,%rbx
+  804f93:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804f98:	48 39 c3             	cmp    %rax,%rbx
+  804f9b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804f9f:	4c 63 eb             	movslq %ebx,%r13
+  804fa2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804fa9:	48 01 c6             	add    %rax,%rsi
+  804fac:	4c 89 ea             	mov    %r13,%rdx
+  804faf:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804fb6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804fb9:	4c 89 ee             	mov    %r13,%rsi
+  804fbc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804fc3:	48 b8 1c 26 80 00 00 	movabs $0x80261c,%rax
+  804fca:	00 00 00 
+  804fcd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804fcf:	41 01 dc             	add    %ebx,%r12d
+  804fd2:	49 63 f4             	movslq %r12d,%rsi
+  804fd5:	4c 39 f6             	cmp    %r14,%rsi
+  804fd8:	72 b3                	jb     804f8d <devcons_write+0xca>
+    return res;
+  804fda:	49 63 c4             	movslq %r12d,%rax
+}
+  804fdd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804fe4:	5b                   	pop    %rbx
+  804fe5:	41 5c                	pop    %r12
+  804fe7:	41 5d                	pop    %r13
+  804fe9:	41 5e                	pop    %r14
+  804feb:	41 5f                	pop    %r15
+  804fed:	5d                   	pop    %rbp
+  804fee:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804fef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ff5:	eb e3                	jmp    804fda <devcons_write+0x117>
+
+0000000000804ff7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804ff7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fff:	48 85 c0             	test   %rax,%rax
+  805002:	74 55                	je     805059 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805004:	55                   	push   %rbp
+  805005:	48 89 e5             	mov    %rsp,%rbp
+  805008:	41 55                	push   %r13
+  80500a:	41 54                	push   %r12
+  80500c:	53                   	push   %rbx
+  80500d:	48 83 ec 08          	sub    $0x8,%rsp
+  805011:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805014:	48 bb 4f 26 80 00 00 	movabs $0x80264f,%rbx
+  80501b:	00 00 00 
+  80501e:	49 bc 63 27 80 00 00 	movabs $0x802763,%r12
+  805025:	00 00 00 
+  805028:	eb 03                	jmp    80502d <devcons_read+0x36>
+  80502a:	41 ff d4             	call   *%r12
+  80502d:	ff d3                	call   *%rbx
+  80502f:	85 c0                	test   %eax,%eax
+  805031:	74 f7                	je     80502a <devcons_read+0x33>
+    if (c < 0) return c;
+  805033:	48 63 d0             	movslq %eax,%rdx
+  805036:	78 13                	js     80504b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80503d:	83 f8 04             	cmp    $0x4,%eax
+  805040:	74 09                	je     80504b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805042:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805046:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80504b:	48 89 d0             	mov    %rdx,%rax
+  80504e:	48 83 c4 08          	add    $0x8,%rsp
+  805052:	5b                   	pop    %rbx
+  805053:	41 5c                	pop    %r12
+  805055:	41 5d                	pop    %r13
+  805057:	5d                   	pop    %rbp
+  805058:	c3                   	ret
+  805059:	48 89 d0             	mov    %rdx,%rax
+  80505c:	c3                   	ret
+
+000000000080505d <cputchar>:
+cputchar(int ch) {
+  80505d:	55                   	push   %rbp
+  80505e:	48 89 e5             	mov    %rsp,%rbp
+  805061:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805065:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805069:	be 01 00 00 00       	mov    $0x1,%esi
+  80506e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805072:	48 b8 1c 26 80 00 00 	movabs $0x80261c,%rax
+  805079:	00 00 00 
+  80507c:	ff d0                	call   *%rax
+}
+  80507e:	c9                   	leave
+  80507f:	c3                   	ret
+
+0000000000805080 <getchar>:
+getchar(void) {
+  805080:	55                   	push   %rbp
+  805081:	48 89 e5             	mov    %rsp,%rbp
+  805084:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805088:	ba 01 00 00 00       	mov    $0x1,%edx
+  80508d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805091:	bf 00 00 00 00       	mov    $0x0,%edi
+  805096:	48 b8 d3 31 80 00 00 	movabs $0x8031d3,%rax
+  80509d:	00 00 00 
+  8050a0:	ff d0                	call   *%rax
+  8050a2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8050a4:	85 c0                	test   %eax,%eax
+  8050a6:	78 06                	js     8050ae <getchar+0x2e>
+  8050a8:	74 08                	je     8050b2 <getchar+0x32>
+  8050aa:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8050ae:	89 d0                	mov    %edx,%eax
+  8050b0:	c9                   	leave
+  8050b1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8050b2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8050b7:	eb f5                	jmp    8050ae <getchar+0x2e>
+
+00000000008050b9 <iscons>:
+iscons(int fdnum) {
+  8050b9:	55                   	push   %rbp
+  8050ba:	48 89 e5             	mov    %rsp,%rbp
+  8050bd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8050c1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8050c5:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  8050cc:	00 00 00 
+  8050cf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8050d1:	85 c0                	test   %eax,%eax
+  8050d3:	78 18                	js     8050ed <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8050d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050d9:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8050e0:	00 00 00 
+  8050e3:	8b 00                	mov    (%rax),%eax
+  8050e5:	39 02                	cmp    %eax,(%rdx)
+  8050e7:	0f 94 c0             	sete   %al
+  8050ea:	0f b6 c0             	movzbl %al,%eax
+}
+  8050ed:	c9                   	leave
+  8050ee:	c3                   	ret
+
+00000000008050ef <opencons>:
+opencons(void) {
+  8050ef:	55                   	push   %rbp
+  8050f0:	48 89 e5             	mov    %rsp,%rbp
+  8050f3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8050f7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8050fb:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  805102:	00 00 00 
+  805105:	ff d0                	call   *%rax
+  805107:	85 c0                	test   %eax,%eax
+  805109:	78 49                	js     805154 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80510b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805110:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805115:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805119:	bf 00 00 00 00       	mov    $0x0,%edi
+  80511e:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  805125:	00 00 00 
+  805128:	ff d0                	call   *%rax
+  80512a:	85 c0                	test   %eax,%eax
+  80512c:	78 26                	js     805154 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80512e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805132:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805139:	00 00 
+  80513b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80513d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805141:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805148:	48 b8 62 2e 80 00 00 	movabs $0x802e62,%rax
+  80514f:	00 00 00 
+  805152:	ff d0                	call   *%rax
+}
+  805154:	c9                   	leave
+  805155:	c3                   	ret
+
+0000000000805156 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805156:	55                   	push   %rbp
+  805157:	48 89 e5             	mov    %rsp,%rbp
+  80515a:	41 56                	push   %r14
+  80515c:	41 55                	push   %r13
+  80515e:	41 54                	push   %r12
+  805160:	53                   	push   %rbx
+  805161:	48 83 ec 50          	sub    $0x50,%rsp
+  805165:	49 89 fc             	mov    %rdi,%r12
+  805168:	41 89 f5             	mov    %esi,%r13d
+  80516b:	48 89 d3             	mov    %rdx,%rbx
+  80516e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805172:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  805176:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80517a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805181:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805185:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  805189:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80518d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805191:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  805198:	00 00 00 
+  80519b:	4c 8b 30             	mov    (%rax),%r14
+  80519e:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  8051a5:	00 00 00 
+  8051a8:	ff d0                	call   *%rax
+  8051aa:	89 c6                	mov    %eax,%esi
+  8051ac:	45 89 e8             	mov    %r13d,%r8d
+  8051af:	4c 89 e1             	mov    %r12,%rcx
+  8051b2:	4c 89 f2             	mov    %r14,%rdx
+  8051b5:	48 bf b8 63 80 00 00 	movabs $0x8063b8,%rdi
+  8051bc:	00 00 00 
+  8051bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c4:	49 bc 68 17 80 00 00 	movabs $0x801768,%r12
+  8051cb:	00 00 00 
+  8051ce:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8051d1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8051d5:	48 89 df             	mov    %rbx,%rdi
+  8051d8:	48 b8 04 17 80 00 00 	movabs $0x801704,%rax
+  8051df:	00 00 00 
+  8051e2:	ff d0                	call   *%rax
+    cprintf("\n");
+  8051e4:	48 bf 93 62 80 00 00 	movabs $0x806293,%rdi
+  8051eb:	00 00 00 
+  8051ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8051f6:	cc                   	int3
+  8051f7:	eb fd                	jmp    8051f6 <_panic+0xa0>
+
+00000000008051f9 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8051f9:	55                   	push   %rbp
+  8051fa:	48 89 e5             	mov    %rsp,%rbp
+  8051fd:	41 56                	push   %r14
+  8051ff:	41 55                	push   %r13
+  805201:	41 54                	push   %r12
+  805203:	53                   	push   %rbx
+  805204:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805207:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80520e:	00 00 00 
+  805211:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805215:	74 27                	je     80523e <_handle_vectored_pagefault+0x45>
+  805217:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80521c:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805223:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805226:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805229:	4c 89 e7             	mov    %r12,%rdi
+  80522c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805231:	84 c0                	test   %al,%al
+  805233:	75 45                	jne    80527a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805235:	48 83 c3 01          	add    $0x1,%rbx
+  805239:	49 3b 1e             	cmp    (%r14),%rbx
+  80523c:	72 eb                	jb     805229 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80523e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805245:	00 
+  805246:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80524b:	4d 8b 04 24          	mov    (%r12),%r8
+  80524f:	48 ba e0 63 80 00 00 	movabs $0x8063e0,%rdx
+  805256:	00 00 00 
+  805259:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80525e:	48 bf 10 64 80 00 00 	movabs $0x806410,%rdi
+  805265:	00 00 00 
+  805268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80526d:	49 ba 56 51 80 00 00 	movabs $0x805156,%r10
+  805274:	00 00 00 
+  805277:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80527a:	5b                   	pop    %rbx
+  80527b:	41 5c                	pop    %r12
+  80527d:	41 5d                	pop    %r13
+  80527f:	41 5e                	pop    %r14
+  805281:	5d                   	pop    %rbp
+  805282:	c3                   	ret
+
+0000000000805283 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805283:	55                   	push   %rbp
+  805284:	48 89 e5             	mov    %rsp,%rbp
+  805287:	53                   	push   %rbx
+  805288:	48 83 ec 08          	sub    $0x8,%rsp
+  80528c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80528f:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805294:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80529b:	00 00 00 
+  80529e:	80 38 00             	cmpb   $0x0,(%rax)
+  8052a1:	74 68                	je     80530b <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052a3:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052aa:	00 00 00 
+  8052ad:	48 8b 08             	mov    (%rax),%rcx
+  8052b0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052b5:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8052bc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052bf:	48 85 c9             	test   %rcx,%rcx
+  8052c2:	0f 84 e0 00 00 00    	je     8053a8 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052c8:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8052cc:	0f 84 c9 00 00 00    	je     80539b <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052d2:	48 83 c2 01          	add    $0x1,%rdx
+  8052d6:	48 39 ca             	cmp    %rcx,%rdx
+  8052d9:	75 ed                	jne    8052c8 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8052db:	48 83 f9 08          	cmp    $0x8,%rcx
+  8052df:	0f 84 84 00 00 00    	je     805369 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052e5:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8052e9:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8052f0:	00 00 00 
+  8052f3:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8052fa:	00 00 00 
+  8052fd:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805301:	85 f6                	test   %esi,%esi
+  805303:	0f 89 97 00 00 00    	jns    8053a0 <add_pgfault_handler+0x11d>
+  805309:	eb 63                	jmp    80536e <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80530b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805310:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805315:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80531c:	00 00 00 
+  80531f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805324:	48 b8 04 28 80 00 00 	movabs $0x802804,%rax
+  80532b:	00 00 00 
+  80532e:	ff d0                	call   *%rax
+  805330:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805332:	85 c0                	test   %eax,%eax
+  805334:	78 38                	js     80536e <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805336:	48 be 84 54 80 00 00 	movabs $0x805484,%rsi
+  80533d:	00 00 00 
+  805340:	bf 00 00 00 00       	mov    $0x0,%edi
+  805345:	48 b8 27 2a 80 00 00 	movabs $0x802a27,%rax
+  80534c:	00 00 00 
+  80534f:	ff d0                	call   *%rax
+  805351:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805353:	85 c0                	test   %eax,%eax
+  805355:	78 17                	js     80536e <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805357:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80535e:	00 00 00 
+  805361:	c6 00 01             	movb   $0x1,(%rax)
+  805364:	e9 3a ff ff ff       	jmp    8052a3 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805369:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80536e:	89 f1                	mov    %esi,%ecx
+  805370:	48 ba 1e 64 80 00 00 	movabs $0x80641e,%rdx
+  805377:	00 00 00 
+  80537a:	be 42 00 00 00       	mov    $0x42,%esi
+  80537f:	48 bf 10 64 80 00 00 	movabs $0x806410,%rdi
+  805386:	00 00 00 
+  805389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80538e:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  805395:	00 00 00 
+  805398:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80539b:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8053a0:	89 f0                	mov    %esi,%eax
+  8053a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8053a6:	c9                   	leave
+  8053a7:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8053a8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053af:	00 00 00 
+  8053b2:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8053b9:	48 89 d8             	mov    %rbx,%rax
+  8053bc:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8053c3:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8053c6:	eb d8                	jmp    8053a0 <add_pgfault_handler+0x11d>
+
+00000000008053c8 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8053c8:	55                   	push   %rbp
+  8053c9:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8053cc:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8053d3:	00 00 00 
+  8053d6:	80 38 00             	cmpb   $0x0,(%rax)
+  8053d9:	74 33                	je     80540e <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053db:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8053e2:	00 00 00 
+  8053e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8053ea:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8053f1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053f4:	48 85 c0             	test   %rax,%rax
+  8053f7:	0f 84 85 00 00 00    	je     805482 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8053fd:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805401:	74 40                	je     805443 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805403:	48 83 c1 01          	add    $0x1,%rcx
+  805407:	48 39 c1             	cmp    %rax,%rcx
+  80540a:	75 f1                	jne    8053fd <remove_pgfault_handler+0x35>
+  80540c:	eb 74                	jmp    805482 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80540e:	48 b9 36 64 80 00 00 	movabs $0x806436,%rcx
+  805415:	00 00 00 
+  805418:	48 ba f6 62 80 00 00 	movabs $0x8062f6,%rdx
+  80541f:	00 00 00 
+  805422:	be 48 00 00 00       	mov    $0x48,%esi
+  805427:	48 bf 10 64 80 00 00 	movabs $0x806410,%rdi
+  80542e:	00 00 00 
+  805431:	b8 00 00 00 00       	mov    $0x0,%eax
+  805436:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  80543d:	00 00 00 
+  805440:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805443:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80544a:	00 
+  80544b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80544f:	48 29 ca             	sub    %rcx,%rdx
+  805452:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805459:	00 00 00 
+  80545c:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805460:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805465:	48 89 ce             	mov    %rcx,%rsi
+  805468:	48 b8 ef 23 80 00 00 	movabs $0x8023ef,%rax
+  80546f:	00 00 00 
+  805472:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805474:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80547b:	00 00 00 
+  80547e:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805482:	5d                   	pop    %rbp
+  805483:	c3                   	ret
+
+0000000000805484 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805484:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805487:	48 b8 f9 51 80 00 00 	movabs $0x8051f9,%rax
+  80548e:	00 00 00 
+    call *%rax
+  805491:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805493:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80549a:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80549b:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8054a2:	00 
+    subq $8, %rcx
+  8054a3:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8054a7:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8054aa:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8054b1:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8054b2:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8054b6:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8054ba:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8054bf:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8054c4:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8054c9:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8054ce:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8054d3:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8054d8:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8054dd:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8054e2:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8054e7:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8054ec:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8054f1:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8054f6:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8054fb:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805500:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805504:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805508:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805509:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80550a:	c3                   	ret
+
+000000000080550b <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80550b:	85 ff                	test   %edi,%edi
+  80550d:	78 58                	js     805567 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80550f:	48 85 f6             	test   %rsi,%rsi
+  805512:	74 12                	je     805526 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805514:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80551b:	00 00 00 
+  80551e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805524:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805526:	48 85 c9             	test   %rcx,%rcx
+  805529:	74 12                	je     80553d <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80552b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805532:	00 00 00 
+  805535:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80553b:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80553d:	48 85 d2             	test   %rdx,%rdx
+  805540:	74 14                	je     805556 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805542:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805549:	00 00 00 
+  80554c:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805553:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805556:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80555d:	00 00 00 
+  805560:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805566:	c3                   	ret
+        if (from_env_store) {
+  805567:	48 85 f6             	test   %rsi,%rsi
+  80556a:	74 06                	je     805572 <ipc_result+0x67>
+            *from_env_store = 0;
+  80556c:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805572:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805574:	48 85 c9             	test   %rcx,%rcx
+  805577:	74 ed                	je     805566 <ipc_result+0x5b>
+            *perm_store = 0;
+  805579:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  80557f:	c3                   	ret
+
+0000000000805580 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805580:	55                   	push   %rbp
+  805581:	48 89 e5             	mov    %rsp,%rbp
+  805584:	41 55                	push   %r13
+  805586:	41 54                	push   %r12
+  805588:	53                   	push   %rbx
+  805589:	48 83 ec 08          	sub    $0x8,%rsp
+  80558d:	49 89 fc             	mov    %rdi,%r12
+  805590:	48 89 f7             	mov    %rsi,%rdi
+  805593:	48 89 d3             	mov    %rdx,%rbx
+  805596:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805599:	48 85 f6             	test   %rsi,%rsi
+  80559c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055a3:	00 00 00 
+  8055a6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8055aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8055af:	48 85 d2             	test   %rdx,%rdx
+  8055b2:	74 03                	je     8055b7 <ipc_recv+0x37>
+  8055b4:	48 8b 32             	mov    (%rdx),%rsi
+  8055b7:	48 b8 50 2d 80 00 00 	movabs $0x802d50,%rax
+  8055be:	00 00 00 
+  8055c1:	ff d0                	call   *%rax
+  8055c3:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8055c5:	4c 89 e9             	mov    %r13,%rcx
+  8055c8:	48 89 da             	mov    %rbx,%rdx
+  8055cb:	4c 89 e6             	mov    %r12,%rsi
+  8055ce:	48 b8 0b 55 80 00 00 	movabs $0x80550b,%rax
+  8055d5:	00 00 00 
+  8055d8:	ff d0                	call   *%rax
+}
+  8055da:	48 83 c4 08          	add    $0x8,%rsp
+  8055de:	5b                   	pop    %rbx
+  8055df:	41 5c                	pop    %r12
+  8055e1:	41 5d                	pop    %r13
+  8055e3:	5d                   	pop    %rbp
+  8055e4:	c3                   	ret
+
+00000000008055e5 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8055e5:	55                   	push   %rbp
+  8055e6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8055e9:	48 85 d2             	test   %rdx,%rdx
+  8055ec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055f3:	00 00 00 
+  8055f6:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8055fa:	89 f6                	mov    %esi,%esi
+  8055fc:	48 b8 dc 2b 80 00 00 	movabs $0x802bdc,%rax
+  805603:	00 00 00 
+  805606:	ff d0                	call   *%rax
+    if (res < 0) {
+  805608:	85 c0                	test   %eax,%eax
+  80560a:	78 02                	js     80560e <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80560c:	5d                   	pop    %rbp
+  80560d:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80560e:	89 c1                	mov    %eax,%ecx
+  805610:	48 ba 50 64 80 00 00 	movabs $0x806450,%rdx
+  805617:	00 00 00 
+  80561a:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80561f:	48 bf 5d 64 80 00 00 	movabs $0x80645d,%rdi
+  805626:	00 00 00 
+  805629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80562e:	49 b8 56 51 80 00 00 	movabs $0x805156,%r8
+  805635:	00 00 00 
+  805638:	41 ff d0             	call   *%r8
+
+000000000080563b <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80563b:	55                   	push   %rbp
+  80563c:	48 89 e5             	mov    %rsp,%rbp
+  80563f:	53                   	push   %rbx
+  805640:	48 83 ec 08          	sub    $0x8,%rsp
+  805644:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805648:	48 85 d2             	test   %rdx,%rdx
+  80564b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805652:	00 00 00 
+  805655:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805659:	4d 85 c9             	test   %r9,%r9
+  80565c:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805660:	b8 00 00 00 00       	mov    $0x0,%eax
+  805665:	48 85 db             	test   %rbx,%rbx
+  805668:	74 03                	je     80566d <ipc_call+0x32>
+  80566a:	48 8b 03             	mov    (%rbx),%rax
+  80566d:	89 f6                	mov    %esi,%esi
+  80566f:	48 83 ec 08          	sub    $0x8,%rsp
+  805673:	50                   	push   %rax
+  805674:	48 b8 0e 2c 80 00 00 	movabs $0x802c0e,%rax
+  80567b:	00 00 00 
+  80567e:	ff d0                	call   *%rax
+  805680:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805682:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805686:	48 89 da             	mov    %rbx,%rdx
+  805689:	be 00 00 00 00       	mov    $0x0,%esi
+  80568e:	48 b8 0b 55 80 00 00 	movabs $0x80550b,%rax
+  805695:	00 00 00 
+  805698:	ff d0                	call   *%rax
+}
+  80569a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80569e:	c9                   	leave
+  80569f:	c3                   	ret
+
+00000000008056a0 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8056a0:	55                   	push   %rbp
+  8056a1:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8056a4:	89 f6                	mov    %esi,%esi
+  8056a6:	48 b8 7a 2c 80 00 00 	movabs $0x802c7a,%rax
+  8056ad:	00 00 00 
+  8056b0:	ff d0                	call   *%rax
+  8056b2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8056b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056be:	be 00 00 00 00       	mov    $0x0,%esi
+  8056c3:	48 b8 0b 55 80 00 00 	movabs $0x80550b,%rax
+  8056ca:	00 00 00 
+  8056cd:	ff d0                	call   *%rax
+}
+  8056cf:	5d                   	pop    %rbp
+  8056d0:	c3                   	ret
+
+00000000008056d1 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8056d1:	55                   	push   %rbp
+  8056d2:	48 89 e5             	mov    %rsp,%rbp
+  8056d5:	41 54                	push   %r12
+  8056d7:	53                   	push   %rbx
+  8056d8:	4c 89 cb             	mov    %r9,%rbx
+  8056db:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8056df:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056e3:	48 85 d2             	test   %rdx,%rdx
+  8056e6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056ed:	00 00 00 
+  8056f0:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8056f4:	4d 85 c9             	test   %r9,%r9
+  8056f7:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8056fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805700:	4d 85 e4             	test   %r12,%r12
+  805703:	74 04                	je     805709 <ipc_reply_wait+0x38>
+  805705:	49 8b 04 24          	mov    (%r12),%rax
+  805709:	89 f6                	mov    %esi,%esi
+  80570b:	48 83 ec 08          	sub    $0x8,%rsp
+  80570f:	50                   	push   %rax
+  805710:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  805717:	00 00 00 
+  80571a:	ff d0                	call   *%rax
+  80571c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80571e:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805722:	4c 89 e2             	mov    %r12,%rdx
+  805725:	48 89 de             	mov    %rbx,%rsi
+  805728:	48 b8 0b 55 80 00 00 	movabs $0x80550b,%rax
+  80572f:	00 00 00 
+  805732:	ff d0                	call   *%rax
+}
+  805734:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805738:	5b                   	pop    %rbx
+  805739:	41 5c                	pop    %r12
+  80573b:	5d                   	pop    %rbp
+  80573c:	c3                   	ret
+
+000000000080573d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80573d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805742:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805749:	00 00 00 
+  80574c:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805753:	48 01 ca             	add    %rcx,%rdx
+  805756:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80575c:	39 fa                	cmp    %edi,%edx
+  80575e:	74 12                	je     805772 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805760:	48 83 c0 01          	add    $0x1,%rax
+  805764:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80576a:	75 e0                	jne    80574c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80576c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805771:	c3                   	ret
+            return envs[i].env_id;
+  805772:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805779:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805780:	00 00 00 
+  805783:	48 01 d0             	add    %rdx,%rax
+  805786:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80578c:	c3                   	ret
+  80578d:	0f 1f 00             	nopl   (%rax)
+
+0000000000805790 <__rodata_start>:
+  805790:	77 00                	ja     805792 <__rodata_start+0x2>
+  805792:	72 62                	jb     8057f6 <__rodata_start+0x66>
+  805794:	00 77 62             	add    %dh,0x62(%rdi)
+  805797:	00 0f                	add    %cl,(%rdi)
+  805799:	1f                   	(bad)
+  80579a:	84 00                	test   %al,(%rax)
+  80579c:	00 00                	add    %al,(%rax)
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	b3 09                	mov    $0x9,%bl
+  8057a2:	80 00 00             	addb   $0x0,(%rax)
+  8057a5:	00 00                	add    %al,(%rax)
+  8057a7:	00 ed                	add    %ch,%ch
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8057cd:	00 00                	add    %al,(%rax)
+  8057cf:	00 ed                	add    %ch,%ch
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	8c 0a                	mov    %cs,(%rdx)
+  8057fa:	80 00 00             	addb   $0x0,(%rax)
+  8057fd:	00 00                	add    %al,(%rax)
+  8057ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805806:	00 00                	add    %al,(%rax)
+  805808:	8c 0a                	mov    %cs,(%rdx)
+  80580a:	80 00 00             	addb   $0x0,(%rax)
+  80580d:	00 00                	add    %al,(%rax)
+  80580f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805816:	00 00                	add    %al,(%rax)
+  805818:	8c 0a                	mov    %cs,(%rdx)
+  80581a:	80 00 00             	addb   $0x0,(%rax)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805826:	00 00                	add    %al,(%rax)
+  805828:	8c 0a                	mov    %cs,(%rdx)
+  80582a:	80 00 00             	addb   $0x0,(%rax)
+  80582d:	00 00                	add    %al,(%rax)
+  80582f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805836:	00 00                	add    %al,(%rax)
+  805838:	8c 0a                	mov    %cs,(%rdx)
+  80583a:	80 00 00             	addb   $0x0,(%rax)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	f4                   	hlt
+  805939:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80593f:	00 ed                	add    %ch,%ch
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	2c 0b                	sub    $0xb,%al
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805993:	00 00                	add    %al,(%rax)
+  805995:	00 00                	add    %al,(%rax)
+  805997:	00 cb                	add    %cl,%bl
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	6a 0a                	push   $0xa
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 ed                	add    %ch,%ch
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	3c 0a                	cmp    $0xa,%al
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 ed                	add    %ch,%ch
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  8059eb:	00 00                	add    %al,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 29                	add    %ch,(%rcx)
+  8059f9:	0c 80                	or     $0x80,%al
+  8059fb:	00 00                	add    %al,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 ed                	add    %ch,%ch
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	1a 0b                	sbb    (%rbx),%cl
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 ed                	add    %ch,%ch
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ce                   	(bad)
+  805a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a27:	00 ed                	add    %ch,%ch
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	f4                   	hlt
+  805a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a3f:	00 37                	add    %dh,(%rdi)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 37                	add    %dh,(%rdi)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805a6b:	00 00                	add    %al,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 d2                	add    %dl,%dl
+  805a71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a77:	00 d2                	add    %dl,%dl
+  805a79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a7f:	00 d2                	add    %dl,%dl
+  805a81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a87:	00 d2                	add    %dl,%dl
+  805a89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a8f:	00 d2                	add    %dl,%dl
+  805a91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a97:	00 d2                	add    %dl,%dl
+  805a99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a9f:	00 d2                	add    %dl,%dl
+  805aa1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aa7:	00 f6                	add    %dh,%dh
+  805aa9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aaf:	00 f6                	add    %dh,%dh
+  805ab1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 22                	add    %ah,(%rdx)
+  805af1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805af7:	00 22                	add    %ah,(%rdx)
+  805af9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805aff:	00 22                	add    %ah,(%rdx)
+  805b01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b07:	00 22                	add    %ah,(%rdx)
+  805b09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 46 12             	add    %al,0x12(%rsi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 22                	add    %ah,(%rdx)
+  805bf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bf7:	00 22                	add    %ah,(%rdx)
+  805bf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bff:	00 22                	add    %ah,(%rdx)
+  805c01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c07:	00 22                	add    %ah,(%rdx)
+  805c09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c0f:	00 22                	add    %ah,(%rdx)
+  805c11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c17:	00 22                	add    %ah,(%rdx)
+  805c19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 46 12             	add    %al,0x12(%rsi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805cc0 <basefix.0>:
+  805cc0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805cd0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805ce0:	10 00 2d 6e 00 20 00 3c 75 6e 6b 6e 6f 77 6e 3e     ..-n. .<unknown>
+  805cf0:	00 30 31 32 33 34 35 36 37 38 39 41 42 43 44 45     .0123456789ABCDE
+  805d00:	46 00 30 31 32 33 34 35 36 37 38 39 61 62 63 64     F.0123456789abcd
+  805d10:	65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f 72 20     ef.(null).error 
+  805d20:	25 64 00 75 6e 73 70 65 63 69 66 69 65 64 20 65     %d.unspecified e
+  805d30:	72 72 6f 72 00 62 61 64 20 65 6e 76 69 72 6f 6e     rror.bad environ
+  805d40:	6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70 61 72     ment.invalid par
+  805d50:	61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20 6d 65     ameter.out of me
+  805d60:	6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e 76 69     mory.out of envi
+  805d70:	72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75 70 74     ronments.corrupt
+  805d80:	65 64 20 64 65 62 75 67 20 69 6e 66 6f 00 73 65     ed debug info.se
+  805d90:	67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75 6c 74     gmentation fault
+  805da0:	00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69 6d 61     .invalid ELF ima
+  805db0:	67 65 00 6e 6f 20 73 75 63 68 20 73 79 73 74 65     ge.no such syste
+  805dc0:	6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e 6f 74     m call.entry not
+  805dd0:	20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20 6e 6f      found.env is no
+  805de0:	74 20 72 65 63 76 69 6e 67 00 75 6e 65 78 70 65     t recving.unexpe
+  805df0:	63 74 65 64 20 65 6e 64 20 6f 66 20 66 69 6c 65     cted end of file
+  805e00:	00 6e 6f 20 66 72 65 65 20 73 70 61 63 65 20 6f     .no free space o
+  805e10:	6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e 79 20     n disk.too many 
+  805e20:	66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e 00 66     files are open.f
+  805e30:	69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e 6f 74     ile or block not
+  805e40:	20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64 20 70      found.invalid p
+  805e50:	61 74 68 00 66 69 6c 65 20 61 6c 72 65 61 64 79     ath.file already
+  805e60:	20 65 78 69 73 74 73 00 6f 70 65 72 61 74 69 6f      exists.operatio
+  805e70:	6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65 64 00     n not supported.
+  805e80:	60 19 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     `...............
+  805e90:	a7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805ea0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805eb0:	b7 1f 80 00 00 00 00 00 7f 19 80 00 00 00 00 00     ................
+  805ec0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805ed0:	73 19 80 00 00 00 00 00 ed 19 80 00 00 00 00 00     s...............
+  805ee0:	b7 1f 80 00 00 00 00 00 73 19 80 00 00 00 00 00     ........s.......
+  805ef0:	b9 19 80 00 00 00 00 00 b9 19 80 00 00 00 00 00     ................
+  805f00:	b9 19 80 00 00 00 00 00 b9 19 80 00 00 00 00 00     ................
+  805f10:	b9 19 80 00 00 00 00 00 b9 19 80 00 00 00 00 00     ................
+  805f20:	b9 19 80 00 00 00 00 00 b9 19 80 00 00 00 00 00     ................
+  805f30:	b9 19 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805f40:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805f50:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805f60:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805f70:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805f80:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805f90:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805fa0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805fb0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805fc0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805fd0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805fe0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  805ff0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806000:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806010:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806020:	b7 1f 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  806030:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806040:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806050:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806060:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806070:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806080:	1b 1a 80 00 00 00 00 00 ea 1b 80 00 00 00 00 00     ................
+  806090:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  8060a0:	b7 1f 80 00 00 00 00 00 10 1a 80 00 00 00 00 00     ................
+  8060b0:	4a 1a 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     J...............
+  8060c0:	b7 1f 80 00 00 00 00 00 05 1a 80 00 00 00 00 00     ................
+  8060d0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  8060e0:	93 1d 80 00 00 00 00 00 62 1e 80 00 00 00 00 00     ........b.......
+  8060f0:	b7 1f 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806100:	e1 1a 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806110:	be 1c 80 00 00 00 00 00 b7 1f 80 00 00 00 00 00     ................
+  806120:	b7 1f 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  806130:	b7 1f 80 00 00 00 00 00 69 19 80 00 00 00 00 00     ........i.......
+
+0000000000806140 <error_string>:
+	...
+  806148:	23 5d 80 00 00 00 00 00 35 5d 80 00 00 00 00 00     #]......5]......
+  806158:	45 5d 80 00 00 00 00 00 57 5d 80 00 00 00 00 00     E]......W]......
+  806168:	65 5d 80 00 00 00 00 00 79 5d 80 00 00 00 00 00     e]......y]......
+  806178:	8e 5d 80 00 00 00 00 00 a1 5d 80 00 00 00 00 00     .].......]......
+  806188:	b3 5d 80 00 00 00 00 00 c7 5d 80 00 00 00 00 00     .].......]......
+  806198:	d7 5d 80 00 00 00 00 00 ea 5d 80 00 00 00 00 00     .].......]......
+  8061a8:	01 5e 80 00 00 00 00 00 17 5e 80 00 00 00 00 00     .^.......^......
+  8061b8:	2f 5e 80 00 00 00 00 00 47 5e 80 00 00 00 00 00     /^......G^......
+  8061c8:	54 5e 80 00 00 00 00 00 e0 61 80 00 00 00 00 00     T^.......a......
+  8061d8:	68 5e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     h^......file is 
+  8061e8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8061f8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806208:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806218:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806228:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806238:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806248:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806258:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806268:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806278:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806288:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806298:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8062a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8062b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008062c0 <devtab>:
+  8062c0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8062d0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8062e0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8062f0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806300:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806310:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806320:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806330:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806340:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806350:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806360:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806370:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806380:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806390:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8063a0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8063b0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8063c0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8063d0:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  8063e0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8063f0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806400:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806410:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806420:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806430:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806440:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806450:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806460:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
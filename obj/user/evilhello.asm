@@ -0,0 +1,10320 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 37 16 80 00 00 	movabs $0x801637,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 0b 3c 80 00 00 	movabs $0x803c0b,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 0b 3c 80 00 00 	movabs $0x803c0b,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 cb 15 80 00 00 	movabs $0x8015cb,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 90 5c 80 00 00 	movabs $0x805c90,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 9e 39 80 00 00 	movabs $0x80399e,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 9e 39 80 00 00 	movabs $0x80399e,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be c2 56 80 00 00 	movabs $0x8056c2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 9e 39 80 00 00 	movabs $0x80399e,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be c5 56 80 00 00 	movabs $0x8056c5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 9e 39 80 00 00 	movabs $0x80399e,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 09 4a 80 00 00 	movabs $0x804a09,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 e0 4c 80 00 00 	movabs $0x804ce0,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 88 2f 80 00 00 	movabs $0x802f88,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 1f 33 80 00 00 	movabs $0x80331f,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 ee 32 80 00 00 	movabs $0x8032ee,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 ee 32 80 00 00 	movabs $0x8032ee,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 06 31 80 00 00 	movabs $0x803106,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 9e 39 80 00 00 	movabs $0x80399e,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 88 2f 80 00 00 	movabs $0x802f88,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 41 22 80 00 00 	movabs $0x802241,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 41 22 80 00 00 	movabs $0x802241,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 41 22 80 00 00 	movabs $0x802241,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 41 22 80 00 00 	movabs $0x802241,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 41 22 80 00 00 	movabs $0x802241,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 23 00 00 00       	call   801522 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    /* try to print the kernel entry point as a string!  mua ha ha! */
+    sys_cputs((char *)0x804020000c, 100);
+  801505:	be 64 00 00 00       	mov    $0x64,%esi
+  80150a:	48 bf 0c 00 20 40 80 	movabs $0x804020000c,%rdi
+  801511:	00 00 00 
+  801514:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  80151b:	00 00 00 
+  80151e:	ff d0                	call   *%rax
+}
+  801520:	5d                   	pop    %rbp
+  801521:	c3                   	ret
+
+0000000000801522 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801522:	55                   	push   %rbp
+  801523:	48 89 e5             	mov    %rsp,%rbp
+  801526:	41 56                	push   %r14
+  801528:	41 55                	push   %r13
+  80152a:	41 54                	push   %r12
+  80152c:	53                   	push   %rbx
+  80152d:	41 89 fd             	mov    %edi,%r13d
+  801530:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801533:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80153a:	00 00 00 
+  80153d:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801544:	00 00 00 
+  801547:	48 39 c2             	cmp    %rax,%rdx
+  80154a:	73 17                	jae    801563 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80154c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80154f:	49 89 c4             	mov    %rax,%r12
+  801552:	48 83 c3 08          	add    $0x8,%rbx
+  801556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155b:	ff 53 f8             	call   *-0x8(%rbx)
+  80155e:	4c 39 e3             	cmp    %r12,%rbx
+  801561:	72 ef                	jb     801552 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801563:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  80156a:	00 00 00 
+  80156d:	ff d0                	call   *%rax
+  80156f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801574:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80157b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801582:	00 00 00 
+  801585:	48 01 d0             	add    %rdx,%rax
+  801588:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80158f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801592:	45 85 ed             	test   %r13d,%r13d
+  801595:	7e 0d                	jle    8015a4 <libmain+0x82>
+  801597:	49 8b 06             	mov    (%r14),%rax
+  80159a:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015a1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015a4:	4c 89 f6             	mov    %r14,%rsi
+  8015a7:	44 89 ef             	mov    %r13d,%edi
+  8015aa:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015b1:	00 00 00 
+  8015b4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015b6:	48 b8 cb 15 80 00 00 	movabs $0x8015cb,%rax
+  8015bd:	00 00 00 
+  8015c0:	ff d0                	call   *%rax
+#endif
+}
+  8015c2:	5b                   	pop    %rbx
+  8015c3:	41 5c                	pop    %r12
+  8015c5:	41 5d                	pop    %r13
+  8015c7:	41 5e                	pop    %r14
+  8015c9:	5d                   	pop    %rbp
+  8015ca:	c3                   	ret
+
+00000000008015cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015cb:	55                   	push   %rbp
+  8015cc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015cf:	48 b8 bb 2f 80 00 00 	movabs $0x802fbb,%rax
+  8015d6:	00 00 00 
+  8015d9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e0:	48 b8 ee 25 80 00 00 	movabs $0x8025ee,%rax
+  8015e7:	00 00 00 
+  8015ea:	ff d0                	call   *%rax
+}
+  8015ec:	5d                   	pop    %rbp
+  8015ed:	c3                   	ret
+
+00000000008015ee <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015ee:	55                   	push   %rbp
+  8015ef:	48 89 e5             	mov    %rsp,%rbp
+  8015f2:	53                   	push   %rbx
+  8015f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015fa:	8b 06                	mov    (%rsi),%eax
+  8015fc:	8d 50 01             	lea    0x1(%rax),%edx
+  8015ff:	89 16                	mov    %edx,(%rsi)
+  801601:	48 98                	cltq
+  801603:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801608:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80160e:	74 0a                	je     80161a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801610:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80161a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80161e:	be ff 00 00 00       	mov    $0xff,%esi
+  801623:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  80162a:	00 00 00 
+  80162d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80162f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801635:	eb d9                	jmp    801610 <putch+0x22>
+
+0000000000801637 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801637:	55                   	push   %rbp
+  801638:	48 89 e5             	mov    %rsp,%rbp
+  80163b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801642:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801645:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80164c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801651:	b8 00 00 00 00       	mov    $0x0,%eax
+  801656:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801659:	48 89 f1             	mov    %rsi,%rcx
+  80165c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801663:	48 bf ee 15 80 00 00 	movabs $0x8015ee,%rdi
+  80166a:	00 00 00 
+  80166d:	48 b8 eb 17 80 00 00 	movabs $0x8017eb,%rax
+  801674:	00 00 00 
+  801677:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801679:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801680:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801687:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  80168e:	00 00 00 
+  801691:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801693:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801699:	c9                   	leave
+  80169a:	c3                   	ret
+
+000000000080169b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80169b:	55                   	push   %rbp
+  80169c:	48 89 e5             	mov    %rsp,%rbp
+  80169f:	48 83 ec 50          	sub    $0x50,%rsp
+  8016a3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016a7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016b7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016ce:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016d2:	48 b8 37 16 80 00 00 	movabs $0x801637,%rax
+  8016d9:	00 00 00 
+  8016dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016de:	c9                   	leave
+  8016df:	c3                   	ret
+
+00000000008016e0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016e0:	55                   	push   %rbp
+  8016e1:	48 89 e5             	mov    %rsp,%rbp
+  8016e4:	41 57                	push   %r15
+  8016e6:	41 56                	push   %r14
+  8016e8:	41 55                	push   %r13
+  8016ea:	41 54                	push   %r12
+  8016ec:	53                   	push   %rbx
+  8016ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8016f1:	49 89 fc             	mov    %rdi,%r12
+  8016f4:	49 89 f5             	mov    %rsi,%r13
+  8016f7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016fb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8016fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801701:	41 89 cf             	mov    %ecx,%r15d
+  801704:	4c 39 fa             	cmp    %r15,%rdx
+  801707:	73 5b                	jae    801764 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801709:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80170d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801711:	85 db                	test   %ebx,%ebx
+  801713:	7e 0e                	jle    801723 <print_num+0x43>
+            putch(padc, put_arg);
+  801715:	4c 89 ee             	mov    %r13,%rsi
+  801718:	44 89 f7             	mov    %r14d,%edi
+  80171b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80171e:	83 eb 01             	sub    $0x1,%ebx
+  801721:	75 f2                	jne    801715 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801723:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801727:	48 b9 3d 5c 80 00 00 	movabs $0x805c3d,%rcx
+  80172e:	00 00 00 
+  801731:	48 b8 2c 5c 80 00 00 	movabs $0x805c2c,%rax
+  801738:	00 00 00 
+  80173b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80173f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801743:	ba 00 00 00 00       	mov    $0x0,%edx
+  801748:	49 f7 f7             	div    %r15
+  80174b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80174f:	4c 89 ee             	mov    %r13,%rsi
+  801752:	41 ff d4             	call   *%r12
+}
+  801755:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801759:	5b                   	pop    %rbx
+  80175a:	41 5c                	pop    %r12
+  80175c:	41 5d                	pop    %r13
+  80175e:	41 5e                	pop    %r14
+  801760:	41 5f                	pop    %r15
+  801762:	5d                   	pop    %rbp
+  801763:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801764:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801768:	ba 00 00 00 00       	mov    $0x0,%edx
+  80176d:	49 f7 f7             	div    %r15
+  801770:	48 83 ec 08          	sub    $0x8,%rsp
+  801774:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801778:	52                   	push   %rdx
+  801779:	45 0f be c9          	movsbl %r9b,%r9d
+  80177d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801781:	48 89 c2             	mov    %rax,%rdx
+  801784:	48 b8 e0 16 80 00 00 	movabs $0x8016e0,%rax
+  80178b:	00 00 00 
+  80178e:	ff d0                	call   *%rax
+  801790:	48 83 c4 10          	add    $0x10,%rsp
+  801794:	eb 8d                	jmp    801723 <print_num+0x43>
+
+0000000000801796 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801796:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80179a:	48 8b 06             	mov    (%rsi),%rax
+  80179d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017a1:	73 0a                	jae    8017ad <sprintputch+0x17>
+        *state->start++ = ch;
+  8017a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017a7:	48 89 16             	mov    %rdx,(%rsi)
+  8017aa:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017ad:	c3                   	ret
+
+00000000008017ae <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017ae:	55                   	push   %rbp
+  8017af:	48 89 e5             	mov    %rsp,%rbp
+  8017b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8017b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017c2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017d9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017dd:	48 b8 eb 17 80 00 00 	movabs $0x8017eb,%rax
+  8017e4:	00 00 00 
+  8017e7:	ff d0                	call   *%rax
+}
+  8017e9:	c9                   	leave
+  8017ea:	c3                   	ret
+
+00000000008017eb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017eb:	55                   	push   %rbp
+  8017ec:	48 89 e5             	mov    %rsp,%rbp
+  8017ef:	41 57                	push   %r15
+  8017f1:	41 56                	push   %r14
+  8017f3:	41 55                	push   %r13
+  8017f5:	41 54                	push   %r12
+  8017f7:	53                   	push   %rbx
+  8017f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8017fc:	49 89 fe             	mov    %rdi,%r14
+  8017ff:	49 89 f5             	mov    %rsi,%r13
+  801802:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801805:	48 8b 01             	mov    (%rcx),%rax
+  801808:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80180c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801810:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801814:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801818:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80181c:	eb 0d                	jmp    80182b <vprintfmt+0x40>
+            putch(ch, put_arg);
+  80181e:	40 0f b6 ff          	movzbl %dil,%edi
+  801822:	4c 89 ee             	mov    %r13,%rsi
+  801825:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801828:	4c 89 e3             	mov    %r12,%rbx
+  80182b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80182f:	0f b6 3b             	movzbl (%rbx),%edi
+  801832:	40 80 ff 25          	cmp    $0x25,%dil
+  801836:	74 14                	je     80184c <vprintfmt+0x61>
+            if (!ch) return;
+  801838:	40 84 ff             	test   %dil,%dil
+  80183b:	75 e1                	jne    80181e <vprintfmt+0x33>
+}
+  80183d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801841:	5b                   	pop    %rbx
+  801842:	41 5c                	pop    %r12
+  801844:	41 5d                	pop    %r13
+  801846:	41 5e                	pop    %r14
+  801848:	41 5f                	pop    %r15
+  80184a:	5d                   	pop    %rbp
+  80184b:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  80184c:	be 00 00 00 00       	mov    $0x0,%esi
+  801851:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801855:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80185a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801860:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801867:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80186b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801870:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801875:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801878:	83 e8 23             	sub    $0x23,%eax
+  80187b:	3c 57                	cmp    $0x57,%al
+  80187d:	0f 87 67 06 00 00    	ja     801eea <vprintfmt+0x6ff>
+  801883:	0f b6 c0             	movzbl %al,%eax
+  801886:	48 b9 c0 5d 80 00 00 	movabs $0x805dc0,%rcx
+  80188d:	00 00 00 
+  801890:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801893:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801896:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80189a:	eb cf                	jmp    80186b <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80189c:	49 89 dc             	mov    %rbx,%r12
+  80189f:	be 01 00 00 00       	mov    $0x1,%esi
+  8018a4:	eb c5                	jmp    80186b <vprintfmt+0x80>
+            padc = ch;
+  8018a6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018aa:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018ad:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018b0:	eb b9                	jmp    80186b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8018b8:	77 24                	ja     8018de <vprintfmt+0xf3>
+  8018ba:	89 c1                	mov    %eax,%ecx
+  8018bc:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018c0:	83 c0 08             	add    $0x8,%eax
+  8018c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018c6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018c9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018cc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018d0:	79 99                	jns    80186b <vprintfmt+0x80>
+                width = precision;
+  8018d2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018d6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018dc:	eb 8d                	jmp    80186b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018de:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018e2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018ea:	eb da                	jmp    8018c6 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018ec:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018f1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018f5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018fb:	3c 39                	cmp    $0x39,%al
+  8018fd:	77 1c                	ja     80191b <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8018ff:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801903:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801907:	0f b6 c0             	movzbl %al,%eax
+  80190a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80190f:	0f b6 03             	movzbl (%rbx),%eax
+  801912:	3c 39                	cmp    $0x39,%al
+  801914:	76 e9                	jbe    8018ff <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801916:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801919:	eb b1                	jmp    8018cc <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  80191b:	49 89 dc             	mov    %rbx,%r12
+  80191e:	eb ac                	jmp    8018cc <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801920:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801923:	85 c9                	test   %ecx,%ecx
+  801925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192a:	0f 49 c1             	cmovns %ecx,%eax
+  80192d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801930:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801933:	e9 33 ff ff ff       	jmp    80186b <vprintfmt+0x80>
+            lflag++;
+  801938:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80193b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80193e:	e9 28 ff ff ff       	jmp    80186b <vprintfmt+0x80>
+            lflag--;
+  801943:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801946:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801949:	e9 1d ff ff ff       	jmp    80186b <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  80194e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801951:	83 f8 2f             	cmp    $0x2f,%eax
+  801954:	77 19                	ja     80196f <vprintfmt+0x184>
+  801956:	89 c2                	mov    %eax,%edx
+  801958:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80195c:	83 c0 08             	add    $0x8,%eax
+  80195f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801962:	8b 3a                	mov    (%rdx),%edi
+  801964:	4c 89 ee             	mov    %r13,%rsi
+  801967:	41 ff d6             	call   *%r14
+            break;
+  80196a:	e9 bc fe ff ff       	jmp    80182b <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80196f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801973:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801977:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80197b:	eb e5                	jmp    801962 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  80197d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801980:	83 f8 2f             	cmp    $0x2f,%eax
+  801983:	77 5a                	ja     8019df <vprintfmt+0x1f4>
+  801985:	89 c2                	mov    %eax,%edx
+  801987:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80198b:	83 c0 08             	add    $0x8,%eax
+  80198e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801991:	8b 02                	mov    (%rdx),%eax
+  801993:	89 c1                	mov    %eax,%ecx
+  801995:	f7 d9                	neg    %ecx
+  801997:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80199a:	83 f9 13             	cmp    $0x13,%ecx
+  80199d:	7f 4e                	jg     8019ed <vprintfmt+0x202>
+  80199f:	48 63 c1             	movslq %ecx,%rax
+  8019a2:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8019a9:	00 00 00 
+  8019ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019b0:	48 85 c0             	test   %rax,%rax
+  8019b3:	74 38                	je     8019ed <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019b5:	48 89 c1             	mov    %rax,%rcx
+  8019b8:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8019bf:	00 00 00 
+  8019c2:	4c 89 ee             	mov    %r13,%rsi
+  8019c5:	4c 89 f7             	mov    %r14,%rdi
+  8019c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cd:	49 b8 ae 17 80 00 00 	movabs $0x8017ae,%r8
+  8019d4:	00 00 00 
+  8019d7:	41 ff d0             	call   *%r8
+  8019da:	e9 4c fe ff ff       	jmp    80182b <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019eb:	eb a4                	jmp    801991 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019ed:	48 ba 55 5c 80 00 00 	movabs $0x805c55,%rdx
+  8019f4:	00 00 00 
+  8019f7:	4c 89 ee             	mov    %r13,%rsi
+  8019fa:	4c 89 f7             	mov    %r14,%rdi
+  8019fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a02:	49 b8 ae 17 80 00 00 	movabs $0x8017ae,%r8
+  801a09:	00 00 00 
+  801a0c:	41 ff d0             	call   *%r8
+  801a0f:	e9 17 fe ff ff       	jmp    80182b <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a17:	83 f8 2f             	cmp    $0x2f,%eax
+  801a1a:	77 6c                	ja     801a88 <vprintfmt+0x29d>
+  801a1c:	89 c2                	mov    %eax,%edx
+  801a1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a22:	83 c0 08             	add    $0x8,%eax
+  801a25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a28:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a2b:	48 85 f6             	test   %rsi,%rsi
+  801a2e:	48 b8 4e 5c 80 00 00 	movabs $0x805c4e,%rax
+  801a35:	00 00 00 
+  801a38:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a3c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a40:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a44:	7e 06                	jle    801a4c <vprintfmt+0x261>
+  801a46:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a4a:	75 4a                	jne    801a96 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a4c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a50:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a54:	0f b6 00             	movzbl (%rax),%eax
+  801a57:	84 c0                	test   %al,%al
+  801a59:	0f 85 9a 00 00 00    	jne    801af9 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a5f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a62:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	0f 8e bd fd ff ff    	jle    80182b <vprintfmt+0x40>
+  801a6e:	4c 89 ee             	mov    %r13,%rsi
+  801a71:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a76:	41 ff d6             	call   *%r14
+  801a79:	41 83 ec 01          	sub    $0x1,%r12d
+  801a7d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a81:	75 eb                	jne    801a6e <vprintfmt+0x283>
+  801a83:	e9 a3 fd ff ff       	jmp    80182b <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a94:	eb 92                	jmp    801a28 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a96:	49 63 f7             	movslq %r15d,%rsi
+  801a99:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801a9d:	48 b8 af 1f 80 00 00 	movabs $0x801faf,%rax
+  801aa4:	00 00 00 
+  801aa7:	ff d0                	call   *%rax
+  801aa9:	48 89 c2             	mov    %rax,%rdx
+  801aac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801aaf:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ab1:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ab4:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ab7:	85 c0                	test   %eax,%eax
+  801ab9:	7e 91                	jle    801a4c <vprintfmt+0x261>
+  801abb:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ac0:	4c 89 ee             	mov    %r13,%rsi
+  801ac3:	44 89 e7             	mov    %r12d,%edi
+  801ac6:	41 ff d6             	call   *%r14
+  801ac9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801acd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ad0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ad3:	75 eb                	jne    801ac0 <vprintfmt+0x2d5>
+  801ad5:	e9 72 ff ff ff       	jmp    801a4c <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ada:	0f b6 f8             	movzbl %al,%edi
+  801add:	4c 89 ee             	mov    %r13,%rsi
+  801ae0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ae3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ae7:	49 83 c4 01          	add    $0x1,%r12
+  801aeb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801af1:	84 c0                	test   %al,%al
+  801af3:	0f 84 66 ff ff ff    	je     801a5f <vprintfmt+0x274>
+  801af9:	45 85 ff             	test   %r15d,%r15d
+  801afc:	78 0a                	js     801b08 <vprintfmt+0x31d>
+  801afe:	41 83 ef 01          	sub    $0x1,%r15d
+  801b02:	0f 88 57 ff ff ff    	js     801a5f <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b08:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b0c:	74 cc                	je     801ada <vprintfmt+0x2ef>
+  801b0e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b11:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b16:	80 fa 5e             	cmp    $0x5e,%dl
+  801b19:	77 c2                	ja     801add <vprintfmt+0x2f2>
+  801b1b:	eb bd                	jmp    801ada <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b1d:	40 84 f6             	test   %sil,%sil
+  801b20:	75 26                	jne    801b48 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b22:	85 d2                	test   %edx,%edx
+  801b24:	74 59                	je     801b7f <vprintfmt+0x394>
+  801b26:	83 fa 01             	cmp    $0x1,%edx
+  801b29:	74 7b                	je     801ba6 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b2e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b31:	0f 87 96 00 00 00    	ja     801bcd <vprintfmt+0x3e2>
+  801b37:	89 c2                	mov    %eax,%edx
+  801b39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b3d:	83 c0 08             	add    $0x8,%eax
+  801b40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b43:	4c 8b 22             	mov    (%rdx),%r12
+  801b46:	eb 17                	jmp    801b5f <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b4b:	83 f8 2f             	cmp    $0x2f,%eax
+  801b4e:	77 21                	ja     801b71 <vprintfmt+0x386>
+  801b50:	89 c2                	mov    %eax,%edx
+  801b52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b56:	83 c0 08             	add    $0x8,%eax
+  801b59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b5c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b5f:	4d 85 e4             	test   %r12,%r12
+  801b62:	78 7a                	js     801bde <vprintfmt+0x3f3>
+            num = i;
+  801b64:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b67:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b6c:	e9 56 02 00 00       	jmp    801dc7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b7d:	eb dd                	jmp    801b5c <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b82:	83 f8 2f             	cmp    $0x2f,%eax
+  801b85:	77 11                	ja     801b98 <vprintfmt+0x3ad>
+  801b87:	89 c2                	mov    %eax,%edx
+  801b89:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b8d:	83 c0 08             	add    $0x8,%eax
+  801b90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b93:	4c 63 22             	movslq (%rdx),%r12
+  801b96:	eb c7                	jmp    801b5f <vprintfmt+0x374>
+  801b98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba4:	eb ed                	jmp    801b93 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  801bac:	77 11                	ja     801bbf <vprintfmt+0x3d4>
+  801bae:	89 c2                	mov    %eax,%edx
+  801bb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bb4:	83 c0 08             	add    $0x8,%eax
+  801bb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bba:	4c 8b 22             	mov    (%rdx),%r12
+  801bbd:	eb a0                	jmp    801b5f <vprintfmt+0x374>
+  801bbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bcb:	eb ed                	jmp    801bba <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd9:	e9 65 ff ff ff       	jmp    801b43 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bde:	4c 89 ee             	mov    %r13,%rsi
+  801be1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801be6:	41 ff d6             	call   *%r14
+                i = -i;
+  801be9:	49 f7 dc             	neg    %r12
+  801bec:	e9 73 ff ff ff       	jmp    801b64 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bf1:	40 84 f6             	test   %sil,%sil
+  801bf4:	75 2e                	jne    801c24 <vprintfmt+0x439>
+    switch (lflag) {
+  801bf6:	85 d2                	test   %edx,%edx
+  801bf8:	7f 59                	jg     801c53 <vprintfmt+0x468>
+  801bfa:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801bfd:	7d 7a                	jge    801c79 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801bff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c02:	83 f8 2f             	cmp    $0x2f,%eax
+  801c05:	0f 87 aa 00 00 00    	ja     801cb5 <vprintfmt+0x4ca>
+  801c0b:	89 c2                	mov    %eax,%edx
+  801c0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c11:	83 c0 08             	add    $0x8,%eax
+  801c14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c17:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c1a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c1f:	e9 a3 01 00 00       	jmp    801dc7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c27:	83 f8 2f             	cmp    $0x2f,%eax
+  801c2a:	77 19                	ja     801c45 <vprintfmt+0x45a>
+  801c2c:	89 c2                	mov    %eax,%edx
+  801c2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c32:	83 c0 08             	add    $0x8,%eax
+  801c35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c38:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c40:	e9 82 01 00 00       	jmp    801dc7 <vprintfmt+0x5dc>
+  801c45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c51:	eb e5                	jmp    801c38 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c53:	83 fa 01             	cmp    $0x1,%edx
+  801c56:	75 a7                	jne    801bff <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c5b:	83 f8 2f             	cmp    $0x2f,%eax
+  801c5e:	77 47                	ja     801ca7 <vprintfmt+0x4bc>
+  801c60:	89 c2                	mov    %eax,%edx
+  801c62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c66:	83 c0 08             	add    $0x8,%eax
+  801c69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c6c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c6f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c74:	e9 4e 01 00 00       	jmp    801dc7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c7c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c7f:	77 18                	ja     801c99 <vprintfmt+0x4ae>
+  801c81:	89 c2                	mov    %eax,%edx
+  801c83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c87:	83 c0 08             	add    $0x8,%eax
+  801c8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c8d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c8f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c94:	e9 2e 01 00 00       	jmp    801dc7 <vprintfmt+0x5dc>
+  801c99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca5:	eb e6                	jmp    801c8d <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801ca7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801caf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb3:	eb b7                	jmp    801c6c <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cc1:	e9 51 ff ff ff       	jmp    801c17 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cc6:	40 84 f6             	test   %sil,%sil
+  801cc9:	75 2e                	jne    801cf9 <vprintfmt+0x50e>
+    switch (lflag) {
+  801ccb:	85 d2                	test   %edx,%edx
+  801ccd:	7f 59                	jg     801d28 <vprintfmt+0x53d>
+  801ccf:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cd2:	7d 77                	jge    801d4b <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cd7:	83 f8 2f             	cmp    $0x2f,%eax
+  801cda:	0f 87 a4 00 00 00    	ja     801d84 <vprintfmt+0x599>
+  801ce0:	89 c2                	mov    %eax,%edx
+  801ce2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ce6:	83 c0 08             	add    $0x8,%eax
+  801ce9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cef:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cf4:	e9 ce 00 00 00       	jmp    801dc7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cfc:	83 f8 2f             	cmp    $0x2f,%eax
+  801cff:	77 19                	ja     801d1a <vprintfmt+0x52f>
+  801d01:	89 c2                	mov    %eax,%edx
+  801d03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d07:	83 c0 08             	add    $0x8,%eax
+  801d0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d10:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d15:	e9 ad 00 00 00       	jmp    801dc7 <vprintfmt+0x5dc>
+  801d1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d26:	eb e5                	jmp    801d0d <vprintfmt+0x522>
+    switch (lflag) {
+  801d28:	83 fa 01             	cmp    $0x1,%edx
+  801d2b:	75 a7                	jne    801cd4 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d30:	83 f8 2f             	cmp    $0x2f,%eax
+  801d33:	77 41                	ja     801d76 <vprintfmt+0x58b>
+  801d35:	89 c2                	mov    %eax,%edx
+  801d37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d3b:	83 c0 08             	add    $0x8,%eax
+  801d3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d41:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d44:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d49:	eb 7c                	jmp    801dc7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4e:	83 f8 2f             	cmp    $0x2f,%eax
+  801d51:	77 15                	ja     801d68 <vprintfmt+0x57d>
+  801d53:	89 c2                	mov    %eax,%edx
+  801d55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d59:	83 c0 08             	add    $0x8,%eax
+  801d5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d61:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d66:	eb 5f                	jmp    801dc7 <vprintfmt+0x5dc>
+  801d68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d74:	eb e9                	jmp    801d5f <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d82:	eb bd                	jmp    801d41 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d90:	e9 57 ff ff ff       	jmp    801cec <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d95:	4c 89 ee             	mov    %r13,%rsi
+  801d98:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d9d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801da0:	4c 89 ee             	mov    %r13,%rsi
+  801da3:	bf 78 00 00 00       	mov    $0x78,%edi
+  801da8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801dab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dae:	83 f8 2f             	cmp    $0x2f,%eax
+  801db1:	77 47                	ja     801dfa <vprintfmt+0x60f>
+  801db3:	89 c2                	mov    %eax,%edx
+  801db5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801db9:	83 c0 08             	add    $0x8,%eax
+  801dbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dbf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dc2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dc7:	48 83 ec 08          	sub    $0x8,%rsp
+  801dcb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dcf:	0f 94 c0             	sete   %al
+  801dd2:	0f b6 c0             	movzbl %al,%eax
+  801dd5:	50                   	push   %rax
+  801dd6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801ddb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801ddf:	4c 89 ee             	mov    %r13,%rsi
+  801de2:	4c 89 f7             	mov    %r14,%rdi
+  801de5:	48 b8 e0 16 80 00 00 	movabs $0x8016e0,%rax
+  801dec:	00 00 00 
+  801def:	ff d0                	call   *%rax
+            break;
+  801df1:	48 83 c4 10          	add    $0x10,%rsp
+  801df5:	e9 31 fa ff ff       	jmp    80182b <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801dfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e06:	eb b7                	jmp    801dbf <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e08:	40 84 f6             	test   %sil,%sil
+  801e0b:	75 2b                	jne    801e38 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e0d:	85 d2                	test   %edx,%edx
+  801e0f:	7f 56                	jg     801e67 <vprintfmt+0x67c>
+  801e11:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e14:	7d 77                	jge    801e8d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e19:	83 f8 2f             	cmp    $0x2f,%eax
+  801e1c:	0f 87 a7 00 00 00    	ja     801ec9 <vprintfmt+0x6de>
+  801e22:	89 c2                	mov    %eax,%edx
+  801e24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e28:	83 c0 08             	add    $0x8,%eax
+  801e2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e31:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e36:	eb 8f                	jmp    801dc7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e3e:	77 19                	ja     801e59 <vprintfmt+0x66e>
+  801e40:	89 c2                	mov    %eax,%edx
+  801e42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e46:	83 c0 08             	add    $0x8,%eax
+  801e49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e4c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e4f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e54:	e9 6e ff ff ff       	jmp    801dc7 <vprintfmt+0x5dc>
+  801e59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e65:	eb e5                	jmp    801e4c <vprintfmt+0x661>
+    switch (lflag) {
+  801e67:	83 fa 01             	cmp    $0x1,%edx
+  801e6a:	75 aa                	jne    801e16 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e6f:	83 f8 2f             	cmp    $0x2f,%eax
+  801e72:	77 47                	ja     801ebb <vprintfmt+0x6d0>
+  801e74:	89 c2                	mov    %eax,%edx
+  801e76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e7a:	83 c0 08             	add    $0x8,%eax
+  801e7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e80:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e83:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e88:	e9 3a ff ff ff       	jmp    801dc7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e90:	83 f8 2f             	cmp    $0x2f,%eax
+  801e93:	77 18                	ja     801ead <vprintfmt+0x6c2>
+  801e95:	89 c2                	mov    %eax,%edx
+  801e97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e9b:	83 c0 08             	add    $0x8,%eax
+  801e9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ea1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ea3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ea8:	e9 1a ff ff ff       	jmp    801dc7 <vprintfmt+0x5dc>
+  801ead:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb9:	eb e6                	jmp    801ea1 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ebb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ebf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec7:	eb b7                	jmp    801e80 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ec9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ecd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed5:	e9 54 ff ff ff       	jmp    801e2e <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801eda:	4c 89 ee             	mov    %r13,%rsi
+  801edd:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ee2:	41 ff d6             	call   *%r14
+            break;
+  801ee5:	e9 41 f9 ff ff       	jmp    80182b <vprintfmt+0x40>
+            putch('%', put_arg);
+  801eea:	4c 89 ee             	mov    %r13,%rsi
+  801eed:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ef2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ef5:	48 83 eb 01          	sub    $0x1,%rbx
+  801ef9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801efd:	75 f6                	jne    801ef5 <vprintfmt+0x70a>
+  801eff:	e9 27 f9 ff ff       	jmp    80182b <vprintfmt+0x40>
+
+0000000000801f04 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f10:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f15:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f19:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f20:	48 85 ff             	test   %rdi,%rdi
+  801f23:	74 2b                	je     801f50 <vsnprintf+0x4c>
+  801f25:	48 85 f6             	test   %rsi,%rsi
+  801f28:	74 26                	je     801f50 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f2a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f2e:	48 bf 96 17 80 00 00 	movabs $0x801796,%rdi
+  801f35:	00 00 00 
+  801f38:	48 b8 eb 17 80 00 00 	movabs $0x8017eb,%rax
+  801f3f:	00 00 00 
+  801f42:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f48:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f4b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f4e:	c9                   	leave
+  801f4f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f55:	eb f7                	jmp    801f4e <vsnprintf+0x4a>
+
+0000000000801f57 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f57:	55                   	push   %rbp
+  801f58:	48 89 e5             	mov    %rsp,%rbp
+  801f5b:	48 83 ec 50          	sub    $0x50,%rsp
+  801f5f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f63:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f67:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f6b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f7e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f82:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f86:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  801f8d:	00 00 00 
+  801f90:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+
+0000000000801f94 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f94:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f97:	74 10                	je     801fa9 <strlen+0x15>
+    size_t n = 0;
+  801f99:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801f9e:	48 83 c0 01          	add    $0x1,%rax
+  801fa2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fa6:	75 f6                	jne    801f9e <strlen+0xa>
+  801fa8:	c3                   	ret
+    size_t n = 0;
+  801fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fae:	c3                   	ret
+
+0000000000801faf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801faf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fb2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fb7:	48 85 f6             	test   %rsi,%rsi
+  801fba:	74 11                	je     801fcd <strnlen+0x1e>
+  801fbc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fc0:	74 0c                	je     801fce <strnlen+0x1f>
+  801fc2:	48 83 c2 01          	add    $0x1,%rdx
+  801fc6:	48 39 d0             	cmp    %rdx,%rax
+  801fc9:	75 f1                	jne    801fbc <strnlen+0xd>
+  801fcb:	eb 04                	jmp    801fd1 <strnlen+0x22>
+  801fcd:	c3                   	ret
+  801fce:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fd1:	c3                   	ret
+
+0000000000801fd2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fd2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fda:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fde:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fe1:	48 83 c2 01          	add    $0x1,%rdx
+  801fe5:	84 c9                	test   %cl,%cl
+  801fe7:	75 f1                	jne    801fda <strcpy+0x8>
+        ;
+    return res;
+}
+  801fe9:	c3                   	ret
+
+0000000000801fea <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fea:	55                   	push   %rbp
+  801feb:	48 89 e5             	mov    %rsp,%rbp
+  801fee:	41 54                	push   %r12
+  801ff0:	53                   	push   %rbx
+  801ff1:	48 89 fb             	mov    %rdi,%rbx
+  801ff4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801ff7:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  801ffe:	00 00 00 
+  802001:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802003:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802007:	4c 89 e6             	mov    %r12,%rsi
+  80200a:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  802011:	00 00 00 
+  802014:	ff d0                	call   *%rax
+    return dst;
+}
+  802016:	48 89 d8             	mov    %rbx,%rax
+  802019:	5b                   	pop    %rbx
+  80201a:	41 5c                	pop    %r12
+  80201c:	5d                   	pop    %rbp
+  80201d:	c3                   	ret
+
+000000000080201e <toupper>:
+
+int
+toupper(int ch) {
+  80201e:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802020:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802023:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802026:	83 f9 1a             	cmp    $0x1a,%ecx
+  802029:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80202c:	c3                   	ret
+
+000000000080202d <tolower>:
+
+int
+tolower(int ch) {
+  80202d:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80202f:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802032:	8d 57 20             	lea    0x20(%rdi),%edx
+  802035:	83 f9 1a             	cmp    $0x1a,%ecx
+  802038:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80203b:	c3                   	ret
+
+000000000080203c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80203c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80203f:	48 85 d2             	test   %rdx,%rdx
+  802042:	74 1f                	je     802063 <strncpy+0x27>
+  802044:	48 01 fa             	add    %rdi,%rdx
+  802047:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80204a:	48 83 c1 01          	add    $0x1,%rcx
+  80204e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802052:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802056:	41 80 f8 01          	cmp    $0x1,%r8b
+  80205a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80205e:	48 39 ca             	cmp    %rcx,%rdx
+  802061:	75 e7                	jne    80204a <strncpy+0xe>
+    }
+    return ret;
+}
+  802063:	c3                   	ret
+
+0000000000802064 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802064:	48 89 f8             	mov    %rdi,%rax
+  802067:	48 85 d2             	test   %rdx,%rdx
+  80206a:	74 24                	je     802090 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80206c:	48 83 ea 01          	sub    $0x1,%rdx
+  802070:	74 1b                	je     80208d <strlcpy+0x29>
+  802072:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802076:	0f b6 16             	movzbl (%rsi),%edx
+  802079:	84 d2                	test   %dl,%dl
+  80207b:	74 10                	je     80208d <strlcpy+0x29>
+            *dst++ = *src++;
+  80207d:	48 83 c6 01          	add    $0x1,%rsi
+  802081:	48 83 c0 01          	add    $0x1,%rax
+  802085:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802088:	48 39 c8             	cmp    %rcx,%rax
+  80208b:	75 e9                	jne    802076 <strlcpy+0x12>
+        *dst = '\0';
+  80208d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802090:	48 29 f8             	sub    %rdi,%rax
+}
+  802093:	c3                   	ret
+
+0000000000802094 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802094:	0f b6 07             	movzbl (%rdi),%eax
+  802097:	84 c0                	test   %al,%al
+  802099:	74 13                	je     8020ae <strcmp+0x1a>
+  80209b:	38 06                	cmp    %al,(%rsi)
+  80209d:	75 0f                	jne    8020ae <strcmp+0x1a>
+  80209f:	48 83 c7 01          	add    $0x1,%rdi
+  8020a3:	48 83 c6 01          	add    $0x1,%rsi
+  8020a7:	0f b6 07             	movzbl (%rdi),%eax
+  8020aa:	84 c0                	test   %al,%al
+  8020ac:	75 ed                	jne    80209b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020ae:	0f b6 c0             	movzbl %al,%eax
+  8020b1:	0f b6 16             	movzbl (%rsi),%edx
+  8020b4:	29 d0                	sub    %edx,%eax
+}
+  8020b6:	c3                   	ret
+
+00000000008020b7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020b7:	48 85 d2             	test   %rdx,%rdx
+  8020ba:	74 1f                	je     8020db <strncmp+0x24>
+  8020bc:	0f b6 07             	movzbl (%rdi),%eax
+  8020bf:	84 c0                	test   %al,%al
+  8020c1:	74 1e                	je     8020e1 <strncmp+0x2a>
+  8020c3:	3a 06                	cmp    (%rsi),%al
+  8020c5:	75 1a                	jne    8020e1 <strncmp+0x2a>
+  8020c7:	48 83 c7 01          	add    $0x1,%rdi
+  8020cb:	48 83 c6 01          	add    $0x1,%rsi
+  8020cf:	48 83 ea 01          	sub    $0x1,%rdx
+  8020d3:	75 e7                	jne    8020bc <strncmp+0x5>
+
+    if (!n) return 0;
+  8020d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020da:	c3                   	ret
+  8020db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e0:	c3                   	ret
+  8020e1:	48 85 d2             	test   %rdx,%rdx
+  8020e4:	74 09                	je     8020ef <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020e6:	0f b6 07             	movzbl (%rdi),%eax
+  8020e9:	0f b6 16             	movzbl (%rsi),%edx
+  8020ec:	29 d0                	sub    %edx,%eax
+  8020ee:	c3                   	ret
+    if (!n) return 0;
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f4:	c3                   	ret
+
+00000000008020f5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020f5:	0f b6 17             	movzbl (%rdi),%edx
+  8020f8:	84 d2                	test   %dl,%dl
+  8020fa:	74 18                	je     802114 <strchr+0x1f>
+        if (*str == c) {
+  8020fc:	0f be d2             	movsbl %dl,%edx
+  8020ff:	39 f2                	cmp    %esi,%edx
+  802101:	74 17                	je     80211a <strchr+0x25>
+    for (; *str; str++) {
+  802103:	48 83 c7 01          	add    $0x1,%rdi
+  802107:	0f b6 17             	movzbl (%rdi),%edx
+  80210a:	84 d2                	test   %dl,%dl
+  80210c:	75 ee                	jne    8020fc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80210e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802113:	c3                   	ret
+  802114:	b8 00 00 00 00       	mov    $0x0,%eax
+  802119:	c3                   	ret
+  80211a:	48 89 f8             	mov    %rdi,%rax
+}
+  80211d:	c3                   	ret
+
+000000000080211e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80211e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802121:	0f b6 17             	movzbl (%rdi),%edx
+  802124:	84 d2                	test   %dl,%dl
+  802126:	74 13                	je     80213b <strfind+0x1d>
+  802128:	0f be d2             	movsbl %dl,%edx
+  80212b:	39 f2                	cmp    %esi,%edx
+  80212d:	74 0b                	je     80213a <strfind+0x1c>
+  80212f:	48 83 c0 01          	add    $0x1,%rax
+  802133:	0f b6 10             	movzbl (%rax),%edx
+  802136:	84 d2                	test   %dl,%dl
+  802138:	75 ee                	jne    802128 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80213a:	c3                   	ret
+  80213b:	c3                   	ret
+
+000000000080213c <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80213c:	48 39 f7             	cmp    %rsi,%rdi
+  80213f:	74 65                	je     8021a6 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802141:	55                   	push   %rbp
+  802142:	48 89 e5             	mov    %rsp,%rbp
+  802145:	41 57                	push   %r15
+  802147:	41 56                	push   %r14
+  802149:	41 55                	push   %r13
+  80214b:	41 54                	push   %r12
+  80214d:	53                   	push   %rbx
+  80214e:	48 83 ec 18          	sub    $0x18,%rsp
+  802152:	48 89 fb             	mov    %rdi,%rbx
+  802155:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802158:	49 bf 2d 20 80 00 00 	movabs $0x80202d,%r15
+  80215f:	00 00 00 
+  802162:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802166:	41 0f b6 fd          	movzbl %r13b,%edi
+  80216a:	41 ff d7             	call   *%r15
+  80216d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802170:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802175:	41 0f b6 fe          	movzbl %r14b,%edi
+  802179:	41 ff d7             	call   *%r15
+  80217c:	89 c2                	mov    %eax,%edx
+  80217e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802181:	29 d0                	sub    %edx,%eax
+  802183:	75 12                	jne    802197 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802185:	48 83 c3 01          	add    $0x1,%rbx
+  802189:	45 84 ed             	test   %r13b,%r13b
+  80218c:	74 09                	je     802197 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80218e:	49 83 c4 01          	add    $0x1,%r12
+  802192:	45 84 f6             	test   %r14b,%r14b
+  802195:	75 cb                	jne    802162 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802197:	48 83 c4 18          	add    $0x18,%rsp
+  80219b:	5b                   	pop    %rbx
+  80219c:	41 5c                	pop    %r12
+  80219e:	41 5d                	pop    %r13
+  8021a0:	41 5e                	pop    %r14
+  8021a2:	41 5f                	pop    %r15
+  8021a4:	5d                   	pop    %rbp
+  8021a5:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ab:	c3                   	ret
+
+00000000008021ac <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021ac:	48 39 f7             	cmp    %rsi,%rdi
+  8021af:	74 7d                	je     80222e <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021b1:	55                   	push   %rbp
+  8021b2:	48 89 e5             	mov    %rsp,%rbp
+  8021b5:	41 57                	push   %r15
+  8021b7:	41 56                	push   %r14
+  8021b9:	41 55                	push   %r13
+  8021bb:	41 54                	push   %r12
+  8021bd:	53                   	push   %rbx
+  8021be:	48 83 ec 18          	sub    $0x18,%rsp
+  8021c2:	48 89 fb             	mov    %rdi,%rbx
+  8021c5:	49 89 f4             	mov    %rsi,%r12
+  8021c8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021d0:	49 bf 2d 20 80 00 00 	movabs $0x80202d,%r15
+  8021d7:	00 00 00 
+    while (n--) {
+  8021da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021de:	48 39 c3             	cmp    %rax,%rbx
+  8021e1:	74 37                	je     80221a <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021e3:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021e7:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021eb:	41 ff d7             	call   *%r15
+  8021ee:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021f1:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021f6:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021fa:	41 ff d7             	call   *%r15
+  8021fd:	89 c2                	mov    %eax,%edx
+  8021ff:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802202:	29 d0                	sub    %edx,%eax
+  802204:	75 19                	jne    80221f <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802206:	48 83 c3 01          	add    $0x1,%rbx
+  80220a:	45 84 ed             	test   %r13b,%r13b
+  80220d:	74 10                	je     80221f <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80220f:	49 83 c4 01          	add    $0x1,%r12
+  802213:	45 84 f6             	test   %r14b,%r14b
+  802216:	75 c2                	jne    8021da <strncasecmp+0x2e>
+  802218:	eb 05                	jmp    80221f <strncasecmp+0x73>
+  80221a:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80221f:	48 83 c4 18          	add    $0x18,%rsp
+  802223:	5b                   	pop    %rbx
+  802224:	41 5c                	pop    %r12
+  802226:	41 5d                	pop    %r13
+  802228:	41 5e                	pop    %r14
+  80222a:	41 5f                	pop    %r15
+  80222c:	5d                   	pop    %rbp
+  80222d:	c3                   	ret
+    if (p1 == p2) return 0;
+  80222e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802233:	c3                   	ret
+
+0000000000802234 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802234:	83 e7 df             	and    $0xffffffdf,%edi
+  802237:	83 ef 41             	sub    $0x41,%edi
+  80223a:	83 ff 19             	cmp    $0x19,%edi
+  80223d:	0f 96 c0             	setbe  %al
+}
+  802240:	c3                   	ret
+
+0000000000802241 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802241:	83 ff 20             	cmp    $0x20,%edi
+  802244:	0f 94 c0             	sete   %al
+  802247:	83 ff 09             	cmp    $0x9,%edi
+  80224a:	0f 94 c2             	sete   %dl
+  80224d:	09 d0                	or     %edx,%eax
+}
+  80224f:	c3                   	ret
+
+0000000000802250 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802256:	48 bf 3f 61 80 00 00 	movabs $0x80613f,%rdi
+  80225d:	00 00 00 
+  802260:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	48 85 c0             	test   %rax,%rax
+  80226f:	0f 95 c0             	setne  %al
+}
+  802272:	5d                   	pop    %rbp
+  802273:	c3                   	ret
+
+0000000000802274 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802274:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802277:	48 89 f8             	mov    %rdi,%rax
+  80227a:	48 f7 d8             	neg    %rax
+  80227d:	83 e0 07             	and    $0x7,%eax
+  802280:	49 89 d1             	mov    %rdx,%r9
+  802283:	49 29 c1             	sub    %rax,%r9
+  802286:	78 36                	js     8022be <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802288:	40 0f b6 c6          	movzbl %sil,%eax
+  80228c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802293:	01 01 01 
+  802296:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80229a:	40 f6 c7 07          	test   $0x7,%dil
+  80229e:	75 38                	jne    8022d8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022a0:	4c 89 c9             	mov    %r9,%rcx
+  8022a3:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022a7:	74 0c                	je     8022b5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022a9:	fc                   	cld
+  8022aa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022ad:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022b1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022b5:	4d 85 c9             	test   %r9,%r9
+  8022b8:	75 45                	jne    8022ff <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022ba:	4c 89 c0             	mov    %r8,%rax
+  8022bd:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022be:	48 85 d2             	test   %rdx,%rdx
+  8022c1:	74 f7                	je     8022ba <memset+0x46>
+  8022c3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022c6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022c9:	48 83 c0 01          	add    $0x1,%rax
+  8022cd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022d1:	48 39 c2             	cmp    %rax,%rdx
+  8022d4:	75 f3                	jne    8022c9 <memset+0x55>
+  8022d6:	eb e2                	jmp    8022ba <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022d8:	40 f6 c7 01          	test   $0x1,%dil
+  8022dc:	74 06                	je     8022e4 <memset+0x70>
+  8022de:	88 07                	mov    %al,(%rdi)
+  8022e0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022e4:	40 f6 c7 02          	test   $0x2,%dil
+  8022e8:	74 07                	je     8022f1 <memset+0x7d>
+  8022ea:	66 89 07             	mov    %ax,(%rdi)
+  8022ed:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022f1:	40 f6 c7 04          	test   $0x4,%dil
+  8022f5:	74 a9                	je     8022a0 <memset+0x2c>
+  8022f7:	89 07                	mov    %eax,(%rdi)
+  8022f9:	48 83 c7 04          	add    $0x4,%rdi
+  8022fd:	eb a1                	jmp    8022a0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022ff:	41 f6 c1 04          	test   $0x4,%r9b
+  802303:	74 06                	je     80230b <memset+0x97>
+  802305:	89 07                	mov    %eax,(%rdi)
+  802307:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80230b:	41 f6 c1 02          	test   $0x2,%r9b
+  80230f:	74 07                	je     802318 <memset+0xa4>
+  802311:	66 89 07             	mov    %ax,(%rdi)
+  802314:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802318:	41 f6 c1 01          	test   $0x1,%r9b
+  80231c:	74 9c                	je     8022ba <memset+0x46>
+  80231e:	88 07                	mov    %al,(%rdi)
+  802320:	eb 98                	jmp    8022ba <memset+0x46>
+
+0000000000802322 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802322:	48 89 f8             	mov    %rdi,%rax
+  802325:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802328:	48 39 fe             	cmp    %rdi,%rsi
+  80232b:	73 3b                	jae    802368 <memmove+0x46>
+  80232d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802331:	48 39 d7             	cmp    %rdx,%rdi
+  802334:	73 32                	jae    802368 <memmove+0x46>
+        s += n;
+        d += n;
+  802336:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80233a:	48 89 d6             	mov    %rdx,%rsi
+  80233d:	48 09 fe             	or     %rdi,%rsi
+  802340:	48 09 ce             	or     %rcx,%rsi
+  802343:	40 f6 c6 07          	test   $0x7,%sil
+  802347:	75 12                	jne    80235b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802349:	48 83 ef 08          	sub    $0x8,%rdi
+  80234d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802351:	48 c1 e9 03          	shr    $0x3,%rcx
+  802355:	fd                   	std
+  802356:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802359:	fc                   	cld
+  80235a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80235b:	48 83 ef 01          	sub    $0x1,%rdi
+  80235f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802363:	fd                   	std
+  802364:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802366:	eb f1                	jmp    802359 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802368:	48 89 f2             	mov    %rsi,%rdx
+  80236b:	48 09 c2             	or     %rax,%rdx
+  80236e:	48 09 ca             	or     %rcx,%rdx
+  802371:	f6 c2 07             	test   $0x7,%dl
+  802374:	75 0c                	jne    802382 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802376:	48 c1 e9 03          	shr    $0x3,%rcx
+  80237a:	48 89 c7             	mov    %rax,%rdi
+  80237d:	fc                   	cld
+  80237e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802381:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802382:	48 89 c7             	mov    %rax,%rdi
+  802385:	fc                   	cld
+  802386:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802388:	c3                   	ret
+
+0000000000802389 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802389:	55                   	push   %rbp
+  80238a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80238d:	48 b8 22 23 80 00 00 	movabs $0x802322,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+}
+  802399:	5d                   	pop    %rbp
+  80239a:	c3                   	ret
+
+000000000080239b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80239b:	55                   	push   %rbp
+  80239c:	48 89 e5             	mov    %rsp,%rbp
+  80239f:	41 57                	push   %r15
+  8023a1:	41 56                	push   %r14
+  8023a3:	41 55                	push   %r13
+  8023a5:	41 54                	push   %r12
+  8023a7:	53                   	push   %rbx
+  8023a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ac:	49 89 fe             	mov    %rdi,%r14
+  8023af:	49 89 f7             	mov    %rsi,%r15
+  8023b2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023b5:	48 89 f7             	mov    %rsi,%rdi
+  8023b8:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+  8023c4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023c7:	48 89 de             	mov    %rbx,%rsi
+  8023ca:	4c 89 f7             	mov    %r14,%rdi
+  8023cd:	48 b8 af 1f 80 00 00 	movabs $0x801faf,%rax
+  8023d4:	00 00 00 
+  8023d7:	ff d0                	call   *%rax
+  8023d9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023dc:	48 39 c3             	cmp    %rax,%rbx
+  8023df:	74 36                	je     802417 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023e1:	48 89 d8             	mov    %rbx,%rax
+  8023e4:	4c 29 e8             	sub    %r13,%rax
+  8023e7:	49 39 c4             	cmp    %rax,%r12
+  8023ea:	73 31                	jae    80241d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023ec:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023f1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023f5:	4c 89 fe             	mov    %r15,%rsi
+  8023f8:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8023ff:	00 00 00 
+  802402:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802404:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802408:	48 83 c4 08          	add    $0x8,%rsp
+  80240c:	5b                   	pop    %rbx
+  80240d:	41 5c                	pop    %r12
+  80240f:	41 5d                	pop    %r13
+  802411:	41 5e                	pop    %r14
+  802413:	41 5f                	pop    %r15
+  802415:	5d                   	pop    %rbp
+  802416:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802417:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80241b:	eb eb                	jmp    802408 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80241d:	48 83 eb 01          	sub    $0x1,%rbx
+  802421:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802425:	48 89 da             	mov    %rbx,%rdx
+  802428:	4c 89 fe             	mov    %r15,%rsi
+  80242b:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802437:	49 01 de             	add    %rbx,%r14
+  80243a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80243f:	eb c3                	jmp    802404 <strlcat+0x69>
+
+0000000000802441 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802441:	48 85 d2             	test   %rdx,%rdx
+  802444:	74 2d                	je     802473 <memcmp+0x32>
+  802446:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80244b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80244f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802454:	44 38 c1             	cmp    %r8b,%cl
+  802457:	75 0f                	jne    802468 <memcmp+0x27>
+    while (n-- > 0) {
+  802459:	48 83 c0 01          	add    $0x1,%rax
+  80245d:	48 39 c2             	cmp    %rax,%rdx
+  802460:	75 e9                	jne    80244b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802462:	b8 00 00 00 00       	mov    $0x0,%eax
+  802467:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802468:	0f b6 c1             	movzbl %cl,%eax
+  80246b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80246f:	44 29 c0             	sub    %r8d,%eax
+  802472:	c3                   	ret
+    return 0;
+  802473:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802478:	c3                   	ret
+
+0000000000802479 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802479:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80247d:	48 39 c7             	cmp    %rax,%rdi
+  802480:	73 0f                	jae    802491 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802482:	40 38 37             	cmp    %sil,(%rdi)
+  802485:	74 0e                	je     802495 <memfind+0x1c>
+    for (; src < end; src++) {
+  802487:	48 83 c7 01          	add    $0x1,%rdi
+  80248b:	48 39 f8             	cmp    %rdi,%rax
+  80248e:	75 f2                	jne    802482 <memfind+0x9>
+  802490:	c3                   	ret
+  802491:	48 89 f8             	mov    %rdi,%rax
+  802494:	c3                   	ret
+  802495:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802498:	c3                   	ret
+
+0000000000802499 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802499:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80249c:	0f b6 37             	movzbl (%rdi),%esi
+  80249f:	40 80 fe 20          	cmp    $0x20,%sil
+  8024a3:	74 06                	je     8024ab <strtol+0x12>
+  8024a5:	40 80 fe 09          	cmp    $0x9,%sil
+  8024a9:	75 13                	jne    8024be <strtol+0x25>
+  8024ab:	48 83 c7 01          	add    $0x1,%rdi
+  8024af:	0f b6 37             	movzbl (%rdi),%esi
+  8024b2:	40 80 fe 20          	cmp    $0x20,%sil
+  8024b6:	74 f3                	je     8024ab <strtol+0x12>
+  8024b8:	40 80 fe 09          	cmp    $0x9,%sil
+  8024bc:	74 ed                	je     8024ab <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024be:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024c1:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024c4:	3c 01                	cmp    $0x1,%al
+  8024c6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024ca:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024d0:	75 0f                	jne    8024e1 <strtol+0x48>
+  8024d2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024d5:	74 14                	je     8024eb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024d7:	85 d2                	test   %edx,%edx
+  8024d9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024de:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024e1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024e6:	4c 63 ca             	movslq %edx,%r9
+  8024e9:	eb 36                	jmp    802521 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024eb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024ef:	74 0f                	je     802500 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024f1:	85 d2                	test   %edx,%edx
+  8024f3:	75 ec                	jne    8024e1 <strtol+0x48>
+        s++;
+  8024f5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024f9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8024fe:	eb e1                	jmp    8024e1 <strtol+0x48>
+        s += 2;
+  802500:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802504:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802509:	eb d6                	jmp    8024e1 <strtol+0x48>
+            dig -= '0';
+  80250b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80250e:	44 0f b6 c1          	movzbl %cl,%r8d
+  802512:	41 39 d0             	cmp    %edx,%r8d
+  802515:	7d 21                	jge    802538 <strtol+0x9f>
+        val = val * base + dig;
+  802517:	49 0f af c1          	imul   %r9,%rax
+  80251b:	0f b6 c9             	movzbl %cl,%ecx
+  80251e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802521:	48 83 c7 01          	add    $0x1,%rdi
+  802525:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802529:	80 f9 39             	cmp    $0x39,%cl
+  80252c:	76 dd                	jbe    80250b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80252e:	80 f9 7b             	cmp    $0x7b,%cl
+  802531:	77 05                	ja     802538 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802533:	83 e9 57             	sub    $0x57,%ecx
+  802536:	eb d6                	jmp    80250e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802538:	4d 85 d2             	test   %r10,%r10
+  80253b:	74 03                	je     802540 <strtol+0xa7>
+  80253d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802540:	48 89 c2             	mov    %rax,%rdx
+  802543:	48 f7 da             	neg    %rdx
+  802546:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80254a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80254e:	c3                   	ret
+
+000000000080254f <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80254f:	55                   	push   %rbp
+  802550:	48 89 e5             	mov    %rsp,%rbp
+  802553:	53                   	push   %rbx
+  802554:	48 89 fa             	mov    %rdi,%rdx
+  802557:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80255a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80255f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802564:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802569:	be 00 00 00 00       	mov    $0x0,%esi
+  80256e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802574:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80257a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80257c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802580:	c9                   	leave
+  802581:	c3                   	ret
+
+0000000000802582 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802582:	55                   	push   %rbp
+  802583:	48 89 e5             	mov    %rsp,%rbp
+  802586:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802587:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80258c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802591:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802596:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80259b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025b1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025b7:	c9                   	leave
+  8025b8:	c3                   	ret
+
+00000000008025b9 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025b9:	55                   	push   %rbp
+  8025ba:	48 89 e5             	mov    %rsp,%rbp
+  8025bd:	53                   	push   %rbx
+  8025be:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025c1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025e6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ec:	c9                   	leave
+  8025ed:	c3                   	ret
+
+00000000008025ee <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025ee:	55                   	push   %rbp
+  8025ef:	48 89 e5             	mov    %rsp,%rbp
+  8025f2:	53                   	push   %rbx
+  8025f3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025fa:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80260e:	be 00 00 00 00       	mov    $0x0,%esi
+  802613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802619:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80261f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802621:	48 85 c0             	test   %rax,%rax
+  802624:	7f 06                	jg     80262c <sys_env_destroy+0x3e>
+}
+  802626:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80262a:	c9                   	leave
+  80262b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80262c:	49 89 c0             	mov    %rax,%r8
+  80262f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802634:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80263b:	00 00 00 
+  80263e:	be 27 00 00 00       	mov    $0x27,%esi
+  802643:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80264a:	00 00 00 
+  80264d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802652:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802659:	00 00 00 
+  80265c:	41 ff d1             	call   *%r9
+
+000000000080265f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80265f:	55                   	push   %rbp
+  802660:	48 89 e5             	mov    %rsp,%rbp
+  802663:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802664:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802669:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802673:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802678:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80267d:	be 00 00 00 00       	mov    $0x0,%esi
+  802682:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802688:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80268e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802690:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802694:	c9                   	leave
+  802695:	c3                   	ret
+
+0000000000802696 <sys_yield>:
+
+void
+sys_yield(void) {
+  802696:	55                   	push   %rbp
+  802697:	48 89 e5             	mov    %rsp,%rbp
+  80269a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80269b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026c5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026cb:	c9                   	leave
+  8026cc:	c3                   	ret
+
+00000000008026cd <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026cd:	55                   	push   %rbp
+  8026ce:	48 89 e5             	mov    %rsp,%rbp
+  8026d1:	53                   	push   %rbx
+  8026d2:	48 89 fa             	mov    %rdi,%rdx
+  8026d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026d8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026dd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026e4:	00 00 00 
+  8026e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026fd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8026ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802703:	c9                   	leave
+  802704:	c3                   	ret
+
+0000000000802705 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802705:	55                   	push   %rbp
+  802706:	48 89 e5             	mov    %rsp,%rbp
+  802709:	53                   	push   %rbx
+  80270a:	49 89 f8             	mov    %rdi,%r8
+  80270d:	48 89 d3             	mov    %rdx,%rbx
+  802710:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802713:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802718:	4c 89 c2             	mov    %r8,%rdx
+  80271b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80271e:	be 00 00 00 00       	mov    $0x0,%esi
+  802723:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802729:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80272f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802731:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802735:	c9                   	leave
+  802736:	c3                   	ret
+
+0000000000802737 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802737:	55                   	push   %rbp
+  802738:	48 89 e5             	mov    %rsp,%rbp
+  80273b:	53                   	push   %rbx
+  80273c:	48 83 ec 08          	sub    $0x8,%rsp
+  802740:	89 f8                	mov    %edi,%eax
+  802742:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802745:	48 63 f9             	movslq %ecx,%rdi
+  802748:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80274b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802750:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802753:	be 00 00 00 00       	mov    $0x0,%esi
+  802758:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80275e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802764:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802766:	48 85 c0             	test   %rax,%rax
+  802769:	7f 06                	jg     802771 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80276b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80276f:	c9                   	leave
+  802770:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802771:	49 89 c0             	mov    %rax,%r8
+  802774:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802779:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802780:	00 00 00 
+  802783:	be 27 00 00 00       	mov    $0x27,%esi
+  802788:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80278f:	00 00 00 
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+  802797:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  80279e:	00 00 00 
+  8027a1:	41 ff d1             	call   *%r9
+
+00000000008027a4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027a4:	55                   	push   %rbp
+  8027a5:	48 89 e5             	mov    %rsp,%rbp
+  8027a8:	53                   	push   %rbx
+  8027a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ad:	89 f8                	mov    %edi,%eax
+  8027af:	49 89 f2             	mov    %rsi,%r10
+  8027b2:	48 89 cf             	mov    %rcx,%rdi
+  8027b5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027b8:	48 63 da             	movslq %edx,%rbx
+  8027bb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027be:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027c3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c6:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027d1:	48 85 c0             	test   %rax,%rax
+  8027d4:	7f 06                	jg     8027dc <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027da:	c9                   	leave
+  8027db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027dc:	49 89 c0             	mov    %rax,%r8
+  8027df:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027e4:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8027eb:	00 00 00 
+  8027ee:	be 27 00 00 00       	mov    $0x27,%esi
+  8027f3:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8027fa:	00 00 00 
+  8027fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802802:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802809:	00 00 00 
+  80280c:	41 ff d1             	call   *%r9
+
+000000000080280f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80280f:	55                   	push   %rbp
+  802810:	48 89 e5             	mov    %rsp,%rbp
+  802813:	53                   	push   %rbx
+  802814:	48 83 ec 08          	sub    $0x8,%rsp
+  802818:	48 89 f1             	mov    %rsi,%rcx
+  80281b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  80281e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802821:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802826:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80282b:	be 00 00 00 00       	mov    $0x0,%esi
+  802830:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802836:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80283c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80283e:	48 85 c0             	test   %rax,%rax
+  802841:	7f 06                	jg     802849 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802843:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802847:	c9                   	leave
+  802848:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802849:	49 89 c0             	mov    %rax,%r8
+  80284c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802851:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802858:	00 00 00 
+  80285b:	be 27 00 00 00       	mov    $0x27,%esi
+  802860:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802867:	00 00 00 
+  80286a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286f:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802876:	00 00 00 
+  802879:	41 ff d1             	call   *%r9
+
+000000000080287c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80287c:	55                   	push   %rbp
+  80287d:	48 89 e5             	mov    %rsp,%rbp
+  802880:	53                   	push   %rbx
+  802881:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802885:	48 63 ce             	movslq %esi,%rcx
+  802888:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80288b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802890:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802895:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80289a:	be 00 00 00 00       	mov    $0x0,%esi
+  80289f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028ad:	48 85 c0             	test   %rax,%rax
+  8028b0:	7f 06                	jg     8028b8 <sys_env_set_status+0x3c>
+}
+  8028b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b6:	c9                   	leave
+  8028b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028b8:	49 89 c0             	mov    %rax,%r8
+  8028bb:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028c0:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8028c7:	00 00 00 
+  8028ca:	be 27 00 00 00       	mov    $0x27,%esi
+  8028cf:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8028d6:	00 00 00 
+  8028d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028de:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  8028e5:	00 00 00 
+  8028e8:	41 ff d1             	call   *%r9
+
+00000000008028eb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028eb:	55                   	push   %rbp
+  8028ec:	48 89 e5             	mov    %rsp,%rbp
+  8028ef:	53                   	push   %rbx
+  8028f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802904:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802909:	be 00 00 00 00       	mov    $0x0,%esi
+  80290e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802914:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80291a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80291c:	48 85 c0             	test   %rax,%rax
+  80291f:	7f 06                	jg     802927 <sys_env_set_trapframe+0x3c>
+}
+  802921:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802925:	c9                   	leave
+  802926:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802927:	49 89 c0             	mov    %rax,%r8
+  80292a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80292f:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802936:	00 00 00 
+  802939:	be 27 00 00 00       	mov    $0x27,%esi
+  80293e:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802945:	00 00 00 
+  802948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294d:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802954:	00 00 00 
+  802957:	41 ff d1             	call   *%r9
+
+000000000080295a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80295a:	55                   	push   %rbp
+  80295b:	48 89 e5             	mov    %rsp,%rbp
+  80295e:	53                   	push   %rbx
+  80295f:	48 83 ec 08          	sub    $0x8,%rsp
+  802963:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802966:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802969:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80296e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802973:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802978:	be 00 00 00 00       	mov    $0x0,%esi
+  80297d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802983:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802989:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80298b:	48 85 c0             	test   %rax,%rax
+  80298e:	7f 06                	jg     802996 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802990:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802994:	c9                   	leave
+  802995:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802996:	49 89 c0             	mov    %rax,%r8
+  802999:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80299e:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8029a5:	00 00 00 
+  8029a8:	be 27 00 00 00       	mov    $0x27,%esi
+  8029ad:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8029b4:	00 00 00 
+  8029b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bc:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  8029c3:	00 00 00 
+  8029c6:	41 ff d1             	call   *%r9
+
+00000000008029c9 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029c9:	55                   	push   %rbp
+  8029ca:	48 89 e5             	mov    %rsp,%rbp
+  8029cd:	53                   	push   %rbx
+  8029ce:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029d2:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d9:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029fb:	48 85 c0             	test   %rax,%rax
+  8029fe:	7f 06                	jg     802a06 <sys_env_set_reclaim+0x3d>
+}
+  802a00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a04:	c9                   	leave
+  802a05:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a06:	49 89 c0             	mov    %rax,%r8
+  802a09:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a0e:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a15:	00 00 00 
+  802a18:	be 27 00 00 00       	mov    $0x27,%esi
+  802a1d:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a24:	00 00 00 
+  802a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2c:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802a33:	00 00 00 
+  802a36:	41 ff d1             	call   *%r9
+
+0000000000802a39 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a39:	55                   	push   %rbp
+  802a3a:	48 89 e5             	mov    %rsp,%rbp
+  802a3d:	53                   	push   %rbx
+  802a3e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a42:	48 63 ce             	movslq %esi,%rcx
+  802a45:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a48:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a52:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a57:	be 00 00 00 00       	mov    $0x0,%esi
+  802a5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a68:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a6a:	48 85 c0             	test   %rax,%rax
+  802a6d:	7f 06                	jg     802a75 <sys_env_set_nice+0x3c>
+}
+  802a6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a73:	c9                   	leave
+  802a74:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a75:	49 89 c0             	mov    %rax,%r8
+  802a78:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a7d:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a84:	00 00 00 
+  802a87:	be 27 00 00 00       	mov    $0x27,%esi
+  802a8c:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a93:	00 00 00 
+  802a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9b:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802aa2:	00 00 00 
+  802aa5:	41 ff d1             	call   *%r9
+
+0000000000802aa8 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	53                   	push   %rbx
+  802aad:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ab0:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ab5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802abf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802acf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad5:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ad7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802adb:	c9                   	leave
+  802adc:	c3                   	ret
+
+0000000000802add <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802add:	55                   	push   %rbp
+  802ade:	48 89 e5             	mov    %rsp,%rbp
+  802ae1:	53                   	push   %rbx
+  802ae2:	89 f8                	mov    %edi,%eax
+  802ae4:	49 89 f1             	mov    %rsi,%r9
+  802ae7:	48 89 d3             	mov    %rdx,%rbx
+  802aea:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802aed:	49 63 f0             	movslq %r8d,%rsi
+  802af0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802af3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802af8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802afb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b07:	cd 30                	int    $0x30
+}
+  802b09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b0d:	c9                   	leave
+  802b0e:	c3                   	ret
+
+0000000000802b0f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b0f:	55                   	push   %rbp
+  802b10:	48 89 e5             	mov    %rsp,%rbp
+  802b13:	53                   	push   %rbx
+  802b14:	89 f8                	mov    %edi,%eax
+  802b16:	49 89 f1             	mov    %rsi,%r9
+  802b19:	48 89 d3             	mov    %rdx,%rbx
+  802b1c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b1f:	49 63 f0             	movslq %r8d,%rsi
+  802b22:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b25:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b2a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b33:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b39:	cd 30                	int    $0x30
+}
+  802b3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b3f:	c9                   	leave
+  802b40:	c3                   	ret
+
+0000000000802b41 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b41:	55                   	push   %rbp
+  802b42:	48 89 e5             	mov    %rsp,%rbp
+  802b45:	53                   	push   %rbx
+  802b46:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4a:	89 f8                	mov    %edi,%eax
+  802b4c:	49 89 f2             	mov    %rsi,%r10
+  802b4f:	48 89 d3             	mov    %rdx,%rbx
+  802b52:	48 89 cf             	mov    %rcx,%rdi
+  802b55:	44 89 c6             	mov    %r8d,%esi
+  802b58:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b5b:	48 63 f6             	movslq %esi,%rsi
+  802b5e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b61:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b66:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b69:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b6d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b6f:	48 85 c0             	test   %rax,%rax
+  802b72:	7f 06                	jg     802b7a <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b78:	c9                   	leave
+  802b79:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b7a:	49 89 c0             	mov    %rax,%r8
+  802b7d:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b82:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802b89:	00 00 00 
+  802b8c:	be 27 00 00 00       	mov    $0x27,%esi
+  802b91:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802b98:	00 00 00 
+  802b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba0:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802ba7:	00 00 00 
+  802baa:	41 ff d1             	call   *%r9
+
+0000000000802bad <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bad:	55                   	push   %rbp
+  802bae:	48 89 e5             	mov    %rsp,%rbp
+  802bb1:	53                   	push   %rbx
+  802bb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb6:	48 89 f1             	mov    %rsi,%rcx
+  802bb9:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bbc:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bc0:	48 8b 1a             	mov    (%rdx),%rbx
+  802bc3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bcb:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bcf:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bd3:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bd7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bd9:	48 85 c0             	test   %rax,%rax
+  802bdc:	7f 06                	jg     802be4 <sys_ipc_call_short+0x37>
+}
+  802bde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be2:	c9                   	leave
+  802be3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802be4:	49 89 c0             	mov    %rax,%r8
+  802be7:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bec:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802bf3:	00 00 00 
+  802bf6:	be 27 00 00 00       	mov    $0x27,%esi
+  802bfb:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c02:	00 00 00 
+  802c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0a:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802c11:	00 00 00 
+  802c14:	41 ff d1             	call   *%r9
+
+0000000000802c17 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c17:	55                   	push   %rbp
+  802c18:	48 89 e5             	mov    %rsp,%rbp
+  802c1b:	53                   	push   %rbx
+  802c1c:	48 83 ec 08          	sub    $0x8,%rsp
+  802c20:	89 f8                	mov    %edi,%eax
+  802c22:	49 89 f2             	mov    %rsi,%r10
+  802c25:	48 89 d3             	mov    %rdx,%rbx
+  802c28:	48 89 cf             	mov    %rcx,%rdi
+  802c2b:	44 89 c6             	mov    %r8d,%esi
+  802c2e:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c31:	48 63 f6             	movslq %esi,%rsi
+  802c34:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c37:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c3c:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c3f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c43:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c45:	48 85 c0             	test   %rax,%rax
+  802c48:	7f 06                	jg     802c50 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c4e:	c9                   	leave
+  802c4f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c50:	49 89 c0             	mov    %rax,%r8
+  802c53:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c58:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802c5f:	00 00 00 
+  802c62:	be 27 00 00 00       	mov    $0x27,%esi
+  802c67:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c6e:	00 00 00 
+  802c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c76:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802c7d:	00 00 00 
+  802c80:	41 ff d1             	call   *%r9
+
+0000000000802c83 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c83:	55                   	push   %rbp
+  802c84:	48 89 e5             	mov    %rsp,%rbp
+  802c87:	53                   	push   %rbx
+  802c88:	48 83 ec 08          	sub    $0x8,%rsp
+  802c8c:	48 89 fa             	mov    %rdi,%rdx
+  802c8f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c92:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ca1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cb2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cb4:	48 85 c0             	test   %rax,%rax
+  802cb7:	7f 06                	jg     802cbf <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cbd:	c9                   	leave
+  802cbe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cbf:	49 89 c0             	mov    %rax,%r8
+  802cc2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cc7:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802cce:	00 00 00 
+  802cd1:	be 27 00 00 00       	mov    $0x27,%esi
+  802cd6:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802cdd:	00 00 00 
+  802ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce5:	49 b9 89 50 80 00 00 	movabs $0x805089,%r9
+  802cec:	00 00 00 
+  802cef:	41 ff d1             	call   *%r9
+
+0000000000802cf2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cf2:	55                   	push   %rbp
+  802cf3:	48 89 e5             	mov    %rsp,%rbp
+  802cf6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cf7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d01:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d10:	be 00 00 00 00       	mov    $0x0,%esi
+  802d15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d21:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+0000000000802d29 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	53                   	push   %rbx
+  802d2e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d31:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d36:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d45:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d56:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d5c:	c9                   	leave
+  802d5d:	c3                   	ret
+
+0000000000802d5e <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d5e:	55                   	push   %rbp
+  802d5f:	48 89 e5             	mov    %rsp,%rbp
+  802d62:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d63:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d68:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d77:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d7c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d8d:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d93:	c9                   	leave
+  802d94:	c3                   	ret
+
+0000000000802d95 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d95:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d9c:	ff ff ff 
+  802d9f:	48 01 f8             	add    %rdi,%rax
+  802da2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802da6:	c3                   	ret
+
+0000000000802da7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802da7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dae:	ff ff ff 
+  802db1:	48 01 f8             	add    %rdi,%rax
+  802db4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802db8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dbe:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dc2:	c3                   	ret
+
+0000000000802dc3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dc3:	55                   	push   %rbp
+  802dc4:	48 89 e5             	mov    %rsp,%rbp
+  802dc7:	41 57                	push   %r15
+  802dc9:	41 56                	push   %r14
+  802dcb:	41 55                	push   %r13
+  802dcd:	41 54                	push   %r12
+  802dcf:	53                   	push   %rbx
+  802dd0:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd4:	49 89 ff             	mov    %rdi,%r15
+  802dd7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802ddc:	49 bd c3 42 80 00 00 	movabs $0x8042c3,%r13
+  802de3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802de6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802dec:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802def:	48 89 df             	mov    %rbx,%rdi
+  802df2:	41 ff d5             	call   *%r13
+  802df5:	83 e0 04             	and    $0x4,%eax
+  802df8:	74 17                	je     802e11 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802dfa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e01:	4c 39 f3             	cmp    %r14,%rbx
+  802e04:	75 e6                	jne    802dec <fd_alloc+0x29>
+  802e06:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e0c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e11:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e14:	48 83 c4 08          	add    $0x8,%rsp
+  802e18:	5b                   	pop    %rbx
+  802e19:	41 5c                	pop    %r12
+  802e1b:	41 5d                	pop    %r13
+  802e1d:	41 5e                	pop    %r14
+  802e1f:	41 5f                	pop    %r15
+  802e21:	5d                   	pop    %rbp
+  802e22:	c3                   	ret
+
+0000000000802e23 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e23:	83 ff 1f             	cmp    $0x1f,%edi
+  802e26:	77 39                	ja     802e61 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e28:	55                   	push   %rbp
+  802e29:	48 89 e5             	mov    %rsp,%rbp
+  802e2c:	41 54                	push   %r12
+  802e2e:	53                   	push   %rbx
+  802e2f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e32:	48 63 df             	movslq %edi,%rbx
+  802e35:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e3c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e40:	48 89 df             	mov    %rbx,%rdi
+  802e43:	48 b8 c3 42 80 00 00 	movabs $0x8042c3,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+  802e4f:	a8 04                	test   $0x4,%al
+  802e51:	74 14                	je     802e67 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e53:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e5c:	5b                   	pop    %rbx
+  802e5d:	41 5c                	pop    %r12
+  802e5f:	5d                   	pop    %rbp
+  802e60:	c3                   	ret
+        return -E_INVAL;
+  802e61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e66:	c3                   	ret
+        return -E_INVAL;
+  802e67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e6c:	eb ee                	jmp    802e5c <fd_lookup+0x39>
+
+0000000000802e6e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e6e:	55                   	push   %rbp
+  802e6f:	48 89 e5             	mov    %rsp,%rbp
+  802e72:	41 54                	push   %r12
+  802e74:	53                   	push   %rbx
+  802e75:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e78:	48 b8 00 62 80 00 00 	movabs $0x806200,%rax
+  802e7f:	00 00 00 
+  802e82:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e89:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e8c:	39 3b                	cmp    %edi,(%rbx)
+  802e8e:	74 47                	je     802ed7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e90:	48 83 c0 08          	add    $0x8,%rax
+  802e94:	48 8b 18             	mov    (%rax),%rbx
+  802e97:	48 85 db             	test   %rbx,%rbx
+  802e9a:	75 f0                	jne    802e8c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e9c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ea3:	00 00 00 
+  802ea6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802eac:	89 fa                	mov    %edi,%edx
+  802eae:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  802eb5:	00 00 00 
+  802eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebd:	48 b9 9b 16 80 00 00 	movabs $0x80169b,%rcx
+  802ec4:	00 00 00 
+  802ec7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ec9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ece:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ed2:	5b                   	pop    %rbx
+  802ed3:	41 5c                	pop    %r12
+  802ed5:	5d                   	pop    %rbp
+  802ed6:	c3                   	ret
+            return 0;
+  802ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edc:	eb f0                	jmp    802ece <dev_lookup+0x60>
+
+0000000000802ede <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ede:	55                   	push   %rbp
+  802edf:	48 89 e5             	mov    %rsp,%rbp
+  802ee2:	41 55                	push   %r13
+  802ee4:	41 54                	push   %r12
+  802ee6:	53                   	push   %rbx
+  802ee7:	48 83 ec 18          	sub    $0x18,%rsp
+  802eeb:	48 89 fb             	mov    %rdi,%rbx
+  802eee:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ef1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802ef8:	ff ff ff 
+  802efb:	48 01 df             	add    %rbx,%rdi
+  802efe:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f06:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  802f0d:	00 00 00 
+  802f10:	ff d0                	call   *%rax
+  802f12:	41 89 c5             	mov    %eax,%r13d
+  802f15:	85 c0                	test   %eax,%eax
+  802f17:	78 06                	js     802f1f <fd_close+0x41>
+  802f19:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f1d:	74 1a                	je     802f39 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f1f:	45 84 e4             	test   %r12b,%r12b
+  802f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f27:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f2b:	44 89 e8             	mov    %r13d,%eax
+  802f2e:	48 83 c4 18          	add    $0x18,%rsp
+  802f32:	5b                   	pop    %rbx
+  802f33:	41 5c                	pop    %r12
+  802f35:	41 5d                	pop    %r13
+  802f37:	5d                   	pop    %rbp
+  802f38:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f39:	8b 3b                	mov    (%rbx),%edi
+  802f3b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f3f:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  802f46:	00 00 00 
+  802f49:	ff d0                	call   *%rax
+  802f4b:	41 89 c5             	mov    %eax,%r13d
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	78 1b                	js     802f6d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f56:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f5a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f60:	48 85 c0             	test   %rax,%rax
+  802f63:	74 08                	je     802f6d <fd_close+0x8f>
+  802f65:	48 89 df             	mov    %rbx,%rdi
+  802f68:	ff d0                	call   *%rax
+  802f6a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f72:	48 89 de             	mov    %rbx,%rsi
+  802f75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7a:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  802f81:	00 00 00 
+  802f84:	ff d0                	call   *%rax
+    return res;
+  802f86:	eb a3                	jmp    802f2b <fd_close+0x4d>
+
+0000000000802f88 <close>:
+
+int
+close(int fdnum) {
+  802f88:	55                   	push   %rbp
+  802f89:	48 89 e5             	mov    %rsp,%rbp
+  802f8c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f90:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f94:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  802f9b:	00 00 00 
+  802f9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fa0:	85 c0                	test   %eax,%eax
+  802fa2:	78 15                	js     802fb9 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fa4:	be 01 00 00 00       	mov    $0x1,%esi
+  802fa9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fad:	48 b8 de 2e 80 00 00 	movabs $0x802ede,%rax
+  802fb4:	00 00 00 
+  802fb7:	ff d0                	call   *%rax
+}
+  802fb9:	c9                   	leave
+  802fba:	c3                   	ret
+
+0000000000802fbb <close_all>:
+
+void
+close_all(void) {
+  802fbb:	55                   	push   %rbp
+  802fbc:	48 89 e5             	mov    %rsp,%rbp
+  802fbf:	41 54                	push   %r12
+  802fc1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fc7:	49 bc 88 2f 80 00 00 	movabs $0x802f88,%r12
+  802fce:	00 00 00 
+  802fd1:	89 df                	mov    %ebx,%edi
+  802fd3:	41 ff d4             	call   *%r12
+  802fd6:	83 c3 01             	add    $0x1,%ebx
+  802fd9:	83 fb 20             	cmp    $0x20,%ebx
+  802fdc:	75 f3                	jne    802fd1 <close_all+0x16>
+}
+  802fde:	5b                   	pop    %rbx
+  802fdf:	41 5c                	pop    %r12
+  802fe1:	5d                   	pop    %rbp
+  802fe2:	c3                   	ret
+
+0000000000802fe3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fe3:	55                   	push   %rbp
+  802fe4:	48 89 e5             	mov    %rsp,%rbp
+  802fe7:	41 57                	push   %r15
+  802fe9:	41 56                	push   %r14
+  802feb:	41 55                	push   %r13
+  802fed:	41 54                	push   %r12
+  802fef:	53                   	push   %rbx
+  802ff0:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802ff7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ffb:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803002:	00 00 00 
+  803005:	ff d0                	call   *%rax
+  803007:	89 c3                	mov    %eax,%ebx
+  803009:	85 c0                	test   %eax,%eax
+  80300b:	0f 88 b8 00 00 00    	js     8030c9 <dup+0xe6>
+    close(newfdnum);
+  803011:	44 89 e7             	mov    %r12d,%edi
+  803014:	48 b8 88 2f 80 00 00 	movabs $0x802f88,%rax
+  80301b:	00 00 00 
+  80301e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803020:	4d 63 ec             	movslq %r12d,%r13
+  803023:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80302a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80302e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803032:	4c 89 ff             	mov    %r15,%rdi
+  803035:	49 be a7 2d 80 00 00 	movabs $0x802da7,%r14
+  80303c:	00 00 00 
+  80303f:	41 ff d6             	call   *%r14
+  803042:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803045:	4c 89 ef             	mov    %r13,%rdi
+  803048:	41 ff d6             	call   *%r14
+  80304b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80304e:	48 89 df             	mov    %rbx,%rdi
+  803051:	48 b8 c3 42 80 00 00 	movabs $0x8042c3,%rax
+  803058:	00 00 00 
+  80305b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80305d:	a8 04                	test   $0x4,%al
+  80305f:	74 2b                	je     80308c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803061:	41 89 c1             	mov    %eax,%r9d
+  803064:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80306a:	4c 89 f1             	mov    %r14,%rcx
+  80306d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803072:	48 89 de             	mov    %rbx,%rsi
+  803075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307a:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  803081:	00 00 00 
+  803084:	ff d0                	call   *%rax
+  803086:	89 c3                	mov    %eax,%ebx
+  803088:	85 c0                	test   %eax,%eax
+  80308a:	78 4e                	js     8030da <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80308c:	4c 89 ff             	mov    %r15,%rdi
+  80308f:	48 b8 c3 42 80 00 00 	movabs $0x8042c3,%rax
+  803096:	00 00 00 
+  803099:	ff d0                	call   *%rax
+  80309b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80309e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030a4:	4c 89 e9             	mov    %r13,%rcx
+  8030a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030ac:	4c 89 fe             	mov    %r15,%rsi
+  8030af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b4:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  8030bb:	00 00 00 
+  8030be:	ff d0                	call   *%rax
+  8030c0:	89 c3                	mov    %eax,%ebx
+  8030c2:	85 c0                	test   %eax,%eax
+  8030c4:	78 14                	js     8030da <dup+0xf7>
+
+    return newfdnum;
+  8030c6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030c9:	89 d8                	mov    %ebx,%eax
+  8030cb:	48 83 c4 18          	add    $0x18,%rsp
+  8030cf:	5b                   	pop    %rbx
+  8030d0:	41 5c                	pop    %r12
+  8030d2:	41 5d                	pop    %r13
+  8030d4:	41 5e                	pop    %r14
+  8030d6:	41 5f                	pop    %r15
+  8030d8:	5d                   	pop    %rbp
+  8030d9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030df:	4c 89 ee             	mov    %r13,%rsi
+  8030e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e7:	49 bc 0f 28 80 00 00 	movabs $0x80280f,%r12
+  8030ee:	00 00 00 
+  8030f1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030f9:	4c 89 f6             	mov    %r14,%rsi
+  8030fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803101:	41 ff d4             	call   *%r12
+    return res;
+  803104:	eb c3                	jmp    8030c9 <dup+0xe6>
+
+0000000000803106 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803106:	55                   	push   %rbp
+  803107:	48 89 e5             	mov    %rsp,%rbp
+  80310a:	41 56                	push   %r14
+  80310c:	41 55                	push   %r13
+  80310e:	41 54                	push   %r12
+  803110:	53                   	push   %rbx
+  803111:	48 83 ec 10          	sub    $0x10,%rsp
+  803115:	89 fb                	mov    %edi,%ebx
+  803117:	49 89 f4             	mov    %rsi,%r12
+  80311a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80311d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803121:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803128:	00 00 00 
+  80312b:	ff d0                	call   *%rax
+  80312d:	85 c0                	test   %eax,%eax
+  80312f:	78 4c                	js     80317d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803131:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803135:	41 8b 3e             	mov    (%r14),%edi
+  803138:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80313c:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  803143:	00 00 00 
+  803146:	ff d0                	call   *%rax
+  803148:	85 c0                	test   %eax,%eax
+  80314a:	78 35                	js     803181 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80314c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803150:	83 e0 03             	and    $0x3,%eax
+  803153:	83 f8 01             	cmp    $0x1,%eax
+  803156:	74 2d                	je     803185 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803158:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80315c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803160:	48 85 c0             	test   %rax,%rax
+  803163:	74 56                	je     8031bb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803165:	4c 89 ea             	mov    %r13,%rdx
+  803168:	4c 89 e6             	mov    %r12,%rsi
+  80316b:	4c 89 f7             	mov    %r14,%rdi
+  80316e:	ff d0                	call   *%rax
+}
+  803170:	48 83 c4 10          	add    $0x10,%rsp
+  803174:	5b                   	pop    %rbx
+  803175:	41 5c                	pop    %r12
+  803177:	41 5d                	pop    %r13
+  803179:	41 5e                	pop    %r14
+  80317b:	5d                   	pop    %rbp
+  80317c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80317d:	48 98                	cltq
+  80317f:	eb ef                	jmp    803170 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803181:	48 98                	cltq
+  803183:	eb eb                	jmp    803170 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803185:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80318c:	00 00 00 
+  80318f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803195:	89 da                	mov    %ebx,%edx
+  803197:	48 bf b9 61 80 00 00 	movabs $0x8061b9,%rdi
+  80319e:	00 00 00 
+  8031a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a6:	48 b9 9b 16 80 00 00 	movabs $0x80169b,%rcx
+  8031ad:	00 00 00 
+  8031b0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031b2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031b9:	eb b5                	jmp    803170 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031bb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031c2:	eb ac                	jmp    803170 <read+0x6a>
+
+00000000008031c4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031c4:	55                   	push   %rbp
+  8031c5:	48 89 e5             	mov    %rsp,%rbp
+  8031c8:	41 57                	push   %r15
+  8031ca:	41 56                	push   %r14
+  8031cc:	41 55                	push   %r13
+  8031ce:	41 54                	push   %r12
+  8031d0:	53                   	push   %rbx
+  8031d1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031d5:	48 85 d2             	test   %rdx,%rdx
+  8031d8:	74 54                	je     80322e <readn+0x6a>
+  8031da:	41 89 fd             	mov    %edi,%r13d
+  8031dd:	49 89 f6             	mov    %rsi,%r14
+  8031e0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031e8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031ed:	49 bf 06 31 80 00 00 	movabs $0x803106,%r15
+  8031f4:	00 00 00 
+  8031f7:	4c 89 e2             	mov    %r12,%rdx
+  8031fa:	48 29 f2             	sub    %rsi,%rdx
+  8031fd:	4c 01 f6             	add    %r14,%rsi
+  803200:	44 89 ef             	mov    %r13d,%edi
+  803203:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803206:	85 c0                	test   %eax,%eax
+  803208:	78 20                	js     80322a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80320a:	01 c3                	add    %eax,%ebx
+  80320c:	85 c0                	test   %eax,%eax
+  80320e:	74 08                	je     803218 <readn+0x54>
+  803210:	48 63 f3             	movslq %ebx,%rsi
+  803213:	4c 39 e6             	cmp    %r12,%rsi
+  803216:	72 df                	jb     8031f7 <readn+0x33>
+    }
+    return res;
+  803218:	48 63 c3             	movslq %ebx,%rax
+}
+  80321b:	48 83 c4 08          	add    $0x8,%rsp
+  80321f:	5b                   	pop    %rbx
+  803220:	41 5c                	pop    %r12
+  803222:	41 5d                	pop    %r13
+  803224:	41 5e                	pop    %r14
+  803226:	41 5f                	pop    %r15
+  803228:	5d                   	pop    %rbp
+  803229:	c3                   	ret
+        if (inc < 0) return inc;
+  80322a:	48 98                	cltq
+  80322c:	eb ed                	jmp    80321b <readn+0x57>
+    int inc = 1, res = 0;
+  80322e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803233:	eb e3                	jmp    803218 <readn+0x54>
+
+0000000000803235 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803235:	55                   	push   %rbp
+  803236:	48 89 e5             	mov    %rsp,%rbp
+  803239:	41 56                	push   %r14
+  80323b:	41 55                	push   %r13
+  80323d:	41 54                	push   %r12
+  80323f:	53                   	push   %rbx
+  803240:	48 83 ec 10          	sub    $0x10,%rsp
+  803244:	89 fb                	mov    %edi,%ebx
+  803246:	49 89 f4             	mov    %rsi,%r12
+  803249:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80324c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803250:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+  80325c:	85 c0                	test   %eax,%eax
+  80325e:	78 47                	js     8032a7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803260:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803264:	41 8b 3e             	mov    (%r14),%edi
+  803267:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80326b:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  803272:	00 00 00 
+  803275:	ff d0                	call   *%rax
+  803277:	85 c0                	test   %eax,%eax
+  803279:	78 30                	js     8032ab <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80327b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803280:	74 2d                	je     8032af <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803282:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803286:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80328a:	48 85 c0             	test   %rax,%rax
+  80328d:	74 56                	je     8032e5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80328f:	4c 89 ea             	mov    %r13,%rdx
+  803292:	4c 89 e6             	mov    %r12,%rsi
+  803295:	4c 89 f7             	mov    %r14,%rdi
+  803298:	ff d0                	call   *%rax
+}
+  80329a:	48 83 c4 10          	add    $0x10,%rsp
+  80329e:	5b                   	pop    %rbx
+  80329f:	41 5c                	pop    %r12
+  8032a1:	41 5d                	pop    %r13
+  8032a3:	41 5e                	pop    %r14
+  8032a5:	5d                   	pop    %rbp
+  8032a6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032a7:	48 98                	cltq
+  8032a9:	eb ef                	jmp    80329a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032ab:	48 98                	cltq
+  8032ad:	eb eb                	jmp    80329a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032af:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032b6:	00 00 00 
+  8032b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032bf:	89 da                	mov    %ebx,%edx
+  8032c1:	48 bf d5 61 80 00 00 	movabs $0x8061d5,%rdi
+  8032c8:	00 00 00 
+  8032cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d0:	48 b9 9b 16 80 00 00 	movabs $0x80169b,%rcx
+  8032d7:	00 00 00 
+  8032da:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032dc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032e3:	eb b5                	jmp    80329a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032e5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032ec:	eb ac                	jmp    80329a <write+0x65>
+
+00000000008032ee <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032ee:	55                   	push   %rbp
+  8032ef:	48 89 e5             	mov    %rsp,%rbp
+  8032f2:	53                   	push   %rbx
+  8032f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8032f7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032fd:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+  803309:	85 c0                	test   %eax,%eax
+  80330b:	78 0c                	js     803319 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80330d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803311:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803314:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803319:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80331d:	c9                   	leave
+  80331e:	c3                   	ret
+
+000000000080331f <tell>:
+
+int tell(int fdnum) {
+  80331f:	55                   	push   %rbp
+  803320:	48 89 e5             	mov    %rsp,%rbp
+  803323:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803327:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80332b:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803332:	00 00 00 
+  803335:	ff d0                	call   *%rax
+  803337:	85 c0                	test   %eax,%eax
+  803339:	78 07                	js     803342 <tell+0x23>
+
+    return fd->fd_offset;
+  80333b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80333f:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803342:	c9                   	leave
+  803343:	c3                   	ret
+
+0000000000803344 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803344:	55                   	push   %rbp
+  803345:	48 89 e5             	mov    %rsp,%rbp
+  803348:	41 55                	push   %r13
+  80334a:	41 54                	push   %r12
+  80334c:	53                   	push   %rbx
+  80334d:	48 83 ec 18          	sub    $0x18,%rsp
+  803351:	89 fb                	mov    %edi,%ebx
+  803353:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803356:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80335a:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803361:	00 00 00 
+  803364:	ff d0                	call   *%rax
+  803366:	85 c0                	test   %eax,%eax
+  803368:	78 38                	js     8033a2 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80336a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80336e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803372:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803376:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  80337d:	00 00 00 
+  803380:	ff d0                	call   *%rax
+  803382:	85 c0                	test   %eax,%eax
+  803384:	78 1c                	js     8033a2 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803386:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80338b:	74 20                	je     8033ad <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80338d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803391:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803395:	48 85 c0             	test   %rax,%rax
+  803398:	74 47                	je     8033e1 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80339a:	44 89 e6             	mov    %r12d,%esi
+  80339d:	4c 89 ef             	mov    %r13,%rdi
+  8033a0:	ff d0                	call   *%rax
+}
+  8033a2:	48 83 c4 18          	add    $0x18,%rsp
+  8033a6:	5b                   	pop    %rbx
+  8033a7:	41 5c                	pop    %r12
+  8033a9:	41 5d                	pop    %r13
+  8033ab:	5d                   	pop    %rbp
+  8033ac:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033ad:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033b4:	00 00 00 
+  8033b7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033bd:	89 da                	mov    %ebx,%edx
+  8033bf:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  8033c6:	00 00 00 
+  8033c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ce:	48 b9 9b 16 80 00 00 	movabs $0x80169b,%rcx
+  8033d5:	00 00 00 
+  8033d8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033df:	eb c1                	jmp    8033a2 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033e1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033e6:	eb ba                	jmp    8033a2 <ftruncate+0x5e>
+
+00000000008033e8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033e8:	55                   	push   %rbp
+  8033e9:	48 89 e5             	mov    %rsp,%rbp
+  8033ec:	41 54                	push   %r12
+  8033ee:	53                   	push   %rbx
+  8033ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8033f3:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033f6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033fa:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803401:	00 00 00 
+  803404:	ff d0                	call   *%rax
+  803406:	85 c0                	test   %eax,%eax
+  803408:	78 63                	js     80346d <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80340a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80340e:	41 8b 3c 24          	mov    (%r12),%edi
+  803412:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803416:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  80341d:	00 00 00 
+  803420:	ff d0                	call   *%rax
+  803422:	85 c0                	test   %eax,%eax
+  803424:	78 47                	js     80346d <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803426:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80342a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80342f:	74 45                	je     803476 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803431:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803434:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80343b:	00 00 00 
+    stat->st_isdir = 0;
+  80343e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803445:	00 00 00 
+    stat->st_ino = 0;
+  803448:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80344f:	00 00 00 00 
+    stat->st_version = 0;
+  803453:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80345a:	00 00 00 
+    stat->st_dev = dev;
+  80345d:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803464:	48 89 de             	mov    %rbx,%rsi
+  803467:	4c 89 e7             	mov    %r12,%rdi
+  80346a:	ff 50 28             	call   *0x28(%rax)
+}
+  80346d:	48 83 c4 10          	add    $0x10,%rsp
+  803471:	5b                   	pop    %rbx
+  803472:	41 5c                	pop    %r12
+  803474:	5d                   	pop    %rbp
+  803475:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803476:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80347b:	eb f0                	jmp    80346d <fstat+0x85>
+
+000000000080347d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80347d:	55                   	push   %rbp
+  80347e:	48 89 e5             	mov    %rsp,%rbp
+  803481:	41 54                	push   %r12
+  803483:	53                   	push   %rbx
+  803484:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803487:	be 00 00 00 00       	mov    $0x0,%esi
+  80348c:	48 b8 9e 39 80 00 00 	movabs $0x80399e,%rax
+  803493:	00 00 00 
+  803496:	ff d0                	call   *%rax
+  803498:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	78 25                	js     8034c3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80349e:	4c 89 e6             	mov    %r12,%rsi
+  8034a1:	89 c7                	mov    %eax,%edi
+  8034a3:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  8034aa:	00 00 00 
+  8034ad:	ff d0                	call   *%rax
+  8034af:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034b2:	89 df                	mov    %ebx,%edi
+  8034b4:	48 b8 88 2f 80 00 00 	movabs $0x802f88,%rax
+  8034bb:	00 00 00 
+  8034be:	ff d0                	call   *%rax
+
+    return res;
+  8034c0:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034c3:	89 d8                	mov    %ebx,%eax
+  8034c5:	5b                   	pop    %rbx
+  8034c6:	41 5c                	pop    %r12
+  8034c8:	5d                   	pop    %rbp
+  8034c9:	c3                   	ret
+
+00000000008034ca <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ca:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034d1:	00 00 00 
+  8034d4:	83 38 00             	cmpl   $0x0,(%rax)
+  8034d7:	74 0a                	je     8034e3 <fsipc_env+0x19>
+    return fsenv;
+}
+  8034d9:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034e0:	00 00 
+  8034e2:	c3                   	ret
+fsipc_env(void) {
+  8034e3:	55                   	push   %rbp
+  8034e4:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034ec:	48 b8 70 56 80 00 00 	movabs $0x805670,%rax
+  8034f3:	00 00 00 
+  8034f6:	ff d0                	call   *%rax
+  8034f8:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8034ff:	00 00 
+}
+  803501:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803508:	00 00 
+  80350a:	5d                   	pop    %rbp
+  80350b:	c3                   	ret
+
+000000000080350c <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80350c:	55                   	push   %rbp
+  80350d:	48 89 e5             	mov    %rsp,%rbp
+  803510:	53                   	push   %rbx
+  803511:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803515:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80351c:	00 
+  80351d:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803524:	00 
+  803525:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80352c:	00 
+  80352d:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803534:	00 
+  803535:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80353c:	00 
+
+    assert(size <= sizeof(words));
+  80353d:	48 83 fa 28          	cmp    $0x28,%rdx
+  803541:	77 38                	ja     80357b <fsipc_short+0x6f>
+  803543:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803545:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803549:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  803550:	00 00 00 
+  803553:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803555:	48 b8 ca 34 80 00 00 	movabs $0x8034ca,%rax
+  80355c:	00 00 00 
+  80355f:	ff d0                	call   *%rax
+  803561:	89 c7                	mov    %eax,%edi
+  803563:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803567:	89 de                	mov    %ebx,%esi
+  803569:	48 b8 d3 55 80 00 00 	movabs $0x8055d3,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+}
+  803575:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803579:	c9                   	leave
+  80357a:	c3                   	ret
+    assert(size <= sizeof(words));
+  80357b:	48 b9 20 62 80 00 00 	movabs $0x806220,%rcx
+  803582:	00 00 00 
+  803585:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80358c:	00 00 00 
+  80358f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803594:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80359b:	00 00 00 
+  80359e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a3:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  8035aa:	00 00 00 
+  8035ad:	41 ff d0             	call   *%r8
+
+00000000008035b0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035b0:	55                   	push   %rbp
+  8035b1:	48 89 e5             	mov    %rsp,%rbp
+  8035b4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035b8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035bb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035be:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035c1:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035c6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035ca:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035cf:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  8035d6:	00 00 00 
+  8035d9:	ff d0                	call   *%rax
+}
+  8035db:	c9                   	leave
+  8035dc:	c3                   	ret
+
+00000000008035dd <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035dd:	55                   	push   %rbp
+  8035de:	48 89 e5             	mov    %rsp,%rbp
+  8035e1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035e5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035eb:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035f0:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035f4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035f9:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  803600:	00 00 00 
+  803603:	ff d0                	call   *%rax
+}
+  803605:	c9                   	leave
+  803606:	c3                   	ret
+
+0000000000803607 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803607:	55                   	push   %rbp
+  803608:	48 89 e5             	mov    %rsp,%rbp
+  80360b:	41 54                	push   %r12
+  80360d:	53                   	push   %rbx
+  80360e:	48 83 ec 10          	sub    $0x10,%rsp
+  803612:	89 fb                	mov    %edi,%ebx
+  803614:	49 89 f4             	mov    %rsi,%r12
+  803617:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80361b:	48 b8 ca 34 80 00 00 	movabs $0x8034ca,%rax
+  803622:	00 00 00 
+  803625:	ff d0                	call   *%rax
+  803627:	89 c7                	mov    %eax,%edi
+  803629:	6a 00                	push   $0x0
+  80362b:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80362f:	50                   	push   %rax
+  803630:	4d 89 e1             	mov    %r12,%r9
+  803633:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803639:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80363e:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803645:	00 00 00 
+  803648:	89 de                	mov    %ebx,%esi
+  80364a:	48 b8 6e 55 80 00 00 	movabs $0x80556e,%rax
+  803651:	00 00 00 
+  803654:	ff d0                	call   *%rax
+}
+  803656:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80365a:	5b                   	pop    %rbx
+  80365b:	41 5c                	pop    %r12
+  80365d:	5d                   	pop    %rbp
+  80365e:	c3                   	ret
+
+000000000080365f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80365f:	55                   	push   %rbp
+  803660:	48 89 e5             	mov    %rsp,%rbp
+  803663:	41 54                	push   %r12
+  803665:	53                   	push   %rbx
+  803666:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803669:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80366c:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803673:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803675:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80367a:	be 00 00 00 00       	mov    $0x0,%esi
+  80367f:	bf 05 00 00 00       	mov    $0x5,%edi
+  803684:	48 b8 07 36 80 00 00 	movabs $0x803607,%rax
+  80368b:	00 00 00 
+  80368e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803690:	85 c0                	test   %eax,%eax
+  803692:	78 5a                	js     8036ee <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803694:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80369b:	00 00 00 
+  80369e:	4c 89 e6             	mov    %r12,%rsi
+  8036a1:	48 89 df             	mov    %rbx,%rdi
+  8036a4:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036b0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036b7:	00 
+  8036b8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036be:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036c5:	00 
+  8036c6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036cc:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036d3:	00 
+  8036d4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036db:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036e2:	00 
+  8036e3:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036ee:	5b                   	pop    %rbx
+  8036ef:	41 5c                	pop    %r12
+  8036f1:	5d                   	pop    %rbp
+  8036f2:	c3                   	ret
+
+00000000008036f3 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036f3:	55                   	push   %rbp
+  8036f4:	48 89 e5             	mov    %rsp,%rbp
+  8036f7:	41 57                	push   %r15
+  8036f9:	41 56                	push   %r14
+  8036fb:	41 55                	push   %r13
+  8036fd:	41 54                	push   %r12
+  8036ff:	53                   	push   %rbx
+  803700:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803704:	48 85 ff             	test   %rdi,%rdi
+  803707:	0f 84 a1 00 00 00    	je     8037ae <devfile_read+0xbb>
+  80370d:	49 89 ff             	mov    %rdi,%r15
+  803710:	49 89 f5             	mov    %rsi,%r13
+  803713:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803716:	48 85 f6             	test   %rsi,%rsi
+  803719:	0f 84 c4 00 00 00    	je     8037e3 <devfile_read+0xf0>
+    size_t total_read = 0;
+  80371f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803726:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803727:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80372e:	00 00 00 
+  803731:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803735:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803738:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80373c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803741:	be 00 00 00 00       	mov    $0x0,%esi
+  803746:	bf 03 00 00 00       	mov    $0x3,%edi
+  80374b:	48 b8 07 36 80 00 00 	movabs $0x803607,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+        if (res < 0) {
+  803757:	85 c0                	test   %eax,%eax
+  803759:	0f 88 b9 00 00 00    	js     803818 <devfile_read+0x125>
+        assert(res <= n);
+  80375f:	48 63 d8             	movslq %eax,%rbx
+  803762:	49 39 dc             	cmp    %rbx,%r12
+  803765:	0f 82 b1 00 00 00    	jb     80381c <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80376b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803770:	0f 87 db 00 00 00    	ja     803851 <devfile_read+0x15e>
+        if (!res) {
+  803776:	85 c0                	test   %eax,%eax
+  803778:	74 21                	je     80379b <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80377a:	48 89 da             	mov    %rbx,%rdx
+  80377d:	4c 89 f6             	mov    %r14,%rsi
+  803780:	4c 89 ef             	mov    %r13,%rdi
+  803783:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  80378a:	00 00 00 
+  80378d:	ff d0                	call   *%rax
+        total_read += res;
+  80378f:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803793:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803796:	49 29 dc             	sub    %rbx,%r12
+  803799:	75 96                	jne    803731 <devfile_read+0x3e>
+    return total_read;
+  80379b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80379f:	48 83 c4 18          	add    $0x18,%rsp
+  8037a3:	5b                   	pop    %rbx
+  8037a4:	41 5c                	pop    %r12
+  8037a6:	41 5d                	pop    %r13
+  8037a8:	41 5e                	pop    %r14
+  8037aa:	41 5f                	pop    %r15
+  8037ac:	5d                   	pop    %rbp
+  8037ad:	c3                   	ret
+    assert(fd);
+  8037ae:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  8037b5:	00 00 00 
+  8037b8:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037bf:	00 00 00 
+  8037c2:	be 91 00 00 00       	mov    $0x91,%esi
+  8037c7:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8037ce:	00 00 00 
+  8037d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d6:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  8037dd:	00 00 00 
+  8037e0:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037e3:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  8037ea:	00 00 00 
+  8037ed:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037f4:	00 00 00 
+  8037f7:	be 92 00 00 00       	mov    $0x92,%esi
+  8037fc:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803803:	00 00 00 
+  803806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380b:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  803812:	00 00 00 
+  803815:	41 ff d0             	call   *%r8
+            return res;
+  803818:	48 98                	cltq
+  80381a:	eb 83                	jmp    80379f <devfile_read+0xac>
+        assert(res <= n);
+  80381c:	48 b9 5d 62 80 00 00 	movabs $0x80625d,%rcx
+  803823:	00 00 00 
+  803826:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80382d:	00 00 00 
+  803830:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803835:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80383c:	00 00 00 
+  80383f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803844:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  80384b:	00 00 00 
+  80384e:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803851:	48 b9 68 62 80 00 00 	movabs $0x806268,%rcx
+  803858:	00 00 00 
+  80385b:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803862:	00 00 00 
+  803865:	be 9f 00 00 00       	mov    $0x9f,%esi
+  80386a:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803871:	00 00 00 
+  803874:	b8 00 00 00 00       	mov    $0x0,%eax
+  803879:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  803880:	00 00 00 
+  803883:	41 ff d0             	call   *%r8
+
+0000000000803886 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803886:	55                   	push   %rbp
+  803887:	48 89 e5             	mov    %rsp,%rbp
+  80388a:	41 57                	push   %r15
+  80388c:	41 56                	push   %r14
+  80388e:	41 55                	push   %r13
+  803890:	41 54                	push   %r12
+  803892:	53                   	push   %rbx
+  803893:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803897:	48 85 ff             	test   %rdi,%rdi
+  80389a:	0f 84 83 00 00 00    	je     803923 <devfile_write+0x9d>
+  8038a0:	49 89 ff             	mov    %rdi,%r15
+  8038a3:	49 89 f4             	mov    %rsi,%r12
+  8038a6:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038a9:	48 85 f6             	test   %rsi,%rsi
+  8038ac:	0f 84 a6 00 00 00    	je     803958 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038b2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038b8:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038bf:	00 00 00 
+  8038c2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038c6:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038c9:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038cd:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038d2:	48 39 d3             	cmp    %rdx,%rbx
+  8038d5:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038d9:	4c 89 e6             	mov    %r12,%rsi
+  8038dc:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038e3:	00 00 00 
+  8038e6:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038fc:	bf 04 00 00 00       	mov    $0x4,%edi
+  803901:	48 b8 07 36 80 00 00 	movabs $0x803607,%rax
+  803908:	00 00 00 
+  80390b:	ff d0                	call   *%rax
+        if (res < 0) {
+  80390d:	85 c0                	test   %eax,%eax
+  80390f:	78 7c                	js     80398d <devfile_write+0x107>
+        total_written += res;
+  803911:	48 98                	cltq
+  803913:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803916:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803919:	48 29 c3             	sub    %rax,%rbx
+  80391c:	75 a4                	jne    8038c2 <devfile_write+0x3c>
+    return total_written;
+  80391e:	4c 89 e8             	mov    %r13,%rax
+  803921:	eb 6c                	jmp    80398f <devfile_write+0x109>
+    assert(fd);
+  803923:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  80392a:	00 00 00 
+  80392d:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803934:	00 00 00 
+  803937:	be bd 00 00 00       	mov    $0xbd,%esi
+  80393c:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803943:	00 00 00 
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  803952:	00 00 00 
+  803955:	41 ff d0             	call   *%r8
+    assert(buf);
+  803958:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  80395f:	00 00 00 
+  803962:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803969:	00 00 00 
+  80396c:	be be 00 00 00       	mov    $0xbe,%esi
+  803971:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803978:	00 00 00 
+  80397b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803980:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  803987:	00 00 00 
+  80398a:	41 ff d0             	call   *%r8
+            return res;
+  80398d:	48 98                	cltq
+}
+  80398f:	48 83 c4 08          	add    $0x8,%rsp
+  803993:	5b                   	pop    %rbx
+  803994:	41 5c                	pop    %r12
+  803996:	41 5d                	pop    %r13
+  803998:	41 5e                	pop    %r14
+  80399a:	41 5f                	pop    %r15
+  80399c:	5d                   	pop    %rbp
+  80399d:	c3                   	ret
+
+000000000080399e <open>:
+open(const char *path, int mode) {
+  80399e:	55                   	push   %rbp
+  80399f:	48 89 e5             	mov    %rsp,%rbp
+  8039a2:	41 55                	push   %r13
+  8039a4:	41 54                	push   %r12
+  8039a6:	53                   	push   %rbx
+  8039a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ab:	49 89 fc             	mov    %rdi,%r12
+  8039ae:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039b1:	48 b8 94 1f 80 00 00 	movabs $0x801f94,%rax
+  8039b8:	00 00 00 
+  8039bb:	ff d0                	call   *%rax
+  8039bd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039c3:	0f 87 8f 00 00 00    	ja     803a58 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039c9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039cd:	48 b8 c3 2d 80 00 00 	movabs $0x802dc3,%rax
+  8039d4:	00 00 00 
+  8039d7:	ff d0                	call   *%rax
+  8039d9:	89 c3                	mov    %eax,%ebx
+  8039db:	85 c0                	test   %eax,%eax
+  8039dd:	78 55                	js     803a34 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039df:	4c 89 e6             	mov    %r12,%rsi
+  8039e2:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039e9:	00 00 00 
+  8039ec:	48 89 df             	mov    %rbx,%rdi
+  8039ef:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  8039f6:	00 00 00 
+  8039f9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039fb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a07:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a10:	48 b8 07 36 80 00 00 	movabs $0x803607,%rax
+  803a17:	00 00 00 
+  803a1a:	ff d0                	call   *%rax
+  803a1c:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a1e:	85 c0                	test   %eax,%eax
+  803a20:	78 1f                	js     803a41 <open+0xa3>
+    return fd2num(fd);
+  803a22:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a26:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  803a2d:	00 00 00 
+  803a30:	ff d0                	call   *%rax
+  803a32:	89 c3                	mov    %eax,%ebx
+}
+  803a34:	89 d8                	mov    %ebx,%eax
+  803a36:	48 83 c4 18          	add    $0x18,%rsp
+  803a3a:	5b                   	pop    %rbx
+  803a3b:	41 5c                	pop    %r12
+  803a3d:	41 5d                	pop    %r13
+  803a3f:	5d                   	pop    %rbp
+  803a40:	c3                   	ret
+        fd_close(fd, 0);
+  803a41:	be 00 00 00 00       	mov    $0x0,%esi
+  803a46:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a4a:	48 b8 de 2e 80 00 00 	movabs $0x802ede,%rax
+  803a51:	00 00 00 
+  803a54:	ff d0                	call   *%rax
+        return res;
+  803a56:	eb dc                	jmp    803a34 <open+0x96>
+        return -E_BAD_PATH;
+  803a58:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a5d:	eb d5                	jmp    803a34 <open+0x96>
+
+0000000000803a5f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a5f:	55                   	push   %rbp
+  803a60:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a63:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a68:	be 00 00 00 00       	mov    $0x0,%esi
+  803a6d:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a72:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  803a79:	00 00 00 
+  803a7c:	ff d0                	call   *%rax
+}
+  803a7e:	5d                   	pop    %rbp
+  803a7f:	c3                   	ret
+
+0000000000803a80 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a80:	55                   	push   %rbp
+  803a81:	48 89 e5             	mov    %rsp,%rbp
+  803a84:	41 56                	push   %r14
+  803a86:	41 55                	push   %r13
+  803a88:	41 54                	push   %r12
+  803a8a:	53                   	push   %rbx
+  803a8b:	48 83 ec 10          	sub    $0x10,%rsp
+  803a8f:	41 89 f6             	mov    %esi,%r14d
+  803a92:	49 89 d4             	mov    %rdx,%r12
+  803a95:	48 89 cb             	mov    %rcx,%rbx
+  803a98:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a9b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a9f:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803aa6:	00 00 00 
+  803aa9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803aab:	85 c0                	test   %eax,%eax
+  803aad:	78 46                	js     803af5 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803aaf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ab3:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803aba:	00 00 00 
+  803abd:	8b 00                	mov    (%rax),%eax
+  803abf:	39 02                	cmp    %eax,(%rdx)
+  803ac1:	75 3f                	jne    803b02 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803ac3:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803aca:	00 00 00 
+  803acd:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ad0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ad2:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ad6:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ada:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ade:	48 89 da             	mov    %rbx,%rdx
+  803ae1:	4c 89 e6             	mov    %r12,%rsi
+  803ae4:	bf 09 00 00 00       	mov    $0x9,%edi
+  803ae9:	48 b8 07 36 80 00 00 	movabs $0x803607,%rax
+  803af0:	00 00 00 
+  803af3:	ff d0                	call   *%rax
+}
+  803af5:	48 83 c4 10          	add    $0x10,%rsp
+  803af9:	5b                   	pop    %rbx
+  803afa:	41 5c                	pop    %r12
+  803afc:	41 5d                	pop    %r13
+  803afe:	41 5e                	pop    %r14
+  803b00:	5d                   	pop    %rbp
+  803b01:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b02:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b07:	eb ec                	jmp    803af5 <file_map+0x75>
+
+0000000000803b09 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b09:	55                   	push   %rbp
+  803b0a:	48 89 e5             	mov    %rsp,%rbp
+  803b0d:	41 54                	push   %r12
+  803b0f:	53                   	push   %rbx
+  803b10:	48 83 ec 20          	sub    $0x20,%rsp
+  803b14:	41 89 f4             	mov    %esi,%r12d
+  803b17:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b1a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b1e:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803b25:	00 00 00 
+  803b28:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b2a:	85 c0                	test   %eax,%eax
+  803b2c:	78 3c                	js     803b6a <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b32:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b39:	00 00 00 
+  803b3c:	8b 0a                	mov    (%rdx),%ecx
+  803b3e:	39 08                	cmp    %ecx,(%rax)
+  803b40:	75 31                	jne    803b73 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b42:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b45:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b48:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b4c:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b50:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b55:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b59:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b5e:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  803b65:	00 00 00 
+  803b68:	ff d0                	call   *%rax
+}
+  803b6a:	48 83 c4 20          	add    $0x20,%rsp
+  803b6e:	5b                   	pop    %rbx
+  803b6f:	41 5c                	pop    %r12
+  803b71:	5d                   	pop    %rbp
+  803b72:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b73:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b78:	eb f0                	jmp    803b6a <file_msync+0x61>
+
+0000000000803b7a <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b7a:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b7e:	7f 01                	jg     803b81 <writebuf+0x7>
+  803b80:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b81:	55                   	push   %rbp
+  803b82:	48 89 e5             	mov    %rsp,%rbp
+  803b85:	53                   	push   %rbx
+  803b86:	48 83 ec 08          	sub    $0x8,%rsp
+  803b8a:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b8d:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b91:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b95:	8b 3f                	mov    (%rdi),%edi
+  803b97:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  803b9e:	00 00 00 
+  803ba1:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803ba3:	48 85 c0             	test   %rax,%rax
+  803ba6:	7e 04                	jle    803bac <writebuf+0x32>
+  803ba8:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bac:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bb0:	48 39 c2             	cmp    %rax,%rdx
+  803bb3:	74 0f                	je     803bc4 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bb5:	48 85 c0             	test   %rax,%rax
+  803bb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bbd:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bc1:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bc8:	c9                   	leave
+  803bc9:	c3                   	ret
+
+0000000000803bca <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bca:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bcd:	8d 50 01             	lea    0x1(%rax),%edx
+  803bd0:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bd3:	48 98                	cltq
+  803bd5:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bda:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803be0:	74 01                	je     803be3 <putch+0x19>
+  803be2:	c3                   	ret
+putch(int ch, void *arg) {
+  803be3:	55                   	push   %rbp
+  803be4:	48 89 e5             	mov    %rsp,%rbp
+  803be7:	53                   	push   %rbx
+  803be8:	48 83 ec 08          	sub    $0x8,%rsp
+  803bec:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bef:	48 89 f7             	mov    %rsi,%rdi
+  803bf2:	48 b8 7a 3b 80 00 00 	movabs $0x803b7a,%rax
+  803bf9:	00 00 00 
+  803bfc:	ff d0                	call   *%rax
+        state->offset = 0;
+  803bfe:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c09:	c9                   	leave
+  803c0a:	c3                   	ret
+
+0000000000803c0b <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c0b:	55                   	push   %rbp
+  803c0c:	48 89 e5             	mov    %rsp,%rbp
+  803c0f:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c16:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c19:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c1f:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c26:	00 00 00 
+    state.result = 0;
+  803c29:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c30:	00 00 00 00 
+    state.error = 1;
+  803c34:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c3b:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c3e:	48 89 f2             	mov    %rsi,%rdx
+  803c41:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c48:	48 bf ca 3b 80 00 00 	movabs $0x803bca,%rdi
+  803c4f:	00 00 00 
+  803c52:	48 b8 eb 17 80 00 00 	movabs $0x8017eb,%rax
+  803c59:	00 00 00 
+  803c5c:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c5e:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c65:	7f 14                	jg     803c7b <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c67:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c6e:	48 85 c0             	test   %rax,%rax
+  803c71:	75 06                	jne    803c79 <vfprintf+0x6e>
+  803c73:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c79:	c9                   	leave
+  803c7a:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c7b:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c82:	48 b8 7a 3b 80 00 00 	movabs $0x803b7a,%rax
+  803c89:	00 00 00 
+  803c8c:	ff d0                	call   *%rax
+  803c8e:	eb d7                	jmp    803c67 <vfprintf+0x5c>
+
+0000000000803c90 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c90:	55                   	push   %rbp
+  803c91:	48 89 e5             	mov    %rsp,%rbp
+  803c94:	48 83 ec 50          	sub    $0x50,%rsp
+  803c98:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c9c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ca0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ca4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ca8:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803caf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cb7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cbb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cbf:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cc3:	48 b8 0b 3c 80 00 00 	movabs $0x803c0b,%rax
+  803cca:	00 00 00 
+  803ccd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ccf:	c9                   	leave
+  803cd0:	c3                   	ret
+
+0000000000803cd1 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cd1:	55                   	push   %rbp
+  803cd2:	48 89 e5             	mov    %rsp,%rbp
+  803cd5:	48 83 ec 50          	sub    $0x50,%rsp
+  803cd9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cdd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ce1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ce5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ce9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ced:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cf4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cf8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cfc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d00:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d04:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d08:	48 89 fe             	mov    %rdi,%rsi
+  803d0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d10:	48 b8 0b 3c 80 00 00 	movabs $0x803c0b,%rax
+  803d17:	00 00 00 
+  803d1a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d1c:	c9                   	leave
+  803d1d:	c3                   	ret
+
+0000000000803d1e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d1e:	55                   	push   %rbp
+  803d1f:	48 89 e5             	mov    %rsp,%rbp
+  803d22:	41 54                	push   %r12
+  803d24:	53                   	push   %rbx
+  803d25:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d28:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  803d2f:	00 00 00 
+  803d32:	ff d0                	call   *%rax
+  803d34:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d37:	48 be 90 62 80 00 00 	movabs $0x806290,%rsi
+  803d3e:	00 00 00 
+  803d41:	48 89 df             	mov    %rbx,%rdi
+  803d44:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  803d4b:	00 00 00 
+  803d4e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d50:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d55:	41 2b 04 24          	sub    (%r12),%eax
+  803d59:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d5f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d66:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d69:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d70:	00 00 00 
+  803d73:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d7f:	5b                   	pop    %rbx
+  803d80:	41 5c                	pop    %r12
+  803d82:	5d                   	pop    %rbp
+  803d83:	c3                   	ret
+
+0000000000803d84 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d84:	55                   	push   %rbp
+  803d85:	48 89 e5             	mov    %rsp,%rbp
+  803d88:	41 54                	push   %r12
+  803d8a:	53                   	push   %rbx
+  803d8b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d8e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d93:	48 89 fe             	mov    %rdi,%rsi
+  803d96:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d9b:	49 bc 0f 28 80 00 00 	movabs $0x80280f,%r12
+  803da2:	00 00 00 
+  803da5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803da8:	48 89 df             	mov    %rbx,%rdi
+  803dab:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  803db2:	00 00 00 
+  803db5:	ff d0                	call   *%rax
+  803db7:	48 89 c6             	mov    %rax,%rsi
+  803dba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc4:	41 ff d4             	call   *%r12
+}
+  803dc7:	5b                   	pop    %rbx
+  803dc8:	41 5c                	pop    %r12
+  803dca:	5d                   	pop    %rbp
+  803dcb:	c3                   	ret
+
+0000000000803dcc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dcc:	55                   	push   %rbp
+  803dcd:	48 89 e5             	mov    %rsp,%rbp
+  803dd0:	41 57                	push   %r15
+  803dd2:	41 56                	push   %r14
+  803dd4:	41 55                	push   %r13
+  803dd6:	41 54                	push   %r12
+  803dd8:	53                   	push   %rbx
+  803dd9:	48 83 ec 18          	sub    $0x18,%rsp
+  803ddd:	49 89 fc             	mov    %rdi,%r12
+  803de0:	49 89 f5             	mov    %rsi,%r13
+  803de3:	49 89 d7             	mov    %rdx,%r15
+  803de6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dea:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  803df1:	00 00 00 
+  803df4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803df6:	4d 85 ff             	test   %r15,%r15
+  803df9:	0f 84 af 00 00 00    	je     803eae <devpipe_write+0xe2>
+  803dff:	48 89 c3             	mov    %rax,%rbx
+  803e02:	4c 89 f8             	mov    %r15,%rax
+  803e05:	4d 89 ef             	mov    %r13,%r15
+  803e08:	4c 01 e8             	add    %r13,%rax
+  803e0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e0f:	49 bd 05 27 80 00 00 	movabs $0x802705,%r13
+  803e16:	00 00 00 
+            sys_yield();
+  803e19:	49 be 96 26 80 00 00 	movabs $0x802696,%r14
+  803e20:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e23:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e26:	48 63 ce             	movslq %esi,%rcx
+  803e29:	48 63 03             	movslq (%rbx),%rax
+  803e2c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e32:	48 39 c1             	cmp    %rax,%rcx
+  803e35:	72 2e                	jb     803e65 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e37:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e3c:	48 89 da             	mov    %rbx,%rdx
+  803e3f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e44:	4c 89 e7             	mov    %r12,%rdi
+  803e47:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e4a:	85 c0                	test   %eax,%eax
+  803e4c:	74 66                	je     803eb4 <devpipe_write+0xe8>
+            sys_yield();
+  803e4e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e51:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e54:	48 63 ce             	movslq %esi,%rcx
+  803e57:	48 63 03             	movslq (%rbx),%rax
+  803e5a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e60:	48 39 c1             	cmp    %rax,%rcx
+  803e63:	73 d2                	jae    803e37 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e65:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e69:	48 89 ca             	mov    %rcx,%rdx
+  803e6c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e70:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e77:	08 10 20 
+  803e7a:	48 f7 e2             	mul    %rdx
+  803e7d:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e81:	48 89 d0             	mov    %rdx,%rax
+  803e84:	48 c1 e0 09          	shl    $0x9,%rax
+  803e88:	48 29 d0             	sub    %rdx,%rax
+  803e8b:	48 c1 e0 03          	shl    $0x3,%rax
+  803e8f:	48 29 c1             	sub    %rax,%rcx
+  803e92:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e97:	83 c6 01             	add    $0x1,%esi
+  803e9a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e9d:	49 83 c7 01          	add    $0x1,%r15
+  803ea1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ea5:	49 39 c7             	cmp    %rax,%r15
+  803ea8:	0f 85 75 ff ff ff    	jne    803e23 <devpipe_write+0x57>
+    return n;
+  803eae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eb2:	eb 05                	jmp    803eb9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eb9:	48 83 c4 18          	add    $0x18,%rsp
+  803ebd:	5b                   	pop    %rbx
+  803ebe:	41 5c                	pop    %r12
+  803ec0:	41 5d                	pop    %r13
+  803ec2:	41 5e                	pop    %r14
+  803ec4:	41 5f                	pop    %r15
+  803ec6:	5d                   	pop    %rbp
+  803ec7:	c3                   	ret
+
+0000000000803ec8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ec8:	55                   	push   %rbp
+  803ec9:	48 89 e5             	mov    %rsp,%rbp
+  803ecc:	41 57                	push   %r15
+  803ece:	41 56                	push   %r14
+  803ed0:	41 55                	push   %r13
+  803ed2:	41 54                	push   %r12
+  803ed4:	53                   	push   %rbx
+  803ed5:	48 83 ec 18          	sub    $0x18,%rsp
+  803ed9:	49 89 fc             	mov    %rdi,%r12
+  803edc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ee0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ee4:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  803eeb:	00 00 00 
+  803eee:	ff d0                	call   *%rax
+  803ef0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ef3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ef9:	49 bd 05 27 80 00 00 	movabs $0x802705,%r13
+  803f00:	00 00 00 
+            sys_yield();
+  803f03:	49 be 96 26 80 00 00 	movabs $0x802696,%r14
+  803f0a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f0d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f12:	74 7d                	je     803f91 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f14:	8b 03                	mov    (%rbx),%eax
+  803f16:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f19:	75 26                	jne    803f41 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f1b:	4d 85 ff             	test   %r15,%r15
+  803f1e:	75 77                	jne    803f97 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f20:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f25:	48 89 da             	mov    %rbx,%rdx
+  803f28:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f2d:	4c 89 e7             	mov    %r12,%rdi
+  803f30:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f33:	85 c0                	test   %eax,%eax
+  803f35:	74 72                	je     803fa9 <devpipe_read+0xe1>
+            sys_yield();
+  803f37:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f3a:	8b 03                	mov    (%rbx),%eax
+  803f3c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f3f:	74 df                	je     803f20 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f41:	48 63 c8             	movslq %eax,%rcx
+  803f44:	48 89 ca             	mov    %rcx,%rdx
+  803f47:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f4b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f52:	08 10 20 
+  803f55:	48 89 d0             	mov    %rdx,%rax
+  803f58:	48 f7 e6             	mul    %rsi
+  803f5b:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f5f:	48 89 d0             	mov    %rdx,%rax
+  803f62:	48 c1 e0 09          	shl    $0x9,%rax
+  803f66:	48 29 d0             	sub    %rdx,%rax
+  803f69:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f70:	00 
+  803f71:	48 89 c8             	mov    %rcx,%rax
+  803f74:	48 29 d0             	sub    %rdx,%rax
+  803f77:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f7c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f80:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f84:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f87:	49 83 c7 01          	add    $0x1,%r15
+  803f8b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f8f:	75 83                	jne    803f14 <devpipe_read+0x4c>
+    return n;
+  803f91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f95:	eb 03                	jmp    803f9a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f97:	4c 89 f8             	mov    %r15,%rax
+}
+  803f9a:	48 83 c4 18          	add    $0x18,%rsp
+  803f9e:	5b                   	pop    %rbx
+  803f9f:	41 5c                	pop    %r12
+  803fa1:	41 5d                	pop    %r13
+  803fa3:	41 5e                	pop    %r14
+  803fa5:	41 5f                	pop    %r15
+  803fa7:	5d                   	pop    %rbp
+  803fa8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fae:	eb ea                	jmp    803f9a <devpipe_read+0xd2>
+
+0000000000803fb0 <pipe>:
+pipe(int pfd[2]) {
+  803fb0:	55                   	push   %rbp
+  803fb1:	48 89 e5             	mov    %rsp,%rbp
+  803fb4:	41 55                	push   %r13
+  803fb6:	41 54                	push   %r12
+  803fb8:	53                   	push   %rbx
+  803fb9:	48 83 ec 18          	sub    $0x18,%rsp
+  803fbd:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fc0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fc4:	48 b8 c3 2d 80 00 00 	movabs $0x802dc3,%rax
+  803fcb:	00 00 00 
+  803fce:	ff d0                	call   *%rax
+  803fd0:	89 c3                	mov    %eax,%ebx
+  803fd2:	85 c0                	test   %eax,%eax
+  803fd4:	0f 88 a0 01 00 00    	js     80417a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fda:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fdf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fe8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fed:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  803ff4:	00 00 00 
+  803ff7:	ff d0                	call   *%rax
+  803ff9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	0f 88 77 01 00 00    	js     80417a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804003:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804007:	48 b8 c3 2d 80 00 00 	movabs $0x802dc3,%rax
+  80400e:	00 00 00 
+  804011:	ff d0                	call   *%rax
+  804013:	89 c3                	mov    %eax,%ebx
+  804015:	85 c0                	test   %eax,%eax
+  804017:	0f 88 43 01 00 00    	js     804160 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80401d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804022:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804027:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80402b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804030:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  804037:	00 00 00 
+  80403a:	ff d0                	call   *%rax
+  80403c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80403e:	85 c0                	test   %eax,%eax
+  804040:	0f 88 1a 01 00 00    	js     804160 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804046:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80404a:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  804051:	00 00 00 
+  804054:	ff d0                	call   *%rax
+  804056:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804059:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80405e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804063:	48 89 c6             	mov    %rax,%rsi
+  804066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80406b:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  804072:	00 00 00 
+  804075:	ff d0                	call   *%rax
+  804077:	89 c3                	mov    %eax,%ebx
+  804079:	85 c0                	test   %eax,%eax
+  80407b:	0f 88 c5 00 00 00    	js     804146 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804081:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804085:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  80408c:	00 00 00 
+  80408f:	ff d0                	call   *%rax
+  804091:	48 89 c1             	mov    %rax,%rcx
+  804094:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80409a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a5:	4c 89 ee             	mov    %r13,%rsi
+  8040a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ad:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  8040b4:	00 00 00 
+  8040b7:	ff d0                	call   *%rax
+  8040b9:	89 c3                	mov    %eax,%ebx
+  8040bb:	85 c0                	test   %eax,%eax
+  8040bd:	78 6e                	js     80412d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040bf:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040c4:	4c 89 ef             	mov    %r13,%rdi
+  8040c7:	48 b8 cd 26 80 00 00 	movabs $0x8026cd,%rax
+  8040ce:	00 00 00 
+  8040d1:	ff d0                	call   *%rax
+  8040d3:	83 f8 02             	cmp    $0x2,%eax
+  8040d6:	0f 85 ab 00 00 00    	jne    804187 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040dc:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040e3:	00 00 
+  8040e5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040e9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040eb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040ef:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040f6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040fa:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804100:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804107:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80410b:	48 bb 95 2d 80 00 00 	movabs $0x802d95,%rbx
+  804112:	00 00 00 
+  804115:	ff d3                	call   *%rbx
+  804117:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80411b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80411f:	ff d3                	call   *%rbx
+  804121:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804126:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80412b:	eb 4d                	jmp    80417a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80412d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804132:	4c 89 ee             	mov    %r13,%rsi
+  804135:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413a:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  804141:	00 00 00 
+  804144:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804146:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80414b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80414f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804154:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  80415b:	00 00 00 
+  80415e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804160:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804165:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80416e:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  804175:	00 00 00 
+  804178:	ff d0                	call   *%rax
+}
+  80417a:	89 d8                	mov    %ebx,%eax
+  80417c:	48 83 c4 18          	add    $0x18,%rsp
+  804180:	5b                   	pop    %rbx
+  804181:	41 5c                	pop    %r12
+  804183:	41 5d                	pop    %r13
+  804185:	5d                   	pop    %rbp
+  804186:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804187:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  80418e:	00 00 00 
+  804191:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804198:	00 00 00 
+  80419b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041a0:	48 bf 97 62 80 00 00 	movabs $0x806297,%rdi
+  8041a7:	00 00 00 
+  8041aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041af:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  8041b6:	00 00 00 
+  8041b9:	41 ff d0             	call   *%r8
+
+00000000008041bc <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041bc:	55                   	push   %rbp
+  8041bd:	48 89 e5             	mov    %rsp,%rbp
+  8041c0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041c4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041c8:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  8041cf:	00 00 00 
+  8041d2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041d4:	85 c0                	test   %eax,%eax
+  8041d6:	78 35                	js     80420d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041d8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041dc:	48 b8 a7 2d 80 00 00 	movabs $0x802da7,%rax
+  8041e3:	00 00 00 
+  8041e6:	ff d0                	call   *%rax
+  8041e8:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041eb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041f0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041f5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041f9:	48 b8 05 27 80 00 00 	movabs $0x802705,%rax
+  804200:	00 00 00 
+  804203:	ff d0                	call   *%rax
+  804205:	85 c0                	test   %eax,%eax
+  804207:	0f 94 c0             	sete   %al
+  80420a:	0f b6 c0             	movzbl %al,%eax
+}
+  80420d:	c9                   	leave
+  80420e:	c3                   	ret
+
+000000000080420f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80420f:	48 89 f8             	mov    %rdi,%rax
+  804212:	48 c1 e8 27          	shr    $0x27,%rax
+  804216:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80421d:	01 00 00 
+  804220:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804224:	f6 c2 01             	test   $0x1,%dl
+  804227:	74 6d                	je     804296 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804229:	48 89 f8             	mov    %rdi,%rax
+  80422c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804230:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804237:	01 00 00 
+  80423a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80423e:	f6 c2 01             	test   $0x1,%dl
+  804241:	74 62                	je     8042a5 <get_uvpt_entry+0x96>
+  804243:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80424a:	01 00 00 
+  80424d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804251:	f6 c2 80             	test   $0x80,%dl
+  804254:	75 4f                	jne    8042a5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804256:	48 89 f8             	mov    %rdi,%rax
+  804259:	48 c1 e8 15          	shr    $0x15,%rax
+  80425d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804264:	01 00 00 
+  804267:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80426b:	f6 c2 01             	test   $0x1,%dl
+  80426e:	74 44                	je     8042b4 <get_uvpt_entry+0xa5>
+  804270:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804277:	01 00 00 
+  80427a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80427e:	f6 c2 80             	test   $0x80,%dl
+  804281:	75 31                	jne    8042b4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804283:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804287:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80428e:	01 00 00 
+  804291:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804295:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804296:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80429d:	01 00 00 
+  8042a0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042a4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042a5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042ac:	01 00 00 
+  8042af:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042b3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042b4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042bb:	01 00 00 
+  8042be:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042c2:	c3                   	ret
+
+00000000008042c3 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042c3:	55                   	push   %rbp
+  8042c4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042c7:	48 b8 0f 42 80 00 00 	movabs $0x80420f,%rax
+  8042ce:	00 00 00 
+  8042d1:	ff d0                	call   *%rax
+  8042d3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042d6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042db:	89 c1                	mov    %eax,%ecx
+  8042dd:	83 c9 04             	or     $0x4,%ecx
+  8042e0:	f6 c2 01             	test   $0x1,%dl
+  8042e3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042e6:	89 c1                	mov    %eax,%ecx
+  8042e8:	83 c9 02             	or     $0x2,%ecx
+  8042eb:	f6 c2 02             	test   $0x2,%dl
+  8042ee:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042f1:	89 c1                	mov    %eax,%ecx
+  8042f3:	83 c9 01             	or     $0x1,%ecx
+  8042f6:	48 85 d2             	test   %rdx,%rdx
+  8042f9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042fc:	89 c1                	mov    %eax,%ecx
+  8042fe:	83 c9 40             	or     $0x40,%ecx
+  804301:	f6 c6 04             	test   $0x4,%dh
+  804304:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804307:	5d                   	pop    %rbp
+  804308:	c3                   	ret
+
+0000000000804309 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804309:	55                   	push   %rbp
+  80430a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80430d:	48 b8 0f 42 80 00 00 	movabs $0x80420f,%rax
+  804314:	00 00 00 
+  804317:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804319:	48 c1 e8 06          	shr    $0x6,%rax
+  80431d:	83 e0 01             	and    $0x1,%eax
+}
+  804320:	5d                   	pop    %rbp
+  804321:	c3                   	ret
+
+0000000000804322 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804322:	55                   	push   %rbp
+  804323:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804326:	48 b8 0f 42 80 00 00 	movabs $0x80420f,%rax
+  80432d:	00 00 00 
+  804330:	ff d0                	call   *%rax
+  804332:	83 e0 01             	and    $0x1,%eax
+}
+  804335:	5d                   	pop    %rbp
+  804336:	c3                   	ret
+
+0000000000804337 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804337:	55                   	push   %rbp
+  804338:	48 89 e5             	mov    %rsp,%rbp
+  80433b:	41 57                	push   %r15
+  80433d:	41 56                	push   %r14
+  80433f:	41 55                	push   %r13
+  804341:	41 54                	push   %r12
+  804343:	53                   	push   %rbx
+  804344:	48 83 ec 28          	sub    $0x28,%rsp
+  804348:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80434c:	48 85 ff             	test   %rdi,%rdi
+  80434f:	74 1e                	je     80436f <foreach_shared_region+0x38>
+  804351:	49 89 ff             	mov    %rdi,%r15
+  804354:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80435a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804360:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804367:	01 00 00 
+  80436a:	e9 72 02 00 00       	jmp    8045e1 <foreach_shared_region+0x2aa>
+    assert(fun);
+  80436f:	48 b9 cc 62 80 00 00 	movabs $0x8062cc,%rcx
+  804376:	00 00 00 
+  804379:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804380:	00 00 00 
+  804383:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804388:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  80438f:	00 00 00 
+  804392:	b8 00 00 00 00       	mov    $0x0,%eax
+  804397:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  80439e:	00 00 00 
+  8043a1:	41 ff d0             	call   *%r8
+  8043a4:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043ab:	eb 6c                	jmp    804419 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043ad:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043b4:	ff ff ff 
+  8043b7:	4c 21 e2             	and    %r12,%rdx
+  8043ba:	48 89 d8             	mov    %rbx,%rax
+  8043bd:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043c2:	48 83 c0 01          	add    $0x1,%rax
+  8043c6:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043ca:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043d1:	00 00 00 
+  8043d4:	48 21 c8             	and    %rcx,%rax
+  8043d7:	48 09 d0             	or     %rdx,%rax
+  8043da:	49 89 c4             	mov    %rax,%r12
+  8043dd:	eb 30                	jmp    80440f <foreach_shared_region+0xd8>
+  8043df:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043e6:	ff ff ff 
+  8043e9:	4c 21 e2             	and    %r12,%rdx
+  8043ec:	48 89 d8             	mov    %rbx,%rax
+  8043ef:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043f4:	48 83 c0 01          	add    $0x1,%rax
+  8043f8:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043fc:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804403:	00 00 00 
+  804406:	48 21 c8             	and    %rcx,%rax
+  804409:	48 09 d0             	or     %rdx,%rax
+  80440c:	49 89 c4             	mov    %rax,%r12
+  80440f:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804413:	0f 84 99 01 00 00    	je     8045b2 <foreach_shared_region+0x27b>
+  804419:	4c 89 e3             	mov    %r12,%rbx
+  80441c:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804420:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804427:	01 00 00 
+  80442a:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80442e:	a8 01                	test   $0x1,%al
+  804430:	0f 84 77 ff ff ff    	je     8043ad <foreach_shared_region+0x76>
+  804436:	a8 80                	test   $0x80,%al
+  804438:	74 19                	je     804453 <foreach_shared_region+0x11c>
+  80443a:	f6 c4 04             	test   $0x4,%ah
+  80443d:	74 a0                	je     8043df <foreach_shared_region+0xa8>
+  80443f:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804446:	40 
+  804447:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80444b:	4c 89 e7             	mov    %r12,%rdi
+  80444e:	41 ff d7             	call   *%r15
+  804451:	eb 8c                	jmp    8043df <foreach_shared_region+0xa8>
+  804453:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80445a:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80445e:	eb 46                	jmp    8044a6 <foreach_shared_region+0x16f>
+  804460:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804467:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80446d:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804471:	48 c1 e0 15          	shl    $0x15,%rax
+  804475:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80447a:	49 09 c4             	or     %rax,%r12
+  80447d:	eb 1d                	jmp    80449c <foreach_shared_region+0x165>
+  80447f:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804486:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80448c:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804490:	48 c1 e0 15          	shl    $0x15,%rax
+  804494:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804499:	49 09 c4             	or     %rax,%r12
+  80449c:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044a0:	0f 84 d3 00 00 00    	je     804579 <foreach_shared_region+0x242>
+  8044a6:	4c 89 e3             	mov    %r12,%rbx
+  8044a9:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044ad:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044b4:	01 00 00 
+  8044b7:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044bb:	a8 01                	test   $0x1,%al
+  8044bd:	74 a1                	je     804460 <foreach_shared_region+0x129>
+  8044bf:	a8 80                	test   $0x80,%al
+  8044c1:	74 19                	je     8044dc <foreach_shared_region+0x1a5>
+  8044c3:	f6 c4 04             	test   $0x4,%ah
+  8044c6:	74 b7                	je     80447f <foreach_shared_region+0x148>
+  8044c8:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044cf:	00 
+  8044d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044d4:	4c 89 e7             	mov    %r12,%rdi
+  8044d7:	41 ff d7             	call   *%r15
+  8044da:	eb a3                	jmp    80447f <foreach_shared_region+0x148>
+  8044dc:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044e2:	eb 3b                	jmp    80451f <foreach_shared_region+0x1e8>
+  8044e4:	f6 c4 04             	test   $0x4,%ah
+  8044e7:	74 12                	je     8044fb <foreach_shared_region+0x1c4>
+  8044e9:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044f0:	00 
+  8044f1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044f5:	4c 89 e7             	mov    %r12,%rdi
+  8044f8:	41 ff d7             	call   *%r15
+  8044fb:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804502:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804508:	48 83 c3 01          	add    $0x1,%rbx
+  80450c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804510:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804516:	49 09 dc             	or     %rbx,%r12
+  804519:	41 83 ed 01          	sub    $0x1,%r13d
+  80451d:	74 2f                	je     80454e <foreach_shared_region+0x217>
+  80451f:	4c 89 e3             	mov    %r12,%rbx
+  804522:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804526:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80452a:	a8 01                	test   $0x1,%al
+  80452c:	75 b6                	jne    8044e4 <foreach_shared_region+0x1ad>
+  80452e:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804535:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80453b:	48 83 c3 01          	add    $0x1,%rbx
+  80453f:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804543:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804549:	49 09 dc             	or     %rbx,%r12
+  80454c:	eb cb                	jmp    804519 <foreach_shared_region+0x1e2>
+  80454e:	4c 89 e0             	mov    %r12,%rax
+  804551:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804557:	49 c1 ec 15          	shr    $0x15,%r12
+  80455b:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804562:	49 83 c4 01          	add    $0x1,%r12
+  804566:	49 c1 e4 15          	shl    $0x15,%r12
+  80456a:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804571:	49 09 c4             	or     %rax,%r12
+  804574:	e9 23 ff ff ff       	jmp    80449c <foreach_shared_region+0x165>
+  804579:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80457d:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804584:	ff ff ff 
+  804587:	4c 21 e0             	and    %r12,%rax
+  80458a:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80458e:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804595:	49 83 c4 01          	add    $0x1,%r12
+  804599:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80459d:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045a4:	00 00 00 
+  8045a7:	49 21 d4             	and    %rdx,%r12
+  8045aa:	49 09 c4             	or     %rax,%r12
+  8045ad:	e9 5d fe ff ff       	jmp    80440f <foreach_shared_region+0xd8>
+  8045b2:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045b9:	00 ff ff 
+  8045bc:	4c 21 e0             	and    %r12,%rax
+  8045bf:	49 c1 ec 27          	shr    $0x27,%r12
+  8045c3:	49 83 c4 01          	add    $0x1,%r12
+  8045c7:	49 c1 e4 27          	shl    $0x27,%r12
+  8045cb:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045d2:	ff 00 00 
+  8045d5:	49 21 d4             	and    %rdx,%r12
+  8045d8:	49 09 c4             	or     %rax,%r12
+  8045db:	41 83 ed 01          	sub    $0x1,%r13d
+  8045df:	74 48                	je     804629 <foreach_shared_region+0x2f2>
+  8045e1:	4c 89 e0             	mov    %r12,%rax
+  8045e4:	48 c1 e8 27          	shr    $0x27,%rax
+  8045e8:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045ef:	01 00 00 
+  8045f2:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045f6:	f6 c2 01             	test   $0x1,%dl
+  8045f9:	0f 85 a5 fd ff ff    	jne    8043a4 <foreach_shared_region+0x6d>
+  8045ff:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804606:	00 ff ff 
+  804609:	4c 21 e2             	and    %r12,%rdx
+  80460c:	48 83 c0 01          	add    $0x1,%rax
+  804610:	48 c1 e0 27          	shl    $0x27,%rax
+  804614:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80461b:	ff 00 00 
+  80461e:	48 21 c8             	and    %rcx,%rax
+  804621:	48 09 d0             	or     %rdx,%rax
+  804624:	49 89 c4             	mov    %rax,%r12
+  804627:	eb b2                	jmp    8045db <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804629:	4d 85 e4             	test   %r12,%r12
+  80462c:	75 14                	jne    804642 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80462e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804633:	48 83 c4 28          	add    $0x28,%rsp
+  804637:	5b                   	pop    %rbx
+  804638:	41 5c                	pop    %r12
+  80463a:	41 5d                	pop    %r13
+  80463c:	41 5e                	pop    %r14
+  80463e:	41 5f                	pop    %r15
+  804640:	5d                   	pop    %rbp
+  804641:	c3                   	ret
+    assert(addr == 0);
+  804642:	48 b9 db 62 80 00 00 	movabs $0x8062db,%rcx
+  804649:	00 00 00 
+  80464c:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804653:	00 00 00 
+  804656:	be 67 00 00 00       	mov    $0x67,%esi
+  80465b:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  804662:	00 00 00 
+  804665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80466a:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  804671:	00 00 00 
+  804674:	41 ff d0             	call   *%r8
+
+0000000000804677 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804677:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  80467e:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804681:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804687:	eb 33                	jmp    8046bc <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804689:	48 83 c0 20          	add    $0x20,%rax
+  80468d:	4c 39 c0             	cmp    %r8,%rax
+  804690:	74 25                	je     8046b7 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804692:	48 8b 10             	mov    (%rax),%rdx
+  804695:	48 85 d2             	test   %rdx,%rdx
+  804698:	74 ef                	je     804689 <mmap_place+0x12>
+  80469a:	48 89 d1             	mov    %rdx,%rcx
+  80469d:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046a1:	48 39 cf             	cmp    %rcx,%rdi
+  8046a4:	73 e3                	jae    804689 <mmap_place+0x12>
+  8046a6:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046aa:	4c 39 ca             	cmp    %r9,%rdx
+  8046ad:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046b1:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046b5:	eb d2                	jmp    804689 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046b7:	45 84 d2             	test   %r10b,%r10b
+  8046ba:	74 12                	je     8046ce <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046bc:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046c3:	00 00 00 
+        moved = 0;
+  8046c6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046cc:	eb c4                	jmp    804692 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046ce:	48 01 fe             	add    %rdi,%rsi
+  8046d1:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046d8:	00 00 00 
+  8046db:	48 39 f0             	cmp    %rsi,%rax
+  8046de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e3:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046e7:	c3                   	ret
+
+00000000008046e8 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046e8:	55                   	push   %rbp
+  8046e9:	48 89 e5             	mov    %rsp,%rbp
+  8046ec:	41 57                	push   %r15
+  8046ee:	41 56                	push   %r14
+  8046f0:	41 55                	push   %r13
+  8046f2:	41 54                	push   %r12
+  8046f4:	53                   	push   %rbx
+  8046f5:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046f9:	48 8b 1f             	mov    (%rdi),%rbx
+  8046fc:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804703:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80470a:	00 00 00 
+  80470d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804712:	eb 12                	jmp    804726 <mmap_pgfault+0x3e>
+  804714:	48 83 c2 01          	add    $0x1,%rdx
+  804718:	48 83 c0 20          	add    $0x20,%rax
+  80471c:	48 83 fa 20          	cmp    $0x20,%rdx
+  804720:	0f 84 04 01 00 00    	je     80482a <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804726:	48 8b 08             	mov    (%rax),%rcx
+  804729:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80472d:	48 39 de             	cmp    %rbx,%rsi
+  804730:	73 e2                	jae    804714 <mmap_pgfault+0x2c>
+  804732:	48 03 48 08          	add    0x8(%rax),%rcx
+  804736:	48 39 cb             	cmp    %rcx,%rbx
+  804739:	73 d9                	jae    804714 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80473b:	48 c1 e2 05          	shl    $0x5,%rdx
+  80473f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804746:	00 00 00 
+  804749:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80474d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804751:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804755:	f6 c2 01             	test   $0x1,%dl
+  804758:	0f 84 e0 00 00 00    	je     80483e <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80475e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804763:	f6 c2 02             	test   $0x2,%dl
+  804766:	0f 84 c3 00 00 00    	je     80482f <mmap_pgfault+0x147>
+  80476c:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804773:	ff ff ff 
+  804776:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80477a:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804781:	00 00 00 
+  804784:	48 39 ca             	cmp    %rcx,%rdx
+  804787:	0f 85 a2 00 00 00    	jne    80482f <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80478d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804792:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804797:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80479e:	00 00 00 
+  8047a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047a6:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  8047ad:	00 00 00 
+  8047b0:	ff d0                	call   *%rax
+  8047b2:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b9:	85 d2                	test   %edx,%edx
+  8047bb:	78 72                	js     80482f <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c2:	48 89 de             	mov    %rbx,%rsi
+  8047c5:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047cc:	00 00 00 
+  8047cf:	4c 89 e7             	mov    %r12,%rdi
+  8047d2:	48 b8 89 23 80 00 00 	movabs $0x802389,%rax
+  8047d9:	00 00 00 
+  8047dc:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047de:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047e4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047ea:	48 89 d9             	mov    %rbx,%rcx
+  8047ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047f2:	4c 89 e6             	mov    %r12,%rsi
+  8047f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047fa:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  804801:	00 00 00 
+  804804:	ff d0                	call   *%rax
+  804806:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804808:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80480d:	4c 89 e6             	mov    %r12,%rsi
+  804810:	bf 00 00 00 00       	mov    $0x0,%edi
+  804815:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  80481c:	00 00 00 
+  80481f:	ff d0                	call   *%rax
+    return res >= 0;
+  804821:	89 d8                	mov    %ebx,%eax
+  804823:	f7 d0                	not    %eax
+  804825:	c1 e8 1f             	shr    $0x1f,%eax
+  804828:	eb 05                	jmp    80482f <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80482a:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80482f:	48 83 c4 18          	add    $0x18,%rsp
+  804833:	5b                   	pop    %rbx
+  804834:	41 5c                	pop    %r12
+  804836:	41 5d                	pop    %r13
+  804838:	41 5e                	pop    %r14
+  80483a:	41 5f                	pop    %r15
+  80483c:	5d                   	pop    %rbp
+  80483d:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80483e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804842:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804846:	4c 03 30             	add    (%rax),%r14
+  804849:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804850:	49 39 c6             	cmp    %rax,%r14
+  804853:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804857:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80485e:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804864:	49 bf 22 43 80 00 00 	movabs $0x804322,%r15
+  80486b:	00 00 00 
+  80486e:	4d 39 f4             	cmp    %r14,%r12
+  804871:	73 1d                	jae    804890 <mmap_pgfault+0x1a8>
+  804873:	4c 89 e7             	mov    %r12,%rdi
+  804876:	41 ff d7             	call   *%r15
+  804879:	84 c0                	test   %al,%al
+  80487b:	75 13                	jne    804890 <mmap_pgfault+0x1a8>
+  80487d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804884:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80488b:	4d 39 f4             	cmp    %r14,%r12
+  80488e:	72 e3                	jb     804873 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804890:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804896:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80489a:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80489e:	74 2a                	je     8048ca <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a4:	89 de                	mov    %ebx,%esi
+  8048a6:	2b 30                	sub    (%rax),%esi
+  8048a8:	03 70 1c             	add    0x1c(%rax),%esi
+  8048ab:	8b 78 18             	mov    0x18(%rax),%edi
+  8048ae:	4c 89 e9             	mov    %r13,%rcx
+  8048b1:	48 89 da             	mov    %rbx,%rdx
+  8048b4:	48 b8 80 3a 80 00 00 	movabs $0x803a80,%rax
+  8048bb:	00 00 00 
+  8048be:	ff d0                	call   *%rax
+    return res > 0;
+  8048c0:	85 c0                	test   %eax,%eax
+  8048c2:	0f 9f c0             	setg   %al
+  8048c5:	e9 65 ff ff ff       	jmp    80482f <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048ca:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048ce:	eb d0                	jmp    8048a0 <mmap_pgfault+0x1b8>
+
+00000000008048d0 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048d0:	55                   	push   %rbp
+  8048d1:	48 89 e5             	mov    %rsp,%rbp
+  8048d4:	41 57                	push   %r15
+  8048d6:	41 56                	push   %r14
+  8048d8:	41 55                	push   %r13
+  8048da:	41 54                	push   %r12
+  8048dc:	53                   	push   %rbx
+  8048dd:	48 83 ec 28          	sub    $0x28,%rsp
+  8048e1:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048e5:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048e8:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048ef:	ff ff ff 
+  8048f2:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048fb:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804902:	00 00 00 
+  804905:	48 39 ca             	cmp    %rcx,%rdx
+  804908:	0f 85 e5 00 00 00    	jne    8049f3 <mmap_writeback+0x123>
+  80490e:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804911:	4c 39 ee             	cmp    %r13,%rsi
+  804914:	0f 83 e8 00 00 00    	jae    804a02 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80491a:	49 be 22 43 80 00 00 	movabs $0x804322,%r14
+  804921:	00 00 00 
+  804924:	49 bf 09 43 80 00 00 	movabs $0x804309,%r15
+  80492b:	00 00 00 
+  80492e:	eb 10                	jmp    804940 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804930:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804937:	4d 39 ec             	cmp    %r13,%r12
+  80493a:	0f 83 ae 00 00 00    	jae    8049ee <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804940:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804944:	4c 89 e7             	mov    %r12,%rdi
+  804947:	41 ff d6             	call   *%r14
+  80494a:	84 c0                	test   %al,%al
+  80494c:	74 e2                	je     804930 <mmap_writeback+0x60>
+  80494e:	4c 89 e7             	mov    %r12,%rdi
+  804951:	41 ff d7             	call   *%r15
+  804954:	84 c0                	test   %al,%al
+  804956:	74 d8                	je     804930 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804958:	4c 89 e3             	mov    %r12,%rbx
+  80495b:	4d 39 ec             	cmp    %r13,%r12
+  80495e:	73 20                	jae    804980 <mmap_writeback+0xb0>
+  804960:	48 89 df             	mov    %rbx,%rdi
+  804963:	41 ff d6             	call   *%r14
+  804966:	84 c0                	test   %al,%al
+  804968:	74 16                	je     804980 <mmap_writeback+0xb0>
+  80496a:	48 89 df             	mov    %rbx,%rdi
+  80496d:	41 ff d7             	call   *%r15
+  804970:	84 c0                	test   %al,%al
+  804972:	74 0c                	je     804980 <mmap_writeback+0xb0>
+  804974:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80497b:	4c 39 eb             	cmp    %r13,%rbx
+  80497e:	72 e0                	jb     804960 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804980:	48 89 d9             	mov    %rbx,%rcx
+  804983:	4c 29 e1             	sub    %r12,%rcx
+  804986:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80498a:	44 89 e6             	mov    %r12d,%esi
+  80498d:	2b 30                	sub    (%rax),%esi
+  80498f:	49 89 c4             	mov    %rax,%r12
+  804992:	03 70 1c             	add    0x1c(%rax),%esi
+  804995:	8b 78 18             	mov    0x18(%rax),%edi
+  804998:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80499c:	48 89 ca             	mov    %rcx,%rdx
+  80499f:	48 b8 09 3b 80 00 00 	movabs $0x803b09,%rax
+  8049a6:	00 00 00 
+  8049a9:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049ab:	85 c0                	test   %eax,%eax
+  8049ad:	78 44                	js     8049f3 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049af:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049b4:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049b7:	41 89 c1             	mov    %eax,%r9d
+  8049ba:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049c1:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049c5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ce:	48 89 ce             	mov    %rcx,%rsi
+  8049d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049d6:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  8049dd:	00 00 00 
+  8049e0:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049e2:	85 c0                	test   %eax,%eax
+  8049e4:	78 0d                	js     8049f3 <mmap_writeback+0x123>
+  8049e6:	49 89 dc             	mov    %rbx,%r12
+  8049e9:	e9 49 ff ff ff       	jmp    804937 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049f3:	48 83 c4 28          	add    $0x28,%rsp
+  8049f7:	5b                   	pop    %rbx
+  8049f8:	41 5c                	pop    %r12
+  8049fa:	41 5d                	pop    %r13
+  8049fc:	41 5e                	pop    %r14
+  8049fe:	41 5f                	pop    %r15
+  804a00:	5d                   	pop    %rbp
+  804a01:	c3                   	ret
+    return 0;
+  804a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a07:	eb ea                	jmp    8049f3 <mmap_writeback+0x123>
+
+0000000000804a09 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a09:	55                   	push   %rbp
+  804a0a:	48 89 e5             	mov    %rsp,%rbp
+  804a0d:	41 57                	push   %r15
+  804a0f:	41 56                	push   %r14
+  804a11:	41 55                	push   %r13
+  804a13:	41 54                	push   %r12
+  804a15:	53                   	push   %rbx
+  804a16:	48 83 ec 38          	sub    $0x38,%rsp
+  804a1a:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a1e:	48 85 f6             	test   %rsi,%rsi
+  804a21:	0f 84 0c 02 00 00    	je     804c33 <mmap+0x22a>
+  804a27:	49 89 ff             	mov    %rdi,%r15
+  804a2a:	49 89 f4             	mov    %rsi,%r12
+  804a2d:	41 89 d5             	mov    %edx,%r13d
+  804a30:	41 89 ce             	mov    %ecx,%r14d
+  804a33:	44 89 cb             	mov    %r9d,%ebx
+  804a36:	45 85 c9             	test   %r9d,%r9d
+  804a39:	0f 88 f4 01 00 00    	js     804c33 <mmap+0x22a>
+  804a3f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a46:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a4d:	0f 85 e7 01 00 00    	jne    804c3a <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a53:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a56:	83 fa 04             	cmp    $0x4,%edx
+  804a59:	0f 85 db 01 00 00    	jne    804c3a <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a5f:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a62:	83 fa 01             	cmp    $0x1,%edx
+  804a65:	0f 87 cf 01 00 00    	ja     804c3a <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a6b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a6f:	44 89 c7             	mov    %r8d,%edi
+  804a72:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  804a79:	00 00 00 
+  804a7c:	ff d0                	call   *%rax
+  804a7e:	89 c2                	mov    %eax,%edx
+  804a80:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a87:	85 d2                	test   %edx,%edx
+  804a89:	0f 88 ab 01 00 00    	js     804c3a <mmap+0x231>
+  804a8f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a93:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a9a:	00 00 00 
+  804a9d:	8b 09                	mov    (%rcx),%ecx
+  804a9f:	39 0a                	cmp    %ecx,(%rdx)
+  804aa1:	0f 85 93 01 00 00    	jne    804c3a <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804aa7:	8b 52 08             	mov    0x8(%rdx),%edx
+  804aaa:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804aad:	83 fa 01             	cmp    $0x1,%edx
+  804ab0:	0f 84 84 01 00 00    	je     804c3a <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ab6:	41 83 fe 01          	cmp    $0x1,%r14d
+  804aba:	74 42                	je     804afe <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804abc:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804ac3:	4c 89 e6             	mov    %r12,%rsi
+  804ac6:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804acd:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ad1:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ad5:	4d 85 ff             	test   %r15,%r15
+  804ad8:	74 67                	je     804b41 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ada:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ae1:	75 0f                	jne    804af2 <mmap+0xe9>
+  804ae3:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804aea:	00 00 00 
+  804aed:	49 39 c7             	cmp    %rax,%r15
+  804af0:	77 1b                	ja     804b0d <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804af2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804af9:	e9 3c 01 00 00       	jmp    804c3a <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804afe:	41 f6 c5 02          	test   $0x2,%r13b
+  804b02:	74 b8                	je     804abc <mmap+0xb3>
+  804b04:	85 d2                	test   %edx,%edx
+  804b06:	75 b4                	jne    804abc <mmap+0xb3>
+  804b08:	e9 2d 01 00 00       	jmp    804c3a <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b0d:	4c 89 ff             	mov    %r15,%rdi
+  804b10:	48 b8 77 46 80 00 00 	movabs $0x804677,%rax
+  804b17:	00 00 00 
+  804b1a:	ff d0                	call   *%rax
+  804b1c:	48 89 c2             	mov    %rax,%rdx
+  804b1f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b26:	49 39 d7             	cmp    %rdx,%r15
+  804b29:	0f 85 0b 01 00 00    	jne    804c3a <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b2f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b36:	00 00 00 
+  804b39:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b3f:	eb 44                	jmp    804b85 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b41:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b45:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b4c:	00 00 00 
+  804b4f:	48 b8 77 46 80 00 00 	movabs $0x804677,%rax
+  804b56:	00 00 00 
+  804b59:	ff d0                	call   *%rax
+  804b5b:	48 89 c7             	mov    %rax,%rdi
+  804b5e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b62:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b69:	48 85 ff             	test   %rdi,%rdi
+  804b6c:	75 c1                	jne    804b2f <mmap+0x126>
+  804b6e:	e9 c7 00 00 00       	jmp    804c3a <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b73:	49 83 c4 01          	add    $0x1,%r12
+  804b77:	48 83 c0 20          	add    $0x20,%rax
+  804b7b:	49 83 fc 20          	cmp    $0x20,%r12
+  804b7f:	0f 84 a5 00 00 00    	je     804c2a <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b85:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b89:	75 e8                	jne    804b73 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b8b:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b8f:	48 b8 c3 2d 80 00 00 	movabs $0x802dc3,%rax
+  804b96:	00 00 00 
+  804b99:	ff d0                	call   *%rax
+  804b9b:	89 c2                	mov    %eax,%edx
+  804b9d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ba4:	85 d2                	test   %edx,%edx
+  804ba6:	0f 88 8e 00 00 00    	js     804c3a <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bac:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bb0:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  804bb7:	00 00 00 
+  804bba:	ff d0                	call   *%rax
+  804bbc:	89 c6                	mov    %eax,%esi
+  804bbe:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bc1:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  804bc8:	00 00 00 
+  804bcb:	ff d0                	call   *%rax
+  804bcd:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bd0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bd7:	45 85 ff             	test   %r15d,%r15d
+  804bda:	78 5e                	js     804c3a <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bdc:	49 c1 e4 05          	shl    $0x5,%r12
+  804be0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804be7:	00 00 00 
+  804bea:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bed:	48 bf e8 46 80 00 00 	movabs $0x8046e8,%rdi
+  804bf4:	00 00 00 
+  804bf7:	48 b8 b6 51 80 00 00 	movabs $0x8051b6,%rax
+  804bfe:	00 00 00 
+  804c01:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c03:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c07:	49 89 04 24          	mov    %rax,(%r12)
+  804c0b:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c0f:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c14:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c19:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c1e:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c23:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c28:	eb 10                	jmp    804c3a <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c2a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c31:	eb 07                	jmp    804c3a <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c33:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c3a:	48 83 c4 38          	add    $0x38,%rsp
+  804c3e:	5b                   	pop    %rbx
+  804c3f:	41 5c                	pop    %r12
+  804c41:	41 5d                	pop    %r13
+  804c43:	41 5e                	pop    %r14
+  804c45:	41 5f                	pop    %r15
+  804c47:	5d                   	pop    %rbp
+  804c48:	c3                   	ret
+
+0000000000804c49 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c49:	55                   	push   %rbp
+  804c4a:	48 89 e5             	mov    %rsp,%rbp
+  804c4d:	41 57                	push   %r15
+  804c4f:	41 56                	push   %r14
+  804c51:	41 55                	push   %r13
+  804c53:	41 54                	push   %r12
+  804c55:	53                   	push   %rbx
+  804c56:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c5a:	49 89 fe             	mov    %rdi,%r14
+  804c5d:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c64:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c6b:	00 
+  804c6c:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c73:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c7a:	00 00 00 
+  804c7d:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c84:	49 bf d0 48 80 00 00 	movabs $0x8048d0,%r15
+  804c8b:	00 00 00 
+  804c8e:	eb 09                	jmp    804c99 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c90:	48 83 c3 20          	add    $0x20,%rbx
+  804c94:	4c 39 eb             	cmp    %r13,%rbx
+  804c97:	74 33                	je     804ccc <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c99:	48 89 df             	mov    %rbx,%rdi
+  804c9c:	48 8b 33             	mov    (%rbx),%rsi
+  804c9f:	4c 39 e6             	cmp    %r12,%rsi
+  804ca2:	73 ec                	jae    804c90 <msync+0x47>
+  804ca4:	48 85 f6             	test   %rsi,%rsi
+  804ca7:	74 e7                	je     804c90 <msync+0x47>
+  804ca9:	48 89 f2             	mov    %rsi,%rdx
+  804cac:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cb0:	49 39 d6             	cmp    %rdx,%r14
+  804cb3:	73 db                	jae    804c90 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cb5:	4c 39 e2             	cmp    %r12,%rdx
+  804cb8:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cbc:	4c 39 f6             	cmp    %r14,%rsi
+  804cbf:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cc3:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cc6:	85 c0                	test   %eax,%eax
+  804cc8:	79 c6                	jns    804c90 <msync+0x47>
+  804cca:	eb 05                	jmp    804cd1 <msync+0x88>
+    }
+
+    return 0;
+  804ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cd1:	48 83 c4 08          	add    $0x8,%rsp
+  804cd5:	5b                   	pop    %rbx
+  804cd6:	41 5c                	pop    %r12
+  804cd8:	41 5d                	pop    %r13
+  804cda:	41 5e                	pop    %r14
+  804cdc:	41 5f                	pop    %r15
+  804cde:	5d                   	pop    %rbp
+  804cdf:	c3                   	ret
+
+0000000000804ce0 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804ce0:	55                   	push   %rbp
+  804ce1:	48 89 e5             	mov    %rsp,%rbp
+  804ce4:	41 57                	push   %r15
+  804ce6:	41 56                	push   %r14
+  804ce8:	41 55                	push   %r13
+  804cea:	41 54                	push   %r12
+  804cec:	53                   	push   %rbx
+  804ced:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cf1:	49 89 ff             	mov    %rdi,%r15
+  804cf4:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cfb:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d02:	00 
+  804d03:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d0a:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d11:	00 00 00 
+  804d14:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d1b:	48 89 d8             	mov    %rbx,%rax
+  804d1e:	eb 09                	jmp    804d29 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d20:	48 83 c0 20          	add    $0x20,%rax
+  804d24:	4c 39 f0             	cmp    %r14,%rax
+  804d27:	74 40                	je     804d69 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d29:	48 8b 10             	mov    (%rax),%rdx
+  804d2c:	4c 39 e2             	cmp    %r12,%rdx
+  804d2f:	73 ef                	jae    804d20 <munmap+0x40>
+  804d31:	48 85 d2             	test   %rdx,%rdx
+  804d34:	74 ea                	je     804d20 <munmap+0x40>
+  804d36:	48 89 d7             	mov    %rdx,%rdi
+  804d39:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d3d:	49 39 ff             	cmp    %rdi,%r15
+  804d40:	73 de                	jae    804d20 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d42:	49 39 fc             	cmp    %rdi,%r12
+  804d45:	72 05                	jb     804d4c <munmap+0x6c>
+  804d47:	4c 39 fa             	cmp    %r15,%rdx
+  804d4a:	73 d4                	jae    804d20 <munmap+0x40>
+  804d4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d51:	48 83 c4 08          	add    $0x8,%rsp
+  804d55:	5b                   	pop    %rbx
+  804d56:	41 5c                	pop    %r12
+  804d58:	41 5d                	pop    %r13
+  804d5a:	41 5e                	pop    %r14
+  804d5c:	41 5f                	pop    %r15
+  804d5e:	5d                   	pop    %rbp
+  804d5f:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d60:	48 83 c3 20          	add    $0x20,%rbx
+  804d64:	4c 39 f3             	cmp    %r14,%rbx
+  804d67:	74 5c                	je     804dc5 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d69:	48 8b 33             	mov    (%rbx),%rsi
+  804d6c:	4c 39 e6             	cmp    %r12,%rsi
+  804d6f:	73 ef                	jae    804d60 <munmap+0x80>
+  804d71:	48 85 f6             	test   %rsi,%rsi
+  804d74:	74 ea                	je     804d60 <munmap+0x80>
+  804d76:	48 89 f2             	mov    %rsi,%rdx
+  804d79:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d7d:	49 39 d7             	cmp    %rdx,%r15
+  804d80:	73 de                	jae    804d60 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d82:	48 89 df             	mov    %rbx,%rdi
+  804d85:	48 b8 d0 48 80 00 00 	movabs $0x8048d0,%rax
+  804d8c:	00 00 00 
+  804d8f:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d91:	85 c0                	test   %eax,%eax
+  804d93:	78 bc                	js     804d51 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d95:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d99:	48 8b 33             	mov    (%rbx),%rsi
+  804d9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804da1:	48 b8 0f 28 80 00 00 	movabs $0x80280f,%rax
+  804da8:	00 00 00 
+  804dab:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804dad:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804db0:	48 b8 88 2f 80 00 00 	movabs $0x802f88,%rax
+  804db7:	00 00 00 
+  804dba:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dbc:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dc3:	eb 9b                	jmp    804d60 <munmap+0x80>
+    return 0;
+  804dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dca:	eb 85                	jmp    804d51 <munmap+0x71>
+
+0000000000804dcc <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd1:	c3                   	ret
+
+0000000000804dd2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dd2:	55                   	push   %rbp
+  804dd3:	48 89 e5             	mov    %rsp,%rbp
+  804dd6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dd9:	48 be e5 62 80 00 00 	movabs $0x8062e5,%rsi
+  804de0:	00 00 00 
+  804de3:	48 b8 d2 1f 80 00 00 	movabs $0x801fd2,%rax
+  804dea:	00 00 00 
+  804ded:	ff d0                	call   *%rax
+    return 0;
+}
+  804def:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df4:	5d                   	pop    %rbp
+  804df5:	c3                   	ret
+
+0000000000804df6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804df6:	55                   	push   %rbp
+  804df7:	48 89 e5             	mov    %rsp,%rbp
+  804dfa:	41 57                	push   %r15
+  804dfc:	41 56                	push   %r14
+  804dfe:	41 55                	push   %r13
+  804e00:	41 54                	push   %r12
+  804e02:	53                   	push   %rbx
+  804e03:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e0a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e11:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e18:	00 00 00 00 
+  804e1c:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e23:	00 00 00 00 
+  804e27:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e2e:	00 00 00 00 
+  804e32:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e39:	00 00 00 00 
+  804e3d:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e44:	00 00 00 00 
+  804e48:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e4f:	00 00 00 00 
+  804e53:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e5a:	00 
+  804e5b:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e62:	00 
+  804e63:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e6a:	00 
+  804e6b:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e72:	00 
+  804e73:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e7a:	00 
+  804e7b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e82:	00 
+  804e83:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e8a:	00 
+  804e8b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e92:	00 
+  804e93:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e9a:	00 
+  804e9b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804ea2:	00 
+    for (res = 0; res < n; res += inc) {
+  804ea3:	48 85 d2             	test   %rdx,%rdx
+  804ea6:	74 7a                	je     804f22 <devcons_write+0x12c>
+  804ea8:	49 89 d6             	mov    %rdx,%r14
+  804eab:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804eb1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804eb6:	49 bf 22 23 80 00 00 	movabs $0x802322,%r15
+  804ebd:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ec0:	4c 89 f3             	mov    %r14,%rbx
+  804ec3:	48 29 f3             	sub    %rsi,%rbx
+  804ec6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ecb:	48 39 c3             	cmp    %rax,%rbx
+  804ece:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ed2:	4c 63 eb             	movslq %ebx,%r13
+  804ed5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804edc:	48 01 c6             	add    %rax,%rsi
+  804edf:	4c 89 ea             	mov    %r13,%rdx
+  804ee2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ee9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804eec:	4c 89 ee             	mov    %r13,%rsi
+  804eef:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ef6:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  804efd:	00 00 00 
+  804f00:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f02:	41 01 dc             	add    %ebx,%r12d
+  804f05:	49 63 f4             	movslq %r12d,%rsi
+  804f08:	4c 39 f6             	cmp    %r14,%rsi
+  804f0b:	72 b3                	jb     804ec0 <devcons_write+0xca>
+    return res;
+  804f0d:	49 63 c4             	movslq %r12d,%rax
+}
+  804f10:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f17:	5b                   	pop    %rbx
+  804f18:	41 5c                	pop    %r12
+  804f1a:	41 5d                	pop    %r13
+  804f1c:	41 5e                	pop    %r14
+  804f1e:	41 5f                	pop    %r15
+  804f20:	5d                   	pop    %rbp
+  804f21:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f22:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f28:	eb e3                	jmp    804f0d <devcons_write+0x117>
+
+0000000000804f2a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f2a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f32:	48 85 c0             	test   %rax,%rax
+  804f35:	74 55                	je     804f8c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f37:	55                   	push   %rbp
+  804f38:	48 89 e5             	mov    %rsp,%rbp
+  804f3b:	41 55                	push   %r13
+  804f3d:	41 54                	push   %r12
+  804f3f:	53                   	push   %rbx
+  804f40:	48 83 ec 08          	sub    $0x8,%rsp
+  804f44:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f47:	48 bb 82 25 80 00 00 	movabs $0x802582,%rbx
+  804f4e:	00 00 00 
+  804f51:	49 bc 96 26 80 00 00 	movabs $0x802696,%r12
+  804f58:	00 00 00 
+  804f5b:	eb 03                	jmp    804f60 <devcons_read+0x36>
+  804f5d:	41 ff d4             	call   *%r12
+  804f60:	ff d3                	call   *%rbx
+  804f62:	85 c0                	test   %eax,%eax
+  804f64:	74 f7                	je     804f5d <devcons_read+0x33>
+    if (c < 0) return c;
+  804f66:	48 63 d0             	movslq %eax,%rdx
+  804f69:	78 13                	js     804f7e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f70:	83 f8 04             	cmp    $0x4,%eax
+  804f73:	74 09                	je     804f7e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f75:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f79:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f7e:	48 89 d0             	mov    %rdx,%rax
+  804f81:	48 83 c4 08          	add    $0x8,%rsp
+  804f85:	5b                   	pop    %rbx
+  804f86:	41 5c                	pop    %r12
+  804f88:	41 5d                	pop    %r13
+  804f8a:	5d                   	pop    %rbp
+  804f8b:	c3                   	ret
+  804f8c:	48 89 d0             	mov    %rdx,%rax
+  804f8f:	c3                   	ret
+
+0000000000804f90 <cputchar>:
+cputchar(int ch) {
+  804f90:	55                   	push   %rbp
+  804f91:	48 89 e5             	mov    %rsp,%rbp
+  804f94:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f98:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f9c:	be 01 00 00 00       	mov    $0x1,%esi
+  804fa1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fa5:	48 b8 4f 25 80 00 00 	movabs $0x80254f,%rax
+  804fac:	00 00 00 
+  804faf:	ff d0                	call   *%rax
+}
+  804fb1:	c9                   	leave
+  804fb2:	c3                   	ret
+
+0000000000804fb3 <getchar>:
+getchar(void) {
+  804fb3:	55                   	push   %rbp
+  804fb4:	48 89 e5             	mov    %rsp,%rbp
+  804fb7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fbb:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fc0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fc9:	48 b8 06 31 80 00 00 	movabs $0x803106,%rax
+  804fd0:	00 00 00 
+  804fd3:	ff d0                	call   *%rax
+  804fd5:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fd7:	85 c0                	test   %eax,%eax
+  804fd9:	78 06                	js     804fe1 <getchar+0x2e>
+  804fdb:	74 08                	je     804fe5 <getchar+0x32>
+  804fdd:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fe1:	89 d0                	mov    %edx,%eax
+  804fe3:	c9                   	leave
+  804fe4:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fe5:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fea:	eb f5                	jmp    804fe1 <getchar+0x2e>
+
+0000000000804fec <iscons>:
+iscons(int fdnum) {
+  804fec:	55                   	push   %rbp
+  804fed:	48 89 e5             	mov    %rsp,%rbp
+  804ff0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ff4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804ff8:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  804fff:	00 00 00 
+  805002:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805004:	85 c0                	test   %eax,%eax
+  805006:	78 18                	js     805020 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805008:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80500c:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805013:	00 00 00 
+  805016:	8b 00                	mov    (%rax),%eax
+  805018:	39 02                	cmp    %eax,(%rdx)
+  80501a:	0f 94 c0             	sete   %al
+  80501d:	0f b6 c0             	movzbl %al,%eax
+}
+  805020:	c9                   	leave
+  805021:	c3                   	ret
+
+0000000000805022 <opencons>:
+opencons(void) {
+  805022:	55                   	push   %rbp
+  805023:	48 89 e5             	mov    %rsp,%rbp
+  805026:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80502a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80502e:	48 b8 c3 2d 80 00 00 	movabs $0x802dc3,%rax
+  805035:	00 00 00 
+  805038:	ff d0                	call   *%rax
+  80503a:	85 c0                	test   %eax,%eax
+  80503c:	78 49                	js     805087 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80503e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805043:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805048:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80504c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805051:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  805058:	00 00 00 
+  80505b:	ff d0                	call   *%rax
+  80505d:	85 c0                	test   %eax,%eax
+  80505f:	78 26                	js     805087 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805061:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805065:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80506c:	00 00 
+  80506e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805070:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805074:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80507b:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  805082:	00 00 00 
+  805085:	ff d0                	call   *%rax
+}
+  805087:	c9                   	leave
+  805088:	c3                   	ret
+
+0000000000805089 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805089:	55                   	push   %rbp
+  80508a:	48 89 e5             	mov    %rsp,%rbp
+  80508d:	41 56                	push   %r14
+  80508f:	41 55                	push   %r13
+  805091:	41 54                	push   %r12
+  805093:	53                   	push   %rbx
+  805094:	48 83 ec 50          	sub    $0x50,%rsp
+  805098:	49 89 fc             	mov    %rdi,%r12
+  80509b:	41 89 f5             	mov    %esi,%r13d
+  80509e:	48 89 d3             	mov    %rdx,%rbx
+  8050a1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050a5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050a9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050ad:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050b8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050bc:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050c0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050c4:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050cb:	00 00 00 
+  8050ce:	4c 8b 30             	mov    (%rax),%r14
+  8050d1:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  8050d8:	00 00 00 
+  8050db:	ff d0                	call   *%rax
+  8050dd:	89 c6                	mov    %eax,%esi
+  8050df:	45 89 e8             	mov    %r13d,%r8d
+  8050e2:	4c 89 e1             	mov    %r12,%rcx
+  8050e5:	4c 89 f2             	mov    %r14,%rdx
+  8050e8:	48 bf f8 62 80 00 00 	movabs $0x8062f8,%rdi
+  8050ef:	00 00 00 
+  8050f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050f7:	49 bc 9b 16 80 00 00 	movabs $0x80169b,%r12
+  8050fe:	00 00 00 
+  805101:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805104:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805108:	48 89 df             	mov    %rbx,%rdi
+  80510b:	48 b8 37 16 80 00 00 	movabs $0x801637,%rax
+  805112:	00 00 00 
+  805115:	ff d0                	call   *%rax
+    cprintf("\n");
+  805117:	48 bf d3 61 80 00 00 	movabs $0x8061d3,%rdi
+  80511e:	00 00 00 
+  805121:	b8 00 00 00 00       	mov    $0x0,%eax
+  805126:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805129:	cc                   	int3
+  80512a:	eb fd                	jmp    805129 <_panic+0xa0>
+
+000000000080512c <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80512c:	55                   	push   %rbp
+  80512d:	48 89 e5             	mov    %rsp,%rbp
+  805130:	41 56                	push   %r14
+  805132:	41 55                	push   %r13
+  805134:	41 54                	push   %r12
+  805136:	53                   	push   %rbx
+  805137:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80513a:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805141:	00 00 00 
+  805144:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805148:	74 27                	je     805171 <_handle_vectored_pagefault+0x45>
+  80514a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80514f:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805156:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805159:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80515c:	4c 89 e7             	mov    %r12,%rdi
+  80515f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805164:	84 c0                	test   %al,%al
+  805166:	75 45                	jne    8051ad <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805168:	48 83 c3 01          	add    $0x1,%rbx
+  80516c:	49 3b 1e             	cmp    (%r14),%rbx
+  80516f:	72 eb                	jb     80515c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805171:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805178:	00 
+  805179:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80517e:	4d 8b 04 24          	mov    (%r12),%r8
+  805182:	48 ba 20 63 80 00 00 	movabs $0x806320,%rdx
+  805189:	00 00 00 
+  80518c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805191:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  805198:	00 00 00 
+  80519b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a0:	49 ba 89 50 80 00 00 	movabs $0x805089,%r10
+  8051a7:	00 00 00 
+  8051aa:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051ad:	5b                   	pop    %rbx
+  8051ae:	41 5c                	pop    %r12
+  8051b0:	41 5d                	pop    %r13
+  8051b2:	41 5e                	pop    %r14
+  8051b4:	5d                   	pop    %rbp
+  8051b5:	c3                   	ret
+
+00000000008051b6 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051b6:	55                   	push   %rbp
+  8051b7:	48 89 e5             	mov    %rsp,%rbp
+  8051ba:	53                   	push   %rbx
+  8051bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8051bf:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051c2:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051c7:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051ce:	00 00 00 
+  8051d1:	80 38 00             	cmpb   $0x0,(%rax)
+  8051d4:	74 68                	je     80523e <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051d6:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051dd:	00 00 00 
+  8051e0:	48 8b 08             	mov    (%rax),%rcx
+  8051e3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051e8:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051ef:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f2:	48 85 c9             	test   %rcx,%rcx
+  8051f5:	0f 84 e0 00 00 00    	je     8052db <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051fb:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8051ff:	0f 84 c9 00 00 00    	je     8052ce <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805205:	48 83 c2 01          	add    $0x1,%rdx
+  805209:	48 39 ca             	cmp    %rcx,%rdx
+  80520c:	75 ed                	jne    8051fb <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80520e:	48 83 f9 08          	cmp    $0x8,%rcx
+  805212:	0f 84 84 00 00 00    	je     80529c <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805218:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80521c:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805223:	00 00 00 
+  805226:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80522d:	00 00 00 
+  805230:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805234:	85 f6                	test   %esi,%esi
+  805236:	0f 89 97 00 00 00    	jns    8052d3 <add_pgfault_handler+0x11d>
+  80523c:	eb 63                	jmp    8052a1 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80523e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805243:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805248:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80524f:	00 00 00 
+  805252:	bf 00 00 00 00       	mov    $0x0,%edi
+  805257:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  80525e:	00 00 00 
+  805261:	ff d0                	call   *%rax
+  805263:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805265:	85 c0                	test   %eax,%eax
+  805267:	78 38                	js     8052a1 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805269:	48 be b7 53 80 00 00 	movabs $0x8053b7,%rsi
+  805270:	00 00 00 
+  805273:	bf 00 00 00 00       	mov    $0x0,%edi
+  805278:	48 b8 5a 29 80 00 00 	movabs $0x80295a,%rax
+  80527f:	00 00 00 
+  805282:	ff d0                	call   *%rax
+  805284:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805286:	85 c0                	test   %eax,%eax
+  805288:	78 17                	js     8052a1 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80528a:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805291:	00 00 00 
+  805294:	c6 00 01             	movb   $0x1,(%rax)
+  805297:	e9 3a ff ff ff       	jmp    8051d6 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80529c:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052a1:	89 f1                	mov    %esi,%ecx
+  8052a3:	48 ba 5e 63 80 00 00 	movabs $0x80635e,%rdx
+  8052aa:	00 00 00 
+  8052ad:	be 42 00 00 00       	mov    $0x42,%esi
+  8052b2:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8052b9:	00 00 00 
+  8052bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052c1:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  8052c8:	00 00 00 
+  8052cb:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052ce:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052d3:	89 f0                	mov    %esi,%eax
+  8052d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052d9:	c9                   	leave
+  8052da:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052db:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052e2:	00 00 00 
+  8052e5:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052ec:	48 89 d8             	mov    %rbx,%rax
+  8052ef:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052f6:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052f9:	eb d8                	jmp    8052d3 <add_pgfault_handler+0x11d>
+
+00000000008052fb <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052fb:	55                   	push   %rbp
+  8052fc:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8052ff:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805306:	00 00 00 
+  805309:	80 38 00             	cmpb   $0x0,(%rax)
+  80530c:	74 33                	je     805341 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80530e:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805315:	00 00 00 
+  805318:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80531d:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805324:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805327:	48 85 c0             	test   %rax,%rax
+  80532a:	0f 84 85 00 00 00    	je     8053b5 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805330:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805334:	74 40                	je     805376 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805336:	48 83 c1 01          	add    $0x1,%rcx
+  80533a:	48 39 c1             	cmp    %rax,%rcx
+  80533d:	75 f1                	jne    805330 <remove_pgfault_handler+0x35>
+  80533f:	eb 74                	jmp    8053b5 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805341:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  805348:	00 00 00 
+  80534b:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  805352:	00 00 00 
+  805355:	be 48 00 00 00       	mov    $0x48,%esi
+  80535a:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  805361:	00 00 00 
+  805364:	b8 00 00 00 00       	mov    $0x0,%eax
+  805369:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  805370:	00 00 00 
+  805373:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805376:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80537d:	00 
+  80537e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805382:	48 29 ca             	sub    %rcx,%rdx
+  805385:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80538c:	00 00 00 
+  80538f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805393:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805398:	48 89 ce             	mov    %rcx,%rsi
+  80539b:	48 b8 22 23 80 00 00 	movabs $0x802322,%rax
+  8053a2:	00 00 00 
+  8053a5:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053a7:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053ae:	00 00 00 
+  8053b1:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053b5:	5d                   	pop    %rbp
+  8053b6:	c3                   	ret
+
+00000000008053b7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053b7:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053ba:	48 b8 2c 51 80 00 00 	movabs $0x80512c,%rax
+  8053c1:	00 00 00 
+    call *%rax
+  8053c4:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053c6:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053cd:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053ce:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053d5:	00 
+    subq $8, %rcx
+  8053d6:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053da:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053dd:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053e4:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053e5:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053e9:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053ed:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053f2:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053f7:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053fc:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805401:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805406:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80540b:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805410:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805415:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80541a:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80541f:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805424:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805429:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80542e:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805433:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805437:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80543b:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80543c:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80543d:	c3                   	ret
+
+000000000080543e <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80543e:	85 ff                	test   %edi,%edi
+  805440:	78 58                	js     80549a <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805442:	48 85 f6             	test   %rsi,%rsi
+  805445:	74 12                	je     805459 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805447:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80544e:	00 00 00 
+  805451:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805457:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805459:	48 85 c9             	test   %rcx,%rcx
+  80545c:	74 12                	je     805470 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80545e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805465:	00 00 00 
+  805468:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80546e:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805470:	48 85 d2             	test   %rdx,%rdx
+  805473:	74 14                	je     805489 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805475:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80547c:	00 00 00 
+  80547f:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805486:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805489:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805490:	00 00 00 
+  805493:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805499:	c3                   	ret
+        if (from_env_store) {
+  80549a:	48 85 f6             	test   %rsi,%rsi
+  80549d:	74 06                	je     8054a5 <ipc_result+0x67>
+            *from_env_store = 0;
+  80549f:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054a5:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054a7:	48 85 c9             	test   %rcx,%rcx
+  8054aa:	74 ed                	je     805499 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054ac:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054b2:	c3                   	ret
+
+00000000008054b3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054b3:	55                   	push   %rbp
+  8054b4:	48 89 e5             	mov    %rsp,%rbp
+  8054b7:	41 55                	push   %r13
+  8054b9:	41 54                	push   %r12
+  8054bb:	53                   	push   %rbx
+  8054bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8054c0:	49 89 fc             	mov    %rdi,%r12
+  8054c3:	48 89 f7             	mov    %rsi,%rdi
+  8054c6:	48 89 d3             	mov    %rdx,%rbx
+  8054c9:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054cc:	48 85 f6             	test   %rsi,%rsi
+  8054cf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054d6:	00 00 00 
+  8054d9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8054e2:	48 85 d2             	test   %rdx,%rdx
+  8054e5:	74 03                	je     8054ea <ipc_recv+0x37>
+  8054e7:	48 8b 32             	mov    (%rdx),%rsi
+  8054ea:	48 b8 83 2c 80 00 00 	movabs $0x802c83,%rax
+  8054f1:	00 00 00 
+  8054f4:	ff d0                	call   *%rax
+  8054f6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054f8:	4c 89 e9             	mov    %r13,%rcx
+  8054fb:	48 89 da             	mov    %rbx,%rdx
+  8054fe:	4c 89 e6             	mov    %r12,%rsi
+  805501:	48 b8 3e 54 80 00 00 	movabs $0x80543e,%rax
+  805508:	00 00 00 
+  80550b:	ff d0                	call   *%rax
+}
+  80550d:	48 83 c4 08          	add    $0x8,%rsp
+  805511:	5b                   	pop    %rbx
+  805512:	41 5c                	pop    %r12
+  805514:	41 5d                	pop    %r13
+  805516:	5d                   	pop    %rbp
+  805517:	c3                   	ret
+
+0000000000805518 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805518:	55                   	push   %rbp
+  805519:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80551c:	48 85 d2             	test   %rdx,%rdx
+  80551f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805526:	00 00 00 
+  805529:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80552d:	89 f6                	mov    %esi,%esi
+  80552f:	48 b8 0f 2b 80 00 00 	movabs $0x802b0f,%rax
+  805536:	00 00 00 
+  805539:	ff d0                	call   *%rax
+    if (res < 0) {
+  80553b:	85 c0                	test   %eax,%eax
+  80553d:	78 02                	js     805541 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80553f:	5d                   	pop    %rbp
+  805540:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805541:	89 c1                	mov    %eax,%ecx
+  805543:	48 ba 90 63 80 00 00 	movabs $0x806390,%rdx
+  80554a:	00 00 00 
+  80554d:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805552:	48 bf 9d 63 80 00 00 	movabs $0x80639d,%rdi
+  805559:	00 00 00 
+  80555c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805561:	49 b8 89 50 80 00 00 	movabs $0x805089,%r8
+  805568:	00 00 00 
+  80556b:	41 ff d0             	call   *%r8
+
+000000000080556e <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80556e:	55                   	push   %rbp
+  80556f:	48 89 e5             	mov    %rsp,%rbp
+  805572:	53                   	push   %rbx
+  805573:	48 83 ec 08          	sub    $0x8,%rsp
+  805577:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80557b:	48 85 d2             	test   %rdx,%rdx
+  80557e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805585:	00 00 00 
+  805588:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80558c:	4d 85 c9             	test   %r9,%r9
+  80558f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805593:	b8 00 00 00 00       	mov    $0x0,%eax
+  805598:	48 85 db             	test   %rbx,%rbx
+  80559b:	74 03                	je     8055a0 <ipc_call+0x32>
+  80559d:	48 8b 03             	mov    (%rbx),%rax
+  8055a0:	89 f6                	mov    %esi,%esi
+  8055a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8055a6:	50                   	push   %rax
+  8055a7:	48 b8 41 2b 80 00 00 	movabs $0x802b41,%rax
+  8055ae:	00 00 00 
+  8055b1:	ff d0                	call   *%rax
+  8055b3:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055b5:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055b9:	48 89 da             	mov    %rbx,%rdx
+  8055bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8055c1:	48 b8 3e 54 80 00 00 	movabs $0x80543e,%rax
+  8055c8:	00 00 00 
+  8055cb:	ff d0                	call   *%rax
+}
+  8055cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055d1:	c9                   	leave
+  8055d2:	c3                   	ret
+
+00000000008055d3 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055d3:	55                   	push   %rbp
+  8055d4:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055d7:	89 f6                	mov    %esi,%esi
+  8055d9:	48 b8 ad 2b 80 00 00 	movabs $0x802bad,%rax
+  8055e0:	00 00 00 
+  8055e3:	ff d0                	call   *%rax
+  8055e5:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8055f6:	48 b8 3e 54 80 00 00 	movabs $0x80543e,%rax
+  8055fd:	00 00 00 
+  805600:	ff d0                	call   *%rax
+}
+  805602:	5d                   	pop    %rbp
+  805603:	c3                   	ret
+
+0000000000805604 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805604:	55                   	push   %rbp
+  805605:	48 89 e5             	mov    %rsp,%rbp
+  805608:	41 54                	push   %r12
+  80560a:	53                   	push   %rbx
+  80560b:	4c 89 cb             	mov    %r9,%rbx
+  80560e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805612:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805616:	48 85 d2             	test   %rdx,%rdx
+  805619:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805620:	00 00 00 
+  805623:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805627:	4d 85 c9             	test   %r9,%r9
+  80562a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80562e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805633:	4d 85 e4             	test   %r12,%r12
+  805636:	74 04                	je     80563c <ipc_reply_wait+0x38>
+  805638:	49 8b 04 24          	mov    (%r12),%rax
+  80563c:	89 f6                	mov    %esi,%esi
+  80563e:	48 83 ec 08          	sub    $0x8,%rsp
+  805642:	50                   	push   %rax
+  805643:	48 b8 17 2c 80 00 00 	movabs $0x802c17,%rax
+  80564a:	00 00 00 
+  80564d:	ff d0                	call   *%rax
+  80564f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805651:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805655:	4c 89 e2             	mov    %r12,%rdx
+  805658:	48 89 de             	mov    %rbx,%rsi
+  80565b:	48 b8 3e 54 80 00 00 	movabs $0x80543e,%rax
+  805662:	00 00 00 
+  805665:	ff d0                	call   *%rax
+}
+  805667:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80566b:	5b                   	pop    %rbx
+  80566c:	41 5c                	pop    %r12
+  80566e:	5d                   	pop    %rbp
+  80566f:	c3                   	ret
+
+0000000000805670 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805670:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805675:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80567c:	00 00 00 
+  80567f:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805686:	48 01 ca             	add    %rcx,%rdx
+  805689:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80568f:	39 fa                	cmp    %edi,%edx
+  805691:	74 12                	je     8056a5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805693:	48 83 c0 01          	add    $0x1,%rax
+  805697:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80569d:	75 e0                	jne    80567f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80569f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056a4:	c3                   	ret
+            return envs[i].env_id;
+  8056a5:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056ac:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056b3:	00 00 00 
+  8056b6:	48 01 d0             	add    %rdx,%rax
+  8056b9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056bf:	c3                   	ret
+
+00000000008056c0 <__rodata_start>:
+  8056c0:	77 00                	ja     8056c2 <__rodata_start+0x2>
+  8056c2:	72 62                	jb     805726 <__rodata_start+0x66>
+  8056c4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056c7:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056ca:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056d1:	00 
+  8056d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056d9:	00 00 00 
+  8056dc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c30:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c40:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c50:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c60:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c70:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c80:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c90:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805ca0:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805cb0:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805cc0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cd0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805ce0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cf0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805d00:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805d10:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d20:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d30:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d40:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d50:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d60:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d70:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d80:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d90:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805da0:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805db0:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805dc0:	93 18 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805dd0:	da 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805de0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805df0:	ea 1e 80 00 00 00 00 00 b2 18 80 00 00 00 00 00     ................
+  805e00:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805e10:	a6 18 80 00 00 00 00 00 20 19 80 00 00 00 00 00     ........ .......
+  805e20:	ea 1e 80 00 00 00 00 00 a6 18 80 00 00 00 00 00     ................
+  805e30:	ec 18 80 00 00 00 00 00 ec 18 80 00 00 00 00 00     ................
+  805e40:	ec 18 80 00 00 00 00 00 ec 18 80 00 00 00 00 00     ................
+  805e50:	ec 18 80 00 00 00 00 00 ec 18 80 00 00 00 00 00     ................
+  805e60:	ec 18 80 00 00 00 00 00 ec 18 80 00 00 00 00 00     ................
+  805e70:	ec 18 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805e80:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805e90:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805ea0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805eb0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805ec0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805ed0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805ee0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805ef0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f00:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f10:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f20:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f30:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f40:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f50:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f60:	ea 1e 80 00 00 00 00 00 08 1e 80 00 00 00 00 00     ................
+  805f70:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f80:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805f90:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805fa0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805fb0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805fc0:	4e 19 80 00 00 00 00 00 1d 1b 80 00 00 00 00 00     N...............
+  805fd0:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  805fe0:	ea 1e 80 00 00 00 00 00 43 19 80 00 00 00 00 00     ........C.......
+  805ff0:	7d 19 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     }...............
+  806000:	ea 1e 80 00 00 00 00 00 38 19 80 00 00 00 00 00     ........8.......
+  806010:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  806020:	c6 1c 80 00 00 00 00 00 95 1d 80 00 00 00 00 00     ................
+  806030:	ea 1e 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  806040:	14 1a 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  806050:	f1 1b 80 00 00 00 00 00 ea 1e 80 00 00 00 00 00     ................
+  806060:	ea 1e 80 00 00 00 00 00 08 1e 80 00 00 00 00 00     ................
+  806070:	ea 1e 80 00 00 00 00 00 9c 18 80 00 00 00 00 00     ................
+
+0000000000806080 <error_string>:
+	...
+  806088:	5e 5c 80 00 00 00 00 00 70 5c 80 00 00 00 00 00     ^\......p\......
+  806098:	80 5c 80 00 00 00 00 00 92 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	a0 5c 80 00 00 00 00 00 b4 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	c9 5c 80 00 00 00 00 00 dc 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	ee 5c 80 00 00 00 00 00 02 5d 80 00 00 00 00 00     .\.......]......
+  8060d8:	12 5d 80 00 00 00 00 00 25 5d 80 00 00 00 00 00     .]......%]......
+  8060e8:	3c 5d 80 00 00 00 00 00 52 5d 80 00 00 00 00 00     <]......R]......
+  8060f8:	6a 5d 80 00 00 00 00 00 82 5d 80 00 00 00 00 00     j].......]......
+  806108:	8f 5d 80 00 00 00 00 00 20 61 80 00 00 00 00 00     .]...... a......
+  806118:	a3 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806128:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806138:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806148:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806158:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806168:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806178:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806188:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806198:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806200 <devtab>:
+  806200:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806210:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806220:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806230:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806240:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806250:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806260:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806270:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806280:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806290:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062f0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806300:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806310:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806320:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806330:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806340:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806350:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806360:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806370:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806380:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806390:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063a0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
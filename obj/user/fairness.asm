@@ -0,0 +1,10371 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 ae 21 80 00 00 	movabs $0x8021ae,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 70 35 80 00 00 	movabs $0x803570,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 70 35 80 00 00 	movabs $0x803570,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 f0 16 80 00 00 	movabs $0x8016f0,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 46 3f 80 00 00 	movabs $0x803f46,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 46 3f 80 00 00 	movabs $0x803f46,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 78 5d 80 00 00 	movabs $0x805d78,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 4d 21 80 00 00 	movabs $0x80214d,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 d9 3c 80 00 00 	movabs $0x803cd9,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 80 57 80 00 00 	movabs $0x805780,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 4d 21 80 00 00 	movabs $0x80214d,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 d9 3c 80 00 00 	movabs $0x803cd9,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 82 57 80 00 00 	movabs $0x805782,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 4d 21 80 00 00 	movabs $0x80214d,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 d9 3c 80 00 00 	movabs $0x803cd9,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 85 57 80 00 00 	movabs $0x805785,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 4d 21 80 00 00 	movabs $0x80214d,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 d9 3c 80 00 00 	movabs $0x803cd9,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 44 4d 80 00 00 	movabs $0x804d44,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 1b 50 80 00 00 	movabs $0x80501b,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 c3 32 80 00 00 	movabs $0x8032c3,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 5a 36 80 00 00 	movabs $0x80365a,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 23 37 80 00 00 	movabs $0x803723,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 41 34 80 00 00 	movabs $0x803441,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 70 35 80 00 00 	movabs $0x803570,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 d9 3c 80 00 00 	movabs $0x803cd9,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 c3 32 80 00 00 	movabs $0x8032c3,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb fa 22 80 00 00 	movabs $0x8022fa,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc fa 22 80 00 00 	movabs $0x8022fa,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 40 5a 80 00 00 	movabs $0x805a40,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf fa 22 80 00 00 	movabs $0x8022fa,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf fa 22 80 00 00 	movabs $0x8022fa,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 c0 5c 80 00 00 	movabs $0x805cc0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 c0 5c 80 00 00 	movabs $0x805cc0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 dc 00 00 00       	call   8015db <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+ * (user/idle is env 0). */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 56                	push   %r14
+  801507:	41 55                	push   %r13
+  801509:	41 54                	push   %r12
+  80150b:	53                   	push   %rbx
+  80150c:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t who, id;
+
+    id = sys_getenvid();
+  801510:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  801517:	00 00 00 
+  80151a:	ff d0                	call   *%rax
+  80151c:	89 c3                	mov    %eax,%ebx
+
+    if (thisenv == &envs[1]) {
+  80151e:	48 ba 20 80 80 01 00 	movabs $0x1808020,%rdx
+  801525:	00 00 00 
+  801528:	48 b8 38 02 c0 1f 80 	movabs $0x801fc00238,%rax
+  80152f:	00 00 00 
+  801532:	48 39 02             	cmp    %rax,(%rdx)
+  801535:	74 5e                	je     801595 <umain+0x94>
+        while (1) {
+            ipc_recv(&who, NULL, NULL, NULL);
+            cprintf("%x recv from %x\n", id, who);
+        }
+    } else {
+        cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  801537:	48 b8 00 03 c0 1f 80 	movabs $0x801fc00300,%rax
+  80153e:	00 00 00 
+  801541:	8b 10                	mov    (%rax),%edx
+  801543:	89 de                	mov    %ebx,%esi
+  801545:	48 bf f3 5c 80 00 00 	movabs $0x805cf3,%rdi
+  80154c:	00 00 00 
+  80154f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801554:	48 b9 54 17 80 00 00 	movabs $0x801754,%rcx
+  80155b:	00 00 00 
+  80155e:	ff d1                	call   *%rcx
+        while (1)
+            ipc_send(envs[1].env_id, 0, NULL, 0, 0);
+  801560:	49 bc 00 00 c0 1f 80 	movabs $0x801fc00000,%r12
+  801567:	00 00 00 
+  80156a:	48 bb 28 2f 80 00 00 	movabs $0x802f28,%rbx
+  801571:	00 00 00 
+  801574:	41 8b bc 24 00 03 00 	mov    0x300(%r12),%edi
+  80157b:	00 
+  80157c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801582:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158c:	be 00 00 00 00       	mov    $0x0,%esi
+  801591:	ff d3                	call   *%rbx
+        while (1)
+  801593:	eb df                	jmp    801574 <umain+0x73>
+            ipc_recv(&who, NULL, NULL, NULL);
+  801595:	49 be c3 2e 80 00 00 	movabs $0x802ec3,%r14
+  80159c:	00 00 00 
+            cprintf("%x recv from %x\n", id, who);
+  80159f:	49 bd e2 5c 80 00 00 	movabs $0x805ce2,%r13
+  8015a6:	00 00 00 
+  8015a9:	49 bc 54 17 80 00 00 	movabs $0x801754,%r12
+  8015b0:	00 00 00 
+            ipc_recv(&who, NULL, NULL, NULL);
+  8015b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c2:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8015c6:	41 ff d6             	call   *%r14
+            cprintf("%x recv from %x\n", id, who);
+  8015c9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8015cc:	89 de                	mov    %ebx,%esi
+  8015ce:	4c 89 ef             	mov    %r13,%rdi
+  8015d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d6:	41 ff d4             	call   *%r12
+        while (1) {
+  8015d9:	eb d8                	jmp    8015b3 <umain+0xb2>
+
+00000000008015db <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8015db:	55                   	push   %rbp
+  8015dc:	48 89 e5             	mov    %rsp,%rbp
+  8015df:	41 56                	push   %r14
+  8015e1:	41 55                	push   %r13
+  8015e3:	41 54                	push   %r12
+  8015e5:	53                   	push   %rbx
+  8015e6:	41 89 fd             	mov    %edi,%r13d
+  8015e9:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8015ec:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8015f3:	00 00 00 
+  8015f6:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8015fd:	00 00 00 
+  801600:	48 39 c2             	cmp    %rax,%rdx
+  801603:	73 17                	jae    80161c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801605:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801608:	49 89 c4             	mov    %rax,%r12
+  80160b:	48 83 c3 08          	add    $0x8,%rbx
+  80160f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801614:	ff 53 f8             	call   *-0x8(%rbx)
+  801617:	4c 39 e3             	cmp    %r12,%rbx
+  80161a:	72 ef                	jb     80160b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80161c:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  801623:	00 00 00 
+  801626:	ff d0                	call   *%rax
+  801628:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80162d:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801634:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80163b:	00 00 00 
+  80163e:	48 01 d0             	add    %rdx,%rax
+  801641:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801648:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80164b:	45 85 ed             	test   %r13d,%r13d
+  80164e:	7e 0d                	jle    80165d <libmain+0x82>
+  801650:	49 8b 06             	mov    (%r14),%rax
+  801653:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80165a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80165d:	4c 89 f6             	mov    %r14,%rsi
+  801660:	44 89 ef             	mov    %r13d,%edi
+  801663:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80166a:	00 00 00 
+  80166d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80166f:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801676:	00 00 00 
+  801679:	ff d0                	call   *%rax
+#endif
+}
+  80167b:	5b                   	pop    %rbx
+  80167c:	41 5c                	pop    %r12
+  80167e:	41 5d                	pop    %r13
+  801680:	41 5e                	pop    %r14
+  801682:	5d                   	pop    %rbp
+  801683:	c3                   	ret
+
+0000000000801684 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801684:	55                   	push   %rbp
+  801685:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801688:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  80168f:	00 00 00 
+  801692:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801694:	bf 00 00 00 00       	mov    $0x0,%edi
+  801699:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  8016a0:	00 00 00 
+  8016a3:	ff d0                	call   *%rax
+}
+  8016a5:	5d                   	pop    %rbp
+  8016a6:	c3                   	ret
+
+00000000008016a7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8016a7:	55                   	push   %rbp
+  8016a8:	48 89 e5             	mov    %rsp,%rbp
+  8016ab:	53                   	push   %rbx
+  8016ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8016b3:	8b 06                	mov    (%rsi),%eax
+  8016b5:	8d 50 01             	lea    0x1(%rax),%edx
+  8016b8:	89 16                	mov    %edx,(%rsi)
+  8016ba:	48 98                	cltq
+  8016bc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8016c1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8016c7:	74 0a                	je     8016d3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8016c9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8016cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d1:	c9                   	leave
+  8016d2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8016d3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8016d7:	be ff 00 00 00       	mov    $0xff,%esi
+  8016dc:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  8016e3:	00 00 00 
+  8016e6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8016e8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8016ee:	eb d9                	jmp    8016c9 <putch+0x22>
+
+00000000008016f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8016f0:	55                   	push   %rbp
+  8016f1:	48 89 e5             	mov    %rsp,%rbp
+  8016f4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8016fb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8016fe:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801705:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80170a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801712:	48 89 f1             	mov    %rsi,%rcx
+  801715:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80171c:	48 bf a7 16 80 00 00 	movabs $0x8016a7,%rdi
+  801723:	00 00 00 
+  801726:	48 b8 a4 18 80 00 00 	movabs $0x8018a4,%rax
+  80172d:	00 00 00 
+  801730:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801732:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801739:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801740:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  801747:	00 00 00 
+  80174a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80174c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801752:	c9                   	leave
+  801753:	c3                   	ret
+
+0000000000801754 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801754:	55                   	push   %rbp
+  801755:	48 89 e5             	mov    %rsp,%rbp
+  801758:	48 83 ec 50          	sub    $0x50,%rsp
+  80175c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801760:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801764:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801768:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80176c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801770:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801777:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80177b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80177f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801783:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801787:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80178b:	48 b8 f0 16 80 00 00 	movabs $0x8016f0,%rax
+  801792:	00 00 00 
+  801795:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801797:	c9                   	leave
+  801798:	c3                   	ret
+
+0000000000801799 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801799:	55                   	push   %rbp
+  80179a:	48 89 e5             	mov    %rsp,%rbp
+  80179d:	41 57                	push   %r15
+  80179f:	41 56                	push   %r14
+  8017a1:	41 55                	push   %r13
+  8017a3:	41 54                	push   %r12
+  8017a5:	53                   	push   %rbx
+  8017a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8017aa:	49 89 fc             	mov    %rdi,%r12
+  8017ad:	49 89 f5             	mov    %rsi,%r13
+  8017b0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017b4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8017b7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8017ba:	41 89 cf             	mov    %ecx,%r15d
+  8017bd:	4c 39 fa             	cmp    %r15,%rdx
+  8017c0:	73 5b                	jae    80181d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8017c2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8017c6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8017ca:	85 db                	test   %ebx,%ebx
+  8017cc:	7e 0e                	jle    8017dc <print_num+0x43>
+            putch(padc, put_arg);
+  8017ce:	4c 89 ee             	mov    %r13,%rsi
+  8017d1:	44 89 f7             	mov    %r14d,%edi
+  8017d4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8017d7:	83 eb 01             	sub    $0x1,%ebx
+  8017da:	75 f2                	jne    8017ce <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8017dc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8017e0:	48 b9 25 5d 80 00 00 	movabs $0x805d25,%rcx
+  8017e7:	00 00 00 
+  8017ea:	48 b8 14 5d 80 00 00 	movabs $0x805d14,%rax
+  8017f1:	00 00 00 
+  8017f4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8017f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801801:	49 f7 f7             	div    %r15
+  801804:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801808:	4c 89 ee             	mov    %r13,%rsi
+  80180b:	41 ff d4             	call   *%r12
+}
+  80180e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801812:	5b                   	pop    %rbx
+  801813:	41 5c                	pop    %r12
+  801815:	41 5d                	pop    %r13
+  801817:	41 5e                	pop    %r14
+  801819:	41 5f                	pop    %r15
+  80181b:	5d                   	pop    %rbp
+  80181c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80181d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801821:	ba 00 00 00 00       	mov    $0x0,%edx
+  801826:	49 f7 f7             	div    %r15
+  801829:	48 83 ec 08          	sub    $0x8,%rsp
+  80182d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801831:	52                   	push   %rdx
+  801832:	45 0f be c9          	movsbl %r9b,%r9d
+  801836:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80183a:	48 89 c2             	mov    %rax,%rdx
+  80183d:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  801844:	00 00 00 
+  801847:	ff d0                	call   *%rax
+  801849:	48 83 c4 10          	add    $0x10,%rsp
+  80184d:	eb 8d                	jmp    8017dc <print_num+0x43>
+
+000000000080184f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80184f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801853:	48 8b 06             	mov    (%rsi),%rax
+  801856:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80185a:	73 0a                	jae    801866 <sprintputch+0x17>
+        *state->start++ = ch;
+  80185c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801860:	48 89 16             	mov    %rdx,(%rsi)
+  801863:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801866:	c3                   	ret
+
+0000000000801867 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+  80186b:	48 83 ec 50          	sub    $0x50,%rsp
+  80186f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801873:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801877:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80187b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801882:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801886:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80188a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80188e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801892:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801896:	48 b8 a4 18 80 00 00 	movabs $0x8018a4,%rax
+  80189d:	00 00 00 
+  8018a0:	ff d0                	call   *%rax
+}
+  8018a2:	c9                   	leave
+  8018a3:	c3                   	ret
+
+00000000008018a4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8018a4:	55                   	push   %rbp
+  8018a5:	48 89 e5             	mov    %rsp,%rbp
+  8018a8:	41 57                	push   %r15
+  8018aa:	41 56                	push   %r14
+  8018ac:	41 55                	push   %r13
+  8018ae:	41 54                	push   %r12
+  8018b0:	53                   	push   %rbx
+  8018b1:	48 83 ec 38          	sub    $0x38,%rsp
+  8018b5:	49 89 fe             	mov    %rdi,%r14
+  8018b8:	49 89 f5             	mov    %rsi,%r13
+  8018bb:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8018be:	48 8b 01             	mov    (%rcx),%rax
+  8018c1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8018c5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8018c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018cd:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8018d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8018d5:	eb 0d                	jmp    8018e4 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8018d7:	40 0f b6 ff          	movzbl %dil,%edi
+  8018db:	4c 89 ee             	mov    %r13,%rsi
+  8018de:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8018e1:	4c 89 e3             	mov    %r12,%rbx
+  8018e4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8018e8:	0f b6 3b             	movzbl (%rbx),%edi
+  8018eb:	40 80 ff 25          	cmp    $0x25,%dil
+  8018ef:	74 14                	je     801905 <vprintfmt+0x61>
+            if (!ch) return;
+  8018f1:	40 84 ff             	test   %dil,%dil
+  8018f4:	75 e1                	jne    8018d7 <vprintfmt+0x33>
+}
+  8018f6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8018fa:	5b                   	pop    %rbx
+  8018fb:	41 5c                	pop    %r12
+  8018fd:	41 5d                	pop    %r13
+  8018ff:	41 5e                	pop    %r14
+  801901:	41 5f                	pop    %r15
+  801903:	5d                   	pop    %rbp
+  801904:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801905:	be 00 00 00 00       	mov    $0x0,%esi
+  80190a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80190e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801913:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801919:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801920:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801924:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801929:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80192e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801931:	83 e8 23             	sub    $0x23,%eax
+  801934:	3c 57                	cmp    $0x57,%al
+  801936:	0f 87 67 06 00 00    	ja     801fa3 <vprintfmt+0x6ff>
+  80193c:	0f b6 c0             	movzbl %al,%eax
+  80193f:	48 b9 c0 5e 80 00 00 	movabs $0x805ec0,%rcx
+  801946:	00 00 00 
+  801949:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80194c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80194f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801953:	eb cf                	jmp    801924 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801955:	49 89 dc             	mov    %rbx,%r12
+  801958:	be 01 00 00 00       	mov    $0x1,%esi
+  80195d:	eb c5                	jmp    801924 <vprintfmt+0x80>
+            padc = ch;
+  80195f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801963:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801966:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801969:	eb b9                	jmp    801924 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80196b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80196e:	83 f8 2f             	cmp    $0x2f,%eax
+  801971:	77 24                	ja     801997 <vprintfmt+0xf3>
+  801973:	89 c1                	mov    %eax,%ecx
+  801975:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801979:	83 c0 08             	add    $0x8,%eax
+  80197c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80197f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801982:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801985:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801989:	79 99                	jns    801924 <vprintfmt+0x80>
+                width = precision;
+  80198b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80198f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801995:	eb 8d                	jmp    801924 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801997:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80199b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80199f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019a3:	eb da                	jmp    80197f <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8019a5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8019aa:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019ae:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8019b4:	3c 39                	cmp    $0x39,%al
+  8019b6:	77 1c                	ja     8019d4 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8019b8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8019bc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8019c0:	0f b6 c0             	movzbl %al,%eax
+  8019c3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019c8:	0f b6 03             	movzbl (%rbx),%eax
+  8019cb:	3c 39                	cmp    $0x39,%al
+  8019cd:	76 e9                	jbe    8019b8 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8019cf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8019d2:	eb b1                	jmp    801985 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8019d4:	49 89 dc             	mov    %rbx,%r12
+  8019d7:	eb ac                	jmp    801985 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  8019d9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8019dc:	85 c9                	test   %ecx,%ecx
+  8019de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e3:	0f 49 c1             	cmovns %ecx,%eax
+  8019e6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8019e9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019ec:	e9 33 ff ff ff       	jmp    801924 <vprintfmt+0x80>
+            lflag++;
+  8019f1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8019f4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019f7:	e9 28 ff ff ff       	jmp    801924 <vprintfmt+0x80>
+            lflag--;
+  8019fc:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8019ff:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a02:	e9 1d ff ff ff       	jmp    801924 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801a07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  801a0d:	77 19                	ja     801a28 <vprintfmt+0x184>
+  801a0f:	89 c2                	mov    %eax,%edx
+  801a11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a15:	83 c0 08             	add    $0x8,%eax
+  801a18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a1b:	8b 3a                	mov    (%rdx),%edi
+  801a1d:	4c 89 ee             	mov    %r13,%rsi
+  801a20:	41 ff d6             	call   *%r14
+            break;
+  801a23:	e9 bc fe ff ff       	jmp    8018e4 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a34:	eb e5                	jmp    801a1b <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a39:	83 f8 2f             	cmp    $0x2f,%eax
+  801a3c:	77 5a                	ja     801a98 <vprintfmt+0x1f4>
+  801a3e:	89 c2                	mov    %eax,%edx
+  801a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a44:	83 c0 08             	add    $0x8,%eax
+  801a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801a4a:	8b 02                	mov    (%rdx),%eax
+  801a4c:	89 c1                	mov    %eax,%ecx
+  801a4e:	f7 d9                	neg    %ecx
+  801a50:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801a53:	83 f9 13             	cmp    $0x13,%ecx
+  801a56:	7f 4e                	jg     801aa6 <vprintfmt+0x202>
+  801a58:	48 63 c1             	movslq %ecx,%rax
+  801a5b:	48 ba 80 61 80 00 00 	movabs $0x806180,%rdx
+  801a62:	00 00 00 
+  801a65:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801a69:	48 85 c0             	test   %rax,%rax
+  801a6c:	74 38                	je     801aa6 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801a6e:	48 89 c1             	mov    %rax,%rcx
+  801a71:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  801a78:	00 00 00 
+  801a7b:	4c 89 ee             	mov    %r13,%rsi
+  801a7e:	4c 89 f7             	mov    %r14,%rdi
+  801a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a86:	49 b8 67 18 80 00 00 	movabs $0x801867,%r8
+  801a8d:	00 00 00 
+  801a90:	41 ff d0             	call   *%r8
+  801a93:	e9 4c fe ff ff       	jmp    8018e4 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801a98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aa4:	eb a4                	jmp    801a4a <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801aa6:	48 ba 3d 5d 80 00 00 	movabs $0x805d3d,%rdx
+  801aad:	00 00 00 
+  801ab0:	4c 89 ee             	mov    %r13,%rsi
+  801ab3:	4c 89 f7             	mov    %r14,%rdi
+  801ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abb:	49 b8 67 18 80 00 00 	movabs $0x801867,%r8
+  801ac2:	00 00 00 
+  801ac5:	41 ff d0             	call   *%r8
+  801ac8:	e9 17 fe ff ff       	jmp    8018e4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801acd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ad0:	83 f8 2f             	cmp    $0x2f,%eax
+  801ad3:	77 6c                	ja     801b41 <vprintfmt+0x29d>
+  801ad5:	89 c2                	mov    %eax,%edx
+  801ad7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801adb:	83 c0 08             	add    $0x8,%eax
+  801ade:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ae1:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801ae4:	48 85 f6             	test   %rsi,%rsi
+  801ae7:	48 b8 36 5d 80 00 00 	movabs $0x805d36,%rax
+  801aee:	00 00 00 
+  801af1:	48 0f 45 c6          	cmovne %rsi,%rax
+  801af5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801af9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801afd:	7e 06                	jle    801b05 <vprintfmt+0x261>
+  801aff:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801b03:	75 4a                	jne    801b4f <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b05:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801b09:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801b0d:	0f b6 00             	movzbl (%rax),%eax
+  801b10:	84 c0                	test   %al,%al
+  801b12:	0f 85 9a 00 00 00    	jne    801bb2 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801b18:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b1b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b1f:	85 c0                	test   %eax,%eax
+  801b21:	0f 8e bd fd ff ff    	jle    8018e4 <vprintfmt+0x40>
+  801b27:	4c 89 ee             	mov    %r13,%rsi
+  801b2a:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b2f:	41 ff d6             	call   *%r14
+  801b32:	41 83 ec 01          	sub    $0x1,%r12d
+  801b36:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b3a:	75 eb                	jne    801b27 <vprintfmt+0x283>
+  801b3c:	e9 a3 fd ff ff       	jmp    8018e4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b4d:	eb 92                	jmp    801ae1 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801b4f:	49 63 f7             	movslq %r15d,%rsi
+  801b52:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801b56:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  801b5d:	00 00 00 
+  801b60:	ff d0                	call   *%rax
+  801b62:	48 89 c2             	mov    %rax,%rdx
+  801b65:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b68:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801b6a:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801b6d:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801b70:	85 c0                	test   %eax,%eax
+  801b72:	7e 91                	jle    801b05 <vprintfmt+0x261>
+  801b74:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801b79:	4c 89 ee             	mov    %r13,%rsi
+  801b7c:	44 89 e7             	mov    %r12d,%edi
+  801b7f:	41 ff d6             	call   *%r14
+  801b82:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b86:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b89:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801b8c:	75 eb                	jne    801b79 <vprintfmt+0x2d5>
+  801b8e:	e9 72 ff ff ff       	jmp    801b05 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b93:	0f b6 f8             	movzbl %al,%edi
+  801b96:	4c 89 ee             	mov    %r13,%rsi
+  801b99:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b9c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ba0:	49 83 c4 01          	add    $0x1,%r12
+  801ba4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801baa:	84 c0                	test   %al,%al
+  801bac:	0f 84 66 ff ff ff    	je     801b18 <vprintfmt+0x274>
+  801bb2:	45 85 ff             	test   %r15d,%r15d
+  801bb5:	78 0a                	js     801bc1 <vprintfmt+0x31d>
+  801bb7:	41 83 ef 01          	sub    $0x1,%r15d
+  801bbb:	0f 88 57 ff ff ff    	js     801b18 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801bc1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801bc5:	74 cc                	je     801b93 <vprintfmt+0x2ef>
+  801bc7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801bca:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801bcf:	80 fa 5e             	cmp    $0x5e,%dl
+  801bd2:	77 c2                	ja     801b96 <vprintfmt+0x2f2>
+  801bd4:	eb bd                	jmp    801b93 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801bd6:	40 84 f6             	test   %sil,%sil
+  801bd9:	75 26                	jne    801c01 <vprintfmt+0x35d>
+    switch (lflag) {
+  801bdb:	85 d2                	test   %edx,%edx
+  801bdd:	74 59                	je     801c38 <vprintfmt+0x394>
+  801bdf:	83 fa 01             	cmp    $0x1,%edx
+  801be2:	74 7b                	je     801c5f <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801be4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801be7:	83 f8 2f             	cmp    $0x2f,%eax
+  801bea:	0f 87 96 00 00 00    	ja     801c86 <vprintfmt+0x3e2>
+  801bf0:	89 c2                	mov    %eax,%edx
+  801bf2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bf6:	83 c0 08             	add    $0x8,%eax
+  801bf9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bfc:	4c 8b 22             	mov    (%rdx),%r12
+  801bff:	eb 17                	jmp    801c18 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801c01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c04:	83 f8 2f             	cmp    $0x2f,%eax
+  801c07:	77 21                	ja     801c2a <vprintfmt+0x386>
+  801c09:	89 c2                	mov    %eax,%edx
+  801c0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c0f:	83 c0 08             	add    $0x8,%eax
+  801c12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c15:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801c18:	4d 85 e4             	test   %r12,%r12
+  801c1b:	78 7a                	js     801c97 <vprintfmt+0x3f3>
+            num = i;
+  801c1d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c20:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c25:	e9 56 02 00 00       	jmp    801e80 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c36:	eb dd                	jmp    801c15 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801c38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801c3e:	77 11                	ja     801c51 <vprintfmt+0x3ad>
+  801c40:	89 c2                	mov    %eax,%edx
+  801c42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c46:	83 c0 08             	add    $0x8,%eax
+  801c49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c4c:	4c 63 22             	movslq (%rdx),%r12
+  801c4f:	eb c7                	jmp    801c18 <vprintfmt+0x374>
+  801c51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c5d:	eb ed                	jmp    801c4c <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801c5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c62:	83 f8 2f             	cmp    $0x2f,%eax
+  801c65:	77 11                	ja     801c78 <vprintfmt+0x3d4>
+  801c67:	89 c2                	mov    %eax,%edx
+  801c69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c6d:	83 c0 08             	add    $0x8,%eax
+  801c70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c73:	4c 8b 22             	mov    (%rdx),%r12
+  801c76:	eb a0                	jmp    801c18 <vprintfmt+0x374>
+  801c78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c84:	eb ed                	jmp    801c73 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801c86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c92:	e9 65 ff ff ff       	jmp    801bfc <vprintfmt+0x358>
+                putch('-', put_arg);
+  801c97:	4c 89 ee             	mov    %r13,%rsi
+  801c9a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801c9f:	41 ff d6             	call   *%r14
+                i = -i;
+  801ca2:	49 f7 dc             	neg    %r12
+  801ca5:	e9 73 ff ff ff       	jmp    801c1d <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801caa:	40 84 f6             	test   %sil,%sil
+  801cad:	75 2e                	jne    801cdd <vprintfmt+0x439>
+    switch (lflag) {
+  801caf:	85 d2                	test   %edx,%edx
+  801cb1:	7f 59                	jg     801d0c <vprintfmt+0x468>
+  801cb3:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cb6:	7d 7a                	jge    801d32 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801cb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cbb:	83 f8 2f             	cmp    $0x2f,%eax
+  801cbe:	0f 87 aa 00 00 00    	ja     801d6e <vprintfmt+0x4ca>
+  801cc4:	89 c2                	mov    %eax,%edx
+  801cc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cca:	83 c0 08             	add    $0x8,%eax
+  801ccd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cd0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cd3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cd8:	e9 a3 01 00 00       	jmp    801e80 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ce0:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce3:	77 19                	ja     801cfe <vprintfmt+0x45a>
+  801ce5:	89 c2                	mov    %eax,%edx
+  801ce7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ceb:	83 c0 08             	add    $0x8,%eax
+  801cee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cf4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801cf9:	e9 82 01 00 00       	jmp    801e80 <vprintfmt+0x5dc>
+  801cfe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d0a:	eb e5                	jmp    801cf1 <vprintfmt+0x44d>
+    switch (lflag) {
+  801d0c:	83 fa 01             	cmp    $0x1,%edx
+  801d0f:	75 a7                	jne    801cb8 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801d11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d14:	83 f8 2f             	cmp    $0x2f,%eax
+  801d17:	77 47                	ja     801d60 <vprintfmt+0x4bc>
+  801d19:	89 c2                	mov    %eax,%edx
+  801d1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d1f:	83 c0 08             	add    $0x8,%eax
+  801d22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d25:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d28:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d2d:	e9 4e 01 00 00       	jmp    801e80 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d35:	83 f8 2f             	cmp    $0x2f,%eax
+  801d38:	77 18                	ja     801d52 <vprintfmt+0x4ae>
+  801d3a:	89 c2                	mov    %eax,%edx
+  801d3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d40:	83 c0 08             	add    $0x8,%eax
+  801d43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d46:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801d48:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801d4d:	e9 2e 01 00 00       	jmp    801e80 <vprintfmt+0x5dc>
+  801d52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d5e:	eb e6                	jmp    801d46 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801d60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d6c:	eb b7                	jmp    801d25 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801d6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7a:	e9 51 ff ff ff       	jmp    801cd0 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801d7f:	40 84 f6             	test   %sil,%sil
+  801d82:	75 2e                	jne    801db2 <vprintfmt+0x50e>
+    switch (lflag) {
+  801d84:	85 d2                	test   %edx,%edx
+  801d86:	7f 59                	jg     801de1 <vprintfmt+0x53d>
+  801d88:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d8b:	7d 77                	jge    801e04 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801d8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d90:	83 f8 2f             	cmp    $0x2f,%eax
+  801d93:	0f 87 a4 00 00 00    	ja     801e3d <vprintfmt+0x599>
+  801d99:	89 c2                	mov    %eax,%edx
+  801d9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9f:	83 c0 08             	add    $0x8,%eax
+  801da2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801da8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801dad:	e9 ce 00 00 00       	jmp    801e80 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801db2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db5:	83 f8 2f             	cmp    $0x2f,%eax
+  801db8:	77 19                	ja     801dd3 <vprintfmt+0x52f>
+  801dba:	89 c2                	mov    %eax,%edx
+  801dbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc0:	83 c0 08             	add    $0x8,%eax
+  801dc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801dc9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801dce:	e9 ad 00 00 00       	jmp    801e80 <vprintfmt+0x5dc>
+  801dd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ddb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ddf:	eb e5                	jmp    801dc6 <vprintfmt+0x522>
+    switch (lflag) {
+  801de1:	83 fa 01             	cmp    $0x1,%edx
+  801de4:	75 a7                	jne    801d8d <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801de6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801de9:	83 f8 2f             	cmp    $0x2f,%eax
+  801dec:	77 41                	ja     801e2f <vprintfmt+0x58b>
+  801dee:	89 c2                	mov    %eax,%edx
+  801df0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df4:	83 c0 08             	add    $0x8,%eax
+  801df7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dfa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801dfd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801e02:	eb 7c                	jmp    801e80 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e07:	83 f8 2f             	cmp    $0x2f,%eax
+  801e0a:	77 15                	ja     801e21 <vprintfmt+0x57d>
+  801e0c:	89 c2                	mov    %eax,%edx
+  801e0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e12:	83 c0 08             	add    $0x8,%eax
+  801e15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e18:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e1a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e1f:	eb 5f                	jmp    801e80 <vprintfmt+0x5dc>
+  801e21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e2d:	eb e9                	jmp    801e18 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e3b:	eb bd                	jmp    801dfa <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801e3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e49:	e9 57 ff ff ff       	jmp    801da5 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801e4e:	4c 89 ee             	mov    %r13,%rsi
+  801e51:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e56:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801e59:	4c 89 ee             	mov    %r13,%rsi
+  801e5c:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e61:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801e64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e67:	83 f8 2f             	cmp    $0x2f,%eax
+  801e6a:	77 47                	ja     801eb3 <vprintfmt+0x60f>
+  801e6c:	89 c2                	mov    %eax,%edx
+  801e6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e72:	83 c0 08             	add    $0x8,%eax
+  801e75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e78:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801e80:	48 83 ec 08          	sub    $0x8,%rsp
+  801e84:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801e88:	0f 94 c0             	sete   %al
+  801e8b:	0f b6 c0             	movzbl %al,%eax
+  801e8e:	50                   	push   %rax
+  801e8f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801e94:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801e98:	4c 89 ee             	mov    %r13,%rsi
+  801e9b:	4c 89 f7             	mov    %r14,%rdi
+  801e9e:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  801ea5:	00 00 00 
+  801ea8:	ff d0                	call   *%rax
+            break;
+  801eaa:	48 83 c4 10          	add    $0x10,%rsp
+  801eae:	e9 31 fa ff ff       	jmp    8018e4 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801eb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ebf:	eb b7                	jmp    801e78 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801ec1:	40 84 f6             	test   %sil,%sil
+  801ec4:	75 2b                	jne    801ef1 <vprintfmt+0x64d>
+    switch (lflag) {
+  801ec6:	85 d2                	test   %edx,%edx
+  801ec8:	7f 56                	jg     801f20 <vprintfmt+0x67c>
+  801eca:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ecd:	7d 77                	jge    801f46 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801ecf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed2:	83 f8 2f             	cmp    $0x2f,%eax
+  801ed5:	0f 87 a7 00 00 00    	ja     801f82 <vprintfmt+0x6de>
+  801edb:	89 c2                	mov    %eax,%edx
+  801edd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee1:	83 c0 08             	add    $0x8,%eax
+  801ee4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ee7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801eea:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801eef:	eb 8f                	jmp    801e80 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ef1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef7:	77 19                	ja     801f12 <vprintfmt+0x66e>
+  801ef9:	89 c2                	mov    %eax,%edx
+  801efb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eff:	83 c0 08             	add    $0x8,%eax
+  801f02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f05:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f08:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f0d:	e9 6e ff ff ff       	jmp    801e80 <vprintfmt+0x5dc>
+  801f12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f1e:	eb e5                	jmp    801f05 <vprintfmt+0x661>
+    switch (lflag) {
+  801f20:	83 fa 01             	cmp    $0x1,%edx
+  801f23:	75 aa                	jne    801ecf <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f28:	83 f8 2f             	cmp    $0x2f,%eax
+  801f2b:	77 47                	ja     801f74 <vprintfmt+0x6d0>
+  801f2d:	89 c2                	mov    %eax,%edx
+  801f2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f33:	83 c0 08             	add    $0x8,%eax
+  801f36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f39:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801f41:	e9 3a ff ff ff       	jmp    801e80 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f49:	83 f8 2f             	cmp    $0x2f,%eax
+  801f4c:	77 18                	ja     801f66 <vprintfmt+0x6c2>
+  801f4e:	89 c2                	mov    %eax,%edx
+  801f50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f54:	83 c0 08             	add    $0x8,%eax
+  801f57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f5a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801f5c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801f61:	e9 1a ff ff ff       	jmp    801e80 <vprintfmt+0x5dc>
+  801f66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f72:	eb e6                	jmp    801f5a <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801f74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f80:	eb b7                	jmp    801f39 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801f82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f8e:	e9 54 ff ff ff       	jmp    801ee7 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801f93:	4c 89 ee             	mov    %r13,%rsi
+  801f96:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f9b:	41 ff d6             	call   *%r14
+            break;
+  801f9e:	e9 41 f9 ff ff       	jmp    8018e4 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801fa3:	4c 89 ee             	mov    %r13,%rsi
+  801fa6:	bf 25 00 00 00       	mov    $0x25,%edi
+  801fab:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801fae:	48 83 eb 01          	sub    $0x1,%rbx
+  801fb2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801fb6:	75 f6                	jne    801fae <vprintfmt+0x70a>
+  801fb8:	e9 27 f9 ff ff       	jmp    8018e4 <vprintfmt+0x40>
+
+0000000000801fbd <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801fbd:	55                   	push   %rbp
+  801fbe:	48 89 e5             	mov    %rsp,%rbp
+  801fc1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801fc5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801fc9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801fce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801fd2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801fd9:	48 85 ff             	test   %rdi,%rdi
+  801fdc:	74 2b                	je     802009 <vsnprintf+0x4c>
+  801fde:	48 85 f6             	test   %rsi,%rsi
+  801fe1:	74 26                	je     802009 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801fe3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe7:	48 bf 4f 18 80 00 00 	movabs $0x80184f,%rdi
+  801fee:	00 00 00 
+  801ff1:	48 b8 a4 18 80 00 00 	movabs $0x8018a4,%rax
+  801ff8:	00 00 00 
+  801ffb:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801ffd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802001:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802004:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802007:	c9                   	leave
+  802008:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802009:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80200e:	eb f7                	jmp    802007 <vsnprintf+0x4a>
+
+0000000000802010 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802010:	55                   	push   %rbp
+  802011:	48 89 e5             	mov    %rsp,%rbp
+  802014:	48 83 ec 50          	sub    $0x50,%rsp
+  802018:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80201c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802020:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802024:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80202b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80202f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802033:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802037:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80203b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80203f:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80204b:	c9                   	leave
+  80204c:	c3                   	ret
+
+000000000080204d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80204d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802050:	74 10                	je     802062 <strlen+0x15>
+    size_t n = 0;
+  802052:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802057:	48 83 c0 01          	add    $0x1,%rax
+  80205b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80205f:	75 f6                	jne    802057 <strlen+0xa>
+  802061:	c3                   	ret
+    size_t n = 0;
+  802062:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802067:	c3                   	ret
+
+0000000000802068 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802068:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80206b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802070:	48 85 f6             	test   %rsi,%rsi
+  802073:	74 11                	je     802086 <strnlen+0x1e>
+  802075:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802079:	74 0c                	je     802087 <strnlen+0x1f>
+  80207b:	48 83 c2 01          	add    $0x1,%rdx
+  80207f:	48 39 d0             	cmp    %rdx,%rax
+  802082:	75 f1                	jne    802075 <strnlen+0xd>
+  802084:	eb 04                	jmp    80208a <strnlen+0x22>
+  802086:	c3                   	ret
+  802087:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80208a:	c3                   	ret
+
+000000000080208b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80208b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80208e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802093:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802097:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80209a:	48 83 c2 01          	add    $0x1,%rdx
+  80209e:	84 c9                	test   %cl,%cl
+  8020a0:	75 f1                	jne    802093 <strcpy+0x8>
+        ;
+    return res;
+}
+  8020a2:	c3                   	ret
+
+00000000008020a3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8020a3:	55                   	push   %rbp
+  8020a4:	48 89 e5             	mov    %rsp,%rbp
+  8020a7:	41 54                	push   %r12
+  8020a9:	53                   	push   %rbx
+  8020aa:	48 89 fb             	mov    %rdi,%rbx
+  8020ad:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8020b0:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8020b7:	00 00 00 
+  8020ba:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8020bc:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8020c0:	4c 89 e6             	mov    %r12,%rsi
+  8020c3:	48 b8 8b 20 80 00 00 	movabs $0x80208b,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+    return dst;
+}
+  8020cf:	48 89 d8             	mov    %rbx,%rax
+  8020d2:	5b                   	pop    %rbx
+  8020d3:	41 5c                	pop    %r12
+  8020d5:	5d                   	pop    %rbp
+  8020d6:	c3                   	ret
+
+00000000008020d7 <toupper>:
+
+int
+toupper(int ch) {
+  8020d7:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8020d9:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8020dc:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8020df:	83 f9 1a             	cmp    $0x1a,%ecx
+  8020e2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8020e5:	c3                   	ret
+
+00000000008020e6 <tolower>:
+
+int
+tolower(int ch) {
+  8020e6:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8020e8:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8020eb:	8d 57 20             	lea    0x20(%rdi),%edx
+  8020ee:	83 f9 1a             	cmp    $0x1a,%ecx
+  8020f1:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8020f4:	c3                   	ret
+
+00000000008020f5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8020f5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8020f8:	48 85 d2             	test   %rdx,%rdx
+  8020fb:	74 1f                	je     80211c <strncpy+0x27>
+  8020fd:	48 01 fa             	add    %rdi,%rdx
+  802100:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802103:	48 83 c1 01          	add    $0x1,%rcx
+  802107:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80210b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80210f:	41 80 f8 01          	cmp    $0x1,%r8b
+  802113:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802117:	48 39 ca             	cmp    %rcx,%rdx
+  80211a:	75 e7                	jne    802103 <strncpy+0xe>
+    }
+    return ret;
+}
+  80211c:	c3                   	ret
+
+000000000080211d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80211d:	48 89 f8             	mov    %rdi,%rax
+  802120:	48 85 d2             	test   %rdx,%rdx
+  802123:	74 24                	je     802149 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802125:	48 83 ea 01          	sub    $0x1,%rdx
+  802129:	74 1b                	je     802146 <strlcpy+0x29>
+  80212b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80212f:	0f b6 16             	movzbl (%rsi),%edx
+  802132:	84 d2                	test   %dl,%dl
+  802134:	74 10                	je     802146 <strlcpy+0x29>
+            *dst++ = *src++;
+  802136:	48 83 c6 01          	add    $0x1,%rsi
+  80213a:	48 83 c0 01          	add    $0x1,%rax
+  80213e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802141:	48 39 c8             	cmp    %rcx,%rax
+  802144:	75 e9                	jne    80212f <strlcpy+0x12>
+        *dst = '\0';
+  802146:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802149:	48 29 f8             	sub    %rdi,%rax
+}
+  80214c:	c3                   	ret
+
+000000000080214d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80214d:	0f b6 07             	movzbl (%rdi),%eax
+  802150:	84 c0                	test   %al,%al
+  802152:	74 13                	je     802167 <strcmp+0x1a>
+  802154:	38 06                	cmp    %al,(%rsi)
+  802156:	75 0f                	jne    802167 <strcmp+0x1a>
+  802158:	48 83 c7 01          	add    $0x1,%rdi
+  80215c:	48 83 c6 01          	add    $0x1,%rsi
+  802160:	0f b6 07             	movzbl (%rdi),%eax
+  802163:	84 c0                	test   %al,%al
+  802165:	75 ed                	jne    802154 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802167:	0f b6 c0             	movzbl %al,%eax
+  80216a:	0f b6 16             	movzbl (%rsi),%edx
+  80216d:	29 d0                	sub    %edx,%eax
+}
+  80216f:	c3                   	ret
+
+0000000000802170 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802170:	48 85 d2             	test   %rdx,%rdx
+  802173:	74 1f                	je     802194 <strncmp+0x24>
+  802175:	0f b6 07             	movzbl (%rdi),%eax
+  802178:	84 c0                	test   %al,%al
+  80217a:	74 1e                	je     80219a <strncmp+0x2a>
+  80217c:	3a 06                	cmp    (%rsi),%al
+  80217e:	75 1a                	jne    80219a <strncmp+0x2a>
+  802180:	48 83 c7 01          	add    $0x1,%rdi
+  802184:	48 83 c6 01          	add    $0x1,%rsi
+  802188:	48 83 ea 01          	sub    $0x1,%rdx
+  80218c:	75 e7                	jne    802175 <strncmp+0x5>
+
+    if (!n) return 0;
+  80218e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802193:	c3                   	ret
+  802194:	b8 00 00 00 00       	mov    $0x0,%eax
+  802199:	c3                   	ret
+  80219a:	48 85 d2             	test   %rdx,%rdx
+  80219d:	74 09                	je     8021a8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80219f:	0f b6 07             	movzbl (%rdi),%eax
+  8021a2:	0f b6 16             	movzbl (%rsi),%edx
+  8021a5:	29 d0                	sub    %edx,%eax
+  8021a7:	c3                   	ret
+    if (!n) return 0;
+  8021a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ad:	c3                   	ret
+
+00000000008021ae <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8021ae:	0f b6 17             	movzbl (%rdi),%edx
+  8021b1:	84 d2                	test   %dl,%dl
+  8021b3:	74 18                	je     8021cd <strchr+0x1f>
+        if (*str == c) {
+  8021b5:	0f be d2             	movsbl %dl,%edx
+  8021b8:	39 f2                	cmp    %esi,%edx
+  8021ba:	74 17                	je     8021d3 <strchr+0x25>
+    for (; *str; str++) {
+  8021bc:	48 83 c7 01          	add    $0x1,%rdi
+  8021c0:	0f b6 17             	movzbl (%rdi),%edx
+  8021c3:	84 d2                	test   %dl,%dl
+  8021c5:	75 ee                	jne    8021b5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8021c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021cc:	c3                   	ret
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d2:	c3                   	ret
+  8021d3:	48 89 f8             	mov    %rdi,%rax
+}
+  8021d6:	c3                   	ret
+
+00000000008021d7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8021d7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8021da:	0f b6 17             	movzbl (%rdi),%edx
+  8021dd:	84 d2                	test   %dl,%dl
+  8021df:	74 13                	je     8021f4 <strfind+0x1d>
+  8021e1:	0f be d2             	movsbl %dl,%edx
+  8021e4:	39 f2                	cmp    %esi,%edx
+  8021e6:	74 0b                	je     8021f3 <strfind+0x1c>
+  8021e8:	48 83 c0 01          	add    $0x1,%rax
+  8021ec:	0f b6 10             	movzbl (%rax),%edx
+  8021ef:	84 d2                	test   %dl,%dl
+  8021f1:	75 ee                	jne    8021e1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8021f3:	c3                   	ret
+  8021f4:	c3                   	ret
+
+00000000008021f5 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021f5:	48 39 f7             	cmp    %rsi,%rdi
+  8021f8:	74 65                	je     80225f <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8021fa:	55                   	push   %rbp
+  8021fb:	48 89 e5             	mov    %rsp,%rbp
+  8021fe:	41 57                	push   %r15
+  802200:	41 56                	push   %r14
+  802202:	41 55                	push   %r13
+  802204:	41 54                	push   %r12
+  802206:	53                   	push   %rbx
+  802207:	48 83 ec 18          	sub    $0x18,%rsp
+  80220b:	48 89 fb             	mov    %rdi,%rbx
+  80220e:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802211:	49 bf e6 20 80 00 00 	movabs $0x8020e6,%r15
+  802218:	00 00 00 
+  80221b:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80221f:	41 0f b6 fd          	movzbl %r13b,%edi
+  802223:	41 ff d7             	call   *%r15
+  802226:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802229:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80222e:	41 0f b6 fe          	movzbl %r14b,%edi
+  802232:	41 ff d7             	call   *%r15
+  802235:	89 c2                	mov    %eax,%edx
+  802237:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80223a:	29 d0                	sub    %edx,%eax
+  80223c:	75 12                	jne    802250 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80223e:	48 83 c3 01          	add    $0x1,%rbx
+  802242:	45 84 ed             	test   %r13b,%r13b
+  802245:	74 09                	je     802250 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802247:	49 83 c4 01          	add    $0x1,%r12
+  80224b:	45 84 f6             	test   %r14b,%r14b
+  80224e:	75 cb                	jne    80221b <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802250:	48 83 c4 18          	add    $0x18,%rsp
+  802254:	5b                   	pop    %rbx
+  802255:	41 5c                	pop    %r12
+  802257:	41 5d                	pop    %r13
+  802259:	41 5e                	pop    %r14
+  80225b:	41 5f                	pop    %r15
+  80225d:	5d                   	pop    %rbp
+  80225e:	c3                   	ret
+    if (p1 == p2) return 0;
+  80225f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802264:	c3                   	ret
+
+0000000000802265 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802265:	48 39 f7             	cmp    %rsi,%rdi
+  802268:	74 7d                	je     8022e7 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80226a:	55                   	push   %rbp
+  80226b:	48 89 e5             	mov    %rsp,%rbp
+  80226e:	41 57                	push   %r15
+  802270:	41 56                	push   %r14
+  802272:	41 55                	push   %r13
+  802274:	41 54                	push   %r12
+  802276:	53                   	push   %rbx
+  802277:	48 83 ec 18          	sub    $0x18,%rsp
+  80227b:	48 89 fb             	mov    %rdi,%rbx
+  80227e:	49 89 f4             	mov    %rsi,%r12
+  802281:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802285:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802289:	49 bf e6 20 80 00 00 	movabs $0x8020e6,%r15
+  802290:	00 00 00 
+    while (n--) {
+  802293:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802297:	48 39 c3             	cmp    %rax,%rbx
+  80229a:	74 37                	je     8022d3 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80229c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022a0:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022a4:	41 ff d7             	call   *%r15
+  8022a7:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022aa:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8022af:	41 0f b6 fe          	movzbl %r14b,%edi
+  8022b3:	41 ff d7             	call   *%r15
+  8022b6:	89 c2                	mov    %eax,%edx
+  8022b8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022bb:	29 d0                	sub    %edx,%eax
+  8022bd:	75 19                	jne    8022d8 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8022bf:	48 83 c3 01          	add    $0x1,%rbx
+  8022c3:	45 84 ed             	test   %r13b,%r13b
+  8022c6:	74 10                	je     8022d8 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8022c8:	49 83 c4 01          	add    $0x1,%r12
+  8022cc:	45 84 f6             	test   %r14b,%r14b
+  8022cf:	75 c2                	jne    802293 <strncasecmp+0x2e>
+  8022d1:	eb 05                	jmp    8022d8 <strncasecmp+0x73>
+  8022d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8022d8:	48 83 c4 18          	add    $0x18,%rsp
+  8022dc:	5b                   	pop    %rbx
+  8022dd:	41 5c                	pop    %r12
+  8022df:	41 5d                	pop    %r13
+  8022e1:	41 5e                	pop    %r14
+  8022e3:	41 5f                	pop    %r15
+  8022e5:	5d                   	pop    %rbp
+  8022e6:	c3                   	ret
+    if (p1 == p2) return 0;
+  8022e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ec:	c3                   	ret
+
+00000000008022ed <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8022ed:	83 e7 df             	and    $0xffffffdf,%edi
+  8022f0:	83 ef 41             	sub    $0x41,%edi
+  8022f3:	83 ff 19             	cmp    $0x19,%edi
+  8022f6:	0f 96 c0             	setbe  %al
+}
+  8022f9:	c3                   	ret
+
+00000000008022fa <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8022fa:	83 ff 20             	cmp    $0x20,%edi
+  8022fd:	0f 94 c0             	sete   %al
+  802300:	83 ff 09             	cmp    $0x9,%edi
+  802303:	0f 94 c2             	sete   %dl
+  802306:	09 d0                	or     %edx,%eax
+}
+  802308:	c3                   	ret
+
+0000000000802309 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802309:	55                   	push   %rbp
+  80230a:	48 89 e5             	mov    %rsp,%rbp
+  80230d:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80230f:	48 bf 3f 62 80 00 00 	movabs $0x80623f,%rdi
+  802316:	00 00 00 
+  802319:	48 b8 ae 21 80 00 00 	movabs $0x8021ae,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+  802325:	48 85 c0             	test   %rax,%rax
+  802328:	0f 95 c0             	setne  %al
+}
+  80232b:	5d                   	pop    %rbp
+  80232c:	c3                   	ret
+
+000000000080232d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80232d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802330:	48 89 f8             	mov    %rdi,%rax
+  802333:	48 f7 d8             	neg    %rax
+  802336:	83 e0 07             	and    $0x7,%eax
+  802339:	49 89 d1             	mov    %rdx,%r9
+  80233c:	49 29 c1             	sub    %rax,%r9
+  80233f:	78 36                	js     802377 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802341:	40 0f b6 c6          	movzbl %sil,%eax
+  802345:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80234c:	01 01 01 
+  80234f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802353:	40 f6 c7 07          	test   $0x7,%dil
+  802357:	75 38                	jne    802391 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802359:	4c 89 c9             	mov    %r9,%rcx
+  80235c:	48 c1 f9 03          	sar    $0x3,%rcx
+  802360:	74 0c                	je     80236e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802362:	fc                   	cld
+  802363:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802366:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80236a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80236e:	4d 85 c9             	test   %r9,%r9
+  802371:	75 45                	jne    8023b8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802373:	4c 89 c0             	mov    %r8,%rax
+  802376:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802377:	48 85 d2             	test   %rdx,%rdx
+  80237a:	74 f7                	je     802373 <memset+0x46>
+  80237c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80237f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802382:	48 83 c0 01          	add    $0x1,%rax
+  802386:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80238a:	48 39 c2             	cmp    %rax,%rdx
+  80238d:	75 f3                	jne    802382 <memset+0x55>
+  80238f:	eb e2                	jmp    802373 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802391:	40 f6 c7 01          	test   $0x1,%dil
+  802395:	74 06                	je     80239d <memset+0x70>
+  802397:	88 07                	mov    %al,(%rdi)
+  802399:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80239d:	40 f6 c7 02          	test   $0x2,%dil
+  8023a1:	74 07                	je     8023aa <memset+0x7d>
+  8023a3:	66 89 07             	mov    %ax,(%rdi)
+  8023a6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023aa:	40 f6 c7 04          	test   $0x4,%dil
+  8023ae:	74 a9                	je     802359 <memset+0x2c>
+  8023b0:	89 07                	mov    %eax,(%rdi)
+  8023b2:	48 83 c7 04          	add    $0x4,%rdi
+  8023b6:	eb a1                	jmp    802359 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023b8:	41 f6 c1 04          	test   $0x4,%r9b
+  8023bc:	74 06                	je     8023c4 <memset+0x97>
+  8023be:	89 07                	mov    %eax,(%rdi)
+  8023c0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023c4:	41 f6 c1 02          	test   $0x2,%r9b
+  8023c8:	74 07                	je     8023d1 <memset+0xa4>
+  8023ca:	66 89 07             	mov    %ax,(%rdi)
+  8023cd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8023d1:	41 f6 c1 01          	test   $0x1,%r9b
+  8023d5:	74 9c                	je     802373 <memset+0x46>
+  8023d7:	88 07                	mov    %al,(%rdi)
+  8023d9:	eb 98                	jmp    802373 <memset+0x46>
+
+00000000008023db <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8023db:	48 89 f8             	mov    %rdi,%rax
+  8023de:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8023e1:	48 39 fe             	cmp    %rdi,%rsi
+  8023e4:	73 3b                	jae    802421 <memmove+0x46>
+  8023e6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8023ea:	48 39 d7             	cmp    %rdx,%rdi
+  8023ed:	73 32                	jae    802421 <memmove+0x46>
+        s += n;
+        d += n;
+  8023ef:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8023f3:	48 89 d6             	mov    %rdx,%rsi
+  8023f6:	48 09 fe             	or     %rdi,%rsi
+  8023f9:	48 09 ce             	or     %rcx,%rsi
+  8023fc:	40 f6 c6 07          	test   $0x7,%sil
+  802400:	75 12                	jne    802414 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802402:	48 83 ef 08          	sub    $0x8,%rdi
+  802406:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80240a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80240e:	fd                   	std
+  80240f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802412:	fc                   	cld
+  802413:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802414:	48 83 ef 01          	sub    $0x1,%rdi
+  802418:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80241c:	fd                   	std
+  80241d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80241f:	eb f1                	jmp    802412 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802421:	48 89 f2             	mov    %rsi,%rdx
+  802424:	48 09 c2             	or     %rax,%rdx
+  802427:	48 09 ca             	or     %rcx,%rdx
+  80242a:	f6 c2 07             	test   $0x7,%dl
+  80242d:	75 0c                	jne    80243b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80242f:	48 c1 e9 03          	shr    $0x3,%rcx
+  802433:	48 89 c7             	mov    %rax,%rdi
+  802436:	fc                   	cld
+  802437:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80243a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80243b:	48 89 c7             	mov    %rax,%rdi
+  80243e:	fc                   	cld
+  80243f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802441:	c3                   	ret
+
+0000000000802442 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802442:	55                   	push   %rbp
+  802443:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802446:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  80244d:	00 00 00 
+  802450:	ff d0                	call   *%rax
+}
+  802452:	5d                   	pop    %rbp
+  802453:	c3                   	ret
+
+0000000000802454 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802454:	55                   	push   %rbp
+  802455:	48 89 e5             	mov    %rsp,%rbp
+  802458:	41 57                	push   %r15
+  80245a:	41 56                	push   %r14
+  80245c:	41 55                	push   %r13
+  80245e:	41 54                	push   %r12
+  802460:	53                   	push   %rbx
+  802461:	48 83 ec 08          	sub    $0x8,%rsp
+  802465:	49 89 fe             	mov    %rdi,%r14
+  802468:	49 89 f7             	mov    %rsi,%r15
+  80246b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80246e:	48 89 f7             	mov    %rsi,%rdi
+  802471:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  802478:	00 00 00 
+  80247b:	ff d0                	call   *%rax
+  80247d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802480:	48 89 de             	mov    %rbx,%rsi
+  802483:	4c 89 f7             	mov    %r14,%rdi
+  802486:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+  802492:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802495:	48 39 c3             	cmp    %rax,%rbx
+  802498:	74 36                	je     8024d0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80249a:	48 89 d8             	mov    %rbx,%rax
+  80249d:	4c 29 e8             	sub    %r13,%rax
+  8024a0:	49 39 c4             	cmp    %rax,%r12
+  8024a3:	73 31                	jae    8024d6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8024a5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8024aa:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024ae:	4c 89 fe             	mov    %r15,%rsi
+  8024b1:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8024bd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8024c1:	48 83 c4 08          	add    $0x8,%rsp
+  8024c5:	5b                   	pop    %rbx
+  8024c6:	41 5c                	pop    %r12
+  8024c8:	41 5d                	pop    %r13
+  8024ca:	41 5e                	pop    %r14
+  8024cc:	41 5f                	pop    %r15
+  8024ce:	5d                   	pop    %rbp
+  8024cf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024d0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8024d4:	eb eb                	jmp    8024c1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8024d6:	48 83 eb 01          	sub    $0x1,%rbx
+  8024da:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024de:	48 89 da             	mov    %rbx,%rdx
+  8024e1:	4c 89 fe             	mov    %r15,%rsi
+  8024e4:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8024f0:	49 01 de             	add    %rbx,%r14
+  8024f3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8024f8:	eb c3                	jmp    8024bd <strlcat+0x69>
+
+00000000008024fa <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8024fa:	48 85 d2             	test   %rdx,%rdx
+  8024fd:	74 2d                	je     80252c <memcmp+0x32>
+  8024ff:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802504:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802508:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80250d:	44 38 c1             	cmp    %r8b,%cl
+  802510:	75 0f                	jne    802521 <memcmp+0x27>
+    while (n-- > 0) {
+  802512:	48 83 c0 01          	add    $0x1,%rax
+  802516:	48 39 c2             	cmp    %rax,%rdx
+  802519:	75 e9                	jne    802504 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80251b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802520:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802521:	0f b6 c1             	movzbl %cl,%eax
+  802524:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802528:	44 29 c0             	sub    %r8d,%eax
+  80252b:	c3                   	ret
+    return 0;
+  80252c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802531:	c3                   	ret
+
+0000000000802532 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802532:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802536:	48 39 c7             	cmp    %rax,%rdi
+  802539:	73 0f                	jae    80254a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80253b:	40 38 37             	cmp    %sil,(%rdi)
+  80253e:	74 0e                	je     80254e <memfind+0x1c>
+    for (; src < end; src++) {
+  802540:	48 83 c7 01          	add    $0x1,%rdi
+  802544:	48 39 f8             	cmp    %rdi,%rax
+  802547:	75 f2                	jne    80253b <memfind+0x9>
+  802549:	c3                   	ret
+  80254a:	48 89 f8             	mov    %rdi,%rax
+  80254d:	c3                   	ret
+  80254e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802551:	c3                   	ret
+
+0000000000802552 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802552:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802555:	0f b6 37             	movzbl (%rdi),%esi
+  802558:	40 80 fe 20          	cmp    $0x20,%sil
+  80255c:	74 06                	je     802564 <strtol+0x12>
+  80255e:	40 80 fe 09          	cmp    $0x9,%sil
+  802562:	75 13                	jne    802577 <strtol+0x25>
+  802564:	48 83 c7 01          	add    $0x1,%rdi
+  802568:	0f b6 37             	movzbl (%rdi),%esi
+  80256b:	40 80 fe 20          	cmp    $0x20,%sil
+  80256f:	74 f3                	je     802564 <strtol+0x12>
+  802571:	40 80 fe 09          	cmp    $0x9,%sil
+  802575:	74 ed                	je     802564 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802577:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80257a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80257d:	3c 01                	cmp    $0x1,%al
+  80257f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802583:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802589:	75 0f                	jne    80259a <strtol+0x48>
+  80258b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80258e:	74 14                	je     8025a4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802590:	85 d2                	test   %edx,%edx
+  802592:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802597:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80259a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80259f:	4c 63 ca             	movslq %edx,%r9
+  8025a2:	eb 36                	jmp    8025da <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025a4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8025a8:	74 0f                	je     8025b9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8025aa:	85 d2                	test   %edx,%edx
+  8025ac:	75 ec                	jne    80259a <strtol+0x48>
+        s++;
+  8025ae:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8025b2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8025b7:	eb e1                	jmp    80259a <strtol+0x48>
+        s += 2;
+  8025b9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8025bd:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8025c2:	eb d6                	jmp    80259a <strtol+0x48>
+            dig -= '0';
+  8025c4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8025c7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8025cb:	41 39 d0             	cmp    %edx,%r8d
+  8025ce:	7d 21                	jge    8025f1 <strtol+0x9f>
+        val = val * base + dig;
+  8025d0:	49 0f af c1          	imul   %r9,%rax
+  8025d4:	0f b6 c9             	movzbl %cl,%ecx
+  8025d7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8025da:	48 83 c7 01          	add    $0x1,%rdi
+  8025de:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8025e2:	80 f9 39             	cmp    $0x39,%cl
+  8025e5:	76 dd                	jbe    8025c4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8025e7:	80 f9 7b             	cmp    $0x7b,%cl
+  8025ea:	77 05                	ja     8025f1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8025ec:	83 e9 57             	sub    $0x57,%ecx
+  8025ef:	eb d6                	jmp    8025c7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8025f1:	4d 85 d2             	test   %r10,%r10
+  8025f4:	74 03                	je     8025f9 <strtol+0xa7>
+  8025f6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8025f9:	48 89 c2             	mov    %rax,%rdx
+  8025fc:	48 f7 da             	neg    %rdx
+  8025ff:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802603:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802607:	c3                   	ret
+
+0000000000802608 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802608:	55                   	push   %rbp
+  802609:	48 89 e5             	mov    %rsp,%rbp
+  80260c:	53                   	push   %rbx
+  80260d:	48 89 fa             	mov    %rdi,%rdx
+  802610:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802613:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802618:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80261d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802622:	be 00 00 00 00       	mov    $0x0,%esi
+  802627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80262d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802633:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802635:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802639:	c9                   	leave
+  80263a:	c3                   	ret
+
+000000000080263b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80263b:	55                   	push   %rbp
+  80263c:	48 89 e5             	mov    %rsp,%rbp
+  80263f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802640:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802645:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80264f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802654:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802659:	be 00 00 00 00       	mov    $0x0,%esi
+  80265e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802664:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80266a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80266c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802670:	c9                   	leave
+  802671:	c3                   	ret
+
+0000000000802672 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802672:	55                   	push   %rbp
+  802673:	48 89 e5             	mov    %rsp,%rbp
+  802676:	53                   	push   %rbx
+  802677:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80267a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80267f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802689:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80268e:	be 00 00 00 00       	mov    $0x0,%esi
+  802693:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802699:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80269f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8026a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026a5:	c9                   	leave
+  8026a6:	c3                   	ret
+
+00000000008026a7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8026a7:	55                   	push   %rbp
+  8026a8:	48 89 e5             	mov    %rsp,%rbp
+  8026ab:	53                   	push   %rbx
+  8026ac:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8026b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8026b3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8026da:	48 85 c0             	test   %rax,%rax
+  8026dd:	7f 06                	jg     8026e5 <sys_env_destroy+0x3e>
+}
+  8026df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e3:	c9                   	leave
+  8026e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8026e5:	49 89 c0             	mov    %rax,%r8
+  8026e8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8026ed:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8026f4:	00 00 00 
+  8026f7:	be 27 00 00 00       	mov    $0x27,%esi
+  8026fc:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802703:	00 00 00 
+  802706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270b:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802712:	00 00 00 
+  802715:	41 ff d1             	call   *%r9
+
+0000000000802718 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802718:	55                   	push   %rbp
+  802719:	48 89 e5             	mov    %rsp,%rbp
+  80271c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80271d:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802722:	ba 00 00 00 00       	mov    $0x0,%edx
+  802727:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80272c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802731:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802736:	be 00 00 00 00       	mov    $0x0,%esi
+  80273b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802741:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802747:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802749:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80274d:	c9                   	leave
+  80274e:	c3                   	ret
+
+000000000080274f <sys_yield>:
+
+void
+sys_yield(void) {
+  80274f:	55                   	push   %rbp
+  802750:	48 89 e5             	mov    %rsp,%rbp
+  802753:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802754:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802763:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802768:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80276d:	be 00 00 00 00       	mov    $0x0,%esi
+  802772:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802778:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80277e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802780:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802784:	c9                   	leave
+  802785:	c3                   	ret
+
+0000000000802786 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802786:	55                   	push   %rbp
+  802787:	48 89 e5             	mov    %rsp,%rbp
+  80278a:	53                   	push   %rbx
+  80278b:	48 89 fa             	mov    %rdi,%rdx
+  80278e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802791:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802796:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80279d:	00 00 00 
+  8027a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8027b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027bc:	c9                   	leave
+  8027bd:	c3                   	ret
+
+00000000008027be <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8027be:	55                   	push   %rbp
+  8027bf:	48 89 e5             	mov    %rsp,%rbp
+  8027c2:	53                   	push   %rbx
+  8027c3:	49 89 f8             	mov    %rdi,%r8
+  8027c6:	48 89 d3             	mov    %rdx,%rbx
+  8027c9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8027cc:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027d1:	4c 89 c2             	mov    %r8,%rdx
+  8027d4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027e8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8027ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027ee:	c9                   	leave
+  8027ef:	c3                   	ret
+
+00000000008027f0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8027f0:	55                   	push   %rbp
+  8027f1:	48 89 e5             	mov    %rsp,%rbp
+  8027f4:	53                   	push   %rbx
+  8027f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f9:	89 f8                	mov    %edi,%eax
+  8027fb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8027fe:	48 63 f9             	movslq %ecx,%rdi
+  802801:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802804:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802809:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80280c:	be 00 00 00 00       	mov    $0x0,%esi
+  802811:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802817:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80281d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80281f:	48 85 c0             	test   %rax,%rax
+  802822:	7f 06                	jg     80282a <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802824:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802828:	c9                   	leave
+  802829:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80282a:	49 89 c0             	mov    %rax,%r8
+  80282d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802832:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802839:	00 00 00 
+  80283c:	be 27 00 00 00       	mov    $0x27,%esi
+  802841:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802848:	00 00 00 
+  80284b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802850:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802857:	00 00 00 
+  80285a:	41 ff d1             	call   *%r9
+
+000000000080285d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80285d:	55                   	push   %rbp
+  80285e:	48 89 e5             	mov    %rsp,%rbp
+  802861:	53                   	push   %rbx
+  802862:	48 83 ec 08          	sub    $0x8,%rsp
+  802866:	89 f8                	mov    %edi,%eax
+  802868:	49 89 f2             	mov    %rsi,%r10
+  80286b:	48 89 cf             	mov    %rcx,%rdi
+  80286e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802871:	48 63 da             	movslq %edx,%rbx
+  802874:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802877:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80287c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80287f:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802882:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802888:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80288a:	48 85 c0             	test   %rax,%rax
+  80288d:	7f 06                	jg     802895 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80288f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802893:	c9                   	leave
+  802894:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802895:	49 89 c0             	mov    %rax,%r8
+  802898:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80289d:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8028a4:	00 00 00 
+  8028a7:	be 27 00 00 00       	mov    $0x27,%esi
+  8028ac:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  8028b3:	00 00 00 
+  8028b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bb:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  8028c2:	00 00 00 
+  8028c5:	41 ff d1             	call   *%r9
+
+00000000008028c8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8028c8:	55                   	push   %rbp
+  8028c9:	48 89 e5             	mov    %rsp,%rbp
+  8028cc:	53                   	push   %rbx
+  8028cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d1:	48 89 f1             	mov    %rsi,%rcx
+  8028d4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8028d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028da:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028f7:	48 85 c0             	test   %rax,%rax
+  8028fa:	7f 06                	jg     802902 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8028fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802900:	c9                   	leave
+  802901:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802902:	49 89 c0             	mov    %rax,%r8
+  802905:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80290a:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802911:	00 00 00 
+  802914:	be 27 00 00 00       	mov    $0x27,%esi
+  802919:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802920:	00 00 00 
+  802923:	b8 00 00 00 00       	mov    $0x0,%eax
+  802928:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  80292f:	00 00 00 
+  802932:	41 ff d1             	call   *%r9
+
+0000000000802935 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802935:	55                   	push   %rbp
+  802936:	48 89 e5             	mov    %rsp,%rbp
+  802939:	53                   	push   %rbx
+  80293a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80293e:	48 63 ce             	movslq %esi,%rcx
+  802941:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802944:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802949:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80294e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802953:	be 00 00 00 00       	mov    $0x0,%esi
+  802958:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80295e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802964:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802966:	48 85 c0             	test   %rax,%rax
+  802969:	7f 06                	jg     802971 <sys_env_set_status+0x3c>
+}
+  80296b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80296f:	c9                   	leave
+  802970:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802971:	49 89 c0             	mov    %rax,%r8
+  802974:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802979:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802980:	00 00 00 
+  802983:	be 27 00 00 00       	mov    $0x27,%esi
+  802988:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  80298f:	00 00 00 
+  802992:	b8 00 00 00 00       	mov    $0x0,%eax
+  802997:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  80299e:	00 00 00 
+  8029a1:	41 ff d1             	call   *%r9
+
+00000000008029a4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8029a4:	55                   	push   %rbp
+  8029a5:	48 89 e5             	mov    %rsp,%rbp
+  8029a8:	53                   	push   %rbx
+  8029a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ad:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8029b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029d5:	48 85 c0             	test   %rax,%rax
+  8029d8:	7f 06                	jg     8029e0 <sys_env_set_trapframe+0x3c>
+}
+  8029da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029de:	c9                   	leave
+  8029df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e0:	49 89 c0             	mov    %rax,%r8
+  8029e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8029e8:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8029ef:	00 00 00 
+  8029f2:	be 27 00 00 00       	mov    $0x27,%esi
+  8029f7:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  8029fe:	00 00 00 
+  802a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a06:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802a0d:	00 00 00 
+  802a10:	41 ff d1             	call   *%r9
+
+0000000000802a13 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802a13:	55                   	push   %rbp
+  802a14:	48 89 e5             	mov    %rsp,%rbp
+  802a17:	53                   	push   %rbx
+  802a18:	48 83 ec 08          	sub    $0x8,%rsp
+  802a1c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a1f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a22:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a2c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a31:	be 00 00 00 00       	mov    $0x0,%esi
+  802a36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a3c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a42:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a44:	48 85 c0             	test   %rax,%rax
+  802a47:	7f 06                	jg     802a4f <sys_env_set_pgfault_upcall+0x3c>
+}
+  802a49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4d:	c9                   	leave
+  802a4e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a4f:	49 89 c0             	mov    %rax,%r8
+  802a52:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802a57:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802a5e:	00 00 00 
+  802a61:	be 27 00 00 00       	mov    $0x27,%esi
+  802a66:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802a6d:	00 00 00 
+  802a70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a75:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802a7c:	00 00 00 
+  802a7f:	41 ff d1             	call   *%r9
+
+0000000000802a82 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802a82:	55                   	push   %rbp
+  802a83:	48 89 e5             	mov    %rsp,%rbp
+  802a86:	53                   	push   %rbx
+  802a87:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802a8b:	40 0f b6 ce          	movzbl %sil,%ecx
+  802a8f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a92:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa1:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ab4:	48 85 c0             	test   %rax,%rax
+  802ab7:	7f 06                	jg     802abf <sys_env_set_reclaim+0x3d>
+}
+  802ab9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802abd:	c9                   	leave
+  802abe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802abf:	49 89 c0             	mov    %rax,%r8
+  802ac2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802ac7:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802ace:	00 00 00 
+  802ad1:	be 27 00 00 00       	mov    $0x27,%esi
+  802ad6:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802add:	00 00 00 
+  802ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae5:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802aec:	00 00 00 
+  802aef:	41 ff d1             	call   *%r9
+
+0000000000802af2 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802af2:	55                   	push   %rbp
+  802af3:	48 89 e5             	mov    %rsp,%rbp
+  802af6:	53                   	push   %rbx
+  802af7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802afb:	48 63 ce             	movslq %esi,%rcx
+  802afe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b01:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b10:	be 00 00 00 00       	mov    $0x0,%esi
+  802b15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b21:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b23:	48 85 c0             	test   %rax,%rax
+  802b26:	7f 06                	jg     802b2e <sys_env_set_nice+0x3c>
+}
+  802b28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b2e:	49 89 c0             	mov    %rax,%r8
+  802b31:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802b36:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802b3d:	00 00 00 
+  802b40:	be 27 00 00 00       	mov    $0x27,%esi
+  802b45:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802b4c:	00 00 00 
+  802b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b54:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802b5b:	00 00 00 
+  802b5e:	41 ff d1             	call   *%r9
+
+0000000000802b61 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802b61:	55                   	push   %rbp
+  802b62:	48 89 e5             	mov    %rsp,%rbp
+  802b65:	53                   	push   %rbx
+  802b66:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b69:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b8e:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802b90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b94:	c9                   	leave
+  802b95:	c3                   	ret
+
+0000000000802b96 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b96:	55                   	push   %rbp
+  802b97:	48 89 e5             	mov    %rsp,%rbp
+  802b9a:	53                   	push   %rbx
+  802b9b:	89 f8                	mov    %edi,%eax
+  802b9d:	49 89 f1             	mov    %rsi,%r9
+  802ba0:	48 89 d3             	mov    %rdx,%rbx
+  802ba3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ba6:	49 63 f0             	movslq %r8d,%rsi
+  802ba9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bac:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bb1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bc0:	cd 30                	int    $0x30
+}
+  802bc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bc6:	c9                   	leave
+  802bc7:	c3                   	ret
+
+0000000000802bc8 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802bc8:	55                   	push   %rbp
+  802bc9:	48 89 e5             	mov    %rsp,%rbp
+  802bcc:	53                   	push   %rbx
+  802bcd:	89 f8                	mov    %edi,%eax
+  802bcf:	49 89 f1             	mov    %rsi,%r9
+  802bd2:	48 89 d3             	mov    %rdx,%rbx
+  802bd5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bd8:	49 63 f0             	movslq %r8d,%rsi
+  802bdb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bde:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802be3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bf2:	cd 30                	int    $0x30
+}
+  802bf4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bf8:	c9                   	leave
+  802bf9:	c3                   	ret
+
+0000000000802bfa <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802bfa:	55                   	push   %rbp
+  802bfb:	48 89 e5             	mov    %rsp,%rbp
+  802bfe:	53                   	push   %rbx
+  802bff:	48 83 ec 08          	sub    $0x8,%rsp
+  802c03:	89 f8                	mov    %edi,%eax
+  802c05:	49 89 f2             	mov    %rsi,%r10
+  802c08:	48 89 d3             	mov    %rdx,%rbx
+  802c0b:	48 89 cf             	mov    %rcx,%rdi
+  802c0e:	44 89 c6             	mov    %r8d,%esi
+  802c11:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c14:	48 63 f6             	movslq %esi,%rsi
+  802c17:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c1a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1f:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c22:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c26:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c28:	48 85 c0             	test   %rax,%rax
+  802c2b:	7f 06                	jg     802c33 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c31:	c9                   	leave
+  802c32:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c33:	49 89 c0             	mov    %rax,%r8
+  802c36:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802c3b:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802c42:	00 00 00 
+  802c45:	be 27 00 00 00       	mov    $0x27,%esi
+  802c4a:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802c51:	00 00 00 
+  802c54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c59:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802c60:	00 00 00 
+  802c63:	41 ff d1             	call   *%r9
+
+0000000000802c66 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802c66:	55                   	push   %rbp
+  802c67:	48 89 e5             	mov    %rsp,%rbp
+  802c6a:	53                   	push   %rbx
+  802c6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c6f:	48 89 f1             	mov    %rsi,%rcx
+  802c72:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802c75:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802c79:	48 8b 1a             	mov    (%rdx),%rbx
+  802c7c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c7f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c84:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c88:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802c8c:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802c90:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c92:	48 85 c0             	test   %rax,%rax
+  802c95:	7f 06                	jg     802c9d <sys_ipc_call_short+0x37>
+}
+  802c97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c9b:	c9                   	leave
+  802c9c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c9d:	49 89 c0             	mov    %rax,%r8
+  802ca0:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802ca5:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802cac:	00 00 00 
+  802caf:	be 27 00 00 00       	mov    $0x27,%esi
+  802cb4:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802cbb:	00 00 00 
+  802cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc3:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802cca:	00 00 00 
+  802ccd:	41 ff d1             	call   *%r9
+
+0000000000802cd0 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802cd0:	55                   	push   %rbp
+  802cd1:	48 89 e5             	mov    %rsp,%rbp
+  802cd4:	53                   	push   %rbx
+  802cd5:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd9:	89 f8                	mov    %edi,%eax
+  802cdb:	49 89 f2             	mov    %rsi,%r10
+  802cde:	48 89 d3             	mov    %rdx,%rbx
+  802ce1:	48 89 cf             	mov    %rcx,%rdi
+  802ce4:	44 89 c6             	mov    %r8d,%esi
+  802ce7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802cea:	48 63 f6             	movslq %esi,%rsi
+  802ced:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cf0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cf5:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802cf8:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802cfc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cfe:	48 85 c0             	test   %rax,%rax
+  802d01:	7f 06                	jg     802d09 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d09:	49 89 c0             	mov    %rax,%r8
+  802d0c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802d11:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802d18:	00 00 00 
+  802d1b:	be 27 00 00 00       	mov    $0x27,%esi
+  802d20:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802d27:	00 00 00 
+  802d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2f:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802d36:	00 00 00 
+  802d39:	41 ff d1             	call   *%r9
+
+0000000000802d3c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802d3c:	55                   	push   %rbp
+  802d3d:	48 89 e5             	mov    %rsp,%rbp
+  802d40:	53                   	push   %rbx
+  802d41:	48 83 ec 08          	sub    $0x8,%rsp
+  802d45:	48 89 fa             	mov    %rdi,%rdx
+  802d48:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d4b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d55:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d65:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d6b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d6d:	48 85 c0             	test   %rax,%rax
+  802d70:	7f 06                	jg     802d78 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d76:	c9                   	leave
+  802d77:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d78:	49 89 c0             	mov    %rax,%r8
+  802d7b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802d80:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  802d87:	00 00 00 
+  802d8a:	be 27 00 00 00       	mov    $0x27,%esi
+  802d8f:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  802d96:	00 00 00 
+  802d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9e:	49 b9 c4 53 80 00 00 	movabs $0x8053c4,%r9
+  802da5:	00 00 00 
+  802da8:	41 ff d1             	call   *%r9
+
+0000000000802dab <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802dab:	55                   	push   %rbp
+  802dac:	48 89 e5             	mov    %rsp,%rbp
+  802daf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802db0:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dc4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dc9:	be 00 00 00 00       	mov    $0x0,%esi
+  802dce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dda:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ddc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de0:	c9                   	leave
+  802de1:	c3                   	ret
+
+0000000000802de2 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802de2:	55                   	push   %rbp
+  802de3:	48 89 e5             	mov    %rsp,%rbp
+  802de6:	53                   	push   %rbx
+  802de7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dea:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802def:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dfe:	be 00 00 00 00       	mov    $0x0,%esi
+  802e03:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e09:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e0f:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802e11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e15:	c9                   	leave
+  802e16:	c3                   	ret
+
+0000000000802e17 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802e17:	55                   	push   %rbp
+  802e18:	48 89 e5             	mov    %rsp,%rbp
+  802e1b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e1c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e26:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e30:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e35:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e46:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e4c:	c9                   	leave
+  802e4d:	c3                   	ret
+
+0000000000802e4e <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  802e4e:	85 ff                	test   %edi,%edi
+  802e50:	78 58                	js     802eaa <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  802e52:	48 85 f6             	test   %rsi,%rsi
+  802e55:	74 12                	je     802e69 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  802e57:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e5e:	00 00 00 
+  802e61:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  802e67:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  802e69:	48 85 c9             	test   %rcx,%rcx
+  802e6c:	74 12                	je     802e80 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  802e6e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e75:	00 00 00 
+  802e78:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  802e7e:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  802e80:	48 85 d2             	test   %rdx,%rdx
+  802e83:	74 14                	je     802e99 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  802e85:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e8c:	00 00 00 
+  802e8f:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  802e96:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  802e99:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ea0:	00 00 00 
+  802ea3:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  802ea9:	c3                   	ret
+        if (from_env_store) {
+  802eaa:	48 85 f6             	test   %rsi,%rsi
+  802ead:	74 06                	je     802eb5 <ipc_result+0x67>
+            *from_env_store = 0;
+  802eaf:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  802eb5:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  802eb7:	48 85 c9             	test   %rcx,%rcx
+  802eba:	74 ed                	je     802ea9 <ipc_result+0x5b>
+            *perm_store = 0;
+  802ebc:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  802ec2:	c3                   	ret
+
+0000000000802ec3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ec3:	55                   	push   %rbp
+  802ec4:	48 89 e5             	mov    %rsp,%rbp
+  802ec7:	41 55                	push   %r13
+  802ec9:	41 54                	push   %r12
+  802ecb:	53                   	push   %rbx
+  802ecc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ed0:	49 89 fc             	mov    %rdi,%r12
+  802ed3:	48 89 f7             	mov    %rsi,%rdi
+  802ed6:	48 89 d3             	mov    %rdx,%rbx
+  802ed9:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  802edc:	48 85 f6             	test   %rsi,%rsi
+  802edf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ee6:	00 00 00 
+  802ee9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  802eed:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef2:	48 85 d2             	test   %rdx,%rdx
+  802ef5:	74 03                	je     802efa <ipc_recv+0x37>
+  802ef7:	48 8b 32             	mov    (%rdx),%rsi
+  802efa:	48 b8 3c 2d 80 00 00 	movabs $0x802d3c,%rax
+  802f01:	00 00 00 
+  802f04:	ff d0                	call   *%rax
+  802f06:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  802f08:	4c 89 e9             	mov    %r13,%rcx
+  802f0b:	48 89 da             	mov    %rbx,%rdx
+  802f0e:	4c 89 e6             	mov    %r12,%rsi
+  802f11:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  802f18:	00 00 00 
+  802f1b:	ff d0                	call   *%rax
+}
+  802f1d:	48 83 c4 08          	add    $0x8,%rsp
+  802f21:	5b                   	pop    %rbx
+  802f22:	41 5c                	pop    %r12
+  802f24:	41 5d                	pop    %r13
+  802f26:	5d                   	pop    %rbp
+  802f27:	c3                   	ret
+
+0000000000802f28 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802f28:	55                   	push   %rbp
+  802f29:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  802f2c:	48 85 d2             	test   %rdx,%rdx
+  802f2f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f36:	00 00 00 
+  802f39:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  802f3d:	89 f6                	mov    %esi,%esi
+  802f3f:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  802f46:	00 00 00 
+  802f49:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f4b:	85 c0                	test   %eax,%eax
+  802f4d:	78 02                	js     802f51 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  802f4f:	5d                   	pop    %rbp
+  802f50:	c3                   	ret
+        panic("ipc_send: %i", res);
+  802f51:	89 c1                	mov    %eax,%ecx
+  802f53:	48 ba 75 62 80 00 00 	movabs $0x806275,%rdx
+  802f5a:	00 00 00 
+  802f5d:	be 4f 00 00 00       	mov    $0x4f,%esi
+  802f62:	48 bf 82 62 80 00 00 	movabs $0x806282,%rdi
+  802f69:	00 00 00 
+  802f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f71:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  802f78:	00 00 00 
+  802f7b:	41 ff d0             	call   *%r8
+
+0000000000802f7e <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  802f7e:	55                   	push   %rbp
+  802f7f:	48 89 e5             	mov    %rsp,%rbp
+  802f82:	53                   	push   %rbx
+  802f83:	48 83 ec 08          	sub    $0x8,%rsp
+  802f87:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  802f8b:	48 85 d2             	test   %rdx,%rdx
+  802f8e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f95:	00 00 00 
+  802f98:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  802f9c:	4d 85 c9             	test   %r9,%r9
+  802f9f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  802fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa8:	48 85 db             	test   %rbx,%rbx
+  802fab:	74 03                	je     802fb0 <ipc_call+0x32>
+  802fad:	48 8b 03             	mov    (%rbx),%rax
+  802fb0:	89 f6                	mov    %esi,%esi
+  802fb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fb6:	50                   	push   %rax
+  802fb7:	48 b8 fa 2b 80 00 00 	movabs $0x802bfa,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+  802fc3:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  802fc5:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  802fc9:	48 89 da             	mov    %rbx,%rdx
+  802fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  802fd1:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  802fd8:	00 00 00 
+  802fdb:	ff d0                	call   *%rax
+}
+  802fdd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fe1:	c9                   	leave
+  802fe2:	c3                   	ret
+
+0000000000802fe3 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  802fe3:	55                   	push   %rbp
+  802fe4:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  802fe7:	89 f6                	mov    %esi,%esi
+  802fe9:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  802ff0:	00 00 00 
+  802ff3:	ff d0                	call   *%rax
+  802ff5:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  802ff7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803001:	be 00 00 00 00       	mov    $0x0,%esi
+  803006:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+}
+  803012:	5d                   	pop    %rbp
+  803013:	c3                   	ret
+
+0000000000803014 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  803014:	55                   	push   %rbp
+  803015:	48 89 e5             	mov    %rsp,%rbp
+  803018:	41 54                	push   %r12
+  80301a:	53                   	push   %rbx
+  80301b:	4c 89 cb             	mov    %r9,%rbx
+  80301e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  803022:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803026:	48 85 d2             	test   %rdx,%rdx
+  803029:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803030:	00 00 00 
+  803033:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803037:	4d 85 c9             	test   %r9,%r9
+  80303a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80303e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803043:	4d 85 e4             	test   %r12,%r12
+  803046:	74 04                	je     80304c <ipc_reply_wait+0x38>
+  803048:	49 8b 04 24          	mov    (%r12),%rax
+  80304c:	89 f6                	mov    %esi,%esi
+  80304e:	48 83 ec 08          	sub    $0x8,%rsp
+  803052:	50                   	push   %rax
+  803053:	48 b8 d0 2c 80 00 00 	movabs $0x802cd0,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+  80305f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  803061:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  803065:	4c 89 e2             	mov    %r12,%rdx
+  803068:	48 89 de             	mov    %rbx,%rsi
+  80306b:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  803072:	00 00 00 
+  803075:	ff d0                	call   *%rax
+}
+  803077:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80307b:	5b                   	pop    %rbx
+  80307c:	41 5c                	pop    %r12
+  80307e:	5d                   	pop    %rbp
+  80307f:	c3                   	ret
+
+0000000000803080 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803085:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80308c:	00 00 00 
+  80308f:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  803096:	48 01 ca             	add    %rcx,%rdx
+  803099:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80309f:	39 fa                	cmp    %edi,%edx
+  8030a1:	74 12                	je     8030b5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8030a3:	48 83 c0 01          	add    $0x1,%rax
+  8030a7:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8030ad:	75 e0                	jne    80308f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8030af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b4:	c3                   	ret
+            return envs[i].env_id;
+  8030b5:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8030bc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8030c3:	00 00 00 
+  8030c6:	48 01 d0             	add    %rdx,%rax
+  8030c9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8030cf:	c3                   	ret
+
+00000000008030d0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030d0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8030d7:	ff ff ff 
+  8030da:	48 01 f8             	add    %rdi,%rax
+  8030dd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8030e1:	c3                   	ret
+
+00000000008030e2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030e2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8030e9:	ff ff ff 
+  8030ec:	48 01 f8             	add    %rdi,%rax
+  8030ef:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8030f3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8030f9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8030fd:	c3                   	ret
+
+00000000008030fe <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8030fe:	55                   	push   %rbp
+  8030ff:	48 89 e5             	mov    %rsp,%rbp
+  803102:	41 57                	push   %r15
+  803104:	41 56                	push   %r14
+  803106:	41 55                	push   %r13
+  803108:	41 54                	push   %r12
+  80310a:	53                   	push   %rbx
+  80310b:	48 83 ec 08          	sub    $0x8,%rsp
+  80310f:	49 89 ff             	mov    %rdi,%r15
+  803112:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803117:	49 bd fe 45 80 00 00 	movabs $0x8045fe,%r13
+  80311e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803121:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803127:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80312a:	48 89 df             	mov    %rbx,%rdi
+  80312d:	41 ff d5             	call   *%r13
+  803130:	83 e0 04             	and    $0x4,%eax
+  803133:	74 17                	je     80314c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803135:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80313c:	4c 39 f3             	cmp    %r14,%rbx
+  80313f:	75 e6                	jne    803127 <fd_alloc+0x29>
+  803141:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803147:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80314c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80314f:	48 83 c4 08          	add    $0x8,%rsp
+  803153:	5b                   	pop    %rbx
+  803154:	41 5c                	pop    %r12
+  803156:	41 5d                	pop    %r13
+  803158:	41 5e                	pop    %r14
+  80315a:	41 5f                	pop    %r15
+  80315c:	5d                   	pop    %rbp
+  80315d:	c3                   	ret
+
+000000000080315e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80315e:	83 ff 1f             	cmp    $0x1f,%edi
+  803161:	77 39                	ja     80319c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803163:	55                   	push   %rbp
+  803164:	48 89 e5             	mov    %rsp,%rbp
+  803167:	41 54                	push   %r12
+  803169:	53                   	push   %rbx
+  80316a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80316d:	48 63 df             	movslq %edi,%rbx
+  803170:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803177:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80317b:	48 89 df             	mov    %rbx,%rdi
+  80317e:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  803185:	00 00 00 
+  803188:	ff d0                	call   *%rax
+  80318a:	a8 04                	test   $0x4,%al
+  80318c:	74 14                	je     8031a2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80318e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803197:	5b                   	pop    %rbx
+  803198:	41 5c                	pop    %r12
+  80319a:	5d                   	pop    %rbp
+  80319b:	c3                   	ret
+        return -E_INVAL;
+  80319c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8031a1:	c3                   	ret
+        return -E_INVAL;
+  8031a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a7:	eb ee                	jmp    803197 <fd_lookup+0x39>
+
+00000000008031a9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8031a9:	55                   	push   %rbp
+  8031aa:	48 89 e5             	mov    %rsp,%rbp
+  8031ad:	41 54                	push   %r12
+  8031af:	53                   	push   %rbx
+  8031b0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8031b3:	48 b8 20 63 80 00 00 	movabs $0x806320,%rax
+  8031ba:	00 00 00 
+  8031bd:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8031c4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8031c7:	39 3b                	cmp    %edi,(%rbx)
+  8031c9:	74 47                	je     803212 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8031cb:	48 83 c0 08          	add    $0x8,%rax
+  8031cf:	48 8b 18             	mov    (%rax),%rbx
+  8031d2:	48 85 db             	test   %rbx,%rbx
+  8031d5:	75 f0                	jne    8031c7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8031d7:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031de:	00 00 00 
+  8031e1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031e7:	89 fa                	mov    %edi,%edx
+  8031e9:	48 bf 90 62 80 00 00 	movabs $0x806290,%rdi
+  8031f0:	00 00 00 
+  8031f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f8:	48 b9 54 17 80 00 00 	movabs $0x801754,%rcx
+  8031ff:	00 00 00 
+  803202:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803209:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80320d:	5b                   	pop    %rbx
+  80320e:	41 5c                	pop    %r12
+  803210:	5d                   	pop    %rbp
+  803211:	c3                   	ret
+            return 0;
+  803212:	b8 00 00 00 00       	mov    $0x0,%eax
+  803217:	eb f0                	jmp    803209 <dev_lookup+0x60>
+
+0000000000803219 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803219:	55                   	push   %rbp
+  80321a:	48 89 e5             	mov    %rsp,%rbp
+  80321d:	41 55                	push   %r13
+  80321f:	41 54                	push   %r12
+  803221:	53                   	push   %rbx
+  803222:	48 83 ec 18          	sub    $0x18,%rsp
+  803226:	48 89 fb             	mov    %rdi,%rbx
+  803229:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80322c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803233:	ff ff ff 
+  803236:	48 01 df             	add    %rbx,%rdi
+  803239:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80323d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803241:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803248:	00 00 00 
+  80324b:	ff d0                	call   *%rax
+  80324d:	41 89 c5             	mov    %eax,%r13d
+  803250:	85 c0                	test   %eax,%eax
+  803252:	78 06                	js     80325a <fd_close+0x41>
+  803254:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803258:	74 1a                	je     803274 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80325a:	45 84 e4             	test   %r12b,%r12b
+  80325d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803262:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803266:	44 89 e8             	mov    %r13d,%eax
+  803269:	48 83 c4 18          	add    $0x18,%rsp
+  80326d:	5b                   	pop    %rbx
+  80326e:	41 5c                	pop    %r12
+  803270:	41 5d                	pop    %r13
+  803272:	5d                   	pop    %rbp
+  803273:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803274:	8b 3b                	mov    (%rbx),%edi
+  803276:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80327a:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  803281:	00 00 00 
+  803284:	ff d0                	call   *%rax
+  803286:	41 89 c5             	mov    %eax,%r13d
+  803289:	85 c0                	test   %eax,%eax
+  80328b:	78 1b                	js     8032a8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80328d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803291:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803295:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80329b:	48 85 c0             	test   %rax,%rax
+  80329e:	74 08                	je     8032a8 <fd_close+0x8f>
+  8032a0:	48 89 df             	mov    %rbx,%rdi
+  8032a3:	ff d0                	call   *%rax
+  8032a5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8032a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032ad:	48 89 de             	mov    %rbx,%rsi
+  8032b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b5:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  8032bc:	00 00 00 
+  8032bf:	ff d0                	call   *%rax
+    return res;
+  8032c1:	eb a3                	jmp    803266 <fd_close+0x4d>
+
+00000000008032c3 <close>:
+
+int
+close(int fdnum) {
+  8032c3:	55                   	push   %rbp
+  8032c4:	48 89 e5             	mov    %rsp,%rbp
+  8032c7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032cb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032cf:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  8032d6:	00 00 00 
+  8032d9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032db:	85 c0                	test   %eax,%eax
+  8032dd:	78 15                	js     8032f4 <close+0x31>
+
+    return fd_close(fd, 1);
+  8032df:	be 01 00 00 00       	mov    $0x1,%esi
+  8032e4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032e8:	48 b8 19 32 80 00 00 	movabs $0x803219,%rax
+  8032ef:	00 00 00 
+  8032f2:	ff d0                	call   *%rax
+}
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+00000000008032f6 <close_all>:
+
+void
+close_all(void) {
+  8032f6:	55                   	push   %rbp
+  8032f7:	48 89 e5             	mov    %rsp,%rbp
+  8032fa:	41 54                	push   %r12
+  8032fc:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8032fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803302:	49 bc c3 32 80 00 00 	movabs $0x8032c3,%r12
+  803309:	00 00 00 
+  80330c:	89 df                	mov    %ebx,%edi
+  80330e:	41 ff d4             	call   *%r12
+  803311:	83 c3 01             	add    $0x1,%ebx
+  803314:	83 fb 20             	cmp    $0x20,%ebx
+  803317:	75 f3                	jne    80330c <close_all+0x16>
+}
+  803319:	5b                   	pop    %rbx
+  80331a:	41 5c                	pop    %r12
+  80331c:	5d                   	pop    %rbp
+  80331d:	c3                   	ret
+
+000000000080331e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80331e:	55                   	push   %rbp
+  80331f:	48 89 e5             	mov    %rsp,%rbp
+  803322:	41 57                	push   %r15
+  803324:	41 56                	push   %r14
+  803326:	41 55                	push   %r13
+  803328:	41 54                	push   %r12
+  80332a:	53                   	push   %rbx
+  80332b:	48 83 ec 18          	sub    $0x18,%rsp
+  80332f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803332:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803336:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  80333d:	00 00 00 
+  803340:	ff d0                	call   *%rax
+  803342:	89 c3                	mov    %eax,%ebx
+  803344:	85 c0                	test   %eax,%eax
+  803346:	0f 88 b8 00 00 00    	js     803404 <dup+0xe6>
+    close(newfdnum);
+  80334c:	44 89 e7             	mov    %r12d,%edi
+  80334f:	48 b8 c3 32 80 00 00 	movabs $0x8032c3,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80335b:	4d 63 ec             	movslq %r12d,%r13
+  80335e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803365:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803369:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80336d:	4c 89 ff             	mov    %r15,%rdi
+  803370:	49 be e2 30 80 00 00 	movabs $0x8030e2,%r14
+  803377:	00 00 00 
+  80337a:	41 ff d6             	call   *%r14
+  80337d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803380:	4c 89 ef             	mov    %r13,%rdi
+  803383:	41 ff d6             	call   *%r14
+  803386:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803389:	48 89 df             	mov    %rbx,%rdi
+  80338c:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  803393:	00 00 00 
+  803396:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803398:	a8 04                	test   $0x4,%al
+  80339a:	74 2b                	je     8033c7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80339c:	41 89 c1             	mov    %eax,%r9d
+  80339f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033a5:	4c 89 f1             	mov    %r14,%rcx
+  8033a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ad:	48 89 de             	mov    %rbx,%rsi
+  8033b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b5:	48 b8 5d 28 80 00 00 	movabs $0x80285d,%rax
+  8033bc:	00 00 00 
+  8033bf:	ff d0                	call   *%rax
+  8033c1:	89 c3                	mov    %eax,%ebx
+  8033c3:	85 c0                	test   %eax,%eax
+  8033c5:	78 4e                	js     803415 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8033c7:	4c 89 ff             	mov    %r15,%rdi
+  8033ca:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  8033d1:	00 00 00 
+  8033d4:	ff d0                	call   *%rax
+  8033d6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8033d9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033df:	4c 89 e9             	mov    %r13,%rcx
+  8033e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e7:	4c 89 fe             	mov    %r15,%rsi
+  8033ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ef:	48 b8 5d 28 80 00 00 	movabs $0x80285d,%rax
+  8033f6:	00 00 00 
+  8033f9:	ff d0                	call   *%rax
+  8033fb:	89 c3                	mov    %eax,%ebx
+  8033fd:	85 c0                	test   %eax,%eax
+  8033ff:	78 14                	js     803415 <dup+0xf7>
+
+    return newfdnum;
+  803401:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803404:	89 d8                	mov    %ebx,%eax
+  803406:	48 83 c4 18          	add    $0x18,%rsp
+  80340a:	5b                   	pop    %rbx
+  80340b:	41 5c                	pop    %r12
+  80340d:	41 5d                	pop    %r13
+  80340f:	41 5e                	pop    %r14
+  803411:	41 5f                	pop    %r15
+  803413:	5d                   	pop    %rbp
+  803414:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803415:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80341a:	4c 89 ee             	mov    %r13,%rsi
+  80341d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803422:	49 bc c8 28 80 00 00 	movabs $0x8028c8,%r12
+  803429:	00 00 00 
+  80342c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80342f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803434:	4c 89 f6             	mov    %r14,%rsi
+  803437:	bf 00 00 00 00       	mov    $0x0,%edi
+  80343c:	41 ff d4             	call   *%r12
+    return res;
+  80343f:	eb c3                	jmp    803404 <dup+0xe6>
+
+0000000000803441 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803441:	55                   	push   %rbp
+  803442:	48 89 e5             	mov    %rsp,%rbp
+  803445:	41 56                	push   %r14
+  803447:	41 55                	push   %r13
+  803449:	41 54                	push   %r12
+  80344b:	53                   	push   %rbx
+  80344c:	48 83 ec 10          	sub    $0x10,%rsp
+  803450:	89 fb                	mov    %edi,%ebx
+  803452:	49 89 f4             	mov    %rsi,%r12
+  803455:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803458:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80345c:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803463:	00 00 00 
+  803466:	ff d0                	call   *%rax
+  803468:	85 c0                	test   %eax,%eax
+  80346a:	78 4c                	js     8034b8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80346c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803470:	41 8b 3e             	mov    (%r14),%edi
+  803473:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803477:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	85 c0                	test   %eax,%eax
+  803485:	78 35                	js     8034bc <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803487:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80348b:	83 e0 03             	and    $0x3,%eax
+  80348e:	83 f8 01             	cmp    $0x1,%eax
+  803491:	74 2d                	je     8034c0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803493:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803497:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80349b:	48 85 c0             	test   %rax,%rax
+  80349e:	74 56                	je     8034f6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8034a0:	4c 89 ea             	mov    %r13,%rdx
+  8034a3:	4c 89 e6             	mov    %r12,%rsi
+  8034a6:	4c 89 f7             	mov    %r14,%rdi
+  8034a9:	ff d0                	call   *%rax
+}
+  8034ab:	48 83 c4 10          	add    $0x10,%rsp
+  8034af:	5b                   	pop    %rbx
+  8034b0:	41 5c                	pop    %r12
+  8034b2:	41 5d                	pop    %r13
+  8034b4:	41 5e                	pop    %r14
+  8034b6:	5d                   	pop    %rbp
+  8034b7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034b8:	48 98                	cltq
+  8034ba:	eb ef                	jmp    8034ab <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034bc:	48 98                	cltq
+  8034be:	eb eb                	jmp    8034ab <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034c0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034c7:	00 00 00 
+  8034ca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034d0:	89 da                	mov    %ebx,%edx
+  8034d2:	48 bf d1 62 80 00 00 	movabs $0x8062d1,%rdi
+  8034d9:	00 00 00 
+  8034dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e1:	48 b9 54 17 80 00 00 	movabs $0x801754,%rcx
+  8034e8:	00 00 00 
+  8034eb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8034ed:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034f4:	eb b5                	jmp    8034ab <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8034f6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034fd:	eb ac                	jmp    8034ab <read+0x6a>
+
+00000000008034ff <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8034ff:	55                   	push   %rbp
+  803500:	48 89 e5             	mov    %rsp,%rbp
+  803503:	41 57                	push   %r15
+  803505:	41 56                	push   %r14
+  803507:	41 55                	push   %r13
+  803509:	41 54                	push   %r12
+  80350b:	53                   	push   %rbx
+  80350c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803510:	48 85 d2             	test   %rdx,%rdx
+  803513:	74 54                	je     803569 <readn+0x6a>
+  803515:	41 89 fd             	mov    %edi,%r13d
+  803518:	49 89 f6             	mov    %rsi,%r14
+  80351b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80351e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803523:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803528:	49 bf 41 34 80 00 00 	movabs $0x803441,%r15
+  80352f:	00 00 00 
+  803532:	4c 89 e2             	mov    %r12,%rdx
+  803535:	48 29 f2             	sub    %rsi,%rdx
+  803538:	4c 01 f6             	add    %r14,%rsi
+  80353b:	44 89 ef             	mov    %r13d,%edi
+  80353e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803541:	85 c0                	test   %eax,%eax
+  803543:	78 20                	js     803565 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803545:	01 c3                	add    %eax,%ebx
+  803547:	85 c0                	test   %eax,%eax
+  803549:	74 08                	je     803553 <readn+0x54>
+  80354b:	48 63 f3             	movslq %ebx,%rsi
+  80354e:	4c 39 e6             	cmp    %r12,%rsi
+  803551:	72 df                	jb     803532 <readn+0x33>
+    }
+    return res;
+  803553:	48 63 c3             	movslq %ebx,%rax
+}
+  803556:	48 83 c4 08          	add    $0x8,%rsp
+  80355a:	5b                   	pop    %rbx
+  80355b:	41 5c                	pop    %r12
+  80355d:	41 5d                	pop    %r13
+  80355f:	41 5e                	pop    %r14
+  803561:	41 5f                	pop    %r15
+  803563:	5d                   	pop    %rbp
+  803564:	c3                   	ret
+        if (inc < 0) return inc;
+  803565:	48 98                	cltq
+  803567:	eb ed                	jmp    803556 <readn+0x57>
+    int inc = 1, res = 0;
+  803569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80356e:	eb e3                	jmp    803553 <readn+0x54>
+
+0000000000803570 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803570:	55                   	push   %rbp
+  803571:	48 89 e5             	mov    %rsp,%rbp
+  803574:	41 56                	push   %r14
+  803576:	41 55                	push   %r13
+  803578:	41 54                	push   %r12
+  80357a:	53                   	push   %rbx
+  80357b:	48 83 ec 10          	sub    $0x10,%rsp
+  80357f:	89 fb                	mov    %edi,%ebx
+  803581:	49 89 f4             	mov    %rsi,%r12
+  803584:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803587:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80358b:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803592:	00 00 00 
+  803595:	ff d0                	call   *%rax
+  803597:	85 c0                	test   %eax,%eax
+  803599:	78 47                	js     8035e2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80359b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80359f:	41 8b 3e             	mov    (%r14),%edi
+  8035a2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035a6:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  8035ad:	00 00 00 
+  8035b0:	ff d0                	call   *%rax
+  8035b2:	85 c0                	test   %eax,%eax
+  8035b4:	78 30                	js     8035e6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035b6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8035bb:	74 2d                	je     8035ea <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8035bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035c1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035c5:	48 85 c0             	test   %rax,%rax
+  8035c8:	74 56                	je     803620 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8035ca:	4c 89 ea             	mov    %r13,%rdx
+  8035cd:	4c 89 e6             	mov    %r12,%rsi
+  8035d0:	4c 89 f7             	mov    %r14,%rdi
+  8035d3:	ff d0                	call   *%rax
+}
+  8035d5:	48 83 c4 10          	add    $0x10,%rsp
+  8035d9:	5b                   	pop    %rbx
+  8035da:	41 5c                	pop    %r12
+  8035dc:	41 5d                	pop    %r13
+  8035de:	41 5e                	pop    %r14
+  8035e0:	5d                   	pop    %rbp
+  8035e1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035e2:	48 98                	cltq
+  8035e4:	eb ef                	jmp    8035d5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035e6:	48 98                	cltq
+  8035e8:	eb eb                	jmp    8035d5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8035ea:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8035f1:	00 00 00 
+  8035f4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8035fa:	89 da                	mov    %ebx,%edx
+  8035fc:	48 bf ed 62 80 00 00 	movabs $0x8062ed,%rdi
+  803603:	00 00 00 
+  803606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360b:	48 b9 54 17 80 00 00 	movabs $0x801754,%rcx
+  803612:	00 00 00 
+  803615:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803617:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80361e:	eb b5                	jmp    8035d5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803620:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803627:	eb ac                	jmp    8035d5 <write+0x65>
+
+0000000000803629 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803629:	55                   	push   %rbp
+  80362a:	48 89 e5             	mov    %rsp,%rbp
+  80362d:	53                   	push   %rbx
+  80362e:	48 83 ec 18          	sub    $0x18,%rsp
+  803632:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803634:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803638:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+  803644:	85 c0                	test   %eax,%eax
+  803646:	78 0c                	js     803654 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80364c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80364f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803654:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803658:	c9                   	leave
+  803659:	c3                   	ret
+
+000000000080365a <tell>:
+
+int tell(int fdnum) {
+  80365a:	55                   	push   %rbp
+  80365b:	48 89 e5             	mov    %rsp,%rbp
+  80365e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803662:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803666:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  80366d:	00 00 00 
+  803670:	ff d0                	call   *%rax
+  803672:	85 c0                	test   %eax,%eax
+  803674:	78 07                	js     80367d <tell+0x23>
+
+    return fd->fd_offset;
+  803676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80367a:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80367d:	c9                   	leave
+  80367e:	c3                   	ret
+
+000000000080367f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80367f:	55                   	push   %rbp
+  803680:	48 89 e5             	mov    %rsp,%rbp
+  803683:	41 55                	push   %r13
+  803685:	41 54                	push   %r12
+  803687:	53                   	push   %rbx
+  803688:	48 83 ec 18          	sub    $0x18,%rsp
+  80368c:	89 fb                	mov    %edi,%ebx
+  80368e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803691:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803695:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  80369c:	00 00 00 
+  80369f:	ff d0                	call   *%rax
+  8036a1:	85 c0                	test   %eax,%eax
+  8036a3:	78 38                	js     8036dd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036a5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8036a9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8036ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036b1:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  8036b8:	00 00 00 
+  8036bb:	ff d0                	call   *%rax
+  8036bd:	85 c0                	test   %eax,%eax
+  8036bf:	78 1c                	js     8036dd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036c1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8036c6:	74 20                	je     8036e8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8036c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036cc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8036d0:	48 85 c0             	test   %rax,%rax
+  8036d3:	74 47                	je     80371c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8036d5:	44 89 e6             	mov    %r12d,%esi
+  8036d8:	4c 89 ef             	mov    %r13,%rdi
+  8036db:	ff d0                	call   *%rax
+}
+  8036dd:	48 83 c4 18          	add    $0x18,%rsp
+  8036e1:	5b                   	pop    %rbx
+  8036e2:	41 5c                	pop    %r12
+  8036e4:	41 5d                	pop    %r13
+  8036e6:	5d                   	pop    %rbp
+  8036e7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8036e8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8036ef:	00 00 00 
+  8036f2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8036f8:	89 da                	mov    %ebx,%edx
+  8036fa:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  803701:	00 00 00 
+  803704:	b8 00 00 00 00       	mov    $0x0,%eax
+  803709:	48 b9 54 17 80 00 00 	movabs $0x801754,%rcx
+  803710:	00 00 00 
+  803713:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803715:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80371a:	eb c1                	jmp    8036dd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80371c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803721:	eb ba                	jmp    8036dd <ftruncate+0x5e>
+
+0000000000803723 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803723:	55                   	push   %rbp
+  803724:	48 89 e5             	mov    %rsp,%rbp
+  803727:	41 54                	push   %r12
+  803729:	53                   	push   %rbx
+  80372a:	48 83 ec 10          	sub    $0x10,%rsp
+  80372e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803731:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803735:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  80373c:	00 00 00 
+  80373f:	ff d0                	call   *%rax
+  803741:	85 c0                	test   %eax,%eax
+  803743:	78 63                	js     8037a8 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803745:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803749:	41 8b 3c 24          	mov    (%r12),%edi
+  80374d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803751:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+  80375d:	85 c0                	test   %eax,%eax
+  80375f:	78 47                	js     8037a8 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803761:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803765:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80376a:	74 45                	je     8037b1 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80376c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80376f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803776:	00 00 00 
+    stat->st_isdir = 0;
+  803779:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803780:	00 00 00 
+    stat->st_ino = 0;
+  803783:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80378a:	00 00 00 00 
+    stat->st_version = 0;
+  80378e:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803795:	00 00 00 
+    stat->st_dev = dev;
+  803798:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80379f:	48 89 de             	mov    %rbx,%rsi
+  8037a2:	4c 89 e7             	mov    %r12,%rdi
+  8037a5:	ff 50 28             	call   *0x28(%rax)
+}
+  8037a8:	48 83 c4 10          	add    $0x10,%rsp
+  8037ac:	5b                   	pop    %rbx
+  8037ad:	41 5c                	pop    %r12
+  8037af:	5d                   	pop    %rbp
+  8037b0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8037b1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037b6:	eb f0                	jmp    8037a8 <fstat+0x85>
+
+00000000008037b8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8037b8:	55                   	push   %rbp
+  8037b9:	48 89 e5             	mov    %rsp,%rbp
+  8037bc:	41 54                	push   %r12
+  8037be:	53                   	push   %rbx
+  8037bf:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8037c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8037c7:	48 b8 d9 3c 80 00 00 	movabs $0x803cd9,%rax
+  8037ce:	00 00 00 
+  8037d1:	ff d0                	call   *%rax
+  8037d3:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8037d5:	85 c0                	test   %eax,%eax
+  8037d7:	78 25                	js     8037fe <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8037d9:	4c 89 e6             	mov    %r12,%rsi
+  8037dc:	89 c7                	mov    %eax,%edi
+  8037de:	48 b8 23 37 80 00 00 	movabs $0x803723,%rax
+  8037e5:	00 00 00 
+  8037e8:	ff d0                	call   *%rax
+  8037ea:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8037ed:	89 df                	mov    %ebx,%edi
+  8037ef:	48 b8 c3 32 80 00 00 	movabs $0x8032c3,%rax
+  8037f6:	00 00 00 
+  8037f9:	ff d0                	call   *%rax
+
+    return res;
+  8037fb:	44 89 e3             	mov    %r12d,%ebx
+}
+  8037fe:	89 d8                	mov    %ebx,%eax
+  803800:	5b                   	pop    %rbx
+  803801:	41 5c                	pop    %r12
+  803803:	5d                   	pop    %rbp
+  803804:	c3                   	ret
+
+0000000000803805 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803805:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80380c:	00 00 00 
+  80380f:	83 38 00             	cmpl   $0x0,(%rax)
+  803812:	74 0a                	je     80381e <fsipc_env+0x19>
+    return fsenv;
+}
+  803814:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80381b:	00 00 
+  80381d:	c3                   	ret
+fsipc_env(void) {
+  80381e:	55                   	push   %rbp
+  80381f:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803822:	bf 03 00 00 00       	mov    $0x3,%edi
+  803827:	48 b8 80 30 80 00 00 	movabs $0x803080,%rax
+  80382e:	00 00 00 
+  803831:	ff d0                	call   *%rax
+  803833:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80383a:	00 00 
+}
+  80383c:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803843:	00 00 
+  803845:	5d                   	pop    %rbp
+  803846:	c3                   	ret
+
+0000000000803847 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803847:	55                   	push   %rbp
+  803848:	48 89 e5             	mov    %rsp,%rbp
+  80384b:	53                   	push   %rbx
+  80384c:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803850:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803857:	00 
+  803858:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80385f:	00 
+  803860:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803867:	00 
+  803868:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80386f:	00 
+  803870:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803877:	00 
+
+    assert(size <= sizeof(words));
+  803878:	48 83 fa 28          	cmp    $0x28,%rdx
+  80387c:	77 38                	ja     8038b6 <fsipc_short+0x6f>
+  80387e:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803880:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803884:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  80388b:	00 00 00 
+  80388e:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803890:	48 b8 05 38 80 00 00 	movabs $0x803805,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	89 c7                	mov    %eax,%edi
+  80389e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8038a2:	89 de                	mov    %ebx,%esi
+  8038a4:	48 b8 e3 2f 80 00 00 	movabs $0x802fe3,%rax
+  8038ab:	00 00 00 
+  8038ae:	ff d0                	call   *%rax
+}
+  8038b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038b4:	c9                   	leave
+  8038b5:	c3                   	ret
+    assert(size <= sizeof(words));
+  8038b6:	48 b9 40 63 80 00 00 	movabs $0x806340,%rcx
+  8038bd:	00 00 00 
+  8038c0:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  8038c7:	00 00 00 
+  8038ca:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8038cf:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  8038d6:	00 00 00 
+  8038d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038de:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  8038e5:	00 00 00 
+  8038e8:	41 ff d0             	call   *%r8
+
+00000000008038eb <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8038eb:	55                   	push   %rbp
+  8038ec:	48 89 e5             	mov    %rsp,%rbp
+  8038ef:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8038f3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8038f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8038f9:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8038fc:	ba 08 00 00 00       	mov    $0x8,%edx
+  803901:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803905:	bf 02 00 00 00       	mov    $0x2,%edi
+  80390a:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803911:	00 00 00 
+  803914:	ff d0                	call   *%rax
+}
+  803916:	c9                   	leave
+  803917:	c3                   	ret
+
+0000000000803918 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803918:	55                   	push   %rbp
+  803919:	48 89 e5             	mov    %rsp,%rbp
+  80391c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803920:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803923:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803926:	ba 04 00 00 00       	mov    $0x4,%edx
+  80392b:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80392f:	bf 06 00 00 00       	mov    $0x6,%edi
+  803934:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  80393b:	00 00 00 
+  80393e:	ff d0                	call   *%rax
+}
+  803940:	c9                   	leave
+  803941:	c3                   	ret
+
+0000000000803942 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803942:	55                   	push   %rbp
+  803943:	48 89 e5             	mov    %rsp,%rbp
+  803946:	41 54                	push   %r12
+  803948:	53                   	push   %rbx
+  803949:	48 83 ec 10          	sub    $0x10,%rsp
+  80394d:	89 fb                	mov    %edi,%ebx
+  80394f:	49 89 f4             	mov    %rsi,%r12
+  803952:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803956:	48 b8 05 38 80 00 00 	movabs $0x803805,%rax
+  80395d:	00 00 00 
+  803960:	ff d0                	call   *%rax
+  803962:	89 c7                	mov    %eax,%edi
+  803964:	6a 00                	push   $0x0
+  803966:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80396a:	50                   	push   %rax
+  80396b:	4d 89 e1             	mov    %r12,%r9
+  80396e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803974:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803979:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803980:	00 00 00 
+  803983:	89 de                	mov    %ebx,%esi
+  803985:	48 b8 7e 2f 80 00 00 	movabs $0x802f7e,%rax
+  80398c:	00 00 00 
+  80398f:	ff d0                	call   *%rax
+}
+  803991:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803995:	5b                   	pop    %rbx
+  803996:	41 5c                	pop    %r12
+  803998:	5d                   	pop    %rbp
+  803999:	c3                   	ret
+
+000000000080399a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80399a:	55                   	push   %rbp
+  80399b:	48 89 e5             	mov    %rsp,%rbp
+  80399e:	41 54                	push   %r12
+  8039a0:	53                   	push   %rbx
+  8039a1:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039a4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8039a7:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  8039ae:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ba:	bf 05 00 00 00       	mov    $0x5,%edi
+  8039bf:	48 b8 42 39 80 00 00 	movabs $0x803942,%rax
+  8039c6:	00 00 00 
+  8039c9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039cb:	85 c0                	test   %eax,%eax
+  8039cd:	78 5a                	js     803a29 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039cf:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8039d6:	00 00 00 
+  8039d9:	4c 89 e6             	mov    %r12,%rsi
+  8039dc:	48 89 df             	mov    %rbx,%rdi
+  8039df:	48 b8 8b 20 80 00 00 	movabs $0x80208b,%rax
+  8039e6:	00 00 00 
+  8039e9:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8039eb:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8039f2:	00 
+  8039f3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039f9:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803a00:	00 
+  803a01:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803a07:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803a0e:	00 
+  803a0f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803a16:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803a1d:	00 
+  803a1e:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803a24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a29:	5b                   	pop    %rbx
+  803a2a:	41 5c                	pop    %r12
+  803a2c:	5d                   	pop    %rbp
+  803a2d:	c3                   	ret
+
+0000000000803a2e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a2e:	55                   	push   %rbp
+  803a2f:	48 89 e5             	mov    %rsp,%rbp
+  803a32:	41 57                	push   %r15
+  803a34:	41 56                	push   %r14
+  803a36:	41 55                	push   %r13
+  803a38:	41 54                	push   %r12
+  803a3a:	53                   	push   %rbx
+  803a3b:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803a3f:	48 85 ff             	test   %rdi,%rdi
+  803a42:	0f 84 a1 00 00 00    	je     803ae9 <devfile_read+0xbb>
+  803a48:	49 89 ff             	mov    %rdi,%r15
+  803a4b:	49 89 f5             	mov    %rsi,%r13
+  803a4e:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803a51:	48 85 f6             	test   %rsi,%rsi
+  803a54:	0f 84 c4 00 00 00    	je     803b1e <devfile_read+0xf0>
+    size_t total_read = 0;
+  803a5a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a61:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a62:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803a69:	00 00 00 
+  803a6c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803a70:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803a73:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a77:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a7c:	be 00 00 00 00       	mov    $0x0,%esi
+  803a81:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a86:	48 b8 42 39 80 00 00 	movabs $0x803942,%rax
+  803a8d:	00 00 00 
+  803a90:	ff d0                	call   *%rax
+        if (res < 0) {
+  803a92:	85 c0                	test   %eax,%eax
+  803a94:	0f 88 b9 00 00 00    	js     803b53 <devfile_read+0x125>
+        assert(res <= n);
+  803a9a:	48 63 d8             	movslq %eax,%rbx
+  803a9d:	49 39 dc             	cmp    %rbx,%r12
+  803aa0:	0f 82 b1 00 00 00    	jb     803b57 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803aa6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803aab:	0f 87 db 00 00 00    	ja     803b8c <devfile_read+0x15e>
+        if (!res) {
+  803ab1:	85 c0                	test   %eax,%eax
+  803ab3:	74 21                	je     803ad6 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803ab5:	48 89 da             	mov    %rbx,%rdx
+  803ab8:	4c 89 f6             	mov    %r14,%rsi
+  803abb:	4c 89 ef             	mov    %r13,%rdi
+  803abe:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  803ac5:	00 00 00 
+  803ac8:	ff d0                	call   *%rax
+        total_read += res;
+  803aca:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803ace:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803ad1:	49 29 dc             	sub    %rbx,%r12
+  803ad4:	75 96                	jne    803a6c <devfile_read+0x3e>
+    return total_read;
+  803ad6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803ada:	48 83 c4 18          	add    $0x18,%rsp
+  803ade:	5b                   	pop    %rbx
+  803adf:	41 5c                	pop    %r12
+  803ae1:	41 5d                	pop    %r13
+  803ae3:	41 5e                	pop    %r14
+  803ae5:	41 5f                	pop    %r15
+  803ae7:	5d                   	pop    %rbp
+  803ae8:	c3                   	ret
+    assert(fd);
+  803ae9:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  803af0:	00 00 00 
+  803af3:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803afa:	00 00 00 
+  803afd:	be 91 00 00 00       	mov    $0x91,%esi
+  803b02:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803b09:	00 00 00 
+  803b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b11:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  803b18:	00 00 00 
+  803b1b:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b1e:	48 b9 79 63 80 00 00 	movabs $0x806379,%rcx
+  803b25:	00 00 00 
+  803b28:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803b2f:	00 00 00 
+  803b32:	be 92 00 00 00       	mov    $0x92,%esi
+  803b37:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803b3e:	00 00 00 
+  803b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b46:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  803b4d:	00 00 00 
+  803b50:	41 ff d0             	call   *%r8
+            return res;
+  803b53:	48 98                	cltq
+  803b55:	eb 83                	jmp    803ada <devfile_read+0xac>
+        assert(res <= n);
+  803b57:	48 b9 7d 63 80 00 00 	movabs $0x80637d,%rcx
+  803b5e:	00 00 00 
+  803b61:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803b68:	00 00 00 
+  803b6b:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803b70:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803b77:	00 00 00 
+  803b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7f:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  803b86:	00 00 00 
+  803b89:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803b8c:	48 b9 88 63 80 00 00 	movabs $0x806388,%rcx
+  803b93:	00 00 00 
+  803b96:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803b9d:	00 00 00 
+  803ba0:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803ba5:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803bac:	00 00 00 
+  803baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb4:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  803bbb:	00 00 00 
+  803bbe:	41 ff d0             	call   *%r8
+
+0000000000803bc1 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803bc1:	55                   	push   %rbp
+  803bc2:	48 89 e5             	mov    %rsp,%rbp
+  803bc5:	41 57                	push   %r15
+  803bc7:	41 56                	push   %r14
+  803bc9:	41 55                	push   %r13
+  803bcb:	41 54                	push   %r12
+  803bcd:	53                   	push   %rbx
+  803bce:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803bd2:	48 85 ff             	test   %rdi,%rdi
+  803bd5:	0f 84 83 00 00 00    	je     803c5e <devfile_write+0x9d>
+  803bdb:	49 89 ff             	mov    %rdi,%r15
+  803bde:	49 89 f4             	mov    %rsi,%r12
+  803be1:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803be4:	48 85 f6             	test   %rsi,%rsi
+  803be7:	0f 84 a6 00 00 00    	je     803c93 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803bed:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803bf3:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803bfa:	00 00 00 
+  803bfd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c01:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803c04:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803c08:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803c0d:	48 39 d3             	cmp    %rdx,%rbx
+  803c10:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803c14:	4c 89 e6             	mov    %r12,%rsi
+  803c17:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803c1e:	00 00 00 
+  803c21:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  803c28:	00 00 00 
+  803c2b:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c2d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c32:	be 00 00 00 00       	mov    $0x0,%esi
+  803c37:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c3c:	48 b8 42 39 80 00 00 	movabs $0x803942,%rax
+  803c43:	00 00 00 
+  803c46:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c48:	85 c0                	test   %eax,%eax
+  803c4a:	78 7c                	js     803cc8 <devfile_write+0x107>
+        total_written += res;
+  803c4c:	48 98                	cltq
+  803c4e:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803c51:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803c54:	48 29 c3             	sub    %rax,%rbx
+  803c57:	75 a4                	jne    803bfd <devfile_write+0x3c>
+    return total_written;
+  803c59:	4c 89 e8             	mov    %r13,%rax
+  803c5c:	eb 6c                	jmp    803cca <devfile_write+0x109>
+    assert(fd);
+  803c5e:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  803c65:	00 00 00 
+  803c68:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803c6f:	00 00 00 
+  803c72:	be bd 00 00 00       	mov    $0xbd,%esi
+  803c77:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803c7e:	00 00 00 
+  803c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c86:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  803c8d:	00 00 00 
+  803c90:	41 ff d0             	call   *%r8
+    assert(buf);
+  803c93:	48 b9 79 63 80 00 00 	movabs $0x806379,%rcx
+  803c9a:	00 00 00 
+  803c9d:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803ca4:	00 00 00 
+  803ca7:	be be 00 00 00       	mov    $0xbe,%esi
+  803cac:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803cb3:	00 00 00 
+  803cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbb:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  803cc2:	00 00 00 
+  803cc5:	41 ff d0             	call   *%r8
+            return res;
+  803cc8:	48 98                	cltq
+}
+  803cca:	48 83 c4 08          	add    $0x8,%rsp
+  803cce:	5b                   	pop    %rbx
+  803ccf:	41 5c                	pop    %r12
+  803cd1:	41 5d                	pop    %r13
+  803cd3:	41 5e                	pop    %r14
+  803cd5:	41 5f                	pop    %r15
+  803cd7:	5d                   	pop    %rbp
+  803cd8:	c3                   	ret
+
+0000000000803cd9 <open>:
+open(const char *path, int mode) {
+  803cd9:	55                   	push   %rbp
+  803cda:	48 89 e5             	mov    %rsp,%rbp
+  803cdd:	41 55                	push   %r13
+  803cdf:	41 54                	push   %r12
+  803ce1:	53                   	push   %rbx
+  803ce2:	48 83 ec 18          	sub    $0x18,%rsp
+  803ce6:	49 89 fc             	mov    %rdi,%r12
+  803ce9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803cec:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  803cf3:	00 00 00 
+  803cf6:	ff d0                	call   *%rax
+  803cf8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803cfe:	0f 87 8f 00 00 00    	ja     803d93 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d04:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d08:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  803d0f:	00 00 00 
+  803d12:	ff d0                	call   *%rax
+  803d14:	89 c3                	mov    %eax,%ebx
+  803d16:	85 c0                	test   %eax,%eax
+  803d18:	78 55                	js     803d6f <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803d1a:	4c 89 e6             	mov    %r12,%rsi
+  803d1d:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803d24:	00 00 00 
+  803d27:	48 89 df             	mov    %rbx,%rdi
+  803d2a:	48 b8 8b 20 80 00 00 	movabs $0x80208b,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803d36:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d3d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d42:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d46:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d4b:	48 b8 42 39 80 00 00 	movabs $0x803942,%rax
+  803d52:	00 00 00 
+  803d55:	ff d0                	call   *%rax
+  803d57:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803d59:	85 c0                	test   %eax,%eax
+  803d5b:	78 1f                	js     803d7c <open+0xa3>
+    return fd2num(fd);
+  803d5d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d61:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  803d68:	00 00 00 
+  803d6b:	ff d0                	call   *%rax
+  803d6d:	89 c3                	mov    %eax,%ebx
+}
+  803d6f:	89 d8                	mov    %ebx,%eax
+  803d71:	48 83 c4 18          	add    $0x18,%rsp
+  803d75:	5b                   	pop    %rbx
+  803d76:	41 5c                	pop    %r12
+  803d78:	41 5d                	pop    %r13
+  803d7a:	5d                   	pop    %rbp
+  803d7b:	c3                   	ret
+        fd_close(fd, 0);
+  803d7c:	be 00 00 00 00       	mov    $0x0,%esi
+  803d81:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d85:	48 b8 19 32 80 00 00 	movabs $0x803219,%rax
+  803d8c:	00 00 00 
+  803d8f:	ff d0                	call   *%rax
+        return res;
+  803d91:	eb dc                	jmp    803d6f <open+0x96>
+        return -E_BAD_PATH;
+  803d93:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803d98:	eb d5                	jmp    803d6f <open+0x96>
+
+0000000000803d9a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803d9a:	55                   	push   %rbp
+  803d9b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803d9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803da3:	be 00 00 00 00       	mov    $0x0,%esi
+  803da8:	bf 08 00 00 00       	mov    $0x8,%edi
+  803dad:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803db4:	00 00 00 
+  803db7:	ff d0                	call   *%rax
+}
+  803db9:	5d                   	pop    %rbp
+  803dba:	c3                   	ret
+
+0000000000803dbb <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803dbb:	55                   	push   %rbp
+  803dbc:	48 89 e5             	mov    %rsp,%rbp
+  803dbf:	41 56                	push   %r14
+  803dc1:	41 55                	push   %r13
+  803dc3:	41 54                	push   %r12
+  803dc5:	53                   	push   %rbx
+  803dc6:	48 83 ec 10          	sub    $0x10,%rsp
+  803dca:	41 89 f6             	mov    %esi,%r14d
+  803dcd:	49 89 d4             	mov    %rdx,%r12
+  803dd0:	48 89 cb             	mov    %rcx,%rbx
+  803dd3:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803dd6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803dda:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803de6:	85 c0                	test   %eax,%eax
+  803de8:	78 46                	js     803e30 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803dea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803dee:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803df5:	00 00 00 
+  803df8:	8b 00                	mov    (%rax),%eax
+  803dfa:	39 02                	cmp    %eax,(%rdx)
+  803dfc:	75 3f                	jne    803e3d <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803dfe:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803e05:	00 00 00 
+  803e08:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803e0b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803e0d:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803e11:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803e15:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803e19:	48 89 da             	mov    %rbx,%rdx
+  803e1c:	4c 89 e6             	mov    %r12,%rsi
+  803e1f:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e24:	48 b8 42 39 80 00 00 	movabs $0x803942,%rax
+  803e2b:	00 00 00 
+  803e2e:	ff d0                	call   *%rax
+}
+  803e30:	48 83 c4 10          	add    $0x10,%rsp
+  803e34:	5b                   	pop    %rbx
+  803e35:	41 5c                	pop    %r12
+  803e37:	41 5d                	pop    %r13
+  803e39:	41 5e                	pop    %r14
+  803e3b:	5d                   	pop    %rbp
+  803e3c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e3d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e42:	eb ec                	jmp    803e30 <file_map+0x75>
+
+0000000000803e44 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803e44:	55                   	push   %rbp
+  803e45:	48 89 e5             	mov    %rsp,%rbp
+  803e48:	41 54                	push   %r12
+  803e4a:	53                   	push   %rbx
+  803e4b:	48 83 ec 20          	sub    $0x20,%rsp
+  803e4f:	41 89 f4             	mov    %esi,%r12d
+  803e52:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803e55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803e59:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803e60:	00 00 00 
+  803e63:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e65:	85 c0                	test   %eax,%eax
+  803e67:	78 3c                	js     803ea5 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e6d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803e74:	00 00 00 
+  803e77:	8b 0a                	mov    (%rdx),%ecx
+  803e79:	39 08                	cmp    %ecx,(%rax)
+  803e7b:	75 31                	jne    803eae <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803e7d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e80:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803e83:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803e87:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803e8b:	ba 10 00 00 00       	mov    $0x10,%edx
+  803e90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803e94:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803e99:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803ea0:	00 00 00 
+  803ea3:	ff d0                	call   *%rax
+}
+  803ea5:	48 83 c4 20          	add    $0x20,%rsp
+  803ea9:	5b                   	pop    %rbx
+  803eaa:	41 5c                	pop    %r12
+  803eac:	5d                   	pop    %rbp
+  803ead:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803eae:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803eb3:	eb f0                	jmp    803ea5 <file_msync+0x61>
+
+0000000000803eb5 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803eb5:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803eb9:	7f 01                	jg     803ebc <writebuf+0x7>
+  803ebb:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803ebc:	55                   	push   %rbp
+  803ebd:	48 89 e5             	mov    %rsp,%rbp
+  803ec0:	53                   	push   %rbx
+  803ec1:	48 83 ec 08          	sub    $0x8,%rsp
+  803ec5:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803ec8:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803ecc:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803ed0:	8b 3f                	mov    (%rdi),%edi
+  803ed2:	48 b8 70 35 80 00 00 	movabs $0x803570,%rax
+  803ed9:	00 00 00 
+  803edc:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803ede:	48 85 c0             	test   %rax,%rax
+  803ee1:	7e 04                	jle    803ee7 <writebuf+0x32>
+  803ee3:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803ee7:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803eeb:	48 39 c2             	cmp    %rax,%rdx
+  803eee:	74 0f                	je     803eff <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803ef0:	48 85 c0             	test   %rax,%rax
+  803ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ef8:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803efc:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803eff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f03:	c9                   	leave
+  803f04:	c3                   	ret
+
+0000000000803f05 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803f05:	8b 46 04             	mov    0x4(%rsi),%eax
+  803f08:	8d 50 01             	lea    0x1(%rax),%edx
+  803f0b:	89 56 04             	mov    %edx,0x4(%rsi)
+  803f0e:	48 98                	cltq
+  803f10:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803f15:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803f1b:	74 01                	je     803f1e <putch+0x19>
+  803f1d:	c3                   	ret
+putch(int ch, void *arg) {
+  803f1e:	55                   	push   %rbp
+  803f1f:	48 89 e5             	mov    %rsp,%rbp
+  803f22:	53                   	push   %rbx
+  803f23:	48 83 ec 08          	sub    $0x8,%rsp
+  803f27:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803f2a:	48 89 f7             	mov    %rsi,%rdi
+  803f2d:	48 b8 b5 3e 80 00 00 	movabs $0x803eb5,%rax
+  803f34:	00 00 00 
+  803f37:	ff d0                	call   *%rax
+        state->offset = 0;
+  803f39:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803f40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f44:	c9                   	leave
+  803f45:	c3                   	ret
+
+0000000000803f46 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803f46:	55                   	push   %rbp
+  803f47:	48 89 e5             	mov    %rsp,%rbp
+  803f4a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803f51:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803f54:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803f5a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803f61:	00 00 00 
+    state.result = 0;
+  803f64:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803f6b:	00 00 00 00 
+    state.error = 1;
+  803f6f:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803f76:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803f79:	48 89 f2             	mov    %rsi,%rdx
+  803f7c:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803f83:	48 bf 05 3f 80 00 00 	movabs $0x803f05,%rdi
+  803f8a:	00 00 00 
+  803f8d:	48 b8 a4 18 80 00 00 	movabs $0x8018a4,%rax
+  803f94:	00 00 00 
+  803f97:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803f99:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803fa0:	7f 14                	jg     803fb6 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803fa2:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803fa9:	48 85 c0             	test   %rax,%rax
+  803fac:	75 06                	jne    803fb4 <vfprintf+0x6e>
+  803fae:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803fb4:	c9                   	leave
+  803fb5:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803fb6:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803fbd:	48 b8 b5 3e 80 00 00 	movabs $0x803eb5,%rax
+  803fc4:	00 00 00 
+  803fc7:	ff d0                	call   *%rax
+  803fc9:	eb d7                	jmp    803fa2 <vfprintf+0x5c>
+
+0000000000803fcb <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803fcb:	55                   	push   %rbp
+  803fcc:	48 89 e5             	mov    %rsp,%rbp
+  803fcf:	48 83 ec 50          	sub    $0x50,%rsp
+  803fd3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803fd7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803fdb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803fdf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803fe3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803fea:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803fee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ff2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ff6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ffa:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ffe:	48 b8 46 3f 80 00 00 	movabs $0x803f46,%rax
+  804005:	00 00 00 
+  804008:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80400a:	c9                   	leave
+  80400b:	c3                   	ret
+
+000000000080400c <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80400c:	55                   	push   %rbp
+  80400d:	48 89 e5             	mov    %rsp,%rbp
+  804010:	48 83 ec 50          	sub    $0x50,%rsp
+  804014:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804018:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80401c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804020:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804024:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804028:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80402f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804033:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804037:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80403b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80403f:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804043:	48 89 fe             	mov    %rdi,%rsi
+  804046:	bf 01 00 00 00       	mov    $0x1,%edi
+  80404b:	48 b8 46 3f 80 00 00 	movabs $0x803f46,%rax
+  804052:	00 00 00 
+  804055:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804057:	c9                   	leave
+  804058:	c3                   	ret
+
+0000000000804059 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804059:	55                   	push   %rbp
+  80405a:	48 89 e5             	mov    %rsp,%rbp
+  80405d:	41 54                	push   %r12
+  80405f:	53                   	push   %rbx
+  804060:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804063:	48 b8 e2 30 80 00 00 	movabs $0x8030e2,%rax
+  80406a:	00 00 00 
+  80406d:	ff d0                	call   *%rax
+  80406f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804072:	48 be b0 63 80 00 00 	movabs $0x8063b0,%rsi
+  804079:	00 00 00 
+  80407c:	48 89 df             	mov    %rbx,%rdi
+  80407f:	48 b8 8b 20 80 00 00 	movabs $0x80208b,%rax
+  804086:	00 00 00 
+  804089:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80408b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804090:	41 2b 04 24          	sub    (%r12),%eax
+  804094:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80409a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8040a1:	00 00 00 
+    stat->st_dev = &devpipe;
+  8040a4:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8040ab:	00 00 00 
+  8040ae:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8040b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ba:	5b                   	pop    %rbx
+  8040bb:	41 5c                	pop    %r12
+  8040bd:	5d                   	pop    %rbp
+  8040be:	c3                   	ret
+
+00000000008040bf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8040bf:	55                   	push   %rbp
+  8040c0:	48 89 e5             	mov    %rsp,%rbp
+  8040c3:	41 54                	push   %r12
+  8040c5:	53                   	push   %rbx
+  8040c6:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8040c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040ce:	48 89 fe             	mov    %rdi,%rsi
+  8040d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d6:	49 bc c8 28 80 00 00 	movabs $0x8028c8,%r12
+  8040dd:	00 00 00 
+  8040e0:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8040e3:	48 89 df             	mov    %rbx,%rdi
+  8040e6:	48 b8 e2 30 80 00 00 	movabs $0x8030e2,%rax
+  8040ed:	00 00 00 
+  8040f0:	ff d0                	call   *%rax
+  8040f2:	48 89 c6             	mov    %rax,%rsi
+  8040f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ff:	41 ff d4             	call   *%r12
+}
+  804102:	5b                   	pop    %rbx
+  804103:	41 5c                	pop    %r12
+  804105:	5d                   	pop    %rbp
+  804106:	c3                   	ret
+
+0000000000804107 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804107:	55                   	push   %rbp
+  804108:	48 89 e5             	mov    %rsp,%rbp
+  80410b:	41 57                	push   %r15
+  80410d:	41 56                	push   %r14
+  80410f:	41 55                	push   %r13
+  804111:	41 54                	push   %r12
+  804113:	53                   	push   %rbx
+  804114:	48 83 ec 18          	sub    $0x18,%rsp
+  804118:	49 89 fc             	mov    %rdi,%r12
+  80411b:	49 89 f5             	mov    %rsi,%r13
+  80411e:	49 89 d7             	mov    %rdx,%r15
+  804121:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804125:	48 b8 e2 30 80 00 00 	movabs $0x8030e2,%rax
+  80412c:	00 00 00 
+  80412f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804131:	4d 85 ff             	test   %r15,%r15
+  804134:	0f 84 af 00 00 00    	je     8041e9 <devpipe_write+0xe2>
+  80413a:	48 89 c3             	mov    %rax,%rbx
+  80413d:	4c 89 f8             	mov    %r15,%rax
+  804140:	4d 89 ef             	mov    %r13,%r15
+  804143:	4c 01 e8             	add    %r13,%rax
+  804146:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80414a:	49 bd be 27 80 00 00 	movabs $0x8027be,%r13
+  804151:	00 00 00 
+            sys_yield();
+  804154:	49 be 4f 27 80 00 00 	movabs $0x80274f,%r14
+  80415b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80415e:	8b 73 04             	mov    0x4(%rbx),%esi
+  804161:	48 63 ce             	movslq %esi,%rcx
+  804164:	48 63 03             	movslq (%rbx),%rax
+  804167:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80416d:	48 39 c1             	cmp    %rax,%rcx
+  804170:	72 2e                	jb     8041a0 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804172:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804177:	48 89 da             	mov    %rbx,%rdx
+  80417a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80417f:	4c 89 e7             	mov    %r12,%rdi
+  804182:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804185:	85 c0                	test   %eax,%eax
+  804187:	74 66                	je     8041ef <devpipe_write+0xe8>
+            sys_yield();
+  804189:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80418c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80418f:	48 63 ce             	movslq %esi,%rcx
+  804192:	48 63 03             	movslq (%rbx),%rax
+  804195:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80419b:	48 39 c1             	cmp    %rax,%rcx
+  80419e:	73 d2                	jae    804172 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8041a0:	41 0f b6 3f          	movzbl (%r15),%edi
+  8041a4:	48 89 ca             	mov    %rcx,%rdx
+  8041a7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041ab:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8041b2:	08 10 20 
+  8041b5:	48 f7 e2             	mul    %rdx
+  8041b8:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041bc:	48 89 d0             	mov    %rdx,%rax
+  8041bf:	48 c1 e0 09          	shl    $0x9,%rax
+  8041c3:	48 29 d0             	sub    %rdx,%rax
+  8041c6:	48 c1 e0 03          	shl    $0x3,%rax
+  8041ca:	48 29 c1             	sub    %rax,%rcx
+  8041cd:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8041d2:	83 c6 01             	add    $0x1,%esi
+  8041d5:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041d8:	49 83 c7 01          	add    $0x1,%r15
+  8041dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041e0:	49 39 c7             	cmp    %rax,%r15
+  8041e3:	0f 85 75 ff ff ff    	jne    80415e <devpipe_write+0x57>
+    return n;
+  8041e9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041ed:	eb 05                	jmp    8041f4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8041ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041f4:	48 83 c4 18          	add    $0x18,%rsp
+  8041f8:	5b                   	pop    %rbx
+  8041f9:	41 5c                	pop    %r12
+  8041fb:	41 5d                	pop    %r13
+  8041fd:	41 5e                	pop    %r14
+  8041ff:	41 5f                	pop    %r15
+  804201:	5d                   	pop    %rbp
+  804202:	c3                   	ret
+
+0000000000804203 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804203:	55                   	push   %rbp
+  804204:	48 89 e5             	mov    %rsp,%rbp
+  804207:	41 57                	push   %r15
+  804209:	41 56                	push   %r14
+  80420b:	41 55                	push   %r13
+  80420d:	41 54                	push   %r12
+  80420f:	53                   	push   %rbx
+  804210:	48 83 ec 18          	sub    $0x18,%rsp
+  804214:	49 89 fc             	mov    %rdi,%r12
+  804217:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80421b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80421f:	48 b8 e2 30 80 00 00 	movabs $0x8030e2,%rax
+  804226:	00 00 00 
+  804229:	ff d0                	call   *%rax
+  80422b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80422e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804234:	49 bd be 27 80 00 00 	movabs $0x8027be,%r13
+  80423b:	00 00 00 
+            sys_yield();
+  80423e:	49 be 4f 27 80 00 00 	movabs $0x80274f,%r14
+  804245:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804248:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80424d:	74 7d                	je     8042cc <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80424f:	8b 03                	mov    (%rbx),%eax
+  804251:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804254:	75 26                	jne    80427c <devpipe_read+0x79>
+            if (i > 0) return i;
+  804256:	4d 85 ff             	test   %r15,%r15
+  804259:	75 77                	jne    8042d2 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80425b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804260:	48 89 da             	mov    %rbx,%rdx
+  804263:	be 00 10 00 00       	mov    $0x1000,%esi
+  804268:	4c 89 e7             	mov    %r12,%rdi
+  80426b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80426e:	85 c0                	test   %eax,%eax
+  804270:	74 72                	je     8042e4 <devpipe_read+0xe1>
+            sys_yield();
+  804272:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804275:	8b 03                	mov    (%rbx),%eax
+  804277:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80427a:	74 df                	je     80425b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80427c:	48 63 c8             	movslq %eax,%rcx
+  80427f:	48 89 ca             	mov    %rcx,%rdx
+  804282:	48 c1 ea 03          	shr    $0x3,%rdx
+  804286:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80428d:	08 10 20 
+  804290:	48 89 d0             	mov    %rdx,%rax
+  804293:	48 f7 e6             	mul    %rsi
+  804296:	48 c1 ea 06          	shr    $0x6,%rdx
+  80429a:	48 89 d0             	mov    %rdx,%rax
+  80429d:	48 c1 e0 09          	shl    $0x9,%rax
+  8042a1:	48 29 d0             	sub    %rdx,%rax
+  8042a4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8042ab:	00 
+  8042ac:	48 89 c8             	mov    %rcx,%rax
+  8042af:	48 29 d0             	sub    %rdx,%rax
+  8042b2:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8042b7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8042bb:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8042bf:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042c2:	49 83 c7 01          	add    $0x1,%r15
+  8042c6:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8042ca:	75 83                	jne    80424f <devpipe_read+0x4c>
+    return n;
+  8042cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042d0:	eb 03                	jmp    8042d5 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8042d2:	4c 89 f8             	mov    %r15,%rax
+}
+  8042d5:	48 83 c4 18          	add    $0x18,%rsp
+  8042d9:	5b                   	pop    %rbx
+  8042da:	41 5c                	pop    %r12
+  8042dc:	41 5d                	pop    %r13
+  8042de:	41 5e                	pop    %r14
+  8042e0:	41 5f                	pop    %r15
+  8042e2:	5d                   	pop    %rbp
+  8042e3:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8042e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e9:	eb ea                	jmp    8042d5 <devpipe_read+0xd2>
+
+00000000008042eb <pipe>:
+pipe(int pfd[2]) {
+  8042eb:	55                   	push   %rbp
+  8042ec:	48 89 e5             	mov    %rsp,%rbp
+  8042ef:	41 55                	push   %r13
+  8042f1:	41 54                	push   %r12
+  8042f3:	53                   	push   %rbx
+  8042f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8042f8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8042fb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8042ff:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  804306:	00 00 00 
+  804309:	ff d0                	call   *%rax
+  80430b:	89 c3                	mov    %eax,%ebx
+  80430d:	85 c0                	test   %eax,%eax
+  80430f:	0f 88 a0 01 00 00    	js     8044b5 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804315:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80431a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80431f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804323:	bf 00 00 00 00       	mov    $0x0,%edi
+  804328:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  80432f:	00 00 00 
+  804332:	ff d0                	call   *%rax
+  804334:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804336:	85 c0                	test   %eax,%eax
+  804338:	0f 88 77 01 00 00    	js     8044b5 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80433e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804342:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  804349:	00 00 00 
+  80434c:	ff d0                	call   *%rax
+  80434e:	89 c3                	mov    %eax,%ebx
+  804350:	85 c0                	test   %eax,%eax
+  804352:	0f 88 43 01 00 00    	js     80449b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804358:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80435d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804362:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804366:	bf 00 00 00 00       	mov    $0x0,%edi
+  80436b:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  804372:	00 00 00 
+  804375:	ff d0                	call   *%rax
+  804377:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804379:	85 c0                	test   %eax,%eax
+  80437b:	0f 88 1a 01 00 00    	js     80449b <pipe+0x1b0>
+    va = fd2data(fd0);
+  804381:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804385:	48 b8 e2 30 80 00 00 	movabs $0x8030e2,%rax
+  80438c:	00 00 00 
+  80438f:	ff d0                	call   *%rax
+  804391:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804394:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804399:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80439e:	48 89 c6             	mov    %rax,%rsi
+  8043a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043a6:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  8043ad:	00 00 00 
+  8043b0:	ff d0                	call   *%rax
+  8043b2:	89 c3                	mov    %eax,%ebx
+  8043b4:	85 c0                	test   %eax,%eax
+  8043b6:	0f 88 c5 00 00 00    	js     804481 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8043bc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043c0:	48 b8 e2 30 80 00 00 	movabs $0x8030e2,%rax
+  8043c7:	00 00 00 
+  8043ca:	ff d0                	call   *%rax
+  8043cc:	48 89 c1             	mov    %rax,%rcx
+  8043cf:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8043d5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8043db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043e0:	4c 89 ee             	mov    %r13,%rsi
+  8043e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e8:	48 b8 5d 28 80 00 00 	movabs $0x80285d,%rax
+  8043ef:	00 00 00 
+  8043f2:	ff d0                	call   *%rax
+  8043f4:	89 c3                	mov    %eax,%ebx
+  8043f6:	85 c0                	test   %eax,%eax
+  8043f8:	78 6e                	js     804468 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8043fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043ff:	4c 89 ef             	mov    %r13,%rdi
+  804402:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  804409:	00 00 00 
+  80440c:	ff d0                	call   *%rax
+  80440e:	83 f8 02             	cmp    $0x2,%eax
+  804411:	0f 85 ab 00 00 00    	jne    8044c2 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804417:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80441e:	00 00 
+  804420:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804424:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804426:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80442a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804431:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804435:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804437:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80443b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804442:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804446:	48 bb d0 30 80 00 00 	movabs $0x8030d0,%rbx
+  80444d:	00 00 00 
+  804450:	ff d3                	call   *%rbx
+  804452:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804456:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80445a:	ff d3                	call   *%rbx
+  80445c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804466:	eb 4d                	jmp    8044b5 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804468:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80446d:	4c 89 ee             	mov    %r13,%rsi
+  804470:	bf 00 00 00 00       	mov    $0x0,%edi
+  804475:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  80447c:	00 00 00 
+  80447f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804481:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804486:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80448a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80448f:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  804496:	00 00 00 
+  804499:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80449b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044a0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a9:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  8044b0:	00 00 00 
+  8044b3:	ff d0                	call   *%rax
+}
+  8044b5:	89 d8                	mov    %ebx,%eax
+  8044b7:	48 83 c4 18          	add    $0x18,%rsp
+  8044bb:	5b                   	pop    %rbx
+  8044bc:	41 5c                	pop    %r12
+  8044be:	41 5d                	pop    %r13
+  8044c0:	5d                   	pop    %rbp
+  8044c1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044c2:	48 b9 c8 63 80 00 00 	movabs $0x8063c8,%rcx
+  8044c9:	00 00 00 
+  8044cc:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  8044d3:	00 00 00 
+  8044d6:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8044db:	48 bf b7 63 80 00 00 	movabs $0x8063b7,%rdi
+  8044e2:	00 00 00 
+  8044e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ea:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  8044f1:	00 00 00 
+  8044f4:	41 ff d0             	call   *%r8
+
+00000000008044f7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8044f7:	55                   	push   %rbp
+  8044f8:	48 89 e5             	mov    %rsp,%rbp
+  8044fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8044ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804503:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  80450a:	00 00 00 
+  80450d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80450f:	85 c0                	test   %eax,%eax
+  804511:	78 35                	js     804548 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804513:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804517:	48 b8 e2 30 80 00 00 	movabs $0x8030e2,%rax
+  80451e:	00 00 00 
+  804521:	ff d0                	call   *%rax
+  804523:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804526:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80452b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804530:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804534:	48 b8 be 27 80 00 00 	movabs $0x8027be,%rax
+  80453b:	00 00 00 
+  80453e:	ff d0                	call   *%rax
+  804540:	85 c0                	test   %eax,%eax
+  804542:	0f 94 c0             	sete   %al
+  804545:	0f b6 c0             	movzbl %al,%eax
+}
+  804548:	c9                   	leave
+  804549:	c3                   	ret
+
+000000000080454a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80454a:	48 89 f8             	mov    %rdi,%rax
+  80454d:	48 c1 e8 27          	shr    $0x27,%rax
+  804551:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804558:	01 00 00 
+  80455b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80455f:	f6 c2 01             	test   $0x1,%dl
+  804562:	74 6d                	je     8045d1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804564:	48 89 f8             	mov    %rdi,%rax
+  804567:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80456b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804572:	01 00 00 
+  804575:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804579:	f6 c2 01             	test   $0x1,%dl
+  80457c:	74 62                	je     8045e0 <get_uvpt_entry+0x96>
+  80457e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804585:	01 00 00 
+  804588:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80458c:	f6 c2 80             	test   $0x80,%dl
+  80458f:	75 4f                	jne    8045e0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804591:	48 89 f8             	mov    %rdi,%rax
+  804594:	48 c1 e8 15          	shr    $0x15,%rax
+  804598:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80459f:	01 00 00 
+  8045a2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045a6:	f6 c2 01             	test   $0x1,%dl
+  8045a9:	74 44                	je     8045ef <get_uvpt_entry+0xa5>
+  8045ab:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045b2:	01 00 00 
+  8045b5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045b9:	f6 c2 80             	test   $0x80,%dl
+  8045bc:	75 31                	jne    8045ef <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8045be:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8045c2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8045c9:	01 00 00 
+  8045cc:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8045d0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8045d1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8045d8:	01 00 00 
+  8045db:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045df:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8045e0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045e7:	01 00 00 
+  8045ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045ee:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045ef:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045f6:	01 00 00 
+  8045f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045fd:	c3                   	ret
+
+00000000008045fe <get_prot>:
+
+int
+get_prot(void *va) {
+  8045fe:	55                   	push   %rbp
+  8045ff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804602:	48 b8 4a 45 80 00 00 	movabs $0x80454a,%rax
+  804609:	00 00 00 
+  80460c:	ff d0                	call   *%rax
+  80460e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804611:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804616:	89 c1                	mov    %eax,%ecx
+  804618:	83 c9 04             	or     $0x4,%ecx
+  80461b:	f6 c2 01             	test   $0x1,%dl
+  80461e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804621:	89 c1                	mov    %eax,%ecx
+  804623:	83 c9 02             	or     $0x2,%ecx
+  804626:	f6 c2 02             	test   $0x2,%dl
+  804629:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80462c:	89 c1                	mov    %eax,%ecx
+  80462e:	83 c9 01             	or     $0x1,%ecx
+  804631:	48 85 d2             	test   %rdx,%rdx
+  804634:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804637:	89 c1                	mov    %eax,%ecx
+  804639:	83 c9 40             	or     $0x40,%ecx
+  80463c:	f6 c6 04             	test   $0x4,%dh
+  80463f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804642:	5d                   	pop    %rbp
+  804643:	c3                   	ret
+
+0000000000804644 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804644:	55                   	push   %rbp
+  804645:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804648:	48 b8 4a 45 80 00 00 	movabs $0x80454a,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804654:	48 c1 e8 06          	shr    $0x6,%rax
+  804658:	83 e0 01             	and    $0x1,%eax
+}
+  80465b:	5d                   	pop    %rbp
+  80465c:	c3                   	ret
+
+000000000080465d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80465d:	55                   	push   %rbp
+  80465e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804661:	48 b8 4a 45 80 00 00 	movabs $0x80454a,%rax
+  804668:	00 00 00 
+  80466b:	ff d0                	call   *%rax
+  80466d:	83 e0 01             	and    $0x1,%eax
+}
+  804670:	5d                   	pop    %rbp
+  804671:	c3                   	ret
+
+0000000000804672 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804672:	55                   	push   %rbp
+  804673:	48 89 e5             	mov    %rsp,%rbp
+  804676:	41 57                	push   %r15
+  804678:	41 56                	push   %r14
+  80467a:	41 55                	push   %r13
+  80467c:	41 54                	push   %r12
+  80467e:	53                   	push   %rbx
+  80467f:	48 83 ec 28          	sub    $0x28,%rsp
+  804683:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804687:	48 85 ff             	test   %rdi,%rdi
+  80468a:	74 1e                	je     8046aa <foreach_shared_region+0x38>
+  80468c:	49 89 ff             	mov    %rdi,%r15
+  80468f:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804695:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80469b:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8046a2:	01 00 00 
+  8046a5:	e9 72 02 00 00       	jmp    80491c <foreach_shared_region+0x2aa>
+    assert(fun);
+  8046aa:	48 b9 ec 63 80 00 00 	movabs $0x8063ec,%rcx
+  8046b1:	00 00 00 
+  8046b4:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  8046bb:	00 00 00 
+  8046be:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8046c3:	48 bf f0 63 80 00 00 	movabs $0x8063f0,%rdi
+  8046ca:	00 00 00 
+  8046cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d2:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  8046d9:	00 00 00 
+  8046dc:	41 ff d0             	call   *%r8
+  8046df:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8046e6:	eb 6c                	jmp    804754 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8046e8:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8046ef:	ff ff ff 
+  8046f2:	4c 21 e2             	and    %r12,%rdx
+  8046f5:	48 89 d8             	mov    %rbx,%rax
+  8046f8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8046fd:	48 83 c0 01          	add    $0x1,%rax
+  804701:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804705:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80470c:	00 00 00 
+  80470f:	48 21 c8             	and    %rcx,%rax
+  804712:	48 09 d0             	or     %rdx,%rax
+  804715:	49 89 c4             	mov    %rax,%r12
+  804718:	eb 30                	jmp    80474a <foreach_shared_region+0xd8>
+  80471a:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804721:	ff ff ff 
+  804724:	4c 21 e2             	and    %r12,%rdx
+  804727:	48 89 d8             	mov    %rbx,%rax
+  80472a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80472f:	48 83 c0 01          	add    $0x1,%rax
+  804733:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804737:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80473e:	00 00 00 
+  804741:	48 21 c8             	and    %rcx,%rax
+  804744:	48 09 d0             	or     %rdx,%rax
+  804747:	49 89 c4             	mov    %rax,%r12
+  80474a:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80474e:	0f 84 99 01 00 00    	je     8048ed <foreach_shared_region+0x27b>
+  804754:	4c 89 e3             	mov    %r12,%rbx
+  804757:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80475b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804762:	01 00 00 
+  804765:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804769:	a8 01                	test   $0x1,%al
+  80476b:	0f 84 77 ff ff ff    	je     8046e8 <foreach_shared_region+0x76>
+  804771:	a8 80                	test   $0x80,%al
+  804773:	74 19                	je     80478e <foreach_shared_region+0x11c>
+  804775:	f6 c4 04             	test   $0x4,%ah
+  804778:	74 a0                	je     80471a <foreach_shared_region+0xa8>
+  80477a:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804781:	40 
+  804782:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804786:	4c 89 e7             	mov    %r12,%rdi
+  804789:	41 ff d7             	call   *%r15
+  80478c:	eb 8c                	jmp    80471a <foreach_shared_region+0xa8>
+  80478e:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804795:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804799:	eb 46                	jmp    8047e1 <foreach_shared_region+0x16f>
+  80479b:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047a2:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047a8:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047ac:	48 c1 e0 15          	shl    $0x15,%rax
+  8047b0:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047b5:	49 09 c4             	or     %rax,%r12
+  8047b8:	eb 1d                	jmp    8047d7 <foreach_shared_region+0x165>
+  8047ba:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047c1:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047c7:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047cb:	48 c1 e0 15          	shl    $0x15,%rax
+  8047cf:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047d4:	49 09 c4             	or     %rax,%r12
+  8047d7:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8047db:	0f 84 d3 00 00 00    	je     8048b4 <foreach_shared_region+0x242>
+  8047e1:	4c 89 e3             	mov    %r12,%rbx
+  8047e4:	48 c1 eb 15          	shr    $0x15,%rbx
+  8047e8:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8047ef:	01 00 00 
+  8047f2:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8047f6:	a8 01                	test   $0x1,%al
+  8047f8:	74 a1                	je     80479b <foreach_shared_region+0x129>
+  8047fa:	a8 80                	test   $0x80,%al
+  8047fc:	74 19                	je     804817 <foreach_shared_region+0x1a5>
+  8047fe:	f6 c4 04             	test   $0x4,%ah
+  804801:	74 b7                	je     8047ba <foreach_shared_region+0x148>
+  804803:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80480a:	00 
+  80480b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80480f:	4c 89 e7             	mov    %r12,%rdi
+  804812:	41 ff d7             	call   *%r15
+  804815:	eb a3                	jmp    8047ba <foreach_shared_region+0x148>
+  804817:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80481d:	eb 3b                	jmp    80485a <foreach_shared_region+0x1e8>
+  80481f:	f6 c4 04             	test   $0x4,%ah
+  804822:	74 12                	je     804836 <foreach_shared_region+0x1c4>
+  804824:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80482b:	00 
+  80482c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804830:	4c 89 e7             	mov    %r12,%rdi
+  804833:	41 ff d7             	call   *%r15
+  804836:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80483d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804843:	48 83 c3 01          	add    $0x1,%rbx
+  804847:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80484b:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804851:	49 09 dc             	or     %rbx,%r12
+  804854:	41 83 ed 01          	sub    $0x1,%r13d
+  804858:	74 2f                	je     804889 <foreach_shared_region+0x217>
+  80485a:	4c 89 e3             	mov    %r12,%rbx
+  80485d:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804861:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804865:	a8 01                	test   $0x1,%al
+  804867:	75 b6                	jne    80481f <foreach_shared_region+0x1ad>
+  804869:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804870:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804876:	48 83 c3 01          	add    $0x1,%rbx
+  80487a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80487e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804884:	49 09 dc             	or     %rbx,%r12
+  804887:	eb cb                	jmp    804854 <foreach_shared_region+0x1e2>
+  804889:	4c 89 e0             	mov    %r12,%rax
+  80488c:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804892:	49 c1 ec 15          	shr    $0x15,%r12
+  804896:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80489d:	49 83 c4 01          	add    $0x1,%r12
+  8048a1:	49 c1 e4 15          	shl    $0x15,%r12
+  8048a5:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8048ac:	49 09 c4             	or     %rax,%r12
+  8048af:	e9 23 ff ff ff       	jmp    8047d7 <foreach_shared_region+0x165>
+  8048b4:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8048b8:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8048bf:	ff ff ff 
+  8048c2:	4c 21 e0             	and    %r12,%rax
+  8048c5:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8048c9:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8048d0:	49 83 c4 01          	add    $0x1,%r12
+  8048d4:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8048d8:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8048df:	00 00 00 
+  8048e2:	49 21 d4             	and    %rdx,%r12
+  8048e5:	49 09 c4             	or     %rax,%r12
+  8048e8:	e9 5d fe ff ff       	jmp    80474a <foreach_shared_region+0xd8>
+  8048ed:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8048f4:	00 ff ff 
+  8048f7:	4c 21 e0             	and    %r12,%rax
+  8048fa:	49 c1 ec 27          	shr    $0x27,%r12
+  8048fe:	49 83 c4 01          	add    $0x1,%r12
+  804902:	49 c1 e4 27          	shl    $0x27,%r12
+  804906:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80490d:	ff 00 00 
+  804910:	49 21 d4             	and    %rdx,%r12
+  804913:	49 09 c4             	or     %rax,%r12
+  804916:	41 83 ed 01          	sub    $0x1,%r13d
+  80491a:	74 48                	je     804964 <foreach_shared_region+0x2f2>
+  80491c:	4c 89 e0             	mov    %r12,%rax
+  80491f:	48 c1 e8 27          	shr    $0x27,%rax
+  804923:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80492a:	01 00 00 
+  80492d:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804931:	f6 c2 01             	test   $0x1,%dl
+  804934:	0f 85 a5 fd ff ff    	jne    8046df <foreach_shared_region+0x6d>
+  80493a:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804941:	00 ff ff 
+  804944:	4c 21 e2             	and    %r12,%rdx
+  804947:	48 83 c0 01          	add    $0x1,%rax
+  80494b:	48 c1 e0 27          	shl    $0x27,%rax
+  80494f:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804956:	ff 00 00 
+  804959:	48 21 c8             	and    %rcx,%rax
+  80495c:	48 09 d0             	or     %rdx,%rax
+  80495f:	49 89 c4             	mov    %rax,%r12
+  804962:	eb b2                	jmp    804916 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804964:	4d 85 e4             	test   %r12,%r12
+  804967:	75 14                	jne    80497d <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80496e:	48 83 c4 28          	add    $0x28,%rsp
+  804972:	5b                   	pop    %rbx
+  804973:	41 5c                	pop    %r12
+  804975:	41 5d                	pop    %r13
+  804977:	41 5e                	pop    %r14
+  804979:	41 5f                	pop    %r15
+  80497b:	5d                   	pop    %rbp
+  80497c:	c3                   	ret
+    assert(addr == 0);
+  80497d:	48 b9 fb 63 80 00 00 	movabs $0x8063fb,%rcx
+  804984:	00 00 00 
+  804987:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  80498e:	00 00 00 
+  804991:	be 67 00 00 00       	mov    $0x67,%esi
+  804996:	48 bf f0 63 80 00 00 	movabs $0x8063f0,%rdi
+  80499d:	00 00 00 
+  8049a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049a5:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  8049ac:	00 00 00 
+  8049af:	41 ff d0             	call   *%r8
+
+00000000008049b2 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8049b2:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8049b9:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8049bc:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8049c2:	eb 33                	jmp    8049f7 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8049c4:	48 83 c0 20          	add    $0x20,%rax
+  8049c8:	4c 39 c0             	cmp    %r8,%rax
+  8049cb:	74 25                	je     8049f2 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8049cd:	48 8b 10             	mov    (%rax),%rdx
+  8049d0:	48 85 d2             	test   %rdx,%rdx
+  8049d3:	74 ef                	je     8049c4 <mmap_place+0x12>
+  8049d5:	48 89 d1             	mov    %rdx,%rcx
+  8049d8:	48 03 48 08          	add    0x8(%rax),%rcx
+  8049dc:	48 39 cf             	cmp    %rcx,%rdi
+  8049df:	73 e3                	jae    8049c4 <mmap_place+0x12>
+  8049e1:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8049e5:	4c 39 ca             	cmp    %r9,%rdx
+  8049e8:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8049ec:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8049f0:	eb d2                	jmp    8049c4 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8049f2:	45 84 d2             	test   %r10b,%r10b
+  8049f5:	74 12                	je     804a09 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8049f7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8049fe:	00 00 00 
+        moved = 0;
+  804a01:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804a07:	eb c4                	jmp    8049cd <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804a09:	48 01 fe             	add    %rdi,%rsi
+  804a0c:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804a13:	00 00 00 
+  804a16:	48 39 f0             	cmp    %rsi,%rax
+  804a19:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a1e:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804a22:	c3                   	ret
+
+0000000000804a23 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804a23:	55                   	push   %rbp
+  804a24:	48 89 e5             	mov    %rsp,%rbp
+  804a27:	41 57                	push   %r15
+  804a29:	41 56                	push   %r14
+  804a2b:	41 55                	push   %r13
+  804a2d:	41 54                	push   %r12
+  804a2f:	53                   	push   %rbx
+  804a30:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804a34:	48 8b 1f             	mov    (%rdi),%rbx
+  804a37:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a3e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a45:	00 00 00 
+  804a48:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a4d:	eb 12                	jmp    804a61 <mmap_pgfault+0x3e>
+  804a4f:	48 83 c2 01          	add    $0x1,%rdx
+  804a53:	48 83 c0 20          	add    $0x20,%rax
+  804a57:	48 83 fa 20          	cmp    $0x20,%rdx
+  804a5b:	0f 84 04 01 00 00    	je     804b65 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804a61:	48 8b 08             	mov    (%rax),%rcx
+  804a64:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804a68:	48 39 de             	cmp    %rbx,%rsi
+  804a6b:	73 e2                	jae    804a4f <mmap_pgfault+0x2c>
+  804a6d:	48 03 48 08          	add    0x8(%rax),%rcx
+  804a71:	48 39 cb             	cmp    %rcx,%rbx
+  804a74:	73 d9                	jae    804a4f <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804a76:	48 c1 e2 05          	shl    $0x5,%rdx
+  804a7a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a81:	00 00 00 
+  804a84:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804a88:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804a8c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804a90:	f6 c2 01             	test   $0x1,%dl
+  804a93:	0f 84 e0 00 00 00    	je     804b79 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a9e:	f6 c2 02             	test   $0x2,%dl
+  804aa1:	0f 84 c3 00 00 00    	je     804b6a <mmap_pgfault+0x147>
+  804aa7:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804aae:	ff ff ff 
+  804ab1:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804ab5:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804abc:	00 00 00 
+  804abf:	48 39 ca             	cmp    %rcx,%rdx
+  804ac2:	0f 85 a2 00 00 00    	jne    804b6a <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804ac8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804acd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ad2:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804ad9:	00 00 00 
+  804adc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ae1:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  804ae8:	00 00 00 
+  804aeb:	ff d0                	call   *%rax
+  804aed:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  804af4:	85 d2                	test   %edx,%edx
+  804af6:	78 72                	js     804b6a <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804af8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804afd:	48 89 de             	mov    %rbx,%rsi
+  804b00:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804b07:	00 00 00 
+  804b0a:	4c 89 e7             	mov    %r12,%rdi
+  804b0d:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  804b14:	00 00 00 
+  804b17:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804b19:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804b1f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804b25:	48 89 d9             	mov    %rbx,%rcx
+  804b28:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b2d:	4c 89 e6             	mov    %r12,%rsi
+  804b30:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b35:	48 b8 5d 28 80 00 00 	movabs $0x80285d,%rax
+  804b3c:	00 00 00 
+  804b3f:	ff d0                	call   *%rax
+  804b41:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804b43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b48:	4c 89 e6             	mov    %r12,%rsi
+  804b4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b50:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  804b57:	00 00 00 
+  804b5a:	ff d0                	call   *%rax
+    return res >= 0;
+  804b5c:	89 d8                	mov    %ebx,%eax
+  804b5e:	f7 d0                	not    %eax
+  804b60:	c1 e8 1f             	shr    $0x1f,%eax
+  804b63:	eb 05                	jmp    804b6a <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804b65:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804b6a:	48 83 c4 18          	add    $0x18,%rsp
+  804b6e:	5b                   	pop    %rbx
+  804b6f:	41 5c                	pop    %r12
+  804b71:	41 5d                	pop    %r13
+  804b73:	41 5e                	pop    %r14
+  804b75:	41 5f                	pop    %r15
+  804b77:	5d                   	pop    %rbp
+  804b78:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804b79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b7d:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804b81:	4c 03 30             	add    (%rax),%r14
+  804b84:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804b8b:	49 39 c6             	cmp    %rax,%r14
+  804b8e:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804b92:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804b99:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804b9f:	49 bf 5d 46 80 00 00 	movabs $0x80465d,%r15
+  804ba6:	00 00 00 
+  804ba9:	4d 39 f4             	cmp    %r14,%r12
+  804bac:	73 1d                	jae    804bcb <mmap_pgfault+0x1a8>
+  804bae:	4c 89 e7             	mov    %r12,%rdi
+  804bb1:	41 ff d7             	call   *%r15
+  804bb4:	84 c0                	test   %al,%al
+  804bb6:	75 13                	jne    804bcb <mmap_pgfault+0x1a8>
+  804bb8:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804bbf:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804bc6:	4d 39 f4             	cmp    %r14,%r12
+  804bc9:	72 e3                	jb     804bae <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804bcb:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804bd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bd5:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804bd9:	74 2a                	je     804c05 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804bdb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bdf:	89 de                	mov    %ebx,%esi
+  804be1:	2b 30                	sub    (%rax),%esi
+  804be3:	03 70 1c             	add    0x1c(%rax),%esi
+  804be6:	8b 78 18             	mov    0x18(%rax),%edi
+  804be9:	4c 89 e9             	mov    %r13,%rcx
+  804bec:	48 89 da             	mov    %rbx,%rdx
+  804bef:	48 b8 bb 3d 80 00 00 	movabs $0x803dbb,%rax
+  804bf6:	00 00 00 
+  804bf9:	ff d0                	call   *%rax
+    return res > 0;
+  804bfb:	85 c0                	test   %eax,%eax
+  804bfd:	0f 9f c0             	setg   %al
+  804c00:	e9 65 ff ff ff       	jmp    804b6a <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c05:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804c09:	eb d0                	jmp    804bdb <mmap_pgfault+0x1b8>
+
+0000000000804c0b <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804c0b:	55                   	push   %rbp
+  804c0c:	48 89 e5             	mov    %rsp,%rbp
+  804c0f:	41 57                	push   %r15
+  804c11:	41 56                	push   %r14
+  804c13:	41 55                	push   %r13
+  804c15:	41 54                	push   %r12
+  804c17:	53                   	push   %rbx
+  804c18:	48 83 ec 28          	sub    $0x28,%rsp
+  804c1c:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804c20:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804c23:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c2a:	ff ff ff 
+  804c2d:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c36:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804c3d:	00 00 00 
+  804c40:	48 39 ca             	cmp    %rcx,%rdx
+  804c43:	0f 85 e5 00 00 00    	jne    804d2e <mmap_writeback+0x123>
+  804c49:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804c4c:	4c 39 ee             	cmp    %r13,%rsi
+  804c4f:	0f 83 e8 00 00 00    	jae    804d3d <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c55:	49 be 5d 46 80 00 00 	movabs $0x80465d,%r14
+  804c5c:	00 00 00 
+  804c5f:	49 bf 44 46 80 00 00 	movabs $0x804644,%r15
+  804c66:	00 00 00 
+  804c69:	eb 10                	jmp    804c7b <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804c6b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804c72:	4d 39 ec             	cmp    %r13,%r12
+  804c75:	0f 83 ae 00 00 00    	jae    804d29 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c7b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804c7f:	4c 89 e7             	mov    %r12,%rdi
+  804c82:	41 ff d6             	call   *%r14
+  804c85:	84 c0                	test   %al,%al
+  804c87:	74 e2                	je     804c6b <mmap_writeback+0x60>
+  804c89:	4c 89 e7             	mov    %r12,%rdi
+  804c8c:	41 ff d7             	call   *%r15
+  804c8f:	84 c0                	test   %al,%al
+  804c91:	74 d8                	je     804c6b <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804c93:	4c 89 e3             	mov    %r12,%rbx
+  804c96:	4d 39 ec             	cmp    %r13,%r12
+  804c99:	73 20                	jae    804cbb <mmap_writeback+0xb0>
+  804c9b:	48 89 df             	mov    %rbx,%rdi
+  804c9e:	41 ff d6             	call   *%r14
+  804ca1:	84 c0                	test   %al,%al
+  804ca3:	74 16                	je     804cbb <mmap_writeback+0xb0>
+  804ca5:	48 89 df             	mov    %rbx,%rdi
+  804ca8:	41 ff d7             	call   *%r15
+  804cab:	84 c0                	test   %al,%al
+  804cad:	74 0c                	je     804cbb <mmap_writeback+0xb0>
+  804caf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804cb6:	4c 39 eb             	cmp    %r13,%rbx
+  804cb9:	72 e0                	jb     804c9b <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804cbb:	48 89 d9             	mov    %rbx,%rcx
+  804cbe:	4c 29 e1             	sub    %r12,%rcx
+  804cc1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804cc5:	44 89 e6             	mov    %r12d,%esi
+  804cc8:	2b 30                	sub    (%rax),%esi
+  804cca:	49 89 c4             	mov    %rax,%r12
+  804ccd:	03 70 1c             	add    0x1c(%rax),%esi
+  804cd0:	8b 78 18             	mov    0x18(%rax),%edi
+  804cd3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804cd7:	48 89 ca             	mov    %rcx,%rdx
+  804cda:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  804ce1:	00 00 00 
+  804ce4:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804ce6:	85 c0                	test   %eax,%eax
+  804ce8:	78 44                	js     804d2e <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804cea:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804cef:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804cf2:	41 89 c1             	mov    %eax,%r9d
+  804cf5:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804cfc:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804d00:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d09:	48 89 ce             	mov    %rcx,%rsi
+  804d0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d11:	48 b8 5d 28 80 00 00 	movabs $0x80285d,%rax
+  804d18:	00 00 00 
+  804d1b:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804d1d:	85 c0                	test   %eax,%eax
+  804d1f:	78 0d                	js     804d2e <mmap_writeback+0x123>
+  804d21:	49 89 dc             	mov    %rbx,%r12
+  804d24:	e9 49 ff ff ff       	jmp    804c72 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804d29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d2e:	48 83 c4 28          	add    $0x28,%rsp
+  804d32:	5b                   	pop    %rbx
+  804d33:	41 5c                	pop    %r12
+  804d35:	41 5d                	pop    %r13
+  804d37:	41 5e                	pop    %r14
+  804d39:	41 5f                	pop    %r15
+  804d3b:	5d                   	pop    %rbp
+  804d3c:	c3                   	ret
+    return 0;
+  804d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d42:	eb ea                	jmp    804d2e <mmap_writeback+0x123>
+
+0000000000804d44 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804d44:	55                   	push   %rbp
+  804d45:	48 89 e5             	mov    %rsp,%rbp
+  804d48:	41 57                	push   %r15
+  804d4a:	41 56                	push   %r14
+  804d4c:	41 55                	push   %r13
+  804d4e:	41 54                	push   %r12
+  804d50:	53                   	push   %rbx
+  804d51:	48 83 ec 38          	sub    $0x38,%rsp
+  804d55:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804d59:	48 85 f6             	test   %rsi,%rsi
+  804d5c:	0f 84 0c 02 00 00    	je     804f6e <mmap+0x22a>
+  804d62:	49 89 ff             	mov    %rdi,%r15
+  804d65:	49 89 f4             	mov    %rsi,%r12
+  804d68:	41 89 d5             	mov    %edx,%r13d
+  804d6b:	41 89 ce             	mov    %ecx,%r14d
+  804d6e:	44 89 cb             	mov    %r9d,%ebx
+  804d71:	45 85 c9             	test   %r9d,%r9d
+  804d74:	0f 88 f4 01 00 00    	js     804f6e <mmap+0x22a>
+  804d7a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d81:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804d88:	0f 85 e7 01 00 00    	jne    804f75 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804d8e:	83 e2 fd             	and    $0xfffffffd,%edx
+  804d91:	83 fa 04             	cmp    $0x4,%edx
+  804d94:	0f 85 db 01 00 00    	jne    804f75 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804d9a:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804d9d:	83 fa 01             	cmp    $0x1,%edx
+  804da0:	0f 87 cf 01 00 00    	ja     804f75 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804da6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804daa:	44 89 c7             	mov    %r8d,%edi
+  804dad:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  804db4:	00 00 00 
+  804db7:	ff d0                	call   *%rax
+  804db9:	89 c2                	mov    %eax,%edx
+  804dbb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804dc2:	85 d2                	test   %edx,%edx
+  804dc4:	0f 88 ab 01 00 00    	js     804f75 <mmap+0x231>
+  804dca:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804dce:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804dd5:	00 00 00 
+  804dd8:	8b 09                	mov    (%rcx),%ecx
+  804dda:	39 0a                	cmp    %ecx,(%rdx)
+  804ddc:	0f 85 93 01 00 00    	jne    804f75 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804de2:	8b 52 08             	mov    0x8(%rdx),%edx
+  804de5:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804de8:	83 fa 01             	cmp    $0x1,%edx
+  804deb:	0f 84 84 01 00 00    	je     804f75 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804df1:	41 83 fe 01          	cmp    $0x1,%r14d
+  804df5:	74 42                	je     804e39 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804df7:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804dfe:	4c 89 e6             	mov    %r12,%rsi
+  804e01:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804e08:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804e0c:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804e10:	4d 85 ff             	test   %r15,%r15
+  804e13:	74 67                	je     804e7c <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e15:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804e1c:	75 0f                	jne    804e2d <mmap+0xe9>
+  804e1e:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804e25:	00 00 00 
+  804e28:	49 39 c7             	cmp    %rax,%r15
+  804e2b:	77 1b                	ja     804e48 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e2d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e34:	e9 3c 01 00 00       	jmp    804f75 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e39:	41 f6 c5 02          	test   $0x2,%r13b
+  804e3d:	74 b8                	je     804df7 <mmap+0xb3>
+  804e3f:	85 d2                	test   %edx,%edx
+  804e41:	75 b4                	jne    804df7 <mmap+0xb3>
+  804e43:	e9 2d 01 00 00       	jmp    804f75 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e48:	4c 89 ff             	mov    %r15,%rdi
+  804e4b:	48 b8 b2 49 80 00 00 	movabs $0x8049b2,%rax
+  804e52:	00 00 00 
+  804e55:	ff d0                	call   *%rax
+  804e57:	48 89 c2             	mov    %rax,%rdx
+  804e5a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e61:	49 39 d7             	cmp    %rdx,%r15
+  804e64:	0f 85 0b 01 00 00    	jne    804f75 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804e6a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e71:	00 00 00 
+  804e74:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e7a:	eb 44                	jmp    804ec0 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804e7c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804e80:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804e87:	00 00 00 
+  804e8a:	48 b8 b2 49 80 00 00 	movabs $0x8049b2,%rax
+  804e91:	00 00 00 
+  804e94:	ff d0                	call   *%rax
+  804e96:	48 89 c7             	mov    %rax,%rdi
+  804e99:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804e9d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804ea4:	48 85 ff             	test   %rdi,%rdi
+  804ea7:	75 c1                	jne    804e6a <mmap+0x126>
+  804ea9:	e9 c7 00 00 00       	jmp    804f75 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804eae:	49 83 c4 01          	add    $0x1,%r12
+  804eb2:	48 83 c0 20          	add    $0x20,%rax
+  804eb6:	49 83 fc 20          	cmp    $0x20,%r12
+  804eba:	0f 84 a5 00 00 00    	je     804f65 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804ec0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804ec4:	75 e8                	jne    804eae <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804ec6:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804eca:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  804ed1:	00 00 00 
+  804ed4:	ff d0                	call   *%rax
+  804ed6:	89 c2                	mov    %eax,%edx
+  804ed8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804edf:	85 d2                	test   %edx,%edx
+  804ee1:	0f 88 8e 00 00 00    	js     804f75 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804ee7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804eeb:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  804ef2:	00 00 00 
+  804ef5:	ff d0                	call   *%rax
+  804ef7:	89 c6                	mov    %eax,%esi
+  804ef9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804efc:	48 b8 1e 33 80 00 00 	movabs $0x80331e,%rax
+  804f03:	00 00 00 
+  804f06:	ff d0                	call   *%rax
+  804f08:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804f0b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f12:	45 85 ff             	test   %r15d,%r15d
+  804f15:	78 5e                	js     804f75 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804f17:	49 c1 e4 05          	shl    $0x5,%r12
+  804f1b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804f22:	00 00 00 
+  804f25:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804f28:	48 bf 23 4a 80 00 00 	movabs $0x804a23,%rdi
+  804f2f:	00 00 00 
+  804f32:	48 b8 f1 54 80 00 00 	movabs $0x8054f1,%rax
+  804f39:	00 00 00 
+  804f3c:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804f3e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f42:	49 89 04 24          	mov    %rax,(%r12)
+  804f46:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804f4a:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804f4f:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804f54:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804f59:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804f5e:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804f63:	eb 10                	jmp    804f75 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804f65:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f6c:	eb 07                	jmp    804f75 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f6e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804f75:	48 83 c4 38          	add    $0x38,%rsp
+  804f79:	5b                   	pop    %rbx
+  804f7a:	41 5c                	pop    %r12
+  804f7c:	41 5d                	pop    %r13
+  804f7e:	41 5e                	pop    %r14
+  804f80:	41 5f                	pop    %r15
+  804f82:	5d                   	pop    %rbp
+  804f83:	c3                   	ret
+
+0000000000804f84 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804f84:	55                   	push   %rbp
+  804f85:	48 89 e5             	mov    %rsp,%rbp
+  804f88:	41 57                	push   %r15
+  804f8a:	41 56                	push   %r14
+  804f8c:	41 55                	push   %r13
+  804f8e:	41 54                	push   %r12
+  804f90:	53                   	push   %rbx
+  804f91:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804f95:	49 89 fe             	mov    %rdi,%r14
+  804f98:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f9f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804fa6:	00 
+  804fa7:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fae:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804fb5:	00 00 00 
+  804fb8:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804fbf:	49 bf 0b 4c 80 00 00 	movabs $0x804c0b,%r15
+  804fc6:	00 00 00 
+  804fc9:	eb 09                	jmp    804fd4 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fcb:	48 83 c3 20          	add    $0x20,%rbx
+  804fcf:	4c 39 eb             	cmp    %r13,%rbx
+  804fd2:	74 33                	je     805007 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804fd4:	48 89 df             	mov    %rbx,%rdi
+  804fd7:	48 8b 33             	mov    (%rbx),%rsi
+  804fda:	4c 39 e6             	cmp    %r12,%rsi
+  804fdd:	73 ec                	jae    804fcb <msync+0x47>
+  804fdf:	48 85 f6             	test   %rsi,%rsi
+  804fe2:	74 e7                	je     804fcb <msync+0x47>
+  804fe4:	48 89 f2             	mov    %rsi,%rdx
+  804fe7:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804feb:	49 39 d6             	cmp    %rdx,%r14
+  804fee:	73 db                	jae    804fcb <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ff0:	4c 39 e2             	cmp    %r12,%rdx
+  804ff3:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ff7:	4c 39 f6             	cmp    %r14,%rsi
+  804ffa:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ffe:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805001:	85 c0                	test   %eax,%eax
+  805003:	79 c6                	jns    804fcb <msync+0x47>
+  805005:	eb 05                	jmp    80500c <msync+0x88>
+    }
+
+    return 0;
+  805007:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80500c:	48 83 c4 08          	add    $0x8,%rsp
+  805010:	5b                   	pop    %rbx
+  805011:	41 5c                	pop    %r12
+  805013:	41 5d                	pop    %r13
+  805015:	41 5e                	pop    %r14
+  805017:	41 5f                	pop    %r15
+  805019:	5d                   	pop    %rbp
+  80501a:	c3                   	ret
+
+000000000080501b <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  80501b:	55                   	push   %rbp
+  80501c:	48 89 e5             	mov    %rsp,%rbp
+  80501f:	41 57                	push   %r15
+  805021:	41 56                	push   %r14
+  805023:	41 55                	push   %r13
+  805025:	41 54                	push   %r12
+  805027:	53                   	push   %rbx
+  805028:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80502c:	49 89 ff             	mov    %rdi,%r15
+  80502f:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805036:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80503d:	00 
+  80503e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805045:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80504c:	00 00 00 
+  80504f:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805056:	48 89 d8             	mov    %rbx,%rax
+  805059:	eb 09                	jmp    805064 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80505b:	48 83 c0 20          	add    $0x20,%rax
+  80505f:	4c 39 f0             	cmp    %r14,%rax
+  805062:	74 40                	je     8050a4 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805064:	48 8b 10             	mov    (%rax),%rdx
+  805067:	4c 39 e2             	cmp    %r12,%rdx
+  80506a:	73 ef                	jae    80505b <munmap+0x40>
+  80506c:	48 85 d2             	test   %rdx,%rdx
+  80506f:	74 ea                	je     80505b <munmap+0x40>
+  805071:	48 89 d7             	mov    %rdx,%rdi
+  805074:	48 03 78 08          	add    0x8(%rax),%rdi
+  805078:	49 39 ff             	cmp    %rdi,%r15
+  80507b:	73 de                	jae    80505b <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  80507d:	49 39 fc             	cmp    %rdi,%r12
+  805080:	72 05                	jb     805087 <munmap+0x6c>
+  805082:	4c 39 fa             	cmp    %r15,%rdx
+  805085:	73 d4                	jae    80505b <munmap+0x40>
+  805087:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80508c:	48 83 c4 08          	add    $0x8,%rsp
+  805090:	5b                   	pop    %rbx
+  805091:	41 5c                	pop    %r12
+  805093:	41 5d                	pop    %r13
+  805095:	41 5e                	pop    %r14
+  805097:	41 5f                	pop    %r15
+  805099:	5d                   	pop    %rbp
+  80509a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80509b:	48 83 c3 20          	add    $0x20,%rbx
+  80509f:	4c 39 f3             	cmp    %r14,%rbx
+  8050a2:	74 5c                	je     805100 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8050a4:	48 8b 33             	mov    (%rbx),%rsi
+  8050a7:	4c 39 e6             	cmp    %r12,%rsi
+  8050aa:	73 ef                	jae    80509b <munmap+0x80>
+  8050ac:	48 85 f6             	test   %rsi,%rsi
+  8050af:	74 ea                	je     80509b <munmap+0x80>
+  8050b1:	48 89 f2             	mov    %rsi,%rdx
+  8050b4:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8050b8:	49 39 d7             	cmp    %rdx,%r15
+  8050bb:	73 de                	jae    80509b <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8050bd:	48 89 df             	mov    %rbx,%rdi
+  8050c0:	48 b8 0b 4c 80 00 00 	movabs $0x804c0b,%rax
+  8050c7:	00 00 00 
+  8050ca:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8050cc:	85 c0                	test   %eax,%eax
+  8050ce:	78 bc                	js     80508c <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8050d0:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8050d4:	48 8b 33             	mov    (%rbx),%rsi
+  8050d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050dc:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  8050e3:	00 00 00 
+  8050e6:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8050e8:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8050eb:	48 b8 c3 32 80 00 00 	movabs $0x8032c3,%rax
+  8050f2:	00 00 00 
+  8050f5:	ff d0                	call   *%rax
+        reg->start = 0;
+  8050f7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8050fe:	eb 9b                	jmp    80509b <munmap+0x80>
+    return 0;
+  805100:	b8 00 00 00 00       	mov    $0x0,%eax
+  805105:	eb 85                	jmp    80508c <munmap+0x71>
+
+0000000000805107 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80510c:	c3                   	ret
+
+000000000080510d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80510d:	55                   	push   %rbp
+  80510e:	48 89 e5             	mov    %rsp,%rbp
+  805111:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805114:	48 be 05 64 80 00 00 	movabs $0x806405,%rsi
+  80511b:	00 00 00 
+  80511e:	48 b8 8b 20 80 00 00 	movabs $0x80208b,%rax
+  805125:	00 00 00 
+  805128:	ff d0                	call   *%rax
+    return 0;
+}
+  80512a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80512f:	5d                   	pop    %rbp
+  805130:	c3                   	ret
+
+0000000000805131 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805131:	55                   	push   %rbp
+  805132:	48 89 e5             	mov    %rsp,%rbp
+  805135:	41 57                	push   %r15
+  805137:	41 56                	push   %r14
+  805139:	41 55                	push   %r13
+  80513b:	41 54                	push   %r12
+  80513d:	53                   	push   %rbx
+  80513e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805145:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80514c:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805153:	00 00 00 00 
+  805157:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  80515e:	00 00 00 00 
+  805162:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805169:	00 00 00 00 
+  80516d:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805174:	00 00 00 00 
+  805178:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  80517f:	00 00 00 00 
+  805183:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  80518a:	00 00 00 00 
+  80518e:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805195:	00 
+  805196:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  80519d:	00 
+  80519e:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8051a5:	00 
+  8051a6:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8051ad:	00 
+  8051ae:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8051b5:	00 
+  8051b6:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8051bd:	00 
+  8051be:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8051c5:	00 
+  8051c6:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8051cd:	00 
+  8051ce:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8051d5:	00 
+  8051d6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8051dd:	00 
+    for (res = 0; res < n; res += inc) {
+  8051de:	48 85 d2             	test   %rdx,%rdx
+  8051e1:	74 7a                	je     80525d <devcons_write+0x12c>
+  8051e3:	49 89 d6             	mov    %rdx,%r14
+  8051e6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8051ec:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8051f1:	49 bf db 23 80 00 00 	movabs $0x8023db,%r15
+  8051f8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8051fb:	4c 89 f3             	mov    %r14,%rbx
+  8051fe:	48 29 f3             	sub    %rsi,%rbx
+  805201:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805206:	48 39 c3             	cmp    %rax,%rbx
+  805209:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80520d:	4c 63 eb             	movslq %ebx,%r13
+  805210:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805217:	48 01 c6             	add    %rax,%rsi
+  80521a:	4c 89 ea             	mov    %r13,%rdx
+  80521d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805224:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805227:	4c 89 ee             	mov    %r13,%rsi
+  80522a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805231:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  805238:	00 00 00 
+  80523b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80523d:	41 01 dc             	add    %ebx,%r12d
+  805240:	49 63 f4             	movslq %r12d,%rsi
+  805243:	4c 39 f6             	cmp    %r14,%rsi
+  805246:	72 b3                	jb     8051fb <devcons_write+0xca>
+    return res;
+  805248:	49 63 c4             	movslq %r12d,%rax
+}
+  80524b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805252:	5b                   	pop    %rbx
+  805253:	41 5c                	pop    %r12
+  805255:	41 5d                	pop    %r13
+  805257:	41 5e                	pop    %r14
+  805259:	41 5f                	pop    %r15
+  80525b:	5d                   	pop    %rbp
+  80525c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80525d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805263:	eb e3                	jmp    805248 <devcons_write+0x117>
+
+0000000000805265 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805265:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805268:	ba 00 00 00 00       	mov    $0x0,%edx
+  80526d:	48 85 c0             	test   %rax,%rax
+  805270:	74 55                	je     8052c7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805272:	55                   	push   %rbp
+  805273:	48 89 e5             	mov    %rsp,%rbp
+  805276:	41 55                	push   %r13
+  805278:	41 54                	push   %r12
+  80527a:	53                   	push   %rbx
+  80527b:	48 83 ec 08          	sub    $0x8,%rsp
+  80527f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805282:	48 bb 3b 26 80 00 00 	movabs $0x80263b,%rbx
+  805289:	00 00 00 
+  80528c:	49 bc 4f 27 80 00 00 	movabs $0x80274f,%r12
+  805293:	00 00 00 
+  805296:	eb 03                	jmp    80529b <devcons_read+0x36>
+  805298:	41 ff d4             	call   *%r12
+  80529b:	ff d3                	call   *%rbx
+  80529d:	85 c0                	test   %eax,%eax
+  80529f:	74 f7                	je     805298 <devcons_read+0x33>
+    if (c < 0) return c;
+  8052a1:	48 63 d0             	movslq %eax,%rdx
+  8052a4:	78 13                	js     8052b9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8052a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052ab:	83 f8 04             	cmp    $0x4,%eax
+  8052ae:	74 09                	je     8052b9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8052b0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8052b4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8052b9:	48 89 d0             	mov    %rdx,%rax
+  8052bc:	48 83 c4 08          	add    $0x8,%rsp
+  8052c0:	5b                   	pop    %rbx
+  8052c1:	41 5c                	pop    %r12
+  8052c3:	41 5d                	pop    %r13
+  8052c5:	5d                   	pop    %rbp
+  8052c6:	c3                   	ret
+  8052c7:	48 89 d0             	mov    %rdx,%rax
+  8052ca:	c3                   	ret
+
+00000000008052cb <cputchar>:
+cputchar(int ch) {
+  8052cb:	55                   	push   %rbp
+  8052cc:	48 89 e5             	mov    %rsp,%rbp
+  8052cf:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8052d3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8052d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8052dc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8052e0:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  8052e7:	00 00 00 
+  8052ea:	ff d0                	call   *%rax
+}
+  8052ec:	c9                   	leave
+  8052ed:	c3                   	ret
+
+00000000008052ee <getchar>:
+getchar(void) {
+  8052ee:	55                   	push   %rbp
+  8052ef:	48 89 e5             	mov    %rsp,%rbp
+  8052f2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8052f6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8052fb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8052ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805304:	48 b8 41 34 80 00 00 	movabs $0x803441,%rax
+  80530b:	00 00 00 
+  80530e:	ff d0                	call   *%rax
+  805310:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805312:	85 c0                	test   %eax,%eax
+  805314:	78 06                	js     80531c <getchar+0x2e>
+  805316:	74 08                	je     805320 <getchar+0x32>
+  805318:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80531c:	89 d0                	mov    %edx,%eax
+  80531e:	c9                   	leave
+  80531f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805320:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805325:	eb f5                	jmp    80531c <getchar+0x2e>
+
+0000000000805327 <iscons>:
+iscons(int fdnum) {
+  805327:	55                   	push   %rbp
+  805328:	48 89 e5             	mov    %rsp,%rbp
+  80532b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80532f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805333:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  80533a:	00 00 00 
+  80533d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80533f:	85 c0                	test   %eax,%eax
+  805341:	78 18                	js     80535b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805343:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805347:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80534e:	00 00 00 
+  805351:	8b 00                	mov    (%rax),%eax
+  805353:	39 02                	cmp    %eax,(%rdx)
+  805355:	0f 94 c0             	sete   %al
+  805358:	0f b6 c0             	movzbl %al,%eax
+}
+  80535b:	c9                   	leave
+  80535c:	c3                   	ret
+
+000000000080535d <opencons>:
+opencons(void) {
+  80535d:	55                   	push   %rbp
+  80535e:	48 89 e5             	mov    %rsp,%rbp
+  805361:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805365:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805369:	48 b8 fe 30 80 00 00 	movabs $0x8030fe,%rax
+  805370:	00 00 00 
+  805373:	ff d0                	call   *%rax
+  805375:	85 c0                	test   %eax,%eax
+  805377:	78 49                	js     8053c2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805379:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80537e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805383:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805387:	bf 00 00 00 00       	mov    $0x0,%edi
+  80538c:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  805393:	00 00 00 
+  805396:	ff d0                	call   *%rax
+  805398:	85 c0                	test   %eax,%eax
+  80539a:	78 26                	js     8053c2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80539c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053a0:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8053a7:	00 00 
+  8053a9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8053ab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8053af:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8053b6:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  8053bd:	00 00 00 
+  8053c0:	ff d0                	call   *%rax
+}
+  8053c2:	c9                   	leave
+  8053c3:	c3                   	ret
+
+00000000008053c4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8053c4:	55                   	push   %rbp
+  8053c5:	48 89 e5             	mov    %rsp,%rbp
+  8053c8:	41 56                	push   %r14
+  8053ca:	41 55                	push   %r13
+  8053cc:	41 54                	push   %r12
+  8053ce:	53                   	push   %rbx
+  8053cf:	48 83 ec 50          	sub    $0x50,%rsp
+  8053d3:	49 89 fc             	mov    %rdi,%r12
+  8053d6:	41 89 f5             	mov    %esi,%r13d
+  8053d9:	48 89 d3             	mov    %rdx,%rbx
+  8053dc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8053e0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8053e4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8053e8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8053ef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8053f3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8053f7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8053fb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8053ff:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  805406:	00 00 00 
+  805409:	4c 8b 30             	mov    (%rax),%r14
+  80540c:	48 b8 18 27 80 00 00 	movabs $0x802718,%rax
+  805413:	00 00 00 
+  805416:	ff d0                	call   *%rax
+  805418:	89 c6                	mov    %eax,%esi
+  80541a:	45 89 e8             	mov    %r13d,%r8d
+  80541d:	4c 89 e1             	mov    %r12,%rcx
+  805420:	4c 89 f2             	mov    %r14,%rdx
+  805423:	48 bf 18 64 80 00 00 	movabs $0x806418,%rdi
+  80542a:	00 00 00 
+  80542d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805432:	49 bc 54 17 80 00 00 	movabs $0x801754,%r12
+  805439:	00 00 00 
+  80543c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80543f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805443:	48 89 df             	mov    %rbx,%rdi
+  805446:	48 b8 f0 16 80 00 00 	movabs $0x8016f0,%rax
+  80544d:	00 00 00 
+  805450:	ff d0                	call   *%rax
+    cprintf("\n");
+  805452:	48 bf eb 62 80 00 00 	movabs $0x8062eb,%rdi
+  805459:	00 00 00 
+  80545c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805461:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805464:	cc                   	int3
+  805465:	eb fd                	jmp    805464 <_panic+0xa0>
+
+0000000000805467 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805467:	55                   	push   %rbp
+  805468:	48 89 e5             	mov    %rsp,%rbp
+  80546b:	41 56                	push   %r14
+  80546d:	41 55                	push   %r13
+  80546f:	41 54                	push   %r12
+  805471:	53                   	push   %rbx
+  805472:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805475:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80547c:	00 00 00 
+  80547f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805483:	74 27                	je     8054ac <_handle_vectored_pagefault+0x45>
+  805485:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80548a:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805491:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805494:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805497:	4c 89 e7             	mov    %r12,%rdi
+  80549a:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80549f:	84 c0                	test   %al,%al
+  8054a1:	75 45                	jne    8054e8 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054a3:	48 83 c3 01          	add    $0x1,%rbx
+  8054a7:	49 3b 1e             	cmp    (%r14),%rbx
+  8054aa:	72 eb                	jb     805497 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8054ac:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8054b3:	00 
+  8054b4:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8054b9:	4d 8b 04 24          	mov    (%r12),%r8
+  8054bd:	48 ba 40 64 80 00 00 	movabs $0x806440,%rdx
+  8054c4:	00 00 00 
+  8054c7:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8054cc:	48 bf 70 64 80 00 00 	movabs $0x806470,%rdi
+  8054d3:	00 00 00 
+  8054d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054db:	49 ba c4 53 80 00 00 	movabs $0x8053c4,%r10
+  8054e2:	00 00 00 
+  8054e5:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8054e8:	5b                   	pop    %rbx
+  8054e9:	41 5c                	pop    %r12
+  8054eb:	41 5d                	pop    %r13
+  8054ed:	41 5e                	pop    %r14
+  8054ef:	5d                   	pop    %rbp
+  8054f0:	c3                   	ret
+
+00000000008054f1 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8054f1:	55                   	push   %rbp
+  8054f2:	48 89 e5             	mov    %rsp,%rbp
+  8054f5:	53                   	push   %rbx
+  8054f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8054fa:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8054fd:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805502:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805509:	00 00 00 
+  80550c:	80 38 00             	cmpb   $0x0,(%rax)
+  80550f:	74 68                	je     805579 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805511:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805518:	00 00 00 
+  80551b:	48 8b 08             	mov    (%rax),%rcx
+  80551e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805523:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80552a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80552d:	48 85 c9             	test   %rcx,%rcx
+  805530:	0f 84 e0 00 00 00    	je     805616 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805536:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80553a:	0f 84 c9 00 00 00    	je     805609 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805540:	48 83 c2 01          	add    $0x1,%rdx
+  805544:	48 39 ca             	cmp    %rcx,%rdx
+  805547:	75 ed                	jne    805536 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805549:	48 83 f9 08          	cmp    $0x8,%rcx
+  80554d:	0f 84 84 00 00 00    	je     8055d7 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805553:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805557:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80555e:	00 00 00 
+  805561:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805568:	00 00 00 
+  80556b:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80556f:	85 f6                	test   %esi,%esi
+  805571:	0f 89 97 00 00 00    	jns    80560e <add_pgfault_handler+0x11d>
+  805577:	eb 63                	jmp    8055dc <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805579:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80557e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805583:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80558a:	00 00 00 
+  80558d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805592:	48 b8 f0 27 80 00 00 	movabs $0x8027f0,%rax
+  805599:	00 00 00 
+  80559c:	ff d0                	call   *%rax
+  80559e:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8055a0:	85 c0                	test   %eax,%eax
+  8055a2:	78 38                	js     8055dc <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8055a4:	48 be f2 56 80 00 00 	movabs $0x8056f2,%rsi
+  8055ab:	00 00 00 
+  8055ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055b3:	48 b8 13 2a 80 00 00 	movabs $0x802a13,%rax
+  8055ba:	00 00 00 
+  8055bd:	ff d0                	call   *%rax
+  8055bf:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8055c1:	85 c0                	test   %eax,%eax
+  8055c3:	78 17                	js     8055dc <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8055c5:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8055cc:	00 00 00 
+  8055cf:	c6 00 01             	movb   $0x1,(%rax)
+  8055d2:	e9 3a ff ff ff       	jmp    805511 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8055d7:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8055dc:	89 f1                	mov    %esi,%ecx
+  8055de:	48 ba 7e 64 80 00 00 	movabs $0x80647e,%rdx
+  8055e5:	00 00 00 
+  8055e8:	be 42 00 00 00       	mov    $0x42,%esi
+  8055ed:	48 bf 70 64 80 00 00 	movabs $0x806470,%rdi
+  8055f4:	00 00 00 
+  8055f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055fc:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  805603:	00 00 00 
+  805606:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805609:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  80560e:	89 f0                	mov    %esi,%eax
+  805610:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805614:	c9                   	leave
+  805615:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805616:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80561d:	00 00 00 
+  805620:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805627:	48 89 d8             	mov    %rbx,%rax
+  80562a:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805631:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805634:	eb d8                	jmp    80560e <add_pgfault_handler+0x11d>
+
+0000000000805636 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805636:	55                   	push   %rbp
+  805637:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80563a:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805641:	00 00 00 
+  805644:	80 38 00             	cmpb   $0x0,(%rax)
+  805647:	74 33                	je     80567c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805649:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805650:	00 00 00 
+  805653:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805658:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80565f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805662:	48 85 c0             	test   %rax,%rax
+  805665:	0f 84 85 00 00 00    	je     8056f0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80566b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80566f:	74 40                	je     8056b1 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805671:	48 83 c1 01          	add    $0x1,%rcx
+  805675:	48 39 c1             	cmp    %rax,%rcx
+  805678:	75 f1                	jne    80566b <remove_pgfault_handler+0x35>
+  80567a:	eb 74                	jmp    8056f0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80567c:	48 b9 96 64 80 00 00 	movabs $0x806496,%rcx
+  805683:	00 00 00 
+  805686:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  80568d:	00 00 00 
+  805690:	be 48 00 00 00       	mov    $0x48,%esi
+  805695:	48 bf 70 64 80 00 00 	movabs $0x806470,%rdi
+  80569c:	00 00 00 
+  80569f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056a4:	49 b8 c4 53 80 00 00 	movabs $0x8053c4,%r8
+  8056ab:	00 00 00 
+  8056ae:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8056b1:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8056b8:	00 
+  8056b9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8056bd:	48 29 ca             	sub    %rcx,%rdx
+  8056c0:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8056c7:	00 00 00 
+  8056ca:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8056ce:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8056d3:	48 89 ce             	mov    %rcx,%rsi
+  8056d6:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  8056dd:	00 00 00 
+  8056e0:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8056e2:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056e9:	00 00 00 
+  8056ec:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8056f0:	5d                   	pop    %rbp
+  8056f1:	c3                   	ret
+
+00000000008056f2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8056f2:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8056f5:	48 b8 67 54 80 00 00 	movabs $0x805467,%rax
+  8056fc:	00 00 00 
+    call *%rax
+  8056ff:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805701:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805708:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805709:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805710:	00 
+    subq $8, %rcx
+  805711:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805715:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805718:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80571f:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805720:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805724:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805728:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80572d:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805732:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805737:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80573c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805741:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805746:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80574b:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805750:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805755:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80575a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80575f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805764:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805769:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80576e:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805772:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805776:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805777:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805778:	c3                   	ret
+  805779:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000805780 <__rodata_start>:
+  805780:	77 00                	ja     805782 <__rodata_start+0x2>
+  805782:	72 62                	jb     8057e6 <__rodata_start+0x66>
+  805784:	00 77 62             	add    %dh,0x62(%rdi)
+  805787:	00 66 2e             	add    %ah,0x2e(%rsi)
+  80578a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805791:	00 
+  805792:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805799:	00 00 00 
+  80579c:	0f 1f 40 00          	nopl   0x0(%rax)
+  8057a0:	b3 09                	mov    $0x9,%bl
+  8057a2:	80 00 00             	addb   $0x0,(%rax)
+  8057a5:	00 00                	add    %al,(%rax)
+  8057a7:	00 ed                	add    %ch,%ch
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8057cd:	00 00                	add    %al,(%rax)
+  8057cf:	00 ed                	add    %ch,%ch
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	8c 0a                	mov    %cs,(%rdx)
+  8057fa:	80 00 00             	addb   $0x0,(%rax)
+  8057fd:	00 00                	add    %al,(%rax)
+  8057ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805806:	00 00                	add    %al,(%rax)
+  805808:	8c 0a                	mov    %cs,(%rdx)
+  80580a:	80 00 00             	addb   $0x0,(%rax)
+  80580d:	00 00                	add    %al,(%rax)
+  80580f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805816:	00 00                	add    %al,(%rax)
+  805818:	8c 0a                	mov    %cs,(%rdx)
+  80581a:	80 00 00             	addb   $0x0,(%rax)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805826:	00 00                	add    %al,(%rax)
+  805828:	8c 0a                	mov    %cs,(%rdx)
+  80582a:	80 00 00             	addb   $0x0,(%rax)
+  80582d:	00 00                	add    %al,(%rax)
+  80582f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805836:	00 00                	add    %al,(%rax)
+  805838:	8c 0a                	mov    %cs,(%rdx)
+  80583a:	80 00 00             	addb   $0x0,(%rax)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	f4                   	hlt
+  805939:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80593f:	00 ed                	add    %ch,%ch
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	2c 0b                	sub    $0xb,%al
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805993:	00 00                	add    %al,(%rax)
+  805995:	00 00                	add    %al,(%rax)
+  805997:	00 cb                	add    %cl,%bl
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	6a 0a                	push   $0xa
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 ed                	add    %ch,%ch
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	3c 0a                	cmp    $0xa,%al
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 ed                	add    %ch,%ch
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  8059eb:	00 00                	add    %al,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 29                	add    %ch,(%rcx)
+  8059f9:	0c 80                	or     $0x80,%al
+  8059fb:	00 00                	add    %al,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 ed                	add    %ch,%ch
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	1a 0b                	sbb    (%rbx),%cl
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 ed                	add    %ch,%ch
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ce                   	(bad)
+  805a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a27:	00 ed                	add    %ch,%ch
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	f4                   	hlt
+  805a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a3f:	00 37                	add    %dh,(%rdi)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 37                	add    %dh,(%rdi)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805a6b:	00 00                	add    %al,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 d2                	add    %dl,%dl
+  805a71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a77:	00 d2                	add    %dl,%dl
+  805a79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a7f:	00 d2                	add    %dl,%dl
+  805a81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a87:	00 d2                	add    %dl,%dl
+  805a89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a8f:	00 d2                	add    %dl,%dl
+  805a91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a97:	00 d2                	add    %dl,%dl
+  805a99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a9f:	00 d2                	add    %dl,%dl
+  805aa1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aa7:	00 f6                	add    %dh,%dh
+  805aa9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aaf:	00 f6                	add    %dh,%dh
+  805ab1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 22                	add    %ah,(%rdx)
+  805af1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805af7:	00 22                	add    %ah,(%rdx)
+  805af9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805aff:	00 22                	add    %ah,(%rdx)
+  805b01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b07:	00 22                	add    %ah,(%rdx)
+  805b09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 46 12             	add    %al,0x12(%rsi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 22                	add    %ah,(%rdx)
+  805bf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bf7:	00 22                	add    %ah,(%rdx)
+  805bf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bff:	00 22                	add    %ah,(%rdx)
+  805c01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c07:	00 22                	add    %ah,(%rdx)
+  805c09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c0f:	00 22                	add    %ah,(%rdx)
+  805c11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c17:	00 22                	add    %ah,(%rdx)
+  805c19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 46 12             	add    %al,0x12(%rsi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805cc0 <basefix.0>:
+  805cc0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805cd0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805ce0:	10 00 25 78 20 72 65 63 76 20 66 72 6f 6d 20 25     ..%x recv from %
+  805cf0:	78 0a 00 25 78 20 6c 6f 6f 70 20 73 65 6e 64 69     x..%x loop sendi
+  805d00:	6e 67 20 74 6f 20 25 78 0a 00 3c 75 6e 6b 6e 6f     ng to %x..<unkno
+  805d10:	77 6e 3e 00 30 31 32 33 34 35 36 37 38 39 41 42     wn>.0123456789AB
+  805d20:	43 44 45 46 00 30 31 32 33 34 35 36 37 38 39 61     CDEF.0123456789a
+  805d30:	62 63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72     bcdef.(null).err
+  805d40:	6f 72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65     or %d.unspecifie
+  805d50:	64 20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69     d error.bad envi
+  805d60:	72 6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20     ronment.invalid 
+  805d70:	70 61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66     parameter.out of
+  805d80:	20 6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65      memory.out of e
+  805d90:	6e 76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72     nvironments.corr
+  805da0:	75 70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f     upted debug info
+  805db0:	00 73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61     .segmentation fa
+  805dc0:	75 6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20     ult.invalid ELF 
+  805dd0:	69 6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79     image.no such sy
+  805de0:	73 74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20     stem call.entry 
+  805df0:	6e 6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73     not found.env is
+  805e00:	20 6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65      not recving.une
+  805e10:	78 70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66     xpected end of f
+  805e20:	69 6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63     ile.no free spac
+  805e30:	65 20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61     e on disk.too ma
+  805e40:	6e 79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65     ny files are ope
+  805e50:	6e 00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20     n.file or block 
+  805e60:	6e 6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69     not found.invali
+  805e70:	64 20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65     d path.file alre
+  805e80:	61 64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61     ady exists.opera
+  805e90:	74 69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74     tion not support
+  805ea0:	65 64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ed.f.........f..
+  805eb0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
+  805ec0:	4c 19 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     L...............
+  805ed0:	93 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805ee0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805ef0:	a3 1f 80 00 00 00 00 00 6b 19 80 00 00 00 00 00     ........k.......
+  805f00:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805f10:	5f 19 80 00 00 00 00 00 d9 19 80 00 00 00 00 00     _...............
+  805f20:	a3 1f 80 00 00 00 00 00 5f 19 80 00 00 00 00 00     ........_.......
+  805f30:	a5 19 80 00 00 00 00 00 a5 19 80 00 00 00 00 00     ................
+  805f40:	a5 19 80 00 00 00 00 00 a5 19 80 00 00 00 00 00     ................
+  805f50:	a5 19 80 00 00 00 00 00 a5 19 80 00 00 00 00 00     ................
+  805f60:	a5 19 80 00 00 00 00 00 a5 19 80 00 00 00 00 00     ................
+  805f70:	a5 19 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805f80:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805f90:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805fa0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805fb0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805fc0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805fd0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805fe0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  805ff0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806000:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806010:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806020:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806030:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806040:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806050:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806060:	a3 1f 80 00 00 00 00 00 c1 1e 80 00 00 00 00 00     ................
+  806070:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806080:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806090:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  8060a0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  8060b0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  8060c0:	07 1a 80 00 00 00 00 00 d6 1b 80 00 00 00 00 00     ................
+  8060d0:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  8060e0:	a3 1f 80 00 00 00 00 00 fc 19 80 00 00 00 00 00     ................
+  8060f0:	36 1a 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     6...............
+  806100:	a3 1f 80 00 00 00 00 00 f1 19 80 00 00 00 00 00     ................
+  806110:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806120:	7f 1d 80 00 00 00 00 00 4e 1e 80 00 00 00 00 00     ........N.......
+  806130:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806140:	cd 1a 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806150:	aa 1c 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  806160:	a3 1f 80 00 00 00 00 00 c1 1e 80 00 00 00 00 00     ................
+  806170:	a3 1f 80 00 00 00 00 00 55 19 80 00 00 00 00 00     ........U.......
+
+0000000000806180 <error_string>:
+	...
+  806188:	46 5d 80 00 00 00 00 00 58 5d 80 00 00 00 00 00     F]......X]......
+  806198:	68 5d 80 00 00 00 00 00 7a 5d 80 00 00 00 00 00     h]......z]......
+  8061a8:	88 5d 80 00 00 00 00 00 9c 5d 80 00 00 00 00 00     .].......]......
+  8061b8:	b1 5d 80 00 00 00 00 00 c4 5d 80 00 00 00 00 00     .].......]......
+  8061c8:	d6 5d 80 00 00 00 00 00 ea 5d 80 00 00 00 00 00     .].......]......
+  8061d8:	fa 5d 80 00 00 00 00 00 0d 5e 80 00 00 00 00 00     .].......^......
+  8061e8:	24 5e 80 00 00 00 00 00 3a 5e 80 00 00 00 00 00     $^......:^......
+  8061f8:	52 5e 80 00 00 00 00 00 6a 5e 80 00 00 00 00 00     R^......j^......
+  806208:	77 5e 80 00 00 00 00 00 20 62 80 00 00 00 00 00     w^...... b......
+  806218:	8b 5e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .^......file is 
+  806228:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806238:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806248:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806258:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806268:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  806278:	5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f 69 70     _send: %i.lib/ip
+  806288:	63 2e 63 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75     c.c...@.[%08x] u
+  806298:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8062a8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8062b8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8062c8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8062d8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8062e8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8062f8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  806308:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806318:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806320 <devtab>:
+  806320:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806330:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806340:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806350:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806360:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806370:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806380:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806390:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8063a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8063b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8063c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8063d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8063e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8063f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806400:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806410:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806420:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806430:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806440:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806450:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806460:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806470:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806480:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806490:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8064a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8064b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,10768 @@
+
+obj/user/fairshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 85 26 80 00 00 	movabs $0x802685,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 a5 23 80 00 00 	movabs $0x8023a5,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 a5 23 80 00 00 	movabs $0x8023a5,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 39 19 80 00 00 	movabs $0x801939,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 8f 63 80 00 00 	movabs $0x80638f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be b0 5c 80 00 00 	movabs $0x805cb0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be b2 5c 80 00 00 	movabs $0x805cb2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be b5 5c 80 00 00 	movabs $0x805cb5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 99 50 80 00 00 	movabs $0x805099,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 70 53 80 00 00 	movabs $0x805370,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 4b 35 80 00 00 	movabs $0x80354b,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 e2 38 80 00 00 	movabs $0x8038e2,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 ab 39 80 00 00 	movabs $0x8039ab,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 b1 38 80 00 00 	movabs $0x8038b1,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 b1 38 80 00 00 	movabs $0x8038b1,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 c9 36 80 00 00 	movabs $0x8036c9,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 4b 35 80 00 00 	movabs $0x80354b,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 a5 23 80 00 00 	movabs $0x8023a5,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 52 26 80 00 00 	movabs $0x802652,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 5c 80 00 00 	movabs $0x805cc0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 52 26 80 00 00 	movabs $0x802652,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 85 26 80 00 00 	movabs $0x802685,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 52 26 80 00 00 	movabs $0x802652,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 5f 80 00 00 	movabs $0x805f60,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 52 26 80 00 00 	movabs $0x802652,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 52 26 80 00 00 	movabs $0x802652,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 aa 28 80 00 00 	movabs $0x8028aa,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 aa 28 80 00 00 	movabs $0x8028aa,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 91 03 00 00       	call   801890 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <check_ratio>:
+    while (!SHARED->stop) SHARED->count[i]++;
+}
+
+/* Checks that a / b is within [lo, hi] percents */
+static void
+check_ratio(const char *what, uint64_t a, uint64_t b, uint64_t lo, uint64_t hi) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 56                	push   %r14
+  801507:	41 55                	push   %r13
+  801509:	41 54                	push   %r12
+  80150b:	53                   	push   %rbx
+  80150c:	49 89 fc             	mov    %rdi,%r12
+  80150f:	49 89 cd             	mov    %rcx,%r13
+  801512:	4d 89 c6             	mov    %r8,%r14
+    uint64_t ratio = b ? a * 100 / b : ~0ULL;
+  801515:	48 c7 c3 ff ff ff ff 	mov    $0xffffffffffffffff,%rbx
+  80151c:	48 85 d2             	test   %rdx,%rdx
+  80151f:	74 1a                	je     80153b <check_ratio+0x3a>
+  801521:	48 89 d7             	mov    %rdx,%rdi
+  801524:	48 8d 04 b6          	lea    (%rsi,%rsi,4),%rax
+  801528:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  80152c:	48 c1 e0 02          	shl    $0x2,%rax
+  801530:	ba 00 00 00 00       	mov    $0x0,%edx
+  801535:	48 f7 f7             	div    %rdi
+  801538:	48 89 c3             	mov    %rax,%rbx
+    cprintf("%s: %llu%%\n", what, (unsigned long long)ratio);
+  80153b:	48 89 da             	mov    %rbx,%rdx
+  80153e:	4c 89 e6             	mov    %r12,%rsi
+  801541:	48 bf 02 62 80 00 00 	movabs $0x806202,%rdi
+  801548:	00 00 00 
+  80154b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801550:	48 b9 ac 1a 80 00 00 	movabs $0x801aac,%rcx
+  801557:	00 00 00 
+  80155a:	ff d1                	call   *%rcx
+    if (ratio < lo || ratio > hi)
+  80155c:	4c 39 eb             	cmp    %r13,%rbx
+  80155f:	72 0e                	jb     80156f <check_ratio+0x6e>
+  801561:	49 39 de             	cmp    %rbx,%r14
+  801564:	72 09                	jb     80156f <check_ratio+0x6e>
+        panic("%s is out of [%llu%%, %llu%%]", what,
+              (unsigned long long)lo, (unsigned long long)hi);
+}
+  801566:	5b                   	pop    %rbx
+  801567:	41 5c                	pop    %r12
+  801569:	41 5d                	pop    %r13
+  80156b:	41 5e                	pop    %r14
+  80156d:	5d                   	pop    %rbp
+  80156e:	c3                   	ret
+        panic("%s is out of [%llu%%, %llu%%]", what,
+  80156f:	4d 89 f1             	mov    %r14,%r9
+  801572:	4d 89 e8             	mov    %r13,%r8
+  801575:	4c 89 e1             	mov    %r12,%rcx
+  801578:	48 ba 0e 62 80 00 00 	movabs $0x80620e,%rdx
+  80157f:	00 00 00 
+  801582:	be 1f 00 00 00       	mov    $0x1f,%esi
+  801587:	48 bf 2c 62 80 00 00 	movabs $0x80622c,%rdi
+  80158e:	00 00 00 
+  801591:	b8 00 00 00 00       	mov    $0x0,%eax
+  801596:	49 ba 5c 19 80 00 00 	movabs $0x80195c,%r10
+  80159d:	00 00 00 
+  8015a0:	41 ff d2             	call   *%r10
+
+00000000008015a3 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8015a3:	55                   	push   %rbp
+  8015a4:	48 89 e5             	mov    %rsp,%rbp
+  8015a7:	41 56                	push   %r14
+  8015a9:	41 55                	push   %r13
+  8015ab:	41 54                	push   %r12
+  8015ad:	53                   	push   %rbx
+  8015ae:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t hogs[NHOGS];
+    int res;
+
+    if ((res = sys_alloc_region(0, SHARED, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  8015b2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8015b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8015bc:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  8015c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c6:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  8015cd:	00 00 00 
+  8015d0:	ff d0                	call   *%rax
+  8015d2:	85 c0                	test   %eax,%eax
+  8015d4:	0f 88 c0 00 00 00    	js     80169a <umain+0xf7>
+  8015da:	bb 00 00 00 00       	mov    $0x0,%ebx
+        panic("sys_alloc_region: %i", res);
+
+    for (int i = 0; i < NHOGS; i++) {
+        if ((hogs[i] = fork()) < 0) panic("fork: %i", hogs[i]);
+  8015df:	49 bc a6 31 80 00 00 	movabs $0x8031a6,%r12
+  8015e6:	00 00 00 
+        if (!hogs[i]) {
+            hog(i);
+            return;
+        }
+        if ((res = sys_env_set_nice(hogs[i], nice[i])) < 0)
+  8015e9:	49 be f0 62 80 00 00 	movabs $0x8062f0,%r14
+  8015f0:	00 00 00 
+  8015f3:	49 bd 4a 2e 80 00 00 	movabs $0x802e4a,%r13
+  8015fa:	00 00 00 
+        if ((hogs[i] = fork()) < 0) panic("fork: %i", hogs[i]);
+  8015fd:	41 ff d4             	call   *%r12
+  801600:	89 c7                	mov    %eax,%edi
+  801602:	89 44 9d d4          	mov    %eax,-0x2c(%rbp,%rbx,4)
+  801606:	85 c0                	test   %eax,%eax
+  801608:	0f 88 b9 00 00 00    	js     8016c7 <umain+0x124>
+        if (!hogs[i]) {
+  80160e:	0f 84 e0 00 00 00    	je     8016f4 <umain+0x151>
+        if ((res = sys_env_set_nice(hogs[i], nice[i])) < 0)
+  801614:	41 8b 34 9e          	mov    (%r14,%rbx,4),%esi
+  801618:	41 ff d5             	call   *%r13
+  80161b:	85 c0                	test   %eax,%eax
+  80161d:	0f 88 2e 01 00 00    	js     801751 <umain+0x1ae>
+    for (int i = 0; i < NHOGS; i++) {
+  801623:	48 83 c3 01          	add    $0x1,%rbx
+  801627:	48 83 fb 03          	cmp    $0x3,%rbx
+  80162b:	75 d0                	jne    8015fd <umain+0x5a>
+            panic("sys_env_set_nice: %i", res);
+    }
+    if (sys_env_set_nice(0, NICE_MAX + 1) != -E_INVAL)
+  80162d:	be 14 00 00 00       	mov    $0x14,%esi
+  801632:	bf 00 00 00 00       	mov    $0x0,%edi
+  801637:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  80163e:	00 00 00 
+  801641:	ff d0                	call   *%rax
+  801643:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  801646:	0f 85 32 01 00 00    	jne    80177e <umain+0x1db>
+        panic("sys_env_set_nice accepted invalid level");
+    if (sys_env_set_nice(0, NICE_MIN) != -E_BAD_ENV)
+  80164c:	be ec ff ff ff       	mov    $0xffffffec,%esi
+  801651:	bf 00 00 00 00       	mov    $0x0,%edi
+  801656:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  80165d:	00 00 00 
+  801660:	ff d0                	call   *%rax
+  801662:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801665:	0f 85 3d 01 00 00    	jne    8017a8 <umain+0x205>
+        panic("sys_env_set_nice allowed lowering nice level");
+
+    uint32_t start = vsys_gettimems();
+  80166b:	48 b8 fd 4c 80 00 00 	movabs $0x804cfd,%rax
+  801672:	00 00 00 
+  801675:	ff d0                	call   *%rax
+  801677:	89 c3                	mov    %eax,%ebx
+    SHARED->go = 1;
+  801679:	c6 04 25 00 00 00 0a 	movb   $0x1,0xa000000
+  801680:	01 
+    while (vsys_gettimems() - start < TEST_MS) sys_yield();
+  801681:	49 bc fd 4c 80 00 00 	movabs $0x804cfd,%r12
+  801688:	00 00 00 
+  80168b:	49 bd a7 2a 80 00 00 	movabs $0x802aa7,%r13
+  801692:	00 00 00 
+  801695:	e9 3b 01 00 00       	jmp    8017d5 <umain+0x232>
+        panic("sys_alloc_region: %i", res);
+  80169a:	89 c1                	mov    %eax,%ecx
+  80169c:	48 ba 3d 62 80 00 00 	movabs $0x80623d,%rdx
+  8016a3:	00 00 00 
+  8016a6:	be 29 00 00 00       	mov    $0x29,%esi
+  8016ab:	48 bf 2c 62 80 00 00 	movabs $0x80622c,%rdi
+  8016b2:	00 00 00 
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ba:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  8016c1:	00 00 00 
+  8016c4:	41 ff d0             	call   *%r8
+        if ((hogs[i] = fork()) < 0) panic("fork: %i", hogs[i]);
+  8016c7:	89 c1                	mov    %eax,%ecx
+  8016c9:	48 ba 7c 68 80 00 00 	movabs $0x80687c,%rdx
+  8016d0:	00 00 00 
+  8016d3:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8016d8:	48 bf 2c 62 80 00 00 	movabs $0x80622c,%rdi
+  8016df:	00 00 00 
+  8016e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e7:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  8016ee:	00 00 00 
+  8016f1:	41 ff d0             	call   *%r8
+    while (!SHARED->go) sys_yield();
+  8016f4:	0f b6 04 25 00 00 00 	movzbl 0xa000000,%eax
+  8016fb:	0a 
+  8016fc:	84 c0                	test   %al,%al
+  8016fe:	75 19                	jne    801719 <umain+0x176>
+  801700:	49 bc a7 2a 80 00 00 	movabs $0x802aa7,%r12
+  801707:	00 00 00 
+  80170a:	41 ff d4             	call   *%r12
+  80170d:	0f b6 04 25 00 00 00 	movzbl 0xa000000,%eax
+  801714:	0a 
+  801715:	84 c0                	test   %al,%al
+  801717:	74 f1                	je     80170a <umain+0x167>
+    while (!SHARED->stop) SHARED->count[i]++;
+  801719:	0f b6 04 25 01 00 00 	movzbl 0xa000001,%eax
+  801720:	0a 
+  801721:	84 c0                	test   %al,%al
+  801723:	0f 85 5a 01 00 00    	jne    801883 <umain+0x2e0>
+  801729:	48 63 db             	movslq %ebx,%rbx
+  80172c:	48 8b 04 dd 08 00 00 	mov    0xa000008(,%rbx,8),%rax
+  801733:	0a 
+  801734:	48 83 c0 01          	add    $0x1,%rax
+  801738:	48 89 04 dd 08 00 00 	mov    %rax,0xa000008(,%rbx,8)
+  80173f:	0a 
+  801740:	0f b6 04 25 01 00 00 	movzbl 0xa000001,%eax
+  801747:	0a 
+  801748:	84 c0                	test   %al,%al
+  80174a:	74 e0                	je     80172c <umain+0x189>
+  80174c:	e9 32 01 00 00       	jmp    801883 <umain+0x2e0>
+            panic("sys_env_set_nice: %i", res);
+  801751:	89 c1                	mov    %eax,%ecx
+  801753:	48 ba 52 62 80 00 00 	movabs $0x806252,%rdx
+  80175a:	00 00 00 
+  80175d:	be 32 00 00 00       	mov    $0x32,%esi
+  801762:	48 bf 2c 62 80 00 00 	movabs $0x80622c,%rdi
+  801769:	00 00 00 
+  80176c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801771:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  801778:	00 00 00 
+  80177b:	41 ff d0             	call   *%r8
+        panic("sys_env_set_nice accepted invalid level");
+  80177e:	48 ba 98 62 80 00 00 	movabs $0x806298,%rdx
+  801785:	00 00 00 
+  801788:	be 35 00 00 00       	mov    $0x35,%esi
+  80178d:	48 bf 2c 62 80 00 00 	movabs $0x80622c,%rdi
+  801794:	00 00 00 
+  801797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179c:	48 b9 5c 19 80 00 00 	movabs $0x80195c,%rcx
+  8017a3:	00 00 00 
+  8017a6:	ff d1                	call   *%rcx
+        panic("sys_env_set_nice allowed lowering nice level");
+  8017a8:	48 ba c0 62 80 00 00 	movabs $0x8062c0,%rdx
+  8017af:	00 00 00 
+  8017b2:	be 37 00 00 00       	mov    $0x37,%esi
+  8017b7:	48 bf 2c 62 80 00 00 	movabs $0x80622c,%rdi
+  8017be:	00 00 00 
+  8017c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c6:	48 b9 5c 19 80 00 00 	movabs $0x80195c,%rcx
+  8017cd:	00 00 00 
+  8017d0:	ff d1                	call   *%rcx
+    while (vsys_gettimems() - start < TEST_MS) sys_yield();
+  8017d2:	41 ff d5             	call   *%r13
+  8017d5:	41 ff d4             	call   *%r12
+  8017d8:	29 d8                	sub    %ebx,%eax
+  8017da:	3d b7 0b 00 00       	cmp    $0xbb7,%eax
+  8017df:	76 f1                	jbe    8017d2 <umain+0x22f>
+    SHARED->stop = 1;
+  8017e1:	c6 04 25 01 00 00 0a 	movb   $0x1,0xa000001
+  8017e8:	01 
+
+    for (int i = 0; i < NHOGS; i++) wait(hogs[i]);
+  8017e9:	8b 7d d4             	mov    -0x2c(%rbp),%edi
+  8017ec:	48 bb d2 47 80 00 00 	movabs $0x8047d2,%rbx
+  8017f3:	00 00 00 
+  8017f6:	ff d3                	call   *%rbx
+  8017f8:	8b 7d d8             	mov    -0x28(%rbp),%edi
+  8017fb:	ff d3                	call   *%rbx
+  8017fd:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801800:	ff d3                	call   *%rbx
+
+    check_ratio("nice 0 / nice 0", SHARED->count[0], SHARED->count[1], 80, 125);
+  801802:	48 8b 14 25 10 00 00 	mov    0xa000010,%rdx
+  801809:	0a 
+  80180a:	48 8b 34 25 08 00 00 	mov    0xa000008,%rsi
+  801811:	0a 
+  801812:	41 b8 7d 00 00 00    	mov    $0x7d,%r8d
+  801818:	b9 50 00 00 00       	mov    $0x50,%ecx
+  80181d:	48 bf 67 62 80 00 00 	movabs $0x806267,%rdi
+  801824:	00 00 00 
+  801827:	48 bb 01 15 80 00 00 	movabs $0x801501,%rbx
+  80182e:	00 00 00 
+  801831:	ff d3                	call   *%rbx
+    check_ratio("nice 0 / nice 5", SHARED->count[0] + SHARED->count[1],
+                2 * SHARED->count[2], 230, 400);
+  801833:	48 8b 14 25 18 00 00 	mov    0xa000018,%rdx
+  80183a:	0a 
+    check_ratio("nice 0 / nice 5", SHARED->count[0] + SHARED->count[1],
+  80183b:	48 8b 34 25 08 00 00 	mov    0xa000008,%rsi
+  801842:	0a 
+  801843:	48 8b 04 25 10 00 00 	mov    0xa000010,%rax
+  80184a:	0a 
+  80184b:	48 01 d2             	add    %rdx,%rdx
+  80184e:	48 01 c6             	add    %rax,%rsi
+  801851:	41 b8 90 01 00 00    	mov    $0x190,%r8d
+  801857:	b9 e6 00 00 00       	mov    $0xe6,%ecx
+  80185c:	48 bf 77 62 80 00 00 	movabs $0x806277,%rdi
+  801863:	00 00 00 
+  801866:	ff d3                	call   *%rbx
+
+    cprintf("fairshare: OK\n");
+  801868:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  80186f:	00 00 00 
+  801872:	b8 00 00 00 00       	mov    $0x0,%eax
+  801877:	48 ba ac 1a 80 00 00 	movabs $0x801aac,%rdx
+  80187e:	00 00 00 
+  801881:	ff d2                	call   *%rdx
+}
+  801883:	48 83 c4 10          	add    $0x10,%rsp
+  801887:	5b                   	pop    %rbx
+  801888:	41 5c                	pop    %r12
+  80188a:	41 5d                	pop    %r13
+  80188c:	41 5e                	pop    %r14
+  80188e:	5d                   	pop    %rbp
+  80188f:	c3                   	ret
+
+0000000000801890 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801890:	55                   	push   %rbp
+  801891:	48 89 e5             	mov    %rsp,%rbp
+  801894:	41 56                	push   %r14
+  801896:	41 55                	push   %r13
+  801898:	41 54                	push   %r12
+  80189a:	53                   	push   %rbx
+  80189b:	41 89 fd             	mov    %edi,%r13d
+  80189e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8018a1:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8018a8:	00 00 00 
+  8018ab:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8018b2:	00 00 00 
+  8018b5:	48 39 c2             	cmp    %rax,%rdx
+  8018b8:	73 17                	jae    8018d1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8018ba:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8018bd:	49 89 c4             	mov    %rax,%r12
+  8018c0:	48 83 c3 08          	add    $0x8,%rbx
+  8018c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c9:	ff 53 f8             	call   *-0x8(%rbx)
+  8018cc:	4c 39 e3             	cmp    %r12,%rbx
+  8018cf:	72 ef                	jb     8018c0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8018d1:	48 b8 70 2a 80 00 00 	movabs $0x802a70,%rax
+  8018d8:	00 00 00 
+  8018db:	ff d0                	call   *%rax
+  8018dd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018e2:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8018e9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018f0:	00 00 00 
+  8018f3:	48 01 d0             	add    %rdx,%rax
+  8018f6:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8018fd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801900:	45 85 ed             	test   %r13d,%r13d
+  801903:	7e 0d                	jle    801912 <libmain+0x82>
+  801905:	49 8b 06             	mov    (%r14),%rax
+  801908:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80190f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801912:	4c 89 f6             	mov    %r14,%rsi
+  801915:	44 89 ef             	mov    %r13d,%edi
+  801918:	48 b8 a3 15 80 00 00 	movabs $0x8015a3,%rax
+  80191f:	00 00 00 
+  801922:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801924:	48 b8 39 19 80 00 00 	movabs $0x801939,%rax
+  80192b:	00 00 00 
+  80192e:	ff d0                	call   *%rax
+#endif
+}
+  801930:	5b                   	pop    %rbx
+  801931:	41 5c                	pop    %r12
+  801933:	41 5d                	pop    %r13
+  801935:	41 5e                	pop    %r14
+  801937:	5d                   	pop    %rbp
+  801938:	c3                   	ret
+
+0000000000801939 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801939:	55                   	push   %rbp
+  80193a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80193d:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  801944:	00 00 00 
+  801947:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801949:	bf 00 00 00 00       	mov    $0x0,%edi
+  80194e:	48 b8 ff 29 80 00 00 	movabs $0x8029ff,%rax
+  801955:	00 00 00 
+  801958:	ff d0                	call   *%rax
+}
+  80195a:	5d                   	pop    %rbp
+  80195b:	c3                   	ret
+
+000000000080195c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80195c:	55                   	push   %rbp
+  80195d:	48 89 e5             	mov    %rsp,%rbp
+  801960:	41 56                	push   %r14
+  801962:	41 55                	push   %r13
+  801964:	41 54                	push   %r12
+  801966:	53                   	push   %rbx
+  801967:	48 83 ec 50          	sub    $0x50,%rsp
+  80196b:	49 89 fc             	mov    %rdi,%r12
+  80196e:	41 89 f5             	mov    %esi,%r13d
+  801971:	48 89 d3             	mov    %rdx,%rbx
+  801974:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801978:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80197c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801980:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801987:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80198b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80198f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801993:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801997:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80199e:	00 00 00 
+  8019a1:	4c 8b 30             	mov    (%rax),%r14
+  8019a4:	48 b8 70 2a 80 00 00 	movabs $0x802a70,%rax
+  8019ab:	00 00 00 
+  8019ae:	ff d0                	call   *%rax
+  8019b0:	89 c6                	mov    %eax,%esi
+  8019b2:	45 89 e8             	mov    %r13d,%r8d
+  8019b5:	4c 89 e1             	mov    %r12,%rcx
+  8019b8:	4c 89 f2             	mov    %r14,%rdx
+  8019bb:	48 bf 08 63 80 00 00 	movabs $0x806308,%rdi
+  8019c2:	00 00 00 
+  8019c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ca:	49 bc ac 1a 80 00 00 	movabs $0x801aac,%r12
+  8019d1:	00 00 00 
+  8019d4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8019d7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8019db:	48 89 df             	mov    %rbx,%rdi
+  8019de:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  8019e5:	00 00 00 
+  8019e8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8019ea:	48 bf 0c 62 80 00 00 	movabs $0x80620c,%rdi
+  8019f1:	00 00 00 
+  8019f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8019fc:	cc                   	int3
+  8019fd:	eb fd                	jmp    8019fc <_panic+0xa0>
+
+00000000008019ff <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8019ff:	55                   	push   %rbp
+  801a00:	48 89 e5             	mov    %rsp,%rbp
+  801a03:	53                   	push   %rbx
+  801a04:	48 83 ec 08          	sub    $0x8,%rsp
+  801a08:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801a0b:	8b 06                	mov    (%rsi),%eax
+  801a0d:	8d 50 01             	lea    0x1(%rax),%edx
+  801a10:	89 16                	mov    %edx,(%rsi)
+  801a12:	48 98                	cltq
+  801a14:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801a19:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801a1f:	74 0a                	je     801a2b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801a21:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801a25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a29:	c9                   	leave
+  801a2a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801a2b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801a2f:	be ff 00 00 00       	mov    $0xff,%esi
+  801a34:	48 b8 60 29 80 00 00 	movabs $0x802960,%rax
+  801a3b:	00 00 00 
+  801a3e:	ff d0                	call   *%rax
+        state->offset = 0;
+  801a40:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801a46:	eb d9                	jmp    801a21 <putch+0x22>
+
+0000000000801a48 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801a53:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801a56:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801a5d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a67:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801a6a:	48 89 f1             	mov    %rsi,%rcx
+  801a6d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a74:	48 bf ff 19 80 00 00 	movabs $0x8019ff,%rdi
+  801a7b:	00 00 00 
+  801a7e:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a8a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a91:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a98:	48 b8 60 29 80 00 00 	movabs $0x802960,%rax
+  801a9f:	00 00 00 
+  801aa2:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801aa4:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+
+0000000000801aac <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801aac:	55                   	push   %rbp
+  801aad:	48 89 e5             	mov    %rsp,%rbp
+  801ab0:	48 83 ec 50          	sub    $0x50,%rsp
+  801ab4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801ab8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801abc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ac0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801ac4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801ac8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801acf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ad3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ad7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801adb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801adf:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801ae3:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801aef:	c9                   	leave
+  801af0:	c3                   	ret
+
+0000000000801af1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801af1:	55                   	push   %rbp
+  801af2:	48 89 e5             	mov    %rsp,%rbp
+  801af5:	41 57                	push   %r15
+  801af7:	41 56                	push   %r14
+  801af9:	41 55                	push   %r13
+  801afb:	41 54                	push   %r12
+  801afd:	53                   	push   %rbx
+  801afe:	48 83 ec 18          	sub    $0x18,%rsp
+  801b02:	49 89 fc             	mov    %rdi,%r12
+  801b05:	49 89 f5             	mov    %rsi,%r13
+  801b08:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b0c:	8b 45 10             	mov    0x10(%rbp),%eax
+  801b0f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801b12:	41 89 cf             	mov    %ecx,%r15d
+  801b15:	4c 39 fa             	cmp    %r15,%rdx
+  801b18:	73 5b                	jae    801b75 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801b1a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801b1e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801b22:	85 db                	test   %ebx,%ebx
+  801b24:	7e 0e                	jle    801b34 <print_num+0x43>
+            putch(padc, put_arg);
+  801b26:	4c 89 ee             	mov    %r13,%rsi
+  801b29:	44 89 f7             	mov    %r14d,%edi
+  801b2c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801b2f:	83 eb 01             	sub    $0x1,%ebx
+  801b32:	75 f2                	jne    801b26 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801b34:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801b38:	48 b9 3c 63 80 00 00 	movabs $0x80633c,%rcx
+  801b3f:	00 00 00 
+  801b42:	48 b8 2b 63 80 00 00 	movabs $0x80632b,%rax
+  801b49:	00 00 00 
+  801b4c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801b50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b59:	49 f7 f7             	div    %r15
+  801b5c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801b60:	4c 89 ee             	mov    %r13,%rsi
+  801b63:	41 ff d4             	call   *%r12
+}
+  801b66:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b6a:	5b                   	pop    %rbx
+  801b6b:	41 5c                	pop    %r12
+  801b6d:	41 5d                	pop    %r13
+  801b6f:	41 5e                	pop    %r14
+  801b71:	41 5f                	pop    %r15
+  801b73:	5d                   	pop    %rbp
+  801b74:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7e:	49 f7 f7             	div    %r15
+  801b81:	48 83 ec 08          	sub    $0x8,%rsp
+  801b85:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b89:	52                   	push   %rdx
+  801b8a:	45 0f be c9          	movsbl %r9b,%r9d
+  801b8e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b92:	48 89 c2             	mov    %rax,%rdx
+  801b95:	48 b8 f1 1a 80 00 00 	movabs $0x801af1,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+  801ba1:	48 83 c4 10          	add    $0x10,%rsp
+  801ba5:	eb 8d                	jmp    801b34 <print_num+0x43>
+
+0000000000801ba7 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801ba7:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801bab:	48 8b 06             	mov    (%rsi),%rax
+  801bae:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801bb2:	73 0a                	jae    801bbe <sprintputch+0x17>
+        *state->start++ = ch;
+  801bb4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bb8:	48 89 16             	mov    %rdx,(%rsi)
+  801bbb:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801bbe:	c3                   	ret
+
+0000000000801bbf <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801bbf:	55                   	push   %rbp
+  801bc0:	48 89 e5             	mov    %rsp,%rbp
+  801bc3:	48 83 ec 50          	sub    $0x50,%rsp
+  801bc7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801bcb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801bcf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801bd3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801bda:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801bde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801be6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801bea:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801bee:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  801bf5:	00 00 00 
+  801bf8:	ff d0                	call   *%rax
+}
+  801bfa:	c9                   	leave
+  801bfb:	c3                   	ret
+
+0000000000801bfc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801bfc:	55                   	push   %rbp
+  801bfd:	48 89 e5             	mov    %rsp,%rbp
+  801c00:	41 57                	push   %r15
+  801c02:	41 56                	push   %r14
+  801c04:	41 55                	push   %r13
+  801c06:	41 54                	push   %r12
+  801c08:	53                   	push   %rbx
+  801c09:	48 83 ec 38          	sub    $0x38,%rsp
+  801c0d:	49 89 fe             	mov    %rdi,%r14
+  801c10:	49 89 f5             	mov    %rsi,%r13
+  801c13:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801c16:	48 8b 01             	mov    (%rcx),%rax
+  801c19:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801c1d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801c21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c25:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801c29:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801c2d:	eb 0d                	jmp    801c3c <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801c2f:	40 0f b6 ff          	movzbl %dil,%edi
+  801c33:	4c 89 ee             	mov    %r13,%rsi
+  801c36:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801c39:	4c 89 e3             	mov    %r12,%rbx
+  801c3c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801c40:	0f b6 3b             	movzbl (%rbx),%edi
+  801c43:	40 80 ff 25          	cmp    $0x25,%dil
+  801c47:	74 14                	je     801c5d <vprintfmt+0x61>
+            if (!ch) return;
+  801c49:	40 84 ff             	test   %dil,%dil
+  801c4c:	75 e1                	jne    801c2f <vprintfmt+0x33>
+}
+  801c4e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801c52:	5b                   	pop    %rbx
+  801c53:	41 5c                	pop    %r12
+  801c55:	41 5d                	pop    %r13
+  801c57:	41 5e                	pop    %r14
+  801c59:	41 5f                	pop    %r15
+  801c5b:	5d                   	pop    %rbp
+  801c5c:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801c5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c62:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801c66:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801c6b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c71:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c78:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c7c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c81:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c86:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c89:	83 e8 23             	sub    $0x23,%eax
+  801c8c:	3c 57                	cmp    $0x57,%al
+  801c8e:	0f 87 67 06 00 00    	ja     8022fb <vprintfmt+0x6ff>
+  801c94:	0f b6 c0             	movzbl %al,%eax
+  801c97:	48 b9 c0 64 80 00 00 	movabs $0x8064c0,%rcx
+  801c9e:	00 00 00 
+  801ca1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801ca4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801ca7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801cab:	eb cf                	jmp    801c7c <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801cad:	49 89 dc             	mov    %rbx,%r12
+  801cb0:	be 01 00 00 00       	mov    $0x1,%esi
+  801cb5:	eb c5                	jmp    801c7c <vprintfmt+0x80>
+            padc = ch;
+  801cb7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801cbb:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801cbe:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cc1:	eb b9                	jmp    801c7c <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801cc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cc6:	83 f8 2f             	cmp    $0x2f,%eax
+  801cc9:	77 24                	ja     801cef <vprintfmt+0xf3>
+  801ccb:	89 c1                	mov    %eax,%ecx
+  801ccd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801cd1:	83 c0 08             	add    $0x8,%eax
+  801cd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cd7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801cda:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801cdd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ce1:	79 99                	jns    801c7c <vprintfmt+0x80>
+                width = precision;
+  801ce3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ce7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801ced:	eb 8d                	jmp    801c7c <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801cef:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801cf3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801cf7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cfb:	eb da                	jmp    801cd7 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801cfd:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801d02:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801d06:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801d0c:	3c 39                	cmp    $0x39,%al
+  801d0e:	77 1c                	ja     801d2c <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801d10:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801d14:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801d18:	0f b6 c0             	movzbl %al,%eax
+  801d1b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801d20:	0f b6 03             	movzbl (%rbx),%eax
+  801d23:	3c 39                	cmp    $0x39,%al
+  801d25:	76 e9                	jbe    801d10 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801d27:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801d2a:	eb b1                	jmp    801cdd <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801d2c:	49 89 dc             	mov    %rbx,%r12
+  801d2f:	eb ac                	jmp    801cdd <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801d31:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801d34:	85 c9                	test   %ecx,%ecx
+  801d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3b:	0f 49 c1             	cmovns %ecx,%eax
+  801d3e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801d41:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d44:	e9 33 ff ff ff       	jmp    801c7c <vprintfmt+0x80>
+            lflag++;
+  801d49:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d4c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d4f:	e9 28 ff ff ff       	jmp    801c7c <vprintfmt+0x80>
+            lflag--;
+  801d54:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d57:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d5a:	e9 1d ff ff ff       	jmp    801c7c <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801d5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d62:	83 f8 2f             	cmp    $0x2f,%eax
+  801d65:	77 19                	ja     801d80 <vprintfmt+0x184>
+  801d67:	89 c2                	mov    %eax,%edx
+  801d69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d6d:	83 c0 08             	add    $0x8,%eax
+  801d70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d73:	8b 3a                	mov    (%rdx),%edi
+  801d75:	4c 89 ee             	mov    %r13,%rsi
+  801d78:	41 ff d6             	call   *%r14
+            break;
+  801d7b:	e9 bc fe ff ff       	jmp    801c3c <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8c:	eb e5                	jmp    801d73 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d91:	83 f8 2f             	cmp    $0x2f,%eax
+  801d94:	77 5a                	ja     801df0 <vprintfmt+0x1f4>
+  801d96:	89 c2                	mov    %eax,%edx
+  801d98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9c:	83 c0 08             	add    $0x8,%eax
+  801d9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801da2:	8b 02                	mov    (%rdx),%eax
+  801da4:	89 c1                	mov    %eax,%ecx
+  801da6:	f7 d9                	neg    %ecx
+  801da8:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801dab:	83 f9 13             	cmp    $0x13,%ecx
+  801dae:	7f 4e                	jg     801dfe <vprintfmt+0x202>
+  801db0:	48 63 c1             	movslq %ecx,%rax
+  801db3:	48 ba 80 67 80 00 00 	movabs $0x806780,%rdx
+  801dba:	00 00 00 
+  801dbd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801dc1:	48 85 c0             	test   %rax,%rax
+  801dc4:	74 38                	je     801dfe <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801dc6:	48 89 c1             	mov    %rax,%rcx
+  801dc9:	48 ba c8 69 80 00 00 	movabs $0x8069c8,%rdx
+  801dd0:	00 00 00 
+  801dd3:	4c 89 ee             	mov    %r13,%rsi
+  801dd6:	4c 89 f7             	mov    %r14,%rdi
+  801dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dde:	49 b8 bf 1b 80 00 00 	movabs $0x801bbf,%r8
+  801de5:	00 00 00 
+  801de8:	41 ff d0             	call   *%r8
+  801deb:	e9 4c fe ff ff       	jmp    801c3c <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801df0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801df4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801df8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dfc:	eb a4                	jmp    801da2 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801dfe:	48 ba 54 63 80 00 00 	movabs $0x806354,%rdx
+  801e05:	00 00 00 
+  801e08:	4c 89 ee             	mov    %r13,%rsi
+  801e0b:	4c 89 f7             	mov    %r14,%rdi
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e13:	49 b8 bf 1b 80 00 00 	movabs $0x801bbf,%r8
+  801e1a:	00 00 00 
+  801e1d:	41 ff d0             	call   *%r8
+  801e20:	e9 17 fe ff ff       	jmp    801c3c <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e28:	83 f8 2f             	cmp    $0x2f,%eax
+  801e2b:	77 6c                	ja     801e99 <vprintfmt+0x29d>
+  801e2d:	89 c2                	mov    %eax,%edx
+  801e2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e33:	83 c0 08             	add    $0x8,%eax
+  801e36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e39:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801e3c:	48 85 f6             	test   %rsi,%rsi
+  801e3f:	48 b8 4d 63 80 00 00 	movabs $0x80634d,%rax
+  801e46:	00 00 00 
+  801e49:	48 0f 45 c6          	cmovne %rsi,%rax
+  801e4d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801e51:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e55:	7e 06                	jle    801e5d <vprintfmt+0x261>
+  801e57:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801e5b:	75 4a                	jne    801ea7 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e5d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e61:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801e65:	0f b6 00             	movzbl (%rax),%eax
+  801e68:	84 c0                	test   %al,%al
+  801e6a:	0f 85 9a 00 00 00    	jne    801f0a <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e70:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e73:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	0f 8e bd fd ff ff    	jle    801c3c <vprintfmt+0x40>
+  801e7f:	4c 89 ee             	mov    %r13,%rsi
+  801e82:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e87:	41 ff d6             	call   *%r14
+  801e8a:	41 83 ec 01          	sub    $0x1,%r12d
+  801e8e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e92:	75 eb                	jne    801e7f <vprintfmt+0x283>
+  801e94:	e9 a3 fd ff ff       	jmp    801c3c <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea5:	eb 92                	jmp    801e39 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ea7:	49 63 f7             	movslq %r15d,%rsi
+  801eaa:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801eae:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+  801eba:	48 89 c2             	mov    %rax,%rdx
+  801ebd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ec0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ec2:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ec5:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ec8:	85 c0                	test   %eax,%eax
+  801eca:	7e 91                	jle    801e5d <vprintfmt+0x261>
+  801ecc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ed1:	4c 89 ee             	mov    %r13,%rsi
+  801ed4:	44 89 e7             	mov    %r12d,%edi
+  801ed7:	41 ff d6             	call   *%r14
+  801eda:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ede:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ee1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ee4:	75 eb                	jne    801ed1 <vprintfmt+0x2d5>
+  801ee6:	e9 72 ff ff ff       	jmp    801e5d <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801eeb:	0f b6 f8             	movzbl %al,%edi
+  801eee:	4c 89 ee             	mov    %r13,%rsi
+  801ef1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ef4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ef8:	49 83 c4 01          	add    $0x1,%r12
+  801efc:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801f02:	84 c0                	test   %al,%al
+  801f04:	0f 84 66 ff ff ff    	je     801e70 <vprintfmt+0x274>
+  801f0a:	45 85 ff             	test   %r15d,%r15d
+  801f0d:	78 0a                	js     801f19 <vprintfmt+0x31d>
+  801f0f:	41 83 ef 01          	sub    $0x1,%r15d
+  801f13:	0f 88 57 ff ff ff    	js     801e70 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801f19:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801f1d:	74 cc                	je     801eeb <vprintfmt+0x2ef>
+  801f1f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801f22:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801f27:	80 fa 5e             	cmp    $0x5e,%dl
+  801f2a:	77 c2                	ja     801eee <vprintfmt+0x2f2>
+  801f2c:	eb bd                	jmp    801eeb <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801f2e:	40 84 f6             	test   %sil,%sil
+  801f31:	75 26                	jne    801f59 <vprintfmt+0x35d>
+    switch (lflag) {
+  801f33:	85 d2                	test   %edx,%edx
+  801f35:	74 59                	je     801f90 <vprintfmt+0x394>
+  801f37:	83 fa 01             	cmp    $0x1,%edx
+  801f3a:	74 7b                	je     801fb7 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801f3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f3f:	83 f8 2f             	cmp    $0x2f,%eax
+  801f42:	0f 87 96 00 00 00    	ja     801fde <vprintfmt+0x3e2>
+  801f48:	89 c2                	mov    %eax,%edx
+  801f4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f4e:	83 c0 08             	add    $0x8,%eax
+  801f51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f54:	4c 8b 22             	mov    (%rdx),%r12
+  801f57:	eb 17                	jmp    801f70 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801f59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f5f:	77 21                	ja     801f82 <vprintfmt+0x386>
+  801f61:	89 c2                	mov    %eax,%edx
+  801f63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f67:	83 c0 08             	add    $0x8,%eax
+  801f6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f6d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f70:	4d 85 e4             	test   %r12,%r12
+  801f73:	78 7a                	js     801fef <vprintfmt+0x3f3>
+            num = i;
+  801f75:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f78:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f7d:	e9 56 02 00 00       	jmp    8021d8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f8e:	eb dd                	jmp    801f6d <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f93:	83 f8 2f             	cmp    $0x2f,%eax
+  801f96:	77 11                	ja     801fa9 <vprintfmt+0x3ad>
+  801f98:	89 c2                	mov    %eax,%edx
+  801f9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f9e:	83 c0 08             	add    $0x8,%eax
+  801fa1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa4:	4c 63 22             	movslq (%rdx),%r12
+  801fa7:	eb c7                	jmp    801f70 <vprintfmt+0x374>
+  801fa9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fb5:	eb ed                	jmp    801fa4 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801fb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fba:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbd:	77 11                	ja     801fd0 <vprintfmt+0x3d4>
+  801fbf:	89 c2                	mov    %eax,%edx
+  801fc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc5:	83 c0 08             	add    $0x8,%eax
+  801fc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fcb:	4c 8b 22             	mov    (%rdx),%r12
+  801fce:	eb a0                	jmp    801f70 <vprintfmt+0x374>
+  801fd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fdc:	eb ed                	jmp    801fcb <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801fde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fe2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fe6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fea:	e9 65 ff ff ff       	jmp    801f54 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801fef:	4c 89 ee             	mov    %r13,%rsi
+  801ff2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801ff7:	41 ff d6             	call   *%r14
+                i = -i;
+  801ffa:	49 f7 dc             	neg    %r12
+  801ffd:	e9 73 ff ff ff       	jmp    801f75 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  802002:	40 84 f6             	test   %sil,%sil
+  802005:	75 2e                	jne    802035 <vprintfmt+0x439>
+    switch (lflag) {
+  802007:	85 d2                	test   %edx,%edx
+  802009:	7f 59                	jg     802064 <vprintfmt+0x468>
+  80200b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80200e:	7d 7a                	jge    80208a <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802010:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802013:	83 f8 2f             	cmp    $0x2f,%eax
+  802016:	0f 87 aa 00 00 00    	ja     8020c6 <vprintfmt+0x4ca>
+  80201c:	89 c2                	mov    %eax,%edx
+  80201e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802022:	83 c0 08             	add    $0x8,%eax
+  802025:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802028:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80202b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802030:	e9 a3 01 00 00       	jmp    8021d8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802035:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802038:	83 f8 2f             	cmp    $0x2f,%eax
+  80203b:	77 19                	ja     802056 <vprintfmt+0x45a>
+  80203d:	89 c2                	mov    %eax,%edx
+  80203f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802043:	83 c0 08             	add    $0x8,%eax
+  802046:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802049:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80204c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802051:	e9 82 01 00 00       	jmp    8021d8 <vprintfmt+0x5dc>
+  802056:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80205a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80205e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802062:	eb e5                	jmp    802049 <vprintfmt+0x44d>
+    switch (lflag) {
+  802064:	83 fa 01             	cmp    $0x1,%edx
+  802067:	75 a7                	jne    802010 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  802069:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80206c:	83 f8 2f             	cmp    $0x2f,%eax
+  80206f:	77 47                	ja     8020b8 <vprintfmt+0x4bc>
+  802071:	89 c2                	mov    %eax,%edx
+  802073:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802077:	83 c0 08             	add    $0x8,%eax
+  80207a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80207d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802080:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802085:	e9 4e 01 00 00       	jmp    8021d8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80208a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80208d:	83 f8 2f             	cmp    $0x2f,%eax
+  802090:	77 18                	ja     8020aa <vprintfmt+0x4ae>
+  802092:	89 c2                	mov    %eax,%edx
+  802094:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802098:	83 c0 08             	add    $0x8,%eax
+  80209b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80209e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8020a0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8020a5:	e9 2e 01 00 00       	jmp    8021d8 <vprintfmt+0x5dc>
+  8020aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020b6:	eb e6                	jmp    80209e <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  8020b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c4:	eb b7                	jmp    80207d <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  8020c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d2:	e9 51 ff ff ff       	jmp    802028 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  8020d7:	40 84 f6             	test   %sil,%sil
+  8020da:	75 2e                	jne    80210a <vprintfmt+0x50e>
+    switch (lflag) {
+  8020dc:	85 d2                	test   %edx,%edx
+  8020de:	7f 59                	jg     802139 <vprintfmt+0x53d>
+  8020e0:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8020e3:	7d 77                	jge    80215c <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  8020e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8020eb:	0f 87 a4 00 00 00    	ja     802195 <vprintfmt+0x599>
+  8020f1:	89 c2                	mov    %eax,%edx
+  8020f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f7:	83 c0 08             	add    $0x8,%eax
+  8020fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020fd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802100:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802105:	e9 ce 00 00 00       	jmp    8021d8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80210a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80210d:	83 f8 2f             	cmp    $0x2f,%eax
+  802110:	77 19                	ja     80212b <vprintfmt+0x52f>
+  802112:	89 c2                	mov    %eax,%edx
+  802114:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802118:	83 c0 08             	add    $0x8,%eax
+  80211b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80211e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802121:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802126:	e9 ad 00 00 00       	jmp    8021d8 <vprintfmt+0x5dc>
+  80212b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80212f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802133:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802137:	eb e5                	jmp    80211e <vprintfmt+0x522>
+    switch (lflag) {
+  802139:	83 fa 01             	cmp    $0x1,%edx
+  80213c:	75 a7                	jne    8020e5 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  80213e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802141:	83 f8 2f             	cmp    $0x2f,%eax
+  802144:	77 41                	ja     802187 <vprintfmt+0x58b>
+  802146:	89 c2                	mov    %eax,%edx
+  802148:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80214c:	83 c0 08             	add    $0x8,%eax
+  80214f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802152:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802155:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80215a:	eb 7c                	jmp    8021d8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80215c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80215f:	83 f8 2f             	cmp    $0x2f,%eax
+  802162:	77 15                	ja     802179 <vprintfmt+0x57d>
+  802164:	89 c2                	mov    %eax,%edx
+  802166:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80216a:	83 c0 08             	add    $0x8,%eax
+  80216d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802170:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802172:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802177:	eb 5f                	jmp    8021d8 <vprintfmt+0x5dc>
+  802179:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80217d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802181:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802185:	eb e9                	jmp    802170 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802187:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80218b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80218f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802193:	eb bd                	jmp    802152 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802195:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802199:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80219d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a1:	e9 57 ff ff ff       	jmp    8020fd <vprintfmt+0x501>
+            putch('0', put_arg);
+  8021a6:	4c 89 ee             	mov    %r13,%rsi
+  8021a9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8021ae:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8021b1:	4c 89 ee             	mov    %r13,%rsi
+  8021b4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8021b9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8021bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c2:	77 47                	ja     80220b <vprintfmt+0x60f>
+  8021c4:	89 c2                	mov    %eax,%edx
+  8021c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ca:	83 c0 08             	add    $0x8,%eax
+  8021cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021d3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8021d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8021dc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8021e0:	0f 94 c0             	sete   %al
+  8021e3:	0f b6 c0             	movzbl %al,%eax
+  8021e6:	50                   	push   %rax
+  8021e7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8021ec:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8021f0:	4c 89 ee             	mov    %r13,%rsi
+  8021f3:	4c 89 f7             	mov    %r14,%rdi
+  8021f6:	48 b8 f1 1a 80 00 00 	movabs $0x801af1,%rax
+  8021fd:	00 00 00 
+  802200:	ff d0                	call   *%rax
+            break;
+  802202:	48 83 c4 10          	add    $0x10,%rsp
+  802206:	e9 31 fa ff ff       	jmp    801c3c <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80220b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80220f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802213:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802217:	eb b7                	jmp    8021d0 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802219:	40 84 f6             	test   %sil,%sil
+  80221c:	75 2b                	jne    802249 <vprintfmt+0x64d>
+    switch (lflag) {
+  80221e:	85 d2                	test   %edx,%edx
+  802220:	7f 56                	jg     802278 <vprintfmt+0x67c>
+  802222:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802225:	7d 77                	jge    80229e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802227:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80222a:	83 f8 2f             	cmp    $0x2f,%eax
+  80222d:	0f 87 a7 00 00 00    	ja     8022da <vprintfmt+0x6de>
+  802233:	89 c2                	mov    %eax,%edx
+  802235:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802239:	83 c0 08             	add    $0x8,%eax
+  80223c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80223f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802242:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802247:	eb 8f                	jmp    8021d8 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802249:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80224c:	83 f8 2f             	cmp    $0x2f,%eax
+  80224f:	77 19                	ja     80226a <vprintfmt+0x66e>
+  802251:	89 c2                	mov    %eax,%edx
+  802253:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802257:	83 c0 08             	add    $0x8,%eax
+  80225a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80225d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802260:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802265:	e9 6e ff ff ff       	jmp    8021d8 <vprintfmt+0x5dc>
+  80226a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80226e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802272:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802276:	eb e5                	jmp    80225d <vprintfmt+0x661>
+    switch (lflag) {
+  802278:	83 fa 01             	cmp    $0x1,%edx
+  80227b:	75 aa                	jne    802227 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80227d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802280:	83 f8 2f             	cmp    $0x2f,%eax
+  802283:	77 47                	ja     8022cc <vprintfmt+0x6d0>
+  802285:	89 c2                	mov    %eax,%edx
+  802287:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80228b:	83 c0 08             	add    $0x8,%eax
+  80228e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802291:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802294:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802299:	e9 3a ff ff ff       	jmp    8021d8 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80229e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8022a4:	77 18                	ja     8022be <vprintfmt+0x6c2>
+  8022a6:	89 c2                	mov    %eax,%edx
+  8022a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ac:	83 c0 08             	add    $0x8,%eax
+  8022af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022b2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8022b4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8022b9:	e9 1a ff ff ff       	jmp    8021d8 <vprintfmt+0x5dc>
+  8022be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022ca:	eb e6                	jmp    8022b2 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8022cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022d8:	eb b7                	jmp    802291 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8022da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e6:	e9 54 ff ff ff       	jmp    80223f <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8022eb:	4c 89 ee             	mov    %r13,%rsi
+  8022ee:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022f3:	41 ff d6             	call   *%r14
+            break;
+  8022f6:	e9 41 f9 ff ff       	jmp    801c3c <vprintfmt+0x40>
+            putch('%', put_arg);
+  8022fb:	4c 89 ee             	mov    %r13,%rsi
+  8022fe:	bf 25 00 00 00       	mov    $0x25,%edi
+  802303:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802306:	48 83 eb 01          	sub    $0x1,%rbx
+  80230a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80230e:	75 f6                	jne    802306 <vprintfmt+0x70a>
+  802310:	e9 27 f9 ff ff       	jmp    801c3c <vprintfmt+0x40>
+
+0000000000802315 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802315:	55                   	push   %rbp
+  802316:	48 89 e5             	mov    %rsp,%rbp
+  802319:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80231d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802321:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802326:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80232a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802331:	48 85 ff             	test   %rdi,%rdi
+  802334:	74 2b                	je     802361 <vsnprintf+0x4c>
+  802336:	48 85 f6             	test   %rsi,%rsi
+  802339:	74 26                	je     802361 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80233b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80233f:	48 bf a7 1b 80 00 00 	movabs $0x801ba7,%rdi
+  802346:	00 00 00 
+  802349:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  802350:	00 00 00 
+  802353:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802355:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802359:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80235c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80235f:	c9                   	leave
+  802360:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802361:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802366:	eb f7                	jmp    80235f <vsnprintf+0x4a>
+
+0000000000802368 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802368:	55                   	push   %rbp
+  802369:	48 89 e5             	mov    %rsp,%rbp
+  80236c:	48 83 ec 50          	sub    $0x50,%rsp
+  802370:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802374:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802378:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80237c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802383:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802387:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80238b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80238f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802393:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802397:	48 b8 15 23 80 00 00 	movabs $0x802315,%rax
+  80239e:	00 00 00 
+  8023a1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8023a3:	c9                   	leave
+  8023a4:	c3                   	ret
+
+00000000008023a5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8023a5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8023a8:	74 10                	je     8023ba <strlen+0x15>
+    size_t n = 0;
+  8023aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8023af:	48 83 c0 01          	add    $0x1,%rax
+  8023b3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8023b7:	75 f6                	jne    8023af <strlen+0xa>
+  8023b9:	c3                   	ret
+    size_t n = 0;
+  8023ba:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8023bf:	c3                   	ret
+
+00000000008023c0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8023c0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8023c3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8023c8:	48 85 f6             	test   %rsi,%rsi
+  8023cb:	74 11                	je     8023de <strnlen+0x1e>
+  8023cd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8023d1:	74 0c                	je     8023df <strnlen+0x1f>
+  8023d3:	48 83 c2 01          	add    $0x1,%rdx
+  8023d7:	48 39 d0             	cmp    %rdx,%rax
+  8023da:	75 f1                	jne    8023cd <strnlen+0xd>
+  8023dc:	eb 04                	jmp    8023e2 <strnlen+0x22>
+  8023de:	c3                   	ret
+  8023df:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8023e2:	c3                   	ret
+
+00000000008023e3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8023e3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8023e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023eb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8023ef:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8023f2:	48 83 c2 01          	add    $0x1,%rdx
+  8023f6:	84 c9                	test   %cl,%cl
+  8023f8:	75 f1                	jne    8023eb <strcpy+0x8>
+        ;
+    return res;
+}
+  8023fa:	c3                   	ret
+
+00000000008023fb <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8023fb:	55                   	push   %rbp
+  8023fc:	48 89 e5             	mov    %rsp,%rbp
+  8023ff:	41 54                	push   %r12
+  802401:	53                   	push   %rbx
+  802402:	48 89 fb             	mov    %rdi,%rbx
+  802405:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802408:	48 b8 a5 23 80 00 00 	movabs $0x8023a5,%rax
+  80240f:	00 00 00 
+  802412:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802414:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802418:	4c 89 e6             	mov    %r12,%rsi
+  80241b:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+    return dst;
+}
+  802427:	48 89 d8             	mov    %rbx,%rax
+  80242a:	5b                   	pop    %rbx
+  80242b:	41 5c                	pop    %r12
+  80242d:	5d                   	pop    %rbp
+  80242e:	c3                   	ret
+
+000000000080242f <toupper>:
+
+int
+toupper(int ch) {
+  80242f:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802431:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802434:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802437:	83 f9 1a             	cmp    $0x1a,%ecx
+  80243a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80243d:	c3                   	ret
+
+000000000080243e <tolower>:
+
+int
+tolower(int ch) {
+  80243e:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802440:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802443:	8d 57 20             	lea    0x20(%rdi),%edx
+  802446:	83 f9 1a             	cmp    $0x1a,%ecx
+  802449:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80244c:	c3                   	ret
+
+000000000080244d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80244d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802450:	48 85 d2             	test   %rdx,%rdx
+  802453:	74 1f                	je     802474 <strncpy+0x27>
+  802455:	48 01 fa             	add    %rdi,%rdx
+  802458:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80245b:	48 83 c1 01          	add    $0x1,%rcx
+  80245f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802463:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802467:	41 80 f8 01          	cmp    $0x1,%r8b
+  80246b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80246f:	48 39 ca             	cmp    %rcx,%rdx
+  802472:	75 e7                	jne    80245b <strncpy+0xe>
+    }
+    return ret;
+}
+  802474:	c3                   	ret
+
+0000000000802475 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802475:	48 89 f8             	mov    %rdi,%rax
+  802478:	48 85 d2             	test   %rdx,%rdx
+  80247b:	74 24                	je     8024a1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80247d:	48 83 ea 01          	sub    $0x1,%rdx
+  802481:	74 1b                	je     80249e <strlcpy+0x29>
+  802483:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802487:	0f b6 16             	movzbl (%rsi),%edx
+  80248a:	84 d2                	test   %dl,%dl
+  80248c:	74 10                	je     80249e <strlcpy+0x29>
+            *dst++ = *src++;
+  80248e:	48 83 c6 01          	add    $0x1,%rsi
+  802492:	48 83 c0 01          	add    $0x1,%rax
+  802496:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802499:	48 39 c8             	cmp    %rcx,%rax
+  80249c:	75 e9                	jne    802487 <strlcpy+0x12>
+        *dst = '\0';
+  80249e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8024a1:	48 29 f8             	sub    %rdi,%rax
+}
+  8024a4:	c3                   	ret
+
+00000000008024a5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8024a5:	0f b6 07             	movzbl (%rdi),%eax
+  8024a8:	84 c0                	test   %al,%al
+  8024aa:	74 13                	je     8024bf <strcmp+0x1a>
+  8024ac:	38 06                	cmp    %al,(%rsi)
+  8024ae:	75 0f                	jne    8024bf <strcmp+0x1a>
+  8024b0:	48 83 c7 01          	add    $0x1,%rdi
+  8024b4:	48 83 c6 01          	add    $0x1,%rsi
+  8024b8:	0f b6 07             	movzbl (%rdi),%eax
+  8024bb:	84 c0                	test   %al,%al
+  8024bd:	75 ed                	jne    8024ac <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8024bf:	0f b6 c0             	movzbl %al,%eax
+  8024c2:	0f b6 16             	movzbl (%rsi),%edx
+  8024c5:	29 d0                	sub    %edx,%eax
+}
+  8024c7:	c3                   	ret
+
+00000000008024c8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8024c8:	48 85 d2             	test   %rdx,%rdx
+  8024cb:	74 1f                	je     8024ec <strncmp+0x24>
+  8024cd:	0f b6 07             	movzbl (%rdi),%eax
+  8024d0:	84 c0                	test   %al,%al
+  8024d2:	74 1e                	je     8024f2 <strncmp+0x2a>
+  8024d4:	3a 06                	cmp    (%rsi),%al
+  8024d6:	75 1a                	jne    8024f2 <strncmp+0x2a>
+  8024d8:	48 83 c7 01          	add    $0x1,%rdi
+  8024dc:	48 83 c6 01          	add    $0x1,%rsi
+  8024e0:	48 83 ea 01          	sub    $0x1,%rdx
+  8024e4:	75 e7                	jne    8024cd <strncmp+0x5>
+
+    if (!n) return 0;
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024eb:	c3                   	ret
+  8024ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f1:	c3                   	ret
+  8024f2:	48 85 d2             	test   %rdx,%rdx
+  8024f5:	74 09                	je     802500 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8024f7:	0f b6 07             	movzbl (%rdi),%eax
+  8024fa:	0f b6 16             	movzbl (%rsi),%edx
+  8024fd:	29 d0                	sub    %edx,%eax
+  8024ff:	c3                   	ret
+    if (!n) return 0;
+  802500:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802505:	c3                   	ret
+
+0000000000802506 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802506:	0f b6 17             	movzbl (%rdi),%edx
+  802509:	84 d2                	test   %dl,%dl
+  80250b:	74 18                	je     802525 <strchr+0x1f>
+        if (*str == c) {
+  80250d:	0f be d2             	movsbl %dl,%edx
+  802510:	39 f2                	cmp    %esi,%edx
+  802512:	74 17                	je     80252b <strchr+0x25>
+    for (; *str; str++) {
+  802514:	48 83 c7 01          	add    $0x1,%rdi
+  802518:	0f b6 17             	movzbl (%rdi),%edx
+  80251b:	84 d2                	test   %dl,%dl
+  80251d:	75 ee                	jne    80250d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80251f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802524:	c3                   	ret
+  802525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252a:	c3                   	ret
+  80252b:	48 89 f8             	mov    %rdi,%rax
+}
+  80252e:	c3                   	ret
+
+000000000080252f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80252f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802532:	0f b6 17             	movzbl (%rdi),%edx
+  802535:	84 d2                	test   %dl,%dl
+  802537:	74 13                	je     80254c <strfind+0x1d>
+  802539:	0f be d2             	movsbl %dl,%edx
+  80253c:	39 f2                	cmp    %esi,%edx
+  80253e:	74 0b                	je     80254b <strfind+0x1c>
+  802540:	48 83 c0 01          	add    $0x1,%rax
+  802544:	0f b6 10             	movzbl (%rax),%edx
+  802547:	84 d2                	test   %dl,%dl
+  802549:	75 ee                	jne    802539 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80254b:	c3                   	ret
+  80254c:	c3                   	ret
+
+000000000080254d <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80254d:	48 39 f7             	cmp    %rsi,%rdi
+  802550:	74 65                	je     8025b7 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802552:	55                   	push   %rbp
+  802553:	48 89 e5             	mov    %rsp,%rbp
+  802556:	41 57                	push   %r15
+  802558:	41 56                	push   %r14
+  80255a:	41 55                	push   %r13
+  80255c:	41 54                	push   %r12
+  80255e:	53                   	push   %rbx
+  80255f:	48 83 ec 18          	sub    $0x18,%rsp
+  802563:	48 89 fb             	mov    %rdi,%rbx
+  802566:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802569:	49 bf 3e 24 80 00 00 	movabs $0x80243e,%r15
+  802570:	00 00 00 
+  802573:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802577:	41 0f b6 fd          	movzbl %r13b,%edi
+  80257b:	41 ff d7             	call   *%r15
+  80257e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802581:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802586:	41 0f b6 fe          	movzbl %r14b,%edi
+  80258a:	41 ff d7             	call   *%r15
+  80258d:	89 c2                	mov    %eax,%edx
+  80258f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802592:	29 d0                	sub    %edx,%eax
+  802594:	75 12                	jne    8025a8 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802596:	48 83 c3 01          	add    $0x1,%rbx
+  80259a:	45 84 ed             	test   %r13b,%r13b
+  80259d:	74 09                	je     8025a8 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80259f:	49 83 c4 01          	add    $0x1,%r12
+  8025a3:	45 84 f6             	test   %r14b,%r14b
+  8025a6:	75 cb                	jne    802573 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8025a8:	48 83 c4 18          	add    $0x18,%rsp
+  8025ac:	5b                   	pop    %rbx
+  8025ad:	41 5c                	pop    %r12
+  8025af:	41 5d                	pop    %r13
+  8025b1:	41 5e                	pop    %r14
+  8025b3:	41 5f                	pop    %r15
+  8025b5:	5d                   	pop    %rbp
+  8025b6:	c3                   	ret
+    if (p1 == p2) return 0;
+  8025b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025bc:	c3                   	ret
+
+00000000008025bd <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8025bd:	48 39 f7             	cmp    %rsi,%rdi
+  8025c0:	74 7d                	je     80263f <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8025c2:	55                   	push   %rbp
+  8025c3:	48 89 e5             	mov    %rsp,%rbp
+  8025c6:	41 57                	push   %r15
+  8025c8:	41 56                	push   %r14
+  8025ca:	41 55                	push   %r13
+  8025cc:	41 54                	push   %r12
+  8025ce:	53                   	push   %rbx
+  8025cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8025d3:	48 89 fb             	mov    %rdi,%rbx
+  8025d6:	49 89 f4             	mov    %rsi,%r12
+  8025d9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8025dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8025e1:	49 bf 3e 24 80 00 00 	movabs $0x80243e,%r15
+  8025e8:	00 00 00 
+    while (n--) {
+  8025eb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025ef:	48 39 c3             	cmp    %rax,%rbx
+  8025f2:	74 37                	je     80262b <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8025f4:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8025f8:	41 0f b6 fd          	movzbl %r13b,%edi
+  8025fc:	41 ff d7             	call   *%r15
+  8025ff:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802602:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802607:	41 0f b6 fe          	movzbl %r14b,%edi
+  80260b:	41 ff d7             	call   *%r15
+  80260e:	89 c2                	mov    %eax,%edx
+  802610:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802613:	29 d0                	sub    %edx,%eax
+  802615:	75 19                	jne    802630 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802617:	48 83 c3 01          	add    $0x1,%rbx
+  80261b:	45 84 ed             	test   %r13b,%r13b
+  80261e:	74 10                	je     802630 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802620:	49 83 c4 01          	add    $0x1,%r12
+  802624:	45 84 f6             	test   %r14b,%r14b
+  802627:	75 c2                	jne    8025eb <strncasecmp+0x2e>
+  802629:	eb 05                	jmp    802630 <strncasecmp+0x73>
+  80262b:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802630:	48 83 c4 18          	add    $0x18,%rsp
+  802634:	5b                   	pop    %rbx
+  802635:	41 5c                	pop    %r12
+  802637:	41 5d                	pop    %r13
+  802639:	41 5e                	pop    %r14
+  80263b:	41 5f                	pop    %r15
+  80263d:	5d                   	pop    %rbp
+  80263e:	c3                   	ret
+    if (p1 == p2) return 0;
+  80263f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802644:	c3                   	ret
+
+0000000000802645 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802645:	83 e7 df             	and    $0xffffffdf,%edi
+  802648:	83 ef 41             	sub    $0x41,%edi
+  80264b:	83 ff 19             	cmp    $0x19,%edi
+  80264e:	0f 96 c0             	setbe  %al
+}
+  802651:	c3                   	ret
+
+0000000000802652 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802652:	83 ff 20             	cmp    $0x20,%edi
+  802655:	0f 94 c0             	sete   %al
+  802658:	83 ff 09             	cmp    $0x9,%edi
+  80265b:	0f 94 c2             	sete   %dl
+  80265e:	09 d0                	or     %edx,%eax
+}
+  802660:	c3                   	ret
+
+0000000000802661 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802661:	55                   	push   %rbp
+  802662:	48 89 e5             	mov    %rsp,%rbp
+  802665:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802667:	48 bf 3f 68 80 00 00 	movabs $0x80683f,%rdi
+  80266e:	00 00 00 
+  802671:	48 b8 06 25 80 00 00 	movabs $0x802506,%rax
+  802678:	00 00 00 
+  80267b:	ff d0                	call   *%rax
+  80267d:	48 85 c0             	test   %rax,%rax
+  802680:	0f 95 c0             	setne  %al
+}
+  802683:	5d                   	pop    %rbp
+  802684:	c3                   	ret
+
+0000000000802685 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802685:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802688:	48 89 f8             	mov    %rdi,%rax
+  80268b:	48 f7 d8             	neg    %rax
+  80268e:	83 e0 07             	and    $0x7,%eax
+  802691:	49 89 d1             	mov    %rdx,%r9
+  802694:	49 29 c1             	sub    %rax,%r9
+  802697:	78 36                	js     8026cf <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802699:	40 0f b6 c6          	movzbl %sil,%eax
+  80269d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026a4:	01 01 01 
+  8026a7:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026ab:	40 f6 c7 07          	test   $0x7,%dil
+  8026af:	75 38                	jne    8026e9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026b1:	4c 89 c9             	mov    %r9,%rcx
+  8026b4:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026b8:	74 0c                	je     8026c6 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026ba:	fc                   	cld
+  8026bb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8026be:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8026c2:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8026c6:	4d 85 c9             	test   %r9,%r9
+  8026c9:	75 45                	jne    802710 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8026cb:	4c 89 c0             	mov    %r8,%rax
+  8026ce:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8026cf:	48 85 d2             	test   %rdx,%rdx
+  8026d2:	74 f7                	je     8026cb <memset+0x46>
+  8026d4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8026d7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8026da:	48 83 c0 01          	add    $0x1,%rax
+  8026de:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8026e2:	48 39 c2             	cmp    %rax,%rdx
+  8026e5:	75 f3                	jne    8026da <memset+0x55>
+  8026e7:	eb e2                	jmp    8026cb <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8026e9:	40 f6 c7 01          	test   $0x1,%dil
+  8026ed:	74 06                	je     8026f5 <memset+0x70>
+  8026ef:	88 07                	mov    %al,(%rdi)
+  8026f1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026f5:	40 f6 c7 02          	test   $0x2,%dil
+  8026f9:	74 07                	je     802702 <memset+0x7d>
+  8026fb:	66 89 07             	mov    %ax,(%rdi)
+  8026fe:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802702:	40 f6 c7 04          	test   $0x4,%dil
+  802706:	74 a9                	je     8026b1 <memset+0x2c>
+  802708:	89 07                	mov    %eax,(%rdi)
+  80270a:	48 83 c7 04          	add    $0x4,%rdi
+  80270e:	eb a1                	jmp    8026b1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802710:	41 f6 c1 04          	test   $0x4,%r9b
+  802714:	74 06                	je     80271c <memset+0x97>
+  802716:	89 07                	mov    %eax,(%rdi)
+  802718:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80271c:	41 f6 c1 02          	test   $0x2,%r9b
+  802720:	74 07                	je     802729 <memset+0xa4>
+  802722:	66 89 07             	mov    %ax,(%rdi)
+  802725:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802729:	41 f6 c1 01          	test   $0x1,%r9b
+  80272d:	74 9c                	je     8026cb <memset+0x46>
+  80272f:	88 07                	mov    %al,(%rdi)
+  802731:	eb 98                	jmp    8026cb <memset+0x46>
+
+0000000000802733 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802733:	48 89 f8             	mov    %rdi,%rax
+  802736:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802739:	48 39 fe             	cmp    %rdi,%rsi
+  80273c:	73 3b                	jae    802779 <memmove+0x46>
+  80273e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802742:	48 39 d7             	cmp    %rdx,%rdi
+  802745:	73 32                	jae    802779 <memmove+0x46>
+        s += n;
+        d += n;
+  802747:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80274b:	48 89 d6             	mov    %rdx,%rsi
+  80274e:	48 09 fe             	or     %rdi,%rsi
+  802751:	48 09 ce             	or     %rcx,%rsi
+  802754:	40 f6 c6 07          	test   $0x7,%sil
+  802758:	75 12                	jne    80276c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80275a:	48 83 ef 08          	sub    $0x8,%rdi
+  80275e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802762:	48 c1 e9 03          	shr    $0x3,%rcx
+  802766:	fd                   	std
+  802767:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80276a:	fc                   	cld
+  80276b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80276c:	48 83 ef 01          	sub    $0x1,%rdi
+  802770:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802774:	fd                   	std
+  802775:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802777:	eb f1                	jmp    80276a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802779:	48 89 f2             	mov    %rsi,%rdx
+  80277c:	48 09 c2             	or     %rax,%rdx
+  80277f:	48 09 ca             	or     %rcx,%rdx
+  802782:	f6 c2 07             	test   $0x7,%dl
+  802785:	75 0c                	jne    802793 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802787:	48 c1 e9 03          	shr    $0x3,%rcx
+  80278b:	48 89 c7             	mov    %rax,%rdi
+  80278e:	fc                   	cld
+  80278f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802792:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802793:	48 89 c7             	mov    %rax,%rdi
+  802796:	fc                   	cld
+  802797:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802799:	c3                   	ret
+
+000000000080279a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80279e:	48 b8 33 27 80 00 00 	movabs $0x802733,%rax
+  8027a5:	00 00 00 
+  8027a8:	ff d0                	call   *%rax
+}
+  8027aa:	5d                   	pop    %rbp
+  8027ab:	c3                   	ret
+
+00000000008027ac <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027ac:	55                   	push   %rbp
+  8027ad:	48 89 e5             	mov    %rsp,%rbp
+  8027b0:	41 57                	push   %r15
+  8027b2:	41 56                	push   %r14
+  8027b4:	41 55                	push   %r13
+  8027b6:	41 54                	push   %r12
+  8027b8:	53                   	push   %rbx
+  8027b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bd:	49 89 fe             	mov    %rdi,%r14
+  8027c0:	49 89 f7             	mov    %rsi,%r15
+  8027c3:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8027c6:	48 89 f7             	mov    %rsi,%rdi
+  8027c9:	48 b8 a5 23 80 00 00 	movabs $0x8023a5,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8027d8:	48 89 de             	mov    %rbx,%rsi
+  8027db:	4c 89 f7             	mov    %r14,%rdi
+  8027de:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  8027e5:	00 00 00 
+  8027e8:	ff d0                	call   *%rax
+  8027ea:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027ed:	48 39 c3             	cmp    %rax,%rbx
+  8027f0:	74 36                	je     802828 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8027f2:	48 89 d8             	mov    %rbx,%rax
+  8027f5:	4c 29 e8             	sub    %r13,%rax
+  8027f8:	49 39 c4             	cmp    %rax,%r12
+  8027fb:	73 31                	jae    80282e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8027fd:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802802:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802806:	4c 89 fe             	mov    %r15,%rsi
+  802809:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  802810:	00 00 00 
+  802813:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802815:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802819:	48 83 c4 08          	add    $0x8,%rsp
+  80281d:	5b                   	pop    %rbx
+  80281e:	41 5c                	pop    %r12
+  802820:	41 5d                	pop    %r13
+  802822:	41 5e                	pop    %r14
+  802824:	41 5f                	pop    %r15
+  802826:	5d                   	pop    %rbp
+  802827:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802828:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80282c:	eb eb                	jmp    802819 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80282e:	48 83 eb 01          	sub    $0x1,%rbx
+  802832:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802836:	48 89 da             	mov    %rbx,%rdx
+  802839:	4c 89 fe             	mov    %r15,%rsi
+  80283c:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  802843:	00 00 00 
+  802846:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802848:	49 01 de             	add    %rbx,%r14
+  80284b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802850:	eb c3                	jmp    802815 <strlcat+0x69>
+
+0000000000802852 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802852:	48 85 d2             	test   %rdx,%rdx
+  802855:	74 2d                	je     802884 <memcmp+0x32>
+  802857:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80285c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802860:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802865:	44 38 c1             	cmp    %r8b,%cl
+  802868:	75 0f                	jne    802879 <memcmp+0x27>
+    while (n-- > 0) {
+  80286a:	48 83 c0 01          	add    $0x1,%rax
+  80286e:	48 39 c2             	cmp    %rax,%rdx
+  802871:	75 e9                	jne    80285c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802873:	b8 00 00 00 00       	mov    $0x0,%eax
+  802878:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802879:	0f b6 c1             	movzbl %cl,%eax
+  80287c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802880:	44 29 c0             	sub    %r8d,%eax
+  802883:	c3                   	ret
+    return 0;
+  802884:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802889:	c3                   	ret
+
+000000000080288a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80288a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80288e:	48 39 c7             	cmp    %rax,%rdi
+  802891:	73 0f                	jae    8028a2 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802893:	40 38 37             	cmp    %sil,(%rdi)
+  802896:	74 0e                	je     8028a6 <memfind+0x1c>
+    for (; src < end; src++) {
+  802898:	48 83 c7 01          	add    $0x1,%rdi
+  80289c:	48 39 f8             	cmp    %rdi,%rax
+  80289f:	75 f2                	jne    802893 <memfind+0x9>
+  8028a1:	c3                   	ret
+  8028a2:	48 89 f8             	mov    %rdi,%rax
+  8028a5:	c3                   	ret
+  8028a6:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028a9:	c3                   	ret
+
+00000000008028aa <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028aa:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028ad:	0f b6 37             	movzbl (%rdi),%esi
+  8028b0:	40 80 fe 20          	cmp    $0x20,%sil
+  8028b4:	74 06                	je     8028bc <strtol+0x12>
+  8028b6:	40 80 fe 09          	cmp    $0x9,%sil
+  8028ba:	75 13                	jne    8028cf <strtol+0x25>
+  8028bc:	48 83 c7 01          	add    $0x1,%rdi
+  8028c0:	0f b6 37             	movzbl (%rdi),%esi
+  8028c3:	40 80 fe 20          	cmp    $0x20,%sil
+  8028c7:	74 f3                	je     8028bc <strtol+0x12>
+  8028c9:	40 80 fe 09          	cmp    $0x9,%sil
+  8028cd:	74 ed                	je     8028bc <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8028cf:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8028d2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8028d5:	3c 01                	cmp    $0x1,%al
+  8028d7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028db:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8028e1:	75 0f                	jne    8028f2 <strtol+0x48>
+  8028e3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8028e6:	74 14                	je     8028fc <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8028e8:	85 d2                	test   %edx,%edx
+  8028ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8028ef:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8028f2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8028f7:	4c 63 ca             	movslq %edx,%r9
+  8028fa:	eb 36                	jmp    802932 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028fc:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802900:	74 0f                	je     802911 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802902:	85 d2                	test   %edx,%edx
+  802904:	75 ec                	jne    8028f2 <strtol+0x48>
+        s++;
+  802906:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80290a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80290f:	eb e1                	jmp    8028f2 <strtol+0x48>
+        s += 2;
+  802911:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802915:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80291a:	eb d6                	jmp    8028f2 <strtol+0x48>
+            dig -= '0';
+  80291c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80291f:	44 0f b6 c1          	movzbl %cl,%r8d
+  802923:	41 39 d0             	cmp    %edx,%r8d
+  802926:	7d 21                	jge    802949 <strtol+0x9f>
+        val = val * base + dig;
+  802928:	49 0f af c1          	imul   %r9,%rax
+  80292c:	0f b6 c9             	movzbl %cl,%ecx
+  80292f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802932:	48 83 c7 01          	add    $0x1,%rdi
+  802936:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80293a:	80 f9 39             	cmp    $0x39,%cl
+  80293d:	76 dd                	jbe    80291c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80293f:	80 f9 7b             	cmp    $0x7b,%cl
+  802942:	77 05                	ja     802949 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802944:	83 e9 57             	sub    $0x57,%ecx
+  802947:	eb d6                	jmp    80291f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802949:	4d 85 d2             	test   %r10,%r10
+  80294c:	74 03                	je     802951 <strtol+0xa7>
+  80294e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802951:	48 89 c2             	mov    %rax,%rdx
+  802954:	48 f7 da             	neg    %rdx
+  802957:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80295b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80295f:	c3                   	ret
+
+0000000000802960 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802960:	55                   	push   %rbp
+  802961:	48 89 e5             	mov    %rsp,%rbp
+  802964:	53                   	push   %rbx
+  802965:	48 89 fa             	mov    %rdi,%rdx
+  802968:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80296b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802970:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802975:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297a:	be 00 00 00 00       	mov    $0x0,%esi
+  80297f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802985:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80298b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80298d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+
+0000000000802993 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802993:	55                   	push   %rbp
+  802994:	48 89 e5             	mov    %rsp,%rbp
+  802997:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802998:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80299d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029c2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+00000000008029ca <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8029ca:	55                   	push   %rbp
+  8029cb:	48 89 e5             	mov    %rsp,%rbp
+  8029ce:	53                   	push   %rbx
+  8029cf:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f7:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8029f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029fd:	c9                   	leave
+  8029fe:	c3                   	ret
+
+00000000008029ff <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8029ff:	55                   	push   %rbp
+  802a00:	48 89 e5             	mov    %rsp,%rbp
+  802a03:	53                   	push   %rbx
+  802a04:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802a08:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a0b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a10:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a1a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a1f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a30:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a32:	48 85 c0             	test   %rax,%rax
+  802a35:	7f 06                	jg     802a3d <sys_env_destroy+0x3e>
+}
+  802a37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a3b:	c9                   	leave
+  802a3c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a3d:	49 89 c0             	mov    %rax,%r8
+  802a40:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802a45:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802a4c:	00 00 00 
+  802a4f:	be 27 00 00 00       	mov    $0x27,%esi
+  802a54:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802a5b:	00 00 00 
+  802a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a63:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802a6a:	00 00 00 
+  802a6d:	41 ff d1             	call   *%r9
+
+0000000000802a70 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a70:	55                   	push   %rbp
+  802a71:	48 89 e5             	mov    %rsp,%rbp
+  802a74:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a75:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a8e:	be 00 00 00 00       	mov    $0x0,%esi
+  802a93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a99:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a9f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802aa1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa5:	c9                   	leave
+  802aa6:	c3                   	ret
+
+0000000000802aa7 <sys_yield>:
+
+void
+sys_yield(void) {
+  802aa7:	55                   	push   %rbp
+  802aa8:	48 89 e5             	mov    %rsp,%rbp
+  802aab:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802aac:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ab1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802abb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ad0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad6:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ad8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802adc:	c9                   	leave
+  802add:	c3                   	ret
+
+0000000000802ade <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802ade:	55                   	push   %rbp
+  802adf:	48 89 e5             	mov    %rsp,%rbp
+  802ae2:	53                   	push   %rbx
+  802ae3:	48 89 fa             	mov    %rdi,%rdx
+  802ae6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802ae9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aee:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802af5:	00 00 00 
+  802af8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802afd:	be 00 00 00 00       	mov    $0x0,%esi
+  802b02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b0e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802b10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b14:	c9                   	leave
+  802b15:	c3                   	ret
+
+0000000000802b16 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802b16:	55                   	push   %rbp
+  802b17:	48 89 e5             	mov    %rsp,%rbp
+  802b1a:	53                   	push   %rbx
+  802b1b:	49 89 f8             	mov    %rdi,%r8
+  802b1e:	48 89 d3             	mov    %rdx,%rbx
+  802b21:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802b24:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b29:	4c 89 c2             	mov    %r8,%rdx
+  802b2c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b40:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802b42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b46:	c9                   	leave
+  802b47:	c3                   	ret
+
+0000000000802b48 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802b48:	55                   	push   %rbp
+  802b49:	48 89 e5             	mov    %rsp,%rbp
+  802b4c:	53                   	push   %rbx
+  802b4d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b51:	89 f8                	mov    %edi,%eax
+  802b53:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802b56:	48 63 f9             	movslq %ecx,%rdi
+  802b59:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b5c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b61:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b64:	be 00 00 00 00       	mov    $0x0,%esi
+  802b69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b75:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b77:	48 85 c0             	test   %rax,%rax
+  802b7a:	7f 06                	jg     802b82 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b7c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b80:	c9                   	leave
+  802b81:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b82:	49 89 c0             	mov    %rax,%r8
+  802b85:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b8a:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802b91:	00 00 00 
+  802b94:	be 27 00 00 00       	mov    $0x27,%esi
+  802b99:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802ba0:	00 00 00 
+  802ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba8:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802baf:	00 00 00 
+  802bb2:	41 ff d1             	call   *%r9
+
+0000000000802bb5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802bb5:	55                   	push   %rbp
+  802bb6:	48 89 e5             	mov    %rsp,%rbp
+  802bb9:	53                   	push   %rbx
+  802bba:	48 83 ec 08          	sub    $0x8,%rsp
+  802bbe:	89 f8                	mov    %edi,%eax
+  802bc0:	49 89 f2             	mov    %rsi,%r10
+  802bc3:	48 89 cf             	mov    %rcx,%rdi
+  802bc6:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802bc9:	48 63 da             	movslq %edx,%rbx
+  802bcc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bcf:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bd4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd7:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802bda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802be0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be2:	48 85 c0             	test   %rax,%rax
+  802be5:	7f 06                	jg     802bed <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802be7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802beb:	c9                   	leave
+  802bec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bed:	49 89 c0             	mov    %rax,%r8
+  802bf0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802bf5:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802bfc:	00 00 00 
+  802bff:	be 27 00 00 00       	mov    $0x27,%esi
+  802c04:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802c0b:	00 00 00 
+  802c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c13:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802c1a:	00 00 00 
+  802c1d:	41 ff d1             	call   *%r9
+
+0000000000802c20 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802c20:	55                   	push   %rbp
+  802c21:	48 89 e5             	mov    %rsp,%rbp
+  802c24:	53                   	push   %rbx
+  802c25:	48 83 ec 08          	sub    $0x8,%rsp
+  802c29:	48 89 f1             	mov    %rsi,%rcx
+  802c2c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802c2f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c32:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c37:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c3c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c41:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c47:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c4d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c4f:	48 85 c0             	test   %rax,%rax
+  802c52:	7f 06                	jg     802c5a <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802c54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c58:	c9                   	leave
+  802c59:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5a:	49 89 c0             	mov    %rax,%r8
+  802c5d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c62:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802c69:	00 00 00 
+  802c6c:	be 27 00 00 00       	mov    $0x27,%esi
+  802c71:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802c78:	00 00 00 
+  802c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c80:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802c87:	00 00 00 
+  802c8a:	41 ff d1             	call   *%r9
+
+0000000000802c8d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c8d:	55                   	push   %rbp
+  802c8e:	48 89 e5             	mov    %rsp,%rbp
+  802c91:	53                   	push   %rbx
+  802c92:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c96:	48 63 ce             	movslq %esi,%rcx
+  802c99:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c9c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cab:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cbe:	48 85 c0             	test   %rax,%rax
+  802cc1:	7f 06                	jg     802cc9 <sys_env_set_status+0x3c>
+}
+  802cc3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc7:	c9                   	leave
+  802cc8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cc9:	49 89 c0             	mov    %rax,%r8
+  802ccc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802cd1:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802cd8:	00 00 00 
+  802cdb:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce0:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802ce7:	00 00 00 
+  802cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cef:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802cf6:	00 00 00 
+  802cf9:	41 ff d1             	call   *%r9
+
+0000000000802cfc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802cfc:	55                   	push   %rbp
+  802cfd:	48 89 e5             	mov    %rsp,%rbp
+  802d00:	53                   	push   %rbx
+  802d01:	48 83 ec 08          	sub    $0x8,%rsp
+  802d05:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802d08:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d0b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d15:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d1a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d25:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d2d:	48 85 c0             	test   %rax,%rax
+  802d30:	7f 06                	jg     802d38 <sys_env_set_trapframe+0x3c>
+}
+  802d32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d36:	c9                   	leave
+  802d37:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d38:	49 89 c0             	mov    %rax,%r8
+  802d3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802d40:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802d47:	00 00 00 
+  802d4a:	be 27 00 00 00       	mov    $0x27,%esi
+  802d4f:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802d56:	00 00 00 
+  802d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5e:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802d65:	00 00 00 
+  802d68:	41 ff d1             	call   *%r9
+
+0000000000802d6b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802d6b:	55                   	push   %rbp
+  802d6c:	48 89 e5             	mov    %rsp,%rbp
+  802d6f:	53                   	push   %rbx
+  802d70:	48 83 ec 08          	sub    $0x8,%rsp
+  802d74:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d77:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d84:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d89:	be 00 00 00 00       	mov    $0x0,%esi
+  802d8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d94:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d9a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d9c:	48 85 c0             	test   %rax,%rax
+  802d9f:	7f 06                	jg     802da7 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802da1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da5:	c9                   	leave
+  802da6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802da7:	49 89 c0             	mov    %rax,%r8
+  802daa:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802daf:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802db6:	00 00 00 
+  802db9:	be 27 00 00 00       	mov    $0x27,%esi
+  802dbe:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802dc5:	00 00 00 
+  802dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcd:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802dd4:	00 00 00 
+  802dd7:	41 ff d1             	call   *%r9
+
+0000000000802dda <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	53                   	push   %rbx
+  802ddf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802de3:	40 0f b6 ce          	movzbl %sil,%ecx
+  802de7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dea:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802def:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802df9:	be 00 00 00 00       	mov    $0x0,%esi
+  802dfe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e04:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e0a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e0c:	48 85 c0             	test   %rax,%rax
+  802e0f:	7f 06                	jg     802e17 <sys_env_set_reclaim+0x3d>
+}
+  802e11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e15:	c9                   	leave
+  802e16:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e17:	49 89 c0             	mov    %rax,%r8
+  802e1a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802e1f:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802e26:	00 00 00 
+  802e29:	be 27 00 00 00       	mov    $0x27,%esi
+  802e2e:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802e35:	00 00 00 
+  802e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3d:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802e44:	00 00 00 
+  802e47:	41 ff d1             	call   *%r9
+
+0000000000802e4a <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802e4a:	55                   	push   %rbp
+  802e4b:	48 89 e5             	mov    %rsp,%rbp
+  802e4e:	53                   	push   %rbx
+  802e4f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802e53:	48 63 ce             	movslq %esi,%rcx
+  802e56:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e59:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e63:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e68:	be 00 00 00 00       	mov    $0x0,%esi
+  802e6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e73:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e79:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e7b:	48 85 c0             	test   %rax,%rax
+  802e7e:	7f 06                	jg     802e86 <sys_env_set_nice+0x3c>
+}
+  802e80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e84:	c9                   	leave
+  802e85:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e86:	49 89 c0             	mov    %rax,%r8
+  802e89:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e8e:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802e95:	00 00 00 
+  802e98:	be 27 00 00 00       	mov    $0x27,%esi
+  802e9d:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802ea4:	00 00 00 
+  802ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eac:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802eb3:	00 00 00 
+  802eb6:	41 ff d1             	call   *%r9
+
+0000000000802eb9 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802eb9:	55                   	push   %rbp
+  802eba:	48 89 e5             	mov    %rsp,%rbp
+  802ebd:	53                   	push   %rbx
+  802ebe:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ec1:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ec6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ecb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ed0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ed5:	be 00 00 00 00       	mov    $0x0,%esi
+  802eda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ee0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ee6:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ee8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eec:	c9                   	leave
+  802eed:	c3                   	ret
+
+0000000000802eee <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802eee:	55                   	push   %rbp
+  802eef:	48 89 e5             	mov    %rsp,%rbp
+  802ef2:	53                   	push   %rbx
+  802ef3:	89 f8                	mov    %edi,%eax
+  802ef5:	49 89 f1             	mov    %rsi,%r9
+  802ef8:	48 89 d3             	mov    %rdx,%rbx
+  802efb:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802efe:	49 63 f0             	movslq %r8d,%rsi
+  802f01:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f04:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f09:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f12:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f18:	cd 30                	int    $0x30
+}
+  802f1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+
+0000000000802f20 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802f20:	55                   	push   %rbp
+  802f21:	48 89 e5             	mov    %rsp,%rbp
+  802f24:	53                   	push   %rbx
+  802f25:	89 f8                	mov    %edi,%eax
+  802f27:	49 89 f1             	mov    %rsi,%r9
+  802f2a:	48 89 d3             	mov    %rdx,%rbx
+  802f2d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802f30:	49 63 f0             	movslq %r8d,%rsi
+  802f33:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f36:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f3b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f3e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f44:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f4a:	cd 30                	int    $0x30
+}
+  802f4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f50:	c9                   	leave
+  802f51:	c3                   	ret
+
+0000000000802f52 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f52:	55                   	push   %rbp
+  802f53:	48 89 e5             	mov    %rsp,%rbp
+  802f56:	53                   	push   %rbx
+  802f57:	48 83 ec 08          	sub    $0x8,%rsp
+  802f5b:	89 f8                	mov    %edi,%eax
+  802f5d:	49 89 f2             	mov    %rsi,%r10
+  802f60:	48 89 d3             	mov    %rdx,%rbx
+  802f63:	48 89 cf             	mov    %rcx,%rdi
+  802f66:	44 89 c6             	mov    %r8d,%esi
+  802f69:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f6c:	48 63 f6             	movslq %esi,%rsi
+  802f6f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f72:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f77:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f7a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f7e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f80:	48 85 c0             	test   %rax,%rax
+  802f83:	7f 06                	jg     802f8b <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f89:	c9                   	leave
+  802f8a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f8b:	49 89 c0             	mov    %rax,%r8
+  802f8e:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f93:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  802f9a:	00 00 00 
+  802f9d:	be 27 00 00 00       	mov    $0x27,%esi
+  802fa2:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  802fa9:	00 00 00 
+  802fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb1:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  802fb8:	00 00 00 
+  802fbb:	41 ff d1             	call   *%r9
+
+0000000000802fbe <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802fbe:	55                   	push   %rbp
+  802fbf:	48 89 e5             	mov    %rsp,%rbp
+  802fc2:	53                   	push   %rbx
+  802fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc7:	48 89 f1             	mov    %rsi,%rcx
+  802fca:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802fcd:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802fd1:	48 8b 1a             	mov    (%rdx),%rbx
+  802fd4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fd7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fdc:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fe0:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802fe4:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802fe8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fea:	48 85 c0             	test   %rax,%rax
+  802fed:	7f 06                	jg     802ff5 <sys_ipc_call_short+0x37>
+}
+  802fef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff3:	c9                   	leave
+  802ff4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ff5:	49 89 c0             	mov    %rax,%r8
+  802ff8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802ffd:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  803004:	00 00 00 
+  803007:	be 27 00 00 00       	mov    $0x27,%esi
+  80300c:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  803013:	00 00 00 
+  803016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301b:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  803022:	00 00 00 
+  803025:	41 ff d1             	call   *%r9
+
+0000000000803028 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  803028:	55                   	push   %rbp
+  803029:	48 89 e5             	mov    %rsp,%rbp
+  80302c:	53                   	push   %rbx
+  80302d:	48 83 ec 08          	sub    $0x8,%rsp
+  803031:	89 f8                	mov    %edi,%eax
+  803033:	49 89 f2             	mov    %rsi,%r10
+  803036:	48 89 d3             	mov    %rdx,%rbx
+  803039:	48 89 cf             	mov    %rcx,%rdi
+  80303c:	44 89 c6             	mov    %r8d,%esi
+  80303f:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803042:	48 63 f6             	movslq %esi,%rsi
+  803045:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803048:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80304d:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803050:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803054:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803056:	48 85 c0             	test   %rax,%rax
+  803059:	7f 06                	jg     803061 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80305b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80305f:	c9                   	leave
+  803060:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803061:	49 89 c0             	mov    %rax,%r8
+  803064:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803069:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  803070:	00 00 00 
+  803073:	be 27 00 00 00       	mov    $0x27,%esi
+  803078:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  80307f:	00 00 00 
+  803082:	b8 00 00 00 00       	mov    $0x0,%eax
+  803087:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  80308e:	00 00 00 
+  803091:	41 ff d1             	call   *%r9
+
+0000000000803094 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803094:	55                   	push   %rbp
+  803095:	48 89 e5             	mov    %rsp,%rbp
+  803098:	53                   	push   %rbx
+  803099:	48 83 ec 08          	sub    $0x8,%rsp
+  80309d:	48 89 fa             	mov    %rdi,%rdx
+  8030a0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8030a3:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8030c5:	48 85 c0             	test   %rax,%rax
+  8030c8:	7f 06                	jg     8030d0 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8030ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030ce:	c9                   	leave
+  8030cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8030d0:	49 89 c0             	mov    %rax,%r8
+  8030d3:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8030d8:	48 ba 48 68 80 00 00 	movabs $0x806848,%rdx
+  8030df:	00 00 00 
+  8030e2:	be 27 00 00 00       	mov    $0x27,%esi
+  8030e7:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  8030ee:	00 00 00 
+  8030f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f6:	49 b9 5c 19 80 00 00 	movabs $0x80195c,%r9
+  8030fd:	00 00 00 
+  803100:	41 ff d1             	call   *%r9
+
+0000000000803103 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803103:	55                   	push   %rbp
+  803104:	48 89 e5             	mov    %rsp,%rbp
+  803107:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803108:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80310d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803112:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803117:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80311c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803121:	be 00 00 00 00       	mov    $0x0,%esi
+  803126:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80312c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803132:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803134:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803138:	c9                   	leave
+  803139:	c3                   	ret
+
+000000000080313a <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  80313a:	55                   	push   %rbp
+  80313b:	48 89 e5             	mov    %rsp,%rbp
+  80313e:	53                   	push   %rbx
+  80313f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803142:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803147:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80314c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803151:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803156:	be 00 00 00 00       	mov    $0x0,%esi
+  80315b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803161:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803167:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803169:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80316d:	c9                   	leave
+  80316e:	c3                   	ret
+
+000000000080316f <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  80316f:	55                   	push   %rbp
+  803170:	48 89 e5             	mov    %rsp,%rbp
+  803173:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803174:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80317e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803188:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80318d:	be 00 00 00 00       	mov    $0x0,%esi
+  803192:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803198:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80319e:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8031a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031a4:	c9                   	leave
+  8031a5:	c3                   	ret
+
+00000000008031a6 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8031a6:	55                   	push   %rbp
+  8031a7:	48 89 e5             	mov    %rsp,%rbp
+  8031aa:	53                   	push   %rbx
+  8031ab:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8031af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8031b4:	cd 30                	int    $0x30
+  8031b6:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  8031b8:	85 c0                	test   %eax,%eax
+  8031ba:	0f 88 85 00 00 00    	js     803245 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  8031c0:	0f 84 ac 00 00 00    	je     803272 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  8031c6:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8031cc:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8031d3:	00 00 00 
+  8031d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031db:	89 c2                	mov    %eax,%edx
+  8031dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031e7:	48 b8 b5 2b 80 00 00 	movabs $0x802bb5,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+  8031f3:	85 c0                	test   %eax,%eax
+  8031f5:	0f 88 a8 00 00 00    	js     8032a3 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8031fb:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803202:	00 00 00 
+  803205:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  80320c:	89 df                	mov    %ebx,%edi
+  80320e:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  803215:	00 00 00 
+  803218:	ff d0                	call   *%rax
+  80321a:	85 c0                	test   %eax,%eax
+  80321c:	0f 88 ae 00 00 00    	js     8032d0 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  803222:	be 02 00 00 00       	mov    $0x2,%esi
+  803227:	89 df                	mov    %ebx,%edi
+  803229:	48 b8 8d 2c 80 00 00 	movabs $0x802c8d,%rax
+  803230:	00 00 00 
+  803233:	ff d0                	call   *%rax
+  803235:	85 c0                	test   %eax,%eax
+  803237:	0f 88 c0 00 00 00    	js     8032fd <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  80323d:	89 d8                	mov    %ebx,%eax
+  80323f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803243:	c9                   	leave
+  803244:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803245:	89 c1                	mov    %eax,%ecx
+  803247:	48 ba 75 68 80 00 00 	movabs $0x806875,%rdx
+  80324e:	00 00 00 
+  803251:	be 20 00 00 00       	mov    $0x20,%esi
+  803256:	48 bf 85 68 80 00 00 	movabs $0x806885,%rdi
+  80325d:	00 00 00 
+  803260:	b8 00 00 00 00       	mov    $0x0,%eax
+  803265:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  80326c:	00 00 00 
+  80326f:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803272:	48 b8 70 2a 80 00 00 	movabs $0x802a70,%rax
+  803279:	00 00 00 
+  80327c:	ff d0                	call   *%rax
+  80327e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803283:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80328a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803291:	00 00 00 
+  803294:	48 01 d0             	add    %rdx,%rax
+  803297:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80329e:	00 00 00 
+        return 0;
+  8032a1:	eb 9a                	jmp    80323d <fork+0x97>
+        panic("sys_map_region: %i", res);
+  8032a3:	89 c1                	mov    %eax,%ecx
+  8032a5:	48 ba 90 68 80 00 00 	movabs $0x806890,%rdx
+  8032ac:	00 00 00 
+  8032af:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8032b4:	48 bf 85 68 80 00 00 	movabs $0x806885,%rdi
+  8032bb:	00 00 00 
+  8032be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c3:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  8032ca:	00 00 00 
+  8032cd:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  8032d0:	89 c1                	mov    %eax,%ecx
+  8032d2:	48 ba d8 68 80 00 00 	movabs $0x8068d8,%rdx
+  8032d9:	00 00 00 
+  8032dc:	be 32 00 00 00       	mov    $0x32,%esi
+  8032e1:	48 bf 85 68 80 00 00 	movabs $0x806885,%rdi
+  8032e8:	00 00 00 
+  8032eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f0:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  8032f7:	00 00 00 
+  8032fa:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8032fd:	89 c1                	mov    %eax,%ecx
+  8032ff:	48 ba a3 68 80 00 00 	movabs $0x8068a3,%rdx
+  803306:	00 00 00 
+  803309:	be 37 00 00 00       	mov    $0x37,%esi
+  80330e:	48 bf 85 68 80 00 00 	movabs $0x806885,%rdi
+  803315:	00 00 00 
+  803318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331d:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803324:	00 00 00 
+  803327:	41 ff d0             	call   *%r8
+
+000000000080332a <sfork>:
+
+envid_t
+sfork() {
+  80332a:	55                   	push   %rbp
+  80332b:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80332e:	48 ba ba 68 80 00 00 	movabs $0x8068ba,%rdx
+  803335:	00 00 00 
+  803338:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80333d:	48 bf 85 68 80 00 00 	movabs $0x806885,%rdi
+  803344:	00 00 00 
+  803347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334c:	48 b9 5c 19 80 00 00 	movabs $0x80195c,%rcx
+  803353:	00 00 00 
+  803356:	ff d1                	call   *%rcx
+
+0000000000803358 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803358:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80335f:	ff ff ff 
+  803362:	48 01 f8             	add    %rdi,%rax
+  803365:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803369:	c3                   	ret
+
+000000000080336a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80336a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803371:	ff ff ff 
+  803374:	48 01 f8             	add    %rdi,%rax
+  803377:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80337b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803381:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803385:	c3                   	ret
+
+0000000000803386 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803386:	55                   	push   %rbp
+  803387:	48 89 e5             	mov    %rsp,%rbp
+  80338a:	41 57                	push   %r15
+  80338c:	41 56                	push   %r14
+  80338e:	41 55                	push   %r13
+  803390:	41 54                	push   %r12
+  803392:	53                   	push   %rbx
+  803393:	48 83 ec 08          	sub    $0x8,%rsp
+  803397:	49 89 ff             	mov    %rdi,%r15
+  80339a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80339f:	49 bd 3f 49 80 00 00 	movabs $0x80493f,%r13
+  8033a6:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8033a9:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8033af:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8033b2:	48 89 df             	mov    %rbx,%rdi
+  8033b5:	41 ff d5             	call   *%r13
+  8033b8:	83 e0 04             	and    $0x4,%eax
+  8033bb:	74 17                	je     8033d4 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8033bd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8033c4:	4c 39 f3             	cmp    %r14,%rbx
+  8033c7:	75 e6                	jne    8033af <fd_alloc+0x29>
+  8033c9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8033cf:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8033d4:	4d 89 27             	mov    %r12,(%r15)
+}
+  8033d7:	48 83 c4 08          	add    $0x8,%rsp
+  8033db:	5b                   	pop    %rbx
+  8033dc:	41 5c                	pop    %r12
+  8033de:	41 5d                	pop    %r13
+  8033e0:	41 5e                	pop    %r14
+  8033e2:	41 5f                	pop    %r15
+  8033e4:	5d                   	pop    %rbp
+  8033e5:	c3                   	ret
+
+00000000008033e6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8033e6:	83 ff 1f             	cmp    $0x1f,%edi
+  8033e9:	77 39                	ja     803424 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8033eb:	55                   	push   %rbp
+  8033ec:	48 89 e5             	mov    %rsp,%rbp
+  8033ef:	41 54                	push   %r12
+  8033f1:	53                   	push   %rbx
+  8033f2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8033f5:	48 63 df             	movslq %edi,%rbx
+  8033f8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8033ff:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803403:	48 89 df             	mov    %rbx,%rdi
+  803406:	48 b8 3f 49 80 00 00 	movabs $0x80493f,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+  803412:	a8 04                	test   $0x4,%al
+  803414:	74 14                	je     80342a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803416:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80341a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80341f:	5b                   	pop    %rbx
+  803420:	41 5c                	pop    %r12
+  803422:	5d                   	pop    %rbp
+  803423:	c3                   	ret
+        return -E_INVAL;
+  803424:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803429:	c3                   	ret
+        return -E_INVAL;
+  80342a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80342f:	eb ee                	jmp    80341f <fd_lookup+0x39>
+
+0000000000803431 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803431:	55                   	push   %rbp
+  803432:	48 89 e5             	mov    %rsp,%rbp
+  803435:	41 54                	push   %r12
+  803437:	53                   	push   %rbx
+  803438:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80343b:	48 b8 80 69 80 00 00 	movabs $0x806980,%rax
+  803442:	00 00 00 
+  803445:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  80344c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80344f:	39 3b                	cmp    %edi,(%rbx)
+  803451:	74 47                	je     80349a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803453:	48 83 c0 08          	add    $0x8,%rax
+  803457:	48 8b 18             	mov    (%rax),%rbx
+  80345a:	48 85 db             	test   %rbx,%rbx
+  80345d:	75 f0                	jne    80344f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80345f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803466:	00 00 00 
+  803469:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80346f:	89 fa                	mov    %edi,%edx
+  803471:	48 bf f8 68 80 00 00 	movabs $0x8068f8,%rdi
+  803478:	00 00 00 
+  80347b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803480:	48 b9 ac 1a 80 00 00 	movabs $0x801aac,%rcx
+  803487:	00 00 00 
+  80348a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80348c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803491:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803495:	5b                   	pop    %rbx
+  803496:	41 5c                	pop    %r12
+  803498:	5d                   	pop    %rbp
+  803499:	c3                   	ret
+            return 0;
+  80349a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349f:	eb f0                	jmp    803491 <dev_lookup+0x60>
+
+00000000008034a1 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8034a1:	55                   	push   %rbp
+  8034a2:	48 89 e5             	mov    %rsp,%rbp
+  8034a5:	41 55                	push   %r13
+  8034a7:	41 54                	push   %r12
+  8034a9:	53                   	push   %rbx
+  8034aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8034ae:	48 89 fb             	mov    %rdi,%rbx
+  8034b1:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8034b4:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8034bb:	ff ff ff 
+  8034be:	48 01 df             	add    %rbx,%rdi
+  8034c1:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8034c5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034c9:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  8034d0:	00 00 00 
+  8034d3:	ff d0                	call   *%rax
+  8034d5:	41 89 c5             	mov    %eax,%r13d
+  8034d8:	85 c0                	test   %eax,%eax
+  8034da:	78 06                	js     8034e2 <fd_close+0x41>
+  8034dc:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8034e0:	74 1a                	je     8034fc <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8034e2:	45 84 e4             	test   %r12b,%r12b
+  8034e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ea:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8034ee:	44 89 e8             	mov    %r13d,%eax
+  8034f1:	48 83 c4 18          	add    $0x18,%rsp
+  8034f5:	5b                   	pop    %rbx
+  8034f6:	41 5c                	pop    %r12
+  8034f8:	41 5d                	pop    %r13
+  8034fa:	5d                   	pop    %rbp
+  8034fb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034fc:	8b 3b                	mov    (%rbx),%edi
+  8034fe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803502:	48 b8 31 34 80 00 00 	movabs $0x803431,%rax
+  803509:	00 00 00 
+  80350c:	ff d0                	call   *%rax
+  80350e:	41 89 c5             	mov    %eax,%r13d
+  803511:	85 c0                	test   %eax,%eax
+  803513:	78 1b                	js     803530 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803515:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803519:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80351d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803523:	48 85 c0             	test   %rax,%rax
+  803526:	74 08                	je     803530 <fd_close+0x8f>
+  803528:	48 89 df             	mov    %rbx,%rdi
+  80352b:	ff d0                	call   *%rax
+  80352d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803530:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803535:	48 89 de             	mov    %rbx,%rsi
+  803538:	bf 00 00 00 00       	mov    $0x0,%edi
+  80353d:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  803544:	00 00 00 
+  803547:	ff d0                	call   *%rax
+    return res;
+  803549:	eb a3                	jmp    8034ee <fd_close+0x4d>
+
+000000000080354b <close>:
+
+int
+close(int fdnum) {
+  80354b:	55                   	push   %rbp
+  80354c:	48 89 e5             	mov    %rsp,%rbp
+  80354f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803553:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803557:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  80355e:	00 00 00 
+  803561:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803563:	85 c0                	test   %eax,%eax
+  803565:	78 15                	js     80357c <close+0x31>
+
+    return fd_close(fd, 1);
+  803567:	be 01 00 00 00       	mov    $0x1,%esi
+  80356c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803570:	48 b8 a1 34 80 00 00 	movabs $0x8034a1,%rax
+  803577:	00 00 00 
+  80357a:	ff d0                	call   *%rax
+}
+  80357c:	c9                   	leave
+  80357d:	c3                   	ret
+
+000000000080357e <close_all>:
+
+void
+close_all(void) {
+  80357e:	55                   	push   %rbp
+  80357f:	48 89 e5             	mov    %rsp,%rbp
+  803582:	41 54                	push   %r12
+  803584:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803585:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80358a:	49 bc 4b 35 80 00 00 	movabs $0x80354b,%r12
+  803591:	00 00 00 
+  803594:	89 df                	mov    %ebx,%edi
+  803596:	41 ff d4             	call   *%r12
+  803599:	83 c3 01             	add    $0x1,%ebx
+  80359c:	83 fb 20             	cmp    $0x20,%ebx
+  80359f:	75 f3                	jne    803594 <close_all+0x16>
+}
+  8035a1:	5b                   	pop    %rbx
+  8035a2:	41 5c                	pop    %r12
+  8035a4:	5d                   	pop    %rbp
+  8035a5:	c3                   	ret
+
+00000000008035a6 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8035a6:	55                   	push   %rbp
+  8035a7:	48 89 e5             	mov    %rsp,%rbp
+  8035aa:	41 57                	push   %r15
+  8035ac:	41 56                	push   %r14
+  8035ae:	41 55                	push   %r13
+  8035b0:	41 54                	push   %r12
+  8035b2:	53                   	push   %rbx
+  8035b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8035b7:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8035ba:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035be:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+  8035ca:	89 c3                	mov    %eax,%ebx
+  8035cc:	85 c0                	test   %eax,%eax
+  8035ce:	0f 88 b8 00 00 00    	js     80368c <dup+0xe6>
+    close(newfdnum);
+  8035d4:	44 89 e7             	mov    %r12d,%edi
+  8035d7:	48 b8 4b 35 80 00 00 	movabs $0x80354b,%rax
+  8035de:	00 00 00 
+  8035e1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8035e3:	4d 63 ec             	movslq %r12d,%r13
+  8035e6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8035ed:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8035f1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8035f5:	4c 89 ff             	mov    %r15,%rdi
+  8035f8:	49 be 6a 33 80 00 00 	movabs $0x80336a,%r14
+  8035ff:	00 00 00 
+  803602:	41 ff d6             	call   *%r14
+  803605:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803608:	4c 89 ef             	mov    %r13,%rdi
+  80360b:	41 ff d6             	call   *%r14
+  80360e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803611:	48 89 df             	mov    %rbx,%rdi
+  803614:	48 b8 3f 49 80 00 00 	movabs $0x80493f,%rax
+  80361b:	00 00 00 
+  80361e:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803620:	a8 04                	test   $0x4,%al
+  803622:	74 2b                	je     80364f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803624:	41 89 c1             	mov    %eax,%r9d
+  803627:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80362d:	4c 89 f1             	mov    %r14,%rcx
+  803630:	ba 00 00 00 00       	mov    $0x0,%edx
+  803635:	48 89 de             	mov    %rbx,%rsi
+  803638:	bf 00 00 00 00       	mov    $0x0,%edi
+  80363d:	48 b8 b5 2b 80 00 00 	movabs $0x802bb5,%rax
+  803644:	00 00 00 
+  803647:	ff d0                	call   *%rax
+  803649:	89 c3                	mov    %eax,%ebx
+  80364b:	85 c0                	test   %eax,%eax
+  80364d:	78 4e                	js     80369d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80364f:	4c 89 ff             	mov    %r15,%rdi
+  803652:	48 b8 3f 49 80 00 00 	movabs $0x80493f,%rax
+  803659:	00 00 00 
+  80365c:	ff d0                	call   *%rax
+  80365e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803661:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803667:	4c 89 e9             	mov    %r13,%rcx
+  80366a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80366f:	4c 89 fe             	mov    %r15,%rsi
+  803672:	bf 00 00 00 00       	mov    $0x0,%edi
+  803677:	48 b8 b5 2b 80 00 00 	movabs $0x802bb5,%rax
+  80367e:	00 00 00 
+  803681:	ff d0                	call   *%rax
+  803683:	89 c3                	mov    %eax,%ebx
+  803685:	85 c0                	test   %eax,%eax
+  803687:	78 14                	js     80369d <dup+0xf7>
+
+    return newfdnum;
+  803689:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80368c:	89 d8                	mov    %ebx,%eax
+  80368e:	48 83 c4 18          	add    $0x18,%rsp
+  803692:	5b                   	pop    %rbx
+  803693:	41 5c                	pop    %r12
+  803695:	41 5d                	pop    %r13
+  803697:	41 5e                	pop    %r14
+  803699:	41 5f                	pop    %r15
+  80369b:	5d                   	pop    %rbp
+  80369c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80369d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036a2:	4c 89 ee             	mov    %r13,%rsi
+  8036a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036aa:	49 bc 20 2c 80 00 00 	movabs $0x802c20,%r12
+  8036b1:	00 00 00 
+  8036b4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8036b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036bc:	4c 89 f6             	mov    %r14,%rsi
+  8036bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c4:	41 ff d4             	call   *%r12
+    return res;
+  8036c7:	eb c3                	jmp    80368c <dup+0xe6>
+
+00000000008036c9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8036c9:	55                   	push   %rbp
+  8036ca:	48 89 e5             	mov    %rsp,%rbp
+  8036cd:	41 56                	push   %r14
+  8036cf:	41 55                	push   %r13
+  8036d1:	41 54                	push   %r12
+  8036d3:	53                   	push   %rbx
+  8036d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8036d8:	89 fb                	mov    %edi,%ebx
+  8036da:	49 89 f4             	mov    %rsi,%r12
+  8036dd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036e0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036e4:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  8036eb:	00 00 00 
+  8036ee:	ff d0                	call   *%rax
+  8036f0:	85 c0                	test   %eax,%eax
+  8036f2:	78 4c                	js     803740 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036f4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8036f8:	41 8b 3e             	mov    (%r14),%edi
+  8036fb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036ff:	48 b8 31 34 80 00 00 	movabs $0x803431,%rax
+  803706:	00 00 00 
+  803709:	ff d0                	call   *%rax
+  80370b:	85 c0                	test   %eax,%eax
+  80370d:	78 35                	js     803744 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80370f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803713:	83 e0 03             	and    $0x3,%eax
+  803716:	83 f8 01             	cmp    $0x1,%eax
+  803719:	74 2d                	je     803748 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80371b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80371f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803723:	48 85 c0             	test   %rax,%rax
+  803726:	74 56                	je     80377e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803728:	4c 89 ea             	mov    %r13,%rdx
+  80372b:	4c 89 e6             	mov    %r12,%rsi
+  80372e:	4c 89 f7             	mov    %r14,%rdi
+  803731:	ff d0                	call   *%rax
+}
+  803733:	48 83 c4 10          	add    $0x10,%rsp
+  803737:	5b                   	pop    %rbx
+  803738:	41 5c                	pop    %r12
+  80373a:	41 5d                	pop    %r13
+  80373c:	41 5e                	pop    %r14
+  80373e:	5d                   	pop    %rbp
+  80373f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803740:	48 98                	cltq
+  803742:	eb ef                	jmp    803733 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803744:	48 98                	cltq
+  803746:	eb eb                	jmp    803733 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803748:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80374f:	00 00 00 
+  803752:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803758:	89 da                	mov    %ebx,%edx
+  80375a:	48 bf 39 69 80 00 00 	movabs $0x806939,%rdi
+  803761:	00 00 00 
+  803764:	b8 00 00 00 00       	mov    $0x0,%eax
+  803769:	48 b9 ac 1a 80 00 00 	movabs $0x801aac,%rcx
+  803770:	00 00 00 
+  803773:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803775:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80377c:	eb b5                	jmp    803733 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80377e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803785:	eb ac                	jmp    803733 <read+0x6a>
+
+0000000000803787 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803787:	55                   	push   %rbp
+  803788:	48 89 e5             	mov    %rsp,%rbp
+  80378b:	41 57                	push   %r15
+  80378d:	41 56                	push   %r14
+  80378f:	41 55                	push   %r13
+  803791:	41 54                	push   %r12
+  803793:	53                   	push   %rbx
+  803794:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803798:	48 85 d2             	test   %rdx,%rdx
+  80379b:	74 54                	je     8037f1 <readn+0x6a>
+  80379d:	41 89 fd             	mov    %edi,%r13d
+  8037a0:	49 89 f6             	mov    %rsi,%r14
+  8037a3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8037a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8037ab:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8037b0:	49 bf c9 36 80 00 00 	movabs $0x8036c9,%r15
+  8037b7:	00 00 00 
+  8037ba:	4c 89 e2             	mov    %r12,%rdx
+  8037bd:	48 29 f2             	sub    %rsi,%rdx
+  8037c0:	4c 01 f6             	add    %r14,%rsi
+  8037c3:	44 89 ef             	mov    %r13d,%edi
+  8037c6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8037c9:	85 c0                	test   %eax,%eax
+  8037cb:	78 20                	js     8037ed <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8037cd:	01 c3                	add    %eax,%ebx
+  8037cf:	85 c0                	test   %eax,%eax
+  8037d1:	74 08                	je     8037db <readn+0x54>
+  8037d3:	48 63 f3             	movslq %ebx,%rsi
+  8037d6:	4c 39 e6             	cmp    %r12,%rsi
+  8037d9:	72 df                	jb     8037ba <readn+0x33>
+    }
+    return res;
+  8037db:	48 63 c3             	movslq %ebx,%rax
+}
+  8037de:	48 83 c4 08          	add    $0x8,%rsp
+  8037e2:	5b                   	pop    %rbx
+  8037e3:	41 5c                	pop    %r12
+  8037e5:	41 5d                	pop    %r13
+  8037e7:	41 5e                	pop    %r14
+  8037e9:	41 5f                	pop    %r15
+  8037eb:	5d                   	pop    %rbp
+  8037ec:	c3                   	ret
+        if (inc < 0) return inc;
+  8037ed:	48 98                	cltq
+  8037ef:	eb ed                	jmp    8037de <readn+0x57>
+    int inc = 1, res = 0;
+  8037f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037f6:	eb e3                	jmp    8037db <readn+0x54>
+
+00000000008037f8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8037f8:	55                   	push   %rbp
+  8037f9:	48 89 e5             	mov    %rsp,%rbp
+  8037fc:	41 56                	push   %r14
+  8037fe:	41 55                	push   %r13
+  803800:	41 54                	push   %r12
+  803802:	53                   	push   %rbx
+  803803:	48 83 ec 10          	sub    $0x10,%rsp
+  803807:	89 fb                	mov    %edi,%ebx
+  803809:	49 89 f4             	mov    %rsi,%r12
+  80380c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80380f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803813:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  80381a:	00 00 00 
+  80381d:	ff d0                	call   *%rax
+  80381f:	85 c0                	test   %eax,%eax
+  803821:	78 47                	js     80386a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803823:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803827:	41 8b 3e             	mov    (%r14),%edi
+  80382a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80382e:	48 b8 31 34 80 00 00 	movabs $0x803431,%rax
+  803835:	00 00 00 
+  803838:	ff d0                	call   *%rax
+  80383a:	85 c0                	test   %eax,%eax
+  80383c:	78 30                	js     80386e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80383e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803843:	74 2d                	je     803872 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803845:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803849:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80384d:	48 85 c0             	test   %rax,%rax
+  803850:	74 56                	je     8038a8 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803852:	4c 89 ea             	mov    %r13,%rdx
+  803855:	4c 89 e6             	mov    %r12,%rsi
+  803858:	4c 89 f7             	mov    %r14,%rdi
+  80385b:	ff d0                	call   *%rax
+}
+  80385d:	48 83 c4 10          	add    $0x10,%rsp
+  803861:	5b                   	pop    %rbx
+  803862:	41 5c                	pop    %r12
+  803864:	41 5d                	pop    %r13
+  803866:	41 5e                	pop    %r14
+  803868:	5d                   	pop    %rbp
+  803869:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80386a:	48 98                	cltq
+  80386c:	eb ef                	jmp    80385d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80386e:	48 98                	cltq
+  803870:	eb eb                	jmp    80385d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803872:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803879:	00 00 00 
+  80387c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803882:	89 da                	mov    %ebx,%edx
+  803884:	48 bf 55 69 80 00 00 	movabs $0x806955,%rdi
+  80388b:	00 00 00 
+  80388e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803893:	48 b9 ac 1a 80 00 00 	movabs $0x801aac,%rcx
+  80389a:	00 00 00 
+  80389d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80389f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8038a6:	eb b5                	jmp    80385d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8038a8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8038af:	eb ac                	jmp    80385d <write+0x65>
+
+00000000008038b1 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8038b1:	55                   	push   %rbp
+  8038b2:	48 89 e5             	mov    %rsp,%rbp
+  8038b5:	53                   	push   %rbx
+  8038b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8038ba:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038bc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8038c0:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  8038c7:	00 00 00 
+  8038ca:	ff d0                	call   *%rax
+  8038cc:	85 c0                	test   %eax,%eax
+  8038ce:	78 0c                	js     8038dc <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8038d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038d4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8038d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038e0:	c9                   	leave
+  8038e1:	c3                   	ret
+
+00000000008038e2 <tell>:
+
+int tell(int fdnum) {
+  8038e2:	55                   	push   %rbp
+  8038e3:	48 89 e5             	mov    %rsp,%rbp
+  8038e6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038ea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038ee:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+  8038fa:	85 c0                	test   %eax,%eax
+  8038fc:	78 07                	js     803905 <tell+0x23>
+
+    return fd->fd_offset;
+  8038fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803902:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803905:	c9                   	leave
+  803906:	c3                   	ret
+
+0000000000803907 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803907:	55                   	push   %rbp
+  803908:	48 89 e5             	mov    %rsp,%rbp
+  80390b:	41 55                	push   %r13
+  80390d:	41 54                	push   %r12
+  80390f:	53                   	push   %rbx
+  803910:	48 83 ec 18          	sub    $0x18,%rsp
+  803914:	89 fb                	mov    %edi,%ebx
+  803916:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803919:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80391d:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+  803929:	85 c0                	test   %eax,%eax
+  80392b:	78 38                	js     803965 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80392d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803931:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803935:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803939:	48 b8 31 34 80 00 00 	movabs $0x803431,%rax
+  803940:	00 00 00 
+  803943:	ff d0                	call   *%rax
+  803945:	85 c0                	test   %eax,%eax
+  803947:	78 1c                	js     803965 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803949:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80394e:	74 20                	je     803970 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803950:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803954:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803958:	48 85 c0             	test   %rax,%rax
+  80395b:	74 47                	je     8039a4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80395d:	44 89 e6             	mov    %r12d,%esi
+  803960:	4c 89 ef             	mov    %r13,%rdi
+  803963:	ff d0                	call   *%rax
+}
+  803965:	48 83 c4 18          	add    $0x18,%rsp
+  803969:	5b                   	pop    %rbx
+  80396a:	41 5c                	pop    %r12
+  80396c:	41 5d                	pop    %r13
+  80396e:	5d                   	pop    %rbp
+  80396f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803970:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803977:	00 00 00 
+  80397a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803980:	89 da                	mov    %ebx,%edx
+  803982:	48 bf 18 69 80 00 00 	movabs $0x806918,%rdi
+  803989:	00 00 00 
+  80398c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803991:	48 b9 ac 1a 80 00 00 	movabs $0x801aac,%rcx
+  803998:	00 00 00 
+  80399b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80399d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039a2:	eb c1                	jmp    803965 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8039a4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039a9:	eb ba                	jmp    803965 <ftruncate+0x5e>
+
+00000000008039ab <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8039ab:	55                   	push   %rbp
+  8039ac:	48 89 e5             	mov    %rsp,%rbp
+  8039af:	41 54                	push   %r12
+  8039b1:	53                   	push   %rbx
+  8039b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8039b6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039b9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8039bd:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+  8039c9:	85 c0                	test   %eax,%eax
+  8039cb:	78 63                	js     803a30 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8039cd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8039d1:	41 8b 3c 24          	mov    (%r12),%edi
+  8039d5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8039d9:	48 b8 31 34 80 00 00 	movabs $0x803431,%rax
+  8039e0:	00 00 00 
+  8039e3:	ff d0                	call   *%rax
+  8039e5:	85 c0                	test   %eax,%eax
+  8039e7:	78 47                	js     803a30 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ed:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8039f2:	74 45                	je     803a39 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8039f4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8039f7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8039fe:	00 00 00 
+    stat->st_isdir = 0;
+  803a01:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a08:	00 00 00 
+    stat->st_ino = 0;
+  803a0b:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803a12:	00 00 00 00 
+    stat->st_version = 0;
+  803a16:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803a1d:	00 00 00 
+    stat->st_dev = dev;
+  803a20:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803a27:	48 89 de             	mov    %rbx,%rsi
+  803a2a:	4c 89 e7             	mov    %r12,%rdi
+  803a2d:	ff 50 28             	call   *0x28(%rax)
+}
+  803a30:	48 83 c4 10          	add    $0x10,%rsp
+  803a34:	5b                   	pop    %rbx
+  803a35:	41 5c                	pop    %r12
+  803a37:	5d                   	pop    %rbp
+  803a38:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a39:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a3e:	eb f0                	jmp    803a30 <fstat+0x85>
+
+0000000000803a40 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803a40:	55                   	push   %rbp
+  803a41:	48 89 e5             	mov    %rsp,%rbp
+  803a44:	41 54                	push   %r12
+  803a46:	53                   	push   %rbx
+  803a47:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803a4a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4f:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  803a56:	00 00 00 
+  803a59:	ff d0                	call   *%rax
+  803a5b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803a5d:	85 c0                	test   %eax,%eax
+  803a5f:	78 25                	js     803a86 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803a61:	4c 89 e6             	mov    %r12,%rsi
+  803a64:	89 c7                	mov    %eax,%edi
+  803a66:	48 b8 ab 39 80 00 00 	movabs $0x8039ab,%rax
+  803a6d:	00 00 00 
+  803a70:	ff d0                	call   *%rax
+  803a72:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803a75:	89 df                	mov    %ebx,%edi
+  803a77:	48 b8 4b 35 80 00 00 	movabs $0x80354b,%rax
+  803a7e:	00 00 00 
+  803a81:	ff d0                	call   *%rax
+
+    return res;
+  803a83:	44 89 e3             	mov    %r12d,%ebx
+}
+  803a86:	89 d8                	mov    %ebx,%eax
+  803a88:	5b                   	pop    %rbx
+  803a89:	41 5c                	pop    %r12
+  803a8b:	5d                   	pop    %rbp
+  803a8c:	c3                   	ret
+
+0000000000803a8d <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a8d:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803a94:	00 00 00 
+  803a97:	83 38 00             	cmpl   $0x0,(%rax)
+  803a9a:	74 0a                	je     803aa6 <fsipc_env+0x19>
+    return fsenv;
+}
+  803a9c:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803aa3:	00 00 
+  803aa5:	c3                   	ret
+fsipc_env(void) {
+  803aa6:	55                   	push   %rbp
+  803aa7:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803aaa:	bf 03 00 00 00       	mov    $0x3,%edi
+  803aaf:	48 b8 5d 5c 80 00 00 	movabs $0x805c5d,%rax
+  803ab6:	00 00 00 
+  803ab9:	ff d0                	call   *%rax
+  803abb:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803ac2:	00 00 
+}
+  803ac4:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803acb:	00 00 
+  803acd:	5d                   	pop    %rbp
+  803ace:	c3                   	ret
+
+0000000000803acf <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803acf:	55                   	push   %rbp
+  803ad0:	48 89 e5             	mov    %rsp,%rbp
+  803ad3:	53                   	push   %rbx
+  803ad4:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803ad8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803adf:	00 
+  803ae0:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803ae7:	00 
+  803ae8:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803aef:	00 
+  803af0:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803af7:	00 
+  803af8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803aff:	00 
+
+    assert(size <= sizeof(words));
+  803b00:	48 83 fa 28          	cmp    $0x28,%rdx
+  803b04:	77 38                	ja     803b3e <fsipc_short+0x6f>
+  803b06:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803b08:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b0c:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  803b13:	00 00 00 
+  803b16:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803b18:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803b1f:	00 00 00 
+  803b22:	ff d0                	call   *%rax
+  803b24:	89 c7                	mov    %eax,%edi
+  803b26:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803b2a:	89 de                	mov    %ebx,%esi
+  803b2c:	48 b8 c0 5b 80 00 00 	movabs $0x805bc0,%rax
+  803b33:	00 00 00 
+  803b36:	ff d0                	call   *%rax
+}
+  803b38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b3c:	c9                   	leave
+  803b3d:	c3                   	ret
+    assert(size <= sizeof(words));
+  803b3e:	48 b9 a0 69 80 00 00 	movabs $0x8069a0,%rcx
+  803b45:	00 00 00 
+  803b48:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  803b4f:	00 00 00 
+  803b52:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803b57:	48 bf cb 69 80 00 00 	movabs $0x8069cb,%rdi
+  803b5e:	00 00 00 
+  803b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b66:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803b6d:	00 00 00 
+  803b70:	41 ff d0             	call   *%r8
+
+0000000000803b73 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803b73:	55                   	push   %rbp
+  803b74:	48 89 e5             	mov    %rsp,%rbp
+  803b77:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803b7b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b7e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803b81:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b84:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b89:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b8d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b92:	48 b8 cf 3a 80 00 00 	movabs $0x803acf,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+}
+  803b9e:	c9                   	leave
+  803b9f:	c3                   	ret
+
+0000000000803ba0 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803ba0:	55                   	push   %rbp
+  803ba1:	48 89 e5             	mov    %rsp,%rbp
+  803ba4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803ba8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803bae:	ba 04 00 00 00       	mov    $0x4,%edx
+  803bb3:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803bb7:	bf 06 00 00 00       	mov    $0x6,%edi
+  803bbc:	48 b8 cf 3a 80 00 00 	movabs $0x803acf,%rax
+  803bc3:	00 00 00 
+  803bc6:	ff d0                	call   *%rax
+}
+  803bc8:	c9                   	leave
+  803bc9:	c3                   	ret
+
+0000000000803bca <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803bca:	55                   	push   %rbp
+  803bcb:	48 89 e5             	mov    %rsp,%rbp
+  803bce:	41 54                	push   %r12
+  803bd0:	53                   	push   %rbx
+  803bd1:	48 83 ec 10          	sub    $0x10,%rsp
+  803bd5:	89 fb                	mov    %edi,%ebx
+  803bd7:	49 89 f4             	mov    %rsi,%r12
+  803bda:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803bde:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+  803bea:	89 c7                	mov    %eax,%edi
+  803bec:	6a 00                	push   $0x0
+  803bee:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803bf2:	50                   	push   %rax
+  803bf3:	4d 89 e1             	mov    %r12,%r9
+  803bf6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803bfc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c01:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803c08:	00 00 00 
+  803c0b:	89 de                	mov    %ebx,%esi
+  803c0d:	48 b8 5b 5b 80 00 00 	movabs $0x805b5b,%rax
+  803c14:	00 00 00 
+  803c17:	ff d0                	call   *%rax
+}
+  803c19:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c1d:	5b                   	pop    %rbx
+  803c1e:	41 5c                	pop    %r12
+  803c20:	5d                   	pop    %rbp
+  803c21:	c3                   	ret
+
+0000000000803c22 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803c22:	55                   	push   %rbp
+  803c23:	48 89 e5             	mov    %rsp,%rbp
+  803c26:	41 54                	push   %r12
+  803c28:	53                   	push   %rbx
+  803c29:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c2c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c2f:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803c36:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c38:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c3d:	be 00 00 00 00       	mov    $0x0,%esi
+  803c42:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c47:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  803c4e:	00 00 00 
+  803c51:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c53:	85 c0                	test   %eax,%eax
+  803c55:	78 5a                	js     803cb1 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c57:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803c5e:	00 00 00 
+  803c61:	4c 89 e6             	mov    %r12,%rsi
+  803c64:	48 89 df             	mov    %rbx,%rdi
+  803c67:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  803c6e:	00 00 00 
+  803c71:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803c73:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803c7a:	00 
+  803c7b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c81:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803c88:	00 
+  803c89:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803c8f:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803c96:	00 
+  803c97:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803c9e:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803ca5:	00 
+  803ca6:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803cac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cb1:	5b                   	pop    %rbx
+  803cb2:	41 5c                	pop    %r12
+  803cb4:	5d                   	pop    %rbp
+  803cb5:	c3                   	ret
+
+0000000000803cb6 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803cb6:	55                   	push   %rbp
+  803cb7:	48 89 e5             	mov    %rsp,%rbp
+  803cba:	41 57                	push   %r15
+  803cbc:	41 56                	push   %r14
+  803cbe:	41 55                	push   %r13
+  803cc0:	41 54                	push   %r12
+  803cc2:	53                   	push   %rbx
+  803cc3:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803cc7:	48 85 ff             	test   %rdi,%rdi
+  803cca:	0f 84 a1 00 00 00    	je     803d71 <devfile_read+0xbb>
+  803cd0:	49 89 ff             	mov    %rdi,%r15
+  803cd3:	49 89 f5             	mov    %rsi,%r13
+  803cd6:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803cd9:	48 85 f6             	test   %rsi,%rsi
+  803cdc:	0f 84 c4 00 00 00    	je     803da6 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803ce2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803ce9:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803cea:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803cf1:	00 00 00 
+  803cf4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803cf8:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803cfb:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803cff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d04:	be 00 00 00 00       	mov    $0x0,%esi
+  803d09:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d0e:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  803d15:	00 00 00 
+  803d18:	ff d0                	call   *%rax
+        if (res < 0) {
+  803d1a:	85 c0                	test   %eax,%eax
+  803d1c:	0f 88 b9 00 00 00    	js     803ddb <devfile_read+0x125>
+        assert(res <= n);
+  803d22:	48 63 d8             	movslq %eax,%rbx
+  803d25:	49 39 dc             	cmp    %rbx,%r12
+  803d28:	0f 82 b1 00 00 00    	jb     803ddf <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803d2e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803d33:	0f 87 db 00 00 00    	ja     803e14 <devfile_read+0x15e>
+        if (!res) {
+  803d39:	85 c0                	test   %eax,%eax
+  803d3b:	74 21                	je     803d5e <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803d3d:	48 89 da             	mov    %rbx,%rdx
+  803d40:	4c 89 f6             	mov    %r14,%rsi
+  803d43:	4c 89 ef             	mov    %r13,%rdi
+  803d46:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  803d4d:	00 00 00 
+  803d50:	ff d0                	call   *%rax
+        total_read += res;
+  803d52:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803d56:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803d59:	49 29 dc             	sub    %rbx,%r12
+  803d5c:	75 96                	jne    803cf4 <devfile_read+0x3e>
+    return total_read;
+  803d5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803d62:	48 83 c4 18          	add    $0x18,%rsp
+  803d66:	5b                   	pop    %rbx
+  803d67:	41 5c                	pop    %r12
+  803d69:	41 5d                	pop    %r13
+  803d6b:	41 5e                	pop    %r14
+  803d6d:	41 5f                	pop    %r15
+  803d6f:	5d                   	pop    %rbp
+  803d70:	c3                   	ret
+    assert(fd);
+  803d71:	48 b9 d6 69 80 00 00 	movabs $0x8069d6,%rcx
+  803d78:	00 00 00 
+  803d7b:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  803d82:	00 00 00 
+  803d85:	be 91 00 00 00       	mov    $0x91,%esi
+  803d8a:	48 bf cb 69 80 00 00 	movabs $0x8069cb,%rdi
+  803d91:	00 00 00 
+  803d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d99:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803da0:	00 00 00 
+  803da3:	41 ff d0             	call   *%r8
+    assert(buf);
+  803da6:	48 b9 d9 69 80 00 00 	movabs $0x8069d9,%rcx
+  803dad:	00 00 00 
+  803db0:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  803db7:	00 00 00 
+  803dba:	be 92 00 00 00       	mov    $0x92,%esi
+  803dbf:	48 bf cb 69 80 00 00 	movabs $0x8069cb,%rdi
+  803dc6:	00 00 00 
+  803dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dce:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803dd5:	00 00 00 
+  803dd8:	41 ff d0             	call   *%r8
+            return res;
+  803ddb:	48 98                	cltq
+  803ddd:	eb 83                	jmp    803d62 <devfile_read+0xac>
+        assert(res <= n);
+  803ddf:	48 b9 dd 69 80 00 00 	movabs $0x8069dd,%rcx
+  803de6:	00 00 00 
+  803de9:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  803df0:	00 00 00 
+  803df3:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803df8:	48 bf cb 69 80 00 00 	movabs $0x8069cb,%rdi
+  803dff:	00 00 00 
+  803e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e07:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803e0e:	00 00 00 
+  803e11:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803e14:	48 b9 e8 69 80 00 00 	movabs $0x8069e8,%rcx
+  803e1b:	00 00 00 
+  803e1e:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  803e25:	00 00 00 
+  803e28:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803e2d:	48 bf cb 69 80 00 00 	movabs $0x8069cb,%rdi
+  803e34:	00 00 00 
+  803e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e3c:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803e43:	00 00 00 
+  803e46:	41 ff d0             	call   *%r8
+
+0000000000803e49 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803e49:	55                   	push   %rbp
+  803e4a:	48 89 e5             	mov    %rsp,%rbp
+  803e4d:	41 57                	push   %r15
+  803e4f:	41 56                	push   %r14
+  803e51:	41 55                	push   %r13
+  803e53:	41 54                	push   %r12
+  803e55:	53                   	push   %rbx
+  803e56:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803e5a:	48 85 ff             	test   %rdi,%rdi
+  803e5d:	0f 84 83 00 00 00    	je     803ee6 <devfile_write+0x9d>
+  803e63:	49 89 ff             	mov    %rdi,%r15
+  803e66:	49 89 f4             	mov    %rsi,%r12
+  803e69:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803e6c:	48 85 f6             	test   %rsi,%rsi
+  803e6f:	0f 84 a6 00 00 00    	je     803f1b <devfile_write+0xd2>
+    size_t total_written = 0;
+  803e75:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803e7b:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803e82:	00 00 00 
+  803e85:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e89:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803e8c:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803e90:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803e95:	48 39 d3             	cmp    %rdx,%rbx
+  803e98:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803e9c:	4c 89 e6             	mov    %r12,%rsi
+  803e9f:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803ea6:	00 00 00 
+  803ea9:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  803eb0:	00 00 00 
+  803eb3:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803eb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803eba:	be 00 00 00 00       	mov    $0x0,%esi
+  803ebf:	bf 04 00 00 00       	mov    $0x4,%edi
+  803ec4:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+        if (res < 0) {
+  803ed0:	85 c0                	test   %eax,%eax
+  803ed2:	78 7c                	js     803f50 <devfile_write+0x107>
+        total_written += res;
+  803ed4:	48 98                	cltq
+  803ed6:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803ed9:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803edc:	48 29 c3             	sub    %rax,%rbx
+  803edf:	75 a4                	jne    803e85 <devfile_write+0x3c>
+    return total_written;
+  803ee1:	4c 89 e8             	mov    %r13,%rax
+  803ee4:	eb 6c                	jmp    803f52 <devfile_write+0x109>
+    assert(fd);
+  803ee6:	48 b9 d6 69 80 00 00 	movabs $0x8069d6,%rcx
+  803eed:	00 00 00 
+  803ef0:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  803ef7:	00 00 00 
+  803efa:	be bd 00 00 00       	mov    $0xbd,%esi
+  803eff:	48 bf cb 69 80 00 00 	movabs $0x8069cb,%rdi
+  803f06:	00 00 00 
+  803f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0e:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803f15:	00 00 00 
+  803f18:	41 ff d0             	call   *%r8
+    assert(buf);
+  803f1b:	48 b9 d9 69 80 00 00 	movabs $0x8069d9,%rcx
+  803f22:	00 00 00 
+  803f25:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  803f2c:	00 00 00 
+  803f2f:	be be 00 00 00       	mov    $0xbe,%esi
+  803f34:	48 bf cb 69 80 00 00 	movabs $0x8069cb,%rdi
+  803f3b:	00 00 00 
+  803f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f43:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  803f4a:	00 00 00 
+  803f4d:	41 ff d0             	call   *%r8
+            return res;
+  803f50:	48 98                	cltq
+}
+  803f52:	48 83 c4 08          	add    $0x8,%rsp
+  803f56:	5b                   	pop    %rbx
+  803f57:	41 5c                	pop    %r12
+  803f59:	41 5d                	pop    %r13
+  803f5b:	41 5e                	pop    %r14
+  803f5d:	41 5f                	pop    %r15
+  803f5f:	5d                   	pop    %rbp
+  803f60:	c3                   	ret
+
+0000000000803f61 <open>:
+open(const char *path, int mode) {
+  803f61:	55                   	push   %rbp
+  803f62:	48 89 e5             	mov    %rsp,%rbp
+  803f65:	41 55                	push   %r13
+  803f67:	41 54                	push   %r12
+  803f69:	53                   	push   %rbx
+  803f6a:	48 83 ec 18          	sub    $0x18,%rsp
+  803f6e:	49 89 fc             	mov    %rdi,%r12
+  803f71:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f74:	48 b8 a5 23 80 00 00 	movabs $0x8023a5,%rax
+  803f7b:	00 00 00 
+  803f7e:	ff d0                	call   *%rax
+  803f80:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f86:	0f 87 8f 00 00 00    	ja     80401b <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f8c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f90:	48 b8 86 33 80 00 00 	movabs $0x803386,%rax
+  803f97:	00 00 00 
+  803f9a:	ff d0                	call   *%rax
+  803f9c:	89 c3                	mov    %eax,%ebx
+  803f9e:	85 c0                	test   %eax,%eax
+  803fa0:	78 55                	js     803ff7 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803fa2:	4c 89 e6             	mov    %r12,%rsi
+  803fa5:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803fac:	00 00 00 
+  803faf:	48 89 df             	mov    %rbx,%rdi
+  803fb2:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  803fb9:	00 00 00 
+  803fbc:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803fbe:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803fc5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fca:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fce:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fd3:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  803fda:	00 00 00 
+  803fdd:	ff d0                	call   *%rax
+  803fdf:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803fe1:	85 c0                	test   %eax,%eax
+  803fe3:	78 1f                	js     804004 <open+0xa3>
+    return fd2num(fd);
+  803fe5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fe9:	48 b8 58 33 80 00 00 	movabs $0x803358,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+  803ff5:	89 c3                	mov    %eax,%ebx
+}
+  803ff7:	89 d8                	mov    %ebx,%eax
+  803ff9:	48 83 c4 18          	add    $0x18,%rsp
+  803ffd:	5b                   	pop    %rbx
+  803ffe:	41 5c                	pop    %r12
+  804000:	41 5d                	pop    %r13
+  804002:	5d                   	pop    %rbp
+  804003:	c3                   	ret
+        fd_close(fd, 0);
+  804004:	be 00 00 00 00       	mov    $0x0,%esi
+  804009:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80400d:	48 b8 a1 34 80 00 00 	movabs $0x8034a1,%rax
+  804014:	00 00 00 
+  804017:	ff d0                	call   *%rax
+        return res;
+  804019:	eb dc                	jmp    803ff7 <open+0x96>
+        return -E_BAD_PATH;
+  80401b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804020:	eb d5                	jmp    803ff7 <open+0x96>
+
+0000000000804022 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804022:	55                   	push   %rbp
+  804023:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  804026:	ba 00 00 00 00       	mov    $0x0,%edx
+  80402b:	be 00 00 00 00       	mov    $0x0,%esi
+  804030:	bf 08 00 00 00       	mov    $0x8,%edi
+  804035:	48 b8 cf 3a 80 00 00 	movabs $0x803acf,%rax
+  80403c:	00 00 00 
+  80403f:	ff d0                	call   *%rax
+}
+  804041:	5d                   	pop    %rbp
+  804042:	c3                   	ret
+
+0000000000804043 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  804043:	55                   	push   %rbp
+  804044:	48 89 e5             	mov    %rsp,%rbp
+  804047:	41 56                	push   %r14
+  804049:	41 55                	push   %r13
+  80404b:	41 54                	push   %r12
+  80404d:	53                   	push   %rbx
+  80404e:	48 83 ec 10          	sub    $0x10,%rsp
+  804052:	41 89 f6             	mov    %esi,%r14d
+  804055:	49 89 d4             	mov    %rdx,%r12
+  804058:	48 89 cb             	mov    %rcx,%rbx
+  80405b:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80405e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804062:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  804069:	00 00 00 
+  80406c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80406e:	85 c0                	test   %eax,%eax
+  804070:	78 46                	js     8040b8 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804072:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804076:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80407d:	00 00 00 
+  804080:	8b 00                	mov    (%rax),%eax
+  804082:	39 02                	cmp    %eax,(%rdx)
+  804084:	75 3f                	jne    8040c5 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804086:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  80408d:	00 00 00 
+  804090:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804093:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804095:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  804099:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  80409d:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  8040a1:	48 89 da             	mov    %rbx,%rdx
+  8040a4:	4c 89 e6             	mov    %r12,%rsi
+  8040a7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8040ac:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  8040b3:	00 00 00 
+  8040b6:	ff d0                	call   *%rax
+}
+  8040b8:	48 83 c4 10          	add    $0x10,%rsp
+  8040bc:	5b                   	pop    %rbx
+  8040bd:	41 5c                	pop    %r12
+  8040bf:	41 5d                	pop    %r13
+  8040c1:	41 5e                	pop    %r14
+  8040c3:	5d                   	pop    %rbp
+  8040c4:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040c5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8040ca:	eb ec                	jmp    8040b8 <file_map+0x75>
+
+00000000008040cc <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  8040cc:	55                   	push   %rbp
+  8040cd:	48 89 e5             	mov    %rsp,%rbp
+  8040d0:	41 54                	push   %r12
+  8040d2:	53                   	push   %rbx
+  8040d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8040d7:	41 89 f4             	mov    %esi,%r12d
+  8040da:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8040dd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8040e1:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  8040e8:	00 00 00 
+  8040eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040ed:	85 c0                	test   %eax,%eax
+  8040ef:	78 3c                	js     80412d <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040f5:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8040fc:	00 00 00 
+  8040ff:	8b 0a                	mov    (%rdx),%ecx
+  804101:	39 08                	cmp    %ecx,(%rax)
+  804103:	75 31                	jne    804136 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804105:	8b 40 0c             	mov    0xc(%rax),%eax
+  804108:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80410b:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  80410f:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804113:	ba 10 00 00 00       	mov    $0x10,%edx
+  804118:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80411c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804121:	48 b8 cf 3a 80 00 00 	movabs $0x803acf,%rax
+  804128:	00 00 00 
+  80412b:	ff d0                	call   *%rax
+}
+  80412d:	48 83 c4 20          	add    $0x20,%rsp
+  804131:	5b                   	pop    %rbx
+  804132:	41 5c                	pop    %r12
+  804134:	5d                   	pop    %rbp
+  804135:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804136:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80413b:	eb f0                	jmp    80412d <file_msync+0x61>
+
+000000000080413d <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80413d:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804141:	7f 01                	jg     804144 <writebuf+0x7>
+  804143:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804144:	55                   	push   %rbp
+  804145:	48 89 e5             	mov    %rsp,%rbp
+  804148:	53                   	push   %rbx
+  804149:	48 83 ec 08          	sub    $0x8,%rsp
+  80414d:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804150:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804154:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804158:	8b 3f                	mov    (%rdi),%edi
+  80415a:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  804161:	00 00 00 
+  804164:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804166:	48 85 c0             	test   %rax,%rax
+  804169:	7e 04                	jle    80416f <writebuf+0x32>
+  80416b:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80416f:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804173:	48 39 c2             	cmp    %rax,%rdx
+  804176:	74 0f                	je     804187 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804178:	48 85 c0             	test   %rax,%rax
+  80417b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804180:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804184:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804187:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80418b:	c9                   	leave
+  80418c:	c3                   	ret
+
+000000000080418d <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80418d:	8b 46 04             	mov    0x4(%rsi),%eax
+  804190:	8d 50 01             	lea    0x1(%rax),%edx
+  804193:	89 56 04             	mov    %edx,0x4(%rsi)
+  804196:	48 98                	cltq
+  804198:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80419d:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8041a3:	74 01                	je     8041a6 <putch+0x19>
+  8041a5:	c3                   	ret
+putch(int ch, void *arg) {
+  8041a6:	55                   	push   %rbp
+  8041a7:	48 89 e5             	mov    %rsp,%rbp
+  8041aa:	53                   	push   %rbx
+  8041ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8041af:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8041b2:	48 89 f7             	mov    %rsi,%rdi
+  8041b5:	48 b8 3d 41 80 00 00 	movabs $0x80413d,%rax
+  8041bc:	00 00 00 
+  8041bf:	ff d0                	call   *%rax
+        state->offset = 0;
+  8041c1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8041c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041cc:	c9                   	leave
+  8041cd:	c3                   	ret
+
+00000000008041ce <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8041ce:	55                   	push   %rbp
+  8041cf:	48 89 e5             	mov    %rsp,%rbp
+  8041d2:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8041d9:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8041dc:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8041e2:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8041e9:	00 00 00 
+    state.result = 0;
+  8041ec:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8041f3:	00 00 00 00 
+    state.error = 1;
+  8041f7:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8041fe:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804201:	48 89 f2             	mov    %rsi,%rdx
+  804204:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80420b:	48 bf 8d 41 80 00 00 	movabs $0x80418d,%rdi
+  804212:	00 00 00 
+  804215:	48 b8 fc 1b 80 00 00 	movabs $0x801bfc,%rax
+  80421c:	00 00 00 
+  80421f:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804221:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804228:	7f 14                	jg     80423e <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80422a:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804231:	48 85 c0             	test   %rax,%rax
+  804234:	75 06                	jne    80423c <vfprintf+0x6e>
+  804236:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80423c:	c9                   	leave
+  80423d:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80423e:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804245:	48 b8 3d 41 80 00 00 	movabs $0x80413d,%rax
+  80424c:	00 00 00 
+  80424f:	ff d0                	call   *%rax
+  804251:	eb d7                	jmp    80422a <vfprintf+0x5c>
+
+0000000000804253 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804253:	55                   	push   %rbp
+  804254:	48 89 e5             	mov    %rsp,%rbp
+  804257:	48 83 ec 50          	sub    $0x50,%rsp
+  80425b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80425f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804263:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804267:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80426b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804272:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804276:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80427a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80427e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804282:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804286:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  80428d:	00 00 00 
+  804290:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804292:	c9                   	leave
+  804293:	c3                   	ret
+
+0000000000804294 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804294:	55                   	push   %rbp
+  804295:	48 89 e5             	mov    %rsp,%rbp
+  804298:	48 83 ec 50          	sub    $0x50,%rsp
+  80429c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8042a0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042a4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042a8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042ac:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8042b0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8042b7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042bf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8042c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8042c7:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8042cb:	48 89 fe             	mov    %rdi,%rsi
+  8042ce:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042d3:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  8042da:	00 00 00 
+  8042dd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8042df:	c9                   	leave
+  8042e0:	c3                   	ret
+
+00000000008042e1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8042e1:	55                   	push   %rbp
+  8042e2:	48 89 e5             	mov    %rsp,%rbp
+  8042e5:	41 54                	push   %r12
+  8042e7:	53                   	push   %rbx
+  8042e8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042eb:	48 b8 6a 33 80 00 00 	movabs $0x80336a,%rax
+  8042f2:	00 00 00 
+  8042f5:	ff d0                	call   *%rax
+  8042f7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8042fa:	48 be 10 6a 80 00 00 	movabs $0x806a10,%rsi
+  804301:	00 00 00 
+  804304:	48 89 df             	mov    %rbx,%rdi
+  804307:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804313:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804318:	41 2b 04 24          	sub    (%r12),%eax
+  80431c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804322:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804329:	00 00 00 
+    stat->st_dev = &devpipe;
+  80432c:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804333:	00 00 00 
+  804336:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80433d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804342:	5b                   	pop    %rbx
+  804343:	41 5c                	pop    %r12
+  804345:	5d                   	pop    %rbp
+  804346:	c3                   	ret
+
+0000000000804347 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804347:	55                   	push   %rbp
+  804348:	48 89 e5             	mov    %rsp,%rbp
+  80434b:	41 54                	push   %r12
+  80434d:	53                   	push   %rbx
+  80434e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804351:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804356:	48 89 fe             	mov    %rdi,%rsi
+  804359:	bf 00 00 00 00       	mov    $0x0,%edi
+  80435e:	49 bc 20 2c 80 00 00 	movabs $0x802c20,%r12
+  804365:	00 00 00 
+  804368:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80436b:	48 89 df             	mov    %rbx,%rdi
+  80436e:	48 b8 6a 33 80 00 00 	movabs $0x80336a,%rax
+  804375:	00 00 00 
+  804378:	ff d0                	call   *%rax
+  80437a:	48 89 c6             	mov    %rax,%rsi
+  80437d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804382:	bf 00 00 00 00       	mov    $0x0,%edi
+  804387:	41 ff d4             	call   *%r12
+}
+  80438a:	5b                   	pop    %rbx
+  80438b:	41 5c                	pop    %r12
+  80438d:	5d                   	pop    %rbp
+  80438e:	c3                   	ret
+
+000000000080438f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80438f:	55                   	push   %rbp
+  804390:	48 89 e5             	mov    %rsp,%rbp
+  804393:	41 57                	push   %r15
+  804395:	41 56                	push   %r14
+  804397:	41 55                	push   %r13
+  804399:	41 54                	push   %r12
+  80439b:	53                   	push   %rbx
+  80439c:	48 83 ec 18          	sub    $0x18,%rsp
+  8043a0:	49 89 fc             	mov    %rdi,%r12
+  8043a3:	49 89 f5             	mov    %rsi,%r13
+  8043a6:	49 89 d7             	mov    %rdx,%r15
+  8043a9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8043ad:	48 b8 6a 33 80 00 00 	movabs $0x80336a,%rax
+  8043b4:	00 00 00 
+  8043b7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8043b9:	4d 85 ff             	test   %r15,%r15
+  8043bc:	0f 84 af 00 00 00    	je     804471 <devpipe_write+0xe2>
+  8043c2:	48 89 c3             	mov    %rax,%rbx
+  8043c5:	4c 89 f8             	mov    %r15,%rax
+  8043c8:	4d 89 ef             	mov    %r13,%r15
+  8043cb:	4c 01 e8             	add    %r13,%rax
+  8043ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043d2:	49 bd 16 2b 80 00 00 	movabs $0x802b16,%r13
+  8043d9:	00 00 00 
+            sys_yield();
+  8043dc:	49 be a7 2a 80 00 00 	movabs $0x802aa7,%r14
+  8043e3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043e6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043e9:	48 63 ce             	movslq %esi,%rcx
+  8043ec:	48 63 03             	movslq (%rbx),%rax
+  8043ef:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043f5:	48 39 c1             	cmp    %rax,%rcx
+  8043f8:	72 2e                	jb     804428 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043fa:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043ff:	48 89 da             	mov    %rbx,%rdx
+  804402:	be 00 10 00 00       	mov    $0x1000,%esi
+  804407:	4c 89 e7             	mov    %r12,%rdi
+  80440a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80440d:	85 c0                	test   %eax,%eax
+  80440f:	74 66                	je     804477 <devpipe_write+0xe8>
+            sys_yield();
+  804411:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804414:	8b 73 04             	mov    0x4(%rbx),%esi
+  804417:	48 63 ce             	movslq %esi,%rcx
+  80441a:	48 63 03             	movslq (%rbx),%rax
+  80441d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804423:	48 39 c1             	cmp    %rax,%rcx
+  804426:	73 d2                	jae    8043fa <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804428:	41 0f b6 3f          	movzbl (%r15),%edi
+  80442c:	48 89 ca             	mov    %rcx,%rdx
+  80442f:	48 c1 ea 03          	shr    $0x3,%rdx
+  804433:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80443a:	08 10 20 
+  80443d:	48 f7 e2             	mul    %rdx
+  804440:	48 c1 ea 06          	shr    $0x6,%rdx
+  804444:	48 89 d0             	mov    %rdx,%rax
+  804447:	48 c1 e0 09          	shl    $0x9,%rax
+  80444b:	48 29 d0             	sub    %rdx,%rax
+  80444e:	48 c1 e0 03          	shl    $0x3,%rax
+  804452:	48 29 c1             	sub    %rax,%rcx
+  804455:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80445a:	83 c6 01             	add    $0x1,%esi
+  80445d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804460:	49 83 c7 01          	add    $0x1,%r15
+  804464:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804468:	49 39 c7             	cmp    %rax,%r15
+  80446b:	0f 85 75 ff ff ff    	jne    8043e6 <devpipe_write+0x57>
+    return n;
+  804471:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804475:	eb 05                	jmp    80447c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804477:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80447c:	48 83 c4 18          	add    $0x18,%rsp
+  804480:	5b                   	pop    %rbx
+  804481:	41 5c                	pop    %r12
+  804483:	41 5d                	pop    %r13
+  804485:	41 5e                	pop    %r14
+  804487:	41 5f                	pop    %r15
+  804489:	5d                   	pop    %rbp
+  80448a:	c3                   	ret
+
+000000000080448b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80448b:	55                   	push   %rbp
+  80448c:	48 89 e5             	mov    %rsp,%rbp
+  80448f:	41 57                	push   %r15
+  804491:	41 56                	push   %r14
+  804493:	41 55                	push   %r13
+  804495:	41 54                	push   %r12
+  804497:	53                   	push   %rbx
+  804498:	48 83 ec 18          	sub    $0x18,%rsp
+  80449c:	49 89 fc             	mov    %rdi,%r12
+  80449f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044a3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044a7:	48 b8 6a 33 80 00 00 	movabs $0x80336a,%rax
+  8044ae:	00 00 00 
+  8044b1:	ff d0                	call   *%rax
+  8044b3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8044b6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044bc:	49 bd 16 2b 80 00 00 	movabs $0x802b16,%r13
+  8044c3:	00 00 00 
+            sys_yield();
+  8044c6:	49 be a7 2a 80 00 00 	movabs $0x802aa7,%r14
+  8044cd:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8044d0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8044d5:	74 7d                	je     804554 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8044d7:	8b 03                	mov    (%rbx),%eax
+  8044d9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8044dc:	75 26                	jne    804504 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8044de:	4d 85 ff             	test   %r15,%r15
+  8044e1:	75 77                	jne    80455a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8044e8:	48 89 da             	mov    %rbx,%rdx
+  8044eb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044f0:	4c 89 e7             	mov    %r12,%rdi
+  8044f3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8044f6:	85 c0                	test   %eax,%eax
+  8044f8:	74 72                	je     80456c <devpipe_read+0xe1>
+            sys_yield();
+  8044fa:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8044fd:	8b 03                	mov    (%rbx),%eax
+  8044ff:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804502:	74 df                	je     8044e3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804504:	48 63 c8             	movslq %eax,%rcx
+  804507:	48 89 ca             	mov    %rcx,%rdx
+  80450a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80450e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804515:	08 10 20 
+  804518:	48 89 d0             	mov    %rdx,%rax
+  80451b:	48 f7 e6             	mul    %rsi
+  80451e:	48 c1 ea 06          	shr    $0x6,%rdx
+  804522:	48 89 d0             	mov    %rdx,%rax
+  804525:	48 c1 e0 09          	shl    $0x9,%rax
+  804529:	48 29 d0             	sub    %rdx,%rax
+  80452c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804533:	00 
+  804534:	48 89 c8             	mov    %rcx,%rax
+  804537:	48 29 d0             	sub    %rdx,%rax
+  80453a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80453f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804543:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804547:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80454a:	49 83 c7 01          	add    $0x1,%r15
+  80454e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804552:	75 83                	jne    8044d7 <devpipe_read+0x4c>
+    return n;
+  804554:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804558:	eb 03                	jmp    80455d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80455a:	4c 89 f8             	mov    %r15,%rax
+}
+  80455d:	48 83 c4 18          	add    $0x18,%rsp
+  804561:	5b                   	pop    %rbx
+  804562:	41 5c                	pop    %r12
+  804564:	41 5d                	pop    %r13
+  804566:	41 5e                	pop    %r14
+  804568:	41 5f                	pop    %r15
+  80456a:	5d                   	pop    %rbp
+  80456b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80456c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804571:	eb ea                	jmp    80455d <devpipe_read+0xd2>
+
+0000000000804573 <pipe>:
+pipe(int pfd[2]) {
+  804573:	55                   	push   %rbp
+  804574:	48 89 e5             	mov    %rsp,%rbp
+  804577:	41 55                	push   %r13
+  804579:	41 54                	push   %r12
+  80457b:	53                   	push   %rbx
+  80457c:	48 83 ec 18          	sub    $0x18,%rsp
+  804580:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804583:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804587:	48 b8 86 33 80 00 00 	movabs $0x803386,%rax
+  80458e:	00 00 00 
+  804591:	ff d0                	call   *%rax
+  804593:	89 c3                	mov    %eax,%ebx
+  804595:	85 c0                	test   %eax,%eax
+  804597:	0f 88 a0 01 00 00    	js     80473d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80459d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045a7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8045ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045b0:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  8045b7:	00 00 00 
+  8045ba:	ff d0                	call   *%rax
+  8045bc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8045be:	85 c0                	test   %eax,%eax
+  8045c0:	0f 88 77 01 00 00    	js     80473d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8045c6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8045ca:	48 b8 86 33 80 00 00 	movabs $0x803386,%rax
+  8045d1:	00 00 00 
+  8045d4:	ff d0                	call   *%rax
+  8045d6:	89 c3                	mov    %eax,%ebx
+  8045d8:	85 c0                	test   %eax,%eax
+  8045da:	0f 88 43 01 00 00    	js     804723 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8045e0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045ea:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8045ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045f3:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  8045fa:	00 00 00 
+  8045fd:	ff d0                	call   *%rax
+  8045ff:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804601:	85 c0                	test   %eax,%eax
+  804603:	0f 88 1a 01 00 00    	js     804723 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804609:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80460d:	48 b8 6a 33 80 00 00 	movabs $0x80336a,%rax
+  804614:	00 00 00 
+  804617:	ff d0                	call   *%rax
+  804619:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80461c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804621:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804626:	48 89 c6             	mov    %rax,%rsi
+  804629:	bf 00 00 00 00       	mov    $0x0,%edi
+  80462e:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  804635:	00 00 00 
+  804638:	ff d0                	call   *%rax
+  80463a:	89 c3                	mov    %eax,%ebx
+  80463c:	85 c0                	test   %eax,%eax
+  80463e:	0f 88 c5 00 00 00    	js     804709 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804644:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804648:	48 b8 6a 33 80 00 00 	movabs $0x80336a,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+  804654:	48 89 c1             	mov    %rax,%rcx
+  804657:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80465d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804663:	ba 00 00 00 00       	mov    $0x0,%edx
+  804668:	4c 89 ee             	mov    %r13,%rsi
+  80466b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804670:	48 b8 b5 2b 80 00 00 	movabs $0x802bb5,%rax
+  804677:	00 00 00 
+  80467a:	ff d0                	call   *%rax
+  80467c:	89 c3                	mov    %eax,%ebx
+  80467e:	85 c0                	test   %eax,%eax
+  804680:	78 6e                	js     8046f0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804682:	be 00 10 00 00       	mov    $0x1000,%esi
+  804687:	4c 89 ef             	mov    %r13,%rdi
+  80468a:	48 b8 de 2a 80 00 00 	movabs $0x802ade,%rax
+  804691:	00 00 00 
+  804694:	ff d0                	call   *%rax
+  804696:	83 f8 02             	cmp    $0x2,%eax
+  804699:	0f 85 ab 00 00 00    	jne    80474a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80469f:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8046a6:	00 00 
+  8046a8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8046ac:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8046ae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8046b2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8046b9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8046bd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8046bf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046c3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8046ca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8046ce:	48 bb 58 33 80 00 00 	movabs $0x803358,%rbx
+  8046d5:	00 00 00 
+  8046d8:	ff d3                	call   *%rbx
+  8046da:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8046de:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8046e2:	ff d3                	call   *%rbx
+  8046e4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8046e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046ee:	eb 4d                	jmp    80473d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8046f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046f5:	4c 89 ee             	mov    %r13,%rsi
+  8046f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046fd:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  804704:	00 00 00 
+  804707:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804709:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80470e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804712:	bf 00 00 00 00       	mov    $0x0,%edi
+  804717:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  80471e:	00 00 00 
+  804721:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804723:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804728:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80472c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804731:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  804738:	00 00 00 
+  80473b:	ff d0                	call   *%rax
+}
+  80473d:	89 d8                	mov    %ebx,%eax
+  80473f:	48 83 c4 18          	add    $0x18,%rsp
+  804743:	5b                   	pop    %rbx
+  804744:	41 5c                	pop    %r12
+  804746:	41 5d                	pop    %r13
+  804748:	5d                   	pop    %rbp
+  804749:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80474a:	48 b9 28 6a 80 00 00 	movabs $0x806a28,%rcx
+  804751:	00 00 00 
+  804754:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  80475b:	00 00 00 
+  80475e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804763:	48 bf 17 6a 80 00 00 	movabs $0x806a17,%rdi
+  80476a:	00 00 00 
+  80476d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804772:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  804779:	00 00 00 
+  80477c:	41 ff d0             	call   *%r8
+
+000000000080477f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80477f:	55                   	push   %rbp
+  804780:	48 89 e5             	mov    %rsp,%rbp
+  804783:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804787:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80478b:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  804792:	00 00 00 
+  804795:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804797:	85 c0                	test   %eax,%eax
+  804799:	78 35                	js     8047d0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80479b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80479f:	48 b8 6a 33 80 00 00 	movabs $0x80336a,%rax
+  8047a6:	00 00 00 
+  8047a9:	ff d0                	call   *%rax
+  8047ab:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8047ae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8047b3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8047b8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047bc:	48 b8 16 2b 80 00 00 	movabs $0x802b16,%rax
+  8047c3:	00 00 00 
+  8047c6:	ff d0                	call   *%rax
+  8047c8:	85 c0                	test   %eax,%eax
+  8047ca:	0f 94 c0             	sete   %al
+  8047cd:	0f b6 c0             	movzbl %al,%eax
+}
+  8047d0:	c9                   	leave
+  8047d1:	c3                   	ret
+
+00000000008047d2 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8047d2:	55                   	push   %rbp
+  8047d3:	48 89 e5             	mov    %rsp,%rbp
+  8047d6:	41 55                	push   %r13
+  8047d8:	41 54                	push   %r12
+  8047da:	53                   	push   %rbx
+  8047db:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8047df:	85 ff                	test   %edi,%edi
+  8047e1:	74 73                	je     804856 <wait+0x84>
+  8047e3:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8047e6:	89 f8                	mov    %edi,%eax
+  8047e8:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  8047ed:	89 f9                	mov    %edi,%ecx
+  8047ef:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8047f5:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  8047fc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804803:	00 00 00 
+  804806:	48 01 ca             	add    %rcx,%rdx
+  804809:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80480f:	39 d7                	cmp    %edx,%edi
+  804811:	75 38                	jne    80484b <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804813:	48 98                	cltq
+  804815:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80481c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804823:	00 00 00 
+  804826:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804829:	49 bd a7 2a 80 00 00 	movabs $0x802aa7,%r13
+  804830:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804833:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  804839:	85 c0                	test   %eax,%eax
+  80483b:	74 0e                	je     80484b <wait+0x79>
+        sys_yield();
+  80483d:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804840:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804846:	44 39 e0             	cmp    %r12d,%eax
+  804849:	74 e8                	je     804833 <wait+0x61>
+    }
+}
+  80484b:	48 83 c4 08          	add    $0x8,%rsp
+  80484f:	5b                   	pop    %rbx
+  804850:	41 5c                	pop    %r12
+  804852:	41 5d                	pop    %r13
+  804854:	5d                   	pop    %rbp
+  804855:	c3                   	ret
+    assert(envid != 0);
+  804856:	48 b9 4c 6a 80 00 00 	movabs $0x806a4c,%rcx
+  80485d:	00 00 00 
+  804860:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  804867:	00 00 00 
+  80486a:	be 06 00 00 00       	mov    $0x6,%esi
+  80486f:	48 bf 57 6a 80 00 00 	movabs $0x806a57,%rdi
+  804876:	00 00 00 
+  804879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80487e:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  804885:	00 00 00 
+  804888:	41 ff d0             	call   *%r8
+
+000000000080488b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80488b:	48 89 f8             	mov    %rdi,%rax
+  80488e:	48 c1 e8 27          	shr    $0x27,%rax
+  804892:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804899:	01 00 00 
+  80489c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048a0:	f6 c2 01             	test   $0x1,%dl
+  8048a3:	74 6d                	je     804912 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8048a5:	48 89 f8             	mov    %rdi,%rax
+  8048a8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8048ac:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8048b3:	01 00 00 
+  8048b6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048ba:	f6 c2 01             	test   $0x1,%dl
+  8048bd:	74 62                	je     804921 <get_uvpt_entry+0x96>
+  8048bf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8048c6:	01 00 00 
+  8048c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048cd:	f6 c2 80             	test   $0x80,%dl
+  8048d0:	75 4f                	jne    804921 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8048d2:	48 89 f8             	mov    %rdi,%rax
+  8048d5:	48 c1 e8 15          	shr    $0x15,%rax
+  8048d9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048e0:	01 00 00 
+  8048e3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048e7:	f6 c2 01             	test   $0x1,%dl
+  8048ea:	74 44                	je     804930 <get_uvpt_entry+0xa5>
+  8048ec:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048f3:	01 00 00 
+  8048f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048fa:	f6 c2 80             	test   $0x80,%dl
+  8048fd:	75 31                	jne    804930 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8048ff:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804903:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80490a:	01 00 00 
+  80490d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804911:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804912:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804919:	01 00 00 
+  80491c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804920:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804921:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804928:	01 00 00 
+  80492b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80492f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804930:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804937:	01 00 00 
+  80493a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80493e:	c3                   	ret
+
+000000000080493f <get_prot>:
+
+int
+get_prot(void *va) {
+  80493f:	55                   	push   %rbp
+  804940:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804943:	48 b8 8b 48 80 00 00 	movabs $0x80488b,%rax
+  80494a:	00 00 00 
+  80494d:	ff d0                	call   *%rax
+  80494f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804952:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804957:	89 c1                	mov    %eax,%ecx
+  804959:	83 c9 04             	or     $0x4,%ecx
+  80495c:	f6 c2 01             	test   $0x1,%dl
+  80495f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804962:	89 c1                	mov    %eax,%ecx
+  804964:	83 c9 02             	or     $0x2,%ecx
+  804967:	f6 c2 02             	test   $0x2,%dl
+  80496a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80496d:	89 c1                	mov    %eax,%ecx
+  80496f:	83 c9 01             	or     $0x1,%ecx
+  804972:	48 85 d2             	test   %rdx,%rdx
+  804975:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804978:	89 c1                	mov    %eax,%ecx
+  80497a:	83 c9 40             	or     $0x40,%ecx
+  80497d:	f6 c6 04             	test   $0x4,%dh
+  804980:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804983:	5d                   	pop    %rbp
+  804984:	c3                   	ret
+
+0000000000804985 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804985:	55                   	push   %rbp
+  804986:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804989:	48 b8 8b 48 80 00 00 	movabs $0x80488b,%rax
+  804990:	00 00 00 
+  804993:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804995:	48 c1 e8 06          	shr    $0x6,%rax
+  804999:	83 e0 01             	and    $0x1,%eax
+}
+  80499c:	5d                   	pop    %rbp
+  80499d:	c3                   	ret
+
+000000000080499e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80499e:	55                   	push   %rbp
+  80499f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8049a2:	48 b8 8b 48 80 00 00 	movabs $0x80488b,%rax
+  8049a9:	00 00 00 
+  8049ac:	ff d0                	call   *%rax
+  8049ae:	83 e0 01             	and    $0x1,%eax
+}
+  8049b1:	5d                   	pop    %rbp
+  8049b2:	c3                   	ret
+
+00000000008049b3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8049b3:	55                   	push   %rbp
+  8049b4:	48 89 e5             	mov    %rsp,%rbp
+  8049b7:	41 57                	push   %r15
+  8049b9:	41 56                	push   %r14
+  8049bb:	41 55                	push   %r13
+  8049bd:	41 54                	push   %r12
+  8049bf:	53                   	push   %rbx
+  8049c0:	48 83 ec 28          	sub    $0x28,%rsp
+  8049c4:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8049c8:	48 85 ff             	test   %rdi,%rdi
+  8049cb:	74 1e                	je     8049eb <foreach_shared_region+0x38>
+  8049cd:	49 89 ff             	mov    %rdi,%r15
+  8049d0:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8049d6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8049dc:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8049e3:	01 00 00 
+  8049e6:	e9 72 02 00 00       	jmp    804c5d <foreach_shared_region+0x2aa>
+    assert(fun);
+  8049eb:	48 b9 62 6a 80 00 00 	movabs $0x806a62,%rcx
+  8049f2:	00 00 00 
+  8049f5:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  8049fc:	00 00 00 
+  8049ff:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804a04:	48 bf 66 6a 80 00 00 	movabs $0x806a66,%rdi
+  804a0b:	00 00 00 
+  804a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a13:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  804a1a:	00 00 00 
+  804a1d:	41 ff d0             	call   *%r8
+  804a20:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804a27:	eb 6c                	jmp    804a95 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804a29:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804a30:	ff ff ff 
+  804a33:	4c 21 e2             	and    %r12,%rdx
+  804a36:	48 89 d8             	mov    %rbx,%rax
+  804a39:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a3e:	48 83 c0 01          	add    $0x1,%rax
+  804a42:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804a46:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804a4d:	00 00 00 
+  804a50:	48 21 c8             	and    %rcx,%rax
+  804a53:	48 09 d0             	or     %rdx,%rax
+  804a56:	49 89 c4             	mov    %rax,%r12
+  804a59:	eb 30                	jmp    804a8b <foreach_shared_region+0xd8>
+  804a5b:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804a62:	ff ff ff 
+  804a65:	4c 21 e2             	and    %r12,%rdx
+  804a68:	48 89 d8             	mov    %rbx,%rax
+  804a6b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a70:	48 83 c0 01          	add    $0x1,%rax
+  804a74:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804a78:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804a7f:	00 00 00 
+  804a82:	48 21 c8             	and    %rcx,%rax
+  804a85:	48 09 d0             	or     %rdx,%rax
+  804a88:	49 89 c4             	mov    %rax,%r12
+  804a8b:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804a8f:	0f 84 99 01 00 00    	je     804c2e <foreach_shared_region+0x27b>
+  804a95:	4c 89 e3             	mov    %r12,%rbx
+  804a98:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804a9c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804aa3:	01 00 00 
+  804aa6:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804aaa:	a8 01                	test   $0x1,%al
+  804aac:	0f 84 77 ff ff ff    	je     804a29 <foreach_shared_region+0x76>
+  804ab2:	a8 80                	test   $0x80,%al
+  804ab4:	74 19                	je     804acf <foreach_shared_region+0x11c>
+  804ab6:	f6 c4 04             	test   $0x4,%ah
+  804ab9:	74 a0                	je     804a5b <foreach_shared_region+0xa8>
+  804abb:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804ac2:	40 
+  804ac3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ac7:	4c 89 e7             	mov    %r12,%rdi
+  804aca:	41 ff d7             	call   *%r15
+  804acd:	eb 8c                	jmp    804a5b <foreach_shared_region+0xa8>
+  804acf:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804ad6:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804ada:	eb 46                	jmp    804b22 <foreach_shared_region+0x16f>
+  804adc:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804ae3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804ae9:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804aed:	48 c1 e0 15          	shl    $0x15,%rax
+  804af1:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804af6:	49 09 c4             	or     %rax,%r12
+  804af9:	eb 1d                	jmp    804b18 <foreach_shared_region+0x165>
+  804afb:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804b02:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b08:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804b0c:	48 c1 e0 15          	shl    $0x15,%rax
+  804b10:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804b15:	49 09 c4             	or     %rax,%r12
+  804b18:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804b1c:	0f 84 d3 00 00 00    	je     804bf5 <foreach_shared_region+0x242>
+  804b22:	4c 89 e3             	mov    %r12,%rbx
+  804b25:	48 c1 eb 15          	shr    $0x15,%rbx
+  804b29:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804b30:	01 00 00 
+  804b33:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804b37:	a8 01                	test   $0x1,%al
+  804b39:	74 a1                	je     804adc <foreach_shared_region+0x129>
+  804b3b:	a8 80                	test   $0x80,%al
+  804b3d:	74 19                	je     804b58 <foreach_shared_region+0x1a5>
+  804b3f:	f6 c4 04             	test   $0x4,%ah
+  804b42:	74 b7                	je     804afb <foreach_shared_region+0x148>
+  804b44:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804b4b:	00 
+  804b4c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b50:	4c 89 e7             	mov    %r12,%rdi
+  804b53:	41 ff d7             	call   *%r15
+  804b56:	eb a3                	jmp    804afb <foreach_shared_region+0x148>
+  804b58:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804b5e:	eb 3b                	jmp    804b9b <foreach_shared_region+0x1e8>
+  804b60:	f6 c4 04             	test   $0x4,%ah
+  804b63:	74 12                	je     804b77 <foreach_shared_region+0x1c4>
+  804b65:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804b6c:	00 
+  804b6d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b71:	4c 89 e7             	mov    %r12,%rdi
+  804b74:	41 ff d7             	call   *%r15
+  804b77:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b7e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b84:	48 83 c3 01          	add    $0x1,%rbx
+  804b88:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b8c:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b92:	49 09 dc             	or     %rbx,%r12
+  804b95:	41 83 ed 01          	sub    $0x1,%r13d
+  804b99:	74 2f                	je     804bca <foreach_shared_region+0x217>
+  804b9b:	4c 89 e3             	mov    %r12,%rbx
+  804b9e:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804ba2:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804ba6:	a8 01                	test   $0x1,%al
+  804ba8:	75 b6                	jne    804b60 <foreach_shared_region+0x1ad>
+  804baa:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804bb1:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804bb7:	48 83 c3 01          	add    $0x1,%rbx
+  804bbb:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804bbf:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804bc5:	49 09 dc             	or     %rbx,%r12
+  804bc8:	eb cb                	jmp    804b95 <foreach_shared_region+0x1e2>
+  804bca:	4c 89 e0             	mov    %r12,%rax
+  804bcd:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804bd3:	49 c1 ec 15          	shr    $0x15,%r12
+  804bd7:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804bde:	49 83 c4 01          	add    $0x1,%r12
+  804be2:	49 c1 e4 15          	shl    $0x15,%r12
+  804be6:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804bed:	49 09 c4             	or     %rax,%r12
+  804bf0:	e9 23 ff ff ff       	jmp    804b18 <foreach_shared_region+0x165>
+  804bf5:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804bf9:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804c00:	ff ff ff 
+  804c03:	4c 21 e0             	and    %r12,%rax
+  804c06:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804c0a:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804c11:	49 83 c4 01          	add    $0x1,%r12
+  804c15:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804c19:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804c20:	00 00 00 
+  804c23:	49 21 d4             	and    %rdx,%r12
+  804c26:	49 09 c4             	or     %rax,%r12
+  804c29:	e9 5d fe ff ff       	jmp    804a8b <foreach_shared_region+0xd8>
+  804c2e:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804c35:	00 ff ff 
+  804c38:	4c 21 e0             	and    %r12,%rax
+  804c3b:	49 c1 ec 27          	shr    $0x27,%r12
+  804c3f:	49 83 c4 01          	add    $0x1,%r12
+  804c43:	49 c1 e4 27          	shl    $0x27,%r12
+  804c47:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804c4e:	ff 00 00 
+  804c51:	49 21 d4             	and    %rdx,%r12
+  804c54:	49 09 c4             	or     %rax,%r12
+  804c57:	41 83 ed 01          	sub    $0x1,%r13d
+  804c5b:	74 48                	je     804ca5 <foreach_shared_region+0x2f2>
+  804c5d:	4c 89 e0             	mov    %r12,%rax
+  804c60:	48 c1 e8 27          	shr    $0x27,%rax
+  804c64:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804c6b:	01 00 00 
+  804c6e:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804c72:	f6 c2 01             	test   $0x1,%dl
+  804c75:	0f 85 a5 fd ff ff    	jne    804a20 <foreach_shared_region+0x6d>
+  804c7b:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804c82:	00 ff ff 
+  804c85:	4c 21 e2             	and    %r12,%rdx
+  804c88:	48 83 c0 01          	add    $0x1,%rax
+  804c8c:	48 c1 e0 27          	shl    $0x27,%rax
+  804c90:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804c97:	ff 00 00 
+  804c9a:	48 21 c8             	and    %rcx,%rax
+  804c9d:	48 09 d0             	or     %rdx,%rax
+  804ca0:	49 89 c4             	mov    %rax,%r12
+  804ca3:	eb b2                	jmp    804c57 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804ca5:	4d 85 e4             	test   %r12,%r12
+  804ca8:	75 14                	jne    804cbe <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804caf:	48 83 c4 28          	add    $0x28,%rsp
+  804cb3:	5b                   	pop    %rbx
+  804cb4:	41 5c                	pop    %r12
+  804cb6:	41 5d                	pop    %r13
+  804cb8:	41 5e                	pop    %r14
+  804cba:	41 5f                	pop    %r15
+  804cbc:	5d                   	pop    %rbp
+  804cbd:	c3                   	ret
+    assert(addr == 0);
+  804cbe:	48 b9 71 6a 80 00 00 	movabs $0x806a71,%rcx
+  804cc5:	00 00 00 
+  804cc8:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  804ccf:	00 00 00 
+  804cd2:	be 67 00 00 00       	mov    $0x67,%esi
+  804cd7:	48 bf 66 6a 80 00 00 	movabs $0x806a66,%rdi
+  804cde:	00 00 00 
+  804ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ce6:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  804ced:	00 00 00 
+  804cf0:	41 ff d0             	call   *%r8
+
+0000000000804cf3 <vsys_gettime>:
+    // LAB 12: Your code here DONE
+    if (num < 0 || num >= NVSYSCALLS) {
+        return -E_NO_SYS;
+    }
+
+    return vsys[num];
+  804cf3:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  804cfa:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  804cfc:	c3                   	ret
+
+0000000000804cfd <vsys_gettimems>:
+    return vsys[num];
+  804cfd:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  804d04:	00 00 
+
+uint32_t
+vsys_gettimems() {
+    return (uint32_t)vsyscall(VSYS_gettimems);
+}
+  804d06:	c3                   	ret
+
+0000000000804d07 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804d07:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804d0e:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804d11:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804d17:	eb 33                	jmp    804d4c <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d19:	48 83 c0 20          	add    $0x20,%rax
+  804d1d:	4c 39 c0             	cmp    %r8,%rax
+  804d20:	74 25                	je     804d47 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804d22:	48 8b 10             	mov    (%rax),%rdx
+  804d25:	48 85 d2             	test   %rdx,%rdx
+  804d28:	74 ef                	je     804d19 <mmap_place+0x12>
+  804d2a:	48 89 d1             	mov    %rdx,%rcx
+  804d2d:	48 03 48 08          	add    0x8(%rax),%rcx
+  804d31:	48 39 cf             	cmp    %rcx,%rdi
+  804d34:	73 e3                	jae    804d19 <mmap_place+0x12>
+  804d36:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804d3a:	4c 39 ca             	cmp    %r9,%rdx
+  804d3d:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804d41:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804d45:	eb d2                	jmp    804d19 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804d47:	45 84 d2             	test   %r10b,%r10b
+  804d4a:	74 12                	je     804d5e <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d4c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d53:	00 00 00 
+        moved = 0;
+  804d56:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804d5c:	eb c4                	jmp    804d22 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804d5e:	48 01 fe             	add    %rdi,%rsi
+  804d61:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804d68:	00 00 00 
+  804d6b:	48 39 f0             	cmp    %rsi,%rax
+  804d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d73:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804d77:	c3                   	ret
+
+0000000000804d78 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804d78:	55                   	push   %rbp
+  804d79:	48 89 e5             	mov    %rsp,%rbp
+  804d7c:	41 57                	push   %r15
+  804d7e:	41 56                	push   %r14
+  804d80:	41 55                	push   %r13
+  804d82:	41 54                	push   %r12
+  804d84:	53                   	push   %rbx
+  804d85:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804d89:	48 8b 1f             	mov    (%rdi),%rbx
+  804d8c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d93:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d9a:	00 00 00 
+  804d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804da2:	eb 12                	jmp    804db6 <mmap_pgfault+0x3e>
+  804da4:	48 83 c2 01          	add    $0x1,%rdx
+  804da8:	48 83 c0 20          	add    $0x20,%rax
+  804dac:	48 83 fa 20          	cmp    $0x20,%rdx
+  804db0:	0f 84 04 01 00 00    	je     804eba <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804db6:	48 8b 08             	mov    (%rax),%rcx
+  804db9:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804dbd:	48 39 de             	cmp    %rbx,%rsi
+  804dc0:	73 e2                	jae    804da4 <mmap_pgfault+0x2c>
+  804dc2:	48 03 48 08          	add    0x8(%rax),%rcx
+  804dc6:	48 39 cb             	cmp    %rcx,%rbx
+  804dc9:	73 d9                	jae    804da4 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804dcb:	48 c1 e2 05          	shl    $0x5,%rdx
+  804dcf:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804dd6:	00 00 00 
+  804dd9:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804ddd:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804de1:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804de5:	f6 c2 01             	test   $0x1,%dl
+  804de8:	0f 84 e0 00 00 00    	je     804ece <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804dee:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df3:	f6 c2 02             	test   $0x2,%dl
+  804df6:	0f 84 c3 00 00 00    	je     804ebf <mmap_pgfault+0x147>
+  804dfc:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804e03:	ff ff ff 
+  804e06:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804e0a:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804e11:	00 00 00 
+  804e14:	48 39 ca             	cmp    %rcx,%rdx
+  804e17:	0f 85 a2 00 00 00    	jne    804ebf <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804e1d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804e22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e27:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804e2e:	00 00 00 
+  804e31:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e36:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  804e3d:	00 00 00 
+  804e40:	ff d0                	call   *%rax
+  804e42:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e49:	85 d2                	test   %edx,%edx
+  804e4b:	78 72                	js     804ebf <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804e4d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e52:	48 89 de             	mov    %rbx,%rsi
+  804e55:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804e5c:	00 00 00 
+  804e5f:	4c 89 e7             	mov    %r12,%rdi
+  804e62:	48 b8 9a 27 80 00 00 	movabs $0x80279a,%rax
+  804e69:	00 00 00 
+  804e6c:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804e6e:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804e74:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804e7a:	48 89 d9             	mov    %rbx,%rcx
+  804e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e82:	4c 89 e6             	mov    %r12,%rsi
+  804e85:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e8a:	48 b8 b5 2b 80 00 00 	movabs $0x802bb5,%rax
+  804e91:	00 00 00 
+  804e94:	ff d0                	call   *%rax
+  804e96:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804e98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e9d:	4c 89 e6             	mov    %r12,%rsi
+  804ea0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ea5:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  804eac:	00 00 00 
+  804eaf:	ff d0                	call   *%rax
+    return res >= 0;
+  804eb1:	89 d8                	mov    %ebx,%eax
+  804eb3:	f7 d0                	not    %eax
+  804eb5:	c1 e8 1f             	shr    $0x1f,%eax
+  804eb8:	eb 05                	jmp    804ebf <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804eba:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804ebf:	48 83 c4 18          	add    $0x18,%rsp
+  804ec3:	5b                   	pop    %rbx
+  804ec4:	41 5c                	pop    %r12
+  804ec6:	41 5d                	pop    %r13
+  804ec8:	41 5e                	pop    %r14
+  804eca:	41 5f                	pop    %r15
+  804ecc:	5d                   	pop    %rbp
+  804ecd:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804ece:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ed2:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804ed6:	4c 03 30             	add    (%rax),%r14
+  804ed9:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804ee0:	49 39 c6             	cmp    %rax,%r14
+  804ee3:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ee7:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804eee:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ef4:	49 bf 9e 49 80 00 00 	movabs $0x80499e,%r15
+  804efb:	00 00 00 
+  804efe:	4d 39 f4             	cmp    %r14,%r12
+  804f01:	73 1d                	jae    804f20 <mmap_pgfault+0x1a8>
+  804f03:	4c 89 e7             	mov    %r12,%rdi
+  804f06:	41 ff d7             	call   *%r15
+  804f09:	84 c0                	test   %al,%al
+  804f0b:	75 13                	jne    804f20 <mmap_pgfault+0x1a8>
+  804f0d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804f14:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804f1b:	4d 39 f4             	cmp    %r14,%r12
+  804f1e:	72 e3                	jb     804f03 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804f20:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804f26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f2a:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804f2e:	74 2a                	je     804f5a <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804f30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f34:	89 de                	mov    %ebx,%esi
+  804f36:	2b 30                	sub    (%rax),%esi
+  804f38:	03 70 1c             	add    0x1c(%rax),%esi
+  804f3b:	8b 78 18             	mov    0x18(%rax),%edi
+  804f3e:	4c 89 e9             	mov    %r13,%rcx
+  804f41:	48 89 da             	mov    %rbx,%rdx
+  804f44:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  804f4b:	00 00 00 
+  804f4e:	ff d0                	call   *%rax
+    return res > 0;
+  804f50:	85 c0                	test   %eax,%eax
+  804f52:	0f 9f c0             	setg   %al
+  804f55:	e9 65 ff ff ff       	jmp    804ebf <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804f5a:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804f5e:	eb d0                	jmp    804f30 <mmap_pgfault+0x1b8>
+
+0000000000804f60 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804f60:	55                   	push   %rbp
+  804f61:	48 89 e5             	mov    %rsp,%rbp
+  804f64:	41 57                	push   %r15
+  804f66:	41 56                	push   %r14
+  804f68:	41 55                	push   %r13
+  804f6a:	41 54                	push   %r12
+  804f6c:	53                   	push   %rbx
+  804f6d:	48 83 ec 28          	sub    $0x28,%rsp
+  804f71:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804f75:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804f78:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804f7f:	ff ff ff 
+  804f82:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f8b:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804f92:	00 00 00 
+  804f95:	48 39 ca             	cmp    %rcx,%rdx
+  804f98:	0f 85 e5 00 00 00    	jne    805083 <mmap_writeback+0x123>
+  804f9e:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804fa1:	4c 39 ee             	cmp    %r13,%rsi
+  804fa4:	0f 83 e8 00 00 00    	jae    805092 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804faa:	49 be 9e 49 80 00 00 	movabs $0x80499e,%r14
+  804fb1:	00 00 00 
+  804fb4:	49 bf 85 49 80 00 00 	movabs $0x804985,%r15
+  804fbb:	00 00 00 
+  804fbe:	eb 10                	jmp    804fd0 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804fc0:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804fc7:	4d 39 ec             	cmp    %r13,%r12
+  804fca:	0f 83 ae 00 00 00    	jae    80507e <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804fd0:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804fd4:	4c 89 e7             	mov    %r12,%rdi
+  804fd7:	41 ff d6             	call   *%r14
+  804fda:	84 c0                	test   %al,%al
+  804fdc:	74 e2                	je     804fc0 <mmap_writeback+0x60>
+  804fde:	4c 89 e7             	mov    %r12,%rdi
+  804fe1:	41 ff d7             	call   *%r15
+  804fe4:	84 c0                	test   %al,%al
+  804fe6:	74 d8                	je     804fc0 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804fe8:	4c 89 e3             	mov    %r12,%rbx
+  804feb:	4d 39 ec             	cmp    %r13,%r12
+  804fee:	73 20                	jae    805010 <mmap_writeback+0xb0>
+  804ff0:	48 89 df             	mov    %rbx,%rdi
+  804ff3:	41 ff d6             	call   *%r14
+  804ff6:	84 c0                	test   %al,%al
+  804ff8:	74 16                	je     805010 <mmap_writeback+0xb0>
+  804ffa:	48 89 df             	mov    %rbx,%rdi
+  804ffd:	41 ff d7             	call   *%r15
+  805000:	84 c0                	test   %al,%al
+  805002:	74 0c                	je     805010 <mmap_writeback+0xb0>
+  805004:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80500b:	4c 39 eb             	cmp    %r13,%rbx
+  80500e:	72 e0                	jb     804ff0 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  805010:	48 89 d9             	mov    %rbx,%rcx
+  805013:	4c 29 e1             	sub    %r12,%rcx
+  805016:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80501a:	44 89 e6             	mov    %r12d,%esi
+  80501d:	2b 30                	sub    (%rax),%esi
+  80501f:	49 89 c4             	mov    %rax,%r12
+  805022:	03 70 1c             	add    0x1c(%rax),%esi
+  805025:	8b 78 18             	mov    0x18(%rax),%edi
+  805028:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80502c:	48 89 ca             	mov    %rcx,%rdx
+  80502f:	48 b8 cc 40 80 00 00 	movabs $0x8040cc,%rax
+  805036:	00 00 00 
+  805039:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80503b:	85 c0                	test   %eax,%eax
+  80503d:	78 44                	js     805083 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  80503f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  805044:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  805047:	41 89 c1             	mov    %eax,%r9d
+  80504a:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  805051:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805055:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80505e:	48 89 ce             	mov    %rcx,%rsi
+  805061:	bf 00 00 00 00       	mov    $0x0,%edi
+  805066:	48 b8 b5 2b 80 00 00 	movabs $0x802bb5,%rax
+  80506d:	00 00 00 
+  805070:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  805072:	85 c0                	test   %eax,%eax
+  805074:	78 0d                	js     805083 <mmap_writeback+0x123>
+  805076:	49 89 dc             	mov    %rbx,%r12
+  805079:	e9 49 ff ff ff       	jmp    804fc7 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  80507e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805083:	48 83 c4 28          	add    $0x28,%rsp
+  805087:	5b                   	pop    %rbx
+  805088:	41 5c                	pop    %r12
+  80508a:	41 5d                	pop    %r13
+  80508c:	41 5e                	pop    %r14
+  80508e:	41 5f                	pop    %r15
+  805090:	5d                   	pop    %rbp
+  805091:	c3                   	ret
+    return 0;
+  805092:	b8 00 00 00 00       	mov    $0x0,%eax
+  805097:	eb ea                	jmp    805083 <mmap_writeback+0x123>
+
+0000000000805099 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805099:	55                   	push   %rbp
+  80509a:	48 89 e5             	mov    %rsp,%rbp
+  80509d:	41 57                	push   %r15
+  80509f:	41 56                	push   %r14
+  8050a1:	41 55                	push   %r13
+  8050a3:	41 54                	push   %r12
+  8050a5:	53                   	push   %rbx
+  8050a6:	48 83 ec 38          	sub    $0x38,%rsp
+  8050aa:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8050ae:	48 85 f6             	test   %rsi,%rsi
+  8050b1:	0f 84 0c 02 00 00    	je     8052c3 <mmap+0x22a>
+  8050b7:	49 89 ff             	mov    %rdi,%r15
+  8050ba:	49 89 f4             	mov    %rsi,%r12
+  8050bd:	41 89 d5             	mov    %edx,%r13d
+  8050c0:	41 89 ce             	mov    %ecx,%r14d
+  8050c3:	44 89 cb             	mov    %r9d,%ebx
+  8050c6:	45 85 c9             	test   %r9d,%r9d
+  8050c9:	0f 88 f4 01 00 00    	js     8052c3 <mmap+0x22a>
+  8050cf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050d6:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  8050dd:	0f 85 e7 01 00 00    	jne    8052ca <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  8050e3:	83 e2 fd             	and    $0xfffffffd,%edx
+  8050e6:	83 fa 04             	cmp    $0x4,%edx
+  8050e9:	0f 85 db 01 00 00    	jne    8052ca <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  8050ef:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8050f2:	83 fa 01             	cmp    $0x1,%edx
+  8050f5:	0f 87 cf 01 00 00    	ja     8052ca <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  8050fb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8050ff:	44 89 c7             	mov    %r8d,%edi
+  805102:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  805109:	00 00 00 
+  80510c:	ff d0                	call   *%rax
+  80510e:	89 c2                	mov    %eax,%edx
+  805110:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805117:	85 d2                	test   %edx,%edx
+  805119:	0f 88 ab 01 00 00    	js     8052ca <mmap+0x231>
+  80511f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805123:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80512a:	00 00 00 
+  80512d:	8b 09                	mov    (%rcx),%ecx
+  80512f:	39 0a                	cmp    %ecx,(%rdx)
+  805131:	0f 85 93 01 00 00    	jne    8052ca <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805137:	8b 52 08             	mov    0x8(%rdx),%edx
+  80513a:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  80513d:	83 fa 01             	cmp    $0x1,%edx
+  805140:	0f 84 84 01 00 00    	je     8052ca <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805146:	41 83 fe 01          	cmp    $0x1,%r14d
+  80514a:	74 42                	je     80518e <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  80514c:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805153:	4c 89 e6             	mov    %r12,%rsi
+  805156:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80515d:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805161:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805165:	4d 85 ff             	test   %r15,%r15
+  805168:	74 67                	je     8051d1 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80516a:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805171:	75 0f                	jne    805182 <mmap+0xe9>
+  805173:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  80517a:	00 00 00 
+  80517d:	49 39 c7             	cmp    %rax,%r15
+  805180:	77 1b                	ja     80519d <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805182:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805189:	e9 3c 01 00 00       	jmp    8052ca <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80518e:	41 f6 c5 02          	test   $0x2,%r13b
+  805192:	74 b8                	je     80514c <mmap+0xb3>
+  805194:	85 d2                	test   %edx,%edx
+  805196:	75 b4                	jne    80514c <mmap+0xb3>
+  805198:	e9 2d 01 00 00       	jmp    8052ca <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80519d:	4c 89 ff             	mov    %r15,%rdi
+  8051a0:	48 b8 07 4d 80 00 00 	movabs $0x804d07,%rax
+  8051a7:	00 00 00 
+  8051aa:	ff d0                	call   *%rax
+  8051ac:	48 89 c2             	mov    %rax,%rdx
+  8051af:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8051b6:	49 39 d7             	cmp    %rdx,%r15
+  8051b9:	0f 85 0b 01 00 00    	jne    8052ca <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8051bf:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8051c6:	00 00 00 
+  8051c9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8051cf:	eb 44                	jmp    805215 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8051d1:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8051d5:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  8051dc:	00 00 00 
+  8051df:	48 b8 07 4d 80 00 00 	movabs $0x804d07,%rax
+  8051e6:	00 00 00 
+  8051e9:	ff d0                	call   *%rax
+  8051eb:	48 89 c7             	mov    %rax,%rdi
+  8051ee:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  8051f2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8051f9:	48 85 ff             	test   %rdi,%rdi
+  8051fc:	75 c1                	jne    8051bf <mmap+0x126>
+  8051fe:	e9 c7 00 00 00       	jmp    8052ca <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805203:	49 83 c4 01          	add    $0x1,%r12
+  805207:	48 83 c0 20          	add    $0x20,%rax
+  80520b:	49 83 fc 20          	cmp    $0x20,%r12
+  80520f:	0f 84 a5 00 00 00    	je     8052ba <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805215:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805219:	75 e8                	jne    805203 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  80521b:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80521f:	48 b8 86 33 80 00 00 	movabs $0x803386,%rax
+  805226:	00 00 00 
+  805229:	ff d0                	call   *%rax
+  80522b:	89 c2                	mov    %eax,%edx
+  80522d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805234:	85 d2                	test   %edx,%edx
+  805236:	0f 88 8e 00 00 00    	js     8052ca <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  80523c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805240:	48 b8 58 33 80 00 00 	movabs $0x803358,%rax
+  805247:	00 00 00 
+  80524a:	ff d0                	call   *%rax
+  80524c:	89 c6                	mov    %eax,%esi
+  80524e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805251:	48 b8 a6 35 80 00 00 	movabs $0x8035a6,%rax
+  805258:	00 00 00 
+  80525b:	ff d0                	call   *%rax
+  80525d:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805260:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805267:	45 85 ff             	test   %r15d,%r15d
+  80526a:	78 5e                	js     8052ca <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80526c:	49 c1 e4 05          	shl    $0x5,%r12
+  805270:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805277:	00 00 00 
+  80527a:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  80527d:	48 bf 78 4d 80 00 00 	movabs $0x804d78,%rdi
+  805284:	00 00 00 
+  805287:	48 b8 a3 57 80 00 00 	movabs $0x8057a3,%rax
+  80528e:	00 00 00 
+  805291:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805293:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805297:	49 89 04 24          	mov    %rax,(%r12)
+  80529b:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80529f:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8052a4:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8052a9:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8052ae:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8052b3:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8052b8:	eb 10                	jmp    8052ca <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8052ba:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8052c1:	eb 07                	jmp    8052ca <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8052c3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8052ca:	48 83 c4 38          	add    $0x38,%rsp
+  8052ce:	5b                   	pop    %rbx
+  8052cf:	41 5c                	pop    %r12
+  8052d1:	41 5d                	pop    %r13
+  8052d3:	41 5e                	pop    %r14
+  8052d5:	41 5f                	pop    %r15
+  8052d7:	5d                   	pop    %rbp
+  8052d8:	c3                   	ret
+
+00000000008052d9 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8052d9:	55                   	push   %rbp
+  8052da:	48 89 e5             	mov    %rsp,%rbp
+  8052dd:	41 57                	push   %r15
+  8052df:	41 56                	push   %r14
+  8052e1:	41 55                	push   %r13
+  8052e3:	41 54                	push   %r12
+  8052e5:	53                   	push   %rbx
+  8052e6:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8052ea:	49 89 fe             	mov    %rdi,%r14
+  8052ed:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8052f4:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8052fb:	00 
+  8052fc:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805303:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80530a:	00 00 00 
+  80530d:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805314:	49 bf 60 4f 80 00 00 	movabs $0x804f60,%r15
+  80531b:	00 00 00 
+  80531e:	eb 09                	jmp    805329 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805320:	48 83 c3 20          	add    $0x20,%rbx
+  805324:	4c 39 eb             	cmp    %r13,%rbx
+  805327:	74 33                	je     80535c <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805329:	48 89 df             	mov    %rbx,%rdi
+  80532c:	48 8b 33             	mov    (%rbx),%rsi
+  80532f:	4c 39 e6             	cmp    %r12,%rsi
+  805332:	73 ec                	jae    805320 <msync+0x47>
+  805334:	48 85 f6             	test   %rsi,%rsi
+  805337:	74 e7                	je     805320 <msync+0x47>
+  805339:	48 89 f2             	mov    %rsi,%rdx
+  80533c:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805340:	49 39 d6             	cmp    %rdx,%r14
+  805343:	73 db                	jae    805320 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805345:	4c 39 e2             	cmp    %r12,%rdx
+  805348:	49 0f 47 d4          	cmova  %r12,%rdx
+  80534c:	4c 39 f6             	cmp    %r14,%rsi
+  80534f:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805353:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805356:	85 c0                	test   %eax,%eax
+  805358:	79 c6                	jns    805320 <msync+0x47>
+  80535a:	eb 05                	jmp    805361 <msync+0x88>
+    }
+
+    return 0;
+  80535c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805361:	48 83 c4 08          	add    $0x8,%rsp
+  805365:	5b                   	pop    %rbx
+  805366:	41 5c                	pop    %r12
+  805368:	41 5d                	pop    %r13
+  80536a:	41 5e                	pop    %r14
+  80536c:	41 5f                	pop    %r15
+  80536e:	5d                   	pop    %rbp
+  80536f:	c3                   	ret
+
+0000000000805370 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805370:	55                   	push   %rbp
+  805371:	48 89 e5             	mov    %rsp,%rbp
+  805374:	41 57                	push   %r15
+  805376:	41 56                	push   %r14
+  805378:	41 55                	push   %r13
+  80537a:	41 54                	push   %r12
+  80537c:	53                   	push   %rbx
+  80537d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805381:	49 89 ff             	mov    %rdi,%r15
+  805384:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80538b:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805392:	00 
+  805393:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80539a:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8053a1:	00 00 00 
+  8053a4:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8053ab:	48 89 d8             	mov    %rbx,%rax
+  8053ae:	eb 09                	jmp    8053b9 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8053b0:	48 83 c0 20          	add    $0x20,%rax
+  8053b4:	4c 39 f0             	cmp    %r14,%rax
+  8053b7:	74 40                	je     8053f9 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8053b9:	48 8b 10             	mov    (%rax),%rdx
+  8053bc:	4c 39 e2             	cmp    %r12,%rdx
+  8053bf:	73 ef                	jae    8053b0 <munmap+0x40>
+  8053c1:	48 85 d2             	test   %rdx,%rdx
+  8053c4:	74 ea                	je     8053b0 <munmap+0x40>
+  8053c6:	48 89 d7             	mov    %rdx,%rdi
+  8053c9:	48 03 78 08          	add    0x8(%rax),%rdi
+  8053cd:	49 39 ff             	cmp    %rdi,%r15
+  8053d0:	73 de                	jae    8053b0 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8053d2:	49 39 fc             	cmp    %rdi,%r12
+  8053d5:	72 05                	jb     8053dc <munmap+0x6c>
+  8053d7:	4c 39 fa             	cmp    %r15,%rdx
+  8053da:	73 d4                	jae    8053b0 <munmap+0x40>
+  8053dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8053e1:	48 83 c4 08          	add    $0x8,%rsp
+  8053e5:	5b                   	pop    %rbx
+  8053e6:	41 5c                	pop    %r12
+  8053e8:	41 5d                	pop    %r13
+  8053ea:	41 5e                	pop    %r14
+  8053ec:	41 5f                	pop    %r15
+  8053ee:	5d                   	pop    %rbp
+  8053ef:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8053f0:	48 83 c3 20          	add    $0x20,%rbx
+  8053f4:	4c 39 f3             	cmp    %r14,%rbx
+  8053f7:	74 5c                	je     805455 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8053f9:	48 8b 33             	mov    (%rbx),%rsi
+  8053fc:	4c 39 e6             	cmp    %r12,%rsi
+  8053ff:	73 ef                	jae    8053f0 <munmap+0x80>
+  805401:	48 85 f6             	test   %rsi,%rsi
+  805404:	74 ea                	je     8053f0 <munmap+0x80>
+  805406:	48 89 f2             	mov    %rsi,%rdx
+  805409:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80540d:	49 39 d7             	cmp    %rdx,%r15
+  805410:	73 de                	jae    8053f0 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805412:	48 89 df             	mov    %rbx,%rdi
+  805415:	48 b8 60 4f 80 00 00 	movabs $0x804f60,%rax
+  80541c:	00 00 00 
+  80541f:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805421:	85 c0                	test   %eax,%eax
+  805423:	78 bc                	js     8053e1 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805425:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805429:	48 8b 33             	mov    (%rbx),%rsi
+  80542c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805431:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  805438:	00 00 00 
+  80543b:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80543d:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805440:	48 b8 4b 35 80 00 00 	movabs $0x80354b,%rax
+  805447:	00 00 00 
+  80544a:	ff d0                	call   *%rax
+        reg->start = 0;
+  80544c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805453:	eb 9b                	jmp    8053f0 <munmap+0x80>
+    return 0;
+  805455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80545a:	eb 85                	jmp    8053e1 <munmap+0x71>
+
+000000000080545c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80545c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805461:	c3                   	ret
+
+0000000000805462 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805462:	55                   	push   %rbp
+  805463:	48 89 e5             	mov    %rsp,%rbp
+  805466:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805469:	48 be 7b 6a 80 00 00 	movabs $0x806a7b,%rsi
+  805470:	00 00 00 
+  805473:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  80547a:	00 00 00 
+  80547d:	ff d0                	call   *%rax
+    return 0;
+}
+  80547f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805484:	5d                   	pop    %rbp
+  805485:	c3                   	ret
+
+0000000000805486 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805486:	55                   	push   %rbp
+  805487:	48 89 e5             	mov    %rsp,%rbp
+  80548a:	41 57                	push   %r15
+  80548c:	41 56                	push   %r14
+  80548e:	41 55                	push   %r13
+  805490:	41 54                	push   %r12
+  805492:	53                   	push   %rbx
+  805493:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80549a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8054a1:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8054a8:	00 00 00 00 
+  8054ac:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8054b3:	00 00 00 00 
+  8054b7:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8054be:	00 00 00 00 
+  8054c2:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8054c9:	00 00 00 00 
+  8054cd:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8054d4:	00 00 00 00 
+  8054d8:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8054df:	00 00 00 00 
+  8054e3:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8054ea:	00 
+  8054eb:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8054f2:	00 
+  8054f3:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8054fa:	00 
+  8054fb:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805502:	00 
+  805503:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80550a:	00 
+  80550b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805512:	00 
+  805513:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80551a:	00 
+  80551b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805522:	00 
+  805523:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80552a:	00 
+  80552b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805532:	00 
+    for (res = 0; res < n; res += inc) {
+  805533:	48 85 d2             	test   %rdx,%rdx
+  805536:	74 7a                	je     8055b2 <devcons_write+0x12c>
+  805538:	49 89 d6             	mov    %rdx,%r14
+  80553b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805541:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805546:	49 bf 33 27 80 00 00 	movabs $0x802733,%r15
+  80554d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805550:	4c 89 f3             	mov    %r14,%rbx
+  805553:	48 29 f3             	sub    %rsi,%rbx
+  805556:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80555b:	48 39 c3             	cmp    %rax,%rbx
+  80555e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805562:	4c 63 eb             	movslq %ebx,%r13
+  805565:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80556c:	48 01 c6             	add    %rax,%rsi
+  80556f:	4c 89 ea             	mov    %r13,%rdx
+  805572:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805579:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80557c:	4c 89 ee             	mov    %r13,%rsi
+  80557f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805586:	48 b8 60 29 80 00 00 	movabs $0x802960,%rax
+  80558d:	00 00 00 
+  805590:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805592:	41 01 dc             	add    %ebx,%r12d
+  805595:	49 63 f4             	movslq %r12d,%rsi
+  805598:	4c 39 f6             	cmp    %r14,%rsi
+  80559b:	72 b3                	jb     805550 <devcons_write+0xca>
+    return res;
+  80559d:	49 63 c4             	movslq %r12d,%rax
+}
+  8055a0:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8055a7:	5b                   	pop    %rbx
+  8055a8:	41 5c                	pop    %r12
+  8055aa:	41 5d                	pop    %r13
+  8055ac:	41 5e                	pop    %r14
+  8055ae:	41 5f                	pop    %r15
+  8055b0:	5d                   	pop    %rbp
+  8055b1:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8055b2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8055b8:	eb e3                	jmp    80559d <devcons_write+0x117>
+
+00000000008055ba <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8055ba:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8055bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055c2:	48 85 c0             	test   %rax,%rax
+  8055c5:	74 55                	je     80561c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8055c7:	55                   	push   %rbp
+  8055c8:	48 89 e5             	mov    %rsp,%rbp
+  8055cb:	41 55                	push   %r13
+  8055cd:	41 54                	push   %r12
+  8055cf:	53                   	push   %rbx
+  8055d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8055d4:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8055d7:	48 bb 93 29 80 00 00 	movabs $0x802993,%rbx
+  8055de:	00 00 00 
+  8055e1:	49 bc a7 2a 80 00 00 	movabs $0x802aa7,%r12
+  8055e8:	00 00 00 
+  8055eb:	eb 03                	jmp    8055f0 <devcons_read+0x36>
+  8055ed:	41 ff d4             	call   *%r12
+  8055f0:	ff d3                	call   *%rbx
+  8055f2:	85 c0                	test   %eax,%eax
+  8055f4:	74 f7                	je     8055ed <devcons_read+0x33>
+    if (c < 0) return c;
+  8055f6:	48 63 d0             	movslq %eax,%rdx
+  8055f9:	78 13                	js     80560e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8055fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  805600:	83 f8 04             	cmp    $0x4,%eax
+  805603:	74 09                	je     80560e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805605:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805609:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80560e:	48 89 d0             	mov    %rdx,%rax
+  805611:	48 83 c4 08          	add    $0x8,%rsp
+  805615:	5b                   	pop    %rbx
+  805616:	41 5c                	pop    %r12
+  805618:	41 5d                	pop    %r13
+  80561a:	5d                   	pop    %rbp
+  80561b:	c3                   	ret
+  80561c:	48 89 d0             	mov    %rdx,%rax
+  80561f:	c3                   	ret
+
+0000000000805620 <cputchar>:
+cputchar(int ch) {
+  805620:	55                   	push   %rbp
+  805621:	48 89 e5             	mov    %rsp,%rbp
+  805624:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805628:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80562c:	be 01 00 00 00       	mov    $0x1,%esi
+  805631:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805635:	48 b8 60 29 80 00 00 	movabs $0x802960,%rax
+  80563c:	00 00 00 
+  80563f:	ff d0                	call   *%rax
+}
+  805641:	c9                   	leave
+  805642:	c3                   	ret
+
+0000000000805643 <getchar>:
+getchar(void) {
+  805643:	55                   	push   %rbp
+  805644:	48 89 e5             	mov    %rsp,%rbp
+  805647:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80564b:	ba 01 00 00 00       	mov    $0x1,%edx
+  805650:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805654:	bf 00 00 00 00       	mov    $0x0,%edi
+  805659:	48 b8 c9 36 80 00 00 	movabs $0x8036c9,%rax
+  805660:	00 00 00 
+  805663:	ff d0                	call   *%rax
+  805665:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805667:	85 c0                	test   %eax,%eax
+  805669:	78 06                	js     805671 <getchar+0x2e>
+  80566b:	74 08                	je     805675 <getchar+0x32>
+  80566d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805671:	89 d0                	mov    %edx,%eax
+  805673:	c9                   	leave
+  805674:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805675:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80567a:	eb f5                	jmp    805671 <getchar+0x2e>
+
+000000000080567c <iscons>:
+iscons(int fdnum) {
+  80567c:	55                   	push   %rbp
+  80567d:	48 89 e5             	mov    %rsp,%rbp
+  805680:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805684:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805688:	48 b8 e6 33 80 00 00 	movabs $0x8033e6,%rax
+  80568f:	00 00 00 
+  805692:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805694:	85 c0                	test   %eax,%eax
+  805696:	78 18                	js     8056b0 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805698:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80569c:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8056a3:	00 00 00 
+  8056a6:	8b 00                	mov    (%rax),%eax
+  8056a8:	39 02                	cmp    %eax,(%rdx)
+  8056aa:	0f 94 c0             	sete   %al
+  8056ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8056b0:	c9                   	leave
+  8056b1:	c3                   	ret
+
+00000000008056b2 <opencons>:
+opencons(void) {
+  8056b2:	55                   	push   %rbp
+  8056b3:	48 89 e5             	mov    %rsp,%rbp
+  8056b6:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8056ba:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8056be:	48 b8 86 33 80 00 00 	movabs $0x803386,%rax
+  8056c5:	00 00 00 
+  8056c8:	ff d0                	call   *%rax
+  8056ca:	85 c0                	test   %eax,%eax
+  8056cc:	78 49                	js     805717 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8056ce:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8056d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8056d8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8056dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056e1:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  8056e8:	00 00 00 
+  8056eb:	ff d0                	call   *%rax
+  8056ed:	85 c0                	test   %eax,%eax
+  8056ef:	78 26                	js     805717 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8056f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8056f5:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8056fc:	00 00 
+  8056fe:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805700:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805704:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80570b:	48 b8 58 33 80 00 00 	movabs $0x803358,%rax
+  805712:	00 00 00 
+  805715:	ff d0                	call   *%rax
+}
+  805717:	c9                   	leave
+  805718:	c3                   	ret
+
+0000000000805719 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805719:	55                   	push   %rbp
+  80571a:	48 89 e5             	mov    %rsp,%rbp
+  80571d:	41 56                	push   %r14
+  80571f:	41 55                	push   %r13
+  805721:	41 54                	push   %r12
+  805723:	53                   	push   %rbx
+  805724:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805727:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80572e:	00 00 00 
+  805731:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805735:	74 27                	je     80575e <_handle_vectored_pagefault+0x45>
+  805737:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80573c:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805743:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805746:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805749:	4c 89 e7             	mov    %r12,%rdi
+  80574c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805751:	84 c0                	test   %al,%al
+  805753:	75 45                	jne    80579a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805755:	48 83 c3 01          	add    $0x1,%rbx
+  805759:	49 3b 1e             	cmp    (%r14),%rbx
+  80575c:	72 eb                	jb     805749 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80575e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805765:	00 
+  805766:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80576b:	4d 8b 04 24          	mov    (%r12),%r8
+  80576f:	48 ba 88 6a 80 00 00 	movabs $0x806a88,%rdx
+  805776:	00 00 00 
+  805779:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80577e:	48 bf b8 6a 80 00 00 	movabs $0x806ab8,%rdi
+  805785:	00 00 00 
+  805788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80578d:	49 ba 5c 19 80 00 00 	movabs $0x80195c,%r10
+  805794:	00 00 00 
+  805797:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80579a:	5b                   	pop    %rbx
+  80579b:	41 5c                	pop    %r12
+  80579d:	41 5d                	pop    %r13
+  80579f:	41 5e                	pop    %r14
+  8057a1:	5d                   	pop    %rbp
+  8057a2:	c3                   	ret
+
+00000000008057a3 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8057a3:	55                   	push   %rbp
+  8057a4:	48 89 e5             	mov    %rsp,%rbp
+  8057a7:	53                   	push   %rbx
+  8057a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8057ac:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8057af:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8057b4:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8057bb:	00 00 00 
+  8057be:	80 38 00             	cmpb   $0x0,(%rax)
+  8057c1:	74 68                	je     80582b <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8057c3:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8057ca:	00 00 00 
+  8057cd:	48 8b 08             	mov    (%rax),%rcx
+  8057d0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8057d5:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8057dc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8057df:	48 85 c9             	test   %rcx,%rcx
+  8057e2:	0f 84 e0 00 00 00    	je     8058c8 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8057e8:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8057ec:	0f 84 c9 00 00 00    	je     8058bb <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8057f2:	48 83 c2 01          	add    $0x1,%rdx
+  8057f6:	48 39 ca             	cmp    %rcx,%rdx
+  8057f9:	75 ed                	jne    8057e8 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8057fb:	48 83 f9 08          	cmp    $0x8,%rcx
+  8057ff:	0f 84 84 00 00 00    	je     805889 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805805:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805809:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805810:	00 00 00 
+  805813:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80581a:	00 00 00 
+  80581d:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805821:	85 f6                	test   %esi,%esi
+  805823:	0f 89 97 00 00 00    	jns    8058c0 <add_pgfault_handler+0x11d>
+  805829:	eb 63                	jmp    80588e <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80582b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805830:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805835:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80583c:	00 00 00 
+  80583f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805844:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  80584b:	00 00 00 
+  80584e:	ff d0                	call   *%rax
+  805850:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805852:	85 c0                	test   %eax,%eax
+  805854:	78 38                	js     80588e <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805856:	48 be a4 59 80 00 00 	movabs $0x8059a4,%rsi
+  80585d:	00 00 00 
+  805860:	bf 00 00 00 00       	mov    $0x0,%edi
+  805865:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  80586c:	00 00 00 
+  80586f:	ff d0                	call   *%rax
+  805871:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805873:	85 c0                	test   %eax,%eax
+  805875:	78 17                	js     80588e <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805877:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80587e:	00 00 00 
+  805881:	c6 00 01             	movb   $0x1,(%rax)
+  805884:	e9 3a ff ff ff       	jmp    8057c3 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805889:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80588e:	89 f1                	mov    %esi,%ecx
+  805890:	48 ba c6 6a 80 00 00 	movabs $0x806ac6,%rdx
+  805897:	00 00 00 
+  80589a:	be 42 00 00 00       	mov    $0x42,%esi
+  80589f:	48 bf b8 6a 80 00 00 	movabs $0x806ab8,%rdi
+  8058a6:	00 00 00 
+  8058a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058ae:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  8058b5:	00 00 00 
+  8058b8:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8058bb:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8058c0:	89 f0                	mov    %esi,%eax
+  8058c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8058c6:	c9                   	leave
+  8058c7:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8058c8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8058cf:	00 00 00 
+  8058d2:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8058d9:	48 89 d8             	mov    %rbx,%rax
+  8058dc:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8058e3:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8058e6:	eb d8                	jmp    8058c0 <add_pgfault_handler+0x11d>
+
+00000000008058e8 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8058e8:	55                   	push   %rbp
+  8058e9:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8058ec:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8058f3:	00 00 00 
+  8058f6:	80 38 00             	cmpb   $0x0,(%rax)
+  8058f9:	74 33                	je     80592e <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8058fb:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805902:	00 00 00 
+  805905:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80590a:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805911:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805914:	48 85 c0             	test   %rax,%rax
+  805917:	0f 84 85 00 00 00    	je     8059a2 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80591d:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805921:	74 40                	je     805963 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805923:	48 83 c1 01          	add    $0x1,%rcx
+  805927:	48 39 c1             	cmp    %rax,%rcx
+  80592a:	75 f1                	jne    80591d <remove_pgfault_handler+0x35>
+  80592c:	eb 74                	jmp    8059a2 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80592e:	48 b9 de 6a 80 00 00 	movabs $0x806ade,%rcx
+  805935:	00 00 00 
+  805938:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  80593f:	00 00 00 
+  805942:	be 48 00 00 00       	mov    $0x48,%esi
+  805947:	48 bf b8 6a 80 00 00 	movabs $0x806ab8,%rdi
+  80594e:	00 00 00 
+  805951:	b8 00 00 00 00       	mov    $0x0,%eax
+  805956:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  80595d:	00 00 00 
+  805960:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805963:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80596a:	00 
+  80596b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80596f:	48 29 ca             	sub    %rcx,%rdx
+  805972:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805979:	00 00 00 
+  80597c:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805980:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805985:	48 89 ce             	mov    %rcx,%rsi
+  805988:	48 b8 33 27 80 00 00 	movabs $0x802733,%rax
+  80598f:	00 00 00 
+  805992:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805994:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80599b:	00 00 00 
+  80599e:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8059a2:	5d                   	pop    %rbp
+  8059a3:	c3                   	ret
+
+00000000008059a4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8059a4:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8059a7:	48 b8 19 57 80 00 00 	movabs $0x805719,%rax
+  8059ae:	00 00 00 
+    call *%rax
+  8059b1:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8059b3:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8059ba:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8059bb:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8059c2:	00 
+    subq $8, %rcx
+  8059c3:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8059c7:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8059ca:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8059d1:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8059d2:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8059d6:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8059da:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8059df:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8059e4:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8059e9:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8059ee:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8059f3:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8059f8:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8059fd:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805a02:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805a07:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805a0c:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805a11:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805a16:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805a1b:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805a20:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805a24:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805a28:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805a29:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805a2a:	c3                   	ret
+
+0000000000805a2b <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805a2b:	85 ff                	test   %edi,%edi
+  805a2d:	78 58                	js     805a87 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805a2f:	48 85 f6             	test   %rsi,%rsi
+  805a32:	74 12                	je     805a46 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805a34:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805a3b:	00 00 00 
+  805a3e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805a44:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805a46:	48 85 c9             	test   %rcx,%rcx
+  805a49:	74 12                	je     805a5d <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805a4b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805a52:	00 00 00 
+  805a55:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805a5b:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805a5d:	48 85 d2             	test   %rdx,%rdx
+  805a60:	74 14                	je     805a76 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805a62:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805a69:	00 00 00 
+  805a6c:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805a73:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805a76:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805a7d:	00 00 00 
+  805a80:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805a86:	c3                   	ret
+        if (from_env_store) {
+  805a87:	48 85 f6             	test   %rsi,%rsi
+  805a8a:	74 06                	je     805a92 <ipc_result+0x67>
+            *from_env_store = 0;
+  805a8c:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805a92:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805a94:	48 85 c9             	test   %rcx,%rcx
+  805a97:	74 ed                	je     805a86 <ipc_result+0x5b>
+            *perm_store = 0;
+  805a99:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805a9f:	c3                   	ret
+
+0000000000805aa0 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805aa0:	55                   	push   %rbp
+  805aa1:	48 89 e5             	mov    %rsp,%rbp
+  805aa4:	41 55                	push   %r13
+  805aa6:	41 54                	push   %r12
+  805aa8:	53                   	push   %rbx
+  805aa9:	48 83 ec 08          	sub    $0x8,%rsp
+  805aad:	49 89 fc             	mov    %rdi,%r12
+  805ab0:	48 89 f7             	mov    %rsi,%rdi
+  805ab3:	48 89 d3             	mov    %rdx,%rbx
+  805ab6:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805ab9:	48 85 f6             	test   %rsi,%rsi
+  805abc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805ac3:	00 00 00 
+  805ac6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805aca:	be 00 00 00 00       	mov    $0x0,%esi
+  805acf:	48 85 d2             	test   %rdx,%rdx
+  805ad2:	74 03                	je     805ad7 <ipc_recv+0x37>
+  805ad4:	48 8b 32             	mov    (%rdx),%rsi
+  805ad7:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  805ade:	00 00 00 
+  805ae1:	ff d0                	call   *%rax
+  805ae3:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805ae5:	4c 89 e9             	mov    %r13,%rcx
+  805ae8:	48 89 da             	mov    %rbx,%rdx
+  805aeb:	4c 89 e6             	mov    %r12,%rsi
+  805aee:	48 b8 2b 5a 80 00 00 	movabs $0x805a2b,%rax
+  805af5:	00 00 00 
+  805af8:	ff d0                	call   *%rax
+}
+  805afa:	48 83 c4 08          	add    $0x8,%rsp
+  805afe:	5b                   	pop    %rbx
+  805aff:	41 5c                	pop    %r12
+  805b01:	41 5d                	pop    %r13
+  805b03:	5d                   	pop    %rbp
+  805b04:	c3                   	ret
+
+0000000000805b05 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805b05:	55                   	push   %rbp
+  805b06:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805b09:	48 85 d2             	test   %rdx,%rdx
+  805b0c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b13:	00 00 00 
+  805b16:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805b1a:	89 f6                	mov    %esi,%esi
+  805b1c:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  805b23:	00 00 00 
+  805b26:	ff d0                	call   *%rax
+    if (res < 0) {
+  805b28:	85 c0                	test   %eax,%eax
+  805b2a:	78 02                	js     805b2e <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805b2c:	5d                   	pop    %rbp
+  805b2d:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805b2e:	89 c1                	mov    %eax,%ecx
+  805b30:	48 ba f8 6a 80 00 00 	movabs $0x806af8,%rdx
+  805b37:	00 00 00 
+  805b3a:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805b3f:	48 bf 05 6b 80 00 00 	movabs $0x806b05,%rdi
+  805b46:	00 00 00 
+  805b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b4e:	49 b8 5c 19 80 00 00 	movabs $0x80195c,%r8
+  805b55:	00 00 00 
+  805b58:	41 ff d0             	call   *%r8
+
+0000000000805b5b <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805b5b:	55                   	push   %rbp
+  805b5c:	48 89 e5             	mov    %rsp,%rbp
+  805b5f:	53                   	push   %rbx
+  805b60:	48 83 ec 08          	sub    $0x8,%rsp
+  805b64:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805b68:	48 85 d2             	test   %rdx,%rdx
+  805b6b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b72:	00 00 00 
+  805b75:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805b79:	4d 85 c9             	test   %r9,%r9
+  805b7c:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805b80:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b85:	48 85 db             	test   %rbx,%rbx
+  805b88:	74 03                	je     805b8d <ipc_call+0x32>
+  805b8a:	48 8b 03             	mov    (%rbx),%rax
+  805b8d:	89 f6                	mov    %esi,%esi
+  805b8f:	48 83 ec 08          	sub    $0x8,%rsp
+  805b93:	50                   	push   %rax
+  805b94:	48 b8 52 2f 80 00 00 	movabs $0x802f52,%rax
+  805b9b:	00 00 00 
+  805b9e:	ff d0                	call   *%rax
+  805ba0:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805ba2:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805ba6:	48 89 da             	mov    %rbx,%rdx
+  805ba9:	be 00 00 00 00       	mov    $0x0,%esi
+  805bae:	48 b8 2b 5a 80 00 00 	movabs $0x805a2b,%rax
+  805bb5:	00 00 00 
+  805bb8:	ff d0                	call   *%rax
+}
+  805bba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805bbe:	c9                   	leave
+  805bbf:	c3                   	ret
+
+0000000000805bc0 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805bc0:	55                   	push   %rbp
+  805bc1:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805bc4:	89 f6                	mov    %esi,%esi
+  805bc6:	48 b8 be 2f 80 00 00 	movabs $0x802fbe,%rax
+  805bcd:	00 00 00 
+  805bd0:	ff d0                	call   *%rax
+  805bd2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805bd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  805bde:	be 00 00 00 00       	mov    $0x0,%esi
+  805be3:	48 b8 2b 5a 80 00 00 	movabs $0x805a2b,%rax
+  805bea:	00 00 00 
+  805bed:	ff d0                	call   *%rax
+}
+  805bef:	5d                   	pop    %rbp
+  805bf0:	c3                   	ret
+
+0000000000805bf1 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805bf1:	55                   	push   %rbp
+  805bf2:	48 89 e5             	mov    %rsp,%rbp
+  805bf5:	41 54                	push   %r12
+  805bf7:	53                   	push   %rbx
+  805bf8:	4c 89 cb             	mov    %r9,%rbx
+  805bfb:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805bff:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805c03:	48 85 d2             	test   %rdx,%rdx
+  805c06:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805c0d:	00 00 00 
+  805c10:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805c14:	4d 85 c9             	test   %r9,%r9
+  805c17:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c20:	4d 85 e4             	test   %r12,%r12
+  805c23:	74 04                	je     805c29 <ipc_reply_wait+0x38>
+  805c25:	49 8b 04 24          	mov    (%r12),%rax
+  805c29:	89 f6                	mov    %esi,%esi
+  805c2b:	48 83 ec 08          	sub    $0x8,%rsp
+  805c2f:	50                   	push   %rax
+  805c30:	48 b8 28 30 80 00 00 	movabs $0x803028,%rax
+  805c37:	00 00 00 
+  805c3a:	ff d0                	call   *%rax
+  805c3c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805c3e:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805c42:	4c 89 e2             	mov    %r12,%rdx
+  805c45:	48 89 de             	mov    %rbx,%rsi
+  805c48:	48 b8 2b 5a 80 00 00 	movabs $0x805a2b,%rax
+  805c4f:	00 00 00 
+  805c52:	ff d0                	call   *%rax
+}
+  805c54:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805c58:	5b                   	pop    %rbx
+  805c59:	41 5c                	pop    %r12
+  805c5b:	5d                   	pop    %rbp
+  805c5c:	c3                   	ret
+
+0000000000805c5d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805c62:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805c69:	00 00 00 
+  805c6c:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805c73:	48 01 ca             	add    %rcx,%rdx
+  805c76:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805c7c:	39 fa                	cmp    %edi,%edx
+  805c7e:	74 12                	je     805c92 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805c80:	48 83 c0 01          	add    $0x1,%rax
+  805c84:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805c8a:	75 e0                	jne    805c6c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c91:	c3                   	ret
+            return envs[i].env_id;
+  805c92:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805c99:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805ca0:	00 00 00 
+  805ca3:	48 01 d0             	add    %rdx,%rax
+  805ca6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805cac:	c3                   	ret
+  805cad:	0f 1f 00             	nopl   (%rax)
+
+0000000000805cb0 <__rodata_start>:
+  805cb0:	77 00                	ja     805cb2 <__rodata_start+0x2>
+  805cb2:	72 62                	jb     805d16 <__rodata_start+0x66>
+  805cb4:	00 77 62             	add    %dh,0x62(%rdi)
+  805cb7:	00 0f                	add    %cl,(%rdi)
+  805cb9:	1f                   	(bad)
+  805cba:	84 00                	test   %al,(%rax)
+  805cbc:	00 00                	add    %al,(%rax)
+  805cbe:	00 00                	add    %al,(%rax)
+  805cc0:	b3 09                	mov    $0x9,%bl
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 ed                	add    %ch,%ch
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	ed                   	in     (%dx),%eax
+  805cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	ed                   	in     (%dx),%eax
+  805cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cde:	00 00                	add    %al,(%rax)
+  805ce0:	ed                   	in     (%dx),%eax
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 ed                	add    %ch,%ch
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	8c 0a                	mov    %cs,(%rdx)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	8c 0a                	mov    %cs,(%rdx)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	8c 0a                	mov    %cs,(%rdx)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	8c 0a                	mov    %cs,(%rdx)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	8c 0a                	mov    %cs,(%rdx)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	ed                   	in     (%dx),%eax
+  805d71:	0d 80 00 00 00       	or     $0x80,%eax
+  805d76:	00 00                	add    %al,(%rax)
+  805d78:	ed                   	in     (%dx),%eax
+  805d79:	0d 80 00 00 00       	or     $0x80,%eax
+  805d7e:	00 00                	add    %al,(%rax)
+  805d80:	ed                   	in     (%dx),%eax
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	ed                   	in     (%dx),%eax
+  805d91:	0d 80 00 00 00       	or     $0x80,%eax
+  805d96:	00 00                	add    %al,(%rax)
+  805d98:	ed                   	in     (%dx),%eax
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ed                   	in     (%dx),%eax
+  805da1:	0d 80 00 00 00       	or     $0x80,%eax
+  805da6:	00 00                	add    %al,(%rax)
+  805da8:	ed                   	in     (%dx),%eax
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	ed                   	in     (%dx),%eax
+  805db9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dbe:	00 00                	add    %al,(%rax)
+  805dc0:	ed                   	in     (%dx),%eax
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	ed                   	in     (%dx),%eax
+  805dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dce:	00 00                	add    %al,(%rax)
+  805dd0:	ed                   	in     (%dx),%eax
+  805dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dd6:	00 00                	add    %al,(%rax)
+  805dd8:	ed                   	in     (%dx),%eax
+  805dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dde:	00 00                	add    %al,(%rax)
+  805de0:	ed                   	in     (%dx),%eax
+  805de1:	0d 80 00 00 00       	or     $0x80,%eax
+  805de6:	00 00                	add    %al,(%rax)
+  805de8:	ed                   	in     (%dx),%eax
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	ed                   	in     (%dx),%eax
+  805df1:	0d 80 00 00 00       	or     $0x80,%eax
+  805df6:	00 00                	add    %al,(%rax)
+  805df8:	ed                   	in     (%dx),%eax
+  805df9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dfe:	00 00                	add    %al,(%rax)
+  805e00:	ed                   	in     (%dx),%eax
+  805e01:	0d 80 00 00 00       	or     $0x80,%eax
+  805e06:	00 00                	add    %al,(%rax)
+  805e08:	ed                   	in     (%dx),%eax
+  805e09:	0d 80 00 00 00       	or     $0x80,%eax
+  805e0e:	00 00                	add    %al,(%rax)
+  805e10:	ed                   	in     (%dx),%eax
+  805e11:	0d 80 00 00 00       	or     $0x80,%eax
+  805e16:	00 00                	add    %al,(%rax)
+  805e18:	ed                   	in     (%dx),%eax
+  805e19:	0d 80 00 00 00       	or     $0x80,%eax
+  805e1e:	00 00                	add    %al,(%rax)
+  805e20:	ed                   	in     (%dx),%eax
+  805e21:	0d 80 00 00 00       	or     $0x80,%eax
+  805e26:	00 00                	add    %al,(%rax)
+  805e28:	ed                   	in     (%dx),%eax
+  805e29:	0d 80 00 00 00       	or     $0x80,%eax
+  805e2e:	00 00                	add    %al,(%rax)
+  805e30:	ed                   	in     (%dx),%eax
+  805e31:	0d 80 00 00 00       	or     $0x80,%eax
+  805e36:	00 00                	add    %al,(%rax)
+  805e38:	ed                   	in     (%dx),%eax
+  805e39:	0d 80 00 00 00       	or     $0x80,%eax
+  805e3e:	00 00                	add    %al,(%rax)
+  805e40:	ed                   	in     (%dx),%eax
+  805e41:	0d 80 00 00 00       	or     $0x80,%eax
+  805e46:	00 00                	add    %al,(%rax)
+  805e48:	ed                   	in     (%dx),%eax
+  805e49:	0d 80 00 00 00       	or     $0x80,%eax
+  805e4e:	00 00                	add    %al,(%rax)
+  805e50:	ed                   	in     (%dx),%eax
+  805e51:	0d 80 00 00 00       	or     $0x80,%eax
+  805e56:	00 00                	add    %al,(%rax)
+  805e58:	f4                   	hlt
+  805e59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e5f:	00 ed                	add    %ch,%ch
+  805e61:	0d 80 00 00 00       	or     $0x80,%eax
+  805e66:	00 00                	add    %al,(%rax)
+  805e68:	ed                   	in     (%dx),%eax
+  805e69:	0d 80 00 00 00       	or     $0x80,%eax
+  805e6e:	00 00                	add    %al,(%rax)
+  805e70:	2c 0b                	sub    $0xb,%al
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 ed                	add    %ch,%ch
+  805e79:	0d 80 00 00 00       	or     $0x80,%eax
+  805e7e:	00 00                	add    %al,(%rax)
+  805e80:	ed                   	in     (%dx),%eax
+  805e81:	0d 80 00 00 00       	or     $0x80,%eax
+  805e86:	00 00                	add    %al,(%rax)
+  805e88:	ed                   	in     (%dx),%eax
+  805e89:	0d 80 00 00 00       	or     $0x80,%eax
+  805e8e:	00 00                	add    %al,(%rax)
+  805e90:	ed                   	in     (%dx),%eax
+  805e91:	0d 80 00 00 00       	or     $0x80,%eax
+  805e96:	00 00                	add    %al,(%rax)
+  805e98:	ed                   	in     (%dx),%eax
+  805e99:	0d 80 00 00 00       	or     $0x80,%eax
+  805e9e:	00 00                	add    %al,(%rax)
+  805ea0:	ed                   	in     (%dx),%eax
+  805ea1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ea6:	00 00                	add    %al,(%rax)
+  805ea8:	ed                   	in     (%dx),%eax
+  805ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eae:	00 00                	add    %al,(%rax)
+  805eb0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805eb3:	00 00                	add    %al,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 cb                	add    %cl,%bl
+  805eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ebe:	00 00                	add    %al,(%rax)
+  805ec0:	ed                   	in     (%dx),%eax
+  805ec1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ec6:	00 00                	add    %al,(%rax)
+  805ec8:	ed                   	in     (%dx),%eax
+  805ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ece:	00 00                	add    %al,(%rax)
+  805ed0:	ed                   	in     (%dx),%eax
+  805ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ed6:	00 00                	add    %al,(%rax)
+  805ed8:	6a 0a                	push   $0xa
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 ed                	add    %ch,%ch
+  805ee9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eee:	00 00                	add    %al,(%rax)
+  805ef0:	ed                   	in     (%dx),%eax
+  805ef1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ef6:	00 00                	add    %al,(%rax)
+  805ef8:	3c 0a                	cmp    $0xa,%al
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 ed                	add    %ch,%ch
+  805f01:	0d 80 00 00 00       	or     $0x80,%eax
+  805f06:	00 00                	add    %al,(%rax)
+  805f08:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805f0b:	00 00                	add    %al,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805f15:	00 00                	add    %al,(%rax)
+  805f17:	00 29                	add    %ch,(%rcx)
+  805f19:	0c 80                	or     $0x80,%al
+  805f1b:	00 00                	add    %al,(%rax)
+  805f1d:	00 00                	add    %al,(%rax)
+  805f1f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 ed                	add    %ch,%ch
+  805f29:	0d 80 00 00 00       	or     $0x80,%eax
+  805f2e:	00 00                	add    %al,(%rax)
+  805f30:	1a 0b                	sbb    (%rbx),%cl
+  805f32:	80 00 00             	addb   $0x0,(%rax)
+  805f35:	00 00                	add    %al,(%rax)
+  805f37:	00 ed                	add    %ch,%ch
+  805f39:	0d 80 00 00 00       	or     $0x80,%eax
+  805f3e:	00 00                	add    %al,(%rax)
+  805f40:	ce                   	(bad)
+  805f41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805f47:	00 ed                	add    %ch,%ch
+  805f49:	0d 80 00 00 00       	or     $0x80,%eax
+  805f4e:	00 00                	add    %al,(%rax)
+  805f50:	ed                   	in     (%dx),%eax
+  805f51:	0d 80 00 00 00       	or     $0x80,%eax
+  805f56:	00 00                	add    %al,(%rax)
+  805f58:	f4                   	hlt
+  805f59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805f5f:	00 37                	add    %dh,(%rdi)
+  805f61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 37                	add    %dh,(%rdi)
+  805f71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805f8b:	00 00                	add    %al,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 d2                	add    %dl,%dl
+  805f91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f97:	00 d2                	add    %dl,%dl
+  805f99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f9f:	00 d2                	add    %dl,%dl
+  805fa1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fa7:	00 d2                	add    %dl,%dl
+  805fa9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805faf:	00 d2                	add    %dl,%dl
+  805fb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fb7:	00 d2                	add    %dl,%dl
+  805fb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fbf:	00 d2                	add    %dl,%dl
+  805fc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fc7:	00 f6                	add    %dh,%dh
+  805fc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fcf:	00 f6                	add    %dh,%dh
+  805fd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ffa:	80 00 00             	addb   $0x0,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 22                	add    %ah,(%rdx)
+  806011:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806017:	00 22                	add    %ah,(%rdx)
+  806019:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80601f:	00 22                	add    %ah,(%rdx)
+  806021:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806027:	00 22                	add    %ah,(%rdx)
+  806029:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80602f:	00 22                	add    %ah,(%rdx)
+  806031:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806037:	00 22                	add    %ah,(%rdx)
+  806039:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80603f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806042:	80 00 00             	addb   $0x0,(%rax)
+  806045:	00 00                	add    %al,(%rax)
+  806047:	00 5f 12             	add    %bl,0x12(%rdi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806052:	80 00 00             	addb   $0x0,(%rax)
+  806055:	00 00                	add    %al,(%rax)
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 5f 12             	add    %bl,0x12(%rdi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806092:	80 00 00             	addb   $0x0,(%rax)
+  806095:	00 00                	add    %al,(%rax)
+  806097:	00 5f 12             	add    %bl,0x12(%rdi)
+  80609a:	80 00 00             	addb   $0x0,(%rax)
+  80609d:	00 00                	add    %al,(%rax)
+  80609f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060a2:	80 00 00             	addb   $0x0,(%rax)
+  8060a5:	00 00                	add    %al,(%rax)
+  8060a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060aa:	80 00 00             	addb   $0x0,(%rax)
+  8060ad:	00 00                	add    %al,(%rax)
+  8060af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060b2:	80 00 00             	addb   $0x0,(%rax)
+  8060b5:	00 00                	add    %al,(%rax)
+  8060b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ba:	80 00 00             	addb   $0x0,(%rax)
+  8060bd:	00 00                	add    %al,(%rax)
+  8060bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060c2:	80 00 00             	addb   $0x0,(%rax)
+  8060c5:	00 00                	add    %al,(%rax)
+  8060c7:	00 46 12             	add    %al,0x12(%rsi)
+  8060ca:	80 00 00             	addb   $0x0,(%rax)
+  8060cd:	00 00                	add    %al,(%rax)
+  8060cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060d2:	80 00 00             	addb   $0x0,(%rax)
+  8060d5:	00 00                	add    %al,(%rax)
+  8060d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060da:	80 00 00             	addb   $0x0,(%rax)
+  8060dd:	00 00                	add    %al,(%rax)
+  8060df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060e2:	80 00 00             	addb   $0x0,(%rax)
+  8060e5:	00 00                	add    %al,(%rax)
+  8060e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ea:	80 00 00             	addb   $0x0,(%rax)
+  8060ed:	00 00                	add    %al,(%rax)
+  8060ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060f2:	80 00 00             	addb   $0x0,(%rax)
+  8060f5:	00 00                	add    %al,(%rax)
+  8060f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060fa:	80 00 00             	addb   $0x0,(%rax)
+  8060fd:	00 00                	add    %al,(%rax)
+  8060ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806102:	80 00 00             	addb   $0x0,(%rax)
+  806105:	00 00                	add    %al,(%rax)
+  806107:	00 5f 12             	add    %bl,0x12(%rdi)
+  80610a:	80 00 00             	addb   $0x0,(%rax)
+  80610d:	00 00                	add    %al,(%rax)
+  80610f:	00 22                	add    %ah,(%rdx)
+  806111:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806117:	00 22                	add    %ah,(%rdx)
+  806119:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80611f:	00 22                	add    %ah,(%rdx)
+  806121:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806127:	00 22                	add    %ah,(%rdx)
+  806129:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80612f:	00 22                	add    %ah,(%rdx)
+  806131:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806137:	00 22                	add    %ah,(%rdx)
+  806139:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80613f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806142:	80 00 00             	addb   $0x0,(%rax)
+  806145:	00 00                	add    %al,(%rax)
+  806147:	00 5f 12             	add    %bl,0x12(%rdi)
+  80614a:	80 00 00             	addb   $0x0,(%rax)
+  80614d:	00 00                	add    %al,(%rax)
+  80614f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806152:	80 00 00             	addb   $0x0,(%rax)
+  806155:	00 00                	add    %al,(%rax)
+  806157:	00 5f 12             	add    %bl,0x12(%rdi)
+  80615a:	80 00 00             	addb   $0x0,(%rax)
+  80615d:	00 00                	add    %al,(%rax)
+  80615f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806162:	80 00 00             	addb   $0x0,(%rax)
+  806165:	00 00                	add    %al,(%rax)
+  806167:	00 5f 12             	add    %bl,0x12(%rdi)
+  80616a:	80 00 00             	addb   $0x0,(%rax)
+  80616d:	00 00                	add    %al,(%rax)
+  80616f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806172:	80 00 00             	addb   $0x0,(%rax)
+  806175:	00 00                	add    %al,(%rax)
+  806177:	00 5f 12             	add    %bl,0x12(%rdi)
+  80617a:	80 00 00             	addb   $0x0,(%rax)
+  80617d:	00 00                	add    %al,(%rax)
+  80617f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806182:	80 00 00             	addb   $0x0,(%rax)
+  806185:	00 00                	add    %al,(%rax)
+  806187:	00 5f 12             	add    %bl,0x12(%rdi)
+  80618a:	80 00 00             	addb   $0x0,(%rax)
+  80618d:	00 00                	add    %al,(%rax)
+  80618f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806192:	80 00 00             	addb   $0x0,(%rax)
+  806195:	00 00                	add    %al,(%rax)
+  806197:	00 5f 12             	add    %bl,0x12(%rdi)
+  80619a:	80 00 00             	addb   $0x0,(%rax)
+  80619d:	00 00                	add    %al,(%rax)
+  80619f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061a2:	80 00 00             	addb   $0x0,(%rax)
+  8061a5:	00 00                	add    %al,(%rax)
+  8061a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061aa:	80 00 00             	addb   $0x0,(%rax)
+  8061ad:	00 00                	add    %al,(%rax)
+  8061af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061b2:	80 00 00             	addb   $0x0,(%rax)
+  8061b5:	00 00                	add    %al,(%rax)
+  8061b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061ba:	80 00 00             	addb   $0x0,(%rax)
+  8061bd:	00 00                	add    %al,(%rax)
+  8061bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061c2:	80 00 00             	addb   $0x0,(%rax)
+  8061c5:	00 00                	add    %al,(%rax)
+  8061c7:	00 46 12             	add    %al,0x12(%rsi)
+  8061ca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+00000000008061e0 <basefix.0>:
+  8061e0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  8061f0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806200:	10 00 25 73 3a 20 25 6c 6c 75 25 25 0a 00 25 73     ..%s: %llu%%..%s
+  806210:	20 69 73 20 6f 75 74 20 6f 66 20 5b 25 6c 6c 75      is out of [%llu
+  806220:	25 25 2c 20 25 6c 6c 75 25 25 5d 00 75 73 65 72     %%, %llu%%].user
+  806230:	2f 66 61 69 72 73 68 61 72 65 2e 63 00 73 79 73     /fairshare.c.sys
+  806240:	5f 61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 3a 20 25     _alloc_region: %
+  806250:	69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 6e 69     i.sys_env_set_ni
+  806260:	63 65 3a 20 25 69 00 6e 69 63 65 20 30 20 2f 20     ce: %i.nice 0 / 
+  806270:	6e 69 63 65 20 30 00 6e 69 63 65 20 30 20 2f 20     nice 0.nice 0 / 
+  806280:	6e 69 63 65 20 35 00 66 61 69 72 73 68 61 72 65     nice 5.fairshare
+  806290:	3a 20 4f 4b 0a 00 66 90 73 79 73 5f 65 6e 76 5f     : OK..f.sys_env_
+  8062a0:	73 65 74 5f 6e 69 63 65 20 61 63 63 65 70 74 65     set_nice accepte
+  8062b0:	64 20 69 6e 76 61 6c 69 64 20 6c 65 76 65 6c 00     d invalid level.
+  8062c0:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 6e 69 63 65     sys_env_set_nice
+  8062d0:	20 61 6c 6c 6f 77 65 64 20 6c 6f 77 65 72 69 6e      allowed lowerin
+  8062e0:	67 20 6e 69 63 65 20 6c 65 76 65 6c 00 0f 1f 00     g nice level....
+
+00000000008062f0 <nice>:
+	...
+  8062f8:	05 00 00 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 66 90     ....<unknown>.f.
+  806308:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806318:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806328:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806338:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806348:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806358:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806368:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806378:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806388:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806398:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8063a8:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8063b8:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8063c8:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8063d8:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8063e8:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8063f8:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806408:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806418:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806428:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806438:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806448:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806458:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806468:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806478:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806488:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806498:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8064a8:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8064b8:	64 00 66 0f 1f 44 00 00 a4 1c 80 00 00 00 00 00     d.f..D..........
+  8064c8:	fb 22 80 00 00 00 00 00 eb 22 80 00 00 00 00 00     ."......."......
+  8064d8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8064e8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8064f8:	c3 1c 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ........."......
+  806508:	fb 22 80 00 00 00 00 00 b7 1c 80 00 00 00 00 00     ."..............
+  806518:	31 1d 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     1........"......
+  806528:	b7 1c 80 00 00 00 00 00 fd 1c 80 00 00 00 00 00     ................
+  806538:	fd 1c 80 00 00 00 00 00 fd 1c 80 00 00 00 00 00     ................
+  806548:	fd 1c 80 00 00 00 00 00 fd 1c 80 00 00 00 00 00     ................
+  806558:	fd 1c 80 00 00 00 00 00 fd 1c 80 00 00 00 00 00     ................
+  806568:	fd 1c 80 00 00 00 00 00 fd 1c 80 00 00 00 00 00     ................
+  806578:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806588:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806598:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8065a8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8065b8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8065c8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8065d8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8065e8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8065f8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806608:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806618:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806628:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806638:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806648:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806658:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806668:	19 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806678:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806688:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806698:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8066a8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8066b8:	fb 22 80 00 00 00 00 00 5f 1d 80 00 00 00 00 00     ."......_.......
+  8066c8:	2e 1f 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ........."......
+  8066d8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  8066e8:	54 1d 80 00 00 00 00 00 8e 1d 80 00 00 00 00 00     T...............
+  8066f8:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806708:	49 1d 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     I........"......
+  806718:	fb 22 80 00 00 00 00 00 d7 20 80 00 00 00 00 00     ."....... ......
+  806728:	a6 21 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     .!......."......
+  806738:	fb 22 80 00 00 00 00 00 25 1e 80 00 00 00 00 00     ."......%.......
+  806748:	fb 22 80 00 00 00 00 00 02 20 80 00 00 00 00 00     ."....... ......
+  806758:	fb 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806768:	19 22 80 00 00 00 00 00 fb 22 80 00 00 00 00 00     ."......."......
+  806778:	ad 1c 80 00 00 00 00 00                             ........
+
+0000000000806780 <error_string>:
+	...
+  806788:	5d 63 80 00 00 00 00 00 6f 63 80 00 00 00 00 00     ]c......oc......
+  806798:	7f 63 80 00 00 00 00 00 91 63 80 00 00 00 00 00     .c.......c......
+  8067a8:	9f 63 80 00 00 00 00 00 b3 63 80 00 00 00 00 00     .c.......c......
+  8067b8:	c8 63 80 00 00 00 00 00 db 63 80 00 00 00 00 00     .c.......c......
+  8067c8:	ed 63 80 00 00 00 00 00 01 64 80 00 00 00 00 00     .c.......d......
+  8067d8:	11 64 80 00 00 00 00 00 24 64 80 00 00 00 00 00     .d......$d......
+  8067e8:	3b 64 80 00 00 00 00 00 51 64 80 00 00 00 00 00     ;d......Qd......
+  8067f8:	69 64 80 00 00 00 00 00 81 64 80 00 00 00 00 00     id.......d......
+  806808:	8e 64 80 00 00 00 00 00 20 68 80 00 00 00 00 00     .d...... h......
+  806818:	a2 64 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .d......file is 
+  806828:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806838:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806848:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806858:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806868:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806878:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806888:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806898:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8068a8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8068b8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8068c8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8068d8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  8068e8:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  8068f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806908:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806918:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806928:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806938:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806948:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806958:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806968:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806978:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806980 <devtab>:
+  806980:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806990:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8069a0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8069b0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8069c0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8069d0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8069e0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8069f0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806a00:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806a10:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806a20:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806a30:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806a40:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  806a50:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  806a60:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  806a70:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  806a80:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  806a90:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806aa0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806ab0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806ac0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806ad0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806ae0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806af0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806b00:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,10384 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 c3 17 80 00 00 	movabs $0x8017c3,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 a9 40 80 00 00 	movabs $0x8040a9,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 a9 40 80 00 00 	movabs $0x8040a9,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 0f 5e 80 00 00 	movabs $0x805e0f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be b0 57 80 00 00 	movabs $0x8057b0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be b2 57 80 00 00 	movabs $0x8057b2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be b5 57 80 00 00 	movabs $0x8057b5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 a7 4e 80 00 00 	movabs $0x804ea7,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 7e 51 80 00 00 	movabs $0x80517e,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 26 34 80 00 00 	movabs $0x803426,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 bd 37 80 00 00 	movabs $0x8037bd,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 86 38 80 00 00 	movabs $0x803886,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 8c 37 80 00 00 	movabs $0x80378c,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 8c 37 80 00 00 	movabs $0x80378c,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 26 34 80 00 00 	movabs $0x803426,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb cd 23 80 00 00 	movabs $0x8023cd,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 57 80 00 00 	movabs $0x8057c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 cd 23 80 00 00 	movabs $0x8023cd,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 00 24 80 00 00 	movabs $0x802400,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc cd 23 80 00 00 	movabs $0x8023cd,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 5a 80 00 00 	movabs $0x805a60,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf cd 23 80 00 00 	movabs $0x8023cd,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf cd 23 80 00 00 	movabs $0x8023cd,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5c 80 00 00 	movabs $0x805ce0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5c 80 00 00 	movabs $0x805ce0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 25 26 80 00 00 	movabs $0x802625,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 0c 01 00 00       	call   80160b <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <handler>:
+/* Test user-level fault handler -- alloc pages to fix faults */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80150a:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  80150d:	48 89 de             	mov    %rbx,%rsi
+  801510:	48 bf 02 5d 80 00 00 	movabs $0x805d02,%rdi
+  801517:	00 00 00 
+  80151a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151f:	48 ba 27 18 80 00 00 	movabs $0x801827,%rdx
+  801526:	00 00 00 
+  801529:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80152b:	48 89 de             	mov    %rbx,%rsi
+  80152e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  801535:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80153a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80153f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801544:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  80154b:	00 00 00 
+  80154e:	ff d0                	call   *%rax
+  801550:	85 c0                	test   %eax,%eax
+  801552:	78 32                	js     801586 <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  801554:	48 89 d9             	mov    %rbx,%rcx
+  801557:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  80155e:	00 00 00 
+  801561:	be 64 00 00 00       	mov    $0x64,%esi
+  801566:	48 89 df             	mov    %rbx,%rdi
+  801569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156e:	49 b8 e3 20 80 00 00 	movabs $0x8020e3,%r8
+  801575:	00 00 00 
+  801578:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80157b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  801586:	41 89 c0             	mov    %eax,%r8d
+  801589:	48 89 d9             	mov    %rbx,%rcx
+  80158c:	48 ba 28 5d 80 00 00 	movabs $0x805d28,%rdx
+  801593:	00 00 00 
+  801596:	be 0d 00 00 00       	mov    $0xd,%esi
+  80159b:	48 bf 0d 5d 80 00 00 	movabs $0x805d0d,%rdi
+  8015a2:	00 00 00 
+  8015a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015aa:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  8015b1:	00 00 00 
+  8015b4:	41 ff d1             	call   *%r9
+
+00000000008015b7 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8015b7:	55                   	push   %rbp
+  8015b8:	48 89 e5             	mov    %rsp,%rbp
+  8015bb:	41 54                	push   %r12
+  8015bd:	53                   	push   %rbx
+    add_pgfault_handler(handler);
+  8015be:	48 bf 01 15 80 00 00 	movabs $0x801501,%rdi
+  8015c5:	00 00 00 
+  8015c8:	48 b8 ab 2f 80 00 00 	movabs $0x802fab,%rax
+  8015cf:	00 00 00 
+  8015d2:	ff d0                	call   *%rax
+    cprintf("%s\n", (char *)0xBeefDead);
+  8015d4:	be ad de ef be       	mov    $0xbeefdead,%esi
+  8015d9:	49 bc 1f 5d 80 00 00 	movabs $0x805d1f,%r12
+  8015e0:	00 00 00 
+  8015e3:	4c 89 e7             	mov    %r12,%rdi
+  8015e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015eb:	48 bb 27 18 80 00 00 	movabs $0x801827,%rbx
+  8015f2:	00 00 00 
+  8015f5:	ff d3                	call   *%rbx
+    cprintf("%s\n", (char *)0xCafeBffe);
+  8015f7:	be fe bf fe ca       	mov    $0xcafebffe,%esi
+  8015fc:	4c 89 e7             	mov    %r12,%rdi
+  8015ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801604:	ff d3                	call   *%rbx
+}
+  801606:	5b                   	pop    %rbx
+  801607:	41 5c                	pop    %r12
+  801609:	5d                   	pop    %rbp
+  80160a:	c3                   	ret
+
+000000000080160b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80160b:	55                   	push   %rbp
+  80160c:	48 89 e5             	mov    %rsp,%rbp
+  80160f:	41 56                	push   %r14
+  801611:	41 55                	push   %r13
+  801613:	41 54                	push   %r12
+  801615:	53                   	push   %rbx
+  801616:	41 89 fd             	mov    %edi,%r13d
+  801619:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80161c:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801623:	00 00 00 
+  801626:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80162d:	00 00 00 
+  801630:	48 39 c2             	cmp    %rax,%rdx
+  801633:	73 17                	jae    80164c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801635:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801638:	49 89 c4             	mov    %rax,%r12
+  80163b:	48 83 c3 08          	add    $0x8,%rbx
+  80163f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801644:	ff 53 f8             	call   *-0x8(%rbx)
+  801647:	4c 39 e3             	cmp    %r12,%rbx
+  80164a:	72 ef                	jb     80163b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80164c:	48 b8 eb 27 80 00 00 	movabs $0x8027eb,%rax
+  801653:	00 00 00 
+  801656:	ff d0                	call   *%rax
+  801658:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80165d:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801664:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80166b:	00 00 00 
+  80166e:	48 01 d0             	add    %rdx,%rax
+  801671:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801678:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80167b:	45 85 ed             	test   %r13d,%r13d
+  80167e:	7e 0d                	jle    80168d <libmain+0x82>
+  801680:	49 8b 06             	mov    (%r14),%rax
+  801683:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80168a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80168d:	4c 89 f6             	mov    %r14,%rsi
+  801690:	44 89 ef             	mov    %r13d,%edi
+  801693:	48 b8 b7 15 80 00 00 	movabs $0x8015b7,%rax
+  80169a:	00 00 00 
+  80169d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80169f:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  8016a6:	00 00 00 
+  8016a9:	ff d0                	call   *%rax
+#endif
+}
+  8016ab:	5b                   	pop    %rbx
+  8016ac:	41 5c                	pop    %r12
+  8016ae:	41 5d                	pop    %r13
+  8016b0:	41 5e                	pop    %r14
+  8016b2:	5d                   	pop    %rbp
+  8016b3:	c3                   	ret
+
+00000000008016b4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8016b8:	48 b8 59 34 80 00 00 	movabs $0x803459,%rax
+  8016bf:	00 00 00 
+  8016c2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8016c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c9:	48 b8 7a 27 80 00 00 	movabs $0x80277a,%rax
+  8016d0:	00 00 00 
+  8016d3:	ff d0                	call   *%rax
+}
+  8016d5:	5d                   	pop    %rbp
+  8016d6:	c3                   	ret
+
+00000000008016d7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8016d7:	55                   	push   %rbp
+  8016d8:	48 89 e5             	mov    %rsp,%rbp
+  8016db:	41 56                	push   %r14
+  8016dd:	41 55                	push   %r13
+  8016df:	41 54                	push   %r12
+  8016e1:	53                   	push   %rbx
+  8016e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8016e6:	49 89 fc             	mov    %rdi,%r12
+  8016e9:	41 89 f5             	mov    %esi,%r13d
+  8016ec:	48 89 d3             	mov    %rdx,%rbx
+  8016ef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8016f3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8016f7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8016fb:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801702:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801706:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80170a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80170e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801712:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801719:	00 00 00 
+  80171c:	4c 8b 30             	mov    (%rax),%r14
+  80171f:	48 b8 eb 27 80 00 00 	movabs $0x8027eb,%rax
+  801726:	00 00 00 
+  801729:	ff d0                	call   *%rax
+  80172b:	89 c6                	mov    %eax,%esi
+  80172d:	45 89 e8             	mov    %r13d,%r8d
+  801730:	4c 89 e1             	mov    %r12,%rcx
+  801733:	4c 89 f2             	mov    %r14,%rdx
+  801736:	48 bf 88 5d 80 00 00 	movabs $0x805d88,%rdi
+  80173d:	00 00 00 
+  801740:	b8 00 00 00 00       	mov    $0x0,%eax
+  801745:	49 bc 27 18 80 00 00 	movabs $0x801827,%r12
+  80174c:	00 00 00 
+  80174f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801752:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801756:	48 89 df             	mov    %rbx,%rdi
+  801759:	48 b8 c3 17 80 00 00 	movabs $0x8017c3,%rax
+  801760:	00 00 00 
+  801763:	ff d0                	call   *%rax
+    cprintf("\n");
+  801765:	48 bf db 63 80 00 00 	movabs $0x8063db,%rdi
+  80176c:	00 00 00 
+  80176f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801774:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801777:	cc                   	int3
+  801778:	eb fd                	jmp    801777 <_panic+0xa0>
+
+000000000080177a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80177a:	55                   	push   %rbp
+  80177b:	48 89 e5             	mov    %rsp,%rbp
+  80177e:	53                   	push   %rbx
+  80177f:	48 83 ec 08          	sub    $0x8,%rsp
+  801783:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801786:	8b 06                	mov    (%rsi),%eax
+  801788:	8d 50 01             	lea    0x1(%rax),%edx
+  80178b:	89 16                	mov    %edx,(%rsi)
+  80178d:	48 98                	cltq
+  80178f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801794:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80179a:	74 0a                	je     8017a6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80179c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8017a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a4:	c9                   	leave
+  8017a5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8017a6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8017aa:	be ff 00 00 00       	mov    $0xff,%esi
+  8017af:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  8017b6:	00 00 00 
+  8017b9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8017bb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8017c1:	eb d9                	jmp    80179c <putch+0x22>
+
+00000000008017c3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8017c3:	55                   	push   %rbp
+  8017c4:	48 89 e5             	mov    %rsp,%rbp
+  8017c7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8017ce:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8017d1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8017d8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8017dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8017e5:	48 89 f1             	mov    %rsi,%rcx
+  8017e8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8017ef:	48 bf 7a 17 80 00 00 	movabs $0x80177a,%rdi
+  8017f6:	00 00 00 
+  8017f9:	48 b8 77 19 80 00 00 	movabs $0x801977,%rax
+  801800:	00 00 00 
+  801803:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801805:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80180c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801813:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  80181a:	00 00 00 
+  80181d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80181f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+
+0000000000801827 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801827:	55                   	push   %rbp
+  801828:	48 89 e5             	mov    %rsp,%rbp
+  80182b:	48 83 ec 50          	sub    $0x50,%rsp
+  80182f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801833:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801837:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80183b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80183f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801843:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80184a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80184e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801852:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801856:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80185a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80185e:	48 b8 c3 17 80 00 00 	movabs $0x8017c3,%rax
+  801865:	00 00 00 
+  801868:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80186a:	c9                   	leave
+  80186b:	c3                   	ret
+
+000000000080186c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80186c:	55                   	push   %rbp
+  80186d:	48 89 e5             	mov    %rsp,%rbp
+  801870:	41 57                	push   %r15
+  801872:	41 56                	push   %r14
+  801874:	41 55                	push   %r13
+  801876:	41 54                	push   %r12
+  801878:	53                   	push   %rbx
+  801879:	48 83 ec 18          	sub    $0x18,%rsp
+  80187d:	49 89 fc             	mov    %rdi,%r12
+  801880:	49 89 f5             	mov    %rsi,%r13
+  801883:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801887:	8b 45 10             	mov    0x10(%rbp),%eax
+  80188a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80188d:	41 89 cf             	mov    %ecx,%r15d
+  801890:	4c 39 fa             	cmp    %r15,%rdx
+  801893:	73 5b                	jae    8018f0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801895:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801899:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80189d:	85 db                	test   %ebx,%ebx
+  80189f:	7e 0e                	jle    8018af <print_num+0x43>
+            putch(padc, put_arg);
+  8018a1:	4c 89 ee             	mov    %r13,%rsi
+  8018a4:	44 89 f7             	mov    %r14d,%edi
+  8018a7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8018aa:	83 eb 01             	sub    $0x1,%ebx
+  8018ad:	75 f2                	jne    8018a1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8018af:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8018b3:	48 b9 bc 5d 80 00 00 	movabs $0x805dbc,%rcx
+  8018ba:	00 00 00 
+  8018bd:	48 b8 ab 5d 80 00 00 	movabs $0x805dab,%rax
+  8018c4:	00 00 00 
+  8018c7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8018cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d4:	49 f7 f7             	div    %r15
+  8018d7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8018db:	4c 89 ee             	mov    %r13,%rsi
+  8018de:	41 ff d4             	call   *%r12
+}
+  8018e1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8018e5:	5b                   	pop    %rbx
+  8018e6:	41 5c                	pop    %r12
+  8018e8:	41 5d                	pop    %r13
+  8018ea:	41 5e                	pop    %r14
+  8018ec:	41 5f                	pop    %r15
+  8018ee:	5d                   	pop    %rbp
+  8018ef:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8018f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f9:	49 f7 f7             	div    %r15
+  8018fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801900:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801904:	52                   	push   %rdx
+  801905:	45 0f be c9          	movsbl %r9b,%r9d
+  801909:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80190d:	48 89 c2             	mov    %rax,%rdx
+  801910:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801917:	00 00 00 
+  80191a:	ff d0                	call   *%rax
+  80191c:	48 83 c4 10          	add    $0x10,%rsp
+  801920:	eb 8d                	jmp    8018af <print_num+0x43>
+
+0000000000801922 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801922:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801926:	48 8b 06             	mov    (%rsi),%rax
+  801929:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80192d:	73 0a                	jae    801939 <sprintputch+0x17>
+        *state->start++ = ch;
+  80192f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801933:	48 89 16             	mov    %rdx,(%rsi)
+  801936:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801939:	c3                   	ret
+
+000000000080193a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80193a:	55                   	push   %rbp
+  80193b:	48 89 e5             	mov    %rsp,%rbp
+  80193e:	48 83 ec 50          	sub    $0x50,%rsp
+  801942:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801946:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80194a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80194e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801955:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80195d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801961:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801965:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801969:	48 b8 77 19 80 00 00 	movabs $0x801977,%rax
+  801970:	00 00 00 
+  801973:	ff d0                	call   *%rax
+}
+  801975:	c9                   	leave
+  801976:	c3                   	ret
+
+0000000000801977 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801977:	55                   	push   %rbp
+  801978:	48 89 e5             	mov    %rsp,%rbp
+  80197b:	41 57                	push   %r15
+  80197d:	41 56                	push   %r14
+  80197f:	41 55                	push   %r13
+  801981:	41 54                	push   %r12
+  801983:	53                   	push   %rbx
+  801984:	48 83 ec 38          	sub    $0x38,%rsp
+  801988:	49 89 fe             	mov    %rdi,%r14
+  80198b:	49 89 f5             	mov    %rsi,%r13
+  80198e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801991:	48 8b 01             	mov    (%rcx),%rax
+  801994:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801998:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80199c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019a0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8019a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8019a8:	eb 0d                	jmp    8019b7 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8019aa:	40 0f b6 ff          	movzbl %dil,%edi
+  8019ae:	4c 89 ee             	mov    %r13,%rsi
+  8019b1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8019b4:	4c 89 e3             	mov    %r12,%rbx
+  8019b7:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8019bb:	0f b6 3b             	movzbl (%rbx),%edi
+  8019be:	40 80 ff 25          	cmp    $0x25,%dil
+  8019c2:	74 14                	je     8019d8 <vprintfmt+0x61>
+            if (!ch) return;
+  8019c4:	40 84 ff             	test   %dil,%dil
+  8019c7:	75 e1                	jne    8019aa <vprintfmt+0x33>
+}
+  8019c9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019cd:	5b                   	pop    %rbx
+  8019ce:	41 5c                	pop    %r12
+  8019d0:	41 5d                	pop    %r13
+  8019d2:	41 5e                	pop    %r14
+  8019d4:	41 5f                	pop    %r15
+  8019d6:	5d                   	pop    %rbp
+  8019d7:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  8019d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8019dd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8019e1:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8019e6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8019ec:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8019f3:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8019f7:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8019fc:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a01:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a04:	83 e8 23             	sub    $0x23,%eax
+  801a07:	3c 57                	cmp    $0x57,%al
+  801a09:	0f 87 67 06 00 00    	ja     802076 <vprintfmt+0x6ff>
+  801a0f:	0f b6 c0             	movzbl %al,%eax
+  801a12:	48 b9 40 5f 80 00 00 	movabs $0x805f40,%rcx
+  801a19:	00 00 00 
+  801a1c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801a1f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801a22:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801a26:	eb cf                	jmp    8019f7 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801a28:	49 89 dc             	mov    %rbx,%r12
+  801a2b:	be 01 00 00 00       	mov    $0x1,%esi
+  801a30:	eb c5                	jmp    8019f7 <vprintfmt+0x80>
+            padc = ch;
+  801a32:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801a36:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a39:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a3c:	eb b9                	jmp    8019f7 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a41:	83 f8 2f             	cmp    $0x2f,%eax
+  801a44:	77 24                	ja     801a6a <vprintfmt+0xf3>
+  801a46:	89 c1                	mov    %eax,%ecx
+  801a48:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801a4c:	83 c0 08             	add    $0x8,%eax
+  801a4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a52:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801a55:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801a58:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a5c:	79 99                	jns    8019f7 <vprintfmt+0x80>
+                width = precision;
+  801a5e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801a62:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a68:	eb 8d                	jmp    8019f7 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a6a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a6e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801a72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a76:	eb da                	jmp    801a52 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801a78:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801a7d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a81:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801a87:	3c 39                	cmp    $0x39,%al
+  801a89:	77 1c                	ja     801aa7 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801a8b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801a8f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801a93:	0f b6 c0             	movzbl %al,%eax
+  801a96:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a9b:	0f b6 03             	movzbl (%rbx),%eax
+  801a9e:	3c 39                	cmp    $0x39,%al
+  801aa0:	76 e9                	jbe    801a8b <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801aa2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801aa5:	eb b1                	jmp    801a58 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801aa7:	49 89 dc             	mov    %rbx,%r12
+  801aaa:	eb ac                	jmp    801a58 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801aac:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801aaf:	85 c9                	test   %ecx,%ecx
+  801ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab6:	0f 49 c1             	cmovns %ecx,%eax
+  801ab9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801abc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801abf:	e9 33 ff ff ff       	jmp    8019f7 <vprintfmt+0x80>
+            lflag++;
+  801ac4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ac7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801aca:	e9 28 ff ff ff       	jmp    8019f7 <vprintfmt+0x80>
+            lflag--;
+  801acf:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ad2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ad5:	e9 1d ff ff ff       	jmp    8019f7 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801ada:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801add:	83 f8 2f             	cmp    $0x2f,%eax
+  801ae0:	77 19                	ja     801afb <vprintfmt+0x184>
+  801ae2:	89 c2                	mov    %eax,%edx
+  801ae4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ae8:	83 c0 08             	add    $0x8,%eax
+  801aeb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801aee:	8b 3a                	mov    (%rdx),%edi
+  801af0:	4c 89 ee             	mov    %r13,%rsi
+  801af3:	41 ff d6             	call   *%r14
+            break;
+  801af6:	e9 bc fe ff ff       	jmp    8019b7 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b07:	eb e5                	jmp    801aee <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801b09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b0c:	83 f8 2f             	cmp    $0x2f,%eax
+  801b0f:	77 5a                	ja     801b6b <vprintfmt+0x1f4>
+  801b11:	89 c2                	mov    %eax,%edx
+  801b13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b17:	83 c0 08             	add    $0x8,%eax
+  801b1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801b1d:	8b 02                	mov    (%rdx),%eax
+  801b1f:	89 c1                	mov    %eax,%ecx
+  801b21:	f7 d9                	neg    %ecx
+  801b23:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801b26:	83 f9 13             	cmp    $0x13,%ecx
+  801b29:	7f 4e                	jg     801b79 <vprintfmt+0x202>
+  801b2b:	48 63 c1             	movslq %ecx,%rax
+  801b2e:	48 ba 00 62 80 00 00 	movabs $0x806200,%rdx
+  801b35:	00 00 00 
+  801b38:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b3c:	48 85 c0             	test   %rax,%rax
+  801b3f:	74 38                	je     801b79 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801b41:	48 89 c1             	mov    %rax,%rcx
+  801b44:	48 ba 7a 63 80 00 00 	movabs $0x80637a,%rdx
+  801b4b:	00 00 00 
+  801b4e:	4c 89 ee             	mov    %r13,%rsi
+  801b51:	4c 89 f7             	mov    %r14,%rdi
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	49 b8 3a 19 80 00 00 	movabs $0x80193a,%r8
+  801b60:	00 00 00 
+  801b63:	41 ff d0             	call   *%r8
+  801b66:	e9 4c fe ff ff       	jmp    8019b7 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801b6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b77:	eb a4                	jmp    801b1d <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801b79:	48 ba d4 5d 80 00 00 	movabs $0x805dd4,%rdx
+  801b80:	00 00 00 
+  801b83:	4c 89 ee             	mov    %r13,%rsi
+  801b86:	4c 89 f7             	mov    %r14,%rdi
+  801b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8e:	49 b8 3a 19 80 00 00 	movabs $0x80193a,%r8
+  801b95:	00 00 00 
+  801b98:	41 ff d0             	call   *%r8
+  801b9b:	e9 17 fe ff ff       	jmp    8019b7 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ba0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ba3:	83 f8 2f             	cmp    $0x2f,%eax
+  801ba6:	77 6c                	ja     801c14 <vprintfmt+0x29d>
+  801ba8:	89 c2                	mov    %eax,%edx
+  801baa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bae:	83 c0 08             	add    $0x8,%eax
+  801bb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bb4:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801bb7:	48 85 f6             	test   %rsi,%rsi
+  801bba:	48 b8 cd 5d 80 00 00 	movabs $0x805dcd,%rax
+  801bc1:	00 00 00 
+  801bc4:	48 0f 45 c6          	cmovne %rsi,%rax
+  801bc8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801bcc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801bd0:	7e 06                	jle    801bd8 <vprintfmt+0x261>
+  801bd2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801bd6:	75 4a                	jne    801c22 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801bd8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801bdc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801be0:	0f b6 00             	movzbl (%rax),%eax
+  801be3:	84 c0                	test   %al,%al
+  801be5:	0f 85 9a 00 00 00    	jne    801c85 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801beb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bee:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	0f 8e bd fd ff ff    	jle    8019b7 <vprintfmt+0x40>
+  801bfa:	4c 89 ee             	mov    %r13,%rsi
+  801bfd:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c02:	41 ff d6             	call   *%r14
+  801c05:	41 83 ec 01          	sub    $0x1,%r12d
+  801c09:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801c0d:	75 eb                	jne    801bfa <vprintfmt+0x283>
+  801c0f:	e9 a3 fd ff ff       	jmp    8019b7 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c20:	eb 92                	jmp    801bb4 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801c22:	49 63 f7             	movslq %r15d,%rsi
+  801c25:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801c29:	48 b8 3b 21 80 00 00 	movabs $0x80213b,%rax
+  801c30:	00 00 00 
+  801c33:	ff d0                	call   *%rax
+  801c35:	48 89 c2             	mov    %rax,%rdx
+  801c38:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c3b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801c3d:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801c40:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	7e 91                	jle    801bd8 <vprintfmt+0x261>
+  801c47:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801c4c:	4c 89 ee             	mov    %r13,%rsi
+  801c4f:	44 89 e7             	mov    %r12d,%edi
+  801c52:	41 ff d6             	call   *%r14
+  801c55:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c59:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c5c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801c5f:	75 eb                	jne    801c4c <vprintfmt+0x2d5>
+  801c61:	e9 72 ff ff ff       	jmp    801bd8 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c66:	0f b6 f8             	movzbl %al,%edi
+  801c69:	4c 89 ee             	mov    %r13,%rsi
+  801c6c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c6f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c73:	49 83 c4 01          	add    $0x1,%r12
+  801c77:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801c7d:	84 c0                	test   %al,%al
+  801c7f:	0f 84 66 ff ff ff    	je     801beb <vprintfmt+0x274>
+  801c85:	45 85 ff             	test   %r15d,%r15d
+  801c88:	78 0a                	js     801c94 <vprintfmt+0x31d>
+  801c8a:	41 83 ef 01          	sub    $0x1,%r15d
+  801c8e:	0f 88 57 ff ff ff    	js     801beb <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c94:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801c98:	74 cc                	je     801c66 <vprintfmt+0x2ef>
+  801c9a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801c9d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ca2:	80 fa 5e             	cmp    $0x5e,%dl
+  801ca5:	77 c2                	ja     801c69 <vprintfmt+0x2f2>
+  801ca7:	eb bd                	jmp    801c66 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801ca9:	40 84 f6             	test   %sil,%sil
+  801cac:	75 26                	jne    801cd4 <vprintfmt+0x35d>
+    switch (lflag) {
+  801cae:	85 d2                	test   %edx,%edx
+  801cb0:	74 59                	je     801d0b <vprintfmt+0x394>
+  801cb2:	83 fa 01             	cmp    $0x1,%edx
+  801cb5:	74 7b                	je     801d32 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801cb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cba:	83 f8 2f             	cmp    $0x2f,%eax
+  801cbd:	0f 87 96 00 00 00    	ja     801d59 <vprintfmt+0x3e2>
+  801cc3:	89 c2                	mov    %eax,%edx
+  801cc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cc9:	83 c0 08             	add    $0x8,%eax
+  801ccc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ccf:	4c 8b 22             	mov    (%rdx),%r12
+  801cd2:	eb 17                	jmp    801ceb <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801cd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cd7:	83 f8 2f             	cmp    $0x2f,%eax
+  801cda:	77 21                	ja     801cfd <vprintfmt+0x386>
+  801cdc:	89 c2                	mov    %eax,%edx
+  801cde:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ce2:	83 c0 08             	add    $0x8,%eax
+  801ce5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ce8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801ceb:	4d 85 e4             	test   %r12,%r12
+  801cee:	78 7a                	js     801d6a <vprintfmt+0x3f3>
+            num = i;
+  801cf0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801cf3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801cf8:	e9 56 02 00 00       	jmp    801f53 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d09:	eb dd                	jmp    801ce8 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801d0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d0e:	83 f8 2f             	cmp    $0x2f,%eax
+  801d11:	77 11                	ja     801d24 <vprintfmt+0x3ad>
+  801d13:	89 c2                	mov    %eax,%edx
+  801d15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d19:	83 c0 08             	add    $0x8,%eax
+  801d1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d1f:	4c 63 22             	movslq (%rdx),%r12
+  801d22:	eb c7                	jmp    801ceb <vprintfmt+0x374>
+  801d24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d30:	eb ed                	jmp    801d1f <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801d32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d35:	83 f8 2f             	cmp    $0x2f,%eax
+  801d38:	77 11                	ja     801d4b <vprintfmt+0x3d4>
+  801d3a:	89 c2                	mov    %eax,%edx
+  801d3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d40:	83 c0 08             	add    $0x8,%eax
+  801d43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d46:	4c 8b 22             	mov    (%rdx),%r12
+  801d49:	eb a0                	jmp    801ceb <vprintfmt+0x374>
+  801d4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d57:	eb ed                	jmp    801d46 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801d59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d65:	e9 65 ff ff ff       	jmp    801ccf <vprintfmt+0x358>
+                putch('-', put_arg);
+  801d6a:	4c 89 ee             	mov    %r13,%rsi
+  801d6d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801d72:	41 ff d6             	call   *%r14
+                i = -i;
+  801d75:	49 f7 dc             	neg    %r12
+  801d78:	e9 73 ff ff ff       	jmp    801cf0 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801d7d:	40 84 f6             	test   %sil,%sil
+  801d80:	75 2e                	jne    801db0 <vprintfmt+0x439>
+    switch (lflag) {
+  801d82:	85 d2                	test   %edx,%edx
+  801d84:	7f 59                	jg     801ddf <vprintfmt+0x468>
+  801d86:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d89:	7d 7a                	jge    801e05 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801d8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d8e:	83 f8 2f             	cmp    $0x2f,%eax
+  801d91:	0f 87 aa 00 00 00    	ja     801e41 <vprintfmt+0x4ca>
+  801d97:	89 c2                	mov    %eax,%edx
+  801d99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9d:	83 c0 08             	add    $0x8,%eax
+  801da0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801da6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801dab:	e9 a3 01 00 00       	jmp    801f53 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801db0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db3:	83 f8 2f             	cmp    $0x2f,%eax
+  801db6:	77 19                	ja     801dd1 <vprintfmt+0x45a>
+  801db8:	89 c2                	mov    %eax,%edx
+  801dba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dbe:	83 c0 08             	add    $0x8,%eax
+  801dc1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801dc7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801dcc:	e9 82 01 00 00       	jmp    801f53 <vprintfmt+0x5dc>
+  801dd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ddd:	eb e5                	jmp    801dc4 <vprintfmt+0x44d>
+    switch (lflag) {
+  801ddf:	83 fa 01             	cmp    $0x1,%edx
+  801de2:	75 a7                	jne    801d8b <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801de4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801de7:	83 f8 2f             	cmp    $0x2f,%eax
+  801dea:	77 47                	ja     801e33 <vprintfmt+0x4bc>
+  801dec:	89 c2                	mov    %eax,%edx
+  801dee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df2:	83 c0 08             	add    $0x8,%eax
+  801df5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801df8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801dfb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e00:	e9 4e 01 00 00       	jmp    801f53 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e08:	83 f8 2f             	cmp    $0x2f,%eax
+  801e0b:	77 18                	ja     801e25 <vprintfmt+0x4ae>
+  801e0d:	89 c2                	mov    %eax,%edx
+  801e0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e13:	83 c0 08             	add    $0x8,%eax
+  801e16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e19:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801e1b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801e20:	e9 2e 01 00 00       	jmp    801f53 <vprintfmt+0x5dc>
+  801e25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e31:	eb e6                	jmp    801e19 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801e33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e3f:	eb b7                	jmp    801df8 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801e41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e4d:	e9 51 ff ff ff       	jmp    801da3 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801e52:	40 84 f6             	test   %sil,%sil
+  801e55:	75 2e                	jne    801e85 <vprintfmt+0x50e>
+    switch (lflag) {
+  801e57:	85 d2                	test   %edx,%edx
+  801e59:	7f 59                	jg     801eb4 <vprintfmt+0x53d>
+  801e5b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e5e:	7d 77                	jge    801ed7 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801e60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e63:	83 f8 2f             	cmp    $0x2f,%eax
+  801e66:	0f 87 a4 00 00 00    	ja     801f10 <vprintfmt+0x599>
+  801e6c:	89 c2                	mov    %eax,%edx
+  801e6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e72:	83 c0 08             	add    $0x8,%eax
+  801e75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e78:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e7b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e80:	e9 ce 00 00 00       	jmp    801f53 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e88:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8b:	77 19                	ja     801ea6 <vprintfmt+0x52f>
+  801e8d:	89 c2                	mov    %eax,%edx
+  801e8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e93:	83 c0 08             	add    $0x8,%eax
+  801e96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e9c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ea1:	e9 ad 00 00 00       	jmp    801f53 <vprintfmt+0x5dc>
+  801ea6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb2:	eb e5                	jmp    801e99 <vprintfmt+0x522>
+    switch (lflag) {
+  801eb4:	83 fa 01             	cmp    $0x1,%edx
+  801eb7:	75 a7                	jne    801e60 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801eb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ebc:	83 f8 2f             	cmp    $0x2f,%eax
+  801ebf:	77 41                	ja     801f02 <vprintfmt+0x58b>
+  801ec1:	89 c2                	mov    %eax,%edx
+  801ec3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec7:	83 c0 08             	add    $0x8,%eax
+  801eca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ecd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ed0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801ed5:	eb 7c                	jmp    801f53 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801ed7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eda:	83 f8 2f             	cmp    $0x2f,%eax
+  801edd:	77 15                	ja     801ef4 <vprintfmt+0x57d>
+  801edf:	89 c2                	mov    %eax,%edx
+  801ee1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee5:	83 c0 08             	add    $0x8,%eax
+  801ee8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eeb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801eed:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801ef2:	eb 5f                	jmp    801f53 <vprintfmt+0x5dc>
+  801ef4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ef8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f00:	eb e9                	jmp    801eeb <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f0e:	eb bd                	jmp    801ecd <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801f10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f1c:	e9 57 ff ff ff       	jmp    801e78 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801f21:	4c 89 ee             	mov    %r13,%rsi
+  801f24:	bf 30 00 00 00       	mov    $0x30,%edi
+  801f29:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801f2c:	4c 89 ee             	mov    %r13,%rsi
+  801f2f:	bf 78 00 00 00       	mov    $0x78,%edi
+  801f34:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801f37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f3a:	83 f8 2f             	cmp    $0x2f,%eax
+  801f3d:	77 47                	ja     801f86 <vprintfmt+0x60f>
+  801f3f:	89 c2                	mov    %eax,%edx
+  801f41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f45:	83 c0 08             	add    $0x8,%eax
+  801f48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f4b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f4e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801f53:	48 83 ec 08          	sub    $0x8,%rsp
+  801f57:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801f5b:	0f 94 c0             	sete   %al
+  801f5e:	0f b6 c0             	movzbl %al,%eax
+  801f61:	50                   	push   %rax
+  801f62:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801f67:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801f6b:	4c 89 ee             	mov    %r13,%rsi
+  801f6e:	4c 89 f7             	mov    %r14,%rdi
+  801f71:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  801f78:	00 00 00 
+  801f7b:	ff d0                	call   *%rax
+            break;
+  801f7d:	48 83 c4 10          	add    $0x10,%rsp
+  801f81:	e9 31 fa ff ff       	jmp    8019b7 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801f86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f92:	eb b7                	jmp    801f4b <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801f94:	40 84 f6             	test   %sil,%sil
+  801f97:	75 2b                	jne    801fc4 <vprintfmt+0x64d>
+    switch (lflag) {
+  801f99:	85 d2                	test   %edx,%edx
+  801f9b:	7f 56                	jg     801ff3 <vprintfmt+0x67c>
+  801f9d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fa0:	7d 77                	jge    802019 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801fa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fa5:	83 f8 2f             	cmp    $0x2f,%eax
+  801fa8:	0f 87 a7 00 00 00    	ja     802055 <vprintfmt+0x6de>
+  801fae:	89 c2                	mov    %eax,%edx
+  801fb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb4:	83 c0 08             	add    $0x8,%eax
+  801fb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fbd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fc2:	eb 8f                	jmp    801f53 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fc7:	83 f8 2f             	cmp    $0x2f,%eax
+  801fca:	77 19                	ja     801fe5 <vprintfmt+0x66e>
+  801fcc:	89 c2                	mov    %eax,%edx
+  801fce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd2:	83 c0 08             	add    $0x8,%eax
+  801fd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fd8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fdb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801fe0:	e9 6e ff ff ff       	jmp    801f53 <vprintfmt+0x5dc>
+  801fe5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fe9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ff1:	eb e5                	jmp    801fd8 <vprintfmt+0x661>
+    switch (lflag) {
+  801ff3:	83 fa 01             	cmp    $0x1,%edx
+  801ff6:	75 aa                	jne    801fa2 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801ff8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ffb:	83 f8 2f             	cmp    $0x2f,%eax
+  801ffe:	77 47                	ja     802047 <vprintfmt+0x6d0>
+  802000:	89 c2                	mov    %eax,%edx
+  802002:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802006:	83 c0 08             	add    $0x8,%eax
+  802009:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80200c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80200f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802014:	e9 3a ff ff ff       	jmp    801f53 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802019:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80201c:	83 f8 2f             	cmp    $0x2f,%eax
+  80201f:	77 18                	ja     802039 <vprintfmt+0x6c2>
+  802021:	89 c2                	mov    %eax,%edx
+  802023:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802027:	83 c0 08             	add    $0x8,%eax
+  80202a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80202d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80202f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802034:	e9 1a ff ff ff       	jmp    801f53 <vprintfmt+0x5dc>
+  802039:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80203d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802041:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802045:	eb e6                	jmp    80202d <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802047:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80204b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80204f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802053:	eb b7                	jmp    80200c <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802055:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802059:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80205d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802061:	e9 54 ff ff ff       	jmp    801fba <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802066:	4c 89 ee             	mov    %r13,%rsi
+  802069:	bf 25 00 00 00       	mov    $0x25,%edi
+  80206e:	41 ff d6             	call   *%r14
+            break;
+  802071:	e9 41 f9 ff ff       	jmp    8019b7 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802076:	4c 89 ee             	mov    %r13,%rsi
+  802079:	bf 25 00 00 00       	mov    $0x25,%edi
+  80207e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802081:	48 83 eb 01          	sub    $0x1,%rbx
+  802085:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802089:	75 f6                	jne    802081 <vprintfmt+0x70a>
+  80208b:	e9 27 f9 ff ff       	jmp    8019b7 <vprintfmt+0x40>
+
+0000000000802090 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802090:	55                   	push   %rbp
+  802091:	48 89 e5             	mov    %rsp,%rbp
+  802094:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802098:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80209c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8020a1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8020a5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8020ac:	48 85 ff             	test   %rdi,%rdi
+  8020af:	74 2b                	je     8020dc <vsnprintf+0x4c>
+  8020b1:	48 85 f6             	test   %rsi,%rsi
+  8020b4:	74 26                	je     8020dc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8020b6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020ba:	48 bf 22 19 80 00 00 	movabs $0x801922,%rdi
+  8020c1:	00 00 00 
+  8020c4:	48 b8 77 19 80 00 00 	movabs $0x801977,%rax
+  8020cb:	00 00 00 
+  8020ce:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8020d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8020d7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8020da:	c9                   	leave
+  8020db:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8020dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e1:	eb f7                	jmp    8020da <vsnprintf+0x4a>
+
+00000000008020e3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8020e3:	55                   	push   %rbp
+  8020e4:	48 89 e5             	mov    %rsp,%rbp
+  8020e7:	48 83 ec 50          	sub    $0x50,%rsp
+  8020eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020ef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8020f3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8020f7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8020fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802102:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802106:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80210a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80210e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802112:	48 b8 90 20 80 00 00 	movabs $0x802090,%rax
+  802119:	00 00 00 
+  80211c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80211e:	c9                   	leave
+  80211f:	c3                   	ret
+
+0000000000802120 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802120:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802123:	74 10                	je     802135 <strlen+0x15>
+    size_t n = 0;
+  802125:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80212a:	48 83 c0 01          	add    $0x1,%rax
+  80212e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802132:	75 f6                	jne    80212a <strlen+0xa>
+  802134:	c3                   	ret
+    size_t n = 0;
+  802135:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80213a:	c3                   	ret
+
+000000000080213b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80213b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80213e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802143:	48 85 f6             	test   %rsi,%rsi
+  802146:	74 11                	je     802159 <strnlen+0x1e>
+  802148:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80214c:	74 0c                	je     80215a <strnlen+0x1f>
+  80214e:	48 83 c2 01          	add    $0x1,%rdx
+  802152:	48 39 d0             	cmp    %rdx,%rax
+  802155:	75 f1                	jne    802148 <strnlen+0xd>
+  802157:	eb 04                	jmp    80215d <strnlen+0x22>
+  802159:	c3                   	ret
+  80215a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80215d:	c3                   	ret
+
+000000000080215e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80215e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802161:	ba 00 00 00 00       	mov    $0x0,%edx
+  802166:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80216a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80216d:	48 83 c2 01          	add    $0x1,%rdx
+  802171:	84 c9                	test   %cl,%cl
+  802173:	75 f1                	jne    802166 <strcpy+0x8>
+        ;
+    return res;
+}
+  802175:	c3                   	ret
+
+0000000000802176 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802176:	55                   	push   %rbp
+  802177:	48 89 e5             	mov    %rsp,%rbp
+  80217a:	41 54                	push   %r12
+  80217c:	53                   	push   %rbx
+  80217d:	48 89 fb             	mov    %rdi,%rbx
+  802180:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802183:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  80218a:	00 00 00 
+  80218d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80218f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802193:	4c 89 e6             	mov    %r12,%rsi
+  802196:	48 b8 5e 21 80 00 00 	movabs $0x80215e,%rax
+  80219d:	00 00 00 
+  8021a0:	ff d0                	call   *%rax
+    return dst;
+}
+  8021a2:	48 89 d8             	mov    %rbx,%rax
+  8021a5:	5b                   	pop    %rbx
+  8021a6:	41 5c                	pop    %r12
+  8021a8:	5d                   	pop    %rbp
+  8021a9:	c3                   	ret
+
+00000000008021aa <toupper>:
+
+int
+toupper(int ch) {
+  8021aa:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8021ac:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8021af:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8021b2:	83 f9 1a             	cmp    $0x1a,%ecx
+  8021b5:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8021b8:	c3                   	ret
+
+00000000008021b9 <tolower>:
+
+int
+tolower(int ch) {
+  8021b9:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8021bb:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8021be:	8d 57 20             	lea    0x20(%rdi),%edx
+  8021c1:	83 f9 1a             	cmp    $0x1a,%ecx
+  8021c4:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8021c7:	c3                   	ret
+
+00000000008021c8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8021c8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8021cb:	48 85 d2             	test   %rdx,%rdx
+  8021ce:	74 1f                	je     8021ef <strncpy+0x27>
+  8021d0:	48 01 fa             	add    %rdi,%rdx
+  8021d3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8021d6:	48 83 c1 01          	add    $0x1,%rcx
+  8021da:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8021de:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8021e2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8021e6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8021ea:	48 39 ca             	cmp    %rcx,%rdx
+  8021ed:	75 e7                	jne    8021d6 <strncpy+0xe>
+    }
+    return ret;
+}
+  8021ef:	c3                   	ret
+
+00000000008021f0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8021f0:	48 89 f8             	mov    %rdi,%rax
+  8021f3:	48 85 d2             	test   %rdx,%rdx
+  8021f6:	74 24                	je     80221c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8021f8:	48 83 ea 01          	sub    $0x1,%rdx
+  8021fc:	74 1b                	je     802219 <strlcpy+0x29>
+  8021fe:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802202:	0f b6 16             	movzbl (%rsi),%edx
+  802205:	84 d2                	test   %dl,%dl
+  802207:	74 10                	je     802219 <strlcpy+0x29>
+            *dst++ = *src++;
+  802209:	48 83 c6 01          	add    $0x1,%rsi
+  80220d:	48 83 c0 01          	add    $0x1,%rax
+  802211:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802214:	48 39 c8             	cmp    %rcx,%rax
+  802217:	75 e9                	jne    802202 <strlcpy+0x12>
+        *dst = '\0';
+  802219:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80221c:	48 29 f8             	sub    %rdi,%rax
+}
+  80221f:	c3                   	ret
+
+0000000000802220 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802220:	0f b6 07             	movzbl (%rdi),%eax
+  802223:	84 c0                	test   %al,%al
+  802225:	74 13                	je     80223a <strcmp+0x1a>
+  802227:	38 06                	cmp    %al,(%rsi)
+  802229:	75 0f                	jne    80223a <strcmp+0x1a>
+  80222b:	48 83 c7 01          	add    $0x1,%rdi
+  80222f:	48 83 c6 01          	add    $0x1,%rsi
+  802233:	0f b6 07             	movzbl (%rdi),%eax
+  802236:	84 c0                	test   %al,%al
+  802238:	75 ed                	jne    802227 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80223a:	0f b6 c0             	movzbl %al,%eax
+  80223d:	0f b6 16             	movzbl (%rsi),%edx
+  802240:	29 d0                	sub    %edx,%eax
+}
+  802242:	c3                   	ret
+
+0000000000802243 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802243:	48 85 d2             	test   %rdx,%rdx
+  802246:	74 1f                	je     802267 <strncmp+0x24>
+  802248:	0f b6 07             	movzbl (%rdi),%eax
+  80224b:	84 c0                	test   %al,%al
+  80224d:	74 1e                	je     80226d <strncmp+0x2a>
+  80224f:	3a 06                	cmp    (%rsi),%al
+  802251:	75 1a                	jne    80226d <strncmp+0x2a>
+  802253:	48 83 c7 01          	add    $0x1,%rdi
+  802257:	48 83 c6 01          	add    $0x1,%rsi
+  80225b:	48 83 ea 01          	sub    $0x1,%rdx
+  80225f:	75 e7                	jne    802248 <strncmp+0x5>
+
+    if (!n) return 0;
+  802261:	b8 00 00 00 00       	mov    $0x0,%eax
+  802266:	c3                   	ret
+  802267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226c:	c3                   	ret
+  80226d:	48 85 d2             	test   %rdx,%rdx
+  802270:	74 09                	je     80227b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802272:	0f b6 07             	movzbl (%rdi),%eax
+  802275:	0f b6 16             	movzbl (%rsi),%edx
+  802278:	29 d0                	sub    %edx,%eax
+  80227a:	c3                   	ret
+    if (!n) return 0;
+  80227b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802280:	c3                   	ret
+
+0000000000802281 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802281:	0f b6 17             	movzbl (%rdi),%edx
+  802284:	84 d2                	test   %dl,%dl
+  802286:	74 18                	je     8022a0 <strchr+0x1f>
+        if (*str == c) {
+  802288:	0f be d2             	movsbl %dl,%edx
+  80228b:	39 f2                	cmp    %esi,%edx
+  80228d:	74 17                	je     8022a6 <strchr+0x25>
+    for (; *str; str++) {
+  80228f:	48 83 c7 01          	add    $0x1,%rdi
+  802293:	0f b6 17             	movzbl (%rdi),%edx
+  802296:	84 d2                	test   %dl,%dl
+  802298:	75 ee                	jne    802288 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80229a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229f:	c3                   	ret
+  8022a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a5:	c3                   	ret
+  8022a6:	48 89 f8             	mov    %rdi,%rax
+}
+  8022a9:	c3                   	ret
+
+00000000008022aa <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8022aa:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8022ad:	0f b6 17             	movzbl (%rdi),%edx
+  8022b0:	84 d2                	test   %dl,%dl
+  8022b2:	74 13                	je     8022c7 <strfind+0x1d>
+  8022b4:	0f be d2             	movsbl %dl,%edx
+  8022b7:	39 f2                	cmp    %esi,%edx
+  8022b9:	74 0b                	je     8022c6 <strfind+0x1c>
+  8022bb:	48 83 c0 01          	add    $0x1,%rax
+  8022bf:	0f b6 10             	movzbl (%rax),%edx
+  8022c2:	84 d2                	test   %dl,%dl
+  8022c4:	75 ee                	jne    8022b4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8022c6:	c3                   	ret
+  8022c7:	c3                   	ret
+
+00000000008022c8 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8022c8:	48 39 f7             	cmp    %rsi,%rdi
+  8022cb:	74 65                	je     802332 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8022cd:	55                   	push   %rbp
+  8022ce:	48 89 e5             	mov    %rsp,%rbp
+  8022d1:	41 57                	push   %r15
+  8022d3:	41 56                	push   %r14
+  8022d5:	41 55                	push   %r13
+  8022d7:	41 54                	push   %r12
+  8022d9:	53                   	push   %rbx
+  8022da:	48 83 ec 18          	sub    $0x18,%rsp
+  8022de:	48 89 fb             	mov    %rdi,%rbx
+  8022e1:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8022e4:	49 bf b9 21 80 00 00 	movabs $0x8021b9,%r15
+  8022eb:	00 00 00 
+  8022ee:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022f2:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022f6:	41 ff d7             	call   *%r15
+  8022f9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022fc:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802301:	41 0f b6 fe          	movzbl %r14b,%edi
+  802305:	41 ff d7             	call   *%r15
+  802308:	89 c2                	mov    %eax,%edx
+  80230a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80230d:	29 d0                	sub    %edx,%eax
+  80230f:	75 12                	jne    802323 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802311:	48 83 c3 01          	add    $0x1,%rbx
+  802315:	45 84 ed             	test   %r13b,%r13b
+  802318:	74 09                	je     802323 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80231a:	49 83 c4 01          	add    $0x1,%r12
+  80231e:	45 84 f6             	test   %r14b,%r14b
+  802321:	75 cb                	jne    8022ee <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802323:	48 83 c4 18          	add    $0x18,%rsp
+  802327:	5b                   	pop    %rbx
+  802328:	41 5c                	pop    %r12
+  80232a:	41 5d                	pop    %r13
+  80232c:	41 5e                	pop    %r14
+  80232e:	41 5f                	pop    %r15
+  802330:	5d                   	pop    %rbp
+  802331:	c3                   	ret
+    if (p1 == p2) return 0;
+  802332:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802337:	c3                   	ret
+
+0000000000802338 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802338:	48 39 f7             	cmp    %rsi,%rdi
+  80233b:	74 7d                	je     8023ba <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80233d:	55                   	push   %rbp
+  80233e:	48 89 e5             	mov    %rsp,%rbp
+  802341:	41 57                	push   %r15
+  802343:	41 56                	push   %r14
+  802345:	41 55                	push   %r13
+  802347:	41 54                	push   %r12
+  802349:	53                   	push   %rbx
+  80234a:	48 83 ec 18          	sub    $0x18,%rsp
+  80234e:	48 89 fb             	mov    %rdi,%rbx
+  802351:	49 89 f4             	mov    %rsi,%r12
+  802354:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802358:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80235c:	49 bf b9 21 80 00 00 	movabs $0x8021b9,%r15
+  802363:	00 00 00 
+    while (n--) {
+  802366:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80236a:	48 39 c3             	cmp    %rax,%rbx
+  80236d:	74 37                	je     8023a6 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80236f:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802373:	41 0f b6 fd          	movzbl %r13b,%edi
+  802377:	41 ff d7             	call   *%r15
+  80237a:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80237d:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802382:	41 0f b6 fe          	movzbl %r14b,%edi
+  802386:	41 ff d7             	call   *%r15
+  802389:	89 c2                	mov    %eax,%edx
+  80238b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80238e:	29 d0                	sub    %edx,%eax
+  802390:	75 19                	jne    8023ab <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802392:	48 83 c3 01          	add    $0x1,%rbx
+  802396:	45 84 ed             	test   %r13b,%r13b
+  802399:	74 10                	je     8023ab <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80239b:	49 83 c4 01          	add    $0x1,%r12
+  80239f:	45 84 f6             	test   %r14b,%r14b
+  8023a2:	75 c2                	jne    802366 <strncasecmp+0x2e>
+  8023a4:	eb 05                	jmp    8023ab <strncasecmp+0x73>
+  8023a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8023ab:	48 83 c4 18          	add    $0x18,%rsp
+  8023af:	5b                   	pop    %rbx
+  8023b0:	41 5c                	pop    %r12
+  8023b2:	41 5d                	pop    %r13
+  8023b4:	41 5e                	pop    %r14
+  8023b6:	41 5f                	pop    %r15
+  8023b8:	5d                   	pop    %rbp
+  8023b9:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023bf:	c3                   	ret
+
+00000000008023c0 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8023c0:	83 e7 df             	and    $0xffffffdf,%edi
+  8023c3:	83 ef 41             	sub    $0x41,%edi
+  8023c6:	83 ff 19             	cmp    $0x19,%edi
+  8023c9:	0f 96 c0             	setbe  %al
+}
+  8023cc:	c3                   	ret
+
+00000000008023cd <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8023cd:	83 ff 20             	cmp    $0x20,%edi
+  8023d0:	0f 94 c0             	sete   %al
+  8023d3:	83 ff 09             	cmp    $0x9,%edi
+  8023d6:	0f 94 c2             	sete   %dl
+  8023d9:	09 d0                	or     %edx,%eax
+}
+  8023db:	c3                   	ret
+
+00000000008023dc <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8023e2:	48 bf bf 62 80 00 00 	movabs $0x8062bf,%rdi
+  8023e9:	00 00 00 
+  8023ec:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  8023f3:	00 00 00 
+  8023f6:	ff d0                	call   *%rax
+  8023f8:	48 85 c0             	test   %rax,%rax
+  8023fb:	0f 95 c0             	setne  %al
+}
+  8023fe:	5d                   	pop    %rbp
+  8023ff:	c3                   	ret
+
+0000000000802400 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802400:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802403:	48 89 f8             	mov    %rdi,%rax
+  802406:	48 f7 d8             	neg    %rax
+  802409:	83 e0 07             	and    $0x7,%eax
+  80240c:	49 89 d1             	mov    %rdx,%r9
+  80240f:	49 29 c1             	sub    %rax,%r9
+  802412:	78 36                	js     80244a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802414:	40 0f b6 c6          	movzbl %sil,%eax
+  802418:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80241f:	01 01 01 
+  802422:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802426:	40 f6 c7 07          	test   $0x7,%dil
+  80242a:	75 38                	jne    802464 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80242c:	4c 89 c9             	mov    %r9,%rcx
+  80242f:	48 c1 f9 03          	sar    $0x3,%rcx
+  802433:	74 0c                	je     802441 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802435:	fc                   	cld
+  802436:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802439:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80243d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802441:	4d 85 c9             	test   %r9,%r9
+  802444:	75 45                	jne    80248b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802446:	4c 89 c0             	mov    %r8,%rax
+  802449:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80244a:	48 85 d2             	test   %rdx,%rdx
+  80244d:	74 f7                	je     802446 <memset+0x46>
+  80244f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802452:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802455:	48 83 c0 01          	add    $0x1,%rax
+  802459:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80245d:	48 39 c2             	cmp    %rax,%rdx
+  802460:	75 f3                	jne    802455 <memset+0x55>
+  802462:	eb e2                	jmp    802446 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802464:	40 f6 c7 01          	test   $0x1,%dil
+  802468:	74 06                	je     802470 <memset+0x70>
+  80246a:	88 07                	mov    %al,(%rdi)
+  80246c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802470:	40 f6 c7 02          	test   $0x2,%dil
+  802474:	74 07                	je     80247d <memset+0x7d>
+  802476:	66 89 07             	mov    %ax,(%rdi)
+  802479:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80247d:	40 f6 c7 04          	test   $0x4,%dil
+  802481:	74 a9                	je     80242c <memset+0x2c>
+  802483:	89 07                	mov    %eax,(%rdi)
+  802485:	48 83 c7 04          	add    $0x4,%rdi
+  802489:	eb a1                	jmp    80242c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80248b:	41 f6 c1 04          	test   $0x4,%r9b
+  80248f:	74 06                	je     802497 <memset+0x97>
+  802491:	89 07                	mov    %eax,(%rdi)
+  802493:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802497:	41 f6 c1 02          	test   $0x2,%r9b
+  80249b:	74 07                	je     8024a4 <memset+0xa4>
+  80249d:	66 89 07             	mov    %ax,(%rdi)
+  8024a0:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8024a4:	41 f6 c1 01          	test   $0x1,%r9b
+  8024a8:	74 9c                	je     802446 <memset+0x46>
+  8024aa:	88 07                	mov    %al,(%rdi)
+  8024ac:	eb 98                	jmp    802446 <memset+0x46>
+
+00000000008024ae <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8024ae:	48 89 f8             	mov    %rdi,%rax
+  8024b1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8024b4:	48 39 fe             	cmp    %rdi,%rsi
+  8024b7:	73 3b                	jae    8024f4 <memmove+0x46>
+  8024b9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8024bd:	48 39 d7             	cmp    %rdx,%rdi
+  8024c0:	73 32                	jae    8024f4 <memmove+0x46>
+        s += n;
+        d += n;
+  8024c2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8024c6:	48 89 d6             	mov    %rdx,%rsi
+  8024c9:	48 09 fe             	or     %rdi,%rsi
+  8024cc:	48 09 ce             	or     %rcx,%rsi
+  8024cf:	40 f6 c6 07          	test   $0x7,%sil
+  8024d3:	75 12                	jne    8024e7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8024d5:	48 83 ef 08          	sub    $0x8,%rdi
+  8024d9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8024dd:	48 c1 e9 03          	shr    $0x3,%rcx
+  8024e1:	fd                   	std
+  8024e2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8024e5:	fc                   	cld
+  8024e6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8024e7:	48 83 ef 01          	sub    $0x1,%rdi
+  8024eb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8024ef:	fd                   	std
+  8024f0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8024f2:	eb f1                	jmp    8024e5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8024f4:	48 89 f2             	mov    %rsi,%rdx
+  8024f7:	48 09 c2             	or     %rax,%rdx
+  8024fa:	48 09 ca             	or     %rcx,%rdx
+  8024fd:	f6 c2 07             	test   $0x7,%dl
+  802500:	75 0c                	jne    80250e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802502:	48 c1 e9 03          	shr    $0x3,%rcx
+  802506:	48 89 c7             	mov    %rax,%rdi
+  802509:	fc                   	cld
+  80250a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80250d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80250e:	48 89 c7             	mov    %rax,%rdi
+  802511:	fc                   	cld
+  802512:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802514:	c3                   	ret
+
+0000000000802515 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802515:	55                   	push   %rbp
+  802516:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802519:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  802520:	00 00 00 
+  802523:	ff d0                	call   *%rax
+}
+  802525:	5d                   	pop    %rbp
+  802526:	c3                   	ret
+
+0000000000802527 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802527:	55                   	push   %rbp
+  802528:	48 89 e5             	mov    %rsp,%rbp
+  80252b:	41 57                	push   %r15
+  80252d:	41 56                	push   %r14
+  80252f:	41 55                	push   %r13
+  802531:	41 54                	push   %r12
+  802533:	53                   	push   %rbx
+  802534:	48 83 ec 08          	sub    $0x8,%rsp
+  802538:	49 89 fe             	mov    %rdi,%r14
+  80253b:	49 89 f7             	mov    %rsi,%r15
+  80253e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802541:	48 89 f7             	mov    %rsi,%rdi
+  802544:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+  802550:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802553:	48 89 de             	mov    %rbx,%rsi
+  802556:	4c 89 f7             	mov    %r14,%rdi
+  802559:	48 b8 3b 21 80 00 00 	movabs $0x80213b,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+  802565:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802568:	48 39 c3             	cmp    %rax,%rbx
+  80256b:	74 36                	je     8025a3 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80256d:	48 89 d8             	mov    %rbx,%rax
+  802570:	4c 29 e8             	sub    %r13,%rax
+  802573:	49 39 c4             	cmp    %rax,%r12
+  802576:	73 31                	jae    8025a9 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802578:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80257d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802581:	4c 89 fe             	mov    %r15,%rsi
+  802584:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  80258b:	00 00 00 
+  80258e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802590:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802594:	48 83 c4 08          	add    $0x8,%rsp
+  802598:	5b                   	pop    %rbx
+  802599:	41 5c                	pop    %r12
+  80259b:	41 5d                	pop    %r13
+  80259d:	41 5e                	pop    %r14
+  80259f:	41 5f                	pop    %r15
+  8025a1:	5d                   	pop    %rbp
+  8025a2:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025a3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8025a7:	eb eb                	jmp    802594 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8025a9:	48 83 eb 01          	sub    $0x1,%rbx
+  8025ad:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8025b1:	48 89 da             	mov    %rbx,%rdx
+  8025b4:	4c 89 fe             	mov    %r15,%rsi
+  8025b7:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8025be:	00 00 00 
+  8025c1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8025c3:	49 01 de             	add    %rbx,%r14
+  8025c6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8025cb:	eb c3                	jmp    802590 <strlcat+0x69>
+
+00000000008025cd <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8025cd:	48 85 d2             	test   %rdx,%rdx
+  8025d0:	74 2d                	je     8025ff <memcmp+0x32>
+  8025d2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8025d7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8025db:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8025e0:	44 38 c1             	cmp    %r8b,%cl
+  8025e3:	75 0f                	jne    8025f4 <memcmp+0x27>
+    while (n-- > 0) {
+  8025e5:	48 83 c0 01          	add    $0x1,%rax
+  8025e9:	48 39 c2             	cmp    %rax,%rdx
+  8025ec:	75 e9                	jne    8025d7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8025ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8025f4:	0f b6 c1             	movzbl %cl,%eax
+  8025f7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8025fb:	44 29 c0             	sub    %r8d,%eax
+  8025fe:	c3                   	ret
+    return 0;
+  8025ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802604:	c3                   	ret
+
+0000000000802605 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802605:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802609:	48 39 c7             	cmp    %rax,%rdi
+  80260c:	73 0f                	jae    80261d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80260e:	40 38 37             	cmp    %sil,(%rdi)
+  802611:	74 0e                	je     802621 <memfind+0x1c>
+    for (; src < end; src++) {
+  802613:	48 83 c7 01          	add    $0x1,%rdi
+  802617:	48 39 f8             	cmp    %rdi,%rax
+  80261a:	75 f2                	jne    80260e <memfind+0x9>
+  80261c:	c3                   	ret
+  80261d:	48 89 f8             	mov    %rdi,%rax
+  802620:	c3                   	ret
+  802621:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802624:	c3                   	ret
+
+0000000000802625 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802625:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802628:	0f b6 37             	movzbl (%rdi),%esi
+  80262b:	40 80 fe 20          	cmp    $0x20,%sil
+  80262f:	74 06                	je     802637 <strtol+0x12>
+  802631:	40 80 fe 09          	cmp    $0x9,%sil
+  802635:	75 13                	jne    80264a <strtol+0x25>
+  802637:	48 83 c7 01          	add    $0x1,%rdi
+  80263b:	0f b6 37             	movzbl (%rdi),%esi
+  80263e:	40 80 fe 20          	cmp    $0x20,%sil
+  802642:	74 f3                	je     802637 <strtol+0x12>
+  802644:	40 80 fe 09          	cmp    $0x9,%sil
+  802648:	74 ed                	je     802637 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80264a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80264d:	83 e0 fd             	and    $0xfffffffd,%eax
+  802650:	3c 01                	cmp    $0x1,%al
+  802652:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802656:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80265c:	75 0f                	jne    80266d <strtol+0x48>
+  80265e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802661:	74 14                	je     802677 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802663:	85 d2                	test   %edx,%edx
+  802665:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80266a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80266d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802672:	4c 63 ca             	movslq %edx,%r9
+  802675:	eb 36                	jmp    8026ad <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802677:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80267b:	74 0f                	je     80268c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80267d:	85 d2                	test   %edx,%edx
+  80267f:	75 ec                	jne    80266d <strtol+0x48>
+        s++;
+  802681:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802685:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80268a:	eb e1                	jmp    80266d <strtol+0x48>
+        s += 2;
+  80268c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802690:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802695:	eb d6                	jmp    80266d <strtol+0x48>
+            dig -= '0';
+  802697:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80269a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80269e:	41 39 d0             	cmp    %edx,%r8d
+  8026a1:	7d 21                	jge    8026c4 <strtol+0x9f>
+        val = val * base + dig;
+  8026a3:	49 0f af c1          	imul   %r9,%rax
+  8026a7:	0f b6 c9             	movzbl %cl,%ecx
+  8026aa:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8026ad:	48 83 c7 01          	add    $0x1,%rdi
+  8026b1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8026b5:	80 f9 39             	cmp    $0x39,%cl
+  8026b8:	76 dd                	jbe    802697 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8026ba:	80 f9 7b             	cmp    $0x7b,%cl
+  8026bd:	77 05                	ja     8026c4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8026bf:	83 e9 57             	sub    $0x57,%ecx
+  8026c2:	eb d6                	jmp    80269a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8026c4:	4d 85 d2             	test   %r10,%r10
+  8026c7:	74 03                	je     8026cc <strtol+0xa7>
+  8026c9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8026cc:	48 89 c2             	mov    %rax,%rdx
+  8026cf:	48 f7 da             	neg    %rdx
+  8026d2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8026d6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8026da:	c3                   	ret
+
+00000000008026db <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8026db:	55                   	push   %rbp
+  8026dc:	48 89 e5             	mov    %rsp,%rbp
+  8026df:	53                   	push   %rbx
+  8026e0:	48 89 fa             	mov    %rdi,%rdx
+  8026e3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026e6:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802700:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802706:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802708:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80270c:	c9                   	leave
+  80270d:	c3                   	ret
+
+000000000080270e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80270e:	55                   	push   %rbp
+  80270f:	48 89 e5             	mov    %rsp,%rbp
+  802712:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802713:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802718:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802722:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802727:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80272c:	be 00 00 00 00       	mov    $0x0,%esi
+  802731:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802737:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80273d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80273f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802743:	c9                   	leave
+  802744:	c3                   	ret
+
+0000000000802745 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802745:	55                   	push   %rbp
+  802746:	48 89 e5             	mov    %rsp,%rbp
+  802749:	53                   	push   %rbx
+  80274a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80274d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802752:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802757:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80275c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802761:	be 00 00 00 00       	mov    $0x0,%esi
+  802766:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80276c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802772:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802774:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802778:	c9                   	leave
+  802779:	c3                   	ret
+
+000000000080277a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80277a:	55                   	push   %rbp
+  80277b:	48 89 e5             	mov    %rsp,%rbp
+  80277e:	53                   	push   %rbx
+  80277f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802783:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802786:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80278b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802790:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802795:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80279a:	be 00 00 00 00       	mov    $0x0,%esi
+  80279f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027ad:	48 85 c0             	test   %rax,%rax
+  8027b0:	7f 06                	jg     8027b8 <sys_env_destroy+0x3e>
+}
+  8027b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027b6:	c9                   	leave
+  8027b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027b8:	49 89 c0             	mov    %rax,%r8
+  8027bb:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8027c0:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  8027c7:	00 00 00 
+  8027ca:	be 27 00 00 00       	mov    $0x27,%esi
+  8027cf:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  8027d6:	00 00 00 
+  8027d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027de:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  8027e5:	00 00 00 
+  8027e8:	41 ff d1             	call   *%r9
+
+00000000008027eb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8027eb:	55                   	push   %rbp
+  8027ec:	48 89 e5             	mov    %rsp,%rbp
+  8027ef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027f0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802804:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802809:	be 00 00 00 00       	mov    $0x0,%esi
+  80280e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802814:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80281a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80281c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802820:	c9                   	leave
+  802821:	c3                   	ret
+
+0000000000802822 <sys_yield>:
+
+void
+sys_yield(void) {
+  802822:	55                   	push   %rbp
+  802823:	48 89 e5             	mov    %rsp,%rbp
+  802826:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802827:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80282c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802831:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802836:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80283b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802840:	be 00 00 00 00       	mov    $0x0,%esi
+  802845:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80284b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802851:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802853:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802857:	c9                   	leave
+  802858:	c3                   	ret
+
+0000000000802859 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802859:	55                   	push   %rbp
+  80285a:	48 89 e5             	mov    %rsp,%rbp
+  80285d:	53                   	push   %rbx
+  80285e:	48 89 fa             	mov    %rdi,%rdx
+  802861:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802864:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802869:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802870:	00 00 00 
+  802873:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802878:	be 00 00 00 00       	mov    $0x0,%esi
+  80287d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802883:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802889:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80288b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80288f:	c9                   	leave
+  802890:	c3                   	ret
+
+0000000000802891 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802891:	55                   	push   %rbp
+  802892:	48 89 e5             	mov    %rsp,%rbp
+  802895:	53                   	push   %rbx
+  802896:	49 89 f8             	mov    %rdi,%r8
+  802899:	48 89 d3             	mov    %rdx,%rbx
+  80289c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80289f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028a4:	4c 89 c2             	mov    %r8,%rdx
+  8028a7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8028af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028bb:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8028bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c1:	c9                   	leave
+  8028c2:	c3                   	ret
+
+00000000008028c3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8028c3:	55                   	push   %rbp
+  8028c4:	48 89 e5             	mov    %rsp,%rbp
+  8028c7:	53                   	push   %rbx
+  8028c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028cc:	89 f8                	mov    %edi,%eax
+  8028ce:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8028d1:	48 63 f9             	movslq %ecx,%rdi
+  8028d4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028d7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028dc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028df:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028f2:	48 85 c0             	test   %rax,%rax
+  8028f5:	7f 06                	jg     8028fd <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8028f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028fb:	c9                   	leave
+  8028fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028fd:	49 89 c0             	mov    %rax,%r8
+  802900:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802905:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  80290c:	00 00 00 
+  80290f:	be 27 00 00 00       	mov    $0x27,%esi
+  802914:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  80291b:	00 00 00 
+  80291e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802923:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  80292a:	00 00 00 
+  80292d:	41 ff d1             	call   *%r9
+
+0000000000802930 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802930:	55                   	push   %rbp
+  802931:	48 89 e5             	mov    %rsp,%rbp
+  802934:	53                   	push   %rbx
+  802935:	48 83 ec 08          	sub    $0x8,%rsp
+  802939:	89 f8                	mov    %edi,%eax
+  80293b:	49 89 f2             	mov    %rsi,%r10
+  80293e:	48 89 cf             	mov    %rcx,%rdi
+  802941:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802944:	48 63 da             	movslq %edx,%rbx
+  802947:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80294a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80294f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802952:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802955:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80295b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80295d:	48 85 c0             	test   %rax,%rax
+  802960:	7f 06                	jg     802968 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802962:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802968:	49 89 c0             	mov    %rax,%r8
+  80296b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802970:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802977:	00 00 00 
+  80297a:	be 27 00 00 00       	mov    $0x27,%esi
+  80297f:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802986:	00 00 00 
+  802989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298e:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802995:	00 00 00 
+  802998:	41 ff d1             	call   *%r9
+
+000000000080299b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80299b:	55                   	push   %rbp
+  80299c:	48 89 e5             	mov    %rsp,%rbp
+  80299f:	53                   	push   %rbx
+  8029a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a4:	48 89 f1             	mov    %rsi,%rcx
+  8029a7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8029aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029ad:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029ca:	48 85 c0             	test   %rax,%rax
+  8029cd:	7f 06                	jg     8029d5 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8029cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029d3:	c9                   	leave
+  8029d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029d5:	49 89 c0             	mov    %rax,%r8
+  8029d8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029dd:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  8029e4:	00 00 00 
+  8029e7:	be 27 00 00 00       	mov    $0x27,%esi
+  8029ec:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  8029f3:	00 00 00 
+  8029f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029fb:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802a02:	00 00 00 
+  802a05:	41 ff d1             	call   *%r9
+
+0000000000802a08 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a08:	55                   	push   %rbp
+  802a09:	48 89 e5             	mov    %rsp,%rbp
+  802a0c:	53                   	push   %rbx
+  802a0d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802a11:	48 63 ce             	movslq %esi,%rcx
+  802a14:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a17:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a21:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a26:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a37:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a39:	48 85 c0             	test   %rax,%rax
+  802a3c:	7f 06                	jg     802a44 <sys_env_set_status+0x3c>
+}
+  802a3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a44:	49 89 c0             	mov    %rax,%r8
+  802a47:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802a4c:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802a53:	00 00 00 
+  802a56:	be 27 00 00 00       	mov    $0x27,%esi
+  802a5b:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802a62:	00 00 00 
+  802a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6a:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802a71:	00 00 00 
+  802a74:	41 ff d1             	call   *%r9
+
+0000000000802a77 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802a77:	55                   	push   %rbp
+  802a78:	48 89 e5             	mov    %rsp,%rbp
+  802a7b:	53                   	push   %rbx
+  802a7c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a80:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802a83:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a86:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a90:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a95:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aa0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aa6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802aa8:	48 85 c0             	test   %rax,%rax
+  802aab:	7f 06                	jg     802ab3 <sys_env_set_trapframe+0x3c>
+}
+  802aad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ab1:	c9                   	leave
+  802ab2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ab3:	49 89 c0             	mov    %rax,%r8
+  802ab6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802abb:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802ac2:	00 00 00 
+  802ac5:	be 27 00 00 00       	mov    $0x27,%esi
+  802aca:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802ad1:	00 00 00 
+  802ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad9:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802ae0:	00 00 00 
+  802ae3:	41 ff d1             	call   *%r9
+
+0000000000802ae6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802ae6:	55                   	push   %rbp
+  802ae7:	48 89 e5             	mov    %rsp,%rbp
+  802aea:	53                   	push   %rbx
+  802aeb:	48 83 ec 08          	sub    $0x8,%rsp
+  802aef:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802af2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802af5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802afa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b04:	be 00 00 00 00       	mov    $0x0,%esi
+  802b09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b15:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b17:	48 85 c0             	test   %rax,%rax
+  802b1a:	7f 06                	jg     802b22 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802b1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b20:	c9                   	leave
+  802b21:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b22:	49 89 c0             	mov    %rax,%r8
+  802b25:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802b2a:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802b31:	00 00 00 
+  802b34:	be 27 00 00 00       	mov    $0x27,%esi
+  802b39:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802b40:	00 00 00 
+  802b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b48:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802b4f:	00 00 00 
+  802b52:	41 ff d1             	call   *%r9
+
+0000000000802b55 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802b55:	55                   	push   %rbp
+  802b56:	48 89 e5             	mov    %rsp,%rbp
+  802b59:	53                   	push   %rbx
+  802b5a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802b5e:	40 0f b6 ce          	movzbl %sil,%ecx
+  802b62:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b65:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b6f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b74:	be 00 00 00 00       	mov    $0x0,%esi
+  802b79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b85:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b87:	48 85 c0             	test   %rax,%rax
+  802b8a:	7f 06                	jg     802b92 <sys_env_set_reclaim+0x3d>
+}
+  802b8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b92:	49 89 c0             	mov    %rax,%r8
+  802b95:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802b9a:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802ba1:	00 00 00 
+  802ba4:	be 27 00 00 00       	mov    $0x27,%esi
+  802ba9:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802bb0:	00 00 00 
+  802bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb8:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802bbf:	00 00 00 
+  802bc2:	41 ff d1             	call   *%r9
+
+0000000000802bc5 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802bc5:	55                   	push   %rbp
+  802bc6:	48 89 e5             	mov    %rsp,%rbp
+  802bc9:	53                   	push   %rbx
+  802bca:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802bce:	48 63 ce             	movslq %esi,%rcx
+  802bd1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bd4:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bde:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be3:	be 00 00 00 00       	mov    $0x0,%esi
+  802be8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bf4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bf6:	48 85 c0             	test   %rax,%rax
+  802bf9:	7f 06                	jg     802c01 <sys_env_set_nice+0x3c>
+}
+  802bfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bff:	c9                   	leave
+  802c00:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c01:	49 89 c0             	mov    %rax,%r8
+  802c04:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802c09:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802c10:	00 00 00 
+  802c13:	be 27 00 00 00       	mov    $0x27,%esi
+  802c18:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802c1f:	00 00 00 
+  802c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c27:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802c2e:	00 00 00 
+  802c31:	41 ff d1             	call   *%r9
+
+0000000000802c34 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802c34:	55                   	push   %rbp
+  802c35:	48 89 e5             	mov    %rsp,%rbp
+  802c38:	53                   	push   %rbx
+  802c39:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c3c:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c41:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c4b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c50:	be 00 00 00 00       	mov    $0x0,%esi
+  802c55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c61:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802c63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c67:	c9                   	leave
+  802c68:	c3                   	ret
+
+0000000000802c69 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c69:	55                   	push   %rbp
+  802c6a:	48 89 e5             	mov    %rsp,%rbp
+  802c6d:	53                   	push   %rbx
+  802c6e:	89 f8                	mov    %edi,%eax
+  802c70:	49 89 f1             	mov    %rsi,%r9
+  802c73:	48 89 d3             	mov    %rdx,%rbx
+  802c76:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c79:	49 63 f0             	movslq %r8d,%rsi
+  802c7c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c7f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c84:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c93:	cd 30                	int    $0x30
+}
+  802c95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c99:	c9                   	leave
+  802c9a:	c3                   	ret
+
+0000000000802c9b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c9b:	55                   	push   %rbp
+  802c9c:	48 89 e5             	mov    %rsp,%rbp
+  802c9f:	53                   	push   %rbx
+  802ca0:	89 f8                	mov    %edi,%eax
+  802ca2:	49 89 f1             	mov    %rsi,%r9
+  802ca5:	48 89 d3             	mov    %rdx,%rbx
+  802ca8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802cab:	49 63 f0             	movslq %r8d,%rsi
+  802cae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cb6:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cbf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cc5:	cd 30                	int    $0x30
+}
+  802cc7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ccb:	c9                   	leave
+  802ccc:	c3                   	ret
+
+0000000000802ccd <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802ccd:	55                   	push   %rbp
+  802cce:	48 89 e5             	mov    %rsp,%rbp
+  802cd1:	53                   	push   %rbx
+  802cd2:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd6:	89 f8                	mov    %edi,%eax
+  802cd8:	49 89 f2             	mov    %rsi,%r10
+  802cdb:	48 89 d3             	mov    %rdx,%rbx
+  802cde:	48 89 cf             	mov    %rcx,%rdi
+  802ce1:	44 89 c6             	mov    %r8d,%esi
+  802ce4:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802ce7:	48 63 f6             	movslq %esi,%rsi
+  802cea:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ced:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cf2:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802cf5:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802cf9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cfb:	48 85 c0             	test   %rax,%rax
+  802cfe:	7f 06                	jg     802d06 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d06:	49 89 c0             	mov    %rax,%r8
+  802d09:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802d0e:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802d15:	00 00 00 
+  802d18:	be 27 00 00 00       	mov    $0x27,%esi
+  802d1d:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802d24:	00 00 00 
+  802d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2c:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802d33:	00 00 00 
+  802d36:	41 ff d1             	call   *%r9
+
+0000000000802d39 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802d39:	55                   	push   %rbp
+  802d3a:	48 89 e5             	mov    %rsp,%rbp
+  802d3d:	53                   	push   %rbx
+  802d3e:	48 83 ec 08          	sub    $0x8,%rsp
+  802d42:	48 89 f1             	mov    %rsi,%rcx
+  802d45:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802d48:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802d4c:	48 8b 1a             	mov    (%rdx),%rbx
+  802d4f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d52:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d57:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5b:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802d5f:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802d63:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d65:	48 85 c0             	test   %rax,%rax
+  802d68:	7f 06                	jg     802d70 <sys_ipc_call_short+0x37>
+}
+  802d6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d6e:	c9                   	leave
+  802d6f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d70:	49 89 c0             	mov    %rax,%r8
+  802d73:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802d78:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802d7f:	00 00 00 
+  802d82:	be 27 00 00 00       	mov    $0x27,%esi
+  802d87:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802d8e:	00 00 00 
+  802d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d96:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802d9d:	00 00 00 
+  802da0:	41 ff d1             	call   *%r9
+
+0000000000802da3 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802da3:	55                   	push   %rbp
+  802da4:	48 89 e5             	mov    %rsp,%rbp
+  802da7:	53                   	push   %rbx
+  802da8:	48 83 ec 08          	sub    $0x8,%rsp
+  802dac:	89 f8                	mov    %edi,%eax
+  802dae:	49 89 f2             	mov    %rsi,%r10
+  802db1:	48 89 d3             	mov    %rdx,%rbx
+  802db4:	48 89 cf             	mov    %rcx,%rdi
+  802db7:	44 89 c6             	mov    %r8d,%esi
+  802dba:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802dbd:	48 63 f6             	movslq %esi,%rsi
+  802dc0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dc3:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dc8:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802dcb:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802dcf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dd1:	48 85 c0             	test   %rax,%rax
+  802dd4:	7f 06                	jg     802ddc <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802dd6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dda:	c9                   	leave
+  802ddb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ddc:	49 89 c0             	mov    %rax,%r8
+  802ddf:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802de4:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802deb:	00 00 00 
+  802dee:	be 27 00 00 00       	mov    $0x27,%esi
+  802df3:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802dfa:	00 00 00 
+  802dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e02:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802e09:	00 00 00 
+  802e0c:	41 ff d1             	call   *%r9
+
+0000000000802e0f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802e0f:	55                   	push   %rbp
+  802e10:	48 89 e5             	mov    %rsp,%rbp
+  802e13:	53                   	push   %rbx
+  802e14:	48 83 ec 08          	sub    $0x8,%rsp
+  802e18:	48 89 fa             	mov    %rdi,%rdx
+  802e1b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802e1e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e28:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e38:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e3e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e40:	48 85 c0             	test   %rax,%rax
+  802e43:	7f 06                	jg     802e4b <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e49:	c9                   	leave
+  802e4a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e4b:	49 89 c0             	mov    %rax,%r8
+  802e4e:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802e53:	48 ba c8 62 80 00 00 	movabs $0x8062c8,%rdx
+  802e5a:	00 00 00 
+  802e5d:	be 27 00 00 00       	mov    $0x27,%esi
+  802e62:	48 bf e7 62 80 00 00 	movabs $0x8062e7,%rdi
+  802e69:	00 00 00 
+  802e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e71:	49 b9 d7 16 80 00 00 	movabs $0x8016d7,%r9
+  802e78:	00 00 00 
+  802e7b:	41 ff d1             	call   *%r9
+
+0000000000802e7e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802e7e:	55                   	push   %rbp
+  802e7f:	48 89 e5             	mov    %rsp,%rbp
+  802e82:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e83:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e97:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e9c:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ea7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ead:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802eaf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eb3:	c9                   	leave
+  802eb4:	c3                   	ret
+
+0000000000802eb5 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802eb5:	55                   	push   %rbp
+  802eb6:	48 89 e5             	mov    %rsp,%rbp
+  802eb9:	53                   	push   %rbx
+  802eba:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ebd:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ec2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ec7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ecc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ed1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802edc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ee2:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802ee4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ee8:	c9                   	leave
+  802ee9:	c3                   	ret
+
+0000000000802eea <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802eea:	55                   	push   %rbp
+  802eeb:	48 89 e5             	mov    %rsp,%rbp
+  802eee:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802eef:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ef9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f03:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f08:	be 00 00 00 00       	mov    $0x0,%esi
+  802f0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f13:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f19:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f1b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f1f:	c9                   	leave
+  802f20:	c3                   	ret
+
+0000000000802f21 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  802f21:	55                   	push   %rbp
+  802f22:	48 89 e5             	mov    %rsp,%rbp
+  802f25:	41 56                	push   %r14
+  802f27:	41 55                	push   %r13
+  802f29:	41 54                	push   %r12
+  802f2b:	53                   	push   %rbx
+  802f2c:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802f2f:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  802f36:	00 00 00 
+  802f39:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802f3d:	74 27                	je     802f66 <_handle_vectored_pagefault+0x45>
+  802f3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802f44:	49 bd 40 80 80 01 00 	movabs $0x1808040,%r13
+  802f4b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802f4e:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  802f51:	4c 89 e7             	mov    %r12,%rdi
+  802f54:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802f59:	84 c0                	test   %al,%al
+  802f5b:	75 45                	jne    802fa2 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802f5d:	48 83 c3 01          	add    $0x1,%rbx
+  802f61:	49 3b 1e             	cmp    (%r14),%rbx
+  802f64:	72 eb                	jb     802f51 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  802f66:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802f6d:	00 
+  802f6e:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  802f73:	4d 8b 04 24          	mov    (%r12),%r8
+  802f77:	48 ba f8 62 80 00 00 	movabs $0x8062f8,%rdx
+  802f7e:	00 00 00 
+  802f81:	be 1d 00 00 00       	mov    $0x1d,%esi
+  802f86:	48 bf 28 63 80 00 00 	movabs $0x806328,%rdi
+  802f8d:	00 00 00 
+  802f90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f95:	49 ba d7 16 80 00 00 	movabs $0x8016d7,%r10
+  802f9c:	00 00 00 
+  802f9f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  802fa2:	5b                   	pop    %rbx
+  802fa3:	41 5c                	pop    %r12
+  802fa5:	41 5d                	pop    %r13
+  802fa7:	41 5e                	pop    %r14
+  802fa9:	5d                   	pop    %rbp
+  802faa:	c3                   	ret
+
+0000000000802fab <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802fab:	55                   	push   %rbp
+  802fac:	48 89 e5             	mov    %rsp,%rbp
+  802faf:	53                   	push   %rbx
+  802fb0:	48 83 ec 08          	sub    $0x8,%rsp
+  802fb4:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  802fb7:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  802fbc:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  802fc3:	00 00 00 
+  802fc6:	80 38 00             	cmpb   $0x0,(%rax)
+  802fc9:	74 68                	je     803033 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802fcb:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  802fd2:	00 00 00 
+  802fd5:	48 8b 08             	mov    (%rax),%rcx
+  802fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  802fdd:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  802fe4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802fe7:	48 85 c9             	test   %rcx,%rcx
+  802fea:	0f 84 e0 00 00 00    	je     8030d0 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802ff0:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  802ff4:	0f 84 c9 00 00 00    	je     8030c3 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802ffa:	48 83 c2 01          	add    $0x1,%rdx
+  802ffe:	48 39 ca             	cmp    %rcx,%rdx
+  803001:	75 ed                	jne    802ff0 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  803003:	48 83 f9 08          	cmp    $0x8,%rcx
+  803007:	0f 84 84 00 00 00    	je     803091 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80300d:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  803011:	48 a3 88 80 80 01 00 	movabs %rax,0x1808088
+  803018:	00 00 00 
+  80301b:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  803022:	00 00 00 
+  803025:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803029:	85 f6                	test   %esi,%esi
+  80302b:	0f 89 97 00 00 00    	jns    8030c8 <add_pgfault_handler+0x11d>
+  803031:	eb 63                	jmp    803096 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  803033:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803038:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80303d:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  803044:	00 00 00 
+  803047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304c:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  803053:	00 00 00 
+  803056:	ff d0                	call   *%rax
+  803058:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	78 38                	js     803096 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80305e:	48 be ac 31 80 00 00 	movabs $0x8031ac,%rsi
+  803065:	00 00 00 
+  803068:	bf 00 00 00 00       	mov    $0x0,%edi
+  80306d:	48 b8 e6 2a 80 00 00 	movabs $0x802ae6,%rax
+  803074:	00 00 00 
+  803077:	ff d0                	call   *%rax
+  803079:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80307b:	85 c0                	test   %eax,%eax
+  80307d:	78 17                	js     803096 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80307f:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  803086:	00 00 00 
+  803089:	c6 00 01             	movb   $0x1,(%rax)
+  80308c:	e9 3a ff ff ff       	jmp    802fcb <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  803091:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803096:	89 f1                	mov    %esi,%ecx
+  803098:	48 ba 36 63 80 00 00 	movabs $0x806336,%rdx
+  80309f:	00 00 00 
+  8030a2:	be 42 00 00 00       	mov    $0x42,%esi
+  8030a7:	48 bf 28 63 80 00 00 	movabs $0x806328,%rdi
+  8030ae:	00 00 00 
+  8030b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b6:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  8030bd:	00 00 00 
+  8030c0:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8030c3:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8030c8:	89 f0                	mov    %esi,%eax
+  8030ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030ce:	c9                   	leave
+  8030cf:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8030d0:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  8030d7:	00 00 00 
+  8030da:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8030e1:	48 89 d8             	mov    %rbx,%rax
+  8030e4:	48 a3 40 80 80 01 00 	movabs %rax,0x1808040
+  8030eb:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8030ee:	eb d8                	jmp    8030c8 <add_pgfault_handler+0x11d>
+
+00000000008030f0 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8030f0:	55                   	push   %rbp
+  8030f1:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8030f4:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  8030fb:	00 00 00 
+  8030fe:	80 38 00             	cmpb   $0x0,(%rax)
+  803101:	74 33                	je     803136 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803103:	48 a1 88 80 80 01 00 	movabs 0x1808088,%rax
+  80310a:	00 00 00 
+  80310d:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803112:	48 ba 40 80 80 01 00 	movabs $0x1808040,%rdx
+  803119:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80311c:	48 85 c0             	test   %rax,%rax
+  80311f:	0f 84 85 00 00 00    	je     8031aa <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803125:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803129:	74 40                	je     80316b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80312b:	48 83 c1 01          	add    $0x1,%rcx
+  80312f:	48 39 c1             	cmp    %rax,%rcx
+  803132:	75 f1                	jne    803125 <remove_pgfault_handler+0x35>
+  803134:	eb 74                	jmp    8031aa <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803136:	48 b9 4e 63 80 00 00 	movabs $0x80634e,%rcx
+  80313d:	00 00 00 
+  803140:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803147:	00 00 00 
+  80314a:	be 48 00 00 00       	mov    $0x48,%esi
+  80314f:	48 bf 28 63 80 00 00 	movabs $0x806328,%rdi
+  803156:	00 00 00 
+  803159:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315e:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803165:	00 00 00 
+  803168:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80316b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803172:	00 
+  803173:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803177:	48 29 ca             	sub    %rcx,%rdx
+  80317a:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  803181:	00 00 00 
+  803184:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803188:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80318d:	48 89 ce             	mov    %rcx,%rsi
+  803190:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  803197:	00 00 00 
+  80319a:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80319c:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  8031a3:	00 00 00 
+  8031a6:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8031aa:	5d                   	pop    %rbp
+  8031ab:	c3                   	ret
+
+00000000008031ac <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8031ac:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8031af:	48 b8 21 2f 80 00 00 	movabs $0x802f21,%rax
+  8031b6:	00 00 00 
+    call *%rax
+  8031b9:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8031bb:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8031c2:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8031c3:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8031ca:	00 
+    subq $8, %rcx
+  8031cb:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8031cf:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8031d2:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8031d9:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8031da:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8031de:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8031e2:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8031e7:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8031ec:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8031f1:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8031f6:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8031fb:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803200:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  803205:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80320a:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80320f:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  803214:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  803219:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80321e:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  803223:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803228:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80322c:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  803230:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  803231:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803232:	c3                   	ret
+
+0000000000803233 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803233:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80323a:	ff ff ff 
+  80323d:	48 01 f8             	add    %rdi,%rax
+  803240:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803244:	c3                   	ret
+
+0000000000803245 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803245:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80324c:	ff ff ff 
+  80324f:	48 01 f8             	add    %rdi,%rax
+  803252:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803256:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80325c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803260:	c3                   	ret
+
+0000000000803261 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803261:	55                   	push   %rbp
+  803262:	48 89 e5             	mov    %rsp,%rbp
+  803265:	41 57                	push   %r15
+  803267:	41 56                	push   %r14
+  803269:	41 55                	push   %r13
+  80326b:	41 54                	push   %r12
+  80326d:	53                   	push   %rbx
+  80326e:	48 83 ec 08          	sub    $0x8,%rsp
+  803272:	49 89 ff             	mov    %rdi,%r15
+  803275:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80327a:	49 bd 61 47 80 00 00 	movabs $0x804761,%r13
+  803281:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803284:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80328a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80328d:	48 89 df             	mov    %rbx,%rdi
+  803290:	41 ff d5             	call   *%r13
+  803293:	83 e0 04             	and    $0x4,%eax
+  803296:	74 17                	je     8032af <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803298:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80329f:	4c 39 f3             	cmp    %r14,%rbx
+  8032a2:	75 e6                	jne    80328a <fd_alloc+0x29>
+  8032a4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8032aa:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8032af:	4d 89 27             	mov    %r12,(%r15)
+}
+  8032b2:	48 83 c4 08          	add    $0x8,%rsp
+  8032b6:	5b                   	pop    %rbx
+  8032b7:	41 5c                	pop    %r12
+  8032b9:	41 5d                	pop    %r13
+  8032bb:	41 5e                	pop    %r14
+  8032bd:	41 5f                	pop    %r15
+  8032bf:	5d                   	pop    %rbp
+  8032c0:	c3                   	ret
+
+00000000008032c1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8032c1:	83 ff 1f             	cmp    $0x1f,%edi
+  8032c4:	77 39                	ja     8032ff <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8032c6:	55                   	push   %rbp
+  8032c7:	48 89 e5             	mov    %rsp,%rbp
+  8032ca:	41 54                	push   %r12
+  8032cc:	53                   	push   %rbx
+  8032cd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8032d0:	48 63 df             	movslq %edi,%rbx
+  8032d3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8032da:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8032de:	48 89 df             	mov    %rbx,%rdi
+  8032e1:	48 b8 61 47 80 00 00 	movabs $0x804761,%rax
+  8032e8:	00 00 00 
+  8032eb:	ff d0                	call   *%rax
+  8032ed:	a8 04                	test   $0x4,%al
+  8032ef:	74 14                	je     803305 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8032f1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8032f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032fa:	5b                   	pop    %rbx
+  8032fb:	41 5c                	pop    %r12
+  8032fd:	5d                   	pop    %rbp
+  8032fe:	c3                   	ret
+        return -E_INVAL;
+  8032ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803304:	c3                   	ret
+        return -E_INVAL;
+  803305:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80330a:	eb ee                	jmp    8032fa <fd_lookup+0x39>
+
+000000000080330c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80330c:	55                   	push   %rbp
+  80330d:	48 89 e5             	mov    %rsp,%rbp
+  803310:	41 54                	push   %r12
+  803312:	53                   	push   %rbx
+  803313:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803316:	48 b8 00 64 80 00 00 	movabs $0x806400,%rax
+  80331d:	00 00 00 
+  803320:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803327:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80332a:	39 3b                	cmp    %edi,(%rbx)
+  80332c:	74 47                	je     803375 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80332e:	48 83 c0 08          	add    $0x8,%rax
+  803332:	48 8b 18             	mov    (%rax),%rbx
+  803335:	48 85 db             	test   %rbx,%rbx
+  803338:	75 f0                	jne    80332a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80333a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803341:	00 00 00 
+  803344:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80334a:	89 fa                	mov    %edi,%edx
+  80334c:	48 bf 80 63 80 00 00 	movabs $0x806380,%rdi
+  803353:	00 00 00 
+  803356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335b:	48 b9 27 18 80 00 00 	movabs $0x801827,%rcx
+  803362:	00 00 00 
+  803365:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803367:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80336c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803370:	5b                   	pop    %rbx
+  803371:	41 5c                	pop    %r12
+  803373:	5d                   	pop    %rbp
+  803374:	c3                   	ret
+            return 0;
+  803375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80337a:	eb f0                	jmp    80336c <dev_lookup+0x60>
+
+000000000080337c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80337c:	55                   	push   %rbp
+  80337d:	48 89 e5             	mov    %rsp,%rbp
+  803380:	41 55                	push   %r13
+  803382:	41 54                	push   %r12
+  803384:	53                   	push   %rbx
+  803385:	48 83 ec 18          	sub    $0x18,%rsp
+  803389:	48 89 fb             	mov    %rdi,%rbx
+  80338c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80338f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803396:	ff ff ff 
+  803399:	48 01 df             	add    %rbx,%rdi
+  80339c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8033a0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033a4:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8033ab:	00 00 00 
+  8033ae:	ff d0                	call   *%rax
+  8033b0:	41 89 c5             	mov    %eax,%r13d
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	78 06                	js     8033bd <fd_close+0x41>
+  8033b7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8033bb:	74 1a                	je     8033d7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8033bd:	45 84 e4             	test   %r12b,%r12b
+  8033c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8033c9:	44 89 e8             	mov    %r13d,%eax
+  8033cc:	48 83 c4 18          	add    $0x18,%rsp
+  8033d0:	5b                   	pop    %rbx
+  8033d1:	41 5c                	pop    %r12
+  8033d3:	41 5d                	pop    %r13
+  8033d5:	5d                   	pop    %rbp
+  8033d6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8033d7:	8b 3b                	mov    (%rbx),%edi
+  8033d9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033dd:	48 b8 0c 33 80 00 00 	movabs $0x80330c,%rax
+  8033e4:	00 00 00 
+  8033e7:	ff d0                	call   *%rax
+  8033e9:	41 89 c5             	mov    %eax,%r13d
+  8033ec:	85 c0                	test   %eax,%eax
+  8033ee:	78 1b                	js     80340b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8033f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033f4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8033f8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8033fe:	48 85 c0             	test   %rax,%rax
+  803401:	74 08                	je     80340b <fd_close+0x8f>
+  803403:	48 89 df             	mov    %rbx,%rdi
+  803406:	ff d0                	call   *%rax
+  803408:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80340b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803410:	48 89 de             	mov    %rbx,%rsi
+  803413:	bf 00 00 00 00       	mov    $0x0,%edi
+  803418:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  80341f:	00 00 00 
+  803422:	ff d0                	call   *%rax
+    return res;
+  803424:	eb a3                	jmp    8033c9 <fd_close+0x4d>
+
+0000000000803426 <close>:
+
+int
+close(int fdnum) {
+  803426:	55                   	push   %rbp
+  803427:	48 89 e5             	mov    %rsp,%rbp
+  80342a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80342e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803432:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  803439:	00 00 00 
+  80343c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80343e:	85 c0                	test   %eax,%eax
+  803440:	78 15                	js     803457 <close+0x31>
+
+    return fd_close(fd, 1);
+  803442:	be 01 00 00 00       	mov    $0x1,%esi
+  803447:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80344b:	48 b8 7c 33 80 00 00 	movabs $0x80337c,%rax
+  803452:	00 00 00 
+  803455:	ff d0                	call   *%rax
+}
+  803457:	c9                   	leave
+  803458:	c3                   	ret
+
+0000000000803459 <close_all>:
+
+void
+close_all(void) {
+  803459:	55                   	push   %rbp
+  80345a:	48 89 e5             	mov    %rsp,%rbp
+  80345d:	41 54                	push   %r12
+  80345f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803460:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803465:	49 bc 26 34 80 00 00 	movabs $0x803426,%r12
+  80346c:	00 00 00 
+  80346f:	89 df                	mov    %ebx,%edi
+  803471:	41 ff d4             	call   *%r12
+  803474:	83 c3 01             	add    $0x1,%ebx
+  803477:	83 fb 20             	cmp    $0x20,%ebx
+  80347a:	75 f3                	jne    80346f <close_all+0x16>
+}
+  80347c:	5b                   	pop    %rbx
+  80347d:	41 5c                	pop    %r12
+  80347f:	5d                   	pop    %rbp
+  803480:	c3                   	ret
+
+0000000000803481 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803481:	55                   	push   %rbp
+  803482:	48 89 e5             	mov    %rsp,%rbp
+  803485:	41 57                	push   %r15
+  803487:	41 56                	push   %r14
+  803489:	41 55                	push   %r13
+  80348b:	41 54                	push   %r12
+  80348d:	53                   	push   %rbx
+  80348e:	48 83 ec 18          	sub    $0x18,%rsp
+  803492:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803495:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803499:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8034a0:	00 00 00 
+  8034a3:	ff d0                	call   *%rax
+  8034a5:	89 c3                	mov    %eax,%ebx
+  8034a7:	85 c0                	test   %eax,%eax
+  8034a9:	0f 88 b8 00 00 00    	js     803567 <dup+0xe6>
+    close(newfdnum);
+  8034af:	44 89 e7             	mov    %r12d,%edi
+  8034b2:	48 b8 26 34 80 00 00 	movabs $0x803426,%rax
+  8034b9:	00 00 00 
+  8034bc:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8034be:	4d 63 ec             	movslq %r12d,%r13
+  8034c1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8034c8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8034cc:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8034d0:	4c 89 ff             	mov    %r15,%rdi
+  8034d3:	49 be 45 32 80 00 00 	movabs $0x803245,%r14
+  8034da:	00 00 00 
+  8034dd:	41 ff d6             	call   *%r14
+  8034e0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8034e3:	4c 89 ef             	mov    %r13,%rdi
+  8034e6:	41 ff d6             	call   *%r14
+  8034e9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8034ec:	48 89 df             	mov    %rbx,%rdi
+  8034ef:	48 b8 61 47 80 00 00 	movabs $0x804761,%rax
+  8034f6:	00 00 00 
+  8034f9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8034fb:	a8 04                	test   $0x4,%al
+  8034fd:	74 2b                	je     80352a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8034ff:	41 89 c1             	mov    %eax,%r9d
+  803502:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803508:	4c 89 f1             	mov    %r14,%rcx
+  80350b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803510:	48 89 de             	mov    %rbx,%rsi
+  803513:	bf 00 00 00 00       	mov    $0x0,%edi
+  803518:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+  803524:	89 c3                	mov    %eax,%ebx
+  803526:	85 c0                	test   %eax,%eax
+  803528:	78 4e                	js     803578 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80352a:	4c 89 ff             	mov    %r15,%rdi
+  80352d:	48 b8 61 47 80 00 00 	movabs $0x804761,%rax
+  803534:	00 00 00 
+  803537:	ff d0                	call   *%rax
+  803539:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80353c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803542:	4c 89 e9             	mov    %r13,%rcx
+  803545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354a:	4c 89 fe             	mov    %r15,%rsi
+  80354d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803552:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+  80355e:	89 c3                	mov    %eax,%ebx
+  803560:	85 c0                	test   %eax,%eax
+  803562:	78 14                	js     803578 <dup+0xf7>
+
+    return newfdnum;
+  803564:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803567:	89 d8                	mov    %ebx,%eax
+  803569:	48 83 c4 18          	add    $0x18,%rsp
+  80356d:	5b                   	pop    %rbx
+  80356e:	41 5c                	pop    %r12
+  803570:	41 5d                	pop    %r13
+  803572:	41 5e                	pop    %r14
+  803574:	41 5f                	pop    %r15
+  803576:	5d                   	pop    %rbp
+  803577:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803578:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80357d:	4c 89 ee             	mov    %r13,%rsi
+  803580:	bf 00 00 00 00       	mov    $0x0,%edi
+  803585:	49 bc 9b 29 80 00 00 	movabs $0x80299b,%r12
+  80358c:	00 00 00 
+  80358f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803592:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803597:	4c 89 f6             	mov    %r14,%rsi
+  80359a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80359f:	41 ff d4             	call   *%r12
+    return res;
+  8035a2:	eb c3                	jmp    803567 <dup+0xe6>
+
+00000000008035a4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8035a4:	55                   	push   %rbp
+  8035a5:	48 89 e5             	mov    %rsp,%rbp
+  8035a8:	41 56                	push   %r14
+  8035aa:	41 55                	push   %r13
+  8035ac:	41 54                	push   %r12
+  8035ae:	53                   	push   %rbx
+  8035af:	48 83 ec 10          	sub    $0x10,%rsp
+  8035b3:	89 fb                	mov    %edi,%ebx
+  8035b5:	49 89 f4             	mov    %rsi,%r12
+  8035b8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035bb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035bf:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8035c6:	00 00 00 
+  8035c9:	ff d0                	call   *%rax
+  8035cb:	85 c0                	test   %eax,%eax
+  8035cd:	78 4c                	js     80361b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035cf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8035d3:	41 8b 3e             	mov    (%r14),%edi
+  8035d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035da:	48 b8 0c 33 80 00 00 	movabs $0x80330c,%rax
+  8035e1:	00 00 00 
+  8035e4:	ff d0                	call   *%rax
+  8035e6:	85 c0                	test   %eax,%eax
+  8035e8:	78 35                	js     80361f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8035ea:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8035ee:	83 e0 03             	and    $0x3,%eax
+  8035f1:	83 f8 01             	cmp    $0x1,%eax
+  8035f4:	74 2d                	je     803623 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8035f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035fa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8035fe:	48 85 c0             	test   %rax,%rax
+  803601:	74 56                	je     803659 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803603:	4c 89 ea             	mov    %r13,%rdx
+  803606:	4c 89 e6             	mov    %r12,%rsi
+  803609:	4c 89 f7             	mov    %r14,%rdi
+  80360c:	ff d0                	call   *%rax
+}
+  80360e:	48 83 c4 10          	add    $0x10,%rsp
+  803612:	5b                   	pop    %rbx
+  803613:	41 5c                	pop    %r12
+  803615:	41 5d                	pop    %r13
+  803617:	41 5e                	pop    %r14
+  803619:	5d                   	pop    %rbp
+  80361a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80361b:	48 98                	cltq
+  80361d:	eb ef                	jmp    80360e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80361f:	48 98                	cltq
+  803621:	eb eb                	jmp    80360e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803623:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80362a:	00 00 00 
+  80362d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803633:	89 da                	mov    %ebx,%edx
+  803635:	48 bf c1 63 80 00 00 	movabs $0x8063c1,%rdi
+  80363c:	00 00 00 
+  80363f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803644:	48 b9 27 18 80 00 00 	movabs $0x801827,%rcx
+  80364b:	00 00 00 
+  80364e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803650:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803657:	eb b5                	jmp    80360e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803659:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803660:	eb ac                	jmp    80360e <read+0x6a>
+
+0000000000803662 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803662:	55                   	push   %rbp
+  803663:	48 89 e5             	mov    %rsp,%rbp
+  803666:	41 57                	push   %r15
+  803668:	41 56                	push   %r14
+  80366a:	41 55                	push   %r13
+  80366c:	41 54                	push   %r12
+  80366e:	53                   	push   %rbx
+  80366f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803673:	48 85 d2             	test   %rdx,%rdx
+  803676:	74 54                	je     8036cc <readn+0x6a>
+  803678:	41 89 fd             	mov    %edi,%r13d
+  80367b:	49 89 f6             	mov    %rsi,%r14
+  80367e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803681:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803686:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80368b:	49 bf a4 35 80 00 00 	movabs $0x8035a4,%r15
+  803692:	00 00 00 
+  803695:	4c 89 e2             	mov    %r12,%rdx
+  803698:	48 29 f2             	sub    %rsi,%rdx
+  80369b:	4c 01 f6             	add    %r14,%rsi
+  80369e:	44 89 ef             	mov    %r13d,%edi
+  8036a1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8036a4:	85 c0                	test   %eax,%eax
+  8036a6:	78 20                	js     8036c8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8036a8:	01 c3                	add    %eax,%ebx
+  8036aa:	85 c0                	test   %eax,%eax
+  8036ac:	74 08                	je     8036b6 <readn+0x54>
+  8036ae:	48 63 f3             	movslq %ebx,%rsi
+  8036b1:	4c 39 e6             	cmp    %r12,%rsi
+  8036b4:	72 df                	jb     803695 <readn+0x33>
+    }
+    return res;
+  8036b6:	48 63 c3             	movslq %ebx,%rax
+}
+  8036b9:	48 83 c4 08          	add    $0x8,%rsp
+  8036bd:	5b                   	pop    %rbx
+  8036be:	41 5c                	pop    %r12
+  8036c0:	41 5d                	pop    %r13
+  8036c2:	41 5e                	pop    %r14
+  8036c4:	41 5f                	pop    %r15
+  8036c6:	5d                   	pop    %rbp
+  8036c7:	c3                   	ret
+        if (inc < 0) return inc;
+  8036c8:	48 98                	cltq
+  8036ca:	eb ed                	jmp    8036b9 <readn+0x57>
+    int inc = 1, res = 0;
+  8036cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036d1:	eb e3                	jmp    8036b6 <readn+0x54>
+
+00000000008036d3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8036d3:	55                   	push   %rbp
+  8036d4:	48 89 e5             	mov    %rsp,%rbp
+  8036d7:	41 56                	push   %r14
+  8036d9:	41 55                	push   %r13
+  8036db:	41 54                	push   %r12
+  8036dd:	53                   	push   %rbx
+  8036de:	48 83 ec 10          	sub    $0x10,%rsp
+  8036e2:	89 fb                	mov    %edi,%ebx
+  8036e4:	49 89 f4             	mov    %rsi,%r12
+  8036e7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036ee:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8036f5:	00 00 00 
+  8036f8:	ff d0                	call   *%rax
+  8036fa:	85 c0                	test   %eax,%eax
+  8036fc:	78 47                	js     803745 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036fe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803702:	41 8b 3e             	mov    (%r14),%edi
+  803705:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803709:	48 b8 0c 33 80 00 00 	movabs $0x80330c,%rax
+  803710:	00 00 00 
+  803713:	ff d0                	call   *%rax
+  803715:	85 c0                	test   %eax,%eax
+  803717:	78 30                	js     803749 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803719:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80371e:	74 2d                	je     80374d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803720:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803724:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803728:	48 85 c0             	test   %rax,%rax
+  80372b:	74 56                	je     803783 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80372d:	4c 89 ea             	mov    %r13,%rdx
+  803730:	4c 89 e6             	mov    %r12,%rsi
+  803733:	4c 89 f7             	mov    %r14,%rdi
+  803736:	ff d0                	call   *%rax
+}
+  803738:	48 83 c4 10          	add    $0x10,%rsp
+  80373c:	5b                   	pop    %rbx
+  80373d:	41 5c                	pop    %r12
+  80373f:	41 5d                	pop    %r13
+  803741:	41 5e                	pop    %r14
+  803743:	5d                   	pop    %rbp
+  803744:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803745:	48 98                	cltq
+  803747:	eb ef                	jmp    803738 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803749:	48 98                	cltq
+  80374b:	eb eb                	jmp    803738 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80374d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803754:	00 00 00 
+  803757:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80375d:	89 da                	mov    %ebx,%edx
+  80375f:	48 bf dd 63 80 00 00 	movabs $0x8063dd,%rdi
+  803766:	00 00 00 
+  803769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376e:	48 b9 27 18 80 00 00 	movabs $0x801827,%rcx
+  803775:	00 00 00 
+  803778:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80377a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803781:	eb b5                	jmp    803738 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803783:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80378a:	eb ac                	jmp    803738 <write+0x65>
+
+000000000080378c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80378c:	55                   	push   %rbp
+  80378d:	48 89 e5             	mov    %rsp,%rbp
+  803790:	53                   	push   %rbx
+  803791:	48 83 ec 18          	sub    $0x18,%rsp
+  803795:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803797:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80379b:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8037a2:	00 00 00 
+  8037a5:	ff d0                	call   *%rax
+  8037a7:	85 c0                	test   %eax,%eax
+  8037a9:	78 0c                	js     8037b7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8037ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037af:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8037b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037bb:	c9                   	leave
+  8037bc:	c3                   	ret
+
+00000000008037bd <tell>:
+
+int tell(int fdnum) {
+  8037bd:	55                   	push   %rbp
+  8037be:	48 89 e5             	mov    %rsp,%rbp
+  8037c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037c9:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8037d0:	00 00 00 
+  8037d3:	ff d0                	call   *%rax
+  8037d5:	85 c0                	test   %eax,%eax
+  8037d7:	78 07                	js     8037e0 <tell+0x23>
+
+    return fd->fd_offset;
+  8037d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037dd:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8037e0:	c9                   	leave
+  8037e1:	c3                   	ret
+
+00000000008037e2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8037e2:	55                   	push   %rbp
+  8037e3:	48 89 e5             	mov    %rsp,%rbp
+  8037e6:	41 55                	push   %r13
+  8037e8:	41 54                	push   %r12
+  8037ea:	53                   	push   %rbx
+  8037eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8037ef:	89 fb                	mov    %edi,%ebx
+  8037f1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037f8:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	85 c0                	test   %eax,%eax
+  803806:	78 38                	js     803840 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803808:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80380c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803810:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803814:	48 b8 0c 33 80 00 00 	movabs $0x80330c,%rax
+  80381b:	00 00 00 
+  80381e:	ff d0                	call   *%rax
+  803820:	85 c0                	test   %eax,%eax
+  803822:	78 1c                	js     803840 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803824:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803829:	74 20                	je     80384b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80382b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80382f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803833:	48 85 c0             	test   %rax,%rax
+  803836:	74 47                	je     80387f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803838:	44 89 e6             	mov    %r12d,%esi
+  80383b:	4c 89 ef             	mov    %r13,%rdi
+  80383e:	ff d0                	call   *%rax
+}
+  803840:	48 83 c4 18          	add    $0x18,%rsp
+  803844:	5b                   	pop    %rbx
+  803845:	41 5c                	pop    %r12
+  803847:	41 5d                	pop    %r13
+  803849:	5d                   	pop    %rbp
+  80384a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80384b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803852:	00 00 00 
+  803855:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80385b:	89 da                	mov    %ebx,%edx
+  80385d:	48 bf a0 63 80 00 00 	movabs $0x8063a0,%rdi
+  803864:	00 00 00 
+  803867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386c:	48 b9 27 18 80 00 00 	movabs $0x801827,%rcx
+  803873:	00 00 00 
+  803876:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803878:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80387d:	eb c1                	jmp    803840 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80387f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803884:	eb ba                	jmp    803840 <ftruncate+0x5e>
+
+0000000000803886 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803886:	55                   	push   %rbp
+  803887:	48 89 e5             	mov    %rsp,%rbp
+  80388a:	41 54                	push   %r12
+  80388c:	53                   	push   %rbx
+  80388d:	48 83 ec 10          	sub    $0x10,%rsp
+  803891:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803894:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803898:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  80389f:	00 00 00 
+  8038a2:	ff d0                	call   *%rax
+  8038a4:	85 c0                	test   %eax,%eax
+  8038a6:	78 63                	js     80390b <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038a8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8038ac:	41 8b 3c 24          	mov    (%r12),%edi
+  8038b0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8038b4:	48 b8 0c 33 80 00 00 	movabs $0x80330c,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+  8038c0:	85 c0                	test   %eax,%eax
+  8038c2:	78 47                	js     80390b <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8038c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038c8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8038cd:	74 45                	je     803914 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8038cf:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8038d2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8038d9:	00 00 00 
+    stat->st_isdir = 0;
+  8038dc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8038e3:	00 00 00 
+    stat->st_ino = 0;
+  8038e6:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8038ed:	00 00 00 00 
+    stat->st_version = 0;
+  8038f1:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8038f8:	00 00 00 
+    stat->st_dev = dev;
+  8038fb:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803902:	48 89 de             	mov    %rbx,%rsi
+  803905:	4c 89 e7             	mov    %r12,%rdi
+  803908:	ff 50 28             	call   *0x28(%rax)
+}
+  80390b:	48 83 c4 10          	add    $0x10,%rsp
+  80390f:	5b                   	pop    %rbx
+  803910:	41 5c                	pop    %r12
+  803912:	5d                   	pop    %rbp
+  803913:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803914:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803919:	eb f0                	jmp    80390b <fstat+0x85>
+
+000000000080391b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80391b:	55                   	push   %rbp
+  80391c:	48 89 e5             	mov    %rsp,%rbp
+  80391f:	41 54                	push   %r12
+  803921:	53                   	push   %rbx
+  803922:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803925:	be 00 00 00 00       	mov    $0x0,%esi
+  80392a:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  803931:	00 00 00 
+  803934:	ff d0                	call   *%rax
+  803936:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803938:	85 c0                	test   %eax,%eax
+  80393a:	78 25                	js     803961 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80393c:	4c 89 e6             	mov    %r12,%rsi
+  80393f:	89 c7                	mov    %eax,%edi
+  803941:	48 b8 86 38 80 00 00 	movabs $0x803886,%rax
+  803948:	00 00 00 
+  80394b:	ff d0                	call   *%rax
+  80394d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803950:	89 df                	mov    %ebx,%edi
+  803952:	48 b8 26 34 80 00 00 	movabs $0x803426,%rax
+  803959:	00 00 00 
+  80395c:	ff d0                	call   *%rax
+
+    return res;
+  80395e:	44 89 e3             	mov    %r12d,%ebx
+}
+  803961:	89 d8                	mov    %ebx,%eax
+  803963:	5b                   	pop    %rbx
+  803964:	41 5c                	pop    %r12
+  803966:	5d                   	pop    %rbp
+  803967:	c3                   	ret
+
+0000000000803968 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803968:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80396f:	00 00 00 
+  803972:	83 38 00             	cmpl   $0x0,(%rax)
+  803975:	74 0a                	je     803981 <fsipc_env+0x19>
+    return fsenv;
+}
+  803977:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80397e:	00 00 
+  803980:	c3                   	ret
+fsipc_env(void) {
+  803981:	55                   	push   %rbp
+  803982:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803985:	bf 03 00 00 00       	mov    $0x3,%edi
+  80398a:	48 b8 59 57 80 00 00 	movabs $0x805759,%rax
+  803991:	00 00 00 
+  803994:	ff d0                	call   *%rax
+  803996:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80399d:	00 00 
+}
+  80399f:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8039a6:	00 00 
+  8039a8:	5d                   	pop    %rbp
+  8039a9:	c3                   	ret
+
+00000000008039aa <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8039aa:	55                   	push   %rbp
+  8039ab:	48 89 e5             	mov    %rsp,%rbp
+  8039ae:	53                   	push   %rbx
+  8039af:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8039b3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8039ba:	00 
+  8039bb:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8039c2:	00 
+  8039c3:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8039ca:	00 
+  8039cb:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8039d2:	00 
+  8039d3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8039da:	00 
+
+    assert(size <= sizeof(words));
+  8039db:	48 83 fa 28          	cmp    $0x28,%rdx
+  8039df:	77 38                	ja     803a19 <fsipc_short+0x6f>
+  8039e1:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8039e3:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8039e7:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8039ee:	00 00 00 
+  8039f1:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8039f3:	48 b8 68 39 80 00 00 	movabs $0x803968,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+  8039ff:	89 c7                	mov    %eax,%edi
+  803a01:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803a05:	89 de                	mov    %ebx,%esi
+  803a07:	48 b8 bc 56 80 00 00 	movabs $0x8056bc,%rax
+  803a0e:	00 00 00 
+  803a11:	ff d0                	call   *%rax
+}
+  803a13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a17:	c9                   	leave
+  803a18:	c3                   	ret
+    assert(size <= sizeof(words));
+  803a19:	48 b9 20 64 80 00 00 	movabs $0x806420,%rcx
+  803a20:	00 00 00 
+  803a23:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803a2a:	00 00 00 
+  803a2d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803a32:	48 bf 36 64 80 00 00 	movabs $0x806436,%rdi
+  803a39:	00 00 00 
+  803a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a41:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803a48:	00 00 00 
+  803a4b:	41 ff d0             	call   *%r8
+
+0000000000803a4e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a4e:	55                   	push   %rbp
+  803a4f:	48 89 e5             	mov    %rsp,%rbp
+  803a52:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803a56:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803a59:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803a5c:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803a5f:	ba 08 00 00 00       	mov    $0x8,%edx
+  803a64:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a68:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a6d:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803a74:	00 00 00 
+  803a77:	ff d0                	call   *%rax
+}
+  803a79:	c9                   	leave
+  803a7a:	c3                   	ret
+
+0000000000803a7b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803a7b:	55                   	push   %rbp
+  803a7c:	48 89 e5             	mov    %rsp,%rbp
+  803a7f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803a83:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803a86:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803a89:	ba 04 00 00 00       	mov    $0x4,%edx
+  803a8e:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803a92:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a97:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803a9e:	00 00 00 
+  803aa1:	ff d0                	call   *%rax
+}
+  803aa3:	c9                   	leave
+  803aa4:	c3                   	ret
+
+0000000000803aa5 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803aa5:	55                   	push   %rbp
+  803aa6:	48 89 e5             	mov    %rsp,%rbp
+  803aa9:	41 54                	push   %r12
+  803aab:	53                   	push   %rbx
+  803aac:	48 83 ec 10          	sub    $0x10,%rsp
+  803ab0:	89 fb                	mov    %edi,%ebx
+  803ab2:	49 89 f4             	mov    %rsi,%r12
+  803ab5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803ab9:	48 b8 68 39 80 00 00 	movabs $0x803968,%rax
+  803ac0:	00 00 00 
+  803ac3:	ff d0                	call   *%rax
+  803ac5:	89 c7                	mov    %eax,%edi
+  803ac7:	6a 00                	push   $0x0
+  803ac9:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803acd:	50                   	push   %rax
+  803ace:	4d 89 e1             	mov    %r12,%r9
+  803ad1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803ad7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803adc:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803ae3:	00 00 00 
+  803ae6:	89 de                	mov    %ebx,%esi
+  803ae8:	48 b8 57 56 80 00 00 	movabs $0x805657,%rax
+  803aef:	00 00 00 
+  803af2:	ff d0                	call   *%rax
+}
+  803af4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803af8:	5b                   	pop    %rbx
+  803af9:	41 5c                	pop    %r12
+  803afb:	5d                   	pop    %rbp
+  803afc:	c3                   	ret
+
+0000000000803afd <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803afd:	55                   	push   %rbp
+  803afe:	48 89 e5             	mov    %rsp,%rbp
+  803b01:	41 54                	push   %r12
+  803b03:	53                   	push   %rbx
+  803b04:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b07:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b0a:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803b11:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b13:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b18:	be 00 00 00 00       	mov    $0x0,%esi
+  803b1d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b22:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b2e:	85 c0                	test   %eax,%eax
+  803b30:	78 5a                	js     803b8c <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b32:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803b39:	00 00 00 
+  803b3c:	4c 89 e6             	mov    %r12,%rsi
+  803b3f:	48 89 df             	mov    %rbx,%rdi
+  803b42:	48 b8 5e 21 80 00 00 	movabs $0x80215e,%rax
+  803b49:	00 00 00 
+  803b4c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803b4e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803b55:	00 
+  803b56:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803b5c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803b63:	00 
+  803b64:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803b6a:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803b71:	00 
+  803b72:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803b79:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803b80:	00 
+  803b81:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803b87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b8c:	5b                   	pop    %rbx
+  803b8d:	41 5c                	pop    %r12
+  803b8f:	5d                   	pop    %rbp
+  803b90:	c3                   	ret
+
+0000000000803b91 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803b91:	55                   	push   %rbp
+  803b92:	48 89 e5             	mov    %rsp,%rbp
+  803b95:	41 57                	push   %r15
+  803b97:	41 56                	push   %r14
+  803b99:	41 55                	push   %r13
+  803b9b:	41 54                	push   %r12
+  803b9d:	53                   	push   %rbx
+  803b9e:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803ba2:	48 85 ff             	test   %rdi,%rdi
+  803ba5:	0f 84 a1 00 00 00    	je     803c4c <devfile_read+0xbb>
+  803bab:	49 89 ff             	mov    %rdi,%r15
+  803bae:	49 89 f5             	mov    %rsi,%r13
+  803bb1:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803bb4:	48 85 f6             	test   %rsi,%rsi
+  803bb7:	0f 84 c4 00 00 00    	je     803c81 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803bbd:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803bc4:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803bc5:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803bcc:	00 00 00 
+  803bcf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803bd3:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803bd6:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bdf:	be 00 00 00 00       	mov    $0x0,%esi
+  803be4:	bf 03 00 00 00       	mov    $0x3,%edi
+  803be9:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  803bf0:	00 00 00 
+  803bf3:	ff d0                	call   *%rax
+        if (res < 0) {
+  803bf5:	85 c0                	test   %eax,%eax
+  803bf7:	0f 88 b9 00 00 00    	js     803cb6 <devfile_read+0x125>
+        assert(res <= n);
+  803bfd:	48 63 d8             	movslq %eax,%rbx
+  803c00:	49 39 dc             	cmp    %rbx,%r12
+  803c03:	0f 82 b1 00 00 00    	jb     803cba <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803c09:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803c0e:	0f 87 db 00 00 00    	ja     803cef <devfile_read+0x15e>
+        if (!res) {
+  803c14:	85 c0                	test   %eax,%eax
+  803c16:	74 21                	je     803c39 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803c18:	48 89 da             	mov    %rbx,%rdx
+  803c1b:	4c 89 f6             	mov    %r14,%rsi
+  803c1e:	4c 89 ef             	mov    %r13,%rdi
+  803c21:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  803c28:	00 00 00 
+  803c2b:	ff d0                	call   *%rax
+        total_read += res;
+  803c2d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803c31:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803c34:	49 29 dc             	sub    %rbx,%r12
+  803c37:	75 96                	jne    803bcf <devfile_read+0x3e>
+    return total_read;
+  803c39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803c3d:	48 83 c4 18          	add    $0x18,%rsp
+  803c41:	5b                   	pop    %rbx
+  803c42:	41 5c                	pop    %r12
+  803c44:	41 5d                	pop    %r13
+  803c46:	41 5e                	pop    %r14
+  803c48:	41 5f                	pop    %r15
+  803c4a:	5d                   	pop    %rbp
+  803c4b:	c3                   	ret
+    assert(fd);
+  803c4c:	48 b9 41 64 80 00 00 	movabs $0x806441,%rcx
+  803c53:	00 00 00 
+  803c56:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803c5d:	00 00 00 
+  803c60:	be 91 00 00 00       	mov    $0x91,%esi
+  803c65:	48 bf 36 64 80 00 00 	movabs $0x806436,%rdi
+  803c6c:	00 00 00 
+  803c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c74:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803c7b:	00 00 00 
+  803c7e:	41 ff d0             	call   *%r8
+    assert(buf);
+  803c81:	48 b9 44 64 80 00 00 	movabs $0x806444,%rcx
+  803c88:	00 00 00 
+  803c8b:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803c92:	00 00 00 
+  803c95:	be 92 00 00 00       	mov    $0x92,%esi
+  803c9a:	48 bf 36 64 80 00 00 	movabs $0x806436,%rdi
+  803ca1:	00 00 00 
+  803ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca9:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803cb0:	00 00 00 
+  803cb3:	41 ff d0             	call   *%r8
+            return res;
+  803cb6:	48 98                	cltq
+  803cb8:	eb 83                	jmp    803c3d <devfile_read+0xac>
+        assert(res <= n);
+  803cba:	48 b9 48 64 80 00 00 	movabs $0x806448,%rcx
+  803cc1:	00 00 00 
+  803cc4:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803ccb:	00 00 00 
+  803cce:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803cd3:	48 bf 36 64 80 00 00 	movabs $0x806436,%rdi
+  803cda:	00 00 00 
+  803cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce2:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803ce9:	00 00 00 
+  803cec:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803cef:	48 b9 58 64 80 00 00 	movabs $0x806458,%rcx
+  803cf6:	00 00 00 
+  803cf9:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803d00:	00 00 00 
+  803d03:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803d08:	48 bf 36 64 80 00 00 	movabs $0x806436,%rdi
+  803d0f:	00 00 00 
+  803d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d17:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803d1e:	00 00 00 
+  803d21:	41 ff d0             	call   *%r8
+
+0000000000803d24 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803d24:	55                   	push   %rbp
+  803d25:	48 89 e5             	mov    %rsp,%rbp
+  803d28:	41 57                	push   %r15
+  803d2a:	41 56                	push   %r14
+  803d2c:	41 55                	push   %r13
+  803d2e:	41 54                	push   %r12
+  803d30:	53                   	push   %rbx
+  803d31:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803d35:	48 85 ff             	test   %rdi,%rdi
+  803d38:	0f 84 83 00 00 00    	je     803dc1 <devfile_write+0x9d>
+  803d3e:	49 89 ff             	mov    %rdi,%r15
+  803d41:	49 89 f4             	mov    %rsi,%r12
+  803d44:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803d47:	48 85 f6             	test   %rsi,%rsi
+  803d4a:	0f 84 a6 00 00 00    	je     803df6 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803d50:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803d56:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803d5d:	00 00 00 
+  803d60:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d64:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803d67:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803d6b:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803d70:	48 39 d3             	cmp    %rdx,%rbx
+  803d73:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803d77:	4c 89 e6             	mov    %r12,%rsi
+  803d7a:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803d81:	00 00 00 
+  803d84:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  803d8b:	00 00 00 
+  803d8e:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d95:	be 00 00 00 00       	mov    $0x0,%esi
+  803d9a:	bf 04 00 00 00       	mov    $0x4,%edi
+  803d9f:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+        if (res < 0) {
+  803dab:	85 c0                	test   %eax,%eax
+  803dad:	78 7c                	js     803e2b <devfile_write+0x107>
+        total_written += res;
+  803daf:	48 98                	cltq
+  803db1:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803db4:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803db7:	48 29 c3             	sub    %rax,%rbx
+  803dba:	75 a4                	jne    803d60 <devfile_write+0x3c>
+    return total_written;
+  803dbc:	4c 89 e8             	mov    %r13,%rax
+  803dbf:	eb 6c                	jmp    803e2d <devfile_write+0x109>
+    assert(fd);
+  803dc1:	48 b9 41 64 80 00 00 	movabs $0x806441,%rcx
+  803dc8:	00 00 00 
+  803dcb:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803dd2:	00 00 00 
+  803dd5:	be bd 00 00 00       	mov    $0xbd,%esi
+  803dda:	48 bf 36 64 80 00 00 	movabs $0x806436,%rdi
+  803de1:	00 00 00 
+  803de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de9:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803df0:	00 00 00 
+  803df3:	41 ff d0             	call   *%r8
+    assert(buf);
+  803df6:	48 b9 44 64 80 00 00 	movabs $0x806444,%rcx
+  803dfd:	00 00 00 
+  803e00:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  803e07:	00 00 00 
+  803e0a:	be be 00 00 00       	mov    $0xbe,%esi
+  803e0f:	48 bf 36 64 80 00 00 	movabs $0x806436,%rdi
+  803e16:	00 00 00 
+  803e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1e:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  803e25:	00 00 00 
+  803e28:	41 ff d0             	call   *%r8
+            return res;
+  803e2b:	48 98                	cltq
+}
+  803e2d:	48 83 c4 08          	add    $0x8,%rsp
+  803e31:	5b                   	pop    %rbx
+  803e32:	41 5c                	pop    %r12
+  803e34:	41 5d                	pop    %r13
+  803e36:	41 5e                	pop    %r14
+  803e38:	41 5f                	pop    %r15
+  803e3a:	5d                   	pop    %rbp
+  803e3b:	c3                   	ret
+
+0000000000803e3c <open>:
+open(const char *path, int mode) {
+  803e3c:	55                   	push   %rbp
+  803e3d:	48 89 e5             	mov    %rsp,%rbp
+  803e40:	41 55                	push   %r13
+  803e42:	41 54                	push   %r12
+  803e44:	53                   	push   %rbx
+  803e45:	48 83 ec 18          	sub    $0x18,%rsp
+  803e49:	49 89 fc             	mov    %rdi,%r12
+  803e4c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803e4f:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  803e56:	00 00 00 
+  803e59:	ff d0                	call   *%rax
+  803e5b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803e61:	0f 87 8f 00 00 00    	ja     803ef6 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803e67:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e6b:	48 b8 61 32 80 00 00 	movabs $0x803261,%rax
+  803e72:	00 00 00 
+  803e75:	ff d0                	call   *%rax
+  803e77:	89 c3                	mov    %eax,%ebx
+  803e79:	85 c0                	test   %eax,%eax
+  803e7b:	78 55                	js     803ed2 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803e7d:	4c 89 e6             	mov    %r12,%rsi
+  803e80:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803e87:	00 00 00 
+  803e8a:	48 89 df             	mov    %rbx,%rdi
+  803e8d:	48 b8 5e 21 80 00 00 	movabs $0x80215e,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803e99:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803ea0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ea5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ea9:	bf 01 00 00 00       	mov    $0x1,%edi
+  803eae:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+  803eba:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	78 1f                	js     803edf <open+0xa3>
+    return fd2num(fd);
+  803ec0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ec4:	48 b8 33 32 80 00 00 	movabs $0x803233,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+  803ed0:	89 c3                	mov    %eax,%ebx
+}
+  803ed2:	89 d8                	mov    %ebx,%eax
+  803ed4:	48 83 c4 18          	add    $0x18,%rsp
+  803ed8:	5b                   	pop    %rbx
+  803ed9:	41 5c                	pop    %r12
+  803edb:	41 5d                	pop    %r13
+  803edd:	5d                   	pop    %rbp
+  803ede:	c3                   	ret
+        fd_close(fd, 0);
+  803edf:	be 00 00 00 00       	mov    $0x0,%esi
+  803ee4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ee8:	48 b8 7c 33 80 00 00 	movabs $0x80337c,%rax
+  803eef:	00 00 00 
+  803ef2:	ff d0                	call   *%rax
+        return res;
+  803ef4:	eb dc                	jmp    803ed2 <open+0x96>
+        return -E_BAD_PATH;
+  803ef6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803efb:	eb d5                	jmp    803ed2 <open+0x96>
+
+0000000000803efd <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803efd:	55                   	push   %rbp
+  803efe:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803f01:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f06:	be 00 00 00 00       	mov    $0x0,%esi
+  803f0b:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f10:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803f17:	00 00 00 
+  803f1a:	ff d0                	call   *%rax
+}
+  803f1c:	5d                   	pop    %rbp
+  803f1d:	c3                   	ret
+
+0000000000803f1e <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803f1e:	55                   	push   %rbp
+  803f1f:	48 89 e5             	mov    %rsp,%rbp
+  803f22:	41 56                	push   %r14
+  803f24:	41 55                	push   %r13
+  803f26:	41 54                	push   %r12
+  803f28:	53                   	push   %rbx
+  803f29:	48 83 ec 10          	sub    $0x10,%rsp
+  803f2d:	41 89 f6             	mov    %esi,%r14d
+  803f30:	49 89 d4             	mov    %rdx,%r12
+  803f33:	48 89 cb             	mov    %rcx,%rbx
+  803f36:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803f39:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f3d:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  803f44:	00 00 00 
+  803f47:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f49:	85 c0                	test   %eax,%eax
+  803f4b:	78 46                	js     803f93 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803f4d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f51:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803f58:	00 00 00 
+  803f5b:	8b 00                	mov    (%rax),%eax
+  803f5d:	39 02                	cmp    %eax,(%rdx)
+  803f5f:	75 3f                	jne    803fa0 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803f61:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803f68:	00 00 00 
+  803f6b:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803f6e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803f70:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803f74:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803f78:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803f7c:	48 89 da             	mov    %rbx,%rdx
+  803f7f:	4c 89 e6             	mov    %r12,%rsi
+  803f82:	bf 09 00 00 00       	mov    $0x9,%edi
+  803f87:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  803f8e:	00 00 00 
+  803f91:	ff d0                	call   *%rax
+}
+  803f93:	48 83 c4 10          	add    $0x10,%rsp
+  803f97:	5b                   	pop    %rbx
+  803f98:	41 5c                	pop    %r12
+  803f9a:	41 5d                	pop    %r13
+  803f9c:	41 5e                	pop    %r14
+  803f9e:	5d                   	pop    %rbp
+  803f9f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fa0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803fa5:	eb ec                	jmp    803f93 <file_map+0x75>
+
+0000000000803fa7 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803fa7:	55                   	push   %rbp
+  803fa8:	48 89 e5             	mov    %rsp,%rbp
+  803fab:	41 54                	push   %r12
+  803fad:	53                   	push   %rbx
+  803fae:	48 83 ec 20          	sub    $0x20,%rsp
+  803fb2:	41 89 f4             	mov    %esi,%r12d
+  803fb5:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803fb8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803fbc:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  803fc3:	00 00 00 
+  803fc6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fc8:	85 c0                	test   %eax,%eax
+  803fca:	78 3c                	js     804008 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fd0:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803fd7:	00 00 00 
+  803fda:	8b 0a                	mov    (%rdx),%ecx
+  803fdc:	39 08                	cmp    %ecx,(%rax)
+  803fde:	75 31                	jne    804011 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803fe0:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fe3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803fe6:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803fea:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803fee:	ba 10 00 00 00       	mov    $0x10,%edx
+  803ff3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ff7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803ffc:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  804003:	00 00 00 
+  804006:	ff d0                	call   *%rax
+}
+  804008:	48 83 c4 20          	add    $0x20,%rsp
+  80400c:	5b                   	pop    %rbx
+  80400d:	41 5c                	pop    %r12
+  80400f:	5d                   	pop    %rbp
+  804010:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804011:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804016:	eb f0                	jmp    804008 <file_msync+0x61>
+
+0000000000804018 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804018:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80401c:	7f 01                	jg     80401f <writebuf+0x7>
+  80401e:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80401f:	55                   	push   %rbp
+  804020:	48 89 e5             	mov    %rsp,%rbp
+  804023:	53                   	push   %rbx
+  804024:	48 83 ec 08          	sub    $0x8,%rsp
+  804028:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80402b:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80402f:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804033:	8b 3f                	mov    (%rdi),%edi
+  804035:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  80403c:	00 00 00 
+  80403f:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804041:	48 85 c0             	test   %rax,%rax
+  804044:	7e 04                	jle    80404a <writebuf+0x32>
+  804046:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80404a:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80404e:	48 39 c2             	cmp    %rax,%rdx
+  804051:	74 0f                	je     804062 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804053:	48 85 c0             	test   %rax,%rax
+  804056:	ba 00 00 00 00       	mov    $0x0,%edx
+  80405b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80405f:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804062:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804066:	c9                   	leave
+  804067:	c3                   	ret
+
+0000000000804068 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804068:	8b 46 04             	mov    0x4(%rsi),%eax
+  80406b:	8d 50 01             	lea    0x1(%rax),%edx
+  80406e:	89 56 04             	mov    %edx,0x4(%rsi)
+  804071:	48 98                	cltq
+  804073:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804078:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80407e:	74 01                	je     804081 <putch+0x19>
+  804080:	c3                   	ret
+putch(int ch, void *arg) {
+  804081:	55                   	push   %rbp
+  804082:	48 89 e5             	mov    %rsp,%rbp
+  804085:	53                   	push   %rbx
+  804086:	48 83 ec 08          	sub    $0x8,%rsp
+  80408a:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80408d:	48 89 f7             	mov    %rsi,%rdi
+  804090:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  804097:	00 00 00 
+  80409a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80409c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8040a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040a7:	c9                   	leave
+  8040a8:	c3                   	ret
+
+00000000008040a9 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8040a9:	55                   	push   %rbp
+  8040aa:	48 89 e5             	mov    %rsp,%rbp
+  8040ad:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8040b4:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8040b7:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8040bd:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8040c4:	00 00 00 
+    state.result = 0;
+  8040c7:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8040ce:	00 00 00 00 
+    state.error = 1;
+  8040d2:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8040d9:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8040dc:	48 89 f2             	mov    %rsi,%rdx
+  8040df:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8040e6:	48 bf 68 40 80 00 00 	movabs $0x804068,%rdi
+  8040ed:	00 00 00 
+  8040f0:	48 b8 77 19 80 00 00 	movabs $0x801977,%rax
+  8040f7:	00 00 00 
+  8040fa:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8040fc:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804103:	7f 14                	jg     804119 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804105:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80410c:	48 85 c0             	test   %rax,%rax
+  80410f:	75 06                	jne    804117 <vfprintf+0x6e>
+  804111:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804117:	c9                   	leave
+  804118:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804119:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804120:	48 b8 18 40 80 00 00 	movabs $0x804018,%rax
+  804127:	00 00 00 
+  80412a:	ff d0                	call   *%rax
+  80412c:	eb d7                	jmp    804105 <vfprintf+0x5c>
+
+000000000080412e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80412e:	55                   	push   %rbp
+  80412f:	48 89 e5             	mov    %rsp,%rbp
+  804132:	48 83 ec 50          	sub    $0x50,%rsp
+  804136:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80413a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80413e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804142:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804146:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80414d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804151:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804155:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804159:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80415d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804161:	48 b8 a9 40 80 00 00 	movabs $0x8040a9,%rax
+  804168:	00 00 00 
+  80416b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80416d:	c9                   	leave
+  80416e:	c3                   	ret
+
+000000000080416f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80416f:	55                   	push   %rbp
+  804170:	48 89 e5             	mov    %rsp,%rbp
+  804173:	48 83 ec 50          	sub    $0x50,%rsp
+  804177:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80417b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80417f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804183:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804187:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80418b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804192:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804196:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80419a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80419e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8041a2:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8041a6:	48 89 fe             	mov    %rdi,%rsi
+  8041a9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041ae:	48 b8 a9 40 80 00 00 	movabs $0x8040a9,%rax
+  8041b5:	00 00 00 
+  8041b8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8041ba:	c9                   	leave
+  8041bb:	c3                   	ret
+
+00000000008041bc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8041bc:	55                   	push   %rbp
+  8041bd:	48 89 e5             	mov    %rsp,%rbp
+  8041c0:	41 54                	push   %r12
+  8041c2:	53                   	push   %rbx
+  8041c3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8041c6:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  8041cd:	00 00 00 
+  8041d0:	ff d0                	call   *%rax
+  8041d2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8041d5:	48 be 80 64 80 00 00 	movabs $0x806480,%rsi
+  8041dc:	00 00 00 
+  8041df:	48 89 df             	mov    %rbx,%rdi
+  8041e2:	48 b8 5e 21 80 00 00 	movabs $0x80215e,%rax
+  8041e9:	00 00 00 
+  8041ec:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8041ee:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8041f3:	41 2b 04 24          	sub    (%r12),%eax
+  8041f7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8041fd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804204:	00 00 00 
+    stat->st_dev = &devpipe;
+  804207:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80420e:	00 00 00 
+  804211:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421d:	5b                   	pop    %rbx
+  80421e:	41 5c                	pop    %r12
+  804220:	5d                   	pop    %rbp
+  804221:	c3                   	ret
+
+0000000000804222 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804222:	55                   	push   %rbp
+  804223:	48 89 e5             	mov    %rsp,%rbp
+  804226:	41 54                	push   %r12
+  804228:	53                   	push   %rbx
+  804229:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80422c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804231:	48 89 fe             	mov    %rdi,%rsi
+  804234:	bf 00 00 00 00       	mov    $0x0,%edi
+  804239:	49 bc 9b 29 80 00 00 	movabs $0x80299b,%r12
+  804240:	00 00 00 
+  804243:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804246:	48 89 df             	mov    %rbx,%rdi
+  804249:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  804250:	00 00 00 
+  804253:	ff d0                	call   *%rax
+  804255:	48 89 c6             	mov    %rax,%rsi
+  804258:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80425d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804262:	41 ff d4             	call   *%r12
+}
+  804265:	5b                   	pop    %rbx
+  804266:	41 5c                	pop    %r12
+  804268:	5d                   	pop    %rbp
+  804269:	c3                   	ret
+
+000000000080426a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80426a:	55                   	push   %rbp
+  80426b:	48 89 e5             	mov    %rsp,%rbp
+  80426e:	41 57                	push   %r15
+  804270:	41 56                	push   %r14
+  804272:	41 55                	push   %r13
+  804274:	41 54                	push   %r12
+  804276:	53                   	push   %rbx
+  804277:	48 83 ec 18          	sub    $0x18,%rsp
+  80427b:	49 89 fc             	mov    %rdi,%r12
+  80427e:	49 89 f5             	mov    %rsi,%r13
+  804281:	49 89 d7             	mov    %rdx,%r15
+  804284:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804288:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  80428f:	00 00 00 
+  804292:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804294:	4d 85 ff             	test   %r15,%r15
+  804297:	0f 84 af 00 00 00    	je     80434c <devpipe_write+0xe2>
+  80429d:	48 89 c3             	mov    %rax,%rbx
+  8042a0:	4c 89 f8             	mov    %r15,%rax
+  8042a3:	4d 89 ef             	mov    %r13,%r15
+  8042a6:	4c 01 e8             	add    %r13,%rax
+  8042a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8042ad:	49 bd 91 28 80 00 00 	movabs $0x802891,%r13
+  8042b4:	00 00 00 
+            sys_yield();
+  8042b7:	49 be 22 28 80 00 00 	movabs $0x802822,%r14
+  8042be:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8042c1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8042c4:	48 63 ce             	movslq %esi,%rcx
+  8042c7:	48 63 03             	movslq (%rbx),%rax
+  8042ca:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8042d0:	48 39 c1             	cmp    %rax,%rcx
+  8042d3:	72 2e                	jb     804303 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8042d5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8042da:	48 89 da             	mov    %rbx,%rdx
+  8042dd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042e2:	4c 89 e7             	mov    %r12,%rdi
+  8042e5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8042e8:	85 c0                	test   %eax,%eax
+  8042ea:	74 66                	je     804352 <devpipe_write+0xe8>
+            sys_yield();
+  8042ec:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8042ef:	8b 73 04             	mov    0x4(%rbx),%esi
+  8042f2:	48 63 ce             	movslq %esi,%rcx
+  8042f5:	48 63 03             	movslq (%rbx),%rax
+  8042f8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8042fe:	48 39 c1             	cmp    %rax,%rcx
+  804301:	73 d2                	jae    8042d5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804303:	41 0f b6 3f          	movzbl (%r15),%edi
+  804307:	48 89 ca             	mov    %rcx,%rdx
+  80430a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80430e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804315:	08 10 20 
+  804318:	48 f7 e2             	mul    %rdx
+  80431b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80431f:	48 89 d0             	mov    %rdx,%rax
+  804322:	48 c1 e0 09          	shl    $0x9,%rax
+  804326:	48 29 d0             	sub    %rdx,%rax
+  804329:	48 c1 e0 03          	shl    $0x3,%rax
+  80432d:	48 29 c1             	sub    %rax,%rcx
+  804330:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804335:	83 c6 01             	add    $0x1,%esi
+  804338:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80433b:	49 83 c7 01          	add    $0x1,%r15
+  80433f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804343:	49 39 c7             	cmp    %rax,%r15
+  804346:	0f 85 75 ff ff ff    	jne    8042c1 <devpipe_write+0x57>
+    return n;
+  80434c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804350:	eb 05                	jmp    804357 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804357:	48 83 c4 18          	add    $0x18,%rsp
+  80435b:	5b                   	pop    %rbx
+  80435c:	41 5c                	pop    %r12
+  80435e:	41 5d                	pop    %r13
+  804360:	41 5e                	pop    %r14
+  804362:	41 5f                	pop    %r15
+  804364:	5d                   	pop    %rbp
+  804365:	c3                   	ret
+
+0000000000804366 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804366:	55                   	push   %rbp
+  804367:	48 89 e5             	mov    %rsp,%rbp
+  80436a:	41 57                	push   %r15
+  80436c:	41 56                	push   %r14
+  80436e:	41 55                	push   %r13
+  804370:	41 54                	push   %r12
+  804372:	53                   	push   %rbx
+  804373:	48 83 ec 18          	sub    $0x18,%rsp
+  804377:	49 89 fc             	mov    %rdi,%r12
+  80437a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80437e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804382:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  804389:	00 00 00 
+  80438c:	ff d0                	call   *%rax
+  80438e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804391:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804397:	49 bd 91 28 80 00 00 	movabs $0x802891,%r13
+  80439e:	00 00 00 
+            sys_yield();
+  8043a1:	49 be 22 28 80 00 00 	movabs $0x802822,%r14
+  8043a8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8043ab:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8043b0:	74 7d                	je     80442f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8043b2:	8b 03                	mov    (%rbx),%eax
+  8043b4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8043b7:	75 26                	jne    8043df <devpipe_read+0x79>
+            if (i > 0) return i;
+  8043b9:	4d 85 ff             	test   %r15,%r15
+  8043bc:	75 77                	jne    804435 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043be:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043c3:	48 89 da             	mov    %rbx,%rdx
+  8043c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043cb:	4c 89 e7             	mov    %r12,%rdi
+  8043ce:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8043d1:	85 c0                	test   %eax,%eax
+  8043d3:	74 72                	je     804447 <devpipe_read+0xe1>
+            sys_yield();
+  8043d5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8043d8:	8b 03                	mov    (%rbx),%eax
+  8043da:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8043dd:	74 df                	je     8043be <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8043df:	48 63 c8             	movslq %eax,%rcx
+  8043e2:	48 89 ca             	mov    %rcx,%rdx
+  8043e5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8043e9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8043f0:	08 10 20 
+  8043f3:	48 89 d0             	mov    %rdx,%rax
+  8043f6:	48 f7 e6             	mul    %rsi
+  8043f9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8043fd:	48 89 d0             	mov    %rdx,%rax
+  804400:	48 c1 e0 09          	shl    $0x9,%rax
+  804404:	48 29 d0             	sub    %rdx,%rax
+  804407:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80440e:	00 
+  80440f:	48 89 c8             	mov    %rcx,%rax
+  804412:	48 29 d0             	sub    %rdx,%rax
+  804415:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80441a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80441e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804422:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804425:	49 83 c7 01          	add    $0x1,%r15
+  804429:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80442d:	75 83                	jne    8043b2 <devpipe_read+0x4c>
+    return n;
+  80442f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804433:	eb 03                	jmp    804438 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804435:	4c 89 f8             	mov    %r15,%rax
+}
+  804438:	48 83 c4 18          	add    $0x18,%rsp
+  80443c:	5b                   	pop    %rbx
+  80443d:	41 5c                	pop    %r12
+  80443f:	41 5d                	pop    %r13
+  804441:	41 5e                	pop    %r14
+  804443:	41 5f                	pop    %r15
+  804445:	5d                   	pop    %rbp
+  804446:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80444c:	eb ea                	jmp    804438 <devpipe_read+0xd2>
+
+000000000080444e <pipe>:
+pipe(int pfd[2]) {
+  80444e:	55                   	push   %rbp
+  80444f:	48 89 e5             	mov    %rsp,%rbp
+  804452:	41 55                	push   %r13
+  804454:	41 54                	push   %r12
+  804456:	53                   	push   %rbx
+  804457:	48 83 ec 18          	sub    $0x18,%rsp
+  80445b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80445e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804462:	48 b8 61 32 80 00 00 	movabs $0x803261,%rax
+  804469:	00 00 00 
+  80446c:	ff d0                	call   *%rax
+  80446e:	89 c3                	mov    %eax,%ebx
+  804470:	85 c0                	test   %eax,%eax
+  804472:	0f 88 a0 01 00 00    	js     804618 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804478:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80447d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804482:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804486:	bf 00 00 00 00       	mov    $0x0,%edi
+  80448b:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  804492:	00 00 00 
+  804495:	ff d0                	call   *%rax
+  804497:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804499:	85 c0                	test   %eax,%eax
+  80449b:	0f 88 77 01 00 00    	js     804618 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8044a1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8044a5:	48 b8 61 32 80 00 00 	movabs $0x803261,%rax
+  8044ac:	00 00 00 
+  8044af:	ff d0                	call   *%rax
+  8044b1:	89 c3                	mov    %eax,%ebx
+  8044b3:	85 c0                	test   %eax,%eax
+  8044b5:	0f 88 43 01 00 00    	js     8045fe <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8044bb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044c5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8044c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044ce:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  8044d5:	00 00 00 
+  8044d8:	ff d0                	call   *%rax
+  8044da:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8044dc:	85 c0                	test   %eax,%eax
+  8044de:	0f 88 1a 01 00 00    	js     8045fe <pipe+0x1b0>
+    va = fd2data(fd0);
+  8044e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8044e8:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  8044ef:	00 00 00 
+  8044f2:	ff d0                	call   *%rax
+  8044f4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8044f7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804501:	48 89 c6             	mov    %rax,%rsi
+  804504:	bf 00 00 00 00       	mov    $0x0,%edi
+  804509:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  804510:	00 00 00 
+  804513:	ff d0                	call   *%rax
+  804515:	89 c3                	mov    %eax,%ebx
+  804517:	85 c0                	test   %eax,%eax
+  804519:	0f 88 c5 00 00 00    	js     8045e4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80451f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804523:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  80452a:	00 00 00 
+  80452d:	ff d0                	call   *%rax
+  80452f:	48 89 c1             	mov    %rax,%rcx
+  804532:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804538:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80453e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804543:	4c 89 ee             	mov    %r13,%rsi
+  804546:	bf 00 00 00 00       	mov    $0x0,%edi
+  80454b:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  804552:	00 00 00 
+  804555:	ff d0                	call   *%rax
+  804557:	89 c3                	mov    %eax,%ebx
+  804559:	85 c0                	test   %eax,%eax
+  80455b:	78 6e                	js     8045cb <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80455d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804562:	4c 89 ef             	mov    %r13,%rdi
+  804565:	48 b8 59 28 80 00 00 	movabs $0x802859,%rax
+  80456c:	00 00 00 
+  80456f:	ff d0                	call   *%rax
+  804571:	83 f8 02             	cmp    $0x2,%eax
+  804574:	0f 85 ab 00 00 00    	jne    804625 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80457a:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804581:	00 00 
+  804583:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804587:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804589:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80458d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804594:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804598:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80459a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80459e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8045a5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8045a9:	48 bb 33 32 80 00 00 	movabs $0x803233,%rbx
+  8045b0:	00 00 00 
+  8045b3:	ff d3                	call   *%rbx
+  8045b5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8045b9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8045bd:	ff d3                	call   *%rbx
+  8045bf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8045c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045c9:	eb 4d                	jmp    804618 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8045cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045d0:	4c 89 ee             	mov    %r13,%rsi
+  8045d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045d8:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  8045df:	00 00 00 
+  8045e2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8045e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045e9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8045ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045f2:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  8045f9:	00 00 00 
+  8045fc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8045fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804603:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804607:	bf 00 00 00 00       	mov    $0x0,%edi
+  80460c:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  804613:	00 00 00 
+  804616:	ff d0                	call   *%rax
+}
+  804618:	89 d8                	mov    %ebx,%eax
+  80461a:	48 83 c4 18          	add    $0x18,%rsp
+  80461e:	5b                   	pop    %rbx
+  80461f:	41 5c                	pop    %r12
+  804621:	41 5d                	pop    %r13
+  804623:	5d                   	pop    %rbp
+  804624:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804625:	48 b9 98 64 80 00 00 	movabs $0x806498,%rcx
+  80462c:	00 00 00 
+  80462f:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  804636:	00 00 00 
+  804639:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80463e:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  804645:	00 00 00 
+  804648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464d:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  804654:	00 00 00 
+  804657:	41 ff d0             	call   *%r8
+
+000000000080465a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80465a:	55                   	push   %rbp
+  80465b:	48 89 e5             	mov    %rsp,%rbp
+  80465e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804662:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804666:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  80466d:	00 00 00 
+  804670:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804672:	85 c0                	test   %eax,%eax
+  804674:	78 35                	js     8046ab <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804676:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80467a:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  804681:	00 00 00 
+  804684:	ff d0                	call   *%rax
+  804686:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804689:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80468e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804693:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804697:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  80469e:	00 00 00 
+  8046a1:	ff d0                	call   *%rax
+  8046a3:	85 c0                	test   %eax,%eax
+  8046a5:	0f 94 c0             	sete   %al
+  8046a8:	0f b6 c0             	movzbl %al,%eax
+}
+  8046ab:	c9                   	leave
+  8046ac:	c3                   	ret
+
+00000000008046ad <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8046ad:	48 89 f8             	mov    %rdi,%rax
+  8046b0:	48 c1 e8 27          	shr    $0x27,%rax
+  8046b4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8046bb:	01 00 00 
+  8046be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046c2:	f6 c2 01             	test   $0x1,%dl
+  8046c5:	74 6d                	je     804734 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8046c7:	48 89 f8             	mov    %rdi,%rax
+  8046ca:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8046ce:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8046d5:	01 00 00 
+  8046d8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046dc:	f6 c2 01             	test   $0x1,%dl
+  8046df:	74 62                	je     804743 <get_uvpt_entry+0x96>
+  8046e1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8046e8:	01 00 00 
+  8046eb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046ef:	f6 c2 80             	test   $0x80,%dl
+  8046f2:	75 4f                	jne    804743 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8046f4:	48 89 f8             	mov    %rdi,%rax
+  8046f7:	48 c1 e8 15          	shr    $0x15,%rax
+  8046fb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804702:	01 00 00 
+  804705:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804709:	f6 c2 01             	test   $0x1,%dl
+  80470c:	74 44                	je     804752 <get_uvpt_entry+0xa5>
+  80470e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804715:	01 00 00 
+  804718:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80471c:	f6 c2 80             	test   $0x80,%dl
+  80471f:	75 31                	jne    804752 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804721:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804725:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80472c:	01 00 00 
+  80472f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804733:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804734:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80473b:	01 00 00 
+  80473e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804742:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804743:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80474a:	01 00 00 
+  80474d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804751:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804752:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804759:	01 00 00 
+  80475c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804760:	c3                   	ret
+
+0000000000804761 <get_prot>:
+
+int
+get_prot(void *va) {
+  804761:	55                   	push   %rbp
+  804762:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804765:	48 b8 ad 46 80 00 00 	movabs $0x8046ad,%rax
+  80476c:	00 00 00 
+  80476f:	ff d0                	call   *%rax
+  804771:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804774:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804779:	89 c1                	mov    %eax,%ecx
+  80477b:	83 c9 04             	or     $0x4,%ecx
+  80477e:	f6 c2 01             	test   $0x1,%dl
+  804781:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804784:	89 c1                	mov    %eax,%ecx
+  804786:	83 c9 02             	or     $0x2,%ecx
+  804789:	f6 c2 02             	test   $0x2,%dl
+  80478c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80478f:	89 c1                	mov    %eax,%ecx
+  804791:	83 c9 01             	or     $0x1,%ecx
+  804794:	48 85 d2             	test   %rdx,%rdx
+  804797:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80479a:	89 c1                	mov    %eax,%ecx
+  80479c:	83 c9 40             	or     $0x40,%ecx
+  80479f:	f6 c6 04             	test   $0x4,%dh
+  8047a2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8047a5:	5d                   	pop    %rbp
+  8047a6:	c3                   	ret
+
+00000000008047a7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8047a7:	55                   	push   %rbp
+  8047a8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8047ab:	48 b8 ad 46 80 00 00 	movabs $0x8046ad,%rax
+  8047b2:	00 00 00 
+  8047b5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8047b7:	48 c1 e8 06          	shr    $0x6,%rax
+  8047bb:	83 e0 01             	and    $0x1,%eax
+}
+  8047be:	5d                   	pop    %rbp
+  8047bf:	c3                   	ret
+
+00000000008047c0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8047c0:	55                   	push   %rbp
+  8047c1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8047c4:	48 b8 ad 46 80 00 00 	movabs $0x8046ad,%rax
+  8047cb:	00 00 00 
+  8047ce:	ff d0                	call   *%rax
+  8047d0:	83 e0 01             	and    $0x1,%eax
+}
+  8047d3:	5d                   	pop    %rbp
+  8047d4:	c3                   	ret
+
+00000000008047d5 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8047d5:	55                   	push   %rbp
+  8047d6:	48 89 e5             	mov    %rsp,%rbp
+  8047d9:	41 57                	push   %r15
+  8047db:	41 56                	push   %r14
+  8047dd:	41 55                	push   %r13
+  8047df:	41 54                	push   %r12
+  8047e1:	53                   	push   %rbx
+  8047e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8047e6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8047ea:	48 85 ff             	test   %rdi,%rdi
+  8047ed:	74 1e                	je     80480d <foreach_shared_region+0x38>
+  8047ef:	49 89 ff             	mov    %rdi,%r15
+  8047f2:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8047f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8047fe:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804805:	01 00 00 
+  804808:	e9 72 02 00 00       	jmp    804a7f <foreach_shared_region+0x2aa>
+    assert(fun);
+  80480d:	48 b9 bc 64 80 00 00 	movabs $0x8064bc,%rcx
+  804814:	00 00 00 
+  804817:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  80481e:	00 00 00 
+  804821:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804826:	48 bf c0 64 80 00 00 	movabs $0x8064c0,%rdi
+  80482d:	00 00 00 
+  804830:	b8 00 00 00 00       	mov    $0x0,%eax
+  804835:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  80483c:	00 00 00 
+  80483f:	41 ff d0             	call   *%r8
+  804842:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804849:	eb 6c                	jmp    8048b7 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80484b:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804852:	ff ff ff 
+  804855:	4c 21 e2             	and    %r12,%rdx
+  804858:	48 89 d8             	mov    %rbx,%rax
+  80485b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804860:	48 83 c0 01          	add    $0x1,%rax
+  804864:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804868:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80486f:	00 00 00 
+  804872:	48 21 c8             	and    %rcx,%rax
+  804875:	48 09 d0             	or     %rdx,%rax
+  804878:	49 89 c4             	mov    %rax,%r12
+  80487b:	eb 30                	jmp    8048ad <foreach_shared_region+0xd8>
+  80487d:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804884:	ff ff ff 
+  804887:	4c 21 e2             	and    %r12,%rdx
+  80488a:	48 89 d8             	mov    %rbx,%rax
+  80488d:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804892:	48 83 c0 01          	add    $0x1,%rax
+  804896:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80489a:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8048a1:	00 00 00 
+  8048a4:	48 21 c8             	and    %rcx,%rax
+  8048a7:	48 09 d0             	or     %rdx,%rax
+  8048aa:	49 89 c4             	mov    %rax,%r12
+  8048ad:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8048b1:	0f 84 99 01 00 00    	je     804a50 <foreach_shared_region+0x27b>
+  8048b7:	4c 89 e3             	mov    %r12,%rbx
+  8048ba:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8048be:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8048c5:	01 00 00 
+  8048c8:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8048cc:	a8 01                	test   $0x1,%al
+  8048ce:	0f 84 77 ff ff ff    	je     80484b <foreach_shared_region+0x76>
+  8048d4:	a8 80                	test   $0x80,%al
+  8048d6:	74 19                	je     8048f1 <foreach_shared_region+0x11c>
+  8048d8:	f6 c4 04             	test   $0x4,%ah
+  8048db:	74 a0                	je     80487d <foreach_shared_region+0xa8>
+  8048dd:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8048e4:	40 
+  8048e5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048e9:	4c 89 e7             	mov    %r12,%rdi
+  8048ec:	41 ff d7             	call   *%r15
+  8048ef:	eb 8c                	jmp    80487d <foreach_shared_region+0xa8>
+  8048f1:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8048f8:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8048fc:	eb 46                	jmp    804944 <foreach_shared_region+0x16f>
+  8048fe:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804905:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80490b:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80490f:	48 c1 e0 15          	shl    $0x15,%rax
+  804913:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804918:	49 09 c4             	or     %rax,%r12
+  80491b:	eb 1d                	jmp    80493a <foreach_shared_region+0x165>
+  80491d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804924:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80492a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80492e:	48 c1 e0 15          	shl    $0x15,%rax
+  804932:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804937:	49 09 c4             	or     %rax,%r12
+  80493a:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80493e:	0f 84 d3 00 00 00    	je     804a17 <foreach_shared_region+0x242>
+  804944:	4c 89 e3             	mov    %r12,%rbx
+  804947:	48 c1 eb 15          	shr    $0x15,%rbx
+  80494b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804952:	01 00 00 
+  804955:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804959:	a8 01                	test   $0x1,%al
+  80495b:	74 a1                	je     8048fe <foreach_shared_region+0x129>
+  80495d:	a8 80                	test   $0x80,%al
+  80495f:	74 19                	je     80497a <foreach_shared_region+0x1a5>
+  804961:	f6 c4 04             	test   $0x4,%ah
+  804964:	74 b7                	je     80491d <foreach_shared_region+0x148>
+  804966:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80496d:	00 
+  80496e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804972:	4c 89 e7             	mov    %r12,%rdi
+  804975:	41 ff d7             	call   *%r15
+  804978:	eb a3                	jmp    80491d <foreach_shared_region+0x148>
+  80497a:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804980:	eb 3b                	jmp    8049bd <foreach_shared_region+0x1e8>
+  804982:	f6 c4 04             	test   $0x4,%ah
+  804985:	74 12                	je     804999 <foreach_shared_region+0x1c4>
+  804987:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80498e:	00 
+  80498f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804993:	4c 89 e7             	mov    %r12,%rdi
+  804996:	41 ff d7             	call   *%r15
+  804999:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8049a0:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049a6:	48 83 c3 01          	add    $0x1,%rbx
+  8049aa:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8049ae:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8049b4:	49 09 dc             	or     %rbx,%r12
+  8049b7:	41 83 ed 01          	sub    $0x1,%r13d
+  8049bb:	74 2f                	je     8049ec <foreach_shared_region+0x217>
+  8049bd:	4c 89 e3             	mov    %r12,%rbx
+  8049c0:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8049c4:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8049c8:	a8 01                	test   $0x1,%al
+  8049ca:	75 b6                	jne    804982 <foreach_shared_region+0x1ad>
+  8049cc:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8049d3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049d9:	48 83 c3 01          	add    $0x1,%rbx
+  8049dd:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8049e1:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8049e7:	49 09 dc             	or     %rbx,%r12
+  8049ea:	eb cb                	jmp    8049b7 <foreach_shared_region+0x1e2>
+  8049ec:	4c 89 e0             	mov    %r12,%rax
+  8049ef:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8049f5:	49 c1 ec 15          	shr    $0x15,%r12
+  8049f9:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804a00:	49 83 c4 01          	add    $0x1,%r12
+  804a04:	49 c1 e4 15          	shl    $0x15,%r12
+  804a08:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804a0f:	49 09 c4             	or     %rax,%r12
+  804a12:	e9 23 ff ff ff       	jmp    80493a <foreach_shared_region+0x165>
+  804a17:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804a1b:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804a22:	ff ff ff 
+  804a25:	4c 21 e0             	and    %r12,%rax
+  804a28:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804a2c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804a33:	49 83 c4 01          	add    $0x1,%r12
+  804a37:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804a3b:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804a42:	00 00 00 
+  804a45:	49 21 d4             	and    %rdx,%r12
+  804a48:	49 09 c4             	or     %rax,%r12
+  804a4b:	e9 5d fe ff ff       	jmp    8048ad <foreach_shared_region+0xd8>
+  804a50:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804a57:	00 ff ff 
+  804a5a:	4c 21 e0             	and    %r12,%rax
+  804a5d:	49 c1 ec 27          	shr    $0x27,%r12
+  804a61:	49 83 c4 01          	add    $0x1,%r12
+  804a65:	49 c1 e4 27          	shl    $0x27,%r12
+  804a69:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804a70:	ff 00 00 
+  804a73:	49 21 d4             	and    %rdx,%r12
+  804a76:	49 09 c4             	or     %rax,%r12
+  804a79:	41 83 ed 01          	sub    $0x1,%r13d
+  804a7d:	74 48                	je     804ac7 <foreach_shared_region+0x2f2>
+  804a7f:	4c 89 e0             	mov    %r12,%rax
+  804a82:	48 c1 e8 27          	shr    $0x27,%rax
+  804a86:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804a8d:	01 00 00 
+  804a90:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804a94:	f6 c2 01             	test   $0x1,%dl
+  804a97:	0f 85 a5 fd ff ff    	jne    804842 <foreach_shared_region+0x6d>
+  804a9d:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804aa4:	00 ff ff 
+  804aa7:	4c 21 e2             	and    %r12,%rdx
+  804aaa:	48 83 c0 01          	add    $0x1,%rax
+  804aae:	48 c1 e0 27          	shl    $0x27,%rax
+  804ab2:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804ab9:	ff 00 00 
+  804abc:	48 21 c8             	and    %rcx,%rax
+  804abf:	48 09 d0             	or     %rdx,%rax
+  804ac2:	49 89 c4             	mov    %rax,%r12
+  804ac5:	eb b2                	jmp    804a79 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804ac7:	4d 85 e4             	test   %r12,%r12
+  804aca:	75 14                	jne    804ae0 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ad1:	48 83 c4 28          	add    $0x28,%rsp
+  804ad5:	5b                   	pop    %rbx
+  804ad6:	41 5c                	pop    %r12
+  804ad8:	41 5d                	pop    %r13
+  804ada:	41 5e                	pop    %r14
+  804adc:	41 5f                	pop    %r15
+  804ade:	5d                   	pop    %rbp
+  804adf:	c3                   	ret
+    assert(addr == 0);
+  804ae0:	48 b9 cb 64 80 00 00 	movabs $0x8064cb,%rcx
+  804ae7:	00 00 00 
+  804aea:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  804af1:	00 00 00 
+  804af4:	be 67 00 00 00       	mov    $0x67,%esi
+  804af9:	48 bf c0 64 80 00 00 	movabs $0x8064c0,%rdi
+  804b00:	00 00 00 
+  804b03:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b08:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  804b0f:	00 00 00 
+  804b12:	41 ff d0             	call   *%r8
+
+0000000000804b15 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804b15:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804b1c:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804b1f:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804b25:	eb 33                	jmp    804b5a <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804b27:	48 83 c0 20          	add    $0x20,%rax
+  804b2b:	4c 39 c0             	cmp    %r8,%rax
+  804b2e:	74 25                	je     804b55 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804b30:	48 8b 10             	mov    (%rax),%rdx
+  804b33:	48 85 d2             	test   %rdx,%rdx
+  804b36:	74 ef                	je     804b27 <mmap_place+0x12>
+  804b38:	48 89 d1             	mov    %rdx,%rcx
+  804b3b:	48 03 48 08          	add    0x8(%rax),%rcx
+  804b3f:	48 39 cf             	cmp    %rcx,%rdi
+  804b42:	73 e3                	jae    804b27 <mmap_place+0x12>
+  804b44:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804b48:	4c 39 ca             	cmp    %r9,%rdx
+  804b4b:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804b4f:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804b53:	eb d2                	jmp    804b27 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804b55:	45 84 d2             	test   %r10b,%r10b
+  804b58:	74 12                	je     804b6c <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804b5a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b61:	00 00 00 
+        moved = 0;
+  804b64:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804b6a:	eb c4                	jmp    804b30 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804b6c:	48 01 fe             	add    %rdi,%rsi
+  804b6f:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804b76:	00 00 00 
+  804b79:	48 39 f0             	cmp    %rsi,%rax
+  804b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b81:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804b85:	c3                   	ret
+
+0000000000804b86 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804b86:	55                   	push   %rbp
+  804b87:	48 89 e5             	mov    %rsp,%rbp
+  804b8a:	41 57                	push   %r15
+  804b8c:	41 56                	push   %r14
+  804b8e:	41 55                	push   %r13
+  804b90:	41 54                	push   %r12
+  804b92:	53                   	push   %rbx
+  804b93:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804b97:	48 8b 1f             	mov    (%rdi),%rbx
+  804b9a:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ba1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804ba8:	00 00 00 
+  804bab:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bb0:	eb 12                	jmp    804bc4 <mmap_pgfault+0x3e>
+  804bb2:	48 83 c2 01          	add    $0x1,%rdx
+  804bb6:	48 83 c0 20          	add    $0x20,%rax
+  804bba:	48 83 fa 20          	cmp    $0x20,%rdx
+  804bbe:	0f 84 04 01 00 00    	je     804cc8 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804bc4:	48 8b 08             	mov    (%rax),%rcx
+  804bc7:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804bcb:	48 39 de             	cmp    %rbx,%rsi
+  804bce:	73 e2                	jae    804bb2 <mmap_pgfault+0x2c>
+  804bd0:	48 03 48 08          	add    0x8(%rax),%rcx
+  804bd4:	48 39 cb             	cmp    %rcx,%rbx
+  804bd7:	73 d9                	jae    804bb2 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804bd9:	48 c1 e2 05          	shl    $0x5,%rdx
+  804bdd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804be4:	00 00 00 
+  804be7:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804beb:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804bef:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804bf3:	f6 c2 01             	test   $0x1,%dl
+  804bf6:	0f 84 e0 00 00 00    	je     804cdc <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c01:	f6 c2 02             	test   $0x2,%dl
+  804c04:	0f 84 c3 00 00 00    	je     804ccd <mmap_pgfault+0x147>
+  804c0a:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c11:	ff ff ff 
+  804c14:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804c18:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804c1f:	00 00 00 
+  804c22:	48 39 ca             	cmp    %rcx,%rdx
+  804c25:	0f 85 a2 00 00 00    	jne    804ccd <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804c2b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804c30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c35:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804c3c:	00 00 00 
+  804c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c44:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  804c4b:	00 00 00 
+  804c4e:	ff d0                	call   *%rax
+  804c50:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c57:	85 d2                	test   %edx,%edx
+  804c59:	78 72                	js     804ccd <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804c5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c60:	48 89 de             	mov    %rbx,%rsi
+  804c63:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804c6a:	00 00 00 
+  804c6d:	4c 89 e7             	mov    %r12,%rdi
+  804c70:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  804c77:	00 00 00 
+  804c7a:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804c7c:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804c82:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804c88:	48 89 d9             	mov    %rbx,%rcx
+  804c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c90:	4c 89 e6             	mov    %r12,%rsi
+  804c93:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c98:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  804c9f:	00 00 00 
+  804ca2:	ff d0                	call   *%rax
+  804ca4:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804ca6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cab:	4c 89 e6             	mov    %r12,%rsi
+  804cae:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cb3:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  804cba:	00 00 00 
+  804cbd:	ff d0                	call   *%rax
+    return res >= 0;
+  804cbf:	89 d8                	mov    %ebx,%eax
+  804cc1:	f7 d0                	not    %eax
+  804cc3:	c1 e8 1f             	shr    $0x1f,%eax
+  804cc6:	eb 05                	jmp    804ccd <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804ccd:	48 83 c4 18          	add    $0x18,%rsp
+  804cd1:	5b                   	pop    %rbx
+  804cd2:	41 5c                	pop    %r12
+  804cd4:	41 5d                	pop    %r13
+  804cd6:	41 5e                	pop    %r14
+  804cd8:	41 5f                	pop    %r15
+  804cda:	5d                   	pop    %rbp
+  804cdb:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804cdc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ce0:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804ce4:	4c 03 30             	add    (%rax),%r14
+  804ce7:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804cee:	49 39 c6             	cmp    %rax,%r14
+  804cf1:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804cf5:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804cfc:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804d02:	49 bf c0 47 80 00 00 	movabs $0x8047c0,%r15
+  804d09:	00 00 00 
+  804d0c:	4d 39 f4             	cmp    %r14,%r12
+  804d0f:	73 1d                	jae    804d2e <mmap_pgfault+0x1a8>
+  804d11:	4c 89 e7             	mov    %r12,%rdi
+  804d14:	41 ff d7             	call   *%r15
+  804d17:	84 c0                	test   %al,%al
+  804d19:	75 13                	jne    804d2e <mmap_pgfault+0x1a8>
+  804d1b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804d22:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804d29:	4d 39 f4             	cmp    %r14,%r12
+  804d2c:	72 e3                	jb     804d11 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804d2e:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804d34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d38:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804d3c:	74 2a                	je     804d68 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804d3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d42:	89 de                	mov    %ebx,%esi
+  804d44:	2b 30                	sub    (%rax),%esi
+  804d46:	03 70 1c             	add    0x1c(%rax),%esi
+  804d49:	8b 78 18             	mov    0x18(%rax),%edi
+  804d4c:	4c 89 e9             	mov    %r13,%rcx
+  804d4f:	48 89 da             	mov    %rbx,%rdx
+  804d52:	48 b8 1e 3f 80 00 00 	movabs $0x803f1e,%rax
+  804d59:	00 00 00 
+  804d5c:	ff d0                	call   *%rax
+    return res > 0;
+  804d5e:	85 c0                	test   %eax,%eax
+  804d60:	0f 9f c0             	setg   %al
+  804d63:	e9 65 ff ff ff       	jmp    804ccd <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804d68:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804d6c:	eb d0                	jmp    804d3e <mmap_pgfault+0x1b8>
+
+0000000000804d6e <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804d6e:	55                   	push   %rbp
+  804d6f:	48 89 e5             	mov    %rsp,%rbp
+  804d72:	41 57                	push   %r15
+  804d74:	41 56                	push   %r14
+  804d76:	41 55                	push   %r13
+  804d78:	41 54                	push   %r12
+  804d7a:	53                   	push   %rbx
+  804d7b:	48 83 ec 28          	sub    $0x28,%rsp
+  804d7f:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804d83:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804d86:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804d8d:	ff ff ff 
+  804d90:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d99:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804da0:	00 00 00 
+  804da3:	48 39 ca             	cmp    %rcx,%rdx
+  804da6:	0f 85 e5 00 00 00    	jne    804e91 <mmap_writeback+0x123>
+  804dac:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804daf:	4c 39 ee             	cmp    %r13,%rsi
+  804db2:	0f 83 e8 00 00 00    	jae    804ea0 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804db8:	49 be c0 47 80 00 00 	movabs $0x8047c0,%r14
+  804dbf:	00 00 00 
+  804dc2:	49 bf a7 47 80 00 00 	movabs $0x8047a7,%r15
+  804dc9:	00 00 00 
+  804dcc:	eb 10                	jmp    804dde <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804dce:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804dd5:	4d 39 ec             	cmp    %r13,%r12
+  804dd8:	0f 83 ae 00 00 00    	jae    804e8c <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804dde:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804de2:	4c 89 e7             	mov    %r12,%rdi
+  804de5:	41 ff d6             	call   *%r14
+  804de8:	84 c0                	test   %al,%al
+  804dea:	74 e2                	je     804dce <mmap_writeback+0x60>
+  804dec:	4c 89 e7             	mov    %r12,%rdi
+  804def:	41 ff d7             	call   *%r15
+  804df2:	84 c0                	test   %al,%al
+  804df4:	74 d8                	je     804dce <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804df6:	4c 89 e3             	mov    %r12,%rbx
+  804df9:	4d 39 ec             	cmp    %r13,%r12
+  804dfc:	73 20                	jae    804e1e <mmap_writeback+0xb0>
+  804dfe:	48 89 df             	mov    %rbx,%rdi
+  804e01:	41 ff d6             	call   *%r14
+  804e04:	84 c0                	test   %al,%al
+  804e06:	74 16                	je     804e1e <mmap_writeback+0xb0>
+  804e08:	48 89 df             	mov    %rbx,%rdi
+  804e0b:	41 ff d7             	call   *%r15
+  804e0e:	84 c0                	test   %al,%al
+  804e10:	74 0c                	je     804e1e <mmap_writeback+0xb0>
+  804e12:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804e19:	4c 39 eb             	cmp    %r13,%rbx
+  804e1c:	72 e0                	jb     804dfe <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804e1e:	48 89 d9             	mov    %rbx,%rcx
+  804e21:	4c 29 e1             	sub    %r12,%rcx
+  804e24:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e28:	44 89 e6             	mov    %r12d,%esi
+  804e2b:	2b 30                	sub    (%rax),%esi
+  804e2d:	49 89 c4             	mov    %rax,%r12
+  804e30:	03 70 1c             	add    0x1c(%rax),%esi
+  804e33:	8b 78 18             	mov    0x18(%rax),%edi
+  804e36:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804e3a:	48 89 ca             	mov    %rcx,%rdx
+  804e3d:	48 b8 a7 3f 80 00 00 	movabs $0x803fa7,%rax
+  804e44:	00 00 00 
+  804e47:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804e49:	85 c0                	test   %eax,%eax
+  804e4b:	78 44                	js     804e91 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804e4d:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804e52:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804e55:	41 89 c1             	mov    %eax,%r9d
+  804e58:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804e5f:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804e63:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e6c:	48 89 ce             	mov    %rcx,%rsi
+  804e6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e74:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  804e7b:	00 00 00 
+  804e7e:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804e80:	85 c0                	test   %eax,%eax
+  804e82:	78 0d                	js     804e91 <mmap_writeback+0x123>
+  804e84:	49 89 dc             	mov    %rbx,%r12
+  804e87:	e9 49 ff ff ff       	jmp    804dd5 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e91:	48 83 c4 28          	add    $0x28,%rsp
+  804e95:	5b                   	pop    %rbx
+  804e96:	41 5c                	pop    %r12
+  804e98:	41 5d                	pop    %r13
+  804e9a:	41 5e                	pop    %r14
+  804e9c:	41 5f                	pop    %r15
+  804e9e:	5d                   	pop    %rbp
+  804e9f:	c3                   	ret
+    return 0;
+  804ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ea5:	eb ea                	jmp    804e91 <mmap_writeback+0x123>
+
+0000000000804ea7 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804ea7:	55                   	push   %rbp
+  804ea8:	48 89 e5             	mov    %rsp,%rbp
+  804eab:	41 57                	push   %r15
+  804ead:	41 56                	push   %r14
+  804eaf:	41 55                	push   %r13
+  804eb1:	41 54                	push   %r12
+  804eb3:	53                   	push   %rbx
+  804eb4:	48 83 ec 38          	sub    $0x38,%rsp
+  804eb8:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804ebc:	48 85 f6             	test   %rsi,%rsi
+  804ebf:	0f 84 0c 02 00 00    	je     8050d1 <mmap+0x22a>
+  804ec5:	49 89 ff             	mov    %rdi,%r15
+  804ec8:	49 89 f4             	mov    %rsi,%r12
+  804ecb:	41 89 d5             	mov    %edx,%r13d
+  804ece:	41 89 ce             	mov    %ecx,%r14d
+  804ed1:	44 89 cb             	mov    %r9d,%ebx
+  804ed4:	45 85 c9             	test   %r9d,%r9d
+  804ed7:	0f 88 f4 01 00 00    	js     8050d1 <mmap+0x22a>
+  804edd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ee4:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804eeb:	0f 85 e7 01 00 00    	jne    8050d8 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804ef1:	83 e2 fd             	and    $0xfffffffd,%edx
+  804ef4:	83 fa 04             	cmp    $0x4,%edx
+  804ef7:	0f 85 db 01 00 00    	jne    8050d8 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804efd:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804f00:	83 fa 01             	cmp    $0x1,%edx
+  804f03:	0f 87 cf 01 00 00    	ja     8050d8 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804f09:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804f0d:	44 89 c7             	mov    %r8d,%edi
+  804f10:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  804f17:	00 00 00 
+  804f1a:	ff d0                	call   *%rax
+  804f1c:	89 c2                	mov    %eax,%edx
+  804f1e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f25:	85 d2                	test   %edx,%edx
+  804f27:	0f 88 ab 01 00 00    	js     8050d8 <mmap+0x231>
+  804f2d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f31:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804f38:	00 00 00 
+  804f3b:	8b 09                	mov    (%rcx),%ecx
+  804f3d:	39 0a                	cmp    %ecx,(%rdx)
+  804f3f:	0f 85 93 01 00 00    	jne    8050d8 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804f45:	8b 52 08             	mov    0x8(%rdx),%edx
+  804f48:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804f4b:	83 fa 01             	cmp    $0x1,%edx
+  804f4e:	0f 84 84 01 00 00    	je     8050d8 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804f54:	41 83 fe 01          	cmp    $0x1,%r14d
+  804f58:	74 42                	je     804f9c <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804f5a:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804f61:	4c 89 e6             	mov    %r12,%rsi
+  804f64:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804f6b:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804f6f:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804f73:	4d 85 ff             	test   %r15,%r15
+  804f76:	74 67                	je     804fdf <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804f78:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804f7f:	75 0f                	jne    804f90 <mmap+0xe9>
+  804f81:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804f88:	00 00 00 
+  804f8b:	49 39 c7             	cmp    %rax,%r15
+  804f8e:	77 1b                	ja     804fab <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804f90:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f97:	e9 3c 01 00 00       	jmp    8050d8 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804f9c:	41 f6 c5 02          	test   $0x2,%r13b
+  804fa0:	74 b8                	je     804f5a <mmap+0xb3>
+  804fa2:	85 d2                	test   %edx,%edx
+  804fa4:	75 b4                	jne    804f5a <mmap+0xb3>
+  804fa6:	e9 2d 01 00 00       	jmp    8050d8 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804fab:	4c 89 ff             	mov    %r15,%rdi
+  804fae:	48 b8 15 4b 80 00 00 	movabs $0x804b15,%rax
+  804fb5:	00 00 00 
+  804fb8:	ff d0                	call   *%rax
+  804fba:	48 89 c2             	mov    %rax,%rdx
+  804fbd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804fc4:	49 39 d7             	cmp    %rdx,%r15
+  804fc7:	0f 85 0b 01 00 00    	jne    8050d8 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804fcd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804fd4:	00 00 00 
+  804fd7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804fdd:	eb 44                	jmp    805023 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804fdf:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804fe3:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804fea:	00 00 00 
+  804fed:	48 b8 15 4b 80 00 00 	movabs $0x804b15,%rax
+  804ff4:	00 00 00 
+  804ff7:	ff d0                	call   *%rax
+  804ff9:	48 89 c7             	mov    %rax,%rdi
+  804ffc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805000:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805007:	48 85 ff             	test   %rdi,%rdi
+  80500a:	75 c1                	jne    804fcd <mmap+0x126>
+  80500c:	e9 c7 00 00 00       	jmp    8050d8 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805011:	49 83 c4 01          	add    $0x1,%r12
+  805015:	48 83 c0 20          	add    $0x20,%rax
+  805019:	49 83 fc 20          	cmp    $0x20,%r12
+  80501d:	0f 84 a5 00 00 00    	je     8050c8 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805023:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805027:	75 e8                	jne    805011 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805029:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80502d:	48 b8 61 32 80 00 00 	movabs $0x803261,%rax
+  805034:	00 00 00 
+  805037:	ff d0                	call   *%rax
+  805039:	89 c2                	mov    %eax,%edx
+  80503b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805042:	85 d2                	test   %edx,%edx
+  805044:	0f 88 8e 00 00 00    	js     8050d8 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  80504a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80504e:	48 b8 33 32 80 00 00 	movabs $0x803233,%rax
+  805055:	00 00 00 
+  805058:	ff d0                	call   *%rax
+  80505a:	89 c6                	mov    %eax,%esi
+  80505c:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80505f:	48 b8 81 34 80 00 00 	movabs $0x803481,%rax
+  805066:	00 00 00 
+  805069:	ff d0                	call   *%rax
+  80506b:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  80506e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805075:	45 85 ff             	test   %r15d,%r15d
+  805078:	78 5e                	js     8050d8 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80507a:	49 c1 e4 05          	shl    $0x5,%r12
+  80507e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805085:	00 00 00 
+  805088:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  80508b:	48 bf 86 4b 80 00 00 	movabs $0x804b86,%rdi
+  805092:	00 00 00 
+  805095:	48 b8 ab 2f 80 00 00 	movabs $0x802fab,%rax
+  80509c:	00 00 00 
+  80509f:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  8050a1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8050a5:	49 89 04 24          	mov    %rax,(%r12)
+  8050a9:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  8050ad:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8050b2:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8050b7:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8050bc:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8050c1:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8050c6:	eb 10                	jmp    8050d8 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8050c8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050cf:	eb 07                	jmp    8050d8 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8050d1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8050d8:	48 83 c4 38          	add    $0x38,%rsp
+  8050dc:	5b                   	pop    %rbx
+  8050dd:	41 5c                	pop    %r12
+  8050df:	41 5d                	pop    %r13
+  8050e1:	41 5e                	pop    %r14
+  8050e3:	41 5f                	pop    %r15
+  8050e5:	5d                   	pop    %rbp
+  8050e6:	c3                   	ret
+
+00000000008050e7 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8050e7:	55                   	push   %rbp
+  8050e8:	48 89 e5             	mov    %rsp,%rbp
+  8050eb:	41 57                	push   %r15
+  8050ed:	41 56                	push   %r14
+  8050ef:	41 55                	push   %r13
+  8050f1:	41 54                	push   %r12
+  8050f3:	53                   	push   %rbx
+  8050f4:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8050f8:	49 89 fe             	mov    %rdi,%r14
+  8050fb:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805102:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805109:	00 
+  80510a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805111:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805118:	00 00 00 
+  80511b:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805122:	49 bf 6e 4d 80 00 00 	movabs $0x804d6e,%r15
+  805129:	00 00 00 
+  80512c:	eb 09                	jmp    805137 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80512e:	48 83 c3 20          	add    $0x20,%rbx
+  805132:	4c 39 eb             	cmp    %r13,%rbx
+  805135:	74 33                	je     80516a <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805137:	48 89 df             	mov    %rbx,%rdi
+  80513a:	48 8b 33             	mov    (%rbx),%rsi
+  80513d:	4c 39 e6             	cmp    %r12,%rsi
+  805140:	73 ec                	jae    80512e <msync+0x47>
+  805142:	48 85 f6             	test   %rsi,%rsi
+  805145:	74 e7                	je     80512e <msync+0x47>
+  805147:	48 89 f2             	mov    %rsi,%rdx
+  80514a:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80514e:	49 39 d6             	cmp    %rdx,%r14
+  805151:	73 db                	jae    80512e <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805153:	4c 39 e2             	cmp    %r12,%rdx
+  805156:	49 0f 47 d4          	cmova  %r12,%rdx
+  80515a:	4c 39 f6             	cmp    %r14,%rsi
+  80515d:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805161:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805164:	85 c0                	test   %eax,%eax
+  805166:	79 c6                	jns    80512e <msync+0x47>
+  805168:	eb 05                	jmp    80516f <msync+0x88>
+    }
+
+    return 0;
+  80516a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80516f:	48 83 c4 08          	add    $0x8,%rsp
+  805173:	5b                   	pop    %rbx
+  805174:	41 5c                	pop    %r12
+  805176:	41 5d                	pop    %r13
+  805178:	41 5e                	pop    %r14
+  80517a:	41 5f                	pop    %r15
+  80517c:	5d                   	pop    %rbp
+  80517d:	c3                   	ret
+
+000000000080517e <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  80517e:	55                   	push   %rbp
+  80517f:	48 89 e5             	mov    %rsp,%rbp
+  805182:	41 57                	push   %r15
+  805184:	41 56                	push   %r14
+  805186:	41 55                	push   %r13
+  805188:	41 54                	push   %r12
+  80518a:	53                   	push   %rbx
+  80518b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80518f:	49 89 ff             	mov    %rdi,%r15
+  805192:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805199:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8051a0:	00 
+  8051a1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051a8:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8051af:	00 00 00 
+  8051b2:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8051b9:	48 89 d8             	mov    %rbx,%rax
+  8051bc:	eb 09                	jmp    8051c7 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051be:	48 83 c0 20          	add    $0x20,%rax
+  8051c2:	4c 39 f0             	cmp    %r14,%rax
+  8051c5:	74 40                	je     805207 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8051c7:	48 8b 10             	mov    (%rax),%rdx
+  8051ca:	4c 39 e2             	cmp    %r12,%rdx
+  8051cd:	73 ef                	jae    8051be <munmap+0x40>
+  8051cf:	48 85 d2             	test   %rdx,%rdx
+  8051d2:	74 ea                	je     8051be <munmap+0x40>
+  8051d4:	48 89 d7             	mov    %rdx,%rdi
+  8051d7:	48 03 78 08          	add    0x8(%rax),%rdi
+  8051db:	49 39 ff             	cmp    %rdi,%r15
+  8051de:	73 de                	jae    8051be <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8051e0:	49 39 fc             	cmp    %rdi,%r12
+  8051e3:	72 05                	jb     8051ea <munmap+0x6c>
+  8051e5:	4c 39 fa             	cmp    %r15,%rdx
+  8051e8:	73 d4                	jae    8051be <munmap+0x40>
+  8051ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8051ef:	48 83 c4 08          	add    $0x8,%rsp
+  8051f3:	5b                   	pop    %rbx
+  8051f4:	41 5c                	pop    %r12
+  8051f6:	41 5d                	pop    %r13
+  8051f8:	41 5e                	pop    %r14
+  8051fa:	41 5f                	pop    %r15
+  8051fc:	5d                   	pop    %rbp
+  8051fd:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051fe:	48 83 c3 20          	add    $0x20,%rbx
+  805202:	4c 39 f3             	cmp    %r14,%rbx
+  805205:	74 5c                	je     805263 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805207:	48 8b 33             	mov    (%rbx),%rsi
+  80520a:	4c 39 e6             	cmp    %r12,%rsi
+  80520d:	73 ef                	jae    8051fe <munmap+0x80>
+  80520f:	48 85 f6             	test   %rsi,%rsi
+  805212:	74 ea                	je     8051fe <munmap+0x80>
+  805214:	48 89 f2             	mov    %rsi,%rdx
+  805217:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80521b:	49 39 d7             	cmp    %rdx,%r15
+  80521e:	73 de                	jae    8051fe <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805220:	48 89 df             	mov    %rbx,%rdi
+  805223:	48 b8 6e 4d 80 00 00 	movabs $0x804d6e,%rax
+  80522a:	00 00 00 
+  80522d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80522f:	85 c0                	test   %eax,%eax
+  805231:	78 bc                	js     8051ef <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805233:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805237:	48 8b 33             	mov    (%rbx),%rsi
+  80523a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80523f:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  805246:	00 00 00 
+  805249:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80524b:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80524e:	48 b8 26 34 80 00 00 	movabs $0x803426,%rax
+  805255:	00 00 00 
+  805258:	ff d0                	call   *%rax
+        reg->start = 0;
+  80525a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805261:	eb 9b                	jmp    8051fe <munmap+0x80>
+    return 0;
+  805263:	b8 00 00 00 00       	mov    $0x0,%eax
+  805268:	eb 85                	jmp    8051ef <munmap+0x71>
+
+000000000080526a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80526a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80526f:	c3                   	ret
+
+0000000000805270 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805270:	55                   	push   %rbp
+  805271:	48 89 e5             	mov    %rsp,%rbp
+  805274:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805277:	48 be d5 64 80 00 00 	movabs $0x8064d5,%rsi
+  80527e:	00 00 00 
+  805281:	48 b8 5e 21 80 00 00 	movabs $0x80215e,%rax
+  805288:	00 00 00 
+  80528b:	ff d0                	call   *%rax
+    return 0;
+}
+  80528d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805292:	5d                   	pop    %rbp
+  805293:	c3                   	ret
+
+0000000000805294 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805294:	55                   	push   %rbp
+  805295:	48 89 e5             	mov    %rsp,%rbp
+  805298:	41 57                	push   %r15
+  80529a:	41 56                	push   %r14
+  80529c:	41 55                	push   %r13
+  80529e:	41 54                	push   %r12
+  8052a0:	53                   	push   %rbx
+  8052a1:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8052a8:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8052af:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8052b6:	00 00 00 00 
+  8052ba:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8052c1:	00 00 00 00 
+  8052c5:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8052cc:	00 00 00 00 
+  8052d0:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8052d7:	00 00 00 00 
+  8052db:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8052e2:	00 00 00 00 
+  8052e6:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8052ed:	00 00 00 00 
+  8052f1:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8052f8:	00 
+  8052f9:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805300:	00 
+  805301:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805308:	00 
+  805309:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805310:	00 
+  805311:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805318:	00 
+  805319:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805320:	00 
+  805321:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805328:	00 
+  805329:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805330:	00 
+  805331:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805338:	00 
+  805339:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805340:	00 
+    for (res = 0; res < n; res += inc) {
+  805341:	48 85 d2             	test   %rdx,%rdx
+  805344:	74 7a                	je     8053c0 <devcons_write+0x12c>
+  805346:	49 89 d6             	mov    %rdx,%r14
+  805349:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80534f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805354:	49 bf ae 24 80 00 00 	movabs $0x8024ae,%r15
+  80535b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80535e:	4c 89 f3             	mov    %r14,%rbx
+  805361:	48 29 f3             	sub    %rsi,%rbx
+  805364:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805369:	48 39 c3             	cmp    %rax,%rbx
+  80536c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805370:	4c 63 eb             	movslq %ebx,%r13
+  805373:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80537a:	48 01 c6             	add    %rax,%rsi
+  80537d:	4c 89 ea             	mov    %r13,%rdx
+  805380:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805387:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80538a:	4c 89 ee             	mov    %r13,%rsi
+  80538d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805394:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  80539b:	00 00 00 
+  80539e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8053a0:	41 01 dc             	add    %ebx,%r12d
+  8053a3:	49 63 f4             	movslq %r12d,%rsi
+  8053a6:	4c 39 f6             	cmp    %r14,%rsi
+  8053a9:	72 b3                	jb     80535e <devcons_write+0xca>
+    return res;
+  8053ab:	49 63 c4             	movslq %r12d,%rax
+}
+  8053ae:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8053b5:	5b                   	pop    %rbx
+  8053b6:	41 5c                	pop    %r12
+  8053b8:	41 5d                	pop    %r13
+  8053ba:	41 5e                	pop    %r14
+  8053bc:	41 5f                	pop    %r15
+  8053be:	5d                   	pop    %rbp
+  8053bf:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8053c0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8053c6:	eb e3                	jmp    8053ab <devcons_write+0x117>
+
+00000000008053c8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8053c8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8053cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053d0:	48 85 c0             	test   %rax,%rax
+  8053d3:	74 55                	je     80542a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8053d5:	55                   	push   %rbp
+  8053d6:	48 89 e5             	mov    %rsp,%rbp
+  8053d9:	41 55                	push   %r13
+  8053db:	41 54                	push   %r12
+  8053dd:	53                   	push   %rbx
+  8053de:	48 83 ec 08          	sub    $0x8,%rsp
+  8053e2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8053e5:	48 bb 0e 27 80 00 00 	movabs $0x80270e,%rbx
+  8053ec:	00 00 00 
+  8053ef:	49 bc 22 28 80 00 00 	movabs $0x802822,%r12
+  8053f6:	00 00 00 
+  8053f9:	eb 03                	jmp    8053fe <devcons_read+0x36>
+  8053fb:	41 ff d4             	call   *%r12
+  8053fe:	ff d3                	call   *%rbx
+  805400:	85 c0                	test   %eax,%eax
+  805402:	74 f7                	je     8053fb <devcons_read+0x33>
+    if (c < 0) return c;
+  805404:	48 63 d0             	movslq %eax,%rdx
+  805407:	78 13                	js     80541c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80540e:	83 f8 04             	cmp    $0x4,%eax
+  805411:	74 09                	je     80541c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805413:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805417:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80541c:	48 89 d0             	mov    %rdx,%rax
+  80541f:	48 83 c4 08          	add    $0x8,%rsp
+  805423:	5b                   	pop    %rbx
+  805424:	41 5c                	pop    %r12
+  805426:	41 5d                	pop    %r13
+  805428:	5d                   	pop    %rbp
+  805429:	c3                   	ret
+  80542a:	48 89 d0             	mov    %rdx,%rax
+  80542d:	c3                   	ret
+
+000000000080542e <cputchar>:
+cputchar(int ch) {
+  80542e:	55                   	push   %rbp
+  80542f:	48 89 e5             	mov    %rsp,%rbp
+  805432:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805436:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80543a:	be 01 00 00 00       	mov    $0x1,%esi
+  80543f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805443:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  80544a:	00 00 00 
+  80544d:	ff d0                	call   *%rax
+}
+  80544f:	c9                   	leave
+  805450:	c3                   	ret
+
+0000000000805451 <getchar>:
+getchar(void) {
+  805451:	55                   	push   %rbp
+  805452:	48 89 e5             	mov    %rsp,%rbp
+  805455:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805459:	ba 01 00 00 00       	mov    $0x1,%edx
+  80545e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805462:	bf 00 00 00 00       	mov    $0x0,%edi
+  805467:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  80546e:	00 00 00 
+  805471:	ff d0                	call   *%rax
+  805473:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805475:	85 c0                	test   %eax,%eax
+  805477:	78 06                	js     80547f <getchar+0x2e>
+  805479:	74 08                	je     805483 <getchar+0x32>
+  80547b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80547f:	89 d0                	mov    %edx,%eax
+  805481:	c9                   	leave
+  805482:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805483:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805488:	eb f5                	jmp    80547f <getchar+0x2e>
+
+000000000080548a <iscons>:
+iscons(int fdnum) {
+  80548a:	55                   	push   %rbp
+  80548b:	48 89 e5             	mov    %rsp,%rbp
+  80548e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805492:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805496:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  80549d:	00 00 00 
+  8054a0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8054a2:	85 c0                	test   %eax,%eax
+  8054a4:	78 18                	js     8054be <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8054a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054aa:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8054b1:	00 00 00 
+  8054b4:	8b 00                	mov    (%rax),%eax
+  8054b6:	39 02                	cmp    %eax,(%rdx)
+  8054b8:	0f 94 c0             	sete   %al
+  8054bb:	0f b6 c0             	movzbl %al,%eax
+}
+  8054be:	c9                   	leave
+  8054bf:	c3                   	ret
+
+00000000008054c0 <opencons>:
+opencons(void) {
+  8054c0:	55                   	push   %rbp
+  8054c1:	48 89 e5             	mov    %rsp,%rbp
+  8054c4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8054c8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8054cc:	48 b8 61 32 80 00 00 	movabs $0x803261,%rax
+  8054d3:	00 00 00 
+  8054d6:	ff d0                	call   *%rax
+  8054d8:	85 c0                	test   %eax,%eax
+  8054da:	78 49                	js     805525 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8054dc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8054e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8054e6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8054ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054ef:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  8054f6:	00 00 00 
+  8054f9:	ff d0                	call   *%rax
+  8054fb:	85 c0                	test   %eax,%eax
+  8054fd:	78 26                	js     805525 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8054ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805503:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80550a:	00 00 
+  80550c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80550e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805512:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805519:	48 b8 33 32 80 00 00 	movabs $0x803233,%rax
+  805520:	00 00 00 
+  805523:	ff d0                	call   *%rax
+}
+  805525:	c9                   	leave
+  805526:	c3                   	ret
+
+0000000000805527 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805527:	85 ff                	test   %edi,%edi
+  805529:	78 58                	js     805583 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80552b:	48 85 f6             	test   %rsi,%rsi
+  80552e:	74 12                	je     805542 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805530:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805537:	00 00 00 
+  80553a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805540:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805542:	48 85 c9             	test   %rcx,%rcx
+  805545:	74 12                	je     805559 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805547:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80554e:	00 00 00 
+  805551:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805557:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805559:	48 85 d2             	test   %rdx,%rdx
+  80555c:	74 14                	je     805572 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80555e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805565:	00 00 00 
+  805568:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80556f:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805572:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805579:	00 00 00 
+  80557c:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805582:	c3                   	ret
+        if (from_env_store) {
+  805583:	48 85 f6             	test   %rsi,%rsi
+  805586:	74 06                	je     80558e <ipc_result+0x67>
+            *from_env_store = 0;
+  805588:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80558e:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805590:	48 85 c9             	test   %rcx,%rcx
+  805593:	74 ed                	je     805582 <ipc_result+0x5b>
+            *perm_store = 0;
+  805595:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  80559b:	c3                   	ret
+
+000000000080559c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80559c:	55                   	push   %rbp
+  80559d:	48 89 e5             	mov    %rsp,%rbp
+  8055a0:	41 55                	push   %r13
+  8055a2:	41 54                	push   %r12
+  8055a4:	53                   	push   %rbx
+  8055a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8055a9:	49 89 fc             	mov    %rdi,%r12
+  8055ac:	48 89 f7             	mov    %rsi,%rdi
+  8055af:	48 89 d3             	mov    %rdx,%rbx
+  8055b2:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8055b5:	48 85 f6             	test   %rsi,%rsi
+  8055b8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055bf:	00 00 00 
+  8055c2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8055c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8055cb:	48 85 d2             	test   %rdx,%rdx
+  8055ce:	74 03                	je     8055d3 <ipc_recv+0x37>
+  8055d0:	48 8b 32             	mov    (%rdx),%rsi
+  8055d3:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  8055da:	00 00 00 
+  8055dd:	ff d0                	call   *%rax
+  8055df:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8055e1:	4c 89 e9             	mov    %r13,%rcx
+  8055e4:	48 89 da             	mov    %rbx,%rdx
+  8055e7:	4c 89 e6             	mov    %r12,%rsi
+  8055ea:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  8055f1:	00 00 00 
+  8055f4:	ff d0                	call   *%rax
+}
+  8055f6:	48 83 c4 08          	add    $0x8,%rsp
+  8055fa:	5b                   	pop    %rbx
+  8055fb:	41 5c                	pop    %r12
+  8055fd:	41 5d                	pop    %r13
+  8055ff:	5d                   	pop    %rbp
+  805600:	c3                   	ret
+
+0000000000805601 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805601:	55                   	push   %rbp
+  805602:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805605:	48 85 d2             	test   %rdx,%rdx
+  805608:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80560f:	00 00 00 
+  805612:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805616:	89 f6                	mov    %esi,%esi
+  805618:	48 b8 9b 2c 80 00 00 	movabs $0x802c9b,%rax
+  80561f:	00 00 00 
+  805622:	ff d0                	call   *%rax
+    if (res < 0) {
+  805624:	85 c0                	test   %eax,%eax
+  805626:	78 02                	js     80562a <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805628:	5d                   	pop    %rbp
+  805629:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80562a:	89 c1                	mov    %eax,%ecx
+  80562c:	48 ba e1 64 80 00 00 	movabs $0x8064e1,%rdx
+  805633:	00 00 00 
+  805636:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80563b:	48 bf ee 64 80 00 00 	movabs $0x8064ee,%rdi
+  805642:	00 00 00 
+  805645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80564a:	49 b8 d7 16 80 00 00 	movabs $0x8016d7,%r8
+  805651:	00 00 00 
+  805654:	41 ff d0             	call   *%r8
+
+0000000000805657 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805657:	55                   	push   %rbp
+  805658:	48 89 e5             	mov    %rsp,%rbp
+  80565b:	53                   	push   %rbx
+  80565c:	48 83 ec 08          	sub    $0x8,%rsp
+  805660:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805664:	48 85 d2             	test   %rdx,%rdx
+  805667:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80566e:	00 00 00 
+  805671:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805675:	4d 85 c9             	test   %r9,%r9
+  805678:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80567c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805681:	48 85 db             	test   %rbx,%rbx
+  805684:	74 03                	je     805689 <ipc_call+0x32>
+  805686:	48 8b 03             	mov    (%rbx),%rax
+  805689:	89 f6                	mov    %esi,%esi
+  80568b:	48 83 ec 08          	sub    $0x8,%rsp
+  80568f:	50                   	push   %rax
+  805690:	48 b8 cd 2c 80 00 00 	movabs $0x802ccd,%rax
+  805697:	00 00 00 
+  80569a:	ff d0                	call   *%rax
+  80569c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  80569e:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8056a2:	48 89 da             	mov    %rbx,%rdx
+  8056a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8056aa:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  8056b1:	00 00 00 
+  8056b4:	ff d0                	call   *%rax
+}
+  8056b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8056ba:	c9                   	leave
+  8056bb:	c3                   	ret
+
+00000000008056bc <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8056bc:	55                   	push   %rbp
+  8056bd:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8056c0:	89 f6                	mov    %esi,%esi
+  8056c2:	48 b8 39 2d 80 00 00 	movabs $0x802d39,%rax
+  8056c9:	00 00 00 
+  8056cc:	ff d0                	call   *%rax
+  8056ce:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8056d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056da:	be 00 00 00 00       	mov    $0x0,%esi
+  8056df:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  8056e6:	00 00 00 
+  8056e9:	ff d0                	call   *%rax
+}
+  8056eb:	5d                   	pop    %rbp
+  8056ec:	c3                   	ret
+
+00000000008056ed <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8056ed:	55                   	push   %rbp
+  8056ee:	48 89 e5             	mov    %rsp,%rbp
+  8056f1:	41 54                	push   %r12
+  8056f3:	53                   	push   %rbx
+  8056f4:	4c 89 cb             	mov    %r9,%rbx
+  8056f7:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8056fb:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056ff:	48 85 d2             	test   %rdx,%rdx
+  805702:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805709:	00 00 00 
+  80570c:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805710:	4d 85 c9             	test   %r9,%r9
+  805713:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80571c:	4d 85 e4             	test   %r12,%r12
+  80571f:	74 04                	je     805725 <ipc_reply_wait+0x38>
+  805721:	49 8b 04 24          	mov    (%r12),%rax
+  805725:	89 f6                	mov    %esi,%esi
+  805727:	48 83 ec 08          	sub    $0x8,%rsp
+  80572b:	50                   	push   %rax
+  80572c:	48 b8 a3 2d 80 00 00 	movabs $0x802da3,%rax
+  805733:	00 00 00 
+  805736:	ff d0                	call   *%rax
+  805738:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80573a:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80573e:	4c 89 e2             	mov    %r12,%rdx
+  805741:	48 89 de             	mov    %rbx,%rsi
+  805744:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  80574b:	00 00 00 
+  80574e:	ff d0                	call   *%rax
+}
+  805750:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805754:	5b                   	pop    %rbx
+  805755:	41 5c                	pop    %r12
+  805757:	5d                   	pop    %rbp
+  805758:	c3                   	ret
+
+0000000000805759 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805759:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80575e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805765:	00 00 00 
+  805768:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80576f:	48 01 ca             	add    %rcx,%rdx
+  805772:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805778:	39 fa                	cmp    %edi,%edx
+  80577a:	74 12                	je     80578e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80577c:	48 83 c0 01          	add    $0x1,%rax
+  805780:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805786:	75 e0                	jne    805768 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805788:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80578d:	c3                   	ret
+            return envs[i].env_id;
+  80578e:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805795:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80579c:	00 00 00 
+  80579f:	48 01 d0             	add    %rdx,%rax
+  8057a2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8057a8:	c3                   	ret
+  8057a9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008057b0 <__rodata_start>:
+  8057b0:	77 00                	ja     8057b2 <__rodata_start+0x2>
+  8057b2:	72 62                	jb     805816 <__rodata_start+0x66>
+  8057b4:	00 77 62             	add    %dh,0x62(%rdi)
+  8057b7:	00 0f                	add    %cl,(%rdi)
+  8057b9:	1f                   	(bad)
+  8057ba:	84 00                	test   %al,(%rax)
+  8057bc:	00 00                	add    %al,(%rax)
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	b3 09                	mov    $0x9,%bl
+  8057c2:	80 00 00             	addb   $0x0,(%rax)
+  8057c5:	00 00                	add    %al,(%rax)
+  8057c7:	00 ed                	add    %ch,%ch
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8057ed:	00 00                	add    %al,(%rax)
+  8057ef:	00 ed                	add    %ch,%ch
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	8c 0a                	mov    %cs,(%rdx)
+  80581a:	80 00 00             	addb   $0x0,(%rax)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805826:	00 00                	add    %al,(%rax)
+  805828:	8c 0a                	mov    %cs,(%rdx)
+  80582a:	80 00 00             	addb   $0x0,(%rax)
+  80582d:	00 00                	add    %al,(%rax)
+  80582f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805836:	00 00                	add    %al,(%rax)
+  805838:	8c 0a                	mov    %cs,(%rdx)
+  80583a:	80 00 00             	addb   $0x0,(%rax)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805846:	00 00                	add    %al,(%rax)
+  805848:	8c 0a                	mov    %cs,(%rdx)
+  80584a:	80 00 00             	addb   $0x0,(%rax)
+  80584d:	00 00                	add    %al,(%rax)
+  80584f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805856:	00 00                	add    %al,(%rax)
+  805858:	8c 0a                	mov    %cs,(%rdx)
+  80585a:	80 00 00             	addb   $0x0,(%rax)
+  80585d:	00 00                	add    %al,(%rax)
+  80585f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	ed                   	in     (%dx),%eax
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ed                   	in     (%dx),%eax
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	f4                   	hlt
+  805959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80595f:	00 ed                	add    %ch,%ch
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	2c 0b                	sub    $0xb,%al
+  805972:	80 00 00             	addb   $0x0,(%rax)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 ed                	add    %ch,%ch
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8059b3:	00 00                	add    %al,(%rax)
+  8059b5:	00 00                	add    %al,(%rax)
+  8059b7:	00 cb                	add    %cl,%bl
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	6a 0a                	push   $0xa
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 ed                	add    %ch,%ch
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	3c 0a                	cmp    $0xa,%al
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 ed                	add    %ch,%ch
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805a0b:	00 00                	add    %al,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 29                	add    %ch,(%rcx)
+  805a19:	0c 80                	or     $0x80,%al
+  805a1b:	00 00                	add    %al,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 ed                	add    %ch,%ch
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	1a 0b                	sbb    (%rbx),%cl
+  805a32:	80 00 00             	addb   $0x0,(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 ed                	add    %ch,%ch
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ce                   	(bad)
+  805a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a47:	00 ed                	add    %ch,%ch
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	f4                   	hlt
+  805a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a5f:	00 37                	add    %dh,(%rdi)
+  805a61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 37                	add    %dh,(%rdi)
+  805a71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805a8b:	00 00                	add    %al,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 d2                	add    %dl,%dl
+  805a91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a97:	00 d2                	add    %dl,%dl
+  805a99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a9f:	00 d2                	add    %dl,%dl
+  805aa1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aa7:	00 d2                	add    %dl,%dl
+  805aa9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aaf:	00 d2                	add    %dl,%dl
+  805ab1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ab7:	00 d2                	add    %dl,%dl
+  805ab9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805abf:	00 d2                	add    %dl,%dl
+  805ac1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ac7:	00 f6                	add    %dh,%dh
+  805ac9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805acf:	00 f6                	add    %dh,%dh
+  805ad1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 22                	add    %ah,(%rdx)
+  805b21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b27:	00 22                	add    %ah,(%rdx)
+  805b29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 46 12             	add    %al,0x12(%rsi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 22                	add    %ah,(%rdx)
+  805c11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c17:	00 22                	add    %ah,(%rdx)
+  805c19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c1f:	00 22                	add    %ah,(%rdx)
+  805c21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c27:	00 22                	add    %ah,(%rdx)
+  805c29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c2f:	00 22                	add    %ah,(%rdx)
+  805c31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c37:	00 22                	add    %ah,(%rdx)
+  805c39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 46 12             	add    %al,0x12(%rsi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805ce0 <basefix.0>:
+  805ce0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805cf0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805d00:	10 00 66 61 75 6c 74 20 25 6c 78 0a 00 75 73 65     ..fault %lx..use
+  805d10:	72 2f 66 61 75 6c 74 61 6c 6c 6f 63 2e 63 00 25     r/faultalloc.c.%
+  805d20:	73 0a 00 0f 1f 44 00 00 61 6c 6c 6f 63 61 74 69     s....D..allocati
+  805d30:	6e 67 20 61 74 20 25 6c 78 20 69 6e 20 70 61 67     ng at %lx in pag
+  805d40:	65 20 66 61 75 6c 74 20 68 61 6e 64 6c 65 72 3a     e fault handler:
+  805d50:	20 25 69 00 00 00 00 00 74 68 69 73 20 73 74 72      %i.....this str
+  805d60:	69 6e 67 20 77 61 73 20 66 61 75 6c 74 65 64 20     ing was faulted 
+  805d70:	69 6e 20 61 74 20 25 6c 78 00 3c 75 6e 6b 6e 6f     in at %lx.<unkno
+  805d80:	77 6e 3e 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75     wn>...@.[%08x] u
+  805d90:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  805da0:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  805db0:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  805dc0:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  805dd0:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  805de0:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  805df0:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  805e00:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  805e10:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  805e20:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  805e30:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  805e40:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  805e50:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  805e60:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  805e70:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  805e80:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  805e90:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  805ea0:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  805eb0:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  805ec0:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  805ed0:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  805ee0:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  805ef0:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  805f00:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  805f10:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  805f20:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  805f30:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  805f40:	1f 1a 80 00 00 00 00 00 76 20 80 00 00 00 00 00     ........v ......
+  805f50:	66 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     f ......v ......
+  805f60:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  805f70:	76 20 80 00 00 00 00 00 3e 1a 80 00 00 00 00 00     v ......>.......
+  805f80:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  805f90:	32 1a 80 00 00 00 00 00 ac 1a 80 00 00 00 00 00     2...............
+  805fa0:	76 20 80 00 00 00 00 00 32 1a 80 00 00 00 00 00     v ......2.......
+  805fb0:	78 1a 80 00 00 00 00 00 78 1a 80 00 00 00 00 00     x.......x.......
+  805fc0:	78 1a 80 00 00 00 00 00 78 1a 80 00 00 00 00 00     x.......x.......
+  805fd0:	78 1a 80 00 00 00 00 00 78 1a 80 00 00 00 00 00     x.......x.......
+  805fe0:	78 1a 80 00 00 00 00 00 78 1a 80 00 00 00 00 00     x.......x.......
+  805ff0:	78 1a 80 00 00 00 00 00 76 20 80 00 00 00 00 00     x.......v ......
+  806000:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806010:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806020:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806030:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806040:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806050:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806060:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806070:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806080:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806090:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  8060a0:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  8060b0:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  8060c0:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  8060d0:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  8060e0:	76 20 80 00 00 00 00 00 94 1f 80 00 00 00 00 00     v ..............
+  8060f0:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806100:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806110:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806120:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806130:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806140:	da 1a 80 00 00 00 00 00 a9 1c 80 00 00 00 00 00     ................
+  806150:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  806160:	76 20 80 00 00 00 00 00 cf 1a 80 00 00 00 00 00     v ..............
+  806170:	09 1b 80 00 00 00 00 00 76 20 80 00 00 00 00 00     ........v ......
+  806180:	76 20 80 00 00 00 00 00 c4 1a 80 00 00 00 00 00     v ..............
+  806190:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  8061a0:	52 1e 80 00 00 00 00 00 21 1f 80 00 00 00 00 00     R.......!.......
+  8061b0:	76 20 80 00 00 00 00 00 76 20 80 00 00 00 00 00     v ......v ......
+  8061c0:	a0 1b 80 00 00 00 00 00 76 20 80 00 00 00 00 00     ........v ......
+  8061d0:	7d 1d 80 00 00 00 00 00 76 20 80 00 00 00 00 00     }.......v ......
+  8061e0:	76 20 80 00 00 00 00 00 94 1f 80 00 00 00 00 00     v ..............
+  8061f0:	76 20 80 00 00 00 00 00 28 1a 80 00 00 00 00 00     v ......(.......
+
+0000000000806200 <error_string>:
+	...
+  806208:	dd 5d 80 00 00 00 00 00 ef 5d 80 00 00 00 00 00     .].......]......
+  806218:	ff 5d 80 00 00 00 00 00 11 5e 80 00 00 00 00 00     .].......^......
+  806228:	1f 5e 80 00 00 00 00 00 33 5e 80 00 00 00 00 00     .^......3^......
+  806238:	48 5e 80 00 00 00 00 00 5b 5e 80 00 00 00 00 00     H^......[^......
+  806248:	6d 5e 80 00 00 00 00 00 81 5e 80 00 00 00 00 00     m^.......^......
+  806258:	91 5e 80 00 00 00 00 00 a4 5e 80 00 00 00 00 00     .^.......^......
+  806268:	bb 5e 80 00 00 00 00 00 d1 5e 80 00 00 00 00 00     .^.......^......
+  806278:	e9 5e 80 00 00 00 00 00 01 5f 80 00 00 00 00 00     .^......._......
+  806288:	0e 5f 80 00 00 00 00 00 a0 62 80 00 00 00 00 00     ._.......b......
+  806298:	22 5f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     "_......file is 
+  8062a8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8062b8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8062c8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8062d8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8062e8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8062f8:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806308:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806318:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806328:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806338:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806348:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806358:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806368:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  806378:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  806388:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806398:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8063a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8063b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8063c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8063d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8063e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8063f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000806400 <devtab>:
+  806400:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806410:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806420:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806430:	6f 72 64 73 29 00 6c 69 62 2f 66 69 6c 65 2e 63     ords).lib/file.c
+  806440:	00 66 64 00 62 75 66 00 72 65 73 20 3c 3d 20 6e     .fd.buf.res <= n
+  806450:	00 0f 1f 80 00 00 00 00 72 65 73 20 3c 3d 20 73     ........res <= s
+  806460:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806470:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806480:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806490:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8064a0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8064b0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8064c0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8064d0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8064e0:	00 69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69     .ipc_send: %i.li
+  8064f0:	62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00     b/ipc.c.f.......
+  806500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,10373 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 5f 22 80 00 00 	movabs $0x80225f,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 b1 36 80 00 00 	movabs $0x8036b1,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 b1 36 80 00 00 	movabs $0x8036b1,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 a1 17 80 00 00 	movabs $0x8017a1,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 87 40 80 00 00 	movabs $0x804087,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 6e 20 80 00 00 	movabs $0x80206e,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 87 40 80 00 00 	movabs $0x804087,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 6e 20 80 00 00 	movabs $0x80206e,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be ef 5d 80 00 00 	movabs $0x805def,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 fe 21 80 00 00 	movabs $0x8021fe,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 88 57 80 00 00 	movabs $0x805788,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 fe 21 80 00 00 	movabs $0x8021fe,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 8a 57 80 00 00 	movabs $0x80578a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 fe 21 80 00 00 	movabs $0x8021fe,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 8d 57 80 00 00 	movabs $0x80578d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 fe 21 80 00 00 	movabs $0x8021fe,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 85 4e 80 00 00 	movabs $0x804e85,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 5c 51 80 00 00 	movabs $0x80515c,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 64 38 80 00 00 	movabs $0x803864,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 6a 37 80 00 00 	movabs $0x80376a,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 6a 37 80 00 00 	movabs $0x80376a,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 82 35 80 00 00 	movabs $0x803582,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 b1 36 80 00 00 	movabs $0x8036b1,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb ab 23 80 00 00 	movabs $0x8023ab,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 ab 23 80 00 00 	movabs $0x8023ab,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc ab 23 80 00 00 	movabs $0x8023ab,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 40 5a 80 00 00 	movabs $0x805a40,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf ab 23 80 00 00 	movabs $0x8023ab,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf ab 23 80 00 00 	movabs $0x8023ab,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 c0 5c 80 00 00 	movabs $0x805cc0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 c0 5c 80 00 00 	movabs $0x805cc0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 03 26 80 00 00 	movabs $0x802603,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 03 26 80 00 00 	movabs $0x802603,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 ea 00 00 00       	call   8015e9 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <handler>:
+ * doesn't work because we sys_cputs instead of cprintf (exercise: why?) */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80150a:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  80150d:	48 89 de             	mov    %rbx,%rsi
+  801510:	48 bf e2 5c 80 00 00 	movabs $0x805ce2,%rdi
+  801517:	00 00 00 
+  80151a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151f:	48 ba 05 18 80 00 00 	movabs $0x801805,%rdx
+  801526:	00 00 00 
+  801529:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80152b:	48 89 de             	mov    %rbx,%rsi
+  80152e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  801535:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80153a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80153f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801544:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  80154b:	00 00 00 
+  80154e:	ff d0                	call   *%rax
+  801550:	85 c0                	test   %eax,%eax
+  801552:	78 32                	js     801586 <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  801554:	48 89 d9             	mov    %rbx,%rcx
+  801557:	48 ba 38 5d 80 00 00 	movabs $0x805d38,%rdx
+  80155e:	00 00 00 
+  801561:	be 64 00 00 00       	mov    $0x64,%esi
+  801566:	48 89 df             	mov    %rbx,%rdi
+  801569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156e:	49 b8 c1 20 80 00 00 	movabs $0x8020c1,%r8
+  801575:	00 00 00 
+  801578:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80157b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  801586:	41 89 c0             	mov    %eax,%r8d
+  801589:	48 89 d9             	mov    %rbx,%rcx
+  80158c:	48 ba 08 5d 80 00 00 	movabs $0x805d08,%rdx
+  801593:	00 00 00 
+  801596:	be 0e 00 00 00       	mov    $0xe,%esi
+  80159b:	48 bf ed 5c 80 00 00 	movabs $0x805ced,%rdi
+  8015a2:	00 00 00 
+  8015a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015aa:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  8015b1:	00 00 00 
+  8015b4:	41 ff d1             	call   *%r9
+
+00000000008015b7 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8015b7:	55                   	push   %rbp
+  8015b8:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  8015bb:	48 bf 01 15 80 00 00 	movabs $0x801501,%rdi
+  8015c2:	00 00 00 
+  8015c5:	48 b8 89 2f 80 00 00 	movabs $0x802f89,%rax
+  8015cc:	00 00 00 
+  8015cf:	ff d0                	call   *%rax
+    sys_cputs((char *)0xDEADBEEF, 4);
+  8015d1:	be 04 00 00 00       	mov    $0x4,%esi
+  8015d6:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  8015db:	48 b8 b9 26 80 00 00 	movabs $0x8026b9,%rax
+  8015e2:	00 00 00 
+  8015e5:	ff d0                	call   *%rax
+}
+  8015e7:	5d                   	pop    %rbp
+  8015e8:	c3                   	ret
+
+00000000008015e9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8015e9:	55                   	push   %rbp
+  8015ea:	48 89 e5             	mov    %rsp,%rbp
+  8015ed:	41 56                	push   %r14
+  8015ef:	41 55                	push   %r13
+  8015f1:	41 54                	push   %r12
+  8015f3:	53                   	push   %rbx
+  8015f4:	41 89 fd             	mov    %edi,%r13d
+  8015f7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8015fa:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801601:	00 00 00 
+  801604:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80160b:	00 00 00 
+  80160e:	48 39 c2             	cmp    %rax,%rdx
+  801611:	73 17                	jae    80162a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801613:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801616:	49 89 c4             	mov    %rax,%r12
+  801619:	48 83 c3 08          	add    $0x8,%rbx
+  80161d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801622:	ff 53 f8             	call   *-0x8(%rbx)
+  801625:	4c 39 e3             	cmp    %r12,%rbx
+  801628:	72 ef                	jb     801619 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80162a:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  801631:	00 00 00 
+  801634:	ff d0                	call   *%rax
+  801636:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80163b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801642:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801649:	00 00 00 
+  80164c:	48 01 d0             	add    %rdx,%rax
+  80164f:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801656:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801659:	45 85 ed             	test   %r13d,%r13d
+  80165c:	7e 0d                	jle    80166b <libmain+0x82>
+  80165e:	49 8b 06             	mov    (%r14),%rax
+  801661:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801668:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80166b:	4c 89 f6             	mov    %r14,%rsi
+  80166e:	44 89 ef             	mov    %r13d,%edi
+  801671:	48 b8 b7 15 80 00 00 	movabs $0x8015b7,%rax
+  801678:	00 00 00 
+  80167b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80167d:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  801684:	00 00 00 
+  801687:	ff d0                	call   *%rax
+#endif
+}
+  801689:	5b                   	pop    %rbx
+  80168a:	41 5c                	pop    %r12
+  80168c:	41 5d                	pop    %r13
+  80168e:	41 5e                	pop    %r14
+  801690:	5d                   	pop    %rbp
+  801691:	c3                   	ret
+
+0000000000801692 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801692:	55                   	push   %rbp
+  801693:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801696:	48 b8 37 34 80 00 00 	movabs $0x803437,%rax
+  80169d:	00 00 00 
+  8016a0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8016a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016a7:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  8016ae:	00 00 00 
+  8016b1:	ff d0                	call   *%rax
+}
+  8016b3:	5d                   	pop    %rbp
+  8016b4:	c3                   	ret
+
+00000000008016b5 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8016b5:	55                   	push   %rbp
+  8016b6:	48 89 e5             	mov    %rsp,%rbp
+  8016b9:	41 56                	push   %r14
+  8016bb:	41 55                	push   %r13
+  8016bd:	41 54                	push   %r12
+  8016bf:	53                   	push   %rbx
+  8016c0:	48 83 ec 50          	sub    $0x50,%rsp
+  8016c4:	49 89 fc             	mov    %rdi,%r12
+  8016c7:	41 89 f5             	mov    %esi,%r13d
+  8016ca:	48 89 d3             	mov    %rdx,%rbx
+  8016cd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8016d1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8016d5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8016d9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8016e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016e4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8016e8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8016ec:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8016f0:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8016f7:	00 00 00 
+  8016fa:	4c 8b 30             	mov    (%rax),%r14
+  8016fd:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  801704:	00 00 00 
+  801707:	ff d0                	call   *%rax
+  801709:	89 c6                	mov    %eax,%esi
+  80170b:	45 89 e8             	mov    %r13d,%r8d
+  80170e:	4c 89 e1             	mov    %r12,%rcx
+  801711:	4c 89 f2             	mov    %r14,%rdx
+  801714:	48 bf 68 5d 80 00 00 	movabs $0x805d68,%rdi
+  80171b:	00 00 00 
+  80171e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801723:	49 bc 05 18 80 00 00 	movabs $0x801805,%r12
+  80172a:	00 00 00 
+  80172d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801730:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801734:	48 89 df             	mov    %rbx,%rdi
+  801737:	48 b8 a1 17 80 00 00 	movabs $0x8017a1,%rax
+  80173e:	00 00 00 
+  801741:	ff d0                	call   *%rax
+    cprintf("\n");
+  801743:	48 bf bb 63 80 00 00 	movabs $0x8063bb,%rdi
+  80174a:	00 00 00 
+  80174d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801752:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801755:	cc                   	int3
+  801756:	eb fd                	jmp    801755 <_panic+0xa0>
+
+0000000000801758 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801758:	55                   	push   %rbp
+  801759:	48 89 e5             	mov    %rsp,%rbp
+  80175c:	53                   	push   %rbx
+  80175d:	48 83 ec 08          	sub    $0x8,%rsp
+  801761:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801764:	8b 06                	mov    (%rsi),%eax
+  801766:	8d 50 01             	lea    0x1(%rax),%edx
+  801769:	89 16                	mov    %edx,(%rsi)
+  80176b:	48 98                	cltq
+  80176d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801772:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801778:	74 0a                	je     801784 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80177a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80177e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801782:	c9                   	leave
+  801783:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801784:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801788:	be ff 00 00 00       	mov    $0xff,%esi
+  80178d:	48 b8 b9 26 80 00 00 	movabs $0x8026b9,%rax
+  801794:	00 00 00 
+  801797:	ff d0                	call   *%rax
+        state->offset = 0;
+  801799:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80179f:	eb d9                	jmp    80177a <putch+0x22>
+
+00000000008017a1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8017a1:	55                   	push   %rbp
+  8017a2:	48 89 e5             	mov    %rsp,%rbp
+  8017a5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8017ac:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8017af:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8017b6:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8017c3:	48 89 f1             	mov    %rsi,%rcx
+  8017c6:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8017cd:	48 bf 58 17 80 00 00 	movabs $0x801758,%rdi
+  8017d4:	00 00 00 
+  8017d7:	48 b8 55 19 80 00 00 	movabs $0x801955,%rax
+  8017de:	00 00 00 
+  8017e1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8017e3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8017ea:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8017f1:	48 b8 b9 26 80 00 00 	movabs $0x8026b9,%rax
+  8017f8:	00 00 00 
+  8017fb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8017fd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801803:	c9                   	leave
+  801804:	c3                   	ret
+
+0000000000801805 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801805:	55                   	push   %rbp
+  801806:	48 89 e5             	mov    %rsp,%rbp
+  801809:	48 83 ec 50          	sub    $0x50,%rsp
+  80180d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801811:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801815:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801819:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80181d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801821:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801828:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80182c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801830:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801834:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801838:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80183c:	48 b8 a1 17 80 00 00 	movabs $0x8017a1,%rax
+  801843:	00 00 00 
+  801846:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+
+000000000080184a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80184a:	55                   	push   %rbp
+  80184b:	48 89 e5             	mov    %rsp,%rbp
+  80184e:	41 57                	push   %r15
+  801850:	41 56                	push   %r14
+  801852:	41 55                	push   %r13
+  801854:	41 54                	push   %r12
+  801856:	53                   	push   %rbx
+  801857:	48 83 ec 18          	sub    $0x18,%rsp
+  80185b:	49 89 fc             	mov    %rdi,%r12
+  80185e:	49 89 f5             	mov    %rsi,%r13
+  801861:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801865:	8b 45 10             	mov    0x10(%rbp),%eax
+  801868:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80186b:	41 89 cf             	mov    %ecx,%r15d
+  80186e:	4c 39 fa             	cmp    %r15,%rdx
+  801871:	73 5b                	jae    8018ce <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801873:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801877:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80187b:	85 db                	test   %ebx,%ebx
+  80187d:	7e 0e                	jle    80188d <print_num+0x43>
+            putch(padc, put_arg);
+  80187f:	4c 89 ee             	mov    %r13,%rsi
+  801882:	44 89 f7             	mov    %r14d,%edi
+  801885:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801888:	83 eb 01             	sub    $0x1,%ebx
+  80188b:	75 f2                	jne    80187f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80188d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801891:	48 b9 9c 5d 80 00 00 	movabs $0x805d9c,%rcx
+  801898:	00 00 00 
+  80189b:	48 b8 8b 5d 80 00 00 	movabs $0x805d8b,%rax
+  8018a2:	00 00 00 
+  8018a5:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8018a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b2:	49 f7 f7             	div    %r15
+  8018b5:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8018b9:	4c 89 ee             	mov    %r13,%rsi
+  8018bc:	41 ff d4             	call   *%r12
+}
+  8018bf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8018c3:	5b                   	pop    %rbx
+  8018c4:	41 5c                	pop    %r12
+  8018c6:	41 5d                	pop    %r13
+  8018c8:	41 5e                	pop    %r14
+  8018ca:	41 5f                	pop    %r15
+  8018cc:	5d                   	pop    %rbp
+  8018cd:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8018ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d7:	49 f7 f7             	div    %r15
+  8018da:	48 83 ec 08          	sub    $0x8,%rsp
+  8018de:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8018e2:	52                   	push   %rdx
+  8018e3:	45 0f be c9          	movsbl %r9b,%r9d
+  8018e7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8018eb:	48 89 c2             	mov    %rax,%rdx
+  8018ee:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  8018f5:	00 00 00 
+  8018f8:	ff d0                	call   *%rax
+  8018fa:	48 83 c4 10          	add    $0x10,%rsp
+  8018fe:	eb 8d                	jmp    80188d <print_num+0x43>
+
+0000000000801900 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801900:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801904:	48 8b 06             	mov    (%rsi),%rax
+  801907:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80190b:	73 0a                	jae    801917 <sprintputch+0x17>
+        *state->start++ = ch;
+  80190d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801911:	48 89 16             	mov    %rdx,(%rsi)
+  801914:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801917:	c3                   	ret
+
+0000000000801918 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801918:	55                   	push   %rbp
+  801919:	48 89 e5             	mov    %rsp,%rbp
+  80191c:	48 83 ec 50          	sub    $0x50,%rsp
+  801920:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801924:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801928:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80192c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801933:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801937:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80193b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80193f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801943:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801947:	48 b8 55 19 80 00 00 	movabs $0x801955,%rax
+  80194e:	00 00 00 
+  801951:	ff d0                	call   *%rax
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+0000000000801955 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801955:	55                   	push   %rbp
+  801956:	48 89 e5             	mov    %rsp,%rbp
+  801959:	41 57                	push   %r15
+  80195b:	41 56                	push   %r14
+  80195d:	41 55                	push   %r13
+  80195f:	41 54                	push   %r12
+  801961:	53                   	push   %rbx
+  801962:	48 83 ec 38          	sub    $0x38,%rsp
+  801966:	49 89 fe             	mov    %rdi,%r14
+  801969:	49 89 f5             	mov    %rsi,%r13
+  80196c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80196f:	48 8b 01             	mov    (%rcx),%rax
+  801972:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801976:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80197a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80197e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801982:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801986:	eb 0d                	jmp    801995 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801988:	40 0f b6 ff          	movzbl %dil,%edi
+  80198c:	4c 89 ee             	mov    %r13,%rsi
+  80198f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801992:	4c 89 e3             	mov    %r12,%rbx
+  801995:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801999:	0f b6 3b             	movzbl (%rbx),%edi
+  80199c:	40 80 ff 25          	cmp    $0x25,%dil
+  8019a0:	74 14                	je     8019b6 <vprintfmt+0x61>
+            if (!ch) return;
+  8019a2:	40 84 ff             	test   %dil,%dil
+  8019a5:	75 e1                	jne    801988 <vprintfmt+0x33>
+}
+  8019a7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019ab:	5b                   	pop    %rbx
+  8019ac:	41 5c                	pop    %r12
+  8019ae:	41 5d                	pop    %r13
+  8019b0:	41 5e                	pop    %r14
+  8019b2:	41 5f                	pop    %r15
+  8019b4:	5d                   	pop    %rbp
+  8019b5:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  8019b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8019bb:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8019bf:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8019c4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8019ca:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8019d1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8019d5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8019da:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8019df:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8019e2:	83 e8 23             	sub    $0x23,%eax
+  8019e5:	3c 57                	cmp    $0x57,%al
+  8019e7:	0f 87 67 06 00 00    	ja     802054 <vprintfmt+0x6ff>
+  8019ed:	0f b6 c0             	movzbl %al,%eax
+  8019f0:	48 b9 20 5f 80 00 00 	movabs $0x805f20,%rcx
+  8019f7:	00 00 00 
+  8019fa:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8019fd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801a00:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801a04:	eb cf                	jmp    8019d5 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801a06:	49 89 dc             	mov    %rbx,%r12
+  801a09:	be 01 00 00 00       	mov    $0x1,%esi
+  801a0e:	eb c5                	jmp    8019d5 <vprintfmt+0x80>
+            padc = ch;
+  801a10:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801a14:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a17:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a1a:	eb b9                	jmp    8019d5 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a1f:	83 f8 2f             	cmp    $0x2f,%eax
+  801a22:	77 24                	ja     801a48 <vprintfmt+0xf3>
+  801a24:	89 c1                	mov    %eax,%ecx
+  801a26:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801a2a:	83 c0 08             	add    $0x8,%eax
+  801a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a30:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801a33:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801a36:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a3a:	79 99                	jns    8019d5 <vprintfmt+0x80>
+                width = precision;
+  801a3c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801a40:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a46:	eb 8d                	jmp    8019d5 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a48:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a4c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801a50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a54:	eb da                	jmp    801a30 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801a56:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801a5b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a5f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801a65:	3c 39                	cmp    $0x39,%al
+  801a67:	77 1c                	ja     801a85 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801a69:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801a6d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801a71:	0f b6 c0             	movzbl %al,%eax
+  801a74:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a79:	0f b6 03             	movzbl (%rbx),%eax
+  801a7c:	3c 39                	cmp    $0x39,%al
+  801a7e:	76 e9                	jbe    801a69 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801a80:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801a83:	eb b1                	jmp    801a36 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801a85:	49 89 dc             	mov    %rbx,%r12
+  801a88:	eb ac                	jmp    801a36 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801a8a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801a8d:	85 c9                	test   %ecx,%ecx
+  801a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a94:	0f 49 c1             	cmovns %ecx,%eax
+  801a97:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801a9a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a9d:	e9 33 ff ff ff       	jmp    8019d5 <vprintfmt+0x80>
+            lflag++;
+  801aa2:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801aa5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801aa8:	e9 28 ff ff ff       	jmp    8019d5 <vprintfmt+0x80>
+            lflag--;
+  801aad:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ab0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ab3:	e9 1d ff ff ff       	jmp    8019d5 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801ab8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801abb:	83 f8 2f             	cmp    $0x2f,%eax
+  801abe:	77 19                	ja     801ad9 <vprintfmt+0x184>
+  801ac0:	89 c2                	mov    %eax,%edx
+  801ac2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ac6:	83 c0 08             	add    $0x8,%eax
+  801ac9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801acc:	8b 3a                	mov    (%rdx),%edi
+  801ace:	4c 89 ee             	mov    %r13,%rsi
+  801ad1:	41 ff d6             	call   *%r14
+            break;
+  801ad4:	e9 bc fe ff ff       	jmp    801995 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801ad9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801add:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ae1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ae5:	eb e5                	jmp    801acc <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801ae7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801aea:	83 f8 2f             	cmp    $0x2f,%eax
+  801aed:	77 5a                	ja     801b49 <vprintfmt+0x1f4>
+  801aef:	89 c2                	mov    %eax,%edx
+  801af1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801af5:	83 c0 08             	add    $0x8,%eax
+  801af8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801afb:	8b 02                	mov    (%rdx),%eax
+  801afd:	89 c1                	mov    %eax,%ecx
+  801aff:	f7 d9                	neg    %ecx
+  801b01:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801b04:	83 f9 13             	cmp    $0x13,%ecx
+  801b07:	7f 4e                	jg     801b57 <vprintfmt+0x202>
+  801b09:	48 63 c1             	movslq %ecx,%rax
+  801b0c:	48 ba e0 61 80 00 00 	movabs $0x8061e0,%rdx
+  801b13:	00 00 00 
+  801b16:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b1a:	48 85 c0             	test   %rax,%rax
+  801b1d:	74 38                	je     801b57 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801b1f:	48 89 c1             	mov    %rax,%rcx
+  801b22:	48 ba 5a 63 80 00 00 	movabs $0x80635a,%rdx
+  801b29:	00 00 00 
+  801b2c:	4c 89 ee             	mov    %r13,%rsi
+  801b2f:	4c 89 f7             	mov    %r14,%rdi
+  801b32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b37:	49 b8 18 19 80 00 00 	movabs $0x801918,%r8
+  801b3e:	00 00 00 
+  801b41:	41 ff d0             	call   *%r8
+  801b44:	e9 4c fe ff ff       	jmp    801995 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b55:	eb a4                	jmp    801afb <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801b57:	48 ba b4 5d 80 00 00 	movabs $0x805db4,%rdx
+  801b5e:	00 00 00 
+  801b61:	4c 89 ee             	mov    %r13,%rsi
+  801b64:	4c 89 f7             	mov    %r14,%rdi
+  801b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6c:	49 b8 18 19 80 00 00 	movabs $0x801918,%r8
+  801b73:	00 00 00 
+  801b76:	41 ff d0             	call   *%r8
+  801b79:	e9 17 fe ff ff       	jmp    801995 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b81:	83 f8 2f             	cmp    $0x2f,%eax
+  801b84:	77 6c                	ja     801bf2 <vprintfmt+0x29d>
+  801b86:	89 c2                	mov    %eax,%edx
+  801b88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b8c:	83 c0 08             	add    $0x8,%eax
+  801b8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b92:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801b95:	48 85 f6             	test   %rsi,%rsi
+  801b98:	48 b8 ad 5d 80 00 00 	movabs $0x805dad,%rax
+  801b9f:	00 00 00 
+  801ba2:	48 0f 45 c6          	cmovne %rsi,%rax
+  801ba6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801baa:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801bae:	7e 06                	jle    801bb6 <vprintfmt+0x261>
+  801bb0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801bb4:	75 4a                	jne    801c00 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801bb6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801bba:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801bbe:	0f b6 00             	movzbl (%rax),%eax
+  801bc1:	84 c0                	test   %al,%al
+  801bc3:	0f 85 9a 00 00 00    	jne    801c63 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801bc9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bcc:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	0f 8e bd fd ff ff    	jle    801995 <vprintfmt+0x40>
+  801bd8:	4c 89 ee             	mov    %r13,%rsi
+  801bdb:	bf 20 00 00 00       	mov    $0x20,%edi
+  801be0:	41 ff d6             	call   *%r14
+  801be3:	41 83 ec 01          	sub    $0x1,%r12d
+  801be7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801beb:	75 eb                	jne    801bd8 <vprintfmt+0x283>
+  801bed:	e9 a3 fd ff ff       	jmp    801995 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801bf2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bf6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bfe:	eb 92                	jmp    801b92 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801c00:	49 63 f7             	movslq %r15d,%rsi
+  801c03:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801c07:	48 b8 19 21 80 00 00 	movabs $0x802119,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+  801c13:	48 89 c2             	mov    %rax,%rdx
+  801c16:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c19:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801c1b:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801c1e:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	7e 91                	jle    801bb6 <vprintfmt+0x261>
+  801c25:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801c2a:	4c 89 ee             	mov    %r13,%rsi
+  801c2d:	44 89 e7             	mov    %r12d,%edi
+  801c30:	41 ff d6             	call   *%r14
+  801c33:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c37:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c3a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801c3d:	75 eb                	jne    801c2a <vprintfmt+0x2d5>
+  801c3f:	e9 72 ff ff ff       	jmp    801bb6 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c44:	0f b6 f8             	movzbl %al,%edi
+  801c47:	4c 89 ee             	mov    %r13,%rsi
+  801c4a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c4d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c51:	49 83 c4 01          	add    $0x1,%r12
+  801c55:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801c5b:	84 c0                	test   %al,%al
+  801c5d:	0f 84 66 ff ff ff    	je     801bc9 <vprintfmt+0x274>
+  801c63:	45 85 ff             	test   %r15d,%r15d
+  801c66:	78 0a                	js     801c72 <vprintfmt+0x31d>
+  801c68:	41 83 ef 01          	sub    $0x1,%r15d
+  801c6c:	0f 88 57 ff ff ff    	js     801bc9 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c72:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801c76:	74 cc                	je     801c44 <vprintfmt+0x2ef>
+  801c78:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801c7b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801c80:	80 fa 5e             	cmp    $0x5e,%dl
+  801c83:	77 c2                	ja     801c47 <vprintfmt+0x2f2>
+  801c85:	eb bd                	jmp    801c44 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801c87:	40 84 f6             	test   %sil,%sil
+  801c8a:	75 26                	jne    801cb2 <vprintfmt+0x35d>
+    switch (lflag) {
+  801c8c:	85 d2                	test   %edx,%edx
+  801c8e:	74 59                	je     801ce9 <vprintfmt+0x394>
+  801c90:	83 fa 01             	cmp    $0x1,%edx
+  801c93:	74 7b                	je     801d10 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801c95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c98:	83 f8 2f             	cmp    $0x2f,%eax
+  801c9b:	0f 87 96 00 00 00    	ja     801d37 <vprintfmt+0x3e2>
+  801ca1:	89 c2                	mov    %eax,%edx
+  801ca3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ca7:	83 c0 08             	add    $0x8,%eax
+  801caa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cad:	4c 8b 22             	mov    (%rdx),%r12
+  801cb0:	eb 17                	jmp    801cc9 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801cb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb5:	83 f8 2f             	cmp    $0x2f,%eax
+  801cb8:	77 21                	ja     801cdb <vprintfmt+0x386>
+  801cba:	89 c2                	mov    %eax,%edx
+  801cbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cc0:	83 c0 08             	add    $0x8,%eax
+  801cc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cc6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801cc9:	4d 85 e4             	test   %r12,%r12
+  801ccc:	78 7a                	js     801d48 <vprintfmt+0x3f3>
+            num = i;
+  801cce:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801cd1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801cd6:	e9 56 02 00 00       	jmp    801f31 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cdb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cdf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ce3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ce7:	eb dd                	jmp    801cc6 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801ce9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cec:	83 f8 2f             	cmp    $0x2f,%eax
+  801cef:	77 11                	ja     801d02 <vprintfmt+0x3ad>
+  801cf1:	89 c2                	mov    %eax,%edx
+  801cf3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf7:	83 c0 08             	add    $0x8,%eax
+  801cfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cfd:	4c 63 22             	movslq (%rdx),%r12
+  801d00:	eb c7                	jmp    801cc9 <vprintfmt+0x374>
+  801d02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d0e:	eb ed                	jmp    801cfd <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801d10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d13:	83 f8 2f             	cmp    $0x2f,%eax
+  801d16:	77 11                	ja     801d29 <vprintfmt+0x3d4>
+  801d18:	89 c2                	mov    %eax,%edx
+  801d1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d1e:	83 c0 08             	add    $0x8,%eax
+  801d21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d24:	4c 8b 22             	mov    (%rdx),%r12
+  801d27:	eb a0                	jmp    801cc9 <vprintfmt+0x374>
+  801d29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d35:	eb ed                	jmp    801d24 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801d37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d43:	e9 65 ff ff ff       	jmp    801cad <vprintfmt+0x358>
+                putch('-', put_arg);
+  801d48:	4c 89 ee             	mov    %r13,%rsi
+  801d4b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801d50:	41 ff d6             	call   *%r14
+                i = -i;
+  801d53:	49 f7 dc             	neg    %r12
+  801d56:	e9 73 ff ff ff       	jmp    801cce <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801d5b:	40 84 f6             	test   %sil,%sil
+  801d5e:	75 2e                	jne    801d8e <vprintfmt+0x439>
+    switch (lflag) {
+  801d60:	85 d2                	test   %edx,%edx
+  801d62:	7f 59                	jg     801dbd <vprintfmt+0x468>
+  801d64:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d67:	7d 7a                	jge    801de3 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801d69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d6c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d6f:	0f 87 aa 00 00 00    	ja     801e1f <vprintfmt+0x4ca>
+  801d75:	89 c2                	mov    %eax,%edx
+  801d77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d7b:	83 c0 08             	add    $0x8,%eax
+  801d7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d81:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d84:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d89:	e9 a3 01 00 00       	jmp    801f31 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d91:	83 f8 2f             	cmp    $0x2f,%eax
+  801d94:	77 19                	ja     801daf <vprintfmt+0x45a>
+  801d96:	89 c2                	mov    %eax,%edx
+  801d98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9c:	83 c0 08             	add    $0x8,%eax
+  801d9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801da5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801daa:	e9 82 01 00 00       	jmp    801f31 <vprintfmt+0x5dc>
+  801daf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801db3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801db7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dbb:	eb e5                	jmp    801da2 <vprintfmt+0x44d>
+    switch (lflag) {
+  801dbd:	83 fa 01             	cmp    $0x1,%edx
+  801dc0:	75 a7                	jne    801d69 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801dc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc5:	83 f8 2f             	cmp    $0x2f,%eax
+  801dc8:	77 47                	ja     801e11 <vprintfmt+0x4bc>
+  801dca:	89 c2                	mov    %eax,%edx
+  801dcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd0:	83 c0 08             	add    $0x8,%eax
+  801dd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dd6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801dd9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801dde:	e9 4e 01 00 00       	jmp    801f31 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801de3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801de6:	83 f8 2f             	cmp    $0x2f,%eax
+  801de9:	77 18                	ja     801e03 <vprintfmt+0x4ae>
+  801deb:	89 c2                	mov    %eax,%edx
+  801ded:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df1:	83 c0 08             	add    $0x8,%eax
+  801df4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801df7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801df9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801dfe:	e9 2e 01 00 00       	jmp    801f31 <vprintfmt+0x5dc>
+  801e03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e0f:	eb e6                	jmp    801df7 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801e11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e1d:	eb b7                	jmp    801dd6 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801e1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e2b:	e9 51 ff ff ff       	jmp    801d81 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801e30:	40 84 f6             	test   %sil,%sil
+  801e33:	75 2e                	jne    801e63 <vprintfmt+0x50e>
+    switch (lflag) {
+  801e35:	85 d2                	test   %edx,%edx
+  801e37:	7f 59                	jg     801e92 <vprintfmt+0x53d>
+  801e39:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e3c:	7d 77                	jge    801eb5 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801e3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e41:	83 f8 2f             	cmp    $0x2f,%eax
+  801e44:	0f 87 a4 00 00 00    	ja     801eee <vprintfmt+0x599>
+  801e4a:	89 c2                	mov    %eax,%edx
+  801e4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e50:	83 c0 08             	add    $0x8,%eax
+  801e53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e56:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e59:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e5e:	e9 ce 00 00 00       	jmp    801f31 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e66:	83 f8 2f             	cmp    $0x2f,%eax
+  801e69:	77 19                	ja     801e84 <vprintfmt+0x52f>
+  801e6b:	89 c2                	mov    %eax,%edx
+  801e6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e71:	83 c0 08             	add    $0x8,%eax
+  801e74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e77:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e7a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e7f:	e9 ad 00 00 00       	jmp    801f31 <vprintfmt+0x5dc>
+  801e84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e90:	eb e5                	jmp    801e77 <vprintfmt+0x522>
+    switch (lflag) {
+  801e92:	83 fa 01             	cmp    $0x1,%edx
+  801e95:	75 a7                	jne    801e3e <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801e97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9d:	77 41                	ja     801ee0 <vprintfmt+0x58b>
+  801e9f:	89 c2                	mov    %eax,%edx
+  801ea1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea5:	83 c0 08             	add    $0x8,%eax
+  801ea8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801eae:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801eb3:	eb 7c                	jmp    801f31 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801eb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eb8:	83 f8 2f             	cmp    $0x2f,%eax
+  801ebb:	77 15                	ja     801ed2 <vprintfmt+0x57d>
+  801ebd:	89 c2                	mov    %eax,%edx
+  801ebf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec3:	83 c0 08             	add    $0x8,%eax
+  801ec6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ec9:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801ecb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801ed0:	eb 5f                	jmp    801f31 <vprintfmt+0x5dc>
+  801ed2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ede:	eb e9                	jmp    801ec9 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801ee0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ee8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eec:	eb bd                	jmp    801eab <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801eee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ef2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ef6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801efa:	e9 57 ff ff ff       	jmp    801e56 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801eff:	4c 89 ee             	mov    %r13,%rsi
+  801f02:	bf 30 00 00 00       	mov    $0x30,%edi
+  801f07:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801f0a:	4c 89 ee             	mov    %r13,%rsi
+  801f0d:	bf 78 00 00 00       	mov    $0x78,%edi
+  801f12:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801f15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f18:	83 f8 2f             	cmp    $0x2f,%eax
+  801f1b:	77 47                	ja     801f64 <vprintfmt+0x60f>
+  801f1d:	89 c2                	mov    %eax,%edx
+  801f1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f23:	83 c0 08             	add    $0x8,%eax
+  801f26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f2c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801f31:	48 83 ec 08          	sub    $0x8,%rsp
+  801f35:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801f39:	0f 94 c0             	sete   %al
+  801f3c:	0f b6 c0             	movzbl %al,%eax
+  801f3f:	50                   	push   %rax
+  801f40:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801f45:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801f49:	4c 89 ee             	mov    %r13,%rsi
+  801f4c:	4c 89 f7             	mov    %r14,%rdi
+  801f4f:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801f56:	00 00 00 
+  801f59:	ff d0                	call   *%rax
+            break;
+  801f5b:	48 83 c4 10          	add    $0x10,%rsp
+  801f5f:	e9 31 fa ff ff       	jmp    801995 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801f64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f70:	eb b7                	jmp    801f29 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801f72:	40 84 f6             	test   %sil,%sil
+  801f75:	75 2b                	jne    801fa2 <vprintfmt+0x64d>
+    switch (lflag) {
+  801f77:	85 d2                	test   %edx,%edx
+  801f79:	7f 56                	jg     801fd1 <vprintfmt+0x67c>
+  801f7b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f7e:	7d 77                	jge    801ff7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801f80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f83:	83 f8 2f             	cmp    $0x2f,%eax
+  801f86:	0f 87 a7 00 00 00    	ja     802033 <vprintfmt+0x6de>
+  801f8c:	89 c2                	mov    %eax,%edx
+  801f8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f92:	83 c0 08             	add    $0x8,%eax
+  801f95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f98:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f9b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fa0:	eb 8f                	jmp    801f31 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fa5:	83 f8 2f             	cmp    $0x2f,%eax
+  801fa8:	77 19                	ja     801fc3 <vprintfmt+0x66e>
+  801faa:	89 c2                	mov    %eax,%edx
+  801fac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb0:	83 c0 08             	add    $0x8,%eax
+  801fb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fb6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fb9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801fbe:	e9 6e ff ff ff       	jmp    801f31 <vprintfmt+0x5dc>
+  801fc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fcb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fcf:	eb e5                	jmp    801fb6 <vprintfmt+0x661>
+    switch (lflag) {
+  801fd1:	83 fa 01             	cmp    $0x1,%edx
+  801fd4:	75 aa                	jne    801f80 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801fd6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fd9:	83 f8 2f             	cmp    $0x2f,%eax
+  801fdc:	77 47                	ja     802025 <vprintfmt+0x6d0>
+  801fde:	89 c2                	mov    %eax,%edx
+  801fe0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fe4:	83 c0 08             	add    $0x8,%eax
+  801fe7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fed:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801ff2:	e9 3a ff ff ff       	jmp    801f31 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801ff7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ffa:	83 f8 2f             	cmp    $0x2f,%eax
+  801ffd:	77 18                	ja     802017 <vprintfmt+0x6c2>
+  801fff:	89 c2                	mov    %eax,%edx
+  802001:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802005:	83 c0 08             	add    $0x8,%eax
+  802008:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80200b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80200d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802012:	e9 1a ff ff ff       	jmp    801f31 <vprintfmt+0x5dc>
+  802017:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80201f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802023:	eb e6                	jmp    80200b <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802025:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802029:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80202d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802031:	eb b7                	jmp    801fea <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802033:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80203b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80203f:	e9 54 ff ff ff       	jmp    801f98 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802044:	4c 89 ee             	mov    %r13,%rsi
+  802047:	bf 25 00 00 00       	mov    $0x25,%edi
+  80204c:	41 ff d6             	call   *%r14
+            break;
+  80204f:	e9 41 f9 ff ff       	jmp    801995 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802054:	4c 89 ee             	mov    %r13,%rsi
+  802057:	bf 25 00 00 00       	mov    $0x25,%edi
+  80205c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80205f:	48 83 eb 01          	sub    $0x1,%rbx
+  802063:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802067:	75 f6                	jne    80205f <vprintfmt+0x70a>
+  802069:	e9 27 f9 ff ff       	jmp    801995 <vprintfmt+0x40>
+
+000000000080206e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80206e:	55                   	push   %rbp
+  80206f:	48 89 e5             	mov    %rsp,%rbp
+  802072:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802076:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80207a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80207f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802083:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80208a:	48 85 ff             	test   %rdi,%rdi
+  80208d:	74 2b                	je     8020ba <vsnprintf+0x4c>
+  80208f:	48 85 f6             	test   %rsi,%rsi
+  802092:	74 26                	je     8020ba <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802094:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802098:	48 bf 00 19 80 00 00 	movabs $0x801900,%rdi
+  80209f:	00 00 00 
+  8020a2:	48 b8 55 19 80 00 00 	movabs $0x801955,%rax
+  8020a9:	00 00 00 
+  8020ac:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8020ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020b2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8020b5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8020b8:	c9                   	leave
+  8020b9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8020ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020bf:	eb f7                	jmp    8020b8 <vsnprintf+0x4a>
+
+00000000008020c1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8020c1:	55                   	push   %rbp
+  8020c2:	48 89 e5             	mov    %rsp,%rbp
+  8020c5:	48 83 ec 50          	sub    $0x50,%rsp
+  8020c9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020cd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8020d1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8020d5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8020dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8020e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8020e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8020ec:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8020f0:	48 b8 6e 20 80 00 00 	movabs $0x80206e,%rax
+  8020f7:	00 00 00 
+  8020fa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8020fc:	c9                   	leave
+  8020fd:	c3                   	ret
+
+00000000008020fe <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8020fe:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802101:	74 10                	je     802113 <strlen+0x15>
+    size_t n = 0;
+  802103:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802108:	48 83 c0 01          	add    $0x1,%rax
+  80210c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802110:	75 f6                	jne    802108 <strlen+0xa>
+  802112:	c3                   	ret
+    size_t n = 0;
+  802113:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802118:	c3                   	ret
+
+0000000000802119 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802119:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80211c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802121:	48 85 f6             	test   %rsi,%rsi
+  802124:	74 11                	je     802137 <strnlen+0x1e>
+  802126:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80212a:	74 0c                	je     802138 <strnlen+0x1f>
+  80212c:	48 83 c2 01          	add    $0x1,%rdx
+  802130:	48 39 d0             	cmp    %rdx,%rax
+  802133:	75 f1                	jne    802126 <strnlen+0xd>
+  802135:	eb 04                	jmp    80213b <strnlen+0x22>
+  802137:	c3                   	ret
+  802138:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80213b:	c3                   	ret
+
+000000000080213c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80213c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80213f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802144:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802148:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80214b:	48 83 c2 01          	add    $0x1,%rdx
+  80214f:	84 c9                	test   %cl,%cl
+  802151:	75 f1                	jne    802144 <strcpy+0x8>
+        ;
+    return res;
+}
+  802153:	c3                   	ret
+
+0000000000802154 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+  802158:	41 54                	push   %r12
+  80215a:	53                   	push   %rbx
+  80215b:	48 89 fb             	mov    %rdi,%rbx
+  80215e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802161:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802168:	00 00 00 
+  80216b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80216d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802171:	4c 89 e6             	mov    %r12,%rsi
+  802174:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+    return dst;
+}
+  802180:	48 89 d8             	mov    %rbx,%rax
+  802183:	5b                   	pop    %rbx
+  802184:	41 5c                	pop    %r12
+  802186:	5d                   	pop    %rbp
+  802187:	c3                   	ret
+
+0000000000802188 <toupper>:
+
+int
+toupper(int ch) {
+  802188:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80218a:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80218d:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802190:	83 f9 1a             	cmp    $0x1a,%ecx
+  802193:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802196:	c3                   	ret
+
+0000000000802197 <tolower>:
+
+int
+tolower(int ch) {
+  802197:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802199:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80219c:	8d 57 20             	lea    0x20(%rdi),%edx
+  80219f:	83 f9 1a             	cmp    $0x1a,%ecx
+  8021a2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8021a5:	c3                   	ret
+
+00000000008021a6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8021a6:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8021a9:	48 85 d2             	test   %rdx,%rdx
+  8021ac:	74 1f                	je     8021cd <strncpy+0x27>
+  8021ae:	48 01 fa             	add    %rdi,%rdx
+  8021b1:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8021b4:	48 83 c1 01          	add    $0x1,%rcx
+  8021b8:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8021bc:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8021c0:	41 80 f8 01          	cmp    $0x1,%r8b
+  8021c4:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8021c8:	48 39 ca             	cmp    %rcx,%rdx
+  8021cb:	75 e7                	jne    8021b4 <strncpy+0xe>
+    }
+    return ret;
+}
+  8021cd:	c3                   	ret
+
+00000000008021ce <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8021ce:	48 89 f8             	mov    %rdi,%rax
+  8021d1:	48 85 d2             	test   %rdx,%rdx
+  8021d4:	74 24                	je     8021fa <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8021d6:	48 83 ea 01          	sub    $0x1,%rdx
+  8021da:	74 1b                	je     8021f7 <strlcpy+0x29>
+  8021dc:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8021e0:	0f b6 16             	movzbl (%rsi),%edx
+  8021e3:	84 d2                	test   %dl,%dl
+  8021e5:	74 10                	je     8021f7 <strlcpy+0x29>
+            *dst++ = *src++;
+  8021e7:	48 83 c6 01          	add    $0x1,%rsi
+  8021eb:	48 83 c0 01          	add    $0x1,%rax
+  8021ef:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8021f2:	48 39 c8             	cmp    %rcx,%rax
+  8021f5:	75 e9                	jne    8021e0 <strlcpy+0x12>
+        *dst = '\0';
+  8021f7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8021fa:	48 29 f8             	sub    %rdi,%rax
+}
+  8021fd:	c3                   	ret
+
+00000000008021fe <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8021fe:	0f b6 07             	movzbl (%rdi),%eax
+  802201:	84 c0                	test   %al,%al
+  802203:	74 13                	je     802218 <strcmp+0x1a>
+  802205:	38 06                	cmp    %al,(%rsi)
+  802207:	75 0f                	jne    802218 <strcmp+0x1a>
+  802209:	48 83 c7 01          	add    $0x1,%rdi
+  80220d:	48 83 c6 01          	add    $0x1,%rsi
+  802211:	0f b6 07             	movzbl (%rdi),%eax
+  802214:	84 c0                	test   %al,%al
+  802216:	75 ed                	jne    802205 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802218:	0f b6 c0             	movzbl %al,%eax
+  80221b:	0f b6 16             	movzbl (%rsi),%edx
+  80221e:	29 d0                	sub    %edx,%eax
+}
+  802220:	c3                   	ret
+
+0000000000802221 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802221:	48 85 d2             	test   %rdx,%rdx
+  802224:	74 1f                	je     802245 <strncmp+0x24>
+  802226:	0f b6 07             	movzbl (%rdi),%eax
+  802229:	84 c0                	test   %al,%al
+  80222b:	74 1e                	je     80224b <strncmp+0x2a>
+  80222d:	3a 06                	cmp    (%rsi),%al
+  80222f:	75 1a                	jne    80224b <strncmp+0x2a>
+  802231:	48 83 c7 01          	add    $0x1,%rdi
+  802235:	48 83 c6 01          	add    $0x1,%rsi
+  802239:	48 83 ea 01          	sub    $0x1,%rdx
+  80223d:	75 e7                	jne    802226 <strncmp+0x5>
+
+    if (!n) return 0;
+  80223f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802244:	c3                   	ret
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224a:	c3                   	ret
+  80224b:	48 85 d2             	test   %rdx,%rdx
+  80224e:	74 09                	je     802259 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802250:	0f b6 07             	movzbl (%rdi),%eax
+  802253:	0f b6 16             	movzbl (%rsi),%edx
+  802256:	29 d0                	sub    %edx,%eax
+  802258:	c3                   	ret
+    if (!n) return 0;
+  802259:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225e:	c3                   	ret
+
+000000000080225f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80225f:	0f b6 17             	movzbl (%rdi),%edx
+  802262:	84 d2                	test   %dl,%dl
+  802264:	74 18                	je     80227e <strchr+0x1f>
+        if (*str == c) {
+  802266:	0f be d2             	movsbl %dl,%edx
+  802269:	39 f2                	cmp    %esi,%edx
+  80226b:	74 17                	je     802284 <strchr+0x25>
+    for (; *str; str++) {
+  80226d:	48 83 c7 01          	add    $0x1,%rdi
+  802271:	0f b6 17             	movzbl (%rdi),%edx
+  802274:	84 d2                	test   %dl,%dl
+  802276:	75 ee                	jne    802266 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227d:	c3                   	ret
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802283:	c3                   	ret
+  802284:	48 89 f8             	mov    %rdi,%rax
+}
+  802287:	c3                   	ret
+
+0000000000802288 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802288:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80228b:	0f b6 17             	movzbl (%rdi),%edx
+  80228e:	84 d2                	test   %dl,%dl
+  802290:	74 13                	je     8022a5 <strfind+0x1d>
+  802292:	0f be d2             	movsbl %dl,%edx
+  802295:	39 f2                	cmp    %esi,%edx
+  802297:	74 0b                	je     8022a4 <strfind+0x1c>
+  802299:	48 83 c0 01          	add    $0x1,%rax
+  80229d:	0f b6 10             	movzbl (%rax),%edx
+  8022a0:	84 d2                	test   %dl,%dl
+  8022a2:	75 ee                	jne    802292 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8022a4:	c3                   	ret
+  8022a5:	c3                   	ret
+
+00000000008022a6 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8022a6:	48 39 f7             	cmp    %rsi,%rdi
+  8022a9:	74 65                	je     802310 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8022ab:	55                   	push   %rbp
+  8022ac:	48 89 e5             	mov    %rsp,%rbp
+  8022af:	41 57                	push   %r15
+  8022b1:	41 56                	push   %r14
+  8022b3:	41 55                	push   %r13
+  8022b5:	41 54                	push   %r12
+  8022b7:	53                   	push   %rbx
+  8022b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8022bc:	48 89 fb             	mov    %rdi,%rbx
+  8022bf:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8022c2:	49 bf 97 21 80 00 00 	movabs $0x802197,%r15
+  8022c9:	00 00 00 
+  8022cc:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022d0:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022d4:	41 ff d7             	call   *%r15
+  8022d7:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022da:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8022df:	41 0f b6 fe          	movzbl %r14b,%edi
+  8022e3:	41 ff d7             	call   *%r15
+  8022e6:	89 c2                	mov    %eax,%edx
+  8022e8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022eb:	29 d0                	sub    %edx,%eax
+  8022ed:	75 12                	jne    802301 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8022ef:	48 83 c3 01          	add    $0x1,%rbx
+  8022f3:	45 84 ed             	test   %r13b,%r13b
+  8022f6:	74 09                	je     802301 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8022f8:	49 83 c4 01          	add    $0x1,%r12
+  8022fc:	45 84 f6             	test   %r14b,%r14b
+  8022ff:	75 cb                	jne    8022cc <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802301:	48 83 c4 18          	add    $0x18,%rsp
+  802305:	5b                   	pop    %rbx
+  802306:	41 5c                	pop    %r12
+  802308:	41 5d                	pop    %r13
+  80230a:	41 5e                	pop    %r14
+  80230c:	41 5f                	pop    %r15
+  80230e:	5d                   	pop    %rbp
+  80230f:	c3                   	ret
+    if (p1 == p2) return 0;
+  802310:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802315:	c3                   	ret
+
+0000000000802316 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802316:	48 39 f7             	cmp    %rsi,%rdi
+  802319:	74 7d                	je     802398 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80231b:	55                   	push   %rbp
+  80231c:	48 89 e5             	mov    %rsp,%rbp
+  80231f:	41 57                	push   %r15
+  802321:	41 56                	push   %r14
+  802323:	41 55                	push   %r13
+  802325:	41 54                	push   %r12
+  802327:	53                   	push   %rbx
+  802328:	48 83 ec 18          	sub    $0x18,%rsp
+  80232c:	48 89 fb             	mov    %rdi,%rbx
+  80232f:	49 89 f4             	mov    %rsi,%r12
+  802332:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802336:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80233a:	49 bf 97 21 80 00 00 	movabs $0x802197,%r15
+  802341:	00 00 00 
+    while (n--) {
+  802344:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802348:	48 39 c3             	cmp    %rax,%rbx
+  80234b:	74 37                	je     802384 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80234d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802351:	41 0f b6 fd          	movzbl %r13b,%edi
+  802355:	41 ff d7             	call   *%r15
+  802358:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80235b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802360:	41 0f b6 fe          	movzbl %r14b,%edi
+  802364:	41 ff d7             	call   *%r15
+  802367:	89 c2                	mov    %eax,%edx
+  802369:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80236c:	29 d0                	sub    %edx,%eax
+  80236e:	75 19                	jne    802389 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802370:	48 83 c3 01          	add    $0x1,%rbx
+  802374:	45 84 ed             	test   %r13b,%r13b
+  802377:	74 10                	je     802389 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802379:	49 83 c4 01          	add    $0x1,%r12
+  80237d:	45 84 f6             	test   %r14b,%r14b
+  802380:	75 c2                	jne    802344 <strncasecmp+0x2e>
+  802382:	eb 05                	jmp    802389 <strncasecmp+0x73>
+  802384:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802389:	48 83 c4 18          	add    $0x18,%rsp
+  80238d:	5b                   	pop    %rbx
+  80238e:	41 5c                	pop    %r12
+  802390:	41 5d                	pop    %r13
+  802392:	41 5e                	pop    %r14
+  802394:	41 5f                	pop    %r15
+  802396:	5d                   	pop    %rbp
+  802397:	c3                   	ret
+    if (p1 == p2) return 0;
+  802398:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80239d:	c3                   	ret
+
+000000000080239e <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80239e:	83 e7 df             	and    $0xffffffdf,%edi
+  8023a1:	83 ef 41             	sub    $0x41,%edi
+  8023a4:	83 ff 19             	cmp    $0x19,%edi
+  8023a7:	0f 96 c0             	setbe  %al
+}
+  8023aa:	c3                   	ret
+
+00000000008023ab <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8023ab:	83 ff 20             	cmp    $0x20,%edi
+  8023ae:	0f 94 c0             	sete   %al
+  8023b1:	83 ff 09             	cmp    $0x9,%edi
+  8023b4:	0f 94 c2             	sete   %dl
+  8023b7:	09 d0                	or     %edx,%eax
+}
+  8023b9:	c3                   	ret
+
+00000000008023ba <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8023ba:	55                   	push   %rbp
+  8023bb:	48 89 e5             	mov    %rsp,%rbp
+  8023be:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8023c0:	48 bf 9f 62 80 00 00 	movabs $0x80629f,%rdi
+  8023c7:	00 00 00 
+  8023ca:	48 b8 5f 22 80 00 00 	movabs $0x80225f,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	48 85 c0             	test   %rax,%rax
+  8023d9:	0f 95 c0             	setne  %al
+}
+  8023dc:	5d                   	pop    %rbp
+  8023dd:	c3                   	ret
+
+00000000008023de <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8023de:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8023e1:	48 89 f8             	mov    %rdi,%rax
+  8023e4:	48 f7 d8             	neg    %rax
+  8023e7:	83 e0 07             	and    $0x7,%eax
+  8023ea:	49 89 d1             	mov    %rdx,%r9
+  8023ed:	49 29 c1             	sub    %rax,%r9
+  8023f0:	78 36                	js     802428 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8023f2:	40 0f b6 c6          	movzbl %sil,%eax
+  8023f6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8023fd:	01 01 01 
+  802400:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802404:	40 f6 c7 07          	test   $0x7,%dil
+  802408:	75 38                	jne    802442 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80240a:	4c 89 c9             	mov    %r9,%rcx
+  80240d:	48 c1 f9 03          	sar    $0x3,%rcx
+  802411:	74 0c                	je     80241f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802413:	fc                   	cld
+  802414:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802417:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80241b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80241f:	4d 85 c9             	test   %r9,%r9
+  802422:	75 45                	jne    802469 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802424:	4c 89 c0             	mov    %r8,%rax
+  802427:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802428:	48 85 d2             	test   %rdx,%rdx
+  80242b:	74 f7                	je     802424 <memset+0x46>
+  80242d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802430:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802433:	48 83 c0 01          	add    $0x1,%rax
+  802437:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80243b:	48 39 c2             	cmp    %rax,%rdx
+  80243e:	75 f3                	jne    802433 <memset+0x55>
+  802440:	eb e2                	jmp    802424 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802442:	40 f6 c7 01          	test   $0x1,%dil
+  802446:	74 06                	je     80244e <memset+0x70>
+  802448:	88 07                	mov    %al,(%rdi)
+  80244a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80244e:	40 f6 c7 02          	test   $0x2,%dil
+  802452:	74 07                	je     80245b <memset+0x7d>
+  802454:	66 89 07             	mov    %ax,(%rdi)
+  802457:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80245b:	40 f6 c7 04          	test   $0x4,%dil
+  80245f:	74 a9                	je     80240a <memset+0x2c>
+  802461:	89 07                	mov    %eax,(%rdi)
+  802463:	48 83 c7 04          	add    $0x4,%rdi
+  802467:	eb a1                	jmp    80240a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802469:	41 f6 c1 04          	test   $0x4,%r9b
+  80246d:	74 06                	je     802475 <memset+0x97>
+  80246f:	89 07                	mov    %eax,(%rdi)
+  802471:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802475:	41 f6 c1 02          	test   $0x2,%r9b
+  802479:	74 07                	je     802482 <memset+0xa4>
+  80247b:	66 89 07             	mov    %ax,(%rdi)
+  80247e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802482:	41 f6 c1 01          	test   $0x1,%r9b
+  802486:	74 9c                	je     802424 <memset+0x46>
+  802488:	88 07                	mov    %al,(%rdi)
+  80248a:	eb 98                	jmp    802424 <memset+0x46>
+
+000000000080248c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80248c:	48 89 f8             	mov    %rdi,%rax
+  80248f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802492:	48 39 fe             	cmp    %rdi,%rsi
+  802495:	73 3b                	jae    8024d2 <memmove+0x46>
+  802497:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80249b:	48 39 d7             	cmp    %rdx,%rdi
+  80249e:	73 32                	jae    8024d2 <memmove+0x46>
+        s += n;
+        d += n;
+  8024a0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8024a4:	48 89 d6             	mov    %rdx,%rsi
+  8024a7:	48 09 fe             	or     %rdi,%rsi
+  8024aa:	48 09 ce             	or     %rcx,%rsi
+  8024ad:	40 f6 c6 07          	test   $0x7,%sil
+  8024b1:	75 12                	jne    8024c5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8024b3:	48 83 ef 08          	sub    $0x8,%rdi
+  8024b7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8024bb:	48 c1 e9 03          	shr    $0x3,%rcx
+  8024bf:	fd                   	std
+  8024c0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8024c3:	fc                   	cld
+  8024c4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8024c5:	48 83 ef 01          	sub    $0x1,%rdi
+  8024c9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8024cd:	fd                   	std
+  8024ce:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8024d0:	eb f1                	jmp    8024c3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8024d2:	48 89 f2             	mov    %rsi,%rdx
+  8024d5:	48 09 c2             	or     %rax,%rdx
+  8024d8:	48 09 ca             	or     %rcx,%rdx
+  8024db:	f6 c2 07             	test   $0x7,%dl
+  8024de:	75 0c                	jne    8024ec <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8024e0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8024e4:	48 89 c7             	mov    %rax,%rdi
+  8024e7:	fc                   	cld
+  8024e8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8024eb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8024ec:	48 89 c7             	mov    %rax,%rdi
+  8024ef:	fc                   	cld
+  8024f0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8024f2:	c3                   	ret
+
+00000000008024f3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8024f3:	55                   	push   %rbp
+  8024f4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8024f7:	48 b8 8c 24 80 00 00 	movabs $0x80248c,%rax
+  8024fe:	00 00 00 
+  802501:	ff d0                	call   *%rax
+}
+  802503:	5d                   	pop    %rbp
+  802504:	c3                   	ret
+
+0000000000802505 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802505:	55                   	push   %rbp
+  802506:	48 89 e5             	mov    %rsp,%rbp
+  802509:	41 57                	push   %r15
+  80250b:	41 56                	push   %r14
+  80250d:	41 55                	push   %r13
+  80250f:	41 54                	push   %r12
+  802511:	53                   	push   %rbx
+  802512:	48 83 ec 08          	sub    $0x8,%rsp
+  802516:	49 89 fe             	mov    %rdi,%r14
+  802519:	49 89 f7             	mov    %rsi,%r15
+  80251c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80251f:	48 89 f7             	mov    %rsi,%rdi
+  802522:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802529:	00 00 00 
+  80252c:	ff d0                	call   *%rax
+  80252e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802531:	48 89 de             	mov    %rbx,%rsi
+  802534:	4c 89 f7             	mov    %r14,%rdi
+  802537:	48 b8 19 21 80 00 00 	movabs $0x802119,%rax
+  80253e:	00 00 00 
+  802541:	ff d0                	call   *%rax
+  802543:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802546:	48 39 c3             	cmp    %rax,%rbx
+  802549:	74 36                	je     802581 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80254b:	48 89 d8             	mov    %rbx,%rax
+  80254e:	4c 29 e8             	sub    %r13,%rax
+  802551:	49 39 c4             	cmp    %rax,%r12
+  802554:	73 31                	jae    802587 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802556:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80255b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80255f:	4c 89 fe             	mov    %r15,%rsi
+  802562:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80256e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802572:	48 83 c4 08          	add    $0x8,%rsp
+  802576:	5b                   	pop    %rbx
+  802577:	41 5c                	pop    %r12
+  802579:	41 5d                	pop    %r13
+  80257b:	41 5e                	pop    %r14
+  80257d:	41 5f                	pop    %r15
+  80257f:	5d                   	pop    %rbp
+  802580:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802581:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802585:	eb eb                	jmp    802572 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802587:	48 83 eb 01          	sub    $0x1,%rbx
+  80258b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80258f:	48 89 da             	mov    %rbx,%rdx
+  802592:	4c 89 fe             	mov    %r15,%rsi
+  802595:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  80259c:	00 00 00 
+  80259f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8025a1:	49 01 de             	add    %rbx,%r14
+  8025a4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8025a9:	eb c3                	jmp    80256e <strlcat+0x69>
+
+00000000008025ab <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8025ab:	48 85 d2             	test   %rdx,%rdx
+  8025ae:	74 2d                	je     8025dd <memcmp+0x32>
+  8025b0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8025b5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8025b9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8025be:	44 38 c1             	cmp    %r8b,%cl
+  8025c1:	75 0f                	jne    8025d2 <memcmp+0x27>
+    while (n-- > 0) {
+  8025c3:	48 83 c0 01          	add    $0x1,%rax
+  8025c7:	48 39 c2             	cmp    %rax,%rdx
+  8025ca:	75 e9                	jne    8025b5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8025cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8025d2:	0f b6 c1             	movzbl %cl,%eax
+  8025d5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8025d9:	44 29 c0             	sub    %r8d,%eax
+  8025dc:	c3                   	ret
+    return 0;
+  8025dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e2:	c3                   	ret
+
+00000000008025e3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8025e3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8025e7:	48 39 c7             	cmp    %rax,%rdi
+  8025ea:	73 0f                	jae    8025fb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8025ec:	40 38 37             	cmp    %sil,(%rdi)
+  8025ef:	74 0e                	je     8025ff <memfind+0x1c>
+    for (; src < end; src++) {
+  8025f1:	48 83 c7 01          	add    $0x1,%rdi
+  8025f5:	48 39 f8             	cmp    %rdi,%rax
+  8025f8:	75 f2                	jne    8025ec <memfind+0x9>
+  8025fa:	c3                   	ret
+  8025fb:	48 89 f8             	mov    %rdi,%rax
+  8025fe:	c3                   	ret
+  8025ff:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802602:	c3                   	ret
+
+0000000000802603 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802603:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802606:	0f b6 37             	movzbl (%rdi),%esi
+  802609:	40 80 fe 20          	cmp    $0x20,%sil
+  80260d:	74 06                	je     802615 <strtol+0x12>
+  80260f:	40 80 fe 09          	cmp    $0x9,%sil
+  802613:	75 13                	jne    802628 <strtol+0x25>
+  802615:	48 83 c7 01          	add    $0x1,%rdi
+  802619:	0f b6 37             	movzbl (%rdi),%esi
+  80261c:	40 80 fe 20          	cmp    $0x20,%sil
+  802620:	74 f3                	je     802615 <strtol+0x12>
+  802622:	40 80 fe 09          	cmp    $0x9,%sil
+  802626:	74 ed                	je     802615 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802628:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80262b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80262e:	3c 01                	cmp    $0x1,%al
+  802630:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802634:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80263a:	75 0f                	jne    80264b <strtol+0x48>
+  80263c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80263f:	74 14                	je     802655 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802641:	85 d2                	test   %edx,%edx
+  802643:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802648:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80264b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802650:	4c 63 ca             	movslq %edx,%r9
+  802653:	eb 36                	jmp    80268b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802655:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802659:	74 0f                	je     80266a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80265b:	85 d2                	test   %edx,%edx
+  80265d:	75 ec                	jne    80264b <strtol+0x48>
+        s++;
+  80265f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802663:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802668:	eb e1                	jmp    80264b <strtol+0x48>
+        s += 2;
+  80266a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80266e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802673:	eb d6                	jmp    80264b <strtol+0x48>
+            dig -= '0';
+  802675:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802678:	44 0f b6 c1          	movzbl %cl,%r8d
+  80267c:	41 39 d0             	cmp    %edx,%r8d
+  80267f:	7d 21                	jge    8026a2 <strtol+0x9f>
+        val = val * base + dig;
+  802681:	49 0f af c1          	imul   %r9,%rax
+  802685:	0f b6 c9             	movzbl %cl,%ecx
+  802688:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80268b:	48 83 c7 01          	add    $0x1,%rdi
+  80268f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802693:	80 f9 39             	cmp    $0x39,%cl
+  802696:	76 dd                	jbe    802675 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802698:	80 f9 7b             	cmp    $0x7b,%cl
+  80269b:	77 05                	ja     8026a2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80269d:	83 e9 57             	sub    $0x57,%ecx
+  8026a0:	eb d6                	jmp    802678 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8026a2:	4d 85 d2             	test   %r10,%r10
+  8026a5:	74 03                	je     8026aa <strtol+0xa7>
+  8026a7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8026aa:	48 89 c2             	mov    %rax,%rdx
+  8026ad:	48 f7 da             	neg    %rdx
+  8026b0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8026b4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8026b8:	c3                   	ret
+
+00000000008026b9 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8026b9:	55                   	push   %rbp
+  8026ba:	48 89 e5             	mov    %rsp,%rbp
+  8026bd:	53                   	push   %rbx
+  8026be:	48 89 fa             	mov    %rdi,%rdx
+  8026c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026c4:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026e4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8026e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ea:	c9                   	leave
+  8026eb:	c3                   	ret
+
+00000000008026ec <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8026ec:	55                   	push   %rbp
+  8026ed:	48 89 e5             	mov    %rsp,%rbp
+  8026f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026f1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802700:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802705:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80270a:	be 00 00 00 00       	mov    $0x0,%esi
+  80270f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802715:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80271b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80271d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802721:	c9                   	leave
+  802722:	c3                   	ret
+
+0000000000802723 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802723:	55                   	push   %rbp
+  802724:	48 89 e5             	mov    %rsp,%rbp
+  802727:	53                   	push   %rbx
+  802728:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80272b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802730:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802735:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80273a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80273f:	be 00 00 00 00       	mov    $0x0,%esi
+  802744:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80274a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802750:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802752:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802756:	c9                   	leave
+  802757:	c3                   	ret
+
+0000000000802758 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802758:	55                   	push   %rbp
+  802759:	48 89 e5             	mov    %rsp,%rbp
+  80275c:	53                   	push   %rbx
+  80275d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802761:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802764:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802769:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80276e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802773:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802778:	be 00 00 00 00       	mov    $0x0,%esi
+  80277d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802783:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802789:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80278b:	48 85 c0             	test   %rax,%rax
+  80278e:	7f 06                	jg     802796 <sys_env_destroy+0x3e>
+}
+  802790:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802794:	c9                   	leave
+  802795:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802796:	49 89 c0             	mov    %rax,%r8
+  802799:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80279e:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  8027a5:	00 00 00 
+  8027a8:	be 27 00 00 00       	mov    $0x27,%esi
+  8027ad:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  8027b4:	00 00 00 
+  8027b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027bc:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  8027c3:	00 00 00 
+  8027c6:	41 ff d1             	call   *%r9
+
+00000000008027c9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8027c9:	55                   	push   %rbp
+  8027ca:	48 89 e5             	mov    %rsp,%rbp
+  8027cd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ce:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027f8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027fe:	c9                   	leave
+  8027ff:	c3                   	ret
+
+0000000000802800 <sys_yield>:
+
+void
+sys_yield(void) {
+  802800:	55                   	push   %rbp
+  802801:	48 89 e5             	mov    %rsp,%rbp
+  802804:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802805:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80280a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802814:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802819:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80281e:	be 00 00 00 00       	mov    $0x0,%esi
+  802823:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802829:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80282f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802831:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802835:	c9                   	leave
+  802836:	c3                   	ret
+
+0000000000802837 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802837:	55                   	push   %rbp
+  802838:	48 89 e5             	mov    %rsp,%rbp
+  80283b:	53                   	push   %rbx
+  80283c:	48 89 fa             	mov    %rdi,%rdx
+  80283f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802842:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802847:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80284e:	00 00 00 
+  802851:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802856:	be 00 00 00 00       	mov    $0x0,%esi
+  80285b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802861:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802867:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802869:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80286d:	c9                   	leave
+  80286e:	c3                   	ret
+
+000000000080286f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	53                   	push   %rbx
+  802874:	49 89 f8             	mov    %rdi,%r8
+  802877:	48 89 d3             	mov    %rdx,%rbx
+  80287a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80287d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802882:	4c 89 c2             	mov    %r8,%rdx
+  802885:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802888:	be 00 00 00 00       	mov    $0x0,%esi
+  80288d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802893:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802899:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80289b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80289f:	c9                   	leave
+  8028a0:	c3                   	ret
+
+00000000008028a1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8028a1:	55                   	push   %rbp
+  8028a2:	48 89 e5             	mov    %rsp,%rbp
+  8028a5:	53                   	push   %rbx
+  8028a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8028aa:	89 f8                	mov    %edi,%eax
+  8028ac:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8028af:	48 63 f9             	movslq %ecx,%rdi
+  8028b2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028b5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028ba:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028d0:	48 85 c0             	test   %rax,%rax
+  8028d3:	7f 06                	jg     8028db <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8028d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028d9:	c9                   	leave
+  8028da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028db:	49 89 c0             	mov    %rax,%r8
+  8028de:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8028e3:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  8028ea:	00 00 00 
+  8028ed:	be 27 00 00 00       	mov    $0x27,%esi
+  8028f2:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  8028f9:	00 00 00 
+  8028fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802901:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802908:	00 00 00 
+  80290b:	41 ff d1             	call   *%r9
+
+000000000080290e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80290e:	55                   	push   %rbp
+  80290f:	48 89 e5             	mov    %rsp,%rbp
+  802912:	53                   	push   %rbx
+  802913:	48 83 ec 08          	sub    $0x8,%rsp
+  802917:	89 f8                	mov    %edi,%eax
+  802919:	49 89 f2             	mov    %rsi,%r10
+  80291c:	48 89 cf             	mov    %rcx,%rdi
+  80291f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802922:	48 63 da             	movslq %edx,%rbx
+  802925:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802928:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80292d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802930:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802933:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802939:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80293b:	48 85 c0             	test   %rax,%rax
+  80293e:	7f 06                	jg     802946 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802940:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802944:	c9                   	leave
+  802945:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802946:	49 89 c0             	mov    %rax,%r8
+  802949:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80294e:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802955:	00 00 00 
+  802958:	be 27 00 00 00       	mov    $0x27,%esi
+  80295d:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802964:	00 00 00 
+  802967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296c:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802973:	00 00 00 
+  802976:	41 ff d1             	call   *%r9
+
+0000000000802979 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802979:	55                   	push   %rbp
+  80297a:	48 89 e5             	mov    %rsp,%rbp
+  80297d:	53                   	push   %rbx
+  80297e:	48 83 ec 08          	sub    $0x8,%rsp
+  802982:	48 89 f1             	mov    %rsi,%rcx
+  802985:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802988:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80298b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802990:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802995:	be 00 00 00 00       	mov    $0x0,%esi
+  80299a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029a8:	48 85 c0             	test   %rax,%rax
+  8029ab:	7f 06                	jg     8029b3 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8029ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029b3:	49 89 c0             	mov    %rax,%r8
+  8029b6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029bb:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  8029c2:	00 00 00 
+  8029c5:	be 27 00 00 00       	mov    $0x27,%esi
+  8029ca:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  8029d1:	00 00 00 
+  8029d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d9:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  8029e0:	00 00 00 
+  8029e3:	41 ff d1             	call   *%r9
+
+00000000008029e6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	53                   	push   %rbx
+  8029eb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  8029ef:	48 63 ce             	movslq %esi,%rcx
+  8029f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029f5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a04:	be 00 00 00 00       	mov    $0x0,%esi
+  802a09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a15:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a17:	48 85 c0             	test   %rax,%rax
+  802a1a:	7f 06                	jg     802a22 <sys_env_set_status+0x3c>
+}
+  802a1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a20:	c9                   	leave
+  802a21:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a22:	49 89 c0             	mov    %rax,%r8
+  802a25:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802a2a:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802a31:	00 00 00 
+  802a34:	be 27 00 00 00       	mov    $0x27,%esi
+  802a39:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802a40:	00 00 00 
+  802a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a48:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802a4f:	00 00 00 
+  802a52:	41 ff d1             	call   *%r9
+
+0000000000802a55 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802a55:	55                   	push   %rbp
+  802a56:	48 89 e5             	mov    %rsp,%rbp
+  802a59:	53                   	push   %rbx
+  802a5a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a5e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802a61:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a64:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a6e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a73:	be 00 00 00 00       	mov    $0x0,%esi
+  802a78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a7e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a84:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a86:	48 85 c0             	test   %rax,%rax
+  802a89:	7f 06                	jg     802a91 <sys_env_set_trapframe+0x3c>
+}
+  802a8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a8f:	c9                   	leave
+  802a90:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a91:	49 89 c0             	mov    %rax,%r8
+  802a94:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802a99:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802aa0:	00 00 00 
+  802aa3:	be 27 00 00 00       	mov    $0x27,%esi
+  802aa8:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802aaf:	00 00 00 
+  802ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab7:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802abe:	00 00 00 
+  802ac1:	41 ff d1             	call   *%r9
+
+0000000000802ac4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802ac4:	55                   	push   %rbp
+  802ac5:	48 89 e5             	mov    %rsp,%rbp
+  802ac8:	53                   	push   %rbx
+  802ac9:	48 83 ec 08          	sub    $0x8,%rsp
+  802acd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802ad0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ad3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ad8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802add:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ae2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802af3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802af5:	48 85 c0             	test   %rax,%rax
+  802af8:	7f 06                	jg     802b00 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802afa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b00:	49 89 c0             	mov    %rax,%r8
+  802b03:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802b08:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802b0f:	00 00 00 
+  802b12:	be 27 00 00 00       	mov    $0x27,%esi
+  802b17:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802b1e:	00 00 00 
+  802b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b26:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802b2d:	00 00 00 
+  802b30:	41 ff d1             	call   *%r9
+
+0000000000802b33 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802b33:	55                   	push   %rbp
+  802b34:	48 89 e5             	mov    %rsp,%rbp
+  802b37:	53                   	push   %rbx
+  802b38:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802b3c:	40 0f b6 ce          	movzbl %sil,%ecx
+  802b40:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b43:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b52:	be 00 00 00 00       	mov    $0x0,%esi
+  802b57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b63:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b65:	48 85 c0             	test   %rax,%rax
+  802b68:	7f 06                	jg     802b70 <sys_env_set_reclaim+0x3d>
+}
+  802b6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b70:	49 89 c0             	mov    %rax,%r8
+  802b73:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802b78:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802b7f:	00 00 00 
+  802b82:	be 27 00 00 00       	mov    $0x27,%esi
+  802b87:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802b8e:	00 00 00 
+  802b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b96:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802b9d:	00 00 00 
+  802ba0:	41 ff d1             	call   *%r9
+
+0000000000802ba3 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802ba3:	55                   	push   %rbp
+  802ba4:	48 89 e5             	mov    %rsp,%rbp
+  802ba7:	53                   	push   %rbx
+  802ba8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802bac:	48 63 ce             	movslq %esi,%rcx
+  802baf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bb2:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bbc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bc1:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bcc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bd2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bd4:	48 85 c0             	test   %rax,%rax
+  802bd7:	7f 06                	jg     802bdf <sys_env_set_nice+0x3c>
+}
+  802bd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bdf:	49 89 c0             	mov    %rax,%r8
+  802be2:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802be7:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802bee:	00 00 00 
+  802bf1:	be 27 00 00 00       	mov    $0x27,%esi
+  802bf6:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802bfd:	00 00 00 
+  802c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c05:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802c0c:	00 00 00 
+  802c0f:	41 ff d1             	call   *%r9
+
+0000000000802c12 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802c12:	55                   	push   %rbp
+  802c13:	48 89 e5             	mov    %rsp,%rbp
+  802c16:	53                   	push   %rbx
+  802c17:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c1a:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c29:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c2e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c39:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c3f:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802c41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+
+0000000000802c47 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c47:	55                   	push   %rbp
+  802c48:	48 89 e5             	mov    %rsp,%rbp
+  802c4b:	53                   	push   %rbx
+  802c4c:	89 f8                	mov    %edi,%eax
+  802c4e:	49 89 f1             	mov    %rsi,%r9
+  802c51:	48 89 d3             	mov    %rdx,%rbx
+  802c54:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c57:	49 63 f0             	movslq %r8d,%rsi
+  802c5a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c5d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c62:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c71:	cd 30                	int    $0x30
+}
+  802c73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c77:	c9                   	leave
+  802c78:	c3                   	ret
+
+0000000000802c79 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c79:	55                   	push   %rbp
+  802c7a:	48 89 e5             	mov    %rsp,%rbp
+  802c7d:	53                   	push   %rbx
+  802c7e:	89 f8                	mov    %edi,%eax
+  802c80:	49 89 f1             	mov    %rsi,%r9
+  802c83:	48 89 d3             	mov    %rdx,%rbx
+  802c86:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c89:	49 63 f0             	movslq %r8d,%rsi
+  802c8c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c8f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c94:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c9d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ca3:	cd 30                	int    $0x30
+}
+  802ca5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca9:	c9                   	leave
+  802caa:	c3                   	ret
+
+0000000000802cab <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802cab:	55                   	push   %rbp
+  802cac:	48 89 e5             	mov    %rsp,%rbp
+  802caf:	53                   	push   %rbx
+  802cb0:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb4:	89 f8                	mov    %edi,%eax
+  802cb6:	49 89 f2             	mov    %rsi,%r10
+  802cb9:	48 89 d3             	mov    %rdx,%rbx
+  802cbc:	48 89 cf             	mov    %rcx,%rdi
+  802cbf:	44 89 c6             	mov    %r8d,%esi
+  802cc2:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802cc5:	48 63 f6             	movslq %esi,%rsi
+  802cc8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ccb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cd0:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802cd3:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802cd7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cd9:	48 85 c0             	test   %rax,%rax
+  802cdc:	7f 06                	jg     802ce4 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce2:	c9                   	leave
+  802ce3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ce4:	49 89 c0             	mov    %rax,%r8
+  802ce7:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802cec:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802cf3:	00 00 00 
+  802cf6:	be 27 00 00 00       	mov    $0x27,%esi
+  802cfb:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802d02:	00 00 00 
+  802d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0a:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802d11:	00 00 00 
+  802d14:	41 ff d1             	call   *%r9
+
+0000000000802d17 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802d17:	55                   	push   %rbp
+  802d18:	48 89 e5             	mov    %rsp,%rbp
+  802d1b:	53                   	push   %rbx
+  802d1c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d20:	48 89 f1             	mov    %rsi,%rcx
+  802d23:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802d26:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802d2a:	48 8b 1a             	mov    (%rdx),%rbx
+  802d2d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d30:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d35:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d39:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802d3d:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802d41:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d43:	48 85 c0             	test   %rax,%rax
+  802d46:	7f 06                	jg     802d4e <sys_ipc_call_short+0x37>
+}
+  802d48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4c:	c9                   	leave
+  802d4d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d4e:	49 89 c0             	mov    %rax,%r8
+  802d51:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802d56:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802d5d:	00 00 00 
+  802d60:	be 27 00 00 00       	mov    $0x27,%esi
+  802d65:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802d6c:	00 00 00 
+  802d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d74:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802d7b:	00 00 00 
+  802d7e:	41 ff d1             	call   *%r9
+
+0000000000802d81 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d81:	55                   	push   %rbp
+  802d82:	48 89 e5             	mov    %rsp,%rbp
+  802d85:	53                   	push   %rbx
+  802d86:	48 83 ec 08          	sub    $0x8,%rsp
+  802d8a:	89 f8                	mov    %edi,%eax
+  802d8c:	49 89 f2             	mov    %rsi,%r10
+  802d8f:	48 89 d3             	mov    %rdx,%rbx
+  802d92:	48 89 cf             	mov    %rcx,%rdi
+  802d95:	44 89 c6             	mov    %r8d,%esi
+  802d98:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d9b:	48 63 f6             	movslq %esi,%rsi
+  802d9e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802da1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802da6:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802da9:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802dad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802daf:	48 85 c0             	test   %rax,%rax
+  802db2:	7f 06                	jg     802dba <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802db4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802db8:	c9                   	leave
+  802db9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dba:	49 89 c0             	mov    %rax,%r8
+  802dbd:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802dc2:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802dc9:	00 00 00 
+  802dcc:	be 27 00 00 00       	mov    $0x27,%esi
+  802dd1:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802dd8:	00 00 00 
+  802ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de0:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802de7:	00 00 00 
+  802dea:	41 ff d1             	call   *%r9
+
+0000000000802ded <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802ded:	55                   	push   %rbp
+  802dee:	48 89 e5             	mov    %rsp,%rbp
+  802df1:	53                   	push   %rbx
+  802df2:	48 83 ec 08          	sub    $0x8,%rsp
+  802df6:	48 89 fa             	mov    %rdi,%rdx
+  802df9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802dfc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e06:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e0b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e16:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e1c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e1e:	48 85 c0             	test   %rax,%rax
+  802e21:	7f 06                	jg     802e29 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e27:	c9                   	leave
+  802e28:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e29:	49 89 c0             	mov    %rax,%r8
+  802e2c:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802e31:	48 ba a8 62 80 00 00 	movabs $0x8062a8,%rdx
+  802e38:	00 00 00 
+  802e3b:	be 27 00 00 00       	mov    $0x27,%esi
+  802e40:	48 bf c7 62 80 00 00 	movabs $0x8062c7,%rdi
+  802e47:	00 00 00 
+  802e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e4f:	49 b9 b5 16 80 00 00 	movabs $0x8016b5,%r9
+  802e56:	00 00 00 
+  802e59:	41 ff d1             	call   *%r9
+
+0000000000802e5c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802e5c:	55                   	push   %rbp
+  802e5d:	48 89 e5             	mov    %rsp,%rbp
+  802e60:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e61:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e85:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e8b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e91:	c9                   	leave
+  802e92:	c3                   	ret
+
+0000000000802e93 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802e93:	55                   	push   %rbp
+  802e94:	48 89 e5             	mov    %rsp,%rbp
+  802e97:	53                   	push   %rbx
+  802e98:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e9b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ea0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ea5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eaf:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ec0:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802ec2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ec6:	c9                   	leave
+  802ec7:	c3                   	ret
+
+0000000000802ec8 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802ec8:	55                   	push   %rbp
+  802ec9:	48 89 e5             	mov    %rsp,%rbp
+  802ecc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802ecd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ed2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ed7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802edc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ee6:	be 00 00 00 00       	mov    $0x0,%esi
+  802eeb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ef1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ef7:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ef9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802efd:	c9                   	leave
+  802efe:	c3                   	ret
+
+0000000000802eff <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  802eff:	55                   	push   %rbp
+  802f00:	48 89 e5             	mov    %rsp,%rbp
+  802f03:	41 56                	push   %r14
+  802f05:	41 55                	push   %r13
+  802f07:	41 54                	push   %r12
+  802f09:	53                   	push   %rbx
+  802f0a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802f0d:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  802f14:	00 00 00 
+  802f17:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802f1b:	74 27                	je     802f44 <_handle_vectored_pagefault+0x45>
+  802f1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802f22:	49 bd 40 80 80 01 00 	movabs $0x1808040,%r13
+  802f29:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802f2c:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  802f2f:	4c 89 e7             	mov    %r12,%rdi
+  802f32:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802f37:	84 c0                	test   %al,%al
+  802f39:	75 45                	jne    802f80 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802f3b:	48 83 c3 01          	add    $0x1,%rbx
+  802f3f:	49 3b 1e             	cmp    (%r14),%rbx
+  802f42:	72 eb                	jb     802f2f <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  802f44:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802f4b:	00 
+  802f4c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  802f51:	4d 8b 04 24          	mov    (%r12),%r8
+  802f55:	48 ba d8 62 80 00 00 	movabs $0x8062d8,%rdx
+  802f5c:	00 00 00 
+  802f5f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  802f64:	48 bf 08 63 80 00 00 	movabs $0x806308,%rdi
+  802f6b:	00 00 00 
+  802f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f73:	49 ba b5 16 80 00 00 	movabs $0x8016b5,%r10
+  802f7a:	00 00 00 
+  802f7d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  802f80:	5b                   	pop    %rbx
+  802f81:	41 5c                	pop    %r12
+  802f83:	41 5d                	pop    %r13
+  802f85:	41 5e                	pop    %r14
+  802f87:	5d                   	pop    %rbp
+  802f88:	c3                   	ret
+
+0000000000802f89 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802f89:	55                   	push   %rbp
+  802f8a:	48 89 e5             	mov    %rsp,%rbp
+  802f8d:	53                   	push   %rbx
+  802f8e:	48 83 ec 08          	sub    $0x8,%rsp
+  802f92:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  802f95:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  802f9a:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  802fa1:	00 00 00 
+  802fa4:	80 38 00             	cmpb   $0x0,(%rax)
+  802fa7:	74 68                	je     803011 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802fa9:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  802fb0:	00 00 00 
+  802fb3:	48 8b 08             	mov    (%rax),%rcx
+  802fb6:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  802fbb:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  802fc2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802fc5:	48 85 c9             	test   %rcx,%rcx
+  802fc8:	0f 84 e0 00 00 00    	je     8030ae <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802fce:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  802fd2:	0f 84 c9 00 00 00    	je     8030a1 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802fd8:	48 83 c2 01          	add    $0x1,%rdx
+  802fdc:	48 39 ca             	cmp    %rcx,%rdx
+  802fdf:	75 ed                	jne    802fce <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802fe1:	48 83 f9 08          	cmp    $0x8,%rcx
+  802fe5:	0f 84 84 00 00 00    	je     80306f <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802feb:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  802fef:	48 a3 88 80 80 01 00 	movabs %rax,0x1808088
+  802ff6:	00 00 00 
+  802ff9:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  803000:	00 00 00 
+  803003:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803007:	85 f6                	test   %esi,%esi
+  803009:	0f 89 97 00 00 00    	jns    8030a6 <add_pgfault_handler+0x11d>
+  80300f:	eb 63                	jmp    803074 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  803011:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803016:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80301b:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  803022:	00 00 00 
+  803025:	bf 00 00 00 00       	mov    $0x0,%edi
+  80302a:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  803031:	00 00 00 
+  803034:	ff d0                	call   *%rax
+  803036:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	78 38                	js     803074 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80303c:	48 be 8a 31 80 00 00 	movabs $0x80318a,%rsi
+  803043:	00 00 00 
+  803046:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304b:	48 b8 c4 2a 80 00 00 	movabs $0x802ac4,%rax
+  803052:	00 00 00 
+  803055:	ff d0                	call   *%rax
+  803057:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  803059:	85 c0                	test   %eax,%eax
+  80305b:	78 17                	js     803074 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80305d:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  803064:	00 00 00 
+  803067:	c6 00 01             	movb   $0x1,(%rax)
+  80306a:	e9 3a ff ff ff       	jmp    802fa9 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80306f:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803074:	89 f1                	mov    %esi,%ecx
+  803076:	48 ba 16 63 80 00 00 	movabs $0x806316,%rdx
+  80307d:	00 00 00 
+  803080:	be 42 00 00 00       	mov    $0x42,%esi
+  803085:	48 bf 08 63 80 00 00 	movabs $0x806308,%rdi
+  80308c:	00 00 00 
+  80308f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803094:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  80309b:	00 00 00 
+  80309e:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8030a1:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8030a6:	89 f0                	mov    %esi,%eax
+  8030a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030ac:	c9                   	leave
+  8030ad:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8030ae:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  8030b5:	00 00 00 
+  8030b8:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8030bf:	48 89 d8             	mov    %rbx,%rax
+  8030c2:	48 a3 40 80 80 01 00 	movabs %rax,0x1808040
+  8030c9:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8030cc:	eb d8                	jmp    8030a6 <add_pgfault_handler+0x11d>
+
+00000000008030ce <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8030ce:	55                   	push   %rbp
+  8030cf:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8030d2:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  8030d9:	00 00 00 
+  8030dc:	80 38 00             	cmpb   $0x0,(%rax)
+  8030df:	74 33                	je     803114 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8030e1:	48 a1 88 80 80 01 00 	movabs 0x1808088,%rax
+  8030e8:	00 00 00 
+  8030eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8030f0:	48 ba 40 80 80 01 00 	movabs $0x1808040,%rdx
+  8030f7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8030fa:	48 85 c0             	test   %rax,%rax
+  8030fd:	0f 84 85 00 00 00    	je     803188 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803103:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803107:	74 40                	je     803149 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803109:	48 83 c1 01          	add    $0x1,%rcx
+  80310d:	48 39 c1             	cmp    %rax,%rcx
+  803110:	75 f1                	jne    803103 <remove_pgfault_handler+0x35>
+  803112:	eb 74                	jmp    803188 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803114:	48 b9 2e 63 80 00 00 	movabs $0x80632e,%rcx
+  80311b:	00 00 00 
+  80311e:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803125:	00 00 00 
+  803128:	be 48 00 00 00       	mov    $0x48,%esi
+  80312d:	48 bf 08 63 80 00 00 	movabs $0x806308,%rdi
+  803134:	00 00 00 
+  803137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313c:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803143:	00 00 00 
+  803146:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803149:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803150:	00 
+  803151:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803155:	48 29 ca             	sub    %rcx,%rdx
+  803158:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  80315f:	00 00 00 
+  803162:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803166:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80316b:	48 89 ce             	mov    %rcx,%rsi
+  80316e:	48 b8 8c 24 80 00 00 	movabs $0x80248c,%rax
+  803175:	00 00 00 
+  803178:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80317a:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  803181:	00 00 00 
+  803184:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  803188:	5d                   	pop    %rbp
+  803189:	c3                   	ret
+
+000000000080318a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80318a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80318d:	48 b8 ff 2e 80 00 00 	movabs $0x802eff,%rax
+  803194:	00 00 00 
+    call *%rax
+  803197:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  803199:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8031a0:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8031a1:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8031a8:	00 
+    subq $8, %rcx
+  8031a9:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8031ad:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8031b0:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8031b7:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8031b8:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8031bc:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8031c0:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8031c5:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8031ca:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8031cf:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8031d4:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8031d9:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8031de:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8031e3:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8031e8:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8031ed:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8031f2:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8031f7:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8031fc:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  803201:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803206:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80320a:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80320e:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80320f:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803210:	c3                   	ret
+
+0000000000803211 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803211:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803218:	ff ff ff 
+  80321b:	48 01 f8             	add    %rdi,%rax
+  80321e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803222:	c3                   	ret
+
+0000000000803223 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803223:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80322a:	ff ff ff 
+  80322d:	48 01 f8             	add    %rdi,%rax
+  803230:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803234:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80323a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80323e:	c3                   	ret
+
+000000000080323f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80323f:	55                   	push   %rbp
+  803240:	48 89 e5             	mov    %rsp,%rbp
+  803243:	41 57                	push   %r15
+  803245:	41 56                	push   %r14
+  803247:	41 55                	push   %r13
+  803249:	41 54                	push   %r12
+  80324b:	53                   	push   %rbx
+  80324c:	48 83 ec 08          	sub    $0x8,%rsp
+  803250:	49 89 ff             	mov    %rdi,%r15
+  803253:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803258:	49 bd 3f 47 80 00 00 	movabs $0x80473f,%r13
+  80325f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803262:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803268:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80326b:	48 89 df             	mov    %rbx,%rdi
+  80326e:	41 ff d5             	call   *%r13
+  803271:	83 e0 04             	and    $0x4,%eax
+  803274:	74 17                	je     80328d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803276:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80327d:	4c 39 f3             	cmp    %r14,%rbx
+  803280:	75 e6                	jne    803268 <fd_alloc+0x29>
+  803282:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803288:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80328d:	4d 89 27             	mov    %r12,(%r15)
+}
+  803290:	48 83 c4 08          	add    $0x8,%rsp
+  803294:	5b                   	pop    %rbx
+  803295:	41 5c                	pop    %r12
+  803297:	41 5d                	pop    %r13
+  803299:	41 5e                	pop    %r14
+  80329b:	41 5f                	pop    %r15
+  80329d:	5d                   	pop    %rbp
+  80329e:	c3                   	ret
+
+000000000080329f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80329f:	83 ff 1f             	cmp    $0x1f,%edi
+  8032a2:	77 39                	ja     8032dd <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8032a4:	55                   	push   %rbp
+  8032a5:	48 89 e5             	mov    %rsp,%rbp
+  8032a8:	41 54                	push   %r12
+  8032aa:	53                   	push   %rbx
+  8032ab:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8032ae:	48 63 df             	movslq %edi,%rbx
+  8032b1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8032b8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8032bc:	48 89 df             	mov    %rbx,%rdi
+  8032bf:	48 b8 3f 47 80 00 00 	movabs $0x80473f,%rax
+  8032c6:	00 00 00 
+  8032c9:	ff d0                	call   *%rax
+  8032cb:	a8 04                	test   $0x4,%al
+  8032cd:	74 14                	je     8032e3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8032cf:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8032d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032d8:	5b                   	pop    %rbx
+  8032d9:	41 5c                	pop    %r12
+  8032db:	5d                   	pop    %rbp
+  8032dc:	c3                   	ret
+        return -E_INVAL;
+  8032dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8032e2:	c3                   	ret
+        return -E_INVAL;
+  8032e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032e8:	eb ee                	jmp    8032d8 <fd_lookup+0x39>
+
+00000000008032ea <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8032ea:	55                   	push   %rbp
+  8032eb:	48 89 e5             	mov    %rsp,%rbp
+  8032ee:	41 54                	push   %r12
+  8032f0:	53                   	push   %rbx
+  8032f1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8032f4:	48 b8 e0 63 80 00 00 	movabs $0x8063e0,%rax
+  8032fb:	00 00 00 
+  8032fe:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803305:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803308:	39 3b                	cmp    %edi,(%rbx)
+  80330a:	74 47                	je     803353 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80330c:	48 83 c0 08          	add    $0x8,%rax
+  803310:	48 8b 18             	mov    (%rax),%rbx
+  803313:	48 85 db             	test   %rbx,%rbx
+  803316:	75 f0                	jne    803308 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803318:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80331f:	00 00 00 
+  803322:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803328:	89 fa                	mov    %edi,%edx
+  80332a:	48 bf 60 63 80 00 00 	movabs $0x806360,%rdi
+  803331:	00 00 00 
+  803334:	b8 00 00 00 00       	mov    $0x0,%eax
+  803339:	48 b9 05 18 80 00 00 	movabs $0x801805,%rcx
+  803340:	00 00 00 
+  803343:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803345:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80334a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80334e:	5b                   	pop    %rbx
+  80334f:	41 5c                	pop    %r12
+  803351:	5d                   	pop    %rbp
+  803352:	c3                   	ret
+            return 0;
+  803353:	b8 00 00 00 00       	mov    $0x0,%eax
+  803358:	eb f0                	jmp    80334a <dev_lookup+0x60>
+
+000000000080335a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80335a:	55                   	push   %rbp
+  80335b:	48 89 e5             	mov    %rsp,%rbp
+  80335e:	41 55                	push   %r13
+  803360:	41 54                	push   %r12
+  803362:	53                   	push   %rbx
+  803363:	48 83 ec 18          	sub    $0x18,%rsp
+  803367:	48 89 fb             	mov    %rdi,%rbx
+  80336a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80336d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803374:	ff ff ff 
+  803377:	48 01 df             	add    %rbx,%rdi
+  80337a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80337e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803382:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	41 89 c5             	mov    %eax,%r13d
+  803391:	85 c0                	test   %eax,%eax
+  803393:	78 06                	js     80339b <fd_close+0x41>
+  803395:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803399:	74 1a                	je     8033b5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80339b:	45 84 e4             	test   %r12b,%r12b
+  80339e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8033a7:	44 89 e8             	mov    %r13d,%eax
+  8033aa:	48 83 c4 18          	add    $0x18,%rsp
+  8033ae:	5b                   	pop    %rbx
+  8033af:	41 5c                	pop    %r12
+  8033b1:	41 5d                	pop    %r13
+  8033b3:	5d                   	pop    %rbp
+  8033b4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8033b5:	8b 3b                	mov    (%rbx),%edi
+  8033b7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033bb:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  8033c2:	00 00 00 
+  8033c5:	ff d0                	call   *%rax
+  8033c7:	41 89 c5             	mov    %eax,%r13d
+  8033ca:	85 c0                	test   %eax,%eax
+  8033cc:	78 1b                	js     8033e9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8033ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033d2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8033d6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8033dc:	48 85 c0             	test   %rax,%rax
+  8033df:	74 08                	je     8033e9 <fd_close+0x8f>
+  8033e1:	48 89 df             	mov    %rbx,%rdi
+  8033e4:	ff d0                	call   *%rax
+  8033e6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8033e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033ee:	48 89 de             	mov    %rbx,%rsi
+  8033f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f6:	48 b8 79 29 80 00 00 	movabs $0x802979,%rax
+  8033fd:	00 00 00 
+  803400:	ff d0                	call   *%rax
+    return res;
+  803402:	eb a3                	jmp    8033a7 <fd_close+0x4d>
+
+0000000000803404 <close>:
+
+int
+close(int fdnum) {
+  803404:	55                   	push   %rbp
+  803405:	48 89 e5             	mov    %rsp,%rbp
+  803408:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80340c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803410:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  803417:	00 00 00 
+  80341a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80341c:	85 c0                	test   %eax,%eax
+  80341e:	78 15                	js     803435 <close+0x31>
+
+    return fd_close(fd, 1);
+  803420:	be 01 00 00 00       	mov    $0x1,%esi
+  803425:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803429:	48 b8 5a 33 80 00 00 	movabs $0x80335a,%rax
+  803430:	00 00 00 
+  803433:	ff d0                	call   *%rax
+}
+  803435:	c9                   	leave
+  803436:	c3                   	ret
+
+0000000000803437 <close_all>:
+
+void
+close_all(void) {
+  803437:	55                   	push   %rbp
+  803438:	48 89 e5             	mov    %rsp,%rbp
+  80343b:	41 54                	push   %r12
+  80343d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80343e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803443:	49 bc 04 34 80 00 00 	movabs $0x803404,%r12
+  80344a:	00 00 00 
+  80344d:	89 df                	mov    %ebx,%edi
+  80344f:	41 ff d4             	call   *%r12
+  803452:	83 c3 01             	add    $0x1,%ebx
+  803455:	83 fb 20             	cmp    $0x20,%ebx
+  803458:	75 f3                	jne    80344d <close_all+0x16>
+}
+  80345a:	5b                   	pop    %rbx
+  80345b:	41 5c                	pop    %r12
+  80345d:	5d                   	pop    %rbp
+  80345e:	c3                   	ret
+
+000000000080345f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80345f:	55                   	push   %rbp
+  803460:	48 89 e5             	mov    %rsp,%rbp
+  803463:	41 57                	push   %r15
+  803465:	41 56                	push   %r14
+  803467:	41 55                	push   %r13
+  803469:	41 54                	push   %r12
+  80346b:	53                   	push   %rbx
+  80346c:	48 83 ec 18          	sub    $0x18,%rsp
+  803470:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803473:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803477:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	89 c3                	mov    %eax,%ebx
+  803485:	85 c0                	test   %eax,%eax
+  803487:	0f 88 b8 00 00 00    	js     803545 <dup+0xe6>
+    close(newfdnum);
+  80348d:	44 89 e7             	mov    %r12d,%edi
+  803490:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80349c:	4d 63 ec             	movslq %r12d,%r13
+  80349f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8034a6:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8034aa:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8034ae:	4c 89 ff             	mov    %r15,%rdi
+  8034b1:	49 be 23 32 80 00 00 	movabs $0x803223,%r14
+  8034b8:	00 00 00 
+  8034bb:	41 ff d6             	call   *%r14
+  8034be:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8034c1:	4c 89 ef             	mov    %r13,%rdi
+  8034c4:	41 ff d6             	call   *%r14
+  8034c7:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8034ca:	48 89 df             	mov    %rbx,%rdi
+  8034cd:	48 b8 3f 47 80 00 00 	movabs $0x80473f,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8034d9:	a8 04                	test   $0x4,%al
+  8034db:	74 2b                	je     803508 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8034dd:	41 89 c1             	mov    %eax,%r9d
+  8034e0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8034e6:	4c 89 f1             	mov    %r14,%rcx
+  8034e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ee:	48 89 de             	mov    %rbx,%rsi
+  8034f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f6:	48 b8 0e 29 80 00 00 	movabs $0x80290e,%rax
+  8034fd:	00 00 00 
+  803500:	ff d0                	call   *%rax
+  803502:	89 c3                	mov    %eax,%ebx
+  803504:	85 c0                	test   %eax,%eax
+  803506:	78 4e                	js     803556 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803508:	4c 89 ff             	mov    %r15,%rdi
+  80350b:	48 b8 3f 47 80 00 00 	movabs $0x80473f,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+  803517:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80351a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803520:	4c 89 e9             	mov    %r13,%rcx
+  803523:	ba 00 00 00 00       	mov    $0x0,%edx
+  803528:	4c 89 fe             	mov    %r15,%rsi
+  80352b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803530:	48 b8 0e 29 80 00 00 	movabs $0x80290e,%rax
+  803537:	00 00 00 
+  80353a:	ff d0                	call   *%rax
+  80353c:	89 c3                	mov    %eax,%ebx
+  80353e:	85 c0                	test   %eax,%eax
+  803540:	78 14                	js     803556 <dup+0xf7>
+
+    return newfdnum;
+  803542:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803545:	89 d8                	mov    %ebx,%eax
+  803547:	48 83 c4 18          	add    $0x18,%rsp
+  80354b:	5b                   	pop    %rbx
+  80354c:	41 5c                	pop    %r12
+  80354e:	41 5d                	pop    %r13
+  803550:	41 5e                	pop    %r14
+  803552:	41 5f                	pop    %r15
+  803554:	5d                   	pop    %rbp
+  803555:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803556:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80355b:	4c 89 ee             	mov    %r13,%rsi
+  80355e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803563:	49 bc 79 29 80 00 00 	movabs $0x802979,%r12
+  80356a:	00 00 00 
+  80356d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803570:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803575:	4c 89 f6             	mov    %r14,%rsi
+  803578:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357d:	41 ff d4             	call   *%r12
+    return res;
+  803580:	eb c3                	jmp    803545 <dup+0xe6>
+
+0000000000803582 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803582:	55                   	push   %rbp
+  803583:	48 89 e5             	mov    %rsp,%rbp
+  803586:	41 56                	push   %r14
+  803588:	41 55                	push   %r13
+  80358a:	41 54                	push   %r12
+  80358c:	53                   	push   %rbx
+  80358d:	48 83 ec 10          	sub    $0x10,%rsp
+  803591:	89 fb                	mov    %edi,%ebx
+  803593:	49 89 f4             	mov    %rsi,%r12
+  803596:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803599:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80359d:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  8035a4:	00 00 00 
+  8035a7:	ff d0                	call   *%rax
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	78 4c                	js     8035f9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035ad:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8035b1:	41 8b 3e             	mov    (%r14),%edi
+  8035b4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035b8:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  8035bf:	00 00 00 
+  8035c2:	ff d0                	call   *%rax
+  8035c4:	85 c0                	test   %eax,%eax
+  8035c6:	78 35                	js     8035fd <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8035c8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8035cc:	83 e0 03             	and    $0x3,%eax
+  8035cf:	83 f8 01             	cmp    $0x1,%eax
+  8035d2:	74 2d                	je     803601 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8035d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035d8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8035dc:	48 85 c0             	test   %rax,%rax
+  8035df:	74 56                	je     803637 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8035e1:	4c 89 ea             	mov    %r13,%rdx
+  8035e4:	4c 89 e6             	mov    %r12,%rsi
+  8035e7:	4c 89 f7             	mov    %r14,%rdi
+  8035ea:	ff d0                	call   *%rax
+}
+  8035ec:	48 83 c4 10          	add    $0x10,%rsp
+  8035f0:	5b                   	pop    %rbx
+  8035f1:	41 5c                	pop    %r12
+  8035f3:	41 5d                	pop    %r13
+  8035f5:	41 5e                	pop    %r14
+  8035f7:	5d                   	pop    %rbp
+  8035f8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035f9:	48 98                	cltq
+  8035fb:	eb ef                	jmp    8035ec <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035fd:	48 98                	cltq
+  8035ff:	eb eb                	jmp    8035ec <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803601:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803608:	00 00 00 
+  80360b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803611:	89 da                	mov    %ebx,%edx
+  803613:	48 bf a1 63 80 00 00 	movabs $0x8063a1,%rdi
+  80361a:	00 00 00 
+  80361d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803622:	48 b9 05 18 80 00 00 	movabs $0x801805,%rcx
+  803629:	00 00 00 
+  80362c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80362e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803635:	eb b5                	jmp    8035ec <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803637:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80363e:	eb ac                	jmp    8035ec <read+0x6a>
+
+0000000000803640 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803640:	55                   	push   %rbp
+  803641:	48 89 e5             	mov    %rsp,%rbp
+  803644:	41 57                	push   %r15
+  803646:	41 56                	push   %r14
+  803648:	41 55                	push   %r13
+  80364a:	41 54                	push   %r12
+  80364c:	53                   	push   %rbx
+  80364d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803651:	48 85 d2             	test   %rdx,%rdx
+  803654:	74 54                	je     8036aa <readn+0x6a>
+  803656:	41 89 fd             	mov    %edi,%r13d
+  803659:	49 89 f6             	mov    %rsi,%r14
+  80365c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80365f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803664:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803669:	49 bf 82 35 80 00 00 	movabs $0x803582,%r15
+  803670:	00 00 00 
+  803673:	4c 89 e2             	mov    %r12,%rdx
+  803676:	48 29 f2             	sub    %rsi,%rdx
+  803679:	4c 01 f6             	add    %r14,%rsi
+  80367c:	44 89 ef             	mov    %r13d,%edi
+  80367f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803682:	85 c0                	test   %eax,%eax
+  803684:	78 20                	js     8036a6 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803686:	01 c3                	add    %eax,%ebx
+  803688:	85 c0                	test   %eax,%eax
+  80368a:	74 08                	je     803694 <readn+0x54>
+  80368c:	48 63 f3             	movslq %ebx,%rsi
+  80368f:	4c 39 e6             	cmp    %r12,%rsi
+  803692:	72 df                	jb     803673 <readn+0x33>
+    }
+    return res;
+  803694:	48 63 c3             	movslq %ebx,%rax
+}
+  803697:	48 83 c4 08          	add    $0x8,%rsp
+  80369b:	5b                   	pop    %rbx
+  80369c:	41 5c                	pop    %r12
+  80369e:	41 5d                	pop    %r13
+  8036a0:	41 5e                	pop    %r14
+  8036a2:	41 5f                	pop    %r15
+  8036a4:	5d                   	pop    %rbp
+  8036a5:	c3                   	ret
+        if (inc < 0) return inc;
+  8036a6:	48 98                	cltq
+  8036a8:	eb ed                	jmp    803697 <readn+0x57>
+    int inc = 1, res = 0;
+  8036aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036af:	eb e3                	jmp    803694 <readn+0x54>
+
+00000000008036b1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8036b1:	55                   	push   %rbp
+  8036b2:	48 89 e5             	mov    %rsp,%rbp
+  8036b5:	41 56                	push   %r14
+  8036b7:	41 55                	push   %r13
+  8036b9:	41 54                	push   %r12
+  8036bb:	53                   	push   %rbx
+  8036bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8036c0:	89 fb                	mov    %edi,%ebx
+  8036c2:	49 89 f4             	mov    %rsi,%r12
+  8036c5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036c8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036cc:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+  8036d8:	85 c0                	test   %eax,%eax
+  8036da:	78 47                	js     803723 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036dc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8036e0:	41 8b 3e             	mov    (%r14),%edi
+  8036e3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036e7:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  8036ee:	00 00 00 
+  8036f1:	ff d0                	call   *%rax
+  8036f3:	85 c0                	test   %eax,%eax
+  8036f5:	78 30                	js     803727 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036f7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8036fc:	74 2d                	je     80372b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8036fe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803702:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803706:	48 85 c0             	test   %rax,%rax
+  803709:	74 56                	je     803761 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80370b:	4c 89 ea             	mov    %r13,%rdx
+  80370e:	4c 89 e6             	mov    %r12,%rsi
+  803711:	4c 89 f7             	mov    %r14,%rdi
+  803714:	ff d0                	call   *%rax
+}
+  803716:	48 83 c4 10          	add    $0x10,%rsp
+  80371a:	5b                   	pop    %rbx
+  80371b:	41 5c                	pop    %r12
+  80371d:	41 5d                	pop    %r13
+  80371f:	41 5e                	pop    %r14
+  803721:	5d                   	pop    %rbp
+  803722:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803723:	48 98                	cltq
+  803725:	eb ef                	jmp    803716 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803727:	48 98                	cltq
+  803729:	eb eb                	jmp    803716 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80372b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803732:	00 00 00 
+  803735:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80373b:	89 da                	mov    %ebx,%edx
+  80373d:	48 bf bd 63 80 00 00 	movabs $0x8063bd,%rdi
+  803744:	00 00 00 
+  803747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374c:	48 b9 05 18 80 00 00 	movabs $0x801805,%rcx
+  803753:	00 00 00 
+  803756:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803758:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80375f:	eb b5                	jmp    803716 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803761:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803768:	eb ac                	jmp    803716 <write+0x65>
+
+000000000080376a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80376a:	55                   	push   %rbp
+  80376b:	48 89 e5             	mov    %rsp,%rbp
+  80376e:	53                   	push   %rbx
+  80376f:	48 83 ec 18          	sub    $0x18,%rsp
+  803773:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803775:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803779:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  803780:	00 00 00 
+  803783:	ff d0                	call   *%rax
+  803785:	85 c0                	test   %eax,%eax
+  803787:	78 0c                	js     803795 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80378d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803790:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803795:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803799:	c9                   	leave
+  80379a:	c3                   	ret
+
+000000000080379b <tell>:
+
+int tell(int fdnum) {
+  80379b:	55                   	push   %rbp
+  80379c:	48 89 e5             	mov    %rsp,%rbp
+  80379f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037a3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037a7:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  8037ae:	00 00 00 
+  8037b1:	ff d0                	call   *%rax
+  8037b3:	85 c0                	test   %eax,%eax
+  8037b5:	78 07                	js     8037be <tell+0x23>
+
+    return fd->fd_offset;
+  8037b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037bb:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8037be:	c9                   	leave
+  8037bf:	c3                   	ret
+
+00000000008037c0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8037c0:	55                   	push   %rbp
+  8037c1:	48 89 e5             	mov    %rsp,%rbp
+  8037c4:	41 55                	push   %r13
+  8037c6:	41 54                	push   %r12
+  8037c8:	53                   	push   %rbx
+  8037c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8037cd:	89 fb                	mov    %edi,%ebx
+  8037cf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037d2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037d6:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  8037dd:	00 00 00 
+  8037e0:	ff d0                	call   *%rax
+  8037e2:	85 c0                	test   %eax,%eax
+  8037e4:	78 38                	js     80381e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037e6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8037ea:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8037ee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037f2:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  8037f9:	00 00 00 
+  8037fc:	ff d0                	call   *%rax
+  8037fe:	85 c0                	test   %eax,%eax
+  803800:	78 1c                	js     80381e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803802:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803807:	74 20                	je     803829 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803809:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80380d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803811:	48 85 c0             	test   %rax,%rax
+  803814:	74 47                	je     80385d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803816:	44 89 e6             	mov    %r12d,%esi
+  803819:	4c 89 ef             	mov    %r13,%rdi
+  80381c:	ff d0                	call   *%rax
+}
+  80381e:	48 83 c4 18          	add    $0x18,%rsp
+  803822:	5b                   	pop    %rbx
+  803823:	41 5c                	pop    %r12
+  803825:	41 5d                	pop    %r13
+  803827:	5d                   	pop    %rbp
+  803828:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803829:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803830:	00 00 00 
+  803833:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803839:	89 da                	mov    %ebx,%edx
+  80383b:	48 bf 80 63 80 00 00 	movabs $0x806380,%rdi
+  803842:	00 00 00 
+  803845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384a:	48 b9 05 18 80 00 00 	movabs $0x801805,%rcx
+  803851:	00 00 00 
+  803854:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803856:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80385b:	eb c1                	jmp    80381e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80385d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803862:	eb ba                	jmp    80381e <ftruncate+0x5e>
+
+0000000000803864 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803864:	55                   	push   %rbp
+  803865:	48 89 e5             	mov    %rsp,%rbp
+  803868:	41 54                	push   %r12
+  80386a:	53                   	push   %rbx
+  80386b:	48 83 ec 10          	sub    $0x10,%rsp
+  80386f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803872:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803876:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  80387d:	00 00 00 
+  803880:	ff d0                	call   *%rax
+  803882:	85 c0                	test   %eax,%eax
+  803884:	78 63                	js     8038e9 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803886:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80388a:	41 8b 3c 24          	mov    (%r12),%edi
+  80388e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803892:	48 b8 ea 32 80 00 00 	movabs $0x8032ea,%rax
+  803899:	00 00 00 
+  80389c:	ff d0                	call   *%rax
+  80389e:	85 c0                	test   %eax,%eax
+  8038a0:	78 47                	js     8038e9 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8038a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038a6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8038ab:	74 45                	je     8038f2 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8038ad:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8038b0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8038b7:	00 00 00 
+    stat->st_isdir = 0;
+  8038ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8038c1:	00 00 00 
+    stat->st_ino = 0;
+  8038c4:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8038cb:	00 00 00 00 
+    stat->st_version = 0;
+  8038cf:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8038d6:	00 00 00 
+    stat->st_dev = dev;
+  8038d9:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8038e0:	48 89 de             	mov    %rbx,%rsi
+  8038e3:	4c 89 e7             	mov    %r12,%rdi
+  8038e6:	ff 50 28             	call   *0x28(%rax)
+}
+  8038e9:	48 83 c4 10          	add    $0x10,%rsp
+  8038ed:	5b                   	pop    %rbx
+  8038ee:	41 5c                	pop    %r12
+  8038f0:	5d                   	pop    %rbp
+  8038f1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8038f2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8038f7:	eb f0                	jmp    8038e9 <fstat+0x85>
+
+00000000008038f9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8038f9:	55                   	push   %rbp
+  8038fa:	48 89 e5             	mov    %rsp,%rbp
+  8038fd:	41 54                	push   %r12
+  8038ff:	53                   	push   %rbx
+  803900:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803903:	be 00 00 00 00       	mov    $0x0,%esi
+  803908:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  80390f:	00 00 00 
+  803912:	ff d0                	call   *%rax
+  803914:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803916:	85 c0                	test   %eax,%eax
+  803918:	78 25                	js     80393f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80391a:	4c 89 e6             	mov    %r12,%rsi
+  80391d:	89 c7                	mov    %eax,%edi
+  80391f:	48 b8 64 38 80 00 00 	movabs $0x803864,%rax
+  803926:	00 00 00 
+  803929:	ff d0                	call   *%rax
+  80392b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80392e:	89 df                	mov    %ebx,%edi
+  803930:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  803937:	00 00 00 
+  80393a:	ff d0                	call   *%rax
+
+    return res;
+  80393c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80393f:	89 d8                	mov    %ebx,%eax
+  803941:	5b                   	pop    %rbx
+  803942:	41 5c                	pop    %r12
+  803944:	5d                   	pop    %rbp
+  803945:	c3                   	ret
+
+0000000000803946 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803946:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80394d:	00 00 00 
+  803950:	83 38 00             	cmpl   $0x0,(%rax)
+  803953:	74 0a                	je     80395f <fsipc_env+0x19>
+    return fsenv;
+}
+  803955:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80395c:	00 00 
+  80395e:	c3                   	ret
+fsipc_env(void) {
+  80395f:	55                   	push   %rbp
+  803960:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803963:	bf 03 00 00 00       	mov    $0x3,%edi
+  803968:	48 b8 37 57 80 00 00 	movabs $0x805737,%rax
+  80396f:	00 00 00 
+  803972:	ff d0                	call   *%rax
+  803974:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80397b:	00 00 
+}
+  80397d:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803984:	00 00 
+  803986:	5d                   	pop    %rbp
+  803987:	c3                   	ret
+
+0000000000803988 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803988:	55                   	push   %rbp
+  803989:	48 89 e5             	mov    %rsp,%rbp
+  80398c:	53                   	push   %rbx
+  80398d:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803991:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803998:	00 
+  803999:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8039a0:	00 
+  8039a1:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8039a8:	00 
+  8039a9:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8039b0:	00 
+  8039b1:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8039b8:	00 
+
+    assert(size <= sizeof(words));
+  8039b9:	48 83 fa 28          	cmp    $0x28,%rdx
+  8039bd:	77 38                	ja     8039f7 <fsipc_short+0x6f>
+  8039bf:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8039c1:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8039c5:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  8039cc:	00 00 00 
+  8039cf:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8039d1:	48 b8 46 39 80 00 00 	movabs $0x803946,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+  8039dd:	89 c7                	mov    %eax,%edi
+  8039df:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039e3:	89 de                	mov    %ebx,%esi
+  8039e5:	48 b8 9a 56 80 00 00 	movabs $0x80569a,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+}
+  8039f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039f5:	c9                   	leave
+  8039f6:	c3                   	ret
+    assert(size <= sizeof(words));
+  8039f7:	48 b9 00 64 80 00 00 	movabs $0x806400,%rcx
+  8039fe:	00 00 00 
+  803a01:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803a08:	00 00 00 
+  803a0b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803a10:	48 bf 16 64 80 00 00 	movabs $0x806416,%rdi
+  803a17:	00 00 00 
+  803a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a1f:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803a26:	00 00 00 
+  803a29:	41 ff d0             	call   *%r8
+
+0000000000803a2c <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a2c:	55                   	push   %rbp
+  803a2d:	48 89 e5             	mov    %rsp,%rbp
+  803a30:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803a34:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803a37:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803a3a:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803a3d:	ba 08 00 00 00       	mov    $0x8,%edx
+  803a42:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a46:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a4b:	48 b8 88 39 80 00 00 	movabs $0x803988,%rax
+  803a52:	00 00 00 
+  803a55:	ff d0                	call   *%rax
+}
+  803a57:	c9                   	leave
+  803a58:	c3                   	ret
+
+0000000000803a59 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803a59:	55                   	push   %rbp
+  803a5a:	48 89 e5             	mov    %rsp,%rbp
+  803a5d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803a61:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803a64:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803a67:	ba 04 00 00 00       	mov    $0x4,%edx
+  803a6c:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803a70:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a75:	48 b8 88 39 80 00 00 	movabs $0x803988,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+}
+  803a81:	c9                   	leave
+  803a82:	c3                   	ret
+
+0000000000803a83 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803a83:	55                   	push   %rbp
+  803a84:	48 89 e5             	mov    %rsp,%rbp
+  803a87:	41 54                	push   %r12
+  803a89:	53                   	push   %rbx
+  803a8a:	48 83 ec 10          	sub    $0x10,%rsp
+  803a8e:	89 fb                	mov    %edi,%ebx
+  803a90:	49 89 f4             	mov    %rsi,%r12
+  803a93:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803a97:	48 b8 46 39 80 00 00 	movabs $0x803946,%rax
+  803a9e:	00 00 00 
+  803aa1:	ff d0                	call   *%rax
+  803aa3:	89 c7                	mov    %eax,%edi
+  803aa5:	6a 00                	push   $0x0
+  803aa7:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803aab:	50                   	push   %rax
+  803aac:	4d 89 e1             	mov    %r12,%r9
+  803aaf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803ab5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803aba:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803ac1:	00 00 00 
+  803ac4:	89 de                	mov    %ebx,%esi
+  803ac6:	48 b8 35 56 80 00 00 	movabs $0x805635,%rax
+  803acd:	00 00 00 
+  803ad0:	ff d0                	call   *%rax
+}
+  803ad2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803ad6:	5b                   	pop    %rbx
+  803ad7:	41 5c                	pop    %r12
+  803ad9:	5d                   	pop    %rbp
+  803ada:	c3                   	ret
+
+0000000000803adb <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803adb:	55                   	push   %rbp
+  803adc:	48 89 e5             	mov    %rsp,%rbp
+  803adf:	41 54                	push   %r12
+  803ae1:	53                   	push   %rbx
+  803ae2:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803ae5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803ae8:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803aef:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803af1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af6:	be 00 00 00 00       	mov    $0x0,%esi
+  803afb:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b00:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  803b07:	00 00 00 
+  803b0a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b0c:	85 c0                	test   %eax,%eax
+  803b0e:	78 5a                	js     803b6a <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b10:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803b17:	00 00 00 
+  803b1a:	4c 89 e6             	mov    %r12,%rsi
+  803b1d:	48 89 df             	mov    %rbx,%rdi
+  803b20:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  803b27:	00 00 00 
+  803b2a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803b2c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803b33:	00 
+  803b34:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803b3a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803b41:	00 
+  803b42:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803b48:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803b4f:	00 
+  803b50:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803b57:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803b5e:	00 
+  803b5f:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803b65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b6a:	5b                   	pop    %rbx
+  803b6b:	41 5c                	pop    %r12
+  803b6d:	5d                   	pop    %rbp
+  803b6e:	c3                   	ret
+
+0000000000803b6f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803b6f:	55                   	push   %rbp
+  803b70:	48 89 e5             	mov    %rsp,%rbp
+  803b73:	41 57                	push   %r15
+  803b75:	41 56                	push   %r14
+  803b77:	41 55                	push   %r13
+  803b79:	41 54                	push   %r12
+  803b7b:	53                   	push   %rbx
+  803b7c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803b80:	48 85 ff             	test   %rdi,%rdi
+  803b83:	0f 84 a1 00 00 00    	je     803c2a <devfile_read+0xbb>
+  803b89:	49 89 ff             	mov    %rdi,%r15
+  803b8c:	49 89 f5             	mov    %rsi,%r13
+  803b8f:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803b92:	48 85 f6             	test   %rsi,%rsi
+  803b95:	0f 84 c4 00 00 00    	je     803c5f <devfile_read+0xf0>
+    size_t total_read = 0;
+  803b9b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803ba2:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803ba3:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803baa:	00 00 00 
+  803bad:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803bb1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803bb4:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bb8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bbd:	be 00 00 00 00       	mov    $0x0,%esi
+  803bc2:	bf 03 00 00 00       	mov    $0x3,%edi
+  803bc7:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  803bce:	00 00 00 
+  803bd1:	ff d0                	call   *%rax
+        if (res < 0) {
+  803bd3:	85 c0                	test   %eax,%eax
+  803bd5:	0f 88 b9 00 00 00    	js     803c94 <devfile_read+0x125>
+        assert(res <= n);
+  803bdb:	48 63 d8             	movslq %eax,%rbx
+  803bde:	49 39 dc             	cmp    %rbx,%r12
+  803be1:	0f 82 b1 00 00 00    	jb     803c98 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803be7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803bec:	0f 87 db 00 00 00    	ja     803ccd <devfile_read+0x15e>
+        if (!res) {
+  803bf2:	85 c0                	test   %eax,%eax
+  803bf4:	74 21                	je     803c17 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803bf6:	48 89 da             	mov    %rbx,%rdx
+  803bf9:	4c 89 f6             	mov    %r14,%rsi
+  803bfc:	4c 89 ef             	mov    %r13,%rdi
+  803bff:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  803c06:	00 00 00 
+  803c09:	ff d0                	call   *%rax
+        total_read += res;
+  803c0b:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803c0f:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803c12:	49 29 dc             	sub    %rbx,%r12
+  803c15:	75 96                	jne    803bad <devfile_read+0x3e>
+    return total_read;
+  803c17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803c1b:	48 83 c4 18          	add    $0x18,%rsp
+  803c1f:	5b                   	pop    %rbx
+  803c20:	41 5c                	pop    %r12
+  803c22:	41 5d                	pop    %r13
+  803c24:	41 5e                	pop    %r14
+  803c26:	41 5f                	pop    %r15
+  803c28:	5d                   	pop    %rbp
+  803c29:	c3                   	ret
+    assert(fd);
+  803c2a:	48 b9 21 64 80 00 00 	movabs $0x806421,%rcx
+  803c31:	00 00 00 
+  803c34:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803c3b:	00 00 00 
+  803c3e:	be 91 00 00 00       	mov    $0x91,%esi
+  803c43:	48 bf 16 64 80 00 00 	movabs $0x806416,%rdi
+  803c4a:	00 00 00 
+  803c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c52:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803c59:	00 00 00 
+  803c5c:	41 ff d0             	call   *%r8
+    assert(buf);
+  803c5f:	48 b9 24 64 80 00 00 	movabs $0x806424,%rcx
+  803c66:	00 00 00 
+  803c69:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803c70:	00 00 00 
+  803c73:	be 92 00 00 00       	mov    $0x92,%esi
+  803c78:	48 bf 16 64 80 00 00 	movabs $0x806416,%rdi
+  803c7f:	00 00 00 
+  803c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c87:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803c8e:	00 00 00 
+  803c91:	41 ff d0             	call   *%r8
+            return res;
+  803c94:	48 98                	cltq
+  803c96:	eb 83                	jmp    803c1b <devfile_read+0xac>
+        assert(res <= n);
+  803c98:	48 b9 28 64 80 00 00 	movabs $0x806428,%rcx
+  803c9f:	00 00 00 
+  803ca2:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803ca9:	00 00 00 
+  803cac:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803cb1:	48 bf 16 64 80 00 00 	movabs $0x806416,%rdi
+  803cb8:	00 00 00 
+  803cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cc0:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803cc7:	00 00 00 
+  803cca:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803ccd:	48 b9 38 64 80 00 00 	movabs $0x806438,%rcx
+  803cd4:	00 00 00 
+  803cd7:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803cde:	00 00 00 
+  803ce1:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803ce6:	48 bf 16 64 80 00 00 	movabs $0x806416,%rdi
+  803ced:	00 00 00 
+  803cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cf5:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803cfc:	00 00 00 
+  803cff:	41 ff d0             	call   *%r8
+
+0000000000803d02 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803d02:	55                   	push   %rbp
+  803d03:	48 89 e5             	mov    %rsp,%rbp
+  803d06:	41 57                	push   %r15
+  803d08:	41 56                	push   %r14
+  803d0a:	41 55                	push   %r13
+  803d0c:	41 54                	push   %r12
+  803d0e:	53                   	push   %rbx
+  803d0f:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803d13:	48 85 ff             	test   %rdi,%rdi
+  803d16:	0f 84 83 00 00 00    	je     803d9f <devfile_write+0x9d>
+  803d1c:	49 89 ff             	mov    %rdi,%r15
+  803d1f:	49 89 f4             	mov    %rsi,%r12
+  803d22:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803d25:	48 85 f6             	test   %rsi,%rsi
+  803d28:	0f 84 a6 00 00 00    	je     803dd4 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803d2e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803d34:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803d3b:	00 00 00 
+  803d3e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d42:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803d45:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803d49:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803d4e:	48 39 d3             	cmp    %rdx,%rbx
+  803d51:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803d55:	4c 89 e6             	mov    %r12,%rsi
+  803d58:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803d5f:	00 00 00 
+  803d62:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  803d69:	00 00 00 
+  803d6c:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d6e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d73:	be 00 00 00 00       	mov    $0x0,%esi
+  803d78:	bf 04 00 00 00       	mov    $0x4,%edi
+  803d7d:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  803d84:	00 00 00 
+  803d87:	ff d0                	call   *%rax
+        if (res < 0) {
+  803d89:	85 c0                	test   %eax,%eax
+  803d8b:	78 7c                	js     803e09 <devfile_write+0x107>
+        total_written += res;
+  803d8d:	48 98                	cltq
+  803d8f:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803d92:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803d95:	48 29 c3             	sub    %rax,%rbx
+  803d98:	75 a4                	jne    803d3e <devfile_write+0x3c>
+    return total_written;
+  803d9a:	4c 89 e8             	mov    %r13,%rax
+  803d9d:	eb 6c                	jmp    803e0b <devfile_write+0x109>
+    assert(fd);
+  803d9f:	48 b9 21 64 80 00 00 	movabs $0x806421,%rcx
+  803da6:	00 00 00 
+  803da9:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803db0:	00 00 00 
+  803db3:	be bd 00 00 00       	mov    $0xbd,%esi
+  803db8:	48 bf 16 64 80 00 00 	movabs $0x806416,%rdi
+  803dbf:	00 00 00 
+  803dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc7:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803dce:	00 00 00 
+  803dd1:	41 ff d0             	call   *%r8
+    assert(buf);
+  803dd4:	48 b9 24 64 80 00 00 	movabs $0x806424,%rcx
+  803ddb:	00 00 00 
+  803dde:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  803de5:	00 00 00 
+  803de8:	be be 00 00 00       	mov    $0xbe,%esi
+  803ded:	48 bf 16 64 80 00 00 	movabs $0x806416,%rdi
+  803df4:	00 00 00 
+  803df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dfc:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  803e03:	00 00 00 
+  803e06:	41 ff d0             	call   *%r8
+            return res;
+  803e09:	48 98                	cltq
+}
+  803e0b:	48 83 c4 08          	add    $0x8,%rsp
+  803e0f:	5b                   	pop    %rbx
+  803e10:	41 5c                	pop    %r12
+  803e12:	41 5d                	pop    %r13
+  803e14:	41 5e                	pop    %r14
+  803e16:	41 5f                	pop    %r15
+  803e18:	5d                   	pop    %rbp
+  803e19:	c3                   	ret
+
+0000000000803e1a <open>:
+open(const char *path, int mode) {
+  803e1a:	55                   	push   %rbp
+  803e1b:	48 89 e5             	mov    %rsp,%rbp
+  803e1e:	41 55                	push   %r13
+  803e20:	41 54                	push   %r12
+  803e22:	53                   	push   %rbx
+  803e23:	48 83 ec 18          	sub    $0x18,%rsp
+  803e27:	49 89 fc             	mov    %rdi,%r12
+  803e2a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803e2d:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  803e34:	00 00 00 
+  803e37:	ff d0                	call   *%rax
+  803e39:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803e3f:	0f 87 8f 00 00 00    	ja     803ed4 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803e45:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e49:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  803e50:	00 00 00 
+  803e53:	ff d0                	call   *%rax
+  803e55:	89 c3                	mov    %eax,%ebx
+  803e57:	85 c0                	test   %eax,%eax
+  803e59:	78 55                	js     803eb0 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803e5b:	4c 89 e6             	mov    %r12,%rsi
+  803e5e:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803e65:	00 00 00 
+  803e68:	48 89 df             	mov    %rbx,%rdi
+  803e6b:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  803e72:	00 00 00 
+  803e75:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803e77:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e83:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e87:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e8c:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  803e93:	00 00 00 
+  803e96:	ff d0                	call   *%rax
+  803e98:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803e9a:	85 c0                	test   %eax,%eax
+  803e9c:	78 1f                	js     803ebd <open+0xa3>
+    return fd2num(fd);
+  803e9e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ea2:	48 b8 11 32 80 00 00 	movabs $0x803211,%rax
+  803ea9:	00 00 00 
+  803eac:	ff d0                	call   *%rax
+  803eae:	89 c3                	mov    %eax,%ebx
+}
+  803eb0:	89 d8                	mov    %ebx,%eax
+  803eb2:	48 83 c4 18          	add    $0x18,%rsp
+  803eb6:	5b                   	pop    %rbx
+  803eb7:	41 5c                	pop    %r12
+  803eb9:	41 5d                	pop    %r13
+  803ebb:	5d                   	pop    %rbp
+  803ebc:	c3                   	ret
+        fd_close(fd, 0);
+  803ebd:	be 00 00 00 00       	mov    $0x0,%esi
+  803ec2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ec6:	48 b8 5a 33 80 00 00 	movabs $0x80335a,%rax
+  803ecd:	00 00 00 
+  803ed0:	ff d0                	call   *%rax
+        return res;
+  803ed2:	eb dc                	jmp    803eb0 <open+0x96>
+        return -E_BAD_PATH;
+  803ed4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803ed9:	eb d5                	jmp    803eb0 <open+0x96>
+
+0000000000803edb <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803edb:	55                   	push   %rbp
+  803edc:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ee4:	be 00 00 00 00       	mov    $0x0,%esi
+  803ee9:	bf 08 00 00 00       	mov    $0x8,%edi
+  803eee:	48 b8 88 39 80 00 00 	movabs $0x803988,%rax
+  803ef5:	00 00 00 
+  803ef8:	ff d0                	call   *%rax
+}
+  803efa:	5d                   	pop    %rbp
+  803efb:	c3                   	ret
+
+0000000000803efc <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803efc:	55                   	push   %rbp
+  803efd:	48 89 e5             	mov    %rsp,%rbp
+  803f00:	41 56                	push   %r14
+  803f02:	41 55                	push   %r13
+  803f04:	41 54                	push   %r12
+  803f06:	53                   	push   %rbx
+  803f07:	48 83 ec 10          	sub    $0x10,%rsp
+  803f0b:	41 89 f6             	mov    %esi,%r14d
+  803f0e:	49 89 d4             	mov    %rdx,%r12
+  803f11:	48 89 cb             	mov    %rcx,%rbx
+  803f14:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803f17:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f1b:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  803f22:	00 00 00 
+  803f25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f27:	85 c0                	test   %eax,%eax
+  803f29:	78 46                	js     803f71 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803f2b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f2f:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803f36:	00 00 00 
+  803f39:	8b 00                	mov    (%rax),%eax
+  803f3b:	39 02                	cmp    %eax,(%rdx)
+  803f3d:	75 3f                	jne    803f7e <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803f3f:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803f46:	00 00 00 
+  803f49:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803f4c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803f4e:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803f52:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803f56:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803f5a:	48 89 da             	mov    %rbx,%rdx
+  803f5d:	4c 89 e6             	mov    %r12,%rsi
+  803f60:	bf 09 00 00 00       	mov    $0x9,%edi
+  803f65:	48 b8 83 3a 80 00 00 	movabs $0x803a83,%rax
+  803f6c:	00 00 00 
+  803f6f:	ff d0                	call   *%rax
+}
+  803f71:	48 83 c4 10          	add    $0x10,%rsp
+  803f75:	5b                   	pop    %rbx
+  803f76:	41 5c                	pop    %r12
+  803f78:	41 5d                	pop    %r13
+  803f7a:	41 5e                	pop    %r14
+  803f7c:	5d                   	pop    %rbp
+  803f7d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803f7e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803f83:	eb ec                	jmp    803f71 <file_map+0x75>
+
+0000000000803f85 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803f85:	55                   	push   %rbp
+  803f86:	48 89 e5             	mov    %rsp,%rbp
+  803f89:	41 54                	push   %r12
+  803f8b:	53                   	push   %rbx
+  803f8c:	48 83 ec 20          	sub    $0x20,%rsp
+  803f90:	41 89 f4             	mov    %esi,%r12d
+  803f93:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803f96:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803f9a:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  803fa1:	00 00 00 
+  803fa4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fa6:	85 c0                	test   %eax,%eax
+  803fa8:	78 3c                	js     803fe6 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803faa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fae:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803fb5:	00 00 00 
+  803fb8:	8b 0a                	mov    (%rdx),%ecx
+  803fba:	39 08                	cmp    %ecx,(%rax)
+  803fbc:	75 31                	jne    803fef <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803fbe:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fc1:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803fc4:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803fc8:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803fcc:	ba 10 00 00 00       	mov    $0x10,%edx
+  803fd1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803fd5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803fda:	48 b8 88 39 80 00 00 	movabs $0x803988,%rax
+  803fe1:	00 00 00 
+  803fe4:	ff d0                	call   *%rax
+}
+  803fe6:	48 83 c4 20          	add    $0x20,%rsp
+  803fea:	5b                   	pop    %rbx
+  803feb:	41 5c                	pop    %r12
+  803fed:	5d                   	pop    %rbp
+  803fee:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ff4:	eb f0                	jmp    803fe6 <file_msync+0x61>
+
+0000000000803ff6 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803ff6:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803ffa:	7f 01                	jg     803ffd <writebuf+0x7>
+  803ffc:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803ffd:	55                   	push   %rbp
+  803ffe:	48 89 e5             	mov    %rsp,%rbp
+  804001:	53                   	push   %rbx
+  804002:	48 83 ec 08          	sub    $0x8,%rsp
+  804006:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804009:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80400d:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804011:	8b 3f                	mov    (%rdi),%edi
+  804013:	48 b8 b1 36 80 00 00 	movabs $0x8036b1,%rax
+  80401a:	00 00 00 
+  80401d:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80401f:	48 85 c0             	test   %rax,%rax
+  804022:	7e 04                	jle    804028 <writebuf+0x32>
+  804024:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804028:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80402c:	48 39 c2             	cmp    %rax,%rdx
+  80402f:	74 0f                	je     804040 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804031:	48 85 c0             	test   %rax,%rax
+  804034:	ba 00 00 00 00       	mov    $0x0,%edx
+  804039:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80403d:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804040:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804044:	c9                   	leave
+  804045:	c3                   	ret
+
+0000000000804046 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804046:	8b 46 04             	mov    0x4(%rsi),%eax
+  804049:	8d 50 01             	lea    0x1(%rax),%edx
+  80404c:	89 56 04             	mov    %edx,0x4(%rsi)
+  80404f:	48 98                	cltq
+  804051:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804056:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80405c:	74 01                	je     80405f <putch+0x19>
+  80405e:	c3                   	ret
+putch(int ch, void *arg) {
+  80405f:	55                   	push   %rbp
+  804060:	48 89 e5             	mov    %rsp,%rbp
+  804063:	53                   	push   %rbx
+  804064:	48 83 ec 08          	sub    $0x8,%rsp
+  804068:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80406b:	48 89 f7             	mov    %rsi,%rdi
+  80406e:	48 b8 f6 3f 80 00 00 	movabs $0x803ff6,%rax
+  804075:	00 00 00 
+  804078:	ff d0                	call   *%rax
+        state->offset = 0;
+  80407a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804081:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804085:	c9                   	leave
+  804086:	c3                   	ret
+
+0000000000804087 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804087:	55                   	push   %rbp
+  804088:	48 89 e5             	mov    %rsp,%rbp
+  80408b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804092:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804095:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80409b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8040a2:	00 00 00 
+    state.result = 0;
+  8040a5:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8040ac:	00 00 00 00 
+    state.error = 1;
+  8040b0:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8040b7:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8040ba:	48 89 f2             	mov    %rsi,%rdx
+  8040bd:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8040c4:	48 bf 46 40 80 00 00 	movabs $0x804046,%rdi
+  8040cb:	00 00 00 
+  8040ce:	48 b8 55 19 80 00 00 	movabs $0x801955,%rax
+  8040d5:	00 00 00 
+  8040d8:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8040da:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8040e1:	7f 14                	jg     8040f7 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8040e3:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8040ea:	48 85 c0             	test   %rax,%rax
+  8040ed:	75 06                	jne    8040f5 <vfprintf+0x6e>
+  8040ef:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8040f5:	c9                   	leave
+  8040f6:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8040f7:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8040fe:	48 b8 f6 3f 80 00 00 	movabs $0x803ff6,%rax
+  804105:	00 00 00 
+  804108:	ff d0                	call   *%rax
+  80410a:	eb d7                	jmp    8040e3 <vfprintf+0x5c>
+
+000000000080410c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80410c:	55                   	push   %rbp
+  80410d:	48 89 e5             	mov    %rsp,%rbp
+  804110:	48 83 ec 50          	sub    $0x50,%rsp
+  804114:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804118:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80411c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804120:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804124:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80412b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80412f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804133:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804137:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80413b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80413f:	48 b8 87 40 80 00 00 	movabs $0x804087,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80414b:	c9                   	leave
+  80414c:	c3                   	ret
+
+000000000080414d <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80414d:	55                   	push   %rbp
+  80414e:	48 89 e5             	mov    %rsp,%rbp
+  804151:	48 83 ec 50          	sub    $0x50,%rsp
+  804155:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804159:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80415d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804161:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804165:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804169:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804170:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804174:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804178:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80417c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804180:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804184:	48 89 fe             	mov    %rdi,%rsi
+  804187:	bf 01 00 00 00       	mov    $0x1,%edi
+  80418c:	48 b8 87 40 80 00 00 	movabs $0x804087,%rax
+  804193:	00 00 00 
+  804196:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804198:	c9                   	leave
+  804199:	c3                   	ret
+
+000000000080419a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80419a:	55                   	push   %rbp
+  80419b:	48 89 e5             	mov    %rsp,%rbp
+  80419e:	41 54                	push   %r12
+  8041a0:	53                   	push   %rbx
+  8041a1:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8041a4:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  8041ab:	00 00 00 
+  8041ae:	ff d0                	call   *%rax
+  8041b0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8041b3:	48 be 60 64 80 00 00 	movabs $0x806460,%rsi
+  8041ba:	00 00 00 
+  8041bd:	48 89 df             	mov    %rbx,%rdi
+  8041c0:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  8041c7:	00 00 00 
+  8041ca:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8041cc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8041d1:	41 2b 04 24          	sub    (%r12),%eax
+  8041d5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8041db:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8041e2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8041e5:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8041ec:	00 00 00 
+  8041ef:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8041f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041fb:	5b                   	pop    %rbx
+  8041fc:	41 5c                	pop    %r12
+  8041fe:	5d                   	pop    %rbp
+  8041ff:	c3                   	ret
+
+0000000000804200 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804200:	55                   	push   %rbp
+  804201:	48 89 e5             	mov    %rsp,%rbp
+  804204:	41 54                	push   %r12
+  804206:	53                   	push   %rbx
+  804207:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80420a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80420f:	48 89 fe             	mov    %rdi,%rsi
+  804212:	bf 00 00 00 00       	mov    $0x0,%edi
+  804217:	49 bc 79 29 80 00 00 	movabs $0x802979,%r12
+  80421e:	00 00 00 
+  804221:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804224:	48 89 df             	mov    %rbx,%rdi
+  804227:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  80422e:	00 00 00 
+  804231:	ff d0                	call   *%rax
+  804233:	48 89 c6             	mov    %rax,%rsi
+  804236:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80423b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804240:	41 ff d4             	call   *%r12
+}
+  804243:	5b                   	pop    %rbx
+  804244:	41 5c                	pop    %r12
+  804246:	5d                   	pop    %rbp
+  804247:	c3                   	ret
+
+0000000000804248 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804248:	55                   	push   %rbp
+  804249:	48 89 e5             	mov    %rsp,%rbp
+  80424c:	41 57                	push   %r15
+  80424e:	41 56                	push   %r14
+  804250:	41 55                	push   %r13
+  804252:	41 54                	push   %r12
+  804254:	53                   	push   %rbx
+  804255:	48 83 ec 18          	sub    $0x18,%rsp
+  804259:	49 89 fc             	mov    %rdi,%r12
+  80425c:	49 89 f5             	mov    %rsi,%r13
+  80425f:	49 89 d7             	mov    %rdx,%r15
+  804262:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804266:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804272:	4d 85 ff             	test   %r15,%r15
+  804275:	0f 84 af 00 00 00    	je     80432a <devpipe_write+0xe2>
+  80427b:	48 89 c3             	mov    %rax,%rbx
+  80427e:	4c 89 f8             	mov    %r15,%rax
+  804281:	4d 89 ef             	mov    %r13,%r15
+  804284:	4c 01 e8             	add    %r13,%rax
+  804287:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80428b:	49 bd 6f 28 80 00 00 	movabs $0x80286f,%r13
+  804292:	00 00 00 
+            sys_yield();
+  804295:	49 be 00 28 80 00 00 	movabs $0x802800,%r14
+  80429c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80429f:	8b 73 04             	mov    0x4(%rbx),%esi
+  8042a2:	48 63 ce             	movslq %esi,%rcx
+  8042a5:	48 63 03             	movslq (%rbx),%rax
+  8042a8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8042ae:	48 39 c1             	cmp    %rax,%rcx
+  8042b1:	72 2e                	jb     8042e1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8042b3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8042b8:	48 89 da             	mov    %rbx,%rdx
+  8042bb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042c0:	4c 89 e7             	mov    %r12,%rdi
+  8042c3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8042c6:	85 c0                	test   %eax,%eax
+  8042c8:	74 66                	je     804330 <devpipe_write+0xe8>
+            sys_yield();
+  8042ca:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8042cd:	8b 73 04             	mov    0x4(%rbx),%esi
+  8042d0:	48 63 ce             	movslq %esi,%rcx
+  8042d3:	48 63 03             	movslq (%rbx),%rax
+  8042d6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8042dc:	48 39 c1             	cmp    %rax,%rcx
+  8042df:	73 d2                	jae    8042b3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8042e1:	41 0f b6 3f          	movzbl (%r15),%edi
+  8042e5:	48 89 ca             	mov    %rcx,%rdx
+  8042e8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8042ec:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8042f3:	08 10 20 
+  8042f6:	48 f7 e2             	mul    %rdx
+  8042f9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8042fd:	48 89 d0             	mov    %rdx,%rax
+  804300:	48 c1 e0 09          	shl    $0x9,%rax
+  804304:	48 29 d0             	sub    %rdx,%rax
+  804307:	48 c1 e0 03          	shl    $0x3,%rax
+  80430b:	48 29 c1             	sub    %rax,%rcx
+  80430e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804313:	83 c6 01             	add    $0x1,%esi
+  804316:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804319:	49 83 c7 01          	add    $0x1,%r15
+  80431d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804321:	49 39 c7             	cmp    %rax,%r15
+  804324:	0f 85 75 ff ff ff    	jne    80429f <devpipe_write+0x57>
+    return n;
+  80432a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80432e:	eb 05                	jmp    804335 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804330:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804335:	48 83 c4 18          	add    $0x18,%rsp
+  804339:	5b                   	pop    %rbx
+  80433a:	41 5c                	pop    %r12
+  80433c:	41 5d                	pop    %r13
+  80433e:	41 5e                	pop    %r14
+  804340:	41 5f                	pop    %r15
+  804342:	5d                   	pop    %rbp
+  804343:	c3                   	ret
+
+0000000000804344 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804344:	55                   	push   %rbp
+  804345:	48 89 e5             	mov    %rsp,%rbp
+  804348:	41 57                	push   %r15
+  80434a:	41 56                	push   %r14
+  80434c:	41 55                	push   %r13
+  80434e:	41 54                	push   %r12
+  804350:	53                   	push   %rbx
+  804351:	48 83 ec 18          	sub    $0x18,%rsp
+  804355:	49 89 fc             	mov    %rdi,%r12
+  804358:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80435c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804360:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  804367:	00 00 00 
+  80436a:	ff d0                	call   *%rax
+  80436c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80436f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804375:	49 bd 6f 28 80 00 00 	movabs $0x80286f,%r13
+  80437c:	00 00 00 
+            sys_yield();
+  80437f:	49 be 00 28 80 00 00 	movabs $0x802800,%r14
+  804386:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804389:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80438e:	74 7d                	je     80440d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804390:	8b 03                	mov    (%rbx),%eax
+  804392:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804395:	75 26                	jne    8043bd <devpipe_read+0x79>
+            if (i > 0) return i;
+  804397:	4d 85 ff             	test   %r15,%r15
+  80439a:	75 77                	jne    804413 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80439c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043a1:	48 89 da             	mov    %rbx,%rdx
+  8043a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043a9:	4c 89 e7             	mov    %r12,%rdi
+  8043ac:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8043af:	85 c0                	test   %eax,%eax
+  8043b1:	74 72                	je     804425 <devpipe_read+0xe1>
+            sys_yield();
+  8043b3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8043b6:	8b 03                	mov    (%rbx),%eax
+  8043b8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8043bb:	74 df                	je     80439c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8043bd:	48 63 c8             	movslq %eax,%rcx
+  8043c0:	48 89 ca             	mov    %rcx,%rdx
+  8043c3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8043c7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8043ce:	08 10 20 
+  8043d1:	48 89 d0             	mov    %rdx,%rax
+  8043d4:	48 f7 e6             	mul    %rsi
+  8043d7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8043db:	48 89 d0             	mov    %rdx,%rax
+  8043de:	48 c1 e0 09          	shl    $0x9,%rax
+  8043e2:	48 29 d0             	sub    %rdx,%rax
+  8043e5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8043ec:	00 
+  8043ed:	48 89 c8             	mov    %rcx,%rax
+  8043f0:	48 29 d0             	sub    %rdx,%rax
+  8043f3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8043f8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8043fc:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804400:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804403:	49 83 c7 01          	add    $0x1,%r15
+  804407:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80440b:	75 83                	jne    804390 <devpipe_read+0x4c>
+    return n;
+  80440d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804411:	eb 03                	jmp    804416 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804413:	4c 89 f8             	mov    %r15,%rax
+}
+  804416:	48 83 c4 18          	add    $0x18,%rsp
+  80441a:	5b                   	pop    %rbx
+  80441b:	41 5c                	pop    %r12
+  80441d:	41 5d                	pop    %r13
+  80441f:	41 5e                	pop    %r14
+  804421:	41 5f                	pop    %r15
+  804423:	5d                   	pop    %rbp
+  804424:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80442a:	eb ea                	jmp    804416 <devpipe_read+0xd2>
+
+000000000080442c <pipe>:
+pipe(int pfd[2]) {
+  80442c:	55                   	push   %rbp
+  80442d:	48 89 e5             	mov    %rsp,%rbp
+  804430:	41 55                	push   %r13
+  804432:	41 54                	push   %r12
+  804434:	53                   	push   %rbx
+  804435:	48 83 ec 18          	sub    $0x18,%rsp
+  804439:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80443c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804440:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  804447:	00 00 00 
+  80444a:	ff d0                	call   *%rax
+  80444c:	89 c3                	mov    %eax,%ebx
+  80444e:	85 c0                	test   %eax,%eax
+  804450:	0f 88 a0 01 00 00    	js     8045f6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804456:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80445b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804460:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804464:	bf 00 00 00 00       	mov    $0x0,%edi
+  804469:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  804470:	00 00 00 
+  804473:	ff d0                	call   *%rax
+  804475:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804477:	85 c0                	test   %eax,%eax
+  804479:	0f 88 77 01 00 00    	js     8045f6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80447f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804483:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  80448a:	00 00 00 
+  80448d:	ff d0                	call   *%rax
+  80448f:	89 c3                	mov    %eax,%ebx
+  804491:	85 c0                	test   %eax,%eax
+  804493:	0f 88 43 01 00 00    	js     8045dc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804499:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80449e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044a3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8044a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044ac:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  8044b3:	00 00 00 
+  8044b6:	ff d0                	call   *%rax
+  8044b8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8044ba:	85 c0                	test   %eax,%eax
+  8044bc:	0f 88 1a 01 00 00    	js     8045dc <pipe+0x1b0>
+    va = fd2data(fd0);
+  8044c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8044c6:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  8044cd:	00 00 00 
+  8044d0:	ff d0                	call   *%rax
+  8044d2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8044d5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044df:	48 89 c6             	mov    %rax,%rsi
+  8044e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044e7:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  8044ee:	00 00 00 
+  8044f1:	ff d0                	call   *%rax
+  8044f3:	89 c3                	mov    %eax,%ebx
+  8044f5:	85 c0                	test   %eax,%eax
+  8044f7:	0f 88 c5 00 00 00    	js     8045c2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8044fd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804501:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  804508:	00 00 00 
+  80450b:	ff d0                	call   *%rax
+  80450d:	48 89 c1             	mov    %rax,%rcx
+  804510:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804516:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80451c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804521:	4c 89 ee             	mov    %r13,%rsi
+  804524:	bf 00 00 00 00       	mov    $0x0,%edi
+  804529:	48 b8 0e 29 80 00 00 	movabs $0x80290e,%rax
+  804530:	00 00 00 
+  804533:	ff d0                	call   *%rax
+  804535:	89 c3                	mov    %eax,%ebx
+  804537:	85 c0                	test   %eax,%eax
+  804539:	78 6e                	js     8045a9 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80453b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804540:	4c 89 ef             	mov    %r13,%rdi
+  804543:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  80454a:	00 00 00 
+  80454d:	ff d0                	call   *%rax
+  80454f:	83 f8 02             	cmp    $0x2,%eax
+  804552:	0f 85 ab 00 00 00    	jne    804603 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804558:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80455f:	00 00 
+  804561:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804565:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804567:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80456b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804572:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804576:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804578:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80457c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804583:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804587:	48 bb 11 32 80 00 00 	movabs $0x803211,%rbx
+  80458e:	00 00 00 
+  804591:	ff d3                	call   *%rbx
+  804593:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804597:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80459b:	ff d3                	call   *%rbx
+  80459d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8045a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045a7:	eb 4d                	jmp    8045f6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8045a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045ae:	4c 89 ee             	mov    %r13,%rsi
+  8045b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045b6:	48 b8 79 29 80 00 00 	movabs $0x802979,%rax
+  8045bd:	00 00 00 
+  8045c0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8045c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045c7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8045cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045d0:	48 b8 79 29 80 00 00 	movabs $0x802979,%rax
+  8045d7:	00 00 00 
+  8045da:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8045dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045e1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8045e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ea:	48 b8 79 29 80 00 00 	movabs $0x802979,%rax
+  8045f1:	00 00 00 
+  8045f4:	ff d0                	call   *%rax
+}
+  8045f6:	89 d8                	mov    %ebx,%eax
+  8045f8:	48 83 c4 18          	add    $0x18,%rsp
+  8045fc:	5b                   	pop    %rbx
+  8045fd:	41 5c                	pop    %r12
+  8045ff:	41 5d                	pop    %r13
+  804601:	5d                   	pop    %rbp
+  804602:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804603:	48 b9 78 64 80 00 00 	movabs $0x806478,%rcx
+  80460a:	00 00 00 
+  80460d:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  804614:	00 00 00 
+  804617:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80461c:	48 bf 67 64 80 00 00 	movabs $0x806467,%rdi
+  804623:	00 00 00 
+  804626:	b8 00 00 00 00       	mov    $0x0,%eax
+  80462b:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  804632:	00 00 00 
+  804635:	41 ff d0             	call   *%r8
+
+0000000000804638 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804638:	55                   	push   %rbp
+  804639:	48 89 e5             	mov    %rsp,%rbp
+  80463c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804640:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804644:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  80464b:	00 00 00 
+  80464e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804650:	85 c0                	test   %eax,%eax
+  804652:	78 35                	js     804689 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804654:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804658:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  80465f:	00 00 00 
+  804662:	ff d0                	call   *%rax
+  804664:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804667:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80466c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804671:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804675:	48 b8 6f 28 80 00 00 	movabs $0x80286f,%rax
+  80467c:	00 00 00 
+  80467f:	ff d0                	call   *%rax
+  804681:	85 c0                	test   %eax,%eax
+  804683:	0f 94 c0             	sete   %al
+  804686:	0f b6 c0             	movzbl %al,%eax
+}
+  804689:	c9                   	leave
+  80468a:	c3                   	ret
+
+000000000080468b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80468b:	48 89 f8             	mov    %rdi,%rax
+  80468e:	48 c1 e8 27          	shr    $0x27,%rax
+  804692:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804699:	01 00 00 
+  80469c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046a0:	f6 c2 01             	test   $0x1,%dl
+  8046a3:	74 6d                	je     804712 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8046a5:	48 89 f8             	mov    %rdi,%rax
+  8046a8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8046ac:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8046b3:	01 00 00 
+  8046b6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046ba:	f6 c2 01             	test   $0x1,%dl
+  8046bd:	74 62                	je     804721 <get_uvpt_entry+0x96>
+  8046bf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8046c6:	01 00 00 
+  8046c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046cd:	f6 c2 80             	test   $0x80,%dl
+  8046d0:	75 4f                	jne    804721 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8046d2:	48 89 f8             	mov    %rdi,%rax
+  8046d5:	48 c1 e8 15          	shr    $0x15,%rax
+  8046d9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8046e0:	01 00 00 
+  8046e3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046e7:	f6 c2 01             	test   $0x1,%dl
+  8046ea:	74 44                	je     804730 <get_uvpt_entry+0xa5>
+  8046ec:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8046f3:	01 00 00 
+  8046f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046fa:	f6 c2 80             	test   $0x80,%dl
+  8046fd:	75 31                	jne    804730 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8046ff:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804703:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80470a:	01 00 00 
+  80470d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804711:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804712:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804719:	01 00 00 
+  80471c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804720:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804721:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804728:	01 00 00 
+  80472b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80472f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804730:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804737:	01 00 00 
+  80473a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80473e:	c3                   	ret
+
+000000000080473f <get_prot>:
+
+int
+get_prot(void *va) {
+  80473f:	55                   	push   %rbp
+  804740:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804743:	48 b8 8b 46 80 00 00 	movabs $0x80468b,%rax
+  80474a:	00 00 00 
+  80474d:	ff d0                	call   *%rax
+  80474f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804752:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804757:	89 c1                	mov    %eax,%ecx
+  804759:	83 c9 04             	or     $0x4,%ecx
+  80475c:	f6 c2 01             	test   $0x1,%dl
+  80475f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804762:	89 c1                	mov    %eax,%ecx
+  804764:	83 c9 02             	or     $0x2,%ecx
+  804767:	f6 c2 02             	test   $0x2,%dl
+  80476a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80476d:	89 c1                	mov    %eax,%ecx
+  80476f:	83 c9 01             	or     $0x1,%ecx
+  804772:	48 85 d2             	test   %rdx,%rdx
+  804775:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804778:	89 c1                	mov    %eax,%ecx
+  80477a:	83 c9 40             	or     $0x40,%ecx
+  80477d:	f6 c6 04             	test   $0x4,%dh
+  804780:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804783:	5d                   	pop    %rbp
+  804784:	c3                   	ret
+
+0000000000804785 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804785:	55                   	push   %rbp
+  804786:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804789:	48 b8 8b 46 80 00 00 	movabs $0x80468b,%rax
+  804790:	00 00 00 
+  804793:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804795:	48 c1 e8 06          	shr    $0x6,%rax
+  804799:	83 e0 01             	and    $0x1,%eax
+}
+  80479c:	5d                   	pop    %rbp
+  80479d:	c3                   	ret
+
+000000000080479e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80479e:	55                   	push   %rbp
+  80479f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8047a2:	48 b8 8b 46 80 00 00 	movabs $0x80468b,%rax
+  8047a9:	00 00 00 
+  8047ac:	ff d0                	call   *%rax
+  8047ae:	83 e0 01             	and    $0x1,%eax
+}
+  8047b1:	5d                   	pop    %rbp
+  8047b2:	c3                   	ret
+
+00000000008047b3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8047b3:	55                   	push   %rbp
+  8047b4:	48 89 e5             	mov    %rsp,%rbp
+  8047b7:	41 57                	push   %r15
+  8047b9:	41 56                	push   %r14
+  8047bb:	41 55                	push   %r13
+  8047bd:	41 54                	push   %r12
+  8047bf:	53                   	push   %rbx
+  8047c0:	48 83 ec 28          	sub    $0x28,%rsp
+  8047c4:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8047c8:	48 85 ff             	test   %rdi,%rdi
+  8047cb:	74 1e                	je     8047eb <foreach_shared_region+0x38>
+  8047cd:	49 89 ff             	mov    %rdi,%r15
+  8047d0:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8047d6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8047dc:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8047e3:	01 00 00 
+  8047e6:	e9 72 02 00 00       	jmp    804a5d <foreach_shared_region+0x2aa>
+    assert(fun);
+  8047eb:	48 b9 9c 64 80 00 00 	movabs $0x80649c,%rcx
+  8047f2:	00 00 00 
+  8047f5:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  8047fc:	00 00 00 
+  8047ff:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804804:	48 bf a0 64 80 00 00 	movabs $0x8064a0,%rdi
+  80480b:	00 00 00 
+  80480e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804813:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  80481a:	00 00 00 
+  80481d:	41 ff d0             	call   *%r8
+  804820:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804827:	eb 6c                	jmp    804895 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804829:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804830:	ff ff ff 
+  804833:	4c 21 e2             	and    %r12,%rdx
+  804836:	48 89 d8             	mov    %rbx,%rax
+  804839:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80483e:	48 83 c0 01          	add    $0x1,%rax
+  804842:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804846:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80484d:	00 00 00 
+  804850:	48 21 c8             	and    %rcx,%rax
+  804853:	48 09 d0             	or     %rdx,%rax
+  804856:	49 89 c4             	mov    %rax,%r12
+  804859:	eb 30                	jmp    80488b <foreach_shared_region+0xd8>
+  80485b:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804862:	ff ff ff 
+  804865:	4c 21 e2             	and    %r12,%rdx
+  804868:	48 89 d8             	mov    %rbx,%rax
+  80486b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804870:	48 83 c0 01          	add    $0x1,%rax
+  804874:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804878:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80487f:	00 00 00 
+  804882:	48 21 c8             	and    %rcx,%rax
+  804885:	48 09 d0             	or     %rdx,%rax
+  804888:	49 89 c4             	mov    %rax,%r12
+  80488b:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80488f:	0f 84 99 01 00 00    	je     804a2e <foreach_shared_region+0x27b>
+  804895:	4c 89 e3             	mov    %r12,%rbx
+  804898:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80489c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8048a3:	01 00 00 
+  8048a6:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8048aa:	a8 01                	test   $0x1,%al
+  8048ac:	0f 84 77 ff ff ff    	je     804829 <foreach_shared_region+0x76>
+  8048b2:	a8 80                	test   $0x80,%al
+  8048b4:	74 19                	je     8048cf <foreach_shared_region+0x11c>
+  8048b6:	f6 c4 04             	test   $0x4,%ah
+  8048b9:	74 a0                	je     80485b <foreach_shared_region+0xa8>
+  8048bb:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8048c2:	40 
+  8048c3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048c7:	4c 89 e7             	mov    %r12,%rdi
+  8048ca:	41 ff d7             	call   *%r15
+  8048cd:	eb 8c                	jmp    80485b <foreach_shared_region+0xa8>
+  8048cf:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8048d6:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8048da:	eb 46                	jmp    804922 <foreach_shared_region+0x16f>
+  8048dc:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8048e3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8048e9:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8048ed:	48 c1 e0 15          	shl    $0x15,%rax
+  8048f1:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8048f6:	49 09 c4             	or     %rax,%r12
+  8048f9:	eb 1d                	jmp    804918 <foreach_shared_region+0x165>
+  8048fb:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804902:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804908:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80490c:	48 c1 e0 15          	shl    $0x15,%rax
+  804910:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804915:	49 09 c4             	or     %rax,%r12
+  804918:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80491c:	0f 84 d3 00 00 00    	je     8049f5 <foreach_shared_region+0x242>
+  804922:	4c 89 e3             	mov    %r12,%rbx
+  804925:	48 c1 eb 15          	shr    $0x15,%rbx
+  804929:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804930:	01 00 00 
+  804933:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804937:	a8 01                	test   $0x1,%al
+  804939:	74 a1                	je     8048dc <foreach_shared_region+0x129>
+  80493b:	a8 80                	test   $0x80,%al
+  80493d:	74 19                	je     804958 <foreach_shared_region+0x1a5>
+  80493f:	f6 c4 04             	test   $0x4,%ah
+  804942:	74 b7                	je     8048fb <foreach_shared_region+0x148>
+  804944:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80494b:	00 
+  80494c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804950:	4c 89 e7             	mov    %r12,%rdi
+  804953:	41 ff d7             	call   *%r15
+  804956:	eb a3                	jmp    8048fb <foreach_shared_region+0x148>
+  804958:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80495e:	eb 3b                	jmp    80499b <foreach_shared_region+0x1e8>
+  804960:	f6 c4 04             	test   $0x4,%ah
+  804963:	74 12                	je     804977 <foreach_shared_region+0x1c4>
+  804965:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80496c:	00 
+  80496d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804971:	4c 89 e7             	mov    %r12,%rdi
+  804974:	41 ff d7             	call   *%r15
+  804977:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80497e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804984:	48 83 c3 01          	add    $0x1,%rbx
+  804988:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80498c:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804992:	49 09 dc             	or     %rbx,%r12
+  804995:	41 83 ed 01          	sub    $0x1,%r13d
+  804999:	74 2f                	je     8049ca <foreach_shared_region+0x217>
+  80499b:	4c 89 e3             	mov    %r12,%rbx
+  80499e:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8049a2:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8049a6:	a8 01                	test   $0x1,%al
+  8049a8:	75 b6                	jne    804960 <foreach_shared_region+0x1ad>
+  8049aa:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8049b1:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049b7:	48 83 c3 01          	add    $0x1,%rbx
+  8049bb:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8049bf:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8049c5:	49 09 dc             	or     %rbx,%r12
+  8049c8:	eb cb                	jmp    804995 <foreach_shared_region+0x1e2>
+  8049ca:	4c 89 e0             	mov    %r12,%rax
+  8049cd:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8049d3:	49 c1 ec 15          	shr    $0x15,%r12
+  8049d7:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8049de:	49 83 c4 01          	add    $0x1,%r12
+  8049e2:	49 c1 e4 15          	shl    $0x15,%r12
+  8049e6:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8049ed:	49 09 c4             	or     %rax,%r12
+  8049f0:	e9 23 ff ff ff       	jmp    804918 <foreach_shared_region+0x165>
+  8049f5:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8049f9:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804a00:	ff ff ff 
+  804a03:	4c 21 e0             	and    %r12,%rax
+  804a06:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804a0a:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804a11:	49 83 c4 01          	add    $0x1,%r12
+  804a15:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804a19:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804a20:	00 00 00 
+  804a23:	49 21 d4             	and    %rdx,%r12
+  804a26:	49 09 c4             	or     %rax,%r12
+  804a29:	e9 5d fe ff ff       	jmp    80488b <foreach_shared_region+0xd8>
+  804a2e:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804a35:	00 ff ff 
+  804a38:	4c 21 e0             	and    %r12,%rax
+  804a3b:	49 c1 ec 27          	shr    $0x27,%r12
+  804a3f:	49 83 c4 01          	add    $0x1,%r12
+  804a43:	49 c1 e4 27          	shl    $0x27,%r12
+  804a47:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804a4e:	ff 00 00 
+  804a51:	49 21 d4             	and    %rdx,%r12
+  804a54:	49 09 c4             	or     %rax,%r12
+  804a57:	41 83 ed 01          	sub    $0x1,%r13d
+  804a5b:	74 48                	je     804aa5 <foreach_shared_region+0x2f2>
+  804a5d:	4c 89 e0             	mov    %r12,%rax
+  804a60:	48 c1 e8 27          	shr    $0x27,%rax
+  804a64:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804a6b:	01 00 00 
+  804a6e:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804a72:	f6 c2 01             	test   $0x1,%dl
+  804a75:	0f 85 a5 fd ff ff    	jne    804820 <foreach_shared_region+0x6d>
+  804a7b:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804a82:	00 ff ff 
+  804a85:	4c 21 e2             	and    %r12,%rdx
+  804a88:	48 83 c0 01          	add    $0x1,%rax
+  804a8c:	48 c1 e0 27          	shl    $0x27,%rax
+  804a90:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804a97:	ff 00 00 
+  804a9a:	48 21 c8             	and    %rcx,%rax
+  804a9d:	48 09 d0             	or     %rdx,%rax
+  804aa0:	49 89 c4             	mov    %rax,%r12
+  804aa3:	eb b2                	jmp    804a57 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804aa5:	4d 85 e4             	test   %r12,%r12
+  804aa8:	75 14                	jne    804abe <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aaf:	48 83 c4 28          	add    $0x28,%rsp
+  804ab3:	5b                   	pop    %rbx
+  804ab4:	41 5c                	pop    %r12
+  804ab6:	41 5d                	pop    %r13
+  804ab8:	41 5e                	pop    %r14
+  804aba:	41 5f                	pop    %r15
+  804abc:	5d                   	pop    %rbp
+  804abd:	c3                   	ret
+    assert(addr == 0);
+  804abe:	48 b9 ab 64 80 00 00 	movabs $0x8064ab,%rcx
+  804ac5:	00 00 00 
+  804ac8:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  804acf:	00 00 00 
+  804ad2:	be 67 00 00 00       	mov    $0x67,%esi
+  804ad7:	48 bf a0 64 80 00 00 	movabs $0x8064a0,%rdi
+  804ade:	00 00 00 
+  804ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae6:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  804aed:	00 00 00 
+  804af0:	41 ff d0             	call   *%r8
+
+0000000000804af3 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804af3:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804afa:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804afd:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804b03:	eb 33                	jmp    804b38 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804b05:	48 83 c0 20          	add    $0x20,%rax
+  804b09:	4c 39 c0             	cmp    %r8,%rax
+  804b0c:	74 25                	je     804b33 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804b0e:	48 8b 10             	mov    (%rax),%rdx
+  804b11:	48 85 d2             	test   %rdx,%rdx
+  804b14:	74 ef                	je     804b05 <mmap_place+0x12>
+  804b16:	48 89 d1             	mov    %rdx,%rcx
+  804b19:	48 03 48 08          	add    0x8(%rax),%rcx
+  804b1d:	48 39 cf             	cmp    %rcx,%rdi
+  804b20:	73 e3                	jae    804b05 <mmap_place+0x12>
+  804b22:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804b26:	4c 39 ca             	cmp    %r9,%rdx
+  804b29:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804b2d:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804b31:	eb d2                	jmp    804b05 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804b33:	45 84 d2             	test   %r10b,%r10b
+  804b36:	74 12                	je     804b4a <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804b38:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b3f:	00 00 00 
+        moved = 0;
+  804b42:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804b48:	eb c4                	jmp    804b0e <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804b4a:	48 01 fe             	add    %rdi,%rsi
+  804b4d:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804b54:	00 00 00 
+  804b57:	48 39 f0             	cmp    %rsi,%rax
+  804b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b5f:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804b63:	c3                   	ret
+
+0000000000804b64 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804b64:	55                   	push   %rbp
+  804b65:	48 89 e5             	mov    %rsp,%rbp
+  804b68:	41 57                	push   %r15
+  804b6a:	41 56                	push   %r14
+  804b6c:	41 55                	push   %r13
+  804b6e:	41 54                	push   %r12
+  804b70:	53                   	push   %rbx
+  804b71:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804b75:	48 8b 1f             	mov    (%rdi),%rbx
+  804b78:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804b7f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b86:	00 00 00 
+  804b89:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b8e:	eb 12                	jmp    804ba2 <mmap_pgfault+0x3e>
+  804b90:	48 83 c2 01          	add    $0x1,%rdx
+  804b94:	48 83 c0 20          	add    $0x20,%rax
+  804b98:	48 83 fa 20          	cmp    $0x20,%rdx
+  804b9c:	0f 84 04 01 00 00    	je     804ca6 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804ba2:	48 8b 08             	mov    (%rax),%rcx
+  804ba5:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804ba9:	48 39 de             	cmp    %rbx,%rsi
+  804bac:	73 e2                	jae    804b90 <mmap_pgfault+0x2c>
+  804bae:	48 03 48 08          	add    0x8(%rax),%rcx
+  804bb2:	48 39 cb             	cmp    %rcx,%rbx
+  804bb5:	73 d9                	jae    804b90 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804bb7:	48 c1 e2 05          	shl    $0x5,%rdx
+  804bbb:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bc2:	00 00 00 
+  804bc5:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804bc9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804bcd:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804bd1:	f6 c2 01             	test   $0x1,%dl
+  804bd4:	0f 84 e0 00 00 00    	je     804cba <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bdf:	f6 c2 02             	test   $0x2,%dl
+  804be2:	0f 84 c3 00 00 00    	je     804cab <mmap_pgfault+0x147>
+  804be8:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804bef:	ff ff ff 
+  804bf2:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804bf6:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804bfd:	00 00 00 
+  804c00:	48 39 ca             	cmp    %rcx,%rdx
+  804c03:	0f 85 a2 00 00 00    	jne    804cab <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804c09:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804c0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c13:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804c1a:	00 00 00 
+  804c1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c22:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  804c29:	00 00 00 
+  804c2c:	ff d0                	call   *%rax
+  804c2e:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c35:	85 d2                	test   %edx,%edx
+  804c37:	78 72                	js     804cab <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804c39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c3e:	48 89 de             	mov    %rbx,%rsi
+  804c41:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804c48:	00 00 00 
+  804c4b:	4c 89 e7             	mov    %r12,%rdi
+  804c4e:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  804c55:	00 00 00 
+  804c58:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804c5a:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804c60:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804c66:	48 89 d9             	mov    %rbx,%rcx
+  804c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c6e:	4c 89 e6             	mov    %r12,%rsi
+  804c71:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c76:	48 b8 0e 29 80 00 00 	movabs $0x80290e,%rax
+  804c7d:	00 00 00 
+  804c80:	ff d0                	call   *%rax
+  804c82:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804c84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c89:	4c 89 e6             	mov    %r12,%rsi
+  804c8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c91:	48 b8 79 29 80 00 00 	movabs $0x802979,%rax
+  804c98:	00 00 00 
+  804c9b:	ff d0                	call   *%rax
+    return res >= 0;
+  804c9d:	89 d8                	mov    %ebx,%eax
+  804c9f:	f7 d0                	not    %eax
+  804ca1:	c1 e8 1f             	shr    $0x1f,%eax
+  804ca4:	eb 05                	jmp    804cab <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804cab:	48 83 c4 18          	add    $0x18,%rsp
+  804caf:	5b                   	pop    %rbx
+  804cb0:	41 5c                	pop    %r12
+  804cb2:	41 5d                	pop    %r13
+  804cb4:	41 5e                	pop    %r14
+  804cb6:	41 5f                	pop    %r15
+  804cb8:	5d                   	pop    %rbp
+  804cb9:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804cba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cbe:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804cc2:	4c 03 30             	add    (%rax),%r14
+  804cc5:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804ccc:	49 39 c6             	cmp    %rax,%r14
+  804ccf:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804cd3:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804cda:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ce0:	49 bf 9e 47 80 00 00 	movabs $0x80479e,%r15
+  804ce7:	00 00 00 
+  804cea:	4d 39 f4             	cmp    %r14,%r12
+  804ced:	73 1d                	jae    804d0c <mmap_pgfault+0x1a8>
+  804cef:	4c 89 e7             	mov    %r12,%rdi
+  804cf2:	41 ff d7             	call   *%r15
+  804cf5:	84 c0                	test   %al,%al
+  804cf7:	75 13                	jne    804d0c <mmap_pgfault+0x1a8>
+  804cf9:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804d00:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804d07:	4d 39 f4             	cmp    %r14,%r12
+  804d0a:	72 e3                	jb     804cef <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804d0c:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804d12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d16:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804d1a:	74 2a                	je     804d46 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804d1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d20:	89 de                	mov    %ebx,%esi
+  804d22:	2b 30                	sub    (%rax),%esi
+  804d24:	03 70 1c             	add    0x1c(%rax),%esi
+  804d27:	8b 78 18             	mov    0x18(%rax),%edi
+  804d2a:	4c 89 e9             	mov    %r13,%rcx
+  804d2d:	48 89 da             	mov    %rbx,%rdx
+  804d30:	48 b8 fc 3e 80 00 00 	movabs $0x803efc,%rax
+  804d37:	00 00 00 
+  804d3a:	ff d0                	call   *%rax
+    return res > 0;
+  804d3c:	85 c0                	test   %eax,%eax
+  804d3e:	0f 9f c0             	setg   %al
+  804d41:	e9 65 ff ff ff       	jmp    804cab <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804d46:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804d4a:	eb d0                	jmp    804d1c <mmap_pgfault+0x1b8>
+
+0000000000804d4c <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804d4c:	55                   	push   %rbp
+  804d4d:	48 89 e5             	mov    %rsp,%rbp
+  804d50:	41 57                	push   %r15
+  804d52:	41 56                	push   %r14
+  804d54:	41 55                	push   %r13
+  804d56:	41 54                	push   %r12
+  804d58:	53                   	push   %rbx
+  804d59:	48 83 ec 28          	sub    $0x28,%rsp
+  804d5d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804d61:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804d64:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804d6b:	ff ff ff 
+  804d6e:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d77:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804d7e:	00 00 00 
+  804d81:	48 39 ca             	cmp    %rcx,%rdx
+  804d84:	0f 85 e5 00 00 00    	jne    804e6f <mmap_writeback+0x123>
+  804d8a:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804d8d:	4c 39 ee             	cmp    %r13,%rsi
+  804d90:	0f 83 e8 00 00 00    	jae    804e7e <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804d96:	49 be 9e 47 80 00 00 	movabs $0x80479e,%r14
+  804d9d:	00 00 00 
+  804da0:	49 bf 85 47 80 00 00 	movabs $0x804785,%r15
+  804da7:	00 00 00 
+  804daa:	eb 10                	jmp    804dbc <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804dac:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804db3:	4d 39 ec             	cmp    %r13,%r12
+  804db6:	0f 83 ae 00 00 00    	jae    804e6a <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804dbc:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804dc0:	4c 89 e7             	mov    %r12,%rdi
+  804dc3:	41 ff d6             	call   *%r14
+  804dc6:	84 c0                	test   %al,%al
+  804dc8:	74 e2                	je     804dac <mmap_writeback+0x60>
+  804dca:	4c 89 e7             	mov    %r12,%rdi
+  804dcd:	41 ff d7             	call   *%r15
+  804dd0:	84 c0                	test   %al,%al
+  804dd2:	74 d8                	je     804dac <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804dd4:	4c 89 e3             	mov    %r12,%rbx
+  804dd7:	4d 39 ec             	cmp    %r13,%r12
+  804dda:	73 20                	jae    804dfc <mmap_writeback+0xb0>
+  804ddc:	48 89 df             	mov    %rbx,%rdi
+  804ddf:	41 ff d6             	call   *%r14
+  804de2:	84 c0                	test   %al,%al
+  804de4:	74 16                	je     804dfc <mmap_writeback+0xb0>
+  804de6:	48 89 df             	mov    %rbx,%rdi
+  804de9:	41 ff d7             	call   *%r15
+  804dec:	84 c0                	test   %al,%al
+  804dee:	74 0c                	je     804dfc <mmap_writeback+0xb0>
+  804df0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804df7:	4c 39 eb             	cmp    %r13,%rbx
+  804dfa:	72 e0                	jb     804ddc <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804dfc:	48 89 d9             	mov    %rbx,%rcx
+  804dff:	4c 29 e1             	sub    %r12,%rcx
+  804e02:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e06:	44 89 e6             	mov    %r12d,%esi
+  804e09:	2b 30                	sub    (%rax),%esi
+  804e0b:	49 89 c4             	mov    %rax,%r12
+  804e0e:	03 70 1c             	add    0x1c(%rax),%esi
+  804e11:	8b 78 18             	mov    0x18(%rax),%edi
+  804e14:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804e18:	48 89 ca             	mov    %rcx,%rdx
+  804e1b:	48 b8 85 3f 80 00 00 	movabs $0x803f85,%rax
+  804e22:	00 00 00 
+  804e25:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804e27:	85 c0                	test   %eax,%eax
+  804e29:	78 44                	js     804e6f <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804e2b:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804e30:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804e33:	41 89 c1             	mov    %eax,%r9d
+  804e36:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804e3d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804e41:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e4a:	48 89 ce             	mov    %rcx,%rsi
+  804e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e52:	48 b8 0e 29 80 00 00 	movabs $0x80290e,%rax
+  804e59:	00 00 00 
+  804e5c:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804e5e:	85 c0                	test   %eax,%eax
+  804e60:	78 0d                	js     804e6f <mmap_writeback+0x123>
+  804e62:	49 89 dc             	mov    %rbx,%r12
+  804e65:	e9 49 ff ff ff       	jmp    804db3 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e6f:	48 83 c4 28          	add    $0x28,%rsp
+  804e73:	5b                   	pop    %rbx
+  804e74:	41 5c                	pop    %r12
+  804e76:	41 5d                	pop    %r13
+  804e78:	41 5e                	pop    %r14
+  804e7a:	41 5f                	pop    %r15
+  804e7c:	5d                   	pop    %rbp
+  804e7d:	c3                   	ret
+    return 0;
+  804e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e83:	eb ea                	jmp    804e6f <mmap_writeback+0x123>
+
+0000000000804e85 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804e85:	55                   	push   %rbp
+  804e86:	48 89 e5             	mov    %rsp,%rbp
+  804e89:	41 57                	push   %r15
+  804e8b:	41 56                	push   %r14
+  804e8d:	41 55                	push   %r13
+  804e8f:	41 54                	push   %r12
+  804e91:	53                   	push   %rbx
+  804e92:	48 83 ec 38          	sub    $0x38,%rsp
+  804e96:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804e9a:	48 85 f6             	test   %rsi,%rsi
+  804e9d:	0f 84 0c 02 00 00    	je     8050af <mmap+0x22a>
+  804ea3:	49 89 ff             	mov    %rdi,%r15
+  804ea6:	49 89 f4             	mov    %rsi,%r12
+  804ea9:	41 89 d5             	mov    %edx,%r13d
+  804eac:	41 89 ce             	mov    %ecx,%r14d
+  804eaf:	44 89 cb             	mov    %r9d,%ebx
+  804eb2:	45 85 c9             	test   %r9d,%r9d
+  804eb5:	0f 88 f4 01 00 00    	js     8050af <mmap+0x22a>
+  804ebb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ec2:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804ec9:	0f 85 e7 01 00 00    	jne    8050b6 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804ecf:	83 e2 fd             	and    $0xfffffffd,%edx
+  804ed2:	83 fa 04             	cmp    $0x4,%edx
+  804ed5:	0f 85 db 01 00 00    	jne    8050b6 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804edb:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804ede:	83 fa 01             	cmp    $0x1,%edx
+  804ee1:	0f 87 cf 01 00 00    	ja     8050b6 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804ee7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804eeb:	44 89 c7             	mov    %r8d,%edi
+  804eee:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  804ef5:	00 00 00 
+  804ef8:	ff d0                	call   *%rax
+  804efa:	89 c2                	mov    %eax,%edx
+  804efc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f03:	85 d2                	test   %edx,%edx
+  804f05:	0f 88 ab 01 00 00    	js     8050b6 <mmap+0x231>
+  804f0b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f0f:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804f16:	00 00 00 
+  804f19:	8b 09                	mov    (%rcx),%ecx
+  804f1b:	39 0a                	cmp    %ecx,(%rdx)
+  804f1d:	0f 85 93 01 00 00    	jne    8050b6 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804f23:	8b 52 08             	mov    0x8(%rdx),%edx
+  804f26:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804f29:	83 fa 01             	cmp    $0x1,%edx
+  804f2c:	0f 84 84 01 00 00    	je     8050b6 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804f32:	41 83 fe 01          	cmp    $0x1,%r14d
+  804f36:	74 42                	je     804f7a <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804f38:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804f3f:	4c 89 e6             	mov    %r12,%rsi
+  804f42:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804f49:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804f4d:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804f51:	4d 85 ff             	test   %r15,%r15
+  804f54:	74 67                	je     804fbd <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804f56:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804f5d:	75 0f                	jne    804f6e <mmap+0xe9>
+  804f5f:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804f66:	00 00 00 
+  804f69:	49 39 c7             	cmp    %rax,%r15
+  804f6c:	77 1b                	ja     804f89 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804f6e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f75:	e9 3c 01 00 00       	jmp    8050b6 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804f7a:	41 f6 c5 02          	test   $0x2,%r13b
+  804f7e:	74 b8                	je     804f38 <mmap+0xb3>
+  804f80:	85 d2                	test   %edx,%edx
+  804f82:	75 b4                	jne    804f38 <mmap+0xb3>
+  804f84:	e9 2d 01 00 00       	jmp    8050b6 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804f89:	4c 89 ff             	mov    %r15,%rdi
+  804f8c:	48 b8 f3 4a 80 00 00 	movabs $0x804af3,%rax
+  804f93:	00 00 00 
+  804f96:	ff d0                	call   *%rax
+  804f98:	48 89 c2             	mov    %rax,%rdx
+  804f9b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804fa2:	49 39 d7             	cmp    %rdx,%r15
+  804fa5:	0f 85 0b 01 00 00    	jne    8050b6 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804fab:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804fb2:	00 00 00 
+  804fb5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804fbb:	eb 44                	jmp    805001 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804fbd:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804fc1:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804fc8:	00 00 00 
+  804fcb:	48 b8 f3 4a 80 00 00 	movabs $0x804af3,%rax
+  804fd2:	00 00 00 
+  804fd5:	ff d0                	call   *%rax
+  804fd7:	48 89 c7             	mov    %rax,%rdi
+  804fda:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804fde:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804fe5:	48 85 ff             	test   %rdi,%rdi
+  804fe8:	75 c1                	jne    804fab <mmap+0x126>
+  804fea:	e9 c7 00 00 00       	jmp    8050b6 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804fef:	49 83 c4 01          	add    $0x1,%r12
+  804ff3:	48 83 c0 20          	add    $0x20,%rax
+  804ff7:	49 83 fc 20          	cmp    $0x20,%r12
+  804ffb:	0f 84 a5 00 00 00    	je     8050a6 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805001:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805005:	75 e8                	jne    804fef <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805007:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80500b:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  805012:	00 00 00 
+  805015:	ff d0                	call   *%rax
+  805017:	89 c2                	mov    %eax,%edx
+  805019:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805020:	85 d2                	test   %edx,%edx
+  805022:	0f 88 8e 00 00 00    	js     8050b6 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805028:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80502c:	48 b8 11 32 80 00 00 	movabs $0x803211,%rax
+  805033:	00 00 00 
+  805036:	ff d0                	call   *%rax
+  805038:	89 c6                	mov    %eax,%esi
+  80503a:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80503d:	48 b8 5f 34 80 00 00 	movabs $0x80345f,%rax
+  805044:	00 00 00 
+  805047:	ff d0                	call   *%rax
+  805049:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  80504c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805053:	45 85 ff             	test   %r15d,%r15d
+  805056:	78 5e                	js     8050b6 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805058:	49 c1 e4 05          	shl    $0x5,%r12
+  80505c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805063:	00 00 00 
+  805066:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805069:	48 bf 64 4b 80 00 00 	movabs $0x804b64,%rdi
+  805070:	00 00 00 
+  805073:	48 b8 89 2f 80 00 00 	movabs $0x802f89,%rax
+  80507a:	00 00 00 
+  80507d:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  80507f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805083:	49 89 04 24          	mov    %rax,(%r12)
+  805087:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80508b:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805090:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805095:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80509a:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  80509f:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8050a4:	eb 10                	jmp    8050b6 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8050a6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050ad:	eb 07                	jmp    8050b6 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8050af:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8050b6:	48 83 c4 38          	add    $0x38,%rsp
+  8050ba:	5b                   	pop    %rbx
+  8050bb:	41 5c                	pop    %r12
+  8050bd:	41 5d                	pop    %r13
+  8050bf:	41 5e                	pop    %r14
+  8050c1:	41 5f                	pop    %r15
+  8050c3:	5d                   	pop    %rbp
+  8050c4:	c3                   	ret
+
+00000000008050c5 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8050c5:	55                   	push   %rbp
+  8050c6:	48 89 e5             	mov    %rsp,%rbp
+  8050c9:	41 57                	push   %r15
+  8050cb:	41 56                	push   %r14
+  8050cd:	41 55                	push   %r13
+  8050cf:	41 54                	push   %r12
+  8050d1:	53                   	push   %rbx
+  8050d2:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8050d6:	49 89 fe             	mov    %rdi,%r14
+  8050d9:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8050e0:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8050e7:	00 
+  8050e8:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050ef:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8050f6:	00 00 00 
+  8050f9:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805100:	49 bf 4c 4d 80 00 00 	movabs $0x804d4c,%r15
+  805107:	00 00 00 
+  80510a:	eb 09                	jmp    805115 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80510c:	48 83 c3 20          	add    $0x20,%rbx
+  805110:	4c 39 eb             	cmp    %r13,%rbx
+  805113:	74 33                	je     805148 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805115:	48 89 df             	mov    %rbx,%rdi
+  805118:	48 8b 33             	mov    (%rbx),%rsi
+  80511b:	4c 39 e6             	cmp    %r12,%rsi
+  80511e:	73 ec                	jae    80510c <msync+0x47>
+  805120:	48 85 f6             	test   %rsi,%rsi
+  805123:	74 e7                	je     80510c <msync+0x47>
+  805125:	48 89 f2             	mov    %rsi,%rdx
+  805128:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80512c:	49 39 d6             	cmp    %rdx,%r14
+  80512f:	73 db                	jae    80510c <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805131:	4c 39 e2             	cmp    %r12,%rdx
+  805134:	49 0f 47 d4          	cmova  %r12,%rdx
+  805138:	4c 39 f6             	cmp    %r14,%rsi
+  80513b:	49 0f 42 f6          	cmovb  %r14,%rsi
+  80513f:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805142:	85 c0                	test   %eax,%eax
+  805144:	79 c6                	jns    80510c <msync+0x47>
+  805146:	eb 05                	jmp    80514d <msync+0x88>
+    }
+
+    return 0;
+  805148:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80514d:	48 83 c4 08          	add    $0x8,%rsp
+  805151:	5b                   	pop    %rbx
+  805152:	41 5c                	pop    %r12
+  805154:	41 5d                	pop    %r13
+  805156:	41 5e                	pop    %r14
+  805158:	41 5f                	pop    %r15
+  80515a:	5d                   	pop    %rbp
+  80515b:	c3                   	ret
+
+000000000080515c <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  80515c:	55                   	push   %rbp
+  80515d:	48 89 e5             	mov    %rsp,%rbp
+  805160:	41 57                	push   %r15
+  805162:	41 56                	push   %r14
+  805164:	41 55                	push   %r13
+  805166:	41 54                	push   %r12
+  805168:	53                   	push   %rbx
+  805169:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80516d:	49 89 ff             	mov    %rdi,%r15
+  805170:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805177:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80517e:	00 
+  80517f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805186:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80518d:	00 00 00 
+  805190:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805197:	48 89 d8             	mov    %rbx,%rax
+  80519a:	eb 09                	jmp    8051a5 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80519c:	48 83 c0 20          	add    $0x20,%rax
+  8051a0:	4c 39 f0             	cmp    %r14,%rax
+  8051a3:	74 40                	je     8051e5 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8051a5:	48 8b 10             	mov    (%rax),%rdx
+  8051a8:	4c 39 e2             	cmp    %r12,%rdx
+  8051ab:	73 ef                	jae    80519c <munmap+0x40>
+  8051ad:	48 85 d2             	test   %rdx,%rdx
+  8051b0:	74 ea                	je     80519c <munmap+0x40>
+  8051b2:	48 89 d7             	mov    %rdx,%rdi
+  8051b5:	48 03 78 08          	add    0x8(%rax),%rdi
+  8051b9:	49 39 ff             	cmp    %rdi,%r15
+  8051bc:	73 de                	jae    80519c <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8051be:	49 39 fc             	cmp    %rdi,%r12
+  8051c1:	72 05                	jb     8051c8 <munmap+0x6c>
+  8051c3:	4c 39 fa             	cmp    %r15,%rdx
+  8051c6:	73 d4                	jae    80519c <munmap+0x40>
+  8051c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8051cd:	48 83 c4 08          	add    $0x8,%rsp
+  8051d1:	5b                   	pop    %rbx
+  8051d2:	41 5c                	pop    %r12
+  8051d4:	41 5d                	pop    %r13
+  8051d6:	41 5e                	pop    %r14
+  8051d8:	41 5f                	pop    %r15
+  8051da:	5d                   	pop    %rbp
+  8051db:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051dc:	48 83 c3 20          	add    $0x20,%rbx
+  8051e0:	4c 39 f3             	cmp    %r14,%rbx
+  8051e3:	74 5c                	je     805241 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8051e5:	48 8b 33             	mov    (%rbx),%rsi
+  8051e8:	4c 39 e6             	cmp    %r12,%rsi
+  8051eb:	73 ef                	jae    8051dc <munmap+0x80>
+  8051ed:	48 85 f6             	test   %rsi,%rsi
+  8051f0:	74 ea                	je     8051dc <munmap+0x80>
+  8051f2:	48 89 f2             	mov    %rsi,%rdx
+  8051f5:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8051f9:	49 39 d7             	cmp    %rdx,%r15
+  8051fc:	73 de                	jae    8051dc <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8051fe:	48 89 df             	mov    %rbx,%rdi
+  805201:	48 b8 4c 4d 80 00 00 	movabs $0x804d4c,%rax
+  805208:	00 00 00 
+  80520b:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80520d:	85 c0                	test   %eax,%eax
+  80520f:	78 bc                	js     8051cd <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805211:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805215:	48 8b 33             	mov    (%rbx),%rsi
+  805218:	bf 00 00 00 00       	mov    $0x0,%edi
+  80521d:	48 b8 79 29 80 00 00 	movabs $0x802979,%rax
+  805224:	00 00 00 
+  805227:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805229:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80522c:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  805233:	00 00 00 
+  805236:	ff d0                	call   *%rax
+        reg->start = 0;
+  805238:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80523f:	eb 9b                	jmp    8051dc <munmap+0x80>
+    return 0;
+  805241:	b8 00 00 00 00       	mov    $0x0,%eax
+  805246:	eb 85                	jmp    8051cd <munmap+0x71>
+
+0000000000805248 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80524d:	c3                   	ret
+
+000000000080524e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80524e:	55                   	push   %rbp
+  80524f:	48 89 e5             	mov    %rsp,%rbp
+  805252:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805255:	48 be b5 64 80 00 00 	movabs $0x8064b5,%rsi
+  80525c:	00 00 00 
+  80525f:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  805266:	00 00 00 
+  805269:	ff d0                	call   *%rax
+    return 0;
+}
+  80526b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805270:	5d                   	pop    %rbp
+  805271:	c3                   	ret
+
+0000000000805272 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805272:	55                   	push   %rbp
+  805273:	48 89 e5             	mov    %rsp,%rbp
+  805276:	41 57                	push   %r15
+  805278:	41 56                	push   %r14
+  80527a:	41 55                	push   %r13
+  80527c:	41 54                	push   %r12
+  80527e:	53                   	push   %rbx
+  80527f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805286:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80528d:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805294:	00 00 00 00 
+  805298:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  80529f:	00 00 00 00 
+  8052a3:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8052aa:	00 00 00 00 
+  8052ae:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8052b5:	00 00 00 00 
+  8052b9:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8052c0:	00 00 00 00 
+  8052c4:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8052cb:	00 00 00 00 
+  8052cf:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8052d6:	00 
+  8052d7:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8052de:	00 
+  8052df:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8052e6:	00 
+  8052e7:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8052ee:	00 
+  8052ef:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8052f6:	00 
+  8052f7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8052fe:	00 
+  8052ff:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805306:	00 
+  805307:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80530e:	00 
+  80530f:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805316:	00 
+  805317:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80531e:	00 
+    for (res = 0; res < n; res += inc) {
+  80531f:	48 85 d2             	test   %rdx,%rdx
+  805322:	74 7a                	je     80539e <devcons_write+0x12c>
+  805324:	49 89 d6             	mov    %rdx,%r14
+  805327:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80532d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805332:	49 bf 8c 24 80 00 00 	movabs $0x80248c,%r15
+  805339:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80533c:	4c 89 f3             	mov    %r14,%rbx
+  80533f:	48 29 f3             	sub    %rsi,%rbx
+  805342:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805347:	48 39 c3             	cmp    %rax,%rbx
+  80534a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80534e:	4c 63 eb             	movslq %ebx,%r13
+  805351:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805358:	48 01 c6             	add    %rax,%rsi
+  80535b:	4c 89 ea             	mov    %r13,%rdx
+  80535e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805365:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805368:	4c 89 ee             	mov    %r13,%rsi
+  80536b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805372:	48 b8 b9 26 80 00 00 	movabs $0x8026b9,%rax
+  805379:	00 00 00 
+  80537c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80537e:	41 01 dc             	add    %ebx,%r12d
+  805381:	49 63 f4             	movslq %r12d,%rsi
+  805384:	4c 39 f6             	cmp    %r14,%rsi
+  805387:	72 b3                	jb     80533c <devcons_write+0xca>
+    return res;
+  805389:	49 63 c4             	movslq %r12d,%rax
+}
+  80538c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805393:	5b                   	pop    %rbx
+  805394:	41 5c                	pop    %r12
+  805396:	41 5d                	pop    %r13
+  805398:	41 5e                	pop    %r14
+  80539a:	41 5f                	pop    %r15
+  80539c:	5d                   	pop    %rbp
+  80539d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80539e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8053a4:	eb e3                	jmp    805389 <devcons_write+0x117>
+
+00000000008053a6 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8053a6:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8053a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053ae:	48 85 c0             	test   %rax,%rax
+  8053b1:	74 55                	je     805408 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8053b3:	55                   	push   %rbp
+  8053b4:	48 89 e5             	mov    %rsp,%rbp
+  8053b7:	41 55                	push   %r13
+  8053b9:	41 54                	push   %r12
+  8053bb:	53                   	push   %rbx
+  8053bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8053c0:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8053c3:	48 bb ec 26 80 00 00 	movabs $0x8026ec,%rbx
+  8053ca:	00 00 00 
+  8053cd:	49 bc 00 28 80 00 00 	movabs $0x802800,%r12
+  8053d4:	00 00 00 
+  8053d7:	eb 03                	jmp    8053dc <devcons_read+0x36>
+  8053d9:	41 ff d4             	call   *%r12
+  8053dc:	ff d3                	call   *%rbx
+  8053de:	85 c0                	test   %eax,%eax
+  8053e0:	74 f7                	je     8053d9 <devcons_read+0x33>
+    if (c < 0) return c;
+  8053e2:	48 63 d0             	movslq %eax,%rdx
+  8053e5:	78 13                	js     8053fa <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8053e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053ec:	83 f8 04             	cmp    $0x4,%eax
+  8053ef:	74 09                	je     8053fa <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8053f1:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8053f5:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8053fa:	48 89 d0             	mov    %rdx,%rax
+  8053fd:	48 83 c4 08          	add    $0x8,%rsp
+  805401:	5b                   	pop    %rbx
+  805402:	41 5c                	pop    %r12
+  805404:	41 5d                	pop    %r13
+  805406:	5d                   	pop    %rbp
+  805407:	c3                   	ret
+  805408:	48 89 d0             	mov    %rdx,%rax
+  80540b:	c3                   	ret
+
+000000000080540c <cputchar>:
+cputchar(int ch) {
+  80540c:	55                   	push   %rbp
+  80540d:	48 89 e5             	mov    %rsp,%rbp
+  805410:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805414:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805418:	be 01 00 00 00       	mov    $0x1,%esi
+  80541d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805421:	48 b8 b9 26 80 00 00 	movabs $0x8026b9,%rax
+  805428:	00 00 00 
+  80542b:	ff d0                	call   *%rax
+}
+  80542d:	c9                   	leave
+  80542e:	c3                   	ret
+
+000000000080542f <getchar>:
+getchar(void) {
+  80542f:	55                   	push   %rbp
+  805430:	48 89 e5             	mov    %rsp,%rbp
+  805433:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805437:	ba 01 00 00 00       	mov    $0x1,%edx
+  80543c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805440:	bf 00 00 00 00       	mov    $0x0,%edi
+  805445:	48 b8 82 35 80 00 00 	movabs $0x803582,%rax
+  80544c:	00 00 00 
+  80544f:	ff d0                	call   *%rax
+  805451:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805453:	85 c0                	test   %eax,%eax
+  805455:	78 06                	js     80545d <getchar+0x2e>
+  805457:	74 08                	je     805461 <getchar+0x32>
+  805459:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80545d:	89 d0                	mov    %edx,%eax
+  80545f:	c9                   	leave
+  805460:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805461:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805466:	eb f5                	jmp    80545d <getchar+0x2e>
+
+0000000000805468 <iscons>:
+iscons(int fdnum) {
+  805468:	55                   	push   %rbp
+  805469:	48 89 e5             	mov    %rsp,%rbp
+  80546c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805470:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805474:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  80547b:	00 00 00 
+  80547e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805480:	85 c0                	test   %eax,%eax
+  805482:	78 18                	js     80549c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805484:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805488:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80548f:	00 00 00 
+  805492:	8b 00                	mov    (%rax),%eax
+  805494:	39 02                	cmp    %eax,(%rdx)
+  805496:	0f 94 c0             	sete   %al
+  805499:	0f b6 c0             	movzbl %al,%eax
+}
+  80549c:	c9                   	leave
+  80549d:	c3                   	ret
+
+000000000080549e <opencons>:
+opencons(void) {
+  80549e:	55                   	push   %rbp
+  80549f:	48 89 e5             	mov    %rsp,%rbp
+  8054a2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8054a6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8054aa:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  8054b1:	00 00 00 
+  8054b4:	ff d0                	call   *%rax
+  8054b6:	85 c0                	test   %eax,%eax
+  8054b8:	78 49                	js     805503 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8054ba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8054bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8054c4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8054c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054cd:	48 b8 a1 28 80 00 00 	movabs $0x8028a1,%rax
+  8054d4:	00 00 00 
+  8054d7:	ff d0                	call   *%rax
+  8054d9:	85 c0                	test   %eax,%eax
+  8054db:	78 26                	js     805503 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8054dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054e1:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8054e8:	00 00 
+  8054ea:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8054ec:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8054f0:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8054f7:	48 b8 11 32 80 00 00 	movabs $0x803211,%rax
+  8054fe:	00 00 00 
+  805501:	ff d0                	call   *%rax
+}
+  805503:	c9                   	leave
+  805504:	c3                   	ret
+
+0000000000805505 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805505:	85 ff                	test   %edi,%edi
+  805507:	78 58                	js     805561 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805509:	48 85 f6             	test   %rsi,%rsi
+  80550c:	74 12                	je     805520 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80550e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805515:	00 00 00 
+  805518:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80551e:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805520:	48 85 c9             	test   %rcx,%rcx
+  805523:	74 12                	je     805537 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805525:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80552c:	00 00 00 
+  80552f:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805535:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805537:	48 85 d2             	test   %rdx,%rdx
+  80553a:	74 14                	je     805550 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80553c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805543:	00 00 00 
+  805546:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80554d:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805550:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805557:	00 00 00 
+  80555a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805560:	c3                   	ret
+        if (from_env_store) {
+  805561:	48 85 f6             	test   %rsi,%rsi
+  805564:	74 06                	je     80556c <ipc_result+0x67>
+            *from_env_store = 0;
+  805566:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80556c:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80556e:	48 85 c9             	test   %rcx,%rcx
+  805571:	74 ed                	je     805560 <ipc_result+0x5b>
+            *perm_store = 0;
+  805573:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805579:	c3                   	ret
+
+000000000080557a <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80557a:	55                   	push   %rbp
+  80557b:	48 89 e5             	mov    %rsp,%rbp
+  80557e:	41 55                	push   %r13
+  805580:	41 54                	push   %r12
+  805582:	53                   	push   %rbx
+  805583:	48 83 ec 08          	sub    $0x8,%rsp
+  805587:	49 89 fc             	mov    %rdi,%r12
+  80558a:	48 89 f7             	mov    %rsi,%rdi
+  80558d:	48 89 d3             	mov    %rdx,%rbx
+  805590:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805593:	48 85 f6             	test   %rsi,%rsi
+  805596:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80559d:	00 00 00 
+  8055a0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8055a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8055a9:	48 85 d2             	test   %rdx,%rdx
+  8055ac:	74 03                	je     8055b1 <ipc_recv+0x37>
+  8055ae:	48 8b 32             	mov    (%rdx),%rsi
+  8055b1:	48 b8 ed 2d 80 00 00 	movabs $0x802ded,%rax
+  8055b8:	00 00 00 
+  8055bb:	ff d0                	call   *%rax
+  8055bd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8055bf:	4c 89 e9             	mov    %r13,%rcx
+  8055c2:	48 89 da             	mov    %rbx,%rdx
+  8055c5:	4c 89 e6             	mov    %r12,%rsi
+  8055c8:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  8055cf:	00 00 00 
+  8055d2:	ff d0                	call   *%rax
+}
+  8055d4:	48 83 c4 08          	add    $0x8,%rsp
+  8055d8:	5b                   	pop    %rbx
+  8055d9:	41 5c                	pop    %r12
+  8055db:	41 5d                	pop    %r13
+  8055dd:	5d                   	pop    %rbp
+  8055de:	c3                   	ret
+
+00000000008055df <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8055df:	55                   	push   %rbp
+  8055e0:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8055e3:	48 85 d2             	test   %rdx,%rdx
+  8055e6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055ed:	00 00 00 
+  8055f0:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8055f4:	89 f6                	mov    %esi,%esi
+  8055f6:	48 b8 79 2c 80 00 00 	movabs $0x802c79,%rax
+  8055fd:	00 00 00 
+  805600:	ff d0                	call   *%rax
+    if (res < 0) {
+  805602:	85 c0                	test   %eax,%eax
+  805604:	78 02                	js     805608 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805606:	5d                   	pop    %rbp
+  805607:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805608:	89 c1                	mov    %eax,%ecx
+  80560a:	48 ba c1 64 80 00 00 	movabs $0x8064c1,%rdx
+  805611:	00 00 00 
+  805614:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805619:	48 bf ce 64 80 00 00 	movabs $0x8064ce,%rdi
+  805620:	00 00 00 
+  805623:	b8 00 00 00 00       	mov    $0x0,%eax
+  805628:	49 b8 b5 16 80 00 00 	movabs $0x8016b5,%r8
+  80562f:	00 00 00 
+  805632:	41 ff d0             	call   *%r8
+
+0000000000805635 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805635:	55                   	push   %rbp
+  805636:	48 89 e5             	mov    %rsp,%rbp
+  805639:	53                   	push   %rbx
+  80563a:	48 83 ec 08          	sub    $0x8,%rsp
+  80563e:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805642:	48 85 d2             	test   %rdx,%rdx
+  805645:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80564c:	00 00 00 
+  80564f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805653:	4d 85 c9             	test   %r9,%r9
+  805656:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80565a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80565f:	48 85 db             	test   %rbx,%rbx
+  805662:	74 03                	je     805667 <ipc_call+0x32>
+  805664:	48 8b 03             	mov    (%rbx),%rax
+  805667:	89 f6                	mov    %esi,%esi
+  805669:	48 83 ec 08          	sub    $0x8,%rsp
+  80566d:	50                   	push   %rax
+  80566e:	48 b8 ab 2c 80 00 00 	movabs $0x802cab,%rax
+  805675:	00 00 00 
+  805678:	ff d0                	call   *%rax
+  80567a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  80567c:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805680:	48 89 da             	mov    %rbx,%rdx
+  805683:	be 00 00 00 00       	mov    $0x0,%esi
+  805688:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  80568f:	00 00 00 
+  805692:	ff d0                	call   *%rax
+}
+  805694:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805698:	c9                   	leave
+  805699:	c3                   	ret
+
+000000000080569a <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  80569a:	55                   	push   %rbp
+  80569b:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  80569e:	89 f6                	mov    %esi,%esi
+  8056a0:	48 b8 17 2d 80 00 00 	movabs $0x802d17,%rax
+  8056a7:	00 00 00 
+  8056aa:	ff d0                	call   *%rax
+  8056ac:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8056ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8056bd:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  8056c4:	00 00 00 
+  8056c7:	ff d0                	call   *%rax
+}
+  8056c9:	5d                   	pop    %rbp
+  8056ca:	c3                   	ret
+
+00000000008056cb <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8056cb:	55                   	push   %rbp
+  8056cc:	48 89 e5             	mov    %rsp,%rbp
+  8056cf:	41 54                	push   %r12
+  8056d1:	53                   	push   %rbx
+  8056d2:	4c 89 cb             	mov    %r9,%rbx
+  8056d5:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8056d9:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056dd:	48 85 d2             	test   %rdx,%rdx
+  8056e0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056e7:	00 00 00 
+  8056ea:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8056ee:	4d 85 c9             	test   %r9,%r9
+  8056f1:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8056f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056fa:	4d 85 e4             	test   %r12,%r12
+  8056fd:	74 04                	je     805703 <ipc_reply_wait+0x38>
+  8056ff:	49 8b 04 24          	mov    (%r12),%rax
+  805703:	89 f6                	mov    %esi,%esi
+  805705:	48 83 ec 08          	sub    $0x8,%rsp
+  805709:	50                   	push   %rax
+  80570a:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  805711:	00 00 00 
+  805714:	ff d0                	call   *%rax
+  805716:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805718:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80571c:	4c 89 e2             	mov    %r12,%rdx
+  80571f:	48 89 de             	mov    %rbx,%rsi
+  805722:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  805729:	00 00 00 
+  80572c:	ff d0                	call   *%rax
+}
+  80572e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805732:	5b                   	pop    %rbx
+  805733:	41 5c                	pop    %r12
+  805735:	5d                   	pop    %rbp
+  805736:	c3                   	ret
+
+0000000000805737 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805737:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80573c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805743:	00 00 00 
+  805746:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80574d:	48 01 ca             	add    %rcx,%rdx
+  805750:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805756:	39 fa                	cmp    %edi,%edx
+  805758:	74 12                	je     80576c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80575a:	48 83 c0 01          	add    $0x1,%rax
+  80575e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805764:	75 e0                	jne    805746 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805766:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80576b:	c3                   	ret
+            return envs[i].env_id;
+  80576c:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805773:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80577a:	00 00 00 
+  80577d:	48 01 d0             	add    %rdx,%rax
+  805780:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805786:	c3                   	ret
+  805787:	90                   	nop
+
+0000000000805788 <__rodata_start>:
+  805788:	77 00                	ja     80578a <__rodata_start+0x2>
+  80578a:	72 62                	jb     8057ee <__rodata_start+0x66>
+  80578c:	00 77 62             	add    %dh,0x62(%rdi)
+  80578f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805792:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805799:	00 
+  80579a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8057a0:	b3 09                	mov    $0x9,%bl
+  8057a2:	80 00 00             	addb   $0x0,(%rax)
+  8057a5:	00 00                	add    %al,(%rax)
+  8057a7:	00 ed                	add    %ch,%ch
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8057cd:	00 00                	add    %al,(%rax)
+  8057cf:	00 ed                	add    %ch,%ch
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	8c 0a                	mov    %cs,(%rdx)
+  8057fa:	80 00 00             	addb   $0x0,(%rax)
+  8057fd:	00 00                	add    %al,(%rax)
+  8057ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805806:	00 00                	add    %al,(%rax)
+  805808:	8c 0a                	mov    %cs,(%rdx)
+  80580a:	80 00 00             	addb   $0x0,(%rax)
+  80580d:	00 00                	add    %al,(%rax)
+  80580f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805816:	00 00                	add    %al,(%rax)
+  805818:	8c 0a                	mov    %cs,(%rdx)
+  80581a:	80 00 00             	addb   $0x0,(%rax)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805826:	00 00                	add    %al,(%rax)
+  805828:	8c 0a                	mov    %cs,(%rdx)
+  80582a:	80 00 00             	addb   $0x0,(%rax)
+  80582d:	00 00                	add    %al,(%rax)
+  80582f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805836:	00 00                	add    %al,(%rax)
+  805838:	8c 0a                	mov    %cs,(%rdx)
+  80583a:	80 00 00             	addb   $0x0,(%rax)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	f4                   	hlt
+  805939:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80593f:	00 ed                	add    %ch,%ch
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	2c 0b                	sub    $0xb,%al
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805993:	00 00                	add    %al,(%rax)
+  805995:	00 00                	add    %al,(%rax)
+  805997:	00 cb                	add    %cl,%bl
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	6a 0a                	push   $0xa
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 ed                	add    %ch,%ch
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	3c 0a                	cmp    $0xa,%al
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 ed                	add    %ch,%ch
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  8059eb:	00 00                	add    %al,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 29                	add    %ch,(%rcx)
+  8059f9:	0c 80                	or     $0x80,%al
+  8059fb:	00 00                	add    %al,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 ed                	add    %ch,%ch
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	1a 0b                	sbb    (%rbx),%cl
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 ed                	add    %ch,%ch
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ce                   	(bad)
+  805a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a27:	00 ed                	add    %ch,%ch
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	f4                   	hlt
+  805a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a3f:	00 37                	add    %dh,(%rdi)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 37                	add    %dh,(%rdi)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805a6b:	00 00                	add    %al,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 d2                	add    %dl,%dl
+  805a71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a77:	00 d2                	add    %dl,%dl
+  805a79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a7f:	00 d2                	add    %dl,%dl
+  805a81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a87:	00 d2                	add    %dl,%dl
+  805a89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a8f:	00 d2                	add    %dl,%dl
+  805a91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a97:	00 d2                	add    %dl,%dl
+  805a99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a9f:	00 d2                	add    %dl,%dl
+  805aa1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aa7:	00 f6                	add    %dh,%dh
+  805aa9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aaf:	00 f6                	add    %dh,%dh
+  805ab1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 22                	add    %ah,(%rdx)
+  805af1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805af7:	00 22                	add    %ah,(%rdx)
+  805af9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805aff:	00 22                	add    %ah,(%rdx)
+  805b01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b07:	00 22                	add    %ah,(%rdx)
+  805b09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 46 12             	add    %al,0x12(%rsi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 22                	add    %ah,(%rdx)
+  805bf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bf7:	00 22                	add    %ah,(%rdx)
+  805bf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bff:	00 22                	add    %ah,(%rdx)
+  805c01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c07:	00 22                	add    %ah,(%rdx)
+  805c09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c0f:	00 22                	add    %ah,(%rdx)
+  805c11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c17:	00 22                	add    %ah,(%rdx)
+  805c19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 46 12             	add    %al,0x12(%rsi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805cc0 <basefix.0>:
+  805cc0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805cd0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805ce0:	10 00 66 61 75 6c 74 20 25 6c 78 0a 00 75 73 65     ..fault %lx..use
+  805cf0:	72 2f 66 61 75 6c 74 61 6c 6c 6f 63 62 61 64 2e     r/faultallocbad.
+  805d00:	63 00 66 0f 1f 44 00 00 61 6c 6c 6f 63 61 74 69     c.f..D..allocati
+  805d10:	6e 67 20 61 74 20 25 6c 78 20 69 6e 20 70 61 67     ng at %lx in pag
+  805d20:	65 20 66 61 75 6c 74 20 68 61 6e 64 6c 65 72 3a     e fault handler:
+  805d30:	20 25 69 00 00 00 00 00 74 68 69 73 20 73 74 72      %i.....this str
+  805d40:	69 6e 67 20 77 61 73 20 66 61 75 6c 74 65 64 20     ing was faulted 
+  805d50:	69 6e 20 61 74 20 25 6c 78 00 3c 75 6e 6b 6e 6f     in at %lx.<unkno
+  805d60:	77 6e 3e 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75     wn>...@.[%08x] u
+  805d70:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  805d80:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  805d90:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  805da0:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  805db0:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  805dc0:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  805dd0:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  805de0:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  805df0:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  805e00:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  805e10:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  805e20:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  805e30:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  805e40:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  805e50:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  805e60:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  805e70:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  805e80:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  805e90:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  805ea0:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  805eb0:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  805ec0:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  805ed0:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  805ee0:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  805ef0:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  805f00:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  805f10:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  805f20:	fd 19 80 00 00 00 00 00 54 20 80 00 00 00 00 00     ........T ......
+  805f30:	44 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     D ......T ......
+  805f40:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  805f50:	54 20 80 00 00 00 00 00 1c 1a 80 00 00 00 00 00     T ..............
+  805f60:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  805f70:	10 1a 80 00 00 00 00 00 8a 1a 80 00 00 00 00 00     ................
+  805f80:	54 20 80 00 00 00 00 00 10 1a 80 00 00 00 00 00     T ..............
+  805f90:	56 1a 80 00 00 00 00 00 56 1a 80 00 00 00 00 00     V.......V.......
+  805fa0:	56 1a 80 00 00 00 00 00 56 1a 80 00 00 00 00 00     V.......V.......
+  805fb0:	56 1a 80 00 00 00 00 00 56 1a 80 00 00 00 00 00     V.......V.......
+  805fc0:	56 1a 80 00 00 00 00 00 56 1a 80 00 00 00 00 00     V.......V.......
+  805fd0:	56 1a 80 00 00 00 00 00 54 20 80 00 00 00 00 00     V.......T ......
+  805fe0:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  805ff0:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806000:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806010:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806020:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806030:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806040:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806050:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806060:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806070:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806080:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806090:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  8060a0:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  8060b0:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  8060c0:	54 20 80 00 00 00 00 00 72 1f 80 00 00 00 00 00     T ......r.......
+  8060d0:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  8060e0:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  8060f0:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806100:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806110:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806120:	b8 1a 80 00 00 00 00 00 87 1c 80 00 00 00 00 00     ................
+  806130:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806140:	54 20 80 00 00 00 00 00 ad 1a 80 00 00 00 00 00     T ..............
+  806150:	e7 1a 80 00 00 00 00 00 54 20 80 00 00 00 00 00     ........T ......
+  806160:	54 20 80 00 00 00 00 00 a2 1a 80 00 00 00 00 00     T ..............
+  806170:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  806180:	30 1e 80 00 00 00 00 00 ff 1e 80 00 00 00 00 00     0...............
+  806190:	54 20 80 00 00 00 00 00 54 20 80 00 00 00 00 00     T ......T ......
+  8061a0:	7e 1b 80 00 00 00 00 00 54 20 80 00 00 00 00 00     ~.......T ......
+  8061b0:	5b 1d 80 00 00 00 00 00 54 20 80 00 00 00 00 00     [.......T ......
+  8061c0:	54 20 80 00 00 00 00 00 72 1f 80 00 00 00 00 00     T ......r.......
+  8061d0:	54 20 80 00 00 00 00 00 06 1a 80 00 00 00 00 00     T ..............
+
+00000000008061e0 <error_string>:
+	...
+  8061e8:	bd 5d 80 00 00 00 00 00 cf 5d 80 00 00 00 00 00     .].......]......
+  8061f8:	df 5d 80 00 00 00 00 00 f1 5d 80 00 00 00 00 00     .].......]......
+  806208:	ff 5d 80 00 00 00 00 00 13 5e 80 00 00 00 00 00     .].......^......
+  806218:	28 5e 80 00 00 00 00 00 3b 5e 80 00 00 00 00 00     (^......;^......
+  806228:	4d 5e 80 00 00 00 00 00 61 5e 80 00 00 00 00 00     M^......a^......
+  806238:	71 5e 80 00 00 00 00 00 84 5e 80 00 00 00 00 00     q^.......^......
+  806248:	9b 5e 80 00 00 00 00 00 b1 5e 80 00 00 00 00 00     .^.......^......
+  806258:	c9 5e 80 00 00 00 00 00 e1 5e 80 00 00 00 00 00     .^.......^......
+  806268:	ee 5e 80 00 00 00 00 00 80 62 80 00 00 00 00 00     .^.......b......
+  806278:	02 5f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ._......file is 
+  806288:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806298:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8062a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8062b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8062c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8062d8:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8062e8:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8062f8:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806308:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806318:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806328:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806338:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806348:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  806358:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  806368:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806378:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806388:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806398:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8063a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8063b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8063c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8063d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008063e0 <devtab>:
+  8063e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8063f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806400:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806410:	6f 72 64 73 29 00 6c 69 62 2f 66 69 6c 65 2e 63     ords).lib/file.c
+  806420:	00 66 64 00 62 75 66 00 72 65 73 20 3c 3d 20 6e     .fd.buf.res <= n
+  806430:	00 0f 1f 80 00 00 00 00 72 65 73 20 3c 3d 20 73     ........res <= s
+  806440:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806450:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806460:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806470:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806480:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806490:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8064a0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8064b0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8064c0:	00 69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69     .ipc_send: %i.li
+  8064d0:	62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00     b/ipc.c.f.......
+  8064e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
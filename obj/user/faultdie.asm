@@ -0,0 +1,10350 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 96 35 80 00 00 	movabs $0x803596,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 96 35 80 00 00 	movabs $0x803596,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 86 16 80 00 00 	movabs $0x801686,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 1a 16 80 00 00 	movabs $0x80161a,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be ed 5c 80 00 00 	movabs $0x805ced,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 e3 20 80 00 00 	movabs $0x8020e3,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 ff 3c 80 00 00 	movabs $0x803cff,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 10 57 80 00 00 	movabs $0x805710,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 e3 20 80 00 00 	movabs $0x8020e3,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 ff 3c 80 00 00 	movabs $0x803cff,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 12 57 80 00 00 	movabs $0x805712,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 e3 20 80 00 00 	movabs $0x8020e3,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 ff 3c 80 00 00 	movabs $0x803cff,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 15 57 80 00 00 	movabs $0x805715,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 e3 20 80 00 00 	movabs $0x8020e3,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 ff 3c 80 00 00 	movabs $0x803cff,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 6a 4d 80 00 00 	movabs $0x804d6a,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 41 50 80 00 00 	movabs $0x805041,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 80 36 80 00 00 	movabs $0x803680,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 49 37 80 00 00 	movabs $0x803749,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 4f 36 80 00 00 	movabs $0x80364f,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 4f 36 80 00 00 	movabs $0x80364f,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 67 34 80 00 00 	movabs $0x803467,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 96 35 80 00 00 	movabs $0x803596,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 ff 3c 80 00 00 	movabs $0x803cff,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 90 22 80 00 00 	movabs $0x802290,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 20 57 80 00 00 	movabs $0x805720,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 c3 22 80 00 00 	movabs $0x8022c3,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 90 22 80 00 00 	movabs $0x802290,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be c0 59 80 00 00 	movabs $0x8059c0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 90 22 80 00 00 	movabs $0x802290,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 90 22 80 00 00 	movabs $0x802290,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 40 5c 80 00 00 	movabs $0x805c40,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 40 5c 80 00 00 	movabs $0x805c40,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 72 00 00 00       	call   801571 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <handler>:
+/* Test user-level fault handler -- just exit when we fault */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = (void *)utf->utf_fault_va;
+    uint64_t err = utf->utf_err;
+    cprintf("i faulted at va %lx, err %x\n",
+  801505:	8b 57 08             	mov    0x8(%rdi),%edx
+  801508:	83 e2 07             	and    $0x7,%edx
+  80150b:	48 8b 37             	mov    (%rdi),%rsi
+  80150e:	48 bf 62 5c 80 00 00 	movabs $0x805c62,%rdi
+  801515:	00 00 00 
+  801518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151d:	48 b9 ea 16 80 00 00 	movabs $0x8016ea,%rcx
+  801524:	00 00 00 
+  801527:	ff d1                	call   *%rcx
+            (unsigned long)addr, (unsigned)(err & 7));
+    sys_env_destroy(sys_getenvid());
+  801529:	48 b8 ae 26 80 00 00 	movabs $0x8026ae,%rax
+  801530:	00 00 00 
+  801533:	ff d0                	call   *%rax
+  801535:	89 c7                	mov    %eax,%edi
+  801537:	48 b8 3d 26 80 00 00 	movabs $0x80263d,%rax
+  80153e:	00 00 00 
+  801541:	ff d0                	call   *%rax
+    return 1;
+}
+  801543:	b8 01 00 00 00       	mov    $0x1,%eax
+  801548:	5d                   	pop    %rbp
+  801549:	c3                   	ret
+
+000000000080154a <umain>:
+
+void
+umain(int argc, char **argv) {
+  80154a:	55                   	push   %rbp
+  80154b:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  80154e:	48 bf 01 15 80 00 00 	movabs $0x801501,%rdi
+  801555:	00 00 00 
+  801558:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  80155f:	00 00 00 
+  801562:	ff d0                	call   *%rax
+    *(volatile int *)0xDEADBEEF = 0;
+  801564:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  801569:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80156f:	5d                   	pop    %rbp
+  801570:	c3                   	ret
+
+0000000000801571 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801571:	55                   	push   %rbp
+  801572:	48 89 e5             	mov    %rsp,%rbp
+  801575:	41 56                	push   %r14
+  801577:	41 55                	push   %r13
+  801579:	41 54                	push   %r12
+  80157b:	53                   	push   %rbx
+  80157c:	41 89 fd             	mov    %edi,%r13d
+  80157f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801582:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801589:	00 00 00 
+  80158c:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801593:	00 00 00 
+  801596:	48 39 c2             	cmp    %rax,%rdx
+  801599:	73 17                	jae    8015b2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80159b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80159e:	49 89 c4             	mov    %rax,%r12
+  8015a1:	48 83 c3 08          	add    $0x8,%rbx
+  8015a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015aa:	ff 53 f8             	call   *-0x8(%rbx)
+  8015ad:	4c 39 e3             	cmp    %r12,%rbx
+  8015b0:	72 ef                	jb     8015a1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8015b2:	48 b8 ae 26 80 00 00 	movabs $0x8026ae,%rax
+  8015b9:	00 00 00 
+  8015bc:	ff d0                	call   *%rax
+  8015be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015c3:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8015ca:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8015d1:	00 00 00 
+  8015d4:	48 01 d0             	add    %rdx,%rax
+  8015d7:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8015de:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8015e1:	45 85 ed             	test   %r13d,%r13d
+  8015e4:	7e 0d                	jle    8015f3 <libmain+0x82>
+  8015e6:	49 8b 06             	mov    (%r14),%rax
+  8015e9:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015f0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015f3:	4c 89 f6             	mov    %r14,%rsi
+  8015f6:	44 89 ef             	mov    %r13d,%edi
+  8015f9:	48 b8 4a 15 80 00 00 	movabs $0x80154a,%rax
+  801600:	00 00 00 
+  801603:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801605:	48 b8 1a 16 80 00 00 	movabs $0x80161a,%rax
+  80160c:	00 00 00 
+  80160f:	ff d0                	call   *%rax
+#endif
+}
+  801611:	5b                   	pop    %rbx
+  801612:	41 5c                	pop    %r12
+  801614:	41 5d                	pop    %r13
+  801616:	41 5e                	pop    %r14
+  801618:	5d                   	pop    %rbp
+  801619:	c3                   	ret
+
+000000000080161a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80161a:	55                   	push   %rbp
+  80161b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80161e:	48 b8 1c 33 80 00 00 	movabs $0x80331c,%rax
+  801625:	00 00 00 
+  801628:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80162a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80162f:	48 b8 3d 26 80 00 00 	movabs $0x80263d,%rax
+  801636:	00 00 00 
+  801639:	ff d0                	call   *%rax
+}
+  80163b:	5d                   	pop    %rbp
+  80163c:	c3                   	ret
+
+000000000080163d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80163d:	55                   	push   %rbp
+  80163e:	48 89 e5             	mov    %rsp,%rbp
+  801641:	53                   	push   %rbx
+  801642:	48 83 ec 08          	sub    $0x8,%rsp
+  801646:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801649:	8b 06                	mov    (%rsi),%eax
+  80164b:	8d 50 01             	lea    0x1(%rax),%edx
+  80164e:	89 16                	mov    %edx,(%rsi)
+  801650:	48 98                	cltq
+  801652:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801657:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80165d:	74 0a                	je     801669 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80165f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801663:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801667:	c9                   	leave
+  801668:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801669:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80166d:	be ff 00 00 00       	mov    $0xff,%esi
+  801672:	48 b8 9e 25 80 00 00 	movabs $0x80259e,%rax
+  801679:	00 00 00 
+  80167c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80167e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801684:	eb d9                	jmp    80165f <putch+0x22>
+
+0000000000801686 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801686:	55                   	push   %rbp
+  801687:	48 89 e5             	mov    %rsp,%rbp
+  80168a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801691:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801694:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80169b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8016a8:	48 89 f1             	mov    %rsi,%rcx
+  8016ab:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8016b2:	48 bf 3d 16 80 00 00 	movabs $0x80163d,%rdi
+  8016b9:	00 00 00 
+  8016bc:	48 b8 3a 18 80 00 00 	movabs $0x80183a,%rax
+  8016c3:	00 00 00 
+  8016c6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8016c8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8016cf:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8016d6:	48 b8 9e 25 80 00 00 	movabs $0x80259e,%rax
+  8016dd:	00 00 00 
+  8016e0:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8016e2:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+
+00000000008016ea <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016ea:	55                   	push   %rbp
+  8016eb:	48 89 e5             	mov    %rsp,%rbp
+  8016ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8016f2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016f6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016fe:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801702:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801706:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80170d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801711:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801715:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801719:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80171d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801721:	48 b8 86 16 80 00 00 	movabs $0x801686,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80172d:	c9                   	leave
+  80172e:	c3                   	ret
+
+000000000080172f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80172f:	55                   	push   %rbp
+  801730:	48 89 e5             	mov    %rsp,%rbp
+  801733:	41 57                	push   %r15
+  801735:	41 56                	push   %r14
+  801737:	41 55                	push   %r13
+  801739:	41 54                	push   %r12
+  80173b:	53                   	push   %rbx
+  80173c:	48 83 ec 18          	sub    $0x18,%rsp
+  801740:	49 89 fc             	mov    %rdi,%r12
+  801743:	49 89 f5             	mov    %rsi,%r13
+  801746:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80174a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80174d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801750:	41 89 cf             	mov    %ecx,%r15d
+  801753:	4c 39 fa             	cmp    %r15,%rdx
+  801756:	73 5b                	jae    8017b3 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801758:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80175c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801760:	85 db                	test   %ebx,%ebx
+  801762:	7e 0e                	jle    801772 <print_num+0x43>
+            putch(padc, put_arg);
+  801764:	4c 89 ee             	mov    %r13,%rsi
+  801767:	44 89 f7             	mov    %r14d,%edi
+  80176a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80176d:	83 eb 01             	sub    $0x1,%ebx
+  801770:	75 f2                	jne    801764 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801772:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801776:	48 b9 9a 5c 80 00 00 	movabs $0x805c9a,%rcx
+  80177d:	00 00 00 
+  801780:	48 b8 89 5c 80 00 00 	movabs $0x805c89,%rax
+  801787:	00 00 00 
+  80178a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80178e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801792:	ba 00 00 00 00       	mov    $0x0,%edx
+  801797:	49 f7 f7             	div    %r15
+  80179a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80179e:	4c 89 ee             	mov    %r13,%rsi
+  8017a1:	41 ff d4             	call   *%r12
+}
+  8017a4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8017a8:	5b                   	pop    %rbx
+  8017a9:	41 5c                	pop    %r12
+  8017ab:	41 5d                	pop    %r13
+  8017ad:	41 5e                	pop    %r14
+  8017af:	41 5f                	pop    %r15
+  8017b1:	5d                   	pop    %rbp
+  8017b2:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8017b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017bc:	49 f7 f7             	div    %r15
+  8017bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8017c7:	52                   	push   %rdx
+  8017c8:	45 0f be c9          	movsbl %r9b,%r9d
+  8017cc:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8017d0:	48 89 c2             	mov    %rax,%rdx
+  8017d3:	48 b8 2f 17 80 00 00 	movabs $0x80172f,%rax
+  8017da:	00 00 00 
+  8017dd:	ff d0                	call   *%rax
+  8017df:	48 83 c4 10          	add    $0x10,%rsp
+  8017e3:	eb 8d                	jmp    801772 <print_num+0x43>
+
+00000000008017e5 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017e5:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017e9:	48 8b 06             	mov    (%rsi),%rax
+  8017ec:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017f0:	73 0a                	jae    8017fc <sprintputch+0x17>
+        *state->start++ = ch;
+  8017f2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017f6:	48 89 16             	mov    %rdx,(%rsi)
+  8017f9:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017fc:	c3                   	ret
+
+00000000008017fd <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017fd:	55                   	push   %rbp
+  8017fe:	48 89 e5             	mov    %rsp,%rbp
+  801801:	48 83 ec 50          	sub    $0x50,%rsp
+  801805:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801809:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80180d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801811:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801818:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80181c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801820:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801824:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801828:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80182c:	48 b8 3a 18 80 00 00 	movabs $0x80183a,%rax
+  801833:	00 00 00 
+  801836:	ff d0                	call   *%rax
+}
+  801838:	c9                   	leave
+  801839:	c3                   	ret
+
+000000000080183a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80183a:	55                   	push   %rbp
+  80183b:	48 89 e5             	mov    %rsp,%rbp
+  80183e:	41 57                	push   %r15
+  801840:	41 56                	push   %r14
+  801842:	41 55                	push   %r13
+  801844:	41 54                	push   %r12
+  801846:	53                   	push   %rbx
+  801847:	48 83 ec 38          	sub    $0x38,%rsp
+  80184b:	49 89 fe             	mov    %rdi,%r14
+  80184e:	49 89 f5             	mov    %rsi,%r13
+  801851:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801854:	48 8b 01             	mov    (%rcx),%rax
+  801857:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80185b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80185f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801863:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801867:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80186b:	eb 0d                	jmp    80187a <vprintfmt+0x40>
+            putch(ch, put_arg);
+  80186d:	40 0f b6 ff          	movzbl %dil,%edi
+  801871:	4c 89 ee             	mov    %r13,%rsi
+  801874:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801877:	4c 89 e3             	mov    %r12,%rbx
+  80187a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80187e:	0f b6 3b             	movzbl (%rbx),%edi
+  801881:	40 80 ff 25          	cmp    $0x25,%dil
+  801885:	74 14                	je     80189b <vprintfmt+0x61>
+            if (!ch) return;
+  801887:	40 84 ff             	test   %dil,%dil
+  80188a:	75 e1                	jne    80186d <vprintfmt+0x33>
+}
+  80188c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801890:	5b                   	pop    %rbx
+  801891:	41 5c                	pop    %r12
+  801893:	41 5d                	pop    %r13
+  801895:	41 5e                	pop    %r14
+  801897:	41 5f                	pop    %r15
+  801899:	5d                   	pop    %rbp
+  80189a:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  80189b:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a0:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8018a4:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8018a9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018af:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8018b6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018ba:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8018bf:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8018c4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8018c7:	83 e8 23             	sub    $0x23,%eax
+  8018ca:	3c 57                	cmp    $0x57,%al
+  8018cc:	0f 87 67 06 00 00    	ja     801f39 <vprintfmt+0x6ff>
+  8018d2:	0f b6 c0             	movzbl %al,%eax
+  8018d5:	48 b9 20 5e 80 00 00 	movabs $0x805e20,%rcx
+  8018dc:	00 00 00 
+  8018df:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8018e2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018e5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018e9:	eb cf                	jmp    8018ba <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018eb:	49 89 dc             	mov    %rbx,%r12
+  8018ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8018f3:	eb c5                	jmp    8018ba <vprintfmt+0x80>
+            padc = ch;
+  8018f5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018f9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018fc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018ff:	eb b9                	jmp    8018ba <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801901:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801904:	83 f8 2f             	cmp    $0x2f,%eax
+  801907:	77 24                	ja     80192d <vprintfmt+0xf3>
+  801909:	89 c1                	mov    %eax,%ecx
+  80190b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80190f:	83 c0 08             	add    $0x8,%eax
+  801912:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801915:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801918:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80191b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80191f:	79 99                	jns    8018ba <vprintfmt+0x80>
+                width = precision;
+  801921:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801925:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80192b:	eb 8d                	jmp    8018ba <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80192d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801931:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801935:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801939:	eb da                	jmp    801915 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  80193b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801940:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801944:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80194a:	3c 39                	cmp    $0x39,%al
+  80194c:	77 1c                	ja     80196a <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  80194e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801952:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801956:	0f b6 c0             	movzbl %al,%eax
+  801959:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80195e:	0f b6 03             	movzbl (%rbx),%eax
+  801961:	3c 39                	cmp    $0x39,%al
+  801963:	76 e9                	jbe    80194e <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801965:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801968:	eb b1                	jmp    80191b <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  80196a:	49 89 dc             	mov    %rbx,%r12
+  80196d:	eb ac                	jmp    80191b <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80196f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801972:	85 c9                	test   %ecx,%ecx
+  801974:	b8 00 00 00 00       	mov    $0x0,%eax
+  801979:	0f 49 c1             	cmovns %ecx,%eax
+  80197c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80197f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801982:	e9 33 ff ff ff       	jmp    8018ba <vprintfmt+0x80>
+            lflag++;
+  801987:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80198a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80198d:	e9 28 ff ff ff       	jmp    8018ba <vprintfmt+0x80>
+            lflag--;
+  801992:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801995:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801998:	e9 1d ff ff ff       	jmp    8018ba <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  80199d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8019a3:	77 19                	ja     8019be <vprintfmt+0x184>
+  8019a5:	89 c2                	mov    %eax,%edx
+  8019a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019ab:	83 c0 08             	add    $0x8,%eax
+  8019ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8019b1:	8b 3a                	mov    (%rdx),%edi
+  8019b3:	4c 89 ee             	mov    %r13,%rsi
+  8019b6:	41 ff d6             	call   *%r14
+            break;
+  8019b9:	e9 bc fe ff ff       	jmp    80187a <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  8019be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019ca:	eb e5                	jmp    8019b1 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  8019cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8019d2:	77 5a                	ja     801a2e <vprintfmt+0x1f4>
+  8019d4:	89 c2                	mov    %eax,%edx
+  8019d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019da:	83 c0 08             	add    $0x8,%eax
+  8019dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8019e0:	8b 02                	mov    (%rdx),%eax
+  8019e2:	89 c1                	mov    %eax,%ecx
+  8019e4:	f7 d9                	neg    %ecx
+  8019e6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019e9:	83 f9 13             	cmp    $0x13,%ecx
+  8019ec:	7f 4e                	jg     801a3c <vprintfmt+0x202>
+  8019ee:	48 63 c1             	movslq %ecx,%rax
+  8019f1:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8019f8:	00 00 00 
+  8019fb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019ff:	48 85 c0             	test   %rax,%rax
+  801a02:	74 38                	je     801a3c <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801a04:	48 89 c1             	mov    %rax,%rcx
+  801a07:	48 ba 5a 62 80 00 00 	movabs $0x80625a,%rdx
+  801a0e:	00 00 00 
+  801a11:	4c 89 ee             	mov    %r13,%rsi
+  801a14:	4c 89 f7             	mov    %r14,%rdi
+  801a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1c:	49 b8 fd 17 80 00 00 	movabs $0x8017fd,%r8
+  801a23:	00 00 00 
+  801a26:	41 ff d0             	call   *%r8
+  801a29:	e9 4c fe ff ff       	jmp    80187a <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801a2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a3a:	eb a4                	jmp    8019e0 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801a3c:	48 ba b2 5c 80 00 00 	movabs $0x805cb2,%rdx
+  801a43:	00 00 00 
+  801a46:	4c 89 ee             	mov    %r13,%rsi
+  801a49:	4c 89 f7             	mov    %r14,%rdi
+  801a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a51:	49 b8 fd 17 80 00 00 	movabs $0x8017fd,%r8
+  801a58:	00 00 00 
+  801a5b:	41 ff d0             	call   *%r8
+  801a5e:	e9 17 fe ff ff       	jmp    80187a <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a66:	83 f8 2f             	cmp    $0x2f,%eax
+  801a69:	77 6c                	ja     801ad7 <vprintfmt+0x29d>
+  801a6b:	89 c2                	mov    %eax,%edx
+  801a6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a71:	83 c0 08             	add    $0x8,%eax
+  801a74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a77:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a7a:	48 85 f6             	test   %rsi,%rsi
+  801a7d:	48 b8 ab 5c 80 00 00 	movabs $0x805cab,%rax
+  801a84:	00 00 00 
+  801a87:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a8b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a8f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a93:	7e 06                	jle    801a9b <vprintfmt+0x261>
+  801a95:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a99:	75 4a                	jne    801ae5 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a9f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801aa3:	0f b6 00             	movzbl (%rax),%eax
+  801aa6:	84 c0                	test   %al,%al
+  801aa8:	0f 85 9a 00 00 00    	jne    801b48 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801aae:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	0f 8e bd fd ff ff    	jle    80187a <vprintfmt+0x40>
+  801abd:	4c 89 ee             	mov    %r13,%rsi
+  801ac0:	bf 20 00 00 00       	mov    $0x20,%edi
+  801ac5:	41 ff d6             	call   *%r14
+  801ac8:	41 83 ec 01          	sub    $0x1,%r12d
+  801acc:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801ad0:	75 eb                	jne    801abd <vprintfmt+0x283>
+  801ad2:	e9 a3 fd ff ff       	jmp    80187a <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ad7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801adb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801adf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ae3:	eb 92                	jmp    801a77 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ae5:	49 63 f7             	movslq %r15d,%rsi
+  801ae8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801aec:	48 b8 fe 1f 80 00 00 	movabs $0x801ffe,%rax
+  801af3:	00 00 00 
+  801af6:	ff d0                	call   *%rax
+  801af8:	48 89 c2             	mov    %rax,%rdx
+  801afb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801afe:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801b00:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801b03:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	7e 91                	jle    801a9b <vprintfmt+0x261>
+  801b0a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801b0f:	4c 89 ee             	mov    %r13,%rsi
+  801b12:	44 89 e7             	mov    %r12d,%edi
+  801b15:	41 ff d6             	call   *%r14
+  801b18:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b1c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801b22:	75 eb                	jne    801b0f <vprintfmt+0x2d5>
+  801b24:	e9 72 ff ff ff       	jmp    801a9b <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b29:	0f b6 f8             	movzbl %al,%edi
+  801b2c:	4c 89 ee             	mov    %r13,%rsi
+  801b2f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b32:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b36:	49 83 c4 01          	add    $0x1,%r12
+  801b3a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801b40:	84 c0                	test   %al,%al
+  801b42:	0f 84 66 ff ff ff    	je     801aae <vprintfmt+0x274>
+  801b48:	45 85 ff             	test   %r15d,%r15d
+  801b4b:	78 0a                	js     801b57 <vprintfmt+0x31d>
+  801b4d:	41 83 ef 01          	sub    $0x1,%r15d
+  801b51:	0f 88 57 ff ff ff    	js     801aae <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b57:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b5b:	74 cc                	je     801b29 <vprintfmt+0x2ef>
+  801b5d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b60:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b65:	80 fa 5e             	cmp    $0x5e,%dl
+  801b68:	77 c2                	ja     801b2c <vprintfmt+0x2f2>
+  801b6a:	eb bd                	jmp    801b29 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b6c:	40 84 f6             	test   %sil,%sil
+  801b6f:	75 26                	jne    801b97 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b71:	85 d2                	test   %edx,%edx
+  801b73:	74 59                	je     801bce <vprintfmt+0x394>
+  801b75:	83 fa 01             	cmp    $0x1,%edx
+  801b78:	74 7b                	je     801bf5 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b7d:	83 f8 2f             	cmp    $0x2f,%eax
+  801b80:	0f 87 96 00 00 00    	ja     801c1c <vprintfmt+0x3e2>
+  801b86:	89 c2                	mov    %eax,%edx
+  801b88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b8c:	83 c0 08             	add    $0x8,%eax
+  801b8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b92:	4c 8b 22             	mov    (%rdx),%r12
+  801b95:	eb 17                	jmp    801bae <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801b9d:	77 21                	ja     801bc0 <vprintfmt+0x386>
+  801b9f:	89 c2                	mov    %eax,%edx
+  801ba1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ba5:	83 c0 08             	add    $0x8,%eax
+  801ba8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bab:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801bae:	4d 85 e4             	test   %r12,%r12
+  801bb1:	78 7a                	js     801c2d <vprintfmt+0x3f3>
+            num = i;
+  801bb3:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801bb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801bbb:	e9 56 02 00 00       	jmp    801e16 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801bc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bcc:	eb dd                	jmp    801bab <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801bce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bd1:	83 f8 2f             	cmp    $0x2f,%eax
+  801bd4:	77 11                	ja     801be7 <vprintfmt+0x3ad>
+  801bd6:	89 c2                	mov    %eax,%edx
+  801bd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bdc:	83 c0 08             	add    $0x8,%eax
+  801bdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801be2:	4c 63 22             	movslq (%rdx),%r12
+  801be5:	eb c7                	jmp    801bae <vprintfmt+0x374>
+  801be7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801beb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf3:	eb ed                	jmp    801be2 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bf8:	83 f8 2f             	cmp    $0x2f,%eax
+  801bfb:	77 11                	ja     801c0e <vprintfmt+0x3d4>
+  801bfd:	89 c2                	mov    %eax,%edx
+  801bff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c03:	83 c0 08             	add    $0x8,%eax
+  801c06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c09:	4c 8b 22             	mov    (%rdx),%r12
+  801c0c:	eb a0                	jmp    801bae <vprintfmt+0x374>
+  801c0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c1a:	eb ed                	jmp    801c09 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801c1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c28:	e9 65 ff ff ff       	jmp    801b92 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801c2d:	4c 89 ee             	mov    %r13,%rsi
+  801c30:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801c35:	41 ff d6             	call   *%r14
+                i = -i;
+  801c38:	49 f7 dc             	neg    %r12
+  801c3b:	e9 73 ff ff ff       	jmp    801bb3 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801c40:	40 84 f6             	test   %sil,%sil
+  801c43:	75 2e                	jne    801c73 <vprintfmt+0x439>
+    switch (lflag) {
+  801c45:	85 d2                	test   %edx,%edx
+  801c47:	7f 59                	jg     801ca2 <vprintfmt+0x468>
+  801c49:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c4c:	7d 7a                	jge    801cc8 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c51:	83 f8 2f             	cmp    $0x2f,%eax
+  801c54:	0f 87 aa 00 00 00    	ja     801d04 <vprintfmt+0x4ca>
+  801c5a:	89 c2                	mov    %eax,%edx
+  801c5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c60:	83 c0 08             	add    $0x8,%eax
+  801c63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c66:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c69:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c6e:	e9 a3 01 00 00       	jmp    801e16 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c76:	83 f8 2f             	cmp    $0x2f,%eax
+  801c79:	77 19                	ja     801c94 <vprintfmt+0x45a>
+  801c7b:	89 c2                	mov    %eax,%edx
+  801c7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c81:	83 c0 08             	add    $0x8,%eax
+  801c84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c87:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c8a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c8f:	e9 82 01 00 00       	jmp    801e16 <vprintfmt+0x5dc>
+  801c94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca0:	eb e5                	jmp    801c87 <vprintfmt+0x44d>
+    switch (lflag) {
+  801ca2:	83 fa 01             	cmp    $0x1,%edx
+  801ca5:	75 a7                	jne    801c4e <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801ca7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801caa:	83 f8 2f             	cmp    $0x2f,%eax
+  801cad:	77 47                	ja     801cf6 <vprintfmt+0x4bc>
+  801caf:	89 c2                	mov    %eax,%edx
+  801cb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cb5:	83 c0 08             	add    $0x8,%eax
+  801cb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cbb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cbe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801cc3:	e9 4e 01 00 00       	jmp    801e16 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801cc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ccb:	83 f8 2f             	cmp    $0x2f,%eax
+  801cce:	77 18                	ja     801ce8 <vprintfmt+0x4ae>
+  801cd0:	89 c2                	mov    %eax,%edx
+  801cd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cd6:	83 c0 08             	add    $0x8,%eax
+  801cd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cdc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801cde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801ce3:	e9 2e 01 00 00       	jmp    801e16 <vprintfmt+0x5dc>
+  801ce8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cf4:	eb e6                	jmp    801cdc <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cf6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cfa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d02:	eb b7                	jmp    801cbb <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801d04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d10:	e9 51 ff ff ff       	jmp    801c66 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801d15:	40 84 f6             	test   %sil,%sil
+  801d18:	75 2e                	jne    801d48 <vprintfmt+0x50e>
+    switch (lflag) {
+  801d1a:	85 d2                	test   %edx,%edx
+  801d1c:	7f 59                	jg     801d77 <vprintfmt+0x53d>
+  801d1e:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d21:	7d 77                	jge    801d9a <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801d23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d26:	83 f8 2f             	cmp    $0x2f,%eax
+  801d29:	0f 87 a4 00 00 00    	ja     801dd3 <vprintfmt+0x599>
+  801d2f:	89 c2                	mov    %eax,%edx
+  801d31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d35:	83 c0 08             	add    $0x8,%eax
+  801d38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d3e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d43:	e9 ce 00 00 00       	jmp    801e16 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4e:	77 19                	ja     801d69 <vprintfmt+0x52f>
+  801d50:	89 c2                	mov    %eax,%edx
+  801d52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d56:	83 c0 08             	add    $0x8,%eax
+  801d59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d5f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d64:	e9 ad 00 00 00       	jmp    801e16 <vprintfmt+0x5dc>
+  801d69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d75:	eb e5                	jmp    801d5c <vprintfmt+0x522>
+    switch (lflag) {
+  801d77:	83 fa 01             	cmp    $0x1,%edx
+  801d7a:	75 a7                	jne    801d23 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d7f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d82:	77 41                	ja     801dc5 <vprintfmt+0x58b>
+  801d84:	89 c2                	mov    %eax,%edx
+  801d86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d8a:	83 c0 08             	add    $0x8,%eax
+  801d8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d90:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d93:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d98:	eb 7c                	jmp    801e16 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d9d:	83 f8 2f             	cmp    $0x2f,%eax
+  801da0:	77 15                	ja     801db7 <vprintfmt+0x57d>
+  801da2:	89 c2                	mov    %eax,%edx
+  801da4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801da8:	83 c0 08             	add    $0x8,%eax
+  801dab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dae:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801db0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801db5:	eb 5f                	jmp    801e16 <vprintfmt+0x5dc>
+  801db7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc3:	eb e9                	jmp    801dae <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801dc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dd1:	eb bd                	jmp    801d90 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801dd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ddb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ddf:	e9 57 ff ff ff       	jmp    801d3b <vprintfmt+0x501>
+            putch('0', put_arg);
+  801de4:	4c 89 ee             	mov    %r13,%rsi
+  801de7:	bf 30 00 00 00       	mov    $0x30,%edi
+  801dec:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801def:	4c 89 ee             	mov    %r13,%rsi
+  801df2:	bf 78 00 00 00       	mov    $0x78,%edi
+  801df7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801dfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dfd:	83 f8 2f             	cmp    $0x2f,%eax
+  801e00:	77 47                	ja     801e49 <vprintfmt+0x60f>
+  801e02:	89 c2                	mov    %eax,%edx
+  801e04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e08:	83 c0 08             	add    $0x8,%eax
+  801e0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e11:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801e16:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801e1e:	0f 94 c0             	sete   %al
+  801e21:	0f b6 c0             	movzbl %al,%eax
+  801e24:	50                   	push   %rax
+  801e25:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801e2a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801e2e:	4c 89 ee             	mov    %r13,%rsi
+  801e31:	4c 89 f7             	mov    %r14,%rdi
+  801e34:	48 b8 2f 17 80 00 00 	movabs $0x80172f,%rax
+  801e3b:	00 00 00 
+  801e3e:	ff d0                	call   *%rax
+            break;
+  801e40:	48 83 c4 10          	add    $0x10,%rsp
+  801e44:	e9 31 fa ff ff       	jmp    80187a <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e55:	eb b7                	jmp    801e0e <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e57:	40 84 f6             	test   %sil,%sil
+  801e5a:	75 2b                	jne    801e87 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e5c:	85 d2                	test   %edx,%edx
+  801e5e:	7f 56                	jg     801eb6 <vprintfmt+0x67c>
+  801e60:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e63:	7d 77                	jge    801edc <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e68:	83 f8 2f             	cmp    $0x2f,%eax
+  801e6b:	0f 87 a7 00 00 00    	ja     801f18 <vprintfmt+0x6de>
+  801e71:	89 c2                	mov    %eax,%edx
+  801e73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e77:	83 c0 08             	add    $0x8,%eax
+  801e7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e7d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e80:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e85:	eb 8f                	jmp    801e16 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e8a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8d:	77 19                	ja     801ea8 <vprintfmt+0x66e>
+  801e8f:	89 c2                	mov    %eax,%edx
+  801e91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e95:	83 c0 08             	add    $0x8,%eax
+  801e98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ea3:	e9 6e ff ff ff       	jmp    801e16 <vprintfmt+0x5dc>
+  801ea8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb4:	eb e5                	jmp    801e9b <vprintfmt+0x661>
+    switch (lflag) {
+  801eb6:	83 fa 01             	cmp    $0x1,%edx
+  801eb9:	75 aa                	jne    801e65 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801ebb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ebe:	83 f8 2f             	cmp    $0x2f,%eax
+  801ec1:	77 47                	ja     801f0a <vprintfmt+0x6d0>
+  801ec3:	89 c2                	mov    %eax,%edx
+  801ec5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec9:	83 c0 08             	add    $0x8,%eax
+  801ecc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ecf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ed2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801ed7:	e9 3a ff ff ff       	jmp    801e16 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801edc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801edf:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee2:	77 18                	ja     801efc <vprintfmt+0x6c2>
+  801ee4:	89 c2                	mov    %eax,%edx
+  801ee6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eea:	83 c0 08             	add    $0x8,%eax
+  801eed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ef2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ef7:	e9 1a ff ff ff       	jmp    801e16 <vprintfmt+0x5dc>
+  801efc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f08:	eb e6                	jmp    801ef0 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801f0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f16:	eb b7                	jmp    801ecf <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801f18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f24:	e9 54 ff ff ff       	jmp    801e7d <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801f29:	4c 89 ee             	mov    %r13,%rsi
+  801f2c:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f31:	41 ff d6             	call   *%r14
+            break;
+  801f34:	e9 41 f9 ff ff       	jmp    80187a <vprintfmt+0x40>
+            putch('%', put_arg);
+  801f39:	4c 89 ee             	mov    %r13,%rsi
+  801f3c:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f41:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f44:	48 83 eb 01          	sub    $0x1,%rbx
+  801f48:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f4c:	75 f6                	jne    801f44 <vprintfmt+0x70a>
+  801f4e:	e9 27 f9 ff ff       	jmp    80187a <vprintfmt+0x40>
+
+0000000000801f53 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f53:	55                   	push   %rbp
+  801f54:	48 89 e5             	mov    %rsp,%rbp
+  801f57:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f5b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f5f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f64:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f68:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f6f:	48 85 ff             	test   %rdi,%rdi
+  801f72:	74 2b                	je     801f9f <vsnprintf+0x4c>
+  801f74:	48 85 f6             	test   %rsi,%rsi
+  801f77:	74 26                	je     801f9f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f79:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f7d:	48 bf e5 17 80 00 00 	movabs $0x8017e5,%rdi
+  801f84:	00 00 00 
+  801f87:	48 b8 3a 18 80 00 00 	movabs $0x80183a,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f97:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f9a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fa4:	eb f7                	jmp    801f9d <vsnprintf+0x4a>
+
+0000000000801fa6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801fa6:	55                   	push   %rbp
+  801fa7:	48 89 e5             	mov    %rsp,%rbp
+  801faa:	48 83 ec 50          	sub    $0x50,%rsp
+  801fae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801fb2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801fb6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801fba:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801fc1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801fc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801fcd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801fd1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801fd5:	48 b8 53 1f 80 00 00 	movabs $0x801f53,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801fe1:	c9                   	leave
+  801fe2:	c3                   	ret
+
+0000000000801fe3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801fe3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fe6:	74 10                	je     801ff8 <strlen+0x15>
+    size_t n = 0;
+  801fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fed:	48 83 c0 01          	add    $0x1,%rax
+  801ff1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801ff5:	75 f6                	jne    801fed <strlen+0xa>
+  801ff7:	c3                   	ret
+    size_t n = 0;
+  801ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801ffd:	c3                   	ret
+
+0000000000801ffe <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801ffe:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802001:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802006:	48 85 f6             	test   %rsi,%rsi
+  802009:	74 11                	je     80201c <strnlen+0x1e>
+  80200b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80200f:	74 0c                	je     80201d <strnlen+0x1f>
+  802011:	48 83 c2 01          	add    $0x1,%rdx
+  802015:	48 39 d0             	cmp    %rdx,%rax
+  802018:	75 f1                	jne    80200b <strnlen+0xd>
+  80201a:	eb 04                	jmp    802020 <strnlen+0x22>
+  80201c:	c3                   	ret
+  80201d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802020:	c3                   	ret
+
+0000000000802021 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802021:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802024:	ba 00 00 00 00       	mov    $0x0,%edx
+  802029:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80202d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802030:	48 83 c2 01          	add    $0x1,%rdx
+  802034:	84 c9                	test   %cl,%cl
+  802036:	75 f1                	jne    802029 <strcpy+0x8>
+        ;
+    return res;
+}
+  802038:	c3                   	ret
+
+0000000000802039 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802039:	55                   	push   %rbp
+  80203a:	48 89 e5             	mov    %rsp,%rbp
+  80203d:	41 54                	push   %r12
+  80203f:	53                   	push   %rbx
+  802040:	48 89 fb             	mov    %rdi,%rbx
+  802043:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802046:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  80204d:	00 00 00 
+  802050:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802052:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802056:	4c 89 e6             	mov    %r12,%rsi
+  802059:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+    return dst;
+}
+  802065:	48 89 d8             	mov    %rbx,%rax
+  802068:	5b                   	pop    %rbx
+  802069:	41 5c                	pop    %r12
+  80206b:	5d                   	pop    %rbp
+  80206c:	c3                   	ret
+
+000000000080206d <toupper>:
+
+int
+toupper(int ch) {
+  80206d:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80206f:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802072:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802075:	83 f9 1a             	cmp    $0x1a,%ecx
+  802078:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80207b:	c3                   	ret
+
+000000000080207c <tolower>:
+
+int
+tolower(int ch) {
+  80207c:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80207e:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802081:	8d 57 20             	lea    0x20(%rdi),%edx
+  802084:	83 f9 1a             	cmp    $0x1a,%ecx
+  802087:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80208a:	c3                   	ret
+
+000000000080208b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80208b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80208e:	48 85 d2             	test   %rdx,%rdx
+  802091:	74 1f                	je     8020b2 <strncpy+0x27>
+  802093:	48 01 fa             	add    %rdi,%rdx
+  802096:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802099:	48 83 c1 01          	add    $0x1,%rcx
+  80209d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8020a1:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8020a5:	41 80 f8 01          	cmp    $0x1,%r8b
+  8020a9:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8020ad:	48 39 ca             	cmp    %rcx,%rdx
+  8020b0:	75 e7                	jne    802099 <strncpy+0xe>
+    }
+    return ret;
+}
+  8020b2:	c3                   	ret
+
+00000000008020b3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8020b3:	48 89 f8             	mov    %rdi,%rax
+  8020b6:	48 85 d2             	test   %rdx,%rdx
+  8020b9:	74 24                	je     8020df <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8020bb:	48 83 ea 01          	sub    $0x1,%rdx
+  8020bf:	74 1b                	je     8020dc <strlcpy+0x29>
+  8020c1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8020c5:	0f b6 16             	movzbl (%rsi),%edx
+  8020c8:	84 d2                	test   %dl,%dl
+  8020ca:	74 10                	je     8020dc <strlcpy+0x29>
+            *dst++ = *src++;
+  8020cc:	48 83 c6 01          	add    $0x1,%rsi
+  8020d0:	48 83 c0 01          	add    $0x1,%rax
+  8020d4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8020d7:	48 39 c8             	cmp    %rcx,%rax
+  8020da:	75 e9                	jne    8020c5 <strlcpy+0x12>
+        *dst = '\0';
+  8020dc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8020df:	48 29 f8             	sub    %rdi,%rax
+}
+  8020e2:	c3                   	ret
+
+00000000008020e3 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8020e3:	0f b6 07             	movzbl (%rdi),%eax
+  8020e6:	84 c0                	test   %al,%al
+  8020e8:	74 13                	je     8020fd <strcmp+0x1a>
+  8020ea:	38 06                	cmp    %al,(%rsi)
+  8020ec:	75 0f                	jne    8020fd <strcmp+0x1a>
+  8020ee:	48 83 c7 01          	add    $0x1,%rdi
+  8020f2:	48 83 c6 01          	add    $0x1,%rsi
+  8020f6:	0f b6 07             	movzbl (%rdi),%eax
+  8020f9:	84 c0                	test   %al,%al
+  8020fb:	75 ed                	jne    8020ea <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020fd:	0f b6 c0             	movzbl %al,%eax
+  802100:	0f b6 16             	movzbl (%rsi),%edx
+  802103:	29 d0                	sub    %edx,%eax
+}
+  802105:	c3                   	ret
+
+0000000000802106 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802106:	48 85 d2             	test   %rdx,%rdx
+  802109:	74 1f                	je     80212a <strncmp+0x24>
+  80210b:	0f b6 07             	movzbl (%rdi),%eax
+  80210e:	84 c0                	test   %al,%al
+  802110:	74 1e                	je     802130 <strncmp+0x2a>
+  802112:	3a 06                	cmp    (%rsi),%al
+  802114:	75 1a                	jne    802130 <strncmp+0x2a>
+  802116:	48 83 c7 01          	add    $0x1,%rdi
+  80211a:	48 83 c6 01          	add    $0x1,%rsi
+  80211e:	48 83 ea 01          	sub    $0x1,%rdx
+  802122:	75 e7                	jne    80210b <strncmp+0x5>
+
+    if (!n) return 0;
+  802124:	b8 00 00 00 00       	mov    $0x0,%eax
+  802129:	c3                   	ret
+  80212a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212f:	c3                   	ret
+  802130:	48 85 d2             	test   %rdx,%rdx
+  802133:	74 09                	je     80213e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802135:	0f b6 07             	movzbl (%rdi),%eax
+  802138:	0f b6 16             	movzbl (%rsi),%edx
+  80213b:	29 d0                	sub    %edx,%eax
+  80213d:	c3                   	ret
+    if (!n) return 0;
+  80213e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802143:	c3                   	ret
+
+0000000000802144 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802144:	0f b6 17             	movzbl (%rdi),%edx
+  802147:	84 d2                	test   %dl,%dl
+  802149:	74 18                	je     802163 <strchr+0x1f>
+        if (*str == c) {
+  80214b:	0f be d2             	movsbl %dl,%edx
+  80214e:	39 f2                	cmp    %esi,%edx
+  802150:	74 17                	je     802169 <strchr+0x25>
+    for (; *str; str++) {
+  802152:	48 83 c7 01          	add    $0x1,%rdi
+  802156:	0f b6 17             	movzbl (%rdi),%edx
+  802159:	84 d2                	test   %dl,%dl
+  80215b:	75 ee                	jne    80214b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80215d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802162:	c3                   	ret
+  802163:	b8 00 00 00 00       	mov    $0x0,%eax
+  802168:	c3                   	ret
+  802169:	48 89 f8             	mov    %rdi,%rax
+}
+  80216c:	c3                   	ret
+
+000000000080216d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80216d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802170:	0f b6 17             	movzbl (%rdi),%edx
+  802173:	84 d2                	test   %dl,%dl
+  802175:	74 13                	je     80218a <strfind+0x1d>
+  802177:	0f be d2             	movsbl %dl,%edx
+  80217a:	39 f2                	cmp    %esi,%edx
+  80217c:	74 0b                	je     802189 <strfind+0x1c>
+  80217e:	48 83 c0 01          	add    $0x1,%rax
+  802182:	0f b6 10             	movzbl (%rax),%edx
+  802185:	84 d2                	test   %dl,%dl
+  802187:	75 ee                	jne    802177 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802189:	c3                   	ret
+  80218a:	c3                   	ret
+
+000000000080218b <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80218b:	48 39 f7             	cmp    %rsi,%rdi
+  80218e:	74 65                	je     8021f5 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+  802194:	41 57                	push   %r15
+  802196:	41 56                	push   %r14
+  802198:	41 55                	push   %r13
+  80219a:	41 54                	push   %r12
+  80219c:	53                   	push   %rbx
+  80219d:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a1:	48 89 fb             	mov    %rdi,%rbx
+  8021a4:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8021a7:	49 bf 7c 20 80 00 00 	movabs $0x80207c,%r15
+  8021ae:	00 00 00 
+  8021b1:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021b5:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021b9:	41 ff d7             	call   *%r15
+  8021bc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021bf:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021c4:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021c8:	41 ff d7             	call   *%r15
+  8021cb:	89 c2                	mov    %eax,%edx
+  8021cd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021d0:	29 d0                	sub    %edx,%eax
+  8021d2:	75 12                	jne    8021e6 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8021d4:	48 83 c3 01          	add    $0x1,%rbx
+  8021d8:	45 84 ed             	test   %r13b,%r13b
+  8021db:	74 09                	je     8021e6 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8021dd:	49 83 c4 01          	add    $0x1,%r12
+  8021e1:	45 84 f6             	test   %r14b,%r14b
+  8021e4:	75 cb                	jne    8021b1 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021e6:	48 83 c4 18          	add    $0x18,%rsp
+  8021ea:	5b                   	pop    %rbx
+  8021eb:	41 5c                	pop    %r12
+  8021ed:	41 5d                	pop    %r13
+  8021ef:	41 5e                	pop    %r14
+  8021f1:	41 5f                	pop    %r15
+  8021f3:	5d                   	pop    %rbp
+  8021f4:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021fa:	c3                   	ret
+
+00000000008021fb <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021fb:	48 39 f7             	cmp    %rsi,%rdi
+  8021fe:	74 7d                	je     80227d <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802200:	55                   	push   %rbp
+  802201:	48 89 e5             	mov    %rsp,%rbp
+  802204:	41 57                	push   %r15
+  802206:	41 56                	push   %r14
+  802208:	41 55                	push   %r13
+  80220a:	41 54                	push   %r12
+  80220c:	53                   	push   %rbx
+  80220d:	48 83 ec 18          	sub    $0x18,%rsp
+  802211:	48 89 fb             	mov    %rdi,%rbx
+  802214:	49 89 f4             	mov    %rsi,%r12
+  802217:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80221b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80221f:	49 bf 7c 20 80 00 00 	movabs $0x80207c,%r15
+  802226:	00 00 00 
+    while (n--) {
+  802229:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80222d:	48 39 c3             	cmp    %rax,%rbx
+  802230:	74 37                	je     802269 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802232:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802236:	41 0f b6 fd          	movzbl %r13b,%edi
+  80223a:	41 ff d7             	call   *%r15
+  80223d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802240:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802245:	41 0f b6 fe          	movzbl %r14b,%edi
+  802249:	41 ff d7             	call   *%r15
+  80224c:	89 c2                	mov    %eax,%edx
+  80224e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802251:	29 d0                	sub    %edx,%eax
+  802253:	75 19                	jne    80226e <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802255:	48 83 c3 01          	add    $0x1,%rbx
+  802259:	45 84 ed             	test   %r13b,%r13b
+  80225c:	74 10                	je     80226e <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80225e:	49 83 c4 01          	add    $0x1,%r12
+  802262:	45 84 f6             	test   %r14b,%r14b
+  802265:	75 c2                	jne    802229 <strncasecmp+0x2e>
+  802267:	eb 05                	jmp    80226e <strncasecmp+0x73>
+  802269:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80226e:	48 83 c4 18          	add    $0x18,%rsp
+  802272:	5b                   	pop    %rbx
+  802273:	41 5c                	pop    %r12
+  802275:	41 5d                	pop    %r13
+  802277:	41 5e                	pop    %r14
+  802279:	41 5f                	pop    %r15
+  80227b:	5d                   	pop    %rbp
+  80227c:	c3                   	ret
+    if (p1 == p2) return 0;
+  80227d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802282:	c3                   	ret
+
+0000000000802283 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802283:	83 e7 df             	and    $0xffffffdf,%edi
+  802286:	83 ef 41             	sub    $0x41,%edi
+  802289:	83 ff 19             	cmp    $0x19,%edi
+  80228c:	0f 96 c0             	setbe  %al
+}
+  80228f:	c3                   	ret
+
+0000000000802290 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802290:	83 ff 20             	cmp    $0x20,%edi
+  802293:	0f 94 c0             	sete   %al
+  802296:	83 ff 09             	cmp    $0x9,%edi
+  802299:	0f 94 c2             	sete   %dl
+  80229c:	09 d0                	or     %edx,%eax
+}
+  80229e:	c3                   	ret
+
+000000000080229f <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80229f:	55                   	push   %rbp
+  8022a0:	48 89 e5             	mov    %rsp,%rbp
+  8022a3:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8022a5:	48 bf 9f 61 80 00 00 	movabs $0x80619f,%rdi
+  8022ac:	00 00 00 
+  8022af:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  8022b6:	00 00 00 
+  8022b9:	ff d0                	call   *%rax
+  8022bb:	48 85 c0             	test   %rax,%rax
+  8022be:	0f 95 c0             	setne  %al
+}
+  8022c1:	5d                   	pop    %rbp
+  8022c2:	c3                   	ret
+
+00000000008022c3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8022c3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8022c6:	48 89 f8             	mov    %rdi,%rax
+  8022c9:	48 f7 d8             	neg    %rax
+  8022cc:	83 e0 07             	and    $0x7,%eax
+  8022cf:	49 89 d1             	mov    %rdx,%r9
+  8022d2:	49 29 c1             	sub    %rax,%r9
+  8022d5:	78 36                	js     80230d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8022d7:	40 0f b6 c6          	movzbl %sil,%eax
+  8022db:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8022e2:	01 01 01 
+  8022e5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022e9:	40 f6 c7 07          	test   $0x7,%dil
+  8022ed:	75 38                	jne    802327 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022ef:	4c 89 c9             	mov    %r9,%rcx
+  8022f2:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022f6:	74 0c                	je     802304 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022f8:	fc                   	cld
+  8022f9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022fc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802300:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802304:	4d 85 c9             	test   %r9,%r9
+  802307:	75 45                	jne    80234e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802309:	4c 89 c0             	mov    %r8,%rax
+  80230c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80230d:	48 85 d2             	test   %rdx,%rdx
+  802310:	74 f7                	je     802309 <memset+0x46>
+  802312:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802315:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802318:	48 83 c0 01          	add    $0x1,%rax
+  80231c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802320:	48 39 c2             	cmp    %rax,%rdx
+  802323:	75 f3                	jne    802318 <memset+0x55>
+  802325:	eb e2                	jmp    802309 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802327:	40 f6 c7 01          	test   $0x1,%dil
+  80232b:	74 06                	je     802333 <memset+0x70>
+  80232d:	88 07                	mov    %al,(%rdi)
+  80232f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802333:	40 f6 c7 02          	test   $0x2,%dil
+  802337:	74 07                	je     802340 <memset+0x7d>
+  802339:	66 89 07             	mov    %ax,(%rdi)
+  80233c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802340:	40 f6 c7 04          	test   $0x4,%dil
+  802344:	74 a9                	je     8022ef <memset+0x2c>
+  802346:	89 07                	mov    %eax,(%rdi)
+  802348:	48 83 c7 04          	add    $0x4,%rdi
+  80234c:	eb a1                	jmp    8022ef <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80234e:	41 f6 c1 04          	test   $0x4,%r9b
+  802352:	74 06                	je     80235a <memset+0x97>
+  802354:	89 07                	mov    %eax,(%rdi)
+  802356:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80235a:	41 f6 c1 02          	test   $0x2,%r9b
+  80235e:	74 07                	je     802367 <memset+0xa4>
+  802360:	66 89 07             	mov    %ax,(%rdi)
+  802363:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802367:	41 f6 c1 01          	test   $0x1,%r9b
+  80236b:	74 9c                	je     802309 <memset+0x46>
+  80236d:	88 07                	mov    %al,(%rdi)
+  80236f:	eb 98                	jmp    802309 <memset+0x46>
+
+0000000000802371 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802371:	48 89 f8             	mov    %rdi,%rax
+  802374:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802377:	48 39 fe             	cmp    %rdi,%rsi
+  80237a:	73 3b                	jae    8023b7 <memmove+0x46>
+  80237c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802380:	48 39 d7             	cmp    %rdx,%rdi
+  802383:	73 32                	jae    8023b7 <memmove+0x46>
+        s += n;
+        d += n;
+  802385:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802389:	48 89 d6             	mov    %rdx,%rsi
+  80238c:	48 09 fe             	or     %rdi,%rsi
+  80238f:	48 09 ce             	or     %rcx,%rsi
+  802392:	40 f6 c6 07          	test   $0x7,%sil
+  802396:	75 12                	jne    8023aa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802398:	48 83 ef 08          	sub    $0x8,%rdi
+  80239c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8023a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8023a4:	fd                   	std
+  8023a5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8023a8:	fc                   	cld
+  8023a9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8023aa:	48 83 ef 01          	sub    $0x1,%rdi
+  8023ae:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8023b2:	fd                   	std
+  8023b3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8023b5:	eb f1                	jmp    8023a8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8023b7:	48 89 f2             	mov    %rsi,%rdx
+  8023ba:	48 09 c2             	or     %rax,%rdx
+  8023bd:	48 09 ca             	or     %rcx,%rdx
+  8023c0:	f6 c2 07             	test   $0x7,%dl
+  8023c3:	75 0c                	jne    8023d1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8023c5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8023c9:	48 89 c7             	mov    %rax,%rdi
+  8023cc:	fc                   	cld
+  8023cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8023d0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8023d1:	48 89 c7             	mov    %rax,%rdi
+  8023d4:	fc                   	cld
+  8023d5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8023d7:	c3                   	ret
+
+00000000008023d8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8023d8:	55                   	push   %rbp
+  8023d9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8023dc:	48 b8 71 23 80 00 00 	movabs $0x802371,%rax
+  8023e3:	00 00 00 
+  8023e6:	ff d0                	call   *%rax
+}
+  8023e8:	5d                   	pop    %rbp
+  8023e9:	c3                   	ret
+
+00000000008023ea <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023ea:	55                   	push   %rbp
+  8023eb:	48 89 e5             	mov    %rsp,%rbp
+  8023ee:	41 57                	push   %r15
+  8023f0:	41 56                	push   %r14
+  8023f2:	41 55                	push   %r13
+  8023f4:	41 54                	push   %r12
+  8023f6:	53                   	push   %rbx
+  8023f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8023fb:	49 89 fe             	mov    %rdi,%r14
+  8023fe:	49 89 f7             	mov    %rsi,%r15
+  802401:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802404:	48 89 f7             	mov    %rsi,%rdi
+  802407:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  80240e:	00 00 00 
+  802411:	ff d0                	call   *%rax
+  802413:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802416:	48 89 de             	mov    %rbx,%rsi
+  802419:	4c 89 f7             	mov    %r14,%rdi
+  80241c:	48 b8 fe 1f 80 00 00 	movabs $0x801ffe,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80242b:	48 39 c3             	cmp    %rax,%rbx
+  80242e:	74 36                	je     802466 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802430:	48 89 d8             	mov    %rbx,%rax
+  802433:	4c 29 e8             	sub    %r13,%rax
+  802436:	49 39 c4             	cmp    %rax,%r12
+  802439:	73 31                	jae    80246c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80243b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802440:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802444:	4c 89 fe             	mov    %r15,%rsi
+  802447:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  80244e:	00 00 00 
+  802451:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802453:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802457:	48 83 c4 08          	add    $0x8,%rsp
+  80245b:	5b                   	pop    %rbx
+  80245c:	41 5c                	pop    %r12
+  80245e:	41 5d                	pop    %r13
+  802460:	41 5e                	pop    %r14
+  802462:	41 5f                	pop    %r15
+  802464:	5d                   	pop    %rbp
+  802465:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802466:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80246a:	eb eb                	jmp    802457 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80246c:	48 83 eb 01          	sub    $0x1,%rbx
+  802470:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802474:	48 89 da             	mov    %rbx,%rdx
+  802477:	4c 89 fe             	mov    %r15,%rsi
+  80247a:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  802481:	00 00 00 
+  802484:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802486:	49 01 de             	add    %rbx,%r14
+  802489:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80248e:	eb c3                	jmp    802453 <strlcat+0x69>
+
+0000000000802490 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802490:	48 85 d2             	test   %rdx,%rdx
+  802493:	74 2d                	je     8024c2 <memcmp+0x32>
+  802495:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80249a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80249e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8024a3:	44 38 c1             	cmp    %r8b,%cl
+  8024a6:	75 0f                	jne    8024b7 <memcmp+0x27>
+    while (n-- > 0) {
+  8024a8:	48 83 c0 01          	add    $0x1,%rax
+  8024ac:	48 39 c2             	cmp    %rax,%rdx
+  8024af:	75 e9                	jne    80249a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8024b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8024b7:	0f b6 c1             	movzbl %cl,%eax
+  8024ba:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8024be:	44 29 c0             	sub    %r8d,%eax
+  8024c1:	c3                   	ret
+    return 0;
+  8024c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024c7:	c3                   	ret
+
+00000000008024c8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8024c8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8024cc:	48 39 c7             	cmp    %rax,%rdi
+  8024cf:	73 0f                	jae    8024e0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8024d1:	40 38 37             	cmp    %sil,(%rdi)
+  8024d4:	74 0e                	je     8024e4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8024d6:	48 83 c7 01          	add    $0x1,%rdi
+  8024da:	48 39 f8             	cmp    %rdi,%rax
+  8024dd:	75 f2                	jne    8024d1 <memfind+0x9>
+  8024df:	c3                   	ret
+  8024e0:	48 89 f8             	mov    %rdi,%rax
+  8024e3:	c3                   	ret
+  8024e4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024e7:	c3                   	ret
+
+00000000008024e8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024e8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024eb:	0f b6 37             	movzbl (%rdi),%esi
+  8024ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8024f2:	74 06                	je     8024fa <strtol+0x12>
+  8024f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8024f8:	75 13                	jne    80250d <strtol+0x25>
+  8024fa:	48 83 c7 01          	add    $0x1,%rdi
+  8024fe:	0f b6 37             	movzbl (%rdi),%esi
+  802501:	40 80 fe 20          	cmp    $0x20,%sil
+  802505:	74 f3                	je     8024fa <strtol+0x12>
+  802507:	40 80 fe 09          	cmp    $0x9,%sil
+  80250b:	74 ed                	je     8024fa <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80250d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802510:	83 e0 fd             	and    $0xfffffffd,%eax
+  802513:	3c 01                	cmp    $0x1,%al
+  802515:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802519:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80251f:	75 0f                	jne    802530 <strtol+0x48>
+  802521:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802524:	74 14                	je     80253a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802526:	85 d2                	test   %edx,%edx
+  802528:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80252d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802530:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802535:	4c 63 ca             	movslq %edx,%r9
+  802538:	eb 36                	jmp    802570 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80253a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80253e:	74 0f                	je     80254f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802540:	85 d2                	test   %edx,%edx
+  802542:	75 ec                	jne    802530 <strtol+0x48>
+        s++;
+  802544:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802548:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80254d:	eb e1                	jmp    802530 <strtol+0x48>
+        s += 2;
+  80254f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802553:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802558:	eb d6                	jmp    802530 <strtol+0x48>
+            dig -= '0';
+  80255a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80255d:	44 0f b6 c1          	movzbl %cl,%r8d
+  802561:	41 39 d0             	cmp    %edx,%r8d
+  802564:	7d 21                	jge    802587 <strtol+0x9f>
+        val = val * base + dig;
+  802566:	49 0f af c1          	imul   %r9,%rax
+  80256a:	0f b6 c9             	movzbl %cl,%ecx
+  80256d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802570:	48 83 c7 01          	add    $0x1,%rdi
+  802574:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802578:	80 f9 39             	cmp    $0x39,%cl
+  80257b:	76 dd                	jbe    80255a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80257d:	80 f9 7b             	cmp    $0x7b,%cl
+  802580:	77 05                	ja     802587 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802582:	83 e9 57             	sub    $0x57,%ecx
+  802585:	eb d6                	jmp    80255d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802587:	4d 85 d2             	test   %r10,%r10
+  80258a:	74 03                	je     80258f <strtol+0xa7>
+  80258c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80258f:	48 89 c2             	mov    %rax,%rdx
+  802592:	48 f7 da             	neg    %rdx
+  802595:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802599:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80259d:	c3                   	ret
+
+000000000080259e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80259e:	55                   	push   %rbp
+  80259f:	48 89 e5             	mov    %rsp,%rbp
+  8025a2:	53                   	push   %rbx
+  8025a3:	48 89 fa             	mov    %rdi,%rdx
+  8025a6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8025a9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025c9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8025cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+
+00000000008025d1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8025d1:	55                   	push   %rbp
+  8025d2:	48 89 e5             	mov    %rsp,%rbp
+  8025d5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8025d6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802600:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802606:	c9                   	leave
+  802607:	c3                   	ret
+
+0000000000802608 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802608:	55                   	push   %rbp
+  802609:	48 89 e5             	mov    %rsp,%rbp
+  80260c:	53                   	push   %rbx
+  80260d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802610:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802615:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80261a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80261f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802624:	be 00 00 00 00       	mov    $0x0,%esi
+  802629:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80262f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802635:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802637:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+
+000000000080263d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80263d:	55                   	push   %rbp
+  80263e:	48 89 e5             	mov    %rsp,%rbp
+  802641:	53                   	push   %rbx
+  802642:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802646:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802649:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80264e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802658:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80265d:	be 00 00 00 00       	mov    $0x0,%esi
+  802662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802668:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80266e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802670:	48 85 c0             	test   %rax,%rax
+  802673:	7f 06                	jg     80267b <sys_env_destroy+0x3e>
+}
+  802675:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802679:	c9                   	leave
+  80267a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80267b:	49 89 c0             	mov    %rax,%r8
+  80267e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802683:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  80268a:	00 00 00 
+  80268d:	be 27 00 00 00       	mov    $0x27,%esi
+  802692:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802699:	00 00 00 
+  80269c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a1:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  8026a8:	00 00 00 
+  8026ab:	41 ff d1             	call   *%r9
+
+00000000008026ae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8026ae:	55                   	push   %rbp
+  8026af:	48 89 e5             	mov    %rsp,%rbp
+  8026b2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026b3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026dd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e3:	c9                   	leave
+  8026e4:	c3                   	ret
+
+00000000008026e5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8026e5:	55                   	push   %rbp
+  8026e6:	48 89 e5             	mov    %rsp,%rbp
+  8026e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026ea:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802703:	be 00 00 00 00       	mov    $0x0,%esi
+  802708:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80270e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802714:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802716:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80271a:	c9                   	leave
+  80271b:	c3                   	ret
+
+000000000080271c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80271c:	55                   	push   %rbp
+  80271d:	48 89 e5             	mov    %rsp,%rbp
+  802720:	53                   	push   %rbx
+  802721:	48 89 fa             	mov    %rdi,%rdx
+  802724:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802727:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80272c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802733:	00 00 00 
+  802736:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80273b:	be 00 00 00 00       	mov    $0x0,%esi
+  802740:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802746:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80274c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80274e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802752:	c9                   	leave
+  802753:	c3                   	ret
+
+0000000000802754 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802754:	55                   	push   %rbp
+  802755:	48 89 e5             	mov    %rsp,%rbp
+  802758:	53                   	push   %rbx
+  802759:	49 89 f8             	mov    %rdi,%r8
+  80275c:	48 89 d3             	mov    %rdx,%rbx
+  80275f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802762:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802767:	4c 89 c2             	mov    %r8,%rdx
+  80276a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80276d:	be 00 00 00 00       	mov    $0x0,%esi
+  802772:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802778:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80277e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802780:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802784:	c9                   	leave
+  802785:	c3                   	ret
+
+0000000000802786 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802786:	55                   	push   %rbp
+  802787:	48 89 e5             	mov    %rsp,%rbp
+  80278a:	53                   	push   %rbx
+  80278b:	48 83 ec 08          	sub    $0x8,%rsp
+  80278f:	89 f8                	mov    %edi,%eax
+  802791:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802794:	48 63 f9             	movslq %ecx,%rdi
+  802797:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80279a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80279f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027b5:	48 85 c0             	test   %rax,%rax
+  8027b8:	7f 06                	jg     8027c0 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8027ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027be:	c9                   	leave
+  8027bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027c0:	49 89 c0             	mov    %rax,%r8
+  8027c3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8027c8:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  8027cf:	00 00 00 
+  8027d2:	be 27 00 00 00       	mov    $0x27,%esi
+  8027d7:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  8027de:	00 00 00 
+  8027e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e6:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  8027ed:	00 00 00 
+  8027f0:	41 ff d1             	call   *%r9
+
+00000000008027f3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027f3:	55                   	push   %rbp
+  8027f4:	48 89 e5             	mov    %rsp,%rbp
+  8027f7:	53                   	push   %rbx
+  8027f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fc:	89 f8                	mov    %edi,%eax
+  8027fe:	49 89 f2             	mov    %rsi,%r10
+  802801:	48 89 cf             	mov    %rcx,%rdi
+  802804:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802807:	48 63 da             	movslq %edx,%rbx
+  80280a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80280d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802812:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802815:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802818:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80281e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802820:	48 85 c0             	test   %rax,%rax
+  802823:	7f 06                	jg     80282b <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802825:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802829:	c9                   	leave
+  80282a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80282b:	49 89 c0             	mov    %rax,%r8
+  80282e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802833:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  80283a:	00 00 00 
+  80283d:	be 27 00 00 00       	mov    $0x27,%esi
+  802842:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802849:	00 00 00 
+  80284c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802851:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802858:	00 00 00 
+  80285b:	41 ff d1             	call   *%r9
+
+000000000080285e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80285e:	55                   	push   %rbp
+  80285f:	48 89 e5             	mov    %rsp,%rbp
+  802862:	53                   	push   %rbx
+  802863:	48 83 ec 08          	sub    $0x8,%rsp
+  802867:	48 89 f1             	mov    %rsi,%rcx
+  80286a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  80286d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802870:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802875:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80287a:	be 00 00 00 00       	mov    $0x0,%esi
+  80287f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802885:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80288b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80288d:	48 85 c0             	test   %rax,%rax
+  802890:	7f 06                	jg     802898 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802892:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802896:	c9                   	leave
+  802897:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802898:	49 89 c0             	mov    %rax,%r8
+  80289b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028a0:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  8028a7:	00 00 00 
+  8028aa:	be 27 00 00 00       	mov    $0x27,%esi
+  8028af:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  8028b6:	00 00 00 
+  8028b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028be:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  8028c5:	00 00 00 
+  8028c8:	41 ff d1             	call   *%r9
+
+00000000008028cb <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8028cb:	55                   	push   %rbp
+  8028cc:	48 89 e5             	mov    %rsp,%rbp
+  8028cf:	53                   	push   %rbx
+  8028d0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  8028d4:	48 63 ce             	movslq %esi,%rcx
+  8028d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028da:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028fc:	48 85 c0             	test   %rax,%rax
+  8028ff:	7f 06                	jg     802907 <sys_env_set_status+0x3c>
+}
+  802901:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802905:	c9                   	leave
+  802906:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802907:	49 89 c0             	mov    %rax,%r8
+  80290a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80290f:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802916:	00 00 00 
+  802919:	be 27 00 00 00       	mov    $0x27,%esi
+  80291e:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802925:	00 00 00 
+  802928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292d:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802934:	00 00 00 
+  802937:	41 ff d1             	call   *%r9
+
+000000000080293a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80293a:	55                   	push   %rbp
+  80293b:	48 89 e5             	mov    %rsp,%rbp
+  80293e:	53                   	push   %rbx
+  80293f:	48 83 ec 08          	sub    $0x8,%rsp
+  802943:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802946:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802949:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80294e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802953:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802958:	be 00 00 00 00       	mov    $0x0,%esi
+  80295d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802963:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802969:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80296b:	48 85 c0             	test   %rax,%rax
+  80296e:	7f 06                	jg     802976 <sys_env_set_trapframe+0x3c>
+}
+  802970:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802974:	c9                   	leave
+  802975:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802976:	49 89 c0             	mov    %rax,%r8
+  802979:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80297e:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802985:	00 00 00 
+  802988:	be 27 00 00 00       	mov    $0x27,%esi
+  80298d:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802994:	00 00 00 
+  802997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299c:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  8029a3:	00 00 00 
+  8029a6:	41 ff d1             	call   *%r9
+
+00000000008029a9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8029a9:	55                   	push   %rbp
+  8029aa:	48 89 e5             	mov    %rsp,%rbp
+  8029ad:	53                   	push   %rbx
+  8029ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  8029b5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029b8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029da:	48 85 c0             	test   %rax,%rax
+  8029dd:	7f 06                	jg     8029e5 <sys_env_set_pgfault_upcall+0x3c>
+}
+  8029df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e3:	c9                   	leave
+  8029e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e5:	49 89 c0             	mov    %rax,%r8
+  8029e8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029ed:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  8029f4:	00 00 00 
+  8029f7:	be 27 00 00 00       	mov    $0x27,%esi
+  8029fc:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802a03:	00 00 00 
+  802a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0b:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802a12:	00 00 00 
+  802a15:	41 ff d1             	call   *%r9
+
+0000000000802a18 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802a18:	55                   	push   %rbp
+  802a19:	48 89 e5             	mov    %rsp,%rbp
+  802a1c:	53                   	push   %rbx
+  802a1d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802a21:	40 0f b6 ce          	movzbl %sil,%ecx
+  802a25:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a28:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a32:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a37:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a42:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a48:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a4a:	48 85 c0             	test   %rax,%rax
+  802a4d:	7f 06                	jg     802a55 <sys_env_set_reclaim+0x3d>
+}
+  802a4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a55:	49 89 c0             	mov    %rax,%r8
+  802a58:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a5d:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802a64:	00 00 00 
+  802a67:	be 27 00 00 00       	mov    $0x27,%esi
+  802a6c:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802a73:	00 00 00 
+  802a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7b:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802a82:	00 00 00 
+  802a85:	41 ff d1             	call   *%r9
+
+0000000000802a88 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a88:	55                   	push   %rbp
+  802a89:	48 89 e5             	mov    %rsp,%rbp
+  802a8c:	53                   	push   %rbx
+  802a8d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a91:	48 63 ce             	movslq %esi,%rcx
+  802a94:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a97:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  802aab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ab9:	48 85 c0             	test   %rax,%rax
+  802abc:	7f 06                	jg     802ac4 <sys_env_set_nice+0x3c>
+}
+  802abe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac2:	c9                   	leave
+  802ac3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ac4:	49 89 c0             	mov    %rax,%r8
+  802ac7:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802acc:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802ad3:	00 00 00 
+  802ad6:	be 27 00 00 00       	mov    $0x27,%esi
+  802adb:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802ae2:	00 00 00 
+  802ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aea:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802af1:	00 00 00 
+  802af4:	41 ff d1             	call   *%r9
+
+0000000000802af7 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802af7:	55                   	push   %rbp
+  802af8:	48 89 e5             	mov    %rsp,%rbp
+  802afb:	53                   	push   %rbx
+  802afc:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aff:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b04:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b13:	be 00 00 00 00       	mov    $0x0,%esi
+  802b18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b24:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802b26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b2a:	c9                   	leave
+  802b2b:	c3                   	ret
+
+0000000000802b2c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b2c:	55                   	push   %rbp
+  802b2d:	48 89 e5             	mov    %rsp,%rbp
+  802b30:	53                   	push   %rbx
+  802b31:	89 f8                	mov    %edi,%eax
+  802b33:	49 89 f1             	mov    %rsi,%r9
+  802b36:	48 89 d3             	mov    %rdx,%rbx
+  802b39:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b3c:	49 63 f0             	movslq %r8d,%rsi
+  802b3f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b42:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b47:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b56:	cd 30                	int    $0x30
+}
+  802b58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+
+0000000000802b5e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b5e:	55                   	push   %rbp
+  802b5f:	48 89 e5             	mov    %rsp,%rbp
+  802b62:	53                   	push   %rbx
+  802b63:	89 f8                	mov    %edi,%eax
+  802b65:	49 89 f1             	mov    %rsi,%r9
+  802b68:	48 89 d3             	mov    %rdx,%rbx
+  802b6b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b6e:	49 63 f0             	movslq %r8d,%rsi
+  802b71:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b74:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b79:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b88:	cd 30                	int    $0x30
+}
+  802b8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b8e:	c9                   	leave
+  802b8f:	c3                   	ret
+
+0000000000802b90 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b90:	55                   	push   %rbp
+  802b91:	48 89 e5             	mov    %rsp,%rbp
+  802b94:	53                   	push   %rbx
+  802b95:	48 83 ec 08          	sub    $0x8,%rsp
+  802b99:	89 f8                	mov    %edi,%eax
+  802b9b:	49 89 f2             	mov    %rsi,%r10
+  802b9e:	48 89 d3             	mov    %rdx,%rbx
+  802ba1:	48 89 cf             	mov    %rcx,%rdi
+  802ba4:	44 89 c6             	mov    %r8d,%esi
+  802ba7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802baa:	48 63 f6             	movslq %esi,%rsi
+  802bad:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bb0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bb5:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802bb8:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802bbc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bbe:	48 85 c0             	test   %rax,%rax
+  802bc1:	7f 06                	jg     802bc9 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802bc3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bc7:	c9                   	leave
+  802bc8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bc9:	49 89 c0             	mov    %rax,%r8
+  802bcc:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802bd1:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802bd8:	00 00 00 
+  802bdb:	be 27 00 00 00       	mov    $0x27,%esi
+  802be0:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802be7:	00 00 00 
+  802bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bef:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802bf6:	00 00 00 
+  802bf9:	41 ff d1             	call   *%r9
+
+0000000000802bfc <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bfc:	55                   	push   %rbp
+  802bfd:	48 89 e5             	mov    %rsp,%rbp
+  802c00:	53                   	push   %rbx
+  802c01:	48 83 ec 08          	sub    $0x8,%rsp
+  802c05:	48 89 f1             	mov    %rsi,%rcx
+  802c08:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802c0b:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802c0f:	48 8b 1a             	mov    (%rdx),%rbx
+  802c12:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c15:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c1a:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c1e:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802c22:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802c26:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c28:	48 85 c0             	test   %rax,%rax
+  802c2b:	7f 06                	jg     802c33 <sys_ipc_call_short+0x37>
+}
+  802c2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c31:	c9                   	leave
+  802c32:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c33:	49 89 c0             	mov    %rax,%r8
+  802c36:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802c3b:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802c42:	00 00 00 
+  802c45:	be 27 00 00 00       	mov    $0x27,%esi
+  802c4a:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802c51:	00 00 00 
+  802c54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c59:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802c60:	00 00 00 
+  802c63:	41 ff d1             	call   *%r9
+
+0000000000802c66 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c66:	55                   	push   %rbp
+  802c67:	48 89 e5             	mov    %rsp,%rbp
+  802c6a:	53                   	push   %rbx
+  802c6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c6f:	89 f8                	mov    %edi,%eax
+  802c71:	49 89 f2             	mov    %rsi,%r10
+  802c74:	48 89 d3             	mov    %rdx,%rbx
+  802c77:	48 89 cf             	mov    %rcx,%rdi
+  802c7a:	44 89 c6             	mov    %r8d,%esi
+  802c7d:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c80:	48 63 f6             	movslq %esi,%rsi
+  802c83:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c86:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c8b:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c8e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c94:	48 85 c0             	test   %rax,%rax
+  802c97:	7f 06                	jg     802c9f <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c9d:	c9                   	leave
+  802c9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c9f:	49 89 c0             	mov    %rax,%r8
+  802ca2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802ca7:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802cae:	00 00 00 
+  802cb1:	be 27 00 00 00       	mov    $0x27,%esi
+  802cb6:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802cbd:	00 00 00 
+  802cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc5:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802ccc:	00 00 00 
+  802ccf:	41 ff d1             	call   *%r9
+
+0000000000802cd2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802cd2:	55                   	push   %rbp
+  802cd3:	48 89 e5             	mov    %rsp,%rbp
+  802cd6:	53                   	push   %rbx
+  802cd7:	48 83 ec 08          	sub    $0x8,%rsp
+  802cdb:	48 89 fa             	mov    %rdi,%rdx
+  802cde:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802ce1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ce6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ceb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cf0:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cfb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d01:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d03:	48 85 c0             	test   %rax,%rax
+  802d06:	7f 06                	jg     802d0e <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d0c:	c9                   	leave
+  802d0d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d0e:	49 89 c0             	mov    %rax,%r8
+  802d11:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802d16:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  802d1d:	00 00 00 
+  802d20:	be 27 00 00 00       	mov    $0x27,%esi
+  802d25:	48 bf c7 61 80 00 00 	movabs $0x8061c7,%rdi
+  802d2c:	00 00 00 
+  802d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d34:	49 b9 ea 53 80 00 00 	movabs $0x8053ea,%r9
+  802d3b:	00 00 00 
+  802d3e:	41 ff d1             	call   *%r9
+
+0000000000802d41 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802d41:	55                   	push   %rbp
+  802d42:	48 89 e5             	mov    %rsp,%rbp
+  802d45:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d46:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d64:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d6a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d70:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d76:	c9                   	leave
+  802d77:	c3                   	ret
+
+0000000000802d78 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d78:	55                   	push   %rbp
+  802d79:	48 89 e5             	mov    %rsp,%rbp
+  802d7c:	53                   	push   %rbx
+  802d7d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d80:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d85:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d8f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d94:	be 00 00 00 00       	mov    $0x0,%esi
+  802d99:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d9f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da5:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802da7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dab:	c9                   	leave
+  802dac:	c3                   	ret
+
+0000000000802dad <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802dad:	55                   	push   %rbp
+  802dae:	48 89 e5             	mov    %rsp,%rbp
+  802db1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802db2:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dc6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dcb:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dd6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ddc:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802dde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de2:	c9                   	leave
+  802de3:	c3                   	ret
+
+0000000000802de4 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  802de4:	55                   	push   %rbp
+  802de5:	48 89 e5             	mov    %rsp,%rbp
+  802de8:	41 56                	push   %r14
+  802dea:	41 55                	push   %r13
+  802dec:	41 54                	push   %r12
+  802dee:	53                   	push   %rbx
+  802def:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802df2:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  802df9:	00 00 00 
+  802dfc:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802e00:	74 27                	je     802e29 <_handle_vectored_pagefault+0x45>
+  802e02:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802e07:	49 bd 40 80 80 01 00 	movabs $0x1808040,%r13
+  802e0e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802e11:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  802e14:	4c 89 e7             	mov    %r12,%rdi
+  802e17:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802e1c:	84 c0                	test   %al,%al
+  802e1e:	75 45                	jne    802e65 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802e20:	48 83 c3 01          	add    $0x1,%rbx
+  802e24:	49 3b 1e             	cmp    (%r14),%rbx
+  802e27:	72 eb                	jb     802e14 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  802e29:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802e30:	00 
+  802e31:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  802e36:	4d 8b 04 24          	mov    (%r12),%r8
+  802e3a:	48 ba d8 61 80 00 00 	movabs $0x8061d8,%rdx
+  802e41:	00 00 00 
+  802e44:	be 1d 00 00 00       	mov    $0x1d,%esi
+  802e49:	48 bf 08 62 80 00 00 	movabs $0x806208,%rdi
+  802e50:	00 00 00 
+  802e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e58:	49 ba ea 53 80 00 00 	movabs $0x8053ea,%r10
+  802e5f:	00 00 00 
+  802e62:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  802e65:	5b                   	pop    %rbx
+  802e66:	41 5c                	pop    %r12
+  802e68:	41 5d                	pop    %r13
+  802e6a:	41 5e                	pop    %r14
+  802e6c:	5d                   	pop    %rbp
+  802e6d:	c3                   	ret
+
+0000000000802e6e <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802e6e:	55                   	push   %rbp
+  802e6f:	48 89 e5             	mov    %rsp,%rbp
+  802e72:	53                   	push   %rbx
+  802e73:	48 83 ec 08          	sub    $0x8,%rsp
+  802e77:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  802e7a:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  802e7f:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  802e86:	00 00 00 
+  802e89:	80 38 00             	cmpb   $0x0,(%rax)
+  802e8c:	74 68                	je     802ef6 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802e8e:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  802e95:	00 00 00 
+  802e98:	48 8b 08             	mov    (%rax),%rcx
+  802e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  802ea0:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  802ea7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802eaa:	48 85 c9             	test   %rcx,%rcx
+  802ead:	0f 84 e0 00 00 00    	je     802f93 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802eb3:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  802eb7:	0f 84 c9 00 00 00    	je     802f86 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802ebd:	48 83 c2 01          	add    $0x1,%rdx
+  802ec1:	48 39 ca             	cmp    %rcx,%rdx
+  802ec4:	75 ed                	jne    802eb3 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802ec6:	48 83 f9 08          	cmp    $0x8,%rcx
+  802eca:	0f 84 84 00 00 00    	je     802f54 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802ed0:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  802ed4:	48 a3 88 80 80 01 00 	movabs %rax,0x1808088
+  802edb:	00 00 00 
+  802ede:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  802ee5:	00 00 00 
+  802ee8:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802eec:	85 f6                	test   %esi,%esi
+  802eee:	0f 89 97 00 00 00    	jns    802f8b <add_pgfault_handler+0x11d>
+  802ef4:	eb 63                	jmp    802f59 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  802ef6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802efb:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802f00:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  802f07:	00 00 00 
+  802f0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f0f:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  802f16:	00 00 00 
+  802f19:	ff d0                	call   *%rax
+  802f1b:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  802f1d:	85 c0                	test   %eax,%eax
+  802f1f:	78 38                	js     802f59 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802f21:	48 be 6f 30 80 00 00 	movabs $0x80306f,%rsi
+  802f28:	00 00 00 
+  802f2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f30:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  802f37:	00 00 00 
+  802f3a:	ff d0                	call   *%rax
+  802f3c:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  802f3e:	85 c0                	test   %eax,%eax
+  802f40:	78 17                	js     802f59 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  802f42:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  802f49:	00 00 00 
+  802f4c:	c6 00 01             	movb   $0x1,(%rax)
+  802f4f:	e9 3a ff ff ff       	jmp    802e8e <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  802f54:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802f59:	89 f1                	mov    %esi,%ecx
+  802f5b:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  802f62:	00 00 00 
+  802f65:	be 42 00 00 00       	mov    $0x42,%esi
+  802f6a:	48 bf 08 62 80 00 00 	movabs $0x806208,%rdi
+  802f71:	00 00 00 
+  802f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f79:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  802f80:	00 00 00 
+  802f83:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  802f86:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  802f8b:	89 f0                	mov    %esi,%eax
+  802f8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f91:	c9                   	leave
+  802f92:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802f93:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  802f9a:	00 00 00 
+  802f9d:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  802fa4:	48 89 d8             	mov    %rbx,%rax
+  802fa7:	48 a3 40 80 80 01 00 	movabs %rax,0x1808040
+  802fae:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802fb1:	eb d8                	jmp    802f8b <add_pgfault_handler+0x11d>
+
+0000000000802fb3 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802fb3:	55                   	push   %rbp
+  802fb4:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802fb7:	48 b8 80 80 80 01 00 	movabs $0x1808080,%rax
+  802fbe:	00 00 00 
+  802fc1:	80 38 00             	cmpb   $0x0,(%rax)
+  802fc4:	74 33                	je     802ff9 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802fc6:	48 a1 88 80 80 01 00 	movabs 0x1808088,%rax
+  802fcd:	00 00 00 
+  802fd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802fd5:	48 ba 40 80 80 01 00 	movabs $0x1808040,%rdx
+  802fdc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802fdf:	48 85 c0             	test   %rax,%rax
+  802fe2:	0f 84 85 00 00 00    	je     80306d <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  802fe8:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  802fec:	74 40                	je     80302e <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802fee:	48 83 c1 01          	add    $0x1,%rcx
+  802ff2:	48 39 c1             	cmp    %rax,%rcx
+  802ff5:	75 f1                	jne    802fe8 <remove_pgfault_handler+0x35>
+  802ff7:	eb 74                	jmp    80306d <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  802ff9:	48 b9 2e 62 80 00 00 	movabs $0x80622e,%rcx
+  803000:	00 00 00 
+  803003:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  80300a:	00 00 00 
+  80300d:	be 48 00 00 00       	mov    $0x48,%esi
+  803012:	48 bf 08 62 80 00 00 	movabs $0x806208,%rdi
+  803019:	00 00 00 
+  80301c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803021:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  803028:	00 00 00 
+  80302b:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80302e:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803035:	00 
+  803036:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80303a:	48 29 ca             	sub    %rcx,%rdx
+  80303d:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  803044:	00 00 00 
+  803047:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80304b:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803050:	48 89 ce             	mov    %rcx,%rsi
+  803053:	48 b8 71 23 80 00 00 	movabs $0x802371,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80305f:	48 b8 88 80 80 01 00 	movabs $0x1808088,%rax
+  803066:	00 00 00 
+  803069:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80306d:	5d                   	pop    %rbp
+  80306e:	c3                   	ret
+
+000000000080306f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80306f:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  803072:	48 b8 e4 2d 80 00 00 	movabs $0x802de4,%rax
+  803079:	00 00 00 
+    call *%rax
+  80307c:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  80307e:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  803085:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  803086:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  80308d:	00 
+    subq $8, %rcx
+  80308e:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  803092:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  803095:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80309c:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  80309d:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8030a1:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8030a5:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8030aa:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8030af:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8030b4:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8030b9:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8030be:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8030c3:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8030c8:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8030cd:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8030d2:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8030d7:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8030dc:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8030e1:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8030e6:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8030eb:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8030ef:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8030f3:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8030f4:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8030f5:	c3                   	ret
+
+00000000008030f6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030f6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8030fd:	ff ff ff 
+  803100:	48 01 f8             	add    %rdi,%rax
+  803103:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803107:	c3                   	ret
+
+0000000000803108 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803108:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80310f:	ff ff ff 
+  803112:	48 01 f8             	add    %rdi,%rax
+  803115:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803119:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80311f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803123:	c3                   	ret
+
+0000000000803124 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803124:	55                   	push   %rbp
+  803125:	48 89 e5             	mov    %rsp,%rbp
+  803128:	41 57                	push   %r15
+  80312a:	41 56                	push   %r14
+  80312c:	41 55                	push   %r13
+  80312e:	41 54                	push   %r12
+  803130:	53                   	push   %rbx
+  803131:	48 83 ec 08          	sub    $0x8,%rsp
+  803135:	49 89 ff             	mov    %rdi,%r15
+  803138:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80313d:	49 bd 24 46 80 00 00 	movabs $0x804624,%r13
+  803144:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803147:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80314d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803150:	48 89 df             	mov    %rbx,%rdi
+  803153:	41 ff d5             	call   *%r13
+  803156:	83 e0 04             	and    $0x4,%eax
+  803159:	74 17                	je     803172 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80315b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803162:	4c 39 f3             	cmp    %r14,%rbx
+  803165:	75 e6                	jne    80314d <fd_alloc+0x29>
+  803167:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80316d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803172:	4d 89 27             	mov    %r12,(%r15)
+}
+  803175:	48 83 c4 08          	add    $0x8,%rsp
+  803179:	5b                   	pop    %rbx
+  80317a:	41 5c                	pop    %r12
+  80317c:	41 5d                	pop    %r13
+  80317e:	41 5e                	pop    %r14
+  803180:	41 5f                	pop    %r15
+  803182:	5d                   	pop    %rbp
+  803183:	c3                   	ret
+
+0000000000803184 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803184:	83 ff 1f             	cmp    $0x1f,%edi
+  803187:	77 39                	ja     8031c2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803189:	55                   	push   %rbp
+  80318a:	48 89 e5             	mov    %rsp,%rbp
+  80318d:	41 54                	push   %r12
+  80318f:	53                   	push   %rbx
+  803190:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803193:	48 63 df             	movslq %edi,%rbx
+  803196:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80319d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8031a1:	48 89 df             	mov    %rbx,%rdi
+  8031a4:	48 b8 24 46 80 00 00 	movabs $0x804624,%rax
+  8031ab:	00 00 00 
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	a8 04                	test   $0x4,%al
+  8031b2:	74 14                	je     8031c8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8031b4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8031b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031bd:	5b                   	pop    %rbx
+  8031be:	41 5c                	pop    %r12
+  8031c0:	5d                   	pop    %rbp
+  8031c1:	c3                   	ret
+        return -E_INVAL;
+  8031c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8031c7:	c3                   	ret
+        return -E_INVAL;
+  8031c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031cd:	eb ee                	jmp    8031bd <fd_lookup+0x39>
+
+00000000008031cf <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8031cf:	55                   	push   %rbp
+  8031d0:	48 89 e5             	mov    %rsp,%rbp
+  8031d3:	41 54                	push   %r12
+  8031d5:	53                   	push   %rbx
+  8031d6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8031d9:	48 b8 e0 62 80 00 00 	movabs $0x8062e0,%rax
+  8031e0:	00 00 00 
+  8031e3:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8031ea:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8031ed:	39 3b                	cmp    %edi,(%rbx)
+  8031ef:	74 47                	je     803238 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8031f1:	48 83 c0 08          	add    $0x8,%rax
+  8031f5:	48 8b 18             	mov    (%rax),%rbx
+  8031f8:	48 85 db             	test   %rbx,%rbx
+  8031fb:	75 f0                	jne    8031ed <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8031fd:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803204:	00 00 00 
+  803207:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80320d:	89 fa                	mov    %edi,%edx
+  80320f:	48 bf 60 62 80 00 00 	movabs $0x806260,%rdi
+  803216:	00 00 00 
+  803219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321e:	48 b9 ea 16 80 00 00 	movabs $0x8016ea,%rcx
+  803225:	00 00 00 
+  803228:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80322a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80322f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803233:	5b                   	pop    %rbx
+  803234:	41 5c                	pop    %r12
+  803236:	5d                   	pop    %rbp
+  803237:	c3                   	ret
+            return 0;
+  803238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80323d:	eb f0                	jmp    80322f <dev_lookup+0x60>
+
+000000000080323f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80323f:	55                   	push   %rbp
+  803240:	48 89 e5             	mov    %rsp,%rbp
+  803243:	41 55                	push   %r13
+  803245:	41 54                	push   %r12
+  803247:	53                   	push   %rbx
+  803248:	48 83 ec 18          	sub    $0x18,%rsp
+  80324c:	48 89 fb             	mov    %rdi,%rbx
+  80324f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803252:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803259:	ff ff ff 
+  80325c:	48 01 df             	add    %rbx,%rdi
+  80325f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803263:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803267:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  80326e:	00 00 00 
+  803271:	ff d0                	call   *%rax
+  803273:	41 89 c5             	mov    %eax,%r13d
+  803276:	85 c0                	test   %eax,%eax
+  803278:	78 06                	js     803280 <fd_close+0x41>
+  80327a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80327e:	74 1a                	je     80329a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803280:	45 84 e4             	test   %r12b,%r12b
+  803283:	b8 00 00 00 00       	mov    $0x0,%eax
+  803288:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80328c:	44 89 e8             	mov    %r13d,%eax
+  80328f:	48 83 c4 18          	add    $0x18,%rsp
+  803293:	5b                   	pop    %rbx
+  803294:	41 5c                	pop    %r12
+  803296:	41 5d                	pop    %r13
+  803298:	5d                   	pop    %rbp
+  803299:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80329a:	8b 3b                	mov    (%rbx),%edi
+  80329c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8032a0:	48 b8 cf 31 80 00 00 	movabs $0x8031cf,%rax
+  8032a7:	00 00 00 
+  8032aa:	ff d0                	call   *%rax
+  8032ac:	41 89 c5             	mov    %eax,%r13d
+  8032af:	85 c0                	test   %eax,%eax
+  8032b1:	78 1b                	js     8032ce <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8032b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032b7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8032bb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8032c1:	48 85 c0             	test   %rax,%rax
+  8032c4:	74 08                	je     8032ce <fd_close+0x8f>
+  8032c6:	48 89 df             	mov    %rbx,%rdi
+  8032c9:	ff d0                	call   *%rax
+  8032cb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8032ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032d3:	48 89 de             	mov    %rbx,%rsi
+  8032d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032db:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8032e2:	00 00 00 
+  8032e5:	ff d0                	call   *%rax
+    return res;
+  8032e7:	eb a3                	jmp    80328c <fd_close+0x4d>
+
+00000000008032e9 <close>:
+
+int
+close(int fdnum) {
+  8032e9:	55                   	push   %rbp
+  8032ea:	48 89 e5             	mov    %rsp,%rbp
+  8032ed:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032f5:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  8032fc:	00 00 00 
+  8032ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803301:	85 c0                	test   %eax,%eax
+  803303:	78 15                	js     80331a <close+0x31>
+
+    return fd_close(fd, 1);
+  803305:	be 01 00 00 00       	mov    $0x1,%esi
+  80330a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80330e:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  803315:	00 00 00 
+  803318:	ff d0                	call   *%rax
+}
+  80331a:	c9                   	leave
+  80331b:	c3                   	ret
+
+000000000080331c <close_all>:
+
+void
+close_all(void) {
+  80331c:	55                   	push   %rbp
+  80331d:	48 89 e5             	mov    %rsp,%rbp
+  803320:	41 54                	push   %r12
+  803322:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803323:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803328:	49 bc e9 32 80 00 00 	movabs $0x8032e9,%r12
+  80332f:	00 00 00 
+  803332:	89 df                	mov    %ebx,%edi
+  803334:	41 ff d4             	call   *%r12
+  803337:	83 c3 01             	add    $0x1,%ebx
+  80333a:	83 fb 20             	cmp    $0x20,%ebx
+  80333d:	75 f3                	jne    803332 <close_all+0x16>
+}
+  80333f:	5b                   	pop    %rbx
+  803340:	41 5c                	pop    %r12
+  803342:	5d                   	pop    %rbp
+  803343:	c3                   	ret
+
+0000000000803344 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803344:	55                   	push   %rbp
+  803345:	48 89 e5             	mov    %rsp,%rbp
+  803348:	41 57                	push   %r15
+  80334a:	41 56                	push   %r14
+  80334c:	41 55                	push   %r13
+  80334e:	41 54                	push   %r12
+  803350:	53                   	push   %rbx
+  803351:	48 83 ec 18          	sub    $0x18,%rsp
+  803355:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803358:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80335c:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  803363:	00 00 00 
+  803366:	ff d0                	call   *%rax
+  803368:	89 c3                	mov    %eax,%ebx
+  80336a:	85 c0                	test   %eax,%eax
+  80336c:	0f 88 b8 00 00 00    	js     80342a <dup+0xe6>
+    close(newfdnum);
+  803372:	44 89 e7             	mov    %r12d,%edi
+  803375:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803381:	4d 63 ec             	movslq %r12d,%r13
+  803384:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80338b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80338f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803393:	4c 89 ff             	mov    %r15,%rdi
+  803396:	49 be 08 31 80 00 00 	movabs $0x803108,%r14
+  80339d:	00 00 00 
+  8033a0:	41 ff d6             	call   *%r14
+  8033a3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8033a6:	4c 89 ef             	mov    %r13,%rdi
+  8033a9:	41 ff d6             	call   *%r14
+  8033ac:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8033af:	48 89 df             	mov    %rbx,%rdi
+  8033b2:	48 b8 24 46 80 00 00 	movabs $0x804624,%rax
+  8033b9:	00 00 00 
+  8033bc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8033be:	a8 04                	test   $0x4,%al
+  8033c0:	74 2b                	je     8033ed <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8033c2:	41 89 c1             	mov    %eax,%r9d
+  8033c5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033cb:	4c 89 f1             	mov    %r14,%rcx
+  8033ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033d3:	48 89 de             	mov    %rbx,%rsi
+  8033d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033db:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  8033e2:	00 00 00 
+  8033e5:	ff d0                	call   *%rax
+  8033e7:	89 c3                	mov    %eax,%ebx
+  8033e9:	85 c0                	test   %eax,%eax
+  8033eb:	78 4e                	js     80343b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8033ed:	4c 89 ff             	mov    %r15,%rdi
+  8033f0:	48 b8 24 46 80 00 00 	movabs $0x804624,%rax
+  8033f7:	00 00 00 
+  8033fa:	ff d0                	call   *%rax
+  8033fc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8033ff:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803405:	4c 89 e9             	mov    %r13,%rcx
+  803408:	ba 00 00 00 00       	mov    $0x0,%edx
+  80340d:	4c 89 fe             	mov    %r15,%rsi
+  803410:	bf 00 00 00 00       	mov    $0x0,%edi
+  803415:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  80341c:	00 00 00 
+  80341f:	ff d0                	call   *%rax
+  803421:	89 c3                	mov    %eax,%ebx
+  803423:	85 c0                	test   %eax,%eax
+  803425:	78 14                	js     80343b <dup+0xf7>
+
+    return newfdnum;
+  803427:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80342a:	89 d8                	mov    %ebx,%eax
+  80342c:	48 83 c4 18          	add    $0x18,%rsp
+  803430:	5b                   	pop    %rbx
+  803431:	41 5c                	pop    %r12
+  803433:	41 5d                	pop    %r13
+  803435:	41 5e                	pop    %r14
+  803437:	41 5f                	pop    %r15
+  803439:	5d                   	pop    %rbp
+  80343a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80343b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803440:	4c 89 ee             	mov    %r13,%rsi
+  803443:	bf 00 00 00 00       	mov    $0x0,%edi
+  803448:	49 bc 5e 28 80 00 00 	movabs $0x80285e,%r12
+  80344f:	00 00 00 
+  803452:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803455:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80345a:	4c 89 f6             	mov    %r14,%rsi
+  80345d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803462:	41 ff d4             	call   *%r12
+    return res;
+  803465:	eb c3                	jmp    80342a <dup+0xe6>
+
+0000000000803467 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803467:	55                   	push   %rbp
+  803468:	48 89 e5             	mov    %rsp,%rbp
+  80346b:	41 56                	push   %r14
+  80346d:	41 55                	push   %r13
+  80346f:	41 54                	push   %r12
+  803471:	53                   	push   %rbx
+  803472:	48 83 ec 10          	sub    $0x10,%rsp
+  803476:	89 fb                	mov    %edi,%ebx
+  803478:	49 89 f4             	mov    %rsi,%r12
+  80347b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80347e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803482:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  803489:	00 00 00 
+  80348c:	ff d0                	call   *%rax
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	78 4c                	js     8034de <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803492:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803496:	41 8b 3e             	mov    (%r14),%edi
+  803499:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80349d:	48 b8 cf 31 80 00 00 	movabs $0x8031cf,%rax
+  8034a4:	00 00 00 
+  8034a7:	ff d0                	call   *%rax
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	78 35                	js     8034e2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8034ad:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8034b1:	83 e0 03             	and    $0x3,%eax
+  8034b4:	83 f8 01             	cmp    $0x1,%eax
+  8034b7:	74 2d                	je     8034e6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8034b9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034bd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8034c1:	48 85 c0             	test   %rax,%rax
+  8034c4:	74 56                	je     80351c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8034c6:	4c 89 ea             	mov    %r13,%rdx
+  8034c9:	4c 89 e6             	mov    %r12,%rsi
+  8034cc:	4c 89 f7             	mov    %r14,%rdi
+  8034cf:	ff d0                	call   *%rax
+}
+  8034d1:	48 83 c4 10          	add    $0x10,%rsp
+  8034d5:	5b                   	pop    %rbx
+  8034d6:	41 5c                	pop    %r12
+  8034d8:	41 5d                	pop    %r13
+  8034da:	41 5e                	pop    %r14
+  8034dc:	5d                   	pop    %rbp
+  8034dd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034de:	48 98                	cltq
+  8034e0:	eb ef                	jmp    8034d1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034e2:	48 98                	cltq
+  8034e4:	eb eb                	jmp    8034d1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034e6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034ed:	00 00 00 
+  8034f0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034f6:	89 da                	mov    %ebx,%edx
+  8034f8:	48 bf a1 62 80 00 00 	movabs $0x8062a1,%rdi
+  8034ff:	00 00 00 
+  803502:	b8 00 00 00 00       	mov    $0x0,%eax
+  803507:	48 b9 ea 16 80 00 00 	movabs $0x8016ea,%rcx
+  80350e:	00 00 00 
+  803511:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803513:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80351a:	eb b5                	jmp    8034d1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80351c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803523:	eb ac                	jmp    8034d1 <read+0x6a>
+
+0000000000803525 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803525:	55                   	push   %rbp
+  803526:	48 89 e5             	mov    %rsp,%rbp
+  803529:	41 57                	push   %r15
+  80352b:	41 56                	push   %r14
+  80352d:	41 55                	push   %r13
+  80352f:	41 54                	push   %r12
+  803531:	53                   	push   %rbx
+  803532:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803536:	48 85 d2             	test   %rdx,%rdx
+  803539:	74 54                	je     80358f <readn+0x6a>
+  80353b:	41 89 fd             	mov    %edi,%r13d
+  80353e:	49 89 f6             	mov    %rsi,%r14
+  803541:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803544:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803549:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80354e:	49 bf 67 34 80 00 00 	movabs $0x803467,%r15
+  803555:	00 00 00 
+  803558:	4c 89 e2             	mov    %r12,%rdx
+  80355b:	48 29 f2             	sub    %rsi,%rdx
+  80355e:	4c 01 f6             	add    %r14,%rsi
+  803561:	44 89 ef             	mov    %r13d,%edi
+  803564:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803567:	85 c0                	test   %eax,%eax
+  803569:	78 20                	js     80358b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80356b:	01 c3                	add    %eax,%ebx
+  80356d:	85 c0                	test   %eax,%eax
+  80356f:	74 08                	je     803579 <readn+0x54>
+  803571:	48 63 f3             	movslq %ebx,%rsi
+  803574:	4c 39 e6             	cmp    %r12,%rsi
+  803577:	72 df                	jb     803558 <readn+0x33>
+    }
+    return res;
+  803579:	48 63 c3             	movslq %ebx,%rax
+}
+  80357c:	48 83 c4 08          	add    $0x8,%rsp
+  803580:	5b                   	pop    %rbx
+  803581:	41 5c                	pop    %r12
+  803583:	41 5d                	pop    %r13
+  803585:	41 5e                	pop    %r14
+  803587:	41 5f                	pop    %r15
+  803589:	5d                   	pop    %rbp
+  80358a:	c3                   	ret
+        if (inc < 0) return inc;
+  80358b:	48 98                	cltq
+  80358d:	eb ed                	jmp    80357c <readn+0x57>
+    int inc = 1, res = 0;
+  80358f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803594:	eb e3                	jmp    803579 <readn+0x54>
+
+0000000000803596 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803596:	55                   	push   %rbp
+  803597:	48 89 e5             	mov    %rsp,%rbp
+  80359a:	41 56                	push   %r14
+  80359c:	41 55                	push   %r13
+  80359e:	41 54                	push   %r12
+  8035a0:	53                   	push   %rbx
+  8035a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8035a5:	89 fb                	mov    %edi,%ebx
+  8035a7:	49 89 f4             	mov    %rsi,%r12
+  8035aa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035ad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035b1:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  8035b8:	00 00 00 
+  8035bb:	ff d0                	call   *%rax
+  8035bd:	85 c0                	test   %eax,%eax
+  8035bf:	78 47                	js     803608 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035c1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8035c5:	41 8b 3e             	mov    (%r14),%edi
+  8035c8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035cc:	48 b8 cf 31 80 00 00 	movabs $0x8031cf,%rax
+  8035d3:	00 00 00 
+  8035d6:	ff d0                	call   *%rax
+  8035d8:	85 c0                	test   %eax,%eax
+  8035da:	78 30                	js     80360c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035dc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8035e1:	74 2d                	je     803610 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8035e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035e7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035eb:	48 85 c0             	test   %rax,%rax
+  8035ee:	74 56                	je     803646 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8035f0:	4c 89 ea             	mov    %r13,%rdx
+  8035f3:	4c 89 e6             	mov    %r12,%rsi
+  8035f6:	4c 89 f7             	mov    %r14,%rdi
+  8035f9:	ff d0                	call   *%rax
+}
+  8035fb:	48 83 c4 10          	add    $0x10,%rsp
+  8035ff:	5b                   	pop    %rbx
+  803600:	41 5c                	pop    %r12
+  803602:	41 5d                	pop    %r13
+  803604:	41 5e                	pop    %r14
+  803606:	5d                   	pop    %rbp
+  803607:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803608:	48 98                	cltq
+  80360a:	eb ef                	jmp    8035fb <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80360c:	48 98                	cltq
+  80360e:	eb eb                	jmp    8035fb <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803610:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803617:	00 00 00 
+  80361a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803620:	89 da                	mov    %ebx,%edx
+  803622:	48 bf bd 62 80 00 00 	movabs $0x8062bd,%rdi
+  803629:	00 00 00 
+  80362c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803631:	48 b9 ea 16 80 00 00 	movabs $0x8016ea,%rcx
+  803638:	00 00 00 
+  80363b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80363d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803644:	eb b5                	jmp    8035fb <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803646:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80364d:	eb ac                	jmp    8035fb <write+0x65>
+
+000000000080364f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80364f:	55                   	push   %rbp
+  803650:	48 89 e5             	mov    %rsp,%rbp
+  803653:	53                   	push   %rbx
+  803654:	48 83 ec 18          	sub    $0x18,%rsp
+  803658:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80365a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80365e:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  803665:	00 00 00 
+  803668:	ff d0                	call   *%rax
+  80366a:	85 c0                	test   %eax,%eax
+  80366c:	78 0c                	js     80367a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80366e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803672:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803675:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80367a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80367e:	c9                   	leave
+  80367f:	c3                   	ret
+
+0000000000803680 <tell>:
+
+int tell(int fdnum) {
+  803680:	55                   	push   %rbp
+  803681:	48 89 e5             	mov    %rsp,%rbp
+  803684:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803688:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80368c:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+  803698:	85 c0                	test   %eax,%eax
+  80369a:	78 07                	js     8036a3 <tell+0x23>
+
+    return fd->fd_offset;
+  80369c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036a0:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8036a3:	c9                   	leave
+  8036a4:	c3                   	ret
+
+00000000008036a5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8036a5:	55                   	push   %rbp
+  8036a6:	48 89 e5             	mov    %rsp,%rbp
+  8036a9:	41 55                	push   %r13
+  8036ab:	41 54                	push   %r12
+  8036ad:	53                   	push   %rbx
+  8036ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8036b2:	89 fb                	mov    %edi,%ebx
+  8036b4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036bb:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+  8036c7:	85 c0                	test   %eax,%eax
+  8036c9:	78 38                	js     803703 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036cb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8036cf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8036d3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036d7:	48 b8 cf 31 80 00 00 	movabs $0x8031cf,%rax
+  8036de:	00 00 00 
+  8036e1:	ff d0                	call   *%rax
+  8036e3:	85 c0                	test   %eax,%eax
+  8036e5:	78 1c                	js     803703 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036e7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8036ec:	74 20                	je     80370e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8036ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036f2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8036f6:	48 85 c0             	test   %rax,%rax
+  8036f9:	74 47                	je     803742 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8036fb:	44 89 e6             	mov    %r12d,%esi
+  8036fe:	4c 89 ef             	mov    %r13,%rdi
+  803701:	ff d0                	call   *%rax
+}
+  803703:	48 83 c4 18          	add    $0x18,%rsp
+  803707:	5b                   	pop    %rbx
+  803708:	41 5c                	pop    %r12
+  80370a:	41 5d                	pop    %r13
+  80370c:	5d                   	pop    %rbp
+  80370d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80370e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803715:	00 00 00 
+  803718:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80371e:	89 da                	mov    %ebx,%edx
+  803720:	48 bf 80 62 80 00 00 	movabs $0x806280,%rdi
+  803727:	00 00 00 
+  80372a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372f:	48 b9 ea 16 80 00 00 	movabs $0x8016ea,%rcx
+  803736:	00 00 00 
+  803739:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80373b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803740:	eb c1                	jmp    803703 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803742:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803747:	eb ba                	jmp    803703 <ftruncate+0x5e>
+
+0000000000803749 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803749:	55                   	push   %rbp
+  80374a:	48 89 e5             	mov    %rsp,%rbp
+  80374d:	41 54                	push   %r12
+  80374f:	53                   	push   %rbx
+  803750:	48 83 ec 10          	sub    $0x10,%rsp
+  803754:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803757:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80375b:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  803762:	00 00 00 
+  803765:	ff d0                	call   *%rax
+  803767:	85 c0                	test   %eax,%eax
+  803769:	78 63                	js     8037ce <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80376b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80376f:	41 8b 3c 24          	mov    (%r12),%edi
+  803773:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803777:	48 b8 cf 31 80 00 00 	movabs $0x8031cf,%rax
+  80377e:	00 00 00 
+  803781:	ff d0                	call   *%rax
+  803783:	85 c0                	test   %eax,%eax
+  803785:	78 47                	js     8037ce <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803787:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80378b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803790:	74 45                	je     8037d7 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803792:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803795:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80379c:	00 00 00 
+    stat->st_isdir = 0;
+  80379f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037a6:	00 00 00 
+    stat->st_ino = 0;
+  8037a9:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8037b0:	00 00 00 00 
+    stat->st_version = 0;
+  8037b4:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8037bb:	00 00 00 
+    stat->st_dev = dev;
+  8037be:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8037c5:	48 89 de             	mov    %rbx,%rsi
+  8037c8:	4c 89 e7             	mov    %r12,%rdi
+  8037cb:	ff 50 28             	call   *0x28(%rax)
+}
+  8037ce:	48 83 c4 10          	add    $0x10,%rsp
+  8037d2:	5b                   	pop    %rbx
+  8037d3:	41 5c                	pop    %r12
+  8037d5:	5d                   	pop    %rbp
+  8037d6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8037d7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037dc:	eb f0                	jmp    8037ce <fstat+0x85>
+
+00000000008037de <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8037de:	55                   	push   %rbp
+  8037df:	48 89 e5             	mov    %rsp,%rbp
+  8037e2:	41 54                	push   %r12
+  8037e4:	53                   	push   %rbx
+  8037e5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8037e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ed:	48 b8 ff 3c 80 00 00 	movabs $0x803cff,%rax
+  8037f4:	00 00 00 
+  8037f7:	ff d0                	call   *%rax
+  8037f9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8037fb:	85 c0                	test   %eax,%eax
+  8037fd:	78 25                	js     803824 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8037ff:	4c 89 e6             	mov    %r12,%rsi
+  803802:	89 c7                	mov    %eax,%edi
+  803804:	48 b8 49 37 80 00 00 	movabs $0x803749,%rax
+  80380b:	00 00 00 
+  80380e:	ff d0                	call   *%rax
+  803810:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803813:	89 df                	mov    %ebx,%edi
+  803815:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  80381c:	00 00 00 
+  80381f:	ff d0                	call   *%rax
+
+    return res;
+  803821:	44 89 e3             	mov    %r12d,%ebx
+}
+  803824:	89 d8                	mov    %ebx,%eax
+  803826:	5b                   	pop    %rbx
+  803827:	41 5c                	pop    %r12
+  803829:	5d                   	pop    %rbp
+  80382a:	c3                   	ret
+
+000000000080382b <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80382b:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803832:	00 00 00 
+  803835:	83 38 00             	cmpl   $0x0,(%rax)
+  803838:	74 0a                	je     803844 <fsipc_env+0x19>
+    return fsenv;
+}
+  80383a:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803841:	00 00 
+  803843:	c3                   	ret
+fsipc_env(void) {
+  803844:	55                   	push   %rbp
+  803845:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803848:	bf 03 00 00 00       	mov    $0x3,%edi
+  80384d:	48 b8 bf 56 80 00 00 	movabs $0x8056bf,%rax
+  803854:	00 00 00 
+  803857:	ff d0                	call   *%rax
+  803859:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803860:	00 00 
+}
+  803862:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803869:	00 00 
+  80386b:	5d                   	pop    %rbp
+  80386c:	c3                   	ret
+
+000000000080386d <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80386d:	55                   	push   %rbp
+  80386e:	48 89 e5             	mov    %rsp,%rbp
+  803871:	53                   	push   %rbx
+  803872:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803876:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80387d:	00 
+  80387e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803885:	00 
+  803886:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80388d:	00 
+  80388e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803895:	00 
+  803896:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80389d:	00 
+
+    assert(size <= sizeof(words));
+  80389e:	48 83 fa 28          	cmp    $0x28,%rdx
+  8038a2:	77 38                	ja     8038dc <fsipc_short+0x6f>
+  8038a4:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8038a6:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8038aa:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  8038b1:	00 00 00 
+  8038b4:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8038b6:	48 b8 2b 38 80 00 00 	movabs $0x80382b,%rax
+  8038bd:	00 00 00 
+  8038c0:	ff d0                	call   *%rax
+  8038c2:	89 c7                	mov    %eax,%edi
+  8038c4:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8038c8:	89 de                	mov    %ebx,%esi
+  8038ca:	48 b8 22 56 80 00 00 	movabs $0x805622,%rax
+  8038d1:	00 00 00 
+  8038d4:	ff d0                	call   *%rax
+}
+  8038d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038da:	c9                   	leave
+  8038db:	c3                   	ret
+    assert(size <= sizeof(words));
+  8038dc:	48 b9 00 63 80 00 00 	movabs $0x806300,%rcx
+  8038e3:	00 00 00 
+  8038e6:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8038ed:	00 00 00 
+  8038f0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8038f5:	48 bf 16 63 80 00 00 	movabs $0x806316,%rdi
+  8038fc:	00 00 00 
+  8038ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803904:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  80390b:	00 00 00 
+  80390e:	41 ff d0             	call   *%r8
+
+0000000000803911 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803911:	55                   	push   %rbp
+  803912:	48 89 e5             	mov    %rsp,%rbp
+  803915:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803919:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80391c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80391f:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803922:	ba 08 00 00 00       	mov    $0x8,%edx
+  803927:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80392b:	bf 02 00 00 00       	mov    $0x2,%edi
+  803930:	48 b8 6d 38 80 00 00 	movabs $0x80386d,%rax
+  803937:	00 00 00 
+  80393a:	ff d0                	call   *%rax
+}
+  80393c:	c9                   	leave
+  80393d:	c3                   	ret
+
+000000000080393e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80393e:	55                   	push   %rbp
+  80393f:	48 89 e5             	mov    %rsp,%rbp
+  803942:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803946:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803949:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  80394c:	ba 04 00 00 00       	mov    $0x4,%edx
+  803951:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803955:	bf 06 00 00 00       	mov    $0x6,%edi
+  80395a:	48 b8 6d 38 80 00 00 	movabs $0x80386d,%rax
+  803961:	00 00 00 
+  803964:	ff d0                	call   *%rax
+}
+  803966:	c9                   	leave
+  803967:	c3                   	ret
+
+0000000000803968 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803968:	55                   	push   %rbp
+  803969:	48 89 e5             	mov    %rsp,%rbp
+  80396c:	41 54                	push   %r12
+  80396e:	53                   	push   %rbx
+  80396f:	48 83 ec 10          	sub    $0x10,%rsp
+  803973:	89 fb                	mov    %edi,%ebx
+  803975:	49 89 f4             	mov    %rsi,%r12
+  803978:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80397c:	48 b8 2b 38 80 00 00 	movabs $0x80382b,%rax
+  803983:	00 00 00 
+  803986:	ff d0                	call   *%rax
+  803988:	89 c7                	mov    %eax,%edi
+  80398a:	6a 00                	push   $0x0
+  80398c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803990:	50                   	push   %rax
+  803991:	4d 89 e1             	mov    %r12,%r9
+  803994:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80399a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80399f:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  8039a6:	00 00 00 
+  8039a9:	89 de                	mov    %ebx,%esi
+  8039ab:	48 b8 bd 55 80 00 00 	movabs $0x8055bd,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+}
+  8039b7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8039bb:	5b                   	pop    %rbx
+  8039bc:	41 5c                	pop    %r12
+  8039be:	5d                   	pop    %rbp
+  8039bf:	c3                   	ret
+
+00000000008039c0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8039c0:	55                   	push   %rbp
+  8039c1:	48 89 e5             	mov    %rsp,%rbp
+  8039c4:	41 54                	push   %r12
+  8039c6:	53                   	push   %rbx
+  8039c7:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039ca:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8039cd:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  8039d4:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039db:	be 00 00 00 00       	mov    $0x0,%esi
+  8039e0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8039e5:	48 b8 68 39 80 00 00 	movabs $0x803968,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039f1:	85 c0                	test   %eax,%eax
+  8039f3:	78 5a                	js     803a4f <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039f5:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8039fc:	00 00 00 
+  8039ff:	4c 89 e6             	mov    %r12,%rsi
+  803a02:	48 89 df             	mov    %rbx,%rdi
+  803a05:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  803a0c:	00 00 00 
+  803a0f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803a11:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803a18:	00 
+  803a19:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803a1f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803a26:	00 
+  803a27:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803a2d:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803a34:	00 
+  803a35:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803a3c:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803a43:	00 
+  803a44:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a4f:	5b                   	pop    %rbx
+  803a50:	41 5c                	pop    %r12
+  803a52:	5d                   	pop    %rbp
+  803a53:	c3                   	ret
+
+0000000000803a54 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a54:	55                   	push   %rbp
+  803a55:	48 89 e5             	mov    %rsp,%rbp
+  803a58:	41 57                	push   %r15
+  803a5a:	41 56                	push   %r14
+  803a5c:	41 55                	push   %r13
+  803a5e:	41 54                	push   %r12
+  803a60:	53                   	push   %rbx
+  803a61:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803a65:	48 85 ff             	test   %rdi,%rdi
+  803a68:	0f 84 a1 00 00 00    	je     803b0f <devfile_read+0xbb>
+  803a6e:	49 89 ff             	mov    %rdi,%r15
+  803a71:	49 89 f5             	mov    %rsi,%r13
+  803a74:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803a77:	48 85 f6             	test   %rsi,%rsi
+  803a7a:	0f 84 c4 00 00 00    	je     803b44 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803a80:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a87:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a88:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803a8f:	00 00 00 
+  803a92:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803a96:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803a99:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aa2:	be 00 00 00 00       	mov    $0x0,%esi
+  803aa7:	bf 03 00 00 00       	mov    $0x3,%edi
+  803aac:	48 b8 68 39 80 00 00 	movabs $0x803968,%rax
+  803ab3:	00 00 00 
+  803ab6:	ff d0                	call   *%rax
+        if (res < 0) {
+  803ab8:	85 c0                	test   %eax,%eax
+  803aba:	0f 88 b9 00 00 00    	js     803b79 <devfile_read+0x125>
+        assert(res <= n);
+  803ac0:	48 63 d8             	movslq %eax,%rbx
+  803ac3:	49 39 dc             	cmp    %rbx,%r12
+  803ac6:	0f 82 b1 00 00 00    	jb     803b7d <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803acc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803ad1:	0f 87 db 00 00 00    	ja     803bb2 <devfile_read+0x15e>
+        if (!res) {
+  803ad7:	85 c0                	test   %eax,%eax
+  803ad9:	74 21                	je     803afc <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803adb:	48 89 da             	mov    %rbx,%rdx
+  803ade:	4c 89 f6             	mov    %r14,%rsi
+  803ae1:	4c 89 ef             	mov    %r13,%rdi
+  803ae4:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+        total_read += res;
+  803af0:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803af4:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803af7:	49 29 dc             	sub    %rbx,%r12
+  803afa:	75 96                	jne    803a92 <devfile_read+0x3e>
+    return total_read;
+  803afc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803b00:	48 83 c4 18          	add    $0x18,%rsp
+  803b04:	5b                   	pop    %rbx
+  803b05:	41 5c                	pop    %r12
+  803b07:	41 5d                	pop    %r13
+  803b09:	41 5e                	pop    %r14
+  803b0b:	41 5f                	pop    %r15
+  803b0d:	5d                   	pop    %rbp
+  803b0e:	c3                   	ret
+    assert(fd);
+  803b0f:	48 b9 21 63 80 00 00 	movabs $0x806321,%rcx
+  803b16:	00 00 00 
+  803b19:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  803b20:	00 00 00 
+  803b23:	be 91 00 00 00       	mov    $0x91,%esi
+  803b28:	48 bf 16 63 80 00 00 	movabs $0x806316,%rdi
+  803b2f:	00 00 00 
+  803b32:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b37:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  803b3e:	00 00 00 
+  803b41:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b44:	48 b9 24 63 80 00 00 	movabs $0x806324,%rcx
+  803b4b:	00 00 00 
+  803b4e:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  803b55:	00 00 00 
+  803b58:	be 92 00 00 00       	mov    $0x92,%esi
+  803b5d:	48 bf 16 63 80 00 00 	movabs $0x806316,%rdi
+  803b64:	00 00 00 
+  803b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6c:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  803b73:	00 00 00 
+  803b76:	41 ff d0             	call   *%r8
+            return res;
+  803b79:	48 98                	cltq
+  803b7b:	eb 83                	jmp    803b00 <devfile_read+0xac>
+        assert(res <= n);
+  803b7d:	48 b9 28 63 80 00 00 	movabs $0x806328,%rcx
+  803b84:	00 00 00 
+  803b87:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  803b8e:	00 00 00 
+  803b91:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803b96:	48 bf 16 63 80 00 00 	movabs $0x806316,%rdi
+  803b9d:	00 00 00 
+  803ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba5:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  803bac:	00 00 00 
+  803baf:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803bb2:	48 b9 38 63 80 00 00 	movabs $0x806338,%rcx
+  803bb9:	00 00 00 
+  803bbc:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  803bc3:	00 00 00 
+  803bc6:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803bcb:	48 bf 16 63 80 00 00 	movabs $0x806316,%rdi
+  803bd2:	00 00 00 
+  803bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bda:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  803be1:	00 00 00 
+  803be4:	41 ff d0             	call   *%r8
+
+0000000000803be7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803be7:	55                   	push   %rbp
+  803be8:	48 89 e5             	mov    %rsp,%rbp
+  803beb:	41 57                	push   %r15
+  803bed:	41 56                	push   %r14
+  803bef:	41 55                	push   %r13
+  803bf1:	41 54                	push   %r12
+  803bf3:	53                   	push   %rbx
+  803bf4:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803bf8:	48 85 ff             	test   %rdi,%rdi
+  803bfb:	0f 84 83 00 00 00    	je     803c84 <devfile_write+0x9d>
+  803c01:	49 89 ff             	mov    %rdi,%r15
+  803c04:	49 89 f4             	mov    %rsi,%r12
+  803c07:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803c0a:	48 85 f6             	test   %rsi,%rsi
+  803c0d:	0f 84 a6 00 00 00    	je     803cb9 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803c13:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c19:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c20:	00 00 00 
+  803c23:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c27:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803c2a:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803c2e:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803c33:	48 39 d3             	cmp    %rdx,%rbx
+  803c36:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803c3a:	4c 89 e6             	mov    %r12,%rsi
+  803c3d:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803c44:	00 00 00 
+  803c47:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  803c4e:	00 00 00 
+  803c51:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c58:	be 00 00 00 00       	mov    $0x0,%esi
+  803c5d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c62:	48 b8 68 39 80 00 00 	movabs $0x803968,%rax
+  803c69:	00 00 00 
+  803c6c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c6e:	85 c0                	test   %eax,%eax
+  803c70:	78 7c                	js     803cee <devfile_write+0x107>
+        total_written += res;
+  803c72:	48 98                	cltq
+  803c74:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803c77:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803c7a:	48 29 c3             	sub    %rax,%rbx
+  803c7d:	75 a4                	jne    803c23 <devfile_write+0x3c>
+    return total_written;
+  803c7f:	4c 89 e8             	mov    %r13,%rax
+  803c82:	eb 6c                	jmp    803cf0 <devfile_write+0x109>
+    assert(fd);
+  803c84:	48 b9 21 63 80 00 00 	movabs $0x806321,%rcx
+  803c8b:	00 00 00 
+  803c8e:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  803c95:	00 00 00 
+  803c98:	be bd 00 00 00       	mov    $0xbd,%esi
+  803c9d:	48 bf 16 63 80 00 00 	movabs $0x806316,%rdi
+  803ca4:	00 00 00 
+  803ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cac:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  803cb3:	00 00 00 
+  803cb6:	41 ff d0             	call   *%r8
+    assert(buf);
+  803cb9:	48 b9 24 63 80 00 00 	movabs $0x806324,%rcx
+  803cc0:	00 00 00 
+  803cc3:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  803cca:	00 00 00 
+  803ccd:	be be 00 00 00       	mov    $0xbe,%esi
+  803cd2:	48 bf 16 63 80 00 00 	movabs $0x806316,%rdi
+  803cd9:	00 00 00 
+  803cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce1:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  803ce8:	00 00 00 
+  803ceb:	41 ff d0             	call   *%r8
+            return res;
+  803cee:	48 98                	cltq
+}
+  803cf0:	48 83 c4 08          	add    $0x8,%rsp
+  803cf4:	5b                   	pop    %rbx
+  803cf5:	41 5c                	pop    %r12
+  803cf7:	41 5d                	pop    %r13
+  803cf9:	41 5e                	pop    %r14
+  803cfb:	41 5f                	pop    %r15
+  803cfd:	5d                   	pop    %rbp
+  803cfe:	c3                   	ret
+
+0000000000803cff <open>:
+open(const char *path, int mode) {
+  803cff:	55                   	push   %rbp
+  803d00:	48 89 e5             	mov    %rsp,%rbp
+  803d03:	41 55                	push   %r13
+  803d05:	41 54                	push   %r12
+  803d07:	53                   	push   %rbx
+  803d08:	48 83 ec 18          	sub    $0x18,%rsp
+  803d0c:	49 89 fc             	mov    %rdi,%r12
+  803d0f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803d12:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  803d19:	00 00 00 
+  803d1c:	ff d0                	call   *%rax
+  803d1e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803d24:	0f 87 8f 00 00 00    	ja     803db9 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d2a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d2e:	48 b8 24 31 80 00 00 	movabs $0x803124,%rax
+  803d35:	00 00 00 
+  803d38:	ff d0                	call   *%rax
+  803d3a:	89 c3                	mov    %eax,%ebx
+  803d3c:	85 c0                	test   %eax,%eax
+  803d3e:	78 55                	js     803d95 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803d40:	4c 89 e6             	mov    %r12,%rsi
+  803d43:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803d4a:	00 00 00 
+  803d4d:	48 89 df             	mov    %rbx,%rdi
+  803d50:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  803d57:	00 00 00 
+  803d5a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803d5c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d68:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d6c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d71:	48 b8 68 39 80 00 00 	movabs $0x803968,%rax
+  803d78:	00 00 00 
+  803d7b:	ff d0                	call   *%rax
+  803d7d:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803d7f:	85 c0                	test   %eax,%eax
+  803d81:	78 1f                	js     803da2 <open+0xa3>
+    return fd2num(fd);
+  803d83:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d87:	48 b8 f6 30 80 00 00 	movabs $0x8030f6,%rax
+  803d8e:	00 00 00 
+  803d91:	ff d0                	call   *%rax
+  803d93:	89 c3                	mov    %eax,%ebx
+}
+  803d95:	89 d8                	mov    %ebx,%eax
+  803d97:	48 83 c4 18          	add    $0x18,%rsp
+  803d9b:	5b                   	pop    %rbx
+  803d9c:	41 5c                	pop    %r12
+  803d9e:	41 5d                	pop    %r13
+  803da0:	5d                   	pop    %rbp
+  803da1:	c3                   	ret
+        fd_close(fd, 0);
+  803da2:	be 00 00 00 00       	mov    $0x0,%esi
+  803da7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803dab:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  803db2:	00 00 00 
+  803db5:	ff d0                	call   *%rax
+        return res;
+  803db7:	eb dc                	jmp    803d95 <open+0x96>
+        return -E_BAD_PATH;
+  803db9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803dbe:	eb d5                	jmp    803d95 <open+0x96>
+
+0000000000803dc0 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803dc0:	55                   	push   %rbp
+  803dc1:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dc9:	be 00 00 00 00       	mov    $0x0,%esi
+  803dce:	bf 08 00 00 00       	mov    $0x8,%edi
+  803dd3:	48 b8 6d 38 80 00 00 	movabs $0x80386d,%rax
+  803dda:	00 00 00 
+  803ddd:	ff d0                	call   *%rax
+}
+  803ddf:	5d                   	pop    %rbp
+  803de0:	c3                   	ret
+
+0000000000803de1 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803de1:	55                   	push   %rbp
+  803de2:	48 89 e5             	mov    %rsp,%rbp
+  803de5:	41 56                	push   %r14
+  803de7:	41 55                	push   %r13
+  803de9:	41 54                	push   %r12
+  803deb:	53                   	push   %rbx
+  803dec:	48 83 ec 10          	sub    $0x10,%rsp
+  803df0:	41 89 f6             	mov    %esi,%r14d
+  803df3:	49 89 d4             	mov    %rdx,%r12
+  803df6:	48 89 cb             	mov    %rcx,%rbx
+  803df9:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803dfc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803e00:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  803e07:	00 00 00 
+  803e0a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e0c:	85 c0                	test   %eax,%eax
+  803e0e:	78 46                	js     803e56 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e10:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e14:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803e1b:	00 00 00 
+  803e1e:	8b 00                	mov    (%rax),%eax
+  803e20:	39 02                	cmp    %eax,(%rdx)
+  803e22:	75 3f                	jne    803e63 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803e24:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803e2b:	00 00 00 
+  803e2e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803e31:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803e33:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803e37:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803e3b:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803e3f:	48 89 da             	mov    %rbx,%rdx
+  803e42:	4c 89 e6             	mov    %r12,%rsi
+  803e45:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e4a:	48 b8 68 39 80 00 00 	movabs $0x803968,%rax
+  803e51:	00 00 00 
+  803e54:	ff d0                	call   *%rax
+}
+  803e56:	48 83 c4 10          	add    $0x10,%rsp
+  803e5a:	5b                   	pop    %rbx
+  803e5b:	41 5c                	pop    %r12
+  803e5d:	41 5d                	pop    %r13
+  803e5f:	41 5e                	pop    %r14
+  803e61:	5d                   	pop    %rbp
+  803e62:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e63:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e68:	eb ec                	jmp    803e56 <file_map+0x75>
+
+0000000000803e6a <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803e6a:	55                   	push   %rbp
+  803e6b:	48 89 e5             	mov    %rsp,%rbp
+  803e6e:	41 54                	push   %r12
+  803e70:	53                   	push   %rbx
+  803e71:	48 83 ec 20          	sub    $0x20,%rsp
+  803e75:	41 89 f4             	mov    %esi,%r12d
+  803e78:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803e7b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803e7f:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e8b:	85 c0                	test   %eax,%eax
+  803e8d:	78 3c                	js     803ecb <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e93:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803e9a:	00 00 00 
+  803e9d:	8b 0a                	mov    (%rdx),%ecx
+  803e9f:	39 08                	cmp    %ecx,(%rax)
+  803ea1:	75 31                	jne    803ed4 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803ea3:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ea6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803ea9:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803ead:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803eb1:	ba 10 00 00 00       	mov    $0x10,%edx
+  803eb6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803eba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803ebf:	48 b8 6d 38 80 00 00 	movabs $0x80386d,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+}
+  803ecb:	48 83 c4 20          	add    $0x20,%rsp
+  803ecf:	5b                   	pop    %rbx
+  803ed0:	41 5c                	pop    %r12
+  803ed2:	5d                   	pop    %rbp
+  803ed3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ed4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ed9:	eb f0                	jmp    803ecb <file_msync+0x61>
+
+0000000000803edb <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803edb:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803edf:	7f 01                	jg     803ee2 <writebuf+0x7>
+  803ee1:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803ee2:	55                   	push   %rbp
+  803ee3:	48 89 e5             	mov    %rsp,%rbp
+  803ee6:	53                   	push   %rbx
+  803ee7:	48 83 ec 08          	sub    $0x8,%rsp
+  803eeb:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803eee:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803ef2:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803ef6:	8b 3f                	mov    (%rdi),%edi
+  803ef8:	48 b8 96 35 80 00 00 	movabs $0x803596,%rax
+  803eff:	00 00 00 
+  803f02:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803f04:	48 85 c0             	test   %rax,%rax
+  803f07:	7e 04                	jle    803f0d <writebuf+0x32>
+  803f09:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803f0d:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803f11:	48 39 c2             	cmp    %rax,%rdx
+  803f14:	74 0f                	je     803f25 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803f16:	48 85 c0             	test   %rax,%rax
+  803f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f1e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803f22:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803f25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f29:	c9                   	leave
+  803f2a:	c3                   	ret
+
+0000000000803f2b <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803f2b:	8b 46 04             	mov    0x4(%rsi),%eax
+  803f2e:	8d 50 01             	lea    0x1(%rax),%edx
+  803f31:	89 56 04             	mov    %edx,0x4(%rsi)
+  803f34:	48 98                	cltq
+  803f36:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803f3b:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803f41:	74 01                	je     803f44 <putch+0x19>
+  803f43:	c3                   	ret
+putch(int ch, void *arg) {
+  803f44:	55                   	push   %rbp
+  803f45:	48 89 e5             	mov    %rsp,%rbp
+  803f48:	53                   	push   %rbx
+  803f49:	48 83 ec 08          	sub    $0x8,%rsp
+  803f4d:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803f50:	48 89 f7             	mov    %rsi,%rdi
+  803f53:	48 b8 db 3e 80 00 00 	movabs $0x803edb,%rax
+  803f5a:	00 00 00 
+  803f5d:	ff d0                	call   *%rax
+        state->offset = 0;
+  803f5f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803f66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f6a:	c9                   	leave
+  803f6b:	c3                   	ret
+
+0000000000803f6c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803f6c:	55                   	push   %rbp
+  803f6d:	48 89 e5             	mov    %rsp,%rbp
+  803f70:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803f77:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803f7a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803f80:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803f87:	00 00 00 
+    state.result = 0;
+  803f8a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803f91:	00 00 00 00 
+    state.error = 1;
+  803f95:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803f9c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803f9f:	48 89 f2             	mov    %rsi,%rdx
+  803fa2:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803fa9:	48 bf 2b 3f 80 00 00 	movabs $0x803f2b,%rdi
+  803fb0:	00 00 00 
+  803fb3:	48 b8 3a 18 80 00 00 	movabs $0x80183a,%rax
+  803fba:	00 00 00 
+  803fbd:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803fbf:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803fc6:	7f 14                	jg     803fdc <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803fc8:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803fcf:	48 85 c0             	test   %rax,%rax
+  803fd2:	75 06                	jne    803fda <vfprintf+0x6e>
+  803fd4:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803fda:	c9                   	leave
+  803fdb:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803fdc:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803fe3:	48 b8 db 3e 80 00 00 	movabs $0x803edb,%rax
+  803fea:	00 00 00 
+  803fed:	ff d0                	call   *%rax
+  803fef:	eb d7                	jmp    803fc8 <vfprintf+0x5c>
+
+0000000000803ff1 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803ff1:	55                   	push   %rbp
+  803ff2:	48 89 e5             	mov    %rsp,%rbp
+  803ff5:	48 83 ec 50          	sub    $0x50,%rsp
+  803ff9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ffd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804001:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804005:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804009:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804010:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804014:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804018:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80401c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804020:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804024:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  80402b:	00 00 00 
+  80402e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804030:	c9                   	leave
+  804031:	c3                   	ret
+
+0000000000804032 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804032:	55                   	push   %rbp
+  804033:	48 89 e5             	mov    %rsp,%rbp
+  804036:	48 83 ec 50          	sub    $0x50,%rsp
+  80403a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80403e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804042:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804046:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80404a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80404e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804055:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804059:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80405d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804061:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804065:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804069:	48 89 fe             	mov    %rdi,%rsi
+  80406c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804071:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  804078:	00 00 00 
+  80407b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80407d:	c9                   	leave
+  80407e:	c3                   	ret
+
+000000000080407f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80407f:	55                   	push   %rbp
+  804080:	48 89 e5             	mov    %rsp,%rbp
+  804083:	41 54                	push   %r12
+  804085:	53                   	push   %rbx
+  804086:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804089:	48 b8 08 31 80 00 00 	movabs $0x803108,%rax
+  804090:	00 00 00 
+  804093:	ff d0                	call   *%rax
+  804095:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804098:	48 be 60 63 80 00 00 	movabs $0x806360,%rsi
+  80409f:	00 00 00 
+  8040a2:	48 89 df             	mov    %rbx,%rdi
+  8040a5:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  8040ac:	00 00 00 
+  8040af:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8040b1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8040b6:	41 2b 04 24          	sub    (%r12),%eax
+  8040ba:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8040c0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8040c7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8040ca:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8040d1:	00 00 00 
+  8040d4:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8040db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e0:	5b                   	pop    %rbx
+  8040e1:	41 5c                	pop    %r12
+  8040e3:	5d                   	pop    %rbp
+  8040e4:	c3                   	ret
+
+00000000008040e5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8040e5:	55                   	push   %rbp
+  8040e6:	48 89 e5             	mov    %rsp,%rbp
+  8040e9:	41 54                	push   %r12
+  8040eb:	53                   	push   %rbx
+  8040ec:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8040ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040f4:	48 89 fe             	mov    %rdi,%rsi
+  8040f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040fc:	49 bc 5e 28 80 00 00 	movabs $0x80285e,%r12
+  804103:	00 00 00 
+  804106:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804109:	48 89 df             	mov    %rbx,%rdi
+  80410c:	48 b8 08 31 80 00 00 	movabs $0x803108,%rax
+  804113:	00 00 00 
+  804116:	ff d0                	call   *%rax
+  804118:	48 89 c6             	mov    %rax,%rsi
+  80411b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804120:	bf 00 00 00 00       	mov    $0x0,%edi
+  804125:	41 ff d4             	call   *%r12
+}
+  804128:	5b                   	pop    %rbx
+  804129:	41 5c                	pop    %r12
+  80412b:	5d                   	pop    %rbp
+  80412c:	c3                   	ret
+
+000000000080412d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80412d:	55                   	push   %rbp
+  80412e:	48 89 e5             	mov    %rsp,%rbp
+  804131:	41 57                	push   %r15
+  804133:	41 56                	push   %r14
+  804135:	41 55                	push   %r13
+  804137:	41 54                	push   %r12
+  804139:	53                   	push   %rbx
+  80413a:	48 83 ec 18          	sub    $0x18,%rsp
+  80413e:	49 89 fc             	mov    %rdi,%r12
+  804141:	49 89 f5             	mov    %rsi,%r13
+  804144:	49 89 d7             	mov    %rdx,%r15
+  804147:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80414b:	48 b8 08 31 80 00 00 	movabs $0x803108,%rax
+  804152:	00 00 00 
+  804155:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804157:	4d 85 ff             	test   %r15,%r15
+  80415a:	0f 84 af 00 00 00    	je     80420f <devpipe_write+0xe2>
+  804160:	48 89 c3             	mov    %rax,%rbx
+  804163:	4c 89 f8             	mov    %r15,%rax
+  804166:	4d 89 ef             	mov    %r13,%r15
+  804169:	4c 01 e8             	add    %r13,%rax
+  80416c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804170:	49 bd 54 27 80 00 00 	movabs $0x802754,%r13
+  804177:	00 00 00 
+            sys_yield();
+  80417a:	49 be e5 26 80 00 00 	movabs $0x8026e5,%r14
+  804181:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804184:	8b 73 04             	mov    0x4(%rbx),%esi
+  804187:	48 63 ce             	movslq %esi,%rcx
+  80418a:	48 63 03             	movslq (%rbx),%rax
+  80418d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804193:	48 39 c1             	cmp    %rax,%rcx
+  804196:	72 2e                	jb     8041c6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804198:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80419d:	48 89 da             	mov    %rbx,%rdx
+  8041a0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041a5:	4c 89 e7             	mov    %r12,%rdi
+  8041a8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8041ab:	85 c0                	test   %eax,%eax
+  8041ad:	74 66                	je     804215 <devpipe_write+0xe8>
+            sys_yield();
+  8041af:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8041b2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8041b5:	48 63 ce             	movslq %esi,%rcx
+  8041b8:	48 63 03             	movslq (%rbx),%rax
+  8041bb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8041c1:	48 39 c1             	cmp    %rax,%rcx
+  8041c4:	73 d2                	jae    804198 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8041c6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8041ca:	48 89 ca             	mov    %rcx,%rdx
+  8041cd:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041d1:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8041d8:	08 10 20 
+  8041db:	48 f7 e2             	mul    %rdx
+  8041de:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041e2:	48 89 d0             	mov    %rdx,%rax
+  8041e5:	48 c1 e0 09          	shl    $0x9,%rax
+  8041e9:	48 29 d0             	sub    %rdx,%rax
+  8041ec:	48 c1 e0 03          	shl    $0x3,%rax
+  8041f0:	48 29 c1             	sub    %rax,%rcx
+  8041f3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8041f8:	83 c6 01             	add    $0x1,%esi
+  8041fb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041fe:	49 83 c7 01          	add    $0x1,%r15
+  804202:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804206:	49 39 c7             	cmp    %rax,%r15
+  804209:	0f 85 75 ff ff ff    	jne    804184 <devpipe_write+0x57>
+    return n;
+  80420f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804213:	eb 05                	jmp    80421a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804215:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80421a:	48 83 c4 18          	add    $0x18,%rsp
+  80421e:	5b                   	pop    %rbx
+  80421f:	41 5c                	pop    %r12
+  804221:	41 5d                	pop    %r13
+  804223:	41 5e                	pop    %r14
+  804225:	41 5f                	pop    %r15
+  804227:	5d                   	pop    %rbp
+  804228:	c3                   	ret
+
+0000000000804229 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804229:	55                   	push   %rbp
+  80422a:	48 89 e5             	mov    %rsp,%rbp
+  80422d:	41 57                	push   %r15
+  80422f:	41 56                	push   %r14
+  804231:	41 55                	push   %r13
+  804233:	41 54                	push   %r12
+  804235:	53                   	push   %rbx
+  804236:	48 83 ec 18          	sub    $0x18,%rsp
+  80423a:	49 89 fc             	mov    %rdi,%r12
+  80423d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804241:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804245:	48 b8 08 31 80 00 00 	movabs $0x803108,%rax
+  80424c:	00 00 00 
+  80424f:	ff d0                	call   *%rax
+  804251:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804254:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80425a:	49 bd 54 27 80 00 00 	movabs $0x802754,%r13
+  804261:	00 00 00 
+            sys_yield();
+  804264:	49 be e5 26 80 00 00 	movabs $0x8026e5,%r14
+  80426b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80426e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804273:	74 7d                	je     8042f2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804275:	8b 03                	mov    (%rbx),%eax
+  804277:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80427a:	75 26                	jne    8042a2 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80427c:	4d 85 ff             	test   %r15,%r15
+  80427f:	75 77                	jne    8042f8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804281:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804286:	48 89 da             	mov    %rbx,%rdx
+  804289:	be 00 10 00 00       	mov    $0x1000,%esi
+  80428e:	4c 89 e7             	mov    %r12,%rdi
+  804291:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804294:	85 c0                	test   %eax,%eax
+  804296:	74 72                	je     80430a <devpipe_read+0xe1>
+            sys_yield();
+  804298:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80429b:	8b 03                	mov    (%rbx),%eax
+  80429d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8042a0:	74 df                	je     804281 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8042a2:	48 63 c8             	movslq %eax,%rcx
+  8042a5:	48 89 ca             	mov    %rcx,%rdx
+  8042a8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8042ac:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8042b3:	08 10 20 
+  8042b6:	48 89 d0             	mov    %rdx,%rax
+  8042b9:	48 f7 e6             	mul    %rsi
+  8042bc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8042c0:	48 89 d0             	mov    %rdx,%rax
+  8042c3:	48 c1 e0 09          	shl    $0x9,%rax
+  8042c7:	48 29 d0             	sub    %rdx,%rax
+  8042ca:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8042d1:	00 
+  8042d2:	48 89 c8             	mov    %rcx,%rax
+  8042d5:	48 29 d0             	sub    %rdx,%rax
+  8042d8:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8042dd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8042e1:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8042e5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042e8:	49 83 c7 01          	add    $0x1,%r15
+  8042ec:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8042f0:	75 83                	jne    804275 <devpipe_read+0x4c>
+    return n;
+  8042f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042f6:	eb 03                	jmp    8042fb <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8042f8:	4c 89 f8             	mov    %r15,%rax
+}
+  8042fb:	48 83 c4 18          	add    $0x18,%rsp
+  8042ff:	5b                   	pop    %rbx
+  804300:	41 5c                	pop    %r12
+  804302:	41 5d                	pop    %r13
+  804304:	41 5e                	pop    %r14
+  804306:	41 5f                	pop    %r15
+  804308:	5d                   	pop    %rbp
+  804309:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80430a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80430f:	eb ea                	jmp    8042fb <devpipe_read+0xd2>
+
+0000000000804311 <pipe>:
+pipe(int pfd[2]) {
+  804311:	55                   	push   %rbp
+  804312:	48 89 e5             	mov    %rsp,%rbp
+  804315:	41 55                	push   %r13
+  804317:	41 54                	push   %r12
+  804319:	53                   	push   %rbx
+  80431a:	48 83 ec 18          	sub    $0x18,%rsp
+  80431e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804321:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804325:	48 b8 24 31 80 00 00 	movabs $0x803124,%rax
+  80432c:	00 00 00 
+  80432f:	ff d0                	call   *%rax
+  804331:	89 c3                	mov    %eax,%ebx
+  804333:	85 c0                	test   %eax,%eax
+  804335:	0f 88 a0 01 00 00    	js     8044db <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80433b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804340:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804345:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804349:	bf 00 00 00 00       	mov    $0x0,%edi
+  80434e:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  804355:	00 00 00 
+  804358:	ff d0                	call   *%rax
+  80435a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80435c:	85 c0                	test   %eax,%eax
+  80435e:	0f 88 77 01 00 00    	js     8044db <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804364:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804368:	48 b8 24 31 80 00 00 	movabs $0x803124,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+  804374:	89 c3                	mov    %eax,%ebx
+  804376:	85 c0                	test   %eax,%eax
+  804378:	0f 88 43 01 00 00    	js     8044c1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80437e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804383:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804388:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80438c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804391:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  804398:	00 00 00 
+  80439b:	ff d0                	call   *%rax
+  80439d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80439f:	85 c0                	test   %eax,%eax
+  8043a1:	0f 88 1a 01 00 00    	js     8044c1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8043a7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043ab:	48 b8 08 31 80 00 00 	movabs $0x803108,%rax
+  8043b2:	00 00 00 
+  8043b5:	ff d0                	call   *%rax
+  8043b7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8043ba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043c4:	48 89 c6             	mov    %rax,%rsi
+  8043c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043cc:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  8043d3:	00 00 00 
+  8043d6:	ff d0                	call   *%rax
+  8043d8:	89 c3                	mov    %eax,%ebx
+  8043da:	85 c0                	test   %eax,%eax
+  8043dc:	0f 88 c5 00 00 00    	js     8044a7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8043e2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043e6:	48 b8 08 31 80 00 00 	movabs $0x803108,%rax
+  8043ed:	00 00 00 
+  8043f0:	ff d0                	call   *%rax
+  8043f2:	48 89 c1             	mov    %rax,%rcx
+  8043f5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8043fb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804401:	ba 00 00 00 00       	mov    $0x0,%edx
+  804406:	4c 89 ee             	mov    %r13,%rsi
+  804409:	bf 00 00 00 00       	mov    $0x0,%edi
+  80440e:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  804415:	00 00 00 
+  804418:	ff d0                	call   *%rax
+  80441a:	89 c3                	mov    %eax,%ebx
+  80441c:	85 c0                	test   %eax,%eax
+  80441e:	78 6e                	js     80448e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804420:	be 00 10 00 00       	mov    $0x1000,%esi
+  804425:	4c 89 ef             	mov    %r13,%rdi
+  804428:	48 b8 1c 27 80 00 00 	movabs $0x80271c,%rax
+  80442f:	00 00 00 
+  804432:	ff d0                	call   *%rax
+  804434:	83 f8 02             	cmp    $0x2,%eax
+  804437:	0f 85 ab 00 00 00    	jne    8044e8 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80443d:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804444:	00 00 
+  804446:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80444a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80444c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804450:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804457:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80445b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80445d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804461:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804468:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80446c:	48 bb f6 30 80 00 00 	movabs $0x8030f6,%rbx
+  804473:	00 00 00 
+  804476:	ff d3                	call   *%rbx
+  804478:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80447c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804480:	ff d3                	call   *%rbx
+  804482:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804487:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80448c:	eb 4d                	jmp    8044db <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80448e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804493:	4c 89 ee             	mov    %r13,%rsi
+  804496:	bf 00 00 00 00       	mov    $0x0,%edi
+  80449b:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8044a2:	00 00 00 
+  8044a5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8044a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044ac:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8044b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044b5:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8044bc:	00 00 00 
+  8044bf:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8044c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044c6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044cf:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8044d6:	00 00 00 
+  8044d9:	ff d0                	call   *%rax
+}
+  8044db:	89 d8                	mov    %ebx,%eax
+  8044dd:	48 83 c4 18          	add    $0x18,%rsp
+  8044e1:	5b                   	pop    %rbx
+  8044e2:	41 5c                	pop    %r12
+  8044e4:	41 5d                	pop    %r13
+  8044e6:	5d                   	pop    %rbp
+  8044e7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044e8:	48 b9 78 63 80 00 00 	movabs $0x806378,%rcx
+  8044ef:	00 00 00 
+  8044f2:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8044f9:	00 00 00 
+  8044fc:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804501:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  804508:	00 00 00 
+  80450b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804510:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  804517:	00 00 00 
+  80451a:	41 ff d0             	call   *%r8
+
+000000000080451d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80451d:	55                   	push   %rbp
+  80451e:	48 89 e5             	mov    %rsp,%rbp
+  804521:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804525:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804529:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  804530:	00 00 00 
+  804533:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804535:	85 c0                	test   %eax,%eax
+  804537:	78 35                	js     80456e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804539:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80453d:	48 b8 08 31 80 00 00 	movabs $0x803108,%rax
+  804544:	00 00 00 
+  804547:	ff d0                	call   *%rax
+  804549:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80454c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804551:	be 00 10 00 00       	mov    $0x1000,%esi
+  804556:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80455a:	48 b8 54 27 80 00 00 	movabs $0x802754,%rax
+  804561:	00 00 00 
+  804564:	ff d0                	call   *%rax
+  804566:	85 c0                	test   %eax,%eax
+  804568:	0f 94 c0             	sete   %al
+  80456b:	0f b6 c0             	movzbl %al,%eax
+}
+  80456e:	c9                   	leave
+  80456f:	c3                   	ret
+
+0000000000804570 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804570:	48 89 f8             	mov    %rdi,%rax
+  804573:	48 c1 e8 27          	shr    $0x27,%rax
+  804577:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80457e:	01 00 00 
+  804581:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804585:	f6 c2 01             	test   $0x1,%dl
+  804588:	74 6d                	je     8045f7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80458a:	48 89 f8             	mov    %rdi,%rax
+  80458d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804591:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804598:	01 00 00 
+  80459b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80459f:	f6 c2 01             	test   $0x1,%dl
+  8045a2:	74 62                	je     804606 <get_uvpt_entry+0x96>
+  8045a4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045ab:	01 00 00 
+  8045ae:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045b2:	f6 c2 80             	test   $0x80,%dl
+  8045b5:	75 4f                	jne    804606 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045b7:	48 89 f8             	mov    %rdi,%rax
+  8045ba:	48 c1 e8 15          	shr    $0x15,%rax
+  8045be:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045c5:	01 00 00 
+  8045c8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045cc:	f6 c2 01             	test   $0x1,%dl
+  8045cf:	74 44                	je     804615 <get_uvpt_entry+0xa5>
+  8045d1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045d8:	01 00 00 
+  8045db:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045df:	f6 c2 80             	test   $0x80,%dl
+  8045e2:	75 31                	jne    804615 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8045e4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8045e8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8045ef:	01 00 00 
+  8045f2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8045f6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8045f7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8045fe:	01 00 00 
+  804601:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804605:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804606:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80460d:	01 00 00 
+  804610:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804614:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804615:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80461c:	01 00 00 
+  80461f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804623:	c3                   	ret
+
+0000000000804624 <get_prot>:
+
+int
+get_prot(void *va) {
+  804624:	55                   	push   %rbp
+  804625:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804628:	48 b8 70 45 80 00 00 	movabs $0x804570,%rax
+  80462f:	00 00 00 
+  804632:	ff d0                	call   *%rax
+  804634:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804637:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80463c:	89 c1                	mov    %eax,%ecx
+  80463e:	83 c9 04             	or     $0x4,%ecx
+  804641:	f6 c2 01             	test   $0x1,%dl
+  804644:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804647:	89 c1                	mov    %eax,%ecx
+  804649:	83 c9 02             	or     $0x2,%ecx
+  80464c:	f6 c2 02             	test   $0x2,%dl
+  80464f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804652:	89 c1                	mov    %eax,%ecx
+  804654:	83 c9 01             	or     $0x1,%ecx
+  804657:	48 85 d2             	test   %rdx,%rdx
+  80465a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80465d:	89 c1                	mov    %eax,%ecx
+  80465f:	83 c9 40             	or     $0x40,%ecx
+  804662:	f6 c6 04             	test   $0x4,%dh
+  804665:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804668:	5d                   	pop    %rbp
+  804669:	c3                   	ret
+
+000000000080466a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80466a:	55                   	push   %rbp
+  80466b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80466e:	48 b8 70 45 80 00 00 	movabs $0x804570,%rax
+  804675:	00 00 00 
+  804678:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80467a:	48 c1 e8 06          	shr    $0x6,%rax
+  80467e:	83 e0 01             	and    $0x1,%eax
+}
+  804681:	5d                   	pop    %rbp
+  804682:	c3                   	ret
+
+0000000000804683 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804683:	55                   	push   %rbp
+  804684:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804687:	48 b8 70 45 80 00 00 	movabs $0x804570,%rax
+  80468e:	00 00 00 
+  804691:	ff d0                	call   *%rax
+  804693:	83 e0 01             	and    $0x1,%eax
+}
+  804696:	5d                   	pop    %rbp
+  804697:	c3                   	ret
+
+0000000000804698 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804698:	55                   	push   %rbp
+  804699:	48 89 e5             	mov    %rsp,%rbp
+  80469c:	41 57                	push   %r15
+  80469e:	41 56                	push   %r14
+  8046a0:	41 55                	push   %r13
+  8046a2:	41 54                	push   %r12
+  8046a4:	53                   	push   %rbx
+  8046a5:	48 83 ec 28          	sub    $0x28,%rsp
+  8046a9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8046ad:	48 85 ff             	test   %rdi,%rdi
+  8046b0:	74 1e                	je     8046d0 <foreach_shared_region+0x38>
+  8046b2:	49 89 ff             	mov    %rdi,%r15
+  8046b5:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8046bb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8046c1:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8046c8:	01 00 00 
+  8046cb:	e9 72 02 00 00       	jmp    804942 <foreach_shared_region+0x2aa>
+    assert(fun);
+  8046d0:	48 b9 9c 63 80 00 00 	movabs $0x80639c,%rcx
+  8046d7:	00 00 00 
+  8046da:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8046e1:	00 00 00 
+  8046e4:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8046e9:	48 bf a0 63 80 00 00 	movabs $0x8063a0,%rdi
+  8046f0:	00 00 00 
+  8046f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046f8:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  8046ff:	00 00 00 
+  804702:	41 ff d0             	call   *%r8
+  804705:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80470c:	eb 6c                	jmp    80477a <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80470e:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804715:	ff ff ff 
+  804718:	4c 21 e2             	and    %r12,%rdx
+  80471b:	48 89 d8             	mov    %rbx,%rax
+  80471e:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804723:	48 83 c0 01          	add    $0x1,%rax
+  804727:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80472b:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804732:	00 00 00 
+  804735:	48 21 c8             	and    %rcx,%rax
+  804738:	48 09 d0             	or     %rdx,%rax
+  80473b:	49 89 c4             	mov    %rax,%r12
+  80473e:	eb 30                	jmp    804770 <foreach_shared_region+0xd8>
+  804740:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804747:	ff ff ff 
+  80474a:	4c 21 e2             	and    %r12,%rdx
+  80474d:	48 89 d8             	mov    %rbx,%rax
+  804750:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804755:	48 83 c0 01          	add    $0x1,%rax
+  804759:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80475d:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804764:	00 00 00 
+  804767:	48 21 c8             	and    %rcx,%rax
+  80476a:	48 09 d0             	or     %rdx,%rax
+  80476d:	49 89 c4             	mov    %rax,%r12
+  804770:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804774:	0f 84 99 01 00 00    	je     804913 <foreach_shared_region+0x27b>
+  80477a:	4c 89 e3             	mov    %r12,%rbx
+  80477d:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804781:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804788:	01 00 00 
+  80478b:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80478f:	a8 01                	test   $0x1,%al
+  804791:	0f 84 77 ff ff ff    	je     80470e <foreach_shared_region+0x76>
+  804797:	a8 80                	test   $0x80,%al
+  804799:	74 19                	je     8047b4 <foreach_shared_region+0x11c>
+  80479b:	f6 c4 04             	test   $0x4,%ah
+  80479e:	74 a0                	je     804740 <foreach_shared_region+0xa8>
+  8047a0:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8047a7:	40 
+  8047a8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8047ac:	4c 89 e7             	mov    %r12,%rdi
+  8047af:	41 ff d7             	call   *%r15
+  8047b2:	eb 8c                	jmp    804740 <foreach_shared_region+0xa8>
+  8047b4:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8047bb:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8047bf:	eb 46                	jmp    804807 <foreach_shared_region+0x16f>
+  8047c1:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047c8:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047ce:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047d2:	48 c1 e0 15          	shl    $0x15,%rax
+  8047d6:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047db:	49 09 c4             	or     %rax,%r12
+  8047de:	eb 1d                	jmp    8047fd <foreach_shared_region+0x165>
+  8047e0:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047e7:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047ed:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047f1:	48 c1 e0 15          	shl    $0x15,%rax
+  8047f5:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047fa:	49 09 c4             	or     %rax,%r12
+  8047fd:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804801:	0f 84 d3 00 00 00    	je     8048da <foreach_shared_region+0x242>
+  804807:	4c 89 e3             	mov    %r12,%rbx
+  80480a:	48 c1 eb 15          	shr    $0x15,%rbx
+  80480e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804815:	01 00 00 
+  804818:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80481c:	a8 01                	test   $0x1,%al
+  80481e:	74 a1                	je     8047c1 <foreach_shared_region+0x129>
+  804820:	a8 80                	test   $0x80,%al
+  804822:	74 19                	je     80483d <foreach_shared_region+0x1a5>
+  804824:	f6 c4 04             	test   $0x4,%ah
+  804827:	74 b7                	je     8047e0 <foreach_shared_region+0x148>
+  804829:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804830:	00 
+  804831:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804835:	4c 89 e7             	mov    %r12,%rdi
+  804838:	41 ff d7             	call   *%r15
+  80483b:	eb a3                	jmp    8047e0 <foreach_shared_region+0x148>
+  80483d:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804843:	eb 3b                	jmp    804880 <foreach_shared_region+0x1e8>
+  804845:	f6 c4 04             	test   $0x4,%ah
+  804848:	74 12                	je     80485c <foreach_shared_region+0x1c4>
+  80484a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804851:	00 
+  804852:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804856:	4c 89 e7             	mov    %r12,%rdi
+  804859:	41 ff d7             	call   *%r15
+  80485c:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804863:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804869:	48 83 c3 01          	add    $0x1,%rbx
+  80486d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804871:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804877:	49 09 dc             	or     %rbx,%r12
+  80487a:	41 83 ed 01          	sub    $0x1,%r13d
+  80487e:	74 2f                	je     8048af <foreach_shared_region+0x217>
+  804880:	4c 89 e3             	mov    %r12,%rbx
+  804883:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804887:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80488b:	a8 01                	test   $0x1,%al
+  80488d:	75 b6                	jne    804845 <foreach_shared_region+0x1ad>
+  80488f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804896:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80489c:	48 83 c3 01          	add    $0x1,%rbx
+  8048a0:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8048a4:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8048aa:	49 09 dc             	or     %rbx,%r12
+  8048ad:	eb cb                	jmp    80487a <foreach_shared_region+0x1e2>
+  8048af:	4c 89 e0             	mov    %r12,%rax
+  8048b2:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8048b8:	49 c1 ec 15          	shr    $0x15,%r12
+  8048bc:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8048c3:	49 83 c4 01          	add    $0x1,%r12
+  8048c7:	49 c1 e4 15          	shl    $0x15,%r12
+  8048cb:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8048d2:	49 09 c4             	or     %rax,%r12
+  8048d5:	e9 23 ff ff ff       	jmp    8047fd <foreach_shared_region+0x165>
+  8048da:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8048de:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8048e5:	ff ff ff 
+  8048e8:	4c 21 e0             	and    %r12,%rax
+  8048eb:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8048ef:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8048f6:	49 83 c4 01          	add    $0x1,%r12
+  8048fa:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8048fe:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804905:	00 00 00 
+  804908:	49 21 d4             	and    %rdx,%r12
+  80490b:	49 09 c4             	or     %rax,%r12
+  80490e:	e9 5d fe ff ff       	jmp    804770 <foreach_shared_region+0xd8>
+  804913:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80491a:	00 ff ff 
+  80491d:	4c 21 e0             	and    %r12,%rax
+  804920:	49 c1 ec 27          	shr    $0x27,%r12
+  804924:	49 83 c4 01          	add    $0x1,%r12
+  804928:	49 c1 e4 27          	shl    $0x27,%r12
+  80492c:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804933:	ff 00 00 
+  804936:	49 21 d4             	and    %rdx,%r12
+  804939:	49 09 c4             	or     %rax,%r12
+  80493c:	41 83 ed 01          	sub    $0x1,%r13d
+  804940:	74 48                	je     80498a <foreach_shared_region+0x2f2>
+  804942:	4c 89 e0             	mov    %r12,%rax
+  804945:	48 c1 e8 27          	shr    $0x27,%rax
+  804949:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804950:	01 00 00 
+  804953:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804957:	f6 c2 01             	test   $0x1,%dl
+  80495a:	0f 85 a5 fd ff ff    	jne    804705 <foreach_shared_region+0x6d>
+  804960:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804967:	00 ff ff 
+  80496a:	4c 21 e2             	and    %r12,%rdx
+  80496d:	48 83 c0 01          	add    $0x1,%rax
+  804971:	48 c1 e0 27          	shl    $0x27,%rax
+  804975:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80497c:	ff 00 00 
+  80497f:	48 21 c8             	and    %rcx,%rax
+  804982:	48 09 d0             	or     %rdx,%rax
+  804985:	49 89 c4             	mov    %rax,%r12
+  804988:	eb b2                	jmp    80493c <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80498a:	4d 85 e4             	test   %r12,%r12
+  80498d:	75 14                	jne    8049a3 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80498f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804994:	48 83 c4 28          	add    $0x28,%rsp
+  804998:	5b                   	pop    %rbx
+  804999:	41 5c                	pop    %r12
+  80499b:	41 5d                	pop    %r13
+  80499d:	41 5e                	pop    %r14
+  80499f:	41 5f                	pop    %r15
+  8049a1:	5d                   	pop    %rbp
+  8049a2:	c3                   	ret
+    assert(addr == 0);
+  8049a3:	48 b9 ab 63 80 00 00 	movabs $0x8063ab,%rcx
+  8049aa:	00 00 00 
+  8049ad:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8049b4:	00 00 00 
+  8049b7:	be 67 00 00 00       	mov    $0x67,%esi
+  8049bc:	48 bf a0 63 80 00 00 	movabs $0x8063a0,%rdi
+  8049c3:	00 00 00 
+  8049c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049cb:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  8049d2:	00 00 00 
+  8049d5:	41 ff d0             	call   *%r8
+
+00000000008049d8 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8049d8:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8049df:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8049e2:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8049e8:	eb 33                	jmp    804a1d <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8049ea:	48 83 c0 20          	add    $0x20,%rax
+  8049ee:	4c 39 c0             	cmp    %r8,%rax
+  8049f1:	74 25                	je     804a18 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8049f3:	48 8b 10             	mov    (%rax),%rdx
+  8049f6:	48 85 d2             	test   %rdx,%rdx
+  8049f9:	74 ef                	je     8049ea <mmap_place+0x12>
+  8049fb:	48 89 d1             	mov    %rdx,%rcx
+  8049fe:	48 03 48 08          	add    0x8(%rax),%rcx
+  804a02:	48 39 cf             	cmp    %rcx,%rdi
+  804a05:	73 e3                	jae    8049ea <mmap_place+0x12>
+  804a07:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804a0b:	4c 39 ca             	cmp    %r9,%rdx
+  804a0e:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804a12:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804a16:	eb d2                	jmp    8049ea <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804a18:	45 84 d2             	test   %r10b,%r10b
+  804a1b:	74 12                	je     804a2f <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a1d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a24:	00 00 00 
+        moved = 0;
+  804a27:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804a2d:	eb c4                	jmp    8049f3 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804a2f:	48 01 fe             	add    %rdi,%rsi
+  804a32:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804a39:	00 00 00 
+  804a3c:	48 39 f0             	cmp    %rsi,%rax
+  804a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a44:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804a48:	c3                   	ret
+
+0000000000804a49 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804a49:	55                   	push   %rbp
+  804a4a:	48 89 e5             	mov    %rsp,%rbp
+  804a4d:	41 57                	push   %r15
+  804a4f:	41 56                	push   %r14
+  804a51:	41 55                	push   %r13
+  804a53:	41 54                	push   %r12
+  804a55:	53                   	push   %rbx
+  804a56:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804a5a:	48 8b 1f             	mov    (%rdi),%rbx
+  804a5d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a64:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a6b:	00 00 00 
+  804a6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a73:	eb 12                	jmp    804a87 <mmap_pgfault+0x3e>
+  804a75:	48 83 c2 01          	add    $0x1,%rdx
+  804a79:	48 83 c0 20          	add    $0x20,%rax
+  804a7d:	48 83 fa 20          	cmp    $0x20,%rdx
+  804a81:	0f 84 04 01 00 00    	je     804b8b <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804a87:	48 8b 08             	mov    (%rax),%rcx
+  804a8a:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804a8e:	48 39 de             	cmp    %rbx,%rsi
+  804a91:	73 e2                	jae    804a75 <mmap_pgfault+0x2c>
+  804a93:	48 03 48 08          	add    0x8(%rax),%rcx
+  804a97:	48 39 cb             	cmp    %rcx,%rbx
+  804a9a:	73 d9                	jae    804a75 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804a9c:	48 c1 e2 05          	shl    $0x5,%rdx
+  804aa0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804aa7:	00 00 00 
+  804aaa:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804aae:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804ab2:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804ab6:	f6 c2 01             	test   $0x1,%dl
+  804ab9:	0f 84 e0 00 00 00    	je     804b9f <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804abf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac4:	f6 c2 02             	test   $0x2,%dl
+  804ac7:	0f 84 c3 00 00 00    	je     804b90 <mmap_pgfault+0x147>
+  804acd:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804ad4:	ff ff ff 
+  804ad7:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804adb:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804ae2:	00 00 00 
+  804ae5:	48 39 ca             	cmp    %rcx,%rdx
+  804ae8:	0f 85 a2 00 00 00    	jne    804b90 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804aee:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804af3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804af8:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804aff:	00 00 00 
+  804b02:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b07:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  804b0e:	00 00 00 
+  804b11:	ff d0                	call   *%rax
+  804b13:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804b15:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b1a:	85 d2                	test   %edx,%edx
+  804b1c:	78 72                	js     804b90 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804b1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b23:	48 89 de             	mov    %rbx,%rsi
+  804b26:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804b2d:	00 00 00 
+  804b30:	4c 89 e7             	mov    %r12,%rdi
+  804b33:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  804b3a:	00 00 00 
+  804b3d:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804b3f:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804b45:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804b4b:	48 89 d9             	mov    %rbx,%rcx
+  804b4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b53:	4c 89 e6             	mov    %r12,%rsi
+  804b56:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b5b:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  804b62:	00 00 00 
+  804b65:	ff d0                	call   *%rax
+  804b67:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804b69:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b6e:	4c 89 e6             	mov    %r12,%rsi
+  804b71:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b76:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  804b7d:	00 00 00 
+  804b80:	ff d0                	call   *%rax
+    return res >= 0;
+  804b82:	89 d8                	mov    %ebx,%eax
+  804b84:	f7 d0                	not    %eax
+  804b86:	c1 e8 1f             	shr    $0x1f,%eax
+  804b89:	eb 05                	jmp    804b90 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804b90:	48 83 c4 18          	add    $0x18,%rsp
+  804b94:	5b                   	pop    %rbx
+  804b95:	41 5c                	pop    %r12
+  804b97:	41 5d                	pop    %r13
+  804b99:	41 5e                	pop    %r14
+  804b9b:	41 5f                	pop    %r15
+  804b9d:	5d                   	pop    %rbp
+  804b9e:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804b9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ba3:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804ba7:	4c 03 30             	add    (%rax),%r14
+  804baa:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804bb1:	49 39 c6             	cmp    %rax,%r14
+  804bb4:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804bb8:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804bbf:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804bc5:	49 bf 83 46 80 00 00 	movabs $0x804683,%r15
+  804bcc:	00 00 00 
+  804bcf:	4d 39 f4             	cmp    %r14,%r12
+  804bd2:	73 1d                	jae    804bf1 <mmap_pgfault+0x1a8>
+  804bd4:	4c 89 e7             	mov    %r12,%rdi
+  804bd7:	41 ff d7             	call   *%r15
+  804bda:	84 c0                	test   %al,%al
+  804bdc:	75 13                	jne    804bf1 <mmap_pgfault+0x1a8>
+  804bde:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804be5:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804bec:	4d 39 f4             	cmp    %r14,%r12
+  804bef:	72 e3                	jb     804bd4 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804bf1:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804bf7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bfb:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804bff:	74 2a                	je     804c2b <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804c01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c05:	89 de                	mov    %ebx,%esi
+  804c07:	2b 30                	sub    (%rax),%esi
+  804c09:	03 70 1c             	add    0x1c(%rax),%esi
+  804c0c:	8b 78 18             	mov    0x18(%rax),%edi
+  804c0f:	4c 89 e9             	mov    %r13,%rcx
+  804c12:	48 89 da             	mov    %rbx,%rdx
+  804c15:	48 b8 e1 3d 80 00 00 	movabs $0x803de1,%rax
+  804c1c:	00 00 00 
+  804c1f:	ff d0                	call   *%rax
+    return res > 0;
+  804c21:	85 c0                	test   %eax,%eax
+  804c23:	0f 9f c0             	setg   %al
+  804c26:	e9 65 ff ff ff       	jmp    804b90 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c2b:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804c2f:	eb d0                	jmp    804c01 <mmap_pgfault+0x1b8>
+
+0000000000804c31 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804c31:	55                   	push   %rbp
+  804c32:	48 89 e5             	mov    %rsp,%rbp
+  804c35:	41 57                	push   %r15
+  804c37:	41 56                	push   %r14
+  804c39:	41 55                	push   %r13
+  804c3b:	41 54                	push   %r12
+  804c3d:	53                   	push   %rbx
+  804c3e:	48 83 ec 28          	sub    $0x28,%rsp
+  804c42:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804c46:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804c49:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c50:	ff ff ff 
+  804c53:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c5c:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804c63:	00 00 00 
+  804c66:	48 39 ca             	cmp    %rcx,%rdx
+  804c69:	0f 85 e5 00 00 00    	jne    804d54 <mmap_writeback+0x123>
+  804c6f:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804c72:	4c 39 ee             	cmp    %r13,%rsi
+  804c75:	0f 83 e8 00 00 00    	jae    804d63 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c7b:	49 be 83 46 80 00 00 	movabs $0x804683,%r14
+  804c82:	00 00 00 
+  804c85:	49 bf 6a 46 80 00 00 	movabs $0x80466a,%r15
+  804c8c:	00 00 00 
+  804c8f:	eb 10                	jmp    804ca1 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804c91:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804c98:	4d 39 ec             	cmp    %r13,%r12
+  804c9b:	0f 83 ae 00 00 00    	jae    804d4f <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ca1:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804ca5:	4c 89 e7             	mov    %r12,%rdi
+  804ca8:	41 ff d6             	call   *%r14
+  804cab:	84 c0                	test   %al,%al
+  804cad:	74 e2                	je     804c91 <mmap_writeback+0x60>
+  804caf:	4c 89 e7             	mov    %r12,%rdi
+  804cb2:	41 ff d7             	call   *%r15
+  804cb5:	84 c0                	test   %al,%al
+  804cb7:	74 d8                	je     804c91 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804cb9:	4c 89 e3             	mov    %r12,%rbx
+  804cbc:	4d 39 ec             	cmp    %r13,%r12
+  804cbf:	73 20                	jae    804ce1 <mmap_writeback+0xb0>
+  804cc1:	48 89 df             	mov    %rbx,%rdi
+  804cc4:	41 ff d6             	call   *%r14
+  804cc7:	84 c0                	test   %al,%al
+  804cc9:	74 16                	je     804ce1 <mmap_writeback+0xb0>
+  804ccb:	48 89 df             	mov    %rbx,%rdi
+  804cce:	41 ff d7             	call   *%r15
+  804cd1:	84 c0                	test   %al,%al
+  804cd3:	74 0c                	je     804ce1 <mmap_writeback+0xb0>
+  804cd5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804cdc:	4c 39 eb             	cmp    %r13,%rbx
+  804cdf:	72 e0                	jb     804cc1 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804ce1:	48 89 d9             	mov    %rbx,%rcx
+  804ce4:	4c 29 e1             	sub    %r12,%rcx
+  804ce7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804ceb:	44 89 e6             	mov    %r12d,%esi
+  804cee:	2b 30                	sub    (%rax),%esi
+  804cf0:	49 89 c4             	mov    %rax,%r12
+  804cf3:	03 70 1c             	add    0x1c(%rax),%esi
+  804cf6:	8b 78 18             	mov    0x18(%rax),%edi
+  804cf9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804cfd:	48 89 ca             	mov    %rcx,%rdx
+  804d00:	48 b8 6a 3e 80 00 00 	movabs $0x803e6a,%rax
+  804d07:	00 00 00 
+  804d0a:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d0c:	85 c0                	test   %eax,%eax
+  804d0e:	78 44                	js     804d54 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804d10:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804d15:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804d18:	41 89 c1             	mov    %eax,%r9d
+  804d1b:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804d22:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804d26:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d2f:	48 89 ce             	mov    %rcx,%rsi
+  804d32:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d37:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  804d3e:	00 00 00 
+  804d41:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804d43:	85 c0                	test   %eax,%eax
+  804d45:	78 0d                	js     804d54 <mmap_writeback+0x123>
+  804d47:	49 89 dc             	mov    %rbx,%r12
+  804d4a:	e9 49 ff ff ff       	jmp    804c98 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d54:	48 83 c4 28          	add    $0x28,%rsp
+  804d58:	5b                   	pop    %rbx
+  804d59:	41 5c                	pop    %r12
+  804d5b:	41 5d                	pop    %r13
+  804d5d:	41 5e                	pop    %r14
+  804d5f:	41 5f                	pop    %r15
+  804d61:	5d                   	pop    %rbp
+  804d62:	c3                   	ret
+    return 0;
+  804d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d68:	eb ea                	jmp    804d54 <mmap_writeback+0x123>
+
+0000000000804d6a <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804d6a:	55                   	push   %rbp
+  804d6b:	48 89 e5             	mov    %rsp,%rbp
+  804d6e:	41 57                	push   %r15
+  804d70:	41 56                	push   %r14
+  804d72:	41 55                	push   %r13
+  804d74:	41 54                	push   %r12
+  804d76:	53                   	push   %rbx
+  804d77:	48 83 ec 38          	sub    $0x38,%rsp
+  804d7b:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804d7f:	48 85 f6             	test   %rsi,%rsi
+  804d82:	0f 84 0c 02 00 00    	je     804f94 <mmap+0x22a>
+  804d88:	49 89 ff             	mov    %rdi,%r15
+  804d8b:	49 89 f4             	mov    %rsi,%r12
+  804d8e:	41 89 d5             	mov    %edx,%r13d
+  804d91:	41 89 ce             	mov    %ecx,%r14d
+  804d94:	44 89 cb             	mov    %r9d,%ebx
+  804d97:	45 85 c9             	test   %r9d,%r9d
+  804d9a:	0f 88 f4 01 00 00    	js     804f94 <mmap+0x22a>
+  804da0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804da7:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804dae:	0f 85 e7 01 00 00    	jne    804f9b <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804db4:	83 e2 fd             	and    $0xfffffffd,%edx
+  804db7:	83 fa 04             	cmp    $0x4,%edx
+  804dba:	0f 85 db 01 00 00    	jne    804f9b <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804dc0:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804dc3:	83 fa 01             	cmp    $0x1,%edx
+  804dc6:	0f 87 cf 01 00 00    	ja     804f9b <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804dcc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804dd0:	44 89 c7             	mov    %r8d,%edi
+  804dd3:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  804dda:	00 00 00 
+  804ddd:	ff d0                	call   *%rax
+  804ddf:	89 c2                	mov    %eax,%edx
+  804de1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804de8:	85 d2                	test   %edx,%edx
+  804dea:	0f 88 ab 01 00 00    	js     804f9b <mmap+0x231>
+  804df0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804df4:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804dfb:	00 00 00 
+  804dfe:	8b 09                	mov    (%rcx),%ecx
+  804e00:	39 0a                	cmp    %ecx,(%rdx)
+  804e02:	0f 85 93 01 00 00    	jne    804f9b <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804e08:	8b 52 08             	mov    0x8(%rdx),%edx
+  804e0b:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804e0e:	83 fa 01             	cmp    $0x1,%edx
+  804e11:	0f 84 84 01 00 00    	je     804f9b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e17:	41 83 fe 01          	cmp    $0x1,%r14d
+  804e1b:	74 42                	je     804e5f <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804e1d:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804e24:	4c 89 e6             	mov    %r12,%rsi
+  804e27:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804e2e:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804e32:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804e36:	4d 85 ff             	test   %r15,%r15
+  804e39:	74 67                	je     804ea2 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e3b:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804e42:	75 0f                	jne    804e53 <mmap+0xe9>
+  804e44:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804e4b:	00 00 00 
+  804e4e:	49 39 c7             	cmp    %rax,%r15
+  804e51:	77 1b                	ja     804e6e <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e53:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e5a:	e9 3c 01 00 00       	jmp    804f9b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e5f:	41 f6 c5 02          	test   $0x2,%r13b
+  804e63:	74 b8                	je     804e1d <mmap+0xb3>
+  804e65:	85 d2                	test   %edx,%edx
+  804e67:	75 b4                	jne    804e1d <mmap+0xb3>
+  804e69:	e9 2d 01 00 00       	jmp    804f9b <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e6e:	4c 89 ff             	mov    %r15,%rdi
+  804e71:	48 b8 d8 49 80 00 00 	movabs $0x8049d8,%rax
+  804e78:	00 00 00 
+  804e7b:	ff d0                	call   *%rax
+  804e7d:	48 89 c2             	mov    %rax,%rdx
+  804e80:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e87:	49 39 d7             	cmp    %rdx,%r15
+  804e8a:	0f 85 0b 01 00 00    	jne    804f9b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804e90:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e97:	00 00 00 
+  804e9a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ea0:	eb 44                	jmp    804ee6 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804ea2:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804ea6:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804ead:	00 00 00 
+  804eb0:	48 b8 d8 49 80 00 00 	movabs $0x8049d8,%rax
+  804eb7:	00 00 00 
+  804eba:	ff d0                	call   *%rax
+  804ebc:	48 89 c7             	mov    %rax,%rdi
+  804ebf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804ec3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804eca:	48 85 ff             	test   %rdi,%rdi
+  804ecd:	75 c1                	jne    804e90 <mmap+0x126>
+  804ecf:	e9 c7 00 00 00       	jmp    804f9b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804ed4:	49 83 c4 01          	add    $0x1,%r12
+  804ed8:	48 83 c0 20          	add    $0x20,%rax
+  804edc:	49 83 fc 20          	cmp    $0x20,%r12
+  804ee0:	0f 84 a5 00 00 00    	je     804f8b <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804ee6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804eea:	75 e8                	jne    804ed4 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804eec:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804ef0:	48 b8 24 31 80 00 00 	movabs $0x803124,%rax
+  804ef7:	00 00 00 
+  804efa:	ff d0                	call   *%rax
+  804efc:	89 c2                	mov    %eax,%edx
+  804efe:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f05:	85 d2                	test   %edx,%edx
+  804f07:	0f 88 8e 00 00 00    	js     804f9b <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804f0d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804f11:	48 b8 f6 30 80 00 00 	movabs $0x8030f6,%rax
+  804f18:	00 00 00 
+  804f1b:	ff d0                	call   *%rax
+  804f1d:	89 c6                	mov    %eax,%esi
+  804f1f:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804f22:	48 b8 44 33 80 00 00 	movabs $0x803344,%rax
+  804f29:	00 00 00 
+  804f2c:	ff d0                	call   *%rax
+  804f2e:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804f31:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f38:	45 85 ff             	test   %r15d,%r15d
+  804f3b:	78 5e                	js     804f9b <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804f3d:	49 c1 e4 05          	shl    $0x5,%r12
+  804f41:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804f48:	00 00 00 
+  804f4b:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804f4e:	48 bf 49 4a 80 00 00 	movabs $0x804a49,%rdi
+  804f55:	00 00 00 
+  804f58:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  804f5f:	00 00 00 
+  804f62:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804f64:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f68:	49 89 04 24          	mov    %rax,(%r12)
+  804f6c:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804f70:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804f75:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804f7a:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804f7f:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804f84:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804f89:	eb 10                	jmp    804f9b <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804f8b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f92:	eb 07                	jmp    804f9b <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f94:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804f9b:	48 83 c4 38          	add    $0x38,%rsp
+  804f9f:	5b                   	pop    %rbx
+  804fa0:	41 5c                	pop    %r12
+  804fa2:	41 5d                	pop    %r13
+  804fa4:	41 5e                	pop    %r14
+  804fa6:	41 5f                	pop    %r15
+  804fa8:	5d                   	pop    %rbp
+  804fa9:	c3                   	ret
+
+0000000000804faa <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804faa:	55                   	push   %rbp
+  804fab:	48 89 e5             	mov    %rsp,%rbp
+  804fae:	41 57                	push   %r15
+  804fb0:	41 56                	push   %r14
+  804fb2:	41 55                	push   %r13
+  804fb4:	41 54                	push   %r12
+  804fb6:	53                   	push   %rbx
+  804fb7:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804fbb:	49 89 fe             	mov    %rdi,%r14
+  804fbe:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804fc5:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804fcc:	00 
+  804fcd:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fd4:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804fdb:	00 00 00 
+  804fde:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804fe5:	49 bf 31 4c 80 00 00 	movabs $0x804c31,%r15
+  804fec:	00 00 00 
+  804fef:	eb 09                	jmp    804ffa <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ff1:	48 83 c3 20          	add    $0x20,%rbx
+  804ff5:	4c 39 eb             	cmp    %r13,%rbx
+  804ff8:	74 33                	je     80502d <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ffa:	48 89 df             	mov    %rbx,%rdi
+  804ffd:	48 8b 33             	mov    (%rbx),%rsi
+  805000:	4c 39 e6             	cmp    %r12,%rsi
+  805003:	73 ec                	jae    804ff1 <msync+0x47>
+  805005:	48 85 f6             	test   %rsi,%rsi
+  805008:	74 e7                	je     804ff1 <msync+0x47>
+  80500a:	48 89 f2             	mov    %rsi,%rdx
+  80500d:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805011:	49 39 d6             	cmp    %rdx,%r14
+  805014:	73 db                	jae    804ff1 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805016:	4c 39 e2             	cmp    %r12,%rdx
+  805019:	49 0f 47 d4          	cmova  %r12,%rdx
+  80501d:	4c 39 f6             	cmp    %r14,%rsi
+  805020:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805024:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805027:	85 c0                	test   %eax,%eax
+  805029:	79 c6                	jns    804ff1 <msync+0x47>
+  80502b:	eb 05                	jmp    805032 <msync+0x88>
+    }
+
+    return 0;
+  80502d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805032:	48 83 c4 08          	add    $0x8,%rsp
+  805036:	5b                   	pop    %rbx
+  805037:	41 5c                	pop    %r12
+  805039:	41 5d                	pop    %r13
+  80503b:	41 5e                	pop    %r14
+  80503d:	41 5f                	pop    %r15
+  80503f:	5d                   	pop    %rbp
+  805040:	c3                   	ret
+
+0000000000805041 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805041:	55                   	push   %rbp
+  805042:	48 89 e5             	mov    %rsp,%rbp
+  805045:	41 57                	push   %r15
+  805047:	41 56                	push   %r14
+  805049:	41 55                	push   %r13
+  80504b:	41 54                	push   %r12
+  80504d:	53                   	push   %rbx
+  80504e:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805052:	49 89 ff             	mov    %rdi,%r15
+  805055:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80505c:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805063:	00 
+  805064:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80506b:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805072:	00 00 00 
+  805075:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80507c:	48 89 d8             	mov    %rbx,%rax
+  80507f:	eb 09                	jmp    80508a <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805081:	48 83 c0 20          	add    $0x20,%rax
+  805085:	4c 39 f0             	cmp    %r14,%rax
+  805088:	74 40                	je     8050ca <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80508a:	48 8b 10             	mov    (%rax),%rdx
+  80508d:	4c 39 e2             	cmp    %r12,%rdx
+  805090:	73 ef                	jae    805081 <munmap+0x40>
+  805092:	48 85 d2             	test   %rdx,%rdx
+  805095:	74 ea                	je     805081 <munmap+0x40>
+  805097:	48 89 d7             	mov    %rdx,%rdi
+  80509a:	48 03 78 08          	add    0x8(%rax),%rdi
+  80509e:	49 39 ff             	cmp    %rdi,%r15
+  8050a1:	73 de                	jae    805081 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8050a3:	49 39 fc             	cmp    %rdi,%r12
+  8050a6:	72 05                	jb     8050ad <munmap+0x6c>
+  8050a8:	4c 39 fa             	cmp    %r15,%rdx
+  8050ab:	73 d4                	jae    805081 <munmap+0x40>
+  8050ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8050b2:	48 83 c4 08          	add    $0x8,%rsp
+  8050b6:	5b                   	pop    %rbx
+  8050b7:	41 5c                	pop    %r12
+  8050b9:	41 5d                	pop    %r13
+  8050bb:	41 5e                	pop    %r14
+  8050bd:	41 5f                	pop    %r15
+  8050bf:	5d                   	pop    %rbp
+  8050c0:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050c1:	48 83 c3 20          	add    $0x20,%rbx
+  8050c5:	4c 39 f3             	cmp    %r14,%rbx
+  8050c8:	74 5c                	je     805126 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8050ca:	48 8b 33             	mov    (%rbx),%rsi
+  8050cd:	4c 39 e6             	cmp    %r12,%rsi
+  8050d0:	73 ef                	jae    8050c1 <munmap+0x80>
+  8050d2:	48 85 f6             	test   %rsi,%rsi
+  8050d5:	74 ea                	je     8050c1 <munmap+0x80>
+  8050d7:	48 89 f2             	mov    %rsi,%rdx
+  8050da:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8050de:	49 39 d7             	cmp    %rdx,%r15
+  8050e1:	73 de                	jae    8050c1 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8050e3:	48 89 df             	mov    %rbx,%rdi
+  8050e6:	48 b8 31 4c 80 00 00 	movabs $0x804c31,%rax
+  8050ed:	00 00 00 
+  8050f0:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8050f2:	85 c0                	test   %eax,%eax
+  8050f4:	78 bc                	js     8050b2 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8050f6:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8050fa:	48 8b 33             	mov    (%rbx),%rsi
+  8050fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  805102:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  805109:	00 00 00 
+  80510c:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80510e:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805111:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  805118:	00 00 00 
+  80511b:	ff d0                	call   *%rax
+        reg->start = 0;
+  80511d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805124:	eb 9b                	jmp    8050c1 <munmap+0x80>
+    return 0;
+  805126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80512b:	eb 85                	jmp    8050b2 <munmap+0x71>
+
+000000000080512d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80512d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805132:	c3                   	ret
+
+0000000000805133 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805133:	55                   	push   %rbp
+  805134:	48 89 e5             	mov    %rsp,%rbp
+  805137:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80513a:	48 be b5 63 80 00 00 	movabs $0x8063b5,%rsi
+  805141:	00 00 00 
+  805144:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  80514b:	00 00 00 
+  80514e:	ff d0                	call   *%rax
+    return 0;
+}
+  805150:	b8 00 00 00 00       	mov    $0x0,%eax
+  805155:	5d                   	pop    %rbp
+  805156:	c3                   	ret
+
+0000000000805157 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805157:	55                   	push   %rbp
+  805158:	48 89 e5             	mov    %rsp,%rbp
+  80515b:	41 57                	push   %r15
+  80515d:	41 56                	push   %r14
+  80515f:	41 55                	push   %r13
+  805161:	41 54                	push   %r12
+  805163:	53                   	push   %rbx
+  805164:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80516b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805172:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805179:	00 00 00 00 
+  80517d:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805184:	00 00 00 00 
+  805188:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80518f:	00 00 00 00 
+  805193:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80519a:	00 00 00 00 
+  80519e:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8051a5:	00 00 00 00 
+  8051a9:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8051b0:	00 00 00 00 
+  8051b4:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8051bb:	00 
+  8051bc:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8051c3:	00 
+  8051c4:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8051cb:	00 
+  8051cc:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8051d3:	00 
+  8051d4:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8051db:	00 
+  8051dc:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8051e3:	00 
+  8051e4:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8051eb:	00 
+  8051ec:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8051f3:	00 
+  8051f4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8051fb:	00 
+  8051fc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805203:	00 
+    for (res = 0; res < n; res += inc) {
+  805204:	48 85 d2             	test   %rdx,%rdx
+  805207:	74 7a                	je     805283 <devcons_write+0x12c>
+  805209:	49 89 d6             	mov    %rdx,%r14
+  80520c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805212:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805217:	49 bf 71 23 80 00 00 	movabs $0x802371,%r15
+  80521e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805221:	4c 89 f3             	mov    %r14,%rbx
+  805224:	48 29 f3             	sub    %rsi,%rbx
+  805227:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80522c:	48 39 c3             	cmp    %rax,%rbx
+  80522f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805233:	4c 63 eb             	movslq %ebx,%r13
+  805236:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80523d:	48 01 c6             	add    %rax,%rsi
+  805240:	4c 89 ea             	mov    %r13,%rdx
+  805243:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80524a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80524d:	4c 89 ee             	mov    %r13,%rsi
+  805250:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805257:	48 b8 9e 25 80 00 00 	movabs $0x80259e,%rax
+  80525e:	00 00 00 
+  805261:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805263:	41 01 dc             	add    %ebx,%r12d
+  805266:	49 63 f4             	movslq %r12d,%rsi
+  805269:	4c 39 f6             	cmp    %r14,%rsi
+  80526c:	72 b3                	jb     805221 <devcons_write+0xca>
+    return res;
+  80526e:	49 63 c4             	movslq %r12d,%rax
+}
+  805271:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805278:	5b                   	pop    %rbx
+  805279:	41 5c                	pop    %r12
+  80527b:	41 5d                	pop    %r13
+  80527d:	41 5e                	pop    %r14
+  80527f:	41 5f                	pop    %r15
+  805281:	5d                   	pop    %rbp
+  805282:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805283:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805289:	eb e3                	jmp    80526e <devcons_write+0x117>
+
+000000000080528b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80528b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80528e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805293:	48 85 c0             	test   %rax,%rax
+  805296:	74 55                	je     8052ed <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805298:	55                   	push   %rbp
+  805299:	48 89 e5             	mov    %rsp,%rbp
+  80529c:	41 55                	push   %r13
+  80529e:	41 54                	push   %r12
+  8052a0:	53                   	push   %rbx
+  8052a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8052a5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8052a8:	48 bb d1 25 80 00 00 	movabs $0x8025d1,%rbx
+  8052af:	00 00 00 
+  8052b2:	49 bc e5 26 80 00 00 	movabs $0x8026e5,%r12
+  8052b9:	00 00 00 
+  8052bc:	eb 03                	jmp    8052c1 <devcons_read+0x36>
+  8052be:	41 ff d4             	call   *%r12
+  8052c1:	ff d3                	call   *%rbx
+  8052c3:	85 c0                	test   %eax,%eax
+  8052c5:	74 f7                	je     8052be <devcons_read+0x33>
+    if (c < 0) return c;
+  8052c7:	48 63 d0             	movslq %eax,%rdx
+  8052ca:	78 13                	js     8052df <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8052cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052d1:	83 f8 04             	cmp    $0x4,%eax
+  8052d4:	74 09                	je     8052df <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8052d6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8052da:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8052df:	48 89 d0             	mov    %rdx,%rax
+  8052e2:	48 83 c4 08          	add    $0x8,%rsp
+  8052e6:	5b                   	pop    %rbx
+  8052e7:	41 5c                	pop    %r12
+  8052e9:	41 5d                	pop    %r13
+  8052eb:	5d                   	pop    %rbp
+  8052ec:	c3                   	ret
+  8052ed:	48 89 d0             	mov    %rdx,%rax
+  8052f0:	c3                   	ret
+
+00000000008052f1 <cputchar>:
+cputchar(int ch) {
+  8052f1:	55                   	push   %rbp
+  8052f2:	48 89 e5             	mov    %rsp,%rbp
+  8052f5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8052f9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8052fd:	be 01 00 00 00       	mov    $0x1,%esi
+  805302:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805306:	48 b8 9e 25 80 00 00 	movabs $0x80259e,%rax
+  80530d:	00 00 00 
+  805310:	ff d0                	call   *%rax
+}
+  805312:	c9                   	leave
+  805313:	c3                   	ret
+
+0000000000805314 <getchar>:
+getchar(void) {
+  805314:	55                   	push   %rbp
+  805315:	48 89 e5             	mov    %rsp,%rbp
+  805318:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80531c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805321:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805325:	bf 00 00 00 00       	mov    $0x0,%edi
+  80532a:	48 b8 67 34 80 00 00 	movabs $0x803467,%rax
+  805331:	00 00 00 
+  805334:	ff d0                	call   *%rax
+  805336:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805338:	85 c0                	test   %eax,%eax
+  80533a:	78 06                	js     805342 <getchar+0x2e>
+  80533c:	74 08                	je     805346 <getchar+0x32>
+  80533e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805342:	89 d0                	mov    %edx,%eax
+  805344:	c9                   	leave
+  805345:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805346:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80534b:	eb f5                	jmp    805342 <getchar+0x2e>
+
+000000000080534d <iscons>:
+iscons(int fdnum) {
+  80534d:	55                   	push   %rbp
+  80534e:	48 89 e5             	mov    %rsp,%rbp
+  805351:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805355:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805359:	48 b8 84 31 80 00 00 	movabs $0x803184,%rax
+  805360:	00 00 00 
+  805363:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805365:	85 c0                	test   %eax,%eax
+  805367:	78 18                	js     805381 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805369:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80536d:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805374:	00 00 00 
+  805377:	8b 00                	mov    (%rax),%eax
+  805379:	39 02                	cmp    %eax,(%rdx)
+  80537b:	0f 94 c0             	sete   %al
+  80537e:	0f b6 c0             	movzbl %al,%eax
+}
+  805381:	c9                   	leave
+  805382:	c3                   	ret
+
+0000000000805383 <opencons>:
+opencons(void) {
+  805383:	55                   	push   %rbp
+  805384:	48 89 e5             	mov    %rsp,%rbp
+  805387:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80538b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80538f:	48 b8 24 31 80 00 00 	movabs $0x803124,%rax
+  805396:	00 00 00 
+  805399:	ff d0                	call   *%rax
+  80539b:	85 c0                	test   %eax,%eax
+  80539d:	78 49                	js     8053e8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80539f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8053a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8053a9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8053ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053b2:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  8053b9:	00 00 00 
+  8053bc:	ff d0                	call   *%rax
+  8053be:	85 c0                	test   %eax,%eax
+  8053c0:	78 26                	js     8053e8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8053c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053c6:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8053cd:	00 00 
+  8053cf:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8053d1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8053d5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8053dc:	48 b8 f6 30 80 00 00 	movabs $0x8030f6,%rax
+  8053e3:	00 00 00 
+  8053e6:	ff d0                	call   *%rax
+}
+  8053e8:	c9                   	leave
+  8053e9:	c3                   	ret
+
+00000000008053ea <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8053ea:	55                   	push   %rbp
+  8053eb:	48 89 e5             	mov    %rsp,%rbp
+  8053ee:	41 56                	push   %r14
+  8053f0:	41 55                	push   %r13
+  8053f2:	41 54                	push   %r12
+  8053f4:	53                   	push   %rbx
+  8053f5:	48 83 ec 50          	sub    $0x50,%rsp
+  8053f9:	49 89 fc             	mov    %rdi,%r12
+  8053fc:	41 89 f5             	mov    %esi,%r13d
+  8053ff:	48 89 d3             	mov    %rdx,%rbx
+  805402:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805406:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80540a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80540e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805415:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805419:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80541d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805421:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805425:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80542c:	00 00 00 
+  80542f:	4c 8b 30             	mov    (%rax),%r14
+  805432:	48 b8 ae 26 80 00 00 	movabs $0x8026ae,%rax
+  805439:	00 00 00 
+  80543c:	ff d0                	call   *%rax
+  80543e:	89 c6                	mov    %eax,%esi
+  805440:	45 89 e8             	mov    %r13d,%r8d
+  805443:	4c 89 e1             	mov    %r12,%rcx
+  805446:	4c 89 f2             	mov    %r14,%rdx
+  805449:	48 bf c8 63 80 00 00 	movabs $0x8063c8,%rdi
+  805450:	00 00 00 
+  805453:	b8 00 00 00 00       	mov    $0x0,%eax
+  805458:	49 bc ea 16 80 00 00 	movabs $0x8016ea,%r12
+  80545f:	00 00 00 
+  805462:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805465:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805469:	48 89 df             	mov    %rbx,%rdi
+  80546c:	48 b8 86 16 80 00 00 	movabs $0x801686,%rax
+  805473:	00 00 00 
+  805476:	ff d0                	call   *%rax
+    cprintf("\n");
+  805478:	48 bf bb 62 80 00 00 	movabs $0x8062bb,%rdi
+  80547f:	00 00 00 
+  805482:	b8 00 00 00 00       	mov    $0x0,%eax
+  805487:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80548a:	cc                   	int3
+  80548b:	eb fd                	jmp    80548a <_panic+0xa0>
+
+000000000080548d <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80548d:	85 ff                	test   %edi,%edi
+  80548f:	78 58                	js     8054e9 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805491:	48 85 f6             	test   %rsi,%rsi
+  805494:	74 12                	je     8054a8 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805496:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80549d:	00 00 00 
+  8054a0:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8054a6:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8054a8:	48 85 c9             	test   %rcx,%rcx
+  8054ab:	74 12                	je     8054bf <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8054ad:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054b4:	00 00 00 
+  8054b7:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8054bd:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8054bf:	48 85 d2             	test   %rdx,%rdx
+  8054c2:	74 14                	je     8054d8 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8054c4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054cb:	00 00 00 
+  8054ce:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8054d5:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8054d8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054df:	00 00 00 
+  8054e2:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054e8:	c3                   	ret
+        if (from_env_store) {
+  8054e9:	48 85 f6             	test   %rsi,%rsi
+  8054ec:	74 06                	je     8054f4 <ipc_result+0x67>
+            *from_env_store = 0;
+  8054ee:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054f4:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054f6:	48 85 c9             	test   %rcx,%rcx
+  8054f9:	74 ed                	je     8054e8 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054fb:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805501:	c3                   	ret
+
+0000000000805502 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805502:	55                   	push   %rbp
+  805503:	48 89 e5             	mov    %rsp,%rbp
+  805506:	41 55                	push   %r13
+  805508:	41 54                	push   %r12
+  80550a:	53                   	push   %rbx
+  80550b:	48 83 ec 08          	sub    $0x8,%rsp
+  80550f:	49 89 fc             	mov    %rdi,%r12
+  805512:	48 89 f7             	mov    %rsi,%rdi
+  805515:	48 89 d3             	mov    %rdx,%rbx
+  805518:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80551b:	48 85 f6             	test   %rsi,%rsi
+  80551e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805525:	00 00 00 
+  805528:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80552c:	be 00 00 00 00       	mov    $0x0,%esi
+  805531:	48 85 d2             	test   %rdx,%rdx
+  805534:	74 03                	je     805539 <ipc_recv+0x37>
+  805536:	48 8b 32             	mov    (%rdx),%rsi
+  805539:	48 b8 d2 2c 80 00 00 	movabs $0x802cd2,%rax
+  805540:	00 00 00 
+  805543:	ff d0                	call   *%rax
+  805545:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805547:	4c 89 e9             	mov    %r13,%rcx
+  80554a:	48 89 da             	mov    %rbx,%rdx
+  80554d:	4c 89 e6             	mov    %r12,%rsi
+  805550:	48 b8 8d 54 80 00 00 	movabs $0x80548d,%rax
+  805557:	00 00 00 
+  80555a:	ff d0                	call   *%rax
+}
+  80555c:	48 83 c4 08          	add    $0x8,%rsp
+  805560:	5b                   	pop    %rbx
+  805561:	41 5c                	pop    %r12
+  805563:	41 5d                	pop    %r13
+  805565:	5d                   	pop    %rbp
+  805566:	c3                   	ret
+
+0000000000805567 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805567:	55                   	push   %rbp
+  805568:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80556b:	48 85 d2             	test   %rdx,%rdx
+  80556e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805575:	00 00 00 
+  805578:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80557c:	89 f6                	mov    %esi,%esi
+  80557e:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  805585:	00 00 00 
+  805588:	ff d0                	call   *%rax
+    if (res < 0) {
+  80558a:	85 c0                	test   %eax,%eax
+  80558c:	78 02                	js     805590 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80558e:	5d                   	pop    %rbp
+  80558f:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805590:	89 c1                	mov    %eax,%ecx
+  805592:	48 ba eb 63 80 00 00 	movabs $0x8063eb,%rdx
+  805599:	00 00 00 
+  80559c:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8055a1:	48 bf f8 63 80 00 00 	movabs $0x8063f8,%rdi
+  8055a8:	00 00 00 
+  8055ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055b0:	49 b8 ea 53 80 00 00 	movabs $0x8053ea,%r8
+  8055b7:	00 00 00 
+  8055ba:	41 ff d0             	call   *%r8
+
+00000000008055bd <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8055bd:	55                   	push   %rbp
+  8055be:	48 89 e5             	mov    %rsp,%rbp
+  8055c1:	53                   	push   %rbx
+  8055c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8055c6:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8055ca:	48 85 d2             	test   %rdx,%rdx
+  8055cd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055d4:	00 00 00 
+  8055d7:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8055db:	4d 85 c9             	test   %r9,%r9
+  8055de:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8055e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055e7:	48 85 db             	test   %rbx,%rbx
+  8055ea:	74 03                	je     8055ef <ipc_call+0x32>
+  8055ec:	48 8b 03             	mov    (%rbx),%rax
+  8055ef:	89 f6                	mov    %esi,%esi
+  8055f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8055f5:	50                   	push   %rax
+  8055f6:	48 b8 90 2b 80 00 00 	movabs $0x802b90,%rax
+  8055fd:	00 00 00 
+  805600:	ff d0                	call   *%rax
+  805602:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805604:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805608:	48 89 da             	mov    %rbx,%rdx
+  80560b:	be 00 00 00 00       	mov    $0x0,%esi
+  805610:	48 b8 8d 54 80 00 00 	movabs $0x80548d,%rax
+  805617:	00 00 00 
+  80561a:	ff d0                	call   *%rax
+}
+  80561c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805620:	c9                   	leave
+  805621:	c3                   	ret
+
+0000000000805622 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805622:	55                   	push   %rbp
+  805623:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805626:	89 f6                	mov    %esi,%esi
+  805628:	48 b8 fc 2b 80 00 00 	movabs $0x802bfc,%rax
+  80562f:	00 00 00 
+  805632:	ff d0                	call   *%rax
+  805634:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805636:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80563b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805640:	be 00 00 00 00       	mov    $0x0,%esi
+  805645:	48 b8 8d 54 80 00 00 	movabs $0x80548d,%rax
+  80564c:	00 00 00 
+  80564f:	ff d0                	call   *%rax
+}
+  805651:	5d                   	pop    %rbp
+  805652:	c3                   	ret
+
+0000000000805653 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805653:	55                   	push   %rbp
+  805654:	48 89 e5             	mov    %rsp,%rbp
+  805657:	41 54                	push   %r12
+  805659:	53                   	push   %rbx
+  80565a:	4c 89 cb             	mov    %r9,%rbx
+  80565d:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805661:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805665:	48 85 d2             	test   %rdx,%rdx
+  805668:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80566f:	00 00 00 
+  805672:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805676:	4d 85 c9             	test   %r9,%r9
+  805679:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80567d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805682:	4d 85 e4             	test   %r12,%r12
+  805685:	74 04                	je     80568b <ipc_reply_wait+0x38>
+  805687:	49 8b 04 24          	mov    (%r12),%rax
+  80568b:	89 f6                	mov    %esi,%esi
+  80568d:	48 83 ec 08          	sub    $0x8,%rsp
+  805691:	50                   	push   %rax
+  805692:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  805699:	00 00 00 
+  80569c:	ff d0                	call   *%rax
+  80569e:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8056a0:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8056a4:	4c 89 e2             	mov    %r12,%rdx
+  8056a7:	48 89 de             	mov    %rbx,%rsi
+  8056aa:	48 b8 8d 54 80 00 00 	movabs $0x80548d,%rax
+  8056b1:	00 00 00 
+  8056b4:	ff d0                	call   *%rax
+}
+  8056b6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8056ba:	5b                   	pop    %rbx
+  8056bb:	41 5c                	pop    %r12
+  8056bd:	5d                   	pop    %rbp
+  8056be:	c3                   	ret
+
+00000000008056bf <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8056bf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8056c4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8056cb:	00 00 00 
+  8056ce:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8056d5:	48 01 ca             	add    %rcx,%rdx
+  8056d8:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8056de:	39 fa                	cmp    %edi,%edx
+  8056e0:	74 12                	je     8056f4 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8056e2:	48 83 c0 01          	add    $0x1,%rax
+  8056e6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056ec:	75 e0                	jne    8056ce <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056f3:	c3                   	ret
+            return envs[i].env_id;
+  8056f4:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056fb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805702:	00 00 00 
+  805705:	48 01 d0             	add    %rdx,%rax
+  805708:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80570e:	c3                   	ret
+  80570f:	90                   	nop
+
+0000000000805710 <__rodata_start>:
+  805710:	77 00                	ja     805712 <__rodata_start+0x2>
+  805712:	72 62                	jb     805776 <__rodata_start+0x66>
+  805714:	00 77 62             	add    %dh,0x62(%rdi)
+  805717:	00 0f                	add    %cl,(%rdi)
+  805719:	1f                   	(bad)
+  80571a:	84 00                	test   %al,(%rax)
+  80571c:	00 00                	add    %al,(%rax)
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	b3 09                	mov    $0x9,%bl
+  805722:	80 00 00             	addb   $0x0,(%rax)
+  805725:	00 00                	add    %al,(%rax)
+  805727:	00 ed                	add    %ch,%ch
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	ed                   	in     (%dx),%eax
+  805739:	0d 80 00 00 00       	or     $0x80,%eax
+  80573e:	00 00                	add    %al,(%rax)
+  805740:	ed                   	in     (%dx),%eax
+  805741:	0d 80 00 00 00       	or     $0x80,%eax
+  805746:	00 00                	add    %al,(%rax)
+  805748:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 ed                	add    %ch,%ch
+  805751:	0d 80 00 00 00       	or     $0x80,%eax
+  805756:	00 00                	add    %al,(%rax)
+  805758:	ed                   	in     (%dx),%eax
+  805759:	0d 80 00 00 00       	or     $0x80,%eax
+  80575e:	00 00                	add    %al,(%rax)
+  805760:	ed                   	in     (%dx),%eax
+  805761:	0d 80 00 00 00       	or     $0x80,%eax
+  805766:	00 00                	add    %al,(%rax)
+  805768:	ed                   	in     (%dx),%eax
+  805769:	0d 80 00 00 00       	or     $0x80,%eax
+  80576e:	00 00                	add    %al,(%rax)
+  805770:	ed                   	in     (%dx),%eax
+  805771:	0d 80 00 00 00       	or     $0x80,%eax
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	8c 0a                	mov    %cs,(%rdx)
+  80578a:	80 00 00             	addb   $0x0,(%rax)
+  80578d:	00 00                	add    %al,(%rax)
+  80578f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805796:	00 00                	add    %al,(%rax)
+  805798:	8c 0a                	mov    %cs,(%rdx)
+  80579a:	80 00 00             	addb   $0x0,(%rax)
+  80579d:	00 00                	add    %al,(%rax)
+  80579f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	8c 0a                	mov    %cs,(%rdx)
+  8057aa:	80 00 00             	addb   $0x0,(%rax)
+  8057ad:	00 00                	add    %al,(%rax)
+  8057af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	8c 0a                	mov    %cs,(%rdx)
+  8057ba:	80 00 00             	addb   $0x0,(%rax)
+  8057bd:	00 00                	add    %al,(%rax)
+  8057bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	f4                   	hlt
+  8058b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8058bf:	00 ed                	add    %ch,%ch
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	2c 0b                	sub    $0xb,%al
+  8058d2:	80 00 00             	addb   $0x0,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 ed                	add    %ch,%ch
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805913:	00 00                	add    %al,(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 cb                	add    %cl,%bl
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	6a 0a                	push   $0xa
+  80593a:	80 00 00             	addb   $0x0,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	3c 0a                	cmp    $0xa,%al
+  80595a:	80 00 00             	addb   $0x0,(%rax)
+  80595d:	00 00                	add    %al,(%rax)
+  80595f:	00 ed                	add    %ch,%ch
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80596b:	00 00                	add    %al,(%rax)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 29                	add    %ch,(%rcx)
+  805979:	0c 80                	or     $0x80,%al
+  80597b:	00 00                	add    %al,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 ed                	add    %ch,%ch
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	1a 0b                	sbb    (%rbx),%cl
+  805992:	80 00 00             	addb   $0x0,(%rax)
+  805995:	00 00                	add    %al,(%rax)
+  805997:	00 ed                	add    %ch,%ch
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ce                   	(bad)
+  8059a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8059a7:	00 ed                	add    %ch,%ch
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	f4                   	hlt
+  8059b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8059bf:	00 37                	add    %dh,(%rdi)
+  8059c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ca:	80 00 00             	addb   $0x0,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 37                	add    %dh,(%rdi)
+  8059d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059eb:	00 00                	add    %al,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 d2                	add    %dl,%dl
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 d2                	add    %dl,%dl
+  8059f9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ff:	00 d2                	add    %dl,%dl
+  805a01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a07:	00 d2                	add    %dl,%dl
+  805a09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a0f:	00 d2                	add    %dl,%dl
+  805a11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a17:	00 d2                	add    %dl,%dl
+  805a19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a1f:	00 d2                	add    %dl,%dl
+  805a21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a27:	00 f6                	add    %dh,%dh
+  805a29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a2f:	00 f6                	add    %dh,%dh
+  805a31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 22                	add    %ah,(%rdx)
+  805a71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a77:	00 22                	add    %ah,(%rdx)
+  805a79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a7f:	00 22                	add    %ah,(%rdx)
+  805a81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a87:	00 22                	add    %ah,(%rdx)
+  805a89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a8f:	00 22                	add    %ah,(%rdx)
+  805a91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a97:	00 22                	add    %ah,(%rdx)
+  805a99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 46 12             	add    %al,0x12(%rsi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 22                	add    %ah,(%rdx)
+  805b71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b77:	00 22                	add    %ah,(%rdx)
+  805b79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b7f:	00 22                	add    %ah,(%rdx)
+  805b81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b87:	00 22                	add    %ah,(%rdx)
+  805b89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b8f:	00 22                	add    %ah,(%rdx)
+  805b91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b97:	00 22                	add    %ah,(%rdx)
+  805b99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 46 12             	add    %al,0x12(%rsi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c40 <basefix.0>:
+  805c40:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c50:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c60:	10 00 69 20 66 61 75 6c 74 65 64 20 61 74 20 76     ..i faulted at v
+  805c70:	61 20 25 6c 78 2c 20 65 72 72 20 25 78 0a 00 3c     a %lx, err %x..<
+  805c80:	75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35 36     unknown>.0123456
+  805c90:	37 38 39 41 42 43 44 45 46 00 30 31 32 33 34 35     789ABCDEF.012345
+  805ca0:	36 37 38 39 61 62 63 64 65 66 00 28 6e 75 6c 6c     6789abcdef.(null
+  805cb0:	29 00 65 72 72 6f 72 20 25 64 00 75 6e 73 70 65     ).error %d.unspe
+  805cc0:	63 69 66 69 65 64 20 65 72 72 6f 72 00 62 61 64     cified error.bad
+  805cd0:	20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e 76      environment.inv
+  805ce0:	61 6c 69 64 20 70 61 72 61 6d 65 74 65 72 00 6f     alid parameter.o
+  805cf0:	75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75 74     ut of memory.out
+  805d00:	20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 73      of environments
+  805d10:	00 63 6f 72 72 75 70 74 65 64 20 64 65 62 75 67     .corrupted debug
+  805d20:	20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74 69      info.segmentati
+  805d30:	6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69 64     on fault.invalid
+  805d40:	20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73 75      ELF image.no su
+  805d50:	63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00 65     ch system call.e
+  805d60:	6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00 65     ntry not found.e
+  805d70:	6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76 69 6e     nv is not recvin
+  805d80:	67 00 75 6e 65 78 70 65 63 74 65 64 20 65 6e 64     g.unexpected end
+  805d90:	20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65 65      of file.no free
+  805da0:	20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00 74      space on disk.t
+  805db0:	6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61 72     oo many files ar
+  805dc0:	65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20 62     e open.file or b
+  805dd0:	6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00 69     lock not found.i
+  805de0:	6e 76 61 6c 69 64 20 70 61 74 68 00 66 69 6c 65     nvalid path.file
+  805df0:	20 61 6c 72 65 61 64 79 20 65 78 69 73 74 73 00      already exists.
+  805e00:	6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73 75     operation not su
+  805e10:	70 70 6f 72 74 65 64 00 0f 1f 84 00 00 00 00 00     pported.........
+  805e20:	e2 18 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     ........9.......
+  805e30:	29 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     ).......9.......
+  805e40:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805e50:	39 1f 80 00 00 00 00 00 01 19 80 00 00 00 00 00     9...............
+  805e60:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805e70:	f5 18 80 00 00 00 00 00 6f 19 80 00 00 00 00 00     ........o.......
+  805e80:	39 1f 80 00 00 00 00 00 f5 18 80 00 00 00 00 00     9...............
+  805e90:	3b 19 80 00 00 00 00 00 3b 19 80 00 00 00 00 00     ;.......;.......
+  805ea0:	3b 19 80 00 00 00 00 00 3b 19 80 00 00 00 00 00     ;.......;.......
+  805eb0:	3b 19 80 00 00 00 00 00 3b 19 80 00 00 00 00 00     ;.......;.......
+  805ec0:	3b 19 80 00 00 00 00 00 3b 19 80 00 00 00 00 00     ;.......;.......
+  805ed0:	3b 19 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     ;.......9.......
+  805ee0:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805ef0:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f00:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f10:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f20:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f30:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f40:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f50:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f60:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f70:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f80:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805f90:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805fa0:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805fb0:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805fc0:	39 1f 80 00 00 00 00 00 57 1e 80 00 00 00 00 00     9.......W.......
+  805fd0:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805fe0:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  805ff0:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  806000:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  806010:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  806020:	9d 19 80 00 00 00 00 00 6c 1b 80 00 00 00 00 00     ........l.......
+  806030:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  806040:	39 1f 80 00 00 00 00 00 92 19 80 00 00 00 00 00     9...............
+  806050:	cc 19 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     ........9.......
+  806060:	39 1f 80 00 00 00 00 00 87 19 80 00 00 00 00 00     9...............
+  806070:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  806080:	15 1d 80 00 00 00 00 00 e4 1d 80 00 00 00 00 00     ................
+  806090:	39 1f 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     9.......9.......
+  8060a0:	63 1a 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     c.......9.......
+  8060b0:	40 1c 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     @.......9.......
+  8060c0:	39 1f 80 00 00 00 00 00 57 1e 80 00 00 00 00 00     9.......W.......
+  8060d0:	39 1f 80 00 00 00 00 00 eb 18 80 00 00 00 00 00     9...............
+
+00000000008060e0 <error_string>:
+	...
+  8060e8:	bb 5c 80 00 00 00 00 00 cd 5c 80 00 00 00 00 00     .\.......\......
+  8060f8:	dd 5c 80 00 00 00 00 00 ef 5c 80 00 00 00 00 00     .\.......\......
+  806108:	fd 5c 80 00 00 00 00 00 11 5d 80 00 00 00 00 00     .\.......]......
+  806118:	26 5d 80 00 00 00 00 00 39 5d 80 00 00 00 00 00     &]......9]......
+  806128:	4b 5d 80 00 00 00 00 00 5f 5d 80 00 00 00 00 00     K]......_]......
+  806138:	6f 5d 80 00 00 00 00 00 82 5d 80 00 00 00 00 00     o].......]......
+  806148:	99 5d 80 00 00 00 00 00 af 5d 80 00 00 00 00 00     .].......]......
+  806158:	c7 5d 80 00 00 00 00 00 df 5d 80 00 00 00 00 00     .].......]......
+  806168:	ec 5d 80 00 00 00 00 00 80 61 80 00 00 00 00 00     .].......a......
+  806178:	00 5e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .^......file is 
+  806188:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806198:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8061a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8061b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8061c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8061d8:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8061e8:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8061f8:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806208:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806218:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806228:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806238:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806248:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  806258:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  806268:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806278:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806288:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806298:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8062a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8062b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8062c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8062d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008062e0 <devtab>:
+  8062e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8062f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806300:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806310:	6f 72 64 73 29 00 6c 69 62 2f 66 69 6c 65 2e 63     ords).lib/file.c
+  806320:	00 66 64 00 62 75 66 00 72 65 73 20 3c 3d 20 6e     .fd.buf.res <= n
+  806330:	00 0f 1f 80 00 00 00 00 72 65 73 20 3c 3d 20 73     ........res <= s
+  806340:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806350:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806360:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806370:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806380:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806390:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8063a0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8063b0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8063c0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8063d0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8063e0:	61 74 20 25 73 3a 25 64 3a 20 00 69 70 63 5f 73     at %s:%d: .ipc_s
+  8063f0:	65 6e 64 3a 20 25 69 00 6c 69 62 2f 69 70 63 2e     end: %i.lib/ipc.
+  806400:	63 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     c.f.........f...
+  806410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,10330 @@
+
+obj/user/faultevilhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 bf 1f 80 00 00 	movabs $0x801fbf,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 bf 1f 80 00 00 	movabs $0x801fbf,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 62 16 80 00 00 	movabs $0x801662,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 36 3c 80 00 00 	movabs $0x803c36,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 2f 1f 80 00 00 	movabs $0x801f2f,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 36 3c 80 00 00 	movabs $0x803c36,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 2f 1f 80 00 00 	movabs $0x801f2f,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 f6 15 80 00 00 	movabs $0x8015f6,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be b0 5c 80 00 00 	movabs $0x805cb0,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 c9 39 80 00 00 	movabs $0x8039c9,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be f0 56 80 00 00 	movabs $0x8056f0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 c9 39 80 00 00 	movabs $0x8039c9,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be f2 56 80 00 00 	movabs $0x8056f2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 c9 39 80 00 00 	movabs $0x8039c9,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be f5 56 80 00 00 	movabs $0x8056f5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 c9 39 80 00 00 	movabs $0x8039c9,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 34 4a 80 00 00 	movabs $0x804a34,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 0b 4d 80 00 00 	movabs $0x804d0b,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 b3 2f 80 00 00 	movabs $0x802fb3,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 4a 33 80 00 00 	movabs $0x80334a,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 13 34 80 00 00 	movabs $0x803413,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 31 31 80 00 00 	movabs $0x803131,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 c9 39 80 00 00 	movabs $0x8039c9,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 b3 2f 80 00 00 	movabs $0x802fb3,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 bf 1f 80 00 00 	movabs $0x801fbf,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 6c 22 80 00 00 	movabs $0x80226c,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 6c 22 80 00 00 	movabs $0x80226c,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be a0 59 80 00 00 	movabs $0x8059a0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 6c 22 80 00 00 	movabs $0x80226c,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 6c 22 80 00 00 	movabs $0x80226c,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 20 5c 80 00 00 	movabs $0x805c20,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 20 5c 80 00 00 	movabs $0x805c20,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 c4 24 80 00 00 	movabs $0x8024c4,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 c4 24 80 00 00 	movabs $0x8024c4,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 4e 00 00 00       	call   80154d <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+/* Test evil pointer for user-level fault handler */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801505:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80150a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80150f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801516:	00 00 00 
+  801519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80151e:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  801525:	00 00 00 
+  801528:	ff d0                	call   *%rax
+    sys_env_set_pgfault_upcall(0, (void *)0xF0100020);
+  80152a:	be 20 00 10 f0       	mov    $0xf0100020,%esi
+  80152f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801534:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  80153b:	00 00 00 
+  80153e:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  801540:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  801547:	00 00 00 00 
+#endif
+}
+  80154b:	5d                   	pop    %rbp
+  80154c:	c3                   	ret
+
+000000000080154d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80154d:	55                   	push   %rbp
+  80154e:	48 89 e5             	mov    %rsp,%rbp
+  801551:	41 56                	push   %r14
+  801553:	41 55                	push   %r13
+  801555:	41 54                	push   %r12
+  801557:	53                   	push   %rbx
+  801558:	41 89 fd             	mov    %edi,%r13d
+  80155b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80155e:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801565:	00 00 00 
+  801568:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80156f:	00 00 00 
+  801572:	48 39 c2             	cmp    %rax,%rdx
+  801575:	73 17                	jae    80158e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801577:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80157a:	49 89 c4             	mov    %rax,%r12
+  80157d:	48 83 c3 08          	add    $0x8,%rbx
+  801581:	b8 00 00 00 00       	mov    $0x0,%eax
+  801586:	ff 53 f8             	call   *-0x8(%rbx)
+  801589:	4c 39 e3             	cmp    %r12,%rbx
+  80158c:	72 ef                	jb     80157d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80158e:	48 b8 8a 26 80 00 00 	movabs $0x80268a,%rax
+  801595:	00 00 00 
+  801598:	ff d0                	call   *%rax
+  80159a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80159f:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8015a6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8015ad:	00 00 00 
+  8015b0:	48 01 d0             	add    %rdx,%rax
+  8015b3:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8015ba:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8015bd:	45 85 ed             	test   %r13d,%r13d
+  8015c0:	7e 0d                	jle    8015cf <libmain+0x82>
+  8015c2:	49 8b 06             	mov    (%r14),%rax
+  8015c5:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015cc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015cf:	4c 89 f6             	mov    %r14,%rsi
+  8015d2:	44 89 ef             	mov    %r13d,%edi
+  8015d5:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015dc:	00 00 00 
+  8015df:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015e1:	48 b8 f6 15 80 00 00 	movabs $0x8015f6,%rax
+  8015e8:	00 00 00 
+  8015eb:	ff d0                	call   *%rax
+#endif
+}
+  8015ed:	5b                   	pop    %rbx
+  8015ee:	41 5c                	pop    %r12
+  8015f0:	41 5d                	pop    %r13
+  8015f2:	41 5e                	pop    %r14
+  8015f4:	5d                   	pop    %rbp
+  8015f5:	c3                   	ret
+
+00000000008015f6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015f6:	55                   	push   %rbp
+  8015f7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015fa:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  801601:	00 00 00 
+  801604:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80160b:	48 b8 19 26 80 00 00 	movabs $0x802619,%rax
+  801612:	00 00 00 
+  801615:	ff d0                	call   *%rax
+}
+  801617:	5d                   	pop    %rbp
+  801618:	c3                   	ret
+
+0000000000801619 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	53                   	push   %rbx
+  80161e:	48 83 ec 08          	sub    $0x8,%rsp
+  801622:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801625:	8b 06                	mov    (%rsi),%eax
+  801627:	8d 50 01             	lea    0x1(%rax),%edx
+  80162a:	89 16                	mov    %edx,(%rsi)
+  80162c:	48 98                	cltq
+  80162e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801633:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801639:	74 0a                	je     801645 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80163b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80163f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801643:	c9                   	leave
+  801644:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801645:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801649:	be ff 00 00 00       	mov    $0xff,%esi
+  80164e:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  801655:	00 00 00 
+  801658:	ff d0                	call   *%rax
+        state->offset = 0;
+  80165a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801660:	eb d9                	jmp    80163b <putch+0x22>
+
+0000000000801662 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801662:	55                   	push   %rbp
+  801663:	48 89 e5             	mov    %rsp,%rbp
+  801666:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80166d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801670:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801677:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80167c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801681:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801684:	48 89 f1             	mov    %rsi,%rcx
+  801687:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80168e:	48 bf 19 16 80 00 00 	movabs $0x801619,%rdi
+  801695:	00 00 00 
+  801698:	48 b8 16 18 80 00 00 	movabs $0x801816,%rax
+  80169f:	00 00 00 
+  8016a2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8016a4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8016ab:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8016b2:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  8016b9:	00 00 00 
+  8016bc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8016be:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016c4:	c9                   	leave
+  8016c5:	c3                   	ret
+
+00000000008016c6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016c6:	55                   	push   %rbp
+  8016c7:	48 89 e5             	mov    %rsp,%rbp
+  8016ca:	48 83 ec 50          	sub    $0x50,%rsp
+  8016ce:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016d2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016d6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016da:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016de:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016e2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016f1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016f9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016fd:	48 b8 62 16 80 00 00 	movabs $0x801662,%rax
+  801704:	00 00 00 
+  801707:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801709:	c9                   	leave
+  80170a:	c3                   	ret
+
+000000000080170b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80170b:	55                   	push   %rbp
+  80170c:	48 89 e5             	mov    %rsp,%rbp
+  80170f:	41 57                	push   %r15
+  801711:	41 56                	push   %r14
+  801713:	41 55                	push   %r13
+  801715:	41 54                	push   %r12
+  801717:	53                   	push   %rbx
+  801718:	48 83 ec 18          	sub    $0x18,%rsp
+  80171c:	49 89 fc             	mov    %rdi,%r12
+  80171f:	49 89 f5             	mov    %rsi,%r13
+  801722:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801726:	8b 45 10             	mov    0x10(%rbp),%eax
+  801729:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80172c:	41 89 cf             	mov    %ecx,%r15d
+  80172f:	4c 39 fa             	cmp    %r15,%rdx
+  801732:	73 5b                	jae    80178f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801734:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801738:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80173c:	85 db                	test   %ebx,%ebx
+  80173e:	7e 0e                	jle    80174e <print_num+0x43>
+            putch(padc, put_arg);
+  801740:	4c 89 ee             	mov    %r13,%rsi
+  801743:	44 89 f7             	mov    %r14d,%edi
+  801746:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801749:	83 eb 01             	sub    $0x1,%ebx
+  80174c:	75 f2                	jne    801740 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80174e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801752:	48 b9 5d 5c 80 00 00 	movabs $0x805c5d,%rcx
+  801759:	00 00 00 
+  80175c:	48 b8 4c 5c 80 00 00 	movabs $0x805c4c,%rax
+  801763:	00 00 00 
+  801766:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80176a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801773:	49 f7 f7             	div    %r15
+  801776:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80177a:	4c 89 ee             	mov    %r13,%rsi
+  80177d:	41 ff d4             	call   *%r12
+}
+  801780:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801784:	5b                   	pop    %rbx
+  801785:	41 5c                	pop    %r12
+  801787:	41 5d                	pop    %r13
+  801789:	41 5e                	pop    %r14
+  80178b:	41 5f                	pop    %r15
+  80178d:	5d                   	pop    %rbp
+  80178e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80178f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801793:	ba 00 00 00 00       	mov    $0x0,%edx
+  801798:	49 f7 f7             	div    %r15
+  80179b:	48 83 ec 08          	sub    $0x8,%rsp
+  80179f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8017a3:	52                   	push   %rdx
+  8017a4:	45 0f be c9          	movsbl %r9b,%r9d
+  8017a8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8017ac:	48 89 c2             	mov    %rax,%rdx
+  8017af:	48 b8 0b 17 80 00 00 	movabs $0x80170b,%rax
+  8017b6:	00 00 00 
+  8017b9:	ff d0                	call   *%rax
+  8017bb:	48 83 c4 10          	add    $0x10,%rsp
+  8017bf:	eb 8d                	jmp    80174e <print_num+0x43>
+
+00000000008017c1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017c1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017c5:	48 8b 06             	mov    (%rsi),%rax
+  8017c8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017cc:	73 0a                	jae    8017d8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017ce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017d2:	48 89 16             	mov    %rdx,(%rsi)
+  8017d5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017d8:	c3                   	ret
+
+00000000008017d9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8017e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017e5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017e9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017ed:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017fc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801800:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801804:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801808:	48 b8 16 18 80 00 00 	movabs $0x801816,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+}
+  801814:	c9                   	leave
+  801815:	c3                   	ret
+
+0000000000801816 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801816:	55                   	push   %rbp
+  801817:	48 89 e5             	mov    %rsp,%rbp
+  80181a:	41 57                	push   %r15
+  80181c:	41 56                	push   %r14
+  80181e:	41 55                	push   %r13
+  801820:	41 54                	push   %r12
+  801822:	53                   	push   %rbx
+  801823:	48 83 ec 38          	sub    $0x38,%rsp
+  801827:	49 89 fe             	mov    %rdi,%r14
+  80182a:	49 89 f5             	mov    %rsi,%r13
+  80182d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801830:	48 8b 01             	mov    (%rcx),%rax
+  801833:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801837:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80183b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80183f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801843:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801847:	eb 0d                	jmp    801856 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801849:	40 0f b6 ff          	movzbl %dil,%edi
+  80184d:	4c 89 ee             	mov    %r13,%rsi
+  801850:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801853:	4c 89 e3             	mov    %r12,%rbx
+  801856:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80185a:	0f b6 3b             	movzbl (%rbx),%edi
+  80185d:	40 80 ff 25          	cmp    $0x25,%dil
+  801861:	74 14                	je     801877 <vprintfmt+0x61>
+            if (!ch) return;
+  801863:	40 84 ff             	test   %dil,%dil
+  801866:	75 e1                	jne    801849 <vprintfmt+0x33>
+}
+  801868:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80186c:	5b                   	pop    %rbx
+  80186d:	41 5c                	pop    %r12
+  80186f:	41 5d                	pop    %r13
+  801871:	41 5e                	pop    %r14
+  801873:	41 5f                	pop    %r15
+  801875:	5d                   	pop    %rbp
+  801876:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801877:	be 00 00 00 00       	mov    $0x0,%esi
+  80187c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801880:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801885:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80188b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801892:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801896:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80189b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8018a0:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8018a3:	83 e8 23             	sub    $0x23,%eax
+  8018a6:	3c 57                	cmp    $0x57,%al
+  8018a8:	0f 87 67 06 00 00    	ja     801f15 <vprintfmt+0x6ff>
+  8018ae:	0f b6 c0             	movzbl %al,%eax
+  8018b1:	48 b9 e0 5d 80 00 00 	movabs $0x805de0,%rcx
+  8018b8:	00 00 00 
+  8018bb:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8018be:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018c1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018c5:	eb cf                	jmp    801896 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018c7:	49 89 dc             	mov    %rbx,%r12
+  8018ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8018cf:	eb c5                	jmp    801896 <vprintfmt+0x80>
+            padc = ch;
+  8018d1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018d5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018d8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018db:	eb b9                	jmp    801896 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8018e3:	77 24                	ja     801909 <vprintfmt+0xf3>
+  8018e5:	89 c1                	mov    %eax,%ecx
+  8018e7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018eb:	83 c0 08             	add    $0x8,%eax
+  8018ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018f1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018f4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018f7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018fb:	79 99                	jns    801896 <vprintfmt+0x80>
+                width = precision;
+  8018fd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801901:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801907:	eb 8d                	jmp    801896 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801909:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80190d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801911:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801915:	eb da                	jmp    8018f1 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801917:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80191c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801920:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801926:	3c 39                	cmp    $0x39,%al
+  801928:	77 1c                	ja     801946 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  80192a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80192e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801932:	0f b6 c0             	movzbl %al,%eax
+  801935:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80193a:	0f b6 03             	movzbl (%rbx),%eax
+  80193d:	3c 39                	cmp    $0x39,%al
+  80193f:	76 e9                	jbe    80192a <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801941:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801944:	eb b1                	jmp    8018f7 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801946:	49 89 dc             	mov    %rbx,%r12
+  801949:	eb ac                	jmp    8018f7 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80194b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80194e:	85 c9                	test   %ecx,%ecx
+  801950:	b8 00 00 00 00       	mov    $0x0,%eax
+  801955:	0f 49 c1             	cmovns %ecx,%eax
+  801958:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80195b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80195e:	e9 33 ff ff ff       	jmp    801896 <vprintfmt+0x80>
+            lflag++;
+  801963:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801966:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801969:	e9 28 ff ff ff       	jmp    801896 <vprintfmt+0x80>
+            lflag--;
+  80196e:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801971:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801974:	e9 1d ff ff ff       	jmp    801896 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80197c:	83 f8 2f             	cmp    $0x2f,%eax
+  80197f:	77 19                	ja     80199a <vprintfmt+0x184>
+  801981:	89 c2                	mov    %eax,%edx
+  801983:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801987:	83 c0 08             	add    $0x8,%eax
+  80198a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80198d:	8b 3a                	mov    (%rdx),%edi
+  80198f:	4c 89 ee             	mov    %r13,%rsi
+  801992:	41 ff d6             	call   *%r14
+            break;
+  801995:	e9 bc fe ff ff       	jmp    801856 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80199a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80199e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019a6:	eb e5                	jmp    80198d <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  8019a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8019ae:	77 5a                	ja     801a0a <vprintfmt+0x1f4>
+  8019b0:	89 c2                	mov    %eax,%edx
+  8019b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019b6:	83 c0 08             	add    $0x8,%eax
+  8019b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8019bc:	8b 02                	mov    (%rdx),%eax
+  8019be:	89 c1                	mov    %eax,%ecx
+  8019c0:	f7 d9                	neg    %ecx
+  8019c2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019c5:	83 f9 13             	cmp    $0x13,%ecx
+  8019c8:	7f 4e                	jg     801a18 <vprintfmt+0x202>
+  8019ca:	48 63 c1             	movslq %ecx,%rax
+  8019cd:	48 ba a0 60 80 00 00 	movabs $0x8060a0,%rdx
+  8019d4:	00 00 00 
+  8019d7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019db:	48 85 c0             	test   %rax,%rax
+  8019de:	74 38                	je     801a18 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019e0:	48 89 c1             	mov    %rax,%rcx
+  8019e3:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  8019ea:	00 00 00 
+  8019ed:	4c 89 ee             	mov    %r13,%rsi
+  8019f0:	4c 89 f7             	mov    %r14,%rdi
+  8019f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f8:	49 b8 d9 17 80 00 00 	movabs $0x8017d9,%r8
+  8019ff:	00 00 00 
+  801a02:	41 ff d0             	call   *%r8
+  801a05:	e9 4c fe ff ff       	jmp    801856 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a16:	eb a4                	jmp    8019bc <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801a18:	48 ba 75 5c 80 00 00 	movabs $0x805c75,%rdx
+  801a1f:	00 00 00 
+  801a22:	4c 89 ee             	mov    %r13,%rsi
+  801a25:	4c 89 f7             	mov    %r14,%rdi
+  801a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2d:	49 b8 d9 17 80 00 00 	movabs $0x8017d9,%r8
+  801a34:	00 00 00 
+  801a37:	41 ff d0             	call   *%r8
+  801a3a:	e9 17 fe ff ff       	jmp    801856 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a42:	83 f8 2f             	cmp    $0x2f,%eax
+  801a45:	77 6c                	ja     801ab3 <vprintfmt+0x29d>
+  801a47:	89 c2                	mov    %eax,%edx
+  801a49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a4d:	83 c0 08             	add    $0x8,%eax
+  801a50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a53:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a56:	48 85 f6             	test   %rsi,%rsi
+  801a59:	48 b8 6e 5c 80 00 00 	movabs $0x805c6e,%rax
+  801a60:	00 00 00 
+  801a63:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a67:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a6b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a6f:	7e 06                	jle    801a77 <vprintfmt+0x261>
+  801a71:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a75:	75 4a                	jne    801ac1 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a77:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a7b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a7f:	0f b6 00             	movzbl (%rax),%eax
+  801a82:	84 c0                	test   %al,%al
+  801a84:	0f 85 9a 00 00 00    	jne    801b24 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a8a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a8d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a91:	85 c0                	test   %eax,%eax
+  801a93:	0f 8e bd fd ff ff    	jle    801856 <vprintfmt+0x40>
+  801a99:	4c 89 ee             	mov    %r13,%rsi
+  801a9c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801aa1:	41 ff d6             	call   *%r14
+  801aa4:	41 83 ec 01          	sub    $0x1,%r12d
+  801aa8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801aac:	75 eb                	jne    801a99 <vprintfmt+0x283>
+  801aae:	e9 a3 fd ff ff       	jmp    801856 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ab3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ab7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801abb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801abf:	eb 92                	jmp    801a53 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ac1:	49 63 f7             	movslq %r15d,%rsi
+  801ac4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801ac8:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  801acf:	00 00 00 
+  801ad2:	ff d0                	call   *%rax
+  801ad4:	48 89 c2             	mov    %rax,%rdx
+  801ad7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ada:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801adc:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801adf:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ae2:	85 c0                	test   %eax,%eax
+  801ae4:	7e 91                	jle    801a77 <vprintfmt+0x261>
+  801ae6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801aeb:	4c 89 ee             	mov    %r13,%rsi
+  801aee:	44 89 e7             	mov    %r12d,%edi
+  801af1:	41 ff d6             	call   *%r14
+  801af4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801af8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801afb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801afe:	75 eb                	jne    801aeb <vprintfmt+0x2d5>
+  801b00:	e9 72 ff ff ff       	jmp    801a77 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b05:	0f b6 f8             	movzbl %al,%edi
+  801b08:	4c 89 ee             	mov    %r13,%rsi
+  801b0b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b0e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b12:	49 83 c4 01          	add    $0x1,%r12
+  801b16:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801b1c:	84 c0                	test   %al,%al
+  801b1e:	0f 84 66 ff ff ff    	je     801a8a <vprintfmt+0x274>
+  801b24:	45 85 ff             	test   %r15d,%r15d
+  801b27:	78 0a                	js     801b33 <vprintfmt+0x31d>
+  801b29:	41 83 ef 01          	sub    $0x1,%r15d
+  801b2d:	0f 88 57 ff ff ff    	js     801a8a <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b33:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b37:	74 cc                	je     801b05 <vprintfmt+0x2ef>
+  801b39:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b3c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b41:	80 fa 5e             	cmp    $0x5e,%dl
+  801b44:	77 c2                	ja     801b08 <vprintfmt+0x2f2>
+  801b46:	eb bd                	jmp    801b05 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b48:	40 84 f6             	test   %sil,%sil
+  801b4b:	75 26                	jne    801b73 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b4d:	85 d2                	test   %edx,%edx
+  801b4f:	74 59                	je     801baa <vprintfmt+0x394>
+  801b51:	83 fa 01             	cmp    $0x1,%edx
+  801b54:	74 7b                	je     801bd1 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b59:	83 f8 2f             	cmp    $0x2f,%eax
+  801b5c:	0f 87 96 00 00 00    	ja     801bf8 <vprintfmt+0x3e2>
+  801b62:	89 c2                	mov    %eax,%edx
+  801b64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b68:	83 c0 08             	add    $0x8,%eax
+  801b6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b6e:	4c 8b 22             	mov    (%rdx),%r12
+  801b71:	eb 17                	jmp    801b8a <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b76:	83 f8 2f             	cmp    $0x2f,%eax
+  801b79:	77 21                	ja     801b9c <vprintfmt+0x386>
+  801b7b:	89 c2                	mov    %eax,%edx
+  801b7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b81:	83 c0 08             	add    $0x8,%eax
+  801b84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b87:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b8a:	4d 85 e4             	test   %r12,%r12
+  801b8d:	78 7a                	js     801c09 <vprintfmt+0x3f3>
+            num = i;
+  801b8f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b92:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b97:	e9 56 02 00 00       	jmp    801df2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba8:	eb dd                	jmp    801b87 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bad:	83 f8 2f             	cmp    $0x2f,%eax
+  801bb0:	77 11                	ja     801bc3 <vprintfmt+0x3ad>
+  801bb2:	89 c2                	mov    %eax,%edx
+  801bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bb8:	83 c0 08             	add    $0x8,%eax
+  801bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bbe:	4c 63 22             	movslq (%rdx),%r12
+  801bc1:	eb c7                	jmp    801b8a <vprintfmt+0x374>
+  801bc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bcb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bcf:	eb ed                	jmp    801bbe <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bd4:	83 f8 2f             	cmp    $0x2f,%eax
+  801bd7:	77 11                	ja     801bea <vprintfmt+0x3d4>
+  801bd9:	89 c2                	mov    %eax,%edx
+  801bdb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bdf:	83 c0 08             	add    $0x8,%eax
+  801be2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801be5:	4c 8b 22             	mov    (%rdx),%r12
+  801be8:	eb a0                	jmp    801b8a <vprintfmt+0x374>
+  801bea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf6:	eb ed                	jmp    801be5 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c04:	e9 65 ff ff ff       	jmp    801b6e <vprintfmt+0x358>
+                putch('-', put_arg);
+  801c09:	4c 89 ee             	mov    %r13,%rsi
+  801c0c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801c11:	41 ff d6             	call   *%r14
+                i = -i;
+  801c14:	49 f7 dc             	neg    %r12
+  801c17:	e9 73 ff ff ff       	jmp    801b8f <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801c1c:	40 84 f6             	test   %sil,%sil
+  801c1f:	75 2e                	jne    801c4f <vprintfmt+0x439>
+    switch (lflag) {
+  801c21:	85 d2                	test   %edx,%edx
+  801c23:	7f 59                	jg     801c7e <vprintfmt+0x468>
+  801c25:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c28:	7d 7a                	jge    801ca4 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c2d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c30:	0f 87 aa 00 00 00    	ja     801ce0 <vprintfmt+0x4ca>
+  801c36:	89 c2                	mov    %eax,%edx
+  801c38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c3c:	83 c0 08             	add    $0x8,%eax
+  801c3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c42:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c45:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c4a:	e9 a3 01 00 00       	jmp    801df2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c52:	83 f8 2f             	cmp    $0x2f,%eax
+  801c55:	77 19                	ja     801c70 <vprintfmt+0x45a>
+  801c57:	89 c2                	mov    %eax,%edx
+  801c59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c5d:	83 c0 08             	add    $0x8,%eax
+  801c60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c63:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c6b:	e9 82 01 00 00       	jmp    801df2 <vprintfmt+0x5dc>
+  801c70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c7c:	eb e5                	jmp    801c63 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c7e:	83 fa 01             	cmp    $0x1,%edx
+  801c81:	75 a7                	jne    801c2a <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c86:	83 f8 2f             	cmp    $0x2f,%eax
+  801c89:	77 47                	ja     801cd2 <vprintfmt+0x4bc>
+  801c8b:	89 c2                	mov    %eax,%edx
+  801c8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c91:	83 c0 08             	add    $0x8,%eax
+  801c94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c97:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c9a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c9f:	e9 4e 01 00 00       	jmp    801df2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801ca4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ca7:	83 f8 2f             	cmp    $0x2f,%eax
+  801caa:	77 18                	ja     801cc4 <vprintfmt+0x4ae>
+  801cac:	89 c2                	mov    %eax,%edx
+  801cae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cb2:	83 c0 08             	add    $0x8,%eax
+  801cb5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cb8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801cba:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801cbf:	e9 2e 01 00 00       	jmp    801df2 <vprintfmt+0x5dc>
+  801cc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ccc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cd0:	eb e6                	jmp    801cb8 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cde:	eb b7                	jmp    801c97 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ce0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ce4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ce8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cec:	e9 51 ff ff ff       	jmp    801c42 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cf1:	40 84 f6             	test   %sil,%sil
+  801cf4:	75 2e                	jne    801d24 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cf6:	85 d2                	test   %edx,%edx
+  801cf8:	7f 59                	jg     801d53 <vprintfmt+0x53d>
+  801cfa:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cfd:	7d 77                	jge    801d76 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d02:	83 f8 2f             	cmp    $0x2f,%eax
+  801d05:	0f 87 a4 00 00 00    	ja     801daf <vprintfmt+0x599>
+  801d0b:	89 c2                	mov    %eax,%edx
+  801d0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d11:	83 c0 08             	add    $0x8,%eax
+  801d14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d17:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d1a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d1f:	e9 ce 00 00 00       	jmp    801df2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d27:	83 f8 2f             	cmp    $0x2f,%eax
+  801d2a:	77 19                	ja     801d45 <vprintfmt+0x52f>
+  801d2c:	89 c2                	mov    %eax,%edx
+  801d2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d32:	83 c0 08             	add    $0x8,%eax
+  801d35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d38:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d3b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d40:	e9 ad 00 00 00       	jmp    801df2 <vprintfmt+0x5dc>
+  801d45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d51:	eb e5                	jmp    801d38 <vprintfmt+0x522>
+    switch (lflag) {
+  801d53:	83 fa 01             	cmp    $0x1,%edx
+  801d56:	75 a7                	jne    801cff <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d5b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5e:	77 41                	ja     801da1 <vprintfmt+0x58b>
+  801d60:	89 c2                	mov    %eax,%edx
+  801d62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d66:	83 c0 08             	add    $0x8,%eax
+  801d69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d6c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d6f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d74:	eb 7c                	jmp    801df2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d79:	83 f8 2f             	cmp    $0x2f,%eax
+  801d7c:	77 15                	ja     801d93 <vprintfmt+0x57d>
+  801d7e:	89 c2                	mov    %eax,%edx
+  801d80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d84:	83 c0 08             	add    $0x8,%eax
+  801d87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d8a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d8c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d91:	eb 5f                	jmp    801df2 <vprintfmt+0x5dc>
+  801d93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9f:	eb e9                	jmp    801d8a <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801da1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801da5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801da9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dad:	eb bd                	jmp    801d6c <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801daf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801db3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801db7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dbb:	e9 57 ff ff ff       	jmp    801d17 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801dc0:	4c 89 ee             	mov    %r13,%rsi
+  801dc3:	bf 30 00 00 00       	mov    $0x30,%edi
+  801dc8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801dcb:	4c 89 ee             	mov    %r13,%rsi
+  801dce:	bf 78 00 00 00       	mov    $0x78,%edi
+  801dd3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801dd6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dd9:	83 f8 2f             	cmp    $0x2f,%eax
+  801ddc:	77 47                	ja     801e25 <vprintfmt+0x60f>
+  801dde:	89 c2                	mov    %eax,%edx
+  801de0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801de4:	83 c0 08             	add    $0x8,%eax
+  801de7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ded:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801df2:	48 83 ec 08          	sub    $0x8,%rsp
+  801df6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dfa:	0f 94 c0             	sete   %al
+  801dfd:	0f b6 c0             	movzbl %al,%eax
+  801e00:	50                   	push   %rax
+  801e01:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801e06:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801e0a:	4c 89 ee             	mov    %r13,%rsi
+  801e0d:	4c 89 f7             	mov    %r14,%rdi
+  801e10:	48 b8 0b 17 80 00 00 	movabs $0x80170b,%rax
+  801e17:	00 00 00 
+  801e1a:	ff d0                	call   *%rax
+            break;
+  801e1c:	48 83 c4 10          	add    $0x10,%rsp
+  801e20:	e9 31 fa ff ff       	jmp    801856 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e31:	eb b7                	jmp    801dea <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e33:	40 84 f6             	test   %sil,%sil
+  801e36:	75 2b                	jne    801e63 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e38:	85 d2                	test   %edx,%edx
+  801e3a:	7f 56                	jg     801e92 <vprintfmt+0x67c>
+  801e3c:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e3f:	7d 77                	jge    801eb8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e44:	83 f8 2f             	cmp    $0x2f,%eax
+  801e47:	0f 87 a7 00 00 00    	ja     801ef4 <vprintfmt+0x6de>
+  801e4d:	89 c2                	mov    %eax,%edx
+  801e4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e53:	83 c0 08             	add    $0x8,%eax
+  801e56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e59:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e5c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e61:	eb 8f                	jmp    801df2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e66:	83 f8 2f             	cmp    $0x2f,%eax
+  801e69:	77 19                	ja     801e84 <vprintfmt+0x66e>
+  801e6b:	89 c2                	mov    %eax,%edx
+  801e6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e71:	83 c0 08             	add    $0x8,%eax
+  801e74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e77:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e7a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e7f:	e9 6e ff ff ff       	jmp    801df2 <vprintfmt+0x5dc>
+  801e84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e90:	eb e5                	jmp    801e77 <vprintfmt+0x661>
+    switch (lflag) {
+  801e92:	83 fa 01             	cmp    $0x1,%edx
+  801e95:	75 aa                	jne    801e41 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9d:	77 47                	ja     801ee6 <vprintfmt+0x6d0>
+  801e9f:	89 c2                	mov    %eax,%edx
+  801ea1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea5:	83 c0 08             	add    $0x8,%eax
+  801ea8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801eae:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801eb3:	e9 3a ff ff ff       	jmp    801df2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801eb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ebb:	83 f8 2f             	cmp    $0x2f,%eax
+  801ebe:	77 18                	ja     801ed8 <vprintfmt+0x6c2>
+  801ec0:	89 c2                	mov    %eax,%edx
+  801ec2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec6:	83 c0 08             	add    $0x8,%eax
+  801ec9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ecc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ece:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ed3:	e9 1a ff ff ff       	jmp    801df2 <vprintfmt+0x5dc>
+  801ed8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801edc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ee0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee4:	eb e6                	jmp    801ecc <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ee6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef2:	eb b7                	jmp    801eab <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ef4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ef8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f00:	e9 54 ff ff ff       	jmp    801e59 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801f05:	4c 89 ee             	mov    %r13,%rsi
+  801f08:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f0d:	41 ff d6             	call   *%r14
+            break;
+  801f10:	e9 41 f9 ff ff       	jmp    801856 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801f15:	4c 89 ee             	mov    %r13,%rsi
+  801f18:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f1d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f20:	48 83 eb 01          	sub    $0x1,%rbx
+  801f24:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f28:	75 f6                	jne    801f20 <vprintfmt+0x70a>
+  801f2a:	e9 27 f9 ff ff       	jmp    801856 <vprintfmt+0x40>
+
+0000000000801f2f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f2f:	55                   	push   %rbp
+  801f30:	48 89 e5             	mov    %rsp,%rbp
+  801f33:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f37:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f3b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f40:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f44:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f4b:	48 85 ff             	test   %rdi,%rdi
+  801f4e:	74 2b                	je     801f7b <vsnprintf+0x4c>
+  801f50:	48 85 f6             	test   %rsi,%rsi
+  801f53:	74 26                	je     801f7b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f59:	48 bf c1 17 80 00 00 	movabs $0x8017c1,%rdi
+  801f60:	00 00 00 
+  801f63:	48 b8 16 18 80 00 00 	movabs $0x801816,%rax
+  801f6a:	00 00 00 
+  801f6d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f73:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f76:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f80:	eb f7                	jmp    801f79 <vsnprintf+0x4a>
+
+0000000000801f82 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f82:	55                   	push   %rbp
+  801f83:	48 89 e5             	mov    %rsp,%rbp
+  801f86:	48 83 ec 50          	sub    $0x50,%rsp
+  801f8a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f8e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f92:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f96:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f9d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801fa1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801fa9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801fad:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801fb1:	48 b8 2f 1f 80 00 00 	movabs $0x801f2f,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801fbd:	c9                   	leave
+  801fbe:	c3                   	ret
+
+0000000000801fbf <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801fbf:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fc2:	74 10                	je     801fd4 <strlen+0x15>
+    size_t n = 0;
+  801fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fc9:	48 83 c0 01          	add    $0x1,%rax
+  801fcd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fd1:	75 f6                	jne    801fc9 <strlen+0xa>
+  801fd3:	c3                   	ret
+    size_t n = 0;
+  801fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fd9:	c3                   	ret
+
+0000000000801fda <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fda:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fdd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fe2:	48 85 f6             	test   %rsi,%rsi
+  801fe5:	74 11                	je     801ff8 <strnlen+0x1e>
+  801fe7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801feb:	74 0c                	je     801ff9 <strnlen+0x1f>
+  801fed:	48 83 c2 01          	add    $0x1,%rdx
+  801ff1:	48 39 d0             	cmp    %rdx,%rax
+  801ff4:	75 f1                	jne    801fe7 <strnlen+0xd>
+  801ff6:	eb 04                	jmp    801ffc <strnlen+0x22>
+  801ff8:	c3                   	ret
+  801ff9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801ffc:	c3                   	ret
+
+0000000000801ffd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801ffd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802000:	ba 00 00 00 00       	mov    $0x0,%edx
+  802005:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802009:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80200c:	48 83 c2 01          	add    $0x1,%rdx
+  802010:	84 c9                	test   %cl,%cl
+  802012:	75 f1                	jne    802005 <strcpy+0x8>
+        ;
+    return res;
+}
+  802014:	c3                   	ret
+
+0000000000802015 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802015:	55                   	push   %rbp
+  802016:	48 89 e5             	mov    %rsp,%rbp
+  802019:	41 54                	push   %r12
+  80201b:	53                   	push   %rbx
+  80201c:	48 89 fb             	mov    %rdi,%rbx
+  80201f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802022:	48 b8 bf 1f 80 00 00 	movabs $0x801fbf,%rax
+  802029:	00 00 00 
+  80202c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80202e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802032:	4c 89 e6             	mov    %r12,%rsi
+  802035:	48 b8 fd 1f 80 00 00 	movabs $0x801ffd,%rax
+  80203c:	00 00 00 
+  80203f:	ff d0                	call   *%rax
+    return dst;
+}
+  802041:	48 89 d8             	mov    %rbx,%rax
+  802044:	5b                   	pop    %rbx
+  802045:	41 5c                	pop    %r12
+  802047:	5d                   	pop    %rbp
+  802048:	c3                   	ret
+
+0000000000802049 <toupper>:
+
+int
+toupper(int ch) {
+  802049:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80204b:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80204e:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802051:	83 f9 1a             	cmp    $0x1a,%ecx
+  802054:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802057:	c3                   	ret
+
+0000000000802058 <tolower>:
+
+int
+tolower(int ch) {
+  802058:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80205a:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80205d:	8d 57 20             	lea    0x20(%rdi),%edx
+  802060:	83 f9 1a             	cmp    $0x1a,%ecx
+  802063:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802066:	c3                   	ret
+
+0000000000802067 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802067:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80206a:	48 85 d2             	test   %rdx,%rdx
+  80206d:	74 1f                	je     80208e <strncpy+0x27>
+  80206f:	48 01 fa             	add    %rdi,%rdx
+  802072:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802075:	48 83 c1 01          	add    $0x1,%rcx
+  802079:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80207d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802081:	41 80 f8 01          	cmp    $0x1,%r8b
+  802085:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802089:	48 39 ca             	cmp    %rcx,%rdx
+  80208c:	75 e7                	jne    802075 <strncpy+0xe>
+    }
+    return ret;
+}
+  80208e:	c3                   	ret
+
+000000000080208f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80208f:	48 89 f8             	mov    %rdi,%rax
+  802092:	48 85 d2             	test   %rdx,%rdx
+  802095:	74 24                	je     8020bb <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802097:	48 83 ea 01          	sub    $0x1,%rdx
+  80209b:	74 1b                	je     8020b8 <strlcpy+0x29>
+  80209d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8020a1:	0f b6 16             	movzbl (%rsi),%edx
+  8020a4:	84 d2                	test   %dl,%dl
+  8020a6:	74 10                	je     8020b8 <strlcpy+0x29>
+            *dst++ = *src++;
+  8020a8:	48 83 c6 01          	add    $0x1,%rsi
+  8020ac:	48 83 c0 01          	add    $0x1,%rax
+  8020b0:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8020b3:	48 39 c8             	cmp    %rcx,%rax
+  8020b6:	75 e9                	jne    8020a1 <strlcpy+0x12>
+        *dst = '\0';
+  8020b8:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8020bb:	48 29 f8             	sub    %rdi,%rax
+}
+  8020be:	c3                   	ret
+
+00000000008020bf <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8020bf:	0f b6 07             	movzbl (%rdi),%eax
+  8020c2:	84 c0                	test   %al,%al
+  8020c4:	74 13                	je     8020d9 <strcmp+0x1a>
+  8020c6:	38 06                	cmp    %al,(%rsi)
+  8020c8:	75 0f                	jne    8020d9 <strcmp+0x1a>
+  8020ca:	48 83 c7 01          	add    $0x1,%rdi
+  8020ce:	48 83 c6 01          	add    $0x1,%rsi
+  8020d2:	0f b6 07             	movzbl (%rdi),%eax
+  8020d5:	84 c0                	test   %al,%al
+  8020d7:	75 ed                	jne    8020c6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020d9:	0f b6 c0             	movzbl %al,%eax
+  8020dc:	0f b6 16             	movzbl (%rsi),%edx
+  8020df:	29 d0                	sub    %edx,%eax
+}
+  8020e1:	c3                   	ret
+
+00000000008020e2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020e2:	48 85 d2             	test   %rdx,%rdx
+  8020e5:	74 1f                	je     802106 <strncmp+0x24>
+  8020e7:	0f b6 07             	movzbl (%rdi),%eax
+  8020ea:	84 c0                	test   %al,%al
+  8020ec:	74 1e                	je     80210c <strncmp+0x2a>
+  8020ee:	3a 06                	cmp    (%rsi),%al
+  8020f0:	75 1a                	jne    80210c <strncmp+0x2a>
+  8020f2:	48 83 c7 01          	add    $0x1,%rdi
+  8020f6:	48 83 c6 01          	add    $0x1,%rsi
+  8020fa:	48 83 ea 01          	sub    $0x1,%rdx
+  8020fe:	75 e7                	jne    8020e7 <strncmp+0x5>
+
+    if (!n) return 0;
+  802100:	b8 00 00 00 00       	mov    $0x0,%eax
+  802105:	c3                   	ret
+  802106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210b:	c3                   	ret
+  80210c:	48 85 d2             	test   %rdx,%rdx
+  80210f:	74 09                	je     80211a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802111:	0f b6 07             	movzbl (%rdi),%eax
+  802114:	0f b6 16             	movzbl (%rsi),%edx
+  802117:	29 d0                	sub    %edx,%eax
+  802119:	c3                   	ret
+    if (!n) return 0;
+  80211a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80211f:	c3                   	ret
+
+0000000000802120 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802120:	0f b6 17             	movzbl (%rdi),%edx
+  802123:	84 d2                	test   %dl,%dl
+  802125:	74 18                	je     80213f <strchr+0x1f>
+        if (*str == c) {
+  802127:	0f be d2             	movsbl %dl,%edx
+  80212a:	39 f2                	cmp    %esi,%edx
+  80212c:	74 17                	je     802145 <strchr+0x25>
+    for (; *str; str++) {
+  80212e:	48 83 c7 01          	add    $0x1,%rdi
+  802132:	0f b6 17             	movzbl (%rdi),%edx
+  802135:	84 d2                	test   %dl,%dl
+  802137:	75 ee                	jne    802127 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213e:	c3                   	ret
+  80213f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802144:	c3                   	ret
+  802145:	48 89 f8             	mov    %rdi,%rax
+}
+  802148:	c3                   	ret
+
+0000000000802149 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802149:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80214c:	0f b6 17             	movzbl (%rdi),%edx
+  80214f:	84 d2                	test   %dl,%dl
+  802151:	74 13                	je     802166 <strfind+0x1d>
+  802153:	0f be d2             	movsbl %dl,%edx
+  802156:	39 f2                	cmp    %esi,%edx
+  802158:	74 0b                	je     802165 <strfind+0x1c>
+  80215a:	48 83 c0 01          	add    $0x1,%rax
+  80215e:	0f b6 10             	movzbl (%rax),%edx
+  802161:	84 d2                	test   %dl,%dl
+  802163:	75 ee                	jne    802153 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802165:	c3                   	ret
+  802166:	c3                   	ret
+
+0000000000802167 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802167:	48 39 f7             	cmp    %rsi,%rdi
+  80216a:	74 65                	je     8021d1 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80216c:	55                   	push   %rbp
+  80216d:	48 89 e5             	mov    %rsp,%rbp
+  802170:	41 57                	push   %r15
+  802172:	41 56                	push   %r14
+  802174:	41 55                	push   %r13
+  802176:	41 54                	push   %r12
+  802178:	53                   	push   %rbx
+  802179:	48 83 ec 18          	sub    $0x18,%rsp
+  80217d:	48 89 fb             	mov    %rdi,%rbx
+  802180:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802183:	49 bf 58 20 80 00 00 	movabs $0x802058,%r15
+  80218a:	00 00 00 
+  80218d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802191:	41 0f b6 fd          	movzbl %r13b,%edi
+  802195:	41 ff d7             	call   *%r15
+  802198:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80219b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021a0:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021a4:	41 ff d7             	call   *%r15
+  8021a7:	89 c2                	mov    %eax,%edx
+  8021a9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021ac:	29 d0                	sub    %edx,%eax
+  8021ae:	75 12                	jne    8021c2 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8021b0:	48 83 c3 01          	add    $0x1,%rbx
+  8021b4:	45 84 ed             	test   %r13b,%r13b
+  8021b7:	74 09                	je     8021c2 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8021b9:	49 83 c4 01          	add    $0x1,%r12
+  8021bd:	45 84 f6             	test   %r14b,%r14b
+  8021c0:	75 cb                	jne    80218d <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021c2:	48 83 c4 18          	add    $0x18,%rsp
+  8021c6:	5b                   	pop    %rbx
+  8021c7:	41 5c                	pop    %r12
+  8021c9:	41 5d                	pop    %r13
+  8021cb:	41 5e                	pop    %r14
+  8021cd:	41 5f                	pop    %r15
+  8021cf:	5d                   	pop    %rbp
+  8021d0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d6:	c3                   	ret
+
+00000000008021d7 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021d7:	48 39 f7             	cmp    %rsi,%rdi
+  8021da:	74 7d                	je     802259 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021dc:	55                   	push   %rbp
+  8021dd:	48 89 e5             	mov    %rsp,%rbp
+  8021e0:	41 57                	push   %r15
+  8021e2:	41 56                	push   %r14
+  8021e4:	41 55                	push   %r13
+  8021e6:	41 54                	push   %r12
+  8021e8:	53                   	push   %rbx
+  8021e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ed:	48 89 fb             	mov    %rdi,%rbx
+  8021f0:	49 89 f4             	mov    %rsi,%r12
+  8021f3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021fb:	49 bf 58 20 80 00 00 	movabs $0x802058,%r15
+  802202:	00 00 00 
+    while (n--) {
+  802205:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802209:	48 39 c3             	cmp    %rax,%rbx
+  80220c:	74 37                	je     802245 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80220e:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802212:	41 0f b6 fd          	movzbl %r13b,%edi
+  802216:	41 ff d7             	call   *%r15
+  802219:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80221c:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802221:	41 0f b6 fe          	movzbl %r14b,%edi
+  802225:	41 ff d7             	call   *%r15
+  802228:	89 c2                	mov    %eax,%edx
+  80222a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80222d:	29 d0                	sub    %edx,%eax
+  80222f:	75 19                	jne    80224a <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802231:	48 83 c3 01          	add    $0x1,%rbx
+  802235:	45 84 ed             	test   %r13b,%r13b
+  802238:	74 10                	je     80224a <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80223a:	49 83 c4 01          	add    $0x1,%r12
+  80223e:	45 84 f6             	test   %r14b,%r14b
+  802241:	75 c2                	jne    802205 <strncasecmp+0x2e>
+  802243:	eb 05                	jmp    80224a <strncasecmp+0x73>
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80224a:	48 83 c4 18          	add    $0x18,%rsp
+  80224e:	5b                   	pop    %rbx
+  80224f:	41 5c                	pop    %r12
+  802251:	41 5d                	pop    %r13
+  802253:	41 5e                	pop    %r14
+  802255:	41 5f                	pop    %r15
+  802257:	5d                   	pop    %rbp
+  802258:	c3                   	ret
+    if (p1 == p2) return 0;
+  802259:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225e:	c3                   	ret
+
+000000000080225f <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80225f:	83 e7 df             	and    $0xffffffdf,%edi
+  802262:	83 ef 41             	sub    $0x41,%edi
+  802265:	83 ff 19             	cmp    $0x19,%edi
+  802268:	0f 96 c0             	setbe  %al
+}
+  80226b:	c3                   	ret
+
+000000000080226c <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80226c:	83 ff 20             	cmp    $0x20,%edi
+  80226f:	0f 94 c0             	sete   %al
+  802272:	83 ff 09             	cmp    $0x9,%edi
+  802275:	0f 94 c2             	sete   %dl
+  802278:	09 d0                	or     %edx,%eax
+}
+  80227a:	c3                   	ret
+
+000000000080227b <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802281:	48 bf 5f 61 80 00 00 	movabs $0x80615f,%rdi
+  802288:	00 00 00 
+  80228b:	48 b8 20 21 80 00 00 	movabs $0x802120,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+  802297:	48 85 c0             	test   %rax,%rax
+  80229a:	0f 95 c0             	setne  %al
+}
+  80229d:	5d                   	pop    %rbp
+  80229e:	c3                   	ret
+
+000000000080229f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80229f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8022a2:	48 89 f8             	mov    %rdi,%rax
+  8022a5:	48 f7 d8             	neg    %rax
+  8022a8:	83 e0 07             	and    $0x7,%eax
+  8022ab:	49 89 d1             	mov    %rdx,%r9
+  8022ae:	49 29 c1             	sub    %rax,%r9
+  8022b1:	78 36                	js     8022e9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8022b3:	40 0f b6 c6          	movzbl %sil,%eax
+  8022b7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8022be:	01 01 01 
+  8022c1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022c5:	40 f6 c7 07          	test   $0x7,%dil
+  8022c9:	75 38                	jne    802303 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022cb:	4c 89 c9             	mov    %r9,%rcx
+  8022ce:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022d2:	74 0c                	je     8022e0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022d4:	fc                   	cld
+  8022d5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022d8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022dc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022e0:	4d 85 c9             	test   %r9,%r9
+  8022e3:	75 45                	jne    80232a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022e5:	4c 89 c0             	mov    %r8,%rax
+  8022e8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022e9:	48 85 d2             	test   %rdx,%rdx
+  8022ec:	74 f7                	je     8022e5 <memset+0x46>
+  8022ee:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022f1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022f4:	48 83 c0 01          	add    $0x1,%rax
+  8022f8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022fc:	48 39 c2             	cmp    %rax,%rdx
+  8022ff:	75 f3                	jne    8022f4 <memset+0x55>
+  802301:	eb e2                	jmp    8022e5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802303:	40 f6 c7 01          	test   $0x1,%dil
+  802307:	74 06                	je     80230f <memset+0x70>
+  802309:	88 07                	mov    %al,(%rdi)
+  80230b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80230f:	40 f6 c7 02          	test   $0x2,%dil
+  802313:	74 07                	je     80231c <memset+0x7d>
+  802315:	66 89 07             	mov    %ax,(%rdi)
+  802318:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80231c:	40 f6 c7 04          	test   $0x4,%dil
+  802320:	74 a9                	je     8022cb <memset+0x2c>
+  802322:	89 07                	mov    %eax,(%rdi)
+  802324:	48 83 c7 04          	add    $0x4,%rdi
+  802328:	eb a1                	jmp    8022cb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80232a:	41 f6 c1 04          	test   $0x4,%r9b
+  80232e:	74 06                	je     802336 <memset+0x97>
+  802330:	89 07                	mov    %eax,(%rdi)
+  802332:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802336:	41 f6 c1 02          	test   $0x2,%r9b
+  80233a:	74 07                	je     802343 <memset+0xa4>
+  80233c:	66 89 07             	mov    %ax,(%rdi)
+  80233f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802343:	41 f6 c1 01          	test   $0x1,%r9b
+  802347:	74 9c                	je     8022e5 <memset+0x46>
+  802349:	88 07                	mov    %al,(%rdi)
+  80234b:	eb 98                	jmp    8022e5 <memset+0x46>
+
+000000000080234d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80234d:	48 89 f8             	mov    %rdi,%rax
+  802350:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802353:	48 39 fe             	cmp    %rdi,%rsi
+  802356:	73 3b                	jae    802393 <memmove+0x46>
+  802358:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80235c:	48 39 d7             	cmp    %rdx,%rdi
+  80235f:	73 32                	jae    802393 <memmove+0x46>
+        s += n;
+        d += n;
+  802361:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802365:	48 89 d6             	mov    %rdx,%rsi
+  802368:	48 09 fe             	or     %rdi,%rsi
+  80236b:	48 09 ce             	or     %rcx,%rsi
+  80236e:	40 f6 c6 07          	test   $0x7,%sil
+  802372:	75 12                	jne    802386 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802374:	48 83 ef 08          	sub    $0x8,%rdi
+  802378:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80237c:	48 c1 e9 03          	shr    $0x3,%rcx
+  802380:	fd                   	std
+  802381:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802384:	fc                   	cld
+  802385:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802386:	48 83 ef 01          	sub    $0x1,%rdi
+  80238a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80238e:	fd                   	std
+  80238f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802391:	eb f1                	jmp    802384 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802393:	48 89 f2             	mov    %rsi,%rdx
+  802396:	48 09 c2             	or     %rax,%rdx
+  802399:	48 09 ca             	or     %rcx,%rdx
+  80239c:	f6 c2 07             	test   $0x7,%dl
+  80239f:	75 0c                	jne    8023ad <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8023a1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8023a5:	48 89 c7             	mov    %rax,%rdi
+  8023a8:	fc                   	cld
+  8023a9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8023ac:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8023ad:	48 89 c7             	mov    %rax,%rdi
+  8023b0:	fc                   	cld
+  8023b1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8023b3:	c3                   	ret
+
+00000000008023b4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8023b4:	55                   	push   %rbp
+  8023b5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8023b8:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+}
+  8023c4:	5d                   	pop    %rbp
+  8023c5:	c3                   	ret
+
+00000000008023c6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023c6:	55                   	push   %rbp
+  8023c7:	48 89 e5             	mov    %rsp,%rbp
+  8023ca:	41 57                	push   %r15
+  8023cc:	41 56                	push   %r14
+  8023ce:	41 55                	push   %r13
+  8023d0:	41 54                	push   %r12
+  8023d2:	53                   	push   %rbx
+  8023d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d7:	49 89 fe             	mov    %rdi,%r14
+  8023da:	49 89 f7             	mov    %rsi,%r15
+  8023dd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023e0:	48 89 f7             	mov    %rsi,%rdi
+  8023e3:	48 b8 bf 1f 80 00 00 	movabs $0x801fbf,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+  8023ef:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023f2:	48 89 de             	mov    %rbx,%rsi
+  8023f5:	4c 89 f7             	mov    %r14,%rdi
+  8023f8:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  8023ff:	00 00 00 
+  802402:	ff d0                	call   *%rax
+  802404:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802407:	48 39 c3             	cmp    %rax,%rbx
+  80240a:	74 36                	je     802442 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80240c:	48 89 d8             	mov    %rbx,%rax
+  80240f:	4c 29 e8             	sub    %r13,%rax
+  802412:	49 39 c4             	cmp    %rax,%r12
+  802415:	73 31                	jae    802448 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802417:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80241c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802420:	4c 89 fe             	mov    %r15,%rsi
+  802423:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  80242a:	00 00 00 
+  80242d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80242f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802433:	48 83 c4 08          	add    $0x8,%rsp
+  802437:	5b                   	pop    %rbx
+  802438:	41 5c                	pop    %r12
+  80243a:	41 5d                	pop    %r13
+  80243c:	41 5e                	pop    %r14
+  80243e:	41 5f                	pop    %r15
+  802440:	5d                   	pop    %rbp
+  802441:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802442:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802446:	eb eb                	jmp    802433 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802448:	48 83 eb 01          	sub    $0x1,%rbx
+  80244c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802450:	48 89 da             	mov    %rbx,%rdx
+  802453:	4c 89 fe             	mov    %r15,%rsi
+  802456:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802462:	49 01 de             	add    %rbx,%r14
+  802465:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80246a:	eb c3                	jmp    80242f <strlcat+0x69>
+
+000000000080246c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80246c:	48 85 d2             	test   %rdx,%rdx
+  80246f:	74 2d                	je     80249e <memcmp+0x32>
+  802471:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802476:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80247a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80247f:	44 38 c1             	cmp    %r8b,%cl
+  802482:	75 0f                	jne    802493 <memcmp+0x27>
+    while (n-- > 0) {
+  802484:	48 83 c0 01          	add    $0x1,%rax
+  802488:	48 39 c2             	cmp    %rax,%rdx
+  80248b:	75 e9                	jne    802476 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80248d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802492:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802493:	0f b6 c1             	movzbl %cl,%eax
+  802496:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80249a:	44 29 c0             	sub    %r8d,%eax
+  80249d:	c3                   	ret
+    return 0;
+  80249e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a3:	c3                   	ret
+
+00000000008024a4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8024a4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8024a8:	48 39 c7             	cmp    %rax,%rdi
+  8024ab:	73 0f                	jae    8024bc <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8024ad:	40 38 37             	cmp    %sil,(%rdi)
+  8024b0:	74 0e                	je     8024c0 <memfind+0x1c>
+    for (; src < end; src++) {
+  8024b2:	48 83 c7 01          	add    $0x1,%rdi
+  8024b6:	48 39 f8             	cmp    %rdi,%rax
+  8024b9:	75 f2                	jne    8024ad <memfind+0x9>
+  8024bb:	c3                   	ret
+  8024bc:	48 89 f8             	mov    %rdi,%rax
+  8024bf:	c3                   	ret
+  8024c0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024c3:	c3                   	ret
+
+00000000008024c4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024c4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024c7:	0f b6 37             	movzbl (%rdi),%esi
+  8024ca:	40 80 fe 20          	cmp    $0x20,%sil
+  8024ce:	74 06                	je     8024d6 <strtol+0x12>
+  8024d0:	40 80 fe 09          	cmp    $0x9,%sil
+  8024d4:	75 13                	jne    8024e9 <strtol+0x25>
+  8024d6:	48 83 c7 01          	add    $0x1,%rdi
+  8024da:	0f b6 37             	movzbl (%rdi),%esi
+  8024dd:	40 80 fe 20          	cmp    $0x20,%sil
+  8024e1:	74 f3                	je     8024d6 <strtol+0x12>
+  8024e3:	40 80 fe 09          	cmp    $0x9,%sil
+  8024e7:	74 ed                	je     8024d6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024e9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024ec:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024ef:	3c 01                	cmp    $0x1,%al
+  8024f1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024f5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024fb:	75 0f                	jne    80250c <strtol+0x48>
+  8024fd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802500:	74 14                	je     802516 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802502:	85 d2                	test   %edx,%edx
+  802504:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802509:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80250c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802511:	4c 63 ca             	movslq %edx,%r9
+  802514:	eb 36                	jmp    80254c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802516:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80251a:	74 0f                	je     80252b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80251c:	85 d2                	test   %edx,%edx
+  80251e:	75 ec                	jne    80250c <strtol+0x48>
+        s++;
+  802520:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802524:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802529:	eb e1                	jmp    80250c <strtol+0x48>
+        s += 2;
+  80252b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80252f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802534:	eb d6                	jmp    80250c <strtol+0x48>
+            dig -= '0';
+  802536:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802539:	44 0f b6 c1          	movzbl %cl,%r8d
+  80253d:	41 39 d0             	cmp    %edx,%r8d
+  802540:	7d 21                	jge    802563 <strtol+0x9f>
+        val = val * base + dig;
+  802542:	49 0f af c1          	imul   %r9,%rax
+  802546:	0f b6 c9             	movzbl %cl,%ecx
+  802549:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80254c:	48 83 c7 01          	add    $0x1,%rdi
+  802550:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802554:	80 f9 39             	cmp    $0x39,%cl
+  802557:	76 dd                	jbe    802536 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802559:	80 f9 7b             	cmp    $0x7b,%cl
+  80255c:	77 05                	ja     802563 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80255e:	83 e9 57             	sub    $0x57,%ecx
+  802561:	eb d6                	jmp    802539 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802563:	4d 85 d2             	test   %r10,%r10
+  802566:	74 03                	je     80256b <strtol+0xa7>
+  802568:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80256b:	48 89 c2             	mov    %rax,%rdx
+  80256e:	48 f7 da             	neg    %rdx
+  802571:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802575:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802579:	c3                   	ret
+
+000000000080257a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80257a:	55                   	push   %rbp
+  80257b:	48 89 e5             	mov    %rsp,%rbp
+  80257e:	53                   	push   %rbx
+  80257f:	48 89 fa             	mov    %rdi,%rdx
+  802582:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802585:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80258a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80258f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802594:	be 00 00 00 00       	mov    $0x0,%esi
+  802599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80259f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025a5:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8025a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ab:	c9                   	leave
+  8025ac:	c3                   	ret
+
+00000000008025ad <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8025ad:	55                   	push   %rbp
+  8025ae:	48 89 e5             	mov    %rsp,%rbp
+  8025b1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8025b2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025dc:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025e2:	c9                   	leave
+  8025e3:	c3                   	ret
+
+00000000008025e4 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025e4:	55                   	push   %rbp
+  8025e5:	48 89 e5             	mov    %rsp,%rbp
+  8025e8:	53                   	push   %rbx
+  8025e9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025ec:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802600:	be 00 00 00 00       	mov    $0x0,%esi
+  802605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80260b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802611:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802613:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802617:	c9                   	leave
+  802618:	c3                   	ret
+
+0000000000802619 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802619:	55                   	push   %rbp
+  80261a:	48 89 e5             	mov    %rsp,%rbp
+  80261d:	53                   	push   %rbx
+  80261e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802622:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802625:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80262a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80262f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802634:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802639:	be 00 00 00 00       	mov    $0x0,%esi
+  80263e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802644:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80264a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80264c:	48 85 c0             	test   %rax,%rax
+  80264f:	7f 06                	jg     802657 <sys_env_destroy+0x3e>
+}
+  802651:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802655:	c9                   	leave
+  802656:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802657:	49 89 c0             	mov    %rax,%r8
+  80265a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80265f:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802666:	00 00 00 
+  802669:	be 27 00 00 00       	mov    $0x27,%esi
+  80266e:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802675:	00 00 00 
+  802678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267d:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802684:	00 00 00 
+  802687:	41 ff d1             	call   *%r9
+
+000000000080268a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80268a:	55                   	push   %rbp
+  80268b:	48 89 e5             	mov    %rsp,%rbp
+  80268e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80268f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802694:	ba 00 00 00 00       	mov    $0x0,%edx
+  802699:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80269e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026b9:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026bf:	c9                   	leave
+  8026c0:	c3                   	ret
+
+00000000008026c1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8026c1:	55                   	push   %rbp
+  8026c2:	48 89 e5             	mov    %rsp,%rbp
+  8026c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026c6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026df:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026f0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026f6:	c9                   	leave
+  8026f7:	c3                   	ret
+
+00000000008026f8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026f8:	55                   	push   %rbp
+  8026f9:	48 89 e5             	mov    %rsp,%rbp
+  8026fc:	53                   	push   %rbx
+  8026fd:	48 89 fa             	mov    %rdi,%rdx
+  802700:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802703:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802708:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80270f:	00 00 00 
+  802712:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802717:	be 00 00 00 00       	mov    $0x0,%esi
+  80271c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802722:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802728:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80272a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80272e:	c9                   	leave
+  80272f:	c3                   	ret
+
+0000000000802730 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802730:	55                   	push   %rbp
+  802731:	48 89 e5             	mov    %rsp,%rbp
+  802734:	53                   	push   %rbx
+  802735:	49 89 f8             	mov    %rdi,%r8
+  802738:	48 89 d3             	mov    %rdx,%rbx
+  80273b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80273e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802743:	4c 89 c2             	mov    %r8,%rdx
+  802746:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802749:	be 00 00 00 00       	mov    $0x0,%esi
+  80274e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802754:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80275a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80275c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802760:	c9                   	leave
+  802761:	c3                   	ret
+
+0000000000802762 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802762:	55                   	push   %rbp
+  802763:	48 89 e5             	mov    %rsp,%rbp
+  802766:	53                   	push   %rbx
+  802767:	48 83 ec 08          	sub    $0x8,%rsp
+  80276b:	89 f8                	mov    %edi,%eax
+  80276d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802770:	48 63 f9             	movslq %ecx,%rdi
+  802773:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802776:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80277b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80277e:	be 00 00 00 00       	mov    $0x0,%esi
+  802783:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802789:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80278f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802791:	48 85 c0             	test   %rax,%rax
+  802794:	7f 06                	jg     80279c <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802796:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80279c:	49 89 c0             	mov    %rax,%r8
+  80279f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8027a4:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8027ab:	00 00 00 
+  8027ae:	be 27 00 00 00       	mov    $0x27,%esi
+  8027b3:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  8027ba:	00 00 00 
+  8027bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c2:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  8027c9:	00 00 00 
+  8027cc:	41 ff d1             	call   *%r9
+
+00000000008027cf <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027cf:	55                   	push   %rbp
+  8027d0:	48 89 e5             	mov    %rsp,%rbp
+  8027d3:	53                   	push   %rbx
+  8027d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d8:	89 f8                	mov    %edi,%eax
+  8027da:	49 89 f2             	mov    %rsi,%r10
+  8027dd:	48 89 cf             	mov    %rcx,%rdi
+  8027e0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027e3:	48 63 da             	movslq %edx,%rbx
+  8027e6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027e9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ee:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027f1:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027fc:	48 85 c0             	test   %rax,%rax
+  8027ff:	7f 06                	jg     802807 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802801:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802805:	c9                   	leave
+  802806:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802807:	49 89 c0             	mov    %rax,%r8
+  80280a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80280f:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802816:	00 00 00 
+  802819:	be 27 00 00 00       	mov    $0x27,%esi
+  80281e:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802825:	00 00 00 
+  802828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282d:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802834:	00 00 00 
+  802837:	41 ff d1             	call   *%r9
+
+000000000080283a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80283a:	55                   	push   %rbp
+  80283b:	48 89 e5             	mov    %rsp,%rbp
+  80283e:	53                   	push   %rbx
+  80283f:	48 83 ec 08          	sub    $0x8,%rsp
+  802843:	48 89 f1             	mov    %rsi,%rcx
+  802846:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802849:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80284c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802851:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802856:	be 00 00 00 00       	mov    $0x0,%esi
+  80285b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802861:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802867:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802869:	48 85 c0             	test   %rax,%rax
+  80286c:	7f 06                	jg     802874 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80286e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802872:	c9                   	leave
+  802873:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802874:	49 89 c0             	mov    %rax,%r8
+  802877:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80287c:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802883:	00 00 00 
+  802886:	be 27 00 00 00       	mov    $0x27,%esi
+  80288b:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802892:	00 00 00 
+  802895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289a:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  8028a1:	00 00 00 
+  8028a4:	41 ff d1             	call   *%r9
+
+00000000008028a7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8028a7:	55                   	push   %rbp
+  8028a8:	48 89 e5             	mov    %rsp,%rbp
+  8028ab:	53                   	push   %rbx
+  8028ac:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  8028b0:	48 63 ce             	movslq %esi,%rcx
+  8028b3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028b6:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028d8:	48 85 c0             	test   %rax,%rax
+  8028db:	7f 06                	jg     8028e3 <sys_env_set_status+0x3c>
+}
+  8028dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028e1:	c9                   	leave
+  8028e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028e3:	49 89 c0             	mov    %rax,%r8
+  8028e6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028eb:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8028f2:	00 00 00 
+  8028f5:	be 27 00 00 00       	mov    $0x27,%esi
+  8028fa:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802901:	00 00 00 
+  802904:	b8 00 00 00 00       	mov    $0x0,%eax
+  802909:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802910:	00 00 00 
+  802913:	41 ff d1             	call   *%r9
+
+0000000000802916 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802916:	55                   	push   %rbp
+  802917:	48 89 e5             	mov    %rsp,%rbp
+  80291a:	53                   	push   %rbx
+  80291b:	48 83 ec 08          	sub    $0x8,%rsp
+  80291f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802922:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802925:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80292a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80292f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802934:	be 00 00 00 00       	mov    $0x0,%esi
+  802939:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80293f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802945:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802947:	48 85 c0             	test   %rax,%rax
+  80294a:	7f 06                	jg     802952 <sys_env_set_trapframe+0x3c>
+}
+  80294c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802950:	c9                   	leave
+  802951:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802952:	49 89 c0             	mov    %rax,%r8
+  802955:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80295a:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802961:	00 00 00 
+  802964:	be 27 00 00 00       	mov    $0x27,%esi
+  802969:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802970:	00 00 00 
+  802973:	b8 00 00 00 00       	mov    $0x0,%eax
+  802978:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  80297f:	00 00 00 
+  802982:	41 ff d1             	call   *%r9
+
+0000000000802985 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802985:	55                   	push   %rbp
+  802986:	48 89 e5             	mov    %rsp,%rbp
+  802989:	53                   	push   %rbx
+  80298a:	48 83 ec 08          	sub    $0x8,%rsp
+  80298e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802991:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802994:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802999:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80299e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029b6:	48 85 c0             	test   %rax,%rax
+  8029b9:	7f 06                	jg     8029c1 <sys_env_set_pgfault_upcall+0x3c>
+}
+  8029bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029bf:	c9                   	leave
+  8029c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029c1:	49 89 c0             	mov    %rax,%r8
+  8029c4:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029c9:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8029d0:	00 00 00 
+  8029d3:	be 27 00 00 00       	mov    $0x27,%esi
+  8029d8:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  8029df:	00 00 00 
+  8029e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e7:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  8029ee:	00 00 00 
+  8029f1:	41 ff d1             	call   *%r9
+
+00000000008029f4 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029f4:	55                   	push   %rbp
+  8029f5:	48 89 e5             	mov    %rsp,%rbp
+  8029f8:	53                   	push   %rbx
+  8029f9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029fd:	40 0f b6 ce          	movzbl %sil,%ecx
+  802a01:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a04:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a13:	be 00 00 00 00       	mov    $0x0,%esi
+  802a18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a24:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a26:	48 85 c0             	test   %rax,%rax
+  802a29:	7f 06                	jg     802a31 <sys_env_set_reclaim+0x3d>
+}
+  802a2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a2f:	c9                   	leave
+  802a30:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a31:	49 89 c0             	mov    %rax,%r8
+  802a34:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a39:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802a40:	00 00 00 
+  802a43:	be 27 00 00 00       	mov    $0x27,%esi
+  802a48:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802a4f:	00 00 00 
+  802a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a57:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802a5e:	00 00 00 
+  802a61:	41 ff d1             	call   *%r9
+
+0000000000802a64 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a64:	55                   	push   %rbp
+  802a65:	48 89 e5             	mov    %rsp,%rbp
+  802a68:	53                   	push   %rbx
+  802a69:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a6d:	48 63 ce             	movslq %esi,%rcx
+  802a70:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a73:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a7d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a82:	be 00 00 00 00       	mov    $0x0,%esi
+  802a87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a93:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a95:	48 85 c0             	test   %rax,%rax
+  802a98:	7f 06                	jg     802aa0 <sys_env_set_nice+0x3c>
+}
+  802a9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a9e:	c9                   	leave
+  802a9f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802aa0:	49 89 c0             	mov    %rax,%r8
+  802aa3:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802aa8:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802aaf:	00 00 00 
+  802ab2:	be 27 00 00 00       	mov    $0x27,%esi
+  802ab7:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802abe:	00 00 00 
+  802ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac6:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802acd:	00 00 00 
+  802ad0:	41 ff d1             	call   *%r9
+
+0000000000802ad3 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ad3:	55                   	push   %rbp
+  802ad4:	48 89 e5             	mov    %rsp,%rbp
+  802ad7:	53                   	push   %rbx
+  802ad8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802adb:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ae0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ae5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aef:	be 00 00 00 00       	mov    $0x0,%esi
+  802af4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802afa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b00:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802b02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b06:	c9                   	leave
+  802b07:	c3                   	ret
+
+0000000000802b08 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b08:	55                   	push   %rbp
+  802b09:	48 89 e5             	mov    %rsp,%rbp
+  802b0c:	53                   	push   %rbx
+  802b0d:	89 f8                	mov    %edi,%eax
+  802b0f:	49 89 f1             	mov    %rsi,%r9
+  802b12:	48 89 d3             	mov    %rdx,%rbx
+  802b15:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b18:	49 63 f0             	movslq %r8d,%rsi
+  802b1b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b1e:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b23:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b32:	cd 30                	int    $0x30
+}
+  802b34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b38:	c9                   	leave
+  802b39:	c3                   	ret
+
+0000000000802b3a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b3a:	55                   	push   %rbp
+  802b3b:	48 89 e5             	mov    %rsp,%rbp
+  802b3e:	53                   	push   %rbx
+  802b3f:	89 f8                	mov    %edi,%eax
+  802b41:	49 89 f1             	mov    %rsi,%r9
+  802b44:	48 89 d3             	mov    %rdx,%rbx
+  802b47:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b4a:	49 63 f0             	movslq %r8d,%rsi
+  802b4d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b50:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b55:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b64:	cd 30                	int    $0x30
+}
+  802b66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b6a:	c9                   	leave
+  802b6b:	c3                   	ret
+
+0000000000802b6c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b6c:	55                   	push   %rbp
+  802b6d:	48 89 e5             	mov    %rsp,%rbp
+  802b70:	53                   	push   %rbx
+  802b71:	48 83 ec 08          	sub    $0x8,%rsp
+  802b75:	89 f8                	mov    %edi,%eax
+  802b77:	49 89 f2             	mov    %rsi,%r10
+  802b7a:	48 89 d3             	mov    %rdx,%rbx
+  802b7d:	48 89 cf             	mov    %rcx,%rdi
+  802b80:	44 89 c6             	mov    %r8d,%esi
+  802b83:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b86:	48 63 f6             	movslq %esi,%rsi
+  802b89:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b8c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b91:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b94:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b98:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b9a:	48 85 c0             	test   %rax,%rax
+  802b9d:	7f 06                	jg     802ba5 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ba5:	49 89 c0             	mov    %rax,%r8
+  802ba8:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802bad:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802bb4:	00 00 00 
+  802bb7:	be 27 00 00 00       	mov    $0x27,%esi
+  802bbc:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802bc3:	00 00 00 
+  802bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcb:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802bd2:	00 00 00 
+  802bd5:	41 ff d1             	call   *%r9
+
+0000000000802bd8 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+  802bdc:	53                   	push   %rbx
+  802bdd:	48 83 ec 08          	sub    $0x8,%rsp
+  802be1:	48 89 f1             	mov    %rsi,%rcx
+  802be4:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802be7:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802beb:	48 8b 1a             	mov    (%rdx),%rbx
+  802bee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bf1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bf6:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bfa:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bfe:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802c02:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c04:	48 85 c0             	test   %rax,%rax
+  802c07:	7f 06                	jg     802c0f <sys_ipc_call_short+0x37>
+}
+  802c09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c0d:	c9                   	leave
+  802c0e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c0f:	49 89 c0             	mov    %rax,%r8
+  802c12:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802c17:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802c1e:	00 00 00 
+  802c21:	be 27 00 00 00       	mov    $0x27,%esi
+  802c26:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802c2d:	00 00 00 
+  802c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c35:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802c3c:	00 00 00 
+  802c3f:	41 ff d1             	call   *%r9
+
+0000000000802c42 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c42:	55                   	push   %rbp
+  802c43:	48 89 e5             	mov    %rsp,%rbp
+  802c46:	53                   	push   %rbx
+  802c47:	48 83 ec 08          	sub    $0x8,%rsp
+  802c4b:	89 f8                	mov    %edi,%eax
+  802c4d:	49 89 f2             	mov    %rsi,%r10
+  802c50:	48 89 d3             	mov    %rdx,%rbx
+  802c53:	48 89 cf             	mov    %rcx,%rdi
+  802c56:	44 89 c6             	mov    %r8d,%esi
+  802c59:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c5c:	48 63 f6             	movslq %esi,%rsi
+  802c5f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c62:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c67:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c6a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c6e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c70:	48 85 c0             	test   %rax,%rax
+  802c73:	7f 06                	jg     802c7b <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c79:	c9                   	leave
+  802c7a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c7b:	49 89 c0             	mov    %rax,%r8
+  802c7e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c83:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802c8a:	00 00 00 
+  802c8d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c92:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802c99:	00 00 00 
+  802c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca1:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802ca8:	00 00 00 
+  802cab:	41 ff d1             	call   *%r9
+
+0000000000802cae <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802cae:	55                   	push   %rbp
+  802caf:	48 89 e5             	mov    %rsp,%rbp
+  802cb2:	53                   	push   %rbx
+  802cb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb7:	48 89 fa             	mov    %rdi,%rdx
+  802cba:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802cbd:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cc7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ccc:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cd7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cdd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cdf:	48 85 c0             	test   %rax,%rax
+  802ce2:	7f 06                	jg     802cea <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ce4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce8:	c9                   	leave
+  802ce9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cea:	49 89 c0             	mov    %rax,%r8
+  802ced:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cf2:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802cf9:	00 00 00 
+  802cfc:	be 27 00 00 00       	mov    $0x27,%esi
+  802d01:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802d08:	00 00 00 
+  802d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d10:	49 b9 b4 50 80 00 00 	movabs $0x8050b4,%r9
+  802d17:	00 00 00 
+  802d1a:	41 ff d1             	call   *%r9
+
+0000000000802d1d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802d1d:	55                   	push   %rbp
+  802d1e:	48 89 e5             	mov    %rsp,%rbp
+  802d21:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d22:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d36:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d3b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d46:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d4c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d52:	c9                   	leave
+  802d53:	c3                   	ret
+
+0000000000802d54 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d54:	55                   	push   %rbp
+  802d55:	48 89 e5             	mov    %rsp,%rbp
+  802d58:	53                   	push   %rbx
+  802d59:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d5c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d61:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d6b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d70:	be 00 00 00 00       	mov    $0x0,%esi
+  802d75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d7b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d81:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d87:	c9                   	leave
+  802d88:	c3                   	ret
+
+0000000000802d89 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d89:	55                   	push   %rbp
+  802d8a:	48 89 e5             	mov    %rsp,%rbp
+  802d8d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d8e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d93:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d98:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802da7:	be 00 00 00 00       	mov    $0x0,%esi
+  802dac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802db2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db8:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802dba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dbe:	c9                   	leave
+  802dbf:	c3                   	ret
+
+0000000000802dc0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dc0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dc7:	ff ff ff 
+  802dca:	48 01 f8             	add    %rdi,%rax
+  802dcd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802dd1:	c3                   	ret
+
+0000000000802dd2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dd2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dd9:	ff ff ff 
+  802ddc:	48 01 f8             	add    %rdi,%rax
+  802ddf:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802de3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802de9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802ded:	c3                   	ret
+
+0000000000802dee <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dee:	55                   	push   %rbp
+  802def:	48 89 e5             	mov    %rsp,%rbp
+  802df2:	41 57                	push   %r15
+  802df4:	41 56                	push   %r14
+  802df6:	41 55                	push   %r13
+  802df8:	41 54                	push   %r12
+  802dfa:	53                   	push   %rbx
+  802dfb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dff:	49 89 ff             	mov    %rdi,%r15
+  802e02:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802e07:	49 bd ee 42 80 00 00 	movabs $0x8042ee,%r13
+  802e0e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802e11:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802e17:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802e1a:	48 89 df             	mov    %rbx,%rdi
+  802e1d:	41 ff d5             	call   *%r13
+  802e20:	83 e0 04             	and    $0x4,%eax
+  802e23:	74 17                	je     802e3c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e25:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e2c:	4c 39 f3             	cmp    %r14,%rbx
+  802e2f:	75 e6                	jne    802e17 <fd_alloc+0x29>
+  802e31:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e37:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e3c:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e3f:	48 83 c4 08          	add    $0x8,%rsp
+  802e43:	5b                   	pop    %rbx
+  802e44:	41 5c                	pop    %r12
+  802e46:	41 5d                	pop    %r13
+  802e48:	41 5e                	pop    %r14
+  802e4a:	41 5f                	pop    %r15
+  802e4c:	5d                   	pop    %rbp
+  802e4d:	c3                   	ret
+
+0000000000802e4e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e4e:	83 ff 1f             	cmp    $0x1f,%edi
+  802e51:	77 39                	ja     802e8c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e53:	55                   	push   %rbp
+  802e54:	48 89 e5             	mov    %rsp,%rbp
+  802e57:	41 54                	push   %r12
+  802e59:	53                   	push   %rbx
+  802e5a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e5d:	48 63 df             	movslq %edi,%rbx
+  802e60:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e67:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e6b:	48 89 df             	mov    %rbx,%rdi
+  802e6e:	48 b8 ee 42 80 00 00 	movabs $0x8042ee,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+  802e7a:	a8 04                	test   $0x4,%al
+  802e7c:	74 14                	je     802e92 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e7e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e87:	5b                   	pop    %rbx
+  802e88:	41 5c                	pop    %r12
+  802e8a:	5d                   	pop    %rbp
+  802e8b:	c3                   	ret
+        return -E_INVAL;
+  802e8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e91:	c3                   	ret
+        return -E_INVAL;
+  802e92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e97:	eb ee                	jmp    802e87 <fd_lookup+0x39>
+
+0000000000802e99 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e99:	55                   	push   %rbp
+  802e9a:	48 89 e5             	mov    %rsp,%rbp
+  802e9d:	41 54                	push   %r12
+  802e9f:	53                   	push   %rbx
+  802ea0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802ea3:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  802eaa:	00 00 00 
+  802ead:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802eb4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802eb7:	39 3b                	cmp    %edi,(%rbx)
+  802eb9:	74 47                	je     802f02 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802ebb:	48 83 c0 08          	add    $0x8,%rax
+  802ebf:	48 8b 18             	mov    (%rax),%rbx
+  802ec2:	48 85 db             	test   %rbx,%rbx
+  802ec5:	75 f0                	jne    802eb7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ec7:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ece:	00 00 00 
+  802ed1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ed7:	89 fa                	mov    %edi,%edx
+  802ed9:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  802ee0:	00 00 00 
+  802ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee8:	48 b9 c6 16 80 00 00 	movabs $0x8016c6,%rcx
+  802eef:	00 00 00 
+  802ef2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ef4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ef9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802efd:	5b                   	pop    %rbx
+  802efe:	41 5c                	pop    %r12
+  802f00:	5d                   	pop    %rbp
+  802f01:	c3                   	ret
+            return 0;
+  802f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f07:	eb f0                	jmp    802ef9 <dev_lookup+0x60>
+
+0000000000802f09 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802f09:	55                   	push   %rbp
+  802f0a:	48 89 e5             	mov    %rsp,%rbp
+  802f0d:	41 55                	push   %r13
+  802f0f:	41 54                	push   %r12
+  802f11:	53                   	push   %rbx
+  802f12:	48 83 ec 18          	sub    $0x18,%rsp
+  802f16:	48 89 fb             	mov    %rdi,%rbx
+  802f19:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f1c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f23:	ff ff ff 
+  802f26:	48 01 df             	add    %rbx,%rdi
+  802f29:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f2d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f31:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  802f38:	00 00 00 
+  802f3b:	ff d0                	call   *%rax
+  802f3d:	41 89 c5             	mov    %eax,%r13d
+  802f40:	85 c0                	test   %eax,%eax
+  802f42:	78 06                	js     802f4a <fd_close+0x41>
+  802f44:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f48:	74 1a                	je     802f64 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f4a:	45 84 e4             	test   %r12b,%r12b
+  802f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f52:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f56:	44 89 e8             	mov    %r13d,%eax
+  802f59:	48 83 c4 18          	add    $0x18,%rsp
+  802f5d:	5b                   	pop    %rbx
+  802f5e:	41 5c                	pop    %r12
+  802f60:	41 5d                	pop    %r13
+  802f62:	5d                   	pop    %rbp
+  802f63:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f64:	8b 3b                	mov    (%rbx),%edi
+  802f66:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f6a:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  802f71:	00 00 00 
+  802f74:	ff d0                	call   *%rax
+  802f76:	41 89 c5             	mov    %eax,%r13d
+  802f79:	85 c0                	test   %eax,%eax
+  802f7b:	78 1b                	js     802f98 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f81:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f85:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f8b:	48 85 c0             	test   %rax,%rax
+  802f8e:	74 08                	je     802f98 <fd_close+0x8f>
+  802f90:	48 89 df             	mov    %rbx,%rdi
+  802f93:	ff d0                	call   *%rax
+  802f95:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f9d:	48 89 de             	mov    %rbx,%rsi
+  802fa0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa5:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  802fac:	00 00 00 
+  802faf:	ff d0                	call   *%rax
+    return res;
+  802fb1:	eb a3                	jmp    802f56 <fd_close+0x4d>
+
+0000000000802fb3 <close>:
+
+int
+close(int fdnum) {
+  802fb3:	55                   	push   %rbp
+  802fb4:	48 89 e5             	mov    %rsp,%rbp
+  802fb7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802fbb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fbf:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  802fc6:	00 00 00 
+  802fc9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fcb:	85 c0                	test   %eax,%eax
+  802fcd:	78 15                	js     802fe4 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fcf:	be 01 00 00 00       	mov    $0x1,%esi
+  802fd4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fd8:	48 b8 09 2f 80 00 00 	movabs $0x802f09,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+}
+  802fe4:	c9                   	leave
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <close_all>:
+
+void
+close_all(void) {
+  802fe6:	55                   	push   %rbp
+  802fe7:	48 89 e5             	mov    %rsp,%rbp
+  802fea:	41 54                	push   %r12
+  802fec:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ff2:	49 bc b3 2f 80 00 00 	movabs $0x802fb3,%r12
+  802ff9:	00 00 00 
+  802ffc:	89 df                	mov    %ebx,%edi
+  802ffe:	41 ff d4             	call   *%r12
+  803001:	83 c3 01             	add    $0x1,%ebx
+  803004:	83 fb 20             	cmp    $0x20,%ebx
+  803007:	75 f3                	jne    802ffc <close_all+0x16>
+}
+  803009:	5b                   	pop    %rbx
+  80300a:	41 5c                	pop    %r12
+  80300c:	5d                   	pop    %rbp
+  80300d:	c3                   	ret
+
+000000000080300e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80300e:	55                   	push   %rbp
+  80300f:	48 89 e5             	mov    %rsp,%rbp
+  803012:	41 57                	push   %r15
+  803014:	41 56                	push   %r14
+  803016:	41 55                	push   %r13
+  803018:	41 54                	push   %r12
+  80301a:	53                   	push   %rbx
+  80301b:	48 83 ec 18          	sub    $0x18,%rsp
+  80301f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803022:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803026:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  80302d:	00 00 00 
+  803030:	ff d0                	call   *%rax
+  803032:	89 c3                	mov    %eax,%ebx
+  803034:	85 c0                	test   %eax,%eax
+  803036:	0f 88 b8 00 00 00    	js     8030f4 <dup+0xe6>
+    close(newfdnum);
+  80303c:	44 89 e7             	mov    %r12d,%edi
+  80303f:	48 b8 b3 2f 80 00 00 	movabs $0x802fb3,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80304b:	4d 63 ec             	movslq %r12d,%r13
+  80304e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803055:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803059:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80305d:	4c 89 ff             	mov    %r15,%rdi
+  803060:	49 be d2 2d 80 00 00 	movabs $0x802dd2,%r14
+  803067:	00 00 00 
+  80306a:	41 ff d6             	call   *%r14
+  80306d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803070:	4c 89 ef             	mov    %r13,%rdi
+  803073:	41 ff d6             	call   *%r14
+  803076:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803079:	48 89 df             	mov    %rbx,%rdi
+  80307c:	48 b8 ee 42 80 00 00 	movabs $0x8042ee,%rax
+  803083:	00 00 00 
+  803086:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803088:	a8 04                	test   $0x4,%al
+  80308a:	74 2b                	je     8030b7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80308c:	41 89 c1             	mov    %eax,%r9d
+  80308f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803095:	4c 89 f1             	mov    %r14,%rcx
+  803098:	ba 00 00 00 00       	mov    $0x0,%edx
+  80309d:	48 89 de             	mov    %rbx,%rsi
+  8030a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a5:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+  8030b1:	89 c3                	mov    %eax,%ebx
+  8030b3:	85 c0                	test   %eax,%eax
+  8030b5:	78 4e                	js     803105 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8030b7:	4c 89 ff             	mov    %r15,%rdi
+  8030ba:	48 b8 ee 42 80 00 00 	movabs $0x8042ee,%rax
+  8030c1:	00 00 00 
+  8030c4:	ff d0                	call   *%rax
+  8030c6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030c9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030cf:	4c 89 e9             	mov    %r13,%rcx
+  8030d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d7:	4c 89 fe             	mov    %r15,%rsi
+  8030da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030df:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  8030e6:	00 00 00 
+  8030e9:	ff d0                	call   *%rax
+  8030eb:	89 c3                	mov    %eax,%ebx
+  8030ed:	85 c0                	test   %eax,%eax
+  8030ef:	78 14                	js     803105 <dup+0xf7>
+
+    return newfdnum;
+  8030f1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030f4:	89 d8                	mov    %ebx,%eax
+  8030f6:	48 83 c4 18          	add    $0x18,%rsp
+  8030fa:	5b                   	pop    %rbx
+  8030fb:	41 5c                	pop    %r12
+  8030fd:	41 5d                	pop    %r13
+  8030ff:	41 5e                	pop    %r14
+  803101:	41 5f                	pop    %r15
+  803103:	5d                   	pop    %rbp
+  803104:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803105:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80310a:	4c 89 ee             	mov    %r13,%rsi
+  80310d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803112:	49 bc 3a 28 80 00 00 	movabs $0x80283a,%r12
+  803119:	00 00 00 
+  80311c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80311f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803124:	4c 89 f6             	mov    %r14,%rsi
+  803127:	bf 00 00 00 00       	mov    $0x0,%edi
+  80312c:	41 ff d4             	call   *%r12
+    return res;
+  80312f:	eb c3                	jmp    8030f4 <dup+0xe6>
+
+0000000000803131 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803131:	55                   	push   %rbp
+  803132:	48 89 e5             	mov    %rsp,%rbp
+  803135:	41 56                	push   %r14
+  803137:	41 55                	push   %r13
+  803139:	41 54                	push   %r12
+  80313b:	53                   	push   %rbx
+  80313c:	48 83 ec 10          	sub    $0x10,%rsp
+  803140:	89 fb                	mov    %edi,%ebx
+  803142:	49 89 f4             	mov    %rsi,%r12
+  803145:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803148:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80314c:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  803153:	00 00 00 
+  803156:	ff d0                	call   *%rax
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	78 4c                	js     8031a8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80315c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803160:	41 8b 3e             	mov    (%r14),%edi
+  803163:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803167:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  80316e:	00 00 00 
+  803171:	ff d0                	call   *%rax
+  803173:	85 c0                	test   %eax,%eax
+  803175:	78 35                	js     8031ac <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803177:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80317b:	83 e0 03             	and    $0x3,%eax
+  80317e:	83 f8 01             	cmp    $0x1,%eax
+  803181:	74 2d                	je     8031b0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803183:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803187:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80318b:	48 85 c0             	test   %rax,%rax
+  80318e:	74 56                	je     8031e6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803190:	4c 89 ea             	mov    %r13,%rdx
+  803193:	4c 89 e6             	mov    %r12,%rsi
+  803196:	4c 89 f7             	mov    %r14,%rdi
+  803199:	ff d0                	call   *%rax
+}
+  80319b:	48 83 c4 10          	add    $0x10,%rsp
+  80319f:	5b                   	pop    %rbx
+  8031a0:	41 5c                	pop    %r12
+  8031a2:	41 5d                	pop    %r13
+  8031a4:	41 5e                	pop    %r14
+  8031a6:	5d                   	pop    %rbp
+  8031a7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031a8:	48 98                	cltq
+  8031aa:	eb ef                	jmp    80319b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8031ac:	48 98                	cltq
+  8031ae:	eb eb                	jmp    80319b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031b0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031b7:	00 00 00 
+  8031ba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031c0:	89 da                	mov    %ebx,%edx
+  8031c2:	48 bf d9 61 80 00 00 	movabs $0x8061d9,%rdi
+  8031c9:	00 00 00 
+  8031cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d1:	48 b9 c6 16 80 00 00 	movabs $0x8016c6,%rcx
+  8031d8:	00 00 00 
+  8031db:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031dd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031e4:	eb b5                	jmp    80319b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031e6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031ed:	eb ac                	jmp    80319b <read+0x6a>
+
+00000000008031ef <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031ef:	55                   	push   %rbp
+  8031f0:	48 89 e5             	mov    %rsp,%rbp
+  8031f3:	41 57                	push   %r15
+  8031f5:	41 56                	push   %r14
+  8031f7:	41 55                	push   %r13
+  8031f9:	41 54                	push   %r12
+  8031fb:	53                   	push   %rbx
+  8031fc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803200:	48 85 d2             	test   %rdx,%rdx
+  803203:	74 54                	je     803259 <readn+0x6a>
+  803205:	41 89 fd             	mov    %edi,%r13d
+  803208:	49 89 f6             	mov    %rsi,%r14
+  80320b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80320e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803213:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803218:	49 bf 31 31 80 00 00 	movabs $0x803131,%r15
+  80321f:	00 00 00 
+  803222:	4c 89 e2             	mov    %r12,%rdx
+  803225:	48 29 f2             	sub    %rsi,%rdx
+  803228:	4c 01 f6             	add    %r14,%rsi
+  80322b:	44 89 ef             	mov    %r13d,%edi
+  80322e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803231:	85 c0                	test   %eax,%eax
+  803233:	78 20                	js     803255 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803235:	01 c3                	add    %eax,%ebx
+  803237:	85 c0                	test   %eax,%eax
+  803239:	74 08                	je     803243 <readn+0x54>
+  80323b:	48 63 f3             	movslq %ebx,%rsi
+  80323e:	4c 39 e6             	cmp    %r12,%rsi
+  803241:	72 df                	jb     803222 <readn+0x33>
+    }
+    return res;
+  803243:	48 63 c3             	movslq %ebx,%rax
+}
+  803246:	48 83 c4 08          	add    $0x8,%rsp
+  80324a:	5b                   	pop    %rbx
+  80324b:	41 5c                	pop    %r12
+  80324d:	41 5d                	pop    %r13
+  80324f:	41 5e                	pop    %r14
+  803251:	41 5f                	pop    %r15
+  803253:	5d                   	pop    %rbp
+  803254:	c3                   	ret
+        if (inc < 0) return inc;
+  803255:	48 98                	cltq
+  803257:	eb ed                	jmp    803246 <readn+0x57>
+    int inc = 1, res = 0;
+  803259:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80325e:	eb e3                	jmp    803243 <readn+0x54>
+
+0000000000803260 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803260:	55                   	push   %rbp
+  803261:	48 89 e5             	mov    %rsp,%rbp
+  803264:	41 56                	push   %r14
+  803266:	41 55                	push   %r13
+  803268:	41 54                	push   %r12
+  80326a:	53                   	push   %rbx
+  80326b:	48 83 ec 10          	sub    $0x10,%rsp
+  80326f:	89 fb                	mov    %edi,%ebx
+  803271:	49 89 f4             	mov    %rsi,%r12
+  803274:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803277:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80327b:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+  803287:	85 c0                	test   %eax,%eax
+  803289:	78 47                	js     8032d2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80328b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80328f:	41 8b 3e             	mov    (%r14),%edi
+  803292:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803296:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  80329d:	00 00 00 
+  8032a0:	ff d0                	call   *%rax
+  8032a2:	85 c0                	test   %eax,%eax
+  8032a4:	78 30                	js     8032d6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8032a6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8032ab:	74 2d                	je     8032da <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032b1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032b5:	48 85 c0             	test   %rax,%rax
+  8032b8:	74 56                	je     803310 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8032ba:	4c 89 ea             	mov    %r13,%rdx
+  8032bd:	4c 89 e6             	mov    %r12,%rsi
+  8032c0:	4c 89 f7             	mov    %r14,%rdi
+  8032c3:	ff d0                	call   *%rax
+}
+  8032c5:	48 83 c4 10          	add    $0x10,%rsp
+  8032c9:	5b                   	pop    %rbx
+  8032ca:	41 5c                	pop    %r12
+  8032cc:	41 5d                	pop    %r13
+  8032ce:	41 5e                	pop    %r14
+  8032d0:	5d                   	pop    %rbp
+  8032d1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032d2:	48 98                	cltq
+  8032d4:	eb ef                	jmp    8032c5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032d6:	48 98                	cltq
+  8032d8:	eb eb                	jmp    8032c5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032da:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032e1:	00 00 00 
+  8032e4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032ea:	89 da                	mov    %ebx,%edx
+  8032ec:	48 bf f5 61 80 00 00 	movabs $0x8061f5,%rdi
+  8032f3:	00 00 00 
+  8032f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fb:	48 b9 c6 16 80 00 00 	movabs $0x8016c6,%rcx
+  803302:	00 00 00 
+  803305:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803307:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80330e:	eb b5                	jmp    8032c5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803310:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803317:	eb ac                	jmp    8032c5 <write+0x65>
+
+0000000000803319 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803319:	55                   	push   %rbp
+  80331a:	48 89 e5             	mov    %rsp,%rbp
+  80331d:	53                   	push   %rbx
+  80331e:	48 83 ec 18          	sub    $0x18,%rsp
+  803322:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803324:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803328:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  80332f:	00 00 00 
+  803332:	ff d0                	call   *%rax
+  803334:	85 c0                	test   %eax,%eax
+  803336:	78 0c                	js     803344 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803338:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80333c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80333f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803344:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803348:	c9                   	leave
+  803349:	c3                   	ret
+
+000000000080334a <tell>:
+
+int tell(int fdnum) {
+  80334a:	55                   	push   %rbp
+  80334b:	48 89 e5             	mov    %rsp,%rbp
+  80334e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803352:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803356:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+  803362:	85 c0                	test   %eax,%eax
+  803364:	78 07                	js     80336d <tell+0x23>
+
+    return fd->fd_offset;
+  803366:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80336a:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80336d:	c9                   	leave
+  80336e:	c3                   	ret
+
+000000000080336f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80336f:	55                   	push   %rbp
+  803370:	48 89 e5             	mov    %rsp,%rbp
+  803373:	41 55                	push   %r13
+  803375:	41 54                	push   %r12
+  803377:	53                   	push   %rbx
+  803378:	48 83 ec 18          	sub    $0x18,%rsp
+  80337c:	89 fb                	mov    %edi,%ebx
+  80337e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803381:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803385:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  80338c:	00 00 00 
+  80338f:	ff d0                	call   *%rax
+  803391:	85 c0                	test   %eax,%eax
+  803393:	78 38                	js     8033cd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803395:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803399:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80339d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033a1:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  8033a8:	00 00 00 
+  8033ab:	ff d0                	call   *%rax
+  8033ad:	85 c0                	test   %eax,%eax
+  8033af:	78 1c                	js     8033cd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033b1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8033b6:	74 20                	je     8033d8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033bc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033c0:	48 85 c0             	test   %rax,%rax
+  8033c3:	74 47                	je     80340c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8033c5:	44 89 e6             	mov    %r12d,%esi
+  8033c8:	4c 89 ef             	mov    %r13,%rdi
+  8033cb:	ff d0                	call   *%rax
+}
+  8033cd:	48 83 c4 18          	add    $0x18,%rsp
+  8033d1:	5b                   	pop    %rbx
+  8033d2:	41 5c                	pop    %r12
+  8033d4:	41 5d                	pop    %r13
+  8033d6:	5d                   	pop    %rbp
+  8033d7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033d8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033df:	00 00 00 
+  8033e2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033e8:	89 da                	mov    %ebx,%edx
+  8033ea:	48 bf b8 61 80 00 00 	movabs $0x8061b8,%rdi
+  8033f1:	00 00 00 
+  8033f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f9:	48 b9 c6 16 80 00 00 	movabs $0x8016c6,%rcx
+  803400:	00 00 00 
+  803403:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803405:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80340a:	eb c1                	jmp    8033cd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80340c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803411:	eb ba                	jmp    8033cd <ftruncate+0x5e>
+
+0000000000803413 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803413:	55                   	push   %rbp
+  803414:	48 89 e5             	mov    %rsp,%rbp
+  803417:	41 54                	push   %r12
+  803419:	53                   	push   %rbx
+  80341a:	48 83 ec 10          	sub    $0x10,%rsp
+  80341e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803421:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803425:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  80342c:	00 00 00 
+  80342f:	ff d0                	call   *%rax
+  803431:	85 c0                	test   %eax,%eax
+  803433:	78 63                	js     803498 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803435:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803439:	41 8b 3c 24          	mov    (%r12),%edi
+  80343d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803441:	48 b8 99 2e 80 00 00 	movabs $0x802e99,%rax
+  803448:	00 00 00 
+  80344b:	ff d0                	call   *%rax
+  80344d:	85 c0                	test   %eax,%eax
+  80344f:	78 47                	js     803498 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803451:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803455:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80345a:	74 45                	je     8034a1 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80345c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80345f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803466:	00 00 00 
+    stat->st_isdir = 0;
+  803469:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803470:	00 00 00 
+    stat->st_ino = 0;
+  803473:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80347a:	00 00 00 00 
+    stat->st_version = 0;
+  80347e:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803485:	00 00 00 
+    stat->st_dev = dev;
+  803488:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80348f:	48 89 de             	mov    %rbx,%rsi
+  803492:	4c 89 e7             	mov    %r12,%rdi
+  803495:	ff 50 28             	call   *0x28(%rax)
+}
+  803498:	48 83 c4 10          	add    $0x10,%rsp
+  80349c:	5b                   	pop    %rbx
+  80349d:	41 5c                	pop    %r12
+  80349f:	5d                   	pop    %rbp
+  8034a0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8034a1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8034a6:	eb f0                	jmp    803498 <fstat+0x85>
+
+00000000008034a8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8034a8:	55                   	push   %rbp
+  8034a9:	48 89 e5             	mov    %rsp,%rbp
+  8034ac:	41 54                	push   %r12
+  8034ae:	53                   	push   %rbx
+  8034af:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8034b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b7:	48 b8 c9 39 80 00 00 	movabs $0x8039c9,%rax
+  8034be:	00 00 00 
+  8034c1:	ff d0                	call   *%rax
+  8034c3:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034c5:	85 c0                	test   %eax,%eax
+  8034c7:	78 25                	js     8034ee <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034c9:	4c 89 e6             	mov    %r12,%rsi
+  8034cc:	89 c7                	mov    %eax,%edi
+  8034ce:	48 b8 13 34 80 00 00 	movabs $0x803413,%rax
+  8034d5:	00 00 00 
+  8034d8:	ff d0                	call   *%rax
+  8034da:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034dd:	89 df                	mov    %ebx,%edi
+  8034df:	48 b8 b3 2f 80 00 00 	movabs $0x802fb3,%rax
+  8034e6:	00 00 00 
+  8034e9:	ff d0                	call   *%rax
+
+    return res;
+  8034eb:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034ee:	89 d8                	mov    %ebx,%eax
+  8034f0:	5b                   	pop    %rbx
+  8034f1:	41 5c                	pop    %r12
+  8034f3:	5d                   	pop    %rbp
+  8034f4:	c3                   	ret
+
+00000000008034f5 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034f5:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034fc:	00 00 00 
+  8034ff:	83 38 00             	cmpl   $0x0,(%rax)
+  803502:	74 0a                	je     80350e <fsipc_env+0x19>
+    return fsenv;
+}
+  803504:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80350b:	00 00 
+  80350d:	c3                   	ret
+fsipc_env(void) {
+  80350e:	55                   	push   %rbp
+  80350f:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803512:	bf 03 00 00 00       	mov    $0x3,%edi
+  803517:	48 b8 9b 56 80 00 00 	movabs $0x80569b,%rax
+  80351e:	00 00 00 
+  803521:	ff d0                	call   *%rax
+  803523:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80352a:	00 00 
+}
+  80352c:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803533:	00 00 
+  803535:	5d                   	pop    %rbp
+  803536:	c3                   	ret
+
+0000000000803537 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803537:	55                   	push   %rbp
+  803538:	48 89 e5             	mov    %rsp,%rbp
+  80353b:	53                   	push   %rbx
+  80353c:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803540:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803547:	00 
+  803548:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80354f:	00 
+  803550:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803557:	00 
+  803558:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80355f:	00 
+  803560:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803567:	00 
+
+    assert(size <= sizeof(words));
+  803568:	48 83 fa 28          	cmp    $0x28,%rdx
+  80356c:	77 38                	ja     8035a6 <fsipc_short+0x6f>
+  80356e:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803570:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803574:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803580:	48 b8 f5 34 80 00 00 	movabs $0x8034f5,%rax
+  803587:	00 00 00 
+  80358a:	ff d0                	call   *%rax
+  80358c:	89 c7                	mov    %eax,%edi
+  80358e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803592:	89 de                	mov    %ebx,%esi
+  803594:	48 b8 fe 55 80 00 00 	movabs $0x8055fe,%rax
+  80359b:	00 00 00 
+  80359e:	ff d0                	call   *%rax
+}
+  8035a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035a4:	c9                   	leave
+  8035a5:	c3                   	ret
+    assert(size <= sizeof(words));
+  8035a6:	48 b9 40 62 80 00 00 	movabs $0x806240,%rcx
+  8035ad:	00 00 00 
+  8035b0:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8035b7:	00 00 00 
+  8035ba:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8035bf:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  8035c6:	00 00 00 
+  8035c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ce:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  8035d5:	00 00 00 
+  8035d8:	41 ff d0             	call   *%r8
+
+00000000008035db <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035db:	55                   	push   %rbp
+  8035dc:	48 89 e5             	mov    %rsp,%rbp
+  8035df:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035e3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035e6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035e9:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035ec:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035f5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035fa:	48 b8 37 35 80 00 00 	movabs $0x803537,%rax
+  803601:	00 00 00 
+  803604:	ff d0                	call   *%rax
+}
+  803606:	c9                   	leave
+  803607:	c3                   	ret
+
+0000000000803608 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803608:	55                   	push   %rbp
+  803609:	48 89 e5             	mov    %rsp,%rbp
+  80360c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803610:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803613:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803616:	ba 04 00 00 00       	mov    $0x4,%edx
+  80361b:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80361f:	bf 06 00 00 00       	mov    $0x6,%edi
+  803624:	48 b8 37 35 80 00 00 	movabs $0x803537,%rax
+  80362b:	00 00 00 
+  80362e:	ff d0                	call   *%rax
+}
+  803630:	c9                   	leave
+  803631:	c3                   	ret
+
+0000000000803632 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803632:	55                   	push   %rbp
+  803633:	48 89 e5             	mov    %rsp,%rbp
+  803636:	41 54                	push   %r12
+  803638:	53                   	push   %rbx
+  803639:	48 83 ec 10          	sub    $0x10,%rsp
+  80363d:	89 fb                	mov    %edi,%ebx
+  80363f:	49 89 f4             	mov    %rsi,%r12
+  803642:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803646:	48 b8 f5 34 80 00 00 	movabs $0x8034f5,%rax
+  80364d:	00 00 00 
+  803650:	ff d0                	call   *%rax
+  803652:	89 c7                	mov    %eax,%edi
+  803654:	6a 00                	push   $0x0
+  803656:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80365a:	50                   	push   %rax
+  80365b:	4d 89 e1             	mov    %r12,%r9
+  80365e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803664:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803669:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803670:	00 00 00 
+  803673:	89 de                	mov    %ebx,%esi
+  803675:	48 b8 99 55 80 00 00 	movabs $0x805599,%rax
+  80367c:	00 00 00 
+  80367f:	ff d0                	call   *%rax
+}
+  803681:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803685:	5b                   	pop    %rbx
+  803686:	41 5c                	pop    %r12
+  803688:	5d                   	pop    %rbp
+  803689:	c3                   	ret
+
+000000000080368a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	41 54                	push   %r12
+  803690:	53                   	push   %rbx
+  803691:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803694:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803697:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80369e:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8036a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8036aa:	bf 05 00 00 00       	mov    $0x5,%edi
+  8036af:	48 b8 32 36 80 00 00 	movabs $0x803632,%rax
+  8036b6:	00 00 00 
+  8036b9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036bb:	85 c0                	test   %eax,%eax
+  8036bd:	78 5a                	js     803719 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8036bf:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036c6:	00 00 00 
+  8036c9:	4c 89 e6             	mov    %r12,%rsi
+  8036cc:	48 89 df             	mov    %rbx,%rdi
+  8036cf:	48 b8 fd 1f 80 00 00 	movabs $0x801ffd,%rax
+  8036d6:	00 00 00 
+  8036d9:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036db:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036e2:	00 
+  8036e3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036e9:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036f0:	00 
+  8036f1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036f7:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036fe:	00 
+  8036ff:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803706:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  80370d:	00 
+  80370e:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803714:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803719:	5b                   	pop    %rbx
+  80371a:	41 5c                	pop    %r12
+  80371c:	5d                   	pop    %rbp
+  80371d:	c3                   	ret
+
+000000000080371e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80371e:	55                   	push   %rbp
+  80371f:	48 89 e5             	mov    %rsp,%rbp
+  803722:	41 57                	push   %r15
+  803724:	41 56                	push   %r14
+  803726:	41 55                	push   %r13
+  803728:	41 54                	push   %r12
+  80372a:	53                   	push   %rbx
+  80372b:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80372f:	48 85 ff             	test   %rdi,%rdi
+  803732:	0f 84 a1 00 00 00    	je     8037d9 <devfile_read+0xbb>
+  803738:	49 89 ff             	mov    %rdi,%r15
+  80373b:	49 89 f5             	mov    %rsi,%r13
+  80373e:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803741:	48 85 f6             	test   %rsi,%rsi
+  803744:	0f 84 c4 00 00 00    	je     80380e <devfile_read+0xf0>
+    size_t total_read = 0;
+  80374a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803751:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803752:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803759:	00 00 00 
+  80375c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803760:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803763:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803767:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80376c:	be 00 00 00 00       	mov    $0x0,%esi
+  803771:	bf 03 00 00 00       	mov    $0x3,%edi
+  803776:	48 b8 32 36 80 00 00 	movabs $0x803632,%rax
+  80377d:	00 00 00 
+  803780:	ff d0                	call   *%rax
+        if (res < 0) {
+  803782:	85 c0                	test   %eax,%eax
+  803784:	0f 88 b9 00 00 00    	js     803843 <devfile_read+0x125>
+        assert(res <= n);
+  80378a:	48 63 d8             	movslq %eax,%rbx
+  80378d:	49 39 dc             	cmp    %rbx,%r12
+  803790:	0f 82 b1 00 00 00    	jb     803847 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803796:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80379b:	0f 87 db 00 00 00    	ja     80387c <devfile_read+0x15e>
+        if (!res) {
+  8037a1:	85 c0                	test   %eax,%eax
+  8037a3:	74 21                	je     8037c6 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8037a5:	48 89 da             	mov    %rbx,%rdx
+  8037a8:	4c 89 f6             	mov    %r14,%rsi
+  8037ab:	4c 89 ef             	mov    %r13,%rdi
+  8037ae:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  8037b5:	00 00 00 
+  8037b8:	ff d0                	call   *%rax
+        total_read += res;
+  8037ba:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8037be:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8037c1:	49 29 dc             	sub    %rbx,%r12
+  8037c4:	75 96                	jne    80375c <devfile_read+0x3e>
+    return total_read;
+  8037c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037ca:	48 83 c4 18          	add    $0x18,%rsp
+  8037ce:	5b                   	pop    %rbx
+  8037cf:	41 5c                	pop    %r12
+  8037d1:	41 5d                	pop    %r13
+  8037d3:	41 5e                	pop    %r14
+  8037d5:	41 5f                	pop    %r15
+  8037d7:	5d                   	pop    %rbp
+  8037d8:	c3                   	ret
+    assert(fd);
+  8037d9:	48 b9 76 62 80 00 00 	movabs $0x806276,%rcx
+  8037e0:	00 00 00 
+  8037e3:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8037ea:	00 00 00 
+  8037ed:	be 91 00 00 00       	mov    $0x91,%esi
+  8037f2:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  8037f9:	00 00 00 
+  8037fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803801:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  803808:	00 00 00 
+  80380b:	41 ff d0             	call   *%r8
+    assert(buf);
+  80380e:	48 b9 79 62 80 00 00 	movabs $0x806279,%rcx
+  803815:	00 00 00 
+  803818:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80381f:	00 00 00 
+  803822:	be 92 00 00 00       	mov    $0x92,%esi
+  803827:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80382e:	00 00 00 
+  803831:	b8 00 00 00 00       	mov    $0x0,%eax
+  803836:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  80383d:	00 00 00 
+  803840:	41 ff d0             	call   *%r8
+            return res;
+  803843:	48 98                	cltq
+  803845:	eb 83                	jmp    8037ca <devfile_read+0xac>
+        assert(res <= n);
+  803847:	48 b9 7d 62 80 00 00 	movabs $0x80627d,%rcx
+  80384e:	00 00 00 
+  803851:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803858:	00 00 00 
+  80385b:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803860:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  803867:	00 00 00 
+  80386a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386f:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  803876:	00 00 00 
+  803879:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80387c:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  803883:	00 00 00 
+  803886:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80388d:	00 00 00 
+  803890:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803895:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80389c:	00 00 00 
+  80389f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a4:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  8038ab:	00 00 00 
+  8038ae:	41 ff d0             	call   *%r8
+
+00000000008038b1 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8038b1:	55                   	push   %rbp
+  8038b2:	48 89 e5             	mov    %rsp,%rbp
+  8038b5:	41 57                	push   %r15
+  8038b7:	41 56                	push   %r14
+  8038b9:	41 55                	push   %r13
+  8038bb:	41 54                	push   %r12
+  8038bd:	53                   	push   %rbx
+  8038be:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8038c2:	48 85 ff             	test   %rdi,%rdi
+  8038c5:	0f 84 83 00 00 00    	je     80394e <devfile_write+0x9d>
+  8038cb:	49 89 ff             	mov    %rdi,%r15
+  8038ce:	49 89 f4             	mov    %rsi,%r12
+  8038d1:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038d4:	48 85 f6             	test   %rsi,%rsi
+  8038d7:	0f 84 a6 00 00 00    	je     803983 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038dd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038e3:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038ea:	00 00 00 
+  8038ed:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038f1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038f4:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038f8:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038fd:	48 39 d3             	cmp    %rdx,%rbx
+  803900:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803904:	4c 89 e6             	mov    %r12,%rsi
+  803907:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  80390e:	00 00 00 
+  803911:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  803918:	00 00 00 
+  80391b:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80391d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803922:	be 00 00 00 00       	mov    $0x0,%esi
+  803927:	bf 04 00 00 00       	mov    $0x4,%edi
+  80392c:	48 b8 32 36 80 00 00 	movabs $0x803632,%rax
+  803933:	00 00 00 
+  803936:	ff d0                	call   *%rax
+        if (res < 0) {
+  803938:	85 c0                	test   %eax,%eax
+  80393a:	78 7c                	js     8039b8 <devfile_write+0x107>
+        total_written += res;
+  80393c:	48 98                	cltq
+  80393e:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803941:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803944:	48 29 c3             	sub    %rax,%rbx
+  803947:	75 a4                	jne    8038ed <devfile_write+0x3c>
+    return total_written;
+  803949:	4c 89 e8             	mov    %r13,%rax
+  80394c:	eb 6c                	jmp    8039ba <devfile_write+0x109>
+    assert(fd);
+  80394e:	48 b9 76 62 80 00 00 	movabs $0x806276,%rcx
+  803955:	00 00 00 
+  803958:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80395f:	00 00 00 
+  803962:	be bd 00 00 00       	mov    $0xbd,%esi
+  803967:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80396e:	00 00 00 
+  803971:	b8 00 00 00 00       	mov    $0x0,%eax
+  803976:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  80397d:	00 00 00 
+  803980:	41 ff d0             	call   *%r8
+    assert(buf);
+  803983:	48 b9 79 62 80 00 00 	movabs $0x806279,%rcx
+  80398a:	00 00 00 
+  80398d:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803994:	00 00 00 
+  803997:	be be 00 00 00       	mov    $0xbe,%esi
+  80399c:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  8039a3:	00 00 00 
+  8039a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ab:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  8039b2:	00 00 00 
+  8039b5:	41 ff d0             	call   *%r8
+            return res;
+  8039b8:	48 98                	cltq
+}
+  8039ba:	48 83 c4 08          	add    $0x8,%rsp
+  8039be:	5b                   	pop    %rbx
+  8039bf:	41 5c                	pop    %r12
+  8039c1:	41 5d                	pop    %r13
+  8039c3:	41 5e                	pop    %r14
+  8039c5:	41 5f                	pop    %r15
+  8039c7:	5d                   	pop    %rbp
+  8039c8:	c3                   	ret
+
+00000000008039c9 <open>:
+open(const char *path, int mode) {
+  8039c9:	55                   	push   %rbp
+  8039ca:	48 89 e5             	mov    %rsp,%rbp
+  8039cd:	41 55                	push   %r13
+  8039cf:	41 54                	push   %r12
+  8039d1:	53                   	push   %rbx
+  8039d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8039d6:	49 89 fc             	mov    %rdi,%r12
+  8039d9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039dc:	48 b8 bf 1f 80 00 00 	movabs $0x801fbf,%rax
+  8039e3:	00 00 00 
+  8039e6:	ff d0                	call   *%rax
+  8039e8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039ee:	0f 87 8f 00 00 00    	ja     803a83 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039f4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039f8:	48 b8 ee 2d 80 00 00 	movabs $0x802dee,%rax
+  8039ff:	00 00 00 
+  803a02:	ff d0                	call   *%rax
+  803a04:	89 c3                	mov    %eax,%ebx
+  803a06:	85 c0                	test   %eax,%eax
+  803a08:	78 55                	js     803a5f <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803a0a:	4c 89 e6             	mov    %r12,%rsi
+  803a0d:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803a14:	00 00 00 
+  803a17:	48 89 df             	mov    %rbx,%rdi
+  803a1a:	48 b8 fd 1f 80 00 00 	movabs $0x801ffd,%rax
+  803a21:	00 00 00 
+  803a24:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a26:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a2d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a32:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a36:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a3b:	48 b8 32 36 80 00 00 	movabs $0x803632,%rax
+  803a42:	00 00 00 
+  803a45:	ff d0                	call   *%rax
+  803a47:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a49:	85 c0                	test   %eax,%eax
+  803a4b:	78 1f                	js     803a6c <open+0xa3>
+    return fd2num(fd);
+  803a4d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a51:	48 b8 c0 2d 80 00 00 	movabs $0x802dc0,%rax
+  803a58:	00 00 00 
+  803a5b:	ff d0                	call   *%rax
+  803a5d:	89 c3                	mov    %eax,%ebx
+}
+  803a5f:	89 d8                	mov    %ebx,%eax
+  803a61:	48 83 c4 18          	add    $0x18,%rsp
+  803a65:	5b                   	pop    %rbx
+  803a66:	41 5c                	pop    %r12
+  803a68:	41 5d                	pop    %r13
+  803a6a:	5d                   	pop    %rbp
+  803a6b:	c3                   	ret
+        fd_close(fd, 0);
+  803a6c:	be 00 00 00 00       	mov    $0x0,%esi
+  803a71:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a75:	48 b8 09 2f 80 00 00 	movabs $0x802f09,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+        return res;
+  803a81:	eb dc                	jmp    803a5f <open+0x96>
+        return -E_BAD_PATH;
+  803a83:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a88:	eb d5                	jmp    803a5f <open+0x96>
+
+0000000000803a8a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a8a:	55                   	push   %rbp
+  803a8b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a93:	be 00 00 00 00       	mov    $0x0,%esi
+  803a98:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a9d:	48 b8 37 35 80 00 00 	movabs $0x803537,%rax
+  803aa4:	00 00 00 
+  803aa7:	ff d0                	call   *%rax
+}
+  803aa9:	5d                   	pop    %rbp
+  803aaa:	c3                   	ret
+
+0000000000803aab <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803aab:	55                   	push   %rbp
+  803aac:	48 89 e5             	mov    %rsp,%rbp
+  803aaf:	41 56                	push   %r14
+  803ab1:	41 55                	push   %r13
+  803ab3:	41 54                	push   %r12
+  803ab5:	53                   	push   %rbx
+  803ab6:	48 83 ec 10          	sub    $0x10,%rsp
+  803aba:	41 89 f6             	mov    %esi,%r14d
+  803abd:	49 89 d4             	mov    %rdx,%r12
+  803ac0:	48 89 cb             	mov    %rcx,%rbx
+  803ac3:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ac6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aca:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ad6:	85 c0                	test   %eax,%eax
+  803ad8:	78 46                	js     803b20 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ada:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ade:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ae5:	00 00 00 
+  803ae8:	8b 00                	mov    (%rax),%eax
+  803aea:	39 02                	cmp    %eax,(%rdx)
+  803aec:	75 3f                	jne    803b2d <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803aee:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803af5:	00 00 00 
+  803af8:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803afb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803afd:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803b01:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803b05:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803b09:	48 89 da             	mov    %rbx,%rdx
+  803b0c:	4c 89 e6             	mov    %r12,%rsi
+  803b0f:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b14:	48 b8 32 36 80 00 00 	movabs $0x803632,%rax
+  803b1b:	00 00 00 
+  803b1e:	ff d0                	call   *%rax
+}
+  803b20:	48 83 c4 10          	add    $0x10,%rsp
+  803b24:	5b                   	pop    %rbx
+  803b25:	41 5c                	pop    %r12
+  803b27:	41 5d                	pop    %r13
+  803b29:	41 5e                	pop    %r14
+  803b2b:	5d                   	pop    %rbp
+  803b2c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b2d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b32:	eb ec                	jmp    803b20 <file_map+0x75>
+
+0000000000803b34 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b34:	55                   	push   %rbp
+  803b35:	48 89 e5             	mov    %rsp,%rbp
+  803b38:	41 54                	push   %r12
+  803b3a:	53                   	push   %rbx
+  803b3b:	48 83 ec 20          	sub    $0x20,%rsp
+  803b3f:	41 89 f4             	mov    %esi,%r12d
+  803b42:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b45:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b49:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  803b50:	00 00 00 
+  803b53:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b55:	85 c0                	test   %eax,%eax
+  803b57:	78 3c                	js     803b95 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b5d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b64:	00 00 00 
+  803b67:	8b 0a                	mov    (%rdx),%ecx
+  803b69:	39 08                	cmp    %ecx,(%rax)
+  803b6b:	75 31                	jne    803b9e <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b6d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b70:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b73:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b77:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b7b:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b80:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b84:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b89:	48 b8 37 35 80 00 00 	movabs $0x803537,%rax
+  803b90:	00 00 00 
+  803b93:	ff d0                	call   *%rax
+}
+  803b95:	48 83 c4 20          	add    $0x20,%rsp
+  803b99:	5b                   	pop    %rbx
+  803b9a:	41 5c                	pop    %r12
+  803b9c:	5d                   	pop    %rbp
+  803b9d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b9e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ba3:	eb f0                	jmp    803b95 <file_msync+0x61>
+
+0000000000803ba5 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803ba5:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803ba9:	7f 01                	jg     803bac <writebuf+0x7>
+  803bab:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803bac:	55                   	push   %rbp
+  803bad:	48 89 e5             	mov    %rsp,%rbp
+  803bb0:	53                   	push   %rbx
+  803bb1:	48 83 ec 08          	sub    $0x8,%rsp
+  803bb5:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803bb8:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803bbc:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803bc0:	8b 3f                	mov    (%rdi),%edi
+  803bc2:	48 b8 60 32 80 00 00 	movabs $0x803260,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803bce:	48 85 c0             	test   %rax,%rax
+  803bd1:	7e 04                	jle    803bd7 <writebuf+0x32>
+  803bd3:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bd7:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bdb:	48 39 c2             	cmp    %rax,%rdx
+  803bde:	74 0f                	je     803bef <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803be0:	48 85 c0             	test   %rax,%rax
+  803be3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803be8:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bec:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bf3:	c9                   	leave
+  803bf4:	c3                   	ret
+
+0000000000803bf5 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bf5:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bf8:	8d 50 01             	lea    0x1(%rax),%edx
+  803bfb:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bfe:	48 98                	cltq
+  803c00:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803c05:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803c0b:	74 01                	je     803c0e <putch+0x19>
+  803c0d:	c3                   	ret
+putch(int ch, void *arg) {
+  803c0e:	55                   	push   %rbp
+  803c0f:	48 89 e5             	mov    %rsp,%rbp
+  803c12:	53                   	push   %rbx
+  803c13:	48 83 ec 08          	sub    $0x8,%rsp
+  803c17:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803c1a:	48 89 f7             	mov    %rsi,%rdi
+  803c1d:	48 b8 a5 3b 80 00 00 	movabs $0x803ba5,%rax
+  803c24:	00 00 00 
+  803c27:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c29:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c34:	c9                   	leave
+  803c35:	c3                   	ret
+
+0000000000803c36 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c36:	55                   	push   %rbp
+  803c37:	48 89 e5             	mov    %rsp,%rbp
+  803c3a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c41:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c44:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c4a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c51:	00 00 00 
+    state.result = 0;
+  803c54:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c5b:	00 00 00 00 
+    state.error = 1;
+  803c5f:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c66:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c69:	48 89 f2             	mov    %rsi,%rdx
+  803c6c:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c73:	48 bf f5 3b 80 00 00 	movabs $0x803bf5,%rdi
+  803c7a:	00 00 00 
+  803c7d:	48 b8 16 18 80 00 00 	movabs $0x801816,%rax
+  803c84:	00 00 00 
+  803c87:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c89:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c90:	7f 14                	jg     803ca6 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c92:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c99:	48 85 c0             	test   %rax,%rax
+  803c9c:	75 06                	jne    803ca4 <vfprintf+0x6e>
+  803c9e:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803ca4:	c9                   	leave
+  803ca5:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803ca6:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803cad:	48 b8 a5 3b 80 00 00 	movabs $0x803ba5,%rax
+  803cb4:	00 00 00 
+  803cb7:	ff d0                	call   *%rax
+  803cb9:	eb d7                	jmp    803c92 <vfprintf+0x5c>
+
+0000000000803cbb <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803cbb:	55                   	push   %rbp
+  803cbc:	48 89 e5             	mov    %rsp,%rbp
+  803cbf:	48 83 ec 50          	sub    $0x50,%rsp
+  803cc3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cc7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ccb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ccf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cd3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cda:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ce2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ce6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cea:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cee:	48 b8 36 3c 80 00 00 	movabs $0x803c36,%rax
+  803cf5:	00 00 00 
+  803cf8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cfa:	c9                   	leave
+  803cfb:	c3                   	ret
+
+0000000000803cfc <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cfc:	55                   	push   %rbp
+  803cfd:	48 89 e5             	mov    %rsp,%rbp
+  803d00:	48 83 ec 50          	sub    $0x50,%rsp
+  803d04:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803d08:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d0c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d10:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d14:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d18:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d1f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d27:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d2b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d2f:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d33:	48 89 fe             	mov    %rdi,%rsi
+  803d36:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d3b:	48 b8 36 3c 80 00 00 	movabs $0x803c36,%rax
+  803d42:	00 00 00 
+  803d45:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d47:	c9                   	leave
+  803d48:	c3                   	ret
+
+0000000000803d49 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d49:	55                   	push   %rbp
+  803d4a:	48 89 e5             	mov    %rsp,%rbp
+  803d4d:	41 54                	push   %r12
+  803d4f:	53                   	push   %rbx
+  803d50:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d53:	48 b8 d2 2d 80 00 00 	movabs $0x802dd2,%rax
+  803d5a:	00 00 00 
+  803d5d:	ff d0                	call   *%rax
+  803d5f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d62:	48 be b0 62 80 00 00 	movabs $0x8062b0,%rsi
+  803d69:	00 00 00 
+  803d6c:	48 89 df             	mov    %rbx,%rdi
+  803d6f:	48 b8 fd 1f 80 00 00 	movabs $0x801ffd,%rax
+  803d76:	00 00 00 
+  803d79:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d7b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d80:	41 2b 04 24          	sub    (%r12),%eax
+  803d84:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d8a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d91:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d94:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d9b:	00 00 00 
+  803d9e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803daa:	5b                   	pop    %rbx
+  803dab:	41 5c                	pop    %r12
+  803dad:	5d                   	pop    %rbp
+  803dae:	c3                   	ret
+
+0000000000803daf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803daf:	55                   	push   %rbp
+  803db0:	48 89 e5             	mov    %rsp,%rbp
+  803db3:	41 54                	push   %r12
+  803db5:	53                   	push   %rbx
+  803db6:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803db9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dbe:	48 89 fe             	mov    %rdi,%rsi
+  803dc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc6:	49 bc 3a 28 80 00 00 	movabs $0x80283a,%r12
+  803dcd:	00 00 00 
+  803dd0:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803dd3:	48 89 df             	mov    %rbx,%rdi
+  803dd6:	48 b8 d2 2d 80 00 00 	movabs $0x802dd2,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+  803de2:	48 89 c6             	mov    %rax,%rsi
+  803de5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dea:	bf 00 00 00 00       	mov    $0x0,%edi
+  803def:	41 ff d4             	call   *%r12
+}
+  803df2:	5b                   	pop    %rbx
+  803df3:	41 5c                	pop    %r12
+  803df5:	5d                   	pop    %rbp
+  803df6:	c3                   	ret
+
+0000000000803df7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803df7:	55                   	push   %rbp
+  803df8:	48 89 e5             	mov    %rsp,%rbp
+  803dfb:	41 57                	push   %r15
+  803dfd:	41 56                	push   %r14
+  803dff:	41 55                	push   %r13
+  803e01:	41 54                	push   %r12
+  803e03:	53                   	push   %rbx
+  803e04:	48 83 ec 18          	sub    $0x18,%rsp
+  803e08:	49 89 fc             	mov    %rdi,%r12
+  803e0b:	49 89 f5             	mov    %rsi,%r13
+  803e0e:	49 89 d7             	mov    %rdx,%r15
+  803e11:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e15:	48 b8 d2 2d 80 00 00 	movabs $0x802dd2,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e21:	4d 85 ff             	test   %r15,%r15
+  803e24:	0f 84 af 00 00 00    	je     803ed9 <devpipe_write+0xe2>
+  803e2a:	48 89 c3             	mov    %rax,%rbx
+  803e2d:	4c 89 f8             	mov    %r15,%rax
+  803e30:	4d 89 ef             	mov    %r13,%r15
+  803e33:	4c 01 e8             	add    %r13,%rax
+  803e36:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e3a:	49 bd 30 27 80 00 00 	movabs $0x802730,%r13
+  803e41:	00 00 00 
+            sys_yield();
+  803e44:	49 be c1 26 80 00 00 	movabs $0x8026c1,%r14
+  803e4b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e4e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e51:	48 63 ce             	movslq %esi,%rcx
+  803e54:	48 63 03             	movslq (%rbx),%rax
+  803e57:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e5d:	48 39 c1             	cmp    %rax,%rcx
+  803e60:	72 2e                	jb     803e90 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e62:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e67:	48 89 da             	mov    %rbx,%rdx
+  803e6a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e6f:	4c 89 e7             	mov    %r12,%rdi
+  803e72:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e75:	85 c0                	test   %eax,%eax
+  803e77:	74 66                	je     803edf <devpipe_write+0xe8>
+            sys_yield();
+  803e79:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e7c:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e7f:	48 63 ce             	movslq %esi,%rcx
+  803e82:	48 63 03             	movslq (%rbx),%rax
+  803e85:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e8b:	48 39 c1             	cmp    %rax,%rcx
+  803e8e:	73 d2                	jae    803e62 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e90:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e94:	48 89 ca             	mov    %rcx,%rdx
+  803e97:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e9b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803ea2:	08 10 20 
+  803ea5:	48 f7 e2             	mul    %rdx
+  803ea8:	48 c1 ea 06          	shr    $0x6,%rdx
+  803eac:	48 89 d0             	mov    %rdx,%rax
+  803eaf:	48 c1 e0 09          	shl    $0x9,%rax
+  803eb3:	48 29 d0             	sub    %rdx,%rax
+  803eb6:	48 c1 e0 03          	shl    $0x3,%rax
+  803eba:	48 29 c1             	sub    %rax,%rcx
+  803ebd:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ec2:	83 c6 01             	add    $0x1,%esi
+  803ec5:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ec8:	49 83 c7 01          	add    $0x1,%r15
+  803ecc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ed0:	49 39 c7             	cmp    %rax,%r15
+  803ed3:	0f 85 75 ff ff ff    	jne    803e4e <devpipe_write+0x57>
+    return n;
+  803ed9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803edd:	eb 05                	jmp    803ee4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee4:	48 83 c4 18          	add    $0x18,%rsp
+  803ee8:	5b                   	pop    %rbx
+  803ee9:	41 5c                	pop    %r12
+  803eeb:	41 5d                	pop    %r13
+  803eed:	41 5e                	pop    %r14
+  803eef:	41 5f                	pop    %r15
+  803ef1:	5d                   	pop    %rbp
+  803ef2:	c3                   	ret
+
+0000000000803ef3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ef3:	55                   	push   %rbp
+  803ef4:	48 89 e5             	mov    %rsp,%rbp
+  803ef7:	41 57                	push   %r15
+  803ef9:	41 56                	push   %r14
+  803efb:	41 55                	push   %r13
+  803efd:	41 54                	push   %r12
+  803eff:	53                   	push   %rbx
+  803f00:	48 83 ec 18          	sub    $0x18,%rsp
+  803f04:	49 89 fc             	mov    %rdi,%r12
+  803f07:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f0b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f0f:	48 b8 d2 2d 80 00 00 	movabs $0x802dd2,%rax
+  803f16:	00 00 00 
+  803f19:	ff d0                	call   *%rax
+  803f1b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803f1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f24:	49 bd 30 27 80 00 00 	movabs $0x802730,%r13
+  803f2b:	00 00 00 
+            sys_yield();
+  803f2e:	49 be c1 26 80 00 00 	movabs $0x8026c1,%r14
+  803f35:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f38:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f3d:	74 7d                	je     803fbc <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f3f:	8b 03                	mov    (%rbx),%eax
+  803f41:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f44:	75 26                	jne    803f6c <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f46:	4d 85 ff             	test   %r15,%r15
+  803f49:	75 77                	jne    803fc2 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f4b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f50:	48 89 da             	mov    %rbx,%rdx
+  803f53:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f58:	4c 89 e7             	mov    %r12,%rdi
+  803f5b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f5e:	85 c0                	test   %eax,%eax
+  803f60:	74 72                	je     803fd4 <devpipe_read+0xe1>
+            sys_yield();
+  803f62:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f65:	8b 03                	mov    (%rbx),%eax
+  803f67:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f6a:	74 df                	je     803f4b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f6c:	48 63 c8             	movslq %eax,%rcx
+  803f6f:	48 89 ca             	mov    %rcx,%rdx
+  803f72:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f76:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f7d:	08 10 20 
+  803f80:	48 89 d0             	mov    %rdx,%rax
+  803f83:	48 f7 e6             	mul    %rsi
+  803f86:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f8a:	48 89 d0             	mov    %rdx,%rax
+  803f8d:	48 c1 e0 09          	shl    $0x9,%rax
+  803f91:	48 29 d0             	sub    %rdx,%rax
+  803f94:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f9b:	00 
+  803f9c:	48 89 c8             	mov    %rcx,%rax
+  803f9f:	48 29 d0             	sub    %rdx,%rax
+  803fa2:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803fa7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803fab:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803faf:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803fb2:	49 83 c7 01          	add    $0x1,%r15
+  803fb6:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803fba:	75 83                	jne    803f3f <devpipe_read+0x4c>
+    return n;
+  803fbc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fc0:	eb 03                	jmp    803fc5 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803fc2:	4c 89 f8             	mov    %r15,%rax
+}
+  803fc5:	48 83 c4 18          	add    $0x18,%rsp
+  803fc9:	5b                   	pop    %rbx
+  803fca:	41 5c                	pop    %r12
+  803fcc:	41 5d                	pop    %r13
+  803fce:	41 5e                	pop    %r14
+  803fd0:	41 5f                	pop    %r15
+  803fd2:	5d                   	pop    %rbp
+  803fd3:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd9:	eb ea                	jmp    803fc5 <devpipe_read+0xd2>
+
+0000000000803fdb <pipe>:
+pipe(int pfd[2]) {
+  803fdb:	55                   	push   %rbp
+  803fdc:	48 89 e5             	mov    %rsp,%rbp
+  803fdf:	41 55                	push   %r13
+  803fe1:	41 54                	push   %r12
+  803fe3:	53                   	push   %rbx
+  803fe4:	48 83 ec 18          	sub    $0x18,%rsp
+  803fe8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803feb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fef:	48 b8 ee 2d 80 00 00 	movabs $0x802dee,%rax
+  803ff6:	00 00 00 
+  803ff9:	ff d0                	call   *%rax
+  803ffb:	89 c3                	mov    %eax,%ebx
+  803ffd:	85 c0                	test   %eax,%eax
+  803fff:	0f 88 a0 01 00 00    	js     8041a5 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804005:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80400a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80400f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804013:	bf 00 00 00 00       	mov    $0x0,%edi
+  804018:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+  804024:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804026:	85 c0                	test   %eax,%eax
+  804028:	0f 88 77 01 00 00    	js     8041a5 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80402e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804032:	48 b8 ee 2d 80 00 00 	movabs $0x802dee,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+  80403e:	89 c3                	mov    %eax,%ebx
+  804040:	85 c0                	test   %eax,%eax
+  804042:	0f 88 43 01 00 00    	js     80418b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804048:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80404d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804052:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405b:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  804062:	00 00 00 
+  804065:	ff d0                	call   *%rax
+  804067:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804069:	85 c0                	test   %eax,%eax
+  80406b:	0f 88 1a 01 00 00    	js     80418b <pipe+0x1b0>
+    va = fd2data(fd0);
+  804071:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804075:	48 b8 d2 2d 80 00 00 	movabs $0x802dd2,%rax
+  80407c:	00 00 00 
+  80407f:	ff d0                	call   *%rax
+  804081:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804084:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804089:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80408e:	48 89 c6             	mov    %rax,%rsi
+  804091:	bf 00 00 00 00       	mov    $0x0,%edi
+  804096:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  80409d:	00 00 00 
+  8040a0:	ff d0                	call   *%rax
+  8040a2:	89 c3                	mov    %eax,%ebx
+  8040a4:	85 c0                	test   %eax,%eax
+  8040a6:	0f 88 c5 00 00 00    	js     804171 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8040ac:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8040b0:	48 b8 d2 2d 80 00 00 	movabs $0x802dd2,%rax
+  8040b7:	00 00 00 
+  8040ba:	ff d0                	call   *%rax
+  8040bc:	48 89 c1             	mov    %rax,%rcx
+  8040bf:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040c5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040d0:	4c 89 ee             	mov    %r13,%rsi
+  8040d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d8:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  8040df:	00 00 00 
+  8040e2:	ff d0                	call   *%rax
+  8040e4:	89 c3                	mov    %eax,%ebx
+  8040e6:	85 c0                	test   %eax,%eax
+  8040e8:	78 6e                	js     804158 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040ea:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ef:	4c 89 ef             	mov    %r13,%rdi
+  8040f2:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  8040f9:	00 00 00 
+  8040fc:	ff d0                	call   *%rax
+  8040fe:	83 f8 02             	cmp    $0x2,%eax
+  804101:	0f 85 ab 00 00 00    	jne    8041b2 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804107:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80410e:	00 00 
+  804110:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804114:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804116:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80411a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804121:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804125:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804127:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80412b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804132:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804136:	48 bb c0 2d 80 00 00 	movabs $0x802dc0,%rbx
+  80413d:	00 00 00 
+  804140:	ff d3                	call   *%rbx
+  804142:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804146:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80414a:	ff d3                	call   *%rbx
+  80414c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804151:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804156:	eb 4d                	jmp    8041a5 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804158:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80415d:	4c 89 ee             	mov    %r13,%rsi
+  804160:	bf 00 00 00 00       	mov    $0x0,%edi
+  804165:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  80416c:	00 00 00 
+  80416f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804171:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804176:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80417a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80417f:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  804186:	00 00 00 
+  804189:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80418b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804190:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804194:	bf 00 00 00 00       	mov    $0x0,%edi
+  804199:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  8041a0:	00 00 00 
+  8041a3:	ff d0                	call   *%rax
+}
+  8041a5:	89 d8                	mov    %ebx,%eax
+  8041a7:	48 83 c4 18          	add    $0x18,%rsp
+  8041ab:	5b                   	pop    %rbx
+  8041ac:	41 5c                	pop    %r12
+  8041ae:	41 5d                	pop    %r13
+  8041b0:	5d                   	pop    %rbp
+  8041b1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8041b2:	48 b9 c8 62 80 00 00 	movabs $0x8062c8,%rcx
+  8041b9:	00 00 00 
+  8041bc:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8041c3:	00 00 00 
+  8041c6:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041cb:	48 bf b7 62 80 00 00 	movabs $0x8062b7,%rdi
+  8041d2:	00 00 00 
+  8041d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041da:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  8041e1:	00 00 00 
+  8041e4:	41 ff d0             	call   *%r8
+
+00000000008041e7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041e7:	55                   	push   %rbp
+  8041e8:	48 89 e5             	mov    %rsp,%rbp
+  8041eb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041ef:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041f3:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  8041fa:	00 00 00 
+  8041fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041ff:	85 c0                	test   %eax,%eax
+  804201:	78 35                	js     804238 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804203:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804207:	48 b8 d2 2d 80 00 00 	movabs $0x802dd2,%rax
+  80420e:	00 00 00 
+  804211:	ff d0                	call   *%rax
+  804213:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804216:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80421b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804220:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804224:	48 b8 30 27 80 00 00 	movabs $0x802730,%rax
+  80422b:	00 00 00 
+  80422e:	ff d0                	call   *%rax
+  804230:	85 c0                	test   %eax,%eax
+  804232:	0f 94 c0             	sete   %al
+  804235:	0f b6 c0             	movzbl %al,%eax
+}
+  804238:	c9                   	leave
+  804239:	c3                   	ret
+
+000000000080423a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80423a:	48 89 f8             	mov    %rdi,%rax
+  80423d:	48 c1 e8 27          	shr    $0x27,%rax
+  804241:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804248:	01 00 00 
+  80424b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80424f:	f6 c2 01             	test   $0x1,%dl
+  804252:	74 6d                	je     8042c1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804254:	48 89 f8             	mov    %rdi,%rax
+  804257:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80425b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804262:	01 00 00 
+  804265:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804269:	f6 c2 01             	test   $0x1,%dl
+  80426c:	74 62                	je     8042d0 <get_uvpt_entry+0x96>
+  80426e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804275:	01 00 00 
+  804278:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80427c:	f6 c2 80             	test   $0x80,%dl
+  80427f:	75 4f                	jne    8042d0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804281:	48 89 f8             	mov    %rdi,%rax
+  804284:	48 c1 e8 15          	shr    $0x15,%rax
+  804288:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80428f:	01 00 00 
+  804292:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804296:	f6 c2 01             	test   $0x1,%dl
+  804299:	74 44                	je     8042df <get_uvpt_entry+0xa5>
+  80429b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042a2:	01 00 00 
+  8042a5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042a9:	f6 c2 80             	test   $0x80,%dl
+  8042ac:	75 31                	jne    8042df <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8042ae:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8042b2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8042b9:	01 00 00 
+  8042bc:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8042c0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042c1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042c8:	01 00 00 
+  8042cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042cf:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042d0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042d7:	01 00 00 
+  8042da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042de:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042df:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042e6:	01 00 00 
+  8042e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ed:	c3                   	ret
+
+00000000008042ee <get_prot>:
+
+int
+get_prot(void *va) {
+  8042ee:	55                   	push   %rbp
+  8042ef:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042f2:	48 b8 3a 42 80 00 00 	movabs $0x80423a,%rax
+  8042f9:	00 00 00 
+  8042fc:	ff d0                	call   *%rax
+  8042fe:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804301:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804306:	89 c1                	mov    %eax,%ecx
+  804308:	83 c9 04             	or     $0x4,%ecx
+  80430b:	f6 c2 01             	test   $0x1,%dl
+  80430e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804311:	89 c1                	mov    %eax,%ecx
+  804313:	83 c9 02             	or     $0x2,%ecx
+  804316:	f6 c2 02             	test   $0x2,%dl
+  804319:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80431c:	89 c1                	mov    %eax,%ecx
+  80431e:	83 c9 01             	or     $0x1,%ecx
+  804321:	48 85 d2             	test   %rdx,%rdx
+  804324:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804327:	89 c1                	mov    %eax,%ecx
+  804329:	83 c9 40             	or     $0x40,%ecx
+  80432c:	f6 c6 04             	test   $0x4,%dh
+  80432f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804332:	5d                   	pop    %rbp
+  804333:	c3                   	ret
+
+0000000000804334 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804334:	55                   	push   %rbp
+  804335:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804338:	48 b8 3a 42 80 00 00 	movabs $0x80423a,%rax
+  80433f:	00 00 00 
+  804342:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804344:	48 c1 e8 06          	shr    $0x6,%rax
+  804348:	83 e0 01             	and    $0x1,%eax
+}
+  80434b:	5d                   	pop    %rbp
+  80434c:	c3                   	ret
+
+000000000080434d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80434d:	55                   	push   %rbp
+  80434e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804351:	48 b8 3a 42 80 00 00 	movabs $0x80423a,%rax
+  804358:	00 00 00 
+  80435b:	ff d0                	call   *%rax
+  80435d:	83 e0 01             	and    $0x1,%eax
+}
+  804360:	5d                   	pop    %rbp
+  804361:	c3                   	ret
+
+0000000000804362 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804362:	55                   	push   %rbp
+  804363:	48 89 e5             	mov    %rsp,%rbp
+  804366:	41 57                	push   %r15
+  804368:	41 56                	push   %r14
+  80436a:	41 55                	push   %r13
+  80436c:	41 54                	push   %r12
+  80436e:	53                   	push   %rbx
+  80436f:	48 83 ec 28          	sub    $0x28,%rsp
+  804373:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804377:	48 85 ff             	test   %rdi,%rdi
+  80437a:	74 1e                	je     80439a <foreach_shared_region+0x38>
+  80437c:	49 89 ff             	mov    %rdi,%r15
+  80437f:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804385:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80438b:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804392:	01 00 00 
+  804395:	e9 72 02 00 00       	jmp    80460c <foreach_shared_region+0x2aa>
+    assert(fun);
+  80439a:	48 b9 ec 62 80 00 00 	movabs $0x8062ec,%rcx
+  8043a1:	00 00 00 
+  8043a4:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8043ab:	00 00 00 
+  8043ae:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8043b3:	48 bf f0 62 80 00 00 	movabs $0x8062f0,%rdi
+  8043ba:	00 00 00 
+  8043bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c2:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  8043c9:	00 00 00 
+  8043cc:	41 ff d0             	call   *%r8
+  8043cf:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043d6:	eb 6c                	jmp    804444 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043d8:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043df:	ff ff ff 
+  8043e2:	4c 21 e2             	and    %r12,%rdx
+  8043e5:	48 89 d8             	mov    %rbx,%rax
+  8043e8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043ed:	48 83 c0 01          	add    $0x1,%rax
+  8043f1:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043f5:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043fc:	00 00 00 
+  8043ff:	48 21 c8             	and    %rcx,%rax
+  804402:	48 09 d0             	or     %rdx,%rax
+  804405:	49 89 c4             	mov    %rax,%r12
+  804408:	eb 30                	jmp    80443a <foreach_shared_region+0xd8>
+  80440a:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804411:	ff ff ff 
+  804414:	4c 21 e2             	and    %r12,%rdx
+  804417:	48 89 d8             	mov    %rbx,%rax
+  80441a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80441f:	48 83 c0 01          	add    $0x1,%rax
+  804423:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804427:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80442e:	00 00 00 
+  804431:	48 21 c8             	and    %rcx,%rax
+  804434:	48 09 d0             	or     %rdx,%rax
+  804437:	49 89 c4             	mov    %rax,%r12
+  80443a:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80443e:	0f 84 99 01 00 00    	je     8045dd <foreach_shared_region+0x27b>
+  804444:	4c 89 e3             	mov    %r12,%rbx
+  804447:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80444b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804452:	01 00 00 
+  804455:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804459:	a8 01                	test   $0x1,%al
+  80445b:	0f 84 77 ff ff ff    	je     8043d8 <foreach_shared_region+0x76>
+  804461:	a8 80                	test   $0x80,%al
+  804463:	74 19                	je     80447e <foreach_shared_region+0x11c>
+  804465:	f6 c4 04             	test   $0x4,%ah
+  804468:	74 a0                	je     80440a <foreach_shared_region+0xa8>
+  80446a:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804471:	40 
+  804472:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804476:	4c 89 e7             	mov    %r12,%rdi
+  804479:	41 ff d7             	call   *%r15
+  80447c:	eb 8c                	jmp    80440a <foreach_shared_region+0xa8>
+  80447e:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804485:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804489:	eb 46                	jmp    8044d1 <foreach_shared_region+0x16f>
+  80448b:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804492:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804498:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80449c:	48 c1 e0 15          	shl    $0x15,%rax
+  8044a0:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044a5:	49 09 c4             	or     %rax,%r12
+  8044a8:	eb 1d                	jmp    8044c7 <foreach_shared_region+0x165>
+  8044aa:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8044b1:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044b7:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8044bb:	48 c1 e0 15          	shl    $0x15,%rax
+  8044bf:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044c4:	49 09 c4             	or     %rax,%r12
+  8044c7:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044cb:	0f 84 d3 00 00 00    	je     8045a4 <foreach_shared_region+0x242>
+  8044d1:	4c 89 e3             	mov    %r12,%rbx
+  8044d4:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044d8:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044df:	01 00 00 
+  8044e2:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044e6:	a8 01                	test   $0x1,%al
+  8044e8:	74 a1                	je     80448b <foreach_shared_region+0x129>
+  8044ea:	a8 80                	test   $0x80,%al
+  8044ec:	74 19                	je     804507 <foreach_shared_region+0x1a5>
+  8044ee:	f6 c4 04             	test   $0x4,%ah
+  8044f1:	74 b7                	je     8044aa <foreach_shared_region+0x148>
+  8044f3:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044fa:	00 
+  8044fb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044ff:	4c 89 e7             	mov    %r12,%rdi
+  804502:	41 ff d7             	call   *%r15
+  804505:	eb a3                	jmp    8044aa <foreach_shared_region+0x148>
+  804507:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80450d:	eb 3b                	jmp    80454a <foreach_shared_region+0x1e8>
+  80450f:	f6 c4 04             	test   $0x4,%ah
+  804512:	74 12                	je     804526 <foreach_shared_region+0x1c4>
+  804514:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80451b:	00 
+  80451c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804520:	4c 89 e7             	mov    %r12,%rdi
+  804523:	41 ff d7             	call   *%r15
+  804526:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80452d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804533:	48 83 c3 01          	add    $0x1,%rbx
+  804537:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80453b:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804541:	49 09 dc             	or     %rbx,%r12
+  804544:	41 83 ed 01          	sub    $0x1,%r13d
+  804548:	74 2f                	je     804579 <foreach_shared_region+0x217>
+  80454a:	4c 89 e3             	mov    %r12,%rbx
+  80454d:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804551:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804555:	a8 01                	test   $0x1,%al
+  804557:	75 b6                	jne    80450f <foreach_shared_region+0x1ad>
+  804559:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804560:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804566:	48 83 c3 01          	add    $0x1,%rbx
+  80456a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80456e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804574:	49 09 dc             	or     %rbx,%r12
+  804577:	eb cb                	jmp    804544 <foreach_shared_region+0x1e2>
+  804579:	4c 89 e0             	mov    %r12,%rax
+  80457c:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804582:	49 c1 ec 15          	shr    $0x15,%r12
+  804586:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80458d:	49 83 c4 01          	add    $0x1,%r12
+  804591:	49 c1 e4 15          	shl    $0x15,%r12
+  804595:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80459c:	49 09 c4             	or     %rax,%r12
+  80459f:	e9 23 ff ff ff       	jmp    8044c7 <foreach_shared_region+0x165>
+  8045a4:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8045a8:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8045af:	ff ff ff 
+  8045b2:	4c 21 e0             	and    %r12,%rax
+  8045b5:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8045b9:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8045c0:	49 83 c4 01          	add    $0x1,%r12
+  8045c4:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045c8:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045cf:	00 00 00 
+  8045d2:	49 21 d4             	and    %rdx,%r12
+  8045d5:	49 09 c4             	or     %rax,%r12
+  8045d8:	e9 5d fe ff ff       	jmp    80443a <foreach_shared_region+0xd8>
+  8045dd:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045e4:	00 ff ff 
+  8045e7:	4c 21 e0             	and    %r12,%rax
+  8045ea:	49 c1 ec 27          	shr    $0x27,%r12
+  8045ee:	49 83 c4 01          	add    $0x1,%r12
+  8045f2:	49 c1 e4 27          	shl    $0x27,%r12
+  8045f6:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045fd:	ff 00 00 
+  804600:	49 21 d4             	and    %rdx,%r12
+  804603:	49 09 c4             	or     %rax,%r12
+  804606:	41 83 ed 01          	sub    $0x1,%r13d
+  80460a:	74 48                	je     804654 <foreach_shared_region+0x2f2>
+  80460c:	4c 89 e0             	mov    %r12,%rax
+  80460f:	48 c1 e8 27          	shr    $0x27,%rax
+  804613:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80461a:	01 00 00 
+  80461d:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804621:	f6 c2 01             	test   $0x1,%dl
+  804624:	0f 85 a5 fd ff ff    	jne    8043cf <foreach_shared_region+0x6d>
+  80462a:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804631:	00 ff ff 
+  804634:	4c 21 e2             	and    %r12,%rdx
+  804637:	48 83 c0 01          	add    $0x1,%rax
+  80463b:	48 c1 e0 27          	shl    $0x27,%rax
+  80463f:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804646:	ff 00 00 
+  804649:	48 21 c8             	and    %rcx,%rax
+  80464c:	48 09 d0             	or     %rdx,%rax
+  80464f:	49 89 c4             	mov    %rax,%r12
+  804652:	eb b2                	jmp    804606 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804654:	4d 85 e4             	test   %r12,%r12
+  804657:	75 14                	jne    80466d <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465e:	48 83 c4 28          	add    $0x28,%rsp
+  804662:	5b                   	pop    %rbx
+  804663:	41 5c                	pop    %r12
+  804665:	41 5d                	pop    %r13
+  804667:	41 5e                	pop    %r14
+  804669:	41 5f                	pop    %r15
+  80466b:	5d                   	pop    %rbp
+  80466c:	c3                   	ret
+    assert(addr == 0);
+  80466d:	48 b9 fb 62 80 00 00 	movabs $0x8062fb,%rcx
+  804674:	00 00 00 
+  804677:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80467e:	00 00 00 
+  804681:	be 67 00 00 00       	mov    $0x67,%esi
+  804686:	48 bf f0 62 80 00 00 	movabs $0x8062f0,%rdi
+  80468d:	00 00 00 
+  804690:	b8 00 00 00 00       	mov    $0x0,%eax
+  804695:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  80469c:	00 00 00 
+  80469f:	41 ff d0             	call   *%r8
+
+00000000008046a2 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8046a2:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8046a9:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8046ac:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8046b2:	eb 33                	jmp    8046e7 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046b4:	48 83 c0 20          	add    $0x20,%rax
+  8046b8:	4c 39 c0             	cmp    %r8,%rax
+  8046bb:	74 25                	je     8046e2 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8046bd:	48 8b 10             	mov    (%rax),%rdx
+  8046c0:	48 85 d2             	test   %rdx,%rdx
+  8046c3:	74 ef                	je     8046b4 <mmap_place+0x12>
+  8046c5:	48 89 d1             	mov    %rdx,%rcx
+  8046c8:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046cc:	48 39 cf             	cmp    %rcx,%rdi
+  8046cf:	73 e3                	jae    8046b4 <mmap_place+0x12>
+  8046d1:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046d5:	4c 39 ca             	cmp    %r9,%rdx
+  8046d8:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046dc:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046e0:	eb d2                	jmp    8046b4 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046e2:	45 84 d2             	test   %r10b,%r10b
+  8046e5:	74 12                	je     8046f9 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046e7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046ee:	00 00 00 
+        moved = 0;
+  8046f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046f7:	eb c4                	jmp    8046bd <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046f9:	48 01 fe             	add    %rdi,%rsi
+  8046fc:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804703:	00 00 00 
+  804706:	48 39 f0             	cmp    %rsi,%rax
+  804709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470e:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804712:	c3                   	ret
+
+0000000000804713 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804713:	55                   	push   %rbp
+  804714:	48 89 e5             	mov    %rsp,%rbp
+  804717:	41 57                	push   %r15
+  804719:	41 56                	push   %r14
+  80471b:	41 55                	push   %r13
+  80471d:	41 54                	push   %r12
+  80471f:	53                   	push   %rbx
+  804720:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804724:	48 8b 1f             	mov    (%rdi),%rbx
+  804727:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80472e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804735:	00 00 00 
+  804738:	ba 00 00 00 00       	mov    $0x0,%edx
+  80473d:	eb 12                	jmp    804751 <mmap_pgfault+0x3e>
+  80473f:	48 83 c2 01          	add    $0x1,%rdx
+  804743:	48 83 c0 20          	add    $0x20,%rax
+  804747:	48 83 fa 20          	cmp    $0x20,%rdx
+  80474b:	0f 84 04 01 00 00    	je     804855 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804751:	48 8b 08             	mov    (%rax),%rcx
+  804754:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804758:	48 39 de             	cmp    %rbx,%rsi
+  80475b:	73 e2                	jae    80473f <mmap_pgfault+0x2c>
+  80475d:	48 03 48 08          	add    0x8(%rax),%rcx
+  804761:	48 39 cb             	cmp    %rcx,%rbx
+  804764:	73 d9                	jae    80473f <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804766:	48 c1 e2 05          	shl    $0x5,%rdx
+  80476a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804771:	00 00 00 
+  804774:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804778:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80477c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804780:	f6 c2 01             	test   $0x1,%dl
+  804783:	0f 84 e0 00 00 00    	je     804869 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80478e:	f6 c2 02             	test   $0x2,%dl
+  804791:	0f 84 c3 00 00 00    	je     80485a <mmap_pgfault+0x147>
+  804797:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80479e:	ff ff ff 
+  8047a1:	48 23 56 10          	and    0x10(%rsi),%rdx
+  8047a5:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  8047ac:	00 00 00 
+  8047af:	48 39 ca             	cmp    %rcx,%rdx
+  8047b2:	0f 85 a2 00 00 00    	jne    80485a <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8047b8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8047bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c2:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047c9:	00 00 00 
+  8047cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047d1:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  8047d8:	00 00 00 
+  8047db:	ff d0                	call   *%rax
+  8047dd:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e4:	85 d2                	test   %edx,%edx
+  8047e6:	78 72                	js     80485a <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ed:	48 89 de             	mov    %rbx,%rsi
+  8047f0:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047f7:	00 00 00 
+  8047fa:	4c 89 e7             	mov    %r12,%rdi
+  8047fd:	48 b8 b4 23 80 00 00 	movabs $0x8023b4,%rax
+  804804:	00 00 00 
+  804807:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804809:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80480f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804815:	48 89 d9             	mov    %rbx,%rcx
+  804818:	ba 00 00 00 00       	mov    $0x0,%edx
+  80481d:	4c 89 e6             	mov    %r12,%rsi
+  804820:	bf 00 00 00 00       	mov    $0x0,%edi
+  804825:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  80482c:	00 00 00 
+  80482f:	ff d0                	call   *%rax
+  804831:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804833:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804838:	4c 89 e6             	mov    %r12,%rsi
+  80483b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804840:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  804847:	00 00 00 
+  80484a:	ff d0                	call   *%rax
+    return res >= 0;
+  80484c:	89 d8                	mov    %ebx,%eax
+  80484e:	f7 d0                	not    %eax
+  804850:	c1 e8 1f             	shr    $0x1f,%eax
+  804853:	eb 05                	jmp    80485a <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804855:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80485a:	48 83 c4 18          	add    $0x18,%rsp
+  80485e:	5b                   	pop    %rbx
+  80485f:	41 5c                	pop    %r12
+  804861:	41 5d                	pop    %r13
+  804863:	41 5e                	pop    %r14
+  804865:	41 5f                	pop    %r15
+  804867:	5d                   	pop    %rbp
+  804868:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804869:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80486d:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804871:	4c 03 30             	add    (%rax),%r14
+  804874:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80487b:	49 39 c6             	cmp    %rax,%r14
+  80487e:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804882:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804889:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80488f:	49 bf 4d 43 80 00 00 	movabs $0x80434d,%r15
+  804896:	00 00 00 
+  804899:	4d 39 f4             	cmp    %r14,%r12
+  80489c:	73 1d                	jae    8048bb <mmap_pgfault+0x1a8>
+  80489e:	4c 89 e7             	mov    %r12,%rdi
+  8048a1:	41 ff d7             	call   *%r15
+  8048a4:	84 c0                	test   %al,%al
+  8048a6:	75 13                	jne    8048bb <mmap_pgfault+0x1a8>
+  8048a8:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8048af:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8048b6:	4d 39 f4             	cmp    %r14,%r12
+  8048b9:	72 e3                	jb     80489e <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048bb:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8048c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048c5:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048c9:	74 2a                	je     8048f5 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048cf:	89 de                	mov    %ebx,%esi
+  8048d1:	2b 30                	sub    (%rax),%esi
+  8048d3:	03 70 1c             	add    0x1c(%rax),%esi
+  8048d6:	8b 78 18             	mov    0x18(%rax),%edi
+  8048d9:	4c 89 e9             	mov    %r13,%rcx
+  8048dc:	48 89 da             	mov    %rbx,%rdx
+  8048df:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  8048e6:	00 00 00 
+  8048e9:	ff d0                	call   *%rax
+    return res > 0;
+  8048eb:	85 c0                	test   %eax,%eax
+  8048ed:	0f 9f c0             	setg   %al
+  8048f0:	e9 65 ff ff ff       	jmp    80485a <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048f5:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048f9:	eb d0                	jmp    8048cb <mmap_pgfault+0x1b8>
+
+00000000008048fb <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048fb:	55                   	push   %rbp
+  8048fc:	48 89 e5             	mov    %rsp,%rbp
+  8048ff:	41 57                	push   %r15
+  804901:	41 56                	push   %r14
+  804903:	41 55                	push   %r13
+  804905:	41 54                	push   %r12
+  804907:	53                   	push   %rbx
+  804908:	48 83 ec 28          	sub    $0x28,%rsp
+  80490c:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804910:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804913:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80491a:	ff ff ff 
+  80491d:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804921:	b8 00 00 00 00       	mov    $0x0,%eax
+  804926:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80492d:	00 00 00 
+  804930:	48 39 ca             	cmp    %rcx,%rdx
+  804933:	0f 85 e5 00 00 00    	jne    804a1e <mmap_writeback+0x123>
+  804939:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80493c:	4c 39 ee             	cmp    %r13,%rsi
+  80493f:	0f 83 e8 00 00 00    	jae    804a2d <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804945:	49 be 4d 43 80 00 00 	movabs $0x80434d,%r14
+  80494c:	00 00 00 
+  80494f:	49 bf 34 43 80 00 00 	movabs $0x804334,%r15
+  804956:	00 00 00 
+  804959:	eb 10                	jmp    80496b <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80495b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804962:	4d 39 ec             	cmp    %r13,%r12
+  804965:	0f 83 ae 00 00 00    	jae    804a19 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80496b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80496f:	4c 89 e7             	mov    %r12,%rdi
+  804972:	41 ff d6             	call   *%r14
+  804975:	84 c0                	test   %al,%al
+  804977:	74 e2                	je     80495b <mmap_writeback+0x60>
+  804979:	4c 89 e7             	mov    %r12,%rdi
+  80497c:	41 ff d7             	call   *%r15
+  80497f:	84 c0                	test   %al,%al
+  804981:	74 d8                	je     80495b <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804983:	4c 89 e3             	mov    %r12,%rbx
+  804986:	4d 39 ec             	cmp    %r13,%r12
+  804989:	73 20                	jae    8049ab <mmap_writeback+0xb0>
+  80498b:	48 89 df             	mov    %rbx,%rdi
+  80498e:	41 ff d6             	call   *%r14
+  804991:	84 c0                	test   %al,%al
+  804993:	74 16                	je     8049ab <mmap_writeback+0xb0>
+  804995:	48 89 df             	mov    %rbx,%rdi
+  804998:	41 ff d7             	call   *%r15
+  80499b:	84 c0                	test   %al,%al
+  80499d:	74 0c                	je     8049ab <mmap_writeback+0xb0>
+  80499f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8049a6:	4c 39 eb             	cmp    %r13,%rbx
+  8049a9:	72 e0                	jb     80498b <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  8049ab:	48 89 d9             	mov    %rbx,%rcx
+  8049ae:	4c 29 e1             	sub    %r12,%rcx
+  8049b1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8049b5:	44 89 e6             	mov    %r12d,%esi
+  8049b8:	2b 30                	sub    (%rax),%esi
+  8049ba:	49 89 c4             	mov    %rax,%r12
+  8049bd:	03 70 1c             	add    0x1c(%rax),%esi
+  8049c0:	8b 78 18             	mov    0x18(%rax),%edi
+  8049c3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049c7:	48 89 ca             	mov    %rcx,%rdx
+  8049ca:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  8049d1:	00 00 00 
+  8049d4:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049d6:	85 c0                	test   %eax,%eax
+  8049d8:	78 44                	js     804a1e <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049da:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049df:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049e2:	41 89 c1             	mov    %eax,%r9d
+  8049e5:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049ec:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049f0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f9:	48 89 ce             	mov    %rcx,%rsi
+  8049fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a01:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  804a08:	00 00 00 
+  804a0b:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804a0d:	85 c0                	test   %eax,%eax
+  804a0f:	78 0d                	js     804a1e <mmap_writeback+0x123>
+  804a11:	49 89 dc             	mov    %rbx,%r12
+  804a14:	e9 49 ff ff ff       	jmp    804962 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804a19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a1e:	48 83 c4 28          	add    $0x28,%rsp
+  804a22:	5b                   	pop    %rbx
+  804a23:	41 5c                	pop    %r12
+  804a25:	41 5d                	pop    %r13
+  804a27:	41 5e                	pop    %r14
+  804a29:	41 5f                	pop    %r15
+  804a2b:	5d                   	pop    %rbp
+  804a2c:	c3                   	ret
+    return 0;
+  804a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a32:	eb ea                	jmp    804a1e <mmap_writeback+0x123>
+
+0000000000804a34 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a34:	55                   	push   %rbp
+  804a35:	48 89 e5             	mov    %rsp,%rbp
+  804a38:	41 57                	push   %r15
+  804a3a:	41 56                	push   %r14
+  804a3c:	41 55                	push   %r13
+  804a3e:	41 54                	push   %r12
+  804a40:	53                   	push   %rbx
+  804a41:	48 83 ec 38          	sub    $0x38,%rsp
+  804a45:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a49:	48 85 f6             	test   %rsi,%rsi
+  804a4c:	0f 84 0c 02 00 00    	je     804c5e <mmap+0x22a>
+  804a52:	49 89 ff             	mov    %rdi,%r15
+  804a55:	49 89 f4             	mov    %rsi,%r12
+  804a58:	41 89 d5             	mov    %edx,%r13d
+  804a5b:	41 89 ce             	mov    %ecx,%r14d
+  804a5e:	44 89 cb             	mov    %r9d,%ebx
+  804a61:	45 85 c9             	test   %r9d,%r9d
+  804a64:	0f 88 f4 01 00 00    	js     804c5e <mmap+0x22a>
+  804a6a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a71:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a78:	0f 85 e7 01 00 00    	jne    804c65 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a7e:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a81:	83 fa 04             	cmp    $0x4,%edx
+  804a84:	0f 85 db 01 00 00    	jne    804c65 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a8a:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a8d:	83 fa 01             	cmp    $0x1,%edx
+  804a90:	0f 87 cf 01 00 00    	ja     804c65 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a96:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a9a:	44 89 c7             	mov    %r8d,%edi
+  804a9d:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  804aa4:	00 00 00 
+  804aa7:	ff d0                	call   *%rax
+  804aa9:	89 c2                	mov    %eax,%edx
+  804aab:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ab2:	85 d2                	test   %edx,%edx
+  804ab4:	0f 88 ab 01 00 00    	js     804c65 <mmap+0x231>
+  804aba:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804abe:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804ac5:	00 00 00 
+  804ac8:	8b 09                	mov    (%rcx),%ecx
+  804aca:	39 0a                	cmp    %ecx,(%rdx)
+  804acc:	0f 85 93 01 00 00    	jne    804c65 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804ad2:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ad5:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ad8:	83 fa 01             	cmp    $0x1,%edx
+  804adb:	0f 84 84 01 00 00    	je     804c65 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ae1:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ae5:	74 42                	je     804b29 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ae7:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804aee:	4c 89 e6             	mov    %r12,%rsi
+  804af1:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804af8:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804afc:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804b00:	4d 85 ff             	test   %r15,%r15
+  804b03:	74 67                	je     804b6c <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b05:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804b0c:	75 0f                	jne    804b1d <mmap+0xe9>
+  804b0e:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804b15:	00 00 00 
+  804b18:	49 39 c7             	cmp    %rax,%r15
+  804b1b:	77 1b                	ja     804b38 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b1d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b24:	e9 3c 01 00 00       	jmp    804c65 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b29:	41 f6 c5 02          	test   $0x2,%r13b
+  804b2d:	74 b8                	je     804ae7 <mmap+0xb3>
+  804b2f:	85 d2                	test   %edx,%edx
+  804b31:	75 b4                	jne    804ae7 <mmap+0xb3>
+  804b33:	e9 2d 01 00 00       	jmp    804c65 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b38:	4c 89 ff             	mov    %r15,%rdi
+  804b3b:	48 b8 a2 46 80 00 00 	movabs $0x8046a2,%rax
+  804b42:	00 00 00 
+  804b45:	ff d0                	call   *%rax
+  804b47:	48 89 c2             	mov    %rax,%rdx
+  804b4a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b51:	49 39 d7             	cmp    %rdx,%r15
+  804b54:	0f 85 0b 01 00 00    	jne    804c65 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b5a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b61:	00 00 00 
+  804b64:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b6a:	eb 44                	jmp    804bb0 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b6c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b70:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b77:	00 00 00 
+  804b7a:	48 b8 a2 46 80 00 00 	movabs $0x8046a2,%rax
+  804b81:	00 00 00 
+  804b84:	ff d0                	call   *%rax
+  804b86:	48 89 c7             	mov    %rax,%rdi
+  804b89:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b8d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b94:	48 85 ff             	test   %rdi,%rdi
+  804b97:	75 c1                	jne    804b5a <mmap+0x126>
+  804b99:	e9 c7 00 00 00       	jmp    804c65 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b9e:	49 83 c4 01          	add    $0x1,%r12
+  804ba2:	48 83 c0 20          	add    $0x20,%rax
+  804ba6:	49 83 fc 20          	cmp    $0x20,%r12
+  804baa:	0f 84 a5 00 00 00    	je     804c55 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bb0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804bb4:	75 e8                	jne    804b9e <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804bb6:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804bba:	48 b8 ee 2d 80 00 00 	movabs $0x802dee,%rax
+  804bc1:	00 00 00 
+  804bc4:	ff d0                	call   *%rax
+  804bc6:	89 c2                	mov    %eax,%edx
+  804bc8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bcf:	85 d2                	test   %edx,%edx
+  804bd1:	0f 88 8e 00 00 00    	js     804c65 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bd7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bdb:	48 b8 c0 2d 80 00 00 	movabs $0x802dc0,%rax
+  804be2:	00 00 00 
+  804be5:	ff d0                	call   *%rax
+  804be7:	89 c6                	mov    %eax,%esi
+  804be9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bec:	48 b8 0e 30 80 00 00 	movabs $0x80300e,%rax
+  804bf3:	00 00 00 
+  804bf6:	ff d0                	call   *%rax
+  804bf8:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bfb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c02:	45 85 ff             	test   %r15d,%r15d
+  804c05:	78 5e                	js     804c65 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804c07:	49 c1 e4 05          	shl    $0x5,%r12
+  804c0b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c12:	00 00 00 
+  804c15:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804c18:	48 bf 13 47 80 00 00 	movabs $0x804713,%rdi
+  804c1f:	00 00 00 
+  804c22:	48 b8 e1 51 80 00 00 	movabs $0x8051e1,%rax
+  804c29:	00 00 00 
+  804c2c:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c2e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c32:	49 89 04 24          	mov    %rax,(%r12)
+  804c36:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c3a:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c3f:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c44:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c49:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c4e:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c53:	eb 10                	jmp    804c65 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c55:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c5c:	eb 07                	jmp    804c65 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c5e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c65:	48 83 c4 38          	add    $0x38,%rsp
+  804c69:	5b                   	pop    %rbx
+  804c6a:	41 5c                	pop    %r12
+  804c6c:	41 5d                	pop    %r13
+  804c6e:	41 5e                	pop    %r14
+  804c70:	41 5f                	pop    %r15
+  804c72:	5d                   	pop    %rbp
+  804c73:	c3                   	ret
+
+0000000000804c74 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c74:	55                   	push   %rbp
+  804c75:	48 89 e5             	mov    %rsp,%rbp
+  804c78:	41 57                	push   %r15
+  804c7a:	41 56                	push   %r14
+  804c7c:	41 55                	push   %r13
+  804c7e:	41 54                	push   %r12
+  804c80:	53                   	push   %rbx
+  804c81:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c85:	49 89 fe             	mov    %rdi,%r14
+  804c88:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c8f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c96:	00 
+  804c97:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c9e:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804ca5:	00 00 00 
+  804ca8:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804caf:	49 bf fb 48 80 00 00 	movabs $0x8048fb,%r15
+  804cb6:	00 00 00 
+  804cb9:	eb 09                	jmp    804cc4 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cbb:	48 83 c3 20          	add    $0x20,%rbx
+  804cbf:	4c 39 eb             	cmp    %r13,%rbx
+  804cc2:	74 33                	je     804cf7 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804cc4:	48 89 df             	mov    %rbx,%rdi
+  804cc7:	48 8b 33             	mov    (%rbx),%rsi
+  804cca:	4c 39 e6             	cmp    %r12,%rsi
+  804ccd:	73 ec                	jae    804cbb <msync+0x47>
+  804ccf:	48 85 f6             	test   %rsi,%rsi
+  804cd2:	74 e7                	je     804cbb <msync+0x47>
+  804cd4:	48 89 f2             	mov    %rsi,%rdx
+  804cd7:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cdb:	49 39 d6             	cmp    %rdx,%r14
+  804cde:	73 db                	jae    804cbb <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ce0:	4c 39 e2             	cmp    %r12,%rdx
+  804ce3:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ce7:	4c 39 f6             	cmp    %r14,%rsi
+  804cea:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cee:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cf1:	85 c0                	test   %eax,%eax
+  804cf3:	79 c6                	jns    804cbb <msync+0x47>
+  804cf5:	eb 05                	jmp    804cfc <msync+0x88>
+    }
+
+    return 0;
+  804cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cfc:	48 83 c4 08          	add    $0x8,%rsp
+  804d00:	5b                   	pop    %rbx
+  804d01:	41 5c                	pop    %r12
+  804d03:	41 5d                	pop    %r13
+  804d05:	41 5e                	pop    %r14
+  804d07:	41 5f                	pop    %r15
+  804d09:	5d                   	pop    %rbp
+  804d0a:	c3                   	ret
+
+0000000000804d0b <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804d0b:	55                   	push   %rbp
+  804d0c:	48 89 e5             	mov    %rsp,%rbp
+  804d0f:	41 57                	push   %r15
+  804d11:	41 56                	push   %r14
+  804d13:	41 55                	push   %r13
+  804d15:	41 54                	push   %r12
+  804d17:	53                   	push   %rbx
+  804d18:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804d1c:	49 89 ff             	mov    %rdi,%r15
+  804d1f:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d26:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d2d:	00 
+  804d2e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d35:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d3c:	00 00 00 
+  804d3f:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d46:	48 89 d8             	mov    %rbx,%rax
+  804d49:	eb 09                	jmp    804d54 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d4b:	48 83 c0 20          	add    $0x20,%rax
+  804d4f:	4c 39 f0             	cmp    %r14,%rax
+  804d52:	74 40                	je     804d94 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d54:	48 8b 10             	mov    (%rax),%rdx
+  804d57:	4c 39 e2             	cmp    %r12,%rdx
+  804d5a:	73 ef                	jae    804d4b <munmap+0x40>
+  804d5c:	48 85 d2             	test   %rdx,%rdx
+  804d5f:	74 ea                	je     804d4b <munmap+0x40>
+  804d61:	48 89 d7             	mov    %rdx,%rdi
+  804d64:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d68:	49 39 ff             	cmp    %rdi,%r15
+  804d6b:	73 de                	jae    804d4b <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d6d:	49 39 fc             	cmp    %rdi,%r12
+  804d70:	72 05                	jb     804d77 <munmap+0x6c>
+  804d72:	4c 39 fa             	cmp    %r15,%rdx
+  804d75:	73 d4                	jae    804d4b <munmap+0x40>
+  804d77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d7c:	48 83 c4 08          	add    $0x8,%rsp
+  804d80:	5b                   	pop    %rbx
+  804d81:	41 5c                	pop    %r12
+  804d83:	41 5d                	pop    %r13
+  804d85:	41 5e                	pop    %r14
+  804d87:	41 5f                	pop    %r15
+  804d89:	5d                   	pop    %rbp
+  804d8a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d8b:	48 83 c3 20          	add    $0x20,%rbx
+  804d8f:	4c 39 f3             	cmp    %r14,%rbx
+  804d92:	74 5c                	je     804df0 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d94:	48 8b 33             	mov    (%rbx),%rsi
+  804d97:	4c 39 e6             	cmp    %r12,%rsi
+  804d9a:	73 ef                	jae    804d8b <munmap+0x80>
+  804d9c:	48 85 f6             	test   %rsi,%rsi
+  804d9f:	74 ea                	je     804d8b <munmap+0x80>
+  804da1:	48 89 f2             	mov    %rsi,%rdx
+  804da4:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804da8:	49 39 d7             	cmp    %rdx,%r15
+  804dab:	73 de                	jae    804d8b <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804dad:	48 89 df             	mov    %rbx,%rdi
+  804db0:	48 b8 fb 48 80 00 00 	movabs $0x8048fb,%rax
+  804db7:	00 00 00 
+  804dba:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804dbc:	85 c0                	test   %eax,%eax
+  804dbe:	78 bc                	js     804d7c <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804dc0:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804dc4:	48 8b 33             	mov    (%rbx),%rsi
+  804dc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dcc:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  804dd3:	00 00 00 
+  804dd6:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804dd8:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804ddb:	48 b8 b3 2f 80 00 00 	movabs $0x802fb3,%rax
+  804de2:	00 00 00 
+  804de5:	ff d0                	call   *%rax
+        reg->start = 0;
+  804de7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dee:	eb 9b                	jmp    804d8b <munmap+0x80>
+    return 0;
+  804df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df5:	eb 85                	jmp    804d7c <munmap+0x71>
+
+0000000000804df7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfc:	c3                   	ret
+
+0000000000804dfd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dfd:	55                   	push   %rbp
+  804dfe:	48 89 e5             	mov    %rsp,%rbp
+  804e01:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804e04:	48 be 05 63 80 00 00 	movabs $0x806305,%rsi
+  804e0b:	00 00 00 
+  804e0e:	48 b8 fd 1f 80 00 00 	movabs $0x801ffd,%rax
+  804e15:	00 00 00 
+  804e18:	ff d0                	call   *%rax
+    return 0;
+}
+  804e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e1f:	5d                   	pop    %rbp
+  804e20:	c3                   	ret
+
+0000000000804e21 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e21:	55                   	push   %rbp
+  804e22:	48 89 e5             	mov    %rsp,%rbp
+  804e25:	41 57                	push   %r15
+  804e27:	41 56                	push   %r14
+  804e29:	41 55                	push   %r13
+  804e2b:	41 54                	push   %r12
+  804e2d:	53                   	push   %rbx
+  804e2e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e35:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e3c:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e43:	00 00 00 00 
+  804e47:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e4e:	00 00 00 00 
+  804e52:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e59:	00 00 00 00 
+  804e5d:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e64:	00 00 00 00 
+  804e68:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e6f:	00 00 00 00 
+  804e73:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e7a:	00 00 00 00 
+  804e7e:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e85:	00 
+  804e86:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e8d:	00 
+  804e8e:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e95:	00 
+  804e96:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e9d:	00 
+  804e9e:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804ea5:	00 
+  804ea6:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804ead:	00 
+  804eae:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804eb5:	00 
+  804eb6:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804ebd:	00 
+  804ebe:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804ec5:	00 
+  804ec6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804ecd:	00 
+    for (res = 0; res < n; res += inc) {
+  804ece:	48 85 d2             	test   %rdx,%rdx
+  804ed1:	74 7a                	je     804f4d <devcons_write+0x12c>
+  804ed3:	49 89 d6             	mov    %rdx,%r14
+  804ed6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804edc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ee1:	49 bf 4d 23 80 00 00 	movabs $0x80234d,%r15
+  804ee8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804eeb:	4c 89 f3             	mov    %r14,%rbx
+  804eee:	48 29 f3             	sub    %rsi,%rbx
+  804ef1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ef6:	48 39 c3             	cmp    %rax,%rbx
+  804ef9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804efd:	4c 63 eb             	movslq %ebx,%r13
+  804f00:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804f07:	48 01 c6             	add    %rax,%rsi
+  804f0a:	4c 89 ea             	mov    %r13,%rdx
+  804f0d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f14:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804f17:	4c 89 ee             	mov    %r13,%rsi
+  804f1a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f21:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  804f28:	00 00 00 
+  804f2b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f2d:	41 01 dc             	add    %ebx,%r12d
+  804f30:	49 63 f4             	movslq %r12d,%rsi
+  804f33:	4c 39 f6             	cmp    %r14,%rsi
+  804f36:	72 b3                	jb     804eeb <devcons_write+0xca>
+    return res;
+  804f38:	49 63 c4             	movslq %r12d,%rax
+}
+  804f3b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f42:	5b                   	pop    %rbx
+  804f43:	41 5c                	pop    %r12
+  804f45:	41 5d                	pop    %r13
+  804f47:	41 5e                	pop    %r14
+  804f49:	41 5f                	pop    %r15
+  804f4b:	5d                   	pop    %rbp
+  804f4c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f4d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f53:	eb e3                	jmp    804f38 <devcons_write+0x117>
+
+0000000000804f55 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f55:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f5d:	48 85 c0             	test   %rax,%rax
+  804f60:	74 55                	je     804fb7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f62:	55                   	push   %rbp
+  804f63:	48 89 e5             	mov    %rsp,%rbp
+  804f66:	41 55                	push   %r13
+  804f68:	41 54                	push   %r12
+  804f6a:	53                   	push   %rbx
+  804f6b:	48 83 ec 08          	sub    $0x8,%rsp
+  804f6f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f72:	48 bb ad 25 80 00 00 	movabs $0x8025ad,%rbx
+  804f79:	00 00 00 
+  804f7c:	49 bc c1 26 80 00 00 	movabs $0x8026c1,%r12
+  804f83:	00 00 00 
+  804f86:	eb 03                	jmp    804f8b <devcons_read+0x36>
+  804f88:	41 ff d4             	call   *%r12
+  804f8b:	ff d3                	call   *%rbx
+  804f8d:	85 c0                	test   %eax,%eax
+  804f8f:	74 f7                	je     804f88 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f91:	48 63 d0             	movslq %eax,%rdx
+  804f94:	78 13                	js     804fa9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f96:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f9b:	83 f8 04             	cmp    $0x4,%eax
+  804f9e:	74 09                	je     804fa9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804fa0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804fa4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804fa9:	48 89 d0             	mov    %rdx,%rax
+  804fac:	48 83 c4 08          	add    $0x8,%rsp
+  804fb0:	5b                   	pop    %rbx
+  804fb1:	41 5c                	pop    %r12
+  804fb3:	41 5d                	pop    %r13
+  804fb5:	5d                   	pop    %rbp
+  804fb6:	c3                   	ret
+  804fb7:	48 89 d0             	mov    %rdx,%rax
+  804fba:	c3                   	ret
+
+0000000000804fbb <cputchar>:
+cputchar(int ch) {
+  804fbb:	55                   	push   %rbp
+  804fbc:	48 89 e5             	mov    %rsp,%rbp
+  804fbf:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804fc3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fc7:	be 01 00 00 00       	mov    $0x1,%esi
+  804fcc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fd0:	48 b8 7a 25 80 00 00 	movabs $0x80257a,%rax
+  804fd7:	00 00 00 
+  804fda:	ff d0                	call   *%rax
+}
+  804fdc:	c9                   	leave
+  804fdd:	c3                   	ret
+
+0000000000804fde <getchar>:
+getchar(void) {
+  804fde:	55                   	push   %rbp
+  804fdf:	48 89 e5             	mov    %rsp,%rbp
+  804fe2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fe6:	ba 01 00 00 00       	mov    $0x1,%edx
+  804feb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fef:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ff4:	48 b8 31 31 80 00 00 	movabs $0x803131,%rax
+  804ffb:	00 00 00 
+  804ffe:	ff d0                	call   *%rax
+  805000:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805002:	85 c0                	test   %eax,%eax
+  805004:	78 06                	js     80500c <getchar+0x2e>
+  805006:	74 08                	je     805010 <getchar+0x32>
+  805008:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80500c:	89 d0                	mov    %edx,%eax
+  80500e:	c9                   	leave
+  80500f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805010:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805015:	eb f5                	jmp    80500c <getchar+0x2e>
+
+0000000000805017 <iscons>:
+iscons(int fdnum) {
+  805017:	55                   	push   %rbp
+  805018:	48 89 e5             	mov    %rsp,%rbp
+  80501b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80501f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805023:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  80502a:	00 00 00 
+  80502d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80502f:	85 c0                	test   %eax,%eax
+  805031:	78 18                	js     80504b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805033:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805037:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80503e:	00 00 00 
+  805041:	8b 00                	mov    (%rax),%eax
+  805043:	39 02                	cmp    %eax,(%rdx)
+  805045:	0f 94 c0             	sete   %al
+  805048:	0f b6 c0             	movzbl %al,%eax
+}
+  80504b:	c9                   	leave
+  80504c:	c3                   	ret
+
+000000000080504d <opencons>:
+opencons(void) {
+  80504d:	55                   	push   %rbp
+  80504e:	48 89 e5             	mov    %rsp,%rbp
+  805051:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805055:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805059:	48 b8 ee 2d 80 00 00 	movabs $0x802dee,%rax
+  805060:	00 00 00 
+  805063:	ff d0                	call   *%rax
+  805065:	85 c0                	test   %eax,%eax
+  805067:	78 49                	js     8050b2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805069:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80506e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805073:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80507c:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  805083:	00 00 00 
+  805086:	ff d0                	call   *%rax
+  805088:	85 c0                	test   %eax,%eax
+  80508a:	78 26                	js     8050b2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80508c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805090:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805097:	00 00 
+  805099:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80509b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80509f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8050a6:	48 b8 c0 2d 80 00 00 	movabs $0x802dc0,%rax
+  8050ad:	00 00 00 
+  8050b0:	ff d0                	call   *%rax
+}
+  8050b2:	c9                   	leave
+  8050b3:	c3                   	ret
+
+00000000008050b4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8050b4:	55                   	push   %rbp
+  8050b5:	48 89 e5             	mov    %rsp,%rbp
+  8050b8:	41 56                	push   %r14
+  8050ba:	41 55                	push   %r13
+  8050bc:	41 54                	push   %r12
+  8050be:	53                   	push   %rbx
+  8050bf:	48 83 ec 50          	sub    $0x50,%rsp
+  8050c3:	49 89 fc             	mov    %rdi,%r12
+  8050c6:	41 89 f5             	mov    %esi,%r13d
+  8050c9:	48 89 d3             	mov    %rdx,%rbx
+  8050cc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050d0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050d4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050d8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050e3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050e7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050eb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050ef:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050f6:	00 00 00 
+  8050f9:	4c 8b 30             	mov    (%rax),%r14
+  8050fc:	48 b8 8a 26 80 00 00 	movabs $0x80268a,%rax
+  805103:	00 00 00 
+  805106:	ff d0                	call   *%rax
+  805108:	89 c6                	mov    %eax,%esi
+  80510a:	45 89 e8             	mov    %r13d,%r8d
+  80510d:	4c 89 e1             	mov    %r12,%rcx
+  805110:	4c 89 f2             	mov    %r14,%rdx
+  805113:	48 bf 18 63 80 00 00 	movabs $0x806318,%rdi
+  80511a:	00 00 00 
+  80511d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805122:	49 bc c6 16 80 00 00 	movabs $0x8016c6,%r12
+  805129:	00 00 00 
+  80512c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80512f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805133:	48 89 df             	mov    %rbx,%rdi
+  805136:	48 b8 62 16 80 00 00 	movabs $0x801662,%rax
+  80513d:	00 00 00 
+  805140:	ff d0                	call   *%rax
+    cprintf("\n");
+  805142:	48 bf f3 61 80 00 00 	movabs $0x8061f3,%rdi
+  805149:	00 00 00 
+  80514c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805151:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805154:	cc                   	int3
+  805155:	eb fd                	jmp    805154 <_panic+0xa0>
+
+0000000000805157 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805157:	55                   	push   %rbp
+  805158:	48 89 e5             	mov    %rsp,%rbp
+  80515b:	41 56                	push   %r14
+  80515d:	41 55                	push   %r13
+  80515f:	41 54                	push   %r12
+  805161:	53                   	push   %rbx
+  805162:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805165:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80516c:	00 00 00 
+  80516f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805173:	74 27                	je     80519c <_handle_vectored_pagefault+0x45>
+  805175:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80517a:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805181:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805184:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805187:	4c 89 e7             	mov    %r12,%rdi
+  80518a:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80518f:	84 c0                	test   %al,%al
+  805191:	75 45                	jne    8051d8 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805193:	48 83 c3 01          	add    $0x1,%rbx
+  805197:	49 3b 1e             	cmp    (%r14),%rbx
+  80519a:	72 eb                	jb     805187 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80519c:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8051a3:	00 
+  8051a4:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8051a9:	4d 8b 04 24          	mov    (%r12),%r8
+  8051ad:	48 ba 40 63 80 00 00 	movabs $0x806340,%rdx
+  8051b4:	00 00 00 
+  8051b7:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8051bc:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  8051c3:	00 00 00 
+  8051c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051cb:	49 ba b4 50 80 00 00 	movabs $0x8050b4,%r10
+  8051d2:	00 00 00 
+  8051d5:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051d8:	5b                   	pop    %rbx
+  8051d9:	41 5c                	pop    %r12
+  8051db:	41 5d                	pop    %r13
+  8051dd:	41 5e                	pop    %r14
+  8051df:	5d                   	pop    %rbp
+  8051e0:	c3                   	ret
+
+00000000008051e1 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051e1:	55                   	push   %rbp
+  8051e2:	48 89 e5             	mov    %rsp,%rbp
+  8051e5:	53                   	push   %rbx
+  8051e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8051ea:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051ed:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051f2:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051f9:	00 00 00 
+  8051fc:	80 38 00             	cmpb   $0x0,(%rax)
+  8051ff:	74 68                	je     805269 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805201:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805208:	00 00 00 
+  80520b:	48 8b 08             	mov    (%rax),%rcx
+  80520e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805213:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80521a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80521d:	48 85 c9             	test   %rcx,%rcx
+  805220:	0f 84 e0 00 00 00    	je     805306 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805226:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80522a:	0f 84 c9 00 00 00    	je     8052f9 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805230:	48 83 c2 01          	add    $0x1,%rdx
+  805234:	48 39 ca             	cmp    %rcx,%rdx
+  805237:	75 ed                	jne    805226 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805239:	48 83 f9 08          	cmp    $0x8,%rcx
+  80523d:	0f 84 84 00 00 00    	je     8052c7 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805243:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805247:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80524e:	00 00 00 
+  805251:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805258:	00 00 00 
+  80525b:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80525f:	85 f6                	test   %esi,%esi
+  805261:	0f 89 97 00 00 00    	jns    8052fe <add_pgfault_handler+0x11d>
+  805267:	eb 63                	jmp    8052cc <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805269:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80526e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805273:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80527a:	00 00 00 
+  80527d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805282:	48 b8 62 27 80 00 00 	movabs $0x802762,%rax
+  805289:	00 00 00 
+  80528c:	ff d0                	call   *%rax
+  80528e:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805290:	85 c0                	test   %eax,%eax
+  805292:	78 38                	js     8052cc <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805294:	48 be e2 53 80 00 00 	movabs $0x8053e2,%rsi
+  80529b:	00 00 00 
+  80529e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052a3:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  8052aa:	00 00 00 
+  8052ad:	ff d0                	call   *%rax
+  8052af:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8052b1:	85 c0                	test   %eax,%eax
+  8052b3:	78 17                	js     8052cc <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8052b5:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052bc:	00 00 00 
+  8052bf:	c6 00 01             	movb   $0x1,(%rax)
+  8052c2:	e9 3a ff ff ff       	jmp    805201 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052c7:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052cc:	89 f1                	mov    %esi,%ecx
+  8052ce:	48 ba 7e 63 80 00 00 	movabs $0x80637e,%rdx
+  8052d5:	00 00 00 
+  8052d8:	be 42 00 00 00       	mov    $0x42,%esi
+  8052dd:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  8052e4:	00 00 00 
+  8052e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ec:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  8052f3:	00 00 00 
+  8052f6:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052f9:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052fe:	89 f0                	mov    %esi,%eax
+  805300:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805304:	c9                   	leave
+  805305:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805306:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80530d:	00 00 00 
+  805310:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805317:	48 89 d8             	mov    %rbx,%rax
+  80531a:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805321:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805324:	eb d8                	jmp    8052fe <add_pgfault_handler+0x11d>
+
+0000000000805326 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805326:	55                   	push   %rbp
+  805327:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80532a:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805331:	00 00 00 
+  805334:	80 38 00             	cmpb   $0x0,(%rax)
+  805337:	74 33                	je     80536c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805339:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805340:	00 00 00 
+  805343:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805348:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80534f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805352:	48 85 c0             	test   %rax,%rax
+  805355:	0f 84 85 00 00 00    	je     8053e0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80535b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80535f:	74 40                	je     8053a1 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805361:	48 83 c1 01          	add    $0x1,%rcx
+  805365:	48 39 c1             	cmp    %rax,%rcx
+  805368:	75 f1                	jne    80535b <remove_pgfault_handler+0x35>
+  80536a:	eb 74                	jmp    8053e0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80536c:	48 b9 96 63 80 00 00 	movabs $0x806396,%rcx
+  805373:	00 00 00 
+  805376:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80537d:	00 00 00 
+  805380:	be 48 00 00 00       	mov    $0x48,%esi
+  805385:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  80538c:	00 00 00 
+  80538f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805394:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  80539b:	00 00 00 
+  80539e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8053a1:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8053a8:	00 
+  8053a9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8053ad:	48 29 ca             	sub    %rcx,%rdx
+  8053b0:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8053b7:	00 00 00 
+  8053ba:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8053be:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053c3:	48 89 ce             	mov    %rcx,%rsi
+  8053c6:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  8053cd:	00 00 00 
+  8053d0:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053d2:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053d9:	00 00 00 
+  8053dc:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053e0:	5d                   	pop    %rbp
+  8053e1:	c3                   	ret
+
+00000000008053e2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053e2:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053e5:	48 b8 57 51 80 00 00 	movabs $0x805157,%rax
+  8053ec:	00 00 00 
+    call *%rax
+  8053ef:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053f1:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053f8:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053f9:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805400:	00 
+    subq $8, %rcx
+  805401:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805405:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805408:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80540f:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805410:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805414:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805418:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80541d:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805422:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805427:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80542c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805431:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805436:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80543b:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805440:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805445:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80544a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80544f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805454:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805459:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80545e:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805462:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805466:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805467:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805468:	c3                   	ret
+
+0000000000805469 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805469:	85 ff                	test   %edi,%edi
+  80546b:	78 58                	js     8054c5 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80546d:	48 85 f6             	test   %rsi,%rsi
+  805470:	74 12                	je     805484 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805472:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805479:	00 00 00 
+  80547c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805482:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805484:	48 85 c9             	test   %rcx,%rcx
+  805487:	74 12                	je     80549b <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805489:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805490:	00 00 00 
+  805493:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805499:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80549b:	48 85 d2             	test   %rdx,%rdx
+  80549e:	74 14                	je     8054b4 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8054a0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054a7:	00 00 00 
+  8054aa:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8054b1:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8054b4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054bb:	00 00 00 
+  8054be:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054c4:	c3                   	ret
+        if (from_env_store) {
+  8054c5:	48 85 f6             	test   %rsi,%rsi
+  8054c8:	74 06                	je     8054d0 <ipc_result+0x67>
+            *from_env_store = 0;
+  8054ca:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054d0:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054d2:	48 85 c9             	test   %rcx,%rcx
+  8054d5:	74 ed                	je     8054c4 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054d7:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054dd:	c3                   	ret
+
+00000000008054de <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054de:	55                   	push   %rbp
+  8054df:	48 89 e5             	mov    %rsp,%rbp
+  8054e2:	41 55                	push   %r13
+  8054e4:	41 54                	push   %r12
+  8054e6:	53                   	push   %rbx
+  8054e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8054eb:	49 89 fc             	mov    %rdi,%r12
+  8054ee:	48 89 f7             	mov    %rsi,%rdi
+  8054f1:	48 89 d3             	mov    %rdx,%rbx
+  8054f4:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054f7:	48 85 f6             	test   %rsi,%rsi
+  8054fa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805501:	00 00 00 
+  805504:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805508:	be 00 00 00 00       	mov    $0x0,%esi
+  80550d:	48 85 d2             	test   %rdx,%rdx
+  805510:	74 03                	je     805515 <ipc_recv+0x37>
+  805512:	48 8b 32             	mov    (%rdx),%rsi
+  805515:	48 b8 ae 2c 80 00 00 	movabs $0x802cae,%rax
+  80551c:	00 00 00 
+  80551f:	ff d0                	call   *%rax
+  805521:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805523:	4c 89 e9             	mov    %r13,%rcx
+  805526:	48 89 da             	mov    %rbx,%rdx
+  805529:	4c 89 e6             	mov    %r12,%rsi
+  80552c:	48 b8 69 54 80 00 00 	movabs $0x805469,%rax
+  805533:	00 00 00 
+  805536:	ff d0                	call   *%rax
+}
+  805538:	48 83 c4 08          	add    $0x8,%rsp
+  80553c:	5b                   	pop    %rbx
+  80553d:	41 5c                	pop    %r12
+  80553f:	41 5d                	pop    %r13
+  805541:	5d                   	pop    %rbp
+  805542:	c3                   	ret
+
+0000000000805543 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805543:	55                   	push   %rbp
+  805544:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805547:	48 85 d2             	test   %rdx,%rdx
+  80554a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805551:	00 00 00 
+  805554:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805558:	89 f6                	mov    %esi,%esi
+  80555a:	48 b8 3a 2b 80 00 00 	movabs $0x802b3a,%rax
+  805561:	00 00 00 
+  805564:	ff d0                	call   *%rax
+    if (res < 0) {
+  805566:	85 c0                	test   %eax,%eax
+  805568:	78 02                	js     80556c <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80556a:	5d                   	pop    %rbp
+  80556b:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80556c:	89 c1                	mov    %eax,%ecx
+  80556e:	48 ba b0 63 80 00 00 	movabs $0x8063b0,%rdx
+  805575:	00 00 00 
+  805578:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80557d:	48 bf bd 63 80 00 00 	movabs $0x8063bd,%rdi
+  805584:	00 00 00 
+  805587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80558c:	49 b8 b4 50 80 00 00 	movabs $0x8050b4,%r8
+  805593:	00 00 00 
+  805596:	41 ff d0             	call   *%r8
+
+0000000000805599 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805599:	55                   	push   %rbp
+  80559a:	48 89 e5             	mov    %rsp,%rbp
+  80559d:	53                   	push   %rbx
+  80559e:	48 83 ec 08          	sub    $0x8,%rsp
+  8055a2:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8055a6:	48 85 d2             	test   %rdx,%rdx
+  8055a9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055b0:	00 00 00 
+  8055b3:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8055b7:	4d 85 c9             	test   %r9,%r9
+  8055ba:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8055be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055c3:	48 85 db             	test   %rbx,%rbx
+  8055c6:	74 03                	je     8055cb <ipc_call+0x32>
+  8055c8:	48 8b 03             	mov    (%rbx),%rax
+  8055cb:	89 f6                	mov    %esi,%esi
+  8055cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8055d1:	50                   	push   %rax
+  8055d2:	48 b8 6c 2b 80 00 00 	movabs $0x802b6c,%rax
+  8055d9:	00 00 00 
+  8055dc:	ff d0                	call   *%rax
+  8055de:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055e0:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055e4:	48 89 da             	mov    %rbx,%rdx
+  8055e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8055ec:	48 b8 69 54 80 00 00 	movabs $0x805469,%rax
+  8055f3:	00 00 00 
+  8055f6:	ff d0                	call   *%rax
+}
+  8055f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055fc:	c9                   	leave
+  8055fd:	c3                   	ret
+
+00000000008055fe <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055fe:	55                   	push   %rbp
+  8055ff:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805602:	89 f6                	mov    %esi,%esi
+  805604:	48 b8 d8 2b 80 00 00 	movabs $0x802bd8,%rax
+  80560b:	00 00 00 
+  80560e:	ff d0                	call   *%rax
+  805610:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80561c:	be 00 00 00 00       	mov    $0x0,%esi
+  805621:	48 b8 69 54 80 00 00 	movabs $0x805469,%rax
+  805628:	00 00 00 
+  80562b:	ff d0                	call   *%rax
+}
+  80562d:	5d                   	pop    %rbp
+  80562e:	c3                   	ret
+
+000000000080562f <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80562f:	55                   	push   %rbp
+  805630:	48 89 e5             	mov    %rsp,%rbp
+  805633:	41 54                	push   %r12
+  805635:	53                   	push   %rbx
+  805636:	4c 89 cb             	mov    %r9,%rbx
+  805639:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80563d:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805641:	48 85 d2             	test   %rdx,%rdx
+  805644:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80564b:	00 00 00 
+  80564e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805652:	4d 85 c9             	test   %r9,%r9
+  805655:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80565e:	4d 85 e4             	test   %r12,%r12
+  805661:	74 04                	je     805667 <ipc_reply_wait+0x38>
+  805663:	49 8b 04 24          	mov    (%r12),%rax
+  805667:	89 f6                	mov    %esi,%esi
+  805669:	48 83 ec 08          	sub    $0x8,%rsp
+  80566d:	50                   	push   %rax
+  80566e:	48 b8 42 2c 80 00 00 	movabs $0x802c42,%rax
+  805675:	00 00 00 
+  805678:	ff d0                	call   *%rax
+  80567a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80567c:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805680:	4c 89 e2             	mov    %r12,%rdx
+  805683:	48 89 de             	mov    %rbx,%rsi
+  805686:	48 b8 69 54 80 00 00 	movabs $0x805469,%rax
+  80568d:	00 00 00 
+  805690:	ff d0                	call   *%rax
+}
+  805692:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805696:	5b                   	pop    %rbx
+  805697:	41 5c                	pop    %r12
+  805699:	5d                   	pop    %rbp
+  80569a:	c3                   	ret
+
+000000000080569b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80569b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8056a0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8056a7:	00 00 00 
+  8056aa:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8056b1:	48 01 ca             	add    %rcx,%rdx
+  8056b4:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8056ba:	39 fa                	cmp    %edi,%edx
+  8056bc:	74 12                	je     8056d0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8056be:	48 83 c0 01          	add    $0x1,%rax
+  8056c2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056c8:	75 e0                	jne    8056aa <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056cf:	c3                   	ret
+            return envs[i].env_id;
+  8056d0:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056d7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056de:	00 00 00 
+  8056e1:	48 01 d0             	add    %rdx,%rax
+  8056e4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056ea:	c3                   	ret
+  8056eb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008056f0 <__rodata_start>:
+  8056f0:	77 00                	ja     8056f2 <__rodata_start+0x2>
+  8056f2:	72 62                	jb     805756 <__rodata_start+0x66>
+  8056f4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056f7:	00 0f                	add    %cl,(%rdi)
+  8056f9:	1f                   	(bad)
+  8056fa:	84 00                	test   %al,(%rax)
+  8056fc:	00 00                	add    %al,(%rax)
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	b3 09                	mov    $0x9,%bl
+  805702:	80 00 00             	addb   $0x0,(%rax)
+  805705:	00 00                	add    %al,(%rax)
+  805707:	00 ed                	add    %ch,%ch
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 ed                	add    %ch,%ch
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	ed                   	in     (%dx),%eax
+  805739:	0d 80 00 00 00       	or     $0x80,%eax
+  80573e:	00 00                	add    %al,(%rax)
+  805740:	ed                   	in     (%dx),%eax
+  805741:	0d 80 00 00 00       	or     $0x80,%eax
+  805746:	00 00                	add    %al,(%rax)
+  805748:	ed                   	in     (%dx),%eax
+  805749:	0d 80 00 00 00       	or     $0x80,%eax
+  80574e:	00 00                	add    %al,(%rax)
+  805750:	ed                   	in     (%dx),%eax
+  805751:	0d 80 00 00 00       	or     $0x80,%eax
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	8c 0a                	mov    %cs,(%rdx)
+  80578a:	80 00 00             	addb   $0x0,(%rax)
+  80578d:	00 00                	add    %al,(%rax)
+  80578f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805796:	00 00                	add    %al,(%rax)
+  805798:	8c 0a                	mov    %cs,(%rdx)
+  80579a:	80 00 00             	addb   $0x0,(%rax)
+  80579d:	00 00                	add    %al,(%rax)
+  80579f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	f4                   	hlt
+  805899:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80589f:	00 ed                	add    %ch,%ch
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	2c 0b                	sub    $0xb,%al
+  8058b2:	80 00 00             	addb   $0x0,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 ed                	add    %ch,%ch
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058f3:	00 00                	add    %al,(%rax)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 cb                	add    %cl,%bl
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	6a 0a                	push   $0xa
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	3c 0a                	cmp    $0xa,%al
+  80593a:	80 00 00             	addb   $0x0,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 ed                	add    %ch,%ch
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80594b:	00 00                	add    %al,(%rax)
+  80594d:	00 00                	add    %al,(%rax)
+  80594f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 29                	add    %ch,(%rcx)
+  805959:	0c 80                	or     $0x80,%al
+  80595b:	00 00                	add    %al,(%rax)
+  80595d:	00 00                	add    %al,(%rax)
+  80595f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805962:	80 00 00             	addb   $0x0,(%rax)
+  805965:	00 00                	add    %al,(%rax)
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	1a 0b                	sbb    (%rbx),%cl
+  805972:	80 00 00             	addb   $0x0,(%rax)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 ed                	add    %ch,%ch
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ce                   	(bad)
+  805981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805987:	00 ed                	add    %ch,%ch
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	f4                   	hlt
+  805999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80599f:	00 37                	add    %dh,(%rdi)
+  8059a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059aa:	80 00 00             	addb   $0x0,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 37                	add    %dh,(%rdi)
+  8059b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059c2:	80 00 00             	addb   $0x0,(%rax)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059cb:	00 00                	add    %al,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 d2                	add    %dl,%dl
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 d2                	add    %dl,%dl
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 d2                	add    %dl,%dl
+  8059f9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ff:	00 d2                	add    %dl,%dl
+  805a01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a07:	00 f6                	add    %dh,%dh
+  805a09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a0f:	00 f6                	add    %dh,%dh
+  805a11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a32:	80 00 00             	addb   $0x0,(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 22                	add    %ah,(%rdx)
+  805a61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a67:	00 22                	add    %ah,(%rdx)
+  805a69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a6f:	00 22                	add    %ah,(%rdx)
+  805a71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a77:	00 22                	add    %ah,(%rdx)
+  805a79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 46 12             	add    %al,0x12(%rsi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 22                	add    %ah,(%rdx)
+  805b61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b67:	00 22                	add    %ah,(%rdx)
+  805b69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b6f:	00 22                	add    %ah,(%rdx)
+  805b71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b77:	00 22                	add    %ah,(%rdx)
+  805b79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 46 12             	add    %al,0x12(%rsi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c20 <basefix.0>:
+  805c20:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c30:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c40:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c50:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c60:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c70:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c80:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c90:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805ca0:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805cb0:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805cc0:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805cd0:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805ce0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cf0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805d00:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805d10:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805d20:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805d30:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d40:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d50:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d60:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d70:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d80:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d90:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805da0:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805db0:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805dc0:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805dd0:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805de0:	be 18 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805df0:	05 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805e00:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805e10:	15 1f 80 00 00 00 00 00 dd 18 80 00 00 00 00 00     ................
+  805e20:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805e30:	d1 18 80 00 00 00 00 00 4b 19 80 00 00 00 00 00     ........K.......
+  805e40:	15 1f 80 00 00 00 00 00 d1 18 80 00 00 00 00 00     ................
+  805e50:	17 19 80 00 00 00 00 00 17 19 80 00 00 00 00 00     ................
+  805e60:	17 19 80 00 00 00 00 00 17 19 80 00 00 00 00 00     ................
+  805e70:	17 19 80 00 00 00 00 00 17 19 80 00 00 00 00 00     ................
+  805e80:	17 19 80 00 00 00 00 00 17 19 80 00 00 00 00 00     ................
+  805e90:	17 19 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805ea0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805eb0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805ec0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805ed0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805ee0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805ef0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f00:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f10:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f20:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f30:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f40:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f50:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f60:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f70:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805f80:	15 1f 80 00 00 00 00 00 33 1e 80 00 00 00 00 00     ........3.......
+  805f90:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805fa0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805fb0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805fc0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805fd0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  805fe0:	79 19 80 00 00 00 00 00 48 1b 80 00 00 00 00 00     y.......H.......
+  805ff0:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  806000:	15 1f 80 00 00 00 00 00 6e 19 80 00 00 00 00 00     ........n.......
+  806010:	a8 19 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  806020:	15 1f 80 00 00 00 00 00 63 19 80 00 00 00 00 00     ........c.......
+  806030:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  806040:	f1 1c 80 00 00 00 00 00 c0 1d 80 00 00 00 00 00     ................
+  806050:	15 1f 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  806060:	3f 1a 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ?...............
+  806070:	1c 1c 80 00 00 00 00 00 15 1f 80 00 00 00 00 00     ................
+  806080:	15 1f 80 00 00 00 00 00 33 1e 80 00 00 00 00 00     ........3.......
+  806090:	15 1f 80 00 00 00 00 00 c7 18 80 00 00 00 00 00     ................
+
+00000000008060a0 <error_string>:
+	...
+  8060a8:	7e 5c 80 00 00 00 00 00 90 5c 80 00 00 00 00 00     ~\.......\......
+  8060b8:	a0 5c 80 00 00 00 00 00 b2 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	c0 5c 80 00 00 00 00 00 d4 5c 80 00 00 00 00 00     .\.......\......
+  8060d8:	e9 5c 80 00 00 00 00 00 fc 5c 80 00 00 00 00 00     .\.......\......
+  8060e8:	0e 5d 80 00 00 00 00 00 22 5d 80 00 00 00 00 00     .]......"]......
+  8060f8:	32 5d 80 00 00 00 00 00 45 5d 80 00 00 00 00 00     2]......E]......
+  806108:	5c 5d 80 00 00 00 00 00 72 5d 80 00 00 00 00 00     \]......r]......
+  806118:	8a 5d 80 00 00 00 00 00 a2 5d 80 00 00 00 00 00     .].......]......
+  806128:	af 5d 80 00 00 00 00 00 40 61 80 00 00 00 00 00     .]......@a......
+  806138:	c3 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806148:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806158:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806168:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806178:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806188:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806198:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8061a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8061b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806208:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806218:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806220 <devtab>:
+  806220:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806230:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806240:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806250:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806260:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806270:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806280:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806290:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8062a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8062b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806300:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806310:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806320:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806330:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806340:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806350:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806360:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806370:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806380:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806390:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8063a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8063b0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063c0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806400:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806410:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806420:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806430:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806440:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806450:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806460:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
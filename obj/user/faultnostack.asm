@@ -0,0 +1,10324 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 00 21 80 00 00 	movabs $0x802100,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 c7 32 80 00 00 	movabs $0x8032c7,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 c7 32 80 00 00 	movabs $0x8032c7,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 9d 3c 80 00 00 	movabs $0x803c9d,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 0f 1f 80 00 00 	movabs $0x801f0f,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 9d 3c 80 00 00 	movabs $0x803c9d,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 0f 1f 80 00 00 	movabs $0x801f0f,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 90 5c 80 00 00 	movabs $0x805c90,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be d0 56 80 00 00 	movabs $0x8056d0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be d2 56 80 00 00 	movabs $0x8056d2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be d5 56 80 00 00 	movabs $0x8056d5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 9b 4a 80 00 00 	movabs $0x804a9b,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 72 4d 80 00 00 	movabs $0x804d72,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 1a 30 80 00 00 	movabs $0x80301a,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 b1 33 80 00 00 	movabs $0x8033b1,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 c7 32 80 00 00 	movabs $0x8032c7,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 1a 30 80 00 00 	movabs $0x80301a,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 4c 22 80 00 00 	movabs $0x80224c,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 4c 22 80 00 00 	movabs $0x80224c,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 4c 22 80 00 00 	movabs $0x80224c,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 4c 22 80 00 00 	movabs $0x80224c,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 4c 22 80 00 00 	movabs $0x80224c,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 2e 00 00 00       	call   80152d <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  801505:	48 be a0 2d 80 00 00 	movabs $0x802da0,%rsi
+  80150c:	00 00 00 
+  80150f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801514:	48 b8 65 29 80 00 00 	movabs $0x802965,%rax
+  80151b:	00 00 00 
+  80151e:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  801520:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  801527:	00 00 00 00 
+#endif
+}
+  80152b:	5d                   	pop    %rbp
+  80152c:	c3                   	ret
+
+000000000080152d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80152d:	55                   	push   %rbp
+  80152e:	48 89 e5             	mov    %rsp,%rbp
+  801531:	41 56                	push   %r14
+  801533:	41 55                	push   %r13
+  801535:	41 54                	push   %r12
+  801537:	53                   	push   %rbx
+  801538:	41 89 fd             	mov    %edi,%r13d
+  80153b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80153e:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801545:	00 00 00 
+  801548:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80154f:	00 00 00 
+  801552:	48 39 c2             	cmp    %rax,%rdx
+  801555:	73 17                	jae    80156e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801557:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80155a:	49 89 c4             	mov    %rax,%r12
+  80155d:	48 83 c3 08          	add    $0x8,%rbx
+  801561:	b8 00 00 00 00       	mov    $0x0,%eax
+  801566:	ff 53 f8             	call   *-0x8(%rbx)
+  801569:	4c 39 e3             	cmp    %r12,%rbx
+  80156c:	72 ef                	jb     80155d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80156e:	48 b8 6a 26 80 00 00 	movabs $0x80266a,%rax
+  801575:	00 00 00 
+  801578:	ff d0                	call   *%rax
+  80157a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80157f:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801586:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80158d:	00 00 00 
+  801590:	48 01 d0             	add    %rdx,%rax
+  801593:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80159a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80159d:	45 85 ed             	test   %r13d,%r13d
+  8015a0:	7e 0d                	jle    8015af <libmain+0x82>
+  8015a2:	49 8b 06             	mov    (%r14),%rax
+  8015a5:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015ac:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015af:	4c 89 f6             	mov    %r14,%rsi
+  8015b2:	44 89 ef             	mov    %r13d,%edi
+  8015b5:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015bc:	00 00 00 
+  8015bf:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015c1:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  8015c8:	00 00 00 
+  8015cb:	ff d0                	call   *%rax
+#endif
+}
+  8015cd:	5b                   	pop    %rbx
+  8015ce:	41 5c                	pop    %r12
+  8015d0:	41 5d                	pop    %r13
+  8015d2:	41 5e                	pop    %r14
+  8015d4:	5d                   	pop    %rbp
+  8015d5:	c3                   	ret
+
+00000000008015d6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015d6:	55                   	push   %rbp
+  8015d7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015da:	48 b8 4d 30 80 00 00 	movabs $0x80304d,%rax
+  8015e1:	00 00 00 
+  8015e4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015eb:	48 b8 f9 25 80 00 00 	movabs $0x8025f9,%rax
+  8015f2:	00 00 00 
+  8015f5:	ff d0                	call   *%rax
+}
+  8015f7:	5d                   	pop    %rbp
+  8015f8:	c3                   	ret
+
+00000000008015f9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015f9:	55                   	push   %rbp
+  8015fa:	48 89 e5             	mov    %rsp,%rbp
+  8015fd:	53                   	push   %rbx
+  8015fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801602:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801605:	8b 06                	mov    (%rsi),%eax
+  801607:	8d 50 01             	lea    0x1(%rax),%edx
+  80160a:	89 16                	mov    %edx,(%rsi)
+  80160c:	48 98                	cltq
+  80160e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801613:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801619:	74 0a                	je     801625 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80161b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80161f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801623:	c9                   	leave
+  801624:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801625:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801629:	be ff 00 00 00       	mov    $0xff,%esi
+  80162e:	48 b8 5a 25 80 00 00 	movabs $0x80255a,%rax
+  801635:	00 00 00 
+  801638:	ff d0                	call   *%rax
+        state->offset = 0;
+  80163a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801640:	eb d9                	jmp    80161b <putch+0x22>
+
+0000000000801642 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801642:	55                   	push   %rbp
+  801643:	48 89 e5             	mov    %rsp,%rbp
+  801646:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80164d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801650:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801657:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80165c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801661:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801664:	48 89 f1             	mov    %rsi,%rcx
+  801667:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80166e:	48 bf f9 15 80 00 00 	movabs $0x8015f9,%rdi
+  801675:	00 00 00 
+  801678:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  80167f:	00 00 00 
+  801682:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801684:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80168b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801692:	48 b8 5a 25 80 00 00 	movabs $0x80255a,%rax
+  801699:	00 00 00 
+  80169c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80169e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+00000000008016a6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016a6:	55                   	push   %rbp
+  8016a7:	48 89 e5             	mov    %rsp,%rbp
+  8016aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8016ae:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016b2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016c2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016d9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016dd:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  8016e4:	00 00 00 
+  8016e7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016e9:	c9                   	leave
+  8016ea:	c3                   	ret
+
+00000000008016eb <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016eb:	55                   	push   %rbp
+  8016ec:	48 89 e5             	mov    %rsp,%rbp
+  8016ef:	41 57                	push   %r15
+  8016f1:	41 56                	push   %r14
+  8016f3:	41 55                	push   %r13
+  8016f5:	41 54                	push   %r12
+  8016f7:	53                   	push   %rbx
+  8016f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8016fc:	49 89 fc             	mov    %rdi,%r12
+  8016ff:	49 89 f5             	mov    %rsi,%r13
+  801702:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801706:	8b 45 10             	mov    0x10(%rbp),%eax
+  801709:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80170c:	41 89 cf             	mov    %ecx,%r15d
+  80170f:	4c 39 fa             	cmp    %r15,%rdx
+  801712:	73 5b                	jae    80176f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801714:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801718:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80171c:	85 db                	test   %ebx,%ebx
+  80171e:	7e 0e                	jle    80172e <print_num+0x43>
+            putch(padc, put_arg);
+  801720:	4c 89 ee             	mov    %r13,%rsi
+  801723:	44 89 f7             	mov    %r14d,%edi
+  801726:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801729:	83 eb 01             	sub    $0x1,%ebx
+  80172c:	75 f2                	jne    801720 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80172e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801732:	48 b9 3d 5c 80 00 00 	movabs $0x805c3d,%rcx
+  801739:	00 00 00 
+  80173c:	48 b8 2c 5c 80 00 00 	movabs $0x805c2c,%rax
+  801743:	00 00 00 
+  801746:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80174a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801753:	49 f7 f7             	div    %r15
+  801756:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80175a:	4c 89 ee             	mov    %r13,%rsi
+  80175d:	41 ff d4             	call   *%r12
+}
+  801760:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801764:	5b                   	pop    %rbx
+  801765:	41 5c                	pop    %r12
+  801767:	41 5d                	pop    %r13
+  801769:	41 5e                	pop    %r14
+  80176b:	41 5f                	pop    %r15
+  80176d:	5d                   	pop    %rbp
+  80176e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80176f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801773:	ba 00 00 00 00       	mov    $0x0,%edx
+  801778:	49 f7 f7             	div    %r15
+  80177b:	48 83 ec 08          	sub    $0x8,%rsp
+  80177f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801783:	52                   	push   %rdx
+  801784:	45 0f be c9          	movsbl %r9b,%r9d
+  801788:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80178c:	48 89 c2             	mov    %rax,%rdx
+  80178f:	48 b8 eb 16 80 00 00 	movabs $0x8016eb,%rax
+  801796:	00 00 00 
+  801799:	ff d0                	call   *%rax
+  80179b:	48 83 c4 10          	add    $0x10,%rsp
+  80179f:	eb 8d                	jmp    80172e <print_num+0x43>
+
+00000000008017a1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017a1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017a5:	48 8b 06             	mov    (%rsi),%rax
+  8017a8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017ac:	73 0a                	jae    8017b8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017ae:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017b2:	48 89 16             	mov    %rdx,(%rsi)
+  8017b5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017b8:	c3                   	ret
+
+00000000008017b9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017b9:	55                   	push   %rbp
+  8017ba:	48 89 e5             	mov    %rsp,%rbp
+  8017bd:	48 83 ec 50          	sub    $0x50,%rsp
+  8017c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017c5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017c9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017cd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017dc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017e4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017e8:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  8017ef:	00 00 00 
+  8017f2:	ff d0                	call   *%rax
+}
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+
+00000000008017f6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017f6:	55                   	push   %rbp
+  8017f7:	48 89 e5             	mov    %rsp,%rbp
+  8017fa:	41 57                	push   %r15
+  8017fc:	41 56                	push   %r14
+  8017fe:	41 55                	push   %r13
+  801800:	41 54                	push   %r12
+  801802:	53                   	push   %rbx
+  801803:	48 83 ec 38          	sub    $0x38,%rsp
+  801807:	49 89 fe             	mov    %rdi,%r14
+  80180a:	49 89 f5             	mov    %rsi,%r13
+  80180d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801810:	48 8b 01             	mov    (%rcx),%rax
+  801813:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801817:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80181b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80181f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801823:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801827:	eb 0d                	jmp    801836 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801829:	40 0f b6 ff          	movzbl %dil,%edi
+  80182d:	4c 89 ee             	mov    %r13,%rsi
+  801830:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801833:	4c 89 e3             	mov    %r12,%rbx
+  801836:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80183a:	0f b6 3b             	movzbl (%rbx),%edi
+  80183d:	40 80 ff 25          	cmp    $0x25,%dil
+  801841:	74 14                	je     801857 <vprintfmt+0x61>
+            if (!ch) return;
+  801843:	40 84 ff             	test   %dil,%dil
+  801846:	75 e1                	jne    801829 <vprintfmt+0x33>
+}
+  801848:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80184c:	5b                   	pop    %rbx
+  80184d:	41 5c                	pop    %r12
+  80184f:	41 5d                	pop    %r13
+  801851:	41 5e                	pop    %r14
+  801853:	41 5f                	pop    %r15
+  801855:	5d                   	pop    %rbp
+  801856:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801857:	be 00 00 00 00       	mov    $0x0,%esi
+  80185c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801860:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801865:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80186b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801872:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801876:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80187b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801880:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801883:	83 e8 23             	sub    $0x23,%eax
+  801886:	3c 57                	cmp    $0x57,%al
+  801888:	0f 87 67 06 00 00    	ja     801ef5 <vprintfmt+0x6ff>
+  80188e:	0f b6 c0             	movzbl %al,%eax
+  801891:	48 b9 c0 5d 80 00 00 	movabs $0x805dc0,%rcx
+  801898:	00 00 00 
+  80189b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80189e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018a1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018a5:	eb cf                	jmp    801876 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018a7:	49 89 dc             	mov    %rbx,%r12
+  8018aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8018af:	eb c5                	jmp    801876 <vprintfmt+0x80>
+            padc = ch;
+  8018b1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018b5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018b8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018bb:	eb b9                	jmp    801876 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8018c3:	77 24                	ja     8018e9 <vprintfmt+0xf3>
+  8018c5:	89 c1                	mov    %eax,%ecx
+  8018c7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018cb:	83 c0 08             	add    $0x8,%eax
+  8018ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018d1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018d4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018d7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018db:	79 99                	jns    801876 <vprintfmt+0x80>
+                width = precision;
+  8018dd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018e1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018e7:	eb 8d                	jmp    801876 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018e9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018ed:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f5:	eb da                	jmp    8018d1 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018f7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018fc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801900:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801906:	3c 39                	cmp    $0x39,%al
+  801908:	77 1c                	ja     801926 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  80190a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80190e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801912:	0f b6 c0             	movzbl %al,%eax
+  801915:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80191a:	0f b6 03             	movzbl (%rbx),%eax
+  80191d:	3c 39                	cmp    $0x39,%al
+  80191f:	76 e9                	jbe    80190a <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801921:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801924:	eb b1                	jmp    8018d7 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801926:	49 89 dc             	mov    %rbx,%r12
+  801929:	eb ac                	jmp    8018d7 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80192b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80192e:	85 c9                	test   %ecx,%ecx
+  801930:	b8 00 00 00 00       	mov    $0x0,%eax
+  801935:	0f 49 c1             	cmovns %ecx,%eax
+  801938:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80193b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80193e:	e9 33 ff ff ff       	jmp    801876 <vprintfmt+0x80>
+            lflag++;
+  801943:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801946:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801949:	e9 28 ff ff ff       	jmp    801876 <vprintfmt+0x80>
+            lflag--;
+  80194e:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801951:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801954:	e9 1d ff ff ff       	jmp    801876 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801959:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80195c:	83 f8 2f             	cmp    $0x2f,%eax
+  80195f:	77 19                	ja     80197a <vprintfmt+0x184>
+  801961:	89 c2                	mov    %eax,%edx
+  801963:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801967:	83 c0 08             	add    $0x8,%eax
+  80196a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80196d:	8b 3a                	mov    (%rdx),%edi
+  80196f:	4c 89 ee             	mov    %r13,%rsi
+  801972:	41 ff d6             	call   *%r14
+            break;
+  801975:	e9 bc fe ff ff       	jmp    801836 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80197a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80197e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801986:	eb e5                	jmp    80196d <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80198b:	83 f8 2f             	cmp    $0x2f,%eax
+  80198e:	77 5a                	ja     8019ea <vprintfmt+0x1f4>
+  801990:	89 c2                	mov    %eax,%edx
+  801992:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801996:	83 c0 08             	add    $0x8,%eax
+  801999:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80199c:	8b 02                	mov    (%rdx),%eax
+  80199e:	89 c1                	mov    %eax,%ecx
+  8019a0:	f7 d9                	neg    %ecx
+  8019a2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019a5:	83 f9 13             	cmp    $0x13,%ecx
+  8019a8:	7f 4e                	jg     8019f8 <vprintfmt+0x202>
+  8019aa:	48 63 c1             	movslq %ecx,%rax
+  8019ad:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8019b4:	00 00 00 
+  8019b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019bb:	48 85 c0             	test   %rax,%rax
+  8019be:	74 38                	je     8019f8 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019c0:	48 89 c1             	mov    %rax,%rcx
+  8019c3:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8019ca:	00 00 00 
+  8019cd:	4c 89 ee             	mov    %r13,%rsi
+  8019d0:	4c 89 f7             	mov    %r14,%rdi
+  8019d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d8:	49 b8 b9 17 80 00 00 	movabs $0x8017b9,%r8
+  8019df:	00 00 00 
+  8019e2:	41 ff d0             	call   *%r8
+  8019e5:	e9 4c fe ff ff       	jmp    801836 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019f6:	eb a4                	jmp    80199c <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019f8:	48 ba 55 5c 80 00 00 	movabs $0x805c55,%rdx
+  8019ff:	00 00 00 
+  801a02:	4c 89 ee             	mov    %r13,%rsi
+  801a05:	4c 89 f7             	mov    %r14,%rdi
+  801a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0d:	49 b8 b9 17 80 00 00 	movabs $0x8017b9,%r8
+  801a14:	00 00 00 
+  801a17:	41 ff d0             	call   *%r8
+  801a1a:	e9 17 fe ff ff       	jmp    801836 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a22:	83 f8 2f             	cmp    $0x2f,%eax
+  801a25:	77 6c                	ja     801a93 <vprintfmt+0x29d>
+  801a27:	89 c2                	mov    %eax,%edx
+  801a29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a2d:	83 c0 08             	add    $0x8,%eax
+  801a30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a33:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a36:	48 85 f6             	test   %rsi,%rsi
+  801a39:	48 b8 4e 5c 80 00 00 	movabs $0x805c4e,%rax
+  801a40:	00 00 00 
+  801a43:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a47:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a4b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a4f:	7e 06                	jle    801a57 <vprintfmt+0x261>
+  801a51:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a55:	75 4a                	jne    801aa1 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a57:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a5b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a5f:	0f b6 00             	movzbl (%rax),%eax
+  801a62:	84 c0                	test   %al,%al
+  801a64:	0f 85 9a 00 00 00    	jne    801b04 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a6a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a6d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	0f 8e bd fd ff ff    	jle    801836 <vprintfmt+0x40>
+  801a79:	4c 89 ee             	mov    %r13,%rsi
+  801a7c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a81:	41 ff d6             	call   *%r14
+  801a84:	41 83 ec 01          	sub    $0x1,%r12d
+  801a88:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a8c:	75 eb                	jne    801a79 <vprintfmt+0x283>
+  801a8e:	e9 a3 fd ff ff       	jmp    801836 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a9f:	eb 92                	jmp    801a33 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801aa1:	49 63 f7             	movslq %r15d,%rsi
+  801aa4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801aa8:	48 b8 ba 1f 80 00 00 	movabs $0x801fba,%rax
+  801aaf:	00 00 00 
+  801ab2:	ff d0                	call   *%rax
+  801ab4:	48 89 c2             	mov    %rax,%rdx
+  801ab7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801aba:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801abc:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801abf:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	7e 91                	jle    801a57 <vprintfmt+0x261>
+  801ac6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801acb:	4c 89 ee             	mov    %r13,%rsi
+  801ace:	44 89 e7             	mov    %r12d,%edi
+  801ad1:	41 ff d6             	call   *%r14
+  801ad4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801adb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ade:	75 eb                	jne    801acb <vprintfmt+0x2d5>
+  801ae0:	e9 72 ff ff ff       	jmp    801a57 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ae5:	0f b6 f8             	movzbl %al,%edi
+  801ae8:	4c 89 ee             	mov    %r13,%rsi
+  801aeb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801aee:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801af2:	49 83 c4 01          	add    $0x1,%r12
+  801af6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801afc:	84 c0                	test   %al,%al
+  801afe:	0f 84 66 ff ff ff    	je     801a6a <vprintfmt+0x274>
+  801b04:	45 85 ff             	test   %r15d,%r15d
+  801b07:	78 0a                	js     801b13 <vprintfmt+0x31d>
+  801b09:	41 83 ef 01          	sub    $0x1,%r15d
+  801b0d:	0f 88 57 ff ff ff    	js     801a6a <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b13:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b17:	74 cc                	je     801ae5 <vprintfmt+0x2ef>
+  801b19:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b1c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b21:	80 fa 5e             	cmp    $0x5e,%dl
+  801b24:	77 c2                	ja     801ae8 <vprintfmt+0x2f2>
+  801b26:	eb bd                	jmp    801ae5 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b28:	40 84 f6             	test   %sil,%sil
+  801b2b:	75 26                	jne    801b53 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b2d:	85 d2                	test   %edx,%edx
+  801b2f:	74 59                	je     801b8a <vprintfmt+0x394>
+  801b31:	83 fa 01             	cmp    $0x1,%edx
+  801b34:	74 7b                	je     801bb1 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b39:	83 f8 2f             	cmp    $0x2f,%eax
+  801b3c:	0f 87 96 00 00 00    	ja     801bd8 <vprintfmt+0x3e2>
+  801b42:	89 c2                	mov    %eax,%edx
+  801b44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b48:	83 c0 08             	add    $0x8,%eax
+  801b4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b4e:	4c 8b 22             	mov    (%rdx),%r12
+  801b51:	eb 17                	jmp    801b6a <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b56:	83 f8 2f             	cmp    $0x2f,%eax
+  801b59:	77 21                	ja     801b7c <vprintfmt+0x386>
+  801b5b:	89 c2                	mov    %eax,%edx
+  801b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b61:	83 c0 08             	add    $0x8,%eax
+  801b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b67:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b6a:	4d 85 e4             	test   %r12,%r12
+  801b6d:	78 7a                	js     801be9 <vprintfmt+0x3f3>
+            num = i;
+  801b6f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b72:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b77:	e9 56 02 00 00       	jmp    801dd2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b88:	eb dd                	jmp    801b67 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  801b90:	77 11                	ja     801ba3 <vprintfmt+0x3ad>
+  801b92:	89 c2                	mov    %eax,%edx
+  801b94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b98:	83 c0 08             	add    $0x8,%eax
+  801b9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b9e:	4c 63 22             	movslq (%rdx),%r12
+  801ba1:	eb c7                	jmp    801b6a <vprintfmt+0x374>
+  801ba3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801baf:	eb ed                	jmp    801b9e <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bb4:	83 f8 2f             	cmp    $0x2f,%eax
+  801bb7:	77 11                	ja     801bca <vprintfmt+0x3d4>
+  801bb9:	89 c2                	mov    %eax,%edx
+  801bbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bbf:	83 c0 08             	add    $0x8,%eax
+  801bc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bc5:	4c 8b 22             	mov    (%rdx),%r12
+  801bc8:	eb a0                	jmp    801b6a <vprintfmt+0x374>
+  801bca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd6:	eb ed                	jmp    801bc5 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bd8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bdc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801be0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be4:	e9 65 ff ff ff       	jmp    801b4e <vprintfmt+0x358>
+                putch('-', put_arg);
+  801be9:	4c 89 ee             	mov    %r13,%rsi
+  801bec:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bf1:	41 ff d6             	call   *%r14
+                i = -i;
+  801bf4:	49 f7 dc             	neg    %r12
+  801bf7:	e9 73 ff ff ff       	jmp    801b6f <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bfc:	40 84 f6             	test   %sil,%sil
+  801bff:	75 2e                	jne    801c2f <vprintfmt+0x439>
+    switch (lflag) {
+  801c01:	85 d2                	test   %edx,%edx
+  801c03:	7f 59                	jg     801c5e <vprintfmt+0x468>
+  801c05:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c08:	7d 7a                	jge    801c84 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c0d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c10:	0f 87 aa 00 00 00    	ja     801cc0 <vprintfmt+0x4ca>
+  801c16:	89 c2                	mov    %eax,%edx
+  801c18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c1c:	83 c0 08             	add    $0x8,%eax
+  801c1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c22:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c25:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c2a:	e9 a3 01 00 00       	jmp    801dd2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c32:	83 f8 2f             	cmp    $0x2f,%eax
+  801c35:	77 19                	ja     801c50 <vprintfmt+0x45a>
+  801c37:	89 c2                	mov    %eax,%edx
+  801c39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c3d:	83 c0 08             	add    $0x8,%eax
+  801c40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c43:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c4b:	e9 82 01 00 00       	jmp    801dd2 <vprintfmt+0x5dc>
+  801c50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c5c:	eb e5                	jmp    801c43 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c5e:	83 fa 01             	cmp    $0x1,%edx
+  801c61:	75 a7                	jne    801c0a <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c66:	83 f8 2f             	cmp    $0x2f,%eax
+  801c69:	77 47                	ja     801cb2 <vprintfmt+0x4bc>
+  801c6b:	89 c2                	mov    %eax,%edx
+  801c6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c71:	83 c0 08             	add    $0x8,%eax
+  801c74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c77:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c7a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c7f:	e9 4e 01 00 00       	jmp    801dd2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c87:	83 f8 2f             	cmp    $0x2f,%eax
+  801c8a:	77 18                	ja     801ca4 <vprintfmt+0x4ae>
+  801c8c:	89 c2                	mov    %eax,%edx
+  801c8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c92:	83 c0 08             	add    $0x8,%eax
+  801c95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c98:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c9a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c9f:	e9 2e 01 00 00       	jmp    801dd2 <vprintfmt+0x5dc>
+  801ca4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb0:	eb e6                	jmp    801c98 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbe:	eb b7                	jmp    801c77 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ccc:	e9 51 ff ff ff       	jmp    801c22 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cd1:	40 84 f6             	test   %sil,%sil
+  801cd4:	75 2e                	jne    801d04 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cd6:	85 d2                	test   %edx,%edx
+  801cd8:	7f 59                	jg     801d33 <vprintfmt+0x53d>
+  801cda:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cdd:	7d 77                	jge    801d56 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cdf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ce2:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce5:	0f 87 a4 00 00 00    	ja     801d8f <vprintfmt+0x599>
+  801ceb:	89 c2                	mov    %eax,%edx
+  801ced:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf1:	83 c0 08             	add    $0x8,%eax
+  801cf4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cfa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cff:	e9 ce 00 00 00       	jmp    801dd2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d07:	83 f8 2f             	cmp    $0x2f,%eax
+  801d0a:	77 19                	ja     801d25 <vprintfmt+0x52f>
+  801d0c:	89 c2                	mov    %eax,%edx
+  801d0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d12:	83 c0 08             	add    $0x8,%eax
+  801d15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d18:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d1b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d20:	e9 ad 00 00 00       	jmp    801dd2 <vprintfmt+0x5dc>
+  801d25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d31:	eb e5                	jmp    801d18 <vprintfmt+0x522>
+    switch (lflag) {
+  801d33:	83 fa 01             	cmp    $0x1,%edx
+  801d36:	75 a7                	jne    801cdf <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3e:	77 41                	ja     801d81 <vprintfmt+0x58b>
+  801d40:	89 c2                	mov    %eax,%edx
+  801d42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d46:	83 c0 08             	add    $0x8,%eax
+  801d49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d4c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d4f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d54:	eb 7c                	jmp    801dd2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d59:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5c:	77 15                	ja     801d73 <vprintfmt+0x57d>
+  801d5e:	89 c2                	mov    %eax,%edx
+  801d60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d64:	83 c0 08             	add    $0x8,%eax
+  801d67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d6a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d6c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d71:	eb 5f                	jmp    801dd2 <vprintfmt+0x5dc>
+  801d73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7f:	eb e9                	jmp    801d6a <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8d:	eb bd                	jmp    801d4c <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9b:	e9 57 ff ff ff       	jmp    801cf7 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801da0:	4c 89 ee             	mov    %r13,%rsi
+  801da3:	bf 30 00 00 00       	mov    $0x30,%edi
+  801da8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801dab:	4c 89 ee             	mov    %r13,%rsi
+  801dae:	bf 78 00 00 00       	mov    $0x78,%edi
+  801db3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801db6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db9:	83 f8 2f             	cmp    $0x2f,%eax
+  801dbc:	77 47                	ja     801e05 <vprintfmt+0x60f>
+  801dbe:	89 c2                	mov    %eax,%edx
+  801dc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc4:	83 c0 08             	add    $0x8,%eax
+  801dc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dd2:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dda:	0f 94 c0             	sete   %al
+  801ddd:	0f b6 c0             	movzbl %al,%eax
+  801de0:	50                   	push   %rax
+  801de1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801de6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801dea:	4c 89 ee             	mov    %r13,%rsi
+  801ded:	4c 89 f7             	mov    %r14,%rdi
+  801df0:	48 b8 eb 16 80 00 00 	movabs $0x8016eb,%rax
+  801df7:	00 00 00 
+  801dfa:	ff d0                	call   *%rax
+            break;
+  801dfc:	48 83 c4 10          	add    $0x10,%rsp
+  801e00:	e9 31 fa ff ff       	jmp    801836 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e11:	eb b7                	jmp    801dca <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e13:	40 84 f6             	test   %sil,%sil
+  801e16:	75 2b                	jne    801e43 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e18:	85 d2                	test   %edx,%edx
+  801e1a:	7f 56                	jg     801e72 <vprintfmt+0x67c>
+  801e1c:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e1f:	7d 77                	jge    801e98 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e24:	83 f8 2f             	cmp    $0x2f,%eax
+  801e27:	0f 87 a7 00 00 00    	ja     801ed4 <vprintfmt+0x6de>
+  801e2d:	89 c2                	mov    %eax,%edx
+  801e2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e33:	83 c0 08             	add    $0x8,%eax
+  801e36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e39:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e41:	eb 8f                	jmp    801dd2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e46:	83 f8 2f             	cmp    $0x2f,%eax
+  801e49:	77 19                	ja     801e64 <vprintfmt+0x66e>
+  801e4b:	89 c2                	mov    %eax,%edx
+  801e4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e51:	83 c0 08             	add    $0x8,%eax
+  801e54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e57:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e5a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e5f:	e9 6e ff ff ff       	jmp    801dd2 <vprintfmt+0x5dc>
+  801e64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e70:	eb e5                	jmp    801e57 <vprintfmt+0x661>
+    switch (lflag) {
+  801e72:	83 fa 01             	cmp    $0x1,%edx
+  801e75:	75 aa                	jne    801e21 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7d:	77 47                	ja     801ec6 <vprintfmt+0x6d0>
+  801e7f:	89 c2                	mov    %eax,%edx
+  801e81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e85:	83 c0 08             	add    $0x8,%eax
+  801e88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e8e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e93:	e9 3a ff ff ff       	jmp    801dd2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9e:	77 18                	ja     801eb8 <vprintfmt+0x6c2>
+  801ea0:	89 c2                	mov    %eax,%edx
+  801ea2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea6:	83 c0 08             	add    $0x8,%eax
+  801ea9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eac:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801eae:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801eb3:	e9 1a ff ff ff       	jmp    801dd2 <vprintfmt+0x5dc>
+  801eb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ebc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec4:	eb e6                	jmp    801eac <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ec6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ece:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed2:	eb b7                	jmp    801e8b <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ed4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801edc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee0:	e9 54 ff ff ff       	jmp    801e39 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ee5:	4c 89 ee             	mov    %r13,%rsi
+  801ee8:	bf 25 00 00 00       	mov    $0x25,%edi
+  801eed:	41 ff d6             	call   *%r14
+            break;
+  801ef0:	e9 41 f9 ff ff       	jmp    801836 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ef5:	4c 89 ee             	mov    %r13,%rsi
+  801ef8:	bf 25 00 00 00       	mov    $0x25,%edi
+  801efd:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f00:	48 83 eb 01          	sub    $0x1,%rbx
+  801f04:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f08:	75 f6                	jne    801f00 <vprintfmt+0x70a>
+  801f0a:	e9 27 f9 ff ff       	jmp    801836 <vprintfmt+0x40>
+
+0000000000801f0f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f0f:	55                   	push   %rbp
+  801f10:	48 89 e5             	mov    %rsp,%rbp
+  801f13:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f1b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f20:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f24:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f2b:	48 85 ff             	test   %rdi,%rdi
+  801f2e:	74 2b                	je     801f5b <vsnprintf+0x4c>
+  801f30:	48 85 f6             	test   %rsi,%rsi
+  801f33:	74 26                	je     801f5b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f35:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f39:	48 bf a1 17 80 00 00 	movabs $0x8017a1,%rdi
+  801f40:	00 00 00 
+  801f43:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  801f4a:	00 00 00 
+  801f4d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f53:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f56:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f59:	c9                   	leave
+  801f5a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f60:	eb f7                	jmp    801f59 <vsnprintf+0x4a>
+
+0000000000801f62 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f62:	55                   	push   %rbp
+  801f63:	48 89 e5             	mov    %rsp,%rbp
+  801f66:	48 83 ec 50          	sub    $0x50,%rsp
+  801f6a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f6e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f72:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f76:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f7d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f85:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f89:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f8d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f91:	48 b8 0f 1f 80 00 00 	movabs $0x801f0f,%rax
+  801f98:	00 00 00 
+  801f9b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+
+0000000000801f9f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f9f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fa2:	74 10                	je     801fb4 <strlen+0x15>
+    size_t n = 0;
+  801fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fa9:	48 83 c0 01          	add    $0x1,%rax
+  801fad:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fb1:	75 f6                	jne    801fa9 <strlen+0xa>
+  801fb3:	c3                   	ret
+    size_t n = 0;
+  801fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fb9:	c3                   	ret
+
+0000000000801fba <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fba:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fbd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fc2:	48 85 f6             	test   %rsi,%rsi
+  801fc5:	74 11                	je     801fd8 <strnlen+0x1e>
+  801fc7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fcb:	74 0c                	je     801fd9 <strnlen+0x1f>
+  801fcd:	48 83 c2 01          	add    $0x1,%rdx
+  801fd1:	48 39 d0             	cmp    %rdx,%rax
+  801fd4:	75 f1                	jne    801fc7 <strnlen+0xd>
+  801fd6:	eb 04                	jmp    801fdc <strnlen+0x22>
+  801fd8:	c3                   	ret
+  801fd9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fdc:	c3                   	ret
+
+0000000000801fdd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fdd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fe9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fec:	48 83 c2 01          	add    $0x1,%rdx
+  801ff0:	84 c9                	test   %cl,%cl
+  801ff2:	75 f1                	jne    801fe5 <strcpy+0x8>
+        ;
+    return res;
+}
+  801ff4:	c3                   	ret
+
+0000000000801ff5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801ff5:	55                   	push   %rbp
+  801ff6:	48 89 e5             	mov    %rsp,%rbp
+  801ff9:	41 54                	push   %r12
+  801ffb:	53                   	push   %rbx
+  801ffc:	48 89 fb             	mov    %rdi,%rbx
+  801fff:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802002:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  802009:	00 00 00 
+  80200c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80200e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802012:	4c 89 e6             	mov    %r12,%rsi
+  802015:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  80201c:	00 00 00 
+  80201f:	ff d0                	call   *%rax
+    return dst;
+}
+  802021:	48 89 d8             	mov    %rbx,%rax
+  802024:	5b                   	pop    %rbx
+  802025:	41 5c                	pop    %r12
+  802027:	5d                   	pop    %rbp
+  802028:	c3                   	ret
+
+0000000000802029 <toupper>:
+
+int
+toupper(int ch) {
+  802029:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80202b:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80202e:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802031:	83 f9 1a             	cmp    $0x1a,%ecx
+  802034:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802037:	c3                   	ret
+
+0000000000802038 <tolower>:
+
+int
+tolower(int ch) {
+  802038:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80203a:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80203d:	8d 57 20             	lea    0x20(%rdi),%edx
+  802040:	83 f9 1a             	cmp    $0x1a,%ecx
+  802043:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802046:	c3                   	ret
+
+0000000000802047 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802047:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80204a:	48 85 d2             	test   %rdx,%rdx
+  80204d:	74 1f                	je     80206e <strncpy+0x27>
+  80204f:	48 01 fa             	add    %rdi,%rdx
+  802052:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802055:	48 83 c1 01          	add    $0x1,%rcx
+  802059:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80205d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802061:	41 80 f8 01          	cmp    $0x1,%r8b
+  802065:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802069:	48 39 ca             	cmp    %rcx,%rdx
+  80206c:	75 e7                	jne    802055 <strncpy+0xe>
+    }
+    return ret;
+}
+  80206e:	c3                   	ret
+
+000000000080206f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80206f:	48 89 f8             	mov    %rdi,%rax
+  802072:	48 85 d2             	test   %rdx,%rdx
+  802075:	74 24                	je     80209b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802077:	48 83 ea 01          	sub    $0x1,%rdx
+  80207b:	74 1b                	je     802098 <strlcpy+0x29>
+  80207d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802081:	0f b6 16             	movzbl (%rsi),%edx
+  802084:	84 d2                	test   %dl,%dl
+  802086:	74 10                	je     802098 <strlcpy+0x29>
+            *dst++ = *src++;
+  802088:	48 83 c6 01          	add    $0x1,%rsi
+  80208c:	48 83 c0 01          	add    $0x1,%rax
+  802090:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802093:	48 39 c8             	cmp    %rcx,%rax
+  802096:	75 e9                	jne    802081 <strlcpy+0x12>
+        *dst = '\0';
+  802098:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80209b:	48 29 f8             	sub    %rdi,%rax
+}
+  80209e:	c3                   	ret
+
+000000000080209f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80209f:	0f b6 07             	movzbl (%rdi),%eax
+  8020a2:	84 c0                	test   %al,%al
+  8020a4:	74 13                	je     8020b9 <strcmp+0x1a>
+  8020a6:	38 06                	cmp    %al,(%rsi)
+  8020a8:	75 0f                	jne    8020b9 <strcmp+0x1a>
+  8020aa:	48 83 c7 01          	add    $0x1,%rdi
+  8020ae:	48 83 c6 01          	add    $0x1,%rsi
+  8020b2:	0f b6 07             	movzbl (%rdi),%eax
+  8020b5:	84 c0                	test   %al,%al
+  8020b7:	75 ed                	jne    8020a6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020b9:	0f b6 c0             	movzbl %al,%eax
+  8020bc:	0f b6 16             	movzbl (%rsi),%edx
+  8020bf:	29 d0                	sub    %edx,%eax
+}
+  8020c1:	c3                   	ret
+
+00000000008020c2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020c2:	48 85 d2             	test   %rdx,%rdx
+  8020c5:	74 1f                	je     8020e6 <strncmp+0x24>
+  8020c7:	0f b6 07             	movzbl (%rdi),%eax
+  8020ca:	84 c0                	test   %al,%al
+  8020cc:	74 1e                	je     8020ec <strncmp+0x2a>
+  8020ce:	3a 06                	cmp    (%rsi),%al
+  8020d0:	75 1a                	jne    8020ec <strncmp+0x2a>
+  8020d2:	48 83 c7 01          	add    $0x1,%rdi
+  8020d6:	48 83 c6 01          	add    $0x1,%rsi
+  8020da:	48 83 ea 01          	sub    $0x1,%rdx
+  8020de:	75 e7                	jne    8020c7 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e5:	c3                   	ret
+  8020e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020eb:	c3                   	ret
+  8020ec:	48 85 d2             	test   %rdx,%rdx
+  8020ef:	74 09                	je     8020fa <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020f1:	0f b6 07             	movzbl (%rdi),%eax
+  8020f4:	0f b6 16             	movzbl (%rsi),%edx
+  8020f7:	29 d0                	sub    %edx,%eax
+  8020f9:	c3                   	ret
+    if (!n) return 0;
+  8020fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ff:	c3                   	ret
+
+0000000000802100 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802100:	0f b6 17             	movzbl (%rdi),%edx
+  802103:	84 d2                	test   %dl,%dl
+  802105:	74 18                	je     80211f <strchr+0x1f>
+        if (*str == c) {
+  802107:	0f be d2             	movsbl %dl,%edx
+  80210a:	39 f2                	cmp    %esi,%edx
+  80210c:	74 17                	je     802125 <strchr+0x25>
+    for (; *str; str++) {
+  80210e:	48 83 c7 01          	add    $0x1,%rdi
+  802112:	0f b6 17             	movzbl (%rdi),%edx
+  802115:	84 d2                	test   %dl,%dl
+  802117:	75 ee                	jne    802107 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211e:	c3                   	ret
+  80211f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802124:	c3                   	ret
+  802125:	48 89 f8             	mov    %rdi,%rax
+}
+  802128:	c3                   	ret
+
+0000000000802129 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802129:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80212c:	0f b6 17             	movzbl (%rdi),%edx
+  80212f:	84 d2                	test   %dl,%dl
+  802131:	74 13                	je     802146 <strfind+0x1d>
+  802133:	0f be d2             	movsbl %dl,%edx
+  802136:	39 f2                	cmp    %esi,%edx
+  802138:	74 0b                	je     802145 <strfind+0x1c>
+  80213a:	48 83 c0 01          	add    $0x1,%rax
+  80213e:	0f b6 10             	movzbl (%rax),%edx
+  802141:	84 d2                	test   %dl,%dl
+  802143:	75 ee                	jne    802133 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802145:	c3                   	ret
+  802146:	c3                   	ret
+
+0000000000802147 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802147:	48 39 f7             	cmp    %rsi,%rdi
+  80214a:	74 65                	je     8021b1 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80214c:	55                   	push   %rbp
+  80214d:	48 89 e5             	mov    %rsp,%rbp
+  802150:	41 57                	push   %r15
+  802152:	41 56                	push   %r14
+  802154:	41 55                	push   %r13
+  802156:	41 54                	push   %r12
+  802158:	53                   	push   %rbx
+  802159:	48 83 ec 18          	sub    $0x18,%rsp
+  80215d:	48 89 fb             	mov    %rdi,%rbx
+  802160:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802163:	49 bf 38 20 80 00 00 	movabs $0x802038,%r15
+  80216a:	00 00 00 
+  80216d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802171:	41 0f b6 fd          	movzbl %r13b,%edi
+  802175:	41 ff d7             	call   *%r15
+  802178:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80217b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802180:	41 0f b6 fe          	movzbl %r14b,%edi
+  802184:	41 ff d7             	call   *%r15
+  802187:	89 c2                	mov    %eax,%edx
+  802189:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80218c:	29 d0                	sub    %edx,%eax
+  80218e:	75 12                	jne    8021a2 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802190:	48 83 c3 01          	add    $0x1,%rbx
+  802194:	45 84 ed             	test   %r13b,%r13b
+  802197:	74 09                	je     8021a2 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802199:	49 83 c4 01          	add    $0x1,%r12
+  80219d:	45 84 f6             	test   %r14b,%r14b
+  8021a0:	75 cb                	jne    80216d <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021a2:	48 83 c4 18          	add    $0x18,%rsp
+  8021a6:	5b                   	pop    %rbx
+  8021a7:	41 5c                	pop    %r12
+  8021a9:	41 5d                	pop    %r13
+  8021ab:	41 5e                	pop    %r14
+  8021ad:	41 5f                	pop    %r15
+  8021af:	5d                   	pop    %rbp
+  8021b0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b6:	c3                   	ret
+
+00000000008021b7 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021b7:	48 39 f7             	cmp    %rsi,%rdi
+  8021ba:	74 7d                	je     802239 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021bc:	55                   	push   %rbp
+  8021bd:	48 89 e5             	mov    %rsp,%rbp
+  8021c0:	41 57                	push   %r15
+  8021c2:	41 56                	push   %r14
+  8021c4:	41 55                	push   %r13
+  8021c6:	41 54                	push   %r12
+  8021c8:	53                   	push   %rbx
+  8021c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021cd:	48 89 fb             	mov    %rdi,%rbx
+  8021d0:	49 89 f4             	mov    %rsi,%r12
+  8021d3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021db:	49 bf 38 20 80 00 00 	movabs $0x802038,%r15
+  8021e2:	00 00 00 
+    while (n--) {
+  8021e5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e9:	48 39 c3             	cmp    %rax,%rbx
+  8021ec:	74 37                	je     802225 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021ee:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021f2:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021f6:	41 ff d7             	call   *%r15
+  8021f9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021fc:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802201:	41 0f b6 fe          	movzbl %r14b,%edi
+  802205:	41 ff d7             	call   *%r15
+  802208:	89 c2                	mov    %eax,%edx
+  80220a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80220d:	29 d0                	sub    %edx,%eax
+  80220f:	75 19                	jne    80222a <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802211:	48 83 c3 01          	add    $0x1,%rbx
+  802215:	45 84 ed             	test   %r13b,%r13b
+  802218:	74 10                	je     80222a <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80221a:	49 83 c4 01          	add    $0x1,%r12
+  80221e:	45 84 f6             	test   %r14b,%r14b
+  802221:	75 c2                	jne    8021e5 <strncasecmp+0x2e>
+  802223:	eb 05                	jmp    80222a <strncasecmp+0x73>
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80222a:	48 83 c4 18          	add    $0x18,%rsp
+  80222e:	5b                   	pop    %rbx
+  80222f:	41 5c                	pop    %r12
+  802231:	41 5d                	pop    %r13
+  802233:	41 5e                	pop    %r14
+  802235:	41 5f                	pop    %r15
+  802237:	5d                   	pop    %rbp
+  802238:	c3                   	ret
+    if (p1 == p2) return 0;
+  802239:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223e:	c3                   	ret
+
+000000000080223f <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80223f:	83 e7 df             	and    $0xffffffdf,%edi
+  802242:	83 ef 41             	sub    $0x41,%edi
+  802245:	83 ff 19             	cmp    $0x19,%edi
+  802248:	0f 96 c0             	setbe  %al
+}
+  80224b:	c3                   	ret
+
+000000000080224c <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80224c:	83 ff 20             	cmp    $0x20,%edi
+  80224f:	0f 94 c0             	sete   %al
+  802252:	83 ff 09             	cmp    $0x9,%edi
+  802255:	0f 94 c2             	sete   %dl
+  802258:	09 d0                	or     %edx,%eax
+}
+  80225a:	c3                   	ret
+
+000000000080225b <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+  80225f:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802261:	48 bf 3f 61 80 00 00 	movabs $0x80613f,%rdi
+  802268:	00 00 00 
+  80226b:	48 b8 00 21 80 00 00 	movabs $0x802100,%rax
+  802272:	00 00 00 
+  802275:	ff d0                	call   *%rax
+  802277:	48 85 c0             	test   %rax,%rax
+  80227a:	0f 95 c0             	setne  %al
+}
+  80227d:	5d                   	pop    %rbp
+  80227e:	c3                   	ret
+
+000000000080227f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80227f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802282:	48 89 f8             	mov    %rdi,%rax
+  802285:	48 f7 d8             	neg    %rax
+  802288:	83 e0 07             	and    $0x7,%eax
+  80228b:	49 89 d1             	mov    %rdx,%r9
+  80228e:	49 29 c1             	sub    %rax,%r9
+  802291:	78 36                	js     8022c9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802293:	40 0f b6 c6          	movzbl %sil,%eax
+  802297:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80229e:	01 01 01 
+  8022a1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022a5:	40 f6 c7 07          	test   $0x7,%dil
+  8022a9:	75 38                	jne    8022e3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022ab:	4c 89 c9             	mov    %r9,%rcx
+  8022ae:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022b2:	74 0c                	je     8022c0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022b4:	fc                   	cld
+  8022b5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022b8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022bc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022c0:	4d 85 c9             	test   %r9,%r9
+  8022c3:	75 45                	jne    80230a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022c5:	4c 89 c0             	mov    %r8,%rax
+  8022c8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022c9:	48 85 d2             	test   %rdx,%rdx
+  8022cc:	74 f7                	je     8022c5 <memset+0x46>
+  8022ce:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022d1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022d4:	48 83 c0 01          	add    $0x1,%rax
+  8022d8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022dc:	48 39 c2             	cmp    %rax,%rdx
+  8022df:	75 f3                	jne    8022d4 <memset+0x55>
+  8022e1:	eb e2                	jmp    8022c5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022e3:	40 f6 c7 01          	test   $0x1,%dil
+  8022e7:	74 06                	je     8022ef <memset+0x70>
+  8022e9:	88 07                	mov    %al,(%rdi)
+  8022eb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022ef:	40 f6 c7 02          	test   $0x2,%dil
+  8022f3:	74 07                	je     8022fc <memset+0x7d>
+  8022f5:	66 89 07             	mov    %ax,(%rdi)
+  8022f8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022fc:	40 f6 c7 04          	test   $0x4,%dil
+  802300:	74 a9                	je     8022ab <memset+0x2c>
+  802302:	89 07                	mov    %eax,(%rdi)
+  802304:	48 83 c7 04          	add    $0x4,%rdi
+  802308:	eb a1                	jmp    8022ab <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80230a:	41 f6 c1 04          	test   $0x4,%r9b
+  80230e:	74 06                	je     802316 <memset+0x97>
+  802310:	89 07                	mov    %eax,(%rdi)
+  802312:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802316:	41 f6 c1 02          	test   $0x2,%r9b
+  80231a:	74 07                	je     802323 <memset+0xa4>
+  80231c:	66 89 07             	mov    %ax,(%rdi)
+  80231f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802323:	41 f6 c1 01          	test   $0x1,%r9b
+  802327:	74 9c                	je     8022c5 <memset+0x46>
+  802329:	88 07                	mov    %al,(%rdi)
+  80232b:	eb 98                	jmp    8022c5 <memset+0x46>
+
+000000000080232d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80232d:	48 89 f8             	mov    %rdi,%rax
+  802330:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802333:	48 39 fe             	cmp    %rdi,%rsi
+  802336:	73 3b                	jae    802373 <memmove+0x46>
+  802338:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80233c:	48 39 d7             	cmp    %rdx,%rdi
+  80233f:	73 32                	jae    802373 <memmove+0x46>
+        s += n;
+        d += n;
+  802341:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802345:	48 89 d6             	mov    %rdx,%rsi
+  802348:	48 09 fe             	or     %rdi,%rsi
+  80234b:	48 09 ce             	or     %rcx,%rsi
+  80234e:	40 f6 c6 07          	test   $0x7,%sil
+  802352:	75 12                	jne    802366 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802354:	48 83 ef 08          	sub    $0x8,%rdi
+  802358:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80235c:	48 c1 e9 03          	shr    $0x3,%rcx
+  802360:	fd                   	std
+  802361:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802364:	fc                   	cld
+  802365:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802366:	48 83 ef 01          	sub    $0x1,%rdi
+  80236a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80236e:	fd                   	std
+  80236f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802371:	eb f1                	jmp    802364 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802373:	48 89 f2             	mov    %rsi,%rdx
+  802376:	48 09 c2             	or     %rax,%rdx
+  802379:	48 09 ca             	or     %rcx,%rdx
+  80237c:	f6 c2 07             	test   $0x7,%dl
+  80237f:	75 0c                	jne    80238d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802381:	48 c1 e9 03          	shr    $0x3,%rcx
+  802385:	48 89 c7             	mov    %rax,%rdi
+  802388:	fc                   	cld
+  802389:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80238c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80238d:	48 89 c7             	mov    %rax,%rdi
+  802390:	fc                   	cld
+  802391:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802393:	c3                   	ret
+
+0000000000802394 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802398:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+}
+  8023a4:	5d                   	pop    %rbp
+  8023a5:	c3                   	ret
+
+00000000008023a6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023a6:	55                   	push   %rbp
+  8023a7:	48 89 e5             	mov    %rsp,%rbp
+  8023aa:	41 57                	push   %r15
+  8023ac:	41 56                	push   %r14
+  8023ae:	41 55                	push   %r13
+  8023b0:	41 54                	push   %r12
+  8023b2:	53                   	push   %rbx
+  8023b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b7:	49 89 fe             	mov    %rdi,%r14
+  8023ba:	49 89 f7             	mov    %rsi,%r15
+  8023bd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023c0:	48 89 f7             	mov    %rsi,%rdi
+  8023c3:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+  8023cf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023d2:	48 89 de             	mov    %rbx,%rsi
+  8023d5:	4c 89 f7             	mov    %r14,%rdi
+  8023d8:	48 b8 ba 1f 80 00 00 	movabs $0x801fba,%rax
+  8023df:	00 00 00 
+  8023e2:	ff d0                	call   *%rax
+  8023e4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023e7:	48 39 c3             	cmp    %rax,%rbx
+  8023ea:	74 36                	je     802422 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023ec:	48 89 d8             	mov    %rbx,%rax
+  8023ef:	4c 29 e8             	sub    %r13,%rax
+  8023f2:	49 39 c4             	cmp    %rax,%r12
+  8023f5:	73 31                	jae    802428 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023f7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023fc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802400:	4c 89 fe             	mov    %r15,%rsi
+  802403:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80240f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802413:	48 83 c4 08          	add    $0x8,%rsp
+  802417:	5b                   	pop    %rbx
+  802418:	41 5c                	pop    %r12
+  80241a:	41 5d                	pop    %r13
+  80241c:	41 5e                	pop    %r14
+  80241e:	41 5f                	pop    %r15
+  802420:	5d                   	pop    %rbp
+  802421:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802422:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802426:	eb eb                	jmp    802413 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802428:	48 83 eb 01          	sub    $0x1,%rbx
+  80242c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802430:	48 89 da             	mov    %rbx,%rdx
+  802433:	4c 89 fe             	mov    %r15,%rsi
+  802436:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802442:	49 01 de             	add    %rbx,%r14
+  802445:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80244a:	eb c3                	jmp    80240f <strlcat+0x69>
+
+000000000080244c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80244c:	48 85 d2             	test   %rdx,%rdx
+  80244f:	74 2d                	je     80247e <memcmp+0x32>
+  802451:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802456:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80245a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80245f:	44 38 c1             	cmp    %r8b,%cl
+  802462:	75 0f                	jne    802473 <memcmp+0x27>
+    while (n-- > 0) {
+  802464:	48 83 c0 01          	add    $0x1,%rax
+  802468:	48 39 c2             	cmp    %rax,%rdx
+  80246b:	75 e9                	jne    802456 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80246d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802472:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802473:	0f b6 c1             	movzbl %cl,%eax
+  802476:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80247a:	44 29 c0             	sub    %r8d,%eax
+  80247d:	c3                   	ret
+    return 0;
+  80247e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802483:	c3                   	ret
+
+0000000000802484 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802484:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802488:	48 39 c7             	cmp    %rax,%rdi
+  80248b:	73 0f                	jae    80249c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80248d:	40 38 37             	cmp    %sil,(%rdi)
+  802490:	74 0e                	je     8024a0 <memfind+0x1c>
+    for (; src < end; src++) {
+  802492:	48 83 c7 01          	add    $0x1,%rdi
+  802496:	48 39 f8             	cmp    %rdi,%rax
+  802499:	75 f2                	jne    80248d <memfind+0x9>
+  80249b:	c3                   	ret
+  80249c:	48 89 f8             	mov    %rdi,%rax
+  80249f:	c3                   	ret
+  8024a0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024a3:	c3                   	ret
+
+00000000008024a4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024a4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024a7:	0f b6 37             	movzbl (%rdi),%esi
+  8024aa:	40 80 fe 20          	cmp    $0x20,%sil
+  8024ae:	74 06                	je     8024b6 <strtol+0x12>
+  8024b0:	40 80 fe 09          	cmp    $0x9,%sil
+  8024b4:	75 13                	jne    8024c9 <strtol+0x25>
+  8024b6:	48 83 c7 01          	add    $0x1,%rdi
+  8024ba:	0f b6 37             	movzbl (%rdi),%esi
+  8024bd:	40 80 fe 20          	cmp    $0x20,%sil
+  8024c1:	74 f3                	je     8024b6 <strtol+0x12>
+  8024c3:	40 80 fe 09          	cmp    $0x9,%sil
+  8024c7:	74 ed                	je     8024b6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024c9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024cc:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024cf:	3c 01                	cmp    $0x1,%al
+  8024d1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024d5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024db:	75 0f                	jne    8024ec <strtol+0x48>
+  8024dd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024e0:	74 14                	je     8024f6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024e2:	85 d2                	test   %edx,%edx
+  8024e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024e9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024ec:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024f1:	4c 63 ca             	movslq %edx,%r9
+  8024f4:	eb 36                	jmp    80252c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024f6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024fa:	74 0f                	je     80250b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024fc:	85 d2                	test   %edx,%edx
+  8024fe:	75 ec                	jne    8024ec <strtol+0x48>
+        s++;
+  802500:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802504:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802509:	eb e1                	jmp    8024ec <strtol+0x48>
+        s += 2;
+  80250b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80250f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802514:	eb d6                	jmp    8024ec <strtol+0x48>
+            dig -= '0';
+  802516:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802519:	44 0f b6 c1          	movzbl %cl,%r8d
+  80251d:	41 39 d0             	cmp    %edx,%r8d
+  802520:	7d 21                	jge    802543 <strtol+0x9f>
+        val = val * base + dig;
+  802522:	49 0f af c1          	imul   %r9,%rax
+  802526:	0f b6 c9             	movzbl %cl,%ecx
+  802529:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80252c:	48 83 c7 01          	add    $0x1,%rdi
+  802530:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802534:	80 f9 39             	cmp    $0x39,%cl
+  802537:	76 dd                	jbe    802516 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802539:	80 f9 7b             	cmp    $0x7b,%cl
+  80253c:	77 05                	ja     802543 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80253e:	83 e9 57             	sub    $0x57,%ecx
+  802541:	eb d6                	jmp    802519 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802543:	4d 85 d2             	test   %r10,%r10
+  802546:	74 03                	je     80254b <strtol+0xa7>
+  802548:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80254b:	48 89 c2             	mov    %rax,%rdx
+  80254e:	48 f7 da             	neg    %rdx
+  802551:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802555:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802559:	c3                   	ret
+
+000000000080255a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80255a:	55                   	push   %rbp
+  80255b:	48 89 e5             	mov    %rsp,%rbp
+  80255e:	53                   	push   %rbx
+  80255f:	48 89 fa             	mov    %rdi,%rdx
+  802562:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802565:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80256a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80256f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802574:	be 00 00 00 00       	mov    $0x0,%esi
+  802579:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80257f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802585:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802587:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80258b:	c9                   	leave
+  80258c:	c3                   	ret
+
+000000000080258d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80258d:	55                   	push   %rbp
+  80258e:	48 89 e5             	mov    %rsp,%rbp
+  802591:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802592:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802597:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025bc:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025c2:	c9                   	leave
+  8025c3:	c3                   	ret
+
+00000000008025c4 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025c4:	55                   	push   %rbp
+  8025c5:	48 89 e5             	mov    %rsp,%rbp
+  8025c8:	53                   	push   %rbx
+  8025c9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025cc:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025f1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+
+00000000008025f9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025f9:	55                   	push   %rbp
+  8025fa:	48 89 e5             	mov    %rsp,%rbp
+  8025fd:	53                   	push   %rbx
+  8025fe:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802602:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802605:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80260a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80260f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802614:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802619:	be 00 00 00 00       	mov    $0x0,%esi
+  80261e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802624:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80262a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80262c:	48 85 c0             	test   %rax,%rax
+  80262f:	7f 06                	jg     802637 <sys_env_destroy+0x3e>
+}
+  802631:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802637:	49 89 c0             	mov    %rax,%r8
+  80263a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80263f:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802646:	00 00 00 
+  802649:	be 27 00 00 00       	mov    $0x27,%esi
+  80264e:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802655:	00 00 00 
+  802658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265d:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802664:	00 00 00 
+  802667:	41 ff d1             	call   *%r9
+
+000000000080266a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+  80266e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80266f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802674:	ba 00 00 00 00       	mov    $0x0,%edx
+  802679:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80267e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802683:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802688:	be 00 00 00 00       	mov    $0x0,%esi
+  80268d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802693:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802699:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80269b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80269f:	c9                   	leave
+  8026a0:	c3                   	ret
+
+00000000008026a1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8026a1:	55                   	push   %rbp
+  8026a2:	48 89 e5             	mov    %rsp,%rbp
+  8026a5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026a6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026d0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d6:	c9                   	leave
+  8026d7:	c3                   	ret
+
+00000000008026d8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026d8:	55                   	push   %rbp
+  8026d9:	48 89 e5             	mov    %rsp,%rbp
+  8026dc:	53                   	push   %rbx
+  8026dd:	48 89 fa             	mov    %rdi,%rdx
+  8026e0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026e3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e8:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026ef:	00 00 00 
+  8026f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802702:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802708:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80270a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80270e:	c9                   	leave
+  80270f:	c3                   	ret
+
+0000000000802710 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802710:	55                   	push   %rbp
+  802711:	48 89 e5             	mov    %rsp,%rbp
+  802714:	53                   	push   %rbx
+  802715:	49 89 f8             	mov    %rdi,%r8
+  802718:	48 89 d3             	mov    %rdx,%rbx
+  80271b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80271e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802723:	4c 89 c2             	mov    %r8,%rdx
+  802726:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802729:	be 00 00 00 00       	mov    $0x0,%esi
+  80272e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802734:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80273a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80273c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802740:	c9                   	leave
+  802741:	c3                   	ret
+
+0000000000802742 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802742:	55                   	push   %rbp
+  802743:	48 89 e5             	mov    %rsp,%rbp
+  802746:	53                   	push   %rbx
+  802747:	48 83 ec 08          	sub    $0x8,%rsp
+  80274b:	89 f8                	mov    %edi,%eax
+  80274d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802750:	48 63 f9             	movslq %ecx,%rdi
+  802753:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802756:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80275b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80275e:	be 00 00 00 00       	mov    $0x0,%esi
+  802763:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802769:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80276f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802771:	48 85 c0             	test   %rax,%rax
+  802774:	7f 06                	jg     80277c <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802776:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80277a:	c9                   	leave
+  80277b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80277c:	49 89 c0             	mov    %rax,%r8
+  80277f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802784:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80278b:	00 00 00 
+  80278e:	be 27 00 00 00       	mov    $0x27,%esi
+  802793:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80279a:	00 00 00 
+  80279d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a2:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  8027a9:	00 00 00 
+  8027ac:	41 ff d1             	call   *%r9
+
+00000000008027af <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027af:	55                   	push   %rbp
+  8027b0:	48 89 e5             	mov    %rsp,%rbp
+  8027b3:	53                   	push   %rbx
+  8027b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b8:	89 f8                	mov    %edi,%eax
+  8027ba:	49 89 f2             	mov    %rsi,%r10
+  8027bd:	48 89 cf             	mov    %rcx,%rdi
+  8027c0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027c3:	48 63 da             	movslq %edx,%rbx
+  8027c6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ce:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027d1:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027dc:	48 85 c0             	test   %rax,%rax
+  8027df:	7f 06                	jg     8027e7 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027e5:	c9                   	leave
+  8027e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027e7:	49 89 c0             	mov    %rax,%r8
+  8027ea:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027ef:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8027f6:	00 00 00 
+  8027f9:	be 27 00 00 00       	mov    $0x27,%esi
+  8027fe:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802805:	00 00 00 
+  802808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280d:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802814:	00 00 00 
+  802817:	41 ff d1             	call   *%r9
+
+000000000080281a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80281a:	55                   	push   %rbp
+  80281b:	48 89 e5             	mov    %rsp,%rbp
+  80281e:	53                   	push   %rbx
+  80281f:	48 83 ec 08          	sub    $0x8,%rsp
+  802823:	48 89 f1             	mov    %rsi,%rcx
+  802826:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802829:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80282c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802831:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802836:	be 00 00 00 00       	mov    $0x0,%esi
+  80283b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802841:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802847:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802849:	48 85 c0             	test   %rax,%rax
+  80284c:	7f 06                	jg     802854 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80284e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802852:	c9                   	leave
+  802853:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802854:	49 89 c0             	mov    %rax,%r8
+  802857:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80285c:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802863:	00 00 00 
+  802866:	be 27 00 00 00       	mov    $0x27,%esi
+  80286b:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802872:	00 00 00 
+  802875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287a:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802881:	00 00 00 
+  802884:	41 ff d1             	call   *%r9
+
+0000000000802887 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	53                   	push   %rbx
+  80288c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802890:	48 63 ce             	movslq %esi,%rcx
+  802893:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802896:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80289b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028b8:	48 85 c0             	test   %rax,%rax
+  8028bb:	7f 06                	jg     8028c3 <sys_env_set_status+0x3c>
+}
+  8028bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c1:	c9                   	leave
+  8028c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028c3:	49 89 c0             	mov    %rax,%r8
+  8028c6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028cb:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8028d2:	00 00 00 
+  8028d5:	be 27 00 00 00       	mov    $0x27,%esi
+  8028da:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8028e1:	00 00 00 
+  8028e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e9:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  8028f0:	00 00 00 
+  8028f3:	41 ff d1             	call   *%r9
+
+00000000008028f6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028f6:	55                   	push   %rbp
+  8028f7:	48 89 e5             	mov    %rsp,%rbp
+  8028fa:	53                   	push   %rbx
+  8028fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ff:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802902:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802905:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80290a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802914:	be 00 00 00 00       	mov    $0x0,%esi
+  802919:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80291f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802925:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802927:	48 85 c0             	test   %rax,%rax
+  80292a:	7f 06                	jg     802932 <sys_env_set_trapframe+0x3c>
+}
+  80292c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802930:	c9                   	leave
+  802931:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802932:	49 89 c0             	mov    %rax,%r8
+  802935:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80293a:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802941:	00 00 00 
+  802944:	be 27 00 00 00       	mov    $0x27,%esi
+  802949:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802950:	00 00 00 
+  802953:	b8 00 00 00 00       	mov    $0x0,%eax
+  802958:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  80295f:	00 00 00 
+  802962:	41 ff d1             	call   *%r9
+
+0000000000802965 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802965:	55                   	push   %rbp
+  802966:	48 89 e5             	mov    %rsp,%rbp
+  802969:	53                   	push   %rbx
+  80296a:	48 83 ec 08          	sub    $0x8,%rsp
+  80296e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802971:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802974:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802979:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80297e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802983:	be 00 00 00 00       	mov    $0x0,%esi
+  802988:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80298e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802994:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802996:	48 85 c0             	test   %rax,%rax
+  802999:	7f 06                	jg     8029a1 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80299b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80299f:	c9                   	leave
+  8029a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029a1:	49 89 c0             	mov    %rax,%r8
+  8029a4:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029a9:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8029b0:	00 00 00 
+  8029b3:	be 27 00 00 00       	mov    $0x27,%esi
+  8029b8:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8029bf:	00 00 00 
+  8029c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c7:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  8029ce:	00 00 00 
+  8029d1:	41 ff d1             	call   *%r9
+
+00000000008029d4 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029d4:	55                   	push   %rbp
+  8029d5:	48 89 e5             	mov    %rsp,%rbp
+  8029d8:	53                   	push   %rbx
+  8029d9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029dd:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029e4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a04:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a06:	48 85 c0             	test   %rax,%rax
+  802a09:	7f 06                	jg     802a11 <sys_env_set_reclaim+0x3d>
+}
+  802a0b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a0f:	c9                   	leave
+  802a10:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a11:	49 89 c0             	mov    %rax,%r8
+  802a14:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a19:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a20:	00 00 00 
+  802a23:	be 27 00 00 00       	mov    $0x27,%esi
+  802a28:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a2f:	00 00 00 
+  802a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a37:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802a3e:	00 00 00 
+  802a41:	41 ff d1             	call   *%r9
+
+0000000000802a44 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a44:	55                   	push   %rbp
+  802a45:	48 89 e5             	mov    %rsp,%rbp
+  802a48:	53                   	push   %rbx
+  802a49:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a4d:	48 63 ce             	movslq %esi,%rcx
+  802a50:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a53:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a62:	be 00 00 00 00       	mov    $0x0,%esi
+  802a67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a6d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a73:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a75:	48 85 c0             	test   %rax,%rax
+  802a78:	7f 06                	jg     802a80 <sys_env_set_nice+0x3c>
+}
+  802a7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a7e:	c9                   	leave
+  802a7f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a80:	49 89 c0             	mov    %rax,%r8
+  802a83:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a88:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a8f:	00 00 00 
+  802a92:	be 27 00 00 00       	mov    $0x27,%esi
+  802a97:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a9e:	00 00 00 
+  802aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa6:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802aad:	00 00 00 
+  802ab0:	41 ff d1             	call   *%r9
+
+0000000000802ab3 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ab3:	55                   	push   %rbp
+  802ab4:	48 89 e5             	mov    %rsp,%rbp
+  802ab7:	53                   	push   %rbx
+  802ab8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802abb:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ac5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802acf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ada:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ae0:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ae2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ae6:	c9                   	leave
+  802ae7:	c3                   	ret
+
+0000000000802ae8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ae8:	55                   	push   %rbp
+  802ae9:	48 89 e5             	mov    %rsp,%rbp
+  802aec:	53                   	push   %rbx
+  802aed:	89 f8                	mov    %edi,%eax
+  802aef:	49 89 f1             	mov    %rsi,%r9
+  802af2:	48 89 d3             	mov    %rdx,%rbx
+  802af5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802af8:	49 63 f0             	movslq %r8d,%rsi
+  802afb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802afe:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b03:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b06:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b0c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b12:	cd 30                	int    $0x30
+}
+  802b14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b18:	c9                   	leave
+  802b19:	c3                   	ret
+
+0000000000802b1a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b1a:	55                   	push   %rbp
+  802b1b:	48 89 e5             	mov    %rsp,%rbp
+  802b1e:	53                   	push   %rbx
+  802b1f:	89 f8                	mov    %edi,%eax
+  802b21:	49 89 f1             	mov    %rsi,%r9
+  802b24:	48 89 d3             	mov    %rdx,%rbx
+  802b27:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b2a:	49 63 f0             	movslq %r8d,%rsi
+  802b2d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b30:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b35:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b44:	cd 30                	int    $0x30
+}
+  802b46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4a:	c9                   	leave
+  802b4b:	c3                   	ret
+
+0000000000802b4c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b4c:	55                   	push   %rbp
+  802b4d:	48 89 e5             	mov    %rsp,%rbp
+  802b50:	53                   	push   %rbx
+  802b51:	48 83 ec 08          	sub    $0x8,%rsp
+  802b55:	89 f8                	mov    %edi,%eax
+  802b57:	49 89 f2             	mov    %rsi,%r10
+  802b5a:	48 89 d3             	mov    %rdx,%rbx
+  802b5d:	48 89 cf             	mov    %rcx,%rdi
+  802b60:	44 89 c6             	mov    %r8d,%esi
+  802b63:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b66:	48 63 f6             	movslq %esi,%rsi
+  802b69:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b6c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b71:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b74:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b78:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b7a:	48 85 c0             	test   %rax,%rax
+  802b7d:	7f 06                	jg     802b85 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b83:	c9                   	leave
+  802b84:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b85:	49 89 c0             	mov    %rax,%r8
+  802b88:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b8d:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802b94:	00 00 00 
+  802b97:	be 27 00 00 00       	mov    $0x27,%esi
+  802b9c:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802ba3:	00 00 00 
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802bb2:	00 00 00 
+  802bb5:	41 ff d1             	call   *%r9
+
+0000000000802bb8 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bb8:	55                   	push   %rbp
+  802bb9:	48 89 e5             	mov    %rsp,%rbp
+  802bbc:	53                   	push   %rbx
+  802bbd:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc1:	48 89 f1             	mov    %rsi,%rcx
+  802bc4:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bc7:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bcb:	48 8b 1a             	mov    (%rdx),%rbx
+  802bce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bd1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd6:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bda:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bde:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802be2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be4:	48 85 c0             	test   %rax,%rax
+  802be7:	7f 06                	jg     802bef <sys_ipc_call_short+0x37>
+}
+  802be9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bed:	c9                   	leave
+  802bee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bef:	49 89 c0             	mov    %rax,%r8
+  802bf2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bf7:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802bfe:	00 00 00 
+  802c01:	be 27 00 00 00       	mov    $0x27,%esi
+  802c06:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c0d:	00 00 00 
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c15:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802c1c:	00 00 00 
+  802c1f:	41 ff d1             	call   *%r9
+
+0000000000802c22 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c22:	55                   	push   %rbp
+  802c23:	48 89 e5             	mov    %rsp,%rbp
+  802c26:	53                   	push   %rbx
+  802c27:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2b:	89 f8                	mov    %edi,%eax
+  802c2d:	49 89 f2             	mov    %rsi,%r10
+  802c30:	48 89 d3             	mov    %rdx,%rbx
+  802c33:	48 89 cf             	mov    %rcx,%rdi
+  802c36:	44 89 c6             	mov    %r8d,%esi
+  802c39:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c3c:	48 63 f6             	movslq %esi,%rsi
+  802c3f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c42:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c47:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c4a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c4e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c50:	48 85 c0             	test   %rax,%rax
+  802c53:	7f 06                	jg     802c5b <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c59:	c9                   	leave
+  802c5a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5b:	49 89 c0             	mov    %rax,%r8
+  802c5e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c63:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802c6a:	00 00 00 
+  802c6d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c72:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c79:	00 00 00 
+  802c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c81:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802c88:	00 00 00 
+  802c8b:	41 ff d1             	call   *%r9
+
+0000000000802c8e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c8e:	55                   	push   %rbp
+  802c8f:	48 89 e5             	mov    %rsp,%rbp
+  802c92:	53                   	push   %rbx
+  802c93:	48 83 ec 08          	sub    $0x8,%rsp
+  802c97:	48 89 fa             	mov    %rdi,%rdx
+  802c9a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c9d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cac:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cbf:	48 85 c0             	test   %rax,%rax
+  802cc2:	7f 06                	jg     802cca <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cca:	49 89 c0             	mov    %rax,%r8
+  802ccd:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cd2:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802cd9:	00 00 00 
+  802cdc:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce1:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802ce8:	00 00 00 
+  802ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf0:	49 b9 1b 51 80 00 00 	movabs $0x80511b,%r9
+  802cf7:	00 00 00 
+  802cfa:	41 ff d1             	call   *%r9
+
+0000000000802cfd <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cfd:	55                   	push   %rbp
+  802cfe:	48 89 e5             	mov    %rsp,%rbp
+  802d01:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d02:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d07:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d2e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d32:	c9                   	leave
+  802d33:	c3                   	ret
+
+0000000000802d34 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d34:	55                   	push   %rbp
+  802d35:	48 89 e5             	mov    %rsp,%rbp
+  802d38:	53                   	push   %rbx
+  802d39:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d3c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d41:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d4b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d50:	be 00 00 00 00       	mov    $0x0,%esi
+  802d55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d61:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d67:	c9                   	leave
+  802d68:	c3                   	ret
+
+0000000000802d69 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d69:	55                   	push   %rbp
+  802d6a:	48 89 e5             	mov    %rsp,%rbp
+  802d6d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d73:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d78:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d87:	be 00 00 00 00       	mov    $0x0,%esi
+  802d8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d92:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d98:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d9e:	c9                   	leave
+  802d9f:	c3                   	ret
+
+0000000000802da0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  802da0:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  802da3:	48 b8 be 51 80 00 00 	movabs $0x8051be,%rax
+  802daa:	00 00 00 
+    call *%rax
+  802dad:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  802daf:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  802db6:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  802db7:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  802dbe:	00 
+    subq $8, %rcx
+  802dbf:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  802dc3:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  802dc6:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  802dcd:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  802dce:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  802dd2:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802dd6:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802ddb:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802de0:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802de5:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802dea:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802def:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802df4:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802df9:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802dfe:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802e03:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802e08:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802e0d:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802e12:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802e17:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802e1c:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  802e20:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  802e24:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  802e25:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  802e26:	c3                   	ret
+
+0000000000802e27 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e27:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802e2e:	ff ff ff 
+  802e31:	48 01 f8             	add    %rdi,%rax
+  802e34:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802e38:	c3                   	ret
+
+0000000000802e39 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e39:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802e40:	ff ff ff 
+  802e43:	48 01 f8             	add    %rdi,%rax
+  802e46:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802e4a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802e50:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802e54:	c3                   	ret
+
+0000000000802e55 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802e55:	55                   	push   %rbp
+  802e56:	48 89 e5             	mov    %rsp,%rbp
+  802e59:	41 57                	push   %r15
+  802e5b:	41 56                	push   %r14
+  802e5d:	41 55                	push   %r13
+  802e5f:	41 54                	push   %r12
+  802e61:	53                   	push   %rbx
+  802e62:	48 83 ec 08          	sub    $0x8,%rsp
+  802e66:	49 89 ff             	mov    %rdi,%r15
+  802e69:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802e6e:	49 bd 55 43 80 00 00 	movabs $0x804355,%r13
+  802e75:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802e78:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802e7e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802e81:	48 89 df             	mov    %rbx,%rdi
+  802e84:	41 ff d5             	call   *%r13
+  802e87:	83 e0 04             	and    $0x4,%eax
+  802e8a:	74 17                	je     802ea3 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e8c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e93:	4c 39 f3             	cmp    %r14,%rbx
+  802e96:	75 e6                	jne    802e7e <fd_alloc+0x29>
+  802e98:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e9e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802ea3:	4d 89 27             	mov    %r12,(%r15)
+}
+  802ea6:	48 83 c4 08          	add    $0x8,%rsp
+  802eaa:	5b                   	pop    %rbx
+  802eab:	41 5c                	pop    %r12
+  802ead:	41 5d                	pop    %r13
+  802eaf:	41 5e                	pop    %r14
+  802eb1:	41 5f                	pop    %r15
+  802eb3:	5d                   	pop    %rbp
+  802eb4:	c3                   	ret
+
+0000000000802eb5 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802eb5:	83 ff 1f             	cmp    $0x1f,%edi
+  802eb8:	77 39                	ja     802ef3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802eba:	55                   	push   %rbp
+  802ebb:	48 89 e5             	mov    %rsp,%rbp
+  802ebe:	41 54                	push   %r12
+  802ec0:	53                   	push   %rbx
+  802ec1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802ec4:	48 63 df             	movslq %edi,%rbx
+  802ec7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802ece:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802ed2:	48 89 df             	mov    %rbx,%rdi
+  802ed5:	48 b8 55 43 80 00 00 	movabs $0x804355,%rax
+  802edc:	00 00 00 
+  802edf:	ff d0                	call   *%rax
+  802ee1:	a8 04                	test   $0x4,%al
+  802ee3:	74 14                	je     802ef9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802ee5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eee:	5b                   	pop    %rbx
+  802eef:	41 5c                	pop    %r12
+  802ef1:	5d                   	pop    %rbp
+  802ef2:	c3                   	ret
+        return -E_INVAL;
+  802ef3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802ef8:	c3                   	ret
+        return -E_INVAL;
+  802ef9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802efe:	eb ee                	jmp    802eee <fd_lookup+0x39>
+
+0000000000802f00 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802f00:	55                   	push   %rbp
+  802f01:	48 89 e5             	mov    %rsp,%rbp
+  802f04:	41 54                	push   %r12
+  802f06:	53                   	push   %rbx
+  802f07:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802f0a:	48 b8 00 62 80 00 00 	movabs $0x806200,%rax
+  802f11:	00 00 00 
+  802f14:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802f1b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802f1e:	39 3b                	cmp    %edi,(%rbx)
+  802f20:	74 47                	je     802f69 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802f22:	48 83 c0 08          	add    $0x8,%rax
+  802f26:	48 8b 18             	mov    (%rax),%rbx
+  802f29:	48 85 db             	test   %rbx,%rbx
+  802f2c:	75 f0                	jne    802f1e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802f2e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802f35:	00 00 00 
+  802f38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802f3e:	89 fa                	mov    %edi,%edx
+  802f40:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  802f47:	00 00 00 
+  802f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4f:	48 b9 a6 16 80 00 00 	movabs $0x8016a6,%rcx
+  802f56:	00 00 00 
+  802f59:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802f5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802f60:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802f64:	5b                   	pop    %rbx
+  802f65:	41 5c                	pop    %r12
+  802f67:	5d                   	pop    %rbp
+  802f68:	c3                   	ret
+            return 0;
+  802f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6e:	eb f0                	jmp    802f60 <dev_lookup+0x60>
+
+0000000000802f70 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802f70:	55                   	push   %rbp
+  802f71:	48 89 e5             	mov    %rsp,%rbp
+  802f74:	41 55                	push   %r13
+  802f76:	41 54                	push   %r12
+  802f78:	53                   	push   %rbx
+  802f79:	48 83 ec 18          	sub    $0x18,%rsp
+  802f7d:	48 89 fb             	mov    %rdi,%rbx
+  802f80:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f83:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f8a:	ff ff ff 
+  802f8d:	48 01 df             	add    %rbx,%rdi
+  802f90:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f94:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f98:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  802f9f:	00 00 00 
+  802fa2:	ff d0                	call   *%rax
+  802fa4:	41 89 c5             	mov    %eax,%r13d
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	78 06                	js     802fb1 <fd_close+0x41>
+  802fab:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802faf:	74 1a                	je     802fcb <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802fb1:	45 84 e4             	test   %r12b,%r12b
+  802fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb9:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802fbd:	44 89 e8             	mov    %r13d,%eax
+  802fc0:	48 83 c4 18          	add    $0x18,%rsp
+  802fc4:	5b                   	pop    %rbx
+  802fc5:	41 5c                	pop    %r12
+  802fc7:	41 5d                	pop    %r13
+  802fc9:	5d                   	pop    %rbp
+  802fca:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802fcb:	8b 3b                	mov    (%rbx),%edi
+  802fcd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802fd1:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  802fd8:	00 00 00 
+  802fdb:	ff d0                	call   *%rax
+  802fdd:	41 89 c5             	mov    %eax,%r13d
+  802fe0:	85 c0                	test   %eax,%eax
+  802fe2:	78 1b                	js     802fff <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802fe4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fe8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802fec:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802ff2:	48 85 c0             	test   %rax,%rax
+  802ff5:	74 08                	je     802fff <fd_close+0x8f>
+  802ff7:	48 89 df             	mov    %rbx,%rdi
+  802ffa:	ff d0                	call   *%rax
+  802ffc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802fff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803004:	48 89 de             	mov    %rbx,%rsi
+  803007:	bf 00 00 00 00       	mov    $0x0,%edi
+  80300c:	48 b8 1a 28 80 00 00 	movabs $0x80281a,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+    return res;
+  803018:	eb a3                	jmp    802fbd <fd_close+0x4d>
+
+000000000080301a <close>:
+
+int
+close(int fdnum) {
+  80301a:	55                   	push   %rbp
+  80301b:	48 89 e5             	mov    %rsp,%rbp
+  80301e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803022:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803026:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  80302d:	00 00 00 
+  803030:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803032:	85 c0                	test   %eax,%eax
+  803034:	78 15                	js     80304b <close+0x31>
+
+    return fd_close(fd, 1);
+  803036:	be 01 00 00 00       	mov    $0x1,%esi
+  80303b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80303f:	48 b8 70 2f 80 00 00 	movabs $0x802f70,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+}
+  80304b:	c9                   	leave
+  80304c:	c3                   	ret
+
+000000000080304d <close_all>:
+
+void
+close_all(void) {
+  80304d:	55                   	push   %rbp
+  80304e:	48 89 e5             	mov    %rsp,%rbp
+  803051:	41 54                	push   %r12
+  803053:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803054:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803059:	49 bc 1a 30 80 00 00 	movabs $0x80301a,%r12
+  803060:	00 00 00 
+  803063:	89 df                	mov    %ebx,%edi
+  803065:	41 ff d4             	call   *%r12
+  803068:	83 c3 01             	add    $0x1,%ebx
+  80306b:	83 fb 20             	cmp    $0x20,%ebx
+  80306e:	75 f3                	jne    803063 <close_all+0x16>
+}
+  803070:	5b                   	pop    %rbx
+  803071:	41 5c                	pop    %r12
+  803073:	5d                   	pop    %rbp
+  803074:	c3                   	ret
+
+0000000000803075 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803075:	55                   	push   %rbp
+  803076:	48 89 e5             	mov    %rsp,%rbp
+  803079:	41 57                	push   %r15
+  80307b:	41 56                	push   %r14
+  80307d:	41 55                	push   %r13
+  80307f:	41 54                	push   %r12
+  803081:	53                   	push   %rbx
+  803082:	48 83 ec 18          	sub    $0x18,%rsp
+  803086:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803089:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80308d:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  803094:	00 00 00 
+  803097:	ff d0                	call   *%rax
+  803099:	89 c3                	mov    %eax,%ebx
+  80309b:	85 c0                	test   %eax,%eax
+  80309d:	0f 88 b8 00 00 00    	js     80315b <dup+0xe6>
+    close(newfdnum);
+  8030a3:	44 89 e7             	mov    %r12d,%edi
+  8030a6:	48 b8 1a 30 80 00 00 	movabs $0x80301a,%rax
+  8030ad:	00 00 00 
+  8030b0:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8030b2:	4d 63 ec             	movslq %r12d,%r13
+  8030b5:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8030bc:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8030c0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8030c4:	4c 89 ff             	mov    %r15,%rdi
+  8030c7:	49 be 39 2e 80 00 00 	movabs $0x802e39,%r14
+  8030ce:	00 00 00 
+  8030d1:	41 ff d6             	call   *%r14
+  8030d4:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8030d7:	4c 89 ef             	mov    %r13,%rdi
+  8030da:	41 ff d6             	call   *%r14
+  8030dd:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8030e0:	48 89 df             	mov    %rbx,%rdi
+  8030e3:	48 b8 55 43 80 00 00 	movabs $0x804355,%rax
+  8030ea:	00 00 00 
+  8030ed:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8030ef:	a8 04                	test   $0x4,%al
+  8030f1:	74 2b                	je     80311e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8030f3:	41 89 c1             	mov    %eax,%r9d
+  8030f6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030fc:	4c 89 f1             	mov    %r14,%rcx
+  8030ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  803104:	48 89 de             	mov    %rbx,%rsi
+  803107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310c:	48 b8 af 27 80 00 00 	movabs $0x8027af,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	89 c3                	mov    %eax,%ebx
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	78 4e                	js     80316c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80311e:	4c 89 ff             	mov    %r15,%rdi
+  803121:	48 b8 55 43 80 00 00 	movabs $0x804355,%rax
+  803128:	00 00 00 
+  80312b:	ff d0                	call   *%rax
+  80312d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803130:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803136:	4c 89 e9             	mov    %r13,%rcx
+  803139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313e:	4c 89 fe             	mov    %r15,%rsi
+  803141:	bf 00 00 00 00       	mov    $0x0,%edi
+  803146:	48 b8 af 27 80 00 00 	movabs $0x8027af,%rax
+  80314d:	00 00 00 
+  803150:	ff d0                	call   *%rax
+  803152:	89 c3                	mov    %eax,%ebx
+  803154:	85 c0                	test   %eax,%eax
+  803156:	78 14                	js     80316c <dup+0xf7>
+
+    return newfdnum;
+  803158:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80315b:	89 d8                	mov    %ebx,%eax
+  80315d:	48 83 c4 18          	add    $0x18,%rsp
+  803161:	5b                   	pop    %rbx
+  803162:	41 5c                	pop    %r12
+  803164:	41 5d                	pop    %r13
+  803166:	41 5e                	pop    %r14
+  803168:	41 5f                	pop    %r15
+  80316a:	5d                   	pop    %rbp
+  80316b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80316c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803171:	4c 89 ee             	mov    %r13,%rsi
+  803174:	bf 00 00 00 00       	mov    $0x0,%edi
+  803179:	49 bc 1a 28 80 00 00 	movabs $0x80281a,%r12
+  803180:	00 00 00 
+  803183:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803186:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80318b:	4c 89 f6             	mov    %r14,%rsi
+  80318e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803193:	41 ff d4             	call   *%r12
+    return res;
+  803196:	eb c3                	jmp    80315b <dup+0xe6>
+
+0000000000803198 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803198:	55                   	push   %rbp
+  803199:	48 89 e5             	mov    %rsp,%rbp
+  80319c:	41 56                	push   %r14
+  80319e:	41 55                	push   %r13
+  8031a0:	41 54                	push   %r12
+  8031a2:	53                   	push   %rbx
+  8031a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8031a7:	89 fb                	mov    %edi,%ebx
+  8031a9:	49 89 f4             	mov    %rsi,%r12
+  8031ac:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031af:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031b3:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+  8031bf:	85 c0                	test   %eax,%eax
+  8031c1:	78 4c                	js     80320f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8031c3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8031c7:	41 8b 3e             	mov    (%r14),%edi
+  8031ca:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8031ce:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  8031d5:	00 00 00 
+  8031d8:	ff d0                	call   *%rax
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	78 35                	js     803213 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8031de:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8031e2:	83 e0 03             	and    $0x3,%eax
+  8031e5:	83 f8 01             	cmp    $0x1,%eax
+  8031e8:	74 2d                	je     803217 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031ee:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8031f2:	48 85 c0             	test   %rax,%rax
+  8031f5:	74 56                	je     80324d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8031f7:	4c 89 ea             	mov    %r13,%rdx
+  8031fa:	4c 89 e6             	mov    %r12,%rsi
+  8031fd:	4c 89 f7             	mov    %r14,%rdi
+  803200:	ff d0                	call   *%rax
+}
+  803202:	48 83 c4 10          	add    $0x10,%rsp
+  803206:	5b                   	pop    %rbx
+  803207:	41 5c                	pop    %r12
+  803209:	41 5d                	pop    %r13
+  80320b:	41 5e                	pop    %r14
+  80320d:	5d                   	pop    %rbp
+  80320e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80320f:	48 98                	cltq
+  803211:	eb ef                	jmp    803202 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803213:	48 98                	cltq
+  803215:	eb eb                	jmp    803202 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803217:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80321e:	00 00 00 
+  803221:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803227:	89 da                	mov    %ebx,%edx
+  803229:	48 bf b9 61 80 00 00 	movabs $0x8061b9,%rdi
+  803230:	00 00 00 
+  803233:	b8 00 00 00 00       	mov    $0x0,%eax
+  803238:	48 b9 a6 16 80 00 00 	movabs $0x8016a6,%rcx
+  80323f:	00 00 00 
+  803242:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803244:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80324b:	eb b5                	jmp    803202 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80324d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803254:	eb ac                	jmp    803202 <read+0x6a>
+
+0000000000803256 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803256:	55                   	push   %rbp
+  803257:	48 89 e5             	mov    %rsp,%rbp
+  80325a:	41 57                	push   %r15
+  80325c:	41 56                	push   %r14
+  80325e:	41 55                	push   %r13
+  803260:	41 54                	push   %r12
+  803262:	53                   	push   %rbx
+  803263:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803267:	48 85 d2             	test   %rdx,%rdx
+  80326a:	74 54                	je     8032c0 <readn+0x6a>
+  80326c:	41 89 fd             	mov    %edi,%r13d
+  80326f:	49 89 f6             	mov    %rsi,%r14
+  803272:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803275:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80327a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80327f:	49 bf 98 31 80 00 00 	movabs $0x803198,%r15
+  803286:	00 00 00 
+  803289:	4c 89 e2             	mov    %r12,%rdx
+  80328c:	48 29 f2             	sub    %rsi,%rdx
+  80328f:	4c 01 f6             	add    %r14,%rsi
+  803292:	44 89 ef             	mov    %r13d,%edi
+  803295:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803298:	85 c0                	test   %eax,%eax
+  80329a:	78 20                	js     8032bc <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80329c:	01 c3                	add    %eax,%ebx
+  80329e:	85 c0                	test   %eax,%eax
+  8032a0:	74 08                	je     8032aa <readn+0x54>
+  8032a2:	48 63 f3             	movslq %ebx,%rsi
+  8032a5:	4c 39 e6             	cmp    %r12,%rsi
+  8032a8:	72 df                	jb     803289 <readn+0x33>
+    }
+    return res;
+  8032aa:	48 63 c3             	movslq %ebx,%rax
+}
+  8032ad:	48 83 c4 08          	add    $0x8,%rsp
+  8032b1:	5b                   	pop    %rbx
+  8032b2:	41 5c                	pop    %r12
+  8032b4:	41 5d                	pop    %r13
+  8032b6:	41 5e                	pop    %r14
+  8032b8:	41 5f                	pop    %r15
+  8032ba:	5d                   	pop    %rbp
+  8032bb:	c3                   	ret
+        if (inc < 0) return inc;
+  8032bc:	48 98                	cltq
+  8032be:	eb ed                	jmp    8032ad <readn+0x57>
+    int inc = 1, res = 0;
+  8032c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032c5:	eb e3                	jmp    8032aa <readn+0x54>
+
+00000000008032c7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8032c7:	55                   	push   %rbp
+  8032c8:	48 89 e5             	mov    %rsp,%rbp
+  8032cb:	41 56                	push   %r14
+  8032cd:	41 55                	push   %r13
+  8032cf:	41 54                	push   %r12
+  8032d1:	53                   	push   %rbx
+  8032d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8032d6:	89 fb                	mov    %edi,%ebx
+  8032d8:	49 89 f4             	mov    %rsi,%r12
+  8032db:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032de:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032e2:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  8032e9:	00 00 00 
+  8032ec:	ff d0                	call   *%rax
+  8032ee:	85 c0                	test   %eax,%eax
+  8032f0:	78 47                	js     803339 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032f2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8032f6:	41 8b 3e             	mov    (%r14),%edi
+  8032f9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8032fd:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+  803309:	85 c0                	test   %eax,%eax
+  80330b:	78 30                	js     80333d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80330d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803312:	74 2d                	je     803341 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803314:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803318:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80331c:	48 85 c0             	test   %rax,%rax
+  80331f:	74 56                	je     803377 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803321:	4c 89 ea             	mov    %r13,%rdx
+  803324:	4c 89 e6             	mov    %r12,%rsi
+  803327:	4c 89 f7             	mov    %r14,%rdi
+  80332a:	ff d0                	call   *%rax
+}
+  80332c:	48 83 c4 10          	add    $0x10,%rsp
+  803330:	5b                   	pop    %rbx
+  803331:	41 5c                	pop    %r12
+  803333:	41 5d                	pop    %r13
+  803335:	41 5e                	pop    %r14
+  803337:	5d                   	pop    %rbp
+  803338:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803339:	48 98                	cltq
+  80333b:	eb ef                	jmp    80332c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80333d:	48 98                	cltq
+  80333f:	eb eb                	jmp    80332c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803341:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803348:	00 00 00 
+  80334b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803351:	89 da                	mov    %ebx,%edx
+  803353:	48 bf d5 61 80 00 00 	movabs $0x8061d5,%rdi
+  80335a:	00 00 00 
+  80335d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803362:	48 b9 a6 16 80 00 00 	movabs $0x8016a6,%rcx
+  803369:	00 00 00 
+  80336c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80336e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803375:	eb b5                	jmp    80332c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803377:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80337e:	eb ac                	jmp    80332c <write+0x65>
+
+0000000000803380 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803380:	55                   	push   %rbp
+  803381:	48 89 e5             	mov    %rsp,%rbp
+  803384:	53                   	push   %rbx
+  803385:	48 83 ec 18          	sub    $0x18,%rsp
+  803389:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80338b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80338f:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  803396:	00 00 00 
+  803399:	ff d0                	call   *%rax
+  80339b:	85 c0                	test   %eax,%eax
+  80339d:	78 0c                	js     8033ab <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80339f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033a3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8033a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033af:	c9                   	leave
+  8033b0:	c3                   	ret
+
+00000000008033b1 <tell>:
+
+int tell(int fdnum) {
+  8033b1:	55                   	push   %rbp
+  8033b2:	48 89 e5             	mov    %rsp,%rbp
+  8033b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033bd:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  8033c4:	00 00 00 
+  8033c7:	ff d0                	call   *%rax
+  8033c9:	85 c0                	test   %eax,%eax
+  8033cb:	78 07                	js     8033d4 <tell+0x23>
+
+    return fd->fd_offset;
+  8033cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d1:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8033d4:	c9                   	leave
+  8033d5:	c3                   	ret
+
+00000000008033d6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8033d6:	55                   	push   %rbp
+  8033d7:	48 89 e5             	mov    %rsp,%rbp
+  8033da:	41 55                	push   %r13
+  8033dc:	41 54                	push   %r12
+  8033de:	53                   	push   %rbx
+  8033df:	48 83 ec 18          	sub    $0x18,%rsp
+  8033e3:	89 fb                	mov    %edi,%ebx
+  8033e5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033e8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033ec:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  8033f3:	00 00 00 
+  8033f6:	ff d0                	call   *%rax
+  8033f8:	85 c0                	test   %eax,%eax
+  8033fa:	78 38                	js     803434 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033fc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803400:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803404:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803408:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  80340f:	00 00 00 
+  803412:	ff d0                	call   *%rax
+  803414:	85 c0                	test   %eax,%eax
+  803416:	78 1c                	js     803434 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803418:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80341d:	74 20                	je     80343f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80341f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803423:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803427:	48 85 c0             	test   %rax,%rax
+  80342a:	74 47                	je     803473 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80342c:	44 89 e6             	mov    %r12d,%esi
+  80342f:	4c 89 ef             	mov    %r13,%rdi
+  803432:	ff d0                	call   *%rax
+}
+  803434:	48 83 c4 18          	add    $0x18,%rsp
+  803438:	5b                   	pop    %rbx
+  803439:	41 5c                	pop    %r12
+  80343b:	41 5d                	pop    %r13
+  80343d:	5d                   	pop    %rbp
+  80343e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80343f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803446:	00 00 00 
+  803449:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80344f:	89 da                	mov    %ebx,%edx
+  803451:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  803458:	00 00 00 
+  80345b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803460:	48 b9 a6 16 80 00 00 	movabs $0x8016a6,%rcx
+  803467:	00 00 00 
+  80346a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80346c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803471:	eb c1                	jmp    803434 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803473:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803478:	eb ba                	jmp    803434 <ftruncate+0x5e>
+
+000000000080347a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80347a:	55                   	push   %rbp
+  80347b:	48 89 e5             	mov    %rsp,%rbp
+  80347e:	41 54                	push   %r12
+  803480:	53                   	push   %rbx
+  803481:	48 83 ec 10          	sub    $0x10,%rsp
+  803485:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803488:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80348c:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  803493:	00 00 00 
+  803496:	ff d0                	call   *%rax
+  803498:	85 c0                	test   %eax,%eax
+  80349a:	78 63                	js     8034ff <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80349c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8034a0:	41 8b 3c 24          	mov    (%r12),%edi
+  8034a4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8034a8:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  8034af:	00 00 00 
+  8034b2:	ff d0                	call   *%rax
+  8034b4:	85 c0                	test   %eax,%eax
+  8034b6:	78 47                	js     8034ff <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8034b8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034bc:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8034c1:	74 45                	je     803508 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8034c3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8034c6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8034cd:	00 00 00 
+    stat->st_isdir = 0;
+  8034d0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8034d7:	00 00 00 
+    stat->st_ino = 0;
+  8034da:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8034e1:	00 00 00 00 
+    stat->st_version = 0;
+  8034e5:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8034ec:	00 00 00 
+    stat->st_dev = dev;
+  8034ef:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8034f6:	48 89 de             	mov    %rbx,%rsi
+  8034f9:	4c 89 e7             	mov    %r12,%rdi
+  8034fc:	ff 50 28             	call   *0x28(%rax)
+}
+  8034ff:	48 83 c4 10          	add    $0x10,%rsp
+  803503:	5b                   	pop    %rbx
+  803504:	41 5c                	pop    %r12
+  803506:	5d                   	pop    %rbp
+  803507:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803508:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80350d:	eb f0                	jmp    8034ff <fstat+0x85>
+
+000000000080350f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80350f:	55                   	push   %rbp
+  803510:	48 89 e5             	mov    %rsp,%rbp
+  803513:	41 54                	push   %r12
+  803515:	53                   	push   %rbx
+  803516:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803519:	be 00 00 00 00       	mov    $0x0,%esi
+  80351e:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  803525:	00 00 00 
+  803528:	ff d0                	call   *%rax
+  80352a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80352c:	85 c0                	test   %eax,%eax
+  80352e:	78 25                	js     803555 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803530:	4c 89 e6             	mov    %r12,%rsi
+  803533:	89 c7                	mov    %eax,%edi
+  803535:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  80353c:	00 00 00 
+  80353f:	ff d0                	call   *%rax
+  803541:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803544:	89 df                	mov    %ebx,%edi
+  803546:	48 b8 1a 30 80 00 00 	movabs $0x80301a,%rax
+  80354d:	00 00 00 
+  803550:	ff d0                	call   *%rax
+
+    return res;
+  803552:	44 89 e3             	mov    %r12d,%ebx
+}
+  803555:	89 d8                	mov    %ebx,%eax
+  803557:	5b                   	pop    %rbx
+  803558:	41 5c                	pop    %r12
+  80355a:	5d                   	pop    %rbp
+  80355b:	c3                   	ret
+
+000000000080355c <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80355c:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803563:	00 00 00 
+  803566:	83 38 00             	cmpl   $0x0,(%rax)
+  803569:	74 0a                	je     803575 <fsipc_env+0x19>
+    return fsenv;
+}
+  80356b:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803572:	00 00 
+  803574:	c3                   	ret
+fsipc_env(void) {
+  803575:	55                   	push   %rbp
+  803576:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803579:	bf 03 00 00 00       	mov    $0x3,%edi
+  80357e:	48 b8 7b 56 80 00 00 	movabs $0x80567b,%rax
+  803585:	00 00 00 
+  803588:	ff d0                	call   *%rax
+  80358a:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803591:	00 00 
+}
+  803593:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80359a:	00 00 
+  80359c:	5d                   	pop    %rbp
+  80359d:	c3                   	ret
+
+000000000080359e <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80359e:	55                   	push   %rbp
+  80359f:	48 89 e5             	mov    %rsp,%rbp
+  8035a2:	53                   	push   %rbx
+  8035a3:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8035a7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8035ae:	00 
+  8035af:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8035b6:	00 
+  8035b7:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8035be:	00 
+  8035bf:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8035c6:	00 
+  8035c7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8035ce:	00 
+
+    assert(size <= sizeof(words));
+  8035cf:	48 83 fa 28          	cmp    $0x28,%rdx
+  8035d3:	77 38                	ja     80360d <fsipc_short+0x6f>
+  8035d5:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8035d7:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8035db:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  8035e2:	00 00 00 
+  8035e5:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8035e7:	48 b8 5c 35 80 00 00 	movabs $0x80355c,%rax
+  8035ee:	00 00 00 
+  8035f1:	ff d0                	call   *%rax
+  8035f3:	89 c7                	mov    %eax,%edi
+  8035f5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8035f9:	89 de                	mov    %ebx,%esi
+  8035fb:	48 b8 de 55 80 00 00 	movabs $0x8055de,%rax
+  803602:	00 00 00 
+  803605:	ff d0                	call   *%rax
+}
+  803607:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80360b:	c9                   	leave
+  80360c:	c3                   	ret
+    assert(size <= sizeof(words));
+  80360d:	48 b9 20 62 80 00 00 	movabs $0x806220,%rcx
+  803614:	00 00 00 
+  803617:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80361e:	00 00 00 
+  803621:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803626:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80362d:	00 00 00 
+  803630:	b8 00 00 00 00       	mov    $0x0,%eax
+  803635:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  80363c:	00 00 00 
+  80363f:	41 ff d0             	call   *%r8
+
+0000000000803642 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803642:	55                   	push   %rbp
+  803643:	48 89 e5             	mov    %rsp,%rbp
+  803646:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  80364a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80364d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803650:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803653:	ba 08 00 00 00       	mov    $0x8,%edx
+  803658:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80365c:	bf 02 00 00 00       	mov    $0x2,%edi
+  803661:	48 b8 9e 35 80 00 00 	movabs $0x80359e,%rax
+  803668:	00 00 00 
+  80366b:	ff d0                	call   *%rax
+}
+  80366d:	c9                   	leave
+  80366e:	c3                   	ret
+
+000000000080366f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80366f:	55                   	push   %rbp
+  803670:	48 89 e5             	mov    %rsp,%rbp
+  803673:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803677:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80367a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  80367d:	ba 04 00 00 00       	mov    $0x4,%edx
+  803682:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803686:	bf 06 00 00 00       	mov    $0x6,%edi
+  80368b:	48 b8 9e 35 80 00 00 	movabs $0x80359e,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+}
+  803697:	c9                   	leave
+  803698:	c3                   	ret
+
+0000000000803699 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803699:	55                   	push   %rbp
+  80369a:	48 89 e5             	mov    %rsp,%rbp
+  80369d:	41 54                	push   %r12
+  80369f:	53                   	push   %rbx
+  8036a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8036a4:	89 fb                	mov    %edi,%ebx
+  8036a6:	49 89 f4             	mov    %rsi,%r12
+  8036a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8036ad:	48 b8 5c 35 80 00 00 	movabs $0x80355c,%rax
+  8036b4:	00 00 00 
+  8036b7:	ff d0                	call   *%rax
+  8036b9:	89 c7                	mov    %eax,%edi
+  8036bb:	6a 00                	push   $0x0
+  8036bd:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8036c1:	50                   	push   %rax
+  8036c2:	4d 89 e1             	mov    %r12,%r9
+  8036c5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8036cb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036d0:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  8036d7:	00 00 00 
+  8036da:	89 de                	mov    %ebx,%esi
+  8036dc:	48 b8 79 55 80 00 00 	movabs $0x805579,%rax
+  8036e3:	00 00 00 
+  8036e6:	ff d0                	call   *%rax
+}
+  8036e8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8036ec:	5b                   	pop    %rbx
+  8036ed:	41 5c                	pop    %r12
+  8036ef:	5d                   	pop    %rbp
+  8036f0:	c3                   	ret
+
+00000000008036f1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8036f1:	55                   	push   %rbp
+  8036f2:	48 89 e5             	mov    %rsp,%rbp
+  8036f5:	41 54                	push   %r12
+  8036f7:	53                   	push   %rbx
+  8036f8:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8036fb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8036fe:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803705:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803707:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80370c:	be 00 00 00 00       	mov    $0x0,%esi
+  803711:	bf 05 00 00 00       	mov    $0x5,%edi
+  803716:	48 b8 99 36 80 00 00 	movabs $0x803699,%rax
+  80371d:	00 00 00 
+  803720:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803722:	85 c0                	test   %eax,%eax
+  803724:	78 5a                	js     803780 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803726:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80372d:	00 00 00 
+  803730:	4c 89 e6             	mov    %r12,%rsi
+  803733:	48 89 df             	mov    %rbx,%rdi
+  803736:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  80373d:	00 00 00 
+  803740:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803742:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803749:	00 
+  80374a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803750:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803757:	00 
+  803758:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  80375e:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803765:	00 
+  803766:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  80376d:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803774:	00 
+  803775:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  80377b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803780:	5b                   	pop    %rbx
+  803781:	41 5c                	pop    %r12
+  803783:	5d                   	pop    %rbp
+  803784:	c3                   	ret
+
+0000000000803785 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803785:	55                   	push   %rbp
+  803786:	48 89 e5             	mov    %rsp,%rbp
+  803789:	41 57                	push   %r15
+  80378b:	41 56                	push   %r14
+  80378d:	41 55                	push   %r13
+  80378f:	41 54                	push   %r12
+  803791:	53                   	push   %rbx
+  803792:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803796:	48 85 ff             	test   %rdi,%rdi
+  803799:	0f 84 a1 00 00 00    	je     803840 <devfile_read+0xbb>
+  80379f:	49 89 ff             	mov    %rdi,%r15
+  8037a2:	49 89 f5             	mov    %rsi,%r13
+  8037a5:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8037a8:	48 85 f6             	test   %rsi,%rsi
+  8037ab:	0f 84 c4 00 00 00    	je     803875 <devfile_read+0xf0>
+    size_t total_read = 0;
+  8037b1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8037b8:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037b9:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8037c0:	00 00 00 
+  8037c3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8037c7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8037ca:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8037ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8037d8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037dd:	48 b8 99 36 80 00 00 	movabs $0x803699,%rax
+  8037e4:	00 00 00 
+  8037e7:	ff d0                	call   *%rax
+        if (res < 0) {
+  8037e9:	85 c0                	test   %eax,%eax
+  8037eb:	0f 88 b9 00 00 00    	js     8038aa <devfile_read+0x125>
+        assert(res <= n);
+  8037f1:	48 63 d8             	movslq %eax,%rbx
+  8037f4:	49 39 dc             	cmp    %rbx,%r12
+  8037f7:	0f 82 b1 00 00 00    	jb     8038ae <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8037fd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803802:	0f 87 db 00 00 00    	ja     8038e3 <devfile_read+0x15e>
+        if (!res) {
+  803808:	85 c0                	test   %eax,%eax
+  80380a:	74 21                	je     80382d <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80380c:	48 89 da             	mov    %rbx,%rdx
+  80380f:	4c 89 f6             	mov    %r14,%rsi
+  803812:	4c 89 ef             	mov    %r13,%rdi
+  803815:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  80381c:	00 00 00 
+  80381f:	ff d0                	call   *%rax
+        total_read += res;
+  803821:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803825:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803828:	49 29 dc             	sub    %rbx,%r12
+  80382b:	75 96                	jne    8037c3 <devfile_read+0x3e>
+    return total_read;
+  80382d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803831:	48 83 c4 18          	add    $0x18,%rsp
+  803835:	5b                   	pop    %rbx
+  803836:	41 5c                	pop    %r12
+  803838:	41 5d                	pop    %r13
+  80383a:	41 5e                	pop    %r14
+  80383c:	41 5f                	pop    %r15
+  80383e:	5d                   	pop    %rbp
+  80383f:	c3                   	ret
+    assert(fd);
+  803840:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  803847:	00 00 00 
+  80384a:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803851:	00 00 00 
+  803854:	be 91 00 00 00       	mov    $0x91,%esi
+  803859:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803860:	00 00 00 
+  803863:	b8 00 00 00 00       	mov    $0x0,%eax
+  803868:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  80386f:	00 00 00 
+  803872:	41 ff d0             	call   *%r8
+    assert(buf);
+  803875:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  80387c:	00 00 00 
+  80387f:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803886:	00 00 00 
+  803889:	be 92 00 00 00       	mov    $0x92,%esi
+  80388e:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803895:	00 00 00 
+  803898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389d:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  8038a4:	00 00 00 
+  8038a7:	41 ff d0             	call   *%r8
+            return res;
+  8038aa:	48 98                	cltq
+  8038ac:	eb 83                	jmp    803831 <devfile_read+0xac>
+        assert(res <= n);
+  8038ae:	48 b9 5d 62 80 00 00 	movabs $0x80625d,%rcx
+  8038b5:	00 00 00 
+  8038b8:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8038bf:	00 00 00 
+  8038c2:	be 9e 00 00 00       	mov    $0x9e,%esi
+  8038c7:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8038ce:	00 00 00 
+  8038d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d6:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  8038dd:	00 00 00 
+  8038e0:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8038e3:	48 b9 68 62 80 00 00 	movabs $0x806268,%rcx
+  8038ea:	00 00 00 
+  8038ed:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8038f4:	00 00 00 
+  8038f7:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8038fc:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803903:	00 00 00 
+  803906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390b:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  803912:	00 00 00 
+  803915:	41 ff d0             	call   *%r8
+
+0000000000803918 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803918:	55                   	push   %rbp
+  803919:	48 89 e5             	mov    %rsp,%rbp
+  80391c:	41 57                	push   %r15
+  80391e:	41 56                	push   %r14
+  803920:	41 55                	push   %r13
+  803922:	41 54                	push   %r12
+  803924:	53                   	push   %rbx
+  803925:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803929:	48 85 ff             	test   %rdi,%rdi
+  80392c:	0f 84 83 00 00 00    	je     8039b5 <devfile_write+0x9d>
+  803932:	49 89 ff             	mov    %rdi,%r15
+  803935:	49 89 f4             	mov    %rsi,%r12
+  803938:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  80393b:	48 85 f6             	test   %rsi,%rsi
+  80393e:	0f 84 a6 00 00 00    	je     8039ea <devfile_write+0xd2>
+    size_t total_written = 0;
+  803944:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80394a:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803951:	00 00 00 
+  803954:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803958:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  80395b:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80395f:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803964:	48 39 d3             	cmp    %rdx,%rbx
+  803967:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  80396b:	4c 89 e6             	mov    %r12,%rsi
+  80396e:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803975:	00 00 00 
+  803978:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  80397f:	00 00 00 
+  803982:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803984:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803989:	be 00 00 00 00       	mov    $0x0,%esi
+  80398e:	bf 04 00 00 00       	mov    $0x4,%edi
+  803993:	48 b8 99 36 80 00 00 	movabs $0x803699,%rax
+  80399a:	00 00 00 
+  80399d:	ff d0                	call   *%rax
+        if (res < 0) {
+  80399f:	85 c0                	test   %eax,%eax
+  8039a1:	78 7c                	js     803a1f <devfile_write+0x107>
+        total_written += res;
+  8039a3:	48 98                	cltq
+  8039a5:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8039a8:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8039ab:	48 29 c3             	sub    %rax,%rbx
+  8039ae:	75 a4                	jne    803954 <devfile_write+0x3c>
+    return total_written;
+  8039b0:	4c 89 e8             	mov    %r13,%rax
+  8039b3:	eb 6c                	jmp    803a21 <devfile_write+0x109>
+    assert(fd);
+  8039b5:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  8039bc:	00 00 00 
+  8039bf:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8039c6:	00 00 00 
+  8039c9:	be bd 00 00 00       	mov    $0xbd,%esi
+  8039ce:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8039d5:	00 00 00 
+  8039d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039dd:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  8039e4:	00 00 00 
+  8039e7:	41 ff d0             	call   *%r8
+    assert(buf);
+  8039ea:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  8039f1:	00 00 00 
+  8039f4:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8039fb:	00 00 00 
+  8039fe:	be be 00 00 00       	mov    $0xbe,%esi
+  803a03:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803a0a:	00 00 00 
+  803a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a12:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  803a19:	00 00 00 
+  803a1c:	41 ff d0             	call   *%r8
+            return res;
+  803a1f:	48 98                	cltq
+}
+  803a21:	48 83 c4 08          	add    $0x8,%rsp
+  803a25:	5b                   	pop    %rbx
+  803a26:	41 5c                	pop    %r12
+  803a28:	41 5d                	pop    %r13
+  803a2a:	41 5e                	pop    %r14
+  803a2c:	41 5f                	pop    %r15
+  803a2e:	5d                   	pop    %rbp
+  803a2f:	c3                   	ret
+
+0000000000803a30 <open>:
+open(const char *path, int mode) {
+  803a30:	55                   	push   %rbp
+  803a31:	48 89 e5             	mov    %rsp,%rbp
+  803a34:	41 55                	push   %r13
+  803a36:	41 54                	push   %r12
+  803a38:	53                   	push   %rbx
+  803a39:	48 83 ec 18          	sub    $0x18,%rsp
+  803a3d:	49 89 fc             	mov    %rdi,%r12
+  803a40:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803a43:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  803a4a:	00 00 00 
+  803a4d:	ff d0                	call   *%rax
+  803a4f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803a55:	0f 87 8f 00 00 00    	ja     803aea <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803a5b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803a5f:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+  803a6b:	89 c3                	mov    %eax,%ebx
+  803a6d:	85 c0                	test   %eax,%eax
+  803a6f:	78 55                	js     803ac6 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803a71:	4c 89 e6             	mov    %r12,%rsi
+  803a74:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803a7b:	00 00 00 
+  803a7e:	48 89 df             	mov    %rbx,%rdi
+  803a81:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  803a88:	00 00 00 
+  803a8b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a8d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a99:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a9d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803aa2:	48 b8 99 36 80 00 00 	movabs $0x803699,%rax
+  803aa9:	00 00 00 
+  803aac:	ff d0                	call   *%rax
+  803aae:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803ab0:	85 c0                	test   %eax,%eax
+  803ab2:	78 1f                	js     803ad3 <open+0xa3>
+    return fd2num(fd);
+  803ab4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ab8:	48 b8 27 2e 80 00 00 	movabs $0x802e27,%rax
+  803abf:	00 00 00 
+  803ac2:	ff d0                	call   *%rax
+  803ac4:	89 c3                	mov    %eax,%ebx
+}
+  803ac6:	89 d8                	mov    %ebx,%eax
+  803ac8:	48 83 c4 18          	add    $0x18,%rsp
+  803acc:	5b                   	pop    %rbx
+  803acd:	41 5c                	pop    %r12
+  803acf:	41 5d                	pop    %r13
+  803ad1:	5d                   	pop    %rbp
+  803ad2:	c3                   	ret
+        fd_close(fd, 0);
+  803ad3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ad8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803adc:	48 b8 70 2f 80 00 00 	movabs $0x802f70,%rax
+  803ae3:	00 00 00 
+  803ae6:	ff d0                	call   *%rax
+        return res;
+  803ae8:	eb dc                	jmp    803ac6 <open+0x96>
+        return -E_BAD_PATH;
+  803aea:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803aef:	eb d5                	jmp    803ac6 <open+0x96>
+
+0000000000803af1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803af1:	55                   	push   %rbp
+  803af2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803af5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803afa:	be 00 00 00 00       	mov    $0x0,%esi
+  803aff:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b04:	48 b8 9e 35 80 00 00 	movabs $0x80359e,%rax
+  803b0b:	00 00 00 
+  803b0e:	ff d0                	call   *%rax
+}
+  803b10:	5d                   	pop    %rbp
+  803b11:	c3                   	ret
+
+0000000000803b12 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803b12:	55                   	push   %rbp
+  803b13:	48 89 e5             	mov    %rsp,%rbp
+  803b16:	41 56                	push   %r14
+  803b18:	41 55                	push   %r13
+  803b1a:	41 54                	push   %r12
+  803b1c:	53                   	push   %rbx
+  803b1d:	48 83 ec 10          	sub    $0x10,%rsp
+  803b21:	41 89 f6             	mov    %esi,%r14d
+  803b24:	49 89 d4             	mov    %rdx,%r12
+  803b27:	48 89 cb             	mov    %rcx,%rbx
+  803b2a:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b2d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b31:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  803b38:	00 00 00 
+  803b3b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b3d:	85 c0                	test   %eax,%eax
+  803b3f:	78 46                	js     803b87 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b41:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b45:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803b4c:	00 00 00 
+  803b4f:	8b 00                	mov    (%rax),%eax
+  803b51:	39 02                	cmp    %eax,(%rdx)
+  803b53:	75 3f                	jne    803b94 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803b55:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803b5c:	00 00 00 
+  803b5f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803b62:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803b64:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803b68:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803b6c:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803b70:	48 89 da             	mov    %rbx,%rdx
+  803b73:	4c 89 e6             	mov    %r12,%rsi
+  803b76:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b7b:	48 b8 99 36 80 00 00 	movabs $0x803699,%rax
+  803b82:	00 00 00 
+  803b85:	ff d0                	call   *%rax
+}
+  803b87:	48 83 c4 10          	add    $0x10,%rsp
+  803b8b:	5b                   	pop    %rbx
+  803b8c:	41 5c                	pop    %r12
+  803b8e:	41 5d                	pop    %r13
+  803b90:	41 5e                	pop    %r14
+  803b92:	5d                   	pop    %rbp
+  803b93:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b94:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b99:	eb ec                	jmp    803b87 <file_map+0x75>
+
+0000000000803b9b <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b9b:	55                   	push   %rbp
+  803b9c:	48 89 e5             	mov    %rsp,%rbp
+  803b9f:	41 54                	push   %r12
+  803ba1:	53                   	push   %rbx
+  803ba2:	48 83 ec 20          	sub    $0x20,%rsp
+  803ba6:	41 89 f4             	mov    %esi,%r12d
+  803ba9:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803bac:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803bb0:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  803bb7:	00 00 00 
+  803bba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bbc:	85 c0                	test   %eax,%eax
+  803bbe:	78 3c                	js     803bfc <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803bc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bc4:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803bcb:	00 00 00 
+  803bce:	8b 0a                	mov    (%rdx),%ecx
+  803bd0:	39 08                	cmp    %ecx,(%rax)
+  803bd2:	75 31                	jne    803c05 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803bd4:	8b 40 0c             	mov    0xc(%rax),%eax
+  803bd7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803bda:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803bde:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803be2:	ba 10 00 00 00       	mov    $0x10,%edx
+  803be7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803beb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803bf0:	48 b8 9e 35 80 00 00 	movabs $0x80359e,%rax
+  803bf7:	00 00 00 
+  803bfa:	ff d0                	call   *%rax
+}
+  803bfc:	48 83 c4 20          	add    $0x20,%rsp
+  803c00:	5b                   	pop    %rbx
+  803c01:	41 5c                	pop    %r12
+  803c03:	5d                   	pop    %rbp
+  803c04:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c05:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c0a:	eb f0                	jmp    803bfc <file_msync+0x61>
+
+0000000000803c0c <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803c0c:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803c10:	7f 01                	jg     803c13 <writebuf+0x7>
+  803c12:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803c13:	55                   	push   %rbp
+  803c14:	48 89 e5             	mov    %rsp,%rbp
+  803c17:	53                   	push   %rbx
+  803c18:	48 83 ec 08          	sub    $0x8,%rsp
+  803c1c:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803c1f:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803c23:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803c27:	8b 3f                	mov    (%rdi),%edi
+  803c29:	48 b8 c7 32 80 00 00 	movabs $0x8032c7,%rax
+  803c30:	00 00 00 
+  803c33:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803c35:	48 85 c0             	test   %rax,%rax
+  803c38:	7e 04                	jle    803c3e <writebuf+0x32>
+  803c3a:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803c3e:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803c42:	48 39 c2             	cmp    %rax,%rdx
+  803c45:	74 0f                	je     803c56 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803c47:	48 85 c0             	test   %rax,%rax
+  803c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c4f:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803c53:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803c56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c5a:	c9                   	leave
+  803c5b:	c3                   	ret
+
+0000000000803c5c <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803c5c:	8b 46 04             	mov    0x4(%rsi),%eax
+  803c5f:	8d 50 01             	lea    0x1(%rax),%edx
+  803c62:	89 56 04             	mov    %edx,0x4(%rsi)
+  803c65:	48 98                	cltq
+  803c67:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803c6c:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803c72:	74 01                	je     803c75 <putch+0x19>
+  803c74:	c3                   	ret
+putch(int ch, void *arg) {
+  803c75:	55                   	push   %rbp
+  803c76:	48 89 e5             	mov    %rsp,%rbp
+  803c79:	53                   	push   %rbx
+  803c7a:	48 83 ec 08          	sub    $0x8,%rsp
+  803c7e:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803c81:	48 89 f7             	mov    %rsi,%rdi
+  803c84:	48 b8 0c 3c 80 00 00 	movabs $0x803c0c,%rax
+  803c8b:	00 00 00 
+  803c8e:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c90:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c9b:	c9                   	leave
+  803c9c:	c3                   	ret
+
+0000000000803c9d <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c9d:	55                   	push   %rbp
+  803c9e:	48 89 e5             	mov    %rsp,%rbp
+  803ca1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803ca8:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803cab:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803cb1:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803cb8:	00 00 00 
+    state.result = 0;
+  803cbb:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803cc2:	00 00 00 00 
+    state.error = 1;
+  803cc6:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803ccd:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803cd0:	48 89 f2             	mov    %rsi,%rdx
+  803cd3:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803cda:	48 bf 5c 3c 80 00 00 	movabs $0x803c5c,%rdi
+  803ce1:	00 00 00 
+  803ce4:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  803ceb:	00 00 00 
+  803cee:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803cf0:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803cf7:	7f 14                	jg     803d0d <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803cf9:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803d00:	48 85 c0             	test   %rax,%rax
+  803d03:	75 06                	jne    803d0b <vfprintf+0x6e>
+  803d05:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803d0b:	c9                   	leave
+  803d0c:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803d0d:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803d14:	48 b8 0c 3c 80 00 00 	movabs $0x803c0c,%rax
+  803d1b:	00 00 00 
+  803d1e:	ff d0                	call   *%rax
+  803d20:	eb d7                	jmp    803cf9 <vfprintf+0x5c>
+
+0000000000803d22 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803d22:	55                   	push   %rbp
+  803d23:	48 89 e5             	mov    %rsp,%rbp
+  803d26:	48 83 ec 50          	sub    $0x50,%rsp
+  803d2a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d2e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d32:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d36:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d3a:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803d41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d49:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d4d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803d51:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d55:	48 b8 9d 3c 80 00 00 	movabs $0x803c9d,%rax
+  803d5c:	00 00 00 
+  803d5f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d61:	c9                   	leave
+  803d62:	c3                   	ret
+
+0000000000803d63 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803d63:	55                   	push   %rbp
+  803d64:	48 89 e5             	mov    %rsp,%rbp
+  803d67:	48 83 ec 50          	sub    $0x50,%rsp
+  803d6b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803d6f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d73:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d77:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d7b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d7f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d86:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d8e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d92:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d96:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d9a:	48 89 fe             	mov    %rdi,%rsi
+  803d9d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803da2:	48 b8 9d 3c 80 00 00 	movabs $0x803c9d,%rax
+  803da9:	00 00 00 
+  803dac:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803dae:	c9                   	leave
+  803daf:	c3                   	ret
+
+0000000000803db0 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803db0:	55                   	push   %rbp
+  803db1:	48 89 e5             	mov    %rsp,%rbp
+  803db4:	41 54                	push   %r12
+  803db6:	53                   	push   %rbx
+  803db7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dba:	48 b8 39 2e 80 00 00 	movabs $0x802e39,%rax
+  803dc1:	00 00 00 
+  803dc4:	ff d0                	call   *%rax
+  803dc6:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803dc9:	48 be 90 62 80 00 00 	movabs $0x806290,%rsi
+  803dd0:	00 00 00 
+  803dd3:	48 89 df             	mov    %rbx,%rdi
+  803dd6:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803de2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803de7:	41 2b 04 24          	sub    (%r12),%eax
+  803deb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803df1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803df8:	00 00 00 
+    stat->st_dev = &devpipe;
+  803dfb:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803e02:	00 00 00 
+  803e05:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e11:	5b                   	pop    %rbx
+  803e12:	41 5c                	pop    %r12
+  803e14:	5d                   	pop    %rbp
+  803e15:	c3                   	ret
+
+0000000000803e16 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803e16:	55                   	push   %rbp
+  803e17:	48 89 e5             	mov    %rsp,%rbp
+  803e1a:	41 54                	push   %r12
+  803e1c:	53                   	push   %rbx
+  803e1d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803e20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e25:	48 89 fe             	mov    %rdi,%rsi
+  803e28:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e2d:	49 bc 1a 28 80 00 00 	movabs $0x80281a,%r12
+  803e34:	00 00 00 
+  803e37:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803e3a:	48 89 df             	mov    %rbx,%rdi
+  803e3d:	48 b8 39 2e 80 00 00 	movabs $0x802e39,%rax
+  803e44:	00 00 00 
+  803e47:	ff d0                	call   *%rax
+  803e49:	48 89 c6             	mov    %rax,%rsi
+  803e4c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e56:	41 ff d4             	call   *%r12
+}
+  803e59:	5b                   	pop    %rbx
+  803e5a:	41 5c                	pop    %r12
+  803e5c:	5d                   	pop    %rbp
+  803e5d:	c3                   	ret
+
+0000000000803e5e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e5e:	55                   	push   %rbp
+  803e5f:	48 89 e5             	mov    %rsp,%rbp
+  803e62:	41 57                	push   %r15
+  803e64:	41 56                	push   %r14
+  803e66:	41 55                	push   %r13
+  803e68:	41 54                	push   %r12
+  803e6a:	53                   	push   %rbx
+  803e6b:	48 83 ec 18          	sub    $0x18,%rsp
+  803e6f:	49 89 fc             	mov    %rdi,%r12
+  803e72:	49 89 f5             	mov    %rsi,%r13
+  803e75:	49 89 d7             	mov    %rdx,%r15
+  803e78:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e7c:	48 b8 39 2e 80 00 00 	movabs $0x802e39,%rax
+  803e83:	00 00 00 
+  803e86:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e88:	4d 85 ff             	test   %r15,%r15
+  803e8b:	0f 84 af 00 00 00    	je     803f40 <devpipe_write+0xe2>
+  803e91:	48 89 c3             	mov    %rax,%rbx
+  803e94:	4c 89 f8             	mov    %r15,%rax
+  803e97:	4d 89 ef             	mov    %r13,%r15
+  803e9a:	4c 01 e8             	add    %r13,%rax
+  803e9d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ea1:	49 bd 10 27 80 00 00 	movabs $0x802710,%r13
+  803ea8:	00 00 00 
+            sys_yield();
+  803eab:	49 be a1 26 80 00 00 	movabs $0x8026a1,%r14
+  803eb2:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803eb5:	8b 73 04             	mov    0x4(%rbx),%esi
+  803eb8:	48 63 ce             	movslq %esi,%rcx
+  803ebb:	48 63 03             	movslq (%rbx),%rax
+  803ebe:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ec4:	48 39 c1             	cmp    %rax,%rcx
+  803ec7:	72 2e                	jb     803ef7 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ec9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ece:	48 89 da             	mov    %rbx,%rdx
+  803ed1:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ed6:	4c 89 e7             	mov    %r12,%rdi
+  803ed9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803edc:	85 c0                	test   %eax,%eax
+  803ede:	74 66                	je     803f46 <devpipe_write+0xe8>
+            sys_yield();
+  803ee0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ee3:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ee6:	48 63 ce             	movslq %esi,%rcx
+  803ee9:	48 63 03             	movslq (%rbx),%rax
+  803eec:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ef2:	48 39 c1             	cmp    %rax,%rcx
+  803ef5:	73 d2                	jae    803ec9 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803ef7:	41 0f b6 3f          	movzbl (%r15),%edi
+  803efb:	48 89 ca             	mov    %rcx,%rdx
+  803efe:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f02:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803f09:	08 10 20 
+  803f0c:	48 f7 e2             	mul    %rdx
+  803f0f:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f13:	48 89 d0             	mov    %rdx,%rax
+  803f16:	48 c1 e0 09          	shl    $0x9,%rax
+  803f1a:	48 29 d0             	sub    %rdx,%rax
+  803f1d:	48 c1 e0 03          	shl    $0x3,%rax
+  803f21:	48 29 c1             	sub    %rax,%rcx
+  803f24:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803f29:	83 c6 01             	add    $0x1,%esi
+  803f2c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f2f:	49 83 c7 01          	add    $0x1,%r15
+  803f33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f37:	49 39 c7             	cmp    %rax,%r15
+  803f3a:	0f 85 75 ff ff ff    	jne    803eb5 <devpipe_write+0x57>
+    return n;
+  803f40:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f44:	eb 05                	jmp    803f4b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803f46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f4b:	48 83 c4 18          	add    $0x18,%rsp
+  803f4f:	5b                   	pop    %rbx
+  803f50:	41 5c                	pop    %r12
+  803f52:	41 5d                	pop    %r13
+  803f54:	41 5e                	pop    %r14
+  803f56:	41 5f                	pop    %r15
+  803f58:	5d                   	pop    %rbp
+  803f59:	c3                   	ret
+
+0000000000803f5a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f5a:	55                   	push   %rbp
+  803f5b:	48 89 e5             	mov    %rsp,%rbp
+  803f5e:	41 57                	push   %r15
+  803f60:	41 56                	push   %r14
+  803f62:	41 55                	push   %r13
+  803f64:	41 54                	push   %r12
+  803f66:	53                   	push   %rbx
+  803f67:	48 83 ec 18          	sub    $0x18,%rsp
+  803f6b:	49 89 fc             	mov    %rdi,%r12
+  803f6e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f72:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f76:	48 b8 39 2e 80 00 00 	movabs $0x802e39,%rax
+  803f7d:	00 00 00 
+  803f80:	ff d0                	call   *%rax
+  803f82:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803f85:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f8b:	49 bd 10 27 80 00 00 	movabs $0x802710,%r13
+  803f92:	00 00 00 
+            sys_yield();
+  803f95:	49 be a1 26 80 00 00 	movabs $0x8026a1,%r14
+  803f9c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f9f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803fa4:	74 7d                	je     804023 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803fa6:	8b 03                	mov    (%rbx),%eax
+  803fa8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803fab:	75 26                	jne    803fd3 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803fad:	4d 85 ff             	test   %r15,%r15
+  803fb0:	75 77                	jne    804029 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fb2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803fb7:	48 89 da             	mov    %rbx,%rdx
+  803fba:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fbf:	4c 89 e7             	mov    %r12,%rdi
+  803fc2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803fc5:	85 c0                	test   %eax,%eax
+  803fc7:	74 72                	je     80403b <devpipe_read+0xe1>
+            sys_yield();
+  803fc9:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803fcc:	8b 03                	mov    (%rbx),%eax
+  803fce:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803fd1:	74 df                	je     803fb2 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803fd3:	48 63 c8             	movslq %eax,%rcx
+  803fd6:	48 89 ca             	mov    %rcx,%rdx
+  803fd9:	48 c1 ea 03          	shr    $0x3,%rdx
+  803fdd:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803fe4:	08 10 20 
+  803fe7:	48 89 d0             	mov    %rdx,%rax
+  803fea:	48 f7 e6             	mul    %rsi
+  803fed:	48 c1 ea 06          	shr    $0x6,%rdx
+  803ff1:	48 89 d0             	mov    %rdx,%rax
+  803ff4:	48 c1 e0 09          	shl    $0x9,%rax
+  803ff8:	48 29 d0             	sub    %rdx,%rax
+  803ffb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804002:	00 
+  804003:	48 89 c8             	mov    %rcx,%rax
+  804006:	48 29 d0             	sub    %rdx,%rax
+  804009:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80400e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804012:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804016:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804019:	49 83 c7 01          	add    $0x1,%r15
+  80401d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804021:	75 83                	jne    803fa6 <devpipe_read+0x4c>
+    return n;
+  804023:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804027:	eb 03                	jmp    80402c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804029:	4c 89 f8             	mov    %r15,%rax
+}
+  80402c:	48 83 c4 18          	add    $0x18,%rsp
+  804030:	5b                   	pop    %rbx
+  804031:	41 5c                	pop    %r12
+  804033:	41 5d                	pop    %r13
+  804035:	41 5e                	pop    %r14
+  804037:	41 5f                	pop    %r15
+  804039:	5d                   	pop    %rbp
+  80403a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80403b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804040:	eb ea                	jmp    80402c <devpipe_read+0xd2>
+
+0000000000804042 <pipe>:
+pipe(int pfd[2]) {
+  804042:	55                   	push   %rbp
+  804043:	48 89 e5             	mov    %rsp,%rbp
+  804046:	41 55                	push   %r13
+  804048:	41 54                	push   %r12
+  80404a:	53                   	push   %rbx
+  80404b:	48 83 ec 18          	sub    $0x18,%rsp
+  80404f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804052:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804056:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  80405d:	00 00 00 
+  804060:	ff d0                	call   *%rax
+  804062:	89 c3                	mov    %eax,%ebx
+  804064:	85 c0                	test   %eax,%eax
+  804066:	0f 88 a0 01 00 00    	js     80420c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80406c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804071:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804076:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80407a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80407f:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  804086:	00 00 00 
+  804089:	ff d0                	call   *%rax
+  80408b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80408d:	85 c0                	test   %eax,%eax
+  80408f:	0f 88 77 01 00 00    	js     80420c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804095:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804099:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  8040a0:	00 00 00 
+  8040a3:	ff d0                	call   *%rax
+  8040a5:	89 c3                	mov    %eax,%ebx
+  8040a7:	85 c0                	test   %eax,%eax
+  8040a9:	0f 88 43 01 00 00    	js     8041f2 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8040af:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040b9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8040bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c2:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  8040c9:	00 00 00 
+  8040cc:	ff d0                	call   *%rax
+  8040ce:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8040d0:	85 c0                	test   %eax,%eax
+  8040d2:	0f 88 1a 01 00 00    	js     8041f2 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8040d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040dc:	48 b8 39 2e 80 00 00 	movabs $0x802e39,%rax
+  8040e3:	00 00 00 
+  8040e6:	ff d0                	call   *%rax
+  8040e8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8040eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040f5:	48 89 c6             	mov    %rax,%rsi
+  8040f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040fd:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  804104:	00 00 00 
+  804107:	ff d0                	call   *%rax
+  804109:	89 c3                	mov    %eax,%ebx
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	0f 88 c5 00 00 00    	js     8041d8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804113:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804117:	48 b8 39 2e 80 00 00 	movabs $0x802e39,%rax
+  80411e:	00 00 00 
+  804121:	ff d0                	call   *%rax
+  804123:	48 89 c1             	mov    %rax,%rcx
+  804126:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80412c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804132:	ba 00 00 00 00       	mov    $0x0,%edx
+  804137:	4c 89 ee             	mov    %r13,%rsi
+  80413a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413f:	48 b8 af 27 80 00 00 	movabs $0x8027af,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+  80414b:	89 c3                	mov    %eax,%ebx
+  80414d:	85 c0                	test   %eax,%eax
+  80414f:	78 6e                	js     8041bf <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804151:	be 00 10 00 00       	mov    $0x1000,%esi
+  804156:	4c 89 ef             	mov    %r13,%rdi
+  804159:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  804160:	00 00 00 
+  804163:	ff d0                	call   *%rax
+  804165:	83 f8 02             	cmp    $0x2,%eax
+  804168:	0f 85 ab 00 00 00    	jne    804219 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80416e:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804175:	00 00 
+  804177:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80417b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80417d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804181:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804188:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80418c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80418e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804192:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804199:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80419d:	48 bb 27 2e 80 00 00 	movabs $0x802e27,%rbx
+  8041a4:	00 00 00 
+  8041a7:	ff d3                	call   *%rbx
+  8041a9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8041ad:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8041b1:	ff d3                	call   *%rbx
+  8041b3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8041b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041bd:	eb 4d                	jmp    80420c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8041bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041c4:	4c 89 ee             	mov    %r13,%rsi
+  8041c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041cc:	48 b8 1a 28 80 00 00 	movabs $0x80281a,%rax
+  8041d3:	00 00 00 
+  8041d6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8041d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041dd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8041e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041e6:	48 b8 1a 28 80 00 00 	movabs $0x80281a,%rax
+  8041ed:	00 00 00 
+  8041f0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8041f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041f7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8041fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804200:	48 b8 1a 28 80 00 00 	movabs $0x80281a,%rax
+  804207:	00 00 00 
+  80420a:	ff d0                	call   *%rax
+}
+  80420c:	89 d8                	mov    %ebx,%eax
+  80420e:	48 83 c4 18          	add    $0x18,%rsp
+  804212:	5b                   	pop    %rbx
+  804213:	41 5c                	pop    %r12
+  804215:	41 5d                	pop    %r13
+  804217:	5d                   	pop    %rbp
+  804218:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804219:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  804220:	00 00 00 
+  804223:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80422a:	00 00 00 
+  80422d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804232:	48 bf 97 62 80 00 00 	movabs $0x806297,%rdi
+  804239:	00 00 00 
+  80423c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804241:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  804248:	00 00 00 
+  80424b:	41 ff d0             	call   *%r8
+
+000000000080424e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80424e:	55                   	push   %rbp
+  80424f:	48 89 e5             	mov    %rsp,%rbp
+  804252:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804256:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80425a:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  804261:	00 00 00 
+  804264:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804266:	85 c0                	test   %eax,%eax
+  804268:	78 35                	js     80429f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80426a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80426e:	48 b8 39 2e 80 00 00 	movabs $0x802e39,%rax
+  804275:	00 00 00 
+  804278:	ff d0                	call   *%rax
+  80427a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80427d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804282:	be 00 10 00 00       	mov    $0x1000,%esi
+  804287:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80428b:	48 b8 10 27 80 00 00 	movabs $0x802710,%rax
+  804292:	00 00 00 
+  804295:	ff d0                	call   *%rax
+  804297:	85 c0                	test   %eax,%eax
+  804299:	0f 94 c0             	sete   %al
+  80429c:	0f b6 c0             	movzbl %al,%eax
+}
+  80429f:	c9                   	leave
+  8042a0:	c3                   	ret
+
+00000000008042a1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042a1:	48 89 f8             	mov    %rdi,%rax
+  8042a4:	48 c1 e8 27          	shr    $0x27,%rax
+  8042a8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042af:	01 00 00 
+  8042b2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042b6:	f6 c2 01             	test   $0x1,%dl
+  8042b9:	74 6d                	je     804328 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042bb:	48 89 f8             	mov    %rdi,%rax
+  8042be:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042c2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042c9:	01 00 00 
+  8042cc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042d0:	f6 c2 01             	test   $0x1,%dl
+  8042d3:	74 62                	je     804337 <get_uvpt_entry+0x96>
+  8042d5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042dc:	01 00 00 
+  8042df:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042e3:	f6 c2 80             	test   $0x80,%dl
+  8042e6:	75 4f                	jne    804337 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042e8:	48 89 f8             	mov    %rdi,%rax
+  8042eb:	48 c1 e8 15          	shr    $0x15,%rax
+  8042ef:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042f6:	01 00 00 
+  8042f9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042fd:	f6 c2 01             	test   $0x1,%dl
+  804300:	74 44                	je     804346 <get_uvpt_entry+0xa5>
+  804302:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804309:	01 00 00 
+  80430c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804310:	f6 c2 80             	test   $0x80,%dl
+  804313:	75 31                	jne    804346 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804315:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804319:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804320:	01 00 00 
+  804323:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804327:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804328:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80432f:	01 00 00 
+  804332:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804336:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804337:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80433e:	01 00 00 
+  804341:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804345:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804346:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80434d:	01 00 00 
+  804350:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804354:	c3                   	ret
+
+0000000000804355 <get_prot>:
+
+int
+get_prot(void *va) {
+  804355:	55                   	push   %rbp
+  804356:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804359:	48 b8 a1 42 80 00 00 	movabs $0x8042a1,%rax
+  804360:	00 00 00 
+  804363:	ff d0                	call   *%rax
+  804365:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804368:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80436d:	89 c1                	mov    %eax,%ecx
+  80436f:	83 c9 04             	or     $0x4,%ecx
+  804372:	f6 c2 01             	test   $0x1,%dl
+  804375:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804378:	89 c1                	mov    %eax,%ecx
+  80437a:	83 c9 02             	or     $0x2,%ecx
+  80437d:	f6 c2 02             	test   $0x2,%dl
+  804380:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804383:	89 c1                	mov    %eax,%ecx
+  804385:	83 c9 01             	or     $0x1,%ecx
+  804388:	48 85 d2             	test   %rdx,%rdx
+  80438b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80438e:	89 c1                	mov    %eax,%ecx
+  804390:	83 c9 40             	or     $0x40,%ecx
+  804393:	f6 c6 04             	test   $0x4,%dh
+  804396:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804399:	5d                   	pop    %rbp
+  80439a:	c3                   	ret
+
+000000000080439b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80439b:	55                   	push   %rbp
+  80439c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80439f:	48 b8 a1 42 80 00 00 	movabs $0x8042a1,%rax
+  8043a6:	00 00 00 
+  8043a9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8043ab:	48 c1 e8 06          	shr    $0x6,%rax
+  8043af:	83 e0 01             	and    $0x1,%eax
+}
+  8043b2:	5d                   	pop    %rbp
+  8043b3:	c3                   	ret
+
+00000000008043b4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8043b4:	55                   	push   %rbp
+  8043b5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8043b8:	48 b8 a1 42 80 00 00 	movabs $0x8042a1,%rax
+  8043bf:	00 00 00 
+  8043c2:	ff d0                	call   *%rax
+  8043c4:	83 e0 01             	and    $0x1,%eax
+}
+  8043c7:	5d                   	pop    %rbp
+  8043c8:	c3                   	ret
+
+00000000008043c9 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8043c9:	55                   	push   %rbp
+  8043ca:	48 89 e5             	mov    %rsp,%rbp
+  8043cd:	41 57                	push   %r15
+  8043cf:	41 56                	push   %r14
+  8043d1:	41 55                	push   %r13
+  8043d3:	41 54                	push   %r12
+  8043d5:	53                   	push   %rbx
+  8043d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8043da:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8043de:	48 85 ff             	test   %rdi,%rdi
+  8043e1:	74 1e                	je     804401 <foreach_shared_region+0x38>
+  8043e3:	49 89 ff             	mov    %rdi,%r15
+  8043e6:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8043ec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8043f2:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8043f9:	01 00 00 
+  8043fc:	e9 72 02 00 00       	jmp    804673 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804401:	48 b9 cc 62 80 00 00 	movabs $0x8062cc,%rcx
+  804408:	00 00 00 
+  80440b:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804412:	00 00 00 
+  804415:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80441a:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  804421:	00 00 00 
+  804424:	b8 00 00 00 00       	mov    $0x0,%eax
+  804429:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  804430:	00 00 00 
+  804433:	41 ff d0             	call   *%r8
+  804436:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80443d:	eb 6c                	jmp    8044ab <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80443f:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804446:	ff ff ff 
+  804449:	4c 21 e2             	and    %r12,%rdx
+  80444c:	48 89 d8             	mov    %rbx,%rax
+  80444f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804454:	48 83 c0 01          	add    $0x1,%rax
+  804458:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80445c:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804463:	00 00 00 
+  804466:	48 21 c8             	and    %rcx,%rax
+  804469:	48 09 d0             	or     %rdx,%rax
+  80446c:	49 89 c4             	mov    %rax,%r12
+  80446f:	eb 30                	jmp    8044a1 <foreach_shared_region+0xd8>
+  804471:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804478:	ff ff ff 
+  80447b:	4c 21 e2             	and    %r12,%rdx
+  80447e:	48 89 d8             	mov    %rbx,%rax
+  804481:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804486:	48 83 c0 01          	add    $0x1,%rax
+  80448a:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80448e:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804495:	00 00 00 
+  804498:	48 21 c8             	and    %rcx,%rax
+  80449b:	48 09 d0             	or     %rdx,%rax
+  80449e:	49 89 c4             	mov    %rax,%r12
+  8044a1:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8044a5:	0f 84 99 01 00 00    	je     804644 <foreach_shared_region+0x27b>
+  8044ab:	4c 89 e3             	mov    %r12,%rbx
+  8044ae:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8044b2:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8044b9:	01 00 00 
+  8044bc:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044c0:	a8 01                	test   $0x1,%al
+  8044c2:	0f 84 77 ff ff ff    	je     80443f <foreach_shared_region+0x76>
+  8044c8:	a8 80                	test   $0x80,%al
+  8044ca:	74 19                	je     8044e5 <foreach_shared_region+0x11c>
+  8044cc:	f6 c4 04             	test   $0x4,%ah
+  8044cf:	74 a0                	je     804471 <foreach_shared_region+0xa8>
+  8044d1:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8044d8:	40 
+  8044d9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044dd:	4c 89 e7             	mov    %r12,%rdi
+  8044e0:	41 ff d7             	call   *%r15
+  8044e3:	eb 8c                	jmp    804471 <foreach_shared_region+0xa8>
+  8044e5:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8044ec:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8044f0:	eb 46                	jmp    804538 <foreach_shared_region+0x16f>
+  8044f2:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8044f9:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044ff:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804503:	48 c1 e0 15          	shl    $0x15,%rax
+  804507:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80450c:	49 09 c4             	or     %rax,%r12
+  80450f:	eb 1d                	jmp    80452e <foreach_shared_region+0x165>
+  804511:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804518:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80451e:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804522:	48 c1 e0 15          	shl    $0x15,%rax
+  804526:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80452b:	49 09 c4             	or     %rax,%r12
+  80452e:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804532:	0f 84 d3 00 00 00    	je     80460b <foreach_shared_region+0x242>
+  804538:	4c 89 e3             	mov    %r12,%rbx
+  80453b:	48 c1 eb 15          	shr    $0x15,%rbx
+  80453f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804546:	01 00 00 
+  804549:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80454d:	a8 01                	test   $0x1,%al
+  80454f:	74 a1                	je     8044f2 <foreach_shared_region+0x129>
+  804551:	a8 80                	test   $0x80,%al
+  804553:	74 19                	je     80456e <foreach_shared_region+0x1a5>
+  804555:	f6 c4 04             	test   $0x4,%ah
+  804558:	74 b7                	je     804511 <foreach_shared_region+0x148>
+  80455a:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804561:	00 
+  804562:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804566:	4c 89 e7             	mov    %r12,%rdi
+  804569:	41 ff d7             	call   *%r15
+  80456c:	eb a3                	jmp    804511 <foreach_shared_region+0x148>
+  80456e:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804574:	eb 3b                	jmp    8045b1 <foreach_shared_region+0x1e8>
+  804576:	f6 c4 04             	test   $0x4,%ah
+  804579:	74 12                	je     80458d <foreach_shared_region+0x1c4>
+  80457b:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804582:	00 
+  804583:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804587:	4c 89 e7             	mov    %r12,%rdi
+  80458a:	41 ff d7             	call   *%r15
+  80458d:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804594:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80459a:	48 83 c3 01          	add    $0x1,%rbx
+  80459e:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8045a2:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8045a8:	49 09 dc             	or     %rbx,%r12
+  8045ab:	41 83 ed 01          	sub    $0x1,%r13d
+  8045af:	74 2f                	je     8045e0 <foreach_shared_region+0x217>
+  8045b1:	4c 89 e3             	mov    %r12,%rbx
+  8045b4:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8045b8:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8045bc:	a8 01                	test   $0x1,%al
+  8045be:	75 b6                	jne    804576 <foreach_shared_region+0x1ad>
+  8045c0:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8045c7:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8045cd:	48 83 c3 01          	add    $0x1,%rbx
+  8045d1:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8045d5:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8045db:	49 09 dc             	or     %rbx,%r12
+  8045de:	eb cb                	jmp    8045ab <foreach_shared_region+0x1e2>
+  8045e0:	4c 89 e0             	mov    %r12,%rax
+  8045e3:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8045e9:	49 c1 ec 15          	shr    $0x15,%r12
+  8045ed:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8045f4:	49 83 c4 01          	add    $0x1,%r12
+  8045f8:	49 c1 e4 15          	shl    $0x15,%r12
+  8045fc:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804603:	49 09 c4             	or     %rax,%r12
+  804606:	e9 23 ff ff ff       	jmp    80452e <foreach_shared_region+0x165>
+  80460b:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80460f:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804616:	ff ff ff 
+  804619:	4c 21 e0             	and    %r12,%rax
+  80461c:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804620:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804627:	49 83 c4 01          	add    $0x1,%r12
+  80462b:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80462f:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804636:	00 00 00 
+  804639:	49 21 d4             	and    %rdx,%r12
+  80463c:	49 09 c4             	or     %rax,%r12
+  80463f:	e9 5d fe ff ff       	jmp    8044a1 <foreach_shared_region+0xd8>
+  804644:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80464b:	00 ff ff 
+  80464e:	4c 21 e0             	and    %r12,%rax
+  804651:	49 c1 ec 27          	shr    $0x27,%r12
+  804655:	49 83 c4 01          	add    $0x1,%r12
+  804659:	49 c1 e4 27          	shl    $0x27,%r12
+  80465d:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804664:	ff 00 00 
+  804667:	49 21 d4             	and    %rdx,%r12
+  80466a:	49 09 c4             	or     %rax,%r12
+  80466d:	41 83 ed 01          	sub    $0x1,%r13d
+  804671:	74 48                	je     8046bb <foreach_shared_region+0x2f2>
+  804673:	4c 89 e0             	mov    %r12,%rax
+  804676:	48 c1 e8 27          	shr    $0x27,%rax
+  80467a:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804681:	01 00 00 
+  804684:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804688:	f6 c2 01             	test   $0x1,%dl
+  80468b:	0f 85 a5 fd ff ff    	jne    804436 <foreach_shared_region+0x6d>
+  804691:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804698:	00 ff ff 
+  80469b:	4c 21 e2             	and    %r12,%rdx
+  80469e:	48 83 c0 01          	add    $0x1,%rax
+  8046a2:	48 c1 e0 27          	shl    $0x27,%rax
+  8046a6:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8046ad:	ff 00 00 
+  8046b0:	48 21 c8             	and    %rcx,%rax
+  8046b3:	48 09 d0             	or     %rdx,%rax
+  8046b6:	49 89 c4             	mov    %rax,%r12
+  8046b9:	eb b2                	jmp    80466d <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8046bb:	4d 85 e4             	test   %r12,%r12
+  8046be:	75 14                	jne    8046d4 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8046c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c5:	48 83 c4 28          	add    $0x28,%rsp
+  8046c9:	5b                   	pop    %rbx
+  8046ca:	41 5c                	pop    %r12
+  8046cc:	41 5d                	pop    %r13
+  8046ce:	41 5e                	pop    %r14
+  8046d0:	41 5f                	pop    %r15
+  8046d2:	5d                   	pop    %rbp
+  8046d3:	c3                   	ret
+    assert(addr == 0);
+  8046d4:	48 b9 db 62 80 00 00 	movabs $0x8062db,%rcx
+  8046db:	00 00 00 
+  8046de:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8046e5:	00 00 00 
+  8046e8:	be 67 00 00 00       	mov    $0x67,%esi
+  8046ed:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  8046f4:	00 00 00 
+  8046f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fc:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  804703:	00 00 00 
+  804706:	41 ff d0             	call   *%r8
+
+0000000000804709 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804709:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804710:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804713:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804719:	eb 33                	jmp    80474e <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80471b:	48 83 c0 20          	add    $0x20,%rax
+  80471f:	4c 39 c0             	cmp    %r8,%rax
+  804722:	74 25                	je     804749 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804724:	48 8b 10             	mov    (%rax),%rdx
+  804727:	48 85 d2             	test   %rdx,%rdx
+  80472a:	74 ef                	je     80471b <mmap_place+0x12>
+  80472c:	48 89 d1             	mov    %rdx,%rcx
+  80472f:	48 03 48 08          	add    0x8(%rax),%rcx
+  804733:	48 39 cf             	cmp    %rcx,%rdi
+  804736:	73 e3                	jae    80471b <mmap_place+0x12>
+  804738:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80473c:	4c 39 ca             	cmp    %r9,%rdx
+  80473f:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804743:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804747:	eb d2                	jmp    80471b <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804749:	45 84 d2             	test   %r10b,%r10b
+  80474c:	74 12                	je     804760 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80474e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804755:	00 00 00 
+        moved = 0;
+  804758:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  80475e:	eb c4                	jmp    804724 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804760:	48 01 fe             	add    %rdi,%rsi
+  804763:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  80476a:	00 00 00 
+  80476d:	48 39 f0             	cmp    %rsi,%rax
+  804770:	b8 00 00 00 00       	mov    $0x0,%eax
+  804775:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804779:	c3                   	ret
+
+000000000080477a <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  80477a:	55                   	push   %rbp
+  80477b:	48 89 e5             	mov    %rsp,%rbp
+  80477e:	41 57                	push   %r15
+  804780:	41 56                	push   %r14
+  804782:	41 55                	push   %r13
+  804784:	41 54                	push   %r12
+  804786:	53                   	push   %rbx
+  804787:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80478b:	48 8b 1f             	mov    (%rdi),%rbx
+  80478e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804795:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80479c:	00 00 00 
+  80479f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047a4:	eb 12                	jmp    8047b8 <mmap_pgfault+0x3e>
+  8047a6:	48 83 c2 01          	add    $0x1,%rdx
+  8047aa:	48 83 c0 20          	add    $0x20,%rax
+  8047ae:	48 83 fa 20          	cmp    $0x20,%rdx
+  8047b2:	0f 84 04 01 00 00    	je     8048bc <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8047b8:	48 8b 08             	mov    (%rax),%rcx
+  8047bb:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8047bf:	48 39 de             	cmp    %rbx,%rsi
+  8047c2:	73 e2                	jae    8047a6 <mmap_pgfault+0x2c>
+  8047c4:	48 03 48 08          	add    0x8(%rax),%rcx
+  8047c8:	48 39 cb             	cmp    %rcx,%rbx
+  8047cb:	73 d9                	jae    8047a6 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8047cd:	48 c1 e2 05          	shl    $0x5,%rdx
+  8047d1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8047d8:	00 00 00 
+  8047db:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8047df:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8047e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8047e7:	f6 c2 01             	test   $0x1,%dl
+  8047ea:	0f 84 e0 00 00 00    	je     8048d0 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  8047f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f5:	f6 c2 02             	test   $0x2,%dl
+  8047f8:	0f 84 c3 00 00 00    	je     8048c1 <mmap_pgfault+0x147>
+  8047fe:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804805:	ff ff ff 
+  804808:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80480c:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804813:	00 00 00 
+  804816:	48 39 ca             	cmp    %rcx,%rdx
+  804819:	0f 85 a2 00 00 00    	jne    8048c1 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80481f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804824:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804829:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804830:	00 00 00 
+  804833:	bf 00 00 00 00       	mov    $0x0,%edi
+  804838:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  80483f:	00 00 00 
+  804842:	ff d0                	call   *%rax
+  804844:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80484b:	85 d2                	test   %edx,%edx
+  80484d:	78 72                	js     8048c1 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  80484f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804854:	48 89 de             	mov    %rbx,%rsi
+  804857:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  80485e:	00 00 00 
+  804861:	4c 89 e7             	mov    %r12,%rdi
+  804864:	48 b8 94 23 80 00 00 	movabs $0x802394,%rax
+  80486b:	00 00 00 
+  80486e:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804870:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804876:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80487c:	48 89 d9             	mov    %rbx,%rcx
+  80487f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804884:	4c 89 e6             	mov    %r12,%rsi
+  804887:	bf 00 00 00 00       	mov    $0x0,%edi
+  80488c:	48 b8 af 27 80 00 00 	movabs $0x8027af,%rax
+  804893:	00 00 00 
+  804896:	ff d0                	call   *%rax
+  804898:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  80489a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80489f:	4c 89 e6             	mov    %r12,%rsi
+  8048a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048a7:	48 b8 1a 28 80 00 00 	movabs $0x80281a,%rax
+  8048ae:	00 00 00 
+  8048b1:	ff d0                	call   *%rax
+    return res >= 0;
+  8048b3:	89 d8                	mov    %ebx,%eax
+  8048b5:	f7 d0                	not    %eax
+  8048b7:	c1 e8 1f             	shr    $0x1f,%eax
+  8048ba:	eb 05                	jmp    8048c1 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  8048bc:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  8048c1:	48 83 c4 18          	add    $0x18,%rsp
+  8048c5:	5b                   	pop    %rbx
+  8048c6:	41 5c                	pop    %r12
+  8048c8:	41 5d                	pop    %r13
+  8048ca:	41 5e                	pop    %r14
+  8048cc:	41 5f                	pop    %r15
+  8048ce:	5d                   	pop    %rbp
+  8048cf:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  8048d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048d4:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  8048d8:	4c 03 30             	add    (%rax),%r14
+  8048db:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  8048e2:	49 39 c6             	cmp    %rax,%r14
+  8048e5:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  8048e9:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  8048f0:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  8048f6:	49 bf b4 43 80 00 00 	movabs $0x8043b4,%r15
+  8048fd:	00 00 00 
+  804900:	4d 39 f4             	cmp    %r14,%r12
+  804903:	73 1d                	jae    804922 <mmap_pgfault+0x1a8>
+  804905:	4c 89 e7             	mov    %r12,%rdi
+  804908:	41 ff d7             	call   *%r15
+  80490b:	84 c0                	test   %al,%al
+  80490d:	75 13                	jne    804922 <mmap_pgfault+0x1a8>
+  80490f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804916:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80491d:	4d 39 f4             	cmp    %r14,%r12
+  804920:	72 e3                	jb     804905 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804922:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804928:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80492c:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804930:	74 2a                	je     80495c <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804932:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804936:	89 de                	mov    %ebx,%esi
+  804938:	2b 30                	sub    (%rax),%esi
+  80493a:	03 70 1c             	add    0x1c(%rax),%esi
+  80493d:	8b 78 18             	mov    0x18(%rax),%edi
+  804940:	4c 89 e9             	mov    %r13,%rcx
+  804943:	48 89 da             	mov    %rbx,%rdx
+  804946:	48 b8 12 3b 80 00 00 	movabs $0x803b12,%rax
+  80494d:	00 00 00 
+  804950:	ff d0                	call   *%rax
+    return res > 0;
+  804952:	85 c0                	test   %eax,%eax
+  804954:	0f 9f c0             	setg   %al
+  804957:	e9 65 ff ff ff       	jmp    8048c1 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80495c:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804960:	eb d0                	jmp    804932 <mmap_pgfault+0x1b8>
+
+0000000000804962 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804962:	55                   	push   %rbp
+  804963:	48 89 e5             	mov    %rsp,%rbp
+  804966:	41 57                	push   %r15
+  804968:	41 56                	push   %r14
+  80496a:	41 55                	push   %r13
+  80496c:	41 54                	push   %r12
+  80496e:	53                   	push   %rbx
+  80496f:	48 83 ec 28          	sub    $0x28,%rsp
+  804973:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804977:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  80497a:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804981:	ff ff ff 
+  804984:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804988:	b8 00 00 00 00       	mov    $0x0,%eax
+  80498d:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804994:	00 00 00 
+  804997:	48 39 ca             	cmp    %rcx,%rdx
+  80499a:	0f 85 e5 00 00 00    	jne    804a85 <mmap_writeback+0x123>
+  8049a0:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8049a3:	4c 39 ee             	cmp    %r13,%rsi
+  8049a6:	0f 83 e8 00 00 00    	jae    804a94 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8049ac:	49 be b4 43 80 00 00 	movabs $0x8043b4,%r14
+  8049b3:	00 00 00 
+  8049b6:	49 bf 9b 43 80 00 00 	movabs $0x80439b,%r15
+  8049bd:	00 00 00 
+  8049c0:	eb 10                	jmp    8049d2 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  8049c2:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  8049c9:	4d 39 ec             	cmp    %r13,%r12
+  8049cc:	0f 83 ae 00 00 00    	jae    804a80 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8049d2:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8049d6:	4c 89 e7             	mov    %r12,%rdi
+  8049d9:	41 ff d6             	call   *%r14
+  8049dc:	84 c0                	test   %al,%al
+  8049de:	74 e2                	je     8049c2 <mmap_writeback+0x60>
+  8049e0:	4c 89 e7             	mov    %r12,%rdi
+  8049e3:	41 ff d7             	call   *%r15
+  8049e6:	84 c0                	test   %al,%al
+  8049e8:	74 d8                	je     8049c2 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8049ea:	4c 89 e3             	mov    %r12,%rbx
+  8049ed:	4d 39 ec             	cmp    %r13,%r12
+  8049f0:	73 20                	jae    804a12 <mmap_writeback+0xb0>
+  8049f2:	48 89 df             	mov    %rbx,%rdi
+  8049f5:	41 ff d6             	call   *%r14
+  8049f8:	84 c0                	test   %al,%al
+  8049fa:	74 16                	je     804a12 <mmap_writeback+0xb0>
+  8049fc:	48 89 df             	mov    %rbx,%rdi
+  8049ff:	41 ff d7             	call   *%r15
+  804a02:	84 c0                	test   %al,%al
+  804a04:	74 0c                	je     804a12 <mmap_writeback+0xb0>
+  804a06:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804a0d:	4c 39 eb             	cmp    %r13,%rbx
+  804a10:	72 e0                	jb     8049f2 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804a12:	48 89 d9             	mov    %rbx,%rcx
+  804a15:	4c 29 e1             	sub    %r12,%rcx
+  804a18:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804a1c:	44 89 e6             	mov    %r12d,%esi
+  804a1f:	2b 30                	sub    (%rax),%esi
+  804a21:	49 89 c4             	mov    %rax,%r12
+  804a24:	03 70 1c             	add    0x1c(%rax),%esi
+  804a27:	8b 78 18             	mov    0x18(%rax),%edi
+  804a2a:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804a2e:	48 89 ca             	mov    %rcx,%rdx
+  804a31:	48 b8 9b 3b 80 00 00 	movabs $0x803b9b,%rax
+  804a38:	00 00 00 
+  804a3b:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804a3d:	85 c0                	test   %eax,%eax
+  804a3f:	78 44                	js     804a85 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804a41:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804a46:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804a49:	41 89 c1             	mov    %eax,%r9d
+  804a4c:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804a53:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804a57:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804a5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a60:	48 89 ce             	mov    %rcx,%rsi
+  804a63:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a68:	48 b8 af 27 80 00 00 	movabs $0x8027af,%rax
+  804a6f:	00 00 00 
+  804a72:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804a74:	85 c0                	test   %eax,%eax
+  804a76:	78 0d                	js     804a85 <mmap_writeback+0x123>
+  804a78:	49 89 dc             	mov    %rbx,%r12
+  804a7b:	e9 49 ff ff ff       	jmp    8049c9 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804a80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a85:	48 83 c4 28          	add    $0x28,%rsp
+  804a89:	5b                   	pop    %rbx
+  804a8a:	41 5c                	pop    %r12
+  804a8c:	41 5d                	pop    %r13
+  804a8e:	41 5e                	pop    %r14
+  804a90:	41 5f                	pop    %r15
+  804a92:	5d                   	pop    %rbp
+  804a93:	c3                   	ret
+    return 0;
+  804a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a99:	eb ea                	jmp    804a85 <mmap_writeback+0x123>
+
+0000000000804a9b <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a9b:	55                   	push   %rbp
+  804a9c:	48 89 e5             	mov    %rsp,%rbp
+  804a9f:	41 57                	push   %r15
+  804aa1:	41 56                	push   %r14
+  804aa3:	41 55                	push   %r13
+  804aa5:	41 54                	push   %r12
+  804aa7:	53                   	push   %rbx
+  804aa8:	48 83 ec 38          	sub    $0x38,%rsp
+  804aac:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804ab0:	48 85 f6             	test   %rsi,%rsi
+  804ab3:	0f 84 0c 02 00 00    	je     804cc5 <mmap+0x22a>
+  804ab9:	49 89 ff             	mov    %rdi,%r15
+  804abc:	49 89 f4             	mov    %rsi,%r12
+  804abf:	41 89 d5             	mov    %edx,%r13d
+  804ac2:	41 89 ce             	mov    %ecx,%r14d
+  804ac5:	44 89 cb             	mov    %r9d,%ebx
+  804ac8:	45 85 c9             	test   %r9d,%r9d
+  804acb:	0f 88 f4 01 00 00    	js     804cc5 <mmap+0x22a>
+  804ad1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ad8:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804adf:	0f 85 e7 01 00 00    	jne    804ccc <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804ae5:	83 e2 fd             	and    $0xfffffffd,%edx
+  804ae8:	83 fa 04             	cmp    $0x4,%edx
+  804aeb:	0f 85 db 01 00 00    	jne    804ccc <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804af1:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804af4:	83 fa 01             	cmp    $0x1,%edx
+  804af7:	0f 87 cf 01 00 00    	ja     804ccc <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804afd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804b01:	44 89 c7             	mov    %r8d,%edi
+  804b04:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  804b0b:	00 00 00 
+  804b0e:	ff d0                	call   *%rax
+  804b10:	89 c2                	mov    %eax,%edx
+  804b12:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b19:	85 d2                	test   %edx,%edx
+  804b1b:	0f 88 ab 01 00 00    	js     804ccc <mmap+0x231>
+  804b21:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b25:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804b2c:	00 00 00 
+  804b2f:	8b 09                	mov    (%rcx),%ecx
+  804b31:	39 0a                	cmp    %ecx,(%rdx)
+  804b33:	0f 85 93 01 00 00    	jne    804ccc <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804b39:	8b 52 08             	mov    0x8(%rdx),%edx
+  804b3c:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804b3f:	83 fa 01             	cmp    $0x1,%edx
+  804b42:	0f 84 84 01 00 00    	je     804ccc <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b48:	41 83 fe 01          	cmp    $0x1,%r14d
+  804b4c:	74 42                	je     804b90 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804b4e:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804b55:	4c 89 e6             	mov    %r12,%rsi
+  804b58:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804b5f:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804b63:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804b67:	4d 85 ff             	test   %r15,%r15
+  804b6a:	74 67                	je     804bd3 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b6c:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804b73:	75 0f                	jne    804b84 <mmap+0xe9>
+  804b75:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804b7c:	00 00 00 
+  804b7f:	49 39 c7             	cmp    %rax,%r15
+  804b82:	77 1b                	ja     804b9f <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b84:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b8b:	e9 3c 01 00 00       	jmp    804ccc <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b90:	41 f6 c5 02          	test   $0x2,%r13b
+  804b94:	74 b8                	je     804b4e <mmap+0xb3>
+  804b96:	85 d2                	test   %edx,%edx
+  804b98:	75 b4                	jne    804b4e <mmap+0xb3>
+  804b9a:	e9 2d 01 00 00       	jmp    804ccc <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b9f:	4c 89 ff             	mov    %r15,%rdi
+  804ba2:	48 b8 09 47 80 00 00 	movabs $0x804709,%rax
+  804ba9:	00 00 00 
+  804bac:	ff d0                	call   *%rax
+  804bae:	48 89 c2             	mov    %rax,%rdx
+  804bb1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804bb8:	49 39 d7             	cmp    %rdx,%r15
+  804bbb:	0f 85 0b 01 00 00    	jne    804ccc <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804bc1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bc8:	00 00 00 
+  804bcb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804bd1:	eb 44                	jmp    804c17 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804bd3:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804bd7:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804bde:	00 00 00 
+  804be1:	48 b8 09 47 80 00 00 	movabs $0x804709,%rax
+  804be8:	00 00 00 
+  804beb:	ff d0                	call   *%rax
+  804bed:	48 89 c7             	mov    %rax,%rdi
+  804bf0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804bf4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804bfb:	48 85 ff             	test   %rdi,%rdi
+  804bfe:	75 c1                	jne    804bc1 <mmap+0x126>
+  804c00:	e9 c7 00 00 00       	jmp    804ccc <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804c05:	49 83 c4 01          	add    $0x1,%r12
+  804c09:	48 83 c0 20          	add    $0x20,%rax
+  804c0d:	49 83 fc 20          	cmp    $0x20,%r12
+  804c11:	0f 84 a5 00 00 00    	je     804cbc <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804c17:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804c1b:	75 e8                	jne    804c05 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804c1d:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804c21:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  804c28:	00 00 00 
+  804c2b:	ff d0                	call   *%rax
+  804c2d:	89 c2                	mov    %eax,%edx
+  804c2f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c36:	85 d2                	test   %edx,%edx
+  804c38:	0f 88 8e 00 00 00    	js     804ccc <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804c3e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804c42:	48 b8 27 2e 80 00 00 	movabs $0x802e27,%rax
+  804c49:	00 00 00 
+  804c4c:	ff d0                	call   *%rax
+  804c4e:	89 c6                	mov    %eax,%esi
+  804c50:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804c53:	48 b8 75 30 80 00 00 	movabs $0x803075,%rax
+  804c5a:	00 00 00 
+  804c5d:	ff d0                	call   *%rax
+  804c5f:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804c62:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c69:	45 85 ff             	test   %r15d,%r15d
+  804c6c:	78 5e                	js     804ccc <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804c6e:	49 c1 e4 05          	shl    $0x5,%r12
+  804c72:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c79:	00 00 00 
+  804c7c:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804c7f:	48 bf 7a 47 80 00 00 	movabs $0x80477a,%rdi
+  804c86:	00 00 00 
+  804c89:	48 b8 48 52 80 00 00 	movabs $0x805248,%rax
+  804c90:	00 00 00 
+  804c93:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c95:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c99:	49 89 04 24          	mov    %rax,(%r12)
+  804c9d:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804ca1:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804ca6:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804cab:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804cb0:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804cb5:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804cba:	eb 10                	jmp    804ccc <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804cbc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cc3:	eb 07                	jmp    804ccc <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804cc5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804ccc:	48 83 c4 38          	add    $0x38,%rsp
+  804cd0:	5b                   	pop    %rbx
+  804cd1:	41 5c                	pop    %r12
+  804cd3:	41 5d                	pop    %r13
+  804cd5:	41 5e                	pop    %r14
+  804cd7:	41 5f                	pop    %r15
+  804cd9:	5d                   	pop    %rbp
+  804cda:	c3                   	ret
+
+0000000000804cdb <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804cdb:	55                   	push   %rbp
+  804cdc:	48 89 e5             	mov    %rsp,%rbp
+  804cdf:	41 57                	push   %r15
+  804ce1:	41 56                	push   %r14
+  804ce3:	41 55                	push   %r13
+  804ce5:	41 54                	push   %r12
+  804ce7:	53                   	push   %rbx
+  804ce8:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cec:	49 89 fe             	mov    %rdi,%r14
+  804cef:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cf6:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804cfd:	00 
+  804cfe:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d05:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d0c:	00 00 00 
+  804d0f:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804d16:	49 bf 62 49 80 00 00 	movabs $0x804962,%r15
+  804d1d:	00 00 00 
+  804d20:	eb 09                	jmp    804d2b <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d22:	48 83 c3 20          	add    $0x20,%rbx
+  804d26:	4c 39 eb             	cmp    %r13,%rbx
+  804d29:	74 33                	je     804d5e <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d2b:	48 89 df             	mov    %rbx,%rdi
+  804d2e:	48 8b 33             	mov    (%rbx),%rsi
+  804d31:	4c 39 e6             	cmp    %r12,%rsi
+  804d34:	73 ec                	jae    804d22 <msync+0x47>
+  804d36:	48 85 f6             	test   %rsi,%rsi
+  804d39:	74 e7                	je     804d22 <msync+0x47>
+  804d3b:	48 89 f2             	mov    %rsi,%rdx
+  804d3e:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d42:	49 39 d6             	cmp    %rdx,%r14
+  804d45:	73 db                	jae    804d22 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804d47:	4c 39 e2             	cmp    %r12,%rdx
+  804d4a:	49 0f 47 d4          	cmova  %r12,%rdx
+  804d4e:	4c 39 f6             	cmp    %r14,%rsi
+  804d51:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804d55:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804d58:	85 c0                	test   %eax,%eax
+  804d5a:	79 c6                	jns    804d22 <msync+0x47>
+  804d5c:	eb 05                	jmp    804d63 <msync+0x88>
+    }
+
+    return 0;
+  804d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d63:	48 83 c4 08          	add    $0x8,%rsp
+  804d67:	5b                   	pop    %rbx
+  804d68:	41 5c                	pop    %r12
+  804d6a:	41 5d                	pop    %r13
+  804d6c:	41 5e                	pop    %r14
+  804d6e:	41 5f                	pop    %r15
+  804d70:	5d                   	pop    %rbp
+  804d71:	c3                   	ret
+
+0000000000804d72 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804d72:	55                   	push   %rbp
+  804d73:	48 89 e5             	mov    %rsp,%rbp
+  804d76:	41 57                	push   %r15
+  804d78:	41 56                	push   %r14
+  804d7a:	41 55                	push   %r13
+  804d7c:	41 54                	push   %r12
+  804d7e:	53                   	push   %rbx
+  804d7f:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804d83:	49 89 ff             	mov    %rdi,%r15
+  804d86:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d8d:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d94:	00 
+  804d95:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d9c:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804da3:	00 00 00 
+  804da6:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804dad:	48 89 d8             	mov    %rbx,%rax
+  804db0:	eb 09                	jmp    804dbb <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804db2:	48 83 c0 20          	add    $0x20,%rax
+  804db6:	4c 39 f0             	cmp    %r14,%rax
+  804db9:	74 40                	je     804dfb <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804dbb:	48 8b 10             	mov    (%rax),%rdx
+  804dbe:	4c 39 e2             	cmp    %r12,%rdx
+  804dc1:	73 ef                	jae    804db2 <munmap+0x40>
+  804dc3:	48 85 d2             	test   %rdx,%rdx
+  804dc6:	74 ea                	je     804db2 <munmap+0x40>
+  804dc8:	48 89 d7             	mov    %rdx,%rdi
+  804dcb:	48 03 78 08          	add    0x8(%rax),%rdi
+  804dcf:	49 39 ff             	cmp    %rdi,%r15
+  804dd2:	73 de                	jae    804db2 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804dd4:	49 39 fc             	cmp    %rdi,%r12
+  804dd7:	72 05                	jb     804dde <munmap+0x6c>
+  804dd9:	4c 39 fa             	cmp    %r15,%rdx
+  804ddc:	73 d4                	jae    804db2 <munmap+0x40>
+  804dde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804de3:	48 83 c4 08          	add    $0x8,%rsp
+  804de7:	5b                   	pop    %rbx
+  804de8:	41 5c                	pop    %r12
+  804dea:	41 5d                	pop    %r13
+  804dec:	41 5e                	pop    %r14
+  804dee:	41 5f                	pop    %r15
+  804df0:	5d                   	pop    %rbp
+  804df1:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804df2:	48 83 c3 20          	add    $0x20,%rbx
+  804df6:	4c 39 f3             	cmp    %r14,%rbx
+  804df9:	74 5c                	je     804e57 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804dfb:	48 8b 33             	mov    (%rbx),%rsi
+  804dfe:	4c 39 e6             	cmp    %r12,%rsi
+  804e01:	73 ef                	jae    804df2 <munmap+0x80>
+  804e03:	48 85 f6             	test   %rsi,%rsi
+  804e06:	74 ea                	je     804df2 <munmap+0x80>
+  804e08:	48 89 f2             	mov    %rsi,%rdx
+  804e0b:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804e0f:	49 39 d7             	cmp    %rdx,%r15
+  804e12:	73 de                	jae    804df2 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804e14:	48 89 df             	mov    %rbx,%rdi
+  804e17:	48 b8 62 49 80 00 00 	movabs $0x804962,%rax
+  804e1e:	00 00 00 
+  804e21:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804e23:	85 c0                	test   %eax,%eax
+  804e25:	78 bc                	js     804de3 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804e27:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804e2b:	48 8b 33             	mov    (%rbx),%rsi
+  804e2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e33:	48 b8 1a 28 80 00 00 	movabs $0x80281a,%rax
+  804e3a:	00 00 00 
+  804e3d:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804e3f:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804e42:	48 b8 1a 30 80 00 00 	movabs $0x80301a,%rax
+  804e49:	00 00 00 
+  804e4c:	ff d0                	call   *%rax
+        reg->start = 0;
+  804e4e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804e55:	eb 9b                	jmp    804df2 <munmap+0x80>
+    return 0;
+  804e57:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e5c:	eb 85                	jmp    804de3 <munmap+0x71>
+
+0000000000804e5e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e63:	c3                   	ret
+
+0000000000804e64 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804e64:	55                   	push   %rbp
+  804e65:	48 89 e5             	mov    %rsp,%rbp
+  804e68:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804e6b:	48 be e5 62 80 00 00 	movabs $0x8062e5,%rsi
+  804e72:	00 00 00 
+  804e75:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  804e7c:	00 00 00 
+  804e7f:	ff d0                	call   *%rax
+    return 0;
+}
+  804e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e86:	5d                   	pop    %rbp
+  804e87:	c3                   	ret
+
+0000000000804e88 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e88:	55                   	push   %rbp
+  804e89:	48 89 e5             	mov    %rsp,%rbp
+  804e8c:	41 57                	push   %r15
+  804e8e:	41 56                	push   %r14
+  804e90:	41 55                	push   %r13
+  804e92:	41 54                	push   %r12
+  804e94:	53                   	push   %rbx
+  804e95:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e9c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804ea3:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804eaa:	00 00 00 00 
+  804eae:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804eb5:	00 00 00 00 
+  804eb9:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804ec0:	00 00 00 00 
+  804ec4:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804ecb:	00 00 00 00 
+  804ecf:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804ed6:	00 00 00 00 
+  804eda:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804ee1:	00 00 00 00 
+  804ee5:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804eec:	00 
+  804eed:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804ef4:	00 
+  804ef5:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804efc:	00 
+  804efd:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804f04:	00 
+  804f05:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804f0c:	00 
+  804f0d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804f14:	00 
+  804f15:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804f1c:	00 
+  804f1d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804f24:	00 
+  804f25:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804f2c:	00 
+  804f2d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804f34:	00 
+    for (res = 0; res < n; res += inc) {
+  804f35:	48 85 d2             	test   %rdx,%rdx
+  804f38:	74 7a                	je     804fb4 <devcons_write+0x12c>
+  804f3a:	49 89 d6             	mov    %rdx,%r14
+  804f3d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f43:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804f48:	49 bf 2d 23 80 00 00 	movabs $0x80232d,%r15
+  804f4f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804f52:	4c 89 f3             	mov    %r14,%rbx
+  804f55:	48 29 f3             	sub    %rsi,%rbx
+  804f58:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804f5d:	48 39 c3             	cmp    %rax,%rbx
+  804f60:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804f64:	4c 63 eb             	movslq %ebx,%r13
+  804f67:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804f6e:	48 01 c6             	add    %rax,%rsi
+  804f71:	4c 89 ea             	mov    %r13,%rdx
+  804f74:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f7b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804f7e:	4c 89 ee             	mov    %r13,%rsi
+  804f81:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f88:	48 b8 5a 25 80 00 00 	movabs $0x80255a,%rax
+  804f8f:	00 00 00 
+  804f92:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f94:	41 01 dc             	add    %ebx,%r12d
+  804f97:	49 63 f4             	movslq %r12d,%rsi
+  804f9a:	4c 39 f6             	cmp    %r14,%rsi
+  804f9d:	72 b3                	jb     804f52 <devcons_write+0xca>
+    return res;
+  804f9f:	49 63 c4             	movslq %r12d,%rax
+}
+  804fa2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804fa9:	5b                   	pop    %rbx
+  804faa:	41 5c                	pop    %r12
+  804fac:	41 5d                	pop    %r13
+  804fae:	41 5e                	pop    %r14
+  804fb0:	41 5f                	pop    %r15
+  804fb2:	5d                   	pop    %rbp
+  804fb3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804fb4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804fba:	eb e3                	jmp    804f9f <devcons_write+0x117>
+
+0000000000804fbc <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804fbc:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804fbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fc4:	48 85 c0             	test   %rax,%rax
+  804fc7:	74 55                	je     80501e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804fc9:	55                   	push   %rbp
+  804fca:	48 89 e5             	mov    %rsp,%rbp
+  804fcd:	41 55                	push   %r13
+  804fcf:	41 54                	push   %r12
+  804fd1:	53                   	push   %rbx
+  804fd2:	48 83 ec 08          	sub    $0x8,%rsp
+  804fd6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804fd9:	48 bb 8d 25 80 00 00 	movabs $0x80258d,%rbx
+  804fe0:	00 00 00 
+  804fe3:	49 bc a1 26 80 00 00 	movabs $0x8026a1,%r12
+  804fea:	00 00 00 
+  804fed:	eb 03                	jmp    804ff2 <devcons_read+0x36>
+  804fef:	41 ff d4             	call   *%r12
+  804ff2:	ff d3                	call   *%rbx
+  804ff4:	85 c0                	test   %eax,%eax
+  804ff6:	74 f7                	je     804fef <devcons_read+0x33>
+    if (c < 0) return c;
+  804ff8:	48 63 d0             	movslq %eax,%rdx
+  804ffb:	78 13                	js     805010 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  805002:	83 f8 04             	cmp    $0x4,%eax
+  805005:	74 09                	je     805010 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805007:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80500b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805010:	48 89 d0             	mov    %rdx,%rax
+  805013:	48 83 c4 08          	add    $0x8,%rsp
+  805017:	5b                   	pop    %rbx
+  805018:	41 5c                	pop    %r12
+  80501a:	41 5d                	pop    %r13
+  80501c:	5d                   	pop    %rbp
+  80501d:	c3                   	ret
+  80501e:	48 89 d0             	mov    %rdx,%rax
+  805021:	c3                   	ret
+
+0000000000805022 <cputchar>:
+cputchar(int ch) {
+  805022:	55                   	push   %rbp
+  805023:	48 89 e5             	mov    %rsp,%rbp
+  805026:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80502a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80502e:	be 01 00 00 00       	mov    $0x1,%esi
+  805033:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805037:	48 b8 5a 25 80 00 00 	movabs $0x80255a,%rax
+  80503e:	00 00 00 
+  805041:	ff d0                	call   *%rax
+}
+  805043:	c9                   	leave
+  805044:	c3                   	ret
+
+0000000000805045 <getchar>:
+getchar(void) {
+  805045:	55                   	push   %rbp
+  805046:	48 89 e5             	mov    %rsp,%rbp
+  805049:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80504d:	ba 01 00 00 00       	mov    $0x1,%edx
+  805052:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80505b:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  805062:	00 00 00 
+  805065:	ff d0                	call   *%rax
+  805067:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805069:	85 c0                	test   %eax,%eax
+  80506b:	78 06                	js     805073 <getchar+0x2e>
+  80506d:	74 08                	je     805077 <getchar+0x32>
+  80506f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805073:	89 d0                	mov    %edx,%eax
+  805075:	c9                   	leave
+  805076:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805077:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80507c:	eb f5                	jmp    805073 <getchar+0x2e>
+
+000000000080507e <iscons>:
+iscons(int fdnum) {
+  80507e:	55                   	push   %rbp
+  80507f:	48 89 e5             	mov    %rsp,%rbp
+  805082:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805086:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80508a:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  805091:	00 00 00 
+  805094:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805096:	85 c0                	test   %eax,%eax
+  805098:	78 18                	js     8050b2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80509a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80509e:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8050a5:	00 00 00 
+  8050a8:	8b 00                	mov    (%rax),%eax
+  8050aa:	39 02                	cmp    %eax,(%rdx)
+  8050ac:	0f 94 c0             	sete   %al
+  8050af:	0f b6 c0             	movzbl %al,%eax
+}
+  8050b2:	c9                   	leave
+  8050b3:	c3                   	ret
+
+00000000008050b4 <opencons>:
+opencons(void) {
+  8050b4:	55                   	push   %rbp
+  8050b5:	48 89 e5             	mov    %rsp,%rbp
+  8050b8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8050bc:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8050c0:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  8050c7:	00 00 00 
+  8050ca:	ff d0                	call   *%rax
+  8050cc:	85 c0                	test   %eax,%eax
+  8050ce:	78 49                	js     805119 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8050d0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8050d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050da:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8050de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050e3:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  8050ea:	00 00 00 
+  8050ed:	ff d0                	call   *%rax
+  8050ef:	85 c0                	test   %eax,%eax
+  8050f1:	78 26                	js     805119 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8050f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050f7:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8050fe:	00 00 
+  805100:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805102:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805106:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80510d:	48 b8 27 2e 80 00 00 	movabs $0x802e27,%rax
+  805114:	00 00 00 
+  805117:	ff d0                	call   *%rax
+}
+  805119:	c9                   	leave
+  80511a:	c3                   	ret
+
+000000000080511b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80511b:	55                   	push   %rbp
+  80511c:	48 89 e5             	mov    %rsp,%rbp
+  80511f:	41 56                	push   %r14
+  805121:	41 55                	push   %r13
+  805123:	41 54                	push   %r12
+  805125:	53                   	push   %rbx
+  805126:	48 83 ec 50          	sub    $0x50,%rsp
+  80512a:	49 89 fc             	mov    %rdi,%r12
+  80512d:	41 89 f5             	mov    %esi,%r13d
+  805130:	48 89 d3             	mov    %rdx,%rbx
+  805133:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805137:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80513b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80513f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805146:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80514a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80514e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805152:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805156:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80515d:	00 00 00 
+  805160:	4c 8b 30             	mov    (%rax),%r14
+  805163:	48 b8 6a 26 80 00 00 	movabs $0x80266a,%rax
+  80516a:	00 00 00 
+  80516d:	ff d0                	call   *%rax
+  80516f:	89 c6                	mov    %eax,%esi
+  805171:	45 89 e8             	mov    %r13d,%r8d
+  805174:	4c 89 e1             	mov    %r12,%rcx
+  805177:	4c 89 f2             	mov    %r14,%rdx
+  80517a:	48 bf f8 62 80 00 00 	movabs $0x8062f8,%rdi
+  805181:	00 00 00 
+  805184:	b8 00 00 00 00       	mov    $0x0,%eax
+  805189:	49 bc a6 16 80 00 00 	movabs $0x8016a6,%r12
+  805190:	00 00 00 
+  805193:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805196:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80519a:	48 89 df             	mov    %rbx,%rdi
+  80519d:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  8051a4:	00 00 00 
+  8051a7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8051a9:	48 bf d3 61 80 00 00 	movabs $0x8061d3,%rdi
+  8051b0:	00 00 00 
+  8051b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051b8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8051bb:	cc                   	int3
+  8051bc:	eb fd                	jmp    8051bb <_panic+0xa0>
+
+00000000008051be <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8051be:	55                   	push   %rbp
+  8051bf:	48 89 e5             	mov    %rsp,%rbp
+  8051c2:	41 56                	push   %r14
+  8051c4:	41 55                	push   %r13
+  8051c6:	41 54                	push   %r12
+  8051c8:	53                   	push   %rbx
+  8051c9:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051cc:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051d3:	00 00 00 
+  8051d6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8051da:	74 27                	je     805203 <_handle_vectored_pagefault+0x45>
+  8051dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8051e1:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8051e8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051eb:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8051ee:	4c 89 e7             	mov    %r12,%rdi
+  8051f1:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8051f6:	84 c0                	test   %al,%al
+  8051f8:	75 45                	jne    80523f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051fa:	48 83 c3 01          	add    $0x1,%rbx
+  8051fe:	49 3b 1e             	cmp    (%r14),%rbx
+  805201:	72 eb                	jb     8051ee <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805203:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80520a:	00 
+  80520b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805210:	4d 8b 04 24          	mov    (%r12),%r8
+  805214:	48 ba 20 63 80 00 00 	movabs $0x806320,%rdx
+  80521b:	00 00 00 
+  80521e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805223:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  80522a:	00 00 00 
+  80522d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805232:	49 ba 1b 51 80 00 00 	movabs $0x80511b,%r10
+  805239:	00 00 00 
+  80523c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80523f:	5b                   	pop    %rbx
+  805240:	41 5c                	pop    %r12
+  805242:	41 5d                	pop    %r13
+  805244:	41 5e                	pop    %r14
+  805246:	5d                   	pop    %rbp
+  805247:	c3                   	ret
+
+0000000000805248 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805248:	55                   	push   %rbp
+  805249:	48 89 e5             	mov    %rsp,%rbp
+  80524c:	53                   	push   %rbx
+  80524d:	48 83 ec 08          	sub    $0x8,%rsp
+  805251:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805254:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805259:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805260:	00 00 00 
+  805263:	80 38 00             	cmpb   $0x0,(%rax)
+  805266:	74 68                	je     8052d0 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805268:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80526f:	00 00 00 
+  805272:	48 8b 08             	mov    (%rax),%rcx
+  805275:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80527a:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805281:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805284:	48 85 c9             	test   %rcx,%rcx
+  805287:	0f 84 e0 00 00 00    	je     80536d <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80528d:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805291:	0f 84 c9 00 00 00    	je     805360 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805297:	48 83 c2 01          	add    $0x1,%rdx
+  80529b:	48 39 ca             	cmp    %rcx,%rdx
+  80529e:	75 ed                	jne    80528d <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8052a0:	48 83 f9 08          	cmp    $0x8,%rcx
+  8052a4:	0f 84 84 00 00 00    	je     80532e <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052aa:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8052ae:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8052b5:	00 00 00 
+  8052b8:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8052bf:	00 00 00 
+  8052c2:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052c6:	85 f6                	test   %esi,%esi
+  8052c8:	0f 89 97 00 00 00    	jns    805365 <add_pgfault_handler+0x11d>
+  8052ce:	eb 63                	jmp    805333 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8052d0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8052d5:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8052da:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8052e1:	00 00 00 
+  8052e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052e9:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  8052f0:	00 00 00 
+  8052f3:	ff d0                	call   *%rax
+  8052f5:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8052f7:	85 c0                	test   %eax,%eax
+  8052f9:	78 38                	js     805333 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8052fb:	48 be a0 2d 80 00 00 	movabs $0x802da0,%rsi
+  805302:	00 00 00 
+  805305:	bf 00 00 00 00       	mov    $0x0,%edi
+  80530a:	48 b8 65 29 80 00 00 	movabs $0x802965,%rax
+  805311:	00 00 00 
+  805314:	ff d0                	call   *%rax
+  805316:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805318:	85 c0                	test   %eax,%eax
+  80531a:	78 17                	js     805333 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80531c:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805323:	00 00 00 
+  805326:	c6 00 01             	movb   $0x1,(%rax)
+  805329:	e9 3a ff ff ff       	jmp    805268 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80532e:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805333:	89 f1                	mov    %esi,%ecx
+  805335:	48 ba 5e 63 80 00 00 	movabs $0x80635e,%rdx
+  80533c:	00 00 00 
+  80533f:	be 42 00 00 00       	mov    $0x42,%esi
+  805344:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  80534b:	00 00 00 
+  80534e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805353:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  80535a:	00 00 00 
+  80535d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805360:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805365:	89 f0                	mov    %esi,%eax
+  805367:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80536b:	c9                   	leave
+  80536c:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80536d:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805374:	00 00 00 
+  805377:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80537e:	48 89 d8             	mov    %rbx,%rax
+  805381:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805388:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80538b:	eb d8                	jmp    805365 <add_pgfault_handler+0x11d>
+
+000000000080538d <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80538d:	55                   	push   %rbp
+  80538e:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805391:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805398:	00 00 00 
+  80539b:	80 38 00             	cmpb   $0x0,(%rax)
+  80539e:	74 33                	je     8053d3 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053a0:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8053a7:	00 00 00 
+  8053aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8053af:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8053b6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053b9:	48 85 c0             	test   %rax,%rax
+  8053bc:	0f 84 85 00 00 00    	je     805447 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8053c2:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8053c6:	74 40                	je     805408 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053c8:	48 83 c1 01          	add    $0x1,%rcx
+  8053cc:	48 39 c1             	cmp    %rax,%rcx
+  8053cf:	75 f1                	jne    8053c2 <remove_pgfault_handler+0x35>
+  8053d1:	eb 74                	jmp    805447 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8053d3:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  8053da:	00 00 00 
+  8053dd:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8053e4:	00 00 00 
+  8053e7:	be 48 00 00 00       	mov    $0x48,%esi
+  8053ec:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8053f3:	00 00 00 
+  8053f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053fb:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  805402:	00 00 00 
+  805405:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805408:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80540f:	00 
+  805410:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805414:	48 29 ca             	sub    %rcx,%rdx
+  805417:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80541e:	00 00 00 
+  805421:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805425:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80542a:	48 89 ce             	mov    %rcx,%rsi
+  80542d:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  805434:	00 00 00 
+  805437:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805439:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805440:	00 00 00 
+  805443:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805447:	5d                   	pop    %rbp
+  805448:	c3                   	ret
+
+0000000000805449 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805449:	85 ff                	test   %edi,%edi
+  80544b:	78 58                	js     8054a5 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80544d:	48 85 f6             	test   %rsi,%rsi
+  805450:	74 12                	je     805464 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805452:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805459:	00 00 00 
+  80545c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805462:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805464:	48 85 c9             	test   %rcx,%rcx
+  805467:	74 12                	je     80547b <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805469:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805470:	00 00 00 
+  805473:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805479:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80547b:	48 85 d2             	test   %rdx,%rdx
+  80547e:	74 14                	je     805494 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805480:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805487:	00 00 00 
+  80548a:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805491:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805494:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80549b:	00 00 00 
+  80549e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054a4:	c3                   	ret
+        if (from_env_store) {
+  8054a5:	48 85 f6             	test   %rsi,%rsi
+  8054a8:	74 06                	je     8054b0 <ipc_result+0x67>
+            *from_env_store = 0;
+  8054aa:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054b0:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054b2:	48 85 c9             	test   %rcx,%rcx
+  8054b5:	74 ed                	je     8054a4 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054b7:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054bd:	c3                   	ret
+
+00000000008054be <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054be:	55                   	push   %rbp
+  8054bf:	48 89 e5             	mov    %rsp,%rbp
+  8054c2:	41 55                	push   %r13
+  8054c4:	41 54                	push   %r12
+  8054c6:	53                   	push   %rbx
+  8054c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8054cb:	49 89 fc             	mov    %rdi,%r12
+  8054ce:	48 89 f7             	mov    %rsi,%rdi
+  8054d1:	48 89 d3             	mov    %rdx,%rbx
+  8054d4:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054d7:	48 85 f6             	test   %rsi,%rsi
+  8054da:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054e1:	00 00 00 
+  8054e4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8054ed:	48 85 d2             	test   %rdx,%rdx
+  8054f0:	74 03                	je     8054f5 <ipc_recv+0x37>
+  8054f2:	48 8b 32             	mov    (%rdx),%rsi
+  8054f5:	48 b8 8e 2c 80 00 00 	movabs $0x802c8e,%rax
+  8054fc:	00 00 00 
+  8054ff:	ff d0                	call   *%rax
+  805501:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805503:	4c 89 e9             	mov    %r13,%rcx
+  805506:	48 89 da             	mov    %rbx,%rdx
+  805509:	4c 89 e6             	mov    %r12,%rsi
+  80550c:	48 b8 49 54 80 00 00 	movabs $0x805449,%rax
+  805513:	00 00 00 
+  805516:	ff d0                	call   *%rax
+}
+  805518:	48 83 c4 08          	add    $0x8,%rsp
+  80551c:	5b                   	pop    %rbx
+  80551d:	41 5c                	pop    %r12
+  80551f:	41 5d                	pop    %r13
+  805521:	5d                   	pop    %rbp
+  805522:	c3                   	ret
+
+0000000000805523 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805523:	55                   	push   %rbp
+  805524:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805527:	48 85 d2             	test   %rdx,%rdx
+  80552a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805531:	00 00 00 
+  805534:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805538:	89 f6                	mov    %esi,%esi
+  80553a:	48 b8 1a 2b 80 00 00 	movabs $0x802b1a,%rax
+  805541:	00 00 00 
+  805544:	ff d0                	call   *%rax
+    if (res < 0) {
+  805546:	85 c0                	test   %eax,%eax
+  805548:	78 02                	js     80554c <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80554a:	5d                   	pop    %rbp
+  80554b:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80554c:	89 c1                	mov    %eax,%ecx
+  80554e:	48 ba 90 63 80 00 00 	movabs $0x806390,%rdx
+  805555:	00 00 00 
+  805558:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80555d:	48 bf 9d 63 80 00 00 	movabs $0x80639d,%rdi
+  805564:	00 00 00 
+  805567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80556c:	49 b8 1b 51 80 00 00 	movabs $0x80511b,%r8
+  805573:	00 00 00 
+  805576:	41 ff d0             	call   *%r8
+
+0000000000805579 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805579:	55                   	push   %rbp
+  80557a:	48 89 e5             	mov    %rsp,%rbp
+  80557d:	53                   	push   %rbx
+  80557e:	48 83 ec 08          	sub    $0x8,%rsp
+  805582:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805586:	48 85 d2             	test   %rdx,%rdx
+  805589:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805590:	00 00 00 
+  805593:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805597:	4d 85 c9             	test   %r9,%r9
+  80559a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80559e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055a3:	48 85 db             	test   %rbx,%rbx
+  8055a6:	74 03                	je     8055ab <ipc_call+0x32>
+  8055a8:	48 8b 03             	mov    (%rbx),%rax
+  8055ab:	89 f6                	mov    %esi,%esi
+  8055ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8055b1:	50                   	push   %rax
+  8055b2:	48 b8 4c 2b 80 00 00 	movabs $0x802b4c,%rax
+  8055b9:	00 00 00 
+  8055bc:	ff d0                	call   *%rax
+  8055be:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055c0:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055c4:	48 89 da             	mov    %rbx,%rdx
+  8055c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8055cc:	48 b8 49 54 80 00 00 	movabs $0x805449,%rax
+  8055d3:	00 00 00 
+  8055d6:	ff d0                	call   *%rax
+}
+  8055d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055dc:	c9                   	leave
+  8055dd:	c3                   	ret
+
+00000000008055de <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055de:	55                   	push   %rbp
+  8055df:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055e2:	89 f6                	mov    %esi,%esi
+  8055e4:	48 b8 b8 2b 80 00 00 	movabs $0x802bb8,%rax
+  8055eb:	00 00 00 
+  8055ee:	ff d0                	call   *%rax
+  8055f0:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055fc:	be 00 00 00 00       	mov    $0x0,%esi
+  805601:	48 b8 49 54 80 00 00 	movabs $0x805449,%rax
+  805608:	00 00 00 
+  80560b:	ff d0                	call   *%rax
+}
+  80560d:	5d                   	pop    %rbp
+  80560e:	c3                   	ret
+
+000000000080560f <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80560f:	55                   	push   %rbp
+  805610:	48 89 e5             	mov    %rsp,%rbp
+  805613:	41 54                	push   %r12
+  805615:	53                   	push   %rbx
+  805616:	4c 89 cb             	mov    %r9,%rbx
+  805619:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80561d:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805621:	48 85 d2             	test   %rdx,%rdx
+  805624:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80562b:	00 00 00 
+  80562e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805632:	4d 85 c9             	test   %r9,%r9
+  805635:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80563e:	4d 85 e4             	test   %r12,%r12
+  805641:	74 04                	je     805647 <ipc_reply_wait+0x38>
+  805643:	49 8b 04 24          	mov    (%r12),%rax
+  805647:	89 f6                	mov    %esi,%esi
+  805649:	48 83 ec 08          	sub    $0x8,%rsp
+  80564d:	50                   	push   %rax
+  80564e:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  805655:	00 00 00 
+  805658:	ff d0                	call   *%rax
+  80565a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80565c:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805660:	4c 89 e2             	mov    %r12,%rdx
+  805663:	48 89 de             	mov    %rbx,%rsi
+  805666:	48 b8 49 54 80 00 00 	movabs $0x805449,%rax
+  80566d:	00 00 00 
+  805670:	ff d0                	call   *%rax
+}
+  805672:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805676:	5b                   	pop    %rbx
+  805677:	41 5c                	pop    %r12
+  805679:	5d                   	pop    %rbp
+  80567a:	c3                   	ret
+
+000000000080567b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80567b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805680:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805687:	00 00 00 
+  80568a:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805691:	48 01 ca             	add    %rcx,%rdx
+  805694:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80569a:	39 fa                	cmp    %edi,%edx
+  80569c:	74 12                	je     8056b0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80569e:	48 83 c0 01          	add    $0x1,%rax
+  8056a2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056a8:	75 e0                	jne    80568a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056af:	c3                   	ret
+            return envs[i].env_id;
+  8056b0:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056b7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056be:	00 00 00 
+  8056c1:	48 01 d0             	add    %rdx,%rax
+  8056c4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056ca:	c3                   	ret
+  8056cb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008056d0 <__rodata_start>:
+  8056d0:	77 00                	ja     8056d2 <__rodata_start+0x2>
+  8056d2:	72 62                	jb     805736 <__rodata_start+0x66>
+  8056d4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056d7:	00 0f                	add    %cl,(%rdi)
+  8056d9:	1f                   	(bad)
+  8056da:	84 00                	test   %al,(%rax)
+  8056dc:	00 00                	add    %al,(%rax)
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c30:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c40:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c50:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c60:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c70:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c80:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c90:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805ca0:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805cb0:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805cc0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cd0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805ce0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cf0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805d00:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805d10:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d20:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d30:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d40:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d50:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d60:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d70:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d80:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d90:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805da0:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805db0:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805dc0:	9e 18 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805dd0:	e5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805de0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805df0:	f5 1e 80 00 00 00 00 00 bd 18 80 00 00 00 00 00     ................
+  805e00:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805e10:	b1 18 80 00 00 00 00 00 2b 19 80 00 00 00 00 00     ........+.......
+  805e20:	f5 1e 80 00 00 00 00 00 b1 18 80 00 00 00 00 00     ................
+  805e30:	f7 18 80 00 00 00 00 00 f7 18 80 00 00 00 00 00     ................
+  805e40:	f7 18 80 00 00 00 00 00 f7 18 80 00 00 00 00 00     ................
+  805e50:	f7 18 80 00 00 00 00 00 f7 18 80 00 00 00 00 00     ................
+  805e60:	f7 18 80 00 00 00 00 00 f7 18 80 00 00 00 00 00     ................
+  805e70:	f7 18 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805e80:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805e90:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805ea0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805eb0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805ec0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805ed0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805ee0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805ef0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f00:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f10:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f20:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f30:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f40:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f50:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f60:	f5 1e 80 00 00 00 00 00 13 1e 80 00 00 00 00 00     ................
+  805f70:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f80:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805f90:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805fa0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805fb0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805fc0:	59 19 80 00 00 00 00 00 28 1b 80 00 00 00 00 00     Y.......(.......
+  805fd0:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  805fe0:	f5 1e 80 00 00 00 00 00 4e 19 80 00 00 00 00 00     ........N.......
+  805ff0:	88 19 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  806000:	f5 1e 80 00 00 00 00 00 43 19 80 00 00 00 00 00     ........C.......
+  806010:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  806020:	d1 1c 80 00 00 00 00 00 a0 1d 80 00 00 00 00 00     ................
+  806030:	f5 1e 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  806040:	1f 1a 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  806050:	fc 1b 80 00 00 00 00 00 f5 1e 80 00 00 00 00 00     ................
+  806060:	f5 1e 80 00 00 00 00 00 13 1e 80 00 00 00 00 00     ................
+  806070:	f5 1e 80 00 00 00 00 00 a7 18 80 00 00 00 00 00     ................
+
+0000000000806080 <error_string>:
+	...
+  806088:	5e 5c 80 00 00 00 00 00 70 5c 80 00 00 00 00 00     ^\......p\......
+  806098:	80 5c 80 00 00 00 00 00 92 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	a0 5c 80 00 00 00 00 00 b4 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	c9 5c 80 00 00 00 00 00 dc 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	ee 5c 80 00 00 00 00 00 02 5d 80 00 00 00 00 00     .\.......]......
+  8060d8:	12 5d 80 00 00 00 00 00 25 5d 80 00 00 00 00 00     .]......%]......
+  8060e8:	3c 5d 80 00 00 00 00 00 52 5d 80 00 00 00 00 00     <]......R]......
+  8060f8:	6a 5d 80 00 00 00 00 00 82 5d 80 00 00 00 00 00     j].......]......
+  806108:	8f 5d 80 00 00 00 00 00 20 61 80 00 00 00 00 00     .]...... a......
+  806118:	a3 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806128:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806138:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806148:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806158:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806168:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806178:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806188:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806198:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806200 <devtab>:
+  806200:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806210:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806220:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806230:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806240:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806250:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806260:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806270:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806280:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806290:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062f0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806300:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806310:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806320:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806330:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806340:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806350:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806360:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806370:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806380:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806390:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063a0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,10321 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 3c 32 80 00 00 	movabs $0x80323c,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 3c 32 80 00 00 	movabs $0x80323c,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 3e 16 80 00 00 	movabs $0x80163e,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be ae 5c 80 00 00 	movabs $0x805cae,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be c8 56 80 00 00 	movabs $0x8056c8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be ca 56 80 00 00 	movabs $0x8056ca,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be cd 56 80 00 00 	movabs $0x8056cd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 10 4a 80 00 00 	movabs $0x804a10,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 e7 4c 80 00 00 	movabs $0x804ce7,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 26 33 80 00 00 	movabs $0x803326,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 ef 33 80 00 00 	movabs $0x8033ef,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 f5 32 80 00 00 	movabs $0x8032f5,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 f5 32 80 00 00 	movabs $0x8032f5,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 0d 31 80 00 00 	movabs $0x80310d,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 3c 32 80 00 00 	movabs $0x80323c,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 48 22 80 00 00 	movabs $0x802248,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 48 22 80 00 00 	movabs $0x802248,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 48 22 80 00 00 	movabs $0x802248,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 48 22 80 00 00 	movabs $0x802248,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 48 22 80 00 00 	movabs $0x802248,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 2a 00 00 00       	call   801529 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+/* Buggy program - faults with a read from location zero */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  801505:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  80150c:	48 bf 22 5c 80 00 00 	movabs $0x805c22,%rdi
+  801513:	00 00 00 
+  801516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151b:	48 ba a2 16 80 00 00 	movabs $0x8016a2,%rdx
+  801522:	00 00 00 
+  801525:	ff d2                	call   *%rdx
+#endif
+}
+  801527:	5d                   	pop    %rbp
+  801528:	c3                   	ret
+
+0000000000801529 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	41 56                	push   %r14
+  80152f:	41 55                	push   %r13
+  801531:	41 54                	push   %r12
+  801533:	53                   	push   %rbx
+  801534:	41 89 fd             	mov    %edi,%r13d
+  801537:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80153a:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801541:	00 00 00 
+  801544:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80154b:	00 00 00 
+  80154e:	48 39 c2             	cmp    %rax,%rdx
+  801551:	73 17                	jae    80156a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801553:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801556:	49 89 c4             	mov    %rax,%r12
+  801559:	48 83 c3 08          	add    $0x8,%rbx
+  80155d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801562:	ff 53 f8             	call   *-0x8(%rbx)
+  801565:	4c 39 e3             	cmp    %r12,%rbx
+  801568:	72 ef                	jb     801559 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80156a:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  801571:	00 00 00 
+  801574:	ff d0                	call   *%rax
+  801576:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80157b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801582:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801589:	00 00 00 
+  80158c:	48 01 d0             	add    %rdx,%rax
+  80158f:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801596:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801599:	45 85 ed             	test   %r13d,%r13d
+  80159c:	7e 0d                	jle    8015ab <libmain+0x82>
+  80159e:	49 8b 06             	mov    (%r14),%rax
+  8015a1:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015a8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015ab:	4c 89 f6             	mov    %r14,%rsi
+  8015ae:	44 89 ef             	mov    %r13d,%edi
+  8015b1:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015b8:	00 00 00 
+  8015bb:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015bd:	48 b8 d2 15 80 00 00 	movabs $0x8015d2,%rax
+  8015c4:	00 00 00 
+  8015c7:	ff d0                	call   *%rax
+#endif
+}
+  8015c9:	5b                   	pop    %rbx
+  8015ca:	41 5c                	pop    %r12
+  8015cc:	41 5d                	pop    %r13
+  8015ce:	41 5e                	pop    %r14
+  8015d0:	5d                   	pop    %rbp
+  8015d1:	c3                   	ret
+
+00000000008015d2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015d6:	48 b8 c2 2f 80 00 00 	movabs $0x802fc2,%rax
+  8015dd:	00 00 00 
+  8015e0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e7:	48 b8 f5 25 80 00 00 	movabs $0x8025f5,%rax
+  8015ee:	00 00 00 
+  8015f1:	ff d0                	call   *%rax
+}
+  8015f3:	5d                   	pop    %rbp
+  8015f4:	c3                   	ret
+
+00000000008015f5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015f5:	55                   	push   %rbp
+  8015f6:	48 89 e5             	mov    %rsp,%rbp
+  8015f9:	53                   	push   %rbx
+  8015fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fe:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801601:	8b 06                	mov    (%rsi),%eax
+  801603:	8d 50 01             	lea    0x1(%rax),%edx
+  801606:	89 16                	mov    %edx,(%rsi)
+  801608:	48 98                	cltq
+  80160a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80160f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801615:	74 0a                	je     801621 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801617:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80161b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801621:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801625:	be ff 00 00 00       	mov    $0xff,%esi
+  80162a:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  801631:	00 00 00 
+  801634:	ff d0                	call   *%rax
+        state->offset = 0;
+  801636:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80163c:	eb d9                	jmp    801617 <putch+0x22>
+
+000000000080163e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80163e:	55                   	push   %rbp
+  80163f:	48 89 e5             	mov    %rsp,%rbp
+  801642:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801649:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80164c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801653:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801660:	48 89 f1             	mov    %rsi,%rcx
+  801663:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80166a:	48 bf f5 15 80 00 00 	movabs $0x8015f5,%rdi
+  801671:	00 00 00 
+  801674:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  80167b:	00 00 00 
+  80167e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801680:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801687:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80168e:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  801695:	00 00 00 
+  801698:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80169a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016a0:	c9                   	leave
+  8016a1:	c3                   	ret
+
+00000000008016a2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016a2:	55                   	push   %rbp
+  8016a3:	48 89 e5             	mov    %rsp,%rbp
+  8016a6:	48 83 ec 50          	sub    $0x50,%rsp
+  8016aa:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016ae:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016b2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016b6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016ba:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016be:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016cd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016d5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016d9:	48 b8 3e 16 80 00 00 	movabs $0x80163e,%rax
+  8016e0:	00 00 00 
+  8016e3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+
+00000000008016e7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016e7:	55                   	push   %rbp
+  8016e8:	48 89 e5             	mov    %rsp,%rbp
+  8016eb:	41 57                	push   %r15
+  8016ed:	41 56                	push   %r14
+  8016ef:	41 55                	push   %r13
+  8016f1:	41 54                	push   %r12
+  8016f3:	53                   	push   %rbx
+  8016f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8016f8:	49 89 fc             	mov    %rdi,%r12
+  8016fb:	49 89 f5             	mov    %rsi,%r13
+  8016fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801702:	8b 45 10             	mov    0x10(%rbp),%eax
+  801705:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801708:	41 89 cf             	mov    %ecx,%r15d
+  80170b:	4c 39 fa             	cmp    %r15,%rdx
+  80170e:	73 5b                	jae    80176b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801710:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801714:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801718:	85 db                	test   %ebx,%ebx
+  80171a:	7e 0e                	jle    80172a <print_num+0x43>
+            putch(padc, put_arg);
+  80171c:	4c 89 ee             	mov    %r13,%rsi
+  80171f:	44 89 f7             	mov    %r14d,%edi
+  801722:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801725:	83 eb 01             	sub    $0x1,%ebx
+  801728:	75 f2                	jne    80171c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80172a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80172e:	48 b9 5b 5c 80 00 00 	movabs $0x805c5b,%rcx
+  801735:	00 00 00 
+  801738:	48 b8 4a 5c 80 00 00 	movabs $0x805c4a,%rax
+  80173f:	00 00 00 
+  801742:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801746:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174f:	49 f7 f7             	div    %r15
+  801752:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801756:	4c 89 ee             	mov    %r13,%rsi
+  801759:	41 ff d4             	call   *%r12
+}
+  80175c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801760:	5b                   	pop    %rbx
+  801761:	41 5c                	pop    %r12
+  801763:	41 5d                	pop    %r13
+  801765:	41 5e                	pop    %r14
+  801767:	41 5f                	pop    %r15
+  801769:	5d                   	pop    %rbp
+  80176a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80176b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801774:	49 f7 f7             	div    %r15
+  801777:	48 83 ec 08          	sub    $0x8,%rsp
+  80177b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80177f:	52                   	push   %rdx
+  801780:	45 0f be c9          	movsbl %r9b,%r9d
+  801784:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801788:	48 89 c2             	mov    %rax,%rdx
+  80178b:	48 b8 e7 16 80 00 00 	movabs $0x8016e7,%rax
+  801792:	00 00 00 
+  801795:	ff d0                	call   *%rax
+  801797:	48 83 c4 10          	add    $0x10,%rsp
+  80179b:	eb 8d                	jmp    80172a <print_num+0x43>
+
+000000000080179d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80179d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017a1:	48 8b 06             	mov    (%rsi),%rax
+  8017a4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017a8:	73 0a                	jae    8017b4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017aa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017ae:	48 89 16             	mov    %rdx,(%rsi)
+  8017b1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017b4:	c3                   	ret
+
+00000000008017b5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017b5:	55                   	push   %rbp
+  8017b6:	48 89 e5             	mov    %rsp,%rbp
+  8017b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8017bd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017c1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017c5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017c9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017d0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017d8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017e0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017e4:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  8017eb:	00 00 00 
+  8017ee:	ff d0                	call   *%rax
+}
+  8017f0:	c9                   	leave
+  8017f1:	c3                   	ret
+
+00000000008017f2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017f2:	55                   	push   %rbp
+  8017f3:	48 89 e5             	mov    %rsp,%rbp
+  8017f6:	41 57                	push   %r15
+  8017f8:	41 56                	push   %r14
+  8017fa:	41 55                	push   %r13
+  8017fc:	41 54                	push   %r12
+  8017fe:	53                   	push   %rbx
+  8017ff:	48 83 ec 38          	sub    $0x38,%rsp
+  801803:	49 89 fe             	mov    %rdi,%r14
+  801806:	49 89 f5             	mov    %rsi,%r13
+  801809:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80180c:	48 8b 01             	mov    (%rcx),%rax
+  80180f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801813:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801817:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80181b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80181f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801823:	eb 0d                	jmp    801832 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801825:	40 0f b6 ff          	movzbl %dil,%edi
+  801829:	4c 89 ee             	mov    %r13,%rsi
+  80182c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80182f:	4c 89 e3             	mov    %r12,%rbx
+  801832:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801836:	0f b6 3b             	movzbl (%rbx),%edi
+  801839:	40 80 ff 25          	cmp    $0x25,%dil
+  80183d:	74 14                	je     801853 <vprintfmt+0x61>
+            if (!ch) return;
+  80183f:	40 84 ff             	test   %dil,%dil
+  801842:	75 e1                	jne    801825 <vprintfmt+0x33>
+}
+  801844:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801848:	5b                   	pop    %rbx
+  801849:	41 5c                	pop    %r12
+  80184b:	41 5d                	pop    %r13
+  80184d:	41 5e                	pop    %r14
+  80184f:	41 5f                	pop    %r15
+  801851:	5d                   	pop    %rbp
+  801852:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801853:	be 00 00 00 00       	mov    $0x0,%esi
+  801858:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80185c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801861:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801867:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80186e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801872:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801877:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80187c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80187f:	83 e8 23             	sub    $0x23,%eax
+  801882:	3c 57                	cmp    $0x57,%al
+  801884:	0f 87 67 06 00 00    	ja     801ef1 <vprintfmt+0x6ff>
+  80188a:	0f b6 c0             	movzbl %al,%eax
+  80188d:	48 b9 e0 5d 80 00 00 	movabs $0x805de0,%rcx
+  801894:	00 00 00 
+  801897:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80189a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80189d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018a1:	eb cf                	jmp    801872 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018a3:	49 89 dc             	mov    %rbx,%r12
+  8018a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8018ab:	eb c5                	jmp    801872 <vprintfmt+0x80>
+            padc = ch;
+  8018ad:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018b1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018b4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018b7:	eb b9                	jmp    801872 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8018bf:	77 24                	ja     8018e5 <vprintfmt+0xf3>
+  8018c1:	89 c1                	mov    %eax,%ecx
+  8018c3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018c7:	83 c0 08             	add    $0x8,%eax
+  8018ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018cd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018d0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018d3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018d7:	79 99                	jns    801872 <vprintfmt+0x80>
+                width = precision;
+  8018d9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018dd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018e3:	eb 8d                	jmp    801872 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018e5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018e9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f1:	eb da                	jmp    8018cd <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018f3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018f8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018fc:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801902:	3c 39                	cmp    $0x39,%al
+  801904:	77 1c                	ja     801922 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801906:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80190a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80190e:	0f b6 c0             	movzbl %al,%eax
+  801911:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801916:	0f b6 03             	movzbl (%rbx),%eax
+  801919:	3c 39                	cmp    $0x39,%al
+  80191b:	76 e9                	jbe    801906 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  80191d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801920:	eb b1                	jmp    8018d3 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801922:	49 89 dc             	mov    %rbx,%r12
+  801925:	eb ac                	jmp    8018d3 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801927:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80192a:	85 c9                	test   %ecx,%ecx
+  80192c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801931:	0f 49 c1             	cmovns %ecx,%eax
+  801934:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801937:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80193a:	e9 33 ff ff ff       	jmp    801872 <vprintfmt+0x80>
+            lflag++;
+  80193f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801942:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801945:	e9 28 ff ff ff       	jmp    801872 <vprintfmt+0x80>
+            lflag--;
+  80194a:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80194d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801950:	e9 1d ff ff ff       	jmp    801872 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801958:	83 f8 2f             	cmp    $0x2f,%eax
+  80195b:	77 19                	ja     801976 <vprintfmt+0x184>
+  80195d:	89 c2                	mov    %eax,%edx
+  80195f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801963:	83 c0 08             	add    $0x8,%eax
+  801966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801969:	8b 3a                	mov    (%rdx),%edi
+  80196b:	4c 89 ee             	mov    %r13,%rsi
+  80196e:	41 ff d6             	call   *%r14
+            break;
+  801971:	e9 bc fe ff ff       	jmp    801832 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801976:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80197a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80197e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801982:	eb e5                	jmp    801969 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801984:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801987:	83 f8 2f             	cmp    $0x2f,%eax
+  80198a:	77 5a                	ja     8019e6 <vprintfmt+0x1f4>
+  80198c:	89 c2                	mov    %eax,%edx
+  80198e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801992:	83 c0 08             	add    $0x8,%eax
+  801995:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801998:	8b 02                	mov    (%rdx),%eax
+  80199a:	89 c1                	mov    %eax,%ecx
+  80199c:	f7 d9                	neg    %ecx
+  80199e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019a1:	83 f9 13             	cmp    $0x13,%ecx
+  8019a4:	7f 4e                	jg     8019f4 <vprintfmt+0x202>
+  8019a6:	48 63 c1             	movslq %ecx,%rax
+  8019a9:	48 ba a0 60 80 00 00 	movabs $0x8060a0,%rdx
+  8019b0:	00 00 00 
+  8019b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019b7:	48 85 c0             	test   %rax,%rax
+  8019ba:	74 38                	je     8019f4 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019bc:	48 89 c1             	mov    %rax,%rcx
+  8019bf:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  8019c6:	00 00 00 
+  8019c9:	4c 89 ee             	mov    %r13,%rsi
+  8019cc:	4c 89 f7             	mov    %r14,%rdi
+  8019cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d4:	49 b8 b5 17 80 00 00 	movabs $0x8017b5,%r8
+  8019db:	00 00 00 
+  8019de:	41 ff d0             	call   *%r8
+  8019e1:	e9 4c fe ff ff       	jmp    801832 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019f2:	eb a4                	jmp    801998 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019f4:	48 ba 73 5c 80 00 00 	movabs $0x805c73,%rdx
+  8019fb:	00 00 00 
+  8019fe:	4c 89 ee             	mov    %r13,%rsi
+  801a01:	4c 89 f7             	mov    %r14,%rdi
+  801a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a09:	49 b8 b5 17 80 00 00 	movabs $0x8017b5,%r8
+  801a10:	00 00 00 
+  801a13:	41 ff d0             	call   *%r8
+  801a16:	e9 17 fe ff ff       	jmp    801832 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a1e:	83 f8 2f             	cmp    $0x2f,%eax
+  801a21:	77 6c                	ja     801a8f <vprintfmt+0x29d>
+  801a23:	89 c2                	mov    %eax,%edx
+  801a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a29:	83 c0 08             	add    $0x8,%eax
+  801a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a2f:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a32:	48 85 f6             	test   %rsi,%rsi
+  801a35:	48 b8 6c 5c 80 00 00 	movabs $0x805c6c,%rax
+  801a3c:	00 00 00 
+  801a3f:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a43:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a47:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a4b:	7e 06                	jle    801a53 <vprintfmt+0x261>
+  801a4d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a51:	75 4a                	jne    801a9d <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a53:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a57:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a5b:	0f b6 00             	movzbl (%rax),%eax
+  801a5e:	84 c0                	test   %al,%al
+  801a60:	0f 85 9a 00 00 00    	jne    801b00 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a66:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a69:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	0f 8e bd fd ff ff    	jle    801832 <vprintfmt+0x40>
+  801a75:	4c 89 ee             	mov    %r13,%rsi
+  801a78:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a7d:	41 ff d6             	call   *%r14
+  801a80:	41 83 ec 01          	sub    $0x1,%r12d
+  801a84:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a88:	75 eb                	jne    801a75 <vprintfmt+0x283>
+  801a8a:	e9 a3 fd ff ff       	jmp    801832 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a9b:	eb 92                	jmp    801a2f <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a9d:	49 63 f7             	movslq %r15d,%rsi
+  801aa0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801aa4:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  801aab:	00 00 00 
+  801aae:	ff d0                	call   *%rax
+  801ab0:	48 89 c2             	mov    %rax,%rdx
+  801ab3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ab8:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801abb:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	7e 91                	jle    801a53 <vprintfmt+0x261>
+  801ac2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ac7:	4c 89 ee             	mov    %r13,%rsi
+  801aca:	44 89 e7             	mov    %r12d,%edi
+  801acd:	41 ff d6             	call   *%r14
+  801ad0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ad7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ada:	75 eb                	jne    801ac7 <vprintfmt+0x2d5>
+  801adc:	e9 72 ff ff ff       	jmp    801a53 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ae1:	0f b6 f8             	movzbl %al,%edi
+  801ae4:	4c 89 ee             	mov    %r13,%rsi
+  801ae7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801aea:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801aee:	49 83 c4 01          	add    $0x1,%r12
+  801af2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801af8:	84 c0                	test   %al,%al
+  801afa:	0f 84 66 ff ff ff    	je     801a66 <vprintfmt+0x274>
+  801b00:	45 85 ff             	test   %r15d,%r15d
+  801b03:	78 0a                	js     801b0f <vprintfmt+0x31d>
+  801b05:	41 83 ef 01          	sub    $0x1,%r15d
+  801b09:	0f 88 57 ff ff ff    	js     801a66 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b0f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b13:	74 cc                	je     801ae1 <vprintfmt+0x2ef>
+  801b15:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b18:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b1d:	80 fa 5e             	cmp    $0x5e,%dl
+  801b20:	77 c2                	ja     801ae4 <vprintfmt+0x2f2>
+  801b22:	eb bd                	jmp    801ae1 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b24:	40 84 f6             	test   %sil,%sil
+  801b27:	75 26                	jne    801b4f <vprintfmt+0x35d>
+    switch (lflag) {
+  801b29:	85 d2                	test   %edx,%edx
+  801b2b:	74 59                	je     801b86 <vprintfmt+0x394>
+  801b2d:	83 fa 01             	cmp    $0x1,%edx
+  801b30:	74 7b                	je     801bad <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b35:	83 f8 2f             	cmp    $0x2f,%eax
+  801b38:	0f 87 96 00 00 00    	ja     801bd4 <vprintfmt+0x3e2>
+  801b3e:	89 c2                	mov    %eax,%edx
+  801b40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b44:	83 c0 08             	add    $0x8,%eax
+  801b47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b4a:	4c 8b 22             	mov    (%rdx),%r12
+  801b4d:	eb 17                	jmp    801b66 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b52:	83 f8 2f             	cmp    $0x2f,%eax
+  801b55:	77 21                	ja     801b78 <vprintfmt+0x386>
+  801b57:	89 c2                	mov    %eax,%edx
+  801b59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b5d:	83 c0 08             	add    $0x8,%eax
+  801b60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b63:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b66:	4d 85 e4             	test   %r12,%r12
+  801b69:	78 7a                	js     801be5 <vprintfmt+0x3f3>
+            num = i;
+  801b6b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b6e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b73:	e9 56 02 00 00       	jmp    801dce <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b84:	eb dd                	jmp    801b63 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b89:	83 f8 2f             	cmp    $0x2f,%eax
+  801b8c:	77 11                	ja     801b9f <vprintfmt+0x3ad>
+  801b8e:	89 c2                	mov    %eax,%edx
+  801b90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b94:	83 c0 08             	add    $0x8,%eax
+  801b97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b9a:	4c 63 22             	movslq (%rdx),%r12
+  801b9d:	eb c7                	jmp    801b66 <vprintfmt+0x374>
+  801b9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bab:	eb ed                	jmp    801b9a <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bb0:	83 f8 2f             	cmp    $0x2f,%eax
+  801bb3:	77 11                	ja     801bc6 <vprintfmt+0x3d4>
+  801bb5:	89 c2                	mov    %eax,%edx
+  801bb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bbb:	83 c0 08             	add    $0x8,%eax
+  801bbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bc1:	4c 8b 22             	mov    (%rdx),%r12
+  801bc4:	eb a0                	jmp    801b66 <vprintfmt+0x374>
+  801bc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd2:	eb ed                	jmp    801bc1 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be0:	e9 65 ff ff ff       	jmp    801b4a <vprintfmt+0x358>
+                putch('-', put_arg);
+  801be5:	4c 89 ee             	mov    %r13,%rsi
+  801be8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bed:	41 ff d6             	call   *%r14
+                i = -i;
+  801bf0:	49 f7 dc             	neg    %r12
+  801bf3:	e9 73 ff ff ff       	jmp    801b6b <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bf8:	40 84 f6             	test   %sil,%sil
+  801bfb:	75 2e                	jne    801c2b <vprintfmt+0x439>
+    switch (lflag) {
+  801bfd:	85 d2                	test   %edx,%edx
+  801bff:	7f 59                	jg     801c5a <vprintfmt+0x468>
+  801c01:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c04:	7d 7a                	jge    801c80 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c09:	83 f8 2f             	cmp    $0x2f,%eax
+  801c0c:	0f 87 aa 00 00 00    	ja     801cbc <vprintfmt+0x4ca>
+  801c12:	89 c2                	mov    %eax,%edx
+  801c14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c18:	83 c0 08             	add    $0x8,%eax
+  801c1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c1e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c21:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c26:	e9 a3 01 00 00       	jmp    801dce <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c2e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c31:	77 19                	ja     801c4c <vprintfmt+0x45a>
+  801c33:	89 c2                	mov    %eax,%edx
+  801c35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c39:	83 c0 08             	add    $0x8,%eax
+  801c3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c3f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c47:	e9 82 01 00 00       	jmp    801dce <vprintfmt+0x5dc>
+  801c4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c58:	eb e5                	jmp    801c3f <vprintfmt+0x44d>
+    switch (lflag) {
+  801c5a:	83 fa 01             	cmp    $0x1,%edx
+  801c5d:	75 a7                	jne    801c06 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c62:	83 f8 2f             	cmp    $0x2f,%eax
+  801c65:	77 47                	ja     801cae <vprintfmt+0x4bc>
+  801c67:	89 c2                	mov    %eax,%edx
+  801c69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c6d:	83 c0 08             	add    $0x8,%eax
+  801c70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c73:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c7b:	e9 4e 01 00 00       	jmp    801dce <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c83:	83 f8 2f             	cmp    $0x2f,%eax
+  801c86:	77 18                	ja     801ca0 <vprintfmt+0x4ae>
+  801c88:	89 c2                	mov    %eax,%edx
+  801c8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c8e:	83 c0 08             	add    $0x8,%eax
+  801c91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c94:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c9b:	e9 2e 01 00 00       	jmp    801dce <vprintfmt+0x5dc>
+  801ca0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cac:	eb e6                	jmp    801c94 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cba:	eb b7                	jmp    801c73 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cc8:	e9 51 ff ff ff       	jmp    801c1e <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ccd:	40 84 f6             	test   %sil,%sil
+  801cd0:	75 2e                	jne    801d00 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cd2:	85 d2                	test   %edx,%edx
+  801cd4:	7f 59                	jg     801d2f <vprintfmt+0x53d>
+  801cd6:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cd9:	7d 77                	jge    801d52 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cde:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce1:	0f 87 a4 00 00 00    	ja     801d8b <vprintfmt+0x599>
+  801ce7:	89 c2                	mov    %eax,%edx
+  801ce9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ced:	83 c0 08             	add    $0x8,%eax
+  801cf0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cf6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cfb:	e9 ce 00 00 00       	jmp    801dce <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d03:	83 f8 2f             	cmp    $0x2f,%eax
+  801d06:	77 19                	ja     801d21 <vprintfmt+0x52f>
+  801d08:	89 c2                	mov    %eax,%edx
+  801d0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d0e:	83 c0 08             	add    $0x8,%eax
+  801d11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d17:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d1c:	e9 ad 00 00 00       	jmp    801dce <vprintfmt+0x5dc>
+  801d21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d2d:	eb e5                	jmp    801d14 <vprintfmt+0x522>
+    switch (lflag) {
+  801d2f:	83 fa 01             	cmp    $0x1,%edx
+  801d32:	75 a7                	jne    801cdb <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d37:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3a:	77 41                	ja     801d7d <vprintfmt+0x58b>
+  801d3c:	89 c2                	mov    %eax,%edx
+  801d3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d42:	83 c0 08             	add    $0x8,%eax
+  801d45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d50:	eb 7c                	jmp    801dce <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d55:	83 f8 2f             	cmp    $0x2f,%eax
+  801d58:	77 15                	ja     801d6f <vprintfmt+0x57d>
+  801d5a:	89 c2                	mov    %eax,%edx
+  801d5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d60:	83 c0 08             	add    $0x8,%eax
+  801d63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d66:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d68:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d6d:	eb 5f                	jmp    801dce <vprintfmt+0x5dc>
+  801d6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7b:	eb e9                	jmp    801d66 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d89:	eb bd                	jmp    801d48 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d97:	e9 57 ff ff ff       	jmp    801cf3 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d9c:	4c 89 ee             	mov    %r13,%rsi
+  801d9f:	bf 30 00 00 00       	mov    $0x30,%edi
+  801da4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801da7:	4c 89 ee             	mov    %r13,%rsi
+  801daa:	bf 78 00 00 00       	mov    $0x78,%edi
+  801daf:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801db2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db5:	83 f8 2f             	cmp    $0x2f,%eax
+  801db8:	77 47                	ja     801e01 <vprintfmt+0x60f>
+  801dba:	89 c2                	mov    %eax,%edx
+  801dbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc0:	83 c0 08             	add    $0x8,%eax
+  801dc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dc9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dce:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dd6:	0f 94 c0             	sete   %al
+  801dd9:	0f b6 c0             	movzbl %al,%eax
+  801ddc:	50                   	push   %rax
+  801ddd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801de2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801de6:	4c 89 ee             	mov    %r13,%rsi
+  801de9:	4c 89 f7             	mov    %r14,%rdi
+  801dec:	48 b8 e7 16 80 00 00 	movabs $0x8016e7,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+            break;
+  801df8:	48 83 c4 10          	add    $0x10,%rsp
+  801dfc:	e9 31 fa ff ff       	jmp    801832 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e0d:	eb b7                	jmp    801dc6 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e0f:	40 84 f6             	test   %sil,%sil
+  801e12:	75 2b                	jne    801e3f <vprintfmt+0x64d>
+    switch (lflag) {
+  801e14:	85 d2                	test   %edx,%edx
+  801e16:	7f 56                	jg     801e6e <vprintfmt+0x67c>
+  801e18:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e1b:	7d 77                	jge    801e94 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e20:	83 f8 2f             	cmp    $0x2f,%eax
+  801e23:	0f 87 a7 00 00 00    	ja     801ed0 <vprintfmt+0x6de>
+  801e29:	89 c2                	mov    %eax,%edx
+  801e2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2f:	83 c0 08             	add    $0x8,%eax
+  801e32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e35:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e38:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e3d:	eb 8f                	jmp    801dce <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e42:	83 f8 2f             	cmp    $0x2f,%eax
+  801e45:	77 19                	ja     801e60 <vprintfmt+0x66e>
+  801e47:	89 c2                	mov    %eax,%edx
+  801e49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e4d:	83 c0 08             	add    $0x8,%eax
+  801e50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e53:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e56:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e5b:	e9 6e ff ff ff       	jmp    801dce <vprintfmt+0x5dc>
+  801e60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e6c:	eb e5                	jmp    801e53 <vprintfmt+0x661>
+    switch (lflag) {
+  801e6e:	83 fa 01             	cmp    $0x1,%edx
+  801e71:	75 aa                	jne    801e1d <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e76:	83 f8 2f             	cmp    $0x2f,%eax
+  801e79:	77 47                	ja     801ec2 <vprintfmt+0x6d0>
+  801e7b:	89 c2                	mov    %eax,%edx
+  801e7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e81:	83 c0 08             	add    $0x8,%eax
+  801e84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e87:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e8f:	e9 3a ff ff ff       	jmp    801dce <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e97:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9a:	77 18                	ja     801eb4 <vprintfmt+0x6c2>
+  801e9c:	89 c2                	mov    %eax,%edx
+  801e9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea2:	83 c0 08             	add    $0x8,%eax
+  801ea5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ea8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801eaa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801eaf:	e9 1a ff ff ff       	jmp    801dce <vprintfmt+0x5dc>
+  801eb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec0:	eb e6                	jmp    801ea8 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ec2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ece:	eb b7                	jmp    801e87 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ed0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801edc:	e9 54 ff ff ff       	jmp    801e35 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ee1:	4c 89 ee             	mov    %r13,%rsi
+  801ee4:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ee9:	41 ff d6             	call   *%r14
+            break;
+  801eec:	e9 41 f9 ff ff       	jmp    801832 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ef1:	4c 89 ee             	mov    %r13,%rsi
+  801ef4:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ef9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801efc:	48 83 eb 01          	sub    $0x1,%rbx
+  801f00:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f04:	75 f6                	jne    801efc <vprintfmt+0x70a>
+  801f06:	e9 27 f9 ff ff       	jmp    801832 <vprintfmt+0x40>
+
+0000000000801f0b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f0b:	55                   	push   %rbp
+  801f0c:	48 89 e5             	mov    %rsp,%rbp
+  801f0f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f13:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f17:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f1c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f20:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f27:	48 85 ff             	test   %rdi,%rdi
+  801f2a:	74 2b                	je     801f57 <vsnprintf+0x4c>
+  801f2c:	48 85 f6             	test   %rsi,%rsi
+  801f2f:	74 26                	je     801f57 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f31:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f35:	48 bf 9d 17 80 00 00 	movabs $0x80179d,%rdi
+  801f3c:	00 00 00 
+  801f3f:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f4f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f52:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5c:	eb f7                	jmp    801f55 <vsnprintf+0x4a>
+
+0000000000801f5e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f5e:	55                   	push   %rbp
+  801f5f:	48 89 e5             	mov    %rsp,%rbp
+  801f62:	48 83 ec 50          	sub    $0x50,%rsp
+  801f66:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f6a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f6e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f72:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f79:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f81:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f85:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f89:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f8d:	48 b8 0b 1f 80 00 00 	movabs $0x801f0b,%rax
+  801f94:	00 00 00 
+  801f97:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f99:	c9                   	leave
+  801f9a:	c3                   	ret
+
+0000000000801f9b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f9b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f9e:	74 10                	je     801fb0 <strlen+0x15>
+    size_t n = 0;
+  801fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fa5:	48 83 c0 01          	add    $0x1,%rax
+  801fa9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fad:	75 f6                	jne    801fa5 <strlen+0xa>
+  801faf:	c3                   	ret
+    size_t n = 0;
+  801fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fb5:	c3                   	ret
+
+0000000000801fb6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fb6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fb9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fbe:	48 85 f6             	test   %rsi,%rsi
+  801fc1:	74 11                	je     801fd4 <strnlen+0x1e>
+  801fc3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fc7:	74 0c                	je     801fd5 <strnlen+0x1f>
+  801fc9:	48 83 c2 01          	add    $0x1,%rdx
+  801fcd:	48 39 d0             	cmp    %rdx,%rax
+  801fd0:	75 f1                	jne    801fc3 <strnlen+0xd>
+  801fd2:	eb 04                	jmp    801fd8 <strnlen+0x22>
+  801fd4:	c3                   	ret
+  801fd5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fd8:	c3                   	ret
+
+0000000000801fd9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fd9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fe5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fe8:	48 83 c2 01          	add    $0x1,%rdx
+  801fec:	84 c9                	test   %cl,%cl
+  801fee:	75 f1                	jne    801fe1 <strcpy+0x8>
+        ;
+    return res;
+}
+  801ff0:	c3                   	ret
+
+0000000000801ff1 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801ff1:	55                   	push   %rbp
+  801ff2:	48 89 e5             	mov    %rsp,%rbp
+  801ff5:	41 54                	push   %r12
+  801ff7:	53                   	push   %rbx
+  801ff8:	48 89 fb             	mov    %rdi,%rbx
+  801ffb:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801ffe:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  802005:	00 00 00 
+  802008:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80200a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80200e:	4c 89 e6             	mov    %r12,%rsi
+  802011:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+    return dst;
+}
+  80201d:	48 89 d8             	mov    %rbx,%rax
+  802020:	5b                   	pop    %rbx
+  802021:	41 5c                	pop    %r12
+  802023:	5d                   	pop    %rbp
+  802024:	c3                   	ret
+
+0000000000802025 <toupper>:
+
+int
+toupper(int ch) {
+  802025:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802027:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80202a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80202d:	83 f9 1a             	cmp    $0x1a,%ecx
+  802030:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802033:	c3                   	ret
+
+0000000000802034 <tolower>:
+
+int
+tolower(int ch) {
+  802034:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802036:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802039:	8d 57 20             	lea    0x20(%rdi),%edx
+  80203c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80203f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802042:	c3                   	ret
+
+0000000000802043 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802043:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802046:	48 85 d2             	test   %rdx,%rdx
+  802049:	74 1f                	je     80206a <strncpy+0x27>
+  80204b:	48 01 fa             	add    %rdi,%rdx
+  80204e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802051:	48 83 c1 01          	add    $0x1,%rcx
+  802055:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802059:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80205d:	41 80 f8 01          	cmp    $0x1,%r8b
+  802061:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802065:	48 39 ca             	cmp    %rcx,%rdx
+  802068:	75 e7                	jne    802051 <strncpy+0xe>
+    }
+    return ret;
+}
+  80206a:	c3                   	ret
+
+000000000080206b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80206b:	48 89 f8             	mov    %rdi,%rax
+  80206e:	48 85 d2             	test   %rdx,%rdx
+  802071:	74 24                	je     802097 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802073:	48 83 ea 01          	sub    $0x1,%rdx
+  802077:	74 1b                	je     802094 <strlcpy+0x29>
+  802079:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80207d:	0f b6 16             	movzbl (%rsi),%edx
+  802080:	84 d2                	test   %dl,%dl
+  802082:	74 10                	je     802094 <strlcpy+0x29>
+            *dst++ = *src++;
+  802084:	48 83 c6 01          	add    $0x1,%rsi
+  802088:	48 83 c0 01          	add    $0x1,%rax
+  80208c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80208f:	48 39 c8             	cmp    %rcx,%rax
+  802092:	75 e9                	jne    80207d <strlcpy+0x12>
+        *dst = '\0';
+  802094:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802097:	48 29 f8             	sub    %rdi,%rax
+}
+  80209a:	c3                   	ret
+
+000000000080209b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80209b:	0f b6 07             	movzbl (%rdi),%eax
+  80209e:	84 c0                	test   %al,%al
+  8020a0:	74 13                	je     8020b5 <strcmp+0x1a>
+  8020a2:	38 06                	cmp    %al,(%rsi)
+  8020a4:	75 0f                	jne    8020b5 <strcmp+0x1a>
+  8020a6:	48 83 c7 01          	add    $0x1,%rdi
+  8020aa:	48 83 c6 01          	add    $0x1,%rsi
+  8020ae:	0f b6 07             	movzbl (%rdi),%eax
+  8020b1:	84 c0                	test   %al,%al
+  8020b3:	75 ed                	jne    8020a2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020b5:	0f b6 c0             	movzbl %al,%eax
+  8020b8:	0f b6 16             	movzbl (%rsi),%edx
+  8020bb:	29 d0                	sub    %edx,%eax
+}
+  8020bd:	c3                   	ret
+
+00000000008020be <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020be:	48 85 d2             	test   %rdx,%rdx
+  8020c1:	74 1f                	je     8020e2 <strncmp+0x24>
+  8020c3:	0f b6 07             	movzbl (%rdi),%eax
+  8020c6:	84 c0                	test   %al,%al
+  8020c8:	74 1e                	je     8020e8 <strncmp+0x2a>
+  8020ca:	3a 06                	cmp    (%rsi),%al
+  8020cc:	75 1a                	jne    8020e8 <strncmp+0x2a>
+  8020ce:	48 83 c7 01          	add    $0x1,%rdi
+  8020d2:	48 83 c6 01          	add    $0x1,%rsi
+  8020d6:	48 83 ea 01          	sub    $0x1,%rdx
+  8020da:	75 e7                	jne    8020c3 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e1:	c3                   	ret
+  8020e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e7:	c3                   	ret
+  8020e8:	48 85 d2             	test   %rdx,%rdx
+  8020eb:	74 09                	je     8020f6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020ed:	0f b6 07             	movzbl (%rdi),%eax
+  8020f0:	0f b6 16             	movzbl (%rsi),%edx
+  8020f3:	29 d0                	sub    %edx,%eax
+  8020f5:	c3                   	ret
+    if (!n) return 0;
+  8020f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020fb:	c3                   	ret
+
+00000000008020fc <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020fc:	0f b6 17             	movzbl (%rdi),%edx
+  8020ff:	84 d2                	test   %dl,%dl
+  802101:	74 18                	je     80211b <strchr+0x1f>
+        if (*str == c) {
+  802103:	0f be d2             	movsbl %dl,%edx
+  802106:	39 f2                	cmp    %esi,%edx
+  802108:	74 17                	je     802121 <strchr+0x25>
+    for (; *str; str++) {
+  80210a:	48 83 c7 01          	add    $0x1,%rdi
+  80210e:	0f b6 17             	movzbl (%rdi),%edx
+  802111:	84 d2                	test   %dl,%dl
+  802113:	75 ee                	jne    802103 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211a:	c3                   	ret
+  80211b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802120:	c3                   	ret
+  802121:	48 89 f8             	mov    %rdi,%rax
+}
+  802124:	c3                   	ret
+
+0000000000802125 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802125:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802128:	0f b6 17             	movzbl (%rdi),%edx
+  80212b:	84 d2                	test   %dl,%dl
+  80212d:	74 13                	je     802142 <strfind+0x1d>
+  80212f:	0f be d2             	movsbl %dl,%edx
+  802132:	39 f2                	cmp    %esi,%edx
+  802134:	74 0b                	je     802141 <strfind+0x1c>
+  802136:	48 83 c0 01          	add    $0x1,%rax
+  80213a:	0f b6 10             	movzbl (%rax),%edx
+  80213d:	84 d2                	test   %dl,%dl
+  80213f:	75 ee                	jne    80212f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802141:	c3                   	ret
+  802142:	c3                   	ret
+
+0000000000802143 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802143:	48 39 f7             	cmp    %rsi,%rdi
+  802146:	74 65                	je     8021ad <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802148:	55                   	push   %rbp
+  802149:	48 89 e5             	mov    %rsp,%rbp
+  80214c:	41 57                	push   %r15
+  80214e:	41 56                	push   %r14
+  802150:	41 55                	push   %r13
+  802152:	41 54                	push   %r12
+  802154:	53                   	push   %rbx
+  802155:	48 83 ec 18          	sub    $0x18,%rsp
+  802159:	48 89 fb             	mov    %rdi,%rbx
+  80215c:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80215f:	49 bf 34 20 80 00 00 	movabs $0x802034,%r15
+  802166:	00 00 00 
+  802169:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80216d:	41 0f b6 fd          	movzbl %r13b,%edi
+  802171:	41 ff d7             	call   *%r15
+  802174:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802177:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80217c:	41 0f b6 fe          	movzbl %r14b,%edi
+  802180:	41 ff d7             	call   *%r15
+  802183:	89 c2                	mov    %eax,%edx
+  802185:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802188:	29 d0                	sub    %edx,%eax
+  80218a:	75 12                	jne    80219e <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80218c:	48 83 c3 01          	add    $0x1,%rbx
+  802190:	45 84 ed             	test   %r13b,%r13b
+  802193:	74 09                	je     80219e <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802195:	49 83 c4 01          	add    $0x1,%r12
+  802199:	45 84 f6             	test   %r14b,%r14b
+  80219c:	75 cb                	jne    802169 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80219e:	48 83 c4 18          	add    $0x18,%rsp
+  8021a2:	5b                   	pop    %rbx
+  8021a3:	41 5c                	pop    %r12
+  8021a5:	41 5d                	pop    %r13
+  8021a7:	41 5e                	pop    %r14
+  8021a9:	41 5f                	pop    %r15
+  8021ab:	5d                   	pop    %rbp
+  8021ac:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b2:	c3                   	ret
+
+00000000008021b3 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021b3:	48 39 f7             	cmp    %rsi,%rdi
+  8021b6:	74 7d                	je     802235 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021b8:	55                   	push   %rbp
+  8021b9:	48 89 e5             	mov    %rsp,%rbp
+  8021bc:	41 57                	push   %r15
+  8021be:	41 56                	push   %r14
+  8021c0:	41 55                	push   %r13
+  8021c2:	41 54                	push   %r12
+  8021c4:	53                   	push   %rbx
+  8021c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8021c9:	48 89 fb             	mov    %rdi,%rbx
+  8021cc:	49 89 f4             	mov    %rsi,%r12
+  8021cf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021d7:	49 bf 34 20 80 00 00 	movabs $0x802034,%r15
+  8021de:	00 00 00 
+    while (n--) {
+  8021e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e5:	48 39 c3             	cmp    %rax,%rbx
+  8021e8:	74 37                	je     802221 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021ea:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021ee:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021f2:	41 ff d7             	call   *%r15
+  8021f5:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021f8:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021fd:	41 0f b6 fe          	movzbl %r14b,%edi
+  802201:	41 ff d7             	call   *%r15
+  802204:	89 c2                	mov    %eax,%edx
+  802206:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802209:	29 d0                	sub    %edx,%eax
+  80220b:	75 19                	jne    802226 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80220d:	48 83 c3 01          	add    $0x1,%rbx
+  802211:	45 84 ed             	test   %r13b,%r13b
+  802214:	74 10                	je     802226 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802216:	49 83 c4 01          	add    $0x1,%r12
+  80221a:	45 84 f6             	test   %r14b,%r14b
+  80221d:	75 c2                	jne    8021e1 <strncasecmp+0x2e>
+  80221f:	eb 05                	jmp    802226 <strncasecmp+0x73>
+  802221:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802226:	48 83 c4 18          	add    $0x18,%rsp
+  80222a:	5b                   	pop    %rbx
+  80222b:	41 5c                	pop    %r12
+  80222d:	41 5d                	pop    %r13
+  80222f:	41 5e                	pop    %r14
+  802231:	41 5f                	pop    %r15
+  802233:	5d                   	pop    %rbp
+  802234:	c3                   	ret
+    if (p1 == p2) return 0;
+  802235:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223a:	c3                   	ret
+
+000000000080223b <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80223b:	83 e7 df             	and    $0xffffffdf,%edi
+  80223e:	83 ef 41             	sub    $0x41,%edi
+  802241:	83 ff 19             	cmp    $0x19,%edi
+  802244:	0f 96 c0             	setbe  %al
+}
+  802247:	c3                   	ret
+
+0000000000802248 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802248:	83 ff 20             	cmp    $0x20,%edi
+  80224b:	0f 94 c0             	sete   %al
+  80224e:	83 ff 09             	cmp    $0x9,%edi
+  802251:	0f 94 c2             	sete   %dl
+  802254:	09 d0                	or     %edx,%eax
+}
+  802256:	c3                   	ret
+
+0000000000802257 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802257:	55                   	push   %rbp
+  802258:	48 89 e5             	mov    %rsp,%rbp
+  80225b:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80225d:	48 bf 5f 61 80 00 00 	movabs $0x80615f,%rdi
+  802264:	00 00 00 
+  802267:	48 b8 fc 20 80 00 00 	movabs $0x8020fc,%rax
+  80226e:	00 00 00 
+  802271:	ff d0                	call   *%rax
+  802273:	48 85 c0             	test   %rax,%rax
+  802276:	0f 95 c0             	setne  %al
+}
+  802279:	5d                   	pop    %rbp
+  80227a:	c3                   	ret
+
+000000000080227b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80227b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80227e:	48 89 f8             	mov    %rdi,%rax
+  802281:	48 f7 d8             	neg    %rax
+  802284:	83 e0 07             	and    $0x7,%eax
+  802287:	49 89 d1             	mov    %rdx,%r9
+  80228a:	49 29 c1             	sub    %rax,%r9
+  80228d:	78 36                	js     8022c5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80228f:	40 0f b6 c6          	movzbl %sil,%eax
+  802293:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80229a:	01 01 01 
+  80229d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022a1:	40 f6 c7 07          	test   $0x7,%dil
+  8022a5:	75 38                	jne    8022df <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022a7:	4c 89 c9             	mov    %r9,%rcx
+  8022aa:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022ae:	74 0c                	je     8022bc <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022b0:	fc                   	cld
+  8022b1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022b4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022b8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022bc:	4d 85 c9             	test   %r9,%r9
+  8022bf:	75 45                	jne    802306 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022c1:	4c 89 c0             	mov    %r8,%rax
+  8022c4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022c5:	48 85 d2             	test   %rdx,%rdx
+  8022c8:	74 f7                	je     8022c1 <memset+0x46>
+  8022ca:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022cd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022d0:	48 83 c0 01          	add    $0x1,%rax
+  8022d4:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022d8:	48 39 c2             	cmp    %rax,%rdx
+  8022db:	75 f3                	jne    8022d0 <memset+0x55>
+  8022dd:	eb e2                	jmp    8022c1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022df:	40 f6 c7 01          	test   $0x1,%dil
+  8022e3:	74 06                	je     8022eb <memset+0x70>
+  8022e5:	88 07                	mov    %al,(%rdi)
+  8022e7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022eb:	40 f6 c7 02          	test   $0x2,%dil
+  8022ef:	74 07                	je     8022f8 <memset+0x7d>
+  8022f1:	66 89 07             	mov    %ax,(%rdi)
+  8022f4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022f8:	40 f6 c7 04          	test   $0x4,%dil
+  8022fc:	74 a9                	je     8022a7 <memset+0x2c>
+  8022fe:	89 07                	mov    %eax,(%rdi)
+  802300:	48 83 c7 04          	add    $0x4,%rdi
+  802304:	eb a1                	jmp    8022a7 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802306:	41 f6 c1 04          	test   $0x4,%r9b
+  80230a:	74 06                	je     802312 <memset+0x97>
+  80230c:	89 07                	mov    %eax,(%rdi)
+  80230e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802312:	41 f6 c1 02          	test   $0x2,%r9b
+  802316:	74 07                	je     80231f <memset+0xa4>
+  802318:	66 89 07             	mov    %ax,(%rdi)
+  80231b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80231f:	41 f6 c1 01          	test   $0x1,%r9b
+  802323:	74 9c                	je     8022c1 <memset+0x46>
+  802325:	88 07                	mov    %al,(%rdi)
+  802327:	eb 98                	jmp    8022c1 <memset+0x46>
+
+0000000000802329 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802329:	48 89 f8             	mov    %rdi,%rax
+  80232c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80232f:	48 39 fe             	cmp    %rdi,%rsi
+  802332:	73 3b                	jae    80236f <memmove+0x46>
+  802334:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802338:	48 39 d7             	cmp    %rdx,%rdi
+  80233b:	73 32                	jae    80236f <memmove+0x46>
+        s += n;
+        d += n;
+  80233d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802341:	48 89 d6             	mov    %rdx,%rsi
+  802344:	48 09 fe             	or     %rdi,%rsi
+  802347:	48 09 ce             	or     %rcx,%rsi
+  80234a:	40 f6 c6 07          	test   $0x7,%sil
+  80234e:	75 12                	jne    802362 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802350:	48 83 ef 08          	sub    $0x8,%rdi
+  802354:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802358:	48 c1 e9 03          	shr    $0x3,%rcx
+  80235c:	fd                   	std
+  80235d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802360:	fc                   	cld
+  802361:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802362:	48 83 ef 01          	sub    $0x1,%rdi
+  802366:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80236a:	fd                   	std
+  80236b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80236d:	eb f1                	jmp    802360 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80236f:	48 89 f2             	mov    %rsi,%rdx
+  802372:	48 09 c2             	or     %rax,%rdx
+  802375:	48 09 ca             	or     %rcx,%rdx
+  802378:	f6 c2 07             	test   $0x7,%dl
+  80237b:	75 0c                	jne    802389 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80237d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802381:	48 89 c7             	mov    %rax,%rdi
+  802384:	fc                   	cld
+  802385:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802388:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802389:	48 89 c7             	mov    %rax,%rdi
+  80238c:	fc                   	cld
+  80238d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80238f:	c3                   	ret
+
+0000000000802390 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802390:	55                   	push   %rbp
+  802391:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802394:	48 b8 29 23 80 00 00 	movabs $0x802329,%rax
+  80239b:	00 00 00 
+  80239e:	ff d0                	call   *%rax
+}
+  8023a0:	5d                   	pop    %rbp
+  8023a1:	c3                   	ret
+
+00000000008023a2 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023a2:	55                   	push   %rbp
+  8023a3:	48 89 e5             	mov    %rsp,%rbp
+  8023a6:	41 57                	push   %r15
+  8023a8:	41 56                	push   %r14
+  8023aa:	41 55                	push   %r13
+  8023ac:	41 54                	push   %r12
+  8023ae:	53                   	push   %rbx
+  8023af:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b3:	49 89 fe             	mov    %rdi,%r14
+  8023b6:	49 89 f7             	mov    %rsi,%r15
+  8023b9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023bc:	48 89 f7             	mov    %rsi,%rdi
+  8023bf:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  8023c6:	00 00 00 
+  8023c9:	ff d0                	call   *%rax
+  8023cb:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023ce:	48 89 de             	mov    %rbx,%rsi
+  8023d1:	4c 89 f7             	mov    %r14,%rdi
+  8023d4:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  8023db:	00 00 00 
+  8023de:	ff d0                	call   *%rax
+  8023e0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023e3:	48 39 c3             	cmp    %rax,%rbx
+  8023e6:	74 36                	je     80241e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023e8:	48 89 d8             	mov    %rbx,%rax
+  8023eb:	4c 29 e8             	sub    %r13,%rax
+  8023ee:	49 39 c4             	cmp    %rax,%r12
+  8023f1:	73 31                	jae    802424 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023f3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023f8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023fc:	4c 89 fe             	mov    %r15,%rsi
+  8023ff:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  802406:	00 00 00 
+  802409:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80240b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80240f:	48 83 c4 08          	add    $0x8,%rsp
+  802413:	5b                   	pop    %rbx
+  802414:	41 5c                	pop    %r12
+  802416:	41 5d                	pop    %r13
+  802418:	41 5e                	pop    %r14
+  80241a:	41 5f                	pop    %r15
+  80241c:	5d                   	pop    %rbp
+  80241d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80241e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802422:	eb eb                	jmp    80240f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802424:	48 83 eb 01          	sub    $0x1,%rbx
+  802428:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80242c:	48 89 da             	mov    %rbx,%rdx
+  80242f:	4c 89 fe             	mov    %r15,%rsi
+  802432:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80243e:	49 01 de             	add    %rbx,%r14
+  802441:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802446:	eb c3                	jmp    80240b <strlcat+0x69>
+
+0000000000802448 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802448:	48 85 d2             	test   %rdx,%rdx
+  80244b:	74 2d                	je     80247a <memcmp+0x32>
+  80244d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802452:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802456:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80245b:	44 38 c1             	cmp    %r8b,%cl
+  80245e:	75 0f                	jne    80246f <memcmp+0x27>
+    while (n-- > 0) {
+  802460:	48 83 c0 01          	add    $0x1,%rax
+  802464:	48 39 c2             	cmp    %rax,%rdx
+  802467:	75 e9                	jne    802452 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80246f:	0f b6 c1             	movzbl %cl,%eax
+  802472:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802476:	44 29 c0             	sub    %r8d,%eax
+  802479:	c3                   	ret
+    return 0;
+  80247a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247f:	c3                   	ret
+
+0000000000802480 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802480:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802484:	48 39 c7             	cmp    %rax,%rdi
+  802487:	73 0f                	jae    802498 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802489:	40 38 37             	cmp    %sil,(%rdi)
+  80248c:	74 0e                	je     80249c <memfind+0x1c>
+    for (; src < end; src++) {
+  80248e:	48 83 c7 01          	add    $0x1,%rdi
+  802492:	48 39 f8             	cmp    %rdi,%rax
+  802495:	75 f2                	jne    802489 <memfind+0x9>
+  802497:	c3                   	ret
+  802498:	48 89 f8             	mov    %rdi,%rax
+  80249b:	c3                   	ret
+  80249c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80249f:	c3                   	ret
+
+00000000008024a0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024a0:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024a3:	0f b6 37             	movzbl (%rdi),%esi
+  8024a6:	40 80 fe 20          	cmp    $0x20,%sil
+  8024aa:	74 06                	je     8024b2 <strtol+0x12>
+  8024ac:	40 80 fe 09          	cmp    $0x9,%sil
+  8024b0:	75 13                	jne    8024c5 <strtol+0x25>
+  8024b2:	48 83 c7 01          	add    $0x1,%rdi
+  8024b6:	0f b6 37             	movzbl (%rdi),%esi
+  8024b9:	40 80 fe 20          	cmp    $0x20,%sil
+  8024bd:	74 f3                	je     8024b2 <strtol+0x12>
+  8024bf:	40 80 fe 09          	cmp    $0x9,%sil
+  8024c3:	74 ed                	je     8024b2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024c5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024c8:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024cb:	3c 01                	cmp    $0x1,%al
+  8024cd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024d1:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024d7:	75 0f                	jne    8024e8 <strtol+0x48>
+  8024d9:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024dc:	74 14                	je     8024f2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024de:	85 d2                	test   %edx,%edx
+  8024e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024e5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024e8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024ed:	4c 63 ca             	movslq %edx,%r9
+  8024f0:	eb 36                	jmp    802528 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024f2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024f6:	74 0f                	je     802507 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024f8:	85 d2                	test   %edx,%edx
+  8024fa:	75 ec                	jne    8024e8 <strtol+0x48>
+        s++;
+  8024fc:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802500:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802505:	eb e1                	jmp    8024e8 <strtol+0x48>
+        s += 2;
+  802507:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80250b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802510:	eb d6                	jmp    8024e8 <strtol+0x48>
+            dig -= '0';
+  802512:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802515:	44 0f b6 c1          	movzbl %cl,%r8d
+  802519:	41 39 d0             	cmp    %edx,%r8d
+  80251c:	7d 21                	jge    80253f <strtol+0x9f>
+        val = val * base + dig;
+  80251e:	49 0f af c1          	imul   %r9,%rax
+  802522:	0f b6 c9             	movzbl %cl,%ecx
+  802525:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802528:	48 83 c7 01          	add    $0x1,%rdi
+  80252c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802530:	80 f9 39             	cmp    $0x39,%cl
+  802533:	76 dd                	jbe    802512 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802535:	80 f9 7b             	cmp    $0x7b,%cl
+  802538:	77 05                	ja     80253f <strtol+0x9f>
+            dig -= 'a' - 10;
+  80253a:	83 e9 57             	sub    $0x57,%ecx
+  80253d:	eb d6                	jmp    802515 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80253f:	4d 85 d2             	test   %r10,%r10
+  802542:	74 03                	je     802547 <strtol+0xa7>
+  802544:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802547:	48 89 c2             	mov    %rax,%rdx
+  80254a:	48 f7 da             	neg    %rdx
+  80254d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802551:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802555:	c3                   	ret
+
+0000000000802556 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802556:	55                   	push   %rbp
+  802557:	48 89 e5             	mov    %rsp,%rbp
+  80255a:	53                   	push   %rbx
+  80255b:	48 89 fa             	mov    %rdi,%rdx
+  80255e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802561:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802566:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80256b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802570:	be 00 00 00 00       	mov    $0x0,%esi
+  802575:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80257b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802581:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802583:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802587:	c9                   	leave
+  802588:	c3                   	ret
+
+0000000000802589 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802589:	55                   	push   %rbp
+  80258a:	48 89 e5             	mov    %rsp,%rbp
+  80258d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80258e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802593:	ba 00 00 00 00       	mov    $0x0,%edx
+  802598:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80259d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025b8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025be:	c9                   	leave
+  8025bf:	c3                   	ret
+
+00000000008025c0 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025c0:	55                   	push   %rbp
+  8025c1:	48 89 e5             	mov    %rsp,%rbp
+  8025c4:	53                   	push   %rbx
+  8025c5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025c8:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025ed:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f3:	c9                   	leave
+  8025f4:	c3                   	ret
+
+00000000008025f5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025f5:	55                   	push   %rbp
+  8025f6:	48 89 e5             	mov    %rsp,%rbp
+  8025f9:	53                   	push   %rbx
+  8025fa:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802601:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802606:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80260b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802610:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802615:	be 00 00 00 00       	mov    $0x0,%esi
+  80261a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802620:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802626:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802628:	48 85 c0             	test   %rax,%rax
+  80262b:	7f 06                	jg     802633 <sys_env_destroy+0x3e>
+}
+  80262d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802631:	c9                   	leave
+  802632:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802633:	49 89 c0             	mov    %rax,%r8
+  802636:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80263b:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802642:	00 00 00 
+  802645:	be 27 00 00 00       	mov    $0x27,%esi
+  80264a:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802651:	00 00 00 
+  802654:	b8 00 00 00 00       	mov    $0x0,%eax
+  802659:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802660:	00 00 00 
+  802663:	41 ff d1             	call   *%r9
+
+0000000000802666 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802666:	55                   	push   %rbp
+  802667:	48 89 e5             	mov    %rsp,%rbp
+  80266a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80266b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802670:	ba 00 00 00 00       	mov    $0x0,%edx
+  802675:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80267a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80267f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802684:	be 00 00 00 00       	mov    $0x0,%esi
+  802689:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80268f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802695:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802697:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80269b:	c9                   	leave
+  80269c:	c3                   	ret
+
+000000000080269d <sys_yield>:
+
+void
+sys_yield(void) {
+  80269d:	55                   	push   %rbp
+  80269e:	48 89 e5             	mov    %rsp,%rbp
+  8026a1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026cc:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d2:	c9                   	leave
+  8026d3:	c3                   	ret
+
+00000000008026d4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026d4:	55                   	push   %rbp
+  8026d5:	48 89 e5             	mov    %rsp,%rbp
+  8026d8:	53                   	push   %rbx
+  8026d9:	48 89 fa             	mov    %rdi,%rdx
+  8026dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026df:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026eb:	00 00 00 
+  8026ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802704:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802706:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80270a:	c9                   	leave
+  80270b:	c3                   	ret
+
+000000000080270c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80270c:	55                   	push   %rbp
+  80270d:	48 89 e5             	mov    %rsp,%rbp
+  802710:	53                   	push   %rbx
+  802711:	49 89 f8             	mov    %rdi,%r8
+  802714:	48 89 d3             	mov    %rdx,%rbx
+  802717:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80271a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80271f:	4c 89 c2             	mov    %r8,%rdx
+  802722:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802725:	be 00 00 00 00       	mov    $0x0,%esi
+  80272a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802730:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802736:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802738:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80273c:	c9                   	leave
+  80273d:	c3                   	ret
+
+000000000080273e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80273e:	55                   	push   %rbp
+  80273f:	48 89 e5             	mov    %rsp,%rbp
+  802742:	53                   	push   %rbx
+  802743:	48 83 ec 08          	sub    $0x8,%rsp
+  802747:	89 f8                	mov    %edi,%eax
+  802749:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80274c:	48 63 f9             	movslq %ecx,%rdi
+  80274f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802752:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802757:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80275a:	be 00 00 00 00       	mov    $0x0,%esi
+  80275f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802765:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80276b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80276d:	48 85 c0             	test   %rax,%rax
+  802770:	7f 06                	jg     802778 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802772:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802776:	c9                   	leave
+  802777:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802778:	49 89 c0             	mov    %rax,%r8
+  80277b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802780:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802787:	00 00 00 
+  80278a:	be 27 00 00 00       	mov    $0x27,%esi
+  80278f:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802796:	00 00 00 
+  802799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279e:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  8027a5:	00 00 00 
+  8027a8:	41 ff d1             	call   *%r9
+
+00000000008027ab <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027ab:	55                   	push   %rbp
+  8027ac:	48 89 e5             	mov    %rsp,%rbp
+  8027af:	53                   	push   %rbx
+  8027b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b4:	89 f8                	mov    %edi,%eax
+  8027b6:	49 89 f2             	mov    %rsi,%r10
+  8027b9:	48 89 cf             	mov    %rcx,%rdi
+  8027bc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027bf:	48 63 da             	movslq %edx,%rbx
+  8027c2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ca:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027cd:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027d8:	48 85 c0             	test   %rax,%rax
+  8027db:	7f 06                	jg     8027e3 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027e1:	c9                   	leave
+  8027e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027e3:	49 89 c0             	mov    %rax,%r8
+  8027e6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027eb:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8027f2:	00 00 00 
+  8027f5:	be 27 00 00 00       	mov    $0x27,%esi
+  8027fa:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802801:	00 00 00 
+  802804:	b8 00 00 00 00       	mov    $0x0,%eax
+  802809:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802810:	00 00 00 
+  802813:	41 ff d1             	call   *%r9
+
+0000000000802816 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802816:	55                   	push   %rbp
+  802817:	48 89 e5             	mov    %rsp,%rbp
+  80281a:	53                   	push   %rbx
+  80281b:	48 83 ec 08          	sub    $0x8,%rsp
+  80281f:	48 89 f1             	mov    %rsi,%rcx
+  802822:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802825:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802828:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80282d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802832:	be 00 00 00 00       	mov    $0x0,%esi
+  802837:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80283d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802843:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802845:	48 85 c0             	test   %rax,%rax
+  802848:	7f 06                	jg     802850 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80284a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80284e:	c9                   	leave
+  80284f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802850:	49 89 c0             	mov    %rax,%r8
+  802853:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802858:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  80285f:	00 00 00 
+  802862:	be 27 00 00 00       	mov    $0x27,%esi
+  802867:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  80286e:	00 00 00 
+  802871:	b8 00 00 00 00       	mov    $0x0,%eax
+  802876:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  80287d:	00 00 00 
+  802880:	41 ff d1             	call   *%r9
+
+0000000000802883 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802883:	55                   	push   %rbp
+  802884:	48 89 e5             	mov    %rsp,%rbp
+  802887:	53                   	push   %rbx
+  802888:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80288c:	48 63 ce             	movslq %esi,%rcx
+  80288f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802892:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802897:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80289c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028b4:	48 85 c0             	test   %rax,%rax
+  8028b7:	7f 06                	jg     8028bf <sys_env_set_status+0x3c>
+}
+  8028b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028bd:	c9                   	leave
+  8028be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028bf:	49 89 c0             	mov    %rax,%r8
+  8028c2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028c7:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8028ce:	00 00 00 
+  8028d1:	be 27 00 00 00       	mov    $0x27,%esi
+  8028d6:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  8028dd:	00 00 00 
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e5:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  8028ec:	00 00 00 
+  8028ef:	41 ff d1             	call   *%r9
+
+00000000008028f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+  8028f6:	53                   	push   %rbx
+  8028f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802901:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802906:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802910:	be 00 00 00 00       	mov    $0x0,%esi
+  802915:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80291b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802921:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802923:	48 85 c0             	test   %rax,%rax
+  802926:	7f 06                	jg     80292e <sys_env_set_trapframe+0x3c>
+}
+  802928:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80292c:	c9                   	leave
+  80292d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80292e:	49 89 c0             	mov    %rax,%r8
+  802931:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802936:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  80293d:	00 00 00 
+  802940:	be 27 00 00 00       	mov    $0x27,%esi
+  802945:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  80294c:	00 00 00 
+  80294f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802954:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  80295b:	00 00 00 
+  80295e:	41 ff d1             	call   *%r9
+
+0000000000802961 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802961:	55                   	push   %rbp
+  802962:	48 89 e5             	mov    %rsp,%rbp
+  802965:	53                   	push   %rbx
+  802966:	48 83 ec 08          	sub    $0x8,%rsp
+  80296a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  80296d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802970:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802975:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80297a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297f:	be 00 00 00 00       	mov    $0x0,%esi
+  802984:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80298a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802990:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802992:	48 85 c0             	test   %rax,%rax
+  802995:	7f 06                	jg     80299d <sys_env_set_pgfault_upcall+0x3c>
+}
+  802997:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80299d:	49 89 c0             	mov    %rax,%r8
+  8029a0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029a5:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  8029ac:	00 00 00 
+  8029af:	be 27 00 00 00       	mov    $0x27,%esi
+  8029b4:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  8029bb:	00 00 00 
+  8029be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c3:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  8029ca:	00 00 00 
+  8029cd:	41 ff d1             	call   *%r9
+
+00000000008029d0 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029d0:	55                   	push   %rbp
+  8029d1:	48 89 e5             	mov    %rsp,%rbp
+  8029d4:	53                   	push   %rbx
+  8029d5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029d9:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029e0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a00:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a02:	48 85 c0             	test   %rax,%rax
+  802a05:	7f 06                	jg     802a0d <sys_env_set_reclaim+0x3d>
+}
+  802a07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a0b:	c9                   	leave
+  802a0c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a0d:	49 89 c0             	mov    %rax,%r8
+  802a10:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a15:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802a1c:	00 00 00 
+  802a1f:	be 27 00 00 00       	mov    $0x27,%esi
+  802a24:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802a2b:	00 00 00 
+  802a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a33:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802a3a:	00 00 00 
+  802a3d:	41 ff d1             	call   *%r9
+
+0000000000802a40 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a40:	55                   	push   %rbp
+  802a41:	48 89 e5             	mov    %rsp,%rbp
+  802a44:	53                   	push   %rbx
+  802a45:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a49:	48 63 ce             	movslq %esi,%rcx
+  802a4c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a4f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a59:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802a63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a69:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a6f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a71:	48 85 c0             	test   %rax,%rax
+  802a74:	7f 06                	jg     802a7c <sys_env_set_nice+0x3c>
+}
+  802a76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a7a:	c9                   	leave
+  802a7b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a7c:	49 89 c0             	mov    %rax,%r8
+  802a7f:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a84:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802a8b:	00 00 00 
+  802a8e:	be 27 00 00 00       	mov    $0x27,%esi
+  802a93:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802a9a:	00 00 00 
+  802a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa2:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802aa9:	00 00 00 
+  802aac:	41 ff d1             	call   *%r9
+
+0000000000802aaf <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802aaf:	55                   	push   %rbp
+  802ab0:	48 89 e5             	mov    %rsp,%rbp
+  802ab3:	53                   	push   %rbx
+  802ab4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ab7:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802abc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ac1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802acb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ad6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802adc:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ade:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ae2:	c9                   	leave
+  802ae3:	c3                   	ret
+
+0000000000802ae4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ae4:	55                   	push   %rbp
+  802ae5:	48 89 e5             	mov    %rsp,%rbp
+  802ae8:	53                   	push   %rbx
+  802ae9:	89 f8                	mov    %edi,%eax
+  802aeb:	49 89 f1             	mov    %rsi,%r9
+  802aee:	48 89 d3             	mov    %rdx,%rbx
+  802af1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802af4:	49 63 f0             	movslq %r8d,%rsi
+  802af7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802afa:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802aff:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b0e:	cd 30                	int    $0x30
+}
+  802b10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b14:	c9                   	leave
+  802b15:	c3                   	ret
+
+0000000000802b16 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b16:	55                   	push   %rbp
+  802b17:	48 89 e5             	mov    %rsp,%rbp
+  802b1a:	53                   	push   %rbx
+  802b1b:	89 f8                	mov    %edi,%eax
+  802b1d:	49 89 f1             	mov    %rsi,%r9
+  802b20:	48 89 d3             	mov    %rdx,%rbx
+  802b23:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b26:	49 63 f0             	movslq %r8d,%rsi
+  802b29:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b2c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b31:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b40:	cd 30                	int    $0x30
+}
+  802b42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b46:	c9                   	leave
+  802b47:	c3                   	ret
+
+0000000000802b48 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b48:	55                   	push   %rbp
+  802b49:	48 89 e5             	mov    %rsp,%rbp
+  802b4c:	53                   	push   %rbx
+  802b4d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b51:	89 f8                	mov    %edi,%eax
+  802b53:	49 89 f2             	mov    %rsi,%r10
+  802b56:	48 89 d3             	mov    %rdx,%rbx
+  802b59:	48 89 cf             	mov    %rcx,%rdi
+  802b5c:	44 89 c6             	mov    %r8d,%esi
+  802b5f:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b62:	48 63 f6             	movslq %esi,%rsi
+  802b65:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b68:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b6d:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b70:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b74:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b76:	48 85 c0             	test   %rax,%rax
+  802b79:	7f 06                	jg     802b81 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7f:	c9                   	leave
+  802b80:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b81:	49 89 c0             	mov    %rax,%r8
+  802b84:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b89:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802b90:	00 00 00 
+  802b93:	be 27 00 00 00       	mov    $0x27,%esi
+  802b98:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802b9f:	00 00 00 
+  802ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba7:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802bae:	00 00 00 
+  802bb1:	41 ff d1             	call   *%r9
+
+0000000000802bb4 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bb4:	55                   	push   %rbp
+  802bb5:	48 89 e5             	mov    %rsp,%rbp
+  802bb8:	53                   	push   %rbx
+  802bb9:	48 83 ec 08          	sub    $0x8,%rsp
+  802bbd:	48 89 f1             	mov    %rsi,%rcx
+  802bc0:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bc3:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bc7:	48 8b 1a             	mov    (%rdx),%rbx
+  802bca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bcd:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd2:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd6:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bda:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bde:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be0:	48 85 c0             	test   %rax,%rax
+  802be3:	7f 06                	jg     802beb <sys_ipc_call_short+0x37>
+}
+  802be5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be9:	c9                   	leave
+  802bea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802beb:	49 89 c0             	mov    %rax,%r8
+  802bee:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bf3:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802bfa:	00 00 00 
+  802bfd:	be 27 00 00 00       	mov    $0x27,%esi
+  802c02:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802c09:	00 00 00 
+  802c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c11:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802c18:	00 00 00 
+  802c1b:	41 ff d1             	call   *%r9
+
+0000000000802c1e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c1e:	55                   	push   %rbp
+  802c1f:	48 89 e5             	mov    %rsp,%rbp
+  802c22:	53                   	push   %rbx
+  802c23:	48 83 ec 08          	sub    $0x8,%rsp
+  802c27:	89 f8                	mov    %edi,%eax
+  802c29:	49 89 f2             	mov    %rsi,%r10
+  802c2c:	48 89 d3             	mov    %rdx,%rbx
+  802c2f:	48 89 cf             	mov    %rcx,%rdi
+  802c32:	44 89 c6             	mov    %r8d,%esi
+  802c35:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c38:	48 63 f6             	movslq %esi,%rsi
+  802c3b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c3e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c43:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c46:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c4a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c4c:	48 85 c0             	test   %rax,%rax
+  802c4f:	7f 06                	jg     802c57 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c55:	c9                   	leave
+  802c56:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c57:	49 89 c0             	mov    %rax,%r8
+  802c5a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c5f:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802c66:	00 00 00 
+  802c69:	be 27 00 00 00       	mov    $0x27,%esi
+  802c6e:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802c75:	00 00 00 
+  802c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7d:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802c84:	00 00 00 
+  802c87:	41 ff d1             	call   *%r9
+
+0000000000802c8a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c8a:	55                   	push   %rbp
+  802c8b:	48 89 e5             	mov    %rsp,%rbp
+  802c8e:	53                   	push   %rbx
+  802c8f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c93:	48 89 fa             	mov    %rdi,%rdx
+  802c96:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c99:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ca8:	be 00 00 00 00       	mov    $0x0,%esi
+  802cad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cb9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cbb:	48 85 c0             	test   %rax,%rax
+  802cbe:	7f 06                	jg     802cc6 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cc0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc4:	c9                   	leave
+  802cc5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cc6:	49 89 c0             	mov    %rax,%r8
+  802cc9:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cce:	48 ba 68 61 80 00 00 	movabs $0x806168,%rdx
+  802cd5:	00 00 00 
+  802cd8:	be 27 00 00 00       	mov    $0x27,%esi
+  802cdd:	48 bf 87 61 80 00 00 	movabs $0x806187,%rdi
+  802ce4:	00 00 00 
+  802ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cec:	49 b9 90 50 80 00 00 	movabs $0x805090,%r9
+  802cf3:	00 00 00 
+  802cf6:	41 ff d1             	call   *%r9
+
+0000000000802cf9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cf9:	55                   	push   %rbp
+  802cfa:	48 89 e5             	mov    %rsp,%rbp
+  802cfd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cfe:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d03:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d17:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d22:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d28:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d2e:	c9                   	leave
+  802d2f:	c3                   	ret
+
+0000000000802d30 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d30:	55                   	push   %rbp
+  802d31:	48 89 e5             	mov    %rsp,%rbp
+  802d34:	53                   	push   %rbx
+  802d35:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d38:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d47:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d5d:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d63:	c9                   	leave
+  802d64:	c3                   	ret
+
+0000000000802d65 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d65:	55                   	push   %rbp
+  802d66:	48 89 e5             	mov    %rsp,%rbp
+  802d69:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d74:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d83:	be 00 00 00 00       	mov    $0x0,%esi
+  802d88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d8e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d94:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d9a:	c9                   	leave
+  802d9b:	c3                   	ret
+
+0000000000802d9c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d9c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802da3:	ff ff ff 
+  802da6:	48 01 f8             	add    %rdi,%rax
+  802da9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802dad:	c3                   	ret
+
+0000000000802dae <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dae:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802db5:	ff ff ff 
+  802db8:	48 01 f8             	add    %rdi,%rax
+  802dbb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802dbf:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dc5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dc9:	c3                   	ret
+
+0000000000802dca <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+  802dce:	41 57                	push   %r15
+  802dd0:	41 56                	push   %r14
+  802dd2:	41 55                	push   %r13
+  802dd4:	41 54                	push   %r12
+  802dd6:	53                   	push   %rbx
+  802dd7:	48 83 ec 08          	sub    $0x8,%rsp
+  802ddb:	49 89 ff             	mov    %rdi,%r15
+  802dde:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802de3:	49 bd ca 42 80 00 00 	movabs $0x8042ca,%r13
+  802dea:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802ded:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802df3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802df6:	48 89 df             	mov    %rbx,%rdi
+  802df9:	41 ff d5             	call   *%r13
+  802dfc:	83 e0 04             	and    $0x4,%eax
+  802dff:	74 17                	je     802e18 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e01:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e08:	4c 39 f3             	cmp    %r14,%rbx
+  802e0b:	75 e6                	jne    802df3 <fd_alloc+0x29>
+  802e0d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e13:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e18:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e1b:	48 83 c4 08          	add    $0x8,%rsp
+  802e1f:	5b                   	pop    %rbx
+  802e20:	41 5c                	pop    %r12
+  802e22:	41 5d                	pop    %r13
+  802e24:	41 5e                	pop    %r14
+  802e26:	41 5f                	pop    %r15
+  802e28:	5d                   	pop    %rbp
+  802e29:	c3                   	ret
+
+0000000000802e2a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e2a:	83 ff 1f             	cmp    $0x1f,%edi
+  802e2d:	77 39                	ja     802e68 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e2f:	55                   	push   %rbp
+  802e30:	48 89 e5             	mov    %rsp,%rbp
+  802e33:	41 54                	push   %r12
+  802e35:	53                   	push   %rbx
+  802e36:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e39:	48 63 df             	movslq %edi,%rbx
+  802e3c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e43:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e47:	48 89 df             	mov    %rbx,%rdi
+  802e4a:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  802e51:	00 00 00 
+  802e54:	ff d0                	call   *%rax
+  802e56:	a8 04                	test   $0x4,%al
+  802e58:	74 14                	je     802e6e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e5a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e63:	5b                   	pop    %rbx
+  802e64:	41 5c                	pop    %r12
+  802e66:	5d                   	pop    %rbp
+  802e67:	c3                   	ret
+        return -E_INVAL;
+  802e68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e6d:	c3                   	ret
+        return -E_INVAL;
+  802e6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e73:	eb ee                	jmp    802e63 <fd_lookup+0x39>
+
+0000000000802e75 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e75:	55                   	push   %rbp
+  802e76:	48 89 e5             	mov    %rsp,%rbp
+  802e79:	41 54                	push   %r12
+  802e7b:	53                   	push   %rbx
+  802e7c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e7f:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  802e86:	00 00 00 
+  802e89:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e90:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e93:	39 3b                	cmp    %edi,(%rbx)
+  802e95:	74 47                	je     802ede <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e97:	48 83 c0 08          	add    $0x8,%rax
+  802e9b:	48 8b 18             	mov    (%rax),%rbx
+  802e9e:	48 85 db             	test   %rbx,%rbx
+  802ea1:	75 f0                	jne    802e93 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ea3:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802eaa:	00 00 00 
+  802ead:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802eb3:	89 fa                	mov    %edi,%edx
+  802eb5:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  802ebc:	00 00 00 
+  802ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec4:	48 b9 a2 16 80 00 00 	movabs $0x8016a2,%rcx
+  802ecb:	00 00 00 
+  802ece:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ed0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ed5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ed9:	5b                   	pop    %rbx
+  802eda:	41 5c                	pop    %r12
+  802edc:	5d                   	pop    %rbp
+  802edd:	c3                   	ret
+            return 0;
+  802ede:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee3:	eb f0                	jmp    802ed5 <dev_lookup+0x60>
+
+0000000000802ee5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ee5:	55                   	push   %rbp
+  802ee6:	48 89 e5             	mov    %rsp,%rbp
+  802ee9:	41 55                	push   %r13
+  802eeb:	41 54                	push   %r12
+  802eed:	53                   	push   %rbx
+  802eee:	48 83 ec 18          	sub    $0x18,%rsp
+  802ef2:	48 89 fb             	mov    %rdi,%rbx
+  802ef5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ef8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802eff:	ff ff ff 
+  802f02:	48 01 df             	add    %rbx,%rdi
+  802f05:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f09:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f0d:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+  802f19:	41 89 c5             	mov    %eax,%r13d
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	78 06                	js     802f26 <fd_close+0x41>
+  802f20:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f24:	74 1a                	je     802f40 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f26:	45 84 e4             	test   %r12b,%r12b
+  802f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f32:	44 89 e8             	mov    %r13d,%eax
+  802f35:	48 83 c4 18          	add    $0x18,%rsp
+  802f39:	5b                   	pop    %rbx
+  802f3a:	41 5c                	pop    %r12
+  802f3c:	41 5d                	pop    %r13
+  802f3e:	5d                   	pop    %rbp
+  802f3f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f40:	8b 3b                	mov    (%rbx),%edi
+  802f42:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f46:	48 b8 75 2e 80 00 00 	movabs $0x802e75,%rax
+  802f4d:	00 00 00 
+  802f50:	ff d0                	call   *%rax
+  802f52:	41 89 c5             	mov    %eax,%r13d
+  802f55:	85 c0                	test   %eax,%eax
+  802f57:	78 1b                	js     802f74 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f5d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f61:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f67:	48 85 c0             	test   %rax,%rax
+  802f6a:	74 08                	je     802f74 <fd_close+0x8f>
+  802f6c:	48 89 df             	mov    %rbx,%rdi
+  802f6f:	ff d0                	call   *%rax
+  802f71:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f79:	48 89 de             	mov    %rbx,%rsi
+  802f7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f81:	48 b8 16 28 80 00 00 	movabs $0x802816,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+    return res;
+  802f8d:	eb a3                	jmp    802f32 <fd_close+0x4d>
+
+0000000000802f8f <close>:
+
+int
+close(int fdnum) {
+  802f8f:	55                   	push   %rbp
+  802f90:	48 89 e5             	mov    %rsp,%rbp
+  802f93:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f9b:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  802fa2:	00 00 00 
+  802fa5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	78 15                	js     802fc0 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fab:	be 01 00 00 00       	mov    $0x1,%esi
+  802fb0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb4:	48 b8 e5 2e 80 00 00 	movabs $0x802ee5,%rax
+  802fbb:	00 00 00 
+  802fbe:	ff d0                	call   *%rax
+}
+  802fc0:	c9                   	leave
+  802fc1:	c3                   	ret
+
+0000000000802fc2 <close_all>:
+
+void
+close_all(void) {
+  802fc2:	55                   	push   %rbp
+  802fc3:	48 89 e5             	mov    %rsp,%rbp
+  802fc6:	41 54                	push   %r12
+  802fc8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fce:	49 bc 8f 2f 80 00 00 	movabs $0x802f8f,%r12
+  802fd5:	00 00 00 
+  802fd8:	89 df                	mov    %ebx,%edi
+  802fda:	41 ff d4             	call   *%r12
+  802fdd:	83 c3 01             	add    $0x1,%ebx
+  802fe0:	83 fb 20             	cmp    $0x20,%ebx
+  802fe3:	75 f3                	jne    802fd8 <close_all+0x16>
+}
+  802fe5:	5b                   	pop    %rbx
+  802fe6:	41 5c                	pop    %r12
+  802fe8:	5d                   	pop    %rbp
+  802fe9:	c3                   	ret
+
+0000000000802fea <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fea:	55                   	push   %rbp
+  802feb:	48 89 e5             	mov    %rsp,%rbp
+  802fee:	41 57                	push   %r15
+  802ff0:	41 56                	push   %r14
+  802ff2:	41 55                	push   %r13
+  802ff4:	41 54                	push   %r12
+  802ff6:	53                   	push   %rbx
+  802ff7:	48 83 ec 18          	sub    $0x18,%rsp
+  802ffb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802ffe:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803002:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+  80300e:	89 c3                	mov    %eax,%ebx
+  803010:	85 c0                	test   %eax,%eax
+  803012:	0f 88 b8 00 00 00    	js     8030d0 <dup+0xe6>
+    close(newfdnum);
+  803018:	44 89 e7             	mov    %r12d,%edi
+  80301b:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  803022:	00 00 00 
+  803025:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803027:	4d 63 ec             	movslq %r12d,%r13
+  80302a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803031:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803035:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803039:	4c 89 ff             	mov    %r15,%rdi
+  80303c:	49 be ae 2d 80 00 00 	movabs $0x802dae,%r14
+  803043:	00 00 00 
+  803046:	41 ff d6             	call   *%r14
+  803049:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80304c:	4c 89 ef             	mov    %r13,%rdi
+  80304f:	41 ff d6             	call   *%r14
+  803052:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803055:	48 89 df             	mov    %rbx,%rdi
+  803058:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  80305f:	00 00 00 
+  803062:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803064:	a8 04                	test   $0x4,%al
+  803066:	74 2b                	je     803093 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803068:	41 89 c1             	mov    %eax,%r9d
+  80306b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803071:	4c 89 f1             	mov    %r14,%rcx
+  803074:	ba 00 00 00 00       	mov    $0x0,%edx
+  803079:	48 89 de             	mov    %rbx,%rsi
+  80307c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803081:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+  80308d:	89 c3                	mov    %eax,%ebx
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	78 4e                	js     8030e1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803093:	4c 89 ff             	mov    %r15,%rdi
+  803096:	48 b8 ca 42 80 00 00 	movabs $0x8042ca,%rax
+  80309d:	00 00 00 
+  8030a0:	ff d0                	call   *%rax
+  8030a2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030a5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030ab:	4c 89 e9             	mov    %r13,%rcx
+  8030ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b3:	4c 89 fe             	mov    %r15,%rsi
+  8030b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030bb:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  8030c2:	00 00 00 
+  8030c5:	ff d0                	call   *%rax
+  8030c7:	89 c3                	mov    %eax,%ebx
+  8030c9:	85 c0                	test   %eax,%eax
+  8030cb:	78 14                	js     8030e1 <dup+0xf7>
+
+    return newfdnum;
+  8030cd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030d0:	89 d8                	mov    %ebx,%eax
+  8030d2:	48 83 c4 18          	add    $0x18,%rsp
+  8030d6:	5b                   	pop    %rbx
+  8030d7:	41 5c                	pop    %r12
+  8030d9:	41 5d                	pop    %r13
+  8030db:	41 5e                	pop    %r14
+  8030dd:	41 5f                	pop    %r15
+  8030df:	5d                   	pop    %rbp
+  8030e0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e6:	4c 89 ee             	mov    %r13,%rsi
+  8030e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ee:	49 bc 16 28 80 00 00 	movabs $0x802816,%r12
+  8030f5:	00 00 00 
+  8030f8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803100:	4c 89 f6             	mov    %r14,%rsi
+  803103:	bf 00 00 00 00       	mov    $0x0,%edi
+  803108:	41 ff d4             	call   *%r12
+    return res;
+  80310b:	eb c3                	jmp    8030d0 <dup+0xe6>
+
+000000000080310d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80310d:	55                   	push   %rbp
+  80310e:	48 89 e5             	mov    %rsp,%rbp
+  803111:	41 56                	push   %r14
+  803113:	41 55                	push   %r13
+  803115:	41 54                	push   %r12
+  803117:	53                   	push   %rbx
+  803118:	48 83 ec 10          	sub    $0x10,%rsp
+  80311c:	89 fb                	mov    %edi,%ebx
+  80311e:	49 89 f4             	mov    %rsi,%r12
+  803121:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803124:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803128:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+  803134:	85 c0                	test   %eax,%eax
+  803136:	78 4c                	js     803184 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803138:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80313c:	41 8b 3e             	mov    (%r14),%edi
+  80313f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803143:	48 b8 75 2e 80 00 00 	movabs $0x802e75,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+  80314f:	85 c0                	test   %eax,%eax
+  803151:	78 35                	js     803188 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803153:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803157:	83 e0 03             	and    $0x3,%eax
+  80315a:	83 f8 01             	cmp    $0x1,%eax
+  80315d:	74 2d                	je     80318c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80315f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803163:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803167:	48 85 c0             	test   %rax,%rax
+  80316a:	74 56                	je     8031c2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80316c:	4c 89 ea             	mov    %r13,%rdx
+  80316f:	4c 89 e6             	mov    %r12,%rsi
+  803172:	4c 89 f7             	mov    %r14,%rdi
+  803175:	ff d0                	call   *%rax
+}
+  803177:	48 83 c4 10          	add    $0x10,%rsp
+  80317b:	5b                   	pop    %rbx
+  80317c:	41 5c                	pop    %r12
+  80317e:	41 5d                	pop    %r13
+  803180:	41 5e                	pop    %r14
+  803182:	5d                   	pop    %rbp
+  803183:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803184:	48 98                	cltq
+  803186:	eb ef                	jmp    803177 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803188:	48 98                	cltq
+  80318a:	eb eb                	jmp    803177 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80318c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803193:	00 00 00 
+  803196:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80319c:	89 da                	mov    %ebx,%edx
+  80319e:	48 bf d9 61 80 00 00 	movabs $0x8061d9,%rdi
+  8031a5:	00 00 00 
+  8031a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ad:	48 b9 a2 16 80 00 00 	movabs $0x8016a2,%rcx
+  8031b4:	00 00 00 
+  8031b7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031b9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031c0:	eb b5                	jmp    803177 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031c2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031c9:	eb ac                	jmp    803177 <read+0x6a>
+
+00000000008031cb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031cb:	55                   	push   %rbp
+  8031cc:	48 89 e5             	mov    %rsp,%rbp
+  8031cf:	41 57                	push   %r15
+  8031d1:	41 56                	push   %r14
+  8031d3:	41 55                	push   %r13
+  8031d5:	41 54                	push   %r12
+  8031d7:	53                   	push   %rbx
+  8031d8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031dc:	48 85 d2             	test   %rdx,%rdx
+  8031df:	74 54                	je     803235 <readn+0x6a>
+  8031e1:	41 89 fd             	mov    %edi,%r13d
+  8031e4:	49 89 f6             	mov    %rsi,%r14
+  8031e7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031ef:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031f4:	49 bf 0d 31 80 00 00 	movabs $0x80310d,%r15
+  8031fb:	00 00 00 
+  8031fe:	4c 89 e2             	mov    %r12,%rdx
+  803201:	48 29 f2             	sub    %rsi,%rdx
+  803204:	4c 01 f6             	add    %r14,%rsi
+  803207:	44 89 ef             	mov    %r13d,%edi
+  80320a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80320d:	85 c0                	test   %eax,%eax
+  80320f:	78 20                	js     803231 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803211:	01 c3                	add    %eax,%ebx
+  803213:	85 c0                	test   %eax,%eax
+  803215:	74 08                	je     80321f <readn+0x54>
+  803217:	48 63 f3             	movslq %ebx,%rsi
+  80321a:	4c 39 e6             	cmp    %r12,%rsi
+  80321d:	72 df                	jb     8031fe <readn+0x33>
+    }
+    return res;
+  80321f:	48 63 c3             	movslq %ebx,%rax
+}
+  803222:	48 83 c4 08          	add    $0x8,%rsp
+  803226:	5b                   	pop    %rbx
+  803227:	41 5c                	pop    %r12
+  803229:	41 5d                	pop    %r13
+  80322b:	41 5e                	pop    %r14
+  80322d:	41 5f                	pop    %r15
+  80322f:	5d                   	pop    %rbp
+  803230:	c3                   	ret
+        if (inc < 0) return inc;
+  803231:	48 98                	cltq
+  803233:	eb ed                	jmp    803222 <readn+0x57>
+    int inc = 1, res = 0;
+  803235:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80323a:	eb e3                	jmp    80321f <readn+0x54>
+
+000000000080323c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80323c:	55                   	push   %rbp
+  80323d:	48 89 e5             	mov    %rsp,%rbp
+  803240:	41 56                	push   %r14
+  803242:	41 55                	push   %r13
+  803244:	41 54                	push   %r12
+  803246:	53                   	push   %rbx
+  803247:	48 83 ec 10          	sub    $0x10,%rsp
+  80324b:	89 fb                	mov    %edi,%ebx
+  80324d:	49 89 f4             	mov    %rsi,%r12
+  803250:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803253:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803257:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+  803263:	85 c0                	test   %eax,%eax
+  803265:	78 47                	js     8032ae <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803267:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80326b:	41 8b 3e             	mov    (%r14),%edi
+  80326e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803272:	48 b8 75 2e 80 00 00 	movabs $0x802e75,%rax
+  803279:	00 00 00 
+  80327c:	ff d0                	call   *%rax
+  80327e:	85 c0                	test   %eax,%eax
+  803280:	78 30                	js     8032b2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803282:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803287:	74 2d                	je     8032b6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803289:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80328d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803291:	48 85 c0             	test   %rax,%rax
+  803294:	74 56                	je     8032ec <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803296:	4c 89 ea             	mov    %r13,%rdx
+  803299:	4c 89 e6             	mov    %r12,%rsi
+  80329c:	4c 89 f7             	mov    %r14,%rdi
+  80329f:	ff d0                	call   *%rax
+}
+  8032a1:	48 83 c4 10          	add    $0x10,%rsp
+  8032a5:	5b                   	pop    %rbx
+  8032a6:	41 5c                	pop    %r12
+  8032a8:	41 5d                	pop    %r13
+  8032aa:	41 5e                	pop    %r14
+  8032ac:	5d                   	pop    %rbp
+  8032ad:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032ae:	48 98                	cltq
+  8032b0:	eb ef                	jmp    8032a1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032b2:	48 98                	cltq
+  8032b4:	eb eb                	jmp    8032a1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032b6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032bd:	00 00 00 
+  8032c0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032c6:	89 da                	mov    %ebx,%edx
+  8032c8:	48 bf f5 61 80 00 00 	movabs $0x8061f5,%rdi
+  8032cf:	00 00 00 
+  8032d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d7:	48 b9 a2 16 80 00 00 	movabs $0x8016a2,%rcx
+  8032de:	00 00 00 
+  8032e1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032e3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ea:	eb b5                	jmp    8032a1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032ec:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032f3:	eb ac                	jmp    8032a1 <write+0x65>
+
+00000000008032f5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032f5:	55                   	push   %rbp
+  8032f6:	48 89 e5             	mov    %rsp,%rbp
+  8032f9:	53                   	push   %rbx
+  8032fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8032fe:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803300:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803304:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  80330b:	00 00 00 
+  80330e:	ff d0                	call   *%rax
+  803310:	85 c0                	test   %eax,%eax
+  803312:	78 0c                	js     803320 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803318:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80331b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803320:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803324:	c9                   	leave
+  803325:	c3                   	ret
+
+0000000000803326 <tell>:
+
+int tell(int fdnum) {
+  803326:	55                   	push   %rbp
+  803327:	48 89 e5             	mov    %rsp,%rbp
+  80332a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80332e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803332:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  803339:	00 00 00 
+  80333c:	ff d0                	call   *%rax
+  80333e:	85 c0                	test   %eax,%eax
+  803340:	78 07                	js     803349 <tell+0x23>
+
+    return fd->fd_offset;
+  803342:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803346:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803349:	c9                   	leave
+  80334a:	c3                   	ret
+
+000000000080334b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80334b:	55                   	push   %rbp
+  80334c:	48 89 e5             	mov    %rsp,%rbp
+  80334f:	41 55                	push   %r13
+  803351:	41 54                	push   %r12
+  803353:	53                   	push   %rbx
+  803354:	48 83 ec 18          	sub    $0x18,%rsp
+  803358:	89 fb                	mov    %edi,%ebx
+  80335a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80335d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803361:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  803368:	00 00 00 
+  80336b:	ff d0                	call   *%rax
+  80336d:	85 c0                	test   %eax,%eax
+  80336f:	78 38                	js     8033a9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803371:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803375:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803379:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80337d:	48 b8 75 2e 80 00 00 	movabs $0x802e75,%rax
+  803384:	00 00 00 
+  803387:	ff d0                	call   *%rax
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	78 1c                	js     8033a9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80338d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803392:	74 20                	je     8033b4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803394:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803398:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80339c:	48 85 c0             	test   %rax,%rax
+  80339f:	74 47                	je     8033e8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8033a1:	44 89 e6             	mov    %r12d,%esi
+  8033a4:	4c 89 ef             	mov    %r13,%rdi
+  8033a7:	ff d0                	call   *%rax
+}
+  8033a9:	48 83 c4 18          	add    $0x18,%rsp
+  8033ad:	5b                   	pop    %rbx
+  8033ae:	41 5c                	pop    %r12
+  8033b0:	41 5d                	pop    %r13
+  8033b2:	5d                   	pop    %rbp
+  8033b3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033b4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033bb:	00 00 00 
+  8033be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033c4:	89 da                	mov    %ebx,%edx
+  8033c6:	48 bf b8 61 80 00 00 	movabs $0x8061b8,%rdi
+  8033cd:	00 00 00 
+  8033d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d5:	48 b9 a2 16 80 00 00 	movabs $0x8016a2,%rcx
+  8033dc:	00 00 00 
+  8033df:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033e6:	eb c1                	jmp    8033a9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033e8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033ed:	eb ba                	jmp    8033a9 <ftruncate+0x5e>
+
+00000000008033ef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033ef:	55                   	push   %rbp
+  8033f0:	48 89 e5             	mov    %rsp,%rbp
+  8033f3:	41 54                	push   %r12
+  8033f5:	53                   	push   %rbx
+  8033f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8033fa:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033fd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803401:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  803408:	00 00 00 
+  80340b:	ff d0                	call   *%rax
+  80340d:	85 c0                	test   %eax,%eax
+  80340f:	78 63                	js     803474 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803411:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803415:	41 8b 3c 24          	mov    (%r12),%edi
+  803419:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80341d:	48 b8 75 2e 80 00 00 	movabs $0x802e75,%rax
+  803424:	00 00 00 
+  803427:	ff d0                	call   *%rax
+  803429:	85 c0                	test   %eax,%eax
+  80342b:	78 47                	js     803474 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80342d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803431:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803436:	74 45                	je     80347d <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803438:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80343b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803442:	00 00 00 
+    stat->st_isdir = 0;
+  803445:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80344c:	00 00 00 
+    stat->st_ino = 0;
+  80344f:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803456:	00 00 00 00 
+    stat->st_version = 0;
+  80345a:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803461:	00 00 00 
+    stat->st_dev = dev;
+  803464:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80346b:	48 89 de             	mov    %rbx,%rsi
+  80346e:	4c 89 e7             	mov    %r12,%rdi
+  803471:	ff 50 28             	call   *0x28(%rax)
+}
+  803474:	48 83 c4 10          	add    $0x10,%rsp
+  803478:	5b                   	pop    %rbx
+  803479:	41 5c                	pop    %r12
+  80347b:	5d                   	pop    %rbp
+  80347c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80347d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803482:	eb f0                	jmp    803474 <fstat+0x85>
+
+0000000000803484 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803484:	55                   	push   %rbp
+  803485:	48 89 e5             	mov    %rsp,%rbp
+  803488:	41 54                	push   %r12
+  80348a:	53                   	push   %rbx
+  80348b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80348e:	be 00 00 00 00       	mov    $0x0,%esi
+  803493:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  80349a:	00 00 00 
+  80349d:	ff d0                	call   *%rax
+  80349f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034a1:	85 c0                	test   %eax,%eax
+  8034a3:	78 25                	js     8034ca <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034a5:	4c 89 e6             	mov    %r12,%rsi
+  8034a8:	89 c7                	mov    %eax,%edi
+  8034aa:	48 b8 ef 33 80 00 00 	movabs $0x8033ef,%rax
+  8034b1:	00 00 00 
+  8034b4:	ff d0                	call   *%rax
+  8034b6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034b9:	89 df                	mov    %ebx,%edi
+  8034bb:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  8034c2:	00 00 00 
+  8034c5:	ff d0                	call   *%rax
+
+    return res;
+  8034c7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034ca:	89 d8                	mov    %ebx,%eax
+  8034cc:	5b                   	pop    %rbx
+  8034cd:	41 5c                	pop    %r12
+  8034cf:	5d                   	pop    %rbp
+  8034d0:	c3                   	ret
+
+00000000008034d1 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034d1:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034d8:	00 00 00 
+  8034db:	83 38 00             	cmpl   $0x0,(%rax)
+  8034de:	74 0a                	je     8034ea <fsipc_env+0x19>
+    return fsenv;
+}
+  8034e0:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034e7:	00 00 
+  8034e9:	c3                   	ret
+fsipc_env(void) {
+  8034ea:	55                   	push   %rbp
+  8034eb:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ee:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034f3:	48 b8 77 56 80 00 00 	movabs $0x805677,%rax
+  8034fa:	00 00 00 
+  8034fd:	ff d0                	call   *%rax
+  8034ff:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803506:	00 00 
+}
+  803508:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80350f:	00 00 
+  803511:	5d                   	pop    %rbp
+  803512:	c3                   	ret
+
+0000000000803513 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803513:	55                   	push   %rbp
+  803514:	48 89 e5             	mov    %rsp,%rbp
+  803517:	53                   	push   %rbx
+  803518:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80351c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803523:	00 
+  803524:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80352b:	00 
+  80352c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803533:	00 
+  803534:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80353b:	00 
+  80353c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803543:	00 
+
+    assert(size <= sizeof(words));
+  803544:	48 83 fa 28          	cmp    $0x28,%rdx
+  803548:	77 38                	ja     803582 <fsipc_short+0x6f>
+  80354a:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80354c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803550:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  803557:	00 00 00 
+  80355a:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80355c:	48 b8 d1 34 80 00 00 	movabs $0x8034d1,%rax
+  803563:	00 00 00 
+  803566:	ff d0                	call   *%rax
+  803568:	89 c7                	mov    %eax,%edi
+  80356a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80356e:	89 de                	mov    %ebx,%esi
+  803570:	48 b8 da 55 80 00 00 	movabs $0x8055da,%rax
+  803577:	00 00 00 
+  80357a:	ff d0                	call   *%rax
+}
+  80357c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803580:	c9                   	leave
+  803581:	c3                   	ret
+    assert(size <= sizeof(words));
+  803582:	48 b9 40 62 80 00 00 	movabs $0x806240,%rcx
+  803589:	00 00 00 
+  80358c:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803593:	00 00 00 
+  803596:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80359b:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  8035a2:	00 00 00 
+  8035a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035aa:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  8035b1:	00 00 00 
+  8035b4:	41 ff d0             	call   *%r8
+
+00000000008035b7 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035b7:	55                   	push   %rbp
+  8035b8:	48 89 e5             	mov    %rsp,%rbp
+  8035bb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035bf:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035c2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035c5:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035c8:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035cd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035d1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035d6:	48 b8 13 35 80 00 00 	movabs $0x803513,%rax
+  8035dd:	00 00 00 
+  8035e0:	ff d0                	call   *%rax
+}
+  8035e2:	c9                   	leave
+  8035e3:	c3                   	ret
+
+00000000008035e4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035e4:	55                   	push   %rbp
+  8035e5:	48 89 e5             	mov    %rsp,%rbp
+  8035e8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035ec:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035f2:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035f7:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035fb:	bf 06 00 00 00       	mov    $0x6,%edi
+  803600:	48 b8 13 35 80 00 00 	movabs $0x803513,%rax
+  803607:	00 00 00 
+  80360a:	ff d0                	call   *%rax
+}
+  80360c:	c9                   	leave
+  80360d:	c3                   	ret
+
+000000000080360e <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80360e:	55                   	push   %rbp
+  80360f:	48 89 e5             	mov    %rsp,%rbp
+  803612:	41 54                	push   %r12
+  803614:	53                   	push   %rbx
+  803615:	48 83 ec 10          	sub    $0x10,%rsp
+  803619:	89 fb                	mov    %edi,%ebx
+  80361b:	49 89 f4             	mov    %rsi,%r12
+  80361e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803622:	48 b8 d1 34 80 00 00 	movabs $0x8034d1,%rax
+  803629:	00 00 00 
+  80362c:	ff d0                	call   *%rax
+  80362e:	89 c7                	mov    %eax,%edi
+  803630:	6a 00                	push   $0x0
+  803632:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803636:	50                   	push   %rax
+  803637:	4d 89 e1             	mov    %r12,%r9
+  80363a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803640:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803645:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80364c:	00 00 00 
+  80364f:	89 de                	mov    %ebx,%esi
+  803651:	48 b8 75 55 80 00 00 	movabs $0x805575,%rax
+  803658:	00 00 00 
+  80365b:	ff d0                	call   *%rax
+}
+  80365d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803661:	5b                   	pop    %rbx
+  803662:	41 5c                	pop    %r12
+  803664:	5d                   	pop    %rbp
+  803665:	c3                   	ret
+
+0000000000803666 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803666:	55                   	push   %rbp
+  803667:	48 89 e5             	mov    %rsp,%rbp
+  80366a:	41 54                	push   %r12
+  80366c:	53                   	push   %rbx
+  80366d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803670:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803673:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80367a:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80367c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803681:	be 00 00 00 00       	mov    $0x0,%esi
+  803686:	bf 05 00 00 00       	mov    $0x5,%edi
+  80368b:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803697:	85 c0                	test   %eax,%eax
+  803699:	78 5a                	js     8036f5 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80369b:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036a2:	00 00 00 
+  8036a5:	4c 89 e6             	mov    %r12,%rsi
+  8036a8:	48 89 df             	mov    %rbx,%rdi
+  8036ab:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  8036b2:	00 00 00 
+  8036b5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036b7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036be:	00 
+  8036bf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036c5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036cc:	00 
+  8036cd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036d3:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036da:	00 
+  8036db:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036e2:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036e9:	00 
+  8036ea:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f5:	5b                   	pop    %rbx
+  8036f6:	41 5c                	pop    %r12
+  8036f8:	5d                   	pop    %rbp
+  8036f9:	c3                   	ret
+
+00000000008036fa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036fa:	55                   	push   %rbp
+  8036fb:	48 89 e5             	mov    %rsp,%rbp
+  8036fe:	41 57                	push   %r15
+  803700:	41 56                	push   %r14
+  803702:	41 55                	push   %r13
+  803704:	41 54                	push   %r12
+  803706:	53                   	push   %rbx
+  803707:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80370b:	48 85 ff             	test   %rdi,%rdi
+  80370e:	0f 84 a1 00 00 00    	je     8037b5 <devfile_read+0xbb>
+  803714:	49 89 ff             	mov    %rdi,%r15
+  803717:	49 89 f5             	mov    %rsi,%r13
+  80371a:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  80371d:	48 85 f6             	test   %rsi,%rsi
+  803720:	0f 84 c4 00 00 00    	je     8037ea <devfile_read+0xf0>
+    size_t total_read = 0;
+  803726:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80372d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80372e:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803735:	00 00 00 
+  803738:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80373c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80373f:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803743:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803748:	be 00 00 00 00       	mov    $0x0,%esi
+  80374d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803752:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  803759:	00 00 00 
+  80375c:	ff d0                	call   *%rax
+        if (res < 0) {
+  80375e:	85 c0                	test   %eax,%eax
+  803760:	0f 88 b9 00 00 00    	js     80381f <devfile_read+0x125>
+        assert(res <= n);
+  803766:	48 63 d8             	movslq %eax,%rbx
+  803769:	49 39 dc             	cmp    %rbx,%r12
+  80376c:	0f 82 b1 00 00 00    	jb     803823 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803772:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803777:	0f 87 db 00 00 00    	ja     803858 <devfile_read+0x15e>
+        if (!res) {
+  80377d:	85 c0                	test   %eax,%eax
+  80377f:	74 21                	je     8037a2 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803781:	48 89 da             	mov    %rbx,%rdx
+  803784:	4c 89 f6             	mov    %r14,%rsi
+  803787:	4c 89 ef             	mov    %r13,%rdi
+  80378a:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+        total_read += res;
+  803796:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  80379a:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  80379d:	49 29 dc             	sub    %rbx,%r12
+  8037a0:	75 96                	jne    803738 <devfile_read+0x3e>
+    return total_read;
+  8037a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037a6:	48 83 c4 18          	add    $0x18,%rsp
+  8037aa:	5b                   	pop    %rbx
+  8037ab:	41 5c                	pop    %r12
+  8037ad:	41 5d                	pop    %r13
+  8037af:	41 5e                	pop    %r14
+  8037b1:	41 5f                	pop    %r15
+  8037b3:	5d                   	pop    %rbp
+  8037b4:	c3                   	ret
+    assert(fd);
+  8037b5:	48 b9 76 62 80 00 00 	movabs $0x806276,%rcx
+  8037bc:	00 00 00 
+  8037bf:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8037c6:	00 00 00 
+  8037c9:	be 91 00 00 00       	mov    $0x91,%esi
+  8037ce:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  8037d5:	00 00 00 
+  8037d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037dd:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  8037e4:	00 00 00 
+  8037e7:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037ea:	48 b9 79 62 80 00 00 	movabs $0x806279,%rcx
+  8037f1:	00 00 00 
+  8037f4:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  8037fb:	00 00 00 
+  8037fe:	be 92 00 00 00       	mov    $0x92,%esi
+  803803:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80380a:	00 00 00 
+  80380d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803812:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  803819:	00 00 00 
+  80381c:	41 ff d0             	call   *%r8
+            return res;
+  80381f:	48 98                	cltq
+  803821:	eb 83                	jmp    8037a6 <devfile_read+0xac>
+        assert(res <= n);
+  803823:	48 b9 7d 62 80 00 00 	movabs $0x80627d,%rcx
+  80382a:	00 00 00 
+  80382d:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803834:	00 00 00 
+  803837:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80383c:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  803843:	00 00 00 
+  803846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384b:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  803852:	00 00 00 
+  803855:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803858:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  80385f:	00 00 00 
+  803862:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803869:	00 00 00 
+  80386c:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803871:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  803878:	00 00 00 
+  80387b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803880:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  803887:	00 00 00 
+  80388a:	41 ff d0             	call   *%r8
+
+000000000080388d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80388d:	55                   	push   %rbp
+  80388e:	48 89 e5             	mov    %rsp,%rbp
+  803891:	41 57                	push   %r15
+  803893:	41 56                	push   %r14
+  803895:	41 55                	push   %r13
+  803897:	41 54                	push   %r12
+  803899:	53                   	push   %rbx
+  80389a:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  80389e:	48 85 ff             	test   %rdi,%rdi
+  8038a1:	0f 84 83 00 00 00    	je     80392a <devfile_write+0x9d>
+  8038a7:	49 89 ff             	mov    %rdi,%r15
+  8038aa:	49 89 f4             	mov    %rsi,%r12
+  8038ad:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038b0:	48 85 f6             	test   %rsi,%rsi
+  8038b3:	0f 84 a6 00 00 00    	je     80395f <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038b9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038bf:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038c6:	00 00 00 
+  8038c9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038cd:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038d0:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038d4:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038d9:	48 39 d3             	cmp    %rdx,%rbx
+  8038dc:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038e0:	4c 89 e6             	mov    %r12,%rsi
+  8038e3:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038ea:	00 00 00 
+  8038ed:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  8038f4:	00 00 00 
+  8038f7:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038fe:	be 00 00 00 00       	mov    $0x0,%esi
+  803903:	bf 04 00 00 00       	mov    $0x4,%edi
+  803908:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  80390f:	00 00 00 
+  803912:	ff d0                	call   *%rax
+        if (res < 0) {
+  803914:	85 c0                	test   %eax,%eax
+  803916:	78 7c                	js     803994 <devfile_write+0x107>
+        total_written += res;
+  803918:	48 98                	cltq
+  80391a:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  80391d:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803920:	48 29 c3             	sub    %rax,%rbx
+  803923:	75 a4                	jne    8038c9 <devfile_write+0x3c>
+    return total_written;
+  803925:	4c 89 e8             	mov    %r13,%rax
+  803928:	eb 6c                	jmp    803996 <devfile_write+0x109>
+    assert(fd);
+  80392a:	48 b9 76 62 80 00 00 	movabs $0x806276,%rcx
+  803931:	00 00 00 
+  803934:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80393b:	00 00 00 
+  80393e:	be bd 00 00 00       	mov    $0xbd,%esi
+  803943:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80394a:	00 00 00 
+  80394d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803952:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  803959:	00 00 00 
+  80395c:	41 ff d0             	call   *%r8
+    assert(buf);
+  80395f:	48 b9 79 62 80 00 00 	movabs $0x806279,%rcx
+  803966:	00 00 00 
+  803969:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  803970:	00 00 00 
+  803973:	be be 00 00 00       	mov    $0xbe,%esi
+  803978:	48 bf 6b 62 80 00 00 	movabs $0x80626b,%rdi
+  80397f:	00 00 00 
+  803982:	b8 00 00 00 00       	mov    $0x0,%eax
+  803987:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  80398e:	00 00 00 
+  803991:	41 ff d0             	call   *%r8
+            return res;
+  803994:	48 98                	cltq
+}
+  803996:	48 83 c4 08          	add    $0x8,%rsp
+  80399a:	5b                   	pop    %rbx
+  80399b:	41 5c                	pop    %r12
+  80399d:	41 5d                	pop    %r13
+  80399f:	41 5e                	pop    %r14
+  8039a1:	41 5f                	pop    %r15
+  8039a3:	5d                   	pop    %rbp
+  8039a4:	c3                   	ret
+
+00000000008039a5 <open>:
+open(const char *path, int mode) {
+  8039a5:	55                   	push   %rbp
+  8039a6:	48 89 e5             	mov    %rsp,%rbp
+  8039a9:	41 55                	push   %r13
+  8039ab:	41 54                	push   %r12
+  8039ad:	53                   	push   %rbx
+  8039ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8039b2:	49 89 fc             	mov    %rdi,%r12
+  8039b5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039b8:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  8039bf:	00 00 00 
+  8039c2:	ff d0                	call   *%rax
+  8039c4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039ca:	0f 87 8f 00 00 00    	ja     803a5f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039d0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039d4:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+  8039e0:	89 c3                	mov    %eax,%ebx
+  8039e2:	85 c0                	test   %eax,%eax
+  8039e4:	78 55                	js     803a3b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039e6:	4c 89 e6             	mov    %r12,%rsi
+  8039e9:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039f0:	00 00 00 
+  8039f3:	48 89 df             	mov    %rbx,%rdi
+  8039f6:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  8039fd:	00 00 00 
+  803a00:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a02:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a0e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a12:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a17:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  803a1e:	00 00 00 
+  803a21:	ff d0                	call   *%rax
+  803a23:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a25:	85 c0                	test   %eax,%eax
+  803a27:	78 1f                	js     803a48 <open+0xa3>
+    return fd2num(fd);
+  803a29:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a2d:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  803a34:	00 00 00 
+  803a37:	ff d0                	call   *%rax
+  803a39:	89 c3                	mov    %eax,%ebx
+}
+  803a3b:	89 d8                	mov    %ebx,%eax
+  803a3d:	48 83 c4 18          	add    $0x18,%rsp
+  803a41:	5b                   	pop    %rbx
+  803a42:	41 5c                	pop    %r12
+  803a44:	41 5d                	pop    %r13
+  803a46:	5d                   	pop    %rbp
+  803a47:	c3                   	ret
+        fd_close(fd, 0);
+  803a48:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a51:	48 b8 e5 2e 80 00 00 	movabs $0x802ee5,%rax
+  803a58:	00 00 00 
+  803a5b:	ff d0                	call   *%rax
+        return res;
+  803a5d:	eb dc                	jmp    803a3b <open+0x96>
+        return -E_BAD_PATH;
+  803a5f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a64:	eb d5                	jmp    803a3b <open+0x96>
+
+0000000000803a66 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a66:	55                   	push   %rbp
+  803a67:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a6f:	be 00 00 00 00       	mov    $0x0,%esi
+  803a74:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a79:	48 b8 13 35 80 00 00 	movabs $0x803513,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+}
+  803a85:	5d                   	pop    %rbp
+  803a86:	c3                   	ret
+
+0000000000803a87 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a87:	55                   	push   %rbp
+  803a88:	48 89 e5             	mov    %rsp,%rbp
+  803a8b:	41 56                	push   %r14
+  803a8d:	41 55                	push   %r13
+  803a8f:	41 54                	push   %r12
+  803a91:	53                   	push   %rbx
+  803a92:	48 83 ec 10          	sub    $0x10,%rsp
+  803a96:	41 89 f6             	mov    %esi,%r14d
+  803a99:	49 89 d4             	mov    %rdx,%r12
+  803a9c:	48 89 cb             	mov    %rcx,%rbx
+  803a9f:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803aa2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aa6:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  803aad:	00 00 00 
+  803ab0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ab2:	85 c0                	test   %eax,%eax
+  803ab4:	78 46                	js     803afc <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ab6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803aba:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ac1:	00 00 00 
+  803ac4:	8b 00                	mov    (%rax),%eax
+  803ac6:	39 02                	cmp    %eax,(%rdx)
+  803ac8:	75 3f                	jne    803b09 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803aca:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ad1:	00 00 00 
+  803ad4:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ad7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ad9:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803add:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ae1:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ae5:	48 89 da             	mov    %rbx,%rdx
+  803ae8:	4c 89 e6             	mov    %r12,%rsi
+  803aeb:	bf 09 00 00 00       	mov    $0x9,%edi
+  803af0:	48 b8 0e 36 80 00 00 	movabs $0x80360e,%rax
+  803af7:	00 00 00 
+  803afa:	ff d0                	call   *%rax
+}
+  803afc:	48 83 c4 10          	add    $0x10,%rsp
+  803b00:	5b                   	pop    %rbx
+  803b01:	41 5c                	pop    %r12
+  803b03:	41 5d                	pop    %r13
+  803b05:	41 5e                	pop    %r14
+  803b07:	5d                   	pop    %rbp
+  803b08:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b09:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b0e:	eb ec                	jmp    803afc <file_map+0x75>
+
+0000000000803b10 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b10:	55                   	push   %rbp
+  803b11:	48 89 e5             	mov    %rsp,%rbp
+  803b14:	41 54                	push   %r12
+  803b16:	53                   	push   %rbx
+  803b17:	48 83 ec 20          	sub    $0x20,%rsp
+  803b1b:	41 89 f4             	mov    %esi,%r12d
+  803b1e:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b21:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b25:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  803b2c:	00 00 00 
+  803b2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b31:	85 c0                	test   %eax,%eax
+  803b33:	78 3c                	js     803b71 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b39:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b40:	00 00 00 
+  803b43:	8b 0a                	mov    (%rdx),%ecx
+  803b45:	39 08                	cmp    %ecx,(%rax)
+  803b47:	75 31                	jne    803b7a <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b49:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b4c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b4f:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b53:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b57:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b5c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b60:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b65:	48 b8 13 35 80 00 00 	movabs $0x803513,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+}
+  803b71:	48 83 c4 20          	add    $0x20,%rsp
+  803b75:	5b                   	pop    %rbx
+  803b76:	41 5c                	pop    %r12
+  803b78:	5d                   	pop    %rbp
+  803b79:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b7a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b7f:	eb f0                	jmp    803b71 <file_msync+0x61>
+
+0000000000803b81 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b81:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b85:	7f 01                	jg     803b88 <writebuf+0x7>
+  803b87:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b88:	55                   	push   %rbp
+  803b89:	48 89 e5             	mov    %rsp,%rbp
+  803b8c:	53                   	push   %rbx
+  803b8d:	48 83 ec 08          	sub    $0x8,%rsp
+  803b91:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b94:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b98:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b9c:	8b 3f                	mov    (%rdi),%edi
+  803b9e:	48 b8 3c 32 80 00 00 	movabs $0x80323c,%rax
+  803ba5:	00 00 00 
+  803ba8:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803baa:	48 85 c0             	test   %rax,%rax
+  803bad:	7e 04                	jle    803bb3 <writebuf+0x32>
+  803baf:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bb3:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bb7:	48 39 c2             	cmp    %rax,%rdx
+  803bba:	74 0f                	je     803bcb <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bbc:	48 85 c0             	test   %rax,%rax
+  803bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc4:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bc8:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bcb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bcf:	c9                   	leave
+  803bd0:	c3                   	ret
+
+0000000000803bd1 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bd1:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bd4:	8d 50 01             	lea    0x1(%rax),%edx
+  803bd7:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bda:	48 98                	cltq
+  803bdc:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803be1:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803be7:	74 01                	je     803bea <putch+0x19>
+  803be9:	c3                   	ret
+putch(int ch, void *arg) {
+  803bea:	55                   	push   %rbp
+  803beb:	48 89 e5             	mov    %rsp,%rbp
+  803bee:	53                   	push   %rbx
+  803bef:	48 83 ec 08          	sub    $0x8,%rsp
+  803bf3:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bf6:	48 89 f7             	mov    %rsi,%rdi
+  803bf9:	48 b8 81 3b 80 00 00 	movabs $0x803b81,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c05:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c10:	c9                   	leave
+  803c11:	c3                   	ret
+
+0000000000803c12 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c12:	55                   	push   %rbp
+  803c13:	48 89 e5             	mov    %rsp,%rbp
+  803c16:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c1d:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c20:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c26:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c2d:	00 00 00 
+    state.result = 0;
+  803c30:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c37:	00 00 00 00 
+    state.error = 1;
+  803c3b:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c42:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c45:	48 89 f2             	mov    %rsi,%rdx
+  803c48:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c4f:	48 bf d1 3b 80 00 00 	movabs $0x803bd1,%rdi
+  803c56:	00 00 00 
+  803c59:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  803c60:	00 00 00 
+  803c63:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c65:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c6c:	7f 14                	jg     803c82 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c6e:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c75:	48 85 c0             	test   %rax,%rax
+  803c78:	75 06                	jne    803c80 <vfprintf+0x6e>
+  803c7a:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c80:	c9                   	leave
+  803c81:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c82:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c89:	48 b8 81 3b 80 00 00 	movabs $0x803b81,%rax
+  803c90:	00 00 00 
+  803c93:	ff d0                	call   *%rax
+  803c95:	eb d7                	jmp    803c6e <vfprintf+0x5c>
+
+0000000000803c97 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c97:	55                   	push   %rbp
+  803c98:	48 89 e5             	mov    %rsp,%rbp
+  803c9b:	48 83 ec 50          	sub    $0x50,%rsp
+  803c9f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ca3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ca7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803caf:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cb6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cbe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cc2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cc6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cca:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  803cd1:	00 00 00 
+  803cd4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cd6:	c9                   	leave
+  803cd7:	c3                   	ret
+
+0000000000803cd8 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cd8:	55                   	push   %rbp
+  803cd9:	48 89 e5             	mov    %rsp,%rbp
+  803cdc:	48 83 ec 50          	sub    $0x50,%rsp
+  803ce0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ce4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ce8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cf0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cf4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cfb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d03:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d07:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d0b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d0f:	48 89 fe             	mov    %rdi,%rsi
+  803d12:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d17:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  803d1e:	00 00 00 
+  803d21:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d23:	c9                   	leave
+  803d24:	c3                   	ret
+
+0000000000803d25 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d25:	55                   	push   %rbp
+  803d26:	48 89 e5             	mov    %rsp,%rbp
+  803d29:	41 54                	push   %r12
+  803d2b:	53                   	push   %rbx
+  803d2c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d2f:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803d36:	00 00 00 
+  803d39:	ff d0                	call   *%rax
+  803d3b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d3e:	48 be b0 62 80 00 00 	movabs $0x8062b0,%rsi
+  803d45:	00 00 00 
+  803d48:	48 89 df             	mov    %rbx,%rdi
+  803d4b:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  803d52:	00 00 00 
+  803d55:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d57:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d5c:	41 2b 04 24          	sub    (%r12),%eax
+  803d60:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d66:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d6d:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d70:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d77:	00 00 00 
+  803d7a:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d86:	5b                   	pop    %rbx
+  803d87:	41 5c                	pop    %r12
+  803d89:	5d                   	pop    %rbp
+  803d8a:	c3                   	ret
+
+0000000000803d8b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d8b:	55                   	push   %rbp
+  803d8c:	48 89 e5             	mov    %rsp,%rbp
+  803d8f:	41 54                	push   %r12
+  803d91:	53                   	push   %rbx
+  803d92:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d95:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d9a:	48 89 fe             	mov    %rdi,%rsi
+  803d9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da2:	49 bc 16 28 80 00 00 	movabs $0x802816,%r12
+  803da9:	00 00 00 
+  803dac:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803daf:	48 89 df             	mov    %rbx,%rdi
+  803db2:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803db9:	00 00 00 
+  803dbc:	ff d0                	call   *%rax
+  803dbe:	48 89 c6             	mov    %rax,%rsi
+  803dc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dcb:	41 ff d4             	call   *%r12
+}
+  803dce:	5b                   	pop    %rbx
+  803dcf:	41 5c                	pop    %r12
+  803dd1:	5d                   	pop    %rbp
+  803dd2:	c3                   	ret
+
+0000000000803dd3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dd3:	55                   	push   %rbp
+  803dd4:	48 89 e5             	mov    %rsp,%rbp
+  803dd7:	41 57                	push   %r15
+  803dd9:	41 56                	push   %r14
+  803ddb:	41 55                	push   %r13
+  803ddd:	41 54                	push   %r12
+  803ddf:	53                   	push   %rbx
+  803de0:	48 83 ec 18          	sub    $0x18,%rsp
+  803de4:	49 89 fc             	mov    %rdi,%r12
+  803de7:	49 89 f5             	mov    %rsi,%r13
+  803dea:	49 89 d7             	mov    %rdx,%r15
+  803ded:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803df1:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803df8:	00 00 00 
+  803dfb:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803dfd:	4d 85 ff             	test   %r15,%r15
+  803e00:	0f 84 af 00 00 00    	je     803eb5 <devpipe_write+0xe2>
+  803e06:	48 89 c3             	mov    %rax,%rbx
+  803e09:	4c 89 f8             	mov    %r15,%rax
+  803e0c:	4d 89 ef             	mov    %r13,%r15
+  803e0f:	4c 01 e8             	add    %r13,%rax
+  803e12:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e16:	49 bd 0c 27 80 00 00 	movabs $0x80270c,%r13
+  803e1d:	00 00 00 
+            sys_yield();
+  803e20:	49 be 9d 26 80 00 00 	movabs $0x80269d,%r14
+  803e27:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e2a:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e2d:	48 63 ce             	movslq %esi,%rcx
+  803e30:	48 63 03             	movslq (%rbx),%rax
+  803e33:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e39:	48 39 c1             	cmp    %rax,%rcx
+  803e3c:	72 2e                	jb     803e6c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e3e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e43:	48 89 da             	mov    %rbx,%rdx
+  803e46:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e4b:	4c 89 e7             	mov    %r12,%rdi
+  803e4e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e51:	85 c0                	test   %eax,%eax
+  803e53:	74 66                	je     803ebb <devpipe_write+0xe8>
+            sys_yield();
+  803e55:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e58:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e5b:	48 63 ce             	movslq %esi,%rcx
+  803e5e:	48 63 03             	movslq (%rbx),%rax
+  803e61:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e67:	48 39 c1             	cmp    %rax,%rcx
+  803e6a:	73 d2                	jae    803e3e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e6c:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e70:	48 89 ca             	mov    %rcx,%rdx
+  803e73:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e77:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e7e:	08 10 20 
+  803e81:	48 f7 e2             	mul    %rdx
+  803e84:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e88:	48 89 d0             	mov    %rdx,%rax
+  803e8b:	48 c1 e0 09          	shl    $0x9,%rax
+  803e8f:	48 29 d0             	sub    %rdx,%rax
+  803e92:	48 c1 e0 03          	shl    $0x3,%rax
+  803e96:	48 29 c1             	sub    %rax,%rcx
+  803e99:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e9e:	83 c6 01             	add    $0x1,%esi
+  803ea1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ea4:	49 83 c7 01          	add    $0x1,%r15
+  803ea8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eac:	49 39 c7             	cmp    %rax,%r15
+  803eaf:	0f 85 75 ff ff ff    	jne    803e2a <devpipe_write+0x57>
+    return n;
+  803eb5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eb9:	eb 05                	jmp    803ec0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ec0:	48 83 c4 18          	add    $0x18,%rsp
+  803ec4:	5b                   	pop    %rbx
+  803ec5:	41 5c                	pop    %r12
+  803ec7:	41 5d                	pop    %r13
+  803ec9:	41 5e                	pop    %r14
+  803ecb:	41 5f                	pop    %r15
+  803ecd:	5d                   	pop    %rbp
+  803ece:	c3                   	ret
+
+0000000000803ecf <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ecf:	55                   	push   %rbp
+  803ed0:	48 89 e5             	mov    %rsp,%rbp
+  803ed3:	41 57                	push   %r15
+  803ed5:	41 56                	push   %r14
+  803ed7:	41 55                	push   %r13
+  803ed9:	41 54                	push   %r12
+  803edb:	53                   	push   %rbx
+  803edc:	48 83 ec 18          	sub    $0x18,%rsp
+  803ee0:	49 89 fc             	mov    %rdi,%r12
+  803ee3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ee7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803eeb:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803ef2:	00 00 00 
+  803ef5:	ff d0                	call   *%rax
+  803ef7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803efa:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f00:	49 bd 0c 27 80 00 00 	movabs $0x80270c,%r13
+  803f07:	00 00 00 
+            sys_yield();
+  803f0a:	49 be 9d 26 80 00 00 	movabs $0x80269d,%r14
+  803f11:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f14:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f19:	74 7d                	je     803f98 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f1b:	8b 03                	mov    (%rbx),%eax
+  803f1d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f20:	75 26                	jne    803f48 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f22:	4d 85 ff             	test   %r15,%r15
+  803f25:	75 77                	jne    803f9e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f27:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f2c:	48 89 da             	mov    %rbx,%rdx
+  803f2f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f34:	4c 89 e7             	mov    %r12,%rdi
+  803f37:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f3a:	85 c0                	test   %eax,%eax
+  803f3c:	74 72                	je     803fb0 <devpipe_read+0xe1>
+            sys_yield();
+  803f3e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f41:	8b 03                	mov    (%rbx),%eax
+  803f43:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f46:	74 df                	je     803f27 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f48:	48 63 c8             	movslq %eax,%rcx
+  803f4b:	48 89 ca             	mov    %rcx,%rdx
+  803f4e:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f52:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f59:	08 10 20 
+  803f5c:	48 89 d0             	mov    %rdx,%rax
+  803f5f:	48 f7 e6             	mul    %rsi
+  803f62:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f66:	48 89 d0             	mov    %rdx,%rax
+  803f69:	48 c1 e0 09          	shl    $0x9,%rax
+  803f6d:	48 29 d0             	sub    %rdx,%rax
+  803f70:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f77:	00 
+  803f78:	48 89 c8             	mov    %rcx,%rax
+  803f7b:	48 29 d0             	sub    %rdx,%rax
+  803f7e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f83:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f87:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f8b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f8e:	49 83 c7 01          	add    $0x1,%r15
+  803f92:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f96:	75 83                	jne    803f1b <devpipe_read+0x4c>
+    return n;
+  803f98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f9c:	eb 03                	jmp    803fa1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f9e:	4c 89 f8             	mov    %r15,%rax
+}
+  803fa1:	48 83 c4 18          	add    $0x18,%rsp
+  803fa5:	5b                   	pop    %rbx
+  803fa6:	41 5c                	pop    %r12
+  803fa8:	41 5d                	pop    %r13
+  803faa:	41 5e                	pop    %r14
+  803fac:	41 5f                	pop    %r15
+  803fae:	5d                   	pop    %rbp
+  803faf:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb5:	eb ea                	jmp    803fa1 <devpipe_read+0xd2>
+
+0000000000803fb7 <pipe>:
+pipe(int pfd[2]) {
+  803fb7:	55                   	push   %rbp
+  803fb8:	48 89 e5             	mov    %rsp,%rbp
+  803fbb:	41 55                	push   %r13
+  803fbd:	41 54                	push   %r12
+  803fbf:	53                   	push   %rbx
+  803fc0:	48 83 ec 18          	sub    $0x18,%rsp
+  803fc4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fc7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fcb:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  803fd2:	00 00 00 
+  803fd5:	ff d0                	call   *%rax
+  803fd7:	89 c3                	mov    %eax,%ebx
+  803fd9:	85 c0                	test   %eax,%eax
+  803fdb:	0f 88 a0 01 00 00    	js     804181 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fe1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fe6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803feb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fef:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff4:	48 b8 3e 27 80 00 00 	movabs $0x80273e,%rax
+  803ffb:	00 00 00 
+  803ffe:	ff d0                	call   *%rax
+  804000:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804002:	85 c0                	test   %eax,%eax
+  804004:	0f 88 77 01 00 00    	js     804181 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80400a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80400e:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  804015:	00 00 00 
+  804018:	ff d0                	call   *%rax
+  80401a:	89 c3                	mov    %eax,%ebx
+  80401c:	85 c0                	test   %eax,%eax
+  80401e:	0f 88 43 01 00 00    	js     804167 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804024:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804029:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80402e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804032:	bf 00 00 00 00       	mov    $0x0,%edi
+  804037:	48 b8 3e 27 80 00 00 	movabs $0x80273e,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+  804043:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804045:	85 c0                	test   %eax,%eax
+  804047:	0f 88 1a 01 00 00    	js     804167 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80404d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804051:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  804058:	00 00 00 
+  80405b:	ff d0                	call   *%rax
+  80405d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804060:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804065:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80406a:	48 89 c6             	mov    %rax,%rsi
+  80406d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804072:	48 b8 3e 27 80 00 00 	movabs $0x80273e,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+  80407e:	89 c3                	mov    %eax,%ebx
+  804080:	85 c0                	test   %eax,%eax
+  804082:	0f 88 c5 00 00 00    	js     80414d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804088:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80408c:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  804093:	00 00 00 
+  804096:	ff d0                	call   *%rax
+  804098:	48 89 c1             	mov    %rax,%rcx
+  80409b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040a1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040ac:	4c 89 ee             	mov    %r13,%rsi
+  8040af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b4:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  8040bb:	00 00 00 
+  8040be:	ff d0                	call   *%rax
+  8040c0:	89 c3                	mov    %eax,%ebx
+  8040c2:	85 c0                	test   %eax,%eax
+  8040c4:	78 6e                	js     804134 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040cb:	4c 89 ef             	mov    %r13,%rdi
+  8040ce:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  8040d5:	00 00 00 
+  8040d8:	ff d0                	call   *%rax
+  8040da:	83 f8 02             	cmp    $0x2,%eax
+  8040dd:	0f 85 ab 00 00 00    	jne    80418e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040e3:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040ea:	00 00 
+  8040ec:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f0:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040f2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040fd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804101:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804103:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804107:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80410e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804112:	48 bb 9c 2d 80 00 00 	movabs $0x802d9c,%rbx
+  804119:	00 00 00 
+  80411c:	ff d3                	call   *%rbx
+  80411e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804122:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804126:	ff d3                	call   *%rbx
+  804128:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80412d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804132:	eb 4d                	jmp    804181 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804134:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804139:	4c 89 ee             	mov    %r13,%rsi
+  80413c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804141:	48 b8 16 28 80 00 00 	movabs $0x802816,%rax
+  804148:	00 00 00 
+  80414b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80414d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804152:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804156:	bf 00 00 00 00       	mov    $0x0,%edi
+  80415b:	48 b8 16 28 80 00 00 	movabs $0x802816,%rax
+  804162:	00 00 00 
+  804165:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804167:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80416c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804170:	bf 00 00 00 00       	mov    $0x0,%edi
+  804175:	48 b8 16 28 80 00 00 	movabs $0x802816,%rax
+  80417c:	00 00 00 
+  80417f:	ff d0                	call   *%rax
+}
+  804181:	89 d8                	mov    %ebx,%eax
+  804183:	48 83 c4 18          	add    $0x18,%rsp
+  804187:	5b                   	pop    %rbx
+  804188:	41 5c                	pop    %r12
+  80418a:	41 5d                	pop    %r13
+  80418c:	5d                   	pop    %rbp
+  80418d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80418e:	48 b9 c8 62 80 00 00 	movabs $0x8062c8,%rcx
+  804195:	00 00 00 
+  804198:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80419f:	00 00 00 
+  8041a2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041a7:	48 bf b7 62 80 00 00 	movabs $0x8062b7,%rdi
+  8041ae:	00 00 00 
+  8041b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b6:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  8041bd:	00 00 00 
+  8041c0:	41 ff d0             	call   *%r8
+
+00000000008041c3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041c3:	55                   	push   %rbp
+  8041c4:	48 89 e5             	mov    %rsp,%rbp
+  8041c7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041cb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041cf:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  8041d6:	00 00 00 
+  8041d9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041db:	85 c0                	test   %eax,%eax
+  8041dd:	78 35                	js     804214 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041df:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e3:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  8041ea:	00 00 00 
+  8041ed:	ff d0                	call   *%rax
+  8041ef:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041f7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804200:	48 b8 0c 27 80 00 00 	movabs $0x80270c,%rax
+  804207:	00 00 00 
+  80420a:	ff d0                	call   *%rax
+  80420c:	85 c0                	test   %eax,%eax
+  80420e:	0f 94 c0             	sete   %al
+  804211:	0f b6 c0             	movzbl %al,%eax
+}
+  804214:	c9                   	leave
+  804215:	c3                   	ret
+
+0000000000804216 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804216:	48 89 f8             	mov    %rdi,%rax
+  804219:	48 c1 e8 27          	shr    $0x27,%rax
+  80421d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804224:	01 00 00 
+  804227:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80422b:	f6 c2 01             	test   $0x1,%dl
+  80422e:	74 6d                	je     80429d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804230:	48 89 f8             	mov    %rdi,%rax
+  804233:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804237:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80423e:	01 00 00 
+  804241:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804245:	f6 c2 01             	test   $0x1,%dl
+  804248:	74 62                	je     8042ac <get_uvpt_entry+0x96>
+  80424a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804251:	01 00 00 
+  804254:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804258:	f6 c2 80             	test   $0x80,%dl
+  80425b:	75 4f                	jne    8042ac <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80425d:	48 89 f8             	mov    %rdi,%rax
+  804260:	48 c1 e8 15          	shr    $0x15,%rax
+  804264:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80426b:	01 00 00 
+  80426e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804272:	f6 c2 01             	test   $0x1,%dl
+  804275:	74 44                	je     8042bb <get_uvpt_entry+0xa5>
+  804277:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80427e:	01 00 00 
+  804281:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804285:	f6 c2 80             	test   $0x80,%dl
+  804288:	75 31                	jne    8042bb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80428a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80428e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804295:	01 00 00 
+  804298:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80429c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80429d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042a4:	01 00 00 
+  8042a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ab:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042ac:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042b3:	01 00 00 
+  8042b6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ba:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042bb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042c2:	01 00 00 
+  8042c5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042c9:	c3                   	ret
+
+00000000008042ca <get_prot>:
+
+int
+get_prot(void *va) {
+  8042ca:	55                   	push   %rbp
+  8042cb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042ce:	48 b8 16 42 80 00 00 	movabs $0x804216,%rax
+  8042d5:	00 00 00 
+  8042d8:	ff d0                	call   *%rax
+  8042da:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042dd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042e2:	89 c1                	mov    %eax,%ecx
+  8042e4:	83 c9 04             	or     $0x4,%ecx
+  8042e7:	f6 c2 01             	test   $0x1,%dl
+  8042ea:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042ed:	89 c1                	mov    %eax,%ecx
+  8042ef:	83 c9 02             	or     $0x2,%ecx
+  8042f2:	f6 c2 02             	test   $0x2,%dl
+  8042f5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042f8:	89 c1                	mov    %eax,%ecx
+  8042fa:	83 c9 01             	or     $0x1,%ecx
+  8042fd:	48 85 d2             	test   %rdx,%rdx
+  804300:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804303:	89 c1                	mov    %eax,%ecx
+  804305:	83 c9 40             	or     $0x40,%ecx
+  804308:	f6 c6 04             	test   $0x4,%dh
+  80430b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80430e:	5d                   	pop    %rbp
+  80430f:	c3                   	ret
+
+0000000000804310 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804310:	55                   	push   %rbp
+  804311:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804314:	48 b8 16 42 80 00 00 	movabs $0x804216,%rax
+  80431b:	00 00 00 
+  80431e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804320:	48 c1 e8 06          	shr    $0x6,%rax
+  804324:	83 e0 01             	and    $0x1,%eax
+}
+  804327:	5d                   	pop    %rbp
+  804328:	c3                   	ret
+
+0000000000804329 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804329:	55                   	push   %rbp
+  80432a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80432d:	48 b8 16 42 80 00 00 	movabs $0x804216,%rax
+  804334:	00 00 00 
+  804337:	ff d0                	call   *%rax
+  804339:	83 e0 01             	and    $0x1,%eax
+}
+  80433c:	5d                   	pop    %rbp
+  80433d:	c3                   	ret
+
+000000000080433e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80433e:	55                   	push   %rbp
+  80433f:	48 89 e5             	mov    %rsp,%rbp
+  804342:	41 57                	push   %r15
+  804344:	41 56                	push   %r14
+  804346:	41 55                	push   %r13
+  804348:	41 54                	push   %r12
+  80434a:	53                   	push   %rbx
+  80434b:	48 83 ec 28          	sub    $0x28,%rsp
+  80434f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804353:	48 85 ff             	test   %rdi,%rdi
+  804356:	74 1e                	je     804376 <foreach_shared_region+0x38>
+  804358:	49 89 ff             	mov    %rdi,%r15
+  80435b:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804361:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804367:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80436e:	01 00 00 
+  804371:	e9 72 02 00 00       	jmp    8045e8 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804376:	48 b9 ec 62 80 00 00 	movabs $0x8062ec,%rcx
+  80437d:	00 00 00 
+  804380:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  804387:	00 00 00 
+  80438a:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80438f:	48 bf f0 62 80 00 00 	movabs $0x8062f0,%rdi
+  804396:	00 00 00 
+  804399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439e:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  8043a5:	00 00 00 
+  8043a8:	41 ff d0             	call   *%r8
+  8043ab:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043b2:	eb 6c                	jmp    804420 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043b4:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043bb:	ff ff ff 
+  8043be:	4c 21 e2             	and    %r12,%rdx
+  8043c1:	48 89 d8             	mov    %rbx,%rax
+  8043c4:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043c9:	48 83 c0 01          	add    $0x1,%rax
+  8043cd:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043d1:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043d8:	00 00 00 
+  8043db:	48 21 c8             	and    %rcx,%rax
+  8043de:	48 09 d0             	or     %rdx,%rax
+  8043e1:	49 89 c4             	mov    %rax,%r12
+  8043e4:	eb 30                	jmp    804416 <foreach_shared_region+0xd8>
+  8043e6:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043ed:	ff ff ff 
+  8043f0:	4c 21 e2             	and    %r12,%rdx
+  8043f3:	48 89 d8             	mov    %rbx,%rax
+  8043f6:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043fb:	48 83 c0 01          	add    $0x1,%rax
+  8043ff:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804403:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80440a:	00 00 00 
+  80440d:	48 21 c8             	and    %rcx,%rax
+  804410:	48 09 d0             	or     %rdx,%rax
+  804413:	49 89 c4             	mov    %rax,%r12
+  804416:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80441a:	0f 84 99 01 00 00    	je     8045b9 <foreach_shared_region+0x27b>
+  804420:	4c 89 e3             	mov    %r12,%rbx
+  804423:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804427:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80442e:	01 00 00 
+  804431:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804435:	a8 01                	test   $0x1,%al
+  804437:	0f 84 77 ff ff ff    	je     8043b4 <foreach_shared_region+0x76>
+  80443d:	a8 80                	test   $0x80,%al
+  80443f:	74 19                	je     80445a <foreach_shared_region+0x11c>
+  804441:	f6 c4 04             	test   $0x4,%ah
+  804444:	74 a0                	je     8043e6 <foreach_shared_region+0xa8>
+  804446:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80444d:	40 
+  80444e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804452:	4c 89 e7             	mov    %r12,%rdi
+  804455:	41 ff d7             	call   *%r15
+  804458:	eb 8c                	jmp    8043e6 <foreach_shared_region+0xa8>
+  80445a:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804461:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804465:	eb 46                	jmp    8044ad <foreach_shared_region+0x16f>
+  804467:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80446e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804474:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804478:	48 c1 e0 15          	shl    $0x15,%rax
+  80447c:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804481:	49 09 c4             	or     %rax,%r12
+  804484:	eb 1d                	jmp    8044a3 <foreach_shared_region+0x165>
+  804486:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80448d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804493:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804497:	48 c1 e0 15          	shl    $0x15,%rax
+  80449b:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044a0:	49 09 c4             	or     %rax,%r12
+  8044a3:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044a7:	0f 84 d3 00 00 00    	je     804580 <foreach_shared_region+0x242>
+  8044ad:	4c 89 e3             	mov    %r12,%rbx
+  8044b0:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044b4:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044bb:	01 00 00 
+  8044be:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044c2:	a8 01                	test   $0x1,%al
+  8044c4:	74 a1                	je     804467 <foreach_shared_region+0x129>
+  8044c6:	a8 80                	test   $0x80,%al
+  8044c8:	74 19                	je     8044e3 <foreach_shared_region+0x1a5>
+  8044ca:	f6 c4 04             	test   $0x4,%ah
+  8044cd:	74 b7                	je     804486 <foreach_shared_region+0x148>
+  8044cf:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044d6:	00 
+  8044d7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044db:	4c 89 e7             	mov    %r12,%rdi
+  8044de:	41 ff d7             	call   *%r15
+  8044e1:	eb a3                	jmp    804486 <foreach_shared_region+0x148>
+  8044e3:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044e9:	eb 3b                	jmp    804526 <foreach_shared_region+0x1e8>
+  8044eb:	f6 c4 04             	test   $0x4,%ah
+  8044ee:	74 12                	je     804502 <foreach_shared_region+0x1c4>
+  8044f0:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044f7:	00 
+  8044f8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044fc:	4c 89 e7             	mov    %r12,%rdi
+  8044ff:	41 ff d7             	call   *%r15
+  804502:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804509:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80450f:	48 83 c3 01          	add    $0x1,%rbx
+  804513:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804517:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80451d:	49 09 dc             	or     %rbx,%r12
+  804520:	41 83 ed 01          	sub    $0x1,%r13d
+  804524:	74 2f                	je     804555 <foreach_shared_region+0x217>
+  804526:	4c 89 e3             	mov    %r12,%rbx
+  804529:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80452d:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804531:	a8 01                	test   $0x1,%al
+  804533:	75 b6                	jne    8044eb <foreach_shared_region+0x1ad>
+  804535:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80453c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804542:	48 83 c3 01          	add    $0x1,%rbx
+  804546:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80454a:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804550:	49 09 dc             	or     %rbx,%r12
+  804553:	eb cb                	jmp    804520 <foreach_shared_region+0x1e2>
+  804555:	4c 89 e0             	mov    %r12,%rax
+  804558:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80455e:	49 c1 ec 15          	shr    $0x15,%r12
+  804562:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804569:	49 83 c4 01          	add    $0x1,%r12
+  80456d:	49 c1 e4 15          	shl    $0x15,%r12
+  804571:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804578:	49 09 c4             	or     %rax,%r12
+  80457b:	e9 23 ff ff ff       	jmp    8044a3 <foreach_shared_region+0x165>
+  804580:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804584:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80458b:	ff ff ff 
+  80458e:	4c 21 e0             	and    %r12,%rax
+  804591:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804595:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80459c:	49 83 c4 01          	add    $0x1,%r12
+  8045a0:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045a4:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045ab:	00 00 00 
+  8045ae:	49 21 d4             	and    %rdx,%r12
+  8045b1:	49 09 c4             	or     %rax,%r12
+  8045b4:	e9 5d fe ff ff       	jmp    804416 <foreach_shared_region+0xd8>
+  8045b9:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045c0:	00 ff ff 
+  8045c3:	4c 21 e0             	and    %r12,%rax
+  8045c6:	49 c1 ec 27          	shr    $0x27,%r12
+  8045ca:	49 83 c4 01          	add    $0x1,%r12
+  8045ce:	49 c1 e4 27          	shl    $0x27,%r12
+  8045d2:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045d9:	ff 00 00 
+  8045dc:	49 21 d4             	and    %rdx,%r12
+  8045df:	49 09 c4             	or     %rax,%r12
+  8045e2:	41 83 ed 01          	sub    $0x1,%r13d
+  8045e6:	74 48                	je     804630 <foreach_shared_region+0x2f2>
+  8045e8:	4c 89 e0             	mov    %r12,%rax
+  8045eb:	48 c1 e8 27          	shr    $0x27,%rax
+  8045ef:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045f6:	01 00 00 
+  8045f9:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045fd:	f6 c2 01             	test   $0x1,%dl
+  804600:	0f 85 a5 fd ff ff    	jne    8043ab <foreach_shared_region+0x6d>
+  804606:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  80460d:	00 ff ff 
+  804610:	4c 21 e2             	and    %r12,%rdx
+  804613:	48 83 c0 01          	add    $0x1,%rax
+  804617:	48 c1 e0 27          	shl    $0x27,%rax
+  80461b:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804622:	ff 00 00 
+  804625:	48 21 c8             	and    %rcx,%rax
+  804628:	48 09 d0             	or     %rdx,%rax
+  80462b:	49 89 c4             	mov    %rax,%r12
+  80462e:	eb b2                	jmp    8045e2 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804630:	4d 85 e4             	test   %r12,%r12
+  804633:	75 14                	jne    804649 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463a:	48 83 c4 28          	add    $0x28,%rsp
+  80463e:	5b                   	pop    %rbx
+  80463f:	41 5c                	pop    %r12
+  804641:	41 5d                	pop    %r13
+  804643:	41 5e                	pop    %r14
+  804645:	41 5f                	pop    %r15
+  804647:	5d                   	pop    %rbp
+  804648:	c3                   	ret
+    assert(addr == 0);
+  804649:	48 b9 fb 62 80 00 00 	movabs $0x8062fb,%rcx
+  804650:	00 00 00 
+  804653:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  80465a:	00 00 00 
+  80465d:	be 67 00 00 00       	mov    $0x67,%esi
+  804662:	48 bf f0 62 80 00 00 	movabs $0x8062f0,%rdi
+  804669:	00 00 00 
+  80466c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804671:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  804678:	00 00 00 
+  80467b:	41 ff d0             	call   *%r8
+
+000000000080467e <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80467e:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804685:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804688:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80468e:	eb 33                	jmp    8046c3 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804690:	48 83 c0 20          	add    $0x20,%rax
+  804694:	4c 39 c0             	cmp    %r8,%rax
+  804697:	74 25                	je     8046be <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804699:	48 8b 10             	mov    (%rax),%rdx
+  80469c:	48 85 d2             	test   %rdx,%rdx
+  80469f:	74 ef                	je     804690 <mmap_place+0x12>
+  8046a1:	48 89 d1             	mov    %rdx,%rcx
+  8046a4:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046a8:	48 39 cf             	cmp    %rcx,%rdi
+  8046ab:	73 e3                	jae    804690 <mmap_place+0x12>
+  8046ad:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046b1:	4c 39 ca             	cmp    %r9,%rdx
+  8046b4:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046b8:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046bc:	eb d2                	jmp    804690 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046be:	45 84 d2             	test   %r10b,%r10b
+  8046c1:	74 12                	je     8046d5 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046c3:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046ca:	00 00 00 
+        moved = 0;
+  8046cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046d3:	eb c4                	jmp    804699 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046d5:	48 01 fe             	add    %rdi,%rsi
+  8046d8:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046df:	00 00 00 
+  8046e2:	48 39 f0             	cmp    %rsi,%rax
+  8046e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ea:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046ee:	c3                   	ret
+
+00000000008046ef <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046ef:	55                   	push   %rbp
+  8046f0:	48 89 e5             	mov    %rsp,%rbp
+  8046f3:	41 57                	push   %r15
+  8046f5:	41 56                	push   %r14
+  8046f7:	41 55                	push   %r13
+  8046f9:	41 54                	push   %r12
+  8046fb:	53                   	push   %rbx
+  8046fc:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804700:	48 8b 1f             	mov    (%rdi),%rbx
+  804703:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80470a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804711:	00 00 00 
+  804714:	ba 00 00 00 00       	mov    $0x0,%edx
+  804719:	eb 12                	jmp    80472d <mmap_pgfault+0x3e>
+  80471b:	48 83 c2 01          	add    $0x1,%rdx
+  80471f:	48 83 c0 20          	add    $0x20,%rax
+  804723:	48 83 fa 20          	cmp    $0x20,%rdx
+  804727:	0f 84 04 01 00 00    	je     804831 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80472d:	48 8b 08             	mov    (%rax),%rcx
+  804730:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804734:	48 39 de             	cmp    %rbx,%rsi
+  804737:	73 e2                	jae    80471b <mmap_pgfault+0x2c>
+  804739:	48 03 48 08          	add    0x8(%rax),%rcx
+  80473d:	48 39 cb             	cmp    %rcx,%rbx
+  804740:	73 d9                	jae    80471b <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804742:	48 c1 e2 05          	shl    $0x5,%rdx
+  804746:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80474d:	00 00 00 
+  804750:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804754:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804758:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80475c:	f6 c2 01             	test   $0x1,%dl
+  80475f:	0f 84 e0 00 00 00    	je     804845 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80476a:	f6 c2 02             	test   $0x2,%dl
+  80476d:	0f 84 c3 00 00 00    	je     804836 <mmap_pgfault+0x147>
+  804773:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80477a:	ff ff ff 
+  80477d:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804781:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804788:	00 00 00 
+  80478b:	48 39 ca             	cmp    %rcx,%rdx
+  80478e:	0f 85 a2 00 00 00    	jne    804836 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804794:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804799:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80479e:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047a5:	00 00 00 
+  8047a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ad:	48 b8 3e 27 80 00 00 	movabs $0x80273e,%rax
+  8047b4:	00 00 00 
+  8047b7:	ff d0                	call   *%rax
+  8047b9:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c0:	85 d2                	test   %edx,%edx
+  8047c2:	78 72                	js     804836 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c9:	48 89 de             	mov    %rbx,%rsi
+  8047cc:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047d3:	00 00 00 
+  8047d6:	4c 89 e7             	mov    %r12,%rdi
+  8047d9:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  8047e0:	00 00 00 
+  8047e3:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047e5:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047eb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047f1:	48 89 d9             	mov    %rbx,%rcx
+  8047f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047f9:	4c 89 e6             	mov    %r12,%rsi
+  8047fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804801:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  804808:	00 00 00 
+  80480b:	ff d0                	call   *%rax
+  80480d:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  80480f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804814:	4c 89 e6             	mov    %r12,%rsi
+  804817:	bf 00 00 00 00       	mov    $0x0,%edi
+  80481c:	48 b8 16 28 80 00 00 	movabs $0x802816,%rax
+  804823:	00 00 00 
+  804826:	ff d0                	call   *%rax
+    return res >= 0;
+  804828:	89 d8                	mov    %ebx,%eax
+  80482a:	f7 d0                	not    %eax
+  80482c:	c1 e8 1f             	shr    $0x1f,%eax
+  80482f:	eb 05                	jmp    804836 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804831:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804836:	48 83 c4 18          	add    $0x18,%rsp
+  80483a:	5b                   	pop    %rbx
+  80483b:	41 5c                	pop    %r12
+  80483d:	41 5d                	pop    %r13
+  80483f:	41 5e                	pop    %r14
+  804841:	41 5f                	pop    %r15
+  804843:	5d                   	pop    %rbp
+  804844:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804845:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804849:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  80484d:	4c 03 30             	add    (%rax),%r14
+  804850:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804857:	49 39 c6             	cmp    %rax,%r14
+  80485a:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80485e:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804865:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80486b:	49 bf 29 43 80 00 00 	movabs $0x804329,%r15
+  804872:	00 00 00 
+  804875:	4d 39 f4             	cmp    %r14,%r12
+  804878:	73 1d                	jae    804897 <mmap_pgfault+0x1a8>
+  80487a:	4c 89 e7             	mov    %r12,%rdi
+  80487d:	41 ff d7             	call   *%r15
+  804880:	84 c0                	test   %al,%al
+  804882:	75 13                	jne    804897 <mmap_pgfault+0x1a8>
+  804884:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80488b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804892:	4d 39 f4             	cmp    %r14,%r12
+  804895:	72 e3                	jb     80487a <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804897:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  80489d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a1:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048a5:	74 2a                	je     8048d1 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048ab:	89 de                	mov    %ebx,%esi
+  8048ad:	2b 30                	sub    (%rax),%esi
+  8048af:	03 70 1c             	add    0x1c(%rax),%esi
+  8048b2:	8b 78 18             	mov    0x18(%rax),%edi
+  8048b5:	4c 89 e9             	mov    %r13,%rcx
+  8048b8:	48 89 da             	mov    %rbx,%rdx
+  8048bb:	48 b8 87 3a 80 00 00 	movabs $0x803a87,%rax
+  8048c2:	00 00 00 
+  8048c5:	ff d0                	call   *%rax
+    return res > 0;
+  8048c7:	85 c0                	test   %eax,%eax
+  8048c9:	0f 9f c0             	setg   %al
+  8048cc:	e9 65 ff ff ff       	jmp    804836 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048d1:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048d5:	eb d0                	jmp    8048a7 <mmap_pgfault+0x1b8>
+
+00000000008048d7 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048d7:	55                   	push   %rbp
+  8048d8:	48 89 e5             	mov    %rsp,%rbp
+  8048db:	41 57                	push   %r15
+  8048dd:	41 56                	push   %r14
+  8048df:	41 55                	push   %r13
+  8048e1:	41 54                	push   %r12
+  8048e3:	53                   	push   %rbx
+  8048e4:	48 83 ec 28          	sub    $0x28,%rsp
+  8048e8:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048ec:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048ef:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048f6:	ff ff ff 
+  8048f9:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804902:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804909:	00 00 00 
+  80490c:	48 39 ca             	cmp    %rcx,%rdx
+  80490f:	0f 85 e5 00 00 00    	jne    8049fa <mmap_writeback+0x123>
+  804915:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804918:	4c 39 ee             	cmp    %r13,%rsi
+  80491b:	0f 83 e8 00 00 00    	jae    804a09 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804921:	49 be 29 43 80 00 00 	movabs $0x804329,%r14
+  804928:	00 00 00 
+  80492b:	49 bf 10 43 80 00 00 	movabs $0x804310,%r15
+  804932:	00 00 00 
+  804935:	eb 10                	jmp    804947 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804937:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80493e:	4d 39 ec             	cmp    %r13,%r12
+  804941:	0f 83 ae 00 00 00    	jae    8049f5 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804947:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80494b:	4c 89 e7             	mov    %r12,%rdi
+  80494e:	41 ff d6             	call   *%r14
+  804951:	84 c0                	test   %al,%al
+  804953:	74 e2                	je     804937 <mmap_writeback+0x60>
+  804955:	4c 89 e7             	mov    %r12,%rdi
+  804958:	41 ff d7             	call   *%r15
+  80495b:	84 c0                	test   %al,%al
+  80495d:	74 d8                	je     804937 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80495f:	4c 89 e3             	mov    %r12,%rbx
+  804962:	4d 39 ec             	cmp    %r13,%r12
+  804965:	73 20                	jae    804987 <mmap_writeback+0xb0>
+  804967:	48 89 df             	mov    %rbx,%rdi
+  80496a:	41 ff d6             	call   *%r14
+  80496d:	84 c0                	test   %al,%al
+  80496f:	74 16                	je     804987 <mmap_writeback+0xb0>
+  804971:	48 89 df             	mov    %rbx,%rdi
+  804974:	41 ff d7             	call   *%r15
+  804977:	84 c0                	test   %al,%al
+  804979:	74 0c                	je     804987 <mmap_writeback+0xb0>
+  80497b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804982:	4c 39 eb             	cmp    %r13,%rbx
+  804985:	72 e0                	jb     804967 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804987:	48 89 d9             	mov    %rbx,%rcx
+  80498a:	4c 29 e1             	sub    %r12,%rcx
+  80498d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804991:	44 89 e6             	mov    %r12d,%esi
+  804994:	2b 30                	sub    (%rax),%esi
+  804996:	49 89 c4             	mov    %rax,%r12
+  804999:	03 70 1c             	add    0x1c(%rax),%esi
+  80499c:	8b 78 18             	mov    0x18(%rax),%edi
+  80499f:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049a3:	48 89 ca             	mov    %rcx,%rdx
+  8049a6:	48 b8 10 3b 80 00 00 	movabs $0x803b10,%rax
+  8049ad:	00 00 00 
+  8049b0:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049b2:	85 c0                	test   %eax,%eax
+  8049b4:	78 44                	js     8049fa <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049b6:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049bb:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049be:	41 89 c1             	mov    %eax,%r9d
+  8049c1:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049c8:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049cc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d5:	48 89 ce             	mov    %rcx,%rsi
+  8049d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049dd:	48 b8 ab 27 80 00 00 	movabs $0x8027ab,%rax
+  8049e4:	00 00 00 
+  8049e7:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049e9:	85 c0                	test   %eax,%eax
+  8049eb:	78 0d                	js     8049fa <mmap_writeback+0x123>
+  8049ed:	49 89 dc             	mov    %rbx,%r12
+  8049f0:	e9 49 ff ff ff       	jmp    80493e <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049fa:	48 83 c4 28          	add    $0x28,%rsp
+  8049fe:	5b                   	pop    %rbx
+  8049ff:	41 5c                	pop    %r12
+  804a01:	41 5d                	pop    %r13
+  804a03:	41 5e                	pop    %r14
+  804a05:	41 5f                	pop    %r15
+  804a07:	5d                   	pop    %rbp
+  804a08:	c3                   	ret
+    return 0;
+  804a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a0e:	eb ea                	jmp    8049fa <mmap_writeback+0x123>
+
+0000000000804a10 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a10:	55                   	push   %rbp
+  804a11:	48 89 e5             	mov    %rsp,%rbp
+  804a14:	41 57                	push   %r15
+  804a16:	41 56                	push   %r14
+  804a18:	41 55                	push   %r13
+  804a1a:	41 54                	push   %r12
+  804a1c:	53                   	push   %rbx
+  804a1d:	48 83 ec 38          	sub    $0x38,%rsp
+  804a21:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a25:	48 85 f6             	test   %rsi,%rsi
+  804a28:	0f 84 0c 02 00 00    	je     804c3a <mmap+0x22a>
+  804a2e:	49 89 ff             	mov    %rdi,%r15
+  804a31:	49 89 f4             	mov    %rsi,%r12
+  804a34:	41 89 d5             	mov    %edx,%r13d
+  804a37:	41 89 ce             	mov    %ecx,%r14d
+  804a3a:	44 89 cb             	mov    %r9d,%ebx
+  804a3d:	45 85 c9             	test   %r9d,%r9d
+  804a40:	0f 88 f4 01 00 00    	js     804c3a <mmap+0x22a>
+  804a46:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a4d:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a54:	0f 85 e7 01 00 00    	jne    804c41 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a5a:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a5d:	83 fa 04             	cmp    $0x4,%edx
+  804a60:	0f 85 db 01 00 00    	jne    804c41 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a66:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a69:	83 fa 01             	cmp    $0x1,%edx
+  804a6c:	0f 87 cf 01 00 00    	ja     804c41 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a72:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a76:	44 89 c7             	mov    %r8d,%edi
+  804a79:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  804a80:	00 00 00 
+  804a83:	ff d0                	call   *%rax
+  804a85:	89 c2                	mov    %eax,%edx
+  804a87:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a8e:	85 d2                	test   %edx,%edx
+  804a90:	0f 88 ab 01 00 00    	js     804c41 <mmap+0x231>
+  804a96:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a9a:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804aa1:	00 00 00 
+  804aa4:	8b 09                	mov    (%rcx),%ecx
+  804aa6:	39 0a                	cmp    %ecx,(%rdx)
+  804aa8:	0f 85 93 01 00 00    	jne    804c41 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804aae:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ab1:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ab4:	83 fa 01             	cmp    $0x1,%edx
+  804ab7:	0f 84 84 01 00 00    	je     804c41 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804abd:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ac1:	74 42                	je     804b05 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ac3:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804aca:	4c 89 e6             	mov    %r12,%rsi
+  804acd:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ad4:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ad8:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804adc:	4d 85 ff             	test   %r15,%r15
+  804adf:	74 67                	je     804b48 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ae1:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ae8:	75 0f                	jne    804af9 <mmap+0xe9>
+  804aea:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804af1:	00 00 00 
+  804af4:	49 39 c7             	cmp    %rax,%r15
+  804af7:	77 1b                	ja     804b14 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804af9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b00:	e9 3c 01 00 00       	jmp    804c41 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b05:	41 f6 c5 02          	test   $0x2,%r13b
+  804b09:	74 b8                	je     804ac3 <mmap+0xb3>
+  804b0b:	85 d2                	test   %edx,%edx
+  804b0d:	75 b4                	jne    804ac3 <mmap+0xb3>
+  804b0f:	e9 2d 01 00 00       	jmp    804c41 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b14:	4c 89 ff             	mov    %r15,%rdi
+  804b17:	48 b8 7e 46 80 00 00 	movabs $0x80467e,%rax
+  804b1e:	00 00 00 
+  804b21:	ff d0                	call   *%rax
+  804b23:	48 89 c2             	mov    %rax,%rdx
+  804b26:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b2d:	49 39 d7             	cmp    %rdx,%r15
+  804b30:	0f 85 0b 01 00 00    	jne    804c41 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b36:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b3d:	00 00 00 
+  804b40:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b46:	eb 44                	jmp    804b8c <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b48:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b4c:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b53:	00 00 00 
+  804b56:	48 b8 7e 46 80 00 00 	movabs $0x80467e,%rax
+  804b5d:	00 00 00 
+  804b60:	ff d0                	call   *%rax
+  804b62:	48 89 c7             	mov    %rax,%rdi
+  804b65:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b69:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b70:	48 85 ff             	test   %rdi,%rdi
+  804b73:	75 c1                	jne    804b36 <mmap+0x126>
+  804b75:	e9 c7 00 00 00       	jmp    804c41 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b7a:	49 83 c4 01          	add    $0x1,%r12
+  804b7e:	48 83 c0 20          	add    $0x20,%rax
+  804b82:	49 83 fc 20          	cmp    $0x20,%r12
+  804b86:	0f 84 a5 00 00 00    	je     804c31 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b8c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b90:	75 e8                	jne    804b7a <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b92:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b96:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  804b9d:	00 00 00 
+  804ba0:	ff d0                	call   *%rax
+  804ba2:	89 c2                	mov    %eax,%edx
+  804ba4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bab:	85 d2                	test   %edx,%edx
+  804bad:	0f 88 8e 00 00 00    	js     804c41 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bb3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bb7:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  804bbe:	00 00 00 
+  804bc1:	ff d0                	call   *%rax
+  804bc3:	89 c6                	mov    %eax,%esi
+  804bc5:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bc8:	48 b8 ea 2f 80 00 00 	movabs $0x802fea,%rax
+  804bcf:	00 00 00 
+  804bd2:	ff d0                	call   *%rax
+  804bd4:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bd7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bde:	45 85 ff             	test   %r15d,%r15d
+  804be1:	78 5e                	js     804c41 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804be3:	49 c1 e4 05          	shl    $0x5,%r12
+  804be7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bee:	00 00 00 
+  804bf1:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bf4:	48 bf ef 46 80 00 00 	movabs $0x8046ef,%rdi
+  804bfb:	00 00 00 
+  804bfe:	48 b8 bd 51 80 00 00 	movabs $0x8051bd,%rax
+  804c05:	00 00 00 
+  804c08:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c0a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c0e:	49 89 04 24          	mov    %rax,(%r12)
+  804c12:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c16:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c1b:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c20:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c25:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c2a:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c2f:	eb 10                	jmp    804c41 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c31:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c38:	eb 07                	jmp    804c41 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c3a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c41:	48 83 c4 38          	add    $0x38,%rsp
+  804c45:	5b                   	pop    %rbx
+  804c46:	41 5c                	pop    %r12
+  804c48:	41 5d                	pop    %r13
+  804c4a:	41 5e                	pop    %r14
+  804c4c:	41 5f                	pop    %r15
+  804c4e:	5d                   	pop    %rbp
+  804c4f:	c3                   	ret
+
+0000000000804c50 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c50:	55                   	push   %rbp
+  804c51:	48 89 e5             	mov    %rsp,%rbp
+  804c54:	41 57                	push   %r15
+  804c56:	41 56                	push   %r14
+  804c58:	41 55                	push   %r13
+  804c5a:	41 54                	push   %r12
+  804c5c:	53                   	push   %rbx
+  804c5d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c61:	49 89 fe             	mov    %rdi,%r14
+  804c64:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c6b:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c72:	00 
+  804c73:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c7a:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c81:	00 00 00 
+  804c84:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c8b:	49 bf d7 48 80 00 00 	movabs $0x8048d7,%r15
+  804c92:	00 00 00 
+  804c95:	eb 09                	jmp    804ca0 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c97:	48 83 c3 20          	add    $0x20,%rbx
+  804c9b:	4c 39 eb             	cmp    %r13,%rbx
+  804c9e:	74 33                	je     804cd3 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ca0:	48 89 df             	mov    %rbx,%rdi
+  804ca3:	48 8b 33             	mov    (%rbx),%rsi
+  804ca6:	4c 39 e6             	cmp    %r12,%rsi
+  804ca9:	73 ec                	jae    804c97 <msync+0x47>
+  804cab:	48 85 f6             	test   %rsi,%rsi
+  804cae:	74 e7                	je     804c97 <msync+0x47>
+  804cb0:	48 89 f2             	mov    %rsi,%rdx
+  804cb3:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cb7:	49 39 d6             	cmp    %rdx,%r14
+  804cba:	73 db                	jae    804c97 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cbc:	4c 39 e2             	cmp    %r12,%rdx
+  804cbf:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cc3:	4c 39 f6             	cmp    %r14,%rsi
+  804cc6:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cca:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804ccd:	85 c0                	test   %eax,%eax
+  804ccf:	79 c6                	jns    804c97 <msync+0x47>
+  804cd1:	eb 05                	jmp    804cd8 <msync+0x88>
+    }
+
+    return 0;
+  804cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cd8:	48 83 c4 08          	add    $0x8,%rsp
+  804cdc:	5b                   	pop    %rbx
+  804cdd:	41 5c                	pop    %r12
+  804cdf:	41 5d                	pop    %r13
+  804ce1:	41 5e                	pop    %r14
+  804ce3:	41 5f                	pop    %r15
+  804ce5:	5d                   	pop    %rbp
+  804ce6:	c3                   	ret
+
+0000000000804ce7 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804ce7:	55                   	push   %rbp
+  804ce8:	48 89 e5             	mov    %rsp,%rbp
+  804ceb:	41 57                	push   %r15
+  804ced:	41 56                	push   %r14
+  804cef:	41 55                	push   %r13
+  804cf1:	41 54                	push   %r12
+  804cf3:	53                   	push   %rbx
+  804cf4:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cf8:	49 89 ff             	mov    %rdi,%r15
+  804cfb:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d02:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d09:	00 
+  804d0a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d11:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d18:	00 00 00 
+  804d1b:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d22:	48 89 d8             	mov    %rbx,%rax
+  804d25:	eb 09                	jmp    804d30 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d27:	48 83 c0 20          	add    $0x20,%rax
+  804d2b:	4c 39 f0             	cmp    %r14,%rax
+  804d2e:	74 40                	je     804d70 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d30:	48 8b 10             	mov    (%rax),%rdx
+  804d33:	4c 39 e2             	cmp    %r12,%rdx
+  804d36:	73 ef                	jae    804d27 <munmap+0x40>
+  804d38:	48 85 d2             	test   %rdx,%rdx
+  804d3b:	74 ea                	je     804d27 <munmap+0x40>
+  804d3d:	48 89 d7             	mov    %rdx,%rdi
+  804d40:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d44:	49 39 ff             	cmp    %rdi,%r15
+  804d47:	73 de                	jae    804d27 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d49:	49 39 fc             	cmp    %rdi,%r12
+  804d4c:	72 05                	jb     804d53 <munmap+0x6c>
+  804d4e:	4c 39 fa             	cmp    %r15,%rdx
+  804d51:	73 d4                	jae    804d27 <munmap+0x40>
+  804d53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d58:	48 83 c4 08          	add    $0x8,%rsp
+  804d5c:	5b                   	pop    %rbx
+  804d5d:	41 5c                	pop    %r12
+  804d5f:	41 5d                	pop    %r13
+  804d61:	41 5e                	pop    %r14
+  804d63:	41 5f                	pop    %r15
+  804d65:	5d                   	pop    %rbp
+  804d66:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d67:	48 83 c3 20          	add    $0x20,%rbx
+  804d6b:	4c 39 f3             	cmp    %r14,%rbx
+  804d6e:	74 5c                	je     804dcc <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d70:	48 8b 33             	mov    (%rbx),%rsi
+  804d73:	4c 39 e6             	cmp    %r12,%rsi
+  804d76:	73 ef                	jae    804d67 <munmap+0x80>
+  804d78:	48 85 f6             	test   %rsi,%rsi
+  804d7b:	74 ea                	je     804d67 <munmap+0x80>
+  804d7d:	48 89 f2             	mov    %rsi,%rdx
+  804d80:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d84:	49 39 d7             	cmp    %rdx,%r15
+  804d87:	73 de                	jae    804d67 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d89:	48 89 df             	mov    %rbx,%rdi
+  804d8c:	48 b8 d7 48 80 00 00 	movabs $0x8048d7,%rax
+  804d93:	00 00 00 
+  804d96:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d98:	85 c0                	test   %eax,%eax
+  804d9a:	78 bc                	js     804d58 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d9c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804da0:	48 8b 33             	mov    (%rbx),%rsi
+  804da3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804da8:	48 b8 16 28 80 00 00 	movabs $0x802816,%rax
+  804daf:	00 00 00 
+  804db2:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804db4:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804db7:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  804dbe:	00 00 00 
+  804dc1:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dc3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dca:	eb 9b                	jmp    804d67 <munmap+0x80>
+    return 0;
+  804dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd1:	eb 85                	jmp    804d58 <munmap+0x71>
+
+0000000000804dd3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd8:	c3                   	ret
+
+0000000000804dd9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dd9:	55                   	push   %rbp
+  804dda:	48 89 e5             	mov    %rsp,%rbp
+  804ddd:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804de0:	48 be 05 63 80 00 00 	movabs $0x806305,%rsi
+  804de7:	00 00 00 
+  804dea:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  804df1:	00 00 00 
+  804df4:	ff d0                	call   *%rax
+    return 0;
+}
+  804df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfb:	5d                   	pop    %rbp
+  804dfc:	c3                   	ret
+
+0000000000804dfd <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804dfd:	55                   	push   %rbp
+  804dfe:	48 89 e5             	mov    %rsp,%rbp
+  804e01:	41 57                	push   %r15
+  804e03:	41 56                	push   %r14
+  804e05:	41 55                	push   %r13
+  804e07:	41 54                	push   %r12
+  804e09:	53                   	push   %rbx
+  804e0a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e11:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e18:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e1f:	00 00 00 00 
+  804e23:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e2a:	00 00 00 00 
+  804e2e:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e35:	00 00 00 00 
+  804e39:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e40:	00 00 00 00 
+  804e44:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e4b:	00 00 00 00 
+  804e4f:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e56:	00 00 00 00 
+  804e5a:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e61:	00 
+  804e62:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e69:	00 
+  804e6a:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e71:	00 
+  804e72:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e79:	00 
+  804e7a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e81:	00 
+  804e82:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e89:	00 
+  804e8a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e91:	00 
+  804e92:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e99:	00 
+  804e9a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804ea1:	00 
+  804ea2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804ea9:	00 
+    for (res = 0; res < n; res += inc) {
+  804eaa:	48 85 d2             	test   %rdx,%rdx
+  804ead:	74 7a                	je     804f29 <devcons_write+0x12c>
+  804eaf:	49 89 d6             	mov    %rdx,%r14
+  804eb2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804eb8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ebd:	49 bf 29 23 80 00 00 	movabs $0x802329,%r15
+  804ec4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ec7:	4c 89 f3             	mov    %r14,%rbx
+  804eca:	48 29 f3             	sub    %rsi,%rbx
+  804ecd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ed2:	48 39 c3             	cmp    %rax,%rbx
+  804ed5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ed9:	4c 63 eb             	movslq %ebx,%r13
+  804edc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ee3:	48 01 c6             	add    %rax,%rsi
+  804ee6:	4c 89 ea             	mov    %r13,%rdx
+  804ee9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ef0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ef3:	4c 89 ee             	mov    %r13,%rsi
+  804ef6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804efd:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  804f04:	00 00 00 
+  804f07:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f09:	41 01 dc             	add    %ebx,%r12d
+  804f0c:	49 63 f4             	movslq %r12d,%rsi
+  804f0f:	4c 39 f6             	cmp    %r14,%rsi
+  804f12:	72 b3                	jb     804ec7 <devcons_write+0xca>
+    return res;
+  804f14:	49 63 c4             	movslq %r12d,%rax
+}
+  804f17:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f1e:	5b                   	pop    %rbx
+  804f1f:	41 5c                	pop    %r12
+  804f21:	41 5d                	pop    %r13
+  804f23:	41 5e                	pop    %r14
+  804f25:	41 5f                	pop    %r15
+  804f27:	5d                   	pop    %rbp
+  804f28:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f29:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f2f:	eb e3                	jmp    804f14 <devcons_write+0x117>
+
+0000000000804f31 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f31:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f39:	48 85 c0             	test   %rax,%rax
+  804f3c:	74 55                	je     804f93 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f3e:	55                   	push   %rbp
+  804f3f:	48 89 e5             	mov    %rsp,%rbp
+  804f42:	41 55                	push   %r13
+  804f44:	41 54                	push   %r12
+  804f46:	53                   	push   %rbx
+  804f47:	48 83 ec 08          	sub    $0x8,%rsp
+  804f4b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f4e:	48 bb 89 25 80 00 00 	movabs $0x802589,%rbx
+  804f55:	00 00 00 
+  804f58:	49 bc 9d 26 80 00 00 	movabs $0x80269d,%r12
+  804f5f:	00 00 00 
+  804f62:	eb 03                	jmp    804f67 <devcons_read+0x36>
+  804f64:	41 ff d4             	call   *%r12
+  804f67:	ff d3                	call   *%rbx
+  804f69:	85 c0                	test   %eax,%eax
+  804f6b:	74 f7                	je     804f64 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f6d:	48 63 d0             	movslq %eax,%rdx
+  804f70:	78 13                	js     804f85 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f72:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f77:	83 f8 04             	cmp    $0x4,%eax
+  804f7a:	74 09                	je     804f85 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f7c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f80:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f85:	48 89 d0             	mov    %rdx,%rax
+  804f88:	48 83 c4 08          	add    $0x8,%rsp
+  804f8c:	5b                   	pop    %rbx
+  804f8d:	41 5c                	pop    %r12
+  804f8f:	41 5d                	pop    %r13
+  804f91:	5d                   	pop    %rbp
+  804f92:	c3                   	ret
+  804f93:	48 89 d0             	mov    %rdx,%rax
+  804f96:	c3                   	ret
+
+0000000000804f97 <cputchar>:
+cputchar(int ch) {
+  804f97:	55                   	push   %rbp
+  804f98:	48 89 e5             	mov    %rsp,%rbp
+  804f9b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f9f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fa3:	be 01 00 00 00       	mov    $0x1,%esi
+  804fa8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fac:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  804fb3:	00 00 00 
+  804fb6:	ff d0                	call   *%rax
+}
+  804fb8:	c9                   	leave
+  804fb9:	c3                   	ret
+
+0000000000804fba <getchar>:
+getchar(void) {
+  804fba:	55                   	push   %rbp
+  804fbb:	48 89 e5             	mov    %rsp,%rbp
+  804fbe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fc2:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fc7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fd0:	48 b8 0d 31 80 00 00 	movabs $0x80310d,%rax
+  804fd7:	00 00 00 
+  804fda:	ff d0                	call   *%rax
+  804fdc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fde:	85 c0                	test   %eax,%eax
+  804fe0:	78 06                	js     804fe8 <getchar+0x2e>
+  804fe2:	74 08                	je     804fec <getchar+0x32>
+  804fe4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fe8:	89 d0                	mov    %edx,%eax
+  804fea:	c9                   	leave
+  804feb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fec:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804ff1:	eb f5                	jmp    804fe8 <getchar+0x2e>
+
+0000000000804ff3 <iscons>:
+iscons(int fdnum) {
+  804ff3:	55                   	push   %rbp
+  804ff4:	48 89 e5             	mov    %rsp,%rbp
+  804ff7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ffb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fff:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  805006:	00 00 00 
+  805009:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80500b:	85 c0                	test   %eax,%eax
+  80500d:	78 18                	js     805027 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80500f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805013:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80501a:	00 00 00 
+  80501d:	8b 00                	mov    (%rax),%eax
+  80501f:	39 02                	cmp    %eax,(%rdx)
+  805021:	0f 94 c0             	sete   %al
+  805024:	0f b6 c0             	movzbl %al,%eax
+}
+  805027:	c9                   	leave
+  805028:	c3                   	ret
+
+0000000000805029 <opencons>:
+opencons(void) {
+  805029:	55                   	push   %rbp
+  80502a:	48 89 e5             	mov    %rsp,%rbp
+  80502d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805031:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805035:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  80503c:	00 00 00 
+  80503f:	ff d0                	call   *%rax
+  805041:	85 c0                	test   %eax,%eax
+  805043:	78 49                	js     80508e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805045:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80504a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80504f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805053:	bf 00 00 00 00       	mov    $0x0,%edi
+  805058:	48 b8 3e 27 80 00 00 	movabs $0x80273e,%rax
+  80505f:	00 00 00 
+  805062:	ff d0                	call   *%rax
+  805064:	85 c0                	test   %eax,%eax
+  805066:	78 26                	js     80508e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805068:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80506c:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805073:	00 00 
+  805075:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805077:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80507b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805082:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  805089:	00 00 00 
+  80508c:	ff d0                	call   *%rax
+}
+  80508e:	c9                   	leave
+  80508f:	c3                   	ret
+
+0000000000805090 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805090:	55                   	push   %rbp
+  805091:	48 89 e5             	mov    %rsp,%rbp
+  805094:	41 56                	push   %r14
+  805096:	41 55                	push   %r13
+  805098:	41 54                	push   %r12
+  80509a:	53                   	push   %rbx
+  80509b:	48 83 ec 50          	sub    $0x50,%rsp
+  80509f:	49 89 fc             	mov    %rdi,%r12
+  8050a2:	41 89 f5             	mov    %esi,%r13d
+  8050a5:	48 89 d3             	mov    %rdx,%rbx
+  8050a8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050ac:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050b0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050b4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050bb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050bf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050c3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050c7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050cb:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050d2:	00 00 00 
+  8050d5:	4c 8b 30             	mov    (%rax),%r14
+  8050d8:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  8050df:	00 00 00 
+  8050e2:	ff d0                	call   *%rax
+  8050e4:	89 c6                	mov    %eax,%esi
+  8050e6:	45 89 e8             	mov    %r13d,%r8d
+  8050e9:	4c 89 e1             	mov    %r12,%rcx
+  8050ec:	4c 89 f2             	mov    %r14,%rdx
+  8050ef:	48 bf 18 63 80 00 00 	movabs $0x806318,%rdi
+  8050f6:	00 00 00 
+  8050f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050fe:	49 bc a2 16 80 00 00 	movabs $0x8016a2,%r12
+  805105:	00 00 00 
+  805108:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80510b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80510f:	48 89 df             	mov    %rbx,%rdi
+  805112:	48 b8 3e 16 80 00 00 	movabs $0x80163e,%rax
+  805119:	00 00 00 
+  80511c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80511e:	48 bf 3e 5c 80 00 00 	movabs $0x805c3e,%rdi
+  805125:	00 00 00 
+  805128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80512d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805130:	cc                   	int3
+  805131:	eb fd                	jmp    805130 <_panic+0xa0>
+
+0000000000805133 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805133:	55                   	push   %rbp
+  805134:	48 89 e5             	mov    %rsp,%rbp
+  805137:	41 56                	push   %r14
+  805139:	41 55                	push   %r13
+  80513b:	41 54                	push   %r12
+  80513d:	53                   	push   %rbx
+  80513e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805141:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805148:	00 00 00 
+  80514b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80514f:	74 27                	je     805178 <_handle_vectored_pagefault+0x45>
+  805151:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805156:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80515d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805160:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805163:	4c 89 e7             	mov    %r12,%rdi
+  805166:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80516b:	84 c0                	test   %al,%al
+  80516d:	75 45                	jne    8051b4 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80516f:	48 83 c3 01          	add    $0x1,%rbx
+  805173:	49 3b 1e             	cmp    (%r14),%rbx
+  805176:	72 eb                	jb     805163 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805178:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80517f:	00 
+  805180:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805185:	4d 8b 04 24          	mov    (%r12),%r8
+  805189:	48 ba 40 63 80 00 00 	movabs $0x806340,%rdx
+  805190:	00 00 00 
+  805193:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805198:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  80519f:	00 00 00 
+  8051a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a7:	49 ba 90 50 80 00 00 	movabs $0x805090,%r10
+  8051ae:	00 00 00 
+  8051b1:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051b4:	5b                   	pop    %rbx
+  8051b5:	41 5c                	pop    %r12
+  8051b7:	41 5d                	pop    %r13
+  8051b9:	41 5e                	pop    %r14
+  8051bb:	5d                   	pop    %rbp
+  8051bc:	c3                   	ret
+
+00000000008051bd <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051bd:	55                   	push   %rbp
+  8051be:	48 89 e5             	mov    %rsp,%rbp
+  8051c1:	53                   	push   %rbx
+  8051c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8051c6:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051c9:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051ce:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051d5:	00 00 00 
+  8051d8:	80 38 00             	cmpb   $0x0,(%rax)
+  8051db:	74 68                	je     805245 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051dd:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051e4:	00 00 00 
+  8051e7:	48 8b 08             	mov    (%rax),%rcx
+  8051ea:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051ef:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051f6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f9:	48 85 c9             	test   %rcx,%rcx
+  8051fc:	0f 84 e0 00 00 00    	je     8052e2 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805202:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805206:	0f 84 c9 00 00 00    	je     8052d5 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80520c:	48 83 c2 01          	add    $0x1,%rdx
+  805210:	48 39 ca             	cmp    %rcx,%rdx
+  805213:	75 ed                	jne    805202 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805215:	48 83 f9 08          	cmp    $0x8,%rcx
+  805219:	0f 84 84 00 00 00    	je     8052a3 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80521f:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805223:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80522a:	00 00 00 
+  80522d:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805234:	00 00 00 
+  805237:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80523b:	85 f6                	test   %esi,%esi
+  80523d:	0f 89 97 00 00 00    	jns    8052da <add_pgfault_handler+0x11d>
+  805243:	eb 63                	jmp    8052a8 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805245:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80524a:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80524f:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805256:	00 00 00 
+  805259:	bf 00 00 00 00       	mov    $0x0,%edi
+  80525e:	48 b8 3e 27 80 00 00 	movabs $0x80273e,%rax
+  805265:	00 00 00 
+  805268:	ff d0                	call   *%rax
+  80526a:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80526c:	85 c0                	test   %eax,%eax
+  80526e:	78 38                	js     8052a8 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805270:	48 be be 53 80 00 00 	movabs $0x8053be,%rsi
+  805277:	00 00 00 
+  80527a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80527f:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  805286:	00 00 00 
+  805289:	ff d0                	call   *%rax
+  80528b:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80528d:	85 c0                	test   %eax,%eax
+  80528f:	78 17                	js     8052a8 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805291:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805298:	00 00 00 
+  80529b:	c6 00 01             	movb   $0x1,(%rax)
+  80529e:	e9 3a ff ff ff       	jmp    8051dd <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052a3:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052a8:	89 f1                	mov    %esi,%ecx
+  8052aa:	48 ba 7e 63 80 00 00 	movabs $0x80637e,%rdx
+  8052b1:	00 00 00 
+  8052b4:	be 42 00 00 00       	mov    $0x42,%esi
+  8052b9:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  8052c0:	00 00 00 
+  8052c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052c8:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  8052cf:	00 00 00 
+  8052d2:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052d5:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052da:	89 f0                	mov    %esi,%eax
+  8052dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052e0:	c9                   	leave
+  8052e1:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052e2:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052e9:	00 00 00 
+  8052ec:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052f3:	48 89 d8             	mov    %rbx,%rax
+  8052f6:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052fd:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805300:	eb d8                	jmp    8052da <add_pgfault_handler+0x11d>
+
+0000000000805302 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805302:	55                   	push   %rbp
+  805303:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805306:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80530d:	00 00 00 
+  805310:	80 38 00             	cmpb   $0x0,(%rax)
+  805313:	74 33                	je     805348 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805315:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80531c:	00 00 00 
+  80531f:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805324:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80532b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80532e:	48 85 c0             	test   %rax,%rax
+  805331:	0f 84 85 00 00 00    	je     8053bc <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805337:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80533b:	74 40                	je     80537d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80533d:	48 83 c1 01          	add    $0x1,%rcx
+  805341:	48 39 c1             	cmp    %rax,%rcx
+  805344:	75 f1                	jne    805337 <remove_pgfault_handler+0x35>
+  805346:	eb 74                	jmp    8053bc <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805348:	48 b9 96 63 80 00 00 	movabs $0x806396,%rcx
+  80534f:	00 00 00 
+  805352:	48 ba 56 62 80 00 00 	movabs $0x806256,%rdx
+  805359:	00 00 00 
+  80535c:	be 48 00 00 00       	mov    $0x48,%esi
+  805361:	48 bf 70 63 80 00 00 	movabs $0x806370,%rdi
+  805368:	00 00 00 
+  80536b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805370:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  805377:	00 00 00 
+  80537a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80537d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805384:	00 
+  805385:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805389:	48 29 ca             	sub    %rcx,%rdx
+  80538c:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805393:	00 00 00 
+  805396:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80539a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80539f:	48 89 ce             	mov    %rcx,%rsi
+  8053a2:	48 b8 29 23 80 00 00 	movabs $0x802329,%rax
+  8053a9:	00 00 00 
+  8053ac:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053ae:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053b5:	00 00 00 
+  8053b8:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053bc:	5d                   	pop    %rbp
+  8053bd:	c3                   	ret
+
+00000000008053be <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053be:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053c1:	48 b8 33 51 80 00 00 	movabs $0x805133,%rax
+  8053c8:	00 00 00 
+    call *%rax
+  8053cb:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053cd:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053d4:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053d5:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053dc:	00 
+    subq $8, %rcx
+  8053dd:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053e1:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053e4:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053eb:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053ec:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053f0:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053f4:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053f9:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053fe:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805403:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805408:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80540d:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805412:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805417:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80541c:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805421:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805426:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80542b:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805430:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805435:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80543a:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80543e:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805442:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805443:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805444:	c3                   	ret
+
+0000000000805445 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805445:	85 ff                	test   %edi,%edi
+  805447:	78 58                	js     8054a1 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805449:	48 85 f6             	test   %rsi,%rsi
+  80544c:	74 12                	je     805460 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80544e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805455:	00 00 00 
+  805458:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80545e:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805460:	48 85 c9             	test   %rcx,%rcx
+  805463:	74 12                	je     805477 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805465:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80546c:	00 00 00 
+  80546f:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805475:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805477:	48 85 d2             	test   %rdx,%rdx
+  80547a:	74 14                	je     805490 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80547c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805483:	00 00 00 
+  805486:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80548d:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805490:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805497:	00 00 00 
+  80549a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054a0:	c3                   	ret
+        if (from_env_store) {
+  8054a1:	48 85 f6             	test   %rsi,%rsi
+  8054a4:	74 06                	je     8054ac <ipc_result+0x67>
+            *from_env_store = 0;
+  8054a6:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054ac:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054ae:	48 85 c9             	test   %rcx,%rcx
+  8054b1:	74 ed                	je     8054a0 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054b3:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054b9:	c3                   	ret
+
+00000000008054ba <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054ba:	55                   	push   %rbp
+  8054bb:	48 89 e5             	mov    %rsp,%rbp
+  8054be:	41 55                	push   %r13
+  8054c0:	41 54                	push   %r12
+  8054c2:	53                   	push   %rbx
+  8054c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8054c7:	49 89 fc             	mov    %rdi,%r12
+  8054ca:	48 89 f7             	mov    %rsi,%rdi
+  8054cd:	48 89 d3             	mov    %rdx,%rbx
+  8054d0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054d3:	48 85 f6             	test   %rsi,%rsi
+  8054d6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054dd:	00 00 00 
+  8054e0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8054e9:	48 85 d2             	test   %rdx,%rdx
+  8054ec:	74 03                	je     8054f1 <ipc_recv+0x37>
+  8054ee:	48 8b 32             	mov    (%rdx),%rsi
+  8054f1:	48 b8 8a 2c 80 00 00 	movabs $0x802c8a,%rax
+  8054f8:	00 00 00 
+  8054fb:	ff d0                	call   *%rax
+  8054fd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054ff:	4c 89 e9             	mov    %r13,%rcx
+  805502:	48 89 da             	mov    %rbx,%rdx
+  805505:	4c 89 e6             	mov    %r12,%rsi
+  805508:	48 b8 45 54 80 00 00 	movabs $0x805445,%rax
+  80550f:	00 00 00 
+  805512:	ff d0                	call   *%rax
+}
+  805514:	48 83 c4 08          	add    $0x8,%rsp
+  805518:	5b                   	pop    %rbx
+  805519:	41 5c                	pop    %r12
+  80551b:	41 5d                	pop    %r13
+  80551d:	5d                   	pop    %rbp
+  80551e:	c3                   	ret
+
+000000000080551f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80551f:	55                   	push   %rbp
+  805520:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805523:	48 85 d2             	test   %rdx,%rdx
+  805526:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80552d:	00 00 00 
+  805530:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805534:	89 f6                	mov    %esi,%esi
+  805536:	48 b8 16 2b 80 00 00 	movabs $0x802b16,%rax
+  80553d:	00 00 00 
+  805540:	ff d0                	call   *%rax
+    if (res < 0) {
+  805542:	85 c0                	test   %eax,%eax
+  805544:	78 02                	js     805548 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805546:	5d                   	pop    %rbp
+  805547:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805548:	89 c1                	mov    %eax,%ecx
+  80554a:	48 ba b0 63 80 00 00 	movabs $0x8063b0,%rdx
+  805551:	00 00 00 
+  805554:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805559:	48 bf bd 63 80 00 00 	movabs $0x8063bd,%rdi
+  805560:	00 00 00 
+  805563:	b8 00 00 00 00       	mov    $0x0,%eax
+  805568:	49 b8 90 50 80 00 00 	movabs $0x805090,%r8
+  80556f:	00 00 00 
+  805572:	41 ff d0             	call   *%r8
+
+0000000000805575 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805575:	55                   	push   %rbp
+  805576:	48 89 e5             	mov    %rsp,%rbp
+  805579:	53                   	push   %rbx
+  80557a:	48 83 ec 08          	sub    $0x8,%rsp
+  80557e:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805582:	48 85 d2             	test   %rdx,%rdx
+  805585:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80558c:	00 00 00 
+  80558f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805593:	4d 85 c9             	test   %r9,%r9
+  805596:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80559a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80559f:	48 85 db             	test   %rbx,%rbx
+  8055a2:	74 03                	je     8055a7 <ipc_call+0x32>
+  8055a4:	48 8b 03             	mov    (%rbx),%rax
+  8055a7:	89 f6                	mov    %esi,%esi
+  8055a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8055ad:	50                   	push   %rax
+  8055ae:	48 b8 48 2b 80 00 00 	movabs $0x802b48,%rax
+  8055b5:	00 00 00 
+  8055b8:	ff d0                	call   *%rax
+  8055ba:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055bc:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055c0:	48 89 da             	mov    %rbx,%rdx
+  8055c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8055c8:	48 b8 45 54 80 00 00 	movabs $0x805445,%rax
+  8055cf:	00 00 00 
+  8055d2:	ff d0                	call   *%rax
+}
+  8055d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055d8:	c9                   	leave
+  8055d9:	c3                   	ret
+
+00000000008055da <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055da:	55                   	push   %rbp
+  8055db:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055de:	89 f6                	mov    %esi,%esi
+  8055e0:	48 b8 b4 2b 80 00 00 	movabs $0x802bb4,%rax
+  8055e7:	00 00 00 
+  8055ea:	ff d0                	call   *%rax
+  8055ec:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8055fd:	48 b8 45 54 80 00 00 	movabs $0x805445,%rax
+  805604:	00 00 00 
+  805607:	ff d0                	call   *%rax
+}
+  805609:	5d                   	pop    %rbp
+  80560a:	c3                   	ret
+
+000000000080560b <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80560b:	55                   	push   %rbp
+  80560c:	48 89 e5             	mov    %rsp,%rbp
+  80560f:	41 54                	push   %r12
+  805611:	53                   	push   %rbx
+  805612:	4c 89 cb             	mov    %r9,%rbx
+  805615:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805619:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80561d:	48 85 d2             	test   %rdx,%rdx
+  805620:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805627:	00 00 00 
+  80562a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80562e:	4d 85 c9             	test   %r9,%r9
+  805631:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80563a:	4d 85 e4             	test   %r12,%r12
+  80563d:	74 04                	je     805643 <ipc_reply_wait+0x38>
+  80563f:	49 8b 04 24          	mov    (%r12),%rax
+  805643:	89 f6                	mov    %esi,%esi
+  805645:	48 83 ec 08          	sub    $0x8,%rsp
+  805649:	50                   	push   %rax
+  80564a:	48 b8 1e 2c 80 00 00 	movabs $0x802c1e,%rax
+  805651:	00 00 00 
+  805654:	ff d0                	call   *%rax
+  805656:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805658:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80565c:	4c 89 e2             	mov    %r12,%rdx
+  80565f:	48 89 de             	mov    %rbx,%rsi
+  805662:	48 b8 45 54 80 00 00 	movabs $0x805445,%rax
+  805669:	00 00 00 
+  80566c:	ff d0                	call   *%rax
+}
+  80566e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805672:	5b                   	pop    %rbx
+  805673:	41 5c                	pop    %r12
+  805675:	5d                   	pop    %rbp
+  805676:	c3                   	ret
+
+0000000000805677 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805677:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80567c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805683:	00 00 00 
+  805686:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80568d:	48 01 ca             	add    %rcx,%rdx
+  805690:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805696:	39 fa                	cmp    %edi,%edx
+  805698:	74 12                	je     8056ac <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80569a:	48 83 c0 01          	add    $0x1,%rax
+  80569e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056a4:	75 e0                	jne    805686 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056ab:	c3                   	ret
+            return envs[i].env_id;
+  8056ac:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056b3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056ba:	00 00 00 
+  8056bd:	48 01 d0             	add    %rdx,%rax
+  8056c0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056c6:	c3                   	ret
+  8056c7:	90                   	nop
+
+00000000008056c8 <__rodata_start>:
+  8056c8:	77 00                	ja     8056ca <__rodata_start+0x2>
+  8056ca:	72 62                	jb     80572e <__rodata_start+0x66>
+  8056cc:	00 77 62             	add    %dh,0x62(%rdi)
+  8056cf:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056d2:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056d9:	00 
+  8056da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 49 20 72 65 61 64 20 25 30 38 78 20 66 72     ..I read %08x fr
+  805c30:	6f 6d 20 6c 6f 63 61 74 69 6f 6e 20 30 21 0a 00     om location 0!..
+  805c40:	3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35     <unknown>.012345
+  805c50:	36 37 38 39 41 42 43 44 45 46 00 30 31 32 33 34     6789ABCDEF.01234
+  805c60:	35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75 6c     56789abcdef.(nul
+  805c70:	6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73 70     l).error %d.unsp
+  805c80:	65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62 61     ecified error.ba
+  805c90:	64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e     d environment.in
+  805ca0:	76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72 00     valid parameter.
+  805cb0:	6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75     out of memory.ou
+  805cc0:	74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74     t of environment
+  805cd0:	73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62 75     s.corrupted debu
+  805ce0:	67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74     g info.segmentat
+  805cf0:	69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69     ion fault.invali
+  805d00:	64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73     d ELF image.no s
+  805d10:	75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00     uch system call.
+  805d20:	65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00     entry not found.
+  805d30:	65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76 69     env is not recvi
+  805d40:	6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65 6e     ng.unexpected en
+  805d50:	64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65     d of file.no fre
+  805d60:	65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00     e space on disk.
+  805d70:	74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61     too many files a
+  805d80:	72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20     re open.file or 
+  805d90:	62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00     block not found.
+  805da0:	69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69 6c     invalid path.fil
+  805db0:	65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74 73     e already exists
+  805dc0:	00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73     .operation not s
+  805dd0:	75 70 70 6f 72 74 65 64 00 0f 1f 80 00 00 00 00     upported........
+  805de0:	9a 18 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805df0:	e1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805e00:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805e10:	f1 1e 80 00 00 00 00 00 b9 18 80 00 00 00 00 00     ................
+  805e20:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805e30:	ad 18 80 00 00 00 00 00 27 19 80 00 00 00 00 00     ........'.......
+  805e40:	f1 1e 80 00 00 00 00 00 ad 18 80 00 00 00 00 00     ................
+  805e50:	f3 18 80 00 00 00 00 00 f3 18 80 00 00 00 00 00     ................
+  805e60:	f3 18 80 00 00 00 00 00 f3 18 80 00 00 00 00 00     ................
+  805e70:	f3 18 80 00 00 00 00 00 f3 18 80 00 00 00 00 00     ................
+  805e80:	f3 18 80 00 00 00 00 00 f3 18 80 00 00 00 00 00     ................
+  805e90:	f3 18 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805ea0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805eb0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805ec0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805ed0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805ee0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805ef0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f00:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f10:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f20:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f30:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f40:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f50:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f60:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f70:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805f80:	f1 1e 80 00 00 00 00 00 0f 1e 80 00 00 00 00 00     ................
+  805f90:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805fa0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805fb0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805fc0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805fd0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  805fe0:	55 19 80 00 00 00 00 00 24 1b 80 00 00 00 00 00     U.......$.......
+  805ff0:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  806000:	f1 1e 80 00 00 00 00 00 4a 19 80 00 00 00 00 00     ........J.......
+  806010:	84 19 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  806020:	f1 1e 80 00 00 00 00 00 3f 19 80 00 00 00 00 00     ........?.......
+  806030:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  806040:	cd 1c 80 00 00 00 00 00 9c 1d 80 00 00 00 00 00     ................
+  806050:	f1 1e 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  806060:	1b 1a 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  806070:	f8 1b 80 00 00 00 00 00 f1 1e 80 00 00 00 00 00     ................
+  806080:	f1 1e 80 00 00 00 00 00 0f 1e 80 00 00 00 00 00     ................
+  806090:	f1 1e 80 00 00 00 00 00 a3 18 80 00 00 00 00 00     ................
+
+00000000008060a0 <error_string>:
+	...
+  8060a8:	7c 5c 80 00 00 00 00 00 8e 5c 80 00 00 00 00 00     |\.......\......
+  8060b8:	9e 5c 80 00 00 00 00 00 b0 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	be 5c 80 00 00 00 00 00 d2 5c 80 00 00 00 00 00     .\.......\......
+  8060d8:	e7 5c 80 00 00 00 00 00 fa 5c 80 00 00 00 00 00     .\.......\......
+  8060e8:	0c 5d 80 00 00 00 00 00 20 5d 80 00 00 00 00 00     .]...... ]......
+  8060f8:	30 5d 80 00 00 00 00 00 43 5d 80 00 00 00 00 00     0]......C]......
+  806108:	5a 5d 80 00 00 00 00 00 70 5d 80 00 00 00 00 00     Z]......p]......
+  806118:	88 5d 80 00 00 00 00 00 a0 5d 80 00 00 00 00 00     .].......]......
+  806128:	ad 5d 80 00 00 00 00 00 40 61 80 00 00 00 00 00     .]......@a......
+  806138:	c1 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806148:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806158:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806168:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806178:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806188:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806198:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8061a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8061b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806208:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806218:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806220 <devtab>:
+  806220:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806230:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806240:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806250:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806260:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806270:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806280:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806290:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8062a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8062b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806300:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806310:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806320:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806330:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806340:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806350:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806360:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806370:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806380:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806390:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8063a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8063b0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063c0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806400:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806410:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806420:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806430:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806440:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806450:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806460:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
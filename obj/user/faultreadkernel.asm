@@ -0,0 +1,10322 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 80 22 80 00 00 	movabs $0x802280,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 a0 1f 80 00 00 	movabs $0x801fa0,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 01 21 80 00 00 	movabs $0x802101,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 41 32 80 00 00 	movabs $0x803241,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 a0 1f 80 00 00 	movabs $0x801fa0,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 41 32 80 00 00 	movabs $0x803241,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 d7 15 80 00 00 	movabs $0x8015d7,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be bf 5c 80 00 00 	movabs $0x805cbf,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 a0 20 80 00 00 	movabs $0x8020a0,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be d0 56 80 00 00 	movabs $0x8056d0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 a0 20 80 00 00 	movabs $0x8020a0,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be d2 56 80 00 00 	movabs $0x8056d2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 a0 20 80 00 00 	movabs $0x8020a0,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be d5 56 80 00 00 	movabs $0x8056d5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 a0 20 80 00 00 	movabs $0x8020a0,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 15 4a 80 00 00 	movabs $0x804a15,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 ec 4c 80 00 00 	movabs $0x804cec,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 94 2f 80 00 00 	movabs $0x802f94,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 f4 33 80 00 00 	movabs $0x8033f4,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 12 31 80 00 00 	movabs $0x803112,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 41 32 80 00 00 	movabs $0x803241,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 94 2f 80 00 00 	movabs $0x802f94,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 a0 1f 80 00 00 	movabs $0x801fa0,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 4d 22 80 00 00 	movabs $0x80224d,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 4d 22 80 00 00 	movabs $0x80224d,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 80 22 80 00 00 	movabs $0x802280,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 4d 22 80 00 00 	movabs $0x80224d,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 4d 22 80 00 00 	movabs $0x80224d,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 4d 22 80 00 00 	movabs $0x80224d,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 2f 00 00 00       	call   80152e <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+/* Buggy program - faults with a read from kernel space */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  801505:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80150c:	00 00 00 
+  80150f:	8b 30                	mov    (%rax),%esi
+  801511:	48 bf 28 5c 80 00 00 	movabs $0x805c28,%rdi
+  801518:	00 00 00 
+  80151b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801520:	48 ba a7 16 80 00 00 	movabs $0x8016a7,%rdx
+  801527:	00 00 00 
+  80152a:	ff d2                	call   *%rdx
+}
+  80152c:	5d                   	pop    %rbp
+  80152d:	c3                   	ret
+
+000000000080152e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80152e:	55                   	push   %rbp
+  80152f:	48 89 e5             	mov    %rsp,%rbp
+  801532:	41 56                	push   %r14
+  801534:	41 55                	push   %r13
+  801536:	41 54                	push   %r12
+  801538:	53                   	push   %rbx
+  801539:	41 89 fd             	mov    %edi,%r13d
+  80153c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80153f:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801546:	00 00 00 
+  801549:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801550:	00 00 00 
+  801553:	48 39 c2             	cmp    %rax,%rdx
+  801556:	73 17                	jae    80156f <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801558:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80155b:	49 89 c4             	mov    %rax,%r12
+  80155e:	48 83 c3 08          	add    $0x8,%rbx
+  801562:	b8 00 00 00 00       	mov    $0x0,%eax
+  801567:	ff 53 f8             	call   *-0x8(%rbx)
+  80156a:	4c 39 e3             	cmp    %r12,%rbx
+  80156d:	72 ef                	jb     80155e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80156f:	48 b8 6b 26 80 00 00 	movabs $0x80266b,%rax
+  801576:	00 00 00 
+  801579:	ff d0                	call   *%rax
+  80157b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801580:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801587:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80158e:	00 00 00 
+  801591:	48 01 d0             	add    %rdx,%rax
+  801594:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80159b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80159e:	45 85 ed             	test   %r13d,%r13d
+  8015a1:	7e 0d                	jle    8015b0 <libmain+0x82>
+  8015a3:	49 8b 06             	mov    (%r14),%rax
+  8015a6:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015ad:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015b0:	4c 89 f6             	mov    %r14,%rsi
+  8015b3:	44 89 ef             	mov    %r13d,%edi
+  8015b6:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015bd:	00 00 00 
+  8015c0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015c2:	48 b8 d7 15 80 00 00 	movabs $0x8015d7,%rax
+  8015c9:	00 00 00 
+  8015cc:	ff d0                	call   *%rax
+#endif
+}
+  8015ce:	5b                   	pop    %rbx
+  8015cf:	41 5c                	pop    %r12
+  8015d1:	41 5d                	pop    %r13
+  8015d3:	41 5e                	pop    %r14
+  8015d5:	5d                   	pop    %rbp
+  8015d6:	c3                   	ret
+
+00000000008015d7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015d7:	55                   	push   %rbp
+  8015d8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015db:	48 b8 c7 2f 80 00 00 	movabs $0x802fc7,%rax
+  8015e2:	00 00 00 
+  8015e5:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ec:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  8015f3:	00 00 00 
+  8015f6:	ff d0                	call   *%rax
+}
+  8015f8:	5d                   	pop    %rbp
+  8015f9:	c3                   	ret
+
+00000000008015fa <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015fa:	55                   	push   %rbp
+  8015fb:	48 89 e5             	mov    %rsp,%rbp
+  8015fe:	53                   	push   %rbx
+  8015ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801603:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801606:	8b 06                	mov    (%rsi),%eax
+  801608:	8d 50 01             	lea    0x1(%rax),%edx
+  80160b:	89 16                	mov    %edx,(%rsi)
+  80160d:	48 98                	cltq
+  80160f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801614:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80161a:	74 0a                	je     801626 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80161c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801620:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801624:	c9                   	leave
+  801625:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801626:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80162a:	be ff 00 00 00       	mov    $0xff,%esi
+  80162f:	48 b8 5b 25 80 00 00 	movabs $0x80255b,%rax
+  801636:	00 00 00 
+  801639:	ff d0                	call   *%rax
+        state->offset = 0;
+  80163b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801641:	eb d9                	jmp    80161c <putch+0x22>
+
+0000000000801643 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801643:	55                   	push   %rbp
+  801644:	48 89 e5             	mov    %rsp,%rbp
+  801647:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80164e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801651:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801658:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80165d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801662:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801665:	48 89 f1             	mov    %rsi,%rcx
+  801668:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80166f:	48 bf fa 15 80 00 00 	movabs $0x8015fa,%rdi
+  801676:	00 00 00 
+  801679:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  801680:	00 00 00 
+  801683:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801685:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80168c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801693:	48 b8 5b 25 80 00 00 	movabs $0x80255b,%rax
+  80169a:	00 00 00 
+  80169d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80169f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016a5:	c9                   	leave
+  8016a6:	c3                   	ret
+
+00000000008016a7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016a7:	55                   	push   %rbp
+  8016a8:	48 89 e5             	mov    %rsp,%rbp
+  8016ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8016af:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016b3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016bb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016bf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016c3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016d2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016da:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016de:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  8016e5:	00 00 00 
+  8016e8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016ea:	c9                   	leave
+  8016eb:	c3                   	ret
+
+00000000008016ec <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016ec:	55                   	push   %rbp
+  8016ed:	48 89 e5             	mov    %rsp,%rbp
+  8016f0:	41 57                	push   %r15
+  8016f2:	41 56                	push   %r14
+  8016f4:	41 55                	push   %r13
+  8016f6:	41 54                	push   %r12
+  8016f8:	53                   	push   %rbx
+  8016f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8016fd:	49 89 fc             	mov    %rdi,%r12
+  801700:	49 89 f5             	mov    %rsi,%r13
+  801703:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801707:	8b 45 10             	mov    0x10(%rbp),%eax
+  80170a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80170d:	41 89 cf             	mov    %ecx,%r15d
+  801710:	4c 39 fa             	cmp    %r15,%rdx
+  801713:	73 5b                	jae    801770 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801715:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801719:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80171d:	85 db                	test   %ebx,%ebx
+  80171f:	7e 0e                	jle    80172f <print_num+0x43>
+            putch(padc, put_arg);
+  801721:	4c 89 ee             	mov    %r13,%rsi
+  801724:	44 89 f7             	mov    %r14d,%edi
+  801727:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80172a:	83 eb 01             	sub    $0x1,%ebx
+  80172d:	75 f2                	jne    801721 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80172f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801733:	48 b9 6c 5c 80 00 00 	movabs $0x805c6c,%rcx
+  80173a:	00 00 00 
+  80173d:	48 b8 5b 5c 80 00 00 	movabs $0x805c5b,%rax
+  801744:	00 00 00 
+  801747:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80174b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801754:	49 f7 f7             	div    %r15
+  801757:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80175b:	4c 89 ee             	mov    %r13,%rsi
+  80175e:	41 ff d4             	call   *%r12
+}
+  801761:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801765:	5b                   	pop    %rbx
+  801766:	41 5c                	pop    %r12
+  801768:	41 5d                	pop    %r13
+  80176a:	41 5e                	pop    %r14
+  80176c:	41 5f                	pop    %r15
+  80176e:	5d                   	pop    %rbp
+  80176f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801770:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801774:	ba 00 00 00 00       	mov    $0x0,%edx
+  801779:	49 f7 f7             	div    %r15
+  80177c:	48 83 ec 08          	sub    $0x8,%rsp
+  801780:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801784:	52                   	push   %rdx
+  801785:	45 0f be c9          	movsbl %r9b,%r9d
+  801789:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80178d:	48 89 c2             	mov    %rax,%rdx
+  801790:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  801797:	00 00 00 
+  80179a:	ff d0                	call   *%rax
+  80179c:	48 83 c4 10          	add    $0x10,%rsp
+  8017a0:	eb 8d                	jmp    80172f <print_num+0x43>
+
+00000000008017a2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017a2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017a6:	48 8b 06             	mov    (%rsi),%rax
+  8017a9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017ad:	73 0a                	jae    8017b9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017af:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017b3:	48 89 16             	mov    %rdx,(%rsi)
+  8017b6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017b9:	c3                   	ret
+
+00000000008017ba <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017ba:	55                   	push   %rbp
+  8017bb:	48 89 e5             	mov    %rsp,%rbp
+  8017be:	48 83 ec 50          	sub    $0x50,%rsp
+  8017c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017ce:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017e5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017e9:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  8017f0:	00 00 00 
+  8017f3:	ff d0                	call   *%rax
+}
+  8017f5:	c9                   	leave
+  8017f6:	c3                   	ret
+
+00000000008017f7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017f7:	55                   	push   %rbp
+  8017f8:	48 89 e5             	mov    %rsp,%rbp
+  8017fb:	41 57                	push   %r15
+  8017fd:	41 56                	push   %r14
+  8017ff:	41 55                	push   %r13
+  801801:	41 54                	push   %r12
+  801803:	53                   	push   %rbx
+  801804:	48 83 ec 38          	sub    $0x38,%rsp
+  801808:	49 89 fe             	mov    %rdi,%r14
+  80180b:	49 89 f5             	mov    %rsi,%r13
+  80180e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801811:	48 8b 01             	mov    (%rcx),%rax
+  801814:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801818:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80181c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801820:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801824:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801828:	eb 0d                	jmp    801837 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  80182a:	40 0f b6 ff          	movzbl %dil,%edi
+  80182e:	4c 89 ee             	mov    %r13,%rsi
+  801831:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801834:	4c 89 e3             	mov    %r12,%rbx
+  801837:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80183b:	0f b6 3b             	movzbl (%rbx),%edi
+  80183e:	40 80 ff 25          	cmp    $0x25,%dil
+  801842:	74 14                	je     801858 <vprintfmt+0x61>
+            if (!ch) return;
+  801844:	40 84 ff             	test   %dil,%dil
+  801847:	75 e1                	jne    80182a <vprintfmt+0x33>
+}
+  801849:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80184d:	5b                   	pop    %rbx
+  80184e:	41 5c                	pop    %r12
+  801850:	41 5d                	pop    %r13
+  801852:	41 5e                	pop    %r14
+  801854:	41 5f                	pop    %r15
+  801856:	5d                   	pop    %rbp
+  801857:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801858:	be 00 00 00 00       	mov    $0x0,%esi
+  80185d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801861:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801866:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80186c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801873:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801877:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80187c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801881:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801884:	83 e8 23             	sub    $0x23,%eax
+  801887:	3c 57                	cmp    $0x57,%al
+  801889:	0f 87 67 06 00 00    	ja     801ef6 <vprintfmt+0x6ff>
+  80188f:	0f b6 c0             	movzbl %al,%eax
+  801892:	48 b9 00 5e 80 00 00 	movabs $0x805e00,%rcx
+  801899:	00 00 00 
+  80189c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80189f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018a2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018a6:	eb cf                	jmp    801877 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018a8:	49 89 dc             	mov    %rbx,%r12
+  8018ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8018b0:	eb c5                	jmp    801877 <vprintfmt+0x80>
+            padc = ch;
+  8018b2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018b6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018b9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018bc:	eb b9                	jmp    801877 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8018c4:	77 24                	ja     8018ea <vprintfmt+0xf3>
+  8018c6:	89 c1                	mov    %eax,%ecx
+  8018c8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018cc:	83 c0 08             	add    $0x8,%eax
+  8018cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018d2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018d5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018d8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018dc:	79 99                	jns    801877 <vprintfmt+0x80>
+                width = precision;
+  8018de:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018e2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018e8:	eb 8d                	jmp    801877 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018ea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018ee:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f6:	eb da                	jmp    8018d2 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018f8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018fd:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801901:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801907:	3c 39                	cmp    $0x39,%al
+  801909:	77 1c                	ja     801927 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  80190b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80190f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801913:	0f b6 c0             	movzbl %al,%eax
+  801916:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80191b:	0f b6 03             	movzbl (%rbx),%eax
+  80191e:	3c 39                	cmp    $0x39,%al
+  801920:	76 e9                	jbe    80190b <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801922:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801925:	eb b1                	jmp    8018d8 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801927:	49 89 dc             	mov    %rbx,%r12
+  80192a:	eb ac                	jmp    8018d8 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80192c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80192f:	85 c9                	test   %ecx,%ecx
+  801931:	b8 00 00 00 00       	mov    $0x0,%eax
+  801936:	0f 49 c1             	cmovns %ecx,%eax
+  801939:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80193c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80193f:	e9 33 ff ff ff       	jmp    801877 <vprintfmt+0x80>
+            lflag++;
+  801944:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801947:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80194a:	e9 28 ff ff ff       	jmp    801877 <vprintfmt+0x80>
+            lflag--;
+  80194f:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801952:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801955:	e9 1d ff ff ff       	jmp    801877 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  80195a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80195d:	83 f8 2f             	cmp    $0x2f,%eax
+  801960:	77 19                	ja     80197b <vprintfmt+0x184>
+  801962:	89 c2                	mov    %eax,%edx
+  801964:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801968:	83 c0 08             	add    $0x8,%eax
+  80196b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80196e:	8b 3a                	mov    (%rdx),%edi
+  801970:	4c 89 ee             	mov    %r13,%rsi
+  801973:	41 ff d6             	call   *%r14
+            break;
+  801976:	e9 bc fe ff ff       	jmp    801837 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80197b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80197f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801983:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801987:	eb e5                	jmp    80196e <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801989:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80198c:	83 f8 2f             	cmp    $0x2f,%eax
+  80198f:	77 5a                	ja     8019eb <vprintfmt+0x1f4>
+  801991:	89 c2                	mov    %eax,%edx
+  801993:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801997:	83 c0 08             	add    $0x8,%eax
+  80199a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80199d:	8b 02                	mov    (%rdx),%eax
+  80199f:	89 c1                	mov    %eax,%ecx
+  8019a1:	f7 d9                	neg    %ecx
+  8019a3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019a6:	83 f9 13             	cmp    $0x13,%ecx
+  8019a9:	7f 4e                	jg     8019f9 <vprintfmt+0x202>
+  8019ab:	48 63 c1             	movslq %ecx,%rax
+  8019ae:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8019b5:	00 00 00 
+  8019b8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019bc:	48 85 c0             	test   %rax,%rax
+  8019bf:	74 38                	je     8019f9 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019c1:	48 89 c1             	mov    %rax,%rcx
+  8019c4:	48 ba 88 62 80 00 00 	movabs $0x806288,%rdx
+  8019cb:	00 00 00 
+  8019ce:	4c 89 ee             	mov    %r13,%rsi
+  8019d1:	4c 89 f7             	mov    %r14,%rdi
+  8019d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d9:	49 b8 ba 17 80 00 00 	movabs $0x8017ba,%r8
+  8019e0:	00 00 00 
+  8019e3:	41 ff d0             	call   *%r8
+  8019e6:	e9 4c fe ff ff       	jmp    801837 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019f7:	eb a4                	jmp    80199d <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019f9:	48 ba 84 5c 80 00 00 	movabs $0x805c84,%rdx
+  801a00:	00 00 00 
+  801a03:	4c 89 ee             	mov    %r13,%rsi
+  801a06:	4c 89 f7             	mov    %r14,%rdi
+  801a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0e:	49 b8 ba 17 80 00 00 	movabs $0x8017ba,%r8
+  801a15:	00 00 00 
+  801a18:	41 ff d0             	call   *%r8
+  801a1b:	e9 17 fe ff ff       	jmp    801837 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a23:	83 f8 2f             	cmp    $0x2f,%eax
+  801a26:	77 6c                	ja     801a94 <vprintfmt+0x29d>
+  801a28:	89 c2                	mov    %eax,%edx
+  801a2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a2e:	83 c0 08             	add    $0x8,%eax
+  801a31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a34:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a37:	48 85 f6             	test   %rsi,%rsi
+  801a3a:	48 b8 7d 5c 80 00 00 	movabs $0x805c7d,%rax
+  801a41:	00 00 00 
+  801a44:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a48:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a4c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a50:	7e 06                	jle    801a58 <vprintfmt+0x261>
+  801a52:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a56:	75 4a                	jne    801aa2 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a58:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a5c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a60:	0f b6 00             	movzbl (%rax),%eax
+  801a63:	84 c0                	test   %al,%al
+  801a65:	0f 85 9a 00 00 00    	jne    801b05 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a6b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a6e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a72:	85 c0                	test   %eax,%eax
+  801a74:	0f 8e bd fd ff ff    	jle    801837 <vprintfmt+0x40>
+  801a7a:	4c 89 ee             	mov    %r13,%rsi
+  801a7d:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a82:	41 ff d6             	call   *%r14
+  801a85:	41 83 ec 01          	sub    $0x1,%r12d
+  801a89:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a8d:	75 eb                	jne    801a7a <vprintfmt+0x283>
+  801a8f:	e9 a3 fd ff ff       	jmp    801837 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aa0:	eb 92                	jmp    801a34 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801aa2:	49 63 f7             	movslq %r15d,%rsi
+  801aa5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801aa9:	48 b8 bb 1f 80 00 00 	movabs $0x801fbb,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+  801ab5:	48 89 c2             	mov    %rax,%rdx
+  801ab8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801abb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801abd:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ac0:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ac3:	85 c0                	test   %eax,%eax
+  801ac5:	7e 91                	jle    801a58 <vprintfmt+0x261>
+  801ac7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801acc:	4c 89 ee             	mov    %r13,%rsi
+  801acf:	44 89 e7             	mov    %r12d,%edi
+  801ad2:	41 ff d6             	call   *%r14
+  801ad5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801adc:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801adf:	75 eb                	jne    801acc <vprintfmt+0x2d5>
+  801ae1:	e9 72 ff ff ff       	jmp    801a58 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ae6:	0f b6 f8             	movzbl %al,%edi
+  801ae9:	4c 89 ee             	mov    %r13,%rsi
+  801aec:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801aef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801af3:	49 83 c4 01          	add    $0x1,%r12
+  801af7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801afd:	84 c0                	test   %al,%al
+  801aff:	0f 84 66 ff ff ff    	je     801a6b <vprintfmt+0x274>
+  801b05:	45 85 ff             	test   %r15d,%r15d
+  801b08:	78 0a                	js     801b14 <vprintfmt+0x31d>
+  801b0a:	41 83 ef 01          	sub    $0x1,%r15d
+  801b0e:	0f 88 57 ff ff ff    	js     801a6b <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b14:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b18:	74 cc                	je     801ae6 <vprintfmt+0x2ef>
+  801b1a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b1d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b22:	80 fa 5e             	cmp    $0x5e,%dl
+  801b25:	77 c2                	ja     801ae9 <vprintfmt+0x2f2>
+  801b27:	eb bd                	jmp    801ae6 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b29:	40 84 f6             	test   %sil,%sil
+  801b2c:	75 26                	jne    801b54 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b2e:	85 d2                	test   %edx,%edx
+  801b30:	74 59                	je     801b8b <vprintfmt+0x394>
+  801b32:	83 fa 01             	cmp    $0x1,%edx
+  801b35:	74 7b                	je     801bb2 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b3a:	83 f8 2f             	cmp    $0x2f,%eax
+  801b3d:	0f 87 96 00 00 00    	ja     801bd9 <vprintfmt+0x3e2>
+  801b43:	89 c2                	mov    %eax,%edx
+  801b45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b49:	83 c0 08             	add    $0x8,%eax
+  801b4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b4f:	4c 8b 22             	mov    (%rdx),%r12
+  801b52:	eb 17                	jmp    801b6b <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b57:	83 f8 2f             	cmp    $0x2f,%eax
+  801b5a:	77 21                	ja     801b7d <vprintfmt+0x386>
+  801b5c:	89 c2                	mov    %eax,%edx
+  801b5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b62:	83 c0 08             	add    $0x8,%eax
+  801b65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b68:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b6b:	4d 85 e4             	test   %r12,%r12
+  801b6e:	78 7a                	js     801bea <vprintfmt+0x3f3>
+            num = i;
+  801b70:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b73:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b78:	e9 56 02 00 00       	jmp    801dd3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b89:	eb dd                	jmp    801b68 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b91:	77 11                	ja     801ba4 <vprintfmt+0x3ad>
+  801b93:	89 c2                	mov    %eax,%edx
+  801b95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b99:	83 c0 08             	add    $0x8,%eax
+  801b9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b9f:	4c 63 22             	movslq (%rdx),%r12
+  801ba2:	eb c7                	jmp    801b6b <vprintfmt+0x374>
+  801ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bb0:	eb ed                	jmp    801b9f <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bb5:	83 f8 2f             	cmp    $0x2f,%eax
+  801bb8:	77 11                	ja     801bcb <vprintfmt+0x3d4>
+  801bba:	89 c2                	mov    %eax,%edx
+  801bbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bc0:	83 c0 08             	add    $0x8,%eax
+  801bc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bc6:	4c 8b 22             	mov    (%rdx),%r12
+  801bc9:	eb a0                	jmp    801b6b <vprintfmt+0x374>
+  801bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd7:	eb ed                	jmp    801bc6 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be5:	e9 65 ff ff ff       	jmp    801b4f <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bea:	4c 89 ee             	mov    %r13,%rsi
+  801bed:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bf2:	41 ff d6             	call   *%r14
+                i = -i;
+  801bf5:	49 f7 dc             	neg    %r12
+  801bf8:	e9 73 ff ff ff       	jmp    801b70 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bfd:	40 84 f6             	test   %sil,%sil
+  801c00:	75 2e                	jne    801c30 <vprintfmt+0x439>
+    switch (lflag) {
+  801c02:	85 d2                	test   %edx,%edx
+  801c04:	7f 59                	jg     801c5f <vprintfmt+0x468>
+  801c06:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c09:	7d 7a                	jge    801c85 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c0e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c11:	0f 87 aa 00 00 00    	ja     801cc1 <vprintfmt+0x4ca>
+  801c17:	89 c2                	mov    %eax,%edx
+  801c19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c1d:	83 c0 08             	add    $0x8,%eax
+  801c20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c23:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c2b:	e9 a3 01 00 00       	jmp    801dd3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c33:	83 f8 2f             	cmp    $0x2f,%eax
+  801c36:	77 19                	ja     801c51 <vprintfmt+0x45a>
+  801c38:	89 c2                	mov    %eax,%edx
+  801c3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c3e:	83 c0 08             	add    $0x8,%eax
+  801c41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c44:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c47:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c4c:	e9 82 01 00 00       	jmp    801dd3 <vprintfmt+0x5dc>
+  801c51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c5d:	eb e5                	jmp    801c44 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c5f:	83 fa 01             	cmp    $0x1,%edx
+  801c62:	75 a7                	jne    801c0b <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c67:	83 f8 2f             	cmp    $0x2f,%eax
+  801c6a:	77 47                	ja     801cb3 <vprintfmt+0x4bc>
+  801c6c:	89 c2                	mov    %eax,%edx
+  801c6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c72:	83 c0 08             	add    $0x8,%eax
+  801c75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c78:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c7b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c80:	e9 4e 01 00 00       	jmp    801dd3 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c88:	83 f8 2f             	cmp    $0x2f,%eax
+  801c8b:	77 18                	ja     801ca5 <vprintfmt+0x4ae>
+  801c8d:	89 c2                	mov    %eax,%edx
+  801c8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c93:	83 c0 08             	add    $0x8,%eax
+  801c96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c99:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c9b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801ca0:	e9 2e 01 00 00       	jmp    801dd3 <vprintfmt+0x5dc>
+  801ca5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb1:	eb e6                	jmp    801c99 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbf:	eb b7                	jmp    801c78 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ccd:	e9 51 ff ff ff       	jmp    801c23 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cd2:	40 84 f6             	test   %sil,%sil
+  801cd5:	75 2e                	jne    801d05 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cd7:	85 d2                	test   %edx,%edx
+  801cd9:	7f 59                	jg     801d34 <vprintfmt+0x53d>
+  801cdb:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cde:	7d 77                	jge    801d57 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ce0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ce3:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce6:	0f 87 a4 00 00 00    	ja     801d90 <vprintfmt+0x599>
+  801cec:	89 c2                	mov    %eax,%edx
+  801cee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf2:	83 c0 08             	add    $0x8,%eax
+  801cf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cfb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d00:	e9 ce 00 00 00       	jmp    801dd3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d08:	83 f8 2f             	cmp    $0x2f,%eax
+  801d0b:	77 19                	ja     801d26 <vprintfmt+0x52f>
+  801d0d:	89 c2                	mov    %eax,%edx
+  801d0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d13:	83 c0 08             	add    $0x8,%eax
+  801d16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d19:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d1c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d21:	e9 ad 00 00 00       	jmp    801dd3 <vprintfmt+0x5dc>
+  801d26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d32:	eb e5                	jmp    801d19 <vprintfmt+0x522>
+    switch (lflag) {
+  801d34:	83 fa 01             	cmp    $0x1,%edx
+  801d37:	75 a7                	jne    801ce0 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d3c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3f:	77 41                	ja     801d82 <vprintfmt+0x58b>
+  801d41:	89 c2                	mov    %eax,%edx
+  801d43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d47:	83 c0 08             	add    $0x8,%eax
+  801d4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d50:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d55:	eb 7c                	jmp    801dd3 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d5a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5d:	77 15                	ja     801d74 <vprintfmt+0x57d>
+  801d5f:	89 c2                	mov    %eax,%edx
+  801d61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d65:	83 c0 08             	add    $0x8,%eax
+  801d68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d6b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d6d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d72:	eb 5f                	jmp    801dd3 <vprintfmt+0x5dc>
+  801d74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d80:	eb e9                	jmp    801d6b <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8e:	eb bd                	jmp    801d4d <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9c:	e9 57 ff ff ff       	jmp    801cf8 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801da1:	4c 89 ee             	mov    %r13,%rsi
+  801da4:	bf 30 00 00 00       	mov    $0x30,%edi
+  801da9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801dac:	4c 89 ee             	mov    %r13,%rsi
+  801daf:	bf 78 00 00 00       	mov    $0x78,%edi
+  801db4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801db7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dba:	83 f8 2f             	cmp    $0x2f,%eax
+  801dbd:	77 47                	ja     801e06 <vprintfmt+0x60f>
+  801dbf:	89 c2                	mov    %eax,%edx
+  801dc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc5:	83 c0 08             	add    $0x8,%eax
+  801dc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dcb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dce:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dd3:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801ddb:	0f 94 c0             	sete   %al
+  801dde:	0f b6 c0             	movzbl %al,%eax
+  801de1:	50                   	push   %rax
+  801de2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801de7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801deb:	4c 89 ee             	mov    %r13,%rsi
+  801dee:	4c 89 f7             	mov    %r14,%rdi
+  801df1:	48 b8 ec 16 80 00 00 	movabs $0x8016ec,%rax
+  801df8:	00 00 00 
+  801dfb:	ff d0                	call   *%rax
+            break;
+  801dfd:	48 83 c4 10          	add    $0x10,%rsp
+  801e01:	e9 31 fa ff ff       	jmp    801837 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e12:	eb b7                	jmp    801dcb <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e14:	40 84 f6             	test   %sil,%sil
+  801e17:	75 2b                	jne    801e44 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e19:	85 d2                	test   %edx,%edx
+  801e1b:	7f 56                	jg     801e73 <vprintfmt+0x67c>
+  801e1d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e20:	7d 77                	jge    801e99 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e25:	83 f8 2f             	cmp    $0x2f,%eax
+  801e28:	0f 87 a7 00 00 00    	ja     801ed5 <vprintfmt+0x6de>
+  801e2e:	89 c2                	mov    %eax,%edx
+  801e30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e34:	83 c0 08             	add    $0x8,%eax
+  801e37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e3a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e3d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e42:	eb 8f                	jmp    801dd3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e47:	83 f8 2f             	cmp    $0x2f,%eax
+  801e4a:	77 19                	ja     801e65 <vprintfmt+0x66e>
+  801e4c:	89 c2                	mov    %eax,%edx
+  801e4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e52:	83 c0 08             	add    $0x8,%eax
+  801e55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e5b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e60:	e9 6e ff ff ff       	jmp    801dd3 <vprintfmt+0x5dc>
+  801e65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e71:	eb e5                	jmp    801e58 <vprintfmt+0x661>
+    switch (lflag) {
+  801e73:	83 fa 01             	cmp    $0x1,%edx
+  801e76:	75 aa                	jne    801e22 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7e:	77 47                	ja     801ec7 <vprintfmt+0x6d0>
+  801e80:	89 c2                	mov    %eax,%edx
+  801e82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e86:	83 c0 08             	add    $0x8,%eax
+  801e89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e94:	e9 3a ff ff ff       	jmp    801dd3 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9c:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9f:	77 18                	ja     801eb9 <vprintfmt+0x6c2>
+  801ea1:	89 c2                	mov    %eax,%edx
+  801ea3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea7:	83 c0 08             	add    $0x8,%eax
+  801eaa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ead:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801eaf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801eb4:	e9 1a ff ff ff       	jmp    801dd3 <vprintfmt+0x5dc>
+  801eb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ebd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec5:	eb e6                	jmp    801ead <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ec7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ecb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ecf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed3:	eb b7                	jmp    801e8c <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ed5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801edd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee1:	e9 54 ff ff ff       	jmp    801e3a <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ee6:	4c 89 ee             	mov    %r13,%rsi
+  801ee9:	bf 25 00 00 00       	mov    $0x25,%edi
+  801eee:	41 ff d6             	call   *%r14
+            break;
+  801ef1:	e9 41 f9 ff ff       	jmp    801837 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ef6:	4c 89 ee             	mov    %r13,%rsi
+  801ef9:	bf 25 00 00 00       	mov    $0x25,%edi
+  801efe:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f01:	48 83 eb 01          	sub    $0x1,%rbx
+  801f05:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f09:	75 f6                	jne    801f01 <vprintfmt+0x70a>
+  801f0b:	e9 27 f9 ff ff       	jmp    801837 <vprintfmt+0x40>
+
+0000000000801f10 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f10:	55                   	push   %rbp
+  801f11:	48 89 e5             	mov    %rsp,%rbp
+  801f14:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f1c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f21:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f25:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f2c:	48 85 ff             	test   %rdi,%rdi
+  801f2f:	74 2b                	je     801f5c <vsnprintf+0x4c>
+  801f31:	48 85 f6             	test   %rsi,%rsi
+  801f34:	74 26                	je     801f5c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f36:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f3a:	48 bf a2 17 80 00 00 	movabs $0x8017a2,%rdi
+  801f41:	00 00 00 
+  801f44:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f54:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f57:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f61:	eb f7                	jmp    801f5a <vsnprintf+0x4a>
+
+0000000000801f63 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f63:	55                   	push   %rbp
+  801f64:	48 89 e5             	mov    %rsp,%rbp
+  801f67:	48 83 ec 50          	sub    $0x50,%rsp
+  801f6b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f6f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f73:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f77:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f7e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f86:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f8e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f92:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  801f99:	00 00 00 
+  801f9c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f9e:	c9                   	leave
+  801f9f:	c3                   	ret
+
+0000000000801fa0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801fa0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fa3:	74 10                	je     801fb5 <strlen+0x15>
+    size_t n = 0;
+  801fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801faa:	48 83 c0 01          	add    $0x1,%rax
+  801fae:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fb2:	75 f6                	jne    801faa <strlen+0xa>
+  801fb4:	c3                   	ret
+    size_t n = 0;
+  801fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fba:	c3                   	ret
+
+0000000000801fbb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fbb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fbe:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fc3:	48 85 f6             	test   %rsi,%rsi
+  801fc6:	74 11                	je     801fd9 <strnlen+0x1e>
+  801fc8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fcc:	74 0c                	je     801fda <strnlen+0x1f>
+  801fce:	48 83 c2 01          	add    $0x1,%rdx
+  801fd2:	48 39 d0             	cmp    %rdx,%rax
+  801fd5:	75 f1                	jne    801fc8 <strnlen+0xd>
+  801fd7:	eb 04                	jmp    801fdd <strnlen+0x22>
+  801fd9:	c3                   	ret
+  801fda:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fdd:	c3                   	ret
+
+0000000000801fde <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fde:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fea:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fed:	48 83 c2 01          	add    $0x1,%rdx
+  801ff1:	84 c9                	test   %cl,%cl
+  801ff3:	75 f1                	jne    801fe6 <strcpy+0x8>
+        ;
+    return res;
+}
+  801ff5:	c3                   	ret
+
+0000000000801ff6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801ff6:	55                   	push   %rbp
+  801ff7:	48 89 e5             	mov    %rsp,%rbp
+  801ffa:	41 54                	push   %r12
+  801ffc:	53                   	push   %rbx
+  801ffd:	48 89 fb             	mov    %rdi,%rbx
+  802000:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802003:	48 b8 a0 1f 80 00 00 	movabs $0x801fa0,%rax
+  80200a:	00 00 00 
+  80200d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80200f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802013:	4c 89 e6             	mov    %r12,%rsi
+  802016:	48 b8 de 1f 80 00 00 	movabs $0x801fde,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+    return dst;
+}
+  802022:	48 89 d8             	mov    %rbx,%rax
+  802025:	5b                   	pop    %rbx
+  802026:	41 5c                	pop    %r12
+  802028:	5d                   	pop    %rbp
+  802029:	c3                   	ret
+
+000000000080202a <toupper>:
+
+int
+toupper(int ch) {
+  80202a:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80202c:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80202f:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802032:	83 f9 1a             	cmp    $0x1a,%ecx
+  802035:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802038:	c3                   	ret
+
+0000000000802039 <tolower>:
+
+int
+tolower(int ch) {
+  802039:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80203b:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80203e:	8d 57 20             	lea    0x20(%rdi),%edx
+  802041:	83 f9 1a             	cmp    $0x1a,%ecx
+  802044:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802047:	c3                   	ret
+
+0000000000802048 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802048:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80204b:	48 85 d2             	test   %rdx,%rdx
+  80204e:	74 1f                	je     80206f <strncpy+0x27>
+  802050:	48 01 fa             	add    %rdi,%rdx
+  802053:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802056:	48 83 c1 01          	add    $0x1,%rcx
+  80205a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80205e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802062:	41 80 f8 01          	cmp    $0x1,%r8b
+  802066:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80206a:	48 39 ca             	cmp    %rcx,%rdx
+  80206d:	75 e7                	jne    802056 <strncpy+0xe>
+    }
+    return ret;
+}
+  80206f:	c3                   	ret
+
+0000000000802070 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802070:	48 89 f8             	mov    %rdi,%rax
+  802073:	48 85 d2             	test   %rdx,%rdx
+  802076:	74 24                	je     80209c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802078:	48 83 ea 01          	sub    $0x1,%rdx
+  80207c:	74 1b                	je     802099 <strlcpy+0x29>
+  80207e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802082:	0f b6 16             	movzbl (%rsi),%edx
+  802085:	84 d2                	test   %dl,%dl
+  802087:	74 10                	je     802099 <strlcpy+0x29>
+            *dst++ = *src++;
+  802089:	48 83 c6 01          	add    $0x1,%rsi
+  80208d:	48 83 c0 01          	add    $0x1,%rax
+  802091:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802094:	48 39 c8             	cmp    %rcx,%rax
+  802097:	75 e9                	jne    802082 <strlcpy+0x12>
+        *dst = '\0';
+  802099:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80209c:	48 29 f8             	sub    %rdi,%rax
+}
+  80209f:	c3                   	ret
+
+00000000008020a0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8020a0:	0f b6 07             	movzbl (%rdi),%eax
+  8020a3:	84 c0                	test   %al,%al
+  8020a5:	74 13                	je     8020ba <strcmp+0x1a>
+  8020a7:	38 06                	cmp    %al,(%rsi)
+  8020a9:	75 0f                	jne    8020ba <strcmp+0x1a>
+  8020ab:	48 83 c7 01          	add    $0x1,%rdi
+  8020af:	48 83 c6 01          	add    $0x1,%rsi
+  8020b3:	0f b6 07             	movzbl (%rdi),%eax
+  8020b6:	84 c0                	test   %al,%al
+  8020b8:	75 ed                	jne    8020a7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020ba:	0f b6 c0             	movzbl %al,%eax
+  8020bd:	0f b6 16             	movzbl (%rsi),%edx
+  8020c0:	29 d0                	sub    %edx,%eax
+}
+  8020c2:	c3                   	ret
+
+00000000008020c3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020c3:	48 85 d2             	test   %rdx,%rdx
+  8020c6:	74 1f                	je     8020e7 <strncmp+0x24>
+  8020c8:	0f b6 07             	movzbl (%rdi),%eax
+  8020cb:	84 c0                	test   %al,%al
+  8020cd:	74 1e                	je     8020ed <strncmp+0x2a>
+  8020cf:	3a 06                	cmp    (%rsi),%al
+  8020d1:	75 1a                	jne    8020ed <strncmp+0x2a>
+  8020d3:	48 83 c7 01          	add    $0x1,%rdi
+  8020d7:	48 83 c6 01          	add    $0x1,%rsi
+  8020db:	48 83 ea 01          	sub    $0x1,%rdx
+  8020df:	75 e7                	jne    8020c8 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e6:	c3                   	ret
+  8020e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ec:	c3                   	ret
+  8020ed:	48 85 d2             	test   %rdx,%rdx
+  8020f0:	74 09                	je     8020fb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020f2:	0f b6 07             	movzbl (%rdi),%eax
+  8020f5:	0f b6 16             	movzbl (%rsi),%edx
+  8020f8:	29 d0                	sub    %edx,%eax
+  8020fa:	c3                   	ret
+    if (!n) return 0;
+  8020fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802100:	c3                   	ret
+
+0000000000802101 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802101:	0f b6 17             	movzbl (%rdi),%edx
+  802104:	84 d2                	test   %dl,%dl
+  802106:	74 18                	je     802120 <strchr+0x1f>
+        if (*str == c) {
+  802108:	0f be d2             	movsbl %dl,%edx
+  80210b:	39 f2                	cmp    %esi,%edx
+  80210d:	74 17                	je     802126 <strchr+0x25>
+    for (; *str; str++) {
+  80210f:	48 83 c7 01          	add    $0x1,%rdi
+  802113:	0f b6 17             	movzbl (%rdi),%edx
+  802116:	84 d2                	test   %dl,%dl
+  802118:	75 ee                	jne    802108 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80211a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211f:	c3                   	ret
+  802120:	b8 00 00 00 00       	mov    $0x0,%eax
+  802125:	c3                   	ret
+  802126:	48 89 f8             	mov    %rdi,%rax
+}
+  802129:	c3                   	ret
+
+000000000080212a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80212a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80212d:	0f b6 17             	movzbl (%rdi),%edx
+  802130:	84 d2                	test   %dl,%dl
+  802132:	74 13                	je     802147 <strfind+0x1d>
+  802134:	0f be d2             	movsbl %dl,%edx
+  802137:	39 f2                	cmp    %esi,%edx
+  802139:	74 0b                	je     802146 <strfind+0x1c>
+  80213b:	48 83 c0 01          	add    $0x1,%rax
+  80213f:	0f b6 10             	movzbl (%rax),%edx
+  802142:	84 d2                	test   %dl,%dl
+  802144:	75 ee                	jne    802134 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802146:	c3                   	ret
+  802147:	c3                   	ret
+
+0000000000802148 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802148:	48 39 f7             	cmp    %rsi,%rdi
+  80214b:	74 65                	je     8021b2 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80214d:	55                   	push   %rbp
+  80214e:	48 89 e5             	mov    %rsp,%rbp
+  802151:	41 57                	push   %r15
+  802153:	41 56                	push   %r14
+  802155:	41 55                	push   %r13
+  802157:	41 54                	push   %r12
+  802159:	53                   	push   %rbx
+  80215a:	48 83 ec 18          	sub    $0x18,%rsp
+  80215e:	48 89 fb             	mov    %rdi,%rbx
+  802161:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802164:	49 bf 39 20 80 00 00 	movabs $0x802039,%r15
+  80216b:	00 00 00 
+  80216e:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802172:	41 0f b6 fd          	movzbl %r13b,%edi
+  802176:	41 ff d7             	call   *%r15
+  802179:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80217c:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802181:	41 0f b6 fe          	movzbl %r14b,%edi
+  802185:	41 ff d7             	call   *%r15
+  802188:	89 c2                	mov    %eax,%edx
+  80218a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80218d:	29 d0                	sub    %edx,%eax
+  80218f:	75 12                	jne    8021a3 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802191:	48 83 c3 01          	add    $0x1,%rbx
+  802195:	45 84 ed             	test   %r13b,%r13b
+  802198:	74 09                	je     8021a3 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80219a:	49 83 c4 01          	add    $0x1,%r12
+  80219e:	45 84 f6             	test   %r14b,%r14b
+  8021a1:	75 cb                	jne    80216e <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021a3:	48 83 c4 18          	add    $0x18,%rsp
+  8021a7:	5b                   	pop    %rbx
+  8021a8:	41 5c                	pop    %r12
+  8021aa:	41 5d                	pop    %r13
+  8021ac:	41 5e                	pop    %r14
+  8021ae:	41 5f                	pop    %r15
+  8021b0:	5d                   	pop    %rbp
+  8021b1:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b7:	c3                   	ret
+
+00000000008021b8 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021b8:	48 39 f7             	cmp    %rsi,%rdi
+  8021bb:	74 7d                	je     80223a <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	41 57                	push   %r15
+  8021c3:	41 56                	push   %r14
+  8021c5:	41 55                	push   %r13
+  8021c7:	41 54                	push   %r12
+  8021c9:	53                   	push   %rbx
+  8021ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ce:	48 89 fb             	mov    %rdi,%rbx
+  8021d1:	49 89 f4             	mov    %rsi,%r12
+  8021d4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021dc:	49 bf 39 20 80 00 00 	movabs $0x802039,%r15
+  8021e3:	00 00 00 
+    while (n--) {
+  8021e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021ea:	48 39 c3             	cmp    %rax,%rbx
+  8021ed:	74 37                	je     802226 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021ef:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021f3:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021f7:	41 ff d7             	call   *%r15
+  8021fa:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021fd:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802202:	41 0f b6 fe          	movzbl %r14b,%edi
+  802206:	41 ff d7             	call   *%r15
+  802209:	89 c2                	mov    %eax,%edx
+  80220b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80220e:	29 d0                	sub    %edx,%eax
+  802210:	75 19                	jne    80222b <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802212:	48 83 c3 01          	add    $0x1,%rbx
+  802216:	45 84 ed             	test   %r13b,%r13b
+  802219:	74 10                	je     80222b <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80221b:	49 83 c4 01          	add    $0x1,%r12
+  80221f:	45 84 f6             	test   %r14b,%r14b
+  802222:	75 c2                	jne    8021e6 <strncasecmp+0x2e>
+  802224:	eb 05                	jmp    80222b <strncasecmp+0x73>
+  802226:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80222b:	48 83 c4 18          	add    $0x18,%rsp
+  80222f:	5b                   	pop    %rbx
+  802230:	41 5c                	pop    %r12
+  802232:	41 5d                	pop    %r13
+  802234:	41 5e                	pop    %r14
+  802236:	41 5f                	pop    %r15
+  802238:	5d                   	pop    %rbp
+  802239:	c3                   	ret
+    if (p1 == p2) return 0;
+  80223a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223f:	c3                   	ret
+
+0000000000802240 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802240:	83 e7 df             	and    $0xffffffdf,%edi
+  802243:	83 ef 41             	sub    $0x41,%edi
+  802246:	83 ff 19             	cmp    $0x19,%edi
+  802249:	0f 96 c0             	setbe  %al
+}
+  80224c:	c3                   	ret
+
+000000000080224d <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80224d:	83 ff 20             	cmp    $0x20,%edi
+  802250:	0f 94 c0             	sete   %al
+  802253:	83 ff 09             	cmp    $0x9,%edi
+  802256:	0f 94 c2             	sete   %dl
+  802259:	09 d0                	or     %edx,%eax
+}
+  80225b:	c3                   	ret
+
+000000000080225c <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80225c:	55                   	push   %rbp
+  80225d:	48 89 e5             	mov    %rsp,%rbp
+  802260:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802262:	48 bf 7f 61 80 00 00 	movabs $0x80617f,%rdi
+  802269:	00 00 00 
+  80226c:	48 b8 01 21 80 00 00 	movabs $0x802101,%rax
+  802273:	00 00 00 
+  802276:	ff d0                	call   *%rax
+  802278:	48 85 c0             	test   %rax,%rax
+  80227b:	0f 95 c0             	setne  %al
+}
+  80227e:	5d                   	pop    %rbp
+  80227f:	c3                   	ret
+
+0000000000802280 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802280:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802283:	48 89 f8             	mov    %rdi,%rax
+  802286:	48 f7 d8             	neg    %rax
+  802289:	83 e0 07             	and    $0x7,%eax
+  80228c:	49 89 d1             	mov    %rdx,%r9
+  80228f:	49 29 c1             	sub    %rax,%r9
+  802292:	78 36                	js     8022ca <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802294:	40 0f b6 c6          	movzbl %sil,%eax
+  802298:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80229f:	01 01 01 
+  8022a2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022a6:	40 f6 c7 07          	test   $0x7,%dil
+  8022aa:	75 38                	jne    8022e4 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022ac:	4c 89 c9             	mov    %r9,%rcx
+  8022af:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022b3:	74 0c                	je     8022c1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022b5:	fc                   	cld
+  8022b6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022b9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022bd:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022c1:	4d 85 c9             	test   %r9,%r9
+  8022c4:	75 45                	jne    80230b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022c6:	4c 89 c0             	mov    %r8,%rax
+  8022c9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022ca:	48 85 d2             	test   %rdx,%rdx
+  8022cd:	74 f7                	je     8022c6 <memset+0x46>
+  8022cf:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022d2:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022d5:	48 83 c0 01          	add    $0x1,%rax
+  8022d9:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022dd:	48 39 c2             	cmp    %rax,%rdx
+  8022e0:	75 f3                	jne    8022d5 <memset+0x55>
+  8022e2:	eb e2                	jmp    8022c6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022e4:	40 f6 c7 01          	test   $0x1,%dil
+  8022e8:	74 06                	je     8022f0 <memset+0x70>
+  8022ea:	88 07                	mov    %al,(%rdi)
+  8022ec:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022f0:	40 f6 c7 02          	test   $0x2,%dil
+  8022f4:	74 07                	je     8022fd <memset+0x7d>
+  8022f6:	66 89 07             	mov    %ax,(%rdi)
+  8022f9:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022fd:	40 f6 c7 04          	test   $0x4,%dil
+  802301:	74 a9                	je     8022ac <memset+0x2c>
+  802303:	89 07                	mov    %eax,(%rdi)
+  802305:	48 83 c7 04          	add    $0x4,%rdi
+  802309:	eb a1                	jmp    8022ac <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80230b:	41 f6 c1 04          	test   $0x4,%r9b
+  80230f:	74 06                	je     802317 <memset+0x97>
+  802311:	89 07                	mov    %eax,(%rdi)
+  802313:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802317:	41 f6 c1 02          	test   $0x2,%r9b
+  80231b:	74 07                	je     802324 <memset+0xa4>
+  80231d:	66 89 07             	mov    %ax,(%rdi)
+  802320:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802324:	41 f6 c1 01          	test   $0x1,%r9b
+  802328:	74 9c                	je     8022c6 <memset+0x46>
+  80232a:	88 07                	mov    %al,(%rdi)
+  80232c:	eb 98                	jmp    8022c6 <memset+0x46>
+
+000000000080232e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80232e:	48 89 f8             	mov    %rdi,%rax
+  802331:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802334:	48 39 fe             	cmp    %rdi,%rsi
+  802337:	73 3b                	jae    802374 <memmove+0x46>
+  802339:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80233d:	48 39 d7             	cmp    %rdx,%rdi
+  802340:	73 32                	jae    802374 <memmove+0x46>
+        s += n;
+        d += n;
+  802342:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802346:	48 89 d6             	mov    %rdx,%rsi
+  802349:	48 09 fe             	or     %rdi,%rsi
+  80234c:	48 09 ce             	or     %rcx,%rsi
+  80234f:	40 f6 c6 07          	test   $0x7,%sil
+  802353:	75 12                	jne    802367 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802355:	48 83 ef 08          	sub    $0x8,%rdi
+  802359:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80235d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802361:	fd                   	std
+  802362:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802365:	fc                   	cld
+  802366:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802367:	48 83 ef 01          	sub    $0x1,%rdi
+  80236b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80236f:	fd                   	std
+  802370:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802372:	eb f1                	jmp    802365 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802374:	48 89 f2             	mov    %rsi,%rdx
+  802377:	48 09 c2             	or     %rax,%rdx
+  80237a:	48 09 ca             	or     %rcx,%rdx
+  80237d:	f6 c2 07             	test   $0x7,%dl
+  802380:	75 0c                	jne    80238e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802382:	48 c1 e9 03          	shr    $0x3,%rcx
+  802386:	48 89 c7             	mov    %rax,%rdi
+  802389:	fc                   	cld
+  80238a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80238d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80238e:	48 89 c7             	mov    %rax,%rdi
+  802391:	fc                   	cld
+  802392:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802394:	c3                   	ret
+
+0000000000802395 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802395:	55                   	push   %rbp
+  802396:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802399:	48 b8 2e 23 80 00 00 	movabs $0x80232e,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+}
+  8023a5:	5d                   	pop    %rbp
+  8023a6:	c3                   	ret
+
+00000000008023a7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023a7:	55                   	push   %rbp
+  8023a8:	48 89 e5             	mov    %rsp,%rbp
+  8023ab:	41 57                	push   %r15
+  8023ad:	41 56                	push   %r14
+  8023af:	41 55                	push   %r13
+  8023b1:	41 54                	push   %r12
+  8023b3:	53                   	push   %rbx
+  8023b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b8:	49 89 fe             	mov    %rdi,%r14
+  8023bb:	49 89 f7             	mov    %rsi,%r15
+  8023be:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023c1:	48 89 f7             	mov    %rsi,%rdi
+  8023c4:	48 b8 a0 1f 80 00 00 	movabs $0x801fa0,%rax
+  8023cb:	00 00 00 
+  8023ce:	ff d0                	call   *%rax
+  8023d0:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023d3:	48 89 de             	mov    %rbx,%rsi
+  8023d6:	4c 89 f7             	mov    %r14,%rdi
+  8023d9:	48 b8 bb 1f 80 00 00 	movabs $0x801fbb,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+  8023e5:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023e8:	48 39 c3             	cmp    %rax,%rbx
+  8023eb:	74 36                	je     802423 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023ed:	48 89 d8             	mov    %rbx,%rax
+  8023f0:	4c 29 e8             	sub    %r13,%rax
+  8023f3:	49 39 c4             	cmp    %rax,%r12
+  8023f6:	73 31                	jae    802429 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023f8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023fd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802401:	4c 89 fe             	mov    %r15,%rsi
+  802404:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802410:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802414:	48 83 c4 08          	add    $0x8,%rsp
+  802418:	5b                   	pop    %rbx
+  802419:	41 5c                	pop    %r12
+  80241b:	41 5d                	pop    %r13
+  80241d:	41 5e                	pop    %r14
+  80241f:	41 5f                	pop    %r15
+  802421:	5d                   	pop    %rbp
+  802422:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802423:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802427:	eb eb                	jmp    802414 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802429:	48 83 eb 01          	sub    $0x1,%rbx
+  80242d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802431:	48 89 da             	mov    %rbx,%rdx
+  802434:	4c 89 fe             	mov    %r15,%rsi
+  802437:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  80243e:	00 00 00 
+  802441:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802443:	49 01 de             	add    %rbx,%r14
+  802446:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80244b:	eb c3                	jmp    802410 <strlcat+0x69>
+
+000000000080244d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80244d:	48 85 d2             	test   %rdx,%rdx
+  802450:	74 2d                	je     80247f <memcmp+0x32>
+  802452:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802457:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80245b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802460:	44 38 c1             	cmp    %r8b,%cl
+  802463:	75 0f                	jne    802474 <memcmp+0x27>
+    while (n-- > 0) {
+  802465:	48 83 c0 01          	add    $0x1,%rax
+  802469:	48 39 c2             	cmp    %rax,%rdx
+  80246c:	75 e9                	jne    802457 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80246e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802473:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802474:	0f b6 c1             	movzbl %cl,%eax
+  802477:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80247b:	44 29 c0             	sub    %r8d,%eax
+  80247e:	c3                   	ret
+    return 0;
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802484:	c3                   	ret
+
+0000000000802485 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802485:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802489:	48 39 c7             	cmp    %rax,%rdi
+  80248c:	73 0f                	jae    80249d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80248e:	40 38 37             	cmp    %sil,(%rdi)
+  802491:	74 0e                	je     8024a1 <memfind+0x1c>
+    for (; src < end; src++) {
+  802493:	48 83 c7 01          	add    $0x1,%rdi
+  802497:	48 39 f8             	cmp    %rdi,%rax
+  80249a:	75 f2                	jne    80248e <memfind+0x9>
+  80249c:	c3                   	ret
+  80249d:	48 89 f8             	mov    %rdi,%rax
+  8024a0:	c3                   	ret
+  8024a1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024a4:	c3                   	ret
+
+00000000008024a5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024a5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024a8:	0f b6 37             	movzbl (%rdi),%esi
+  8024ab:	40 80 fe 20          	cmp    $0x20,%sil
+  8024af:	74 06                	je     8024b7 <strtol+0x12>
+  8024b1:	40 80 fe 09          	cmp    $0x9,%sil
+  8024b5:	75 13                	jne    8024ca <strtol+0x25>
+  8024b7:	48 83 c7 01          	add    $0x1,%rdi
+  8024bb:	0f b6 37             	movzbl (%rdi),%esi
+  8024be:	40 80 fe 20          	cmp    $0x20,%sil
+  8024c2:	74 f3                	je     8024b7 <strtol+0x12>
+  8024c4:	40 80 fe 09          	cmp    $0x9,%sil
+  8024c8:	74 ed                	je     8024b7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024ca:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024cd:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024d0:	3c 01                	cmp    $0x1,%al
+  8024d2:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024d6:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024dc:	75 0f                	jne    8024ed <strtol+0x48>
+  8024de:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024e1:	74 14                	je     8024f7 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024e3:	85 d2                	test   %edx,%edx
+  8024e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024ea:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024ed:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024f2:	4c 63 ca             	movslq %edx,%r9
+  8024f5:	eb 36                	jmp    80252d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024f7:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024fb:	74 0f                	je     80250c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024fd:	85 d2                	test   %edx,%edx
+  8024ff:	75 ec                	jne    8024ed <strtol+0x48>
+        s++;
+  802501:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802505:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80250a:	eb e1                	jmp    8024ed <strtol+0x48>
+        s += 2;
+  80250c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802510:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802515:	eb d6                	jmp    8024ed <strtol+0x48>
+            dig -= '0';
+  802517:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80251a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80251e:	41 39 d0             	cmp    %edx,%r8d
+  802521:	7d 21                	jge    802544 <strtol+0x9f>
+        val = val * base + dig;
+  802523:	49 0f af c1          	imul   %r9,%rax
+  802527:	0f b6 c9             	movzbl %cl,%ecx
+  80252a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80252d:	48 83 c7 01          	add    $0x1,%rdi
+  802531:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802535:	80 f9 39             	cmp    $0x39,%cl
+  802538:	76 dd                	jbe    802517 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80253a:	80 f9 7b             	cmp    $0x7b,%cl
+  80253d:	77 05                	ja     802544 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80253f:	83 e9 57             	sub    $0x57,%ecx
+  802542:	eb d6                	jmp    80251a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802544:	4d 85 d2             	test   %r10,%r10
+  802547:	74 03                	je     80254c <strtol+0xa7>
+  802549:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80254c:	48 89 c2             	mov    %rax,%rdx
+  80254f:	48 f7 da             	neg    %rdx
+  802552:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802556:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80255a:	c3                   	ret
+
+000000000080255b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80255b:	55                   	push   %rbp
+  80255c:	48 89 e5             	mov    %rsp,%rbp
+  80255f:	53                   	push   %rbx
+  802560:	48 89 fa             	mov    %rdi,%rdx
+  802563:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802566:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80256b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802570:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802575:	be 00 00 00 00       	mov    $0x0,%esi
+  80257a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802580:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802586:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802588:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80258c:	c9                   	leave
+  80258d:	c3                   	ret
+
+000000000080258e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80258e:	55                   	push   %rbp
+  80258f:	48 89 e5             	mov    %rsp,%rbp
+  802592:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802593:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025bd:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025c3:	c9                   	leave
+  8025c4:	c3                   	ret
+
+00000000008025c5 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025c5:	55                   	push   %rbp
+  8025c6:	48 89 e5             	mov    %rsp,%rbp
+  8025c9:	53                   	push   %rbx
+  8025ca:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025cd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025f2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f8:	c9                   	leave
+  8025f9:	c3                   	ret
+
+00000000008025fa <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025fa:	55                   	push   %rbp
+  8025fb:	48 89 e5             	mov    %rsp,%rbp
+  8025fe:	53                   	push   %rbx
+  8025ff:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802603:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802606:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80260b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802610:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802615:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80261a:	be 00 00 00 00       	mov    $0x0,%esi
+  80261f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802625:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80262b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80262d:	48 85 c0             	test   %rax,%rax
+  802630:	7f 06                	jg     802638 <sys_env_destroy+0x3e>
+}
+  802632:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802636:	c9                   	leave
+  802637:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802638:	49 89 c0             	mov    %rax,%r8
+  80263b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802640:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802647:	00 00 00 
+  80264a:	be 27 00 00 00       	mov    $0x27,%esi
+  80264f:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802656:	00 00 00 
+  802659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265e:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802665:	00 00 00 
+  802668:	41 ff d1             	call   *%r9
+
+000000000080266b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80266b:	55                   	push   %rbp
+  80266c:	48 89 e5             	mov    %rsp,%rbp
+  80266f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802670:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802675:	ba 00 00 00 00       	mov    $0x0,%edx
+  80267a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80267f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802684:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802689:	be 00 00 00 00       	mov    $0x0,%esi
+  80268e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802694:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80269a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80269c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026a0:	c9                   	leave
+  8026a1:	c3                   	ret
+
+00000000008026a2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8026a2:	55                   	push   %rbp
+  8026a3:	48 89 e5             	mov    %rsp,%rbp
+  8026a6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026a7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026d1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d7:	c9                   	leave
+  8026d8:	c3                   	ret
+
+00000000008026d9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026d9:	55                   	push   %rbp
+  8026da:	48 89 e5             	mov    %rsp,%rbp
+  8026dd:	53                   	push   %rbx
+  8026de:	48 89 fa             	mov    %rdi,%rdx
+  8026e1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026e4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026f0:	00 00 00 
+  8026f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802703:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802709:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80270b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80270f:	c9                   	leave
+  802710:	c3                   	ret
+
+0000000000802711 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+  802715:	53                   	push   %rbx
+  802716:	49 89 f8             	mov    %rdi,%r8
+  802719:	48 89 d3             	mov    %rdx,%rbx
+  80271c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80271f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802724:	4c 89 c2             	mov    %r8,%rdx
+  802727:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80272a:	be 00 00 00 00       	mov    $0x0,%esi
+  80272f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802735:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80273b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80273d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802741:	c9                   	leave
+  802742:	c3                   	ret
+
+0000000000802743 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802743:	55                   	push   %rbp
+  802744:	48 89 e5             	mov    %rsp,%rbp
+  802747:	53                   	push   %rbx
+  802748:	48 83 ec 08          	sub    $0x8,%rsp
+  80274c:	89 f8                	mov    %edi,%eax
+  80274e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802751:	48 63 f9             	movslq %ecx,%rdi
+  802754:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802757:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80275c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80275f:	be 00 00 00 00       	mov    $0x0,%esi
+  802764:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80276a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802770:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802772:	48 85 c0             	test   %rax,%rax
+  802775:	7f 06                	jg     80277d <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802777:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80277b:	c9                   	leave
+  80277c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80277d:	49 89 c0             	mov    %rax,%r8
+  802780:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802785:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  80278c:	00 00 00 
+  80278f:	be 27 00 00 00       	mov    $0x27,%esi
+  802794:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  80279b:	00 00 00 
+  80279e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a3:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  8027aa:	00 00 00 
+  8027ad:	41 ff d1             	call   *%r9
+
+00000000008027b0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027b0:	55                   	push   %rbp
+  8027b1:	48 89 e5             	mov    %rsp,%rbp
+  8027b4:	53                   	push   %rbx
+  8027b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b9:	89 f8                	mov    %edi,%eax
+  8027bb:	49 89 f2             	mov    %rsi,%r10
+  8027be:	48 89 cf             	mov    %rcx,%rdi
+  8027c1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027c4:	48 63 da             	movslq %edx,%rbx
+  8027c7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ca:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027cf:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027d2:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027dd:	48 85 c0             	test   %rax,%rax
+  8027e0:	7f 06                	jg     8027e8 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027e8:	49 89 c0             	mov    %rax,%r8
+  8027eb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027f0:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8027f7:	00 00 00 
+  8027fa:	be 27 00 00 00       	mov    $0x27,%esi
+  8027ff:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802806:	00 00 00 
+  802809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280e:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802815:	00 00 00 
+  802818:	41 ff d1             	call   *%r9
+
+000000000080281b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80281b:	55                   	push   %rbp
+  80281c:	48 89 e5             	mov    %rsp,%rbp
+  80281f:	53                   	push   %rbx
+  802820:	48 83 ec 08          	sub    $0x8,%rsp
+  802824:	48 89 f1             	mov    %rsi,%rcx
+  802827:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  80282a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80282d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802832:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802837:	be 00 00 00 00       	mov    $0x0,%esi
+  80283c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802842:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802848:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80284a:	48 85 c0             	test   %rax,%rax
+  80284d:	7f 06                	jg     802855 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80284f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802853:	c9                   	leave
+  802854:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802855:	49 89 c0             	mov    %rax,%r8
+  802858:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80285d:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802864:	00 00 00 
+  802867:	be 27 00 00 00       	mov    $0x27,%esi
+  80286c:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802873:	00 00 00 
+  802876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287b:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802882:	00 00 00 
+  802885:	41 ff d1             	call   *%r9
+
+0000000000802888 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802888:	55                   	push   %rbp
+  802889:	48 89 e5             	mov    %rsp,%rbp
+  80288c:	53                   	push   %rbx
+  80288d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802891:	48 63 ce             	movslq %esi,%rcx
+  802894:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802897:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80289c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028b9:	48 85 c0             	test   %rax,%rax
+  8028bc:	7f 06                	jg     8028c4 <sys_env_set_status+0x3c>
+}
+  8028be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c2:	c9                   	leave
+  8028c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028c4:	49 89 c0             	mov    %rax,%r8
+  8028c7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028cc:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8028d3:	00 00 00 
+  8028d6:	be 27 00 00 00       	mov    $0x27,%esi
+  8028db:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  8028e2:	00 00 00 
+  8028e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ea:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  8028f1:	00 00 00 
+  8028f4:	41 ff d1             	call   *%r9
+
+00000000008028f7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028f7:	55                   	push   %rbp
+  8028f8:	48 89 e5             	mov    %rsp,%rbp
+  8028fb:	53                   	push   %rbx
+  8028fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802900:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802903:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802906:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80290b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802910:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802915:	be 00 00 00 00       	mov    $0x0,%esi
+  80291a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802920:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802926:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802928:	48 85 c0             	test   %rax,%rax
+  80292b:	7f 06                	jg     802933 <sys_env_set_trapframe+0x3c>
+}
+  80292d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802931:	c9                   	leave
+  802932:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802933:	49 89 c0             	mov    %rax,%r8
+  802936:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80293b:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802942:	00 00 00 
+  802945:	be 27 00 00 00       	mov    $0x27,%esi
+  80294a:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802951:	00 00 00 
+  802954:	b8 00 00 00 00       	mov    $0x0,%eax
+  802959:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802960:	00 00 00 
+  802963:	41 ff d1             	call   *%r9
+
+0000000000802966 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802966:	55                   	push   %rbp
+  802967:	48 89 e5             	mov    %rsp,%rbp
+  80296a:	53                   	push   %rbx
+  80296b:	48 83 ec 08          	sub    $0x8,%rsp
+  80296f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802972:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802975:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80297a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80297f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802984:	be 00 00 00 00       	mov    $0x0,%esi
+  802989:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80298f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802995:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802997:	48 85 c0             	test   %rax,%rax
+  80299a:	7f 06                	jg     8029a2 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80299c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029a0:	c9                   	leave
+  8029a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029a2:	49 89 c0             	mov    %rax,%r8
+  8029a5:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029aa:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8029b1:	00 00 00 
+  8029b4:	be 27 00 00 00       	mov    $0x27,%esi
+  8029b9:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  8029c0:	00 00 00 
+  8029c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c8:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  8029cf:	00 00 00 
+  8029d2:	41 ff d1             	call   *%r9
+
+00000000008029d5 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	53                   	push   %rbx
+  8029da:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029de:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029e5:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a05:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a07:	48 85 c0             	test   %rax,%rax
+  802a0a:	7f 06                	jg     802a12 <sys_env_set_reclaim+0x3d>
+}
+  802a0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a10:	c9                   	leave
+  802a11:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a12:	49 89 c0             	mov    %rax,%r8
+  802a15:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a1a:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802a21:	00 00 00 
+  802a24:	be 27 00 00 00       	mov    $0x27,%esi
+  802a29:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802a30:	00 00 00 
+  802a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a38:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802a3f:	00 00 00 
+  802a42:	41 ff d1             	call   *%r9
+
+0000000000802a45 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a45:	55                   	push   %rbp
+  802a46:	48 89 e5             	mov    %rsp,%rbp
+  802a49:	53                   	push   %rbx
+  802a4a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a4e:	48 63 ce             	movslq %esi,%rcx
+  802a51:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a54:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a5e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a63:	be 00 00 00 00       	mov    $0x0,%esi
+  802a68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a6e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a74:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a76:	48 85 c0             	test   %rax,%rax
+  802a79:	7f 06                	jg     802a81 <sys_env_set_nice+0x3c>
+}
+  802a7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a81:	49 89 c0             	mov    %rax,%r8
+  802a84:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a89:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802a90:	00 00 00 
+  802a93:	be 27 00 00 00       	mov    $0x27,%esi
+  802a98:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802a9f:	00 00 00 
+  802aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa7:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802aae:	00 00 00 
+  802ab1:	41 ff d1             	call   *%r9
+
+0000000000802ab4 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ab4:	55                   	push   %rbp
+  802ab5:	48 89 e5             	mov    %rsp,%rbp
+  802ab8:	53                   	push   %rbx
+  802ab9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802abc:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ac1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ac6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802acb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ad0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802adb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ae1:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ae3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ae7:	c9                   	leave
+  802ae8:	c3                   	ret
+
+0000000000802ae9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ae9:	55                   	push   %rbp
+  802aea:	48 89 e5             	mov    %rsp,%rbp
+  802aed:	53                   	push   %rbx
+  802aee:	89 f8                	mov    %edi,%eax
+  802af0:	49 89 f1             	mov    %rsi,%r9
+  802af3:	48 89 d3             	mov    %rdx,%rbx
+  802af6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802af9:	49 63 f0             	movslq %r8d,%rsi
+  802afc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aff:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b04:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b0d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b13:	cd 30                	int    $0x30
+}
+  802b15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b19:	c9                   	leave
+  802b1a:	c3                   	ret
+
+0000000000802b1b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b1b:	55                   	push   %rbp
+  802b1c:	48 89 e5             	mov    %rsp,%rbp
+  802b1f:	53                   	push   %rbx
+  802b20:	89 f8                	mov    %edi,%eax
+  802b22:	49 89 f1             	mov    %rsi,%r9
+  802b25:	48 89 d3             	mov    %rdx,%rbx
+  802b28:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b2b:	49 63 f0             	movslq %r8d,%rsi
+  802b2e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b31:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b36:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b45:	cd 30                	int    $0x30
+}
+  802b47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4b:	c9                   	leave
+  802b4c:	c3                   	ret
+
+0000000000802b4d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b4d:	55                   	push   %rbp
+  802b4e:	48 89 e5             	mov    %rsp,%rbp
+  802b51:	53                   	push   %rbx
+  802b52:	48 83 ec 08          	sub    $0x8,%rsp
+  802b56:	89 f8                	mov    %edi,%eax
+  802b58:	49 89 f2             	mov    %rsi,%r10
+  802b5b:	48 89 d3             	mov    %rdx,%rbx
+  802b5e:	48 89 cf             	mov    %rcx,%rdi
+  802b61:	44 89 c6             	mov    %r8d,%esi
+  802b64:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b67:	48 63 f6             	movslq %esi,%rsi
+  802b6a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b6d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b72:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b75:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b79:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b7b:	48 85 c0             	test   %rax,%rax
+  802b7e:	7f 06                	jg     802b86 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b84:	c9                   	leave
+  802b85:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b86:	49 89 c0             	mov    %rax,%r8
+  802b89:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b8e:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802b95:	00 00 00 
+  802b98:	be 27 00 00 00       	mov    $0x27,%esi
+  802b9d:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802ba4:	00 00 00 
+  802ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bac:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802bb3:	00 00 00 
+  802bb6:	41 ff d1             	call   *%r9
+
+0000000000802bb9 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bb9:	55                   	push   %rbp
+  802bba:	48 89 e5             	mov    %rsp,%rbp
+  802bbd:	53                   	push   %rbx
+  802bbe:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc2:	48 89 f1             	mov    %rsi,%rcx
+  802bc5:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bc8:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bcc:	48 8b 1a             	mov    (%rdx),%rbx
+  802bcf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bd2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd7:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bdb:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bdf:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802be3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be5:	48 85 c0             	test   %rax,%rax
+  802be8:	7f 06                	jg     802bf0 <sys_ipc_call_short+0x37>
+}
+  802bea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bee:	c9                   	leave
+  802bef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bf0:	49 89 c0             	mov    %rax,%r8
+  802bf3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bf8:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802bff:	00 00 00 
+  802c02:	be 27 00 00 00       	mov    $0x27,%esi
+  802c07:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802c0e:	00 00 00 
+  802c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c16:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802c1d:	00 00 00 
+  802c20:	41 ff d1             	call   *%r9
+
+0000000000802c23 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c23:	55                   	push   %rbp
+  802c24:	48 89 e5             	mov    %rsp,%rbp
+  802c27:	53                   	push   %rbx
+  802c28:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2c:	89 f8                	mov    %edi,%eax
+  802c2e:	49 89 f2             	mov    %rsi,%r10
+  802c31:	48 89 d3             	mov    %rdx,%rbx
+  802c34:	48 89 cf             	mov    %rcx,%rdi
+  802c37:	44 89 c6             	mov    %r8d,%esi
+  802c3a:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c3d:	48 63 f6             	movslq %esi,%rsi
+  802c40:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c43:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c48:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c4b:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c4f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c51:	48 85 c0             	test   %rax,%rax
+  802c54:	7f 06                	jg     802c5c <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c5a:	c9                   	leave
+  802c5b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5c:	49 89 c0             	mov    %rax,%r8
+  802c5f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c64:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802c6b:	00 00 00 
+  802c6e:	be 27 00 00 00       	mov    $0x27,%esi
+  802c73:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802c7a:	00 00 00 
+  802c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c82:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802c89:	00 00 00 
+  802c8c:	41 ff d1             	call   *%r9
+
+0000000000802c8f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	53                   	push   %rbx
+  802c94:	48 83 ec 08          	sub    $0x8,%rsp
+  802c98:	48 89 fa             	mov    %rdi,%rdx
+  802c9b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c9e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cad:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cc0:	48 85 c0             	test   %rax,%rax
+  802cc3:	7f 06                	jg     802ccb <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc9:	c9                   	leave
+  802cca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ccb:	49 89 c0             	mov    %rax,%r8
+  802cce:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cd3:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802cda:	00 00 00 
+  802cdd:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce2:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802ce9:	00 00 00 
+  802cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf1:	49 b9 95 50 80 00 00 	movabs $0x805095,%r9
+  802cf8:	00 00 00 
+  802cfb:	41 ff d1             	call   *%r9
+
+0000000000802cfe <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cfe:	55                   	push   %rbp
+  802cff:	48 89 e5             	mov    %rsp,%rbp
+  802d02:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d03:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d08:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d17:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d1c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d33:	c9                   	leave
+  802d34:	c3                   	ret
+
+0000000000802d35 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d35:	55                   	push   %rbp
+  802d36:	48 89 e5             	mov    %rsp,%rbp
+  802d39:	53                   	push   %rbx
+  802d3a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d3d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d42:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d4c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d51:	be 00 00 00 00       	mov    $0x0,%esi
+  802d56:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d62:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d68:	c9                   	leave
+  802d69:	c3                   	ret
+
+0000000000802d6a <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d6a:	55                   	push   %rbp
+  802d6b:	48 89 e5             	mov    %rsp,%rbp
+  802d6e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d74:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d79:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d83:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d88:	be 00 00 00 00       	mov    $0x0,%esi
+  802d8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d93:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d99:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d9f:	c9                   	leave
+  802da0:	c3                   	ret
+
+0000000000802da1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802da1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802da8:	ff ff ff 
+  802dab:	48 01 f8             	add    %rdi,%rax
+  802dae:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802db2:	c3                   	ret
+
+0000000000802db3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802db3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dba:	ff ff ff 
+  802dbd:	48 01 f8             	add    %rdi,%rax
+  802dc0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802dc4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dca:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dce:	c3                   	ret
+
+0000000000802dcf <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dcf:	55                   	push   %rbp
+  802dd0:	48 89 e5             	mov    %rsp,%rbp
+  802dd3:	41 57                	push   %r15
+  802dd5:	41 56                	push   %r14
+  802dd7:	41 55                	push   %r13
+  802dd9:	41 54                	push   %r12
+  802ddb:	53                   	push   %rbx
+  802ddc:	48 83 ec 08          	sub    $0x8,%rsp
+  802de0:	49 89 ff             	mov    %rdi,%r15
+  802de3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802de8:	49 bd cf 42 80 00 00 	movabs $0x8042cf,%r13
+  802def:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802df2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802df8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802dfb:	48 89 df             	mov    %rbx,%rdi
+  802dfe:	41 ff d5             	call   *%r13
+  802e01:	83 e0 04             	and    $0x4,%eax
+  802e04:	74 17                	je     802e1d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e06:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e0d:	4c 39 f3             	cmp    %r14,%rbx
+  802e10:	75 e6                	jne    802df8 <fd_alloc+0x29>
+  802e12:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e18:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e1d:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e20:	48 83 c4 08          	add    $0x8,%rsp
+  802e24:	5b                   	pop    %rbx
+  802e25:	41 5c                	pop    %r12
+  802e27:	41 5d                	pop    %r13
+  802e29:	41 5e                	pop    %r14
+  802e2b:	41 5f                	pop    %r15
+  802e2d:	5d                   	pop    %rbp
+  802e2e:	c3                   	ret
+
+0000000000802e2f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e2f:	83 ff 1f             	cmp    $0x1f,%edi
+  802e32:	77 39                	ja     802e6d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e34:	55                   	push   %rbp
+  802e35:	48 89 e5             	mov    %rsp,%rbp
+  802e38:	41 54                	push   %r12
+  802e3a:	53                   	push   %rbx
+  802e3b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e3e:	48 63 df             	movslq %edi,%rbx
+  802e41:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e48:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e4c:	48 89 df             	mov    %rbx,%rdi
+  802e4f:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+  802e5b:	a8 04                	test   $0x4,%al
+  802e5d:	74 14                	je     802e73 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e5f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e68:	5b                   	pop    %rbx
+  802e69:	41 5c                	pop    %r12
+  802e6b:	5d                   	pop    %rbp
+  802e6c:	c3                   	ret
+        return -E_INVAL;
+  802e6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e72:	c3                   	ret
+        return -E_INVAL;
+  802e73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e78:	eb ee                	jmp    802e68 <fd_lookup+0x39>
+
+0000000000802e7a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e7a:	55                   	push   %rbp
+  802e7b:	48 89 e5             	mov    %rsp,%rbp
+  802e7e:	41 54                	push   %r12
+  802e80:	53                   	push   %rbx
+  802e81:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e84:	48 b8 40 62 80 00 00 	movabs $0x806240,%rax
+  802e8b:	00 00 00 
+  802e8e:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e95:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e98:	39 3b                	cmp    %edi,(%rbx)
+  802e9a:	74 47                	je     802ee3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e9c:	48 83 c0 08          	add    $0x8,%rax
+  802ea0:	48 8b 18             	mov    (%rax),%rbx
+  802ea3:	48 85 db             	test   %rbx,%rbx
+  802ea6:	75 f0                	jne    802e98 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ea8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802eaf:	00 00 00 
+  802eb2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802eb8:	89 fa                	mov    %edi,%edx
+  802eba:	48 bf b8 61 80 00 00 	movabs $0x8061b8,%rdi
+  802ec1:	00 00 00 
+  802ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec9:	48 b9 a7 16 80 00 00 	movabs $0x8016a7,%rcx
+  802ed0:	00 00 00 
+  802ed3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ed5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802eda:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ede:	5b                   	pop    %rbx
+  802edf:	41 5c                	pop    %r12
+  802ee1:	5d                   	pop    %rbp
+  802ee2:	c3                   	ret
+            return 0;
+  802ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee8:	eb f0                	jmp    802eda <dev_lookup+0x60>
+
+0000000000802eea <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802eea:	55                   	push   %rbp
+  802eeb:	48 89 e5             	mov    %rsp,%rbp
+  802eee:	41 55                	push   %r13
+  802ef0:	41 54                	push   %r12
+  802ef2:	53                   	push   %rbx
+  802ef3:	48 83 ec 18          	sub    $0x18,%rsp
+  802ef7:	48 89 fb             	mov    %rdi,%rbx
+  802efa:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802efd:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f04:	ff ff ff 
+  802f07:	48 01 df             	add    %rbx,%rdi
+  802f0a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f0e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f12:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  802f19:	00 00 00 
+  802f1c:	ff d0                	call   *%rax
+  802f1e:	41 89 c5             	mov    %eax,%r13d
+  802f21:	85 c0                	test   %eax,%eax
+  802f23:	78 06                	js     802f2b <fd_close+0x41>
+  802f25:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f29:	74 1a                	je     802f45 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f2b:	45 84 e4             	test   %r12b,%r12b
+  802f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f33:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f37:	44 89 e8             	mov    %r13d,%eax
+  802f3a:	48 83 c4 18          	add    $0x18,%rsp
+  802f3e:	5b                   	pop    %rbx
+  802f3f:	41 5c                	pop    %r12
+  802f41:	41 5d                	pop    %r13
+  802f43:	5d                   	pop    %rbp
+  802f44:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f45:	8b 3b                	mov    (%rbx),%edi
+  802f47:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f4b:	48 b8 7a 2e 80 00 00 	movabs $0x802e7a,%rax
+  802f52:	00 00 00 
+  802f55:	ff d0                	call   *%rax
+  802f57:	41 89 c5             	mov    %eax,%r13d
+  802f5a:	85 c0                	test   %eax,%eax
+  802f5c:	78 1b                	js     802f79 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f62:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f66:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f6c:	48 85 c0             	test   %rax,%rax
+  802f6f:	74 08                	je     802f79 <fd_close+0x8f>
+  802f71:	48 89 df             	mov    %rbx,%rdi
+  802f74:	ff d0                	call   *%rax
+  802f76:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f7e:	48 89 de             	mov    %rbx,%rsi
+  802f81:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f86:	48 b8 1b 28 80 00 00 	movabs $0x80281b,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+    return res;
+  802f92:	eb a3                	jmp    802f37 <fd_close+0x4d>
+
+0000000000802f94 <close>:
+
+int
+close(int fdnum) {
+  802f94:	55                   	push   %rbp
+  802f95:	48 89 e5             	mov    %rsp,%rbp
+  802f98:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f9c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fa0:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  802fa7:	00 00 00 
+  802faa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fac:	85 c0                	test   %eax,%eax
+  802fae:	78 15                	js     802fc5 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fb0:	be 01 00 00 00       	mov    $0x1,%esi
+  802fb5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb9:	48 b8 ea 2e 80 00 00 	movabs $0x802eea,%rax
+  802fc0:	00 00 00 
+  802fc3:	ff d0                	call   *%rax
+}
+  802fc5:	c9                   	leave
+  802fc6:	c3                   	ret
+
+0000000000802fc7 <close_all>:
+
+void
+close_all(void) {
+  802fc7:	55                   	push   %rbp
+  802fc8:	48 89 e5             	mov    %rsp,%rbp
+  802fcb:	41 54                	push   %r12
+  802fcd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd3:	49 bc 94 2f 80 00 00 	movabs $0x802f94,%r12
+  802fda:	00 00 00 
+  802fdd:	89 df                	mov    %ebx,%edi
+  802fdf:	41 ff d4             	call   *%r12
+  802fe2:	83 c3 01             	add    $0x1,%ebx
+  802fe5:	83 fb 20             	cmp    $0x20,%ebx
+  802fe8:	75 f3                	jne    802fdd <close_all+0x16>
+}
+  802fea:	5b                   	pop    %rbx
+  802feb:	41 5c                	pop    %r12
+  802fed:	5d                   	pop    %rbp
+  802fee:	c3                   	ret
+
+0000000000802fef <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fef:	55                   	push   %rbp
+  802ff0:	48 89 e5             	mov    %rsp,%rbp
+  802ff3:	41 57                	push   %r15
+  802ff5:	41 56                	push   %r14
+  802ff7:	41 55                	push   %r13
+  802ff9:	41 54                	push   %r12
+  802ffb:	53                   	push   %rbx
+  802ffc:	48 83 ec 18          	sub    $0x18,%rsp
+  803000:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803003:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803007:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  80300e:	00 00 00 
+  803011:	ff d0                	call   *%rax
+  803013:	89 c3                	mov    %eax,%ebx
+  803015:	85 c0                	test   %eax,%eax
+  803017:	0f 88 b8 00 00 00    	js     8030d5 <dup+0xe6>
+    close(newfdnum);
+  80301d:	44 89 e7             	mov    %r12d,%edi
+  803020:	48 b8 94 2f 80 00 00 	movabs $0x802f94,%rax
+  803027:	00 00 00 
+  80302a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80302c:	4d 63 ec             	movslq %r12d,%r13
+  80302f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803036:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80303a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80303e:	4c 89 ff             	mov    %r15,%rdi
+  803041:	49 be b3 2d 80 00 00 	movabs $0x802db3,%r14
+  803048:	00 00 00 
+  80304b:	41 ff d6             	call   *%r14
+  80304e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803051:	4c 89 ef             	mov    %r13,%rdi
+  803054:	41 ff d6             	call   *%r14
+  803057:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80305a:	48 89 df             	mov    %rbx,%rdi
+  80305d:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  803064:	00 00 00 
+  803067:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803069:	a8 04                	test   $0x4,%al
+  80306b:	74 2b                	je     803098 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80306d:	41 89 c1             	mov    %eax,%r9d
+  803070:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803076:	4c 89 f1             	mov    %r14,%rcx
+  803079:	ba 00 00 00 00       	mov    $0x0,%edx
+  80307e:	48 89 de             	mov    %rbx,%rsi
+  803081:	bf 00 00 00 00       	mov    $0x0,%edi
+  803086:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  80308d:	00 00 00 
+  803090:	ff d0                	call   *%rax
+  803092:	89 c3                	mov    %eax,%ebx
+  803094:	85 c0                	test   %eax,%eax
+  803096:	78 4e                	js     8030e6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803098:	4c 89 ff             	mov    %r15,%rdi
+  80309b:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030aa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030b0:	4c 89 e9             	mov    %r13,%rcx
+  8030b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b8:	4c 89 fe             	mov    %r15,%rsi
+  8030bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c0:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  8030c7:	00 00 00 
+  8030ca:	ff d0                	call   *%rax
+  8030cc:	89 c3                	mov    %eax,%ebx
+  8030ce:	85 c0                	test   %eax,%eax
+  8030d0:	78 14                	js     8030e6 <dup+0xf7>
+
+    return newfdnum;
+  8030d2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030d5:	89 d8                	mov    %ebx,%eax
+  8030d7:	48 83 c4 18          	add    $0x18,%rsp
+  8030db:	5b                   	pop    %rbx
+  8030dc:	41 5c                	pop    %r12
+  8030de:	41 5d                	pop    %r13
+  8030e0:	41 5e                	pop    %r14
+  8030e2:	41 5f                	pop    %r15
+  8030e4:	5d                   	pop    %rbp
+  8030e5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030eb:	4c 89 ee             	mov    %r13,%rsi
+  8030ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f3:	49 bc 1b 28 80 00 00 	movabs $0x80281b,%r12
+  8030fa:	00 00 00 
+  8030fd:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803100:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803105:	4c 89 f6             	mov    %r14,%rsi
+  803108:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310d:	41 ff d4             	call   *%r12
+    return res;
+  803110:	eb c3                	jmp    8030d5 <dup+0xe6>
+
+0000000000803112 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803112:	55                   	push   %rbp
+  803113:	48 89 e5             	mov    %rsp,%rbp
+  803116:	41 56                	push   %r14
+  803118:	41 55                	push   %r13
+  80311a:	41 54                	push   %r12
+  80311c:	53                   	push   %rbx
+  80311d:	48 83 ec 10          	sub    $0x10,%rsp
+  803121:	89 fb                	mov    %edi,%ebx
+  803123:	49 89 f4             	mov    %rsi,%r12
+  803126:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803129:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80312d:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  803134:	00 00 00 
+  803137:	ff d0                	call   *%rax
+  803139:	85 c0                	test   %eax,%eax
+  80313b:	78 4c                	js     803189 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80313d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803141:	41 8b 3e             	mov    (%r14),%edi
+  803144:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803148:	48 b8 7a 2e 80 00 00 	movabs $0x802e7a,%rax
+  80314f:	00 00 00 
+  803152:	ff d0                	call   *%rax
+  803154:	85 c0                	test   %eax,%eax
+  803156:	78 35                	js     80318d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803158:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80315c:	83 e0 03             	and    $0x3,%eax
+  80315f:	83 f8 01             	cmp    $0x1,%eax
+  803162:	74 2d                	je     803191 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803164:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803168:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80316c:	48 85 c0             	test   %rax,%rax
+  80316f:	74 56                	je     8031c7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803171:	4c 89 ea             	mov    %r13,%rdx
+  803174:	4c 89 e6             	mov    %r12,%rsi
+  803177:	4c 89 f7             	mov    %r14,%rdi
+  80317a:	ff d0                	call   *%rax
+}
+  80317c:	48 83 c4 10          	add    $0x10,%rsp
+  803180:	5b                   	pop    %rbx
+  803181:	41 5c                	pop    %r12
+  803183:	41 5d                	pop    %r13
+  803185:	41 5e                	pop    %r14
+  803187:	5d                   	pop    %rbp
+  803188:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803189:	48 98                	cltq
+  80318b:	eb ef                	jmp    80317c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80318d:	48 98                	cltq
+  80318f:	eb eb                	jmp    80317c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803191:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803198:	00 00 00 
+  80319b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031a1:	89 da                	mov    %ebx,%edx
+  8031a3:	48 bf f9 61 80 00 00 	movabs $0x8061f9,%rdi
+  8031aa:	00 00 00 
+  8031ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b2:	48 b9 a7 16 80 00 00 	movabs $0x8016a7,%rcx
+  8031b9:	00 00 00 
+  8031bc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031c5:	eb b5                	jmp    80317c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031c7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031ce:	eb ac                	jmp    80317c <read+0x6a>
+
+00000000008031d0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031d0:	55                   	push   %rbp
+  8031d1:	48 89 e5             	mov    %rsp,%rbp
+  8031d4:	41 57                	push   %r15
+  8031d6:	41 56                	push   %r14
+  8031d8:	41 55                	push   %r13
+  8031da:	41 54                	push   %r12
+  8031dc:	53                   	push   %rbx
+  8031dd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031e1:	48 85 d2             	test   %rdx,%rdx
+  8031e4:	74 54                	je     80323a <readn+0x6a>
+  8031e6:	41 89 fd             	mov    %edi,%r13d
+  8031e9:	49 89 f6             	mov    %rsi,%r14
+  8031ec:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031f4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031f9:	49 bf 12 31 80 00 00 	movabs $0x803112,%r15
+  803200:	00 00 00 
+  803203:	4c 89 e2             	mov    %r12,%rdx
+  803206:	48 29 f2             	sub    %rsi,%rdx
+  803209:	4c 01 f6             	add    %r14,%rsi
+  80320c:	44 89 ef             	mov    %r13d,%edi
+  80320f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803212:	85 c0                	test   %eax,%eax
+  803214:	78 20                	js     803236 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803216:	01 c3                	add    %eax,%ebx
+  803218:	85 c0                	test   %eax,%eax
+  80321a:	74 08                	je     803224 <readn+0x54>
+  80321c:	48 63 f3             	movslq %ebx,%rsi
+  80321f:	4c 39 e6             	cmp    %r12,%rsi
+  803222:	72 df                	jb     803203 <readn+0x33>
+    }
+    return res;
+  803224:	48 63 c3             	movslq %ebx,%rax
+}
+  803227:	48 83 c4 08          	add    $0x8,%rsp
+  80322b:	5b                   	pop    %rbx
+  80322c:	41 5c                	pop    %r12
+  80322e:	41 5d                	pop    %r13
+  803230:	41 5e                	pop    %r14
+  803232:	41 5f                	pop    %r15
+  803234:	5d                   	pop    %rbp
+  803235:	c3                   	ret
+        if (inc < 0) return inc;
+  803236:	48 98                	cltq
+  803238:	eb ed                	jmp    803227 <readn+0x57>
+    int inc = 1, res = 0;
+  80323a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80323f:	eb e3                	jmp    803224 <readn+0x54>
+
+0000000000803241 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803241:	55                   	push   %rbp
+  803242:	48 89 e5             	mov    %rsp,%rbp
+  803245:	41 56                	push   %r14
+  803247:	41 55                	push   %r13
+  803249:	41 54                	push   %r12
+  80324b:	53                   	push   %rbx
+  80324c:	48 83 ec 10          	sub    $0x10,%rsp
+  803250:	89 fb                	mov    %edi,%ebx
+  803252:	49 89 f4             	mov    %rsi,%r12
+  803255:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803258:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80325c:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+  803268:	85 c0                	test   %eax,%eax
+  80326a:	78 47                	js     8032b3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80326c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803270:	41 8b 3e             	mov    (%r14),%edi
+  803273:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803277:	48 b8 7a 2e 80 00 00 	movabs $0x802e7a,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+  803283:	85 c0                	test   %eax,%eax
+  803285:	78 30                	js     8032b7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803287:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80328c:	74 2d                	je     8032bb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80328e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803292:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803296:	48 85 c0             	test   %rax,%rax
+  803299:	74 56                	je     8032f1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80329b:	4c 89 ea             	mov    %r13,%rdx
+  80329e:	4c 89 e6             	mov    %r12,%rsi
+  8032a1:	4c 89 f7             	mov    %r14,%rdi
+  8032a4:	ff d0                	call   *%rax
+}
+  8032a6:	48 83 c4 10          	add    $0x10,%rsp
+  8032aa:	5b                   	pop    %rbx
+  8032ab:	41 5c                	pop    %r12
+  8032ad:	41 5d                	pop    %r13
+  8032af:	41 5e                	pop    %r14
+  8032b1:	5d                   	pop    %rbp
+  8032b2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032b3:	48 98                	cltq
+  8032b5:	eb ef                	jmp    8032a6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032b7:	48 98                	cltq
+  8032b9:	eb eb                	jmp    8032a6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032bb:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032c2:	00 00 00 
+  8032c5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032cb:	89 da                	mov    %ebx,%edx
+  8032cd:	48 bf 15 62 80 00 00 	movabs $0x806215,%rdi
+  8032d4:	00 00 00 
+  8032d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032dc:	48 b9 a7 16 80 00 00 	movabs $0x8016a7,%rcx
+  8032e3:	00 00 00 
+  8032e6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032e8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ef:	eb b5                	jmp    8032a6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032f1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032f8:	eb ac                	jmp    8032a6 <write+0x65>
+
+00000000008032fa <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032fa:	55                   	push   %rbp
+  8032fb:	48 89 e5             	mov    %rsp,%rbp
+  8032fe:	53                   	push   %rbx
+  8032ff:	48 83 ec 18          	sub    $0x18,%rsp
+  803303:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803305:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803309:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  803310:	00 00 00 
+  803313:	ff d0                	call   *%rax
+  803315:	85 c0                	test   %eax,%eax
+  803317:	78 0c                	js     803325 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80331d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803320:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803325:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803329:	c9                   	leave
+  80332a:	c3                   	ret
+
+000000000080332b <tell>:
+
+int tell(int fdnum) {
+  80332b:	55                   	push   %rbp
+  80332c:	48 89 e5             	mov    %rsp,%rbp
+  80332f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803333:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803337:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  80333e:	00 00 00 
+  803341:	ff d0                	call   *%rax
+  803343:	85 c0                	test   %eax,%eax
+  803345:	78 07                	js     80334e <tell+0x23>
+
+    return fd->fd_offset;
+  803347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80334b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80334e:	c9                   	leave
+  80334f:	c3                   	ret
+
+0000000000803350 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803350:	55                   	push   %rbp
+  803351:	48 89 e5             	mov    %rsp,%rbp
+  803354:	41 55                	push   %r13
+  803356:	41 54                	push   %r12
+  803358:	53                   	push   %rbx
+  803359:	48 83 ec 18          	sub    $0x18,%rsp
+  80335d:	89 fb                	mov    %edi,%ebx
+  80335f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803362:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803366:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  80336d:	00 00 00 
+  803370:	ff d0                	call   *%rax
+  803372:	85 c0                	test   %eax,%eax
+  803374:	78 38                	js     8033ae <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803376:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80337a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80337e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803382:	48 b8 7a 2e 80 00 00 	movabs $0x802e7a,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	78 1c                	js     8033ae <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803392:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803397:	74 20                	je     8033b9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803399:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80339d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033a1:	48 85 c0             	test   %rax,%rax
+  8033a4:	74 47                	je     8033ed <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8033a6:	44 89 e6             	mov    %r12d,%esi
+  8033a9:	4c 89 ef             	mov    %r13,%rdi
+  8033ac:	ff d0                	call   *%rax
+}
+  8033ae:	48 83 c4 18          	add    $0x18,%rsp
+  8033b2:	5b                   	pop    %rbx
+  8033b3:	41 5c                	pop    %r12
+  8033b5:	41 5d                	pop    %r13
+  8033b7:	5d                   	pop    %rbp
+  8033b8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033b9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033c0:	00 00 00 
+  8033c3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033c9:	89 da                	mov    %ebx,%edx
+  8033cb:	48 bf d8 61 80 00 00 	movabs $0x8061d8,%rdi
+  8033d2:	00 00 00 
+  8033d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033da:	48 b9 a7 16 80 00 00 	movabs $0x8016a7,%rcx
+  8033e1:	00 00 00 
+  8033e4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033eb:	eb c1                	jmp    8033ae <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033ed:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033f2:	eb ba                	jmp    8033ae <ftruncate+0x5e>
+
+00000000008033f4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033f4:	55                   	push   %rbp
+  8033f5:	48 89 e5             	mov    %rsp,%rbp
+  8033f8:	41 54                	push   %r12
+  8033fa:	53                   	push   %rbx
+  8033fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8033ff:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803402:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803406:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+  803412:	85 c0                	test   %eax,%eax
+  803414:	78 63                	js     803479 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803416:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80341a:	41 8b 3c 24          	mov    (%r12),%edi
+  80341e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803422:	48 b8 7a 2e 80 00 00 	movabs $0x802e7a,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	78 47                	js     803479 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803432:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803436:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80343b:	74 45                	je     803482 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80343d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803440:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803447:	00 00 00 
+    stat->st_isdir = 0;
+  80344a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803451:	00 00 00 
+    stat->st_ino = 0;
+  803454:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80345b:	00 00 00 00 
+    stat->st_version = 0;
+  80345f:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803466:	00 00 00 
+    stat->st_dev = dev;
+  803469:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803470:	48 89 de             	mov    %rbx,%rsi
+  803473:	4c 89 e7             	mov    %r12,%rdi
+  803476:	ff 50 28             	call   *0x28(%rax)
+}
+  803479:	48 83 c4 10          	add    $0x10,%rsp
+  80347d:	5b                   	pop    %rbx
+  80347e:	41 5c                	pop    %r12
+  803480:	5d                   	pop    %rbp
+  803481:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803482:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803487:	eb f0                	jmp    803479 <fstat+0x85>
+
+0000000000803489 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803489:	55                   	push   %rbp
+  80348a:	48 89 e5             	mov    %rsp,%rbp
+  80348d:	41 54                	push   %r12
+  80348f:	53                   	push   %rbx
+  803490:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803493:	be 00 00 00 00       	mov    $0x0,%esi
+  803498:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  80349f:	00 00 00 
+  8034a2:	ff d0                	call   *%rax
+  8034a4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	78 25                	js     8034cf <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034aa:	4c 89 e6             	mov    %r12,%rsi
+  8034ad:	89 c7                	mov    %eax,%edi
+  8034af:	48 b8 f4 33 80 00 00 	movabs $0x8033f4,%rax
+  8034b6:	00 00 00 
+  8034b9:	ff d0                	call   *%rax
+  8034bb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034be:	89 df                	mov    %ebx,%edi
+  8034c0:	48 b8 94 2f 80 00 00 	movabs $0x802f94,%rax
+  8034c7:	00 00 00 
+  8034ca:	ff d0                	call   *%rax
+
+    return res;
+  8034cc:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034cf:	89 d8                	mov    %ebx,%eax
+  8034d1:	5b                   	pop    %rbx
+  8034d2:	41 5c                	pop    %r12
+  8034d4:	5d                   	pop    %rbp
+  8034d5:	c3                   	ret
+
+00000000008034d6 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034d6:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034dd:	00 00 00 
+  8034e0:	83 38 00             	cmpl   $0x0,(%rax)
+  8034e3:	74 0a                	je     8034ef <fsipc_env+0x19>
+    return fsenv;
+}
+  8034e5:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034ec:	00 00 
+  8034ee:	c3                   	ret
+fsipc_env(void) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034f3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034f8:	48 b8 7c 56 80 00 00 	movabs $0x80567c,%rax
+  8034ff:	00 00 00 
+  803502:	ff d0                	call   *%rax
+  803504:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80350b:	00 00 
+}
+  80350d:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803514:	00 00 
+  803516:	5d                   	pop    %rbp
+  803517:	c3                   	ret
+
+0000000000803518 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803518:	55                   	push   %rbp
+  803519:	48 89 e5             	mov    %rsp,%rbp
+  80351c:	53                   	push   %rbx
+  80351d:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803521:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803528:	00 
+  803529:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803530:	00 
+  803531:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803538:	00 
+  803539:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803540:	00 
+  803541:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803548:	00 
+
+    assert(size <= sizeof(words));
+  803549:	48 83 fa 28          	cmp    $0x28,%rdx
+  80354d:	77 38                	ja     803587 <fsipc_short+0x6f>
+  80354f:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803551:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803555:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  80355c:	00 00 00 
+  80355f:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803561:	48 b8 d6 34 80 00 00 	movabs $0x8034d6,%rax
+  803568:	00 00 00 
+  80356b:	ff d0                	call   *%rax
+  80356d:	89 c7                	mov    %eax,%edi
+  80356f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803573:	89 de                	mov    %ebx,%esi
+  803575:	48 b8 df 55 80 00 00 	movabs $0x8055df,%rax
+  80357c:	00 00 00 
+  80357f:	ff d0                	call   *%rax
+}
+  803581:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803585:	c9                   	leave
+  803586:	c3                   	ret
+    assert(size <= sizeof(words));
+  803587:	48 b9 60 62 80 00 00 	movabs $0x806260,%rcx
+  80358e:	00 00 00 
+  803591:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803598:	00 00 00 
+  80359b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8035a0:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  8035a7:	00 00 00 
+  8035aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035af:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  8035b6:	00 00 00 
+  8035b9:	41 ff d0             	call   *%r8
+
+00000000008035bc <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035bc:	55                   	push   %rbp
+  8035bd:	48 89 e5             	mov    %rsp,%rbp
+  8035c0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035c4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035c7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035ca:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035cd:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035d2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035d6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035db:	48 b8 18 35 80 00 00 	movabs $0x803518,%rax
+  8035e2:	00 00 00 
+  8035e5:	ff d0                	call   *%rax
+}
+  8035e7:	c9                   	leave
+  8035e8:	c3                   	ret
+
+00000000008035e9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035f1:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035f4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035f7:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035fc:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803600:	bf 06 00 00 00       	mov    $0x6,%edi
+  803605:	48 b8 18 35 80 00 00 	movabs $0x803518,%rax
+  80360c:	00 00 00 
+  80360f:	ff d0                	call   *%rax
+}
+  803611:	c9                   	leave
+  803612:	c3                   	ret
+
+0000000000803613 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803613:	55                   	push   %rbp
+  803614:	48 89 e5             	mov    %rsp,%rbp
+  803617:	41 54                	push   %r12
+  803619:	53                   	push   %rbx
+  80361a:	48 83 ec 10          	sub    $0x10,%rsp
+  80361e:	89 fb                	mov    %edi,%ebx
+  803620:	49 89 f4             	mov    %rsi,%r12
+  803623:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803627:	48 b8 d6 34 80 00 00 	movabs $0x8034d6,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+  803633:	89 c7                	mov    %eax,%edi
+  803635:	6a 00                	push   $0x0
+  803637:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80363b:	50                   	push   %rax
+  80363c:	4d 89 e1             	mov    %r12,%r9
+  80363f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803645:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80364a:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803651:	00 00 00 
+  803654:	89 de                	mov    %ebx,%esi
+  803656:	48 b8 7a 55 80 00 00 	movabs $0x80557a,%rax
+  80365d:	00 00 00 
+  803660:	ff d0                	call   *%rax
+}
+  803662:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803666:	5b                   	pop    %rbx
+  803667:	41 5c                	pop    %r12
+  803669:	5d                   	pop    %rbp
+  80366a:	c3                   	ret
+
+000000000080366b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80366b:	55                   	push   %rbp
+  80366c:	48 89 e5             	mov    %rsp,%rbp
+  80366f:	41 54                	push   %r12
+  803671:	53                   	push   %rbx
+  803672:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803675:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803678:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80367f:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803681:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803686:	be 00 00 00 00       	mov    $0x0,%esi
+  80368b:	bf 05 00 00 00       	mov    $0x5,%edi
+  803690:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  803697:	00 00 00 
+  80369a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80369c:	85 c0                	test   %eax,%eax
+  80369e:	78 5a                	js     8036fa <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8036a0:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036a7:	00 00 00 
+  8036aa:	4c 89 e6             	mov    %r12,%rsi
+  8036ad:	48 89 df             	mov    %rbx,%rdi
+  8036b0:	48 b8 de 1f 80 00 00 	movabs $0x801fde,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036bc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036c3:	00 
+  8036c4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036ca:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036d1:	00 
+  8036d2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036d8:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036df:	00 
+  8036e0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036e7:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036ee:	00 
+  8036ef:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036fa:	5b                   	pop    %rbx
+  8036fb:	41 5c                	pop    %r12
+  8036fd:	5d                   	pop    %rbp
+  8036fe:	c3                   	ret
+
+00000000008036ff <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036ff:	55                   	push   %rbp
+  803700:	48 89 e5             	mov    %rsp,%rbp
+  803703:	41 57                	push   %r15
+  803705:	41 56                	push   %r14
+  803707:	41 55                	push   %r13
+  803709:	41 54                	push   %r12
+  80370b:	53                   	push   %rbx
+  80370c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803710:	48 85 ff             	test   %rdi,%rdi
+  803713:	0f 84 a1 00 00 00    	je     8037ba <devfile_read+0xbb>
+  803719:	49 89 ff             	mov    %rdi,%r15
+  80371c:	49 89 f5             	mov    %rsi,%r13
+  80371f:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803722:	48 85 f6             	test   %rsi,%rsi
+  803725:	0f 84 c4 00 00 00    	je     8037ef <devfile_read+0xf0>
+    size_t total_read = 0;
+  80372b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803732:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803733:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80373a:	00 00 00 
+  80373d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803741:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803744:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803748:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80374d:	be 00 00 00 00       	mov    $0x0,%esi
+  803752:	bf 03 00 00 00       	mov    $0x3,%edi
+  803757:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  80375e:	00 00 00 
+  803761:	ff d0                	call   *%rax
+        if (res < 0) {
+  803763:	85 c0                	test   %eax,%eax
+  803765:	0f 88 b9 00 00 00    	js     803824 <devfile_read+0x125>
+        assert(res <= n);
+  80376b:	48 63 d8             	movslq %eax,%rbx
+  80376e:	49 39 dc             	cmp    %rbx,%r12
+  803771:	0f 82 b1 00 00 00    	jb     803828 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803777:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80377c:	0f 87 db 00 00 00    	ja     80385d <devfile_read+0x15e>
+        if (!res) {
+  803782:	85 c0                	test   %eax,%eax
+  803784:	74 21                	je     8037a7 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803786:	48 89 da             	mov    %rbx,%rdx
+  803789:	4c 89 f6             	mov    %r14,%rsi
+  80378c:	4c 89 ef             	mov    %r13,%rdi
+  80378f:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  803796:	00 00 00 
+  803799:	ff d0                	call   *%rax
+        total_read += res;
+  80379b:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  80379f:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8037a2:	49 29 dc             	sub    %rbx,%r12
+  8037a5:	75 96                	jne    80373d <devfile_read+0x3e>
+    return total_read;
+  8037a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037ab:	48 83 c4 18          	add    $0x18,%rsp
+  8037af:	5b                   	pop    %rbx
+  8037b0:	41 5c                	pop    %r12
+  8037b2:	41 5d                	pop    %r13
+  8037b4:	41 5e                	pop    %r14
+  8037b6:	41 5f                	pop    %r15
+  8037b8:	5d                   	pop    %rbp
+  8037b9:	c3                   	ret
+    assert(fd);
+  8037ba:	48 b9 96 62 80 00 00 	movabs $0x806296,%rcx
+  8037c1:	00 00 00 
+  8037c4:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8037cb:	00 00 00 
+  8037ce:	be 91 00 00 00       	mov    $0x91,%esi
+  8037d3:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  8037da:	00 00 00 
+  8037dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e2:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  8037e9:	00 00 00 
+  8037ec:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037ef:	48 b9 99 62 80 00 00 	movabs $0x806299,%rcx
+  8037f6:	00 00 00 
+  8037f9:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803800:	00 00 00 
+  803803:	be 92 00 00 00       	mov    $0x92,%esi
+  803808:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80380f:	00 00 00 
+  803812:	b8 00 00 00 00       	mov    $0x0,%eax
+  803817:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  80381e:	00 00 00 
+  803821:	41 ff d0             	call   *%r8
+            return res;
+  803824:	48 98                	cltq
+  803826:	eb 83                	jmp    8037ab <devfile_read+0xac>
+        assert(res <= n);
+  803828:	48 b9 9d 62 80 00 00 	movabs $0x80629d,%rcx
+  80382f:	00 00 00 
+  803832:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803839:	00 00 00 
+  80383c:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803841:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  803848:	00 00 00 
+  80384b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803850:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  803857:	00 00 00 
+  80385a:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80385d:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  803864:	00 00 00 
+  803867:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80386e:	00 00 00 
+  803871:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803876:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80387d:	00 00 00 
+  803880:	b8 00 00 00 00       	mov    $0x0,%eax
+  803885:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  80388c:	00 00 00 
+  80388f:	41 ff d0             	call   *%r8
+
+0000000000803892 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803892:	55                   	push   %rbp
+  803893:	48 89 e5             	mov    %rsp,%rbp
+  803896:	41 57                	push   %r15
+  803898:	41 56                	push   %r14
+  80389a:	41 55                	push   %r13
+  80389c:	41 54                	push   %r12
+  80389e:	53                   	push   %rbx
+  80389f:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8038a3:	48 85 ff             	test   %rdi,%rdi
+  8038a6:	0f 84 83 00 00 00    	je     80392f <devfile_write+0x9d>
+  8038ac:	49 89 ff             	mov    %rdi,%r15
+  8038af:	49 89 f4             	mov    %rsi,%r12
+  8038b2:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038b5:	48 85 f6             	test   %rsi,%rsi
+  8038b8:	0f 84 a6 00 00 00    	je     803964 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038be:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038c4:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038cb:	00 00 00 
+  8038ce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038d2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038d5:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038d9:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038de:	48 39 d3             	cmp    %rdx,%rbx
+  8038e1:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038e5:	4c 89 e6             	mov    %r12,%rsi
+  8038e8:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038ef:	00 00 00 
+  8038f2:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  8038f9:	00 00 00 
+  8038fc:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803903:	be 00 00 00 00       	mov    $0x0,%esi
+  803908:	bf 04 00 00 00       	mov    $0x4,%edi
+  80390d:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  803914:	00 00 00 
+  803917:	ff d0                	call   *%rax
+        if (res < 0) {
+  803919:	85 c0                	test   %eax,%eax
+  80391b:	78 7c                	js     803999 <devfile_write+0x107>
+        total_written += res;
+  80391d:	48 98                	cltq
+  80391f:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803922:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803925:	48 29 c3             	sub    %rax,%rbx
+  803928:	75 a4                	jne    8038ce <devfile_write+0x3c>
+    return total_written;
+  80392a:	4c 89 e8             	mov    %r13,%rax
+  80392d:	eb 6c                	jmp    80399b <devfile_write+0x109>
+    assert(fd);
+  80392f:	48 b9 96 62 80 00 00 	movabs $0x806296,%rcx
+  803936:	00 00 00 
+  803939:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803940:	00 00 00 
+  803943:	be bd 00 00 00       	mov    $0xbd,%esi
+  803948:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80394f:	00 00 00 
+  803952:	b8 00 00 00 00       	mov    $0x0,%eax
+  803957:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  80395e:	00 00 00 
+  803961:	41 ff d0             	call   *%r8
+    assert(buf);
+  803964:	48 b9 99 62 80 00 00 	movabs $0x806299,%rcx
+  80396b:	00 00 00 
+  80396e:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803975:	00 00 00 
+  803978:	be be 00 00 00       	mov    $0xbe,%esi
+  80397d:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  803984:	00 00 00 
+  803987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398c:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  803993:	00 00 00 
+  803996:	41 ff d0             	call   *%r8
+            return res;
+  803999:	48 98                	cltq
+}
+  80399b:	48 83 c4 08          	add    $0x8,%rsp
+  80399f:	5b                   	pop    %rbx
+  8039a0:	41 5c                	pop    %r12
+  8039a2:	41 5d                	pop    %r13
+  8039a4:	41 5e                	pop    %r14
+  8039a6:	41 5f                	pop    %r15
+  8039a8:	5d                   	pop    %rbp
+  8039a9:	c3                   	ret
+
+00000000008039aa <open>:
+open(const char *path, int mode) {
+  8039aa:	55                   	push   %rbp
+  8039ab:	48 89 e5             	mov    %rsp,%rbp
+  8039ae:	41 55                	push   %r13
+  8039b0:	41 54                	push   %r12
+  8039b2:	53                   	push   %rbx
+  8039b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8039b7:	49 89 fc             	mov    %rdi,%r12
+  8039ba:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039bd:	48 b8 a0 1f 80 00 00 	movabs $0x801fa0,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+  8039c9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039cf:	0f 87 8f 00 00 00    	ja     803a64 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039d5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039d9:	48 b8 cf 2d 80 00 00 	movabs $0x802dcf,%rax
+  8039e0:	00 00 00 
+  8039e3:	ff d0                	call   *%rax
+  8039e5:	89 c3                	mov    %eax,%ebx
+  8039e7:	85 c0                	test   %eax,%eax
+  8039e9:	78 55                	js     803a40 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039eb:	4c 89 e6             	mov    %r12,%rsi
+  8039ee:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039f5:	00 00 00 
+  8039f8:	48 89 df             	mov    %rbx,%rdi
+  8039fb:	48 b8 de 1f 80 00 00 	movabs $0x801fde,%rax
+  803a02:	00 00 00 
+  803a05:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a07:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a13:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a17:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a1c:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+  803a28:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a2a:	85 c0                	test   %eax,%eax
+  803a2c:	78 1f                	js     803a4d <open+0xa3>
+    return fd2num(fd);
+  803a2e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a32:	48 b8 a1 2d 80 00 00 	movabs $0x802da1,%rax
+  803a39:	00 00 00 
+  803a3c:	ff d0                	call   *%rax
+  803a3e:	89 c3                	mov    %eax,%ebx
+}
+  803a40:	89 d8                	mov    %ebx,%eax
+  803a42:	48 83 c4 18          	add    $0x18,%rsp
+  803a46:	5b                   	pop    %rbx
+  803a47:	41 5c                	pop    %r12
+  803a49:	41 5d                	pop    %r13
+  803a4b:	5d                   	pop    %rbp
+  803a4c:	c3                   	ret
+        fd_close(fd, 0);
+  803a4d:	be 00 00 00 00       	mov    $0x0,%esi
+  803a52:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a56:	48 b8 ea 2e 80 00 00 	movabs $0x802eea,%rax
+  803a5d:	00 00 00 
+  803a60:	ff d0                	call   *%rax
+        return res;
+  803a62:	eb dc                	jmp    803a40 <open+0x96>
+        return -E_BAD_PATH;
+  803a64:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a69:	eb d5                	jmp    803a40 <open+0x96>
+
+0000000000803a6b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a6b:	55                   	push   %rbp
+  803a6c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a74:	be 00 00 00 00       	mov    $0x0,%esi
+  803a79:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a7e:	48 b8 18 35 80 00 00 	movabs $0x803518,%rax
+  803a85:	00 00 00 
+  803a88:	ff d0                	call   *%rax
+}
+  803a8a:	5d                   	pop    %rbp
+  803a8b:	c3                   	ret
+
+0000000000803a8c <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a8c:	55                   	push   %rbp
+  803a8d:	48 89 e5             	mov    %rsp,%rbp
+  803a90:	41 56                	push   %r14
+  803a92:	41 55                	push   %r13
+  803a94:	41 54                	push   %r12
+  803a96:	53                   	push   %rbx
+  803a97:	48 83 ec 10          	sub    $0x10,%rsp
+  803a9b:	41 89 f6             	mov    %esi,%r14d
+  803a9e:	49 89 d4             	mov    %rdx,%r12
+  803aa1:	48 89 cb             	mov    %rcx,%rbx
+  803aa4:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803aa7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aab:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  803ab2:	00 00 00 
+  803ab5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ab7:	85 c0                	test   %eax,%eax
+  803ab9:	78 46                	js     803b01 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803abb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803abf:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ac6:	00 00 00 
+  803ac9:	8b 00                	mov    (%rax),%eax
+  803acb:	39 02                	cmp    %eax,(%rdx)
+  803acd:	75 3f                	jne    803b0e <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803acf:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ad6:	00 00 00 
+  803ad9:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803adc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ade:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ae2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ae6:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803aea:	48 89 da             	mov    %rbx,%rdx
+  803aed:	4c 89 e6             	mov    %r12,%rsi
+  803af0:	bf 09 00 00 00       	mov    $0x9,%edi
+  803af5:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+}
+  803b01:	48 83 c4 10          	add    $0x10,%rsp
+  803b05:	5b                   	pop    %rbx
+  803b06:	41 5c                	pop    %r12
+  803b08:	41 5d                	pop    %r13
+  803b0a:	41 5e                	pop    %r14
+  803b0c:	5d                   	pop    %rbp
+  803b0d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b0e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b13:	eb ec                	jmp    803b01 <file_map+0x75>
+
+0000000000803b15 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b15:	55                   	push   %rbp
+  803b16:	48 89 e5             	mov    %rsp,%rbp
+  803b19:	41 54                	push   %r12
+  803b1b:	53                   	push   %rbx
+  803b1c:	48 83 ec 20          	sub    $0x20,%rsp
+  803b20:	41 89 f4             	mov    %esi,%r12d
+  803b23:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b26:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b2a:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  803b31:	00 00 00 
+  803b34:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b36:	85 c0                	test   %eax,%eax
+  803b38:	78 3c                	js     803b76 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b3e:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b45:	00 00 00 
+  803b48:	8b 0a                	mov    (%rdx),%ecx
+  803b4a:	39 08                	cmp    %ecx,(%rax)
+  803b4c:	75 31                	jne    803b7f <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b4e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b51:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b54:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b58:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b5c:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b61:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b65:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b6a:	48 b8 18 35 80 00 00 	movabs $0x803518,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+}
+  803b76:	48 83 c4 20          	add    $0x20,%rsp
+  803b7a:	5b                   	pop    %rbx
+  803b7b:	41 5c                	pop    %r12
+  803b7d:	5d                   	pop    %rbp
+  803b7e:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b7f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b84:	eb f0                	jmp    803b76 <file_msync+0x61>
+
+0000000000803b86 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b86:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b8a:	7f 01                	jg     803b8d <writebuf+0x7>
+  803b8c:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b8d:	55                   	push   %rbp
+  803b8e:	48 89 e5             	mov    %rsp,%rbp
+  803b91:	53                   	push   %rbx
+  803b92:	48 83 ec 08          	sub    $0x8,%rsp
+  803b96:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b99:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b9d:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803ba1:	8b 3f                	mov    (%rdi),%edi
+  803ba3:	48 b8 41 32 80 00 00 	movabs $0x803241,%rax
+  803baa:	00 00 00 
+  803bad:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803baf:	48 85 c0             	test   %rax,%rax
+  803bb2:	7e 04                	jle    803bb8 <writebuf+0x32>
+  803bb4:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bb8:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bbc:	48 39 c2             	cmp    %rax,%rdx
+  803bbf:	74 0f                	je     803bd0 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bc1:	48 85 c0             	test   %rax,%rax
+  803bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bcd:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bd4:	c9                   	leave
+  803bd5:	c3                   	ret
+
+0000000000803bd6 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bd6:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bd9:	8d 50 01             	lea    0x1(%rax),%edx
+  803bdc:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bdf:	48 98                	cltq
+  803be1:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803be6:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bec:	74 01                	je     803bef <putch+0x19>
+  803bee:	c3                   	ret
+putch(int ch, void *arg) {
+  803bef:	55                   	push   %rbp
+  803bf0:	48 89 e5             	mov    %rsp,%rbp
+  803bf3:	53                   	push   %rbx
+  803bf4:	48 83 ec 08          	sub    $0x8,%rsp
+  803bf8:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bfb:	48 89 f7             	mov    %rsi,%rdi
+  803bfe:	48 b8 86 3b 80 00 00 	movabs $0x803b86,%rax
+  803c05:	00 00 00 
+  803c08:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c0a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c15:	c9                   	leave
+  803c16:	c3                   	ret
+
+0000000000803c17 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c17:	55                   	push   %rbp
+  803c18:	48 89 e5             	mov    %rsp,%rbp
+  803c1b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c22:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c25:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c2b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c32:	00 00 00 
+    state.result = 0;
+  803c35:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c3c:	00 00 00 00 
+    state.error = 1;
+  803c40:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c47:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c4a:	48 89 f2             	mov    %rsi,%rdx
+  803c4d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c54:	48 bf d6 3b 80 00 00 	movabs $0x803bd6,%rdi
+  803c5b:	00 00 00 
+  803c5e:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  803c65:	00 00 00 
+  803c68:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c6a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c71:	7f 14                	jg     803c87 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c73:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c7a:	48 85 c0             	test   %rax,%rax
+  803c7d:	75 06                	jne    803c85 <vfprintf+0x6e>
+  803c7f:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c85:	c9                   	leave
+  803c86:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c87:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c8e:	48 b8 86 3b 80 00 00 	movabs $0x803b86,%rax
+  803c95:	00 00 00 
+  803c98:	ff d0                	call   *%rax
+  803c9a:	eb d7                	jmp    803c73 <vfprintf+0x5c>
+
+0000000000803c9c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c9c:	55                   	push   %rbp
+  803c9d:	48 89 e5             	mov    %rsp,%rbp
+  803ca0:	48 83 ec 50          	sub    $0x50,%rsp
+  803ca4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ca8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cac:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cb0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cb4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cbb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cc7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ccb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ccf:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  803cd6:	00 00 00 
+  803cd9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cdb:	c9                   	leave
+  803cdc:	c3                   	ret
+
+0000000000803cdd <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cdd:	55                   	push   %rbp
+  803cde:	48 89 e5             	mov    %rsp,%rbp
+  803ce1:	48 83 ec 50          	sub    $0x50,%rsp
+  803ce5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ce9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ced:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cf1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cf5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cf9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d00:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d08:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d0c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d10:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d14:	48 89 fe             	mov    %rdi,%rsi
+  803d17:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d1c:	48 b8 17 3c 80 00 00 	movabs $0x803c17,%rax
+  803d23:	00 00 00 
+  803d26:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d28:	c9                   	leave
+  803d29:	c3                   	ret
+
+0000000000803d2a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d2a:	55                   	push   %rbp
+  803d2b:	48 89 e5             	mov    %rsp,%rbp
+  803d2e:	41 54                	push   %r12
+  803d30:	53                   	push   %rbx
+  803d31:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d34:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  803d3b:	00 00 00 
+  803d3e:	ff d0                	call   *%rax
+  803d40:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d43:	48 be d0 62 80 00 00 	movabs $0x8062d0,%rsi
+  803d4a:	00 00 00 
+  803d4d:	48 89 df             	mov    %rbx,%rdi
+  803d50:	48 b8 de 1f 80 00 00 	movabs $0x801fde,%rax
+  803d57:	00 00 00 
+  803d5a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d5c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d61:	41 2b 04 24          	sub    (%r12),%eax
+  803d65:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d6b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d72:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d75:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d7c:	00 00 00 
+  803d7f:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d86:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d8b:	5b                   	pop    %rbx
+  803d8c:	41 5c                	pop    %r12
+  803d8e:	5d                   	pop    %rbp
+  803d8f:	c3                   	ret
+
+0000000000803d90 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d90:	55                   	push   %rbp
+  803d91:	48 89 e5             	mov    %rsp,%rbp
+  803d94:	41 54                	push   %r12
+  803d96:	53                   	push   %rbx
+  803d97:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d9f:	48 89 fe             	mov    %rdi,%rsi
+  803da2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da7:	49 bc 1b 28 80 00 00 	movabs $0x80281b,%r12
+  803dae:	00 00 00 
+  803db1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803db4:	48 89 df             	mov    %rbx,%rdi
+  803db7:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  803dbe:	00 00 00 
+  803dc1:	ff d0                	call   *%rax
+  803dc3:	48 89 c6             	mov    %rax,%rsi
+  803dc6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd0:	41 ff d4             	call   *%r12
+}
+  803dd3:	5b                   	pop    %rbx
+  803dd4:	41 5c                	pop    %r12
+  803dd6:	5d                   	pop    %rbp
+  803dd7:	c3                   	ret
+
+0000000000803dd8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dd8:	55                   	push   %rbp
+  803dd9:	48 89 e5             	mov    %rsp,%rbp
+  803ddc:	41 57                	push   %r15
+  803dde:	41 56                	push   %r14
+  803de0:	41 55                	push   %r13
+  803de2:	41 54                	push   %r12
+  803de4:	53                   	push   %rbx
+  803de5:	48 83 ec 18          	sub    $0x18,%rsp
+  803de9:	49 89 fc             	mov    %rdi,%r12
+  803dec:	49 89 f5             	mov    %rsi,%r13
+  803def:	49 89 d7             	mov    %rdx,%r15
+  803df2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803df6:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  803dfd:	00 00 00 
+  803e00:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e02:	4d 85 ff             	test   %r15,%r15
+  803e05:	0f 84 af 00 00 00    	je     803eba <devpipe_write+0xe2>
+  803e0b:	48 89 c3             	mov    %rax,%rbx
+  803e0e:	4c 89 f8             	mov    %r15,%rax
+  803e11:	4d 89 ef             	mov    %r13,%r15
+  803e14:	4c 01 e8             	add    %r13,%rax
+  803e17:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e1b:	49 bd 11 27 80 00 00 	movabs $0x802711,%r13
+  803e22:	00 00 00 
+            sys_yield();
+  803e25:	49 be a2 26 80 00 00 	movabs $0x8026a2,%r14
+  803e2c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e2f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e32:	48 63 ce             	movslq %esi,%rcx
+  803e35:	48 63 03             	movslq (%rbx),%rax
+  803e38:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e3e:	48 39 c1             	cmp    %rax,%rcx
+  803e41:	72 2e                	jb     803e71 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e43:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e48:	48 89 da             	mov    %rbx,%rdx
+  803e4b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e50:	4c 89 e7             	mov    %r12,%rdi
+  803e53:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e56:	85 c0                	test   %eax,%eax
+  803e58:	74 66                	je     803ec0 <devpipe_write+0xe8>
+            sys_yield();
+  803e5a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e5d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e60:	48 63 ce             	movslq %esi,%rcx
+  803e63:	48 63 03             	movslq (%rbx),%rax
+  803e66:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e6c:	48 39 c1             	cmp    %rax,%rcx
+  803e6f:	73 d2                	jae    803e43 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e71:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e75:	48 89 ca             	mov    %rcx,%rdx
+  803e78:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e7c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e83:	08 10 20 
+  803e86:	48 f7 e2             	mul    %rdx
+  803e89:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e8d:	48 89 d0             	mov    %rdx,%rax
+  803e90:	48 c1 e0 09          	shl    $0x9,%rax
+  803e94:	48 29 d0             	sub    %rdx,%rax
+  803e97:	48 c1 e0 03          	shl    $0x3,%rax
+  803e9b:	48 29 c1             	sub    %rax,%rcx
+  803e9e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ea3:	83 c6 01             	add    $0x1,%esi
+  803ea6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ea9:	49 83 c7 01          	add    $0x1,%r15
+  803ead:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eb1:	49 39 c7             	cmp    %rax,%r15
+  803eb4:	0f 85 75 ff ff ff    	jne    803e2f <devpipe_write+0x57>
+    return n;
+  803eba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ebe:	eb 05                	jmp    803ec5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ec5:	48 83 c4 18          	add    $0x18,%rsp
+  803ec9:	5b                   	pop    %rbx
+  803eca:	41 5c                	pop    %r12
+  803ecc:	41 5d                	pop    %r13
+  803ece:	41 5e                	pop    %r14
+  803ed0:	41 5f                	pop    %r15
+  803ed2:	5d                   	pop    %rbp
+  803ed3:	c3                   	ret
+
+0000000000803ed4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ed4:	55                   	push   %rbp
+  803ed5:	48 89 e5             	mov    %rsp,%rbp
+  803ed8:	41 57                	push   %r15
+  803eda:	41 56                	push   %r14
+  803edc:	41 55                	push   %r13
+  803ede:	41 54                	push   %r12
+  803ee0:	53                   	push   %rbx
+  803ee1:	48 83 ec 18          	sub    $0x18,%rsp
+  803ee5:	49 89 fc             	mov    %rdi,%r12
+  803ee8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803eec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ef0:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  803ef7:	00 00 00 
+  803efa:	ff d0                	call   *%rax
+  803efc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803eff:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f05:	49 bd 11 27 80 00 00 	movabs $0x802711,%r13
+  803f0c:	00 00 00 
+            sys_yield();
+  803f0f:	49 be a2 26 80 00 00 	movabs $0x8026a2,%r14
+  803f16:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f19:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f1e:	74 7d                	je     803f9d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f20:	8b 03                	mov    (%rbx),%eax
+  803f22:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f25:	75 26                	jne    803f4d <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f27:	4d 85 ff             	test   %r15,%r15
+  803f2a:	75 77                	jne    803fa3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f2c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f31:	48 89 da             	mov    %rbx,%rdx
+  803f34:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f39:	4c 89 e7             	mov    %r12,%rdi
+  803f3c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f3f:	85 c0                	test   %eax,%eax
+  803f41:	74 72                	je     803fb5 <devpipe_read+0xe1>
+            sys_yield();
+  803f43:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f46:	8b 03                	mov    (%rbx),%eax
+  803f48:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f4b:	74 df                	je     803f2c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f4d:	48 63 c8             	movslq %eax,%rcx
+  803f50:	48 89 ca             	mov    %rcx,%rdx
+  803f53:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f57:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f5e:	08 10 20 
+  803f61:	48 89 d0             	mov    %rdx,%rax
+  803f64:	48 f7 e6             	mul    %rsi
+  803f67:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f6b:	48 89 d0             	mov    %rdx,%rax
+  803f6e:	48 c1 e0 09          	shl    $0x9,%rax
+  803f72:	48 29 d0             	sub    %rdx,%rax
+  803f75:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f7c:	00 
+  803f7d:	48 89 c8             	mov    %rcx,%rax
+  803f80:	48 29 d0             	sub    %rdx,%rax
+  803f83:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f88:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f8c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f90:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f93:	49 83 c7 01          	add    $0x1,%r15
+  803f97:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f9b:	75 83                	jne    803f20 <devpipe_read+0x4c>
+    return n;
+  803f9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fa1:	eb 03                	jmp    803fa6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803fa3:	4c 89 f8             	mov    %r15,%rax
+}
+  803fa6:	48 83 c4 18          	add    $0x18,%rsp
+  803faa:	5b                   	pop    %rbx
+  803fab:	41 5c                	pop    %r12
+  803fad:	41 5d                	pop    %r13
+  803faf:	41 5e                	pop    %r14
+  803fb1:	41 5f                	pop    %r15
+  803fb3:	5d                   	pop    %rbp
+  803fb4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fba:	eb ea                	jmp    803fa6 <devpipe_read+0xd2>
+
+0000000000803fbc <pipe>:
+pipe(int pfd[2]) {
+  803fbc:	55                   	push   %rbp
+  803fbd:	48 89 e5             	mov    %rsp,%rbp
+  803fc0:	41 55                	push   %r13
+  803fc2:	41 54                	push   %r12
+  803fc4:	53                   	push   %rbx
+  803fc5:	48 83 ec 18          	sub    $0x18,%rsp
+  803fc9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fcc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fd0:	48 b8 cf 2d 80 00 00 	movabs $0x802dcf,%rax
+  803fd7:	00 00 00 
+  803fda:	ff d0                	call   *%rax
+  803fdc:	89 c3                	mov    %eax,%ebx
+  803fde:	85 c0                	test   %eax,%eax
+  803fe0:	0f 88 a0 01 00 00    	js     804186 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fe6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803feb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ff0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ff4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff9:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  804000:	00 00 00 
+  804003:	ff d0                	call   *%rax
+  804005:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804007:	85 c0                	test   %eax,%eax
+  804009:	0f 88 77 01 00 00    	js     804186 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80400f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804013:	48 b8 cf 2d 80 00 00 	movabs $0x802dcf,%rax
+  80401a:	00 00 00 
+  80401d:	ff d0                	call   *%rax
+  80401f:	89 c3                	mov    %eax,%ebx
+  804021:	85 c0                	test   %eax,%eax
+  804023:	0f 88 43 01 00 00    	js     80416c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804029:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80402e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804033:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804037:	bf 00 00 00 00       	mov    $0x0,%edi
+  80403c:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  804043:	00 00 00 
+  804046:	ff d0                	call   *%rax
+  804048:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80404a:	85 c0                	test   %eax,%eax
+  80404c:	0f 88 1a 01 00 00    	js     80416c <pipe+0x1b0>
+    va = fd2data(fd0);
+  804052:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804056:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  80405d:	00 00 00 
+  804060:	ff d0                	call   *%rax
+  804062:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804065:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80406a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80406f:	48 89 c6             	mov    %rax,%rsi
+  804072:	bf 00 00 00 00       	mov    $0x0,%edi
+  804077:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+  804083:	89 c3                	mov    %eax,%ebx
+  804085:	85 c0                	test   %eax,%eax
+  804087:	0f 88 c5 00 00 00    	js     804152 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80408d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804091:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  804098:	00 00 00 
+  80409b:	ff d0                	call   *%rax
+  80409d:	48 89 c1             	mov    %rax,%rcx
+  8040a0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040a6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040b1:	4c 89 ee             	mov    %r13,%rsi
+  8040b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b9:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  8040c0:	00 00 00 
+  8040c3:	ff d0                	call   *%rax
+  8040c5:	89 c3                	mov    %eax,%ebx
+  8040c7:	85 c0                	test   %eax,%eax
+  8040c9:	78 6e                	js     804139 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040d0:	4c 89 ef             	mov    %r13,%rdi
+  8040d3:	48 b8 d9 26 80 00 00 	movabs $0x8026d9,%rax
+  8040da:	00 00 00 
+  8040dd:	ff d0                	call   *%rax
+  8040df:	83 f8 02             	cmp    $0x2,%eax
+  8040e2:	0f 85 ab 00 00 00    	jne    804193 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040e8:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040ef:	00 00 
+  8040f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040f7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040fb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804102:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804106:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804108:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80410c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804113:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804117:	48 bb a1 2d 80 00 00 	movabs $0x802da1,%rbx
+  80411e:	00 00 00 
+  804121:	ff d3                	call   *%rbx
+  804123:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804127:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80412b:	ff d3                	call   *%rbx
+  80412d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804137:	eb 4d                	jmp    804186 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804139:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80413e:	4c 89 ee             	mov    %r13,%rsi
+  804141:	bf 00 00 00 00       	mov    $0x0,%edi
+  804146:	48 b8 1b 28 80 00 00 	movabs $0x80281b,%rax
+  80414d:	00 00 00 
+  804150:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804152:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804157:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80415b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804160:	48 b8 1b 28 80 00 00 	movabs $0x80281b,%rax
+  804167:	00 00 00 
+  80416a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80416c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804171:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80417a:	48 b8 1b 28 80 00 00 	movabs $0x80281b,%rax
+  804181:	00 00 00 
+  804184:	ff d0                	call   *%rax
+}
+  804186:	89 d8                	mov    %ebx,%eax
+  804188:	48 83 c4 18          	add    $0x18,%rsp
+  80418c:	5b                   	pop    %rbx
+  80418d:	41 5c                	pop    %r12
+  80418f:	41 5d                	pop    %r13
+  804191:	5d                   	pop    %rbp
+  804192:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804193:	48 b9 e8 62 80 00 00 	movabs $0x8062e8,%rcx
+  80419a:	00 00 00 
+  80419d:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8041a4:	00 00 00 
+  8041a7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041ac:	48 bf d7 62 80 00 00 	movabs $0x8062d7,%rdi
+  8041b3:	00 00 00 
+  8041b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041bb:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  8041c2:	00 00 00 
+  8041c5:	41 ff d0             	call   *%r8
+
+00000000008041c8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041c8:	55                   	push   %rbp
+  8041c9:	48 89 e5             	mov    %rsp,%rbp
+  8041cc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041d4:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  8041db:	00 00 00 
+  8041de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041e0:	85 c0                	test   %eax,%eax
+  8041e2:	78 35                	js     804219 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041e4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e8:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  8041ef:	00 00 00 
+  8041f2:	ff d0                	call   *%rax
+  8041f4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041f7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041fc:	be 00 10 00 00       	mov    $0x1000,%esi
+  804201:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804205:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  80420c:	00 00 00 
+  80420f:	ff d0                	call   *%rax
+  804211:	85 c0                	test   %eax,%eax
+  804213:	0f 94 c0             	sete   %al
+  804216:	0f b6 c0             	movzbl %al,%eax
+}
+  804219:	c9                   	leave
+  80421a:	c3                   	ret
+
+000000000080421b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80421b:	48 89 f8             	mov    %rdi,%rax
+  80421e:	48 c1 e8 27          	shr    $0x27,%rax
+  804222:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804229:	01 00 00 
+  80422c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804230:	f6 c2 01             	test   $0x1,%dl
+  804233:	74 6d                	je     8042a2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804235:	48 89 f8             	mov    %rdi,%rax
+  804238:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80423c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804243:	01 00 00 
+  804246:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80424a:	f6 c2 01             	test   $0x1,%dl
+  80424d:	74 62                	je     8042b1 <get_uvpt_entry+0x96>
+  80424f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804256:	01 00 00 
+  804259:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80425d:	f6 c2 80             	test   $0x80,%dl
+  804260:	75 4f                	jne    8042b1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804262:	48 89 f8             	mov    %rdi,%rax
+  804265:	48 c1 e8 15          	shr    $0x15,%rax
+  804269:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804270:	01 00 00 
+  804273:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804277:	f6 c2 01             	test   $0x1,%dl
+  80427a:	74 44                	je     8042c0 <get_uvpt_entry+0xa5>
+  80427c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804283:	01 00 00 
+  804286:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80428a:	f6 c2 80             	test   $0x80,%dl
+  80428d:	75 31                	jne    8042c0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80428f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804293:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80429a:	01 00 00 
+  80429d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8042a1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042a2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042a9:	01 00 00 
+  8042ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042b0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042b1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042b8:	01 00 00 
+  8042bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042bf:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042c0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042c7:	01 00 00 
+  8042ca:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ce:	c3                   	ret
+
+00000000008042cf <get_prot>:
+
+int
+get_prot(void *va) {
+  8042cf:	55                   	push   %rbp
+  8042d0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042d3:	48 b8 1b 42 80 00 00 	movabs $0x80421b,%rax
+  8042da:	00 00 00 
+  8042dd:	ff d0                	call   *%rax
+  8042df:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042e2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042e7:	89 c1                	mov    %eax,%ecx
+  8042e9:	83 c9 04             	or     $0x4,%ecx
+  8042ec:	f6 c2 01             	test   $0x1,%dl
+  8042ef:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042f2:	89 c1                	mov    %eax,%ecx
+  8042f4:	83 c9 02             	or     $0x2,%ecx
+  8042f7:	f6 c2 02             	test   $0x2,%dl
+  8042fa:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042fd:	89 c1                	mov    %eax,%ecx
+  8042ff:	83 c9 01             	or     $0x1,%ecx
+  804302:	48 85 d2             	test   %rdx,%rdx
+  804305:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804308:	89 c1                	mov    %eax,%ecx
+  80430a:	83 c9 40             	or     $0x40,%ecx
+  80430d:	f6 c6 04             	test   $0x4,%dh
+  804310:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804313:	5d                   	pop    %rbp
+  804314:	c3                   	ret
+
+0000000000804315 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804315:	55                   	push   %rbp
+  804316:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804319:	48 b8 1b 42 80 00 00 	movabs $0x80421b,%rax
+  804320:	00 00 00 
+  804323:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804325:	48 c1 e8 06          	shr    $0x6,%rax
+  804329:	83 e0 01             	and    $0x1,%eax
+}
+  80432c:	5d                   	pop    %rbp
+  80432d:	c3                   	ret
+
+000000000080432e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80432e:	55                   	push   %rbp
+  80432f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804332:	48 b8 1b 42 80 00 00 	movabs $0x80421b,%rax
+  804339:	00 00 00 
+  80433c:	ff d0                	call   *%rax
+  80433e:	83 e0 01             	and    $0x1,%eax
+}
+  804341:	5d                   	pop    %rbp
+  804342:	c3                   	ret
+
+0000000000804343 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804343:	55                   	push   %rbp
+  804344:	48 89 e5             	mov    %rsp,%rbp
+  804347:	41 57                	push   %r15
+  804349:	41 56                	push   %r14
+  80434b:	41 55                	push   %r13
+  80434d:	41 54                	push   %r12
+  80434f:	53                   	push   %rbx
+  804350:	48 83 ec 28          	sub    $0x28,%rsp
+  804354:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804358:	48 85 ff             	test   %rdi,%rdi
+  80435b:	74 1e                	je     80437b <foreach_shared_region+0x38>
+  80435d:	49 89 ff             	mov    %rdi,%r15
+  804360:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804366:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80436c:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804373:	01 00 00 
+  804376:	e9 72 02 00 00       	jmp    8045ed <foreach_shared_region+0x2aa>
+    assert(fun);
+  80437b:	48 b9 0c 63 80 00 00 	movabs $0x80630c,%rcx
+  804382:	00 00 00 
+  804385:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80438c:	00 00 00 
+  80438f:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804394:	48 bf 10 63 80 00 00 	movabs $0x806310,%rdi
+  80439b:	00 00 00 
+  80439e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a3:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  8043aa:	00 00 00 
+  8043ad:	41 ff d0             	call   *%r8
+  8043b0:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043b7:	eb 6c                	jmp    804425 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043b9:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043c0:	ff ff ff 
+  8043c3:	4c 21 e2             	and    %r12,%rdx
+  8043c6:	48 89 d8             	mov    %rbx,%rax
+  8043c9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043ce:	48 83 c0 01          	add    $0x1,%rax
+  8043d2:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043d6:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043dd:	00 00 00 
+  8043e0:	48 21 c8             	and    %rcx,%rax
+  8043e3:	48 09 d0             	or     %rdx,%rax
+  8043e6:	49 89 c4             	mov    %rax,%r12
+  8043e9:	eb 30                	jmp    80441b <foreach_shared_region+0xd8>
+  8043eb:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043f2:	ff ff ff 
+  8043f5:	4c 21 e2             	and    %r12,%rdx
+  8043f8:	48 89 d8             	mov    %rbx,%rax
+  8043fb:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804400:	48 83 c0 01          	add    $0x1,%rax
+  804404:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804408:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80440f:	00 00 00 
+  804412:	48 21 c8             	and    %rcx,%rax
+  804415:	48 09 d0             	or     %rdx,%rax
+  804418:	49 89 c4             	mov    %rax,%r12
+  80441b:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80441f:	0f 84 99 01 00 00    	je     8045be <foreach_shared_region+0x27b>
+  804425:	4c 89 e3             	mov    %r12,%rbx
+  804428:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80442c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804433:	01 00 00 
+  804436:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80443a:	a8 01                	test   $0x1,%al
+  80443c:	0f 84 77 ff ff ff    	je     8043b9 <foreach_shared_region+0x76>
+  804442:	a8 80                	test   $0x80,%al
+  804444:	74 19                	je     80445f <foreach_shared_region+0x11c>
+  804446:	f6 c4 04             	test   $0x4,%ah
+  804449:	74 a0                	je     8043eb <foreach_shared_region+0xa8>
+  80444b:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804452:	40 
+  804453:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804457:	4c 89 e7             	mov    %r12,%rdi
+  80445a:	41 ff d7             	call   *%r15
+  80445d:	eb 8c                	jmp    8043eb <foreach_shared_region+0xa8>
+  80445f:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804466:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80446a:	eb 46                	jmp    8044b2 <foreach_shared_region+0x16f>
+  80446c:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804473:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804479:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80447d:	48 c1 e0 15          	shl    $0x15,%rax
+  804481:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804486:	49 09 c4             	or     %rax,%r12
+  804489:	eb 1d                	jmp    8044a8 <foreach_shared_region+0x165>
+  80448b:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804492:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804498:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80449c:	48 c1 e0 15          	shl    $0x15,%rax
+  8044a0:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044a5:	49 09 c4             	or     %rax,%r12
+  8044a8:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044ac:	0f 84 d3 00 00 00    	je     804585 <foreach_shared_region+0x242>
+  8044b2:	4c 89 e3             	mov    %r12,%rbx
+  8044b5:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044b9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044c0:	01 00 00 
+  8044c3:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044c7:	a8 01                	test   $0x1,%al
+  8044c9:	74 a1                	je     80446c <foreach_shared_region+0x129>
+  8044cb:	a8 80                	test   $0x80,%al
+  8044cd:	74 19                	je     8044e8 <foreach_shared_region+0x1a5>
+  8044cf:	f6 c4 04             	test   $0x4,%ah
+  8044d2:	74 b7                	je     80448b <foreach_shared_region+0x148>
+  8044d4:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044db:	00 
+  8044dc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044e0:	4c 89 e7             	mov    %r12,%rdi
+  8044e3:	41 ff d7             	call   *%r15
+  8044e6:	eb a3                	jmp    80448b <foreach_shared_region+0x148>
+  8044e8:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044ee:	eb 3b                	jmp    80452b <foreach_shared_region+0x1e8>
+  8044f0:	f6 c4 04             	test   $0x4,%ah
+  8044f3:	74 12                	je     804507 <foreach_shared_region+0x1c4>
+  8044f5:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044fc:	00 
+  8044fd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804501:	4c 89 e7             	mov    %r12,%rdi
+  804504:	41 ff d7             	call   *%r15
+  804507:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80450e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804514:	48 83 c3 01          	add    $0x1,%rbx
+  804518:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80451c:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804522:	49 09 dc             	or     %rbx,%r12
+  804525:	41 83 ed 01          	sub    $0x1,%r13d
+  804529:	74 2f                	je     80455a <foreach_shared_region+0x217>
+  80452b:	4c 89 e3             	mov    %r12,%rbx
+  80452e:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804532:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804536:	a8 01                	test   $0x1,%al
+  804538:	75 b6                	jne    8044f0 <foreach_shared_region+0x1ad>
+  80453a:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804541:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804547:	48 83 c3 01          	add    $0x1,%rbx
+  80454b:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80454f:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804555:	49 09 dc             	or     %rbx,%r12
+  804558:	eb cb                	jmp    804525 <foreach_shared_region+0x1e2>
+  80455a:	4c 89 e0             	mov    %r12,%rax
+  80455d:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804563:	49 c1 ec 15          	shr    $0x15,%r12
+  804567:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80456e:	49 83 c4 01          	add    $0x1,%r12
+  804572:	49 c1 e4 15          	shl    $0x15,%r12
+  804576:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80457d:	49 09 c4             	or     %rax,%r12
+  804580:	e9 23 ff ff ff       	jmp    8044a8 <foreach_shared_region+0x165>
+  804585:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804589:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804590:	ff ff ff 
+  804593:	4c 21 e0             	and    %r12,%rax
+  804596:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80459a:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8045a1:	49 83 c4 01          	add    $0x1,%r12
+  8045a5:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045a9:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045b0:	00 00 00 
+  8045b3:	49 21 d4             	and    %rdx,%r12
+  8045b6:	49 09 c4             	or     %rax,%r12
+  8045b9:	e9 5d fe ff ff       	jmp    80441b <foreach_shared_region+0xd8>
+  8045be:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045c5:	00 ff ff 
+  8045c8:	4c 21 e0             	and    %r12,%rax
+  8045cb:	49 c1 ec 27          	shr    $0x27,%r12
+  8045cf:	49 83 c4 01          	add    $0x1,%r12
+  8045d3:	49 c1 e4 27          	shl    $0x27,%r12
+  8045d7:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045de:	ff 00 00 
+  8045e1:	49 21 d4             	and    %rdx,%r12
+  8045e4:	49 09 c4             	or     %rax,%r12
+  8045e7:	41 83 ed 01          	sub    $0x1,%r13d
+  8045eb:	74 48                	je     804635 <foreach_shared_region+0x2f2>
+  8045ed:	4c 89 e0             	mov    %r12,%rax
+  8045f0:	48 c1 e8 27          	shr    $0x27,%rax
+  8045f4:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045fb:	01 00 00 
+  8045fe:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804602:	f6 c2 01             	test   $0x1,%dl
+  804605:	0f 85 a5 fd ff ff    	jne    8043b0 <foreach_shared_region+0x6d>
+  80460b:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804612:	00 ff ff 
+  804615:	4c 21 e2             	and    %r12,%rdx
+  804618:	48 83 c0 01          	add    $0x1,%rax
+  80461c:	48 c1 e0 27          	shl    $0x27,%rax
+  804620:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804627:	ff 00 00 
+  80462a:	48 21 c8             	and    %rcx,%rax
+  80462d:	48 09 d0             	or     %rdx,%rax
+  804630:	49 89 c4             	mov    %rax,%r12
+  804633:	eb b2                	jmp    8045e7 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804635:	4d 85 e4             	test   %r12,%r12
+  804638:	75 14                	jne    80464e <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80463a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463f:	48 83 c4 28          	add    $0x28,%rsp
+  804643:	5b                   	pop    %rbx
+  804644:	41 5c                	pop    %r12
+  804646:	41 5d                	pop    %r13
+  804648:	41 5e                	pop    %r14
+  80464a:	41 5f                	pop    %r15
+  80464c:	5d                   	pop    %rbp
+  80464d:	c3                   	ret
+    assert(addr == 0);
+  80464e:	48 b9 1b 63 80 00 00 	movabs $0x80631b,%rcx
+  804655:	00 00 00 
+  804658:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80465f:	00 00 00 
+  804662:	be 67 00 00 00       	mov    $0x67,%esi
+  804667:	48 bf 10 63 80 00 00 	movabs $0x806310,%rdi
+  80466e:	00 00 00 
+  804671:	b8 00 00 00 00       	mov    $0x0,%eax
+  804676:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  80467d:	00 00 00 
+  804680:	41 ff d0             	call   *%r8
+
+0000000000804683 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804683:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  80468a:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80468d:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804693:	eb 33                	jmp    8046c8 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804695:	48 83 c0 20          	add    $0x20,%rax
+  804699:	4c 39 c0             	cmp    %r8,%rax
+  80469c:	74 25                	je     8046c3 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80469e:	48 8b 10             	mov    (%rax),%rdx
+  8046a1:	48 85 d2             	test   %rdx,%rdx
+  8046a4:	74 ef                	je     804695 <mmap_place+0x12>
+  8046a6:	48 89 d1             	mov    %rdx,%rcx
+  8046a9:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046ad:	48 39 cf             	cmp    %rcx,%rdi
+  8046b0:	73 e3                	jae    804695 <mmap_place+0x12>
+  8046b2:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046b6:	4c 39 ca             	cmp    %r9,%rdx
+  8046b9:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046bd:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046c1:	eb d2                	jmp    804695 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046c3:	45 84 d2             	test   %r10b,%r10b
+  8046c6:	74 12                	je     8046da <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046c8:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046cf:	00 00 00 
+        moved = 0;
+  8046d2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046d8:	eb c4                	jmp    80469e <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046da:	48 01 fe             	add    %rdi,%rsi
+  8046dd:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046e4:	00 00 00 
+  8046e7:	48 39 f0             	cmp    %rsi,%rax
+  8046ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ef:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046f3:	c3                   	ret
+
+00000000008046f4 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046f4:	55                   	push   %rbp
+  8046f5:	48 89 e5             	mov    %rsp,%rbp
+  8046f8:	41 57                	push   %r15
+  8046fa:	41 56                	push   %r14
+  8046fc:	41 55                	push   %r13
+  8046fe:	41 54                	push   %r12
+  804700:	53                   	push   %rbx
+  804701:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804705:	48 8b 1f             	mov    (%rdi),%rbx
+  804708:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80470f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804716:	00 00 00 
+  804719:	ba 00 00 00 00       	mov    $0x0,%edx
+  80471e:	eb 12                	jmp    804732 <mmap_pgfault+0x3e>
+  804720:	48 83 c2 01          	add    $0x1,%rdx
+  804724:	48 83 c0 20          	add    $0x20,%rax
+  804728:	48 83 fa 20          	cmp    $0x20,%rdx
+  80472c:	0f 84 04 01 00 00    	je     804836 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804732:	48 8b 08             	mov    (%rax),%rcx
+  804735:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804739:	48 39 de             	cmp    %rbx,%rsi
+  80473c:	73 e2                	jae    804720 <mmap_pgfault+0x2c>
+  80473e:	48 03 48 08          	add    0x8(%rax),%rcx
+  804742:	48 39 cb             	cmp    %rcx,%rbx
+  804745:	73 d9                	jae    804720 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804747:	48 c1 e2 05          	shl    $0x5,%rdx
+  80474b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804752:	00 00 00 
+  804755:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804759:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80475d:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804761:	f6 c2 01             	test   $0x1,%dl
+  804764:	0f 84 e0 00 00 00    	je     80484a <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80476a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80476f:	f6 c2 02             	test   $0x2,%dl
+  804772:	0f 84 c3 00 00 00    	je     80483b <mmap_pgfault+0x147>
+  804778:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80477f:	ff ff ff 
+  804782:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804786:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80478d:	00 00 00 
+  804790:	48 39 ca             	cmp    %rcx,%rdx
+  804793:	0f 85 a2 00 00 00    	jne    80483b <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804799:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80479e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a3:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047aa:	00 00 00 
+  8047ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047b2:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  8047b9:	00 00 00 
+  8047bc:	ff d0                	call   *%rax
+  8047be:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c5:	85 d2                	test   %edx,%edx
+  8047c7:	78 72                	js     80483b <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ce:	48 89 de             	mov    %rbx,%rsi
+  8047d1:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047d8:	00 00 00 
+  8047db:	4c 89 e7             	mov    %r12,%rdi
+  8047de:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  8047e5:	00 00 00 
+  8047e8:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047ea:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047f0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047f6:	48 89 d9             	mov    %rbx,%rcx
+  8047f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047fe:	4c 89 e6             	mov    %r12,%rsi
+  804801:	bf 00 00 00 00       	mov    $0x0,%edi
+  804806:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  80480d:	00 00 00 
+  804810:	ff d0                	call   *%rax
+  804812:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804814:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804819:	4c 89 e6             	mov    %r12,%rsi
+  80481c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804821:	48 b8 1b 28 80 00 00 	movabs $0x80281b,%rax
+  804828:	00 00 00 
+  80482b:	ff d0                	call   *%rax
+    return res >= 0;
+  80482d:	89 d8                	mov    %ebx,%eax
+  80482f:	f7 d0                	not    %eax
+  804831:	c1 e8 1f             	shr    $0x1f,%eax
+  804834:	eb 05                	jmp    80483b <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804836:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80483b:	48 83 c4 18          	add    $0x18,%rsp
+  80483f:	5b                   	pop    %rbx
+  804840:	41 5c                	pop    %r12
+  804842:	41 5d                	pop    %r13
+  804844:	41 5e                	pop    %r14
+  804846:	41 5f                	pop    %r15
+  804848:	5d                   	pop    %rbp
+  804849:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80484a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80484e:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804852:	4c 03 30             	add    (%rax),%r14
+  804855:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80485c:	49 39 c6             	cmp    %rax,%r14
+  80485f:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804863:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80486a:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804870:	49 bf 2e 43 80 00 00 	movabs $0x80432e,%r15
+  804877:	00 00 00 
+  80487a:	4d 39 f4             	cmp    %r14,%r12
+  80487d:	73 1d                	jae    80489c <mmap_pgfault+0x1a8>
+  80487f:	4c 89 e7             	mov    %r12,%rdi
+  804882:	41 ff d7             	call   *%r15
+  804885:	84 c0                	test   %al,%al
+  804887:	75 13                	jne    80489c <mmap_pgfault+0x1a8>
+  804889:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804890:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804897:	4d 39 f4             	cmp    %r14,%r12
+  80489a:	72 e3                	jb     80487f <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80489c:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8048a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a6:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048aa:	74 2a                	je     8048d6 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048b0:	89 de                	mov    %ebx,%esi
+  8048b2:	2b 30                	sub    (%rax),%esi
+  8048b4:	03 70 1c             	add    0x1c(%rax),%esi
+  8048b7:	8b 78 18             	mov    0x18(%rax),%edi
+  8048ba:	4c 89 e9             	mov    %r13,%rcx
+  8048bd:	48 89 da             	mov    %rbx,%rdx
+  8048c0:	48 b8 8c 3a 80 00 00 	movabs $0x803a8c,%rax
+  8048c7:	00 00 00 
+  8048ca:	ff d0                	call   *%rax
+    return res > 0;
+  8048cc:	85 c0                	test   %eax,%eax
+  8048ce:	0f 9f c0             	setg   %al
+  8048d1:	e9 65 ff ff ff       	jmp    80483b <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048d6:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048da:	eb d0                	jmp    8048ac <mmap_pgfault+0x1b8>
+
+00000000008048dc <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048dc:	55                   	push   %rbp
+  8048dd:	48 89 e5             	mov    %rsp,%rbp
+  8048e0:	41 57                	push   %r15
+  8048e2:	41 56                	push   %r14
+  8048e4:	41 55                	push   %r13
+  8048e6:	41 54                	push   %r12
+  8048e8:	53                   	push   %rbx
+  8048e9:	48 83 ec 28          	sub    $0x28,%rsp
+  8048ed:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048f1:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048f4:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048fb:	ff ff ff 
+  8048fe:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804902:	b8 00 00 00 00       	mov    $0x0,%eax
+  804907:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80490e:	00 00 00 
+  804911:	48 39 ca             	cmp    %rcx,%rdx
+  804914:	0f 85 e5 00 00 00    	jne    8049ff <mmap_writeback+0x123>
+  80491a:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80491d:	4c 39 ee             	cmp    %r13,%rsi
+  804920:	0f 83 e8 00 00 00    	jae    804a0e <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804926:	49 be 2e 43 80 00 00 	movabs $0x80432e,%r14
+  80492d:	00 00 00 
+  804930:	49 bf 15 43 80 00 00 	movabs $0x804315,%r15
+  804937:	00 00 00 
+  80493a:	eb 10                	jmp    80494c <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80493c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804943:	4d 39 ec             	cmp    %r13,%r12
+  804946:	0f 83 ae 00 00 00    	jae    8049fa <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80494c:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804950:	4c 89 e7             	mov    %r12,%rdi
+  804953:	41 ff d6             	call   *%r14
+  804956:	84 c0                	test   %al,%al
+  804958:	74 e2                	je     80493c <mmap_writeback+0x60>
+  80495a:	4c 89 e7             	mov    %r12,%rdi
+  80495d:	41 ff d7             	call   *%r15
+  804960:	84 c0                	test   %al,%al
+  804962:	74 d8                	je     80493c <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804964:	4c 89 e3             	mov    %r12,%rbx
+  804967:	4d 39 ec             	cmp    %r13,%r12
+  80496a:	73 20                	jae    80498c <mmap_writeback+0xb0>
+  80496c:	48 89 df             	mov    %rbx,%rdi
+  80496f:	41 ff d6             	call   *%r14
+  804972:	84 c0                	test   %al,%al
+  804974:	74 16                	je     80498c <mmap_writeback+0xb0>
+  804976:	48 89 df             	mov    %rbx,%rdi
+  804979:	41 ff d7             	call   *%r15
+  80497c:	84 c0                	test   %al,%al
+  80497e:	74 0c                	je     80498c <mmap_writeback+0xb0>
+  804980:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804987:	4c 39 eb             	cmp    %r13,%rbx
+  80498a:	72 e0                	jb     80496c <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80498c:	48 89 d9             	mov    %rbx,%rcx
+  80498f:	4c 29 e1             	sub    %r12,%rcx
+  804992:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804996:	44 89 e6             	mov    %r12d,%esi
+  804999:	2b 30                	sub    (%rax),%esi
+  80499b:	49 89 c4             	mov    %rax,%r12
+  80499e:	03 70 1c             	add    0x1c(%rax),%esi
+  8049a1:	8b 78 18             	mov    0x18(%rax),%edi
+  8049a4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049a8:	48 89 ca             	mov    %rcx,%rdx
+  8049ab:	48 b8 15 3b 80 00 00 	movabs $0x803b15,%rax
+  8049b2:	00 00 00 
+  8049b5:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049b7:	85 c0                	test   %eax,%eax
+  8049b9:	78 44                	js     8049ff <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049bb:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049c0:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049c3:	41 89 c1             	mov    %eax,%r9d
+  8049c6:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049cd:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049d1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049da:	48 89 ce             	mov    %rcx,%rsi
+  8049dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049e2:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  8049e9:	00 00 00 
+  8049ec:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049ee:	85 c0                	test   %eax,%eax
+  8049f0:	78 0d                	js     8049ff <mmap_writeback+0x123>
+  8049f2:	49 89 dc             	mov    %rbx,%r12
+  8049f5:	e9 49 ff ff ff       	jmp    804943 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049ff:	48 83 c4 28          	add    $0x28,%rsp
+  804a03:	5b                   	pop    %rbx
+  804a04:	41 5c                	pop    %r12
+  804a06:	41 5d                	pop    %r13
+  804a08:	41 5e                	pop    %r14
+  804a0a:	41 5f                	pop    %r15
+  804a0c:	5d                   	pop    %rbp
+  804a0d:	c3                   	ret
+    return 0;
+  804a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a13:	eb ea                	jmp    8049ff <mmap_writeback+0x123>
+
+0000000000804a15 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a15:	55                   	push   %rbp
+  804a16:	48 89 e5             	mov    %rsp,%rbp
+  804a19:	41 57                	push   %r15
+  804a1b:	41 56                	push   %r14
+  804a1d:	41 55                	push   %r13
+  804a1f:	41 54                	push   %r12
+  804a21:	53                   	push   %rbx
+  804a22:	48 83 ec 38          	sub    $0x38,%rsp
+  804a26:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a2a:	48 85 f6             	test   %rsi,%rsi
+  804a2d:	0f 84 0c 02 00 00    	je     804c3f <mmap+0x22a>
+  804a33:	49 89 ff             	mov    %rdi,%r15
+  804a36:	49 89 f4             	mov    %rsi,%r12
+  804a39:	41 89 d5             	mov    %edx,%r13d
+  804a3c:	41 89 ce             	mov    %ecx,%r14d
+  804a3f:	44 89 cb             	mov    %r9d,%ebx
+  804a42:	45 85 c9             	test   %r9d,%r9d
+  804a45:	0f 88 f4 01 00 00    	js     804c3f <mmap+0x22a>
+  804a4b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a52:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a59:	0f 85 e7 01 00 00    	jne    804c46 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a5f:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a62:	83 fa 04             	cmp    $0x4,%edx
+  804a65:	0f 85 db 01 00 00    	jne    804c46 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a6b:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a6e:	83 fa 01             	cmp    $0x1,%edx
+  804a71:	0f 87 cf 01 00 00    	ja     804c46 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a77:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a7b:	44 89 c7             	mov    %r8d,%edi
+  804a7e:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  804a85:	00 00 00 
+  804a88:	ff d0                	call   *%rax
+  804a8a:	89 c2                	mov    %eax,%edx
+  804a8c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a93:	85 d2                	test   %edx,%edx
+  804a95:	0f 88 ab 01 00 00    	js     804c46 <mmap+0x231>
+  804a9b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a9f:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804aa6:	00 00 00 
+  804aa9:	8b 09                	mov    (%rcx),%ecx
+  804aab:	39 0a                	cmp    %ecx,(%rdx)
+  804aad:	0f 85 93 01 00 00    	jne    804c46 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804ab3:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ab6:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ab9:	83 fa 01             	cmp    $0x1,%edx
+  804abc:	0f 84 84 01 00 00    	je     804c46 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ac2:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ac6:	74 42                	je     804b0a <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ac8:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804acf:	4c 89 e6             	mov    %r12,%rsi
+  804ad2:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ad9:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804add:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ae1:	4d 85 ff             	test   %r15,%r15
+  804ae4:	74 67                	je     804b4d <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ae6:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804aed:	75 0f                	jne    804afe <mmap+0xe9>
+  804aef:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804af6:	00 00 00 
+  804af9:	49 39 c7             	cmp    %rax,%r15
+  804afc:	77 1b                	ja     804b19 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804afe:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b05:	e9 3c 01 00 00       	jmp    804c46 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b0a:	41 f6 c5 02          	test   $0x2,%r13b
+  804b0e:	74 b8                	je     804ac8 <mmap+0xb3>
+  804b10:	85 d2                	test   %edx,%edx
+  804b12:	75 b4                	jne    804ac8 <mmap+0xb3>
+  804b14:	e9 2d 01 00 00       	jmp    804c46 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b19:	4c 89 ff             	mov    %r15,%rdi
+  804b1c:	48 b8 83 46 80 00 00 	movabs $0x804683,%rax
+  804b23:	00 00 00 
+  804b26:	ff d0                	call   *%rax
+  804b28:	48 89 c2             	mov    %rax,%rdx
+  804b2b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b32:	49 39 d7             	cmp    %rdx,%r15
+  804b35:	0f 85 0b 01 00 00    	jne    804c46 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b3b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b42:	00 00 00 
+  804b45:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b4b:	eb 44                	jmp    804b91 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b4d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b51:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b58:	00 00 00 
+  804b5b:	48 b8 83 46 80 00 00 	movabs $0x804683,%rax
+  804b62:	00 00 00 
+  804b65:	ff d0                	call   *%rax
+  804b67:	48 89 c7             	mov    %rax,%rdi
+  804b6a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b6e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b75:	48 85 ff             	test   %rdi,%rdi
+  804b78:	75 c1                	jne    804b3b <mmap+0x126>
+  804b7a:	e9 c7 00 00 00       	jmp    804c46 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b7f:	49 83 c4 01          	add    $0x1,%r12
+  804b83:	48 83 c0 20          	add    $0x20,%rax
+  804b87:	49 83 fc 20          	cmp    $0x20,%r12
+  804b8b:	0f 84 a5 00 00 00    	je     804c36 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b91:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b95:	75 e8                	jne    804b7f <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b97:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b9b:	48 b8 cf 2d 80 00 00 	movabs $0x802dcf,%rax
+  804ba2:	00 00 00 
+  804ba5:	ff d0                	call   *%rax
+  804ba7:	89 c2                	mov    %eax,%edx
+  804ba9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bb0:	85 d2                	test   %edx,%edx
+  804bb2:	0f 88 8e 00 00 00    	js     804c46 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bb8:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bbc:	48 b8 a1 2d 80 00 00 	movabs $0x802da1,%rax
+  804bc3:	00 00 00 
+  804bc6:	ff d0                	call   *%rax
+  804bc8:	89 c6                	mov    %eax,%esi
+  804bca:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bcd:	48 b8 ef 2f 80 00 00 	movabs $0x802fef,%rax
+  804bd4:	00 00 00 
+  804bd7:	ff d0                	call   *%rax
+  804bd9:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bdc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804be3:	45 85 ff             	test   %r15d,%r15d
+  804be6:	78 5e                	js     804c46 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804be8:	49 c1 e4 05          	shl    $0x5,%r12
+  804bec:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bf3:	00 00 00 
+  804bf6:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bf9:	48 bf f4 46 80 00 00 	movabs $0x8046f4,%rdi
+  804c00:	00 00 00 
+  804c03:	48 b8 c2 51 80 00 00 	movabs $0x8051c2,%rax
+  804c0a:	00 00 00 
+  804c0d:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c0f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c13:	49 89 04 24          	mov    %rax,(%r12)
+  804c17:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c1b:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c20:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c25:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c2a:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c2f:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c34:	eb 10                	jmp    804c46 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c36:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c3d:	eb 07                	jmp    804c46 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c3f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c46:	48 83 c4 38          	add    $0x38,%rsp
+  804c4a:	5b                   	pop    %rbx
+  804c4b:	41 5c                	pop    %r12
+  804c4d:	41 5d                	pop    %r13
+  804c4f:	41 5e                	pop    %r14
+  804c51:	41 5f                	pop    %r15
+  804c53:	5d                   	pop    %rbp
+  804c54:	c3                   	ret
+
+0000000000804c55 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c55:	55                   	push   %rbp
+  804c56:	48 89 e5             	mov    %rsp,%rbp
+  804c59:	41 57                	push   %r15
+  804c5b:	41 56                	push   %r14
+  804c5d:	41 55                	push   %r13
+  804c5f:	41 54                	push   %r12
+  804c61:	53                   	push   %rbx
+  804c62:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c66:	49 89 fe             	mov    %rdi,%r14
+  804c69:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c70:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c77:	00 
+  804c78:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c7f:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c86:	00 00 00 
+  804c89:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c90:	49 bf dc 48 80 00 00 	movabs $0x8048dc,%r15
+  804c97:	00 00 00 
+  804c9a:	eb 09                	jmp    804ca5 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c9c:	48 83 c3 20          	add    $0x20,%rbx
+  804ca0:	4c 39 eb             	cmp    %r13,%rbx
+  804ca3:	74 33                	je     804cd8 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ca5:	48 89 df             	mov    %rbx,%rdi
+  804ca8:	48 8b 33             	mov    (%rbx),%rsi
+  804cab:	4c 39 e6             	cmp    %r12,%rsi
+  804cae:	73 ec                	jae    804c9c <msync+0x47>
+  804cb0:	48 85 f6             	test   %rsi,%rsi
+  804cb3:	74 e7                	je     804c9c <msync+0x47>
+  804cb5:	48 89 f2             	mov    %rsi,%rdx
+  804cb8:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cbc:	49 39 d6             	cmp    %rdx,%r14
+  804cbf:	73 db                	jae    804c9c <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cc1:	4c 39 e2             	cmp    %r12,%rdx
+  804cc4:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cc8:	4c 39 f6             	cmp    %r14,%rsi
+  804ccb:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ccf:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cd2:	85 c0                	test   %eax,%eax
+  804cd4:	79 c6                	jns    804c9c <msync+0x47>
+  804cd6:	eb 05                	jmp    804cdd <msync+0x88>
+    }
+
+    return 0;
+  804cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cdd:	48 83 c4 08          	add    $0x8,%rsp
+  804ce1:	5b                   	pop    %rbx
+  804ce2:	41 5c                	pop    %r12
+  804ce4:	41 5d                	pop    %r13
+  804ce6:	41 5e                	pop    %r14
+  804ce8:	41 5f                	pop    %r15
+  804cea:	5d                   	pop    %rbp
+  804ceb:	c3                   	ret
+
+0000000000804cec <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cec:	55                   	push   %rbp
+  804ced:	48 89 e5             	mov    %rsp,%rbp
+  804cf0:	41 57                	push   %r15
+  804cf2:	41 56                	push   %r14
+  804cf4:	41 55                	push   %r13
+  804cf6:	41 54                	push   %r12
+  804cf8:	53                   	push   %rbx
+  804cf9:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cfd:	49 89 ff             	mov    %rdi,%r15
+  804d00:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d07:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d0e:	00 
+  804d0f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d16:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d1d:	00 00 00 
+  804d20:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d27:	48 89 d8             	mov    %rbx,%rax
+  804d2a:	eb 09                	jmp    804d35 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d2c:	48 83 c0 20          	add    $0x20,%rax
+  804d30:	4c 39 f0             	cmp    %r14,%rax
+  804d33:	74 40                	je     804d75 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d35:	48 8b 10             	mov    (%rax),%rdx
+  804d38:	4c 39 e2             	cmp    %r12,%rdx
+  804d3b:	73 ef                	jae    804d2c <munmap+0x40>
+  804d3d:	48 85 d2             	test   %rdx,%rdx
+  804d40:	74 ea                	je     804d2c <munmap+0x40>
+  804d42:	48 89 d7             	mov    %rdx,%rdi
+  804d45:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d49:	49 39 ff             	cmp    %rdi,%r15
+  804d4c:	73 de                	jae    804d2c <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d4e:	49 39 fc             	cmp    %rdi,%r12
+  804d51:	72 05                	jb     804d58 <munmap+0x6c>
+  804d53:	4c 39 fa             	cmp    %r15,%rdx
+  804d56:	73 d4                	jae    804d2c <munmap+0x40>
+  804d58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d5d:	48 83 c4 08          	add    $0x8,%rsp
+  804d61:	5b                   	pop    %rbx
+  804d62:	41 5c                	pop    %r12
+  804d64:	41 5d                	pop    %r13
+  804d66:	41 5e                	pop    %r14
+  804d68:	41 5f                	pop    %r15
+  804d6a:	5d                   	pop    %rbp
+  804d6b:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d6c:	48 83 c3 20          	add    $0x20,%rbx
+  804d70:	4c 39 f3             	cmp    %r14,%rbx
+  804d73:	74 5c                	je     804dd1 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d75:	48 8b 33             	mov    (%rbx),%rsi
+  804d78:	4c 39 e6             	cmp    %r12,%rsi
+  804d7b:	73 ef                	jae    804d6c <munmap+0x80>
+  804d7d:	48 85 f6             	test   %rsi,%rsi
+  804d80:	74 ea                	je     804d6c <munmap+0x80>
+  804d82:	48 89 f2             	mov    %rsi,%rdx
+  804d85:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d89:	49 39 d7             	cmp    %rdx,%r15
+  804d8c:	73 de                	jae    804d6c <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d8e:	48 89 df             	mov    %rbx,%rdi
+  804d91:	48 b8 dc 48 80 00 00 	movabs $0x8048dc,%rax
+  804d98:	00 00 00 
+  804d9b:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d9d:	85 c0                	test   %eax,%eax
+  804d9f:	78 bc                	js     804d5d <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804da1:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804da5:	48 8b 33             	mov    (%rbx),%rsi
+  804da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dad:	48 b8 1b 28 80 00 00 	movabs $0x80281b,%rax
+  804db4:	00 00 00 
+  804db7:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804db9:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804dbc:	48 b8 94 2f 80 00 00 	movabs $0x802f94,%rax
+  804dc3:	00 00 00 
+  804dc6:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dc8:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dcf:	eb 9b                	jmp    804d6c <munmap+0x80>
+    return 0;
+  804dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd6:	eb 85                	jmp    804d5d <munmap+0x71>
+
+0000000000804dd8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ddd:	c3                   	ret
+
+0000000000804dde <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dde:	55                   	push   %rbp
+  804ddf:	48 89 e5             	mov    %rsp,%rbp
+  804de2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804de5:	48 be 25 63 80 00 00 	movabs $0x806325,%rsi
+  804dec:	00 00 00 
+  804def:	48 b8 de 1f 80 00 00 	movabs $0x801fde,%rax
+  804df6:	00 00 00 
+  804df9:	ff d0                	call   *%rax
+    return 0;
+}
+  804dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e00:	5d                   	pop    %rbp
+  804e01:	c3                   	ret
+
+0000000000804e02 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e02:	55                   	push   %rbp
+  804e03:	48 89 e5             	mov    %rsp,%rbp
+  804e06:	41 57                	push   %r15
+  804e08:	41 56                	push   %r14
+  804e0a:	41 55                	push   %r13
+  804e0c:	41 54                	push   %r12
+  804e0e:	53                   	push   %rbx
+  804e0f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e16:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e1d:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e24:	00 00 00 00 
+  804e28:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e2f:	00 00 00 00 
+  804e33:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e3a:	00 00 00 00 
+  804e3e:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e45:	00 00 00 00 
+  804e49:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e50:	00 00 00 00 
+  804e54:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e5b:	00 00 00 00 
+  804e5f:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e66:	00 
+  804e67:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e6e:	00 
+  804e6f:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e76:	00 
+  804e77:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e7e:	00 
+  804e7f:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e86:	00 
+  804e87:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e8e:	00 
+  804e8f:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e96:	00 
+  804e97:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e9e:	00 
+  804e9f:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804ea6:	00 
+  804ea7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804eae:	00 
+    for (res = 0; res < n; res += inc) {
+  804eaf:	48 85 d2             	test   %rdx,%rdx
+  804eb2:	74 7a                	je     804f2e <devcons_write+0x12c>
+  804eb4:	49 89 d6             	mov    %rdx,%r14
+  804eb7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ebd:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ec2:	49 bf 2e 23 80 00 00 	movabs $0x80232e,%r15
+  804ec9:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ecc:	4c 89 f3             	mov    %r14,%rbx
+  804ecf:	48 29 f3             	sub    %rsi,%rbx
+  804ed2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ed7:	48 39 c3             	cmp    %rax,%rbx
+  804eda:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ede:	4c 63 eb             	movslq %ebx,%r13
+  804ee1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ee8:	48 01 c6             	add    %rax,%rsi
+  804eeb:	4c 89 ea             	mov    %r13,%rdx
+  804eee:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ef5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ef8:	4c 89 ee             	mov    %r13,%rsi
+  804efb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f02:	48 b8 5b 25 80 00 00 	movabs $0x80255b,%rax
+  804f09:	00 00 00 
+  804f0c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f0e:	41 01 dc             	add    %ebx,%r12d
+  804f11:	49 63 f4             	movslq %r12d,%rsi
+  804f14:	4c 39 f6             	cmp    %r14,%rsi
+  804f17:	72 b3                	jb     804ecc <devcons_write+0xca>
+    return res;
+  804f19:	49 63 c4             	movslq %r12d,%rax
+}
+  804f1c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f23:	5b                   	pop    %rbx
+  804f24:	41 5c                	pop    %r12
+  804f26:	41 5d                	pop    %r13
+  804f28:	41 5e                	pop    %r14
+  804f2a:	41 5f                	pop    %r15
+  804f2c:	5d                   	pop    %rbp
+  804f2d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f2e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f34:	eb e3                	jmp    804f19 <devcons_write+0x117>
+
+0000000000804f36 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f36:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f39:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f3e:	48 85 c0             	test   %rax,%rax
+  804f41:	74 55                	je     804f98 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f43:	55                   	push   %rbp
+  804f44:	48 89 e5             	mov    %rsp,%rbp
+  804f47:	41 55                	push   %r13
+  804f49:	41 54                	push   %r12
+  804f4b:	53                   	push   %rbx
+  804f4c:	48 83 ec 08          	sub    $0x8,%rsp
+  804f50:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f53:	48 bb 8e 25 80 00 00 	movabs $0x80258e,%rbx
+  804f5a:	00 00 00 
+  804f5d:	49 bc a2 26 80 00 00 	movabs $0x8026a2,%r12
+  804f64:	00 00 00 
+  804f67:	eb 03                	jmp    804f6c <devcons_read+0x36>
+  804f69:	41 ff d4             	call   *%r12
+  804f6c:	ff d3                	call   *%rbx
+  804f6e:	85 c0                	test   %eax,%eax
+  804f70:	74 f7                	je     804f69 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f72:	48 63 d0             	movslq %eax,%rdx
+  804f75:	78 13                	js     804f8a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f77:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f7c:	83 f8 04             	cmp    $0x4,%eax
+  804f7f:	74 09                	je     804f8a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f81:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f85:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f8a:	48 89 d0             	mov    %rdx,%rax
+  804f8d:	48 83 c4 08          	add    $0x8,%rsp
+  804f91:	5b                   	pop    %rbx
+  804f92:	41 5c                	pop    %r12
+  804f94:	41 5d                	pop    %r13
+  804f96:	5d                   	pop    %rbp
+  804f97:	c3                   	ret
+  804f98:	48 89 d0             	mov    %rdx,%rax
+  804f9b:	c3                   	ret
+
+0000000000804f9c <cputchar>:
+cputchar(int ch) {
+  804f9c:	55                   	push   %rbp
+  804f9d:	48 89 e5             	mov    %rsp,%rbp
+  804fa0:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804fa4:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fa8:	be 01 00 00 00       	mov    $0x1,%esi
+  804fad:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fb1:	48 b8 5b 25 80 00 00 	movabs $0x80255b,%rax
+  804fb8:	00 00 00 
+  804fbb:	ff d0                	call   *%rax
+}
+  804fbd:	c9                   	leave
+  804fbe:	c3                   	ret
+
+0000000000804fbf <getchar>:
+getchar(void) {
+  804fbf:	55                   	push   %rbp
+  804fc0:	48 89 e5             	mov    %rsp,%rbp
+  804fc3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fc7:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fcc:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fd5:	48 b8 12 31 80 00 00 	movabs $0x803112,%rax
+  804fdc:	00 00 00 
+  804fdf:	ff d0                	call   *%rax
+  804fe1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fe3:	85 c0                	test   %eax,%eax
+  804fe5:	78 06                	js     804fed <getchar+0x2e>
+  804fe7:	74 08                	je     804ff1 <getchar+0x32>
+  804fe9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fed:	89 d0                	mov    %edx,%eax
+  804fef:	c9                   	leave
+  804ff0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804ff1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804ff6:	eb f5                	jmp    804fed <getchar+0x2e>
+
+0000000000804ff8 <iscons>:
+iscons(int fdnum) {
+  804ff8:	55                   	push   %rbp
+  804ff9:	48 89 e5             	mov    %rsp,%rbp
+  804ffc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805000:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805004:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  80500b:	00 00 00 
+  80500e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805010:	85 c0                	test   %eax,%eax
+  805012:	78 18                	js     80502c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805014:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805018:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80501f:	00 00 00 
+  805022:	8b 00                	mov    (%rax),%eax
+  805024:	39 02                	cmp    %eax,(%rdx)
+  805026:	0f 94 c0             	sete   %al
+  805029:	0f b6 c0             	movzbl %al,%eax
+}
+  80502c:	c9                   	leave
+  80502d:	c3                   	ret
+
+000000000080502e <opencons>:
+opencons(void) {
+  80502e:	55                   	push   %rbp
+  80502f:	48 89 e5             	mov    %rsp,%rbp
+  805032:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805036:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80503a:	48 b8 cf 2d 80 00 00 	movabs $0x802dcf,%rax
+  805041:	00 00 00 
+  805044:	ff d0                	call   *%rax
+  805046:	85 c0                	test   %eax,%eax
+  805048:	78 49                	js     805093 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80504a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80504f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805054:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805058:	bf 00 00 00 00       	mov    $0x0,%edi
+  80505d:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  805064:	00 00 00 
+  805067:	ff d0                	call   *%rax
+  805069:	85 c0                	test   %eax,%eax
+  80506b:	78 26                	js     805093 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80506d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805071:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805078:	00 00 
+  80507a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80507c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805080:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805087:	48 b8 a1 2d 80 00 00 	movabs $0x802da1,%rax
+  80508e:	00 00 00 
+  805091:	ff d0                	call   *%rax
+}
+  805093:	c9                   	leave
+  805094:	c3                   	ret
+
+0000000000805095 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805095:	55                   	push   %rbp
+  805096:	48 89 e5             	mov    %rsp,%rbp
+  805099:	41 56                	push   %r14
+  80509b:	41 55                	push   %r13
+  80509d:	41 54                	push   %r12
+  80509f:	53                   	push   %rbx
+  8050a0:	48 83 ec 50          	sub    $0x50,%rsp
+  8050a4:	49 89 fc             	mov    %rdi,%r12
+  8050a7:	41 89 f5             	mov    %esi,%r13d
+  8050aa:	48 89 d3             	mov    %rdx,%rbx
+  8050ad:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050b1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050b5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050b9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050c4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050c8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050cc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050d0:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050d7:	00 00 00 
+  8050da:	4c 8b 30             	mov    (%rax),%r14
+  8050dd:	48 b8 6b 26 80 00 00 	movabs $0x80266b,%rax
+  8050e4:	00 00 00 
+  8050e7:	ff d0                	call   *%rax
+  8050e9:	89 c6                	mov    %eax,%esi
+  8050eb:	45 89 e8             	mov    %r13d,%r8d
+  8050ee:	4c 89 e1             	mov    %r12,%rcx
+  8050f1:	4c 89 f2             	mov    %r14,%rdx
+  8050f4:	48 bf 38 63 80 00 00 	movabs $0x806338,%rdi
+  8050fb:	00 00 00 
+  8050fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805103:	49 bc a7 16 80 00 00 	movabs $0x8016a7,%r12
+  80510a:	00 00 00 
+  80510d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805110:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805114:	48 89 df             	mov    %rbx,%rdi
+  805117:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  80511e:	00 00 00 
+  805121:	ff d0                	call   *%rax
+    cprintf("\n");
+  805123:	48 bf 13 62 80 00 00 	movabs $0x806213,%rdi
+  80512a:	00 00 00 
+  80512d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805132:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805135:	cc                   	int3
+  805136:	eb fd                	jmp    805135 <_panic+0xa0>
+
+0000000000805138 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805138:	55                   	push   %rbp
+  805139:	48 89 e5             	mov    %rsp,%rbp
+  80513c:	41 56                	push   %r14
+  80513e:	41 55                	push   %r13
+  805140:	41 54                	push   %r12
+  805142:	53                   	push   %rbx
+  805143:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805146:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80514d:	00 00 00 
+  805150:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805154:	74 27                	je     80517d <_handle_vectored_pagefault+0x45>
+  805156:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80515b:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805162:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805165:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805168:	4c 89 e7             	mov    %r12,%rdi
+  80516b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805170:	84 c0                	test   %al,%al
+  805172:	75 45                	jne    8051b9 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805174:	48 83 c3 01          	add    $0x1,%rbx
+  805178:	49 3b 1e             	cmp    (%r14),%rbx
+  80517b:	72 eb                	jb     805168 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80517d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805184:	00 
+  805185:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80518a:	4d 8b 04 24          	mov    (%r12),%r8
+  80518e:	48 ba 60 63 80 00 00 	movabs $0x806360,%rdx
+  805195:	00 00 00 
+  805198:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80519d:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  8051a4:	00 00 00 
+  8051a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ac:	49 ba 95 50 80 00 00 	movabs $0x805095,%r10
+  8051b3:	00 00 00 
+  8051b6:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051b9:	5b                   	pop    %rbx
+  8051ba:	41 5c                	pop    %r12
+  8051bc:	41 5d                	pop    %r13
+  8051be:	41 5e                	pop    %r14
+  8051c0:	5d                   	pop    %rbp
+  8051c1:	c3                   	ret
+
+00000000008051c2 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051c2:	55                   	push   %rbp
+  8051c3:	48 89 e5             	mov    %rsp,%rbp
+  8051c6:	53                   	push   %rbx
+  8051c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8051cb:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051ce:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051d3:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051da:	00 00 00 
+  8051dd:	80 38 00             	cmpb   $0x0,(%rax)
+  8051e0:	74 68                	je     80524a <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051e2:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051e9:	00 00 00 
+  8051ec:	48 8b 08             	mov    (%rax),%rcx
+  8051ef:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051f4:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051fb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051fe:	48 85 c9             	test   %rcx,%rcx
+  805201:	0f 84 e0 00 00 00    	je     8052e7 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805207:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80520b:	0f 84 c9 00 00 00    	je     8052da <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805211:	48 83 c2 01          	add    $0x1,%rdx
+  805215:	48 39 ca             	cmp    %rcx,%rdx
+  805218:	75 ed                	jne    805207 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80521a:	48 83 f9 08          	cmp    $0x8,%rcx
+  80521e:	0f 84 84 00 00 00    	je     8052a8 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805224:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805228:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80522f:	00 00 00 
+  805232:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805239:	00 00 00 
+  80523c:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805240:	85 f6                	test   %esi,%esi
+  805242:	0f 89 97 00 00 00    	jns    8052df <add_pgfault_handler+0x11d>
+  805248:	eb 63                	jmp    8052ad <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80524a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80524f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805254:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80525b:	00 00 00 
+  80525e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805263:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  80526a:	00 00 00 
+  80526d:	ff d0                	call   *%rax
+  80526f:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805271:	85 c0                	test   %eax,%eax
+  805273:	78 38                	js     8052ad <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805275:	48 be c3 53 80 00 00 	movabs $0x8053c3,%rsi
+  80527c:	00 00 00 
+  80527f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805284:	48 b8 66 29 80 00 00 	movabs $0x802966,%rax
+  80528b:	00 00 00 
+  80528e:	ff d0                	call   *%rax
+  805290:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805292:	85 c0                	test   %eax,%eax
+  805294:	78 17                	js     8052ad <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805296:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80529d:	00 00 00 
+  8052a0:	c6 00 01             	movb   $0x1,(%rax)
+  8052a3:	e9 3a ff ff ff       	jmp    8051e2 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052a8:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052ad:	89 f1                	mov    %esi,%ecx
+  8052af:	48 ba 9e 63 80 00 00 	movabs $0x80639e,%rdx
+  8052b6:	00 00 00 
+  8052b9:	be 42 00 00 00       	mov    $0x42,%esi
+  8052be:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  8052c5:	00 00 00 
+  8052c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052cd:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  8052d4:	00 00 00 
+  8052d7:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052da:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052df:	89 f0                	mov    %esi,%eax
+  8052e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052e5:	c9                   	leave
+  8052e6:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052e7:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052ee:	00 00 00 
+  8052f1:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052f8:	48 89 d8             	mov    %rbx,%rax
+  8052fb:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805302:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805305:	eb d8                	jmp    8052df <add_pgfault_handler+0x11d>
+
+0000000000805307 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805307:	55                   	push   %rbp
+  805308:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80530b:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805312:	00 00 00 
+  805315:	80 38 00             	cmpb   $0x0,(%rax)
+  805318:	74 33                	je     80534d <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80531a:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805321:	00 00 00 
+  805324:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805329:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805330:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805333:	48 85 c0             	test   %rax,%rax
+  805336:	0f 84 85 00 00 00    	je     8053c1 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80533c:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805340:	74 40                	je     805382 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805342:	48 83 c1 01          	add    $0x1,%rcx
+  805346:	48 39 c1             	cmp    %rax,%rcx
+  805349:	75 f1                	jne    80533c <remove_pgfault_handler+0x35>
+  80534b:	eb 74                	jmp    8053c1 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80534d:	48 b9 b6 63 80 00 00 	movabs $0x8063b6,%rcx
+  805354:	00 00 00 
+  805357:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80535e:	00 00 00 
+  805361:	be 48 00 00 00       	mov    $0x48,%esi
+  805366:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  80536d:	00 00 00 
+  805370:	b8 00 00 00 00       	mov    $0x0,%eax
+  805375:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  80537c:	00 00 00 
+  80537f:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805382:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805389:	00 
+  80538a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80538e:	48 29 ca             	sub    %rcx,%rdx
+  805391:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805398:	00 00 00 
+  80539b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80539f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053a4:	48 89 ce             	mov    %rcx,%rsi
+  8053a7:	48 b8 2e 23 80 00 00 	movabs $0x80232e,%rax
+  8053ae:	00 00 00 
+  8053b1:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053b3:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053ba:	00 00 00 
+  8053bd:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053c1:	5d                   	pop    %rbp
+  8053c2:	c3                   	ret
+
+00000000008053c3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053c3:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053c6:	48 b8 38 51 80 00 00 	movabs $0x805138,%rax
+  8053cd:	00 00 00 
+    call *%rax
+  8053d0:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053d2:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053d9:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053da:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053e1:	00 
+    subq $8, %rcx
+  8053e2:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053e6:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053e9:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053f0:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053f1:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053f5:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053f9:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053fe:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805403:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805408:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80540d:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805412:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805417:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80541c:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805421:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805426:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80542b:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805430:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805435:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80543a:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80543f:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805443:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805447:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805448:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805449:	c3                   	ret
+
+000000000080544a <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80544a:	85 ff                	test   %edi,%edi
+  80544c:	78 58                	js     8054a6 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80544e:	48 85 f6             	test   %rsi,%rsi
+  805451:	74 12                	je     805465 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805453:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80545a:	00 00 00 
+  80545d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805463:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805465:	48 85 c9             	test   %rcx,%rcx
+  805468:	74 12                	je     80547c <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80546a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805471:	00 00 00 
+  805474:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80547a:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80547c:	48 85 d2             	test   %rdx,%rdx
+  80547f:	74 14                	je     805495 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805481:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805488:	00 00 00 
+  80548b:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805492:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805495:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80549c:	00 00 00 
+  80549f:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054a5:	c3                   	ret
+        if (from_env_store) {
+  8054a6:	48 85 f6             	test   %rsi,%rsi
+  8054a9:	74 06                	je     8054b1 <ipc_result+0x67>
+            *from_env_store = 0;
+  8054ab:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054b1:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054b3:	48 85 c9             	test   %rcx,%rcx
+  8054b6:	74 ed                	je     8054a5 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054b8:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054be:	c3                   	ret
+
+00000000008054bf <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054bf:	55                   	push   %rbp
+  8054c0:	48 89 e5             	mov    %rsp,%rbp
+  8054c3:	41 55                	push   %r13
+  8054c5:	41 54                	push   %r12
+  8054c7:	53                   	push   %rbx
+  8054c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8054cc:	49 89 fc             	mov    %rdi,%r12
+  8054cf:	48 89 f7             	mov    %rsi,%rdi
+  8054d2:	48 89 d3             	mov    %rdx,%rbx
+  8054d5:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054d8:	48 85 f6             	test   %rsi,%rsi
+  8054db:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054e2:	00 00 00 
+  8054e5:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8054ee:	48 85 d2             	test   %rdx,%rdx
+  8054f1:	74 03                	je     8054f6 <ipc_recv+0x37>
+  8054f3:	48 8b 32             	mov    (%rdx),%rsi
+  8054f6:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  8054fd:	00 00 00 
+  805500:	ff d0                	call   *%rax
+  805502:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805504:	4c 89 e9             	mov    %r13,%rcx
+  805507:	48 89 da             	mov    %rbx,%rdx
+  80550a:	4c 89 e6             	mov    %r12,%rsi
+  80550d:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  805514:	00 00 00 
+  805517:	ff d0                	call   *%rax
+}
+  805519:	48 83 c4 08          	add    $0x8,%rsp
+  80551d:	5b                   	pop    %rbx
+  80551e:	41 5c                	pop    %r12
+  805520:	41 5d                	pop    %r13
+  805522:	5d                   	pop    %rbp
+  805523:	c3                   	ret
+
+0000000000805524 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805524:	55                   	push   %rbp
+  805525:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805528:	48 85 d2             	test   %rdx,%rdx
+  80552b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805532:	00 00 00 
+  805535:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805539:	89 f6                	mov    %esi,%esi
+  80553b:	48 b8 1b 2b 80 00 00 	movabs $0x802b1b,%rax
+  805542:	00 00 00 
+  805545:	ff d0                	call   *%rax
+    if (res < 0) {
+  805547:	85 c0                	test   %eax,%eax
+  805549:	78 02                	js     80554d <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80554b:	5d                   	pop    %rbp
+  80554c:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80554d:	89 c1                	mov    %eax,%ecx
+  80554f:	48 ba d0 63 80 00 00 	movabs $0x8063d0,%rdx
+  805556:	00 00 00 
+  805559:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80555e:	48 bf dd 63 80 00 00 	movabs $0x8063dd,%rdi
+  805565:	00 00 00 
+  805568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80556d:	49 b8 95 50 80 00 00 	movabs $0x805095,%r8
+  805574:	00 00 00 
+  805577:	41 ff d0             	call   *%r8
+
+000000000080557a <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80557a:	55                   	push   %rbp
+  80557b:	48 89 e5             	mov    %rsp,%rbp
+  80557e:	53                   	push   %rbx
+  80557f:	48 83 ec 08          	sub    $0x8,%rsp
+  805583:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805587:	48 85 d2             	test   %rdx,%rdx
+  80558a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805591:	00 00 00 
+  805594:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805598:	4d 85 c9             	test   %r9,%r9
+  80559b:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80559f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055a4:	48 85 db             	test   %rbx,%rbx
+  8055a7:	74 03                	je     8055ac <ipc_call+0x32>
+  8055a9:	48 8b 03             	mov    (%rbx),%rax
+  8055ac:	89 f6                	mov    %esi,%esi
+  8055ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8055b2:	50                   	push   %rax
+  8055b3:	48 b8 4d 2b 80 00 00 	movabs $0x802b4d,%rax
+  8055ba:	00 00 00 
+  8055bd:	ff d0                	call   *%rax
+  8055bf:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055c1:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055c5:	48 89 da             	mov    %rbx,%rdx
+  8055c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8055cd:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  8055d4:	00 00 00 
+  8055d7:	ff d0                	call   *%rax
+}
+  8055d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055dd:	c9                   	leave
+  8055de:	c3                   	ret
+
+00000000008055df <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055df:	55                   	push   %rbp
+  8055e0:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055e3:	89 f6                	mov    %esi,%esi
+  8055e5:	48 b8 b9 2b 80 00 00 	movabs $0x802bb9,%rax
+  8055ec:	00 00 00 
+  8055ef:	ff d0                	call   *%rax
+  8055f1:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055fd:	be 00 00 00 00       	mov    $0x0,%esi
+  805602:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  805609:	00 00 00 
+  80560c:	ff d0                	call   *%rax
+}
+  80560e:	5d                   	pop    %rbp
+  80560f:	c3                   	ret
+
+0000000000805610 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805610:	55                   	push   %rbp
+  805611:	48 89 e5             	mov    %rsp,%rbp
+  805614:	41 54                	push   %r12
+  805616:	53                   	push   %rbx
+  805617:	4c 89 cb             	mov    %r9,%rbx
+  80561a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80561e:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805622:	48 85 d2             	test   %rdx,%rdx
+  805625:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80562c:	00 00 00 
+  80562f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805633:	4d 85 c9             	test   %r9,%r9
+  805636:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80563a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80563f:	4d 85 e4             	test   %r12,%r12
+  805642:	74 04                	je     805648 <ipc_reply_wait+0x38>
+  805644:	49 8b 04 24          	mov    (%r12),%rax
+  805648:	89 f6                	mov    %esi,%esi
+  80564a:	48 83 ec 08          	sub    $0x8,%rsp
+  80564e:	50                   	push   %rax
+  80564f:	48 b8 23 2c 80 00 00 	movabs $0x802c23,%rax
+  805656:	00 00 00 
+  805659:	ff d0                	call   *%rax
+  80565b:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80565d:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805661:	4c 89 e2             	mov    %r12,%rdx
+  805664:	48 89 de             	mov    %rbx,%rsi
+  805667:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  80566e:	00 00 00 
+  805671:	ff d0                	call   *%rax
+}
+  805673:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805677:	5b                   	pop    %rbx
+  805678:	41 5c                	pop    %r12
+  80567a:	5d                   	pop    %rbp
+  80567b:	c3                   	ret
+
+000000000080567c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80567c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805681:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805688:	00 00 00 
+  80568b:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805692:	48 01 ca             	add    %rcx,%rdx
+  805695:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80569b:	39 fa                	cmp    %edi,%edx
+  80569d:	74 12                	je     8056b1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80569f:	48 83 c0 01          	add    $0x1,%rax
+  8056a3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056a9:	75 e0                	jne    80568b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056b0:	c3                   	ret
+            return envs[i].env_id;
+  8056b1:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056b8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056bf:	00 00 00 
+  8056c2:	48 01 d0             	add    %rdx,%rax
+  8056c5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056cb:	c3                   	ret
+  8056cc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008056d0 <__rodata_start>:
+  8056d0:	77 00                	ja     8056d2 <__rodata_start+0x2>
+  8056d2:	72 62                	jb     805736 <__rodata_start+0x66>
+  8056d4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056d7:	00 0f                	add    %cl,(%rdi)
+  8056d9:	1f                   	(bad)
+  8056da:	84 00                	test   %al,(%rax)
+  8056dc:	00 00                	add    %al,(%rax)
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 66 0f 1f 44 00 00 49 20 72 65 61 64 20 25     ..f..D..I read %
+  805c30:	30 38 78 20 66 72 6f 6d 20 6c 6f 63 61 74 69 6f     08x from locatio
+  805c40:	6e 20 30 78 38 30 34 30 30 30 30 30 30 30 21 0a     n 0x8040000000!.
+  805c50:	00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34     .<unknown>.01234
+  805c60:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  805c70:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  805c80:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  805c90:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  805ca0:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  805cb0:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  805cc0:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  805cd0:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  805ce0:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  805cf0:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  805d00:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  805d10:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  805d20:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  805d30:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  805d40:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  805d50:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  805d60:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  805d70:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  805d80:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  805d90:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  805da0:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  805db0:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  805dc0:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  805dd0:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  805de0:	73 75 70 70 6f 72 74 65 64 00 66 2e 0f 1f 84 00     supported.f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  805e00:	9f 18 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805e10:	e6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805e20:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805e30:	f6 1e 80 00 00 00 00 00 be 18 80 00 00 00 00 00     ................
+  805e40:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805e50:	b2 18 80 00 00 00 00 00 2c 19 80 00 00 00 00 00     ........,.......
+  805e60:	f6 1e 80 00 00 00 00 00 b2 18 80 00 00 00 00 00     ................
+  805e70:	f8 18 80 00 00 00 00 00 f8 18 80 00 00 00 00 00     ................
+  805e80:	f8 18 80 00 00 00 00 00 f8 18 80 00 00 00 00 00     ................
+  805e90:	f8 18 80 00 00 00 00 00 f8 18 80 00 00 00 00 00     ................
+  805ea0:	f8 18 80 00 00 00 00 00 f8 18 80 00 00 00 00 00     ................
+  805eb0:	f8 18 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805ec0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805ed0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805ee0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805ef0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f00:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f10:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f20:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f30:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f40:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f50:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f60:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f70:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f80:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805f90:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805fa0:	f6 1e 80 00 00 00 00 00 14 1e 80 00 00 00 00 00     ................
+  805fb0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805fc0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805fd0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805fe0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  805ff0:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  806000:	5a 19 80 00 00 00 00 00 29 1b 80 00 00 00 00 00     Z.......).......
+  806010:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  806020:	f6 1e 80 00 00 00 00 00 4f 19 80 00 00 00 00 00     ........O.......
+  806030:	89 19 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  806040:	f6 1e 80 00 00 00 00 00 44 19 80 00 00 00 00 00     ........D.......
+  806050:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  806060:	d2 1c 80 00 00 00 00 00 a1 1d 80 00 00 00 00 00     ................
+  806070:	f6 1e 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  806080:	20 1a 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00      ...............
+  806090:	fd 1b 80 00 00 00 00 00 f6 1e 80 00 00 00 00 00     ................
+  8060a0:	f6 1e 80 00 00 00 00 00 14 1e 80 00 00 00 00 00     ................
+  8060b0:	f6 1e 80 00 00 00 00 00 a8 18 80 00 00 00 00 00     ................
+
+00000000008060c0 <error_string>:
+	...
+  8060c8:	8d 5c 80 00 00 00 00 00 9f 5c 80 00 00 00 00 00     .\.......\......
+  8060d8:	af 5c 80 00 00 00 00 00 c1 5c 80 00 00 00 00 00     .\.......\......
+  8060e8:	cf 5c 80 00 00 00 00 00 e3 5c 80 00 00 00 00 00     .\.......\......
+  8060f8:	f8 5c 80 00 00 00 00 00 0b 5d 80 00 00 00 00 00     .\.......]......
+  806108:	1d 5d 80 00 00 00 00 00 31 5d 80 00 00 00 00 00     .]......1]......
+  806118:	41 5d 80 00 00 00 00 00 54 5d 80 00 00 00 00 00     A]......T]......
+  806128:	6b 5d 80 00 00 00 00 00 81 5d 80 00 00 00 00 00     k].......]......
+  806138:	99 5d 80 00 00 00 00 00 b1 5d 80 00 00 00 00 00     .].......]......
+  806148:	be 5d 80 00 00 00 00 00 60 61 80 00 00 00 00 00     .]......`a......
+  806158:	d2 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806168:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806178:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806188:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806198:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8061a8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8061b8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8061c8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8061d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806208:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806218:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806228:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806238:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806240 <devtab>:
+  806240:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806250:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806260:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806270:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806280:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806290:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8062a0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8062b0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8062c0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8062d0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062e0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062f0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806300:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806310:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806320:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806330:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806340:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806350:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806360:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806370:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806380:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806390:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8063a0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8063b0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8063c0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8063d0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063e0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806400:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806410:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806420:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806430:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806440:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806450:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806460:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806470:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806480:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806490:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
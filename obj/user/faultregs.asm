@@ -0,0 +1,11189 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 ce 2c 80 00 00 	movabs $0x802cce,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 81 42 80 00 00 	movabs $0x804281,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 ce 2c 80 00 00 	movabs $0x802cce,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 81 42 80 00 00 	movabs $0x804281,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 71 23 80 00 00 	movabs $0x802371,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 57 4c 80 00 00 	movabs $0x804c57,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 3e 2c 80 00 00 	movabs $0x802c3e,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 57 4c 80 00 00 	movabs $0x804c57,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 3e 2c 80 00 00 	movabs $0x802c3e,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 62 22 80 00 00 	movabs $0x802262,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 67 6a 80 00 00 	movabs $0x806a67,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 ce 2d 80 00 00 	movabs $0x802dce,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 58 63 80 00 00 	movabs $0x806358,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 ce 2d 80 00 00 	movabs $0x802dce,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 5a 63 80 00 00 	movabs $0x80635a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 ce 2d 80 00 00 	movabs $0x802dce,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 5d 63 80 00 00 	movabs $0x80635d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 ce 2d 80 00 00 	movabs $0x802dce,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 55 5a 80 00 00 	movabs $0x805a55,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 2c 5d 80 00 00 	movabs $0x805d2c,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 6b 43 80 00 00 	movabs $0x80436b,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 34 44 80 00 00 	movabs $0x804434,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 3a 43 80 00 00 	movabs $0x80433a,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 3a 43 80 00 00 	movabs $0x80433a,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 52 41 80 00 00 	movabs $0x804152,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 81 42 80 00 00 	movabs $0x804281,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 ce 2c 80 00 00 	movabs $0x802cce,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 7b 2f 80 00 00 	movabs $0x802f7b,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 60 63 80 00 00 	movabs $0x806360,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 7b 2f 80 00 00 	movabs $0x802f7b,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 7b 2f 80 00 00 	movabs $0x802f7b,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 00 66 80 00 00 	movabs $0x806600,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 7b 2f 80 00 00 	movabs $0x802f7b,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 7b 2f 80 00 00 	movabs $0x802f7b,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 80 68 80 00 00 	movabs $0x806880,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 80 68 80 00 00 	movabs $0x806880,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 d3 31 80 00 00 	movabs $0x8031d3,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 d3 31 80 00 00 	movabs $0x8031d3,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 ba 0c 00 00       	call   8021b9 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 08          	sub    $0x8,%rsp
+  801512:	49 89 fc             	mov    %rdi,%r12
+  801515:	48 89 d3             	mov    %rdx,%rbx
+  801518:	4d 89 c6             	mov    %r8,%r14
+    int mismatch = 0;
+
+    cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80151b:	48 89 f2             	mov    %rsi,%rdx
+  80151e:	48 be d5 68 80 00 00 	movabs $0x8068d5,%rsi
+  801525:	00 00 00 
+  801528:	48 bf a2 68 80 00 00 	movabs $0x8068a2,%rdi
+  80152f:	00 00 00 
+  801532:	b8 00 00 00 00       	mov    $0x0,%eax
+  801537:	49 bd d5 23 80 00 00 	movabs $0x8023d5,%r13
+  80153e:	00 00 00 
+  801541:	41 ff d5             	call   *%r13
+            cprintf("MISMATCH\n");                                                             \
+            mismatch = 1;                                                                      \
+        }                                                                                      \
+    } while (0)
+
+    CHECK(r14, regs.reg_r14);
+  801544:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  801548:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  80154d:	48 be b2 68 80 00 00 	movabs $0x8068b2,%rsi
+  801554:	00 00 00 
+  801557:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  80155e:	00 00 00 
+  801561:	b8 00 00 00 00       	mov    $0x0,%eax
+  801566:	41 ff d5             	call   *%r13
+  801569:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  80156d:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  801572:	0f 84 48 06 00 00    	je     801bc0 <check_regs+0x6bf>
+  801578:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  80157f:	00 00 00 
+  801582:	b8 00 00 00 00       	mov    $0x0,%eax
+  801587:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  80158e:	00 00 00 
+  801591:	ff d2                	call   *%rdx
+  801593:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r13, regs.reg_r13);
+  801599:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  80159d:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  8015a2:	48 be d6 68 80 00 00 	movabs $0x8068d6,%rsi
+  8015a9:	00 00 00 
+  8015ac:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  8015b3:	00 00 00 
+  8015b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bb:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  8015c2:	00 00 00 
+  8015c5:	41 ff d0             	call   *%r8
+  8015c8:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8015cc:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  8015d1:	0f 84 06 06 00 00    	je     801bdd <check_regs+0x6dc>
+  8015d7:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  8015de:	00 00 00 
+  8015e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e6:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  8015ed:	00 00 00 
+  8015f0:	ff d2                	call   *%rdx
+  8015f2:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r12, regs.reg_r12);
+  8015f8:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  8015fc:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  801601:	48 be da 68 80 00 00 	movabs $0x8068da,%rsi
+  801608:	00 00 00 
+  80160b:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801612:	00 00 00 
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161a:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  801621:	00 00 00 
+  801624:	41 ff d0             	call   *%r8
+  801627:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  80162b:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  801630:	0f 84 c7 05 00 00    	je     801bfd <check_regs+0x6fc>
+  801636:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  80163d:	00 00 00 
+  801640:	b8 00 00 00 00       	mov    $0x0,%eax
+  801645:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  80164c:	00 00 00 
+  80164f:	ff d2                	call   *%rdx
+  801651:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r11, regs.reg_r11);
+  801657:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  80165b:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  801660:	48 be de 68 80 00 00 	movabs $0x8068de,%rsi
+  801667:	00 00 00 
+  80166a:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801671:	00 00 00 
+  801674:	b8 00 00 00 00       	mov    $0x0,%eax
+  801679:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  801680:	00 00 00 
+  801683:	41 ff d0             	call   *%r8
+  801686:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80168a:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  80168f:	0f 84 88 05 00 00    	je     801c1d <check_regs+0x71c>
+  801695:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  80169c:	00 00 00 
+  80169f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a4:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  8016ab:	00 00 00 
+  8016ae:	ff d2                	call   *%rdx
+  8016b0:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r10, regs.reg_r10);
+  8016b6:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  8016ba:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8016bf:	48 be e2 68 80 00 00 	movabs $0x8068e2,%rsi
+  8016c6:	00 00 00 
+  8016c9:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  8016d0:	00 00 00 
+  8016d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d8:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  8016df:	00 00 00 
+  8016e2:	41 ff d0             	call   *%r8
+  8016e5:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  8016e9:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  8016ee:	0f 84 49 05 00 00    	je     801c3d <check_regs+0x73c>
+  8016f4:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  8016fb:	00 00 00 
+  8016fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801703:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  80170a:	00 00 00 
+  80170d:	ff d2                	call   *%rdx
+  80170f:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  801715:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  801719:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80171e:	48 be e6 68 80 00 00 	movabs $0x8068e6,%rsi
+  801725:	00 00 00 
+  801728:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  80172f:	00 00 00 
+  801732:	b8 00 00 00 00       	mov    $0x0,%eax
+  801737:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  80173e:	00 00 00 
+  801741:	41 ff d0             	call   *%r8
+  801744:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  801748:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80174d:	0f 84 0a 05 00 00    	je     801c5d <check_regs+0x75c>
+  801753:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  80175a:	00 00 00 
+  80175d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801762:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801769:	00 00 00 
+  80176c:	ff d2                	call   *%rdx
+  80176e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  801774:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  801778:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  80177d:	48 be ea 68 80 00 00 	movabs $0x8068ea,%rsi
+  801784:	00 00 00 
+  801787:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  80178e:	00 00 00 
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  80179d:	00 00 00 
+  8017a0:	41 ff d0             	call   *%r8
+  8017a3:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8017a7:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8017ac:	0f 84 cb 04 00 00    	je     801c7d <check_regs+0x77c>
+  8017b2:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  8017b9:	00 00 00 
+  8017bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c1:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  8017c8:	00 00 00 
+  8017cb:	ff d2                	call   *%rdx
+  8017cd:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  8017d3:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8017d7:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8017dc:	48 be ea 68 80 00 00 	movabs $0x8068ea,%rsi
+  8017e3:	00 00 00 
+  8017e6:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  8017ed:	00 00 00 
+  8017f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f5:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  8017fc:	00 00 00 
+  8017ff:	41 ff d0             	call   *%r8
+  801802:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  801806:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  80180b:	0f 84 8c 04 00 00    	je     801c9d <check_regs+0x79c>
+  801811:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801818:	00 00 00 
+  80181b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801820:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801827:	00 00 00 
+  80182a:	ff d2                	call   *%rdx
+  80182c:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  801832:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  801836:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80183b:	48 be e6 68 80 00 00 	movabs $0x8068e6,%rsi
+  801842:	00 00 00 
+  801845:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  80184c:	00 00 00 
+  80184f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801854:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  80185b:	00 00 00 
+  80185e:	41 ff d0             	call   *%r8
+  801861:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  801865:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80186a:	0f 84 4d 04 00 00    	je     801cbd <check_regs+0x7bc>
+  801870:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801877:	00 00 00 
+  80187a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187f:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801886:	00 00 00 
+  801889:	ff d2                	call   *%rdx
+  80188b:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbp, regs.reg_rbp);
+  801891:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  801895:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  80189a:	48 be ee 68 80 00 00 	movabs $0x8068ee,%rsi
+  8018a1:	00 00 00 
+  8018a4:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  8018ab:	00 00 00 
+  8018ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b3:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  8018ba:	00 00 00 
+  8018bd:	41 ff d0             	call   *%r8
+  8018c0:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  8018c4:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  8018c9:	0f 84 0e 04 00 00    	je     801cdd <check_regs+0x7dc>
+  8018cf:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  8018d6:	00 00 00 
+  8018d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018de:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  8018e5:	00 00 00 
+  8018e8:	ff d2                	call   *%rdx
+  8018ea:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbx, regs.reg_rbx);
+  8018f0:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  8018f4:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  8018f9:	48 be f2 68 80 00 00 	movabs $0x8068f2,%rsi
+  801900:	00 00 00 
+  801903:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  80190a:	00 00 00 
+  80190d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801912:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  801919:	00 00 00 
+  80191c:	41 ff d0             	call   *%r8
+  80191f:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  801923:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  801928:	0f 84 cf 03 00 00    	je     801cfd <check_regs+0x7fc>
+  80192e:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801935:	00 00 00 
+  801938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193d:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801944:	00 00 00 
+  801947:	ff d2                	call   *%rdx
+  801949:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdx, regs.reg_rdx);
+  80194f:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  801953:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  801958:	48 be f6 68 80 00 00 	movabs $0x8068f6,%rsi
+  80195f:	00 00 00 
+  801962:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801969:	00 00 00 
+  80196c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801971:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  801978:	00 00 00 
+  80197b:	41 ff d0             	call   *%r8
+  80197e:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  801982:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  801987:	0f 84 90 03 00 00    	je     801d1d <check_regs+0x81c>
+  80198d:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801994:	00 00 00 
+  801997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  8019a3:	00 00 00 
+  8019a6:	ff d2                	call   *%rdx
+  8019a8:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rcx, regs.reg_rcx);
+  8019ae:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8019b2:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8019b7:	48 be fa 68 80 00 00 	movabs $0x8068fa,%rsi
+  8019be:	00 00 00 
+  8019c1:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  8019c8:	00 00 00 
+  8019cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d0:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  8019d7:	00 00 00 
+  8019da:	41 ff d0             	call   *%r8
+  8019dd:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  8019e1:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  8019e6:	0f 84 51 03 00 00    	je     801d3d <check_regs+0x83c>
+  8019ec:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  8019f3:	00 00 00 
+  8019f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fb:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801a02:	00 00 00 
+  801a05:	ff d2                	call   *%rdx
+  801a07:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rax, regs.reg_rax);
+  801a0d:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  801a11:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  801a16:	48 be fe 68 80 00 00 	movabs $0x8068fe,%rsi
+  801a1d:	00 00 00 
+  801a20:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801a27:	00 00 00 
+  801a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2f:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  801a36:	00 00 00 
+  801a39:	41 ff d0             	call   *%r8
+  801a3c:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  801a40:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  801a45:	0f 84 12 03 00 00    	je     801d5d <check_regs+0x85c>
+  801a4b:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801a52:	00 00 00 
+  801a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5a:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801a61:	00 00 00 
+  801a64:	ff d2                	call   *%rdx
+  801a66:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rip, rip);
+  801a6c:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  801a70:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  801a75:	48 be 02 69 80 00 00 	movabs $0x806902,%rsi
+  801a7c:	00 00 00 
+  801a7f:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801a86:	00 00 00 
+  801a89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8e:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  801a95:	00 00 00 
+  801a98:	41 ff d0             	call   *%r8
+  801a9b:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  801a9f:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  801aa4:	0f 84 d3 02 00 00    	je     801d7d <check_regs+0x87c>
+  801aaa:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801ab1:	00 00 00 
+  801ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab9:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801ac0:	00 00 00 
+  801ac3:	ff d2                	call   *%rdx
+  801ac5:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rflags, rflags);
+  801acb:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  801ad2:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  801ad9:	00 
+  801ada:	48 be 06 69 80 00 00 	movabs $0x806906,%rsi
+  801ae1:	00 00 00 
+  801ae4:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801aeb:	00 00 00 
+  801aee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af3:	49 b8 d5 23 80 00 00 	movabs $0x8023d5,%r8
+  801afa:	00 00 00 
+  801afd:	41 ff d0             	call   *%r8
+  801b00:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  801b07:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  801b0e:	00 
+  801b0f:	0f 84 88 02 00 00    	je     801d9d <check_regs+0x89c>
+  801b15:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801b1c:	00 00 00 
+  801b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b24:	49 bd d5 23 80 00 00 	movabs $0x8023d5,%r13
+  801b2b:	00 00 00 
+  801b2e:	41 ff d5             	call   *%r13
+    CHECK(rsp, rsp);
+  801b31:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  801b38:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  801b3f:	00 
+  801b40:	48 be 0d 69 80 00 00 	movabs $0x80690d,%rsi
+  801b47:	00 00 00 
+  801b4a:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801b51:	00 00 00 
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	41 ff d5             	call   *%r13
+  801b5c:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  801b63:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  801b6a:	00 
+  801b6b:	0f 84 ea 02 00 00    	je     801e5b <check_regs+0x95a>
+  801b71:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801b78:	00 00 00 
+  801b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b80:	48 bb d5 23 80 00 00 	movabs $0x8023d5,%rbx
+  801b87:	00 00 00 
+  801b8a:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+    cprintf("Registers %s ", testname);
+  801b8c:	4c 89 f6             	mov    %r14,%rsi
+  801b8f:	48 bf 11 69 80 00 00 	movabs $0x806911,%rdi
+  801b96:	00 00 00 
+  801b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9e:	ff d3                	call   *%rbx
+    if (!mismatch)
+        cprintf("OK\n");
+    else
+        cprintf("MISMATCH\n");
+  801ba0:	48 bf cc 68 80 00 00 	movabs $0x8068cc,%rdi
+  801ba7:	00 00 00 
+  801baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801baf:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801bb6:	00 00 00 
+  801bb9:	ff d2                	call   *%rdx
+}
+  801bbb:	e9 8c 02 00 00       	jmp    801e4c <check_regs+0x94b>
+    CHECK(r14, regs.reg_r14);
+  801bc0:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801bc7:	00 00 00 
+  801bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcf:	41 ff d5             	call   *%r13
+    int mismatch = 0;
+  801bd2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bd8:	e9 bc f9 ff ff       	jmp    801599 <check_regs+0x98>
+    CHECK(r13, regs.reg_r13);
+  801bdd:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801be4:	00 00 00 
+  801be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bec:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801bf3:	00 00 00 
+  801bf6:	ff d2                	call   *%rdx
+  801bf8:	e9 fb f9 ff ff       	jmp    8015f8 <check_regs+0xf7>
+    CHECK(r12, regs.reg_r12);
+  801bfd:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801c04:	00 00 00 
+  801c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801c13:	00 00 00 
+  801c16:	ff d2                	call   *%rdx
+  801c18:	e9 3a fa ff ff       	jmp    801657 <check_regs+0x156>
+    CHECK(r11, regs.reg_r11);
+  801c1d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801c24:	00 00 00 
+  801c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801c33:	00 00 00 
+  801c36:	ff d2                	call   *%rdx
+  801c38:	e9 79 fa ff ff       	jmp    8016b6 <check_regs+0x1b5>
+    CHECK(r10, regs.reg_r10);
+  801c3d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801c44:	00 00 00 
+  801c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801c53:	00 00 00 
+  801c56:	ff d2                	call   *%rdx
+  801c58:	e9 b8 fa ff ff       	jmp    801715 <check_regs+0x214>
+    CHECK(rsi, regs.reg_rsi);
+  801c5d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801c64:	00 00 00 
+  801c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801c73:	00 00 00 
+  801c76:	ff d2                	call   *%rdx
+  801c78:	e9 f7 fa ff ff       	jmp    801774 <check_regs+0x273>
+    CHECK(rdi, regs.reg_rdi);
+  801c7d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801c84:	00 00 00 
+  801c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801c93:	00 00 00 
+  801c96:	ff d2                	call   *%rdx
+  801c98:	e9 36 fb ff ff       	jmp    8017d3 <check_regs+0x2d2>
+    CHECK(rdi, regs.reg_rdi);
+  801c9d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801ca4:	00 00 00 
+  801ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cac:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801cb3:	00 00 00 
+  801cb6:	ff d2                	call   *%rdx
+  801cb8:	e9 75 fb ff ff       	jmp    801832 <check_regs+0x331>
+    CHECK(rsi, regs.reg_rsi);
+  801cbd:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801cc4:	00 00 00 
+  801cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccc:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801cd3:	00 00 00 
+  801cd6:	ff d2                	call   *%rdx
+  801cd8:	e9 b4 fb ff ff       	jmp    801891 <check_regs+0x390>
+    CHECK(rbp, regs.reg_rbp);
+  801cdd:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801ce4:	00 00 00 
+  801ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cec:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801cf3:	00 00 00 
+  801cf6:	ff d2                	call   *%rdx
+  801cf8:	e9 f3 fb ff ff       	jmp    8018f0 <check_regs+0x3ef>
+    CHECK(rbx, regs.reg_rbx);
+  801cfd:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801d04:	00 00 00 
+  801d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801d13:	00 00 00 
+  801d16:	ff d2                	call   *%rdx
+  801d18:	e9 32 fc ff ff       	jmp    80194f <check_regs+0x44e>
+    CHECK(rdx, regs.reg_rdx);
+  801d1d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801d24:	00 00 00 
+  801d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801d33:	00 00 00 
+  801d36:	ff d2                	call   *%rdx
+  801d38:	e9 71 fc ff ff       	jmp    8019ae <check_regs+0x4ad>
+    CHECK(rcx, regs.reg_rcx);
+  801d3d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801d44:	00 00 00 
+  801d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801d53:	00 00 00 
+  801d56:	ff d2                	call   *%rdx
+  801d58:	e9 b0 fc ff ff       	jmp    801a0d <check_regs+0x50c>
+    CHECK(rax, regs.reg_rax);
+  801d5d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801d64:	00 00 00 
+  801d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801d73:	00 00 00 
+  801d76:	ff d2                	call   *%rdx
+  801d78:	e9 ef fc ff ff       	jmp    801a6c <check_regs+0x56b>
+    CHECK(rip, rip);
+  801d7d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801d84:	00 00 00 
+  801d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8c:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801d93:	00 00 00 
+  801d96:	ff d2                	call   *%rdx
+  801d98:	e9 2e fd ff ff       	jmp    801acb <check_regs+0x5ca>
+    CHECK(rflags, rflags);
+  801d9d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801da4:	00 00 00 
+  801da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dac:	49 bf d5 23 80 00 00 	movabs $0x8023d5,%r15
+  801db3:	00 00 00 
+  801db6:	41 ff d7             	call   *%r15
+    CHECK(rsp, rsp);
+  801db9:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  801dc0:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  801dc7:	00 
+  801dc8:	48 be 0d 69 80 00 00 	movabs $0x80690d,%rsi
+  801dcf:	00 00 00 
+  801dd2:	48 bf b6 68 80 00 00 	movabs $0x8068b6,%rdi
+  801dd9:	00 00 00 
+  801ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de1:	41 ff d7             	call   *%r15
+  801de4:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  801deb:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  801df2:	00 
+  801df3:	0f 85 78 fd ff ff    	jne    801b71 <check_regs+0x670>
+  801df9:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801e00:	00 00 00 
+  801e03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e08:	48 bb d5 23 80 00 00 	movabs $0x8023d5,%rbx
+  801e0f:	00 00 00 
+  801e12:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  801e14:	4c 89 f6             	mov    %r14,%rsi
+  801e17:	48 bf 11 69 80 00 00 	movabs $0x806911,%rdi
+  801e1e:	00 00 00 
+  801e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e26:	ff d3                	call   *%rbx
+    if (!mismatch)
+  801e28:	45 85 ed             	test   %r13d,%r13d
+  801e2b:	0f 85 6f fd ff ff    	jne    801ba0 <check_regs+0x69f>
+        cprintf("OK\n");
+  801e31:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801e38:	00 00 00 
+  801e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e40:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  801e47:	00 00 00 
+  801e4a:	ff d2                	call   *%rdx
+}
+  801e4c:	48 83 c4 08          	add    $0x8,%rsp
+  801e50:	5b                   	pop    %rbx
+  801e51:	41 5c                	pop    %r12
+  801e53:	41 5d                	pop    %r13
+  801e55:	41 5e                	pop    %r14
+  801e57:	41 5f                	pop    %r15
+  801e59:	5d                   	pop    %rbp
+  801e5a:	c3                   	ret
+    CHECK(rsp, rsp);
+  801e5b:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801e62:	00 00 00 
+  801e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6a:	48 bb d5 23 80 00 00 	movabs $0x8023d5,%rbx
+  801e71:	00 00 00 
+  801e74:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  801e76:	4c 89 f6             	mov    %r14,%rsi
+  801e79:	48 bf 11 69 80 00 00 	movabs $0x806911,%rdi
+  801e80:	00 00 00 
+  801e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e88:	ff d3                	call   *%rbx
+    if (!mismatch)
+  801e8a:	e9 11 fd ff ff       	jmp    801ba0 <check_regs+0x69f>
+
+0000000000801e8f <pgfault>:
+
+static bool
+pgfault(struct UTrapframe *utf) {
+  801e8f:	55                   	push   %rbp
+  801e90:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+
+    if (utf->utf_fault_va != (uint64_t)UTEMP)
+  801e93:	48 8b 0f             	mov    (%rdi),%rcx
+  801e96:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  801e9d:	0f 85 13 01 00 00    	jne    801fb6 <pgfault+0x127>
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+              (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+    /* Check registers in UTrapframe */
+    during.regs = utf->utf_regs;
+  801ea3:	48 be c0 90 80 01 00 	movabs $0x18090c0,%rsi
+  801eaa:	00 00 00 
+  801ead:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  801eb1:	48 89 16             	mov    %rdx,(%rsi)
+  801eb4:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+  801eb8:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801ebc:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  801ec0:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  801ec4:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+  801ec8:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  801ecc:	48 8b 57 30          	mov    0x30(%rdi),%rdx
+  801ed0:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  801ed4:	48 8b 57 38          	mov    0x38(%rdi),%rdx
+  801ed8:	48 89 56 28          	mov    %rdx,0x28(%rsi)
+  801edc:	48 8b 57 40          	mov    0x40(%rdi),%rdx
+  801ee0:	48 89 56 30          	mov    %rdx,0x30(%rsi)
+  801ee4:	48 8b 57 48          	mov    0x48(%rdi),%rdx
+  801ee8:	48 89 56 38          	mov    %rdx,0x38(%rsi)
+  801eec:	48 8b 57 50          	mov    0x50(%rdi),%rdx
+  801ef0:	48 89 56 40          	mov    %rdx,0x40(%rsi)
+  801ef4:	48 8b 57 58          	mov    0x58(%rdi),%rdx
+  801ef8:	48 89 56 48          	mov    %rdx,0x48(%rsi)
+  801efc:	48 8b 57 60          	mov    0x60(%rdi),%rdx
+  801f00:	48 89 56 50          	mov    %rdx,0x50(%rsi)
+  801f04:	48 8b 57 68          	mov    0x68(%rdi),%rdx
+  801f08:	48 89 56 58          	mov    %rdx,0x58(%rsi)
+  801f0c:	48 8b 57 70          	mov    0x70(%rdi),%rdx
+  801f10:	48 89 56 60          	mov    %rdx,0x60(%rsi)
+  801f14:	48 8b 57 78          	mov    0x78(%rdi),%rdx
+  801f18:	48 89 56 68          	mov    %rdx,0x68(%rsi)
+  801f1c:	48 8b 97 80 00 00 00 	mov    0x80(%rdi),%rdx
+  801f23:	48 89 56 70          	mov    %rdx,0x70(%rsi)
+    during.rip = utf->utf_rip;
+  801f27:	48 8b 97 88 00 00 00 	mov    0x88(%rdi),%rdx
+  801f2e:	48 89 56 78          	mov    %rdx,0x78(%rsi)
+    during.rflags = utf->utf_rflags & 0xfff;
+  801f32:	48 8b 97 90 00 00 00 	mov    0x90(%rdi),%rdx
+  801f39:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801f3f:	48 89 96 80 00 00 00 	mov    %rdx,0x80(%rsi)
+    during.rsp = utf->utf_rsp;
+  801f46:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  801f4d:	48 89 86 88 00 00 00 	mov    %rax,0x88(%rsi)
+    check_regs(&before, "before", &during, "during", "in UTrapframe");
+  801f54:	49 b8 30 69 80 00 00 	movabs $0x806930,%r8
+  801f5b:	00 00 00 
+  801f5e:	48 b9 3e 69 80 00 00 	movabs $0x80693e,%rcx
+  801f65:	00 00 00 
+  801f68:	48 89 f2             	mov    %rsi,%rdx
+  801f6b:	48 be 45 69 80 00 00 	movabs $0x806945,%rsi
+  801f72:	00 00 00 
+  801f75:	48 bf 60 91 80 01 00 	movabs $0x1809160,%rdi
+  801f7c:	00 00 00 
+  801f7f:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801f86:	00 00 00 
+  801f89:	ff d0                	call   *%rax
+    ;
+
+    /* Map UTEMP so the write succeeds */
+    if ((r = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW)) < 0)
+  801f8b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801f90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f95:	be 00 00 40 00       	mov    $0x400000,%esi
+  801f9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f9f:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  801fa6:	00 00 00 
+  801fa9:	ff d0                	call   *%rax
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	78 39                	js     801fe8 <pgfault+0x159>
+        panic("sys_page_alloc: %i", r);
+    return 1;
+}
+  801faf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb4:	5d                   	pop    %rbp
+  801fb5:	c3                   	ret
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  801fb6:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  801fbd:	48 ba 78 69 80 00 00 	movabs $0x806978,%rdx
+  801fc4:	00 00 00 
+  801fc7:	be 62 00 00 00       	mov    $0x62,%esi
+  801fcc:	48 bf 1f 69 80 00 00 	movabs $0x80691f,%rdi
+  801fd3:	00 00 00 
+  801fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdb:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  801fe2:	00 00 00 
+  801fe5:	41 ff d1             	call   *%r9
+        panic("sys_page_alloc: %i", r);
+  801fe8:	89 c1                	mov    %eax,%ecx
+  801fea:	48 ba 4c 69 80 00 00 	movabs $0x80694c,%rdx
+  801ff1:	00 00 00 
+  801ff4:	be 6f 00 00 00       	mov    $0x6f,%esi
+  801ff9:	48 bf 1f 69 80 00 00 	movabs $0x80691f,%rdi
+  802000:	00 00 00 
+  802003:	b8 00 00 00 00       	mov    $0x0,%eax
+  802008:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  80200f:	00 00 00 
+  802012:	41 ff d0             	call   *%r8
+
+0000000000802015 <umain>:
+
+void
+umain(int argc, char **argv) {
+  802015:	55                   	push   %rbp
+  802016:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(pgfault);
+  802019:	48 bf 8f 1e 80 00 00 	movabs $0x801e8f,%rdi
+  802020:	00 00 00 
+  802023:	48 b8 59 3b 80 00 00 	movabs $0x803b59,%rax
+  80202a:	00 00 00 
+  80202d:	ff d0                	call   *%rax
+
+    __asm __volatile(
+  80202f:	48 b8 60 91 80 01 00 	movabs $0x1809160,%rax
+  802036:	00 00 00 
+  802039:	48 ba 20 90 80 01 00 	movabs $0x1809020,%rdx
+  802040:	00 00 00 
+  802043:	50                   	push   %rax
+  802044:	52                   	push   %rdx
+  802045:	50                   	push   %rax
+  802046:	9c                   	pushf
+  802047:	58                   	pop    %rax
+  802048:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  80204e:	50                   	push   %rax
+  80204f:	9d                   	popf
+  802050:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  802055:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  80205c:	48 8d 04 25 a8 20 80 	lea    0x8020a8,%rax
+  802063:	00 
+  802064:	49 89 47 78          	mov    %rax,0x78(%r15)
+  802068:	58                   	pop    %rax
+  802069:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  80206d:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  802071:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  802075:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  802079:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  80207d:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  802081:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  802085:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  802089:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  80208d:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  802091:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  802095:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  802099:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  80209d:	49 89 47 70          	mov    %rax,0x70(%r15)
+  8020a1:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  8020a8:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  8020af:	2a 00 00 00 
+  8020b3:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8020b7:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  8020bb:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  8020bf:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  8020c3:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  8020c7:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  8020cb:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  8020cf:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  8020d3:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  8020d7:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  8020db:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  8020df:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  8020e3:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  8020e7:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  8020eb:	49 89 47 70          	mov    %rax,0x70(%r15)
+  8020ef:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  8020f6:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  8020fb:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  8020ff:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  802103:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  802107:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  80210b:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  80210f:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  802113:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  802117:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  80211b:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  80211f:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  802123:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  802127:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  80212b:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  80212f:	49 8b 47 70          	mov    0x70(%r15),%rax
+  802133:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  80213a:	50                   	push   %rax
+  80213b:	9c                   	pushf
+  80213c:	58                   	pop    %rax
+  80213d:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  802142:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  802149:	58                   	pop    %rax
+            : "memory", "cc");
+
+    /* Check UTEMP to roughly determine that EIP was restored
+     * correctly (of course, we probably wouldn't get this far if
+     * it weren't) */
+    if (*(int *)UTEMP != 42)
+  80214a:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  802151:	2a 
+  802152:	75 48                	jne    80219c <umain+0x187>
+        cprintf("RIP after page-fault MISMATCH\n");
+    after.rip = before.rip;
+  802154:	48 ba 20 90 80 01 00 	movabs $0x1809020,%rdx
+  80215b:	00 00 00 
+  80215e:	48 bf 60 91 80 01 00 	movabs $0x1809160,%rdi
+  802165:	00 00 00 
+  802168:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  80216c:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+    check_regs(&before, "before", &after, "after", "after page-fault");
+  802170:	49 b8 5f 69 80 00 00 	movabs $0x80695f,%r8
+  802177:	00 00 00 
+  80217a:	48 b9 70 69 80 00 00 	movabs $0x806970,%rcx
+  802181:	00 00 00 
+  802184:	48 be 45 69 80 00 00 	movabs $0x806945,%rsi
+  80218b:	00 00 00 
+  80218e:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+}
+  80219a:	5d                   	pop    %rbp
+  80219b:	c3                   	ret
+        cprintf("RIP after page-fault MISMATCH\n");
+  80219c:	48 bf b0 69 80 00 00 	movabs $0x8069b0,%rdi
+  8021a3:	00 00 00 
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ab:	48 ba d5 23 80 00 00 	movabs $0x8023d5,%rdx
+  8021b2:	00 00 00 
+  8021b5:	ff d2                	call   *%rdx
+  8021b7:	eb 9b                	jmp    802154 <umain+0x13f>
+
+00000000008021b9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8021b9:	55                   	push   %rbp
+  8021ba:	48 89 e5             	mov    %rsp,%rbp
+  8021bd:	41 56                	push   %r14
+  8021bf:	41 55                	push   %r13
+  8021c1:	41 54                	push   %r12
+  8021c3:	53                   	push   %rbx
+  8021c4:	41 89 fd             	mov    %edi,%r13d
+  8021c7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8021ca:	48 ba f8 80 80 00 00 	movabs $0x8080f8,%rdx
+  8021d1:	00 00 00 
+  8021d4:	48 b8 f8 80 80 00 00 	movabs $0x8080f8,%rax
+  8021db:	00 00 00 
+  8021de:	48 39 c2             	cmp    %rax,%rdx
+  8021e1:	73 17                	jae    8021fa <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8021e3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8021e6:	49 89 c4             	mov    %rax,%r12
+  8021e9:	48 83 c3 08          	add    $0x8,%rbx
+  8021ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f2:	ff 53 f8             	call   *-0x8(%rbx)
+  8021f5:	4c 39 e3             	cmp    %r12,%rbx
+  8021f8:	72 ef                	jb     8021e9 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8021fa:	48 b8 99 33 80 00 00 	movabs $0x803399,%rax
+  802201:	00 00 00 
+  802204:	ff d0                	call   *%rax
+  802206:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80220b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  802212:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802219:	00 00 00 
+  80221c:	48 01 d0             	add    %rdx,%rax
+  80221f:	48 a3 f0 91 80 01 00 	movabs %rax,0x18091f0
+  802226:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  802229:	45 85 ed             	test   %r13d,%r13d
+  80222c:	7e 0d                	jle    80223b <libmain+0x82>
+  80222e:	49 8b 06             	mov    (%r14),%rax
+  802231:	48 a3 38 80 80 00 00 	movabs %rax,0x808038
+  802238:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80223b:	4c 89 f6             	mov    %r14,%rsi
+  80223e:	44 89 ef             	mov    %r13d,%edi
+  802241:	48 b8 15 20 80 00 00 	movabs $0x802015,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80224d:	48 b8 62 22 80 00 00 	movabs $0x802262,%rax
+  802254:	00 00 00 
+  802257:	ff d0                	call   *%rax
+#endif
+}
+  802259:	5b                   	pop    %rbx
+  80225a:	41 5c                	pop    %r12
+  80225c:	41 5d                	pop    %r13
+  80225e:	41 5e                	pop    %r14
+  802260:	5d                   	pop    %rbp
+  802261:	c3                   	ret
+
+0000000000802262 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  802262:	55                   	push   %rbp
+  802263:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  802266:	48 b8 07 40 80 00 00 	movabs $0x804007,%rax
+  80226d:	00 00 00 
+  802270:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  802272:	bf 00 00 00 00       	mov    $0x0,%edi
+  802277:	48 b8 28 33 80 00 00 	movabs $0x803328,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+}
+  802283:	5d                   	pop    %rbp
+  802284:	c3                   	ret
+
+0000000000802285 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802285:	55                   	push   %rbp
+  802286:	48 89 e5             	mov    %rsp,%rbp
+  802289:	41 56                	push   %r14
+  80228b:	41 55                	push   %r13
+  80228d:	41 54                	push   %r12
+  80228f:	53                   	push   %rbx
+  802290:	48 83 ec 50          	sub    $0x50,%rsp
+  802294:	49 89 fc             	mov    %rdi,%r12
+  802297:	41 89 f5             	mov    %esi,%r13d
+  80229a:	48 89 d3             	mov    %rdx,%rbx
+  80229d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8022a1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8022a5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8022a9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8022b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022b4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8022b8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8022bc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8022c0:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  8022c7:	00 00 00 
+  8022ca:	4c 8b 30             	mov    (%rax),%r14
+  8022cd:	48 b8 99 33 80 00 00 	movabs $0x803399,%rax
+  8022d4:	00 00 00 
+  8022d7:	ff d0                	call   *%rax
+  8022d9:	89 c6                	mov    %eax,%esi
+  8022db:	45 89 e8             	mov    %r13d,%r8d
+  8022de:	4c 89 e1             	mov    %r12,%rcx
+  8022e1:	4c 89 f2             	mov    %r14,%rdx
+  8022e4:	48 bf e0 69 80 00 00 	movabs $0x8069e0,%rdi
+  8022eb:	00 00 00 
+  8022ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f3:	49 bc d5 23 80 00 00 	movabs $0x8023d5,%r12
+  8022fa:	00 00 00 
+  8022fd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802300:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802304:	48 89 df             	mov    %rbx,%rdi
+  802307:	48 b8 71 23 80 00 00 	movabs $0x802371,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+    cprintf("\n");
+  802313:	48 bf d4 68 80 00 00 	movabs $0x8068d4,%rdi
+  80231a:	00 00 00 
+  80231d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802322:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802325:	cc                   	int3
+  802326:	eb fd                	jmp    802325 <_panic+0xa0>
+
+0000000000802328 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802328:	55                   	push   %rbp
+  802329:	48 89 e5             	mov    %rsp,%rbp
+  80232c:	53                   	push   %rbx
+  80232d:	48 83 ec 08          	sub    $0x8,%rsp
+  802331:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802334:	8b 06                	mov    (%rsi),%eax
+  802336:	8d 50 01             	lea    0x1(%rax),%edx
+  802339:	89 16                	mov    %edx,(%rsi)
+  80233b:	48 98                	cltq
+  80233d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802342:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802348:	74 0a                	je     802354 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80234a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80234e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802352:	c9                   	leave
+  802353:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802354:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802358:	be ff 00 00 00       	mov    $0xff,%esi
+  80235d:	48 b8 89 32 80 00 00 	movabs $0x803289,%rax
+  802364:	00 00 00 
+  802367:	ff d0                	call   *%rax
+        state->offset = 0;
+  802369:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80236f:	eb d9                	jmp    80234a <putch+0x22>
+
+0000000000802371 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802371:	55                   	push   %rbp
+  802372:	48 89 e5             	mov    %rsp,%rbp
+  802375:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80237c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80237f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802386:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80238b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802390:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802393:	48 89 f1             	mov    %rsi,%rcx
+  802396:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80239d:	48 bf 28 23 80 00 00 	movabs $0x802328,%rdi
+  8023a4:	00 00 00 
+  8023a7:	48 b8 25 25 80 00 00 	movabs $0x802525,%rax
+  8023ae:	00 00 00 
+  8023b1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8023b3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8023ba:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8023c1:	48 b8 89 32 80 00 00 	movabs $0x803289,%rax
+  8023c8:	00 00 00 
+  8023cb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8023cd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8023d3:	c9                   	leave
+  8023d4:	c3                   	ret
+
+00000000008023d5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8023d5:	55                   	push   %rbp
+  8023d6:	48 89 e5             	mov    %rsp,%rbp
+  8023d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8023dd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8023e1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8023e5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023e9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8023ed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8023f1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8023f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8023fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802400:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802404:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802408:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80240c:	48 b8 71 23 80 00 00 	movabs $0x802371,%rax
+  802413:	00 00 00 
+  802416:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802418:	c9                   	leave
+  802419:	c3                   	ret
+
+000000000080241a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80241a:	55                   	push   %rbp
+  80241b:	48 89 e5             	mov    %rsp,%rbp
+  80241e:	41 57                	push   %r15
+  802420:	41 56                	push   %r14
+  802422:	41 55                	push   %r13
+  802424:	41 54                	push   %r12
+  802426:	53                   	push   %rbx
+  802427:	48 83 ec 18          	sub    $0x18,%rsp
+  80242b:	49 89 fc             	mov    %rdi,%r12
+  80242e:	49 89 f5             	mov    %rsi,%r13
+  802431:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802435:	8b 45 10             	mov    0x10(%rbp),%eax
+  802438:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80243b:	41 89 cf             	mov    %ecx,%r15d
+  80243e:	4c 39 fa             	cmp    %r15,%rdx
+  802441:	73 5b                	jae    80249e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802443:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802447:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80244b:	85 db                	test   %ebx,%ebx
+  80244d:	7e 0e                	jle    80245d <print_num+0x43>
+            putch(padc, put_arg);
+  80244f:	4c 89 ee             	mov    %r13,%rsi
+  802452:	44 89 f7             	mov    %r14d,%edi
+  802455:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802458:	83 eb 01             	sub    $0x1,%ebx
+  80245b:	75 f2                	jne    80244f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80245d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802461:	48 b9 14 6a 80 00 00 	movabs $0x806a14,%rcx
+  802468:	00 00 00 
+  80246b:	48 b8 03 6a 80 00 00 	movabs $0x806a03,%rax
+  802472:	00 00 00 
+  802475:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802479:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80247d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802482:	49 f7 f7             	div    %r15
+  802485:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802489:	4c 89 ee             	mov    %r13,%rsi
+  80248c:	41 ff d4             	call   *%r12
+}
+  80248f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802493:	5b                   	pop    %rbx
+  802494:	41 5c                	pop    %r12
+  802496:	41 5d                	pop    %r13
+  802498:	41 5e                	pop    %r14
+  80249a:	41 5f                	pop    %r15
+  80249c:	5d                   	pop    %rbp
+  80249d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80249e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a7:	49 f7 f7             	div    %r15
+  8024aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ae:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8024b2:	52                   	push   %rdx
+  8024b3:	45 0f be c9          	movsbl %r9b,%r9d
+  8024b7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8024bb:	48 89 c2             	mov    %rax,%rdx
+  8024be:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	48 83 c4 10          	add    $0x10,%rsp
+  8024ce:	eb 8d                	jmp    80245d <print_num+0x43>
+
+00000000008024d0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8024d0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8024d4:	48 8b 06             	mov    (%rsi),%rax
+  8024d7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8024db:	73 0a                	jae    8024e7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8024dd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8024e1:	48 89 16             	mov    %rdx,(%rsi)
+  8024e4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8024e7:	c3                   	ret
+
+00000000008024e8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8024e8:	55                   	push   %rbp
+  8024e9:	48 89 e5             	mov    %rsp,%rbp
+  8024ec:	48 83 ec 50          	sub    $0x50,%rsp
+  8024f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024f4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8024f8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8024fc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802503:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802507:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80250b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80250f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802513:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802517:	48 b8 25 25 80 00 00 	movabs $0x802525,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+}
+  802523:	c9                   	leave
+  802524:	c3                   	ret
+
+0000000000802525 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  802525:	55                   	push   %rbp
+  802526:	48 89 e5             	mov    %rsp,%rbp
+  802529:	41 57                	push   %r15
+  80252b:	41 56                	push   %r14
+  80252d:	41 55                	push   %r13
+  80252f:	41 54                	push   %r12
+  802531:	53                   	push   %rbx
+  802532:	48 83 ec 38          	sub    $0x38,%rsp
+  802536:	49 89 fe             	mov    %rdi,%r14
+  802539:	49 89 f5             	mov    %rsi,%r13
+  80253c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80253f:	48 8b 01             	mov    (%rcx),%rax
+  802542:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802546:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80254a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80254e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802552:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802556:	eb 0d                	jmp    802565 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  802558:	40 0f b6 ff          	movzbl %dil,%edi
+  80255c:	4c 89 ee             	mov    %r13,%rsi
+  80255f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802562:	4c 89 e3             	mov    %r12,%rbx
+  802565:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802569:	0f b6 3b             	movzbl (%rbx),%edi
+  80256c:	40 80 ff 25          	cmp    $0x25,%dil
+  802570:	74 14                	je     802586 <vprintfmt+0x61>
+            if (!ch) return;
+  802572:	40 84 ff             	test   %dil,%dil
+  802575:	75 e1                	jne    802558 <vprintfmt+0x33>
+}
+  802577:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80257b:	5b                   	pop    %rbx
+  80257c:	41 5c                	pop    %r12
+  80257e:	41 5d                	pop    %r13
+  802580:	41 5e                	pop    %r14
+  802582:	41 5f                	pop    %r15
+  802584:	5d                   	pop    %rbp
+  802585:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  802586:	be 00 00 00 00       	mov    $0x0,%esi
+  80258b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80258f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802594:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80259a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8025a1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8025a5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8025aa:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8025af:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8025b2:	83 e8 23             	sub    $0x23,%eax
+  8025b5:	3c 57                	cmp    $0x57,%al
+  8025b7:	0f 87 67 06 00 00    	ja     802c24 <vprintfmt+0x6ff>
+  8025bd:	0f b6 c0             	movzbl %al,%eax
+  8025c0:	48 b9 a0 6b 80 00 00 	movabs $0x806ba0,%rcx
+  8025c7:	00 00 00 
+  8025ca:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8025cd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8025d0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8025d4:	eb cf                	jmp    8025a5 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8025d6:	49 89 dc             	mov    %rbx,%r12
+  8025d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8025de:	eb c5                	jmp    8025a5 <vprintfmt+0x80>
+            padc = ch;
+  8025e0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8025e4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8025e7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8025ea:	eb b9                	jmp    8025a5 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8025ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8025ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8025f2:	77 24                	ja     802618 <vprintfmt+0xf3>
+  8025f4:	89 c1                	mov    %eax,%ecx
+  8025f6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8025fa:	83 c0 08             	add    $0x8,%eax
+  8025fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802600:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802603:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802606:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80260a:	79 99                	jns    8025a5 <vprintfmt+0x80>
+                width = precision;
+  80260c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802610:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802616:	eb 8d                	jmp    8025a5 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  802618:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80261c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802620:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802624:	eb da                	jmp    802600 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  802626:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80262b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80262f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802635:	3c 39                	cmp    $0x39,%al
+  802637:	77 1c                	ja     802655 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  802639:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80263d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802641:	0f b6 c0             	movzbl %al,%eax
+  802644:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802649:	0f b6 03             	movzbl (%rbx),%eax
+  80264c:	3c 39                	cmp    $0x39,%al
+  80264e:	76 e9                	jbe    802639 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  802650:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802653:	eb b1                	jmp    802606 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  802655:	49 89 dc             	mov    %rbx,%r12
+  802658:	eb ac                	jmp    802606 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80265a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80265d:	85 c9                	test   %ecx,%ecx
+  80265f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802664:	0f 49 c1             	cmovns %ecx,%eax
+  802667:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80266a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80266d:	e9 33 ff ff ff       	jmp    8025a5 <vprintfmt+0x80>
+            lflag++;
+  802672:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802675:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802678:	e9 28 ff ff ff       	jmp    8025a5 <vprintfmt+0x80>
+            lflag--;
+  80267d:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802680:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802683:	e9 1d ff ff ff       	jmp    8025a5 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  802688:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80268b:	83 f8 2f             	cmp    $0x2f,%eax
+  80268e:	77 19                	ja     8026a9 <vprintfmt+0x184>
+  802690:	89 c2                	mov    %eax,%edx
+  802692:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802696:	83 c0 08             	add    $0x8,%eax
+  802699:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80269c:	8b 3a                	mov    (%rdx),%edi
+  80269e:	4c 89 ee             	mov    %r13,%rsi
+  8026a1:	41 ff d6             	call   *%r14
+            break;
+  8026a4:	e9 bc fe ff ff       	jmp    802565 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  8026a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026b5:	eb e5                	jmp    80269c <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  8026b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8026ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8026bd:	77 5a                	ja     802719 <vprintfmt+0x1f4>
+  8026bf:	89 c2                	mov    %eax,%edx
+  8026c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8026c5:	83 c0 08             	add    $0x8,%eax
+  8026c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8026cb:	8b 02                	mov    (%rdx),%eax
+  8026cd:	89 c1                	mov    %eax,%ecx
+  8026cf:	f7 d9                	neg    %ecx
+  8026d1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8026d4:	83 f9 13             	cmp    $0x13,%ecx
+  8026d7:	7f 4e                	jg     802727 <vprintfmt+0x202>
+  8026d9:	48 63 c1             	movslq %ecx,%rax
+  8026dc:	48 ba 60 6e 80 00 00 	movabs $0x806e60,%rdx
+  8026e3:	00 00 00 
+  8026e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8026ea:	48 85 c0             	test   %rax,%rax
+  8026ed:	74 38                	je     802727 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8026ef:	48 89 c1             	mov    %rax,%rcx
+  8026f2:	48 ba da 6f 80 00 00 	movabs $0x806fda,%rdx
+  8026f9:	00 00 00 
+  8026fc:	4c 89 ee             	mov    %r13,%rsi
+  8026ff:	4c 89 f7             	mov    %r14,%rdi
+  802702:	b8 00 00 00 00       	mov    $0x0,%eax
+  802707:	49 b8 e8 24 80 00 00 	movabs $0x8024e8,%r8
+  80270e:	00 00 00 
+  802711:	41 ff d0             	call   *%r8
+  802714:	e9 4c fe ff ff       	jmp    802565 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  802719:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80271d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802721:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802725:	eb a4                	jmp    8026cb <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  802727:	48 ba 2c 6a 80 00 00 	movabs $0x806a2c,%rdx
+  80272e:	00 00 00 
+  802731:	4c 89 ee             	mov    %r13,%rsi
+  802734:	4c 89 f7             	mov    %r14,%rdi
+  802737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273c:	49 b8 e8 24 80 00 00 	movabs $0x8024e8,%r8
+  802743:	00 00 00 
+  802746:	41 ff d0             	call   *%r8
+  802749:	e9 17 fe ff ff       	jmp    802565 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  80274e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802751:	83 f8 2f             	cmp    $0x2f,%eax
+  802754:	77 6c                	ja     8027c2 <vprintfmt+0x29d>
+  802756:	89 c2                	mov    %eax,%edx
+  802758:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80275c:	83 c0 08             	add    $0x8,%eax
+  80275f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802762:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  802765:	48 85 f6             	test   %rsi,%rsi
+  802768:	48 b8 25 6a 80 00 00 	movabs $0x806a25,%rax
+  80276f:	00 00 00 
+  802772:	48 0f 45 c6          	cmovne %rsi,%rax
+  802776:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80277a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80277e:	7e 06                	jle    802786 <vprintfmt+0x261>
+  802780:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802784:	75 4a                	jne    8027d0 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802786:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80278a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80278e:	0f b6 00             	movzbl (%rax),%eax
+  802791:	84 c0                	test   %al,%al
+  802793:	0f 85 9a 00 00 00    	jne    802833 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  802799:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80279c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8027a0:	85 c0                	test   %eax,%eax
+  8027a2:	0f 8e bd fd ff ff    	jle    802565 <vprintfmt+0x40>
+  8027a8:	4c 89 ee             	mov    %r13,%rsi
+  8027ab:	bf 20 00 00 00       	mov    $0x20,%edi
+  8027b0:	41 ff d6             	call   *%r14
+  8027b3:	41 83 ec 01          	sub    $0x1,%r12d
+  8027b7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8027bb:	75 eb                	jne    8027a8 <vprintfmt+0x283>
+  8027bd:	e9 a3 fd ff ff       	jmp    802565 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8027c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8027ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ce:	eb 92                	jmp    802762 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  8027d0:	49 63 f7             	movslq %r15d,%rsi
+  8027d3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8027d7:	48 b8 e9 2c 80 00 00 	movabs $0x802ce9,%rax
+  8027de:	00 00 00 
+  8027e1:	ff d0                	call   *%rax
+  8027e3:	48 89 c2             	mov    %rax,%rdx
+  8027e6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8027e9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8027eb:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8027ee:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  8027f1:	85 c0                	test   %eax,%eax
+  8027f3:	7e 91                	jle    802786 <vprintfmt+0x261>
+  8027f5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8027fa:	4c 89 ee             	mov    %r13,%rsi
+  8027fd:	44 89 e7             	mov    %r12d,%edi
+  802800:	41 ff d6             	call   *%r14
+  802803:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802807:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80280a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80280d:	75 eb                	jne    8027fa <vprintfmt+0x2d5>
+  80280f:	e9 72 ff ff ff       	jmp    802786 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802814:	0f b6 f8             	movzbl %al,%edi
+  802817:	4c 89 ee             	mov    %r13,%rsi
+  80281a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80281d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802821:	49 83 c4 01          	add    $0x1,%r12
+  802825:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80282b:	84 c0                	test   %al,%al
+  80282d:	0f 84 66 ff ff ff    	je     802799 <vprintfmt+0x274>
+  802833:	45 85 ff             	test   %r15d,%r15d
+  802836:	78 0a                	js     802842 <vprintfmt+0x31d>
+  802838:	41 83 ef 01          	sub    $0x1,%r15d
+  80283c:	0f 88 57 ff ff ff    	js     802799 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802842:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802846:	74 cc                	je     802814 <vprintfmt+0x2ef>
+  802848:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80284b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802850:	80 fa 5e             	cmp    $0x5e,%dl
+  802853:	77 c2                	ja     802817 <vprintfmt+0x2f2>
+  802855:	eb bd                	jmp    802814 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  802857:	40 84 f6             	test   %sil,%sil
+  80285a:	75 26                	jne    802882 <vprintfmt+0x35d>
+    switch (lflag) {
+  80285c:	85 d2                	test   %edx,%edx
+  80285e:	74 59                	je     8028b9 <vprintfmt+0x394>
+  802860:	83 fa 01             	cmp    $0x1,%edx
+  802863:	74 7b                	je     8028e0 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  802865:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802868:	83 f8 2f             	cmp    $0x2f,%eax
+  80286b:	0f 87 96 00 00 00    	ja     802907 <vprintfmt+0x3e2>
+  802871:	89 c2                	mov    %eax,%edx
+  802873:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802877:	83 c0 08             	add    $0x8,%eax
+  80287a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80287d:	4c 8b 22             	mov    (%rdx),%r12
+  802880:	eb 17                	jmp    802899 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  802882:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802885:	83 f8 2f             	cmp    $0x2f,%eax
+  802888:	77 21                	ja     8028ab <vprintfmt+0x386>
+  80288a:	89 c2                	mov    %eax,%edx
+  80288c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802890:	83 c0 08             	add    $0x8,%eax
+  802893:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802896:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802899:	4d 85 e4             	test   %r12,%r12
+  80289c:	78 7a                	js     802918 <vprintfmt+0x3f3>
+            num = i;
+  80289e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8028a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8028a6:	e9 56 02 00 00       	jmp    802b01 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8028ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028b7:	eb dd                	jmp    802896 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  8028b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8028bf:	77 11                	ja     8028d2 <vprintfmt+0x3ad>
+  8028c1:	89 c2                	mov    %eax,%edx
+  8028c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028c7:	83 c0 08             	add    $0x8,%eax
+  8028ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028cd:	4c 63 22             	movslq (%rdx),%r12
+  8028d0:	eb c7                	jmp    802899 <vprintfmt+0x374>
+  8028d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028de:	eb ed                	jmp    8028cd <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  8028e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8028e6:	77 11                	ja     8028f9 <vprintfmt+0x3d4>
+  8028e8:	89 c2                	mov    %eax,%edx
+  8028ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028ee:	83 c0 08             	add    $0x8,%eax
+  8028f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028f4:	4c 8b 22             	mov    (%rdx),%r12
+  8028f7:	eb a0                	jmp    802899 <vprintfmt+0x374>
+  8028f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802905:	eb ed                	jmp    8028f4 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  802907:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80290b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80290f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802913:	e9 65 ff ff ff       	jmp    80287d <vprintfmt+0x358>
+                putch('-', put_arg);
+  802918:	4c 89 ee             	mov    %r13,%rsi
+  80291b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802920:	41 ff d6             	call   *%r14
+                i = -i;
+  802923:	49 f7 dc             	neg    %r12
+  802926:	e9 73 ff ff ff       	jmp    80289e <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  80292b:	40 84 f6             	test   %sil,%sil
+  80292e:	75 2e                	jne    80295e <vprintfmt+0x439>
+    switch (lflag) {
+  802930:	85 d2                	test   %edx,%edx
+  802932:	7f 59                	jg     80298d <vprintfmt+0x468>
+  802934:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802937:	7d 7a                	jge    8029b3 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802939:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80293c:	83 f8 2f             	cmp    $0x2f,%eax
+  80293f:	0f 87 aa 00 00 00    	ja     8029ef <vprintfmt+0x4ca>
+  802945:	89 c2                	mov    %eax,%edx
+  802947:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80294b:	83 c0 08             	add    $0x8,%eax
+  80294e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802951:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802954:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802959:	e9 a3 01 00 00       	jmp    802b01 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80295e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802961:	83 f8 2f             	cmp    $0x2f,%eax
+  802964:	77 19                	ja     80297f <vprintfmt+0x45a>
+  802966:	89 c2                	mov    %eax,%edx
+  802968:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80296c:	83 c0 08             	add    $0x8,%eax
+  80296f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802972:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802975:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80297a:	e9 82 01 00 00       	jmp    802b01 <vprintfmt+0x5dc>
+  80297f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80298b:	eb e5                	jmp    802972 <vprintfmt+0x44d>
+    switch (lflag) {
+  80298d:	83 fa 01             	cmp    $0x1,%edx
+  802990:	75 a7                	jne    802939 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  802992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802995:	83 f8 2f             	cmp    $0x2f,%eax
+  802998:	77 47                	ja     8029e1 <vprintfmt+0x4bc>
+  80299a:	89 c2                	mov    %eax,%edx
+  80299c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029a0:	83 c0 08             	add    $0x8,%eax
+  8029a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029a6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8029a9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8029ae:	e9 4e 01 00 00       	jmp    802b01 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8029b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8029b9:	77 18                	ja     8029d3 <vprintfmt+0x4ae>
+  8029bb:	89 c2                	mov    %eax,%edx
+  8029bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029c1:	83 c0 08             	add    $0x8,%eax
+  8029c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029c7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8029c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8029ce:	e9 2e 01 00 00       	jmp    802b01 <vprintfmt+0x5dc>
+  8029d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029df:	eb e6                	jmp    8029c7 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  8029e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029ed:	eb b7                	jmp    8029a6 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  8029ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029fb:	e9 51 ff ff ff       	jmp    802951 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802a00:	40 84 f6             	test   %sil,%sil
+  802a03:	75 2e                	jne    802a33 <vprintfmt+0x50e>
+    switch (lflag) {
+  802a05:	85 d2                	test   %edx,%edx
+  802a07:	7f 59                	jg     802a62 <vprintfmt+0x53d>
+  802a09:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802a0c:	7d 77                	jge    802a85 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a11:	83 f8 2f             	cmp    $0x2f,%eax
+  802a14:	0f 87 a4 00 00 00    	ja     802abe <vprintfmt+0x599>
+  802a1a:	89 c2                	mov    %eax,%edx
+  802a1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a20:	83 c0 08             	add    $0x8,%eax
+  802a23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802a29:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802a2e:	e9 ce 00 00 00       	jmp    802b01 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802a33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a36:	83 f8 2f             	cmp    $0x2f,%eax
+  802a39:	77 19                	ja     802a54 <vprintfmt+0x52f>
+  802a3b:	89 c2                	mov    %eax,%edx
+  802a3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a41:	83 c0 08             	add    $0x8,%eax
+  802a44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802a4a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802a4f:	e9 ad 00 00 00       	jmp    802b01 <vprintfmt+0x5dc>
+  802a54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a60:	eb e5                	jmp    802a47 <vprintfmt+0x522>
+    switch (lflag) {
+  802a62:	83 fa 01             	cmp    $0x1,%edx
+  802a65:	75 a7                	jne    802a0e <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802a67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a6a:	83 f8 2f             	cmp    $0x2f,%eax
+  802a6d:	77 41                	ja     802ab0 <vprintfmt+0x58b>
+  802a6f:	89 c2                	mov    %eax,%edx
+  802a71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a75:	83 c0 08             	add    $0x8,%eax
+  802a78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a7b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802a7e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802a83:	eb 7c                	jmp    802b01 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802a85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a88:	83 f8 2f             	cmp    $0x2f,%eax
+  802a8b:	77 15                	ja     802aa2 <vprintfmt+0x57d>
+  802a8d:	89 c2                	mov    %eax,%edx
+  802a8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a93:	83 c0 08             	add    $0x8,%eax
+  802a96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a99:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802a9b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802aa0:	eb 5f                	jmp    802b01 <vprintfmt+0x5dc>
+  802aa2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802aa6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802aaa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802aae:	eb e9                	jmp    802a99 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802abc:	eb bd                	jmp    802a7b <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802abe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ac2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ac6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802aca:	e9 57 ff ff ff       	jmp    802a26 <vprintfmt+0x501>
+            putch('0', put_arg);
+  802acf:	4c 89 ee             	mov    %r13,%rsi
+  802ad2:	bf 30 00 00 00       	mov    $0x30,%edi
+  802ad7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802ada:	4c 89 ee             	mov    %r13,%rsi
+  802add:	bf 78 00 00 00       	mov    $0x78,%edi
+  802ae2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802ae5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ae8:	83 f8 2f             	cmp    $0x2f,%eax
+  802aeb:	77 47                	ja     802b34 <vprintfmt+0x60f>
+  802aed:	89 c2                	mov    %eax,%edx
+  802aef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802af3:	83 c0 08             	add    $0x8,%eax
+  802af6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802af9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802afc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802b01:	48 83 ec 08          	sub    $0x8,%rsp
+  802b05:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802b09:	0f 94 c0             	sete   %al
+  802b0c:	0f b6 c0             	movzbl %al,%eax
+  802b0f:	50                   	push   %rax
+  802b10:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802b15:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802b19:	4c 89 ee             	mov    %r13,%rsi
+  802b1c:	4c 89 f7             	mov    %r14,%rdi
+  802b1f:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  802b26:	00 00 00 
+  802b29:	ff d0                	call   *%rax
+            break;
+  802b2b:	48 83 c4 10          	add    $0x10,%rsp
+  802b2f:	e9 31 fa ff ff       	jmp    802565 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802b34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b40:	eb b7                	jmp    802af9 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802b42:	40 84 f6             	test   %sil,%sil
+  802b45:	75 2b                	jne    802b72 <vprintfmt+0x64d>
+    switch (lflag) {
+  802b47:	85 d2                	test   %edx,%edx
+  802b49:	7f 56                	jg     802ba1 <vprintfmt+0x67c>
+  802b4b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802b4e:	7d 77                	jge    802bc7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802b50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b53:	83 f8 2f             	cmp    $0x2f,%eax
+  802b56:	0f 87 a7 00 00 00    	ja     802c03 <vprintfmt+0x6de>
+  802b5c:	89 c2                	mov    %eax,%edx
+  802b5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b62:	83 c0 08             	add    $0x8,%eax
+  802b65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b68:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802b6b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802b70:	eb 8f                	jmp    802b01 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802b72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b75:	83 f8 2f             	cmp    $0x2f,%eax
+  802b78:	77 19                	ja     802b93 <vprintfmt+0x66e>
+  802b7a:	89 c2                	mov    %eax,%edx
+  802b7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b80:	83 c0 08             	add    $0x8,%eax
+  802b83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802b89:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802b8e:	e9 6e ff ff ff       	jmp    802b01 <vprintfmt+0x5dc>
+  802b93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b9f:	eb e5                	jmp    802b86 <vprintfmt+0x661>
+    switch (lflag) {
+  802ba1:	83 fa 01             	cmp    $0x1,%edx
+  802ba4:	75 aa                	jne    802b50 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  802bac:	77 47                	ja     802bf5 <vprintfmt+0x6d0>
+  802bae:	89 c2                	mov    %eax,%edx
+  802bb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bb4:	83 c0 08             	add    $0x8,%eax
+  802bb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802bbd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802bc2:	e9 3a ff ff ff       	jmp    802b01 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802bc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bca:	83 f8 2f             	cmp    $0x2f,%eax
+  802bcd:	77 18                	ja     802be7 <vprintfmt+0x6c2>
+  802bcf:	89 c2                	mov    %eax,%edx
+  802bd1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802bd5:	83 c0 08             	add    $0x8,%eax
+  802bd8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802bdb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802bdd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802be2:	e9 1a ff ff ff       	jmp    802b01 <vprintfmt+0x5dc>
+  802be7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802beb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bf3:	eb e6                	jmp    802bdb <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802bf5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bf9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c01:	eb b7                	jmp    802bba <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802c03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c0f:	e9 54 ff ff ff       	jmp    802b68 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802c14:	4c 89 ee             	mov    %r13,%rsi
+  802c17:	bf 25 00 00 00       	mov    $0x25,%edi
+  802c1c:	41 ff d6             	call   *%r14
+            break;
+  802c1f:	e9 41 f9 ff ff       	jmp    802565 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802c24:	4c 89 ee             	mov    %r13,%rsi
+  802c27:	bf 25 00 00 00       	mov    $0x25,%edi
+  802c2c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802c2f:	48 83 eb 01          	sub    $0x1,%rbx
+  802c33:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802c37:	75 f6                	jne    802c2f <vprintfmt+0x70a>
+  802c39:	e9 27 f9 ff ff       	jmp    802565 <vprintfmt+0x40>
+
+0000000000802c3e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802c3e:	55                   	push   %rbp
+  802c3f:	48 89 e5             	mov    %rsp,%rbp
+  802c42:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802c46:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802c4a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802c4f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802c53:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802c5a:	48 85 ff             	test   %rdi,%rdi
+  802c5d:	74 2b                	je     802c8a <vsnprintf+0x4c>
+  802c5f:	48 85 f6             	test   %rsi,%rsi
+  802c62:	74 26                	je     802c8a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802c64:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c68:	48 bf d0 24 80 00 00 	movabs $0x8024d0,%rdi
+  802c6f:	00 00 00 
+  802c72:	48 b8 25 25 80 00 00 	movabs $0x802525,%rax
+  802c79:	00 00 00 
+  802c7c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802c7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c82:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802c85:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802c88:	c9                   	leave
+  802c89:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802c8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c8f:	eb f7                	jmp    802c88 <vsnprintf+0x4a>
+
+0000000000802c91 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802c91:	55                   	push   %rbp
+  802c92:	48 89 e5             	mov    %rsp,%rbp
+  802c95:	48 83 ec 50          	sub    $0x50,%rsp
+  802c99:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802c9d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802ca1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ca5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802cac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802cb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cb4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802cb8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802cbc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802cc0:	48 b8 3e 2c 80 00 00 	movabs $0x802c3e,%rax
+  802cc7:	00 00 00 
+  802cca:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802ccc:	c9                   	leave
+  802ccd:	c3                   	ret
+
+0000000000802cce <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802cce:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802cd1:	74 10                	je     802ce3 <strlen+0x15>
+    size_t n = 0;
+  802cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802cd8:	48 83 c0 01          	add    $0x1,%rax
+  802cdc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802ce0:	75 f6                	jne    802cd8 <strlen+0xa>
+  802ce2:	c3                   	ret
+    size_t n = 0;
+  802ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802ce8:	c3                   	ret
+
+0000000000802ce9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802ce9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802cec:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802cf1:	48 85 f6             	test   %rsi,%rsi
+  802cf4:	74 11                	je     802d07 <strnlen+0x1e>
+  802cf6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802cfa:	74 0c                	je     802d08 <strnlen+0x1f>
+  802cfc:	48 83 c2 01          	add    $0x1,%rdx
+  802d00:	48 39 d0             	cmp    %rdx,%rax
+  802d03:	75 f1                	jne    802cf6 <strnlen+0xd>
+  802d05:	eb 04                	jmp    802d0b <strnlen+0x22>
+  802d07:	c3                   	ret
+  802d08:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802d0b:	c3                   	ret
+
+0000000000802d0c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802d0c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d14:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802d18:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802d1b:	48 83 c2 01          	add    $0x1,%rdx
+  802d1f:	84 c9                	test   %cl,%cl
+  802d21:	75 f1                	jne    802d14 <strcpy+0x8>
+        ;
+    return res;
+}
+  802d23:	c3                   	ret
+
+0000000000802d24 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802d24:	55                   	push   %rbp
+  802d25:	48 89 e5             	mov    %rsp,%rbp
+  802d28:	41 54                	push   %r12
+  802d2a:	53                   	push   %rbx
+  802d2b:	48 89 fb             	mov    %rdi,%rbx
+  802d2e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802d31:	48 b8 ce 2c 80 00 00 	movabs $0x802cce,%rax
+  802d38:	00 00 00 
+  802d3b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802d3d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802d41:	4c 89 e6             	mov    %r12,%rsi
+  802d44:	48 b8 0c 2d 80 00 00 	movabs $0x802d0c,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+    return dst;
+}
+  802d50:	48 89 d8             	mov    %rbx,%rax
+  802d53:	5b                   	pop    %rbx
+  802d54:	41 5c                	pop    %r12
+  802d56:	5d                   	pop    %rbp
+  802d57:	c3                   	ret
+
+0000000000802d58 <toupper>:
+
+int
+toupper(int ch) {
+  802d58:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802d5a:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802d5d:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802d60:	83 f9 1a             	cmp    $0x1a,%ecx
+  802d63:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802d66:	c3                   	ret
+
+0000000000802d67 <tolower>:
+
+int
+tolower(int ch) {
+  802d67:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802d69:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802d6c:	8d 57 20             	lea    0x20(%rdi),%edx
+  802d6f:	83 f9 1a             	cmp    $0x1a,%ecx
+  802d72:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802d75:	c3                   	ret
+
+0000000000802d76 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802d76:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802d79:	48 85 d2             	test   %rdx,%rdx
+  802d7c:	74 1f                	je     802d9d <strncpy+0x27>
+  802d7e:	48 01 fa             	add    %rdi,%rdx
+  802d81:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802d84:	48 83 c1 01          	add    $0x1,%rcx
+  802d88:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802d8c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802d90:	41 80 f8 01          	cmp    $0x1,%r8b
+  802d94:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802d98:	48 39 ca             	cmp    %rcx,%rdx
+  802d9b:	75 e7                	jne    802d84 <strncpy+0xe>
+    }
+    return ret;
+}
+  802d9d:	c3                   	ret
+
+0000000000802d9e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802d9e:	48 89 f8             	mov    %rdi,%rax
+  802da1:	48 85 d2             	test   %rdx,%rdx
+  802da4:	74 24                	je     802dca <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802da6:	48 83 ea 01          	sub    $0x1,%rdx
+  802daa:	74 1b                	je     802dc7 <strlcpy+0x29>
+  802dac:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802db0:	0f b6 16             	movzbl (%rsi),%edx
+  802db3:	84 d2                	test   %dl,%dl
+  802db5:	74 10                	je     802dc7 <strlcpy+0x29>
+            *dst++ = *src++;
+  802db7:	48 83 c6 01          	add    $0x1,%rsi
+  802dbb:	48 83 c0 01          	add    $0x1,%rax
+  802dbf:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802dc2:	48 39 c8             	cmp    %rcx,%rax
+  802dc5:	75 e9                	jne    802db0 <strlcpy+0x12>
+        *dst = '\0';
+  802dc7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802dca:	48 29 f8             	sub    %rdi,%rax
+}
+  802dcd:	c3                   	ret
+
+0000000000802dce <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802dce:	0f b6 07             	movzbl (%rdi),%eax
+  802dd1:	84 c0                	test   %al,%al
+  802dd3:	74 13                	je     802de8 <strcmp+0x1a>
+  802dd5:	38 06                	cmp    %al,(%rsi)
+  802dd7:	75 0f                	jne    802de8 <strcmp+0x1a>
+  802dd9:	48 83 c7 01          	add    $0x1,%rdi
+  802ddd:	48 83 c6 01          	add    $0x1,%rsi
+  802de1:	0f b6 07             	movzbl (%rdi),%eax
+  802de4:	84 c0                	test   %al,%al
+  802de6:	75 ed                	jne    802dd5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802de8:	0f b6 c0             	movzbl %al,%eax
+  802deb:	0f b6 16             	movzbl (%rsi),%edx
+  802dee:	29 d0                	sub    %edx,%eax
+}
+  802df0:	c3                   	ret
+
+0000000000802df1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802df1:	48 85 d2             	test   %rdx,%rdx
+  802df4:	74 1f                	je     802e15 <strncmp+0x24>
+  802df6:	0f b6 07             	movzbl (%rdi),%eax
+  802df9:	84 c0                	test   %al,%al
+  802dfb:	74 1e                	je     802e1b <strncmp+0x2a>
+  802dfd:	3a 06                	cmp    (%rsi),%al
+  802dff:	75 1a                	jne    802e1b <strncmp+0x2a>
+  802e01:	48 83 c7 01          	add    $0x1,%rdi
+  802e05:	48 83 c6 01          	add    $0x1,%rsi
+  802e09:	48 83 ea 01          	sub    $0x1,%rdx
+  802e0d:	75 e7                	jne    802df6 <strncmp+0x5>
+
+    if (!n) return 0;
+  802e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e14:	c3                   	ret
+  802e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e1a:	c3                   	ret
+  802e1b:	48 85 d2             	test   %rdx,%rdx
+  802e1e:	74 09                	je     802e29 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802e20:	0f b6 07             	movzbl (%rdi),%eax
+  802e23:	0f b6 16             	movzbl (%rsi),%edx
+  802e26:	29 d0                	sub    %edx,%eax
+  802e28:	c3                   	ret
+    if (!n) return 0;
+  802e29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e2e:	c3                   	ret
+
+0000000000802e2f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802e2f:	0f b6 17             	movzbl (%rdi),%edx
+  802e32:	84 d2                	test   %dl,%dl
+  802e34:	74 18                	je     802e4e <strchr+0x1f>
+        if (*str == c) {
+  802e36:	0f be d2             	movsbl %dl,%edx
+  802e39:	39 f2                	cmp    %esi,%edx
+  802e3b:	74 17                	je     802e54 <strchr+0x25>
+    for (; *str; str++) {
+  802e3d:	48 83 c7 01          	add    $0x1,%rdi
+  802e41:	0f b6 17             	movzbl (%rdi),%edx
+  802e44:	84 d2                	test   %dl,%dl
+  802e46:	75 ee                	jne    802e36 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e4d:	c3                   	ret
+  802e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e53:	c3                   	ret
+  802e54:	48 89 f8             	mov    %rdi,%rax
+}
+  802e57:	c3                   	ret
+
+0000000000802e58 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802e58:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802e5b:	0f b6 17             	movzbl (%rdi),%edx
+  802e5e:	84 d2                	test   %dl,%dl
+  802e60:	74 13                	je     802e75 <strfind+0x1d>
+  802e62:	0f be d2             	movsbl %dl,%edx
+  802e65:	39 f2                	cmp    %esi,%edx
+  802e67:	74 0b                	je     802e74 <strfind+0x1c>
+  802e69:	48 83 c0 01          	add    $0x1,%rax
+  802e6d:	0f b6 10             	movzbl (%rax),%edx
+  802e70:	84 d2                	test   %dl,%dl
+  802e72:	75 ee                	jne    802e62 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802e74:	c3                   	ret
+  802e75:	c3                   	ret
+
+0000000000802e76 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802e76:	48 39 f7             	cmp    %rsi,%rdi
+  802e79:	74 65                	je     802ee0 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802e7b:	55                   	push   %rbp
+  802e7c:	48 89 e5             	mov    %rsp,%rbp
+  802e7f:	41 57                	push   %r15
+  802e81:	41 56                	push   %r14
+  802e83:	41 55                	push   %r13
+  802e85:	41 54                	push   %r12
+  802e87:	53                   	push   %rbx
+  802e88:	48 83 ec 18          	sub    $0x18,%rsp
+  802e8c:	48 89 fb             	mov    %rdi,%rbx
+  802e8f:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802e92:	49 bf 67 2d 80 00 00 	movabs $0x802d67,%r15
+  802e99:	00 00 00 
+  802e9c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802ea0:	41 0f b6 fd          	movzbl %r13b,%edi
+  802ea4:	41 ff d7             	call   *%r15
+  802ea7:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802eaa:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802eaf:	41 0f b6 fe          	movzbl %r14b,%edi
+  802eb3:	41 ff d7             	call   *%r15
+  802eb6:	89 c2                	mov    %eax,%edx
+  802eb8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ebb:	29 d0                	sub    %edx,%eax
+  802ebd:	75 12                	jne    802ed1 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802ebf:	48 83 c3 01          	add    $0x1,%rbx
+  802ec3:	45 84 ed             	test   %r13b,%r13b
+  802ec6:	74 09                	je     802ed1 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802ec8:	49 83 c4 01          	add    $0x1,%r12
+  802ecc:	45 84 f6             	test   %r14b,%r14b
+  802ecf:	75 cb                	jne    802e9c <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802ed1:	48 83 c4 18          	add    $0x18,%rsp
+  802ed5:	5b                   	pop    %rbx
+  802ed6:	41 5c                	pop    %r12
+  802ed8:	41 5d                	pop    %r13
+  802eda:	41 5e                	pop    %r14
+  802edc:	41 5f                	pop    %r15
+  802ede:	5d                   	pop    %rbp
+  802edf:	c3                   	ret
+    if (p1 == p2) return 0;
+  802ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee5:	c3                   	ret
+
+0000000000802ee6 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802ee6:	48 39 f7             	cmp    %rsi,%rdi
+  802ee9:	74 7d                	je     802f68 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802eeb:	55                   	push   %rbp
+  802eec:	48 89 e5             	mov    %rsp,%rbp
+  802eef:	41 57                	push   %r15
+  802ef1:	41 56                	push   %r14
+  802ef3:	41 55                	push   %r13
+  802ef5:	41 54                	push   %r12
+  802ef7:	53                   	push   %rbx
+  802ef8:	48 83 ec 18          	sub    $0x18,%rsp
+  802efc:	48 89 fb             	mov    %rdi,%rbx
+  802eff:	49 89 f4             	mov    %rsi,%r12
+  802f02:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802f06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802f0a:	49 bf 67 2d 80 00 00 	movabs $0x802d67,%r15
+  802f11:	00 00 00 
+    while (n--) {
+  802f14:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f18:	48 39 c3             	cmp    %rax,%rbx
+  802f1b:	74 37                	je     802f54 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802f1d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802f21:	41 0f b6 fd          	movzbl %r13b,%edi
+  802f25:	41 ff d7             	call   *%r15
+  802f28:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802f2b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802f30:	41 0f b6 fe          	movzbl %r14b,%edi
+  802f34:	41 ff d7             	call   *%r15
+  802f37:	89 c2                	mov    %eax,%edx
+  802f39:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802f3c:	29 d0                	sub    %edx,%eax
+  802f3e:	75 19                	jne    802f59 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802f40:	48 83 c3 01          	add    $0x1,%rbx
+  802f44:	45 84 ed             	test   %r13b,%r13b
+  802f47:	74 10                	je     802f59 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802f49:	49 83 c4 01          	add    $0x1,%r12
+  802f4d:	45 84 f6             	test   %r14b,%r14b
+  802f50:	75 c2                	jne    802f14 <strncasecmp+0x2e>
+  802f52:	eb 05                	jmp    802f59 <strncasecmp+0x73>
+  802f54:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802f59:	48 83 c4 18          	add    $0x18,%rsp
+  802f5d:	5b                   	pop    %rbx
+  802f5e:	41 5c                	pop    %r12
+  802f60:	41 5d                	pop    %r13
+  802f62:	41 5e                	pop    %r14
+  802f64:	41 5f                	pop    %r15
+  802f66:	5d                   	pop    %rbp
+  802f67:	c3                   	ret
+    if (p1 == p2) return 0;
+  802f68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f6d:	c3                   	ret
+
+0000000000802f6e <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802f6e:	83 e7 df             	and    $0xffffffdf,%edi
+  802f71:	83 ef 41             	sub    $0x41,%edi
+  802f74:	83 ff 19             	cmp    $0x19,%edi
+  802f77:	0f 96 c0             	setbe  %al
+}
+  802f7a:	c3                   	ret
+
+0000000000802f7b <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802f7b:	83 ff 20             	cmp    $0x20,%edi
+  802f7e:	0f 94 c0             	sete   %al
+  802f81:	83 ff 09             	cmp    $0x9,%edi
+  802f84:	0f 94 c2             	sete   %dl
+  802f87:	09 d0                	or     %edx,%eax
+}
+  802f89:	c3                   	ret
+
+0000000000802f8a <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802f8a:	55                   	push   %rbp
+  802f8b:	48 89 e5             	mov    %rsp,%rbp
+  802f8e:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802f90:	48 bf 1f 6f 80 00 00 	movabs $0x806f1f,%rdi
+  802f97:	00 00 00 
+  802f9a:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  802fa1:	00 00 00 
+  802fa4:	ff d0                	call   *%rax
+  802fa6:	48 85 c0             	test   %rax,%rax
+  802fa9:	0f 95 c0             	setne  %al
+}
+  802fac:	5d                   	pop    %rbp
+  802fad:	c3                   	ret
+
+0000000000802fae <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802fae:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802fb1:	48 89 f8             	mov    %rdi,%rax
+  802fb4:	48 f7 d8             	neg    %rax
+  802fb7:	83 e0 07             	and    $0x7,%eax
+  802fba:	49 89 d1             	mov    %rdx,%r9
+  802fbd:	49 29 c1             	sub    %rax,%r9
+  802fc0:	78 36                	js     802ff8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802fc2:	40 0f b6 c6          	movzbl %sil,%eax
+  802fc6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802fcd:	01 01 01 
+  802fd0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802fd4:	40 f6 c7 07          	test   $0x7,%dil
+  802fd8:	75 38                	jne    803012 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802fda:	4c 89 c9             	mov    %r9,%rcx
+  802fdd:	48 c1 f9 03          	sar    $0x3,%rcx
+  802fe1:	74 0c                	je     802fef <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802fe3:	fc                   	cld
+  802fe4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802fe7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802feb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802fef:	4d 85 c9             	test   %r9,%r9
+  802ff2:	75 45                	jne    803039 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802ff4:	4c 89 c0             	mov    %r8,%rax
+  802ff7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802ff8:	48 85 d2             	test   %rdx,%rdx
+  802ffb:	74 f7                	je     802ff4 <memset+0x46>
+  802ffd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803000:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803003:	48 83 c0 01          	add    $0x1,%rax
+  803007:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80300b:	48 39 c2             	cmp    %rax,%rdx
+  80300e:	75 f3                	jne    803003 <memset+0x55>
+  803010:	eb e2                	jmp    802ff4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803012:	40 f6 c7 01          	test   $0x1,%dil
+  803016:	74 06                	je     80301e <memset+0x70>
+  803018:	88 07                	mov    %al,(%rdi)
+  80301a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80301e:	40 f6 c7 02          	test   $0x2,%dil
+  803022:	74 07                	je     80302b <memset+0x7d>
+  803024:	66 89 07             	mov    %ax,(%rdi)
+  803027:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80302b:	40 f6 c7 04          	test   $0x4,%dil
+  80302f:	74 a9                	je     802fda <memset+0x2c>
+  803031:	89 07                	mov    %eax,(%rdi)
+  803033:	48 83 c7 04          	add    $0x4,%rdi
+  803037:	eb a1                	jmp    802fda <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803039:	41 f6 c1 04          	test   $0x4,%r9b
+  80303d:	74 06                	je     803045 <memset+0x97>
+  80303f:	89 07                	mov    %eax,(%rdi)
+  803041:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803045:	41 f6 c1 02          	test   $0x2,%r9b
+  803049:	74 07                	je     803052 <memset+0xa4>
+  80304b:	66 89 07             	mov    %ax,(%rdi)
+  80304e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803052:	41 f6 c1 01          	test   $0x1,%r9b
+  803056:	74 9c                	je     802ff4 <memset+0x46>
+  803058:	88 07                	mov    %al,(%rdi)
+  80305a:	eb 98                	jmp    802ff4 <memset+0x46>
+
+000000000080305c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80305c:	48 89 f8             	mov    %rdi,%rax
+  80305f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803062:	48 39 fe             	cmp    %rdi,%rsi
+  803065:	73 3b                	jae    8030a2 <memmove+0x46>
+  803067:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80306b:	48 39 d7             	cmp    %rdx,%rdi
+  80306e:	73 32                	jae    8030a2 <memmove+0x46>
+        s += n;
+        d += n;
+  803070:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803074:	48 89 d6             	mov    %rdx,%rsi
+  803077:	48 09 fe             	or     %rdi,%rsi
+  80307a:	48 09 ce             	or     %rcx,%rsi
+  80307d:	40 f6 c6 07          	test   $0x7,%sil
+  803081:	75 12                	jne    803095 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803083:	48 83 ef 08          	sub    $0x8,%rdi
+  803087:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80308b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80308f:	fd                   	std
+  803090:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803093:	fc                   	cld
+  803094:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803095:	48 83 ef 01          	sub    $0x1,%rdi
+  803099:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80309d:	fd                   	std
+  80309e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8030a0:	eb f1                	jmp    803093 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8030a2:	48 89 f2             	mov    %rsi,%rdx
+  8030a5:	48 09 c2             	or     %rax,%rdx
+  8030a8:	48 09 ca             	or     %rcx,%rdx
+  8030ab:	f6 c2 07             	test   $0x7,%dl
+  8030ae:	75 0c                	jne    8030bc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8030b0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8030b4:	48 89 c7             	mov    %rax,%rdi
+  8030b7:	fc                   	cld
+  8030b8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8030bb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8030bc:	48 89 c7             	mov    %rax,%rdi
+  8030bf:	fc                   	cld
+  8030c0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8030c2:	c3                   	ret
+
+00000000008030c3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8030c3:	55                   	push   %rbp
+  8030c4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8030c7:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  8030ce:	00 00 00 
+  8030d1:	ff d0                	call   *%rax
+}
+  8030d3:	5d                   	pop    %rbp
+  8030d4:	c3                   	ret
+
+00000000008030d5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8030d5:	55                   	push   %rbp
+  8030d6:	48 89 e5             	mov    %rsp,%rbp
+  8030d9:	41 57                	push   %r15
+  8030db:	41 56                	push   %r14
+  8030dd:	41 55                	push   %r13
+  8030df:	41 54                	push   %r12
+  8030e1:	53                   	push   %rbx
+  8030e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8030e6:	49 89 fe             	mov    %rdi,%r14
+  8030e9:	49 89 f7             	mov    %rsi,%r15
+  8030ec:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8030ef:	48 89 f7             	mov    %rsi,%rdi
+  8030f2:	48 b8 ce 2c 80 00 00 	movabs $0x802cce,%rax
+  8030f9:	00 00 00 
+  8030fc:	ff d0                	call   *%rax
+  8030fe:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803101:	48 89 de             	mov    %rbx,%rsi
+  803104:	4c 89 f7             	mov    %r14,%rdi
+  803107:	48 b8 e9 2c 80 00 00 	movabs $0x802ce9,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+  803113:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803116:	48 39 c3             	cmp    %rax,%rbx
+  803119:	74 36                	je     803151 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80311b:	48 89 d8             	mov    %rbx,%rax
+  80311e:	4c 29 e8             	sub    %r13,%rax
+  803121:	49 39 c4             	cmp    %rax,%r12
+  803124:	73 31                	jae    803157 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803126:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80312b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80312f:	4c 89 fe             	mov    %r15,%rsi
+  803132:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80313e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803142:	48 83 c4 08          	add    $0x8,%rsp
+  803146:	5b                   	pop    %rbx
+  803147:	41 5c                	pop    %r12
+  803149:	41 5d                	pop    %r13
+  80314b:	41 5e                	pop    %r14
+  80314d:	41 5f                	pop    %r15
+  80314f:	5d                   	pop    %rbp
+  803150:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803151:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803155:	eb eb                	jmp    803142 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803157:	48 83 eb 01          	sub    $0x1,%rbx
+  80315b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80315f:	48 89 da             	mov    %rbx,%rdx
+  803162:	4c 89 fe             	mov    %r15,%rsi
+  803165:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  80316c:	00 00 00 
+  80316f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803171:	49 01 de             	add    %rbx,%r14
+  803174:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803179:	eb c3                	jmp    80313e <strlcat+0x69>
+
+000000000080317b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80317b:	48 85 d2             	test   %rdx,%rdx
+  80317e:	74 2d                	je     8031ad <memcmp+0x32>
+  803180:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803185:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803189:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80318e:	44 38 c1             	cmp    %r8b,%cl
+  803191:	75 0f                	jne    8031a2 <memcmp+0x27>
+    while (n-- > 0) {
+  803193:	48 83 c0 01          	add    $0x1,%rax
+  803197:	48 39 c2             	cmp    %rax,%rdx
+  80319a:	75 e9                	jne    803185 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80319c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8031a2:	0f b6 c1             	movzbl %cl,%eax
+  8031a5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8031a9:	44 29 c0             	sub    %r8d,%eax
+  8031ac:	c3                   	ret
+    return 0;
+  8031ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031b2:	c3                   	ret
+
+00000000008031b3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8031b3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8031b7:	48 39 c7             	cmp    %rax,%rdi
+  8031ba:	73 0f                	jae    8031cb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8031bc:	40 38 37             	cmp    %sil,(%rdi)
+  8031bf:	74 0e                	je     8031cf <memfind+0x1c>
+    for (; src < end; src++) {
+  8031c1:	48 83 c7 01          	add    $0x1,%rdi
+  8031c5:	48 39 f8             	cmp    %rdi,%rax
+  8031c8:	75 f2                	jne    8031bc <memfind+0x9>
+  8031ca:	c3                   	ret
+  8031cb:	48 89 f8             	mov    %rdi,%rax
+  8031ce:	c3                   	ret
+  8031cf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8031d2:	c3                   	ret
+
+00000000008031d3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8031d3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8031d6:	0f b6 37             	movzbl (%rdi),%esi
+  8031d9:	40 80 fe 20          	cmp    $0x20,%sil
+  8031dd:	74 06                	je     8031e5 <strtol+0x12>
+  8031df:	40 80 fe 09          	cmp    $0x9,%sil
+  8031e3:	75 13                	jne    8031f8 <strtol+0x25>
+  8031e5:	48 83 c7 01          	add    $0x1,%rdi
+  8031e9:	0f b6 37             	movzbl (%rdi),%esi
+  8031ec:	40 80 fe 20          	cmp    $0x20,%sil
+  8031f0:	74 f3                	je     8031e5 <strtol+0x12>
+  8031f2:	40 80 fe 09          	cmp    $0x9,%sil
+  8031f6:	74 ed                	je     8031e5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8031f8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8031fb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8031fe:	3c 01                	cmp    $0x1,%al
+  803200:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803204:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80320a:	75 0f                	jne    80321b <strtol+0x48>
+  80320c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80320f:	74 14                	je     803225 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803211:	85 d2                	test   %edx,%edx
+  803213:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803218:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80321b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803220:	4c 63 ca             	movslq %edx,%r9
+  803223:	eb 36                	jmp    80325b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803225:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803229:	74 0f                	je     80323a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80322b:	85 d2                	test   %edx,%edx
+  80322d:	75 ec                	jne    80321b <strtol+0x48>
+        s++;
+  80322f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803233:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803238:	eb e1                	jmp    80321b <strtol+0x48>
+        s += 2;
+  80323a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80323e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803243:	eb d6                	jmp    80321b <strtol+0x48>
+            dig -= '0';
+  803245:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803248:	44 0f b6 c1          	movzbl %cl,%r8d
+  80324c:	41 39 d0             	cmp    %edx,%r8d
+  80324f:	7d 21                	jge    803272 <strtol+0x9f>
+        val = val * base + dig;
+  803251:	49 0f af c1          	imul   %r9,%rax
+  803255:	0f b6 c9             	movzbl %cl,%ecx
+  803258:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80325b:	48 83 c7 01          	add    $0x1,%rdi
+  80325f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803263:	80 f9 39             	cmp    $0x39,%cl
+  803266:	76 dd                	jbe    803245 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803268:	80 f9 7b             	cmp    $0x7b,%cl
+  80326b:	77 05                	ja     803272 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80326d:	83 e9 57             	sub    $0x57,%ecx
+  803270:	eb d6                	jmp    803248 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803272:	4d 85 d2             	test   %r10,%r10
+  803275:	74 03                	je     80327a <strtol+0xa7>
+  803277:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80327a:	48 89 c2             	mov    %rax,%rdx
+  80327d:	48 f7 da             	neg    %rdx
+  803280:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803284:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803288:	c3                   	ret
+
+0000000000803289 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  803289:	55                   	push   %rbp
+  80328a:	48 89 e5             	mov    %rsp,%rbp
+  80328d:	53                   	push   %rbx
+  80328e:	48 89 fa             	mov    %rdi,%rdx
+  803291:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803294:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80329e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8032a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8032ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8032b4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8032b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032ba:	c9                   	leave
+  8032bb:	c3                   	ret
+
+00000000008032bc <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8032bc:	55                   	push   %rbp
+  8032bd:	48 89 e5             	mov    %rsp,%rbp
+  8032c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8032c1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8032d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032da:	be 00 00 00 00       	mov    $0x0,%esi
+  8032df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8032e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8032eb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8032ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032f1:	c9                   	leave
+  8032f2:	c3                   	ret
+
+00000000008032f3 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8032f3:	55                   	push   %rbp
+  8032f4:	48 89 e5             	mov    %rsp,%rbp
+  8032f7:	53                   	push   %rbx
+  8032f8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032fb:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803300:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80330a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80330f:	be 00 00 00 00       	mov    $0x0,%esi
+  803314:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80331a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803320:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  803322:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803326:	c9                   	leave
+  803327:	c3                   	ret
+
+0000000000803328 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  803328:	55                   	push   %rbp
+  803329:	48 89 e5             	mov    %rsp,%rbp
+  80332c:	53                   	push   %rbx
+  80332d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  803331:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803334:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803339:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80333e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803343:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803348:	be 00 00 00 00       	mov    $0x0,%esi
+  80334d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803353:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803359:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80335b:	48 85 c0             	test   %rax,%rax
+  80335e:	7f 06                	jg     803366 <sys_env_destroy+0x3e>
+}
+  803360:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803364:	c9                   	leave
+  803365:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803366:	49 89 c0             	mov    %rax,%r8
+  803369:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80336e:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  803375:	00 00 00 
+  803378:	be 27 00 00 00       	mov    $0x27,%esi
+  80337d:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  803384:	00 00 00 
+  803387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338c:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  803393:	00 00 00 
+  803396:	41 ff d1             	call   *%r9
+
+0000000000803399 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  803399:	55                   	push   %rbp
+  80339a:	48 89 e5             	mov    %rsp,%rbp
+  80339d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80339e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8033a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8033ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8033bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033c8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8033ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ce:	c9                   	leave
+  8033cf:	c3                   	ret
+
+00000000008033d0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8033d0:	55                   	push   %rbp
+  8033d1:	48 89 e5             	mov    %rsp,%rbp
+  8033d4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8033d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8033da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033df:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8033e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8033f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033ff:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803401:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803405:	c9                   	leave
+  803406:	c3                   	ret
+
+0000000000803407 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  803407:	55                   	push   %rbp
+  803408:	48 89 e5             	mov    %rsp,%rbp
+  80340b:	53                   	push   %rbx
+  80340c:	48 89 fa             	mov    %rdi,%rdx
+  80340f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803412:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803417:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80341e:	00 00 00 
+  803421:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803426:	be 00 00 00 00       	mov    $0x0,%esi
+  80342b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803431:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803437:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  803439:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80343d:	c9                   	leave
+  80343e:	c3                   	ret
+
+000000000080343f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80343f:	55                   	push   %rbp
+  803440:	48 89 e5             	mov    %rsp,%rbp
+  803443:	53                   	push   %rbx
+  803444:	49 89 f8             	mov    %rdi,%r8
+  803447:	48 89 d3             	mov    %rdx,%rbx
+  80344a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80344d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803452:	4c 89 c2             	mov    %r8,%rdx
+  803455:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803458:	be 00 00 00 00       	mov    $0x0,%esi
+  80345d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803463:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803469:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80346b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80346f:	c9                   	leave
+  803470:	c3                   	ret
+
+0000000000803471 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  803471:	55                   	push   %rbp
+  803472:	48 89 e5             	mov    %rsp,%rbp
+  803475:	53                   	push   %rbx
+  803476:	48 83 ec 08          	sub    $0x8,%rsp
+  80347a:	89 f8                	mov    %edi,%eax
+  80347c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80347f:	48 63 f9             	movslq %ecx,%rdi
+  803482:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803485:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80348a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80348d:	be 00 00 00 00       	mov    $0x0,%esi
+  803492:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803498:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80349e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8034a0:	48 85 c0             	test   %rax,%rax
+  8034a3:	7f 06                	jg     8034ab <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8034a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034a9:	c9                   	leave
+  8034aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8034ab:	49 89 c0             	mov    %rax,%r8
+  8034ae:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8034b3:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  8034ba:	00 00 00 
+  8034bd:	be 27 00 00 00       	mov    $0x27,%esi
+  8034c2:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  8034c9:	00 00 00 
+  8034cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d1:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  8034d8:	00 00 00 
+  8034db:	41 ff d1             	call   *%r9
+
+00000000008034de <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8034de:	55                   	push   %rbp
+  8034df:	48 89 e5             	mov    %rsp,%rbp
+  8034e2:	53                   	push   %rbx
+  8034e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8034e7:	89 f8                	mov    %edi,%eax
+  8034e9:	49 89 f2             	mov    %rsi,%r10
+  8034ec:	48 89 cf             	mov    %rcx,%rdi
+  8034ef:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8034f2:	48 63 da             	movslq %edx,%rbx
+  8034f5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8034f8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8034fd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803500:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  803503:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803509:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80350b:	48 85 c0             	test   %rax,%rax
+  80350e:	7f 06                	jg     803516 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  803510:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803514:	c9                   	leave
+  803515:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803516:	49 89 c0             	mov    %rax,%r8
+  803519:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80351e:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  803525:	00 00 00 
+  803528:	be 27 00 00 00       	mov    $0x27,%esi
+  80352d:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  803534:	00 00 00 
+  803537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353c:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  803543:	00 00 00 
+  803546:	41 ff d1             	call   *%r9
+
+0000000000803549 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  803549:	55                   	push   %rbp
+  80354a:	48 89 e5             	mov    %rsp,%rbp
+  80354d:	53                   	push   %rbx
+  80354e:	48 83 ec 08          	sub    $0x8,%rsp
+  803552:	48 89 f1             	mov    %rsi,%rcx
+  803555:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  803558:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80355b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803560:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803565:	be 00 00 00 00       	mov    $0x0,%esi
+  80356a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803570:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803576:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803578:	48 85 c0             	test   %rax,%rax
+  80357b:	7f 06                	jg     803583 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80357d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803581:	c9                   	leave
+  803582:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803583:	49 89 c0             	mov    %rax,%r8
+  803586:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80358b:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  803592:	00 00 00 
+  803595:	be 27 00 00 00       	mov    $0x27,%esi
+  80359a:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  8035a1:	00 00 00 
+  8035a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a9:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  8035b0:	00 00 00 
+  8035b3:	41 ff d1             	call   *%r9
+
+00000000008035b6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8035b6:	55                   	push   %rbp
+  8035b7:	48 89 e5             	mov    %rsp,%rbp
+  8035ba:	53                   	push   %rbx
+  8035bb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  8035bf:	48 63 ce             	movslq %esi,%rcx
+  8035c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8035c5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8035ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8035d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8035df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8035e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8035e7:	48 85 c0             	test   %rax,%rax
+  8035ea:	7f 06                	jg     8035f2 <sys_env_set_status+0x3c>
+}
+  8035ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035f0:	c9                   	leave
+  8035f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8035f2:	49 89 c0             	mov    %rax,%r8
+  8035f5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8035fa:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  803601:	00 00 00 
+  803604:	be 27 00 00 00       	mov    $0x27,%esi
+  803609:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  803610:	00 00 00 
+  803613:	b8 00 00 00 00       	mov    $0x0,%eax
+  803618:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  80361f:	00 00 00 
+  803622:	41 ff d1             	call   *%r9
+
+0000000000803625 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  803625:	55                   	push   %rbp
+  803626:	48 89 e5             	mov    %rsp,%rbp
+  803629:	53                   	push   %rbx
+  80362a:	48 83 ec 08          	sub    $0x8,%rsp
+  80362e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  803631:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803634:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803639:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80363e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803643:	be 00 00 00 00       	mov    $0x0,%esi
+  803648:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80364e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803654:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803656:	48 85 c0             	test   %rax,%rax
+  803659:	7f 06                	jg     803661 <sys_env_set_trapframe+0x3c>
+}
+  80365b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80365f:	c9                   	leave
+  803660:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803661:	49 89 c0             	mov    %rax,%r8
+  803664:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  803669:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  803670:	00 00 00 
+  803673:	be 27 00 00 00       	mov    $0x27,%esi
+  803678:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  80367f:	00 00 00 
+  803682:	b8 00 00 00 00       	mov    $0x0,%eax
+  803687:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  80368e:	00 00 00 
+  803691:	41 ff d1             	call   *%r9
+
+0000000000803694 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  803694:	55                   	push   %rbp
+  803695:	48 89 e5             	mov    %rsp,%rbp
+  803698:	53                   	push   %rbx
+  803699:	48 83 ec 08          	sub    $0x8,%rsp
+  80369d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  8036a0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8036a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8036a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8036b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8036bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8036c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8036c5:	48 85 c0             	test   %rax,%rax
+  8036c8:	7f 06                	jg     8036d0 <sys_env_set_pgfault_upcall+0x3c>
+}
+  8036ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ce:	c9                   	leave
+  8036cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8036d0:	49 89 c0             	mov    %rax,%r8
+  8036d3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8036d8:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  8036df:	00 00 00 
+  8036e2:	be 27 00 00 00       	mov    $0x27,%esi
+  8036e7:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  8036ee:	00 00 00 
+  8036f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f6:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  8036fd:	00 00 00 
+  803700:	41 ff d1             	call   *%r9
+
+0000000000803703 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  803703:	55                   	push   %rbp
+  803704:	48 89 e5             	mov    %rsp,%rbp
+  803707:	53                   	push   %rbx
+  803708:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  80370c:	40 0f b6 ce          	movzbl %sil,%ecx
+  803710:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803713:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803718:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80371d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803722:	be 00 00 00 00       	mov    $0x0,%esi
+  803727:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80372d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803733:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803735:	48 85 c0             	test   %rax,%rax
+  803738:	7f 06                	jg     803740 <sys_env_set_reclaim+0x3d>
+}
+  80373a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80373e:	c9                   	leave
+  80373f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803740:	49 89 c0             	mov    %rax,%r8
+  803743:	b9 16 00 00 00       	mov    $0x16,%ecx
+  803748:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  80374f:	00 00 00 
+  803752:	be 27 00 00 00       	mov    $0x27,%esi
+  803757:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  80375e:	00 00 00 
+  803761:	b8 00 00 00 00       	mov    $0x0,%eax
+  803766:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  80376d:	00 00 00 
+  803770:	41 ff d1             	call   *%r9
+
+0000000000803773 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  803773:	55                   	push   %rbp
+  803774:	48 89 e5             	mov    %rsp,%rbp
+  803777:	53                   	push   %rbx
+  803778:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  80377c:	48 63 ce             	movslq %esi,%rcx
+  80377f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803782:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803787:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80378c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803791:	be 00 00 00 00       	mov    $0x0,%esi
+  803796:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80379c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8037a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8037a4:	48 85 c0             	test   %rax,%rax
+  8037a7:	7f 06                	jg     8037af <sys_env_set_nice+0x3c>
+}
+  8037a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037ad:	c9                   	leave
+  8037ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8037af:	49 89 c0             	mov    %rax,%r8
+  8037b2:	b9 18 00 00 00       	mov    $0x18,%ecx
+  8037b7:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  8037be:	00 00 00 
+  8037c1:	be 27 00 00 00       	mov    $0x27,%esi
+  8037c6:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  8037cd:	00 00 00 
+  8037d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d5:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  8037dc:	00 00 00 
+  8037df:	41 ff d1             	call   *%r9
+
+00000000008037e2 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  8037e2:	55                   	push   %rbp
+  8037e3:	48 89 e5             	mov    %rsp,%rbp
+  8037e6:	53                   	push   %rbx
+  8037e7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8037ea:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8037ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8037f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8037fe:	be 00 00 00 00       	mov    $0x0,%esi
+  803803:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803809:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80380f:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  803811:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803815:	c9                   	leave
+  803816:	c3                   	ret
+
+0000000000803817 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803817:	55                   	push   %rbp
+  803818:	48 89 e5             	mov    %rsp,%rbp
+  80381b:	53                   	push   %rbx
+  80381c:	89 f8                	mov    %edi,%eax
+  80381e:	49 89 f1             	mov    %rsi,%r9
+  803821:	48 89 d3             	mov    %rdx,%rbx
+  803824:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803827:	49 63 f0             	movslq %r8d,%rsi
+  80382a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80382d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803832:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803835:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80383b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803841:	cd 30                	int    $0x30
+}
+  803843:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803847:	c9                   	leave
+  803848:	c3                   	ret
+
+0000000000803849 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803849:	55                   	push   %rbp
+  80384a:	48 89 e5             	mov    %rsp,%rbp
+  80384d:	53                   	push   %rbx
+  80384e:	89 f8                	mov    %edi,%eax
+  803850:	49 89 f1             	mov    %rsi,%r9
+  803853:	48 89 d3             	mov    %rdx,%rbx
+  803856:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803859:	49 63 f0             	movslq %r8d,%rsi
+  80385c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80385f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803864:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803867:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80386d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803873:	cd 30                	int    $0x30
+}
+  803875:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803879:	c9                   	leave
+  80387a:	c3                   	ret
+
+000000000080387b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80387b:	55                   	push   %rbp
+  80387c:	48 89 e5             	mov    %rsp,%rbp
+  80387f:	53                   	push   %rbx
+  803880:	48 83 ec 08          	sub    $0x8,%rsp
+  803884:	89 f8                	mov    %edi,%eax
+  803886:	49 89 f2             	mov    %rsi,%r10
+  803889:	48 89 d3             	mov    %rdx,%rbx
+  80388c:	48 89 cf             	mov    %rcx,%rdi
+  80388f:	44 89 c6             	mov    %r8d,%esi
+  803892:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803895:	48 63 f6             	movslq %esi,%rsi
+  803898:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80389b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8038a0:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  8038a3:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  8038a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8038a9:	48 85 c0             	test   %rax,%rax
+  8038ac:	7f 06                	jg     8038b4 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8038ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038b2:	c9                   	leave
+  8038b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8038b4:	49 89 c0             	mov    %rax,%r8
+  8038b7:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8038bc:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  8038c3:	00 00 00 
+  8038c6:	be 27 00 00 00       	mov    $0x27,%esi
+  8038cb:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  8038d2:	00 00 00 
+  8038d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038da:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  8038e1:	00 00 00 
+  8038e4:	41 ff d1             	call   *%r9
+
+00000000008038e7 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  8038e7:	55                   	push   %rbp
+  8038e8:	48 89 e5             	mov    %rsp,%rbp
+  8038eb:	53                   	push   %rbx
+  8038ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8038f0:	48 89 f1             	mov    %rsi,%rcx
+  8038f3:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  8038f6:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  8038fa:	48 8b 1a             	mov    (%rdx),%rbx
+  8038fd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803900:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803905:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803909:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  80390d:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  803911:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803913:	48 85 c0             	test   %rax,%rax
+  803916:	7f 06                	jg     80391e <sys_ipc_call_short+0x37>
+}
+  803918:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80391c:	c9                   	leave
+  80391d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80391e:	49 89 c0             	mov    %rax,%r8
+  803921:	b9 10 00 00 00       	mov    $0x10,%ecx
+  803926:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  80392d:	00 00 00 
+  803930:	be 27 00 00 00       	mov    $0x27,%esi
+  803935:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  80393c:	00 00 00 
+  80393f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803944:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  80394b:	00 00 00 
+  80394e:	41 ff d1             	call   *%r9
+
+0000000000803951 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  803951:	55                   	push   %rbp
+  803952:	48 89 e5             	mov    %rsp,%rbp
+  803955:	53                   	push   %rbx
+  803956:	48 83 ec 08          	sub    $0x8,%rsp
+  80395a:	89 f8                	mov    %edi,%eax
+  80395c:	49 89 f2             	mov    %rsi,%r10
+  80395f:	48 89 d3             	mov    %rdx,%rbx
+  803962:	48 89 cf             	mov    %rcx,%rdi
+  803965:	44 89 c6             	mov    %r8d,%esi
+  803968:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  80396b:	48 63 f6             	movslq %esi,%rsi
+  80396e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803971:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803976:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803979:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  80397d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80397f:	48 85 c0             	test   %rax,%rax
+  803982:	7f 06                	jg     80398a <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803984:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803988:	c9                   	leave
+  803989:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80398a:	49 89 c0             	mov    %rax,%r8
+  80398d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803992:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  803999:	00 00 00 
+  80399c:	be 27 00 00 00       	mov    $0x27,%esi
+  8039a1:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  8039a8:	00 00 00 
+  8039ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b0:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  8039b7:	00 00 00 
+  8039ba:	41 ff d1             	call   *%r9
+
+00000000008039bd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8039bd:	55                   	push   %rbp
+  8039be:	48 89 e5             	mov    %rsp,%rbp
+  8039c1:	53                   	push   %rbx
+  8039c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8039c6:	48 89 fa             	mov    %rdi,%rdx
+  8039c9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8039cc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8039d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8039db:	be 00 00 00 00       	mov    $0x0,%esi
+  8039e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8039e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8039ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8039ee:	48 85 c0             	test   %rax,%rax
+  8039f1:	7f 06                	jg     8039f9 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8039f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039f7:	c9                   	leave
+  8039f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8039f9:	49 89 c0             	mov    %rax,%r8
+  8039fc:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803a01:	48 ba 28 6f 80 00 00 	movabs $0x806f28,%rdx
+  803a08:	00 00 00 
+  803a0b:	be 27 00 00 00       	mov    $0x27,%esi
+  803a10:	48 bf 47 6f 80 00 00 	movabs $0x806f47,%rdi
+  803a17:	00 00 00 
+  803a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a1f:	49 b9 85 22 80 00 00 	movabs $0x802285,%r9
+  803a26:	00 00 00 
+  803a29:	41 ff d1             	call   *%r9
+
+0000000000803a2c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803a2c:	55                   	push   %rbp
+  803a2d:	48 89 e5             	mov    %rsp,%rbp
+  803a30:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803a31:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803a36:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803a40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803a4a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803a55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803a5b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803a5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a61:	c9                   	leave
+  803a62:	c3                   	ret
+
+0000000000803a63 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  803a63:	55                   	push   %rbp
+  803a64:	48 89 e5             	mov    %rsp,%rbp
+  803a67:	53                   	push   %rbx
+  803a68:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803a6b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803a70:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803a75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803a7f:	be 00 00 00 00       	mov    $0x0,%esi
+  803a84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803a8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803a90:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803a92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a96:	c9                   	leave
+  803a97:	c3                   	ret
+
+0000000000803a98 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803a98:	55                   	push   %rbp
+  803a99:	48 89 e5             	mov    %rsp,%rbp
+  803a9c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803a9d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803aa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803aa7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803aac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ab1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803ab6:	be 00 00 00 00       	mov    $0x0,%esi
+  803abb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803ac1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803ac7:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803ac9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803acd:	c9                   	leave
+  803ace:	c3                   	ret
+
+0000000000803acf <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  803acf:	55                   	push   %rbp
+  803ad0:	48 89 e5             	mov    %rsp,%rbp
+  803ad3:	41 56                	push   %r14
+  803ad5:	41 55                	push   %r13
+  803ad7:	41 54                	push   %r12
+  803ad9:	53                   	push   %rbx
+  803ada:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803add:	48 b8 48 92 80 01 00 	movabs $0x1809248,%rax
+  803ae4:	00 00 00 
+  803ae7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803aeb:	74 27                	je     803b14 <_handle_vectored_pagefault+0x45>
+  803aed:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  803af2:	49 bd 00 92 80 01 00 	movabs $0x1809200,%r13
+  803af9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803afc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  803aff:	4c 89 e7             	mov    %r12,%rdi
+  803b02:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803b07:	84 c0                	test   %al,%al
+  803b09:	75 45                	jne    803b50 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b0b:	48 83 c3 01          	add    $0x1,%rbx
+  803b0f:	49 3b 1e             	cmp    (%r14),%rbx
+  803b12:	72 eb                	jb     803aff <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  803b14:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  803b1b:	00 
+  803b1c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  803b21:	4d 8b 04 24          	mov    (%r12),%r8
+  803b25:	48 ba 58 6f 80 00 00 	movabs $0x806f58,%rdx
+  803b2c:	00 00 00 
+  803b2f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  803b34:	48 bf 88 6f 80 00 00 	movabs $0x806f88,%rdi
+  803b3b:	00 00 00 
+  803b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b43:	49 ba 85 22 80 00 00 	movabs $0x802285,%r10
+  803b4a:	00 00 00 
+  803b4d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803b50:	5b                   	pop    %rbx
+  803b51:	41 5c                	pop    %r12
+  803b53:	41 5d                	pop    %r13
+  803b55:	41 5e                	pop    %r14
+  803b57:	5d                   	pop    %rbp
+  803b58:	c3                   	ret
+
+0000000000803b59 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  803b59:	55                   	push   %rbp
+  803b5a:	48 89 e5             	mov    %rsp,%rbp
+  803b5d:	53                   	push   %rbx
+  803b5e:	48 83 ec 08          	sub    $0x8,%rsp
+  803b62:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  803b65:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  803b6a:	48 b8 40 92 80 01 00 	movabs $0x1809240,%rax
+  803b71:	00 00 00 
+  803b74:	80 38 00             	cmpb   $0x0,(%rax)
+  803b77:	74 68                	je     803be1 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b79:	48 b8 48 92 80 01 00 	movabs $0x1809248,%rax
+  803b80:	00 00 00 
+  803b83:	48 8b 08             	mov    (%rax),%rcx
+  803b86:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  803b8b:	48 b8 00 92 80 01 00 	movabs $0x1809200,%rax
+  803b92:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b95:	48 85 c9             	test   %rcx,%rcx
+  803b98:	0f 84 e0 00 00 00    	je     803c7e <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  803b9e:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  803ba2:	0f 84 c9 00 00 00    	je     803c71 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803ba8:	48 83 c2 01          	add    $0x1,%rdx
+  803bac:	48 39 ca             	cmp    %rcx,%rdx
+  803baf:	75 ed                	jne    803b9e <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  803bb1:	48 83 f9 08          	cmp    $0x8,%rcx
+  803bb5:	0f 84 84 00 00 00    	je     803c3f <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803bbb:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  803bbf:	48 a3 48 92 80 01 00 	movabs %rax,0x1809248
+  803bc6:	00 00 00 
+  803bc9:	48 b8 00 92 80 01 00 	movabs $0x1809200,%rax
+  803bd0:	00 00 00 
+  803bd3:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803bd7:	85 f6                	test   %esi,%esi
+  803bd9:	0f 89 97 00 00 00    	jns    803c76 <add_pgfault_handler+0x11d>
+  803bdf:	eb 63                	jmp    803c44 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  803be1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803be6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  803beb:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  803bf2:	00 00 00 
+  803bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bfa:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  803c01:	00 00 00 
+  803c04:	ff d0                	call   *%rax
+  803c06:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  803c08:	85 c0                	test   %eax,%eax
+  803c0a:	78 38                	js     803c44 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803c0c:	48 be 5a 3d 80 00 00 	movabs $0x803d5a,%rsi
+  803c13:	00 00 00 
+  803c16:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1b:	48 b8 94 36 80 00 00 	movabs $0x803694,%rax
+  803c22:	00 00 00 
+  803c25:	ff d0                	call   *%rax
+  803c27:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  803c29:	85 c0                	test   %eax,%eax
+  803c2b:	78 17                	js     803c44 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  803c2d:	48 b8 40 92 80 01 00 	movabs $0x1809240,%rax
+  803c34:	00 00 00 
+  803c37:	c6 00 01             	movb   $0x1,(%rax)
+  803c3a:	e9 3a ff ff ff       	jmp    803b79 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  803c3f:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803c44:	89 f1                	mov    %esi,%ecx
+  803c46:	48 ba 96 6f 80 00 00 	movabs $0x806f96,%rdx
+  803c4d:	00 00 00 
+  803c50:	be 42 00 00 00       	mov    $0x42,%esi
+  803c55:	48 bf 88 6f 80 00 00 	movabs $0x806f88,%rdi
+  803c5c:	00 00 00 
+  803c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c64:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  803c6b:	00 00 00 
+  803c6e:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  803c71:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  803c76:	89 f0                	mov    %esi,%eax
+  803c78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c7c:	c9                   	leave
+  803c7d:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803c7e:	48 b8 48 92 80 01 00 	movabs $0x1809248,%rax
+  803c85:	00 00 00 
+  803c88:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  803c8f:	48 89 d8             	mov    %rbx,%rax
+  803c92:	48 a3 00 92 80 01 00 	movabs %rax,0x1809200
+  803c99:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  803c9c:	eb d8                	jmp    803c76 <add_pgfault_handler+0x11d>
+
+0000000000803c9e <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  803c9e:	55                   	push   %rbp
+  803c9f:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  803ca2:	48 b8 40 92 80 01 00 	movabs $0x1809240,%rax
+  803ca9:	00 00 00 
+  803cac:	80 38 00             	cmpb   $0x0,(%rax)
+  803caf:	74 33                	je     803ce4 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803cb1:	48 a1 48 92 80 01 00 	movabs 0x1809248,%rax
+  803cb8:	00 00 00 
+  803cbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803cc0:	48 ba 00 92 80 01 00 	movabs $0x1809200,%rdx
+  803cc7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803cca:	48 85 c0             	test   %rax,%rax
+  803ccd:	0f 84 85 00 00 00    	je     803d58 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803cd3:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803cd7:	74 40                	je     803d19 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803cd9:	48 83 c1 01          	add    $0x1,%rcx
+  803cdd:	48 39 c1             	cmp    %rax,%rcx
+  803ce0:	75 f1                	jne    803cd3 <remove_pgfault_handler+0x35>
+  803ce2:	eb 74                	jmp    803d58 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803ce4:	48 b9 ae 6f 80 00 00 	movabs $0x806fae,%rcx
+  803ceb:	00 00 00 
+  803cee:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  803cf5:	00 00 00 
+  803cf8:	be 48 00 00 00       	mov    $0x48,%esi
+  803cfd:	48 bf 88 6f 80 00 00 	movabs $0x806f88,%rdi
+  803d04:	00 00 00 
+  803d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d0c:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  803d13:	00 00 00 
+  803d16:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803d19:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803d20:	00 
+  803d21:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803d25:	48 29 ca             	sub    %rcx,%rdx
+  803d28:	48 b8 00 92 80 01 00 	movabs $0x1809200,%rax
+  803d2f:	00 00 00 
+  803d32:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803d36:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803d3b:	48 89 ce             	mov    %rcx,%rsi
+  803d3e:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  803d45:	00 00 00 
+  803d48:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  803d4a:	48 b8 48 92 80 01 00 	movabs $0x1809248,%rax
+  803d51:	00 00 00 
+  803d54:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  803d58:	5d                   	pop    %rbp
+  803d59:	c3                   	ret
+
+0000000000803d5a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  803d5a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  803d5d:	48 b8 cf 3a 80 00 00 	movabs $0x803acf,%rax
+  803d64:	00 00 00 
+    call *%rax
+  803d67:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  803d69:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  803d70:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  803d71:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  803d78:	00 
+    subq $8, %rcx
+  803d79:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  803d7d:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  803d80:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  803d87:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  803d88:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  803d8c:	4c 8b 3c 24          	mov    (%rsp),%r15
+  803d90:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  803d95:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  803d9a:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  803d9f:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  803da4:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  803da9:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803dae:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  803db3:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  803db8:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  803dbd:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  803dc2:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  803dc7:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  803dcc:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  803dd1:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  803dd6:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  803dda:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  803dde:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  803ddf:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803de0:	c3                   	ret
+
+0000000000803de1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803de1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803de8:	ff ff ff 
+  803deb:	48 01 f8             	add    %rdi,%rax
+  803dee:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803df2:	c3                   	ret
+
+0000000000803df3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803df3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803dfa:	ff ff ff 
+  803dfd:	48 01 f8             	add    %rdi,%rax
+  803e00:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803e04:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803e0a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803e0e:	c3                   	ret
+
+0000000000803e0f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803e0f:	55                   	push   %rbp
+  803e10:	48 89 e5             	mov    %rsp,%rbp
+  803e13:	41 57                	push   %r15
+  803e15:	41 56                	push   %r14
+  803e17:	41 55                	push   %r13
+  803e19:	41 54                	push   %r12
+  803e1b:	53                   	push   %rbx
+  803e1c:	48 83 ec 08          	sub    $0x8,%rsp
+  803e20:	49 89 ff             	mov    %rdi,%r15
+  803e23:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803e28:	49 bd 0f 53 80 00 00 	movabs $0x80530f,%r13
+  803e2f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803e32:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803e38:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803e3b:	48 89 df             	mov    %rbx,%rdi
+  803e3e:	41 ff d5             	call   *%r13
+  803e41:	83 e0 04             	and    $0x4,%eax
+  803e44:	74 17                	je     803e5d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803e46:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e4d:	4c 39 f3             	cmp    %r14,%rbx
+  803e50:	75 e6                	jne    803e38 <fd_alloc+0x29>
+  803e52:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803e58:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803e5d:	4d 89 27             	mov    %r12,(%r15)
+}
+  803e60:	48 83 c4 08          	add    $0x8,%rsp
+  803e64:	5b                   	pop    %rbx
+  803e65:	41 5c                	pop    %r12
+  803e67:	41 5d                	pop    %r13
+  803e69:	41 5e                	pop    %r14
+  803e6b:	41 5f                	pop    %r15
+  803e6d:	5d                   	pop    %rbp
+  803e6e:	c3                   	ret
+
+0000000000803e6f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803e6f:	83 ff 1f             	cmp    $0x1f,%edi
+  803e72:	77 39                	ja     803ead <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803e74:	55                   	push   %rbp
+  803e75:	48 89 e5             	mov    %rsp,%rbp
+  803e78:	41 54                	push   %r12
+  803e7a:	53                   	push   %rbx
+  803e7b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803e7e:	48 63 df             	movslq %edi,%rbx
+  803e81:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803e88:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803e8c:	48 89 df             	mov    %rbx,%rdi
+  803e8f:	48 b8 0f 53 80 00 00 	movabs $0x80530f,%rax
+  803e96:	00 00 00 
+  803e99:	ff d0                	call   *%rax
+  803e9b:	a8 04                	test   $0x4,%al
+  803e9d:	74 14                	je     803eb3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803e9f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ea8:	5b                   	pop    %rbx
+  803ea9:	41 5c                	pop    %r12
+  803eab:	5d                   	pop    %rbp
+  803eac:	c3                   	ret
+        return -E_INVAL;
+  803ead:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803eb2:	c3                   	ret
+        return -E_INVAL;
+  803eb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803eb8:	eb ee                	jmp    803ea8 <fd_lookup+0x39>
+
+0000000000803eba <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803eba:	55                   	push   %rbp
+  803ebb:	48 89 e5             	mov    %rsp,%rbp
+  803ebe:	41 54                	push   %r12
+  803ec0:	53                   	push   %rbx
+  803ec1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803ec4:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803ecb:	00 00 00 
+  803ece:	48 bb 40 80 80 00 00 	movabs $0x808040,%rbx
+  803ed5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803ed8:	39 3b                	cmp    %edi,(%rbx)
+  803eda:	74 47                	je     803f23 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803edc:	48 83 c0 08          	add    $0x8,%rax
+  803ee0:	48 8b 18             	mov    (%rax),%rbx
+  803ee3:	48 85 db             	test   %rbx,%rbx
+  803ee6:	75 f0                	jne    803ed8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803ee8:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  803eef:	00 00 00 
+  803ef2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803ef8:	89 fa                	mov    %edi,%edx
+  803efa:	48 bf e0 6f 80 00 00 	movabs $0x806fe0,%rdi
+  803f01:	00 00 00 
+  803f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f09:	48 b9 d5 23 80 00 00 	movabs $0x8023d5,%rcx
+  803f10:	00 00 00 
+  803f13:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803f15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803f1a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803f1e:	5b                   	pop    %rbx
+  803f1f:	41 5c                	pop    %r12
+  803f21:	5d                   	pop    %rbp
+  803f22:	c3                   	ret
+            return 0;
+  803f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f28:	eb f0                	jmp    803f1a <dev_lookup+0x60>
+
+0000000000803f2a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803f2a:	55                   	push   %rbp
+  803f2b:	48 89 e5             	mov    %rsp,%rbp
+  803f2e:	41 55                	push   %r13
+  803f30:	41 54                	push   %r12
+  803f32:	53                   	push   %rbx
+  803f33:	48 83 ec 18          	sub    $0x18,%rsp
+  803f37:	48 89 fb             	mov    %rdi,%rbx
+  803f3a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803f3d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803f44:	ff ff ff 
+  803f47:	48 01 df             	add    %rbx,%rdi
+  803f4a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803f4e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f52:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  803f59:	00 00 00 
+  803f5c:	ff d0                	call   *%rax
+  803f5e:	41 89 c5             	mov    %eax,%r13d
+  803f61:	85 c0                	test   %eax,%eax
+  803f63:	78 06                	js     803f6b <fd_close+0x41>
+  803f65:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803f69:	74 1a                	je     803f85 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803f6b:	45 84 e4             	test   %r12b,%r12b
+  803f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f73:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803f77:	44 89 e8             	mov    %r13d,%eax
+  803f7a:	48 83 c4 18          	add    $0x18,%rsp
+  803f7e:	5b                   	pop    %rbx
+  803f7f:	41 5c                	pop    %r12
+  803f81:	41 5d                	pop    %r13
+  803f83:	5d                   	pop    %rbp
+  803f84:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803f85:	8b 3b                	mov    (%rbx),%edi
+  803f87:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803f8b:	48 b8 ba 3e 80 00 00 	movabs $0x803eba,%rax
+  803f92:	00 00 00 
+  803f95:	ff d0                	call   *%rax
+  803f97:	41 89 c5             	mov    %eax,%r13d
+  803f9a:	85 c0                	test   %eax,%eax
+  803f9c:	78 1b                	js     803fb9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803f9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803fa2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803fa6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803fac:	48 85 c0             	test   %rax,%rax
+  803faf:	74 08                	je     803fb9 <fd_close+0x8f>
+  803fb1:	48 89 df             	mov    %rbx,%rdi
+  803fb4:	ff d0                	call   *%rax
+  803fb6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803fb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fbe:	48 89 de             	mov    %rbx,%rsi
+  803fc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc6:	48 b8 49 35 80 00 00 	movabs $0x803549,%rax
+  803fcd:	00 00 00 
+  803fd0:	ff d0                	call   *%rax
+    return res;
+  803fd2:	eb a3                	jmp    803f77 <fd_close+0x4d>
+
+0000000000803fd4 <close>:
+
+int
+close(int fdnum) {
+  803fd4:	55                   	push   %rbp
+  803fd5:	48 89 e5             	mov    %rsp,%rbp
+  803fd8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803fdc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803fe0:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  803fe7:	00 00 00 
+  803fea:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fec:	85 c0                	test   %eax,%eax
+  803fee:	78 15                	js     804005 <close+0x31>
+
+    return fd_close(fd, 1);
+  803ff0:	be 01 00 00 00       	mov    $0x1,%esi
+  803ff5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ff9:	48 b8 2a 3f 80 00 00 	movabs $0x803f2a,%rax
+  804000:	00 00 00 
+  804003:	ff d0                	call   *%rax
+}
+  804005:	c9                   	leave
+  804006:	c3                   	ret
+
+0000000000804007 <close_all>:
+
+void
+close_all(void) {
+  804007:	55                   	push   %rbp
+  804008:	48 89 e5             	mov    %rsp,%rbp
+  80400b:	41 54                	push   %r12
+  80400d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80400e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804013:	49 bc d4 3f 80 00 00 	movabs $0x803fd4,%r12
+  80401a:	00 00 00 
+  80401d:	89 df                	mov    %ebx,%edi
+  80401f:	41 ff d4             	call   *%r12
+  804022:	83 c3 01             	add    $0x1,%ebx
+  804025:	83 fb 20             	cmp    $0x20,%ebx
+  804028:	75 f3                	jne    80401d <close_all+0x16>
+}
+  80402a:	5b                   	pop    %rbx
+  80402b:	41 5c                	pop    %r12
+  80402d:	5d                   	pop    %rbp
+  80402e:	c3                   	ret
+
+000000000080402f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80402f:	55                   	push   %rbp
+  804030:	48 89 e5             	mov    %rsp,%rbp
+  804033:	41 57                	push   %r15
+  804035:	41 56                	push   %r14
+  804037:	41 55                	push   %r13
+  804039:	41 54                	push   %r12
+  80403b:	53                   	push   %rbx
+  80403c:	48 83 ec 18          	sub    $0x18,%rsp
+  804040:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  804043:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804047:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  80404e:	00 00 00 
+  804051:	ff d0                	call   *%rax
+  804053:	89 c3                	mov    %eax,%ebx
+  804055:	85 c0                	test   %eax,%eax
+  804057:	0f 88 b8 00 00 00    	js     804115 <dup+0xe6>
+    close(newfdnum);
+  80405d:	44 89 e7             	mov    %r12d,%edi
+  804060:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  804067:	00 00 00 
+  80406a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80406c:	4d 63 ec             	movslq %r12d,%r13
+  80406f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  804076:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80407a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80407e:	4c 89 ff             	mov    %r15,%rdi
+  804081:	49 be f3 3d 80 00 00 	movabs $0x803df3,%r14
+  804088:	00 00 00 
+  80408b:	41 ff d6             	call   *%r14
+  80408e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  804091:	4c 89 ef             	mov    %r13,%rdi
+  804094:	41 ff d6             	call   *%r14
+  804097:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80409a:	48 89 df             	mov    %rbx,%rdi
+  80409d:	48 b8 0f 53 80 00 00 	movabs $0x80530f,%rax
+  8040a4:	00 00 00 
+  8040a7:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8040a9:	a8 04                	test   $0x4,%al
+  8040ab:	74 2b                	je     8040d8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8040ad:	41 89 c1             	mov    %eax,%r9d
+  8040b0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040b6:	4c 89 f1             	mov    %r14,%rcx
+  8040b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040be:	48 89 de             	mov    %rbx,%rsi
+  8040c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c6:	48 b8 de 34 80 00 00 	movabs $0x8034de,%rax
+  8040cd:	00 00 00 
+  8040d0:	ff d0                	call   *%rax
+  8040d2:	89 c3                	mov    %eax,%ebx
+  8040d4:	85 c0                	test   %eax,%eax
+  8040d6:	78 4e                	js     804126 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8040d8:	4c 89 ff             	mov    %r15,%rdi
+  8040db:	48 b8 0f 53 80 00 00 	movabs $0x80530f,%rax
+  8040e2:	00 00 00 
+  8040e5:	ff d0                	call   *%rax
+  8040e7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8040ea:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040f0:	4c 89 e9             	mov    %r13,%rcx
+  8040f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040f8:	4c 89 fe             	mov    %r15,%rsi
+  8040fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804100:	48 b8 de 34 80 00 00 	movabs $0x8034de,%rax
+  804107:	00 00 00 
+  80410a:	ff d0                	call   *%rax
+  80410c:	89 c3                	mov    %eax,%ebx
+  80410e:	85 c0                	test   %eax,%eax
+  804110:	78 14                	js     804126 <dup+0xf7>
+
+    return newfdnum;
+  804112:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  804115:	89 d8                	mov    %ebx,%eax
+  804117:	48 83 c4 18          	add    $0x18,%rsp
+  80411b:	5b                   	pop    %rbx
+  80411c:	41 5c                	pop    %r12
+  80411e:	41 5d                	pop    %r13
+  804120:	41 5e                	pop    %r14
+  804122:	41 5f                	pop    %r15
+  804124:	5d                   	pop    %rbp
+  804125:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  804126:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80412b:	4c 89 ee             	mov    %r13,%rsi
+  80412e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804133:	49 bc 49 35 80 00 00 	movabs $0x803549,%r12
+  80413a:	00 00 00 
+  80413d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  804140:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804145:	4c 89 f6             	mov    %r14,%rsi
+  804148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80414d:	41 ff d4             	call   *%r12
+    return res;
+  804150:	eb c3                	jmp    804115 <dup+0xe6>
+
+0000000000804152 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  804152:	55                   	push   %rbp
+  804153:	48 89 e5             	mov    %rsp,%rbp
+  804156:	41 56                	push   %r14
+  804158:	41 55                	push   %r13
+  80415a:	41 54                	push   %r12
+  80415c:	53                   	push   %rbx
+  80415d:	48 83 ec 10          	sub    $0x10,%rsp
+  804161:	89 fb                	mov    %edi,%ebx
+  804163:	49 89 f4             	mov    %rsi,%r12
+  804166:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804169:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80416d:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  804174:	00 00 00 
+  804177:	ff d0                	call   *%rax
+  804179:	85 c0                	test   %eax,%eax
+  80417b:	78 4c                	js     8041c9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80417d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  804181:	41 8b 3e             	mov    (%r14),%edi
+  804184:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804188:	48 b8 ba 3e 80 00 00 	movabs $0x803eba,%rax
+  80418f:	00 00 00 
+  804192:	ff d0                	call   *%rax
+  804194:	85 c0                	test   %eax,%eax
+  804196:	78 35                	js     8041cd <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804198:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80419c:	83 e0 03             	and    $0x3,%eax
+  80419f:	83 f8 01             	cmp    $0x1,%eax
+  8041a2:	74 2d                	je     8041d1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8041a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041a8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041ac:	48 85 c0             	test   %rax,%rax
+  8041af:	74 56                	je     804207 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8041b1:	4c 89 ea             	mov    %r13,%rdx
+  8041b4:	4c 89 e6             	mov    %r12,%rsi
+  8041b7:	4c 89 f7             	mov    %r14,%rdi
+  8041ba:	ff d0                	call   *%rax
+}
+  8041bc:	48 83 c4 10          	add    $0x10,%rsp
+  8041c0:	5b                   	pop    %rbx
+  8041c1:	41 5c                	pop    %r12
+  8041c3:	41 5d                	pop    %r13
+  8041c5:	41 5e                	pop    %r14
+  8041c7:	5d                   	pop    %rbp
+  8041c8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8041c9:	48 98                	cltq
+  8041cb:	eb ef                	jmp    8041bc <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8041cd:	48 98                	cltq
+  8041cf:	eb eb                	jmp    8041bc <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8041d1:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  8041d8:	00 00 00 
+  8041db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8041e1:	89 da                	mov    %ebx,%edx
+  8041e3:	48 bf 21 70 80 00 00 	movabs $0x807021,%rdi
+  8041ea:	00 00 00 
+  8041ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f2:	48 b9 d5 23 80 00 00 	movabs $0x8023d5,%rcx
+  8041f9:	00 00 00 
+  8041fc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8041fe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804205:	eb b5                	jmp    8041bc <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  804207:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80420e:	eb ac                	jmp    8041bc <read+0x6a>
+
+0000000000804210 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  804210:	55                   	push   %rbp
+  804211:	48 89 e5             	mov    %rsp,%rbp
+  804214:	41 57                	push   %r15
+  804216:	41 56                	push   %r14
+  804218:	41 55                	push   %r13
+  80421a:	41 54                	push   %r12
+  80421c:	53                   	push   %rbx
+  80421d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  804221:	48 85 d2             	test   %rdx,%rdx
+  804224:	74 54                	je     80427a <readn+0x6a>
+  804226:	41 89 fd             	mov    %edi,%r13d
+  804229:	49 89 f6             	mov    %rsi,%r14
+  80422c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80422f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  804234:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  804239:	49 bf 52 41 80 00 00 	movabs $0x804152,%r15
+  804240:	00 00 00 
+  804243:	4c 89 e2             	mov    %r12,%rdx
+  804246:	48 29 f2             	sub    %rsi,%rdx
+  804249:	4c 01 f6             	add    %r14,%rsi
+  80424c:	44 89 ef             	mov    %r13d,%edi
+  80424f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  804252:	85 c0                	test   %eax,%eax
+  804254:	78 20                	js     804276 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  804256:	01 c3                	add    %eax,%ebx
+  804258:	85 c0                	test   %eax,%eax
+  80425a:	74 08                	je     804264 <readn+0x54>
+  80425c:	48 63 f3             	movslq %ebx,%rsi
+  80425f:	4c 39 e6             	cmp    %r12,%rsi
+  804262:	72 df                	jb     804243 <readn+0x33>
+    }
+    return res;
+  804264:	48 63 c3             	movslq %ebx,%rax
+}
+  804267:	48 83 c4 08          	add    $0x8,%rsp
+  80426b:	5b                   	pop    %rbx
+  80426c:	41 5c                	pop    %r12
+  80426e:	41 5d                	pop    %r13
+  804270:	41 5e                	pop    %r14
+  804272:	41 5f                	pop    %r15
+  804274:	5d                   	pop    %rbp
+  804275:	c3                   	ret
+        if (inc < 0) return inc;
+  804276:	48 98                	cltq
+  804278:	eb ed                	jmp    804267 <readn+0x57>
+    int inc = 1, res = 0;
+  80427a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80427f:	eb e3                	jmp    804264 <readn+0x54>
+
+0000000000804281 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  804281:	55                   	push   %rbp
+  804282:	48 89 e5             	mov    %rsp,%rbp
+  804285:	41 56                	push   %r14
+  804287:	41 55                	push   %r13
+  804289:	41 54                	push   %r12
+  80428b:	53                   	push   %rbx
+  80428c:	48 83 ec 10          	sub    $0x10,%rsp
+  804290:	89 fb                	mov    %edi,%ebx
+  804292:	49 89 f4             	mov    %rsi,%r12
+  804295:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804298:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80429c:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  8042a3:	00 00 00 
+  8042a6:	ff d0                	call   *%rax
+  8042a8:	85 c0                	test   %eax,%eax
+  8042aa:	78 47                	js     8042f3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8042ac:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8042b0:	41 8b 3e             	mov    (%r14),%edi
+  8042b3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8042b7:	48 b8 ba 3e 80 00 00 	movabs $0x803eba,%rax
+  8042be:	00 00 00 
+  8042c1:	ff d0                	call   *%rax
+  8042c3:	85 c0                	test   %eax,%eax
+  8042c5:	78 30                	js     8042f7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8042c7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8042cc:	74 2d                	je     8042fb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8042ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042d2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8042d6:	48 85 c0             	test   %rax,%rax
+  8042d9:	74 56                	je     804331 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8042db:	4c 89 ea             	mov    %r13,%rdx
+  8042de:	4c 89 e6             	mov    %r12,%rsi
+  8042e1:	4c 89 f7             	mov    %r14,%rdi
+  8042e4:	ff d0                	call   *%rax
+}
+  8042e6:	48 83 c4 10          	add    $0x10,%rsp
+  8042ea:	5b                   	pop    %rbx
+  8042eb:	41 5c                	pop    %r12
+  8042ed:	41 5d                	pop    %r13
+  8042ef:	41 5e                	pop    %r14
+  8042f1:	5d                   	pop    %rbp
+  8042f2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8042f3:	48 98                	cltq
+  8042f5:	eb ef                	jmp    8042e6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8042f7:	48 98                	cltq
+  8042f9:	eb eb                	jmp    8042e6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8042fb:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  804302:	00 00 00 
+  804305:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80430b:	89 da                	mov    %ebx,%edx
+  80430d:	48 bf 3d 70 80 00 00 	movabs $0x80703d,%rdi
+  804314:	00 00 00 
+  804317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431c:	48 b9 d5 23 80 00 00 	movabs $0x8023d5,%rcx
+  804323:	00 00 00 
+  804326:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  804328:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80432f:	eb b5                	jmp    8042e6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  804331:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  804338:	eb ac                	jmp    8042e6 <write+0x65>
+
+000000000080433a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80433a:	55                   	push   %rbp
+  80433b:	48 89 e5             	mov    %rsp,%rbp
+  80433e:	53                   	push   %rbx
+  80433f:	48 83 ec 18          	sub    $0x18,%rsp
+  804343:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804345:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804349:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  804350:	00 00 00 
+  804353:	ff d0                	call   *%rax
+  804355:	85 c0                	test   %eax,%eax
+  804357:	78 0c                	js     804365 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  804359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80435d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  804360:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804365:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804369:	c9                   	leave
+  80436a:	c3                   	ret
+
+000000000080436b <tell>:
+
+int tell(int fdnum) {
+  80436b:	55                   	push   %rbp
+  80436c:	48 89 e5             	mov    %rsp,%rbp
+  80436f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804373:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804377:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  80437e:	00 00 00 
+  804381:	ff d0                	call   *%rax
+  804383:	85 c0                	test   %eax,%eax
+  804385:	78 07                	js     80438e <tell+0x23>
+
+    return fd->fd_offset;
+  804387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80438b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80438e:	c9                   	leave
+  80438f:	c3                   	ret
+
+0000000000804390 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  804390:	55                   	push   %rbp
+  804391:	48 89 e5             	mov    %rsp,%rbp
+  804394:	41 55                	push   %r13
+  804396:	41 54                	push   %r12
+  804398:	53                   	push   %rbx
+  804399:	48 83 ec 18          	sub    $0x18,%rsp
+  80439d:	89 fb                	mov    %edi,%ebx
+  80439f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8043a2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8043a6:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  8043ad:	00 00 00 
+  8043b0:	ff d0                	call   *%rax
+  8043b2:	85 c0                	test   %eax,%eax
+  8043b4:	78 38                	js     8043ee <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8043b6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8043ba:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8043be:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8043c2:	48 b8 ba 3e 80 00 00 	movabs $0x803eba,%rax
+  8043c9:	00 00 00 
+  8043cc:	ff d0                	call   *%rax
+  8043ce:	85 c0                	test   %eax,%eax
+  8043d0:	78 1c                	js     8043ee <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8043d2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8043d7:	74 20                	je     8043f9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8043d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043dd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8043e1:	48 85 c0             	test   %rax,%rax
+  8043e4:	74 47                	je     80442d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8043e6:	44 89 e6             	mov    %r12d,%esi
+  8043e9:	4c 89 ef             	mov    %r13,%rdi
+  8043ec:	ff d0                	call   *%rax
+}
+  8043ee:	48 83 c4 18          	add    $0x18,%rsp
+  8043f2:	5b                   	pop    %rbx
+  8043f3:	41 5c                	pop    %r12
+  8043f5:	41 5d                	pop    %r13
+  8043f7:	5d                   	pop    %rbp
+  8043f8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8043f9:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  804400:	00 00 00 
+  804403:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804409:	89 da                	mov    %ebx,%edx
+  80440b:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  804412:	00 00 00 
+  804415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80441a:	48 b9 d5 23 80 00 00 	movabs $0x8023d5,%rcx
+  804421:	00 00 00 
+  804424:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  804426:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80442b:	eb c1                	jmp    8043ee <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80442d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804432:	eb ba                	jmp    8043ee <ftruncate+0x5e>
+
+0000000000804434 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  804434:	55                   	push   %rbp
+  804435:	48 89 e5             	mov    %rsp,%rbp
+  804438:	41 54                	push   %r12
+  80443a:	53                   	push   %rbx
+  80443b:	48 83 ec 10          	sub    $0x10,%rsp
+  80443f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804442:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804446:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  80444d:	00 00 00 
+  804450:	ff d0                	call   *%rax
+  804452:	85 c0                	test   %eax,%eax
+  804454:	78 63                	js     8044b9 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804456:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80445a:	41 8b 3c 24          	mov    (%r12),%edi
+  80445e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  804462:	48 b8 ba 3e 80 00 00 	movabs $0x803eba,%rax
+  804469:	00 00 00 
+  80446c:	ff d0                	call   *%rax
+  80446e:	85 c0                	test   %eax,%eax
+  804470:	78 47                	js     8044b9 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  804472:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804476:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80447b:	74 45                	je     8044c2 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80447d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  804480:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  804487:	00 00 00 
+    stat->st_isdir = 0;
+  80448a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804491:	00 00 00 
+    stat->st_ino = 0;
+  804494:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80449b:	00 00 00 00 
+    stat->st_version = 0;
+  80449f:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8044a6:	00 00 00 
+    stat->st_dev = dev;
+  8044a9:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8044b0:	48 89 de             	mov    %rbx,%rsi
+  8044b3:	4c 89 e7             	mov    %r12,%rdi
+  8044b6:	ff 50 28             	call   *0x28(%rax)
+}
+  8044b9:	48 83 c4 10          	add    $0x10,%rsp
+  8044bd:	5b                   	pop    %rbx
+  8044be:	41 5c                	pop    %r12
+  8044c0:	5d                   	pop    %rbp
+  8044c1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8044c2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8044c7:	eb f0                	jmp    8044b9 <fstat+0x85>
+
+00000000008044c9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8044c9:	55                   	push   %rbp
+  8044ca:	48 89 e5             	mov    %rsp,%rbp
+  8044cd:	41 54                	push   %r12
+  8044cf:	53                   	push   %rbx
+  8044d0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8044d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8044d8:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  8044df:	00 00 00 
+  8044e2:	ff d0                	call   *%rax
+  8044e4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8044e6:	85 c0                	test   %eax,%eax
+  8044e8:	78 25                	js     80450f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8044ea:	4c 89 e6             	mov    %r12,%rsi
+  8044ed:	89 c7                	mov    %eax,%edi
+  8044ef:	48 b8 34 44 80 00 00 	movabs $0x804434,%rax
+  8044f6:	00 00 00 
+  8044f9:	ff d0                	call   *%rax
+  8044fb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8044fe:	89 df                	mov    %ebx,%edi
+  804500:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  804507:	00 00 00 
+  80450a:	ff d0                	call   *%rax
+
+    return res;
+  80450c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80450f:	89 d8                	mov    %ebx,%eax
+  804511:	5b                   	pop    %rbx
+  804512:	41 5c                	pop    %r12
+  804514:	5d                   	pop    %rbp
+  804515:	c3                   	ret
+
+0000000000804516 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  804516:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  80451d:	00 00 00 
+  804520:	83 38 00             	cmpl   $0x0,(%rax)
+  804523:	74 0a                	je     80452f <fsipc_env+0x19>
+    return fsenv;
+}
+  804525:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  80452c:	00 00 
+  80452e:	c3                   	ret
+fsipc_env(void) {
+  80452f:	55                   	push   %rbp
+  804530:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  804533:	bf 03 00 00 00       	mov    $0x3,%edi
+  804538:	48 b8 07 63 80 00 00 	movabs $0x806307,%rax
+  80453f:	00 00 00 
+  804542:	ff d0                	call   *%rax
+  804544:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  80454b:	00 00 
+}
+  80454d:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  804554:	00 00 
+  804556:	5d                   	pop    %rbp
+  804557:	c3                   	ret
+
+0000000000804558 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  804558:	55                   	push   %rbp
+  804559:	48 89 e5             	mov    %rsp,%rbp
+  80455c:	53                   	push   %rbx
+  80455d:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  804561:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804568:	00 
+  804569:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  804570:	00 
+  804571:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  804578:	00 
+  804579:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  804580:	00 
+  804581:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804588:	00 
+
+    assert(size <= sizeof(words));
+  804589:	48 83 fa 28          	cmp    $0x28,%rdx
+  80458d:	77 38                	ja     8045c7 <fsipc_short+0x6f>
+  80458f:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  804591:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  804595:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  80459c:	00 00 00 
+  80459f:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8045a1:	48 b8 16 45 80 00 00 	movabs $0x804516,%rax
+  8045a8:	00 00 00 
+  8045ab:	ff d0                	call   *%rax
+  8045ad:	89 c7                	mov    %eax,%edi
+  8045af:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8045b3:	89 de                	mov    %ebx,%esi
+  8045b5:	48 b8 6a 62 80 00 00 	movabs $0x80626a,%rax
+  8045bc:	00 00 00 
+  8045bf:	ff d0                	call   *%rax
+}
+  8045c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045c5:	c9                   	leave
+  8045c6:	c3                   	ret
+    assert(size <= sizeof(words));
+  8045c7:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8045ce:	00 00 00 
+  8045d1:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  8045d8:	00 00 00 
+  8045db:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8045e0:	48 bf 96 70 80 00 00 	movabs $0x807096,%rdi
+  8045e7:	00 00 00 
+  8045ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ef:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  8045f6:	00 00 00 
+  8045f9:	41 ff d0             	call   *%r8
+
+00000000008045fc <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8045fc:	55                   	push   %rbp
+  8045fd:	48 89 e5             	mov    %rsp,%rbp
+  804600:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  804604:	8b 47 0c             	mov    0xc(%rdi),%eax
+  804607:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80460a:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  80460d:	ba 08 00 00 00       	mov    $0x8,%edx
+  804612:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804616:	bf 02 00 00 00       	mov    $0x2,%edi
+  80461b:	48 b8 58 45 80 00 00 	movabs $0x804558,%rax
+  804622:	00 00 00 
+  804625:	ff d0                	call   *%rax
+}
+  804627:	c9                   	leave
+  804628:	c3                   	ret
+
+0000000000804629 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  804629:	55                   	push   %rbp
+  80462a:	48 89 e5             	mov    %rsp,%rbp
+  80462d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  804631:	8b 47 0c             	mov    0xc(%rdi),%eax
+  804634:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  804637:	ba 04 00 00 00       	mov    $0x4,%edx
+  80463c:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  804640:	bf 06 00 00 00       	mov    $0x6,%edi
+  804645:	48 b8 58 45 80 00 00 	movabs $0x804558,%rax
+  80464c:	00 00 00 
+  80464f:	ff d0                	call   *%rax
+}
+  804651:	c9                   	leave
+  804652:	c3                   	ret
+
+0000000000804653 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  804653:	55                   	push   %rbp
+  804654:	48 89 e5             	mov    %rsp,%rbp
+  804657:	41 54                	push   %r12
+  804659:	53                   	push   %rbx
+  80465a:	48 83 ec 10          	sub    $0x10,%rsp
+  80465e:	89 fb                	mov    %edi,%ebx
+  804660:	49 89 f4             	mov    %rsi,%r12
+  804663:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  804667:	48 b8 16 45 80 00 00 	movabs $0x804516,%rax
+  80466e:	00 00 00 
+  804671:	ff d0                	call   *%rax
+  804673:	89 c7                	mov    %eax,%edi
+  804675:	6a 00                	push   $0x0
+  804677:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80467b:	50                   	push   %rax
+  80467c:	4d 89 e1             	mov    %r12,%r9
+  80467f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  804685:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80468a:	48 ba 00 a0 80 01 00 	movabs $0x180a000,%rdx
+  804691:	00 00 00 
+  804694:	89 de                	mov    %ebx,%esi
+  804696:	48 b8 05 62 80 00 00 	movabs $0x806205,%rax
+  80469d:	00 00 00 
+  8046a0:	ff d0                	call   *%rax
+}
+  8046a2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8046a6:	5b                   	pop    %rbx
+  8046a7:	41 5c                	pop    %r12
+  8046a9:	5d                   	pop    %rbp
+  8046aa:	c3                   	ret
+
+00000000008046ab <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8046ab:	55                   	push   %rbp
+  8046ac:	48 89 e5             	mov    %rsp,%rbp
+  8046af:	41 54                	push   %r12
+  8046b1:	53                   	push   %rbx
+  8046b2:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8046b5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8046b8:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8046bf:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8046c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8046cb:	bf 05 00 00 00       	mov    $0x5,%edi
+  8046d0:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  8046d7:	00 00 00 
+  8046da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8046dc:	85 c0                	test   %eax,%eax
+  8046de:	78 5a                	js     80473a <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8046e0:	49 bc 00 a0 80 01 00 	movabs $0x180a000,%r12
+  8046e7:	00 00 00 
+  8046ea:	4c 89 e6             	mov    %r12,%rsi
+  8046ed:	48 89 df             	mov    %rbx,%rdi
+  8046f0:	48 b8 0c 2d 80 00 00 	movabs $0x802d0c,%rax
+  8046f7:	00 00 00 
+  8046fa:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8046fc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  804703:	00 
+  804704:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80470a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  804711:	00 
+  804712:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  804718:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  80471f:	00 
+  804720:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  804727:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  80472e:	00 
+  80472f:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  804735:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80473a:	5b                   	pop    %rbx
+  80473b:	41 5c                	pop    %r12
+  80473d:	5d                   	pop    %rbp
+  80473e:	c3                   	ret
+
+000000000080473f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80473f:	55                   	push   %rbp
+  804740:	48 89 e5             	mov    %rsp,%rbp
+  804743:	41 57                	push   %r15
+  804745:	41 56                	push   %r14
+  804747:	41 55                	push   %r13
+  804749:	41 54                	push   %r12
+  80474b:	53                   	push   %rbx
+  80474c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  804750:	48 85 ff             	test   %rdi,%rdi
+  804753:	0f 84 a1 00 00 00    	je     8047fa <devfile_read+0xbb>
+  804759:	49 89 ff             	mov    %rdi,%r15
+  80475c:	49 89 f5             	mov    %rsi,%r13
+  80475f:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  804762:	48 85 f6             	test   %rsi,%rsi
+  804765:	0f 84 c4 00 00 00    	je     80482f <devfile_read+0xf0>
+    size_t total_read = 0;
+  80476b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804772:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804773:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  80477a:	00 00 00 
+  80477d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  804781:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  804784:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804788:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80478d:	be 00 00 00 00       	mov    $0x0,%esi
+  804792:	bf 03 00 00 00       	mov    $0x3,%edi
+  804797:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  80479e:	00 00 00 
+  8047a1:	ff d0                	call   *%rax
+        if (res < 0) {
+  8047a3:	85 c0                	test   %eax,%eax
+  8047a5:	0f 88 b9 00 00 00    	js     804864 <devfile_read+0x125>
+        assert(res <= n);
+  8047ab:	48 63 d8             	movslq %eax,%rbx
+  8047ae:	49 39 dc             	cmp    %rbx,%r12
+  8047b1:	0f 82 b1 00 00 00    	jb     804868 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8047b7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8047bc:	0f 87 db 00 00 00    	ja     80489d <devfile_read+0x15e>
+        if (!res) {
+  8047c2:	85 c0                	test   %eax,%eax
+  8047c4:	74 21                	je     8047e7 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8047c6:	48 89 da             	mov    %rbx,%rdx
+  8047c9:	4c 89 f6             	mov    %r14,%rsi
+  8047cc:	4c 89 ef             	mov    %r13,%rdi
+  8047cf:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  8047d6:	00 00 00 
+  8047d9:	ff d0                	call   *%rax
+        total_read += res;
+  8047db:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8047df:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8047e2:	49 29 dc             	sub    %rbx,%r12
+  8047e5:	75 96                	jne    80477d <devfile_read+0x3e>
+    return total_read;
+  8047e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8047eb:	48 83 c4 18          	add    $0x18,%rsp
+  8047ef:	5b                   	pop    %rbx
+  8047f0:	41 5c                	pop    %r12
+  8047f2:	41 5d                	pop    %r13
+  8047f4:	41 5e                	pop    %r14
+  8047f6:	41 5f                	pop    %r15
+  8047f8:	5d                   	pop    %rbp
+  8047f9:	c3                   	ret
+    assert(fd);
+  8047fa:	48 b9 a1 70 80 00 00 	movabs $0x8070a1,%rcx
+  804801:	00 00 00 
+  804804:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  80480b:	00 00 00 
+  80480e:	be 91 00 00 00       	mov    $0x91,%esi
+  804813:	48 bf 96 70 80 00 00 	movabs $0x807096,%rdi
+  80481a:	00 00 00 
+  80481d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804822:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  804829:	00 00 00 
+  80482c:	41 ff d0             	call   *%r8
+    assert(buf);
+  80482f:	48 b9 a4 70 80 00 00 	movabs $0x8070a4,%rcx
+  804836:	00 00 00 
+  804839:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  804840:	00 00 00 
+  804843:	be 92 00 00 00       	mov    $0x92,%esi
+  804848:	48 bf 96 70 80 00 00 	movabs $0x807096,%rdi
+  80484f:	00 00 00 
+  804852:	b8 00 00 00 00       	mov    $0x0,%eax
+  804857:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  80485e:	00 00 00 
+  804861:	41 ff d0             	call   *%r8
+            return res;
+  804864:	48 98                	cltq
+  804866:	eb 83                	jmp    8047eb <devfile_read+0xac>
+        assert(res <= n);
+  804868:	48 b9 a8 70 80 00 00 	movabs $0x8070a8,%rcx
+  80486f:	00 00 00 
+  804872:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  804879:	00 00 00 
+  80487c:	be 9e 00 00 00       	mov    $0x9e,%esi
+  804881:	48 bf 96 70 80 00 00 	movabs $0x807096,%rdi
+  804888:	00 00 00 
+  80488b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804890:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  804897:	00 00 00 
+  80489a:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80489d:	48 b9 b8 70 80 00 00 	movabs $0x8070b8,%rcx
+  8048a4:	00 00 00 
+  8048a7:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  8048ae:	00 00 00 
+  8048b1:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8048b6:	48 bf 96 70 80 00 00 	movabs $0x807096,%rdi
+  8048bd:	00 00 00 
+  8048c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048c5:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  8048cc:	00 00 00 
+  8048cf:	41 ff d0             	call   *%r8
+
+00000000008048d2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8048d2:	55                   	push   %rbp
+  8048d3:	48 89 e5             	mov    %rsp,%rbp
+  8048d6:	41 57                	push   %r15
+  8048d8:	41 56                	push   %r14
+  8048da:	41 55                	push   %r13
+  8048dc:	41 54                	push   %r12
+  8048de:	53                   	push   %rbx
+  8048df:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8048e3:	48 85 ff             	test   %rdi,%rdi
+  8048e6:	0f 84 83 00 00 00    	je     80496f <devfile_write+0x9d>
+  8048ec:	49 89 ff             	mov    %rdi,%r15
+  8048ef:	49 89 f4             	mov    %rsi,%r12
+  8048f2:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8048f5:	48 85 f6             	test   %rsi,%rsi
+  8048f8:	0f 84 a6 00 00 00    	je     8049a4 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8048fe:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804904:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  80490b:	00 00 00 
+  80490e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  804912:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  804915:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  804919:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80491e:	48 39 d3             	cmp    %rdx,%rbx
+  804921:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  804925:	4c 89 e6             	mov    %r12,%rsi
+  804928:	48 bf 10 a0 80 01 00 	movabs $0x180a010,%rdi
+  80492f:	00 00 00 
+  804932:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  804939:	00 00 00 
+  80493c:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80493e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804943:	be 00 00 00 00       	mov    $0x0,%esi
+  804948:	bf 04 00 00 00       	mov    $0x4,%edi
+  80494d:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  804954:	00 00 00 
+  804957:	ff d0                	call   *%rax
+        if (res < 0) {
+  804959:	85 c0                	test   %eax,%eax
+  80495b:	78 7c                	js     8049d9 <devfile_write+0x107>
+        total_written += res;
+  80495d:	48 98                	cltq
+  80495f:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  804962:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  804965:	48 29 c3             	sub    %rax,%rbx
+  804968:	75 a4                	jne    80490e <devfile_write+0x3c>
+    return total_written;
+  80496a:	4c 89 e8             	mov    %r13,%rax
+  80496d:	eb 6c                	jmp    8049db <devfile_write+0x109>
+    assert(fd);
+  80496f:	48 b9 a1 70 80 00 00 	movabs $0x8070a1,%rcx
+  804976:	00 00 00 
+  804979:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  804980:	00 00 00 
+  804983:	be bd 00 00 00       	mov    $0xbd,%esi
+  804988:	48 bf 96 70 80 00 00 	movabs $0x807096,%rdi
+  80498f:	00 00 00 
+  804992:	b8 00 00 00 00       	mov    $0x0,%eax
+  804997:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  80499e:	00 00 00 
+  8049a1:	41 ff d0             	call   *%r8
+    assert(buf);
+  8049a4:	48 b9 a4 70 80 00 00 	movabs $0x8070a4,%rcx
+  8049ab:	00 00 00 
+  8049ae:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  8049b5:	00 00 00 
+  8049b8:	be be 00 00 00       	mov    $0xbe,%esi
+  8049bd:	48 bf 96 70 80 00 00 	movabs $0x807096,%rdi
+  8049c4:	00 00 00 
+  8049c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049cc:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  8049d3:	00 00 00 
+  8049d6:	41 ff d0             	call   *%r8
+            return res;
+  8049d9:	48 98                	cltq
+}
+  8049db:	48 83 c4 08          	add    $0x8,%rsp
+  8049df:	5b                   	pop    %rbx
+  8049e0:	41 5c                	pop    %r12
+  8049e2:	41 5d                	pop    %r13
+  8049e4:	41 5e                	pop    %r14
+  8049e6:	41 5f                	pop    %r15
+  8049e8:	5d                   	pop    %rbp
+  8049e9:	c3                   	ret
+
+00000000008049ea <open>:
+open(const char *path, int mode) {
+  8049ea:	55                   	push   %rbp
+  8049eb:	48 89 e5             	mov    %rsp,%rbp
+  8049ee:	41 55                	push   %r13
+  8049f0:	41 54                	push   %r12
+  8049f2:	53                   	push   %rbx
+  8049f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8049f7:	49 89 fc             	mov    %rdi,%r12
+  8049fa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8049fd:	48 b8 ce 2c 80 00 00 	movabs $0x802cce,%rax
+  804a04:	00 00 00 
+  804a07:	ff d0                	call   *%rax
+  804a09:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804a0f:	0f 87 8f 00 00 00    	ja     804aa4 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804a15:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804a19:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  804a20:	00 00 00 
+  804a23:	ff d0                	call   *%rax
+  804a25:	89 c3                	mov    %eax,%ebx
+  804a27:	85 c0                	test   %eax,%eax
+  804a29:	78 55                	js     804a80 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  804a2b:	4c 89 e6             	mov    %r12,%rsi
+  804a2e:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  804a35:	00 00 00 
+  804a38:	48 89 df             	mov    %rbx,%rdi
+  804a3b:	48 b8 0c 2d 80 00 00 	movabs $0x802d0c,%rax
+  804a42:	00 00 00 
+  804a45:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804a47:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804a4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a53:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804a57:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a5c:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  804a63:	00 00 00 
+  804a66:	ff d0                	call   *%rax
+  804a68:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804a6a:	85 c0                	test   %eax,%eax
+  804a6c:	78 1f                	js     804a8d <open+0xa3>
+    return fd2num(fd);
+  804a6e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a72:	48 b8 e1 3d 80 00 00 	movabs $0x803de1,%rax
+  804a79:	00 00 00 
+  804a7c:	ff d0                	call   *%rax
+  804a7e:	89 c3                	mov    %eax,%ebx
+}
+  804a80:	89 d8                	mov    %ebx,%eax
+  804a82:	48 83 c4 18          	add    $0x18,%rsp
+  804a86:	5b                   	pop    %rbx
+  804a87:	41 5c                	pop    %r12
+  804a89:	41 5d                	pop    %r13
+  804a8b:	5d                   	pop    %rbp
+  804a8c:	c3                   	ret
+        fd_close(fd, 0);
+  804a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  804a92:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a96:	48 b8 2a 3f 80 00 00 	movabs $0x803f2a,%rax
+  804a9d:	00 00 00 
+  804aa0:	ff d0                	call   *%rax
+        return res;
+  804aa2:	eb dc                	jmp    804a80 <open+0x96>
+        return -E_BAD_PATH;
+  804aa4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804aa9:	eb d5                	jmp    804a80 <open+0x96>
+
+0000000000804aab <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804aab:	55                   	push   %rbp
+  804aac:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  804aaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ab4:	be 00 00 00 00       	mov    $0x0,%esi
+  804ab9:	bf 08 00 00 00       	mov    $0x8,%edi
+  804abe:	48 b8 58 45 80 00 00 	movabs $0x804558,%rax
+  804ac5:	00 00 00 
+  804ac8:	ff d0                	call   *%rax
+}
+  804aca:	5d                   	pop    %rbp
+  804acb:	c3                   	ret
+
+0000000000804acc <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  804acc:	55                   	push   %rbp
+  804acd:	48 89 e5             	mov    %rsp,%rbp
+  804ad0:	41 56                	push   %r14
+  804ad2:	41 55                	push   %r13
+  804ad4:	41 54                	push   %r12
+  804ad6:	53                   	push   %rbx
+  804ad7:	48 83 ec 10          	sub    $0x10,%rsp
+  804adb:	41 89 f6             	mov    %esi,%r14d
+  804ade:	49 89 d4             	mov    %rdx,%r12
+  804ae1:	48 89 cb             	mov    %rcx,%rbx
+  804ae4:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804ae7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804aeb:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  804af2:	00 00 00 
+  804af5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804af7:	85 c0                	test   %eax,%eax
+  804af9:	78 46                	js     804b41 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804afb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804aff:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  804b06:	00 00 00 
+  804b09:	8b 00                	mov    (%rax),%eax
+  804b0b:	39 02                	cmp    %eax,(%rdx)
+  804b0d:	75 3f                	jne    804b4e <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804b0f:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  804b16:	00 00 00 
+  804b19:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804b1c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804b1e:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  804b22:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804b26:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804b2a:	48 89 da             	mov    %rbx,%rdx
+  804b2d:	4c 89 e6             	mov    %r12,%rsi
+  804b30:	bf 09 00 00 00       	mov    $0x9,%edi
+  804b35:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  804b3c:	00 00 00 
+  804b3f:	ff d0                	call   *%rax
+}
+  804b41:	48 83 c4 10          	add    $0x10,%rsp
+  804b45:	5b                   	pop    %rbx
+  804b46:	41 5c                	pop    %r12
+  804b48:	41 5d                	pop    %r13
+  804b4a:	41 5e                	pop    %r14
+  804b4c:	5d                   	pop    %rbp
+  804b4d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804b4e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804b53:	eb ec                	jmp    804b41 <file_map+0x75>
+
+0000000000804b55 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804b55:	55                   	push   %rbp
+  804b56:	48 89 e5             	mov    %rsp,%rbp
+  804b59:	41 54                	push   %r12
+  804b5b:	53                   	push   %rbx
+  804b5c:	48 83 ec 20          	sub    $0x20,%rsp
+  804b60:	41 89 f4             	mov    %esi,%r12d
+  804b63:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804b66:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804b6a:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  804b71:	00 00 00 
+  804b74:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804b76:	85 c0                	test   %eax,%eax
+  804b78:	78 3c                	js     804bb6 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804b7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b7e:	48 ba 40 80 80 00 00 	movabs $0x808040,%rdx
+  804b85:	00 00 00 
+  804b88:	8b 0a                	mov    (%rdx),%ecx
+  804b8a:	39 08                	cmp    %ecx,(%rax)
+  804b8c:	75 31                	jne    804bbf <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804b8e:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b91:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804b94:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804b98:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804b9c:	ba 10 00 00 00       	mov    $0x10,%edx
+  804ba1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804ba5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804baa:	48 b8 58 45 80 00 00 	movabs $0x804558,%rax
+  804bb1:	00 00 00 
+  804bb4:	ff d0                	call   *%rax
+}
+  804bb6:	48 83 c4 20          	add    $0x20,%rsp
+  804bba:	5b                   	pop    %rbx
+  804bbb:	41 5c                	pop    %r12
+  804bbd:	5d                   	pop    %rbp
+  804bbe:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804bbf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804bc4:	eb f0                	jmp    804bb6 <file_msync+0x61>
+
+0000000000804bc6 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804bc6:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804bca:	7f 01                	jg     804bcd <writebuf+0x7>
+  804bcc:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804bcd:	55                   	push   %rbp
+  804bce:	48 89 e5             	mov    %rsp,%rbp
+  804bd1:	53                   	push   %rbx
+  804bd2:	48 83 ec 08          	sub    $0x8,%rsp
+  804bd6:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804bd9:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804bdd:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804be1:	8b 3f                	mov    (%rdi),%edi
+  804be3:	48 b8 81 42 80 00 00 	movabs $0x804281,%rax
+  804bea:	00 00 00 
+  804bed:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804bef:	48 85 c0             	test   %rax,%rax
+  804bf2:	7e 04                	jle    804bf8 <writebuf+0x32>
+  804bf4:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804bf8:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804bfc:	48 39 c2             	cmp    %rax,%rdx
+  804bff:	74 0f                	je     804c10 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804c01:	48 85 c0             	test   %rax,%rax
+  804c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c09:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804c0d:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804c10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c14:	c9                   	leave
+  804c15:	c3                   	ret
+
+0000000000804c16 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804c16:	8b 46 04             	mov    0x4(%rsi),%eax
+  804c19:	8d 50 01             	lea    0x1(%rax),%edx
+  804c1c:	89 56 04             	mov    %edx,0x4(%rsi)
+  804c1f:	48 98                	cltq
+  804c21:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804c26:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804c2c:	74 01                	je     804c2f <putch+0x19>
+  804c2e:	c3                   	ret
+putch(int ch, void *arg) {
+  804c2f:	55                   	push   %rbp
+  804c30:	48 89 e5             	mov    %rsp,%rbp
+  804c33:	53                   	push   %rbx
+  804c34:	48 83 ec 08          	sub    $0x8,%rsp
+  804c38:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804c3b:	48 89 f7             	mov    %rsi,%rdi
+  804c3e:	48 b8 c6 4b 80 00 00 	movabs $0x804bc6,%rax
+  804c45:	00 00 00 
+  804c48:	ff d0                	call   *%rax
+        state->offset = 0;
+  804c4a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804c51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c55:	c9                   	leave
+  804c56:	c3                   	ret
+
+0000000000804c57 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804c57:	55                   	push   %rbp
+  804c58:	48 89 e5             	mov    %rsp,%rbp
+  804c5b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804c62:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804c65:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804c6b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804c72:	00 00 00 
+    state.result = 0;
+  804c75:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804c7c:	00 00 00 00 
+    state.error = 1;
+  804c80:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804c87:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804c8a:	48 89 f2             	mov    %rsi,%rdx
+  804c8d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804c94:	48 bf 16 4c 80 00 00 	movabs $0x804c16,%rdi
+  804c9b:	00 00 00 
+  804c9e:	48 b8 25 25 80 00 00 	movabs $0x802525,%rax
+  804ca5:	00 00 00 
+  804ca8:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804caa:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804cb1:	7f 14                	jg     804cc7 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804cb3:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804cba:	48 85 c0             	test   %rax,%rax
+  804cbd:	75 06                	jne    804cc5 <vfprintf+0x6e>
+  804cbf:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804cc5:	c9                   	leave
+  804cc6:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804cc7:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804cce:	48 b8 c6 4b 80 00 00 	movabs $0x804bc6,%rax
+  804cd5:	00 00 00 
+  804cd8:	ff d0                	call   *%rax
+  804cda:	eb d7                	jmp    804cb3 <vfprintf+0x5c>
+
+0000000000804cdc <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804cdc:	55                   	push   %rbp
+  804cdd:	48 89 e5             	mov    %rsp,%rbp
+  804ce0:	48 83 ec 50          	sub    $0x50,%rsp
+  804ce4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804ce8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804cec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804cf0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804cf4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804cfb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804cff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d03:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d07:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804d0b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804d0f:	48 b8 57 4c 80 00 00 	movabs $0x804c57,%rax
+  804d16:	00 00 00 
+  804d19:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804d1b:	c9                   	leave
+  804d1c:	c3                   	ret
+
+0000000000804d1d <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804d1d:	55                   	push   %rbp
+  804d1e:	48 89 e5             	mov    %rsp,%rbp
+  804d21:	48 83 ec 50          	sub    $0x50,%rsp
+  804d25:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804d29:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804d2d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804d31:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804d35:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804d39:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804d40:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804d44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d48:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d4c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804d50:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804d54:	48 89 fe             	mov    %rdi,%rsi
+  804d57:	bf 01 00 00 00       	mov    $0x1,%edi
+  804d5c:	48 b8 57 4c 80 00 00 	movabs $0x804c57,%rax
+  804d63:	00 00 00 
+  804d66:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804d68:	c9                   	leave
+  804d69:	c3                   	ret
+
+0000000000804d6a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804d6a:	55                   	push   %rbp
+  804d6b:	48 89 e5             	mov    %rsp,%rbp
+  804d6e:	41 54                	push   %r12
+  804d70:	53                   	push   %rbx
+  804d71:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804d74:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  804d7b:	00 00 00 
+  804d7e:	ff d0                	call   *%rax
+  804d80:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804d83:	48 be e0 70 80 00 00 	movabs $0x8070e0,%rsi
+  804d8a:	00 00 00 
+  804d8d:	48 89 df             	mov    %rbx,%rdi
+  804d90:	48 b8 0c 2d 80 00 00 	movabs $0x802d0c,%rax
+  804d97:	00 00 00 
+  804d9a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804d9c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804da1:	41 2b 04 24          	sub    (%r12),%eax
+  804da5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804dab:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804db2:	00 00 00 
+    stat->st_dev = &devpipe;
+  804db5:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  804dbc:	00 00 00 
+  804dbf:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcb:	5b                   	pop    %rbx
+  804dcc:	41 5c                	pop    %r12
+  804dce:	5d                   	pop    %rbp
+  804dcf:	c3                   	ret
+
+0000000000804dd0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804dd0:	55                   	push   %rbp
+  804dd1:	48 89 e5             	mov    %rsp,%rbp
+  804dd4:	41 54                	push   %r12
+  804dd6:	53                   	push   %rbx
+  804dd7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804dda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ddf:	48 89 fe             	mov    %rdi,%rsi
+  804de2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804de7:	49 bc 49 35 80 00 00 	movabs $0x803549,%r12
+  804dee:	00 00 00 
+  804df1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804df4:	48 89 df             	mov    %rbx,%rdi
+  804df7:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  804dfe:	00 00 00 
+  804e01:	ff d0                	call   *%rax
+  804e03:	48 89 c6             	mov    %rax,%rsi
+  804e06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e10:	41 ff d4             	call   *%r12
+}
+  804e13:	5b                   	pop    %rbx
+  804e14:	41 5c                	pop    %r12
+  804e16:	5d                   	pop    %rbp
+  804e17:	c3                   	ret
+
+0000000000804e18 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e18:	55                   	push   %rbp
+  804e19:	48 89 e5             	mov    %rsp,%rbp
+  804e1c:	41 57                	push   %r15
+  804e1e:	41 56                	push   %r14
+  804e20:	41 55                	push   %r13
+  804e22:	41 54                	push   %r12
+  804e24:	53                   	push   %rbx
+  804e25:	48 83 ec 18          	sub    $0x18,%rsp
+  804e29:	49 89 fc             	mov    %rdi,%r12
+  804e2c:	49 89 f5             	mov    %rsi,%r13
+  804e2f:	49 89 d7             	mov    %rdx,%r15
+  804e32:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804e36:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  804e3d:	00 00 00 
+  804e40:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804e42:	4d 85 ff             	test   %r15,%r15
+  804e45:	0f 84 af 00 00 00    	je     804efa <devpipe_write+0xe2>
+  804e4b:	48 89 c3             	mov    %rax,%rbx
+  804e4e:	4c 89 f8             	mov    %r15,%rax
+  804e51:	4d 89 ef             	mov    %r13,%r15
+  804e54:	4c 01 e8             	add    %r13,%rax
+  804e57:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804e5b:	49 bd 3f 34 80 00 00 	movabs $0x80343f,%r13
+  804e62:	00 00 00 
+            sys_yield();
+  804e65:	49 be d0 33 80 00 00 	movabs $0x8033d0,%r14
+  804e6c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804e6f:	8b 73 04             	mov    0x4(%rbx),%esi
+  804e72:	48 63 ce             	movslq %esi,%rcx
+  804e75:	48 63 03             	movslq (%rbx),%rax
+  804e78:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804e7e:	48 39 c1             	cmp    %rax,%rcx
+  804e81:	72 2e                	jb     804eb1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804e83:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804e88:	48 89 da             	mov    %rbx,%rdx
+  804e8b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804e90:	4c 89 e7             	mov    %r12,%rdi
+  804e93:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804e96:	85 c0                	test   %eax,%eax
+  804e98:	74 66                	je     804f00 <devpipe_write+0xe8>
+            sys_yield();
+  804e9a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804e9d:	8b 73 04             	mov    0x4(%rbx),%esi
+  804ea0:	48 63 ce             	movslq %esi,%rcx
+  804ea3:	48 63 03             	movslq (%rbx),%rax
+  804ea6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804eac:	48 39 c1             	cmp    %rax,%rcx
+  804eaf:	73 d2                	jae    804e83 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804eb1:	41 0f b6 3f          	movzbl (%r15),%edi
+  804eb5:	48 89 ca             	mov    %rcx,%rdx
+  804eb8:	48 c1 ea 03          	shr    $0x3,%rdx
+  804ebc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804ec3:	08 10 20 
+  804ec6:	48 f7 e2             	mul    %rdx
+  804ec9:	48 c1 ea 06          	shr    $0x6,%rdx
+  804ecd:	48 89 d0             	mov    %rdx,%rax
+  804ed0:	48 c1 e0 09          	shl    $0x9,%rax
+  804ed4:	48 29 d0             	sub    %rdx,%rax
+  804ed7:	48 c1 e0 03          	shl    $0x3,%rax
+  804edb:	48 29 c1             	sub    %rax,%rcx
+  804ede:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804ee3:	83 c6 01             	add    $0x1,%esi
+  804ee6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804ee9:	49 83 c7 01          	add    $0x1,%r15
+  804eed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ef1:	49 39 c7             	cmp    %rax,%r15
+  804ef4:	0f 85 75 ff ff ff    	jne    804e6f <devpipe_write+0x57>
+    return n;
+  804efa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804efe:	eb 05                	jmp    804f05 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804f00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f05:	48 83 c4 18          	add    $0x18,%rsp
+  804f09:	5b                   	pop    %rbx
+  804f0a:	41 5c                	pop    %r12
+  804f0c:	41 5d                	pop    %r13
+  804f0e:	41 5e                	pop    %r14
+  804f10:	41 5f                	pop    %r15
+  804f12:	5d                   	pop    %rbp
+  804f13:	c3                   	ret
+
+0000000000804f14 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f14:	55                   	push   %rbp
+  804f15:	48 89 e5             	mov    %rsp,%rbp
+  804f18:	41 57                	push   %r15
+  804f1a:	41 56                	push   %r14
+  804f1c:	41 55                	push   %r13
+  804f1e:	41 54                	push   %r12
+  804f20:	53                   	push   %rbx
+  804f21:	48 83 ec 18          	sub    $0x18,%rsp
+  804f25:	49 89 fc             	mov    %rdi,%r12
+  804f28:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804f2c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804f30:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  804f37:	00 00 00 
+  804f3a:	ff d0                	call   *%rax
+  804f3c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804f3f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804f45:	49 bd 3f 34 80 00 00 	movabs $0x80343f,%r13
+  804f4c:	00 00 00 
+            sys_yield();
+  804f4f:	49 be d0 33 80 00 00 	movabs $0x8033d0,%r14
+  804f56:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804f59:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804f5e:	74 7d                	je     804fdd <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804f60:	8b 03                	mov    (%rbx),%eax
+  804f62:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804f65:	75 26                	jne    804f8d <devpipe_read+0x79>
+            if (i > 0) return i;
+  804f67:	4d 85 ff             	test   %r15,%r15
+  804f6a:	75 77                	jne    804fe3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804f6c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804f71:	48 89 da             	mov    %rbx,%rdx
+  804f74:	be 00 10 00 00       	mov    $0x1000,%esi
+  804f79:	4c 89 e7             	mov    %r12,%rdi
+  804f7c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804f7f:	85 c0                	test   %eax,%eax
+  804f81:	74 72                	je     804ff5 <devpipe_read+0xe1>
+            sys_yield();
+  804f83:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804f86:	8b 03                	mov    (%rbx),%eax
+  804f88:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804f8b:	74 df                	je     804f6c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804f8d:	48 63 c8             	movslq %eax,%rcx
+  804f90:	48 89 ca             	mov    %rcx,%rdx
+  804f93:	48 c1 ea 03          	shr    $0x3,%rdx
+  804f97:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804f9e:	08 10 20 
+  804fa1:	48 89 d0             	mov    %rdx,%rax
+  804fa4:	48 f7 e6             	mul    %rsi
+  804fa7:	48 c1 ea 06          	shr    $0x6,%rdx
+  804fab:	48 89 d0             	mov    %rdx,%rax
+  804fae:	48 c1 e0 09          	shl    $0x9,%rax
+  804fb2:	48 29 d0             	sub    %rdx,%rax
+  804fb5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804fbc:	00 
+  804fbd:	48 89 c8             	mov    %rcx,%rax
+  804fc0:	48 29 d0             	sub    %rdx,%rax
+  804fc3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804fc8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804fcc:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804fd0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804fd3:	49 83 c7 01          	add    $0x1,%r15
+  804fd7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804fdb:	75 83                	jne    804f60 <devpipe_read+0x4c>
+    return n;
+  804fdd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fe1:	eb 03                	jmp    804fe6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804fe3:	4c 89 f8             	mov    %r15,%rax
+}
+  804fe6:	48 83 c4 18          	add    $0x18,%rsp
+  804fea:	5b                   	pop    %rbx
+  804feb:	41 5c                	pop    %r12
+  804fed:	41 5d                	pop    %r13
+  804fef:	41 5e                	pop    %r14
+  804ff1:	41 5f                	pop    %r15
+  804ff3:	5d                   	pop    %rbp
+  804ff4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ffa:	eb ea                	jmp    804fe6 <devpipe_read+0xd2>
+
+0000000000804ffc <pipe>:
+pipe(int pfd[2]) {
+  804ffc:	55                   	push   %rbp
+  804ffd:	48 89 e5             	mov    %rsp,%rbp
+  805000:	41 55                	push   %r13
+  805002:	41 54                	push   %r12
+  805004:	53                   	push   %rbx
+  805005:	48 83 ec 18          	sub    $0x18,%rsp
+  805009:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80500c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  805010:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  805017:	00 00 00 
+  80501a:	ff d0                	call   *%rax
+  80501c:	89 c3                	mov    %eax,%ebx
+  80501e:	85 c0                	test   %eax,%eax
+  805020:	0f 88 a0 01 00 00    	js     8051c6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  805026:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80502b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805030:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  805034:	bf 00 00 00 00       	mov    $0x0,%edi
+  805039:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  805040:	00 00 00 
+  805043:	ff d0                	call   *%rax
+  805045:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805047:	85 c0                	test   %eax,%eax
+  805049:	0f 88 77 01 00 00    	js     8051c6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80504f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  805053:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  80505a:	00 00 00 
+  80505d:	ff d0                	call   *%rax
+  80505f:	89 c3                	mov    %eax,%ebx
+  805061:	85 c0                	test   %eax,%eax
+  805063:	0f 88 43 01 00 00    	js     8051ac <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  805069:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80506e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805073:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80507c:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  805083:	00 00 00 
+  805086:	ff d0                	call   *%rax
+  805088:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80508a:	85 c0                	test   %eax,%eax
+  80508c:	0f 88 1a 01 00 00    	js     8051ac <pipe+0x1b0>
+    va = fd2data(fd0);
+  805092:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805096:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  80509d:	00 00 00 
+  8050a0:	ff d0                	call   *%rax
+  8050a2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8050a5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8050aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050af:	48 89 c6             	mov    %rax,%rsi
+  8050b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050b7:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  8050be:	00 00 00 
+  8050c1:	ff d0                	call   *%rax
+  8050c3:	89 c3                	mov    %eax,%ebx
+  8050c5:	85 c0                	test   %eax,%eax
+  8050c7:	0f 88 c5 00 00 00    	js     805192 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8050cd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8050d1:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  8050d8:	00 00 00 
+  8050db:	ff d0                	call   *%rax
+  8050dd:	48 89 c1             	mov    %rax,%rcx
+  8050e0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8050e6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8050ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050f1:	4c 89 ee             	mov    %r13,%rsi
+  8050f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050f9:	48 b8 de 34 80 00 00 	movabs $0x8034de,%rax
+  805100:	00 00 00 
+  805103:	ff d0                	call   *%rax
+  805105:	89 c3                	mov    %eax,%ebx
+  805107:	85 c0                	test   %eax,%eax
+  805109:	78 6e                	js     805179 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80510b:	be 00 10 00 00       	mov    $0x1000,%esi
+  805110:	4c 89 ef             	mov    %r13,%rdi
+  805113:	48 b8 07 34 80 00 00 	movabs $0x803407,%rax
+  80511a:	00 00 00 
+  80511d:	ff d0                	call   *%rax
+  80511f:	83 f8 02             	cmp    $0x2,%eax
+  805122:	0f 85 ab 00 00 00    	jne    8051d3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  805128:	a1 80 80 80 00 00 00 	movabs 0x808080,%eax
+  80512f:	00 00 
+  805131:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805135:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  805137:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80513b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  805142:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805146:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  805148:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80514c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  805153:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805157:	48 bb e1 3d 80 00 00 	movabs $0x803de1,%rbx
+  80515e:	00 00 00 
+  805161:	ff d3                	call   *%rbx
+  805163:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  805167:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80516b:	ff d3                	call   *%rbx
+  80516d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  805172:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805177:	eb 4d                	jmp    8051c6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  805179:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80517e:	4c 89 ee             	mov    %r13,%rsi
+  805181:	bf 00 00 00 00       	mov    $0x0,%edi
+  805186:	48 b8 49 35 80 00 00 	movabs $0x803549,%rax
+  80518d:	00 00 00 
+  805190:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  805192:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805197:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80519b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051a0:	48 b8 49 35 80 00 00 	movabs $0x803549,%rax
+  8051a7:	00 00 00 
+  8051aa:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8051ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8051b1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8051b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051ba:	48 b8 49 35 80 00 00 	movabs $0x803549,%rax
+  8051c1:	00 00 00 
+  8051c4:	ff d0                	call   *%rax
+}
+  8051c6:	89 d8                	mov    %ebx,%eax
+  8051c8:	48 83 c4 18          	add    $0x18,%rsp
+  8051cc:	5b                   	pop    %rbx
+  8051cd:	41 5c                	pop    %r12
+  8051cf:	41 5d                	pop    %r13
+  8051d1:	5d                   	pop    %rbp
+  8051d2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8051d3:	48 b9 f8 70 80 00 00 	movabs $0x8070f8,%rcx
+  8051da:	00 00 00 
+  8051dd:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  8051e4:	00 00 00 
+  8051e7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8051ec:	48 bf e7 70 80 00 00 	movabs $0x8070e7,%rdi
+  8051f3:	00 00 00 
+  8051f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051fb:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  805202:	00 00 00 
+  805205:	41 ff d0             	call   *%r8
+
+0000000000805208 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  805208:	55                   	push   %rbp
+  805209:	48 89 e5             	mov    %rsp,%rbp
+  80520c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805210:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805214:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  80521b:	00 00 00 
+  80521e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805220:	85 c0                	test   %eax,%eax
+  805222:	78 35                	js     805259 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  805224:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805228:	48 b8 f3 3d 80 00 00 	movabs $0x803df3,%rax
+  80522f:	00 00 00 
+  805232:	ff d0                	call   *%rax
+  805234:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805237:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80523c:	be 00 10 00 00       	mov    $0x1000,%esi
+  805241:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805245:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  80524c:	00 00 00 
+  80524f:	ff d0                	call   *%rax
+  805251:	85 c0                	test   %eax,%eax
+  805253:	0f 94 c0             	sete   %al
+  805256:	0f b6 c0             	movzbl %al,%eax
+}
+  805259:	c9                   	leave
+  80525a:	c3                   	ret
+
+000000000080525b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80525b:	48 89 f8             	mov    %rdi,%rax
+  80525e:	48 c1 e8 27          	shr    $0x27,%rax
+  805262:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805269:	01 00 00 
+  80526c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805270:	f6 c2 01             	test   $0x1,%dl
+  805273:	74 6d                	je     8052e2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805275:	48 89 f8             	mov    %rdi,%rax
+  805278:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80527c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805283:	01 00 00 
+  805286:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80528a:	f6 c2 01             	test   $0x1,%dl
+  80528d:	74 62                	je     8052f1 <get_uvpt_entry+0x96>
+  80528f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805296:	01 00 00 
+  805299:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80529d:	f6 c2 80             	test   $0x80,%dl
+  8052a0:	75 4f                	jne    8052f1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8052a2:	48 89 f8             	mov    %rdi,%rax
+  8052a5:	48 c1 e8 15          	shr    $0x15,%rax
+  8052a9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8052b0:	01 00 00 
+  8052b3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8052b7:	f6 c2 01             	test   $0x1,%dl
+  8052ba:	74 44                	je     805300 <get_uvpt_entry+0xa5>
+  8052bc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8052c3:	01 00 00 
+  8052c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8052ca:	f6 c2 80             	test   $0x80,%dl
+  8052cd:	75 31                	jne    805300 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8052cf:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8052d3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8052da:	01 00 00 
+  8052dd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8052e1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8052e2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8052e9:	01 00 00 
+  8052ec:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8052f0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8052f1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8052f8:	01 00 00 
+  8052fb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8052ff:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805300:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805307:	01 00 00 
+  80530a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80530e:	c3                   	ret
+
+000000000080530f <get_prot>:
+
+int
+get_prot(void *va) {
+  80530f:	55                   	push   %rbp
+  805310:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805313:	48 b8 5b 52 80 00 00 	movabs $0x80525b,%rax
+  80531a:	00 00 00 
+  80531d:	ff d0                	call   *%rax
+  80531f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  805322:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  805327:	89 c1                	mov    %eax,%ecx
+  805329:	83 c9 04             	or     $0x4,%ecx
+  80532c:	f6 c2 01             	test   $0x1,%dl
+  80532f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  805332:	89 c1                	mov    %eax,%ecx
+  805334:	83 c9 02             	or     $0x2,%ecx
+  805337:	f6 c2 02             	test   $0x2,%dl
+  80533a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80533d:	89 c1                	mov    %eax,%ecx
+  80533f:	83 c9 01             	or     $0x1,%ecx
+  805342:	48 85 d2             	test   %rdx,%rdx
+  805345:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  805348:	89 c1                	mov    %eax,%ecx
+  80534a:	83 c9 40             	or     $0x40,%ecx
+  80534d:	f6 c6 04             	test   $0x4,%dh
+  805350:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805353:	5d                   	pop    %rbp
+  805354:	c3                   	ret
+
+0000000000805355 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805355:	55                   	push   %rbp
+  805356:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805359:	48 b8 5b 52 80 00 00 	movabs $0x80525b,%rax
+  805360:	00 00 00 
+  805363:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805365:	48 c1 e8 06          	shr    $0x6,%rax
+  805369:	83 e0 01             	and    $0x1,%eax
+}
+  80536c:	5d                   	pop    %rbp
+  80536d:	c3                   	ret
+
+000000000080536e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80536e:	55                   	push   %rbp
+  80536f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805372:	48 b8 5b 52 80 00 00 	movabs $0x80525b,%rax
+  805379:	00 00 00 
+  80537c:	ff d0                	call   *%rax
+  80537e:	83 e0 01             	and    $0x1,%eax
+}
+  805381:	5d                   	pop    %rbp
+  805382:	c3                   	ret
+
+0000000000805383 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805383:	55                   	push   %rbp
+  805384:	48 89 e5             	mov    %rsp,%rbp
+  805387:	41 57                	push   %r15
+  805389:	41 56                	push   %r14
+  80538b:	41 55                	push   %r13
+  80538d:	41 54                	push   %r12
+  80538f:	53                   	push   %rbx
+  805390:	48 83 ec 28          	sub    $0x28,%rsp
+  805394:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  805398:	48 85 ff             	test   %rdi,%rdi
+  80539b:	74 1e                	je     8053bb <foreach_shared_region+0x38>
+  80539d:	49 89 ff             	mov    %rdi,%r15
+  8053a0:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8053a6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8053ac:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8053b3:	01 00 00 
+  8053b6:	e9 72 02 00 00       	jmp    80562d <foreach_shared_region+0x2aa>
+    assert(fun);
+  8053bb:	48 b9 1c 71 80 00 00 	movabs $0x80711c,%rcx
+  8053c2:	00 00 00 
+  8053c5:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  8053cc:	00 00 00 
+  8053cf:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8053d4:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  8053db:	00 00 00 
+  8053de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053e3:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  8053ea:	00 00 00 
+  8053ed:	41 ff d0             	call   *%r8
+  8053f0:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8053f7:	eb 6c                	jmp    805465 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8053f9:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805400:	ff ff ff 
+  805403:	4c 21 e2             	and    %r12,%rdx
+  805406:	48 89 d8             	mov    %rbx,%rax
+  805409:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80540e:	48 83 c0 01          	add    $0x1,%rax
+  805412:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805416:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80541d:	00 00 00 
+  805420:	48 21 c8             	and    %rcx,%rax
+  805423:	48 09 d0             	or     %rdx,%rax
+  805426:	49 89 c4             	mov    %rax,%r12
+  805429:	eb 30                	jmp    80545b <foreach_shared_region+0xd8>
+  80542b:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805432:	ff ff ff 
+  805435:	4c 21 e2             	and    %r12,%rdx
+  805438:	48 89 d8             	mov    %rbx,%rax
+  80543b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805440:	48 83 c0 01          	add    $0x1,%rax
+  805444:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805448:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80544f:	00 00 00 
+  805452:	48 21 c8             	and    %rcx,%rax
+  805455:	48 09 d0             	or     %rdx,%rax
+  805458:	49 89 c4             	mov    %rax,%r12
+  80545b:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80545f:	0f 84 99 01 00 00    	je     8055fe <foreach_shared_region+0x27b>
+  805465:	4c 89 e3             	mov    %r12,%rbx
+  805468:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80546c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805473:	01 00 00 
+  805476:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80547a:	a8 01                	test   $0x1,%al
+  80547c:	0f 84 77 ff ff ff    	je     8053f9 <foreach_shared_region+0x76>
+  805482:	a8 80                	test   $0x80,%al
+  805484:	74 19                	je     80549f <foreach_shared_region+0x11c>
+  805486:	f6 c4 04             	test   $0x4,%ah
+  805489:	74 a0                	je     80542b <foreach_shared_region+0xa8>
+  80548b:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  805492:	40 
+  805493:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805497:	4c 89 e7             	mov    %r12,%rdi
+  80549a:	41 ff d7             	call   *%r15
+  80549d:	eb 8c                	jmp    80542b <foreach_shared_region+0xa8>
+  80549f:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8054a6:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8054aa:	eb 46                	jmp    8054f2 <foreach_shared_region+0x16f>
+  8054ac:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8054b3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8054b9:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8054bd:	48 c1 e0 15          	shl    $0x15,%rax
+  8054c1:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8054c6:	49 09 c4             	or     %rax,%r12
+  8054c9:	eb 1d                	jmp    8054e8 <foreach_shared_region+0x165>
+  8054cb:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8054d2:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8054d8:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8054dc:	48 c1 e0 15          	shl    $0x15,%rax
+  8054e0:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8054e5:	49 09 c4             	or     %rax,%r12
+  8054e8:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8054ec:	0f 84 d3 00 00 00    	je     8055c5 <foreach_shared_region+0x242>
+  8054f2:	4c 89 e3             	mov    %r12,%rbx
+  8054f5:	48 c1 eb 15          	shr    $0x15,%rbx
+  8054f9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805500:	01 00 00 
+  805503:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  805507:	a8 01                	test   $0x1,%al
+  805509:	74 a1                	je     8054ac <foreach_shared_region+0x129>
+  80550b:	a8 80                	test   $0x80,%al
+  80550d:	74 19                	je     805528 <foreach_shared_region+0x1a5>
+  80550f:	f6 c4 04             	test   $0x4,%ah
+  805512:	74 b7                	je     8054cb <foreach_shared_region+0x148>
+  805514:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80551b:	00 
+  80551c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805520:	4c 89 e7             	mov    %r12,%rdi
+  805523:	41 ff d7             	call   *%r15
+  805526:	eb a3                	jmp    8054cb <foreach_shared_region+0x148>
+  805528:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80552e:	eb 3b                	jmp    80556b <foreach_shared_region+0x1e8>
+  805530:	f6 c4 04             	test   $0x4,%ah
+  805533:	74 12                	je     805547 <foreach_shared_region+0x1c4>
+  805535:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80553c:	00 
+  80553d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805541:	4c 89 e7             	mov    %r12,%rdi
+  805544:	41 ff d7             	call   *%r15
+  805547:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80554e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805554:	48 83 c3 01          	add    $0x1,%rbx
+  805558:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80555c:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805562:	49 09 dc             	or     %rbx,%r12
+  805565:	41 83 ed 01          	sub    $0x1,%r13d
+  805569:	74 2f                	je     80559a <foreach_shared_region+0x217>
+  80556b:	4c 89 e3             	mov    %r12,%rbx
+  80556e:	48 c1 eb 0c          	shr    $0xc,%rbx
+  805572:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  805576:	a8 01                	test   $0x1,%al
+  805578:	75 b6                	jne    805530 <foreach_shared_region+0x1ad>
+  80557a:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805581:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805587:	48 83 c3 01          	add    $0x1,%rbx
+  80558b:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80558f:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805595:	49 09 dc             	or     %rbx,%r12
+  805598:	eb cb                	jmp    805565 <foreach_shared_region+0x1e2>
+  80559a:	4c 89 e0             	mov    %r12,%rax
+  80559d:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8055a3:	49 c1 ec 15          	shr    $0x15,%r12
+  8055a7:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8055ae:	49 83 c4 01          	add    $0x1,%r12
+  8055b2:	49 c1 e4 15          	shl    $0x15,%r12
+  8055b6:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8055bd:	49 09 c4             	or     %rax,%r12
+  8055c0:	e9 23 ff ff ff       	jmp    8054e8 <foreach_shared_region+0x165>
+  8055c5:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8055c9:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8055d0:	ff ff ff 
+  8055d3:	4c 21 e0             	and    %r12,%rax
+  8055d6:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8055da:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8055e1:	49 83 c4 01          	add    $0x1,%r12
+  8055e5:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8055e9:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8055f0:	00 00 00 
+  8055f3:	49 21 d4             	and    %rdx,%r12
+  8055f6:	49 09 c4             	or     %rax,%r12
+  8055f9:	e9 5d fe ff ff       	jmp    80545b <foreach_shared_region+0xd8>
+  8055fe:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  805605:	00 ff ff 
+  805608:	4c 21 e0             	and    %r12,%rax
+  80560b:	49 c1 ec 27          	shr    $0x27,%r12
+  80560f:	49 83 c4 01          	add    $0x1,%r12
+  805613:	49 c1 e4 27          	shl    $0x27,%r12
+  805617:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80561e:	ff 00 00 
+  805621:	49 21 d4             	and    %rdx,%r12
+  805624:	49 09 c4             	or     %rax,%r12
+  805627:	41 83 ed 01          	sub    $0x1,%r13d
+  80562b:	74 48                	je     805675 <foreach_shared_region+0x2f2>
+  80562d:	4c 89 e0             	mov    %r12,%rax
+  805630:	48 c1 e8 27          	shr    $0x27,%rax
+  805634:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80563b:	01 00 00 
+  80563e:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  805642:	f6 c2 01             	test   $0x1,%dl
+  805645:	0f 85 a5 fd ff ff    	jne    8053f0 <foreach_shared_region+0x6d>
+  80564b:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  805652:	00 ff ff 
+  805655:	4c 21 e2             	and    %r12,%rdx
+  805658:	48 83 c0 01          	add    $0x1,%rax
+  80565c:	48 c1 e0 27          	shl    $0x27,%rax
+  805660:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  805667:	ff 00 00 
+  80566a:	48 21 c8             	and    %rcx,%rax
+  80566d:	48 09 d0             	or     %rdx,%rax
+  805670:	49 89 c4             	mov    %rax,%r12
+  805673:	eb b2                	jmp    805627 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  805675:	4d 85 e4             	test   %r12,%r12
+  805678:	75 14                	jne    80568e <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80567a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80567f:	48 83 c4 28          	add    $0x28,%rsp
+  805683:	5b                   	pop    %rbx
+  805684:	41 5c                	pop    %r12
+  805686:	41 5d                	pop    %r13
+  805688:	41 5e                	pop    %r14
+  80568a:	41 5f                	pop    %r15
+  80568c:	5d                   	pop    %rbp
+  80568d:	c3                   	ret
+    assert(addr == 0);
+  80568e:	48 b9 2b 71 80 00 00 	movabs $0x80712b,%rcx
+  805695:	00 00 00 
+  805698:	48 ba c8 6f 80 00 00 	movabs $0x806fc8,%rdx
+  80569f:	00 00 00 
+  8056a2:	be 67 00 00 00       	mov    $0x67,%esi
+  8056a7:	48 bf 20 71 80 00 00 	movabs $0x807120,%rdi
+  8056ae:	00 00 00 
+  8056b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056b6:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  8056bd:	00 00 00 
+  8056c0:	41 ff d0             	call   *%r8
+
+00000000008056c3 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8056c3:	49 b8 20 b4 80 01 00 	movabs $0x180b420,%r8
+  8056ca:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8056cd:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8056d3:	eb 33                	jmp    805708 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8056d5:	48 83 c0 20          	add    $0x20,%rax
+  8056d9:	4c 39 c0             	cmp    %r8,%rax
+  8056dc:	74 25                	je     805703 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8056de:	48 8b 10             	mov    (%rax),%rdx
+  8056e1:	48 85 d2             	test   %rdx,%rdx
+  8056e4:	74 ef                	je     8056d5 <mmap_place+0x12>
+  8056e6:	48 89 d1             	mov    %rdx,%rcx
+  8056e9:	48 03 48 08          	add    0x8(%rax),%rcx
+  8056ed:	48 39 cf             	cmp    %rcx,%rdi
+  8056f0:	73 e3                	jae    8056d5 <mmap_place+0x12>
+  8056f2:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8056f6:	4c 39 ca             	cmp    %r9,%rdx
+  8056f9:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8056fd:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  805701:	eb d2                	jmp    8056d5 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  805703:	45 84 d2             	test   %r10b,%r10b
+  805706:	74 12                	je     80571a <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805708:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  80570f:	00 00 00 
+        moved = 0;
+  805712:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  805718:	eb c4                	jmp    8056de <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  80571a:	48 01 fe             	add    %rdi,%rsi
+  80571d:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  805724:	00 00 00 
+  805727:	48 39 f0             	cmp    %rsi,%rax
+  80572a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80572f:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  805733:	c3                   	ret
+
+0000000000805734 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  805734:	55                   	push   %rbp
+  805735:	48 89 e5             	mov    %rsp,%rbp
+  805738:	41 57                	push   %r15
+  80573a:	41 56                	push   %r14
+  80573c:	41 55                	push   %r13
+  80573e:	41 54                	push   %r12
+  805740:	53                   	push   %rbx
+  805741:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  805745:	48 8b 1f             	mov    (%rdi),%rbx
+  805748:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80574f:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805756:	00 00 00 
+  805759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80575e:	eb 12                	jmp    805772 <mmap_pgfault+0x3e>
+  805760:	48 83 c2 01          	add    $0x1,%rdx
+  805764:	48 83 c0 20          	add    $0x20,%rax
+  805768:	48 83 fa 20          	cmp    $0x20,%rdx
+  80576c:	0f 84 04 01 00 00    	je     805876 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  805772:	48 8b 08             	mov    (%rax),%rcx
+  805775:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  805779:	48 39 de             	cmp    %rbx,%rsi
+  80577c:	73 e2                	jae    805760 <mmap_pgfault+0x2c>
+  80577e:	48 03 48 08          	add    0x8(%rax),%rcx
+  805782:	48 39 cb             	cmp    %rcx,%rbx
+  805785:	73 d9                	jae    805760 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  805787:	48 c1 e2 05          	shl    $0x5,%rdx
+  80578b:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805792:	00 00 00 
+  805795:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  805799:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80579d:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8057a1:	f6 c2 01             	test   $0x1,%dl
+  8057a4:	0f 84 e0 00 00 00    	je     80588a <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  8057aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057af:	f6 c2 02             	test   $0x2,%dl
+  8057b2:	0f 84 c3 00 00 00    	je     80587b <mmap_pgfault+0x147>
+  8057b8:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8057bf:	ff ff ff 
+  8057c2:	48 23 56 10          	and    0x10(%rsi),%rdx
+  8057c6:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  8057cd:	00 00 00 
+  8057d0:	48 39 ca             	cmp    %rcx,%rdx
+  8057d3:	0f 85 a2 00 00 00    	jne    80587b <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8057d9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8057de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8057e3:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8057ea:	00 00 00 
+  8057ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057f2:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  8057f9:	00 00 00 
+  8057fc:	ff d0                	call   *%rax
+  8057fe:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  805800:	b8 00 00 00 00       	mov    $0x0,%eax
+  805805:	85 d2                	test   %edx,%edx
+  805807:	78 72                	js     80587b <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  805809:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80580e:	48 89 de             	mov    %rbx,%rsi
+  805811:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  805818:	00 00 00 
+  80581b:	4c 89 e7             	mov    %r12,%rdi
+  80581e:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  805825:	00 00 00 
+  805828:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  80582a:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  805830:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805836:	48 89 d9             	mov    %rbx,%rcx
+  805839:	ba 00 00 00 00       	mov    $0x0,%edx
+  80583e:	4c 89 e6             	mov    %r12,%rsi
+  805841:	bf 00 00 00 00       	mov    $0x0,%edi
+  805846:	48 b8 de 34 80 00 00 	movabs $0x8034de,%rax
+  80584d:	00 00 00 
+  805850:	ff d0                	call   *%rax
+  805852:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  805854:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805859:	4c 89 e6             	mov    %r12,%rsi
+  80585c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805861:	48 b8 49 35 80 00 00 	movabs $0x803549,%rax
+  805868:	00 00 00 
+  80586b:	ff d0                	call   *%rax
+    return res >= 0;
+  80586d:	89 d8                	mov    %ebx,%eax
+  80586f:	f7 d0                	not    %eax
+  805871:	c1 e8 1f             	shr    $0x1f,%eax
+  805874:	eb 05                	jmp    80587b <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  805876:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80587b:	48 83 c4 18          	add    $0x18,%rsp
+  80587f:	5b                   	pop    %rbx
+  805880:	41 5c                	pop    %r12
+  805882:	41 5d                	pop    %r13
+  805884:	41 5e                	pop    %r14
+  805886:	41 5f                	pop    %r15
+  805888:	5d                   	pop    %rbp
+  805889:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80588a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80588e:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  805892:	4c 03 30             	add    (%rax),%r14
+  805895:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80589c:	49 39 c6             	cmp    %rax,%r14
+  80589f:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  8058a3:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  8058aa:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  8058b0:	49 bf 6e 53 80 00 00 	movabs $0x80536e,%r15
+  8058b7:	00 00 00 
+  8058ba:	4d 39 f4             	cmp    %r14,%r12
+  8058bd:	73 1d                	jae    8058dc <mmap_pgfault+0x1a8>
+  8058bf:	4c 89 e7             	mov    %r12,%rdi
+  8058c2:	41 ff d7             	call   *%r15
+  8058c5:	84 c0                	test   %al,%al
+  8058c7:	75 13                	jne    8058dc <mmap_pgfault+0x1a8>
+  8058c9:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8058d0:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8058d7:	4d 39 f4             	cmp    %r14,%r12
+  8058da:	72 e3                	jb     8058bf <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8058dc:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8058e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8058e6:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8058ea:	74 2a                	je     805916 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8058ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8058f0:	89 de                	mov    %ebx,%esi
+  8058f2:	2b 30                	sub    (%rax),%esi
+  8058f4:	03 70 1c             	add    0x1c(%rax),%esi
+  8058f7:	8b 78 18             	mov    0x18(%rax),%edi
+  8058fa:	4c 89 e9             	mov    %r13,%rcx
+  8058fd:	48 89 da             	mov    %rbx,%rdx
+  805900:	48 b8 cc 4a 80 00 00 	movabs $0x804acc,%rax
+  805907:	00 00 00 
+  80590a:	ff d0                	call   *%rax
+    return res > 0;
+  80590c:	85 c0                	test   %eax,%eax
+  80590e:	0f 9f c0             	setg   %al
+  805911:	e9 65 ff ff ff       	jmp    80587b <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  805916:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  80591a:	eb d0                	jmp    8058ec <mmap_pgfault+0x1b8>
+
+000000000080591c <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  80591c:	55                   	push   %rbp
+  80591d:	48 89 e5             	mov    %rsp,%rbp
+  805920:	41 57                	push   %r15
+  805922:	41 56                	push   %r14
+  805924:	41 55                	push   %r13
+  805926:	41 54                	push   %r12
+  805928:	53                   	push   %rbx
+  805929:	48 83 ec 28          	sub    $0x28,%rsp
+  80592d:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  805931:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  805934:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80593b:	ff ff ff 
+  80593e:	48 23 57 10          	and    0x10(%rdi),%rdx
+  805942:	b8 00 00 00 00       	mov    $0x0,%eax
+  805947:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80594e:	00 00 00 
+  805951:	48 39 ca             	cmp    %rcx,%rdx
+  805954:	0f 85 e5 00 00 00    	jne    805a3f <mmap_writeback+0x123>
+  80595a:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80595d:	4c 39 ee             	cmp    %r13,%rsi
+  805960:	0f 83 e8 00 00 00    	jae    805a4e <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805966:	49 be 6e 53 80 00 00 	movabs $0x80536e,%r14
+  80596d:	00 00 00 
+  805970:	49 bf 55 53 80 00 00 	movabs $0x805355,%r15
+  805977:	00 00 00 
+  80597a:	eb 10                	jmp    80598c <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80597c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  805983:	4d 39 ec             	cmp    %r13,%r12
+  805986:	0f 83 ae 00 00 00    	jae    805a3a <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80598c:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805990:	4c 89 e7             	mov    %r12,%rdi
+  805993:	41 ff d6             	call   *%r14
+  805996:	84 c0                	test   %al,%al
+  805998:	74 e2                	je     80597c <mmap_writeback+0x60>
+  80599a:	4c 89 e7             	mov    %r12,%rdi
+  80599d:	41 ff d7             	call   *%r15
+  8059a0:	84 c0                	test   %al,%al
+  8059a2:	74 d8                	je     80597c <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8059a4:	4c 89 e3             	mov    %r12,%rbx
+  8059a7:	4d 39 ec             	cmp    %r13,%r12
+  8059aa:	73 20                	jae    8059cc <mmap_writeback+0xb0>
+  8059ac:	48 89 df             	mov    %rbx,%rdi
+  8059af:	41 ff d6             	call   *%r14
+  8059b2:	84 c0                	test   %al,%al
+  8059b4:	74 16                	je     8059cc <mmap_writeback+0xb0>
+  8059b6:	48 89 df             	mov    %rbx,%rdi
+  8059b9:	41 ff d7             	call   *%r15
+  8059bc:	84 c0                	test   %al,%al
+  8059be:	74 0c                	je     8059cc <mmap_writeback+0xb0>
+  8059c0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8059c7:	4c 39 eb             	cmp    %r13,%rbx
+  8059ca:	72 e0                	jb     8059ac <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  8059cc:	48 89 d9             	mov    %rbx,%rcx
+  8059cf:	4c 29 e1             	sub    %r12,%rcx
+  8059d2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8059d6:	44 89 e6             	mov    %r12d,%esi
+  8059d9:	2b 30                	sub    (%rax),%esi
+  8059db:	49 89 c4             	mov    %rax,%r12
+  8059de:	03 70 1c             	add    0x1c(%rax),%esi
+  8059e1:	8b 78 18             	mov    0x18(%rax),%edi
+  8059e4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8059e8:	48 89 ca             	mov    %rcx,%rdx
+  8059eb:	48 b8 55 4b 80 00 00 	movabs $0x804b55,%rax
+  8059f2:	00 00 00 
+  8059f5:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8059f7:	85 c0                	test   %eax,%eax
+  8059f9:	78 44                	js     805a3f <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8059fb:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  805a00:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  805a03:	41 89 c1             	mov    %eax,%r9d
+  805a06:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  805a0d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805a11:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805a15:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a1a:	48 89 ce             	mov    %rcx,%rsi
+  805a1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a22:	48 b8 de 34 80 00 00 	movabs $0x8034de,%rax
+  805a29:	00 00 00 
+  805a2c:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  805a2e:	85 c0                	test   %eax,%eax
+  805a30:	78 0d                	js     805a3f <mmap_writeback+0x123>
+  805a32:	49 89 dc             	mov    %rbx,%r12
+  805a35:	e9 49 ff ff ff       	jmp    805983 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  805a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a3f:	48 83 c4 28          	add    $0x28,%rsp
+  805a43:	5b                   	pop    %rbx
+  805a44:	41 5c                	pop    %r12
+  805a46:	41 5d                	pop    %r13
+  805a48:	41 5e                	pop    %r14
+  805a4a:	41 5f                	pop    %r15
+  805a4c:	5d                   	pop    %rbp
+  805a4d:	c3                   	ret
+    return 0;
+  805a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a53:	eb ea                	jmp    805a3f <mmap_writeback+0x123>
+
+0000000000805a55 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805a55:	55                   	push   %rbp
+  805a56:	48 89 e5             	mov    %rsp,%rbp
+  805a59:	41 57                	push   %r15
+  805a5b:	41 56                	push   %r14
+  805a5d:	41 55                	push   %r13
+  805a5f:	41 54                	push   %r12
+  805a61:	53                   	push   %rbx
+  805a62:	48 83 ec 38          	sub    $0x38,%rsp
+  805a66:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805a6a:	48 85 f6             	test   %rsi,%rsi
+  805a6d:	0f 84 0c 02 00 00    	je     805c7f <mmap+0x22a>
+  805a73:	49 89 ff             	mov    %rdi,%r15
+  805a76:	49 89 f4             	mov    %rsi,%r12
+  805a79:	41 89 d5             	mov    %edx,%r13d
+  805a7c:	41 89 ce             	mov    %ecx,%r14d
+  805a7f:	44 89 cb             	mov    %r9d,%ebx
+  805a82:	45 85 c9             	test   %r9d,%r9d
+  805a85:	0f 88 f4 01 00 00    	js     805c7f <mmap+0x22a>
+  805a8b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805a92:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805a99:	0f 85 e7 01 00 00    	jne    805c86 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805a9f:	83 e2 fd             	and    $0xfffffffd,%edx
+  805aa2:	83 fa 04             	cmp    $0x4,%edx
+  805aa5:	0f 85 db 01 00 00    	jne    805c86 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805aab:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805aae:	83 fa 01             	cmp    $0x1,%edx
+  805ab1:	0f 87 cf 01 00 00    	ja     805c86 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805ab7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805abb:	44 89 c7             	mov    %r8d,%edi
+  805abe:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  805ac5:	00 00 00 
+  805ac8:	ff d0                	call   *%rax
+  805aca:	89 c2                	mov    %eax,%edx
+  805acc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805ad3:	85 d2                	test   %edx,%edx
+  805ad5:	0f 88 ab 01 00 00    	js     805c86 <mmap+0x231>
+  805adb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805adf:	48 b9 40 80 80 00 00 	movabs $0x808040,%rcx
+  805ae6:	00 00 00 
+  805ae9:	8b 09                	mov    (%rcx),%ecx
+  805aeb:	39 0a                	cmp    %ecx,(%rdx)
+  805aed:	0f 85 93 01 00 00    	jne    805c86 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805af3:	8b 52 08             	mov    0x8(%rdx),%edx
+  805af6:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  805af9:	83 fa 01             	cmp    $0x1,%edx
+  805afc:	0f 84 84 01 00 00    	je     805c86 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805b02:	41 83 fe 01          	cmp    $0x1,%r14d
+  805b06:	74 42                	je     805b4a <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805b08:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805b0f:	4c 89 e6             	mov    %r12,%rsi
+  805b12:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  805b19:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805b1d:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805b21:	4d 85 ff             	test   %r15,%r15
+  805b24:	74 67                	je     805b8d <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805b26:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805b2d:	75 0f                	jne    805b3e <mmap+0xe9>
+  805b2f:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805b36:	00 00 00 
+  805b39:	49 39 c7             	cmp    %rax,%r15
+  805b3c:	77 1b                	ja     805b59 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805b3e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805b45:	e9 3c 01 00 00       	jmp    805c86 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805b4a:	41 f6 c5 02          	test   $0x2,%r13b
+  805b4e:	74 b8                	je     805b08 <mmap+0xb3>
+  805b50:	85 d2                	test   %edx,%edx
+  805b52:	75 b4                	jne    805b08 <mmap+0xb3>
+  805b54:	e9 2d 01 00 00       	jmp    805c86 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805b59:	4c 89 ff             	mov    %r15,%rdi
+  805b5c:	48 b8 c3 56 80 00 00 	movabs $0x8056c3,%rax
+  805b63:	00 00 00 
+  805b66:	ff d0                	call   *%rax
+  805b68:	48 89 c2             	mov    %rax,%rdx
+  805b6b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805b72:	49 39 d7             	cmp    %rdx,%r15
+  805b75:	0f 85 0b 01 00 00    	jne    805c86 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805b7b:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805b82:	00 00 00 
+  805b85:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805b8b:	eb 44                	jmp    805bd1 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805b8d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805b91:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805b98:	00 00 00 
+  805b9b:	48 b8 c3 56 80 00 00 	movabs $0x8056c3,%rax
+  805ba2:	00 00 00 
+  805ba5:	ff d0                	call   *%rax
+  805ba7:	48 89 c7             	mov    %rax,%rdi
+  805baa:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805bae:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805bb5:	48 85 ff             	test   %rdi,%rdi
+  805bb8:	75 c1                	jne    805b7b <mmap+0x126>
+  805bba:	e9 c7 00 00 00       	jmp    805c86 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805bbf:	49 83 c4 01          	add    $0x1,%r12
+  805bc3:	48 83 c0 20          	add    $0x20,%rax
+  805bc7:	49 83 fc 20          	cmp    $0x20,%r12
+  805bcb:	0f 84 a5 00 00 00    	je     805c76 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805bd1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805bd5:	75 e8                	jne    805bbf <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805bd7:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805bdb:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  805be2:	00 00 00 
+  805be5:	ff d0                	call   *%rax
+  805be7:	89 c2                	mov    %eax,%edx
+  805be9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805bf0:	85 d2                	test   %edx,%edx
+  805bf2:	0f 88 8e 00 00 00    	js     805c86 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805bf8:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805bfc:	48 b8 e1 3d 80 00 00 	movabs $0x803de1,%rax
+  805c03:	00 00 00 
+  805c06:	ff d0                	call   *%rax
+  805c08:	89 c6                	mov    %eax,%esi
+  805c0a:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805c0d:	48 b8 2f 40 80 00 00 	movabs $0x80402f,%rax
+  805c14:	00 00 00 
+  805c17:	ff d0                	call   *%rax
+  805c19:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805c1c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805c23:	45 85 ff             	test   %r15d,%r15d
+  805c26:	78 5e                	js     805c86 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805c28:	49 c1 e4 05          	shl    $0x5,%r12
+  805c2c:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805c33:	00 00 00 
+  805c36:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805c39:	48 bf 34 57 80 00 00 	movabs $0x805734,%rdi
+  805c40:	00 00 00 
+  805c43:	48 b8 59 3b 80 00 00 	movabs $0x803b59,%rax
+  805c4a:	00 00 00 
+  805c4d:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805c4f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805c53:	49 89 04 24          	mov    %rax,(%r12)
+  805c57:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805c5b:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805c60:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805c65:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805c6a:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805c6f:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805c74:	eb 10                	jmp    805c86 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805c76:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805c7d:	eb 07                	jmp    805c86 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805c7f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805c86:	48 83 c4 38          	add    $0x38,%rsp
+  805c8a:	5b                   	pop    %rbx
+  805c8b:	41 5c                	pop    %r12
+  805c8d:	41 5d                	pop    %r13
+  805c8f:	41 5e                	pop    %r14
+  805c91:	41 5f                	pop    %r15
+  805c93:	5d                   	pop    %rbp
+  805c94:	c3                   	ret
+
+0000000000805c95 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805c95:	55                   	push   %rbp
+  805c96:	48 89 e5             	mov    %rsp,%rbp
+  805c99:	41 57                	push   %r15
+  805c9b:	41 56                	push   %r14
+  805c9d:	41 55                	push   %r13
+  805c9f:	41 54                	push   %r12
+  805ca1:	53                   	push   %rbx
+  805ca2:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805ca6:	49 89 fe             	mov    %rdi,%r14
+  805ca9:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805cb0:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805cb7:	00 
+  805cb8:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805cbf:	48 bb 20 b0 80 01 00 	movabs $0x180b020,%rbx
+  805cc6:	00 00 00 
+  805cc9:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805cd0:	49 bf 1c 59 80 00 00 	movabs $0x80591c,%r15
+  805cd7:	00 00 00 
+  805cda:	eb 09                	jmp    805ce5 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805cdc:	48 83 c3 20          	add    $0x20,%rbx
+  805ce0:	4c 39 eb             	cmp    %r13,%rbx
+  805ce3:	74 33                	je     805d18 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805ce5:	48 89 df             	mov    %rbx,%rdi
+  805ce8:	48 8b 33             	mov    (%rbx),%rsi
+  805ceb:	4c 39 e6             	cmp    %r12,%rsi
+  805cee:	73 ec                	jae    805cdc <msync+0x47>
+  805cf0:	48 85 f6             	test   %rsi,%rsi
+  805cf3:	74 e7                	je     805cdc <msync+0x47>
+  805cf5:	48 89 f2             	mov    %rsi,%rdx
+  805cf8:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805cfc:	49 39 d6             	cmp    %rdx,%r14
+  805cff:	73 db                	jae    805cdc <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805d01:	4c 39 e2             	cmp    %r12,%rdx
+  805d04:	49 0f 47 d4          	cmova  %r12,%rdx
+  805d08:	4c 39 f6             	cmp    %r14,%rsi
+  805d0b:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805d0f:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805d12:	85 c0                	test   %eax,%eax
+  805d14:	79 c6                	jns    805cdc <msync+0x47>
+  805d16:	eb 05                	jmp    805d1d <msync+0x88>
+    }
+
+    return 0;
+  805d18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d1d:	48 83 c4 08          	add    $0x8,%rsp
+  805d21:	5b                   	pop    %rbx
+  805d22:	41 5c                	pop    %r12
+  805d24:	41 5d                	pop    %r13
+  805d26:	41 5e                	pop    %r14
+  805d28:	41 5f                	pop    %r15
+  805d2a:	5d                   	pop    %rbp
+  805d2b:	c3                   	ret
+
+0000000000805d2c <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805d2c:	55                   	push   %rbp
+  805d2d:	48 89 e5             	mov    %rsp,%rbp
+  805d30:	41 57                	push   %r15
+  805d32:	41 56                	push   %r14
+  805d34:	41 55                	push   %r13
+  805d36:	41 54                	push   %r12
+  805d38:	53                   	push   %rbx
+  805d39:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805d3d:	49 89 ff             	mov    %rdi,%r15
+  805d40:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805d47:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805d4e:	00 
+  805d4f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805d56:	48 bb 20 b0 80 01 00 	movabs $0x180b020,%rbx
+  805d5d:	00 00 00 
+  805d60:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805d67:	48 89 d8             	mov    %rbx,%rax
+  805d6a:	eb 09                	jmp    805d75 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805d6c:	48 83 c0 20          	add    $0x20,%rax
+  805d70:	4c 39 f0             	cmp    %r14,%rax
+  805d73:	74 40                	je     805db5 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805d75:	48 8b 10             	mov    (%rax),%rdx
+  805d78:	4c 39 e2             	cmp    %r12,%rdx
+  805d7b:	73 ef                	jae    805d6c <munmap+0x40>
+  805d7d:	48 85 d2             	test   %rdx,%rdx
+  805d80:	74 ea                	je     805d6c <munmap+0x40>
+  805d82:	48 89 d7             	mov    %rdx,%rdi
+  805d85:	48 03 78 08          	add    0x8(%rax),%rdi
+  805d89:	49 39 ff             	cmp    %rdi,%r15
+  805d8c:	73 de                	jae    805d6c <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805d8e:	49 39 fc             	cmp    %rdi,%r12
+  805d91:	72 05                	jb     805d98 <munmap+0x6c>
+  805d93:	4c 39 fa             	cmp    %r15,%rdx
+  805d96:	73 d4                	jae    805d6c <munmap+0x40>
+  805d98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805d9d:	48 83 c4 08          	add    $0x8,%rsp
+  805da1:	5b                   	pop    %rbx
+  805da2:	41 5c                	pop    %r12
+  805da4:	41 5d                	pop    %r13
+  805da6:	41 5e                	pop    %r14
+  805da8:	41 5f                	pop    %r15
+  805daa:	5d                   	pop    %rbp
+  805dab:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805dac:	48 83 c3 20          	add    $0x20,%rbx
+  805db0:	4c 39 f3             	cmp    %r14,%rbx
+  805db3:	74 5c                	je     805e11 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805db5:	48 8b 33             	mov    (%rbx),%rsi
+  805db8:	4c 39 e6             	cmp    %r12,%rsi
+  805dbb:	73 ef                	jae    805dac <munmap+0x80>
+  805dbd:	48 85 f6             	test   %rsi,%rsi
+  805dc0:	74 ea                	je     805dac <munmap+0x80>
+  805dc2:	48 89 f2             	mov    %rsi,%rdx
+  805dc5:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805dc9:	49 39 d7             	cmp    %rdx,%r15
+  805dcc:	73 de                	jae    805dac <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805dce:	48 89 df             	mov    %rbx,%rdi
+  805dd1:	48 b8 1c 59 80 00 00 	movabs $0x80591c,%rax
+  805dd8:	00 00 00 
+  805ddb:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805ddd:	85 c0                	test   %eax,%eax
+  805ddf:	78 bc                	js     805d9d <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805de1:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805de5:	48 8b 33             	mov    (%rbx),%rsi
+  805de8:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ded:	48 b8 49 35 80 00 00 	movabs $0x803549,%rax
+  805df4:	00 00 00 
+  805df7:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805df9:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805dfc:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  805e03:	00 00 00 
+  805e06:	ff d0                	call   *%rax
+        reg->start = 0;
+  805e08:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805e0f:	eb 9b                	jmp    805dac <munmap+0x80>
+    return 0;
+  805e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e16:	eb 85                	jmp    805d9d <munmap+0x71>
+
+0000000000805e18 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e1d:	c3                   	ret
+
+0000000000805e1e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805e1e:	55                   	push   %rbp
+  805e1f:	48 89 e5             	mov    %rsp,%rbp
+  805e22:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805e25:	48 be 35 71 80 00 00 	movabs $0x807135,%rsi
+  805e2c:	00 00 00 
+  805e2f:	48 b8 0c 2d 80 00 00 	movabs $0x802d0c,%rax
+  805e36:	00 00 00 
+  805e39:	ff d0                	call   *%rax
+    return 0;
+}
+  805e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e40:	5d                   	pop    %rbp
+  805e41:	c3                   	ret
+
+0000000000805e42 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805e42:	55                   	push   %rbp
+  805e43:	48 89 e5             	mov    %rsp,%rbp
+  805e46:	41 57                	push   %r15
+  805e48:	41 56                	push   %r14
+  805e4a:	41 55                	push   %r13
+  805e4c:	41 54                	push   %r12
+  805e4e:	53                   	push   %rbx
+  805e4f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805e56:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805e5d:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805e64:	00 00 00 00 
+  805e68:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805e6f:	00 00 00 00 
+  805e73:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805e7a:	00 00 00 00 
+  805e7e:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805e85:	00 00 00 00 
+  805e89:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805e90:	00 00 00 00 
+  805e94:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805e9b:	00 00 00 00 
+  805e9f:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805ea6:	00 
+  805ea7:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805eae:	00 
+  805eaf:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805eb6:	00 
+  805eb7:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805ebe:	00 
+  805ebf:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805ec6:	00 
+  805ec7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805ece:	00 
+  805ecf:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805ed6:	00 
+  805ed7:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805ede:	00 
+  805edf:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805ee6:	00 
+  805ee7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805eee:	00 
+    for (res = 0; res < n; res += inc) {
+  805eef:	48 85 d2             	test   %rdx,%rdx
+  805ef2:	74 7a                	je     805f6e <devcons_write+0x12c>
+  805ef4:	49 89 d6             	mov    %rdx,%r14
+  805ef7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805efd:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805f02:	49 bf 5c 30 80 00 00 	movabs $0x80305c,%r15
+  805f09:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805f0c:	4c 89 f3             	mov    %r14,%rbx
+  805f0f:	48 29 f3             	sub    %rsi,%rbx
+  805f12:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805f17:	48 39 c3             	cmp    %rax,%rbx
+  805f1a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805f1e:	4c 63 eb             	movslq %ebx,%r13
+  805f21:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805f28:	48 01 c6             	add    %rax,%rsi
+  805f2b:	4c 89 ea             	mov    %r13,%rdx
+  805f2e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805f35:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805f38:	4c 89 ee             	mov    %r13,%rsi
+  805f3b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805f42:	48 b8 89 32 80 00 00 	movabs $0x803289,%rax
+  805f49:	00 00 00 
+  805f4c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805f4e:	41 01 dc             	add    %ebx,%r12d
+  805f51:	49 63 f4             	movslq %r12d,%rsi
+  805f54:	4c 39 f6             	cmp    %r14,%rsi
+  805f57:	72 b3                	jb     805f0c <devcons_write+0xca>
+    return res;
+  805f59:	49 63 c4             	movslq %r12d,%rax
+}
+  805f5c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805f63:	5b                   	pop    %rbx
+  805f64:	41 5c                	pop    %r12
+  805f66:	41 5d                	pop    %r13
+  805f68:	41 5e                	pop    %r14
+  805f6a:	41 5f                	pop    %r15
+  805f6c:	5d                   	pop    %rbp
+  805f6d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805f6e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805f74:	eb e3                	jmp    805f59 <devcons_write+0x117>
+
+0000000000805f76 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805f76:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f7e:	48 85 c0             	test   %rax,%rax
+  805f81:	74 55                	je     805fd8 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805f83:	55                   	push   %rbp
+  805f84:	48 89 e5             	mov    %rsp,%rbp
+  805f87:	41 55                	push   %r13
+  805f89:	41 54                	push   %r12
+  805f8b:	53                   	push   %rbx
+  805f8c:	48 83 ec 08          	sub    $0x8,%rsp
+  805f90:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805f93:	48 bb bc 32 80 00 00 	movabs $0x8032bc,%rbx
+  805f9a:	00 00 00 
+  805f9d:	49 bc d0 33 80 00 00 	movabs $0x8033d0,%r12
+  805fa4:	00 00 00 
+  805fa7:	eb 03                	jmp    805fac <devcons_read+0x36>
+  805fa9:	41 ff d4             	call   *%r12
+  805fac:	ff d3                	call   *%rbx
+  805fae:	85 c0                	test   %eax,%eax
+  805fb0:	74 f7                	je     805fa9 <devcons_read+0x33>
+    if (c < 0) return c;
+  805fb2:	48 63 d0             	movslq %eax,%rdx
+  805fb5:	78 13                	js     805fca <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  805fbc:	83 f8 04             	cmp    $0x4,%eax
+  805fbf:	74 09                	je     805fca <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805fc1:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805fc5:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805fca:	48 89 d0             	mov    %rdx,%rax
+  805fcd:	48 83 c4 08          	add    $0x8,%rsp
+  805fd1:	5b                   	pop    %rbx
+  805fd2:	41 5c                	pop    %r12
+  805fd4:	41 5d                	pop    %r13
+  805fd6:	5d                   	pop    %rbp
+  805fd7:	c3                   	ret
+  805fd8:	48 89 d0             	mov    %rdx,%rax
+  805fdb:	c3                   	ret
+
+0000000000805fdc <cputchar>:
+cputchar(int ch) {
+  805fdc:	55                   	push   %rbp
+  805fdd:	48 89 e5             	mov    %rsp,%rbp
+  805fe0:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805fe4:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805fe8:	be 01 00 00 00       	mov    $0x1,%esi
+  805fed:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805ff1:	48 b8 89 32 80 00 00 	movabs $0x803289,%rax
+  805ff8:	00 00 00 
+  805ffb:	ff d0                	call   *%rax
+}
+  805ffd:	c9                   	leave
+  805ffe:	c3                   	ret
+
+0000000000805fff <getchar>:
+getchar(void) {
+  805fff:	55                   	push   %rbp
+  806000:	48 89 e5             	mov    %rsp,%rbp
+  806003:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  806007:	ba 01 00 00 00       	mov    $0x1,%edx
+  80600c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  806010:	bf 00 00 00 00       	mov    $0x0,%edi
+  806015:	48 b8 52 41 80 00 00 	movabs $0x804152,%rax
+  80601c:	00 00 00 
+  80601f:	ff d0                	call   *%rax
+  806021:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  806023:	85 c0                	test   %eax,%eax
+  806025:	78 06                	js     80602d <getchar+0x2e>
+  806027:	74 08                	je     806031 <getchar+0x32>
+  806029:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80602d:	89 d0                	mov    %edx,%eax
+  80602f:	c9                   	leave
+  806030:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  806031:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  806036:	eb f5                	jmp    80602d <getchar+0x2e>
+
+0000000000806038 <iscons>:
+iscons(int fdnum) {
+  806038:	55                   	push   %rbp
+  806039:	48 89 e5             	mov    %rsp,%rbp
+  80603c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  806040:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  806044:	48 b8 6f 3e 80 00 00 	movabs $0x803e6f,%rax
+  80604b:	00 00 00 
+  80604e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  806050:	85 c0                	test   %eax,%eax
+  806052:	78 18                	js     80606c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  806054:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806058:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  80605f:	00 00 00 
+  806062:	8b 00                	mov    (%rax),%eax
+  806064:	39 02                	cmp    %eax,(%rdx)
+  806066:	0f 94 c0             	sete   %al
+  806069:	0f b6 c0             	movzbl %al,%eax
+}
+  80606c:	c9                   	leave
+  80606d:	c3                   	ret
+
+000000000080606e <opencons>:
+opencons(void) {
+  80606e:	55                   	push   %rbp
+  80606f:	48 89 e5             	mov    %rsp,%rbp
+  806072:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  806076:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80607a:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  806081:	00 00 00 
+  806084:	ff d0                	call   *%rax
+  806086:	85 c0                	test   %eax,%eax
+  806088:	78 49                	js     8060d3 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80608a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80608f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  806094:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806098:	bf 00 00 00 00       	mov    $0x0,%edi
+  80609d:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  8060a4:	00 00 00 
+  8060a7:	ff d0                	call   *%rax
+  8060a9:	85 c0                	test   %eax,%eax
+  8060ab:	78 26                	js     8060d3 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8060ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8060b1:	a1 c0 80 80 00 00 00 	movabs 0x8080c0,%eax
+  8060b8:	00 00 
+  8060ba:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8060bc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8060c0:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8060c7:	48 b8 e1 3d 80 00 00 	movabs $0x803de1,%rax
+  8060ce:	00 00 00 
+  8060d1:	ff d0                	call   *%rax
+}
+  8060d3:	c9                   	leave
+  8060d4:	c3                   	ret
+
+00000000008060d5 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8060d5:	85 ff                	test   %edi,%edi
+  8060d7:	78 58                	js     806131 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8060d9:	48 85 f6             	test   %rsi,%rsi
+  8060dc:	74 12                	je     8060f0 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8060de:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  8060e5:	00 00 00 
+  8060e8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8060ee:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8060f0:	48 85 c9             	test   %rcx,%rcx
+  8060f3:	74 12                	je     806107 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8060f5:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  8060fc:	00 00 00 
+  8060ff:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  806105:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  806107:	48 85 d2             	test   %rdx,%rdx
+  80610a:	74 14                	je     806120 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80610c:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  806113:	00 00 00 
+  806116:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80611d:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  806120:	48 a1 f0 91 80 01 00 	movabs 0x18091f0,%rax
+  806127:	00 00 00 
+  80612a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  806130:	c3                   	ret
+        if (from_env_store) {
+  806131:	48 85 f6             	test   %rsi,%rsi
+  806134:	74 06                	je     80613c <ipc_result+0x67>
+            *from_env_store = 0;
+  806136:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80613c:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80613e:	48 85 c9             	test   %rcx,%rcx
+  806141:	74 ed                	je     806130 <ipc_result+0x5b>
+            *perm_store = 0;
+  806143:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  806149:	c3                   	ret
+
+000000000080614a <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80614a:	55                   	push   %rbp
+  80614b:	48 89 e5             	mov    %rsp,%rbp
+  80614e:	41 55                	push   %r13
+  806150:	41 54                	push   %r12
+  806152:	53                   	push   %rbx
+  806153:	48 83 ec 08          	sub    $0x8,%rsp
+  806157:	49 89 fc             	mov    %rdi,%r12
+  80615a:	48 89 f7             	mov    %rsi,%rdi
+  80615d:	48 89 d3             	mov    %rdx,%rbx
+  806160:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806163:	48 85 f6             	test   %rsi,%rsi
+  806166:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80616d:	00 00 00 
+  806170:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  806174:	be 00 00 00 00       	mov    $0x0,%esi
+  806179:	48 85 d2             	test   %rdx,%rdx
+  80617c:	74 03                	je     806181 <ipc_recv+0x37>
+  80617e:	48 8b 32             	mov    (%rdx),%rsi
+  806181:	48 b8 bd 39 80 00 00 	movabs $0x8039bd,%rax
+  806188:	00 00 00 
+  80618b:	ff d0                	call   *%rax
+  80618d:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80618f:	4c 89 e9             	mov    %r13,%rcx
+  806192:	48 89 da             	mov    %rbx,%rdx
+  806195:	4c 89 e6             	mov    %r12,%rsi
+  806198:	48 b8 d5 60 80 00 00 	movabs $0x8060d5,%rax
+  80619f:	00 00 00 
+  8061a2:	ff d0                	call   *%rax
+}
+  8061a4:	48 83 c4 08          	add    $0x8,%rsp
+  8061a8:	5b                   	pop    %rbx
+  8061a9:	41 5c                	pop    %r12
+  8061ab:	41 5d                	pop    %r13
+  8061ad:	5d                   	pop    %rbp
+  8061ae:	c3                   	ret
+
+00000000008061af <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8061af:	55                   	push   %rbp
+  8061b0:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8061b3:	48 85 d2             	test   %rdx,%rdx
+  8061b6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8061bd:	00 00 00 
+  8061c0:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8061c4:	89 f6                	mov    %esi,%esi
+  8061c6:	48 b8 49 38 80 00 00 	movabs $0x803849,%rax
+  8061cd:	00 00 00 
+  8061d0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8061d2:	85 c0                	test   %eax,%eax
+  8061d4:	78 02                	js     8061d8 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8061d6:	5d                   	pop    %rbp
+  8061d7:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8061d8:	89 c1                	mov    %eax,%ecx
+  8061da:	48 ba 41 71 80 00 00 	movabs $0x807141,%rdx
+  8061e1:	00 00 00 
+  8061e4:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8061e9:	48 bf 4e 71 80 00 00 	movabs $0x80714e,%rdi
+  8061f0:	00 00 00 
+  8061f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061f8:	49 b8 85 22 80 00 00 	movabs $0x802285,%r8
+  8061ff:	00 00 00 
+  806202:	41 ff d0             	call   *%r8
+
+0000000000806205 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  806205:	55                   	push   %rbp
+  806206:	48 89 e5             	mov    %rsp,%rbp
+  806209:	53                   	push   %rbx
+  80620a:	48 83 ec 08          	sub    $0x8,%rsp
+  80620e:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  806212:	48 85 d2             	test   %rdx,%rdx
+  806215:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80621c:	00 00 00 
+  80621f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806223:	4d 85 c9             	test   %r9,%r9
+  806226:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80622a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80622f:	48 85 db             	test   %rbx,%rbx
+  806232:	74 03                	je     806237 <ipc_call+0x32>
+  806234:	48 8b 03             	mov    (%rbx),%rax
+  806237:	89 f6                	mov    %esi,%esi
+  806239:	48 83 ec 08          	sub    $0x8,%rsp
+  80623d:	50                   	push   %rax
+  80623e:	48 b8 7b 38 80 00 00 	movabs $0x80387b,%rax
+  806245:	00 00 00 
+  806248:	ff d0                	call   *%rax
+  80624a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  80624c:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  806250:	48 89 da             	mov    %rbx,%rdx
+  806253:	be 00 00 00 00       	mov    $0x0,%esi
+  806258:	48 b8 d5 60 80 00 00 	movabs $0x8060d5,%rax
+  80625f:	00 00 00 
+  806262:	ff d0                	call   *%rax
+}
+  806264:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806268:	c9                   	leave
+  806269:	c3                   	ret
+
+000000000080626a <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  80626a:	55                   	push   %rbp
+  80626b:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  80626e:	89 f6                	mov    %esi,%esi
+  806270:	48 b8 e7 38 80 00 00 	movabs $0x8038e7,%rax
+  806277:	00 00 00 
+  80627a:	ff d0                	call   *%rax
+  80627c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  80627e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806283:	ba 00 00 00 00       	mov    $0x0,%edx
+  806288:	be 00 00 00 00       	mov    $0x0,%esi
+  80628d:	48 b8 d5 60 80 00 00 	movabs $0x8060d5,%rax
+  806294:	00 00 00 
+  806297:	ff d0                	call   *%rax
+}
+  806299:	5d                   	pop    %rbp
+  80629a:	c3                   	ret
+
+000000000080629b <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80629b:	55                   	push   %rbp
+  80629c:	48 89 e5             	mov    %rsp,%rbp
+  80629f:	41 54                	push   %r12
+  8062a1:	53                   	push   %rbx
+  8062a2:	4c 89 cb             	mov    %r9,%rbx
+  8062a5:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8062a9:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8062ad:	48 85 d2             	test   %rdx,%rdx
+  8062b0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8062b7:	00 00 00 
+  8062ba:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8062be:	4d 85 c9             	test   %r9,%r9
+  8062c1:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8062c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062ca:	4d 85 e4             	test   %r12,%r12
+  8062cd:	74 04                	je     8062d3 <ipc_reply_wait+0x38>
+  8062cf:	49 8b 04 24          	mov    (%r12),%rax
+  8062d3:	89 f6                	mov    %esi,%esi
+  8062d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8062d9:	50                   	push   %rax
+  8062da:	48 b8 51 39 80 00 00 	movabs $0x803951,%rax
+  8062e1:	00 00 00 
+  8062e4:	ff d0                	call   *%rax
+  8062e6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8062e8:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8062ec:	4c 89 e2             	mov    %r12,%rdx
+  8062ef:	48 89 de             	mov    %rbx,%rsi
+  8062f2:	48 b8 d5 60 80 00 00 	movabs $0x8060d5,%rax
+  8062f9:	00 00 00 
+  8062fc:	ff d0                	call   *%rax
+}
+  8062fe:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806302:	5b                   	pop    %rbx
+  806303:	41 5c                	pop    %r12
+  806305:	5d                   	pop    %rbp
+  806306:	c3                   	ret
+
+0000000000806307 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  806307:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80630c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  806313:	00 00 00 
+  806316:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80631d:	48 01 ca             	add    %rcx,%rdx
+  806320:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  806326:	39 fa                	cmp    %edi,%edx
+  806328:	74 12                	je     80633c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80632a:	48 83 c0 01          	add    $0x1,%rax
+  80632e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  806334:	75 e0                	jne    806316 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  806336:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80633b:	c3                   	ret
+            return envs[i].env_id;
+  80633c:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  806343:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80634a:	00 00 00 
+  80634d:	48 01 d0             	add    %rdx,%rax
+  806350:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  806356:	c3                   	ret
+  806357:	90                   	nop
+
+0000000000806358 <__rodata_start>:
+  806358:	77 00                	ja     80635a <__rodata_start+0x2>
+  80635a:	72 62                	jb     8063be <__rodata_start+0x66>
+  80635c:	00 77 62             	add    %dh,0x62(%rdi)
+  80635f:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  806365:	00 00                	add    %al,(%rax)
+  806367:	00 ed                	add    %ch,%ch
+  806369:	0d 80 00 00 00       	or     $0x80,%eax
+  80636e:	00 00                	add    %al,(%rax)
+  806370:	ed                   	in     (%dx),%eax
+  806371:	0d 80 00 00 00       	or     $0x80,%eax
+  806376:	00 00                	add    %al,(%rax)
+  806378:	ed                   	in     (%dx),%eax
+  806379:	0d 80 00 00 00       	or     $0x80,%eax
+  80637e:	00 00                	add    %al,(%rax)
+  806380:	ed                   	in     (%dx),%eax
+  806381:	0d 80 00 00 00       	or     $0x80,%eax
+  806386:	00 00                	add    %al,(%rax)
+  806388:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80638d:	00 00                	add    %al,(%rax)
+  80638f:	00 ed                	add    %ch,%ch
+  806391:	0d 80 00 00 00       	or     $0x80,%eax
+  806396:	00 00                	add    %al,(%rax)
+  806398:	ed                   	in     (%dx),%eax
+  806399:	0d 80 00 00 00       	or     $0x80,%eax
+  80639e:	00 00                	add    %al,(%rax)
+  8063a0:	ed                   	in     (%dx),%eax
+  8063a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8063a6:	00 00                	add    %al,(%rax)
+  8063a8:	ed                   	in     (%dx),%eax
+  8063a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063ae:	00 00                	add    %al,(%rax)
+  8063b0:	ed                   	in     (%dx),%eax
+  8063b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8063b6:	00 00                	add    %al,(%rax)
+  8063b8:	8c 0a                	mov    %cs,(%rdx)
+  8063ba:	80 00 00             	addb   $0x0,(%rax)
+  8063bd:	00 00                	add    %al,(%rax)
+  8063bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063c6:	00 00                	add    %al,(%rax)
+  8063c8:	8c 0a                	mov    %cs,(%rdx)
+  8063ca:	80 00 00             	addb   $0x0,(%rax)
+  8063cd:	00 00                	add    %al,(%rax)
+  8063cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063d6:	00 00                	add    %al,(%rax)
+  8063d8:	8c 0a                	mov    %cs,(%rdx)
+  8063da:	80 00 00             	addb   $0x0,(%rax)
+  8063dd:	00 00                	add    %al,(%rax)
+  8063df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063e6:	00 00                	add    %al,(%rax)
+  8063e8:	8c 0a                	mov    %cs,(%rdx)
+  8063ea:	80 00 00             	addb   $0x0,(%rax)
+  8063ed:	00 00                	add    %al,(%rax)
+  8063ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063f6:	00 00                	add    %al,(%rax)
+  8063f8:	8c 0a                	mov    %cs,(%rdx)
+  8063fa:	80 00 00             	addb   $0x0,(%rax)
+  8063fd:	00 00                	add    %al,(%rax)
+  8063ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806406:	00 00                	add    %al,(%rax)
+  806408:	ed                   	in     (%dx),%eax
+  806409:	0d 80 00 00 00       	or     $0x80,%eax
+  80640e:	00 00                	add    %al,(%rax)
+  806410:	ed                   	in     (%dx),%eax
+  806411:	0d 80 00 00 00       	or     $0x80,%eax
+  806416:	00 00                	add    %al,(%rax)
+  806418:	ed                   	in     (%dx),%eax
+  806419:	0d 80 00 00 00       	or     $0x80,%eax
+  80641e:	00 00                	add    %al,(%rax)
+  806420:	ed                   	in     (%dx),%eax
+  806421:	0d 80 00 00 00       	or     $0x80,%eax
+  806426:	00 00                	add    %al,(%rax)
+  806428:	ed                   	in     (%dx),%eax
+  806429:	0d 80 00 00 00       	or     $0x80,%eax
+  80642e:	00 00                	add    %al,(%rax)
+  806430:	ed                   	in     (%dx),%eax
+  806431:	0d 80 00 00 00       	or     $0x80,%eax
+  806436:	00 00                	add    %al,(%rax)
+  806438:	ed                   	in     (%dx),%eax
+  806439:	0d 80 00 00 00       	or     $0x80,%eax
+  80643e:	00 00                	add    %al,(%rax)
+  806440:	ed                   	in     (%dx),%eax
+  806441:	0d 80 00 00 00       	or     $0x80,%eax
+  806446:	00 00                	add    %al,(%rax)
+  806448:	ed                   	in     (%dx),%eax
+  806449:	0d 80 00 00 00       	or     $0x80,%eax
+  80644e:	00 00                	add    %al,(%rax)
+  806450:	ed                   	in     (%dx),%eax
+  806451:	0d 80 00 00 00       	or     $0x80,%eax
+  806456:	00 00                	add    %al,(%rax)
+  806458:	ed                   	in     (%dx),%eax
+  806459:	0d 80 00 00 00       	or     $0x80,%eax
+  80645e:	00 00                	add    %al,(%rax)
+  806460:	ed                   	in     (%dx),%eax
+  806461:	0d 80 00 00 00       	or     $0x80,%eax
+  806466:	00 00                	add    %al,(%rax)
+  806468:	ed                   	in     (%dx),%eax
+  806469:	0d 80 00 00 00       	or     $0x80,%eax
+  80646e:	00 00                	add    %al,(%rax)
+  806470:	ed                   	in     (%dx),%eax
+  806471:	0d 80 00 00 00       	or     $0x80,%eax
+  806476:	00 00                	add    %al,(%rax)
+  806478:	ed                   	in     (%dx),%eax
+  806479:	0d 80 00 00 00       	or     $0x80,%eax
+  80647e:	00 00                	add    %al,(%rax)
+  806480:	ed                   	in     (%dx),%eax
+  806481:	0d 80 00 00 00       	or     $0x80,%eax
+  806486:	00 00                	add    %al,(%rax)
+  806488:	ed                   	in     (%dx),%eax
+  806489:	0d 80 00 00 00       	or     $0x80,%eax
+  80648e:	00 00                	add    %al,(%rax)
+  806490:	ed                   	in     (%dx),%eax
+  806491:	0d 80 00 00 00       	or     $0x80,%eax
+  806496:	00 00                	add    %al,(%rax)
+  806498:	ed                   	in     (%dx),%eax
+  806499:	0d 80 00 00 00       	or     $0x80,%eax
+  80649e:	00 00                	add    %al,(%rax)
+  8064a0:	ed                   	in     (%dx),%eax
+  8064a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064a6:	00 00                	add    %al,(%rax)
+  8064a8:	ed                   	in     (%dx),%eax
+  8064a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064ae:	00 00                	add    %al,(%rax)
+  8064b0:	ed                   	in     (%dx),%eax
+  8064b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064b6:	00 00                	add    %al,(%rax)
+  8064b8:	ed                   	in     (%dx),%eax
+  8064b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064be:	00 00                	add    %al,(%rax)
+  8064c0:	ed                   	in     (%dx),%eax
+  8064c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064c6:	00 00                	add    %al,(%rax)
+  8064c8:	ed                   	in     (%dx),%eax
+  8064c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064ce:	00 00                	add    %al,(%rax)
+  8064d0:	ed                   	in     (%dx),%eax
+  8064d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064d6:	00 00                	add    %al,(%rax)
+  8064d8:	ed                   	in     (%dx),%eax
+  8064d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064de:	00 00                	add    %al,(%rax)
+  8064e0:	ed                   	in     (%dx),%eax
+  8064e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064e6:	00 00                	add    %al,(%rax)
+  8064e8:	ed                   	in     (%dx),%eax
+  8064e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064ee:	00 00                	add    %al,(%rax)
+  8064f0:	ed                   	in     (%dx),%eax
+  8064f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064f6:	00 00                	add    %al,(%rax)
+  8064f8:	f4                   	hlt
+  8064f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8064ff:	00 ed                	add    %ch,%ch
+  806501:	0d 80 00 00 00       	or     $0x80,%eax
+  806506:	00 00                	add    %al,(%rax)
+  806508:	ed                   	in     (%dx),%eax
+  806509:	0d 80 00 00 00       	or     $0x80,%eax
+  80650e:	00 00                	add    %al,(%rax)
+  806510:	2c 0b                	sub    $0xb,%al
+  806512:	80 00 00             	addb   $0x0,(%rax)
+  806515:	00 00                	add    %al,(%rax)
+  806517:	00 ed                	add    %ch,%ch
+  806519:	0d 80 00 00 00       	or     $0x80,%eax
+  80651e:	00 00                	add    %al,(%rax)
+  806520:	ed                   	in     (%dx),%eax
+  806521:	0d 80 00 00 00       	or     $0x80,%eax
+  806526:	00 00                	add    %al,(%rax)
+  806528:	ed                   	in     (%dx),%eax
+  806529:	0d 80 00 00 00       	or     $0x80,%eax
+  80652e:	00 00                	add    %al,(%rax)
+  806530:	ed                   	in     (%dx),%eax
+  806531:	0d 80 00 00 00       	or     $0x80,%eax
+  806536:	00 00                	add    %al,(%rax)
+  806538:	ed                   	in     (%dx),%eax
+  806539:	0d 80 00 00 00       	or     $0x80,%eax
+  80653e:	00 00                	add    %al,(%rax)
+  806540:	ed                   	in     (%dx),%eax
+  806541:	0d 80 00 00 00       	or     $0x80,%eax
+  806546:	00 00                	add    %al,(%rax)
+  806548:	ed                   	in     (%dx),%eax
+  806549:	0d 80 00 00 00       	or     $0x80,%eax
+  80654e:	00 00                	add    %al,(%rax)
+  806550:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806553:	00 00                	add    %al,(%rax)
+  806555:	00 00                	add    %al,(%rax)
+  806557:	00 cb                	add    %cl,%bl
+  806559:	0d 80 00 00 00       	or     $0x80,%eax
+  80655e:	00 00                	add    %al,(%rax)
+  806560:	ed                   	in     (%dx),%eax
+  806561:	0d 80 00 00 00       	or     $0x80,%eax
+  806566:	00 00                	add    %al,(%rax)
+  806568:	ed                   	in     (%dx),%eax
+  806569:	0d 80 00 00 00       	or     $0x80,%eax
+  80656e:	00 00                	add    %al,(%rax)
+  806570:	ed                   	in     (%dx),%eax
+  806571:	0d 80 00 00 00       	or     $0x80,%eax
+  806576:	00 00                	add    %al,(%rax)
+  806578:	6a 0a                	push   $0xa
+  80657a:	80 00 00             	addb   $0x0,(%rax)
+  80657d:	00 00                	add    %al,(%rax)
+  80657f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806585:	00 00                	add    %al,(%rax)
+  806587:	00 ed                	add    %ch,%ch
+  806589:	0d 80 00 00 00       	or     $0x80,%eax
+  80658e:	00 00                	add    %al,(%rax)
+  806590:	ed                   	in     (%dx),%eax
+  806591:	0d 80 00 00 00       	or     $0x80,%eax
+  806596:	00 00                	add    %al,(%rax)
+  806598:	3c 0a                	cmp    $0xa,%al
+  80659a:	80 00 00             	addb   $0x0,(%rax)
+  80659d:	00 00                	add    %al,(%rax)
+  80659f:	00 ed                	add    %ch,%ch
+  8065a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065a6:	00 00                	add    %al,(%rax)
+  8065a8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  8065ab:	00 00                	add    %al,(%rax)
+  8065ad:	00 00                	add    %al,(%rax)
+  8065af:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  8065b5:	00 00                	add    %al,(%rax)
+  8065b7:	00 29                	add    %ch,(%rcx)
+  8065b9:	0c 80                	or     $0x80,%al
+  8065bb:	00 00                	add    %al,(%rax)
+  8065bd:	00 00                	add    %al,(%rax)
+  8065bf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8065c2:	80 00 00             	addb   $0x0,(%rax)
+  8065c5:	00 00                	add    %al,(%rax)
+  8065c7:	00 ed                	add    %ch,%ch
+  8065c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ce:	00 00                	add    %al,(%rax)
+  8065d0:	1a 0b                	sbb    (%rbx),%cl
+  8065d2:	80 00 00             	addb   $0x0,(%rax)
+  8065d5:	00 00                	add    %al,(%rax)
+  8065d7:	00 ed                	add    %ch,%ch
+  8065d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065de:	00 00                	add    %al,(%rax)
+  8065e0:	ce                   	(bad)
+  8065e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8065e7:	00 ed                	add    %ch,%ch
+  8065e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ee:	00 00                	add    %al,(%rax)
+  8065f0:	ed                   	in     (%dx),%eax
+  8065f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065f6:	00 00                	add    %al,(%rax)
+  8065f8:	f4                   	hlt
+  8065f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8065ff:	00 37                	add    %dh,(%rdi)
+  806601:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806607:	00 5f 12             	add    %bl,0x12(%rdi)
+  80660a:	80 00 00             	addb   $0x0,(%rax)
+  80660d:	00 00                	add    %al,(%rax)
+  80660f:	00 37                	add    %dh,(%rdi)
+  806611:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806617:	00 5f 12             	add    %bl,0x12(%rdi)
+  80661a:	80 00 00             	addb   $0x0,(%rax)
+  80661d:	00 00                	add    %al,(%rax)
+  80661f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806622:	80 00 00             	addb   $0x0,(%rax)
+  806625:	00 00                	add    %al,(%rax)
+  806627:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80662b:	00 00                	add    %al,(%rax)
+  80662d:	00 00                	add    %al,(%rax)
+  80662f:	00 d2                	add    %dl,%dl
+  806631:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806637:	00 d2                	add    %dl,%dl
+  806639:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80663f:	00 d2                	add    %dl,%dl
+  806641:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806647:	00 d2                	add    %dl,%dl
+  806649:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80664f:	00 d2                	add    %dl,%dl
+  806651:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806657:	00 d2                	add    %dl,%dl
+  806659:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80665f:	00 d2                	add    %dl,%dl
+  806661:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806667:	00 f6                	add    %dh,%dh
+  806669:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80666f:	00 f6                	add    %dh,%dh
+  806671:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806677:	00 5f 12             	add    %bl,0x12(%rdi)
+  80667a:	80 00 00             	addb   $0x0,(%rax)
+  80667d:	00 00                	add    %al,(%rax)
+  80667f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806682:	80 00 00             	addb   $0x0,(%rax)
+  806685:	00 00                	add    %al,(%rax)
+  806687:	00 5f 12             	add    %bl,0x12(%rdi)
+  80668a:	80 00 00             	addb   $0x0,(%rax)
+  80668d:	00 00                	add    %al,(%rax)
+  80668f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806692:	80 00 00             	addb   $0x0,(%rax)
+  806695:	00 00                	add    %al,(%rax)
+  806697:	00 5f 12             	add    %bl,0x12(%rdi)
+  80669a:	80 00 00             	addb   $0x0,(%rax)
+  80669d:	00 00                	add    %al,(%rax)
+  80669f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066a2:	80 00 00             	addb   $0x0,(%rax)
+  8066a5:	00 00                	add    %al,(%rax)
+  8066a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066aa:	80 00 00             	addb   $0x0,(%rax)
+  8066ad:	00 00                	add    %al,(%rax)
+  8066af:	00 22                	add    %ah,(%rdx)
+  8066b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066b7:	00 22                	add    %ah,(%rdx)
+  8066b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066bf:	00 22                	add    %ah,(%rdx)
+  8066c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066c7:	00 22                	add    %ah,(%rdx)
+  8066c9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066cf:	00 22                	add    %ah,(%rdx)
+  8066d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066d7:	00 22                	add    %ah,(%rdx)
+  8066d9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066e2:	80 00 00             	addb   $0x0,(%rax)
+  8066e5:	00 00                	add    %al,(%rax)
+  8066e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066ea:	80 00 00             	addb   $0x0,(%rax)
+  8066ed:	00 00                	add    %al,(%rax)
+  8066ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066f2:	80 00 00             	addb   $0x0,(%rax)
+  8066f5:	00 00                	add    %al,(%rax)
+  8066f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066fa:	80 00 00             	addb   $0x0,(%rax)
+  8066fd:	00 00                	add    %al,(%rax)
+  8066ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806702:	80 00 00             	addb   $0x0,(%rax)
+  806705:	00 00                	add    %al,(%rax)
+  806707:	00 5f 12             	add    %bl,0x12(%rdi)
+  80670a:	80 00 00             	addb   $0x0,(%rax)
+  80670d:	00 00                	add    %al,(%rax)
+  80670f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806712:	80 00 00             	addb   $0x0,(%rax)
+  806715:	00 00                	add    %al,(%rax)
+  806717:	00 5f 12             	add    %bl,0x12(%rdi)
+  80671a:	80 00 00             	addb   $0x0,(%rax)
+  80671d:	00 00                	add    %al,(%rax)
+  80671f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806722:	80 00 00             	addb   $0x0,(%rax)
+  806725:	00 00                	add    %al,(%rax)
+  806727:	00 5f 12             	add    %bl,0x12(%rdi)
+  80672a:	80 00 00             	addb   $0x0,(%rax)
+  80672d:	00 00                	add    %al,(%rax)
+  80672f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806732:	80 00 00             	addb   $0x0,(%rax)
+  806735:	00 00                	add    %al,(%rax)
+  806737:	00 5f 12             	add    %bl,0x12(%rdi)
+  80673a:	80 00 00             	addb   $0x0,(%rax)
+  80673d:	00 00                	add    %al,(%rax)
+  80673f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806742:	80 00 00             	addb   $0x0,(%rax)
+  806745:	00 00                	add    %al,(%rax)
+  806747:	00 5f 12             	add    %bl,0x12(%rdi)
+  80674a:	80 00 00             	addb   $0x0,(%rax)
+  80674d:	00 00                	add    %al,(%rax)
+  80674f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806752:	80 00 00             	addb   $0x0,(%rax)
+  806755:	00 00                	add    %al,(%rax)
+  806757:	00 5f 12             	add    %bl,0x12(%rdi)
+  80675a:	80 00 00             	addb   $0x0,(%rax)
+  80675d:	00 00                	add    %al,(%rax)
+  80675f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806762:	80 00 00             	addb   $0x0,(%rax)
+  806765:	00 00                	add    %al,(%rax)
+  806767:	00 46 12             	add    %al,0x12(%rsi)
+  80676a:	80 00 00             	addb   $0x0,(%rax)
+  80676d:	00 00                	add    %al,(%rax)
+  80676f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806772:	80 00 00             	addb   $0x0,(%rax)
+  806775:	00 00                	add    %al,(%rax)
+  806777:	00 5f 12             	add    %bl,0x12(%rdi)
+  80677a:	80 00 00             	addb   $0x0,(%rax)
+  80677d:	00 00                	add    %al,(%rax)
+  80677f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806782:	80 00 00             	addb   $0x0,(%rax)
+  806785:	00 00                	add    %al,(%rax)
+  806787:	00 5f 12             	add    %bl,0x12(%rdi)
+  80678a:	80 00 00             	addb   $0x0,(%rax)
+  80678d:	00 00                	add    %al,(%rax)
+  80678f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806792:	80 00 00             	addb   $0x0,(%rax)
+  806795:	00 00                	add    %al,(%rax)
+  806797:	00 5f 12             	add    %bl,0x12(%rdi)
+  80679a:	80 00 00             	addb   $0x0,(%rax)
+  80679d:	00 00                	add    %al,(%rax)
+  80679f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067a2:	80 00 00             	addb   $0x0,(%rax)
+  8067a5:	00 00                	add    %al,(%rax)
+  8067a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067aa:	80 00 00             	addb   $0x0,(%rax)
+  8067ad:	00 00                	add    %al,(%rax)
+  8067af:	00 22                	add    %ah,(%rdx)
+  8067b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067b7:	00 22                	add    %ah,(%rdx)
+  8067b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067bf:	00 22                	add    %ah,(%rdx)
+  8067c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067c7:	00 22                	add    %ah,(%rdx)
+  8067c9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067cf:	00 22                	add    %ah,(%rdx)
+  8067d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067d7:	00 22                	add    %ah,(%rdx)
+  8067d9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067e2:	80 00 00             	addb   $0x0,(%rax)
+  8067e5:	00 00                	add    %al,(%rax)
+  8067e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067ea:	80 00 00             	addb   $0x0,(%rax)
+  8067ed:	00 00                	add    %al,(%rax)
+  8067ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067f2:	80 00 00             	addb   $0x0,(%rax)
+  8067f5:	00 00                	add    %al,(%rax)
+  8067f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067fa:	80 00 00             	addb   $0x0,(%rax)
+  8067fd:	00 00                	add    %al,(%rax)
+  8067ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806802:	80 00 00             	addb   $0x0,(%rax)
+  806805:	00 00                	add    %al,(%rax)
+  806807:	00 5f 12             	add    %bl,0x12(%rdi)
+  80680a:	80 00 00             	addb   $0x0,(%rax)
+  80680d:	00 00                	add    %al,(%rax)
+  80680f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806812:	80 00 00             	addb   $0x0,(%rax)
+  806815:	00 00                	add    %al,(%rax)
+  806817:	00 5f 12             	add    %bl,0x12(%rdi)
+  80681a:	80 00 00             	addb   $0x0,(%rax)
+  80681d:	00 00                	add    %al,(%rax)
+  80681f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806822:	80 00 00             	addb   $0x0,(%rax)
+  806825:	00 00                	add    %al,(%rax)
+  806827:	00 5f 12             	add    %bl,0x12(%rdi)
+  80682a:	80 00 00             	addb   $0x0,(%rax)
+  80682d:	00 00                	add    %al,(%rax)
+  80682f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806832:	80 00 00             	addb   $0x0,(%rax)
+  806835:	00 00                	add    %al,(%rax)
+  806837:	00 5f 12             	add    %bl,0x12(%rdi)
+  80683a:	80 00 00             	addb   $0x0,(%rax)
+  80683d:	00 00                	add    %al,(%rax)
+  80683f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806842:	80 00 00             	addb   $0x0,(%rax)
+  806845:	00 00                	add    %al,(%rax)
+  806847:	00 5f 12             	add    %bl,0x12(%rdi)
+  80684a:	80 00 00             	addb   $0x0,(%rax)
+  80684d:	00 00                	add    %al,(%rax)
+  80684f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806852:	80 00 00             	addb   $0x0,(%rax)
+  806855:	00 00                	add    %al,(%rax)
+  806857:	00 5f 12             	add    %bl,0x12(%rdi)
+  80685a:	80 00 00             	addb   $0x0,(%rax)
+  80685d:	00 00                	add    %al,(%rax)
+  80685f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806862:	80 00 00             	addb   $0x0,(%rax)
+  806865:	00 00                	add    %al,(%rax)
+  806867:	00 46 12             	add    %al,0x12(%rsi)
+  80686a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806880 <basefix.0>:
+  806880:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806890:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  8068a0:	10 00 25 2d 36 73 20 25 2d 38 73 20 25 2d 38 73     ..%-6s %-8s %-8s
+  8068b0:	0a 00 72 31 34 00 25 2d 36 73 20 25 30 38 6c 78     ..r14.%-6s %08lx
+  8068c0:	20 25 30 38 6c 78 20 00 4f 4b 0a 00 4d 49 53 4d      %08lx .OK..MISM
+  8068d0:	41 54 43 48 0a 00 72 31 33 00 72 31 32 00 72 31     ATCH..r13.r12.r1
+  8068e0:	31 00 72 31 30 00 72 73 69 00 72 64 69 00 72 62     1.r10.rsi.rdi.rb
+  8068f0:	70 00 72 62 78 00 72 64 78 00 72 63 78 00 72 61     p.rbx.rdx.rcx.ra
+  806900:	78 00 72 69 70 00 72 66 6c 61 67 73 00 72 73 70     x.rip.rflags.rsp
+  806910:	00 52 65 67 69 73 74 65 72 73 20 25 73 20 00 75     .Registers %s .u
+  806920:	73 65 72 2f 66 61 75 6c 74 72 65 67 73 2e 63 00     ser/faultregs.c.
+  806930:	69 6e 20 55 54 72 61 70 66 72 61 6d 65 00 64 75     in UTrapframe.du
+  806940:	72 69 6e 67 00 62 65 66 6f 72 65 00 73 79 73 5f     ring.before.sys_
+  806950:	70 61 67 65 5f 61 6c 6c 6f 63 3a 20 25 69 00 61     page_alloc: %i.a
+  806960:	66 74 65 72 20 70 61 67 65 2d 66 61 75 6c 74 00     fter page-fault.
+  806970:	61 66 74 65 72 00 66 90 70 67 66 61 75 6c 74 20     after.f.pgfault 
+  806980:	65 78 70 65 63 74 65 64 20 61 74 20 55 54 45 4d     expected at UTEM
+  806990:	50 2c 20 67 6f 74 20 30 78 25 30 38 6c 78 20 28     P, got 0x%08lx (
+  8069a0:	72 69 70 20 25 30 38 6c 78 29 00 00 00 00 00 00     rip %08lx)......
+  8069b0:	52 49 50 20 61 66 74 65 72 20 70 61 67 65 2d 66     RIP after page-f
+  8069c0:	61 75 6c 74 20 4d 49 53 4d 41 54 43 48 0a 00 3c     ault MISMATCH..<
+  8069d0:	75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 80 00 00 00 00     unknown>........
+  8069e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8069f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806a00:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806a10:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806a20:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806a30:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806a40:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806a50:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806a60:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806a70:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806a80:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806a90:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806aa0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806ab0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806ac0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806ad0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806ae0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806af0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806b00:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806b10:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806b20:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806b30:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806b40:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806b50:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806b60:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806b70:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806b80:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806b90:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  806ba0:	cd 25 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     .%......$,......
+  806bb0:	14 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     .,......$,......
+  806bc0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806bd0:	24 2c 80 00 00 00 00 00 ec 25 80 00 00 00 00 00     $,.......%......
+  806be0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806bf0:	e0 25 80 00 00 00 00 00 5a 26 80 00 00 00 00 00     .%......Z&......
+  806c00:	24 2c 80 00 00 00 00 00 e0 25 80 00 00 00 00 00     $,.......%......
+  806c10:	26 26 80 00 00 00 00 00 26 26 80 00 00 00 00 00     &&......&&......
+  806c20:	26 26 80 00 00 00 00 00 26 26 80 00 00 00 00 00     &&......&&......
+  806c30:	26 26 80 00 00 00 00 00 26 26 80 00 00 00 00 00     &&......&&......
+  806c40:	26 26 80 00 00 00 00 00 26 26 80 00 00 00 00 00     &&......&&......
+  806c50:	26 26 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     &&......$,......
+  806c60:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806c70:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806c80:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806c90:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806ca0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806cb0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806cc0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806cd0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806ce0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806cf0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d00:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d10:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d20:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d30:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d40:	24 2c 80 00 00 00 00 00 42 2b 80 00 00 00 00 00     $,......B+......
+  806d50:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d60:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d70:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d80:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806d90:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806da0:	88 26 80 00 00 00 00 00 57 28 80 00 00 00 00 00     .&......W(......
+  806db0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806dc0:	24 2c 80 00 00 00 00 00 7d 26 80 00 00 00 00 00     $,......}&......
+  806dd0:	b7 26 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     .&......$,......
+  806de0:	24 2c 80 00 00 00 00 00 72 26 80 00 00 00 00 00     $,......r&......
+  806df0:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806e00:	00 2a 80 00 00 00 00 00 cf 2a 80 00 00 00 00 00     .*.......*......
+  806e10:	24 2c 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     $,......$,......
+  806e20:	4e 27 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     N'......$,......
+  806e30:	2b 29 80 00 00 00 00 00 24 2c 80 00 00 00 00 00     +)......$,......
+  806e40:	24 2c 80 00 00 00 00 00 42 2b 80 00 00 00 00 00     $,......B+......
+  806e50:	24 2c 80 00 00 00 00 00 d6 25 80 00 00 00 00 00     $,.......%......
+
+0000000000806e60 <error_string>:
+	...
+  806e68:	35 6a 80 00 00 00 00 00 47 6a 80 00 00 00 00 00     5j......Gj......
+  806e78:	57 6a 80 00 00 00 00 00 69 6a 80 00 00 00 00 00     Wj......ij......
+  806e88:	77 6a 80 00 00 00 00 00 8b 6a 80 00 00 00 00 00     wj.......j......
+  806e98:	a0 6a 80 00 00 00 00 00 b3 6a 80 00 00 00 00 00     .j.......j......
+  806ea8:	c5 6a 80 00 00 00 00 00 d9 6a 80 00 00 00 00 00     .j.......j......
+  806eb8:	e9 6a 80 00 00 00 00 00 fc 6a 80 00 00 00 00 00     .j.......j......
+  806ec8:	13 6b 80 00 00 00 00 00 29 6b 80 00 00 00 00 00     .k......)k......
+  806ed8:	41 6b 80 00 00 00 00 00 59 6b 80 00 00 00 00 00     Ak......Yk......
+  806ee8:	66 6b 80 00 00 00 00 00 00 6f 80 00 00 00 00 00     fk.......o......
+  806ef8:	7a 6b 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     zk......file is 
+  806f08:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806f18:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806f28:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806f38:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806f48:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806f58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806f68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806f78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806f88:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806f98:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806fa8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806fb8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806fc8:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  806fd8:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  806fe8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806ff8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  807008:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  807018:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  807028:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  807038:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  807048:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  807058:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000807060 <devtab>:
+  807060:	40 80 80 00 00 00 00 00 80 80 80 00 00 00 00 00     @...............
+  807070:	c0 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  807080:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  807090:	6f 72 64 73 29 00 6c 69 62 2f 66 69 6c 65 2e 63     ords).lib/file.c
+  8070a0:	00 66 64 00 62 75 66 00 72 65 73 20 3c 3d 20 6e     .fd.buf.res <= n
+  8070b0:	00 0f 1f 80 00 00 00 00 72 65 73 20 3c 3d 20 73     ........res <= s
+  8070c0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8070d0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8070e0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8070f0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  807100:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  807110:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  807120:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  807130:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  807140:	00 69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69     .ipc_send: %i.li
+  807150:	62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00     b/ipc.c.f.......
+  807160:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807170:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807180:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807190:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8071a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8071b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8071c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8071d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8071e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8071f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8072a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8072b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8072c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8072d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8072e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8072f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8073a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8073b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8073c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8073d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8073e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8073f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8074a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8074b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8074c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8074d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8074e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8074f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8075a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8075b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8075c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8075d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8075e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8075f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8076a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8076b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8076c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8076d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8076e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8076f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8077a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8077b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8077c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8077d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8077e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8077f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8078a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8078b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8078c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8078d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8078e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8078f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8079a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8079b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8079c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8079d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8079e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8079f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
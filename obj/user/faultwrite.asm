@@ -0,0 +1,10314 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 5f 22 80 00 00 	movabs $0x80225f,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 7f 1f 80 00 00 	movabs $0x801f7f,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 e0 20 80 00 00 	movabs $0x8020e0,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 20 32 80 00 00 	movabs $0x803220,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 7f 1f 80 00 00 	movabs $0x801f7f,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 20 32 80 00 00 	movabs $0x803220,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 b6 15 80 00 00 	movabs $0x8015b6,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 70 5c 80 00 00 	movabs $0x805c70,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 7f 20 80 00 00 	movabs $0x80207f,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 89 39 80 00 00 	movabs $0x803989,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be b0 56 80 00 00 	movabs $0x8056b0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 7f 20 80 00 00 	movabs $0x80207f,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 89 39 80 00 00 	movabs $0x803989,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be b2 56 80 00 00 	movabs $0x8056b2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 7f 20 80 00 00 	movabs $0x80207f,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 89 39 80 00 00 	movabs $0x803989,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be b5 56 80 00 00 	movabs $0x8056b5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 7f 20 80 00 00 	movabs $0x80207f,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 89 39 80 00 00 	movabs $0x803989,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 f4 49 80 00 00 	movabs $0x8049f4,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 cb 4c 80 00 00 	movabs $0x804ccb,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 73 2f 80 00 00 	movabs $0x802f73,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 d3 33 80 00 00 	movabs $0x8033d3,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 d9 32 80 00 00 	movabs $0x8032d9,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 d9 32 80 00 00 	movabs $0x8032d9,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 f1 30 80 00 00 	movabs $0x8030f1,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 20 32 80 00 00 	movabs $0x803220,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 89 39 80 00 00 	movabs $0x803989,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 73 2f 80 00 00 	movabs $0x802f73,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 7f 1f 80 00 00 	movabs $0x801f7f,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 2c 22 80 00 00 	movabs $0x80222c,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 2c 22 80 00 00 	movabs $0x80222c,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 5f 22 80 00 00 	movabs $0x80225f,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 2c 22 80 00 00 	movabs $0x80222c,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 59 80 00 00 	movabs $0x805960,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 2c 22 80 00 00 	movabs $0x80222c,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 2c 22 80 00 00 	movabs $0x80222c,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 84 24 80 00 00 	movabs $0x802484,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 84 24 80 00 00 	movabs $0x802484,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 0e 00 00 00       	call   80150d <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+#ifndef __clang_analyzer__
+    *(volatile unsigned *)0 = 0;
+  801501:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  801508:	00 00 00 00 
+#endif
+}
+  80150c:	c3                   	ret
+
+000000000080150d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80150d:	55                   	push   %rbp
+  80150e:	48 89 e5             	mov    %rsp,%rbp
+  801511:	41 56                	push   %r14
+  801513:	41 55                	push   %r13
+  801515:	41 54                	push   %r12
+  801517:	53                   	push   %rbx
+  801518:	41 89 fd             	mov    %edi,%r13d
+  80151b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80151e:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801525:	00 00 00 
+  801528:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80152f:	00 00 00 
+  801532:	48 39 c2             	cmp    %rax,%rdx
+  801535:	73 17                	jae    80154e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801537:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80153a:	49 89 c4             	mov    %rax,%r12
+  80153d:	48 83 c3 08          	add    $0x8,%rbx
+  801541:	b8 00 00 00 00       	mov    $0x0,%eax
+  801546:	ff 53 f8             	call   *-0x8(%rbx)
+  801549:	4c 39 e3             	cmp    %r12,%rbx
+  80154c:	72 ef                	jb     80153d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80154e:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  801555:	00 00 00 
+  801558:	ff d0                	call   *%rax
+  80155a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80155f:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801566:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80156d:	00 00 00 
+  801570:	48 01 d0             	add    %rdx,%rax
+  801573:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80157a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80157d:	45 85 ed             	test   %r13d,%r13d
+  801580:	7e 0d                	jle    80158f <libmain+0x82>
+  801582:	49 8b 06             	mov    (%r14),%rax
+  801585:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80158c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80158f:	4c 89 f6             	mov    %r14,%rsi
+  801592:	44 89 ef             	mov    %r13d,%edi
+  801595:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80159c:	00 00 00 
+  80159f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015a1:	48 b8 b6 15 80 00 00 	movabs $0x8015b6,%rax
+  8015a8:	00 00 00 
+  8015ab:	ff d0                	call   *%rax
+#endif
+}
+  8015ad:	5b                   	pop    %rbx
+  8015ae:	41 5c                	pop    %r12
+  8015b0:	41 5d                	pop    %r13
+  8015b2:	41 5e                	pop    %r14
+  8015b4:	5d                   	pop    %rbp
+  8015b5:	c3                   	ret
+
+00000000008015b6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015b6:	55                   	push   %rbp
+  8015b7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015ba:	48 b8 a6 2f 80 00 00 	movabs $0x802fa6,%rax
+  8015c1:	00 00 00 
+  8015c4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015cb:	48 b8 d9 25 80 00 00 	movabs $0x8025d9,%rax
+  8015d2:	00 00 00 
+  8015d5:	ff d0                	call   *%rax
+}
+  8015d7:	5d                   	pop    %rbp
+  8015d8:	c3                   	ret
+
+00000000008015d9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015d9:	55                   	push   %rbp
+  8015da:	48 89 e5             	mov    %rsp,%rbp
+  8015dd:	53                   	push   %rbx
+  8015de:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015e5:	8b 06                	mov    (%rsi),%eax
+  8015e7:	8d 50 01             	lea    0x1(%rax),%edx
+  8015ea:	89 16                	mov    %edx,(%rsi)
+  8015ec:	48 98                	cltq
+  8015ee:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8015f3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8015f9:	74 0a                	je     801605 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8015fb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8015ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801603:	c9                   	leave
+  801604:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801605:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801609:	be ff 00 00 00       	mov    $0xff,%esi
+  80160e:	48 b8 3a 25 80 00 00 	movabs $0x80253a,%rax
+  801615:	00 00 00 
+  801618:	ff d0                	call   *%rax
+        state->offset = 0;
+  80161a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801620:	eb d9                	jmp    8015fb <putch+0x22>
+
+0000000000801622 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801622:	55                   	push   %rbp
+  801623:	48 89 e5             	mov    %rsp,%rbp
+  801626:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80162d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801630:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801637:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801644:	48 89 f1             	mov    %rsi,%rcx
+  801647:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80164e:	48 bf d9 15 80 00 00 	movabs $0x8015d9,%rdi
+  801655:	00 00 00 
+  801658:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  80165f:	00 00 00 
+  801662:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801664:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80166b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801672:	48 b8 3a 25 80 00 00 	movabs $0x80253a,%rax
+  801679:	00 00 00 
+  80167c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80167e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801684:	c9                   	leave
+  801685:	c3                   	ret
+
+0000000000801686 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801686:	55                   	push   %rbp
+  801687:	48 89 e5             	mov    %rsp,%rbp
+  80168a:	48 83 ec 50          	sub    $0x50,%rsp
+  80168e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801692:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801696:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80169a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80169e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016a2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016b1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016b9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016bd:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  8016c4:	00 00 00 
+  8016c7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016c9:	c9                   	leave
+  8016ca:	c3                   	ret
+
+00000000008016cb <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016cb:	55                   	push   %rbp
+  8016cc:	48 89 e5             	mov    %rsp,%rbp
+  8016cf:	41 57                	push   %r15
+  8016d1:	41 56                	push   %r14
+  8016d3:	41 55                	push   %r13
+  8016d5:	41 54                	push   %r12
+  8016d7:	53                   	push   %rbx
+  8016d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8016dc:	49 89 fc             	mov    %rdi,%r12
+  8016df:	49 89 f5             	mov    %rsi,%r13
+  8016e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016e6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8016e9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8016ec:	41 89 cf             	mov    %ecx,%r15d
+  8016ef:	4c 39 fa             	cmp    %r15,%rdx
+  8016f2:	73 5b                	jae    80174f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8016f4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8016f8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8016fc:	85 db                	test   %ebx,%ebx
+  8016fe:	7e 0e                	jle    80170e <print_num+0x43>
+            putch(padc, put_arg);
+  801700:	4c 89 ee             	mov    %r13,%rsi
+  801703:	44 89 f7             	mov    %r14d,%edi
+  801706:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801709:	83 eb 01             	sub    $0x1,%ebx
+  80170c:	75 f2                	jne    801700 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80170e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801712:	48 b9 1d 5c 80 00 00 	movabs $0x805c1d,%rcx
+  801719:	00 00 00 
+  80171c:	48 b8 0c 5c 80 00 00 	movabs $0x805c0c,%rax
+  801723:	00 00 00 
+  801726:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80172a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80172e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801733:	49 f7 f7             	div    %r15
+  801736:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80173a:	4c 89 ee             	mov    %r13,%rsi
+  80173d:	41 ff d4             	call   *%r12
+}
+  801740:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801744:	5b                   	pop    %rbx
+  801745:	41 5c                	pop    %r12
+  801747:	41 5d                	pop    %r13
+  801749:	41 5e                	pop    %r14
+  80174b:	41 5f                	pop    %r15
+  80174d:	5d                   	pop    %rbp
+  80174e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80174f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801753:	ba 00 00 00 00       	mov    $0x0,%edx
+  801758:	49 f7 f7             	div    %r15
+  80175b:	48 83 ec 08          	sub    $0x8,%rsp
+  80175f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801763:	52                   	push   %rdx
+  801764:	45 0f be c9          	movsbl %r9b,%r9d
+  801768:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80176c:	48 89 c2             	mov    %rax,%rdx
+  80176f:	48 b8 cb 16 80 00 00 	movabs $0x8016cb,%rax
+  801776:	00 00 00 
+  801779:	ff d0                	call   *%rax
+  80177b:	48 83 c4 10          	add    $0x10,%rsp
+  80177f:	eb 8d                	jmp    80170e <print_num+0x43>
+
+0000000000801781 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801781:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801785:	48 8b 06             	mov    (%rsi),%rax
+  801788:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80178c:	73 0a                	jae    801798 <sprintputch+0x17>
+        *state->start++ = ch;
+  80178e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801792:	48 89 16             	mov    %rdx,(%rsi)
+  801795:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801798:	c3                   	ret
+
+0000000000801799 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801799:	55                   	push   %rbp
+  80179a:	48 89 e5             	mov    %rsp,%rbp
+  80179d:	48 83 ec 50          	sub    $0x50,%rsp
+  8017a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017ad:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017c4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017c8:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  8017cf:	00 00 00 
+  8017d2:	ff d0                	call   *%rax
+}
+  8017d4:	c9                   	leave
+  8017d5:	c3                   	ret
+
+00000000008017d6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017d6:	55                   	push   %rbp
+  8017d7:	48 89 e5             	mov    %rsp,%rbp
+  8017da:	41 57                	push   %r15
+  8017dc:	41 56                	push   %r14
+  8017de:	41 55                	push   %r13
+  8017e0:	41 54                	push   %r12
+  8017e2:	53                   	push   %rbx
+  8017e3:	48 83 ec 38          	sub    $0x38,%rsp
+  8017e7:	49 89 fe             	mov    %rdi,%r14
+  8017ea:	49 89 f5             	mov    %rsi,%r13
+  8017ed:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8017f0:	48 8b 01             	mov    (%rcx),%rax
+  8017f3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8017f7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8017fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017ff:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801803:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801807:	eb 0d                	jmp    801816 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801809:	40 0f b6 ff          	movzbl %dil,%edi
+  80180d:	4c 89 ee             	mov    %r13,%rsi
+  801810:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801813:	4c 89 e3             	mov    %r12,%rbx
+  801816:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80181a:	0f b6 3b             	movzbl (%rbx),%edi
+  80181d:	40 80 ff 25          	cmp    $0x25,%dil
+  801821:	74 14                	je     801837 <vprintfmt+0x61>
+            if (!ch) return;
+  801823:	40 84 ff             	test   %dil,%dil
+  801826:	75 e1                	jne    801809 <vprintfmt+0x33>
+}
+  801828:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80182c:	5b                   	pop    %rbx
+  80182d:	41 5c                	pop    %r12
+  80182f:	41 5d                	pop    %r13
+  801831:	41 5e                	pop    %r14
+  801833:	41 5f                	pop    %r15
+  801835:	5d                   	pop    %rbp
+  801836:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801837:	be 00 00 00 00       	mov    $0x0,%esi
+  80183c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801840:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801845:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80184b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801852:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801856:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80185b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801860:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801863:	83 e8 23             	sub    $0x23,%eax
+  801866:	3c 57                	cmp    $0x57,%al
+  801868:	0f 87 67 06 00 00    	ja     801ed5 <vprintfmt+0x6ff>
+  80186e:	0f b6 c0             	movzbl %al,%eax
+  801871:	48 b9 a0 5d 80 00 00 	movabs $0x805da0,%rcx
+  801878:	00 00 00 
+  80187b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80187e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801881:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801885:	eb cf                	jmp    801856 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801887:	49 89 dc             	mov    %rbx,%r12
+  80188a:	be 01 00 00 00       	mov    $0x1,%esi
+  80188f:	eb c5                	jmp    801856 <vprintfmt+0x80>
+            padc = ch;
+  801891:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801895:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801898:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80189b:	eb b9                	jmp    801856 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80189d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8018a3:	77 24                	ja     8018c9 <vprintfmt+0xf3>
+  8018a5:	89 c1                	mov    %eax,%ecx
+  8018a7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018ab:	83 c0 08             	add    $0x8,%eax
+  8018ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018b1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018b4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018b7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018bb:	79 99                	jns    801856 <vprintfmt+0x80>
+                width = precision;
+  8018bd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018c1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018c7:	eb 8d                	jmp    801856 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018c9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018cd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018d5:	eb da                	jmp    8018b1 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018d7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018dc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018e0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018e6:	3c 39                	cmp    $0x39,%al
+  8018e8:	77 1c                	ja     801906 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8018ea:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8018ee:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8018f2:	0f b6 c0             	movzbl %al,%eax
+  8018f5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018fa:	0f b6 03             	movzbl (%rbx),%eax
+  8018fd:	3c 39                	cmp    $0x39,%al
+  8018ff:	76 e9                	jbe    8018ea <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801901:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801904:	eb b1                	jmp    8018b7 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801906:	49 89 dc             	mov    %rbx,%r12
+  801909:	eb ac                	jmp    8018b7 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80190b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80190e:	85 c9                	test   %ecx,%ecx
+  801910:	b8 00 00 00 00       	mov    $0x0,%eax
+  801915:	0f 49 c1             	cmovns %ecx,%eax
+  801918:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80191b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80191e:	e9 33 ff ff ff       	jmp    801856 <vprintfmt+0x80>
+            lflag++;
+  801923:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801926:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801929:	e9 28 ff ff ff       	jmp    801856 <vprintfmt+0x80>
+            lflag--;
+  80192e:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801931:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801934:	e9 1d ff ff ff       	jmp    801856 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801939:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80193c:	83 f8 2f             	cmp    $0x2f,%eax
+  80193f:	77 19                	ja     80195a <vprintfmt+0x184>
+  801941:	89 c2                	mov    %eax,%edx
+  801943:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801947:	83 c0 08             	add    $0x8,%eax
+  80194a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80194d:	8b 3a                	mov    (%rdx),%edi
+  80194f:	4c 89 ee             	mov    %r13,%rsi
+  801952:	41 ff d6             	call   *%r14
+            break;
+  801955:	e9 bc fe ff ff       	jmp    801816 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80195a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80195e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801966:	eb e5                	jmp    80194d <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801968:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80196b:	83 f8 2f             	cmp    $0x2f,%eax
+  80196e:	77 5a                	ja     8019ca <vprintfmt+0x1f4>
+  801970:	89 c2                	mov    %eax,%edx
+  801972:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801976:	83 c0 08             	add    $0x8,%eax
+  801979:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80197c:	8b 02                	mov    (%rdx),%eax
+  80197e:	89 c1                	mov    %eax,%ecx
+  801980:	f7 d9                	neg    %ecx
+  801982:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801985:	83 f9 13             	cmp    $0x13,%ecx
+  801988:	7f 4e                	jg     8019d8 <vprintfmt+0x202>
+  80198a:	48 63 c1             	movslq %ecx,%rax
+  80198d:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  801994:	00 00 00 
+  801997:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80199b:	48 85 c0             	test   %rax,%rax
+  80199e:	74 38                	je     8019d8 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019a0:	48 89 c1             	mov    %rax,%rcx
+  8019a3:	48 ba 28 62 80 00 00 	movabs $0x806228,%rdx
+  8019aa:	00 00 00 
+  8019ad:	4c 89 ee             	mov    %r13,%rsi
+  8019b0:	4c 89 f7             	mov    %r14,%rdi
+  8019b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b8:	49 b8 99 17 80 00 00 	movabs $0x801799,%r8
+  8019bf:	00 00 00 
+  8019c2:	41 ff d0             	call   *%r8
+  8019c5:	e9 4c fe ff ff       	jmp    801816 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019d6:	eb a4                	jmp    80197c <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019d8:	48 ba 35 5c 80 00 00 	movabs $0x805c35,%rdx
+  8019df:	00 00 00 
+  8019e2:	4c 89 ee             	mov    %r13,%rsi
+  8019e5:	4c 89 f7             	mov    %r14,%rdi
+  8019e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ed:	49 b8 99 17 80 00 00 	movabs $0x801799,%r8
+  8019f4:	00 00 00 
+  8019f7:	41 ff d0             	call   *%r8
+  8019fa:	e9 17 fe ff ff       	jmp    801816 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8019ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a02:	83 f8 2f             	cmp    $0x2f,%eax
+  801a05:	77 6c                	ja     801a73 <vprintfmt+0x29d>
+  801a07:	89 c2                	mov    %eax,%edx
+  801a09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a0d:	83 c0 08             	add    $0x8,%eax
+  801a10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a13:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a16:	48 85 f6             	test   %rsi,%rsi
+  801a19:	48 b8 2e 5c 80 00 00 	movabs $0x805c2e,%rax
+  801a20:	00 00 00 
+  801a23:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a27:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a2b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a2f:	7e 06                	jle    801a37 <vprintfmt+0x261>
+  801a31:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a35:	75 4a                	jne    801a81 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a37:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a3b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a3f:	0f b6 00             	movzbl (%rax),%eax
+  801a42:	84 c0                	test   %al,%al
+  801a44:	0f 85 9a 00 00 00    	jne    801ae4 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a4a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a4d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	0f 8e bd fd ff ff    	jle    801816 <vprintfmt+0x40>
+  801a59:	4c 89 ee             	mov    %r13,%rsi
+  801a5c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a61:	41 ff d6             	call   *%r14
+  801a64:	41 83 ec 01          	sub    $0x1,%r12d
+  801a68:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a6c:	75 eb                	jne    801a59 <vprintfmt+0x283>
+  801a6e:	e9 a3 fd ff ff       	jmp    801816 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a7f:	eb 92                	jmp    801a13 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a81:	49 63 f7             	movslq %r15d,%rsi
+  801a84:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801a88:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+  801a94:	48 89 c2             	mov    %rax,%rdx
+  801a97:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a9a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801a9c:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801a9f:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	7e 91                	jle    801a37 <vprintfmt+0x261>
+  801aa6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801aab:	4c 89 ee             	mov    %r13,%rsi
+  801aae:	44 89 e7             	mov    %r12d,%edi
+  801ab1:	41 ff d6             	call   *%r14
+  801ab4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ab8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801abb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801abe:	75 eb                	jne    801aab <vprintfmt+0x2d5>
+  801ac0:	e9 72 ff ff ff       	jmp    801a37 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ac5:	0f b6 f8             	movzbl %al,%edi
+  801ac8:	4c 89 ee             	mov    %r13,%rsi
+  801acb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ace:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad2:	49 83 c4 01          	add    $0x1,%r12
+  801ad6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801adc:	84 c0                	test   %al,%al
+  801ade:	0f 84 66 ff ff ff    	je     801a4a <vprintfmt+0x274>
+  801ae4:	45 85 ff             	test   %r15d,%r15d
+  801ae7:	78 0a                	js     801af3 <vprintfmt+0x31d>
+  801ae9:	41 83 ef 01          	sub    $0x1,%r15d
+  801aed:	0f 88 57 ff ff ff    	js     801a4a <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801af3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801af7:	74 cc                	je     801ac5 <vprintfmt+0x2ef>
+  801af9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801afc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b01:	80 fa 5e             	cmp    $0x5e,%dl
+  801b04:	77 c2                	ja     801ac8 <vprintfmt+0x2f2>
+  801b06:	eb bd                	jmp    801ac5 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b08:	40 84 f6             	test   %sil,%sil
+  801b0b:	75 26                	jne    801b33 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b0d:	85 d2                	test   %edx,%edx
+  801b0f:	74 59                	je     801b6a <vprintfmt+0x394>
+  801b11:	83 fa 01             	cmp    $0x1,%edx
+  801b14:	74 7b                	je     801b91 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b19:	83 f8 2f             	cmp    $0x2f,%eax
+  801b1c:	0f 87 96 00 00 00    	ja     801bb8 <vprintfmt+0x3e2>
+  801b22:	89 c2                	mov    %eax,%edx
+  801b24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b28:	83 c0 08             	add    $0x8,%eax
+  801b2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b2e:	4c 8b 22             	mov    (%rdx),%r12
+  801b31:	eb 17                	jmp    801b4a <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b36:	83 f8 2f             	cmp    $0x2f,%eax
+  801b39:	77 21                	ja     801b5c <vprintfmt+0x386>
+  801b3b:	89 c2                	mov    %eax,%edx
+  801b3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b41:	83 c0 08             	add    $0x8,%eax
+  801b44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b47:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b4a:	4d 85 e4             	test   %r12,%r12
+  801b4d:	78 7a                	js     801bc9 <vprintfmt+0x3f3>
+            num = i;
+  801b4f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b52:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b57:	e9 56 02 00 00       	jmp    801db2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b68:	eb dd                	jmp    801b47 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b6d:	83 f8 2f             	cmp    $0x2f,%eax
+  801b70:	77 11                	ja     801b83 <vprintfmt+0x3ad>
+  801b72:	89 c2                	mov    %eax,%edx
+  801b74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b78:	83 c0 08             	add    $0x8,%eax
+  801b7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b7e:	4c 63 22             	movslq (%rdx),%r12
+  801b81:	eb c7                	jmp    801b4a <vprintfmt+0x374>
+  801b83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b8f:	eb ed                	jmp    801b7e <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801b91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b94:	83 f8 2f             	cmp    $0x2f,%eax
+  801b97:	77 11                	ja     801baa <vprintfmt+0x3d4>
+  801b99:	89 c2                	mov    %eax,%edx
+  801b9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b9f:	83 c0 08             	add    $0x8,%eax
+  801ba2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ba5:	4c 8b 22             	mov    (%rdx),%r12
+  801ba8:	eb a0                	jmp    801b4a <vprintfmt+0x374>
+  801baa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bb6:	eb ed                	jmp    801ba5 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bc4:	e9 65 ff ff ff       	jmp    801b2e <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bc9:	4c 89 ee             	mov    %r13,%rsi
+  801bcc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bd1:	41 ff d6             	call   *%r14
+                i = -i;
+  801bd4:	49 f7 dc             	neg    %r12
+  801bd7:	e9 73 ff ff ff       	jmp    801b4f <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bdc:	40 84 f6             	test   %sil,%sil
+  801bdf:	75 2e                	jne    801c0f <vprintfmt+0x439>
+    switch (lflag) {
+  801be1:	85 d2                	test   %edx,%edx
+  801be3:	7f 59                	jg     801c3e <vprintfmt+0x468>
+  801be5:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801be8:	7d 7a                	jge    801c64 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801bea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bed:	83 f8 2f             	cmp    $0x2f,%eax
+  801bf0:	0f 87 aa 00 00 00    	ja     801ca0 <vprintfmt+0x4ca>
+  801bf6:	89 c2                	mov    %eax,%edx
+  801bf8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bfc:	83 c0 08             	add    $0x8,%eax
+  801bff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c02:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c05:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c0a:	e9 a3 01 00 00       	jmp    801db2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c12:	83 f8 2f             	cmp    $0x2f,%eax
+  801c15:	77 19                	ja     801c30 <vprintfmt+0x45a>
+  801c17:	89 c2                	mov    %eax,%edx
+  801c19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c1d:	83 c0 08             	add    $0x8,%eax
+  801c20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c23:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c2b:	e9 82 01 00 00       	jmp    801db2 <vprintfmt+0x5dc>
+  801c30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c3c:	eb e5                	jmp    801c23 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c3e:	83 fa 01             	cmp    $0x1,%edx
+  801c41:	75 a7                	jne    801bea <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c46:	83 f8 2f             	cmp    $0x2f,%eax
+  801c49:	77 47                	ja     801c92 <vprintfmt+0x4bc>
+  801c4b:	89 c2                	mov    %eax,%edx
+  801c4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c51:	83 c0 08             	add    $0x8,%eax
+  801c54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c57:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c5a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c5f:	e9 4e 01 00 00       	jmp    801db2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c67:	83 f8 2f             	cmp    $0x2f,%eax
+  801c6a:	77 18                	ja     801c84 <vprintfmt+0x4ae>
+  801c6c:	89 c2                	mov    %eax,%edx
+  801c6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c72:	83 c0 08             	add    $0x8,%eax
+  801c75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c78:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c7a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c7f:	e9 2e 01 00 00       	jmp    801db2 <vprintfmt+0x5dc>
+  801c84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c90:	eb e6                	jmp    801c78 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801c92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c9e:	eb b7                	jmp    801c57 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ca0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cac:	e9 51 ff ff ff       	jmp    801c02 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cb1:	40 84 f6             	test   %sil,%sil
+  801cb4:	75 2e                	jne    801ce4 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cb6:	85 d2                	test   %edx,%edx
+  801cb8:	7f 59                	jg     801d13 <vprintfmt+0x53d>
+  801cba:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cbd:	7d 77                	jge    801d36 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cbf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cc2:	83 f8 2f             	cmp    $0x2f,%eax
+  801cc5:	0f 87 a4 00 00 00    	ja     801d6f <vprintfmt+0x599>
+  801ccb:	89 c2                	mov    %eax,%edx
+  801ccd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cd1:	83 c0 08             	add    $0x8,%eax
+  801cd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cd7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cda:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cdf:	e9 ce 00 00 00       	jmp    801db2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ce4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ce7:	83 f8 2f             	cmp    $0x2f,%eax
+  801cea:	77 19                	ja     801d05 <vprintfmt+0x52f>
+  801cec:	89 c2                	mov    %eax,%edx
+  801cee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf2:	83 c0 08             	add    $0x8,%eax
+  801cf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cfb:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d00:	e9 ad 00 00 00       	jmp    801db2 <vprintfmt+0x5dc>
+  801d05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d11:	eb e5                	jmp    801cf8 <vprintfmt+0x522>
+    switch (lflag) {
+  801d13:	83 fa 01             	cmp    $0x1,%edx
+  801d16:	75 a7                	jne    801cbf <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d1b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d1e:	77 41                	ja     801d61 <vprintfmt+0x58b>
+  801d20:	89 c2                	mov    %eax,%edx
+  801d22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d26:	83 c0 08             	add    $0x8,%eax
+  801d29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d2f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d34:	eb 7c                	jmp    801db2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d39:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3c:	77 15                	ja     801d53 <vprintfmt+0x57d>
+  801d3e:	89 c2                	mov    %eax,%edx
+  801d40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d44:	83 c0 08             	add    $0x8,%eax
+  801d47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d4a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d4c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d51:	eb 5f                	jmp    801db2 <vprintfmt+0x5dc>
+  801d53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d5f:	eb e9                	jmp    801d4a <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d6d:	eb bd                	jmp    801d2c <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7b:	e9 57 ff ff ff       	jmp    801cd7 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d80:	4c 89 ee             	mov    %r13,%rsi
+  801d83:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d88:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801d8b:	4c 89 ee             	mov    %r13,%rsi
+  801d8e:	bf 78 00 00 00       	mov    $0x78,%edi
+  801d93:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801d96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d99:	83 f8 2f             	cmp    $0x2f,%eax
+  801d9c:	77 47                	ja     801de5 <vprintfmt+0x60f>
+  801d9e:	89 c2                	mov    %eax,%edx
+  801da0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801da4:	83 c0 08             	add    $0x8,%eax
+  801da7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801daa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dad:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801db2:	48 83 ec 08          	sub    $0x8,%rsp
+  801db6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dba:	0f 94 c0             	sete   %al
+  801dbd:	0f b6 c0             	movzbl %al,%eax
+  801dc0:	50                   	push   %rax
+  801dc1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801dc6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801dca:	4c 89 ee             	mov    %r13,%rsi
+  801dcd:	4c 89 f7             	mov    %r14,%rdi
+  801dd0:	48 b8 cb 16 80 00 00 	movabs $0x8016cb,%rax
+  801dd7:	00 00 00 
+  801dda:	ff d0                	call   *%rax
+            break;
+  801ddc:	48 83 c4 10          	add    $0x10,%rsp
+  801de0:	e9 31 fa ff ff       	jmp    801816 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801de5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801de9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ded:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801df1:	eb b7                	jmp    801daa <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801df3:	40 84 f6             	test   %sil,%sil
+  801df6:	75 2b                	jne    801e23 <vprintfmt+0x64d>
+    switch (lflag) {
+  801df8:	85 d2                	test   %edx,%edx
+  801dfa:	7f 56                	jg     801e52 <vprintfmt+0x67c>
+  801dfc:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801dff:	7d 77                	jge    801e78 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e04:	83 f8 2f             	cmp    $0x2f,%eax
+  801e07:	0f 87 a7 00 00 00    	ja     801eb4 <vprintfmt+0x6de>
+  801e0d:	89 c2                	mov    %eax,%edx
+  801e0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e13:	83 c0 08             	add    $0x8,%eax
+  801e16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e19:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e1c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e21:	eb 8f                	jmp    801db2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e26:	83 f8 2f             	cmp    $0x2f,%eax
+  801e29:	77 19                	ja     801e44 <vprintfmt+0x66e>
+  801e2b:	89 c2                	mov    %eax,%edx
+  801e2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e31:	83 c0 08             	add    $0x8,%eax
+  801e34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e37:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e3a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e3f:	e9 6e ff ff ff       	jmp    801db2 <vprintfmt+0x5dc>
+  801e44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e50:	eb e5                	jmp    801e37 <vprintfmt+0x661>
+    switch (lflag) {
+  801e52:	83 fa 01             	cmp    $0x1,%edx
+  801e55:	75 aa                	jne    801e01 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e5a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e5d:	77 47                	ja     801ea6 <vprintfmt+0x6d0>
+  801e5f:	89 c2                	mov    %eax,%edx
+  801e61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e65:	83 c0 08             	add    $0x8,%eax
+  801e68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e6b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e73:	e9 3a ff ff ff       	jmp    801db2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7e:	77 18                	ja     801e98 <vprintfmt+0x6c2>
+  801e80:	89 c2                	mov    %eax,%edx
+  801e82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e86:	83 c0 08             	add    $0x8,%eax
+  801e89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801e8e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801e93:	e9 1a ff ff ff       	jmp    801db2 <vprintfmt+0x5dc>
+  801e98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea4:	eb e6                	jmp    801e8c <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ea6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb2:	eb b7                	jmp    801e6b <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801eb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec0:	e9 54 ff ff ff       	jmp    801e19 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ec5:	4c 89 ee             	mov    %r13,%rsi
+  801ec8:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ecd:	41 ff d6             	call   *%r14
+            break;
+  801ed0:	e9 41 f9 ff ff       	jmp    801816 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ed5:	4c 89 ee             	mov    %r13,%rsi
+  801ed8:	bf 25 00 00 00       	mov    $0x25,%edi
+  801edd:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ee0:	48 83 eb 01          	sub    $0x1,%rbx
+  801ee4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801ee8:	75 f6                	jne    801ee0 <vprintfmt+0x70a>
+  801eea:	e9 27 f9 ff ff       	jmp    801816 <vprintfmt+0x40>
+
+0000000000801eef <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801eef:	55                   	push   %rbp
+  801ef0:	48 89 e5             	mov    %rsp,%rbp
+  801ef3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801ef7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801efb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f00:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f04:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f0b:	48 85 ff             	test   %rdi,%rdi
+  801f0e:	74 2b                	je     801f3b <vsnprintf+0x4c>
+  801f10:	48 85 f6             	test   %rsi,%rsi
+  801f13:	74 26                	je     801f3b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f15:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f19:	48 bf 81 17 80 00 00 	movabs $0x801781,%rdi
+  801f20:	00 00 00 
+  801f23:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f33:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f36:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f39:	c9                   	leave
+  801f3a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f40:	eb f7                	jmp    801f39 <vsnprintf+0x4a>
+
+0000000000801f42 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f42:	55                   	push   %rbp
+  801f43:	48 89 e5             	mov    %rsp,%rbp
+  801f46:	48 83 ec 50          	sub    $0x50,%rsp
+  801f4a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f4e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f52:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f56:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f5d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f65:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f69:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f6d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f71:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  801f78:	00 00 00 
+  801f7b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+
+0000000000801f7f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f7f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f82:	74 10                	je     801f94 <strlen+0x15>
+    size_t n = 0;
+  801f84:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801f89:	48 83 c0 01          	add    $0x1,%rax
+  801f8d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801f91:	75 f6                	jne    801f89 <strlen+0xa>
+  801f93:	c3                   	ret
+    size_t n = 0;
+  801f94:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801f99:	c3                   	ret
+
+0000000000801f9a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801f9a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801f9d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fa2:	48 85 f6             	test   %rsi,%rsi
+  801fa5:	74 11                	je     801fb8 <strnlen+0x1e>
+  801fa7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fab:	74 0c                	je     801fb9 <strnlen+0x1f>
+  801fad:	48 83 c2 01          	add    $0x1,%rdx
+  801fb1:	48 39 d0             	cmp    %rdx,%rax
+  801fb4:	75 f1                	jne    801fa7 <strnlen+0xd>
+  801fb6:	eb 04                	jmp    801fbc <strnlen+0x22>
+  801fb8:	c3                   	ret
+  801fb9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fbc:	c3                   	ret
+
+0000000000801fbd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fbd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fc9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fcc:	48 83 c2 01          	add    $0x1,%rdx
+  801fd0:	84 c9                	test   %cl,%cl
+  801fd2:	75 f1                	jne    801fc5 <strcpy+0x8>
+        ;
+    return res;
+}
+  801fd4:	c3                   	ret
+
+0000000000801fd5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fd5:	55                   	push   %rbp
+  801fd6:	48 89 e5             	mov    %rsp,%rbp
+  801fd9:	41 54                	push   %r12
+  801fdb:	53                   	push   %rbx
+  801fdc:	48 89 fb             	mov    %rdi,%rbx
+  801fdf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801fe2:	48 b8 7f 1f 80 00 00 	movabs $0x801f7f,%rax
+  801fe9:	00 00 00 
+  801fec:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801fee:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801ff2:	4c 89 e6             	mov    %r12,%rsi
+  801ff5:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+    return dst;
+}
+  802001:	48 89 d8             	mov    %rbx,%rax
+  802004:	5b                   	pop    %rbx
+  802005:	41 5c                	pop    %r12
+  802007:	5d                   	pop    %rbp
+  802008:	c3                   	ret
+
+0000000000802009 <toupper>:
+
+int
+toupper(int ch) {
+  802009:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80200b:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80200e:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802011:	83 f9 1a             	cmp    $0x1a,%ecx
+  802014:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802017:	c3                   	ret
+
+0000000000802018 <tolower>:
+
+int
+tolower(int ch) {
+  802018:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80201a:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80201d:	8d 57 20             	lea    0x20(%rdi),%edx
+  802020:	83 f9 1a             	cmp    $0x1a,%ecx
+  802023:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802026:	c3                   	ret
+
+0000000000802027 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802027:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80202a:	48 85 d2             	test   %rdx,%rdx
+  80202d:	74 1f                	je     80204e <strncpy+0x27>
+  80202f:	48 01 fa             	add    %rdi,%rdx
+  802032:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802035:	48 83 c1 01          	add    $0x1,%rcx
+  802039:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80203d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802041:	41 80 f8 01          	cmp    $0x1,%r8b
+  802045:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802049:	48 39 ca             	cmp    %rcx,%rdx
+  80204c:	75 e7                	jne    802035 <strncpy+0xe>
+    }
+    return ret;
+}
+  80204e:	c3                   	ret
+
+000000000080204f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80204f:	48 89 f8             	mov    %rdi,%rax
+  802052:	48 85 d2             	test   %rdx,%rdx
+  802055:	74 24                	je     80207b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802057:	48 83 ea 01          	sub    $0x1,%rdx
+  80205b:	74 1b                	je     802078 <strlcpy+0x29>
+  80205d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802061:	0f b6 16             	movzbl (%rsi),%edx
+  802064:	84 d2                	test   %dl,%dl
+  802066:	74 10                	je     802078 <strlcpy+0x29>
+            *dst++ = *src++;
+  802068:	48 83 c6 01          	add    $0x1,%rsi
+  80206c:	48 83 c0 01          	add    $0x1,%rax
+  802070:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802073:	48 39 c8             	cmp    %rcx,%rax
+  802076:	75 e9                	jne    802061 <strlcpy+0x12>
+        *dst = '\0';
+  802078:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80207b:	48 29 f8             	sub    %rdi,%rax
+}
+  80207e:	c3                   	ret
+
+000000000080207f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80207f:	0f b6 07             	movzbl (%rdi),%eax
+  802082:	84 c0                	test   %al,%al
+  802084:	74 13                	je     802099 <strcmp+0x1a>
+  802086:	38 06                	cmp    %al,(%rsi)
+  802088:	75 0f                	jne    802099 <strcmp+0x1a>
+  80208a:	48 83 c7 01          	add    $0x1,%rdi
+  80208e:	48 83 c6 01          	add    $0x1,%rsi
+  802092:	0f b6 07             	movzbl (%rdi),%eax
+  802095:	84 c0                	test   %al,%al
+  802097:	75 ed                	jne    802086 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802099:	0f b6 c0             	movzbl %al,%eax
+  80209c:	0f b6 16             	movzbl (%rsi),%edx
+  80209f:	29 d0                	sub    %edx,%eax
+}
+  8020a1:	c3                   	ret
+
+00000000008020a2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020a2:	48 85 d2             	test   %rdx,%rdx
+  8020a5:	74 1f                	je     8020c6 <strncmp+0x24>
+  8020a7:	0f b6 07             	movzbl (%rdi),%eax
+  8020aa:	84 c0                	test   %al,%al
+  8020ac:	74 1e                	je     8020cc <strncmp+0x2a>
+  8020ae:	3a 06                	cmp    (%rsi),%al
+  8020b0:	75 1a                	jne    8020cc <strncmp+0x2a>
+  8020b2:	48 83 c7 01          	add    $0x1,%rdi
+  8020b6:	48 83 c6 01          	add    $0x1,%rsi
+  8020ba:	48 83 ea 01          	sub    $0x1,%rdx
+  8020be:	75 e7                	jne    8020a7 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c5:	c3                   	ret
+  8020c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cb:	c3                   	ret
+  8020cc:	48 85 d2             	test   %rdx,%rdx
+  8020cf:	74 09                	je     8020da <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020d1:	0f b6 07             	movzbl (%rdi),%eax
+  8020d4:	0f b6 16             	movzbl (%rsi),%edx
+  8020d7:	29 d0                	sub    %edx,%eax
+  8020d9:	c3                   	ret
+    if (!n) return 0;
+  8020da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020df:	c3                   	ret
+
+00000000008020e0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020e0:	0f b6 17             	movzbl (%rdi),%edx
+  8020e3:	84 d2                	test   %dl,%dl
+  8020e5:	74 18                	je     8020ff <strchr+0x1f>
+        if (*str == c) {
+  8020e7:	0f be d2             	movsbl %dl,%edx
+  8020ea:	39 f2                	cmp    %esi,%edx
+  8020ec:	74 17                	je     802105 <strchr+0x25>
+    for (; *str; str++) {
+  8020ee:	48 83 c7 01          	add    $0x1,%rdi
+  8020f2:	0f b6 17             	movzbl (%rdi),%edx
+  8020f5:	84 d2                	test   %dl,%dl
+  8020f7:	75 ee                	jne    8020e7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fe:	c3                   	ret
+  8020ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802104:	c3                   	ret
+  802105:	48 89 f8             	mov    %rdi,%rax
+}
+  802108:	c3                   	ret
+
+0000000000802109 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802109:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80210c:	0f b6 17             	movzbl (%rdi),%edx
+  80210f:	84 d2                	test   %dl,%dl
+  802111:	74 13                	je     802126 <strfind+0x1d>
+  802113:	0f be d2             	movsbl %dl,%edx
+  802116:	39 f2                	cmp    %esi,%edx
+  802118:	74 0b                	je     802125 <strfind+0x1c>
+  80211a:	48 83 c0 01          	add    $0x1,%rax
+  80211e:	0f b6 10             	movzbl (%rax),%edx
+  802121:	84 d2                	test   %dl,%dl
+  802123:	75 ee                	jne    802113 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802125:	c3                   	ret
+  802126:	c3                   	ret
+
+0000000000802127 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802127:	48 39 f7             	cmp    %rsi,%rdi
+  80212a:	74 65                	je     802191 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80212c:	55                   	push   %rbp
+  80212d:	48 89 e5             	mov    %rsp,%rbp
+  802130:	41 57                	push   %r15
+  802132:	41 56                	push   %r14
+  802134:	41 55                	push   %r13
+  802136:	41 54                	push   %r12
+  802138:	53                   	push   %rbx
+  802139:	48 83 ec 18          	sub    $0x18,%rsp
+  80213d:	48 89 fb             	mov    %rdi,%rbx
+  802140:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802143:	49 bf 18 20 80 00 00 	movabs $0x802018,%r15
+  80214a:	00 00 00 
+  80214d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802151:	41 0f b6 fd          	movzbl %r13b,%edi
+  802155:	41 ff d7             	call   *%r15
+  802158:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80215b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802160:	41 0f b6 fe          	movzbl %r14b,%edi
+  802164:	41 ff d7             	call   *%r15
+  802167:	89 c2                	mov    %eax,%edx
+  802169:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80216c:	29 d0                	sub    %edx,%eax
+  80216e:	75 12                	jne    802182 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802170:	48 83 c3 01          	add    $0x1,%rbx
+  802174:	45 84 ed             	test   %r13b,%r13b
+  802177:	74 09                	je     802182 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802179:	49 83 c4 01          	add    $0x1,%r12
+  80217d:	45 84 f6             	test   %r14b,%r14b
+  802180:	75 cb                	jne    80214d <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802182:	48 83 c4 18          	add    $0x18,%rsp
+  802186:	5b                   	pop    %rbx
+  802187:	41 5c                	pop    %r12
+  802189:	41 5d                	pop    %r13
+  80218b:	41 5e                	pop    %r14
+  80218d:	41 5f                	pop    %r15
+  80218f:	5d                   	pop    %rbp
+  802190:	c3                   	ret
+    if (p1 == p2) return 0;
+  802191:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802196:	c3                   	ret
+
+0000000000802197 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802197:	48 39 f7             	cmp    %rsi,%rdi
+  80219a:	74 7d                	je     802219 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80219c:	55                   	push   %rbp
+  80219d:	48 89 e5             	mov    %rsp,%rbp
+  8021a0:	41 57                	push   %r15
+  8021a2:	41 56                	push   %r14
+  8021a4:	41 55                	push   %r13
+  8021a6:	41 54                	push   %r12
+  8021a8:	53                   	push   %rbx
+  8021a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ad:	48 89 fb             	mov    %rdi,%rbx
+  8021b0:	49 89 f4             	mov    %rsi,%r12
+  8021b3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021bb:	49 bf 18 20 80 00 00 	movabs $0x802018,%r15
+  8021c2:	00 00 00 
+    while (n--) {
+  8021c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021c9:	48 39 c3             	cmp    %rax,%rbx
+  8021cc:	74 37                	je     802205 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021ce:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021d2:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021d6:	41 ff d7             	call   *%r15
+  8021d9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021dc:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021e1:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021e5:	41 ff d7             	call   *%r15
+  8021e8:	89 c2                	mov    %eax,%edx
+  8021ea:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021ed:	29 d0                	sub    %edx,%eax
+  8021ef:	75 19                	jne    80220a <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8021f1:	48 83 c3 01          	add    $0x1,%rbx
+  8021f5:	45 84 ed             	test   %r13b,%r13b
+  8021f8:	74 10                	je     80220a <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8021fa:	49 83 c4 01          	add    $0x1,%r12
+  8021fe:	45 84 f6             	test   %r14b,%r14b
+  802201:	75 c2                	jne    8021c5 <strncasecmp+0x2e>
+  802203:	eb 05                	jmp    80220a <strncasecmp+0x73>
+  802205:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80220a:	48 83 c4 18          	add    $0x18,%rsp
+  80220e:	5b                   	pop    %rbx
+  80220f:	41 5c                	pop    %r12
+  802211:	41 5d                	pop    %r13
+  802213:	41 5e                	pop    %r14
+  802215:	41 5f                	pop    %r15
+  802217:	5d                   	pop    %rbp
+  802218:	c3                   	ret
+    if (p1 == p2) return 0;
+  802219:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221e:	c3                   	ret
+
+000000000080221f <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80221f:	83 e7 df             	and    $0xffffffdf,%edi
+  802222:	83 ef 41             	sub    $0x41,%edi
+  802225:	83 ff 19             	cmp    $0x19,%edi
+  802228:	0f 96 c0             	setbe  %al
+}
+  80222b:	c3                   	ret
+
+000000000080222c <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80222c:	83 ff 20             	cmp    $0x20,%edi
+  80222f:	0f 94 c0             	sete   %al
+  802232:	83 ff 09             	cmp    $0x9,%edi
+  802235:	0f 94 c2             	sete   %dl
+  802238:	09 d0                	or     %edx,%eax
+}
+  80223a:	c3                   	ret
+
+000000000080223b <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80223b:	55                   	push   %rbp
+  80223c:	48 89 e5             	mov    %rsp,%rbp
+  80223f:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802241:	48 bf 1f 61 80 00 00 	movabs $0x80611f,%rdi
+  802248:	00 00 00 
+  80224b:	48 b8 e0 20 80 00 00 	movabs $0x8020e0,%rax
+  802252:	00 00 00 
+  802255:	ff d0                	call   *%rax
+  802257:	48 85 c0             	test   %rax,%rax
+  80225a:	0f 95 c0             	setne  %al
+}
+  80225d:	5d                   	pop    %rbp
+  80225e:	c3                   	ret
+
+000000000080225f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80225f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802262:	48 89 f8             	mov    %rdi,%rax
+  802265:	48 f7 d8             	neg    %rax
+  802268:	83 e0 07             	and    $0x7,%eax
+  80226b:	49 89 d1             	mov    %rdx,%r9
+  80226e:	49 29 c1             	sub    %rax,%r9
+  802271:	78 36                	js     8022a9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802273:	40 0f b6 c6          	movzbl %sil,%eax
+  802277:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80227e:	01 01 01 
+  802281:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802285:	40 f6 c7 07          	test   $0x7,%dil
+  802289:	75 38                	jne    8022c3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80228b:	4c 89 c9             	mov    %r9,%rcx
+  80228e:	48 c1 f9 03          	sar    $0x3,%rcx
+  802292:	74 0c                	je     8022a0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802294:	fc                   	cld
+  802295:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802298:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80229c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022a0:	4d 85 c9             	test   %r9,%r9
+  8022a3:	75 45                	jne    8022ea <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022a5:	4c 89 c0             	mov    %r8,%rax
+  8022a8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022a9:	48 85 d2             	test   %rdx,%rdx
+  8022ac:	74 f7                	je     8022a5 <memset+0x46>
+  8022ae:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022b1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022b4:	48 83 c0 01          	add    $0x1,%rax
+  8022b8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022bc:	48 39 c2             	cmp    %rax,%rdx
+  8022bf:	75 f3                	jne    8022b4 <memset+0x55>
+  8022c1:	eb e2                	jmp    8022a5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022c3:	40 f6 c7 01          	test   $0x1,%dil
+  8022c7:	74 06                	je     8022cf <memset+0x70>
+  8022c9:	88 07                	mov    %al,(%rdi)
+  8022cb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022cf:	40 f6 c7 02          	test   $0x2,%dil
+  8022d3:	74 07                	je     8022dc <memset+0x7d>
+  8022d5:	66 89 07             	mov    %ax,(%rdi)
+  8022d8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022dc:	40 f6 c7 04          	test   $0x4,%dil
+  8022e0:	74 a9                	je     80228b <memset+0x2c>
+  8022e2:	89 07                	mov    %eax,(%rdi)
+  8022e4:	48 83 c7 04          	add    $0x4,%rdi
+  8022e8:	eb a1                	jmp    80228b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022ea:	41 f6 c1 04          	test   $0x4,%r9b
+  8022ee:	74 06                	je     8022f6 <memset+0x97>
+  8022f0:	89 07                	mov    %eax,(%rdi)
+  8022f2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022f6:	41 f6 c1 02          	test   $0x2,%r9b
+  8022fa:	74 07                	je     802303 <memset+0xa4>
+  8022fc:	66 89 07             	mov    %ax,(%rdi)
+  8022ff:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802303:	41 f6 c1 01          	test   $0x1,%r9b
+  802307:	74 9c                	je     8022a5 <memset+0x46>
+  802309:	88 07                	mov    %al,(%rdi)
+  80230b:	eb 98                	jmp    8022a5 <memset+0x46>
+
+000000000080230d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80230d:	48 89 f8             	mov    %rdi,%rax
+  802310:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802313:	48 39 fe             	cmp    %rdi,%rsi
+  802316:	73 3b                	jae    802353 <memmove+0x46>
+  802318:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80231c:	48 39 d7             	cmp    %rdx,%rdi
+  80231f:	73 32                	jae    802353 <memmove+0x46>
+        s += n;
+        d += n;
+  802321:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802325:	48 89 d6             	mov    %rdx,%rsi
+  802328:	48 09 fe             	or     %rdi,%rsi
+  80232b:	48 09 ce             	or     %rcx,%rsi
+  80232e:	40 f6 c6 07          	test   $0x7,%sil
+  802332:	75 12                	jne    802346 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802334:	48 83 ef 08          	sub    $0x8,%rdi
+  802338:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80233c:	48 c1 e9 03          	shr    $0x3,%rcx
+  802340:	fd                   	std
+  802341:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802344:	fc                   	cld
+  802345:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802346:	48 83 ef 01          	sub    $0x1,%rdi
+  80234a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80234e:	fd                   	std
+  80234f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802351:	eb f1                	jmp    802344 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802353:	48 89 f2             	mov    %rsi,%rdx
+  802356:	48 09 c2             	or     %rax,%rdx
+  802359:	48 09 ca             	or     %rcx,%rdx
+  80235c:	f6 c2 07             	test   $0x7,%dl
+  80235f:	75 0c                	jne    80236d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802361:	48 c1 e9 03          	shr    $0x3,%rcx
+  802365:	48 89 c7             	mov    %rax,%rdi
+  802368:	fc                   	cld
+  802369:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80236c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80236d:	48 89 c7             	mov    %rax,%rdi
+  802370:	fc                   	cld
+  802371:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802373:	c3                   	ret
+
+0000000000802374 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802374:	55                   	push   %rbp
+  802375:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802378:	48 b8 0d 23 80 00 00 	movabs $0x80230d,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+}
+  802384:	5d                   	pop    %rbp
+  802385:	c3                   	ret
+
+0000000000802386 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802386:	55                   	push   %rbp
+  802387:	48 89 e5             	mov    %rsp,%rbp
+  80238a:	41 57                	push   %r15
+  80238c:	41 56                	push   %r14
+  80238e:	41 55                	push   %r13
+  802390:	41 54                	push   %r12
+  802392:	53                   	push   %rbx
+  802393:	48 83 ec 08          	sub    $0x8,%rsp
+  802397:	49 89 fe             	mov    %rdi,%r14
+  80239a:	49 89 f7             	mov    %rsi,%r15
+  80239d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023a0:	48 89 f7             	mov    %rsi,%rdi
+  8023a3:	48 b8 7f 1f 80 00 00 	movabs $0x801f7f,%rax
+  8023aa:	00 00 00 
+  8023ad:	ff d0                	call   *%rax
+  8023af:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023b2:	48 89 de             	mov    %rbx,%rsi
+  8023b5:	4c 89 f7             	mov    %r14,%rdi
+  8023b8:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+  8023c4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023c7:	48 39 c3             	cmp    %rax,%rbx
+  8023ca:	74 36                	je     802402 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023cc:	48 89 d8             	mov    %rbx,%rax
+  8023cf:	4c 29 e8             	sub    %r13,%rax
+  8023d2:	49 39 c4             	cmp    %rax,%r12
+  8023d5:	73 31                	jae    802408 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023d7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023dc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023e0:	4c 89 fe             	mov    %r15,%rsi
+  8023e3:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8023ef:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8023f3:	48 83 c4 08          	add    $0x8,%rsp
+  8023f7:	5b                   	pop    %rbx
+  8023f8:	41 5c                	pop    %r12
+  8023fa:	41 5d                	pop    %r13
+  8023fc:	41 5e                	pop    %r14
+  8023fe:	41 5f                	pop    %r15
+  802400:	5d                   	pop    %rbp
+  802401:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802402:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802406:	eb eb                	jmp    8023f3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802408:	48 83 eb 01          	sub    $0x1,%rbx
+  80240c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802410:	48 89 da             	mov    %rbx,%rdx
+  802413:	4c 89 fe             	mov    %r15,%rsi
+  802416:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802422:	49 01 de             	add    %rbx,%r14
+  802425:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80242a:	eb c3                	jmp    8023ef <strlcat+0x69>
+
+000000000080242c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80242c:	48 85 d2             	test   %rdx,%rdx
+  80242f:	74 2d                	je     80245e <memcmp+0x32>
+  802431:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802436:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80243a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80243f:	44 38 c1             	cmp    %r8b,%cl
+  802442:	75 0f                	jne    802453 <memcmp+0x27>
+    while (n-- > 0) {
+  802444:	48 83 c0 01          	add    $0x1,%rax
+  802448:	48 39 c2             	cmp    %rax,%rdx
+  80244b:	75 e9                	jne    802436 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80244d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802452:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802453:	0f b6 c1             	movzbl %cl,%eax
+  802456:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80245a:	44 29 c0             	sub    %r8d,%eax
+  80245d:	c3                   	ret
+    return 0;
+  80245e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802463:	c3                   	ret
+
+0000000000802464 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802464:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802468:	48 39 c7             	cmp    %rax,%rdi
+  80246b:	73 0f                	jae    80247c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80246d:	40 38 37             	cmp    %sil,(%rdi)
+  802470:	74 0e                	je     802480 <memfind+0x1c>
+    for (; src < end; src++) {
+  802472:	48 83 c7 01          	add    $0x1,%rdi
+  802476:	48 39 f8             	cmp    %rdi,%rax
+  802479:	75 f2                	jne    80246d <memfind+0x9>
+  80247b:	c3                   	ret
+  80247c:	48 89 f8             	mov    %rdi,%rax
+  80247f:	c3                   	ret
+  802480:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802483:	c3                   	ret
+
+0000000000802484 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802484:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802487:	0f b6 37             	movzbl (%rdi),%esi
+  80248a:	40 80 fe 20          	cmp    $0x20,%sil
+  80248e:	74 06                	je     802496 <strtol+0x12>
+  802490:	40 80 fe 09          	cmp    $0x9,%sil
+  802494:	75 13                	jne    8024a9 <strtol+0x25>
+  802496:	48 83 c7 01          	add    $0x1,%rdi
+  80249a:	0f b6 37             	movzbl (%rdi),%esi
+  80249d:	40 80 fe 20          	cmp    $0x20,%sil
+  8024a1:	74 f3                	je     802496 <strtol+0x12>
+  8024a3:	40 80 fe 09          	cmp    $0x9,%sil
+  8024a7:	74 ed                	je     802496 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024a9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024ac:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024af:	3c 01                	cmp    $0x1,%al
+  8024b1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024b5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024bb:	75 0f                	jne    8024cc <strtol+0x48>
+  8024bd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024c0:	74 14                	je     8024d6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024c2:	85 d2                	test   %edx,%edx
+  8024c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024c9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024cc:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024d1:	4c 63 ca             	movslq %edx,%r9
+  8024d4:	eb 36                	jmp    80250c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024d6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024da:	74 0f                	je     8024eb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024dc:	85 d2                	test   %edx,%edx
+  8024de:	75 ec                	jne    8024cc <strtol+0x48>
+        s++;
+  8024e0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024e4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8024e9:	eb e1                	jmp    8024cc <strtol+0x48>
+        s += 2;
+  8024eb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8024ef:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8024f4:	eb d6                	jmp    8024cc <strtol+0x48>
+            dig -= '0';
+  8024f6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8024f9:	44 0f b6 c1          	movzbl %cl,%r8d
+  8024fd:	41 39 d0             	cmp    %edx,%r8d
+  802500:	7d 21                	jge    802523 <strtol+0x9f>
+        val = val * base + dig;
+  802502:	49 0f af c1          	imul   %r9,%rax
+  802506:	0f b6 c9             	movzbl %cl,%ecx
+  802509:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80250c:	48 83 c7 01          	add    $0x1,%rdi
+  802510:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802514:	80 f9 39             	cmp    $0x39,%cl
+  802517:	76 dd                	jbe    8024f6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802519:	80 f9 7b             	cmp    $0x7b,%cl
+  80251c:	77 05                	ja     802523 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80251e:	83 e9 57             	sub    $0x57,%ecx
+  802521:	eb d6                	jmp    8024f9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802523:	4d 85 d2             	test   %r10,%r10
+  802526:	74 03                	je     80252b <strtol+0xa7>
+  802528:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80252b:	48 89 c2             	mov    %rax,%rdx
+  80252e:	48 f7 da             	neg    %rdx
+  802531:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802535:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802539:	c3                   	ret
+
+000000000080253a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80253a:	55                   	push   %rbp
+  80253b:	48 89 e5             	mov    %rsp,%rbp
+  80253e:	53                   	push   %rbx
+  80253f:	48 89 fa             	mov    %rdi,%rdx
+  802542:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802545:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80254a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80254f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802554:	be 00 00 00 00       	mov    $0x0,%esi
+  802559:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80255f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802565:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802567:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80256b:	c9                   	leave
+  80256c:	c3                   	ret
+
+000000000080256d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80256d:	55                   	push   %rbp
+  80256e:	48 89 e5             	mov    %rsp,%rbp
+  802571:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802572:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802577:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802581:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802586:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80258b:	be 00 00 00 00       	mov    $0x0,%esi
+  802590:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802596:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80259c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80259e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025a2:	c9                   	leave
+  8025a3:	c3                   	ret
+
+00000000008025a4 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025a4:	55                   	push   %rbp
+  8025a5:	48 89 e5             	mov    %rsp,%rbp
+  8025a8:	53                   	push   %rbx
+  8025a9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025ac:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025d1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d7:	c9                   	leave
+  8025d8:	c3                   	ret
+
+00000000008025d9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025d9:	55                   	push   %rbp
+  8025da:	48 89 e5             	mov    %rsp,%rbp
+  8025dd:	53                   	push   %rbx
+  8025de:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025e5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802604:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80260a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80260c:	48 85 c0             	test   %rax,%rax
+  80260f:	7f 06                	jg     802617 <sys_env_destroy+0x3e>
+}
+  802611:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802615:	c9                   	leave
+  802616:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802617:	49 89 c0             	mov    %rax,%r8
+  80261a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80261f:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802626:	00 00 00 
+  802629:	be 27 00 00 00       	mov    $0x27,%esi
+  80262e:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802635:	00 00 00 
+  802638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263d:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802644:	00 00 00 
+  802647:	41 ff d1             	call   *%r9
+
+000000000080264a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80264a:	55                   	push   %rbp
+  80264b:	48 89 e5             	mov    %rsp,%rbp
+  80264e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80264f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802654:	ba 00 00 00 00       	mov    $0x0,%edx
+  802659:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80265e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802663:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802668:	be 00 00 00 00       	mov    $0x0,%esi
+  80266d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802673:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802679:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80267b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80267f:	c9                   	leave
+  802680:	c3                   	ret
+
+0000000000802681 <sys_yield>:
+
+void
+sys_yield(void) {
+  802681:	55                   	push   %rbp
+  802682:	48 89 e5             	mov    %rsp,%rbp
+  802685:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802686:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80268b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802690:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802695:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80269a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80269f:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026b0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026b6:	c9                   	leave
+  8026b7:	c3                   	ret
+
+00000000008026b8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026b8:	55                   	push   %rbp
+  8026b9:	48 89 e5             	mov    %rsp,%rbp
+  8026bc:	53                   	push   %rbx
+  8026bd:	48 89 fa             	mov    %rdi,%rdx
+  8026c0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026c3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026c8:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026cf:	00 00 00 
+  8026d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026e8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8026ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ee:	c9                   	leave
+  8026ef:	c3                   	ret
+
+00000000008026f0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8026f0:	55                   	push   %rbp
+  8026f1:	48 89 e5             	mov    %rsp,%rbp
+  8026f4:	53                   	push   %rbx
+  8026f5:	49 89 f8             	mov    %rdi,%r8
+  8026f8:	48 89 d3             	mov    %rdx,%rbx
+  8026fb:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8026fe:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802703:	4c 89 c2             	mov    %r8,%rdx
+  802706:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802709:	be 00 00 00 00       	mov    $0x0,%esi
+  80270e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802714:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80271a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80271c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802720:	c9                   	leave
+  802721:	c3                   	ret
+
+0000000000802722 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802722:	55                   	push   %rbp
+  802723:	48 89 e5             	mov    %rsp,%rbp
+  802726:	53                   	push   %rbx
+  802727:	48 83 ec 08          	sub    $0x8,%rsp
+  80272b:	89 f8                	mov    %edi,%eax
+  80272d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802730:	48 63 f9             	movslq %ecx,%rdi
+  802733:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802736:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80273b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80273e:	be 00 00 00 00       	mov    $0x0,%esi
+  802743:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802749:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80274f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802751:	48 85 c0             	test   %rax,%rax
+  802754:	7f 06                	jg     80275c <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802756:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80275a:	c9                   	leave
+  80275b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80275c:	49 89 c0             	mov    %rax,%r8
+  80275f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802764:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80276b:	00 00 00 
+  80276e:	be 27 00 00 00       	mov    $0x27,%esi
+  802773:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80277a:	00 00 00 
+  80277d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802782:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802789:	00 00 00 
+  80278c:	41 ff d1             	call   *%r9
+
+000000000080278f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80278f:	55                   	push   %rbp
+  802790:	48 89 e5             	mov    %rsp,%rbp
+  802793:	53                   	push   %rbx
+  802794:	48 83 ec 08          	sub    $0x8,%rsp
+  802798:	89 f8                	mov    %edi,%eax
+  80279a:	49 89 f2             	mov    %rsi,%r10
+  80279d:	48 89 cf             	mov    %rcx,%rdi
+  8027a0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027a3:	48 63 da             	movslq %edx,%rbx
+  8027a6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ae:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027b1:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027bc:	48 85 c0             	test   %rax,%rax
+  8027bf:	7f 06                	jg     8027c7 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027c5:	c9                   	leave
+  8027c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027c7:	49 89 c0             	mov    %rax,%r8
+  8027ca:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027cf:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8027d6:	00 00 00 
+  8027d9:	be 27 00 00 00       	mov    $0x27,%esi
+  8027de:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8027e5:	00 00 00 
+  8027e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ed:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  8027f4:	00 00 00 
+  8027f7:	41 ff d1             	call   *%r9
+
+00000000008027fa <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8027fa:	55                   	push   %rbp
+  8027fb:	48 89 e5             	mov    %rsp,%rbp
+  8027fe:	53                   	push   %rbx
+  8027ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802803:	48 89 f1             	mov    %rsi,%rcx
+  802806:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802809:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80280c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802811:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802816:	be 00 00 00 00       	mov    $0x0,%esi
+  80281b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802821:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802827:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802829:	48 85 c0             	test   %rax,%rax
+  80282c:	7f 06                	jg     802834 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80282e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802832:	c9                   	leave
+  802833:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802834:	49 89 c0             	mov    %rax,%r8
+  802837:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80283c:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802843:	00 00 00 
+  802846:	be 27 00 00 00       	mov    $0x27,%esi
+  80284b:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802852:	00 00 00 
+  802855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285a:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802861:	00 00 00 
+  802864:	41 ff d1             	call   *%r9
+
+0000000000802867 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802867:	55                   	push   %rbp
+  802868:	48 89 e5             	mov    %rsp,%rbp
+  80286b:	53                   	push   %rbx
+  80286c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802870:	48 63 ce             	movslq %esi,%rcx
+  802873:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802876:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80287b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802880:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802885:	be 00 00 00 00       	mov    $0x0,%esi
+  80288a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802890:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802896:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802898:	48 85 c0             	test   %rax,%rax
+  80289b:	7f 06                	jg     8028a3 <sys_env_set_status+0x3c>
+}
+  80289d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028a1:	c9                   	leave
+  8028a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028a3:	49 89 c0             	mov    %rax,%r8
+  8028a6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028ab:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8028b2:	00 00 00 
+  8028b5:	be 27 00 00 00       	mov    $0x27,%esi
+  8028ba:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8028c1:	00 00 00 
+  8028c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c9:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  8028d0:	00 00 00 
+  8028d3:	41 ff d1             	call   *%r9
+
+00000000008028d6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028d6:	55                   	push   %rbp
+  8028d7:	48 89 e5             	mov    %rsp,%rbp
+  8028da:	53                   	push   %rbx
+  8028db:	48 83 ec 08          	sub    $0x8,%rsp
+  8028df:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802905:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802907:	48 85 c0             	test   %rax,%rax
+  80290a:	7f 06                	jg     802912 <sys_env_set_trapframe+0x3c>
+}
+  80290c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802912:	49 89 c0             	mov    %rax,%r8
+  802915:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80291a:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802921:	00 00 00 
+  802924:	be 27 00 00 00       	mov    $0x27,%esi
+  802929:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802930:	00 00 00 
+  802933:	b8 00 00 00 00       	mov    $0x0,%eax
+  802938:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  80293f:	00 00 00 
+  802942:	41 ff d1             	call   *%r9
+
+0000000000802945 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802945:	55                   	push   %rbp
+  802946:	48 89 e5             	mov    %rsp,%rbp
+  802949:	53                   	push   %rbx
+  80294a:	48 83 ec 08          	sub    $0x8,%rsp
+  80294e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802951:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802954:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802959:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80295e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802963:	be 00 00 00 00       	mov    $0x0,%esi
+  802968:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80296e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802974:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802976:	48 85 c0             	test   %rax,%rax
+  802979:	7f 06                	jg     802981 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80297b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80297f:	c9                   	leave
+  802980:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802981:	49 89 c0             	mov    %rax,%r8
+  802984:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802989:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802990:	00 00 00 
+  802993:	be 27 00 00 00       	mov    $0x27,%esi
+  802998:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80299f:	00 00 00 
+  8029a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a7:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  8029ae:	00 00 00 
+  8029b1:	41 ff d1             	call   *%r9
+
+00000000008029b4 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029b4:	55                   	push   %rbp
+  8029b5:	48 89 e5             	mov    %rsp,%rbp
+  8029b8:	53                   	push   %rbx
+  8029b9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029bd:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029c4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029e6:	48 85 c0             	test   %rax,%rax
+  8029e9:	7f 06                	jg     8029f1 <sys_env_set_reclaim+0x3d>
+}
+  8029eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ef:	c9                   	leave
+  8029f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029f1:	49 89 c0             	mov    %rax,%r8
+  8029f4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8029f9:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802a00:	00 00 00 
+  802a03:	be 27 00 00 00       	mov    $0x27,%esi
+  802a08:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a0f:	00 00 00 
+  802a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a17:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802a1e:	00 00 00 
+  802a21:	41 ff d1             	call   *%r9
+
+0000000000802a24 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a24:	55                   	push   %rbp
+  802a25:	48 89 e5             	mov    %rsp,%rbp
+  802a28:	53                   	push   %rbx
+  802a29:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a2d:	48 63 ce             	movslq %esi,%rcx
+  802a30:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a33:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a3d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a42:	be 00 00 00 00       	mov    $0x0,%esi
+  802a47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a4d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a53:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a55:	48 85 c0             	test   %rax,%rax
+  802a58:	7f 06                	jg     802a60 <sys_env_set_nice+0x3c>
+}
+  802a5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a5e:	c9                   	leave
+  802a5f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a60:	49 89 c0             	mov    %rax,%r8
+  802a63:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a68:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802a6f:	00 00 00 
+  802a72:	be 27 00 00 00       	mov    $0x27,%esi
+  802a77:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a7e:	00 00 00 
+  802a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a86:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802a8d:	00 00 00 
+  802a90:	41 ff d1             	call   *%r9
+
+0000000000802a93 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802a93:	55                   	push   %rbp
+  802a94:	48 89 e5             	mov    %rsp,%rbp
+  802a97:	53                   	push   %rbx
+  802a98:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a9b:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802aa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aa5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aaa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aaf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ab4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ac0:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ac2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac6:	c9                   	leave
+  802ac7:	c3                   	ret
+
+0000000000802ac8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ac8:	55                   	push   %rbp
+  802ac9:	48 89 e5             	mov    %rsp,%rbp
+  802acc:	53                   	push   %rbx
+  802acd:	89 f8                	mov    %edi,%eax
+  802acf:	49 89 f1             	mov    %rsi,%r9
+  802ad2:	48 89 d3             	mov    %rdx,%rbx
+  802ad5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ad8:	49 63 f0             	movslq %r8d,%rsi
+  802adb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ade:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ae3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ae6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802af2:	cd 30                	int    $0x30
+}
+  802af4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+0000000000802afa <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802afa:	55                   	push   %rbp
+  802afb:	48 89 e5             	mov    %rsp,%rbp
+  802afe:	53                   	push   %rbx
+  802aff:	89 f8                	mov    %edi,%eax
+  802b01:	49 89 f1             	mov    %rsi,%r9
+  802b04:	48 89 d3             	mov    %rdx,%rbx
+  802b07:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b0a:	49 63 f0             	movslq %r8d,%rsi
+  802b0d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b10:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b15:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b24:	cd 30                	int    $0x30
+}
+  802b26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b2a:	c9                   	leave
+  802b2b:	c3                   	ret
+
+0000000000802b2c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b2c:	55                   	push   %rbp
+  802b2d:	48 89 e5             	mov    %rsp,%rbp
+  802b30:	53                   	push   %rbx
+  802b31:	48 83 ec 08          	sub    $0x8,%rsp
+  802b35:	89 f8                	mov    %edi,%eax
+  802b37:	49 89 f2             	mov    %rsi,%r10
+  802b3a:	48 89 d3             	mov    %rdx,%rbx
+  802b3d:	48 89 cf             	mov    %rcx,%rdi
+  802b40:	44 89 c6             	mov    %r8d,%esi
+  802b43:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b46:	48 63 f6             	movslq %esi,%rsi
+  802b49:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b4c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b51:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b54:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b58:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b5a:	48 85 c0             	test   %rax,%rax
+  802b5d:	7f 06                	jg     802b65 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b65:	49 89 c0             	mov    %rax,%r8
+  802b68:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b6d:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802b74:	00 00 00 
+  802b77:	be 27 00 00 00       	mov    $0x27,%esi
+  802b7c:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802b83:	00 00 00 
+  802b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8b:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802b92:	00 00 00 
+  802b95:	41 ff d1             	call   *%r9
+
+0000000000802b98 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802b98:	55                   	push   %rbp
+  802b99:	48 89 e5             	mov    %rsp,%rbp
+  802b9c:	53                   	push   %rbx
+  802b9d:	48 83 ec 08          	sub    $0x8,%rsp
+  802ba1:	48 89 f1             	mov    %rsi,%rcx
+  802ba4:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802ba7:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bab:	48 8b 1a             	mov    (%rdx),%rbx
+  802bae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bb1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bb6:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bba:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bbe:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bc2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bc4:	48 85 c0             	test   %rax,%rax
+  802bc7:	7f 06                	jg     802bcf <sys_ipc_call_short+0x37>
+}
+  802bc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bcd:	c9                   	leave
+  802bce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bcf:	49 89 c0             	mov    %rax,%r8
+  802bd2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bd7:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802bde:	00 00 00 
+  802be1:	be 27 00 00 00       	mov    $0x27,%esi
+  802be6:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802bed:	00 00 00 
+  802bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf5:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802bfc:	00 00 00 
+  802bff:	41 ff d1             	call   *%r9
+
+0000000000802c02 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c02:	55                   	push   %rbp
+  802c03:	48 89 e5             	mov    %rsp,%rbp
+  802c06:	53                   	push   %rbx
+  802c07:	48 83 ec 08          	sub    $0x8,%rsp
+  802c0b:	89 f8                	mov    %edi,%eax
+  802c0d:	49 89 f2             	mov    %rsi,%r10
+  802c10:	48 89 d3             	mov    %rdx,%rbx
+  802c13:	48 89 cf             	mov    %rcx,%rdi
+  802c16:	44 89 c6             	mov    %r8d,%esi
+  802c19:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c1c:	48 63 f6             	movslq %esi,%rsi
+  802c1f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c22:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c27:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c2a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c2e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c30:	48 85 c0             	test   %rax,%rax
+  802c33:	7f 06                	jg     802c3b <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c39:	c9                   	leave
+  802c3a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c3b:	49 89 c0             	mov    %rax,%r8
+  802c3e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c43:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802c4a:	00 00 00 
+  802c4d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c52:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802c59:	00 00 00 
+  802c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c61:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802c68:	00 00 00 
+  802c6b:	41 ff d1             	call   *%r9
+
+0000000000802c6e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c6e:	55                   	push   %rbp
+  802c6f:	48 89 e5             	mov    %rsp,%rbp
+  802c72:	53                   	push   %rbx
+  802c73:	48 83 ec 08          	sub    $0x8,%rsp
+  802c77:	48 89 fa             	mov    %rdi,%rdx
+  802c7a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c7d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c87:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c8c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c97:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c9d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c9f:	48 85 c0             	test   %rax,%rax
+  802ca2:	7f 06                	jg     802caa <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ca4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca8:	c9                   	leave
+  802ca9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802caa:	49 89 c0             	mov    %rax,%r8
+  802cad:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cb2:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802cb9:	00 00 00 
+  802cbc:	be 27 00 00 00       	mov    $0x27,%esi
+  802cc1:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802cc8:	00 00 00 
+  802ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd0:	49 b9 74 50 80 00 00 	movabs $0x805074,%r9
+  802cd7:	00 00 00 
+  802cda:	41 ff d1             	call   *%r9
+
+0000000000802cdd <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cdd:	55                   	push   %rbp
+  802cde:	48 89 e5             	mov    %rsp,%rbp
+  802ce1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802ce2:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cec:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cf6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cfb:	be 00 00 00 00       	mov    $0x0,%esi
+  802d00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d0c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d12:	c9                   	leave
+  802d13:	c3                   	ret
+
+0000000000802d14 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d14:	55                   	push   %rbp
+  802d15:	48 89 e5             	mov    %rsp,%rbp
+  802d18:	53                   	push   %rbx
+  802d19:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d1c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d21:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d2b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d30:	be 00 00 00 00       	mov    $0x0,%esi
+  802d35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d3b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d41:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+
+0000000000802d49 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+  802d4d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d4e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d58:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d67:	be 00 00 00 00       	mov    $0x0,%esi
+  802d6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d78:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d7e:	c9                   	leave
+  802d7f:	c3                   	ret
+
+0000000000802d80 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d80:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d87:	ff ff ff 
+  802d8a:	48 01 f8             	add    %rdi,%rax
+  802d8d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802d91:	c3                   	ret
+
+0000000000802d92 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d92:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d99:	ff ff ff 
+  802d9c:	48 01 f8             	add    %rdi,%rax
+  802d9f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802da3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802da9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dad:	c3                   	ret
+
+0000000000802dae <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dae:	55                   	push   %rbp
+  802daf:	48 89 e5             	mov    %rsp,%rbp
+  802db2:	41 57                	push   %r15
+  802db4:	41 56                	push   %r14
+  802db6:	41 55                	push   %r13
+  802db8:	41 54                	push   %r12
+  802dba:	53                   	push   %rbx
+  802dbb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dbf:	49 89 ff             	mov    %rdi,%r15
+  802dc2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802dc7:	49 bd ae 42 80 00 00 	movabs $0x8042ae,%r13
+  802dce:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802dd1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802dd7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802dda:	48 89 df             	mov    %rbx,%rdi
+  802ddd:	41 ff d5             	call   *%r13
+  802de0:	83 e0 04             	and    $0x4,%eax
+  802de3:	74 17                	je     802dfc <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802de5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802dec:	4c 39 f3             	cmp    %r14,%rbx
+  802def:	75 e6                	jne    802dd7 <fd_alloc+0x29>
+  802df1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802df7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802dfc:	4d 89 27             	mov    %r12,(%r15)
+}
+  802dff:	48 83 c4 08          	add    $0x8,%rsp
+  802e03:	5b                   	pop    %rbx
+  802e04:	41 5c                	pop    %r12
+  802e06:	41 5d                	pop    %r13
+  802e08:	41 5e                	pop    %r14
+  802e0a:	41 5f                	pop    %r15
+  802e0c:	5d                   	pop    %rbp
+  802e0d:	c3                   	ret
+
+0000000000802e0e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e0e:	83 ff 1f             	cmp    $0x1f,%edi
+  802e11:	77 39                	ja     802e4c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e13:	55                   	push   %rbp
+  802e14:	48 89 e5             	mov    %rsp,%rbp
+  802e17:	41 54                	push   %r12
+  802e19:	53                   	push   %rbx
+  802e1a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e1d:	48 63 df             	movslq %edi,%rbx
+  802e20:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e27:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e2b:	48 89 df             	mov    %rbx,%rdi
+  802e2e:	48 b8 ae 42 80 00 00 	movabs $0x8042ae,%rax
+  802e35:	00 00 00 
+  802e38:	ff d0                	call   *%rax
+  802e3a:	a8 04                	test   $0x4,%al
+  802e3c:	74 14                	je     802e52 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e3e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e47:	5b                   	pop    %rbx
+  802e48:	41 5c                	pop    %r12
+  802e4a:	5d                   	pop    %rbp
+  802e4b:	c3                   	ret
+        return -E_INVAL;
+  802e4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e51:	c3                   	ret
+        return -E_INVAL;
+  802e52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e57:	eb ee                	jmp    802e47 <fd_lookup+0x39>
+
+0000000000802e59 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e59:	55                   	push   %rbp
+  802e5a:	48 89 e5             	mov    %rsp,%rbp
+  802e5d:	41 54                	push   %r12
+  802e5f:	53                   	push   %rbx
+  802e60:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e63:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802e6a:	00 00 00 
+  802e6d:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e74:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e77:	39 3b                	cmp    %edi,(%rbx)
+  802e79:	74 47                	je     802ec2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e7b:	48 83 c0 08          	add    $0x8,%rax
+  802e7f:	48 8b 18             	mov    (%rax),%rbx
+  802e82:	48 85 db             	test   %rbx,%rbx
+  802e85:	75 f0                	jne    802e77 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e87:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e8e:	00 00 00 
+  802e91:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e97:	89 fa                	mov    %edi,%edx
+  802e99:	48 bf 58 61 80 00 00 	movabs $0x806158,%rdi
+  802ea0:	00 00 00 
+  802ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea8:	48 b9 86 16 80 00 00 	movabs $0x801686,%rcx
+  802eaf:	00 00 00 
+  802eb2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802eb4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802eb9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ebd:	5b                   	pop    %rbx
+  802ebe:	41 5c                	pop    %r12
+  802ec0:	5d                   	pop    %rbp
+  802ec1:	c3                   	ret
+            return 0;
+  802ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec7:	eb f0                	jmp    802eb9 <dev_lookup+0x60>
+
+0000000000802ec9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ec9:	55                   	push   %rbp
+  802eca:	48 89 e5             	mov    %rsp,%rbp
+  802ecd:	41 55                	push   %r13
+  802ecf:	41 54                	push   %r12
+  802ed1:	53                   	push   %rbx
+  802ed2:	48 83 ec 18          	sub    $0x18,%rsp
+  802ed6:	48 89 fb             	mov    %rdi,%rbx
+  802ed9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802edc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802ee3:	ff ff ff 
+  802ee6:	48 01 df             	add    %rbx,%rdi
+  802ee9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802eed:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ef1:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  802ef8:	00 00 00 
+  802efb:	ff d0                	call   *%rax
+  802efd:	41 89 c5             	mov    %eax,%r13d
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	78 06                	js     802f0a <fd_close+0x41>
+  802f04:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f08:	74 1a                	je     802f24 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f0a:	45 84 e4             	test   %r12b,%r12b
+  802f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f12:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f16:	44 89 e8             	mov    %r13d,%eax
+  802f19:	48 83 c4 18          	add    $0x18,%rsp
+  802f1d:	5b                   	pop    %rbx
+  802f1e:	41 5c                	pop    %r12
+  802f20:	41 5d                	pop    %r13
+  802f22:	5d                   	pop    %rbp
+  802f23:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f24:	8b 3b                	mov    (%rbx),%edi
+  802f26:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f2a:	48 b8 59 2e 80 00 00 	movabs $0x802e59,%rax
+  802f31:	00 00 00 
+  802f34:	ff d0                	call   *%rax
+  802f36:	41 89 c5             	mov    %eax,%r13d
+  802f39:	85 c0                	test   %eax,%eax
+  802f3b:	78 1b                	js     802f58 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f41:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f45:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f4b:	48 85 c0             	test   %rax,%rax
+  802f4e:	74 08                	je     802f58 <fd_close+0x8f>
+  802f50:	48 89 df             	mov    %rbx,%rdi
+  802f53:	ff d0                	call   *%rax
+  802f55:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f5d:	48 89 de             	mov    %rbx,%rsi
+  802f60:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f65:	48 b8 fa 27 80 00 00 	movabs $0x8027fa,%rax
+  802f6c:	00 00 00 
+  802f6f:	ff d0                	call   *%rax
+    return res;
+  802f71:	eb a3                	jmp    802f16 <fd_close+0x4d>
+
+0000000000802f73 <close>:
+
+int
+close(int fdnum) {
+  802f73:	55                   	push   %rbp
+  802f74:	48 89 e5             	mov    %rsp,%rbp
+  802f77:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f7b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f7f:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  802f86:	00 00 00 
+  802f89:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f8b:	85 c0                	test   %eax,%eax
+  802f8d:	78 15                	js     802fa4 <close+0x31>
+
+    return fd_close(fd, 1);
+  802f8f:	be 01 00 00 00       	mov    $0x1,%esi
+  802f94:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f98:	48 b8 c9 2e 80 00 00 	movabs $0x802ec9,%rax
+  802f9f:	00 00 00 
+  802fa2:	ff d0                	call   *%rax
+}
+  802fa4:	c9                   	leave
+  802fa5:	c3                   	ret
+
+0000000000802fa6 <close_all>:
+
+void
+close_all(void) {
+  802fa6:	55                   	push   %rbp
+  802fa7:	48 89 e5             	mov    %rsp,%rbp
+  802faa:	41 54                	push   %r12
+  802fac:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fb2:	49 bc 73 2f 80 00 00 	movabs $0x802f73,%r12
+  802fb9:	00 00 00 
+  802fbc:	89 df                	mov    %ebx,%edi
+  802fbe:	41 ff d4             	call   *%r12
+  802fc1:	83 c3 01             	add    $0x1,%ebx
+  802fc4:	83 fb 20             	cmp    $0x20,%ebx
+  802fc7:	75 f3                	jne    802fbc <close_all+0x16>
+}
+  802fc9:	5b                   	pop    %rbx
+  802fca:	41 5c                	pop    %r12
+  802fcc:	5d                   	pop    %rbp
+  802fcd:	c3                   	ret
+
+0000000000802fce <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fce:	55                   	push   %rbp
+  802fcf:	48 89 e5             	mov    %rsp,%rbp
+  802fd2:	41 57                	push   %r15
+  802fd4:	41 56                	push   %r14
+  802fd6:	41 55                	push   %r13
+  802fd8:	41 54                	push   %r12
+  802fda:	53                   	push   %rbx
+  802fdb:	48 83 ec 18          	sub    $0x18,%rsp
+  802fdf:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802fe2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802fe6:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  802fed:	00 00 00 
+  802ff0:	ff d0                	call   *%rax
+  802ff2:	89 c3                	mov    %eax,%ebx
+  802ff4:	85 c0                	test   %eax,%eax
+  802ff6:	0f 88 b8 00 00 00    	js     8030b4 <dup+0xe6>
+    close(newfdnum);
+  802ffc:	44 89 e7             	mov    %r12d,%edi
+  802fff:	48 b8 73 2f 80 00 00 	movabs $0x802f73,%rax
+  803006:	00 00 00 
+  803009:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80300b:	4d 63 ec             	movslq %r12d,%r13
+  80300e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803015:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803019:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80301d:	4c 89 ff             	mov    %r15,%rdi
+  803020:	49 be 92 2d 80 00 00 	movabs $0x802d92,%r14
+  803027:	00 00 00 
+  80302a:	41 ff d6             	call   *%r14
+  80302d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803030:	4c 89 ef             	mov    %r13,%rdi
+  803033:	41 ff d6             	call   *%r14
+  803036:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803039:	48 89 df             	mov    %rbx,%rdi
+  80303c:	48 b8 ae 42 80 00 00 	movabs $0x8042ae,%rax
+  803043:	00 00 00 
+  803046:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803048:	a8 04                	test   $0x4,%al
+  80304a:	74 2b                	je     803077 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80304c:	41 89 c1             	mov    %eax,%r9d
+  80304f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803055:	4c 89 f1             	mov    %r14,%rcx
+  803058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80305d:	48 89 de             	mov    %rbx,%rsi
+  803060:	bf 00 00 00 00       	mov    $0x0,%edi
+  803065:	48 b8 8f 27 80 00 00 	movabs $0x80278f,%rax
+  80306c:	00 00 00 
+  80306f:	ff d0                	call   *%rax
+  803071:	89 c3                	mov    %eax,%ebx
+  803073:	85 c0                	test   %eax,%eax
+  803075:	78 4e                	js     8030c5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803077:	4c 89 ff             	mov    %r15,%rdi
+  80307a:	48 b8 ae 42 80 00 00 	movabs $0x8042ae,%rax
+  803081:	00 00 00 
+  803084:	ff d0                	call   *%rax
+  803086:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803089:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80308f:	4c 89 e9             	mov    %r13,%rcx
+  803092:	ba 00 00 00 00       	mov    $0x0,%edx
+  803097:	4c 89 fe             	mov    %r15,%rsi
+  80309a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80309f:	48 b8 8f 27 80 00 00 	movabs $0x80278f,%rax
+  8030a6:	00 00 00 
+  8030a9:	ff d0                	call   *%rax
+  8030ab:	89 c3                	mov    %eax,%ebx
+  8030ad:	85 c0                	test   %eax,%eax
+  8030af:	78 14                	js     8030c5 <dup+0xf7>
+
+    return newfdnum;
+  8030b1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030b4:	89 d8                	mov    %ebx,%eax
+  8030b6:	48 83 c4 18          	add    $0x18,%rsp
+  8030ba:	5b                   	pop    %rbx
+  8030bb:	41 5c                	pop    %r12
+  8030bd:	41 5d                	pop    %r13
+  8030bf:	41 5e                	pop    %r14
+  8030c1:	41 5f                	pop    %r15
+  8030c3:	5d                   	pop    %rbp
+  8030c4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030ca:	4c 89 ee             	mov    %r13,%rsi
+  8030cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d2:	49 bc fa 27 80 00 00 	movabs $0x8027fa,%r12
+  8030d9:	00 00 00 
+  8030dc:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e4:	4c 89 f6             	mov    %r14,%rsi
+  8030e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ec:	41 ff d4             	call   *%r12
+    return res;
+  8030ef:	eb c3                	jmp    8030b4 <dup+0xe6>
+
+00000000008030f1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030f1:	55                   	push   %rbp
+  8030f2:	48 89 e5             	mov    %rsp,%rbp
+  8030f5:	41 56                	push   %r14
+  8030f7:	41 55                	push   %r13
+  8030f9:	41 54                	push   %r12
+  8030fb:	53                   	push   %rbx
+  8030fc:	48 83 ec 10          	sub    $0x10,%rsp
+  803100:	89 fb                	mov    %edi,%ebx
+  803102:	49 89 f4             	mov    %rsi,%r12
+  803105:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803108:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80310c:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	85 c0                	test   %eax,%eax
+  80311a:	78 4c                	js     803168 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80311c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803120:	41 8b 3e             	mov    (%r14),%edi
+  803123:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803127:	48 b8 59 2e 80 00 00 	movabs $0x802e59,%rax
+  80312e:	00 00 00 
+  803131:	ff d0                	call   *%rax
+  803133:	85 c0                	test   %eax,%eax
+  803135:	78 35                	js     80316c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803137:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80313b:	83 e0 03             	and    $0x3,%eax
+  80313e:	83 f8 01             	cmp    $0x1,%eax
+  803141:	74 2d                	je     803170 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803143:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803147:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80314b:	48 85 c0             	test   %rax,%rax
+  80314e:	74 56                	je     8031a6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803150:	4c 89 ea             	mov    %r13,%rdx
+  803153:	4c 89 e6             	mov    %r12,%rsi
+  803156:	4c 89 f7             	mov    %r14,%rdi
+  803159:	ff d0                	call   *%rax
+}
+  80315b:	48 83 c4 10          	add    $0x10,%rsp
+  80315f:	5b                   	pop    %rbx
+  803160:	41 5c                	pop    %r12
+  803162:	41 5d                	pop    %r13
+  803164:	41 5e                	pop    %r14
+  803166:	5d                   	pop    %rbp
+  803167:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803168:	48 98                	cltq
+  80316a:	eb ef                	jmp    80315b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80316c:	48 98                	cltq
+  80316e:	eb eb                	jmp    80315b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803170:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803177:	00 00 00 
+  80317a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803180:	89 da                	mov    %ebx,%edx
+  803182:	48 bf 99 61 80 00 00 	movabs $0x806199,%rdi
+  803189:	00 00 00 
+  80318c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803191:	48 b9 86 16 80 00 00 	movabs $0x801686,%rcx
+  803198:	00 00 00 
+  80319b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80319d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031a4:	eb b5                	jmp    80315b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031a6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031ad:	eb ac                	jmp    80315b <read+0x6a>
+
+00000000008031af <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031af:	55                   	push   %rbp
+  8031b0:	48 89 e5             	mov    %rsp,%rbp
+  8031b3:	41 57                	push   %r15
+  8031b5:	41 56                	push   %r14
+  8031b7:	41 55                	push   %r13
+  8031b9:	41 54                	push   %r12
+  8031bb:	53                   	push   %rbx
+  8031bc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031c0:	48 85 d2             	test   %rdx,%rdx
+  8031c3:	74 54                	je     803219 <readn+0x6a>
+  8031c5:	41 89 fd             	mov    %edi,%r13d
+  8031c8:	49 89 f6             	mov    %rsi,%r14
+  8031cb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031d3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031d8:	49 bf f1 30 80 00 00 	movabs $0x8030f1,%r15
+  8031df:	00 00 00 
+  8031e2:	4c 89 e2             	mov    %r12,%rdx
+  8031e5:	48 29 f2             	sub    %rsi,%rdx
+  8031e8:	4c 01 f6             	add    %r14,%rsi
+  8031eb:	44 89 ef             	mov    %r13d,%edi
+  8031ee:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8031f1:	85 c0                	test   %eax,%eax
+  8031f3:	78 20                	js     803215 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8031f5:	01 c3                	add    %eax,%ebx
+  8031f7:	85 c0                	test   %eax,%eax
+  8031f9:	74 08                	je     803203 <readn+0x54>
+  8031fb:	48 63 f3             	movslq %ebx,%rsi
+  8031fe:	4c 39 e6             	cmp    %r12,%rsi
+  803201:	72 df                	jb     8031e2 <readn+0x33>
+    }
+    return res;
+  803203:	48 63 c3             	movslq %ebx,%rax
+}
+  803206:	48 83 c4 08          	add    $0x8,%rsp
+  80320a:	5b                   	pop    %rbx
+  80320b:	41 5c                	pop    %r12
+  80320d:	41 5d                	pop    %r13
+  80320f:	41 5e                	pop    %r14
+  803211:	41 5f                	pop    %r15
+  803213:	5d                   	pop    %rbp
+  803214:	c3                   	ret
+        if (inc < 0) return inc;
+  803215:	48 98                	cltq
+  803217:	eb ed                	jmp    803206 <readn+0x57>
+    int inc = 1, res = 0;
+  803219:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80321e:	eb e3                	jmp    803203 <readn+0x54>
+
+0000000000803220 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803220:	55                   	push   %rbp
+  803221:	48 89 e5             	mov    %rsp,%rbp
+  803224:	41 56                	push   %r14
+  803226:	41 55                	push   %r13
+  803228:	41 54                	push   %r12
+  80322a:	53                   	push   %rbx
+  80322b:	48 83 ec 10          	sub    $0x10,%rsp
+  80322f:	89 fb                	mov    %edi,%ebx
+  803231:	49 89 f4             	mov    %rsi,%r12
+  803234:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803237:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80323b:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+  803247:	85 c0                	test   %eax,%eax
+  803249:	78 47                	js     803292 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80324b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80324f:	41 8b 3e             	mov    (%r14),%edi
+  803252:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803256:	48 b8 59 2e 80 00 00 	movabs $0x802e59,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+  803262:	85 c0                	test   %eax,%eax
+  803264:	78 30                	js     803296 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803266:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80326b:	74 2d                	je     80329a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80326d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803271:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803275:	48 85 c0             	test   %rax,%rax
+  803278:	74 56                	je     8032d0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80327a:	4c 89 ea             	mov    %r13,%rdx
+  80327d:	4c 89 e6             	mov    %r12,%rsi
+  803280:	4c 89 f7             	mov    %r14,%rdi
+  803283:	ff d0                	call   *%rax
+}
+  803285:	48 83 c4 10          	add    $0x10,%rsp
+  803289:	5b                   	pop    %rbx
+  80328a:	41 5c                	pop    %r12
+  80328c:	41 5d                	pop    %r13
+  80328e:	41 5e                	pop    %r14
+  803290:	5d                   	pop    %rbp
+  803291:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803292:	48 98                	cltq
+  803294:	eb ef                	jmp    803285 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803296:	48 98                	cltq
+  803298:	eb eb                	jmp    803285 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80329a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032a1:	00 00 00 
+  8032a4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032aa:	89 da                	mov    %ebx,%edx
+  8032ac:	48 bf b5 61 80 00 00 	movabs $0x8061b5,%rdi
+  8032b3:	00 00 00 
+  8032b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032bb:	48 b9 86 16 80 00 00 	movabs $0x801686,%rcx
+  8032c2:	00 00 00 
+  8032c5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032c7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ce:	eb b5                	jmp    803285 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032d0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032d7:	eb ac                	jmp    803285 <write+0x65>
+
+00000000008032d9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032d9:	55                   	push   %rbp
+  8032da:	48 89 e5             	mov    %rsp,%rbp
+  8032dd:	53                   	push   %rbx
+  8032de:	48 83 ec 18          	sub    $0x18,%rsp
+  8032e2:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032e4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032e8:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  8032ef:	00 00 00 
+  8032f2:	ff d0                	call   *%rax
+  8032f4:	85 c0                	test   %eax,%eax
+  8032f6:	78 0c                	js     803304 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8032f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032fc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8032ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803304:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803308:	c9                   	leave
+  803309:	c3                   	ret
+
+000000000080330a <tell>:
+
+int tell(int fdnum) {
+  80330a:	55                   	push   %rbp
+  80330b:	48 89 e5             	mov    %rsp,%rbp
+  80330e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803312:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803316:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  80331d:	00 00 00 
+  803320:	ff d0                	call   *%rax
+  803322:	85 c0                	test   %eax,%eax
+  803324:	78 07                	js     80332d <tell+0x23>
+
+    return fd->fd_offset;
+  803326:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80332a:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80332d:	c9                   	leave
+  80332e:	c3                   	ret
+
+000000000080332f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80332f:	55                   	push   %rbp
+  803330:	48 89 e5             	mov    %rsp,%rbp
+  803333:	41 55                	push   %r13
+  803335:	41 54                	push   %r12
+  803337:	53                   	push   %rbx
+  803338:	48 83 ec 18          	sub    $0x18,%rsp
+  80333c:	89 fb                	mov    %edi,%ebx
+  80333e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803341:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803345:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  80334c:	00 00 00 
+  80334f:	ff d0                	call   *%rax
+  803351:	85 c0                	test   %eax,%eax
+  803353:	78 38                	js     80338d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803355:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803359:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80335d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803361:	48 b8 59 2e 80 00 00 	movabs $0x802e59,%rax
+  803368:	00 00 00 
+  80336b:	ff d0                	call   *%rax
+  80336d:	85 c0                	test   %eax,%eax
+  80336f:	78 1c                	js     80338d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803371:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803376:	74 20                	je     803398 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803378:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80337c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803380:	48 85 c0             	test   %rax,%rax
+  803383:	74 47                	je     8033cc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803385:	44 89 e6             	mov    %r12d,%esi
+  803388:	4c 89 ef             	mov    %r13,%rdi
+  80338b:	ff d0                	call   *%rax
+}
+  80338d:	48 83 c4 18          	add    $0x18,%rsp
+  803391:	5b                   	pop    %rbx
+  803392:	41 5c                	pop    %r12
+  803394:	41 5d                	pop    %r13
+  803396:	5d                   	pop    %rbp
+  803397:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803398:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80339f:	00 00 00 
+  8033a2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033a8:	89 da                	mov    %ebx,%edx
+  8033aa:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  8033b1:	00 00 00 
+  8033b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b9:	48 b9 86 16 80 00 00 	movabs $0x801686,%rcx
+  8033c0:	00 00 00 
+  8033c3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033ca:	eb c1                	jmp    80338d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033cc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033d1:	eb ba                	jmp    80338d <ftruncate+0x5e>
+
+00000000008033d3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033d3:	55                   	push   %rbp
+  8033d4:	48 89 e5             	mov    %rsp,%rbp
+  8033d7:	41 54                	push   %r12
+  8033d9:	53                   	push   %rbx
+  8033da:	48 83 ec 10          	sub    $0x10,%rsp
+  8033de:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033e1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033e5:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  8033ec:	00 00 00 
+  8033ef:	ff d0                	call   *%rax
+  8033f1:	85 c0                	test   %eax,%eax
+  8033f3:	78 63                	js     803458 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033f5:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8033f9:	41 8b 3c 24          	mov    (%r12),%edi
+  8033fd:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803401:	48 b8 59 2e 80 00 00 	movabs $0x802e59,%rax
+  803408:	00 00 00 
+  80340b:	ff d0                	call   *%rax
+  80340d:	85 c0                	test   %eax,%eax
+  80340f:	78 47                	js     803458 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803411:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803415:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80341a:	74 45                	je     803461 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80341c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80341f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803426:	00 00 00 
+    stat->st_isdir = 0;
+  803429:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803430:	00 00 00 
+    stat->st_ino = 0;
+  803433:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80343a:	00 00 00 00 
+    stat->st_version = 0;
+  80343e:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803445:	00 00 00 
+    stat->st_dev = dev;
+  803448:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80344f:	48 89 de             	mov    %rbx,%rsi
+  803452:	4c 89 e7             	mov    %r12,%rdi
+  803455:	ff 50 28             	call   *0x28(%rax)
+}
+  803458:	48 83 c4 10          	add    $0x10,%rsp
+  80345c:	5b                   	pop    %rbx
+  80345d:	41 5c                	pop    %r12
+  80345f:	5d                   	pop    %rbp
+  803460:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803461:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803466:	eb f0                	jmp    803458 <fstat+0x85>
+
+0000000000803468 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803468:	55                   	push   %rbp
+  803469:	48 89 e5             	mov    %rsp,%rbp
+  80346c:	41 54                	push   %r12
+  80346e:	53                   	push   %rbx
+  80346f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803472:	be 00 00 00 00       	mov    $0x0,%esi
+  803477:	48 b8 89 39 80 00 00 	movabs $0x803989,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803485:	85 c0                	test   %eax,%eax
+  803487:	78 25                	js     8034ae <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803489:	4c 89 e6             	mov    %r12,%rsi
+  80348c:	89 c7                	mov    %eax,%edi
+  80348e:	48 b8 d3 33 80 00 00 	movabs $0x8033d3,%rax
+  803495:	00 00 00 
+  803498:	ff d0                	call   *%rax
+  80349a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80349d:	89 df                	mov    %ebx,%edi
+  80349f:	48 b8 73 2f 80 00 00 	movabs $0x802f73,%rax
+  8034a6:	00 00 00 
+  8034a9:	ff d0                	call   *%rax
+
+    return res;
+  8034ab:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034ae:	89 d8                	mov    %ebx,%eax
+  8034b0:	5b                   	pop    %rbx
+  8034b1:	41 5c                	pop    %r12
+  8034b3:	5d                   	pop    %rbp
+  8034b4:	c3                   	ret
+
+00000000008034b5 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034b5:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034bc:	00 00 00 
+  8034bf:	83 38 00             	cmpl   $0x0,(%rax)
+  8034c2:	74 0a                	je     8034ce <fsipc_env+0x19>
+    return fsenv;
+}
+  8034c4:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034cb:	00 00 
+  8034cd:	c3                   	ret
+fsipc_env(void) {
+  8034ce:	55                   	push   %rbp
+  8034cf:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034d2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034d7:	48 b8 5b 56 80 00 00 	movabs $0x80565b,%rax
+  8034de:	00 00 00 
+  8034e1:	ff d0                	call   *%rax
+  8034e3:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8034ea:	00 00 
+}
+  8034ec:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034f3:	00 00 
+  8034f5:	5d                   	pop    %rbp
+  8034f6:	c3                   	ret
+
+00000000008034f7 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8034f7:	55                   	push   %rbp
+  8034f8:	48 89 e5             	mov    %rsp,%rbp
+  8034fb:	53                   	push   %rbx
+  8034fc:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803500:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803507:	00 
+  803508:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80350f:	00 
+  803510:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803517:	00 
+  803518:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80351f:	00 
+  803520:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803527:	00 
+
+    assert(size <= sizeof(words));
+  803528:	48 83 fa 28          	cmp    $0x28,%rdx
+  80352c:	77 38                	ja     803566 <fsipc_short+0x6f>
+  80352e:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803530:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803534:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  80353b:	00 00 00 
+  80353e:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803540:	48 b8 b5 34 80 00 00 	movabs $0x8034b5,%rax
+  803547:	00 00 00 
+  80354a:	ff d0                	call   *%rax
+  80354c:	89 c7                	mov    %eax,%edi
+  80354e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803552:	89 de                	mov    %ebx,%esi
+  803554:	48 b8 be 55 80 00 00 	movabs $0x8055be,%rax
+  80355b:	00 00 00 
+  80355e:	ff d0                	call   *%rax
+}
+  803560:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803564:	c9                   	leave
+  803565:	c3                   	ret
+    assert(size <= sizeof(words));
+  803566:	48 b9 00 62 80 00 00 	movabs $0x806200,%rcx
+  80356d:	00 00 00 
+  803570:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803577:	00 00 00 
+  80357a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80357f:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803586:	00 00 00 
+  803589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358e:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  803595:	00 00 00 
+  803598:	41 ff d0             	call   *%r8
+
+000000000080359b <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80359b:	55                   	push   %rbp
+  80359c:	48 89 e5             	mov    %rsp,%rbp
+  80359f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035a3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035a6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035a9:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035ac:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035b1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035b5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035ba:	48 b8 f7 34 80 00 00 	movabs $0x8034f7,%rax
+  8035c1:	00 00 00 
+  8035c4:	ff d0                	call   *%rax
+}
+  8035c6:	c9                   	leave
+  8035c7:	c3                   	ret
+
+00000000008035c8 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035c8:	55                   	push   %rbp
+  8035c9:	48 89 e5             	mov    %rsp,%rbp
+  8035cc:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035d0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035d6:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035db:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035df:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035e4:	48 b8 f7 34 80 00 00 	movabs $0x8034f7,%rax
+  8035eb:	00 00 00 
+  8035ee:	ff d0                	call   *%rax
+}
+  8035f0:	c9                   	leave
+  8035f1:	c3                   	ret
+
+00000000008035f2 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8035f2:	55                   	push   %rbp
+  8035f3:	48 89 e5             	mov    %rsp,%rbp
+  8035f6:	41 54                	push   %r12
+  8035f8:	53                   	push   %rbx
+  8035f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8035fd:	89 fb                	mov    %edi,%ebx
+  8035ff:	49 89 f4             	mov    %rsi,%r12
+  803602:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803606:	48 b8 b5 34 80 00 00 	movabs $0x8034b5,%rax
+  80360d:	00 00 00 
+  803610:	ff d0                	call   *%rax
+  803612:	89 c7                	mov    %eax,%edi
+  803614:	6a 00                	push   $0x0
+  803616:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80361a:	50                   	push   %rax
+  80361b:	4d 89 e1             	mov    %r12,%r9
+  80361e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803624:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803629:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803630:	00 00 00 
+  803633:	89 de                	mov    %ebx,%esi
+  803635:	48 b8 59 55 80 00 00 	movabs $0x805559,%rax
+  80363c:	00 00 00 
+  80363f:	ff d0                	call   *%rax
+}
+  803641:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803645:	5b                   	pop    %rbx
+  803646:	41 5c                	pop    %r12
+  803648:	5d                   	pop    %rbp
+  803649:	c3                   	ret
+
+000000000080364a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80364a:	55                   	push   %rbp
+  80364b:	48 89 e5             	mov    %rsp,%rbp
+  80364e:	41 54                	push   %r12
+  803650:	53                   	push   %rbx
+  803651:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803654:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803657:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80365e:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803660:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803665:	be 00 00 00 00       	mov    $0x0,%esi
+  80366a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80366f:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  803676:	00 00 00 
+  803679:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80367b:	85 c0                	test   %eax,%eax
+  80367d:	78 5a                	js     8036d9 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80367f:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803686:	00 00 00 
+  803689:	4c 89 e6             	mov    %r12,%rsi
+  80368c:	48 89 df             	mov    %rbx,%rdi
+  80368f:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  803696:	00 00 00 
+  803699:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80369b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036a2:	00 
+  8036a3:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036a9:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036b0:	00 
+  8036b1:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036b7:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036be:	00 
+  8036bf:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036c6:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036cd:	00 
+  8036ce:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036d9:	5b                   	pop    %rbx
+  8036da:	41 5c                	pop    %r12
+  8036dc:	5d                   	pop    %rbp
+  8036dd:	c3                   	ret
+
+00000000008036de <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036de:	55                   	push   %rbp
+  8036df:	48 89 e5             	mov    %rsp,%rbp
+  8036e2:	41 57                	push   %r15
+  8036e4:	41 56                	push   %r14
+  8036e6:	41 55                	push   %r13
+  8036e8:	41 54                	push   %r12
+  8036ea:	53                   	push   %rbx
+  8036eb:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8036ef:	48 85 ff             	test   %rdi,%rdi
+  8036f2:	0f 84 a1 00 00 00    	je     803799 <devfile_read+0xbb>
+  8036f8:	49 89 ff             	mov    %rdi,%r15
+  8036fb:	49 89 f5             	mov    %rsi,%r13
+  8036fe:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803701:	48 85 f6             	test   %rsi,%rsi
+  803704:	0f 84 c4 00 00 00    	je     8037ce <devfile_read+0xf0>
+    size_t total_read = 0;
+  80370a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803711:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803712:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803719:	00 00 00 
+  80371c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803720:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803723:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803727:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80372c:	be 00 00 00 00       	mov    $0x0,%esi
+  803731:	bf 03 00 00 00       	mov    $0x3,%edi
+  803736:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  80373d:	00 00 00 
+  803740:	ff d0                	call   *%rax
+        if (res < 0) {
+  803742:	85 c0                	test   %eax,%eax
+  803744:	0f 88 b9 00 00 00    	js     803803 <devfile_read+0x125>
+        assert(res <= n);
+  80374a:	48 63 d8             	movslq %eax,%rbx
+  80374d:	49 39 dc             	cmp    %rbx,%r12
+  803750:	0f 82 b1 00 00 00    	jb     803807 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803756:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80375b:	0f 87 db 00 00 00    	ja     80383c <devfile_read+0x15e>
+        if (!res) {
+  803761:	85 c0                	test   %eax,%eax
+  803763:	74 21                	je     803786 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803765:	48 89 da             	mov    %rbx,%rdx
+  803768:	4c 89 f6             	mov    %r14,%rsi
+  80376b:	4c 89 ef             	mov    %r13,%rdi
+  80376e:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  803775:	00 00 00 
+  803778:	ff d0                	call   *%rax
+        total_read += res;
+  80377a:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  80377e:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803781:	49 29 dc             	sub    %rbx,%r12
+  803784:	75 96                	jne    80371c <devfile_read+0x3e>
+    return total_read;
+  803786:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80378a:	48 83 c4 18          	add    $0x18,%rsp
+  80378e:	5b                   	pop    %rbx
+  80378f:	41 5c                	pop    %r12
+  803791:	41 5d                	pop    %r13
+  803793:	41 5e                	pop    %r14
+  803795:	41 5f                	pop    %r15
+  803797:	5d                   	pop    %rbp
+  803798:	c3                   	ret
+    assert(fd);
+  803799:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  8037a0:	00 00 00 
+  8037a3:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037aa:	00 00 00 
+  8037ad:	be 91 00 00 00       	mov    $0x91,%esi
+  8037b2:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037b9:	00 00 00 
+  8037bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c1:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  8037c8:	00 00 00 
+  8037cb:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037ce:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  8037d5:	00 00 00 
+  8037d8:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037df:	00 00 00 
+  8037e2:	be 92 00 00 00       	mov    $0x92,%esi
+  8037e7:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037ee:	00 00 00 
+  8037f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f6:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  8037fd:	00 00 00 
+  803800:	41 ff d0             	call   *%r8
+            return res;
+  803803:	48 98                	cltq
+  803805:	eb 83                	jmp    80378a <devfile_read+0xac>
+        assert(res <= n);
+  803807:	48 b9 3d 62 80 00 00 	movabs $0x80623d,%rcx
+  80380e:	00 00 00 
+  803811:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803818:	00 00 00 
+  80381b:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803820:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803827:	00 00 00 
+  80382a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80382f:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  803836:	00 00 00 
+  803839:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80383c:	48 b9 48 62 80 00 00 	movabs $0x806248,%rcx
+  803843:	00 00 00 
+  803846:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80384d:	00 00 00 
+  803850:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803855:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80385c:	00 00 00 
+  80385f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803864:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  80386b:	00 00 00 
+  80386e:	41 ff d0             	call   *%r8
+
+0000000000803871 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803871:	55                   	push   %rbp
+  803872:	48 89 e5             	mov    %rsp,%rbp
+  803875:	41 57                	push   %r15
+  803877:	41 56                	push   %r14
+  803879:	41 55                	push   %r13
+  80387b:	41 54                	push   %r12
+  80387d:	53                   	push   %rbx
+  80387e:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803882:	48 85 ff             	test   %rdi,%rdi
+  803885:	0f 84 83 00 00 00    	je     80390e <devfile_write+0x9d>
+  80388b:	49 89 ff             	mov    %rdi,%r15
+  80388e:	49 89 f4             	mov    %rsi,%r12
+  803891:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803894:	48 85 f6             	test   %rsi,%rsi
+  803897:	0f 84 a6 00 00 00    	je     803943 <devfile_write+0xd2>
+    size_t total_written = 0;
+  80389d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038a3:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038aa:	00 00 00 
+  8038ad:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038b1:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038b4:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038b8:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038bd:	48 39 d3             	cmp    %rdx,%rbx
+  8038c0:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038c4:	4c 89 e6             	mov    %r12,%rsi
+  8038c7:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038ce:	00 00 00 
+  8038d1:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  8038d8:	00 00 00 
+  8038db:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8038e7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8038ec:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  8038f3:	00 00 00 
+  8038f6:	ff d0                	call   *%rax
+        if (res < 0) {
+  8038f8:	85 c0                	test   %eax,%eax
+  8038fa:	78 7c                	js     803978 <devfile_write+0x107>
+        total_written += res;
+  8038fc:	48 98                	cltq
+  8038fe:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803901:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803904:	48 29 c3             	sub    %rax,%rbx
+  803907:	75 a4                	jne    8038ad <devfile_write+0x3c>
+    return total_written;
+  803909:	4c 89 e8             	mov    %r13,%rax
+  80390c:	eb 6c                	jmp    80397a <devfile_write+0x109>
+    assert(fd);
+  80390e:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  803915:	00 00 00 
+  803918:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80391f:	00 00 00 
+  803922:	be bd 00 00 00       	mov    $0xbd,%esi
+  803927:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80392e:	00 00 00 
+  803931:	b8 00 00 00 00       	mov    $0x0,%eax
+  803936:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  80393d:	00 00 00 
+  803940:	41 ff d0             	call   *%r8
+    assert(buf);
+  803943:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  80394a:	00 00 00 
+  80394d:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803954:	00 00 00 
+  803957:	be be 00 00 00       	mov    $0xbe,%esi
+  80395c:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803963:	00 00 00 
+  803966:	b8 00 00 00 00       	mov    $0x0,%eax
+  80396b:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  803972:	00 00 00 
+  803975:	41 ff d0             	call   *%r8
+            return res;
+  803978:	48 98                	cltq
+}
+  80397a:	48 83 c4 08          	add    $0x8,%rsp
+  80397e:	5b                   	pop    %rbx
+  80397f:	41 5c                	pop    %r12
+  803981:	41 5d                	pop    %r13
+  803983:	41 5e                	pop    %r14
+  803985:	41 5f                	pop    %r15
+  803987:	5d                   	pop    %rbp
+  803988:	c3                   	ret
+
+0000000000803989 <open>:
+open(const char *path, int mode) {
+  803989:	55                   	push   %rbp
+  80398a:	48 89 e5             	mov    %rsp,%rbp
+  80398d:	41 55                	push   %r13
+  80398f:	41 54                	push   %r12
+  803991:	53                   	push   %rbx
+  803992:	48 83 ec 18          	sub    $0x18,%rsp
+  803996:	49 89 fc             	mov    %rdi,%r12
+  803999:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80399c:	48 b8 7f 1f 80 00 00 	movabs $0x801f7f,%rax
+  8039a3:	00 00 00 
+  8039a6:	ff d0                	call   *%rax
+  8039a8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039ae:	0f 87 8f 00 00 00    	ja     803a43 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039b4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039b8:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  8039bf:	00 00 00 
+  8039c2:	ff d0                	call   *%rax
+  8039c4:	89 c3                	mov    %eax,%ebx
+  8039c6:	85 c0                	test   %eax,%eax
+  8039c8:	78 55                	js     803a1f <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039ca:	4c 89 e6             	mov    %r12,%rsi
+  8039cd:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039d4:	00 00 00 
+  8039d7:	48 89 df             	mov    %rbx,%rdi
+  8039da:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  8039e1:	00 00 00 
+  8039e4:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039e6:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039f2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8039f6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8039fb:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  803a02:	00 00 00 
+  803a05:	ff d0                	call   *%rax
+  803a07:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a09:	85 c0                	test   %eax,%eax
+  803a0b:	78 1f                	js     803a2c <open+0xa3>
+    return fd2num(fd);
+  803a0d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a11:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  803a18:	00 00 00 
+  803a1b:	ff d0                	call   *%rax
+  803a1d:	89 c3                	mov    %eax,%ebx
+}
+  803a1f:	89 d8                	mov    %ebx,%eax
+  803a21:	48 83 c4 18          	add    $0x18,%rsp
+  803a25:	5b                   	pop    %rbx
+  803a26:	41 5c                	pop    %r12
+  803a28:	41 5d                	pop    %r13
+  803a2a:	5d                   	pop    %rbp
+  803a2b:	c3                   	ret
+        fd_close(fd, 0);
+  803a2c:	be 00 00 00 00       	mov    $0x0,%esi
+  803a31:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a35:	48 b8 c9 2e 80 00 00 	movabs $0x802ec9,%rax
+  803a3c:	00 00 00 
+  803a3f:	ff d0                	call   *%rax
+        return res;
+  803a41:	eb dc                	jmp    803a1f <open+0x96>
+        return -E_BAD_PATH;
+  803a43:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a48:	eb d5                	jmp    803a1f <open+0x96>
+
+0000000000803a4a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a4a:	55                   	push   %rbp
+  803a4b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a53:	be 00 00 00 00       	mov    $0x0,%esi
+  803a58:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a5d:	48 b8 f7 34 80 00 00 	movabs $0x8034f7,%rax
+  803a64:	00 00 00 
+  803a67:	ff d0                	call   *%rax
+}
+  803a69:	5d                   	pop    %rbp
+  803a6a:	c3                   	ret
+
+0000000000803a6b <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a6b:	55                   	push   %rbp
+  803a6c:	48 89 e5             	mov    %rsp,%rbp
+  803a6f:	41 56                	push   %r14
+  803a71:	41 55                	push   %r13
+  803a73:	41 54                	push   %r12
+  803a75:	53                   	push   %rbx
+  803a76:	48 83 ec 10          	sub    $0x10,%rsp
+  803a7a:	41 89 f6             	mov    %esi,%r14d
+  803a7d:	49 89 d4             	mov    %rdx,%r12
+  803a80:	48 89 cb             	mov    %rcx,%rbx
+  803a83:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a86:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a8a:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  803a91:	00 00 00 
+  803a94:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a96:	85 c0                	test   %eax,%eax
+  803a98:	78 46                	js     803ae0 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803a9a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a9e:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803aa5:	00 00 00 
+  803aa8:	8b 00                	mov    (%rax),%eax
+  803aaa:	39 02                	cmp    %eax,(%rdx)
+  803aac:	75 3f                	jne    803aed <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803aae:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ab5:	00 00 00 
+  803ab8:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803abb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803abd:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ac1:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ac5:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ac9:	48 89 da             	mov    %rbx,%rdx
+  803acc:	4c 89 e6             	mov    %r12,%rsi
+  803acf:	bf 09 00 00 00       	mov    $0x9,%edi
+  803ad4:	48 b8 f2 35 80 00 00 	movabs $0x8035f2,%rax
+  803adb:	00 00 00 
+  803ade:	ff d0                	call   *%rax
+}
+  803ae0:	48 83 c4 10          	add    $0x10,%rsp
+  803ae4:	5b                   	pop    %rbx
+  803ae5:	41 5c                	pop    %r12
+  803ae7:	41 5d                	pop    %r13
+  803ae9:	41 5e                	pop    %r14
+  803aeb:	5d                   	pop    %rbp
+  803aec:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803aed:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803af2:	eb ec                	jmp    803ae0 <file_map+0x75>
+
+0000000000803af4 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803af4:	55                   	push   %rbp
+  803af5:	48 89 e5             	mov    %rsp,%rbp
+  803af8:	41 54                	push   %r12
+  803afa:	53                   	push   %rbx
+  803afb:	48 83 ec 20          	sub    $0x20,%rsp
+  803aff:	41 89 f4             	mov    %esi,%r12d
+  803b02:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b05:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b09:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  803b10:	00 00 00 
+  803b13:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b15:	85 c0                	test   %eax,%eax
+  803b17:	78 3c                	js     803b55 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b1d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b24:	00 00 00 
+  803b27:	8b 0a                	mov    (%rdx),%ecx
+  803b29:	39 08                	cmp    %ecx,(%rax)
+  803b2b:	75 31                	jne    803b5e <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b2d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b30:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b33:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b37:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b3b:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b40:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b44:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b49:	48 b8 f7 34 80 00 00 	movabs $0x8034f7,%rax
+  803b50:	00 00 00 
+  803b53:	ff d0                	call   *%rax
+}
+  803b55:	48 83 c4 20          	add    $0x20,%rsp
+  803b59:	5b                   	pop    %rbx
+  803b5a:	41 5c                	pop    %r12
+  803b5c:	5d                   	pop    %rbp
+  803b5d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b5e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b63:	eb f0                	jmp    803b55 <file_msync+0x61>
+
+0000000000803b65 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b65:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b69:	7f 01                	jg     803b6c <writebuf+0x7>
+  803b6b:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b6c:	55                   	push   %rbp
+  803b6d:	48 89 e5             	mov    %rsp,%rbp
+  803b70:	53                   	push   %rbx
+  803b71:	48 83 ec 08          	sub    $0x8,%rsp
+  803b75:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b78:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b7c:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b80:	8b 3f                	mov    (%rdi),%edi
+  803b82:	48 b8 20 32 80 00 00 	movabs $0x803220,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803b8e:	48 85 c0             	test   %rax,%rax
+  803b91:	7e 04                	jle    803b97 <writebuf+0x32>
+  803b93:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803b97:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803b9b:	48 39 c2             	cmp    %rax,%rdx
+  803b9e:	74 0f                	je     803baf <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803ba0:	48 85 c0             	test   %rax,%rax
+  803ba3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ba8:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bac:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803baf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bb3:	c9                   	leave
+  803bb4:	c3                   	ret
+
+0000000000803bb5 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bb5:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bb8:	8d 50 01             	lea    0x1(%rax),%edx
+  803bbb:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bbe:	48 98                	cltq
+  803bc0:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bc5:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bcb:	74 01                	je     803bce <putch+0x19>
+  803bcd:	c3                   	ret
+putch(int ch, void *arg) {
+  803bce:	55                   	push   %rbp
+  803bcf:	48 89 e5             	mov    %rsp,%rbp
+  803bd2:	53                   	push   %rbx
+  803bd3:	48 83 ec 08          	sub    $0x8,%rsp
+  803bd7:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bda:	48 89 f7             	mov    %rsi,%rdi
+  803bdd:	48 b8 65 3b 80 00 00 	movabs $0x803b65,%rax
+  803be4:	00 00 00 
+  803be7:	ff d0                	call   *%rax
+        state->offset = 0;
+  803be9:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803bf0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bf4:	c9                   	leave
+  803bf5:	c3                   	ret
+
+0000000000803bf6 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803bf6:	55                   	push   %rbp
+  803bf7:	48 89 e5             	mov    %rsp,%rbp
+  803bfa:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c01:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c04:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c0a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c11:	00 00 00 
+    state.result = 0;
+  803c14:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c1b:	00 00 00 00 
+    state.error = 1;
+  803c1f:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c26:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c29:	48 89 f2             	mov    %rsi,%rdx
+  803c2c:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c33:	48 bf b5 3b 80 00 00 	movabs $0x803bb5,%rdi
+  803c3a:	00 00 00 
+  803c3d:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  803c44:	00 00 00 
+  803c47:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c49:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c50:	7f 14                	jg     803c66 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c52:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c59:	48 85 c0             	test   %rax,%rax
+  803c5c:	75 06                	jne    803c64 <vfprintf+0x6e>
+  803c5e:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c64:	c9                   	leave
+  803c65:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c66:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c6d:	48 b8 65 3b 80 00 00 	movabs $0x803b65,%rax
+  803c74:	00 00 00 
+  803c77:	ff d0                	call   *%rax
+  803c79:	eb d7                	jmp    803c52 <vfprintf+0x5c>
+
+0000000000803c7b <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c7b:	55                   	push   %rbp
+  803c7c:	48 89 e5             	mov    %rsp,%rbp
+  803c7f:	48 83 ec 50          	sub    $0x50,%rsp
+  803c83:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c87:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803c8b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c8f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803c93:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803c9a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ca2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ca6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803caa:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cae:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  803cb5:	00 00 00 
+  803cb8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cba:	c9                   	leave
+  803cbb:	c3                   	ret
+
+0000000000803cbc <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cbc:	55                   	push   %rbp
+  803cbd:	48 89 e5             	mov    %rsp,%rbp
+  803cc0:	48 83 ec 50          	sub    $0x50,%rsp
+  803cc4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cc8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ccc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cd0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cd4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cd8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cdf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ce3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ce7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ceb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803cef:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cf3:	48 89 fe             	mov    %rdi,%rsi
+  803cf6:	bf 01 00 00 00       	mov    $0x1,%edi
+  803cfb:	48 b8 f6 3b 80 00 00 	movabs $0x803bf6,%rax
+  803d02:	00 00 00 
+  803d05:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d07:	c9                   	leave
+  803d08:	c3                   	ret
+
+0000000000803d09 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d09:	55                   	push   %rbp
+  803d0a:	48 89 e5             	mov    %rsp,%rbp
+  803d0d:	41 54                	push   %r12
+  803d0f:	53                   	push   %rbx
+  803d10:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d13:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+  803d1f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d22:	48 be 70 62 80 00 00 	movabs $0x806270,%rsi
+  803d29:	00 00 00 
+  803d2c:	48 89 df             	mov    %rbx,%rdi
+  803d2f:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  803d36:	00 00 00 
+  803d39:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d3b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d40:	41 2b 04 24          	sub    (%r12),%eax
+  803d44:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d4a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d51:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d54:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d5b:	00 00 00 
+  803d5e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d6a:	5b                   	pop    %rbx
+  803d6b:	41 5c                	pop    %r12
+  803d6d:	5d                   	pop    %rbp
+  803d6e:	c3                   	ret
+
+0000000000803d6f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d6f:	55                   	push   %rbp
+  803d70:	48 89 e5             	mov    %rsp,%rbp
+  803d73:	41 54                	push   %r12
+  803d75:	53                   	push   %rbx
+  803d76:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d7e:	48 89 fe             	mov    %rdi,%rsi
+  803d81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d86:	49 bc fa 27 80 00 00 	movabs $0x8027fa,%r12
+  803d8d:	00 00 00 
+  803d90:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803d93:	48 89 df             	mov    %rbx,%rdi
+  803d96:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  803d9d:	00 00 00 
+  803da0:	ff d0                	call   *%rax
+  803da2:	48 89 c6             	mov    %rax,%rsi
+  803da5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803daa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803daf:	41 ff d4             	call   *%r12
+}
+  803db2:	5b                   	pop    %rbx
+  803db3:	41 5c                	pop    %r12
+  803db5:	5d                   	pop    %rbp
+  803db6:	c3                   	ret
+
+0000000000803db7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803db7:	55                   	push   %rbp
+  803db8:	48 89 e5             	mov    %rsp,%rbp
+  803dbb:	41 57                	push   %r15
+  803dbd:	41 56                	push   %r14
+  803dbf:	41 55                	push   %r13
+  803dc1:	41 54                	push   %r12
+  803dc3:	53                   	push   %rbx
+  803dc4:	48 83 ec 18          	sub    $0x18,%rsp
+  803dc8:	49 89 fc             	mov    %rdi,%r12
+  803dcb:	49 89 f5             	mov    %rsi,%r13
+  803dce:	49 89 d7             	mov    %rdx,%r15
+  803dd1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dd5:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  803ddc:	00 00 00 
+  803ddf:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803de1:	4d 85 ff             	test   %r15,%r15
+  803de4:	0f 84 af 00 00 00    	je     803e99 <devpipe_write+0xe2>
+  803dea:	48 89 c3             	mov    %rax,%rbx
+  803ded:	4c 89 f8             	mov    %r15,%rax
+  803df0:	4d 89 ef             	mov    %r13,%r15
+  803df3:	4c 01 e8             	add    %r13,%rax
+  803df6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dfa:	49 bd f0 26 80 00 00 	movabs $0x8026f0,%r13
+  803e01:	00 00 00 
+            sys_yield();
+  803e04:	49 be 81 26 80 00 00 	movabs $0x802681,%r14
+  803e0b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e0e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e11:	48 63 ce             	movslq %esi,%rcx
+  803e14:	48 63 03             	movslq (%rbx),%rax
+  803e17:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e1d:	48 39 c1             	cmp    %rax,%rcx
+  803e20:	72 2e                	jb     803e50 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e22:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e27:	48 89 da             	mov    %rbx,%rdx
+  803e2a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e2f:	4c 89 e7             	mov    %r12,%rdi
+  803e32:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e35:	85 c0                	test   %eax,%eax
+  803e37:	74 66                	je     803e9f <devpipe_write+0xe8>
+            sys_yield();
+  803e39:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e3c:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e3f:	48 63 ce             	movslq %esi,%rcx
+  803e42:	48 63 03             	movslq (%rbx),%rax
+  803e45:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e4b:	48 39 c1             	cmp    %rax,%rcx
+  803e4e:	73 d2                	jae    803e22 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e50:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e54:	48 89 ca             	mov    %rcx,%rdx
+  803e57:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e5b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e62:	08 10 20 
+  803e65:	48 f7 e2             	mul    %rdx
+  803e68:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e6c:	48 89 d0             	mov    %rdx,%rax
+  803e6f:	48 c1 e0 09          	shl    $0x9,%rax
+  803e73:	48 29 d0             	sub    %rdx,%rax
+  803e76:	48 c1 e0 03          	shl    $0x3,%rax
+  803e7a:	48 29 c1             	sub    %rax,%rcx
+  803e7d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e82:	83 c6 01             	add    $0x1,%esi
+  803e85:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e88:	49 83 c7 01          	add    $0x1,%r15
+  803e8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e90:	49 39 c7             	cmp    %rax,%r15
+  803e93:	0f 85 75 ff ff ff    	jne    803e0e <devpipe_write+0x57>
+    return n;
+  803e99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e9d:	eb 05                	jmp    803ea4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ea4:	48 83 c4 18          	add    $0x18,%rsp
+  803ea8:	5b                   	pop    %rbx
+  803ea9:	41 5c                	pop    %r12
+  803eab:	41 5d                	pop    %r13
+  803ead:	41 5e                	pop    %r14
+  803eaf:	41 5f                	pop    %r15
+  803eb1:	5d                   	pop    %rbp
+  803eb2:	c3                   	ret
+
+0000000000803eb3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803eb3:	55                   	push   %rbp
+  803eb4:	48 89 e5             	mov    %rsp,%rbp
+  803eb7:	41 57                	push   %r15
+  803eb9:	41 56                	push   %r14
+  803ebb:	41 55                	push   %r13
+  803ebd:	41 54                	push   %r12
+  803ebf:	53                   	push   %rbx
+  803ec0:	48 83 ec 18          	sub    $0x18,%rsp
+  803ec4:	49 89 fc             	mov    %rdi,%r12
+  803ec7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ecb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ecf:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  803ed6:	00 00 00 
+  803ed9:	ff d0                	call   *%rax
+  803edb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ede:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ee4:	49 bd f0 26 80 00 00 	movabs $0x8026f0,%r13
+  803eeb:	00 00 00 
+            sys_yield();
+  803eee:	49 be 81 26 80 00 00 	movabs $0x802681,%r14
+  803ef5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803ef8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803efd:	74 7d                	je     803f7c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803eff:	8b 03                	mov    (%rbx),%eax
+  803f01:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f04:	75 26                	jne    803f2c <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f06:	4d 85 ff             	test   %r15,%r15
+  803f09:	75 77                	jne    803f82 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f0b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f10:	48 89 da             	mov    %rbx,%rdx
+  803f13:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f18:	4c 89 e7             	mov    %r12,%rdi
+  803f1b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f1e:	85 c0                	test   %eax,%eax
+  803f20:	74 72                	je     803f94 <devpipe_read+0xe1>
+            sys_yield();
+  803f22:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f25:	8b 03                	mov    (%rbx),%eax
+  803f27:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f2a:	74 df                	je     803f0b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f2c:	48 63 c8             	movslq %eax,%rcx
+  803f2f:	48 89 ca             	mov    %rcx,%rdx
+  803f32:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f36:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f3d:	08 10 20 
+  803f40:	48 89 d0             	mov    %rdx,%rax
+  803f43:	48 f7 e6             	mul    %rsi
+  803f46:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f4a:	48 89 d0             	mov    %rdx,%rax
+  803f4d:	48 c1 e0 09          	shl    $0x9,%rax
+  803f51:	48 29 d0             	sub    %rdx,%rax
+  803f54:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f5b:	00 
+  803f5c:	48 89 c8             	mov    %rcx,%rax
+  803f5f:	48 29 d0             	sub    %rdx,%rax
+  803f62:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f67:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f6b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f6f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f72:	49 83 c7 01          	add    $0x1,%r15
+  803f76:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f7a:	75 83                	jne    803eff <devpipe_read+0x4c>
+    return n;
+  803f7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f80:	eb 03                	jmp    803f85 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f82:	4c 89 f8             	mov    %r15,%rax
+}
+  803f85:	48 83 c4 18          	add    $0x18,%rsp
+  803f89:	5b                   	pop    %rbx
+  803f8a:	41 5c                	pop    %r12
+  803f8c:	41 5d                	pop    %r13
+  803f8e:	41 5e                	pop    %r14
+  803f90:	41 5f                	pop    %r15
+  803f92:	5d                   	pop    %rbp
+  803f93:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f99:	eb ea                	jmp    803f85 <devpipe_read+0xd2>
+
+0000000000803f9b <pipe>:
+pipe(int pfd[2]) {
+  803f9b:	55                   	push   %rbp
+  803f9c:	48 89 e5             	mov    %rsp,%rbp
+  803f9f:	41 55                	push   %r13
+  803fa1:	41 54                	push   %r12
+  803fa3:	53                   	push   %rbx
+  803fa4:	48 83 ec 18          	sub    $0x18,%rsp
+  803fa8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fab:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803faf:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803fb6:	00 00 00 
+  803fb9:	ff d0                	call   *%rax
+  803fbb:	89 c3                	mov    %eax,%ebx
+  803fbd:	85 c0                	test   %eax,%eax
+  803fbf:	0f 88 a0 01 00 00    	js     804165 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fc5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fcf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd8:	48 b8 22 27 80 00 00 	movabs $0x802722,%rax
+  803fdf:	00 00 00 
+  803fe2:	ff d0                	call   *%rax
+  803fe4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fe6:	85 c0                	test   %eax,%eax
+  803fe8:	0f 88 77 01 00 00    	js     804165 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fee:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ff2:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803ff9:	00 00 00 
+  803ffc:	ff d0                	call   *%rax
+  803ffe:	89 c3                	mov    %eax,%ebx
+  804000:	85 c0                	test   %eax,%eax
+  804002:	0f 88 43 01 00 00    	js     80414b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804008:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80400d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804012:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804016:	bf 00 00 00 00       	mov    $0x0,%edi
+  80401b:	48 b8 22 27 80 00 00 	movabs $0x802722,%rax
+  804022:	00 00 00 
+  804025:	ff d0                	call   *%rax
+  804027:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804029:	85 c0                	test   %eax,%eax
+  80402b:	0f 88 1a 01 00 00    	js     80414b <pipe+0x1b0>
+    va = fd2data(fd0);
+  804031:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804035:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  80403c:	00 00 00 
+  80403f:	ff d0                	call   *%rax
+  804041:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804044:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804049:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80404e:	48 89 c6             	mov    %rax,%rsi
+  804051:	bf 00 00 00 00       	mov    $0x0,%edi
+  804056:	48 b8 22 27 80 00 00 	movabs $0x802722,%rax
+  80405d:	00 00 00 
+  804060:	ff d0                	call   *%rax
+  804062:	89 c3                	mov    %eax,%ebx
+  804064:	85 c0                	test   %eax,%eax
+  804066:	0f 88 c5 00 00 00    	js     804131 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80406c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804070:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  804077:	00 00 00 
+  80407a:	ff d0                	call   *%rax
+  80407c:	48 89 c1             	mov    %rax,%rcx
+  80407f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804085:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80408b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804090:	4c 89 ee             	mov    %r13,%rsi
+  804093:	bf 00 00 00 00       	mov    $0x0,%edi
+  804098:	48 b8 8f 27 80 00 00 	movabs $0x80278f,%rax
+  80409f:	00 00 00 
+  8040a2:	ff d0                	call   *%rax
+  8040a4:	89 c3                	mov    %eax,%ebx
+  8040a6:	85 c0                	test   %eax,%eax
+  8040a8:	78 6e                	js     804118 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040aa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040af:	4c 89 ef             	mov    %r13,%rdi
+  8040b2:	48 b8 b8 26 80 00 00 	movabs $0x8026b8,%rax
+  8040b9:	00 00 00 
+  8040bc:	ff d0                	call   *%rax
+  8040be:	83 f8 02             	cmp    $0x2,%eax
+  8040c1:	0f 85 ab 00 00 00    	jne    804172 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040c7:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040ce:	00 00 
+  8040d0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040d4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040da:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040e1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040e5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040eb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040f2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040f6:	48 bb 80 2d 80 00 00 	movabs $0x802d80,%rbx
+  8040fd:	00 00 00 
+  804100:	ff d3                	call   *%rbx
+  804102:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804106:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80410a:	ff d3                	call   *%rbx
+  80410c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804111:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804116:	eb 4d                	jmp    804165 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804118:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80411d:	4c 89 ee             	mov    %r13,%rsi
+  804120:	bf 00 00 00 00       	mov    $0x0,%edi
+  804125:	48 b8 fa 27 80 00 00 	movabs $0x8027fa,%rax
+  80412c:	00 00 00 
+  80412f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804131:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804136:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80413a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413f:	48 b8 fa 27 80 00 00 	movabs $0x8027fa,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80414b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804150:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804154:	bf 00 00 00 00       	mov    $0x0,%edi
+  804159:	48 b8 fa 27 80 00 00 	movabs $0x8027fa,%rax
+  804160:	00 00 00 
+  804163:	ff d0                	call   *%rax
+}
+  804165:	89 d8                	mov    %ebx,%eax
+  804167:	48 83 c4 18          	add    $0x18,%rsp
+  80416b:	5b                   	pop    %rbx
+  80416c:	41 5c                	pop    %r12
+  80416e:	41 5d                	pop    %r13
+  804170:	5d                   	pop    %rbp
+  804171:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804172:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  804179:	00 00 00 
+  80417c:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804183:	00 00 00 
+  804186:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80418b:	48 bf 77 62 80 00 00 	movabs $0x806277,%rdi
+  804192:	00 00 00 
+  804195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419a:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  8041a1:	00 00 00 
+  8041a4:	41 ff d0             	call   *%r8
+
+00000000008041a7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041a7:	55                   	push   %rbp
+  8041a8:	48 89 e5             	mov    %rsp,%rbp
+  8041ab:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041af:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041b3:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  8041ba:	00 00 00 
+  8041bd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041bf:	85 c0                	test   %eax,%eax
+  8041c1:	78 35                	js     8041f8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041c3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041c7:	48 b8 92 2d 80 00 00 	movabs $0x802d92,%rax
+  8041ce:	00 00 00 
+  8041d1:	ff d0                	call   *%rax
+  8041d3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041d6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041e0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e4:	48 b8 f0 26 80 00 00 	movabs $0x8026f0,%rax
+  8041eb:	00 00 00 
+  8041ee:	ff d0                	call   *%rax
+  8041f0:	85 c0                	test   %eax,%eax
+  8041f2:	0f 94 c0             	sete   %al
+  8041f5:	0f b6 c0             	movzbl %al,%eax
+}
+  8041f8:	c9                   	leave
+  8041f9:	c3                   	ret
+
+00000000008041fa <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8041fa:	48 89 f8             	mov    %rdi,%rax
+  8041fd:	48 c1 e8 27          	shr    $0x27,%rax
+  804201:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804208:	01 00 00 
+  80420b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80420f:	f6 c2 01             	test   $0x1,%dl
+  804212:	74 6d                	je     804281 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804214:	48 89 f8             	mov    %rdi,%rax
+  804217:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80421b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804222:	01 00 00 
+  804225:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804229:	f6 c2 01             	test   $0x1,%dl
+  80422c:	74 62                	je     804290 <get_uvpt_entry+0x96>
+  80422e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804235:	01 00 00 
+  804238:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80423c:	f6 c2 80             	test   $0x80,%dl
+  80423f:	75 4f                	jne    804290 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804241:	48 89 f8             	mov    %rdi,%rax
+  804244:	48 c1 e8 15          	shr    $0x15,%rax
+  804248:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80424f:	01 00 00 
+  804252:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804256:	f6 c2 01             	test   $0x1,%dl
+  804259:	74 44                	je     80429f <get_uvpt_entry+0xa5>
+  80425b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804262:	01 00 00 
+  804265:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804269:	f6 c2 80             	test   $0x80,%dl
+  80426c:	75 31                	jne    80429f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80426e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804272:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804279:	01 00 00 
+  80427c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804280:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804281:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804288:	01 00 00 
+  80428b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80428f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804290:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804297:	01 00 00 
+  80429a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80429e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80429f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042a6:	01 00 00 
+  8042a9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ad:	c3                   	ret
+
+00000000008042ae <get_prot>:
+
+int
+get_prot(void *va) {
+  8042ae:	55                   	push   %rbp
+  8042af:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042b2:	48 b8 fa 41 80 00 00 	movabs $0x8041fa,%rax
+  8042b9:	00 00 00 
+  8042bc:	ff d0                	call   *%rax
+  8042be:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042c1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042c6:	89 c1                	mov    %eax,%ecx
+  8042c8:	83 c9 04             	or     $0x4,%ecx
+  8042cb:	f6 c2 01             	test   $0x1,%dl
+  8042ce:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042d1:	89 c1                	mov    %eax,%ecx
+  8042d3:	83 c9 02             	or     $0x2,%ecx
+  8042d6:	f6 c2 02             	test   $0x2,%dl
+  8042d9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042dc:	89 c1                	mov    %eax,%ecx
+  8042de:	83 c9 01             	or     $0x1,%ecx
+  8042e1:	48 85 d2             	test   %rdx,%rdx
+  8042e4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042e7:	89 c1                	mov    %eax,%ecx
+  8042e9:	83 c9 40             	or     $0x40,%ecx
+  8042ec:	f6 c6 04             	test   $0x4,%dh
+  8042ef:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8042f2:	5d                   	pop    %rbp
+  8042f3:	c3                   	ret
+
+00000000008042f4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8042f4:	55                   	push   %rbp
+  8042f5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042f8:	48 b8 fa 41 80 00 00 	movabs $0x8041fa,%rax
+  8042ff:	00 00 00 
+  804302:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804304:	48 c1 e8 06          	shr    $0x6,%rax
+  804308:	83 e0 01             	and    $0x1,%eax
+}
+  80430b:	5d                   	pop    %rbp
+  80430c:	c3                   	ret
+
+000000000080430d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80430d:	55                   	push   %rbp
+  80430e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804311:	48 b8 fa 41 80 00 00 	movabs $0x8041fa,%rax
+  804318:	00 00 00 
+  80431b:	ff d0                	call   *%rax
+  80431d:	83 e0 01             	and    $0x1,%eax
+}
+  804320:	5d                   	pop    %rbp
+  804321:	c3                   	ret
+
+0000000000804322 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804322:	55                   	push   %rbp
+  804323:	48 89 e5             	mov    %rsp,%rbp
+  804326:	41 57                	push   %r15
+  804328:	41 56                	push   %r14
+  80432a:	41 55                	push   %r13
+  80432c:	41 54                	push   %r12
+  80432e:	53                   	push   %rbx
+  80432f:	48 83 ec 28          	sub    $0x28,%rsp
+  804333:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804337:	48 85 ff             	test   %rdi,%rdi
+  80433a:	74 1e                	je     80435a <foreach_shared_region+0x38>
+  80433c:	49 89 ff             	mov    %rdi,%r15
+  80433f:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804345:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80434b:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804352:	01 00 00 
+  804355:	e9 72 02 00 00       	jmp    8045cc <foreach_shared_region+0x2aa>
+    assert(fun);
+  80435a:	48 b9 ac 62 80 00 00 	movabs $0x8062ac,%rcx
+  804361:	00 00 00 
+  804364:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80436b:	00 00 00 
+  80436e:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804373:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  80437a:	00 00 00 
+  80437d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804382:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  804389:	00 00 00 
+  80438c:	41 ff d0             	call   *%r8
+  80438f:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804396:	eb 6c                	jmp    804404 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804398:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80439f:	ff ff ff 
+  8043a2:	4c 21 e2             	and    %r12,%rdx
+  8043a5:	48 89 d8             	mov    %rbx,%rax
+  8043a8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043ad:	48 83 c0 01          	add    $0x1,%rax
+  8043b1:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043b5:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043bc:	00 00 00 
+  8043bf:	48 21 c8             	and    %rcx,%rax
+  8043c2:	48 09 d0             	or     %rdx,%rax
+  8043c5:	49 89 c4             	mov    %rax,%r12
+  8043c8:	eb 30                	jmp    8043fa <foreach_shared_region+0xd8>
+  8043ca:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043d1:	ff ff ff 
+  8043d4:	4c 21 e2             	and    %r12,%rdx
+  8043d7:	48 89 d8             	mov    %rbx,%rax
+  8043da:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043df:	48 83 c0 01          	add    $0x1,%rax
+  8043e3:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043e7:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043ee:	00 00 00 
+  8043f1:	48 21 c8             	and    %rcx,%rax
+  8043f4:	48 09 d0             	or     %rdx,%rax
+  8043f7:	49 89 c4             	mov    %rax,%r12
+  8043fa:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8043fe:	0f 84 99 01 00 00    	je     80459d <foreach_shared_region+0x27b>
+  804404:	4c 89 e3             	mov    %r12,%rbx
+  804407:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80440b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804412:	01 00 00 
+  804415:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804419:	a8 01                	test   $0x1,%al
+  80441b:	0f 84 77 ff ff ff    	je     804398 <foreach_shared_region+0x76>
+  804421:	a8 80                	test   $0x80,%al
+  804423:	74 19                	je     80443e <foreach_shared_region+0x11c>
+  804425:	f6 c4 04             	test   $0x4,%ah
+  804428:	74 a0                	je     8043ca <foreach_shared_region+0xa8>
+  80442a:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804431:	40 
+  804432:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804436:	4c 89 e7             	mov    %r12,%rdi
+  804439:	41 ff d7             	call   *%r15
+  80443c:	eb 8c                	jmp    8043ca <foreach_shared_region+0xa8>
+  80443e:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804445:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804449:	eb 46                	jmp    804491 <foreach_shared_region+0x16f>
+  80444b:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804452:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804458:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80445c:	48 c1 e0 15          	shl    $0x15,%rax
+  804460:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804465:	49 09 c4             	or     %rax,%r12
+  804468:	eb 1d                	jmp    804487 <foreach_shared_region+0x165>
+  80446a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804471:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804477:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80447b:	48 c1 e0 15          	shl    $0x15,%rax
+  80447f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804484:	49 09 c4             	or     %rax,%r12
+  804487:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80448b:	0f 84 d3 00 00 00    	je     804564 <foreach_shared_region+0x242>
+  804491:	4c 89 e3             	mov    %r12,%rbx
+  804494:	48 c1 eb 15          	shr    $0x15,%rbx
+  804498:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80449f:	01 00 00 
+  8044a2:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044a6:	a8 01                	test   $0x1,%al
+  8044a8:	74 a1                	je     80444b <foreach_shared_region+0x129>
+  8044aa:	a8 80                	test   $0x80,%al
+  8044ac:	74 19                	je     8044c7 <foreach_shared_region+0x1a5>
+  8044ae:	f6 c4 04             	test   $0x4,%ah
+  8044b1:	74 b7                	je     80446a <foreach_shared_region+0x148>
+  8044b3:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044ba:	00 
+  8044bb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044bf:	4c 89 e7             	mov    %r12,%rdi
+  8044c2:	41 ff d7             	call   *%r15
+  8044c5:	eb a3                	jmp    80446a <foreach_shared_region+0x148>
+  8044c7:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044cd:	eb 3b                	jmp    80450a <foreach_shared_region+0x1e8>
+  8044cf:	f6 c4 04             	test   $0x4,%ah
+  8044d2:	74 12                	je     8044e6 <foreach_shared_region+0x1c4>
+  8044d4:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044db:	00 
+  8044dc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044e0:	4c 89 e7             	mov    %r12,%rdi
+  8044e3:	41 ff d7             	call   *%r15
+  8044e6:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8044ed:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044f3:	48 83 c3 01          	add    $0x1,%rbx
+  8044f7:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8044fb:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804501:	49 09 dc             	or     %rbx,%r12
+  804504:	41 83 ed 01          	sub    $0x1,%r13d
+  804508:	74 2f                	je     804539 <foreach_shared_region+0x217>
+  80450a:	4c 89 e3             	mov    %r12,%rbx
+  80450d:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804511:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804515:	a8 01                	test   $0x1,%al
+  804517:	75 b6                	jne    8044cf <foreach_shared_region+0x1ad>
+  804519:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804520:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804526:	48 83 c3 01          	add    $0x1,%rbx
+  80452a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80452e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804534:	49 09 dc             	or     %rbx,%r12
+  804537:	eb cb                	jmp    804504 <foreach_shared_region+0x1e2>
+  804539:	4c 89 e0             	mov    %r12,%rax
+  80453c:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804542:	49 c1 ec 15          	shr    $0x15,%r12
+  804546:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80454d:	49 83 c4 01          	add    $0x1,%r12
+  804551:	49 c1 e4 15          	shl    $0x15,%r12
+  804555:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80455c:	49 09 c4             	or     %rax,%r12
+  80455f:	e9 23 ff ff ff       	jmp    804487 <foreach_shared_region+0x165>
+  804564:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804568:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80456f:	ff ff ff 
+  804572:	4c 21 e0             	and    %r12,%rax
+  804575:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804579:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804580:	49 83 c4 01          	add    $0x1,%r12
+  804584:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804588:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  80458f:	00 00 00 
+  804592:	49 21 d4             	and    %rdx,%r12
+  804595:	49 09 c4             	or     %rax,%r12
+  804598:	e9 5d fe ff ff       	jmp    8043fa <foreach_shared_region+0xd8>
+  80459d:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045a4:	00 ff ff 
+  8045a7:	4c 21 e0             	and    %r12,%rax
+  8045aa:	49 c1 ec 27          	shr    $0x27,%r12
+  8045ae:	49 83 c4 01          	add    $0x1,%r12
+  8045b2:	49 c1 e4 27          	shl    $0x27,%r12
+  8045b6:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045bd:	ff 00 00 
+  8045c0:	49 21 d4             	and    %rdx,%r12
+  8045c3:	49 09 c4             	or     %rax,%r12
+  8045c6:	41 83 ed 01          	sub    $0x1,%r13d
+  8045ca:	74 48                	je     804614 <foreach_shared_region+0x2f2>
+  8045cc:	4c 89 e0             	mov    %r12,%rax
+  8045cf:	48 c1 e8 27          	shr    $0x27,%rax
+  8045d3:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045da:	01 00 00 
+  8045dd:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045e1:	f6 c2 01             	test   $0x1,%dl
+  8045e4:	0f 85 a5 fd ff ff    	jne    80438f <foreach_shared_region+0x6d>
+  8045ea:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8045f1:	00 ff ff 
+  8045f4:	4c 21 e2             	and    %r12,%rdx
+  8045f7:	48 83 c0 01          	add    $0x1,%rax
+  8045fb:	48 c1 e0 27          	shl    $0x27,%rax
+  8045ff:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804606:	ff 00 00 
+  804609:	48 21 c8             	and    %rcx,%rax
+  80460c:	48 09 d0             	or     %rdx,%rax
+  80460f:	49 89 c4             	mov    %rax,%r12
+  804612:	eb b2                	jmp    8045c6 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804614:	4d 85 e4             	test   %r12,%r12
+  804617:	75 14                	jne    80462d <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80461e:	48 83 c4 28          	add    $0x28,%rsp
+  804622:	5b                   	pop    %rbx
+  804623:	41 5c                	pop    %r12
+  804625:	41 5d                	pop    %r13
+  804627:	41 5e                	pop    %r14
+  804629:	41 5f                	pop    %r15
+  80462b:	5d                   	pop    %rbp
+  80462c:	c3                   	ret
+    assert(addr == 0);
+  80462d:	48 b9 bb 62 80 00 00 	movabs $0x8062bb,%rcx
+  804634:	00 00 00 
+  804637:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80463e:	00 00 00 
+  804641:	be 67 00 00 00       	mov    $0x67,%esi
+  804646:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  80464d:	00 00 00 
+  804650:	b8 00 00 00 00       	mov    $0x0,%eax
+  804655:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  80465c:	00 00 00 
+  80465f:	41 ff d0             	call   *%r8
+
+0000000000804662 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804662:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804669:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80466c:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804672:	eb 33                	jmp    8046a7 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804674:	48 83 c0 20          	add    $0x20,%rax
+  804678:	4c 39 c0             	cmp    %r8,%rax
+  80467b:	74 25                	je     8046a2 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80467d:	48 8b 10             	mov    (%rax),%rdx
+  804680:	48 85 d2             	test   %rdx,%rdx
+  804683:	74 ef                	je     804674 <mmap_place+0x12>
+  804685:	48 89 d1             	mov    %rdx,%rcx
+  804688:	48 03 48 08          	add    0x8(%rax),%rcx
+  80468c:	48 39 cf             	cmp    %rcx,%rdi
+  80468f:	73 e3                	jae    804674 <mmap_place+0x12>
+  804691:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804695:	4c 39 ca             	cmp    %r9,%rdx
+  804698:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  80469c:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046a0:	eb d2                	jmp    804674 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046a2:	45 84 d2             	test   %r10b,%r10b
+  8046a5:	74 12                	je     8046b9 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046a7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046ae:	00 00 00 
+        moved = 0;
+  8046b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046b7:	eb c4                	jmp    80467d <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046b9:	48 01 fe             	add    %rdi,%rsi
+  8046bc:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046c3:	00 00 00 
+  8046c6:	48 39 f0             	cmp    %rsi,%rax
+  8046c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ce:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046d2:	c3                   	ret
+
+00000000008046d3 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046d3:	55                   	push   %rbp
+  8046d4:	48 89 e5             	mov    %rsp,%rbp
+  8046d7:	41 57                	push   %r15
+  8046d9:	41 56                	push   %r14
+  8046db:	41 55                	push   %r13
+  8046dd:	41 54                	push   %r12
+  8046df:	53                   	push   %rbx
+  8046e0:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046e4:	48 8b 1f             	mov    (%rdi),%rbx
+  8046e7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046ee:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046f5:	00 00 00 
+  8046f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046fd:	eb 12                	jmp    804711 <mmap_pgfault+0x3e>
+  8046ff:	48 83 c2 01          	add    $0x1,%rdx
+  804703:	48 83 c0 20          	add    $0x20,%rax
+  804707:	48 83 fa 20          	cmp    $0x20,%rdx
+  80470b:	0f 84 04 01 00 00    	je     804815 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804711:	48 8b 08             	mov    (%rax),%rcx
+  804714:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804718:	48 39 de             	cmp    %rbx,%rsi
+  80471b:	73 e2                	jae    8046ff <mmap_pgfault+0x2c>
+  80471d:	48 03 48 08          	add    0x8(%rax),%rcx
+  804721:	48 39 cb             	cmp    %rcx,%rbx
+  804724:	73 d9                	jae    8046ff <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804726:	48 c1 e2 05          	shl    $0x5,%rdx
+  80472a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804731:	00 00 00 
+  804734:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804738:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80473c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804740:	f6 c2 01             	test   $0x1,%dl
+  804743:	0f 84 e0 00 00 00    	je     804829 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80474e:	f6 c2 02             	test   $0x2,%dl
+  804751:	0f 84 c3 00 00 00    	je     80481a <mmap_pgfault+0x147>
+  804757:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80475e:	ff ff ff 
+  804761:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804765:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80476c:	00 00 00 
+  80476f:	48 39 ca             	cmp    %rcx,%rdx
+  804772:	0f 85 a2 00 00 00    	jne    80481a <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804778:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80477d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804782:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804789:	00 00 00 
+  80478c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804791:	48 b8 22 27 80 00 00 	movabs $0x802722,%rax
+  804798:	00 00 00 
+  80479b:	ff d0                	call   *%rax
+  80479d:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  80479f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a4:	85 d2                	test   %edx,%edx
+  8047a6:	78 72                	js     80481a <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ad:	48 89 de             	mov    %rbx,%rsi
+  8047b0:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047b7:	00 00 00 
+  8047ba:	4c 89 e7             	mov    %r12,%rdi
+  8047bd:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  8047c4:	00 00 00 
+  8047c7:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047c9:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047cf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047d5:	48 89 d9             	mov    %rbx,%rcx
+  8047d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047dd:	4c 89 e6             	mov    %r12,%rsi
+  8047e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047e5:	48 b8 8f 27 80 00 00 	movabs $0x80278f,%rax
+  8047ec:	00 00 00 
+  8047ef:	ff d0                	call   *%rax
+  8047f1:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8047f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047f8:	4c 89 e6             	mov    %r12,%rsi
+  8047fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804800:	48 b8 fa 27 80 00 00 	movabs $0x8027fa,%rax
+  804807:	00 00 00 
+  80480a:	ff d0                	call   *%rax
+    return res >= 0;
+  80480c:	89 d8                	mov    %ebx,%eax
+  80480e:	f7 d0                	not    %eax
+  804810:	c1 e8 1f             	shr    $0x1f,%eax
+  804813:	eb 05                	jmp    80481a <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804815:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80481a:	48 83 c4 18          	add    $0x18,%rsp
+  80481e:	5b                   	pop    %rbx
+  80481f:	41 5c                	pop    %r12
+  804821:	41 5d                	pop    %r13
+  804823:	41 5e                	pop    %r14
+  804825:	41 5f                	pop    %r15
+  804827:	5d                   	pop    %rbp
+  804828:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804829:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80482d:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804831:	4c 03 30             	add    (%rax),%r14
+  804834:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80483b:	49 39 c6             	cmp    %rax,%r14
+  80483e:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804842:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804849:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80484f:	49 bf 0d 43 80 00 00 	movabs $0x80430d,%r15
+  804856:	00 00 00 
+  804859:	4d 39 f4             	cmp    %r14,%r12
+  80485c:	73 1d                	jae    80487b <mmap_pgfault+0x1a8>
+  80485e:	4c 89 e7             	mov    %r12,%rdi
+  804861:	41 ff d7             	call   *%r15
+  804864:	84 c0                	test   %al,%al
+  804866:	75 13                	jne    80487b <mmap_pgfault+0x1a8>
+  804868:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80486f:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804876:	4d 39 f4             	cmp    %r14,%r12
+  804879:	72 e3                	jb     80485e <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80487b:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804881:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804885:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804889:	74 2a                	je     8048b5 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80488b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80488f:	89 de                	mov    %ebx,%esi
+  804891:	2b 30                	sub    (%rax),%esi
+  804893:	03 70 1c             	add    0x1c(%rax),%esi
+  804896:	8b 78 18             	mov    0x18(%rax),%edi
+  804899:	4c 89 e9             	mov    %r13,%rcx
+  80489c:	48 89 da             	mov    %rbx,%rdx
+  80489f:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  8048a6:	00 00 00 
+  8048a9:	ff d0                	call   *%rax
+    return res > 0;
+  8048ab:	85 c0                	test   %eax,%eax
+  8048ad:	0f 9f c0             	setg   %al
+  8048b0:	e9 65 ff ff ff       	jmp    80481a <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048b5:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048b9:	eb d0                	jmp    80488b <mmap_pgfault+0x1b8>
+
+00000000008048bb <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048bb:	55                   	push   %rbp
+  8048bc:	48 89 e5             	mov    %rsp,%rbp
+  8048bf:	41 57                	push   %r15
+  8048c1:	41 56                	push   %r14
+  8048c3:	41 55                	push   %r13
+  8048c5:	41 54                	push   %r12
+  8048c7:	53                   	push   %rbx
+  8048c8:	48 83 ec 28          	sub    $0x28,%rsp
+  8048cc:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048d0:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048d3:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048da:	ff ff ff 
+  8048dd:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048e6:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8048ed:	00 00 00 
+  8048f0:	48 39 ca             	cmp    %rcx,%rdx
+  8048f3:	0f 85 e5 00 00 00    	jne    8049de <mmap_writeback+0x123>
+  8048f9:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8048fc:	4c 39 ee             	cmp    %r13,%rsi
+  8048ff:	0f 83 e8 00 00 00    	jae    8049ed <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804905:	49 be 0d 43 80 00 00 	movabs $0x80430d,%r14
+  80490c:	00 00 00 
+  80490f:	49 bf f4 42 80 00 00 	movabs $0x8042f4,%r15
+  804916:	00 00 00 
+  804919:	eb 10                	jmp    80492b <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80491b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804922:	4d 39 ec             	cmp    %r13,%r12
+  804925:	0f 83 ae 00 00 00    	jae    8049d9 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80492b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80492f:	4c 89 e7             	mov    %r12,%rdi
+  804932:	41 ff d6             	call   *%r14
+  804935:	84 c0                	test   %al,%al
+  804937:	74 e2                	je     80491b <mmap_writeback+0x60>
+  804939:	4c 89 e7             	mov    %r12,%rdi
+  80493c:	41 ff d7             	call   *%r15
+  80493f:	84 c0                	test   %al,%al
+  804941:	74 d8                	je     80491b <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804943:	4c 89 e3             	mov    %r12,%rbx
+  804946:	4d 39 ec             	cmp    %r13,%r12
+  804949:	73 20                	jae    80496b <mmap_writeback+0xb0>
+  80494b:	48 89 df             	mov    %rbx,%rdi
+  80494e:	41 ff d6             	call   *%r14
+  804951:	84 c0                	test   %al,%al
+  804953:	74 16                	je     80496b <mmap_writeback+0xb0>
+  804955:	48 89 df             	mov    %rbx,%rdi
+  804958:	41 ff d7             	call   *%r15
+  80495b:	84 c0                	test   %al,%al
+  80495d:	74 0c                	je     80496b <mmap_writeback+0xb0>
+  80495f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804966:	4c 39 eb             	cmp    %r13,%rbx
+  804969:	72 e0                	jb     80494b <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80496b:	48 89 d9             	mov    %rbx,%rcx
+  80496e:	4c 29 e1             	sub    %r12,%rcx
+  804971:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804975:	44 89 e6             	mov    %r12d,%esi
+  804978:	2b 30                	sub    (%rax),%esi
+  80497a:	49 89 c4             	mov    %rax,%r12
+  80497d:	03 70 1c             	add    0x1c(%rax),%esi
+  804980:	8b 78 18             	mov    0x18(%rax),%edi
+  804983:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804987:	48 89 ca             	mov    %rcx,%rdx
+  80498a:	48 b8 f4 3a 80 00 00 	movabs $0x803af4,%rax
+  804991:	00 00 00 
+  804994:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804996:	85 c0                	test   %eax,%eax
+  804998:	78 44                	js     8049de <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  80499a:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80499f:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049a2:	41 89 c1             	mov    %eax,%r9d
+  8049a5:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049ac:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049b0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049b9:	48 89 ce             	mov    %rcx,%rsi
+  8049bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049c1:	48 b8 8f 27 80 00 00 	movabs $0x80278f,%rax
+  8049c8:	00 00 00 
+  8049cb:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049cd:	85 c0                	test   %eax,%eax
+  8049cf:	78 0d                	js     8049de <mmap_writeback+0x123>
+  8049d1:	49 89 dc             	mov    %rbx,%r12
+  8049d4:	e9 49 ff ff ff       	jmp    804922 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049de:	48 83 c4 28          	add    $0x28,%rsp
+  8049e2:	5b                   	pop    %rbx
+  8049e3:	41 5c                	pop    %r12
+  8049e5:	41 5d                	pop    %r13
+  8049e7:	41 5e                	pop    %r14
+  8049e9:	41 5f                	pop    %r15
+  8049eb:	5d                   	pop    %rbp
+  8049ec:	c3                   	ret
+    return 0;
+  8049ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f2:	eb ea                	jmp    8049de <mmap_writeback+0x123>
+
+00000000008049f4 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8049f4:	55                   	push   %rbp
+  8049f5:	48 89 e5             	mov    %rsp,%rbp
+  8049f8:	41 57                	push   %r15
+  8049fa:	41 56                	push   %r14
+  8049fc:	41 55                	push   %r13
+  8049fe:	41 54                	push   %r12
+  804a00:	53                   	push   %rbx
+  804a01:	48 83 ec 38          	sub    $0x38,%rsp
+  804a05:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a09:	48 85 f6             	test   %rsi,%rsi
+  804a0c:	0f 84 0c 02 00 00    	je     804c1e <mmap+0x22a>
+  804a12:	49 89 ff             	mov    %rdi,%r15
+  804a15:	49 89 f4             	mov    %rsi,%r12
+  804a18:	41 89 d5             	mov    %edx,%r13d
+  804a1b:	41 89 ce             	mov    %ecx,%r14d
+  804a1e:	44 89 cb             	mov    %r9d,%ebx
+  804a21:	45 85 c9             	test   %r9d,%r9d
+  804a24:	0f 88 f4 01 00 00    	js     804c1e <mmap+0x22a>
+  804a2a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a31:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a38:	0f 85 e7 01 00 00    	jne    804c25 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a3e:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a41:	83 fa 04             	cmp    $0x4,%edx
+  804a44:	0f 85 db 01 00 00    	jne    804c25 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a4a:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a4d:	83 fa 01             	cmp    $0x1,%edx
+  804a50:	0f 87 cf 01 00 00    	ja     804c25 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a56:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a5a:	44 89 c7             	mov    %r8d,%edi
+  804a5d:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  804a64:	00 00 00 
+  804a67:	ff d0                	call   *%rax
+  804a69:	89 c2                	mov    %eax,%edx
+  804a6b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a72:	85 d2                	test   %edx,%edx
+  804a74:	0f 88 ab 01 00 00    	js     804c25 <mmap+0x231>
+  804a7a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a7e:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a85:	00 00 00 
+  804a88:	8b 09                	mov    (%rcx),%ecx
+  804a8a:	39 0a                	cmp    %ecx,(%rdx)
+  804a8c:	0f 85 93 01 00 00    	jne    804c25 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804a92:	8b 52 08             	mov    0x8(%rdx),%edx
+  804a95:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804a98:	83 fa 01             	cmp    $0x1,%edx
+  804a9b:	0f 84 84 01 00 00    	je     804c25 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804aa1:	41 83 fe 01          	cmp    $0x1,%r14d
+  804aa5:	74 42                	je     804ae9 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804aa7:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804aae:	4c 89 e6             	mov    %r12,%rsi
+  804ab1:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ab8:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804abc:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ac0:	4d 85 ff             	test   %r15,%r15
+  804ac3:	74 67                	je     804b2c <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ac5:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804acc:	75 0f                	jne    804add <mmap+0xe9>
+  804ace:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804ad5:	00 00 00 
+  804ad8:	49 39 c7             	cmp    %rax,%r15
+  804adb:	77 1b                	ja     804af8 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804add:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ae4:	e9 3c 01 00 00       	jmp    804c25 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ae9:	41 f6 c5 02          	test   $0x2,%r13b
+  804aed:	74 b8                	je     804aa7 <mmap+0xb3>
+  804aef:	85 d2                	test   %edx,%edx
+  804af1:	75 b4                	jne    804aa7 <mmap+0xb3>
+  804af3:	e9 2d 01 00 00       	jmp    804c25 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804af8:	4c 89 ff             	mov    %r15,%rdi
+  804afb:	48 b8 62 46 80 00 00 	movabs $0x804662,%rax
+  804b02:	00 00 00 
+  804b05:	ff d0                	call   *%rax
+  804b07:	48 89 c2             	mov    %rax,%rdx
+  804b0a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b11:	49 39 d7             	cmp    %rdx,%r15
+  804b14:	0f 85 0b 01 00 00    	jne    804c25 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b1a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b21:	00 00 00 
+  804b24:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b2a:	eb 44                	jmp    804b70 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b2c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b30:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b37:	00 00 00 
+  804b3a:	48 b8 62 46 80 00 00 	movabs $0x804662,%rax
+  804b41:	00 00 00 
+  804b44:	ff d0                	call   *%rax
+  804b46:	48 89 c7             	mov    %rax,%rdi
+  804b49:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b4d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b54:	48 85 ff             	test   %rdi,%rdi
+  804b57:	75 c1                	jne    804b1a <mmap+0x126>
+  804b59:	e9 c7 00 00 00       	jmp    804c25 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b5e:	49 83 c4 01          	add    $0x1,%r12
+  804b62:	48 83 c0 20          	add    $0x20,%rax
+  804b66:	49 83 fc 20          	cmp    $0x20,%r12
+  804b6a:	0f 84 a5 00 00 00    	je     804c15 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b70:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b74:	75 e8                	jne    804b5e <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b76:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b7a:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  804b81:	00 00 00 
+  804b84:	ff d0                	call   *%rax
+  804b86:	89 c2                	mov    %eax,%edx
+  804b88:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b8f:	85 d2                	test   %edx,%edx
+  804b91:	0f 88 8e 00 00 00    	js     804c25 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804b97:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804b9b:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  804ba2:	00 00 00 
+  804ba5:	ff d0                	call   *%rax
+  804ba7:	89 c6                	mov    %eax,%esi
+  804ba9:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bac:	48 b8 ce 2f 80 00 00 	movabs $0x802fce,%rax
+  804bb3:	00 00 00 
+  804bb6:	ff d0                	call   *%rax
+  804bb8:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bbb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bc2:	45 85 ff             	test   %r15d,%r15d
+  804bc5:	78 5e                	js     804c25 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bc7:	49 c1 e4 05          	shl    $0x5,%r12
+  804bcb:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bd2:	00 00 00 
+  804bd5:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bd8:	48 bf d3 46 80 00 00 	movabs $0x8046d3,%rdi
+  804bdf:	00 00 00 
+  804be2:	48 b8 a1 51 80 00 00 	movabs $0x8051a1,%rax
+  804be9:	00 00 00 
+  804bec:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804bee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bf2:	49 89 04 24          	mov    %rax,(%r12)
+  804bf6:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804bfa:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804bff:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c04:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c09:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c0e:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c13:	eb 10                	jmp    804c25 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c15:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c1c:	eb 07                	jmp    804c25 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c1e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c25:	48 83 c4 38          	add    $0x38,%rsp
+  804c29:	5b                   	pop    %rbx
+  804c2a:	41 5c                	pop    %r12
+  804c2c:	41 5d                	pop    %r13
+  804c2e:	41 5e                	pop    %r14
+  804c30:	41 5f                	pop    %r15
+  804c32:	5d                   	pop    %rbp
+  804c33:	c3                   	ret
+
+0000000000804c34 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c34:	55                   	push   %rbp
+  804c35:	48 89 e5             	mov    %rsp,%rbp
+  804c38:	41 57                	push   %r15
+  804c3a:	41 56                	push   %r14
+  804c3c:	41 55                	push   %r13
+  804c3e:	41 54                	push   %r12
+  804c40:	53                   	push   %rbx
+  804c41:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c45:	49 89 fe             	mov    %rdi,%r14
+  804c48:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c4f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c56:	00 
+  804c57:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c5e:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c65:	00 00 00 
+  804c68:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c6f:	49 bf bb 48 80 00 00 	movabs $0x8048bb,%r15
+  804c76:	00 00 00 
+  804c79:	eb 09                	jmp    804c84 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c7b:	48 83 c3 20          	add    $0x20,%rbx
+  804c7f:	4c 39 eb             	cmp    %r13,%rbx
+  804c82:	74 33                	je     804cb7 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c84:	48 89 df             	mov    %rbx,%rdi
+  804c87:	48 8b 33             	mov    (%rbx),%rsi
+  804c8a:	4c 39 e6             	cmp    %r12,%rsi
+  804c8d:	73 ec                	jae    804c7b <msync+0x47>
+  804c8f:	48 85 f6             	test   %rsi,%rsi
+  804c92:	74 e7                	je     804c7b <msync+0x47>
+  804c94:	48 89 f2             	mov    %rsi,%rdx
+  804c97:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804c9b:	49 39 d6             	cmp    %rdx,%r14
+  804c9e:	73 db                	jae    804c7b <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ca0:	4c 39 e2             	cmp    %r12,%rdx
+  804ca3:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ca7:	4c 39 f6             	cmp    %r14,%rsi
+  804caa:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cae:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cb1:	85 c0                	test   %eax,%eax
+  804cb3:	79 c6                	jns    804c7b <msync+0x47>
+  804cb5:	eb 05                	jmp    804cbc <msync+0x88>
+    }
+
+    return 0;
+  804cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cbc:	48 83 c4 08          	add    $0x8,%rsp
+  804cc0:	5b                   	pop    %rbx
+  804cc1:	41 5c                	pop    %r12
+  804cc3:	41 5d                	pop    %r13
+  804cc5:	41 5e                	pop    %r14
+  804cc7:	41 5f                	pop    %r15
+  804cc9:	5d                   	pop    %rbp
+  804cca:	c3                   	ret
+
+0000000000804ccb <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804ccb:	55                   	push   %rbp
+  804ccc:	48 89 e5             	mov    %rsp,%rbp
+  804ccf:	41 57                	push   %r15
+  804cd1:	41 56                	push   %r14
+  804cd3:	41 55                	push   %r13
+  804cd5:	41 54                	push   %r12
+  804cd7:	53                   	push   %rbx
+  804cd8:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cdc:	49 89 ff             	mov    %rdi,%r15
+  804cdf:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804ce6:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804ced:	00 
+  804cee:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cf5:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804cfc:	00 00 00 
+  804cff:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d06:	48 89 d8             	mov    %rbx,%rax
+  804d09:	eb 09                	jmp    804d14 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d0b:	48 83 c0 20          	add    $0x20,%rax
+  804d0f:	4c 39 f0             	cmp    %r14,%rax
+  804d12:	74 40                	je     804d54 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d14:	48 8b 10             	mov    (%rax),%rdx
+  804d17:	4c 39 e2             	cmp    %r12,%rdx
+  804d1a:	73 ef                	jae    804d0b <munmap+0x40>
+  804d1c:	48 85 d2             	test   %rdx,%rdx
+  804d1f:	74 ea                	je     804d0b <munmap+0x40>
+  804d21:	48 89 d7             	mov    %rdx,%rdi
+  804d24:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d28:	49 39 ff             	cmp    %rdi,%r15
+  804d2b:	73 de                	jae    804d0b <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d2d:	49 39 fc             	cmp    %rdi,%r12
+  804d30:	72 05                	jb     804d37 <munmap+0x6c>
+  804d32:	4c 39 fa             	cmp    %r15,%rdx
+  804d35:	73 d4                	jae    804d0b <munmap+0x40>
+  804d37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d3c:	48 83 c4 08          	add    $0x8,%rsp
+  804d40:	5b                   	pop    %rbx
+  804d41:	41 5c                	pop    %r12
+  804d43:	41 5d                	pop    %r13
+  804d45:	41 5e                	pop    %r14
+  804d47:	41 5f                	pop    %r15
+  804d49:	5d                   	pop    %rbp
+  804d4a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d4b:	48 83 c3 20          	add    $0x20,%rbx
+  804d4f:	4c 39 f3             	cmp    %r14,%rbx
+  804d52:	74 5c                	je     804db0 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d54:	48 8b 33             	mov    (%rbx),%rsi
+  804d57:	4c 39 e6             	cmp    %r12,%rsi
+  804d5a:	73 ef                	jae    804d4b <munmap+0x80>
+  804d5c:	48 85 f6             	test   %rsi,%rsi
+  804d5f:	74 ea                	je     804d4b <munmap+0x80>
+  804d61:	48 89 f2             	mov    %rsi,%rdx
+  804d64:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d68:	49 39 d7             	cmp    %rdx,%r15
+  804d6b:	73 de                	jae    804d4b <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d6d:	48 89 df             	mov    %rbx,%rdi
+  804d70:	48 b8 bb 48 80 00 00 	movabs $0x8048bb,%rax
+  804d77:	00 00 00 
+  804d7a:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d7c:	85 c0                	test   %eax,%eax
+  804d7e:	78 bc                	js     804d3c <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d80:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d84:	48 8b 33             	mov    (%rbx),%rsi
+  804d87:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d8c:	48 b8 fa 27 80 00 00 	movabs $0x8027fa,%rax
+  804d93:	00 00 00 
+  804d96:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804d98:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804d9b:	48 b8 73 2f 80 00 00 	movabs $0x802f73,%rax
+  804da2:	00 00 00 
+  804da5:	ff d0                	call   *%rax
+        reg->start = 0;
+  804da7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dae:	eb 9b                	jmp    804d4b <munmap+0x80>
+    return 0;
+  804db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db5:	eb 85                	jmp    804d3c <munmap+0x71>
+
+0000000000804db7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dbc:	c3                   	ret
+
+0000000000804dbd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dbd:	55                   	push   %rbp
+  804dbe:	48 89 e5             	mov    %rsp,%rbp
+  804dc1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dc4:	48 be c5 62 80 00 00 	movabs $0x8062c5,%rsi
+  804dcb:	00 00 00 
+  804dce:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  804dd5:	00 00 00 
+  804dd8:	ff d0                	call   *%rax
+    return 0;
+}
+  804dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ddf:	5d                   	pop    %rbp
+  804de0:	c3                   	ret
+
+0000000000804de1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804de1:	55                   	push   %rbp
+  804de2:	48 89 e5             	mov    %rsp,%rbp
+  804de5:	41 57                	push   %r15
+  804de7:	41 56                	push   %r14
+  804de9:	41 55                	push   %r13
+  804deb:	41 54                	push   %r12
+  804ded:	53                   	push   %rbx
+  804dee:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804df5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804dfc:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e03:	00 00 00 00 
+  804e07:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e0e:	00 00 00 00 
+  804e12:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e19:	00 00 00 00 
+  804e1d:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e24:	00 00 00 00 
+  804e28:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e2f:	00 00 00 00 
+  804e33:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e3a:	00 00 00 00 
+  804e3e:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e45:	00 
+  804e46:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e4d:	00 
+  804e4e:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e55:	00 
+  804e56:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e5d:	00 
+  804e5e:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e65:	00 
+  804e66:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e6d:	00 
+  804e6e:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e75:	00 
+  804e76:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e7d:	00 
+  804e7e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e85:	00 
+  804e86:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804e8d:	00 
+    for (res = 0; res < n; res += inc) {
+  804e8e:	48 85 d2             	test   %rdx,%rdx
+  804e91:	74 7a                	je     804f0d <devcons_write+0x12c>
+  804e93:	49 89 d6             	mov    %rdx,%r14
+  804e96:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e9c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ea1:	49 bf 0d 23 80 00 00 	movabs $0x80230d,%r15
+  804ea8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804eab:	4c 89 f3             	mov    %r14,%rbx
+  804eae:	48 29 f3             	sub    %rsi,%rbx
+  804eb1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804eb6:	48 39 c3             	cmp    %rax,%rbx
+  804eb9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ebd:	4c 63 eb             	movslq %ebx,%r13
+  804ec0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ec7:	48 01 c6             	add    %rax,%rsi
+  804eca:	4c 89 ea             	mov    %r13,%rdx
+  804ecd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ed4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ed7:	4c 89 ee             	mov    %r13,%rsi
+  804eda:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ee1:	48 b8 3a 25 80 00 00 	movabs $0x80253a,%rax
+  804ee8:	00 00 00 
+  804eeb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804eed:	41 01 dc             	add    %ebx,%r12d
+  804ef0:	49 63 f4             	movslq %r12d,%rsi
+  804ef3:	4c 39 f6             	cmp    %r14,%rsi
+  804ef6:	72 b3                	jb     804eab <devcons_write+0xca>
+    return res;
+  804ef8:	49 63 c4             	movslq %r12d,%rax
+}
+  804efb:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f02:	5b                   	pop    %rbx
+  804f03:	41 5c                	pop    %r12
+  804f05:	41 5d                	pop    %r13
+  804f07:	41 5e                	pop    %r14
+  804f09:	41 5f                	pop    %r15
+  804f0b:	5d                   	pop    %rbp
+  804f0c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f0d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f13:	eb e3                	jmp    804ef8 <devcons_write+0x117>
+
+0000000000804f15 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f15:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f1d:	48 85 c0             	test   %rax,%rax
+  804f20:	74 55                	je     804f77 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f22:	55                   	push   %rbp
+  804f23:	48 89 e5             	mov    %rsp,%rbp
+  804f26:	41 55                	push   %r13
+  804f28:	41 54                	push   %r12
+  804f2a:	53                   	push   %rbx
+  804f2b:	48 83 ec 08          	sub    $0x8,%rsp
+  804f2f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f32:	48 bb 6d 25 80 00 00 	movabs $0x80256d,%rbx
+  804f39:	00 00 00 
+  804f3c:	49 bc 81 26 80 00 00 	movabs $0x802681,%r12
+  804f43:	00 00 00 
+  804f46:	eb 03                	jmp    804f4b <devcons_read+0x36>
+  804f48:	41 ff d4             	call   *%r12
+  804f4b:	ff d3                	call   *%rbx
+  804f4d:	85 c0                	test   %eax,%eax
+  804f4f:	74 f7                	je     804f48 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f51:	48 63 d0             	movslq %eax,%rdx
+  804f54:	78 13                	js     804f69 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f56:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f5b:	83 f8 04             	cmp    $0x4,%eax
+  804f5e:	74 09                	je     804f69 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f60:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f64:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f69:	48 89 d0             	mov    %rdx,%rax
+  804f6c:	48 83 c4 08          	add    $0x8,%rsp
+  804f70:	5b                   	pop    %rbx
+  804f71:	41 5c                	pop    %r12
+  804f73:	41 5d                	pop    %r13
+  804f75:	5d                   	pop    %rbp
+  804f76:	c3                   	ret
+  804f77:	48 89 d0             	mov    %rdx,%rax
+  804f7a:	c3                   	ret
+
+0000000000804f7b <cputchar>:
+cputchar(int ch) {
+  804f7b:	55                   	push   %rbp
+  804f7c:	48 89 e5             	mov    %rsp,%rbp
+  804f7f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f83:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f87:	be 01 00 00 00       	mov    $0x1,%esi
+  804f8c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804f90:	48 b8 3a 25 80 00 00 	movabs $0x80253a,%rax
+  804f97:	00 00 00 
+  804f9a:	ff d0                	call   *%rax
+}
+  804f9c:	c9                   	leave
+  804f9d:	c3                   	ret
+
+0000000000804f9e <getchar>:
+getchar(void) {
+  804f9e:	55                   	push   %rbp
+  804f9f:	48 89 e5             	mov    %rsp,%rbp
+  804fa2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fa6:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fab:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804faf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fb4:	48 b8 f1 30 80 00 00 	movabs $0x8030f1,%rax
+  804fbb:	00 00 00 
+  804fbe:	ff d0                	call   *%rax
+  804fc0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fc2:	85 c0                	test   %eax,%eax
+  804fc4:	78 06                	js     804fcc <getchar+0x2e>
+  804fc6:	74 08                	je     804fd0 <getchar+0x32>
+  804fc8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fcc:	89 d0                	mov    %edx,%eax
+  804fce:	c9                   	leave
+  804fcf:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fd0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fd5:	eb f5                	jmp    804fcc <getchar+0x2e>
+
+0000000000804fd7 <iscons>:
+iscons(int fdnum) {
+  804fd7:	55                   	push   %rbp
+  804fd8:	48 89 e5             	mov    %rsp,%rbp
+  804fdb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804fdf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fe3:	48 b8 0e 2e 80 00 00 	movabs $0x802e0e,%rax
+  804fea:	00 00 00 
+  804fed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fef:	85 c0                	test   %eax,%eax
+  804ff1:	78 18                	js     80500b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804ff3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ff7:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804ffe:	00 00 00 
+  805001:	8b 00                	mov    (%rax),%eax
+  805003:	39 02                	cmp    %eax,(%rdx)
+  805005:	0f 94 c0             	sete   %al
+  805008:	0f b6 c0             	movzbl %al,%eax
+}
+  80500b:	c9                   	leave
+  80500c:	c3                   	ret
+
+000000000080500d <opencons>:
+opencons(void) {
+  80500d:	55                   	push   %rbp
+  80500e:	48 89 e5             	mov    %rsp,%rbp
+  805011:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805015:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805019:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  805020:	00 00 00 
+  805023:	ff d0                	call   *%rax
+  805025:	85 c0                	test   %eax,%eax
+  805027:	78 49                	js     805072 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805029:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80502e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805033:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805037:	bf 00 00 00 00       	mov    $0x0,%edi
+  80503c:	48 b8 22 27 80 00 00 	movabs $0x802722,%rax
+  805043:	00 00 00 
+  805046:	ff d0                	call   *%rax
+  805048:	85 c0                	test   %eax,%eax
+  80504a:	78 26                	js     805072 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80504c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805050:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805057:	00 00 
+  805059:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80505b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80505f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805066:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  80506d:	00 00 00 
+  805070:	ff d0                	call   *%rax
+}
+  805072:	c9                   	leave
+  805073:	c3                   	ret
+
+0000000000805074 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805074:	55                   	push   %rbp
+  805075:	48 89 e5             	mov    %rsp,%rbp
+  805078:	41 56                	push   %r14
+  80507a:	41 55                	push   %r13
+  80507c:	41 54                	push   %r12
+  80507e:	53                   	push   %rbx
+  80507f:	48 83 ec 50          	sub    $0x50,%rsp
+  805083:	49 89 fc             	mov    %rdi,%r12
+  805086:	41 89 f5             	mov    %esi,%r13d
+  805089:	48 89 d3             	mov    %rdx,%rbx
+  80508c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805090:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  805094:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  805098:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80509f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050a7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050ab:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050af:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050b6:	00 00 00 
+  8050b9:	4c 8b 30             	mov    (%rax),%r14
+  8050bc:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  8050c3:	00 00 00 
+  8050c6:	ff d0                	call   *%rax
+  8050c8:	89 c6                	mov    %eax,%esi
+  8050ca:	45 89 e8             	mov    %r13d,%r8d
+  8050cd:	4c 89 e1             	mov    %r12,%rcx
+  8050d0:	4c 89 f2             	mov    %r14,%rdx
+  8050d3:	48 bf d8 62 80 00 00 	movabs $0x8062d8,%rdi
+  8050da:	00 00 00 
+  8050dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050e2:	49 bc 86 16 80 00 00 	movabs $0x801686,%r12
+  8050e9:	00 00 00 
+  8050ec:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8050ef:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8050f3:	48 89 df             	mov    %rbx,%rdi
+  8050f6:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  8050fd:	00 00 00 
+  805100:	ff d0                	call   *%rax
+    cprintf("\n");
+  805102:	48 bf b3 61 80 00 00 	movabs $0x8061b3,%rdi
+  805109:	00 00 00 
+  80510c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805111:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805114:	cc                   	int3
+  805115:	eb fd                	jmp    805114 <_panic+0xa0>
+
+0000000000805117 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805117:	55                   	push   %rbp
+  805118:	48 89 e5             	mov    %rsp,%rbp
+  80511b:	41 56                	push   %r14
+  80511d:	41 55                	push   %r13
+  80511f:	41 54                	push   %r12
+  805121:	53                   	push   %rbx
+  805122:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805125:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80512c:	00 00 00 
+  80512f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805133:	74 27                	je     80515c <_handle_vectored_pagefault+0x45>
+  805135:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80513a:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805141:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805144:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805147:	4c 89 e7             	mov    %r12,%rdi
+  80514a:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80514f:	84 c0                	test   %al,%al
+  805151:	75 45                	jne    805198 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805153:	48 83 c3 01          	add    $0x1,%rbx
+  805157:	49 3b 1e             	cmp    (%r14),%rbx
+  80515a:	72 eb                	jb     805147 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80515c:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805163:	00 
+  805164:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805169:	4d 8b 04 24          	mov    (%r12),%r8
+  80516d:	48 ba 00 63 80 00 00 	movabs $0x806300,%rdx
+  805174:	00 00 00 
+  805177:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80517c:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  805183:	00 00 00 
+  805186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80518b:	49 ba 74 50 80 00 00 	movabs $0x805074,%r10
+  805192:	00 00 00 
+  805195:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805198:	5b                   	pop    %rbx
+  805199:	41 5c                	pop    %r12
+  80519b:	41 5d                	pop    %r13
+  80519d:	41 5e                	pop    %r14
+  80519f:	5d                   	pop    %rbp
+  8051a0:	c3                   	ret
+
+00000000008051a1 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051a1:	55                   	push   %rbp
+  8051a2:	48 89 e5             	mov    %rsp,%rbp
+  8051a5:	53                   	push   %rbx
+  8051a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8051aa:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051ad:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051b2:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051b9:	00 00 00 
+  8051bc:	80 38 00             	cmpb   $0x0,(%rax)
+  8051bf:	74 68                	je     805229 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051c1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051c8:	00 00 00 
+  8051cb:	48 8b 08             	mov    (%rax),%rcx
+  8051ce:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051d3:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051da:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051dd:	48 85 c9             	test   %rcx,%rcx
+  8051e0:	0f 84 e0 00 00 00    	je     8052c6 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051e6:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8051ea:	0f 84 c9 00 00 00    	je     8052b9 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f0:	48 83 c2 01          	add    $0x1,%rdx
+  8051f4:	48 39 ca             	cmp    %rcx,%rdx
+  8051f7:	75 ed                	jne    8051e6 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8051f9:	48 83 f9 08          	cmp    $0x8,%rcx
+  8051fd:	0f 84 84 00 00 00    	je     805287 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805203:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805207:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80520e:	00 00 00 
+  805211:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805218:	00 00 00 
+  80521b:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80521f:	85 f6                	test   %esi,%esi
+  805221:	0f 89 97 00 00 00    	jns    8052be <add_pgfault_handler+0x11d>
+  805227:	eb 63                	jmp    80528c <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805229:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80522e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805233:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80523a:	00 00 00 
+  80523d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805242:	48 b8 22 27 80 00 00 	movabs $0x802722,%rax
+  805249:	00 00 00 
+  80524c:	ff d0                	call   *%rax
+  80524e:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805250:	85 c0                	test   %eax,%eax
+  805252:	78 38                	js     80528c <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805254:	48 be a2 53 80 00 00 	movabs $0x8053a2,%rsi
+  80525b:	00 00 00 
+  80525e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805263:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  80526a:	00 00 00 
+  80526d:	ff d0                	call   *%rax
+  80526f:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805271:	85 c0                	test   %eax,%eax
+  805273:	78 17                	js     80528c <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805275:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80527c:	00 00 00 
+  80527f:	c6 00 01             	movb   $0x1,(%rax)
+  805282:	e9 3a ff ff ff       	jmp    8051c1 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805287:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80528c:	89 f1                	mov    %esi,%ecx
+  80528e:	48 ba 3e 63 80 00 00 	movabs $0x80633e,%rdx
+  805295:	00 00 00 
+  805298:	be 42 00 00 00       	mov    $0x42,%esi
+  80529d:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  8052a4:	00 00 00 
+  8052a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ac:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  8052b3:	00 00 00 
+  8052b6:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052b9:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052be:	89 f0                	mov    %esi,%eax
+  8052c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052c4:	c9                   	leave
+  8052c5:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052c6:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052cd:	00 00 00 
+  8052d0:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052d7:	48 89 d8             	mov    %rbx,%rax
+  8052da:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052e1:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052e4:	eb d8                	jmp    8052be <add_pgfault_handler+0x11d>
+
+00000000008052e6 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052e6:	55                   	push   %rbp
+  8052e7:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8052ea:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052f1:	00 00 00 
+  8052f4:	80 38 00             	cmpb   $0x0,(%rax)
+  8052f7:	74 33                	je     80532c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8052f9:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805300:	00 00 00 
+  805303:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805308:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80530f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805312:	48 85 c0             	test   %rax,%rax
+  805315:	0f 84 85 00 00 00    	je     8053a0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80531b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80531f:	74 40                	je     805361 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805321:	48 83 c1 01          	add    $0x1,%rcx
+  805325:	48 39 c1             	cmp    %rax,%rcx
+  805328:	75 f1                	jne    80531b <remove_pgfault_handler+0x35>
+  80532a:	eb 74                	jmp    8053a0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80532c:	48 b9 56 63 80 00 00 	movabs $0x806356,%rcx
+  805333:	00 00 00 
+  805336:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80533d:	00 00 00 
+  805340:	be 48 00 00 00       	mov    $0x48,%esi
+  805345:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  80534c:	00 00 00 
+  80534f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805354:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  80535b:	00 00 00 
+  80535e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805361:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805368:	00 
+  805369:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80536d:	48 29 ca             	sub    %rcx,%rdx
+  805370:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805377:	00 00 00 
+  80537a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80537e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805383:	48 89 ce             	mov    %rcx,%rsi
+  805386:	48 b8 0d 23 80 00 00 	movabs $0x80230d,%rax
+  80538d:	00 00 00 
+  805390:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805392:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805399:	00 00 00 
+  80539c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053a0:	5d                   	pop    %rbp
+  8053a1:	c3                   	ret
+
+00000000008053a2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053a2:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053a5:	48 b8 17 51 80 00 00 	movabs $0x805117,%rax
+  8053ac:	00 00 00 
+    call *%rax
+  8053af:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053b1:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053b8:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053b9:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053c0:	00 
+    subq $8, %rcx
+  8053c1:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053c5:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053c8:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053cf:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053d0:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053d4:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053d8:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053dd:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053e2:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053e7:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8053ec:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8053f1:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8053f6:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8053fb:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805400:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805405:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80540a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80540f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805414:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805419:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80541e:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805422:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805426:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805427:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805428:	c3                   	ret
+
+0000000000805429 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805429:	85 ff                	test   %edi,%edi
+  80542b:	78 58                	js     805485 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80542d:	48 85 f6             	test   %rsi,%rsi
+  805430:	74 12                	je     805444 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805432:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805439:	00 00 00 
+  80543c:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805442:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805444:	48 85 c9             	test   %rcx,%rcx
+  805447:	74 12                	je     80545b <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805449:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805450:	00 00 00 
+  805453:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805459:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80545b:	48 85 d2             	test   %rdx,%rdx
+  80545e:	74 14                	je     805474 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805460:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805467:	00 00 00 
+  80546a:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805471:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805474:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80547b:	00 00 00 
+  80547e:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805484:	c3                   	ret
+        if (from_env_store) {
+  805485:	48 85 f6             	test   %rsi,%rsi
+  805488:	74 06                	je     805490 <ipc_result+0x67>
+            *from_env_store = 0;
+  80548a:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805490:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805492:	48 85 c9             	test   %rcx,%rcx
+  805495:	74 ed                	je     805484 <ipc_result+0x5b>
+            *perm_store = 0;
+  805497:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  80549d:	c3                   	ret
+
+000000000080549e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80549e:	55                   	push   %rbp
+  80549f:	48 89 e5             	mov    %rsp,%rbp
+  8054a2:	41 55                	push   %r13
+  8054a4:	41 54                	push   %r12
+  8054a6:	53                   	push   %rbx
+  8054a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8054ab:	49 89 fc             	mov    %rdi,%r12
+  8054ae:	48 89 f7             	mov    %rsi,%rdi
+  8054b1:	48 89 d3             	mov    %rdx,%rbx
+  8054b4:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054b7:	48 85 f6             	test   %rsi,%rsi
+  8054ba:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054c1:	00 00 00 
+  8054c4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8054cd:	48 85 d2             	test   %rdx,%rdx
+  8054d0:	74 03                	je     8054d5 <ipc_recv+0x37>
+  8054d2:	48 8b 32             	mov    (%rdx),%rsi
+  8054d5:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  8054dc:	00 00 00 
+  8054df:	ff d0                	call   *%rax
+  8054e1:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054e3:	4c 89 e9             	mov    %r13,%rcx
+  8054e6:	48 89 da             	mov    %rbx,%rdx
+  8054e9:	4c 89 e6             	mov    %r12,%rsi
+  8054ec:	48 b8 29 54 80 00 00 	movabs $0x805429,%rax
+  8054f3:	00 00 00 
+  8054f6:	ff d0                	call   *%rax
+}
+  8054f8:	48 83 c4 08          	add    $0x8,%rsp
+  8054fc:	5b                   	pop    %rbx
+  8054fd:	41 5c                	pop    %r12
+  8054ff:	41 5d                	pop    %r13
+  805501:	5d                   	pop    %rbp
+  805502:	c3                   	ret
+
+0000000000805503 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805503:	55                   	push   %rbp
+  805504:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805507:	48 85 d2             	test   %rdx,%rdx
+  80550a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805511:	00 00 00 
+  805514:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805518:	89 f6                	mov    %esi,%esi
+  80551a:	48 b8 fa 2a 80 00 00 	movabs $0x802afa,%rax
+  805521:	00 00 00 
+  805524:	ff d0                	call   *%rax
+    if (res < 0) {
+  805526:	85 c0                	test   %eax,%eax
+  805528:	78 02                	js     80552c <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80552a:	5d                   	pop    %rbp
+  80552b:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80552c:	89 c1                	mov    %eax,%ecx
+  80552e:	48 ba 70 63 80 00 00 	movabs $0x806370,%rdx
+  805535:	00 00 00 
+  805538:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80553d:	48 bf 7d 63 80 00 00 	movabs $0x80637d,%rdi
+  805544:	00 00 00 
+  805547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80554c:	49 b8 74 50 80 00 00 	movabs $0x805074,%r8
+  805553:	00 00 00 
+  805556:	41 ff d0             	call   *%r8
+
+0000000000805559 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805559:	55                   	push   %rbp
+  80555a:	48 89 e5             	mov    %rsp,%rbp
+  80555d:	53                   	push   %rbx
+  80555e:	48 83 ec 08          	sub    $0x8,%rsp
+  805562:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805566:	48 85 d2             	test   %rdx,%rdx
+  805569:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805570:	00 00 00 
+  805573:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805577:	4d 85 c9             	test   %r9,%r9
+  80557a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80557e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805583:	48 85 db             	test   %rbx,%rbx
+  805586:	74 03                	je     80558b <ipc_call+0x32>
+  805588:	48 8b 03             	mov    (%rbx),%rax
+  80558b:	89 f6                	mov    %esi,%esi
+  80558d:	48 83 ec 08          	sub    $0x8,%rsp
+  805591:	50                   	push   %rax
+  805592:	48 b8 2c 2b 80 00 00 	movabs $0x802b2c,%rax
+  805599:	00 00 00 
+  80559c:	ff d0                	call   *%rax
+  80559e:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055a0:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055a4:	48 89 da             	mov    %rbx,%rdx
+  8055a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8055ac:	48 b8 29 54 80 00 00 	movabs $0x805429,%rax
+  8055b3:	00 00 00 
+  8055b6:	ff d0                	call   *%rax
+}
+  8055b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055bc:	c9                   	leave
+  8055bd:	c3                   	ret
+
+00000000008055be <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055be:	55                   	push   %rbp
+  8055bf:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055c2:	89 f6                	mov    %esi,%esi
+  8055c4:	48 b8 98 2b 80 00 00 	movabs $0x802b98,%rax
+  8055cb:	00 00 00 
+  8055ce:	ff d0                	call   *%rax
+  8055d0:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8055e1:	48 b8 29 54 80 00 00 	movabs $0x805429,%rax
+  8055e8:	00 00 00 
+  8055eb:	ff d0                	call   *%rax
+}
+  8055ed:	5d                   	pop    %rbp
+  8055ee:	c3                   	ret
+
+00000000008055ef <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8055ef:	55                   	push   %rbp
+  8055f0:	48 89 e5             	mov    %rsp,%rbp
+  8055f3:	41 54                	push   %r12
+  8055f5:	53                   	push   %rbx
+  8055f6:	4c 89 cb             	mov    %r9,%rbx
+  8055f9:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8055fd:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805601:	48 85 d2             	test   %rdx,%rdx
+  805604:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80560b:	00 00 00 
+  80560e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805612:	4d 85 c9             	test   %r9,%r9
+  805615:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80561e:	4d 85 e4             	test   %r12,%r12
+  805621:	74 04                	je     805627 <ipc_reply_wait+0x38>
+  805623:	49 8b 04 24          	mov    (%r12),%rax
+  805627:	89 f6                	mov    %esi,%esi
+  805629:	48 83 ec 08          	sub    $0x8,%rsp
+  80562d:	50                   	push   %rax
+  80562e:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  805635:	00 00 00 
+  805638:	ff d0                	call   *%rax
+  80563a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80563c:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805640:	4c 89 e2             	mov    %r12,%rdx
+  805643:	48 89 de             	mov    %rbx,%rsi
+  805646:	48 b8 29 54 80 00 00 	movabs $0x805429,%rax
+  80564d:	00 00 00 
+  805650:	ff d0                	call   *%rax
+}
+  805652:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805656:	5b                   	pop    %rbx
+  805657:	41 5c                	pop    %r12
+  805659:	5d                   	pop    %rbp
+  80565a:	c3                   	ret
+
+000000000080565b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80565b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805660:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805667:	00 00 00 
+  80566a:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805671:	48 01 ca             	add    %rcx,%rdx
+  805674:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80567a:	39 fa                	cmp    %edi,%edx
+  80567c:	74 12                	je     805690 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80567e:	48 83 c0 01          	add    $0x1,%rax
+  805682:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805688:	75 e0                	jne    80566a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80568a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80568f:	c3                   	ret
+            return envs[i].env_id;
+  805690:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805697:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80569e:	00 00 00 
+  8056a1:	48 01 d0             	add    %rdx,%rax
+  8056a4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056aa:	c3                   	ret
+  8056ab:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000008056b0 <__rodata_start>:
+  8056b0:	77 00                	ja     8056b2 <__rodata_start+0x2>
+  8056b2:	72 62                	jb     805716 <__rodata_start+0x66>
+  8056b4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056b7:	00 0f                	add    %cl,(%rdi)
+  8056b9:	1f                   	(bad)
+  8056ba:	84 00                	test   %al,(%rax)
+  8056bc:	00 00                	add    %al,(%rax)
+  8056be:	00 00                	add    %al,(%rax)
+  8056c0:	b3 09                	mov    $0x9,%bl
+  8056c2:	80 00 00             	addb   $0x0,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 ed                	add    %ch,%ch
+  8056c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ce:	00 00                	add    %al,(%rax)
+  8056d0:	ed                   	in     (%dx),%eax
+  8056d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056d6:	00 00                	add    %al,(%rax)
+  8056d8:	ed                   	in     (%dx),%eax
+  8056d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	ed                   	in     (%dx),%eax
+  8056e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056e6:	00 00                	add    %al,(%rax)
+  8056e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 ed                	add    %ch,%ch
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	ed                   	in     (%dx),%eax
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	8c 0a                	mov    %cs,(%rdx)
+  80571a:	80 00 00             	addb   $0x0,(%rax)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805726:	00 00                	add    %al,(%rax)
+  805728:	8c 0a                	mov    %cs,(%rdx)
+  80572a:	80 00 00             	addb   $0x0,(%rax)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	ed                   	in     (%dx),%eax
+  805769:	0d 80 00 00 00       	or     $0x80,%eax
+  80576e:	00 00                	add    %al,(%rax)
+  805770:	ed                   	in     (%dx),%eax
+  805771:	0d 80 00 00 00       	or     $0x80,%eax
+  805776:	00 00                	add    %al,(%rax)
+  805778:	ed                   	in     (%dx),%eax
+  805779:	0d 80 00 00 00       	or     $0x80,%eax
+  80577e:	00 00                	add    %al,(%rax)
+  805780:	ed                   	in     (%dx),%eax
+  805781:	0d 80 00 00 00       	or     $0x80,%eax
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	f4                   	hlt
+  805859:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80585f:	00 ed                	add    %ch,%ch
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	2c 0b                	sub    $0xb,%al
+  805872:	80 00 00             	addb   $0x0,(%rax)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 ed                	add    %ch,%ch
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058b3:	00 00                	add    %al,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 cb                	add    %cl,%bl
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	6a 0a                	push   $0xa
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 ed                	add    %ch,%ch
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	3c 0a                	cmp    $0xa,%al
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 ed                	add    %ch,%ch
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80590b:	00 00                	add    %al,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 29                	add    %ch,(%rcx)
+  805919:	0c 80                	or     $0x80,%al
+  80591b:	00 00                	add    %al,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805922:	80 00 00             	addb   $0x0,(%rax)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	1a 0b                	sbb    (%rbx),%cl
+  805932:	80 00 00             	addb   $0x0,(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 ed                	add    %ch,%ch
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ce                   	(bad)
+  805941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	f4                   	hlt
+  805959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80595f:	00 37                	add    %dh,(%rdi)
+  805961:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805967:	00 5f 12             	add    %bl,0x12(%rdi)
+  80596a:	80 00 00             	addb   $0x0,(%rax)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 37                	add    %dh,(%rdi)
+  805971:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805977:	00 5f 12             	add    %bl,0x12(%rdi)
+  80597a:	80 00 00             	addb   $0x0,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80598b:	00 00                	add    %al,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 d2                	add    %dl,%dl
+  805991:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805997:	00 d2                	add    %dl,%dl
+  805999:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80599f:	00 d2                	add    %dl,%dl
+  8059a1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059a7:	00 d2                	add    %dl,%dl
+  8059a9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 f6                	add    %dh,%dh
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 f6                	add    %dh,%dh
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 22                	add    %ah,(%rdx)
+  805a11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a17:	00 22                	add    %ah,(%rdx)
+  805a19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a1f:	00 22                	add    %ah,(%rdx)
+  805a21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a27:	00 22                	add    %ah,(%rdx)
+  805a29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 46 12             	add    %al,0x12(%rsi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 22                	add    %ah,(%rdx)
+  805b21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b27:	00 22                	add    %ah,(%rdx)
+  805b29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 46 12             	add    %al,0x12(%rsi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805be0 <basefix.0>:
+  805be0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805bf0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c00:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c10:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c20:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c30:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c40:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c50:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c60:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c70:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805c80:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805c90:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805ca0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cb0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805cc0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cd0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805ce0:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805cf0:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d00:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d10:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d20:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d30:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d40:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d50:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d60:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d70:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805d80:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805d90:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805da0:	7e 18 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ~...............
+  805db0:	c5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805dc0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805dd0:	d5 1e 80 00 00 00 00 00 9d 18 80 00 00 00 00 00     ................
+  805de0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805df0:	91 18 80 00 00 00 00 00 0b 19 80 00 00 00 00 00     ................
+  805e00:	d5 1e 80 00 00 00 00 00 91 18 80 00 00 00 00 00     ................
+  805e10:	d7 18 80 00 00 00 00 00 d7 18 80 00 00 00 00 00     ................
+  805e20:	d7 18 80 00 00 00 00 00 d7 18 80 00 00 00 00 00     ................
+  805e30:	d7 18 80 00 00 00 00 00 d7 18 80 00 00 00 00 00     ................
+  805e40:	d7 18 80 00 00 00 00 00 d7 18 80 00 00 00 00 00     ................
+  805e50:	d7 18 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805e60:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805e70:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805e80:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805e90:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805ea0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805eb0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805ec0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805ed0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805ee0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805ef0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f00:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f10:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f20:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f30:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f40:	d5 1e 80 00 00 00 00 00 f3 1d 80 00 00 00 00 00     ................
+  805f50:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f60:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f70:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f80:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805f90:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805fa0:	39 19 80 00 00 00 00 00 08 1b 80 00 00 00 00 00     9...............
+  805fb0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  805fc0:	d5 1e 80 00 00 00 00 00 2e 19 80 00 00 00 00 00     ................
+  805fd0:	68 19 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     h...............
+  805fe0:	d5 1e 80 00 00 00 00 00 23 19 80 00 00 00 00 00     ........#.......
+  805ff0:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  806000:	b1 1c 80 00 00 00 00 00 80 1d 80 00 00 00 00 00     ................
+  806010:	d5 1e 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  806020:	ff 19 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  806030:	dc 1b 80 00 00 00 00 00 d5 1e 80 00 00 00 00 00     ................
+  806040:	d5 1e 80 00 00 00 00 00 f3 1d 80 00 00 00 00 00     ................
+  806050:	d5 1e 80 00 00 00 00 00 87 18 80 00 00 00 00 00     ................
+
+0000000000806060 <error_string>:
+	...
+  806068:	3e 5c 80 00 00 00 00 00 50 5c 80 00 00 00 00 00     >\......P\......
+  806078:	60 5c 80 00 00 00 00 00 72 5c 80 00 00 00 00 00     `\......r\......
+  806088:	80 5c 80 00 00 00 00 00 94 5c 80 00 00 00 00 00     .\.......\......
+  806098:	a9 5c 80 00 00 00 00 00 bc 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	ce 5c 80 00 00 00 00 00 e2 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	f2 5c 80 00 00 00 00 00 05 5d 80 00 00 00 00 00     .\.......]......
+  8060c8:	1c 5d 80 00 00 00 00 00 32 5d 80 00 00 00 00 00     .]......2]......
+  8060d8:	4a 5d 80 00 00 00 00 00 62 5d 80 00 00 00 00 00     J]......b]......
+  8060e8:	6f 5d 80 00 00 00 00 00 00 61 80 00 00 00 00 00     o].......a......
+  8060f8:	83 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806108:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806118:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806128:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806138:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806148:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806158:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806168:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806178:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806188:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806198:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008061e0 <devtab>:
+  8061e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8061f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806200:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806210:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806220:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806230:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806240:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806250:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806260:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806270:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806280:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806290:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062b0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062c0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062d0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8062e0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8062f0:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806300:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806310:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806320:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806330:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806340:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806350:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806360:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806370:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806380:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806390:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8063e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
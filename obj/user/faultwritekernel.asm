@@ -0,0 +1,10313 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 64 22 80 00 00 	movabs $0x802264,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 e5 20 80 00 00 	movabs $0x8020e5,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 f4 1e 80 00 00 	movabs $0x801ef4,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 f4 1e 80 00 00 	movabs $0x801ef4,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 bb 15 80 00 00 	movabs $0x8015bb,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 70 5c 80 00 00 	movabs $0x805c70,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 8e 39 80 00 00 	movabs $0x80398e,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be b0 56 80 00 00 	movabs $0x8056b0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 8e 39 80 00 00 	movabs $0x80398e,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be b2 56 80 00 00 	movabs $0x8056b2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 8e 39 80 00 00 	movabs $0x80398e,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be b5 56 80 00 00 	movabs $0x8056b5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 8e 39 80 00 00 	movabs $0x80398e,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 f9 49 80 00 00 	movabs $0x8049f9,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 d0 4c 80 00 00 	movabs $0x804cd0,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 d8 33 80 00 00 	movabs $0x8033d8,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 de 32 80 00 00 	movabs $0x8032de,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 de 32 80 00 00 	movabs $0x8032de,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 f6 30 80 00 00 	movabs $0x8030f6,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 8e 39 80 00 00 	movabs $0x80398e,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 31 22 80 00 00 	movabs $0x802231,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 31 22 80 00 00 	movabs $0x802231,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 64 22 80 00 00 	movabs $0x802264,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 31 22 80 00 00 	movabs $0x802231,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 59 80 00 00 	movabs $0x805960,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 31 22 80 00 00 	movabs $0x802231,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 31 22 80 00 00 	movabs $0x802231,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 89 24 80 00 00 	movabs $0x802489,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 89 24 80 00 00 	movabs $0x802489,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 13 00 00 00       	call   801512 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    *(volatile unsigned *)0x8040000000 = 0;
+  801501:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  801508:	00 00 00 
+  80150b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  801511:	c3                   	ret
+
+0000000000801512 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801512:	55                   	push   %rbp
+  801513:	48 89 e5             	mov    %rsp,%rbp
+  801516:	41 56                	push   %r14
+  801518:	41 55                	push   %r13
+  80151a:	41 54                	push   %r12
+  80151c:	53                   	push   %rbx
+  80151d:	41 89 fd             	mov    %edi,%r13d
+  801520:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801523:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80152a:	00 00 00 
+  80152d:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801534:	00 00 00 
+  801537:	48 39 c2             	cmp    %rax,%rdx
+  80153a:	73 17                	jae    801553 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80153c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80153f:	49 89 c4             	mov    %rax,%r12
+  801542:	48 83 c3 08          	add    $0x8,%rbx
+  801546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154b:	ff 53 f8             	call   *-0x8(%rbx)
+  80154e:	4c 39 e3             	cmp    %r12,%rbx
+  801551:	72 ef                	jb     801542 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801553:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  80155a:	00 00 00 
+  80155d:	ff d0                	call   *%rax
+  80155f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801564:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80156b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801572:	00 00 00 
+  801575:	48 01 d0             	add    %rdx,%rax
+  801578:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80157f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801582:	45 85 ed             	test   %r13d,%r13d
+  801585:	7e 0d                	jle    801594 <libmain+0x82>
+  801587:	49 8b 06             	mov    (%r14),%rax
+  80158a:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801591:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801594:	4c 89 f6             	mov    %r14,%rsi
+  801597:	44 89 ef             	mov    %r13d,%edi
+  80159a:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015a1:	00 00 00 
+  8015a4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015a6:	48 b8 bb 15 80 00 00 	movabs $0x8015bb,%rax
+  8015ad:	00 00 00 
+  8015b0:	ff d0                	call   *%rax
+#endif
+}
+  8015b2:	5b                   	pop    %rbx
+  8015b3:	41 5c                	pop    %r12
+  8015b5:	41 5d                	pop    %r13
+  8015b7:	41 5e                	pop    %r14
+  8015b9:	5d                   	pop    %rbp
+  8015ba:	c3                   	ret
+
+00000000008015bb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015bb:	55                   	push   %rbp
+  8015bc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015bf:	48 b8 ab 2f 80 00 00 	movabs $0x802fab,%rax
+  8015c6:	00 00 00 
+  8015c9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015d0:	48 b8 de 25 80 00 00 	movabs $0x8025de,%rax
+  8015d7:	00 00 00 
+  8015da:	ff d0                	call   *%rax
+}
+  8015dc:	5d                   	pop    %rbp
+  8015dd:	c3                   	ret
+
+00000000008015de <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015de:	55                   	push   %rbp
+  8015df:	48 89 e5             	mov    %rsp,%rbp
+  8015e2:	53                   	push   %rbx
+  8015e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015ea:	8b 06                	mov    (%rsi),%eax
+  8015ec:	8d 50 01             	lea    0x1(%rax),%edx
+  8015ef:	89 16                	mov    %edx,(%rsi)
+  8015f1:	48 98                	cltq
+  8015f3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8015f8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8015fe:	74 0a                	je     80160a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801600:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801604:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801608:	c9                   	leave
+  801609:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80160a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80160e:	be ff 00 00 00       	mov    $0xff,%esi
+  801613:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  80161a:	00 00 00 
+  80161d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80161f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801625:	eb d9                	jmp    801600 <putch+0x22>
+
+0000000000801627 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801627:	55                   	push   %rbp
+  801628:	48 89 e5             	mov    %rsp,%rbp
+  80162b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801632:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801635:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80163c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801641:	b8 00 00 00 00       	mov    $0x0,%eax
+  801646:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801649:	48 89 f1             	mov    %rsi,%rcx
+  80164c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801653:	48 bf de 15 80 00 00 	movabs $0x8015de,%rdi
+  80165a:	00 00 00 
+  80165d:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  801664:	00 00 00 
+  801667:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801669:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801670:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801677:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  80167e:	00 00 00 
+  801681:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801683:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801689:	c9                   	leave
+  80168a:	c3                   	ret
+
+000000000080168b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80168b:	55                   	push   %rbp
+  80168c:	48 89 e5             	mov    %rsp,%rbp
+  80168f:	48 83 ec 50          	sub    $0x50,%rsp
+  801693:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801697:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80169b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80169f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016a3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016a7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016b6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016be:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016c2:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  8016c9:	00 00 00 
+  8016cc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+
+00000000008016d0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	41 57                	push   %r15
+  8016d6:	41 56                	push   %r14
+  8016d8:	41 55                	push   %r13
+  8016da:	41 54                	push   %r12
+  8016dc:	53                   	push   %rbx
+  8016dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8016e1:	49 89 fc             	mov    %rdi,%r12
+  8016e4:	49 89 f5             	mov    %rsi,%r13
+  8016e7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016eb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8016ee:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8016f1:	41 89 cf             	mov    %ecx,%r15d
+  8016f4:	4c 39 fa             	cmp    %r15,%rdx
+  8016f7:	73 5b                	jae    801754 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8016f9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8016fd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801701:	85 db                	test   %ebx,%ebx
+  801703:	7e 0e                	jle    801713 <print_num+0x43>
+            putch(padc, put_arg);
+  801705:	4c 89 ee             	mov    %r13,%rsi
+  801708:	44 89 f7             	mov    %r14d,%edi
+  80170b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80170e:	83 eb 01             	sub    $0x1,%ebx
+  801711:	75 f2                	jne    801705 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801713:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801717:	48 b9 1d 5c 80 00 00 	movabs $0x805c1d,%rcx
+  80171e:	00 00 00 
+  801721:	48 b8 0c 5c 80 00 00 	movabs $0x805c0c,%rax
+  801728:	00 00 00 
+  80172b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80172f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801733:	ba 00 00 00 00       	mov    $0x0,%edx
+  801738:	49 f7 f7             	div    %r15
+  80173b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80173f:	4c 89 ee             	mov    %r13,%rsi
+  801742:	41 ff d4             	call   *%r12
+}
+  801745:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801749:	5b                   	pop    %rbx
+  80174a:	41 5c                	pop    %r12
+  80174c:	41 5d                	pop    %r13
+  80174e:	41 5e                	pop    %r14
+  801750:	41 5f                	pop    %r15
+  801752:	5d                   	pop    %rbp
+  801753:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801754:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801758:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175d:	49 f7 f7             	div    %r15
+  801760:	48 83 ec 08          	sub    $0x8,%rsp
+  801764:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801768:	52                   	push   %rdx
+  801769:	45 0f be c9          	movsbl %r9b,%r9d
+  80176d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801771:	48 89 c2             	mov    %rax,%rdx
+  801774:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  80177b:	00 00 00 
+  80177e:	ff d0                	call   *%rax
+  801780:	48 83 c4 10          	add    $0x10,%rsp
+  801784:	eb 8d                	jmp    801713 <print_num+0x43>
+
+0000000000801786 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801786:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80178a:	48 8b 06             	mov    (%rsi),%rax
+  80178d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801791:	73 0a                	jae    80179d <sprintputch+0x17>
+        *state->start++ = ch;
+  801793:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801797:	48 89 16             	mov    %rdx,(%rsi)
+  80179a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80179d:	c3                   	ret
+
+000000000080179e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80179e:	55                   	push   %rbp
+  80179f:	48 89 e5             	mov    %rsp,%rbp
+  8017a2:	48 83 ec 50          	sub    $0x50,%rsp
+  8017a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017aa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017ae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017b2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017c1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017c9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017cd:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  8017d4:	00 00 00 
+  8017d7:	ff d0                	call   *%rax
+}
+  8017d9:	c9                   	leave
+  8017da:	c3                   	ret
+
+00000000008017db <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017db:	55                   	push   %rbp
+  8017dc:	48 89 e5             	mov    %rsp,%rbp
+  8017df:	41 57                	push   %r15
+  8017e1:	41 56                	push   %r14
+  8017e3:	41 55                	push   %r13
+  8017e5:	41 54                	push   %r12
+  8017e7:	53                   	push   %rbx
+  8017e8:	48 83 ec 38          	sub    $0x38,%rsp
+  8017ec:	49 89 fe             	mov    %rdi,%r14
+  8017ef:	49 89 f5             	mov    %rsi,%r13
+  8017f2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8017f5:	48 8b 01             	mov    (%rcx),%rax
+  8017f8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8017fc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801800:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801804:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801808:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80180c:	eb 0d                	jmp    80181b <vprintfmt+0x40>
+            putch(ch, put_arg);
+  80180e:	40 0f b6 ff          	movzbl %dil,%edi
+  801812:	4c 89 ee             	mov    %r13,%rsi
+  801815:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801818:	4c 89 e3             	mov    %r12,%rbx
+  80181b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80181f:	0f b6 3b             	movzbl (%rbx),%edi
+  801822:	40 80 ff 25          	cmp    $0x25,%dil
+  801826:	74 14                	je     80183c <vprintfmt+0x61>
+            if (!ch) return;
+  801828:	40 84 ff             	test   %dil,%dil
+  80182b:	75 e1                	jne    80180e <vprintfmt+0x33>
+}
+  80182d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801831:	5b                   	pop    %rbx
+  801832:	41 5c                	pop    %r12
+  801834:	41 5d                	pop    %r13
+  801836:	41 5e                	pop    %r14
+  801838:	41 5f                	pop    %r15
+  80183a:	5d                   	pop    %rbp
+  80183b:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  80183c:	be 00 00 00 00       	mov    $0x0,%esi
+  801841:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801845:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80184a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801850:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801857:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80185b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801860:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801865:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801868:	83 e8 23             	sub    $0x23,%eax
+  80186b:	3c 57                	cmp    $0x57,%al
+  80186d:	0f 87 67 06 00 00    	ja     801eda <vprintfmt+0x6ff>
+  801873:	0f b6 c0             	movzbl %al,%eax
+  801876:	48 b9 a0 5d 80 00 00 	movabs $0x805da0,%rcx
+  80187d:	00 00 00 
+  801880:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801883:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801886:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80188a:	eb cf                	jmp    80185b <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80188c:	49 89 dc             	mov    %rbx,%r12
+  80188f:	be 01 00 00 00       	mov    $0x1,%esi
+  801894:	eb c5                	jmp    80185b <vprintfmt+0x80>
+            padc = ch;
+  801896:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80189a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80189d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018a0:	eb b9                	jmp    80185b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8018a8:	77 24                	ja     8018ce <vprintfmt+0xf3>
+  8018aa:	89 c1                	mov    %eax,%ecx
+  8018ac:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018b0:	83 c0 08             	add    $0x8,%eax
+  8018b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018b6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018b9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018bc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018c0:	79 99                	jns    80185b <vprintfmt+0x80>
+                width = precision;
+  8018c2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018c6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018cc:	eb 8d                	jmp    80185b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018ce:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018d2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018da:	eb da                	jmp    8018b6 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018dc:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018e1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018e5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018eb:	3c 39                	cmp    $0x39,%al
+  8018ed:	77 1c                	ja     80190b <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8018ef:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8018f3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8018f7:	0f b6 c0             	movzbl %al,%eax
+  8018fa:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018ff:	0f b6 03             	movzbl (%rbx),%eax
+  801902:	3c 39                	cmp    $0x39,%al
+  801904:	76 e9                	jbe    8018ef <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801906:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801909:	eb b1                	jmp    8018bc <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  80190b:	49 89 dc             	mov    %rbx,%r12
+  80190e:	eb ac                	jmp    8018bc <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801910:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801913:	85 c9                	test   %ecx,%ecx
+  801915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191a:	0f 49 c1             	cmovns %ecx,%eax
+  80191d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801920:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801923:	e9 33 ff ff ff       	jmp    80185b <vprintfmt+0x80>
+            lflag++;
+  801928:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80192b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80192e:	e9 28 ff ff ff       	jmp    80185b <vprintfmt+0x80>
+            lflag--;
+  801933:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801936:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801939:	e9 1d ff ff ff       	jmp    80185b <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  80193e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801941:	83 f8 2f             	cmp    $0x2f,%eax
+  801944:	77 19                	ja     80195f <vprintfmt+0x184>
+  801946:	89 c2                	mov    %eax,%edx
+  801948:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80194c:	83 c0 08             	add    $0x8,%eax
+  80194f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801952:	8b 3a                	mov    (%rdx),%edi
+  801954:	4c 89 ee             	mov    %r13,%rsi
+  801957:	41 ff d6             	call   *%r14
+            break;
+  80195a:	e9 bc fe ff ff       	jmp    80181b <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80195f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801963:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801967:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80196b:	eb e5                	jmp    801952 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  80196d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801970:	83 f8 2f             	cmp    $0x2f,%eax
+  801973:	77 5a                	ja     8019cf <vprintfmt+0x1f4>
+  801975:	89 c2                	mov    %eax,%edx
+  801977:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80197b:	83 c0 08             	add    $0x8,%eax
+  80197e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801981:	8b 02                	mov    (%rdx),%eax
+  801983:	89 c1                	mov    %eax,%ecx
+  801985:	f7 d9                	neg    %ecx
+  801987:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80198a:	83 f9 13             	cmp    $0x13,%ecx
+  80198d:	7f 4e                	jg     8019dd <vprintfmt+0x202>
+  80198f:	48 63 c1             	movslq %ecx,%rax
+  801992:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  801999:	00 00 00 
+  80199c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019a0:	48 85 c0             	test   %rax,%rax
+  8019a3:	74 38                	je     8019dd <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019a5:	48 89 c1             	mov    %rax,%rcx
+  8019a8:	48 ba 28 62 80 00 00 	movabs $0x806228,%rdx
+  8019af:	00 00 00 
+  8019b2:	4c 89 ee             	mov    %r13,%rsi
+  8019b5:	4c 89 f7             	mov    %r14,%rdi
+  8019b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bd:	49 b8 9e 17 80 00 00 	movabs $0x80179e,%r8
+  8019c4:	00 00 00 
+  8019c7:	41 ff d0             	call   *%r8
+  8019ca:	e9 4c fe ff ff       	jmp    80181b <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019db:	eb a4                	jmp    801981 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019dd:	48 ba 35 5c 80 00 00 	movabs $0x805c35,%rdx
+  8019e4:	00 00 00 
+  8019e7:	4c 89 ee             	mov    %r13,%rsi
+  8019ea:	4c 89 f7             	mov    %r14,%rdi
+  8019ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f2:	49 b8 9e 17 80 00 00 	movabs $0x80179e,%r8
+  8019f9:	00 00 00 
+  8019fc:	41 ff d0             	call   *%r8
+  8019ff:	e9 17 fe ff ff       	jmp    80181b <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a07:	83 f8 2f             	cmp    $0x2f,%eax
+  801a0a:	77 6c                	ja     801a78 <vprintfmt+0x29d>
+  801a0c:	89 c2                	mov    %eax,%edx
+  801a0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a12:	83 c0 08             	add    $0x8,%eax
+  801a15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a18:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a1b:	48 85 f6             	test   %rsi,%rsi
+  801a1e:	48 b8 2e 5c 80 00 00 	movabs $0x805c2e,%rax
+  801a25:	00 00 00 
+  801a28:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a2c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a30:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a34:	7e 06                	jle    801a3c <vprintfmt+0x261>
+  801a36:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a3a:	75 4a                	jne    801a86 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a40:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a44:	0f b6 00             	movzbl (%rax),%eax
+  801a47:	84 c0                	test   %al,%al
+  801a49:	0f 85 9a 00 00 00    	jne    801ae9 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a52:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	0f 8e bd fd ff ff    	jle    80181b <vprintfmt+0x40>
+  801a5e:	4c 89 ee             	mov    %r13,%rsi
+  801a61:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a66:	41 ff d6             	call   *%r14
+  801a69:	41 83 ec 01          	sub    $0x1,%r12d
+  801a6d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a71:	75 eb                	jne    801a5e <vprintfmt+0x283>
+  801a73:	e9 a3 fd ff ff       	jmp    80181b <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a84:	eb 92                	jmp    801a18 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a86:	49 63 f7             	movslq %r15d,%rsi
+  801a89:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801a8d:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  801a94:	00 00 00 
+  801a97:	ff d0                	call   *%rax
+  801a99:	48 89 c2             	mov    %rax,%rdx
+  801a9c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a9f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801aa1:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801aa4:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	7e 91                	jle    801a3c <vprintfmt+0x261>
+  801aab:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ab0:	4c 89 ee             	mov    %r13,%rsi
+  801ab3:	44 89 e7             	mov    %r12d,%edi
+  801ab6:	41 ff d6             	call   *%r14
+  801ab9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801abd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ac0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ac3:	75 eb                	jne    801ab0 <vprintfmt+0x2d5>
+  801ac5:	e9 72 ff ff ff       	jmp    801a3c <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801aca:	0f b6 f8             	movzbl %al,%edi
+  801acd:	4c 89 ee             	mov    %r13,%rsi
+  801ad0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ad3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad7:	49 83 c4 01          	add    $0x1,%r12
+  801adb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ae1:	84 c0                	test   %al,%al
+  801ae3:	0f 84 66 ff ff ff    	je     801a4f <vprintfmt+0x274>
+  801ae9:	45 85 ff             	test   %r15d,%r15d
+  801aec:	78 0a                	js     801af8 <vprintfmt+0x31d>
+  801aee:	41 83 ef 01          	sub    $0x1,%r15d
+  801af2:	0f 88 57 ff ff ff    	js     801a4f <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801af8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801afc:	74 cc                	je     801aca <vprintfmt+0x2ef>
+  801afe:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b01:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b06:	80 fa 5e             	cmp    $0x5e,%dl
+  801b09:	77 c2                	ja     801acd <vprintfmt+0x2f2>
+  801b0b:	eb bd                	jmp    801aca <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b0d:	40 84 f6             	test   %sil,%sil
+  801b10:	75 26                	jne    801b38 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b12:	85 d2                	test   %edx,%edx
+  801b14:	74 59                	je     801b6f <vprintfmt+0x394>
+  801b16:	83 fa 01             	cmp    $0x1,%edx
+  801b19:	74 7b                	je     801b96 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b1e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b21:	0f 87 96 00 00 00    	ja     801bbd <vprintfmt+0x3e2>
+  801b27:	89 c2                	mov    %eax,%edx
+  801b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b2d:	83 c0 08             	add    $0x8,%eax
+  801b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b33:	4c 8b 22             	mov    (%rdx),%r12
+  801b36:	eb 17                	jmp    801b4f <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801b3e:	77 21                	ja     801b61 <vprintfmt+0x386>
+  801b40:	89 c2                	mov    %eax,%edx
+  801b42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b46:	83 c0 08             	add    $0x8,%eax
+  801b49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b4c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b4f:	4d 85 e4             	test   %r12,%r12
+  801b52:	78 7a                	js     801bce <vprintfmt+0x3f3>
+            num = i;
+  801b54:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b5c:	e9 56 02 00 00       	jmp    801db7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b6d:	eb dd                	jmp    801b4c <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b72:	83 f8 2f             	cmp    $0x2f,%eax
+  801b75:	77 11                	ja     801b88 <vprintfmt+0x3ad>
+  801b77:	89 c2                	mov    %eax,%edx
+  801b79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b7d:	83 c0 08             	add    $0x8,%eax
+  801b80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b83:	4c 63 22             	movslq (%rdx),%r12
+  801b86:	eb c7                	jmp    801b4f <vprintfmt+0x374>
+  801b88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b94:	eb ed                	jmp    801b83 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801b96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b99:	83 f8 2f             	cmp    $0x2f,%eax
+  801b9c:	77 11                	ja     801baf <vprintfmt+0x3d4>
+  801b9e:	89 c2                	mov    %eax,%edx
+  801ba0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ba4:	83 c0 08             	add    $0x8,%eax
+  801ba7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801baa:	4c 8b 22             	mov    (%rdx),%r12
+  801bad:	eb a0                	jmp    801b4f <vprintfmt+0x374>
+  801baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbb:	eb ed                	jmp    801baa <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bc9:	e9 65 ff ff ff       	jmp    801b33 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bce:	4c 89 ee             	mov    %r13,%rsi
+  801bd1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bd6:	41 ff d6             	call   *%r14
+                i = -i;
+  801bd9:	49 f7 dc             	neg    %r12
+  801bdc:	e9 73 ff ff ff       	jmp    801b54 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801be1:	40 84 f6             	test   %sil,%sil
+  801be4:	75 2e                	jne    801c14 <vprintfmt+0x439>
+    switch (lflag) {
+  801be6:	85 d2                	test   %edx,%edx
+  801be8:	7f 59                	jg     801c43 <vprintfmt+0x468>
+  801bea:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801bed:	7d 7a                	jge    801c69 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801bef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bf2:	83 f8 2f             	cmp    $0x2f,%eax
+  801bf5:	0f 87 aa 00 00 00    	ja     801ca5 <vprintfmt+0x4ca>
+  801bfb:	89 c2                	mov    %eax,%edx
+  801bfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c01:	83 c0 08             	add    $0x8,%eax
+  801c04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c07:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c0f:	e9 a3 01 00 00       	jmp    801db7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c17:	83 f8 2f             	cmp    $0x2f,%eax
+  801c1a:	77 19                	ja     801c35 <vprintfmt+0x45a>
+  801c1c:	89 c2                	mov    %eax,%edx
+  801c1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c22:	83 c0 08             	add    $0x8,%eax
+  801c25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c28:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c2b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c30:	e9 82 01 00 00       	jmp    801db7 <vprintfmt+0x5dc>
+  801c35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c41:	eb e5                	jmp    801c28 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c43:	83 fa 01             	cmp    $0x1,%edx
+  801c46:	75 a7                	jne    801bef <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c4b:	83 f8 2f             	cmp    $0x2f,%eax
+  801c4e:	77 47                	ja     801c97 <vprintfmt+0x4bc>
+  801c50:	89 c2                	mov    %eax,%edx
+  801c52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c56:	83 c0 08             	add    $0x8,%eax
+  801c59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c5c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c64:	e9 4e 01 00 00       	jmp    801db7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c6c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c6f:	77 18                	ja     801c89 <vprintfmt+0x4ae>
+  801c71:	89 c2                	mov    %eax,%edx
+  801c73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c77:	83 c0 08             	add    $0x8,%eax
+  801c7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c7d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c7f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c84:	e9 2e 01 00 00       	jmp    801db7 <vprintfmt+0x5dc>
+  801c89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c95:	eb e6                	jmp    801c7d <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801c97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca3:	eb b7                	jmp    801c5c <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ca5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb1:	e9 51 ff ff ff       	jmp    801c07 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cb6:	40 84 f6             	test   %sil,%sil
+  801cb9:	75 2e                	jne    801ce9 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cbb:	85 d2                	test   %edx,%edx
+  801cbd:	7f 59                	jg     801d18 <vprintfmt+0x53d>
+  801cbf:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cc2:	7d 77                	jge    801d3b <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cc7:	83 f8 2f             	cmp    $0x2f,%eax
+  801cca:	0f 87 a4 00 00 00    	ja     801d74 <vprintfmt+0x599>
+  801cd0:	89 c2                	mov    %eax,%edx
+  801cd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cd6:	83 c0 08             	add    $0x8,%eax
+  801cd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cdc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cdf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801ce4:	e9 ce 00 00 00       	jmp    801db7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ce9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cec:	83 f8 2f             	cmp    $0x2f,%eax
+  801cef:	77 19                	ja     801d0a <vprintfmt+0x52f>
+  801cf1:	89 c2                	mov    %eax,%edx
+  801cf3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf7:	83 c0 08             	add    $0x8,%eax
+  801cfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cfd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d00:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d05:	e9 ad 00 00 00       	jmp    801db7 <vprintfmt+0x5dc>
+  801d0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d16:	eb e5                	jmp    801cfd <vprintfmt+0x522>
+    switch (lflag) {
+  801d18:	83 fa 01             	cmp    $0x1,%edx
+  801d1b:	75 a7                	jne    801cc4 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d20:	83 f8 2f             	cmp    $0x2f,%eax
+  801d23:	77 41                	ja     801d66 <vprintfmt+0x58b>
+  801d25:	89 c2                	mov    %eax,%edx
+  801d27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d2b:	83 c0 08             	add    $0x8,%eax
+  801d2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d34:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d39:	eb 7c                	jmp    801db7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d3e:	83 f8 2f             	cmp    $0x2f,%eax
+  801d41:	77 15                	ja     801d58 <vprintfmt+0x57d>
+  801d43:	89 c2                	mov    %eax,%edx
+  801d45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d49:	83 c0 08             	add    $0x8,%eax
+  801d4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d4f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d51:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d56:	eb 5f                	jmp    801db7 <vprintfmt+0x5dc>
+  801d58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d64:	eb e9                	jmp    801d4f <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d72:	eb bd                	jmp    801d31 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d80:	e9 57 ff ff ff       	jmp    801cdc <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d85:	4c 89 ee             	mov    %r13,%rsi
+  801d88:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d8d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801d90:	4c 89 ee             	mov    %r13,%rsi
+  801d93:	bf 78 00 00 00       	mov    $0x78,%edi
+  801d98:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801d9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d9e:	83 f8 2f             	cmp    $0x2f,%eax
+  801da1:	77 47                	ja     801dea <vprintfmt+0x60f>
+  801da3:	89 c2                	mov    %eax,%edx
+  801da5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801da9:	83 c0 08             	add    $0x8,%eax
+  801dac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801daf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801db2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801db7:	48 83 ec 08          	sub    $0x8,%rsp
+  801dbb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dbf:	0f 94 c0             	sete   %al
+  801dc2:	0f b6 c0             	movzbl %al,%eax
+  801dc5:	50                   	push   %rax
+  801dc6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801dcb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801dcf:	4c 89 ee             	mov    %r13,%rsi
+  801dd2:	4c 89 f7             	mov    %r14,%rdi
+  801dd5:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  801ddc:	00 00 00 
+  801ddf:	ff d0                	call   *%rax
+            break;
+  801de1:	48 83 c4 10          	add    $0x10,%rsp
+  801de5:	e9 31 fa ff ff       	jmp    80181b <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801dea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801df2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801df6:	eb b7                	jmp    801daf <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801df8:	40 84 f6             	test   %sil,%sil
+  801dfb:	75 2b                	jne    801e28 <vprintfmt+0x64d>
+    switch (lflag) {
+  801dfd:	85 d2                	test   %edx,%edx
+  801dff:	7f 56                	jg     801e57 <vprintfmt+0x67c>
+  801e01:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e04:	7d 77                	jge    801e7d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e09:	83 f8 2f             	cmp    $0x2f,%eax
+  801e0c:	0f 87 a7 00 00 00    	ja     801eb9 <vprintfmt+0x6de>
+  801e12:	89 c2                	mov    %eax,%edx
+  801e14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e18:	83 c0 08             	add    $0x8,%eax
+  801e1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e1e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e26:	eb 8f                	jmp    801db7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e2b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e2e:	77 19                	ja     801e49 <vprintfmt+0x66e>
+  801e30:	89 c2                	mov    %eax,%edx
+  801e32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e36:	83 c0 08             	add    $0x8,%eax
+  801e39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e44:	e9 6e ff ff ff       	jmp    801db7 <vprintfmt+0x5dc>
+  801e49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e55:	eb e5                	jmp    801e3c <vprintfmt+0x661>
+    switch (lflag) {
+  801e57:	83 fa 01             	cmp    $0x1,%edx
+  801e5a:	75 aa                	jne    801e06 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  801e62:	77 47                	ja     801eab <vprintfmt+0x6d0>
+  801e64:	89 c2                	mov    %eax,%edx
+  801e66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e6a:	83 c0 08             	add    $0x8,%eax
+  801e6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e70:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e73:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e78:	e9 3a ff ff ff       	jmp    801db7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e80:	83 f8 2f             	cmp    $0x2f,%eax
+  801e83:	77 18                	ja     801e9d <vprintfmt+0x6c2>
+  801e85:	89 c2                	mov    %eax,%edx
+  801e87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e8b:	83 c0 08             	add    $0x8,%eax
+  801e8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e91:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801e93:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801e98:	e9 1a ff ff ff       	jmp    801db7 <vprintfmt+0x5dc>
+  801e9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea9:	eb e6                	jmp    801e91 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801eab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb7:	eb b7                	jmp    801e70 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801eb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ebd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec5:	e9 54 ff ff ff       	jmp    801e1e <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801eca:	4c 89 ee             	mov    %r13,%rsi
+  801ecd:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ed2:	41 ff d6             	call   *%r14
+            break;
+  801ed5:	e9 41 f9 ff ff       	jmp    80181b <vprintfmt+0x40>
+            putch('%', put_arg);
+  801eda:	4c 89 ee             	mov    %r13,%rsi
+  801edd:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ee2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ee5:	48 83 eb 01          	sub    $0x1,%rbx
+  801ee9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801eed:	75 f6                	jne    801ee5 <vprintfmt+0x70a>
+  801eef:	e9 27 f9 ff ff       	jmp    80181b <vprintfmt+0x40>
+
+0000000000801ef4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801ef4:	55                   	push   %rbp
+  801ef5:	48 89 e5             	mov    %rsp,%rbp
+  801ef8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801efc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f00:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f05:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f09:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f10:	48 85 ff             	test   %rdi,%rdi
+  801f13:	74 2b                	je     801f40 <vsnprintf+0x4c>
+  801f15:	48 85 f6             	test   %rsi,%rsi
+  801f18:	74 26                	je     801f40 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f1a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f1e:	48 bf 86 17 80 00 00 	movabs $0x801786,%rdi
+  801f25:	00 00 00 
+  801f28:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  801f2f:	00 00 00 
+  801f32:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f38:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f3b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f3e:	c9                   	leave
+  801f3f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f45:	eb f7                	jmp    801f3e <vsnprintf+0x4a>
+
+0000000000801f47 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f47:	55                   	push   %rbp
+  801f48:	48 89 e5             	mov    %rsp,%rbp
+  801f4b:	48 83 ec 50          	sub    $0x50,%rsp
+  801f4f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f53:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f57:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f5b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f62:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f6a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f6e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f72:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f76:	48 b8 f4 1e 80 00 00 	movabs $0x801ef4,%rax
+  801f7d:	00 00 00 
+  801f80:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f82:	c9                   	leave
+  801f83:	c3                   	ret
+
+0000000000801f84 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f84:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f87:	74 10                	je     801f99 <strlen+0x15>
+    size_t n = 0;
+  801f89:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801f8e:	48 83 c0 01          	add    $0x1,%rax
+  801f92:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801f96:	75 f6                	jne    801f8e <strlen+0xa>
+  801f98:	c3                   	ret
+    size_t n = 0;
+  801f99:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801f9e:	c3                   	ret
+
+0000000000801f9f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801f9f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fa2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fa7:	48 85 f6             	test   %rsi,%rsi
+  801faa:	74 11                	je     801fbd <strnlen+0x1e>
+  801fac:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fb0:	74 0c                	je     801fbe <strnlen+0x1f>
+  801fb2:	48 83 c2 01          	add    $0x1,%rdx
+  801fb6:	48 39 d0             	cmp    %rdx,%rax
+  801fb9:	75 f1                	jne    801fac <strnlen+0xd>
+  801fbb:	eb 04                	jmp    801fc1 <strnlen+0x22>
+  801fbd:	c3                   	ret
+  801fbe:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fc1:	c3                   	ret
+
+0000000000801fc2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fc2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fca:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fce:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fd1:	48 83 c2 01          	add    $0x1,%rdx
+  801fd5:	84 c9                	test   %cl,%cl
+  801fd7:	75 f1                	jne    801fca <strcpy+0x8>
+        ;
+    return res;
+}
+  801fd9:	c3                   	ret
+
+0000000000801fda <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fda:	55                   	push   %rbp
+  801fdb:	48 89 e5             	mov    %rsp,%rbp
+  801fde:	41 54                	push   %r12
+  801fe0:	53                   	push   %rbx
+  801fe1:	48 89 fb             	mov    %rdi,%rbx
+  801fe4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801fe7:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801ff3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801ff7:	4c 89 e6             	mov    %r12,%rsi
+  801ffa:	48 b8 c2 1f 80 00 00 	movabs $0x801fc2,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+    return dst;
+}
+  802006:	48 89 d8             	mov    %rbx,%rax
+  802009:	5b                   	pop    %rbx
+  80200a:	41 5c                	pop    %r12
+  80200c:	5d                   	pop    %rbp
+  80200d:	c3                   	ret
+
+000000000080200e <toupper>:
+
+int
+toupper(int ch) {
+  80200e:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802010:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802013:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802016:	83 f9 1a             	cmp    $0x1a,%ecx
+  802019:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80201c:	c3                   	ret
+
+000000000080201d <tolower>:
+
+int
+tolower(int ch) {
+  80201d:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80201f:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802022:	8d 57 20             	lea    0x20(%rdi),%edx
+  802025:	83 f9 1a             	cmp    $0x1a,%ecx
+  802028:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80202b:	c3                   	ret
+
+000000000080202c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80202c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80202f:	48 85 d2             	test   %rdx,%rdx
+  802032:	74 1f                	je     802053 <strncpy+0x27>
+  802034:	48 01 fa             	add    %rdi,%rdx
+  802037:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80203a:	48 83 c1 01          	add    $0x1,%rcx
+  80203e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802042:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802046:	41 80 f8 01          	cmp    $0x1,%r8b
+  80204a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80204e:	48 39 ca             	cmp    %rcx,%rdx
+  802051:	75 e7                	jne    80203a <strncpy+0xe>
+    }
+    return ret;
+}
+  802053:	c3                   	ret
+
+0000000000802054 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802054:	48 89 f8             	mov    %rdi,%rax
+  802057:	48 85 d2             	test   %rdx,%rdx
+  80205a:	74 24                	je     802080 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80205c:	48 83 ea 01          	sub    $0x1,%rdx
+  802060:	74 1b                	je     80207d <strlcpy+0x29>
+  802062:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802066:	0f b6 16             	movzbl (%rsi),%edx
+  802069:	84 d2                	test   %dl,%dl
+  80206b:	74 10                	je     80207d <strlcpy+0x29>
+            *dst++ = *src++;
+  80206d:	48 83 c6 01          	add    $0x1,%rsi
+  802071:	48 83 c0 01          	add    $0x1,%rax
+  802075:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802078:	48 39 c8             	cmp    %rcx,%rax
+  80207b:	75 e9                	jne    802066 <strlcpy+0x12>
+        *dst = '\0';
+  80207d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802080:	48 29 f8             	sub    %rdi,%rax
+}
+  802083:	c3                   	ret
+
+0000000000802084 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802084:	0f b6 07             	movzbl (%rdi),%eax
+  802087:	84 c0                	test   %al,%al
+  802089:	74 13                	je     80209e <strcmp+0x1a>
+  80208b:	38 06                	cmp    %al,(%rsi)
+  80208d:	75 0f                	jne    80209e <strcmp+0x1a>
+  80208f:	48 83 c7 01          	add    $0x1,%rdi
+  802093:	48 83 c6 01          	add    $0x1,%rsi
+  802097:	0f b6 07             	movzbl (%rdi),%eax
+  80209a:	84 c0                	test   %al,%al
+  80209c:	75 ed                	jne    80208b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80209e:	0f b6 c0             	movzbl %al,%eax
+  8020a1:	0f b6 16             	movzbl (%rsi),%edx
+  8020a4:	29 d0                	sub    %edx,%eax
+}
+  8020a6:	c3                   	ret
+
+00000000008020a7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020a7:	48 85 d2             	test   %rdx,%rdx
+  8020aa:	74 1f                	je     8020cb <strncmp+0x24>
+  8020ac:	0f b6 07             	movzbl (%rdi),%eax
+  8020af:	84 c0                	test   %al,%al
+  8020b1:	74 1e                	je     8020d1 <strncmp+0x2a>
+  8020b3:	3a 06                	cmp    (%rsi),%al
+  8020b5:	75 1a                	jne    8020d1 <strncmp+0x2a>
+  8020b7:	48 83 c7 01          	add    $0x1,%rdi
+  8020bb:	48 83 c6 01          	add    $0x1,%rsi
+  8020bf:	48 83 ea 01          	sub    $0x1,%rdx
+  8020c3:	75 e7                	jne    8020ac <strncmp+0x5>
+
+    if (!n) return 0;
+  8020c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ca:	c3                   	ret
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d0:	c3                   	ret
+  8020d1:	48 85 d2             	test   %rdx,%rdx
+  8020d4:	74 09                	je     8020df <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020d6:	0f b6 07             	movzbl (%rdi),%eax
+  8020d9:	0f b6 16             	movzbl (%rsi),%edx
+  8020dc:	29 d0                	sub    %edx,%eax
+  8020de:	c3                   	ret
+    if (!n) return 0;
+  8020df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020e4:	c3                   	ret
+
+00000000008020e5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020e5:	0f b6 17             	movzbl (%rdi),%edx
+  8020e8:	84 d2                	test   %dl,%dl
+  8020ea:	74 18                	je     802104 <strchr+0x1f>
+        if (*str == c) {
+  8020ec:	0f be d2             	movsbl %dl,%edx
+  8020ef:	39 f2                	cmp    %esi,%edx
+  8020f1:	74 17                	je     80210a <strchr+0x25>
+    for (; *str; str++) {
+  8020f3:	48 83 c7 01          	add    $0x1,%rdi
+  8020f7:	0f b6 17             	movzbl (%rdi),%edx
+  8020fa:	84 d2                	test   %dl,%dl
+  8020fc:	75 ee                	jne    8020ec <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8020fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802103:	c3                   	ret
+  802104:	b8 00 00 00 00       	mov    $0x0,%eax
+  802109:	c3                   	ret
+  80210a:	48 89 f8             	mov    %rdi,%rax
+}
+  80210d:	c3                   	ret
+
+000000000080210e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80210e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802111:	0f b6 17             	movzbl (%rdi),%edx
+  802114:	84 d2                	test   %dl,%dl
+  802116:	74 13                	je     80212b <strfind+0x1d>
+  802118:	0f be d2             	movsbl %dl,%edx
+  80211b:	39 f2                	cmp    %esi,%edx
+  80211d:	74 0b                	je     80212a <strfind+0x1c>
+  80211f:	48 83 c0 01          	add    $0x1,%rax
+  802123:	0f b6 10             	movzbl (%rax),%edx
+  802126:	84 d2                	test   %dl,%dl
+  802128:	75 ee                	jne    802118 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80212a:	c3                   	ret
+  80212b:	c3                   	ret
+
+000000000080212c <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80212c:	48 39 f7             	cmp    %rsi,%rdi
+  80212f:	74 65                	je     802196 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802131:	55                   	push   %rbp
+  802132:	48 89 e5             	mov    %rsp,%rbp
+  802135:	41 57                	push   %r15
+  802137:	41 56                	push   %r14
+  802139:	41 55                	push   %r13
+  80213b:	41 54                	push   %r12
+  80213d:	53                   	push   %rbx
+  80213e:	48 83 ec 18          	sub    $0x18,%rsp
+  802142:	48 89 fb             	mov    %rdi,%rbx
+  802145:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802148:	49 bf 1d 20 80 00 00 	movabs $0x80201d,%r15
+  80214f:	00 00 00 
+  802152:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802156:	41 0f b6 fd          	movzbl %r13b,%edi
+  80215a:	41 ff d7             	call   *%r15
+  80215d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802160:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802165:	41 0f b6 fe          	movzbl %r14b,%edi
+  802169:	41 ff d7             	call   *%r15
+  80216c:	89 c2                	mov    %eax,%edx
+  80216e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802171:	29 d0                	sub    %edx,%eax
+  802173:	75 12                	jne    802187 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802175:	48 83 c3 01          	add    $0x1,%rbx
+  802179:	45 84 ed             	test   %r13b,%r13b
+  80217c:	74 09                	je     802187 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80217e:	49 83 c4 01          	add    $0x1,%r12
+  802182:	45 84 f6             	test   %r14b,%r14b
+  802185:	75 cb                	jne    802152 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802187:	48 83 c4 18          	add    $0x18,%rsp
+  80218b:	5b                   	pop    %rbx
+  80218c:	41 5c                	pop    %r12
+  80218e:	41 5d                	pop    %r13
+  802190:	41 5e                	pop    %r14
+  802192:	41 5f                	pop    %r15
+  802194:	5d                   	pop    %rbp
+  802195:	c3                   	ret
+    if (p1 == p2) return 0;
+  802196:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80219b:	c3                   	ret
+
+000000000080219c <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80219c:	48 39 f7             	cmp    %rsi,%rdi
+  80219f:	74 7d                	je     80221e <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021a1:	55                   	push   %rbp
+  8021a2:	48 89 e5             	mov    %rsp,%rbp
+  8021a5:	41 57                	push   %r15
+  8021a7:	41 56                	push   %r14
+  8021a9:	41 55                	push   %r13
+  8021ab:	41 54                	push   %r12
+  8021ad:	53                   	push   %rbx
+  8021ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8021b2:	48 89 fb             	mov    %rdi,%rbx
+  8021b5:	49 89 f4             	mov    %rsi,%r12
+  8021b8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021c0:	49 bf 1d 20 80 00 00 	movabs $0x80201d,%r15
+  8021c7:	00 00 00 
+    while (n--) {
+  8021ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021ce:	48 39 c3             	cmp    %rax,%rbx
+  8021d1:	74 37                	je     80220a <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021d3:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021d7:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021db:	41 ff d7             	call   *%r15
+  8021de:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021e1:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021e6:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021ea:	41 ff d7             	call   *%r15
+  8021ed:	89 c2                	mov    %eax,%edx
+  8021ef:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021f2:	29 d0                	sub    %edx,%eax
+  8021f4:	75 19                	jne    80220f <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8021f6:	48 83 c3 01          	add    $0x1,%rbx
+  8021fa:	45 84 ed             	test   %r13b,%r13b
+  8021fd:	74 10                	je     80220f <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8021ff:	49 83 c4 01          	add    $0x1,%r12
+  802203:	45 84 f6             	test   %r14b,%r14b
+  802206:	75 c2                	jne    8021ca <strncasecmp+0x2e>
+  802208:	eb 05                	jmp    80220f <strncasecmp+0x73>
+  80220a:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80220f:	48 83 c4 18          	add    $0x18,%rsp
+  802213:	5b                   	pop    %rbx
+  802214:	41 5c                	pop    %r12
+  802216:	41 5d                	pop    %r13
+  802218:	41 5e                	pop    %r14
+  80221a:	41 5f                	pop    %r15
+  80221c:	5d                   	pop    %rbp
+  80221d:	c3                   	ret
+    if (p1 == p2) return 0;
+  80221e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802223:	c3                   	ret
+
+0000000000802224 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802224:	83 e7 df             	and    $0xffffffdf,%edi
+  802227:	83 ef 41             	sub    $0x41,%edi
+  80222a:	83 ff 19             	cmp    $0x19,%edi
+  80222d:	0f 96 c0             	setbe  %al
+}
+  802230:	c3                   	ret
+
+0000000000802231 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802231:	83 ff 20             	cmp    $0x20,%edi
+  802234:	0f 94 c0             	sete   %al
+  802237:	83 ff 09             	cmp    $0x9,%edi
+  80223a:	0f 94 c2             	sete   %dl
+  80223d:	09 d0                	or     %edx,%eax
+}
+  80223f:	c3                   	ret
+
+0000000000802240 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802246:	48 bf 1f 61 80 00 00 	movabs $0x80611f,%rdi
+  80224d:	00 00 00 
+  802250:	48 b8 e5 20 80 00 00 	movabs $0x8020e5,%rax
+  802257:	00 00 00 
+  80225a:	ff d0                	call   *%rax
+  80225c:	48 85 c0             	test   %rax,%rax
+  80225f:	0f 95 c0             	setne  %al
+}
+  802262:	5d                   	pop    %rbp
+  802263:	c3                   	ret
+
+0000000000802264 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802264:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802267:	48 89 f8             	mov    %rdi,%rax
+  80226a:	48 f7 d8             	neg    %rax
+  80226d:	83 e0 07             	and    $0x7,%eax
+  802270:	49 89 d1             	mov    %rdx,%r9
+  802273:	49 29 c1             	sub    %rax,%r9
+  802276:	78 36                	js     8022ae <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802278:	40 0f b6 c6          	movzbl %sil,%eax
+  80227c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802283:	01 01 01 
+  802286:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80228a:	40 f6 c7 07          	test   $0x7,%dil
+  80228e:	75 38                	jne    8022c8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802290:	4c 89 c9             	mov    %r9,%rcx
+  802293:	48 c1 f9 03          	sar    $0x3,%rcx
+  802297:	74 0c                	je     8022a5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802299:	fc                   	cld
+  80229a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80229d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022a1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022a5:	4d 85 c9             	test   %r9,%r9
+  8022a8:	75 45                	jne    8022ef <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022aa:	4c 89 c0             	mov    %r8,%rax
+  8022ad:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022ae:	48 85 d2             	test   %rdx,%rdx
+  8022b1:	74 f7                	je     8022aa <memset+0x46>
+  8022b3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022b6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022b9:	48 83 c0 01          	add    $0x1,%rax
+  8022bd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022c1:	48 39 c2             	cmp    %rax,%rdx
+  8022c4:	75 f3                	jne    8022b9 <memset+0x55>
+  8022c6:	eb e2                	jmp    8022aa <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022c8:	40 f6 c7 01          	test   $0x1,%dil
+  8022cc:	74 06                	je     8022d4 <memset+0x70>
+  8022ce:	88 07                	mov    %al,(%rdi)
+  8022d0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022d4:	40 f6 c7 02          	test   $0x2,%dil
+  8022d8:	74 07                	je     8022e1 <memset+0x7d>
+  8022da:	66 89 07             	mov    %ax,(%rdi)
+  8022dd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022e1:	40 f6 c7 04          	test   $0x4,%dil
+  8022e5:	74 a9                	je     802290 <memset+0x2c>
+  8022e7:	89 07                	mov    %eax,(%rdi)
+  8022e9:	48 83 c7 04          	add    $0x4,%rdi
+  8022ed:	eb a1                	jmp    802290 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022ef:	41 f6 c1 04          	test   $0x4,%r9b
+  8022f3:	74 06                	je     8022fb <memset+0x97>
+  8022f5:	89 07                	mov    %eax,(%rdi)
+  8022f7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022fb:	41 f6 c1 02          	test   $0x2,%r9b
+  8022ff:	74 07                	je     802308 <memset+0xa4>
+  802301:	66 89 07             	mov    %ax,(%rdi)
+  802304:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802308:	41 f6 c1 01          	test   $0x1,%r9b
+  80230c:	74 9c                	je     8022aa <memset+0x46>
+  80230e:	88 07                	mov    %al,(%rdi)
+  802310:	eb 98                	jmp    8022aa <memset+0x46>
+
+0000000000802312 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802312:	48 89 f8             	mov    %rdi,%rax
+  802315:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802318:	48 39 fe             	cmp    %rdi,%rsi
+  80231b:	73 3b                	jae    802358 <memmove+0x46>
+  80231d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802321:	48 39 d7             	cmp    %rdx,%rdi
+  802324:	73 32                	jae    802358 <memmove+0x46>
+        s += n;
+        d += n;
+  802326:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80232a:	48 89 d6             	mov    %rdx,%rsi
+  80232d:	48 09 fe             	or     %rdi,%rsi
+  802330:	48 09 ce             	or     %rcx,%rsi
+  802333:	40 f6 c6 07          	test   $0x7,%sil
+  802337:	75 12                	jne    80234b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802339:	48 83 ef 08          	sub    $0x8,%rdi
+  80233d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802341:	48 c1 e9 03          	shr    $0x3,%rcx
+  802345:	fd                   	std
+  802346:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802349:	fc                   	cld
+  80234a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80234b:	48 83 ef 01          	sub    $0x1,%rdi
+  80234f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802353:	fd                   	std
+  802354:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802356:	eb f1                	jmp    802349 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802358:	48 89 f2             	mov    %rsi,%rdx
+  80235b:	48 09 c2             	or     %rax,%rdx
+  80235e:	48 09 ca             	or     %rcx,%rdx
+  802361:	f6 c2 07             	test   $0x7,%dl
+  802364:	75 0c                	jne    802372 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802366:	48 c1 e9 03          	shr    $0x3,%rcx
+  80236a:	48 89 c7             	mov    %rax,%rdi
+  80236d:	fc                   	cld
+  80236e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802371:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802372:	48 89 c7             	mov    %rax,%rdi
+  802375:	fc                   	cld
+  802376:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802378:	c3                   	ret
+
+0000000000802379 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802379:	55                   	push   %rbp
+  80237a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80237d:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  802384:	00 00 00 
+  802387:	ff d0                	call   *%rax
+}
+  802389:	5d                   	pop    %rbp
+  80238a:	c3                   	ret
+
+000000000080238b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80238b:	55                   	push   %rbp
+  80238c:	48 89 e5             	mov    %rsp,%rbp
+  80238f:	41 57                	push   %r15
+  802391:	41 56                	push   %r14
+  802393:	41 55                	push   %r13
+  802395:	41 54                	push   %r12
+  802397:	53                   	push   %rbx
+  802398:	48 83 ec 08          	sub    $0x8,%rsp
+  80239c:	49 89 fe             	mov    %rdi,%r14
+  80239f:	49 89 f7             	mov    %rsi,%r15
+  8023a2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023a5:	48 89 f7             	mov    %rsi,%rdi
+  8023a8:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8023af:	00 00 00 
+  8023b2:	ff d0                	call   *%rax
+  8023b4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023b7:	48 89 de             	mov    %rbx,%rsi
+  8023ba:	4c 89 f7             	mov    %r14,%rdi
+  8023bd:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  8023c4:	00 00 00 
+  8023c7:	ff d0                	call   *%rax
+  8023c9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023cc:	48 39 c3             	cmp    %rax,%rbx
+  8023cf:	74 36                	je     802407 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023d1:	48 89 d8             	mov    %rbx,%rax
+  8023d4:	4c 29 e8             	sub    %r13,%rax
+  8023d7:	49 39 c4             	cmp    %rax,%r12
+  8023da:	73 31                	jae    80240d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023dc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023e1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023e5:	4c 89 fe             	mov    %r15,%rsi
+  8023e8:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  8023ef:	00 00 00 
+  8023f2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8023f4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8023f8:	48 83 c4 08          	add    $0x8,%rsp
+  8023fc:	5b                   	pop    %rbx
+  8023fd:	41 5c                	pop    %r12
+  8023ff:	41 5d                	pop    %r13
+  802401:	41 5e                	pop    %r14
+  802403:	41 5f                	pop    %r15
+  802405:	5d                   	pop    %rbp
+  802406:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802407:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80240b:	eb eb                	jmp    8023f8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80240d:	48 83 eb 01          	sub    $0x1,%rbx
+  802411:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802415:	48 89 da             	mov    %rbx,%rdx
+  802418:	4c 89 fe             	mov    %r15,%rsi
+  80241b:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802427:	49 01 de             	add    %rbx,%r14
+  80242a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80242f:	eb c3                	jmp    8023f4 <strlcat+0x69>
+
+0000000000802431 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802431:	48 85 d2             	test   %rdx,%rdx
+  802434:	74 2d                	je     802463 <memcmp+0x32>
+  802436:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80243b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80243f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802444:	44 38 c1             	cmp    %r8b,%cl
+  802447:	75 0f                	jne    802458 <memcmp+0x27>
+    while (n-- > 0) {
+  802449:	48 83 c0 01          	add    $0x1,%rax
+  80244d:	48 39 c2             	cmp    %rax,%rdx
+  802450:	75 e9                	jne    80243b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802452:	b8 00 00 00 00       	mov    $0x0,%eax
+  802457:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802458:	0f b6 c1             	movzbl %cl,%eax
+  80245b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80245f:	44 29 c0             	sub    %r8d,%eax
+  802462:	c3                   	ret
+    return 0;
+  802463:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802468:	c3                   	ret
+
+0000000000802469 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802469:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80246d:	48 39 c7             	cmp    %rax,%rdi
+  802470:	73 0f                	jae    802481 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802472:	40 38 37             	cmp    %sil,(%rdi)
+  802475:	74 0e                	je     802485 <memfind+0x1c>
+    for (; src < end; src++) {
+  802477:	48 83 c7 01          	add    $0x1,%rdi
+  80247b:	48 39 f8             	cmp    %rdi,%rax
+  80247e:	75 f2                	jne    802472 <memfind+0x9>
+  802480:	c3                   	ret
+  802481:	48 89 f8             	mov    %rdi,%rax
+  802484:	c3                   	ret
+  802485:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802488:	c3                   	ret
+
+0000000000802489 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802489:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80248c:	0f b6 37             	movzbl (%rdi),%esi
+  80248f:	40 80 fe 20          	cmp    $0x20,%sil
+  802493:	74 06                	je     80249b <strtol+0x12>
+  802495:	40 80 fe 09          	cmp    $0x9,%sil
+  802499:	75 13                	jne    8024ae <strtol+0x25>
+  80249b:	48 83 c7 01          	add    $0x1,%rdi
+  80249f:	0f b6 37             	movzbl (%rdi),%esi
+  8024a2:	40 80 fe 20          	cmp    $0x20,%sil
+  8024a6:	74 f3                	je     80249b <strtol+0x12>
+  8024a8:	40 80 fe 09          	cmp    $0x9,%sil
+  8024ac:	74 ed                	je     80249b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024ae:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024b1:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024b4:	3c 01                	cmp    $0x1,%al
+  8024b6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024ba:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024c0:	75 0f                	jne    8024d1 <strtol+0x48>
+  8024c2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024c5:	74 14                	je     8024db <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024c7:	85 d2                	test   %edx,%edx
+  8024c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024ce:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024d1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024d6:	4c 63 ca             	movslq %edx,%r9
+  8024d9:	eb 36                	jmp    802511 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024db:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024df:	74 0f                	je     8024f0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024e1:	85 d2                	test   %edx,%edx
+  8024e3:	75 ec                	jne    8024d1 <strtol+0x48>
+        s++;
+  8024e5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024e9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8024ee:	eb e1                	jmp    8024d1 <strtol+0x48>
+        s += 2;
+  8024f0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8024f4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8024f9:	eb d6                	jmp    8024d1 <strtol+0x48>
+            dig -= '0';
+  8024fb:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8024fe:	44 0f b6 c1          	movzbl %cl,%r8d
+  802502:	41 39 d0             	cmp    %edx,%r8d
+  802505:	7d 21                	jge    802528 <strtol+0x9f>
+        val = val * base + dig;
+  802507:	49 0f af c1          	imul   %r9,%rax
+  80250b:	0f b6 c9             	movzbl %cl,%ecx
+  80250e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802511:	48 83 c7 01          	add    $0x1,%rdi
+  802515:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802519:	80 f9 39             	cmp    $0x39,%cl
+  80251c:	76 dd                	jbe    8024fb <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80251e:	80 f9 7b             	cmp    $0x7b,%cl
+  802521:	77 05                	ja     802528 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802523:	83 e9 57             	sub    $0x57,%ecx
+  802526:	eb d6                	jmp    8024fe <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802528:	4d 85 d2             	test   %r10,%r10
+  80252b:	74 03                	je     802530 <strtol+0xa7>
+  80252d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802530:	48 89 c2             	mov    %rax,%rdx
+  802533:	48 f7 da             	neg    %rdx
+  802536:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80253a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80253e:	c3                   	ret
+
+000000000080253f <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80253f:	55                   	push   %rbp
+  802540:	48 89 e5             	mov    %rsp,%rbp
+  802543:	53                   	push   %rbx
+  802544:	48 89 fa             	mov    %rdi,%rdx
+  802547:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80254a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80254f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802554:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802559:	be 00 00 00 00       	mov    $0x0,%esi
+  80255e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802564:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80256a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80256c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802570:	c9                   	leave
+  802571:	c3                   	ret
+
+0000000000802572 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802572:	55                   	push   %rbp
+  802573:	48 89 e5             	mov    %rsp,%rbp
+  802576:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802577:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80257c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802581:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802586:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80258b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802590:	be 00 00 00 00       	mov    $0x0,%esi
+  802595:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80259b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025a1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025a7:	c9                   	leave
+  8025a8:	c3                   	ret
+
+00000000008025a9 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025a9:	55                   	push   %rbp
+  8025aa:	48 89 e5             	mov    %rsp,%rbp
+  8025ad:	53                   	push   %rbx
+  8025ae:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025b1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025d6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025dc:	c9                   	leave
+  8025dd:	c3                   	ret
+
+00000000008025de <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025de:	55                   	push   %rbp
+  8025df:	48 89 e5             	mov    %rsp,%rbp
+  8025e2:	53                   	push   %rbx
+  8025e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025ea:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802603:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802609:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80260f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802611:	48 85 c0             	test   %rax,%rax
+  802614:	7f 06                	jg     80261c <sys_env_destroy+0x3e>
+}
+  802616:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80261a:	c9                   	leave
+  80261b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80261c:	49 89 c0             	mov    %rax,%r8
+  80261f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802624:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80262b:	00 00 00 
+  80262e:	be 27 00 00 00       	mov    $0x27,%esi
+  802633:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80263a:	00 00 00 
+  80263d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802642:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802649:	00 00 00 
+  80264c:	41 ff d1             	call   *%r9
+
+000000000080264f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80264f:	55                   	push   %rbp
+  802650:	48 89 e5             	mov    %rsp,%rbp
+  802653:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802654:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802659:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802663:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802668:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80266d:	be 00 00 00 00       	mov    $0x0,%esi
+  802672:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802678:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80267e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802680:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802684:	c9                   	leave
+  802685:	c3                   	ret
+
+0000000000802686 <sys_yield>:
+
+void
+sys_yield(void) {
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80268b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802690:	ba 00 00 00 00       	mov    $0x0,%edx
+  802695:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80269a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80269f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026b5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026bb:	c9                   	leave
+  8026bc:	c3                   	ret
+
+00000000008026bd <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026bd:	55                   	push   %rbp
+  8026be:	48 89 e5             	mov    %rsp,%rbp
+  8026c1:	53                   	push   %rbx
+  8026c2:	48 89 fa             	mov    %rdi,%rdx
+  8026c5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026c8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026cd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026d4:	00 00 00 
+  8026d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026ed:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8026ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026f3:	c9                   	leave
+  8026f4:	c3                   	ret
+
+00000000008026f5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8026f5:	55                   	push   %rbp
+  8026f6:	48 89 e5             	mov    %rsp,%rbp
+  8026f9:	53                   	push   %rbx
+  8026fa:	49 89 f8             	mov    %rdi,%r8
+  8026fd:	48 89 d3             	mov    %rdx,%rbx
+  802700:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802703:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802708:	4c 89 c2             	mov    %r8,%rdx
+  80270b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80270e:	be 00 00 00 00       	mov    $0x0,%esi
+  802713:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802719:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80271f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802721:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802725:	c9                   	leave
+  802726:	c3                   	ret
+
+0000000000802727 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802727:	55                   	push   %rbp
+  802728:	48 89 e5             	mov    %rsp,%rbp
+  80272b:	53                   	push   %rbx
+  80272c:	48 83 ec 08          	sub    $0x8,%rsp
+  802730:	89 f8                	mov    %edi,%eax
+  802732:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802735:	48 63 f9             	movslq %ecx,%rdi
+  802738:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80273b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802740:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802743:	be 00 00 00 00       	mov    $0x0,%esi
+  802748:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80274e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802754:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802756:	48 85 c0             	test   %rax,%rax
+  802759:	7f 06                	jg     802761 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80275b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80275f:	c9                   	leave
+  802760:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802761:	49 89 c0             	mov    %rax,%r8
+  802764:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802769:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802770:	00 00 00 
+  802773:	be 27 00 00 00       	mov    $0x27,%esi
+  802778:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80277f:	00 00 00 
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+  802787:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  80278e:	00 00 00 
+  802791:	41 ff d1             	call   *%r9
+
+0000000000802794 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802794:	55                   	push   %rbp
+  802795:	48 89 e5             	mov    %rsp,%rbp
+  802798:	53                   	push   %rbx
+  802799:	48 83 ec 08          	sub    $0x8,%rsp
+  80279d:	89 f8                	mov    %edi,%eax
+  80279f:	49 89 f2             	mov    %rsi,%r10
+  8027a2:	48 89 cf             	mov    %rcx,%rdi
+  8027a5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027a8:	48 63 da             	movslq %edx,%rbx
+  8027ab:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ae:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027b3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027b6:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027c1:	48 85 c0             	test   %rax,%rax
+  8027c4:	7f 06                	jg     8027cc <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027ca:	c9                   	leave
+  8027cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027cc:	49 89 c0             	mov    %rax,%r8
+  8027cf:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027d4:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8027db:	00 00 00 
+  8027de:	be 27 00 00 00       	mov    $0x27,%esi
+  8027e3:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8027ea:	00 00 00 
+  8027ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f2:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  8027f9:	00 00 00 
+  8027fc:	41 ff d1             	call   *%r9
+
+00000000008027ff <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8027ff:	55                   	push   %rbp
+  802800:	48 89 e5             	mov    %rsp,%rbp
+  802803:	53                   	push   %rbx
+  802804:	48 83 ec 08          	sub    $0x8,%rsp
+  802808:	48 89 f1             	mov    %rsi,%rcx
+  80280b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  80280e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802811:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802816:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80281b:	be 00 00 00 00       	mov    $0x0,%esi
+  802820:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802826:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80282c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80282e:	48 85 c0             	test   %rax,%rax
+  802831:	7f 06                	jg     802839 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802833:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802837:	c9                   	leave
+  802838:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802839:	49 89 c0             	mov    %rax,%r8
+  80283c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802841:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802848:	00 00 00 
+  80284b:	be 27 00 00 00       	mov    $0x27,%esi
+  802850:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802857:	00 00 00 
+  80285a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285f:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802866:	00 00 00 
+  802869:	41 ff d1             	call   *%r9
+
+000000000080286c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80286c:	55                   	push   %rbp
+  80286d:	48 89 e5             	mov    %rsp,%rbp
+  802870:	53                   	push   %rbx
+  802871:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802875:	48 63 ce             	movslq %esi,%rcx
+  802878:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80287b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802880:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802885:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80288a:	be 00 00 00 00       	mov    $0x0,%esi
+  80288f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802895:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80289b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80289d:	48 85 c0             	test   %rax,%rax
+  8028a0:	7f 06                	jg     8028a8 <sys_env_set_status+0x3c>
+}
+  8028a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028a6:	c9                   	leave
+  8028a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028a8:	49 89 c0             	mov    %rax,%r8
+  8028ab:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028b0:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8028b7:	00 00 00 
+  8028ba:	be 27 00 00 00       	mov    $0x27,%esi
+  8028bf:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8028c6:	00 00 00 
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ce:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  8028d5:	00 00 00 
+  8028d8:	41 ff d1             	call   *%r9
+
+00000000008028db <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028db:	55                   	push   %rbp
+  8028dc:	48 89 e5             	mov    %rsp,%rbp
+  8028df:	53                   	push   %rbx
+  8028e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802904:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80290a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80290c:	48 85 c0             	test   %rax,%rax
+  80290f:	7f 06                	jg     802917 <sys_env_set_trapframe+0x3c>
+}
+  802911:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802915:	c9                   	leave
+  802916:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802917:	49 89 c0             	mov    %rax,%r8
+  80291a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80291f:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802926:	00 00 00 
+  802929:	be 27 00 00 00       	mov    $0x27,%esi
+  80292e:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802935:	00 00 00 
+  802938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293d:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802944:	00 00 00 
+  802947:	41 ff d1             	call   *%r9
+
+000000000080294a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80294a:	55                   	push   %rbp
+  80294b:	48 89 e5             	mov    %rsp,%rbp
+  80294e:	53                   	push   %rbx
+  80294f:	48 83 ec 08          	sub    $0x8,%rsp
+  802953:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802956:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802959:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80295e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802963:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802968:	be 00 00 00 00       	mov    $0x0,%esi
+  80296d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802973:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802979:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80297b:	48 85 c0             	test   %rax,%rax
+  80297e:	7f 06                	jg     802986 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802980:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802986:	49 89 c0             	mov    %rax,%r8
+  802989:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80298e:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802995:	00 00 00 
+  802998:	be 27 00 00 00       	mov    $0x27,%esi
+  80299d:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8029a4:	00 00 00 
+  8029a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ac:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  8029b3:	00 00 00 
+  8029b6:	41 ff d1             	call   *%r9
+
+00000000008029b9 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029b9:	55                   	push   %rbp
+  8029ba:	48 89 e5             	mov    %rsp,%rbp
+  8029bd:	53                   	push   %rbx
+  8029be:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029c2:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029c6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029c9:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029eb:	48 85 c0             	test   %rax,%rax
+  8029ee:	7f 06                	jg     8029f6 <sys_env_set_reclaim+0x3d>
+}
+  8029f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029f4:	c9                   	leave
+  8029f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029f6:	49 89 c0             	mov    %rax,%r8
+  8029f9:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8029fe:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802a05:	00 00 00 
+  802a08:	be 27 00 00 00       	mov    $0x27,%esi
+  802a0d:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a14:	00 00 00 
+  802a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1c:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802a23:	00 00 00 
+  802a26:	41 ff d1             	call   *%r9
+
+0000000000802a29 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a29:	55                   	push   %rbp
+  802a2a:	48 89 e5             	mov    %rsp,%rbp
+  802a2d:	53                   	push   %rbx
+  802a2e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a32:	48 63 ce             	movslq %esi,%rcx
+  802a35:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a38:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a47:	be 00 00 00 00       	mov    $0x0,%esi
+  802a4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a58:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a5a:	48 85 c0             	test   %rax,%rax
+  802a5d:	7f 06                	jg     802a65 <sys_env_set_nice+0x3c>
+}
+  802a5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a63:	c9                   	leave
+  802a64:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a65:	49 89 c0             	mov    %rax,%r8
+  802a68:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a6d:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802a74:	00 00 00 
+  802a77:	be 27 00 00 00       	mov    $0x27,%esi
+  802a7c:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a83:	00 00 00 
+  802a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8b:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802a92:	00 00 00 
+  802a95:	41 ff d1             	call   *%r9
+
+0000000000802a98 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802a98:	55                   	push   %rbp
+  802a99:	48 89 e5             	mov    %rsp,%rbp
+  802a9c:	53                   	push   %rbx
+  802a9d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aa0:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802aa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aaf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ab4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ab9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802abf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ac5:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ac7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802acb:	c9                   	leave
+  802acc:	c3                   	ret
+
+0000000000802acd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802acd:	55                   	push   %rbp
+  802ace:	48 89 e5             	mov    %rsp,%rbp
+  802ad1:	53                   	push   %rbx
+  802ad2:	89 f8                	mov    %edi,%eax
+  802ad4:	49 89 f1             	mov    %rsi,%r9
+  802ad7:	48 89 d3             	mov    %rdx,%rbx
+  802ada:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802add:	49 63 f0             	movslq %r8d,%rsi
+  802ae0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ae3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ae8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aeb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802af1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802af7:	cd 30                	int    $0x30
+}
+  802af9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802afd:	c9                   	leave
+  802afe:	c3                   	ret
+
+0000000000802aff <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802aff:	55                   	push   %rbp
+  802b00:	48 89 e5             	mov    %rsp,%rbp
+  802b03:	53                   	push   %rbx
+  802b04:	89 f8                	mov    %edi,%eax
+  802b06:	49 89 f1             	mov    %rsi,%r9
+  802b09:	48 89 d3             	mov    %rdx,%rbx
+  802b0c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b0f:	49 63 f0             	movslq %r8d,%rsi
+  802b12:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b15:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b1a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b23:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b29:	cd 30                	int    $0x30
+}
+  802b2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+0000000000802b31 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b31:	55                   	push   %rbp
+  802b32:	48 89 e5             	mov    %rsp,%rbp
+  802b35:	53                   	push   %rbx
+  802b36:	48 83 ec 08          	sub    $0x8,%rsp
+  802b3a:	89 f8                	mov    %edi,%eax
+  802b3c:	49 89 f2             	mov    %rsi,%r10
+  802b3f:	48 89 d3             	mov    %rdx,%rbx
+  802b42:	48 89 cf             	mov    %rcx,%rdi
+  802b45:	44 89 c6             	mov    %r8d,%esi
+  802b48:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b4b:	48 63 f6             	movslq %esi,%rsi
+  802b4e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b51:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b56:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b59:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b5d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b5f:	48 85 c0             	test   %rax,%rax
+  802b62:	7f 06                	jg     802b6a <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b68:	c9                   	leave
+  802b69:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b6a:	49 89 c0             	mov    %rax,%r8
+  802b6d:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b72:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802b79:	00 00 00 
+  802b7c:	be 27 00 00 00       	mov    $0x27,%esi
+  802b81:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802b88:	00 00 00 
+  802b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b90:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802b97:	00 00 00 
+  802b9a:	41 ff d1             	call   *%r9
+
+0000000000802b9d <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802b9d:	55                   	push   %rbp
+  802b9e:	48 89 e5             	mov    %rsp,%rbp
+  802ba1:	53                   	push   %rbx
+  802ba2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ba6:	48 89 f1             	mov    %rsi,%rcx
+  802ba9:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bac:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bb0:	48 8b 1a             	mov    (%rdx),%rbx
+  802bb3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bb6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bbb:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bbf:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bc3:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bc7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bc9:	48 85 c0             	test   %rax,%rax
+  802bcc:	7f 06                	jg     802bd4 <sys_ipc_call_short+0x37>
+}
+  802bce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bd2:	c9                   	leave
+  802bd3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bd4:	49 89 c0             	mov    %rax,%r8
+  802bd7:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bdc:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802be3:	00 00 00 
+  802be6:	be 27 00 00 00       	mov    $0x27,%esi
+  802beb:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802bf2:	00 00 00 
+  802bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfa:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802c01:	00 00 00 
+  802c04:	41 ff d1             	call   *%r9
+
+0000000000802c07 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c07:	55                   	push   %rbp
+  802c08:	48 89 e5             	mov    %rsp,%rbp
+  802c0b:	53                   	push   %rbx
+  802c0c:	48 83 ec 08          	sub    $0x8,%rsp
+  802c10:	89 f8                	mov    %edi,%eax
+  802c12:	49 89 f2             	mov    %rsi,%r10
+  802c15:	48 89 d3             	mov    %rdx,%rbx
+  802c18:	48 89 cf             	mov    %rcx,%rdi
+  802c1b:	44 89 c6             	mov    %r8d,%esi
+  802c1e:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c21:	48 63 f6             	movslq %esi,%rsi
+  802c24:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c27:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c2c:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c2f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c33:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c35:	48 85 c0             	test   %rax,%rax
+  802c38:	7f 06                	jg     802c40 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c3e:	c9                   	leave
+  802c3f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c40:	49 89 c0             	mov    %rax,%r8
+  802c43:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c48:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802c4f:	00 00 00 
+  802c52:	be 27 00 00 00       	mov    $0x27,%esi
+  802c57:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802c5e:	00 00 00 
+  802c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c66:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802c6d:	00 00 00 
+  802c70:	41 ff d1             	call   *%r9
+
+0000000000802c73 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c73:	55                   	push   %rbp
+  802c74:	48 89 e5             	mov    %rsp,%rbp
+  802c77:	53                   	push   %rbx
+  802c78:	48 83 ec 08          	sub    $0x8,%rsp
+  802c7c:	48 89 fa             	mov    %rdi,%rdx
+  802c7f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c82:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c8c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c91:	be 00 00 00 00       	mov    $0x0,%esi
+  802c96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c9c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ca2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ca4:	48 85 c0             	test   %rax,%rax
+  802ca7:	7f 06                	jg     802caf <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ca9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cad:	c9                   	leave
+  802cae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802caf:	49 89 c0             	mov    %rax,%r8
+  802cb2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cb7:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802cbe:	00 00 00 
+  802cc1:	be 27 00 00 00       	mov    $0x27,%esi
+  802cc6:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802ccd:	00 00 00 
+  802cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd5:	49 b9 79 50 80 00 00 	movabs $0x805079,%r9
+  802cdc:	00 00 00 
+  802cdf:	41 ff d1             	call   *%r9
+
+0000000000802ce2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802ce2:	55                   	push   %rbp
+  802ce3:	48 89 e5             	mov    %rsp,%rbp
+  802ce6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802ce7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d00:	be 00 00 00 00       	mov    $0x0,%esi
+  802d05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d11:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d17:	c9                   	leave
+  802d18:	c3                   	ret
+
+0000000000802d19 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d19:	55                   	push   %rbp
+  802d1a:	48 89 e5             	mov    %rsp,%rbp
+  802d1d:	53                   	push   %rbx
+  802d1e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d21:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d26:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d30:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d35:	be 00 00 00 00       	mov    $0x0,%esi
+  802d3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d46:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4c:	c9                   	leave
+  802d4d:	c3                   	ret
+
+0000000000802d4e <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d4e:	55                   	push   %rbp
+  802d4f:	48 89 e5             	mov    %rsp,%rbp
+  802d52:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d53:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d67:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d7d:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d83:	c9                   	leave
+  802d84:	c3                   	ret
+
+0000000000802d85 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d85:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d8c:	ff ff ff 
+  802d8f:	48 01 f8             	add    %rdi,%rax
+  802d92:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802d96:	c3                   	ret
+
+0000000000802d97 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d97:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d9e:	ff ff ff 
+  802da1:	48 01 f8             	add    %rdi,%rax
+  802da4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802da8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dae:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802db2:	c3                   	ret
+
+0000000000802db3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802db3:	55                   	push   %rbp
+  802db4:	48 89 e5             	mov    %rsp,%rbp
+  802db7:	41 57                	push   %r15
+  802db9:	41 56                	push   %r14
+  802dbb:	41 55                	push   %r13
+  802dbd:	41 54                	push   %r12
+  802dbf:	53                   	push   %rbx
+  802dc0:	48 83 ec 08          	sub    $0x8,%rsp
+  802dc4:	49 89 ff             	mov    %rdi,%r15
+  802dc7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802dcc:	49 bd b3 42 80 00 00 	movabs $0x8042b3,%r13
+  802dd3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802dd6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802ddc:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802ddf:	48 89 df             	mov    %rbx,%rdi
+  802de2:	41 ff d5             	call   *%r13
+  802de5:	83 e0 04             	and    $0x4,%eax
+  802de8:	74 17                	je     802e01 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802dea:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802df1:	4c 39 f3             	cmp    %r14,%rbx
+  802df4:	75 e6                	jne    802ddc <fd_alloc+0x29>
+  802df6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802dfc:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e01:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e04:	48 83 c4 08          	add    $0x8,%rsp
+  802e08:	5b                   	pop    %rbx
+  802e09:	41 5c                	pop    %r12
+  802e0b:	41 5d                	pop    %r13
+  802e0d:	41 5e                	pop    %r14
+  802e0f:	41 5f                	pop    %r15
+  802e11:	5d                   	pop    %rbp
+  802e12:	c3                   	ret
+
+0000000000802e13 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e13:	83 ff 1f             	cmp    $0x1f,%edi
+  802e16:	77 39                	ja     802e51 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e18:	55                   	push   %rbp
+  802e19:	48 89 e5             	mov    %rsp,%rbp
+  802e1c:	41 54                	push   %r12
+  802e1e:	53                   	push   %rbx
+  802e1f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e22:	48 63 df             	movslq %edi,%rbx
+  802e25:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e2c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e30:	48 89 df             	mov    %rbx,%rdi
+  802e33:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+  802e3f:	a8 04                	test   $0x4,%al
+  802e41:	74 14                	je     802e57 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e43:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e4c:	5b                   	pop    %rbx
+  802e4d:	41 5c                	pop    %r12
+  802e4f:	5d                   	pop    %rbp
+  802e50:	c3                   	ret
+        return -E_INVAL;
+  802e51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e56:	c3                   	ret
+        return -E_INVAL;
+  802e57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e5c:	eb ee                	jmp    802e4c <fd_lookup+0x39>
+
+0000000000802e5e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e5e:	55                   	push   %rbp
+  802e5f:	48 89 e5             	mov    %rsp,%rbp
+  802e62:	41 54                	push   %r12
+  802e64:	53                   	push   %rbx
+  802e65:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e68:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802e6f:	00 00 00 
+  802e72:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e79:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e7c:	39 3b                	cmp    %edi,(%rbx)
+  802e7e:	74 47                	je     802ec7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e80:	48 83 c0 08          	add    $0x8,%rax
+  802e84:	48 8b 18             	mov    (%rax),%rbx
+  802e87:	48 85 db             	test   %rbx,%rbx
+  802e8a:	75 f0                	jne    802e7c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e8c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e93:	00 00 00 
+  802e96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e9c:	89 fa                	mov    %edi,%edx
+  802e9e:	48 bf 58 61 80 00 00 	movabs $0x806158,%rdi
+  802ea5:	00 00 00 
+  802ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ead:	48 b9 8b 16 80 00 00 	movabs $0x80168b,%rcx
+  802eb4:	00 00 00 
+  802eb7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802eb9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ebe:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ec2:	5b                   	pop    %rbx
+  802ec3:	41 5c                	pop    %r12
+  802ec5:	5d                   	pop    %rbp
+  802ec6:	c3                   	ret
+            return 0;
+  802ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ecc:	eb f0                	jmp    802ebe <dev_lookup+0x60>
+
+0000000000802ece <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ece:	55                   	push   %rbp
+  802ecf:	48 89 e5             	mov    %rsp,%rbp
+  802ed2:	41 55                	push   %r13
+  802ed4:	41 54                	push   %r12
+  802ed6:	53                   	push   %rbx
+  802ed7:	48 83 ec 18          	sub    $0x18,%rsp
+  802edb:	48 89 fb             	mov    %rdi,%rbx
+  802ede:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ee1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802ee8:	ff ff ff 
+  802eeb:	48 01 df             	add    %rbx,%rdi
+  802eee:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802ef2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ef6:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  802efd:	00 00 00 
+  802f00:	ff d0                	call   *%rax
+  802f02:	41 89 c5             	mov    %eax,%r13d
+  802f05:	85 c0                	test   %eax,%eax
+  802f07:	78 06                	js     802f0f <fd_close+0x41>
+  802f09:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f0d:	74 1a                	je     802f29 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f0f:	45 84 e4             	test   %r12b,%r12b
+  802f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f17:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f1b:	44 89 e8             	mov    %r13d,%eax
+  802f1e:	48 83 c4 18          	add    $0x18,%rsp
+  802f22:	5b                   	pop    %rbx
+  802f23:	41 5c                	pop    %r12
+  802f25:	41 5d                	pop    %r13
+  802f27:	5d                   	pop    %rbp
+  802f28:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f29:	8b 3b                	mov    (%rbx),%edi
+  802f2b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f2f:	48 b8 5e 2e 80 00 00 	movabs $0x802e5e,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+  802f3b:	41 89 c5             	mov    %eax,%r13d
+  802f3e:	85 c0                	test   %eax,%eax
+  802f40:	78 1b                	js     802f5d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f42:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f46:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f4a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f50:	48 85 c0             	test   %rax,%rax
+  802f53:	74 08                	je     802f5d <fd_close+0x8f>
+  802f55:	48 89 df             	mov    %rbx,%rdi
+  802f58:	ff d0                	call   *%rax
+  802f5a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f62:	48 89 de             	mov    %rbx,%rsi
+  802f65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6a:	48 b8 ff 27 80 00 00 	movabs $0x8027ff,%rax
+  802f71:	00 00 00 
+  802f74:	ff d0                	call   *%rax
+    return res;
+  802f76:	eb a3                	jmp    802f1b <fd_close+0x4d>
+
+0000000000802f78 <close>:
+
+int
+close(int fdnum) {
+  802f78:	55                   	push   %rbp
+  802f79:	48 89 e5             	mov    %rsp,%rbp
+  802f7c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f80:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f84:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  802f8b:	00 00 00 
+  802f8e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f90:	85 c0                	test   %eax,%eax
+  802f92:	78 15                	js     802fa9 <close+0x31>
+
+    return fd_close(fd, 1);
+  802f94:	be 01 00 00 00       	mov    $0x1,%esi
+  802f99:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f9d:	48 b8 ce 2e 80 00 00 	movabs $0x802ece,%rax
+  802fa4:	00 00 00 
+  802fa7:	ff d0                	call   *%rax
+}
+  802fa9:	c9                   	leave
+  802faa:	c3                   	ret
+
+0000000000802fab <close_all>:
+
+void
+close_all(void) {
+  802fab:	55                   	push   %rbp
+  802fac:	48 89 e5             	mov    %rsp,%rbp
+  802faf:	41 54                	push   %r12
+  802fb1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fb7:	49 bc 78 2f 80 00 00 	movabs $0x802f78,%r12
+  802fbe:	00 00 00 
+  802fc1:	89 df                	mov    %ebx,%edi
+  802fc3:	41 ff d4             	call   *%r12
+  802fc6:	83 c3 01             	add    $0x1,%ebx
+  802fc9:	83 fb 20             	cmp    $0x20,%ebx
+  802fcc:	75 f3                	jne    802fc1 <close_all+0x16>
+}
+  802fce:	5b                   	pop    %rbx
+  802fcf:	41 5c                	pop    %r12
+  802fd1:	5d                   	pop    %rbp
+  802fd2:	c3                   	ret
+
+0000000000802fd3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fd3:	55                   	push   %rbp
+  802fd4:	48 89 e5             	mov    %rsp,%rbp
+  802fd7:	41 57                	push   %r15
+  802fd9:	41 56                	push   %r14
+  802fdb:	41 55                	push   %r13
+  802fdd:	41 54                	push   %r12
+  802fdf:	53                   	push   %rbx
+  802fe0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fe4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802fe7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802feb:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  802ff2:	00 00 00 
+  802ff5:	ff d0                	call   *%rax
+  802ff7:	89 c3                	mov    %eax,%ebx
+  802ff9:	85 c0                	test   %eax,%eax
+  802ffb:	0f 88 b8 00 00 00    	js     8030b9 <dup+0xe6>
+    close(newfdnum);
+  803001:	44 89 e7             	mov    %r12d,%edi
+  803004:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  80300b:	00 00 00 
+  80300e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803010:	4d 63 ec             	movslq %r12d,%r13
+  803013:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80301a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80301e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803022:	4c 89 ff             	mov    %r15,%rdi
+  803025:	49 be 97 2d 80 00 00 	movabs $0x802d97,%r14
+  80302c:	00 00 00 
+  80302f:	41 ff d6             	call   *%r14
+  803032:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803035:	4c 89 ef             	mov    %r13,%rdi
+  803038:	41 ff d6             	call   *%r14
+  80303b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80303e:	48 89 df             	mov    %rbx,%rdi
+  803041:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  803048:	00 00 00 
+  80304b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80304d:	a8 04                	test   $0x4,%al
+  80304f:	74 2b                	je     80307c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803051:	41 89 c1             	mov    %eax,%r9d
+  803054:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80305a:	4c 89 f1             	mov    %r14,%rcx
+  80305d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803062:	48 89 de             	mov    %rbx,%rsi
+  803065:	bf 00 00 00 00       	mov    $0x0,%edi
+  80306a:	48 b8 94 27 80 00 00 	movabs $0x802794,%rax
+  803071:	00 00 00 
+  803074:	ff d0                	call   *%rax
+  803076:	89 c3                	mov    %eax,%ebx
+  803078:	85 c0                	test   %eax,%eax
+  80307a:	78 4e                	js     8030ca <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80307c:	4c 89 ff             	mov    %r15,%rdi
+  80307f:	48 b8 b3 42 80 00 00 	movabs $0x8042b3,%rax
+  803086:	00 00 00 
+  803089:	ff d0                	call   *%rax
+  80308b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80308e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803094:	4c 89 e9             	mov    %r13,%rcx
+  803097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80309c:	4c 89 fe             	mov    %r15,%rsi
+  80309f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a4:	48 b8 94 27 80 00 00 	movabs $0x802794,%rax
+  8030ab:	00 00 00 
+  8030ae:	ff d0                	call   *%rax
+  8030b0:	89 c3                	mov    %eax,%ebx
+  8030b2:	85 c0                	test   %eax,%eax
+  8030b4:	78 14                	js     8030ca <dup+0xf7>
+
+    return newfdnum;
+  8030b6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030b9:	89 d8                	mov    %ebx,%eax
+  8030bb:	48 83 c4 18          	add    $0x18,%rsp
+  8030bf:	5b                   	pop    %rbx
+  8030c0:	41 5c                	pop    %r12
+  8030c2:	41 5d                	pop    %r13
+  8030c4:	41 5e                	pop    %r14
+  8030c6:	41 5f                	pop    %r15
+  8030c8:	5d                   	pop    %rbp
+  8030c9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030cf:	4c 89 ee             	mov    %r13,%rsi
+  8030d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d7:	49 bc ff 27 80 00 00 	movabs $0x8027ff,%r12
+  8030de:	00 00 00 
+  8030e1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e9:	4c 89 f6             	mov    %r14,%rsi
+  8030ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f1:	41 ff d4             	call   *%r12
+    return res;
+  8030f4:	eb c3                	jmp    8030b9 <dup+0xe6>
+
+00000000008030f6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030f6:	55                   	push   %rbp
+  8030f7:	48 89 e5             	mov    %rsp,%rbp
+  8030fa:	41 56                	push   %r14
+  8030fc:	41 55                	push   %r13
+  8030fe:	41 54                	push   %r12
+  803100:	53                   	push   %rbx
+  803101:	48 83 ec 10          	sub    $0x10,%rsp
+  803105:	89 fb                	mov    %edi,%ebx
+  803107:	49 89 f4             	mov    %rsi,%r12
+  80310a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80310d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803111:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  803118:	00 00 00 
+  80311b:	ff d0                	call   *%rax
+  80311d:	85 c0                	test   %eax,%eax
+  80311f:	78 4c                	js     80316d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803121:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803125:	41 8b 3e             	mov    (%r14),%edi
+  803128:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80312c:	48 b8 5e 2e 80 00 00 	movabs $0x802e5e,%rax
+  803133:	00 00 00 
+  803136:	ff d0                	call   *%rax
+  803138:	85 c0                	test   %eax,%eax
+  80313a:	78 35                	js     803171 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80313c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803140:	83 e0 03             	and    $0x3,%eax
+  803143:	83 f8 01             	cmp    $0x1,%eax
+  803146:	74 2d                	je     803175 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803148:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80314c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803150:	48 85 c0             	test   %rax,%rax
+  803153:	74 56                	je     8031ab <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803155:	4c 89 ea             	mov    %r13,%rdx
+  803158:	4c 89 e6             	mov    %r12,%rsi
+  80315b:	4c 89 f7             	mov    %r14,%rdi
+  80315e:	ff d0                	call   *%rax
+}
+  803160:	48 83 c4 10          	add    $0x10,%rsp
+  803164:	5b                   	pop    %rbx
+  803165:	41 5c                	pop    %r12
+  803167:	41 5d                	pop    %r13
+  803169:	41 5e                	pop    %r14
+  80316b:	5d                   	pop    %rbp
+  80316c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80316d:	48 98                	cltq
+  80316f:	eb ef                	jmp    803160 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803171:	48 98                	cltq
+  803173:	eb eb                	jmp    803160 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803175:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80317c:	00 00 00 
+  80317f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803185:	89 da                	mov    %ebx,%edx
+  803187:	48 bf 99 61 80 00 00 	movabs $0x806199,%rdi
+  80318e:	00 00 00 
+  803191:	b8 00 00 00 00       	mov    $0x0,%eax
+  803196:	48 b9 8b 16 80 00 00 	movabs $0x80168b,%rcx
+  80319d:	00 00 00 
+  8031a0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031a2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031a9:	eb b5                	jmp    803160 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031ab:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031b2:	eb ac                	jmp    803160 <read+0x6a>
+
+00000000008031b4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031b4:	55                   	push   %rbp
+  8031b5:	48 89 e5             	mov    %rsp,%rbp
+  8031b8:	41 57                	push   %r15
+  8031ba:	41 56                	push   %r14
+  8031bc:	41 55                	push   %r13
+  8031be:	41 54                	push   %r12
+  8031c0:	53                   	push   %rbx
+  8031c1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031c5:	48 85 d2             	test   %rdx,%rdx
+  8031c8:	74 54                	je     80321e <readn+0x6a>
+  8031ca:	41 89 fd             	mov    %edi,%r13d
+  8031cd:	49 89 f6             	mov    %rsi,%r14
+  8031d0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031d8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031dd:	49 bf f6 30 80 00 00 	movabs $0x8030f6,%r15
+  8031e4:	00 00 00 
+  8031e7:	4c 89 e2             	mov    %r12,%rdx
+  8031ea:	48 29 f2             	sub    %rsi,%rdx
+  8031ed:	4c 01 f6             	add    %r14,%rsi
+  8031f0:	44 89 ef             	mov    %r13d,%edi
+  8031f3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8031f6:	85 c0                	test   %eax,%eax
+  8031f8:	78 20                	js     80321a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8031fa:	01 c3                	add    %eax,%ebx
+  8031fc:	85 c0                	test   %eax,%eax
+  8031fe:	74 08                	je     803208 <readn+0x54>
+  803200:	48 63 f3             	movslq %ebx,%rsi
+  803203:	4c 39 e6             	cmp    %r12,%rsi
+  803206:	72 df                	jb     8031e7 <readn+0x33>
+    }
+    return res;
+  803208:	48 63 c3             	movslq %ebx,%rax
+}
+  80320b:	48 83 c4 08          	add    $0x8,%rsp
+  80320f:	5b                   	pop    %rbx
+  803210:	41 5c                	pop    %r12
+  803212:	41 5d                	pop    %r13
+  803214:	41 5e                	pop    %r14
+  803216:	41 5f                	pop    %r15
+  803218:	5d                   	pop    %rbp
+  803219:	c3                   	ret
+        if (inc < 0) return inc;
+  80321a:	48 98                	cltq
+  80321c:	eb ed                	jmp    80320b <readn+0x57>
+    int inc = 1, res = 0;
+  80321e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803223:	eb e3                	jmp    803208 <readn+0x54>
+
+0000000000803225 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803225:	55                   	push   %rbp
+  803226:	48 89 e5             	mov    %rsp,%rbp
+  803229:	41 56                	push   %r14
+  80322b:	41 55                	push   %r13
+  80322d:	41 54                	push   %r12
+  80322f:	53                   	push   %rbx
+  803230:	48 83 ec 10          	sub    $0x10,%rsp
+  803234:	89 fb                	mov    %edi,%ebx
+  803236:	49 89 f4             	mov    %rsi,%r12
+  803239:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80323c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803240:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  803247:	00 00 00 
+  80324a:	ff d0                	call   *%rax
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	78 47                	js     803297 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803250:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803254:	41 8b 3e             	mov    (%r14),%edi
+  803257:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80325b:	48 b8 5e 2e 80 00 00 	movabs $0x802e5e,%rax
+  803262:	00 00 00 
+  803265:	ff d0                	call   *%rax
+  803267:	85 c0                	test   %eax,%eax
+  803269:	78 30                	js     80329b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80326b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803270:	74 2d                	je     80329f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803272:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803276:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80327a:	48 85 c0             	test   %rax,%rax
+  80327d:	74 56                	je     8032d5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80327f:	4c 89 ea             	mov    %r13,%rdx
+  803282:	4c 89 e6             	mov    %r12,%rsi
+  803285:	4c 89 f7             	mov    %r14,%rdi
+  803288:	ff d0                	call   *%rax
+}
+  80328a:	48 83 c4 10          	add    $0x10,%rsp
+  80328e:	5b                   	pop    %rbx
+  80328f:	41 5c                	pop    %r12
+  803291:	41 5d                	pop    %r13
+  803293:	41 5e                	pop    %r14
+  803295:	5d                   	pop    %rbp
+  803296:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803297:	48 98                	cltq
+  803299:	eb ef                	jmp    80328a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80329b:	48 98                	cltq
+  80329d:	eb eb                	jmp    80328a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80329f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032a6:	00 00 00 
+  8032a9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032af:	89 da                	mov    %ebx,%edx
+  8032b1:	48 bf b5 61 80 00 00 	movabs $0x8061b5,%rdi
+  8032b8:	00 00 00 
+  8032bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c0:	48 b9 8b 16 80 00 00 	movabs $0x80168b,%rcx
+  8032c7:	00 00 00 
+  8032ca:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032cc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032d3:	eb b5                	jmp    80328a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032d5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032dc:	eb ac                	jmp    80328a <write+0x65>
+
+00000000008032de <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032de:	55                   	push   %rbp
+  8032df:	48 89 e5             	mov    %rsp,%rbp
+  8032e2:	53                   	push   %rbx
+  8032e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8032e7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032e9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032ed:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  8032f4:	00 00 00 
+  8032f7:	ff d0                	call   *%rax
+  8032f9:	85 c0                	test   %eax,%eax
+  8032fb:	78 0c                	js     803309 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8032fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803301:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803304:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80330d:	c9                   	leave
+  80330e:	c3                   	ret
+
+000000000080330f <tell>:
+
+int tell(int fdnum) {
+  80330f:	55                   	push   %rbp
+  803310:	48 89 e5             	mov    %rsp,%rbp
+  803313:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803317:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80331b:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+  803327:	85 c0                	test   %eax,%eax
+  803329:	78 07                	js     803332 <tell+0x23>
+
+    return fd->fd_offset;
+  80332b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80332f:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803332:	c9                   	leave
+  803333:	c3                   	ret
+
+0000000000803334 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803334:	55                   	push   %rbp
+  803335:	48 89 e5             	mov    %rsp,%rbp
+  803338:	41 55                	push   %r13
+  80333a:	41 54                	push   %r12
+  80333c:	53                   	push   %rbx
+  80333d:	48 83 ec 18          	sub    $0x18,%rsp
+  803341:	89 fb                	mov    %edi,%ebx
+  803343:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803346:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80334a:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+  803356:	85 c0                	test   %eax,%eax
+  803358:	78 38                	js     803392 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80335a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80335e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803362:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803366:	48 b8 5e 2e 80 00 00 	movabs $0x802e5e,%rax
+  80336d:	00 00 00 
+  803370:	ff d0                	call   *%rax
+  803372:	85 c0                	test   %eax,%eax
+  803374:	78 1c                	js     803392 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803376:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80337b:	74 20                	je     80339d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80337d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803381:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803385:	48 85 c0             	test   %rax,%rax
+  803388:	74 47                	je     8033d1 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80338a:	44 89 e6             	mov    %r12d,%esi
+  80338d:	4c 89 ef             	mov    %r13,%rdi
+  803390:	ff d0                	call   *%rax
+}
+  803392:	48 83 c4 18          	add    $0x18,%rsp
+  803396:	5b                   	pop    %rbx
+  803397:	41 5c                	pop    %r12
+  803399:	41 5d                	pop    %r13
+  80339b:	5d                   	pop    %rbp
+  80339c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80339d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033a4:	00 00 00 
+  8033a7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033ad:	89 da                	mov    %ebx,%edx
+  8033af:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  8033b6:	00 00 00 
+  8033b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033be:	48 b9 8b 16 80 00 00 	movabs $0x80168b,%rcx
+  8033c5:	00 00 00 
+  8033c8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033cf:	eb c1                	jmp    803392 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033d1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033d6:	eb ba                	jmp    803392 <ftruncate+0x5e>
+
+00000000008033d8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033d8:	55                   	push   %rbp
+  8033d9:	48 89 e5             	mov    %rsp,%rbp
+  8033dc:	41 54                	push   %r12
+  8033de:	53                   	push   %rbx
+  8033df:	48 83 ec 10          	sub    $0x10,%rsp
+  8033e3:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033e6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033ea:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  8033f1:	00 00 00 
+  8033f4:	ff d0                	call   *%rax
+  8033f6:	85 c0                	test   %eax,%eax
+  8033f8:	78 63                	js     80345d <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033fa:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8033fe:	41 8b 3c 24          	mov    (%r12),%edi
+  803402:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803406:	48 b8 5e 2e 80 00 00 	movabs $0x802e5e,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+  803412:	85 c0                	test   %eax,%eax
+  803414:	78 47                	js     80345d <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803416:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80341a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80341f:	74 45                	je     803466 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803421:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803424:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80342b:	00 00 00 
+    stat->st_isdir = 0;
+  80342e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803435:	00 00 00 
+    stat->st_ino = 0;
+  803438:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80343f:	00 00 00 00 
+    stat->st_version = 0;
+  803443:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80344a:	00 00 00 
+    stat->st_dev = dev;
+  80344d:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803454:	48 89 de             	mov    %rbx,%rsi
+  803457:	4c 89 e7             	mov    %r12,%rdi
+  80345a:	ff 50 28             	call   *0x28(%rax)
+}
+  80345d:	48 83 c4 10          	add    $0x10,%rsp
+  803461:	5b                   	pop    %rbx
+  803462:	41 5c                	pop    %r12
+  803464:	5d                   	pop    %rbp
+  803465:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803466:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80346b:	eb f0                	jmp    80345d <fstat+0x85>
+
+000000000080346d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80346d:	55                   	push   %rbp
+  80346e:	48 89 e5             	mov    %rsp,%rbp
+  803471:	41 54                	push   %r12
+  803473:	53                   	push   %rbx
+  803474:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803477:	be 00 00 00 00       	mov    $0x0,%esi
+  80347c:	48 b8 8e 39 80 00 00 	movabs $0x80398e,%rax
+  803483:	00 00 00 
+  803486:	ff d0                	call   *%rax
+  803488:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80348a:	85 c0                	test   %eax,%eax
+  80348c:	78 25                	js     8034b3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80348e:	4c 89 e6             	mov    %r12,%rsi
+  803491:	89 c7                	mov    %eax,%edi
+  803493:	48 b8 d8 33 80 00 00 	movabs $0x8033d8,%rax
+  80349a:	00 00 00 
+  80349d:	ff d0                	call   *%rax
+  80349f:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034a2:	89 df                	mov    %ebx,%edi
+  8034a4:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  8034ab:	00 00 00 
+  8034ae:	ff d0                	call   *%rax
+
+    return res;
+  8034b0:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034b3:	89 d8                	mov    %ebx,%eax
+  8034b5:	5b                   	pop    %rbx
+  8034b6:	41 5c                	pop    %r12
+  8034b8:	5d                   	pop    %rbp
+  8034b9:	c3                   	ret
+
+00000000008034ba <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ba:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034c1:	00 00 00 
+  8034c4:	83 38 00             	cmpl   $0x0,(%rax)
+  8034c7:	74 0a                	je     8034d3 <fsipc_env+0x19>
+    return fsenv;
+}
+  8034c9:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034d0:	00 00 
+  8034d2:	c3                   	ret
+fsipc_env(void) {
+  8034d3:	55                   	push   %rbp
+  8034d4:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034d7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034dc:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  8034e3:	00 00 00 
+  8034e6:	ff d0                	call   *%rax
+  8034e8:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8034ef:	00 00 
+}
+  8034f1:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034f8:	00 00 
+  8034fa:	5d                   	pop    %rbp
+  8034fb:	c3                   	ret
+
+00000000008034fc <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8034fc:	55                   	push   %rbp
+  8034fd:	48 89 e5             	mov    %rsp,%rbp
+  803500:	53                   	push   %rbx
+  803501:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803505:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80350c:	00 
+  80350d:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803514:	00 
+  803515:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80351c:	00 
+  80351d:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803524:	00 
+  803525:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80352c:	00 
+
+    assert(size <= sizeof(words));
+  80352d:	48 83 fa 28          	cmp    $0x28,%rdx
+  803531:	77 38                	ja     80356b <fsipc_short+0x6f>
+  803533:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803535:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803539:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  803540:	00 00 00 
+  803543:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803545:	48 b8 ba 34 80 00 00 	movabs $0x8034ba,%rax
+  80354c:	00 00 00 
+  80354f:	ff d0                	call   *%rax
+  803551:	89 c7                	mov    %eax,%edi
+  803553:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803557:	89 de                	mov    %ebx,%esi
+  803559:	48 b8 c3 55 80 00 00 	movabs $0x8055c3,%rax
+  803560:	00 00 00 
+  803563:	ff d0                	call   *%rax
+}
+  803565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803569:	c9                   	leave
+  80356a:	c3                   	ret
+    assert(size <= sizeof(words));
+  80356b:	48 b9 00 62 80 00 00 	movabs $0x806200,%rcx
+  803572:	00 00 00 
+  803575:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80357c:	00 00 00 
+  80357f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803584:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80358b:	00 00 00 
+  80358e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803593:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  80359a:	00 00 00 
+  80359d:	41 ff d0             	call   *%r8
+
+00000000008035a0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035a0:	55                   	push   %rbp
+  8035a1:	48 89 e5             	mov    %rsp,%rbp
+  8035a4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035a8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035ab:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035ae:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035b1:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035b6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035ba:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035bf:	48 b8 fc 34 80 00 00 	movabs $0x8034fc,%rax
+  8035c6:	00 00 00 
+  8035c9:	ff d0                	call   *%rax
+}
+  8035cb:	c9                   	leave
+  8035cc:	c3                   	ret
+
+00000000008035cd <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035cd:	55                   	push   %rbp
+  8035ce:	48 89 e5             	mov    %rsp,%rbp
+  8035d1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035d5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035db:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035e0:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035e4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035e9:	48 b8 fc 34 80 00 00 	movabs $0x8034fc,%rax
+  8035f0:	00 00 00 
+  8035f3:	ff d0                	call   *%rax
+}
+  8035f5:	c9                   	leave
+  8035f6:	c3                   	ret
+
+00000000008035f7 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8035f7:	55                   	push   %rbp
+  8035f8:	48 89 e5             	mov    %rsp,%rbp
+  8035fb:	41 54                	push   %r12
+  8035fd:	53                   	push   %rbx
+  8035fe:	48 83 ec 10          	sub    $0x10,%rsp
+  803602:	89 fb                	mov    %edi,%ebx
+  803604:	49 89 f4             	mov    %rsi,%r12
+  803607:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80360b:	48 b8 ba 34 80 00 00 	movabs $0x8034ba,%rax
+  803612:	00 00 00 
+  803615:	ff d0                	call   *%rax
+  803617:	89 c7                	mov    %eax,%edi
+  803619:	6a 00                	push   $0x0
+  80361b:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80361f:	50                   	push   %rax
+  803620:	4d 89 e1             	mov    %r12,%r9
+  803623:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803629:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80362e:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803635:	00 00 00 
+  803638:	89 de                	mov    %ebx,%esi
+  80363a:	48 b8 5e 55 80 00 00 	movabs $0x80555e,%rax
+  803641:	00 00 00 
+  803644:	ff d0                	call   *%rax
+}
+  803646:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80364a:	5b                   	pop    %rbx
+  80364b:	41 5c                	pop    %r12
+  80364d:	5d                   	pop    %rbp
+  80364e:	c3                   	ret
+
+000000000080364f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80364f:	55                   	push   %rbp
+  803650:	48 89 e5             	mov    %rsp,%rbp
+  803653:	41 54                	push   %r12
+  803655:	53                   	push   %rbx
+  803656:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803659:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80365c:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803663:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803665:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80366a:	be 00 00 00 00       	mov    $0x0,%esi
+  80366f:	bf 05 00 00 00       	mov    $0x5,%edi
+  803674:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  80367b:	00 00 00 
+  80367e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803680:	85 c0                	test   %eax,%eax
+  803682:	78 5a                	js     8036de <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803684:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80368b:	00 00 00 
+  80368e:	4c 89 e6             	mov    %r12,%rsi
+  803691:	48 89 df             	mov    %rbx,%rdi
+  803694:	48 b8 c2 1f 80 00 00 	movabs $0x801fc2,%rax
+  80369b:	00 00 00 
+  80369e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036a0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036a7:	00 
+  8036a8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036ae:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036b5:	00 
+  8036b6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036bc:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036c3:	00 
+  8036c4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036cb:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036d2:	00 
+  8036d3:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036de:	5b                   	pop    %rbx
+  8036df:	41 5c                	pop    %r12
+  8036e1:	5d                   	pop    %rbp
+  8036e2:	c3                   	ret
+
+00000000008036e3 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036e3:	55                   	push   %rbp
+  8036e4:	48 89 e5             	mov    %rsp,%rbp
+  8036e7:	41 57                	push   %r15
+  8036e9:	41 56                	push   %r14
+  8036eb:	41 55                	push   %r13
+  8036ed:	41 54                	push   %r12
+  8036ef:	53                   	push   %rbx
+  8036f0:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8036f4:	48 85 ff             	test   %rdi,%rdi
+  8036f7:	0f 84 a1 00 00 00    	je     80379e <devfile_read+0xbb>
+  8036fd:	49 89 ff             	mov    %rdi,%r15
+  803700:	49 89 f5             	mov    %rsi,%r13
+  803703:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803706:	48 85 f6             	test   %rsi,%rsi
+  803709:	0f 84 c4 00 00 00    	je     8037d3 <devfile_read+0xf0>
+    size_t total_read = 0;
+  80370f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803716:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803717:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80371e:	00 00 00 
+  803721:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803725:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803728:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80372c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803731:	be 00 00 00 00       	mov    $0x0,%esi
+  803736:	bf 03 00 00 00       	mov    $0x3,%edi
+  80373b:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  803742:	00 00 00 
+  803745:	ff d0                	call   *%rax
+        if (res < 0) {
+  803747:	85 c0                	test   %eax,%eax
+  803749:	0f 88 b9 00 00 00    	js     803808 <devfile_read+0x125>
+        assert(res <= n);
+  80374f:	48 63 d8             	movslq %eax,%rbx
+  803752:	49 39 dc             	cmp    %rbx,%r12
+  803755:	0f 82 b1 00 00 00    	jb     80380c <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80375b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803760:	0f 87 db 00 00 00    	ja     803841 <devfile_read+0x15e>
+        if (!res) {
+  803766:	85 c0                	test   %eax,%eax
+  803768:	74 21                	je     80378b <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80376a:	48 89 da             	mov    %rbx,%rdx
+  80376d:	4c 89 f6             	mov    %r14,%rsi
+  803770:	4c 89 ef             	mov    %r13,%rdi
+  803773:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  80377a:	00 00 00 
+  80377d:	ff d0                	call   *%rax
+        total_read += res;
+  80377f:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803783:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803786:	49 29 dc             	sub    %rbx,%r12
+  803789:	75 96                	jne    803721 <devfile_read+0x3e>
+    return total_read;
+  80378b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80378f:	48 83 c4 18          	add    $0x18,%rsp
+  803793:	5b                   	pop    %rbx
+  803794:	41 5c                	pop    %r12
+  803796:	41 5d                	pop    %r13
+  803798:	41 5e                	pop    %r14
+  80379a:	41 5f                	pop    %r15
+  80379c:	5d                   	pop    %rbp
+  80379d:	c3                   	ret
+    assert(fd);
+  80379e:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  8037a5:	00 00 00 
+  8037a8:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037af:	00 00 00 
+  8037b2:	be 91 00 00 00       	mov    $0x91,%esi
+  8037b7:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037be:	00 00 00 
+  8037c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c6:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  8037cd:	00 00 00 
+  8037d0:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037d3:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  8037da:	00 00 00 
+  8037dd:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037e4:	00 00 00 
+  8037e7:	be 92 00 00 00       	mov    $0x92,%esi
+  8037ec:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037f3:	00 00 00 
+  8037f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fb:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  803802:	00 00 00 
+  803805:	41 ff d0             	call   *%r8
+            return res;
+  803808:	48 98                	cltq
+  80380a:	eb 83                	jmp    80378f <devfile_read+0xac>
+        assert(res <= n);
+  80380c:	48 b9 3d 62 80 00 00 	movabs $0x80623d,%rcx
+  803813:	00 00 00 
+  803816:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80381d:	00 00 00 
+  803820:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803825:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80382c:	00 00 00 
+  80382f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803834:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  80383b:	00 00 00 
+  80383e:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803841:	48 b9 48 62 80 00 00 	movabs $0x806248,%rcx
+  803848:	00 00 00 
+  80384b:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803852:	00 00 00 
+  803855:	be 9f 00 00 00       	mov    $0x9f,%esi
+  80385a:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803861:	00 00 00 
+  803864:	b8 00 00 00 00       	mov    $0x0,%eax
+  803869:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  803870:	00 00 00 
+  803873:	41 ff d0             	call   *%r8
+
+0000000000803876 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803876:	55                   	push   %rbp
+  803877:	48 89 e5             	mov    %rsp,%rbp
+  80387a:	41 57                	push   %r15
+  80387c:	41 56                	push   %r14
+  80387e:	41 55                	push   %r13
+  803880:	41 54                	push   %r12
+  803882:	53                   	push   %rbx
+  803883:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803887:	48 85 ff             	test   %rdi,%rdi
+  80388a:	0f 84 83 00 00 00    	je     803913 <devfile_write+0x9d>
+  803890:	49 89 ff             	mov    %rdi,%r15
+  803893:	49 89 f4             	mov    %rsi,%r12
+  803896:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803899:	48 85 f6             	test   %rsi,%rsi
+  80389c:	0f 84 a6 00 00 00    	je     803948 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038a2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038a8:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038af:	00 00 00 
+  8038b2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038b6:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038b9:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038bd:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038c2:	48 39 d3             	cmp    %rdx,%rbx
+  8038c5:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038c9:	4c 89 e6             	mov    %r12,%rsi
+  8038cc:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038d3:	00 00 00 
+  8038d6:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  8038dd:	00 00 00 
+  8038e0:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ec:	bf 04 00 00 00       	mov    $0x4,%edi
+  8038f1:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  8038f8:	00 00 00 
+  8038fb:	ff d0                	call   *%rax
+        if (res < 0) {
+  8038fd:	85 c0                	test   %eax,%eax
+  8038ff:	78 7c                	js     80397d <devfile_write+0x107>
+        total_written += res;
+  803901:	48 98                	cltq
+  803903:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803906:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803909:	48 29 c3             	sub    %rax,%rbx
+  80390c:	75 a4                	jne    8038b2 <devfile_write+0x3c>
+    return total_written;
+  80390e:	4c 89 e8             	mov    %r13,%rax
+  803911:	eb 6c                	jmp    80397f <devfile_write+0x109>
+    assert(fd);
+  803913:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  80391a:	00 00 00 
+  80391d:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803924:	00 00 00 
+  803927:	be bd 00 00 00       	mov    $0xbd,%esi
+  80392c:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803933:	00 00 00 
+  803936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80393b:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  803942:	00 00 00 
+  803945:	41 ff d0             	call   *%r8
+    assert(buf);
+  803948:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  80394f:	00 00 00 
+  803952:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803959:	00 00 00 
+  80395c:	be be 00 00 00       	mov    $0xbe,%esi
+  803961:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803968:	00 00 00 
+  80396b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803970:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  803977:	00 00 00 
+  80397a:	41 ff d0             	call   *%r8
+            return res;
+  80397d:	48 98                	cltq
+}
+  80397f:	48 83 c4 08          	add    $0x8,%rsp
+  803983:	5b                   	pop    %rbx
+  803984:	41 5c                	pop    %r12
+  803986:	41 5d                	pop    %r13
+  803988:	41 5e                	pop    %r14
+  80398a:	41 5f                	pop    %r15
+  80398c:	5d                   	pop    %rbp
+  80398d:	c3                   	ret
+
+000000000080398e <open>:
+open(const char *path, int mode) {
+  80398e:	55                   	push   %rbp
+  80398f:	48 89 e5             	mov    %rsp,%rbp
+  803992:	41 55                	push   %r13
+  803994:	41 54                	push   %r12
+  803996:	53                   	push   %rbx
+  803997:	48 83 ec 18          	sub    $0x18,%rsp
+  80399b:	49 89 fc             	mov    %rdi,%r12
+  80399e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039a1:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8039a8:	00 00 00 
+  8039ab:	ff d0                	call   *%rax
+  8039ad:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039b3:	0f 87 8f 00 00 00    	ja     803a48 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039b9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039bd:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+  8039c9:	89 c3                	mov    %eax,%ebx
+  8039cb:	85 c0                	test   %eax,%eax
+  8039cd:	78 55                	js     803a24 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039cf:	4c 89 e6             	mov    %r12,%rsi
+  8039d2:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039d9:	00 00 00 
+  8039dc:	48 89 df             	mov    %rbx,%rdi
+  8039df:	48 b8 c2 1f 80 00 00 	movabs $0x801fc2,%rax
+  8039e6:	00 00 00 
+  8039e9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039eb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039f7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8039fb:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a00:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  803a07:	00 00 00 
+  803a0a:	ff d0                	call   *%rax
+  803a0c:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a0e:	85 c0                	test   %eax,%eax
+  803a10:	78 1f                	js     803a31 <open+0xa3>
+    return fd2num(fd);
+  803a12:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a16:	48 b8 85 2d 80 00 00 	movabs $0x802d85,%rax
+  803a1d:	00 00 00 
+  803a20:	ff d0                	call   *%rax
+  803a22:	89 c3                	mov    %eax,%ebx
+}
+  803a24:	89 d8                	mov    %ebx,%eax
+  803a26:	48 83 c4 18          	add    $0x18,%rsp
+  803a2a:	5b                   	pop    %rbx
+  803a2b:	41 5c                	pop    %r12
+  803a2d:	41 5d                	pop    %r13
+  803a2f:	5d                   	pop    %rbp
+  803a30:	c3                   	ret
+        fd_close(fd, 0);
+  803a31:	be 00 00 00 00       	mov    $0x0,%esi
+  803a36:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a3a:	48 b8 ce 2e 80 00 00 	movabs $0x802ece,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+        return res;
+  803a46:	eb dc                	jmp    803a24 <open+0x96>
+        return -E_BAD_PATH;
+  803a48:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a4d:	eb d5                	jmp    803a24 <open+0x96>
+
+0000000000803a4f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a4f:	55                   	push   %rbp
+  803a50:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a53:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a58:	be 00 00 00 00       	mov    $0x0,%esi
+  803a5d:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a62:	48 b8 fc 34 80 00 00 	movabs $0x8034fc,%rax
+  803a69:	00 00 00 
+  803a6c:	ff d0                	call   *%rax
+}
+  803a6e:	5d                   	pop    %rbp
+  803a6f:	c3                   	ret
+
+0000000000803a70 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a70:	55                   	push   %rbp
+  803a71:	48 89 e5             	mov    %rsp,%rbp
+  803a74:	41 56                	push   %r14
+  803a76:	41 55                	push   %r13
+  803a78:	41 54                	push   %r12
+  803a7a:	53                   	push   %rbx
+  803a7b:	48 83 ec 10          	sub    $0x10,%rsp
+  803a7f:	41 89 f6             	mov    %esi,%r14d
+  803a82:	49 89 d4             	mov    %rdx,%r12
+  803a85:	48 89 cb             	mov    %rcx,%rbx
+  803a88:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a8f:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  803a96:	00 00 00 
+  803a99:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a9b:	85 c0                	test   %eax,%eax
+  803a9d:	78 46                	js     803ae5 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803a9f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803aa3:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803aaa:	00 00 00 
+  803aad:	8b 00                	mov    (%rax),%eax
+  803aaf:	39 02                	cmp    %eax,(%rdx)
+  803ab1:	75 3f                	jne    803af2 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803ab3:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803aba:	00 00 00 
+  803abd:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ac0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ac2:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ac6:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803aca:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ace:	48 89 da             	mov    %rbx,%rdx
+  803ad1:	4c 89 e6             	mov    %r12,%rsi
+  803ad4:	bf 09 00 00 00       	mov    $0x9,%edi
+  803ad9:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  803ae0:	00 00 00 
+  803ae3:	ff d0                	call   *%rax
+}
+  803ae5:	48 83 c4 10          	add    $0x10,%rsp
+  803ae9:	5b                   	pop    %rbx
+  803aea:	41 5c                	pop    %r12
+  803aec:	41 5d                	pop    %r13
+  803aee:	41 5e                	pop    %r14
+  803af0:	5d                   	pop    %rbp
+  803af1:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803af2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803af7:	eb ec                	jmp    803ae5 <file_map+0x75>
+
+0000000000803af9 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803af9:	55                   	push   %rbp
+  803afa:	48 89 e5             	mov    %rsp,%rbp
+  803afd:	41 54                	push   %r12
+  803aff:	53                   	push   %rbx
+  803b00:	48 83 ec 20          	sub    $0x20,%rsp
+  803b04:	41 89 f4             	mov    %esi,%r12d
+  803b07:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b0a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b0e:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  803b15:	00 00 00 
+  803b18:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b1a:	85 c0                	test   %eax,%eax
+  803b1c:	78 3c                	js     803b5a <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b22:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b29:	00 00 00 
+  803b2c:	8b 0a                	mov    (%rdx),%ecx
+  803b2e:	39 08                	cmp    %ecx,(%rax)
+  803b30:	75 31                	jne    803b63 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b32:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b35:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b38:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b3c:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b40:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b45:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b49:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b4e:	48 b8 fc 34 80 00 00 	movabs $0x8034fc,%rax
+  803b55:	00 00 00 
+  803b58:	ff d0                	call   *%rax
+}
+  803b5a:	48 83 c4 20          	add    $0x20,%rsp
+  803b5e:	5b                   	pop    %rbx
+  803b5f:	41 5c                	pop    %r12
+  803b61:	5d                   	pop    %rbp
+  803b62:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b63:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b68:	eb f0                	jmp    803b5a <file_msync+0x61>
+
+0000000000803b6a <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b6a:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b6e:	7f 01                	jg     803b71 <writebuf+0x7>
+  803b70:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b71:	55                   	push   %rbp
+  803b72:	48 89 e5             	mov    %rsp,%rbp
+  803b75:	53                   	push   %rbx
+  803b76:	48 83 ec 08          	sub    $0x8,%rsp
+  803b7a:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b7d:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b81:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b85:	8b 3f                	mov    (%rdi),%edi
+  803b87:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  803b8e:	00 00 00 
+  803b91:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803b93:	48 85 c0             	test   %rax,%rax
+  803b96:	7e 04                	jle    803b9c <writebuf+0x32>
+  803b98:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803b9c:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803ba0:	48 39 c2             	cmp    %rax,%rdx
+  803ba3:	74 0f                	je     803bb4 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803ba5:	48 85 c0             	test   %rax,%rax
+  803ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bad:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bb1:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bb4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bb8:	c9                   	leave
+  803bb9:	c3                   	ret
+
+0000000000803bba <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bba:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bbd:	8d 50 01             	lea    0x1(%rax),%edx
+  803bc0:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bc3:	48 98                	cltq
+  803bc5:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bca:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bd0:	74 01                	je     803bd3 <putch+0x19>
+  803bd2:	c3                   	ret
+putch(int ch, void *arg) {
+  803bd3:	55                   	push   %rbp
+  803bd4:	48 89 e5             	mov    %rsp,%rbp
+  803bd7:	53                   	push   %rbx
+  803bd8:	48 83 ec 08          	sub    $0x8,%rsp
+  803bdc:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bdf:	48 89 f7             	mov    %rsi,%rdi
+  803be2:	48 b8 6a 3b 80 00 00 	movabs $0x803b6a,%rax
+  803be9:	00 00 00 
+  803bec:	ff d0                	call   *%rax
+        state->offset = 0;
+  803bee:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803bf5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bf9:	c9                   	leave
+  803bfa:	c3                   	ret
+
+0000000000803bfb <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803bfb:	55                   	push   %rbp
+  803bfc:	48 89 e5             	mov    %rsp,%rbp
+  803bff:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c06:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c09:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c0f:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c16:	00 00 00 
+    state.result = 0;
+  803c19:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c20:	00 00 00 00 
+    state.error = 1;
+  803c24:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c2b:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c2e:	48 89 f2             	mov    %rsi,%rdx
+  803c31:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c38:	48 bf ba 3b 80 00 00 	movabs $0x803bba,%rdi
+  803c3f:	00 00 00 
+  803c42:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  803c49:	00 00 00 
+  803c4c:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c4e:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c55:	7f 14                	jg     803c6b <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c57:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c5e:	48 85 c0             	test   %rax,%rax
+  803c61:	75 06                	jne    803c69 <vfprintf+0x6e>
+  803c63:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c69:	c9                   	leave
+  803c6a:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c6b:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c72:	48 b8 6a 3b 80 00 00 	movabs $0x803b6a,%rax
+  803c79:	00 00 00 
+  803c7c:	ff d0                	call   *%rax
+  803c7e:	eb d7                	jmp    803c57 <vfprintf+0x5c>
+
+0000000000803c80 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c80:	55                   	push   %rbp
+  803c81:	48 89 e5             	mov    %rsp,%rbp
+  803c84:	48 83 ec 50          	sub    $0x50,%rsp
+  803c88:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c8c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803c90:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c94:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803c98:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803c9f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ca7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803caf:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cb3:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  803cba:	00 00 00 
+  803cbd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cbf:	c9                   	leave
+  803cc0:	c3                   	ret
+
+0000000000803cc1 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cc1:	55                   	push   %rbp
+  803cc2:	48 89 e5             	mov    %rsp,%rbp
+  803cc5:	48 83 ec 50          	sub    $0x50,%rsp
+  803cc9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ccd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cd1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cd5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cd9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cdd:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803ce4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ce8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cec:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cf0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803cf4:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cf8:	48 89 fe             	mov    %rdi,%rsi
+  803cfb:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d00:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  803d07:	00 00 00 
+  803d0a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d0c:	c9                   	leave
+  803d0d:	c3                   	ret
+
+0000000000803d0e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d0e:	55                   	push   %rbp
+  803d0f:	48 89 e5             	mov    %rsp,%rbp
+  803d12:	41 54                	push   %r12
+  803d14:	53                   	push   %rbx
+  803d15:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d18:	48 b8 97 2d 80 00 00 	movabs $0x802d97,%rax
+  803d1f:	00 00 00 
+  803d22:	ff d0                	call   *%rax
+  803d24:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d27:	48 be 70 62 80 00 00 	movabs $0x806270,%rsi
+  803d2e:	00 00 00 
+  803d31:	48 89 df             	mov    %rbx,%rdi
+  803d34:	48 b8 c2 1f 80 00 00 	movabs $0x801fc2,%rax
+  803d3b:	00 00 00 
+  803d3e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d40:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d45:	41 2b 04 24          	sub    (%r12),%eax
+  803d49:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d4f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d56:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d59:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d60:	00 00 00 
+  803d63:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d6f:	5b                   	pop    %rbx
+  803d70:	41 5c                	pop    %r12
+  803d72:	5d                   	pop    %rbp
+  803d73:	c3                   	ret
+
+0000000000803d74 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d74:	55                   	push   %rbp
+  803d75:	48 89 e5             	mov    %rsp,%rbp
+  803d78:	41 54                	push   %r12
+  803d7a:	53                   	push   %rbx
+  803d7b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d83:	48 89 fe             	mov    %rdi,%rsi
+  803d86:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d8b:	49 bc ff 27 80 00 00 	movabs $0x8027ff,%r12
+  803d92:	00 00 00 
+  803d95:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803d98:	48 89 df             	mov    %rbx,%rdi
+  803d9b:	48 b8 97 2d 80 00 00 	movabs $0x802d97,%rax
+  803da2:	00 00 00 
+  803da5:	ff d0                	call   *%rax
+  803da7:	48 89 c6             	mov    %rax,%rsi
+  803daa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803daf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db4:	41 ff d4             	call   *%r12
+}
+  803db7:	5b                   	pop    %rbx
+  803db8:	41 5c                	pop    %r12
+  803dba:	5d                   	pop    %rbp
+  803dbb:	c3                   	ret
+
+0000000000803dbc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dbc:	55                   	push   %rbp
+  803dbd:	48 89 e5             	mov    %rsp,%rbp
+  803dc0:	41 57                	push   %r15
+  803dc2:	41 56                	push   %r14
+  803dc4:	41 55                	push   %r13
+  803dc6:	41 54                	push   %r12
+  803dc8:	53                   	push   %rbx
+  803dc9:	48 83 ec 18          	sub    $0x18,%rsp
+  803dcd:	49 89 fc             	mov    %rdi,%r12
+  803dd0:	49 89 f5             	mov    %rsi,%r13
+  803dd3:	49 89 d7             	mov    %rdx,%r15
+  803dd6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dda:	48 b8 97 2d 80 00 00 	movabs $0x802d97,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803de6:	4d 85 ff             	test   %r15,%r15
+  803de9:	0f 84 af 00 00 00    	je     803e9e <devpipe_write+0xe2>
+  803def:	48 89 c3             	mov    %rax,%rbx
+  803df2:	4c 89 f8             	mov    %r15,%rax
+  803df5:	4d 89 ef             	mov    %r13,%r15
+  803df8:	4c 01 e8             	add    %r13,%rax
+  803dfb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dff:	49 bd f5 26 80 00 00 	movabs $0x8026f5,%r13
+  803e06:	00 00 00 
+            sys_yield();
+  803e09:	49 be 86 26 80 00 00 	movabs $0x802686,%r14
+  803e10:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e13:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e16:	48 63 ce             	movslq %esi,%rcx
+  803e19:	48 63 03             	movslq (%rbx),%rax
+  803e1c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e22:	48 39 c1             	cmp    %rax,%rcx
+  803e25:	72 2e                	jb     803e55 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e27:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e2c:	48 89 da             	mov    %rbx,%rdx
+  803e2f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e34:	4c 89 e7             	mov    %r12,%rdi
+  803e37:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e3a:	85 c0                	test   %eax,%eax
+  803e3c:	74 66                	je     803ea4 <devpipe_write+0xe8>
+            sys_yield();
+  803e3e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e41:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e44:	48 63 ce             	movslq %esi,%rcx
+  803e47:	48 63 03             	movslq (%rbx),%rax
+  803e4a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e50:	48 39 c1             	cmp    %rax,%rcx
+  803e53:	73 d2                	jae    803e27 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e55:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e59:	48 89 ca             	mov    %rcx,%rdx
+  803e5c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e60:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e67:	08 10 20 
+  803e6a:	48 f7 e2             	mul    %rdx
+  803e6d:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e71:	48 89 d0             	mov    %rdx,%rax
+  803e74:	48 c1 e0 09          	shl    $0x9,%rax
+  803e78:	48 29 d0             	sub    %rdx,%rax
+  803e7b:	48 c1 e0 03          	shl    $0x3,%rax
+  803e7f:	48 29 c1             	sub    %rax,%rcx
+  803e82:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e87:	83 c6 01             	add    $0x1,%esi
+  803e8a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e8d:	49 83 c7 01          	add    $0x1,%r15
+  803e91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e95:	49 39 c7             	cmp    %rax,%r15
+  803e98:	0f 85 75 ff ff ff    	jne    803e13 <devpipe_write+0x57>
+    return n;
+  803e9e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ea2:	eb 05                	jmp    803ea9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ea9:	48 83 c4 18          	add    $0x18,%rsp
+  803ead:	5b                   	pop    %rbx
+  803eae:	41 5c                	pop    %r12
+  803eb0:	41 5d                	pop    %r13
+  803eb2:	41 5e                	pop    %r14
+  803eb4:	41 5f                	pop    %r15
+  803eb6:	5d                   	pop    %rbp
+  803eb7:	c3                   	ret
+
+0000000000803eb8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803eb8:	55                   	push   %rbp
+  803eb9:	48 89 e5             	mov    %rsp,%rbp
+  803ebc:	41 57                	push   %r15
+  803ebe:	41 56                	push   %r14
+  803ec0:	41 55                	push   %r13
+  803ec2:	41 54                	push   %r12
+  803ec4:	53                   	push   %rbx
+  803ec5:	48 83 ec 18          	sub    $0x18,%rsp
+  803ec9:	49 89 fc             	mov    %rdi,%r12
+  803ecc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ed0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ed4:	48 b8 97 2d 80 00 00 	movabs $0x802d97,%rax
+  803edb:	00 00 00 
+  803ede:	ff d0                	call   *%rax
+  803ee0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ee3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ee9:	49 bd f5 26 80 00 00 	movabs $0x8026f5,%r13
+  803ef0:	00 00 00 
+            sys_yield();
+  803ef3:	49 be 86 26 80 00 00 	movabs $0x802686,%r14
+  803efa:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803efd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f02:	74 7d                	je     803f81 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f04:	8b 03                	mov    (%rbx),%eax
+  803f06:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f09:	75 26                	jne    803f31 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f0b:	4d 85 ff             	test   %r15,%r15
+  803f0e:	75 77                	jne    803f87 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f10:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f15:	48 89 da             	mov    %rbx,%rdx
+  803f18:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f1d:	4c 89 e7             	mov    %r12,%rdi
+  803f20:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f23:	85 c0                	test   %eax,%eax
+  803f25:	74 72                	je     803f99 <devpipe_read+0xe1>
+            sys_yield();
+  803f27:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f2a:	8b 03                	mov    (%rbx),%eax
+  803f2c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f2f:	74 df                	je     803f10 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f31:	48 63 c8             	movslq %eax,%rcx
+  803f34:	48 89 ca             	mov    %rcx,%rdx
+  803f37:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f3b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f42:	08 10 20 
+  803f45:	48 89 d0             	mov    %rdx,%rax
+  803f48:	48 f7 e6             	mul    %rsi
+  803f4b:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f4f:	48 89 d0             	mov    %rdx,%rax
+  803f52:	48 c1 e0 09          	shl    $0x9,%rax
+  803f56:	48 29 d0             	sub    %rdx,%rax
+  803f59:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f60:	00 
+  803f61:	48 89 c8             	mov    %rcx,%rax
+  803f64:	48 29 d0             	sub    %rdx,%rax
+  803f67:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f6c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f70:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f74:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f77:	49 83 c7 01          	add    $0x1,%r15
+  803f7b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f7f:	75 83                	jne    803f04 <devpipe_read+0x4c>
+    return n;
+  803f81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f85:	eb 03                	jmp    803f8a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f87:	4c 89 f8             	mov    %r15,%rax
+}
+  803f8a:	48 83 c4 18          	add    $0x18,%rsp
+  803f8e:	5b                   	pop    %rbx
+  803f8f:	41 5c                	pop    %r12
+  803f91:	41 5d                	pop    %r13
+  803f93:	41 5e                	pop    %r14
+  803f95:	41 5f                	pop    %r15
+  803f97:	5d                   	pop    %rbp
+  803f98:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9e:	eb ea                	jmp    803f8a <devpipe_read+0xd2>
+
+0000000000803fa0 <pipe>:
+pipe(int pfd[2]) {
+  803fa0:	55                   	push   %rbp
+  803fa1:	48 89 e5             	mov    %rsp,%rbp
+  803fa4:	41 55                	push   %r13
+  803fa6:	41 54                	push   %r12
+  803fa8:	53                   	push   %rbx
+  803fa9:	48 83 ec 18          	sub    $0x18,%rsp
+  803fad:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fb0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fb4:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  803fbb:	00 00 00 
+  803fbe:	ff d0                	call   *%rax
+  803fc0:	89 c3                	mov    %eax,%ebx
+  803fc2:	85 c0                	test   %eax,%eax
+  803fc4:	0f 88 a0 01 00 00    	js     80416a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fca:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fcf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fd4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fdd:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+  803fe9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803feb:	85 c0                	test   %eax,%eax
+  803fed:	0f 88 77 01 00 00    	js     80416a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ff3:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ff7:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  803ffe:	00 00 00 
+  804001:	ff d0                	call   *%rax
+  804003:	89 c3                	mov    %eax,%ebx
+  804005:	85 c0                	test   %eax,%eax
+  804007:	0f 88 43 01 00 00    	js     804150 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80400d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804012:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804017:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80401b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804020:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  804027:	00 00 00 
+  80402a:	ff d0                	call   *%rax
+  80402c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80402e:	85 c0                	test   %eax,%eax
+  804030:	0f 88 1a 01 00 00    	js     804150 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804036:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80403a:	48 b8 97 2d 80 00 00 	movabs $0x802d97,%rax
+  804041:	00 00 00 
+  804044:	ff d0                	call   *%rax
+  804046:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804049:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80404e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804053:	48 89 c6             	mov    %rax,%rsi
+  804056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405b:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  804062:	00 00 00 
+  804065:	ff d0                	call   *%rax
+  804067:	89 c3                	mov    %eax,%ebx
+  804069:	85 c0                	test   %eax,%eax
+  80406b:	0f 88 c5 00 00 00    	js     804136 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804071:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804075:	48 b8 97 2d 80 00 00 	movabs $0x802d97,%rax
+  80407c:	00 00 00 
+  80407f:	ff d0                	call   *%rax
+  804081:	48 89 c1             	mov    %rax,%rcx
+  804084:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80408a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804090:	ba 00 00 00 00       	mov    $0x0,%edx
+  804095:	4c 89 ee             	mov    %r13,%rsi
+  804098:	bf 00 00 00 00       	mov    $0x0,%edi
+  80409d:	48 b8 94 27 80 00 00 	movabs $0x802794,%rax
+  8040a4:	00 00 00 
+  8040a7:	ff d0                	call   *%rax
+  8040a9:	89 c3                	mov    %eax,%ebx
+  8040ab:	85 c0                	test   %eax,%eax
+  8040ad:	78 6e                	js     80411d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040af:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040b4:	4c 89 ef             	mov    %r13,%rdi
+  8040b7:	48 b8 bd 26 80 00 00 	movabs $0x8026bd,%rax
+  8040be:	00 00 00 
+  8040c1:	ff d0                	call   *%rax
+  8040c3:	83 f8 02             	cmp    $0x2,%eax
+  8040c6:	0f 85 ab 00 00 00    	jne    804177 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040cc:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040d3:	00 00 
+  8040d5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040d9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040db:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040df:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040e6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040ea:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040f0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040f7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040fb:	48 bb 85 2d 80 00 00 	movabs $0x802d85,%rbx
+  804102:	00 00 00 
+  804105:	ff d3                	call   *%rbx
+  804107:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80410b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80410f:	ff d3                	call   *%rbx
+  804111:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80411b:	eb 4d                	jmp    80416a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80411d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804122:	4c 89 ee             	mov    %r13,%rsi
+  804125:	bf 00 00 00 00       	mov    $0x0,%edi
+  80412a:	48 b8 ff 27 80 00 00 	movabs $0x8027ff,%rax
+  804131:	00 00 00 
+  804134:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804136:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80413b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80413f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804144:	48 b8 ff 27 80 00 00 	movabs $0x8027ff,%rax
+  80414b:	00 00 00 
+  80414e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804150:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804155:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804159:	bf 00 00 00 00       	mov    $0x0,%edi
+  80415e:	48 b8 ff 27 80 00 00 	movabs $0x8027ff,%rax
+  804165:	00 00 00 
+  804168:	ff d0                	call   *%rax
+}
+  80416a:	89 d8                	mov    %ebx,%eax
+  80416c:	48 83 c4 18          	add    $0x18,%rsp
+  804170:	5b                   	pop    %rbx
+  804171:	41 5c                	pop    %r12
+  804173:	41 5d                	pop    %r13
+  804175:	5d                   	pop    %rbp
+  804176:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804177:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  80417e:	00 00 00 
+  804181:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804188:	00 00 00 
+  80418b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804190:	48 bf 77 62 80 00 00 	movabs $0x806277,%rdi
+  804197:	00 00 00 
+  80419a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419f:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  8041a6:	00 00 00 
+  8041a9:	41 ff d0             	call   *%r8
+
+00000000008041ac <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041ac:	55                   	push   %rbp
+  8041ad:	48 89 e5             	mov    %rsp,%rbp
+  8041b0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041b4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041b8:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  8041bf:	00 00 00 
+  8041c2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041c4:	85 c0                	test   %eax,%eax
+  8041c6:	78 35                	js     8041fd <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041c8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041cc:	48 b8 97 2d 80 00 00 	movabs $0x802d97,%rax
+  8041d3:	00 00 00 
+  8041d6:	ff d0                	call   *%rax
+  8041d8:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041db:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041e0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041e5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e9:	48 b8 f5 26 80 00 00 	movabs $0x8026f5,%rax
+  8041f0:	00 00 00 
+  8041f3:	ff d0                	call   *%rax
+  8041f5:	85 c0                	test   %eax,%eax
+  8041f7:	0f 94 c0             	sete   %al
+  8041fa:	0f b6 c0             	movzbl %al,%eax
+}
+  8041fd:	c9                   	leave
+  8041fe:	c3                   	ret
+
+00000000008041ff <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8041ff:	48 89 f8             	mov    %rdi,%rax
+  804202:	48 c1 e8 27          	shr    $0x27,%rax
+  804206:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80420d:	01 00 00 
+  804210:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804214:	f6 c2 01             	test   $0x1,%dl
+  804217:	74 6d                	je     804286 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804219:	48 89 f8             	mov    %rdi,%rax
+  80421c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804220:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804227:	01 00 00 
+  80422a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80422e:	f6 c2 01             	test   $0x1,%dl
+  804231:	74 62                	je     804295 <get_uvpt_entry+0x96>
+  804233:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80423a:	01 00 00 
+  80423d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804241:	f6 c2 80             	test   $0x80,%dl
+  804244:	75 4f                	jne    804295 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804246:	48 89 f8             	mov    %rdi,%rax
+  804249:	48 c1 e8 15          	shr    $0x15,%rax
+  80424d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804254:	01 00 00 
+  804257:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80425b:	f6 c2 01             	test   $0x1,%dl
+  80425e:	74 44                	je     8042a4 <get_uvpt_entry+0xa5>
+  804260:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804267:	01 00 00 
+  80426a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80426e:	f6 c2 80             	test   $0x80,%dl
+  804271:	75 31                	jne    8042a4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804273:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804277:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80427e:	01 00 00 
+  804281:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804285:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804286:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80428d:	01 00 00 
+  804290:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804294:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804295:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80429c:	01 00 00 
+  80429f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042a3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042a4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042ab:	01 00 00 
+  8042ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042b2:	c3                   	ret
+
+00000000008042b3 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042b3:	55                   	push   %rbp
+  8042b4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042b7:	48 b8 ff 41 80 00 00 	movabs $0x8041ff,%rax
+  8042be:	00 00 00 
+  8042c1:	ff d0                	call   *%rax
+  8042c3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042c6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042cb:	89 c1                	mov    %eax,%ecx
+  8042cd:	83 c9 04             	or     $0x4,%ecx
+  8042d0:	f6 c2 01             	test   $0x1,%dl
+  8042d3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042d6:	89 c1                	mov    %eax,%ecx
+  8042d8:	83 c9 02             	or     $0x2,%ecx
+  8042db:	f6 c2 02             	test   $0x2,%dl
+  8042de:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042e1:	89 c1                	mov    %eax,%ecx
+  8042e3:	83 c9 01             	or     $0x1,%ecx
+  8042e6:	48 85 d2             	test   %rdx,%rdx
+  8042e9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042ec:	89 c1                	mov    %eax,%ecx
+  8042ee:	83 c9 40             	or     $0x40,%ecx
+  8042f1:	f6 c6 04             	test   $0x4,%dh
+  8042f4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8042f7:	5d                   	pop    %rbp
+  8042f8:	c3                   	ret
+
+00000000008042f9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8042f9:	55                   	push   %rbp
+  8042fa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042fd:	48 b8 ff 41 80 00 00 	movabs $0x8041ff,%rax
+  804304:	00 00 00 
+  804307:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804309:	48 c1 e8 06          	shr    $0x6,%rax
+  80430d:	83 e0 01             	and    $0x1,%eax
+}
+  804310:	5d                   	pop    %rbp
+  804311:	c3                   	ret
+
+0000000000804312 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804312:	55                   	push   %rbp
+  804313:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804316:	48 b8 ff 41 80 00 00 	movabs $0x8041ff,%rax
+  80431d:	00 00 00 
+  804320:	ff d0                	call   *%rax
+  804322:	83 e0 01             	and    $0x1,%eax
+}
+  804325:	5d                   	pop    %rbp
+  804326:	c3                   	ret
+
+0000000000804327 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804327:	55                   	push   %rbp
+  804328:	48 89 e5             	mov    %rsp,%rbp
+  80432b:	41 57                	push   %r15
+  80432d:	41 56                	push   %r14
+  80432f:	41 55                	push   %r13
+  804331:	41 54                	push   %r12
+  804333:	53                   	push   %rbx
+  804334:	48 83 ec 28          	sub    $0x28,%rsp
+  804338:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80433c:	48 85 ff             	test   %rdi,%rdi
+  80433f:	74 1e                	je     80435f <foreach_shared_region+0x38>
+  804341:	49 89 ff             	mov    %rdi,%r15
+  804344:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80434a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804350:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804357:	01 00 00 
+  80435a:	e9 72 02 00 00       	jmp    8045d1 <foreach_shared_region+0x2aa>
+    assert(fun);
+  80435f:	48 b9 ac 62 80 00 00 	movabs $0x8062ac,%rcx
+  804366:	00 00 00 
+  804369:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804370:	00 00 00 
+  804373:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804378:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  80437f:	00 00 00 
+  804382:	b8 00 00 00 00       	mov    $0x0,%eax
+  804387:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  80438e:	00 00 00 
+  804391:	41 ff d0             	call   *%r8
+  804394:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80439b:	eb 6c                	jmp    804409 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80439d:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043a4:	ff ff ff 
+  8043a7:	4c 21 e2             	and    %r12,%rdx
+  8043aa:	48 89 d8             	mov    %rbx,%rax
+  8043ad:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043b2:	48 83 c0 01          	add    $0x1,%rax
+  8043b6:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043ba:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043c1:	00 00 00 
+  8043c4:	48 21 c8             	and    %rcx,%rax
+  8043c7:	48 09 d0             	or     %rdx,%rax
+  8043ca:	49 89 c4             	mov    %rax,%r12
+  8043cd:	eb 30                	jmp    8043ff <foreach_shared_region+0xd8>
+  8043cf:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043d6:	ff ff ff 
+  8043d9:	4c 21 e2             	and    %r12,%rdx
+  8043dc:	48 89 d8             	mov    %rbx,%rax
+  8043df:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043e4:	48 83 c0 01          	add    $0x1,%rax
+  8043e8:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043ec:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043f3:	00 00 00 
+  8043f6:	48 21 c8             	and    %rcx,%rax
+  8043f9:	48 09 d0             	or     %rdx,%rax
+  8043fc:	49 89 c4             	mov    %rax,%r12
+  8043ff:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804403:	0f 84 99 01 00 00    	je     8045a2 <foreach_shared_region+0x27b>
+  804409:	4c 89 e3             	mov    %r12,%rbx
+  80440c:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804410:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804417:	01 00 00 
+  80441a:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80441e:	a8 01                	test   $0x1,%al
+  804420:	0f 84 77 ff ff ff    	je     80439d <foreach_shared_region+0x76>
+  804426:	a8 80                	test   $0x80,%al
+  804428:	74 19                	je     804443 <foreach_shared_region+0x11c>
+  80442a:	f6 c4 04             	test   $0x4,%ah
+  80442d:	74 a0                	je     8043cf <foreach_shared_region+0xa8>
+  80442f:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804436:	40 
+  804437:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80443b:	4c 89 e7             	mov    %r12,%rdi
+  80443e:	41 ff d7             	call   *%r15
+  804441:	eb 8c                	jmp    8043cf <foreach_shared_region+0xa8>
+  804443:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80444a:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80444e:	eb 46                	jmp    804496 <foreach_shared_region+0x16f>
+  804450:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804457:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80445d:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804461:	48 c1 e0 15          	shl    $0x15,%rax
+  804465:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80446a:	49 09 c4             	or     %rax,%r12
+  80446d:	eb 1d                	jmp    80448c <foreach_shared_region+0x165>
+  80446f:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804476:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80447c:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804480:	48 c1 e0 15          	shl    $0x15,%rax
+  804484:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804489:	49 09 c4             	or     %rax,%r12
+  80448c:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804490:	0f 84 d3 00 00 00    	je     804569 <foreach_shared_region+0x242>
+  804496:	4c 89 e3             	mov    %r12,%rbx
+  804499:	48 c1 eb 15          	shr    $0x15,%rbx
+  80449d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044a4:	01 00 00 
+  8044a7:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044ab:	a8 01                	test   $0x1,%al
+  8044ad:	74 a1                	je     804450 <foreach_shared_region+0x129>
+  8044af:	a8 80                	test   $0x80,%al
+  8044b1:	74 19                	je     8044cc <foreach_shared_region+0x1a5>
+  8044b3:	f6 c4 04             	test   $0x4,%ah
+  8044b6:	74 b7                	je     80446f <foreach_shared_region+0x148>
+  8044b8:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044bf:	00 
+  8044c0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044c4:	4c 89 e7             	mov    %r12,%rdi
+  8044c7:	41 ff d7             	call   *%r15
+  8044ca:	eb a3                	jmp    80446f <foreach_shared_region+0x148>
+  8044cc:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044d2:	eb 3b                	jmp    80450f <foreach_shared_region+0x1e8>
+  8044d4:	f6 c4 04             	test   $0x4,%ah
+  8044d7:	74 12                	je     8044eb <foreach_shared_region+0x1c4>
+  8044d9:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044e0:	00 
+  8044e1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044e5:	4c 89 e7             	mov    %r12,%rdi
+  8044e8:	41 ff d7             	call   *%r15
+  8044eb:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8044f2:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044f8:	48 83 c3 01          	add    $0x1,%rbx
+  8044fc:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804500:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804506:	49 09 dc             	or     %rbx,%r12
+  804509:	41 83 ed 01          	sub    $0x1,%r13d
+  80450d:	74 2f                	je     80453e <foreach_shared_region+0x217>
+  80450f:	4c 89 e3             	mov    %r12,%rbx
+  804512:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804516:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80451a:	a8 01                	test   $0x1,%al
+  80451c:	75 b6                	jne    8044d4 <foreach_shared_region+0x1ad>
+  80451e:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804525:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80452b:	48 83 c3 01          	add    $0x1,%rbx
+  80452f:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804533:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804539:	49 09 dc             	or     %rbx,%r12
+  80453c:	eb cb                	jmp    804509 <foreach_shared_region+0x1e2>
+  80453e:	4c 89 e0             	mov    %r12,%rax
+  804541:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804547:	49 c1 ec 15          	shr    $0x15,%r12
+  80454b:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804552:	49 83 c4 01          	add    $0x1,%r12
+  804556:	49 c1 e4 15          	shl    $0x15,%r12
+  80455a:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804561:	49 09 c4             	or     %rax,%r12
+  804564:	e9 23 ff ff ff       	jmp    80448c <foreach_shared_region+0x165>
+  804569:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80456d:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804574:	ff ff ff 
+  804577:	4c 21 e0             	and    %r12,%rax
+  80457a:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80457e:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804585:	49 83 c4 01          	add    $0x1,%r12
+  804589:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80458d:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804594:	00 00 00 
+  804597:	49 21 d4             	and    %rdx,%r12
+  80459a:	49 09 c4             	or     %rax,%r12
+  80459d:	e9 5d fe ff ff       	jmp    8043ff <foreach_shared_region+0xd8>
+  8045a2:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045a9:	00 ff ff 
+  8045ac:	4c 21 e0             	and    %r12,%rax
+  8045af:	49 c1 ec 27          	shr    $0x27,%r12
+  8045b3:	49 83 c4 01          	add    $0x1,%r12
+  8045b7:	49 c1 e4 27          	shl    $0x27,%r12
+  8045bb:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045c2:	ff 00 00 
+  8045c5:	49 21 d4             	and    %rdx,%r12
+  8045c8:	49 09 c4             	or     %rax,%r12
+  8045cb:	41 83 ed 01          	sub    $0x1,%r13d
+  8045cf:	74 48                	je     804619 <foreach_shared_region+0x2f2>
+  8045d1:	4c 89 e0             	mov    %r12,%rax
+  8045d4:	48 c1 e8 27          	shr    $0x27,%rax
+  8045d8:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045df:	01 00 00 
+  8045e2:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045e6:	f6 c2 01             	test   $0x1,%dl
+  8045e9:	0f 85 a5 fd ff ff    	jne    804394 <foreach_shared_region+0x6d>
+  8045ef:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8045f6:	00 ff ff 
+  8045f9:	4c 21 e2             	and    %r12,%rdx
+  8045fc:	48 83 c0 01          	add    $0x1,%rax
+  804600:	48 c1 e0 27          	shl    $0x27,%rax
+  804604:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80460b:	ff 00 00 
+  80460e:	48 21 c8             	and    %rcx,%rax
+  804611:	48 09 d0             	or     %rdx,%rax
+  804614:	49 89 c4             	mov    %rax,%r12
+  804617:	eb b2                	jmp    8045cb <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804619:	4d 85 e4             	test   %r12,%r12
+  80461c:	75 14                	jne    804632 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80461e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804623:	48 83 c4 28          	add    $0x28,%rsp
+  804627:	5b                   	pop    %rbx
+  804628:	41 5c                	pop    %r12
+  80462a:	41 5d                	pop    %r13
+  80462c:	41 5e                	pop    %r14
+  80462e:	41 5f                	pop    %r15
+  804630:	5d                   	pop    %rbp
+  804631:	c3                   	ret
+    assert(addr == 0);
+  804632:	48 b9 bb 62 80 00 00 	movabs $0x8062bb,%rcx
+  804639:	00 00 00 
+  80463c:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804643:	00 00 00 
+  804646:	be 67 00 00 00       	mov    $0x67,%esi
+  80464b:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  804652:	00 00 00 
+  804655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465a:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  804661:	00 00 00 
+  804664:	41 ff d0             	call   *%r8
+
+0000000000804667 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804667:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  80466e:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804671:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804677:	eb 33                	jmp    8046ac <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804679:	48 83 c0 20          	add    $0x20,%rax
+  80467d:	4c 39 c0             	cmp    %r8,%rax
+  804680:	74 25                	je     8046a7 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804682:	48 8b 10             	mov    (%rax),%rdx
+  804685:	48 85 d2             	test   %rdx,%rdx
+  804688:	74 ef                	je     804679 <mmap_place+0x12>
+  80468a:	48 89 d1             	mov    %rdx,%rcx
+  80468d:	48 03 48 08          	add    0x8(%rax),%rcx
+  804691:	48 39 cf             	cmp    %rcx,%rdi
+  804694:	73 e3                	jae    804679 <mmap_place+0x12>
+  804696:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80469a:	4c 39 ca             	cmp    %r9,%rdx
+  80469d:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046a1:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046a5:	eb d2                	jmp    804679 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046a7:	45 84 d2             	test   %r10b,%r10b
+  8046aa:	74 12                	je     8046be <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046ac:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046b3:	00 00 00 
+        moved = 0;
+  8046b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046bc:	eb c4                	jmp    804682 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046be:	48 01 fe             	add    %rdi,%rsi
+  8046c1:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046c8:	00 00 00 
+  8046cb:	48 39 f0             	cmp    %rsi,%rax
+  8046ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d3:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046d7:	c3                   	ret
+
+00000000008046d8 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046d8:	55                   	push   %rbp
+  8046d9:	48 89 e5             	mov    %rsp,%rbp
+  8046dc:	41 57                	push   %r15
+  8046de:	41 56                	push   %r14
+  8046e0:	41 55                	push   %r13
+  8046e2:	41 54                	push   %r12
+  8046e4:	53                   	push   %rbx
+  8046e5:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046e9:	48 8b 1f             	mov    (%rdi),%rbx
+  8046ec:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046f3:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046fa:	00 00 00 
+  8046fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804702:	eb 12                	jmp    804716 <mmap_pgfault+0x3e>
+  804704:	48 83 c2 01          	add    $0x1,%rdx
+  804708:	48 83 c0 20          	add    $0x20,%rax
+  80470c:	48 83 fa 20          	cmp    $0x20,%rdx
+  804710:	0f 84 04 01 00 00    	je     80481a <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804716:	48 8b 08             	mov    (%rax),%rcx
+  804719:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80471d:	48 39 de             	cmp    %rbx,%rsi
+  804720:	73 e2                	jae    804704 <mmap_pgfault+0x2c>
+  804722:	48 03 48 08          	add    0x8(%rax),%rcx
+  804726:	48 39 cb             	cmp    %rcx,%rbx
+  804729:	73 d9                	jae    804704 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80472b:	48 c1 e2 05          	shl    $0x5,%rdx
+  80472f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804736:	00 00 00 
+  804739:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80473d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804741:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804745:	f6 c2 01             	test   $0x1,%dl
+  804748:	0f 84 e0 00 00 00    	je     80482e <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80474e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804753:	f6 c2 02             	test   $0x2,%dl
+  804756:	0f 84 c3 00 00 00    	je     80481f <mmap_pgfault+0x147>
+  80475c:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804763:	ff ff ff 
+  804766:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80476a:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804771:	00 00 00 
+  804774:	48 39 ca             	cmp    %rcx,%rdx
+  804777:	0f 85 a2 00 00 00    	jne    80481f <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80477d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804782:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804787:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80478e:	00 00 00 
+  804791:	bf 00 00 00 00       	mov    $0x0,%edi
+  804796:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  80479d:	00 00 00 
+  8047a0:	ff d0                	call   *%rax
+  8047a2:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a9:	85 d2                	test   %edx,%edx
+  8047ab:	78 72                	js     80481f <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047b2:	48 89 de             	mov    %rbx,%rsi
+  8047b5:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047bc:	00 00 00 
+  8047bf:	4c 89 e7             	mov    %r12,%rdi
+  8047c2:	48 b8 79 23 80 00 00 	movabs $0x802379,%rax
+  8047c9:	00 00 00 
+  8047cc:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047ce:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047d4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047da:	48 89 d9             	mov    %rbx,%rcx
+  8047dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047e2:	4c 89 e6             	mov    %r12,%rsi
+  8047e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ea:	48 b8 94 27 80 00 00 	movabs $0x802794,%rax
+  8047f1:	00 00 00 
+  8047f4:	ff d0                	call   *%rax
+  8047f6:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8047f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047fd:	4c 89 e6             	mov    %r12,%rsi
+  804800:	bf 00 00 00 00       	mov    $0x0,%edi
+  804805:	48 b8 ff 27 80 00 00 	movabs $0x8027ff,%rax
+  80480c:	00 00 00 
+  80480f:	ff d0                	call   *%rax
+    return res >= 0;
+  804811:	89 d8                	mov    %ebx,%eax
+  804813:	f7 d0                	not    %eax
+  804815:	c1 e8 1f             	shr    $0x1f,%eax
+  804818:	eb 05                	jmp    80481f <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80481a:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80481f:	48 83 c4 18          	add    $0x18,%rsp
+  804823:	5b                   	pop    %rbx
+  804824:	41 5c                	pop    %r12
+  804826:	41 5d                	pop    %r13
+  804828:	41 5e                	pop    %r14
+  80482a:	41 5f                	pop    %r15
+  80482c:	5d                   	pop    %rbp
+  80482d:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80482e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804832:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804836:	4c 03 30             	add    (%rax),%r14
+  804839:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804840:	49 39 c6             	cmp    %rax,%r14
+  804843:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804847:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80484e:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804854:	49 bf 12 43 80 00 00 	movabs $0x804312,%r15
+  80485b:	00 00 00 
+  80485e:	4d 39 f4             	cmp    %r14,%r12
+  804861:	73 1d                	jae    804880 <mmap_pgfault+0x1a8>
+  804863:	4c 89 e7             	mov    %r12,%rdi
+  804866:	41 ff d7             	call   *%r15
+  804869:	84 c0                	test   %al,%al
+  80486b:	75 13                	jne    804880 <mmap_pgfault+0x1a8>
+  80486d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804874:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80487b:	4d 39 f4             	cmp    %r14,%r12
+  80487e:	72 e3                	jb     804863 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804880:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804886:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80488a:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80488e:	74 2a                	je     8048ba <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804890:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804894:	89 de                	mov    %ebx,%esi
+  804896:	2b 30                	sub    (%rax),%esi
+  804898:	03 70 1c             	add    0x1c(%rax),%esi
+  80489b:	8b 78 18             	mov    0x18(%rax),%edi
+  80489e:	4c 89 e9             	mov    %r13,%rcx
+  8048a1:	48 89 da             	mov    %rbx,%rdx
+  8048a4:	48 b8 70 3a 80 00 00 	movabs $0x803a70,%rax
+  8048ab:	00 00 00 
+  8048ae:	ff d0                	call   *%rax
+    return res > 0;
+  8048b0:	85 c0                	test   %eax,%eax
+  8048b2:	0f 9f c0             	setg   %al
+  8048b5:	e9 65 ff ff ff       	jmp    80481f <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048ba:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048be:	eb d0                	jmp    804890 <mmap_pgfault+0x1b8>
+
+00000000008048c0 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048c0:	55                   	push   %rbp
+  8048c1:	48 89 e5             	mov    %rsp,%rbp
+  8048c4:	41 57                	push   %r15
+  8048c6:	41 56                	push   %r14
+  8048c8:	41 55                	push   %r13
+  8048ca:	41 54                	push   %r12
+  8048cc:	53                   	push   %rbx
+  8048cd:	48 83 ec 28          	sub    $0x28,%rsp
+  8048d1:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048d5:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048d8:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048df:	ff ff ff 
+  8048e2:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048eb:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8048f2:	00 00 00 
+  8048f5:	48 39 ca             	cmp    %rcx,%rdx
+  8048f8:	0f 85 e5 00 00 00    	jne    8049e3 <mmap_writeback+0x123>
+  8048fe:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804901:	4c 39 ee             	cmp    %r13,%rsi
+  804904:	0f 83 e8 00 00 00    	jae    8049f2 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80490a:	49 be 12 43 80 00 00 	movabs $0x804312,%r14
+  804911:	00 00 00 
+  804914:	49 bf f9 42 80 00 00 	movabs $0x8042f9,%r15
+  80491b:	00 00 00 
+  80491e:	eb 10                	jmp    804930 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804920:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804927:	4d 39 ec             	cmp    %r13,%r12
+  80492a:	0f 83 ae 00 00 00    	jae    8049de <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804930:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804934:	4c 89 e7             	mov    %r12,%rdi
+  804937:	41 ff d6             	call   *%r14
+  80493a:	84 c0                	test   %al,%al
+  80493c:	74 e2                	je     804920 <mmap_writeback+0x60>
+  80493e:	4c 89 e7             	mov    %r12,%rdi
+  804941:	41 ff d7             	call   *%r15
+  804944:	84 c0                	test   %al,%al
+  804946:	74 d8                	je     804920 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804948:	4c 89 e3             	mov    %r12,%rbx
+  80494b:	4d 39 ec             	cmp    %r13,%r12
+  80494e:	73 20                	jae    804970 <mmap_writeback+0xb0>
+  804950:	48 89 df             	mov    %rbx,%rdi
+  804953:	41 ff d6             	call   *%r14
+  804956:	84 c0                	test   %al,%al
+  804958:	74 16                	je     804970 <mmap_writeback+0xb0>
+  80495a:	48 89 df             	mov    %rbx,%rdi
+  80495d:	41 ff d7             	call   *%r15
+  804960:	84 c0                	test   %al,%al
+  804962:	74 0c                	je     804970 <mmap_writeback+0xb0>
+  804964:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80496b:	4c 39 eb             	cmp    %r13,%rbx
+  80496e:	72 e0                	jb     804950 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804970:	48 89 d9             	mov    %rbx,%rcx
+  804973:	4c 29 e1             	sub    %r12,%rcx
+  804976:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80497a:	44 89 e6             	mov    %r12d,%esi
+  80497d:	2b 30                	sub    (%rax),%esi
+  80497f:	49 89 c4             	mov    %rax,%r12
+  804982:	03 70 1c             	add    0x1c(%rax),%esi
+  804985:	8b 78 18             	mov    0x18(%rax),%edi
+  804988:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80498c:	48 89 ca             	mov    %rcx,%rdx
+  80498f:	48 b8 f9 3a 80 00 00 	movabs $0x803af9,%rax
+  804996:	00 00 00 
+  804999:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80499b:	85 c0                	test   %eax,%eax
+  80499d:	78 44                	js     8049e3 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  80499f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049a4:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049a7:	41 89 c1             	mov    %eax,%r9d
+  8049aa:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049b1:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049b5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049be:	48 89 ce             	mov    %rcx,%rsi
+  8049c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049c6:	48 b8 94 27 80 00 00 	movabs $0x802794,%rax
+  8049cd:	00 00 00 
+  8049d0:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049d2:	85 c0                	test   %eax,%eax
+  8049d4:	78 0d                	js     8049e3 <mmap_writeback+0x123>
+  8049d6:	49 89 dc             	mov    %rbx,%r12
+  8049d9:	e9 49 ff ff ff       	jmp    804927 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049e3:	48 83 c4 28          	add    $0x28,%rsp
+  8049e7:	5b                   	pop    %rbx
+  8049e8:	41 5c                	pop    %r12
+  8049ea:	41 5d                	pop    %r13
+  8049ec:	41 5e                	pop    %r14
+  8049ee:	41 5f                	pop    %r15
+  8049f0:	5d                   	pop    %rbp
+  8049f1:	c3                   	ret
+    return 0;
+  8049f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f7:	eb ea                	jmp    8049e3 <mmap_writeback+0x123>
+
+00000000008049f9 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8049f9:	55                   	push   %rbp
+  8049fa:	48 89 e5             	mov    %rsp,%rbp
+  8049fd:	41 57                	push   %r15
+  8049ff:	41 56                	push   %r14
+  804a01:	41 55                	push   %r13
+  804a03:	41 54                	push   %r12
+  804a05:	53                   	push   %rbx
+  804a06:	48 83 ec 38          	sub    $0x38,%rsp
+  804a0a:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a0e:	48 85 f6             	test   %rsi,%rsi
+  804a11:	0f 84 0c 02 00 00    	je     804c23 <mmap+0x22a>
+  804a17:	49 89 ff             	mov    %rdi,%r15
+  804a1a:	49 89 f4             	mov    %rsi,%r12
+  804a1d:	41 89 d5             	mov    %edx,%r13d
+  804a20:	41 89 ce             	mov    %ecx,%r14d
+  804a23:	44 89 cb             	mov    %r9d,%ebx
+  804a26:	45 85 c9             	test   %r9d,%r9d
+  804a29:	0f 88 f4 01 00 00    	js     804c23 <mmap+0x22a>
+  804a2f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a36:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a3d:	0f 85 e7 01 00 00    	jne    804c2a <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a43:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a46:	83 fa 04             	cmp    $0x4,%edx
+  804a49:	0f 85 db 01 00 00    	jne    804c2a <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a4f:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a52:	83 fa 01             	cmp    $0x1,%edx
+  804a55:	0f 87 cf 01 00 00    	ja     804c2a <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a5b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a5f:	44 89 c7             	mov    %r8d,%edi
+  804a62:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  804a69:	00 00 00 
+  804a6c:	ff d0                	call   *%rax
+  804a6e:	89 c2                	mov    %eax,%edx
+  804a70:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a77:	85 d2                	test   %edx,%edx
+  804a79:	0f 88 ab 01 00 00    	js     804c2a <mmap+0x231>
+  804a7f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a83:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a8a:	00 00 00 
+  804a8d:	8b 09                	mov    (%rcx),%ecx
+  804a8f:	39 0a                	cmp    %ecx,(%rdx)
+  804a91:	0f 85 93 01 00 00    	jne    804c2a <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804a97:	8b 52 08             	mov    0x8(%rdx),%edx
+  804a9a:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804a9d:	83 fa 01             	cmp    $0x1,%edx
+  804aa0:	0f 84 84 01 00 00    	je     804c2a <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804aa6:	41 83 fe 01          	cmp    $0x1,%r14d
+  804aaa:	74 42                	je     804aee <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804aac:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804ab3:	4c 89 e6             	mov    %r12,%rsi
+  804ab6:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804abd:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ac1:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ac5:	4d 85 ff             	test   %r15,%r15
+  804ac8:	74 67                	je     804b31 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804aca:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ad1:	75 0f                	jne    804ae2 <mmap+0xe9>
+  804ad3:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804ada:	00 00 00 
+  804add:	49 39 c7             	cmp    %rax,%r15
+  804ae0:	77 1b                	ja     804afd <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804ae2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ae9:	e9 3c 01 00 00       	jmp    804c2a <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804aee:	41 f6 c5 02          	test   $0x2,%r13b
+  804af2:	74 b8                	je     804aac <mmap+0xb3>
+  804af4:	85 d2                	test   %edx,%edx
+  804af6:	75 b4                	jne    804aac <mmap+0xb3>
+  804af8:	e9 2d 01 00 00       	jmp    804c2a <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804afd:	4c 89 ff             	mov    %r15,%rdi
+  804b00:	48 b8 67 46 80 00 00 	movabs $0x804667,%rax
+  804b07:	00 00 00 
+  804b0a:	ff d0                	call   *%rax
+  804b0c:	48 89 c2             	mov    %rax,%rdx
+  804b0f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b16:	49 39 d7             	cmp    %rdx,%r15
+  804b19:	0f 85 0b 01 00 00    	jne    804c2a <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b1f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b26:	00 00 00 
+  804b29:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b2f:	eb 44                	jmp    804b75 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b31:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b35:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b3c:	00 00 00 
+  804b3f:	48 b8 67 46 80 00 00 	movabs $0x804667,%rax
+  804b46:	00 00 00 
+  804b49:	ff d0                	call   *%rax
+  804b4b:	48 89 c7             	mov    %rax,%rdi
+  804b4e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b52:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b59:	48 85 ff             	test   %rdi,%rdi
+  804b5c:	75 c1                	jne    804b1f <mmap+0x126>
+  804b5e:	e9 c7 00 00 00       	jmp    804c2a <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b63:	49 83 c4 01          	add    $0x1,%r12
+  804b67:	48 83 c0 20          	add    $0x20,%rax
+  804b6b:	49 83 fc 20          	cmp    $0x20,%r12
+  804b6f:	0f 84 a5 00 00 00    	je     804c1a <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b75:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b79:	75 e8                	jne    804b63 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b7b:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b7f:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  804b86:	00 00 00 
+  804b89:	ff d0                	call   *%rax
+  804b8b:	89 c2                	mov    %eax,%edx
+  804b8d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b94:	85 d2                	test   %edx,%edx
+  804b96:	0f 88 8e 00 00 00    	js     804c2a <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804b9c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804ba0:	48 b8 85 2d 80 00 00 	movabs $0x802d85,%rax
+  804ba7:	00 00 00 
+  804baa:	ff d0                	call   *%rax
+  804bac:	89 c6                	mov    %eax,%esi
+  804bae:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bb1:	48 b8 d3 2f 80 00 00 	movabs $0x802fd3,%rax
+  804bb8:	00 00 00 
+  804bbb:	ff d0                	call   *%rax
+  804bbd:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bc0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bc7:	45 85 ff             	test   %r15d,%r15d
+  804bca:	78 5e                	js     804c2a <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bcc:	49 c1 e4 05          	shl    $0x5,%r12
+  804bd0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bd7:	00 00 00 
+  804bda:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bdd:	48 bf d8 46 80 00 00 	movabs $0x8046d8,%rdi
+  804be4:	00 00 00 
+  804be7:	48 b8 a6 51 80 00 00 	movabs $0x8051a6,%rax
+  804bee:	00 00 00 
+  804bf1:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804bf3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bf7:	49 89 04 24          	mov    %rax,(%r12)
+  804bfb:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804bff:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c04:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c09:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c0e:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c13:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c18:	eb 10                	jmp    804c2a <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c1a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c21:	eb 07                	jmp    804c2a <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c23:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c2a:	48 83 c4 38          	add    $0x38,%rsp
+  804c2e:	5b                   	pop    %rbx
+  804c2f:	41 5c                	pop    %r12
+  804c31:	41 5d                	pop    %r13
+  804c33:	41 5e                	pop    %r14
+  804c35:	41 5f                	pop    %r15
+  804c37:	5d                   	pop    %rbp
+  804c38:	c3                   	ret
+
+0000000000804c39 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c39:	55                   	push   %rbp
+  804c3a:	48 89 e5             	mov    %rsp,%rbp
+  804c3d:	41 57                	push   %r15
+  804c3f:	41 56                	push   %r14
+  804c41:	41 55                	push   %r13
+  804c43:	41 54                	push   %r12
+  804c45:	53                   	push   %rbx
+  804c46:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c4a:	49 89 fe             	mov    %rdi,%r14
+  804c4d:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c54:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c5b:	00 
+  804c5c:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c63:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c6a:	00 00 00 
+  804c6d:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c74:	49 bf c0 48 80 00 00 	movabs $0x8048c0,%r15
+  804c7b:	00 00 00 
+  804c7e:	eb 09                	jmp    804c89 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c80:	48 83 c3 20          	add    $0x20,%rbx
+  804c84:	4c 39 eb             	cmp    %r13,%rbx
+  804c87:	74 33                	je     804cbc <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c89:	48 89 df             	mov    %rbx,%rdi
+  804c8c:	48 8b 33             	mov    (%rbx),%rsi
+  804c8f:	4c 39 e6             	cmp    %r12,%rsi
+  804c92:	73 ec                	jae    804c80 <msync+0x47>
+  804c94:	48 85 f6             	test   %rsi,%rsi
+  804c97:	74 e7                	je     804c80 <msync+0x47>
+  804c99:	48 89 f2             	mov    %rsi,%rdx
+  804c9c:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804ca0:	49 39 d6             	cmp    %rdx,%r14
+  804ca3:	73 db                	jae    804c80 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ca5:	4c 39 e2             	cmp    %r12,%rdx
+  804ca8:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cac:	4c 39 f6             	cmp    %r14,%rsi
+  804caf:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cb3:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cb6:	85 c0                	test   %eax,%eax
+  804cb8:	79 c6                	jns    804c80 <msync+0x47>
+  804cba:	eb 05                	jmp    804cc1 <msync+0x88>
+    }
+
+    return 0;
+  804cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cc1:	48 83 c4 08          	add    $0x8,%rsp
+  804cc5:	5b                   	pop    %rbx
+  804cc6:	41 5c                	pop    %r12
+  804cc8:	41 5d                	pop    %r13
+  804cca:	41 5e                	pop    %r14
+  804ccc:	41 5f                	pop    %r15
+  804cce:	5d                   	pop    %rbp
+  804ccf:	c3                   	ret
+
+0000000000804cd0 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cd0:	55                   	push   %rbp
+  804cd1:	48 89 e5             	mov    %rsp,%rbp
+  804cd4:	41 57                	push   %r15
+  804cd6:	41 56                	push   %r14
+  804cd8:	41 55                	push   %r13
+  804cda:	41 54                	push   %r12
+  804cdc:	53                   	push   %rbx
+  804cdd:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804ce1:	49 89 ff             	mov    %rdi,%r15
+  804ce4:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804ceb:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804cf2:	00 
+  804cf3:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cfa:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d01:	00 00 00 
+  804d04:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d0b:	48 89 d8             	mov    %rbx,%rax
+  804d0e:	eb 09                	jmp    804d19 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d10:	48 83 c0 20          	add    $0x20,%rax
+  804d14:	4c 39 f0             	cmp    %r14,%rax
+  804d17:	74 40                	je     804d59 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d19:	48 8b 10             	mov    (%rax),%rdx
+  804d1c:	4c 39 e2             	cmp    %r12,%rdx
+  804d1f:	73 ef                	jae    804d10 <munmap+0x40>
+  804d21:	48 85 d2             	test   %rdx,%rdx
+  804d24:	74 ea                	je     804d10 <munmap+0x40>
+  804d26:	48 89 d7             	mov    %rdx,%rdi
+  804d29:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d2d:	49 39 ff             	cmp    %rdi,%r15
+  804d30:	73 de                	jae    804d10 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d32:	49 39 fc             	cmp    %rdi,%r12
+  804d35:	72 05                	jb     804d3c <munmap+0x6c>
+  804d37:	4c 39 fa             	cmp    %r15,%rdx
+  804d3a:	73 d4                	jae    804d10 <munmap+0x40>
+  804d3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d41:	48 83 c4 08          	add    $0x8,%rsp
+  804d45:	5b                   	pop    %rbx
+  804d46:	41 5c                	pop    %r12
+  804d48:	41 5d                	pop    %r13
+  804d4a:	41 5e                	pop    %r14
+  804d4c:	41 5f                	pop    %r15
+  804d4e:	5d                   	pop    %rbp
+  804d4f:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d50:	48 83 c3 20          	add    $0x20,%rbx
+  804d54:	4c 39 f3             	cmp    %r14,%rbx
+  804d57:	74 5c                	je     804db5 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d59:	48 8b 33             	mov    (%rbx),%rsi
+  804d5c:	4c 39 e6             	cmp    %r12,%rsi
+  804d5f:	73 ef                	jae    804d50 <munmap+0x80>
+  804d61:	48 85 f6             	test   %rsi,%rsi
+  804d64:	74 ea                	je     804d50 <munmap+0x80>
+  804d66:	48 89 f2             	mov    %rsi,%rdx
+  804d69:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d6d:	49 39 d7             	cmp    %rdx,%r15
+  804d70:	73 de                	jae    804d50 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d72:	48 89 df             	mov    %rbx,%rdi
+  804d75:	48 b8 c0 48 80 00 00 	movabs $0x8048c0,%rax
+  804d7c:	00 00 00 
+  804d7f:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d81:	85 c0                	test   %eax,%eax
+  804d83:	78 bc                	js     804d41 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d85:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d89:	48 8b 33             	mov    (%rbx),%rsi
+  804d8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d91:	48 b8 ff 27 80 00 00 	movabs $0x8027ff,%rax
+  804d98:	00 00 00 
+  804d9b:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804d9d:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804da0:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804da7:	00 00 00 
+  804daa:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dac:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804db3:	eb 9b                	jmp    804d50 <munmap+0x80>
+    return 0;
+  804db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dba:	eb 85                	jmp    804d41 <munmap+0x71>
+
+0000000000804dbc <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dc1:	c3                   	ret
+
+0000000000804dc2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dc2:	55                   	push   %rbp
+  804dc3:	48 89 e5             	mov    %rsp,%rbp
+  804dc6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dc9:	48 be c5 62 80 00 00 	movabs $0x8062c5,%rsi
+  804dd0:	00 00 00 
+  804dd3:	48 b8 c2 1f 80 00 00 	movabs $0x801fc2,%rax
+  804dda:	00 00 00 
+  804ddd:	ff d0                	call   *%rax
+    return 0;
+}
+  804ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de4:	5d                   	pop    %rbp
+  804de5:	c3                   	ret
+
+0000000000804de6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804de6:	55                   	push   %rbp
+  804de7:	48 89 e5             	mov    %rsp,%rbp
+  804dea:	41 57                	push   %r15
+  804dec:	41 56                	push   %r14
+  804dee:	41 55                	push   %r13
+  804df0:	41 54                	push   %r12
+  804df2:	53                   	push   %rbx
+  804df3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804dfa:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e01:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e08:	00 00 00 00 
+  804e0c:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e13:	00 00 00 00 
+  804e17:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e1e:	00 00 00 00 
+  804e22:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e29:	00 00 00 00 
+  804e2d:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e34:	00 00 00 00 
+  804e38:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e3f:	00 00 00 00 
+  804e43:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e4a:	00 
+  804e4b:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e52:	00 
+  804e53:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e5a:	00 
+  804e5b:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e62:	00 
+  804e63:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e6a:	00 
+  804e6b:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e72:	00 
+  804e73:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e7a:	00 
+  804e7b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e82:	00 
+  804e83:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e8a:	00 
+  804e8b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804e92:	00 
+    for (res = 0; res < n; res += inc) {
+  804e93:	48 85 d2             	test   %rdx,%rdx
+  804e96:	74 7a                	je     804f12 <devcons_write+0x12c>
+  804e98:	49 89 d6             	mov    %rdx,%r14
+  804e9b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ea1:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ea6:	49 bf 12 23 80 00 00 	movabs $0x802312,%r15
+  804ead:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804eb0:	4c 89 f3             	mov    %r14,%rbx
+  804eb3:	48 29 f3             	sub    %rsi,%rbx
+  804eb6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ebb:	48 39 c3             	cmp    %rax,%rbx
+  804ebe:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ec2:	4c 63 eb             	movslq %ebx,%r13
+  804ec5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ecc:	48 01 c6             	add    %rax,%rsi
+  804ecf:	4c 89 ea             	mov    %r13,%rdx
+  804ed2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ed9:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804edc:	4c 89 ee             	mov    %r13,%rsi
+  804edf:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ee6:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  804eed:	00 00 00 
+  804ef0:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804ef2:	41 01 dc             	add    %ebx,%r12d
+  804ef5:	49 63 f4             	movslq %r12d,%rsi
+  804ef8:	4c 39 f6             	cmp    %r14,%rsi
+  804efb:	72 b3                	jb     804eb0 <devcons_write+0xca>
+    return res;
+  804efd:	49 63 c4             	movslq %r12d,%rax
+}
+  804f00:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f07:	5b                   	pop    %rbx
+  804f08:	41 5c                	pop    %r12
+  804f0a:	41 5d                	pop    %r13
+  804f0c:	41 5e                	pop    %r14
+  804f0e:	41 5f                	pop    %r15
+  804f10:	5d                   	pop    %rbp
+  804f11:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f12:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f18:	eb e3                	jmp    804efd <devcons_write+0x117>
+
+0000000000804f1a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f1a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f22:	48 85 c0             	test   %rax,%rax
+  804f25:	74 55                	je     804f7c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f27:	55                   	push   %rbp
+  804f28:	48 89 e5             	mov    %rsp,%rbp
+  804f2b:	41 55                	push   %r13
+  804f2d:	41 54                	push   %r12
+  804f2f:	53                   	push   %rbx
+  804f30:	48 83 ec 08          	sub    $0x8,%rsp
+  804f34:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f37:	48 bb 72 25 80 00 00 	movabs $0x802572,%rbx
+  804f3e:	00 00 00 
+  804f41:	49 bc 86 26 80 00 00 	movabs $0x802686,%r12
+  804f48:	00 00 00 
+  804f4b:	eb 03                	jmp    804f50 <devcons_read+0x36>
+  804f4d:	41 ff d4             	call   *%r12
+  804f50:	ff d3                	call   *%rbx
+  804f52:	85 c0                	test   %eax,%eax
+  804f54:	74 f7                	je     804f4d <devcons_read+0x33>
+    if (c < 0) return c;
+  804f56:	48 63 d0             	movslq %eax,%rdx
+  804f59:	78 13                	js     804f6e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f60:	83 f8 04             	cmp    $0x4,%eax
+  804f63:	74 09                	je     804f6e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f65:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f69:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f6e:	48 89 d0             	mov    %rdx,%rax
+  804f71:	48 83 c4 08          	add    $0x8,%rsp
+  804f75:	5b                   	pop    %rbx
+  804f76:	41 5c                	pop    %r12
+  804f78:	41 5d                	pop    %r13
+  804f7a:	5d                   	pop    %rbp
+  804f7b:	c3                   	ret
+  804f7c:	48 89 d0             	mov    %rdx,%rax
+  804f7f:	c3                   	ret
+
+0000000000804f80 <cputchar>:
+cputchar(int ch) {
+  804f80:	55                   	push   %rbp
+  804f81:	48 89 e5             	mov    %rsp,%rbp
+  804f84:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f88:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f8c:	be 01 00 00 00       	mov    $0x1,%esi
+  804f91:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804f95:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  804f9c:	00 00 00 
+  804f9f:	ff d0                	call   *%rax
+}
+  804fa1:	c9                   	leave
+  804fa2:	c3                   	ret
+
+0000000000804fa3 <getchar>:
+getchar(void) {
+  804fa3:	55                   	push   %rbp
+  804fa4:	48 89 e5             	mov    %rsp,%rbp
+  804fa7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fab:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fb0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fb9:	48 b8 f6 30 80 00 00 	movabs $0x8030f6,%rax
+  804fc0:	00 00 00 
+  804fc3:	ff d0                	call   *%rax
+  804fc5:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fc7:	85 c0                	test   %eax,%eax
+  804fc9:	78 06                	js     804fd1 <getchar+0x2e>
+  804fcb:	74 08                	je     804fd5 <getchar+0x32>
+  804fcd:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fd1:	89 d0                	mov    %edx,%eax
+  804fd3:	c9                   	leave
+  804fd4:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fd5:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fda:	eb f5                	jmp    804fd1 <getchar+0x2e>
+
+0000000000804fdc <iscons>:
+iscons(int fdnum) {
+  804fdc:	55                   	push   %rbp
+  804fdd:	48 89 e5             	mov    %rsp,%rbp
+  804fe0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804fe4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fe8:	48 b8 13 2e 80 00 00 	movabs $0x802e13,%rax
+  804fef:	00 00 00 
+  804ff2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804ff4:	85 c0                	test   %eax,%eax
+  804ff6:	78 18                	js     805010 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804ff8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ffc:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805003:	00 00 00 
+  805006:	8b 00                	mov    (%rax),%eax
+  805008:	39 02                	cmp    %eax,(%rdx)
+  80500a:	0f 94 c0             	sete   %al
+  80500d:	0f b6 c0             	movzbl %al,%eax
+}
+  805010:	c9                   	leave
+  805011:	c3                   	ret
+
+0000000000805012 <opencons>:
+opencons(void) {
+  805012:	55                   	push   %rbp
+  805013:	48 89 e5             	mov    %rsp,%rbp
+  805016:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80501a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80501e:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  805025:	00 00 00 
+  805028:	ff d0                	call   *%rax
+  80502a:	85 c0                	test   %eax,%eax
+  80502c:	78 49                	js     805077 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80502e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805033:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805038:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80503c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805041:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  805048:	00 00 00 
+  80504b:	ff d0                	call   *%rax
+  80504d:	85 c0                	test   %eax,%eax
+  80504f:	78 26                	js     805077 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805051:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805055:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80505c:	00 00 
+  80505e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805060:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805064:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80506b:	48 b8 85 2d 80 00 00 	movabs $0x802d85,%rax
+  805072:	00 00 00 
+  805075:	ff d0                	call   *%rax
+}
+  805077:	c9                   	leave
+  805078:	c3                   	ret
+
+0000000000805079 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805079:	55                   	push   %rbp
+  80507a:	48 89 e5             	mov    %rsp,%rbp
+  80507d:	41 56                	push   %r14
+  80507f:	41 55                	push   %r13
+  805081:	41 54                	push   %r12
+  805083:	53                   	push   %rbx
+  805084:	48 83 ec 50          	sub    $0x50,%rsp
+  805088:	49 89 fc             	mov    %rdi,%r12
+  80508b:	41 89 f5             	mov    %esi,%r13d
+  80508e:	48 89 d3             	mov    %rdx,%rbx
+  805091:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805095:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  805099:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80509d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050a8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050ac:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050b0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050b4:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050bb:	00 00 00 
+  8050be:	4c 8b 30             	mov    (%rax),%r14
+  8050c1:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  8050c8:	00 00 00 
+  8050cb:	ff d0                	call   *%rax
+  8050cd:	89 c6                	mov    %eax,%esi
+  8050cf:	45 89 e8             	mov    %r13d,%r8d
+  8050d2:	4c 89 e1             	mov    %r12,%rcx
+  8050d5:	4c 89 f2             	mov    %r14,%rdx
+  8050d8:	48 bf d8 62 80 00 00 	movabs $0x8062d8,%rdi
+  8050df:	00 00 00 
+  8050e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050e7:	49 bc 8b 16 80 00 00 	movabs $0x80168b,%r12
+  8050ee:	00 00 00 
+  8050f1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8050f4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8050f8:	48 89 df             	mov    %rbx,%rdi
+  8050fb:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  805102:	00 00 00 
+  805105:	ff d0                	call   *%rax
+    cprintf("\n");
+  805107:	48 bf b3 61 80 00 00 	movabs $0x8061b3,%rdi
+  80510e:	00 00 00 
+  805111:	b8 00 00 00 00       	mov    $0x0,%eax
+  805116:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805119:	cc                   	int3
+  80511a:	eb fd                	jmp    805119 <_panic+0xa0>
+
+000000000080511c <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80511c:	55                   	push   %rbp
+  80511d:	48 89 e5             	mov    %rsp,%rbp
+  805120:	41 56                	push   %r14
+  805122:	41 55                	push   %r13
+  805124:	41 54                	push   %r12
+  805126:	53                   	push   %rbx
+  805127:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80512a:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805131:	00 00 00 
+  805134:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805138:	74 27                	je     805161 <_handle_vectored_pagefault+0x45>
+  80513a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80513f:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805146:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805149:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80514c:	4c 89 e7             	mov    %r12,%rdi
+  80514f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805154:	84 c0                	test   %al,%al
+  805156:	75 45                	jne    80519d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805158:	48 83 c3 01          	add    $0x1,%rbx
+  80515c:	49 3b 1e             	cmp    (%r14),%rbx
+  80515f:	72 eb                	jb     80514c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805161:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805168:	00 
+  805169:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80516e:	4d 8b 04 24          	mov    (%r12),%r8
+  805172:	48 ba 00 63 80 00 00 	movabs $0x806300,%rdx
+  805179:	00 00 00 
+  80517c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805181:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  805188:	00 00 00 
+  80518b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805190:	49 ba 79 50 80 00 00 	movabs $0x805079,%r10
+  805197:	00 00 00 
+  80519a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80519d:	5b                   	pop    %rbx
+  80519e:	41 5c                	pop    %r12
+  8051a0:	41 5d                	pop    %r13
+  8051a2:	41 5e                	pop    %r14
+  8051a4:	5d                   	pop    %rbp
+  8051a5:	c3                   	ret
+
+00000000008051a6 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051a6:	55                   	push   %rbp
+  8051a7:	48 89 e5             	mov    %rsp,%rbp
+  8051aa:	53                   	push   %rbx
+  8051ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8051af:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051b2:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051b7:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051be:	00 00 00 
+  8051c1:	80 38 00             	cmpb   $0x0,(%rax)
+  8051c4:	74 68                	je     80522e <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051c6:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051cd:	00 00 00 
+  8051d0:	48 8b 08             	mov    (%rax),%rcx
+  8051d3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051d8:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051df:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051e2:	48 85 c9             	test   %rcx,%rcx
+  8051e5:	0f 84 e0 00 00 00    	je     8052cb <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051eb:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8051ef:	0f 84 c9 00 00 00    	je     8052be <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f5:	48 83 c2 01          	add    $0x1,%rdx
+  8051f9:	48 39 ca             	cmp    %rcx,%rdx
+  8051fc:	75 ed                	jne    8051eb <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8051fe:	48 83 f9 08          	cmp    $0x8,%rcx
+  805202:	0f 84 84 00 00 00    	je     80528c <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805208:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80520c:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805213:	00 00 00 
+  805216:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80521d:	00 00 00 
+  805220:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805224:	85 f6                	test   %esi,%esi
+  805226:	0f 89 97 00 00 00    	jns    8052c3 <add_pgfault_handler+0x11d>
+  80522c:	eb 63                	jmp    805291 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80522e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805233:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805238:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80523f:	00 00 00 
+  805242:	bf 00 00 00 00       	mov    $0x0,%edi
+  805247:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  80524e:	00 00 00 
+  805251:	ff d0                	call   *%rax
+  805253:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805255:	85 c0                	test   %eax,%eax
+  805257:	78 38                	js     805291 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805259:	48 be a7 53 80 00 00 	movabs $0x8053a7,%rsi
+  805260:	00 00 00 
+  805263:	bf 00 00 00 00       	mov    $0x0,%edi
+  805268:	48 b8 4a 29 80 00 00 	movabs $0x80294a,%rax
+  80526f:	00 00 00 
+  805272:	ff d0                	call   *%rax
+  805274:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805276:	85 c0                	test   %eax,%eax
+  805278:	78 17                	js     805291 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80527a:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805281:	00 00 00 
+  805284:	c6 00 01             	movb   $0x1,(%rax)
+  805287:	e9 3a ff ff ff       	jmp    8051c6 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80528c:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805291:	89 f1                	mov    %esi,%ecx
+  805293:	48 ba 3e 63 80 00 00 	movabs $0x80633e,%rdx
+  80529a:	00 00 00 
+  80529d:	be 42 00 00 00       	mov    $0x42,%esi
+  8052a2:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  8052a9:	00 00 00 
+  8052ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b1:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  8052b8:	00 00 00 
+  8052bb:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052be:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052c3:	89 f0                	mov    %esi,%eax
+  8052c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052c9:	c9                   	leave
+  8052ca:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052cb:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052d2:	00 00 00 
+  8052d5:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052dc:	48 89 d8             	mov    %rbx,%rax
+  8052df:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052e6:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052e9:	eb d8                	jmp    8052c3 <add_pgfault_handler+0x11d>
+
+00000000008052eb <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052eb:	55                   	push   %rbp
+  8052ec:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8052ef:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052f6:	00 00 00 
+  8052f9:	80 38 00             	cmpb   $0x0,(%rax)
+  8052fc:	74 33                	je     805331 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8052fe:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805305:	00 00 00 
+  805308:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80530d:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805314:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805317:	48 85 c0             	test   %rax,%rax
+  80531a:	0f 84 85 00 00 00    	je     8053a5 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805320:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805324:	74 40                	je     805366 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805326:	48 83 c1 01          	add    $0x1,%rcx
+  80532a:	48 39 c1             	cmp    %rax,%rcx
+  80532d:	75 f1                	jne    805320 <remove_pgfault_handler+0x35>
+  80532f:	eb 74                	jmp    8053a5 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805331:	48 b9 56 63 80 00 00 	movabs $0x806356,%rcx
+  805338:	00 00 00 
+  80533b:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  805342:	00 00 00 
+  805345:	be 48 00 00 00       	mov    $0x48,%esi
+  80534a:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  805351:	00 00 00 
+  805354:	b8 00 00 00 00       	mov    $0x0,%eax
+  805359:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  805360:	00 00 00 
+  805363:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805366:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80536d:	00 
+  80536e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805372:	48 29 ca             	sub    %rcx,%rdx
+  805375:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80537c:	00 00 00 
+  80537f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805383:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805388:	48 89 ce             	mov    %rcx,%rsi
+  80538b:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  805392:	00 00 00 
+  805395:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805397:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80539e:	00 00 00 
+  8053a1:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053a5:	5d                   	pop    %rbp
+  8053a6:	c3                   	ret
+
+00000000008053a7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053a7:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053aa:	48 b8 1c 51 80 00 00 	movabs $0x80511c,%rax
+  8053b1:	00 00 00 
+    call *%rax
+  8053b4:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053b6:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053bd:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053be:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053c5:	00 
+    subq $8, %rcx
+  8053c6:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053ca:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053cd:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053d4:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053d5:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053d9:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053dd:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053e2:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053e7:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053ec:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8053f1:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8053f6:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8053fb:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805400:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805405:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80540a:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80540f:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805414:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805419:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80541e:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805423:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805427:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80542b:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80542c:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80542d:	c3                   	ret
+
+000000000080542e <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80542e:	85 ff                	test   %edi,%edi
+  805430:	78 58                	js     80548a <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805432:	48 85 f6             	test   %rsi,%rsi
+  805435:	74 12                	je     805449 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805437:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80543e:	00 00 00 
+  805441:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805447:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805449:	48 85 c9             	test   %rcx,%rcx
+  80544c:	74 12                	je     805460 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80544e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805455:	00 00 00 
+  805458:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80545e:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805460:	48 85 d2             	test   %rdx,%rdx
+  805463:	74 14                	je     805479 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805465:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80546c:	00 00 00 
+  80546f:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805476:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805479:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805480:	00 00 00 
+  805483:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805489:	c3                   	ret
+        if (from_env_store) {
+  80548a:	48 85 f6             	test   %rsi,%rsi
+  80548d:	74 06                	je     805495 <ipc_result+0x67>
+            *from_env_store = 0;
+  80548f:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805495:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805497:	48 85 c9             	test   %rcx,%rcx
+  80549a:	74 ed                	je     805489 <ipc_result+0x5b>
+            *perm_store = 0;
+  80549c:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054a2:	c3                   	ret
+
+00000000008054a3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054a3:	55                   	push   %rbp
+  8054a4:	48 89 e5             	mov    %rsp,%rbp
+  8054a7:	41 55                	push   %r13
+  8054a9:	41 54                	push   %r12
+  8054ab:	53                   	push   %rbx
+  8054ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8054b0:	49 89 fc             	mov    %rdi,%r12
+  8054b3:	48 89 f7             	mov    %rsi,%rdi
+  8054b6:	48 89 d3             	mov    %rdx,%rbx
+  8054b9:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054bc:	48 85 f6             	test   %rsi,%rsi
+  8054bf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054c6:	00 00 00 
+  8054c9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8054d2:	48 85 d2             	test   %rdx,%rdx
+  8054d5:	74 03                	je     8054da <ipc_recv+0x37>
+  8054d7:	48 8b 32             	mov    (%rdx),%rsi
+  8054da:	48 b8 73 2c 80 00 00 	movabs $0x802c73,%rax
+  8054e1:	00 00 00 
+  8054e4:	ff d0                	call   *%rax
+  8054e6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054e8:	4c 89 e9             	mov    %r13,%rcx
+  8054eb:	48 89 da             	mov    %rbx,%rdx
+  8054ee:	4c 89 e6             	mov    %r12,%rsi
+  8054f1:	48 b8 2e 54 80 00 00 	movabs $0x80542e,%rax
+  8054f8:	00 00 00 
+  8054fb:	ff d0                	call   *%rax
+}
+  8054fd:	48 83 c4 08          	add    $0x8,%rsp
+  805501:	5b                   	pop    %rbx
+  805502:	41 5c                	pop    %r12
+  805504:	41 5d                	pop    %r13
+  805506:	5d                   	pop    %rbp
+  805507:	c3                   	ret
+
+0000000000805508 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805508:	55                   	push   %rbp
+  805509:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80550c:	48 85 d2             	test   %rdx,%rdx
+  80550f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805516:	00 00 00 
+  805519:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80551d:	89 f6                	mov    %esi,%esi
+  80551f:	48 b8 ff 2a 80 00 00 	movabs $0x802aff,%rax
+  805526:	00 00 00 
+  805529:	ff d0                	call   *%rax
+    if (res < 0) {
+  80552b:	85 c0                	test   %eax,%eax
+  80552d:	78 02                	js     805531 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80552f:	5d                   	pop    %rbp
+  805530:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805531:	89 c1                	mov    %eax,%ecx
+  805533:	48 ba 70 63 80 00 00 	movabs $0x806370,%rdx
+  80553a:	00 00 00 
+  80553d:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805542:	48 bf 7d 63 80 00 00 	movabs $0x80637d,%rdi
+  805549:	00 00 00 
+  80554c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805551:	49 b8 79 50 80 00 00 	movabs $0x805079,%r8
+  805558:	00 00 00 
+  80555b:	41 ff d0             	call   *%r8
+
+000000000080555e <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80555e:	55                   	push   %rbp
+  80555f:	48 89 e5             	mov    %rsp,%rbp
+  805562:	53                   	push   %rbx
+  805563:	48 83 ec 08          	sub    $0x8,%rsp
+  805567:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80556b:	48 85 d2             	test   %rdx,%rdx
+  80556e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805575:	00 00 00 
+  805578:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80557c:	4d 85 c9             	test   %r9,%r9
+  80557f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805583:	b8 00 00 00 00       	mov    $0x0,%eax
+  805588:	48 85 db             	test   %rbx,%rbx
+  80558b:	74 03                	je     805590 <ipc_call+0x32>
+  80558d:	48 8b 03             	mov    (%rbx),%rax
+  805590:	89 f6                	mov    %esi,%esi
+  805592:	48 83 ec 08          	sub    $0x8,%rsp
+  805596:	50                   	push   %rax
+  805597:	48 b8 31 2b 80 00 00 	movabs $0x802b31,%rax
+  80559e:	00 00 00 
+  8055a1:	ff d0                	call   *%rax
+  8055a3:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055a5:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055a9:	48 89 da             	mov    %rbx,%rdx
+  8055ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8055b1:	48 b8 2e 54 80 00 00 	movabs $0x80542e,%rax
+  8055b8:	00 00 00 
+  8055bb:	ff d0                	call   *%rax
+}
+  8055bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055c1:	c9                   	leave
+  8055c2:	c3                   	ret
+
+00000000008055c3 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055c3:	55                   	push   %rbp
+  8055c4:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055c7:	89 f6                	mov    %esi,%esi
+  8055c9:	48 b8 9d 2b 80 00 00 	movabs $0x802b9d,%rax
+  8055d0:	00 00 00 
+  8055d3:	ff d0                	call   *%rax
+  8055d5:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8055e6:	48 b8 2e 54 80 00 00 	movabs $0x80542e,%rax
+  8055ed:	00 00 00 
+  8055f0:	ff d0                	call   *%rax
+}
+  8055f2:	5d                   	pop    %rbp
+  8055f3:	c3                   	ret
+
+00000000008055f4 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8055f4:	55                   	push   %rbp
+  8055f5:	48 89 e5             	mov    %rsp,%rbp
+  8055f8:	41 54                	push   %r12
+  8055fa:	53                   	push   %rbx
+  8055fb:	4c 89 cb             	mov    %r9,%rbx
+  8055fe:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805602:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805606:	48 85 d2             	test   %rdx,%rdx
+  805609:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805610:	00 00 00 
+  805613:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805617:	4d 85 c9             	test   %r9,%r9
+  80561a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80561e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805623:	4d 85 e4             	test   %r12,%r12
+  805626:	74 04                	je     80562c <ipc_reply_wait+0x38>
+  805628:	49 8b 04 24          	mov    (%r12),%rax
+  80562c:	89 f6                	mov    %esi,%esi
+  80562e:	48 83 ec 08          	sub    $0x8,%rsp
+  805632:	50                   	push   %rax
+  805633:	48 b8 07 2c 80 00 00 	movabs $0x802c07,%rax
+  80563a:	00 00 00 
+  80563d:	ff d0                	call   *%rax
+  80563f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805641:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805645:	4c 89 e2             	mov    %r12,%rdx
+  805648:	48 89 de             	mov    %rbx,%rsi
+  80564b:	48 b8 2e 54 80 00 00 	movabs $0x80542e,%rax
+  805652:	00 00 00 
+  805655:	ff d0                	call   *%rax
+}
+  805657:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80565b:	5b                   	pop    %rbx
+  80565c:	41 5c                	pop    %r12
+  80565e:	5d                   	pop    %rbp
+  80565f:	c3                   	ret
+
+0000000000805660 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805660:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805665:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80566c:	00 00 00 
+  80566f:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805676:	48 01 ca             	add    %rcx,%rdx
+  805679:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80567f:	39 fa                	cmp    %edi,%edx
+  805681:	74 12                	je     805695 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805683:	48 83 c0 01          	add    $0x1,%rax
+  805687:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80568d:	75 e0                	jne    80566f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80568f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805694:	c3                   	ret
+            return envs[i].env_id;
+  805695:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80569c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056a3:	00 00 00 
+  8056a6:	48 01 d0             	add    %rdx,%rax
+  8056a9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056af:	c3                   	ret
+
+00000000008056b0 <__rodata_start>:
+  8056b0:	77 00                	ja     8056b2 <__rodata_start+0x2>
+  8056b2:	72 62                	jb     805716 <__rodata_start+0x66>
+  8056b4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056b7:	00 0f                	add    %cl,(%rdi)
+  8056b9:	1f                   	(bad)
+  8056ba:	84 00                	test   %al,(%rax)
+  8056bc:	00 00                	add    %al,(%rax)
+  8056be:	00 00                	add    %al,(%rax)
+  8056c0:	b3 09                	mov    $0x9,%bl
+  8056c2:	80 00 00             	addb   $0x0,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 ed                	add    %ch,%ch
+  8056c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ce:	00 00                	add    %al,(%rax)
+  8056d0:	ed                   	in     (%dx),%eax
+  8056d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056d6:	00 00                	add    %al,(%rax)
+  8056d8:	ed                   	in     (%dx),%eax
+  8056d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	ed                   	in     (%dx),%eax
+  8056e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056e6:	00 00                	add    %al,(%rax)
+  8056e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 ed                	add    %ch,%ch
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	ed                   	in     (%dx),%eax
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	8c 0a                	mov    %cs,(%rdx)
+  80571a:	80 00 00             	addb   $0x0,(%rax)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805726:	00 00                	add    %al,(%rax)
+  805728:	8c 0a                	mov    %cs,(%rdx)
+  80572a:	80 00 00             	addb   $0x0,(%rax)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	ed                   	in     (%dx),%eax
+  805769:	0d 80 00 00 00       	or     $0x80,%eax
+  80576e:	00 00                	add    %al,(%rax)
+  805770:	ed                   	in     (%dx),%eax
+  805771:	0d 80 00 00 00       	or     $0x80,%eax
+  805776:	00 00                	add    %al,(%rax)
+  805778:	ed                   	in     (%dx),%eax
+  805779:	0d 80 00 00 00       	or     $0x80,%eax
+  80577e:	00 00                	add    %al,(%rax)
+  805780:	ed                   	in     (%dx),%eax
+  805781:	0d 80 00 00 00       	or     $0x80,%eax
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	f4                   	hlt
+  805859:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80585f:	00 ed                	add    %ch,%ch
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	2c 0b                	sub    $0xb,%al
+  805872:	80 00 00             	addb   $0x0,(%rax)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 ed                	add    %ch,%ch
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058b3:	00 00                	add    %al,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 cb                	add    %cl,%bl
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	6a 0a                	push   $0xa
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 ed                	add    %ch,%ch
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	3c 0a                	cmp    $0xa,%al
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 ed                	add    %ch,%ch
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80590b:	00 00                	add    %al,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 29                	add    %ch,(%rcx)
+  805919:	0c 80                	or     $0x80,%al
+  80591b:	00 00                	add    %al,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805922:	80 00 00             	addb   $0x0,(%rax)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	1a 0b                	sbb    (%rbx),%cl
+  805932:	80 00 00             	addb   $0x0,(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 ed                	add    %ch,%ch
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ce                   	(bad)
+  805941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	f4                   	hlt
+  805959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80595f:	00 37                	add    %dh,(%rdi)
+  805961:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805967:	00 5f 12             	add    %bl,0x12(%rdi)
+  80596a:	80 00 00             	addb   $0x0,(%rax)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 37                	add    %dh,(%rdi)
+  805971:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805977:	00 5f 12             	add    %bl,0x12(%rdi)
+  80597a:	80 00 00             	addb   $0x0,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80598b:	00 00                	add    %al,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 d2                	add    %dl,%dl
+  805991:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805997:	00 d2                	add    %dl,%dl
+  805999:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80599f:	00 d2                	add    %dl,%dl
+  8059a1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059a7:	00 d2                	add    %dl,%dl
+  8059a9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 f6                	add    %dh,%dh
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 f6                	add    %dh,%dh
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 22                	add    %ah,(%rdx)
+  805a11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a17:	00 22                	add    %ah,(%rdx)
+  805a19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a1f:	00 22                	add    %ah,(%rdx)
+  805a21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a27:	00 22                	add    %ah,(%rdx)
+  805a29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 46 12             	add    %al,0x12(%rsi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 22                	add    %ah,(%rdx)
+  805b21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b27:	00 22                	add    %ah,(%rdx)
+  805b29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 46 12             	add    %al,0x12(%rsi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805be0 <basefix.0>:
+  805be0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805bf0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c00:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c10:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c20:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c30:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c40:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c50:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c60:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c70:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805c80:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805c90:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805ca0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cb0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805cc0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cd0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805ce0:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805cf0:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d00:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d10:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d20:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d30:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d40:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d50:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d60:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d70:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805d80:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805d90:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805da0:	83 18 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805db0:	ca 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805dc0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805dd0:	da 1e 80 00 00 00 00 00 a2 18 80 00 00 00 00 00     ................
+  805de0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805df0:	96 18 80 00 00 00 00 00 10 19 80 00 00 00 00 00     ................
+  805e00:	da 1e 80 00 00 00 00 00 96 18 80 00 00 00 00 00     ................
+  805e10:	dc 18 80 00 00 00 00 00 dc 18 80 00 00 00 00 00     ................
+  805e20:	dc 18 80 00 00 00 00 00 dc 18 80 00 00 00 00 00     ................
+  805e30:	dc 18 80 00 00 00 00 00 dc 18 80 00 00 00 00 00     ................
+  805e40:	dc 18 80 00 00 00 00 00 dc 18 80 00 00 00 00 00     ................
+  805e50:	dc 18 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805e60:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805e70:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805e80:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805e90:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805ea0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805eb0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805ec0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805ed0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805ee0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805ef0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f00:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f10:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f20:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f30:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f40:	da 1e 80 00 00 00 00 00 f8 1d 80 00 00 00 00 00     ................
+  805f50:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f60:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f70:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f80:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805f90:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805fa0:	3e 19 80 00 00 00 00 00 0d 1b 80 00 00 00 00 00     >...............
+  805fb0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  805fc0:	da 1e 80 00 00 00 00 00 33 19 80 00 00 00 00 00     ........3.......
+  805fd0:	6d 19 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     m...............
+  805fe0:	da 1e 80 00 00 00 00 00 28 19 80 00 00 00 00 00     ........(.......
+  805ff0:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  806000:	b6 1c 80 00 00 00 00 00 85 1d 80 00 00 00 00 00     ................
+  806010:	da 1e 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  806020:	04 1a 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  806030:	e1 1b 80 00 00 00 00 00 da 1e 80 00 00 00 00 00     ................
+  806040:	da 1e 80 00 00 00 00 00 f8 1d 80 00 00 00 00 00     ................
+  806050:	da 1e 80 00 00 00 00 00 8c 18 80 00 00 00 00 00     ................
+
+0000000000806060 <error_string>:
+	...
+  806068:	3e 5c 80 00 00 00 00 00 50 5c 80 00 00 00 00 00     >\......P\......
+  806078:	60 5c 80 00 00 00 00 00 72 5c 80 00 00 00 00 00     `\......r\......
+  806088:	80 5c 80 00 00 00 00 00 94 5c 80 00 00 00 00 00     .\.......\......
+  806098:	a9 5c 80 00 00 00 00 00 bc 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	ce 5c 80 00 00 00 00 00 e2 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	f2 5c 80 00 00 00 00 00 05 5d 80 00 00 00 00 00     .\.......]......
+  8060c8:	1c 5d 80 00 00 00 00 00 32 5d 80 00 00 00 00 00     .]......2]......
+  8060d8:	4a 5d 80 00 00 00 00 00 62 5d 80 00 00 00 00 00     J]......b]......
+  8060e8:	6f 5d 80 00 00 00 00 00 00 61 80 00 00 00 00 00     o].......a......
+  8060f8:	83 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806108:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806118:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806128:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806138:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806148:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806158:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806168:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806178:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806188:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806198:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008061e0 <devtab>:
+  8061e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8061f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806200:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806210:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806220:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806230:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806240:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806250:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806260:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806270:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806280:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806290:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062b0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062c0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062d0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8062e0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8062f0:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806300:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806310:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806320:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806330:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806340:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806350:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806360:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806370:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806380:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806390:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8063e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
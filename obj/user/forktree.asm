@@ -0,0 +1,10523 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 50 23 80 00 00 	movabs $0x802350,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 70 20 80 00 00 	movabs $0x802070,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 d1 21 80 00 00 	movabs $0x8021d1,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 c3 34 80 00 00 	movabs $0x8034c3,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 70 20 80 00 00 	movabs $0x802070,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 c3 34 80 00 00 	movabs $0x8034c3,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 13 17 80 00 00 	movabs $0x801713,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 99 3e 80 00 00 	movabs $0x803e99,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 99 3e 80 00 00 	movabs $0x803e99,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 26 5f 80 00 00 	movabs $0x805f26,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 50 59 80 00 00 	movabs $0x805950,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 52 59 80 00 00 	movabs $0x805952,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 55 59 80 00 00 	movabs $0x805955,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 97 4c 80 00 00 	movabs $0x804c97,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 6e 4f 80 00 00 	movabs $0x804f6e,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 ad 35 80 00 00 	movabs $0x8035ad,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 7c 35 80 00 00 	movabs $0x80357c,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 7c 35 80 00 00 	movabs $0x80357c,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 94 33 80 00 00 	movabs $0x803394,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 c3 34 80 00 00 	movabs $0x8034c3,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 70 20 80 00 00 	movabs $0x802070,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 1d 23 80 00 00 	movabs $0x80231d,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 60 59 80 00 00 	movabs $0x805960,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 1d 23 80 00 00 	movabs $0x80231d,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 50 23 80 00 00 	movabs $0x802350,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 1d 23 80 00 00 	movabs $0x80231d,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 00 5c 80 00 00 	movabs $0x805c00,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 1d 23 80 00 00 	movabs $0x80231d,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 1d 23 80 00 00 	movabs $0x80231d,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 80 5e 80 00 00 	movabs $0x805e80,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 80 5e 80 00 00 	movabs $0x805e80,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 75 25 80 00 00 	movabs $0x802575,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 75 25 80 00 00 	movabs $0x802575,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 ff 00 00 00       	call   8015fe <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <forktree>:
+        exit();
+    }
+}
+
+void
+forktree(const char *cur) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 54                	push   %r12
+  801507:	53                   	push   %rbx
+  801508:	48 89 fb             	mov    %rdi,%rbx
+    cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80150b:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  801512:	00 00 00 
+  801515:	ff d0                	call   *%rax
+  801517:	89 c6                	mov    %eax,%esi
+  801519:	48 89 da             	mov    %rbx,%rdx
+  80151c:	48 bf a2 5e 80 00 00 	movabs $0x805ea2,%rdi
+  801523:	00 00 00 
+  801526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152b:	48 b9 77 17 80 00 00 	movabs $0x801777,%rcx
+  801532:	00 00 00 
+  801535:	ff d1                	call   *%rcx
+
+    forkchild(cur, '0');
+  801537:	be 30 00 00 00       	mov    $0x30,%esi
+  80153c:	48 89 df             	mov    %rbx,%rdi
+  80153f:	49 bc 5c 15 80 00 00 	movabs $0x80155c,%r12
+  801546:	00 00 00 
+  801549:	41 ff d4             	call   *%r12
+    forkchild(cur, '1');
+  80154c:	be 31 00 00 00       	mov    $0x31,%esi
+  801551:	48 89 df             	mov    %rbx,%rdi
+  801554:	41 ff d4             	call   *%r12
+}
+  801557:	5b                   	pop    %rbx
+  801558:	41 5c                	pop    %r12
+  80155a:	5d                   	pop    %rbp
+  80155b:	c3                   	ret
+
+000000000080155c <forkchild>:
+forkchild(const char *cur, char branch) {
+  80155c:	55                   	push   %rbp
+  80155d:	48 89 e5             	mov    %rsp,%rbp
+  801560:	41 54                	push   %r12
+  801562:	53                   	push   %rbx
+  801563:	48 83 ec 10          	sub    $0x10,%rsp
+  801567:	48 89 fb             	mov    %rdi,%rbx
+  80156a:	41 89 f4             	mov    %esi,%r12d
+    if (strlen(cur) >= DEPTH)
+  80156d:	48 b8 70 20 80 00 00 	movabs $0x802070,%rax
+  801574:	00 00 00 
+  801577:	ff d0                	call   *%rax
+  801579:	48 83 f8 02          	cmp    $0x2,%rax
+  80157d:	76 09                	jbe    801588 <forkchild+0x2c>
+}
+  80157f:	48 83 c4 10          	add    $0x10,%rsp
+  801583:	5b                   	pop    %rbx
+  801584:	41 5c                	pop    %r12
+  801586:	5d                   	pop    %rbp
+  801587:	c3                   	ret
+    snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  801588:	45 0f be c4          	movsbl %r12b,%r8d
+  80158c:	48 89 d9             	mov    %rbx,%rcx
+  80158f:	48 ba b3 5e 80 00 00 	movabs $0x805eb3,%rdx
+  801596:	00 00 00 
+  801599:	be 04 00 00 00       	mov    $0x4,%esi
+  80159e:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8015a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a7:	49 b9 33 20 80 00 00 	movabs $0x802033,%r9
+  8015ae:	00 00 00 
+  8015b1:	41 ff d1             	call   *%r9
+    if (fork() == 0) {
+  8015b4:	48 b8 71 2e 80 00 00 	movabs $0x802e71,%rax
+  8015bb:	00 00 00 
+  8015be:	ff d0                	call   *%rax
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	75 bb                	jne    80157f <forkchild+0x23>
+        forktree(nxt);
+  8015c4:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8015c8:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015cf:	00 00 00 
+  8015d2:	ff d0                	call   *%rax
+        exit();
+  8015d4:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+  8015e0:	eb 9d                	jmp    80157f <forkchild+0x23>
+
+00000000008015e2 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8015e2:	55                   	push   %rbp
+  8015e3:	48 89 e5             	mov    %rsp,%rbp
+    forktree("");
+  8015e6:	48 bf b2 5e 80 00 00 	movabs $0x805eb2,%rdi
+  8015ed:	00 00 00 
+  8015f0:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015f7:	00 00 00 
+  8015fa:	ff d0                	call   *%rax
+}
+  8015fc:	5d                   	pop    %rbp
+  8015fd:	c3                   	ret
+
+00000000008015fe <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	41 56                	push   %r14
+  801604:	41 55                	push   %r13
+  801606:	41 54                	push   %r12
+  801608:	53                   	push   %rbx
+  801609:	41 89 fd             	mov    %edi,%r13d
+  80160c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80160f:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801616:	00 00 00 
+  801619:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801620:	00 00 00 
+  801623:	48 39 c2             	cmp    %rax,%rdx
+  801626:	73 17                	jae    80163f <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801628:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80162b:	49 89 c4             	mov    %rax,%r12
+  80162e:	48 83 c3 08          	add    $0x8,%rbx
+  801632:	b8 00 00 00 00       	mov    $0x0,%eax
+  801637:	ff 53 f8             	call   *-0x8(%rbx)
+  80163a:	4c 39 e3             	cmp    %r12,%rbx
+  80163d:	72 ef                	jb     80162e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80163f:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  801646:	00 00 00 
+  801649:	ff d0                	call   *%rax
+  80164b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801650:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801657:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80165e:	00 00 00 
+  801661:	48 01 d0             	add    %rdx,%rax
+  801664:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80166b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80166e:	45 85 ed             	test   %r13d,%r13d
+  801671:	7e 0d                	jle    801680 <libmain+0x82>
+  801673:	49 8b 06             	mov    (%r14),%rax
+  801676:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80167d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801680:	4c 89 f6             	mov    %r14,%rsi
+  801683:	44 89 ef             	mov    %r13d,%edi
+  801686:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  80168d:	00 00 00 
+  801690:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801692:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  801699:	00 00 00 
+  80169c:	ff d0                	call   *%rax
+#endif
+}
+  80169e:	5b                   	pop    %rbx
+  80169f:	41 5c                	pop    %r12
+  8016a1:	41 5d                	pop    %r13
+  8016a3:	41 5e                	pop    %r14
+  8016a5:	5d                   	pop    %rbp
+  8016a6:	c3                   	ret
+
+00000000008016a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8016a7:	55                   	push   %rbp
+  8016a8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8016ab:	48 b8 49 32 80 00 00 	movabs $0x803249,%rax
+  8016b2:	00 00 00 
+  8016b5:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8016b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016bc:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  8016c3:	00 00 00 
+  8016c6:	ff d0                	call   *%rax
+}
+  8016c8:	5d                   	pop    %rbp
+  8016c9:	c3                   	ret
+
+00000000008016ca <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8016ca:	55                   	push   %rbp
+  8016cb:	48 89 e5             	mov    %rsp,%rbp
+  8016ce:	53                   	push   %rbx
+  8016cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d3:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8016d6:	8b 06                	mov    (%rsi),%eax
+  8016d8:	8d 50 01             	lea    0x1(%rax),%edx
+  8016db:	89 16                	mov    %edx,(%rsi)
+  8016dd:	48 98                	cltq
+  8016df:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8016e4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8016ea:	74 0a                	je     8016f6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8016ec:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8016f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f4:	c9                   	leave
+  8016f5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8016f6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8016fa:	be ff 00 00 00       	mov    $0xff,%esi
+  8016ff:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  801706:	00 00 00 
+  801709:	ff d0                	call   *%rax
+        state->offset = 0;
+  80170b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801711:	eb d9                	jmp    8016ec <putch+0x22>
+
+0000000000801713 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801713:	55                   	push   %rbp
+  801714:	48 89 e5             	mov    %rsp,%rbp
+  801717:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80171e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801721:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801728:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80172d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801732:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801735:	48 89 f1             	mov    %rsi,%rcx
+  801738:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80173f:	48 bf ca 16 80 00 00 	movabs $0x8016ca,%rdi
+  801746:	00 00 00 
+  801749:	48 b8 c7 18 80 00 00 	movabs $0x8018c7,%rax
+  801750:	00 00 00 
+  801753:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801755:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80175c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801763:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80176a:	00 00 00 
+  80176d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80176f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+
+0000000000801777 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801777:	55                   	push   %rbp
+  801778:	48 89 e5             	mov    %rsp,%rbp
+  80177b:	48 83 ec 50          	sub    $0x50,%rsp
+  80177f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801783:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801787:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80178b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80178f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801793:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80179a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80179e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8017aa:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8017ae:	48 b8 13 17 80 00 00 	movabs $0x801713,%rax
+  8017b5:	00 00 00 
+  8017b8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8017ba:	c9                   	leave
+  8017bb:	c3                   	ret
+
+00000000008017bc <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8017bc:	55                   	push   %rbp
+  8017bd:	48 89 e5             	mov    %rsp,%rbp
+  8017c0:	41 57                	push   %r15
+  8017c2:	41 56                	push   %r14
+  8017c4:	41 55                	push   %r13
+  8017c6:	41 54                	push   %r12
+  8017c8:	53                   	push   %rbx
+  8017c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8017cd:	49 89 fc             	mov    %rdi,%r12
+  8017d0:	49 89 f5             	mov    %rsi,%r13
+  8017d3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017d7:	8b 45 10             	mov    0x10(%rbp),%eax
+  8017da:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8017dd:	41 89 cf             	mov    %ecx,%r15d
+  8017e0:	4c 39 fa             	cmp    %r15,%rdx
+  8017e3:	73 5b                	jae    801840 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8017e5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8017e9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8017ed:	85 db                	test   %ebx,%ebx
+  8017ef:	7e 0e                	jle    8017ff <print_num+0x43>
+            putch(padc, put_arg);
+  8017f1:	4c 89 ee             	mov    %r13,%rsi
+  8017f4:	44 89 f7             	mov    %r14d,%edi
+  8017f7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8017fa:	83 eb 01             	sub    $0x1,%ebx
+  8017fd:	75 f2                	jne    8017f1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8017ff:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801803:	48 b9 d3 5e 80 00 00 	movabs $0x805ed3,%rcx
+  80180a:	00 00 00 
+  80180d:	48 b8 c2 5e 80 00 00 	movabs $0x805ec2,%rax
+  801814:	00 00 00 
+  801817:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80181b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80181f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801824:	49 f7 f7             	div    %r15
+  801827:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80182b:	4c 89 ee             	mov    %r13,%rsi
+  80182e:	41 ff d4             	call   *%r12
+}
+  801831:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801835:	5b                   	pop    %rbx
+  801836:	41 5c                	pop    %r12
+  801838:	41 5d                	pop    %r13
+  80183a:	41 5e                	pop    %r14
+  80183c:	41 5f                	pop    %r15
+  80183e:	5d                   	pop    %rbp
+  80183f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801840:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801844:	ba 00 00 00 00       	mov    $0x0,%edx
+  801849:	49 f7 f7             	div    %r15
+  80184c:	48 83 ec 08          	sub    $0x8,%rsp
+  801850:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801854:	52                   	push   %rdx
+  801855:	45 0f be c9          	movsbl %r9b,%r9d
+  801859:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80185d:	48 89 c2             	mov    %rax,%rdx
+  801860:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  801867:	00 00 00 
+  80186a:	ff d0                	call   *%rax
+  80186c:	48 83 c4 10          	add    $0x10,%rsp
+  801870:	eb 8d                	jmp    8017ff <print_num+0x43>
+
+0000000000801872 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801872:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801876:	48 8b 06             	mov    (%rsi),%rax
+  801879:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80187d:	73 0a                	jae    801889 <sprintputch+0x17>
+        *state->start++ = ch;
+  80187f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801883:	48 89 16             	mov    %rdx,(%rsi)
+  801886:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801889:	c3                   	ret
+
+000000000080188a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80188a:	55                   	push   %rbp
+  80188b:	48 89 e5             	mov    %rsp,%rbp
+  80188e:	48 83 ec 50          	sub    $0x50,%rsp
+  801892:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801896:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80189a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80189e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8018a5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018ad:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8018b5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8018b9:	48 b8 c7 18 80 00 00 	movabs $0x8018c7,%rax
+  8018c0:	00 00 00 
+  8018c3:	ff d0                	call   *%rax
+}
+  8018c5:	c9                   	leave
+  8018c6:	c3                   	ret
+
+00000000008018c7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8018c7:	55                   	push   %rbp
+  8018c8:	48 89 e5             	mov    %rsp,%rbp
+  8018cb:	41 57                	push   %r15
+  8018cd:	41 56                	push   %r14
+  8018cf:	41 55                	push   %r13
+  8018d1:	41 54                	push   %r12
+  8018d3:	53                   	push   %rbx
+  8018d4:	48 83 ec 38          	sub    $0x38,%rsp
+  8018d8:	49 89 fe             	mov    %rdi,%r14
+  8018db:	49 89 f5             	mov    %rsi,%r13
+  8018de:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8018e1:	48 8b 01             	mov    (%rcx),%rax
+  8018e4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8018e8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8018ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8018f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8018f8:	eb 0d                	jmp    801907 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8018fa:	40 0f b6 ff          	movzbl %dil,%edi
+  8018fe:	4c 89 ee             	mov    %r13,%rsi
+  801901:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801904:	4c 89 e3             	mov    %r12,%rbx
+  801907:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80190b:	0f b6 3b             	movzbl (%rbx),%edi
+  80190e:	40 80 ff 25          	cmp    $0x25,%dil
+  801912:	74 14                	je     801928 <vprintfmt+0x61>
+            if (!ch) return;
+  801914:	40 84 ff             	test   %dil,%dil
+  801917:	75 e1                	jne    8018fa <vprintfmt+0x33>
+}
+  801919:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80191d:	5b                   	pop    %rbx
+  80191e:	41 5c                	pop    %r12
+  801920:	41 5d                	pop    %r13
+  801922:	41 5e                	pop    %r14
+  801924:	41 5f                	pop    %r15
+  801926:	5d                   	pop    %rbp
+  801927:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801928:	be 00 00 00 00       	mov    $0x0,%esi
+  80192d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801931:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801936:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80193c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801943:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801947:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80194c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801951:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801954:	83 e8 23             	sub    $0x23,%eax
+  801957:	3c 57                	cmp    $0x57,%al
+  801959:	0f 87 67 06 00 00    	ja     801fc6 <vprintfmt+0x6ff>
+  80195f:	0f b6 c0             	movzbl %al,%eax
+  801962:	48 b9 60 60 80 00 00 	movabs $0x806060,%rcx
+  801969:	00 00 00 
+  80196c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80196f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801972:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801976:	eb cf                	jmp    801947 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801978:	49 89 dc             	mov    %rbx,%r12
+  80197b:	be 01 00 00 00       	mov    $0x1,%esi
+  801980:	eb c5                	jmp    801947 <vprintfmt+0x80>
+            padc = ch;
+  801982:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801986:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801989:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80198c:	eb b9                	jmp    801947 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80198e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801991:	83 f8 2f             	cmp    $0x2f,%eax
+  801994:	77 24                	ja     8019ba <vprintfmt+0xf3>
+  801996:	89 c1                	mov    %eax,%ecx
+  801998:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80199c:	83 c0 08             	add    $0x8,%eax
+  80199f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8019a2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8019a5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8019a8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8019ac:	79 99                	jns    801947 <vprintfmt+0x80>
+                width = precision;
+  8019ae:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8019b2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8019b8:	eb 8d                	jmp    801947 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019ba:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8019be:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8019c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019c6:	eb da                	jmp    8019a2 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8019c8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8019cd:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019d1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8019d7:	3c 39                	cmp    $0x39,%al
+  8019d9:	77 1c                	ja     8019f7 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8019db:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8019df:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8019e3:	0f b6 c0             	movzbl %al,%eax
+  8019e6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019eb:	0f b6 03             	movzbl (%rbx),%eax
+  8019ee:	3c 39                	cmp    $0x39,%al
+  8019f0:	76 e9                	jbe    8019db <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8019f2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8019f5:	eb b1                	jmp    8019a8 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8019f7:	49 89 dc             	mov    %rbx,%r12
+  8019fa:	eb ac                	jmp    8019a8 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  8019fc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8019ff:	85 c9                	test   %ecx,%ecx
+  801a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a06:	0f 49 c1             	cmovns %ecx,%eax
+  801a09:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801a0c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a0f:	e9 33 ff ff ff       	jmp    801947 <vprintfmt+0x80>
+            lflag++;
+  801a14:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a17:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a1a:	e9 28 ff ff ff       	jmp    801947 <vprintfmt+0x80>
+            lflag--;
+  801a1f:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a22:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a25:	e9 1d ff ff ff       	jmp    801947 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  801a30:	77 19                	ja     801a4b <vprintfmt+0x184>
+  801a32:	89 c2                	mov    %eax,%edx
+  801a34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a38:	83 c0 08             	add    $0x8,%eax
+  801a3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a3e:	8b 3a                	mov    (%rdx),%edi
+  801a40:	4c 89 ee             	mov    %r13,%rsi
+  801a43:	41 ff d6             	call   *%r14
+            break;
+  801a46:	e9 bc fe ff ff       	jmp    801907 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a57:	eb e5                	jmp    801a3e <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801a59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a5c:	83 f8 2f             	cmp    $0x2f,%eax
+  801a5f:	77 5a                	ja     801abb <vprintfmt+0x1f4>
+  801a61:	89 c2                	mov    %eax,%edx
+  801a63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a67:	83 c0 08             	add    $0x8,%eax
+  801a6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801a6d:	8b 02                	mov    (%rdx),%eax
+  801a6f:	89 c1                	mov    %eax,%ecx
+  801a71:	f7 d9                	neg    %ecx
+  801a73:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801a76:	83 f9 13             	cmp    $0x13,%ecx
+  801a79:	7f 4e                	jg     801ac9 <vprintfmt+0x202>
+  801a7b:	48 63 c1             	movslq %ecx,%rax
+  801a7e:	48 ba 20 63 80 00 00 	movabs $0x806320,%rdx
+  801a85:	00 00 00 
+  801a88:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801a8c:	48 85 c0             	test   %rax,%rax
+  801a8f:	74 38                	je     801ac9 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801a91:	48 89 c1             	mov    %rax,%rcx
+  801a94:	48 ba 68 65 80 00 00 	movabs $0x806568,%rdx
+  801a9b:	00 00 00 
+  801a9e:	4c 89 ee             	mov    %r13,%rsi
+  801aa1:	4c 89 f7             	mov    %r14,%rdi
+  801aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa9:	49 b8 8a 18 80 00 00 	movabs $0x80188a,%r8
+  801ab0:	00 00 00 
+  801ab3:	41 ff d0             	call   *%r8
+  801ab6:	e9 4c fe ff ff       	jmp    801907 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801abb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801abf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ac3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ac7:	eb a4                	jmp    801a6d <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801ac9:	48 ba eb 5e 80 00 00 	movabs $0x805eeb,%rdx
+  801ad0:	00 00 00 
+  801ad3:	4c 89 ee             	mov    %r13,%rsi
+  801ad6:	4c 89 f7             	mov    %r14,%rdi
+  801ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ade:	49 b8 8a 18 80 00 00 	movabs $0x80188a,%r8
+  801ae5:	00 00 00 
+  801ae8:	41 ff d0             	call   *%r8
+  801aeb:	e9 17 fe ff ff       	jmp    801907 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801af0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801af3:	83 f8 2f             	cmp    $0x2f,%eax
+  801af6:	77 6c                	ja     801b64 <vprintfmt+0x29d>
+  801af8:	89 c2                	mov    %eax,%edx
+  801afa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801afe:	83 c0 08             	add    $0x8,%eax
+  801b01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b04:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801b07:	48 85 f6             	test   %rsi,%rsi
+  801b0a:	48 b8 e4 5e 80 00 00 	movabs $0x805ee4,%rax
+  801b11:	00 00 00 
+  801b14:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b18:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801b1c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b20:	7e 06                	jle    801b28 <vprintfmt+0x261>
+  801b22:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801b26:	75 4a                	jne    801b72 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b28:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801b2c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801b30:	0f b6 00             	movzbl (%rax),%eax
+  801b33:	84 c0                	test   %al,%al
+  801b35:	0f 85 9a 00 00 00    	jne    801bd5 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801b3b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b3e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	0f 8e bd fd ff ff    	jle    801907 <vprintfmt+0x40>
+  801b4a:	4c 89 ee             	mov    %r13,%rsi
+  801b4d:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b52:	41 ff d6             	call   *%r14
+  801b55:	41 83 ec 01          	sub    $0x1,%r12d
+  801b59:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b5d:	75 eb                	jne    801b4a <vprintfmt+0x283>
+  801b5f:	e9 a3 fd ff ff       	jmp    801907 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b70:	eb 92                	jmp    801b04 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801b72:	49 63 f7             	movslq %r15d,%rsi
+  801b75:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801b79:	48 b8 8b 20 80 00 00 	movabs $0x80208b,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	48 89 c2             	mov    %rax,%rdx
+  801b88:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b8b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801b8d:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801b90:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	7e 91                	jle    801b28 <vprintfmt+0x261>
+  801b97:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801b9c:	4c 89 ee             	mov    %r13,%rsi
+  801b9f:	44 89 e7             	mov    %r12d,%edi
+  801ba2:	41 ff d6             	call   *%r14
+  801ba5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ba9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bac:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801baf:	75 eb                	jne    801b9c <vprintfmt+0x2d5>
+  801bb1:	e9 72 ff ff ff       	jmp    801b28 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801bb6:	0f b6 f8             	movzbl %al,%edi
+  801bb9:	4c 89 ee             	mov    %r13,%rsi
+  801bbc:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801bbf:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801bc3:	49 83 c4 01          	add    $0x1,%r12
+  801bc7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801bcd:	84 c0                	test   %al,%al
+  801bcf:	0f 84 66 ff ff ff    	je     801b3b <vprintfmt+0x274>
+  801bd5:	45 85 ff             	test   %r15d,%r15d
+  801bd8:	78 0a                	js     801be4 <vprintfmt+0x31d>
+  801bda:	41 83 ef 01          	sub    $0x1,%r15d
+  801bde:	0f 88 57 ff ff ff    	js     801b3b <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801be4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801be8:	74 cc                	je     801bb6 <vprintfmt+0x2ef>
+  801bea:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801bed:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801bf2:	80 fa 5e             	cmp    $0x5e,%dl
+  801bf5:	77 c2                	ja     801bb9 <vprintfmt+0x2f2>
+  801bf7:	eb bd                	jmp    801bb6 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801bf9:	40 84 f6             	test   %sil,%sil
+  801bfc:	75 26                	jne    801c24 <vprintfmt+0x35d>
+    switch (lflag) {
+  801bfe:	85 d2                	test   %edx,%edx
+  801c00:	74 59                	je     801c5b <vprintfmt+0x394>
+  801c02:	83 fa 01             	cmp    $0x1,%edx
+  801c05:	74 7b                	je     801c82 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801c07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c0a:	83 f8 2f             	cmp    $0x2f,%eax
+  801c0d:	0f 87 96 00 00 00    	ja     801ca9 <vprintfmt+0x3e2>
+  801c13:	89 c2                	mov    %eax,%edx
+  801c15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c19:	83 c0 08             	add    $0x8,%eax
+  801c1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c1f:	4c 8b 22             	mov    (%rdx),%r12
+  801c22:	eb 17                	jmp    801c3b <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801c24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c27:	83 f8 2f             	cmp    $0x2f,%eax
+  801c2a:	77 21                	ja     801c4d <vprintfmt+0x386>
+  801c2c:	89 c2                	mov    %eax,%edx
+  801c2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c32:	83 c0 08             	add    $0x8,%eax
+  801c35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c38:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801c3b:	4d 85 e4             	test   %r12,%r12
+  801c3e:	78 7a                	js     801cba <vprintfmt+0x3f3>
+            num = i;
+  801c40:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c43:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c48:	e9 56 02 00 00       	jmp    801ea3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c59:	eb dd                	jmp    801c38 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801c5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c61:	77 11                	ja     801c74 <vprintfmt+0x3ad>
+  801c63:	89 c2                	mov    %eax,%edx
+  801c65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c69:	83 c0 08             	add    $0x8,%eax
+  801c6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c6f:	4c 63 22             	movslq (%rdx),%r12
+  801c72:	eb c7                	jmp    801c3b <vprintfmt+0x374>
+  801c74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c80:	eb ed                	jmp    801c6f <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801c82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c85:	83 f8 2f             	cmp    $0x2f,%eax
+  801c88:	77 11                	ja     801c9b <vprintfmt+0x3d4>
+  801c8a:	89 c2                	mov    %eax,%edx
+  801c8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c90:	83 c0 08             	add    $0x8,%eax
+  801c93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c96:	4c 8b 22             	mov    (%rdx),%r12
+  801c99:	eb a0                	jmp    801c3b <vprintfmt+0x374>
+  801c9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca7:	eb ed                	jmp    801c96 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801ca9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb5:	e9 65 ff ff ff       	jmp    801c1f <vprintfmt+0x358>
+                putch('-', put_arg);
+  801cba:	4c 89 ee             	mov    %r13,%rsi
+  801cbd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801cc2:	41 ff d6             	call   *%r14
+                i = -i;
+  801cc5:	49 f7 dc             	neg    %r12
+  801cc8:	e9 73 ff ff ff       	jmp    801c40 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801ccd:	40 84 f6             	test   %sil,%sil
+  801cd0:	75 2e                	jne    801d00 <vprintfmt+0x439>
+    switch (lflag) {
+  801cd2:	85 d2                	test   %edx,%edx
+  801cd4:	7f 59                	jg     801d2f <vprintfmt+0x468>
+  801cd6:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cd9:	7d 7a                	jge    801d55 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801cdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cde:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce1:	0f 87 aa 00 00 00    	ja     801d91 <vprintfmt+0x4ca>
+  801ce7:	89 c2                	mov    %eax,%edx
+  801ce9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ced:	83 c0 08             	add    $0x8,%eax
+  801cf0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cf6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cfb:	e9 a3 01 00 00       	jmp    801ea3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d03:	83 f8 2f             	cmp    $0x2f,%eax
+  801d06:	77 19                	ja     801d21 <vprintfmt+0x45a>
+  801d08:	89 c2                	mov    %eax,%edx
+  801d0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d0e:	83 c0 08             	add    $0x8,%eax
+  801d11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d14:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d17:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d1c:	e9 82 01 00 00       	jmp    801ea3 <vprintfmt+0x5dc>
+  801d21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d2d:	eb e5                	jmp    801d14 <vprintfmt+0x44d>
+    switch (lflag) {
+  801d2f:	83 fa 01             	cmp    $0x1,%edx
+  801d32:	75 a7                	jne    801cdb <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801d34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d37:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3a:	77 47                	ja     801d83 <vprintfmt+0x4bc>
+  801d3c:	89 c2                	mov    %eax,%edx
+  801d3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d42:	83 c0 08             	add    $0x8,%eax
+  801d45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d48:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d4b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d50:	e9 4e 01 00 00       	jmp    801ea3 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d58:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5b:	77 18                	ja     801d75 <vprintfmt+0x4ae>
+  801d5d:	89 c2                	mov    %eax,%edx
+  801d5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d63:	83 c0 08             	add    $0x8,%eax
+  801d66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d69:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801d6b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801d70:	e9 2e 01 00 00       	jmp    801ea3 <vprintfmt+0x5dc>
+  801d75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d81:	eb e6                	jmp    801d69 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801d83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8f:	eb b7                	jmp    801d48 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801d91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9d:	e9 51 ff ff ff       	jmp    801cf3 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801da2:	40 84 f6             	test   %sil,%sil
+  801da5:	75 2e                	jne    801dd5 <vprintfmt+0x50e>
+    switch (lflag) {
+  801da7:	85 d2                	test   %edx,%edx
+  801da9:	7f 59                	jg     801e04 <vprintfmt+0x53d>
+  801dab:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801dae:	7d 77                	jge    801e27 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801db0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db3:	83 f8 2f             	cmp    $0x2f,%eax
+  801db6:	0f 87 a4 00 00 00    	ja     801e60 <vprintfmt+0x599>
+  801dbc:	89 c2                	mov    %eax,%edx
+  801dbe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc2:	83 c0 08             	add    $0x8,%eax
+  801dc5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801dcb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801dd0:	e9 ce 00 00 00       	jmp    801ea3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801dd5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dd8:	83 f8 2f             	cmp    $0x2f,%eax
+  801ddb:	77 19                	ja     801df6 <vprintfmt+0x52f>
+  801ddd:	89 c2                	mov    %eax,%edx
+  801ddf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801de3:	83 c0 08             	add    $0x8,%eax
+  801de6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801de9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801dec:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801df1:	e9 ad 00 00 00       	jmp    801ea3 <vprintfmt+0x5dc>
+  801df6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dfa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e02:	eb e5                	jmp    801de9 <vprintfmt+0x522>
+    switch (lflag) {
+  801e04:	83 fa 01             	cmp    $0x1,%edx
+  801e07:	75 a7                	jne    801db0 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801e09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e0c:	83 f8 2f             	cmp    $0x2f,%eax
+  801e0f:	77 41                	ja     801e52 <vprintfmt+0x58b>
+  801e11:	89 c2                	mov    %eax,%edx
+  801e13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e17:	83 c0 08             	add    $0x8,%eax
+  801e1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e20:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801e25:	eb 7c                	jmp    801ea3 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e2a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e2d:	77 15                	ja     801e44 <vprintfmt+0x57d>
+  801e2f:	89 c2                	mov    %eax,%edx
+  801e31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e35:	83 c0 08             	add    $0x8,%eax
+  801e38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e3b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e3d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e42:	eb 5f                	jmp    801ea3 <vprintfmt+0x5dc>
+  801e44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e50:	eb e9                	jmp    801e3b <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e5e:	eb bd                	jmp    801e1d <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801e60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e6c:	e9 57 ff ff ff       	jmp    801dc8 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801e71:	4c 89 ee             	mov    %r13,%rsi
+  801e74:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e79:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801e7c:	4c 89 ee             	mov    %r13,%rsi
+  801e7f:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e84:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801e87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e8a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8d:	77 47                	ja     801ed6 <vprintfmt+0x60f>
+  801e8f:	89 c2                	mov    %eax,%edx
+  801e91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e95:	83 c0 08             	add    $0x8,%eax
+  801e98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801ea3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801eab:	0f 94 c0             	sete   %al
+  801eae:	0f b6 c0             	movzbl %al,%eax
+  801eb1:	50                   	push   %rax
+  801eb2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801eb7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801ebb:	4c 89 ee             	mov    %r13,%rsi
+  801ebe:	4c 89 f7             	mov    %r14,%rdi
+  801ec1:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  801ec8:	00 00 00 
+  801ecb:	ff d0                	call   *%rax
+            break;
+  801ecd:	48 83 c4 10          	add    $0x10,%rsp
+  801ed1:	e9 31 fa ff ff       	jmp    801907 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801ed6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ede:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee2:	eb b7                	jmp    801e9b <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801ee4:	40 84 f6             	test   %sil,%sil
+  801ee7:	75 2b                	jne    801f14 <vprintfmt+0x64d>
+    switch (lflag) {
+  801ee9:	85 d2                	test   %edx,%edx
+  801eeb:	7f 56                	jg     801f43 <vprintfmt+0x67c>
+  801eed:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ef0:	7d 77                	jge    801f69 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801ef2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef5:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef8:	0f 87 a7 00 00 00    	ja     801fa5 <vprintfmt+0x6de>
+  801efe:	89 c2                	mov    %eax,%edx
+  801f00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f04:	83 c0 08             	add    $0x8,%eax
+  801f07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f12:	eb 8f                	jmp    801ea3 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f17:	83 f8 2f             	cmp    $0x2f,%eax
+  801f1a:	77 19                	ja     801f35 <vprintfmt+0x66e>
+  801f1c:	89 c2                	mov    %eax,%edx
+  801f1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f22:	83 c0 08             	add    $0x8,%eax
+  801f25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f2b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f30:	e9 6e ff ff ff       	jmp    801ea3 <vprintfmt+0x5dc>
+  801f35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f41:	eb e5                	jmp    801f28 <vprintfmt+0x661>
+    switch (lflag) {
+  801f43:	83 fa 01             	cmp    $0x1,%edx
+  801f46:	75 aa                	jne    801ef2 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f4b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f4e:	77 47                	ja     801f97 <vprintfmt+0x6d0>
+  801f50:	89 c2                	mov    %eax,%edx
+  801f52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f56:	83 c0 08             	add    $0x8,%eax
+  801f59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f5f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801f64:	e9 3a ff ff ff       	jmp    801ea3 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f6c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f6f:	77 18                	ja     801f89 <vprintfmt+0x6c2>
+  801f71:	89 c2                	mov    %eax,%edx
+  801f73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f77:	83 c0 08             	add    $0x8,%eax
+  801f7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f7d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801f7f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801f84:	e9 1a ff ff ff       	jmp    801ea3 <vprintfmt+0x5dc>
+  801f89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f95:	eb e6                	jmp    801f7d <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801f97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa3:	eb b7                	jmp    801f5c <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801fa5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fa9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fb1:	e9 54 ff ff ff       	jmp    801f0a <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801fb6:	4c 89 ee             	mov    %r13,%rsi
+  801fb9:	bf 25 00 00 00       	mov    $0x25,%edi
+  801fbe:	41 ff d6             	call   *%r14
+            break;
+  801fc1:	e9 41 f9 ff ff       	jmp    801907 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801fc6:	4c 89 ee             	mov    %r13,%rsi
+  801fc9:	bf 25 00 00 00       	mov    $0x25,%edi
+  801fce:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801fd1:	48 83 eb 01          	sub    $0x1,%rbx
+  801fd5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801fd9:	75 f6                	jne    801fd1 <vprintfmt+0x70a>
+  801fdb:	e9 27 f9 ff ff       	jmp    801907 <vprintfmt+0x40>
+
+0000000000801fe0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801fe8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801fec:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801ff1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801ff5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801ffc:	48 85 ff             	test   %rdi,%rdi
+  801fff:	74 2b                	je     80202c <vsnprintf+0x4c>
+  802001:	48 85 f6             	test   %rsi,%rsi
+  802004:	74 26                	je     80202c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802006:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80200a:	48 bf 72 18 80 00 00 	movabs $0x801872,%rdi
+  802011:	00 00 00 
+  802014:	48 b8 c7 18 80 00 00 	movabs $0x8018c7,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802020:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802024:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802027:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80202c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802031:	eb f7                	jmp    80202a <vsnprintf+0x4a>
+
+0000000000802033 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+  802037:	48 83 ec 50          	sub    $0x50,%rsp
+  80203b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80203f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802043:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802047:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80204e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802052:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802056:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80205a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80205e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802062:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802069:	00 00 00 
+  80206c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80206e:	c9                   	leave
+  80206f:	c3                   	ret
+
+0000000000802070 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802070:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802073:	74 10                	je     802085 <strlen+0x15>
+    size_t n = 0;
+  802075:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80207a:	48 83 c0 01          	add    $0x1,%rax
+  80207e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802082:	75 f6                	jne    80207a <strlen+0xa>
+  802084:	c3                   	ret
+    size_t n = 0;
+  802085:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80208a:	c3                   	ret
+
+000000000080208b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80208b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80208e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802093:	48 85 f6             	test   %rsi,%rsi
+  802096:	74 11                	je     8020a9 <strnlen+0x1e>
+  802098:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80209c:	74 0c                	je     8020aa <strnlen+0x1f>
+  80209e:	48 83 c2 01          	add    $0x1,%rdx
+  8020a2:	48 39 d0             	cmp    %rdx,%rax
+  8020a5:	75 f1                	jne    802098 <strnlen+0xd>
+  8020a7:	eb 04                	jmp    8020ad <strnlen+0x22>
+  8020a9:	c3                   	ret
+  8020aa:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8020ad:	c3                   	ret
+
+00000000008020ae <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8020ae:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8020b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8020ba:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8020bd:	48 83 c2 01          	add    $0x1,%rdx
+  8020c1:	84 c9                	test   %cl,%cl
+  8020c3:	75 f1                	jne    8020b6 <strcpy+0x8>
+        ;
+    return res;
+}
+  8020c5:	c3                   	ret
+
+00000000008020c6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8020c6:	55                   	push   %rbp
+  8020c7:	48 89 e5             	mov    %rsp,%rbp
+  8020ca:	41 54                	push   %r12
+  8020cc:	53                   	push   %rbx
+  8020cd:	48 89 fb             	mov    %rdi,%rbx
+  8020d0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8020d3:	48 b8 70 20 80 00 00 	movabs $0x802070,%rax
+  8020da:	00 00 00 
+  8020dd:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8020df:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8020e3:	4c 89 e6             	mov    %r12,%rsi
+  8020e6:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  8020ed:	00 00 00 
+  8020f0:	ff d0                	call   *%rax
+    return dst;
+}
+  8020f2:	48 89 d8             	mov    %rbx,%rax
+  8020f5:	5b                   	pop    %rbx
+  8020f6:	41 5c                	pop    %r12
+  8020f8:	5d                   	pop    %rbp
+  8020f9:	c3                   	ret
+
+00000000008020fa <toupper>:
+
+int
+toupper(int ch) {
+  8020fa:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8020fc:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8020ff:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802102:	83 f9 1a             	cmp    $0x1a,%ecx
+  802105:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802108:	c3                   	ret
+
+0000000000802109 <tolower>:
+
+int
+tolower(int ch) {
+  802109:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80210b:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80210e:	8d 57 20             	lea    0x20(%rdi),%edx
+  802111:	83 f9 1a             	cmp    $0x1a,%ecx
+  802114:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802117:	c3                   	ret
+
+0000000000802118 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802118:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80211b:	48 85 d2             	test   %rdx,%rdx
+  80211e:	74 1f                	je     80213f <strncpy+0x27>
+  802120:	48 01 fa             	add    %rdi,%rdx
+  802123:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802126:	48 83 c1 01          	add    $0x1,%rcx
+  80212a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80212e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802132:	41 80 f8 01          	cmp    $0x1,%r8b
+  802136:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80213a:	48 39 ca             	cmp    %rcx,%rdx
+  80213d:	75 e7                	jne    802126 <strncpy+0xe>
+    }
+    return ret;
+}
+  80213f:	c3                   	ret
+
+0000000000802140 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802140:	48 89 f8             	mov    %rdi,%rax
+  802143:	48 85 d2             	test   %rdx,%rdx
+  802146:	74 24                	je     80216c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802148:	48 83 ea 01          	sub    $0x1,%rdx
+  80214c:	74 1b                	je     802169 <strlcpy+0x29>
+  80214e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802152:	0f b6 16             	movzbl (%rsi),%edx
+  802155:	84 d2                	test   %dl,%dl
+  802157:	74 10                	je     802169 <strlcpy+0x29>
+            *dst++ = *src++;
+  802159:	48 83 c6 01          	add    $0x1,%rsi
+  80215d:	48 83 c0 01          	add    $0x1,%rax
+  802161:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802164:	48 39 c8             	cmp    %rcx,%rax
+  802167:	75 e9                	jne    802152 <strlcpy+0x12>
+        *dst = '\0';
+  802169:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80216c:	48 29 f8             	sub    %rdi,%rax
+}
+  80216f:	c3                   	ret
+
+0000000000802170 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802170:	0f b6 07             	movzbl (%rdi),%eax
+  802173:	84 c0                	test   %al,%al
+  802175:	74 13                	je     80218a <strcmp+0x1a>
+  802177:	38 06                	cmp    %al,(%rsi)
+  802179:	75 0f                	jne    80218a <strcmp+0x1a>
+  80217b:	48 83 c7 01          	add    $0x1,%rdi
+  80217f:	48 83 c6 01          	add    $0x1,%rsi
+  802183:	0f b6 07             	movzbl (%rdi),%eax
+  802186:	84 c0                	test   %al,%al
+  802188:	75 ed                	jne    802177 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80218a:	0f b6 c0             	movzbl %al,%eax
+  80218d:	0f b6 16             	movzbl (%rsi),%edx
+  802190:	29 d0                	sub    %edx,%eax
+}
+  802192:	c3                   	ret
+
+0000000000802193 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802193:	48 85 d2             	test   %rdx,%rdx
+  802196:	74 1f                	je     8021b7 <strncmp+0x24>
+  802198:	0f b6 07             	movzbl (%rdi),%eax
+  80219b:	84 c0                	test   %al,%al
+  80219d:	74 1e                	je     8021bd <strncmp+0x2a>
+  80219f:	3a 06                	cmp    (%rsi),%al
+  8021a1:	75 1a                	jne    8021bd <strncmp+0x2a>
+  8021a3:	48 83 c7 01          	add    $0x1,%rdi
+  8021a7:	48 83 c6 01          	add    $0x1,%rsi
+  8021ab:	48 83 ea 01          	sub    $0x1,%rdx
+  8021af:	75 e7                	jne    802198 <strncmp+0x5>
+
+    if (!n) return 0;
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b6:	c3                   	ret
+  8021b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021bc:	c3                   	ret
+  8021bd:	48 85 d2             	test   %rdx,%rdx
+  8021c0:	74 09                	je     8021cb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8021c2:	0f b6 07             	movzbl (%rdi),%eax
+  8021c5:	0f b6 16             	movzbl (%rsi),%edx
+  8021c8:	29 d0                	sub    %edx,%eax
+  8021ca:	c3                   	ret
+    if (!n) return 0;
+  8021cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d0:	c3                   	ret
+
+00000000008021d1 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8021d1:	0f b6 17             	movzbl (%rdi),%edx
+  8021d4:	84 d2                	test   %dl,%dl
+  8021d6:	74 18                	je     8021f0 <strchr+0x1f>
+        if (*str == c) {
+  8021d8:	0f be d2             	movsbl %dl,%edx
+  8021db:	39 f2                	cmp    %esi,%edx
+  8021dd:	74 17                	je     8021f6 <strchr+0x25>
+    for (; *str; str++) {
+  8021df:	48 83 c7 01          	add    $0x1,%rdi
+  8021e3:	0f b6 17             	movzbl (%rdi),%edx
+  8021e6:	84 d2                	test   %dl,%dl
+  8021e8:	75 ee                	jne    8021d8 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ef:	c3                   	ret
+  8021f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f5:	c3                   	ret
+  8021f6:	48 89 f8             	mov    %rdi,%rax
+}
+  8021f9:	c3                   	ret
+
+00000000008021fa <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8021fa:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8021fd:	0f b6 17             	movzbl (%rdi),%edx
+  802200:	84 d2                	test   %dl,%dl
+  802202:	74 13                	je     802217 <strfind+0x1d>
+  802204:	0f be d2             	movsbl %dl,%edx
+  802207:	39 f2                	cmp    %esi,%edx
+  802209:	74 0b                	je     802216 <strfind+0x1c>
+  80220b:	48 83 c0 01          	add    $0x1,%rax
+  80220f:	0f b6 10             	movzbl (%rax),%edx
+  802212:	84 d2                	test   %dl,%dl
+  802214:	75 ee                	jne    802204 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802216:	c3                   	ret
+  802217:	c3                   	ret
+
+0000000000802218 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802218:	48 39 f7             	cmp    %rsi,%rdi
+  80221b:	74 65                	je     802282 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+  802221:	41 57                	push   %r15
+  802223:	41 56                	push   %r14
+  802225:	41 55                	push   %r13
+  802227:	41 54                	push   %r12
+  802229:	53                   	push   %rbx
+  80222a:	48 83 ec 18          	sub    $0x18,%rsp
+  80222e:	48 89 fb             	mov    %rdi,%rbx
+  802231:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802234:	49 bf 09 21 80 00 00 	movabs $0x802109,%r15
+  80223b:	00 00 00 
+  80223e:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802242:	41 0f b6 fd          	movzbl %r13b,%edi
+  802246:	41 ff d7             	call   *%r15
+  802249:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80224c:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802251:	41 0f b6 fe          	movzbl %r14b,%edi
+  802255:	41 ff d7             	call   *%r15
+  802258:	89 c2                	mov    %eax,%edx
+  80225a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80225d:	29 d0                	sub    %edx,%eax
+  80225f:	75 12                	jne    802273 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802261:	48 83 c3 01          	add    $0x1,%rbx
+  802265:	45 84 ed             	test   %r13b,%r13b
+  802268:	74 09                	je     802273 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80226a:	49 83 c4 01          	add    $0x1,%r12
+  80226e:	45 84 f6             	test   %r14b,%r14b
+  802271:	75 cb                	jne    80223e <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802273:	48 83 c4 18          	add    $0x18,%rsp
+  802277:	5b                   	pop    %rbx
+  802278:	41 5c                	pop    %r12
+  80227a:	41 5d                	pop    %r13
+  80227c:	41 5e                	pop    %r14
+  80227e:	41 5f                	pop    %r15
+  802280:	5d                   	pop    %rbp
+  802281:	c3                   	ret
+    if (p1 == p2) return 0;
+  802282:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802287:	c3                   	ret
+
+0000000000802288 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802288:	48 39 f7             	cmp    %rsi,%rdi
+  80228b:	74 7d                	je     80230a <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80228d:	55                   	push   %rbp
+  80228e:	48 89 e5             	mov    %rsp,%rbp
+  802291:	41 57                	push   %r15
+  802293:	41 56                	push   %r14
+  802295:	41 55                	push   %r13
+  802297:	41 54                	push   %r12
+  802299:	53                   	push   %rbx
+  80229a:	48 83 ec 18          	sub    $0x18,%rsp
+  80229e:	48 89 fb             	mov    %rdi,%rbx
+  8022a1:	49 89 f4             	mov    %rsi,%r12
+  8022a4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8022a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022ac:	49 bf 09 21 80 00 00 	movabs $0x802109,%r15
+  8022b3:	00 00 00 
+    while (n--) {
+  8022b6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022ba:	48 39 c3             	cmp    %rax,%rbx
+  8022bd:	74 37                	je     8022f6 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022bf:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022c3:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022c7:	41 ff d7             	call   *%r15
+  8022ca:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022cd:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8022d2:	41 0f b6 fe          	movzbl %r14b,%edi
+  8022d6:	41 ff d7             	call   *%r15
+  8022d9:	89 c2                	mov    %eax,%edx
+  8022db:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022de:	29 d0                	sub    %edx,%eax
+  8022e0:	75 19                	jne    8022fb <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8022e2:	48 83 c3 01          	add    $0x1,%rbx
+  8022e6:	45 84 ed             	test   %r13b,%r13b
+  8022e9:	74 10                	je     8022fb <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8022eb:	49 83 c4 01          	add    $0x1,%r12
+  8022ef:	45 84 f6             	test   %r14b,%r14b
+  8022f2:	75 c2                	jne    8022b6 <strncasecmp+0x2e>
+  8022f4:	eb 05                	jmp    8022fb <strncasecmp+0x73>
+  8022f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8022fb:	48 83 c4 18          	add    $0x18,%rsp
+  8022ff:	5b                   	pop    %rbx
+  802300:	41 5c                	pop    %r12
+  802302:	41 5d                	pop    %r13
+  802304:	41 5e                	pop    %r14
+  802306:	41 5f                	pop    %r15
+  802308:	5d                   	pop    %rbp
+  802309:	c3                   	ret
+    if (p1 == p2) return 0;
+  80230a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80230f:	c3                   	ret
+
+0000000000802310 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802310:	83 e7 df             	and    $0xffffffdf,%edi
+  802313:	83 ef 41             	sub    $0x41,%edi
+  802316:	83 ff 19             	cmp    $0x19,%edi
+  802319:	0f 96 c0             	setbe  %al
+}
+  80231c:	c3                   	ret
+
+000000000080231d <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80231d:	83 ff 20             	cmp    $0x20,%edi
+  802320:	0f 94 c0             	sete   %al
+  802323:	83 ff 09             	cmp    $0x9,%edi
+  802326:	0f 94 c2             	sete   %dl
+  802329:	09 d0                	or     %edx,%eax
+}
+  80232b:	c3                   	ret
+
+000000000080232c <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80232c:	55                   	push   %rbp
+  80232d:	48 89 e5             	mov    %rsp,%rbp
+  802330:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802332:	48 bf df 63 80 00 00 	movabs $0x8063df,%rdi
+  802339:	00 00 00 
+  80233c:	48 b8 d1 21 80 00 00 	movabs $0x8021d1,%rax
+  802343:	00 00 00 
+  802346:	ff d0                	call   *%rax
+  802348:	48 85 c0             	test   %rax,%rax
+  80234b:	0f 95 c0             	setne  %al
+}
+  80234e:	5d                   	pop    %rbp
+  80234f:	c3                   	ret
+
+0000000000802350 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802350:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802353:	48 89 f8             	mov    %rdi,%rax
+  802356:	48 f7 d8             	neg    %rax
+  802359:	83 e0 07             	and    $0x7,%eax
+  80235c:	49 89 d1             	mov    %rdx,%r9
+  80235f:	49 29 c1             	sub    %rax,%r9
+  802362:	78 36                	js     80239a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802364:	40 0f b6 c6          	movzbl %sil,%eax
+  802368:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80236f:	01 01 01 
+  802372:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802376:	40 f6 c7 07          	test   $0x7,%dil
+  80237a:	75 38                	jne    8023b4 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80237c:	4c 89 c9             	mov    %r9,%rcx
+  80237f:	48 c1 f9 03          	sar    $0x3,%rcx
+  802383:	74 0c                	je     802391 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802385:	fc                   	cld
+  802386:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802389:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80238d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802391:	4d 85 c9             	test   %r9,%r9
+  802394:	75 45                	jne    8023db <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802396:	4c 89 c0             	mov    %r8,%rax
+  802399:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80239a:	48 85 d2             	test   %rdx,%rdx
+  80239d:	74 f7                	je     802396 <memset+0x46>
+  80239f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8023a2:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8023a5:	48 83 c0 01          	add    $0x1,%rax
+  8023a9:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8023ad:	48 39 c2             	cmp    %rax,%rdx
+  8023b0:	75 f3                	jne    8023a5 <memset+0x55>
+  8023b2:	eb e2                	jmp    802396 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8023b4:	40 f6 c7 01          	test   $0x1,%dil
+  8023b8:	74 06                	je     8023c0 <memset+0x70>
+  8023ba:	88 07                	mov    %al,(%rdi)
+  8023bc:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023c0:	40 f6 c7 02          	test   $0x2,%dil
+  8023c4:	74 07                	je     8023cd <memset+0x7d>
+  8023c6:	66 89 07             	mov    %ax,(%rdi)
+  8023c9:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023cd:	40 f6 c7 04          	test   $0x4,%dil
+  8023d1:	74 a9                	je     80237c <memset+0x2c>
+  8023d3:	89 07                	mov    %eax,(%rdi)
+  8023d5:	48 83 c7 04          	add    $0x4,%rdi
+  8023d9:	eb a1                	jmp    80237c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023db:	41 f6 c1 04          	test   $0x4,%r9b
+  8023df:	74 06                	je     8023e7 <memset+0x97>
+  8023e1:	89 07                	mov    %eax,(%rdi)
+  8023e3:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023e7:	41 f6 c1 02          	test   $0x2,%r9b
+  8023eb:	74 07                	je     8023f4 <memset+0xa4>
+  8023ed:	66 89 07             	mov    %ax,(%rdi)
+  8023f0:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8023f4:	41 f6 c1 01          	test   $0x1,%r9b
+  8023f8:	74 9c                	je     802396 <memset+0x46>
+  8023fa:	88 07                	mov    %al,(%rdi)
+  8023fc:	eb 98                	jmp    802396 <memset+0x46>
+
+00000000008023fe <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8023fe:	48 89 f8             	mov    %rdi,%rax
+  802401:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802404:	48 39 fe             	cmp    %rdi,%rsi
+  802407:	73 3b                	jae    802444 <memmove+0x46>
+  802409:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80240d:	48 39 d7             	cmp    %rdx,%rdi
+  802410:	73 32                	jae    802444 <memmove+0x46>
+        s += n;
+        d += n;
+  802412:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802416:	48 89 d6             	mov    %rdx,%rsi
+  802419:	48 09 fe             	or     %rdi,%rsi
+  80241c:	48 09 ce             	or     %rcx,%rsi
+  80241f:	40 f6 c6 07          	test   $0x7,%sil
+  802423:	75 12                	jne    802437 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802425:	48 83 ef 08          	sub    $0x8,%rdi
+  802429:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80242d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802431:	fd                   	std
+  802432:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802435:	fc                   	cld
+  802436:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802437:	48 83 ef 01          	sub    $0x1,%rdi
+  80243b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80243f:	fd                   	std
+  802440:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802442:	eb f1                	jmp    802435 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802444:	48 89 f2             	mov    %rsi,%rdx
+  802447:	48 09 c2             	or     %rax,%rdx
+  80244a:	48 09 ca             	or     %rcx,%rdx
+  80244d:	f6 c2 07             	test   $0x7,%dl
+  802450:	75 0c                	jne    80245e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802452:	48 c1 e9 03          	shr    $0x3,%rcx
+  802456:	48 89 c7             	mov    %rax,%rdi
+  802459:	fc                   	cld
+  80245a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80245d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80245e:	48 89 c7             	mov    %rax,%rdi
+  802461:	fc                   	cld
+  802462:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802464:	c3                   	ret
+
+0000000000802465 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802465:	55                   	push   %rbp
+  802466:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802469:	48 b8 fe 23 80 00 00 	movabs $0x8023fe,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+}
+  802475:	5d                   	pop    %rbp
+  802476:	c3                   	ret
+
+0000000000802477 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802477:	55                   	push   %rbp
+  802478:	48 89 e5             	mov    %rsp,%rbp
+  80247b:	41 57                	push   %r15
+  80247d:	41 56                	push   %r14
+  80247f:	41 55                	push   %r13
+  802481:	41 54                	push   %r12
+  802483:	53                   	push   %rbx
+  802484:	48 83 ec 08          	sub    $0x8,%rsp
+  802488:	49 89 fe             	mov    %rdi,%r14
+  80248b:	49 89 f7             	mov    %rsi,%r15
+  80248e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802491:	48 89 f7             	mov    %rsi,%rdi
+  802494:	48 b8 70 20 80 00 00 	movabs $0x802070,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+  8024a0:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8024a3:	48 89 de             	mov    %rbx,%rsi
+  8024a6:	4c 89 f7             	mov    %r14,%rdi
+  8024a9:	48 b8 8b 20 80 00 00 	movabs $0x80208b,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+  8024b5:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024b8:	48 39 c3             	cmp    %rax,%rbx
+  8024bb:	74 36                	je     8024f3 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8024bd:	48 89 d8             	mov    %rbx,%rax
+  8024c0:	4c 29 e8             	sub    %r13,%rax
+  8024c3:	49 39 c4             	cmp    %rax,%r12
+  8024c6:	73 31                	jae    8024f9 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8024c8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8024cd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024d1:	4c 89 fe             	mov    %r15,%rsi
+  8024d4:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8024e0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8024e4:	48 83 c4 08          	add    $0x8,%rsp
+  8024e8:	5b                   	pop    %rbx
+  8024e9:	41 5c                	pop    %r12
+  8024eb:	41 5d                	pop    %r13
+  8024ed:	41 5e                	pop    %r14
+  8024ef:	41 5f                	pop    %r15
+  8024f1:	5d                   	pop    %rbp
+  8024f2:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024f3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8024f7:	eb eb                	jmp    8024e4 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8024f9:	48 83 eb 01          	sub    $0x1,%rbx
+  8024fd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802501:	48 89 da             	mov    %rbx,%rdx
+  802504:	4c 89 fe             	mov    %r15,%rsi
+  802507:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802513:	49 01 de             	add    %rbx,%r14
+  802516:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80251b:	eb c3                	jmp    8024e0 <strlcat+0x69>
+
+000000000080251d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80251d:	48 85 d2             	test   %rdx,%rdx
+  802520:	74 2d                	je     80254f <memcmp+0x32>
+  802522:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802527:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80252b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802530:	44 38 c1             	cmp    %r8b,%cl
+  802533:	75 0f                	jne    802544 <memcmp+0x27>
+    while (n-- > 0) {
+  802535:	48 83 c0 01          	add    $0x1,%rax
+  802539:	48 39 c2             	cmp    %rax,%rdx
+  80253c:	75 e9                	jne    802527 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80253e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802543:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802544:	0f b6 c1             	movzbl %cl,%eax
+  802547:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80254b:	44 29 c0             	sub    %r8d,%eax
+  80254e:	c3                   	ret
+    return 0;
+  80254f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802554:	c3                   	ret
+
+0000000000802555 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802555:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802559:	48 39 c7             	cmp    %rax,%rdi
+  80255c:	73 0f                	jae    80256d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80255e:	40 38 37             	cmp    %sil,(%rdi)
+  802561:	74 0e                	je     802571 <memfind+0x1c>
+    for (; src < end; src++) {
+  802563:	48 83 c7 01          	add    $0x1,%rdi
+  802567:	48 39 f8             	cmp    %rdi,%rax
+  80256a:	75 f2                	jne    80255e <memfind+0x9>
+  80256c:	c3                   	ret
+  80256d:	48 89 f8             	mov    %rdi,%rax
+  802570:	c3                   	ret
+  802571:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802574:	c3                   	ret
+
+0000000000802575 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802575:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802578:	0f b6 37             	movzbl (%rdi),%esi
+  80257b:	40 80 fe 20          	cmp    $0x20,%sil
+  80257f:	74 06                	je     802587 <strtol+0x12>
+  802581:	40 80 fe 09          	cmp    $0x9,%sil
+  802585:	75 13                	jne    80259a <strtol+0x25>
+  802587:	48 83 c7 01          	add    $0x1,%rdi
+  80258b:	0f b6 37             	movzbl (%rdi),%esi
+  80258e:	40 80 fe 20          	cmp    $0x20,%sil
+  802592:	74 f3                	je     802587 <strtol+0x12>
+  802594:	40 80 fe 09          	cmp    $0x9,%sil
+  802598:	74 ed                	je     802587 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80259a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80259d:	83 e0 fd             	and    $0xfffffffd,%eax
+  8025a0:	3c 01                	cmp    $0x1,%al
+  8025a2:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025a6:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8025ac:	75 0f                	jne    8025bd <strtol+0x48>
+  8025ae:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8025b1:	74 14                	je     8025c7 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8025b3:	85 d2                	test   %edx,%edx
+  8025b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025ba:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8025bd:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8025c2:	4c 63 ca             	movslq %edx,%r9
+  8025c5:	eb 36                	jmp    8025fd <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025c7:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8025cb:	74 0f                	je     8025dc <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8025cd:	85 d2                	test   %edx,%edx
+  8025cf:	75 ec                	jne    8025bd <strtol+0x48>
+        s++;
+  8025d1:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8025d5:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8025da:	eb e1                	jmp    8025bd <strtol+0x48>
+        s += 2;
+  8025dc:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8025e0:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8025e5:	eb d6                	jmp    8025bd <strtol+0x48>
+            dig -= '0';
+  8025e7:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8025ea:	44 0f b6 c1          	movzbl %cl,%r8d
+  8025ee:	41 39 d0             	cmp    %edx,%r8d
+  8025f1:	7d 21                	jge    802614 <strtol+0x9f>
+        val = val * base + dig;
+  8025f3:	49 0f af c1          	imul   %r9,%rax
+  8025f7:	0f b6 c9             	movzbl %cl,%ecx
+  8025fa:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8025fd:	48 83 c7 01          	add    $0x1,%rdi
+  802601:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802605:	80 f9 39             	cmp    $0x39,%cl
+  802608:	76 dd                	jbe    8025e7 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80260a:	80 f9 7b             	cmp    $0x7b,%cl
+  80260d:	77 05                	ja     802614 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80260f:	83 e9 57             	sub    $0x57,%ecx
+  802612:	eb d6                	jmp    8025ea <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802614:	4d 85 d2             	test   %r10,%r10
+  802617:	74 03                	je     80261c <strtol+0xa7>
+  802619:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80261c:	48 89 c2             	mov    %rax,%rdx
+  80261f:	48 f7 da             	neg    %rdx
+  802622:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802626:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80262a:	c3                   	ret
+
+000000000080262b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	53                   	push   %rbx
+  802630:	48 89 fa             	mov    %rdi,%rdx
+  802633:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802636:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80263b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802640:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802645:	be 00 00 00 00       	mov    $0x0,%esi
+  80264a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802650:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802656:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802658:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80265c:	c9                   	leave
+  80265d:	c3                   	ret
+
+000000000080265e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80265e:	55                   	push   %rbp
+  80265f:	48 89 e5             	mov    %rsp,%rbp
+  802662:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802663:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802672:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802677:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80267c:	be 00 00 00 00       	mov    $0x0,%esi
+  802681:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802687:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80268d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80268f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802693:	c9                   	leave
+  802694:	c3                   	ret
+
+0000000000802695 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802695:	55                   	push   %rbp
+  802696:	48 89 e5             	mov    %rsp,%rbp
+  802699:	53                   	push   %rbx
+  80269a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80269d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026c2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8026c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026c8:	c9                   	leave
+  8026c9:	c3                   	ret
+
+00000000008026ca <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8026ca:	55                   	push   %rbp
+  8026cb:	48 89 e5             	mov    %rsp,%rbp
+  8026ce:	53                   	push   %rbx
+  8026cf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8026d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8026d6:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026db:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8026fd:	48 85 c0             	test   %rax,%rax
+  802700:	7f 06                	jg     802708 <sys_env_destroy+0x3e>
+}
+  802702:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802706:	c9                   	leave
+  802707:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802708:	49 89 c0             	mov    %rax,%r8
+  80270b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802710:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802717:	00 00 00 
+  80271a:	be 27 00 00 00       	mov    $0x27,%esi
+  80271f:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802726:	00 00 00 
+  802729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272e:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802735:	00 00 00 
+  802738:	41 ff d1             	call   *%r9
+
+000000000080273b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802740:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802745:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80274f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802754:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802759:	be 00 00 00 00       	mov    $0x0,%esi
+  80275e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802764:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80276a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80276c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802770:	c9                   	leave
+  802771:	c3                   	ret
+
+0000000000802772 <sys_yield>:
+
+void
+sys_yield(void) {
+  802772:	55                   	push   %rbp
+  802773:	48 89 e5             	mov    %rsp,%rbp
+  802776:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802777:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80277c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802781:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802786:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80278b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802790:	be 00 00 00 00       	mov    $0x0,%esi
+  802795:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80279b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027a1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027a7:	c9                   	leave
+  8027a8:	c3                   	ret
+
+00000000008027a9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8027a9:	55                   	push   %rbp
+  8027aa:	48 89 e5             	mov    %rsp,%rbp
+  8027ad:	53                   	push   %rbx
+  8027ae:	48 89 fa             	mov    %rdi,%rdx
+  8027b1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8027b4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027b9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027c0:	00 00 00 
+  8027c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8027cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8027db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+
+00000000008027e1 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8027e1:	55                   	push   %rbp
+  8027e2:	48 89 e5             	mov    %rsp,%rbp
+  8027e5:	53                   	push   %rbx
+  8027e6:	49 89 f8             	mov    %rdi,%r8
+  8027e9:	48 89 d3             	mov    %rdx,%rbx
+  8027ec:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8027ef:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027f4:	4c 89 c2             	mov    %r8,%rdx
+  8027f7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802805:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80280b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80280d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802811:	c9                   	leave
+  802812:	c3                   	ret
+
+0000000000802813 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802813:	55                   	push   %rbp
+  802814:	48 89 e5             	mov    %rsp,%rbp
+  802817:	53                   	push   %rbx
+  802818:	48 83 ec 08          	sub    $0x8,%rsp
+  80281c:	89 f8                	mov    %edi,%eax
+  80281e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802821:	48 63 f9             	movslq %ecx,%rdi
+  802824:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802827:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80282c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80282f:	be 00 00 00 00       	mov    $0x0,%esi
+  802834:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80283a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802840:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802842:	48 85 c0             	test   %rax,%rax
+  802845:	7f 06                	jg     80284d <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802847:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80284b:	c9                   	leave
+  80284c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80284d:	49 89 c0             	mov    %rax,%r8
+  802850:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802855:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  80285c:	00 00 00 
+  80285f:	be 27 00 00 00       	mov    $0x27,%esi
+  802864:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  80286b:	00 00 00 
+  80286e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802873:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  80287a:	00 00 00 
+  80287d:	41 ff d1             	call   *%r9
+
+0000000000802880 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802880:	55                   	push   %rbp
+  802881:	48 89 e5             	mov    %rsp,%rbp
+  802884:	53                   	push   %rbx
+  802885:	48 83 ec 08          	sub    $0x8,%rsp
+  802889:	89 f8                	mov    %edi,%eax
+  80288b:	49 89 f2             	mov    %rsi,%r10
+  80288e:	48 89 cf             	mov    %rcx,%rdi
+  802891:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802894:	48 63 da             	movslq %edx,%rbx
+  802897:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80289a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80289f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a2:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8028a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028ad:	48 85 c0             	test   %rax,%rax
+  8028b0:	7f 06                	jg     8028b8 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8028b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b6:	c9                   	leave
+  8028b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028b8:	49 89 c0             	mov    %rax,%r8
+  8028bb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8028c0:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  8028c7:	00 00 00 
+  8028ca:	be 27 00 00 00       	mov    $0x27,%esi
+  8028cf:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  8028d6:	00 00 00 
+  8028d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028de:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  8028e5:	00 00 00 
+  8028e8:	41 ff d1             	call   *%r9
+
+00000000008028eb <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8028eb:	55                   	push   %rbp
+  8028ec:	48 89 e5             	mov    %rsp,%rbp
+  8028ef:	53                   	push   %rbx
+  8028f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f4:	48 89 f1             	mov    %rsi,%rcx
+  8028f7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8028fa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028fd:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802902:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802907:	be 00 00 00 00       	mov    $0x0,%esi
+  80290c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802912:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802918:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80291a:	48 85 c0             	test   %rax,%rax
+  80291d:	7f 06                	jg     802925 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80291f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802925:	49 89 c0             	mov    %rax,%r8
+  802928:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80292d:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802934:	00 00 00 
+  802937:	be 27 00 00 00       	mov    $0x27,%esi
+  80293c:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802943:	00 00 00 
+  802946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294b:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802952:	00 00 00 
+  802955:	41 ff d1             	call   *%r9
+
+0000000000802958 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802958:	55                   	push   %rbp
+  802959:	48 89 e5             	mov    %rsp,%rbp
+  80295c:	53                   	push   %rbx
+  80295d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802961:	48 63 ce             	movslq %esi,%rcx
+  802964:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802967:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80296c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802971:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802976:	be 00 00 00 00       	mov    $0x0,%esi
+  80297b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802981:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802987:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802989:	48 85 c0             	test   %rax,%rax
+  80298c:	7f 06                	jg     802994 <sys_env_set_status+0x3c>
+}
+  80298e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802994:	49 89 c0             	mov    %rax,%r8
+  802997:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80299c:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  8029a3:	00 00 00 
+  8029a6:	be 27 00 00 00       	mov    $0x27,%esi
+  8029ab:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  8029b2:	00 00 00 
+  8029b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ba:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  8029c1:	00 00 00 
+  8029c4:	41 ff d1             	call   *%r9
+
+00000000008029c7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8029c7:	55                   	push   %rbp
+  8029c8:	48 89 e5             	mov    %rsp,%rbp
+  8029cb:	53                   	push   %rbx
+  8029cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8029d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029f8:	48 85 c0             	test   %rax,%rax
+  8029fb:	7f 06                	jg     802a03 <sys_env_set_trapframe+0x3c>
+}
+  8029fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a01:	c9                   	leave
+  802a02:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a03:	49 89 c0             	mov    %rax,%r8
+  802a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802a0b:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802a12:	00 00 00 
+  802a15:	be 27 00 00 00       	mov    $0x27,%esi
+  802a1a:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802a21:	00 00 00 
+  802a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a29:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802a30:	00 00 00 
+  802a33:	41 ff d1             	call   *%r9
+
+0000000000802a36 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802a36:	55                   	push   %rbp
+  802a37:	48 89 e5             	mov    %rsp,%rbp
+  802a3a:	53                   	push   %rbx
+  802a3b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a42:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a45:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a54:	be 00 00 00 00       	mov    $0x0,%esi
+  802a59:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a5f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a65:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a67:	48 85 c0             	test   %rax,%rax
+  802a6a:	7f 06                	jg     802a72 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802a6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a70:	c9                   	leave
+  802a71:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a72:	49 89 c0             	mov    %rax,%r8
+  802a75:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802a7a:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802a81:	00 00 00 
+  802a84:	be 27 00 00 00       	mov    $0x27,%esi
+  802a89:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802a90:	00 00 00 
+  802a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a98:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802a9f:	00 00 00 
+  802aa2:	41 ff d1             	call   *%r9
+
+0000000000802aa5 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802aa5:	55                   	push   %rbp
+  802aa6:	48 89 e5             	mov    %rsp,%rbp
+  802aa9:	53                   	push   %rbx
+  802aaa:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802aae:	40 0f b6 ce          	movzbl %sil,%ecx
+  802ab2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ab5:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802abf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802acf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ad7:	48 85 c0             	test   %rax,%rax
+  802ada:	7f 06                	jg     802ae2 <sys_env_set_reclaim+0x3d>
+}
+  802adc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ae0:	c9                   	leave
+  802ae1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ae2:	49 89 c0             	mov    %rax,%r8
+  802ae5:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802aea:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802af1:	00 00 00 
+  802af4:	be 27 00 00 00       	mov    $0x27,%esi
+  802af9:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802b00:	00 00 00 
+  802b03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b08:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802b0f:	00 00 00 
+  802b12:	41 ff d1             	call   *%r9
+
+0000000000802b15 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802b15:	55                   	push   %rbp
+  802b16:	48 89 e5             	mov    %rsp,%rbp
+  802b19:	53                   	push   %rbx
+  802b1a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802b1e:	48 63 ce             	movslq %esi,%rcx
+  802b21:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b24:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b2e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b33:	be 00 00 00 00       	mov    $0x0,%esi
+  802b38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b44:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b46:	48 85 c0             	test   %rax,%rax
+  802b49:	7f 06                	jg     802b51 <sys_env_set_nice+0x3c>
+}
+  802b4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4f:	c9                   	leave
+  802b50:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b51:	49 89 c0             	mov    %rax,%r8
+  802b54:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802b59:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802b60:	00 00 00 
+  802b63:	be 27 00 00 00       	mov    $0x27,%esi
+  802b68:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802b6f:	00 00 00 
+  802b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b77:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802b7e:	00 00 00 
+  802b81:	41 ff d1             	call   *%r9
+
+0000000000802b84 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802b84:	55                   	push   %rbp
+  802b85:	48 89 e5             	mov    %rsp,%rbp
+  802b88:	53                   	push   %rbx
+  802b89:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b8c:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b91:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b9b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ba0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bb1:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802bb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb7:	c9                   	leave
+  802bb8:	c3                   	ret
+
+0000000000802bb9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802bb9:	55                   	push   %rbp
+  802bba:	48 89 e5             	mov    %rsp,%rbp
+  802bbd:	53                   	push   %rbx
+  802bbe:	89 f8                	mov    %edi,%eax
+  802bc0:	49 89 f1             	mov    %rsi,%r9
+  802bc3:	48 89 d3             	mov    %rdx,%rbx
+  802bc6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bc9:	49 63 f0             	movslq %r8d,%rsi
+  802bcc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bcf:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bd4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bdd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802be3:	cd 30                	int    $0x30
+}
+  802be5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be9:	c9                   	leave
+  802bea:	c3                   	ret
+
+0000000000802beb <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802beb:	55                   	push   %rbp
+  802bec:	48 89 e5             	mov    %rsp,%rbp
+  802bef:	53                   	push   %rbx
+  802bf0:	89 f8                	mov    %edi,%eax
+  802bf2:	49 89 f1             	mov    %rsi,%r9
+  802bf5:	48 89 d3             	mov    %rdx,%rbx
+  802bf8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bfb:	49 63 f0             	movslq %r8d,%rsi
+  802bfe:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c01:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c06:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c15:	cd 30                	int    $0x30
+}
+  802c17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c1b:	c9                   	leave
+  802c1c:	c3                   	ret
+
+0000000000802c1d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c1d:	55                   	push   %rbp
+  802c1e:	48 89 e5             	mov    %rsp,%rbp
+  802c21:	53                   	push   %rbx
+  802c22:	48 83 ec 08          	sub    $0x8,%rsp
+  802c26:	89 f8                	mov    %edi,%eax
+  802c28:	49 89 f2             	mov    %rsi,%r10
+  802c2b:	48 89 d3             	mov    %rdx,%rbx
+  802c2e:	48 89 cf             	mov    %rcx,%rdi
+  802c31:	44 89 c6             	mov    %r8d,%esi
+  802c34:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c37:	48 63 f6             	movslq %esi,%rsi
+  802c3a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c3d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c42:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c45:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c49:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c4b:	48 85 c0             	test   %rax,%rax
+  802c4e:	7f 06                	jg     802c56 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c54:	c9                   	leave
+  802c55:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c56:	49 89 c0             	mov    %rax,%r8
+  802c59:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802c5e:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802c65:	00 00 00 
+  802c68:	be 27 00 00 00       	mov    $0x27,%esi
+  802c6d:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802c74:	00 00 00 
+  802c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7c:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802c83:	00 00 00 
+  802c86:	41 ff d1             	call   *%r9
+
+0000000000802c89 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802c89:	55                   	push   %rbp
+  802c8a:	48 89 e5             	mov    %rsp,%rbp
+  802c8d:	53                   	push   %rbx
+  802c8e:	48 83 ec 08          	sub    $0x8,%rsp
+  802c92:	48 89 f1             	mov    %rsi,%rcx
+  802c95:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802c98:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802c9c:	48 8b 1a             	mov    (%rdx),%rbx
+  802c9f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ca2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca7:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cab:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802caf:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802cb3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cb5:	48 85 c0             	test   %rax,%rax
+  802cb8:	7f 06                	jg     802cc0 <sys_ipc_call_short+0x37>
+}
+  802cba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cbe:	c9                   	leave
+  802cbf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cc0:	49 89 c0             	mov    %rax,%r8
+  802cc3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802cc8:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802ccf:	00 00 00 
+  802cd2:	be 27 00 00 00       	mov    $0x27,%esi
+  802cd7:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802cde:	00 00 00 
+  802ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce6:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802ced:	00 00 00 
+  802cf0:	41 ff d1             	call   *%r9
+
+0000000000802cf3 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802cf3:	55                   	push   %rbp
+  802cf4:	48 89 e5             	mov    %rsp,%rbp
+  802cf7:	53                   	push   %rbx
+  802cf8:	48 83 ec 08          	sub    $0x8,%rsp
+  802cfc:	89 f8                	mov    %edi,%eax
+  802cfe:	49 89 f2             	mov    %rsi,%r10
+  802d01:	48 89 d3             	mov    %rdx,%rbx
+  802d04:	48 89 cf             	mov    %rcx,%rdi
+  802d07:	44 89 c6             	mov    %r8d,%esi
+  802d0a:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d0d:	48 63 f6             	movslq %esi,%rsi
+  802d10:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d13:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d18:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d1b:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d1f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d21:	48 85 c0             	test   %rax,%rax
+  802d24:	7f 06                	jg     802d2c <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d2c:	49 89 c0             	mov    %rax,%r8
+  802d2f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802d34:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802d3b:	00 00 00 
+  802d3e:	be 27 00 00 00       	mov    $0x27,%esi
+  802d43:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802d4a:	00 00 00 
+  802d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d52:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802d59:	00 00 00 
+  802d5c:	41 ff d1             	call   *%r9
+
+0000000000802d5f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802d5f:	55                   	push   %rbp
+  802d60:	48 89 e5             	mov    %rsp,%rbp
+  802d63:	53                   	push   %rbx
+  802d64:	48 83 ec 08          	sub    $0x8,%rsp
+  802d68:	48 89 fa             	mov    %rdi,%rdx
+  802d6b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d8e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d90:	48 85 c0             	test   %rax,%rax
+  802d93:	7f 06                	jg     802d9b <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d99:	c9                   	leave
+  802d9a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d9b:	49 89 c0             	mov    %rax,%r8
+  802d9e:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802da3:	48 ba e8 63 80 00 00 	movabs $0x8063e8,%rdx
+  802daa:	00 00 00 
+  802dad:	be 27 00 00 00       	mov    $0x27,%esi
+  802db2:	48 bf 07 64 80 00 00 	movabs $0x806407,%rdi
+  802db9:	00 00 00 
+  802dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc1:	49 b9 17 53 80 00 00 	movabs $0x805317,%r9
+  802dc8:	00 00 00 
+  802dcb:	41 ff d1             	call   *%r9
+
+0000000000802dce <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802dce:	55                   	push   %rbp
+  802dcf:	48 89 e5             	mov    %rsp,%rbp
+  802dd2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802dd3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ddd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802de2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802de7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dec:	be 00 00 00 00       	mov    $0x0,%esi
+  802df1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802df7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dfd:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802dff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e03:	c9                   	leave
+  802e04:	c3                   	ret
+
+0000000000802e05 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802e05:	55                   	push   %rbp
+  802e06:	48 89 e5             	mov    %rsp,%rbp
+  802e09:	53                   	push   %rbx
+  802e0a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e0d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e12:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e1c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e21:	be 00 00 00 00       	mov    $0x0,%esi
+  802e26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e32:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802e34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e38:	c9                   	leave
+  802e39:	c3                   	ret
+
+0000000000802e3a <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802e3a:	55                   	push   %rbp
+  802e3b:	48 89 e5             	mov    %rsp,%rbp
+  802e3e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e3f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e49:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e53:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e58:	be 00 00 00 00       	mov    $0x0,%esi
+  802e5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e69:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e6f:	c9                   	leave
+  802e70:	c3                   	ret
+
+0000000000802e71 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802e71:	55                   	push   %rbp
+  802e72:	48 89 e5             	mov    %rsp,%rbp
+  802e75:	53                   	push   %rbx
+  802e76:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802e7a:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e7f:	cd 30                	int    $0x30
+  802e81:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  802e83:	85 c0                	test   %eax,%eax
+  802e85:	0f 88 85 00 00 00    	js     802f10 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  802e8b:	0f 84 ac 00 00 00    	je     802f3d <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  802e91:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802e97:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802e9e:	00 00 00 
+  802ea1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ea6:	89 c2                	mov    %eax,%edx
+  802ea8:	be 00 00 00 00       	mov    $0x0,%esi
+  802ead:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb2:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  802eb9:	00 00 00 
+  802ebc:	ff d0                	call   *%rax
+  802ebe:	85 c0                	test   %eax,%eax
+  802ec0:	0f 88 a8 00 00 00    	js     802f6e <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  802ec6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ecd:	00 00 00 
+  802ed0:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  802ed7:	89 df                	mov    %ebx,%edi
+  802ed9:	48 b8 36 2a 80 00 00 	movabs $0x802a36,%rax
+  802ee0:	00 00 00 
+  802ee3:	ff d0                	call   *%rax
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	0f 88 ae 00 00 00    	js     802f9b <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802eed:	be 02 00 00 00       	mov    $0x2,%esi
+  802ef2:	89 df                	mov    %ebx,%edi
+  802ef4:	48 b8 58 29 80 00 00 	movabs $0x802958,%rax
+  802efb:	00 00 00 
+  802efe:	ff d0                	call   *%rax
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	0f 88 c0 00 00 00    	js     802fc8 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  802f08:	89 d8                	mov    %ebx,%eax
+  802f0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f0e:	c9                   	leave
+  802f0f:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  802f10:	89 c1                	mov    %eax,%ecx
+  802f12:	48 ba 15 64 80 00 00 	movabs $0x806415,%rdx
+  802f19:	00 00 00 
+  802f1c:	be 20 00 00 00       	mov    $0x20,%esi
+  802f21:	48 bf 25 64 80 00 00 	movabs $0x806425,%rdi
+  802f28:	00 00 00 
+  802f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f30:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  802f37:	00 00 00 
+  802f3a:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802f3d:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  802f44:	00 00 00 
+  802f47:	ff d0                	call   *%rax
+  802f49:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f4e:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  802f55:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f5c:	00 00 00 
+  802f5f:	48 01 d0             	add    %rdx,%rax
+  802f62:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  802f69:	00 00 00 
+        return 0;
+  802f6c:	eb 9a                	jmp    802f08 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  802f6e:	89 c1                	mov    %eax,%ecx
+  802f70:	48 ba 30 64 80 00 00 	movabs $0x806430,%rdx
+  802f77:	00 00 00 
+  802f7a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f7f:	48 bf 25 64 80 00 00 	movabs $0x806425,%rdi
+  802f86:	00 00 00 
+  802f89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8e:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  802f95:	00 00 00 
+  802f98:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  802f9b:	89 c1                	mov    %eax,%ecx
+  802f9d:	48 ba 78 64 80 00 00 	movabs $0x806478,%rdx
+  802fa4:	00 00 00 
+  802fa7:	be 32 00 00 00       	mov    $0x32,%esi
+  802fac:	48 bf 25 64 80 00 00 	movabs $0x806425,%rdi
+  802fb3:	00 00 00 
+  802fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbb:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  802fc2:	00 00 00 
+  802fc5:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802fc8:	89 c1                	mov    %eax,%ecx
+  802fca:	48 ba 43 64 80 00 00 	movabs $0x806443,%rdx
+  802fd1:	00 00 00 
+  802fd4:	be 37 00 00 00       	mov    $0x37,%esi
+  802fd9:	48 bf 25 64 80 00 00 	movabs $0x806425,%rdi
+  802fe0:	00 00 00 
+  802fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe8:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  802fef:	00 00 00 
+  802ff2:	41 ff d0             	call   *%r8
+
+0000000000802ff5 <sfork>:
+
+envid_t
+sfork() {
+  802ff5:	55                   	push   %rbp
+  802ff6:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802ff9:	48 ba 5a 64 80 00 00 	movabs $0x80645a,%rdx
+  803000:	00 00 00 
+  803003:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803008:	48 bf 25 64 80 00 00 	movabs $0x806425,%rdi
+  80300f:	00 00 00 
+  803012:	b8 00 00 00 00       	mov    $0x0,%eax
+  803017:	48 b9 17 53 80 00 00 	movabs $0x805317,%rcx
+  80301e:	00 00 00 
+  803021:	ff d1                	call   *%rcx
+
+0000000000803023 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803023:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80302a:	ff ff ff 
+  80302d:	48 01 f8             	add    %rdi,%rax
+  803030:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803034:	c3                   	ret
+
+0000000000803035 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803035:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80303c:	ff ff ff 
+  80303f:	48 01 f8             	add    %rdi,%rax
+  803042:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803046:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80304c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803050:	c3                   	ret
+
+0000000000803051 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  803055:	41 57                	push   %r15
+  803057:	41 56                	push   %r14
+  803059:	41 55                	push   %r13
+  80305b:	41 54                	push   %r12
+  80305d:	53                   	push   %rbx
+  80305e:	48 83 ec 08          	sub    $0x8,%rsp
+  803062:	49 89 ff             	mov    %rdi,%r15
+  803065:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80306a:	49 bd 51 45 80 00 00 	movabs $0x804551,%r13
+  803071:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803074:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80307a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80307d:	48 89 df             	mov    %rbx,%rdi
+  803080:	41 ff d5             	call   *%r13
+  803083:	83 e0 04             	and    $0x4,%eax
+  803086:	74 17                	je     80309f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803088:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80308f:	4c 39 f3             	cmp    %r14,%rbx
+  803092:	75 e6                	jne    80307a <fd_alloc+0x29>
+  803094:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80309a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80309f:	4d 89 27             	mov    %r12,(%r15)
+}
+  8030a2:	48 83 c4 08          	add    $0x8,%rsp
+  8030a6:	5b                   	pop    %rbx
+  8030a7:	41 5c                	pop    %r12
+  8030a9:	41 5d                	pop    %r13
+  8030ab:	41 5e                	pop    %r14
+  8030ad:	41 5f                	pop    %r15
+  8030af:	5d                   	pop    %rbp
+  8030b0:	c3                   	ret
+
+00000000008030b1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8030b1:	83 ff 1f             	cmp    $0x1f,%edi
+  8030b4:	77 39                	ja     8030ef <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8030b6:	55                   	push   %rbp
+  8030b7:	48 89 e5             	mov    %rsp,%rbp
+  8030ba:	41 54                	push   %r12
+  8030bc:	53                   	push   %rbx
+  8030bd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8030c0:	48 63 df             	movslq %edi,%rbx
+  8030c3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8030ca:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8030ce:	48 89 df             	mov    %rbx,%rdi
+  8030d1:	48 b8 51 45 80 00 00 	movabs $0x804551,%rax
+  8030d8:	00 00 00 
+  8030db:	ff d0                	call   *%rax
+  8030dd:	a8 04                	test   $0x4,%al
+  8030df:	74 14                	je     8030f5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8030e1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8030e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ea:	5b                   	pop    %rbx
+  8030eb:	41 5c                	pop    %r12
+  8030ed:	5d                   	pop    %rbp
+  8030ee:	c3                   	ret
+        return -E_INVAL;
+  8030ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8030f4:	c3                   	ret
+        return -E_INVAL;
+  8030f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030fa:	eb ee                	jmp    8030ea <fd_lookup+0x39>
+
+00000000008030fc <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8030fc:	55                   	push   %rbp
+  8030fd:	48 89 e5             	mov    %rsp,%rbp
+  803100:	41 54                	push   %r12
+  803102:	53                   	push   %rbx
+  803103:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803106:	48 b8 20 65 80 00 00 	movabs $0x806520,%rax
+  80310d:	00 00 00 
+  803110:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803117:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80311a:	39 3b                	cmp    %edi,(%rbx)
+  80311c:	74 47                	je     803165 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80311e:	48 83 c0 08          	add    $0x8,%rax
+  803122:	48 8b 18             	mov    (%rax),%rbx
+  803125:	48 85 db             	test   %rbx,%rbx
+  803128:	75 f0                	jne    80311a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80312a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803131:	00 00 00 
+  803134:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80313a:	89 fa                	mov    %edi,%edx
+  80313c:	48 bf 98 64 80 00 00 	movabs $0x806498,%rdi
+  803143:	00 00 00 
+  803146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314b:	48 b9 77 17 80 00 00 	movabs $0x801777,%rcx
+  803152:	00 00 00 
+  803155:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803157:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80315c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803160:	5b                   	pop    %rbx
+  803161:	41 5c                	pop    %r12
+  803163:	5d                   	pop    %rbp
+  803164:	c3                   	ret
+            return 0;
+  803165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316a:	eb f0                	jmp    80315c <dev_lookup+0x60>
+
+000000000080316c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80316c:	55                   	push   %rbp
+  80316d:	48 89 e5             	mov    %rsp,%rbp
+  803170:	41 55                	push   %r13
+  803172:	41 54                	push   %r12
+  803174:	53                   	push   %rbx
+  803175:	48 83 ec 18          	sub    $0x18,%rsp
+  803179:	48 89 fb             	mov    %rdi,%rbx
+  80317c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80317f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803186:	ff ff ff 
+  803189:	48 01 df             	add    %rbx,%rdi
+  80318c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803190:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803194:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  80319b:	00 00 00 
+  80319e:	ff d0                	call   *%rax
+  8031a0:	41 89 c5             	mov    %eax,%r13d
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	78 06                	js     8031ad <fd_close+0x41>
+  8031a7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8031ab:	74 1a                	je     8031c7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8031ad:	45 84 e4             	test   %r12b,%r12b
+  8031b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8031b9:	44 89 e8             	mov    %r13d,%eax
+  8031bc:	48 83 c4 18          	add    $0x18,%rsp
+  8031c0:	5b                   	pop    %rbx
+  8031c1:	41 5c                	pop    %r12
+  8031c3:	41 5d                	pop    %r13
+  8031c5:	5d                   	pop    %rbp
+  8031c6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8031c7:	8b 3b                	mov    (%rbx),%edi
+  8031c9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8031cd:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  8031d4:	00 00 00 
+  8031d7:	ff d0                	call   *%rax
+  8031d9:	41 89 c5             	mov    %eax,%r13d
+  8031dc:	85 c0                	test   %eax,%eax
+  8031de:	78 1b                	js     8031fb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8031e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031e4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031e8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8031ee:	48 85 c0             	test   %rax,%rax
+  8031f1:	74 08                	je     8031fb <fd_close+0x8f>
+  8031f3:	48 89 df             	mov    %rbx,%rdi
+  8031f6:	ff d0                	call   *%rax
+  8031f8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8031fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803200:	48 89 de             	mov    %rbx,%rsi
+  803203:	bf 00 00 00 00       	mov    $0x0,%edi
+  803208:	48 b8 eb 28 80 00 00 	movabs $0x8028eb,%rax
+  80320f:	00 00 00 
+  803212:	ff d0                	call   *%rax
+    return res;
+  803214:	eb a3                	jmp    8031b9 <fd_close+0x4d>
+
+0000000000803216 <close>:
+
+int
+close(int fdnum) {
+  803216:	55                   	push   %rbp
+  803217:	48 89 e5             	mov    %rsp,%rbp
+  80321a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80321e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803222:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  803229:	00 00 00 
+  80322c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80322e:	85 c0                	test   %eax,%eax
+  803230:	78 15                	js     803247 <close+0x31>
+
+    return fd_close(fd, 1);
+  803232:	be 01 00 00 00       	mov    $0x1,%esi
+  803237:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80323b:	48 b8 6c 31 80 00 00 	movabs $0x80316c,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+}
+  803247:	c9                   	leave
+  803248:	c3                   	ret
+
+0000000000803249 <close_all>:
+
+void
+close_all(void) {
+  803249:	55                   	push   %rbp
+  80324a:	48 89 e5             	mov    %rsp,%rbp
+  80324d:	41 54                	push   %r12
+  80324f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803250:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803255:	49 bc 16 32 80 00 00 	movabs $0x803216,%r12
+  80325c:	00 00 00 
+  80325f:	89 df                	mov    %ebx,%edi
+  803261:	41 ff d4             	call   *%r12
+  803264:	83 c3 01             	add    $0x1,%ebx
+  803267:	83 fb 20             	cmp    $0x20,%ebx
+  80326a:	75 f3                	jne    80325f <close_all+0x16>
+}
+  80326c:	5b                   	pop    %rbx
+  80326d:	41 5c                	pop    %r12
+  80326f:	5d                   	pop    %rbp
+  803270:	c3                   	ret
+
+0000000000803271 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803271:	55                   	push   %rbp
+  803272:	48 89 e5             	mov    %rsp,%rbp
+  803275:	41 57                	push   %r15
+  803277:	41 56                	push   %r14
+  803279:	41 55                	push   %r13
+  80327b:	41 54                	push   %r12
+  80327d:	53                   	push   %rbx
+  80327e:	48 83 ec 18          	sub    $0x18,%rsp
+  803282:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803285:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803289:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  803290:	00 00 00 
+  803293:	ff d0                	call   *%rax
+  803295:	89 c3                	mov    %eax,%ebx
+  803297:	85 c0                	test   %eax,%eax
+  803299:	0f 88 b8 00 00 00    	js     803357 <dup+0xe6>
+    close(newfdnum);
+  80329f:	44 89 e7             	mov    %r12d,%edi
+  8032a2:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  8032a9:	00 00 00 
+  8032ac:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8032ae:	4d 63 ec             	movslq %r12d,%r13
+  8032b1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8032b8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8032bc:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8032c0:	4c 89 ff             	mov    %r15,%rdi
+  8032c3:	49 be 35 30 80 00 00 	movabs $0x803035,%r14
+  8032ca:	00 00 00 
+  8032cd:	41 ff d6             	call   *%r14
+  8032d0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8032d3:	4c 89 ef             	mov    %r13,%rdi
+  8032d6:	41 ff d6             	call   *%r14
+  8032d9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8032dc:	48 89 df             	mov    %rbx,%rdi
+  8032df:	48 b8 51 45 80 00 00 	movabs $0x804551,%rax
+  8032e6:	00 00 00 
+  8032e9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8032eb:	a8 04                	test   $0x4,%al
+  8032ed:	74 2b                	je     80331a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8032ef:	41 89 c1             	mov    %eax,%r9d
+  8032f2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032f8:	4c 89 f1             	mov    %r14,%rcx
+  8032fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803300:	48 89 de             	mov    %rbx,%rsi
+  803303:	bf 00 00 00 00       	mov    $0x0,%edi
+  803308:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  80330f:	00 00 00 
+  803312:	ff d0                	call   *%rax
+  803314:	89 c3                	mov    %eax,%ebx
+  803316:	85 c0                	test   %eax,%eax
+  803318:	78 4e                	js     803368 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80331a:	4c 89 ff             	mov    %r15,%rdi
+  80331d:	48 b8 51 45 80 00 00 	movabs $0x804551,%rax
+  803324:	00 00 00 
+  803327:	ff d0                	call   *%rax
+  803329:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80332c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803332:	4c 89 e9             	mov    %r13,%rcx
+  803335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80333a:	4c 89 fe             	mov    %r15,%rsi
+  80333d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803342:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  803349:	00 00 00 
+  80334c:	ff d0                	call   *%rax
+  80334e:	89 c3                	mov    %eax,%ebx
+  803350:	85 c0                	test   %eax,%eax
+  803352:	78 14                	js     803368 <dup+0xf7>
+
+    return newfdnum;
+  803354:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803357:	89 d8                	mov    %ebx,%eax
+  803359:	48 83 c4 18          	add    $0x18,%rsp
+  80335d:	5b                   	pop    %rbx
+  80335e:	41 5c                	pop    %r12
+  803360:	41 5d                	pop    %r13
+  803362:	41 5e                	pop    %r14
+  803364:	41 5f                	pop    %r15
+  803366:	5d                   	pop    %rbp
+  803367:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803368:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80336d:	4c 89 ee             	mov    %r13,%rsi
+  803370:	bf 00 00 00 00       	mov    $0x0,%edi
+  803375:	49 bc eb 28 80 00 00 	movabs $0x8028eb,%r12
+  80337c:	00 00 00 
+  80337f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803382:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803387:	4c 89 f6             	mov    %r14,%rsi
+  80338a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80338f:	41 ff d4             	call   *%r12
+    return res;
+  803392:	eb c3                	jmp    803357 <dup+0xe6>
+
+0000000000803394 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803394:	55                   	push   %rbp
+  803395:	48 89 e5             	mov    %rsp,%rbp
+  803398:	41 56                	push   %r14
+  80339a:	41 55                	push   %r13
+  80339c:	41 54                	push   %r12
+  80339e:	53                   	push   %rbx
+  80339f:	48 83 ec 10          	sub    $0x10,%rsp
+  8033a3:	89 fb                	mov    %edi,%ebx
+  8033a5:	49 89 f4             	mov    %rsi,%r12
+  8033a8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033af:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  8033b6:	00 00 00 
+  8033b9:	ff d0                	call   *%rax
+  8033bb:	85 c0                	test   %eax,%eax
+  8033bd:	78 4c                	js     80340b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033bf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8033c3:	41 8b 3e             	mov    (%r14),%edi
+  8033c6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033ca:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  8033d1:	00 00 00 
+  8033d4:	ff d0                	call   *%rax
+  8033d6:	85 c0                	test   %eax,%eax
+  8033d8:	78 35                	js     80340f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8033da:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8033de:	83 e0 03             	and    $0x3,%eax
+  8033e1:	83 f8 01             	cmp    $0x1,%eax
+  8033e4:	74 2d                	je     803413 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033ea:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8033ee:	48 85 c0             	test   %rax,%rax
+  8033f1:	74 56                	je     803449 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8033f3:	4c 89 ea             	mov    %r13,%rdx
+  8033f6:	4c 89 e6             	mov    %r12,%rsi
+  8033f9:	4c 89 f7             	mov    %r14,%rdi
+  8033fc:	ff d0                	call   *%rax
+}
+  8033fe:	48 83 c4 10          	add    $0x10,%rsp
+  803402:	5b                   	pop    %rbx
+  803403:	41 5c                	pop    %r12
+  803405:	41 5d                	pop    %r13
+  803407:	41 5e                	pop    %r14
+  803409:	5d                   	pop    %rbp
+  80340a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80340b:	48 98                	cltq
+  80340d:	eb ef                	jmp    8033fe <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80340f:	48 98                	cltq
+  803411:	eb eb                	jmp    8033fe <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803413:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80341a:	00 00 00 
+  80341d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803423:	89 da                	mov    %ebx,%edx
+  803425:	48 bf d9 64 80 00 00 	movabs $0x8064d9,%rdi
+  80342c:	00 00 00 
+  80342f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803434:	48 b9 77 17 80 00 00 	movabs $0x801777,%rcx
+  80343b:	00 00 00 
+  80343e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803440:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803447:	eb b5                	jmp    8033fe <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803449:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803450:	eb ac                	jmp    8033fe <read+0x6a>
+
+0000000000803452 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803452:	55                   	push   %rbp
+  803453:	48 89 e5             	mov    %rsp,%rbp
+  803456:	41 57                	push   %r15
+  803458:	41 56                	push   %r14
+  80345a:	41 55                	push   %r13
+  80345c:	41 54                	push   %r12
+  80345e:	53                   	push   %rbx
+  80345f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803463:	48 85 d2             	test   %rdx,%rdx
+  803466:	74 54                	je     8034bc <readn+0x6a>
+  803468:	41 89 fd             	mov    %edi,%r13d
+  80346b:	49 89 f6             	mov    %rsi,%r14
+  80346e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803471:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803476:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80347b:	49 bf 94 33 80 00 00 	movabs $0x803394,%r15
+  803482:	00 00 00 
+  803485:	4c 89 e2             	mov    %r12,%rdx
+  803488:	48 29 f2             	sub    %rsi,%rdx
+  80348b:	4c 01 f6             	add    %r14,%rsi
+  80348e:	44 89 ef             	mov    %r13d,%edi
+  803491:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803494:	85 c0                	test   %eax,%eax
+  803496:	78 20                	js     8034b8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803498:	01 c3                	add    %eax,%ebx
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	74 08                	je     8034a6 <readn+0x54>
+  80349e:	48 63 f3             	movslq %ebx,%rsi
+  8034a1:	4c 39 e6             	cmp    %r12,%rsi
+  8034a4:	72 df                	jb     803485 <readn+0x33>
+    }
+    return res;
+  8034a6:	48 63 c3             	movslq %ebx,%rax
+}
+  8034a9:	48 83 c4 08          	add    $0x8,%rsp
+  8034ad:	5b                   	pop    %rbx
+  8034ae:	41 5c                	pop    %r12
+  8034b0:	41 5d                	pop    %r13
+  8034b2:	41 5e                	pop    %r14
+  8034b4:	41 5f                	pop    %r15
+  8034b6:	5d                   	pop    %rbp
+  8034b7:	c3                   	ret
+        if (inc < 0) return inc;
+  8034b8:	48 98                	cltq
+  8034ba:	eb ed                	jmp    8034a9 <readn+0x57>
+    int inc = 1, res = 0;
+  8034bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034c1:	eb e3                	jmp    8034a6 <readn+0x54>
+
+00000000008034c3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8034c3:	55                   	push   %rbp
+  8034c4:	48 89 e5             	mov    %rsp,%rbp
+  8034c7:	41 56                	push   %r14
+  8034c9:	41 55                	push   %r13
+  8034cb:	41 54                	push   %r12
+  8034cd:	53                   	push   %rbx
+  8034ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8034d2:	89 fb                	mov    %edi,%ebx
+  8034d4:	49 89 f4             	mov    %rsi,%r12
+  8034d7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034da:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034de:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  8034e5:	00 00 00 
+  8034e8:	ff d0                	call   *%rax
+  8034ea:	85 c0                	test   %eax,%eax
+  8034ec:	78 47                	js     803535 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034ee:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8034f2:	41 8b 3e             	mov    (%r14),%edi
+  8034f5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034f9:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  803500:	00 00 00 
+  803503:	ff d0                	call   *%rax
+  803505:	85 c0                	test   %eax,%eax
+  803507:	78 30                	js     803539 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803509:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80350e:	74 2d                	je     80353d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803510:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803514:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803518:	48 85 c0             	test   %rax,%rax
+  80351b:	74 56                	je     803573 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80351d:	4c 89 ea             	mov    %r13,%rdx
+  803520:	4c 89 e6             	mov    %r12,%rsi
+  803523:	4c 89 f7             	mov    %r14,%rdi
+  803526:	ff d0                	call   *%rax
+}
+  803528:	48 83 c4 10          	add    $0x10,%rsp
+  80352c:	5b                   	pop    %rbx
+  80352d:	41 5c                	pop    %r12
+  80352f:	41 5d                	pop    %r13
+  803531:	41 5e                	pop    %r14
+  803533:	5d                   	pop    %rbp
+  803534:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803535:	48 98                	cltq
+  803537:	eb ef                	jmp    803528 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803539:	48 98                	cltq
+  80353b:	eb eb                	jmp    803528 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80353d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803544:	00 00 00 
+  803547:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80354d:	89 da                	mov    %ebx,%edx
+  80354f:	48 bf f5 64 80 00 00 	movabs $0x8064f5,%rdi
+  803556:	00 00 00 
+  803559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355e:	48 b9 77 17 80 00 00 	movabs $0x801777,%rcx
+  803565:	00 00 00 
+  803568:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80356a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803571:	eb b5                	jmp    803528 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803573:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80357a:	eb ac                	jmp    803528 <write+0x65>
+
+000000000080357c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80357c:	55                   	push   %rbp
+  80357d:	48 89 e5             	mov    %rsp,%rbp
+  803580:	53                   	push   %rbx
+  803581:	48 83 ec 18          	sub    $0x18,%rsp
+  803585:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803587:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80358b:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  803592:	00 00 00 
+  803595:	ff d0                	call   *%rax
+  803597:	85 c0                	test   %eax,%eax
+  803599:	78 0c                	js     8035a7 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80359b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80359f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8035a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035ab:	c9                   	leave
+  8035ac:	c3                   	ret
+
+00000000008035ad <tell>:
+
+int tell(int fdnum) {
+  8035ad:	55                   	push   %rbp
+  8035ae:	48 89 e5             	mov    %rsp,%rbp
+  8035b1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035b5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035b9:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  8035c0:	00 00 00 
+  8035c3:	ff d0                	call   *%rax
+  8035c5:	85 c0                	test   %eax,%eax
+  8035c7:	78 07                	js     8035d0 <tell+0x23>
+
+    return fd->fd_offset;
+  8035c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035cd:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8035d0:	c9                   	leave
+  8035d1:	c3                   	ret
+
+00000000008035d2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8035d2:	55                   	push   %rbp
+  8035d3:	48 89 e5             	mov    %rsp,%rbp
+  8035d6:	41 55                	push   %r13
+  8035d8:	41 54                	push   %r12
+  8035da:	53                   	push   %rbx
+  8035db:	48 83 ec 18          	sub    $0x18,%rsp
+  8035df:	89 fb                	mov    %edi,%ebx
+  8035e1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035e4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035e8:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  8035ef:	00 00 00 
+  8035f2:	ff d0                	call   *%rax
+  8035f4:	85 c0                	test   %eax,%eax
+  8035f6:	78 38                	js     803630 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035f8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8035fc:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803600:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803604:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  80360b:	00 00 00 
+  80360e:	ff d0                	call   *%rax
+  803610:	85 c0                	test   %eax,%eax
+  803612:	78 1c                	js     803630 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803614:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803619:	74 20                	je     80363b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80361b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80361f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803623:	48 85 c0             	test   %rax,%rax
+  803626:	74 47                	je     80366f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803628:	44 89 e6             	mov    %r12d,%esi
+  80362b:	4c 89 ef             	mov    %r13,%rdi
+  80362e:	ff d0                	call   *%rax
+}
+  803630:	48 83 c4 18          	add    $0x18,%rsp
+  803634:	5b                   	pop    %rbx
+  803635:	41 5c                	pop    %r12
+  803637:	41 5d                	pop    %r13
+  803639:	5d                   	pop    %rbp
+  80363a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80363b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803642:	00 00 00 
+  803645:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80364b:	89 da                	mov    %ebx,%edx
+  80364d:	48 bf b8 64 80 00 00 	movabs $0x8064b8,%rdi
+  803654:	00 00 00 
+  803657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365c:	48 b9 77 17 80 00 00 	movabs $0x801777,%rcx
+  803663:	00 00 00 
+  803666:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803668:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80366d:	eb c1                	jmp    803630 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80366f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803674:	eb ba                	jmp    803630 <ftruncate+0x5e>
+
+0000000000803676 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	41 54                	push   %r12
+  80367c:	53                   	push   %rbx
+  80367d:	48 83 ec 10          	sub    $0x10,%rsp
+  803681:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803684:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803688:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  80368f:	00 00 00 
+  803692:	ff d0                	call   *%rax
+  803694:	85 c0                	test   %eax,%eax
+  803696:	78 63                	js     8036fb <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803698:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80369c:	41 8b 3c 24          	mov    (%r12),%edi
+  8036a0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8036a4:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	78 47                	js     8036fb <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8036b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036b8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8036bd:	74 45                	je     803704 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8036bf:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8036c2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8036c9:	00 00 00 
+    stat->st_isdir = 0;
+  8036cc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036d3:	00 00 00 
+    stat->st_ino = 0;
+  8036d6:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8036dd:	00 00 00 00 
+    stat->st_version = 0;
+  8036e1:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8036e8:	00 00 00 
+    stat->st_dev = dev;
+  8036eb:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8036f2:	48 89 de             	mov    %rbx,%rsi
+  8036f5:	4c 89 e7             	mov    %r12,%rdi
+  8036f8:	ff 50 28             	call   *0x28(%rax)
+}
+  8036fb:	48 83 c4 10          	add    $0x10,%rsp
+  8036ff:	5b                   	pop    %rbx
+  803700:	41 5c                	pop    %r12
+  803702:	5d                   	pop    %rbp
+  803703:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803704:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803709:	eb f0                	jmp    8036fb <fstat+0x85>
+
+000000000080370b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80370b:	55                   	push   %rbp
+  80370c:	48 89 e5             	mov    %rsp,%rbp
+  80370f:	41 54                	push   %r12
+  803711:	53                   	push   %rbx
+  803712:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803715:	be 00 00 00 00       	mov    $0x0,%esi
+  80371a:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  803721:	00 00 00 
+  803724:	ff d0                	call   *%rax
+  803726:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803728:	85 c0                	test   %eax,%eax
+  80372a:	78 25                	js     803751 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80372c:	4c 89 e6             	mov    %r12,%rsi
+  80372f:	89 c7                	mov    %eax,%edi
+  803731:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803738:	00 00 00 
+  80373b:	ff d0                	call   *%rax
+  80373d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803740:	89 df                	mov    %ebx,%edi
+  803742:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  803749:	00 00 00 
+  80374c:	ff d0                	call   *%rax
+
+    return res;
+  80374e:	44 89 e3             	mov    %r12d,%ebx
+}
+  803751:	89 d8                	mov    %ebx,%eax
+  803753:	5b                   	pop    %rbx
+  803754:	41 5c                	pop    %r12
+  803756:	5d                   	pop    %rbp
+  803757:	c3                   	ret
+
+0000000000803758 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803758:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80375f:	00 00 00 
+  803762:	83 38 00             	cmpl   $0x0,(%rax)
+  803765:	74 0a                	je     803771 <fsipc_env+0x19>
+    return fsenv;
+}
+  803767:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80376e:	00 00 
+  803770:	c3                   	ret
+fsipc_env(void) {
+  803771:	55                   	push   %rbp
+  803772:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803775:	bf 03 00 00 00       	mov    $0x3,%edi
+  80377a:	48 b8 fe 58 80 00 00 	movabs $0x8058fe,%rax
+  803781:	00 00 00 
+  803784:	ff d0                	call   *%rax
+  803786:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80378d:	00 00 
+}
+  80378f:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803796:	00 00 
+  803798:	5d                   	pop    %rbp
+  803799:	c3                   	ret
+
+000000000080379a <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80379a:	55                   	push   %rbp
+  80379b:	48 89 e5             	mov    %rsp,%rbp
+  80379e:	53                   	push   %rbx
+  80379f:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8037a3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8037aa:	00 
+  8037ab:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8037b2:	00 
+  8037b3:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8037ba:	00 
+  8037bb:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8037c2:	00 
+  8037c3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8037ca:	00 
+
+    assert(size <= sizeof(words));
+  8037cb:	48 83 fa 28          	cmp    $0x28,%rdx
+  8037cf:	77 38                	ja     803809 <fsipc_short+0x6f>
+  8037d1:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8037d3:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8037d7:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  8037de:	00 00 00 
+  8037e1:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8037e3:	48 b8 58 37 80 00 00 	movabs $0x803758,%rax
+  8037ea:	00 00 00 
+  8037ed:	ff d0                	call   *%rax
+  8037ef:	89 c7                	mov    %eax,%edi
+  8037f1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8037f5:	89 de                	mov    %ebx,%esi
+  8037f7:	48 b8 61 58 80 00 00 	movabs $0x805861,%rax
+  8037fe:	00 00 00 
+  803801:	ff d0                	call   *%rax
+}
+  803803:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803807:	c9                   	leave
+  803808:	c3                   	ret
+    assert(size <= sizeof(words));
+  803809:	48 b9 40 65 80 00 00 	movabs $0x806540,%rcx
+  803810:	00 00 00 
+  803813:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  80381a:	00 00 00 
+  80381d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803822:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803829:	00 00 00 
+  80382c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803831:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  803838:	00 00 00 
+  80383b:	41 ff d0             	call   *%r8
+
+000000000080383e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80383e:	55                   	push   %rbp
+  80383f:	48 89 e5             	mov    %rsp,%rbp
+  803842:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803846:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803849:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80384c:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  80384f:	ba 08 00 00 00       	mov    $0x8,%edx
+  803854:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803858:	bf 02 00 00 00       	mov    $0x2,%edi
+  80385d:	48 b8 9a 37 80 00 00 	movabs $0x80379a,%rax
+  803864:	00 00 00 
+  803867:	ff d0                	call   *%rax
+}
+  803869:	c9                   	leave
+  80386a:	c3                   	ret
+
+000000000080386b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80386b:	55                   	push   %rbp
+  80386c:	48 89 e5             	mov    %rsp,%rbp
+  80386f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803873:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803876:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803879:	ba 04 00 00 00       	mov    $0x4,%edx
+  80387e:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803882:	bf 06 00 00 00       	mov    $0x6,%edi
+  803887:	48 b8 9a 37 80 00 00 	movabs $0x80379a,%rax
+  80388e:	00 00 00 
+  803891:	ff d0                	call   *%rax
+}
+  803893:	c9                   	leave
+  803894:	c3                   	ret
+
+0000000000803895 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803895:	55                   	push   %rbp
+  803896:	48 89 e5             	mov    %rsp,%rbp
+  803899:	41 54                	push   %r12
+  80389b:	53                   	push   %rbx
+  80389c:	48 83 ec 10          	sub    $0x10,%rsp
+  8038a0:	89 fb                	mov    %edi,%ebx
+  8038a2:	49 89 f4             	mov    %rsi,%r12
+  8038a5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8038a9:	48 b8 58 37 80 00 00 	movabs $0x803758,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+  8038b5:	89 c7                	mov    %eax,%edi
+  8038b7:	6a 00                	push   $0x0
+  8038b9:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8038bd:	50                   	push   %rax
+  8038be:	4d 89 e1             	mov    %r12,%r9
+  8038c1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8038c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038cc:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  8038d3:	00 00 00 
+  8038d6:	89 de                	mov    %ebx,%esi
+  8038d8:	48 b8 fc 57 80 00 00 	movabs $0x8057fc,%rax
+  8038df:	00 00 00 
+  8038e2:	ff d0                	call   *%rax
+}
+  8038e4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8038e8:	5b                   	pop    %rbx
+  8038e9:	41 5c                	pop    %r12
+  8038eb:	5d                   	pop    %rbp
+  8038ec:	c3                   	ret
+
+00000000008038ed <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8038ed:	55                   	push   %rbp
+  8038ee:	48 89 e5             	mov    %rsp,%rbp
+  8038f1:	41 54                	push   %r12
+  8038f3:	53                   	push   %rbx
+  8038f4:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8038f7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8038fa:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803901:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803903:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803908:	be 00 00 00 00       	mov    $0x0,%esi
+  80390d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803912:	48 b8 95 38 80 00 00 	movabs $0x803895,%rax
+  803919:	00 00 00 
+  80391c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80391e:	85 c0                	test   %eax,%eax
+  803920:	78 5a                	js     80397c <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803922:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803929:	00 00 00 
+  80392c:	4c 89 e6             	mov    %r12,%rsi
+  80392f:	48 89 df             	mov    %rbx,%rdi
+  803932:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  803939:	00 00 00 
+  80393c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80393e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803945:	00 
+  803946:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80394c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803953:	00 
+  803954:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  80395a:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803961:	00 
+  803962:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803969:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803970:	00 
+  803971:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803977:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80397c:	5b                   	pop    %rbx
+  80397d:	41 5c                	pop    %r12
+  80397f:	5d                   	pop    %rbp
+  803980:	c3                   	ret
+
+0000000000803981 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803981:	55                   	push   %rbp
+  803982:	48 89 e5             	mov    %rsp,%rbp
+  803985:	41 57                	push   %r15
+  803987:	41 56                	push   %r14
+  803989:	41 55                	push   %r13
+  80398b:	41 54                	push   %r12
+  80398d:	53                   	push   %rbx
+  80398e:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803992:	48 85 ff             	test   %rdi,%rdi
+  803995:	0f 84 a1 00 00 00    	je     803a3c <devfile_read+0xbb>
+  80399b:	49 89 ff             	mov    %rdi,%r15
+  80399e:	49 89 f5             	mov    %rsi,%r13
+  8039a1:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8039a4:	48 85 f6             	test   %rsi,%rsi
+  8039a7:	0f 84 c4 00 00 00    	je     803a71 <devfile_read+0xf0>
+    size_t total_read = 0;
+  8039ad:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8039b4:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8039b5:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8039bc:	00 00 00 
+  8039bf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8039c3:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8039c6:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8039d4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039d9:	48 b8 95 38 80 00 00 	movabs $0x803895,%rax
+  8039e0:	00 00 00 
+  8039e3:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039e5:	85 c0                	test   %eax,%eax
+  8039e7:	0f 88 b9 00 00 00    	js     803aa6 <devfile_read+0x125>
+        assert(res <= n);
+  8039ed:	48 63 d8             	movslq %eax,%rbx
+  8039f0:	49 39 dc             	cmp    %rbx,%r12
+  8039f3:	0f 82 b1 00 00 00    	jb     803aaa <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8039f9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8039fe:	0f 87 db 00 00 00    	ja     803adf <devfile_read+0x15e>
+        if (!res) {
+  803a04:	85 c0                	test   %eax,%eax
+  803a06:	74 21                	je     803a29 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803a08:	48 89 da             	mov    %rbx,%rdx
+  803a0b:	4c 89 f6             	mov    %r14,%rsi
+  803a0e:	4c 89 ef             	mov    %r13,%rdi
+  803a11:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  803a18:	00 00 00 
+  803a1b:	ff d0                	call   *%rax
+        total_read += res;
+  803a1d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803a21:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803a24:	49 29 dc             	sub    %rbx,%r12
+  803a27:	75 96                	jne    8039bf <devfile_read+0x3e>
+    return total_read;
+  803a29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803a2d:	48 83 c4 18          	add    $0x18,%rsp
+  803a31:	5b                   	pop    %rbx
+  803a32:	41 5c                	pop    %r12
+  803a34:	41 5d                	pop    %r13
+  803a36:	41 5e                	pop    %r14
+  803a38:	41 5f                	pop    %r15
+  803a3a:	5d                   	pop    %rbp
+  803a3b:	c3                   	ret
+    assert(fd);
+  803a3c:	48 b9 76 65 80 00 00 	movabs $0x806576,%rcx
+  803a43:	00 00 00 
+  803a46:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803a4d:	00 00 00 
+  803a50:	be 91 00 00 00       	mov    $0x91,%esi
+  803a55:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803a5c:	00 00 00 
+  803a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a64:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  803a6b:	00 00 00 
+  803a6e:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a71:	48 b9 79 65 80 00 00 	movabs $0x806579,%rcx
+  803a78:	00 00 00 
+  803a7b:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803a82:	00 00 00 
+  803a85:	be 92 00 00 00       	mov    $0x92,%esi
+  803a8a:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803a91:	00 00 00 
+  803a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a99:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  803aa0:	00 00 00 
+  803aa3:	41 ff d0             	call   *%r8
+            return res;
+  803aa6:	48 98                	cltq
+  803aa8:	eb 83                	jmp    803a2d <devfile_read+0xac>
+        assert(res <= n);
+  803aaa:	48 b9 7d 65 80 00 00 	movabs $0x80657d,%rcx
+  803ab1:	00 00 00 
+  803ab4:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803abb:	00 00 00 
+  803abe:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803ac3:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803aca:	00 00 00 
+  803acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad2:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  803ad9:	00 00 00 
+  803adc:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803adf:	48 b9 88 65 80 00 00 	movabs $0x806588,%rcx
+  803ae6:	00 00 00 
+  803ae9:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803af0:	00 00 00 
+  803af3:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803af8:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803aff:	00 00 00 
+  803b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b07:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  803b0e:	00 00 00 
+  803b11:	41 ff d0             	call   *%r8
+
+0000000000803b14 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803b14:	55                   	push   %rbp
+  803b15:	48 89 e5             	mov    %rsp,%rbp
+  803b18:	41 57                	push   %r15
+  803b1a:	41 56                	push   %r14
+  803b1c:	41 55                	push   %r13
+  803b1e:	41 54                	push   %r12
+  803b20:	53                   	push   %rbx
+  803b21:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803b25:	48 85 ff             	test   %rdi,%rdi
+  803b28:	0f 84 83 00 00 00    	je     803bb1 <devfile_write+0x9d>
+  803b2e:	49 89 ff             	mov    %rdi,%r15
+  803b31:	49 89 f4             	mov    %rsi,%r12
+  803b34:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803b37:	48 85 f6             	test   %rsi,%rsi
+  803b3a:	0f 84 a6 00 00 00    	je     803be6 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803b40:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803b46:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803b4d:	00 00 00 
+  803b50:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803b54:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803b57:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803b5b:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803b60:	48 39 d3             	cmp    %rdx,%rbx
+  803b63:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803b67:	4c 89 e6             	mov    %r12,%rsi
+  803b6a:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803b71:	00 00 00 
+  803b74:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  803b7b:	00 00 00 
+  803b7e:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b85:	be 00 00 00 00       	mov    $0x0,%esi
+  803b8a:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b8f:	48 b8 95 38 80 00 00 	movabs $0x803895,%rax
+  803b96:	00 00 00 
+  803b99:	ff d0                	call   *%rax
+        if (res < 0) {
+  803b9b:	85 c0                	test   %eax,%eax
+  803b9d:	78 7c                	js     803c1b <devfile_write+0x107>
+        total_written += res;
+  803b9f:	48 98                	cltq
+  803ba1:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803ba4:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803ba7:	48 29 c3             	sub    %rax,%rbx
+  803baa:	75 a4                	jne    803b50 <devfile_write+0x3c>
+    return total_written;
+  803bac:	4c 89 e8             	mov    %r13,%rax
+  803baf:	eb 6c                	jmp    803c1d <devfile_write+0x109>
+    assert(fd);
+  803bb1:	48 b9 76 65 80 00 00 	movabs $0x806576,%rcx
+  803bb8:	00 00 00 
+  803bbb:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803bc2:	00 00 00 
+  803bc5:	be bd 00 00 00       	mov    $0xbd,%esi
+  803bca:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803bd1:	00 00 00 
+  803bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd9:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  803be0:	00 00 00 
+  803be3:	41 ff d0             	call   *%r8
+    assert(buf);
+  803be6:	48 b9 79 65 80 00 00 	movabs $0x806579,%rcx
+  803bed:	00 00 00 
+  803bf0:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803bf7:	00 00 00 
+  803bfa:	be be 00 00 00       	mov    $0xbe,%esi
+  803bff:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803c06:	00 00 00 
+  803c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c0e:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  803c15:	00 00 00 
+  803c18:	41 ff d0             	call   *%r8
+            return res;
+  803c1b:	48 98                	cltq
+}
+  803c1d:	48 83 c4 08          	add    $0x8,%rsp
+  803c21:	5b                   	pop    %rbx
+  803c22:	41 5c                	pop    %r12
+  803c24:	41 5d                	pop    %r13
+  803c26:	41 5e                	pop    %r14
+  803c28:	41 5f                	pop    %r15
+  803c2a:	5d                   	pop    %rbp
+  803c2b:	c3                   	ret
+
+0000000000803c2c <open>:
+open(const char *path, int mode) {
+  803c2c:	55                   	push   %rbp
+  803c2d:	48 89 e5             	mov    %rsp,%rbp
+  803c30:	41 55                	push   %r13
+  803c32:	41 54                	push   %r12
+  803c34:	53                   	push   %rbx
+  803c35:	48 83 ec 18          	sub    $0x18,%rsp
+  803c39:	49 89 fc             	mov    %rdi,%r12
+  803c3c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803c3f:	48 b8 70 20 80 00 00 	movabs $0x802070,%rax
+  803c46:	00 00 00 
+  803c49:	ff d0                	call   *%rax
+  803c4b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803c51:	0f 87 8f 00 00 00    	ja     803ce6 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803c57:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c5b:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  803c62:	00 00 00 
+  803c65:	ff d0                	call   *%rax
+  803c67:	89 c3                	mov    %eax,%ebx
+  803c69:	85 c0                	test   %eax,%eax
+  803c6b:	78 55                	js     803cc2 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803c6d:	4c 89 e6             	mov    %r12,%rsi
+  803c70:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803c77:	00 00 00 
+  803c7a:	48 89 df             	mov    %rbx,%rdi
+  803c7d:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  803c84:	00 00 00 
+  803c87:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803c89:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c95:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c99:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c9e:	48 b8 95 38 80 00 00 	movabs $0x803895,%rax
+  803ca5:	00 00 00 
+  803ca8:	ff d0                	call   *%rax
+  803caa:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803cac:	85 c0                	test   %eax,%eax
+  803cae:	78 1f                	js     803ccf <open+0xa3>
+    return fd2num(fd);
+  803cb0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cb4:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  803cbb:	00 00 00 
+  803cbe:	ff d0                	call   *%rax
+  803cc0:	89 c3                	mov    %eax,%ebx
+}
+  803cc2:	89 d8                	mov    %ebx,%eax
+  803cc4:	48 83 c4 18          	add    $0x18,%rsp
+  803cc8:	5b                   	pop    %rbx
+  803cc9:	41 5c                	pop    %r12
+  803ccb:	41 5d                	pop    %r13
+  803ccd:	5d                   	pop    %rbp
+  803cce:	c3                   	ret
+        fd_close(fd, 0);
+  803ccf:	be 00 00 00 00       	mov    $0x0,%esi
+  803cd4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cd8:	48 b8 6c 31 80 00 00 	movabs $0x80316c,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+        return res;
+  803ce4:	eb dc                	jmp    803cc2 <open+0x96>
+        return -E_BAD_PATH;
+  803ce6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803ceb:	eb d5                	jmp    803cc2 <open+0x96>
+
+0000000000803ced <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803ced:	55                   	push   %rbp
+  803cee:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803cf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cf6:	be 00 00 00 00       	mov    $0x0,%esi
+  803cfb:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d00:	48 b8 9a 37 80 00 00 	movabs $0x80379a,%rax
+  803d07:	00 00 00 
+  803d0a:	ff d0                	call   *%rax
+}
+  803d0c:	5d                   	pop    %rbp
+  803d0d:	c3                   	ret
+
+0000000000803d0e <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803d0e:	55                   	push   %rbp
+  803d0f:	48 89 e5             	mov    %rsp,%rbp
+  803d12:	41 56                	push   %r14
+  803d14:	41 55                	push   %r13
+  803d16:	41 54                	push   %r12
+  803d18:	53                   	push   %rbx
+  803d19:	48 83 ec 10          	sub    $0x10,%rsp
+  803d1d:	41 89 f6             	mov    %esi,%r14d
+  803d20:	49 89 d4             	mov    %rdx,%r12
+  803d23:	48 89 cb             	mov    %rcx,%rbx
+  803d26:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d2d:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  803d34:	00 00 00 
+  803d37:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d39:	85 c0                	test   %eax,%eax
+  803d3b:	78 46                	js     803d83 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d3d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d41:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803d48:	00 00 00 
+  803d4b:	8b 00                	mov    (%rax),%eax
+  803d4d:	39 02                	cmp    %eax,(%rdx)
+  803d4f:	75 3f                	jne    803d90 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803d51:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803d58:	00 00 00 
+  803d5b:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803d5e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803d60:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803d64:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803d68:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803d6c:	48 89 da             	mov    %rbx,%rdx
+  803d6f:	4c 89 e6             	mov    %r12,%rsi
+  803d72:	bf 09 00 00 00       	mov    $0x9,%edi
+  803d77:	48 b8 95 38 80 00 00 	movabs $0x803895,%rax
+  803d7e:	00 00 00 
+  803d81:	ff d0                	call   *%rax
+}
+  803d83:	48 83 c4 10          	add    $0x10,%rsp
+  803d87:	5b                   	pop    %rbx
+  803d88:	41 5c                	pop    %r12
+  803d8a:	41 5d                	pop    %r13
+  803d8c:	41 5e                	pop    %r14
+  803d8e:	5d                   	pop    %rbp
+  803d8f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d90:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d95:	eb ec                	jmp    803d83 <file_map+0x75>
+
+0000000000803d97 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803d97:	55                   	push   %rbp
+  803d98:	48 89 e5             	mov    %rsp,%rbp
+  803d9b:	41 54                	push   %r12
+  803d9d:	53                   	push   %rbx
+  803d9e:	48 83 ec 20          	sub    $0x20,%rsp
+  803da2:	41 89 f4             	mov    %esi,%r12d
+  803da5:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803da8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803dac:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  803db3:	00 00 00 
+  803db6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803db8:	85 c0                	test   %eax,%eax
+  803dba:	78 3c                	js     803df8 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803dbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dc0:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803dc7:	00 00 00 
+  803dca:	8b 0a                	mov    (%rdx),%ecx
+  803dcc:	39 08                	cmp    %ecx,(%rax)
+  803dce:	75 31                	jne    803e01 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803dd0:	8b 40 0c             	mov    0xc(%rax),%eax
+  803dd3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803dd6:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803dda:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803dde:	ba 10 00 00 00       	mov    $0x10,%edx
+  803de3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803de7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803dec:	48 b8 9a 37 80 00 00 	movabs $0x80379a,%rax
+  803df3:	00 00 00 
+  803df6:	ff d0                	call   *%rax
+}
+  803df8:	48 83 c4 20          	add    $0x20,%rsp
+  803dfc:	5b                   	pop    %rbx
+  803dfd:	41 5c                	pop    %r12
+  803dff:	5d                   	pop    %rbp
+  803e00:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e01:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e06:	eb f0                	jmp    803df8 <file_msync+0x61>
+
+0000000000803e08 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803e08:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803e0c:	7f 01                	jg     803e0f <writebuf+0x7>
+  803e0e:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803e0f:	55                   	push   %rbp
+  803e10:	48 89 e5             	mov    %rsp,%rbp
+  803e13:	53                   	push   %rbx
+  803e14:	48 83 ec 08          	sub    $0x8,%rsp
+  803e18:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803e1b:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803e1f:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803e23:	8b 3f                	mov    (%rdi),%edi
+  803e25:	48 b8 c3 34 80 00 00 	movabs $0x8034c3,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803e31:	48 85 c0             	test   %rax,%rax
+  803e34:	7e 04                	jle    803e3a <writebuf+0x32>
+  803e36:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803e3a:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803e3e:	48 39 c2             	cmp    %rax,%rdx
+  803e41:	74 0f                	je     803e52 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803e43:	48 85 c0             	test   %rax,%rax
+  803e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e4b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803e4f:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803e52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e56:	c9                   	leave
+  803e57:	c3                   	ret
+
+0000000000803e58 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803e58:	8b 46 04             	mov    0x4(%rsi),%eax
+  803e5b:	8d 50 01             	lea    0x1(%rax),%edx
+  803e5e:	89 56 04             	mov    %edx,0x4(%rsi)
+  803e61:	48 98                	cltq
+  803e63:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803e68:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e6e:	74 01                	je     803e71 <putch+0x19>
+  803e70:	c3                   	ret
+putch(int ch, void *arg) {
+  803e71:	55                   	push   %rbp
+  803e72:	48 89 e5             	mov    %rsp,%rbp
+  803e75:	53                   	push   %rbx
+  803e76:	48 83 ec 08          	sub    $0x8,%rsp
+  803e7a:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e7d:	48 89 f7             	mov    %rsi,%rdi
+  803e80:	48 b8 08 3e 80 00 00 	movabs $0x803e08,%rax
+  803e87:	00 00 00 
+  803e8a:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e8c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e97:	c9                   	leave
+  803e98:	c3                   	ret
+
+0000000000803e99 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e99:	55                   	push   %rbp
+  803e9a:	48 89 e5             	mov    %rsp,%rbp
+  803e9d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803ea4:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803ea7:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803ead:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803eb4:	00 00 00 
+    state.result = 0;
+  803eb7:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803ebe:	00 00 00 00 
+    state.error = 1;
+  803ec2:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803ec9:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803ecc:	48 89 f2             	mov    %rsi,%rdx
+  803ecf:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803ed6:	48 bf 58 3e 80 00 00 	movabs $0x803e58,%rdi
+  803edd:	00 00 00 
+  803ee0:	48 b8 c7 18 80 00 00 	movabs $0x8018c7,%rax
+  803ee7:	00 00 00 
+  803eea:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803eec:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803ef3:	7f 14                	jg     803f09 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803ef5:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803efc:	48 85 c0             	test   %rax,%rax
+  803eff:	75 06                	jne    803f07 <vfprintf+0x6e>
+  803f01:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803f07:	c9                   	leave
+  803f08:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803f09:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803f10:	48 b8 08 3e 80 00 00 	movabs $0x803e08,%rax
+  803f17:	00 00 00 
+  803f1a:	ff d0                	call   *%rax
+  803f1c:	eb d7                	jmp    803ef5 <vfprintf+0x5c>
+
+0000000000803f1e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803f1e:	55                   	push   %rbp
+  803f1f:	48 89 e5             	mov    %rsp,%rbp
+  803f22:	48 83 ec 50          	sub    $0x50,%rsp
+  803f26:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f2a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f2e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f32:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f36:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f3d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f45:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f49:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803f4d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f51:	48 b8 99 3e 80 00 00 	movabs $0x803e99,%rax
+  803f58:	00 00 00 
+  803f5b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f5d:	c9                   	leave
+  803f5e:	c3                   	ret
+
+0000000000803f5f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803f5f:	55                   	push   %rbp
+  803f60:	48 89 e5             	mov    %rsp,%rbp
+  803f63:	48 83 ec 50          	sub    $0x50,%rsp
+  803f67:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f6b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f6f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f73:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f77:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f7b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f82:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f8a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f8e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f92:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f96:	48 89 fe             	mov    %rdi,%rsi
+  803f99:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f9e:	48 b8 99 3e 80 00 00 	movabs $0x803e99,%rax
+  803fa5:	00 00 00 
+  803fa8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803faa:	c9                   	leave
+  803fab:	c3                   	ret
+
+0000000000803fac <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803fac:	55                   	push   %rbp
+  803fad:	48 89 e5             	mov    %rsp,%rbp
+  803fb0:	41 54                	push   %r12
+  803fb2:	53                   	push   %rbx
+  803fb3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fb6:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  803fbd:	00 00 00 
+  803fc0:	ff d0                	call   *%rax
+  803fc2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803fc5:	48 be b0 65 80 00 00 	movabs $0x8065b0,%rsi
+  803fcc:	00 00 00 
+  803fcf:	48 89 df             	mov    %rbx,%rdi
+  803fd2:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  803fd9:	00 00 00 
+  803fdc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803fde:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803fe3:	41 2b 04 24          	sub    (%r12),%eax
+  803fe7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803fed:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803ff4:	00 00 00 
+    stat->st_dev = &devpipe;
+  803ff7:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803ffe:	00 00 00 
+  804001:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400d:	5b                   	pop    %rbx
+  80400e:	41 5c                	pop    %r12
+  804010:	5d                   	pop    %rbp
+  804011:	c3                   	ret
+
+0000000000804012 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804012:	55                   	push   %rbp
+  804013:	48 89 e5             	mov    %rsp,%rbp
+  804016:	41 54                	push   %r12
+  804018:	53                   	push   %rbx
+  804019:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80401c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804021:	48 89 fe             	mov    %rdi,%rsi
+  804024:	bf 00 00 00 00       	mov    $0x0,%edi
+  804029:	49 bc eb 28 80 00 00 	movabs $0x8028eb,%r12
+  804030:	00 00 00 
+  804033:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804036:	48 89 df             	mov    %rbx,%rdi
+  804039:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  804040:	00 00 00 
+  804043:	ff d0                	call   *%rax
+  804045:	48 89 c6             	mov    %rax,%rsi
+  804048:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80404d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804052:	41 ff d4             	call   *%r12
+}
+  804055:	5b                   	pop    %rbx
+  804056:	41 5c                	pop    %r12
+  804058:	5d                   	pop    %rbp
+  804059:	c3                   	ret
+
+000000000080405a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+  80405e:	41 57                	push   %r15
+  804060:	41 56                	push   %r14
+  804062:	41 55                	push   %r13
+  804064:	41 54                	push   %r12
+  804066:	53                   	push   %rbx
+  804067:	48 83 ec 18          	sub    $0x18,%rsp
+  80406b:	49 89 fc             	mov    %rdi,%r12
+  80406e:	49 89 f5             	mov    %rsi,%r13
+  804071:	49 89 d7             	mov    %rdx,%r15
+  804074:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804078:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  80407f:	00 00 00 
+  804082:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804084:	4d 85 ff             	test   %r15,%r15
+  804087:	0f 84 af 00 00 00    	je     80413c <devpipe_write+0xe2>
+  80408d:	48 89 c3             	mov    %rax,%rbx
+  804090:	4c 89 f8             	mov    %r15,%rax
+  804093:	4d 89 ef             	mov    %r13,%r15
+  804096:	4c 01 e8             	add    %r13,%rax
+  804099:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80409d:	49 bd e1 27 80 00 00 	movabs $0x8027e1,%r13
+  8040a4:	00 00 00 
+            sys_yield();
+  8040a7:	49 be 72 27 80 00 00 	movabs $0x802772,%r14
+  8040ae:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040b1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040b4:	48 63 ce             	movslq %esi,%rcx
+  8040b7:	48 63 03             	movslq (%rbx),%rax
+  8040ba:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040c0:	48 39 c1             	cmp    %rax,%rcx
+  8040c3:	72 2e                	jb     8040f3 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040c5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040ca:	48 89 da             	mov    %rbx,%rdx
+  8040cd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040d2:	4c 89 e7             	mov    %r12,%rdi
+  8040d5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8040d8:	85 c0                	test   %eax,%eax
+  8040da:	74 66                	je     804142 <devpipe_write+0xe8>
+            sys_yield();
+  8040dc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040df:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040e2:	48 63 ce             	movslq %esi,%rcx
+  8040e5:	48 63 03             	movslq (%rbx),%rax
+  8040e8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040ee:	48 39 c1             	cmp    %rax,%rcx
+  8040f1:	73 d2                	jae    8040c5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8040f3:	41 0f b6 3f          	movzbl (%r15),%edi
+  8040f7:	48 89 ca             	mov    %rcx,%rdx
+  8040fa:	48 c1 ea 03          	shr    $0x3,%rdx
+  8040fe:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804105:	08 10 20 
+  804108:	48 f7 e2             	mul    %rdx
+  80410b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80410f:	48 89 d0             	mov    %rdx,%rax
+  804112:	48 c1 e0 09          	shl    $0x9,%rax
+  804116:	48 29 d0             	sub    %rdx,%rax
+  804119:	48 c1 e0 03          	shl    $0x3,%rax
+  80411d:	48 29 c1             	sub    %rax,%rcx
+  804120:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804125:	83 c6 01             	add    $0x1,%esi
+  804128:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80412b:	49 83 c7 01          	add    $0x1,%r15
+  80412f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804133:	49 39 c7             	cmp    %rax,%r15
+  804136:	0f 85 75 ff ff ff    	jne    8040b1 <devpipe_write+0x57>
+    return n;
+  80413c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804140:	eb 05                	jmp    804147 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804142:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804147:	48 83 c4 18          	add    $0x18,%rsp
+  80414b:	5b                   	pop    %rbx
+  80414c:	41 5c                	pop    %r12
+  80414e:	41 5d                	pop    %r13
+  804150:	41 5e                	pop    %r14
+  804152:	41 5f                	pop    %r15
+  804154:	5d                   	pop    %rbp
+  804155:	c3                   	ret
+
+0000000000804156 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804156:	55                   	push   %rbp
+  804157:	48 89 e5             	mov    %rsp,%rbp
+  80415a:	41 57                	push   %r15
+  80415c:	41 56                	push   %r14
+  80415e:	41 55                	push   %r13
+  804160:	41 54                	push   %r12
+  804162:	53                   	push   %rbx
+  804163:	48 83 ec 18          	sub    $0x18,%rsp
+  804167:	49 89 fc             	mov    %rdi,%r12
+  80416a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80416e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804172:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  804179:	00 00 00 
+  80417c:	ff d0                	call   *%rax
+  80417e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804181:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804187:	49 bd e1 27 80 00 00 	movabs $0x8027e1,%r13
+  80418e:	00 00 00 
+            sys_yield();
+  804191:	49 be 72 27 80 00 00 	movabs $0x802772,%r14
+  804198:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80419b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8041a0:	74 7d                	je     80421f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041a2:	8b 03                	mov    (%rbx),%eax
+  8041a4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041a7:	75 26                	jne    8041cf <devpipe_read+0x79>
+            if (i > 0) return i;
+  8041a9:	4d 85 ff             	test   %r15,%r15
+  8041ac:	75 77                	jne    804225 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041ae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041b3:	48 89 da             	mov    %rbx,%rdx
+  8041b6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041bb:	4c 89 e7             	mov    %r12,%rdi
+  8041be:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8041c1:	85 c0                	test   %eax,%eax
+  8041c3:	74 72                	je     804237 <devpipe_read+0xe1>
+            sys_yield();
+  8041c5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041c8:	8b 03                	mov    (%rbx),%eax
+  8041ca:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041cd:	74 df                	je     8041ae <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8041cf:	48 63 c8             	movslq %eax,%rcx
+  8041d2:	48 89 ca             	mov    %rcx,%rdx
+  8041d5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041d9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8041e0:	08 10 20 
+  8041e3:	48 89 d0             	mov    %rdx,%rax
+  8041e6:	48 f7 e6             	mul    %rsi
+  8041e9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041ed:	48 89 d0             	mov    %rdx,%rax
+  8041f0:	48 c1 e0 09          	shl    $0x9,%rax
+  8041f4:	48 29 d0             	sub    %rdx,%rax
+  8041f7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8041fe:	00 
+  8041ff:	48 89 c8             	mov    %rcx,%rax
+  804202:	48 29 d0             	sub    %rdx,%rax
+  804205:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80420a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80420e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804212:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804215:	49 83 c7 01          	add    $0x1,%r15
+  804219:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80421d:	75 83                	jne    8041a2 <devpipe_read+0x4c>
+    return n;
+  80421f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804223:	eb 03                	jmp    804228 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804225:	4c 89 f8             	mov    %r15,%rax
+}
+  804228:	48 83 c4 18          	add    $0x18,%rsp
+  80422c:	5b                   	pop    %rbx
+  80422d:	41 5c                	pop    %r12
+  80422f:	41 5d                	pop    %r13
+  804231:	41 5e                	pop    %r14
+  804233:	41 5f                	pop    %r15
+  804235:	5d                   	pop    %rbp
+  804236:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423c:	eb ea                	jmp    804228 <devpipe_read+0xd2>
+
+000000000080423e <pipe>:
+pipe(int pfd[2]) {
+  80423e:	55                   	push   %rbp
+  80423f:	48 89 e5             	mov    %rsp,%rbp
+  804242:	41 55                	push   %r13
+  804244:	41 54                	push   %r12
+  804246:	53                   	push   %rbx
+  804247:	48 83 ec 18          	sub    $0x18,%rsp
+  80424b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80424e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804252:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  804259:	00 00 00 
+  80425c:	ff d0                	call   *%rax
+  80425e:	89 c3                	mov    %eax,%ebx
+  804260:	85 c0                	test   %eax,%eax
+  804262:	0f 88 a0 01 00 00    	js     804408 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804268:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80426d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804272:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80427b:	48 b8 13 28 80 00 00 	movabs $0x802813,%rax
+  804282:	00 00 00 
+  804285:	ff d0                	call   *%rax
+  804287:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804289:	85 c0                	test   %eax,%eax
+  80428b:	0f 88 77 01 00 00    	js     804408 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804291:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804295:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  80429c:	00 00 00 
+  80429f:	ff d0                	call   *%rax
+  8042a1:	89 c3                	mov    %eax,%ebx
+  8042a3:	85 c0                	test   %eax,%eax
+  8042a5:	0f 88 43 01 00 00    	js     8043ee <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8042ab:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042b5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8042b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042be:	48 b8 13 28 80 00 00 	movabs $0x802813,%rax
+  8042c5:	00 00 00 
+  8042c8:	ff d0                	call   *%rax
+  8042ca:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8042cc:	85 c0                	test   %eax,%eax
+  8042ce:	0f 88 1a 01 00 00    	js     8043ee <pipe+0x1b0>
+    va = fd2data(fd0);
+  8042d4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8042d8:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  8042df:	00 00 00 
+  8042e2:	ff d0                	call   *%rax
+  8042e4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8042e7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042f1:	48 89 c6             	mov    %rax,%rsi
+  8042f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042f9:	48 b8 13 28 80 00 00 	movabs $0x802813,%rax
+  804300:	00 00 00 
+  804303:	ff d0                	call   *%rax
+  804305:	89 c3                	mov    %eax,%ebx
+  804307:	85 c0                	test   %eax,%eax
+  804309:	0f 88 c5 00 00 00    	js     8043d4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80430f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804313:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  80431a:	00 00 00 
+  80431d:	ff d0                	call   *%rax
+  80431f:	48 89 c1             	mov    %rax,%rcx
+  804322:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804328:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80432e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804333:	4c 89 ee             	mov    %r13,%rsi
+  804336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80433b:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  804342:	00 00 00 
+  804345:	ff d0                	call   *%rax
+  804347:	89 c3                	mov    %eax,%ebx
+  804349:	85 c0                	test   %eax,%eax
+  80434b:	78 6e                	js     8043bb <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80434d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804352:	4c 89 ef             	mov    %r13,%rdi
+  804355:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  80435c:	00 00 00 
+  80435f:	ff d0                	call   *%rax
+  804361:	83 f8 02             	cmp    $0x2,%eax
+  804364:	0f 85 ab 00 00 00    	jne    804415 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80436a:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804371:	00 00 
+  804373:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804377:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804379:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80437d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804384:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804388:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80438a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80438e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804395:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804399:	48 bb 23 30 80 00 00 	movabs $0x803023,%rbx
+  8043a0:	00 00 00 
+  8043a3:	ff d3                	call   *%rbx
+  8043a5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8043a9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043ad:	ff d3                	call   *%rbx
+  8043af:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8043b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043b9:	eb 4d                	jmp    804408 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8043bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043c0:	4c 89 ee             	mov    %r13,%rsi
+  8043c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c8:	48 b8 eb 28 80 00 00 	movabs $0x8028eb,%rax
+  8043cf:	00 00 00 
+  8043d2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8043d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8043dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e2:	48 b8 eb 28 80 00 00 	movabs $0x8028eb,%rax
+  8043e9:	00 00 00 
+  8043ec:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8043ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043f3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8043f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043fc:	48 b8 eb 28 80 00 00 	movabs $0x8028eb,%rax
+  804403:	00 00 00 
+  804406:	ff d0                	call   *%rax
+}
+  804408:	89 d8                	mov    %ebx,%eax
+  80440a:	48 83 c4 18          	add    $0x18,%rsp
+  80440e:	5b                   	pop    %rbx
+  80440f:	41 5c                	pop    %r12
+  804411:	41 5d                	pop    %r13
+  804413:	5d                   	pop    %rbp
+  804414:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804415:	48 b9 c8 65 80 00 00 	movabs $0x8065c8,%rcx
+  80441c:	00 00 00 
+  80441f:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  804426:	00 00 00 
+  804429:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80442e:	48 bf b7 65 80 00 00 	movabs $0x8065b7,%rdi
+  804435:	00 00 00 
+  804438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443d:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  804444:	00 00 00 
+  804447:	41 ff d0             	call   *%r8
+
+000000000080444a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80444a:	55                   	push   %rbp
+  80444b:	48 89 e5             	mov    %rsp,%rbp
+  80444e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804452:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804456:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  80445d:	00 00 00 
+  804460:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804462:	85 c0                	test   %eax,%eax
+  804464:	78 35                	js     80449b <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804466:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80446a:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  804471:	00 00 00 
+  804474:	ff d0                	call   *%rax
+  804476:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804479:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80447e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804483:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804487:	48 b8 e1 27 80 00 00 	movabs $0x8027e1,%rax
+  80448e:	00 00 00 
+  804491:	ff d0                	call   *%rax
+  804493:	85 c0                	test   %eax,%eax
+  804495:	0f 94 c0             	sete   %al
+  804498:	0f b6 c0             	movzbl %al,%eax
+}
+  80449b:	c9                   	leave
+  80449c:	c3                   	ret
+
+000000000080449d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80449d:	48 89 f8             	mov    %rdi,%rax
+  8044a0:	48 c1 e8 27          	shr    $0x27,%rax
+  8044a4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8044ab:	01 00 00 
+  8044ae:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044b2:	f6 c2 01             	test   $0x1,%dl
+  8044b5:	74 6d                	je     804524 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044b7:	48 89 f8             	mov    %rdi,%rax
+  8044ba:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8044be:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044c5:	01 00 00 
+  8044c8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044cc:	f6 c2 01             	test   $0x1,%dl
+  8044cf:	74 62                	je     804533 <get_uvpt_entry+0x96>
+  8044d1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044d8:	01 00 00 
+  8044db:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044df:	f6 c2 80             	test   $0x80,%dl
+  8044e2:	75 4f                	jne    804533 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044e4:	48 89 f8             	mov    %rdi,%rax
+  8044e7:	48 c1 e8 15          	shr    $0x15,%rax
+  8044eb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044f2:	01 00 00 
+  8044f5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044f9:	f6 c2 01             	test   $0x1,%dl
+  8044fc:	74 44                	je     804542 <get_uvpt_entry+0xa5>
+  8044fe:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804505:	01 00 00 
+  804508:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80450c:	f6 c2 80             	test   $0x80,%dl
+  80450f:	75 31                	jne    804542 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804511:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804515:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80451c:	01 00 00 
+  80451f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804523:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804524:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80452b:	01 00 00 
+  80452e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804532:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804533:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80453a:	01 00 00 
+  80453d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804541:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804542:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804549:	01 00 00 
+  80454c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804550:	c3                   	ret
+
+0000000000804551 <get_prot>:
+
+int
+get_prot(void *va) {
+  804551:	55                   	push   %rbp
+  804552:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804555:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  80455c:	00 00 00 
+  80455f:	ff d0                	call   *%rax
+  804561:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804564:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804569:	89 c1                	mov    %eax,%ecx
+  80456b:	83 c9 04             	or     $0x4,%ecx
+  80456e:	f6 c2 01             	test   $0x1,%dl
+  804571:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804574:	89 c1                	mov    %eax,%ecx
+  804576:	83 c9 02             	or     $0x2,%ecx
+  804579:	f6 c2 02             	test   $0x2,%dl
+  80457c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80457f:	89 c1                	mov    %eax,%ecx
+  804581:	83 c9 01             	or     $0x1,%ecx
+  804584:	48 85 d2             	test   %rdx,%rdx
+  804587:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80458a:	89 c1                	mov    %eax,%ecx
+  80458c:	83 c9 40             	or     $0x40,%ecx
+  80458f:	f6 c6 04             	test   $0x4,%dh
+  804592:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804595:	5d                   	pop    %rbp
+  804596:	c3                   	ret
+
+0000000000804597 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804597:	55                   	push   %rbp
+  804598:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80459b:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8045a2:	00 00 00 
+  8045a5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8045a7:	48 c1 e8 06          	shr    $0x6,%rax
+  8045ab:	83 e0 01             	and    $0x1,%eax
+}
+  8045ae:	5d                   	pop    %rbp
+  8045af:	c3                   	ret
+
+00000000008045b0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8045b0:	55                   	push   %rbp
+  8045b1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8045b4:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8045bb:	00 00 00 
+  8045be:	ff d0                	call   *%rax
+  8045c0:	83 e0 01             	and    $0x1,%eax
+}
+  8045c3:	5d                   	pop    %rbp
+  8045c4:	c3                   	ret
+
+00000000008045c5 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8045c5:	55                   	push   %rbp
+  8045c6:	48 89 e5             	mov    %rsp,%rbp
+  8045c9:	41 57                	push   %r15
+  8045cb:	41 56                	push   %r14
+  8045cd:	41 55                	push   %r13
+  8045cf:	41 54                	push   %r12
+  8045d1:	53                   	push   %rbx
+  8045d2:	48 83 ec 28          	sub    $0x28,%rsp
+  8045d6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8045da:	48 85 ff             	test   %rdi,%rdi
+  8045dd:	74 1e                	je     8045fd <foreach_shared_region+0x38>
+  8045df:	49 89 ff             	mov    %rdi,%r15
+  8045e2:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8045e8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8045ee:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8045f5:	01 00 00 
+  8045f8:	e9 72 02 00 00       	jmp    80486f <foreach_shared_region+0x2aa>
+    assert(fun);
+  8045fd:	48 b9 ec 65 80 00 00 	movabs $0x8065ec,%rcx
+  804604:	00 00 00 
+  804607:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  80460e:	00 00 00 
+  804611:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804616:	48 bf f0 65 80 00 00 	movabs $0x8065f0,%rdi
+  80461d:	00 00 00 
+  804620:	b8 00 00 00 00       	mov    $0x0,%eax
+  804625:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  80462c:	00 00 00 
+  80462f:	41 ff d0             	call   *%r8
+  804632:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804639:	eb 6c                	jmp    8046a7 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80463b:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804642:	ff ff ff 
+  804645:	4c 21 e2             	and    %r12,%rdx
+  804648:	48 89 d8             	mov    %rbx,%rax
+  80464b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804650:	48 83 c0 01          	add    $0x1,%rax
+  804654:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804658:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80465f:	00 00 00 
+  804662:	48 21 c8             	and    %rcx,%rax
+  804665:	48 09 d0             	or     %rdx,%rax
+  804668:	49 89 c4             	mov    %rax,%r12
+  80466b:	eb 30                	jmp    80469d <foreach_shared_region+0xd8>
+  80466d:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804674:	ff ff ff 
+  804677:	4c 21 e2             	and    %r12,%rdx
+  80467a:	48 89 d8             	mov    %rbx,%rax
+  80467d:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804682:	48 83 c0 01          	add    $0x1,%rax
+  804686:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80468a:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804691:	00 00 00 
+  804694:	48 21 c8             	and    %rcx,%rax
+  804697:	48 09 d0             	or     %rdx,%rax
+  80469a:	49 89 c4             	mov    %rax,%r12
+  80469d:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8046a1:	0f 84 99 01 00 00    	je     804840 <foreach_shared_region+0x27b>
+  8046a7:	4c 89 e3             	mov    %r12,%rbx
+  8046aa:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8046ae:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8046b5:	01 00 00 
+  8046b8:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8046bc:	a8 01                	test   $0x1,%al
+  8046be:	0f 84 77 ff ff ff    	je     80463b <foreach_shared_region+0x76>
+  8046c4:	a8 80                	test   $0x80,%al
+  8046c6:	74 19                	je     8046e1 <foreach_shared_region+0x11c>
+  8046c8:	f6 c4 04             	test   $0x4,%ah
+  8046cb:	74 a0                	je     80466d <foreach_shared_region+0xa8>
+  8046cd:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8046d4:	40 
+  8046d5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046d9:	4c 89 e7             	mov    %r12,%rdi
+  8046dc:	41 ff d7             	call   *%r15
+  8046df:	eb 8c                	jmp    80466d <foreach_shared_region+0xa8>
+  8046e1:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8046e8:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8046ec:	eb 46                	jmp    804734 <foreach_shared_region+0x16f>
+  8046ee:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8046f5:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8046fb:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8046ff:	48 c1 e0 15          	shl    $0x15,%rax
+  804703:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804708:	49 09 c4             	or     %rax,%r12
+  80470b:	eb 1d                	jmp    80472a <foreach_shared_region+0x165>
+  80470d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804714:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80471a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80471e:	48 c1 e0 15          	shl    $0x15,%rax
+  804722:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804727:	49 09 c4             	or     %rax,%r12
+  80472a:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80472e:	0f 84 d3 00 00 00    	je     804807 <foreach_shared_region+0x242>
+  804734:	4c 89 e3             	mov    %r12,%rbx
+  804737:	48 c1 eb 15          	shr    $0x15,%rbx
+  80473b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804742:	01 00 00 
+  804745:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804749:	a8 01                	test   $0x1,%al
+  80474b:	74 a1                	je     8046ee <foreach_shared_region+0x129>
+  80474d:	a8 80                	test   $0x80,%al
+  80474f:	74 19                	je     80476a <foreach_shared_region+0x1a5>
+  804751:	f6 c4 04             	test   $0x4,%ah
+  804754:	74 b7                	je     80470d <foreach_shared_region+0x148>
+  804756:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80475d:	00 
+  80475e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804762:	4c 89 e7             	mov    %r12,%rdi
+  804765:	41 ff d7             	call   *%r15
+  804768:	eb a3                	jmp    80470d <foreach_shared_region+0x148>
+  80476a:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804770:	eb 3b                	jmp    8047ad <foreach_shared_region+0x1e8>
+  804772:	f6 c4 04             	test   $0x4,%ah
+  804775:	74 12                	je     804789 <foreach_shared_region+0x1c4>
+  804777:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80477e:	00 
+  80477f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804783:	4c 89 e7             	mov    %r12,%rdi
+  804786:	41 ff d7             	call   *%r15
+  804789:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804790:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804796:	48 83 c3 01          	add    $0x1,%rbx
+  80479a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80479e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8047a4:	49 09 dc             	or     %rbx,%r12
+  8047a7:	41 83 ed 01          	sub    $0x1,%r13d
+  8047ab:	74 2f                	je     8047dc <foreach_shared_region+0x217>
+  8047ad:	4c 89 e3             	mov    %r12,%rbx
+  8047b0:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8047b4:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8047b8:	a8 01                	test   $0x1,%al
+  8047ba:	75 b6                	jne    804772 <foreach_shared_region+0x1ad>
+  8047bc:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8047c3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047c9:	48 83 c3 01          	add    $0x1,%rbx
+  8047cd:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8047d1:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8047d7:	49 09 dc             	or     %rbx,%r12
+  8047da:	eb cb                	jmp    8047a7 <foreach_shared_region+0x1e2>
+  8047dc:	4c 89 e0             	mov    %r12,%rax
+  8047df:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8047e5:	49 c1 ec 15          	shr    $0x15,%r12
+  8047e9:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8047f0:	49 83 c4 01          	add    $0x1,%r12
+  8047f4:	49 c1 e4 15          	shl    $0x15,%r12
+  8047f8:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8047ff:	49 09 c4             	or     %rax,%r12
+  804802:	e9 23 ff ff ff       	jmp    80472a <foreach_shared_region+0x165>
+  804807:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80480b:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804812:	ff ff ff 
+  804815:	4c 21 e0             	and    %r12,%rax
+  804818:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80481c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804823:	49 83 c4 01          	add    $0x1,%r12
+  804827:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80482b:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804832:	00 00 00 
+  804835:	49 21 d4             	and    %rdx,%r12
+  804838:	49 09 c4             	or     %rax,%r12
+  80483b:	e9 5d fe ff ff       	jmp    80469d <foreach_shared_region+0xd8>
+  804840:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804847:	00 ff ff 
+  80484a:	4c 21 e0             	and    %r12,%rax
+  80484d:	49 c1 ec 27          	shr    $0x27,%r12
+  804851:	49 83 c4 01          	add    $0x1,%r12
+  804855:	49 c1 e4 27          	shl    $0x27,%r12
+  804859:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804860:	ff 00 00 
+  804863:	49 21 d4             	and    %rdx,%r12
+  804866:	49 09 c4             	or     %rax,%r12
+  804869:	41 83 ed 01          	sub    $0x1,%r13d
+  80486d:	74 48                	je     8048b7 <foreach_shared_region+0x2f2>
+  80486f:	4c 89 e0             	mov    %r12,%rax
+  804872:	48 c1 e8 27          	shr    $0x27,%rax
+  804876:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80487d:	01 00 00 
+  804880:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804884:	f6 c2 01             	test   $0x1,%dl
+  804887:	0f 85 a5 fd ff ff    	jne    804632 <foreach_shared_region+0x6d>
+  80488d:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804894:	00 ff ff 
+  804897:	4c 21 e2             	and    %r12,%rdx
+  80489a:	48 83 c0 01          	add    $0x1,%rax
+  80489e:	48 c1 e0 27          	shl    $0x27,%rax
+  8048a2:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8048a9:	ff 00 00 
+  8048ac:	48 21 c8             	and    %rcx,%rax
+  8048af:	48 09 d0             	or     %rdx,%rax
+  8048b2:	49 89 c4             	mov    %rax,%r12
+  8048b5:	eb b2                	jmp    804869 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8048b7:	4d 85 e4             	test   %r12,%r12
+  8048ba:	75 14                	jne    8048d0 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8048bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048c1:	48 83 c4 28          	add    $0x28,%rsp
+  8048c5:	5b                   	pop    %rbx
+  8048c6:	41 5c                	pop    %r12
+  8048c8:	41 5d                	pop    %r13
+  8048ca:	41 5e                	pop    %r14
+  8048cc:	41 5f                	pop    %r15
+  8048ce:	5d                   	pop    %rbp
+  8048cf:	c3                   	ret
+    assert(addr == 0);
+  8048d0:	48 b9 fb 65 80 00 00 	movabs $0x8065fb,%rcx
+  8048d7:	00 00 00 
+  8048da:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  8048e1:	00 00 00 
+  8048e4:	be 67 00 00 00       	mov    $0x67,%esi
+  8048e9:	48 bf f0 65 80 00 00 	movabs $0x8065f0,%rdi
+  8048f0:	00 00 00 
+  8048f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f8:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  8048ff:	00 00 00 
+  804902:	41 ff d0             	call   *%r8
+
+0000000000804905 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804905:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  80490c:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80490f:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804915:	eb 33                	jmp    80494a <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804917:	48 83 c0 20          	add    $0x20,%rax
+  80491b:	4c 39 c0             	cmp    %r8,%rax
+  80491e:	74 25                	je     804945 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804920:	48 8b 10             	mov    (%rax),%rdx
+  804923:	48 85 d2             	test   %rdx,%rdx
+  804926:	74 ef                	je     804917 <mmap_place+0x12>
+  804928:	48 89 d1             	mov    %rdx,%rcx
+  80492b:	48 03 48 08          	add    0x8(%rax),%rcx
+  80492f:	48 39 cf             	cmp    %rcx,%rdi
+  804932:	73 e3                	jae    804917 <mmap_place+0x12>
+  804934:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804938:	4c 39 ca             	cmp    %r9,%rdx
+  80493b:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  80493f:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804943:	eb d2                	jmp    804917 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804945:	45 84 d2             	test   %r10b,%r10b
+  804948:	74 12                	je     80495c <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80494a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804951:	00 00 00 
+        moved = 0;
+  804954:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  80495a:	eb c4                	jmp    804920 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  80495c:	48 01 fe             	add    %rdi,%rsi
+  80495f:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804966:	00 00 00 
+  804969:	48 39 f0             	cmp    %rsi,%rax
+  80496c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804971:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804975:	c3                   	ret
+
+0000000000804976 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804976:	55                   	push   %rbp
+  804977:	48 89 e5             	mov    %rsp,%rbp
+  80497a:	41 57                	push   %r15
+  80497c:	41 56                	push   %r14
+  80497e:	41 55                	push   %r13
+  804980:	41 54                	push   %r12
+  804982:	53                   	push   %rbx
+  804983:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804987:	48 8b 1f             	mov    (%rdi),%rbx
+  80498a:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804991:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804998:	00 00 00 
+  80499b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049a0:	eb 12                	jmp    8049b4 <mmap_pgfault+0x3e>
+  8049a2:	48 83 c2 01          	add    $0x1,%rdx
+  8049a6:	48 83 c0 20          	add    $0x20,%rax
+  8049aa:	48 83 fa 20          	cmp    $0x20,%rdx
+  8049ae:	0f 84 04 01 00 00    	je     804ab8 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8049b4:	48 8b 08             	mov    (%rax),%rcx
+  8049b7:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8049bb:	48 39 de             	cmp    %rbx,%rsi
+  8049be:	73 e2                	jae    8049a2 <mmap_pgfault+0x2c>
+  8049c0:	48 03 48 08          	add    0x8(%rax),%rcx
+  8049c4:	48 39 cb             	cmp    %rcx,%rbx
+  8049c7:	73 d9                	jae    8049a2 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8049c9:	48 c1 e2 05          	shl    $0x5,%rdx
+  8049cd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8049d4:	00 00 00 
+  8049d7:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8049db:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8049df:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8049e3:	f6 c2 01             	test   $0x1,%dl
+  8049e6:	0f 84 e0 00 00 00    	je     804acc <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  8049ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f1:	f6 c2 02             	test   $0x2,%dl
+  8049f4:	0f 84 c3 00 00 00    	je     804abd <mmap_pgfault+0x147>
+  8049fa:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804a01:	ff ff ff 
+  804a04:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804a08:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804a0f:	00 00 00 
+  804a12:	48 39 ca             	cmp    %rcx,%rdx
+  804a15:	0f 85 a2 00 00 00    	jne    804abd <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804a1b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804a20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a25:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804a2c:	00 00 00 
+  804a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a34:	48 b8 13 28 80 00 00 	movabs $0x802813,%rax
+  804a3b:	00 00 00 
+  804a3e:	ff d0                	call   *%rax
+  804a40:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a47:	85 d2                	test   %edx,%edx
+  804a49:	78 72                	js     804abd <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804a4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a50:	48 89 de             	mov    %rbx,%rsi
+  804a53:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804a5a:	00 00 00 
+  804a5d:	4c 89 e7             	mov    %r12,%rdi
+  804a60:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  804a67:	00 00 00 
+  804a6a:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804a6c:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804a72:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a78:	48 89 d9             	mov    %rbx,%rcx
+  804a7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a80:	4c 89 e6             	mov    %r12,%rsi
+  804a83:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a88:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  804a8f:	00 00 00 
+  804a92:	ff d0                	call   *%rax
+  804a94:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804a96:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a9b:	4c 89 e6             	mov    %r12,%rsi
+  804a9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aa3:	48 b8 eb 28 80 00 00 	movabs $0x8028eb,%rax
+  804aaa:	00 00 00 
+  804aad:	ff d0                	call   *%rax
+    return res >= 0;
+  804aaf:	89 d8                	mov    %ebx,%eax
+  804ab1:	f7 d0                	not    %eax
+  804ab3:	c1 e8 1f             	shr    $0x1f,%eax
+  804ab6:	eb 05                	jmp    804abd <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804abd:	48 83 c4 18          	add    $0x18,%rsp
+  804ac1:	5b                   	pop    %rbx
+  804ac2:	41 5c                	pop    %r12
+  804ac4:	41 5d                	pop    %r13
+  804ac6:	41 5e                	pop    %r14
+  804ac8:	41 5f                	pop    %r15
+  804aca:	5d                   	pop    %rbp
+  804acb:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804acc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ad0:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804ad4:	4c 03 30             	add    (%rax),%r14
+  804ad7:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804ade:	49 39 c6             	cmp    %rax,%r14
+  804ae1:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ae5:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804aec:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804af2:	49 bf b0 45 80 00 00 	movabs $0x8045b0,%r15
+  804af9:	00 00 00 
+  804afc:	4d 39 f4             	cmp    %r14,%r12
+  804aff:	73 1d                	jae    804b1e <mmap_pgfault+0x1a8>
+  804b01:	4c 89 e7             	mov    %r12,%rdi
+  804b04:	41 ff d7             	call   *%r15
+  804b07:	84 c0                	test   %al,%al
+  804b09:	75 13                	jne    804b1e <mmap_pgfault+0x1a8>
+  804b0b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804b12:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804b19:	4d 39 f4             	cmp    %r14,%r12
+  804b1c:	72 e3                	jb     804b01 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804b1e:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804b24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b28:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804b2c:	74 2a                	je     804b58 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804b2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b32:	89 de                	mov    %ebx,%esi
+  804b34:	2b 30                	sub    (%rax),%esi
+  804b36:	03 70 1c             	add    0x1c(%rax),%esi
+  804b39:	8b 78 18             	mov    0x18(%rax),%edi
+  804b3c:	4c 89 e9             	mov    %r13,%rcx
+  804b3f:	48 89 da             	mov    %rbx,%rdx
+  804b42:	48 b8 0e 3d 80 00 00 	movabs $0x803d0e,%rax
+  804b49:	00 00 00 
+  804b4c:	ff d0                	call   *%rax
+    return res > 0;
+  804b4e:	85 c0                	test   %eax,%eax
+  804b50:	0f 9f c0             	setg   %al
+  804b53:	e9 65 ff ff ff       	jmp    804abd <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804b58:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804b5c:	eb d0                	jmp    804b2e <mmap_pgfault+0x1b8>
+
+0000000000804b5e <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804b5e:	55                   	push   %rbp
+  804b5f:	48 89 e5             	mov    %rsp,%rbp
+  804b62:	41 57                	push   %r15
+  804b64:	41 56                	push   %r14
+  804b66:	41 55                	push   %r13
+  804b68:	41 54                	push   %r12
+  804b6a:	53                   	push   %rbx
+  804b6b:	48 83 ec 28          	sub    $0x28,%rsp
+  804b6f:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804b73:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804b76:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804b7d:	ff ff ff 
+  804b80:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b89:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804b90:	00 00 00 
+  804b93:	48 39 ca             	cmp    %rcx,%rdx
+  804b96:	0f 85 e5 00 00 00    	jne    804c81 <mmap_writeback+0x123>
+  804b9c:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804b9f:	4c 39 ee             	cmp    %r13,%rsi
+  804ba2:	0f 83 e8 00 00 00    	jae    804c90 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ba8:	49 be b0 45 80 00 00 	movabs $0x8045b0,%r14
+  804baf:	00 00 00 
+  804bb2:	49 bf 97 45 80 00 00 	movabs $0x804597,%r15
+  804bb9:	00 00 00 
+  804bbc:	eb 10                	jmp    804bce <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804bbe:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804bc5:	4d 39 ec             	cmp    %r13,%r12
+  804bc8:	0f 83 ae 00 00 00    	jae    804c7c <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804bce:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804bd2:	4c 89 e7             	mov    %r12,%rdi
+  804bd5:	41 ff d6             	call   *%r14
+  804bd8:	84 c0                	test   %al,%al
+  804bda:	74 e2                	je     804bbe <mmap_writeback+0x60>
+  804bdc:	4c 89 e7             	mov    %r12,%rdi
+  804bdf:	41 ff d7             	call   *%r15
+  804be2:	84 c0                	test   %al,%al
+  804be4:	74 d8                	je     804bbe <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804be6:	4c 89 e3             	mov    %r12,%rbx
+  804be9:	4d 39 ec             	cmp    %r13,%r12
+  804bec:	73 20                	jae    804c0e <mmap_writeback+0xb0>
+  804bee:	48 89 df             	mov    %rbx,%rdi
+  804bf1:	41 ff d6             	call   *%r14
+  804bf4:	84 c0                	test   %al,%al
+  804bf6:	74 16                	je     804c0e <mmap_writeback+0xb0>
+  804bf8:	48 89 df             	mov    %rbx,%rdi
+  804bfb:	41 ff d7             	call   *%r15
+  804bfe:	84 c0                	test   %al,%al
+  804c00:	74 0c                	je     804c0e <mmap_writeback+0xb0>
+  804c02:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804c09:	4c 39 eb             	cmp    %r13,%rbx
+  804c0c:	72 e0                	jb     804bee <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804c0e:	48 89 d9             	mov    %rbx,%rcx
+  804c11:	4c 29 e1             	sub    %r12,%rcx
+  804c14:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c18:	44 89 e6             	mov    %r12d,%esi
+  804c1b:	2b 30                	sub    (%rax),%esi
+  804c1d:	49 89 c4             	mov    %rax,%r12
+  804c20:	03 70 1c             	add    0x1c(%rax),%esi
+  804c23:	8b 78 18             	mov    0x18(%rax),%edi
+  804c26:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804c2a:	48 89 ca             	mov    %rcx,%rdx
+  804c2d:	48 b8 97 3d 80 00 00 	movabs $0x803d97,%rax
+  804c34:	00 00 00 
+  804c37:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804c39:	85 c0                	test   %eax,%eax
+  804c3b:	78 44                	js     804c81 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804c3d:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804c42:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804c45:	41 89 c1             	mov    %eax,%r9d
+  804c48:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804c4f:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804c53:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804c57:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c5c:	48 89 ce             	mov    %rcx,%rsi
+  804c5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c64:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  804c6b:	00 00 00 
+  804c6e:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804c70:	85 c0                	test   %eax,%eax
+  804c72:	78 0d                	js     804c81 <mmap_writeback+0x123>
+  804c74:	49 89 dc             	mov    %rbx,%r12
+  804c77:	e9 49 ff ff ff       	jmp    804bc5 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c81:	48 83 c4 28          	add    $0x28,%rsp
+  804c85:	5b                   	pop    %rbx
+  804c86:	41 5c                	pop    %r12
+  804c88:	41 5d                	pop    %r13
+  804c8a:	41 5e                	pop    %r14
+  804c8c:	41 5f                	pop    %r15
+  804c8e:	5d                   	pop    %rbp
+  804c8f:	c3                   	ret
+    return 0;
+  804c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c95:	eb ea                	jmp    804c81 <mmap_writeback+0x123>
+
+0000000000804c97 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804c97:	55                   	push   %rbp
+  804c98:	48 89 e5             	mov    %rsp,%rbp
+  804c9b:	41 57                	push   %r15
+  804c9d:	41 56                	push   %r14
+  804c9f:	41 55                	push   %r13
+  804ca1:	41 54                	push   %r12
+  804ca3:	53                   	push   %rbx
+  804ca4:	48 83 ec 38          	sub    $0x38,%rsp
+  804ca8:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804cac:	48 85 f6             	test   %rsi,%rsi
+  804caf:	0f 84 0c 02 00 00    	je     804ec1 <mmap+0x22a>
+  804cb5:	49 89 ff             	mov    %rdi,%r15
+  804cb8:	49 89 f4             	mov    %rsi,%r12
+  804cbb:	41 89 d5             	mov    %edx,%r13d
+  804cbe:	41 89 ce             	mov    %ecx,%r14d
+  804cc1:	44 89 cb             	mov    %r9d,%ebx
+  804cc4:	45 85 c9             	test   %r9d,%r9d
+  804cc7:	0f 88 f4 01 00 00    	js     804ec1 <mmap+0x22a>
+  804ccd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cd4:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804cdb:	0f 85 e7 01 00 00    	jne    804ec8 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804ce1:	83 e2 fd             	and    $0xfffffffd,%edx
+  804ce4:	83 fa 04             	cmp    $0x4,%edx
+  804ce7:	0f 85 db 01 00 00    	jne    804ec8 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804ced:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804cf0:	83 fa 01             	cmp    $0x1,%edx
+  804cf3:	0f 87 cf 01 00 00    	ja     804ec8 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804cf9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804cfd:	44 89 c7             	mov    %r8d,%edi
+  804d00:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  804d07:	00 00 00 
+  804d0a:	ff d0                	call   *%rax
+  804d0c:	89 c2                	mov    %eax,%edx
+  804d0e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d15:	85 d2                	test   %edx,%edx
+  804d17:	0f 88 ab 01 00 00    	js     804ec8 <mmap+0x231>
+  804d1d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d21:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804d28:	00 00 00 
+  804d2b:	8b 09                	mov    (%rcx),%ecx
+  804d2d:	39 0a                	cmp    %ecx,(%rdx)
+  804d2f:	0f 85 93 01 00 00    	jne    804ec8 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804d35:	8b 52 08             	mov    0x8(%rdx),%edx
+  804d38:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804d3b:	83 fa 01             	cmp    $0x1,%edx
+  804d3e:	0f 84 84 01 00 00    	je     804ec8 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d44:	41 83 fe 01          	cmp    $0x1,%r14d
+  804d48:	74 42                	je     804d8c <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804d4a:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804d51:	4c 89 e6             	mov    %r12,%rsi
+  804d54:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804d5b:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804d5f:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804d63:	4d 85 ff             	test   %r15,%r15
+  804d66:	74 67                	je     804dcf <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d68:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804d6f:	75 0f                	jne    804d80 <mmap+0xe9>
+  804d71:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804d78:	00 00 00 
+  804d7b:	49 39 c7             	cmp    %rax,%r15
+  804d7e:	77 1b                	ja     804d9b <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d80:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d87:	e9 3c 01 00 00       	jmp    804ec8 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d8c:	41 f6 c5 02          	test   $0x2,%r13b
+  804d90:	74 b8                	je     804d4a <mmap+0xb3>
+  804d92:	85 d2                	test   %edx,%edx
+  804d94:	75 b4                	jne    804d4a <mmap+0xb3>
+  804d96:	e9 2d 01 00 00       	jmp    804ec8 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d9b:	4c 89 ff             	mov    %r15,%rdi
+  804d9e:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  804da5:	00 00 00 
+  804da8:	ff d0                	call   *%rax
+  804daa:	48 89 c2             	mov    %rax,%rdx
+  804dad:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804db4:	49 39 d7             	cmp    %rdx,%r15
+  804db7:	0f 85 0b 01 00 00    	jne    804ec8 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804dbd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804dc4:	00 00 00 
+  804dc7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804dcd:	eb 44                	jmp    804e13 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804dcf:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804dd3:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804dda:	00 00 00 
+  804ddd:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  804de4:	00 00 00 
+  804de7:	ff d0                	call   *%rax
+  804de9:	48 89 c7             	mov    %rax,%rdi
+  804dec:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804df0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804df7:	48 85 ff             	test   %rdi,%rdi
+  804dfa:	75 c1                	jne    804dbd <mmap+0x126>
+  804dfc:	e9 c7 00 00 00       	jmp    804ec8 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804e01:	49 83 c4 01          	add    $0x1,%r12
+  804e05:	48 83 c0 20          	add    $0x20,%rax
+  804e09:	49 83 fc 20          	cmp    $0x20,%r12
+  804e0d:	0f 84 a5 00 00 00    	je     804eb8 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e13:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804e17:	75 e8                	jne    804e01 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804e19:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804e1d:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  804e24:	00 00 00 
+  804e27:	ff d0                	call   *%rax
+  804e29:	89 c2                	mov    %eax,%edx
+  804e2b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e32:	85 d2                	test   %edx,%edx
+  804e34:	0f 88 8e 00 00 00    	js     804ec8 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804e3a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804e3e:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  804e45:	00 00 00 
+  804e48:	ff d0                	call   *%rax
+  804e4a:	89 c6                	mov    %eax,%esi
+  804e4c:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804e4f:	48 b8 71 32 80 00 00 	movabs $0x803271,%rax
+  804e56:	00 00 00 
+  804e59:	ff d0                	call   *%rax
+  804e5b:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804e5e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e65:	45 85 ff             	test   %r15d,%r15d
+  804e68:	78 5e                	js     804ec8 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e6a:	49 c1 e4 05          	shl    $0x5,%r12
+  804e6e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e75:	00 00 00 
+  804e78:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804e7b:	48 bf 76 49 80 00 00 	movabs $0x804976,%rdi
+  804e82:	00 00 00 
+  804e85:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  804e8c:	00 00 00 
+  804e8f:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804e91:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e95:	49 89 04 24          	mov    %rax,(%r12)
+  804e99:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804e9d:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804ea2:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804ea7:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804eac:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804eb1:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804eb6:	eb 10                	jmp    804ec8 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804eb8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ebf:	eb 07                	jmp    804ec8 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804ec1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804ec8:	48 83 c4 38          	add    $0x38,%rsp
+  804ecc:	5b                   	pop    %rbx
+  804ecd:	41 5c                	pop    %r12
+  804ecf:	41 5d                	pop    %r13
+  804ed1:	41 5e                	pop    %r14
+  804ed3:	41 5f                	pop    %r15
+  804ed5:	5d                   	pop    %rbp
+  804ed6:	c3                   	ret
+
+0000000000804ed7 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804ed7:	55                   	push   %rbp
+  804ed8:	48 89 e5             	mov    %rsp,%rbp
+  804edb:	41 57                	push   %r15
+  804edd:	41 56                	push   %r14
+  804edf:	41 55                	push   %r13
+  804ee1:	41 54                	push   %r12
+  804ee3:	53                   	push   %rbx
+  804ee4:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804ee8:	49 89 fe             	mov    %rdi,%r14
+  804eeb:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804ef2:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804ef9:	00 
+  804efa:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f01:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804f08:	00 00 00 
+  804f0b:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804f12:	49 bf 5e 4b 80 00 00 	movabs $0x804b5e,%r15
+  804f19:	00 00 00 
+  804f1c:	eb 09                	jmp    804f27 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f1e:	48 83 c3 20          	add    $0x20,%rbx
+  804f22:	4c 39 eb             	cmp    %r13,%rbx
+  804f25:	74 33                	je     804f5a <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f27:	48 89 df             	mov    %rbx,%rdi
+  804f2a:	48 8b 33             	mov    (%rbx),%rsi
+  804f2d:	4c 39 e6             	cmp    %r12,%rsi
+  804f30:	73 ec                	jae    804f1e <msync+0x47>
+  804f32:	48 85 f6             	test   %rsi,%rsi
+  804f35:	74 e7                	je     804f1e <msync+0x47>
+  804f37:	48 89 f2             	mov    %rsi,%rdx
+  804f3a:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804f3e:	49 39 d6             	cmp    %rdx,%r14
+  804f41:	73 db                	jae    804f1e <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804f43:	4c 39 e2             	cmp    %r12,%rdx
+  804f46:	49 0f 47 d4          	cmova  %r12,%rdx
+  804f4a:	4c 39 f6             	cmp    %r14,%rsi
+  804f4d:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804f51:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804f54:	85 c0                	test   %eax,%eax
+  804f56:	79 c6                	jns    804f1e <msync+0x47>
+  804f58:	eb 05                	jmp    804f5f <msync+0x88>
+    }
+
+    return 0;
+  804f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f5f:	48 83 c4 08          	add    $0x8,%rsp
+  804f63:	5b                   	pop    %rbx
+  804f64:	41 5c                	pop    %r12
+  804f66:	41 5d                	pop    %r13
+  804f68:	41 5e                	pop    %r14
+  804f6a:	41 5f                	pop    %r15
+  804f6c:	5d                   	pop    %rbp
+  804f6d:	c3                   	ret
+
+0000000000804f6e <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804f6e:	55                   	push   %rbp
+  804f6f:	48 89 e5             	mov    %rsp,%rbp
+  804f72:	41 57                	push   %r15
+  804f74:	41 56                	push   %r14
+  804f76:	41 55                	push   %r13
+  804f78:	41 54                	push   %r12
+  804f7a:	53                   	push   %rbx
+  804f7b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804f7f:	49 89 ff             	mov    %rdi,%r15
+  804f82:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f89:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f90:	00 
+  804f91:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f98:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804f9f:	00 00 00 
+  804fa2:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804fa9:	48 89 d8             	mov    %rbx,%rax
+  804fac:	eb 09                	jmp    804fb7 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fae:	48 83 c0 20          	add    $0x20,%rax
+  804fb2:	4c 39 f0             	cmp    %r14,%rax
+  804fb5:	74 40                	je     804ff7 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804fb7:	48 8b 10             	mov    (%rax),%rdx
+  804fba:	4c 39 e2             	cmp    %r12,%rdx
+  804fbd:	73 ef                	jae    804fae <munmap+0x40>
+  804fbf:	48 85 d2             	test   %rdx,%rdx
+  804fc2:	74 ea                	je     804fae <munmap+0x40>
+  804fc4:	48 89 d7             	mov    %rdx,%rdi
+  804fc7:	48 03 78 08          	add    0x8(%rax),%rdi
+  804fcb:	49 39 ff             	cmp    %rdi,%r15
+  804fce:	73 de                	jae    804fae <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804fd0:	49 39 fc             	cmp    %rdi,%r12
+  804fd3:	72 05                	jb     804fda <munmap+0x6c>
+  804fd5:	4c 39 fa             	cmp    %r15,%rdx
+  804fd8:	73 d4                	jae    804fae <munmap+0x40>
+  804fda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804fdf:	48 83 c4 08          	add    $0x8,%rsp
+  804fe3:	5b                   	pop    %rbx
+  804fe4:	41 5c                	pop    %r12
+  804fe6:	41 5d                	pop    %r13
+  804fe8:	41 5e                	pop    %r14
+  804fea:	41 5f                	pop    %r15
+  804fec:	5d                   	pop    %rbp
+  804fed:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fee:	48 83 c3 20          	add    $0x20,%rbx
+  804ff2:	4c 39 f3             	cmp    %r14,%rbx
+  804ff5:	74 5c                	je     805053 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ff7:	48 8b 33             	mov    (%rbx),%rsi
+  804ffa:	4c 39 e6             	cmp    %r12,%rsi
+  804ffd:	73 ef                	jae    804fee <munmap+0x80>
+  804fff:	48 85 f6             	test   %rsi,%rsi
+  805002:	74 ea                	je     804fee <munmap+0x80>
+  805004:	48 89 f2             	mov    %rsi,%rdx
+  805007:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80500b:	49 39 d7             	cmp    %rdx,%r15
+  80500e:	73 de                	jae    804fee <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805010:	48 89 df             	mov    %rbx,%rdi
+  805013:	48 b8 5e 4b 80 00 00 	movabs $0x804b5e,%rax
+  80501a:	00 00 00 
+  80501d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80501f:	85 c0                	test   %eax,%eax
+  805021:	78 bc                	js     804fdf <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805023:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805027:	48 8b 33             	mov    (%rbx),%rsi
+  80502a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80502f:	48 b8 eb 28 80 00 00 	movabs $0x8028eb,%rax
+  805036:	00 00 00 
+  805039:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80503b:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80503e:	48 b8 16 32 80 00 00 	movabs $0x803216,%rax
+  805045:	00 00 00 
+  805048:	ff d0                	call   *%rax
+        reg->start = 0;
+  80504a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805051:	eb 9b                	jmp    804fee <munmap+0x80>
+    return 0;
+  805053:	b8 00 00 00 00       	mov    $0x0,%eax
+  805058:	eb 85                	jmp    804fdf <munmap+0x71>
+
+000000000080505a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80505a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80505f:	c3                   	ret
+
+0000000000805060 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805060:	55                   	push   %rbp
+  805061:	48 89 e5             	mov    %rsp,%rbp
+  805064:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805067:	48 be 05 66 80 00 00 	movabs $0x806605,%rsi
+  80506e:	00 00 00 
+  805071:	48 b8 ae 20 80 00 00 	movabs $0x8020ae,%rax
+  805078:	00 00 00 
+  80507b:	ff d0                	call   *%rax
+    return 0;
+}
+  80507d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805082:	5d                   	pop    %rbp
+  805083:	c3                   	ret
+
+0000000000805084 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805084:	55                   	push   %rbp
+  805085:	48 89 e5             	mov    %rsp,%rbp
+  805088:	41 57                	push   %r15
+  80508a:	41 56                	push   %r14
+  80508c:	41 55                	push   %r13
+  80508e:	41 54                	push   %r12
+  805090:	53                   	push   %rbx
+  805091:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805098:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80509f:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8050a6:	00 00 00 00 
+  8050aa:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8050b1:	00 00 00 00 
+  8050b5:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8050bc:	00 00 00 00 
+  8050c0:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8050c7:	00 00 00 00 
+  8050cb:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8050d2:	00 00 00 00 
+  8050d6:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8050dd:	00 00 00 00 
+  8050e1:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8050e8:	00 
+  8050e9:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8050f0:	00 
+  8050f1:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8050f8:	00 
+  8050f9:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805100:	00 
+  805101:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805108:	00 
+  805109:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805110:	00 
+  805111:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805118:	00 
+  805119:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805120:	00 
+  805121:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805128:	00 
+  805129:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805130:	00 
+    for (res = 0; res < n; res += inc) {
+  805131:	48 85 d2             	test   %rdx,%rdx
+  805134:	74 7a                	je     8051b0 <devcons_write+0x12c>
+  805136:	49 89 d6             	mov    %rdx,%r14
+  805139:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80513f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805144:	49 bf fe 23 80 00 00 	movabs $0x8023fe,%r15
+  80514b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80514e:	4c 89 f3             	mov    %r14,%rbx
+  805151:	48 29 f3             	sub    %rsi,%rbx
+  805154:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805159:	48 39 c3             	cmp    %rax,%rbx
+  80515c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805160:	4c 63 eb             	movslq %ebx,%r13
+  805163:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80516a:	48 01 c6             	add    %rax,%rsi
+  80516d:	4c 89 ea             	mov    %r13,%rdx
+  805170:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805177:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80517a:	4c 89 ee             	mov    %r13,%rsi
+  80517d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805184:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80518b:	00 00 00 
+  80518e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805190:	41 01 dc             	add    %ebx,%r12d
+  805193:	49 63 f4             	movslq %r12d,%rsi
+  805196:	4c 39 f6             	cmp    %r14,%rsi
+  805199:	72 b3                	jb     80514e <devcons_write+0xca>
+    return res;
+  80519b:	49 63 c4             	movslq %r12d,%rax
+}
+  80519e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8051a5:	5b                   	pop    %rbx
+  8051a6:	41 5c                	pop    %r12
+  8051a8:	41 5d                	pop    %r13
+  8051aa:	41 5e                	pop    %r14
+  8051ac:	41 5f                	pop    %r15
+  8051ae:	5d                   	pop    %rbp
+  8051af:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8051b0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8051b6:	eb e3                	jmp    80519b <devcons_write+0x117>
+
+00000000008051b8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8051b8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8051bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051c0:	48 85 c0             	test   %rax,%rax
+  8051c3:	74 55                	je     80521a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8051c5:	55                   	push   %rbp
+  8051c6:	48 89 e5             	mov    %rsp,%rbp
+  8051c9:	41 55                	push   %r13
+  8051cb:	41 54                	push   %r12
+  8051cd:	53                   	push   %rbx
+  8051ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8051d2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8051d5:	48 bb 5e 26 80 00 00 	movabs $0x80265e,%rbx
+  8051dc:	00 00 00 
+  8051df:	49 bc 72 27 80 00 00 	movabs $0x802772,%r12
+  8051e6:	00 00 00 
+  8051e9:	eb 03                	jmp    8051ee <devcons_read+0x36>
+  8051eb:	41 ff d4             	call   *%r12
+  8051ee:	ff d3                	call   *%rbx
+  8051f0:	85 c0                	test   %eax,%eax
+  8051f2:	74 f7                	je     8051eb <devcons_read+0x33>
+    if (c < 0) return c;
+  8051f4:	48 63 d0             	movslq %eax,%rdx
+  8051f7:	78 13                	js     80520c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8051f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051fe:	83 f8 04             	cmp    $0x4,%eax
+  805201:	74 09                	je     80520c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805203:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805207:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80520c:	48 89 d0             	mov    %rdx,%rax
+  80520f:	48 83 c4 08          	add    $0x8,%rsp
+  805213:	5b                   	pop    %rbx
+  805214:	41 5c                	pop    %r12
+  805216:	41 5d                	pop    %r13
+  805218:	5d                   	pop    %rbp
+  805219:	c3                   	ret
+  80521a:	48 89 d0             	mov    %rdx,%rax
+  80521d:	c3                   	ret
+
+000000000080521e <cputchar>:
+cputchar(int ch) {
+  80521e:	55                   	push   %rbp
+  80521f:	48 89 e5             	mov    %rsp,%rbp
+  805222:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805226:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80522a:	be 01 00 00 00       	mov    $0x1,%esi
+  80522f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805233:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80523a:	00 00 00 
+  80523d:	ff d0                	call   *%rax
+}
+  80523f:	c9                   	leave
+  805240:	c3                   	ret
+
+0000000000805241 <getchar>:
+getchar(void) {
+  805241:	55                   	push   %rbp
+  805242:	48 89 e5             	mov    %rsp,%rbp
+  805245:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805249:	ba 01 00 00 00       	mov    $0x1,%edx
+  80524e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805252:	bf 00 00 00 00       	mov    $0x0,%edi
+  805257:	48 b8 94 33 80 00 00 	movabs $0x803394,%rax
+  80525e:	00 00 00 
+  805261:	ff d0                	call   *%rax
+  805263:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805265:	85 c0                	test   %eax,%eax
+  805267:	78 06                	js     80526f <getchar+0x2e>
+  805269:	74 08                	je     805273 <getchar+0x32>
+  80526b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80526f:	89 d0                	mov    %edx,%eax
+  805271:	c9                   	leave
+  805272:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805273:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805278:	eb f5                	jmp    80526f <getchar+0x2e>
+
+000000000080527a <iscons>:
+iscons(int fdnum) {
+  80527a:	55                   	push   %rbp
+  80527b:	48 89 e5             	mov    %rsp,%rbp
+  80527e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805282:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805286:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  80528d:	00 00 00 
+  805290:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805292:	85 c0                	test   %eax,%eax
+  805294:	78 18                	js     8052ae <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805296:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80529a:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8052a1:	00 00 00 
+  8052a4:	8b 00                	mov    (%rax),%eax
+  8052a6:	39 02                	cmp    %eax,(%rdx)
+  8052a8:	0f 94 c0             	sete   %al
+  8052ab:	0f b6 c0             	movzbl %al,%eax
+}
+  8052ae:	c9                   	leave
+  8052af:	c3                   	ret
+
+00000000008052b0 <opencons>:
+opencons(void) {
+  8052b0:	55                   	push   %rbp
+  8052b1:	48 89 e5             	mov    %rsp,%rbp
+  8052b4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8052b8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8052bc:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  8052c3:	00 00 00 
+  8052c6:	ff d0                	call   *%rax
+  8052c8:	85 c0                	test   %eax,%eax
+  8052ca:	78 49                	js     805315 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8052cc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8052d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052d6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8052da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052df:	48 b8 13 28 80 00 00 	movabs $0x802813,%rax
+  8052e6:	00 00 00 
+  8052e9:	ff d0                	call   *%rax
+  8052eb:	85 c0                	test   %eax,%eax
+  8052ed:	78 26                	js     805315 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8052ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052f3:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8052fa:	00 00 
+  8052fc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8052fe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805302:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805309:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  805310:	00 00 00 
+  805313:	ff d0                	call   *%rax
+}
+  805315:	c9                   	leave
+  805316:	c3                   	ret
+
+0000000000805317 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805317:	55                   	push   %rbp
+  805318:	48 89 e5             	mov    %rsp,%rbp
+  80531b:	41 56                	push   %r14
+  80531d:	41 55                	push   %r13
+  80531f:	41 54                	push   %r12
+  805321:	53                   	push   %rbx
+  805322:	48 83 ec 50          	sub    $0x50,%rsp
+  805326:	49 89 fc             	mov    %rdi,%r12
+  805329:	41 89 f5             	mov    %esi,%r13d
+  80532c:	48 89 d3             	mov    %rdx,%rbx
+  80532f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805333:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  805337:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80533b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805342:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805346:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80534a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80534e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805352:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  805359:	00 00 00 
+  80535c:	4c 8b 30             	mov    (%rax),%r14
+  80535f:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  805366:	00 00 00 
+  805369:	ff d0                	call   *%rax
+  80536b:	89 c6                	mov    %eax,%esi
+  80536d:	45 89 e8             	mov    %r13d,%r8d
+  805370:	4c 89 e1             	mov    %r12,%rcx
+  805373:	4c 89 f2             	mov    %r14,%rdx
+  805376:	48 bf 18 66 80 00 00 	movabs $0x806618,%rdi
+  80537d:	00 00 00 
+  805380:	b8 00 00 00 00       	mov    $0x0,%eax
+  805385:	49 bc 77 17 80 00 00 	movabs $0x801777,%r12
+  80538c:	00 00 00 
+  80538f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805392:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805396:	48 89 df             	mov    %rbx,%rdi
+  805399:	48 b8 13 17 80 00 00 	movabs $0x801713,%rax
+  8053a0:	00 00 00 
+  8053a3:	ff d0                	call   *%rax
+    cprintf("\n");
+  8053a5:	48 bf b1 5e 80 00 00 	movabs $0x805eb1,%rdi
+  8053ac:	00 00 00 
+  8053af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053b4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8053b7:	cc                   	int3
+  8053b8:	eb fd                	jmp    8053b7 <_panic+0xa0>
+
+00000000008053ba <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8053ba:	55                   	push   %rbp
+  8053bb:	48 89 e5             	mov    %rsp,%rbp
+  8053be:	41 56                	push   %r14
+  8053c0:	41 55                	push   %r13
+  8053c2:	41 54                	push   %r12
+  8053c4:	53                   	push   %rbx
+  8053c5:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053c8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053cf:	00 00 00 
+  8053d2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8053d6:	74 27                	je     8053ff <_handle_vectored_pagefault+0x45>
+  8053d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8053dd:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8053e4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053e7:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8053ea:	4c 89 e7             	mov    %r12,%rdi
+  8053ed:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8053f2:	84 c0                	test   %al,%al
+  8053f4:	75 45                	jne    80543b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053f6:	48 83 c3 01          	add    $0x1,%rbx
+  8053fa:	49 3b 1e             	cmp    (%r14),%rbx
+  8053fd:	72 eb                	jb     8053ea <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8053ff:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805406:	00 
+  805407:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80540c:	4d 8b 04 24          	mov    (%r12),%r8
+  805410:	48 ba 40 66 80 00 00 	movabs $0x806640,%rdx
+  805417:	00 00 00 
+  80541a:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80541f:	48 bf 70 66 80 00 00 	movabs $0x806670,%rdi
+  805426:	00 00 00 
+  805429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80542e:	49 ba 17 53 80 00 00 	movabs $0x805317,%r10
+  805435:	00 00 00 
+  805438:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80543b:	5b                   	pop    %rbx
+  80543c:	41 5c                	pop    %r12
+  80543e:	41 5d                	pop    %r13
+  805440:	41 5e                	pop    %r14
+  805442:	5d                   	pop    %rbp
+  805443:	c3                   	ret
+
+0000000000805444 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805444:	55                   	push   %rbp
+  805445:	48 89 e5             	mov    %rsp,%rbp
+  805448:	53                   	push   %rbx
+  805449:	48 83 ec 08          	sub    $0x8,%rsp
+  80544d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805450:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805455:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80545c:	00 00 00 
+  80545f:	80 38 00             	cmpb   $0x0,(%rax)
+  805462:	74 68                	je     8054cc <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805464:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80546b:	00 00 00 
+  80546e:	48 8b 08             	mov    (%rax),%rcx
+  805471:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805476:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80547d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805480:	48 85 c9             	test   %rcx,%rcx
+  805483:	0f 84 e0 00 00 00    	je     805569 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805489:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80548d:	0f 84 c9 00 00 00    	je     80555c <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805493:	48 83 c2 01          	add    $0x1,%rdx
+  805497:	48 39 ca             	cmp    %rcx,%rdx
+  80549a:	75 ed                	jne    805489 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80549c:	48 83 f9 08          	cmp    $0x8,%rcx
+  8054a0:	0f 84 84 00 00 00    	je     80552a <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8054a6:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8054aa:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8054b1:	00 00 00 
+  8054b4:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8054bb:	00 00 00 
+  8054be:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8054c2:	85 f6                	test   %esi,%esi
+  8054c4:	0f 89 97 00 00 00    	jns    805561 <add_pgfault_handler+0x11d>
+  8054ca:	eb 63                	jmp    80552f <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8054cc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8054d1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8054d6:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8054dd:	00 00 00 
+  8054e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054e5:	48 b8 13 28 80 00 00 	movabs $0x802813,%rax
+  8054ec:	00 00 00 
+  8054ef:	ff d0                	call   *%rax
+  8054f1:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8054f3:	85 c0                	test   %eax,%eax
+  8054f5:	78 38                	js     80552f <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8054f7:	48 be 45 56 80 00 00 	movabs $0x805645,%rsi
+  8054fe:	00 00 00 
+  805501:	bf 00 00 00 00       	mov    $0x0,%edi
+  805506:	48 b8 36 2a 80 00 00 	movabs $0x802a36,%rax
+  80550d:	00 00 00 
+  805510:	ff d0                	call   *%rax
+  805512:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805514:	85 c0                	test   %eax,%eax
+  805516:	78 17                	js     80552f <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805518:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80551f:	00 00 00 
+  805522:	c6 00 01             	movb   $0x1,(%rax)
+  805525:	e9 3a ff ff ff       	jmp    805464 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80552a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80552f:	89 f1                	mov    %esi,%ecx
+  805531:	48 ba 7e 66 80 00 00 	movabs $0x80667e,%rdx
+  805538:	00 00 00 
+  80553b:	be 42 00 00 00       	mov    $0x42,%esi
+  805540:	48 bf 70 66 80 00 00 	movabs $0x806670,%rdi
+  805547:	00 00 00 
+  80554a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80554f:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  805556:	00 00 00 
+  805559:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80555c:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805561:	89 f0                	mov    %esi,%eax
+  805563:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805567:	c9                   	leave
+  805568:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805569:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805570:	00 00 00 
+  805573:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80557a:	48 89 d8             	mov    %rbx,%rax
+  80557d:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805584:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805587:	eb d8                	jmp    805561 <add_pgfault_handler+0x11d>
+
+0000000000805589 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805589:	55                   	push   %rbp
+  80558a:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80558d:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805594:	00 00 00 
+  805597:	80 38 00             	cmpb   $0x0,(%rax)
+  80559a:	74 33                	je     8055cf <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80559c:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8055a3:	00 00 00 
+  8055a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8055ab:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8055b2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055b5:	48 85 c0             	test   %rax,%rax
+  8055b8:	0f 84 85 00 00 00    	je     805643 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8055be:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8055c2:	74 40                	je     805604 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055c4:	48 83 c1 01          	add    $0x1,%rcx
+  8055c8:	48 39 c1             	cmp    %rax,%rcx
+  8055cb:	75 f1                	jne    8055be <remove_pgfault_handler+0x35>
+  8055cd:	eb 74                	jmp    805643 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8055cf:	48 b9 96 66 80 00 00 	movabs $0x806696,%rcx
+  8055d6:	00 00 00 
+  8055d9:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  8055e0:	00 00 00 
+  8055e3:	be 48 00 00 00       	mov    $0x48,%esi
+  8055e8:	48 bf 70 66 80 00 00 	movabs $0x806670,%rdi
+  8055ef:	00 00 00 
+  8055f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055f7:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  8055fe:	00 00 00 
+  805601:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805604:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80560b:	00 
+  80560c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805610:	48 29 ca             	sub    %rcx,%rdx
+  805613:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80561a:	00 00 00 
+  80561d:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805621:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805626:	48 89 ce             	mov    %rcx,%rsi
+  805629:	48 b8 fe 23 80 00 00 	movabs $0x8023fe,%rax
+  805630:	00 00 00 
+  805633:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805635:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80563c:	00 00 00 
+  80563f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805643:	5d                   	pop    %rbp
+  805644:	c3                   	ret
+
+0000000000805645 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805645:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805648:	48 b8 ba 53 80 00 00 	movabs $0x8053ba,%rax
+  80564f:	00 00 00 
+    call *%rax
+  805652:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805654:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80565b:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80565c:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805663:	00 
+    subq $8, %rcx
+  805664:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805668:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80566b:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805672:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805673:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805677:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80567b:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805680:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805685:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80568a:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80568f:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805694:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805699:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80569e:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8056a3:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8056a8:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8056ad:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8056b2:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8056b7:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8056bc:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8056c1:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8056c5:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8056c9:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8056ca:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8056cb:	c3                   	ret
+
+00000000008056cc <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8056cc:	85 ff                	test   %edi,%edi
+  8056ce:	78 58                	js     805728 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8056d0:	48 85 f6             	test   %rsi,%rsi
+  8056d3:	74 12                	je     8056e7 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8056d5:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056dc:	00 00 00 
+  8056df:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8056e5:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8056e7:	48 85 c9             	test   %rcx,%rcx
+  8056ea:	74 12                	je     8056fe <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8056ec:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056f3:	00 00 00 
+  8056f6:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8056fc:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8056fe:	48 85 d2             	test   %rdx,%rdx
+  805701:	74 14                	je     805717 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805703:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80570a:	00 00 00 
+  80570d:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805714:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805717:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80571e:	00 00 00 
+  805721:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805727:	c3                   	ret
+        if (from_env_store) {
+  805728:	48 85 f6             	test   %rsi,%rsi
+  80572b:	74 06                	je     805733 <ipc_result+0x67>
+            *from_env_store = 0;
+  80572d:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805733:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805735:	48 85 c9             	test   %rcx,%rcx
+  805738:	74 ed                	je     805727 <ipc_result+0x5b>
+            *perm_store = 0;
+  80573a:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805740:	c3                   	ret
+
+0000000000805741 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805741:	55                   	push   %rbp
+  805742:	48 89 e5             	mov    %rsp,%rbp
+  805745:	41 55                	push   %r13
+  805747:	41 54                	push   %r12
+  805749:	53                   	push   %rbx
+  80574a:	48 83 ec 08          	sub    $0x8,%rsp
+  80574e:	49 89 fc             	mov    %rdi,%r12
+  805751:	48 89 f7             	mov    %rsi,%rdi
+  805754:	48 89 d3             	mov    %rdx,%rbx
+  805757:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80575a:	48 85 f6             	test   %rsi,%rsi
+  80575d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805764:	00 00 00 
+  805767:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80576b:	be 00 00 00 00       	mov    $0x0,%esi
+  805770:	48 85 d2             	test   %rdx,%rdx
+  805773:	74 03                	je     805778 <ipc_recv+0x37>
+  805775:	48 8b 32             	mov    (%rdx),%rsi
+  805778:	48 b8 5f 2d 80 00 00 	movabs $0x802d5f,%rax
+  80577f:	00 00 00 
+  805782:	ff d0                	call   *%rax
+  805784:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805786:	4c 89 e9             	mov    %r13,%rcx
+  805789:	48 89 da             	mov    %rbx,%rdx
+  80578c:	4c 89 e6             	mov    %r12,%rsi
+  80578f:	48 b8 cc 56 80 00 00 	movabs $0x8056cc,%rax
+  805796:	00 00 00 
+  805799:	ff d0                	call   *%rax
+}
+  80579b:	48 83 c4 08          	add    $0x8,%rsp
+  80579f:	5b                   	pop    %rbx
+  8057a0:	41 5c                	pop    %r12
+  8057a2:	41 5d                	pop    %r13
+  8057a4:	5d                   	pop    %rbp
+  8057a5:	c3                   	ret
+
+00000000008057a6 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8057a6:	55                   	push   %rbp
+  8057a7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057aa:	48 85 d2             	test   %rdx,%rdx
+  8057ad:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057b4:	00 00 00 
+  8057b7:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8057bb:	89 f6                	mov    %esi,%esi
+  8057bd:	48 b8 eb 2b 80 00 00 	movabs $0x802beb,%rax
+  8057c4:	00 00 00 
+  8057c7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8057c9:	85 c0                	test   %eax,%eax
+  8057cb:	78 02                	js     8057cf <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8057cd:	5d                   	pop    %rbp
+  8057ce:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8057cf:	89 c1                	mov    %eax,%ecx
+  8057d1:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  8057d8:	00 00 00 
+  8057db:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8057e0:	48 bf bd 66 80 00 00 	movabs $0x8066bd,%rdi
+  8057e7:	00 00 00 
+  8057ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057ef:	49 b8 17 53 80 00 00 	movabs $0x805317,%r8
+  8057f6:	00 00 00 
+  8057f9:	41 ff d0             	call   *%r8
+
+00000000008057fc <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8057fc:	55                   	push   %rbp
+  8057fd:	48 89 e5             	mov    %rsp,%rbp
+  805800:	53                   	push   %rbx
+  805801:	48 83 ec 08          	sub    $0x8,%rsp
+  805805:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805809:	48 85 d2             	test   %rdx,%rdx
+  80580c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805813:	00 00 00 
+  805816:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80581a:	4d 85 c9             	test   %r9,%r9
+  80581d:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805821:	b8 00 00 00 00       	mov    $0x0,%eax
+  805826:	48 85 db             	test   %rbx,%rbx
+  805829:	74 03                	je     80582e <ipc_call+0x32>
+  80582b:	48 8b 03             	mov    (%rbx),%rax
+  80582e:	89 f6                	mov    %esi,%esi
+  805830:	48 83 ec 08          	sub    $0x8,%rsp
+  805834:	50                   	push   %rax
+  805835:	48 b8 1d 2c 80 00 00 	movabs $0x802c1d,%rax
+  80583c:	00 00 00 
+  80583f:	ff d0                	call   *%rax
+  805841:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805843:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805847:	48 89 da             	mov    %rbx,%rdx
+  80584a:	be 00 00 00 00       	mov    $0x0,%esi
+  80584f:	48 b8 cc 56 80 00 00 	movabs $0x8056cc,%rax
+  805856:	00 00 00 
+  805859:	ff d0                	call   *%rax
+}
+  80585b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80585f:	c9                   	leave
+  805860:	c3                   	ret
+
+0000000000805861 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805861:	55                   	push   %rbp
+  805862:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805865:	89 f6                	mov    %esi,%esi
+  805867:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  80586e:	00 00 00 
+  805871:	ff d0                	call   *%rax
+  805873:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805875:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80587a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80587f:	be 00 00 00 00       	mov    $0x0,%esi
+  805884:	48 b8 cc 56 80 00 00 	movabs $0x8056cc,%rax
+  80588b:	00 00 00 
+  80588e:	ff d0                	call   *%rax
+}
+  805890:	5d                   	pop    %rbp
+  805891:	c3                   	ret
+
+0000000000805892 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805892:	55                   	push   %rbp
+  805893:	48 89 e5             	mov    %rsp,%rbp
+  805896:	41 54                	push   %r12
+  805898:	53                   	push   %rbx
+  805899:	4c 89 cb             	mov    %r9,%rbx
+  80589c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8058a0:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8058a4:	48 85 d2             	test   %rdx,%rdx
+  8058a7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058ae:	00 00 00 
+  8058b1:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8058b5:	4d 85 c9             	test   %r9,%r9
+  8058b8:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8058bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058c1:	4d 85 e4             	test   %r12,%r12
+  8058c4:	74 04                	je     8058ca <ipc_reply_wait+0x38>
+  8058c6:	49 8b 04 24          	mov    (%r12),%rax
+  8058ca:	89 f6                	mov    %esi,%esi
+  8058cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8058d0:	50                   	push   %rax
+  8058d1:	48 b8 f3 2c 80 00 00 	movabs $0x802cf3,%rax
+  8058d8:	00 00 00 
+  8058db:	ff d0                	call   *%rax
+  8058dd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8058df:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8058e3:	4c 89 e2             	mov    %r12,%rdx
+  8058e6:	48 89 de             	mov    %rbx,%rsi
+  8058e9:	48 b8 cc 56 80 00 00 	movabs $0x8056cc,%rax
+  8058f0:	00 00 00 
+  8058f3:	ff d0                	call   *%rax
+}
+  8058f5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8058f9:	5b                   	pop    %rbx
+  8058fa:	41 5c                	pop    %r12
+  8058fc:	5d                   	pop    %rbp
+  8058fd:	c3                   	ret
+
+00000000008058fe <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8058fe:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805903:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80590a:	00 00 00 
+  80590d:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805914:	48 01 ca             	add    %rcx,%rdx
+  805917:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80591d:	39 fa                	cmp    %edi,%edx
+  80591f:	74 12                	je     805933 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805921:	48 83 c0 01          	add    $0x1,%rax
+  805925:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80592b:	75 e0                	jne    80590d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80592d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805932:	c3                   	ret
+            return envs[i].env_id;
+  805933:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80593a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805941:	00 00 00 
+  805944:	48 01 d0             	add    %rdx,%rax
+  805947:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80594d:	c3                   	ret
+  80594e:	66 90                	xchg   %ax,%ax
+
+0000000000805950 <__rodata_start>:
+  805950:	77 00                	ja     805952 <__rodata_start+0x2>
+  805952:	72 62                	jb     8059b6 <__rodata_start+0x66>
+  805954:	00 77 62             	add    %dh,0x62(%rdi)
+  805957:	00 0f                	add    %cl,(%rdi)
+  805959:	1f                   	(bad)
+  80595a:	84 00                	test   %al,(%rax)
+  80595c:	00 00                	add    %al,(%rax)
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	b3 09                	mov    $0x9,%bl
+  805962:	80 00 00             	addb   $0x0,(%rax)
+  805965:	00 00                	add    %al,(%rax)
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 ed                	add    %ch,%ch
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	8c 0a                	mov    %cs,(%rdx)
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	8c 0a                	mov    %cs,(%rdx)
+  8059ca:	80 00 00             	addb   $0x0,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	8c 0a                	mov    %cs,(%rdx)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	8c 0a                	mov    %cs,(%rdx)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	8c 0a                	mov    %cs,(%rdx)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	ed                   	in     (%dx),%eax
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	ed                   	in     (%dx),%eax
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	f4                   	hlt
+  805af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805aff:	00 ed                	add    %ch,%ch
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	2c 0b                	sub    $0xb,%al
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 ed                	add    %ch,%ch
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	ed                   	in     (%dx),%eax
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805b53:	00 00                	add    %al,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 cb                	add    %cl,%bl
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	ed                   	in     (%dx),%eax
+  805b71:	0d 80 00 00 00       	or     $0x80,%eax
+  805b76:	00 00                	add    %al,(%rax)
+  805b78:	6a 0a                	push   $0xa
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 ed                	add    %ch,%ch
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	3c 0a                	cmp    $0xa,%al
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 ed                	add    %ch,%ch
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805bab:	00 00                	add    %al,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 29                	add    %ch,(%rcx)
+  805bb9:	0c 80                	or     $0x80,%al
+  805bbb:	00 00                	add    %al,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 ed                	add    %ch,%ch
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	1a 0b                	sbb    (%rbx),%cl
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 ed                	add    %ch,%ch
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ce                   	(bad)
+  805be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805be7:	00 ed                	add    %ch,%ch
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	f4                   	hlt
+  805bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805bff:	00 37                	add    %dh,(%rdi)
+  805c01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 37                	add    %dh,(%rdi)
+  805c11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805c2b:	00 00                	add    %al,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 d2                	add    %dl,%dl
+  805c31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c37:	00 d2                	add    %dl,%dl
+  805c39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c3f:	00 d2                	add    %dl,%dl
+  805c41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c47:	00 d2                	add    %dl,%dl
+  805c49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c4f:	00 d2                	add    %dl,%dl
+  805c51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c57:	00 d2                	add    %dl,%dl
+  805c59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c5f:	00 d2                	add    %dl,%dl
+  805c61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c67:	00 f6                	add    %dh,%dh
+  805c69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c6f:	00 f6                	add    %dh,%dh
+  805c71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 22                	add    %ah,(%rdx)
+  805cb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cb7:	00 22                	add    %ah,(%rdx)
+  805cb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cbf:	00 22                	add    %ah,(%rdx)
+  805cc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cc7:	00 22                	add    %ah,(%rdx)
+  805cc9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ccf:	00 22                	add    %ah,(%rdx)
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 22                	add    %ah,(%rdx)
+  805cd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 46 12             	add    %al,0x12(%rsi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 22                	add    %ah,(%rdx)
+  805db1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805db7:	00 22                	add    %ah,(%rdx)
+  805db9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dbf:	00 22                	add    %ah,(%rdx)
+  805dc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dc7:	00 22                	add    %ah,(%rdx)
+  805dc9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dcf:	00 22                	add    %ah,(%rdx)
+  805dd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dd7:	00 22                	add    %ah,(%rdx)
+  805dd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 46 12             	add    %al,0x12(%rsi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805e80 <basefix.0>:
+  805e80:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805e90:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805ea0:	10 00 25 30 34 78 3a 20 49 20 61 6d 20 27 25 73     ..%04x: I am '%s
+  805eb0:	27 0a 00 25 73 25 63 00 3c 75 6e 6b 6e 6f 77 6e     '..%s%c.<unknown
+  805ec0:	3e 00 30 31 32 33 34 35 36 37 38 39 41 42 43 44     >.0123456789ABCD
+  805ed0:	45 46 00 30 31 32 33 34 35 36 37 38 39 61 62 63     EF.0123456789abc
+  805ee0:	64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f 72     def.(null).error
+  805ef0:	20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64 20      %d.unspecified 
+  805f00:	65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72 6f     error.bad enviro
+  805f10:	6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70 61     nment.invalid pa
+  805f20:	72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20 6d     rameter.out of m
+  805f30:	65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e 76     emory.out of env
+  805f40:	69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75 70     ironments.corrup
+  805f50:	74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00 73     ted debug info.s
+  805f60:	65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75 6c     egmentation faul
+  805f70:	74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69 6d     t.invalid ELF im
+  805f80:	61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73 74     age.no such syst
+  805f90:	65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e 6f     em call.entry no
+  805fa0:	74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20 6e     t found.env is n
+  805fb0:	6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78 70     ot recving.unexp
+  805fc0:	65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69 6c     ected end of fil
+  805fd0:	65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65 20     e.no free space 
+  805fe0:	6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e 79     on disk.too many
+  805ff0:	20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e 00      files are open.
+  806000:	66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e 6f     file or block no
+  806010:	74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64 20     t found.invalid 
+  806020:	70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61 64     path.file alread
+  806030:	79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74 69     y exists.operati
+  806040:	6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65 64     on not supported
+  806050:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
+  806060:	6f 19 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     o...............
+  806070:	b6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806080:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806090:	c6 1f 80 00 00 00 00 00 8e 19 80 00 00 00 00 00     ................
+  8060a0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8060b0:	82 19 80 00 00 00 00 00 fc 19 80 00 00 00 00 00     ................
+  8060c0:	c6 1f 80 00 00 00 00 00 82 19 80 00 00 00 00 00     ................
+  8060d0:	c8 19 80 00 00 00 00 00 c8 19 80 00 00 00 00 00     ................
+  8060e0:	c8 19 80 00 00 00 00 00 c8 19 80 00 00 00 00 00     ................
+  8060f0:	c8 19 80 00 00 00 00 00 c8 19 80 00 00 00 00 00     ................
+  806100:	c8 19 80 00 00 00 00 00 c8 19 80 00 00 00 00 00     ................
+  806110:	c8 19 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806120:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806130:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806140:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806150:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806160:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806170:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806180:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806190:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8061a0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8061b0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8061c0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8061d0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8061e0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8061f0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806200:	c6 1f 80 00 00 00 00 00 e4 1e 80 00 00 00 00 00     ................
+  806210:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806220:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806230:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806240:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806250:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806260:	2a 1a 80 00 00 00 00 00 f9 1b 80 00 00 00 00 00     *...............
+  806270:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806280:	c6 1f 80 00 00 00 00 00 1f 1a 80 00 00 00 00 00     ................
+  806290:	59 1a 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     Y...............
+  8062a0:	c6 1f 80 00 00 00 00 00 14 1a 80 00 00 00 00 00     ................
+  8062b0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8062c0:	a2 1d 80 00 00 00 00 00 71 1e 80 00 00 00 00 00     ........q.......
+  8062d0:	c6 1f 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8062e0:	f0 1a 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  8062f0:	cd 1c 80 00 00 00 00 00 c6 1f 80 00 00 00 00 00     ................
+  806300:	c6 1f 80 00 00 00 00 00 e4 1e 80 00 00 00 00 00     ................
+  806310:	c6 1f 80 00 00 00 00 00 78 19 80 00 00 00 00 00     ........x.......
+
+0000000000806320 <error_string>:
+	...
+  806328:	f4 5e 80 00 00 00 00 00 06 5f 80 00 00 00 00 00     .^......._......
+  806338:	16 5f 80 00 00 00 00 00 28 5f 80 00 00 00 00 00     ._......(_......
+  806348:	36 5f 80 00 00 00 00 00 4a 5f 80 00 00 00 00 00     6_......J_......
+  806358:	5f 5f 80 00 00 00 00 00 72 5f 80 00 00 00 00 00     __......r_......
+  806368:	84 5f 80 00 00 00 00 00 98 5f 80 00 00 00 00 00     ._......._......
+  806378:	a8 5f 80 00 00 00 00 00 bb 5f 80 00 00 00 00 00     ._......._......
+  806388:	d2 5f 80 00 00 00 00 00 e8 5f 80 00 00 00 00 00     ._......._......
+  806398:	00 60 80 00 00 00 00 00 18 60 80 00 00 00 00 00     .`.......`......
+  8063a8:	25 60 80 00 00 00 00 00 c0 63 80 00 00 00 00 00     %`.......c......
+  8063b8:	39 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     9`......file is 
+  8063c8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8063d8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8063e8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8063f8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806408:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806418:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806428:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806438:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806448:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806458:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806468:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806478:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806488:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806498:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8064a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8064b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8064c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8064d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8064e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8064f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806508:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806518:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806520 <devtab>:
+  806520:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806530:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806540:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806550:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806560:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806570:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806580:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806590:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8065a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8065b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8065c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8065d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8065e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8065f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806600:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806610:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806620:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806630:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806640:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806650:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806660:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806670:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806680:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806690:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8066a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8066b0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8066c0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,10327 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 35 3c 80 00 00 	movabs $0x803c35,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 35 3c 80 00 00 	movabs $0x803c35,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be d5 5c 80 00 00 	movabs $0x805cd5,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 be 20 80 00 00 	movabs $0x8020be,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 c8 39 80 00 00 	movabs $0x8039c8,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be f0 56 80 00 00 	movabs $0x8056f0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 be 20 80 00 00 	movabs $0x8020be,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 c8 39 80 00 00 	movabs $0x8039c8,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be f2 56 80 00 00 	movabs $0x8056f2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 be 20 80 00 00 	movabs $0x8020be,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 c8 39 80 00 00 	movabs $0x8039c8,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be f5 56 80 00 00 	movabs $0x8056f5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 be 20 80 00 00 	movabs $0x8020be,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 c8 39 80 00 00 	movabs $0x8039c8,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 0a 4d 80 00 00 	movabs $0x804d0a,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 49 33 80 00 00 	movabs $0x803349,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 12 34 80 00 00 	movabs $0x803412,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 18 33 80 00 00 	movabs $0x803318,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 30 31 80 00 00 	movabs $0x803130,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 c8 39 80 00 00 	movabs $0x8039c8,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 6b 22 80 00 00 	movabs $0x80226b,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 6b 22 80 00 00 	movabs $0x80226b,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 6b 22 80 00 00 	movabs $0x80226b,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be a0 59 80 00 00 	movabs $0x8059a0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 6b 22 80 00 00 	movabs $0x80226b,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 6b 22 80 00 00 	movabs $0x80226b,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 20 5c 80 00 00 	movabs $0x805c20,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 20 5c 80 00 00 	movabs $0x805c20,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 c3 24 80 00 00 	movabs $0x8024c3,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 c3 24 80 00 00 	movabs $0x8024c3,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 4d 00 00 00       	call   80154c <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+/* hello, world */
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("hello, world\n");
+  80150a:	48 bf 42 5c 80 00 00 	movabs $0x805c42,%rdi
+  801511:	00 00 00 
+  801514:	b8 00 00 00 00       	mov    $0x0,%eax
+  801519:	48 bb c5 16 80 00 00 	movabs $0x8016c5,%rbx
+  801520:	00 00 00 
+  801523:	ff d3                	call   *%rbx
+    cprintf("i am environment %08x\n", thisenv->env_id);
+  801525:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80152c:	00 00 00 
+  80152f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801535:	48 bf 50 5c 80 00 00 	movabs $0x805c50,%rdi
+  80153c:	00 00 00 
+  80153f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801544:	ff d3                	call   *%rbx
+}
+  801546:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154a:	c9                   	leave
+  80154b:	c3                   	ret
+
+000000000080154c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80154c:	55                   	push   %rbp
+  80154d:	48 89 e5             	mov    %rsp,%rbp
+  801550:	41 56                	push   %r14
+  801552:	41 55                	push   %r13
+  801554:	41 54                	push   %r12
+  801556:	53                   	push   %rbx
+  801557:	41 89 fd             	mov    %edi,%r13d
+  80155a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80155d:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801564:	00 00 00 
+  801567:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80156e:	00 00 00 
+  801571:	48 39 c2             	cmp    %rax,%rdx
+  801574:	73 17                	jae    80158d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801576:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801579:	49 89 c4             	mov    %rax,%r12
+  80157c:	48 83 c3 08          	add    $0x8,%rbx
+  801580:	b8 00 00 00 00       	mov    $0x0,%eax
+  801585:	ff 53 f8             	call   *-0x8(%rbx)
+  801588:	4c 39 e3             	cmp    %r12,%rbx
+  80158b:	72 ef                	jb     80157c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80158d:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  801594:	00 00 00 
+  801597:	ff d0                	call   *%rax
+  801599:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80159e:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8015a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8015ac:	00 00 00 
+  8015af:	48 01 d0             	add    %rdx,%rax
+  8015b2:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8015b9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8015bc:	45 85 ed             	test   %r13d,%r13d
+  8015bf:	7e 0d                	jle    8015ce <libmain+0x82>
+  8015c1:	49 8b 06             	mov    (%r14),%rax
+  8015c4:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015cb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015ce:	4c 89 f6             	mov    %r14,%rsi
+  8015d1:	44 89 ef             	mov    %r13d,%edi
+  8015d4:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015e0:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  8015e7:	00 00 00 
+  8015ea:	ff d0                	call   *%rax
+#endif
+}
+  8015ec:	5b                   	pop    %rbx
+  8015ed:	41 5c                	pop    %r12
+  8015ef:	41 5d                	pop    %r13
+  8015f1:	41 5e                	pop    %r14
+  8015f3:	5d                   	pop    %rbp
+  8015f4:	c3                   	ret
+
+00000000008015f5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015f5:	55                   	push   %rbp
+  8015f6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015f9:	48 b8 e5 2f 80 00 00 	movabs $0x802fe5,%rax
+  801600:	00 00 00 
+  801603:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801605:	bf 00 00 00 00       	mov    $0x0,%edi
+  80160a:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  801611:	00 00 00 
+  801614:	ff d0                	call   *%rax
+}
+  801616:	5d                   	pop    %rbp
+  801617:	c3                   	ret
+
+0000000000801618 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801618:	55                   	push   %rbp
+  801619:	48 89 e5             	mov    %rsp,%rbp
+  80161c:	53                   	push   %rbx
+  80161d:	48 83 ec 08          	sub    $0x8,%rsp
+  801621:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801624:	8b 06                	mov    (%rsi),%eax
+  801626:	8d 50 01             	lea    0x1(%rax),%edx
+  801629:	89 16                	mov    %edx,(%rsi)
+  80162b:	48 98                	cltq
+  80162d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801632:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801638:	74 0a                	je     801644 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80163a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80163e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801642:	c9                   	leave
+  801643:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801644:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801648:	be ff 00 00 00       	mov    $0xff,%esi
+  80164d:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  801654:	00 00 00 
+  801657:	ff d0                	call   *%rax
+        state->offset = 0;
+  801659:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80165f:	eb d9                	jmp    80163a <putch+0x22>
+
+0000000000801661 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801661:	55                   	push   %rbp
+  801662:	48 89 e5             	mov    %rsp,%rbp
+  801665:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80166c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80166f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801676:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80167b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801680:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801683:	48 89 f1             	mov    %rsi,%rcx
+  801686:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80168d:	48 bf 18 16 80 00 00 	movabs $0x801618,%rdi
+  801694:	00 00 00 
+  801697:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  80169e:	00 00 00 
+  8016a1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8016a3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8016aa:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8016b1:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  8016b8:	00 00 00 
+  8016bb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8016bd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016c3:	c9                   	leave
+  8016c4:	c3                   	ret
+
+00000000008016c5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016c5:	55                   	push   %rbp
+  8016c6:	48 89 e5             	mov    %rsp,%rbp
+  8016c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8016cd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016d1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016d9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016dd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016e1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016f0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016f8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016fc:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  801703:	00 00 00 
+  801706:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+
+000000000080170a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80170a:	55                   	push   %rbp
+  80170b:	48 89 e5             	mov    %rsp,%rbp
+  80170e:	41 57                	push   %r15
+  801710:	41 56                	push   %r14
+  801712:	41 55                	push   %r13
+  801714:	41 54                	push   %r12
+  801716:	53                   	push   %rbx
+  801717:	48 83 ec 18          	sub    $0x18,%rsp
+  80171b:	49 89 fc             	mov    %rdi,%r12
+  80171e:	49 89 f5             	mov    %rsi,%r13
+  801721:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801725:	8b 45 10             	mov    0x10(%rbp),%eax
+  801728:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80172b:	41 89 cf             	mov    %ecx,%r15d
+  80172e:	4c 39 fa             	cmp    %r15,%rdx
+  801731:	73 5b                	jae    80178e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801733:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801737:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80173b:	85 db                	test   %ebx,%ebx
+  80173d:	7e 0e                	jle    80174d <print_num+0x43>
+            putch(padc, put_arg);
+  80173f:	4c 89 ee             	mov    %r13,%rsi
+  801742:	44 89 f7             	mov    %r14d,%edi
+  801745:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801748:	83 eb 01             	sub    $0x1,%ebx
+  80174b:	75 f2                	jne    80173f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80174d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801751:	48 b9 82 5c 80 00 00 	movabs $0x805c82,%rcx
+  801758:	00 00 00 
+  80175b:	48 b8 71 5c 80 00 00 	movabs $0x805c71,%rax
+  801762:	00 00 00 
+  801765:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801769:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801772:	49 f7 f7             	div    %r15
+  801775:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801779:	4c 89 ee             	mov    %r13,%rsi
+  80177c:	41 ff d4             	call   *%r12
+}
+  80177f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801783:	5b                   	pop    %rbx
+  801784:	41 5c                	pop    %r12
+  801786:	41 5d                	pop    %r13
+  801788:	41 5e                	pop    %r14
+  80178a:	41 5f                	pop    %r15
+  80178c:	5d                   	pop    %rbp
+  80178d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80178e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801792:	ba 00 00 00 00       	mov    $0x0,%edx
+  801797:	49 f7 f7             	div    %r15
+  80179a:	48 83 ec 08          	sub    $0x8,%rsp
+  80179e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8017a2:	52                   	push   %rdx
+  8017a3:	45 0f be c9          	movsbl %r9b,%r9d
+  8017a7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8017ab:	48 89 c2             	mov    %rax,%rdx
+  8017ae:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  8017b5:	00 00 00 
+  8017b8:	ff d0                	call   *%rax
+  8017ba:	48 83 c4 10          	add    $0x10,%rsp
+  8017be:	eb 8d                	jmp    80174d <print_num+0x43>
+
+00000000008017c0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017c0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017c4:	48 8b 06             	mov    (%rsi),%rax
+  8017c7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017cb:	73 0a                	jae    8017d7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017cd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017d1:	48 89 16             	mov    %rdx,(%rsi)
+  8017d4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017d7:	c3                   	ret
+
+00000000008017d8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017d8:	55                   	push   %rbp
+  8017d9:	48 89 e5             	mov    %rsp,%rbp
+  8017dc:	48 83 ec 50          	sub    $0x50,%rsp
+  8017e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017ec:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801803:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801807:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  80180e:	00 00 00 
+  801811:	ff d0                	call   *%rax
+}
+  801813:	c9                   	leave
+  801814:	c3                   	ret
+
+0000000000801815 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801815:	55                   	push   %rbp
+  801816:	48 89 e5             	mov    %rsp,%rbp
+  801819:	41 57                	push   %r15
+  80181b:	41 56                	push   %r14
+  80181d:	41 55                	push   %r13
+  80181f:	41 54                	push   %r12
+  801821:	53                   	push   %rbx
+  801822:	48 83 ec 38          	sub    $0x38,%rsp
+  801826:	49 89 fe             	mov    %rdi,%r14
+  801829:	49 89 f5             	mov    %rsi,%r13
+  80182c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80182f:	48 8b 01             	mov    (%rcx),%rax
+  801832:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801836:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80183a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80183e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801842:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801846:	eb 0d                	jmp    801855 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801848:	40 0f b6 ff          	movzbl %dil,%edi
+  80184c:	4c 89 ee             	mov    %r13,%rsi
+  80184f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801852:	4c 89 e3             	mov    %r12,%rbx
+  801855:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801859:	0f b6 3b             	movzbl (%rbx),%edi
+  80185c:	40 80 ff 25          	cmp    $0x25,%dil
+  801860:	74 14                	je     801876 <vprintfmt+0x61>
+            if (!ch) return;
+  801862:	40 84 ff             	test   %dil,%dil
+  801865:	75 e1                	jne    801848 <vprintfmt+0x33>
+}
+  801867:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80186b:	5b                   	pop    %rbx
+  80186c:	41 5c                	pop    %r12
+  80186e:	41 5d                	pop    %r13
+  801870:	41 5e                	pop    %r14
+  801872:	41 5f                	pop    %r15
+  801874:	5d                   	pop    %rbp
+  801875:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801876:	be 00 00 00 00       	mov    $0x0,%esi
+  80187b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80187f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801884:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80188a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801891:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801895:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80189a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80189f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8018a2:	83 e8 23             	sub    $0x23,%eax
+  8018a5:	3c 57                	cmp    $0x57,%al
+  8018a7:	0f 87 67 06 00 00    	ja     801f14 <vprintfmt+0x6ff>
+  8018ad:	0f b6 c0             	movzbl %al,%eax
+  8018b0:	48 b9 00 5e 80 00 00 	movabs $0x805e00,%rcx
+  8018b7:	00 00 00 
+  8018ba:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8018bd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018c0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018c4:	eb cf                	jmp    801895 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018c6:	49 89 dc             	mov    %rbx,%r12
+  8018c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8018ce:	eb c5                	jmp    801895 <vprintfmt+0x80>
+            padc = ch;
+  8018d0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018d4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018d7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018da:	eb b9                	jmp    801895 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018df:	83 f8 2f             	cmp    $0x2f,%eax
+  8018e2:	77 24                	ja     801908 <vprintfmt+0xf3>
+  8018e4:	89 c1                	mov    %eax,%ecx
+  8018e6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018ea:	83 c0 08             	add    $0x8,%eax
+  8018ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018f0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018f3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018fa:	79 99                	jns    801895 <vprintfmt+0x80>
+                width = precision;
+  8018fc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801900:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801906:	eb 8d                	jmp    801895 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801908:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80190c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801914:	eb da                	jmp    8018f0 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801916:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80191b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80191f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801925:	3c 39                	cmp    $0x39,%al
+  801927:	77 1c                	ja     801945 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801929:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80192d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801931:	0f b6 c0             	movzbl %al,%eax
+  801934:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801939:	0f b6 03             	movzbl (%rbx),%eax
+  80193c:	3c 39                	cmp    $0x39,%al
+  80193e:	76 e9                	jbe    801929 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801940:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801943:	eb b1                	jmp    8018f6 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801945:	49 89 dc             	mov    %rbx,%r12
+  801948:	eb ac                	jmp    8018f6 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80194a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80194d:	85 c9                	test   %ecx,%ecx
+  80194f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801954:	0f 49 c1             	cmovns %ecx,%eax
+  801957:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80195a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80195d:	e9 33 ff ff ff       	jmp    801895 <vprintfmt+0x80>
+            lflag++;
+  801962:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801965:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801968:	e9 28 ff ff ff       	jmp    801895 <vprintfmt+0x80>
+            lflag--;
+  80196d:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801970:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801973:	e9 1d ff ff ff       	jmp    801895 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801978:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80197b:	83 f8 2f             	cmp    $0x2f,%eax
+  80197e:	77 19                	ja     801999 <vprintfmt+0x184>
+  801980:	89 c2                	mov    %eax,%edx
+  801982:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801986:	83 c0 08             	add    $0x8,%eax
+  801989:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80198c:	8b 3a                	mov    (%rdx),%edi
+  80198e:	4c 89 ee             	mov    %r13,%rsi
+  801991:	41 ff d6             	call   *%r14
+            break;
+  801994:	e9 bc fe ff ff       	jmp    801855 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801999:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80199d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019a5:	eb e5                	jmp    80198c <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  8019a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8019ad:	77 5a                	ja     801a09 <vprintfmt+0x1f4>
+  8019af:	89 c2                	mov    %eax,%edx
+  8019b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019b5:	83 c0 08             	add    $0x8,%eax
+  8019b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8019bb:	8b 02                	mov    (%rdx),%eax
+  8019bd:	89 c1                	mov    %eax,%ecx
+  8019bf:	f7 d9                	neg    %ecx
+  8019c1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019c4:	83 f9 13             	cmp    $0x13,%ecx
+  8019c7:	7f 4e                	jg     801a17 <vprintfmt+0x202>
+  8019c9:	48 63 c1             	movslq %ecx,%rax
+  8019cc:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8019d3:	00 00 00 
+  8019d6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019da:	48 85 c0             	test   %rax,%rax
+  8019dd:	74 38                	je     801a17 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019df:	48 89 c1             	mov    %rax,%rcx
+  8019e2:	48 ba 88 62 80 00 00 	movabs $0x806288,%rdx
+  8019e9:	00 00 00 
+  8019ec:	4c 89 ee             	mov    %r13,%rsi
+  8019ef:	4c 89 f7             	mov    %r14,%rdi
+  8019f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f7:	49 b8 d8 17 80 00 00 	movabs $0x8017d8,%r8
+  8019fe:	00 00 00 
+  801a01:	41 ff d0             	call   *%r8
+  801a04:	e9 4c fe ff ff       	jmp    801855 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a15:	eb a4                	jmp    8019bb <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801a17:	48 ba 9a 5c 80 00 00 	movabs $0x805c9a,%rdx
+  801a1e:	00 00 00 
+  801a21:	4c 89 ee             	mov    %r13,%rsi
+  801a24:	4c 89 f7             	mov    %r14,%rdi
+  801a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2c:	49 b8 d8 17 80 00 00 	movabs $0x8017d8,%r8
+  801a33:	00 00 00 
+  801a36:	41 ff d0             	call   *%r8
+  801a39:	e9 17 fe ff ff       	jmp    801855 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a41:	83 f8 2f             	cmp    $0x2f,%eax
+  801a44:	77 6c                	ja     801ab2 <vprintfmt+0x29d>
+  801a46:	89 c2                	mov    %eax,%edx
+  801a48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a4c:	83 c0 08             	add    $0x8,%eax
+  801a4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a52:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a55:	48 85 f6             	test   %rsi,%rsi
+  801a58:	48 b8 93 5c 80 00 00 	movabs $0x805c93,%rax
+  801a5f:	00 00 00 
+  801a62:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a66:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a6a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a6e:	7e 06                	jle    801a76 <vprintfmt+0x261>
+  801a70:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a74:	75 4a                	jne    801ac0 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a7a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a7e:	0f b6 00             	movzbl (%rax),%eax
+  801a81:	84 c0                	test   %al,%al
+  801a83:	0f 85 9a 00 00 00    	jne    801b23 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a89:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a8c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a90:	85 c0                	test   %eax,%eax
+  801a92:	0f 8e bd fd ff ff    	jle    801855 <vprintfmt+0x40>
+  801a98:	4c 89 ee             	mov    %r13,%rsi
+  801a9b:	bf 20 00 00 00       	mov    $0x20,%edi
+  801aa0:	41 ff d6             	call   *%r14
+  801aa3:	41 83 ec 01          	sub    $0x1,%r12d
+  801aa7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801aab:	75 eb                	jne    801a98 <vprintfmt+0x283>
+  801aad:	e9 a3 fd ff ff       	jmp    801855 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ab2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ab6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801aba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801abe:	eb 92                	jmp    801a52 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ac0:	49 63 f7             	movslq %r15d,%rsi
+  801ac3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801ac7:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  801ace:	00 00 00 
+  801ad1:	ff d0                	call   *%rax
+  801ad3:	48 89 c2             	mov    %rax,%rdx
+  801ad6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ad9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801adb:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ade:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	7e 91                	jle    801a76 <vprintfmt+0x261>
+  801ae5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801aea:	4c 89 ee             	mov    %r13,%rsi
+  801aed:	44 89 e7             	mov    %r12d,%edi
+  801af0:	41 ff d6             	call   *%r14
+  801af3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801af7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801afa:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801afd:	75 eb                	jne    801aea <vprintfmt+0x2d5>
+  801aff:	e9 72 ff ff ff       	jmp    801a76 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b04:	0f b6 f8             	movzbl %al,%edi
+  801b07:	4c 89 ee             	mov    %r13,%rsi
+  801b0a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b0d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b11:	49 83 c4 01          	add    $0x1,%r12
+  801b15:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801b1b:	84 c0                	test   %al,%al
+  801b1d:	0f 84 66 ff ff ff    	je     801a89 <vprintfmt+0x274>
+  801b23:	45 85 ff             	test   %r15d,%r15d
+  801b26:	78 0a                	js     801b32 <vprintfmt+0x31d>
+  801b28:	41 83 ef 01          	sub    $0x1,%r15d
+  801b2c:	0f 88 57 ff ff ff    	js     801a89 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b32:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b36:	74 cc                	je     801b04 <vprintfmt+0x2ef>
+  801b38:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b3b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b40:	80 fa 5e             	cmp    $0x5e,%dl
+  801b43:	77 c2                	ja     801b07 <vprintfmt+0x2f2>
+  801b45:	eb bd                	jmp    801b04 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b47:	40 84 f6             	test   %sil,%sil
+  801b4a:	75 26                	jne    801b72 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b4c:	85 d2                	test   %edx,%edx
+  801b4e:	74 59                	je     801ba9 <vprintfmt+0x394>
+  801b50:	83 fa 01             	cmp    $0x1,%edx
+  801b53:	74 7b                	je     801bd0 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b58:	83 f8 2f             	cmp    $0x2f,%eax
+  801b5b:	0f 87 96 00 00 00    	ja     801bf7 <vprintfmt+0x3e2>
+  801b61:	89 c2                	mov    %eax,%edx
+  801b63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b67:	83 c0 08             	add    $0x8,%eax
+  801b6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b6d:	4c 8b 22             	mov    (%rdx),%r12
+  801b70:	eb 17                	jmp    801b89 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b75:	83 f8 2f             	cmp    $0x2f,%eax
+  801b78:	77 21                	ja     801b9b <vprintfmt+0x386>
+  801b7a:	89 c2                	mov    %eax,%edx
+  801b7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b80:	83 c0 08             	add    $0x8,%eax
+  801b83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b86:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b89:	4d 85 e4             	test   %r12,%r12
+  801b8c:	78 7a                	js     801c08 <vprintfmt+0x3f3>
+            num = i;
+  801b8e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b91:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b96:	e9 56 02 00 00       	jmp    801df1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba7:	eb dd                	jmp    801b86 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801ba9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bac:	83 f8 2f             	cmp    $0x2f,%eax
+  801baf:	77 11                	ja     801bc2 <vprintfmt+0x3ad>
+  801bb1:	89 c2                	mov    %eax,%edx
+  801bb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bb7:	83 c0 08             	add    $0x8,%eax
+  801bba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bbd:	4c 63 22             	movslq (%rdx),%r12
+  801bc0:	eb c7                	jmp    801b89 <vprintfmt+0x374>
+  801bc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bce:	eb ed                	jmp    801bbd <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bd3:	83 f8 2f             	cmp    $0x2f,%eax
+  801bd6:	77 11                	ja     801be9 <vprintfmt+0x3d4>
+  801bd8:	89 c2                	mov    %eax,%edx
+  801bda:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bde:	83 c0 08             	add    $0x8,%eax
+  801be1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801be4:	4c 8b 22             	mov    (%rdx),%r12
+  801be7:	eb a0                	jmp    801b89 <vprintfmt+0x374>
+  801be9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bf1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf5:	eb ed                	jmp    801be4 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bf7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bfb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c03:	e9 65 ff ff ff       	jmp    801b6d <vprintfmt+0x358>
+                putch('-', put_arg);
+  801c08:	4c 89 ee             	mov    %r13,%rsi
+  801c0b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801c10:	41 ff d6             	call   *%r14
+                i = -i;
+  801c13:	49 f7 dc             	neg    %r12
+  801c16:	e9 73 ff ff ff       	jmp    801b8e <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801c1b:	40 84 f6             	test   %sil,%sil
+  801c1e:	75 2e                	jne    801c4e <vprintfmt+0x439>
+    switch (lflag) {
+  801c20:	85 d2                	test   %edx,%edx
+  801c22:	7f 59                	jg     801c7d <vprintfmt+0x468>
+  801c24:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c27:	7d 7a                	jge    801ca3 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c2c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c2f:	0f 87 aa 00 00 00    	ja     801cdf <vprintfmt+0x4ca>
+  801c35:	89 c2                	mov    %eax,%edx
+  801c37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c3b:	83 c0 08             	add    $0x8,%eax
+  801c3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c41:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c44:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c49:	e9 a3 01 00 00       	jmp    801df1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c51:	83 f8 2f             	cmp    $0x2f,%eax
+  801c54:	77 19                	ja     801c6f <vprintfmt+0x45a>
+  801c56:	89 c2                	mov    %eax,%edx
+  801c58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c5c:	83 c0 08             	add    $0x8,%eax
+  801c5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c62:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c65:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c6a:	e9 82 01 00 00       	jmp    801df1 <vprintfmt+0x5dc>
+  801c6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c7b:	eb e5                	jmp    801c62 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c7d:	83 fa 01             	cmp    $0x1,%edx
+  801c80:	75 a7                	jne    801c29 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c85:	83 f8 2f             	cmp    $0x2f,%eax
+  801c88:	77 47                	ja     801cd1 <vprintfmt+0x4bc>
+  801c8a:	89 c2                	mov    %eax,%edx
+  801c8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c90:	83 c0 08             	add    $0x8,%eax
+  801c93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c96:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c99:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c9e:	e9 4e 01 00 00       	jmp    801df1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801ca3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ca6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ca9:	77 18                	ja     801cc3 <vprintfmt+0x4ae>
+  801cab:	89 c2                	mov    %eax,%edx
+  801cad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cb1:	83 c0 08             	add    $0x8,%eax
+  801cb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cb7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801cb9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801cbe:	e9 2e 01 00 00       	jmp    801df1 <vprintfmt+0x5dc>
+  801cc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ccb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ccf:	eb e6                	jmp    801cb7 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cdd:	eb b7                	jmp    801c96 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cdf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ce3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ce7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ceb:	e9 51 ff ff ff       	jmp    801c41 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cf0:	40 84 f6             	test   %sil,%sil
+  801cf3:	75 2e                	jne    801d23 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cf5:	85 d2                	test   %edx,%edx
+  801cf7:	7f 59                	jg     801d52 <vprintfmt+0x53d>
+  801cf9:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cfc:	7d 77                	jge    801d75 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cfe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d01:	83 f8 2f             	cmp    $0x2f,%eax
+  801d04:	0f 87 a4 00 00 00    	ja     801dae <vprintfmt+0x599>
+  801d0a:	89 c2                	mov    %eax,%edx
+  801d0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d10:	83 c0 08             	add    $0x8,%eax
+  801d13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d16:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d19:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d1e:	e9 ce 00 00 00       	jmp    801df1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d26:	83 f8 2f             	cmp    $0x2f,%eax
+  801d29:	77 19                	ja     801d44 <vprintfmt+0x52f>
+  801d2b:	89 c2                	mov    %eax,%edx
+  801d2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d31:	83 c0 08             	add    $0x8,%eax
+  801d34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d37:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d3a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d3f:	e9 ad 00 00 00       	jmp    801df1 <vprintfmt+0x5dc>
+  801d44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d50:	eb e5                	jmp    801d37 <vprintfmt+0x522>
+    switch (lflag) {
+  801d52:	83 fa 01             	cmp    $0x1,%edx
+  801d55:	75 a7                	jne    801cfe <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d5a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5d:	77 41                	ja     801da0 <vprintfmt+0x58b>
+  801d5f:	89 c2                	mov    %eax,%edx
+  801d61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d65:	83 c0 08             	add    $0x8,%eax
+  801d68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d6b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d6e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d73:	eb 7c                	jmp    801df1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d78:	83 f8 2f             	cmp    $0x2f,%eax
+  801d7b:	77 15                	ja     801d92 <vprintfmt+0x57d>
+  801d7d:	89 c2                	mov    %eax,%edx
+  801d7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d83:	83 c0 08             	add    $0x8,%eax
+  801d86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d89:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d8b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d90:	eb 5f                	jmp    801df1 <vprintfmt+0x5dc>
+  801d92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9e:	eb e9                	jmp    801d89 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801da0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801da4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801da8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dac:	eb bd                	jmp    801d6b <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801dae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801db2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801db6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dba:	e9 57 ff ff ff       	jmp    801d16 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801dbf:	4c 89 ee             	mov    %r13,%rsi
+  801dc2:	bf 30 00 00 00       	mov    $0x30,%edi
+  801dc7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801dca:	4c 89 ee             	mov    %r13,%rsi
+  801dcd:	bf 78 00 00 00       	mov    $0x78,%edi
+  801dd2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801dd5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dd8:	83 f8 2f             	cmp    $0x2f,%eax
+  801ddb:	77 47                	ja     801e24 <vprintfmt+0x60f>
+  801ddd:	89 c2                	mov    %eax,%edx
+  801ddf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801de3:	83 c0 08             	add    $0x8,%eax
+  801de6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801de9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dec:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801df1:	48 83 ec 08          	sub    $0x8,%rsp
+  801df5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801df9:	0f 94 c0             	sete   %al
+  801dfc:	0f b6 c0             	movzbl %al,%eax
+  801dff:	50                   	push   %rax
+  801e00:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801e05:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801e09:	4c 89 ee             	mov    %r13,%rsi
+  801e0c:	4c 89 f7             	mov    %r14,%rdi
+  801e0f:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  801e16:	00 00 00 
+  801e19:	ff d0                	call   *%rax
+            break;
+  801e1b:	48 83 c4 10          	add    $0x10,%rsp
+  801e1f:	e9 31 fa ff ff       	jmp    801855 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e30:	eb b7                	jmp    801de9 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e32:	40 84 f6             	test   %sil,%sil
+  801e35:	75 2b                	jne    801e62 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e37:	85 d2                	test   %edx,%edx
+  801e39:	7f 56                	jg     801e91 <vprintfmt+0x67c>
+  801e3b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e3e:	7d 77                	jge    801eb7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e43:	83 f8 2f             	cmp    $0x2f,%eax
+  801e46:	0f 87 a7 00 00 00    	ja     801ef3 <vprintfmt+0x6de>
+  801e4c:	89 c2                	mov    %eax,%edx
+  801e4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e52:	83 c0 08             	add    $0x8,%eax
+  801e55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e5b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e60:	eb 8f                	jmp    801df1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e65:	83 f8 2f             	cmp    $0x2f,%eax
+  801e68:	77 19                	ja     801e83 <vprintfmt+0x66e>
+  801e6a:	89 c2                	mov    %eax,%edx
+  801e6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e70:	83 c0 08             	add    $0x8,%eax
+  801e73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e76:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e79:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e7e:	e9 6e ff ff ff       	jmp    801df1 <vprintfmt+0x5dc>
+  801e83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e8f:	eb e5                	jmp    801e76 <vprintfmt+0x661>
+    switch (lflag) {
+  801e91:	83 fa 01             	cmp    $0x1,%edx
+  801e94:	75 aa                	jne    801e40 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e99:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9c:	77 47                	ja     801ee5 <vprintfmt+0x6d0>
+  801e9e:	89 c2                	mov    %eax,%edx
+  801ea0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea4:	83 c0 08             	add    $0x8,%eax
+  801ea7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eaa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ead:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801eb2:	e9 3a ff ff ff       	jmp    801df1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801eb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eba:	83 f8 2f             	cmp    $0x2f,%eax
+  801ebd:	77 18                	ja     801ed7 <vprintfmt+0x6c2>
+  801ebf:	89 c2                	mov    %eax,%edx
+  801ec1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec5:	83 c0 08             	add    $0x8,%eax
+  801ec8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ecb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ecd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ed2:	e9 1a ff ff ff       	jmp    801df1 <vprintfmt+0x5dc>
+  801ed7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801edb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801edf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee3:	eb e6                	jmp    801ecb <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ee5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef1:	eb b7                	jmp    801eaa <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ef3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ef7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801efb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eff:	e9 54 ff ff ff       	jmp    801e58 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801f04:	4c 89 ee             	mov    %r13,%rsi
+  801f07:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f0c:	41 ff d6             	call   *%r14
+            break;
+  801f0f:	e9 41 f9 ff ff       	jmp    801855 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801f14:	4c 89 ee             	mov    %r13,%rsi
+  801f17:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f1c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f1f:	48 83 eb 01          	sub    $0x1,%rbx
+  801f23:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f27:	75 f6                	jne    801f1f <vprintfmt+0x70a>
+  801f29:	e9 27 f9 ff ff       	jmp    801855 <vprintfmt+0x40>
+
+0000000000801f2e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f2e:	55                   	push   %rbp
+  801f2f:	48 89 e5             	mov    %rsp,%rbp
+  801f32:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f3a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f3f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f43:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f4a:	48 85 ff             	test   %rdi,%rdi
+  801f4d:	74 2b                	je     801f7a <vsnprintf+0x4c>
+  801f4f:	48 85 f6             	test   %rsi,%rsi
+  801f52:	74 26                	je     801f7a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f54:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f58:	48 bf c0 17 80 00 00 	movabs $0x8017c0,%rdi
+  801f5f:	00 00 00 
+  801f62:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f72:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f7f:	eb f7                	jmp    801f78 <vsnprintf+0x4a>
+
+0000000000801f81 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f81:	55                   	push   %rbp
+  801f82:	48 89 e5             	mov    %rsp,%rbp
+  801f85:	48 83 ec 50          	sub    $0x50,%rsp
+  801f89:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f8d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f91:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f95:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f9c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801fa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801fa8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801fac:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801fb0:	48 b8 2e 1f 80 00 00 	movabs $0x801f2e,%rax
+  801fb7:	00 00 00 
+  801fba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801fbc:	c9                   	leave
+  801fbd:	c3                   	ret
+
+0000000000801fbe <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801fbe:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fc1:	74 10                	je     801fd3 <strlen+0x15>
+    size_t n = 0;
+  801fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fc8:	48 83 c0 01          	add    $0x1,%rax
+  801fcc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fd0:	75 f6                	jne    801fc8 <strlen+0xa>
+  801fd2:	c3                   	ret
+    size_t n = 0;
+  801fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fd8:	c3                   	ret
+
+0000000000801fd9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fd9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fe1:	48 85 f6             	test   %rsi,%rsi
+  801fe4:	74 11                	je     801ff7 <strnlen+0x1e>
+  801fe6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fea:	74 0c                	je     801ff8 <strnlen+0x1f>
+  801fec:	48 83 c2 01          	add    $0x1,%rdx
+  801ff0:	48 39 d0             	cmp    %rdx,%rax
+  801ff3:	75 f1                	jne    801fe6 <strnlen+0xd>
+  801ff5:	eb 04                	jmp    801ffb <strnlen+0x22>
+  801ff7:	c3                   	ret
+  801ff8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801ffb:	c3                   	ret
+
+0000000000801ffc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801ffc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802004:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802008:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80200b:	48 83 c2 01          	add    $0x1,%rdx
+  80200f:	84 c9                	test   %cl,%cl
+  802011:	75 f1                	jne    802004 <strcpy+0x8>
+        ;
+    return res;
+}
+  802013:	c3                   	ret
+
+0000000000802014 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802014:	55                   	push   %rbp
+  802015:	48 89 e5             	mov    %rsp,%rbp
+  802018:	41 54                	push   %r12
+  80201a:	53                   	push   %rbx
+  80201b:	48 89 fb             	mov    %rdi,%rbx
+  80201e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802021:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80202d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802031:	4c 89 e6             	mov    %r12,%rsi
+  802034:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  80203b:	00 00 00 
+  80203e:	ff d0                	call   *%rax
+    return dst;
+}
+  802040:	48 89 d8             	mov    %rbx,%rax
+  802043:	5b                   	pop    %rbx
+  802044:	41 5c                	pop    %r12
+  802046:	5d                   	pop    %rbp
+  802047:	c3                   	ret
+
+0000000000802048 <toupper>:
+
+int
+toupper(int ch) {
+  802048:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80204a:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80204d:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802050:	83 f9 1a             	cmp    $0x1a,%ecx
+  802053:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802056:	c3                   	ret
+
+0000000000802057 <tolower>:
+
+int
+tolower(int ch) {
+  802057:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802059:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80205c:	8d 57 20             	lea    0x20(%rdi),%edx
+  80205f:	83 f9 1a             	cmp    $0x1a,%ecx
+  802062:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802065:	c3                   	ret
+
+0000000000802066 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802066:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802069:	48 85 d2             	test   %rdx,%rdx
+  80206c:	74 1f                	je     80208d <strncpy+0x27>
+  80206e:	48 01 fa             	add    %rdi,%rdx
+  802071:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802074:	48 83 c1 01          	add    $0x1,%rcx
+  802078:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80207c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802080:	41 80 f8 01          	cmp    $0x1,%r8b
+  802084:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802088:	48 39 ca             	cmp    %rcx,%rdx
+  80208b:	75 e7                	jne    802074 <strncpy+0xe>
+    }
+    return ret;
+}
+  80208d:	c3                   	ret
+
+000000000080208e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80208e:	48 89 f8             	mov    %rdi,%rax
+  802091:	48 85 d2             	test   %rdx,%rdx
+  802094:	74 24                	je     8020ba <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802096:	48 83 ea 01          	sub    $0x1,%rdx
+  80209a:	74 1b                	je     8020b7 <strlcpy+0x29>
+  80209c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8020a0:	0f b6 16             	movzbl (%rsi),%edx
+  8020a3:	84 d2                	test   %dl,%dl
+  8020a5:	74 10                	je     8020b7 <strlcpy+0x29>
+            *dst++ = *src++;
+  8020a7:	48 83 c6 01          	add    $0x1,%rsi
+  8020ab:	48 83 c0 01          	add    $0x1,%rax
+  8020af:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8020b2:	48 39 c8             	cmp    %rcx,%rax
+  8020b5:	75 e9                	jne    8020a0 <strlcpy+0x12>
+        *dst = '\0';
+  8020b7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8020ba:	48 29 f8             	sub    %rdi,%rax
+}
+  8020bd:	c3                   	ret
+
+00000000008020be <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8020be:	0f b6 07             	movzbl (%rdi),%eax
+  8020c1:	84 c0                	test   %al,%al
+  8020c3:	74 13                	je     8020d8 <strcmp+0x1a>
+  8020c5:	38 06                	cmp    %al,(%rsi)
+  8020c7:	75 0f                	jne    8020d8 <strcmp+0x1a>
+  8020c9:	48 83 c7 01          	add    $0x1,%rdi
+  8020cd:	48 83 c6 01          	add    $0x1,%rsi
+  8020d1:	0f b6 07             	movzbl (%rdi),%eax
+  8020d4:	84 c0                	test   %al,%al
+  8020d6:	75 ed                	jne    8020c5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020d8:	0f b6 c0             	movzbl %al,%eax
+  8020db:	0f b6 16             	movzbl (%rsi),%edx
+  8020de:	29 d0                	sub    %edx,%eax
+}
+  8020e0:	c3                   	ret
+
+00000000008020e1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020e1:	48 85 d2             	test   %rdx,%rdx
+  8020e4:	74 1f                	je     802105 <strncmp+0x24>
+  8020e6:	0f b6 07             	movzbl (%rdi),%eax
+  8020e9:	84 c0                	test   %al,%al
+  8020eb:	74 1e                	je     80210b <strncmp+0x2a>
+  8020ed:	3a 06                	cmp    (%rsi),%al
+  8020ef:	75 1a                	jne    80210b <strncmp+0x2a>
+  8020f1:	48 83 c7 01          	add    $0x1,%rdi
+  8020f5:	48 83 c6 01          	add    $0x1,%rsi
+  8020f9:	48 83 ea 01          	sub    $0x1,%rdx
+  8020fd:	75 e7                	jne    8020e6 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802104:	c3                   	ret
+  802105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210a:	c3                   	ret
+  80210b:	48 85 d2             	test   %rdx,%rdx
+  80210e:	74 09                	je     802119 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802110:	0f b6 07             	movzbl (%rdi),%eax
+  802113:	0f b6 16             	movzbl (%rsi),%edx
+  802116:	29 d0                	sub    %edx,%eax
+  802118:	c3                   	ret
+    if (!n) return 0;
+  802119:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80211e:	c3                   	ret
+
+000000000080211f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80211f:	0f b6 17             	movzbl (%rdi),%edx
+  802122:	84 d2                	test   %dl,%dl
+  802124:	74 18                	je     80213e <strchr+0x1f>
+        if (*str == c) {
+  802126:	0f be d2             	movsbl %dl,%edx
+  802129:	39 f2                	cmp    %esi,%edx
+  80212b:	74 17                	je     802144 <strchr+0x25>
+    for (; *str; str++) {
+  80212d:	48 83 c7 01          	add    $0x1,%rdi
+  802131:	0f b6 17             	movzbl (%rdi),%edx
+  802134:	84 d2                	test   %dl,%dl
+  802136:	75 ee                	jne    802126 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213d:	c3                   	ret
+  80213e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802143:	c3                   	ret
+  802144:	48 89 f8             	mov    %rdi,%rax
+}
+  802147:	c3                   	ret
+
+0000000000802148 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802148:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80214b:	0f b6 17             	movzbl (%rdi),%edx
+  80214e:	84 d2                	test   %dl,%dl
+  802150:	74 13                	je     802165 <strfind+0x1d>
+  802152:	0f be d2             	movsbl %dl,%edx
+  802155:	39 f2                	cmp    %esi,%edx
+  802157:	74 0b                	je     802164 <strfind+0x1c>
+  802159:	48 83 c0 01          	add    $0x1,%rax
+  80215d:	0f b6 10             	movzbl (%rax),%edx
+  802160:	84 d2                	test   %dl,%dl
+  802162:	75 ee                	jne    802152 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802164:	c3                   	ret
+  802165:	c3                   	ret
+
+0000000000802166 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802166:	48 39 f7             	cmp    %rsi,%rdi
+  802169:	74 65                	je     8021d0 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80216b:	55                   	push   %rbp
+  80216c:	48 89 e5             	mov    %rsp,%rbp
+  80216f:	41 57                	push   %r15
+  802171:	41 56                	push   %r14
+  802173:	41 55                	push   %r13
+  802175:	41 54                	push   %r12
+  802177:	53                   	push   %rbx
+  802178:	48 83 ec 18          	sub    $0x18,%rsp
+  80217c:	48 89 fb             	mov    %rdi,%rbx
+  80217f:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802182:	49 bf 57 20 80 00 00 	movabs $0x802057,%r15
+  802189:	00 00 00 
+  80218c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802190:	41 0f b6 fd          	movzbl %r13b,%edi
+  802194:	41 ff d7             	call   *%r15
+  802197:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80219a:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80219f:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021a3:	41 ff d7             	call   *%r15
+  8021a6:	89 c2                	mov    %eax,%edx
+  8021a8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021ab:	29 d0                	sub    %edx,%eax
+  8021ad:	75 12                	jne    8021c1 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8021af:	48 83 c3 01          	add    $0x1,%rbx
+  8021b3:	45 84 ed             	test   %r13b,%r13b
+  8021b6:	74 09                	je     8021c1 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8021b8:	49 83 c4 01          	add    $0x1,%r12
+  8021bc:	45 84 f6             	test   %r14b,%r14b
+  8021bf:	75 cb                	jne    80218c <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021c1:	48 83 c4 18          	add    $0x18,%rsp
+  8021c5:	5b                   	pop    %rbx
+  8021c6:	41 5c                	pop    %r12
+  8021c8:	41 5d                	pop    %r13
+  8021ca:	41 5e                	pop    %r14
+  8021cc:	41 5f                	pop    %r15
+  8021ce:	5d                   	pop    %rbp
+  8021cf:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d5:	c3                   	ret
+
+00000000008021d6 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021d6:	48 39 f7             	cmp    %rsi,%rdi
+  8021d9:	74 7d                	je     802258 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021db:	55                   	push   %rbp
+  8021dc:	48 89 e5             	mov    %rsp,%rbp
+  8021df:	41 57                	push   %r15
+  8021e1:	41 56                	push   %r14
+  8021e3:	41 55                	push   %r13
+  8021e5:	41 54                	push   %r12
+  8021e7:	53                   	push   %rbx
+  8021e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ec:	48 89 fb             	mov    %rdi,%rbx
+  8021ef:	49 89 f4             	mov    %rsi,%r12
+  8021f2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021fa:	49 bf 57 20 80 00 00 	movabs $0x802057,%r15
+  802201:	00 00 00 
+    while (n--) {
+  802204:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802208:	48 39 c3             	cmp    %rax,%rbx
+  80220b:	74 37                	je     802244 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80220d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802211:	41 0f b6 fd          	movzbl %r13b,%edi
+  802215:	41 ff d7             	call   *%r15
+  802218:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80221b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802220:	41 0f b6 fe          	movzbl %r14b,%edi
+  802224:	41 ff d7             	call   *%r15
+  802227:	89 c2                	mov    %eax,%edx
+  802229:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80222c:	29 d0                	sub    %edx,%eax
+  80222e:	75 19                	jne    802249 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802230:	48 83 c3 01          	add    $0x1,%rbx
+  802234:	45 84 ed             	test   %r13b,%r13b
+  802237:	74 10                	je     802249 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802239:	49 83 c4 01          	add    $0x1,%r12
+  80223d:	45 84 f6             	test   %r14b,%r14b
+  802240:	75 c2                	jne    802204 <strncasecmp+0x2e>
+  802242:	eb 05                	jmp    802249 <strncasecmp+0x73>
+  802244:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802249:	48 83 c4 18          	add    $0x18,%rsp
+  80224d:	5b                   	pop    %rbx
+  80224e:	41 5c                	pop    %r12
+  802250:	41 5d                	pop    %r13
+  802252:	41 5e                	pop    %r14
+  802254:	41 5f                	pop    %r15
+  802256:	5d                   	pop    %rbp
+  802257:	c3                   	ret
+    if (p1 == p2) return 0;
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225d:	c3                   	ret
+
+000000000080225e <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80225e:	83 e7 df             	and    $0xffffffdf,%edi
+  802261:	83 ef 41             	sub    $0x41,%edi
+  802264:	83 ff 19             	cmp    $0x19,%edi
+  802267:	0f 96 c0             	setbe  %al
+}
+  80226a:	c3                   	ret
+
+000000000080226b <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80226b:	83 ff 20             	cmp    $0x20,%edi
+  80226e:	0f 94 c0             	sete   %al
+  802271:	83 ff 09             	cmp    $0x9,%edi
+  802274:	0f 94 c2             	sete   %dl
+  802277:	09 d0                	or     %edx,%eax
+}
+  802279:	c3                   	ret
+
+000000000080227a <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80227a:	55                   	push   %rbp
+  80227b:	48 89 e5             	mov    %rsp,%rbp
+  80227e:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802280:	48 bf 7f 61 80 00 00 	movabs $0x80617f,%rdi
+  802287:	00 00 00 
+  80228a:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  802291:	00 00 00 
+  802294:	ff d0                	call   *%rax
+  802296:	48 85 c0             	test   %rax,%rax
+  802299:	0f 95 c0             	setne  %al
+}
+  80229c:	5d                   	pop    %rbp
+  80229d:	c3                   	ret
+
+000000000080229e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80229e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8022a1:	48 89 f8             	mov    %rdi,%rax
+  8022a4:	48 f7 d8             	neg    %rax
+  8022a7:	83 e0 07             	and    $0x7,%eax
+  8022aa:	49 89 d1             	mov    %rdx,%r9
+  8022ad:	49 29 c1             	sub    %rax,%r9
+  8022b0:	78 36                	js     8022e8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8022b2:	40 0f b6 c6          	movzbl %sil,%eax
+  8022b6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8022bd:	01 01 01 
+  8022c0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022c4:	40 f6 c7 07          	test   $0x7,%dil
+  8022c8:	75 38                	jne    802302 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022ca:	4c 89 c9             	mov    %r9,%rcx
+  8022cd:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022d1:	74 0c                	je     8022df <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022d3:	fc                   	cld
+  8022d4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022d7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022db:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022df:	4d 85 c9             	test   %r9,%r9
+  8022e2:	75 45                	jne    802329 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022e4:	4c 89 c0             	mov    %r8,%rax
+  8022e7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022e8:	48 85 d2             	test   %rdx,%rdx
+  8022eb:	74 f7                	je     8022e4 <memset+0x46>
+  8022ed:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022f0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022f3:	48 83 c0 01          	add    $0x1,%rax
+  8022f7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022fb:	48 39 c2             	cmp    %rax,%rdx
+  8022fe:	75 f3                	jne    8022f3 <memset+0x55>
+  802300:	eb e2                	jmp    8022e4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802302:	40 f6 c7 01          	test   $0x1,%dil
+  802306:	74 06                	je     80230e <memset+0x70>
+  802308:	88 07                	mov    %al,(%rdi)
+  80230a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80230e:	40 f6 c7 02          	test   $0x2,%dil
+  802312:	74 07                	je     80231b <memset+0x7d>
+  802314:	66 89 07             	mov    %ax,(%rdi)
+  802317:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80231b:	40 f6 c7 04          	test   $0x4,%dil
+  80231f:	74 a9                	je     8022ca <memset+0x2c>
+  802321:	89 07                	mov    %eax,(%rdi)
+  802323:	48 83 c7 04          	add    $0x4,%rdi
+  802327:	eb a1                	jmp    8022ca <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802329:	41 f6 c1 04          	test   $0x4,%r9b
+  80232d:	74 06                	je     802335 <memset+0x97>
+  80232f:	89 07                	mov    %eax,(%rdi)
+  802331:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802335:	41 f6 c1 02          	test   $0x2,%r9b
+  802339:	74 07                	je     802342 <memset+0xa4>
+  80233b:	66 89 07             	mov    %ax,(%rdi)
+  80233e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802342:	41 f6 c1 01          	test   $0x1,%r9b
+  802346:	74 9c                	je     8022e4 <memset+0x46>
+  802348:	88 07                	mov    %al,(%rdi)
+  80234a:	eb 98                	jmp    8022e4 <memset+0x46>
+
+000000000080234c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80234c:	48 89 f8             	mov    %rdi,%rax
+  80234f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802352:	48 39 fe             	cmp    %rdi,%rsi
+  802355:	73 3b                	jae    802392 <memmove+0x46>
+  802357:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80235b:	48 39 d7             	cmp    %rdx,%rdi
+  80235e:	73 32                	jae    802392 <memmove+0x46>
+        s += n;
+        d += n;
+  802360:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802364:	48 89 d6             	mov    %rdx,%rsi
+  802367:	48 09 fe             	or     %rdi,%rsi
+  80236a:	48 09 ce             	or     %rcx,%rsi
+  80236d:	40 f6 c6 07          	test   $0x7,%sil
+  802371:	75 12                	jne    802385 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802373:	48 83 ef 08          	sub    $0x8,%rdi
+  802377:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80237b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80237f:	fd                   	std
+  802380:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802383:	fc                   	cld
+  802384:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802385:	48 83 ef 01          	sub    $0x1,%rdi
+  802389:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80238d:	fd                   	std
+  80238e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802390:	eb f1                	jmp    802383 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802392:	48 89 f2             	mov    %rsi,%rdx
+  802395:	48 09 c2             	or     %rax,%rdx
+  802398:	48 09 ca             	or     %rcx,%rdx
+  80239b:	f6 c2 07             	test   $0x7,%dl
+  80239e:	75 0c                	jne    8023ac <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8023a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8023a4:	48 89 c7             	mov    %rax,%rdi
+  8023a7:	fc                   	cld
+  8023a8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8023ab:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8023ac:	48 89 c7             	mov    %rax,%rdi
+  8023af:	fc                   	cld
+  8023b0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8023b2:	c3                   	ret
+
+00000000008023b3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8023b3:	55                   	push   %rbp
+  8023b4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8023b7:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+}
+  8023c3:	5d                   	pop    %rbp
+  8023c4:	c3                   	ret
+
+00000000008023c5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023c5:	55                   	push   %rbp
+  8023c6:	48 89 e5             	mov    %rsp,%rbp
+  8023c9:	41 57                	push   %r15
+  8023cb:	41 56                	push   %r14
+  8023cd:	41 55                	push   %r13
+  8023cf:	41 54                	push   %r12
+  8023d1:	53                   	push   %rbx
+  8023d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d6:	49 89 fe             	mov    %rdi,%r14
+  8023d9:	49 89 f7             	mov    %rsi,%r15
+  8023dc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023df:	48 89 f7             	mov    %rsi,%rdi
+  8023e2:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+  8023ee:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023f1:	48 89 de             	mov    %rbx,%rsi
+  8023f4:	4c 89 f7             	mov    %r14,%rdi
+  8023f7:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  8023fe:	00 00 00 
+  802401:	ff d0                	call   *%rax
+  802403:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802406:	48 39 c3             	cmp    %rax,%rbx
+  802409:	74 36                	je     802441 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80240b:	48 89 d8             	mov    %rbx,%rax
+  80240e:	4c 29 e8             	sub    %r13,%rax
+  802411:	49 39 c4             	cmp    %rax,%r12
+  802414:	73 31                	jae    802447 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802416:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80241b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80241f:	4c 89 fe             	mov    %r15,%rsi
+  802422:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80242e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802432:	48 83 c4 08          	add    $0x8,%rsp
+  802436:	5b                   	pop    %rbx
+  802437:	41 5c                	pop    %r12
+  802439:	41 5d                	pop    %r13
+  80243b:	41 5e                	pop    %r14
+  80243d:	41 5f                	pop    %r15
+  80243f:	5d                   	pop    %rbp
+  802440:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802441:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802445:	eb eb                	jmp    802432 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802447:	48 83 eb 01          	sub    $0x1,%rbx
+  80244b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80244f:	48 89 da             	mov    %rbx,%rdx
+  802452:	4c 89 fe             	mov    %r15,%rsi
+  802455:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802461:	49 01 de             	add    %rbx,%r14
+  802464:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802469:	eb c3                	jmp    80242e <strlcat+0x69>
+
+000000000080246b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80246b:	48 85 d2             	test   %rdx,%rdx
+  80246e:	74 2d                	je     80249d <memcmp+0x32>
+  802470:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802475:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802479:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80247e:	44 38 c1             	cmp    %r8b,%cl
+  802481:	75 0f                	jne    802492 <memcmp+0x27>
+    while (n-- > 0) {
+  802483:	48 83 c0 01          	add    $0x1,%rax
+  802487:	48 39 c2             	cmp    %rax,%rdx
+  80248a:	75 e9                	jne    802475 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80248c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802491:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802492:	0f b6 c1             	movzbl %cl,%eax
+  802495:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802499:	44 29 c0             	sub    %r8d,%eax
+  80249c:	c3                   	ret
+    return 0;
+  80249d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a2:	c3                   	ret
+
+00000000008024a3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8024a3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8024a7:	48 39 c7             	cmp    %rax,%rdi
+  8024aa:	73 0f                	jae    8024bb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8024ac:	40 38 37             	cmp    %sil,(%rdi)
+  8024af:	74 0e                	je     8024bf <memfind+0x1c>
+    for (; src < end; src++) {
+  8024b1:	48 83 c7 01          	add    $0x1,%rdi
+  8024b5:	48 39 f8             	cmp    %rdi,%rax
+  8024b8:	75 f2                	jne    8024ac <memfind+0x9>
+  8024ba:	c3                   	ret
+  8024bb:	48 89 f8             	mov    %rdi,%rax
+  8024be:	c3                   	ret
+  8024bf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024c2:	c3                   	ret
+
+00000000008024c3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024c3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024c6:	0f b6 37             	movzbl (%rdi),%esi
+  8024c9:	40 80 fe 20          	cmp    $0x20,%sil
+  8024cd:	74 06                	je     8024d5 <strtol+0x12>
+  8024cf:	40 80 fe 09          	cmp    $0x9,%sil
+  8024d3:	75 13                	jne    8024e8 <strtol+0x25>
+  8024d5:	48 83 c7 01          	add    $0x1,%rdi
+  8024d9:	0f b6 37             	movzbl (%rdi),%esi
+  8024dc:	40 80 fe 20          	cmp    $0x20,%sil
+  8024e0:	74 f3                	je     8024d5 <strtol+0x12>
+  8024e2:	40 80 fe 09          	cmp    $0x9,%sil
+  8024e6:	74 ed                	je     8024d5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024e8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024eb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024ee:	3c 01                	cmp    $0x1,%al
+  8024f0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024f4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024fa:	75 0f                	jne    80250b <strtol+0x48>
+  8024fc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024ff:	74 14                	je     802515 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802501:	85 d2                	test   %edx,%edx
+  802503:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802508:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80250b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802510:	4c 63 ca             	movslq %edx,%r9
+  802513:	eb 36                	jmp    80254b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802515:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802519:	74 0f                	je     80252a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80251b:	85 d2                	test   %edx,%edx
+  80251d:	75 ec                	jne    80250b <strtol+0x48>
+        s++;
+  80251f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802523:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802528:	eb e1                	jmp    80250b <strtol+0x48>
+        s += 2;
+  80252a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80252e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802533:	eb d6                	jmp    80250b <strtol+0x48>
+            dig -= '0';
+  802535:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802538:	44 0f b6 c1          	movzbl %cl,%r8d
+  80253c:	41 39 d0             	cmp    %edx,%r8d
+  80253f:	7d 21                	jge    802562 <strtol+0x9f>
+        val = val * base + dig;
+  802541:	49 0f af c1          	imul   %r9,%rax
+  802545:	0f b6 c9             	movzbl %cl,%ecx
+  802548:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80254b:	48 83 c7 01          	add    $0x1,%rdi
+  80254f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802553:	80 f9 39             	cmp    $0x39,%cl
+  802556:	76 dd                	jbe    802535 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802558:	80 f9 7b             	cmp    $0x7b,%cl
+  80255b:	77 05                	ja     802562 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80255d:	83 e9 57             	sub    $0x57,%ecx
+  802560:	eb d6                	jmp    802538 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802562:	4d 85 d2             	test   %r10,%r10
+  802565:	74 03                	je     80256a <strtol+0xa7>
+  802567:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80256a:	48 89 c2             	mov    %rax,%rdx
+  80256d:	48 f7 da             	neg    %rdx
+  802570:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802574:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802578:	c3                   	ret
+
+0000000000802579 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802579:	55                   	push   %rbp
+  80257a:	48 89 e5             	mov    %rsp,%rbp
+  80257d:	53                   	push   %rbx
+  80257e:	48 89 fa             	mov    %rdi,%rdx
+  802581:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802584:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802589:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80258e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802593:	be 00 00 00 00       	mov    $0x0,%esi
+  802598:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80259e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025a4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8025a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025aa:	c9                   	leave
+  8025ab:	c3                   	ret
+
+00000000008025ac <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8025ac:	55                   	push   %rbp
+  8025ad:	48 89 e5             	mov    %rsp,%rbp
+  8025b0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8025b1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8025cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025db:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+
+00000000008025e3 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025e3:	55                   	push   %rbp
+  8025e4:	48 89 e5             	mov    %rsp,%rbp
+  8025e7:	53                   	push   %rbx
+  8025e8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025eb:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802604:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80260a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802610:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802612:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802616:	c9                   	leave
+  802617:	c3                   	ret
+
+0000000000802618 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802618:	55                   	push   %rbp
+  802619:	48 89 e5             	mov    %rsp,%rbp
+  80261c:	53                   	push   %rbx
+  80261d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802621:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802624:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802629:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80262e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802633:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802638:	be 00 00 00 00       	mov    $0x0,%esi
+  80263d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802643:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802649:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80264b:	48 85 c0             	test   %rax,%rax
+  80264e:	7f 06                	jg     802656 <sys_env_destroy+0x3e>
+}
+  802650:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802654:	c9                   	leave
+  802655:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802656:	49 89 c0             	mov    %rax,%r8
+  802659:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80265e:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802665:	00 00 00 
+  802668:	be 27 00 00 00       	mov    $0x27,%esi
+  80266d:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802674:	00 00 00 
+  802677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267c:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802683:	00 00 00 
+  802686:	41 ff d1             	call   *%r9
+
+0000000000802689 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802689:	55                   	push   %rbp
+  80268a:	48 89 e5             	mov    %rsp,%rbp
+  80268d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80268e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802693:	ba 00 00 00 00       	mov    $0x0,%edx
+  802698:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80269d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026b8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026be:	c9                   	leave
+  8026bf:	c3                   	ret
+
+00000000008026c0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8026c0:	55                   	push   %rbp
+  8026c1:	48 89 e5             	mov    %rsp,%rbp
+  8026c4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026c5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026de:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026ef:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026f5:	c9                   	leave
+  8026f6:	c3                   	ret
+
+00000000008026f7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026f7:	55                   	push   %rbp
+  8026f8:	48 89 e5             	mov    %rsp,%rbp
+  8026fb:	53                   	push   %rbx
+  8026fc:	48 89 fa             	mov    %rdi,%rdx
+  8026ff:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802702:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802707:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80270e:	00 00 00 
+  802711:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802716:	be 00 00 00 00       	mov    $0x0,%esi
+  80271b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802721:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802727:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802729:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80272d:	c9                   	leave
+  80272e:	c3                   	ret
+
+000000000080272f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80272f:	55                   	push   %rbp
+  802730:	48 89 e5             	mov    %rsp,%rbp
+  802733:	53                   	push   %rbx
+  802734:	49 89 f8             	mov    %rdi,%r8
+  802737:	48 89 d3             	mov    %rdx,%rbx
+  80273a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80273d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802742:	4c 89 c2             	mov    %r8,%rdx
+  802745:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802748:	be 00 00 00 00       	mov    $0x0,%esi
+  80274d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802753:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802759:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80275b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80275f:	c9                   	leave
+  802760:	c3                   	ret
+
+0000000000802761 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802761:	55                   	push   %rbp
+  802762:	48 89 e5             	mov    %rsp,%rbp
+  802765:	53                   	push   %rbx
+  802766:	48 83 ec 08          	sub    $0x8,%rsp
+  80276a:	89 f8                	mov    %edi,%eax
+  80276c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80276f:	48 63 f9             	movslq %ecx,%rdi
+  802772:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802775:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80277a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80277d:	be 00 00 00 00       	mov    $0x0,%esi
+  802782:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802788:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80278e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802790:	48 85 c0             	test   %rax,%rax
+  802793:	7f 06                	jg     80279b <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802795:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802799:	c9                   	leave
+  80279a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80279b:	49 89 c0             	mov    %rax,%r8
+  80279e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8027a3:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8027aa:	00 00 00 
+  8027ad:	be 27 00 00 00       	mov    $0x27,%esi
+  8027b2:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  8027b9:	00 00 00 
+  8027bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c1:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  8027c8:	00 00 00 
+  8027cb:	41 ff d1             	call   *%r9
+
+00000000008027ce <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027ce:	55                   	push   %rbp
+  8027cf:	48 89 e5             	mov    %rsp,%rbp
+  8027d2:	53                   	push   %rbx
+  8027d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d7:	89 f8                	mov    %edi,%eax
+  8027d9:	49 89 f2             	mov    %rsi,%r10
+  8027dc:	48 89 cf             	mov    %rcx,%rdi
+  8027df:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027e2:	48 63 da             	movslq %edx,%rbx
+  8027e5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027e8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ed:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027f0:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027fb:	48 85 c0             	test   %rax,%rax
+  8027fe:	7f 06                	jg     802806 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802804:	c9                   	leave
+  802805:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802806:	49 89 c0             	mov    %rax,%r8
+  802809:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80280e:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802815:	00 00 00 
+  802818:	be 27 00 00 00       	mov    $0x27,%esi
+  80281d:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802824:	00 00 00 
+  802827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282c:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802833:	00 00 00 
+  802836:	41 ff d1             	call   *%r9
+
+0000000000802839 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802839:	55                   	push   %rbp
+  80283a:	48 89 e5             	mov    %rsp,%rbp
+  80283d:	53                   	push   %rbx
+  80283e:	48 83 ec 08          	sub    $0x8,%rsp
+  802842:	48 89 f1             	mov    %rsi,%rcx
+  802845:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802848:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80284b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802850:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802855:	be 00 00 00 00       	mov    $0x0,%esi
+  80285a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802860:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802866:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802868:	48 85 c0             	test   %rax,%rax
+  80286b:	7f 06                	jg     802873 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80286d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802871:	c9                   	leave
+  802872:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802873:	49 89 c0             	mov    %rax,%r8
+  802876:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80287b:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802882:	00 00 00 
+  802885:	be 27 00 00 00       	mov    $0x27,%esi
+  80288a:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802891:	00 00 00 
+  802894:	b8 00 00 00 00       	mov    $0x0,%eax
+  802899:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  8028a0:	00 00 00 
+  8028a3:	41 ff d1             	call   *%r9
+
+00000000008028a6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8028a6:	55                   	push   %rbp
+  8028a7:	48 89 e5             	mov    %rsp,%rbp
+  8028aa:	53                   	push   %rbx
+  8028ab:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  8028af:	48 63 ce             	movslq %esi,%rcx
+  8028b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028b5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028d7:	48 85 c0             	test   %rax,%rax
+  8028da:	7f 06                	jg     8028e2 <sys_env_set_status+0x3c>
+}
+  8028dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028e0:	c9                   	leave
+  8028e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028e2:	49 89 c0             	mov    %rax,%r8
+  8028e5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028ea:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8028f1:	00 00 00 
+  8028f4:	be 27 00 00 00       	mov    $0x27,%esi
+  8028f9:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802900:	00 00 00 
+  802903:	b8 00 00 00 00       	mov    $0x0,%eax
+  802908:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  80290f:	00 00 00 
+  802912:	41 ff d1             	call   *%r9
+
+0000000000802915 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802915:	55                   	push   %rbp
+  802916:	48 89 e5             	mov    %rsp,%rbp
+  802919:	53                   	push   %rbx
+  80291a:	48 83 ec 08          	sub    $0x8,%rsp
+  80291e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802921:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802924:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802929:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80292e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802933:	be 00 00 00 00       	mov    $0x0,%esi
+  802938:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80293e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802944:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802946:	48 85 c0             	test   %rax,%rax
+  802949:	7f 06                	jg     802951 <sys_env_set_trapframe+0x3c>
+}
+  80294b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80294f:	c9                   	leave
+  802950:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802951:	49 89 c0             	mov    %rax,%r8
+  802954:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802959:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802960:	00 00 00 
+  802963:	be 27 00 00 00       	mov    $0x27,%esi
+  802968:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  80296f:	00 00 00 
+  802972:	b8 00 00 00 00       	mov    $0x0,%eax
+  802977:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  80297e:	00 00 00 
+  802981:	41 ff d1             	call   *%r9
+
+0000000000802984 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802984:	55                   	push   %rbp
+  802985:	48 89 e5             	mov    %rsp,%rbp
+  802988:	53                   	push   %rbx
+  802989:	48 83 ec 08          	sub    $0x8,%rsp
+  80298d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802990:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802993:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802998:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80299d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029b5:	48 85 c0             	test   %rax,%rax
+  8029b8:	7f 06                	jg     8029c0 <sys_env_set_pgfault_upcall+0x3c>
+}
+  8029ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029c0:	49 89 c0             	mov    %rax,%r8
+  8029c3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029c8:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  8029cf:	00 00 00 
+  8029d2:	be 27 00 00 00       	mov    $0x27,%esi
+  8029d7:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  8029de:	00 00 00 
+  8029e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e6:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  8029ed:	00 00 00 
+  8029f0:	41 ff d1             	call   *%r9
+
+00000000008029f3 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029f3:	55                   	push   %rbp
+  8029f4:	48 89 e5             	mov    %rsp,%rbp
+  8029f7:	53                   	push   %rbx
+  8029f8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029fc:	40 0f b6 ce          	movzbl %sil,%ecx
+  802a00:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a03:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a0d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a12:	be 00 00 00 00       	mov    $0x0,%esi
+  802a17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a1d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a25:	48 85 c0             	test   %rax,%rax
+  802a28:	7f 06                	jg     802a30 <sys_env_set_reclaim+0x3d>
+}
+  802a2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a2e:	c9                   	leave
+  802a2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a30:	49 89 c0             	mov    %rax,%r8
+  802a33:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a38:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802a3f:	00 00 00 
+  802a42:	be 27 00 00 00       	mov    $0x27,%esi
+  802a47:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802a4e:	00 00 00 
+  802a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a56:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802a5d:	00 00 00 
+  802a60:	41 ff d1             	call   *%r9
+
+0000000000802a63 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a63:	55                   	push   %rbp
+  802a64:	48 89 e5             	mov    %rsp,%rbp
+  802a67:	53                   	push   %rbx
+  802a68:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a6c:	48 63 ce             	movslq %esi,%rcx
+  802a6f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a72:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a7c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a81:	be 00 00 00 00       	mov    $0x0,%esi
+  802a86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a8c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a94:	48 85 c0             	test   %rax,%rax
+  802a97:	7f 06                	jg     802a9f <sys_env_set_nice+0x3c>
+}
+  802a99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a9d:	c9                   	leave
+  802a9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a9f:	49 89 c0             	mov    %rax,%r8
+  802aa2:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802aa7:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802aae:	00 00 00 
+  802ab1:	be 27 00 00 00       	mov    $0x27,%esi
+  802ab6:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802abd:	00 00 00 
+  802ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac5:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802acc:	00 00 00 
+  802acf:	41 ff d1             	call   *%r9
+
+0000000000802ad2 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ad2:	55                   	push   %rbp
+  802ad3:	48 89 e5             	mov    %rsp,%rbp
+  802ad6:	53                   	push   %rbx
+  802ad7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ada:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802adf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aee:	be 00 00 00 00       	mov    $0x0,%esi
+  802af3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802af9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aff:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802b01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b05:	c9                   	leave
+  802b06:	c3                   	ret
+
+0000000000802b07 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b07:	55                   	push   %rbp
+  802b08:	48 89 e5             	mov    %rsp,%rbp
+  802b0b:	53                   	push   %rbx
+  802b0c:	89 f8                	mov    %edi,%eax
+  802b0e:	49 89 f1             	mov    %rsi,%r9
+  802b11:	48 89 d3             	mov    %rdx,%rbx
+  802b14:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b17:	49 63 f0             	movslq %r8d,%rsi
+  802b1a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b1d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b22:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b2b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b31:	cd 30                	int    $0x30
+}
+  802b33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b37:	c9                   	leave
+  802b38:	c3                   	ret
+
+0000000000802b39 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b39:	55                   	push   %rbp
+  802b3a:	48 89 e5             	mov    %rsp,%rbp
+  802b3d:	53                   	push   %rbx
+  802b3e:	89 f8                	mov    %edi,%eax
+  802b40:	49 89 f1             	mov    %rsi,%r9
+  802b43:	48 89 d3             	mov    %rdx,%rbx
+  802b46:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b49:	49 63 f0             	movslq %r8d,%rsi
+  802b4c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b4f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b54:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b63:	cd 30                	int    $0x30
+}
+  802b65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b69:	c9                   	leave
+  802b6a:	c3                   	ret
+
+0000000000802b6b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b6b:	55                   	push   %rbp
+  802b6c:	48 89 e5             	mov    %rsp,%rbp
+  802b6f:	53                   	push   %rbx
+  802b70:	48 83 ec 08          	sub    $0x8,%rsp
+  802b74:	89 f8                	mov    %edi,%eax
+  802b76:	49 89 f2             	mov    %rsi,%r10
+  802b79:	48 89 d3             	mov    %rdx,%rbx
+  802b7c:	48 89 cf             	mov    %rcx,%rdi
+  802b7f:	44 89 c6             	mov    %r8d,%esi
+  802b82:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b85:	48 63 f6             	movslq %esi,%rsi
+  802b88:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b8b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b90:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b93:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b97:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b99:	48 85 c0             	test   %rax,%rax
+  802b9c:	7f 06                	jg     802ba4 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ba2:	c9                   	leave
+  802ba3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ba4:	49 89 c0             	mov    %rax,%r8
+  802ba7:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802bac:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802bb3:	00 00 00 
+  802bb6:	be 27 00 00 00       	mov    $0x27,%esi
+  802bbb:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802bc2:	00 00 00 
+  802bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bca:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802bd1:	00 00 00 
+  802bd4:	41 ff d1             	call   *%r9
+
+0000000000802bd7 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bd7:	55                   	push   %rbp
+  802bd8:	48 89 e5             	mov    %rsp,%rbp
+  802bdb:	53                   	push   %rbx
+  802bdc:	48 83 ec 08          	sub    $0x8,%rsp
+  802be0:	48 89 f1             	mov    %rsi,%rcx
+  802be3:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802be6:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bea:	48 8b 1a             	mov    (%rdx),%rbx
+  802bed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bf0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bf5:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bf9:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bfd:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802c01:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c03:	48 85 c0             	test   %rax,%rax
+  802c06:	7f 06                	jg     802c0e <sys_ipc_call_short+0x37>
+}
+  802c08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c0c:	c9                   	leave
+  802c0d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c0e:	49 89 c0             	mov    %rax,%r8
+  802c11:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802c16:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802c1d:	00 00 00 
+  802c20:	be 27 00 00 00       	mov    $0x27,%esi
+  802c25:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802c2c:	00 00 00 
+  802c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c34:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802c3b:	00 00 00 
+  802c3e:	41 ff d1             	call   *%r9
+
+0000000000802c41 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c41:	55                   	push   %rbp
+  802c42:	48 89 e5             	mov    %rsp,%rbp
+  802c45:	53                   	push   %rbx
+  802c46:	48 83 ec 08          	sub    $0x8,%rsp
+  802c4a:	89 f8                	mov    %edi,%eax
+  802c4c:	49 89 f2             	mov    %rsi,%r10
+  802c4f:	48 89 d3             	mov    %rdx,%rbx
+  802c52:	48 89 cf             	mov    %rcx,%rdi
+  802c55:	44 89 c6             	mov    %r8d,%esi
+  802c58:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c5b:	48 63 f6             	movslq %esi,%rsi
+  802c5e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c61:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c66:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c69:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c6d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c6f:	48 85 c0             	test   %rax,%rax
+  802c72:	7f 06                	jg     802c7a <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c78:	c9                   	leave
+  802c79:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c7a:	49 89 c0             	mov    %rax,%r8
+  802c7d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c82:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802c89:	00 00 00 
+  802c8c:	be 27 00 00 00       	mov    $0x27,%esi
+  802c91:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802c98:	00 00 00 
+  802c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca0:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802ca7:	00 00 00 
+  802caa:	41 ff d1             	call   *%r9
+
+0000000000802cad <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802cad:	55                   	push   %rbp
+  802cae:	48 89 e5             	mov    %rsp,%rbp
+  802cb1:	53                   	push   %rbx
+  802cb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb6:	48 89 fa             	mov    %rdi,%rdx
+  802cb9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802cbc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cc6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ccb:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cd6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cdc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cde:	48 85 c0             	test   %rax,%rax
+  802ce1:	7f 06                	jg     802ce9 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ce3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce7:	c9                   	leave
+  802ce8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ce9:	49 89 c0             	mov    %rax,%r8
+  802cec:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cf1:	48 ba 88 61 80 00 00 	movabs $0x806188,%rdx
+  802cf8:	00 00 00 
+  802cfb:	be 27 00 00 00       	mov    $0x27,%esi
+  802d00:	48 bf a7 61 80 00 00 	movabs $0x8061a7,%rdi
+  802d07:	00 00 00 
+  802d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0f:	49 b9 b3 50 80 00 00 	movabs $0x8050b3,%r9
+  802d16:	00 00 00 
+  802d19:	41 ff d1             	call   *%r9
+
+0000000000802d1c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802d1c:	55                   	push   %rbp
+  802d1d:	48 89 e5             	mov    %rsp,%rbp
+  802d20:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d21:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d26:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d35:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d3a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d3f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d45:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d4b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d51:	c9                   	leave
+  802d52:	c3                   	ret
+
+0000000000802d53 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d53:	55                   	push   %rbp
+  802d54:	48 89 e5             	mov    %rsp,%rbp
+  802d57:	53                   	push   %rbx
+  802d58:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d5b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d60:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d6a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d6f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d74:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d7a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d80:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d82:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d86:	c9                   	leave
+  802d87:	c3                   	ret
+
+0000000000802d88 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d88:	55                   	push   %rbp
+  802d89:	48 89 e5             	mov    %rsp,%rbp
+  802d8c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d8d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d92:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d97:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802da6:	be 00 00 00 00       	mov    $0x0,%esi
+  802dab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802db1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db7:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802db9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dbd:	c9                   	leave
+  802dbe:	c3                   	ret
+
+0000000000802dbf <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dbf:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dc6:	ff ff ff 
+  802dc9:	48 01 f8             	add    %rdi,%rax
+  802dcc:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802dd0:	c3                   	ret
+
+0000000000802dd1 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dd1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802dd8:	ff ff ff 
+  802ddb:	48 01 f8             	add    %rdi,%rax
+  802dde:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802de2:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802de8:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dec:	c3                   	ret
+
+0000000000802ded <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802ded:	55                   	push   %rbp
+  802dee:	48 89 e5             	mov    %rsp,%rbp
+  802df1:	41 57                	push   %r15
+  802df3:	41 56                	push   %r14
+  802df5:	41 55                	push   %r13
+  802df7:	41 54                	push   %r12
+  802df9:	53                   	push   %rbx
+  802dfa:	48 83 ec 08          	sub    $0x8,%rsp
+  802dfe:	49 89 ff             	mov    %rdi,%r15
+  802e01:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802e06:	49 bd ed 42 80 00 00 	movabs $0x8042ed,%r13
+  802e0d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802e10:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802e16:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802e19:	48 89 df             	mov    %rbx,%rdi
+  802e1c:	41 ff d5             	call   *%r13
+  802e1f:	83 e0 04             	and    $0x4,%eax
+  802e22:	74 17                	je     802e3b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e24:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e2b:	4c 39 f3             	cmp    %r14,%rbx
+  802e2e:	75 e6                	jne    802e16 <fd_alloc+0x29>
+  802e30:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e36:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e3b:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e3e:	48 83 c4 08          	add    $0x8,%rsp
+  802e42:	5b                   	pop    %rbx
+  802e43:	41 5c                	pop    %r12
+  802e45:	41 5d                	pop    %r13
+  802e47:	41 5e                	pop    %r14
+  802e49:	41 5f                	pop    %r15
+  802e4b:	5d                   	pop    %rbp
+  802e4c:	c3                   	ret
+
+0000000000802e4d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e4d:	83 ff 1f             	cmp    $0x1f,%edi
+  802e50:	77 39                	ja     802e8b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e52:	55                   	push   %rbp
+  802e53:	48 89 e5             	mov    %rsp,%rbp
+  802e56:	41 54                	push   %r12
+  802e58:	53                   	push   %rbx
+  802e59:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e5c:	48 63 df             	movslq %edi,%rbx
+  802e5f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e66:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e6a:	48 89 df             	mov    %rbx,%rdi
+  802e6d:	48 b8 ed 42 80 00 00 	movabs $0x8042ed,%rax
+  802e74:	00 00 00 
+  802e77:	ff d0                	call   *%rax
+  802e79:	a8 04                	test   $0x4,%al
+  802e7b:	74 14                	je     802e91 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e7d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e86:	5b                   	pop    %rbx
+  802e87:	41 5c                	pop    %r12
+  802e89:	5d                   	pop    %rbp
+  802e8a:	c3                   	ret
+        return -E_INVAL;
+  802e8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e90:	c3                   	ret
+        return -E_INVAL;
+  802e91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e96:	eb ee                	jmp    802e86 <fd_lookup+0x39>
+
+0000000000802e98 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e98:	55                   	push   %rbp
+  802e99:	48 89 e5             	mov    %rsp,%rbp
+  802e9c:	41 54                	push   %r12
+  802e9e:	53                   	push   %rbx
+  802e9f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802ea2:	48 b8 40 62 80 00 00 	movabs $0x806240,%rax
+  802ea9:	00 00 00 
+  802eac:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802eb3:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802eb6:	39 3b                	cmp    %edi,(%rbx)
+  802eb8:	74 47                	je     802f01 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802eba:	48 83 c0 08          	add    $0x8,%rax
+  802ebe:	48 8b 18             	mov    (%rax),%rbx
+  802ec1:	48 85 db             	test   %rbx,%rbx
+  802ec4:	75 f0                	jne    802eb6 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ec6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ecd:	00 00 00 
+  802ed0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ed6:	89 fa                	mov    %edi,%edx
+  802ed8:	48 bf b8 61 80 00 00 	movabs $0x8061b8,%rdi
+  802edf:	00 00 00 
+  802ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee7:	48 b9 c5 16 80 00 00 	movabs $0x8016c5,%rcx
+  802eee:	00 00 00 
+  802ef1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ef3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ef8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802efc:	5b                   	pop    %rbx
+  802efd:	41 5c                	pop    %r12
+  802eff:	5d                   	pop    %rbp
+  802f00:	c3                   	ret
+            return 0;
+  802f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f06:	eb f0                	jmp    802ef8 <dev_lookup+0x60>
+
+0000000000802f08 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802f08:	55                   	push   %rbp
+  802f09:	48 89 e5             	mov    %rsp,%rbp
+  802f0c:	41 55                	push   %r13
+  802f0e:	41 54                	push   %r12
+  802f10:	53                   	push   %rbx
+  802f11:	48 83 ec 18          	sub    $0x18,%rsp
+  802f15:	48 89 fb             	mov    %rdi,%rbx
+  802f18:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f1b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f22:	ff ff ff 
+  802f25:	48 01 df             	add    %rbx,%rdi
+  802f28:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f2c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f30:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  802f37:	00 00 00 
+  802f3a:	ff d0                	call   *%rax
+  802f3c:	41 89 c5             	mov    %eax,%r13d
+  802f3f:	85 c0                	test   %eax,%eax
+  802f41:	78 06                	js     802f49 <fd_close+0x41>
+  802f43:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f47:	74 1a                	je     802f63 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f49:	45 84 e4             	test   %r12b,%r12b
+  802f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f51:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f55:	44 89 e8             	mov    %r13d,%eax
+  802f58:	48 83 c4 18          	add    $0x18,%rsp
+  802f5c:	5b                   	pop    %rbx
+  802f5d:	41 5c                	pop    %r12
+  802f5f:	41 5d                	pop    %r13
+  802f61:	5d                   	pop    %rbp
+  802f62:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f63:	8b 3b                	mov    (%rbx),%edi
+  802f65:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f69:	48 b8 98 2e 80 00 00 	movabs $0x802e98,%rax
+  802f70:	00 00 00 
+  802f73:	ff d0                	call   *%rax
+  802f75:	41 89 c5             	mov    %eax,%r13d
+  802f78:	85 c0                	test   %eax,%eax
+  802f7a:	78 1b                	js     802f97 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f80:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f84:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f8a:	48 85 c0             	test   %rax,%rax
+  802f8d:	74 08                	je     802f97 <fd_close+0x8f>
+  802f8f:	48 89 df             	mov    %rbx,%rdi
+  802f92:	ff d0                	call   *%rax
+  802f94:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f97:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f9c:	48 89 de             	mov    %rbx,%rsi
+  802f9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa4:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+    return res;
+  802fb0:	eb a3                	jmp    802f55 <fd_close+0x4d>
+
+0000000000802fb2 <close>:
+
+int
+close(int fdnum) {
+  802fb2:	55                   	push   %rbp
+  802fb3:	48 89 e5             	mov    %rsp,%rbp
+  802fb6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802fba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802fbe:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  802fc5:	00 00 00 
+  802fc8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fca:	85 c0                	test   %eax,%eax
+  802fcc:	78 15                	js     802fe3 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fce:	be 01 00 00 00       	mov    $0x1,%esi
+  802fd3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fd7:	48 b8 08 2f 80 00 00 	movabs $0x802f08,%rax
+  802fde:	00 00 00 
+  802fe1:	ff d0                	call   *%rax
+}
+  802fe3:	c9                   	leave
+  802fe4:	c3                   	ret
+
+0000000000802fe5 <close_all>:
+
+void
+close_all(void) {
+  802fe5:	55                   	push   %rbp
+  802fe6:	48 89 e5             	mov    %rsp,%rbp
+  802fe9:	41 54                	push   %r12
+  802feb:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ff1:	49 bc b2 2f 80 00 00 	movabs $0x802fb2,%r12
+  802ff8:	00 00 00 
+  802ffb:	89 df                	mov    %ebx,%edi
+  802ffd:	41 ff d4             	call   *%r12
+  803000:	83 c3 01             	add    $0x1,%ebx
+  803003:	83 fb 20             	cmp    $0x20,%ebx
+  803006:	75 f3                	jne    802ffb <close_all+0x16>
+}
+  803008:	5b                   	pop    %rbx
+  803009:	41 5c                	pop    %r12
+  80300b:	5d                   	pop    %rbp
+  80300c:	c3                   	ret
+
+000000000080300d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80300d:	55                   	push   %rbp
+  80300e:	48 89 e5             	mov    %rsp,%rbp
+  803011:	41 57                	push   %r15
+  803013:	41 56                	push   %r14
+  803015:	41 55                	push   %r13
+  803017:	41 54                	push   %r12
+  803019:	53                   	push   %rbx
+  80301a:	48 83 ec 18          	sub    $0x18,%rsp
+  80301e:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803021:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803025:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  80302c:	00 00 00 
+  80302f:	ff d0                	call   *%rax
+  803031:	89 c3                	mov    %eax,%ebx
+  803033:	85 c0                	test   %eax,%eax
+  803035:	0f 88 b8 00 00 00    	js     8030f3 <dup+0xe6>
+    close(newfdnum);
+  80303b:	44 89 e7             	mov    %r12d,%edi
+  80303e:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  803045:	00 00 00 
+  803048:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80304a:	4d 63 ec             	movslq %r12d,%r13
+  80304d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803054:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803058:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80305c:	4c 89 ff             	mov    %r15,%rdi
+  80305f:	49 be d1 2d 80 00 00 	movabs $0x802dd1,%r14
+  803066:	00 00 00 
+  803069:	41 ff d6             	call   *%r14
+  80306c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80306f:	4c 89 ef             	mov    %r13,%rdi
+  803072:	41 ff d6             	call   *%r14
+  803075:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803078:	48 89 df             	mov    %rbx,%rdi
+  80307b:	48 b8 ed 42 80 00 00 	movabs $0x8042ed,%rax
+  803082:	00 00 00 
+  803085:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803087:	a8 04                	test   $0x4,%al
+  803089:	74 2b                	je     8030b6 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80308b:	41 89 c1             	mov    %eax,%r9d
+  80308e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803094:	4c 89 f1             	mov    %r14,%rcx
+  803097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80309c:	48 89 de             	mov    %rbx,%rsi
+  80309f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a4:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8030ab:	00 00 00 
+  8030ae:	ff d0                	call   *%rax
+  8030b0:	89 c3                	mov    %eax,%ebx
+  8030b2:	85 c0                	test   %eax,%eax
+  8030b4:	78 4e                	js     803104 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8030b6:	4c 89 ff             	mov    %r15,%rdi
+  8030b9:	48 b8 ed 42 80 00 00 	movabs $0x8042ed,%rax
+  8030c0:	00 00 00 
+  8030c3:	ff d0                	call   *%rax
+  8030c5:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030c8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030ce:	4c 89 e9             	mov    %r13,%rcx
+  8030d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d6:	4c 89 fe             	mov    %r15,%rsi
+  8030d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030de:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8030e5:	00 00 00 
+  8030e8:	ff d0                	call   *%rax
+  8030ea:	89 c3                	mov    %eax,%ebx
+  8030ec:	85 c0                	test   %eax,%eax
+  8030ee:	78 14                	js     803104 <dup+0xf7>
+
+    return newfdnum;
+  8030f0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030f3:	89 d8                	mov    %ebx,%eax
+  8030f5:	48 83 c4 18          	add    $0x18,%rsp
+  8030f9:	5b                   	pop    %rbx
+  8030fa:	41 5c                	pop    %r12
+  8030fc:	41 5d                	pop    %r13
+  8030fe:	41 5e                	pop    %r14
+  803100:	41 5f                	pop    %r15
+  803102:	5d                   	pop    %rbp
+  803103:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803104:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803109:	4c 89 ee             	mov    %r13,%rsi
+  80310c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803111:	49 bc 39 28 80 00 00 	movabs $0x802839,%r12
+  803118:	00 00 00 
+  80311b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80311e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803123:	4c 89 f6             	mov    %r14,%rsi
+  803126:	bf 00 00 00 00       	mov    $0x0,%edi
+  80312b:	41 ff d4             	call   *%r12
+    return res;
+  80312e:	eb c3                	jmp    8030f3 <dup+0xe6>
+
+0000000000803130 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803130:	55                   	push   %rbp
+  803131:	48 89 e5             	mov    %rsp,%rbp
+  803134:	41 56                	push   %r14
+  803136:	41 55                	push   %r13
+  803138:	41 54                	push   %r12
+  80313a:	53                   	push   %rbx
+  80313b:	48 83 ec 10          	sub    $0x10,%rsp
+  80313f:	89 fb                	mov    %edi,%ebx
+  803141:	49 89 f4             	mov    %rsi,%r12
+  803144:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803147:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80314b:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  803152:	00 00 00 
+  803155:	ff d0                	call   *%rax
+  803157:	85 c0                	test   %eax,%eax
+  803159:	78 4c                	js     8031a7 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80315b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80315f:	41 8b 3e             	mov    (%r14),%edi
+  803162:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803166:	48 b8 98 2e 80 00 00 	movabs $0x802e98,%rax
+  80316d:	00 00 00 
+  803170:	ff d0                	call   *%rax
+  803172:	85 c0                	test   %eax,%eax
+  803174:	78 35                	js     8031ab <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803176:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80317a:	83 e0 03             	and    $0x3,%eax
+  80317d:	83 f8 01             	cmp    $0x1,%eax
+  803180:	74 2d                	je     8031af <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803182:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803186:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80318a:	48 85 c0             	test   %rax,%rax
+  80318d:	74 56                	je     8031e5 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80318f:	4c 89 ea             	mov    %r13,%rdx
+  803192:	4c 89 e6             	mov    %r12,%rsi
+  803195:	4c 89 f7             	mov    %r14,%rdi
+  803198:	ff d0                	call   *%rax
+}
+  80319a:	48 83 c4 10          	add    $0x10,%rsp
+  80319e:	5b                   	pop    %rbx
+  80319f:	41 5c                	pop    %r12
+  8031a1:	41 5d                	pop    %r13
+  8031a3:	41 5e                	pop    %r14
+  8031a5:	5d                   	pop    %rbp
+  8031a6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031a7:	48 98                	cltq
+  8031a9:	eb ef                	jmp    80319a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8031ab:	48 98                	cltq
+  8031ad:	eb eb                	jmp    80319a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031af:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031b6:	00 00 00 
+  8031b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031bf:	89 da                	mov    %ebx,%edx
+  8031c1:	48 bf f9 61 80 00 00 	movabs $0x8061f9,%rdi
+  8031c8:	00 00 00 
+  8031cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d0:	48 b9 c5 16 80 00 00 	movabs $0x8016c5,%rcx
+  8031d7:	00 00 00 
+  8031da:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031dc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031e3:	eb b5                	jmp    80319a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031e5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031ec:	eb ac                	jmp    80319a <read+0x6a>
+
+00000000008031ee <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031ee:	55                   	push   %rbp
+  8031ef:	48 89 e5             	mov    %rsp,%rbp
+  8031f2:	41 57                	push   %r15
+  8031f4:	41 56                	push   %r14
+  8031f6:	41 55                	push   %r13
+  8031f8:	41 54                	push   %r12
+  8031fa:	53                   	push   %rbx
+  8031fb:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031ff:	48 85 d2             	test   %rdx,%rdx
+  803202:	74 54                	je     803258 <readn+0x6a>
+  803204:	41 89 fd             	mov    %edi,%r13d
+  803207:	49 89 f6             	mov    %rsi,%r14
+  80320a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80320d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803212:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803217:	49 bf 30 31 80 00 00 	movabs $0x803130,%r15
+  80321e:	00 00 00 
+  803221:	4c 89 e2             	mov    %r12,%rdx
+  803224:	48 29 f2             	sub    %rsi,%rdx
+  803227:	4c 01 f6             	add    %r14,%rsi
+  80322a:	44 89 ef             	mov    %r13d,%edi
+  80322d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803230:	85 c0                	test   %eax,%eax
+  803232:	78 20                	js     803254 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803234:	01 c3                	add    %eax,%ebx
+  803236:	85 c0                	test   %eax,%eax
+  803238:	74 08                	je     803242 <readn+0x54>
+  80323a:	48 63 f3             	movslq %ebx,%rsi
+  80323d:	4c 39 e6             	cmp    %r12,%rsi
+  803240:	72 df                	jb     803221 <readn+0x33>
+    }
+    return res;
+  803242:	48 63 c3             	movslq %ebx,%rax
+}
+  803245:	48 83 c4 08          	add    $0x8,%rsp
+  803249:	5b                   	pop    %rbx
+  80324a:	41 5c                	pop    %r12
+  80324c:	41 5d                	pop    %r13
+  80324e:	41 5e                	pop    %r14
+  803250:	41 5f                	pop    %r15
+  803252:	5d                   	pop    %rbp
+  803253:	c3                   	ret
+        if (inc < 0) return inc;
+  803254:	48 98                	cltq
+  803256:	eb ed                	jmp    803245 <readn+0x57>
+    int inc = 1, res = 0;
+  803258:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80325d:	eb e3                	jmp    803242 <readn+0x54>
+
+000000000080325f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+  803263:	41 56                	push   %r14
+  803265:	41 55                	push   %r13
+  803267:	41 54                	push   %r12
+  803269:	53                   	push   %rbx
+  80326a:	48 83 ec 10          	sub    $0x10,%rsp
+  80326e:	89 fb                	mov    %edi,%ebx
+  803270:	49 89 f4             	mov    %rsi,%r12
+  803273:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803276:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80327a:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  803281:	00 00 00 
+  803284:	ff d0                	call   *%rax
+  803286:	85 c0                	test   %eax,%eax
+  803288:	78 47                	js     8032d1 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80328a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80328e:	41 8b 3e             	mov    (%r14),%edi
+  803291:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803295:	48 b8 98 2e 80 00 00 	movabs $0x802e98,%rax
+  80329c:	00 00 00 
+  80329f:	ff d0                	call   *%rax
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	78 30                	js     8032d5 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8032a5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8032aa:	74 2d                	je     8032d9 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032b0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032b4:	48 85 c0             	test   %rax,%rax
+  8032b7:	74 56                	je     80330f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8032b9:	4c 89 ea             	mov    %r13,%rdx
+  8032bc:	4c 89 e6             	mov    %r12,%rsi
+  8032bf:	4c 89 f7             	mov    %r14,%rdi
+  8032c2:	ff d0                	call   *%rax
+}
+  8032c4:	48 83 c4 10          	add    $0x10,%rsp
+  8032c8:	5b                   	pop    %rbx
+  8032c9:	41 5c                	pop    %r12
+  8032cb:	41 5d                	pop    %r13
+  8032cd:	41 5e                	pop    %r14
+  8032cf:	5d                   	pop    %rbp
+  8032d0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032d1:	48 98                	cltq
+  8032d3:	eb ef                	jmp    8032c4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032d5:	48 98                	cltq
+  8032d7:	eb eb                	jmp    8032c4 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032d9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032e0:	00 00 00 
+  8032e3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032e9:	89 da                	mov    %ebx,%edx
+  8032eb:	48 bf 15 62 80 00 00 	movabs $0x806215,%rdi
+  8032f2:	00 00 00 
+  8032f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fa:	48 b9 c5 16 80 00 00 	movabs $0x8016c5,%rcx
+  803301:	00 00 00 
+  803304:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803306:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80330d:	eb b5                	jmp    8032c4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80330f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803316:	eb ac                	jmp    8032c4 <write+0x65>
+
+0000000000803318 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803318:	55                   	push   %rbp
+  803319:	48 89 e5             	mov    %rsp,%rbp
+  80331c:	53                   	push   %rbx
+  80331d:	48 83 ec 18          	sub    $0x18,%rsp
+  803321:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803323:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803327:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+  803333:	85 c0                	test   %eax,%eax
+  803335:	78 0c                	js     803343 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803337:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80333b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80333e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803343:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803347:	c9                   	leave
+  803348:	c3                   	ret
+
+0000000000803349 <tell>:
+
+int tell(int fdnum) {
+  803349:	55                   	push   %rbp
+  80334a:	48 89 e5             	mov    %rsp,%rbp
+  80334d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803351:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803355:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  80335c:	00 00 00 
+  80335f:	ff d0                	call   *%rax
+  803361:	85 c0                	test   %eax,%eax
+  803363:	78 07                	js     80336c <tell+0x23>
+
+    return fd->fd_offset;
+  803365:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803369:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80336c:	c9                   	leave
+  80336d:	c3                   	ret
+
+000000000080336e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80336e:	55                   	push   %rbp
+  80336f:	48 89 e5             	mov    %rsp,%rbp
+  803372:	41 55                	push   %r13
+  803374:	41 54                	push   %r12
+  803376:	53                   	push   %rbx
+  803377:	48 83 ec 18          	sub    $0x18,%rsp
+  80337b:	89 fb                	mov    %edi,%ebx
+  80337d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803380:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803384:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  80338b:	00 00 00 
+  80338e:	ff d0                	call   *%rax
+  803390:	85 c0                	test   %eax,%eax
+  803392:	78 38                	js     8033cc <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803394:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803398:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80339c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033a0:	48 b8 98 2e 80 00 00 	movabs $0x802e98,%rax
+  8033a7:	00 00 00 
+  8033aa:	ff d0                	call   *%rax
+  8033ac:	85 c0                	test   %eax,%eax
+  8033ae:	78 1c                	js     8033cc <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033b0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8033b5:	74 20                	je     8033d7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033bb:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033bf:	48 85 c0             	test   %rax,%rax
+  8033c2:	74 47                	je     80340b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8033c4:	44 89 e6             	mov    %r12d,%esi
+  8033c7:	4c 89 ef             	mov    %r13,%rdi
+  8033ca:	ff d0                	call   *%rax
+}
+  8033cc:	48 83 c4 18          	add    $0x18,%rsp
+  8033d0:	5b                   	pop    %rbx
+  8033d1:	41 5c                	pop    %r12
+  8033d3:	41 5d                	pop    %r13
+  8033d5:	5d                   	pop    %rbp
+  8033d6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033d7:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033de:	00 00 00 
+  8033e1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033e7:	89 da                	mov    %ebx,%edx
+  8033e9:	48 bf d8 61 80 00 00 	movabs $0x8061d8,%rdi
+  8033f0:	00 00 00 
+  8033f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f8:	48 b9 c5 16 80 00 00 	movabs $0x8016c5,%rcx
+  8033ff:	00 00 00 
+  803402:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803404:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803409:	eb c1                	jmp    8033cc <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80340b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803410:	eb ba                	jmp    8033cc <ftruncate+0x5e>
+
+0000000000803412 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803412:	55                   	push   %rbp
+  803413:	48 89 e5             	mov    %rsp,%rbp
+  803416:	41 54                	push   %r12
+  803418:	53                   	push   %rbx
+  803419:	48 83 ec 10          	sub    $0x10,%rsp
+  80341d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803420:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803424:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  80342b:	00 00 00 
+  80342e:	ff d0                	call   *%rax
+  803430:	85 c0                	test   %eax,%eax
+  803432:	78 63                	js     803497 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803434:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803438:	41 8b 3c 24          	mov    (%r12),%edi
+  80343c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803440:	48 b8 98 2e 80 00 00 	movabs $0x802e98,%rax
+  803447:	00 00 00 
+  80344a:	ff d0                	call   *%rax
+  80344c:	85 c0                	test   %eax,%eax
+  80344e:	78 47                	js     803497 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803450:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803454:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803459:	74 45                	je     8034a0 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80345b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80345e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803465:	00 00 00 
+    stat->st_isdir = 0;
+  803468:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80346f:	00 00 00 
+    stat->st_ino = 0;
+  803472:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803479:	00 00 00 00 
+    stat->st_version = 0;
+  80347d:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803484:	00 00 00 
+    stat->st_dev = dev;
+  803487:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80348e:	48 89 de             	mov    %rbx,%rsi
+  803491:	4c 89 e7             	mov    %r12,%rdi
+  803494:	ff 50 28             	call   *0x28(%rax)
+}
+  803497:	48 83 c4 10          	add    $0x10,%rsp
+  80349b:	5b                   	pop    %rbx
+  80349c:	41 5c                	pop    %r12
+  80349e:	5d                   	pop    %rbp
+  80349f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8034a0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8034a5:	eb f0                	jmp    803497 <fstat+0x85>
+
+00000000008034a7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8034a7:	55                   	push   %rbp
+  8034a8:	48 89 e5             	mov    %rsp,%rbp
+  8034ab:	41 54                	push   %r12
+  8034ad:	53                   	push   %rbx
+  8034ae:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8034b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b6:	48 b8 c8 39 80 00 00 	movabs $0x8039c8,%rax
+  8034bd:	00 00 00 
+  8034c0:	ff d0                	call   *%rax
+  8034c2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034c4:	85 c0                	test   %eax,%eax
+  8034c6:	78 25                	js     8034ed <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034c8:	4c 89 e6             	mov    %r12,%rsi
+  8034cb:	89 c7                	mov    %eax,%edi
+  8034cd:	48 b8 12 34 80 00 00 	movabs $0x803412,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+  8034d9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034dc:	89 df                	mov    %ebx,%edi
+  8034de:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  8034e5:	00 00 00 
+  8034e8:	ff d0                	call   *%rax
+
+    return res;
+  8034ea:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034ed:	89 d8                	mov    %ebx,%eax
+  8034ef:	5b                   	pop    %rbx
+  8034f0:	41 5c                	pop    %r12
+  8034f2:	5d                   	pop    %rbp
+  8034f3:	c3                   	ret
+
+00000000008034f4 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034f4:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034fb:	00 00 00 
+  8034fe:	83 38 00             	cmpl   $0x0,(%rax)
+  803501:	74 0a                	je     80350d <fsipc_env+0x19>
+    return fsenv;
+}
+  803503:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80350a:	00 00 
+  80350c:	c3                   	ret
+fsipc_env(void) {
+  80350d:	55                   	push   %rbp
+  80350e:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803511:	bf 03 00 00 00       	mov    $0x3,%edi
+  803516:	48 b8 9a 56 80 00 00 	movabs $0x80569a,%rax
+  80351d:	00 00 00 
+  803520:	ff d0                	call   *%rax
+  803522:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803529:	00 00 
+}
+  80352b:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803532:	00 00 
+  803534:	5d                   	pop    %rbp
+  803535:	c3                   	ret
+
+0000000000803536 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803536:	55                   	push   %rbp
+  803537:	48 89 e5             	mov    %rsp,%rbp
+  80353a:	53                   	push   %rbx
+  80353b:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80353f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803546:	00 
+  803547:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80354e:	00 
+  80354f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803556:	00 
+  803557:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80355e:	00 
+  80355f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803566:	00 
+
+    assert(size <= sizeof(words));
+  803567:	48 83 fa 28          	cmp    $0x28,%rdx
+  80356b:	77 38                	ja     8035a5 <fsipc_short+0x6f>
+  80356d:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80356f:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803573:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  80357a:	00 00 00 
+  80357d:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80357f:	48 b8 f4 34 80 00 00 	movabs $0x8034f4,%rax
+  803586:	00 00 00 
+  803589:	ff d0                	call   *%rax
+  80358b:	89 c7                	mov    %eax,%edi
+  80358d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803591:	89 de                	mov    %ebx,%esi
+  803593:	48 b8 fd 55 80 00 00 	movabs $0x8055fd,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+}
+  80359f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035a3:	c9                   	leave
+  8035a4:	c3                   	ret
+    assert(size <= sizeof(words));
+  8035a5:	48 b9 60 62 80 00 00 	movabs $0x806260,%rcx
+  8035ac:	00 00 00 
+  8035af:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8035b6:	00 00 00 
+  8035b9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8035be:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  8035c5:	00 00 00 
+  8035c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035cd:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  8035d4:	00 00 00 
+  8035d7:	41 ff d0             	call   *%r8
+
+00000000008035da <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035da:	55                   	push   %rbp
+  8035db:	48 89 e5             	mov    %rsp,%rbp
+  8035de:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035e2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035e5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035e8:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035eb:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035f0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035f4:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035f9:	48 b8 36 35 80 00 00 	movabs $0x803536,%rax
+  803600:	00 00 00 
+  803603:	ff d0                	call   *%rax
+}
+  803605:	c9                   	leave
+  803606:	c3                   	ret
+
+0000000000803607 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803607:	55                   	push   %rbp
+  803608:	48 89 e5             	mov    %rsp,%rbp
+  80360b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  80360f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803612:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803615:	ba 04 00 00 00       	mov    $0x4,%edx
+  80361a:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80361e:	bf 06 00 00 00       	mov    $0x6,%edi
+  803623:	48 b8 36 35 80 00 00 	movabs $0x803536,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+}
+  80362f:	c9                   	leave
+  803630:	c3                   	ret
+
+0000000000803631 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803631:	55                   	push   %rbp
+  803632:	48 89 e5             	mov    %rsp,%rbp
+  803635:	41 54                	push   %r12
+  803637:	53                   	push   %rbx
+  803638:	48 83 ec 10          	sub    $0x10,%rsp
+  80363c:	89 fb                	mov    %edi,%ebx
+  80363e:	49 89 f4             	mov    %rsi,%r12
+  803641:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803645:	48 b8 f4 34 80 00 00 	movabs $0x8034f4,%rax
+  80364c:	00 00 00 
+  80364f:	ff d0                	call   *%rax
+  803651:	89 c7                	mov    %eax,%edi
+  803653:	6a 00                	push   $0x0
+  803655:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803659:	50                   	push   %rax
+  80365a:	4d 89 e1             	mov    %r12,%r9
+  80365d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803663:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803668:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80366f:	00 00 00 
+  803672:	89 de                	mov    %ebx,%esi
+  803674:	48 b8 98 55 80 00 00 	movabs $0x805598,%rax
+  80367b:	00 00 00 
+  80367e:	ff d0                	call   *%rax
+}
+  803680:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803684:	5b                   	pop    %rbx
+  803685:	41 5c                	pop    %r12
+  803687:	5d                   	pop    %rbp
+  803688:	c3                   	ret
+
+0000000000803689 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803689:	55                   	push   %rbp
+  80368a:	48 89 e5             	mov    %rsp,%rbp
+  80368d:	41 54                	push   %r12
+  80368f:	53                   	push   %rbx
+  803690:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803693:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803696:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80369d:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80369f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8036a9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8036ae:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  8036b5:	00 00 00 
+  8036b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036ba:	85 c0                	test   %eax,%eax
+  8036bc:	78 5a                	js     803718 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8036be:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036c5:	00 00 00 
+  8036c8:	4c 89 e6             	mov    %r12,%rsi
+  8036cb:	48 89 df             	mov    %rbx,%rdi
+  8036ce:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  8036d5:	00 00 00 
+  8036d8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036da:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036e1:	00 
+  8036e2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036e8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036ef:	00 
+  8036f0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036f6:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036fd:	00 
+  8036fe:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803705:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  80370c:	00 
+  80370d:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803713:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803718:	5b                   	pop    %rbx
+  803719:	41 5c                	pop    %r12
+  80371b:	5d                   	pop    %rbp
+  80371c:	c3                   	ret
+
+000000000080371d <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80371d:	55                   	push   %rbp
+  80371e:	48 89 e5             	mov    %rsp,%rbp
+  803721:	41 57                	push   %r15
+  803723:	41 56                	push   %r14
+  803725:	41 55                	push   %r13
+  803727:	41 54                	push   %r12
+  803729:	53                   	push   %rbx
+  80372a:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80372e:	48 85 ff             	test   %rdi,%rdi
+  803731:	0f 84 a1 00 00 00    	je     8037d8 <devfile_read+0xbb>
+  803737:	49 89 ff             	mov    %rdi,%r15
+  80373a:	49 89 f5             	mov    %rsi,%r13
+  80373d:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803740:	48 85 f6             	test   %rsi,%rsi
+  803743:	0f 84 c4 00 00 00    	je     80380d <devfile_read+0xf0>
+    size_t total_read = 0;
+  803749:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803750:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803751:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803758:	00 00 00 
+  80375b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80375f:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803762:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803766:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80376b:	be 00 00 00 00       	mov    $0x0,%esi
+  803770:	bf 03 00 00 00       	mov    $0x3,%edi
+  803775:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  80377c:	00 00 00 
+  80377f:	ff d0                	call   *%rax
+        if (res < 0) {
+  803781:	85 c0                	test   %eax,%eax
+  803783:	0f 88 b9 00 00 00    	js     803842 <devfile_read+0x125>
+        assert(res <= n);
+  803789:	48 63 d8             	movslq %eax,%rbx
+  80378c:	49 39 dc             	cmp    %rbx,%r12
+  80378f:	0f 82 b1 00 00 00    	jb     803846 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803795:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80379a:	0f 87 db 00 00 00    	ja     80387b <devfile_read+0x15e>
+        if (!res) {
+  8037a0:	85 c0                	test   %eax,%eax
+  8037a2:	74 21                	je     8037c5 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8037a4:	48 89 da             	mov    %rbx,%rdx
+  8037a7:	4c 89 f6             	mov    %r14,%rsi
+  8037aa:	4c 89 ef             	mov    %r13,%rdi
+  8037ad:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  8037b4:	00 00 00 
+  8037b7:	ff d0                	call   *%rax
+        total_read += res;
+  8037b9:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8037bd:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8037c0:	49 29 dc             	sub    %rbx,%r12
+  8037c3:	75 96                	jne    80375b <devfile_read+0x3e>
+    return total_read;
+  8037c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037c9:	48 83 c4 18          	add    $0x18,%rsp
+  8037cd:	5b                   	pop    %rbx
+  8037ce:	41 5c                	pop    %r12
+  8037d0:	41 5d                	pop    %r13
+  8037d2:	41 5e                	pop    %r14
+  8037d4:	41 5f                	pop    %r15
+  8037d6:	5d                   	pop    %rbp
+  8037d7:	c3                   	ret
+    assert(fd);
+  8037d8:	48 b9 96 62 80 00 00 	movabs $0x806296,%rcx
+  8037df:	00 00 00 
+  8037e2:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8037e9:	00 00 00 
+  8037ec:	be 91 00 00 00       	mov    $0x91,%esi
+  8037f1:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  8037f8:	00 00 00 
+  8037fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803800:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  803807:	00 00 00 
+  80380a:	41 ff d0             	call   *%r8
+    assert(buf);
+  80380d:	48 b9 99 62 80 00 00 	movabs $0x806299,%rcx
+  803814:	00 00 00 
+  803817:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80381e:	00 00 00 
+  803821:	be 92 00 00 00       	mov    $0x92,%esi
+  803826:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80382d:	00 00 00 
+  803830:	b8 00 00 00 00       	mov    $0x0,%eax
+  803835:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  80383c:	00 00 00 
+  80383f:	41 ff d0             	call   *%r8
+            return res;
+  803842:	48 98                	cltq
+  803844:	eb 83                	jmp    8037c9 <devfile_read+0xac>
+        assert(res <= n);
+  803846:	48 b9 9d 62 80 00 00 	movabs $0x80629d,%rcx
+  80384d:	00 00 00 
+  803850:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803857:	00 00 00 
+  80385a:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80385f:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  803866:	00 00 00 
+  803869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386e:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  803875:	00 00 00 
+  803878:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80387b:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  803882:	00 00 00 
+  803885:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80388c:	00 00 00 
+  80388f:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803894:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80389b:	00 00 00 
+  80389e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a3:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  8038aa:	00 00 00 
+  8038ad:	41 ff d0             	call   *%r8
+
+00000000008038b0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8038b0:	55                   	push   %rbp
+  8038b1:	48 89 e5             	mov    %rsp,%rbp
+  8038b4:	41 57                	push   %r15
+  8038b6:	41 56                	push   %r14
+  8038b8:	41 55                	push   %r13
+  8038ba:	41 54                	push   %r12
+  8038bc:	53                   	push   %rbx
+  8038bd:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8038c1:	48 85 ff             	test   %rdi,%rdi
+  8038c4:	0f 84 83 00 00 00    	je     80394d <devfile_write+0x9d>
+  8038ca:	49 89 ff             	mov    %rdi,%r15
+  8038cd:	49 89 f4             	mov    %rsi,%r12
+  8038d0:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038d3:	48 85 f6             	test   %rsi,%rsi
+  8038d6:	0f 84 a6 00 00 00    	je     803982 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038dc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038e2:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038e9:	00 00 00 
+  8038ec:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038f0:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038f3:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038f7:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038fc:	48 39 d3             	cmp    %rdx,%rbx
+  8038ff:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803903:	4c 89 e6             	mov    %r12,%rsi
+  803906:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  80390d:	00 00 00 
+  803910:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80391c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803921:	be 00 00 00 00       	mov    $0x0,%esi
+  803926:	bf 04 00 00 00       	mov    $0x4,%edi
+  80392b:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  803932:	00 00 00 
+  803935:	ff d0                	call   *%rax
+        if (res < 0) {
+  803937:	85 c0                	test   %eax,%eax
+  803939:	78 7c                	js     8039b7 <devfile_write+0x107>
+        total_written += res;
+  80393b:	48 98                	cltq
+  80393d:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803940:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803943:	48 29 c3             	sub    %rax,%rbx
+  803946:	75 a4                	jne    8038ec <devfile_write+0x3c>
+    return total_written;
+  803948:	4c 89 e8             	mov    %r13,%rax
+  80394b:	eb 6c                	jmp    8039b9 <devfile_write+0x109>
+    assert(fd);
+  80394d:	48 b9 96 62 80 00 00 	movabs $0x806296,%rcx
+  803954:	00 00 00 
+  803957:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80395e:	00 00 00 
+  803961:	be bd 00 00 00       	mov    $0xbd,%esi
+  803966:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  80396d:	00 00 00 
+  803970:	b8 00 00 00 00       	mov    $0x0,%eax
+  803975:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  80397c:	00 00 00 
+  80397f:	41 ff d0             	call   *%r8
+    assert(buf);
+  803982:	48 b9 99 62 80 00 00 	movabs $0x806299,%rcx
+  803989:	00 00 00 
+  80398c:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  803993:	00 00 00 
+  803996:	be be 00 00 00       	mov    $0xbe,%esi
+  80399b:	48 bf 8b 62 80 00 00 	movabs $0x80628b,%rdi
+  8039a2:	00 00 00 
+  8039a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039aa:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  8039b1:	00 00 00 
+  8039b4:	41 ff d0             	call   *%r8
+            return res;
+  8039b7:	48 98                	cltq
+}
+  8039b9:	48 83 c4 08          	add    $0x8,%rsp
+  8039bd:	5b                   	pop    %rbx
+  8039be:	41 5c                	pop    %r12
+  8039c0:	41 5d                	pop    %r13
+  8039c2:	41 5e                	pop    %r14
+  8039c4:	41 5f                	pop    %r15
+  8039c6:	5d                   	pop    %rbp
+  8039c7:	c3                   	ret
+
+00000000008039c8 <open>:
+open(const char *path, int mode) {
+  8039c8:	55                   	push   %rbp
+  8039c9:	48 89 e5             	mov    %rsp,%rbp
+  8039cc:	41 55                	push   %r13
+  8039ce:	41 54                	push   %r12
+  8039d0:	53                   	push   %rbx
+  8039d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8039d5:	49 89 fc             	mov    %rdi,%r12
+  8039d8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039db:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8039e2:	00 00 00 
+  8039e5:	ff d0                	call   *%rax
+  8039e7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039ed:	0f 87 8f 00 00 00    	ja     803a82 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039f3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039f7:	48 b8 ed 2d 80 00 00 	movabs $0x802ded,%rax
+  8039fe:	00 00 00 
+  803a01:	ff d0                	call   *%rax
+  803a03:	89 c3                	mov    %eax,%ebx
+  803a05:	85 c0                	test   %eax,%eax
+  803a07:	78 55                	js     803a5e <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803a09:	4c 89 e6             	mov    %r12,%rsi
+  803a0c:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803a13:	00 00 00 
+  803a16:	48 89 df             	mov    %rbx,%rdi
+  803a19:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  803a20:	00 00 00 
+  803a23:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a25:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a31:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a35:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a3a:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+  803a46:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a48:	85 c0                	test   %eax,%eax
+  803a4a:	78 1f                	js     803a6b <open+0xa3>
+    return fd2num(fd);
+  803a4c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a50:	48 b8 bf 2d 80 00 00 	movabs $0x802dbf,%rax
+  803a57:	00 00 00 
+  803a5a:	ff d0                	call   *%rax
+  803a5c:	89 c3                	mov    %eax,%ebx
+}
+  803a5e:	89 d8                	mov    %ebx,%eax
+  803a60:	48 83 c4 18          	add    $0x18,%rsp
+  803a64:	5b                   	pop    %rbx
+  803a65:	41 5c                	pop    %r12
+  803a67:	41 5d                	pop    %r13
+  803a69:	5d                   	pop    %rbp
+  803a6a:	c3                   	ret
+        fd_close(fd, 0);
+  803a6b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a70:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a74:	48 b8 08 2f 80 00 00 	movabs $0x802f08,%rax
+  803a7b:	00 00 00 
+  803a7e:	ff d0                	call   *%rax
+        return res;
+  803a80:	eb dc                	jmp    803a5e <open+0x96>
+        return -E_BAD_PATH;
+  803a82:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a87:	eb d5                	jmp    803a5e <open+0x96>
+
+0000000000803a89 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a89:	55                   	push   %rbp
+  803a8a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a92:	be 00 00 00 00       	mov    $0x0,%esi
+  803a97:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a9c:	48 b8 36 35 80 00 00 	movabs $0x803536,%rax
+  803aa3:	00 00 00 
+  803aa6:	ff d0                	call   *%rax
+}
+  803aa8:	5d                   	pop    %rbp
+  803aa9:	c3                   	ret
+
+0000000000803aaa <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803aaa:	55                   	push   %rbp
+  803aab:	48 89 e5             	mov    %rsp,%rbp
+  803aae:	41 56                	push   %r14
+  803ab0:	41 55                	push   %r13
+  803ab2:	41 54                	push   %r12
+  803ab4:	53                   	push   %rbx
+  803ab5:	48 83 ec 10          	sub    $0x10,%rsp
+  803ab9:	41 89 f6             	mov    %esi,%r14d
+  803abc:	49 89 d4             	mov    %rdx,%r12
+  803abf:	48 89 cb             	mov    %rcx,%rbx
+  803ac2:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ac5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ac9:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  803ad0:	00 00 00 
+  803ad3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ad5:	85 c0                	test   %eax,%eax
+  803ad7:	78 46                	js     803b1f <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ad9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803add:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ae4:	00 00 00 
+  803ae7:	8b 00                	mov    (%rax),%eax
+  803ae9:	39 02                	cmp    %eax,(%rdx)
+  803aeb:	75 3f                	jne    803b2c <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803aed:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803af4:	00 00 00 
+  803af7:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803afa:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803afc:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803b00:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803b04:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803b08:	48 89 da             	mov    %rbx,%rdx
+  803b0b:	4c 89 e6             	mov    %r12,%rsi
+  803b0e:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b13:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  803b1a:	00 00 00 
+  803b1d:	ff d0                	call   *%rax
+}
+  803b1f:	48 83 c4 10          	add    $0x10,%rsp
+  803b23:	5b                   	pop    %rbx
+  803b24:	41 5c                	pop    %r12
+  803b26:	41 5d                	pop    %r13
+  803b28:	41 5e                	pop    %r14
+  803b2a:	5d                   	pop    %rbp
+  803b2b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b2c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b31:	eb ec                	jmp    803b1f <file_map+0x75>
+
+0000000000803b33 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b33:	55                   	push   %rbp
+  803b34:	48 89 e5             	mov    %rsp,%rbp
+  803b37:	41 54                	push   %r12
+  803b39:	53                   	push   %rbx
+  803b3a:	48 83 ec 20          	sub    $0x20,%rsp
+  803b3e:	41 89 f4             	mov    %esi,%r12d
+  803b41:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b44:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b48:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  803b4f:	00 00 00 
+  803b52:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b54:	85 c0                	test   %eax,%eax
+  803b56:	78 3c                	js     803b94 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b5c:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b63:	00 00 00 
+  803b66:	8b 0a                	mov    (%rdx),%ecx
+  803b68:	39 08                	cmp    %ecx,(%rax)
+  803b6a:	75 31                	jne    803b9d <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b6c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b6f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b72:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b76:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b7a:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b7f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b83:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b88:	48 b8 36 35 80 00 00 	movabs $0x803536,%rax
+  803b8f:	00 00 00 
+  803b92:	ff d0                	call   *%rax
+}
+  803b94:	48 83 c4 20          	add    $0x20,%rsp
+  803b98:	5b                   	pop    %rbx
+  803b99:	41 5c                	pop    %r12
+  803b9b:	5d                   	pop    %rbp
+  803b9c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b9d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ba2:	eb f0                	jmp    803b94 <file_msync+0x61>
+
+0000000000803ba4 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803ba4:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803ba8:	7f 01                	jg     803bab <writebuf+0x7>
+  803baa:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803bab:	55                   	push   %rbp
+  803bac:	48 89 e5             	mov    %rsp,%rbp
+  803baf:	53                   	push   %rbx
+  803bb0:	48 83 ec 08          	sub    $0x8,%rsp
+  803bb4:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803bb7:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803bbb:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803bbf:	8b 3f                	mov    (%rdi),%edi
+  803bc1:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  803bc8:	00 00 00 
+  803bcb:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803bcd:	48 85 c0             	test   %rax,%rax
+  803bd0:	7e 04                	jle    803bd6 <writebuf+0x32>
+  803bd2:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bd6:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bda:	48 39 c2             	cmp    %rax,%rdx
+  803bdd:	74 0f                	je     803bee <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bdf:	48 85 c0             	test   %rax,%rax
+  803be2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803be7:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803beb:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bf2:	c9                   	leave
+  803bf3:	c3                   	ret
+
+0000000000803bf4 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bf4:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bf7:	8d 50 01             	lea    0x1(%rax),%edx
+  803bfa:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bfd:	48 98                	cltq
+  803bff:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803c04:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803c0a:	74 01                	je     803c0d <putch+0x19>
+  803c0c:	c3                   	ret
+putch(int ch, void *arg) {
+  803c0d:	55                   	push   %rbp
+  803c0e:	48 89 e5             	mov    %rsp,%rbp
+  803c11:	53                   	push   %rbx
+  803c12:	48 83 ec 08          	sub    $0x8,%rsp
+  803c16:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803c19:	48 89 f7             	mov    %rsi,%rdi
+  803c1c:	48 b8 a4 3b 80 00 00 	movabs $0x803ba4,%rax
+  803c23:	00 00 00 
+  803c26:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c28:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c33:	c9                   	leave
+  803c34:	c3                   	ret
+
+0000000000803c35 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c35:	55                   	push   %rbp
+  803c36:	48 89 e5             	mov    %rsp,%rbp
+  803c39:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c40:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c43:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c49:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c50:	00 00 00 
+    state.result = 0;
+  803c53:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c5a:	00 00 00 00 
+    state.error = 1;
+  803c5e:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c65:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c68:	48 89 f2             	mov    %rsi,%rdx
+  803c6b:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c72:	48 bf f4 3b 80 00 00 	movabs $0x803bf4,%rdi
+  803c79:	00 00 00 
+  803c7c:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  803c83:	00 00 00 
+  803c86:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c88:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c8f:	7f 14                	jg     803ca5 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c91:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c98:	48 85 c0             	test   %rax,%rax
+  803c9b:	75 06                	jne    803ca3 <vfprintf+0x6e>
+  803c9d:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803ca3:	c9                   	leave
+  803ca4:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803ca5:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803cac:	48 b8 a4 3b 80 00 00 	movabs $0x803ba4,%rax
+  803cb3:	00 00 00 
+  803cb6:	ff d0                	call   *%rax
+  803cb8:	eb d7                	jmp    803c91 <vfprintf+0x5c>
+
+0000000000803cba <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803cba:	55                   	push   %rbp
+  803cbb:	48 89 e5             	mov    %rsp,%rbp
+  803cbe:	48 83 ec 50          	sub    $0x50,%rsp
+  803cc2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cc6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cca:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cce:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cd2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cd9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cdd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ce1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ce5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ce9:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ced:	48 b8 35 3c 80 00 00 	movabs $0x803c35,%rax
+  803cf4:	00 00 00 
+  803cf7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cf9:	c9                   	leave
+  803cfa:	c3                   	ret
+
+0000000000803cfb <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cfb:	55                   	push   %rbp
+  803cfc:	48 89 e5             	mov    %rsp,%rbp
+  803cff:	48 83 ec 50          	sub    $0x50,%rsp
+  803d03:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803d07:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d0b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d0f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d13:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d17:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d1e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d26:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d2a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d2e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d32:	48 89 fe             	mov    %rdi,%rsi
+  803d35:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d3a:	48 b8 35 3c 80 00 00 	movabs $0x803c35,%rax
+  803d41:	00 00 00 
+  803d44:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d46:	c9                   	leave
+  803d47:	c3                   	ret
+
+0000000000803d48 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d48:	55                   	push   %rbp
+  803d49:	48 89 e5             	mov    %rsp,%rbp
+  803d4c:	41 54                	push   %r12
+  803d4e:	53                   	push   %rbx
+  803d4f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d52:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  803d59:	00 00 00 
+  803d5c:	ff d0                	call   *%rax
+  803d5e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d61:	48 be d0 62 80 00 00 	movabs $0x8062d0,%rsi
+  803d68:	00 00 00 
+  803d6b:	48 89 df             	mov    %rbx,%rdi
+  803d6e:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  803d75:	00 00 00 
+  803d78:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d7a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d7f:	41 2b 04 24          	sub    (%r12),%eax
+  803d83:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d89:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d90:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d93:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d9a:	00 00 00 
+  803d9d:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da9:	5b                   	pop    %rbx
+  803daa:	41 5c                	pop    %r12
+  803dac:	5d                   	pop    %rbp
+  803dad:	c3                   	ret
+
+0000000000803dae <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803dae:	55                   	push   %rbp
+  803daf:	48 89 e5             	mov    %rsp,%rbp
+  803db2:	41 54                	push   %r12
+  803db4:	53                   	push   %rbx
+  803db5:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803db8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dbd:	48 89 fe             	mov    %rdi,%rsi
+  803dc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc5:	49 bc 39 28 80 00 00 	movabs $0x802839,%r12
+  803dcc:	00 00 00 
+  803dcf:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803dd2:	48 89 df             	mov    %rbx,%rdi
+  803dd5:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  803ddc:	00 00 00 
+  803ddf:	ff d0                	call   *%rax
+  803de1:	48 89 c6             	mov    %rax,%rsi
+  803de4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803de9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dee:	41 ff d4             	call   *%r12
+}
+  803df1:	5b                   	pop    %rbx
+  803df2:	41 5c                	pop    %r12
+  803df4:	5d                   	pop    %rbp
+  803df5:	c3                   	ret
+
+0000000000803df6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803df6:	55                   	push   %rbp
+  803df7:	48 89 e5             	mov    %rsp,%rbp
+  803dfa:	41 57                	push   %r15
+  803dfc:	41 56                	push   %r14
+  803dfe:	41 55                	push   %r13
+  803e00:	41 54                	push   %r12
+  803e02:	53                   	push   %rbx
+  803e03:	48 83 ec 18          	sub    $0x18,%rsp
+  803e07:	49 89 fc             	mov    %rdi,%r12
+  803e0a:	49 89 f5             	mov    %rsi,%r13
+  803e0d:	49 89 d7             	mov    %rdx,%r15
+  803e10:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e14:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  803e1b:	00 00 00 
+  803e1e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e20:	4d 85 ff             	test   %r15,%r15
+  803e23:	0f 84 af 00 00 00    	je     803ed8 <devpipe_write+0xe2>
+  803e29:	48 89 c3             	mov    %rax,%rbx
+  803e2c:	4c 89 f8             	mov    %r15,%rax
+  803e2f:	4d 89 ef             	mov    %r13,%r15
+  803e32:	4c 01 e8             	add    %r13,%rax
+  803e35:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e39:	49 bd 2f 27 80 00 00 	movabs $0x80272f,%r13
+  803e40:	00 00 00 
+            sys_yield();
+  803e43:	49 be c0 26 80 00 00 	movabs $0x8026c0,%r14
+  803e4a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e4d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e50:	48 63 ce             	movslq %esi,%rcx
+  803e53:	48 63 03             	movslq (%rbx),%rax
+  803e56:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e5c:	48 39 c1             	cmp    %rax,%rcx
+  803e5f:	72 2e                	jb     803e8f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e61:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e66:	48 89 da             	mov    %rbx,%rdx
+  803e69:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e6e:	4c 89 e7             	mov    %r12,%rdi
+  803e71:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e74:	85 c0                	test   %eax,%eax
+  803e76:	74 66                	je     803ede <devpipe_write+0xe8>
+            sys_yield();
+  803e78:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e7b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e7e:	48 63 ce             	movslq %esi,%rcx
+  803e81:	48 63 03             	movslq (%rbx),%rax
+  803e84:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e8a:	48 39 c1             	cmp    %rax,%rcx
+  803e8d:	73 d2                	jae    803e61 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e8f:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e93:	48 89 ca             	mov    %rcx,%rdx
+  803e96:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e9a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803ea1:	08 10 20 
+  803ea4:	48 f7 e2             	mul    %rdx
+  803ea7:	48 c1 ea 06          	shr    $0x6,%rdx
+  803eab:	48 89 d0             	mov    %rdx,%rax
+  803eae:	48 c1 e0 09          	shl    $0x9,%rax
+  803eb2:	48 29 d0             	sub    %rdx,%rax
+  803eb5:	48 c1 e0 03          	shl    $0x3,%rax
+  803eb9:	48 29 c1             	sub    %rax,%rcx
+  803ebc:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ec1:	83 c6 01             	add    $0x1,%esi
+  803ec4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ec7:	49 83 c7 01          	add    $0x1,%r15
+  803ecb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ecf:	49 39 c7             	cmp    %rax,%r15
+  803ed2:	0f 85 75 ff ff ff    	jne    803e4d <devpipe_write+0x57>
+    return n;
+  803ed8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803edc:	eb 05                	jmp    803ee3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ede:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee3:	48 83 c4 18          	add    $0x18,%rsp
+  803ee7:	5b                   	pop    %rbx
+  803ee8:	41 5c                	pop    %r12
+  803eea:	41 5d                	pop    %r13
+  803eec:	41 5e                	pop    %r14
+  803eee:	41 5f                	pop    %r15
+  803ef0:	5d                   	pop    %rbp
+  803ef1:	c3                   	ret
+
+0000000000803ef2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ef2:	55                   	push   %rbp
+  803ef3:	48 89 e5             	mov    %rsp,%rbp
+  803ef6:	41 57                	push   %r15
+  803ef8:	41 56                	push   %r14
+  803efa:	41 55                	push   %r13
+  803efc:	41 54                	push   %r12
+  803efe:	53                   	push   %rbx
+  803eff:	48 83 ec 18          	sub    $0x18,%rsp
+  803f03:	49 89 fc             	mov    %rdi,%r12
+  803f06:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f0a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f0e:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  803f15:	00 00 00 
+  803f18:	ff d0                	call   *%rax
+  803f1a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803f1d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f23:	49 bd 2f 27 80 00 00 	movabs $0x80272f,%r13
+  803f2a:	00 00 00 
+            sys_yield();
+  803f2d:	49 be c0 26 80 00 00 	movabs $0x8026c0,%r14
+  803f34:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f37:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f3c:	74 7d                	je     803fbb <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f3e:	8b 03                	mov    (%rbx),%eax
+  803f40:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f43:	75 26                	jne    803f6b <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f45:	4d 85 ff             	test   %r15,%r15
+  803f48:	75 77                	jne    803fc1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f4a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f4f:	48 89 da             	mov    %rbx,%rdx
+  803f52:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f57:	4c 89 e7             	mov    %r12,%rdi
+  803f5a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f5d:	85 c0                	test   %eax,%eax
+  803f5f:	74 72                	je     803fd3 <devpipe_read+0xe1>
+            sys_yield();
+  803f61:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f64:	8b 03                	mov    (%rbx),%eax
+  803f66:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f69:	74 df                	je     803f4a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f6b:	48 63 c8             	movslq %eax,%rcx
+  803f6e:	48 89 ca             	mov    %rcx,%rdx
+  803f71:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f75:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f7c:	08 10 20 
+  803f7f:	48 89 d0             	mov    %rdx,%rax
+  803f82:	48 f7 e6             	mul    %rsi
+  803f85:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f89:	48 89 d0             	mov    %rdx,%rax
+  803f8c:	48 c1 e0 09          	shl    $0x9,%rax
+  803f90:	48 29 d0             	sub    %rdx,%rax
+  803f93:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f9a:	00 
+  803f9b:	48 89 c8             	mov    %rcx,%rax
+  803f9e:	48 29 d0             	sub    %rdx,%rax
+  803fa1:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803fa6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803faa:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803fae:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803fb1:	49 83 c7 01          	add    $0x1,%r15
+  803fb5:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803fb9:	75 83                	jne    803f3e <devpipe_read+0x4c>
+    return n;
+  803fbb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fbf:	eb 03                	jmp    803fc4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803fc1:	4c 89 f8             	mov    %r15,%rax
+}
+  803fc4:	48 83 c4 18          	add    $0x18,%rsp
+  803fc8:	5b                   	pop    %rbx
+  803fc9:	41 5c                	pop    %r12
+  803fcb:	41 5d                	pop    %r13
+  803fcd:	41 5e                	pop    %r14
+  803fcf:	41 5f                	pop    %r15
+  803fd1:	5d                   	pop    %rbp
+  803fd2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd8:	eb ea                	jmp    803fc4 <devpipe_read+0xd2>
+
+0000000000803fda <pipe>:
+pipe(int pfd[2]) {
+  803fda:	55                   	push   %rbp
+  803fdb:	48 89 e5             	mov    %rsp,%rbp
+  803fde:	41 55                	push   %r13
+  803fe0:	41 54                	push   %r12
+  803fe2:	53                   	push   %rbx
+  803fe3:	48 83 ec 18          	sub    $0x18,%rsp
+  803fe7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fea:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fee:	48 b8 ed 2d 80 00 00 	movabs $0x802ded,%rax
+  803ff5:	00 00 00 
+  803ff8:	ff d0                	call   *%rax
+  803ffa:	89 c3                	mov    %eax,%ebx
+  803ffc:	85 c0                	test   %eax,%eax
+  803ffe:	0f 88 a0 01 00 00    	js     8041a4 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804004:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804009:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80400e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804012:	bf 00 00 00 00       	mov    $0x0,%edi
+  804017:	48 b8 61 27 80 00 00 	movabs $0x802761,%rax
+  80401e:	00 00 00 
+  804021:	ff d0                	call   *%rax
+  804023:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804025:	85 c0                	test   %eax,%eax
+  804027:	0f 88 77 01 00 00    	js     8041a4 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80402d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804031:	48 b8 ed 2d 80 00 00 	movabs $0x802ded,%rax
+  804038:	00 00 00 
+  80403b:	ff d0                	call   *%rax
+  80403d:	89 c3                	mov    %eax,%ebx
+  80403f:	85 c0                	test   %eax,%eax
+  804041:	0f 88 43 01 00 00    	js     80418a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804047:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80404c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804051:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405a:	48 b8 61 27 80 00 00 	movabs $0x802761,%rax
+  804061:	00 00 00 
+  804064:	ff d0                	call   *%rax
+  804066:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804068:	85 c0                	test   %eax,%eax
+  80406a:	0f 88 1a 01 00 00    	js     80418a <pipe+0x1b0>
+    va = fd2data(fd0);
+  804070:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804074:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  80407b:	00 00 00 
+  80407e:	ff d0                	call   *%rax
+  804080:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804083:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804088:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80408d:	48 89 c6             	mov    %rax,%rsi
+  804090:	bf 00 00 00 00       	mov    $0x0,%edi
+  804095:	48 b8 61 27 80 00 00 	movabs $0x802761,%rax
+  80409c:	00 00 00 
+  80409f:	ff d0                	call   *%rax
+  8040a1:	89 c3                	mov    %eax,%ebx
+  8040a3:	85 c0                	test   %eax,%eax
+  8040a5:	0f 88 c5 00 00 00    	js     804170 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8040ab:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8040af:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  8040b6:	00 00 00 
+  8040b9:	ff d0                	call   *%rax
+  8040bb:	48 89 c1             	mov    %rax,%rcx
+  8040be:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040c4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040cf:	4c 89 ee             	mov    %r13,%rsi
+  8040d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d7:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8040de:	00 00 00 
+  8040e1:	ff d0                	call   *%rax
+  8040e3:	89 c3                	mov    %eax,%ebx
+  8040e5:	85 c0                	test   %eax,%eax
+  8040e7:	78 6e                	js     804157 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040e9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ee:	4c 89 ef             	mov    %r13,%rdi
+  8040f1:	48 b8 f7 26 80 00 00 	movabs $0x8026f7,%rax
+  8040f8:	00 00 00 
+  8040fb:	ff d0                	call   *%rax
+  8040fd:	83 f8 02             	cmp    $0x2,%eax
+  804100:	0f 85 ab 00 00 00    	jne    8041b1 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804106:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80410d:	00 00 
+  80410f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804113:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804115:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804119:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804120:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804124:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804126:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80412a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804131:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804135:	48 bb bf 2d 80 00 00 	movabs $0x802dbf,%rbx
+  80413c:	00 00 00 
+  80413f:	ff d3                	call   *%rbx
+  804141:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804145:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804149:	ff d3                	call   *%rbx
+  80414b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804150:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804155:	eb 4d                	jmp    8041a4 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804157:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80415c:	4c 89 ee             	mov    %r13,%rsi
+  80415f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804164:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  80416b:	00 00 00 
+  80416e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804170:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804175:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804179:	bf 00 00 00 00       	mov    $0x0,%edi
+  80417e:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  804185:	00 00 00 
+  804188:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80418a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80418f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804193:	bf 00 00 00 00       	mov    $0x0,%edi
+  804198:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  80419f:	00 00 00 
+  8041a2:	ff d0                	call   *%rax
+}
+  8041a4:	89 d8                	mov    %ebx,%eax
+  8041a6:	48 83 c4 18          	add    $0x18,%rsp
+  8041aa:	5b                   	pop    %rbx
+  8041ab:	41 5c                	pop    %r12
+  8041ad:	41 5d                	pop    %r13
+  8041af:	5d                   	pop    %rbp
+  8041b0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8041b1:	48 b9 e8 62 80 00 00 	movabs $0x8062e8,%rcx
+  8041b8:	00 00 00 
+  8041bb:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8041c2:	00 00 00 
+  8041c5:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041ca:	48 bf d7 62 80 00 00 	movabs $0x8062d7,%rdi
+  8041d1:	00 00 00 
+  8041d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d9:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  8041e0:	00 00 00 
+  8041e3:	41 ff d0             	call   *%r8
+
+00000000008041e6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041e6:	55                   	push   %rbp
+  8041e7:	48 89 e5             	mov    %rsp,%rbp
+  8041ea:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041ee:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041f2:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  8041f9:	00 00 00 
+  8041fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041fe:	85 c0                	test   %eax,%eax
+  804200:	78 35                	js     804237 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804202:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804206:	48 b8 d1 2d 80 00 00 	movabs $0x802dd1,%rax
+  80420d:	00 00 00 
+  804210:	ff d0                	call   *%rax
+  804212:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804215:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80421a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80421f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804223:	48 b8 2f 27 80 00 00 	movabs $0x80272f,%rax
+  80422a:	00 00 00 
+  80422d:	ff d0                	call   *%rax
+  80422f:	85 c0                	test   %eax,%eax
+  804231:	0f 94 c0             	sete   %al
+  804234:	0f b6 c0             	movzbl %al,%eax
+}
+  804237:	c9                   	leave
+  804238:	c3                   	ret
+
+0000000000804239 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804239:	48 89 f8             	mov    %rdi,%rax
+  80423c:	48 c1 e8 27          	shr    $0x27,%rax
+  804240:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804247:	01 00 00 
+  80424a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80424e:	f6 c2 01             	test   $0x1,%dl
+  804251:	74 6d                	je     8042c0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804253:	48 89 f8             	mov    %rdi,%rax
+  804256:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80425a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804261:	01 00 00 
+  804264:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804268:	f6 c2 01             	test   $0x1,%dl
+  80426b:	74 62                	je     8042cf <get_uvpt_entry+0x96>
+  80426d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804274:	01 00 00 
+  804277:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80427b:	f6 c2 80             	test   $0x80,%dl
+  80427e:	75 4f                	jne    8042cf <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804280:	48 89 f8             	mov    %rdi,%rax
+  804283:	48 c1 e8 15          	shr    $0x15,%rax
+  804287:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80428e:	01 00 00 
+  804291:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804295:	f6 c2 01             	test   $0x1,%dl
+  804298:	74 44                	je     8042de <get_uvpt_entry+0xa5>
+  80429a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042a1:	01 00 00 
+  8042a4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042a8:	f6 c2 80             	test   $0x80,%dl
+  8042ab:	75 31                	jne    8042de <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8042ad:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8042b1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8042b8:	01 00 00 
+  8042bb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8042bf:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042c0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042c7:	01 00 00 
+  8042ca:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ce:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042cf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042d6:	01 00 00 
+  8042d9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042dd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042de:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042e5:	01 00 00 
+  8042e8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ec:	c3                   	ret
+
+00000000008042ed <get_prot>:
+
+int
+get_prot(void *va) {
+  8042ed:	55                   	push   %rbp
+  8042ee:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042f1:	48 b8 39 42 80 00 00 	movabs $0x804239,%rax
+  8042f8:	00 00 00 
+  8042fb:	ff d0                	call   *%rax
+  8042fd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804300:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804305:	89 c1                	mov    %eax,%ecx
+  804307:	83 c9 04             	or     $0x4,%ecx
+  80430a:	f6 c2 01             	test   $0x1,%dl
+  80430d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804310:	89 c1                	mov    %eax,%ecx
+  804312:	83 c9 02             	or     $0x2,%ecx
+  804315:	f6 c2 02             	test   $0x2,%dl
+  804318:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80431b:	89 c1                	mov    %eax,%ecx
+  80431d:	83 c9 01             	or     $0x1,%ecx
+  804320:	48 85 d2             	test   %rdx,%rdx
+  804323:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804326:	89 c1                	mov    %eax,%ecx
+  804328:	83 c9 40             	or     $0x40,%ecx
+  80432b:	f6 c6 04             	test   $0x4,%dh
+  80432e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804331:	5d                   	pop    %rbp
+  804332:	c3                   	ret
+
+0000000000804333 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804333:	55                   	push   %rbp
+  804334:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804337:	48 b8 39 42 80 00 00 	movabs $0x804239,%rax
+  80433e:	00 00 00 
+  804341:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804343:	48 c1 e8 06          	shr    $0x6,%rax
+  804347:	83 e0 01             	and    $0x1,%eax
+}
+  80434a:	5d                   	pop    %rbp
+  80434b:	c3                   	ret
+
+000000000080434c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80434c:	55                   	push   %rbp
+  80434d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804350:	48 b8 39 42 80 00 00 	movabs $0x804239,%rax
+  804357:	00 00 00 
+  80435a:	ff d0                	call   *%rax
+  80435c:	83 e0 01             	and    $0x1,%eax
+}
+  80435f:	5d                   	pop    %rbp
+  804360:	c3                   	ret
+
+0000000000804361 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804361:	55                   	push   %rbp
+  804362:	48 89 e5             	mov    %rsp,%rbp
+  804365:	41 57                	push   %r15
+  804367:	41 56                	push   %r14
+  804369:	41 55                	push   %r13
+  80436b:	41 54                	push   %r12
+  80436d:	53                   	push   %rbx
+  80436e:	48 83 ec 28          	sub    $0x28,%rsp
+  804372:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804376:	48 85 ff             	test   %rdi,%rdi
+  804379:	74 1e                	je     804399 <foreach_shared_region+0x38>
+  80437b:	49 89 ff             	mov    %rdi,%r15
+  80437e:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804384:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80438a:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804391:	01 00 00 
+  804394:	e9 72 02 00 00       	jmp    80460b <foreach_shared_region+0x2aa>
+    assert(fun);
+  804399:	48 b9 0c 63 80 00 00 	movabs $0x80630c,%rcx
+  8043a0:	00 00 00 
+  8043a3:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  8043aa:	00 00 00 
+  8043ad:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8043b2:	48 bf 10 63 80 00 00 	movabs $0x806310,%rdi
+  8043b9:	00 00 00 
+  8043bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c1:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  8043c8:	00 00 00 
+  8043cb:	41 ff d0             	call   *%r8
+  8043ce:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043d5:	eb 6c                	jmp    804443 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043d7:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043de:	ff ff ff 
+  8043e1:	4c 21 e2             	and    %r12,%rdx
+  8043e4:	48 89 d8             	mov    %rbx,%rax
+  8043e7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043ec:	48 83 c0 01          	add    $0x1,%rax
+  8043f0:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043f4:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043fb:	00 00 00 
+  8043fe:	48 21 c8             	and    %rcx,%rax
+  804401:	48 09 d0             	or     %rdx,%rax
+  804404:	49 89 c4             	mov    %rax,%r12
+  804407:	eb 30                	jmp    804439 <foreach_shared_region+0xd8>
+  804409:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804410:	ff ff ff 
+  804413:	4c 21 e2             	and    %r12,%rdx
+  804416:	48 89 d8             	mov    %rbx,%rax
+  804419:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80441e:	48 83 c0 01          	add    $0x1,%rax
+  804422:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804426:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80442d:	00 00 00 
+  804430:	48 21 c8             	and    %rcx,%rax
+  804433:	48 09 d0             	or     %rdx,%rax
+  804436:	49 89 c4             	mov    %rax,%r12
+  804439:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80443d:	0f 84 99 01 00 00    	je     8045dc <foreach_shared_region+0x27b>
+  804443:	4c 89 e3             	mov    %r12,%rbx
+  804446:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80444a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804451:	01 00 00 
+  804454:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804458:	a8 01                	test   $0x1,%al
+  80445a:	0f 84 77 ff ff ff    	je     8043d7 <foreach_shared_region+0x76>
+  804460:	a8 80                	test   $0x80,%al
+  804462:	74 19                	je     80447d <foreach_shared_region+0x11c>
+  804464:	f6 c4 04             	test   $0x4,%ah
+  804467:	74 a0                	je     804409 <foreach_shared_region+0xa8>
+  804469:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804470:	40 
+  804471:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804475:	4c 89 e7             	mov    %r12,%rdi
+  804478:	41 ff d7             	call   *%r15
+  80447b:	eb 8c                	jmp    804409 <foreach_shared_region+0xa8>
+  80447d:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804484:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804488:	eb 46                	jmp    8044d0 <foreach_shared_region+0x16f>
+  80448a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804491:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804497:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80449b:	48 c1 e0 15          	shl    $0x15,%rax
+  80449f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044a4:	49 09 c4             	or     %rax,%r12
+  8044a7:	eb 1d                	jmp    8044c6 <foreach_shared_region+0x165>
+  8044a9:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8044b0:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044b6:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8044ba:	48 c1 e0 15          	shl    $0x15,%rax
+  8044be:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044c3:	49 09 c4             	or     %rax,%r12
+  8044c6:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044ca:	0f 84 d3 00 00 00    	je     8045a3 <foreach_shared_region+0x242>
+  8044d0:	4c 89 e3             	mov    %r12,%rbx
+  8044d3:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044d7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044de:	01 00 00 
+  8044e1:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044e5:	a8 01                	test   $0x1,%al
+  8044e7:	74 a1                	je     80448a <foreach_shared_region+0x129>
+  8044e9:	a8 80                	test   $0x80,%al
+  8044eb:	74 19                	je     804506 <foreach_shared_region+0x1a5>
+  8044ed:	f6 c4 04             	test   $0x4,%ah
+  8044f0:	74 b7                	je     8044a9 <foreach_shared_region+0x148>
+  8044f2:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044f9:	00 
+  8044fa:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044fe:	4c 89 e7             	mov    %r12,%rdi
+  804501:	41 ff d7             	call   *%r15
+  804504:	eb a3                	jmp    8044a9 <foreach_shared_region+0x148>
+  804506:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80450c:	eb 3b                	jmp    804549 <foreach_shared_region+0x1e8>
+  80450e:	f6 c4 04             	test   $0x4,%ah
+  804511:	74 12                	je     804525 <foreach_shared_region+0x1c4>
+  804513:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80451a:	00 
+  80451b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80451f:	4c 89 e7             	mov    %r12,%rdi
+  804522:	41 ff d7             	call   *%r15
+  804525:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80452c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804532:	48 83 c3 01          	add    $0x1,%rbx
+  804536:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80453a:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804540:	49 09 dc             	or     %rbx,%r12
+  804543:	41 83 ed 01          	sub    $0x1,%r13d
+  804547:	74 2f                	je     804578 <foreach_shared_region+0x217>
+  804549:	4c 89 e3             	mov    %r12,%rbx
+  80454c:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804550:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804554:	a8 01                	test   $0x1,%al
+  804556:	75 b6                	jne    80450e <foreach_shared_region+0x1ad>
+  804558:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80455f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804565:	48 83 c3 01          	add    $0x1,%rbx
+  804569:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80456d:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804573:	49 09 dc             	or     %rbx,%r12
+  804576:	eb cb                	jmp    804543 <foreach_shared_region+0x1e2>
+  804578:	4c 89 e0             	mov    %r12,%rax
+  80457b:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804581:	49 c1 ec 15          	shr    $0x15,%r12
+  804585:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80458c:	49 83 c4 01          	add    $0x1,%r12
+  804590:	49 c1 e4 15          	shl    $0x15,%r12
+  804594:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80459b:	49 09 c4             	or     %rax,%r12
+  80459e:	e9 23 ff ff ff       	jmp    8044c6 <foreach_shared_region+0x165>
+  8045a3:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8045a7:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8045ae:	ff ff ff 
+  8045b1:	4c 21 e0             	and    %r12,%rax
+  8045b4:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8045b8:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8045bf:	49 83 c4 01          	add    $0x1,%r12
+  8045c3:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045c7:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045ce:	00 00 00 
+  8045d1:	49 21 d4             	and    %rdx,%r12
+  8045d4:	49 09 c4             	or     %rax,%r12
+  8045d7:	e9 5d fe ff ff       	jmp    804439 <foreach_shared_region+0xd8>
+  8045dc:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045e3:	00 ff ff 
+  8045e6:	4c 21 e0             	and    %r12,%rax
+  8045e9:	49 c1 ec 27          	shr    $0x27,%r12
+  8045ed:	49 83 c4 01          	add    $0x1,%r12
+  8045f1:	49 c1 e4 27          	shl    $0x27,%r12
+  8045f5:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045fc:	ff 00 00 
+  8045ff:	49 21 d4             	and    %rdx,%r12
+  804602:	49 09 c4             	or     %rax,%r12
+  804605:	41 83 ed 01          	sub    $0x1,%r13d
+  804609:	74 48                	je     804653 <foreach_shared_region+0x2f2>
+  80460b:	4c 89 e0             	mov    %r12,%rax
+  80460e:	48 c1 e8 27          	shr    $0x27,%rax
+  804612:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804619:	01 00 00 
+  80461c:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804620:	f6 c2 01             	test   $0x1,%dl
+  804623:	0f 85 a5 fd ff ff    	jne    8043ce <foreach_shared_region+0x6d>
+  804629:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804630:	00 ff ff 
+  804633:	4c 21 e2             	and    %r12,%rdx
+  804636:	48 83 c0 01          	add    $0x1,%rax
+  80463a:	48 c1 e0 27          	shl    $0x27,%rax
+  80463e:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804645:	ff 00 00 
+  804648:	48 21 c8             	and    %rcx,%rax
+  80464b:	48 09 d0             	or     %rdx,%rax
+  80464e:	49 89 c4             	mov    %rax,%r12
+  804651:	eb b2                	jmp    804605 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804653:	4d 85 e4             	test   %r12,%r12
+  804656:	75 14                	jne    80466c <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465d:	48 83 c4 28          	add    $0x28,%rsp
+  804661:	5b                   	pop    %rbx
+  804662:	41 5c                	pop    %r12
+  804664:	41 5d                	pop    %r13
+  804666:	41 5e                	pop    %r14
+  804668:	41 5f                	pop    %r15
+  80466a:	5d                   	pop    %rbp
+  80466b:	c3                   	ret
+    assert(addr == 0);
+  80466c:	48 b9 1b 63 80 00 00 	movabs $0x80631b,%rcx
+  804673:	00 00 00 
+  804676:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80467d:	00 00 00 
+  804680:	be 67 00 00 00       	mov    $0x67,%esi
+  804685:	48 bf 10 63 80 00 00 	movabs $0x806310,%rdi
+  80468c:	00 00 00 
+  80468f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804694:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  80469b:	00 00 00 
+  80469e:	41 ff d0             	call   *%r8
+
+00000000008046a1 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8046a1:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8046a8:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8046ab:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8046b1:	eb 33                	jmp    8046e6 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046b3:	48 83 c0 20          	add    $0x20,%rax
+  8046b7:	4c 39 c0             	cmp    %r8,%rax
+  8046ba:	74 25                	je     8046e1 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8046bc:	48 8b 10             	mov    (%rax),%rdx
+  8046bf:	48 85 d2             	test   %rdx,%rdx
+  8046c2:	74 ef                	je     8046b3 <mmap_place+0x12>
+  8046c4:	48 89 d1             	mov    %rdx,%rcx
+  8046c7:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046cb:	48 39 cf             	cmp    %rcx,%rdi
+  8046ce:	73 e3                	jae    8046b3 <mmap_place+0x12>
+  8046d0:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046d4:	4c 39 ca             	cmp    %r9,%rdx
+  8046d7:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046db:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046df:	eb d2                	jmp    8046b3 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046e1:	45 84 d2             	test   %r10b,%r10b
+  8046e4:	74 12                	je     8046f8 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046e6:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046ed:	00 00 00 
+        moved = 0;
+  8046f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046f6:	eb c4                	jmp    8046bc <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046f8:	48 01 fe             	add    %rdi,%rsi
+  8046fb:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804702:	00 00 00 
+  804705:	48 39 f0             	cmp    %rsi,%rax
+  804708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470d:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804711:	c3                   	ret
+
+0000000000804712 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804712:	55                   	push   %rbp
+  804713:	48 89 e5             	mov    %rsp,%rbp
+  804716:	41 57                	push   %r15
+  804718:	41 56                	push   %r14
+  80471a:	41 55                	push   %r13
+  80471c:	41 54                	push   %r12
+  80471e:	53                   	push   %rbx
+  80471f:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804723:	48 8b 1f             	mov    (%rdi),%rbx
+  804726:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80472d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804734:	00 00 00 
+  804737:	ba 00 00 00 00       	mov    $0x0,%edx
+  80473c:	eb 12                	jmp    804750 <mmap_pgfault+0x3e>
+  80473e:	48 83 c2 01          	add    $0x1,%rdx
+  804742:	48 83 c0 20          	add    $0x20,%rax
+  804746:	48 83 fa 20          	cmp    $0x20,%rdx
+  80474a:	0f 84 04 01 00 00    	je     804854 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804750:	48 8b 08             	mov    (%rax),%rcx
+  804753:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804757:	48 39 de             	cmp    %rbx,%rsi
+  80475a:	73 e2                	jae    80473e <mmap_pgfault+0x2c>
+  80475c:	48 03 48 08          	add    0x8(%rax),%rcx
+  804760:	48 39 cb             	cmp    %rcx,%rbx
+  804763:	73 d9                	jae    80473e <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804765:	48 c1 e2 05          	shl    $0x5,%rdx
+  804769:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804770:	00 00 00 
+  804773:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804777:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80477b:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80477f:	f6 c2 01             	test   $0x1,%dl
+  804782:	0f 84 e0 00 00 00    	je     804868 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80478d:	f6 c2 02             	test   $0x2,%dl
+  804790:	0f 84 c3 00 00 00    	je     804859 <mmap_pgfault+0x147>
+  804796:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80479d:	ff ff ff 
+  8047a0:	48 23 56 10          	and    0x10(%rsi),%rdx
+  8047a4:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  8047ab:	00 00 00 
+  8047ae:	48 39 ca             	cmp    %rcx,%rdx
+  8047b1:	0f 85 a2 00 00 00    	jne    804859 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8047b7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8047bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c1:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047c8:	00 00 00 
+  8047cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047d0:	48 b8 61 27 80 00 00 	movabs $0x802761,%rax
+  8047d7:	00 00 00 
+  8047da:	ff d0                	call   *%rax
+  8047dc:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e3:	85 d2                	test   %edx,%edx
+  8047e5:	78 72                	js     804859 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ec:	48 89 de             	mov    %rbx,%rsi
+  8047ef:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047f6:	00 00 00 
+  8047f9:	4c 89 e7             	mov    %r12,%rdi
+  8047fc:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  804803:	00 00 00 
+  804806:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804808:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80480e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804814:	48 89 d9             	mov    %rbx,%rcx
+  804817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80481c:	4c 89 e6             	mov    %r12,%rsi
+  80481f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804824:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  80482b:	00 00 00 
+  80482e:	ff d0                	call   *%rax
+  804830:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804832:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804837:	4c 89 e6             	mov    %r12,%rsi
+  80483a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80483f:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  804846:	00 00 00 
+  804849:	ff d0                	call   *%rax
+    return res >= 0;
+  80484b:	89 d8                	mov    %ebx,%eax
+  80484d:	f7 d0                	not    %eax
+  80484f:	c1 e8 1f             	shr    $0x1f,%eax
+  804852:	eb 05                	jmp    804859 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804854:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804859:	48 83 c4 18          	add    $0x18,%rsp
+  80485d:	5b                   	pop    %rbx
+  80485e:	41 5c                	pop    %r12
+  804860:	41 5d                	pop    %r13
+  804862:	41 5e                	pop    %r14
+  804864:	41 5f                	pop    %r15
+  804866:	5d                   	pop    %rbp
+  804867:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804868:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80486c:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804870:	4c 03 30             	add    (%rax),%r14
+  804873:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80487a:	49 39 c6             	cmp    %rax,%r14
+  80487d:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804881:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804888:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80488e:	49 bf 4c 43 80 00 00 	movabs $0x80434c,%r15
+  804895:	00 00 00 
+  804898:	4d 39 f4             	cmp    %r14,%r12
+  80489b:	73 1d                	jae    8048ba <mmap_pgfault+0x1a8>
+  80489d:	4c 89 e7             	mov    %r12,%rdi
+  8048a0:	41 ff d7             	call   *%r15
+  8048a3:	84 c0                	test   %al,%al
+  8048a5:	75 13                	jne    8048ba <mmap_pgfault+0x1a8>
+  8048a7:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8048ae:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8048b5:	4d 39 f4             	cmp    %r14,%r12
+  8048b8:	72 e3                	jb     80489d <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048ba:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8048c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048c4:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048c8:	74 2a                	je     8048f4 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048ce:	89 de                	mov    %ebx,%esi
+  8048d0:	2b 30                	sub    (%rax),%esi
+  8048d2:	03 70 1c             	add    0x1c(%rax),%esi
+  8048d5:	8b 78 18             	mov    0x18(%rax),%edi
+  8048d8:	4c 89 e9             	mov    %r13,%rcx
+  8048db:	48 89 da             	mov    %rbx,%rdx
+  8048de:	48 b8 aa 3a 80 00 00 	movabs $0x803aaa,%rax
+  8048e5:	00 00 00 
+  8048e8:	ff d0                	call   *%rax
+    return res > 0;
+  8048ea:	85 c0                	test   %eax,%eax
+  8048ec:	0f 9f c0             	setg   %al
+  8048ef:	e9 65 ff ff ff       	jmp    804859 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048f4:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048f8:	eb d0                	jmp    8048ca <mmap_pgfault+0x1b8>
+
+00000000008048fa <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048fa:	55                   	push   %rbp
+  8048fb:	48 89 e5             	mov    %rsp,%rbp
+  8048fe:	41 57                	push   %r15
+  804900:	41 56                	push   %r14
+  804902:	41 55                	push   %r13
+  804904:	41 54                	push   %r12
+  804906:	53                   	push   %rbx
+  804907:	48 83 ec 28          	sub    $0x28,%rsp
+  80490b:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80490f:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804912:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804919:	ff ff ff 
+  80491c:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804920:	b8 00 00 00 00       	mov    $0x0,%eax
+  804925:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80492c:	00 00 00 
+  80492f:	48 39 ca             	cmp    %rcx,%rdx
+  804932:	0f 85 e5 00 00 00    	jne    804a1d <mmap_writeback+0x123>
+  804938:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80493b:	4c 39 ee             	cmp    %r13,%rsi
+  80493e:	0f 83 e8 00 00 00    	jae    804a2c <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804944:	49 be 4c 43 80 00 00 	movabs $0x80434c,%r14
+  80494b:	00 00 00 
+  80494e:	49 bf 33 43 80 00 00 	movabs $0x804333,%r15
+  804955:	00 00 00 
+  804958:	eb 10                	jmp    80496a <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80495a:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804961:	4d 39 ec             	cmp    %r13,%r12
+  804964:	0f 83 ae 00 00 00    	jae    804a18 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80496a:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80496e:	4c 89 e7             	mov    %r12,%rdi
+  804971:	41 ff d6             	call   *%r14
+  804974:	84 c0                	test   %al,%al
+  804976:	74 e2                	je     80495a <mmap_writeback+0x60>
+  804978:	4c 89 e7             	mov    %r12,%rdi
+  80497b:	41 ff d7             	call   *%r15
+  80497e:	84 c0                	test   %al,%al
+  804980:	74 d8                	je     80495a <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804982:	4c 89 e3             	mov    %r12,%rbx
+  804985:	4d 39 ec             	cmp    %r13,%r12
+  804988:	73 20                	jae    8049aa <mmap_writeback+0xb0>
+  80498a:	48 89 df             	mov    %rbx,%rdi
+  80498d:	41 ff d6             	call   *%r14
+  804990:	84 c0                	test   %al,%al
+  804992:	74 16                	je     8049aa <mmap_writeback+0xb0>
+  804994:	48 89 df             	mov    %rbx,%rdi
+  804997:	41 ff d7             	call   *%r15
+  80499a:	84 c0                	test   %al,%al
+  80499c:	74 0c                	je     8049aa <mmap_writeback+0xb0>
+  80499e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8049a5:	4c 39 eb             	cmp    %r13,%rbx
+  8049a8:	72 e0                	jb     80498a <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  8049aa:	48 89 d9             	mov    %rbx,%rcx
+  8049ad:	4c 29 e1             	sub    %r12,%rcx
+  8049b0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8049b4:	44 89 e6             	mov    %r12d,%esi
+  8049b7:	2b 30                	sub    (%rax),%esi
+  8049b9:	49 89 c4             	mov    %rax,%r12
+  8049bc:	03 70 1c             	add    0x1c(%rax),%esi
+  8049bf:	8b 78 18             	mov    0x18(%rax),%edi
+  8049c2:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049c6:	48 89 ca             	mov    %rcx,%rdx
+  8049c9:	48 b8 33 3b 80 00 00 	movabs $0x803b33,%rax
+  8049d0:	00 00 00 
+  8049d3:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049d5:	85 c0                	test   %eax,%eax
+  8049d7:	78 44                	js     804a1d <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049d9:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049de:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049e1:	41 89 c1             	mov    %eax,%r9d
+  8049e4:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049eb:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049ef:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f8:	48 89 ce             	mov    %rcx,%rsi
+  8049fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a00:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  804a07:	00 00 00 
+  804a0a:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804a0c:	85 c0                	test   %eax,%eax
+  804a0e:	78 0d                	js     804a1d <mmap_writeback+0x123>
+  804a10:	49 89 dc             	mov    %rbx,%r12
+  804a13:	e9 49 ff ff ff       	jmp    804961 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804a18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a1d:	48 83 c4 28          	add    $0x28,%rsp
+  804a21:	5b                   	pop    %rbx
+  804a22:	41 5c                	pop    %r12
+  804a24:	41 5d                	pop    %r13
+  804a26:	41 5e                	pop    %r14
+  804a28:	41 5f                	pop    %r15
+  804a2a:	5d                   	pop    %rbp
+  804a2b:	c3                   	ret
+    return 0;
+  804a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a31:	eb ea                	jmp    804a1d <mmap_writeback+0x123>
+
+0000000000804a33 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a33:	55                   	push   %rbp
+  804a34:	48 89 e5             	mov    %rsp,%rbp
+  804a37:	41 57                	push   %r15
+  804a39:	41 56                	push   %r14
+  804a3b:	41 55                	push   %r13
+  804a3d:	41 54                	push   %r12
+  804a3f:	53                   	push   %rbx
+  804a40:	48 83 ec 38          	sub    $0x38,%rsp
+  804a44:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a48:	48 85 f6             	test   %rsi,%rsi
+  804a4b:	0f 84 0c 02 00 00    	je     804c5d <mmap+0x22a>
+  804a51:	49 89 ff             	mov    %rdi,%r15
+  804a54:	49 89 f4             	mov    %rsi,%r12
+  804a57:	41 89 d5             	mov    %edx,%r13d
+  804a5a:	41 89 ce             	mov    %ecx,%r14d
+  804a5d:	44 89 cb             	mov    %r9d,%ebx
+  804a60:	45 85 c9             	test   %r9d,%r9d
+  804a63:	0f 88 f4 01 00 00    	js     804c5d <mmap+0x22a>
+  804a69:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a70:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a77:	0f 85 e7 01 00 00    	jne    804c64 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a7d:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a80:	83 fa 04             	cmp    $0x4,%edx
+  804a83:	0f 85 db 01 00 00    	jne    804c64 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a89:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a8c:	83 fa 01             	cmp    $0x1,%edx
+  804a8f:	0f 87 cf 01 00 00    	ja     804c64 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a95:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a99:	44 89 c7             	mov    %r8d,%edi
+  804a9c:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  804aa3:	00 00 00 
+  804aa6:	ff d0                	call   *%rax
+  804aa8:	89 c2                	mov    %eax,%edx
+  804aaa:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ab1:	85 d2                	test   %edx,%edx
+  804ab3:	0f 88 ab 01 00 00    	js     804c64 <mmap+0x231>
+  804ab9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804abd:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804ac4:	00 00 00 
+  804ac7:	8b 09                	mov    (%rcx),%ecx
+  804ac9:	39 0a                	cmp    %ecx,(%rdx)
+  804acb:	0f 85 93 01 00 00    	jne    804c64 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804ad1:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ad4:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ad7:	83 fa 01             	cmp    $0x1,%edx
+  804ada:	0f 84 84 01 00 00    	je     804c64 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ae0:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ae4:	74 42                	je     804b28 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ae6:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804aed:	4c 89 e6             	mov    %r12,%rsi
+  804af0:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804af7:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804afb:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804aff:	4d 85 ff             	test   %r15,%r15
+  804b02:	74 67                	je     804b6b <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b04:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804b0b:	75 0f                	jne    804b1c <mmap+0xe9>
+  804b0d:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804b14:	00 00 00 
+  804b17:	49 39 c7             	cmp    %rax,%r15
+  804b1a:	77 1b                	ja     804b37 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b1c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b23:	e9 3c 01 00 00       	jmp    804c64 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b28:	41 f6 c5 02          	test   $0x2,%r13b
+  804b2c:	74 b8                	je     804ae6 <mmap+0xb3>
+  804b2e:	85 d2                	test   %edx,%edx
+  804b30:	75 b4                	jne    804ae6 <mmap+0xb3>
+  804b32:	e9 2d 01 00 00       	jmp    804c64 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b37:	4c 89 ff             	mov    %r15,%rdi
+  804b3a:	48 b8 a1 46 80 00 00 	movabs $0x8046a1,%rax
+  804b41:	00 00 00 
+  804b44:	ff d0                	call   *%rax
+  804b46:	48 89 c2             	mov    %rax,%rdx
+  804b49:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b50:	49 39 d7             	cmp    %rdx,%r15
+  804b53:	0f 85 0b 01 00 00    	jne    804c64 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b59:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b60:	00 00 00 
+  804b63:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b69:	eb 44                	jmp    804baf <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b6b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b6f:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b76:	00 00 00 
+  804b79:	48 b8 a1 46 80 00 00 	movabs $0x8046a1,%rax
+  804b80:	00 00 00 
+  804b83:	ff d0                	call   *%rax
+  804b85:	48 89 c7             	mov    %rax,%rdi
+  804b88:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b8c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b93:	48 85 ff             	test   %rdi,%rdi
+  804b96:	75 c1                	jne    804b59 <mmap+0x126>
+  804b98:	e9 c7 00 00 00       	jmp    804c64 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b9d:	49 83 c4 01          	add    $0x1,%r12
+  804ba1:	48 83 c0 20          	add    $0x20,%rax
+  804ba5:	49 83 fc 20          	cmp    $0x20,%r12
+  804ba9:	0f 84 a5 00 00 00    	je     804c54 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804baf:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804bb3:	75 e8                	jne    804b9d <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804bb5:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804bb9:	48 b8 ed 2d 80 00 00 	movabs $0x802ded,%rax
+  804bc0:	00 00 00 
+  804bc3:	ff d0                	call   *%rax
+  804bc5:	89 c2                	mov    %eax,%edx
+  804bc7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bce:	85 d2                	test   %edx,%edx
+  804bd0:	0f 88 8e 00 00 00    	js     804c64 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bd6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bda:	48 b8 bf 2d 80 00 00 	movabs $0x802dbf,%rax
+  804be1:	00 00 00 
+  804be4:	ff d0                	call   *%rax
+  804be6:	89 c6                	mov    %eax,%esi
+  804be8:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804beb:	48 b8 0d 30 80 00 00 	movabs $0x80300d,%rax
+  804bf2:	00 00 00 
+  804bf5:	ff d0                	call   *%rax
+  804bf7:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bfa:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c01:	45 85 ff             	test   %r15d,%r15d
+  804c04:	78 5e                	js     804c64 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804c06:	49 c1 e4 05          	shl    $0x5,%r12
+  804c0a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c11:	00 00 00 
+  804c14:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804c17:	48 bf 12 47 80 00 00 	movabs $0x804712,%rdi
+  804c1e:	00 00 00 
+  804c21:	48 b8 e0 51 80 00 00 	movabs $0x8051e0,%rax
+  804c28:	00 00 00 
+  804c2b:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c2d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c31:	49 89 04 24          	mov    %rax,(%r12)
+  804c35:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c39:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c3e:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c43:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c48:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c4d:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c52:	eb 10                	jmp    804c64 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c54:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c5b:	eb 07                	jmp    804c64 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c5d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c64:	48 83 c4 38          	add    $0x38,%rsp
+  804c68:	5b                   	pop    %rbx
+  804c69:	41 5c                	pop    %r12
+  804c6b:	41 5d                	pop    %r13
+  804c6d:	41 5e                	pop    %r14
+  804c6f:	41 5f                	pop    %r15
+  804c71:	5d                   	pop    %rbp
+  804c72:	c3                   	ret
+
+0000000000804c73 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c73:	55                   	push   %rbp
+  804c74:	48 89 e5             	mov    %rsp,%rbp
+  804c77:	41 57                	push   %r15
+  804c79:	41 56                	push   %r14
+  804c7b:	41 55                	push   %r13
+  804c7d:	41 54                	push   %r12
+  804c7f:	53                   	push   %rbx
+  804c80:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c84:	49 89 fe             	mov    %rdi,%r14
+  804c87:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c8e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c95:	00 
+  804c96:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c9d:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804ca4:	00 00 00 
+  804ca7:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cae:	49 bf fa 48 80 00 00 	movabs $0x8048fa,%r15
+  804cb5:	00 00 00 
+  804cb8:	eb 09                	jmp    804cc3 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cba:	48 83 c3 20          	add    $0x20,%rbx
+  804cbe:	4c 39 eb             	cmp    %r13,%rbx
+  804cc1:	74 33                	je     804cf6 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804cc3:	48 89 df             	mov    %rbx,%rdi
+  804cc6:	48 8b 33             	mov    (%rbx),%rsi
+  804cc9:	4c 39 e6             	cmp    %r12,%rsi
+  804ccc:	73 ec                	jae    804cba <msync+0x47>
+  804cce:	48 85 f6             	test   %rsi,%rsi
+  804cd1:	74 e7                	je     804cba <msync+0x47>
+  804cd3:	48 89 f2             	mov    %rsi,%rdx
+  804cd6:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cda:	49 39 d6             	cmp    %rdx,%r14
+  804cdd:	73 db                	jae    804cba <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cdf:	4c 39 e2             	cmp    %r12,%rdx
+  804ce2:	49 0f 47 d4          	cmova  %r12,%rdx
+  804ce6:	4c 39 f6             	cmp    %r14,%rsi
+  804ce9:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ced:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cf0:	85 c0                	test   %eax,%eax
+  804cf2:	79 c6                	jns    804cba <msync+0x47>
+  804cf4:	eb 05                	jmp    804cfb <msync+0x88>
+    }
+
+    return 0;
+  804cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cfb:	48 83 c4 08          	add    $0x8,%rsp
+  804cff:	5b                   	pop    %rbx
+  804d00:	41 5c                	pop    %r12
+  804d02:	41 5d                	pop    %r13
+  804d04:	41 5e                	pop    %r14
+  804d06:	41 5f                	pop    %r15
+  804d08:	5d                   	pop    %rbp
+  804d09:	c3                   	ret
+
+0000000000804d0a <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804d0a:	55                   	push   %rbp
+  804d0b:	48 89 e5             	mov    %rsp,%rbp
+  804d0e:	41 57                	push   %r15
+  804d10:	41 56                	push   %r14
+  804d12:	41 55                	push   %r13
+  804d14:	41 54                	push   %r12
+  804d16:	53                   	push   %rbx
+  804d17:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804d1b:	49 89 ff             	mov    %rdi,%r15
+  804d1e:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d25:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d2c:	00 
+  804d2d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d34:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d3b:	00 00 00 
+  804d3e:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d45:	48 89 d8             	mov    %rbx,%rax
+  804d48:	eb 09                	jmp    804d53 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d4a:	48 83 c0 20          	add    $0x20,%rax
+  804d4e:	4c 39 f0             	cmp    %r14,%rax
+  804d51:	74 40                	je     804d93 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d53:	48 8b 10             	mov    (%rax),%rdx
+  804d56:	4c 39 e2             	cmp    %r12,%rdx
+  804d59:	73 ef                	jae    804d4a <munmap+0x40>
+  804d5b:	48 85 d2             	test   %rdx,%rdx
+  804d5e:	74 ea                	je     804d4a <munmap+0x40>
+  804d60:	48 89 d7             	mov    %rdx,%rdi
+  804d63:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d67:	49 39 ff             	cmp    %rdi,%r15
+  804d6a:	73 de                	jae    804d4a <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d6c:	49 39 fc             	cmp    %rdi,%r12
+  804d6f:	72 05                	jb     804d76 <munmap+0x6c>
+  804d71:	4c 39 fa             	cmp    %r15,%rdx
+  804d74:	73 d4                	jae    804d4a <munmap+0x40>
+  804d76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d7b:	48 83 c4 08          	add    $0x8,%rsp
+  804d7f:	5b                   	pop    %rbx
+  804d80:	41 5c                	pop    %r12
+  804d82:	41 5d                	pop    %r13
+  804d84:	41 5e                	pop    %r14
+  804d86:	41 5f                	pop    %r15
+  804d88:	5d                   	pop    %rbp
+  804d89:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d8a:	48 83 c3 20          	add    $0x20,%rbx
+  804d8e:	4c 39 f3             	cmp    %r14,%rbx
+  804d91:	74 5c                	je     804def <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d93:	48 8b 33             	mov    (%rbx),%rsi
+  804d96:	4c 39 e6             	cmp    %r12,%rsi
+  804d99:	73 ef                	jae    804d8a <munmap+0x80>
+  804d9b:	48 85 f6             	test   %rsi,%rsi
+  804d9e:	74 ea                	je     804d8a <munmap+0x80>
+  804da0:	48 89 f2             	mov    %rsi,%rdx
+  804da3:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804da7:	49 39 d7             	cmp    %rdx,%r15
+  804daa:	73 de                	jae    804d8a <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804dac:	48 89 df             	mov    %rbx,%rdi
+  804daf:	48 b8 fa 48 80 00 00 	movabs $0x8048fa,%rax
+  804db6:	00 00 00 
+  804db9:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804dbb:	85 c0                	test   %eax,%eax
+  804dbd:	78 bc                	js     804d7b <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804dbf:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804dc3:	48 8b 33             	mov    (%rbx),%rsi
+  804dc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dcb:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  804dd2:	00 00 00 
+  804dd5:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804dd7:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804dda:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  804de1:	00 00 00 
+  804de4:	ff d0                	call   *%rax
+        reg->start = 0;
+  804de6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804ded:	eb 9b                	jmp    804d8a <munmap+0x80>
+    return 0;
+  804def:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df4:	eb 85                	jmp    804d7b <munmap+0x71>
+
+0000000000804df6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfb:	c3                   	ret
+
+0000000000804dfc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dfc:	55                   	push   %rbp
+  804dfd:	48 89 e5             	mov    %rsp,%rbp
+  804e00:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804e03:	48 be 25 63 80 00 00 	movabs $0x806325,%rsi
+  804e0a:	00 00 00 
+  804e0d:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  804e14:	00 00 00 
+  804e17:	ff d0                	call   *%rax
+    return 0;
+}
+  804e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e1e:	5d                   	pop    %rbp
+  804e1f:	c3                   	ret
+
+0000000000804e20 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e20:	55                   	push   %rbp
+  804e21:	48 89 e5             	mov    %rsp,%rbp
+  804e24:	41 57                	push   %r15
+  804e26:	41 56                	push   %r14
+  804e28:	41 55                	push   %r13
+  804e2a:	41 54                	push   %r12
+  804e2c:	53                   	push   %rbx
+  804e2d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e34:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e3b:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e42:	00 00 00 00 
+  804e46:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e4d:	00 00 00 00 
+  804e51:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e58:	00 00 00 00 
+  804e5c:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e63:	00 00 00 00 
+  804e67:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e6e:	00 00 00 00 
+  804e72:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e79:	00 00 00 00 
+  804e7d:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e84:	00 
+  804e85:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e8c:	00 
+  804e8d:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e94:	00 
+  804e95:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e9c:	00 
+  804e9d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804ea4:	00 
+  804ea5:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804eac:	00 
+  804ead:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804eb4:	00 
+  804eb5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804ebc:	00 
+  804ebd:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804ec4:	00 
+  804ec5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804ecc:	00 
+    for (res = 0; res < n; res += inc) {
+  804ecd:	48 85 d2             	test   %rdx,%rdx
+  804ed0:	74 7a                	je     804f4c <devcons_write+0x12c>
+  804ed2:	49 89 d6             	mov    %rdx,%r14
+  804ed5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804edb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ee0:	49 bf 4c 23 80 00 00 	movabs $0x80234c,%r15
+  804ee7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804eea:	4c 89 f3             	mov    %r14,%rbx
+  804eed:	48 29 f3             	sub    %rsi,%rbx
+  804ef0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ef5:	48 39 c3             	cmp    %rax,%rbx
+  804ef8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804efc:	4c 63 eb             	movslq %ebx,%r13
+  804eff:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804f06:	48 01 c6             	add    %rax,%rsi
+  804f09:	4c 89 ea             	mov    %r13,%rdx
+  804f0c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f13:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804f16:	4c 89 ee             	mov    %r13,%rsi
+  804f19:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f20:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  804f27:	00 00 00 
+  804f2a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f2c:	41 01 dc             	add    %ebx,%r12d
+  804f2f:	49 63 f4             	movslq %r12d,%rsi
+  804f32:	4c 39 f6             	cmp    %r14,%rsi
+  804f35:	72 b3                	jb     804eea <devcons_write+0xca>
+    return res;
+  804f37:	49 63 c4             	movslq %r12d,%rax
+}
+  804f3a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f41:	5b                   	pop    %rbx
+  804f42:	41 5c                	pop    %r12
+  804f44:	41 5d                	pop    %r13
+  804f46:	41 5e                	pop    %r14
+  804f48:	41 5f                	pop    %r15
+  804f4a:	5d                   	pop    %rbp
+  804f4b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f4c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f52:	eb e3                	jmp    804f37 <devcons_write+0x117>
+
+0000000000804f54 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f54:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f57:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f5c:	48 85 c0             	test   %rax,%rax
+  804f5f:	74 55                	je     804fb6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f61:	55                   	push   %rbp
+  804f62:	48 89 e5             	mov    %rsp,%rbp
+  804f65:	41 55                	push   %r13
+  804f67:	41 54                	push   %r12
+  804f69:	53                   	push   %rbx
+  804f6a:	48 83 ec 08          	sub    $0x8,%rsp
+  804f6e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f71:	48 bb ac 25 80 00 00 	movabs $0x8025ac,%rbx
+  804f78:	00 00 00 
+  804f7b:	49 bc c0 26 80 00 00 	movabs $0x8026c0,%r12
+  804f82:	00 00 00 
+  804f85:	eb 03                	jmp    804f8a <devcons_read+0x36>
+  804f87:	41 ff d4             	call   *%r12
+  804f8a:	ff d3                	call   *%rbx
+  804f8c:	85 c0                	test   %eax,%eax
+  804f8e:	74 f7                	je     804f87 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f90:	48 63 d0             	movslq %eax,%rdx
+  804f93:	78 13                	js     804fa8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f9a:	83 f8 04             	cmp    $0x4,%eax
+  804f9d:	74 09                	je     804fa8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f9f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804fa3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804fa8:	48 89 d0             	mov    %rdx,%rax
+  804fab:	48 83 c4 08          	add    $0x8,%rsp
+  804faf:	5b                   	pop    %rbx
+  804fb0:	41 5c                	pop    %r12
+  804fb2:	41 5d                	pop    %r13
+  804fb4:	5d                   	pop    %rbp
+  804fb5:	c3                   	ret
+  804fb6:	48 89 d0             	mov    %rdx,%rax
+  804fb9:	c3                   	ret
+
+0000000000804fba <cputchar>:
+cputchar(int ch) {
+  804fba:	55                   	push   %rbp
+  804fbb:	48 89 e5             	mov    %rsp,%rbp
+  804fbe:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804fc2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fc6:	be 01 00 00 00       	mov    $0x1,%esi
+  804fcb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804fcf:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  804fd6:	00 00 00 
+  804fd9:	ff d0                	call   *%rax
+}
+  804fdb:	c9                   	leave
+  804fdc:	c3                   	ret
+
+0000000000804fdd <getchar>:
+getchar(void) {
+  804fdd:	55                   	push   %rbp
+  804fde:	48 89 e5             	mov    %rsp,%rbp
+  804fe1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fe5:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fea:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fee:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ff3:	48 b8 30 31 80 00 00 	movabs $0x803130,%rax
+  804ffa:	00 00 00 
+  804ffd:	ff d0                	call   *%rax
+  804fff:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805001:	85 c0                	test   %eax,%eax
+  805003:	78 06                	js     80500b <getchar+0x2e>
+  805005:	74 08                	je     80500f <getchar+0x32>
+  805007:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80500b:	89 d0                	mov    %edx,%eax
+  80500d:	c9                   	leave
+  80500e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80500f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805014:	eb f5                	jmp    80500b <getchar+0x2e>
+
+0000000000805016 <iscons>:
+iscons(int fdnum) {
+  805016:	55                   	push   %rbp
+  805017:	48 89 e5             	mov    %rsp,%rbp
+  80501a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80501e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805022:	48 b8 4d 2e 80 00 00 	movabs $0x802e4d,%rax
+  805029:	00 00 00 
+  80502c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80502e:	85 c0                	test   %eax,%eax
+  805030:	78 18                	js     80504a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805032:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805036:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80503d:	00 00 00 
+  805040:	8b 00                	mov    (%rax),%eax
+  805042:	39 02                	cmp    %eax,(%rdx)
+  805044:	0f 94 c0             	sete   %al
+  805047:	0f b6 c0             	movzbl %al,%eax
+}
+  80504a:	c9                   	leave
+  80504b:	c3                   	ret
+
+000000000080504c <opencons>:
+opencons(void) {
+  80504c:	55                   	push   %rbp
+  80504d:	48 89 e5             	mov    %rsp,%rbp
+  805050:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805054:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805058:	48 b8 ed 2d 80 00 00 	movabs $0x802ded,%rax
+  80505f:	00 00 00 
+  805062:	ff d0                	call   *%rax
+  805064:	85 c0                	test   %eax,%eax
+  805066:	78 49                	js     8050b1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805068:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80506d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805072:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805076:	bf 00 00 00 00       	mov    $0x0,%edi
+  80507b:	48 b8 61 27 80 00 00 	movabs $0x802761,%rax
+  805082:	00 00 00 
+  805085:	ff d0                	call   *%rax
+  805087:	85 c0                	test   %eax,%eax
+  805089:	78 26                	js     8050b1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80508b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80508f:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805096:	00 00 
+  805098:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80509a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80509e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8050a5:	48 b8 bf 2d 80 00 00 	movabs $0x802dbf,%rax
+  8050ac:	00 00 00 
+  8050af:	ff d0                	call   *%rax
+}
+  8050b1:	c9                   	leave
+  8050b2:	c3                   	ret
+
+00000000008050b3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8050b3:	55                   	push   %rbp
+  8050b4:	48 89 e5             	mov    %rsp,%rbp
+  8050b7:	41 56                	push   %r14
+  8050b9:	41 55                	push   %r13
+  8050bb:	41 54                	push   %r12
+  8050bd:	53                   	push   %rbx
+  8050be:	48 83 ec 50          	sub    $0x50,%rsp
+  8050c2:	49 89 fc             	mov    %rdi,%r12
+  8050c5:	41 89 f5             	mov    %esi,%r13d
+  8050c8:	48 89 d3             	mov    %rdx,%rbx
+  8050cb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050cf:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050d3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050d7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050de:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050e2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050e6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050ea:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050ee:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050f5:	00 00 00 
+  8050f8:	4c 8b 30             	mov    (%rax),%r14
+  8050fb:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  805102:	00 00 00 
+  805105:	ff d0                	call   *%rax
+  805107:	89 c6                	mov    %eax,%esi
+  805109:	45 89 e8             	mov    %r13d,%r8d
+  80510c:	4c 89 e1             	mov    %r12,%rcx
+  80510f:	4c 89 f2             	mov    %r14,%rdx
+  805112:	48 bf 38 63 80 00 00 	movabs $0x806338,%rdi
+  805119:	00 00 00 
+  80511c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805121:	49 bc c5 16 80 00 00 	movabs $0x8016c5,%r12
+  805128:	00 00 00 
+  80512b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80512e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805132:	48 89 df             	mov    %rbx,%rdi
+  805135:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  80513c:	00 00 00 
+  80513f:	ff d0                	call   *%rax
+    cprintf("\n");
+  805141:	48 bf 4e 5c 80 00 00 	movabs $0x805c4e,%rdi
+  805148:	00 00 00 
+  80514b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805150:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805153:	cc                   	int3
+  805154:	eb fd                	jmp    805153 <_panic+0xa0>
+
+0000000000805156 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805156:	55                   	push   %rbp
+  805157:	48 89 e5             	mov    %rsp,%rbp
+  80515a:	41 56                	push   %r14
+  80515c:	41 55                	push   %r13
+  80515e:	41 54                	push   %r12
+  805160:	53                   	push   %rbx
+  805161:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805164:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80516b:	00 00 00 
+  80516e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805172:	74 27                	je     80519b <_handle_vectored_pagefault+0x45>
+  805174:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805179:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805180:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805183:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805186:	4c 89 e7             	mov    %r12,%rdi
+  805189:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80518e:	84 c0                	test   %al,%al
+  805190:	75 45                	jne    8051d7 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805192:	48 83 c3 01          	add    $0x1,%rbx
+  805196:	49 3b 1e             	cmp    (%r14),%rbx
+  805199:	72 eb                	jb     805186 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80519b:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8051a2:	00 
+  8051a3:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8051a8:	4d 8b 04 24          	mov    (%r12),%r8
+  8051ac:	48 ba 60 63 80 00 00 	movabs $0x806360,%rdx
+  8051b3:	00 00 00 
+  8051b6:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8051bb:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  8051c2:	00 00 00 
+  8051c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ca:	49 ba b3 50 80 00 00 	movabs $0x8050b3,%r10
+  8051d1:	00 00 00 
+  8051d4:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051d7:	5b                   	pop    %rbx
+  8051d8:	41 5c                	pop    %r12
+  8051da:	41 5d                	pop    %r13
+  8051dc:	41 5e                	pop    %r14
+  8051de:	5d                   	pop    %rbp
+  8051df:	c3                   	ret
+
+00000000008051e0 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051e0:	55                   	push   %rbp
+  8051e1:	48 89 e5             	mov    %rsp,%rbp
+  8051e4:	53                   	push   %rbx
+  8051e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8051e9:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051ec:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051f1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051f8:	00 00 00 
+  8051fb:	80 38 00             	cmpb   $0x0,(%rax)
+  8051fe:	74 68                	je     805268 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805200:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805207:	00 00 00 
+  80520a:	48 8b 08             	mov    (%rax),%rcx
+  80520d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805212:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805219:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80521c:	48 85 c9             	test   %rcx,%rcx
+  80521f:	0f 84 e0 00 00 00    	je     805305 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805225:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805229:	0f 84 c9 00 00 00    	je     8052f8 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80522f:	48 83 c2 01          	add    $0x1,%rdx
+  805233:	48 39 ca             	cmp    %rcx,%rdx
+  805236:	75 ed                	jne    805225 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805238:	48 83 f9 08          	cmp    $0x8,%rcx
+  80523c:	0f 84 84 00 00 00    	je     8052c6 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805242:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805246:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80524d:	00 00 00 
+  805250:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805257:	00 00 00 
+  80525a:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80525e:	85 f6                	test   %esi,%esi
+  805260:	0f 89 97 00 00 00    	jns    8052fd <add_pgfault_handler+0x11d>
+  805266:	eb 63                	jmp    8052cb <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805268:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80526d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805272:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805279:	00 00 00 
+  80527c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805281:	48 b8 61 27 80 00 00 	movabs $0x802761,%rax
+  805288:	00 00 00 
+  80528b:	ff d0                	call   *%rax
+  80528d:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80528f:	85 c0                	test   %eax,%eax
+  805291:	78 38                	js     8052cb <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805293:	48 be e1 53 80 00 00 	movabs $0x8053e1,%rsi
+  80529a:	00 00 00 
+  80529d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052a2:	48 b8 84 29 80 00 00 	movabs $0x802984,%rax
+  8052a9:	00 00 00 
+  8052ac:	ff d0                	call   *%rax
+  8052ae:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8052b0:	85 c0                	test   %eax,%eax
+  8052b2:	78 17                	js     8052cb <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8052b4:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052bb:	00 00 00 
+  8052be:	c6 00 01             	movb   $0x1,(%rax)
+  8052c1:	e9 3a ff ff ff       	jmp    805200 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052c6:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052cb:	89 f1                	mov    %esi,%ecx
+  8052cd:	48 ba 9e 63 80 00 00 	movabs $0x80639e,%rdx
+  8052d4:	00 00 00 
+  8052d7:	be 42 00 00 00       	mov    $0x42,%esi
+  8052dc:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  8052e3:	00 00 00 
+  8052e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052eb:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  8052f2:	00 00 00 
+  8052f5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052f8:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052fd:	89 f0                	mov    %esi,%eax
+  8052ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805303:	c9                   	leave
+  805304:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805305:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80530c:	00 00 00 
+  80530f:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805316:	48 89 d8             	mov    %rbx,%rax
+  805319:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805320:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805323:	eb d8                	jmp    8052fd <add_pgfault_handler+0x11d>
+
+0000000000805325 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805325:	55                   	push   %rbp
+  805326:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805329:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805330:	00 00 00 
+  805333:	80 38 00             	cmpb   $0x0,(%rax)
+  805336:	74 33                	je     80536b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805338:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80533f:	00 00 00 
+  805342:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805347:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80534e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805351:	48 85 c0             	test   %rax,%rax
+  805354:	0f 84 85 00 00 00    	je     8053df <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80535a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80535e:	74 40                	je     8053a0 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805360:	48 83 c1 01          	add    $0x1,%rcx
+  805364:	48 39 c1             	cmp    %rax,%rcx
+  805367:	75 f1                	jne    80535a <remove_pgfault_handler+0x35>
+  805369:	eb 74                	jmp    8053df <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80536b:	48 b9 b6 63 80 00 00 	movabs $0x8063b6,%rcx
+  805372:	00 00 00 
+  805375:	48 ba 76 62 80 00 00 	movabs $0x806276,%rdx
+  80537c:	00 00 00 
+  80537f:	be 48 00 00 00       	mov    $0x48,%esi
+  805384:	48 bf 90 63 80 00 00 	movabs $0x806390,%rdi
+  80538b:	00 00 00 
+  80538e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805393:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  80539a:	00 00 00 
+  80539d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8053a0:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8053a7:	00 
+  8053a8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8053ac:	48 29 ca             	sub    %rcx,%rdx
+  8053af:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8053b6:	00 00 00 
+  8053b9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8053bd:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053c2:	48 89 ce             	mov    %rcx,%rsi
+  8053c5:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  8053cc:	00 00 00 
+  8053cf:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053d1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053d8:	00 00 00 
+  8053db:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053df:	5d                   	pop    %rbp
+  8053e0:	c3                   	ret
+
+00000000008053e1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053e1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053e4:	48 b8 56 51 80 00 00 	movabs $0x805156,%rax
+  8053eb:	00 00 00 
+    call *%rax
+  8053ee:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053f0:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053f7:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053f8:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053ff:	00 
+    subq $8, %rcx
+  805400:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805404:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805407:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80540e:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  80540f:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805413:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805417:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80541c:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805421:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805426:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80542b:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805430:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805435:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80543a:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80543f:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805444:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805449:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80544e:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805453:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805458:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80545d:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805461:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805465:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805466:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805467:	c3                   	ret
+
+0000000000805468 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805468:	85 ff                	test   %edi,%edi
+  80546a:	78 58                	js     8054c4 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80546c:	48 85 f6             	test   %rsi,%rsi
+  80546f:	74 12                	je     805483 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805471:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805478:	00 00 00 
+  80547b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805481:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805483:	48 85 c9             	test   %rcx,%rcx
+  805486:	74 12                	je     80549a <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805488:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80548f:	00 00 00 
+  805492:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805498:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80549a:	48 85 d2             	test   %rdx,%rdx
+  80549d:	74 14                	je     8054b3 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80549f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054a6:	00 00 00 
+  8054a9:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8054b0:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8054b3:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054ba:	00 00 00 
+  8054bd:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054c3:	c3                   	ret
+        if (from_env_store) {
+  8054c4:	48 85 f6             	test   %rsi,%rsi
+  8054c7:	74 06                	je     8054cf <ipc_result+0x67>
+            *from_env_store = 0;
+  8054c9:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054cf:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054d1:	48 85 c9             	test   %rcx,%rcx
+  8054d4:	74 ed                	je     8054c3 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054d6:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054dc:	c3                   	ret
+
+00000000008054dd <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054dd:	55                   	push   %rbp
+  8054de:	48 89 e5             	mov    %rsp,%rbp
+  8054e1:	41 55                	push   %r13
+  8054e3:	41 54                	push   %r12
+  8054e5:	53                   	push   %rbx
+  8054e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8054ea:	49 89 fc             	mov    %rdi,%r12
+  8054ed:	48 89 f7             	mov    %rsi,%rdi
+  8054f0:	48 89 d3             	mov    %rdx,%rbx
+  8054f3:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054f6:	48 85 f6             	test   %rsi,%rsi
+  8054f9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805500:	00 00 00 
+  805503:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805507:	be 00 00 00 00       	mov    $0x0,%esi
+  80550c:	48 85 d2             	test   %rdx,%rdx
+  80550f:	74 03                	je     805514 <ipc_recv+0x37>
+  805511:	48 8b 32             	mov    (%rdx),%rsi
+  805514:	48 b8 ad 2c 80 00 00 	movabs $0x802cad,%rax
+  80551b:	00 00 00 
+  80551e:	ff d0                	call   *%rax
+  805520:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805522:	4c 89 e9             	mov    %r13,%rcx
+  805525:	48 89 da             	mov    %rbx,%rdx
+  805528:	4c 89 e6             	mov    %r12,%rsi
+  80552b:	48 b8 68 54 80 00 00 	movabs $0x805468,%rax
+  805532:	00 00 00 
+  805535:	ff d0                	call   *%rax
+}
+  805537:	48 83 c4 08          	add    $0x8,%rsp
+  80553b:	5b                   	pop    %rbx
+  80553c:	41 5c                	pop    %r12
+  80553e:	41 5d                	pop    %r13
+  805540:	5d                   	pop    %rbp
+  805541:	c3                   	ret
+
+0000000000805542 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805542:	55                   	push   %rbp
+  805543:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805546:	48 85 d2             	test   %rdx,%rdx
+  805549:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805550:	00 00 00 
+  805553:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805557:	89 f6                	mov    %esi,%esi
+  805559:	48 b8 39 2b 80 00 00 	movabs $0x802b39,%rax
+  805560:	00 00 00 
+  805563:	ff d0                	call   *%rax
+    if (res < 0) {
+  805565:	85 c0                	test   %eax,%eax
+  805567:	78 02                	js     80556b <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805569:	5d                   	pop    %rbp
+  80556a:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80556b:	89 c1                	mov    %eax,%ecx
+  80556d:	48 ba d0 63 80 00 00 	movabs $0x8063d0,%rdx
+  805574:	00 00 00 
+  805577:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80557c:	48 bf dd 63 80 00 00 	movabs $0x8063dd,%rdi
+  805583:	00 00 00 
+  805586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80558b:	49 b8 b3 50 80 00 00 	movabs $0x8050b3,%r8
+  805592:	00 00 00 
+  805595:	41 ff d0             	call   *%r8
+
+0000000000805598 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805598:	55                   	push   %rbp
+  805599:	48 89 e5             	mov    %rsp,%rbp
+  80559c:	53                   	push   %rbx
+  80559d:	48 83 ec 08          	sub    $0x8,%rsp
+  8055a1:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8055a5:	48 85 d2             	test   %rdx,%rdx
+  8055a8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055af:	00 00 00 
+  8055b2:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8055b6:	4d 85 c9             	test   %r9,%r9
+  8055b9:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8055bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055c2:	48 85 db             	test   %rbx,%rbx
+  8055c5:	74 03                	je     8055ca <ipc_call+0x32>
+  8055c7:	48 8b 03             	mov    (%rbx),%rax
+  8055ca:	89 f6                	mov    %esi,%esi
+  8055cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8055d0:	50                   	push   %rax
+  8055d1:	48 b8 6b 2b 80 00 00 	movabs $0x802b6b,%rax
+  8055d8:	00 00 00 
+  8055db:	ff d0                	call   *%rax
+  8055dd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055df:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055e3:	48 89 da             	mov    %rbx,%rdx
+  8055e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8055eb:	48 b8 68 54 80 00 00 	movabs $0x805468,%rax
+  8055f2:	00 00 00 
+  8055f5:	ff d0                	call   *%rax
+}
+  8055f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055fb:	c9                   	leave
+  8055fc:	c3                   	ret
+
+00000000008055fd <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055fd:	55                   	push   %rbp
+  8055fe:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805601:	89 f6                	mov    %esi,%esi
+  805603:	48 b8 d7 2b 80 00 00 	movabs $0x802bd7,%rax
+  80560a:	00 00 00 
+  80560d:	ff d0                	call   *%rax
+  80560f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805611:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80561b:	be 00 00 00 00       	mov    $0x0,%esi
+  805620:	48 b8 68 54 80 00 00 	movabs $0x805468,%rax
+  805627:	00 00 00 
+  80562a:	ff d0                	call   *%rax
+}
+  80562c:	5d                   	pop    %rbp
+  80562d:	c3                   	ret
+
+000000000080562e <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80562e:	55                   	push   %rbp
+  80562f:	48 89 e5             	mov    %rsp,%rbp
+  805632:	41 54                	push   %r12
+  805634:	53                   	push   %rbx
+  805635:	4c 89 cb             	mov    %r9,%rbx
+  805638:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80563c:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805640:	48 85 d2             	test   %rdx,%rdx
+  805643:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80564a:	00 00 00 
+  80564d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805651:	4d 85 c9             	test   %r9,%r9
+  805654:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80565d:	4d 85 e4             	test   %r12,%r12
+  805660:	74 04                	je     805666 <ipc_reply_wait+0x38>
+  805662:	49 8b 04 24          	mov    (%r12),%rax
+  805666:	89 f6                	mov    %esi,%esi
+  805668:	48 83 ec 08          	sub    $0x8,%rsp
+  80566c:	50                   	push   %rax
+  80566d:	48 b8 41 2c 80 00 00 	movabs $0x802c41,%rax
+  805674:	00 00 00 
+  805677:	ff d0                	call   *%rax
+  805679:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80567b:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80567f:	4c 89 e2             	mov    %r12,%rdx
+  805682:	48 89 de             	mov    %rbx,%rsi
+  805685:	48 b8 68 54 80 00 00 	movabs $0x805468,%rax
+  80568c:	00 00 00 
+  80568f:	ff d0                	call   *%rax
+}
+  805691:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805695:	5b                   	pop    %rbx
+  805696:	41 5c                	pop    %r12
+  805698:	5d                   	pop    %rbp
+  805699:	c3                   	ret
+
+000000000080569a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80569a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80569f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8056a6:	00 00 00 
+  8056a9:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8056b0:	48 01 ca             	add    %rcx,%rdx
+  8056b3:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8056b9:	39 fa                	cmp    %edi,%edx
+  8056bb:	74 12                	je     8056cf <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8056bd:	48 83 c0 01          	add    $0x1,%rax
+  8056c1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056c7:	75 e0                	jne    8056a9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056ce:	c3                   	ret
+            return envs[i].env_id;
+  8056cf:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056d6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056dd:	00 00 00 
+  8056e0:	48 01 d0             	add    %rdx,%rax
+  8056e3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056e9:	c3                   	ret
+  8056ea:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008056f0 <__rodata_start>:
+  8056f0:	77 00                	ja     8056f2 <__rodata_start+0x2>
+  8056f2:	72 62                	jb     805756 <__rodata_start+0x66>
+  8056f4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056f7:	00 0f                	add    %cl,(%rdi)
+  8056f9:	1f                   	(bad)
+  8056fa:	84 00                	test   %al,(%rax)
+  8056fc:	00 00                	add    %al,(%rax)
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	b3 09                	mov    $0x9,%bl
+  805702:	80 00 00             	addb   $0x0,(%rax)
+  805705:	00 00                	add    %al,(%rax)
+  805707:	00 ed                	add    %ch,%ch
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 ed                	add    %ch,%ch
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	ed                   	in     (%dx),%eax
+  805739:	0d 80 00 00 00       	or     $0x80,%eax
+  80573e:	00 00                	add    %al,(%rax)
+  805740:	ed                   	in     (%dx),%eax
+  805741:	0d 80 00 00 00       	or     $0x80,%eax
+  805746:	00 00                	add    %al,(%rax)
+  805748:	ed                   	in     (%dx),%eax
+  805749:	0d 80 00 00 00       	or     $0x80,%eax
+  80574e:	00 00                	add    %al,(%rax)
+  805750:	ed                   	in     (%dx),%eax
+  805751:	0d 80 00 00 00       	or     $0x80,%eax
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	8c 0a                	mov    %cs,(%rdx)
+  80578a:	80 00 00             	addb   $0x0,(%rax)
+  80578d:	00 00                	add    %al,(%rax)
+  80578f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805796:	00 00                	add    %al,(%rax)
+  805798:	8c 0a                	mov    %cs,(%rdx)
+  80579a:	80 00 00             	addb   $0x0,(%rax)
+  80579d:	00 00                	add    %al,(%rax)
+  80579f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	f4                   	hlt
+  805899:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80589f:	00 ed                	add    %ch,%ch
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	2c 0b                	sub    $0xb,%al
+  8058b2:	80 00 00             	addb   $0x0,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 ed                	add    %ch,%ch
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058f3:	00 00                	add    %al,(%rax)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 cb                	add    %cl,%bl
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	6a 0a                	push   $0xa
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	3c 0a                	cmp    $0xa,%al
+  80593a:	80 00 00             	addb   $0x0,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 ed                	add    %ch,%ch
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80594b:	00 00                	add    %al,(%rax)
+  80594d:	00 00                	add    %al,(%rax)
+  80594f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 29                	add    %ch,(%rcx)
+  805959:	0c 80                	or     $0x80,%al
+  80595b:	00 00                	add    %al,(%rax)
+  80595d:	00 00                	add    %al,(%rax)
+  80595f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805962:	80 00 00             	addb   $0x0,(%rax)
+  805965:	00 00                	add    %al,(%rax)
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	1a 0b                	sbb    (%rbx),%cl
+  805972:	80 00 00             	addb   $0x0,(%rax)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 ed                	add    %ch,%ch
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ce                   	(bad)
+  805981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805987:	00 ed                	add    %ch,%ch
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	f4                   	hlt
+  805999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80599f:	00 37                	add    %dh,(%rdi)
+  8059a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059aa:	80 00 00             	addb   $0x0,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 37                	add    %dh,(%rdi)
+  8059b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8059b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059c2:	80 00 00             	addb   $0x0,(%rax)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059cb:	00 00                	add    %al,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 d2                	add    %dl,%dl
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 d2                	add    %dl,%dl
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 d2                	add    %dl,%dl
+  8059f9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ff:	00 d2                	add    %dl,%dl
+  805a01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a07:	00 f6                	add    %dh,%dh
+  805a09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a0f:	00 f6                	add    %dh,%dh
+  805a11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a32:	80 00 00             	addb   $0x0,(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 22                	add    %ah,(%rdx)
+  805a61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a67:	00 22                	add    %ah,(%rdx)
+  805a69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a6f:	00 22                	add    %ah,(%rdx)
+  805a71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a77:	00 22                	add    %ah,(%rdx)
+  805a79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 46 12             	add    %al,0x12(%rsi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 22                	add    %ah,(%rdx)
+  805b61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b67:	00 22                	add    %ah,(%rdx)
+  805b69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b6f:	00 22                	add    %ah,(%rdx)
+  805b71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b77:	00 22                	add    %ah,(%rdx)
+  805b79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 46 12             	add    %al,0x12(%rsi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c20 <basefix.0>:
+  805c20:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c30:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c40:	10 00 68 65 6c 6c 6f 2c 20 77 6f 72 6c 64 0a 00     ..hello, world..
+  805c50:	69 20 61 6d 20 65 6e 76 69 72 6f 6e 6d 65 6e 74     i am environment
+  805c60:	20 25 30 38 78 0a 00 3c 75 6e 6b 6e 6f 77 6e 3e      %08x..<unknown>
+  805c70:	00 30 31 32 33 34 35 36 37 38 39 41 42 43 44 45     .0123456789ABCDE
+  805c80:	46 00 30 31 32 33 34 35 36 37 38 39 61 62 63 64     F.0123456789abcd
+  805c90:	65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f 72 20     ef.(null).error 
+  805ca0:	25 64 00 75 6e 73 70 65 63 69 66 69 65 64 20 65     %d.unspecified e
+  805cb0:	72 72 6f 72 00 62 61 64 20 65 6e 76 69 72 6f 6e     rror.bad environ
+  805cc0:	6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70 61 72     ment.invalid par
+  805cd0:	61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20 6d 65     ameter.out of me
+  805ce0:	6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e 76 69     mory.out of envi
+  805cf0:	72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75 70 74     ronments.corrupt
+  805d00:	65 64 20 64 65 62 75 67 20 69 6e 66 6f 00 73 65     ed debug info.se
+  805d10:	67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75 6c 74     gmentation fault
+  805d20:	00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69 6d 61     .invalid ELF ima
+  805d30:	67 65 00 6e 6f 20 73 75 63 68 20 73 79 73 74 65     ge.no such syste
+  805d40:	6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e 6f 74     m call.entry not
+  805d50:	20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20 6e 6f      found.env is no
+  805d60:	74 20 72 65 63 76 69 6e 67 00 75 6e 65 78 70 65     t recving.unexpe
+  805d70:	63 74 65 64 20 65 6e 64 20 6f 66 20 66 69 6c 65     cted end of file
+  805d80:	00 6e 6f 20 66 72 65 65 20 73 70 61 63 65 20 6f     .no free space o
+  805d90:	6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e 79 20     n disk.too many 
+  805da0:	66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e 00 66     files are open.f
+  805db0:	69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e 6f 74     ile or block not
+  805dc0:	20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64 20 70      found.invalid p
+  805dd0:	61 74 68 00 66 69 6c 65 20 61 6c 72 65 61 64 79     ath.file already
+  805de0:	20 65 78 69 73 74 73 00 6f 70 65 72 61 74 69 6f      exists.operatio
+  805df0:	6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65 64 00     n not supported.
+  805e00:	bd 18 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805e10:	04 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805e20:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805e30:	14 1f 80 00 00 00 00 00 dc 18 80 00 00 00 00 00     ................
+  805e40:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805e50:	d0 18 80 00 00 00 00 00 4a 19 80 00 00 00 00 00     ........J.......
+  805e60:	14 1f 80 00 00 00 00 00 d0 18 80 00 00 00 00 00     ................
+  805e70:	16 19 80 00 00 00 00 00 16 19 80 00 00 00 00 00     ................
+  805e80:	16 19 80 00 00 00 00 00 16 19 80 00 00 00 00 00     ................
+  805e90:	16 19 80 00 00 00 00 00 16 19 80 00 00 00 00 00     ................
+  805ea0:	16 19 80 00 00 00 00 00 16 19 80 00 00 00 00 00     ................
+  805eb0:	16 19 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805ec0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805ed0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805ee0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805ef0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f00:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f10:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f20:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f30:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f40:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f50:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f60:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f70:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f80:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805f90:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805fa0:	14 1f 80 00 00 00 00 00 32 1e 80 00 00 00 00 00     ........2.......
+  805fb0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805fc0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805fd0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805fe0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  805ff0:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  806000:	78 19 80 00 00 00 00 00 47 1b 80 00 00 00 00 00     x.......G.......
+  806010:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  806020:	14 1f 80 00 00 00 00 00 6d 19 80 00 00 00 00 00     ........m.......
+  806030:	a7 19 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  806040:	14 1f 80 00 00 00 00 00 62 19 80 00 00 00 00 00     ........b.......
+  806050:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  806060:	f0 1c 80 00 00 00 00 00 bf 1d 80 00 00 00 00 00     ................
+  806070:	14 1f 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  806080:	3e 1a 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     >...............
+  806090:	1b 1c 80 00 00 00 00 00 14 1f 80 00 00 00 00 00     ................
+  8060a0:	14 1f 80 00 00 00 00 00 32 1e 80 00 00 00 00 00     ........2.......
+  8060b0:	14 1f 80 00 00 00 00 00 c6 18 80 00 00 00 00 00     ................
+
+00000000008060c0 <error_string>:
+	...
+  8060c8:	a3 5c 80 00 00 00 00 00 b5 5c 80 00 00 00 00 00     .\.......\......
+  8060d8:	c5 5c 80 00 00 00 00 00 d7 5c 80 00 00 00 00 00     .\.......\......
+  8060e8:	e5 5c 80 00 00 00 00 00 f9 5c 80 00 00 00 00 00     .\.......\......
+  8060f8:	0e 5d 80 00 00 00 00 00 21 5d 80 00 00 00 00 00     .]......!]......
+  806108:	33 5d 80 00 00 00 00 00 47 5d 80 00 00 00 00 00     3]......G]......
+  806118:	57 5d 80 00 00 00 00 00 6a 5d 80 00 00 00 00 00     W]......j]......
+  806128:	81 5d 80 00 00 00 00 00 97 5d 80 00 00 00 00 00     .].......]......
+  806138:	af 5d 80 00 00 00 00 00 c7 5d 80 00 00 00 00 00     .].......]......
+  806148:	d4 5d 80 00 00 00 00 00 60 61 80 00 00 00 00 00     .]......`a......
+  806158:	e8 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806168:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806178:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806188:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806198:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8061a8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8061b8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8061c8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8061d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806208:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806218:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806228:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806238:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806240 <devtab>:
+  806240:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806250:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806260:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806270:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806280:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806290:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8062a0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8062b0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8062c0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8062d0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062e0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062f0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806300:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806310:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806320:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806330:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806340:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806350:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806360:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806370:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806380:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806390:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8063a0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8063b0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8063c0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8063d0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063e0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806400:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806410:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806420:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806430:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806440:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806450:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806460:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806470:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806480:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806490:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,10969 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 bd 24 80 00 00 	movabs $0x8024bd,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 3e 23 80 00 00 	movabs $0x80233e,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 4d 21 80 00 00 	movabs $0x80214d,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 4d 21 80 00 00 	movabs $0x80214d,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 71 17 80 00 00 	movabs $0x801771,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be ff 67 80 00 00 	movabs $0x8067ff,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 48 61 80 00 00 	movabs $0x806148,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 4a 61 80 00 00 	movabs $0x80614a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 4d 61 80 00 00 	movabs $0x80614d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 2d 55 80 00 00 	movabs $0x80552d,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 04 58 80 00 00 	movabs $0x805804,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 68 35 80 00 00 	movabs $0x803568,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 37 35 80 00 00 	movabs $0x803537,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 37 35 80 00 00 	movabs $0x803537,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 4f 33 80 00 00 	movabs $0x80334f,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 8a 24 80 00 00 	movabs $0x80248a,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 60 61 80 00 00 	movabs $0x806160,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 8a 24 80 00 00 	movabs $0x80248a,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 bd 24 80 00 00 	movabs $0x8024bd,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 8a 24 80 00 00 	movabs $0x80248a,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 00 64 80 00 00 	movabs $0x806400,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 8a 24 80 00 00 	movabs $0x80248a,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 8a 24 80 00 00 	movabs $0x80248a,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 80 66 80 00 00 	movabs $0x806680,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 80 66 80 00 00 	movabs $0x806680,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 e2 26 80 00 00 	movabs $0x8026e2,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 e2 26 80 00 00 	movabs $0x8026e2,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 c9 01 00 00       	call   8016c8 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 55                	push   %r13
+  801507:	41 54                	push   %r12
+  801509:	53                   	push   %rbx
+  80150a:	48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    int fd, n, r;
+    char buf[512 + 1];
+
+    binaryname = "icode";
+  801511:	48 b8 a2 66 80 00 00 	movabs $0x8066a2,%rax
+  801518:	00 00 00 
+  80151b:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801522:	00 00 00 
+
+    cprintf("icode startup\n");
+  801525:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  80152c:	00 00 00 
+  80152f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801534:	48 bb e4 18 80 00 00 	movabs $0x8018e4,%rbx
+  80153b:	00 00 00 
+  80153e:	ff d3                	call   *%rbx
+
+    cprintf("icode: open /motd\n");
+  801540:	48 bf b7 66 80 00 00 	movabs $0x8066b7,%rdi
+  801547:	00 00 00 
+  80154a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154f:	ff d3                	call   *%rbx
+    if ((fd = open("/motd", O_RDONLY)) < 0)
+  801551:	be 00 00 00 00       	mov    $0x0,%esi
+  801556:	48 bf ca 66 80 00 00 	movabs $0x8066ca,%rdi
+  80155d:	00 00 00 
+  801560:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  801567:	00 00 00 
+  80156a:	ff d0                	call   *%rax
+  80156c:	89 c3                	mov    %eax,%ebx
+  80156e:	85 c0                	test   %eax,%eax
+  801570:	78 31                	js     8015a3 <umain+0xa2>
+        panic("icode: open /motd: %i", fd);
+
+    cprintf("icode: read /motd\n");
+  801572:	48 bf f3 66 80 00 00 	movabs $0x8066f3,%rdi
+  801579:	00 00 00 
+  80157c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801581:	48 ba e4 18 80 00 00 	movabs $0x8018e4,%rdx
+  801588:	00 00 00 
+  80158b:	ff d2                	call   *%rdx
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  80158d:	49 bc 4f 33 80 00 00 	movabs $0x80334f,%r12
+  801594:	00 00 00 
+        sys_cputs(buf, n);
+  801597:	49 bd 98 27 80 00 00 	movabs $0x802798,%r13
+  80159e:	00 00 00 
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8015a1:	eb 3a                	jmp    8015dd <umain+0xdc>
+        panic("icode: open /motd: %i", fd);
+  8015a3:	89 c1                	mov    %eax,%ecx
+  8015a5:	48 ba d0 66 80 00 00 	movabs $0x8066d0,%rdx
+  8015ac:	00 00 00 
+  8015af:	be 0e 00 00 00       	mov    $0xe,%esi
+  8015b4:	48 bf e6 66 80 00 00 	movabs $0x8066e6,%rdi
+  8015bb:	00 00 00 
+  8015be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c3:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  8015ca:	00 00 00 
+  8015cd:	41 ff d0             	call   *%r8
+        sys_cputs(buf, n);
+  8015d0:	48 63 f0             	movslq %eax,%rsi
+  8015d3:	48 8d bd df fd ff ff 	lea    -0x221(%rbp),%rdi
+  8015da:	41 ff d5             	call   *%r13
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8015dd:	ba 00 02 00 00       	mov    $0x200,%edx
+  8015e2:	48 8d b5 df fd ff ff 	lea    -0x221(%rbp),%rsi
+  8015e9:	89 df                	mov    %ebx,%edi
+  8015eb:	41 ff d4             	call   *%r12
+  8015ee:	85 c0                	test   %eax,%eax
+  8015f0:	7f de                	jg     8015d0 <umain+0xcf>
+
+    cprintf("icode: close /motd\n");
+  8015f2:	48 bf 06 67 80 00 00 	movabs $0x806706,%rdi
+  8015f9:	00 00 00 
+  8015fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801601:	49 bc e4 18 80 00 00 	movabs $0x8018e4,%r12
+  801608:	00 00 00 
+  80160b:	41 ff d4             	call   *%r12
+    close(fd);
+  80160e:	89 df                	mov    %ebx,%edi
+  801610:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  801617:	00 00 00 
+  80161a:	ff d0                	call   *%rax
+
+    cprintf("icode: spawn /init\n");
+  80161c:	48 bf 1a 67 80 00 00 	movabs $0x80671a,%rdi
+  801623:	00 00 00 
+  801626:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162b:	41 ff d4             	call   *%r12
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  80162e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801634:	48 b9 2e 67 80 00 00 	movabs $0x80672e,%rcx
+  80163b:	00 00 00 
+  80163e:	48 ba 37 67 80 00 00 	movabs $0x806737,%rdx
+  801645:	00 00 00 
+  801648:	48 be 41 67 80 00 00 	movabs $0x806741,%rsi
+  80164f:	00 00 00 
+  801652:	48 bf 40 67 80 00 00 	movabs $0x806740,%rdi
+  801659:	00 00 00 
+  80165c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801661:	49 b9 38 47 80 00 00 	movabs $0x804738,%r9
+  801668:	00 00 00 
+  80166b:	41 ff d1             	call   *%r9
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	78 29                	js     80169b <umain+0x19a>
+        panic("icode: spawn /init: %i", r);
+
+    cprintf("icode: exiting\n");
+  801672:	48 bf 5d 67 80 00 00 	movabs $0x80675d,%rdi
+  801679:	00 00 00 
+  80167c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801681:	48 ba e4 18 80 00 00 	movabs $0x8018e4,%rdx
+  801688:	00 00 00 
+  80168b:	ff d2                	call   *%rdx
+}
+  80168d:	48 81 c4 18 02 00 00 	add    $0x218,%rsp
+  801694:	5b                   	pop    %rbx
+  801695:	41 5c                	pop    %r12
+  801697:	41 5d                	pop    %r13
+  801699:	5d                   	pop    %rbp
+  80169a:	c3                   	ret
+        panic("icode: spawn /init: %i", r);
+  80169b:	89 c1                	mov    %eax,%ecx
+  80169d:	48 ba 46 67 80 00 00 	movabs $0x806746,%rdx
+  8016a4:	00 00 00 
+  8016a7:	be 19 00 00 00       	mov    $0x19,%esi
+  8016ac:	48 bf e6 66 80 00 00 	movabs $0x8066e6,%rdi
+  8016b3:	00 00 00 
+  8016b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bb:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  8016c2:	00 00 00 
+  8016c5:	41 ff d0             	call   *%r8
+
+00000000008016c8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8016c8:	55                   	push   %rbp
+  8016c9:	48 89 e5             	mov    %rsp,%rbp
+  8016cc:	41 56                	push   %r14
+  8016ce:	41 55                	push   %r13
+  8016d0:	41 54                	push   %r12
+  8016d2:	53                   	push   %rbx
+  8016d3:	41 89 fd             	mov    %edi,%r13d
+  8016d6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8016d9:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8016e0:	00 00 00 
+  8016e3:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8016ea:	00 00 00 
+  8016ed:	48 39 c2             	cmp    %rax,%rdx
+  8016f0:	73 17                	jae    801709 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8016f2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8016f5:	49 89 c4             	mov    %rax,%r12
+  8016f8:	48 83 c3 08          	add    $0x8,%rbx
+  8016fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801701:	ff 53 f8             	call   *-0x8(%rbx)
+  801704:	4c 39 e3             	cmp    %r12,%rbx
+  801707:	72 ef                	jb     8016f8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801709:	48 b8 a8 28 80 00 00 	movabs $0x8028a8,%rax
+  801710:	00 00 00 
+  801713:	ff d0                	call   *%rax
+  801715:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80171a:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801721:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801728:	00 00 00 
+  80172b:	48 01 d0             	add    %rdx,%rax
+  80172e:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801735:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801738:	45 85 ed             	test   %r13d,%r13d
+  80173b:	7e 0d                	jle    80174a <libmain+0x82>
+  80173d:	49 8b 06             	mov    (%r14),%rax
+  801740:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801747:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80174a:	4c 89 f6             	mov    %r14,%rsi
+  80174d:	44 89 ef             	mov    %r13d,%edi
+  801750:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801757:	00 00 00 
+  80175a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80175c:	48 b8 71 17 80 00 00 	movabs $0x801771,%rax
+  801763:	00 00 00 
+  801766:	ff d0                	call   *%rax
+#endif
+}
+  801768:	5b                   	pop    %rbx
+  801769:	41 5c                	pop    %r12
+  80176b:	41 5d                	pop    %r13
+  80176d:	41 5e                	pop    %r14
+  80176f:	5d                   	pop    %rbp
+  801770:	c3                   	ret
+
+0000000000801771 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801771:	55                   	push   %rbp
+  801772:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801775:	48 b8 04 32 80 00 00 	movabs $0x803204,%rax
+  80177c:	00 00 00 
+  80177f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801781:	bf 00 00 00 00       	mov    $0x0,%edi
+  801786:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+}
+  801792:	5d                   	pop    %rbp
+  801793:	c3                   	ret
+
+0000000000801794 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801794:	55                   	push   %rbp
+  801795:	48 89 e5             	mov    %rsp,%rbp
+  801798:	41 56                	push   %r14
+  80179a:	41 55                	push   %r13
+  80179c:	41 54                	push   %r12
+  80179e:	53                   	push   %rbx
+  80179f:	48 83 ec 50          	sub    $0x50,%rsp
+  8017a3:	49 89 fc             	mov    %rdi,%r12
+  8017a6:	41 89 f5             	mov    %esi,%r13d
+  8017a9:	48 89 d3             	mov    %rdx,%rbx
+  8017ac:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8017b0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8017b4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8017b8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8017bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017c3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8017c7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8017cb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8017cf:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8017d6:	00 00 00 
+  8017d9:	4c 8b 30             	mov    (%rax),%r14
+  8017dc:	48 b8 a8 28 80 00 00 	movabs $0x8028a8,%rax
+  8017e3:	00 00 00 
+  8017e6:	ff d0                	call   *%rax
+  8017e8:	89 c6                	mov    %eax,%esi
+  8017ea:	45 89 e8             	mov    %r13d,%r8d
+  8017ed:	4c 89 e1             	mov    %r12,%rcx
+  8017f0:	4c 89 f2             	mov    %r14,%rdx
+  8017f3:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  8017fa:	00 00 00 
+  8017fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801802:	49 bc e4 18 80 00 00 	movabs $0x8018e4,%r12
+  801809:	00 00 00 
+  80180c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80180f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801813:	48 89 df             	mov    %rbx,%rdi
+  801816:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+    cprintf("\n");
+  801822:	48 bf 04 67 80 00 00 	movabs $0x806704,%rdi
+  801829:	00 00 00 
+  80182c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801831:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801834:	cc                   	int3
+  801835:	eb fd                	jmp    801834 <_panic+0xa0>
+
+0000000000801837 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801837:	55                   	push   %rbp
+  801838:	48 89 e5             	mov    %rsp,%rbp
+  80183b:	53                   	push   %rbx
+  80183c:	48 83 ec 08          	sub    $0x8,%rsp
+  801840:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801843:	8b 06                	mov    (%rsi),%eax
+  801845:	8d 50 01             	lea    0x1(%rax),%edx
+  801848:	89 16                	mov    %edx,(%rsi)
+  80184a:	48 98                	cltq
+  80184c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801851:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801857:	74 0a                	je     801863 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801859:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80185d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801861:	c9                   	leave
+  801862:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801863:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801867:	be ff 00 00 00       	mov    $0xff,%esi
+  80186c:	48 b8 98 27 80 00 00 	movabs $0x802798,%rax
+  801873:	00 00 00 
+  801876:	ff d0                	call   *%rax
+        state->offset = 0;
+  801878:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80187e:	eb d9                	jmp    801859 <putch+0x22>
+
+0000000000801880 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801880:	55                   	push   %rbp
+  801881:	48 89 e5             	mov    %rsp,%rbp
+  801884:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80188b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80188e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801895:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80189a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8018a2:	48 89 f1             	mov    %rsi,%rcx
+  8018a5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8018ac:	48 bf 37 18 80 00 00 	movabs $0x801837,%rdi
+  8018b3:	00 00 00 
+  8018b6:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  8018bd:	00 00 00 
+  8018c0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8018c2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8018c9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8018d0:	48 b8 98 27 80 00 00 	movabs $0x802798,%rax
+  8018d7:	00 00 00 
+  8018da:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8018dc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8018e2:	c9                   	leave
+  8018e3:	c3                   	ret
+
+00000000008018e4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8018e4:	55                   	push   %rbp
+  8018e5:	48 89 e5             	mov    %rsp,%rbp
+  8018e8:	48 83 ec 50          	sub    $0x50,%rsp
+  8018ec:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8018f0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8018f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018f8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018fc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801900:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801907:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80190b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80190f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801913:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801917:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80191b:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  801922:	00 00 00 
+  801925:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801927:	c9                   	leave
+  801928:	c3                   	ret
+
+0000000000801929 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801929:	55                   	push   %rbp
+  80192a:	48 89 e5             	mov    %rsp,%rbp
+  80192d:	41 57                	push   %r15
+  80192f:	41 56                	push   %r14
+  801931:	41 55                	push   %r13
+  801933:	41 54                	push   %r12
+  801935:	53                   	push   %rbx
+  801936:	48 83 ec 18          	sub    $0x18,%rsp
+  80193a:	49 89 fc             	mov    %rdi,%r12
+  80193d:	49 89 f5             	mov    %rsi,%r13
+  801940:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801944:	8b 45 10             	mov    0x10(%rbp),%eax
+  801947:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80194a:	41 89 cf             	mov    %ecx,%r15d
+  80194d:	4c 39 fa             	cmp    %r15,%rdx
+  801950:	73 5b                	jae    8019ad <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801952:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801956:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80195a:	85 db                	test   %ebx,%ebx
+  80195c:	7e 0e                	jle    80196c <print_num+0x43>
+            putch(padc, put_arg);
+  80195e:	4c 89 ee             	mov    %r13,%rsi
+  801961:	44 89 f7             	mov    %r14d,%edi
+  801964:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801967:	83 eb 01             	sub    $0x1,%ebx
+  80196a:	75 f2                	jne    80195e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80196c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801970:	48 b9 ac 67 80 00 00 	movabs $0x8067ac,%rcx
+  801977:	00 00 00 
+  80197a:	48 b8 9b 67 80 00 00 	movabs $0x80679b,%rax
+  801981:	00 00 00 
+  801984:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801988:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80198c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801991:	49 f7 f7             	div    %r15
+  801994:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801998:	4c 89 ee             	mov    %r13,%rsi
+  80199b:	41 ff d4             	call   *%r12
+}
+  80199e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019a2:	5b                   	pop    %rbx
+  8019a3:	41 5c                	pop    %r12
+  8019a5:	41 5d                	pop    %r13
+  8019a7:	41 5e                	pop    %r14
+  8019a9:	41 5f                	pop    %r15
+  8019ab:	5d                   	pop    %rbp
+  8019ac:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8019ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b6:	49 f7 f7             	div    %r15
+  8019b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8019bd:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8019c1:	52                   	push   %rdx
+  8019c2:	45 0f be c9          	movsbl %r9b,%r9d
+  8019c6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8019ca:	48 89 c2             	mov    %rax,%rdx
+  8019cd:	48 b8 29 19 80 00 00 	movabs $0x801929,%rax
+  8019d4:	00 00 00 
+  8019d7:	ff d0                	call   *%rax
+  8019d9:	48 83 c4 10          	add    $0x10,%rsp
+  8019dd:	eb 8d                	jmp    80196c <print_num+0x43>
+
+00000000008019df <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8019df:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8019e3:	48 8b 06             	mov    (%rsi),%rax
+  8019e6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8019ea:	73 0a                	jae    8019f6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8019ec:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019f0:	48 89 16             	mov    %rdx,(%rsi)
+  8019f3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8019f6:	c3                   	ret
+
+00000000008019f7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8019f7:	55                   	push   %rbp
+  8019f8:	48 89 e5             	mov    %rsp,%rbp
+  8019fb:	48 83 ec 50          	sub    $0x50,%rsp
+  8019ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a03:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a07:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801a0b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801a12:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a1a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a1e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801a22:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801a26:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  801a2d:	00 00 00 
+  801a30:	ff d0                	call   *%rax
+}
+  801a32:	c9                   	leave
+  801a33:	c3                   	ret
+
+0000000000801a34 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801a34:	55                   	push   %rbp
+  801a35:	48 89 e5             	mov    %rsp,%rbp
+  801a38:	41 57                	push   %r15
+  801a3a:	41 56                	push   %r14
+  801a3c:	41 55                	push   %r13
+  801a3e:	41 54                	push   %r12
+  801a40:	53                   	push   %rbx
+  801a41:	48 83 ec 38          	sub    $0x38,%rsp
+  801a45:	49 89 fe             	mov    %rdi,%r14
+  801a48:	49 89 f5             	mov    %rsi,%r13
+  801a4b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801a4e:	48 8b 01             	mov    (%rcx),%rax
+  801a51:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801a55:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a5d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801a61:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801a65:	eb 0d                	jmp    801a74 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801a67:	40 0f b6 ff          	movzbl %dil,%edi
+  801a6b:	4c 89 ee             	mov    %r13,%rsi
+  801a6e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801a71:	4c 89 e3             	mov    %r12,%rbx
+  801a74:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801a78:	0f b6 3b             	movzbl (%rbx),%edi
+  801a7b:	40 80 ff 25          	cmp    $0x25,%dil
+  801a7f:	74 14                	je     801a95 <vprintfmt+0x61>
+            if (!ch) return;
+  801a81:	40 84 ff             	test   %dil,%dil
+  801a84:	75 e1                	jne    801a67 <vprintfmt+0x33>
+}
+  801a86:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a8a:	5b                   	pop    %rbx
+  801a8b:	41 5c                	pop    %r12
+  801a8d:	41 5d                	pop    %r13
+  801a8f:	41 5e                	pop    %r14
+  801a91:	41 5f                	pop    %r15
+  801a93:	5d                   	pop    %rbp
+  801a94:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801a95:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801a9e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801aa3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801aa9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801ab0:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801ab4:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801ab9:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801abe:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801ac1:	83 e8 23             	sub    $0x23,%eax
+  801ac4:	3c 57                	cmp    $0x57,%al
+  801ac6:	0f 87 67 06 00 00    	ja     802133 <vprintfmt+0x6ff>
+  801acc:	0f b6 c0             	movzbl %al,%eax
+  801acf:	48 b9 40 69 80 00 00 	movabs $0x806940,%rcx
+  801ad6:	00 00 00 
+  801ad9:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801adc:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801adf:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801ae3:	eb cf                	jmp    801ab4 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801ae5:	49 89 dc             	mov    %rbx,%r12
+  801ae8:	be 01 00 00 00       	mov    $0x1,%esi
+  801aed:	eb c5                	jmp    801ab4 <vprintfmt+0x80>
+            padc = ch;
+  801aef:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801af3:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801af6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801af9:	eb b9                	jmp    801ab4 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801afb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801afe:	83 f8 2f             	cmp    $0x2f,%eax
+  801b01:	77 24                	ja     801b27 <vprintfmt+0xf3>
+  801b03:	89 c1                	mov    %eax,%ecx
+  801b05:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801b09:	83 c0 08             	add    $0x8,%eax
+  801b0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b0f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801b12:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801b15:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b19:	79 99                	jns    801ab4 <vprintfmt+0x80>
+                width = precision;
+  801b1b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801b1f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801b25:	eb 8d                	jmp    801ab4 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801b27:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801b2b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801b2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b33:	eb da                	jmp    801b0f <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801b35:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801b3a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b3e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801b44:	3c 39                	cmp    $0x39,%al
+  801b46:	77 1c                	ja     801b64 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801b48:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801b4c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801b50:	0f b6 c0             	movzbl %al,%eax
+  801b53:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b58:	0f b6 03             	movzbl (%rbx),%eax
+  801b5b:	3c 39                	cmp    $0x39,%al
+  801b5d:	76 e9                	jbe    801b48 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801b5f:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801b62:	eb b1                	jmp    801b15 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801b64:	49 89 dc             	mov    %rbx,%r12
+  801b67:	eb ac                	jmp    801b15 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801b69:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801b6c:	85 c9                	test   %ecx,%ecx
+  801b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b73:	0f 49 c1             	cmovns %ecx,%eax
+  801b76:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801b79:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b7c:	e9 33 ff ff ff       	jmp    801ab4 <vprintfmt+0x80>
+            lflag++;
+  801b81:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b84:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b87:	e9 28 ff ff ff       	jmp    801ab4 <vprintfmt+0x80>
+            lflag--;
+  801b8c:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b8f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b92:	e9 1d ff ff ff       	jmp    801ab4 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801b97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801b9d:	77 19                	ja     801bb8 <vprintfmt+0x184>
+  801b9f:	89 c2                	mov    %eax,%edx
+  801ba1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ba5:	83 c0 08             	add    $0x8,%eax
+  801ba8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bab:	8b 3a                	mov    (%rdx),%edi
+  801bad:	4c 89 ee             	mov    %r13,%rsi
+  801bb0:	41 ff d6             	call   *%r14
+            break;
+  801bb3:	e9 bc fe ff ff       	jmp    801a74 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801bb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bc4:	eb e5                	jmp    801bab <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801bc6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bc9:	83 f8 2f             	cmp    $0x2f,%eax
+  801bcc:	77 5a                	ja     801c28 <vprintfmt+0x1f4>
+  801bce:	89 c2                	mov    %eax,%edx
+  801bd0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bd4:	83 c0 08             	add    $0x8,%eax
+  801bd7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801bda:	8b 02                	mov    (%rdx),%eax
+  801bdc:	89 c1                	mov    %eax,%ecx
+  801bde:	f7 d9                	neg    %ecx
+  801be0:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801be3:	83 f9 13             	cmp    $0x13,%ecx
+  801be6:	7f 4e                	jg     801c36 <vprintfmt+0x202>
+  801be8:	48 63 c1             	movslq %ecx,%rax
+  801beb:	48 ba 00 6c 80 00 00 	movabs $0x806c00,%rdx
+  801bf2:	00 00 00 
+  801bf5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801bf9:	48 85 c0             	test   %rax,%rax
+  801bfc:	74 38                	je     801c36 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801bfe:	48 89 c1             	mov    %rax,%rcx
+  801c01:	48 ba c8 6d 80 00 00 	movabs $0x806dc8,%rdx
+  801c08:	00 00 00 
+  801c0b:	4c 89 ee             	mov    %r13,%rsi
+  801c0e:	4c 89 f7             	mov    %r14,%rdi
+  801c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c16:	49 b8 f7 19 80 00 00 	movabs $0x8019f7,%r8
+  801c1d:	00 00 00 
+  801c20:	41 ff d0             	call   *%r8
+  801c23:	e9 4c fe ff ff       	jmp    801a74 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801c28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c34:	eb a4                	jmp    801bda <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801c36:	48 ba c4 67 80 00 00 	movabs $0x8067c4,%rdx
+  801c3d:	00 00 00 
+  801c40:	4c 89 ee             	mov    %r13,%rsi
+  801c43:	4c 89 f7             	mov    %r14,%rdi
+  801c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4b:	49 b8 f7 19 80 00 00 	movabs $0x8019f7,%r8
+  801c52:	00 00 00 
+  801c55:	41 ff d0             	call   *%r8
+  801c58:	e9 17 fe ff ff       	jmp    801a74 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c60:	83 f8 2f             	cmp    $0x2f,%eax
+  801c63:	77 6c                	ja     801cd1 <vprintfmt+0x29d>
+  801c65:	89 c2                	mov    %eax,%edx
+  801c67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c6b:	83 c0 08             	add    $0x8,%eax
+  801c6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c71:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801c74:	48 85 f6             	test   %rsi,%rsi
+  801c77:	48 b8 bd 67 80 00 00 	movabs $0x8067bd,%rax
+  801c7e:	00 00 00 
+  801c81:	48 0f 45 c6          	cmovne %rsi,%rax
+  801c85:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801c89:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c8d:	7e 06                	jle    801c95 <vprintfmt+0x261>
+  801c8f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801c93:	75 4a                	jne    801cdf <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c95:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c99:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801c9d:	0f b6 00             	movzbl (%rax),%eax
+  801ca0:	84 c0                	test   %al,%al
+  801ca2:	0f 85 9a 00 00 00    	jne    801d42 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801ca8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cab:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	0f 8e bd fd ff ff    	jle    801a74 <vprintfmt+0x40>
+  801cb7:	4c 89 ee             	mov    %r13,%rsi
+  801cba:	bf 20 00 00 00       	mov    $0x20,%edi
+  801cbf:	41 ff d6             	call   *%r14
+  801cc2:	41 83 ec 01          	sub    $0x1,%r12d
+  801cc6:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801cca:	75 eb                	jne    801cb7 <vprintfmt+0x283>
+  801ccc:	e9 a3 fd ff ff       	jmp    801a74 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801cd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cdd:	eb 92                	jmp    801c71 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801cdf:	49 63 f7             	movslq %r15d,%rsi
+  801ce2:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801ce6:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+  801cf2:	48 89 c2             	mov    %rax,%rdx
+  801cf5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cf8:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801cfa:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801cfd:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	7e 91                	jle    801c95 <vprintfmt+0x261>
+  801d04:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801d09:	4c 89 ee             	mov    %r13,%rsi
+  801d0c:	44 89 e7             	mov    %r12d,%edi
+  801d0f:	41 ff d6             	call   *%r14
+  801d12:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801d16:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801d19:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801d1c:	75 eb                	jne    801d09 <vprintfmt+0x2d5>
+  801d1e:	e9 72 ff ff ff       	jmp    801c95 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d23:	0f b6 f8             	movzbl %al,%edi
+  801d26:	4c 89 ee             	mov    %r13,%rsi
+  801d29:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801d2c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801d30:	49 83 c4 01          	add    $0x1,%r12
+  801d34:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801d3a:	84 c0                	test   %al,%al
+  801d3c:	0f 84 66 ff ff ff    	je     801ca8 <vprintfmt+0x274>
+  801d42:	45 85 ff             	test   %r15d,%r15d
+  801d45:	78 0a                	js     801d51 <vprintfmt+0x31d>
+  801d47:	41 83 ef 01          	sub    $0x1,%r15d
+  801d4b:	0f 88 57 ff ff ff    	js     801ca8 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d51:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801d55:	74 cc                	je     801d23 <vprintfmt+0x2ef>
+  801d57:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801d5a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d5f:	80 fa 5e             	cmp    $0x5e,%dl
+  801d62:	77 c2                	ja     801d26 <vprintfmt+0x2f2>
+  801d64:	eb bd                	jmp    801d23 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801d66:	40 84 f6             	test   %sil,%sil
+  801d69:	75 26                	jne    801d91 <vprintfmt+0x35d>
+    switch (lflag) {
+  801d6b:	85 d2                	test   %edx,%edx
+  801d6d:	74 59                	je     801dc8 <vprintfmt+0x394>
+  801d6f:	83 fa 01             	cmp    $0x1,%edx
+  801d72:	74 7b                	je     801def <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801d74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d77:	83 f8 2f             	cmp    $0x2f,%eax
+  801d7a:	0f 87 96 00 00 00    	ja     801e16 <vprintfmt+0x3e2>
+  801d80:	89 c2                	mov    %eax,%edx
+  801d82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d86:	83 c0 08             	add    $0x8,%eax
+  801d89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d8c:	4c 8b 22             	mov    (%rdx),%r12
+  801d8f:	eb 17                	jmp    801da8 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801d91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d94:	83 f8 2f             	cmp    $0x2f,%eax
+  801d97:	77 21                	ja     801dba <vprintfmt+0x386>
+  801d99:	89 c2                	mov    %eax,%edx
+  801d9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9f:	83 c0 08             	add    $0x8,%eax
+  801da2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da5:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801da8:	4d 85 e4             	test   %r12,%r12
+  801dab:	78 7a                	js     801e27 <vprintfmt+0x3f3>
+            num = i;
+  801dad:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801db0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801db5:	e9 56 02 00 00       	jmp    802010 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801dba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc6:	eb dd                	jmp    801da5 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801dc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dcb:	83 f8 2f             	cmp    $0x2f,%eax
+  801dce:	77 11                	ja     801de1 <vprintfmt+0x3ad>
+  801dd0:	89 c2                	mov    %eax,%edx
+  801dd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd6:	83 c0 08             	add    $0x8,%eax
+  801dd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ddc:	4c 63 22             	movslq (%rdx),%r12
+  801ddf:	eb c7                	jmp    801da8 <vprintfmt+0x374>
+  801de1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801de5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801de9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ded:	eb ed                	jmp    801ddc <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801def:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801df2:	83 f8 2f             	cmp    $0x2f,%eax
+  801df5:	77 11                	ja     801e08 <vprintfmt+0x3d4>
+  801df7:	89 c2                	mov    %eax,%edx
+  801df9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dfd:	83 c0 08             	add    $0x8,%eax
+  801e00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e03:	4c 8b 22             	mov    (%rdx),%r12
+  801e06:	eb a0                	jmp    801da8 <vprintfmt+0x374>
+  801e08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e14:	eb ed                	jmp    801e03 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801e16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e22:	e9 65 ff ff ff       	jmp    801d8c <vprintfmt+0x358>
+                putch('-', put_arg);
+  801e27:	4c 89 ee             	mov    %r13,%rsi
+  801e2a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801e2f:	41 ff d6             	call   *%r14
+                i = -i;
+  801e32:	49 f7 dc             	neg    %r12
+  801e35:	e9 73 ff ff ff       	jmp    801dad <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801e3a:	40 84 f6             	test   %sil,%sil
+  801e3d:	75 2e                	jne    801e6d <vprintfmt+0x439>
+    switch (lflag) {
+  801e3f:	85 d2                	test   %edx,%edx
+  801e41:	7f 59                	jg     801e9c <vprintfmt+0x468>
+  801e43:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e46:	7d 7a                	jge    801ec2 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801e48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e4b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e4e:	0f 87 aa 00 00 00    	ja     801efe <vprintfmt+0x4ca>
+  801e54:	89 c2                	mov    %eax,%edx
+  801e56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e5a:	83 c0 08             	add    $0x8,%eax
+  801e5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e60:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e63:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e68:	e9 a3 01 00 00       	jmp    802010 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e70:	83 f8 2f             	cmp    $0x2f,%eax
+  801e73:	77 19                	ja     801e8e <vprintfmt+0x45a>
+  801e75:	89 c2                	mov    %eax,%edx
+  801e77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e7b:	83 c0 08             	add    $0x8,%eax
+  801e7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e81:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e84:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e89:	e9 82 01 00 00       	jmp    802010 <vprintfmt+0x5dc>
+  801e8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9a:	eb e5                	jmp    801e81 <vprintfmt+0x44d>
+    switch (lflag) {
+  801e9c:	83 fa 01             	cmp    $0x1,%edx
+  801e9f:	75 a7                	jne    801e48 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801ea1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ea4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ea7:	77 47                	ja     801ef0 <vprintfmt+0x4bc>
+  801ea9:	89 c2                	mov    %eax,%edx
+  801eab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eaf:	83 c0 08             	add    $0x8,%eax
+  801eb2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eb5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801eb8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801ebd:	e9 4e 01 00 00       	jmp    802010 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801ec2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ec5:	83 f8 2f             	cmp    $0x2f,%eax
+  801ec8:	77 18                	ja     801ee2 <vprintfmt+0x4ae>
+  801eca:	89 c2                	mov    %eax,%edx
+  801ecc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ed0:	83 c0 08             	add    $0x8,%eax
+  801ed3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ed6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801ed8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801edd:	e9 2e 01 00 00       	jmp    802010 <vprintfmt+0x5dc>
+  801ee2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eee:	eb e6                	jmp    801ed6 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801ef0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ef4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ef8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801efc:	eb b7                	jmp    801eb5 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801efe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f0a:	e9 51 ff ff ff       	jmp    801e60 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801f0f:	40 84 f6             	test   %sil,%sil
+  801f12:	75 2e                	jne    801f42 <vprintfmt+0x50e>
+    switch (lflag) {
+  801f14:	85 d2                	test   %edx,%edx
+  801f16:	7f 59                	jg     801f71 <vprintfmt+0x53d>
+  801f18:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f1b:	7d 77                	jge    801f94 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801f1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f20:	83 f8 2f             	cmp    $0x2f,%eax
+  801f23:	0f 87 a4 00 00 00    	ja     801fcd <vprintfmt+0x599>
+  801f29:	89 c2                	mov    %eax,%edx
+  801f2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f2f:	83 c0 08             	add    $0x8,%eax
+  801f32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f35:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f38:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f3d:	e9 ce 00 00 00       	jmp    802010 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f45:	83 f8 2f             	cmp    $0x2f,%eax
+  801f48:	77 19                	ja     801f63 <vprintfmt+0x52f>
+  801f4a:	89 c2                	mov    %eax,%edx
+  801f4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f50:	83 c0 08             	add    $0x8,%eax
+  801f53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f56:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f59:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f5e:	e9 ad 00 00 00       	jmp    802010 <vprintfmt+0x5dc>
+  801f63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f6f:	eb e5                	jmp    801f56 <vprintfmt+0x522>
+    switch (lflag) {
+  801f71:	83 fa 01             	cmp    $0x1,%edx
+  801f74:	75 a7                	jne    801f1d <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801f76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f79:	83 f8 2f             	cmp    $0x2f,%eax
+  801f7c:	77 41                	ja     801fbf <vprintfmt+0x58b>
+  801f7e:	89 c2                	mov    %eax,%edx
+  801f80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f84:	83 c0 08             	add    $0x8,%eax
+  801f87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f8a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f8d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801f92:	eb 7c                	jmp    802010 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f97:	83 f8 2f             	cmp    $0x2f,%eax
+  801f9a:	77 15                	ja     801fb1 <vprintfmt+0x57d>
+  801f9c:	89 c2                	mov    %eax,%edx
+  801f9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa2:	83 c0 08             	add    $0x8,%eax
+  801fa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801faa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801faf:	eb 5f                	jmp    802010 <vprintfmt+0x5dc>
+  801fb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fbd:	eb e9                	jmp    801fa8 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801fbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fcb:	eb bd                	jmp    801f8a <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801fcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fd9:	e9 57 ff ff ff       	jmp    801f35 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801fde:	4c 89 ee             	mov    %r13,%rsi
+  801fe1:	bf 30 00 00 00       	mov    $0x30,%edi
+  801fe6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801fe9:	4c 89 ee             	mov    %r13,%rsi
+  801fec:	bf 78 00 00 00       	mov    $0x78,%edi
+  801ff1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801ff4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ff7:	83 f8 2f             	cmp    $0x2f,%eax
+  801ffa:	77 47                	ja     802043 <vprintfmt+0x60f>
+  801ffc:	89 c2                	mov    %eax,%edx
+  801ffe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802002:	83 c0 08             	add    $0x8,%eax
+  802005:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802008:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80200b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802010:	48 83 ec 08          	sub    $0x8,%rsp
+  802014:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802018:	0f 94 c0             	sete   %al
+  80201b:	0f b6 c0             	movzbl %al,%eax
+  80201e:	50                   	push   %rax
+  80201f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802024:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802028:	4c 89 ee             	mov    %r13,%rsi
+  80202b:	4c 89 f7             	mov    %r14,%rdi
+  80202e:	48 b8 29 19 80 00 00 	movabs $0x801929,%rax
+  802035:	00 00 00 
+  802038:	ff d0                	call   *%rax
+            break;
+  80203a:	48 83 c4 10          	add    $0x10,%rsp
+  80203e:	e9 31 fa ff ff       	jmp    801a74 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802043:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802047:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80204b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80204f:	eb b7                	jmp    802008 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802051:	40 84 f6             	test   %sil,%sil
+  802054:	75 2b                	jne    802081 <vprintfmt+0x64d>
+    switch (lflag) {
+  802056:	85 d2                	test   %edx,%edx
+  802058:	7f 56                	jg     8020b0 <vprintfmt+0x67c>
+  80205a:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80205d:	7d 77                	jge    8020d6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80205f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802062:	83 f8 2f             	cmp    $0x2f,%eax
+  802065:	0f 87 a7 00 00 00    	ja     802112 <vprintfmt+0x6de>
+  80206b:	89 c2                	mov    %eax,%edx
+  80206d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802071:	83 c0 08             	add    $0x8,%eax
+  802074:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802077:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80207a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80207f:	eb 8f                	jmp    802010 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802081:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802084:	83 f8 2f             	cmp    $0x2f,%eax
+  802087:	77 19                	ja     8020a2 <vprintfmt+0x66e>
+  802089:	89 c2                	mov    %eax,%edx
+  80208b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80208f:	83 c0 08             	add    $0x8,%eax
+  802092:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802095:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802098:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80209d:	e9 6e ff ff ff       	jmp    802010 <vprintfmt+0x5dc>
+  8020a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020ae:	eb e5                	jmp    802095 <vprintfmt+0x661>
+    switch (lflag) {
+  8020b0:	83 fa 01             	cmp    $0x1,%edx
+  8020b3:	75 aa                	jne    80205f <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8020b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8020bb:	77 47                	ja     802104 <vprintfmt+0x6d0>
+  8020bd:	89 c2                	mov    %eax,%edx
+  8020bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020c3:	83 c0 08             	add    $0x8,%eax
+  8020c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020c9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8020cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8020d1:	e9 3a ff ff ff       	jmp    802010 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8020d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8020dc:	77 18                	ja     8020f6 <vprintfmt+0x6c2>
+  8020de:	89 c2                	mov    %eax,%edx
+  8020e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e4:	83 c0 08             	add    $0x8,%eax
+  8020e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ea:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8020ec:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8020f1:	e9 1a ff ff ff       	jmp    802010 <vprintfmt+0x5dc>
+  8020f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802102:	eb e6                	jmp    8020ea <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802104:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802108:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80210c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802110:	eb b7                	jmp    8020c9 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802112:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802116:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80211a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80211e:	e9 54 ff ff ff       	jmp    802077 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802123:	4c 89 ee             	mov    %r13,%rsi
+  802126:	bf 25 00 00 00       	mov    $0x25,%edi
+  80212b:	41 ff d6             	call   *%r14
+            break;
+  80212e:	e9 41 f9 ff ff       	jmp    801a74 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802133:	4c 89 ee             	mov    %r13,%rsi
+  802136:	bf 25 00 00 00       	mov    $0x25,%edi
+  80213b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80213e:	48 83 eb 01          	sub    $0x1,%rbx
+  802142:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802146:	75 f6                	jne    80213e <vprintfmt+0x70a>
+  802148:	e9 27 f9 ff ff       	jmp    801a74 <vprintfmt+0x40>
+
+000000000080214d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80214d:	55                   	push   %rbp
+  80214e:	48 89 e5             	mov    %rsp,%rbp
+  802151:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802155:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802159:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80215e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802162:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802169:	48 85 ff             	test   %rdi,%rdi
+  80216c:	74 2b                	je     802199 <vsnprintf+0x4c>
+  80216e:	48 85 f6             	test   %rsi,%rsi
+  802171:	74 26                	je     802199 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802173:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802177:	48 bf df 19 80 00 00 	movabs $0x8019df,%rdi
+  80217e:	00 00 00 
+  802181:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80218d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802191:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802194:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802199:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80219e:	eb f7                	jmp    802197 <vsnprintf+0x4a>
+
+00000000008021a0 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8021a0:	55                   	push   %rbp
+  8021a1:	48 89 e5             	mov    %rsp,%rbp
+  8021a4:	48 83 ec 50          	sub    $0x50,%rsp
+  8021a8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021ac:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8021b0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8021b4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8021bb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8021bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021c3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8021c7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8021cb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8021cf:	48 b8 4d 21 80 00 00 	movabs $0x80214d,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8021db:	c9                   	leave
+  8021dc:	c3                   	ret
+
+00000000008021dd <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8021dd:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8021e0:	74 10                	je     8021f2 <strlen+0x15>
+    size_t n = 0;
+  8021e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8021e7:	48 83 c0 01          	add    $0x1,%rax
+  8021eb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8021ef:	75 f6                	jne    8021e7 <strlen+0xa>
+  8021f1:	c3                   	ret
+    size_t n = 0;
+  8021f2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8021f7:	c3                   	ret
+
+00000000008021f8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8021f8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8021fb:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802200:	48 85 f6             	test   %rsi,%rsi
+  802203:	74 11                	je     802216 <strnlen+0x1e>
+  802205:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802209:	74 0c                	je     802217 <strnlen+0x1f>
+  80220b:	48 83 c2 01          	add    $0x1,%rdx
+  80220f:	48 39 d0             	cmp    %rdx,%rax
+  802212:	75 f1                	jne    802205 <strnlen+0xd>
+  802214:	eb 04                	jmp    80221a <strnlen+0x22>
+  802216:	c3                   	ret
+  802217:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80221a:	c3                   	ret
+
+000000000080221b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80221b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80221e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802223:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802227:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80222a:	48 83 c2 01          	add    $0x1,%rdx
+  80222e:	84 c9                	test   %cl,%cl
+  802230:	75 f1                	jne    802223 <strcpy+0x8>
+        ;
+    return res;
+}
+  802232:	c3                   	ret
+
+0000000000802233 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802233:	55                   	push   %rbp
+  802234:	48 89 e5             	mov    %rsp,%rbp
+  802237:	41 54                	push   %r12
+  802239:	53                   	push   %rbx
+  80223a:	48 89 fb             	mov    %rdi,%rbx
+  80223d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802240:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80224c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802250:	4c 89 e6             	mov    %r12,%rsi
+  802253:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80225a:	00 00 00 
+  80225d:	ff d0                	call   *%rax
+    return dst;
+}
+  80225f:	48 89 d8             	mov    %rbx,%rax
+  802262:	5b                   	pop    %rbx
+  802263:	41 5c                	pop    %r12
+  802265:	5d                   	pop    %rbp
+  802266:	c3                   	ret
+
+0000000000802267 <toupper>:
+
+int
+toupper(int ch) {
+  802267:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802269:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80226c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80226f:	83 f9 1a             	cmp    $0x1a,%ecx
+  802272:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802275:	c3                   	ret
+
+0000000000802276 <tolower>:
+
+int
+tolower(int ch) {
+  802276:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802278:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80227b:	8d 57 20             	lea    0x20(%rdi),%edx
+  80227e:	83 f9 1a             	cmp    $0x1a,%ecx
+  802281:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802284:	c3                   	ret
+
+0000000000802285 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802285:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802288:	48 85 d2             	test   %rdx,%rdx
+  80228b:	74 1f                	je     8022ac <strncpy+0x27>
+  80228d:	48 01 fa             	add    %rdi,%rdx
+  802290:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802293:	48 83 c1 01          	add    $0x1,%rcx
+  802297:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80229b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80229f:	41 80 f8 01          	cmp    $0x1,%r8b
+  8022a3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8022a7:	48 39 ca             	cmp    %rcx,%rdx
+  8022aa:	75 e7                	jne    802293 <strncpy+0xe>
+    }
+    return ret;
+}
+  8022ac:	c3                   	ret
+
+00000000008022ad <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8022ad:	48 89 f8             	mov    %rdi,%rax
+  8022b0:	48 85 d2             	test   %rdx,%rdx
+  8022b3:	74 24                	je     8022d9 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8022b5:	48 83 ea 01          	sub    $0x1,%rdx
+  8022b9:	74 1b                	je     8022d6 <strlcpy+0x29>
+  8022bb:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8022bf:	0f b6 16             	movzbl (%rsi),%edx
+  8022c2:	84 d2                	test   %dl,%dl
+  8022c4:	74 10                	je     8022d6 <strlcpy+0x29>
+            *dst++ = *src++;
+  8022c6:	48 83 c6 01          	add    $0x1,%rsi
+  8022ca:	48 83 c0 01          	add    $0x1,%rax
+  8022ce:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8022d1:	48 39 c8             	cmp    %rcx,%rax
+  8022d4:	75 e9                	jne    8022bf <strlcpy+0x12>
+        *dst = '\0';
+  8022d6:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8022d9:	48 29 f8             	sub    %rdi,%rax
+}
+  8022dc:	c3                   	ret
+
+00000000008022dd <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8022dd:	0f b6 07             	movzbl (%rdi),%eax
+  8022e0:	84 c0                	test   %al,%al
+  8022e2:	74 13                	je     8022f7 <strcmp+0x1a>
+  8022e4:	38 06                	cmp    %al,(%rsi)
+  8022e6:	75 0f                	jne    8022f7 <strcmp+0x1a>
+  8022e8:	48 83 c7 01          	add    $0x1,%rdi
+  8022ec:	48 83 c6 01          	add    $0x1,%rsi
+  8022f0:	0f b6 07             	movzbl (%rdi),%eax
+  8022f3:	84 c0                	test   %al,%al
+  8022f5:	75 ed                	jne    8022e4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022f7:	0f b6 c0             	movzbl %al,%eax
+  8022fa:	0f b6 16             	movzbl (%rsi),%edx
+  8022fd:	29 d0                	sub    %edx,%eax
+}
+  8022ff:	c3                   	ret
+
+0000000000802300 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802300:	48 85 d2             	test   %rdx,%rdx
+  802303:	74 1f                	je     802324 <strncmp+0x24>
+  802305:	0f b6 07             	movzbl (%rdi),%eax
+  802308:	84 c0                	test   %al,%al
+  80230a:	74 1e                	je     80232a <strncmp+0x2a>
+  80230c:	3a 06                	cmp    (%rsi),%al
+  80230e:	75 1a                	jne    80232a <strncmp+0x2a>
+  802310:	48 83 c7 01          	add    $0x1,%rdi
+  802314:	48 83 c6 01          	add    $0x1,%rsi
+  802318:	48 83 ea 01          	sub    $0x1,%rdx
+  80231c:	75 e7                	jne    802305 <strncmp+0x5>
+
+    if (!n) return 0;
+  80231e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802323:	c3                   	ret
+  802324:	b8 00 00 00 00       	mov    $0x0,%eax
+  802329:	c3                   	ret
+  80232a:	48 85 d2             	test   %rdx,%rdx
+  80232d:	74 09                	je     802338 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80232f:	0f b6 07             	movzbl (%rdi),%eax
+  802332:	0f b6 16             	movzbl (%rsi),%edx
+  802335:	29 d0                	sub    %edx,%eax
+  802337:	c3                   	ret
+    if (!n) return 0;
+  802338:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80233d:	c3                   	ret
+
+000000000080233e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80233e:	0f b6 17             	movzbl (%rdi),%edx
+  802341:	84 d2                	test   %dl,%dl
+  802343:	74 18                	je     80235d <strchr+0x1f>
+        if (*str == c) {
+  802345:	0f be d2             	movsbl %dl,%edx
+  802348:	39 f2                	cmp    %esi,%edx
+  80234a:	74 17                	je     802363 <strchr+0x25>
+    for (; *str; str++) {
+  80234c:	48 83 c7 01          	add    $0x1,%rdi
+  802350:	0f b6 17             	movzbl (%rdi),%edx
+  802353:	84 d2                	test   %dl,%dl
+  802355:	75 ee                	jne    802345 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235c:	c3                   	ret
+  80235d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802362:	c3                   	ret
+  802363:	48 89 f8             	mov    %rdi,%rax
+}
+  802366:	c3                   	ret
+
+0000000000802367 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802367:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80236a:	0f b6 17             	movzbl (%rdi),%edx
+  80236d:	84 d2                	test   %dl,%dl
+  80236f:	74 13                	je     802384 <strfind+0x1d>
+  802371:	0f be d2             	movsbl %dl,%edx
+  802374:	39 f2                	cmp    %esi,%edx
+  802376:	74 0b                	je     802383 <strfind+0x1c>
+  802378:	48 83 c0 01          	add    $0x1,%rax
+  80237c:	0f b6 10             	movzbl (%rax),%edx
+  80237f:	84 d2                	test   %dl,%dl
+  802381:	75 ee                	jne    802371 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802383:	c3                   	ret
+  802384:	c3                   	ret
+
+0000000000802385 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802385:	48 39 f7             	cmp    %rsi,%rdi
+  802388:	74 65                	je     8023ef <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80238a:	55                   	push   %rbp
+  80238b:	48 89 e5             	mov    %rsp,%rbp
+  80238e:	41 57                	push   %r15
+  802390:	41 56                	push   %r14
+  802392:	41 55                	push   %r13
+  802394:	41 54                	push   %r12
+  802396:	53                   	push   %rbx
+  802397:	48 83 ec 18          	sub    $0x18,%rsp
+  80239b:	48 89 fb             	mov    %rdi,%rbx
+  80239e:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8023a1:	49 bf 76 22 80 00 00 	movabs $0x802276,%r15
+  8023a8:	00 00 00 
+  8023ab:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8023af:	41 0f b6 fd          	movzbl %r13b,%edi
+  8023b3:	41 ff d7             	call   *%r15
+  8023b6:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8023b9:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8023be:	41 0f b6 fe          	movzbl %r14b,%edi
+  8023c2:	41 ff d7             	call   *%r15
+  8023c5:	89 c2                	mov    %eax,%edx
+  8023c7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8023ca:	29 d0                	sub    %edx,%eax
+  8023cc:	75 12                	jne    8023e0 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8023ce:	48 83 c3 01          	add    $0x1,%rbx
+  8023d2:	45 84 ed             	test   %r13b,%r13b
+  8023d5:	74 09                	je     8023e0 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8023d7:	49 83 c4 01          	add    $0x1,%r12
+  8023db:	45 84 f6             	test   %r14b,%r14b
+  8023de:	75 cb                	jne    8023ab <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8023e0:	48 83 c4 18          	add    $0x18,%rsp
+  8023e4:	5b                   	pop    %rbx
+  8023e5:	41 5c                	pop    %r12
+  8023e7:	41 5d                	pop    %r13
+  8023e9:	41 5e                	pop    %r14
+  8023eb:	41 5f                	pop    %r15
+  8023ed:	5d                   	pop    %rbp
+  8023ee:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023f4:	c3                   	ret
+
+00000000008023f5 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8023f5:	48 39 f7             	cmp    %rsi,%rdi
+  8023f8:	74 7d                	je     802477 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8023fa:	55                   	push   %rbp
+  8023fb:	48 89 e5             	mov    %rsp,%rbp
+  8023fe:	41 57                	push   %r15
+  802400:	41 56                	push   %r14
+  802402:	41 55                	push   %r13
+  802404:	41 54                	push   %r12
+  802406:	53                   	push   %rbx
+  802407:	48 83 ec 18          	sub    $0x18,%rsp
+  80240b:	48 89 fb             	mov    %rdi,%rbx
+  80240e:	49 89 f4             	mov    %rsi,%r12
+  802411:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802415:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802419:	49 bf 76 22 80 00 00 	movabs $0x802276,%r15
+  802420:	00 00 00 
+    while (n--) {
+  802423:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802427:	48 39 c3             	cmp    %rax,%rbx
+  80242a:	74 37                	je     802463 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80242c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802430:	41 0f b6 fd          	movzbl %r13b,%edi
+  802434:	41 ff d7             	call   *%r15
+  802437:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80243a:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80243f:	41 0f b6 fe          	movzbl %r14b,%edi
+  802443:	41 ff d7             	call   *%r15
+  802446:	89 c2                	mov    %eax,%edx
+  802448:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80244b:	29 d0                	sub    %edx,%eax
+  80244d:	75 19                	jne    802468 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80244f:	48 83 c3 01          	add    $0x1,%rbx
+  802453:	45 84 ed             	test   %r13b,%r13b
+  802456:	74 10                	je     802468 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802458:	49 83 c4 01          	add    $0x1,%r12
+  80245c:	45 84 f6             	test   %r14b,%r14b
+  80245f:	75 c2                	jne    802423 <strncasecmp+0x2e>
+  802461:	eb 05                	jmp    802468 <strncasecmp+0x73>
+  802463:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802468:	48 83 c4 18          	add    $0x18,%rsp
+  80246c:	5b                   	pop    %rbx
+  80246d:	41 5c                	pop    %r12
+  80246f:	41 5d                	pop    %r13
+  802471:	41 5e                	pop    %r14
+  802473:	41 5f                	pop    %r15
+  802475:	5d                   	pop    %rbp
+  802476:	c3                   	ret
+    if (p1 == p2) return 0;
+  802477:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247c:	c3                   	ret
+
+000000000080247d <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80247d:	83 e7 df             	and    $0xffffffdf,%edi
+  802480:	83 ef 41             	sub    $0x41,%edi
+  802483:	83 ff 19             	cmp    $0x19,%edi
+  802486:	0f 96 c0             	setbe  %al
+}
+  802489:	c3                   	ret
+
+000000000080248a <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80248a:	83 ff 20             	cmp    $0x20,%edi
+  80248d:	0f 94 c0             	sete   %al
+  802490:	83 ff 09             	cmp    $0x9,%edi
+  802493:	0f 94 c2             	sete   %dl
+  802496:	09 d0                	or     %edx,%eax
+}
+  802498:	c3                   	ret
+
+0000000000802499 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802499:	55                   	push   %rbp
+  80249a:	48 89 e5             	mov    %rsp,%rbp
+  80249d:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80249f:	48 bf bf 6c 80 00 00 	movabs $0x806cbf,%rdi
+  8024a6:	00 00 00 
+  8024a9:	48 b8 3e 23 80 00 00 	movabs $0x80233e,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+  8024b5:	48 85 c0             	test   %rax,%rax
+  8024b8:	0f 95 c0             	setne  %al
+}
+  8024bb:	5d                   	pop    %rbp
+  8024bc:	c3                   	ret
+
+00000000008024bd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8024bd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8024c0:	48 89 f8             	mov    %rdi,%rax
+  8024c3:	48 f7 d8             	neg    %rax
+  8024c6:	83 e0 07             	and    $0x7,%eax
+  8024c9:	49 89 d1             	mov    %rdx,%r9
+  8024cc:	49 29 c1             	sub    %rax,%r9
+  8024cf:	78 36                	js     802507 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8024d1:	40 0f b6 c6          	movzbl %sil,%eax
+  8024d5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8024dc:	01 01 01 
+  8024df:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8024e3:	40 f6 c7 07          	test   $0x7,%dil
+  8024e7:	75 38                	jne    802521 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8024e9:	4c 89 c9             	mov    %r9,%rcx
+  8024ec:	48 c1 f9 03          	sar    $0x3,%rcx
+  8024f0:	74 0c                	je     8024fe <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8024f2:	fc                   	cld
+  8024f3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8024f6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8024fa:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8024fe:	4d 85 c9             	test   %r9,%r9
+  802501:	75 45                	jne    802548 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802503:	4c 89 c0             	mov    %r8,%rax
+  802506:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802507:	48 85 d2             	test   %rdx,%rdx
+  80250a:	74 f7                	je     802503 <memset+0x46>
+  80250c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80250f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802512:	48 83 c0 01          	add    $0x1,%rax
+  802516:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80251a:	48 39 c2             	cmp    %rax,%rdx
+  80251d:	75 f3                	jne    802512 <memset+0x55>
+  80251f:	eb e2                	jmp    802503 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802521:	40 f6 c7 01          	test   $0x1,%dil
+  802525:	74 06                	je     80252d <memset+0x70>
+  802527:	88 07                	mov    %al,(%rdi)
+  802529:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80252d:	40 f6 c7 02          	test   $0x2,%dil
+  802531:	74 07                	je     80253a <memset+0x7d>
+  802533:	66 89 07             	mov    %ax,(%rdi)
+  802536:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80253a:	40 f6 c7 04          	test   $0x4,%dil
+  80253e:	74 a9                	je     8024e9 <memset+0x2c>
+  802540:	89 07                	mov    %eax,(%rdi)
+  802542:	48 83 c7 04          	add    $0x4,%rdi
+  802546:	eb a1                	jmp    8024e9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802548:	41 f6 c1 04          	test   $0x4,%r9b
+  80254c:	74 06                	je     802554 <memset+0x97>
+  80254e:	89 07                	mov    %eax,(%rdi)
+  802550:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802554:	41 f6 c1 02          	test   $0x2,%r9b
+  802558:	74 07                	je     802561 <memset+0xa4>
+  80255a:	66 89 07             	mov    %ax,(%rdi)
+  80255d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802561:	41 f6 c1 01          	test   $0x1,%r9b
+  802565:	74 9c                	je     802503 <memset+0x46>
+  802567:	88 07                	mov    %al,(%rdi)
+  802569:	eb 98                	jmp    802503 <memset+0x46>
+
+000000000080256b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80256b:	48 89 f8             	mov    %rdi,%rax
+  80256e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802571:	48 39 fe             	cmp    %rdi,%rsi
+  802574:	73 3b                	jae    8025b1 <memmove+0x46>
+  802576:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80257a:	48 39 d7             	cmp    %rdx,%rdi
+  80257d:	73 32                	jae    8025b1 <memmove+0x46>
+        s += n;
+        d += n;
+  80257f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802583:	48 89 d6             	mov    %rdx,%rsi
+  802586:	48 09 fe             	or     %rdi,%rsi
+  802589:	48 09 ce             	or     %rcx,%rsi
+  80258c:	40 f6 c6 07          	test   $0x7,%sil
+  802590:	75 12                	jne    8025a4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802592:	48 83 ef 08          	sub    $0x8,%rdi
+  802596:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80259a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80259e:	fd                   	std
+  80259f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8025a2:	fc                   	cld
+  8025a3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8025a4:	48 83 ef 01          	sub    $0x1,%rdi
+  8025a8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8025ac:	fd                   	std
+  8025ad:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8025af:	eb f1                	jmp    8025a2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8025b1:	48 89 f2             	mov    %rsi,%rdx
+  8025b4:	48 09 c2             	or     %rax,%rdx
+  8025b7:	48 09 ca             	or     %rcx,%rdx
+  8025ba:	f6 c2 07             	test   $0x7,%dl
+  8025bd:	75 0c                	jne    8025cb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8025bf:	48 c1 e9 03          	shr    $0x3,%rcx
+  8025c3:	48 89 c7             	mov    %rax,%rdi
+  8025c6:	fc                   	cld
+  8025c7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8025ca:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8025cb:	48 89 c7             	mov    %rax,%rdi
+  8025ce:	fc                   	cld
+  8025cf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8025d1:	c3                   	ret
+
+00000000008025d2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8025d2:	55                   	push   %rbp
+  8025d3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8025d6:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  8025dd:	00 00 00 
+  8025e0:	ff d0                	call   *%rax
+}
+  8025e2:	5d                   	pop    %rbp
+  8025e3:	c3                   	ret
+
+00000000008025e4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8025e4:	55                   	push   %rbp
+  8025e5:	48 89 e5             	mov    %rsp,%rbp
+  8025e8:	41 57                	push   %r15
+  8025ea:	41 56                	push   %r14
+  8025ec:	41 55                	push   %r13
+  8025ee:	41 54                	push   %r12
+  8025f0:	53                   	push   %rbx
+  8025f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f5:	49 89 fe             	mov    %rdi,%r14
+  8025f8:	49 89 f7             	mov    %rsi,%r15
+  8025fb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8025fe:	48 89 f7             	mov    %rsi,%rdi
+  802601:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  802608:	00 00 00 
+  80260b:	ff d0                	call   *%rax
+  80260d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802610:	48 89 de             	mov    %rbx,%rsi
+  802613:	4c 89 f7             	mov    %r14,%rdi
+  802616:	48 b8 f8 21 80 00 00 	movabs $0x8021f8,%rax
+  80261d:	00 00 00 
+  802620:	ff d0                	call   *%rax
+  802622:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802625:	48 39 c3             	cmp    %rax,%rbx
+  802628:	74 36                	je     802660 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80262a:	48 89 d8             	mov    %rbx,%rax
+  80262d:	4c 29 e8             	sub    %r13,%rax
+  802630:	49 39 c4             	cmp    %rax,%r12
+  802633:	73 31                	jae    802666 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802635:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80263a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80263e:	4c 89 fe             	mov    %r15,%rsi
+  802641:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  802648:	00 00 00 
+  80264b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80264d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802651:	48 83 c4 08          	add    $0x8,%rsp
+  802655:	5b                   	pop    %rbx
+  802656:	41 5c                	pop    %r12
+  802658:	41 5d                	pop    %r13
+  80265a:	41 5e                	pop    %r14
+  80265c:	41 5f                	pop    %r15
+  80265e:	5d                   	pop    %rbp
+  80265f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802660:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802664:	eb eb                	jmp    802651 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802666:	48 83 eb 01          	sub    $0x1,%rbx
+  80266a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80266e:	48 89 da             	mov    %rbx,%rdx
+  802671:	4c 89 fe             	mov    %r15,%rsi
+  802674:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  80267b:	00 00 00 
+  80267e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802680:	49 01 de             	add    %rbx,%r14
+  802683:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802688:	eb c3                	jmp    80264d <strlcat+0x69>
+
+000000000080268a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80268a:	48 85 d2             	test   %rdx,%rdx
+  80268d:	74 2d                	je     8026bc <memcmp+0x32>
+  80268f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802694:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802698:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80269d:	44 38 c1             	cmp    %r8b,%cl
+  8026a0:	75 0f                	jne    8026b1 <memcmp+0x27>
+    while (n-- > 0) {
+  8026a2:	48 83 c0 01          	add    $0x1,%rax
+  8026a6:	48 39 c2             	cmp    %rax,%rdx
+  8026a9:	75 e9                	jne    802694 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8026b1:	0f b6 c1             	movzbl %cl,%eax
+  8026b4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8026b8:	44 29 c0             	sub    %r8d,%eax
+  8026bb:	c3                   	ret
+    return 0;
+  8026bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c1:	c3                   	ret
+
+00000000008026c2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8026c2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8026c6:	48 39 c7             	cmp    %rax,%rdi
+  8026c9:	73 0f                	jae    8026da <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8026cb:	40 38 37             	cmp    %sil,(%rdi)
+  8026ce:	74 0e                	je     8026de <memfind+0x1c>
+    for (; src < end; src++) {
+  8026d0:	48 83 c7 01          	add    $0x1,%rdi
+  8026d4:	48 39 f8             	cmp    %rdi,%rax
+  8026d7:	75 f2                	jne    8026cb <memfind+0x9>
+  8026d9:	c3                   	ret
+  8026da:	48 89 f8             	mov    %rdi,%rax
+  8026dd:	c3                   	ret
+  8026de:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8026e1:	c3                   	ret
+
+00000000008026e2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8026e2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8026e5:	0f b6 37             	movzbl (%rdi),%esi
+  8026e8:	40 80 fe 20          	cmp    $0x20,%sil
+  8026ec:	74 06                	je     8026f4 <strtol+0x12>
+  8026ee:	40 80 fe 09          	cmp    $0x9,%sil
+  8026f2:	75 13                	jne    802707 <strtol+0x25>
+  8026f4:	48 83 c7 01          	add    $0x1,%rdi
+  8026f8:	0f b6 37             	movzbl (%rdi),%esi
+  8026fb:	40 80 fe 20          	cmp    $0x20,%sil
+  8026ff:	74 f3                	je     8026f4 <strtol+0x12>
+  802701:	40 80 fe 09          	cmp    $0x9,%sil
+  802705:	74 ed                	je     8026f4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802707:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80270a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80270d:	3c 01                	cmp    $0x1,%al
+  80270f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802713:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802719:	75 0f                	jne    80272a <strtol+0x48>
+  80271b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80271e:	74 14                	je     802734 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802720:	85 d2                	test   %edx,%edx
+  802722:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802727:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80272a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80272f:	4c 63 ca             	movslq %edx,%r9
+  802732:	eb 36                	jmp    80276a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802734:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802738:	74 0f                	je     802749 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80273a:	85 d2                	test   %edx,%edx
+  80273c:	75 ec                	jne    80272a <strtol+0x48>
+        s++;
+  80273e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802742:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802747:	eb e1                	jmp    80272a <strtol+0x48>
+        s += 2;
+  802749:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80274d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802752:	eb d6                	jmp    80272a <strtol+0x48>
+            dig -= '0';
+  802754:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802757:	44 0f b6 c1          	movzbl %cl,%r8d
+  80275b:	41 39 d0             	cmp    %edx,%r8d
+  80275e:	7d 21                	jge    802781 <strtol+0x9f>
+        val = val * base + dig;
+  802760:	49 0f af c1          	imul   %r9,%rax
+  802764:	0f b6 c9             	movzbl %cl,%ecx
+  802767:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80276a:	48 83 c7 01          	add    $0x1,%rdi
+  80276e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802772:	80 f9 39             	cmp    $0x39,%cl
+  802775:	76 dd                	jbe    802754 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802777:	80 f9 7b             	cmp    $0x7b,%cl
+  80277a:	77 05                	ja     802781 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80277c:	83 e9 57             	sub    $0x57,%ecx
+  80277f:	eb d6                	jmp    802757 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802781:	4d 85 d2             	test   %r10,%r10
+  802784:	74 03                	je     802789 <strtol+0xa7>
+  802786:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802789:	48 89 c2             	mov    %rax,%rdx
+  80278c:	48 f7 da             	neg    %rdx
+  80278f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802793:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802797:	c3                   	ret
+
+0000000000802798 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802798:	55                   	push   %rbp
+  802799:	48 89 e5             	mov    %rsp,%rbp
+  80279c:	53                   	push   %rbx
+  80279d:	48 89 fa             	mov    %rdi,%rdx
+  8027a0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027c3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8027c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027c9:	c9                   	leave
+  8027ca:	c3                   	ret
+
+00000000008027cb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8027cb:	55                   	push   %rbp
+  8027cc:	48 89 e5             	mov    %rsp,%rbp
+  8027cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027d0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027fa:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+0000000000802802 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	53                   	push   %rbx
+  802807:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80280a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80280f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802814:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802819:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80281e:	be 00 00 00 00       	mov    $0x0,%esi
+  802823:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802829:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80282f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802831:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802835:	c9                   	leave
+  802836:	c3                   	ret
+
+0000000000802837 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802837:	55                   	push   %rbp
+  802838:	48 89 e5             	mov    %rsp,%rbp
+  80283b:	53                   	push   %rbx
+  80283c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802840:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802843:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802848:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80284d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802852:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802857:	be 00 00 00 00       	mov    $0x0,%esi
+  80285c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802862:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802868:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80286a:	48 85 c0             	test   %rax,%rax
+  80286d:	7f 06                	jg     802875 <sys_env_destroy+0x3e>
+}
+  80286f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802875:	49 89 c0             	mov    %rax,%r8
+  802878:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80287d:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802884:	00 00 00 
+  802887:	be 27 00 00 00       	mov    $0x27,%esi
+  80288c:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802893:	00 00 00 
+  802896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289b:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  8028a2:	00 00 00 
+  8028a5:	41 ff d1             	call   *%r9
+
+00000000008028a8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8028a8:	55                   	push   %rbp
+  8028a9:	48 89 e5             	mov    %rsp,%rbp
+  8028ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028ad:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028d7:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028dd:	c9                   	leave
+  8028de:	c3                   	ret
+
+00000000008028df <sys_yield>:
+
+void
+sys_yield(void) {
+  8028df:	55                   	push   %rbp
+  8028e0:	48 89 e5             	mov    %rsp,%rbp
+  8028e3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802902:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802908:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80290e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802910:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802914:	c9                   	leave
+  802915:	c3                   	ret
+
+0000000000802916 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802916:	55                   	push   %rbp
+  802917:	48 89 e5             	mov    %rsp,%rbp
+  80291a:	53                   	push   %rbx
+  80291b:	48 89 fa             	mov    %rdi,%rdx
+  80291e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802921:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802926:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80292d:	00 00 00 
+  802930:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802935:	be 00 00 00 00       	mov    $0x0,%esi
+  80293a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802940:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802946:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802948:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80294c:	c9                   	leave
+  80294d:	c3                   	ret
+
+000000000080294e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80294e:	55                   	push   %rbp
+  80294f:	48 89 e5             	mov    %rsp,%rbp
+  802952:	53                   	push   %rbx
+  802953:	49 89 f8             	mov    %rdi,%r8
+  802956:	48 89 d3             	mov    %rdx,%rbx
+  802959:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80295c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802961:	4c 89 c2             	mov    %r8,%rdx
+  802964:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802967:	be 00 00 00 00       	mov    $0x0,%esi
+  80296c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802972:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802978:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80297a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80297e:	c9                   	leave
+  80297f:	c3                   	ret
+
+0000000000802980 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802980:	55                   	push   %rbp
+  802981:	48 89 e5             	mov    %rsp,%rbp
+  802984:	53                   	push   %rbx
+  802985:	48 83 ec 08          	sub    $0x8,%rsp
+  802989:	89 f8                	mov    %edi,%eax
+  80298b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80298e:	48 63 f9             	movslq %ecx,%rdi
+  802991:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802994:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802999:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80299c:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029af:	48 85 c0             	test   %rax,%rax
+  8029b2:	7f 06                	jg     8029ba <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8029b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029b8:	c9                   	leave
+  8029b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029ba:	49 89 c0             	mov    %rax,%r8
+  8029bd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8029c2:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  8029c9:	00 00 00 
+  8029cc:	be 27 00 00 00       	mov    $0x27,%esi
+  8029d1:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  8029d8:	00 00 00 
+  8029db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e0:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  8029e7:	00 00 00 
+  8029ea:	41 ff d1             	call   *%r9
+
+00000000008029ed <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8029ed:	55                   	push   %rbp
+  8029ee:	48 89 e5             	mov    %rsp,%rbp
+  8029f1:	53                   	push   %rbx
+  8029f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f6:	89 f8                	mov    %edi,%eax
+  8029f8:	49 89 f2             	mov    %rsi,%r10
+  8029fb:	48 89 cf             	mov    %rcx,%rdi
+  8029fe:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802a01:	48 63 da             	movslq %edx,%rbx
+  802a04:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a07:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a0c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a0f:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802a12:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a18:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a1a:	48 85 c0             	test   %rax,%rax
+  802a1d:	7f 06                	jg     802a25 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802a1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a23:	c9                   	leave
+  802a24:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a25:	49 89 c0             	mov    %rax,%r8
+  802a28:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802a2d:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802a34:	00 00 00 
+  802a37:	be 27 00 00 00       	mov    $0x27,%esi
+  802a3c:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802a43:	00 00 00 
+  802a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4b:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802a52:	00 00 00 
+  802a55:	41 ff d1             	call   *%r9
+
+0000000000802a58 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802a58:	55                   	push   %rbp
+  802a59:	48 89 e5             	mov    %rsp,%rbp
+  802a5c:	53                   	push   %rbx
+  802a5d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a61:	48 89 f1             	mov    %rsi,%rcx
+  802a64:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802a67:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a6a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a74:	be 00 00 00 00       	mov    $0x0,%esi
+  802a79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a85:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a87:	48 85 c0             	test   %rax,%rax
+  802a8a:	7f 06                	jg     802a92 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802a8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a90:	c9                   	leave
+  802a91:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a92:	49 89 c0             	mov    %rax,%r8
+  802a95:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a9a:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802aa1:	00 00 00 
+  802aa4:	be 27 00 00 00       	mov    $0x27,%esi
+  802aa9:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802ab0:	00 00 00 
+  802ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab8:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802abf:	00 00 00 
+  802ac2:	41 ff d1             	call   *%r9
+
+0000000000802ac5 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802ac5:	55                   	push   %rbp
+  802ac6:	48 89 e5             	mov    %rsp,%rbp
+  802ac9:	53                   	push   %rbx
+  802aca:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802ace:	48 63 ce             	movslq %esi,%rcx
+  802ad1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ad4:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ad9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ade:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ae3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802af4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802af6:	48 85 c0             	test   %rax,%rax
+  802af9:	7f 06                	jg     802b01 <sys_env_set_status+0x3c>
+}
+  802afb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aff:	c9                   	leave
+  802b00:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b01:	49 89 c0             	mov    %rax,%r8
+  802b04:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802b09:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802b10:	00 00 00 
+  802b13:	be 27 00 00 00       	mov    $0x27,%esi
+  802b18:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802b1f:	00 00 00 
+  802b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b27:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802b2e:	00 00 00 
+  802b31:	41 ff d1             	call   *%r9
+
+0000000000802b34 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802b34:	55                   	push   %rbp
+  802b35:	48 89 e5             	mov    %rsp,%rbp
+  802b38:	53                   	push   %rbx
+  802b39:	48 83 ec 08          	sub    $0x8,%rsp
+  802b3d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802b40:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b43:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b52:	be 00 00 00 00       	mov    $0x0,%esi
+  802b57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b63:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b65:	48 85 c0             	test   %rax,%rax
+  802b68:	7f 06                	jg     802b70 <sys_env_set_trapframe+0x3c>
+}
+  802b6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b70:	49 89 c0             	mov    %rax,%r8
+  802b73:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802b78:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802b7f:	00 00 00 
+  802b82:	be 27 00 00 00       	mov    $0x27,%esi
+  802b87:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802b8e:	00 00 00 
+  802b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b96:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802b9d:	00 00 00 
+  802ba0:	41 ff d1             	call   *%r9
+
+0000000000802ba3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802ba3:	55                   	push   %rbp
+  802ba4:	48 89 e5             	mov    %rsp,%rbp
+  802ba7:	53                   	push   %rbx
+  802ba8:	48 83 ec 08          	sub    $0x8,%rsp
+  802bac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802baf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bb2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bbc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bc1:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bcc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bd2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bd4:	48 85 c0             	test   %rax,%rax
+  802bd7:	7f 06                	jg     802bdf <sys_env_set_pgfault_upcall+0x3c>
+}
+  802bd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bdf:	49 89 c0             	mov    %rax,%r8
+  802be2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802be7:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802bee:	00 00 00 
+  802bf1:	be 27 00 00 00       	mov    $0x27,%esi
+  802bf6:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802bfd:	00 00 00 
+  802c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c05:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802c0c:	00 00 00 
+  802c0f:	41 ff d1             	call   *%r9
+
+0000000000802c12 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802c12:	55                   	push   %rbp
+  802c13:	48 89 e5             	mov    %rsp,%rbp
+  802c16:	53                   	push   %rbx
+  802c17:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802c1b:	40 0f b6 ce          	movzbl %sil,%ecx
+  802c1f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c22:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c2c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c31:	be 00 00 00 00       	mov    $0x0,%esi
+  802c36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c3c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c42:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c44:	48 85 c0             	test   %rax,%rax
+  802c47:	7f 06                	jg     802c4f <sys_env_set_reclaim+0x3d>
+}
+  802c49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c4d:	c9                   	leave
+  802c4e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c4f:	49 89 c0             	mov    %rax,%r8
+  802c52:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802c57:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802c5e:	00 00 00 
+  802c61:	be 27 00 00 00       	mov    $0x27,%esi
+  802c66:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802c6d:	00 00 00 
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c75:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802c7c:	00 00 00 
+  802c7f:	41 ff d1             	call   *%r9
+
+0000000000802c82 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802c82:	55                   	push   %rbp
+  802c83:	48 89 e5             	mov    %rsp,%rbp
+  802c86:	53                   	push   %rbx
+  802c87:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802c8b:	48 63 ce             	movslq %esi,%rcx
+  802c8e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c91:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c9b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ca0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cb1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cb3:	48 85 c0             	test   %rax,%rax
+  802cb6:	7f 06                	jg     802cbe <sys_env_set_nice+0x3c>
+}
+  802cb8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cbc:	c9                   	leave
+  802cbd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cbe:	49 89 c0             	mov    %rax,%r8
+  802cc1:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802cc6:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802ccd:	00 00 00 
+  802cd0:	be 27 00 00 00       	mov    $0x27,%esi
+  802cd5:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802cdc:	00 00 00 
+  802cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce4:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802ceb:	00 00 00 
+  802cee:	41 ff d1             	call   *%r9
+
+0000000000802cf1 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802cf1:	55                   	push   %rbp
+  802cf2:	48 89 e5             	mov    %rsp,%rbp
+  802cf5:	53                   	push   %rbx
+  802cf6:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cf9:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cfe:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d08:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d1e:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802d20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d24:	c9                   	leave
+  802d25:	c3                   	ret
+
+0000000000802d26 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d26:	55                   	push   %rbp
+  802d27:	48 89 e5             	mov    %rsp,%rbp
+  802d2a:	53                   	push   %rbx
+  802d2b:	89 f8                	mov    %edi,%eax
+  802d2d:	49 89 f1             	mov    %rsi,%r9
+  802d30:	48 89 d3             	mov    %rdx,%rbx
+  802d33:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d36:	49 63 f0             	movslq %r8d,%rsi
+  802d39:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d3c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d41:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d4a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d50:	cd 30                	int    $0x30
+}
+  802d52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d56:	c9                   	leave
+  802d57:	c3                   	ret
+
+0000000000802d58 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d58:	55                   	push   %rbp
+  802d59:	48 89 e5             	mov    %rsp,%rbp
+  802d5c:	53                   	push   %rbx
+  802d5d:	89 f8                	mov    %edi,%eax
+  802d5f:	49 89 f1             	mov    %rsi,%r9
+  802d62:	48 89 d3             	mov    %rdx,%rbx
+  802d65:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d68:	49 63 f0             	movslq %r8d,%rsi
+  802d6b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d73:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d7c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d82:	cd 30                	int    $0x30
+}
+  802d84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d88:	c9                   	leave
+  802d89:	c3                   	ret
+
+0000000000802d8a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d8a:	55                   	push   %rbp
+  802d8b:	48 89 e5             	mov    %rsp,%rbp
+  802d8e:	53                   	push   %rbx
+  802d8f:	48 83 ec 08          	sub    $0x8,%rsp
+  802d93:	89 f8                	mov    %edi,%eax
+  802d95:	49 89 f2             	mov    %rsi,%r10
+  802d98:	48 89 d3             	mov    %rdx,%rbx
+  802d9b:	48 89 cf             	mov    %rcx,%rdi
+  802d9e:	44 89 c6             	mov    %r8d,%esi
+  802da1:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802da4:	48 63 f6             	movslq %esi,%rsi
+  802da7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802daa:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802daf:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802db2:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802db6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802db8:	48 85 c0             	test   %rax,%rax
+  802dbb:	7f 06                	jg     802dc3 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802dbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc1:	c9                   	leave
+  802dc2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dc3:	49 89 c0             	mov    %rax,%r8
+  802dc6:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802dcb:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802dd2:	00 00 00 
+  802dd5:	be 27 00 00 00       	mov    $0x27,%esi
+  802dda:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802de1:	00 00 00 
+  802de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de9:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802df0:	00 00 00 
+  802df3:	41 ff d1             	call   *%r9
+
+0000000000802df6 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802df6:	55                   	push   %rbp
+  802df7:	48 89 e5             	mov    %rsp,%rbp
+  802dfa:	53                   	push   %rbx
+  802dfb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dff:	48 89 f1             	mov    %rsi,%rcx
+  802e02:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802e05:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802e09:	48 8b 1a             	mov    (%rdx),%rbx
+  802e0c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e0f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e14:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e18:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802e1c:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802e20:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e22:	48 85 c0             	test   %rax,%rax
+  802e25:	7f 06                	jg     802e2d <sys_ipc_call_short+0x37>
+}
+  802e27:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e2b:	c9                   	leave
+  802e2c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e2d:	49 89 c0             	mov    %rax,%r8
+  802e30:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802e35:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802e3c:	00 00 00 
+  802e3f:	be 27 00 00 00       	mov    $0x27,%esi
+  802e44:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802e4b:	00 00 00 
+  802e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e53:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802e5a:	00 00 00 
+  802e5d:	41 ff d1             	call   *%r9
+
+0000000000802e60 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e60:	55                   	push   %rbp
+  802e61:	48 89 e5             	mov    %rsp,%rbp
+  802e64:	53                   	push   %rbx
+  802e65:	48 83 ec 08          	sub    $0x8,%rsp
+  802e69:	89 f8                	mov    %edi,%eax
+  802e6b:	49 89 f2             	mov    %rsi,%r10
+  802e6e:	48 89 d3             	mov    %rdx,%rbx
+  802e71:	48 89 cf             	mov    %rcx,%rdi
+  802e74:	44 89 c6             	mov    %r8d,%esi
+  802e77:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e7a:	48 63 f6             	movslq %esi,%rsi
+  802e7d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e80:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e85:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e88:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e8c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e8e:	48 85 c0             	test   %rax,%rax
+  802e91:	7f 06                	jg     802e99 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e97:	c9                   	leave
+  802e98:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e99:	49 89 c0             	mov    %rax,%r8
+  802e9c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802ea1:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802ea8:	00 00 00 
+  802eab:	be 27 00 00 00       	mov    $0x27,%esi
+  802eb0:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802eb7:	00 00 00 
+  802eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebf:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802ec6:	00 00 00 
+  802ec9:	41 ff d1             	call   *%r9
+
+0000000000802ecc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802ecc:	55                   	push   %rbp
+  802ecd:	48 89 e5             	mov    %rsp,%rbp
+  802ed0:	53                   	push   %rbx
+  802ed1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ed5:	48 89 fa             	mov    %rdi,%rdx
+  802ed8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802edb:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ee0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eea:	be 00 00 00 00       	mov    $0x0,%esi
+  802eef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ef5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802efb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802efd:	48 85 c0             	test   %rax,%rax
+  802f00:	7f 06                	jg     802f08 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f06:	c9                   	leave
+  802f07:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f08:	49 89 c0             	mov    %rax,%r8
+  802f0b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802f10:	48 ba c8 6c 80 00 00 	movabs $0x806cc8,%rdx
+  802f17:	00 00 00 
+  802f1a:	be 27 00 00 00       	mov    $0x27,%esi
+  802f1f:	48 bf e7 6c 80 00 00 	movabs $0x806ce7,%rdi
+  802f26:	00 00 00 
+  802f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2e:	49 b9 94 17 80 00 00 	movabs $0x801794,%r9
+  802f35:	00 00 00 
+  802f38:	41 ff d1             	call   *%r9
+
+0000000000802f3b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802f3b:	55                   	push   %rbp
+  802f3c:	48 89 e5             	mov    %rsp,%rbp
+  802f3f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f40:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f54:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f59:	be 00 00 00 00       	mov    $0x0,%esi
+  802f5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f64:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f6a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f70:	c9                   	leave
+  802f71:	c3                   	ret
+
+0000000000802f72 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802f72:	55                   	push   %rbp
+  802f73:	48 89 e5             	mov    %rsp,%rbp
+  802f76:	53                   	push   %rbx
+  802f77:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f7a:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f99:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f9f:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802fa1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fa5:	c9                   	leave
+  802fa6:	c3                   	ret
+
+0000000000802fa7 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802fa7:	55                   	push   %rbp
+  802fa8:	48 89 e5             	mov    %rsp,%rbp
+  802fab:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802fac:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fc0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fc5:	be 00 00 00 00       	mov    $0x0,%esi
+  802fca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fd0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fd6:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802fd8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fdc:	c9                   	leave
+  802fdd:	c3                   	ret
+
+0000000000802fde <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fde:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802fe5:	ff ff ff 
+  802fe8:	48 01 f8             	add    %rdi,%rax
+  802feb:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802fef:	c3                   	ret
+
+0000000000802ff0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ff0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802ff7:	ff ff ff 
+  802ffa:	48 01 f8             	add    %rdi,%rax
+  802ffd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803001:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803007:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80300b:	c3                   	ret
+
+000000000080300c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80300c:	55                   	push   %rbp
+  80300d:	48 89 e5             	mov    %rsp,%rbp
+  803010:	41 57                	push   %r15
+  803012:	41 56                	push   %r14
+  803014:	41 55                	push   %r13
+  803016:	41 54                	push   %r12
+  803018:	53                   	push   %rbx
+  803019:	48 83 ec 08          	sub    $0x8,%rsp
+  80301d:	49 89 ff             	mov    %rdi,%r15
+  803020:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803025:	49 bd e7 4d 80 00 00 	movabs $0x804de7,%r13
+  80302c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80302f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803035:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803038:	48 89 df             	mov    %rbx,%rdi
+  80303b:	41 ff d5             	call   *%r13
+  80303e:	83 e0 04             	and    $0x4,%eax
+  803041:	74 17                	je     80305a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803043:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80304a:	4c 39 f3             	cmp    %r14,%rbx
+  80304d:	75 e6                	jne    803035 <fd_alloc+0x29>
+  80304f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803055:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80305a:	4d 89 27             	mov    %r12,(%r15)
+}
+  80305d:	48 83 c4 08          	add    $0x8,%rsp
+  803061:	5b                   	pop    %rbx
+  803062:	41 5c                	pop    %r12
+  803064:	41 5d                	pop    %r13
+  803066:	41 5e                	pop    %r14
+  803068:	41 5f                	pop    %r15
+  80306a:	5d                   	pop    %rbp
+  80306b:	c3                   	ret
+
+000000000080306c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80306c:	83 ff 1f             	cmp    $0x1f,%edi
+  80306f:	77 39                	ja     8030aa <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803071:	55                   	push   %rbp
+  803072:	48 89 e5             	mov    %rsp,%rbp
+  803075:	41 54                	push   %r12
+  803077:	53                   	push   %rbx
+  803078:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80307b:	48 63 df             	movslq %edi,%rbx
+  80307e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803085:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803089:	48 89 df             	mov    %rbx,%rdi
+  80308c:	48 b8 e7 4d 80 00 00 	movabs $0x804de7,%rax
+  803093:	00 00 00 
+  803096:	ff d0                	call   *%rax
+  803098:	a8 04                	test   $0x4,%al
+  80309a:	74 14                	je     8030b0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80309c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8030a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030a5:	5b                   	pop    %rbx
+  8030a6:	41 5c                	pop    %r12
+  8030a8:	5d                   	pop    %rbp
+  8030a9:	c3                   	ret
+        return -E_INVAL;
+  8030aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8030af:	c3                   	ret
+        return -E_INVAL;
+  8030b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030b5:	eb ee                	jmp    8030a5 <fd_lookup+0x39>
+
+00000000008030b7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8030b7:	55                   	push   %rbp
+  8030b8:	48 89 e5             	mov    %rsp,%rbp
+  8030bb:	41 54                	push   %r12
+  8030bd:	53                   	push   %rbx
+  8030be:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8030c1:	48 b8 80 6d 80 00 00 	movabs $0x806d80,%rax
+  8030c8:	00 00 00 
+  8030cb:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8030d2:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8030d5:	39 3b                	cmp    %edi,(%rbx)
+  8030d7:	74 47                	je     803120 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8030d9:	48 83 c0 08          	add    $0x8,%rax
+  8030dd:	48 8b 18             	mov    (%rax),%rbx
+  8030e0:	48 85 db             	test   %rbx,%rbx
+  8030e3:	75 f0                	jne    8030d5 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8030e5:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8030ec:	00 00 00 
+  8030ef:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8030f5:	89 fa                	mov    %edi,%edx
+  8030f7:	48 bf f8 6c 80 00 00 	movabs $0x806cf8,%rdi
+  8030fe:	00 00 00 
+  803101:	b8 00 00 00 00       	mov    $0x0,%eax
+  803106:	48 b9 e4 18 80 00 00 	movabs $0x8018e4,%rcx
+  80310d:	00 00 00 
+  803110:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803112:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803117:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80311b:	5b                   	pop    %rbx
+  80311c:	41 5c                	pop    %r12
+  80311e:	5d                   	pop    %rbp
+  80311f:	c3                   	ret
+            return 0;
+  803120:	b8 00 00 00 00       	mov    $0x0,%eax
+  803125:	eb f0                	jmp    803117 <dev_lookup+0x60>
+
+0000000000803127 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803127:	55                   	push   %rbp
+  803128:	48 89 e5             	mov    %rsp,%rbp
+  80312b:	41 55                	push   %r13
+  80312d:	41 54                	push   %r12
+  80312f:	53                   	push   %rbx
+  803130:	48 83 ec 18          	sub    $0x18,%rsp
+  803134:	48 89 fb             	mov    %rdi,%rbx
+  803137:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80313a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803141:	ff ff ff 
+  803144:	48 01 df             	add    %rbx,%rdi
+  803147:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80314b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80314f:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+  80315b:	41 89 c5             	mov    %eax,%r13d
+  80315e:	85 c0                	test   %eax,%eax
+  803160:	78 06                	js     803168 <fd_close+0x41>
+  803162:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803166:	74 1a                	je     803182 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803168:	45 84 e4             	test   %r12b,%r12b
+  80316b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803170:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803174:	44 89 e8             	mov    %r13d,%eax
+  803177:	48 83 c4 18          	add    $0x18,%rsp
+  80317b:	5b                   	pop    %rbx
+  80317c:	41 5c                	pop    %r12
+  80317e:	41 5d                	pop    %r13
+  803180:	5d                   	pop    %rbp
+  803181:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803182:	8b 3b                	mov    (%rbx),%edi
+  803184:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803188:	48 b8 b7 30 80 00 00 	movabs $0x8030b7,%rax
+  80318f:	00 00 00 
+  803192:	ff d0                	call   *%rax
+  803194:	41 89 c5             	mov    %eax,%r13d
+  803197:	85 c0                	test   %eax,%eax
+  803199:	78 1b                	js     8031b6 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80319b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80319f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031a3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8031a9:	48 85 c0             	test   %rax,%rax
+  8031ac:	74 08                	je     8031b6 <fd_close+0x8f>
+  8031ae:	48 89 df             	mov    %rbx,%rdi
+  8031b1:	ff d0                	call   *%rax
+  8031b3:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8031b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031bb:	48 89 de             	mov    %rbx,%rsi
+  8031be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031c3:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  8031ca:	00 00 00 
+  8031cd:	ff d0                	call   *%rax
+    return res;
+  8031cf:	eb a3                	jmp    803174 <fd_close+0x4d>
+
+00000000008031d1 <close>:
+
+int
+close(int fdnum) {
+  8031d1:	55                   	push   %rbp
+  8031d2:	48 89 e5             	mov    %rsp,%rbp
+  8031d5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8031d9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031dd:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  8031e4:	00 00 00 
+  8031e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031e9:	85 c0                	test   %eax,%eax
+  8031eb:	78 15                	js     803202 <close+0x31>
+
+    return fd_close(fd, 1);
+  8031ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8031f2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031f6:	48 b8 27 31 80 00 00 	movabs $0x803127,%rax
+  8031fd:	00 00 00 
+  803200:	ff d0                	call   *%rax
+}
+  803202:	c9                   	leave
+  803203:	c3                   	ret
+
+0000000000803204 <close_all>:
+
+void
+close_all(void) {
+  803204:	55                   	push   %rbp
+  803205:	48 89 e5             	mov    %rsp,%rbp
+  803208:	41 54                	push   %r12
+  80320a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80320b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803210:	49 bc d1 31 80 00 00 	movabs $0x8031d1,%r12
+  803217:	00 00 00 
+  80321a:	89 df                	mov    %ebx,%edi
+  80321c:	41 ff d4             	call   *%r12
+  80321f:	83 c3 01             	add    $0x1,%ebx
+  803222:	83 fb 20             	cmp    $0x20,%ebx
+  803225:	75 f3                	jne    80321a <close_all+0x16>
+}
+  803227:	5b                   	pop    %rbx
+  803228:	41 5c                	pop    %r12
+  80322a:	5d                   	pop    %rbp
+  80322b:	c3                   	ret
+
+000000000080322c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80322c:	55                   	push   %rbp
+  80322d:	48 89 e5             	mov    %rsp,%rbp
+  803230:	41 57                	push   %r15
+  803232:	41 56                	push   %r14
+  803234:	41 55                	push   %r13
+  803236:	41 54                	push   %r12
+  803238:	53                   	push   %rbx
+  803239:	48 83 ec 18          	sub    $0x18,%rsp
+  80323d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803240:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803244:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  80324b:	00 00 00 
+  80324e:	ff d0                	call   *%rax
+  803250:	89 c3                	mov    %eax,%ebx
+  803252:	85 c0                	test   %eax,%eax
+  803254:	0f 88 b8 00 00 00    	js     803312 <dup+0xe6>
+    close(newfdnum);
+  80325a:	44 89 e7             	mov    %r12d,%edi
+  80325d:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  803264:	00 00 00 
+  803267:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803269:	4d 63 ec             	movslq %r12d,%r13
+  80326c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803273:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803277:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80327b:	4c 89 ff             	mov    %r15,%rdi
+  80327e:	49 be f0 2f 80 00 00 	movabs $0x802ff0,%r14
+  803285:	00 00 00 
+  803288:	41 ff d6             	call   *%r14
+  80328b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80328e:	4c 89 ef             	mov    %r13,%rdi
+  803291:	41 ff d6             	call   *%r14
+  803294:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803297:	48 89 df             	mov    %rbx,%rdi
+  80329a:	48 b8 e7 4d 80 00 00 	movabs $0x804de7,%rax
+  8032a1:	00 00 00 
+  8032a4:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8032a6:	a8 04                	test   $0x4,%al
+  8032a8:	74 2b                	je     8032d5 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8032aa:	41 89 c1             	mov    %eax,%r9d
+  8032ad:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032b3:	4c 89 f1             	mov    %r14,%rcx
+  8032b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032bb:	48 89 de             	mov    %rbx,%rsi
+  8032be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c3:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  8032ca:	00 00 00 
+  8032cd:	ff d0                	call   *%rax
+  8032cf:	89 c3                	mov    %eax,%ebx
+  8032d1:	85 c0                	test   %eax,%eax
+  8032d3:	78 4e                	js     803323 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8032d5:	4c 89 ff             	mov    %r15,%rdi
+  8032d8:	48 b8 e7 4d 80 00 00 	movabs $0x804de7,%rax
+  8032df:	00 00 00 
+  8032e2:	ff d0                	call   *%rax
+  8032e4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8032e7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032ed:	4c 89 e9             	mov    %r13,%rcx
+  8032f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032f5:	4c 89 fe             	mov    %r15,%rsi
+  8032f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032fd:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+  803309:	89 c3                	mov    %eax,%ebx
+  80330b:	85 c0                	test   %eax,%eax
+  80330d:	78 14                	js     803323 <dup+0xf7>
+
+    return newfdnum;
+  80330f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803312:	89 d8                	mov    %ebx,%eax
+  803314:	48 83 c4 18          	add    $0x18,%rsp
+  803318:	5b                   	pop    %rbx
+  803319:	41 5c                	pop    %r12
+  80331b:	41 5d                	pop    %r13
+  80331d:	41 5e                	pop    %r14
+  80331f:	41 5f                	pop    %r15
+  803321:	5d                   	pop    %rbp
+  803322:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803323:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803328:	4c 89 ee             	mov    %r13,%rsi
+  80332b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803330:	49 bc 58 2a 80 00 00 	movabs $0x802a58,%r12
+  803337:	00 00 00 
+  80333a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80333d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803342:	4c 89 f6             	mov    %r14,%rsi
+  803345:	bf 00 00 00 00       	mov    $0x0,%edi
+  80334a:	41 ff d4             	call   *%r12
+    return res;
+  80334d:	eb c3                	jmp    803312 <dup+0xe6>
+
+000000000080334f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80334f:	55                   	push   %rbp
+  803350:	48 89 e5             	mov    %rsp,%rbp
+  803353:	41 56                	push   %r14
+  803355:	41 55                	push   %r13
+  803357:	41 54                	push   %r12
+  803359:	53                   	push   %rbx
+  80335a:	48 83 ec 10          	sub    $0x10,%rsp
+  80335e:	89 fb                	mov    %edi,%ebx
+  803360:	49 89 f4             	mov    %rsi,%r12
+  803363:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803366:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80336a:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+  803376:	85 c0                	test   %eax,%eax
+  803378:	78 4c                	js     8033c6 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80337a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80337e:	41 8b 3e             	mov    (%r14),%edi
+  803381:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803385:	48 b8 b7 30 80 00 00 	movabs $0x8030b7,%rax
+  80338c:	00 00 00 
+  80338f:	ff d0                	call   *%rax
+  803391:	85 c0                	test   %eax,%eax
+  803393:	78 35                	js     8033ca <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803395:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803399:	83 e0 03             	and    $0x3,%eax
+  80339c:	83 f8 01             	cmp    $0x1,%eax
+  80339f:	74 2d                	je     8033ce <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033a5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8033a9:	48 85 c0             	test   %rax,%rax
+  8033ac:	74 56                	je     803404 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8033ae:	4c 89 ea             	mov    %r13,%rdx
+  8033b1:	4c 89 e6             	mov    %r12,%rsi
+  8033b4:	4c 89 f7             	mov    %r14,%rdi
+  8033b7:	ff d0                	call   *%rax
+}
+  8033b9:	48 83 c4 10          	add    $0x10,%rsp
+  8033bd:	5b                   	pop    %rbx
+  8033be:	41 5c                	pop    %r12
+  8033c0:	41 5d                	pop    %r13
+  8033c2:	41 5e                	pop    %r14
+  8033c4:	5d                   	pop    %rbp
+  8033c5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033c6:	48 98                	cltq
+  8033c8:	eb ef                	jmp    8033b9 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033ca:	48 98                	cltq
+  8033cc:	eb eb                	jmp    8033b9 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8033ce:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033d5:	00 00 00 
+  8033d8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8033de:	89 da                	mov    %ebx,%edx
+  8033e0:	48 bf 39 6d 80 00 00 	movabs $0x806d39,%rdi
+  8033e7:	00 00 00 
+  8033ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ef:	48 b9 e4 18 80 00 00 	movabs $0x8018e4,%rcx
+  8033f6:	00 00 00 
+  8033f9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803402:	eb b5                	jmp    8033b9 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803404:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80340b:	eb ac                	jmp    8033b9 <read+0x6a>
+
+000000000080340d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80340d:	55                   	push   %rbp
+  80340e:	48 89 e5             	mov    %rsp,%rbp
+  803411:	41 57                	push   %r15
+  803413:	41 56                	push   %r14
+  803415:	41 55                	push   %r13
+  803417:	41 54                	push   %r12
+  803419:	53                   	push   %rbx
+  80341a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80341e:	48 85 d2             	test   %rdx,%rdx
+  803421:	74 54                	je     803477 <readn+0x6a>
+  803423:	41 89 fd             	mov    %edi,%r13d
+  803426:	49 89 f6             	mov    %rsi,%r14
+  803429:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80342c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803431:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803436:	49 bf 4f 33 80 00 00 	movabs $0x80334f,%r15
+  80343d:	00 00 00 
+  803440:	4c 89 e2             	mov    %r12,%rdx
+  803443:	48 29 f2             	sub    %rsi,%rdx
+  803446:	4c 01 f6             	add    %r14,%rsi
+  803449:	44 89 ef             	mov    %r13d,%edi
+  80344c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	78 20                	js     803473 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803453:	01 c3                	add    %eax,%ebx
+  803455:	85 c0                	test   %eax,%eax
+  803457:	74 08                	je     803461 <readn+0x54>
+  803459:	48 63 f3             	movslq %ebx,%rsi
+  80345c:	4c 39 e6             	cmp    %r12,%rsi
+  80345f:	72 df                	jb     803440 <readn+0x33>
+    }
+    return res;
+  803461:	48 63 c3             	movslq %ebx,%rax
+}
+  803464:	48 83 c4 08          	add    $0x8,%rsp
+  803468:	5b                   	pop    %rbx
+  803469:	41 5c                	pop    %r12
+  80346b:	41 5d                	pop    %r13
+  80346d:	41 5e                	pop    %r14
+  80346f:	41 5f                	pop    %r15
+  803471:	5d                   	pop    %rbp
+  803472:	c3                   	ret
+        if (inc < 0) return inc;
+  803473:	48 98                	cltq
+  803475:	eb ed                	jmp    803464 <readn+0x57>
+    int inc = 1, res = 0;
+  803477:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80347c:	eb e3                	jmp    803461 <readn+0x54>
+
+000000000080347e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80347e:	55                   	push   %rbp
+  80347f:	48 89 e5             	mov    %rsp,%rbp
+  803482:	41 56                	push   %r14
+  803484:	41 55                	push   %r13
+  803486:	41 54                	push   %r12
+  803488:	53                   	push   %rbx
+  803489:	48 83 ec 10          	sub    $0x10,%rsp
+  80348d:	89 fb                	mov    %edi,%ebx
+  80348f:	49 89 f4             	mov    %rsi,%r12
+  803492:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803495:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803499:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  8034a0:	00 00 00 
+  8034a3:	ff d0                	call   *%rax
+  8034a5:	85 c0                	test   %eax,%eax
+  8034a7:	78 47                	js     8034f0 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034a9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8034ad:	41 8b 3e             	mov    (%r14),%edi
+  8034b0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034b4:	48 b8 b7 30 80 00 00 	movabs $0x8030b7,%rax
+  8034bb:	00 00 00 
+  8034be:	ff d0                	call   *%rax
+  8034c0:	85 c0                	test   %eax,%eax
+  8034c2:	78 30                	js     8034f4 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8034c4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8034c9:	74 2d                	je     8034f8 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8034cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034cf:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8034d3:	48 85 c0             	test   %rax,%rax
+  8034d6:	74 56                	je     80352e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8034d8:	4c 89 ea             	mov    %r13,%rdx
+  8034db:	4c 89 e6             	mov    %r12,%rsi
+  8034de:	4c 89 f7             	mov    %r14,%rdi
+  8034e1:	ff d0                	call   *%rax
+}
+  8034e3:	48 83 c4 10          	add    $0x10,%rsp
+  8034e7:	5b                   	pop    %rbx
+  8034e8:	41 5c                	pop    %r12
+  8034ea:	41 5d                	pop    %r13
+  8034ec:	41 5e                	pop    %r14
+  8034ee:	5d                   	pop    %rbp
+  8034ef:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034f0:	48 98                	cltq
+  8034f2:	eb ef                	jmp    8034e3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034f4:	48 98                	cltq
+  8034f6:	eb eb                	jmp    8034e3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034f8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034ff:	00 00 00 
+  803502:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803508:	89 da                	mov    %ebx,%edx
+  80350a:	48 bf 55 6d 80 00 00 	movabs $0x806d55,%rdi
+  803511:	00 00 00 
+  803514:	b8 00 00 00 00       	mov    $0x0,%eax
+  803519:	48 b9 e4 18 80 00 00 	movabs $0x8018e4,%rcx
+  803520:	00 00 00 
+  803523:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803525:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80352c:	eb b5                	jmp    8034e3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80352e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803535:	eb ac                	jmp    8034e3 <write+0x65>
+
+0000000000803537 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803537:	55                   	push   %rbp
+  803538:	48 89 e5             	mov    %rsp,%rbp
+  80353b:	53                   	push   %rbx
+  80353c:	48 83 ec 18          	sub    $0x18,%rsp
+  803540:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803542:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803546:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  80354d:	00 00 00 
+  803550:	ff d0                	call   *%rax
+  803552:	85 c0                	test   %eax,%eax
+  803554:	78 0c                	js     803562 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803556:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80355a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80355d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803562:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803566:	c9                   	leave
+  803567:	c3                   	ret
+
+0000000000803568 <tell>:
+
+int tell(int fdnum) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+  80356c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803570:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803574:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+  803580:	85 c0                	test   %eax,%eax
+  803582:	78 07                	js     80358b <tell+0x23>
+
+    return fd->fd_offset;
+  803584:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803588:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80358b:	c9                   	leave
+  80358c:	c3                   	ret
+
+000000000080358d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80358d:	55                   	push   %rbp
+  80358e:	48 89 e5             	mov    %rsp,%rbp
+  803591:	41 55                	push   %r13
+  803593:	41 54                	push   %r12
+  803595:	53                   	push   %rbx
+  803596:	48 83 ec 18          	sub    $0x18,%rsp
+  80359a:	89 fb                	mov    %edi,%ebx
+  80359c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80359f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035a3:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  8035aa:	00 00 00 
+  8035ad:	ff d0                	call   *%rax
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	78 38                	js     8035eb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035b3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8035b7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8035bb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035bf:	48 b8 b7 30 80 00 00 	movabs $0x8030b7,%rax
+  8035c6:	00 00 00 
+  8035c9:	ff d0                	call   *%rax
+  8035cb:	85 c0                	test   %eax,%eax
+  8035cd:	78 1c                	js     8035eb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035cf:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8035d4:	74 20                	je     8035f6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8035d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035da:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8035de:	48 85 c0             	test   %rax,%rax
+  8035e1:	74 47                	je     80362a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8035e3:	44 89 e6             	mov    %r12d,%esi
+  8035e6:	4c 89 ef             	mov    %r13,%rdi
+  8035e9:	ff d0                	call   *%rax
+}
+  8035eb:	48 83 c4 18          	add    $0x18,%rsp
+  8035ef:	5b                   	pop    %rbx
+  8035f0:	41 5c                	pop    %r12
+  8035f2:	41 5d                	pop    %r13
+  8035f4:	5d                   	pop    %rbp
+  8035f5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8035f6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8035fd:	00 00 00 
+  803600:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803606:	89 da                	mov    %ebx,%edx
+  803608:	48 bf 18 6d 80 00 00 	movabs $0x806d18,%rdi
+  80360f:	00 00 00 
+  803612:	b8 00 00 00 00       	mov    $0x0,%eax
+  803617:	48 b9 e4 18 80 00 00 	movabs $0x8018e4,%rcx
+  80361e:	00 00 00 
+  803621:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803623:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803628:	eb c1                	jmp    8035eb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80362a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80362f:	eb ba                	jmp    8035eb <ftruncate+0x5e>
+
+0000000000803631 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803631:	55                   	push   %rbp
+  803632:	48 89 e5             	mov    %rsp,%rbp
+  803635:	41 54                	push   %r12
+  803637:	53                   	push   %rbx
+  803638:	48 83 ec 10          	sub    $0x10,%rsp
+  80363c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80363f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803643:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  80364a:	00 00 00 
+  80364d:	ff d0                	call   *%rax
+  80364f:	85 c0                	test   %eax,%eax
+  803651:	78 63                	js     8036b6 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803653:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803657:	41 8b 3c 24          	mov    (%r12),%edi
+  80365b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80365f:	48 b8 b7 30 80 00 00 	movabs $0x8030b7,%rax
+  803666:	00 00 00 
+  803669:	ff d0                	call   *%rax
+  80366b:	85 c0                	test   %eax,%eax
+  80366d:	78 47                	js     8036b6 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80366f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803673:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803678:	74 45                	je     8036bf <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80367a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80367d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803684:	00 00 00 
+    stat->st_isdir = 0;
+  803687:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80368e:	00 00 00 
+    stat->st_ino = 0;
+  803691:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803698:	00 00 00 00 
+    stat->st_version = 0;
+  80369c:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8036a3:	00 00 00 
+    stat->st_dev = dev;
+  8036a6:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8036ad:	48 89 de             	mov    %rbx,%rsi
+  8036b0:	4c 89 e7             	mov    %r12,%rdi
+  8036b3:	ff 50 28             	call   *0x28(%rax)
+}
+  8036b6:	48 83 c4 10          	add    $0x10,%rsp
+  8036ba:	5b                   	pop    %rbx
+  8036bb:	41 5c                	pop    %r12
+  8036bd:	5d                   	pop    %rbp
+  8036be:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8036bf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8036c4:	eb f0                	jmp    8036b6 <fstat+0x85>
+
+00000000008036c6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8036c6:	55                   	push   %rbp
+  8036c7:	48 89 e5             	mov    %rsp,%rbp
+  8036ca:	41 54                	push   %r12
+  8036cc:	53                   	push   %rbx
+  8036cd:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8036d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8036d5:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  8036dc:	00 00 00 
+  8036df:	ff d0                	call   *%rax
+  8036e1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8036e3:	85 c0                	test   %eax,%eax
+  8036e5:	78 25                	js     80370c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8036e7:	4c 89 e6             	mov    %r12,%rsi
+  8036ea:	89 c7                	mov    %eax,%edi
+  8036ec:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  8036f3:	00 00 00 
+  8036f6:	ff d0                	call   *%rax
+  8036f8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8036fb:	89 df                	mov    %ebx,%edi
+  8036fd:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  803704:	00 00 00 
+  803707:	ff d0                	call   *%rax
+
+    return res;
+  803709:	44 89 e3             	mov    %r12d,%ebx
+}
+  80370c:	89 d8                	mov    %ebx,%eax
+  80370e:	5b                   	pop    %rbx
+  80370f:	41 5c                	pop    %r12
+  803711:	5d                   	pop    %rbp
+  803712:	c3                   	ret
+
+0000000000803713 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803713:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80371a:	00 00 00 
+  80371d:	83 38 00             	cmpl   $0x0,(%rax)
+  803720:	74 0a                	je     80372c <fsipc_env+0x19>
+    return fsenv;
+}
+  803722:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803729:	00 00 
+  80372b:	c3                   	ret
+fsipc_env(void) {
+  80372c:	55                   	push   %rbp
+  80372d:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803730:	bf 03 00 00 00       	mov    $0x3,%edi
+  803735:	48 b8 f1 60 80 00 00 	movabs $0x8060f1,%rax
+  80373c:	00 00 00 
+  80373f:	ff d0                	call   *%rax
+  803741:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803748:	00 00 
+}
+  80374a:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803751:	00 00 
+  803753:	5d                   	pop    %rbp
+  803754:	c3                   	ret
+
+0000000000803755 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803755:	55                   	push   %rbp
+  803756:	48 89 e5             	mov    %rsp,%rbp
+  803759:	53                   	push   %rbx
+  80375a:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80375e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803765:	00 
+  803766:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80376d:	00 
+  80376e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803775:	00 
+  803776:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80377d:	00 
+  80377e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803785:	00 
+
+    assert(size <= sizeof(words));
+  803786:	48 83 fa 28          	cmp    $0x28,%rdx
+  80378a:	77 38                	ja     8037c4 <fsipc_short+0x6f>
+  80378c:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80378e:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803792:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  803799:	00 00 00 
+  80379c:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80379e:	48 b8 13 37 80 00 00 	movabs $0x803713,%rax
+  8037a5:	00 00 00 
+  8037a8:	ff d0                	call   *%rax
+  8037aa:	89 c7                	mov    %eax,%edi
+  8037ac:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8037b0:	89 de                	mov    %ebx,%esi
+  8037b2:	48 b8 54 60 80 00 00 	movabs $0x806054,%rax
+  8037b9:	00 00 00 
+  8037bc:	ff d0                	call   *%rax
+}
+  8037be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037c2:	c9                   	leave
+  8037c3:	c3                   	ret
+    assert(size <= sizeof(words));
+  8037c4:	48 b9 a0 6d 80 00 00 	movabs $0x806da0,%rcx
+  8037cb:	00 00 00 
+  8037ce:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  8037d5:	00 00 00 
+  8037d8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8037dd:	48 bf cb 6d 80 00 00 	movabs $0x806dcb,%rdi
+  8037e4:	00 00 00 
+  8037e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ec:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  8037f3:	00 00 00 
+  8037f6:	41 ff d0             	call   *%r8
+
+00000000008037f9 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8037f9:	55                   	push   %rbp
+  8037fa:	48 89 e5             	mov    %rsp,%rbp
+  8037fd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803801:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803804:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803807:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  80380a:	ba 08 00 00 00       	mov    $0x8,%edx
+  80380f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803813:	bf 02 00 00 00       	mov    $0x2,%edi
+  803818:	48 b8 55 37 80 00 00 	movabs $0x803755,%rax
+  80381f:	00 00 00 
+  803822:	ff d0                	call   *%rax
+}
+  803824:	c9                   	leave
+  803825:	c3                   	ret
+
+0000000000803826 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803826:	55                   	push   %rbp
+  803827:	48 89 e5             	mov    %rsp,%rbp
+  80382a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  80382e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803831:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803834:	ba 04 00 00 00       	mov    $0x4,%edx
+  803839:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80383d:	bf 06 00 00 00       	mov    $0x6,%edi
+  803842:	48 b8 55 37 80 00 00 	movabs $0x803755,%rax
+  803849:	00 00 00 
+  80384c:	ff d0                	call   *%rax
+}
+  80384e:	c9                   	leave
+  80384f:	c3                   	ret
+
+0000000000803850 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803850:	55                   	push   %rbp
+  803851:	48 89 e5             	mov    %rsp,%rbp
+  803854:	41 54                	push   %r12
+  803856:	53                   	push   %rbx
+  803857:	48 83 ec 10          	sub    $0x10,%rsp
+  80385b:	89 fb                	mov    %edi,%ebx
+  80385d:	49 89 f4             	mov    %rsi,%r12
+  803860:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803864:	48 b8 13 37 80 00 00 	movabs $0x803713,%rax
+  80386b:	00 00 00 
+  80386e:	ff d0                	call   *%rax
+  803870:	89 c7                	mov    %eax,%edi
+  803872:	6a 00                	push   $0x0
+  803874:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803878:	50                   	push   %rax
+  803879:	4d 89 e1             	mov    %r12,%r9
+  80387c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803882:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803887:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80388e:	00 00 00 
+  803891:	89 de                	mov    %ebx,%esi
+  803893:	48 b8 ef 5f 80 00 00 	movabs $0x805fef,%rax
+  80389a:	00 00 00 
+  80389d:	ff d0                	call   *%rax
+}
+  80389f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8038a3:	5b                   	pop    %rbx
+  8038a4:	41 5c                	pop    %r12
+  8038a6:	5d                   	pop    %rbp
+  8038a7:	c3                   	ret
+
+00000000008038a8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8038a8:	55                   	push   %rbp
+  8038a9:	48 89 e5             	mov    %rsp,%rbp
+  8038ac:	41 54                	push   %r12
+  8038ae:	53                   	push   %rbx
+  8038af:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8038b2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8038b5:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  8038bc:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8038c8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8038cd:	48 b8 50 38 80 00 00 	movabs $0x803850,%rax
+  8038d4:	00 00 00 
+  8038d7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038d9:	85 c0                	test   %eax,%eax
+  8038db:	78 5a                	js     803937 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8038dd:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8038e4:	00 00 00 
+  8038e7:	4c 89 e6             	mov    %r12,%rsi
+  8038ea:	48 89 df             	mov    %rbx,%rdi
+  8038ed:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8038f4:	00 00 00 
+  8038f7:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8038f9:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803900:	00 
+  803901:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803907:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80390e:	00 
+  80390f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803915:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  80391c:	00 
+  80391d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803924:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  80392b:	00 
+  80392c:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803932:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803937:	5b                   	pop    %rbx
+  803938:	41 5c                	pop    %r12
+  80393a:	5d                   	pop    %rbp
+  80393b:	c3                   	ret
+
+000000000080393c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80393c:	55                   	push   %rbp
+  80393d:	48 89 e5             	mov    %rsp,%rbp
+  803940:	41 57                	push   %r15
+  803942:	41 56                	push   %r14
+  803944:	41 55                	push   %r13
+  803946:	41 54                	push   %r12
+  803948:	53                   	push   %rbx
+  803949:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80394d:	48 85 ff             	test   %rdi,%rdi
+  803950:	0f 84 a1 00 00 00    	je     8039f7 <devfile_read+0xbb>
+  803956:	49 89 ff             	mov    %rdi,%r15
+  803959:	49 89 f5             	mov    %rsi,%r13
+  80395c:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  80395f:	48 85 f6             	test   %rsi,%rsi
+  803962:	0f 84 c4 00 00 00    	je     803a2c <devfile_read+0xf0>
+    size_t total_read = 0;
+  803968:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80396f:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803970:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803977:	00 00 00 
+  80397a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80397e:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803981:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803985:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80398a:	be 00 00 00 00       	mov    $0x0,%esi
+  80398f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803994:	48 b8 50 38 80 00 00 	movabs $0x803850,%rax
+  80399b:	00 00 00 
+  80399e:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039a0:	85 c0                	test   %eax,%eax
+  8039a2:	0f 88 b9 00 00 00    	js     803a61 <devfile_read+0x125>
+        assert(res <= n);
+  8039a8:	48 63 d8             	movslq %eax,%rbx
+  8039ab:	49 39 dc             	cmp    %rbx,%r12
+  8039ae:	0f 82 b1 00 00 00    	jb     803a65 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8039b4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8039b9:	0f 87 db 00 00 00    	ja     803a9a <devfile_read+0x15e>
+        if (!res) {
+  8039bf:	85 c0                	test   %eax,%eax
+  8039c1:	74 21                	je     8039e4 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8039c3:	48 89 da             	mov    %rbx,%rdx
+  8039c6:	4c 89 f6             	mov    %r14,%rsi
+  8039c9:	4c 89 ef             	mov    %r13,%rdi
+  8039cc:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  8039d3:	00 00 00 
+  8039d6:	ff d0                	call   *%rax
+        total_read += res;
+  8039d8:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8039dc:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8039df:	49 29 dc             	sub    %rbx,%r12
+  8039e2:	75 96                	jne    80397a <devfile_read+0x3e>
+    return total_read;
+  8039e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8039e8:	48 83 c4 18          	add    $0x18,%rsp
+  8039ec:	5b                   	pop    %rbx
+  8039ed:	41 5c                	pop    %r12
+  8039ef:	41 5d                	pop    %r13
+  8039f1:	41 5e                	pop    %r14
+  8039f3:	41 5f                	pop    %r15
+  8039f5:	5d                   	pop    %rbp
+  8039f6:	c3                   	ret
+    assert(fd);
+  8039f7:	48 b9 d6 6d 80 00 00 	movabs $0x806dd6,%rcx
+  8039fe:	00 00 00 
+  803a01:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  803a08:	00 00 00 
+  803a0b:	be 91 00 00 00       	mov    $0x91,%esi
+  803a10:	48 bf cb 6d 80 00 00 	movabs $0x806dcb,%rdi
+  803a17:	00 00 00 
+  803a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a1f:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  803a26:	00 00 00 
+  803a29:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a2c:	48 b9 d9 6d 80 00 00 	movabs $0x806dd9,%rcx
+  803a33:	00 00 00 
+  803a36:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  803a3d:	00 00 00 
+  803a40:	be 92 00 00 00       	mov    $0x92,%esi
+  803a45:	48 bf cb 6d 80 00 00 	movabs $0x806dcb,%rdi
+  803a4c:	00 00 00 
+  803a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a54:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  803a5b:	00 00 00 
+  803a5e:	41 ff d0             	call   *%r8
+            return res;
+  803a61:	48 98                	cltq
+  803a63:	eb 83                	jmp    8039e8 <devfile_read+0xac>
+        assert(res <= n);
+  803a65:	48 b9 dd 6d 80 00 00 	movabs $0x806ddd,%rcx
+  803a6c:	00 00 00 
+  803a6f:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  803a76:	00 00 00 
+  803a79:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803a7e:	48 bf cb 6d 80 00 00 	movabs $0x806dcb,%rdi
+  803a85:	00 00 00 
+  803a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a8d:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  803a94:	00 00 00 
+  803a97:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803a9a:	48 b9 e8 6d 80 00 00 	movabs $0x806de8,%rcx
+  803aa1:	00 00 00 
+  803aa4:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  803aab:	00 00 00 
+  803aae:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803ab3:	48 bf cb 6d 80 00 00 	movabs $0x806dcb,%rdi
+  803aba:	00 00 00 
+  803abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac2:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  803ac9:	00 00 00 
+  803acc:	41 ff d0             	call   *%r8
+
+0000000000803acf <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803acf:	55                   	push   %rbp
+  803ad0:	48 89 e5             	mov    %rsp,%rbp
+  803ad3:	41 57                	push   %r15
+  803ad5:	41 56                	push   %r14
+  803ad7:	41 55                	push   %r13
+  803ad9:	41 54                	push   %r12
+  803adb:	53                   	push   %rbx
+  803adc:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803ae0:	48 85 ff             	test   %rdi,%rdi
+  803ae3:	0f 84 83 00 00 00    	je     803b6c <devfile_write+0x9d>
+  803ae9:	49 89 ff             	mov    %rdi,%r15
+  803aec:	49 89 f4             	mov    %rsi,%r12
+  803aef:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803af2:	48 85 f6             	test   %rsi,%rsi
+  803af5:	0f 84 a6 00 00 00    	je     803ba1 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803afb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803b01:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803b08:	00 00 00 
+  803b0b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803b0f:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803b12:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803b16:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803b1b:	48 39 d3             	cmp    %rdx,%rbx
+  803b1e:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803b22:	4c 89 e6             	mov    %r12,%rsi
+  803b25:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803b2c:	00 00 00 
+  803b2f:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  803b36:	00 00 00 
+  803b39:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b40:	be 00 00 00 00       	mov    $0x0,%esi
+  803b45:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b4a:	48 b8 50 38 80 00 00 	movabs $0x803850,%rax
+  803b51:	00 00 00 
+  803b54:	ff d0                	call   *%rax
+        if (res < 0) {
+  803b56:	85 c0                	test   %eax,%eax
+  803b58:	78 7c                	js     803bd6 <devfile_write+0x107>
+        total_written += res;
+  803b5a:	48 98                	cltq
+  803b5c:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803b5f:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803b62:	48 29 c3             	sub    %rax,%rbx
+  803b65:	75 a4                	jne    803b0b <devfile_write+0x3c>
+    return total_written;
+  803b67:	4c 89 e8             	mov    %r13,%rax
+  803b6a:	eb 6c                	jmp    803bd8 <devfile_write+0x109>
+    assert(fd);
+  803b6c:	48 b9 d6 6d 80 00 00 	movabs $0x806dd6,%rcx
+  803b73:	00 00 00 
+  803b76:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  803b7d:	00 00 00 
+  803b80:	be bd 00 00 00       	mov    $0xbd,%esi
+  803b85:	48 bf cb 6d 80 00 00 	movabs $0x806dcb,%rdi
+  803b8c:	00 00 00 
+  803b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b94:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  803b9b:	00 00 00 
+  803b9e:	41 ff d0             	call   *%r8
+    assert(buf);
+  803ba1:	48 b9 d9 6d 80 00 00 	movabs $0x806dd9,%rcx
+  803ba8:	00 00 00 
+  803bab:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  803bb2:	00 00 00 
+  803bb5:	be be 00 00 00       	mov    $0xbe,%esi
+  803bba:	48 bf cb 6d 80 00 00 	movabs $0x806dcb,%rdi
+  803bc1:	00 00 00 
+  803bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc9:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  803bd0:	00 00 00 
+  803bd3:	41 ff d0             	call   *%r8
+            return res;
+  803bd6:	48 98                	cltq
+}
+  803bd8:	48 83 c4 08          	add    $0x8,%rsp
+  803bdc:	5b                   	pop    %rbx
+  803bdd:	41 5c                	pop    %r12
+  803bdf:	41 5d                	pop    %r13
+  803be1:	41 5e                	pop    %r14
+  803be3:	41 5f                	pop    %r15
+  803be5:	5d                   	pop    %rbp
+  803be6:	c3                   	ret
+
+0000000000803be7 <open>:
+open(const char *path, int mode) {
+  803be7:	55                   	push   %rbp
+  803be8:	48 89 e5             	mov    %rsp,%rbp
+  803beb:	41 55                	push   %r13
+  803bed:	41 54                	push   %r12
+  803bef:	53                   	push   %rbx
+  803bf0:	48 83 ec 18          	sub    $0x18,%rsp
+  803bf4:	49 89 fc             	mov    %rdi,%r12
+  803bf7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803bfa:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  803c01:	00 00 00 
+  803c04:	ff d0                	call   *%rax
+  803c06:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803c0c:	0f 87 8f 00 00 00    	ja     803ca1 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803c12:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c16:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  803c1d:	00 00 00 
+  803c20:	ff d0                	call   *%rax
+  803c22:	89 c3                	mov    %eax,%ebx
+  803c24:	85 c0                	test   %eax,%eax
+  803c26:	78 55                	js     803c7d <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803c28:	4c 89 e6             	mov    %r12,%rsi
+  803c2b:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803c32:	00 00 00 
+  803c35:	48 89 df             	mov    %rbx,%rdi
+  803c38:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803c44:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c50:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c54:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c59:	48 b8 50 38 80 00 00 	movabs $0x803850,%rax
+  803c60:	00 00 00 
+  803c63:	ff d0                	call   *%rax
+  803c65:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803c67:	85 c0                	test   %eax,%eax
+  803c69:	78 1f                	js     803c8a <open+0xa3>
+    return fd2num(fd);
+  803c6b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c6f:	48 b8 de 2f 80 00 00 	movabs $0x802fde,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+  803c7b:	89 c3                	mov    %eax,%ebx
+}
+  803c7d:	89 d8                	mov    %ebx,%eax
+  803c7f:	48 83 c4 18          	add    $0x18,%rsp
+  803c83:	5b                   	pop    %rbx
+  803c84:	41 5c                	pop    %r12
+  803c86:	41 5d                	pop    %r13
+  803c88:	5d                   	pop    %rbp
+  803c89:	c3                   	ret
+        fd_close(fd, 0);
+  803c8a:	be 00 00 00 00       	mov    $0x0,%esi
+  803c8f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c93:	48 b8 27 31 80 00 00 	movabs $0x803127,%rax
+  803c9a:	00 00 00 
+  803c9d:	ff d0                	call   *%rax
+        return res;
+  803c9f:	eb dc                	jmp    803c7d <open+0x96>
+        return -E_BAD_PATH;
+  803ca1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803ca6:	eb d5                	jmp    803c7d <open+0x96>
+
+0000000000803ca8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803ca8:	55                   	push   %rbp
+  803ca9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cb1:	be 00 00 00 00       	mov    $0x0,%esi
+  803cb6:	bf 08 00 00 00       	mov    $0x8,%edi
+  803cbb:	48 b8 55 37 80 00 00 	movabs $0x803755,%rax
+  803cc2:	00 00 00 
+  803cc5:	ff d0                	call   *%rax
+}
+  803cc7:	5d                   	pop    %rbp
+  803cc8:	c3                   	ret
+
+0000000000803cc9 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803cc9:	55                   	push   %rbp
+  803cca:	48 89 e5             	mov    %rsp,%rbp
+  803ccd:	41 56                	push   %r14
+  803ccf:	41 55                	push   %r13
+  803cd1:	41 54                	push   %r12
+  803cd3:	53                   	push   %rbx
+  803cd4:	48 83 ec 10          	sub    $0x10,%rsp
+  803cd8:	41 89 f6             	mov    %esi,%r14d
+  803cdb:	49 89 d4             	mov    %rdx,%r12
+  803cde:	48 89 cb             	mov    %rcx,%rbx
+  803ce1:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ce4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ce8:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  803cef:	00 00 00 
+  803cf2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cf4:	85 c0                	test   %eax,%eax
+  803cf6:	78 46                	js     803d3e <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803cf8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cfc:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803d03:	00 00 00 
+  803d06:	8b 00                	mov    (%rax),%eax
+  803d08:	39 02                	cmp    %eax,(%rdx)
+  803d0a:	75 3f                	jne    803d4b <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803d0c:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803d13:	00 00 00 
+  803d16:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803d19:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803d1b:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803d1f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803d23:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803d27:	48 89 da             	mov    %rbx,%rdx
+  803d2a:	4c 89 e6             	mov    %r12,%rsi
+  803d2d:	bf 09 00 00 00       	mov    $0x9,%edi
+  803d32:	48 b8 50 38 80 00 00 	movabs $0x803850,%rax
+  803d39:	00 00 00 
+  803d3c:	ff d0                	call   *%rax
+}
+  803d3e:	48 83 c4 10          	add    $0x10,%rsp
+  803d42:	5b                   	pop    %rbx
+  803d43:	41 5c                	pop    %r12
+  803d45:	41 5d                	pop    %r13
+  803d47:	41 5e                	pop    %r14
+  803d49:	5d                   	pop    %rbp
+  803d4a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d4b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d50:	eb ec                	jmp    803d3e <file_map+0x75>
+
+0000000000803d52 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803d52:	55                   	push   %rbp
+  803d53:	48 89 e5             	mov    %rsp,%rbp
+  803d56:	41 54                	push   %r12
+  803d58:	53                   	push   %rbx
+  803d59:	48 83 ec 20          	sub    $0x20,%rsp
+  803d5d:	41 89 f4             	mov    %esi,%r12d
+  803d60:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d63:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d67:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  803d6e:	00 00 00 
+  803d71:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d73:	85 c0                	test   %eax,%eax
+  803d75:	78 3c                	js     803db3 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d7b:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803d82:	00 00 00 
+  803d85:	8b 0a                	mov    (%rdx),%ecx
+  803d87:	39 08                	cmp    %ecx,(%rax)
+  803d89:	75 31                	jne    803dbc <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803d8b:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d8e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803d91:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803d95:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803d99:	ba 10 00 00 00       	mov    $0x10,%edx
+  803d9e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803da2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803da7:	48 b8 55 37 80 00 00 	movabs $0x803755,%rax
+  803dae:	00 00 00 
+  803db1:	ff d0                	call   *%rax
+}
+  803db3:	48 83 c4 20          	add    $0x20,%rsp
+  803db7:	5b                   	pop    %rbx
+  803db8:	41 5c                	pop    %r12
+  803dba:	5d                   	pop    %rbp
+  803dbb:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803dbc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803dc1:	eb f0                	jmp    803db3 <file_msync+0x61>
+
+0000000000803dc3 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803dc3:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803dc7:	7f 01                	jg     803dca <writebuf+0x7>
+  803dc9:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803dca:	55                   	push   %rbp
+  803dcb:	48 89 e5             	mov    %rsp,%rbp
+  803dce:	53                   	push   %rbx
+  803dcf:	48 83 ec 08          	sub    $0x8,%rsp
+  803dd3:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803dd6:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803dda:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803dde:	8b 3f                	mov    (%rdi),%edi
+  803de0:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  803de7:	00 00 00 
+  803dea:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803dec:	48 85 c0             	test   %rax,%rax
+  803def:	7e 04                	jle    803df5 <writebuf+0x32>
+  803df1:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803df5:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803df9:	48 39 c2             	cmp    %rax,%rdx
+  803dfc:	74 0f                	je     803e0d <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803dfe:	48 85 c0             	test   %rax,%rax
+  803e01:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e06:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803e0a:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803e0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e11:	c9                   	leave
+  803e12:	c3                   	ret
+
+0000000000803e13 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803e13:	8b 46 04             	mov    0x4(%rsi),%eax
+  803e16:	8d 50 01             	lea    0x1(%rax),%edx
+  803e19:	89 56 04             	mov    %edx,0x4(%rsi)
+  803e1c:	48 98                	cltq
+  803e1e:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803e23:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e29:	74 01                	je     803e2c <putch+0x19>
+  803e2b:	c3                   	ret
+putch(int ch, void *arg) {
+  803e2c:	55                   	push   %rbp
+  803e2d:	48 89 e5             	mov    %rsp,%rbp
+  803e30:	53                   	push   %rbx
+  803e31:	48 83 ec 08          	sub    $0x8,%rsp
+  803e35:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e38:	48 89 f7             	mov    %rsi,%rdi
+  803e3b:	48 b8 c3 3d 80 00 00 	movabs $0x803dc3,%rax
+  803e42:	00 00 00 
+  803e45:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e47:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e52:	c9                   	leave
+  803e53:	c3                   	ret
+
+0000000000803e54 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e54:	55                   	push   %rbp
+  803e55:	48 89 e5             	mov    %rsp,%rbp
+  803e58:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803e5f:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803e62:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803e68:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803e6f:	00 00 00 
+    state.result = 0;
+  803e72:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803e79:	00 00 00 00 
+    state.error = 1;
+  803e7d:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803e84:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803e87:	48 89 f2             	mov    %rsi,%rdx
+  803e8a:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803e91:	48 bf 13 3e 80 00 00 	movabs $0x803e13,%rdi
+  803e98:	00 00 00 
+  803e9b:	48 b8 34 1a 80 00 00 	movabs $0x801a34,%rax
+  803ea2:	00 00 00 
+  803ea5:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803ea7:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803eae:	7f 14                	jg     803ec4 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803eb0:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803eb7:	48 85 c0             	test   %rax,%rax
+  803eba:	75 06                	jne    803ec2 <vfprintf+0x6e>
+  803ebc:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803ec2:	c9                   	leave
+  803ec3:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803ec4:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803ecb:	48 b8 c3 3d 80 00 00 	movabs $0x803dc3,%rax
+  803ed2:	00 00 00 
+  803ed5:	ff d0                	call   *%rax
+  803ed7:	eb d7                	jmp    803eb0 <vfprintf+0x5c>
+
+0000000000803ed9 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803ed9:	55                   	push   %rbp
+  803eda:	48 89 e5             	mov    %rsp,%rbp
+  803edd:	48 83 ec 50          	sub    $0x50,%rsp
+  803ee1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ee5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ee9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803eed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ef1:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803ef8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f00:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803f08:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f0c:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  803f13:	00 00 00 
+  803f16:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f18:	c9                   	leave
+  803f19:	c3                   	ret
+
+0000000000803f1a <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803f1a:	55                   	push   %rbp
+  803f1b:	48 89 e5             	mov    %rsp,%rbp
+  803f1e:	48 83 ec 50          	sub    $0x50,%rsp
+  803f22:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f26:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f2a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f2e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f32:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f36:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f3d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f45:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f49:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f4d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f51:	48 89 fe             	mov    %rdi,%rsi
+  803f54:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f59:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  803f60:	00 00 00 
+  803f63:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f65:	c9                   	leave
+  803f66:	c3                   	ret
+
+0000000000803f67 <collect_shared_region>:
+    return 0;
+}
+
+/* Append shared region to SharedList arg merging adjacent regions */
+static int
+collect_shared_region(void *start, void *end, void *arg) {
+  803f67:	55                   	push   %rbp
+  803f68:	48 89 e5             	mov    %rsp,%rbp
+  803f6b:	41 55                	push   %r13
+  803f6d:	41 54                	push   %r12
+  803f6f:	53                   	push   %rbx
+  803f70:	48 83 ec 08          	sub    $0x8,%rsp
+  803f74:	48 89 fb             	mov    %rdi,%rbx
+  803f77:	49 89 f5             	mov    %rsi,%r13
+  803f7a:	49 89 d4             	mov    %rdx,%r12
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+  803f7d:	48 b8 e7 4d 80 00 00 	movabs $0x804de7,%rax
+  803f84:	00 00 00 
+  803f87:	ff d0                	call   *%rax
+  803f89:	89 c1                	mov    %eax,%ecx
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+  803f8b:	48 b8 00 00 00 00 d0 	movabs $0xffffffd000000000,%rax
+  803f92:	ff ff ff 
+  803f95:	48 01 d8             	add    %rbx,%rax
+  803f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f9d:	48 c1 e8 24          	shr    $0x24,%rax
+  803fa1:	74 5c                	je     803fff <collect_shared_region+0x98>
+
+    if (list->count) {
+  803fa3:	49 8b 84 24 00 18 00 	mov    0x1800(%r12),%rax
+  803faa:	00 
+  803fab:	48 85 c0             	test   %rax,%rax
+  803fae:	74 20                	je     803fd0 <collect_shared_region+0x69>
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  803fb0:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803fb4:	49 8d 14 d4          	lea    (%r12,%rdx,8),%rdx
+  803fb8:	48 8b 72 f0          	mov    -0x10(%rdx),%rsi
+  803fbc:	48 89 f7             	mov    %rsi,%rdi
+  803fbf:	48 03 7a e8          	add    -0x18(%rdx),%rdi
+  803fc3:	48 39 fb             	cmp    %rdi,%rbx
+  803fc6:	74 44                	je     80400c <collect_shared_region+0xa5>
+            last->size += end - start;
+            return 0;
+        }
+    }
+
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  803fc8:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803fce:	74 59                	je     804029 <collect_shared_region+0xc2>
+    list->regions[list->count++] = (struct SpawnRegion){
+  803fd0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803fd4:	49 89 94 24 00 18 00 	mov    %rdx,0x1800(%r12)
+  803fdb:	00 
+  803fdc:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  803fe0:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  803fe4:	49 8d 34 f4          	lea    (%r12,%rsi,8),%rsi
+  803fe8:	48 89 1e             	mov    %rbx,(%rsi)
+            .start = (uintptr_t)start,
+            .size = end - start,
+  803feb:	49 29 dd             	sub    %rbx,%r13
+  803fee:	4c 89 6e 08          	mov    %r13,0x8(%rsi)
+    list->regions[list->count++] = (struct SpawnRegion){
+  803ff2:	48 01 c2             	add    %rax,%rdx
+  803ff5:	41 89 4c d4 10       	mov    %ecx,0x10(%r12,%rdx,8)
+            .prot = prot};
+    return 0;
+  803ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  803fff:	89 d0                	mov    %edx,%eax
+  804001:	48 83 c4 08          	add    $0x8,%rsp
+  804005:	5b                   	pop    %rbx
+  804006:	41 5c                	pop    %r12
+  804008:	41 5d                	pop    %r13
+  80400a:	5d                   	pop    %rbp
+  80400b:	c3                   	ret
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  80400c:	48 8d 7c 40 fd       	lea    -0x3(%rax,%rax,2),%rdi
+  804011:	41 39 4c fc 10       	cmp    %ecx,0x10(%r12,%rdi,8)
+  804016:	75 b0                	jne    803fc8 <collect_shared_region+0x61>
+            last->size += end - start;
+  804018:	49 29 dd             	sub    %rbx,%r13
+  80401b:	49 01 f5             	add    %rsi,%r13
+  80401e:	4c 89 6a f0          	mov    %r13,-0x10(%rdx)
+            return 0;
+  804022:	ba 00 00 00 00       	mov    $0x0,%edx
+  804027:	eb d6                	jmp    803fff <collect_shared_region+0x98>
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804029:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+  80402e:	eb cf                	jmp    803fff <collect_shared_region+0x98>
+
+0000000000804030 <spawn>:
+spawn(const char *prog, const char **argv) {
+  804030:	55                   	push   %rbp
+  804031:	48 89 e5             	mov    %rsp,%rbp
+  804034:	41 57                	push   %r15
+  804036:	41 56                	push   %r14
+  804038:	41 55                	push   %r13
+  80403a:	41 54                	push   %r12
+  80403c:	53                   	push   %rbx
+  80403d:	48 81 ec 18 05 00 00 	sub    $0x518,%rsp
+  804044:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  804047:	be 00 00 00 00       	mov    $0x0,%esi
+  80404c:	48 b8 e7 3b 80 00 00 	movabs $0x803be7,%rax
+  804053:	00 00 00 
+  804056:	ff d0                	call   *%rax
+  804058:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) return fd;
+  80405b:	85 c0                	test   %eax,%eax
+  80405d:	0f 88 8f 06 00 00    	js     8046f2 <spawn+0x6c2>
+    struct SpawnImage img = {
+  804063:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  80406a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80406f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804074:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804077:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  80407e:	00 00 00 
+  804081:	48 89 85 00 fd ff ff 	mov    %rax,-0x300(%rbp)
+  804088:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80408f:	00 00 00 
+  804092:	48 89 85 20 fd ff ff 	mov    %rax,-0x2e0(%rbp)
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+  804099:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  8040a0:	44 89 f7             	mov    %r14d,%edi
+  8040a3:	48 b8 31 36 80 00 00 	movabs $0x803631,%rax
+  8040aa:	00 00 00 
+  8040ad:	ff d0                	call   *%rax
+  8040af:	41 89 c4             	mov    %eax,%r12d
+  8040b2:	85 c0                	test   %eax,%eax
+  8040b4:	0f 88 26 06 00 00    	js     8046e0 <spawn+0x6b0>
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+  8040ba:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040c1:	48 85 c0             	test   %rax,%rax
+  8040c4:	74 22                	je     8040e8 <spawn+0xb8>
+  8040c6:	48 63 95 b0 fd ff ff 	movslq -0x250(%rbp),%rdx
+  8040cd:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+  8040d4:	48 89 95 e8 fc ff ff 	mov    %rdx,-0x318(%rbp)
+  8040db:	8b 85 c0 fd ff ff    	mov    -0x240(%rbp),%eax
+  8040e1:	48 89 85 f0 fc ff ff 	mov    %rax,-0x310(%rbp)
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+  8040e8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8040ed:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8040f2:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  8040f9:	00 00 00 
+  8040fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804101:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  804108:	00 00 00 
+  80410b:	ff d0                	call   *%rax
+  80410d:	41 89 c4             	mov    %eax,%r12d
+  804110:	85 c0                	test   %eax,%eax
+  804112:	0f 88 c8 05 00 00    	js     8046e0 <spawn+0x6b0>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804118:	48 8b 3b             	mov    (%rbx),%rdi
+  80411b:	48 85 ff             	test   %rdi,%rdi
+  80411e:	0f 84 61 02 00 00    	je     804385 <spawn+0x355>
+  804124:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  80412a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  804130:	49 bf dd 21 80 00 00 	movabs $0x8021dd,%r15
+  804137:	00 00 00 
+  80413a:	41 ff d7             	call   *%r15
+  80413d:	4d 8d 6c 05 01       	lea    0x1(%r13,%rax,1),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  804142:	4c 89 a5 d8 fa ff ff 	mov    %r12,-0x528(%rbp)
+  804149:	49 83 c4 01          	add    $0x1,%r12
+  80414d:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  804152:	48 85 ff             	test   %rdi,%rdi
+  804155:	75 e3                	jne    80413a <spawn+0x10a>
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  804157:	41 bc 00 00 01 00    	mov    $0x10000,%r12d
+  80415d:	4d 29 ec             	sub    %r13,%r12
+  804160:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  804167:	00 00 00 
+  80416a:	49 01 c4             	add    %rax,%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80416d:	4c 89 e1             	mov    %r12,%rcx
+  804170:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  804174:	48 89 8d d0 fa ff ff 	mov    %rcx,-0x530(%rbp)
+  80417b:	48 8b b5 d8 fa ff ff 	mov    -0x528(%rbp),%rsi
+  804182:	89 f0                	mov    %esi,%eax
+  804184:	83 c0 01             	add    $0x1,%eax
+  804187:	48 98                	cltq
+  804189:	48 c1 e0 03          	shl    $0x3,%rax
+  80418d:	48 29 c1             	sub    %rax,%rcx
+  804190:	48 89 8d c8 fa ff ff 	mov    %rcx,-0x538(%rbp)
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  804197:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  80419b:	48 ba ff ff ff ff 5f 	movabs $0x5fffffffff,%rdx
+  8041a2:	00 00 00 
+  8041a5:	48 39 c2             	cmp    %rax,%rdx
+  8041a8:	0f 83 f2 04 00 00    	jae    8046a0 <spawn+0x670>
+    for (i = 0; i < argc; i++) {
+  8041ae:	85 f6                	test   %esi,%esi
+  8041b0:	7e 4e                	jle    804200 <spawn+0x1d0>
+  8041b2:	49 89 cd             	mov    %rcx,%r13
+  8041b5:	48 63 c6             	movslq %esi,%rax
+  8041b8:	4c 8d 3c c1          	lea    (%rcx,%rax,8),%r15
+        argv_store[i] = STAGE2USTACK(string_store, stack);
+  8041bc:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  8041c3:	00 00 00 
+  8041c6:	4c 01 e0             	add    %r12,%rax
+  8041c9:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8041cd:	48 8b 33             	mov    (%rbx),%rsi
+  8041d0:	4c 89 e7             	mov    %r12,%rdi
+  8041d3:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8041da:	00 00 00 
+  8041dd:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8041df:	48 8b 3b             	mov    (%rbx),%rdi
+  8041e2:	48 b8 dd 21 80 00 00 	movabs $0x8021dd,%rax
+  8041e9:	00 00 00 
+  8041ec:	ff d0                	call   *%rax
+  8041ee:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  8041f3:	49 83 c5 08          	add    $0x8,%r13
+  8041f7:	48 83 c3 08          	add    $0x8,%rbx
+  8041fb:	4d 39 fd             	cmp    %r15,%r13
+  8041fe:	75 bc                	jne    8041bc <spawn+0x18c>
+    argv_store[argc] = 0;
+  804200:	48 8b 85 d0 fa ff ff 	mov    -0x530(%rbp),%rax
+  804207:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  80420e:	00 
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  80420f:	48 b8 00 00 01 00 60 	movabs $0x6000010000,%rax
+  804216:	00 00 00 
+  804219:	49 39 c4             	cmp    %rax,%r12
+  80421c:	0f 85 92 01 00 00    	jne    8043b4 <spawn+0x384>
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
+  804222:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804229:	00 00 00 
+  80422c:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  804233:	48 01 d0             	add    %rdx,%rax
+  804236:	48 89 42 f8          	mov    %rax,-0x8(%rdx)
+    argv_store[-2] = argc;
+  80423a:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  804241:	48 89 42 f0          	mov    %rax,-0x10(%rdx)
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+  804245:	48 b8 f0 6f fe ff 1f 	movabs $0x1ffffe6ff0,%rax
+  80424c:	00 00 00 
+  80424f:	48 01 d0             	add    %rdx,%rax
+  804252:	48 89 85 08 fd ff ff 	mov    %rax,-0x2f8(%rbp)
+    shared.count = 0;
+  804259:	48 be 20 a0 80 01 00 	movabs $0x180a020,%rsi
+  804260:	00 00 00 
+  804263:	48 c7 86 00 18 00 00 	movq   $0x0,0x1800(%rsi)
+  80426a:	00 00 00 00 
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+  80426e:	48 bf 67 3f 80 00 00 	movabs $0x803f67,%rdi
+  804275:	00 00 00 
+  804278:	48 b8 5b 4e 80 00 00 	movabs $0x804e5b,%rax
+  80427f:	00 00 00 
+  804282:	ff d0                	call   *%rax
+  804284:	41 89 c4             	mov    %eax,%r12d
+  804287:	85 c0                	test   %eax,%eax
+  804289:	0f 88 24 04 00 00    	js     8046b3 <spawn+0x683>
+    img.nshared = shared.count;
+  80428f:	48 a1 20 b8 80 01 00 	movabs 0x180b820,%rax
+  804296:	00 00 00 
+  804299:	48 89 85 28 fd ff ff 	mov    %rax,-0x2d8(%rbp)
+    if (img.key.size) {
+  8042a0:	48 83 bd e8 fc ff ff 	cmpq   $0x0,-0x318(%rbp)
+  8042a7:	00 
+  8042a8:	74 1f                	je     8042c9 <spawn+0x299>
+        res = sys_spawn(&img);
+  8042aa:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  8042b1:	48 b8 f1 2c 80 00 00 	movabs $0x802cf1,%rax
+  8042b8:	00 00 00 
+  8042bb:	ff d0                	call   *%rax
+  8042bd:	41 89 c4             	mov    %eax,%r12d
+        if (res != -E_NOT_FOUND) goto done;
+  8042c0:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8042c3:	0f 85 ca 03 00 00    	jne    804693 <spawn+0x663>
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8042c9:	ba 00 02 00 00       	mov    $0x200,%edx
+  8042ce:	48 8d b5 e0 fa ff ff 	lea    -0x520(%rbp),%rsi
+  8042d5:	44 89 f7             	mov    %r14d,%edi
+  8042d8:	48 b8 0d 34 80 00 00 	movabs $0x80340d,%rax
+  8042df:	00 00 00 
+  8042e2:	ff d0                	call   *%rax
+  8042e4:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8042e6:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8042eb:	0f 85 f8 00 00 00    	jne    8043e9 <spawn+0x3b9>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8042f1:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8042f8:	ff ff 00 
+  8042fb:	48 23 85 e0 fa ff ff 	and    -0x520(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  804302:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  804309:	01 01 00 
+  80430c:	48 39 d0             	cmp    %rdx,%rax
+  80430f:	0f 85 f7 00 00 00    	jne    80440c <spawn+0x3dc>
+        elf->e_type != ET_EXEC /* executable */ ||
+  804315:	81 bd f0 fa ff ff 02 	cmpl   $0x3e0002,-0x510(%rbp)
+  80431c:	00 3e 00 
+  80431f:	0f 85 e7 00 00 00    	jne    80440c <spawn+0x3dc>
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
+  804325:	48 8b 95 00 fb ff ff 	mov    -0x500(%rbp),%rdx
+  80432c:	44 0f b7 85 18 fb ff 	movzwl -0x4e8(%rbp),%r8d
+  804333:	ff 
+  804334:	4a 8d 04 c5 00 00 00 	lea    0x0(,%r8,8),%rax
+  80433b:	00 
+  80433c:	4c 29 c0             	sub    %r8,%rax
+  80433f:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+        elf->e_machine != 0x3E /* amd64 */ ||
+  804343:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  804349:	0f 87 bd 00 00 00    	ja     80440c <spawn+0x3dc>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80434f:	48 8d 84 15 e0 fa ff 	lea    -0x520(%rbp,%rdx,1),%rax
+  804356:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804357:	4d 85 c0             	test   %r8,%r8
+  80435a:	0f 84 1b 02 00 00    	je     80457b <spawn+0x54b>
+  804360:	ba 00 00 00 00       	mov    $0x0,%edx
+    size_t nsegs = 0, start = *staged, end = start;
+  804365:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80436c:	00 00 01 00 
+  804370:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  804376:	49 ba 00 00 00 00 60 	movabs $0x6000000000,%r10
+  80437d:	00 00 00 
+  804380:	e9 d4 00 00 00       	jmp    804459 <spawn+0x429>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804385:	48 c7 85 d8 fa ff ff 	movq   $0x0,-0x528(%rbp)
+  80438c:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804390:	48 b8 f8 ff 00 00 60 	movabs $0x600000fff8,%rax
+  804397:	00 00 00 
+  80439a:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8043a1:	48 8d 40 08          	lea    0x8(%rax),%rax
+  8043a5:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  8043ac:	49 89 c4             	mov    %rax,%r12
+  8043af:	e9 4c fe ff ff       	jmp    804200 <spawn+0x1d0>
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  8043b4:	48 b9 10 6e 80 00 00 	movabs $0x806e10,%rcx
+  8043bb:	00 00 00 
+  8043be:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  8043c5:	00 00 00 
+  8043c8:	be e2 00 00 00       	mov    $0xe2,%esi
+  8043cd:	48 bf 69 6e 80 00 00 	movabs $0x806e69,%rdi
+  8043d4:	00 00 00 
+  8043d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043dc:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  8043e3:	00 00 00 
+  8043e6:	41 ff d0             	call   *%r8
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8043e9:	48 bf 40 6e 80 00 00 	movabs $0x806e40,%rdi
+  8043f0:	00 00 00 
+  8043f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f8:	48 ba e4 18 80 00 00 	movabs $0x8018e4,%rdx
+  8043ff:	00 00 00 
+  804402:	ff d2                	call   *%rdx
+        return -E_NOT_EXEC;
+  804404:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  80440a:	eb 2c                	jmp    804438 <spawn+0x408>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80440c:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804411:	8b b5 e0 fa ff ff    	mov    -0x520(%rbp),%esi
+  804417:	48 bf 75 6e 80 00 00 	movabs $0x806e75,%rdi
+  80441e:	00 00 00 
+  804421:	b8 00 00 00 00       	mov    $0x0,%eax
+  804426:	48 b9 e4 18 80 00 00 	movabs $0x8018e4,%rcx
+  80442d:	00 00 00 
+  804430:	ff d1                	call   *%rcx
+        return -E_NOT_EXEC;
+  804432:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804438:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80443f:	00 00 01 00 
+  804443:	e9 76 02 00 00       	jmp    8046be <spawn+0x68e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804448:	48 83 c2 01          	add    $0x1,%rdx
+  80444c:	48 83 c0 38          	add    $0x38,%rax
+  804450:	49 39 d0             	cmp    %rdx,%r8
+  804453:	0f 84 a5 00 00 00    	je     8044fe <spawn+0x4ce>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  804459:	83 38 01             	cmpl   $0x1,(%rax)
+  80445c:	75 ea                	jne    804448 <spawn+0x418>
+  80445e:	48 8b 70 28          	mov    0x28(%rax),%rsi
+  804462:	48 85 f6             	test   %rsi,%rsi
+  804465:	74 e1                	je     804448 <spawn+0x418>
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804467:	49 83 ff 10          	cmp    $0x10,%r15
+  80446b:	0f 84 a1 02 00 00    	je     804712 <spawn+0x6e2>
+  804471:	48 3b 70 20          	cmp    0x20(%rax),%rsi
+  804475:	0f 82 aa 02 00 00    	jb     804725 <spawn+0x6f5>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+  80447b:	8b 78 04             	mov    0x4(%rax),%edi
+  80447e:	89 f9                	mov    %edi,%ecx
+  804480:	83 e1 02             	and    $0x2,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+  804483:	41 89 c9             	mov    %ecx,%r9d
+  804486:	41 83 c9 04          	or     $0x4,%r9d
+  80448a:	40 f6 c7 04          	test   $0x4,%dil
+  80448e:	41 0f 45 c9          	cmovne %r9d,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+  804492:	41 89 c9             	mov    %ecx,%r9d
+  804495:	41 83 c9 01          	or     $0x1,%r9d
+  804499:	40 f6 c7 01          	test   $0x1,%dil
+  80449d:	41 0f 45 c9          	cmovne %r9d,%ecx
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+  8044a1:	48 8b 78 10          	mov    0x10(%rax),%rdi
+  8044a5:	49 89 f9             	mov    %rdi,%r9
+  8044a8:	49 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%r9
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+  8044af:	48 8d b4 3e ff 0f 00 	lea    0xfff(%rsi,%rdi,1),%rsi
+  8044b6:	00 
+  8044b7:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8044be:	4c 29 ce             	sub    %r9,%rsi
+        segs[nsegs++] = (struct SpawnSegment){
+  8044c1:	4c 89 ff             	mov    %r15,%rdi
+  8044c4:	48 c1 e7 05          	shl    $0x5,%rdi
+  8044c8:	48 8d 9d d0 fd ff ff 	lea    -0x230(%rbp),%rbx
+  8044cf:	48 01 df             	add    %rbx,%rdi
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  8044d2:	48 8b 9d d8 fa ff ff 	mov    -0x528(%rbp),%rbx
+  8044d9:	4e 8d 1c 13          	lea    (%rbx,%r10,1),%r11
+  8044dd:	4c 89 1f             	mov    %r11,(%rdi)
+        segs[nsegs++] = (struct SpawnSegment){
+  8044e0:	4c 89 4f 08          	mov    %r9,0x8(%rdi)
+  8044e4:	48 89 77 10          	mov    %rsi,0x10(%rdi)
+  8044e8:	89 4f 18             	mov    %ecx,0x18(%rdi)
+        end += size;
+  8044eb:	48 01 f3             	add    %rsi,%rbx
+  8044ee:	48 89 9d d8 fa ff ff 	mov    %rbx,-0x528(%rbp)
+        segs[nsegs++] = (struct SpawnSegment){
+  8044f5:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+  8044f9:	e9 4a ff ff ff       	jmp    804448 <spawn+0x418>
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  8044fe:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  804505:	00 00 00 
+  804508:	48 8b 8d d8 fa ff ff 	mov    -0x528(%rbp),%rcx
+  80450f:	48 39 c8             	cmp    %rcx,%rax
+  804512:	0f 82 ef 01 00 00    	jb     804707 <spawn+0x6d7>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+  804518:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  80451f:	48 8d 90 00 00 ff ff 	lea    -0x10000(%rax),%rdx
+  804526:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80452b:	48 be 00 00 01 00 60 	movabs $0x6000010000,%rsi
+  804532:	00 00 00 
+  804535:	bf 00 00 00 00       	mov    $0x0,%edi
+  80453a:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  804541:	00 00 00 
+  804544:	ff d0                	call   *%rax
+  804546:	41 89 c4             	mov    %eax,%r12d
+  804549:	85 c0                	test   %eax,%eax
+  80454b:	0f 88 e7 fe ff ff    	js     804438 <spawn+0x408>
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804551:	48 8b 85 00 fb ff ff 	mov    -0x500(%rbp),%rax
+  804558:	48 8d 9c 05 e0 fa ff 	lea    -0x520(%rbp,%rax,1),%rbx
+  80455f:	ff 
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  804560:	66 83 bd 18 fb ff ff 	cmpw   $0x0,-0x4e8(%rbp)
+  804567:	00 
+  804568:	0f 84 d3 00 00 00    	je     804641 <spawn+0x611>
+  80456e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804574:	ba 00 00 00 00       	mov    $0x0,%edx
+  804579:	eb 46                	jmp    8045c1 <spawn+0x591>
+    size_t nsegs = 0, start = *staged, end = start;
+  80457b:	4d 89 c7             	mov    %r8,%r15
+  80457e:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804585:	00 00 01 00 
+  804589:	eb 8d                	jmp    804518 <spawn+0x4e8>
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  80458b:	48 85 c0             	test   %rax,%rax
+  80458e:	48 c7 c2 ee ff ff ff 	mov    $0xffffffffffffffee,%rdx
+  804595:	48 0f 49 c2          	cmovns %rdx,%rax
+  804599:	41 89 c4             	mov    %eax,%r12d
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+  80459c:	85 c0                	test   %eax,%eax
+  80459e:	0f 89 c0 00 00 00    	jns    804664 <spawn+0x634>
+  8045a4:	e9 15 01 00 00       	jmp    8046be <spawn+0x68e>
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  8045a9:	49 83 c5 01          	add    $0x1,%r13
+  8045ad:	48 83 c3 38          	add    $0x38,%rbx
+  8045b1:	0f b7 85 18 fb ff ff 	movzwl -0x4e8(%rbp),%eax
+  8045b8:	49 39 c5             	cmp    %rax,%r13
+  8045bb:	0f 83 80 00 00 00    	jae    804641 <spawn+0x611>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  8045c1:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8045c4:	75 e3                	jne    8045a9 <spawn+0x579>
+  8045c6:	48 83 7b 28 00       	cmpq   $0x0,0x28(%rbx)
+  8045cb:	74 dc                	je     8045a9 <spawn+0x579>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  8045cd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8045d1:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8045d8:	48 c1 e2 05          	shl    $0x5,%rdx
+  8045dc:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8045e0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8045e5:	48 03 84 15 d0 fd ff 	add    -0x230(%rbp,%rdx,1),%rax
+  8045ec:	ff 
+  8045ed:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
+  8045f4:	8b 73 08             	mov    0x8(%rbx),%esi
+  8045f7:	44 89 f7             	mov    %r14d,%edi
+  8045fa:	48 ba 37 35 80 00 00 	movabs $0x803537,%rdx
+  804601:	00 00 00 
+  804604:	ff d2                	call   *%rdx
+  804606:	41 89 c4             	mov    %eax,%r12d
+  804609:	85 c0                	test   %eax,%eax
+  80460b:	0f 88 ad 00 00 00    	js     8046be <spawn+0x68e>
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+  804611:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  804615:	48 8b b5 d0 fa ff ff 	mov    -0x530(%rbp),%rsi
+  80461c:	44 89 f7             	mov    %r14d,%edi
+  80461f:	48 b8 0d 34 80 00 00 	movabs $0x80340d,%rax
+  804626:	00 00 00 
+  804629:	ff d0                	call   *%rax
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  80462b:	48 39 43 20          	cmp    %rax,0x20(%rbx)
+  80462f:	0f 85 56 ff ff ff    	jne    80458b <spawn+0x55b>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  804635:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  80463c:	e9 68 ff ff ff       	jmp    8045a9 <spawn+0x579>
+    img->entry = elf->e_entry;
+  804641:	48 8b 85 f8 fa ff ff 	mov    -0x508(%rbp),%rax
+  804648:	48 89 85 f8 fc ff ff 	mov    %rax,-0x308(%rbp)
+    img->segments = segs;
+  80464f:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804656:	48 89 85 10 fd ff ff 	mov    %rax,-0x2f0(%rbp)
+    img->nsegments = nsegs;
+  80465d:	4c 89 bd 18 fd ff ff 	mov    %r15,-0x2e8(%rbp)
+    res = sys_spawn(&img);
+  804664:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  80466b:	48 b8 f1 2c 80 00 00 	movabs $0x802cf1,%rax
+  804672:	00 00 00 
+  804675:	ff d0                	call   *%rax
+  804677:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  80467a:	45 85 e4             	test   %r12d,%r12d
+  80467d:	78 3f                	js     8046be <spawn+0x68e>
+    close(fd);
+  80467f:	44 89 f7             	mov    %r14d,%edi
+  804682:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  804689:	00 00 00 
+  80468c:	ff d0                	call   *%rax
+    return res;
+  80468e:	45 89 e6             	mov    %r12d,%r14d
+  804691:	eb 5f                	jmp    8046f2 <spawn+0x6c2>
+    size_t staged = USER_STACK_SIZE;
+  804693:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80469a:	00 00 01 00 
+  80469e:	eb da                	jmp    80467a <spawn+0x64a>
+  8046a0:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8046a7:	00 00 01 00 
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  8046ab:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  8046b1:	eb 0b                	jmp    8046be <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  8046b3:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8046ba:	00 00 01 00 
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+  8046be:	48 8b 95 d8 fa ff ff 	mov    -0x528(%rbp),%rdx
+  8046c5:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  8046cc:	00 00 00 
+  8046cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046d4:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  8046db:	00 00 00 
+  8046de:	ff d0                	call   *%rax
+    close(fd);
+  8046e0:	44 89 f7             	mov    %r14d,%edi
+  8046e3:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  8046ea:	00 00 00 
+  8046ed:	ff d0                	call   *%rax
+    return res;
+  8046ef:	45 89 e6             	mov    %r12d,%r14d
+}
+  8046f2:	44 89 f0             	mov    %r14d,%eax
+  8046f5:	48 81 c4 18 05 00 00 	add    $0x518,%rsp
+  8046fc:	5b                   	pop    %rbx
+  8046fd:	41 5c                	pop    %r12
+  8046ff:	41 5d                	pop    %r13
+  804701:	41 5e                	pop    %r14
+  804703:	41 5f                	pop    %r15
+  804705:	5d                   	pop    %rbp
+  804706:	c3                   	ret
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804707:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  80470d:	e9 26 fd ff ff       	jmp    804438 <spawn+0x408>
+    size_t staged = USER_STACK_SIZE;
+  804712:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804719:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  80471d:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804723:	eb 99                	jmp    8046be <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804725:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80472c:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804730:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804736:	eb 86                	jmp    8046be <spawn+0x68e>
+
+0000000000804738 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804738:	55                   	push   %rbp
+  804739:	48 89 e5             	mov    %rsp,%rbp
+  80473c:	48 83 ec 50          	sub    $0x50,%rsp
+  804740:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804744:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804748:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80474c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804750:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804757:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80475b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80475f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804763:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804767:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  80476c:	eb 15                	jmp    804783 <spawnl+0x4b>
+  80476e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804772:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804776:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80477a:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80477e:	74 1c                	je     80479c <spawnl+0x64>
+  804780:	83 c1 01             	add    $0x1,%ecx
+  804783:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804786:	83 f8 2f             	cmp    $0x2f,%eax
+  804789:	77 e3                	ja     80476e <spawnl+0x36>
+  80478b:	89 c2                	mov    %eax,%edx
+  80478d:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804791:	4c 01 d2             	add    %r10,%rdx
+  804794:	83 c0 08             	add    $0x8,%eax
+  804797:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80479a:	eb de                	jmp    80477a <spawnl+0x42>
+    const char *argv[argc + 2];
+  80479c:	8d 41 02             	lea    0x2(%rcx),%eax
+  80479f:	48 98                	cltq
+  8047a1:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8047a8:	00 
+  8047a9:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8047ad:	48 29 c4             	sub    %rax,%rsp
+  8047b0:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8047b5:	4c 89 c0             	mov    %r8,%rax
+  8047b8:	48 c1 e8 03          	shr    $0x3,%rax
+  8047bc:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8047c0:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8047c7:	00 
+    argv[argc + 1] = NULL;
+  8047c8:	8d 41 01             	lea    0x1(%rcx),%eax
+  8047cb:	48 98                	cltq
+  8047cd:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8047d4:	00 
+    va_start(vl, arg0);
+  8047d5:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8047dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8047e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8047e4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8047e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8047ec:	85 c9                	test   %ecx,%ecx
+  8047ee:	74 41                	je     804831 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8047f0:	49 89 c1             	mov    %rax,%r9
+  8047f3:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8047f7:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8047fa:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8047ff:	eb 1b                	jmp    80481c <spawnl+0xe4>
+  804801:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804805:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804809:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80480d:	48 8b 11             	mov    (%rcx),%rdx
+  804810:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804813:	48 83 c0 08          	add    $0x8,%rax
+  804817:	48 39 f0             	cmp    %rsi,%rax
+  80481a:	74 15                	je     804831 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80481c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80481f:	83 fa 2f             	cmp    $0x2f,%edx
+  804822:	77 dd                	ja     804801 <spawnl+0xc9>
+  804824:	89 d1                	mov    %edx,%ecx
+  804826:	4c 01 c9             	add    %r9,%rcx
+  804829:	83 c2 08             	add    $0x8,%edx
+  80482c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80482f:	eb dc                	jmp    80480d <spawnl+0xd5>
+    return spawn(prog, argv);
+  804831:	4c 89 c6             	mov    %r8,%rsi
+  804834:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  80483b:	00 00 00 
+  80483e:	ff d0                	call   *%rax
+}
+  804840:	c9                   	leave
+  804841:	c3                   	ret
+
+0000000000804842 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804842:	55                   	push   %rbp
+  804843:	48 89 e5             	mov    %rsp,%rbp
+  804846:	41 54                	push   %r12
+  804848:	53                   	push   %rbx
+  804849:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80484c:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  804853:	00 00 00 
+  804856:	ff d0                	call   *%rax
+  804858:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80485b:	48 be 8f 6e 80 00 00 	movabs $0x806e8f,%rsi
+  804862:	00 00 00 
+  804865:	48 89 df             	mov    %rbx,%rdi
+  804868:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80486f:	00 00 00 
+  804872:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804874:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804879:	41 2b 04 24          	sub    (%r12),%eax
+  80487d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804883:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80488a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80488d:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804894:	00 00 00 
+  804897:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80489e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048a3:	5b                   	pop    %rbx
+  8048a4:	41 5c                	pop    %r12
+  8048a6:	5d                   	pop    %rbp
+  8048a7:	c3                   	ret
+
+00000000008048a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8048a8:	55                   	push   %rbp
+  8048a9:	48 89 e5             	mov    %rsp,%rbp
+  8048ac:	41 54                	push   %r12
+  8048ae:	53                   	push   %rbx
+  8048af:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8048b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048b7:	48 89 fe             	mov    %rdi,%rsi
+  8048ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048bf:	49 bc 58 2a 80 00 00 	movabs $0x802a58,%r12
+  8048c6:	00 00 00 
+  8048c9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8048cc:	48 89 df             	mov    %rbx,%rdi
+  8048cf:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  8048d6:	00 00 00 
+  8048d9:	ff d0                	call   *%rax
+  8048db:	48 89 c6             	mov    %rax,%rsi
+  8048de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048e8:	41 ff d4             	call   *%r12
+}
+  8048eb:	5b                   	pop    %rbx
+  8048ec:	41 5c                	pop    %r12
+  8048ee:	5d                   	pop    %rbp
+  8048ef:	c3                   	ret
+
+00000000008048f0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8048f0:	55                   	push   %rbp
+  8048f1:	48 89 e5             	mov    %rsp,%rbp
+  8048f4:	41 57                	push   %r15
+  8048f6:	41 56                	push   %r14
+  8048f8:	41 55                	push   %r13
+  8048fa:	41 54                	push   %r12
+  8048fc:	53                   	push   %rbx
+  8048fd:	48 83 ec 18          	sub    $0x18,%rsp
+  804901:	49 89 fc             	mov    %rdi,%r12
+  804904:	49 89 f5             	mov    %rsi,%r13
+  804907:	49 89 d7             	mov    %rdx,%r15
+  80490a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80490e:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  804915:	00 00 00 
+  804918:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80491a:	4d 85 ff             	test   %r15,%r15
+  80491d:	0f 84 af 00 00 00    	je     8049d2 <devpipe_write+0xe2>
+  804923:	48 89 c3             	mov    %rax,%rbx
+  804926:	4c 89 f8             	mov    %r15,%rax
+  804929:	4d 89 ef             	mov    %r13,%r15
+  80492c:	4c 01 e8             	add    %r13,%rax
+  80492f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804933:	49 bd 4e 29 80 00 00 	movabs $0x80294e,%r13
+  80493a:	00 00 00 
+            sys_yield();
+  80493d:	49 be df 28 80 00 00 	movabs $0x8028df,%r14
+  804944:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804947:	8b 73 04             	mov    0x4(%rbx),%esi
+  80494a:	48 63 ce             	movslq %esi,%rcx
+  80494d:	48 63 03             	movslq (%rbx),%rax
+  804950:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804956:	48 39 c1             	cmp    %rax,%rcx
+  804959:	72 2e                	jb     804989 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80495b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804960:	48 89 da             	mov    %rbx,%rdx
+  804963:	be 00 10 00 00       	mov    $0x1000,%esi
+  804968:	4c 89 e7             	mov    %r12,%rdi
+  80496b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80496e:	85 c0                	test   %eax,%eax
+  804970:	74 66                	je     8049d8 <devpipe_write+0xe8>
+            sys_yield();
+  804972:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804975:	8b 73 04             	mov    0x4(%rbx),%esi
+  804978:	48 63 ce             	movslq %esi,%rcx
+  80497b:	48 63 03             	movslq (%rbx),%rax
+  80497e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804984:	48 39 c1             	cmp    %rax,%rcx
+  804987:	73 d2                	jae    80495b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804989:	41 0f b6 3f          	movzbl (%r15),%edi
+  80498d:	48 89 ca             	mov    %rcx,%rdx
+  804990:	48 c1 ea 03          	shr    $0x3,%rdx
+  804994:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80499b:	08 10 20 
+  80499e:	48 f7 e2             	mul    %rdx
+  8049a1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8049a5:	48 89 d0             	mov    %rdx,%rax
+  8049a8:	48 c1 e0 09          	shl    $0x9,%rax
+  8049ac:	48 29 d0             	sub    %rdx,%rax
+  8049af:	48 c1 e0 03          	shl    $0x3,%rax
+  8049b3:	48 29 c1             	sub    %rax,%rcx
+  8049b6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8049bb:	83 c6 01             	add    $0x1,%esi
+  8049be:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8049c1:	49 83 c7 01          	add    $0x1,%r15
+  8049c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049c9:	49 39 c7             	cmp    %rax,%r15
+  8049cc:	0f 85 75 ff ff ff    	jne    804947 <devpipe_write+0x57>
+    return n;
+  8049d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049d6:	eb 05                	jmp    8049dd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8049d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049dd:	48 83 c4 18          	add    $0x18,%rsp
+  8049e1:	5b                   	pop    %rbx
+  8049e2:	41 5c                	pop    %r12
+  8049e4:	41 5d                	pop    %r13
+  8049e6:	41 5e                	pop    %r14
+  8049e8:	41 5f                	pop    %r15
+  8049ea:	5d                   	pop    %rbp
+  8049eb:	c3                   	ret
+
+00000000008049ec <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8049ec:	55                   	push   %rbp
+  8049ed:	48 89 e5             	mov    %rsp,%rbp
+  8049f0:	41 57                	push   %r15
+  8049f2:	41 56                	push   %r14
+  8049f4:	41 55                	push   %r13
+  8049f6:	41 54                	push   %r12
+  8049f8:	53                   	push   %rbx
+  8049f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8049fd:	49 89 fc             	mov    %rdi,%r12
+  804a00:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804a04:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804a08:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  804a0f:	00 00 00 
+  804a12:	ff d0                	call   *%rax
+  804a14:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804a17:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804a1d:	49 bd 4e 29 80 00 00 	movabs $0x80294e,%r13
+  804a24:	00 00 00 
+            sys_yield();
+  804a27:	49 be df 28 80 00 00 	movabs $0x8028df,%r14
+  804a2e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804a31:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804a36:	74 7d                	je     804ab5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804a38:	8b 03                	mov    (%rbx),%eax
+  804a3a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804a3d:	75 26                	jne    804a65 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804a3f:	4d 85 ff             	test   %r15,%r15
+  804a42:	75 77                	jne    804abb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804a44:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804a49:	48 89 da             	mov    %rbx,%rdx
+  804a4c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a51:	4c 89 e7             	mov    %r12,%rdi
+  804a54:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804a57:	85 c0                	test   %eax,%eax
+  804a59:	74 72                	je     804acd <devpipe_read+0xe1>
+            sys_yield();
+  804a5b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804a5e:	8b 03                	mov    (%rbx),%eax
+  804a60:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804a63:	74 df                	je     804a44 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804a65:	48 63 c8             	movslq %eax,%rcx
+  804a68:	48 89 ca             	mov    %rcx,%rdx
+  804a6b:	48 c1 ea 03          	shr    $0x3,%rdx
+  804a6f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804a76:	08 10 20 
+  804a79:	48 89 d0             	mov    %rdx,%rax
+  804a7c:	48 f7 e6             	mul    %rsi
+  804a7f:	48 c1 ea 06          	shr    $0x6,%rdx
+  804a83:	48 89 d0             	mov    %rdx,%rax
+  804a86:	48 c1 e0 09          	shl    $0x9,%rax
+  804a8a:	48 29 d0             	sub    %rdx,%rax
+  804a8d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804a94:	00 
+  804a95:	48 89 c8             	mov    %rcx,%rax
+  804a98:	48 29 d0             	sub    %rdx,%rax
+  804a9b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804aa0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804aa4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804aa8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804aab:	49 83 c7 01          	add    $0x1,%r15
+  804aaf:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804ab3:	75 83                	jne    804a38 <devpipe_read+0x4c>
+    return n;
+  804ab5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ab9:	eb 03                	jmp    804abe <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804abb:	4c 89 f8             	mov    %r15,%rax
+}
+  804abe:	48 83 c4 18          	add    $0x18,%rsp
+  804ac2:	5b                   	pop    %rbx
+  804ac3:	41 5c                	pop    %r12
+  804ac5:	41 5d                	pop    %r13
+  804ac7:	41 5e                	pop    %r14
+  804ac9:	41 5f                	pop    %r15
+  804acb:	5d                   	pop    %rbp
+  804acc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ad2:	eb ea                	jmp    804abe <devpipe_read+0xd2>
+
+0000000000804ad4 <pipe>:
+pipe(int pfd[2]) {
+  804ad4:	55                   	push   %rbp
+  804ad5:	48 89 e5             	mov    %rsp,%rbp
+  804ad8:	41 55                	push   %r13
+  804ada:	41 54                	push   %r12
+  804adc:	53                   	push   %rbx
+  804add:	48 83 ec 18          	sub    $0x18,%rsp
+  804ae1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804ae4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804ae8:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  804aef:	00 00 00 
+  804af2:	ff d0                	call   *%rax
+  804af4:	89 c3                	mov    %eax,%ebx
+  804af6:	85 c0                	test   %eax,%eax
+  804af8:	0f 88 a0 01 00 00    	js     804c9e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804afe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804b03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b08:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b11:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  804b18:	00 00 00 
+  804b1b:	ff d0                	call   *%rax
+  804b1d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804b1f:	85 c0                	test   %eax,%eax
+  804b21:	0f 88 77 01 00 00    	js     804c9e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804b27:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804b2b:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  804b32:	00 00 00 
+  804b35:	ff d0                	call   *%rax
+  804b37:	89 c3                	mov    %eax,%ebx
+  804b39:	85 c0                	test   %eax,%eax
+  804b3b:	0f 88 43 01 00 00    	js     804c84 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804b41:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804b46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b4b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b54:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  804b5b:	00 00 00 
+  804b5e:	ff d0                	call   *%rax
+  804b60:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804b62:	85 c0                	test   %eax,%eax
+  804b64:	0f 88 1a 01 00 00    	js     804c84 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804b6a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804b6e:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  804b75:	00 00 00 
+  804b78:	ff d0                	call   *%rax
+  804b7a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804b7d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804b82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b87:	48 89 c6             	mov    %rax,%rsi
+  804b8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b8f:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  804b96:	00 00 00 
+  804b99:	ff d0                	call   *%rax
+  804b9b:	89 c3                	mov    %eax,%ebx
+  804b9d:	85 c0                	test   %eax,%eax
+  804b9f:	0f 88 c5 00 00 00    	js     804c6a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804ba5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804ba9:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  804bb0:	00 00 00 
+  804bb3:	ff d0                	call   *%rax
+  804bb5:	48 89 c1             	mov    %rax,%rcx
+  804bb8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804bbe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bc9:	4c 89 ee             	mov    %r13,%rsi
+  804bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bd1:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  804bd8:	00 00 00 
+  804bdb:	ff d0                	call   *%rax
+  804bdd:	89 c3                	mov    %eax,%ebx
+  804bdf:	85 c0                	test   %eax,%eax
+  804be1:	78 6e                	js     804c51 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804be3:	be 00 10 00 00       	mov    $0x1000,%esi
+  804be8:	4c 89 ef             	mov    %r13,%rdi
+  804beb:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  804bf2:	00 00 00 
+  804bf5:	ff d0                	call   *%rax
+  804bf7:	83 f8 02             	cmp    $0x2,%eax
+  804bfa:	0f 85 ab 00 00 00    	jne    804cab <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804c00:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804c07:	00 00 
+  804c09:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c0d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804c0f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c13:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804c1a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804c1e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804c20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c24:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804c2b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804c2f:	48 bb de 2f 80 00 00 	movabs $0x802fde,%rbx
+  804c36:	00 00 00 
+  804c39:	ff d3                	call   *%rbx
+  804c3b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804c3f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804c43:	ff d3                	call   *%rbx
+  804c45:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804c4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804c4f:	eb 4d                	jmp    804c9e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804c51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c56:	4c 89 ee             	mov    %r13,%rsi
+  804c59:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c5e:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  804c65:	00 00 00 
+  804c68:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804c6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c6f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c78:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  804c7f:	00 00 00 
+  804c82:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804c84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c89:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804c8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c92:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  804c99:	00 00 00 
+  804c9c:	ff d0                	call   *%rax
+}
+  804c9e:	89 d8                	mov    %ebx,%eax
+  804ca0:	48 83 c4 18          	add    $0x18,%rsp
+  804ca4:	5b                   	pop    %rbx
+  804ca5:	41 5c                	pop    %r12
+  804ca7:	41 5d                	pop    %r13
+  804ca9:	5d                   	pop    %rbp
+  804caa:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804cab:	48 b9 a8 6e 80 00 00 	movabs $0x806ea8,%rcx
+  804cb2:	00 00 00 
+  804cb5:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  804cbc:	00 00 00 
+  804cbf:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804cc4:	48 bf 96 6e 80 00 00 	movabs $0x806e96,%rdi
+  804ccb:	00 00 00 
+  804cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd3:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  804cda:	00 00 00 
+  804cdd:	41 ff d0             	call   *%r8
+
+0000000000804ce0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804ce0:	55                   	push   %rbp
+  804ce1:	48 89 e5             	mov    %rsp,%rbp
+  804ce4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ce8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804cec:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  804cf3:	00 00 00 
+  804cf6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804cf8:	85 c0                	test   %eax,%eax
+  804cfa:	78 35                	js     804d31 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804cfc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804d00:	48 b8 f0 2f 80 00 00 	movabs $0x802ff0,%rax
+  804d07:	00 00 00 
+  804d0a:	ff d0                	call   *%rax
+  804d0c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d0f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804d14:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d19:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804d1d:	48 b8 4e 29 80 00 00 	movabs $0x80294e,%rax
+  804d24:	00 00 00 
+  804d27:	ff d0                	call   *%rax
+  804d29:	85 c0                	test   %eax,%eax
+  804d2b:	0f 94 c0             	sete   %al
+  804d2e:	0f b6 c0             	movzbl %al,%eax
+}
+  804d31:	c9                   	leave
+  804d32:	c3                   	ret
+
+0000000000804d33 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804d33:	48 89 f8             	mov    %rdi,%rax
+  804d36:	48 c1 e8 27          	shr    $0x27,%rax
+  804d3a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804d41:	01 00 00 
+  804d44:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804d48:	f6 c2 01             	test   $0x1,%dl
+  804d4b:	74 6d                	je     804dba <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804d4d:	48 89 f8             	mov    %rdi,%rax
+  804d50:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804d54:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804d5b:	01 00 00 
+  804d5e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804d62:	f6 c2 01             	test   $0x1,%dl
+  804d65:	74 62                	je     804dc9 <get_uvpt_entry+0x96>
+  804d67:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804d6e:	01 00 00 
+  804d71:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804d75:	f6 c2 80             	test   $0x80,%dl
+  804d78:	75 4f                	jne    804dc9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804d7a:	48 89 f8             	mov    %rdi,%rax
+  804d7d:	48 c1 e8 15          	shr    $0x15,%rax
+  804d81:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804d88:	01 00 00 
+  804d8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804d8f:	f6 c2 01             	test   $0x1,%dl
+  804d92:	74 44                	je     804dd8 <get_uvpt_entry+0xa5>
+  804d94:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804d9b:	01 00 00 
+  804d9e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804da2:	f6 c2 80             	test   $0x80,%dl
+  804da5:	75 31                	jne    804dd8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804da7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804dab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804db2:	01 00 00 
+  804db5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804db9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804dba:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804dc1:	01 00 00 
+  804dc4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804dc8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804dc9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804dd0:	01 00 00 
+  804dd3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804dd7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804dd8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804ddf:	01 00 00 
+  804de2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804de6:	c3                   	ret
+
+0000000000804de7 <get_prot>:
+
+int
+get_prot(void *va) {
+  804de7:	55                   	push   %rbp
+  804de8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804deb:	48 b8 33 4d 80 00 00 	movabs $0x804d33,%rax
+  804df2:	00 00 00 
+  804df5:	ff d0                	call   *%rax
+  804df7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804dfa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804dff:	89 c1                	mov    %eax,%ecx
+  804e01:	83 c9 04             	or     $0x4,%ecx
+  804e04:	f6 c2 01             	test   $0x1,%dl
+  804e07:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804e0a:	89 c1                	mov    %eax,%ecx
+  804e0c:	83 c9 02             	or     $0x2,%ecx
+  804e0f:	f6 c2 02             	test   $0x2,%dl
+  804e12:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804e15:	89 c1                	mov    %eax,%ecx
+  804e17:	83 c9 01             	or     $0x1,%ecx
+  804e1a:	48 85 d2             	test   %rdx,%rdx
+  804e1d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804e20:	89 c1                	mov    %eax,%ecx
+  804e22:	83 c9 40             	or     $0x40,%ecx
+  804e25:	f6 c6 04             	test   $0x4,%dh
+  804e28:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804e2b:	5d                   	pop    %rbp
+  804e2c:	c3                   	ret
+
+0000000000804e2d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804e2d:	55                   	push   %rbp
+  804e2e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804e31:	48 b8 33 4d 80 00 00 	movabs $0x804d33,%rax
+  804e38:	00 00 00 
+  804e3b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804e3d:	48 c1 e8 06          	shr    $0x6,%rax
+  804e41:	83 e0 01             	and    $0x1,%eax
+}
+  804e44:	5d                   	pop    %rbp
+  804e45:	c3                   	ret
+
+0000000000804e46 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804e46:	55                   	push   %rbp
+  804e47:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804e4a:	48 b8 33 4d 80 00 00 	movabs $0x804d33,%rax
+  804e51:	00 00 00 
+  804e54:	ff d0                	call   *%rax
+  804e56:	83 e0 01             	and    $0x1,%eax
+}
+  804e59:	5d                   	pop    %rbp
+  804e5a:	c3                   	ret
+
+0000000000804e5b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804e5b:	55                   	push   %rbp
+  804e5c:	48 89 e5             	mov    %rsp,%rbp
+  804e5f:	41 57                	push   %r15
+  804e61:	41 56                	push   %r14
+  804e63:	41 55                	push   %r13
+  804e65:	41 54                	push   %r12
+  804e67:	53                   	push   %rbx
+  804e68:	48 83 ec 28          	sub    $0x28,%rsp
+  804e6c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804e70:	48 85 ff             	test   %rdi,%rdi
+  804e73:	74 1e                	je     804e93 <foreach_shared_region+0x38>
+  804e75:	49 89 ff             	mov    %rdi,%r15
+  804e78:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804e7e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804e84:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804e8b:	01 00 00 
+  804e8e:	e9 72 02 00 00       	jmp    805105 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804e93:	48 b9 cc 6e 80 00 00 	movabs $0x806ecc,%rcx
+  804e9a:	00 00 00 
+  804e9d:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  804ea4:	00 00 00 
+  804ea7:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804eac:	48 bf d0 6e 80 00 00 	movabs $0x806ed0,%rdi
+  804eb3:	00 00 00 
+  804eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ebb:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  804ec2:	00 00 00 
+  804ec5:	41 ff d0             	call   *%r8
+  804ec8:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804ecf:	eb 6c                	jmp    804f3d <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804ed1:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804ed8:	ff ff ff 
+  804edb:	4c 21 e2             	and    %r12,%rdx
+  804ede:	48 89 d8             	mov    %rbx,%rax
+  804ee1:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ee6:	48 83 c0 01          	add    $0x1,%rax
+  804eea:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804eee:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804ef5:	00 00 00 
+  804ef8:	48 21 c8             	and    %rcx,%rax
+  804efb:	48 09 d0             	or     %rdx,%rax
+  804efe:	49 89 c4             	mov    %rax,%r12
+  804f01:	eb 30                	jmp    804f33 <foreach_shared_region+0xd8>
+  804f03:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804f0a:	ff ff ff 
+  804f0d:	4c 21 e2             	and    %r12,%rdx
+  804f10:	48 89 d8             	mov    %rbx,%rax
+  804f13:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804f18:	48 83 c0 01          	add    $0x1,%rax
+  804f1c:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804f20:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804f27:	00 00 00 
+  804f2a:	48 21 c8             	and    %rcx,%rax
+  804f2d:	48 09 d0             	or     %rdx,%rax
+  804f30:	49 89 c4             	mov    %rax,%r12
+  804f33:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804f37:	0f 84 99 01 00 00    	je     8050d6 <foreach_shared_region+0x27b>
+  804f3d:	4c 89 e3             	mov    %r12,%rbx
+  804f40:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804f44:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f4b:	01 00 00 
+  804f4e:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804f52:	a8 01                	test   $0x1,%al
+  804f54:	0f 84 77 ff ff ff    	je     804ed1 <foreach_shared_region+0x76>
+  804f5a:	a8 80                	test   $0x80,%al
+  804f5c:	74 19                	je     804f77 <foreach_shared_region+0x11c>
+  804f5e:	f6 c4 04             	test   $0x4,%ah
+  804f61:	74 a0                	je     804f03 <foreach_shared_region+0xa8>
+  804f63:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804f6a:	40 
+  804f6b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f6f:	4c 89 e7             	mov    %r12,%rdi
+  804f72:	41 ff d7             	call   *%r15
+  804f75:	eb 8c                	jmp    804f03 <foreach_shared_region+0xa8>
+  804f77:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804f7e:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804f82:	eb 46                	jmp    804fca <foreach_shared_region+0x16f>
+  804f84:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804f8b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804f91:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804f95:	48 c1 e0 15          	shl    $0x15,%rax
+  804f99:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804f9e:	49 09 c4             	or     %rax,%r12
+  804fa1:	eb 1d                	jmp    804fc0 <foreach_shared_region+0x165>
+  804fa3:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804faa:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804fb0:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804fb4:	48 c1 e0 15          	shl    $0x15,%rax
+  804fb8:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804fbd:	49 09 c4             	or     %rax,%r12
+  804fc0:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804fc4:	0f 84 d3 00 00 00    	je     80509d <foreach_shared_region+0x242>
+  804fca:	4c 89 e3             	mov    %r12,%rbx
+  804fcd:	48 c1 eb 15          	shr    $0x15,%rbx
+  804fd1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804fd8:	01 00 00 
+  804fdb:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804fdf:	a8 01                	test   $0x1,%al
+  804fe1:	74 a1                	je     804f84 <foreach_shared_region+0x129>
+  804fe3:	a8 80                	test   $0x80,%al
+  804fe5:	74 19                	je     805000 <foreach_shared_region+0x1a5>
+  804fe7:	f6 c4 04             	test   $0x4,%ah
+  804fea:	74 b7                	je     804fa3 <foreach_shared_region+0x148>
+  804fec:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804ff3:	00 
+  804ff4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ff8:	4c 89 e7             	mov    %r12,%rdi
+  804ffb:	41 ff d7             	call   *%r15
+  804ffe:	eb a3                	jmp    804fa3 <foreach_shared_region+0x148>
+  805000:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  805006:	eb 3b                	jmp    805043 <foreach_shared_region+0x1e8>
+  805008:	f6 c4 04             	test   $0x4,%ah
+  80500b:	74 12                	je     80501f <foreach_shared_region+0x1c4>
+  80500d:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  805014:	00 
+  805015:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805019:	4c 89 e7             	mov    %r12,%rdi
+  80501c:	41 ff d7             	call   *%r15
+  80501f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805026:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80502c:	48 83 c3 01          	add    $0x1,%rbx
+  805030:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805034:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80503a:	49 09 dc             	or     %rbx,%r12
+  80503d:	41 83 ed 01          	sub    $0x1,%r13d
+  805041:	74 2f                	je     805072 <foreach_shared_region+0x217>
+  805043:	4c 89 e3             	mov    %r12,%rbx
+  805046:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80504a:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80504e:	a8 01                	test   $0x1,%al
+  805050:	75 b6                	jne    805008 <foreach_shared_region+0x1ad>
+  805052:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805059:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80505f:	48 83 c3 01          	add    $0x1,%rbx
+  805063:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805067:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80506d:	49 09 dc             	or     %rbx,%r12
+  805070:	eb cb                	jmp    80503d <foreach_shared_region+0x1e2>
+  805072:	4c 89 e0             	mov    %r12,%rax
+  805075:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80507b:	49 c1 ec 15          	shr    $0x15,%r12
+  80507f:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  805086:	49 83 c4 01          	add    $0x1,%r12
+  80508a:	49 c1 e4 15          	shl    $0x15,%r12
+  80508e:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  805095:	49 09 c4             	or     %rax,%r12
+  805098:	e9 23 ff ff ff       	jmp    804fc0 <foreach_shared_region+0x165>
+  80509d:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8050a1:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8050a8:	ff ff ff 
+  8050ab:	4c 21 e0             	and    %r12,%rax
+  8050ae:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8050b2:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8050b9:	49 83 c4 01          	add    $0x1,%r12
+  8050bd:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8050c1:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8050c8:	00 00 00 
+  8050cb:	49 21 d4             	and    %rdx,%r12
+  8050ce:	49 09 c4             	or     %rax,%r12
+  8050d1:	e9 5d fe ff ff       	jmp    804f33 <foreach_shared_region+0xd8>
+  8050d6:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8050dd:	00 ff ff 
+  8050e0:	4c 21 e0             	and    %r12,%rax
+  8050e3:	49 c1 ec 27          	shr    $0x27,%r12
+  8050e7:	49 83 c4 01          	add    $0x1,%r12
+  8050eb:	49 c1 e4 27          	shl    $0x27,%r12
+  8050ef:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8050f6:	ff 00 00 
+  8050f9:	49 21 d4             	and    %rdx,%r12
+  8050fc:	49 09 c4             	or     %rax,%r12
+  8050ff:	41 83 ed 01          	sub    $0x1,%r13d
+  805103:	74 48                	je     80514d <foreach_shared_region+0x2f2>
+  805105:	4c 89 e0             	mov    %r12,%rax
+  805108:	48 c1 e8 27          	shr    $0x27,%rax
+  80510c:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  805113:	01 00 00 
+  805116:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  80511a:	f6 c2 01             	test   $0x1,%dl
+  80511d:	0f 85 a5 fd ff ff    	jne    804ec8 <foreach_shared_region+0x6d>
+  805123:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  80512a:	00 ff ff 
+  80512d:	4c 21 e2             	and    %r12,%rdx
+  805130:	48 83 c0 01          	add    $0x1,%rax
+  805134:	48 c1 e0 27          	shl    $0x27,%rax
+  805138:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80513f:	ff 00 00 
+  805142:	48 21 c8             	and    %rcx,%rax
+  805145:	48 09 d0             	or     %rdx,%rax
+  805148:	49 89 c4             	mov    %rax,%r12
+  80514b:	eb b2                	jmp    8050ff <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80514d:	4d 85 e4             	test   %r12,%r12
+  805150:	75 14                	jne    805166 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  805152:	b8 00 00 00 00       	mov    $0x0,%eax
+  805157:	48 83 c4 28          	add    $0x28,%rsp
+  80515b:	5b                   	pop    %rbx
+  80515c:	41 5c                	pop    %r12
+  80515e:	41 5d                	pop    %r13
+  805160:	41 5e                	pop    %r14
+  805162:	41 5f                	pop    %r15
+  805164:	5d                   	pop    %rbp
+  805165:	c3                   	ret
+    assert(addr == 0);
+  805166:	48 b9 db 6e 80 00 00 	movabs $0x806edb,%rcx
+  80516d:	00 00 00 
+  805170:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  805177:	00 00 00 
+  80517a:	be 67 00 00 00       	mov    $0x67,%esi
+  80517f:	48 bf d0 6e 80 00 00 	movabs $0x806ed0,%rdi
+  805186:	00 00 00 
+  805189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80518e:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  805195:	00 00 00 
+  805198:	41 ff d0             	call   *%r8
+
+000000000080519b <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80519b:	49 b8 40 bc 80 01 00 	movabs $0x180bc40,%r8
+  8051a2:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8051a5:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8051ab:	eb 33                	jmp    8051e0 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051ad:	48 83 c0 20          	add    $0x20,%rax
+  8051b1:	4c 39 c0             	cmp    %r8,%rax
+  8051b4:	74 25                	je     8051db <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8051b6:	48 8b 10             	mov    (%rax),%rdx
+  8051b9:	48 85 d2             	test   %rdx,%rdx
+  8051bc:	74 ef                	je     8051ad <mmap_place+0x12>
+  8051be:	48 89 d1             	mov    %rdx,%rcx
+  8051c1:	48 03 48 08          	add    0x8(%rax),%rcx
+  8051c5:	48 39 cf             	cmp    %rcx,%rdi
+  8051c8:	73 e3                	jae    8051ad <mmap_place+0x12>
+  8051ca:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8051ce:	4c 39 ca             	cmp    %r9,%rdx
+  8051d1:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8051d5:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8051d9:	eb d2                	jmp    8051ad <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8051db:	45 84 d2             	test   %r10b,%r10b
+  8051de:	74 12                	je     8051f2 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051e0:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  8051e7:	00 00 00 
+        moved = 0;
+  8051ea:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8051f0:	eb c4                	jmp    8051b6 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8051f2:	48 01 fe             	add    %rdi,%rsi
+  8051f5:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8051fc:	00 00 00 
+  8051ff:	48 39 f0             	cmp    %rsi,%rax
+  805202:	b8 00 00 00 00       	mov    $0x0,%eax
+  805207:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  80520b:	c3                   	ret
+
+000000000080520c <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  80520c:	55                   	push   %rbp
+  80520d:	48 89 e5             	mov    %rsp,%rbp
+  805210:	41 57                	push   %r15
+  805212:	41 56                	push   %r14
+  805214:	41 55                	push   %r13
+  805216:	41 54                	push   %r12
+  805218:	53                   	push   %rbx
+  805219:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80521d:	48 8b 1f             	mov    (%rdi),%rbx
+  805220:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805227:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  80522e:	00 00 00 
+  805231:	ba 00 00 00 00       	mov    $0x0,%edx
+  805236:	eb 12                	jmp    80524a <mmap_pgfault+0x3e>
+  805238:	48 83 c2 01          	add    $0x1,%rdx
+  80523c:	48 83 c0 20          	add    $0x20,%rax
+  805240:	48 83 fa 20          	cmp    $0x20,%rdx
+  805244:	0f 84 04 01 00 00    	je     80534e <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80524a:	48 8b 08             	mov    (%rax),%rcx
+  80524d:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  805251:	48 39 de             	cmp    %rbx,%rsi
+  805254:	73 e2                	jae    805238 <mmap_pgfault+0x2c>
+  805256:	48 03 48 08          	add    0x8(%rax),%rcx
+  80525a:	48 39 cb             	cmp    %rcx,%rbx
+  80525d:	73 d9                	jae    805238 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80525f:	48 c1 e2 05          	shl    $0x5,%rdx
+  805263:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  80526a:	00 00 00 
+  80526d:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  805271:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  805275:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  805279:	f6 c2 01             	test   $0x1,%dl
+  80527c:	0f 84 e0 00 00 00    	je     805362 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  805282:	b8 00 00 00 00       	mov    $0x0,%eax
+  805287:	f6 c2 02             	test   $0x2,%dl
+  80528a:	0f 84 c3 00 00 00    	je     805353 <mmap_pgfault+0x147>
+  805290:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805297:	ff ff ff 
+  80529a:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80529e:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  8052a5:	00 00 00 
+  8052a8:	48 39 ca             	cmp    %rcx,%rdx
+  8052ab:	0f 85 a2 00 00 00    	jne    805353 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8052b1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8052b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052bb:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8052c2:	00 00 00 
+  8052c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ca:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  8052d1:	00 00 00 
+  8052d4:	ff d0                	call   *%rax
+  8052d6:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8052d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052dd:	85 d2                	test   %edx,%edx
+  8052df:	78 72                	js     805353 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8052e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052e6:	48 89 de             	mov    %rbx,%rsi
+  8052e9:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8052f0:	00 00 00 
+  8052f3:	4c 89 e7             	mov    %r12,%rdi
+  8052f6:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  8052fd:	00 00 00 
+  805300:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  805302:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  805308:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80530e:	48 89 d9             	mov    %rbx,%rcx
+  805311:	ba 00 00 00 00       	mov    $0x0,%edx
+  805316:	4c 89 e6             	mov    %r12,%rsi
+  805319:	bf 00 00 00 00       	mov    $0x0,%edi
+  80531e:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  805325:	00 00 00 
+  805328:	ff d0                	call   *%rax
+  80532a:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  80532c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805331:	4c 89 e6             	mov    %r12,%rsi
+  805334:	bf 00 00 00 00       	mov    $0x0,%edi
+  805339:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  805340:	00 00 00 
+  805343:	ff d0                	call   *%rax
+    return res >= 0;
+  805345:	89 d8                	mov    %ebx,%eax
+  805347:	f7 d0                	not    %eax
+  805349:	c1 e8 1f             	shr    $0x1f,%eax
+  80534c:	eb 05                	jmp    805353 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80534e:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  805353:	48 83 c4 18          	add    $0x18,%rsp
+  805357:	5b                   	pop    %rbx
+  805358:	41 5c                	pop    %r12
+  80535a:	41 5d                	pop    %r13
+  80535c:	41 5e                	pop    %r14
+  80535e:	41 5f                	pop    %r15
+  805360:	5d                   	pop    %rbp
+  805361:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  805362:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805366:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  80536a:	4c 03 30             	add    (%rax),%r14
+  80536d:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  805374:	49 39 c6             	cmp    %rax,%r14
+  805377:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80537b:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  805382:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805388:	49 bf 46 4e 80 00 00 	movabs $0x804e46,%r15
+  80538f:	00 00 00 
+  805392:	4d 39 f4             	cmp    %r14,%r12
+  805395:	73 1d                	jae    8053b4 <mmap_pgfault+0x1a8>
+  805397:	4c 89 e7             	mov    %r12,%rdi
+  80539a:	41 ff d7             	call   *%r15
+  80539d:	84 c0                	test   %al,%al
+  80539f:	75 13                	jne    8053b4 <mmap_pgfault+0x1a8>
+  8053a1:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8053a8:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8053af:	4d 39 f4             	cmp    %r14,%r12
+  8053b2:	72 e3                	jb     805397 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8053b4:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8053ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053be:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8053c2:	74 2a                	je     8053ee <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8053c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053c8:	89 de                	mov    %ebx,%esi
+  8053ca:	2b 30                	sub    (%rax),%esi
+  8053cc:	03 70 1c             	add    0x1c(%rax),%esi
+  8053cf:	8b 78 18             	mov    0x18(%rax),%edi
+  8053d2:	4c 89 e9             	mov    %r13,%rcx
+  8053d5:	48 89 da             	mov    %rbx,%rdx
+  8053d8:	48 b8 c9 3c 80 00 00 	movabs $0x803cc9,%rax
+  8053df:	00 00 00 
+  8053e2:	ff d0                	call   *%rax
+    return res > 0;
+  8053e4:	85 c0                	test   %eax,%eax
+  8053e6:	0f 9f c0             	setg   %al
+  8053e9:	e9 65 ff ff ff       	jmp    805353 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8053ee:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8053f2:	eb d0                	jmp    8053c4 <mmap_pgfault+0x1b8>
+
+00000000008053f4 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8053f4:	55                   	push   %rbp
+  8053f5:	48 89 e5             	mov    %rsp,%rbp
+  8053f8:	41 57                	push   %r15
+  8053fa:	41 56                	push   %r14
+  8053fc:	41 55                	push   %r13
+  8053fe:	41 54                	push   %r12
+  805400:	53                   	push   %rbx
+  805401:	48 83 ec 28          	sub    $0x28,%rsp
+  805405:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  805409:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  80540c:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805413:	ff ff ff 
+  805416:	48 23 57 10          	and    0x10(%rdi),%rdx
+  80541a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80541f:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  805426:	00 00 00 
+  805429:	48 39 ca             	cmp    %rcx,%rdx
+  80542c:	0f 85 e5 00 00 00    	jne    805517 <mmap_writeback+0x123>
+  805432:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  805435:	4c 39 ee             	cmp    %r13,%rsi
+  805438:	0f 83 e8 00 00 00    	jae    805526 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80543e:	49 be 46 4e 80 00 00 	movabs $0x804e46,%r14
+  805445:	00 00 00 
+  805448:	49 bf 2d 4e 80 00 00 	movabs $0x804e2d,%r15
+  80544f:	00 00 00 
+  805452:	eb 10                	jmp    805464 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  805454:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80545b:	4d 39 ec             	cmp    %r13,%r12
+  80545e:	0f 83 ae 00 00 00    	jae    805512 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805464:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805468:	4c 89 e7             	mov    %r12,%rdi
+  80546b:	41 ff d6             	call   *%r14
+  80546e:	84 c0                	test   %al,%al
+  805470:	74 e2                	je     805454 <mmap_writeback+0x60>
+  805472:	4c 89 e7             	mov    %r12,%rdi
+  805475:	41 ff d7             	call   *%r15
+  805478:	84 c0                	test   %al,%al
+  80547a:	74 d8                	je     805454 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80547c:	4c 89 e3             	mov    %r12,%rbx
+  80547f:	4d 39 ec             	cmp    %r13,%r12
+  805482:	73 20                	jae    8054a4 <mmap_writeback+0xb0>
+  805484:	48 89 df             	mov    %rbx,%rdi
+  805487:	41 ff d6             	call   *%r14
+  80548a:	84 c0                	test   %al,%al
+  80548c:	74 16                	je     8054a4 <mmap_writeback+0xb0>
+  80548e:	48 89 df             	mov    %rbx,%rdi
+  805491:	41 ff d7             	call   *%r15
+  805494:	84 c0                	test   %al,%al
+  805496:	74 0c                	je     8054a4 <mmap_writeback+0xb0>
+  805498:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80549f:	4c 39 eb             	cmp    %r13,%rbx
+  8054a2:	72 e0                	jb     805484 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  8054a4:	48 89 d9             	mov    %rbx,%rcx
+  8054a7:	4c 29 e1             	sub    %r12,%rcx
+  8054aa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8054ae:	44 89 e6             	mov    %r12d,%esi
+  8054b1:	2b 30                	sub    (%rax),%esi
+  8054b3:	49 89 c4             	mov    %rax,%r12
+  8054b6:	03 70 1c             	add    0x1c(%rax),%esi
+  8054b9:	8b 78 18             	mov    0x18(%rax),%edi
+  8054bc:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8054c0:	48 89 ca             	mov    %rcx,%rdx
+  8054c3:	48 b8 52 3d 80 00 00 	movabs $0x803d52,%rax
+  8054ca:	00 00 00 
+  8054cd:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8054cf:	85 c0                	test   %eax,%eax
+  8054d1:	78 44                	js     805517 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8054d3:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8054d8:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8054db:	41 89 c1             	mov    %eax,%r9d
+  8054de:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8054e5:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8054e9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8054ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054f2:	48 89 ce             	mov    %rcx,%rsi
+  8054f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054fa:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  805501:	00 00 00 
+  805504:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  805506:	85 c0                	test   %eax,%eax
+  805508:	78 0d                	js     805517 <mmap_writeback+0x123>
+  80550a:	49 89 dc             	mov    %rbx,%r12
+  80550d:	e9 49 ff ff ff       	jmp    80545b <mmap_writeback+0x67>
+    }
+
+    return 0;
+  805512:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805517:	48 83 c4 28          	add    $0x28,%rsp
+  80551b:	5b                   	pop    %rbx
+  80551c:	41 5c                	pop    %r12
+  80551e:	41 5d                	pop    %r13
+  805520:	41 5e                	pop    %r14
+  805522:	41 5f                	pop    %r15
+  805524:	5d                   	pop    %rbp
+  805525:	c3                   	ret
+    return 0;
+  805526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80552b:	eb ea                	jmp    805517 <mmap_writeback+0x123>
+
+000000000080552d <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80552d:	55                   	push   %rbp
+  80552e:	48 89 e5             	mov    %rsp,%rbp
+  805531:	41 57                	push   %r15
+  805533:	41 56                	push   %r14
+  805535:	41 55                	push   %r13
+  805537:	41 54                	push   %r12
+  805539:	53                   	push   %rbx
+  80553a:	48 83 ec 38          	sub    $0x38,%rsp
+  80553e:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805542:	48 85 f6             	test   %rsi,%rsi
+  805545:	0f 84 0c 02 00 00    	je     805757 <mmap+0x22a>
+  80554b:	49 89 ff             	mov    %rdi,%r15
+  80554e:	49 89 f4             	mov    %rsi,%r12
+  805551:	41 89 d5             	mov    %edx,%r13d
+  805554:	41 89 ce             	mov    %ecx,%r14d
+  805557:	44 89 cb             	mov    %r9d,%ebx
+  80555a:	45 85 c9             	test   %r9d,%r9d
+  80555d:	0f 88 f4 01 00 00    	js     805757 <mmap+0x22a>
+  805563:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80556a:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805571:	0f 85 e7 01 00 00    	jne    80575e <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805577:	83 e2 fd             	and    $0xfffffffd,%edx
+  80557a:	83 fa 04             	cmp    $0x4,%edx
+  80557d:	0f 85 db 01 00 00    	jne    80575e <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805583:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805586:	83 fa 01             	cmp    $0x1,%edx
+  805589:	0f 87 cf 01 00 00    	ja     80575e <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  80558f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805593:	44 89 c7             	mov    %r8d,%edi
+  805596:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  80559d:	00 00 00 
+  8055a0:	ff d0                	call   *%rax
+  8055a2:	89 c2                	mov    %eax,%edx
+  8055a4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8055ab:	85 d2                	test   %edx,%edx
+  8055ad:	0f 88 ab 01 00 00    	js     80575e <mmap+0x231>
+  8055b3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8055b7:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8055be:	00 00 00 
+  8055c1:	8b 09                	mov    (%rcx),%ecx
+  8055c3:	39 0a                	cmp    %ecx,(%rdx)
+  8055c5:	0f 85 93 01 00 00    	jne    80575e <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8055cb:	8b 52 08             	mov    0x8(%rdx),%edx
+  8055ce:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8055d1:	83 fa 01             	cmp    $0x1,%edx
+  8055d4:	0f 84 84 01 00 00    	je     80575e <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8055da:	41 83 fe 01          	cmp    $0x1,%r14d
+  8055de:	74 42                	je     805622 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8055e0:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8055e7:	4c 89 e6             	mov    %r12,%rsi
+  8055ea:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8055f1:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8055f5:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8055f9:	4d 85 ff             	test   %r15,%r15
+  8055fc:	74 67                	je     805665 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8055fe:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805605:	75 0f                	jne    805616 <mmap+0xe9>
+  805607:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  80560e:	00 00 00 
+  805611:	49 39 c7             	cmp    %rax,%r15
+  805614:	77 1b                	ja     805631 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805616:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80561d:	e9 3c 01 00 00       	jmp    80575e <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805622:	41 f6 c5 02          	test   $0x2,%r13b
+  805626:	74 b8                	je     8055e0 <mmap+0xb3>
+  805628:	85 d2                	test   %edx,%edx
+  80562a:	75 b4                	jne    8055e0 <mmap+0xb3>
+  80562c:	e9 2d 01 00 00       	jmp    80575e <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805631:	4c 89 ff             	mov    %r15,%rdi
+  805634:	48 b8 9b 51 80 00 00 	movabs $0x80519b,%rax
+  80563b:	00 00 00 
+  80563e:	ff d0                	call   *%rax
+  805640:	48 89 c2             	mov    %rax,%rdx
+  805643:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80564a:	49 39 d7             	cmp    %rdx,%r15
+  80564d:	0f 85 0b 01 00 00    	jne    80575e <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805653:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  80565a:	00 00 00 
+  80565d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805663:	eb 44                	jmp    8056a9 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805665:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805669:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805670:	00 00 00 
+  805673:	48 b8 9b 51 80 00 00 	movabs $0x80519b,%rax
+  80567a:	00 00 00 
+  80567d:	ff d0                	call   *%rax
+  80567f:	48 89 c7             	mov    %rax,%rdi
+  805682:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805686:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80568d:	48 85 ff             	test   %rdi,%rdi
+  805690:	75 c1                	jne    805653 <mmap+0x126>
+  805692:	e9 c7 00 00 00       	jmp    80575e <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805697:	49 83 c4 01          	add    $0x1,%r12
+  80569b:	48 83 c0 20          	add    $0x20,%rax
+  80569f:	49 83 fc 20          	cmp    $0x20,%r12
+  8056a3:	0f 84 a5 00 00 00    	je     80574e <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8056a9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8056ad:	75 e8                	jne    805697 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  8056af:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8056b3:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  8056ba:	00 00 00 
+  8056bd:	ff d0                	call   *%rax
+  8056bf:	89 c2                	mov    %eax,%edx
+  8056c1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8056c8:	85 d2                	test   %edx,%edx
+  8056ca:	0f 88 8e 00 00 00    	js     80575e <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8056d0:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8056d4:	48 b8 de 2f 80 00 00 	movabs $0x802fde,%rax
+  8056db:	00 00 00 
+  8056de:	ff d0                	call   *%rax
+  8056e0:	89 c6                	mov    %eax,%esi
+  8056e2:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8056e5:	48 b8 2c 32 80 00 00 	movabs $0x80322c,%rax
+  8056ec:	00 00 00 
+  8056ef:	ff d0                	call   *%rax
+  8056f1:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8056f4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8056fb:	45 85 ff             	test   %r15d,%r15d
+  8056fe:	78 5e                	js     80575e <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805700:	49 c1 e4 05          	shl    $0x5,%r12
+  805704:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  80570b:	00 00 00 
+  80570e:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805711:	48 bf 0c 52 80 00 00 	movabs $0x80520c,%rdi
+  805718:	00 00 00 
+  80571b:	48 b8 37 5c 80 00 00 	movabs $0x805c37,%rax
+  805722:	00 00 00 
+  805725:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805727:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80572b:	49 89 04 24          	mov    %rax,(%r12)
+  80572f:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805733:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805738:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  80573d:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805742:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805747:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  80574c:	eb 10                	jmp    80575e <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  80574e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805755:	eb 07                	jmp    80575e <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805757:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  80575e:	48 83 c4 38          	add    $0x38,%rsp
+  805762:	5b                   	pop    %rbx
+  805763:	41 5c                	pop    %r12
+  805765:	41 5d                	pop    %r13
+  805767:	41 5e                	pop    %r14
+  805769:	41 5f                	pop    %r15
+  80576b:	5d                   	pop    %rbp
+  80576c:	c3                   	ret
+
+000000000080576d <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  80576d:	55                   	push   %rbp
+  80576e:	48 89 e5             	mov    %rsp,%rbp
+  805771:	41 57                	push   %r15
+  805773:	41 56                	push   %r14
+  805775:	41 55                	push   %r13
+  805777:	41 54                	push   %r12
+  805779:	53                   	push   %rbx
+  80577a:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80577e:	49 89 fe             	mov    %rdi,%r14
+  805781:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805788:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80578f:	00 
+  805790:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805797:	48 bb 40 b8 80 01 00 	movabs $0x180b840,%rbx
+  80579e:	00 00 00 
+  8057a1:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8057a8:	49 bf f4 53 80 00 00 	movabs $0x8053f4,%r15
+  8057af:	00 00 00 
+  8057b2:	eb 09                	jmp    8057bd <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8057b4:	48 83 c3 20          	add    $0x20,%rbx
+  8057b8:	4c 39 eb             	cmp    %r13,%rbx
+  8057bb:	74 33                	je     8057f0 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8057bd:	48 89 df             	mov    %rbx,%rdi
+  8057c0:	48 8b 33             	mov    (%rbx),%rsi
+  8057c3:	4c 39 e6             	cmp    %r12,%rsi
+  8057c6:	73 ec                	jae    8057b4 <msync+0x47>
+  8057c8:	48 85 f6             	test   %rsi,%rsi
+  8057cb:	74 e7                	je     8057b4 <msync+0x47>
+  8057cd:	48 89 f2             	mov    %rsi,%rdx
+  8057d0:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8057d4:	49 39 d6             	cmp    %rdx,%r14
+  8057d7:	73 db                	jae    8057b4 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8057d9:	4c 39 e2             	cmp    %r12,%rdx
+  8057dc:	49 0f 47 d4          	cmova  %r12,%rdx
+  8057e0:	4c 39 f6             	cmp    %r14,%rsi
+  8057e3:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8057e7:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8057ea:	85 c0                	test   %eax,%eax
+  8057ec:	79 c6                	jns    8057b4 <msync+0x47>
+  8057ee:	eb 05                	jmp    8057f5 <msync+0x88>
+    }
+
+    return 0;
+  8057f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057f5:	48 83 c4 08          	add    $0x8,%rsp
+  8057f9:	5b                   	pop    %rbx
+  8057fa:	41 5c                	pop    %r12
+  8057fc:	41 5d                	pop    %r13
+  8057fe:	41 5e                	pop    %r14
+  805800:	41 5f                	pop    %r15
+  805802:	5d                   	pop    %rbp
+  805803:	c3                   	ret
+
+0000000000805804 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805804:	55                   	push   %rbp
+  805805:	48 89 e5             	mov    %rsp,%rbp
+  805808:	41 57                	push   %r15
+  80580a:	41 56                	push   %r14
+  80580c:	41 55                	push   %r13
+  80580e:	41 54                	push   %r12
+  805810:	53                   	push   %rbx
+  805811:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805815:	49 89 ff             	mov    %rdi,%r15
+  805818:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80581f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805826:	00 
+  805827:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80582e:	48 bb 40 b8 80 01 00 	movabs $0x180b840,%rbx
+  805835:	00 00 00 
+  805838:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80583f:	48 89 d8             	mov    %rbx,%rax
+  805842:	eb 09                	jmp    80584d <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805844:	48 83 c0 20          	add    $0x20,%rax
+  805848:	4c 39 f0             	cmp    %r14,%rax
+  80584b:	74 40                	je     80588d <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80584d:	48 8b 10             	mov    (%rax),%rdx
+  805850:	4c 39 e2             	cmp    %r12,%rdx
+  805853:	73 ef                	jae    805844 <munmap+0x40>
+  805855:	48 85 d2             	test   %rdx,%rdx
+  805858:	74 ea                	je     805844 <munmap+0x40>
+  80585a:	48 89 d7             	mov    %rdx,%rdi
+  80585d:	48 03 78 08          	add    0x8(%rax),%rdi
+  805861:	49 39 ff             	cmp    %rdi,%r15
+  805864:	73 de                	jae    805844 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805866:	49 39 fc             	cmp    %rdi,%r12
+  805869:	72 05                	jb     805870 <munmap+0x6c>
+  80586b:	4c 39 fa             	cmp    %r15,%rdx
+  80586e:	73 d4                	jae    805844 <munmap+0x40>
+  805870:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805875:	48 83 c4 08          	add    $0x8,%rsp
+  805879:	5b                   	pop    %rbx
+  80587a:	41 5c                	pop    %r12
+  80587c:	41 5d                	pop    %r13
+  80587e:	41 5e                	pop    %r14
+  805880:	41 5f                	pop    %r15
+  805882:	5d                   	pop    %rbp
+  805883:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805884:	48 83 c3 20          	add    $0x20,%rbx
+  805888:	4c 39 f3             	cmp    %r14,%rbx
+  80588b:	74 5c                	je     8058e9 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80588d:	48 8b 33             	mov    (%rbx),%rsi
+  805890:	4c 39 e6             	cmp    %r12,%rsi
+  805893:	73 ef                	jae    805884 <munmap+0x80>
+  805895:	48 85 f6             	test   %rsi,%rsi
+  805898:	74 ea                	je     805884 <munmap+0x80>
+  80589a:	48 89 f2             	mov    %rsi,%rdx
+  80589d:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8058a1:	49 39 d7             	cmp    %rdx,%r15
+  8058a4:	73 de                	jae    805884 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8058a6:	48 89 df             	mov    %rbx,%rdi
+  8058a9:	48 b8 f4 53 80 00 00 	movabs $0x8053f4,%rax
+  8058b0:	00 00 00 
+  8058b3:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8058b5:	85 c0                	test   %eax,%eax
+  8058b7:	78 bc                	js     805875 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8058b9:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8058bd:	48 8b 33             	mov    (%rbx),%rsi
+  8058c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058c5:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  8058cc:	00 00 00 
+  8058cf:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8058d1:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8058d4:	48 b8 d1 31 80 00 00 	movabs $0x8031d1,%rax
+  8058db:	00 00 00 
+  8058de:	ff d0                	call   *%rax
+        reg->start = 0;
+  8058e0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8058e7:	eb 9b                	jmp    805884 <munmap+0x80>
+    return 0;
+  8058e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058ee:	eb 85                	jmp    805875 <munmap+0x71>
+
+00000000008058f0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8058f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058f5:	c3                   	ret
+
+00000000008058f6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8058f6:	55                   	push   %rbp
+  8058f7:	48 89 e5             	mov    %rsp,%rbp
+  8058fa:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8058fd:	48 be e5 6e 80 00 00 	movabs $0x806ee5,%rsi
+  805904:	00 00 00 
+  805907:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80590e:	00 00 00 
+  805911:	ff d0                	call   *%rax
+    return 0;
+}
+  805913:	b8 00 00 00 00       	mov    $0x0,%eax
+  805918:	5d                   	pop    %rbp
+  805919:	c3                   	ret
+
+000000000080591a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80591a:	55                   	push   %rbp
+  80591b:	48 89 e5             	mov    %rsp,%rbp
+  80591e:	41 57                	push   %r15
+  805920:	41 56                	push   %r14
+  805922:	41 55                	push   %r13
+  805924:	41 54                	push   %r12
+  805926:	53                   	push   %rbx
+  805927:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80592e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805935:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80593c:	00 00 00 00 
+  805940:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805947:	00 00 00 00 
+  80594b:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805952:	00 00 00 00 
+  805956:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80595d:	00 00 00 00 
+  805961:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805968:	00 00 00 00 
+  80596c:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805973:	00 00 00 00 
+  805977:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80597e:	00 
+  80597f:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805986:	00 
+  805987:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80598e:	00 
+  80598f:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805996:	00 
+  805997:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80599e:	00 
+  80599f:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8059a6:	00 
+  8059a7:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8059ae:	00 
+  8059af:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8059b6:	00 
+  8059b7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8059be:	00 
+  8059bf:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8059c6:	00 
+    for (res = 0; res < n; res += inc) {
+  8059c7:	48 85 d2             	test   %rdx,%rdx
+  8059ca:	74 7a                	je     805a46 <devcons_write+0x12c>
+  8059cc:	49 89 d6             	mov    %rdx,%r14
+  8059cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8059d5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8059da:	49 bf 6b 25 80 00 00 	movabs $0x80256b,%r15
+  8059e1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8059e4:	4c 89 f3             	mov    %r14,%rbx
+  8059e7:	48 29 f3             	sub    %rsi,%rbx
+  8059ea:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8059ef:	48 39 c3             	cmp    %rax,%rbx
+  8059f2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8059f6:	4c 63 eb             	movslq %ebx,%r13
+  8059f9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805a00:	48 01 c6             	add    %rax,%rsi
+  805a03:	4c 89 ea             	mov    %r13,%rdx
+  805a06:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805a0d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805a10:	4c 89 ee             	mov    %r13,%rsi
+  805a13:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805a1a:	48 b8 98 27 80 00 00 	movabs $0x802798,%rax
+  805a21:	00 00 00 
+  805a24:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805a26:	41 01 dc             	add    %ebx,%r12d
+  805a29:	49 63 f4             	movslq %r12d,%rsi
+  805a2c:	4c 39 f6             	cmp    %r14,%rsi
+  805a2f:	72 b3                	jb     8059e4 <devcons_write+0xca>
+    return res;
+  805a31:	49 63 c4             	movslq %r12d,%rax
+}
+  805a34:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805a3b:	5b                   	pop    %rbx
+  805a3c:	41 5c                	pop    %r12
+  805a3e:	41 5d                	pop    %r13
+  805a40:	41 5e                	pop    %r14
+  805a42:	41 5f                	pop    %r15
+  805a44:	5d                   	pop    %rbp
+  805a45:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805a46:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805a4c:	eb e3                	jmp    805a31 <devcons_write+0x117>
+
+0000000000805a4e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805a4e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805a51:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a56:	48 85 c0             	test   %rax,%rax
+  805a59:	74 55                	je     805ab0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805a5b:	55                   	push   %rbp
+  805a5c:	48 89 e5             	mov    %rsp,%rbp
+  805a5f:	41 55                	push   %r13
+  805a61:	41 54                	push   %r12
+  805a63:	53                   	push   %rbx
+  805a64:	48 83 ec 08          	sub    $0x8,%rsp
+  805a68:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805a6b:	48 bb cb 27 80 00 00 	movabs $0x8027cb,%rbx
+  805a72:	00 00 00 
+  805a75:	49 bc df 28 80 00 00 	movabs $0x8028df,%r12
+  805a7c:	00 00 00 
+  805a7f:	eb 03                	jmp    805a84 <devcons_read+0x36>
+  805a81:	41 ff d4             	call   *%r12
+  805a84:	ff d3                	call   *%rbx
+  805a86:	85 c0                	test   %eax,%eax
+  805a88:	74 f7                	je     805a81 <devcons_read+0x33>
+    if (c < 0) return c;
+  805a8a:	48 63 d0             	movslq %eax,%rdx
+  805a8d:	78 13                	js     805aa2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805a8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a94:	83 f8 04             	cmp    $0x4,%eax
+  805a97:	74 09                	je     805aa2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805a99:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805a9d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805aa2:	48 89 d0             	mov    %rdx,%rax
+  805aa5:	48 83 c4 08          	add    $0x8,%rsp
+  805aa9:	5b                   	pop    %rbx
+  805aaa:	41 5c                	pop    %r12
+  805aac:	41 5d                	pop    %r13
+  805aae:	5d                   	pop    %rbp
+  805aaf:	c3                   	ret
+  805ab0:	48 89 d0             	mov    %rdx,%rax
+  805ab3:	c3                   	ret
+
+0000000000805ab4 <cputchar>:
+cputchar(int ch) {
+  805ab4:	55                   	push   %rbp
+  805ab5:	48 89 e5             	mov    %rsp,%rbp
+  805ab8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805abc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805ac0:	be 01 00 00 00       	mov    $0x1,%esi
+  805ac5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805ac9:	48 b8 98 27 80 00 00 	movabs $0x802798,%rax
+  805ad0:	00 00 00 
+  805ad3:	ff d0                	call   *%rax
+}
+  805ad5:	c9                   	leave
+  805ad6:	c3                   	ret
+
+0000000000805ad7 <getchar>:
+getchar(void) {
+  805ad7:	55                   	push   %rbp
+  805ad8:	48 89 e5             	mov    %rsp,%rbp
+  805adb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805adf:	ba 01 00 00 00       	mov    $0x1,%edx
+  805ae4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805ae8:	bf 00 00 00 00       	mov    $0x0,%edi
+  805aed:	48 b8 4f 33 80 00 00 	movabs $0x80334f,%rax
+  805af4:	00 00 00 
+  805af7:	ff d0                	call   *%rax
+  805af9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805afb:	85 c0                	test   %eax,%eax
+  805afd:	78 06                	js     805b05 <getchar+0x2e>
+  805aff:	74 08                	je     805b09 <getchar+0x32>
+  805b01:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805b05:	89 d0                	mov    %edx,%eax
+  805b07:	c9                   	leave
+  805b08:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805b09:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805b0e:	eb f5                	jmp    805b05 <getchar+0x2e>
+
+0000000000805b10 <iscons>:
+iscons(int fdnum) {
+  805b10:	55                   	push   %rbp
+  805b11:	48 89 e5             	mov    %rsp,%rbp
+  805b14:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805b18:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805b1c:	48 b8 6c 30 80 00 00 	movabs $0x80306c,%rax
+  805b23:	00 00 00 
+  805b26:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805b28:	85 c0                	test   %eax,%eax
+  805b2a:	78 18                	js     805b44 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805b2c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805b30:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805b37:	00 00 00 
+  805b3a:	8b 00                	mov    (%rax),%eax
+  805b3c:	39 02                	cmp    %eax,(%rdx)
+  805b3e:	0f 94 c0             	sete   %al
+  805b41:	0f b6 c0             	movzbl %al,%eax
+}
+  805b44:	c9                   	leave
+  805b45:	c3                   	ret
+
+0000000000805b46 <opencons>:
+opencons(void) {
+  805b46:	55                   	push   %rbp
+  805b47:	48 89 e5             	mov    %rsp,%rbp
+  805b4a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805b4e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805b52:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  805b59:	00 00 00 
+  805b5c:	ff d0                	call   *%rax
+  805b5e:	85 c0                	test   %eax,%eax
+  805b60:	78 49                	js     805bab <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805b62:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805b67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805b6c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805b70:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b75:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  805b7c:	00 00 00 
+  805b7f:	ff d0                	call   *%rax
+  805b81:	85 c0                	test   %eax,%eax
+  805b83:	78 26                	js     805bab <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805b85:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805b89:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805b90:	00 00 
+  805b92:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805b94:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805b98:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805b9f:	48 b8 de 2f 80 00 00 	movabs $0x802fde,%rax
+  805ba6:	00 00 00 
+  805ba9:	ff d0                	call   *%rax
+}
+  805bab:	c9                   	leave
+  805bac:	c3                   	ret
+
+0000000000805bad <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805bad:	55                   	push   %rbp
+  805bae:	48 89 e5             	mov    %rsp,%rbp
+  805bb1:	41 56                	push   %r14
+  805bb3:	41 55                	push   %r13
+  805bb5:	41 54                	push   %r12
+  805bb7:	53                   	push   %rbx
+  805bb8:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805bbb:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805bc2:	00 00 00 
+  805bc5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805bc9:	74 27                	je     805bf2 <_handle_vectored_pagefault+0x45>
+  805bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805bd0:	49 bd 40 bc 80 01 00 	movabs $0x180bc40,%r13
+  805bd7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805bda:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805bdd:	4c 89 e7             	mov    %r12,%rdi
+  805be0:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805be5:	84 c0                	test   %al,%al
+  805be7:	75 45                	jne    805c2e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805be9:	48 83 c3 01          	add    $0x1,%rbx
+  805bed:	49 3b 1e             	cmp    (%r14),%rbx
+  805bf0:	72 eb                	jb     805bdd <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805bf2:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805bf9:	00 
+  805bfa:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805bff:	4d 8b 04 24          	mov    (%r12),%r8
+  805c03:	48 ba f8 6e 80 00 00 	movabs $0x806ef8,%rdx
+  805c0a:	00 00 00 
+  805c0d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805c12:	48 bf 28 6f 80 00 00 	movabs $0x806f28,%rdi
+  805c19:	00 00 00 
+  805c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c21:	49 ba 94 17 80 00 00 	movabs $0x801794,%r10
+  805c28:	00 00 00 
+  805c2b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805c2e:	5b                   	pop    %rbx
+  805c2f:	41 5c                	pop    %r12
+  805c31:	41 5d                	pop    %r13
+  805c33:	41 5e                	pop    %r14
+  805c35:	5d                   	pop    %rbp
+  805c36:	c3                   	ret
+
+0000000000805c37 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805c37:	55                   	push   %rbp
+  805c38:	48 89 e5             	mov    %rsp,%rbp
+  805c3b:	53                   	push   %rbx
+  805c3c:	48 83 ec 08          	sub    $0x8,%rsp
+  805c40:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805c43:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805c48:	48 b8 80 bc 80 01 00 	movabs $0x180bc80,%rax
+  805c4f:	00 00 00 
+  805c52:	80 38 00             	cmpb   $0x0,(%rax)
+  805c55:	74 68                	je     805cbf <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805c57:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805c5e:	00 00 00 
+  805c61:	48 8b 08             	mov    (%rax),%rcx
+  805c64:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805c69:	48 b8 40 bc 80 01 00 	movabs $0x180bc40,%rax
+  805c70:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805c73:	48 85 c9             	test   %rcx,%rcx
+  805c76:	0f 84 e0 00 00 00    	je     805d5c <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805c7c:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805c80:	0f 84 c9 00 00 00    	je     805d4f <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805c86:	48 83 c2 01          	add    $0x1,%rdx
+  805c8a:	48 39 ca             	cmp    %rcx,%rdx
+  805c8d:	75 ed                	jne    805c7c <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805c8f:	48 83 f9 08          	cmp    $0x8,%rcx
+  805c93:	0f 84 84 00 00 00    	je     805d1d <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805c99:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805c9d:	48 a3 88 bc 80 01 00 	movabs %rax,0x180bc88
+  805ca4:	00 00 00 
+  805ca7:	48 b8 40 bc 80 01 00 	movabs $0x180bc40,%rax
+  805cae:	00 00 00 
+  805cb1:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805cb5:	85 f6                	test   %esi,%esi
+  805cb7:	0f 89 97 00 00 00    	jns    805d54 <add_pgfault_handler+0x11d>
+  805cbd:	eb 63                	jmp    805d22 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805cbf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805cc4:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805cc9:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805cd0:	00 00 00 
+  805cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cd8:	48 b8 80 29 80 00 00 	movabs $0x802980,%rax
+  805cdf:	00 00 00 
+  805ce2:	ff d0                	call   *%rax
+  805ce4:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805ce6:	85 c0                	test   %eax,%eax
+  805ce8:	78 38                	js     805d22 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805cea:	48 be 38 5e 80 00 00 	movabs $0x805e38,%rsi
+  805cf1:	00 00 00 
+  805cf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cf9:	48 b8 a3 2b 80 00 00 	movabs $0x802ba3,%rax
+  805d00:	00 00 00 
+  805d03:	ff d0                	call   *%rax
+  805d05:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805d07:	85 c0                	test   %eax,%eax
+  805d09:	78 17                	js     805d22 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805d0b:	48 b8 80 bc 80 01 00 	movabs $0x180bc80,%rax
+  805d12:	00 00 00 
+  805d15:	c6 00 01             	movb   $0x1,(%rax)
+  805d18:	e9 3a ff ff ff       	jmp    805c57 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805d1d:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805d22:	89 f1                	mov    %esi,%ecx
+  805d24:	48 ba 36 6f 80 00 00 	movabs $0x806f36,%rdx
+  805d2b:	00 00 00 
+  805d2e:	be 42 00 00 00       	mov    $0x42,%esi
+  805d33:	48 bf 28 6f 80 00 00 	movabs $0x806f28,%rdi
+  805d3a:	00 00 00 
+  805d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d42:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  805d49:	00 00 00 
+  805d4c:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805d4f:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805d54:	89 f0                	mov    %esi,%eax
+  805d56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805d5a:	c9                   	leave
+  805d5b:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805d5c:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805d63:	00 00 00 
+  805d66:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805d6d:	48 89 d8             	mov    %rbx,%rax
+  805d70:	48 a3 40 bc 80 01 00 	movabs %rax,0x180bc40
+  805d77:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805d7a:	eb d8                	jmp    805d54 <add_pgfault_handler+0x11d>
+
+0000000000805d7c <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805d7c:	55                   	push   %rbp
+  805d7d:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805d80:	48 b8 80 bc 80 01 00 	movabs $0x180bc80,%rax
+  805d87:	00 00 00 
+  805d8a:	80 38 00             	cmpb   $0x0,(%rax)
+  805d8d:	74 33                	je     805dc2 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805d8f:	48 a1 88 bc 80 01 00 	movabs 0x180bc88,%rax
+  805d96:	00 00 00 
+  805d99:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805d9e:	48 ba 40 bc 80 01 00 	movabs $0x180bc40,%rdx
+  805da5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805da8:	48 85 c0             	test   %rax,%rax
+  805dab:	0f 84 85 00 00 00    	je     805e36 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805db1:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805db5:	74 40                	je     805df7 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805db7:	48 83 c1 01          	add    $0x1,%rcx
+  805dbb:	48 39 c1             	cmp    %rax,%rcx
+  805dbe:	75 f1                	jne    805db1 <remove_pgfault_handler+0x35>
+  805dc0:	eb 74                	jmp    805e36 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805dc2:	48 b9 4e 6f 80 00 00 	movabs $0x806f4e,%rcx
+  805dc9:	00 00 00 
+  805dcc:	48 ba b6 6d 80 00 00 	movabs $0x806db6,%rdx
+  805dd3:	00 00 00 
+  805dd6:	be 48 00 00 00       	mov    $0x48,%esi
+  805ddb:	48 bf 28 6f 80 00 00 	movabs $0x806f28,%rdi
+  805de2:	00 00 00 
+  805de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dea:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  805df1:	00 00 00 
+  805df4:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805df7:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805dfe:	00 
+  805dff:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805e03:	48 29 ca             	sub    %rcx,%rdx
+  805e06:	48 b8 40 bc 80 01 00 	movabs $0x180bc40,%rax
+  805e0d:	00 00 00 
+  805e10:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805e14:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805e19:	48 89 ce             	mov    %rcx,%rsi
+  805e1c:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  805e23:	00 00 00 
+  805e26:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805e28:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805e2f:	00 00 00 
+  805e32:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805e36:	5d                   	pop    %rbp
+  805e37:	c3                   	ret
+
+0000000000805e38 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805e38:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805e3b:	48 b8 ad 5b 80 00 00 	movabs $0x805bad,%rax
+  805e42:	00 00 00 
+    call *%rax
+  805e45:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805e47:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805e4e:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805e4f:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805e56:	00 
+    subq $8, %rcx
+  805e57:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805e5b:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805e5e:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805e65:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805e66:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805e6a:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805e6e:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805e73:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805e78:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805e7d:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805e82:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805e87:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805e8c:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805e91:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805e96:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805e9b:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805ea0:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805ea5:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805eaa:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805eaf:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805eb4:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805eb8:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805ebc:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805ebd:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805ebe:	c3                   	ret
+
+0000000000805ebf <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805ebf:	85 ff                	test   %edi,%edi
+  805ec1:	78 58                	js     805f1b <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805ec3:	48 85 f6             	test   %rsi,%rsi
+  805ec6:	74 12                	je     805eda <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805ec8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805ecf:	00 00 00 
+  805ed2:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805ed8:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805eda:	48 85 c9             	test   %rcx,%rcx
+  805edd:	74 12                	je     805ef1 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805edf:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805ee6:	00 00 00 
+  805ee9:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805eef:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805ef1:	48 85 d2             	test   %rdx,%rdx
+  805ef4:	74 14                	je     805f0a <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805ef6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805efd:	00 00 00 
+  805f00:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805f07:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805f0a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805f11:	00 00 00 
+  805f14:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805f1a:	c3                   	ret
+        if (from_env_store) {
+  805f1b:	48 85 f6             	test   %rsi,%rsi
+  805f1e:	74 06                	je     805f26 <ipc_result+0x67>
+            *from_env_store = 0;
+  805f20:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805f26:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805f28:	48 85 c9             	test   %rcx,%rcx
+  805f2b:	74 ed                	je     805f1a <ipc_result+0x5b>
+            *perm_store = 0;
+  805f2d:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805f33:	c3                   	ret
+
+0000000000805f34 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805f34:	55                   	push   %rbp
+  805f35:	48 89 e5             	mov    %rsp,%rbp
+  805f38:	41 55                	push   %r13
+  805f3a:	41 54                	push   %r12
+  805f3c:	53                   	push   %rbx
+  805f3d:	48 83 ec 08          	sub    $0x8,%rsp
+  805f41:	49 89 fc             	mov    %rdi,%r12
+  805f44:	48 89 f7             	mov    %rsi,%rdi
+  805f47:	48 89 d3             	mov    %rdx,%rbx
+  805f4a:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805f4d:	48 85 f6             	test   %rsi,%rsi
+  805f50:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805f57:	00 00 00 
+  805f5a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  805f63:	48 85 d2             	test   %rdx,%rdx
+  805f66:	74 03                	je     805f6b <ipc_recv+0x37>
+  805f68:	48 8b 32             	mov    (%rdx),%rsi
+  805f6b:	48 b8 cc 2e 80 00 00 	movabs $0x802ecc,%rax
+  805f72:	00 00 00 
+  805f75:	ff d0                	call   *%rax
+  805f77:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805f79:	4c 89 e9             	mov    %r13,%rcx
+  805f7c:	48 89 da             	mov    %rbx,%rdx
+  805f7f:	4c 89 e6             	mov    %r12,%rsi
+  805f82:	48 b8 bf 5e 80 00 00 	movabs $0x805ebf,%rax
+  805f89:	00 00 00 
+  805f8c:	ff d0                	call   *%rax
+}
+  805f8e:	48 83 c4 08          	add    $0x8,%rsp
+  805f92:	5b                   	pop    %rbx
+  805f93:	41 5c                	pop    %r12
+  805f95:	41 5d                	pop    %r13
+  805f97:	5d                   	pop    %rbp
+  805f98:	c3                   	ret
+
+0000000000805f99 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805f99:	55                   	push   %rbp
+  805f9a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805f9d:	48 85 d2             	test   %rdx,%rdx
+  805fa0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805fa7:	00 00 00 
+  805faa:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805fae:	89 f6                	mov    %esi,%esi
+  805fb0:	48 b8 58 2d 80 00 00 	movabs $0x802d58,%rax
+  805fb7:	00 00 00 
+  805fba:	ff d0                	call   *%rax
+    if (res < 0) {
+  805fbc:	85 c0                	test   %eax,%eax
+  805fbe:	78 02                	js     805fc2 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805fc0:	5d                   	pop    %rbp
+  805fc1:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805fc2:	89 c1                	mov    %eax,%ecx
+  805fc4:	48 ba 68 6f 80 00 00 	movabs $0x806f68,%rdx
+  805fcb:	00 00 00 
+  805fce:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805fd3:	48 bf 75 6f 80 00 00 	movabs $0x806f75,%rdi
+  805fda:	00 00 00 
+  805fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fe2:	49 b8 94 17 80 00 00 	movabs $0x801794,%r8
+  805fe9:	00 00 00 
+  805fec:	41 ff d0             	call   *%r8
+
+0000000000805fef <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805fef:	55                   	push   %rbp
+  805ff0:	48 89 e5             	mov    %rsp,%rbp
+  805ff3:	53                   	push   %rbx
+  805ff4:	48 83 ec 08          	sub    $0x8,%rsp
+  805ff8:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805ffc:	48 85 d2             	test   %rdx,%rdx
+  805fff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806006:	00 00 00 
+  806009:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80600d:	4d 85 c9             	test   %r9,%r9
+  806010:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  806014:	b8 00 00 00 00       	mov    $0x0,%eax
+  806019:	48 85 db             	test   %rbx,%rbx
+  80601c:	74 03                	je     806021 <ipc_call+0x32>
+  80601e:	48 8b 03             	mov    (%rbx),%rax
+  806021:	89 f6                	mov    %esi,%esi
+  806023:	48 83 ec 08          	sub    $0x8,%rsp
+  806027:	50                   	push   %rax
+  806028:	48 b8 8a 2d 80 00 00 	movabs $0x802d8a,%rax
+  80602f:	00 00 00 
+  806032:	ff d0                	call   *%rax
+  806034:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  806036:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80603a:	48 89 da             	mov    %rbx,%rdx
+  80603d:	be 00 00 00 00       	mov    $0x0,%esi
+  806042:	48 b8 bf 5e 80 00 00 	movabs $0x805ebf,%rax
+  806049:	00 00 00 
+  80604c:	ff d0                	call   *%rax
+}
+  80604e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806052:	c9                   	leave
+  806053:	c3                   	ret
+
+0000000000806054 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  806054:	55                   	push   %rbp
+  806055:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  806058:	89 f6                	mov    %esi,%esi
+  80605a:	48 b8 f6 2d 80 00 00 	movabs $0x802df6,%rax
+  806061:	00 00 00 
+  806064:	ff d0                	call   *%rax
+  806066:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  806068:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80606d:	ba 00 00 00 00       	mov    $0x0,%edx
+  806072:	be 00 00 00 00       	mov    $0x0,%esi
+  806077:	48 b8 bf 5e 80 00 00 	movabs $0x805ebf,%rax
+  80607e:	00 00 00 
+  806081:	ff d0                	call   *%rax
+}
+  806083:	5d                   	pop    %rbp
+  806084:	c3                   	ret
+
+0000000000806085 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  806085:	55                   	push   %rbp
+  806086:	48 89 e5             	mov    %rsp,%rbp
+  806089:	41 54                	push   %r12
+  80608b:	53                   	push   %rbx
+  80608c:	4c 89 cb             	mov    %r9,%rbx
+  80608f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  806093:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  806097:	48 85 d2             	test   %rdx,%rdx
+  80609a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8060a1:	00 00 00 
+  8060a4:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8060a8:	4d 85 c9             	test   %r9,%r9
+  8060ab:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8060af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060b4:	4d 85 e4             	test   %r12,%r12
+  8060b7:	74 04                	je     8060bd <ipc_reply_wait+0x38>
+  8060b9:	49 8b 04 24          	mov    (%r12),%rax
+  8060bd:	89 f6                	mov    %esi,%esi
+  8060bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8060c3:	50                   	push   %rax
+  8060c4:	48 b8 60 2e 80 00 00 	movabs $0x802e60,%rax
+  8060cb:	00 00 00 
+  8060ce:	ff d0                	call   *%rax
+  8060d0:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8060d2:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8060d6:	4c 89 e2             	mov    %r12,%rdx
+  8060d9:	48 89 de             	mov    %rbx,%rsi
+  8060dc:	48 b8 bf 5e 80 00 00 	movabs $0x805ebf,%rax
+  8060e3:	00 00 00 
+  8060e6:	ff d0                	call   *%rax
+}
+  8060e8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8060ec:	5b                   	pop    %rbx
+  8060ed:	41 5c                	pop    %r12
+  8060ef:	5d                   	pop    %rbp
+  8060f0:	c3                   	ret
+
+00000000008060f1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8060f1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8060f6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8060fd:	00 00 00 
+  806100:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  806107:	48 01 ca             	add    %rcx,%rdx
+  80610a:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  806110:	39 fa                	cmp    %edi,%edx
+  806112:	74 12                	je     806126 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  806114:	48 83 c0 01          	add    $0x1,%rax
+  806118:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80611e:	75 e0                	jne    806100 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  806120:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806125:	c3                   	ret
+            return envs[i].env_id;
+  806126:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80612d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  806134:	00 00 00 
+  806137:	48 01 d0             	add    %rdx,%rax
+  80613a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  806140:	c3                   	ret
+  806141:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000806148 <__rodata_start>:
+  806148:	77 00                	ja     80614a <__rodata_start+0x2>
+  80614a:	72 62                	jb     8061ae <__rodata_start+0x66>
+  80614c:	00 77 62             	add    %dh,0x62(%rdi)
+  80614f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  806152:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  806159:	00 
+  80615a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  806160:	b3 09                	mov    $0x9,%bl
+  806162:	80 00 00             	addb   $0x0,(%rax)
+  806165:	00 00                	add    %al,(%rax)
+  806167:	00 ed                	add    %ch,%ch
+  806169:	0d 80 00 00 00       	or     $0x80,%eax
+  80616e:	00 00                	add    %al,(%rax)
+  806170:	ed                   	in     (%dx),%eax
+  806171:	0d 80 00 00 00       	or     $0x80,%eax
+  806176:	00 00                	add    %al,(%rax)
+  806178:	ed                   	in     (%dx),%eax
+  806179:	0d 80 00 00 00       	or     $0x80,%eax
+  80617e:	00 00                	add    %al,(%rax)
+  806180:	ed                   	in     (%dx),%eax
+  806181:	0d 80 00 00 00       	or     $0x80,%eax
+  806186:	00 00                	add    %al,(%rax)
+  806188:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80618d:	00 00                	add    %al,(%rax)
+  80618f:	00 ed                	add    %ch,%ch
+  806191:	0d 80 00 00 00       	or     $0x80,%eax
+  806196:	00 00                	add    %al,(%rax)
+  806198:	ed                   	in     (%dx),%eax
+  806199:	0d 80 00 00 00       	or     $0x80,%eax
+  80619e:	00 00                	add    %al,(%rax)
+  8061a0:	ed                   	in     (%dx),%eax
+  8061a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061a6:	00 00                	add    %al,(%rax)
+  8061a8:	ed                   	in     (%dx),%eax
+  8061a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061ae:	00 00                	add    %al,(%rax)
+  8061b0:	ed                   	in     (%dx),%eax
+  8061b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061b6:	00 00                	add    %al,(%rax)
+  8061b8:	8c 0a                	mov    %cs,(%rdx)
+  8061ba:	80 00 00             	addb   $0x0,(%rax)
+  8061bd:	00 00                	add    %al,(%rax)
+  8061bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061c6:	00 00                	add    %al,(%rax)
+  8061c8:	8c 0a                	mov    %cs,(%rdx)
+  8061ca:	80 00 00             	addb   $0x0,(%rax)
+  8061cd:	00 00                	add    %al,(%rax)
+  8061cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061d6:	00 00                	add    %al,(%rax)
+  8061d8:	8c 0a                	mov    %cs,(%rdx)
+  8061da:	80 00 00             	addb   $0x0,(%rax)
+  8061dd:	00 00                	add    %al,(%rax)
+  8061df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061e6:	00 00                	add    %al,(%rax)
+  8061e8:	8c 0a                	mov    %cs,(%rdx)
+  8061ea:	80 00 00             	addb   $0x0,(%rax)
+  8061ed:	00 00                	add    %al,(%rax)
+  8061ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061f6:	00 00                	add    %al,(%rax)
+  8061f8:	8c 0a                	mov    %cs,(%rdx)
+  8061fa:	80 00 00             	addb   $0x0,(%rax)
+  8061fd:	00 00                	add    %al,(%rax)
+  8061ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806206:	00 00                	add    %al,(%rax)
+  806208:	ed                   	in     (%dx),%eax
+  806209:	0d 80 00 00 00       	or     $0x80,%eax
+  80620e:	00 00                	add    %al,(%rax)
+  806210:	ed                   	in     (%dx),%eax
+  806211:	0d 80 00 00 00       	or     $0x80,%eax
+  806216:	00 00                	add    %al,(%rax)
+  806218:	ed                   	in     (%dx),%eax
+  806219:	0d 80 00 00 00       	or     $0x80,%eax
+  80621e:	00 00                	add    %al,(%rax)
+  806220:	ed                   	in     (%dx),%eax
+  806221:	0d 80 00 00 00       	or     $0x80,%eax
+  806226:	00 00                	add    %al,(%rax)
+  806228:	ed                   	in     (%dx),%eax
+  806229:	0d 80 00 00 00       	or     $0x80,%eax
+  80622e:	00 00                	add    %al,(%rax)
+  806230:	ed                   	in     (%dx),%eax
+  806231:	0d 80 00 00 00       	or     $0x80,%eax
+  806236:	00 00                	add    %al,(%rax)
+  806238:	ed                   	in     (%dx),%eax
+  806239:	0d 80 00 00 00       	or     $0x80,%eax
+  80623e:	00 00                	add    %al,(%rax)
+  806240:	ed                   	in     (%dx),%eax
+  806241:	0d 80 00 00 00       	or     $0x80,%eax
+  806246:	00 00                	add    %al,(%rax)
+  806248:	ed                   	in     (%dx),%eax
+  806249:	0d 80 00 00 00       	or     $0x80,%eax
+  80624e:	00 00                	add    %al,(%rax)
+  806250:	ed                   	in     (%dx),%eax
+  806251:	0d 80 00 00 00       	or     $0x80,%eax
+  806256:	00 00                	add    %al,(%rax)
+  806258:	ed                   	in     (%dx),%eax
+  806259:	0d 80 00 00 00       	or     $0x80,%eax
+  80625e:	00 00                	add    %al,(%rax)
+  806260:	ed                   	in     (%dx),%eax
+  806261:	0d 80 00 00 00       	or     $0x80,%eax
+  806266:	00 00                	add    %al,(%rax)
+  806268:	ed                   	in     (%dx),%eax
+  806269:	0d 80 00 00 00       	or     $0x80,%eax
+  80626e:	00 00                	add    %al,(%rax)
+  806270:	ed                   	in     (%dx),%eax
+  806271:	0d 80 00 00 00       	or     $0x80,%eax
+  806276:	00 00                	add    %al,(%rax)
+  806278:	ed                   	in     (%dx),%eax
+  806279:	0d 80 00 00 00       	or     $0x80,%eax
+  80627e:	00 00                	add    %al,(%rax)
+  806280:	ed                   	in     (%dx),%eax
+  806281:	0d 80 00 00 00       	or     $0x80,%eax
+  806286:	00 00                	add    %al,(%rax)
+  806288:	ed                   	in     (%dx),%eax
+  806289:	0d 80 00 00 00       	or     $0x80,%eax
+  80628e:	00 00                	add    %al,(%rax)
+  806290:	ed                   	in     (%dx),%eax
+  806291:	0d 80 00 00 00       	or     $0x80,%eax
+  806296:	00 00                	add    %al,(%rax)
+  806298:	ed                   	in     (%dx),%eax
+  806299:	0d 80 00 00 00       	or     $0x80,%eax
+  80629e:	00 00                	add    %al,(%rax)
+  8062a0:	ed                   	in     (%dx),%eax
+  8062a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062a6:	00 00                	add    %al,(%rax)
+  8062a8:	ed                   	in     (%dx),%eax
+  8062a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062ae:	00 00                	add    %al,(%rax)
+  8062b0:	ed                   	in     (%dx),%eax
+  8062b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062b6:	00 00                	add    %al,(%rax)
+  8062b8:	ed                   	in     (%dx),%eax
+  8062b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062be:	00 00                	add    %al,(%rax)
+  8062c0:	ed                   	in     (%dx),%eax
+  8062c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062c6:	00 00                	add    %al,(%rax)
+  8062c8:	ed                   	in     (%dx),%eax
+  8062c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062ce:	00 00                	add    %al,(%rax)
+  8062d0:	ed                   	in     (%dx),%eax
+  8062d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062d6:	00 00                	add    %al,(%rax)
+  8062d8:	ed                   	in     (%dx),%eax
+  8062d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062de:	00 00                	add    %al,(%rax)
+  8062e0:	ed                   	in     (%dx),%eax
+  8062e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062e6:	00 00                	add    %al,(%rax)
+  8062e8:	ed                   	in     (%dx),%eax
+  8062e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062ee:	00 00                	add    %al,(%rax)
+  8062f0:	ed                   	in     (%dx),%eax
+  8062f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062f6:	00 00                	add    %al,(%rax)
+  8062f8:	f4                   	hlt
+  8062f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8062ff:	00 ed                	add    %ch,%ch
+  806301:	0d 80 00 00 00       	or     $0x80,%eax
+  806306:	00 00                	add    %al,(%rax)
+  806308:	ed                   	in     (%dx),%eax
+  806309:	0d 80 00 00 00       	or     $0x80,%eax
+  80630e:	00 00                	add    %al,(%rax)
+  806310:	2c 0b                	sub    $0xb,%al
+  806312:	80 00 00             	addb   $0x0,(%rax)
+  806315:	00 00                	add    %al,(%rax)
+  806317:	00 ed                	add    %ch,%ch
+  806319:	0d 80 00 00 00       	or     $0x80,%eax
+  80631e:	00 00                	add    %al,(%rax)
+  806320:	ed                   	in     (%dx),%eax
+  806321:	0d 80 00 00 00       	or     $0x80,%eax
+  806326:	00 00                	add    %al,(%rax)
+  806328:	ed                   	in     (%dx),%eax
+  806329:	0d 80 00 00 00       	or     $0x80,%eax
+  80632e:	00 00                	add    %al,(%rax)
+  806330:	ed                   	in     (%dx),%eax
+  806331:	0d 80 00 00 00       	or     $0x80,%eax
+  806336:	00 00                	add    %al,(%rax)
+  806338:	ed                   	in     (%dx),%eax
+  806339:	0d 80 00 00 00       	or     $0x80,%eax
+  80633e:	00 00                	add    %al,(%rax)
+  806340:	ed                   	in     (%dx),%eax
+  806341:	0d 80 00 00 00       	or     $0x80,%eax
+  806346:	00 00                	add    %al,(%rax)
+  806348:	ed                   	in     (%dx),%eax
+  806349:	0d 80 00 00 00       	or     $0x80,%eax
+  80634e:	00 00                	add    %al,(%rax)
+  806350:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806353:	00 00                	add    %al,(%rax)
+  806355:	00 00                	add    %al,(%rax)
+  806357:	00 cb                	add    %cl,%bl
+  806359:	0d 80 00 00 00       	or     $0x80,%eax
+  80635e:	00 00                	add    %al,(%rax)
+  806360:	ed                   	in     (%dx),%eax
+  806361:	0d 80 00 00 00       	or     $0x80,%eax
+  806366:	00 00                	add    %al,(%rax)
+  806368:	ed                   	in     (%dx),%eax
+  806369:	0d 80 00 00 00       	or     $0x80,%eax
+  80636e:	00 00                	add    %al,(%rax)
+  806370:	ed                   	in     (%dx),%eax
+  806371:	0d 80 00 00 00       	or     $0x80,%eax
+  806376:	00 00                	add    %al,(%rax)
+  806378:	6a 0a                	push   $0xa
+  80637a:	80 00 00             	addb   $0x0,(%rax)
+  80637d:	00 00                	add    %al,(%rax)
+  80637f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806385:	00 00                	add    %al,(%rax)
+  806387:	00 ed                	add    %ch,%ch
+  806389:	0d 80 00 00 00       	or     $0x80,%eax
+  80638e:	00 00                	add    %al,(%rax)
+  806390:	ed                   	in     (%dx),%eax
+  806391:	0d 80 00 00 00       	or     $0x80,%eax
+  806396:	00 00                	add    %al,(%rax)
+  806398:	3c 0a                	cmp    $0xa,%al
+  80639a:	80 00 00             	addb   $0x0,(%rax)
+  80639d:	00 00                	add    %al,(%rax)
+  80639f:	00 ed                	add    %ch,%ch
+  8063a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8063a6:	00 00                	add    %al,(%rax)
+  8063a8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  8063ab:	00 00                	add    %al,(%rax)
+  8063ad:	00 00                	add    %al,(%rax)
+  8063af:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  8063b5:	00 00                	add    %al,(%rax)
+  8063b7:	00 29                	add    %ch,(%rcx)
+  8063b9:	0c 80                	or     $0x80,%al
+  8063bb:	00 00                	add    %al,(%rax)
+  8063bd:	00 00                	add    %al,(%rax)
+  8063bf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8063c2:	80 00 00             	addb   $0x0,(%rax)
+  8063c5:	00 00                	add    %al,(%rax)
+  8063c7:	00 ed                	add    %ch,%ch
+  8063c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063ce:	00 00                	add    %al,(%rax)
+  8063d0:	1a 0b                	sbb    (%rbx),%cl
+  8063d2:	80 00 00             	addb   $0x0,(%rax)
+  8063d5:	00 00                	add    %al,(%rax)
+  8063d7:	00 ed                	add    %ch,%ch
+  8063d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063de:	00 00                	add    %al,(%rax)
+  8063e0:	ce                   	(bad)
+  8063e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8063e7:	00 ed                	add    %ch,%ch
+  8063e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063ee:	00 00                	add    %al,(%rax)
+  8063f0:	ed                   	in     (%dx),%eax
+  8063f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8063f6:	00 00                	add    %al,(%rax)
+  8063f8:	f4                   	hlt
+  8063f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8063ff:	00 37                	add    %dh,(%rdi)
+  806401:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806407:	00 5f 12             	add    %bl,0x12(%rdi)
+  80640a:	80 00 00             	addb   $0x0,(%rax)
+  80640d:	00 00                	add    %al,(%rax)
+  80640f:	00 37                	add    %dh,(%rdi)
+  806411:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806417:	00 5f 12             	add    %bl,0x12(%rdi)
+  80641a:	80 00 00             	addb   $0x0,(%rax)
+  80641d:	00 00                	add    %al,(%rax)
+  80641f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806422:	80 00 00             	addb   $0x0,(%rax)
+  806425:	00 00                	add    %al,(%rax)
+  806427:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80642b:	00 00                	add    %al,(%rax)
+  80642d:	00 00                	add    %al,(%rax)
+  80642f:	00 d2                	add    %dl,%dl
+  806431:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806437:	00 d2                	add    %dl,%dl
+  806439:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80643f:	00 d2                	add    %dl,%dl
+  806441:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806447:	00 d2                	add    %dl,%dl
+  806449:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80644f:	00 d2                	add    %dl,%dl
+  806451:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806457:	00 d2                	add    %dl,%dl
+  806459:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80645f:	00 d2                	add    %dl,%dl
+  806461:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806467:	00 f6                	add    %dh,%dh
+  806469:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80646f:	00 f6                	add    %dh,%dh
+  806471:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806477:	00 5f 12             	add    %bl,0x12(%rdi)
+  80647a:	80 00 00             	addb   $0x0,(%rax)
+  80647d:	00 00                	add    %al,(%rax)
+  80647f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806482:	80 00 00             	addb   $0x0,(%rax)
+  806485:	00 00                	add    %al,(%rax)
+  806487:	00 5f 12             	add    %bl,0x12(%rdi)
+  80648a:	80 00 00             	addb   $0x0,(%rax)
+  80648d:	00 00                	add    %al,(%rax)
+  80648f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806492:	80 00 00             	addb   $0x0,(%rax)
+  806495:	00 00                	add    %al,(%rax)
+  806497:	00 5f 12             	add    %bl,0x12(%rdi)
+  80649a:	80 00 00             	addb   $0x0,(%rax)
+  80649d:	00 00                	add    %al,(%rax)
+  80649f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064a2:	80 00 00             	addb   $0x0,(%rax)
+  8064a5:	00 00                	add    %al,(%rax)
+  8064a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064aa:	80 00 00             	addb   $0x0,(%rax)
+  8064ad:	00 00                	add    %al,(%rax)
+  8064af:	00 22                	add    %ah,(%rdx)
+  8064b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064b7:	00 22                	add    %ah,(%rdx)
+  8064b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064bf:	00 22                	add    %ah,(%rdx)
+  8064c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064c7:	00 22                	add    %ah,(%rdx)
+  8064c9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064cf:	00 22                	add    %ah,(%rdx)
+  8064d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064d7:	00 22                	add    %ah,(%rdx)
+  8064d9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064e2:	80 00 00             	addb   $0x0,(%rax)
+  8064e5:	00 00                	add    %al,(%rax)
+  8064e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064ea:	80 00 00             	addb   $0x0,(%rax)
+  8064ed:	00 00                	add    %al,(%rax)
+  8064ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064f2:	80 00 00             	addb   $0x0,(%rax)
+  8064f5:	00 00                	add    %al,(%rax)
+  8064f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064fa:	80 00 00             	addb   $0x0,(%rax)
+  8064fd:	00 00                	add    %al,(%rax)
+  8064ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806502:	80 00 00             	addb   $0x0,(%rax)
+  806505:	00 00                	add    %al,(%rax)
+  806507:	00 5f 12             	add    %bl,0x12(%rdi)
+  80650a:	80 00 00             	addb   $0x0,(%rax)
+  80650d:	00 00                	add    %al,(%rax)
+  80650f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806512:	80 00 00             	addb   $0x0,(%rax)
+  806515:	00 00                	add    %al,(%rax)
+  806517:	00 5f 12             	add    %bl,0x12(%rdi)
+  80651a:	80 00 00             	addb   $0x0,(%rax)
+  80651d:	00 00                	add    %al,(%rax)
+  80651f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806522:	80 00 00             	addb   $0x0,(%rax)
+  806525:	00 00                	add    %al,(%rax)
+  806527:	00 5f 12             	add    %bl,0x12(%rdi)
+  80652a:	80 00 00             	addb   $0x0,(%rax)
+  80652d:	00 00                	add    %al,(%rax)
+  80652f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806532:	80 00 00             	addb   $0x0,(%rax)
+  806535:	00 00                	add    %al,(%rax)
+  806537:	00 5f 12             	add    %bl,0x12(%rdi)
+  80653a:	80 00 00             	addb   $0x0,(%rax)
+  80653d:	00 00                	add    %al,(%rax)
+  80653f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806542:	80 00 00             	addb   $0x0,(%rax)
+  806545:	00 00                	add    %al,(%rax)
+  806547:	00 5f 12             	add    %bl,0x12(%rdi)
+  80654a:	80 00 00             	addb   $0x0,(%rax)
+  80654d:	00 00                	add    %al,(%rax)
+  80654f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806552:	80 00 00             	addb   $0x0,(%rax)
+  806555:	00 00                	add    %al,(%rax)
+  806557:	00 5f 12             	add    %bl,0x12(%rdi)
+  80655a:	80 00 00             	addb   $0x0,(%rax)
+  80655d:	00 00                	add    %al,(%rax)
+  80655f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806562:	80 00 00             	addb   $0x0,(%rax)
+  806565:	00 00                	add    %al,(%rax)
+  806567:	00 46 12             	add    %al,0x12(%rsi)
+  80656a:	80 00 00             	addb   $0x0,(%rax)
+  80656d:	00 00                	add    %al,(%rax)
+  80656f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806572:	80 00 00             	addb   $0x0,(%rax)
+  806575:	00 00                	add    %al,(%rax)
+  806577:	00 5f 12             	add    %bl,0x12(%rdi)
+  80657a:	80 00 00             	addb   $0x0,(%rax)
+  80657d:	00 00                	add    %al,(%rax)
+  80657f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806582:	80 00 00             	addb   $0x0,(%rax)
+  806585:	00 00                	add    %al,(%rax)
+  806587:	00 5f 12             	add    %bl,0x12(%rdi)
+  80658a:	80 00 00             	addb   $0x0,(%rax)
+  80658d:	00 00                	add    %al,(%rax)
+  80658f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806592:	80 00 00             	addb   $0x0,(%rax)
+  806595:	00 00                	add    %al,(%rax)
+  806597:	00 5f 12             	add    %bl,0x12(%rdi)
+  80659a:	80 00 00             	addb   $0x0,(%rax)
+  80659d:	00 00                	add    %al,(%rax)
+  80659f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065a2:	80 00 00             	addb   $0x0,(%rax)
+  8065a5:	00 00                	add    %al,(%rax)
+  8065a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065aa:	80 00 00             	addb   $0x0,(%rax)
+  8065ad:	00 00                	add    %al,(%rax)
+  8065af:	00 22                	add    %ah,(%rdx)
+  8065b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065b7:	00 22                	add    %ah,(%rdx)
+  8065b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065bf:	00 22                	add    %ah,(%rdx)
+  8065c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065c7:	00 22                	add    %ah,(%rdx)
+  8065c9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065cf:	00 22                	add    %ah,(%rdx)
+  8065d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065d7:	00 22                	add    %ah,(%rdx)
+  8065d9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065e2:	80 00 00             	addb   $0x0,(%rax)
+  8065e5:	00 00                	add    %al,(%rax)
+  8065e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065ea:	80 00 00             	addb   $0x0,(%rax)
+  8065ed:	00 00                	add    %al,(%rax)
+  8065ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065f2:	80 00 00             	addb   $0x0,(%rax)
+  8065f5:	00 00                	add    %al,(%rax)
+  8065f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065fa:	80 00 00             	addb   $0x0,(%rax)
+  8065fd:	00 00                	add    %al,(%rax)
+  8065ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806602:	80 00 00             	addb   $0x0,(%rax)
+  806605:	00 00                	add    %al,(%rax)
+  806607:	00 5f 12             	add    %bl,0x12(%rdi)
+  80660a:	80 00 00             	addb   $0x0,(%rax)
+  80660d:	00 00                	add    %al,(%rax)
+  80660f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806612:	80 00 00             	addb   $0x0,(%rax)
+  806615:	00 00                	add    %al,(%rax)
+  806617:	00 5f 12             	add    %bl,0x12(%rdi)
+  80661a:	80 00 00             	addb   $0x0,(%rax)
+  80661d:	00 00                	add    %al,(%rax)
+  80661f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806622:	80 00 00             	addb   $0x0,(%rax)
+  806625:	00 00                	add    %al,(%rax)
+  806627:	00 5f 12             	add    %bl,0x12(%rdi)
+  80662a:	80 00 00             	addb   $0x0,(%rax)
+  80662d:	00 00                	add    %al,(%rax)
+  80662f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806632:	80 00 00             	addb   $0x0,(%rax)
+  806635:	00 00                	add    %al,(%rax)
+  806637:	00 5f 12             	add    %bl,0x12(%rdi)
+  80663a:	80 00 00             	addb   $0x0,(%rax)
+  80663d:	00 00                	add    %al,(%rax)
+  80663f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806642:	80 00 00             	addb   $0x0,(%rax)
+  806645:	00 00                	add    %al,(%rax)
+  806647:	00 5f 12             	add    %bl,0x12(%rdi)
+  80664a:	80 00 00             	addb   $0x0,(%rax)
+  80664d:	00 00                	add    %al,(%rax)
+  80664f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806652:	80 00 00             	addb   $0x0,(%rax)
+  806655:	00 00                	add    %al,(%rax)
+  806657:	00 5f 12             	add    %bl,0x12(%rdi)
+  80665a:	80 00 00             	addb   $0x0,(%rax)
+  80665d:	00 00                	add    %al,(%rax)
+  80665f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806662:	80 00 00             	addb   $0x0,(%rax)
+  806665:	00 00                	add    %al,(%rax)
+  806667:	00 46 12             	add    %al,0x12(%rsi)
+  80666a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806680 <basefix.0>:
+  806680:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806690:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  8066a0:	10 00 69 63 6f 64 65 00 69 63 6f 64 65 20 73 74     ..icode.icode st
+  8066b0:	61 72 74 75 70 0a 00 69 63 6f 64 65 3a 20 6f 70     artup..icode: op
+  8066c0:	65 6e 20 2f 6d 6f 74 64 0a 00 2f 6d 6f 74 64 00     en /motd../motd.
+  8066d0:	69 63 6f 64 65 3a 20 6f 70 65 6e 20 2f 6d 6f 74     icode: open /mot
+  8066e0:	64 3a 20 25 69 00 75 73 65 72 2f 69 63 6f 64 65     d: %i.user/icode
+  8066f0:	2e 63 00 69 63 6f 64 65 3a 20 72 65 61 64 20 2f     .c.icode: read /
+  806700:	6d 6f 74 64 0a 00 69 63 6f 64 65 3a 20 63 6c 6f     motd..icode: clo
+  806710:	73 65 20 2f 6d 6f 74 64 0a 00 69 63 6f 64 65 3a     se /motd..icode:
+  806720:	20 73 70 61 77 6e 20 2f 69 6e 69 74 0a 00 69 6e      spawn /init..in
+  806730:	69 74 61 72 67 32 00 69 6e 69 74 61 72 67 31 00     itarg2.initarg1.
+  806740:	2f 69 6e 69 74 00 69 63 6f 64 65 3a 20 73 70 61     /init.icode: spa
+  806750:	77 6e 20 2f 69 6e 69 74 3a 20 25 69 00 69 63 6f     wn /init: %i.ico
+  806760:	64 65 3a 20 65 78 69 74 69 6e 67 0a 00 3c 75 6e     de: exiting..<un
+  806770:	6b 6e 6f 77 6e 3e 00 90 5b 25 30 38 78 5d 20 75     known>..[%08x] u
+  806780:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806790:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  8067a0:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  8067b0:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  8067c0:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  8067d0:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  8067e0:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  8067f0:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  806800:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  806810:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  806820:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  806830:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  806840:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  806850:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  806860:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  806870:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  806880:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  806890:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  8068a0:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  8068b0:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  8068c0:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  8068d0:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  8068e0:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  8068f0:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  806900:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  806910:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  806920:	73 75 70 70 6f 72 74 65 64 00 66 2e 0f 1f 84 00     supported.f.....
+  806930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  806940:	dc 1a 80 00 00 00 00 00 33 21 80 00 00 00 00 00     ........3!......
+  806950:	23 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     #!......3!......
+  806960:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806970:	33 21 80 00 00 00 00 00 fb 1a 80 00 00 00 00 00     3!..............
+  806980:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806990:	ef 1a 80 00 00 00 00 00 69 1b 80 00 00 00 00 00     ........i.......
+  8069a0:	33 21 80 00 00 00 00 00 ef 1a 80 00 00 00 00 00     3!..............
+  8069b0:	35 1b 80 00 00 00 00 00 35 1b 80 00 00 00 00 00     5.......5.......
+  8069c0:	35 1b 80 00 00 00 00 00 35 1b 80 00 00 00 00 00     5.......5.......
+  8069d0:	35 1b 80 00 00 00 00 00 35 1b 80 00 00 00 00 00     5.......5.......
+  8069e0:	35 1b 80 00 00 00 00 00 35 1b 80 00 00 00 00 00     5.......5.......
+  8069f0:	35 1b 80 00 00 00 00 00 33 21 80 00 00 00 00 00     5.......3!......
+  806a00:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a10:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a20:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a30:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a40:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a50:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a60:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a70:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a80:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806a90:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806aa0:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806ab0:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806ac0:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806ad0:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806ae0:	33 21 80 00 00 00 00 00 51 20 80 00 00 00 00 00     3!......Q ......
+  806af0:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806b00:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806b10:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806b20:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806b30:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806b40:	97 1b 80 00 00 00 00 00 66 1d 80 00 00 00 00 00     ........f.......
+  806b50:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806b60:	33 21 80 00 00 00 00 00 8c 1b 80 00 00 00 00 00     3!..............
+  806b70:	c6 1b 80 00 00 00 00 00 33 21 80 00 00 00 00 00     ........3!......
+  806b80:	33 21 80 00 00 00 00 00 81 1b 80 00 00 00 00 00     3!..............
+  806b90:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806ba0:	0f 1f 80 00 00 00 00 00 de 1f 80 00 00 00 00 00     ................
+  806bb0:	33 21 80 00 00 00 00 00 33 21 80 00 00 00 00 00     3!......3!......
+  806bc0:	5d 1c 80 00 00 00 00 00 33 21 80 00 00 00 00 00     ].......3!......
+  806bd0:	3a 1e 80 00 00 00 00 00 33 21 80 00 00 00 00 00     :.......3!......
+  806be0:	33 21 80 00 00 00 00 00 51 20 80 00 00 00 00 00     3!......Q ......
+  806bf0:	33 21 80 00 00 00 00 00 e5 1a 80 00 00 00 00 00     3!..............
+
+0000000000806c00 <error_string>:
+	...
+  806c08:	cd 67 80 00 00 00 00 00 df 67 80 00 00 00 00 00     .g.......g......
+  806c18:	ef 67 80 00 00 00 00 00 01 68 80 00 00 00 00 00     .g.......h......
+  806c28:	0f 68 80 00 00 00 00 00 23 68 80 00 00 00 00 00     .h......#h......
+  806c38:	38 68 80 00 00 00 00 00 4b 68 80 00 00 00 00 00     8h......Kh......
+  806c48:	5d 68 80 00 00 00 00 00 71 68 80 00 00 00 00 00     ]h......qh......
+  806c58:	81 68 80 00 00 00 00 00 94 68 80 00 00 00 00 00     .h.......h......
+  806c68:	ab 68 80 00 00 00 00 00 c1 68 80 00 00 00 00 00     .h.......h......
+  806c78:	d9 68 80 00 00 00 00 00 f1 68 80 00 00 00 00 00     .h.......h......
+  806c88:	fe 68 80 00 00 00 00 00 a0 6c 80 00 00 00 00 00     .h.......l......
+  806c98:	12 69 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .i......file is 
+  806ca8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806cb8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806cc8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806cd8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806ce8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806cf8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806d08:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806d18:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806d28:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806d38:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806d48:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806d58:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806d68:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806d78:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806d80 <devtab>:
+  806d80:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806d90:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806da0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806db0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806dc0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806dd0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806de0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806df0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806e00:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806e10:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  806e20:	28 63 68 61 72 20 2a 29 73 74 61 63 6b 20 2b 20     (char *)stack + 
+  806e30:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  806e40:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  806e50:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  806e60:	72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 73 70 61     ror: %i..lib/spa
+  806e70:	77 6e 2e 63 00 45 6c 66 20 6d 61 67 69 63 20 25     wn.c.Elf magic %
+  806e80:	30 38 78 20 77 61 6e 74 20 25 30 38 78 0a 00 3c     08x want %08x..<
+  806e90:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  806ea0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  806eb0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806ec0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806ed0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806ee0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806ef0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806f00:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806f10:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806f20:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806f30:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806f40:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806f50:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806f60:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806f70:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
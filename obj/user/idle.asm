@@ -0,0 +1,10327 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 7e 22 80 00 00 	movabs $0x80227e,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 41 16 80 00 00 	movabs $0x801641,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 95 5c 80 00 00 	movabs $0x805c95,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 a8 39 80 00 00 	movabs $0x8039a8,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be d0 56 80 00 00 	movabs $0x8056d0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 a8 39 80 00 00 	movabs $0x8039a8,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be d2 56 80 00 00 	movabs $0x8056d2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 a8 39 80 00 00 	movabs $0x8039a8,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be d5 56 80 00 00 	movabs $0x8056d5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 9e 20 80 00 00 	movabs $0x80209e,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 a8 39 80 00 00 	movabs $0x8039a8,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 13 4a 80 00 00 	movabs $0x804a13,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 ea 4c 80 00 00 	movabs $0x804cea,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 92 2f 80 00 00 	movabs $0x802f92,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 29 33 80 00 00 	movabs $0x803329,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 f8 32 80 00 00 	movabs $0x8032f8,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 f8 32 80 00 00 	movabs $0x8032f8,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 10 31 80 00 00 	movabs $0x803110,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 a8 39 80 00 00 	movabs $0x8039a8,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 92 2f 80 00 00 	movabs $0x802f92,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 4b 22 80 00 00 	movabs $0x80224b,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 4b 22 80 00 00 	movabs $0x80224b,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 7e 22 80 00 00 	movabs $0x80227e,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 4b 22 80 00 00 	movabs $0x80224b,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 4b 22 80 00 00 	movabs $0x80224b,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 4b 22 80 00 00 	movabs $0x80224b,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 2d 00 00 00       	call   80152c <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "idle";
+  80150a:	48 b8 22 5c 80 00 00 	movabs $0x805c22,%rax
+  801511:	00 00 00 
+  801514:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80151b:	00 00 00 
+     * Instead of busy-waiting like this,
+     * a better way would be to use the processor's HLT instruction
+     * to cause the processor to stop executing until the next interrupt -
+     * doing so allows the processor to conserve power more effectively. */
+    while (1) {
+        sys_yield();
+  80151e:	48 bb a0 26 80 00 00 	movabs $0x8026a0,%rbx
+  801525:	00 00 00 
+  801528:	ff d3                	call   *%rbx
+    while (1) {
+  80152a:	eb fc                	jmp    801528 <umain+0x27>
+
+000000000080152c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80152c:	55                   	push   %rbp
+  80152d:	48 89 e5             	mov    %rsp,%rbp
+  801530:	41 56                	push   %r14
+  801532:	41 55                	push   %r13
+  801534:	41 54                	push   %r12
+  801536:	53                   	push   %rbx
+  801537:	41 89 fd             	mov    %edi,%r13d
+  80153a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80153d:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801544:	00 00 00 
+  801547:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80154e:	00 00 00 
+  801551:	48 39 c2             	cmp    %rax,%rdx
+  801554:	73 17                	jae    80156d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801556:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801559:	49 89 c4             	mov    %rax,%r12
+  80155c:	48 83 c3 08          	add    $0x8,%rbx
+  801560:	b8 00 00 00 00       	mov    $0x0,%eax
+  801565:	ff 53 f8             	call   *-0x8(%rbx)
+  801568:	4c 39 e3             	cmp    %r12,%rbx
+  80156b:	72 ef                	jb     80155c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80156d:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  801574:	00 00 00 
+  801577:	ff d0                	call   *%rax
+  801579:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80157e:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801585:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80158c:	00 00 00 
+  80158f:	48 01 d0             	add    %rdx,%rax
+  801592:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801599:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80159c:	45 85 ed             	test   %r13d,%r13d
+  80159f:	7e 0d                	jle    8015ae <libmain+0x82>
+  8015a1:	49 8b 06             	mov    (%r14),%rax
+  8015a4:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015ab:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015ae:	4c 89 f6             	mov    %r14,%rsi
+  8015b1:	44 89 ef             	mov    %r13d,%edi
+  8015b4:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015bb:	00 00 00 
+  8015be:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015c0:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  8015c7:	00 00 00 
+  8015ca:	ff d0                	call   *%rax
+#endif
+}
+  8015cc:	5b                   	pop    %rbx
+  8015cd:	41 5c                	pop    %r12
+  8015cf:	41 5d                	pop    %r13
+  8015d1:	41 5e                	pop    %r14
+  8015d3:	5d                   	pop    %rbp
+  8015d4:	c3                   	ret
+
+00000000008015d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015d5:	55                   	push   %rbp
+  8015d6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015d9:	48 b8 c5 2f 80 00 00 	movabs $0x802fc5,%rax
+  8015e0:	00 00 00 
+  8015e3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ea:	48 b8 f8 25 80 00 00 	movabs $0x8025f8,%rax
+  8015f1:	00 00 00 
+  8015f4:	ff d0                	call   *%rax
+}
+  8015f6:	5d                   	pop    %rbp
+  8015f7:	c3                   	ret
+
+00000000008015f8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015f8:	55                   	push   %rbp
+  8015f9:	48 89 e5             	mov    %rsp,%rbp
+  8015fc:	53                   	push   %rbx
+  8015fd:	48 83 ec 08          	sub    $0x8,%rsp
+  801601:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801604:	8b 06                	mov    (%rsi),%eax
+  801606:	8d 50 01             	lea    0x1(%rax),%edx
+  801609:	89 16                	mov    %edx,(%rsi)
+  80160b:	48 98                	cltq
+  80160d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801612:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801618:	74 0a                	je     801624 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80161a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80161e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801622:	c9                   	leave
+  801623:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801624:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801628:	be ff 00 00 00       	mov    $0xff,%esi
+  80162d:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  801634:	00 00 00 
+  801637:	ff d0                	call   *%rax
+        state->offset = 0;
+  801639:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80163f:	eb d9                	jmp    80161a <putch+0x22>
+
+0000000000801641 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801641:	55                   	push   %rbp
+  801642:	48 89 e5             	mov    %rsp,%rbp
+  801645:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80164c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80164f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801656:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80165b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801660:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801663:	48 89 f1             	mov    %rsi,%rcx
+  801666:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80166d:	48 bf f8 15 80 00 00 	movabs $0x8015f8,%rdi
+  801674:	00 00 00 
+  801677:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  80167e:	00 00 00 
+  801681:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801683:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80168a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801691:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  801698:	00 00 00 
+  80169b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80169d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8016a3:	c9                   	leave
+  8016a4:	c3                   	ret
+
+00000000008016a5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016a5:	55                   	push   %rbp
+  8016a6:	48 89 e5             	mov    %rsp,%rbp
+  8016a9:	48 83 ec 50          	sub    $0x50,%rsp
+  8016ad:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016b1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016b5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016b9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016bd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016c1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016d0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016d8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016dc:	48 b8 41 16 80 00 00 	movabs $0x801641,%rax
+  8016e3:	00 00 00 
+  8016e6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+
+00000000008016ea <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016ea:	55                   	push   %rbp
+  8016eb:	48 89 e5             	mov    %rsp,%rbp
+  8016ee:	41 57                	push   %r15
+  8016f0:	41 56                	push   %r14
+  8016f2:	41 55                	push   %r13
+  8016f4:	41 54                	push   %r12
+  8016f6:	53                   	push   %rbx
+  8016f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8016fb:	49 89 fc             	mov    %rdi,%r12
+  8016fe:	49 89 f5             	mov    %rsi,%r13
+  801701:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801705:	8b 45 10             	mov    0x10(%rbp),%eax
+  801708:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80170b:	41 89 cf             	mov    %ecx,%r15d
+  80170e:	4c 39 fa             	cmp    %r15,%rdx
+  801711:	73 5b                	jae    80176e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801713:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801717:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80171b:	85 db                	test   %ebx,%ebx
+  80171d:	7e 0e                	jle    80172d <print_num+0x43>
+            putch(padc, put_arg);
+  80171f:	4c 89 ee             	mov    %r13,%rsi
+  801722:	44 89 f7             	mov    %r14d,%edi
+  801725:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801728:	83 eb 01             	sub    $0x1,%ebx
+  80172b:	75 f2                	jne    80171f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80172d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801731:	48 b9 42 5c 80 00 00 	movabs $0x805c42,%rcx
+  801738:	00 00 00 
+  80173b:	48 b8 31 5c 80 00 00 	movabs $0x805c31,%rax
+  801742:	00 00 00 
+  801745:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801749:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801752:	49 f7 f7             	div    %r15
+  801755:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801759:	4c 89 ee             	mov    %r13,%rsi
+  80175c:	41 ff d4             	call   *%r12
+}
+  80175f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801763:	5b                   	pop    %rbx
+  801764:	41 5c                	pop    %r12
+  801766:	41 5d                	pop    %r13
+  801768:	41 5e                	pop    %r14
+  80176a:	41 5f                	pop    %r15
+  80176c:	5d                   	pop    %rbp
+  80176d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80176e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801772:	ba 00 00 00 00       	mov    $0x0,%edx
+  801777:	49 f7 f7             	div    %r15
+  80177a:	48 83 ec 08          	sub    $0x8,%rsp
+  80177e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801782:	52                   	push   %rdx
+  801783:	45 0f be c9          	movsbl %r9b,%r9d
+  801787:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80178b:	48 89 c2             	mov    %rax,%rdx
+  80178e:	48 b8 ea 16 80 00 00 	movabs $0x8016ea,%rax
+  801795:	00 00 00 
+  801798:	ff d0                	call   *%rax
+  80179a:	48 83 c4 10          	add    $0x10,%rsp
+  80179e:	eb 8d                	jmp    80172d <print_num+0x43>
+
+00000000008017a0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8017a0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8017a4:	48 8b 06             	mov    (%rsi),%rax
+  8017a7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017ab:	73 0a                	jae    8017b7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017ad:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017b1:	48 89 16             	mov    %rdx,(%rsi)
+  8017b4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017b7:	c3                   	ret
+
+00000000008017b8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017b8:	55                   	push   %rbp
+  8017b9:	48 89 e5             	mov    %rsp,%rbp
+  8017bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8017c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017c4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017c8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017cc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017db:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017e3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017e7:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+}
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+00000000008017f5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017f5:	55                   	push   %rbp
+  8017f6:	48 89 e5             	mov    %rsp,%rbp
+  8017f9:	41 57                	push   %r15
+  8017fb:	41 56                	push   %r14
+  8017fd:	41 55                	push   %r13
+  8017ff:	41 54                	push   %r12
+  801801:	53                   	push   %rbx
+  801802:	48 83 ec 38          	sub    $0x38,%rsp
+  801806:	49 89 fe             	mov    %rdi,%r14
+  801809:	49 89 f5             	mov    %rsi,%r13
+  80180c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80180f:	48 8b 01             	mov    (%rcx),%rax
+  801812:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801816:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80181a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80181e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801822:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801826:	eb 0d                	jmp    801835 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801828:	40 0f b6 ff          	movzbl %dil,%edi
+  80182c:	4c 89 ee             	mov    %r13,%rsi
+  80182f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801832:	4c 89 e3             	mov    %r12,%rbx
+  801835:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801839:	0f b6 3b             	movzbl (%rbx),%edi
+  80183c:	40 80 ff 25          	cmp    $0x25,%dil
+  801840:	74 14                	je     801856 <vprintfmt+0x61>
+            if (!ch) return;
+  801842:	40 84 ff             	test   %dil,%dil
+  801845:	75 e1                	jne    801828 <vprintfmt+0x33>
+}
+  801847:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80184b:	5b                   	pop    %rbx
+  80184c:	41 5c                	pop    %r12
+  80184e:	41 5d                	pop    %r13
+  801850:	41 5e                	pop    %r14
+  801852:	41 5f                	pop    %r15
+  801854:	5d                   	pop    %rbp
+  801855:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801856:	be 00 00 00 00       	mov    $0x0,%esi
+  80185b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80185f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801864:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80186a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801871:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801875:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80187a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80187f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801882:	83 e8 23             	sub    $0x23,%eax
+  801885:	3c 57                	cmp    $0x57,%al
+  801887:	0f 87 67 06 00 00    	ja     801ef4 <vprintfmt+0x6ff>
+  80188d:	0f b6 c0             	movzbl %al,%eax
+  801890:	48 b9 c0 5d 80 00 00 	movabs $0x805dc0,%rcx
+  801897:	00 00 00 
+  80189a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80189d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8018a0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8018a4:	eb cf                	jmp    801875 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018a6:	49 89 dc             	mov    %rbx,%r12
+  8018a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8018ae:	eb c5                	jmp    801875 <vprintfmt+0x80>
+            padc = ch;
+  8018b0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018b4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018b7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018ba:	eb b9                	jmp    801875 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8018c2:	77 24                	ja     8018e8 <vprintfmt+0xf3>
+  8018c4:	89 c1                	mov    %eax,%ecx
+  8018c6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018ca:	83 c0 08             	add    $0x8,%eax
+  8018cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018d0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018d3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018d6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018da:	79 99                	jns    801875 <vprintfmt+0x80>
+                width = precision;
+  8018dc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018e0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018e6:	eb 8d                	jmp    801875 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018e8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018ec:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f4:	eb da                	jmp    8018d0 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018f6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018fb:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018ff:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801905:	3c 39                	cmp    $0x39,%al
+  801907:	77 1c                	ja     801925 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801909:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80190d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801911:	0f b6 c0             	movzbl %al,%eax
+  801914:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801919:	0f b6 03             	movzbl (%rbx),%eax
+  80191c:	3c 39                	cmp    $0x39,%al
+  80191e:	76 e9                	jbe    801909 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801920:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801923:	eb b1                	jmp    8018d6 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801925:	49 89 dc             	mov    %rbx,%r12
+  801928:	eb ac                	jmp    8018d6 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80192a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80192d:	85 c9                	test   %ecx,%ecx
+  80192f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801934:	0f 49 c1             	cmovns %ecx,%eax
+  801937:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80193a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80193d:	e9 33 ff ff ff       	jmp    801875 <vprintfmt+0x80>
+            lflag++;
+  801942:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801945:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801948:	e9 28 ff ff ff       	jmp    801875 <vprintfmt+0x80>
+            lflag--;
+  80194d:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801950:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801953:	e9 1d ff ff ff       	jmp    801875 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801958:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80195b:	83 f8 2f             	cmp    $0x2f,%eax
+  80195e:	77 19                	ja     801979 <vprintfmt+0x184>
+  801960:	89 c2                	mov    %eax,%edx
+  801962:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801966:	83 c0 08             	add    $0x8,%eax
+  801969:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80196c:	8b 3a                	mov    (%rdx),%edi
+  80196e:	4c 89 ee             	mov    %r13,%rsi
+  801971:	41 ff d6             	call   *%r14
+            break;
+  801974:	e9 bc fe ff ff       	jmp    801835 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801979:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80197d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801981:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801985:	eb e5                	jmp    80196c <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801987:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80198a:	83 f8 2f             	cmp    $0x2f,%eax
+  80198d:	77 5a                	ja     8019e9 <vprintfmt+0x1f4>
+  80198f:	89 c2                	mov    %eax,%edx
+  801991:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801995:	83 c0 08             	add    $0x8,%eax
+  801998:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80199b:	8b 02                	mov    (%rdx),%eax
+  80199d:	89 c1                	mov    %eax,%ecx
+  80199f:	f7 d9                	neg    %ecx
+  8019a1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8019a4:	83 f9 13             	cmp    $0x13,%ecx
+  8019a7:	7f 4e                	jg     8019f7 <vprintfmt+0x202>
+  8019a9:	48 63 c1             	movslq %ecx,%rax
+  8019ac:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8019b3:	00 00 00 
+  8019b6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019ba:	48 85 c0             	test   %rax,%rax
+  8019bd:	74 38                	je     8019f7 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019bf:	48 89 c1             	mov    %rax,%rcx
+  8019c2:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8019c9:	00 00 00 
+  8019cc:	4c 89 ee             	mov    %r13,%rsi
+  8019cf:	4c 89 f7             	mov    %r14,%rdi
+  8019d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d7:	49 b8 b8 17 80 00 00 	movabs $0x8017b8,%r8
+  8019de:	00 00 00 
+  8019e1:	41 ff d0             	call   *%r8
+  8019e4:	e9 4c fe ff ff       	jmp    801835 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019f5:	eb a4                	jmp    80199b <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019f7:	48 ba 5a 5c 80 00 00 	movabs $0x805c5a,%rdx
+  8019fe:	00 00 00 
+  801a01:	4c 89 ee             	mov    %r13,%rsi
+  801a04:	4c 89 f7             	mov    %r14,%rdi
+  801a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0c:	49 b8 b8 17 80 00 00 	movabs $0x8017b8,%r8
+  801a13:	00 00 00 
+  801a16:	41 ff d0             	call   *%r8
+  801a19:	e9 17 fe ff ff       	jmp    801835 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a21:	83 f8 2f             	cmp    $0x2f,%eax
+  801a24:	77 6c                	ja     801a92 <vprintfmt+0x29d>
+  801a26:	89 c2                	mov    %eax,%edx
+  801a28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a2c:	83 c0 08             	add    $0x8,%eax
+  801a2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a32:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a35:	48 85 f6             	test   %rsi,%rsi
+  801a38:	48 b8 53 5c 80 00 00 	movabs $0x805c53,%rax
+  801a3f:	00 00 00 
+  801a42:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a46:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a4a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a4e:	7e 06                	jle    801a56 <vprintfmt+0x261>
+  801a50:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a54:	75 4a                	jne    801aa0 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a56:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a5a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a5e:	0f b6 00             	movzbl (%rax),%eax
+  801a61:	84 c0                	test   %al,%al
+  801a63:	0f 85 9a 00 00 00    	jne    801b03 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a69:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a6c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	0f 8e bd fd ff ff    	jle    801835 <vprintfmt+0x40>
+  801a78:	4c 89 ee             	mov    %r13,%rsi
+  801a7b:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a80:	41 ff d6             	call   *%r14
+  801a83:	41 83 ec 01          	sub    $0x1,%r12d
+  801a87:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a8b:	75 eb                	jne    801a78 <vprintfmt+0x283>
+  801a8d:	e9 a3 fd ff ff       	jmp    801835 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a9e:	eb 92                	jmp    801a32 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801aa0:	49 63 f7             	movslq %r15d,%rsi
+  801aa3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801aa7:	48 b8 b9 1f 80 00 00 	movabs $0x801fb9,%rax
+  801aae:	00 00 00 
+  801ab1:	ff d0                	call   *%rax
+  801ab3:	48 89 c2             	mov    %rax,%rdx
+  801ab6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801abb:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801abe:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	7e 91                	jle    801a56 <vprintfmt+0x261>
+  801ac5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801aca:	4c 89 ee             	mov    %r13,%rsi
+  801acd:	44 89 e7             	mov    %r12d,%edi
+  801ad0:	41 ff d6             	call   *%r14
+  801ad3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ada:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801add:	75 eb                	jne    801aca <vprintfmt+0x2d5>
+  801adf:	e9 72 ff ff ff       	jmp    801a56 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ae4:	0f b6 f8             	movzbl %al,%edi
+  801ae7:	4c 89 ee             	mov    %r13,%rsi
+  801aea:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801aed:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801af1:	49 83 c4 01          	add    $0x1,%r12
+  801af5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801afb:	84 c0                	test   %al,%al
+  801afd:	0f 84 66 ff ff ff    	je     801a69 <vprintfmt+0x274>
+  801b03:	45 85 ff             	test   %r15d,%r15d
+  801b06:	78 0a                	js     801b12 <vprintfmt+0x31d>
+  801b08:	41 83 ef 01          	sub    $0x1,%r15d
+  801b0c:	0f 88 57 ff ff ff    	js     801a69 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b12:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b16:	74 cc                	je     801ae4 <vprintfmt+0x2ef>
+  801b18:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b1b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b20:	80 fa 5e             	cmp    $0x5e,%dl
+  801b23:	77 c2                	ja     801ae7 <vprintfmt+0x2f2>
+  801b25:	eb bd                	jmp    801ae4 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b27:	40 84 f6             	test   %sil,%sil
+  801b2a:	75 26                	jne    801b52 <vprintfmt+0x35d>
+    switch (lflag) {
+  801b2c:	85 d2                	test   %edx,%edx
+  801b2e:	74 59                	je     801b89 <vprintfmt+0x394>
+  801b30:	83 fa 01             	cmp    $0x1,%edx
+  801b33:	74 7b                	je     801bb0 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b38:	83 f8 2f             	cmp    $0x2f,%eax
+  801b3b:	0f 87 96 00 00 00    	ja     801bd7 <vprintfmt+0x3e2>
+  801b41:	89 c2                	mov    %eax,%edx
+  801b43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b47:	83 c0 08             	add    $0x8,%eax
+  801b4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b4d:	4c 8b 22             	mov    (%rdx),%r12
+  801b50:	eb 17                	jmp    801b69 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b55:	83 f8 2f             	cmp    $0x2f,%eax
+  801b58:	77 21                	ja     801b7b <vprintfmt+0x386>
+  801b5a:	89 c2                	mov    %eax,%edx
+  801b5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b60:	83 c0 08             	add    $0x8,%eax
+  801b63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b66:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b69:	4d 85 e4             	test   %r12,%r12
+  801b6c:	78 7a                	js     801be8 <vprintfmt+0x3f3>
+            num = i;
+  801b6e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b71:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b76:	e9 56 02 00 00       	jmp    801dd1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b87:	eb dd                	jmp    801b66 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  801b8f:	77 11                	ja     801ba2 <vprintfmt+0x3ad>
+  801b91:	89 c2                	mov    %eax,%edx
+  801b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b97:	83 c0 08             	add    $0x8,%eax
+  801b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b9d:	4c 63 22             	movslq (%rdx),%r12
+  801ba0:	eb c7                	jmp    801b69 <vprintfmt+0x374>
+  801ba2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801baa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bae:	eb ed                	jmp    801b9d <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bb0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bb3:	83 f8 2f             	cmp    $0x2f,%eax
+  801bb6:	77 11                	ja     801bc9 <vprintfmt+0x3d4>
+  801bb8:	89 c2                	mov    %eax,%edx
+  801bba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bbe:	83 c0 08             	add    $0x8,%eax
+  801bc1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bc4:	4c 8b 22             	mov    (%rdx),%r12
+  801bc7:	eb a0                	jmp    801b69 <vprintfmt+0x374>
+  801bc9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bcd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd5:	eb ed                	jmp    801bc4 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bdb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be3:	e9 65 ff ff ff       	jmp    801b4d <vprintfmt+0x358>
+                putch('-', put_arg);
+  801be8:	4c 89 ee             	mov    %r13,%rsi
+  801beb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bf0:	41 ff d6             	call   *%r14
+                i = -i;
+  801bf3:	49 f7 dc             	neg    %r12
+  801bf6:	e9 73 ff ff ff       	jmp    801b6e <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bfb:	40 84 f6             	test   %sil,%sil
+  801bfe:	75 2e                	jne    801c2e <vprintfmt+0x439>
+    switch (lflag) {
+  801c00:	85 d2                	test   %edx,%edx
+  801c02:	7f 59                	jg     801c5d <vprintfmt+0x468>
+  801c04:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c07:	7d 7a                	jge    801c83 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c0c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c0f:	0f 87 aa 00 00 00    	ja     801cbf <vprintfmt+0x4ca>
+  801c15:	89 c2                	mov    %eax,%edx
+  801c17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c1b:	83 c0 08             	add    $0x8,%eax
+  801c1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c21:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c24:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c29:	e9 a3 01 00 00       	jmp    801dd1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c31:	83 f8 2f             	cmp    $0x2f,%eax
+  801c34:	77 19                	ja     801c4f <vprintfmt+0x45a>
+  801c36:	89 c2                	mov    %eax,%edx
+  801c38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c3c:	83 c0 08             	add    $0x8,%eax
+  801c3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c42:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c45:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c4a:	e9 82 01 00 00       	jmp    801dd1 <vprintfmt+0x5dc>
+  801c4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c5b:	eb e5                	jmp    801c42 <vprintfmt+0x44d>
+    switch (lflag) {
+  801c5d:	83 fa 01             	cmp    $0x1,%edx
+  801c60:	75 a7                	jne    801c09 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c65:	83 f8 2f             	cmp    $0x2f,%eax
+  801c68:	77 47                	ja     801cb1 <vprintfmt+0x4bc>
+  801c6a:	89 c2                	mov    %eax,%edx
+  801c6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c70:	83 c0 08             	add    $0x8,%eax
+  801c73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c76:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c79:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c7e:	e9 4e 01 00 00       	jmp    801dd1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c86:	83 f8 2f             	cmp    $0x2f,%eax
+  801c89:	77 18                	ja     801ca3 <vprintfmt+0x4ae>
+  801c8b:	89 c2                	mov    %eax,%edx
+  801c8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c91:	83 c0 08             	add    $0x8,%eax
+  801c94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c97:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c99:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c9e:	e9 2e 01 00 00       	jmp    801dd1 <vprintfmt+0x5dc>
+  801ca3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801caf:	eb e6                	jmp    801c97 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbd:	eb b7                	jmp    801c76 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ccb:	e9 51 ff ff ff       	jmp    801c21 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801cd0:	40 84 f6             	test   %sil,%sil
+  801cd3:	75 2e                	jne    801d03 <vprintfmt+0x50e>
+    switch (lflag) {
+  801cd5:	85 d2                	test   %edx,%edx
+  801cd7:	7f 59                	jg     801d32 <vprintfmt+0x53d>
+  801cd9:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cdc:	7d 77                	jge    801d55 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ce1:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce4:	0f 87 a4 00 00 00    	ja     801d8e <vprintfmt+0x599>
+  801cea:	89 c2                	mov    %eax,%edx
+  801cec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf0:	83 c0 08             	add    $0x8,%eax
+  801cf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cf9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cfe:	e9 ce 00 00 00       	jmp    801dd1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d06:	83 f8 2f             	cmp    $0x2f,%eax
+  801d09:	77 19                	ja     801d24 <vprintfmt+0x52f>
+  801d0b:	89 c2                	mov    %eax,%edx
+  801d0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d11:	83 c0 08             	add    $0x8,%eax
+  801d14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d17:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d1a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d1f:	e9 ad 00 00 00       	jmp    801dd1 <vprintfmt+0x5dc>
+  801d24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d30:	eb e5                	jmp    801d17 <vprintfmt+0x522>
+    switch (lflag) {
+  801d32:	83 fa 01             	cmp    $0x1,%edx
+  801d35:	75 a7                	jne    801cde <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d3a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3d:	77 41                	ja     801d80 <vprintfmt+0x58b>
+  801d3f:	89 c2                	mov    %eax,%edx
+  801d41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d45:	83 c0 08             	add    $0x8,%eax
+  801d48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d4b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d4e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d53:	eb 7c                	jmp    801dd1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d58:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5b:	77 15                	ja     801d72 <vprintfmt+0x57d>
+  801d5d:	89 c2                	mov    %eax,%edx
+  801d5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d63:	83 c0 08             	add    $0x8,%eax
+  801d66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d69:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d6b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d70:	eb 5f                	jmp    801dd1 <vprintfmt+0x5dc>
+  801d72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7e:	eb e9                	jmp    801d69 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8c:	eb bd                	jmp    801d4b <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9a:	e9 57 ff ff ff       	jmp    801cf6 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d9f:	4c 89 ee             	mov    %r13,%rsi
+  801da2:	bf 30 00 00 00       	mov    $0x30,%edi
+  801da7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801daa:	4c 89 ee             	mov    %r13,%rsi
+  801dad:	bf 78 00 00 00       	mov    $0x78,%edi
+  801db2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801db5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db8:	83 f8 2f             	cmp    $0x2f,%eax
+  801dbb:	77 47                	ja     801e04 <vprintfmt+0x60f>
+  801dbd:	89 c2                	mov    %eax,%edx
+  801dbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc3:	83 c0 08             	add    $0x8,%eax
+  801dc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dcc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dd1:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dd9:	0f 94 c0             	sete   %al
+  801ddc:	0f b6 c0             	movzbl %al,%eax
+  801ddf:	50                   	push   %rax
+  801de0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801de5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801de9:	4c 89 ee             	mov    %r13,%rsi
+  801dec:	4c 89 f7             	mov    %r14,%rdi
+  801def:	48 b8 ea 16 80 00 00 	movabs $0x8016ea,%rax
+  801df6:	00 00 00 
+  801df9:	ff d0                	call   *%rax
+            break;
+  801dfb:	48 83 c4 10          	add    $0x10,%rsp
+  801dff:	e9 31 fa ff ff       	jmp    801835 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e10:	eb b7                	jmp    801dc9 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e12:	40 84 f6             	test   %sil,%sil
+  801e15:	75 2b                	jne    801e42 <vprintfmt+0x64d>
+    switch (lflag) {
+  801e17:	85 d2                	test   %edx,%edx
+  801e19:	7f 56                	jg     801e71 <vprintfmt+0x67c>
+  801e1b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e1e:	7d 77                	jge    801e97 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e23:	83 f8 2f             	cmp    $0x2f,%eax
+  801e26:	0f 87 a7 00 00 00    	ja     801ed3 <vprintfmt+0x6de>
+  801e2c:	89 c2                	mov    %eax,%edx
+  801e2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e32:	83 c0 08             	add    $0x8,%eax
+  801e35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e38:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e3b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e40:	eb 8f                	jmp    801dd1 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e45:	83 f8 2f             	cmp    $0x2f,%eax
+  801e48:	77 19                	ja     801e63 <vprintfmt+0x66e>
+  801e4a:	89 c2                	mov    %eax,%edx
+  801e4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e50:	83 c0 08             	add    $0x8,%eax
+  801e53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e56:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e59:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e5e:	e9 6e ff ff ff       	jmp    801dd1 <vprintfmt+0x5dc>
+  801e63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e6f:	eb e5                	jmp    801e56 <vprintfmt+0x661>
+    switch (lflag) {
+  801e71:	83 fa 01             	cmp    $0x1,%edx
+  801e74:	75 aa                	jne    801e20 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e79:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7c:	77 47                	ja     801ec5 <vprintfmt+0x6d0>
+  801e7e:	89 c2                	mov    %eax,%edx
+  801e80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e84:	83 c0 08             	add    $0x8,%eax
+  801e87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e92:	e9 3a ff ff ff       	jmp    801dd1 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9d:	77 18                	ja     801eb7 <vprintfmt+0x6c2>
+  801e9f:	89 c2                	mov    %eax,%edx
+  801ea1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea5:	83 c0 08             	add    $0x8,%eax
+  801ea8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eab:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ead:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801eb2:	e9 1a ff ff ff       	jmp    801dd1 <vprintfmt+0x5dc>
+  801eb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ebb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec3:	eb e6                	jmp    801eab <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ec5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ecd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed1:	eb b7                	jmp    801e8a <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ed3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801edb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801edf:	e9 54 ff ff ff       	jmp    801e38 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ee4:	4c 89 ee             	mov    %r13,%rsi
+  801ee7:	bf 25 00 00 00       	mov    $0x25,%edi
+  801eec:	41 ff d6             	call   *%r14
+            break;
+  801eef:	e9 41 f9 ff ff       	jmp    801835 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ef4:	4c 89 ee             	mov    %r13,%rsi
+  801ef7:	bf 25 00 00 00       	mov    $0x25,%edi
+  801efc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801eff:	48 83 eb 01          	sub    $0x1,%rbx
+  801f03:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f07:	75 f6                	jne    801eff <vprintfmt+0x70a>
+  801f09:	e9 27 f9 ff ff       	jmp    801835 <vprintfmt+0x40>
+
+0000000000801f0e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+  801f12:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f16:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f1a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f1f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f23:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f2a:	48 85 ff             	test   %rdi,%rdi
+  801f2d:	74 2b                	je     801f5a <vsnprintf+0x4c>
+  801f2f:	48 85 f6             	test   %rsi,%rsi
+  801f32:	74 26                	je     801f5a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f34:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f38:	48 bf a0 17 80 00 00 	movabs $0x8017a0,%rdi
+  801f3f:	00 00 00 
+  801f42:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  801f49:	00 00 00 
+  801f4c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f52:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f55:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f58:	c9                   	leave
+  801f59:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5f:	eb f7                	jmp    801f58 <vsnprintf+0x4a>
+
+0000000000801f61 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f61:	55                   	push   %rbp
+  801f62:	48 89 e5             	mov    %rsp,%rbp
+  801f65:	48 83 ec 50          	sub    $0x50,%rsp
+  801f69:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f6d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f71:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f75:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f7c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f84:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f88:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f8c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f90:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f9c:	c9                   	leave
+  801f9d:	c3                   	ret
+
+0000000000801f9e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f9e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801fa1:	74 10                	je     801fb3 <strlen+0x15>
+    size_t n = 0;
+  801fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fa8:	48 83 c0 01          	add    $0x1,%rax
+  801fac:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fb0:	75 f6                	jne    801fa8 <strlen+0xa>
+  801fb2:	c3                   	ret
+    size_t n = 0;
+  801fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fb8:	c3                   	ret
+
+0000000000801fb9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fb9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fc1:	48 85 f6             	test   %rsi,%rsi
+  801fc4:	74 11                	je     801fd7 <strnlen+0x1e>
+  801fc6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fca:	74 0c                	je     801fd8 <strnlen+0x1f>
+  801fcc:	48 83 c2 01          	add    $0x1,%rdx
+  801fd0:	48 39 d0             	cmp    %rdx,%rax
+  801fd3:	75 f1                	jne    801fc6 <strnlen+0xd>
+  801fd5:	eb 04                	jmp    801fdb <strnlen+0x22>
+  801fd7:	c3                   	ret
+  801fd8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fdb:	c3                   	ret
+
+0000000000801fdc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fdc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fe8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801feb:	48 83 c2 01          	add    $0x1,%rdx
+  801fef:	84 c9                	test   %cl,%cl
+  801ff1:	75 f1                	jne    801fe4 <strcpy+0x8>
+        ;
+    return res;
+}
+  801ff3:	c3                   	ret
+
+0000000000801ff4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801ff4:	55                   	push   %rbp
+  801ff5:	48 89 e5             	mov    %rsp,%rbp
+  801ff8:	41 54                	push   %r12
+  801ffa:	53                   	push   %rbx
+  801ffb:	48 89 fb             	mov    %rdi,%rbx
+  801ffe:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802001:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  802008:	00 00 00 
+  80200b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80200d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802011:	4c 89 e6             	mov    %r12,%rsi
+  802014:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+    return dst;
+}
+  802020:	48 89 d8             	mov    %rbx,%rax
+  802023:	5b                   	pop    %rbx
+  802024:	41 5c                	pop    %r12
+  802026:	5d                   	pop    %rbp
+  802027:	c3                   	ret
+
+0000000000802028 <toupper>:
+
+int
+toupper(int ch) {
+  802028:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80202a:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80202d:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802030:	83 f9 1a             	cmp    $0x1a,%ecx
+  802033:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802036:	c3                   	ret
+
+0000000000802037 <tolower>:
+
+int
+tolower(int ch) {
+  802037:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802039:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80203c:	8d 57 20             	lea    0x20(%rdi),%edx
+  80203f:	83 f9 1a             	cmp    $0x1a,%ecx
+  802042:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802045:	c3                   	ret
+
+0000000000802046 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802046:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802049:	48 85 d2             	test   %rdx,%rdx
+  80204c:	74 1f                	je     80206d <strncpy+0x27>
+  80204e:	48 01 fa             	add    %rdi,%rdx
+  802051:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802054:	48 83 c1 01          	add    $0x1,%rcx
+  802058:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80205c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802060:	41 80 f8 01          	cmp    $0x1,%r8b
+  802064:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802068:	48 39 ca             	cmp    %rcx,%rdx
+  80206b:	75 e7                	jne    802054 <strncpy+0xe>
+    }
+    return ret;
+}
+  80206d:	c3                   	ret
+
+000000000080206e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80206e:	48 89 f8             	mov    %rdi,%rax
+  802071:	48 85 d2             	test   %rdx,%rdx
+  802074:	74 24                	je     80209a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802076:	48 83 ea 01          	sub    $0x1,%rdx
+  80207a:	74 1b                	je     802097 <strlcpy+0x29>
+  80207c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802080:	0f b6 16             	movzbl (%rsi),%edx
+  802083:	84 d2                	test   %dl,%dl
+  802085:	74 10                	je     802097 <strlcpy+0x29>
+            *dst++ = *src++;
+  802087:	48 83 c6 01          	add    $0x1,%rsi
+  80208b:	48 83 c0 01          	add    $0x1,%rax
+  80208f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802092:	48 39 c8             	cmp    %rcx,%rax
+  802095:	75 e9                	jne    802080 <strlcpy+0x12>
+        *dst = '\0';
+  802097:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80209a:	48 29 f8             	sub    %rdi,%rax
+}
+  80209d:	c3                   	ret
+
+000000000080209e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80209e:	0f b6 07             	movzbl (%rdi),%eax
+  8020a1:	84 c0                	test   %al,%al
+  8020a3:	74 13                	je     8020b8 <strcmp+0x1a>
+  8020a5:	38 06                	cmp    %al,(%rsi)
+  8020a7:	75 0f                	jne    8020b8 <strcmp+0x1a>
+  8020a9:	48 83 c7 01          	add    $0x1,%rdi
+  8020ad:	48 83 c6 01          	add    $0x1,%rsi
+  8020b1:	0f b6 07             	movzbl (%rdi),%eax
+  8020b4:	84 c0                	test   %al,%al
+  8020b6:	75 ed                	jne    8020a5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020b8:	0f b6 c0             	movzbl %al,%eax
+  8020bb:	0f b6 16             	movzbl (%rsi),%edx
+  8020be:	29 d0                	sub    %edx,%eax
+}
+  8020c0:	c3                   	ret
+
+00000000008020c1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020c1:	48 85 d2             	test   %rdx,%rdx
+  8020c4:	74 1f                	je     8020e5 <strncmp+0x24>
+  8020c6:	0f b6 07             	movzbl (%rdi),%eax
+  8020c9:	84 c0                	test   %al,%al
+  8020cb:	74 1e                	je     8020eb <strncmp+0x2a>
+  8020cd:	3a 06                	cmp    (%rsi),%al
+  8020cf:	75 1a                	jne    8020eb <strncmp+0x2a>
+  8020d1:	48 83 c7 01          	add    $0x1,%rdi
+  8020d5:	48 83 c6 01          	add    $0x1,%rsi
+  8020d9:	48 83 ea 01          	sub    $0x1,%rdx
+  8020dd:	75 e7                	jne    8020c6 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e4:	c3                   	ret
+  8020e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ea:	c3                   	ret
+  8020eb:	48 85 d2             	test   %rdx,%rdx
+  8020ee:	74 09                	je     8020f9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020f0:	0f b6 07             	movzbl (%rdi),%eax
+  8020f3:	0f b6 16             	movzbl (%rsi),%edx
+  8020f6:	29 d0                	sub    %edx,%eax
+  8020f8:	c3                   	ret
+    if (!n) return 0;
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020fe:	c3                   	ret
+
+00000000008020ff <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020ff:	0f b6 17             	movzbl (%rdi),%edx
+  802102:	84 d2                	test   %dl,%dl
+  802104:	74 18                	je     80211e <strchr+0x1f>
+        if (*str == c) {
+  802106:	0f be d2             	movsbl %dl,%edx
+  802109:	39 f2                	cmp    %esi,%edx
+  80210b:	74 17                	je     802124 <strchr+0x25>
+    for (; *str; str++) {
+  80210d:	48 83 c7 01          	add    $0x1,%rdi
+  802111:	0f b6 17             	movzbl (%rdi),%edx
+  802114:	84 d2                	test   %dl,%dl
+  802116:	75 ee                	jne    802106 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211d:	c3                   	ret
+  80211e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802123:	c3                   	ret
+  802124:	48 89 f8             	mov    %rdi,%rax
+}
+  802127:	c3                   	ret
+
+0000000000802128 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802128:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80212b:	0f b6 17             	movzbl (%rdi),%edx
+  80212e:	84 d2                	test   %dl,%dl
+  802130:	74 13                	je     802145 <strfind+0x1d>
+  802132:	0f be d2             	movsbl %dl,%edx
+  802135:	39 f2                	cmp    %esi,%edx
+  802137:	74 0b                	je     802144 <strfind+0x1c>
+  802139:	48 83 c0 01          	add    $0x1,%rax
+  80213d:	0f b6 10             	movzbl (%rax),%edx
+  802140:	84 d2                	test   %dl,%dl
+  802142:	75 ee                	jne    802132 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802144:	c3                   	ret
+  802145:	c3                   	ret
+
+0000000000802146 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802146:	48 39 f7             	cmp    %rsi,%rdi
+  802149:	74 65                	je     8021b0 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80214b:	55                   	push   %rbp
+  80214c:	48 89 e5             	mov    %rsp,%rbp
+  80214f:	41 57                	push   %r15
+  802151:	41 56                	push   %r14
+  802153:	41 55                	push   %r13
+  802155:	41 54                	push   %r12
+  802157:	53                   	push   %rbx
+  802158:	48 83 ec 18          	sub    $0x18,%rsp
+  80215c:	48 89 fb             	mov    %rdi,%rbx
+  80215f:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802162:	49 bf 37 20 80 00 00 	movabs $0x802037,%r15
+  802169:	00 00 00 
+  80216c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802170:	41 0f b6 fd          	movzbl %r13b,%edi
+  802174:	41 ff d7             	call   *%r15
+  802177:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80217a:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80217f:	41 0f b6 fe          	movzbl %r14b,%edi
+  802183:	41 ff d7             	call   *%r15
+  802186:	89 c2                	mov    %eax,%edx
+  802188:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80218b:	29 d0                	sub    %edx,%eax
+  80218d:	75 12                	jne    8021a1 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80218f:	48 83 c3 01          	add    $0x1,%rbx
+  802193:	45 84 ed             	test   %r13b,%r13b
+  802196:	74 09                	je     8021a1 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802198:	49 83 c4 01          	add    $0x1,%r12
+  80219c:	45 84 f6             	test   %r14b,%r14b
+  80219f:	75 cb                	jne    80216c <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8021a1:	48 83 c4 18          	add    $0x18,%rsp
+  8021a5:	5b                   	pop    %rbx
+  8021a6:	41 5c                	pop    %r12
+  8021a8:	41 5d                	pop    %r13
+  8021aa:	41 5e                	pop    %r14
+  8021ac:	41 5f                	pop    %r15
+  8021ae:	5d                   	pop    %rbp
+  8021af:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b5:	c3                   	ret
+
+00000000008021b6 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021b6:	48 39 f7             	cmp    %rsi,%rdi
+  8021b9:	74 7d                	je     802238 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021bb:	55                   	push   %rbp
+  8021bc:	48 89 e5             	mov    %rsp,%rbp
+  8021bf:	41 57                	push   %r15
+  8021c1:	41 56                	push   %r14
+  8021c3:	41 55                	push   %r13
+  8021c5:	41 54                	push   %r12
+  8021c7:	53                   	push   %rbx
+  8021c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8021cc:	48 89 fb             	mov    %rdi,%rbx
+  8021cf:	49 89 f4             	mov    %rsi,%r12
+  8021d2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021da:	49 bf 37 20 80 00 00 	movabs $0x802037,%r15
+  8021e1:	00 00 00 
+    while (n--) {
+  8021e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e8:	48 39 c3             	cmp    %rax,%rbx
+  8021eb:	74 37                	je     802224 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021ed:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021f1:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021f5:	41 ff d7             	call   *%r15
+  8021f8:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021fb:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802200:	41 0f b6 fe          	movzbl %r14b,%edi
+  802204:	41 ff d7             	call   *%r15
+  802207:	89 c2                	mov    %eax,%edx
+  802209:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80220c:	29 d0                	sub    %edx,%eax
+  80220e:	75 19                	jne    802229 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802210:	48 83 c3 01          	add    $0x1,%rbx
+  802214:	45 84 ed             	test   %r13b,%r13b
+  802217:	74 10                	je     802229 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802219:	49 83 c4 01          	add    $0x1,%r12
+  80221d:	45 84 f6             	test   %r14b,%r14b
+  802220:	75 c2                	jne    8021e4 <strncasecmp+0x2e>
+  802222:	eb 05                	jmp    802229 <strncasecmp+0x73>
+  802224:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802229:	48 83 c4 18          	add    $0x18,%rsp
+  80222d:	5b                   	pop    %rbx
+  80222e:	41 5c                	pop    %r12
+  802230:	41 5d                	pop    %r13
+  802232:	41 5e                	pop    %r14
+  802234:	41 5f                	pop    %r15
+  802236:	5d                   	pop    %rbp
+  802237:	c3                   	ret
+    if (p1 == p2) return 0;
+  802238:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223d:	c3                   	ret
+
+000000000080223e <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80223e:	83 e7 df             	and    $0xffffffdf,%edi
+  802241:	83 ef 41             	sub    $0x41,%edi
+  802244:	83 ff 19             	cmp    $0x19,%edi
+  802247:	0f 96 c0             	setbe  %al
+}
+  80224a:	c3                   	ret
+
+000000000080224b <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80224b:	83 ff 20             	cmp    $0x20,%edi
+  80224e:	0f 94 c0             	sete   %al
+  802251:	83 ff 09             	cmp    $0x9,%edi
+  802254:	0f 94 c2             	sete   %dl
+  802257:	09 d0                	or     %edx,%eax
+}
+  802259:	c3                   	ret
+
+000000000080225a <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80225a:	55                   	push   %rbp
+  80225b:	48 89 e5             	mov    %rsp,%rbp
+  80225e:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802260:	48 bf 3f 61 80 00 00 	movabs $0x80613f,%rdi
+  802267:	00 00 00 
+  80226a:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802271:	00 00 00 
+  802274:	ff d0                	call   *%rax
+  802276:	48 85 c0             	test   %rax,%rax
+  802279:	0f 95 c0             	setne  %al
+}
+  80227c:	5d                   	pop    %rbp
+  80227d:	c3                   	ret
+
+000000000080227e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80227e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802281:	48 89 f8             	mov    %rdi,%rax
+  802284:	48 f7 d8             	neg    %rax
+  802287:	83 e0 07             	and    $0x7,%eax
+  80228a:	49 89 d1             	mov    %rdx,%r9
+  80228d:	49 29 c1             	sub    %rax,%r9
+  802290:	78 36                	js     8022c8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802292:	40 0f b6 c6          	movzbl %sil,%eax
+  802296:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80229d:	01 01 01 
+  8022a0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8022a4:	40 f6 c7 07          	test   $0x7,%dil
+  8022a8:	75 38                	jne    8022e2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022aa:	4c 89 c9             	mov    %r9,%rcx
+  8022ad:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022b1:	74 0c                	je     8022bf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022b3:	fc                   	cld
+  8022b4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022b7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022bb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022bf:	4d 85 c9             	test   %r9,%r9
+  8022c2:	75 45                	jne    802309 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022c4:	4c 89 c0             	mov    %r8,%rax
+  8022c7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022c8:	48 85 d2             	test   %rdx,%rdx
+  8022cb:	74 f7                	je     8022c4 <memset+0x46>
+  8022cd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022d0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022d3:	48 83 c0 01          	add    $0x1,%rax
+  8022d7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022db:	48 39 c2             	cmp    %rax,%rdx
+  8022de:	75 f3                	jne    8022d3 <memset+0x55>
+  8022e0:	eb e2                	jmp    8022c4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022e2:	40 f6 c7 01          	test   $0x1,%dil
+  8022e6:	74 06                	je     8022ee <memset+0x70>
+  8022e8:	88 07                	mov    %al,(%rdi)
+  8022ea:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022ee:	40 f6 c7 02          	test   $0x2,%dil
+  8022f2:	74 07                	je     8022fb <memset+0x7d>
+  8022f4:	66 89 07             	mov    %ax,(%rdi)
+  8022f7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022fb:	40 f6 c7 04          	test   $0x4,%dil
+  8022ff:	74 a9                	je     8022aa <memset+0x2c>
+  802301:	89 07                	mov    %eax,(%rdi)
+  802303:	48 83 c7 04          	add    $0x4,%rdi
+  802307:	eb a1                	jmp    8022aa <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802309:	41 f6 c1 04          	test   $0x4,%r9b
+  80230d:	74 06                	je     802315 <memset+0x97>
+  80230f:	89 07                	mov    %eax,(%rdi)
+  802311:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802315:	41 f6 c1 02          	test   $0x2,%r9b
+  802319:	74 07                	je     802322 <memset+0xa4>
+  80231b:	66 89 07             	mov    %ax,(%rdi)
+  80231e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802322:	41 f6 c1 01          	test   $0x1,%r9b
+  802326:	74 9c                	je     8022c4 <memset+0x46>
+  802328:	88 07                	mov    %al,(%rdi)
+  80232a:	eb 98                	jmp    8022c4 <memset+0x46>
+
+000000000080232c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80232c:	48 89 f8             	mov    %rdi,%rax
+  80232f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802332:	48 39 fe             	cmp    %rdi,%rsi
+  802335:	73 3b                	jae    802372 <memmove+0x46>
+  802337:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80233b:	48 39 d7             	cmp    %rdx,%rdi
+  80233e:	73 32                	jae    802372 <memmove+0x46>
+        s += n;
+        d += n;
+  802340:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802344:	48 89 d6             	mov    %rdx,%rsi
+  802347:	48 09 fe             	or     %rdi,%rsi
+  80234a:	48 09 ce             	or     %rcx,%rsi
+  80234d:	40 f6 c6 07          	test   $0x7,%sil
+  802351:	75 12                	jne    802365 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802353:	48 83 ef 08          	sub    $0x8,%rdi
+  802357:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80235b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80235f:	fd                   	std
+  802360:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802363:	fc                   	cld
+  802364:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802365:	48 83 ef 01          	sub    $0x1,%rdi
+  802369:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80236d:	fd                   	std
+  80236e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802370:	eb f1                	jmp    802363 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802372:	48 89 f2             	mov    %rsi,%rdx
+  802375:	48 09 c2             	or     %rax,%rdx
+  802378:	48 09 ca             	or     %rcx,%rdx
+  80237b:	f6 c2 07             	test   $0x7,%dl
+  80237e:	75 0c                	jne    80238c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802380:	48 c1 e9 03          	shr    $0x3,%rcx
+  802384:	48 89 c7             	mov    %rax,%rdi
+  802387:	fc                   	cld
+  802388:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80238b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80238c:	48 89 c7             	mov    %rax,%rdi
+  80238f:	fc                   	cld
+  802390:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802392:	c3                   	ret
+
+0000000000802393 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802393:	55                   	push   %rbp
+  802394:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802397:	48 b8 2c 23 80 00 00 	movabs $0x80232c,%rax
+  80239e:	00 00 00 
+  8023a1:	ff d0                	call   *%rax
+}
+  8023a3:	5d                   	pop    %rbp
+  8023a4:	c3                   	ret
+
+00000000008023a5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023a5:	55                   	push   %rbp
+  8023a6:	48 89 e5             	mov    %rsp,%rbp
+  8023a9:	41 57                	push   %r15
+  8023ab:	41 56                	push   %r14
+  8023ad:	41 55                	push   %r13
+  8023af:	41 54                	push   %r12
+  8023b1:	53                   	push   %rbx
+  8023b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b6:	49 89 fe             	mov    %rdi,%r14
+  8023b9:	49 89 f7             	mov    %rsi,%r15
+  8023bc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023bf:	48 89 f7             	mov    %rsi,%rdi
+  8023c2:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+  8023ce:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023d1:	48 89 de             	mov    %rbx,%rsi
+  8023d4:	4c 89 f7             	mov    %r14,%rdi
+  8023d7:	48 b8 b9 1f 80 00 00 	movabs $0x801fb9,%rax
+  8023de:	00 00 00 
+  8023e1:	ff d0                	call   *%rax
+  8023e3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023e6:	48 39 c3             	cmp    %rax,%rbx
+  8023e9:	74 36                	je     802421 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023eb:	48 89 d8             	mov    %rbx,%rax
+  8023ee:	4c 29 e8             	sub    %r13,%rax
+  8023f1:	49 39 c4             	cmp    %rax,%r12
+  8023f4:	73 31                	jae    802427 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023f6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023fb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023ff:	4c 89 fe             	mov    %r15,%rsi
+  802402:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  802409:	00 00 00 
+  80240c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80240e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802412:	48 83 c4 08          	add    $0x8,%rsp
+  802416:	5b                   	pop    %rbx
+  802417:	41 5c                	pop    %r12
+  802419:	41 5d                	pop    %r13
+  80241b:	41 5e                	pop    %r14
+  80241d:	41 5f                	pop    %r15
+  80241f:	5d                   	pop    %rbp
+  802420:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802421:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802425:	eb eb                	jmp    802412 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802427:	48 83 eb 01          	sub    $0x1,%rbx
+  80242b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80242f:	48 89 da             	mov    %rbx,%rdx
+  802432:	4c 89 fe             	mov    %r15,%rsi
+  802435:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802441:	49 01 de             	add    %rbx,%r14
+  802444:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802449:	eb c3                	jmp    80240e <strlcat+0x69>
+
+000000000080244b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80244b:	48 85 d2             	test   %rdx,%rdx
+  80244e:	74 2d                	je     80247d <memcmp+0x32>
+  802450:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802455:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802459:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80245e:	44 38 c1             	cmp    %r8b,%cl
+  802461:	75 0f                	jne    802472 <memcmp+0x27>
+    while (n-- > 0) {
+  802463:	48 83 c0 01          	add    $0x1,%rax
+  802467:	48 39 c2             	cmp    %rax,%rdx
+  80246a:	75 e9                	jne    802455 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80246c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802471:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802472:	0f b6 c1             	movzbl %cl,%eax
+  802475:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802479:	44 29 c0             	sub    %r8d,%eax
+  80247c:	c3                   	ret
+    return 0;
+  80247d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802482:	c3                   	ret
+
+0000000000802483 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802483:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802487:	48 39 c7             	cmp    %rax,%rdi
+  80248a:	73 0f                	jae    80249b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80248c:	40 38 37             	cmp    %sil,(%rdi)
+  80248f:	74 0e                	je     80249f <memfind+0x1c>
+    for (; src < end; src++) {
+  802491:	48 83 c7 01          	add    $0x1,%rdi
+  802495:	48 39 f8             	cmp    %rdi,%rax
+  802498:	75 f2                	jne    80248c <memfind+0x9>
+  80249a:	c3                   	ret
+  80249b:	48 89 f8             	mov    %rdi,%rax
+  80249e:	c3                   	ret
+  80249f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8024a2:	c3                   	ret
+
+00000000008024a3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8024a3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024a6:	0f b6 37             	movzbl (%rdi),%esi
+  8024a9:	40 80 fe 20          	cmp    $0x20,%sil
+  8024ad:	74 06                	je     8024b5 <strtol+0x12>
+  8024af:	40 80 fe 09          	cmp    $0x9,%sil
+  8024b3:	75 13                	jne    8024c8 <strtol+0x25>
+  8024b5:	48 83 c7 01          	add    $0x1,%rdi
+  8024b9:	0f b6 37             	movzbl (%rdi),%esi
+  8024bc:	40 80 fe 20          	cmp    $0x20,%sil
+  8024c0:	74 f3                	je     8024b5 <strtol+0x12>
+  8024c2:	40 80 fe 09          	cmp    $0x9,%sil
+  8024c6:	74 ed                	je     8024b5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024c8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024cb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024ce:	3c 01                	cmp    $0x1,%al
+  8024d0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024d4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024da:	75 0f                	jne    8024eb <strtol+0x48>
+  8024dc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024df:	74 14                	je     8024f5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024e1:	85 d2                	test   %edx,%edx
+  8024e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024e8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024eb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024f0:	4c 63 ca             	movslq %edx,%r9
+  8024f3:	eb 36                	jmp    80252b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024f5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024f9:	74 0f                	je     80250a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024fb:	85 d2                	test   %edx,%edx
+  8024fd:	75 ec                	jne    8024eb <strtol+0x48>
+        s++;
+  8024ff:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802503:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802508:	eb e1                	jmp    8024eb <strtol+0x48>
+        s += 2;
+  80250a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80250e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802513:	eb d6                	jmp    8024eb <strtol+0x48>
+            dig -= '0';
+  802515:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802518:	44 0f b6 c1          	movzbl %cl,%r8d
+  80251c:	41 39 d0             	cmp    %edx,%r8d
+  80251f:	7d 21                	jge    802542 <strtol+0x9f>
+        val = val * base + dig;
+  802521:	49 0f af c1          	imul   %r9,%rax
+  802525:	0f b6 c9             	movzbl %cl,%ecx
+  802528:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80252b:	48 83 c7 01          	add    $0x1,%rdi
+  80252f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802533:	80 f9 39             	cmp    $0x39,%cl
+  802536:	76 dd                	jbe    802515 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802538:	80 f9 7b             	cmp    $0x7b,%cl
+  80253b:	77 05                	ja     802542 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80253d:	83 e9 57             	sub    $0x57,%ecx
+  802540:	eb d6                	jmp    802518 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802542:	4d 85 d2             	test   %r10,%r10
+  802545:	74 03                	je     80254a <strtol+0xa7>
+  802547:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80254a:	48 89 c2             	mov    %rax,%rdx
+  80254d:	48 f7 da             	neg    %rdx
+  802550:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802554:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802558:	c3                   	ret
+
+0000000000802559 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802559:	55                   	push   %rbp
+  80255a:	48 89 e5             	mov    %rsp,%rbp
+  80255d:	53                   	push   %rbx
+  80255e:	48 89 fa             	mov    %rdi,%rdx
+  802561:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802564:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80256e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802573:	be 00 00 00 00       	mov    $0x0,%esi
+  802578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80257e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802584:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802586:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80258a:	c9                   	leave
+  80258b:	c3                   	ret
+
+000000000080258c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80258c:	55                   	push   %rbp
+  80258d:	48 89 e5             	mov    %rsp,%rbp
+  802590:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802591:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8025af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025bb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025c1:	c9                   	leave
+  8025c2:	c3                   	ret
+
+00000000008025c3 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025c3:	55                   	push   %rbp
+  8025c4:	48 89 e5             	mov    %rsp,%rbp
+  8025c7:	53                   	push   %rbx
+  8025c8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025cb:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025df:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025f0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f6:	c9                   	leave
+  8025f7:	c3                   	ret
+
+00000000008025f8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025f8:	55                   	push   %rbp
+  8025f9:	48 89 e5             	mov    %rsp,%rbp
+  8025fc:	53                   	push   %rbx
+  8025fd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802601:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802604:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802609:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80260e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802613:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802618:	be 00 00 00 00       	mov    $0x0,%esi
+  80261d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802623:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802629:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80262b:	48 85 c0             	test   %rax,%rax
+  80262e:	7f 06                	jg     802636 <sys_env_destroy+0x3e>
+}
+  802630:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802634:	c9                   	leave
+  802635:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802636:	49 89 c0             	mov    %rax,%r8
+  802639:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80263e:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802645:	00 00 00 
+  802648:	be 27 00 00 00       	mov    $0x27,%esi
+  80264d:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802654:	00 00 00 
+  802657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265c:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802663:	00 00 00 
+  802666:	41 ff d1             	call   *%r9
+
+0000000000802669 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802669:	55                   	push   %rbp
+  80266a:	48 89 e5             	mov    %rsp,%rbp
+  80266d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80266e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802673:	ba 00 00 00 00       	mov    $0x0,%edx
+  802678:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80267d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802682:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802687:	be 00 00 00 00       	mov    $0x0,%esi
+  80268c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802692:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802698:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80269a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80269e:	c9                   	leave
+  80269f:	c3                   	ret
+
+00000000008026a0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8026a0:	55                   	push   %rbp
+  8026a1:	48 89 e5             	mov    %rsp,%rbp
+  8026a4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026be:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026cf:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+
+00000000008026d7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026d7:	55                   	push   %rbp
+  8026d8:	48 89 e5             	mov    %rsp,%rbp
+  8026db:	53                   	push   %rbx
+  8026dc:	48 89 fa             	mov    %rdi,%rdx
+  8026df:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026e2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026ee:	00 00 00 
+  8026f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802701:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802707:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80270d:	c9                   	leave
+  80270e:	c3                   	ret
+
+000000000080270f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80270f:	55                   	push   %rbp
+  802710:	48 89 e5             	mov    %rsp,%rbp
+  802713:	53                   	push   %rbx
+  802714:	49 89 f8             	mov    %rdi,%r8
+  802717:	48 89 d3             	mov    %rdx,%rbx
+  80271a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80271d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802722:	4c 89 c2             	mov    %r8,%rdx
+  802725:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802728:	be 00 00 00 00       	mov    $0x0,%esi
+  80272d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802733:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802739:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80273b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80273f:	c9                   	leave
+  802740:	c3                   	ret
+
+0000000000802741 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802741:	55                   	push   %rbp
+  802742:	48 89 e5             	mov    %rsp,%rbp
+  802745:	53                   	push   %rbx
+  802746:	48 83 ec 08          	sub    $0x8,%rsp
+  80274a:	89 f8                	mov    %edi,%eax
+  80274c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80274f:	48 63 f9             	movslq %ecx,%rdi
+  802752:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802755:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80275a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80275d:	be 00 00 00 00       	mov    $0x0,%esi
+  802762:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802768:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80276e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802770:	48 85 c0             	test   %rax,%rax
+  802773:	7f 06                	jg     80277b <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802775:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802779:	c9                   	leave
+  80277a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80277b:	49 89 c0             	mov    %rax,%r8
+  80277e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802783:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80278a:	00 00 00 
+  80278d:	be 27 00 00 00       	mov    $0x27,%esi
+  802792:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802799:	00 00 00 
+  80279c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a1:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  8027a8:	00 00 00 
+  8027ab:	41 ff d1             	call   *%r9
+
+00000000008027ae <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027ae:	55                   	push   %rbp
+  8027af:	48 89 e5             	mov    %rsp,%rbp
+  8027b2:	53                   	push   %rbx
+  8027b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b7:	89 f8                	mov    %edi,%eax
+  8027b9:	49 89 f2             	mov    %rsi,%r10
+  8027bc:	48 89 cf             	mov    %rcx,%rdi
+  8027bf:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027c2:	48 63 da             	movslq %edx,%rbx
+  8027c5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027cd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027d0:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027db:	48 85 c0             	test   %rax,%rax
+  8027de:	7f 06                	jg     8027e6 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027e6:	49 89 c0             	mov    %rax,%r8
+  8027e9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027ee:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8027f5:	00 00 00 
+  8027f8:	be 27 00 00 00       	mov    $0x27,%esi
+  8027fd:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802804:	00 00 00 
+  802807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280c:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802813:	00 00 00 
+  802816:	41 ff d1             	call   *%r9
+
+0000000000802819 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802819:	55                   	push   %rbp
+  80281a:	48 89 e5             	mov    %rsp,%rbp
+  80281d:	53                   	push   %rbx
+  80281e:	48 83 ec 08          	sub    $0x8,%rsp
+  802822:	48 89 f1             	mov    %rsi,%rcx
+  802825:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802828:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80282b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802830:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802835:	be 00 00 00 00       	mov    $0x0,%esi
+  80283a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802840:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802846:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802848:	48 85 c0             	test   %rax,%rax
+  80284b:	7f 06                	jg     802853 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80284d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802851:	c9                   	leave
+  802852:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802853:	49 89 c0             	mov    %rax,%r8
+  802856:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80285b:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802862:	00 00 00 
+  802865:	be 27 00 00 00       	mov    $0x27,%esi
+  80286a:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802871:	00 00 00 
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+  802879:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802880:	00 00 00 
+  802883:	41 ff d1             	call   *%r9
+
+0000000000802886 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802886:	55                   	push   %rbp
+  802887:	48 89 e5             	mov    %rsp,%rbp
+  80288a:	53                   	push   %rbx
+  80288b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80288f:	48 63 ce             	movslq %esi,%rcx
+  802892:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802895:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80289a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80289f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028b7:	48 85 c0             	test   %rax,%rax
+  8028ba:	7f 06                	jg     8028c2 <sys_env_set_status+0x3c>
+}
+  8028bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c0:	c9                   	leave
+  8028c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028c2:	49 89 c0             	mov    %rax,%r8
+  8028c5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028ca:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8028d1:	00 00 00 
+  8028d4:	be 27 00 00 00       	mov    $0x27,%esi
+  8028d9:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8028e0:	00 00 00 
+  8028e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e8:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  8028ef:	00 00 00 
+  8028f2:	41 ff d1             	call   *%r9
+
+00000000008028f5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028f5:	55                   	push   %rbp
+  8028f6:	48 89 e5             	mov    %rsp,%rbp
+  8028f9:	53                   	push   %rbx
+  8028fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fe:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802901:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802904:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802909:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802913:	be 00 00 00 00       	mov    $0x0,%esi
+  802918:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80291e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802924:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802926:	48 85 c0             	test   %rax,%rax
+  802929:	7f 06                	jg     802931 <sys_env_set_trapframe+0x3c>
+}
+  80292b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80292f:	c9                   	leave
+  802930:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802931:	49 89 c0             	mov    %rax,%r8
+  802934:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802939:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802940:	00 00 00 
+  802943:	be 27 00 00 00       	mov    $0x27,%esi
+  802948:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80294f:	00 00 00 
+  802952:	b8 00 00 00 00       	mov    $0x0,%eax
+  802957:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  80295e:	00 00 00 
+  802961:	41 ff d1             	call   *%r9
+
+0000000000802964 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802964:	55                   	push   %rbp
+  802965:	48 89 e5             	mov    %rsp,%rbp
+  802968:	53                   	push   %rbx
+  802969:	48 83 ec 08          	sub    $0x8,%rsp
+  80296d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802970:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802973:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802978:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80297d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802982:	be 00 00 00 00       	mov    $0x0,%esi
+  802987:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80298d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802993:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802995:	48 85 c0             	test   %rax,%rax
+  802998:	7f 06                	jg     8029a0 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80299a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029a0:	49 89 c0             	mov    %rax,%r8
+  8029a3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029a8:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8029af:	00 00 00 
+  8029b2:	be 27 00 00 00       	mov    $0x27,%esi
+  8029b7:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8029be:	00 00 00 
+  8029c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c6:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  8029cd:	00 00 00 
+  8029d0:	41 ff d1             	call   *%r9
+
+00000000008029d3 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029d3:	55                   	push   %rbp
+  8029d4:	48 89 e5             	mov    %rsp,%rbp
+  8029d7:	53                   	push   %rbx
+  8029d8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029dc:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029e0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029e3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a03:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a05:	48 85 c0             	test   %rax,%rax
+  802a08:	7f 06                	jg     802a10 <sys_env_set_reclaim+0x3d>
+}
+  802a0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a0e:	c9                   	leave
+  802a0f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a10:	49 89 c0             	mov    %rax,%r8
+  802a13:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a18:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a1f:	00 00 00 
+  802a22:	be 27 00 00 00       	mov    $0x27,%esi
+  802a27:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a2e:	00 00 00 
+  802a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a36:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802a3d:	00 00 00 
+  802a40:	41 ff d1             	call   *%r9
+
+0000000000802a43 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a43:	55                   	push   %rbp
+  802a44:	48 89 e5             	mov    %rsp,%rbp
+  802a47:	53                   	push   %rbx
+  802a48:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a4c:	48 63 ce             	movslq %esi,%rcx
+  802a4f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a52:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a5c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a61:	be 00 00 00 00       	mov    $0x0,%esi
+  802a66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a72:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a74:	48 85 c0             	test   %rax,%rax
+  802a77:	7f 06                	jg     802a7f <sys_env_set_nice+0x3c>
+}
+  802a79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a7d:	c9                   	leave
+  802a7e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a7f:	49 89 c0             	mov    %rax,%r8
+  802a82:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a87:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a8e:	00 00 00 
+  802a91:	be 27 00 00 00       	mov    $0x27,%esi
+  802a96:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a9d:	00 00 00 
+  802aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa5:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802aac:	00 00 00 
+  802aaf:	41 ff d1             	call   *%r9
+
+0000000000802ab2 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ab2:	55                   	push   %rbp
+  802ab3:	48 89 e5             	mov    %rsp,%rbp
+  802ab6:	53                   	push   %rbx
+  802ab7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aba:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802abf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ac4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ace:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ad9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802adf:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ae1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ae5:	c9                   	leave
+  802ae6:	c3                   	ret
+
+0000000000802ae7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ae7:	55                   	push   %rbp
+  802ae8:	48 89 e5             	mov    %rsp,%rbp
+  802aeb:	53                   	push   %rbx
+  802aec:	89 f8                	mov    %edi,%eax
+  802aee:	49 89 f1             	mov    %rsi,%r9
+  802af1:	48 89 d3             	mov    %rdx,%rbx
+  802af4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802af7:	49 63 f0             	movslq %r8d,%rsi
+  802afa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802afd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b02:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b11:	cd 30                	int    $0x30
+}
+  802b13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b17:	c9                   	leave
+  802b18:	c3                   	ret
+
+0000000000802b19 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b19:	55                   	push   %rbp
+  802b1a:	48 89 e5             	mov    %rsp,%rbp
+  802b1d:	53                   	push   %rbx
+  802b1e:	89 f8                	mov    %edi,%eax
+  802b20:	49 89 f1             	mov    %rsi,%r9
+  802b23:	48 89 d3             	mov    %rdx,%rbx
+  802b26:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b29:	49 63 f0             	movslq %r8d,%rsi
+  802b2c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b2f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b34:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b43:	cd 30                	int    $0x30
+}
+  802b45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+
+0000000000802b4b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b4b:	55                   	push   %rbp
+  802b4c:	48 89 e5             	mov    %rsp,%rbp
+  802b4f:	53                   	push   %rbx
+  802b50:	48 83 ec 08          	sub    $0x8,%rsp
+  802b54:	89 f8                	mov    %edi,%eax
+  802b56:	49 89 f2             	mov    %rsi,%r10
+  802b59:	48 89 d3             	mov    %rdx,%rbx
+  802b5c:	48 89 cf             	mov    %rcx,%rdi
+  802b5f:	44 89 c6             	mov    %r8d,%esi
+  802b62:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b65:	48 63 f6             	movslq %esi,%rsi
+  802b68:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b6b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b70:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b73:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b77:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b79:	48 85 c0             	test   %rax,%rax
+  802b7c:	7f 06                	jg     802b84 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b84:	49 89 c0             	mov    %rax,%r8
+  802b87:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b8c:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802b93:	00 00 00 
+  802b96:	be 27 00 00 00       	mov    $0x27,%esi
+  802b9b:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802ba2:	00 00 00 
+  802ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802baa:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802bb1:	00 00 00 
+  802bb4:	41 ff d1             	call   *%r9
+
+0000000000802bb7 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bb7:	55                   	push   %rbp
+  802bb8:	48 89 e5             	mov    %rsp,%rbp
+  802bbb:	53                   	push   %rbx
+  802bbc:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc0:	48 89 f1             	mov    %rsi,%rcx
+  802bc3:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bc6:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bca:	48 8b 1a             	mov    (%rdx),%rbx
+  802bcd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bd0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd5:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd9:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bdd:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802be1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be3:	48 85 c0             	test   %rax,%rax
+  802be6:	7f 06                	jg     802bee <sys_ipc_call_short+0x37>
+}
+  802be8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bec:	c9                   	leave
+  802bed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bee:	49 89 c0             	mov    %rax,%r8
+  802bf1:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bf6:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802bfd:	00 00 00 
+  802c00:	be 27 00 00 00       	mov    $0x27,%esi
+  802c05:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c0c:	00 00 00 
+  802c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c14:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802c1b:	00 00 00 
+  802c1e:	41 ff d1             	call   *%r9
+
+0000000000802c21 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c21:	55                   	push   %rbp
+  802c22:	48 89 e5             	mov    %rsp,%rbp
+  802c25:	53                   	push   %rbx
+  802c26:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2a:	89 f8                	mov    %edi,%eax
+  802c2c:	49 89 f2             	mov    %rsi,%r10
+  802c2f:	48 89 d3             	mov    %rdx,%rbx
+  802c32:	48 89 cf             	mov    %rcx,%rdi
+  802c35:	44 89 c6             	mov    %r8d,%esi
+  802c38:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c3b:	48 63 f6             	movslq %esi,%rsi
+  802c3e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c41:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c46:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c49:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c4d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c4f:	48 85 c0             	test   %rax,%rax
+  802c52:	7f 06                	jg     802c5a <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c58:	c9                   	leave
+  802c59:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5a:	49 89 c0             	mov    %rax,%r8
+  802c5d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c62:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802c69:	00 00 00 
+  802c6c:	be 27 00 00 00       	mov    $0x27,%esi
+  802c71:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c78:	00 00 00 
+  802c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c80:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802c87:	00 00 00 
+  802c8a:	41 ff d1             	call   *%r9
+
+0000000000802c8d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c8d:	55                   	push   %rbp
+  802c8e:	48 89 e5             	mov    %rsp,%rbp
+  802c91:	53                   	push   %rbx
+  802c92:	48 83 ec 08          	sub    $0x8,%rsp
+  802c96:	48 89 fa             	mov    %rdi,%rdx
+  802c99:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c9c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cab:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cbe:	48 85 c0             	test   %rax,%rax
+  802cc1:	7f 06                	jg     802cc9 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cc3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc7:	c9                   	leave
+  802cc8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cc9:	49 89 c0             	mov    %rax,%r8
+  802ccc:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802cd1:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802cd8:	00 00 00 
+  802cdb:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce0:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802ce7:	00 00 00 
+  802cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cef:	49 b9 93 50 80 00 00 	movabs $0x805093,%r9
+  802cf6:	00 00 00 
+  802cf9:	41 ff d1             	call   *%r9
+
+0000000000802cfc <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cfc:	55                   	push   %rbp
+  802cfd:	48 89 e5             	mov    %rsp,%rbp
+  802d00:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d01:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d06:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d15:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d1a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d25:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d31:	c9                   	leave
+  802d32:	c3                   	ret
+
+0000000000802d33 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d33:	55                   	push   %rbp
+  802d34:	48 89 e5             	mov    %rsp,%rbp
+  802d37:	53                   	push   %rbx
+  802d38:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d3b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d40:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d4a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d5a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d60:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d66:	c9                   	leave
+  802d67:	c3                   	ret
+
+0000000000802d68 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d68:	55                   	push   %rbp
+  802d69:	48 89 e5             	mov    %rsp,%rbp
+  802d6c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d77:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d81:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d86:	be 00 00 00 00       	mov    $0x0,%esi
+  802d8b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d91:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d97:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d9d:	c9                   	leave
+  802d9e:	c3                   	ret
+
+0000000000802d9f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d9f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802da6:	ff ff ff 
+  802da9:	48 01 f8             	add    %rdi,%rax
+  802dac:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802db0:	c3                   	ret
+
+0000000000802db1 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802db1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802db8:	ff ff ff 
+  802dbb:	48 01 f8             	add    %rdi,%rax
+  802dbe:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802dc2:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dc8:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dcc:	c3                   	ret
+
+0000000000802dcd <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dcd:	55                   	push   %rbp
+  802dce:	48 89 e5             	mov    %rsp,%rbp
+  802dd1:	41 57                	push   %r15
+  802dd3:	41 56                	push   %r14
+  802dd5:	41 55                	push   %r13
+  802dd7:	41 54                	push   %r12
+  802dd9:	53                   	push   %rbx
+  802dda:	48 83 ec 08          	sub    $0x8,%rsp
+  802dde:	49 89 ff             	mov    %rdi,%r15
+  802de1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802de6:	49 bd cd 42 80 00 00 	movabs $0x8042cd,%r13
+  802ded:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802df0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802df6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802df9:	48 89 df             	mov    %rbx,%rdi
+  802dfc:	41 ff d5             	call   *%r13
+  802dff:	83 e0 04             	and    $0x4,%eax
+  802e02:	74 17                	je     802e1b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e04:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e0b:	4c 39 f3             	cmp    %r14,%rbx
+  802e0e:	75 e6                	jne    802df6 <fd_alloc+0x29>
+  802e10:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e16:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e1b:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e1e:	48 83 c4 08          	add    $0x8,%rsp
+  802e22:	5b                   	pop    %rbx
+  802e23:	41 5c                	pop    %r12
+  802e25:	41 5d                	pop    %r13
+  802e27:	41 5e                	pop    %r14
+  802e29:	41 5f                	pop    %r15
+  802e2b:	5d                   	pop    %rbp
+  802e2c:	c3                   	ret
+
+0000000000802e2d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e2d:	83 ff 1f             	cmp    $0x1f,%edi
+  802e30:	77 39                	ja     802e6b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e32:	55                   	push   %rbp
+  802e33:	48 89 e5             	mov    %rsp,%rbp
+  802e36:	41 54                	push   %r12
+  802e38:	53                   	push   %rbx
+  802e39:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e3c:	48 63 df             	movslq %edi,%rbx
+  802e3f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e46:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e4a:	48 89 df             	mov    %rbx,%rdi
+  802e4d:	48 b8 cd 42 80 00 00 	movabs $0x8042cd,%rax
+  802e54:	00 00 00 
+  802e57:	ff d0                	call   *%rax
+  802e59:	a8 04                	test   $0x4,%al
+  802e5b:	74 14                	je     802e71 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e5d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e66:	5b                   	pop    %rbx
+  802e67:	41 5c                	pop    %r12
+  802e69:	5d                   	pop    %rbp
+  802e6a:	c3                   	ret
+        return -E_INVAL;
+  802e6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e70:	c3                   	ret
+        return -E_INVAL;
+  802e71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e76:	eb ee                	jmp    802e66 <fd_lookup+0x39>
+
+0000000000802e78 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e78:	55                   	push   %rbp
+  802e79:	48 89 e5             	mov    %rsp,%rbp
+  802e7c:	41 54                	push   %r12
+  802e7e:	53                   	push   %rbx
+  802e7f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e82:	48 b8 00 62 80 00 00 	movabs $0x806200,%rax
+  802e89:	00 00 00 
+  802e8c:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e93:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e96:	39 3b                	cmp    %edi,(%rbx)
+  802e98:	74 47                	je     802ee1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e9a:	48 83 c0 08          	add    $0x8,%rax
+  802e9e:	48 8b 18             	mov    (%rax),%rbx
+  802ea1:	48 85 db             	test   %rbx,%rbx
+  802ea4:	75 f0                	jne    802e96 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ea6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ead:	00 00 00 
+  802eb0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802eb6:	89 fa                	mov    %edi,%edx
+  802eb8:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  802ebf:	00 00 00 
+  802ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec7:	48 b9 a5 16 80 00 00 	movabs $0x8016a5,%rcx
+  802ece:	00 00 00 
+  802ed1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ed3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ed8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802edc:	5b                   	pop    %rbx
+  802edd:	41 5c                	pop    %r12
+  802edf:	5d                   	pop    %rbp
+  802ee0:	c3                   	ret
+            return 0;
+  802ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee6:	eb f0                	jmp    802ed8 <dev_lookup+0x60>
+
+0000000000802ee8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ee8:	55                   	push   %rbp
+  802ee9:	48 89 e5             	mov    %rsp,%rbp
+  802eec:	41 55                	push   %r13
+  802eee:	41 54                	push   %r12
+  802ef0:	53                   	push   %rbx
+  802ef1:	48 83 ec 18          	sub    $0x18,%rsp
+  802ef5:	48 89 fb             	mov    %rdi,%rbx
+  802ef8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802efb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f02:	ff ff ff 
+  802f05:	48 01 df             	add    %rbx,%rdi
+  802f08:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f0c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f10:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+  802f1c:	41 89 c5             	mov    %eax,%r13d
+  802f1f:	85 c0                	test   %eax,%eax
+  802f21:	78 06                	js     802f29 <fd_close+0x41>
+  802f23:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f27:	74 1a                	je     802f43 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f29:	45 84 e4             	test   %r12b,%r12b
+  802f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f31:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f35:	44 89 e8             	mov    %r13d,%eax
+  802f38:	48 83 c4 18          	add    $0x18,%rsp
+  802f3c:	5b                   	pop    %rbx
+  802f3d:	41 5c                	pop    %r12
+  802f3f:	41 5d                	pop    %r13
+  802f41:	5d                   	pop    %rbp
+  802f42:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f43:	8b 3b                	mov    (%rbx),%edi
+  802f45:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f49:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  802f50:	00 00 00 
+  802f53:	ff d0                	call   *%rax
+  802f55:	41 89 c5             	mov    %eax,%r13d
+  802f58:	85 c0                	test   %eax,%eax
+  802f5a:	78 1b                	js     802f77 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f60:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f64:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f6a:	48 85 c0             	test   %rax,%rax
+  802f6d:	74 08                	je     802f77 <fd_close+0x8f>
+  802f6f:	48 89 df             	mov    %rbx,%rdi
+  802f72:	ff d0                	call   *%rax
+  802f74:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f77:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f7c:	48 89 de             	mov    %rbx,%rsi
+  802f7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f84:	48 b8 19 28 80 00 00 	movabs $0x802819,%rax
+  802f8b:	00 00 00 
+  802f8e:	ff d0                	call   *%rax
+    return res;
+  802f90:	eb a3                	jmp    802f35 <fd_close+0x4d>
+
+0000000000802f92 <close>:
+
+int
+close(int fdnum) {
+  802f92:	55                   	push   %rbp
+  802f93:	48 89 e5             	mov    %rsp,%rbp
+  802f96:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f9e:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 15                	js     802fc3 <close+0x31>
+
+    return fd_close(fd, 1);
+  802fae:	be 01 00 00 00       	mov    $0x1,%esi
+  802fb3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb7:	48 b8 e8 2e 80 00 00 	movabs $0x802ee8,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+}
+  802fc3:	c9                   	leave
+  802fc4:	c3                   	ret
+
+0000000000802fc5 <close_all>:
+
+void
+close_all(void) {
+  802fc5:	55                   	push   %rbp
+  802fc6:	48 89 e5             	mov    %rsp,%rbp
+  802fc9:	41 54                	push   %r12
+  802fcb:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd1:	49 bc 92 2f 80 00 00 	movabs $0x802f92,%r12
+  802fd8:	00 00 00 
+  802fdb:	89 df                	mov    %ebx,%edi
+  802fdd:	41 ff d4             	call   *%r12
+  802fe0:	83 c3 01             	add    $0x1,%ebx
+  802fe3:	83 fb 20             	cmp    $0x20,%ebx
+  802fe6:	75 f3                	jne    802fdb <close_all+0x16>
+}
+  802fe8:	5b                   	pop    %rbx
+  802fe9:	41 5c                	pop    %r12
+  802feb:	5d                   	pop    %rbp
+  802fec:	c3                   	ret
+
+0000000000802fed <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fed:	55                   	push   %rbp
+  802fee:	48 89 e5             	mov    %rsp,%rbp
+  802ff1:	41 57                	push   %r15
+  802ff3:	41 56                	push   %r14
+  802ff5:	41 55                	push   %r13
+  802ff7:	41 54                	push   %r12
+  802ff9:	53                   	push   %rbx
+  802ffa:	48 83 ec 18          	sub    $0x18,%rsp
+  802ffe:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803001:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803005:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  80300c:	00 00 00 
+  80300f:	ff d0                	call   *%rax
+  803011:	89 c3                	mov    %eax,%ebx
+  803013:	85 c0                	test   %eax,%eax
+  803015:	0f 88 b8 00 00 00    	js     8030d3 <dup+0xe6>
+    close(newfdnum);
+  80301b:	44 89 e7             	mov    %r12d,%edi
+  80301e:	48 b8 92 2f 80 00 00 	movabs $0x802f92,%rax
+  803025:	00 00 00 
+  803028:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80302a:	4d 63 ec             	movslq %r12d,%r13
+  80302d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803034:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803038:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80303c:	4c 89 ff             	mov    %r15,%rdi
+  80303f:	49 be b1 2d 80 00 00 	movabs $0x802db1,%r14
+  803046:	00 00 00 
+  803049:	41 ff d6             	call   *%r14
+  80304c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80304f:	4c 89 ef             	mov    %r13,%rdi
+  803052:	41 ff d6             	call   *%r14
+  803055:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803058:	48 89 df             	mov    %rbx,%rdi
+  80305b:	48 b8 cd 42 80 00 00 	movabs $0x8042cd,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803067:	a8 04                	test   $0x4,%al
+  803069:	74 2b                	je     803096 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80306b:	41 89 c1             	mov    %eax,%r9d
+  80306e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803074:	4c 89 f1             	mov    %r14,%rcx
+  803077:	ba 00 00 00 00       	mov    $0x0,%edx
+  80307c:	48 89 de             	mov    %rbx,%rsi
+  80307f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803084:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+  803090:	89 c3                	mov    %eax,%ebx
+  803092:	85 c0                	test   %eax,%eax
+  803094:	78 4e                	js     8030e4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803096:	4c 89 ff             	mov    %r15,%rdi
+  803099:	48 b8 cd 42 80 00 00 	movabs $0x8042cd,%rax
+  8030a0:	00 00 00 
+  8030a3:	ff d0                	call   *%rax
+  8030a5:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030a8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030ae:	4c 89 e9             	mov    %r13,%rcx
+  8030b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b6:	4c 89 fe             	mov    %r15,%rsi
+  8030b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030be:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+  8030ca:	89 c3                	mov    %eax,%ebx
+  8030cc:	85 c0                	test   %eax,%eax
+  8030ce:	78 14                	js     8030e4 <dup+0xf7>
+
+    return newfdnum;
+  8030d0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030d3:	89 d8                	mov    %ebx,%eax
+  8030d5:	48 83 c4 18          	add    $0x18,%rsp
+  8030d9:	5b                   	pop    %rbx
+  8030da:	41 5c                	pop    %r12
+  8030dc:	41 5d                	pop    %r13
+  8030de:	41 5e                	pop    %r14
+  8030e0:	41 5f                	pop    %r15
+  8030e2:	5d                   	pop    %rbp
+  8030e3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e9:	4c 89 ee             	mov    %r13,%rsi
+  8030ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f1:	49 bc 19 28 80 00 00 	movabs $0x802819,%r12
+  8030f8:	00 00 00 
+  8030fb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803103:	4c 89 f6             	mov    %r14,%rsi
+  803106:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310b:	41 ff d4             	call   *%r12
+    return res;
+  80310e:	eb c3                	jmp    8030d3 <dup+0xe6>
+
+0000000000803110 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803110:	55                   	push   %rbp
+  803111:	48 89 e5             	mov    %rsp,%rbp
+  803114:	41 56                	push   %r14
+  803116:	41 55                	push   %r13
+  803118:	41 54                	push   %r12
+  80311a:	53                   	push   %rbx
+  80311b:	48 83 ec 10          	sub    $0x10,%rsp
+  80311f:	89 fb                	mov    %edi,%ebx
+  803121:	49 89 f4             	mov    %rsi,%r12
+  803124:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803127:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80312b:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  803132:	00 00 00 
+  803135:	ff d0                	call   *%rax
+  803137:	85 c0                	test   %eax,%eax
+  803139:	78 4c                	js     803187 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80313b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80313f:	41 8b 3e             	mov    (%r14),%edi
+  803142:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803146:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  80314d:	00 00 00 
+  803150:	ff d0                	call   *%rax
+  803152:	85 c0                	test   %eax,%eax
+  803154:	78 35                	js     80318b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803156:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80315a:	83 e0 03             	and    $0x3,%eax
+  80315d:	83 f8 01             	cmp    $0x1,%eax
+  803160:	74 2d                	je     80318f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803162:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803166:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80316a:	48 85 c0             	test   %rax,%rax
+  80316d:	74 56                	je     8031c5 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80316f:	4c 89 ea             	mov    %r13,%rdx
+  803172:	4c 89 e6             	mov    %r12,%rsi
+  803175:	4c 89 f7             	mov    %r14,%rdi
+  803178:	ff d0                	call   *%rax
+}
+  80317a:	48 83 c4 10          	add    $0x10,%rsp
+  80317e:	5b                   	pop    %rbx
+  80317f:	41 5c                	pop    %r12
+  803181:	41 5d                	pop    %r13
+  803183:	41 5e                	pop    %r14
+  803185:	5d                   	pop    %rbp
+  803186:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803187:	48 98                	cltq
+  803189:	eb ef                	jmp    80317a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80318b:	48 98                	cltq
+  80318d:	eb eb                	jmp    80317a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80318f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803196:	00 00 00 
+  803199:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80319f:	89 da                	mov    %ebx,%edx
+  8031a1:	48 bf b9 61 80 00 00 	movabs $0x8061b9,%rdi
+  8031a8:	00 00 00 
+  8031ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b0:	48 b9 a5 16 80 00 00 	movabs $0x8016a5,%rcx
+  8031b7:	00 00 00 
+  8031ba:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031c3:	eb b5                	jmp    80317a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031c5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031cc:	eb ac                	jmp    80317a <read+0x6a>
+
+00000000008031ce <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031ce:	55                   	push   %rbp
+  8031cf:	48 89 e5             	mov    %rsp,%rbp
+  8031d2:	41 57                	push   %r15
+  8031d4:	41 56                	push   %r14
+  8031d6:	41 55                	push   %r13
+  8031d8:	41 54                	push   %r12
+  8031da:	53                   	push   %rbx
+  8031db:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031df:	48 85 d2             	test   %rdx,%rdx
+  8031e2:	74 54                	je     803238 <readn+0x6a>
+  8031e4:	41 89 fd             	mov    %edi,%r13d
+  8031e7:	49 89 f6             	mov    %rsi,%r14
+  8031ea:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031f2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031f7:	49 bf 10 31 80 00 00 	movabs $0x803110,%r15
+  8031fe:	00 00 00 
+  803201:	4c 89 e2             	mov    %r12,%rdx
+  803204:	48 29 f2             	sub    %rsi,%rdx
+  803207:	4c 01 f6             	add    %r14,%rsi
+  80320a:	44 89 ef             	mov    %r13d,%edi
+  80320d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803210:	85 c0                	test   %eax,%eax
+  803212:	78 20                	js     803234 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803214:	01 c3                	add    %eax,%ebx
+  803216:	85 c0                	test   %eax,%eax
+  803218:	74 08                	je     803222 <readn+0x54>
+  80321a:	48 63 f3             	movslq %ebx,%rsi
+  80321d:	4c 39 e6             	cmp    %r12,%rsi
+  803220:	72 df                	jb     803201 <readn+0x33>
+    }
+    return res;
+  803222:	48 63 c3             	movslq %ebx,%rax
+}
+  803225:	48 83 c4 08          	add    $0x8,%rsp
+  803229:	5b                   	pop    %rbx
+  80322a:	41 5c                	pop    %r12
+  80322c:	41 5d                	pop    %r13
+  80322e:	41 5e                	pop    %r14
+  803230:	41 5f                	pop    %r15
+  803232:	5d                   	pop    %rbp
+  803233:	c3                   	ret
+        if (inc < 0) return inc;
+  803234:	48 98                	cltq
+  803236:	eb ed                	jmp    803225 <readn+0x57>
+    int inc = 1, res = 0;
+  803238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80323d:	eb e3                	jmp    803222 <readn+0x54>
+
+000000000080323f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80323f:	55                   	push   %rbp
+  803240:	48 89 e5             	mov    %rsp,%rbp
+  803243:	41 56                	push   %r14
+  803245:	41 55                	push   %r13
+  803247:	41 54                	push   %r12
+  803249:	53                   	push   %rbx
+  80324a:	48 83 ec 10          	sub    $0x10,%rsp
+  80324e:	89 fb                	mov    %edi,%ebx
+  803250:	49 89 f4             	mov    %rsi,%r12
+  803253:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803256:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80325a:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  803261:	00 00 00 
+  803264:	ff d0                	call   *%rax
+  803266:	85 c0                	test   %eax,%eax
+  803268:	78 47                	js     8032b1 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80326a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80326e:	41 8b 3e             	mov    (%r14),%edi
+  803271:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803275:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+  803281:	85 c0                	test   %eax,%eax
+  803283:	78 30                	js     8032b5 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803285:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80328a:	74 2d                	je     8032b9 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80328c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803290:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803294:	48 85 c0             	test   %rax,%rax
+  803297:	74 56                	je     8032ef <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803299:	4c 89 ea             	mov    %r13,%rdx
+  80329c:	4c 89 e6             	mov    %r12,%rsi
+  80329f:	4c 89 f7             	mov    %r14,%rdi
+  8032a2:	ff d0                	call   *%rax
+}
+  8032a4:	48 83 c4 10          	add    $0x10,%rsp
+  8032a8:	5b                   	pop    %rbx
+  8032a9:	41 5c                	pop    %r12
+  8032ab:	41 5d                	pop    %r13
+  8032ad:	41 5e                	pop    %r14
+  8032af:	5d                   	pop    %rbp
+  8032b0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032b1:	48 98                	cltq
+  8032b3:	eb ef                	jmp    8032a4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032b5:	48 98                	cltq
+  8032b7:	eb eb                	jmp    8032a4 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032b9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032c0:	00 00 00 
+  8032c3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032c9:	89 da                	mov    %ebx,%edx
+  8032cb:	48 bf d5 61 80 00 00 	movabs $0x8061d5,%rdi
+  8032d2:	00 00 00 
+  8032d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032da:	48 b9 a5 16 80 00 00 	movabs $0x8016a5,%rcx
+  8032e1:	00 00 00 
+  8032e4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032e6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ed:	eb b5                	jmp    8032a4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032ef:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032f6:	eb ac                	jmp    8032a4 <write+0x65>
+
+00000000008032f8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032f8:	55                   	push   %rbp
+  8032f9:	48 89 e5             	mov    %rsp,%rbp
+  8032fc:	53                   	push   %rbx
+  8032fd:	48 83 ec 18          	sub    $0x18,%rsp
+  803301:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803303:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803307:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 0c                	js     803323 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80331b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80331e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803323:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803327:	c9                   	leave
+  803328:	c3                   	ret
+
+0000000000803329 <tell>:
+
+int tell(int fdnum) {
+  803329:	55                   	push   %rbp
+  80332a:	48 89 e5             	mov    %rsp,%rbp
+  80332d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803331:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803335:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  80333c:	00 00 00 
+  80333f:	ff d0                	call   *%rax
+  803341:	85 c0                	test   %eax,%eax
+  803343:	78 07                	js     80334c <tell+0x23>
+
+    return fd->fd_offset;
+  803345:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803349:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80334c:	c9                   	leave
+  80334d:	c3                   	ret
+
+000000000080334e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80334e:	55                   	push   %rbp
+  80334f:	48 89 e5             	mov    %rsp,%rbp
+  803352:	41 55                	push   %r13
+  803354:	41 54                	push   %r12
+  803356:	53                   	push   %rbx
+  803357:	48 83 ec 18          	sub    $0x18,%rsp
+  80335b:	89 fb                	mov    %edi,%ebx
+  80335d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803360:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803364:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  80336b:	00 00 00 
+  80336e:	ff d0                	call   *%rax
+  803370:	85 c0                	test   %eax,%eax
+  803372:	78 38                	js     8033ac <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803374:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803378:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80337c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803380:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  803387:	00 00 00 
+  80338a:	ff d0                	call   *%rax
+  80338c:	85 c0                	test   %eax,%eax
+  80338e:	78 1c                	js     8033ac <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803390:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803395:	74 20                	je     8033b7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803397:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80339b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80339f:	48 85 c0             	test   %rax,%rax
+  8033a2:	74 47                	je     8033eb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8033a4:	44 89 e6             	mov    %r12d,%esi
+  8033a7:	4c 89 ef             	mov    %r13,%rdi
+  8033aa:	ff d0                	call   *%rax
+}
+  8033ac:	48 83 c4 18          	add    $0x18,%rsp
+  8033b0:	5b                   	pop    %rbx
+  8033b1:	41 5c                	pop    %r12
+  8033b3:	41 5d                	pop    %r13
+  8033b5:	5d                   	pop    %rbp
+  8033b6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033b7:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033be:	00 00 00 
+  8033c1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033c7:	89 da                	mov    %ebx,%edx
+  8033c9:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  8033d0:	00 00 00 
+  8033d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d8:	48 b9 a5 16 80 00 00 	movabs $0x8016a5,%rcx
+  8033df:	00 00 00 
+  8033e2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033e9:	eb c1                	jmp    8033ac <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033eb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033f0:	eb ba                	jmp    8033ac <ftruncate+0x5e>
+
+00000000008033f2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033f2:	55                   	push   %rbp
+  8033f3:	48 89 e5             	mov    %rsp,%rbp
+  8033f6:	41 54                	push   %r12
+  8033f8:	53                   	push   %rbx
+  8033f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8033fd:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803400:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803404:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  80340b:	00 00 00 
+  80340e:	ff d0                	call   *%rax
+  803410:	85 c0                	test   %eax,%eax
+  803412:	78 63                	js     803477 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803414:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803418:	41 8b 3c 24          	mov    (%r12),%edi
+  80341c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803420:	48 b8 78 2e 80 00 00 	movabs $0x802e78,%rax
+  803427:	00 00 00 
+  80342a:	ff d0                	call   *%rax
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	78 47                	js     803477 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803430:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803434:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803439:	74 45                	je     803480 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80343b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80343e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803445:	00 00 00 
+    stat->st_isdir = 0;
+  803448:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80344f:	00 00 00 
+    stat->st_ino = 0;
+  803452:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803459:	00 00 00 00 
+    stat->st_version = 0;
+  80345d:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803464:	00 00 00 
+    stat->st_dev = dev;
+  803467:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80346e:	48 89 de             	mov    %rbx,%rsi
+  803471:	4c 89 e7             	mov    %r12,%rdi
+  803474:	ff 50 28             	call   *0x28(%rax)
+}
+  803477:	48 83 c4 10          	add    $0x10,%rsp
+  80347b:	5b                   	pop    %rbx
+  80347c:	41 5c                	pop    %r12
+  80347e:	5d                   	pop    %rbp
+  80347f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803480:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803485:	eb f0                	jmp    803477 <fstat+0x85>
+
+0000000000803487 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803487:	55                   	push   %rbp
+  803488:	48 89 e5             	mov    %rsp,%rbp
+  80348b:	41 54                	push   %r12
+  80348d:	53                   	push   %rbx
+  80348e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803491:	be 00 00 00 00       	mov    $0x0,%esi
+  803496:	48 b8 a8 39 80 00 00 	movabs $0x8039a8,%rax
+  80349d:	00 00 00 
+  8034a0:	ff d0                	call   *%rax
+  8034a2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034a4:	85 c0                	test   %eax,%eax
+  8034a6:	78 25                	js     8034cd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034a8:	4c 89 e6             	mov    %r12,%rsi
+  8034ab:	89 c7                	mov    %eax,%edi
+  8034ad:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+  8034b9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034bc:	89 df                	mov    %ebx,%edi
+  8034be:	48 b8 92 2f 80 00 00 	movabs $0x802f92,%rax
+  8034c5:	00 00 00 
+  8034c8:	ff d0                	call   *%rax
+
+    return res;
+  8034ca:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034cd:	89 d8                	mov    %ebx,%eax
+  8034cf:	5b                   	pop    %rbx
+  8034d0:	41 5c                	pop    %r12
+  8034d2:	5d                   	pop    %rbp
+  8034d3:	c3                   	ret
+
+00000000008034d4 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034d4:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034db:	00 00 00 
+  8034de:	83 38 00             	cmpl   $0x0,(%rax)
+  8034e1:	74 0a                	je     8034ed <fsipc_env+0x19>
+    return fsenv;
+}
+  8034e3:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034ea:	00 00 
+  8034ec:	c3                   	ret
+fsipc_env(void) {
+  8034ed:	55                   	push   %rbp
+  8034ee:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034f1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034f6:	48 b8 7a 56 80 00 00 	movabs $0x80567a,%rax
+  8034fd:	00 00 00 
+  803500:	ff d0                	call   *%rax
+  803502:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803509:	00 00 
+}
+  80350b:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803512:	00 00 
+  803514:	5d                   	pop    %rbp
+  803515:	c3                   	ret
+
+0000000000803516 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803516:	55                   	push   %rbp
+  803517:	48 89 e5             	mov    %rsp,%rbp
+  80351a:	53                   	push   %rbx
+  80351b:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80351f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803526:	00 
+  803527:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80352e:	00 
+  80352f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803536:	00 
+  803537:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80353e:	00 
+  80353f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803546:	00 
+
+    assert(size <= sizeof(words));
+  803547:	48 83 fa 28          	cmp    $0x28,%rdx
+  80354b:	77 38                	ja     803585 <fsipc_short+0x6f>
+  80354d:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80354f:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803553:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  80355a:	00 00 00 
+  80355d:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80355f:	48 b8 d4 34 80 00 00 	movabs $0x8034d4,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+  80356b:	89 c7                	mov    %eax,%edi
+  80356d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803571:	89 de                	mov    %ebx,%esi
+  803573:	48 b8 dd 55 80 00 00 	movabs $0x8055dd,%rax
+  80357a:	00 00 00 
+  80357d:	ff d0                	call   *%rax
+}
+  80357f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803583:	c9                   	leave
+  803584:	c3                   	ret
+    assert(size <= sizeof(words));
+  803585:	48 b9 20 62 80 00 00 	movabs $0x806220,%rcx
+  80358c:	00 00 00 
+  80358f:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803596:	00 00 00 
+  803599:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80359e:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8035a5:	00 00 00 
+  8035a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ad:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  8035b4:	00 00 00 
+  8035b7:	41 ff d0             	call   *%r8
+
+00000000008035ba <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035ba:	55                   	push   %rbp
+  8035bb:	48 89 e5             	mov    %rsp,%rbp
+  8035be:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035c2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035c5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035c8:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035cb:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035d4:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035d9:	48 b8 16 35 80 00 00 	movabs $0x803516,%rax
+  8035e0:	00 00 00 
+  8035e3:	ff d0                	call   *%rax
+}
+  8035e5:	c9                   	leave
+  8035e6:	c3                   	ret
+
+00000000008035e7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035e7:	55                   	push   %rbp
+  8035e8:	48 89 e5             	mov    %rsp,%rbp
+  8035eb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035ef:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035f5:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035fa:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035fe:	bf 06 00 00 00       	mov    $0x6,%edi
+  803603:	48 b8 16 35 80 00 00 	movabs $0x803516,%rax
+  80360a:	00 00 00 
+  80360d:	ff d0                	call   *%rax
+}
+  80360f:	c9                   	leave
+  803610:	c3                   	ret
+
+0000000000803611 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803611:	55                   	push   %rbp
+  803612:	48 89 e5             	mov    %rsp,%rbp
+  803615:	41 54                	push   %r12
+  803617:	53                   	push   %rbx
+  803618:	48 83 ec 10          	sub    $0x10,%rsp
+  80361c:	89 fb                	mov    %edi,%ebx
+  80361e:	49 89 f4             	mov    %rsi,%r12
+  803621:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803625:	48 b8 d4 34 80 00 00 	movabs $0x8034d4,%rax
+  80362c:	00 00 00 
+  80362f:	ff d0                	call   *%rax
+  803631:	89 c7                	mov    %eax,%edi
+  803633:	6a 00                	push   $0x0
+  803635:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803639:	50                   	push   %rax
+  80363a:	4d 89 e1             	mov    %r12,%r9
+  80363d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803643:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803648:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80364f:	00 00 00 
+  803652:	89 de                	mov    %ebx,%esi
+  803654:	48 b8 78 55 80 00 00 	movabs $0x805578,%rax
+  80365b:	00 00 00 
+  80365e:	ff d0                	call   *%rax
+}
+  803660:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803664:	5b                   	pop    %rbx
+  803665:	41 5c                	pop    %r12
+  803667:	5d                   	pop    %rbp
+  803668:	c3                   	ret
+
+0000000000803669 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803669:	55                   	push   %rbp
+  80366a:	48 89 e5             	mov    %rsp,%rbp
+  80366d:	41 54                	push   %r12
+  80366f:	53                   	push   %rbx
+  803670:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803673:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803676:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80367d:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80367f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803684:	be 00 00 00 00       	mov    $0x0,%esi
+  803689:	bf 05 00 00 00       	mov    $0x5,%edi
+  80368e:	48 b8 11 36 80 00 00 	movabs $0x803611,%rax
+  803695:	00 00 00 
+  803698:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80369a:	85 c0                	test   %eax,%eax
+  80369c:	78 5a                	js     8036f8 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80369e:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036a5:	00 00 00 
+  8036a8:	4c 89 e6             	mov    %r12,%rsi
+  8036ab:	48 89 df             	mov    %rbx,%rdi
+  8036ae:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  8036b5:	00 00 00 
+  8036b8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036ba:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036c1:	00 
+  8036c2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036c8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036cf:	00 
+  8036d0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036d6:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036dd:	00 
+  8036de:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036e5:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036ec:	00 
+  8036ed:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f8:	5b                   	pop    %rbx
+  8036f9:	41 5c                	pop    %r12
+  8036fb:	5d                   	pop    %rbp
+  8036fc:	c3                   	ret
+
+00000000008036fd <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036fd:	55                   	push   %rbp
+  8036fe:	48 89 e5             	mov    %rsp,%rbp
+  803701:	41 57                	push   %r15
+  803703:	41 56                	push   %r14
+  803705:	41 55                	push   %r13
+  803707:	41 54                	push   %r12
+  803709:	53                   	push   %rbx
+  80370a:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80370e:	48 85 ff             	test   %rdi,%rdi
+  803711:	0f 84 a1 00 00 00    	je     8037b8 <devfile_read+0xbb>
+  803717:	49 89 ff             	mov    %rdi,%r15
+  80371a:	49 89 f5             	mov    %rsi,%r13
+  80371d:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803720:	48 85 f6             	test   %rsi,%rsi
+  803723:	0f 84 c4 00 00 00    	je     8037ed <devfile_read+0xf0>
+    size_t total_read = 0;
+  803729:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803730:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803731:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803738:	00 00 00 
+  80373b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80373f:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803742:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803746:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80374b:	be 00 00 00 00       	mov    $0x0,%esi
+  803750:	bf 03 00 00 00       	mov    $0x3,%edi
+  803755:	48 b8 11 36 80 00 00 	movabs $0x803611,%rax
+  80375c:	00 00 00 
+  80375f:	ff d0                	call   *%rax
+        if (res < 0) {
+  803761:	85 c0                	test   %eax,%eax
+  803763:	0f 88 b9 00 00 00    	js     803822 <devfile_read+0x125>
+        assert(res <= n);
+  803769:	48 63 d8             	movslq %eax,%rbx
+  80376c:	49 39 dc             	cmp    %rbx,%r12
+  80376f:	0f 82 b1 00 00 00    	jb     803826 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803775:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80377a:	0f 87 db 00 00 00    	ja     80385b <devfile_read+0x15e>
+        if (!res) {
+  803780:	85 c0                	test   %eax,%eax
+  803782:	74 21                	je     8037a5 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803784:	48 89 da             	mov    %rbx,%rdx
+  803787:	4c 89 f6             	mov    %r14,%rsi
+  80378a:	4c 89 ef             	mov    %r13,%rdi
+  80378d:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  803794:	00 00 00 
+  803797:	ff d0                	call   *%rax
+        total_read += res;
+  803799:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  80379d:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8037a0:	49 29 dc             	sub    %rbx,%r12
+  8037a3:	75 96                	jne    80373b <devfile_read+0x3e>
+    return total_read;
+  8037a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037a9:	48 83 c4 18          	add    $0x18,%rsp
+  8037ad:	5b                   	pop    %rbx
+  8037ae:	41 5c                	pop    %r12
+  8037b0:	41 5d                	pop    %r13
+  8037b2:	41 5e                	pop    %r14
+  8037b4:	41 5f                	pop    %r15
+  8037b6:	5d                   	pop    %rbp
+  8037b7:	c3                   	ret
+    assert(fd);
+  8037b8:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  8037bf:	00 00 00 
+  8037c2:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037c9:	00 00 00 
+  8037cc:	be 91 00 00 00       	mov    $0x91,%esi
+  8037d1:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8037d8:	00 00 00 
+  8037db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e0:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  8037e7:	00 00 00 
+  8037ea:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037ed:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  8037f4:	00 00 00 
+  8037f7:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037fe:	00 00 00 
+  803801:	be 92 00 00 00       	mov    $0x92,%esi
+  803806:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80380d:	00 00 00 
+  803810:	b8 00 00 00 00       	mov    $0x0,%eax
+  803815:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  80381c:	00 00 00 
+  80381f:	41 ff d0             	call   *%r8
+            return res;
+  803822:	48 98                	cltq
+  803824:	eb 83                	jmp    8037a9 <devfile_read+0xac>
+        assert(res <= n);
+  803826:	48 b9 5d 62 80 00 00 	movabs $0x80625d,%rcx
+  80382d:	00 00 00 
+  803830:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803837:	00 00 00 
+  80383a:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80383f:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803846:	00 00 00 
+  803849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384e:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  803855:	00 00 00 
+  803858:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80385b:	48 b9 68 62 80 00 00 	movabs $0x806268,%rcx
+  803862:	00 00 00 
+  803865:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80386c:	00 00 00 
+  80386f:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803874:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80387b:	00 00 00 
+  80387e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803883:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  80388a:	00 00 00 
+  80388d:	41 ff d0             	call   *%r8
+
+0000000000803890 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803890:	55                   	push   %rbp
+  803891:	48 89 e5             	mov    %rsp,%rbp
+  803894:	41 57                	push   %r15
+  803896:	41 56                	push   %r14
+  803898:	41 55                	push   %r13
+  80389a:	41 54                	push   %r12
+  80389c:	53                   	push   %rbx
+  80389d:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8038a1:	48 85 ff             	test   %rdi,%rdi
+  8038a4:	0f 84 83 00 00 00    	je     80392d <devfile_write+0x9d>
+  8038aa:	49 89 ff             	mov    %rdi,%r15
+  8038ad:	49 89 f4             	mov    %rsi,%r12
+  8038b0:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038b3:	48 85 f6             	test   %rsi,%rsi
+  8038b6:	0f 84 a6 00 00 00    	je     803962 <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038bc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038c2:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038c9:	00 00 00 
+  8038cc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038d0:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038d3:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038d7:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038dc:	48 39 d3             	cmp    %rdx,%rbx
+  8038df:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038e3:	4c 89 e6             	mov    %r12,%rsi
+  8038e6:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038ed:	00 00 00 
+  8038f0:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  8038f7:	00 00 00 
+  8038fa:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803901:	be 00 00 00 00       	mov    $0x0,%esi
+  803906:	bf 04 00 00 00       	mov    $0x4,%edi
+  80390b:	48 b8 11 36 80 00 00 	movabs $0x803611,%rax
+  803912:	00 00 00 
+  803915:	ff d0                	call   *%rax
+        if (res < 0) {
+  803917:	85 c0                	test   %eax,%eax
+  803919:	78 7c                	js     803997 <devfile_write+0x107>
+        total_written += res;
+  80391b:	48 98                	cltq
+  80391d:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803920:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803923:	48 29 c3             	sub    %rax,%rbx
+  803926:	75 a4                	jne    8038cc <devfile_write+0x3c>
+    return total_written;
+  803928:	4c 89 e8             	mov    %r13,%rax
+  80392b:	eb 6c                	jmp    803999 <devfile_write+0x109>
+    assert(fd);
+  80392d:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  803934:	00 00 00 
+  803937:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80393e:	00 00 00 
+  803941:	be bd 00 00 00       	mov    $0xbd,%esi
+  803946:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80394d:	00 00 00 
+  803950:	b8 00 00 00 00       	mov    $0x0,%eax
+  803955:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  80395c:	00 00 00 
+  80395f:	41 ff d0             	call   *%r8
+    assert(buf);
+  803962:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  803969:	00 00 00 
+  80396c:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803973:	00 00 00 
+  803976:	be be 00 00 00       	mov    $0xbe,%esi
+  80397b:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803982:	00 00 00 
+  803985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398a:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  803991:	00 00 00 
+  803994:	41 ff d0             	call   *%r8
+            return res;
+  803997:	48 98                	cltq
+}
+  803999:	48 83 c4 08          	add    $0x8,%rsp
+  80399d:	5b                   	pop    %rbx
+  80399e:	41 5c                	pop    %r12
+  8039a0:	41 5d                	pop    %r13
+  8039a2:	41 5e                	pop    %r14
+  8039a4:	41 5f                	pop    %r15
+  8039a6:	5d                   	pop    %rbp
+  8039a7:	c3                   	ret
+
+00000000008039a8 <open>:
+open(const char *path, int mode) {
+  8039a8:	55                   	push   %rbp
+  8039a9:	48 89 e5             	mov    %rsp,%rbp
+  8039ac:	41 55                	push   %r13
+  8039ae:	41 54                	push   %r12
+  8039b0:	53                   	push   %rbx
+  8039b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8039b5:	49 89 fc             	mov    %rdi,%r12
+  8039b8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039bb:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8039c2:	00 00 00 
+  8039c5:	ff d0                	call   *%rax
+  8039c7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039cd:	0f 87 8f 00 00 00    	ja     803a62 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039d3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039d7:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  8039de:	00 00 00 
+  8039e1:	ff d0                	call   *%rax
+  8039e3:	89 c3                	mov    %eax,%ebx
+  8039e5:	85 c0                	test   %eax,%eax
+  8039e7:	78 55                	js     803a3e <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039e9:	4c 89 e6             	mov    %r12,%rsi
+  8039ec:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039f3:	00 00 00 
+  8039f6:	48 89 df             	mov    %rbx,%rdi
+  8039f9:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  803a00:	00 00 00 
+  803a03:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a05:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a0c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a11:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a15:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a1a:	48 b8 11 36 80 00 00 	movabs $0x803611,%rax
+  803a21:	00 00 00 
+  803a24:	ff d0                	call   *%rax
+  803a26:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a28:	85 c0                	test   %eax,%eax
+  803a2a:	78 1f                	js     803a4b <open+0xa3>
+    return fd2num(fd);
+  803a2c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a30:	48 b8 9f 2d 80 00 00 	movabs $0x802d9f,%rax
+  803a37:	00 00 00 
+  803a3a:	ff d0                	call   *%rax
+  803a3c:	89 c3                	mov    %eax,%ebx
+}
+  803a3e:	89 d8                	mov    %ebx,%eax
+  803a40:	48 83 c4 18          	add    $0x18,%rsp
+  803a44:	5b                   	pop    %rbx
+  803a45:	41 5c                	pop    %r12
+  803a47:	41 5d                	pop    %r13
+  803a49:	5d                   	pop    %rbp
+  803a4a:	c3                   	ret
+        fd_close(fd, 0);
+  803a4b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a50:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a54:	48 b8 e8 2e 80 00 00 	movabs $0x802ee8,%rax
+  803a5b:	00 00 00 
+  803a5e:	ff d0                	call   *%rax
+        return res;
+  803a60:	eb dc                	jmp    803a3e <open+0x96>
+        return -E_BAD_PATH;
+  803a62:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a67:	eb d5                	jmp    803a3e <open+0x96>
+
+0000000000803a69 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a69:	55                   	push   %rbp
+  803a6a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a72:	be 00 00 00 00       	mov    $0x0,%esi
+  803a77:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a7c:	48 b8 16 35 80 00 00 	movabs $0x803516,%rax
+  803a83:	00 00 00 
+  803a86:	ff d0                	call   *%rax
+}
+  803a88:	5d                   	pop    %rbp
+  803a89:	c3                   	ret
+
+0000000000803a8a <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a8a:	55                   	push   %rbp
+  803a8b:	48 89 e5             	mov    %rsp,%rbp
+  803a8e:	41 56                	push   %r14
+  803a90:	41 55                	push   %r13
+  803a92:	41 54                	push   %r12
+  803a94:	53                   	push   %rbx
+  803a95:	48 83 ec 10          	sub    $0x10,%rsp
+  803a99:	41 89 f6             	mov    %esi,%r14d
+  803a9c:	49 89 d4             	mov    %rdx,%r12
+  803a9f:	48 89 cb             	mov    %rcx,%rbx
+  803aa2:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803aa5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aa9:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  803ab0:	00 00 00 
+  803ab3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ab5:	85 c0                	test   %eax,%eax
+  803ab7:	78 46                	js     803aff <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ab9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803abd:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803ac4:	00 00 00 
+  803ac7:	8b 00                	mov    (%rax),%eax
+  803ac9:	39 02                	cmp    %eax,(%rdx)
+  803acb:	75 3f                	jne    803b0c <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803acd:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803ad4:	00 00 00 
+  803ad7:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ada:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803adc:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ae0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ae4:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ae8:	48 89 da             	mov    %rbx,%rdx
+  803aeb:	4c 89 e6             	mov    %r12,%rsi
+  803aee:	bf 09 00 00 00       	mov    $0x9,%edi
+  803af3:	48 b8 11 36 80 00 00 	movabs $0x803611,%rax
+  803afa:	00 00 00 
+  803afd:	ff d0                	call   *%rax
+}
+  803aff:	48 83 c4 10          	add    $0x10,%rsp
+  803b03:	5b                   	pop    %rbx
+  803b04:	41 5c                	pop    %r12
+  803b06:	41 5d                	pop    %r13
+  803b08:	41 5e                	pop    %r14
+  803b0a:	5d                   	pop    %rbp
+  803b0b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b0c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b11:	eb ec                	jmp    803aff <file_map+0x75>
+
+0000000000803b13 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b13:	55                   	push   %rbp
+  803b14:	48 89 e5             	mov    %rsp,%rbp
+  803b17:	41 54                	push   %r12
+  803b19:	53                   	push   %rbx
+  803b1a:	48 83 ec 20          	sub    $0x20,%rsp
+  803b1e:	41 89 f4             	mov    %esi,%r12d
+  803b21:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b24:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b28:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  803b2f:	00 00 00 
+  803b32:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	78 3c                	js     803b74 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b3c:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b43:	00 00 00 
+  803b46:	8b 0a                	mov    (%rdx),%ecx
+  803b48:	39 08                	cmp    %ecx,(%rax)
+  803b4a:	75 31                	jne    803b7d <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b4c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b4f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b52:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b56:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b5a:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b5f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b63:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b68:	48 b8 16 35 80 00 00 	movabs $0x803516,%rax
+  803b6f:	00 00 00 
+  803b72:	ff d0                	call   *%rax
+}
+  803b74:	48 83 c4 20          	add    $0x20,%rsp
+  803b78:	5b                   	pop    %rbx
+  803b79:	41 5c                	pop    %r12
+  803b7b:	5d                   	pop    %rbp
+  803b7c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b7d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b82:	eb f0                	jmp    803b74 <file_msync+0x61>
+
+0000000000803b84 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b84:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b88:	7f 01                	jg     803b8b <writebuf+0x7>
+  803b8a:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b8b:	55                   	push   %rbp
+  803b8c:	48 89 e5             	mov    %rsp,%rbp
+  803b8f:	53                   	push   %rbx
+  803b90:	48 83 ec 08          	sub    $0x8,%rsp
+  803b94:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b97:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b9b:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b9f:	8b 3f                	mov    (%rdi),%edi
+  803ba1:	48 b8 3f 32 80 00 00 	movabs $0x80323f,%rax
+  803ba8:	00 00 00 
+  803bab:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803bad:	48 85 c0             	test   %rax,%rax
+  803bb0:	7e 04                	jle    803bb6 <writebuf+0x32>
+  803bb2:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bb6:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bba:	48 39 c2             	cmp    %rax,%rdx
+  803bbd:	74 0f                	je     803bce <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bbf:	48 85 c0             	test   %rax,%rax
+  803bc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc7:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bcb:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bd2:	c9                   	leave
+  803bd3:	c3                   	ret
+
+0000000000803bd4 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bd4:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bd7:	8d 50 01             	lea    0x1(%rax),%edx
+  803bda:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bdd:	48 98                	cltq
+  803bdf:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803be4:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bea:	74 01                	je     803bed <putch+0x19>
+  803bec:	c3                   	ret
+putch(int ch, void *arg) {
+  803bed:	55                   	push   %rbp
+  803bee:	48 89 e5             	mov    %rsp,%rbp
+  803bf1:	53                   	push   %rbx
+  803bf2:	48 83 ec 08          	sub    $0x8,%rsp
+  803bf6:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bf9:	48 89 f7             	mov    %rsi,%rdi
+  803bfc:	48 b8 84 3b 80 00 00 	movabs $0x803b84,%rax
+  803c03:	00 00 00 
+  803c06:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c08:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c13:	c9                   	leave
+  803c14:	c3                   	ret
+
+0000000000803c15 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c15:	55                   	push   %rbp
+  803c16:	48 89 e5             	mov    %rsp,%rbp
+  803c19:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c20:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c23:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c29:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c30:	00 00 00 
+    state.result = 0;
+  803c33:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c3a:	00 00 00 00 
+    state.error = 1;
+  803c3e:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c45:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c48:	48 89 f2             	mov    %rsi,%rdx
+  803c4b:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c52:	48 bf d4 3b 80 00 00 	movabs $0x803bd4,%rdi
+  803c59:	00 00 00 
+  803c5c:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  803c63:	00 00 00 
+  803c66:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c68:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c6f:	7f 14                	jg     803c85 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c71:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c78:	48 85 c0             	test   %rax,%rax
+  803c7b:	75 06                	jne    803c83 <vfprintf+0x6e>
+  803c7d:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c83:	c9                   	leave
+  803c84:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c85:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c8c:	48 b8 84 3b 80 00 00 	movabs $0x803b84,%rax
+  803c93:	00 00 00 
+  803c96:	ff d0                	call   *%rax
+  803c98:	eb d7                	jmp    803c71 <vfprintf+0x5c>
+
+0000000000803c9a <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c9a:	55                   	push   %rbp
+  803c9b:	48 89 e5             	mov    %rsp,%rbp
+  803c9e:	48 83 ec 50          	sub    $0x50,%rsp
+  803ca2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ca6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803caa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cb2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cb9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cc5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cc9:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ccd:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  803cd4:	00 00 00 
+  803cd7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cd9:	c9                   	leave
+  803cda:	c3                   	ret
+
+0000000000803cdb <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cdb:	55                   	push   %rbp
+  803cdc:	48 89 e5             	mov    %rsp,%rbp
+  803cdf:	48 83 ec 50          	sub    $0x50,%rsp
+  803ce3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ce7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ceb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cf3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cf7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cfe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d06:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d0a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d0e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d12:	48 89 fe             	mov    %rdi,%rsi
+  803d15:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d1a:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  803d21:	00 00 00 
+  803d24:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d26:	c9                   	leave
+  803d27:	c3                   	ret
+
+0000000000803d28 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d28:	55                   	push   %rbp
+  803d29:	48 89 e5             	mov    %rsp,%rbp
+  803d2c:	41 54                	push   %r12
+  803d2e:	53                   	push   %rbx
+  803d2f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d32:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  803d39:	00 00 00 
+  803d3c:	ff d0                	call   *%rax
+  803d3e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d41:	48 be 90 62 80 00 00 	movabs $0x806290,%rsi
+  803d48:	00 00 00 
+  803d4b:	48 89 df             	mov    %rbx,%rdi
+  803d4e:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  803d55:	00 00 00 
+  803d58:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d5a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d5f:	41 2b 04 24          	sub    (%r12),%eax
+  803d63:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d69:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d70:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d73:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d7a:	00 00 00 
+  803d7d:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d89:	5b                   	pop    %rbx
+  803d8a:	41 5c                	pop    %r12
+  803d8c:	5d                   	pop    %rbp
+  803d8d:	c3                   	ret
+
+0000000000803d8e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d8e:	55                   	push   %rbp
+  803d8f:	48 89 e5             	mov    %rsp,%rbp
+  803d92:	41 54                	push   %r12
+  803d94:	53                   	push   %rbx
+  803d95:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d9d:	48 89 fe             	mov    %rdi,%rsi
+  803da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da5:	49 bc 19 28 80 00 00 	movabs $0x802819,%r12
+  803dac:	00 00 00 
+  803daf:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803db2:	48 89 df             	mov    %rbx,%rdi
+  803db5:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  803dbc:	00 00 00 
+  803dbf:	ff d0                	call   *%rax
+  803dc1:	48 89 c6             	mov    %rax,%rsi
+  803dc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dce:	41 ff d4             	call   *%r12
+}
+  803dd1:	5b                   	pop    %rbx
+  803dd2:	41 5c                	pop    %r12
+  803dd4:	5d                   	pop    %rbp
+  803dd5:	c3                   	ret
+
+0000000000803dd6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dd6:	55                   	push   %rbp
+  803dd7:	48 89 e5             	mov    %rsp,%rbp
+  803dda:	41 57                	push   %r15
+  803ddc:	41 56                	push   %r14
+  803dde:	41 55                	push   %r13
+  803de0:	41 54                	push   %r12
+  803de2:	53                   	push   %rbx
+  803de3:	48 83 ec 18          	sub    $0x18,%rsp
+  803de7:	49 89 fc             	mov    %rdi,%r12
+  803dea:	49 89 f5             	mov    %rsi,%r13
+  803ded:	49 89 d7             	mov    %rdx,%r15
+  803df0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803df4:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  803dfb:	00 00 00 
+  803dfe:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e00:	4d 85 ff             	test   %r15,%r15
+  803e03:	0f 84 af 00 00 00    	je     803eb8 <devpipe_write+0xe2>
+  803e09:	48 89 c3             	mov    %rax,%rbx
+  803e0c:	4c 89 f8             	mov    %r15,%rax
+  803e0f:	4d 89 ef             	mov    %r13,%r15
+  803e12:	4c 01 e8             	add    %r13,%rax
+  803e15:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e19:	49 bd 0f 27 80 00 00 	movabs $0x80270f,%r13
+  803e20:	00 00 00 
+            sys_yield();
+  803e23:	49 be a0 26 80 00 00 	movabs $0x8026a0,%r14
+  803e2a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e2d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e30:	48 63 ce             	movslq %esi,%rcx
+  803e33:	48 63 03             	movslq (%rbx),%rax
+  803e36:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e3c:	48 39 c1             	cmp    %rax,%rcx
+  803e3f:	72 2e                	jb     803e6f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e41:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e46:	48 89 da             	mov    %rbx,%rdx
+  803e49:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e4e:	4c 89 e7             	mov    %r12,%rdi
+  803e51:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e54:	85 c0                	test   %eax,%eax
+  803e56:	74 66                	je     803ebe <devpipe_write+0xe8>
+            sys_yield();
+  803e58:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e5b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e5e:	48 63 ce             	movslq %esi,%rcx
+  803e61:	48 63 03             	movslq (%rbx),%rax
+  803e64:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e6a:	48 39 c1             	cmp    %rax,%rcx
+  803e6d:	73 d2                	jae    803e41 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e6f:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e73:	48 89 ca             	mov    %rcx,%rdx
+  803e76:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e7a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e81:	08 10 20 
+  803e84:	48 f7 e2             	mul    %rdx
+  803e87:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e8b:	48 89 d0             	mov    %rdx,%rax
+  803e8e:	48 c1 e0 09          	shl    $0x9,%rax
+  803e92:	48 29 d0             	sub    %rdx,%rax
+  803e95:	48 c1 e0 03          	shl    $0x3,%rax
+  803e99:	48 29 c1             	sub    %rax,%rcx
+  803e9c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ea1:	83 c6 01             	add    $0x1,%esi
+  803ea4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ea7:	49 83 c7 01          	add    $0x1,%r15
+  803eab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eaf:	49 39 c7             	cmp    %rax,%r15
+  803eb2:	0f 85 75 ff ff ff    	jne    803e2d <devpipe_write+0x57>
+    return n;
+  803eb8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ebc:	eb 05                	jmp    803ec3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ec3:	48 83 c4 18          	add    $0x18,%rsp
+  803ec7:	5b                   	pop    %rbx
+  803ec8:	41 5c                	pop    %r12
+  803eca:	41 5d                	pop    %r13
+  803ecc:	41 5e                	pop    %r14
+  803ece:	41 5f                	pop    %r15
+  803ed0:	5d                   	pop    %rbp
+  803ed1:	c3                   	ret
+
+0000000000803ed2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ed2:	55                   	push   %rbp
+  803ed3:	48 89 e5             	mov    %rsp,%rbp
+  803ed6:	41 57                	push   %r15
+  803ed8:	41 56                	push   %r14
+  803eda:	41 55                	push   %r13
+  803edc:	41 54                	push   %r12
+  803ede:	53                   	push   %rbx
+  803edf:	48 83 ec 18          	sub    $0x18,%rsp
+  803ee3:	49 89 fc             	mov    %rdi,%r12
+  803ee6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803eea:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803eee:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  803ef5:	00 00 00 
+  803ef8:	ff d0                	call   *%rax
+  803efa:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803efd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f03:	49 bd 0f 27 80 00 00 	movabs $0x80270f,%r13
+  803f0a:	00 00 00 
+            sys_yield();
+  803f0d:	49 be a0 26 80 00 00 	movabs $0x8026a0,%r14
+  803f14:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f17:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f1c:	74 7d                	je     803f9b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f1e:	8b 03                	mov    (%rbx),%eax
+  803f20:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f23:	75 26                	jne    803f4b <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f25:	4d 85 ff             	test   %r15,%r15
+  803f28:	75 77                	jne    803fa1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f2a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f2f:	48 89 da             	mov    %rbx,%rdx
+  803f32:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f37:	4c 89 e7             	mov    %r12,%rdi
+  803f3a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f3d:	85 c0                	test   %eax,%eax
+  803f3f:	74 72                	je     803fb3 <devpipe_read+0xe1>
+            sys_yield();
+  803f41:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f44:	8b 03                	mov    (%rbx),%eax
+  803f46:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f49:	74 df                	je     803f2a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f4b:	48 63 c8             	movslq %eax,%rcx
+  803f4e:	48 89 ca             	mov    %rcx,%rdx
+  803f51:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f55:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f5c:	08 10 20 
+  803f5f:	48 89 d0             	mov    %rdx,%rax
+  803f62:	48 f7 e6             	mul    %rsi
+  803f65:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f69:	48 89 d0             	mov    %rdx,%rax
+  803f6c:	48 c1 e0 09          	shl    $0x9,%rax
+  803f70:	48 29 d0             	sub    %rdx,%rax
+  803f73:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f7a:	00 
+  803f7b:	48 89 c8             	mov    %rcx,%rax
+  803f7e:	48 29 d0             	sub    %rdx,%rax
+  803f81:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f86:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f8a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f8e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f91:	49 83 c7 01          	add    $0x1,%r15
+  803f95:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f99:	75 83                	jne    803f1e <devpipe_read+0x4c>
+    return n;
+  803f9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f9f:	eb 03                	jmp    803fa4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803fa1:	4c 89 f8             	mov    %r15,%rax
+}
+  803fa4:	48 83 c4 18          	add    $0x18,%rsp
+  803fa8:	5b                   	pop    %rbx
+  803fa9:	41 5c                	pop    %r12
+  803fab:	41 5d                	pop    %r13
+  803fad:	41 5e                	pop    %r14
+  803faf:	41 5f                	pop    %r15
+  803fb1:	5d                   	pop    %rbp
+  803fb2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb8:	eb ea                	jmp    803fa4 <devpipe_read+0xd2>
+
+0000000000803fba <pipe>:
+pipe(int pfd[2]) {
+  803fba:	55                   	push   %rbp
+  803fbb:	48 89 e5             	mov    %rsp,%rbp
+  803fbe:	41 55                	push   %r13
+  803fc0:	41 54                	push   %r12
+  803fc2:	53                   	push   %rbx
+  803fc3:	48 83 ec 18          	sub    $0x18,%rsp
+  803fc7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fce:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  803fd5:	00 00 00 
+  803fd8:	ff d0                	call   *%rax
+  803fda:	89 c3                	mov    %eax,%ebx
+  803fdc:	85 c0                	test   %eax,%eax
+  803fde:	0f 88 a0 01 00 00    	js     804184 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fe4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fe9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fee:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff7:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  803ffe:	00 00 00 
+  804001:	ff d0                	call   *%rax
+  804003:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804005:	85 c0                	test   %eax,%eax
+  804007:	0f 88 77 01 00 00    	js     804184 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80400d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804011:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  804018:	00 00 00 
+  80401b:	ff d0                	call   *%rax
+  80401d:	89 c3                	mov    %eax,%ebx
+  80401f:	85 c0                	test   %eax,%eax
+  804021:	0f 88 43 01 00 00    	js     80416a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804027:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80402c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804031:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804035:	bf 00 00 00 00       	mov    $0x0,%edi
+  80403a:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  804041:	00 00 00 
+  804044:	ff d0                	call   *%rax
+  804046:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804048:	85 c0                	test   %eax,%eax
+  80404a:	0f 88 1a 01 00 00    	js     80416a <pipe+0x1b0>
+    va = fd2data(fd0);
+  804050:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804054:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  80405b:	00 00 00 
+  80405e:	ff d0                	call   *%rax
+  804060:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804063:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804068:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80406d:	48 89 c6             	mov    %rax,%rsi
+  804070:	bf 00 00 00 00       	mov    $0x0,%edi
+  804075:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  80407c:	00 00 00 
+  80407f:	ff d0                	call   *%rax
+  804081:	89 c3                	mov    %eax,%ebx
+  804083:	85 c0                	test   %eax,%eax
+  804085:	0f 88 c5 00 00 00    	js     804150 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80408b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80408f:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  804096:	00 00 00 
+  804099:	ff d0                	call   *%rax
+  80409b:	48 89 c1             	mov    %rax,%rcx
+  80409e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040af:	4c 89 ee             	mov    %r13,%rsi
+  8040b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b7:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  8040be:	00 00 00 
+  8040c1:	ff d0                	call   *%rax
+  8040c3:	89 c3                	mov    %eax,%ebx
+  8040c5:	85 c0                	test   %eax,%eax
+  8040c7:	78 6e                	js     804137 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040c9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ce:	4c 89 ef             	mov    %r13,%rdi
+  8040d1:	48 b8 d7 26 80 00 00 	movabs $0x8026d7,%rax
+  8040d8:	00 00 00 
+  8040db:	ff d0                	call   *%rax
+  8040dd:	83 f8 02             	cmp    $0x2,%eax
+  8040e0:	0f 85 ab 00 00 00    	jne    804191 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040e6:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040ed:	00 00 
+  8040ef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040f5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804100:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804104:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804106:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80410a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804111:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804115:	48 bb 9f 2d 80 00 00 	movabs $0x802d9f,%rbx
+  80411c:	00 00 00 
+  80411f:	ff d3                	call   *%rbx
+  804121:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804125:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804129:	ff d3                	call   *%rbx
+  80412b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804130:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804135:	eb 4d                	jmp    804184 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804137:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80413c:	4c 89 ee             	mov    %r13,%rsi
+  80413f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804144:	48 b8 19 28 80 00 00 	movabs $0x802819,%rax
+  80414b:	00 00 00 
+  80414e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804150:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804155:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804159:	bf 00 00 00 00       	mov    $0x0,%edi
+  80415e:	48 b8 19 28 80 00 00 	movabs $0x802819,%rax
+  804165:	00 00 00 
+  804168:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80416a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80416f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804173:	bf 00 00 00 00       	mov    $0x0,%edi
+  804178:	48 b8 19 28 80 00 00 	movabs $0x802819,%rax
+  80417f:	00 00 00 
+  804182:	ff d0                	call   *%rax
+}
+  804184:	89 d8                	mov    %ebx,%eax
+  804186:	48 83 c4 18          	add    $0x18,%rsp
+  80418a:	5b                   	pop    %rbx
+  80418b:	41 5c                	pop    %r12
+  80418d:	41 5d                	pop    %r13
+  80418f:	5d                   	pop    %rbp
+  804190:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804191:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  804198:	00 00 00 
+  80419b:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8041a2:	00 00 00 
+  8041a5:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041aa:	48 bf 97 62 80 00 00 	movabs $0x806297,%rdi
+  8041b1:	00 00 00 
+  8041b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b9:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  8041c0:	00 00 00 
+  8041c3:	41 ff d0             	call   *%r8
+
+00000000008041c6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041c6:	55                   	push   %rbp
+  8041c7:	48 89 e5             	mov    %rsp,%rbp
+  8041ca:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041ce:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041d2:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  8041d9:	00 00 00 
+  8041dc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041de:	85 c0                	test   %eax,%eax
+  8041e0:	78 35                	js     804217 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041e2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e6:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  8041ed:	00 00 00 
+  8041f0:	ff d0                	call   *%rax
+  8041f2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041f5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804203:	48 b8 0f 27 80 00 00 	movabs $0x80270f,%rax
+  80420a:	00 00 00 
+  80420d:	ff d0                	call   *%rax
+  80420f:	85 c0                	test   %eax,%eax
+  804211:	0f 94 c0             	sete   %al
+  804214:	0f b6 c0             	movzbl %al,%eax
+}
+  804217:	c9                   	leave
+  804218:	c3                   	ret
+
+0000000000804219 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804219:	48 89 f8             	mov    %rdi,%rax
+  80421c:	48 c1 e8 27          	shr    $0x27,%rax
+  804220:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804227:	01 00 00 
+  80422a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80422e:	f6 c2 01             	test   $0x1,%dl
+  804231:	74 6d                	je     8042a0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804233:	48 89 f8             	mov    %rdi,%rax
+  804236:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80423a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804241:	01 00 00 
+  804244:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804248:	f6 c2 01             	test   $0x1,%dl
+  80424b:	74 62                	je     8042af <get_uvpt_entry+0x96>
+  80424d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804254:	01 00 00 
+  804257:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80425b:	f6 c2 80             	test   $0x80,%dl
+  80425e:	75 4f                	jne    8042af <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804260:	48 89 f8             	mov    %rdi,%rax
+  804263:	48 c1 e8 15          	shr    $0x15,%rax
+  804267:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80426e:	01 00 00 
+  804271:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804275:	f6 c2 01             	test   $0x1,%dl
+  804278:	74 44                	je     8042be <get_uvpt_entry+0xa5>
+  80427a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804281:	01 00 00 
+  804284:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804288:	f6 c2 80             	test   $0x80,%dl
+  80428b:	75 31                	jne    8042be <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80428d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804291:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804298:	01 00 00 
+  80429b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80429f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042a0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042a7:	01 00 00 
+  8042aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ae:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042af:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042b6:	01 00 00 
+  8042b9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042bd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042be:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042c5:	01 00 00 
+  8042c8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042cc:	c3                   	ret
+
+00000000008042cd <get_prot>:
+
+int
+get_prot(void *va) {
+  8042cd:	55                   	push   %rbp
+  8042ce:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042d1:	48 b8 19 42 80 00 00 	movabs $0x804219,%rax
+  8042d8:	00 00 00 
+  8042db:	ff d0                	call   *%rax
+  8042dd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042e0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042e5:	89 c1                	mov    %eax,%ecx
+  8042e7:	83 c9 04             	or     $0x4,%ecx
+  8042ea:	f6 c2 01             	test   $0x1,%dl
+  8042ed:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042f0:	89 c1                	mov    %eax,%ecx
+  8042f2:	83 c9 02             	or     $0x2,%ecx
+  8042f5:	f6 c2 02             	test   $0x2,%dl
+  8042f8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042fb:	89 c1                	mov    %eax,%ecx
+  8042fd:	83 c9 01             	or     $0x1,%ecx
+  804300:	48 85 d2             	test   %rdx,%rdx
+  804303:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804306:	89 c1                	mov    %eax,%ecx
+  804308:	83 c9 40             	or     $0x40,%ecx
+  80430b:	f6 c6 04             	test   $0x4,%dh
+  80430e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804311:	5d                   	pop    %rbp
+  804312:	c3                   	ret
+
+0000000000804313 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804313:	55                   	push   %rbp
+  804314:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804317:	48 b8 19 42 80 00 00 	movabs $0x804219,%rax
+  80431e:	00 00 00 
+  804321:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804323:	48 c1 e8 06          	shr    $0x6,%rax
+  804327:	83 e0 01             	and    $0x1,%eax
+}
+  80432a:	5d                   	pop    %rbp
+  80432b:	c3                   	ret
+
+000000000080432c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80432c:	55                   	push   %rbp
+  80432d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804330:	48 b8 19 42 80 00 00 	movabs $0x804219,%rax
+  804337:	00 00 00 
+  80433a:	ff d0                	call   *%rax
+  80433c:	83 e0 01             	and    $0x1,%eax
+}
+  80433f:	5d                   	pop    %rbp
+  804340:	c3                   	ret
+
+0000000000804341 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804341:	55                   	push   %rbp
+  804342:	48 89 e5             	mov    %rsp,%rbp
+  804345:	41 57                	push   %r15
+  804347:	41 56                	push   %r14
+  804349:	41 55                	push   %r13
+  80434b:	41 54                	push   %r12
+  80434d:	53                   	push   %rbx
+  80434e:	48 83 ec 28          	sub    $0x28,%rsp
+  804352:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804356:	48 85 ff             	test   %rdi,%rdi
+  804359:	74 1e                	je     804379 <foreach_shared_region+0x38>
+  80435b:	49 89 ff             	mov    %rdi,%r15
+  80435e:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804364:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80436a:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804371:	01 00 00 
+  804374:	e9 72 02 00 00       	jmp    8045eb <foreach_shared_region+0x2aa>
+    assert(fun);
+  804379:	48 b9 cc 62 80 00 00 	movabs $0x8062cc,%rcx
+  804380:	00 00 00 
+  804383:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80438a:	00 00 00 
+  80438d:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804392:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  804399:	00 00 00 
+  80439c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a1:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  8043a8:	00 00 00 
+  8043ab:	41 ff d0             	call   *%r8
+  8043ae:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043b5:	eb 6c                	jmp    804423 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043b7:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043be:	ff ff ff 
+  8043c1:	4c 21 e2             	and    %r12,%rdx
+  8043c4:	48 89 d8             	mov    %rbx,%rax
+  8043c7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043cc:	48 83 c0 01          	add    $0x1,%rax
+  8043d0:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043d4:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043db:	00 00 00 
+  8043de:	48 21 c8             	and    %rcx,%rax
+  8043e1:	48 09 d0             	or     %rdx,%rax
+  8043e4:	49 89 c4             	mov    %rax,%r12
+  8043e7:	eb 30                	jmp    804419 <foreach_shared_region+0xd8>
+  8043e9:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043f0:	ff ff ff 
+  8043f3:	4c 21 e2             	and    %r12,%rdx
+  8043f6:	48 89 d8             	mov    %rbx,%rax
+  8043f9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043fe:	48 83 c0 01          	add    $0x1,%rax
+  804402:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804406:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80440d:	00 00 00 
+  804410:	48 21 c8             	and    %rcx,%rax
+  804413:	48 09 d0             	or     %rdx,%rax
+  804416:	49 89 c4             	mov    %rax,%r12
+  804419:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80441d:	0f 84 99 01 00 00    	je     8045bc <foreach_shared_region+0x27b>
+  804423:	4c 89 e3             	mov    %r12,%rbx
+  804426:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80442a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804431:	01 00 00 
+  804434:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804438:	a8 01                	test   $0x1,%al
+  80443a:	0f 84 77 ff ff ff    	je     8043b7 <foreach_shared_region+0x76>
+  804440:	a8 80                	test   $0x80,%al
+  804442:	74 19                	je     80445d <foreach_shared_region+0x11c>
+  804444:	f6 c4 04             	test   $0x4,%ah
+  804447:	74 a0                	je     8043e9 <foreach_shared_region+0xa8>
+  804449:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804450:	40 
+  804451:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804455:	4c 89 e7             	mov    %r12,%rdi
+  804458:	41 ff d7             	call   *%r15
+  80445b:	eb 8c                	jmp    8043e9 <foreach_shared_region+0xa8>
+  80445d:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804464:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804468:	eb 46                	jmp    8044b0 <foreach_shared_region+0x16f>
+  80446a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804471:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804477:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80447b:	48 c1 e0 15          	shl    $0x15,%rax
+  80447f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804484:	49 09 c4             	or     %rax,%r12
+  804487:	eb 1d                	jmp    8044a6 <foreach_shared_region+0x165>
+  804489:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804490:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804496:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80449a:	48 c1 e0 15          	shl    $0x15,%rax
+  80449e:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8044a3:	49 09 c4             	or     %rax,%r12
+  8044a6:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044aa:	0f 84 d3 00 00 00    	je     804583 <foreach_shared_region+0x242>
+  8044b0:	4c 89 e3             	mov    %r12,%rbx
+  8044b3:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044b7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044be:	01 00 00 
+  8044c1:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044c5:	a8 01                	test   $0x1,%al
+  8044c7:	74 a1                	je     80446a <foreach_shared_region+0x129>
+  8044c9:	a8 80                	test   $0x80,%al
+  8044cb:	74 19                	je     8044e6 <foreach_shared_region+0x1a5>
+  8044cd:	f6 c4 04             	test   $0x4,%ah
+  8044d0:	74 b7                	je     804489 <foreach_shared_region+0x148>
+  8044d2:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044d9:	00 
+  8044da:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044de:	4c 89 e7             	mov    %r12,%rdi
+  8044e1:	41 ff d7             	call   *%r15
+  8044e4:	eb a3                	jmp    804489 <foreach_shared_region+0x148>
+  8044e6:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044ec:	eb 3b                	jmp    804529 <foreach_shared_region+0x1e8>
+  8044ee:	f6 c4 04             	test   $0x4,%ah
+  8044f1:	74 12                	je     804505 <foreach_shared_region+0x1c4>
+  8044f3:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044fa:	00 
+  8044fb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044ff:	4c 89 e7             	mov    %r12,%rdi
+  804502:	41 ff d7             	call   *%r15
+  804505:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80450c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804512:	48 83 c3 01          	add    $0x1,%rbx
+  804516:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80451a:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804520:	49 09 dc             	or     %rbx,%r12
+  804523:	41 83 ed 01          	sub    $0x1,%r13d
+  804527:	74 2f                	je     804558 <foreach_shared_region+0x217>
+  804529:	4c 89 e3             	mov    %r12,%rbx
+  80452c:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804530:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804534:	a8 01                	test   $0x1,%al
+  804536:	75 b6                	jne    8044ee <foreach_shared_region+0x1ad>
+  804538:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80453f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804545:	48 83 c3 01          	add    $0x1,%rbx
+  804549:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80454d:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804553:	49 09 dc             	or     %rbx,%r12
+  804556:	eb cb                	jmp    804523 <foreach_shared_region+0x1e2>
+  804558:	4c 89 e0             	mov    %r12,%rax
+  80455b:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804561:	49 c1 ec 15          	shr    $0x15,%r12
+  804565:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80456c:	49 83 c4 01          	add    $0x1,%r12
+  804570:	49 c1 e4 15          	shl    $0x15,%r12
+  804574:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80457b:	49 09 c4             	or     %rax,%r12
+  80457e:	e9 23 ff ff ff       	jmp    8044a6 <foreach_shared_region+0x165>
+  804583:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804587:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80458e:	ff ff ff 
+  804591:	4c 21 e0             	and    %r12,%rax
+  804594:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804598:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80459f:	49 83 c4 01          	add    $0x1,%r12
+  8045a3:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045a7:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045ae:	00 00 00 
+  8045b1:	49 21 d4             	and    %rdx,%r12
+  8045b4:	49 09 c4             	or     %rax,%r12
+  8045b7:	e9 5d fe ff ff       	jmp    804419 <foreach_shared_region+0xd8>
+  8045bc:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045c3:	00 ff ff 
+  8045c6:	4c 21 e0             	and    %r12,%rax
+  8045c9:	49 c1 ec 27          	shr    $0x27,%r12
+  8045cd:	49 83 c4 01          	add    $0x1,%r12
+  8045d1:	49 c1 e4 27          	shl    $0x27,%r12
+  8045d5:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045dc:	ff 00 00 
+  8045df:	49 21 d4             	and    %rdx,%r12
+  8045e2:	49 09 c4             	or     %rax,%r12
+  8045e5:	41 83 ed 01          	sub    $0x1,%r13d
+  8045e9:	74 48                	je     804633 <foreach_shared_region+0x2f2>
+  8045eb:	4c 89 e0             	mov    %r12,%rax
+  8045ee:	48 c1 e8 27          	shr    $0x27,%rax
+  8045f2:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045f9:	01 00 00 
+  8045fc:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804600:	f6 c2 01             	test   $0x1,%dl
+  804603:	0f 85 a5 fd ff ff    	jne    8043ae <foreach_shared_region+0x6d>
+  804609:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804610:	00 ff ff 
+  804613:	4c 21 e2             	and    %r12,%rdx
+  804616:	48 83 c0 01          	add    $0x1,%rax
+  80461a:	48 c1 e0 27          	shl    $0x27,%rax
+  80461e:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804625:	ff 00 00 
+  804628:	48 21 c8             	and    %rcx,%rax
+  80462b:	48 09 d0             	or     %rdx,%rax
+  80462e:	49 89 c4             	mov    %rax,%r12
+  804631:	eb b2                	jmp    8045e5 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804633:	4d 85 e4             	test   %r12,%r12
+  804636:	75 14                	jne    80464c <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463d:	48 83 c4 28          	add    $0x28,%rsp
+  804641:	5b                   	pop    %rbx
+  804642:	41 5c                	pop    %r12
+  804644:	41 5d                	pop    %r13
+  804646:	41 5e                	pop    %r14
+  804648:	41 5f                	pop    %r15
+  80464a:	5d                   	pop    %rbp
+  80464b:	c3                   	ret
+    assert(addr == 0);
+  80464c:	48 b9 db 62 80 00 00 	movabs $0x8062db,%rcx
+  804653:	00 00 00 
+  804656:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80465d:	00 00 00 
+  804660:	be 67 00 00 00       	mov    $0x67,%esi
+  804665:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  80466c:	00 00 00 
+  80466f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804674:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  80467b:	00 00 00 
+  80467e:	41 ff d0             	call   *%r8
+
+0000000000804681 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804681:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804688:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80468b:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804691:	eb 33                	jmp    8046c6 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804693:	48 83 c0 20          	add    $0x20,%rax
+  804697:	4c 39 c0             	cmp    %r8,%rax
+  80469a:	74 25                	je     8046c1 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80469c:	48 8b 10             	mov    (%rax),%rdx
+  80469f:	48 85 d2             	test   %rdx,%rdx
+  8046a2:	74 ef                	je     804693 <mmap_place+0x12>
+  8046a4:	48 89 d1             	mov    %rdx,%rcx
+  8046a7:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046ab:	48 39 cf             	cmp    %rcx,%rdi
+  8046ae:	73 e3                	jae    804693 <mmap_place+0x12>
+  8046b0:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046b4:	4c 39 ca             	cmp    %r9,%rdx
+  8046b7:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046bb:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046bf:	eb d2                	jmp    804693 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046c1:	45 84 d2             	test   %r10b,%r10b
+  8046c4:	74 12                	je     8046d8 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046c6:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046cd:	00 00 00 
+        moved = 0;
+  8046d0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046d6:	eb c4                	jmp    80469c <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046d8:	48 01 fe             	add    %rdi,%rsi
+  8046db:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046e2:	00 00 00 
+  8046e5:	48 39 f0             	cmp    %rsi,%rax
+  8046e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ed:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046f1:	c3                   	ret
+
+00000000008046f2 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046f2:	55                   	push   %rbp
+  8046f3:	48 89 e5             	mov    %rsp,%rbp
+  8046f6:	41 57                	push   %r15
+  8046f8:	41 56                	push   %r14
+  8046fa:	41 55                	push   %r13
+  8046fc:	41 54                	push   %r12
+  8046fe:	53                   	push   %rbx
+  8046ff:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804703:	48 8b 1f             	mov    (%rdi),%rbx
+  804706:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80470d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804714:	00 00 00 
+  804717:	ba 00 00 00 00       	mov    $0x0,%edx
+  80471c:	eb 12                	jmp    804730 <mmap_pgfault+0x3e>
+  80471e:	48 83 c2 01          	add    $0x1,%rdx
+  804722:	48 83 c0 20          	add    $0x20,%rax
+  804726:	48 83 fa 20          	cmp    $0x20,%rdx
+  80472a:	0f 84 04 01 00 00    	je     804834 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804730:	48 8b 08             	mov    (%rax),%rcx
+  804733:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804737:	48 39 de             	cmp    %rbx,%rsi
+  80473a:	73 e2                	jae    80471e <mmap_pgfault+0x2c>
+  80473c:	48 03 48 08          	add    0x8(%rax),%rcx
+  804740:	48 39 cb             	cmp    %rcx,%rbx
+  804743:	73 d9                	jae    80471e <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804745:	48 c1 e2 05          	shl    $0x5,%rdx
+  804749:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804750:	00 00 00 
+  804753:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804757:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80475b:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80475f:	f6 c2 01             	test   $0x1,%dl
+  804762:	0f 84 e0 00 00 00    	je     804848 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80476d:	f6 c2 02             	test   $0x2,%dl
+  804770:	0f 84 c3 00 00 00    	je     804839 <mmap_pgfault+0x147>
+  804776:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80477d:	ff ff ff 
+  804780:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804784:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80478b:	00 00 00 
+  80478e:	48 39 ca             	cmp    %rcx,%rdx
+  804791:	0f 85 a2 00 00 00    	jne    804839 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804797:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80479c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a1:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047a8:	00 00 00 
+  8047ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047b0:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  8047b7:	00 00 00 
+  8047ba:	ff d0                	call   *%rax
+  8047bc:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c3:	85 d2                	test   %edx,%edx
+  8047c5:	78 72                	js     804839 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047cc:	48 89 de             	mov    %rbx,%rsi
+  8047cf:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047d6:	00 00 00 
+  8047d9:	4c 89 e7             	mov    %r12,%rdi
+  8047dc:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  8047e3:	00 00 00 
+  8047e6:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047e8:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047ee:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047f4:	48 89 d9             	mov    %rbx,%rcx
+  8047f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047fc:	4c 89 e6             	mov    %r12,%rsi
+  8047ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  804804:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  80480b:	00 00 00 
+  80480e:	ff d0                	call   *%rax
+  804810:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804812:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804817:	4c 89 e6             	mov    %r12,%rsi
+  80481a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80481f:	48 b8 19 28 80 00 00 	movabs $0x802819,%rax
+  804826:	00 00 00 
+  804829:	ff d0                	call   *%rax
+    return res >= 0;
+  80482b:	89 d8                	mov    %ebx,%eax
+  80482d:	f7 d0                	not    %eax
+  80482f:	c1 e8 1f             	shr    $0x1f,%eax
+  804832:	eb 05                	jmp    804839 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804834:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804839:	48 83 c4 18          	add    $0x18,%rsp
+  80483d:	5b                   	pop    %rbx
+  80483e:	41 5c                	pop    %r12
+  804840:	41 5d                	pop    %r13
+  804842:	41 5e                	pop    %r14
+  804844:	41 5f                	pop    %r15
+  804846:	5d                   	pop    %rbp
+  804847:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804848:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80484c:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804850:	4c 03 30             	add    (%rax),%r14
+  804853:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80485a:	49 39 c6             	cmp    %rax,%r14
+  80485d:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804861:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804868:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80486e:	49 bf 2c 43 80 00 00 	movabs $0x80432c,%r15
+  804875:	00 00 00 
+  804878:	4d 39 f4             	cmp    %r14,%r12
+  80487b:	73 1d                	jae    80489a <mmap_pgfault+0x1a8>
+  80487d:	4c 89 e7             	mov    %r12,%rdi
+  804880:	41 ff d7             	call   *%r15
+  804883:	84 c0                	test   %al,%al
+  804885:	75 13                	jne    80489a <mmap_pgfault+0x1a8>
+  804887:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80488e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804895:	4d 39 f4             	cmp    %r14,%r12
+  804898:	72 e3                	jb     80487d <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80489a:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8048a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a4:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048a8:	74 2a                	je     8048d4 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048ae:	89 de                	mov    %ebx,%esi
+  8048b0:	2b 30                	sub    (%rax),%esi
+  8048b2:	03 70 1c             	add    0x1c(%rax),%esi
+  8048b5:	8b 78 18             	mov    0x18(%rax),%edi
+  8048b8:	4c 89 e9             	mov    %r13,%rcx
+  8048bb:	48 89 da             	mov    %rbx,%rdx
+  8048be:	48 b8 8a 3a 80 00 00 	movabs $0x803a8a,%rax
+  8048c5:	00 00 00 
+  8048c8:	ff d0                	call   *%rax
+    return res > 0;
+  8048ca:	85 c0                	test   %eax,%eax
+  8048cc:	0f 9f c0             	setg   %al
+  8048cf:	e9 65 ff ff ff       	jmp    804839 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048d4:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048d8:	eb d0                	jmp    8048aa <mmap_pgfault+0x1b8>
+
+00000000008048da <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048da:	55                   	push   %rbp
+  8048db:	48 89 e5             	mov    %rsp,%rbp
+  8048de:	41 57                	push   %r15
+  8048e0:	41 56                	push   %r14
+  8048e2:	41 55                	push   %r13
+  8048e4:	41 54                	push   %r12
+  8048e6:	53                   	push   %rbx
+  8048e7:	48 83 ec 28          	sub    $0x28,%rsp
+  8048eb:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048ef:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048f2:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048f9:	ff ff ff 
+  8048fc:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804900:	b8 00 00 00 00       	mov    $0x0,%eax
+  804905:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80490c:	00 00 00 
+  80490f:	48 39 ca             	cmp    %rcx,%rdx
+  804912:	0f 85 e5 00 00 00    	jne    8049fd <mmap_writeback+0x123>
+  804918:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80491b:	4c 39 ee             	cmp    %r13,%rsi
+  80491e:	0f 83 e8 00 00 00    	jae    804a0c <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804924:	49 be 2c 43 80 00 00 	movabs $0x80432c,%r14
+  80492b:	00 00 00 
+  80492e:	49 bf 13 43 80 00 00 	movabs $0x804313,%r15
+  804935:	00 00 00 
+  804938:	eb 10                	jmp    80494a <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80493a:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804941:	4d 39 ec             	cmp    %r13,%r12
+  804944:	0f 83 ae 00 00 00    	jae    8049f8 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80494a:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80494e:	4c 89 e7             	mov    %r12,%rdi
+  804951:	41 ff d6             	call   *%r14
+  804954:	84 c0                	test   %al,%al
+  804956:	74 e2                	je     80493a <mmap_writeback+0x60>
+  804958:	4c 89 e7             	mov    %r12,%rdi
+  80495b:	41 ff d7             	call   *%r15
+  80495e:	84 c0                	test   %al,%al
+  804960:	74 d8                	je     80493a <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804962:	4c 89 e3             	mov    %r12,%rbx
+  804965:	4d 39 ec             	cmp    %r13,%r12
+  804968:	73 20                	jae    80498a <mmap_writeback+0xb0>
+  80496a:	48 89 df             	mov    %rbx,%rdi
+  80496d:	41 ff d6             	call   *%r14
+  804970:	84 c0                	test   %al,%al
+  804972:	74 16                	je     80498a <mmap_writeback+0xb0>
+  804974:	48 89 df             	mov    %rbx,%rdi
+  804977:	41 ff d7             	call   *%r15
+  80497a:	84 c0                	test   %al,%al
+  80497c:	74 0c                	je     80498a <mmap_writeback+0xb0>
+  80497e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804985:	4c 39 eb             	cmp    %r13,%rbx
+  804988:	72 e0                	jb     80496a <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80498a:	48 89 d9             	mov    %rbx,%rcx
+  80498d:	4c 29 e1             	sub    %r12,%rcx
+  804990:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804994:	44 89 e6             	mov    %r12d,%esi
+  804997:	2b 30                	sub    (%rax),%esi
+  804999:	49 89 c4             	mov    %rax,%r12
+  80499c:	03 70 1c             	add    0x1c(%rax),%esi
+  80499f:	8b 78 18             	mov    0x18(%rax),%edi
+  8049a2:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049a6:	48 89 ca             	mov    %rcx,%rdx
+  8049a9:	48 b8 13 3b 80 00 00 	movabs $0x803b13,%rax
+  8049b0:	00 00 00 
+  8049b3:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049b5:	85 c0                	test   %eax,%eax
+  8049b7:	78 44                	js     8049fd <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049b9:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049be:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049c1:	41 89 c1             	mov    %eax,%r9d
+  8049c4:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049cb:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049cf:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d8:	48 89 ce             	mov    %rcx,%rsi
+  8049db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049e0:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  8049e7:	00 00 00 
+  8049ea:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049ec:	85 c0                	test   %eax,%eax
+  8049ee:	78 0d                	js     8049fd <mmap_writeback+0x123>
+  8049f0:	49 89 dc             	mov    %rbx,%r12
+  8049f3:	e9 49 ff ff ff       	jmp    804941 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049fd:	48 83 c4 28          	add    $0x28,%rsp
+  804a01:	5b                   	pop    %rbx
+  804a02:	41 5c                	pop    %r12
+  804a04:	41 5d                	pop    %r13
+  804a06:	41 5e                	pop    %r14
+  804a08:	41 5f                	pop    %r15
+  804a0a:	5d                   	pop    %rbp
+  804a0b:	c3                   	ret
+    return 0;
+  804a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a11:	eb ea                	jmp    8049fd <mmap_writeback+0x123>
+
+0000000000804a13 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a13:	55                   	push   %rbp
+  804a14:	48 89 e5             	mov    %rsp,%rbp
+  804a17:	41 57                	push   %r15
+  804a19:	41 56                	push   %r14
+  804a1b:	41 55                	push   %r13
+  804a1d:	41 54                	push   %r12
+  804a1f:	53                   	push   %rbx
+  804a20:	48 83 ec 38          	sub    $0x38,%rsp
+  804a24:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a28:	48 85 f6             	test   %rsi,%rsi
+  804a2b:	0f 84 0c 02 00 00    	je     804c3d <mmap+0x22a>
+  804a31:	49 89 ff             	mov    %rdi,%r15
+  804a34:	49 89 f4             	mov    %rsi,%r12
+  804a37:	41 89 d5             	mov    %edx,%r13d
+  804a3a:	41 89 ce             	mov    %ecx,%r14d
+  804a3d:	44 89 cb             	mov    %r9d,%ebx
+  804a40:	45 85 c9             	test   %r9d,%r9d
+  804a43:	0f 88 f4 01 00 00    	js     804c3d <mmap+0x22a>
+  804a49:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a50:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a57:	0f 85 e7 01 00 00    	jne    804c44 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a5d:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a60:	83 fa 04             	cmp    $0x4,%edx
+  804a63:	0f 85 db 01 00 00    	jne    804c44 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a69:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a6c:	83 fa 01             	cmp    $0x1,%edx
+  804a6f:	0f 87 cf 01 00 00    	ja     804c44 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a75:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a79:	44 89 c7             	mov    %r8d,%edi
+  804a7c:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  804a83:	00 00 00 
+  804a86:	ff d0                	call   *%rax
+  804a88:	89 c2                	mov    %eax,%edx
+  804a8a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a91:	85 d2                	test   %edx,%edx
+  804a93:	0f 88 ab 01 00 00    	js     804c44 <mmap+0x231>
+  804a99:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a9d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804aa4:	00 00 00 
+  804aa7:	8b 09                	mov    (%rcx),%ecx
+  804aa9:	39 0a                	cmp    %ecx,(%rdx)
+  804aab:	0f 85 93 01 00 00    	jne    804c44 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804ab1:	8b 52 08             	mov    0x8(%rdx),%edx
+  804ab4:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ab7:	83 fa 01             	cmp    $0x1,%edx
+  804aba:	0f 84 84 01 00 00    	je     804c44 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ac0:	41 83 fe 01          	cmp    $0x1,%r14d
+  804ac4:	74 42                	je     804b08 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ac6:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804acd:	4c 89 e6             	mov    %r12,%rsi
+  804ad0:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ad7:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804adb:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804adf:	4d 85 ff             	test   %r15,%r15
+  804ae2:	74 67                	je     804b4b <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ae4:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804aeb:	75 0f                	jne    804afc <mmap+0xe9>
+  804aed:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804af4:	00 00 00 
+  804af7:	49 39 c7             	cmp    %rax,%r15
+  804afa:	77 1b                	ja     804b17 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804afc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b03:	e9 3c 01 00 00       	jmp    804c44 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b08:	41 f6 c5 02          	test   $0x2,%r13b
+  804b0c:	74 b8                	je     804ac6 <mmap+0xb3>
+  804b0e:	85 d2                	test   %edx,%edx
+  804b10:	75 b4                	jne    804ac6 <mmap+0xb3>
+  804b12:	e9 2d 01 00 00       	jmp    804c44 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b17:	4c 89 ff             	mov    %r15,%rdi
+  804b1a:	48 b8 81 46 80 00 00 	movabs $0x804681,%rax
+  804b21:	00 00 00 
+  804b24:	ff d0                	call   *%rax
+  804b26:	48 89 c2             	mov    %rax,%rdx
+  804b29:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b30:	49 39 d7             	cmp    %rdx,%r15
+  804b33:	0f 85 0b 01 00 00    	jne    804c44 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b39:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b40:	00 00 00 
+  804b43:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b49:	eb 44                	jmp    804b8f <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b4b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b4f:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b56:	00 00 00 
+  804b59:	48 b8 81 46 80 00 00 	movabs $0x804681,%rax
+  804b60:	00 00 00 
+  804b63:	ff d0                	call   *%rax
+  804b65:	48 89 c7             	mov    %rax,%rdi
+  804b68:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b6c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b73:	48 85 ff             	test   %rdi,%rdi
+  804b76:	75 c1                	jne    804b39 <mmap+0x126>
+  804b78:	e9 c7 00 00 00       	jmp    804c44 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b7d:	49 83 c4 01          	add    $0x1,%r12
+  804b81:	48 83 c0 20          	add    $0x20,%rax
+  804b85:	49 83 fc 20          	cmp    $0x20,%r12
+  804b89:	0f 84 a5 00 00 00    	je     804c34 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b8f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b93:	75 e8                	jne    804b7d <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b95:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b99:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  804ba0:	00 00 00 
+  804ba3:	ff d0                	call   *%rax
+  804ba5:	89 c2                	mov    %eax,%edx
+  804ba7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bae:	85 d2                	test   %edx,%edx
+  804bb0:	0f 88 8e 00 00 00    	js     804c44 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bb6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bba:	48 b8 9f 2d 80 00 00 	movabs $0x802d9f,%rax
+  804bc1:	00 00 00 
+  804bc4:	ff d0                	call   *%rax
+  804bc6:	89 c6                	mov    %eax,%esi
+  804bc8:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bcb:	48 b8 ed 2f 80 00 00 	movabs $0x802fed,%rax
+  804bd2:	00 00 00 
+  804bd5:	ff d0                	call   *%rax
+  804bd7:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bda:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804be1:	45 85 ff             	test   %r15d,%r15d
+  804be4:	78 5e                	js     804c44 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804be6:	49 c1 e4 05          	shl    $0x5,%r12
+  804bea:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bf1:	00 00 00 
+  804bf4:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bf7:	48 bf f2 46 80 00 00 	movabs $0x8046f2,%rdi
+  804bfe:	00 00 00 
+  804c01:	48 b8 c0 51 80 00 00 	movabs $0x8051c0,%rax
+  804c08:	00 00 00 
+  804c0b:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c0d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c11:	49 89 04 24          	mov    %rax,(%r12)
+  804c15:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c19:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c1e:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c23:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c28:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c2d:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c32:	eb 10                	jmp    804c44 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c34:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c3b:	eb 07                	jmp    804c44 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c3d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c44:	48 83 c4 38          	add    $0x38,%rsp
+  804c48:	5b                   	pop    %rbx
+  804c49:	41 5c                	pop    %r12
+  804c4b:	41 5d                	pop    %r13
+  804c4d:	41 5e                	pop    %r14
+  804c4f:	41 5f                	pop    %r15
+  804c51:	5d                   	pop    %rbp
+  804c52:	c3                   	ret
+
+0000000000804c53 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c53:	55                   	push   %rbp
+  804c54:	48 89 e5             	mov    %rsp,%rbp
+  804c57:	41 57                	push   %r15
+  804c59:	41 56                	push   %r14
+  804c5b:	41 55                	push   %r13
+  804c5d:	41 54                	push   %r12
+  804c5f:	53                   	push   %rbx
+  804c60:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c64:	49 89 fe             	mov    %rdi,%r14
+  804c67:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c6e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c75:	00 
+  804c76:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c7d:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c84:	00 00 00 
+  804c87:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c8e:	49 bf da 48 80 00 00 	movabs $0x8048da,%r15
+  804c95:	00 00 00 
+  804c98:	eb 09                	jmp    804ca3 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c9a:	48 83 c3 20          	add    $0x20,%rbx
+  804c9e:	4c 39 eb             	cmp    %r13,%rbx
+  804ca1:	74 33                	je     804cd6 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ca3:	48 89 df             	mov    %rbx,%rdi
+  804ca6:	48 8b 33             	mov    (%rbx),%rsi
+  804ca9:	4c 39 e6             	cmp    %r12,%rsi
+  804cac:	73 ec                	jae    804c9a <msync+0x47>
+  804cae:	48 85 f6             	test   %rsi,%rsi
+  804cb1:	74 e7                	je     804c9a <msync+0x47>
+  804cb3:	48 89 f2             	mov    %rsi,%rdx
+  804cb6:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cba:	49 39 d6             	cmp    %rdx,%r14
+  804cbd:	73 db                	jae    804c9a <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cbf:	4c 39 e2             	cmp    %r12,%rdx
+  804cc2:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cc6:	4c 39 f6             	cmp    %r14,%rsi
+  804cc9:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ccd:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804cd0:	85 c0                	test   %eax,%eax
+  804cd2:	79 c6                	jns    804c9a <msync+0x47>
+  804cd4:	eb 05                	jmp    804cdb <msync+0x88>
+    }
+
+    return 0;
+  804cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cdb:	48 83 c4 08          	add    $0x8,%rsp
+  804cdf:	5b                   	pop    %rbx
+  804ce0:	41 5c                	pop    %r12
+  804ce2:	41 5d                	pop    %r13
+  804ce4:	41 5e                	pop    %r14
+  804ce6:	41 5f                	pop    %r15
+  804ce8:	5d                   	pop    %rbp
+  804ce9:	c3                   	ret
+
+0000000000804cea <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cea:	55                   	push   %rbp
+  804ceb:	48 89 e5             	mov    %rsp,%rbp
+  804cee:	41 57                	push   %r15
+  804cf0:	41 56                	push   %r14
+  804cf2:	41 55                	push   %r13
+  804cf4:	41 54                	push   %r12
+  804cf6:	53                   	push   %rbx
+  804cf7:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cfb:	49 89 ff             	mov    %rdi,%r15
+  804cfe:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d05:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d0c:	00 
+  804d0d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d14:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d1b:	00 00 00 
+  804d1e:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d25:	48 89 d8             	mov    %rbx,%rax
+  804d28:	eb 09                	jmp    804d33 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d2a:	48 83 c0 20          	add    $0x20,%rax
+  804d2e:	4c 39 f0             	cmp    %r14,%rax
+  804d31:	74 40                	je     804d73 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d33:	48 8b 10             	mov    (%rax),%rdx
+  804d36:	4c 39 e2             	cmp    %r12,%rdx
+  804d39:	73 ef                	jae    804d2a <munmap+0x40>
+  804d3b:	48 85 d2             	test   %rdx,%rdx
+  804d3e:	74 ea                	je     804d2a <munmap+0x40>
+  804d40:	48 89 d7             	mov    %rdx,%rdi
+  804d43:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d47:	49 39 ff             	cmp    %rdi,%r15
+  804d4a:	73 de                	jae    804d2a <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d4c:	49 39 fc             	cmp    %rdi,%r12
+  804d4f:	72 05                	jb     804d56 <munmap+0x6c>
+  804d51:	4c 39 fa             	cmp    %r15,%rdx
+  804d54:	73 d4                	jae    804d2a <munmap+0x40>
+  804d56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d5b:	48 83 c4 08          	add    $0x8,%rsp
+  804d5f:	5b                   	pop    %rbx
+  804d60:	41 5c                	pop    %r12
+  804d62:	41 5d                	pop    %r13
+  804d64:	41 5e                	pop    %r14
+  804d66:	41 5f                	pop    %r15
+  804d68:	5d                   	pop    %rbp
+  804d69:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d6a:	48 83 c3 20          	add    $0x20,%rbx
+  804d6e:	4c 39 f3             	cmp    %r14,%rbx
+  804d71:	74 5c                	je     804dcf <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d73:	48 8b 33             	mov    (%rbx),%rsi
+  804d76:	4c 39 e6             	cmp    %r12,%rsi
+  804d79:	73 ef                	jae    804d6a <munmap+0x80>
+  804d7b:	48 85 f6             	test   %rsi,%rsi
+  804d7e:	74 ea                	je     804d6a <munmap+0x80>
+  804d80:	48 89 f2             	mov    %rsi,%rdx
+  804d83:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d87:	49 39 d7             	cmp    %rdx,%r15
+  804d8a:	73 de                	jae    804d6a <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d8c:	48 89 df             	mov    %rbx,%rdi
+  804d8f:	48 b8 da 48 80 00 00 	movabs $0x8048da,%rax
+  804d96:	00 00 00 
+  804d99:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d9b:	85 c0                	test   %eax,%eax
+  804d9d:	78 bc                	js     804d5b <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d9f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804da3:	48 8b 33             	mov    (%rbx),%rsi
+  804da6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dab:	48 b8 19 28 80 00 00 	movabs $0x802819,%rax
+  804db2:	00 00 00 
+  804db5:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804db7:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804dba:	48 b8 92 2f 80 00 00 	movabs $0x802f92,%rax
+  804dc1:	00 00 00 
+  804dc4:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dc6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dcd:	eb 9b                	jmp    804d6a <munmap+0x80>
+    return 0;
+  804dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd4:	eb 85                	jmp    804d5b <munmap+0x71>
+
+0000000000804dd6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ddb:	c3                   	ret
+
+0000000000804ddc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804ddc:	55                   	push   %rbp
+  804ddd:	48 89 e5             	mov    %rsp,%rbp
+  804de0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804de3:	48 be e5 62 80 00 00 	movabs $0x8062e5,%rsi
+  804dea:	00 00 00 
+  804ded:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  804df4:	00 00 00 
+  804df7:	ff d0                	call   *%rax
+    return 0;
+}
+  804df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfe:	5d                   	pop    %rbp
+  804dff:	c3                   	ret
+
+0000000000804e00 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e00:	55                   	push   %rbp
+  804e01:	48 89 e5             	mov    %rsp,%rbp
+  804e04:	41 57                	push   %r15
+  804e06:	41 56                	push   %r14
+  804e08:	41 55                	push   %r13
+  804e0a:	41 54                	push   %r12
+  804e0c:	53                   	push   %rbx
+  804e0d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e14:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e1b:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e22:	00 00 00 00 
+  804e26:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e2d:	00 00 00 00 
+  804e31:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e38:	00 00 00 00 
+  804e3c:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e43:	00 00 00 00 
+  804e47:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e4e:	00 00 00 00 
+  804e52:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e59:	00 00 00 00 
+  804e5d:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e64:	00 
+  804e65:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e6c:	00 
+  804e6d:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e74:	00 
+  804e75:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e7c:	00 
+  804e7d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e84:	00 
+  804e85:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e8c:	00 
+  804e8d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e94:	00 
+  804e95:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e9c:	00 
+  804e9d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804ea4:	00 
+  804ea5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804eac:	00 
+    for (res = 0; res < n; res += inc) {
+  804ead:	48 85 d2             	test   %rdx,%rdx
+  804eb0:	74 7a                	je     804f2c <devcons_write+0x12c>
+  804eb2:	49 89 d6             	mov    %rdx,%r14
+  804eb5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ebb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ec0:	49 bf 2c 23 80 00 00 	movabs $0x80232c,%r15
+  804ec7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804eca:	4c 89 f3             	mov    %r14,%rbx
+  804ecd:	48 29 f3             	sub    %rsi,%rbx
+  804ed0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ed5:	48 39 c3             	cmp    %rax,%rbx
+  804ed8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804edc:	4c 63 eb             	movslq %ebx,%r13
+  804edf:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ee6:	48 01 c6             	add    %rax,%rsi
+  804ee9:	4c 89 ea             	mov    %r13,%rdx
+  804eec:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ef3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ef6:	4c 89 ee             	mov    %r13,%rsi
+  804ef9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f00:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  804f07:	00 00 00 
+  804f0a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f0c:	41 01 dc             	add    %ebx,%r12d
+  804f0f:	49 63 f4             	movslq %r12d,%rsi
+  804f12:	4c 39 f6             	cmp    %r14,%rsi
+  804f15:	72 b3                	jb     804eca <devcons_write+0xca>
+    return res;
+  804f17:	49 63 c4             	movslq %r12d,%rax
+}
+  804f1a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f21:	5b                   	pop    %rbx
+  804f22:	41 5c                	pop    %r12
+  804f24:	41 5d                	pop    %r13
+  804f26:	41 5e                	pop    %r14
+  804f28:	41 5f                	pop    %r15
+  804f2a:	5d                   	pop    %rbp
+  804f2b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f2c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f32:	eb e3                	jmp    804f17 <devcons_write+0x117>
+
+0000000000804f34 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f34:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f37:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f3c:	48 85 c0             	test   %rax,%rax
+  804f3f:	74 55                	je     804f96 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f41:	55                   	push   %rbp
+  804f42:	48 89 e5             	mov    %rsp,%rbp
+  804f45:	41 55                	push   %r13
+  804f47:	41 54                	push   %r12
+  804f49:	53                   	push   %rbx
+  804f4a:	48 83 ec 08          	sub    $0x8,%rsp
+  804f4e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f51:	48 bb 8c 25 80 00 00 	movabs $0x80258c,%rbx
+  804f58:	00 00 00 
+  804f5b:	49 bc a0 26 80 00 00 	movabs $0x8026a0,%r12
+  804f62:	00 00 00 
+  804f65:	eb 03                	jmp    804f6a <devcons_read+0x36>
+  804f67:	41 ff d4             	call   *%r12
+  804f6a:	ff d3                	call   *%rbx
+  804f6c:	85 c0                	test   %eax,%eax
+  804f6e:	74 f7                	je     804f67 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f70:	48 63 d0             	movslq %eax,%rdx
+  804f73:	78 13                	js     804f88 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f7a:	83 f8 04             	cmp    $0x4,%eax
+  804f7d:	74 09                	je     804f88 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f7f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f83:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f88:	48 89 d0             	mov    %rdx,%rax
+  804f8b:	48 83 c4 08          	add    $0x8,%rsp
+  804f8f:	5b                   	pop    %rbx
+  804f90:	41 5c                	pop    %r12
+  804f92:	41 5d                	pop    %r13
+  804f94:	5d                   	pop    %rbp
+  804f95:	c3                   	ret
+  804f96:	48 89 d0             	mov    %rdx,%rax
+  804f99:	c3                   	ret
+
+0000000000804f9a <cputchar>:
+cputchar(int ch) {
+  804f9a:	55                   	push   %rbp
+  804f9b:	48 89 e5             	mov    %rsp,%rbp
+  804f9e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804fa2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fa6:	be 01 00 00 00       	mov    $0x1,%esi
+  804fab:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804faf:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  804fb6:	00 00 00 
+  804fb9:	ff d0                	call   *%rax
+}
+  804fbb:	c9                   	leave
+  804fbc:	c3                   	ret
+
+0000000000804fbd <getchar>:
+getchar(void) {
+  804fbd:	55                   	push   %rbp
+  804fbe:	48 89 e5             	mov    %rsp,%rbp
+  804fc1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fc5:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fca:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fd3:	48 b8 10 31 80 00 00 	movabs $0x803110,%rax
+  804fda:	00 00 00 
+  804fdd:	ff d0                	call   *%rax
+  804fdf:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fe1:	85 c0                	test   %eax,%eax
+  804fe3:	78 06                	js     804feb <getchar+0x2e>
+  804fe5:	74 08                	je     804fef <getchar+0x32>
+  804fe7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804feb:	89 d0                	mov    %edx,%eax
+  804fed:	c9                   	leave
+  804fee:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fef:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804ff4:	eb f5                	jmp    804feb <getchar+0x2e>
+
+0000000000804ff6 <iscons>:
+iscons(int fdnum) {
+  804ff6:	55                   	push   %rbp
+  804ff7:	48 89 e5             	mov    %rsp,%rbp
+  804ffa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ffe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805002:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  805009:	00 00 00 
+  80500c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80500e:	85 c0                	test   %eax,%eax
+  805010:	78 18                	js     80502a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805012:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805016:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80501d:	00 00 00 
+  805020:	8b 00                	mov    (%rax),%eax
+  805022:	39 02                	cmp    %eax,(%rdx)
+  805024:	0f 94 c0             	sete   %al
+  805027:	0f b6 c0             	movzbl %al,%eax
+}
+  80502a:	c9                   	leave
+  80502b:	c3                   	ret
+
+000000000080502c <opencons>:
+opencons(void) {
+  80502c:	55                   	push   %rbp
+  80502d:	48 89 e5             	mov    %rsp,%rbp
+  805030:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805034:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805038:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  80503f:	00 00 00 
+  805042:	ff d0                	call   *%rax
+  805044:	85 c0                	test   %eax,%eax
+  805046:	78 49                	js     805091 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805048:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80504d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805052:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80505b:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  805062:	00 00 00 
+  805065:	ff d0                	call   *%rax
+  805067:	85 c0                	test   %eax,%eax
+  805069:	78 26                	js     805091 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80506b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80506f:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805076:	00 00 
+  805078:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80507a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80507e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805085:	48 b8 9f 2d 80 00 00 	movabs $0x802d9f,%rax
+  80508c:	00 00 00 
+  80508f:	ff d0                	call   *%rax
+}
+  805091:	c9                   	leave
+  805092:	c3                   	ret
+
+0000000000805093 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805093:	55                   	push   %rbp
+  805094:	48 89 e5             	mov    %rsp,%rbp
+  805097:	41 56                	push   %r14
+  805099:	41 55                	push   %r13
+  80509b:	41 54                	push   %r12
+  80509d:	53                   	push   %rbx
+  80509e:	48 83 ec 50          	sub    $0x50,%rsp
+  8050a2:	49 89 fc             	mov    %rdi,%r12
+  8050a5:	41 89 f5             	mov    %esi,%r13d
+  8050a8:	48 89 d3             	mov    %rdx,%rbx
+  8050ab:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050af:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050b3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050b7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050c2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050c6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050ca:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050ce:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050d5:	00 00 00 
+  8050d8:	4c 8b 30             	mov    (%rax),%r14
+  8050db:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  8050e2:	00 00 00 
+  8050e5:	ff d0                	call   *%rax
+  8050e7:	89 c6                	mov    %eax,%esi
+  8050e9:	45 89 e8             	mov    %r13d,%r8d
+  8050ec:	4c 89 e1             	mov    %r12,%rcx
+  8050ef:	4c 89 f2             	mov    %r14,%rdx
+  8050f2:	48 bf f8 62 80 00 00 	movabs $0x8062f8,%rdi
+  8050f9:	00 00 00 
+  8050fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  805101:	49 bc a5 16 80 00 00 	movabs $0x8016a5,%r12
+  805108:	00 00 00 
+  80510b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80510e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805112:	48 89 df             	mov    %rbx,%rdi
+  805115:	48 b8 41 16 80 00 00 	movabs $0x801641,%rax
+  80511c:	00 00 00 
+  80511f:	ff d0                	call   *%rax
+    cprintf("\n");
+  805121:	48 bf d3 61 80 00 00 	movabs $0x8061d3,%rdi
+  805128:	00 00 00 
+  80512b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805130:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805133:	cc                   	int3
+  805134:	eb fd                	jmp    805133 <_panic+0xa0>
+
+0000000000805136 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805136:	55                   	push   %rbp
+  805137:	48 89 e5             	mov    %rsp,%rbp
+  80513a:	41 56                	push   %r14
+  80513c:	41 55                	push   %r13
+  80513e:	41 54                	push   %r12
+  805140:	53                   	push   %rbx
+  805141:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805144:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80514b:	00 00 00 
+  80514e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805152:	74 27                	je     80517b <_handle_vectored_pagefault+0x45>
+  805154:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805159:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805160:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805163:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805166:	4c 89 e7             	mov    %r12,%rdi
+  805169:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80516e:	84 c0                	test   %al,%al
+  805170:	75 45                	jne    8051b7 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805172:	48 83 c3 01          	add    $0x1,%rbx
+  805176:	49 3b 1e             	cmp    (%r14),%rbx
+  805179:	72 eb                	jb     805166 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80517b:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805182:	00 
+  805183:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805188:	4d 8b 04 24          	mov    (%r12),%r8
+  80518c:	48 ba 20 63 80 00 00 	movabs $0x806320,%rdx
+  805193:	00 00 00 
+  805196:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80519b:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8051a2:	00 00 00 
+  8051a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051aa:	49 ba 93 50 80 00 00 	movabs $0x805093,%r10
+  8051b1:	00 00 00 
+  8051b4:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051b7:	5b                   	pop    %rbx
+  8051b8:	41 5c                	pop    %r12
+  8051ba:	41 5d                	pop    %r13
+  8051bc:	41 5e                	pop    %r14
+  8051be:	5d                   	pop    %rbp
+  8051bf:	c3                   	ret
+
+00000000008051c0 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051c0:	55                   	push   %rbp
+  8051c1:	48 89 e5             	mov    %rsp,%rbp
+  8051c4:	53                   	push   %rbx
+  8051c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8051c9:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051cc:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051d1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051d8:	00 00 00 
+  8051db:	80 38 00             	cmpb   $0x0,(%rax)
+  8051de:	74 68                	je     805248 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051e0:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051e7:	00 00 00 
+  8051ea:	48 8b 08             	mov    (%rax),%rcx
+  8051ed:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051f2:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051f9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051fc:	48 85 c9             	test   %rcx,%rcx
+  8051ff:	0f 84 e0 00 00 00    	je     8052e5 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805205:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805209:	0f 84 c9 00 00 00    	je     8052d8 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80520f:	48 83 c2 01          	add    $0x1,%rdx
+  805213:	48 39 ca             	cmp    %rcx,%rdx
+  805216:	75 ed                	jne    805205 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805218:	48 83 f9 08          	cmp    $0x8,%rcx
+  80521c:	0f 84 84 00 00 00    	je     8052a6 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805222:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805226:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80522d:	00 00 00 
+  805230:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805237:	00 00 00 
+  80523a:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80523e:	85 f6                	test   %esi,%esi
+  805240:	0f 89 97 00 00 00    	jns    8052dd <add_pgfault_handler+0x11d>
+  805246:	eb 63                	jmp    8052ab <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805248:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80524d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805252:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805259:	00 00 00 
+  80525c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805261:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  805268:	00 00 00 
+  80526b:	ff d0                	call   *%rax
+  80526d:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80526f:	85 c0                	test   %eax,%eax
+  805271:	78 38                	js     8052ab <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805273:	48 be c1 53 80 00 00 	movabs $0x8053c1,%rsi
+  80527a:	00 00 00 
+  80527d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805282:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  805289:	00 00 00 
+  80528c:	ff d0                	call   *%rax
+  80528e:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805290:	85 c0                	test   %eax,%eax
+  805292:	78 17                	js     8052ab <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805294:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80529b:	00 00 00 
+  80529e:	c6 00 01             	movb   $0x1,(%rax)
+  8052a1:	e9 3a ff ff ff       	jmp    8051e0 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052a6:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052ab:	89 f1                	mov    %esi,%ecx
+  8052ad:	48 ba 5e 63 80 00 00 	movabs $0x80635e,%rdx
+  8052b4:	00 00 00 
+  8052b7:	be 42 00 00 00       	mov    $0x42,%esi
+  8052bc:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8052c3:	00 00 00 
+  8052c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052cb:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  8052d2:	00 00 00 
+  8052d5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052d8:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052dd:	89 f0                	mov    %esi,%eax
+  8052df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052e3:	c9                   	leave
+  8052e4:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052e5:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052ec:	00 00 00 
+  8052ef:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052f6:	48 89 d8             	mov    %rbx,%rax
+  8052f9:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805300:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805303:	eb d8                	jmp    8052dd <add_pgfault_handler+0x11d>
+
+0000000000805305 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805305:	55                   	push   %rbp
+  805306:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805309:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805310:	00 00 00 
+  805313:	80 38 00             	cmpb   $0x0,(%rax)
+  805316:	74 33                	je     80534b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805318:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80531f:	00 00 00 
+  805322:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805327:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80532e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805331:	48 85 c0             	test   %rax,%rax
+  805334:	0f 84 85 00 00 00    	je     8053bf <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80533a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80533e:	74 40                	je     805380 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805340:	48 83 c1 01          	add    $0x1,%rcx
+  805344:	48 39 c1             	cmp    %rax,%rcx
+  805347:	75 f1                	jne    80533a <remove_pgfault_handler+0x35>
+  805349:	eb 74                	jmp    8053bf <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80534b:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  805352:	00 00 00 
+  805355:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80535c:	00 00 00 
+  80535f:	be 48 00 00 00       	mov    $0x48,%esi
+  805364:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  80536b:	00 00 00 
+  80536e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805373:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  80537a:	00 00 00 
+  80537d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805380:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805387:	00 
+  805388:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80538c:	48 29 ca             	sub    %rcx,%rdx
+  80538f:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805396:	00 00 00 
+  805399:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80539d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053a2:	48 89 ce             	mov    %rcx,%rsi
+  8053a5:	48 b8 2c 23 80 00 00 	movabs $0x80232c,%rax
+  8053ac:	00 00 00 
+  8053af:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053b1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053b8:	00 00 00 
+  8053bb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053bf:	5d                   	pop    %rbp
+  8053c0:	c3                   	ret
+
+00000000008053c1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053c1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053c4:	48 b8 36 51 80 00 00 	movabs $0x805136,%rax
+  8053cb:	00 00 00 
+    call *%rax
+  8053ce:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053d0:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053d7:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053d8:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053df:	00 
+    subq $8, %rcx
+  8053e0:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053e4:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053e7:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053ee:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053ef:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053f3:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053f7:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053fc:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805401:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805406:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80540b:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805410:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805415:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80541a:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80541f:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805424:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805429:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80542e:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805433:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805438:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80543d:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805441:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805445:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805446:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805447:	c3                   	ret
+
+0000000000805448 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805448:	85 ff                	test   %edi,%edi
+  80544a:	78 58                	js     8054a4 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80544c:	48 85 f6             	test   %rsi,%rsi
+  80544f:	74 12                	je     805463 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805451:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805458:	00 00 00 
+  80545b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805461:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805463:	48 85 c9             	test   %rcx,%rcx
+  805466:	74 12                	je     80547a <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805468:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80546f:	00 00 00 
+  805472:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805478:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80547a:	48 85 d2             	test   %rdx,%rdx
+  80547d:	74 14                	je     805493 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80547f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805486:	00 00 00 
+  805489:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805490:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805493:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80549a:	00 00 00 
+  80549d:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8054a3:	c3                   	ret
+        if (from_env_store) {
+  8054a4:	48 85 f6             	test   %rsi,%rsi
+  8054a7:	74 06                	je     8054af <ipc_result+0x67>
+            *from_env_store = 0;
+  8054a9:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054af:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054b1:	48 85 c9             	test   %rcx,%rcx
+  8054b4:	74 ed                	je     8054a3 <ipc_result+0x5b>
+            *perm_store = 0;
+  8054b6:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054bc:	c3                   	ret
+
+00000000008054bd <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054bd:	55                   	push   %rbp
+  8054be:	48 89 e5             	mov    %rsp,%rbp
+  8054c1:	41 55                	push   %r13
+  8054c3:	41 54                	push   %r12
+  8054c5:	53                   	push   %rbx
+  8054c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8054ca:	49 89 fc             	mov    %rdi,%r12
+  8054cd:	48 89 f7             	mov    %rsi,%rdi
+  8054d0:	48 89 d3             	mov    %rdx,%rbx
+  8054d3:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054d6:	48 85 f6             	test   %rsi,%rsi
+  8054d9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054e0:	00 00 00 
+  8054e3:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8054ec:	48 85 d2             	test   %rdx,%rdx
+  8054ef:	74 03                	je     8054f4 <ipc_recv+0x37>
+  8054f1:	48 8b 32             	mov    (%rdx),%rsi
+  8054f4:	48 b8 8d 2c 80 00 00 	movabs $0x802c8d,%rax
+  8054fb:	00 00 00 
+  8054fe:	ff d0                	call   *%rax
+  805500:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805502:	4c 89 e9             	mov    %r13,%rcx
+  805505:	48 89 da             	mov    %rbx,%rdx
+  805508:	4c 89 e6             	mov    %r12,%rsi
+  80550b:	48 b8 48 54 80 00 00 	movabs $0x805448,%rax
+  805512:	00 00 00 
+  805515:	ff d0                	call   *%rax
+}
+  805517:	48 83 c4 08          	add    $0x8,%rsp
+  80551b:	5b                   	pop    %rbx
+  80551c:	41 5c                	pop    %r12
+  80551e:	41 5d                	pop    %r13
+  805520:	5d                   	pop    %rbp
+  805521:	c3                   	ret
+
+0000000000805522 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805522:	55                   	push   %rbp
+  805523:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805526:	48 85 d2             	test   %rdx,%rdx
+  805529:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805530:	00 00 00 
+  805533:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805537:	89 f6                	mov    %esi,%esi
+  805539:	48 b8 19 2b 80 00 00 	movabs $0x802b19,%rax
+  805540:	00 00 00 
+  805543:	ff d0                	call   *%rax
+    if (res < 0) {
+  805545:	85 c0                	test   %eax,%eax
+  805547:	78 02                	js     80554b <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805549:	5d                   	pop    %rbp
+  80554a:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80554b:	89 c1                	mov    %eax,%ecx
+  80554d:	48 ba 90 63 80 00 00 	movabs $0x806390,%rdx
+  805554:	00 00 00 
+  805557:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80555c:	48 bf 9d 63 80 00 00 	movabs $0x80639d,%rdi
+  805563:	00 00 00 
+  805566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80556b:	49 b8 93 50 80 00 00 	movabs $0x805093,%r8
+  805572:	00 00 00 
+  805575:	41 ff d0             	call   *%r8
+
+0000000000805578 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805578:	55                   	push   %rbp
+  805579:	48 89 e5             	mov    %rsp,%rbp
+  80557c:	53                   	push   %rbx
+  80557d:	48 83 ec 08          	sub    $0x8,%rsp
+  805581:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805585:	48 85 d2             	test   %rdx,%rdx
+  805588:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80558f:	00 00 00 
+  805592:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805596:	4d 85 c9             	test   %r9,%r9
+  805599:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80559d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055a2:	48 85 db             	test   %rbx,%rbx
+  8055a5:	74 03                	je     8055aa <ipc_call+0x32>
+  8055a7:	48 8b 03             	mov    (%rbx),%rax
+  8055aa:	89 f6                	mov    %esi,%esi
+  8055ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8055b0:	50                   	push   %rax
+  8055b1:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  8055b8:	00 00 00 
+  8055bb:	ff d0                	call   *%rax
+  8055bd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055bf:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055c3:	48 89 da             	mov    %rbx,%rdx
+  8055c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8055cb:	48 b8 48 54 80 00 00 	movabs $0x805448,%rax
+  8055d2:	00 00 00 
+  8055d5:	ff d0                	call   *%rax
+}
+  8055d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055db:	c9                   	leave
+  8055dc:	c3                   	ret
+
+00000000008055dd <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055dd:	55                   	push   %rbp
+  8055de:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055e1:	89 f6                	mov    %esi,%esi
+  8055e3:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  8055ea:	00 00 00 
+  8055ed:	ff d0                	call   *%rax
+  8055ef:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055fb:	be 00 00 00 00       	mov    $0x0,%esi
+  805600:	48 b8 48 54 80 00 00 	movabs $0x805448,%rax
+  805607:	00 00 00 
+  80560a:	ff d0                	call   *%rax
+}
+  80560c:	5d                   	pop    %rbp
+  80560d:	c3                   	ret
+
+000000000080560e <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80560e:	55                   	push   %rbp
+  80560f:	48 89 e5             	mov    %rsp,%rbp
+  805612:	41 54                	push   %r12
+  805614:	53                   	push   %rbx
+  805615:	4c 89 cb             	mov    %r9,%rbx
+  805618:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80561c:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805620:	48 85 d2             	test   %rdx,%rdx
+  805623:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80562a:	00 00 00 
+  80562d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805631:	4d 85 c9             	test   %r9,%r9
+  805634:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80563d:	4d 85 e4             	test   %r12,%r12
+  805640:	74 04                	je     805646 <ipc_reply_wait+0x38>
+  805642:	49 8b 04 24          	mov    (%r12),%rax
+  805646:	89 f6                	mov    %esi,%esi
+  805648:	48 83 ec 08          	sub    $0x8,%rsp
+  80564c:	50                   	push   %rax
+  80564d:	48 b8 21 2c 80 00 00 	movabs $0x802c21,%rax
+  805654:	00 00 00 
+  805657:	ff d0                	call   *%rax
+  805659:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80565b:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80565f:	4c 89 e2             	mov    %r12,%rdx
+  805662:	48 89 de             	mov    %rbx,%rsi
+  805665:	48 b8 48 54 80 00 00 	movabs $0x805448,%rax
+  80566c:	00 00 00 
+  80566f:	ff d0                	call   *%rax
+}
+  805671:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805675:	5b                   	pop    %rbx
+  805676:	41 5c                	pop    %r12
+  805678:	5d                   	pop    %rbp
+  805679:	c3                   	ret
+
+000000000080567a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80567a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80567f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805686:	00 00 00 
+  805689:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805690:	48 01 ca             	add    %rcx,%rdx
+  805693:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805699:	39 fa                	cmp    %edi,%edx
+  80569b:	74 12                	je     8056af <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80569d:	48 83 c0 01          	add    $0x1,%rax
+  8056a1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056a7:	75 e0                	jne    805689 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056ae:	c3                   	ret
+            return envs[i].env_id;
+  8056af:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056b6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056bd:	00 00 00 
+  8056c0:	48 01 d0             	add    %rdx,%rax
+  8056c3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056c9:	c3                   	ret
+  8056ca:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008056d0 <__rodata_start>:
+  8056d0:	77 00                	ja     8056d2 <__rodata_start+0x2>
+  8056d2:	72 62                	jb     805736 <__rodata_start+0x66>
+  8056d4:	00 77 62             	add    %dh,0x62(%rdi)
+  8056d7:	00 0f                	add    %cl,(%rdi)
+  8056d9:	1f                   	(bad)
+  8056da:	84 00                	test   %al,(%rax)
+  8056dc:	00 00                	add    %al,(%rax)
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 69 64 6c 65 00 3c 75 6e 6b 6e 6f 77 6e 3e     ..idle.<unknown>
+  805c30:	00 30 31 32 33 34 35 36 37 38 39 41 42 43 44 45     .0123456789ABCDE
+  805c40:	46 00 30 31 32 33 34 35 36 37 38 39 61 62 63 64     F.0123456789abcd
+  805c50:	65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f 72 20     ef.(null).error 
+  805c60:	25 64 00 75 6e 73 70 65 63 69 66 69 65 64 20 65     %d.unspecified e
+  805c70:	72 72 6f 72 00 62 61 64 20 65 6e 76 69 72 6f 6e     rror.bad environ
+  805c80:	6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70 61 72     ment.invalid par
+  805c90:	61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20 6d 65     ameter.out of me
+  805ca0:	6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e 76 69     mory.out of envi
+  805cb0:	72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75 70 74     ronments.corrupt
+  805cc0:	65 64 20 64 65 62 75 67 20 69 6e 66 6f 00 73 65     ed debug info.se
+  805cd0:	67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75 6c 74     gmentation fault
+  805ce0:	00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69 6d 61     .invalid ELF ima
+  805cf0:	67 65 00 6e 6f 20 73 75 63 68 20 73 79 73 74 65     ge.no such syste
+  805d00:	6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e 6f 74     m call.entry not
+  805d10:	20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20 6e 6f      found.env is no
+  805d20:	74 20 72 65 63 76 69 6e 67 00 75 6e 65 78 70 65     t recving.unexpe
+  805d30:	63 74 65 64 20 65 6e 64 20 6f 66 20 66 69 6c 65     cted end of file
+  805d40:	00 6e 6f 20 66 72 65 65 20 73 70 61 63 65 20 6f     .no free space o
+  805d50:	6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e 79 20     n disk.too many 
+  805d60:	66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e 00 66     files are open.f
+  805d70:	69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e 6f 74     ile or block not
+  805d80:	20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64 20 70      found.invalid p
+  805d90:	61 74 68 00 66 69 6c 65 20 61 6c 72 65 61 64 79     ath.file already
+  805da0:	20 65 78 69 73 74 73 00 6f 70 65 72 61 74 69 6f      exists.operatio
+  805db0:	6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65 64 00     n not supported.
+  805dc0:	9d 18 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805dd0:	e4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805de0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805df0:	f4 1e 80 00 00 00 00 00 bc 18 80 00 00 00 00 00     ................
+  805e00:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805e10:	b0 18 80 00 00 00 00 00 2a 19 80 00 00 00 00 00     ........*.......
+  805e20:	f4 1e 80 00 00 00 00 00 b0 18 80 00 00 00 00 00     ................
+  805e30:	f6 18 80 00 00 00 00 00 f6 18 80 00 00 00 00 00     ................
+  805e40:	f6 18 80 00 00 00 00 00 f6 18 80 00 00 00 00 00     ................
+  805e50:	f6 18 80 00 00 00 00 00 f6 18 80 00 00 00 00 00     ................
+  805e60:	f6 18 80 00 00 00 00 00 f6 18 80 00 00 00 00 00     ................
+  805e70:	f6 18 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805e80:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805e90:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805ea0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805eb0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805ec0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805ed0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805ee0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805ef0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f00:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f10:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f20:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f30:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f40:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f50:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f60:	f4 1e 80 00 00 00 00 00 12 1e 80 00 00 00 00 00     ................
+  805f70:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f80:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805f90:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805fa0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805fb0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805fc0:	58 19 80 00 00 00 00 00 27 1b 80 00 00 00 00 00     X.......'.......
+  805fd0:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  805fe0:	f4 1e 80 00 00 00 00 00 4d 19 80 00 00 00 00 00     ........M.......
+  805ff0:	87 19 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  806000:	f4 1e 80 00 00 00 00 00 42 19 80 00 00 00 00 00     ........B.......
+  806010:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  806020:	d0 1c 80 00 00 00 00 00 9f 1d 80 00 00 00 00 00     ................
+  806030:	f4 1e 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  806040:	1e 1a 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  806050:	fb 1b 80 00 00 00 00 00 f4 1e 80 00 00 00 00 00     ................
+  806060:	f4 1e 80 00 00 00 00 00 12 1e 80 00 00 00 00 00     ................
+  806070:	f4 1e 80 00 00 00 00 00 a6 18 80 00 00 00 00 00     ................
+
+0000000000806080 <error_string>:
+	...
+  806088:	63 5c 80 00 00 00 00 00 75 5c 80 00 00 00 00 00     c\......u\......
+  806098:	85 5c 80 00 00 00 00 00 97 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	a5 5c 80 00 00 00 00 00 b9 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	ce 5c 80 00 00 00 00 00 e1 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	f3 5c 80 00 00 00 00 00 07 5d 80 00 00 00 00 00     .\.......]......
+  8060d8:	17 5d 80 00 00 00 00 00 2a 5d 80 00 00 00 00 00     .]......*]......
+  8060e8:	41 5d 80 00 00 00 00 00 57 5d 80 00 00 00 00 00     A]......W]......
+  8060f8:	6f 5d 80 00 00 00 00 00 87 5d 80 00 00 00 00 00     o].......]......
+  806108:	94 5d 80 00 00 00 00 00 20 61 80 00 00 00 00 00     .]...... a......
+  806118:	a8 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806128:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806138:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806148:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806158:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806168:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806178:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806188:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806198:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806200 <devtab>:
+  806200:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806210:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806220:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806230:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806240:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806250:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806260:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806270:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806280:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806290:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062f0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806300:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806310:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806320:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806330:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806340:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806350:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806360:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806370:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806380:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806390:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063a0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
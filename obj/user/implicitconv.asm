@@ -0,0 +1,10327 @@
+
+obj/user/implicitconv:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 d7 20 80 00 00 	movabs $0x8020d7,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 e6 1e 80 00 00 	movabs $0x801ee6,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 e6 1e 80 00 00 	movabs $0x801ee6,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 ad 15 80 00 00 	movabs $0x8015ad,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 70 5c 80 00 00 	movabs $0x805c70,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 76 20 80 00 00 	movabs $0x802076,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 80 39 80 00 00 	movabs $0x803980,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be a8 56 80 00 00 	movabs $0x8056a8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 76 20 80 00 00 	movabs $0x802076,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 80 39 80 00 00 	movabs $0x803980,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be aa 56 80 00 00 	movabs $0x8056aa,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 76 20 80 00 00 	movabs $0x802076,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 80 39 80 00 00 	movabs $0x803980,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be ad 56 80 00 00 	movabs $0x8056ad,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 76 20 80 00 00 	movabs $0x802076,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 80 39 80 00 00 	movabs $0x803980,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 eb 49 80 00 00 	movabs $0x8049eb,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 c2 4c 80 00 00 	movabs $0x804cc2,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 6a 2f 80 00 00 	movabs $0x802f6a,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 01 33 80 00 00 	movabs $0x803301,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 ca 33 80 00 00 	movabs $0x8033ca,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 e8 30 80 00 00 	movabs $0x8030e8,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 80 39 80 00 00 	movabs $0x803980,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 6a 2f 80 00 00 	movabs $0x802f6a,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 23 22 80 00 00 	movabs $0x802223,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 23 22 80 00 00 	movabs $0x802223,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 56 22 80 00 00 	movabs $0x802256,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 23 22 80 00 00 	movabs $0x802223,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 59 80 00 00 	movabs $0x805960,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 23 22 80 00 00 	movabs $0x802223,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 23 22 80 00 00 	movabs $0x802223,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5b 80 00 00 	movabs $0x805be0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 7b 24 80 00 00 	movabs $0x80247b,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 7b 24 80 00 00 	movabs $0x80247b,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 05 00 00 00       	call   801504 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <signed_impl_conv>:
+    a = 257;
+    char c = a;
+
+    (void)b;
+    (void)c;
+}
+  801501:	c3                   	ret
+
+0000000000801502 <unsigned_impl_conv>:
+unsigned_impl_conv() {
+    unsigned long long a = 400000000000;
+    unsigned int b = a;
+
+    (void)b;
+}
+  801502:	c3                   	ret
+
+0000000000801503 <umain>:
+
+void
+umain(int argc, char **argv) {
+    signed_impl_conv();
+    unsigned_impl_conv();
+}
+  801503:	c3                   	ret
+
+0000000000801504 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	41 56                	push   %r14
+  80150a:	41 55                	push   %r13
+  80150c:	41 54                	push   %r12
+  80150e:	53                   	push   %rbx
+  80150f:	41 89 fd             	mov    %edi,%r13d
+  801512:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801515:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80151c:	00 00 00 
+  80151f:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801526:	00 00 00 
+  801529:	48 39 c2             	cmp    %rax,%rdx
+  80152c:	73 17                	jae    801545 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80152e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801531:	49 89 c4             	mov    %rax,%r12
+  801534:	48 83 c3 08          	add    $0x8,%rbx
+  801538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153d:	ff 53 f8             	call   *-0x8(%rbx)
+  801540:	4c 39 e3             	cmp    %r12,%rbx
+  801543:	72 ef                	jb     801534 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801545:	48 b8 41 26 80 00 00 	movabs $0x802641,%rax
+  80154c:	00 00 00 
+  80154f:	ff d0                	call   *%rax
+  801551:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801556:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80155d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801564:	00 00 00 
+  801567:	48 01 d0             	add    %rdx,%rax
+  80156a:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801571:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801574:	45 85 ed             	test   %r13d,%r13d
+  801577:	7e 0d                	jle    801586 <libmain+0x82>
+  801579:	49 8b 06             	mov    (%r14),%rax
+  80157c:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801583:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801586:	4c 89 f6             	mov    %r14,%rsi
+  801589:	44 89 ef             	mov    %r13d,%edi
+  80158c:	48 b8 03 15 80 00 00 	movabs $0x801503,%rax
+  801593:	00 00 00 
+  801596:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801598:	48 b8 ad 15 80 00 00 	movabs $0x8015ad,%rax
+  80159f:	00 00 00 
+  8015a2:	ff d0                	call   *%rax
+#endif
+}
+  8015a4:	5b                   	pop    %rbx
+  8015a5:	41 5c                	pop    %r12
+  8015a7:	41 5d                	pop    %r13
+  8015a9:	41 5e                	pop    %r14
+  8015ab:	5d                   	pop    %rbp
+  8015ac:	c3                   	ret
+
+00000000008015ad <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015ad:	55                   	push   %rbp
+  8015ae:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015b1:	48 b8 9d 2f 80 00 00 	movabs $0x802f9d,%rax
+  8015b8:	00 00 00 
+  8015bb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c2:	48 b8 d0 25 80 00 00 	movabs $0x8025d0,%rax
+  8015c9:	00 00 00 
+  8015cc:	ff d0                	call   *%rax
+}
+  8015ce:	5d                   	pop    %rbp
+  8015cf:	c3                   	ret
+
+00000000008015d0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015d0:	55                   	push   %rbp
+  8015d1:	48 89 e5             	mov    %rsp,%rbp
+  8015d4:	53                   	push   %rbx
+  8015d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015dc:	8b 06                	mov    (%rsi),%eax
+  8015de:	8d 50 01             	lea    0x1(%rax),%edx
+  8015e1:	89 16                	mov    %edx,(%rsi)
+  8015e3:	48 98                	cltq
+  8015e5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8015ea:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8015f0:	74 0a                	je     8015fc <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8015f2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8015f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fa:	c9                   	leave
+  8015fb:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8015fc:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801600:	be ff 00 00 00       	mov    $0xff,%esi
+  801605:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  80160c:	00 00 00 
+  80160f:	ff d0                	call   *%rax
+        state->offset = 0;
+  801611:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801617:	eb d9                	jmp    8015f2 <putch+0x22>
+
+0000000000801619 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801624:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801627:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80162e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801633:	b8 00 00 00 00       	mov    $0x0,%eax
+  801638:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80163b:	48 89 f1             	mov    %rsi,%rcx
+  80163e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801645:	48 bf d0 15 80 00 00 	movabs $0x8015d0,%rdi
+  80164c:	00 00 00 
+  80164f:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  801656:	00 00 00 
+  801659:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80165b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801662:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801669:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  801670:	00 00 00 
+  801673:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801675:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80167b:	c9                   	leave
+  80167c:	c3                   	ret
+
+000000000080167d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80167d:	55                   	push   %rbp
+  80167e:	48 89 e5             	mov    %rsp,%rbp
+  801681:	48 83 ec 50          	sub    $0x50,%rsp
+  801685:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801689:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80168d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801691:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801695:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801699:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016a0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016a8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016ac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016b0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016b4:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  8016bb:	00 00 00 
+  8016be:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016c0:	c9                   	leave
+  8016c1:	c3                   	ret
+
+00000000008016c2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016c2:	55                   	push   %rbp
+  8016c3:	48 89 e5             	mov    %rsp,%rbp
+  8016c6:	41 57                	push   %r15
+  8016c8:	41 56                	push   %r14
+  8016ca:	41 55                	push   %r13
+  8016cc:	41 54                	push   %r12
+  8016ce:	53                   	push   %rbx
+  8016cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8016d3:	49 89 fc             	mov    %rdi,%r12
+  8016d6:	49 89 f5             	mov    %rsi,%r13
+  8016d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016dd:	8b 45 10             	mov    0x10(%rbp),%eax
+  8016e0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8016e3:	41 89 cf             	mov    %ecx,%r15d
+  8016e6:	4c 39 fa             	cmp    %r15,%rdx
+  8016e9:	73 5b                	jae    801746 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8016eb:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8016ef:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8016f3:	85 db                	test   %ebx,%ebx
+  8016f5:	7e 0e                	jle    801705 <print_num+0x43>
+            putch(padc, put_arg);
+  8016f7:	4c 89 ee             	mov    %r13,%rsi
+  8016fa:	44 89 f7             	mov    %r14d,%edi
+  8016fd:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801700:	83 eb 01             	sub    $0x1,%ebx
+  801703:	75 f2                	jne    8016f7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801705:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801709:	48 b9 1d 5c 80 00 00 	movabs $0x805c1d,%rcx
+  801710:	00 00 00 
+  801713:	48 b8 0c 5c 80 00 00 	movabs $0x805c0c,%rax
+  80171a:	00 00 00 
+  80171d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801721:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801725:	ba 00 00 00 00       	mov    $0x0,%edx
+  80172a:	49 f7 f7             	div    %r15
+  80172d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801731:	4c 89 ee             	mov    %r13,%rsi
+  801734:	41 ff d4             	call   *%r12
+}
+  801737:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80173b:	5b                   	pop    %rbx
+  80173c:	41 5c                	pop    %r12
+  80173e:	41 5d                	pop    %r13
+  801740:	41 5e                	pop    %r14
+  801742:	41 5f                	pop    %r15
+  801744:	5d                   	pop    %rbp
+  801745:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801746:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174f:	49 f7 f7             	div    %r15
+  801752:	48 83 ec 08          	sub    $0x8,%rsp
+  801756:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80175a:	52                   	push   %rdx
+  80175b:	45 0f be c9          	movsbl %r9b,%r9d
+  80175f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801763:	48 89 c2             	mov    %rax,%rdx
+  801766:	48 b8 c2 16 80 00 00 	movabs $0x8016c2,%rax
+  80176d:	00 00 00 
+  801770:	ff d0                	call   *%rax
+  801772:	48 83 c4 10          	add    $0x10,%rsp
+  801776:	eb 8d                	jmp    801705 <print_num+0x43>
+
+0000000000801778 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801778:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80177c:	48 8b 06             	mov    (%rsi),%rax
+  80177f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801783:	73 0a                	jae    80178f <sprintputch+0x17>
+        *state->start++ = ch;
+  801785:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801789:	48 89 16             	mov    %rdx,(%rsi)
+  80178c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80178f:	c3                   	ret
+
+0000000000801790 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801790:	55                   	push   %rbp
+  801791:	48 89 e5             	mov    %rsp,%rbp
+  801794:	48 83 ec 50          	sub    $0x50,%rsp
+  801798:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80179c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017a0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017a4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017b3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017bb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017bf:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  8017c6:	00 00 00 
+  8017c9:	ff d0                	call   *%rax
+}
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+
+00000000008017cd <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	41 57                	push   %r15
+  8017d3:	41 56                	push   %r14
+  8017d5:	41 55                	push   %r13
+  8017d7:	41 54                	push   %r12
+  8017d9:	53                   	push   %rbx
+  8017da:	48 83 ec 38          	sub    $0x38,%rsp
+  8017de:	49 89 fe             	mov    %rdi,%r14
+  8017e1:	49 89 f5             	mov    %rsi,%r13
+  8017e4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8017e7:	48 8b 01             	mov    (%rcx),%rax
+  8017ea:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8017ee:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8017f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017f6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8017fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8017fe:	eb 0d                	jmp    80180d <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801800:	40 0f b6 ff          	movzbl %dil,%edi
+  801804:	4c 89 ee             	mov    %r13,%rsi
+  801807:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80180a:	4c 89 e3             	mov    %r12,%rbx
+  80180d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801811:	0f b6 3b             	movzbl (%rbx),%edi
+  801814:	40 80 ff 25          	cmp    $0x25,%dil
+  801818:	74 14                	je     80182e <vprintfmt+0x61>
+            if (!ch) return;
+  80181a:	40 84 ff             	test   %dil,%dil
+  80181d:	75 e1                	jne    801800 <vprintfmt+0x33>
+}
+  80181f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801823:	5b                   	pop    %rbx
+  801824:	41 5c                	pop    %r12
+  801826:	41 5d                	pop    %r13
+  801828:	41 5e                	pop    %r14
+  80182a:	41 5f                	pop    %r15
+  80182c:	5d                   	pop    %rbp
+  80182d:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  80182e:	be 00 00 00 00       	mov    $0x0,%esi
+  801833:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801837:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80183c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801842:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801849:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80184d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801852:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801857:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80185a:	83 e8 23             	sub    $0x23,%eax
+  80185d:	3c 57                	cmp    $0x57,%al
+  80185f:	0f 87 67 06 00 00    	ja     801ecc <vprintfmt+0x6ff>
+  801865:	0f b6 c0             	movzbl %al,%eax
+  801868:	48 b9 a0 5d 80 00 00 	movabs $0x805da0,%rcx
+  80186f:	00 00 00 
+  801872:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801875:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801878:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80187c:	eb cf                	jmp    80184d <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80187e:	49 89 dc             	mov    %rbx,%r12
+  801881:	be 01 00 00 00       	mov    $0x1,%esi
+  801886:	eb c5                	jmp    80184d <vprintfmt+0x80>
+            padc = ch;
+  801888:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80188c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80188f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801892:	eb b9                	jmp    80184d <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801894:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801897:	83 f8 2f             	cmp    $0x2f,%eax
+  80189a:	77 24                	ja     8018c0 <vprintfmt+0xf3>
+  80189c:	89 c1                	mov    %eax,%ecx
+  80189e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018a2:	83 c0 08             	add    $0x8,%eax
+  8018a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018a8:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018ab:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018ae:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018b2:	79 99                	jns    80184d <vprintfmt+0x80>
+                width = precision;
+  8018b4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018b8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018be:	eb 8d                	jmp    80184d <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018c0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018c4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018cc:	eb da                	jmp    8018a8 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018ce:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018d3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018d7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8018dd:	3c 39                	cmp    $0x39,%al
+  8018df:	77 1c                	ja     8018fd <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8018e1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8018e5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8018e9:	0f b6 c0             	movzbl %al,%eax
+  8018ec:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018f1:	0f b6 03             	movzbl (%rbx),%eax
+  8018f4:	3c 39                	cmp    $0x39,%al
+  8018f6:	76 e9                	jbe    8018e1 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8018f8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8018fb:	eb b1                	jmp    8018ae <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8018fd:	49 89 dc             	mov    %rbx,%r12
+  801900:	eb ac                	jmp    8018ae <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801902:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801905:	85 c9                	test   %ecx,%ecx
+  801907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190c:	0f 49 c1             	cmovns %ecx,%eax
+  80190f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801912:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801915:	e9 33 ff ff ff       	jmp    80184d <vprintfmt+0x80>
+            lflag++;
+  80191a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80191d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801920:	e9 28 ff ff ff       	jmp    80184d <vprintfmt+0x80>
+            lflag--;
+  801925:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801928:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80192b:	e9 1d ff ff ff       	jmp    80184d <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801930:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801933:	83 f8 2f             	cmp    $0x2f,%eax
+  801936:	77 19                	ja     801951 <vprintfmt+0x184>
+  801938:	89 c2                	mov    %eax,%edx
+  80193a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80193e:	83 c0 08             	add    $0x8,%eax
+  801941:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801944:	8b 3a                	mov    (%rdx),%edi
+  801946:	4c 89 ee             	mov    %r13,%rsi
+  801949:	41 ff d6             	call   *%r14
+            break;
+  80194c:	e9 bc fe ff ff       	jmp    80180d <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80195d:	eb e5                	jmp    801944 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  80195f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801962:	83 f8 2f             	cmp    $0x2f,%eax
+  801965:	77 5a                	ja     8019c1 <vprintfmt+0x1f4>
+  801967:	89 c2                	mov    %eax,%edx
+  801969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80196d:	83 c0 08             	add    $0x8,%eax
+  801970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801973:	8b 02                	mov    (%rdx),%eax
+  801975:	89 c1                	mov    %eax,%ecx
+  801977:	f7 d9                	neg    %ecx
+  801979:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80197c:	83 f9 13             	cmp    $0x13,%ecx
+  80197f:	7f 4e                	jg     8019cf <vprintfmt+0x202>
+  801981:	48 63 c1             	movslq %ecx,%rax
+  801984:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  80198b:	00 00 00 
+  80198e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801992:	48 85 c0             	test   %rax,%rax
+  801995:	74 38                	je     8019cf <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801997:	48 89 c1             	mov    %rax,%rcx
+  80199a:	48 ba 28 62 80 00 00 	movabs $0x806228,%rdx
+  8019a1:	00 00 00 
+  8019a4:	4c 89 ee             	mov    %r13,%rsi
+  8019a7:	4c 89 f7             	mov    %r14,%rdi
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019af:	49 b8 90 17 80 00 00 	movabs $0x801790,%r8
+  8019b6:	00 00 00 
+  8019b9:	41 ff d0             	call   *%r8
+  8019bc:	e9 4c fe ff ff       	jmp    80180d <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019cd:	eb a4                	jmp    801973 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019cf:	48 ba 35 5c 80 00 00 	movabs $0x805c35,%rdx
+  8019d6:	00 00 00 
+  8019d9:	4c 89 ee             	mov    %r13,%rsi
+  8019dc:	4c 89 f7             	mov    %r14,%rdi
+  8019df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e4:	49 b8 90 17 80 00 00 	movabs $0x801790,%r8
+  8019eb:	00 00 00 
+  8019ee:	41 ff d0             	call   *%r8
+  8019f1:	e9 17 fe ff ff       	jmp    80180d <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8019f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8019fc:	77 6c                	ja     801a6a <vprintfmt+0x29d>
+  8019fe:	89 c2                	mov    %eax,%edx
+  801a00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a04:	83 c0 08             	add    $0x8,%eax
+  801a07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a0a:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a0d:	48 85 f6             	test   %rsi,%rsi
+  801a10:	48 b8 2e 5c 80 00 00 	movabs $0x805c2e,%rax
+  801a17:	00 00 00 
+  801a1a:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a1e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a22:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a26:	7e 06                	jle    801a2e <vprintfmt+0x261>
+  801a28:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a2c:	75 4a                	jne    801a78 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a2e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a32:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a36:	0f b6 00             	movzbl (%rax),%eax
+  801a39:	84 c0                	test   %al,%al
+  801a3b:	0f 85 9a 00 00 00    	jne    801adb <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a41:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a44:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	0f 8e bd fd ff ff    	jle    80180d <vprintfmt+0x40>
+  801a50:	4c 89 ee             	mov    %r13,%rsi
+  801a53:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a58:	41 ff d6             	call   *%r14
+  801a5b:	41 83 ec 01          	sub    $0x1,%r12d
+  801a5f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a63:	75 eb                	jne    801a50 <vprintfmt+0x283>
+  801a65:	e9 a3 fd ff ff       	jmp    80180d <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a76:	eb 92                	jmp    801a0a <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a78:	49 63 f7             	movslq %r15d,%rsi
+  801a7b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801a7f:	48 b8 91 1f 80 00 00 	movabs $0x801f91,%rax
+  801a86:	00 00 00 
+  801a89:	ff d0                	call   *%rax
+  801a8b:	48 89 c2             	mov    %rax,%rdx
+  801a8e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a91:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801a93:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801a96:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	7e 91                	jle    801a2e <vprintfmt+0x261>
+  801a9d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801aa2:	4c 89 ee             	mov    %r13,%rsi
+  801aa5:	44 89 e7             	mov    %r12d,%edi
+  801aa8:	41 ff d6             	call   *%r14
+  801aab:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801aaf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ab5:	75 eb                	jne    801aa2 <vprintfmt+0x2d5>
+  801ab7:	e9 72 ff ff ff       	jmp    801a2e <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801abc:	0f b6 f8             	movzbl %al,%edi
+  801abf:	4c 89 ee             	mov    %r13,%rsi
+  801ac2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ac5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ac9:	49 83 c4 01          	add    $0x1,%r12
+  801acd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ad3:	84 c0                	test   %al,%al
+  801ad5:	0f 84 66 ff ff ff    	je     801a41 <vprintfmt+0x274>
+  801adb:	45 85 ff             	test   %r15d,%r15d
+  801ade:	78 0a                	js     801aea <vprintfmt+0x31d>
+  801ae0:	41 83 ef 01          	sub    $0x1,%r15d
+  801ae4:	0f 88 57 ff ff ff    	js     801a41 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801aea:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801aee:	74 cc                	je     801abc <vprintfmt+0x2ef>
+  801af0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801af3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801af8:	80 fa 5e             	cmp    $0x5e,%dl
+  801afb:	77 c2                	ja     801abf <vprintfmt+0x2f2>
+  801afd:	eb bd                	jmp    801abc <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801aff:	40 84 f6             	test   %sil,%sil
+  801b02:	75 26                	jne    801b2a <vprintfmt+0x35d>
+    switch (lflag) {
+  801b04:	85 d2                	test   %edx,%edx
+  801b06:	74 59                	je     801b61 <vprintfmt+0x394>
+  801b08:	83 fa 01             	cmp    $0x1,%edx
+  801b0b:	74 7b                	je     801b88 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b10:	83 f8 2f             	cmp    $0x2f,%eax
+  801b13:	0f 87 96 00 00 00    	ja     801baf <vprintfmt+0x3e2>
+  801b19:	89 c2                	mov    %eax,%edx
+  801b1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b1f:	83 c0 08             	add    $0x8,%eax
+  801b22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b25:	4c 8b 22             	mov    (%rdx),%r12
+  801b28:	eb 17                	jmp    801b41 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b2d:	83 f8 2f             	cmp    $0x2f,%eax
+  801b30:	77 21                	ja     801b53 <vprintfmt+0x386>
+  801b32:	89 c2                	mov    %eax,%edx
+  801b34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b38:	83 c0 08             	add    $0x8,%eax
+  801b3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b3e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b41:	4d 85 e4             	test   %r12,%r12
+  801b44:	78 7a                	js     801bc0 <vprintfmt+0x3f3>
+            num = i;
+  801b46:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b49:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b4e:	e9 56 02 00 00       	jmp    801da9 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b5f:	eb dd                	jmp    801b3e <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b64:	83 f8 2f             	cmp    $0x2f,%eax
+  801b67:	77 11                	ja     801b7a <vprintfmt+0x3ad>
+  801b69:	89 c2                	mov    %eax,%edx
+  801b6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b6f:	83 c0 08             	add    $0x8,%eax
+  801b72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b75:	4c 63 22             	movslq (%rdx),%r12
+  801b78:	eb c7                	jmp    801b41 <vprintfmt+0x374>
+  801b7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b86:	eb ed                	jmp    801b75 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801b88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8b:	83 f8 2f             	cmp    $0x2f,%eax
+  801b8e:	77 11                	ja     801ba1 <vprintfmt+0x3d4>
+  801b90:	89 c2                	mov    %eax,%edx
+  801b92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b96:	83 c0 08             	add    $0x8,%eax
+  801b99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b9c:	4c 8b 22             	mov    (%rdx),%r12
+  801b9f:	eb a0                	jmp    801b41 <vprintfmt+0x374>
+  801ba1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bad:	eb ed                	jmp    801b9c <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbb:	e9 65 ff ff ff       	jmp    801b25 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801bc0:	4c 89 ee             	mov    %r13,%rsi
+  801bc3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801bc8:	41 ff d6             	call   *%r14
+                i = -i;
+  801bcb:	49 f7 dc             	neg    %r12
+  801bce:	e9 73 ff ff ff       	jmp    801b46 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bd3:	40 84 f6             	test   %sil,%sil
+  801bd6:	75 2e                	jne    801c06 <vprintfmt+0x439>
+    switch (lflag) {
+  801bd8:	85 d2                	test   %edx,%edx
+  801bda:	7f 59                	jg     801c35 <vprintfmt+0x468>
+  801bdc:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801bdf:	7d 7a                	jge    801c5b <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801be1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801be4:	83 f8 2f             	cmp    $0x2f,%eax
+  801be7:	0f 87 aa 00 00 00    	ja     801c97 <vprintfmt+0x4ca>
+  801bed:	89 c2                	mov    %eax,%edx
+  801bef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bf3:	83 c0 08             	add    $0x8,%eax
+  801bf6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bf9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801bfc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c01:	e9 a3 01 00 00       	jmp    801da9 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c09:	83 f8 2f             	cmp    $0x2f,%eax
+  801c0c:	77 19                	ja     801c27 <vprintfmt+0x45a>
+  801c0e:	89 c2                	mov    %eax,%edx
+  801c10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c14:	83 c0 08             	add    $0x8,%eax
+  801c17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c1a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c1d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c22:	e9 82 01 00 00       	jmp    801da9 <vprintfmt+0x5dc>
+  801c27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c33:	eb e5                	jmp    801c1a <vprintfmt+0x44d>
+    switch (lflag) {
+  801c35:	83 fa 01             	cmp    $0x1,%edx
+  801c38:	75 a7                	jne    801be1 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c3d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c40:	77 47                	ja     801c89 <vprintfmt+0x4bc>
+  801c42:	89 c2                	mov    %eax,%edx
+  801c44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c48:	83 c0 08             	add    $0x8,%eax
+  801c4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c4e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c51:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c56:	e9 4e 01 00 00       	jmp    801da9 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c61:	77 18                	ja     801c7b <vprintfmt+0x4ae>
+  801c63:	89 c2                	mov    %eax,%edx
+  801c65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c69:	83 c0 08             	add    $0x8,%eax
+  801c6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c6f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c71:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c76:	e9 2e 01 00 00       	jmp    801da9 <vprintfmt+0x5dc>
+  801c7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c87:	eb e6                	jmp    801c6f <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801c89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c95:	eb b7                	jmp    801c4e <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801c97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca3:	e9 51 ff ff ff       	jmp    801bf9 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ca8:	40 84 f6             	test   %sil,%sil
+  801cab:	75 2e                	jne    801cdb <vprintfmt+0x50e>
+    switch (lflag) {
+  801cad:	85 d2                	test   %edx,%edx
+  801caf:	7f 59                	jg     801d0a <vprintfmt+0x53d>
+  801cb1:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cb4:	7d 77                	jge    801d2d <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb9:	83 f8 2f             	cmp    $0x2f,%eax
+  801cbc:	0f 87 a4 00 00 00    	ja     801d66 <vprintfmt+0x599>
+  801cc2:	89 c2                	mov    %eax,%edx
+  801cc4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cc8:	83 c0 08             	add    $0x8,%eax
+  801ccb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cd1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cd6:	e9 ce 00 00 00       	jmp    801da9 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cde:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce1:	77 19                	ja     801cfc <vprintfmt+0x52f>
+  801ce3:	89 c2                	mov    %eax,%edx
+  801ce5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ce9:	83 c0 08             	add    $0x8,%eax
+  801cec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cf2:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801cf7:	e9 ad 00 00 00       	jmp    801da9 <vprintfmt+0x5dc>
+  801cfc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d08:	eb e5                	jmp    801cef <vprintfmt+0x522>
+    switch (lflag) {
+  801d0a:	83 fa 01             	cmp    $0x1,%edx
+  801d0d:	75 a7                	jne    801cb6 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d12:	83 f8 2f             	cmp    $0x2f,%eax
+  801d15:	77 41                	ja     801d58 <vprintfmt+0x58b>
+  801d17:	89 c2                	mov    %eax,%edx
+  801d19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d1d:	83 c0 08             	add    $0x8,%eax
+  801d20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d23:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d26:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d2b:	eb 7c                	jmp    801da9 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d30:	83 f8 2f             	cmp    $0x2f,%eax
+  801d33:	77 15                	ja     801d4a <vprintfmt+0x57d>
+  801d35:	89 c2                	mov    %eax,%edx
+  801d37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d3b:	83 c0 08             	add    $0x8,%eax
+  801d3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d41:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d43:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d48:	eb 5f                	jmp    801da9 <vprintfmt+0x5dc>
+  801d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d56:	eb e9                	jmp    801d41 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d64:	eb bd                	jmp    801d23 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d72:	e9 57 ff ff ff       	jmp    801cce <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d77:	4c 89 ee             	mov    %r13,%rsi
+  801d7a:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d7f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801d82:	4c 89 ee             	mov    %r13,%rsi
+  801d85:	bf 78 00 00 00       	mov    $0x78,%edi
+  801d8a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801d8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d90:	83 f8 2f             	cmp    $0x2f,%eax
+  801d93:	77 47                	ja     801ddc <vprintfmt+0x60f>
+  801d95:	89 c2                	mov    %eax,%edx
+  801d97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9b:	83 c0 08             	add    $0x8,%eax
+  801d9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801da4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801da9:	48 83 ec 08          	sub    $0x8,%rsp
+  801dad:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801db1:	0f 94 c0             	sete   %al
+  801db4:	0f b6 c0             	movzbl %al,%eax
+  801db7:	50                   	push   %rax
+  801db8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801dbd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801dc1:	4c 89 ee             	mov    %r13,%rsi
+  801dc4:	4c 89 f7             	mov    %r14,%rdi
+  801dc7:	48 b8 c2 16 80 00 00 	movabs $0x8016c2,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+            break;
+  801dd3:	48 83 c4 10          	add    $0x10,%rsp
+  801dd7:	e9 31 fa ff ff       	jmp    80180d <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801ddc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801de0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801de4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801de8:	eb b7                	jmp    801da1 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801dea:	40 84 f6             	test   %sil,%sil
+  801ded:	75 2b                	jne    801e1a <vprintfmt+0x64d>
+    switch (lflag) {
+  801def:	85 d2                	test   %edx,%edx
+  801df1:	7f 56                	jg     801e49 <vprintfmt+0x67c>
+  801df3:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801df6:	7d 77                	jge    801e6f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801df8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dfb:	83 f8 2f             	cmp    $0x2f,%eax
+  801dfe:	0f 87 a7 00 00 00    	ja     801eab <vprintfmt+0x6de>
+  801e04:	89 c2                	mov    %eax,%edx
+  801e06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e0a:	83 c0 08             	add    $0x8,%eax
+  801e0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e13:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e18:	eb 8f                	jmp    801da9 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e20:	77 19                	ja     801e3b <vprintfmt+0x66e>
+  801e22:	89 c2                	mov    %eax,%edx
+  801e24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e28:	83 c0 08             	add    $0x8,%eax
+  801e2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e31:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e36:	e9 6e ff ff ff       	jmp    801da9 <vprintfmt+0x5dc>
+  801e3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e47:	eb e5                	jmp    801e2e <vprintfmt+0x661>
+    switch (lflag) {
+  801e49:	83 fa 01             	cmp    $0x1,%edx
+  801e4c:	75 aa                	jne    801df8 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e51:	83 f8 2f             	cmp    $0x2f,%eax
+  801e54:	77 47                	ja     801e9d <vprintfmt+0x6d0>
+  801e56:	89 c2                	mov    %eax,%edx
+  801e58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e5c:	83 c0 08             	add    $0x8,%eax
+  801e5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e65:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e6a:	e9 3a ff ff ff       	jmp    801da9 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e72:	83 f8 2f             	cmp    $0x2f,%eax
+  801e75:	77 18                	ja     801e8f <vprintfmt+0x6c2>
+  801e77:	89 c2                	mov    %eax,%edx
+  801e79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e7d:	83 c0 08             	add    $0x8,%eax
+  801e80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e83:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801e85:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801e8a:	e9 1a ff ff ff       	jmp    801da9 <vprintfmt+0x5dc>
+  801e8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9b:	eb e6                	jmp    801e83 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801e9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea9:	eb b7                	jmp    801e62 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801eab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb7:	e9 54 ff ff ff       	jmp    801e10 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801ebc:	4c 89 ee             	mov    %r13,%rsi
+  801ebf:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ec4:	41 ff d6             	call   *%r14
+            break;
+  801ec7:	e9 41 f9 ff ff       	jmp    80180d <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ecc:	4c 89 ee             	mov    %r13,%rsi
+  801ecf:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ed4:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ed7:	48 83 eb 01          	sub    $0x1,%rbx
+  801edb:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801edf:	75 f6                	jne    801ed7 <vprintfmt+0x70a>
+  801ee1:	e9 27 f9 ff ff       	jmp    80180d <vprintfmt+0x40>
+
+0000000000801ee6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801ee6:	55                   	push   %rbp
+  801ee7:	48 89 e5             	mov    %rsp,%rbp
+  801eea:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801eee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ef2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801ef7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801efb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f02:	48 85 ff             	test   %rdi,%rdi
+  801f05:	74 2b                	je     801f32 <vsnprintf+0x4c>
+  801f07:	48 85 f6             	test   %rsi,%rsi
+  801f0a:	74 26                	je     801f32 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f0c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f10:	48 bf 78 17 80 00 00 	movabs $0x801778,%rdi
+  801f17:	00 00 00 
+  801f1a:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  801f21:	00 00 00 
+  801f24:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f2a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f30:	c9                   	leave
+  801f31:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f37:	eb f7                	jmp    801f30 <vsnprintf+0x4a>
+
+0000000000801f39 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f39:	55                   	push   %rbp
+  801f3a:	48 89 e5             	mov    %rsp,%rbp
+  801f3d:	48 83 ec 50          	sub    $0x50,%rsp
+  801f41:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f45:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f49:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f4d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f54:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f5c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f60:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f64:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f68:	48 b8 e6 1e 80 00 00 	movabs $0x801ee6,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f74:	c9                   	leave
+  801f75:	c3                   	ret
+
+0000000000801f76 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f76:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f79:	74 10                	je     801f8b <strlen+0x15>
+    size_t n = 0;
+  801f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801f80:	48 83 c0 01          	add    $0x1,%rax
+  801f84:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801f88:	75 f6                	jne    801f80 <strlen+0xa>
+  801f8a:	c3                   	ret
+    size_t n = 0;
+  801f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801f90:	c3                   	ret
+
+0000000000801f91 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801f91:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801f94:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801f99:	48 85 f6             	test   %rsi,%rsi
+  801f9c:	74 11                	je     801faf <strnlen+0x1e>
+  801f9e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fa2:	74 0c                	je     801fb0 <strnlen+0x1f>
+  801fa4:	48 83 c2 01          	add    $0x1,%rdx
+  801fa8:	48 39 d0             	cmp    %rdx,%rax
+  801fab:	75 f1                	jne    801f9e <strnlen+0xd>
+  801fad:	eb 04                	jmp    801fb3 <strnlen+0x22>
+  801faf:	c3                   	ret
+  801fb0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fb3:	c3                   	ret
+
+0000000000801fb4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fb4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbc:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fc0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fc3:	48 83 c2 01          	add    $0x1,%rdx
+  801fc7:	84 c9                	test   %cl,%cl
+  801fc9:	75 f1                	jne    801fbc <strcpy+0x8>
+        ;
+    return res;
+}
+  801fcb:	c3                   	ret
+
+0000000000801fcc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fcc:	55                   	push   %rbp
+  801fcd:	48 89 e5             	mov    %rsp,%rbp
+  801fd0:	41 54                	push   %r12
+  801fd2:	53                   	push   %rbx
+  801fd3:	48 89 fb             	mov    %rdi,%rbx
+  801fd6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801fd9:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801fe5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801fe9:	4c 89 e6             	mov    %r12,%rsi
+  801fec:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  801ff3:	00 00 00 
+  801ff6:	ff d0                	call   *%rax
+    return dst;
+}
+  801ff8:	48 89 d8             	mov    %rbx,%rax
+  801ffb:	5b                   	pop    %rbx
+  801ffc:	41 5c                	pop    %r12
+  801ffe:	5d                   	pop    %rbp
+  801fff:	c3                   	ret
+
+0000000000802000 <toupper>:
+
+int
+toupper(int ch) {
+  802000:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802002:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802005:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802008:	83 f9 1a             	cmp    $0x1a,%ecx
+  80200b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80200e:	c3                   	ret
+
+000000000080200f <tolower>:
+
+int
+tolower(int ch) {
+  80200f:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802011:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802014:	8d 57 20             	lea    0x20(%rdi),%edx
+  802017:	83 f9 1a             	cmp    $0x1a,%ecx
+  80201a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80201d:	c3                   	ret
+
+000000000080201e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80201e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802021:	48 85 d2             	test   %rdx,%rdx
+  802024:	74 1f                	je     802045 <strncpy+0x27>
+  802026:	48 01 fa             	add    %rdi,%rdx
+  802029:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80202c:	48 83 c1 01          	add    $0x1,%rcx
+  802030:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802034:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802038:	41 80 f8 01          	cmp    $0x1,%r8b
+  80203c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802040:	48 39 ca             	cmp    %rcx,%rdx
+  802043:	75 e7                	jne    80202c <strncpy+0xe>
+    }
+    return ret;
+}
+  802045:	c3                   	ret
+
+0000000000802046 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802046:	48 89 f8             	mov    %rdi,%rax
+  802049:	48 85 d2             	test   %rdx,%rdx
+  80204c:	74 24                	je     802072 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80204e:	48 83 ea 01          	sub    $0x1,%rdx
+  802052:	74 1b                	je     80206f <strlcpy+0x29>
+  802054:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802058:	0f b6 16             	movzbl (%rsi),%edx
+  80205b:	84 d2                	test   %dl,%dl
+  80205d:	74 10                	je     80206f <strlcpy+0x29>
+            *dst++ = *src++;
+  80205f:	48 83 c6 01          	add    $0x1,%rsi
+  802063:	48 83 c0 01          	add    $0x1,%rax
+  802067:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80206a:	48 39 c8             	cmp    %rcx,%rax
+  80206d:	75 e9                	jne    802058 <strlcpy+0x12>
+        *dst = '\0';
+  80206f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802072:	48 29 f8             	sub    %rdi,%rax
+}
+  802075:	c3                   	ret
+
+0000000000802076 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802076:	0f b6 07             	movzbl (%rdi),%eax
+  802079:	84 c0                	test   %al,%al
+  80207b:	74 13                	je     802090 <strcmp+0x1a>
+  80207d:	38 06                	cmp    %al,(%rsi)
+  80207f:	75 0f                	jne    802090 <strcmp+0x1a>
+  802081:	48 83 c7 01          	add    $0x1,%rdi
+  802085:	48 83 c6 01          	add    $0x1,%rsi
+  802089:	0f b6 07             	movzbl (%rdi),%eax
+  80208c:	84 c0                	test   %al,%al
+  80208e:	75 ed                	jne    80207d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802090:	0f b6 c0             	movzbl %al,%eax
+  802093:	0f b6 16             	movzbl (%rsi),%edx
+  802096:	29 d0                	sub    %edx,%eax
+}
+  802098:	c3                   	ret
+
+0000000000802099 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802099:	48 85 d2             	test   %rdx,%rdx
+  80209c:	74 1f                	je     8020bd <strncmp+0x24>
+  80209e:	0f b6 07             	movzbl (%rdi),%eax
+  8020a1:	84 c0                	test   %al,%al
+  8020a3:	74 1e                	je     8020c3 <strncmp+0x2a>
+  8020a5:	3a 06                	cmp    (%rsi),%al
+  8020a7:	75 1a                	jne    8020c3 <strncmp+0x2a>
+  8020a9:	48 83 c7 01          	add    $0x1,%rdi
+  8020ad:	48 83 c6 01          	add    $0x1,%rsi
+  8020b1:	48 83 ea 01          	sub    $0x1,%rdx
+  8020b5:	75 e7                	jne    80209e <strncmp+0x5>
+
+    if (!n) return 0;
+  8020b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bc:	c3                   	ret
+  8020bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c2:	c3                   	ret
+  8020c3:	48 85 d2             	test   %rdx,%rdx
+  8020c6:	74 09                	je     8020d1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020c8:	0f b6 07             	movzbl (%rdi),%eax
+  8020cb:	0f b6 16             	movzbl (%rsi),%edx
+  8020ce:	29 d0                	sub    %edx,%eax
+  8020d0:	c3                   	ret
+    if (!n) return 0;
+  8020d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d6:	c3                   	ret
+
+00000000008020d7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020d7:	0f b6 17             	movzbl (%rdi),%edx
+  8020da:	84 d2                	test   %dl,%dl
+  8020dc:	74 18                	je     8020f6 <strchr+0x1f>
+        if (*str == c) {
+  8020de:	0f be d2             	movsbl %dl,%edx
+  8020e1:	39 f2                	cmp    %esi,%edx
+  8020e3:	74 17                	je     8020fc <strchr+0x25>
+    for (; *str; str++) {
+  8020e5:	48 83 c7 01          	add    $0x1,%rdi
+  8020e9:	0f b6 17             	movzbl (%rdi),%edx
+  8020ec:	84 d2                	test   %dl,%dl
+  8020ee:	75 ee                	jne    8020de <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8020f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f5:	c3                   	ret
+  8020f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fb:	c3                   	ret
+  8020fc:	48 89 f8             	mov    %rdi,%rax
+}
+  8020ff:	c3                   	ret
+
+0000000000802100 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802100:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802103:	0f b6 17             	movzbl (%rdi),%edx
+  802106:	84 d2                	test   %dl,%dl
+  802108:	74 13                	je     80211d <strfind+0x1d>
+  80210a:	0f be d2             	movsbl %dl,%edx
+  80210d:	39 f2                	cmp    %esi,%edx
+  80210f:	74 0b                	je     80211c <strfind+0x1c>
+  802111:	48 83 c0 01          	add    $0x1,%rax
+  802115:	0f b6 10             	movzbl (%rax),%edx
+  802118:	84 d2                	test   %dl,%dl
+  80211a:	75 ee                	jne    80210a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80211c:	c3                   	ret
+  80211d:	c3                   	ret
+
+000000000080211e <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80211e:	48 39 f7             	cmp    %rsi,%rdi
+  802121:	74 65                	je     802188 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802123:	55                   	push   %rbp
+  802124:	48 89 e5             	mov    %rsp,%rbp
+  802127:	41 57                	push   %r15
+  802129:	41 56                	push   %r14
+  80212b:	41 55                	push   %r13
+  80212d:	41 54                	push   %r12
+  80212f:	53                   	push   %rbx
+  802130:	48 83 ec 18          	sub    $0x18,%rsp
+  802134:	48 89 fb             	mov    %rdi,%rbx
+  802137:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80213a:	49 bf 0f 20 80 00 00 	movabs $0x80200f,%r15
+  802141:	00 00 00 
+  802144:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802148:	41 0f b6 fd          	movzbl %r13b,%edi
+  80214c:	41 ff d7             	call   *%r15
+  80214f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802152:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802157:	41 0f b6 fe          	movzbl %r14b,%edi
+  80215b:	41 ff d7             	call   *%r15
+  80215e:	89 c2                	mov    %eax,%edx
+  802160:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802163:	29 d0                	sub    %edx,%eax
+  802165:	75 12                	jne    802179 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802167:	48 83 c3 01          	add    $0x1,%rbx
+  80216b:	45 84 ed             	test   %r13b,%r13b
+  80216e:	74 09                	je     802179 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802170:	49 83 c4 01          	add    $0x1,%r12
+  802174:	45 84 f6             	test   %r14b,%r14b
+  802177:	75 cb                	jne    802144 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802179:	48 83 c4 18          	add    $0x18,%rsp
+  80217d:	5b                   	pop    %rbx
+  80217e:	41 5c                	pop    %r12
+  802180:	41 5d                	pop    %r13
+  802182:	41 5e                	pop    %r14
+  802184:	41 5f                	pop    %r15
+  802186:	5d                   	pop    %rbp
+  802187:	c3                   	ret
+    if (p1 == p2) return 0;
+  802188:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80218d:	c3                   	ret
+
+000000000080218e <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80218e:	48 39 f7             	cmp    %rsi,%rdi
+  802191:	74 7d                	je     802210 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802193:	55                   	push   %rbp
+  802194:	48 89 e5             	mov    %rsp,%rbp
+  802197:	41 57                	push   %r15
+  802199:	41 56                	push   %r14
+  80219b:	41 55                	push   %r13
+  80219d:	41 54                	push   %r12
+  80219f:	53                   	push   %rbx
+  8021a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a4:	48 89 fb             	mov    %rdi,%rbx
+  8021a7:	49 89 f4             	mov    %rsi,%r12
+  8021aa:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021b2:	49 bf 0f 20 80 00 00 	movabs $0x80200f,%r15
+  8021b9:	00 00 00 
+    while (n--) {
+  8021bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021c0:	48 39 c3             	cmp    %rax,%rbx
+  8021c3:	74 37                	je     8021fc <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021c5:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021c9:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021cd:	41 ff d7             	call   *%r15
+  8021d0:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021d3:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021d8:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021dc:	41 ff d7             	call   *%r15
+  8021df:	89 c2                	mov    %eax,%edx
+  8021e1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021e4:	29 d0                	sub    %edx,%eax
+  8021e6:	75 19                	jne    802201 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8021e8:	48 83 c3 01          	add    $0x1,%rbx
+  8021ec:	45 84 ed             	test   %r13b,%r13b
+  8021ef:	74 10                	je     802201 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8021f1:	49 83 c4 01          	add    $0x1,%r12
+  8021f5:	45 84 f6             	test   %r14b,%r14b
+  8021f8:	75 c2                	jne    8021bc <strncasecmp+0x2e>
+  8021fa:	eb 05                	jmp    802201 <strncasecmp+0x73>
+  8021fc:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802201:	48 83 c4 18          	add    $0x18,%rsp
+  802205:	5b                   	pop    %rbx
+  802206:	41 5c                	pop    %r12
+  802208:	41 5d                	pop    %r13
+  80220a:	41 5e                	pop    %r14
+  80220c:	41 5f                	pop    %r15
+  80220e:	5d                   	pop    %rbp
+  80220f:	c3                   	ret
+    if (p1 == p2) return 0;
+  802210:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802215:	c3                   	ret
+
+0000000000802216 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802216:	83 e7 df             	and    $0xffffffdf,%edi
+  802219:	83 ef 41             	sub    $0x41,%edi
+  80221c:	83 ff 19             	cmp    $0x19,%edi
+  80221f:	0f 96 c0             	setbe  %al
+}
+  802222:	c3                   	ret
+
+0000000000802223 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802223:	83 ff 20             	cmp    $0x20,%edi
+  802226:	0f 94 c0             	sete   %al
+  802229:	83 ff 09             	cmp    $0x9,%edi
+  80222c:	0f 94 c2             	sete   %dl
+  80222f:	09 d0                	or     %edx,%eax
+}
+  802231:	c3                   	ret
+
+0000000000802232 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802232:	55                   	push   %rbp
+  802233:	48 89 e5             	mov    %rsp,%rbp
+  802236:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802238:	48 bf 1f 61 80 00 00 	movabs $0x80611f,%rdi
+  80223f:	00 00 00 
+  802242:	48 b8 d7 20 80 00 00 	movabs $0x8020d7,%rax
+  802249:	00 00 00 
+  80224c:	ff d0                	call   *%rax
+  80224e:	48 85 c0             	test   %rax,%rax
+  802251:	0f 95 c0             	setne  %al
+}
+  802254:	5d                   	pop    %rbp
+  802255:	c3                   	ret
+
+0000000000802256 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802256:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802259:	48 89 f8             	mov    %rdi,%rax
+  80225c:	48 f7 d8             	neg    %rax
+  80225f:	83 e0 07             	and    $0x7,%eax
+  802262:	49 89 d1             	mov    %rdx,%r9
+  802265:	49 29 c1             	sub    %rax,%r9
+  802268:	78 36                	js     8022a0 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80226a:	40 0f b6 c6          	movzbl %sil,%eax
+  80226e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802275:	01 01 01 
+  802278:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80227c:	40 f6 c7 07          	test   $0x7,%dil
+  802280:	75 38                	jne    8022ba <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802282:	4c 89 c9             	mov    %r9,%rcx
+  802285:	48 c1 f9 03          	sar    $0x3,%rcx
+  802289:	74 0c                	je     802297 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80228b:	fc                   	cld
+  80228c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80228f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802293:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802297:	4d 85 c9             	test   %r9,%r9
+  80229a:	75 45                	jne    8022e1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80229c:	4c 89 c0             	mov    %r8,%rax
+  80229f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022a0:	48 85 d2             	test   %rdx,%rdx
+  8022a3:	74 f7                	je     80229c <memset+0x46>
+  8022a5:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022a8:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022ab:	48 83 c0 01          	add    $0x1,%rax
+  8022af:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022b3:	48 39 c2             	cmp    %rax,%rdx
+  8022b6:	75 f3                	jne    8022ab <memset+0x55>
+  8022b8:	eb e2                	jmp    80229c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022ba:	40 f6 c7 01          	test   $0x1,%dil
+  8022be:	74 06                	je     8022c6 <memset+0x70>
+  8022c0:	88 07                	mov    %al,(%rdi)
+  8022c2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022c6:	40 f6 c7 02          	test   $0x2,%dil
+  8022ca:	74 07                	je     8022d3 <memset+0x7d>
+  8022cc:	66 89 07             	mov    %ax,(%rdi)
+  8022cf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022d3:	40 f6 c7 04          	test   $0x4,%dil
+  8022d7:	74 a9                	je     802282 <memset+0x2c>
+  8022d9:	89 07                	mov    %eax,(%rdi)
+  8022db:	48 83 c7 04          	add    $0x4,%rdi
+  8022df:	eb a1                	jmp    802282 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022e1:	41 f6 c1 04          	test   $0x4,%r9b
+  8022e5:	74 06                	je     8022ed <memset+0x97>
+  8022e7:	89 07                	mov    %eax,(%rdi)
+  8022e9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022ed:	41 f6 c1 02          	test   $0x2,%r9b
+  8022f1:	74 07                	je     8022fa <memset+0xa4>
+  8022f3:	66 89 07             	mov    %ax,(%rdi)
+  8022f6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8022fa:	41 f6 c1 01          	test   $0x1,%r9b
+  8022fe:	74 9c                	je     80229c <memset+0x46>
+  802300:	88 07                	mov    %al,(%rdi)
+  802302:	eb 98                	jmp    80229c <memset+0x46>
+
+0000000000802304 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802304:	48 89 f8             	mov    %rdi,%rax
+  802307:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80230a:	48 39 fe             	cmp    %rdi,%rsi
+  80230d:	73 3b                	jae    80234a <memmove+0x46>
+  80230f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802313:	48 39 d7             	cmp    %rdx,%rdi
+  802316:	73 32                	jae    80234a <memmove+0x46>
+        s += n;
+        d += n;
+  802318:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80231c:	48 89 d6             	mov    %rdx,%rsi
+  80231f:	48 09 fe             	or     %rdi,%rsi
+  802322:	48 09 ce             	or     %rcx,%rsi
+  802325:	40 f6 c6 07          	test   $0x7,%sil
+  802329:	75 12                	jne    80233d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80232b:	48 83 ef 08          	sub    $0x8,%rdi
+  80232f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802333:	48 c1 e9 03          	shr    $0x3,%rcx
+  802337:	fd                   	std
+  802338:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80233b:	fc                   	cld
+  80233c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80233d:	48 83 ef 01          	sub    $0x1,%rdi
+  802341:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802345:	fd                   	std
+  802346:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802348:	eb f1                	jmp    80233b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80234a:	48 89 f2             	mov    %rsi,%rdx
+  80234d:	48 09 c2             	or     %rax,%rdx
+  802350:	48 09 ca             	or     %rcx,%rdx
+  802353:	f6 c2 07             	test   $0x7,%dl
+  802356:	75 0c                	jne    802364 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802358:	48 c1 e9 03          	shr    $0x3,%rcx
+  80235c:	48 89 c7             	mov    %rax,%rdi
+  80235f:	fc                   	cld
+  802360:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802363:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802364:	48 89 c7             	mov    %rax,%rdi
+  802367:	fc                   	cld
+  802368:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80236a:	c3                   	ret
+
+000000000080236b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80236b:	55                   	push   %rbp
+  80236c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80236f:	48 b8 04 23 80 00 00 	movabs $0x802304,%rax
+  802376:	00 00 00 
+  802379:	ff d0                	call   *%rax
+}
+  80237b:	5d                   	pop    %rbp
+  80237c:	c3                   	ret
+
+000000000080237d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80237d:	55                   	push   %rbp
+  80237e:	48 89 e5             	mov    %rsp,%rbp
+  802381:	41 57                	push   %r15
+  802383:	41 56                	push   %r14
+  802385:	41 55                	push   %r13
+  802387:	41 54                	push   %r12
+  802389:	53                   	push   %rbx
+  80238a:	48 83 ec 08          	sub    $0x8,%rsp
+  80238e:	49 89 fe             	mov    %rdi,%r14
+  802391:	49 89 f7             	mov    %rsi,%r15
+  802394:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802397:	48 89 f7             	mov    %rsi,%rdi
+  80239a:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+  8023a6:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023a9:	48 89 de             	mov    %rbx,%rsi
+  8023ac:	4c 89 f7             	mov    %r14,%rdi
+  8023af:	48 b8 91 1f 80 00 00 	movabs $0x801f91,%rax
+  8023b6:	00 00 00 
+  8023b9:	ff d0                	call   *%rax
+  8023bb:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023be:	48 39 c3             	cmp    %rax,%rbx
+  8023c1:	74 36                	je     8023f9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023c3:	48 89 d8             	mov    %rbx,%rax
+  8023c6:	4c 29 e8             	sub    %r13,%rax
+  8023c9:	49 39 c4             	cmp    %rax,%r12
+  8023cc:	73 31                	jae    8023ff <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023ce:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023d3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023d7:	4c 89 fe             	mov    %r15,%rsi
+  8023da:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8023e6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8023ea:	48 83 c4 08          	add    $0x8,%rsp
+  8023ee:	5b                   	pop    %rbx
+  8023ef:	41 5c                	pop    %r12
+  8023f1:	41 5d                	pop    %r13
+  8023f3:	41 5e                	pop    %r14
+  8023f5:	41 5f                	pop    %r15
+  8023f7:	5d                   	pop    %rbp
+  8023f8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023f9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8023fd:	eb eb                	jmp    8023ea <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8023ff:	48 83 eb 01          	sub    $0x1,%rbx
+  802403:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802407:	48 89 da             	mov    %rbx,%rdx
+  80240a:	4c 89 fe             	mov    %r15,%rsi
+  80240d:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  802414:	00 00 00 
+  802417:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802419:	49 01 de             	add    %rbx,%r14
+  80241c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802421:	eb c3                	jmp    8023e6 <strlcat+0x69>
+
+0000000000802423 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802423:	48 85 d2             	test   %rdx,%rdx
+  802426:	74 2d                	je     802455 <memcmp+0x32>
+  802428:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80242d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802431:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802436:	44 38 c1             	cmp    %r8b,%cl
+  802439:	75 0f                	jne    80244a <memcmp+0x27>
+    while (n-- > 0) {
+  80243b:	48 83 c0 01          	add    $0x1,%rax
+  80243f:	48 39 c2             	cmp    %rax,%rdx
+  802442:	75 e9                	jne    80242d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802444:	b8 00 00 00 00       	mov    $0x0,%eax
+  802449:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80244a:	0f b6 c1             	movzbl %cl,%eax
+  80244d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802451:	44 29 c0             	sub    %r8d,%eax
+  802454:	c3                   	ret
+    return 0;
+  802455:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80245a:	c3                   	ret
+
+000000000080245b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80245b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80245f:	48 39 c7             	cmp    %rax,%rdi
+  802462:	73 0f                	jae    802473 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802464:	40 38 37             	cmp    %sil,(%rdi)
+  802467:	74 0e                	je     802477 <memfind+0x1c>
+    for (; src < end; src++) {
+  802469:	48 83 c7 01          	add    $0x1,%rdi
+  80246d:	48 39 f8             	cmp    %rdi,%rax
+  802470:	75 f2                	jne    802464 <memfind+0x9>
+  802472:	c3                   	ret
+  802473:	48 89 f8             	mov    %rdi,%rax
+  802476:	c3                   	ret
+  802477:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80247a:	c3                   	ret
+
+000000000080247b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80247b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80247e:	0f b6 37             	movzbl (%rdi),%esi
+  802481:	40 80 fe 20          	cmp    $0x20,%sil
+  802485:	74 06                	je     80248d <strtol+0x12>
+  802487:	40 80 fe 09          	cmp    $0x9,%sil
+  80248b:	75 13                	jne    8024a0 <strtol+0x25>
+  80248d:	48 83 c7 01          	add    $0x1,%rdi
+  802491:	0f b6 37             	movzbl (%rdi),%esi
+  802494:	40 80 fe 20          	cmp    $0x20,%sil
+  802498:	74 f3                	je     80248d <strtol+0x12>
+  80249a:	40 80 fe 09          	cmp    $0x9,%sil
+  80249e:	74 ed                	je     80248d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024a0:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024a3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024a6:	3c 01                	cmp    $0x1,%al
+  8024a8:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024ac:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024b2:	75 0f                	jne    8024c3 <strtol+0x48>
+  8024b4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024b7:	74 14                	je     8024cd <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024b9:	85 d2                	test   %edx,%edx
+  8024bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024c0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024c3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024c8:	4c 63 ca             	movslq %edx,%r9
+  8024cb:	eb 36                	jmp    802503 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024cd:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024d1:	74 0f                	je     8024e2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024d3:	85 d2                	test   %edx,%edx
+  8024d5:	75 ec                	jne    8024c3 <strtol+0x48>
+        s++;
+  8024d7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024db:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8024e0:	eb e1                	jmp    8024c3 <strtol+0x48>
+        s += 2;
+  8024e2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8024e6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8024eb:	eb d6                	jmp    8024c3 <strtol+0x48>
+            dig -= '0';
+  8024ed:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8024f0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8024f4:	41 39 d0             	cmp    %edx,%r8d
+  8024f7:	7d 21                	jge    80251a <strtol+0x9f>
+        val = val * base + dig;
+  8024f9:	49 0f af c1          	imul   %r9,%rax
+  8024fd:	0f b6 c9             	movzbl %cl,%ecx
+  802500:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802503:	48 83 c7 01          	add    $0x1,%rdi
+  802507:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80250b:	80 f9 39             	cmp    $0x39,%cl
+  80250e:	76 dd                	jbe    8024ed <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802510:	80 f9 7b             	cmp    $0x7b,%cl
+  802513:	77 05                	ja     80251a <strtol+0x9f>
+            dig -= 'a' - 10;
+  802515:	83 e9 57             	sub    $0x57,%ecx
+  802518:	eb d6                	jmp    8024f0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80251a:	4d 85 d2             	test   %r10,%r10
+  80251d:	74 03                	je     802522 <strtol+0xa7>
+  80251f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802522:	48 89 c2             	mov    %rax,%rdx
+  802525:	48 f7 da             	neg    %rdx
+  802528:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80252c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802530:	c3                   	ret
+
+0000000000802531 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802531:	55                   	push   %rbp
+  802532:	48 89 e5             	mov    %rsp,%rbp
+  802535:	53                   	push   %rbx
+  802536:	48 89 fa             	mov    %rdi,%rdx
+  802539:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80253c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802541:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802546:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80254b:	be 00 00 00 00       	mov    $0x0,%esi
+  802550:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802556:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80255c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80255e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802562:	c9                   	leave
+  802563:	c3                   	ret
+
+0000000000802564 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802564:	55                   	push   %rbp
+  802565:	48 89 e5             	mov    %rsp,%rbp
+  802568:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802569:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80256e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802573:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802578:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80257d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802582:	be 00 00 00 00       	mov    $0x0,%esi
+  802587:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80258d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802593:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802595:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802599:	c9                   	leave
+  80259a:	c3                   	ret
+
+000000000080259b <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80259b:	55                   	push   %rbp
+  80259c:	48 89 e5             	mov    %rsp,%rbp
+  80259f:	53                   	push   %rbx
+  8025a0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025a3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025c8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025ce:	c9                   	leave
+  8025cf:	c3                   	ret
+
+00000000008025d0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025d0:	55                   	push   %rbp
+  8025d1:	48 89 e5             	mov    %rsp,%rbp
+  8025d4:	53                   	push   %rbx
+  8025d5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025dc:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802601:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802603:	48 85 c0             	test   %rax,%rax
+  802606:	7f 06                	jg     80260e <sys_env_destroy+0x3e>
+}
+  802608:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80260c:	c9                   	leave
+  80260d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80260e:	49 89 c0             	mov    %rax,%r8
+  802611:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802616:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80261d:	00 00 00 
+  802620:	be 27 00 00 00       	mov    $0x27,%esi
+  802625:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  80262c:	00 00 00 
+  80262f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802634:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  80263b:	00 00 00 
+  80263e:	41 ff d1             	call   *%r9
+
+0000000000802641 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802641:	55                   	push   %rbp
+  802642:	48 89 e5             	mov    %rsp,%rbp
+  802645:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802646:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80264b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802650:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802655:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80265a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80265f:	be 00 00 00 00       	mov    $0x0,%esi
+  802664:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80266a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802670:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802672:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802676:	c9                   	leave
+  802677:	c3                   	ret
+
+0000000000802678 <sys_yield>:
+
+void
+sys_yield(void) {
+  802678:	55                   	push   %rbp
+  802679:	48 89 e5             	mov    %rsp,%rbp
+  80267c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80267d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802682:	ba 00 00 00 00       	mov    $0x0,%edx
+  802687:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80268c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802691:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802696:	be 00 00 00 00       	mov    $0x0,%esi
+  80269b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026a7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ad:	c9                   	leave
+  8026ae:	c3                   	ret
+
+00000000008026af <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026af:	55                   	push   %rbp
+  8026b0:	48 89 e5             	mov    %rsp,%rbp
+  8026b3:	53                   	push   %rbx
+  8026b4:	48 89 fa             	mov    %rdi,%rdx
+  8026b7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026ba:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026bf:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026c6:	00 00 00 
+  8026c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026df:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8026e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e5:	c9                   	leave
+  8026e6:	c3                   	ret
+
+00000000008026e7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8026e7:	55                   	push   %rbp
+  8026e8:	48 89 e5             	mov    %rsp,%rbp
+  8026eb:	53                   	push   %rbx
+  8026ec:	49 89 f8             	mov    %rdi,%r8
+  8026ef:	48 89 d3             	mov    %rdx,%rbx
+  8026f2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8026f5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026fa:	4c 89 c2             	mov    %r8,%rdx
+  8026fd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802700:	be 00 00 00 00       	mov    $0x0,%esi
+  802705:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80270b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802711:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802713:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802717:	c9                   	leave
+  802718:	c3                   	ret
+
+0000000000802719 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802719:	55                   	push   %rbp
+  80271a:	48 89 e5             	mov    %rsp,%rbp
+  80271d:	53                   	push   %rbx
+  80271e:	48 83 ec 08          	sub    $0x8,%rsp
+  802722:	89 f8                	mov    %edi,%eax
+  802724:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802727:	48 63 f9             	movslq %ecx,%rdi
+  80272a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80272d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802732:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802735:	be 00 00 00 00       	mov    $0x0,%esi
+  80273a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802740:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802746:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802748:	48 85 c0             	test   %rax,%rax
+  80274b:	7f 06                	jg     802753 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80274d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802751:	c9                   	leave
+  802752:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802753:	49 89 c0             	mov    %rax,%r8
+  802756:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80275b:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802762:	00 00 00 
+  802765:	be 27 00 00 00       	mov    $0x27,%esi
+  80276a:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802771:	00 00 00 
+  802774:	b8 00 00 00 00       	mov    $0x0,%eax
+  802779:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802780:	00 00 00 
+  802783:	41 ff d1             	call   *%r9
+
+0000000000802786 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802786:	55                   	push   %rbp
+  802787:	48 89 e5             	mov    %rsp,%rbp
+  80278a:	53                   	push   %rbx
+  80278b:	48 83 ec 08          	sub    $0x8,%rsp
+  80278f:	89 f8                	mov    %edi,%eax
+  802791:	49 89 f2             	mov    %rsi,%r10
+  802794:	48 89 cf             	mov    %rcx,%rdi
+  802797:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80279a:	48 63 da             	movslq %edx,%rbx
+  80279d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a0:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027a5:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027a8:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027b3:	48 85 c0             	test   %rax,%rax
+  8027b6:	7f 06                	jg     8027be <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027bc:	c9                   	leave
+  8027bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027be:	49 89 c0             	mov    %rax,%r8
+  8027c1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027c6:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8027cd:	00 00 00 
+  8027d0:	be 27 00 00 00       	mov    $0x27,%esi
+  8027d5:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8027dc:	00 00 00 
+  8027df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e4:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  8027eb:	00 00 00 
+  8027ee:	41 ff d1             	call   *%r9
+
+00000000008027f1 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8027f1:	55                   	push   %rbp
+  8027f2:	48 89 e5             	mov    %rsp,%rbp
+  8027f5:	53                   	push   %rbx
+  8027f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fa:	48 89 f1             	mov    %rsi,%rcx
+  8027fd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802800:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802803:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802808:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80280d:	be 00 00 00 00       	mov    $0x0,%esi
+  802812:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802818:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80281e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802820:	48 85 c0             	test   %rax,%rax
+  802823:	7f 06                	jg     80282b <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802825:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802829:	c9                   	leave
+  80282a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80282b:	49 89 c0             	mov    %rax,%r8
+  80282e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802833:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  80283a:	00 00 00 
+  80283d:	be 27 00 00 00       	mov    $0x27,%esi
+  802842:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802849:	00 00 00 
+  80284c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802851:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802858:	00 00 00 
+  80285b:	41 ff d1             	call   *%r9
+
+000000000080285e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80285e:	55                   	push   %rbp
+  80285f:	48 89 e5             	mov    %rsp,%rbp
+  802862:	53                   	push   %rbx
+  802863:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802867:	48 63 ce             	movslq %esi,%rcx
+  80286a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80286d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802872:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802877:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80287c:	be 00 00 00 00       	mov    $0x0,%esi
+  802881:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802887:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80288d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80288f:	48 85 c0             	test   %rax,%rax
+  802892:	7f 06                	jg     80289a <sys_env_set_status+0x3c>
+}
+  802894:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802898:	c9                   	leave
+  802899:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80289a:	49 89 c0             	mov    %rax,%r8
+  80289d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028a2:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8028a9:	00 00 00 
+  8028ac:	be 27 00 00 00       	mov    $0x27,%esi
+  8028b1:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  8028b8:	00 00 00 
+  8028bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c0:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  8028c7:	00 00 00 
+  8028ca:	41 ff d1             	call   *%r9
+
+00000000008028cd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028cd:	55                   	push   %rbp
+  8028ce:	48 89 e5             	mov    %rsp,%rbp
+  8028d1:	53                   	push   %rbx
+  8028d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028fe:	48 85 c0             	test   %rax,%rax
+  802901:	7f 06                	jg     802909 <sys_env_set_trapframe+0x3c>
+}
+  802903:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802907:	c9                   	leave
+  802908:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802909:	49 89 c0             	mov    %rax,%r8
+  80290c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802911:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802918:	00 00 00 
+  80291b:	be 27 00 00 00       	mov    $0x27,%esi
+  802920:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802927:	00 00 00 
+  80292a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292f:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802936:	00 00 00 
+  802939:	41 ff d1             	call   *%r9
+
+000000000080293c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80293c:	55                   	push   %rbp
+  80293d:	48 89 e5             	mov    %rsp,%rbp
+  802940:	53                   	push   %rbx
+  802941:	48 83 ec 08          	sub    $0x8,%rsp
+  802945:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802948:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80294b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802950:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802955:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80295a:	be 00 00 00 00       	mov    $0x0,%esi
+  80295f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802965:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80296b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80296d:	48 85 c0             	test   %rax,%rax
+  802970:	7f 06                	jg     802978 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802972:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802976:	c9                   	leave
+  802977:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802978:	49 89 c0             	mov    %rax,%r8
+  80297b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802980:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802987:	00 00 00 
+  80298a:	be 27 00 00 00       	mov    $0x27,%esi
+  80298f:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802996:	00 00 00 
+  802999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299e:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  8029a5:	00 00 00 
+  8029a8:	41 ff d1             	call   *%r9
+
+00000000008029ab <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029ab:	55                   	push   %rbp
+  8029ac:	48 89 e5             	mov    %rsp,%rbp
+  8029af:	53                   	push   %rbx
+  8029b0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029b4:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029bb:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8029cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029dd:	48 85 c0             	test   %rax,%rax
+  8029e0:	7f 06                	jg     8029e8 <sys_env_set_reclaim+0x3d>
+}
+  8029e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e6:	c9                   	leave
+  8029e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e8:	49 89 c0             	mov    %rax,%r8
+  8029eb:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8029f0:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  8029f7:	00 00 00 
+  8029fa:	be 27 00 00 00       	mov    $0x27,%esi
+  8029ff:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a06:	00 00 00 
+  802a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0e:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802a15:	00 00 00 
+  802a18:	41 ff d1             	call   *%r9
+
+0000000000802a1b <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a1b:	55                   	push   %rbp
+  802a1c:	48 89 e5             	mov    %rsp,%rbp
+  802a1f:	53                   	push   %rbx
+  802a20:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a24:	48 63 ce             	movslq %esi,%rcx
+  802a27:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a2a:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a34:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a39:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a44:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a4a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a4c:	48 85 c0             	test   %rax,%rax
+  802a4f:	7f 06                	jg     802a57 <sys_env_set_nice+0x3c>
+}
+  802a51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a55:	c9                   	leave
+  802a56:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a57:	49 89 c0             	mov    %rax,%r8
+  802a5a:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a5f:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802a66:	00 00 00 
+  802a69:	be 27 00 00 00       	mov    $0x27,%esi
+  802a6e:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802a75:	00 00 00 
+  802a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7d:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802a84:	00 00 00 
+  802a87:	41 ff d1             	call   *%r9
+
+0000000000802a8a <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802a8a:	55                   	push   %rbp
+  802a8b:	48 89 e5             	mov    %rsp,%rbp
+  802a8e:	53                   	push   %rbx
+  802a8f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a92:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a97:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  802aab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab7:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ab9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802abd:	c9                   	leave
+  802abe:	c3                   	ret
+
+0000000000802abf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802abf:	55                   	push   %rbp
+  802ac0:	48 89 e5             	mov    %rsp,%rbp
+  802ac3:	53                   	push   %rbx
+  802ac4:	89 f8                	mov    %edi,%eax
+  802ac6:	49 89 f1             	mov    %rsi,%r9
+  802ac9:	48 89 d3             	mov    %rdx,%rbx
+  802acc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802acf:	49 63 f0             	movslq %r8d,%rsi
+  802ad2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ad5:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ada:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802add:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ae9:	cd 30                	int    $0x30
+}
+  802aeb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aef:	c9                   	leave
+  802af0:	c3                   	ret
+
+0000000000802af1 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802af1:	55                   	push   %rbp
+  802af2:	48 89 e5             	mov    %rsp,%rbp
+  802af5:	53                   	push   %rbx
+  802af6:	89 f8                	mov    %edi,%eax
+  802af8:	49 89 f1             	mov    %rsi,%r9
+  802afb:	48 89 d3             	mov    %rdx,%rbx
+  802afe:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b01:	49 63 f0             	movslq %r8d,%rsi
+  802b04:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b07:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b0c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b15:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1b:	cd 30                	int    $0x30
+}
+  802b1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+
+0000000000802b23 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b23:	55                   	push   %rbp
+  802b24:	48 89 e5             	mov    %rsp,%rbp
+  802b27:	53                   	push   %rbx
+  802b28:	48 83 ec 08          	sub    $0x8,%rsp
+  802b2c:	89 f8                	mov    %edi,%eax
+  802b2e:	49 89 f2             	mov    %rsi,%r10
+  802b31:	48 89 d3             	mov    %rdx,%rbx
+  802b34:	48 89 cf             	mov    %rcx,%rdi
+  802b37:	44 89 c6             	mov    %r8d,%esi
+  802b3a:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b3d:	48 63 f6             	movslq %esi,%rsi
+  802b40:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b43:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b48:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b4b:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b4f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b51:	48 85 c0             	test   %rax,%rax
+  802b54:	7f 06                	jg     802b5c <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b5c:	49 89 c0             	mov    %rax,%r8
+  802b5f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b64:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802b6b:	00 00 00 
+  802b6e:	be 27 00 00 00       	mov    $0x27,%esi
+  802b73:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802b7a:	00 00 00 
+  802b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b82:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802b89:	00 00 00 
+  802b8c:	41 ff d1             	call   *%r9
+
+0000000000802b8f <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802b8f:	55                   	push   %rbp
+  802b90:	48 89 e5             	mov    %rsp,%rbp
+  802b93:	53                   	push   %rbx
+  802b94:	48 83 ec 08          	sub    $0x8,%rsp
+  802b98:	48 89 f1             	mov    %rsi,%rcx
+  802b9b:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802b9e:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802ba2:	48 8b 1a             	mov    (%rdx),%rbx
+  802ba5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ba8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bad:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bb1:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bb5:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bb9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bbb:	48 85 c0             	test   %rax,%rax
+  802bbe:	7f 06                	jg     802bc6 <sys_ipc_call_short+0x37>
+}
+  802bc0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bc4:	c9                   	leave
+  802bc5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bc6:	49 89 c0             	mov    %rax,%r8
+  802bc9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bce:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802bd5:	00 00 00 
+  802bd8:	be 27 00 00 00       	mov    $0x27,%esi
+  802bdd:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802be4:	00 00 00 
+  802be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bec:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802bf3:	00 00 00 
+  802bf6:	41 ff d1             	call   *%r9
+
+0000000000802bf9 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802bf9:	55                   	push   %rbp
+  802bfa:	48 89 e5             	mov    %rsp,%rbp
+  802bfd:	53                   	push   %rbx
+  802bfe:	48 83 ec 08          	sub    $0x8,%rsp
+  802c02:	89 f8                	mov    %edi,%eax
+  802c04:	49 89 f2             	mov    %rsi,%r10
+  802c07:	48 89 d3             	mov    %rdx,%rbx
+  802c0a:	48 89 cf             	mov    %rcx,%rdi
+  802c0d:	44 89 c6             	mov    %r8d,%esi
+  802c10:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c13:	48 63 f6             	movslq %esi,%rsi
+  802c16:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c19:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1e:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c21:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c25:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c27:	48 85 c0             	test   %rax,%rax
+  802c2a:	7f 06                	jg     802c32 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c2c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c30:	c9                   	leave
+  802c31:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c32:	49 89 c0             	mov    %rax,%r8
+  802c35:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c3a:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802c41:	00 00 00 
+  802c44:	be 27 00 00 00       	mov    $0x27,%esi
+  802c49:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802c50:	00 00 00 
+  802c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c58:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802c5f:	00 00 00 
+  802c62:	41 ff d1             	call   *%r9
+
+0000000000802c65 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c65:	55                   	push   %rbp
+  802c66:	48 89 e5             	mov    %rsp,%rbp
+  802c69:	53                   	push   %rbx
+  802c6a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c6e:	48 89 fa             	mov    %rdi,%rdx
+  802c71:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c74:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c83:	be 00 00 00 00       	mov    $0x0,%esi
+  802c88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c8e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c94:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c96:	48 85 c0             	test   %rax,%rax
+  802c99:	7f 06                	jg     802ca1 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c9f:	c9                   	leave
+  802ca0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ca1:	49 89 c0             	mov    %rax,%r8
+  802ca4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ca9:	48 ba 28 61 80 00 00 	movabs $0x806128,%rdx
+  802cb0:	00 00 00 
+  802cb3:	be 27 00 00 00       	mov    $0x27,%esi
+  802cb8:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  802cbf:	00 00 00 
+  802cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc7:	49 b9 6b 50 80 00 00 	movabs $0x80506b,%r9
+  802cce:	00 00 00 
+  802cd1:	41 ff d1             	call   *%r9
+
+0000000000802cd4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cd4:	55                   	push   %rbp
+  802cd5:	48 89 e5             	mov    %rsp,%rbp
+  802cd8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cd9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ce8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ced:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cf2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cfd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d03:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d09:	c9                   	leave
+  802d0a:	c3                   	ret
+
+0000000000802d0b <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d0b:	55                   	push   %rbp
+  802d0c:	48 89 e5             	mov    %rsp,%rbp
+  802d0f:	53                   	push   %rbx
+  802d10:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d13:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d18:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d22:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d27:	be 00 00 00 00       	mov    $0x0,%esi
+  802d2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d32:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d38:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3e:	c9                   	leave
+  802d3f:	c3                   	ret
+
+0000000000802d40 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d40:	55                   	push   %rbp
+  802d41:	48 89 e5             	mov    %rsp,%rbp
+  802d44:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d45:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d59:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d69:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d6f:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d71:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d75:	c9                   	leave
+  802d76:	c3                   	ret
+
+0000000000802d77 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d77:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d7e:	ff ff ff 
+  802d81:	48 01 f8             	add    %rdi,%rax
+  802d84:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802d88:	c3                   	ret
+
+0000000000802d89 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d89:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d90:	ff ff ff 
+  802d93:	48 01 f8             	add    %rdi,%rax
+  802d96:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802d9a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802da0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802da4:	c3                   	ret
+
+0000000000802da5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802da5:	55                   	push   %rbp
+  802da6:	48 89 e5             	mov    %rsp,%rbp
+  802da9:	41 57                	push   %r15
+  802dab:	41 56                	push   %r14
+  802dad:	41 55                	push   %r13
+  802daf:	41 54                	push   %r12
+  802db1:	53                   	push   %rbx
+  802db2:	48 83 ec 08          	sub    $0x8,%rsp
+  802db6:	49 89 ff             	mov    %rdi,%r15
+  802db9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802dbe:	49 bd a5 42 80 00 00 	movabs $0x8042a5,%r13
+  802dc5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802dc8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802dce:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802dd1:	48 89 df             	mov    %rbx,%rdi
+  802dd4:	41 ff d5             	call   *%r13
+  802dd7:	83 e0 04             	and    $0x4,%eax
+  802dda:	74 17                	je     802df3 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802ddc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802de3:	4c 39 f3             	cmp    %r14,%rbx
+  802de6:	75 e6                	jne    802dce <fd_alloc+0x29>
+  802de8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802dee:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802df3:	4d 89 27             	mov    %r12,(%r15)
+}
+  802df6:	48 83 c4 08          	add    $0x8,%rsp
+  802dfa:	5b                   	pop    %rbx
+  802dfb:	41 5c                	pop    %r12
+  802dfd:	41 5d                	pop    %r13
+  802dff:	41 5e                	pop    %r14
+  802e01:	41 5f                	pop    %r15
+  802e03:	5d                   	pop    %rbp
+  802e04:	c3                   	ret
+
+0000000000802e05 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e05:	83 ff 1f             	cmp    $0x1f,%edi
+  802e08:	77 39                	ja     802e43 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e0a:	55                   	push   %rbp
+  802e0b:	48 89 e5             	mov    %rsp,%rbp
+  802e0e:	41 54                	push   %r12
+  802e10:	53                   	push   %rbx
+  802e11:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e14:	48 63 df             	movslq %edi,%rbx
+  802e17:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e1e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e22:	48 89 df             	mov    %rbx,%rdi
+  802e25:	48 b8 a5 42 80 00 00 	movabs $0x8042a5,%rax
+  802e2c:	00 00 00 
+  802e2f:	ff d0                	call   *%rax
+  802e31:	a8 04                	test   $0x4,%al
+  802e33:	74 14                	je     802e49 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e35:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e3e:	5b                   	pop    %rbx
+  802e3f:	41 5c                	pop    %r12
+  802e41:	5d                   	pop    %rbp
+  802e42:	c3                   	ret
+        return -E_INVAL;
+  802e43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e48:	c3                   	ret
+        return -E_INVAL;
+  802e49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e4e:	eb ee                	jmp    802e3e <fd_lookup+0x39>
+
+0000000000802e50 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e50:	55                   	push   %rbp
+  802e51:	48 89 e5             	mov    %rsp,%rbp
+  802e54:	41 54                	push   %r12
+  802e56:	53                   	push   %rbx
+  802e57:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e5a:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802e61:	00 00 00 
+  802e64:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e6b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e6e:	39 3b                	cmp    %edi,(%rbx)
+  802e70:	74 47                	je     802eb9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e72:	48 83 c0 08          	add    $0x8,%rax
+  802e76:	48 8b 18             	mov    (%rax),%rbx
+  802e79:	48 85 db             	test   %rbx,%rbx
+  802e7c:	75 f0                	jne    802e6e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e7e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e85:	00 00 00 
+  802e88:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e8e:	89 fa                	mov    %edi,%edx
+  802e90:	48 bf 58 61 80 00 00 	movabs $0x806158,%rdi
+  802e97:	00 00 00 
+  802e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9f:	48 b9 7d 16 80 00 00 	movabs $0x80167d,%rcx
+  802ea6:	00 00 00 
+  802ea9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802eab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802eb0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802eb4:	5b                   	pop    %rbx
+  802eb5:	41 5c                	pop    %r12
+  802eb7:	5d                   	pop    %rbp
+  802eb8:	c3                   	ret
+            return 0;
+  802eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebe:	eb f0                	jmp    802eb0 <dev_lookup+0x60>
+
+0000000000802ec0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ec0:	55                   	push   %rbp
+  802ec1:	48 89 e5             	mov    %rsp,%rbp
+  802ec4:	41 55                	push   %r13
+  802ec6:	41 54                	push   %r12
+  802ec8:	53                   	push   %rbx
+  802ec9:	48 83 ec 18          	sub    $0x18,%rsp
+  802ecd:	48 89 fb             	mov    %rdi,%rbx
+  802ed0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ed3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802eda:	ff ff ff 
+  802edd:	48 01 df             	add    %rbx,%rdi
+  802ee0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802ee4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ee8:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  802eef:	00 00 00 
+  802ef2:	ff d0                	call   *%rax
+  802ef4:	41 89 c5             	mov    %eax,%r13d
+  802ef7:	85 c0                	test   %eax,%eax
+  802ef9:	78 06                	js     802f01 <fd_close+0x41>
+  802efb:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802eff:	74 1a                	je     802f1b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f01:	45 84 e4             	test   %r12b,%r12b
+  802f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f09:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f0d:	44 89 e8             	mov    %r13d,%eax
+  802f10:	48 83 c4 18          	add    $0x18,%rsp
+  802f14:	5b                   	pop    %rbx
+  802f15:	41 5c                	pop    %r12
+  802f17:	41 5d                	pop    %r13
+  802f19:	5d                   	pop    %rbp
+  802f1a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f1b:	8b 3b                	mov    (%rbx),%edi
+  802f1d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f21:	48 b8 50 2e 80 00 00 	movabs $0x802e50,%rax
+  802f28:	00 00 00 
+  802f2b:	ff d0                	call   *%rax
+  802f2d:	41 89 c5             	mov    %eax,%r13d
+  802f30:	85 c0                	test   %eax,%eax
+  802f32:	78 1b                	js     802f4f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f38:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f3c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f42:	48 85 c0             	test   %rax,%rax
+  802f45:	74 08                	je     802f4f <fd_close+0x8f>
+  802f47:	48 89 df             	mov    %rbx,%rdi
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f4f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f54:	48 89 de             	mov    %rbx,%rsi
+  802f57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5c:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  802f63:	00 00 00 
+  802f66:	ff d0                	call   *%rax
+    return res;
+  802f68:	eb a3                	jmp    802f0d <fd_close+0x4d>
+
+0000000000802f6a <close>:
+
+int
+close(int fdnum) {
+  802f6a:	55                   	push   %rbp
+  802f6b:	48 89 e5             	mov    %rsp,%rbp
+  802f6e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f72:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f76:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  802f7d:	00 00 00 
+  802f80:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f82:	85 c0                	test   %eax,%eax
+  802f84:	78 15                	js     802f9b <close+0x31>
+
+    return fd_close(fd, 1);
+  802f86:	be 01 00 00 00       	mov    $0x1,%esi
+  802f8b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f8f:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  802f96:	00 00 00 
+  802f99:	ff d0                	call   *%rax
+}
+  802f9b:	c9                   	leave
+  802f9c:	c3                   	ret
+
+0000000000802f9d <close_all>:
+
+void
+close_all(void) {
+  802f9d:	55                   	push   %rbp
+  802f9e:	48 89 e5             	mov    %rsp,%rbp
+  802fa1:	41 54                	push   %r12
+  802fa3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa9:	49 bc 6a 2f 80 00 00 	movabs $0x802f6a,%r12
+  802fb0:	00 00 00 
+  802fb3:	89 df                	mov    %ebx,%edi
+  802fb5:	41 ff d4             	call   *%r12
+  802fb8:	83 c3 01             	add    $0x1,%ebx
+  802fbb:	83 fb 20             	cmp    $0x20,%ebx
+  802fbe:	75 f3                	jne    802fb3 <close_all+0x16>
+}
+  802fc0:	5b                   	pop    %rbx
+  802fc1:	41 5c                	pop    %r12
+  802fc3:	5d                   	pop    %rbp
+  802fc4:	c3                   	ret
+
+0000000000802fc5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fc5:	55                   	push   %rbp
+  802fc6:	48 89 e5             	mov    %rsp,%rbp
+  802fc9:	41 57                	push   %r15
+  802fcb:	41 56                	push   %r14
+  802fcd:	41 55                	push   %r13
+  802fcf:	41 54                	push   %r12
+  802fd1:	53                   	push   %rbx
+  802fd2:	48 83 ec 18          	sub    $0x18,%rsp
+  802fd6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802fd9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802fdd:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  802fe4:	00 00 00 
+  802fe7:	ff d0                	call   *%rax
+  802fe9:	89 c3                	mov    %eax,%ebx
+  802feb:	85 c0                	test   %eax,%eax
+  802fed:	0f 88 b8 00 00 00    	js     8030ab <dup+0xe6>
+    close(newfdnum);
+  802ff3:	44 89 e7             	mov    %r12d,%edi
+  802ff6:	48 b8 6a 2f 80 00 00 	movabs $0x802f6a,%rax
+  802ffd:	00 00 00 
+  803000:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803002:	4d 63 ec             	movslq %r12d,%r13
+  803005:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80300c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803010:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803014:	4c 89 ff             	mov    %r15,%rdi
+  803017:	49 be 89 2d 80 00 00 	movabs $0x802d89,%r14
+  80301e:	00 00 00 
+  803021:	41 ff d6             	call   *%r14
+  803024:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803027:	4c 89 ef             	mov    %r13,%rdi
+  80302a:	41 ff d6             	call   *%r14
+  80302d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803030:	48 89 df             	mov    %rbx,%rdi
+  803033:	48 b8 a5 42 80 00 00 	movabs $0x8042a5,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80303f:	a8 04                	test   $0x4,%al
+  803041:	74 2b                	je     80306e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803043:	41 89 c1             	mov    %eax,%r9d
+  803046:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80304c:	4c 89 f1             	mov    %r14,%rcx
+  80304f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803054:	48 89 de             	mov    %rbx,%rsi
+  803057:	bf 00 00 00 00       	mov    $0x0,%edi
+  80305c:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+  803068:	89 c3                	mov    %eax,%ebx
+  80306a:	85 c0                	test   %eax,%eax
+  80306c:	78 4e                	js     8030bc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80306e:	4c 89 ff             	mov    %r15,%rdi
+  803071:	48 b8 a5 42 80 00 00 	movabs $0x8042a5,%rax
+  803078:	00 00 00 
+  80307b:	ff d0                	call   *%rax
+  80307d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803080:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803086:	4c 89 e9             	mov    %r13,%rcx
+  803089:	ba 00 00 00 00       	mov    $0x0,%edx
+  80308e:	4c 89 fe             	mov    %r15,%rsi
+  803091:	bf 00 00 00 00       	mov    $0x0,%edi
+  803096:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  80309d:	00 00 00 
+  8030a0:	ff d0                	call   *%rax
+  8030a2:	89 c3                	mov    %eax,%ebx
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	78 14                	js     8030bc <dup+0xf7>
+
+    return newfdnum;
+  8030a8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030ab:	89 d8                	mov    %ebx,%eax
+  8030ad:	48 83 c4 18          	add    $0x18,%rsp
+  8030b1:	5b                   	pop    %rbx
+  8030b2:	41 5c                	pop    %r12
+  8030b4:	41 5d                	pop    %r13
+  8030b6:	41 5e                	pop    %r14
+  8030b8:	41 5f                	pop    %r15
+  8030ba:	5d                   	pop    %rbp
+  8030bb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030c1:	4c 89 ee             	mov    %r13,%rsi
+  8030c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c9:	49 bc f1 27 80 00 00 	movabs $0x8027f1,%r12
+  8030d0:	00 00 00 
+  8030d3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030db:	4c 89 f6             	mov    %r14,%rsi
+  8030de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e3:	41 ff d4             	call   *%r12
+    return res;
+  8030e6:	eb c3                	jmp    8030ab <dup+0xe6>
+
+00000000008030e8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030e8:	55                   	push   %rbp
+  8030e9:	48 89 e5             	mov    %rsp,%rbp
+  8030ec:	41 56                	push   %r14
+  8030ee:	41 55                	push   %r13
+  8030f0:	41 54                	push   %r12
+  8030f2:	53                   	push   %rbx
+  8030f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8030f7:	89 fb                	mov    %edi,%ebx
+  8030f9:	49 89 f4             	mov    %rsi,%r12
+  8030fc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030ff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803103:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  80310a:	00 00 00 
+  80310d:	ff d0                	call   *%rax
+  80310f:	85 c0                	test   %eax,%eax
+  803111:	78 4c                	js     80315f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803113:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803117:	41 8b 3e             	mov    (%r14),%edi
+  80311a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80311e:	48 b8 50 2e 80 00 00 	movabs $0x802e50,%rax
+  803125:	00 00 00 
+  803128:	ff d0                	call   *%rax
+  80312a:	85 c0                	test   %eax,%eax
+  80312c:	78 35                	js     803163 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80312e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803132:	83 e0 03             	and    $0x3,%eax
+  803135:	83 f8 01             	cmp    $0x1,%eax
+  803138:	74 2d                	je     803167 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80313a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803142:	48 85 c0             	test   %rax,%rax
+  803145:	74 56                	je     80319d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803147:	4c 89 ea             	mov    %r13,%rdx
+  80314a:	4c 89 e6             	mov    %r12,%rsi
+  80314d:	4c 89 f7             	mov    %r14,%rdi
+  803150:	ff d0                	call   *%rax
+}
+  803152:	48 83 c4 10          	add    $0x10,%rsp
+  803156:	5b                   	pop    %rbx
+  803157:	41 5c                	pop    %r12
+  803159:	41 5d                	pop    %r13
+  80315b:	41 5e                	pop    %r14
+  80315d:	5d                   	pop    %rbp
+  80315e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80315f:	48 98                	cltq
+  803161:	eb ef                	jmp    803152 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803163:	48 98                	cltq
+  803165:	eb eb                	jmp    803152 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803167:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80316e:	00 00 00 
+  803171:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803177:	89 da                	mov    %ebx,%edx
+  803179:	48 bf 99 61 80 00 00 	movabs $0x806199,%rdi
+  803180:	00 00 00 
+  803183:	b8 00 00 00 00       	mov    $0x0,%eax
+  803188:	48 b9 7d 16 80 00 00 	movabs $0x80167d,%rcx
+  80318f:	00 00 00 
+  803192:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803194:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80319b:	eb b5                	jmp    803152 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80319d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031a4:	eb ac                	jmp    803152 <read+0x6a>
+
+00000000008031a6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031a6:	55                   	push   %rbp
+  8031a7:	48 89 e5             	mov    %rsp,%rbp
+  8031aa:	41 57                	push   %r15
+  8031ac:	41 56                	push   %r14
+  8031ae:	41 55                	push   %r13
+  8031b0:	41 54                	push   %r12
+  8031b2:	53                   	push   %rbx
+  8031b3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031b7:	48 85 d2             	test   %rdx,%rdx
+  8031ba:	74 54                	je     803210 <readn+0x6a>
+  8031bc:	41 89 fd             	mov    %edi,%r13d
+  8031bf:	49 89 f6             	mov    %rsi,%r14
+  8031c2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031ca:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031cf:	49 bf e8 30 80 00 00 	movabs $0x8030e8,%r15
+  8031d6:	00 00 00 
+  8031d9:	4c 89 e2             	mov    %r12,%rdx
+  8031dc:	48 29 f2             	sub    %rsi,%rdx
+  8031df:	4c 01 f6             	add    %r14,%rsi
+  8031e2:	44 89 ef             	mov    %r13d,%edi
+  8031e5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8031e8:	85 c0                	test   %eax,%eax
+  8031ea:	78 20                	js     80320c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8031ec:	01 c3                	add    %eax,%ebx
+  8031ee:	85 c0                	test   %eax,%eax
+  8031f0:	74 08                	je     8031fa <readn+0x54>
+  8031f2:	48 63 f3             	movslq %ebx,%rsi
+  8031f5:	4c 39 e6             	cmp    %r12,%rsi
+  8031f8:	72 df                	jb     8031d9 <readn+0x33>
+    }
+    return res;
+  8031fa:	48 63 c3             	movslq %ebx,%rax
+}
+  8031fd:	48 83 c4 08          	add    $0x8,%rsp
+  803201:	5b                   	pop    %rbx
+  803202:	41 5c                	pop    %r12
+  803204:	41 5d                	pop    %r13
+  803206:	41 5e                	pop    %r14
+  803208:	41 5f                	pop    %r15
+  80320a:	5d                   	pop    %rbp
+  80320b:	c3                   	ret
+        if (inc < 0) return inc;
+  80320c:	48 98                	cltq
+  80320e:	eb ed                	jmp    8031fd <readn+0x57>
+    int inc = 1, res = 0;
+  803210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803215:	eb e3                	jmp    8031fa <readn+0x54>
+
+0000000000803217 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803217:	55                   	push   %rbp
+  803218:	48 89 e5             	mov    %rsp,%rbp
+  80321b:	41 56                	push   %r14
+  80321d:	41 55                	push   %r13
+  80321f:	41 54                	push   %r12
+  803221:	53                   	push   %rbx
+  803222:	48 83 ec 10          	sub    $0x10,%rsp
+  803226:	89 fb                	mov    %edi,%ebx
+  803228:	49 89 f4             	mov    %rsi,%r12
+  80322b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80322e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803232:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  803239:	00 00 00 
+  80323c:	ff d0                	call   *%rax
+  80323e:	85 c0                	test   %eax,%eax
+  803240:	78 47                	js     803289 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803242:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803246:	41 8b 3e             	mov    (%r14),%edi
+  803249:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80324d:	48 b8 50 2e 80 00 00 	movabs $0x802e50,%rax
+  803254:	00 00 00 
+  803257:	ff d0                	call   *%rax
+  803259:	85 c0                	test   %eax,%eax
+  80325b:	78 30                	js     80328d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80325d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803262:	74 2d                	je     803291 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803264:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803268:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80326c:	48 85 c0             	test   %rax,%rax
+  80326f:	74 56                	je     8032c7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803271:	4c 89 ea             	mov    %r13,%rdx
+  803274:	4c 89 e6             	mov    %r12,%rsi
+  803277:	4c 89 f7             	mov    %r14,%rdi
+  80327a:	ff d0                	call   *%rax
+}
+  80327c:	48 83 c4 10          	add    $0x10,%rsp
+  803280:	5b                   	pop    %rbx
+  803281:	41 5c                	pop    %r12
+  803283:	41 5d                	pop    %r13
+  803285:	41 5e                	pop    %r14
+  803287:	5d                   	pop    %rbp
+  803288:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803289:	48 98                	cltq
+  80328b:	eb ef                	jmp    80327c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80328d:	48 98                	cltq
+  80328f:	eb eb                	jmp    80327c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803291:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803298:	00 00 00 
+  80329b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032a1:	89 da                	mov    %ebx,%edx
+  8032a3:	48 bf b5 61 80 00 00 	movabs $0x8061b5,%rdi
+  8032aa:	00 00 00 
+  8032ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b2:	48 b9 7d 16 80 00 00 	movabs $0x80167d,%rcx
+  8032b9:	00 00 00 
+  8032bc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032c5:	eb b5                	jmp    80327c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032c7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032ce:	eb ac                	jmp    80327c <write+0x65>
+
+00000000008032d0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032d0:	55                   	push   %rbp
+  8032d1:	48 89 e5             	mov    %rsp,%rbp
+  8032d4:	53                   	push   %rbx
+  8032d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8032d9:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032db:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032df:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8032e6:	00 00 00 
+  8032e9:	ff d0                	call   *%rax
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	78 0c                	js     8032fb <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8032ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8032f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032ff:	c9                   	leave
+  803300:	c3                   	ret
+
+0000000000803301 <tell>:
+
+int tell(int fdnum) {
+  803301:	55                   	push   %rbp
+  803302:	48 89 e5             	mov    %rsp,%rbp
+  803305:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803309:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80330d:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  803314:	00 00 00 
+  803317:	ff d0                	call   *%rax
+  803319:	85 c0                	test   %eax,%eax
+  80331b:	78 07                	js     803324 <tell+0x23>
+
+    return fd->fd_offset;
+  80331d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803321:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803324:	c9                   	leave
+  803325:	c3                   	ret
+
+0000000000803326 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803326:	55                   	push   %rbp
+  803327:	48 89 e5             	mov    %rsp,%rbp
+  80332a:	41 55                	push   %r13
+  80332c:	41 54                	push   %r12
+  80332e:	53                   	push   %rbx
+  80332f:	48 83 ec 18          	sub    $0x18,%rsp
+  803333:	89 fb                	mov    %edi,%ebx
+  803335:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803338:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80333c:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  803343:	00 00 00 
+  803346:	ff d0                	call   *%rax
+  803348:	85 c0                	test   %eax,%eax
+  80334a:	78 38                	js     803384 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80334c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803350:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803354:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803358:	48 b8 50 2e 80 00 00 	movabs $0x802e50,%rax
+  80335f:	00 00 00 
+  803362:	ff d0                	call   *%rax
+  803364:	85 c0                	test   %eax,%eax
+  803366:	78 1c                	js     803384 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803368:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80336d:	74 20                	je     80338f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80336f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803373:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803377:	48 85 c0             	test   %rax,%rax
+  80337a:	74 47                	je     8033c3 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80337c:	44 89 e6             	mov    %r12d,%esi
+  80337f:	4c 89 ef             	mov    %r13,%rdi
+  803382:	ff d0                	call   *%rax
+}
+  803384:	48 83 c4 18          	add    $0x18,%rsp
+  803388:	5b                   	pop    %rbx
+  803389:	41 5c                	pop    %r12
+  80338b:	41 5d                	pop    %r13
+  80338d:	5d                   	pop    %rbp
+  80338e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80338f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803396:	00 00 00 
+  803399:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80339f:	89 da                	mov    %ebx,%edx
+  8033a1:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  8033a8:	00 00 00 
+  8033ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b0:	48 b9 7d 16 80 00 00 	movabs $0x80167d,%rcx
+  8033b7:	00 00 00 
+  8033ba:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c1:	eb c1                	jmp    803384 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033c3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033c8:	eb ba                	jmp    803384 <ftruncate+0x5e>
+
+00000000008033ca <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033ca:	55                   	push   %rbp
+  8033cb:	48 89 e5             	mov    %rsp,%rbp
+  8033ce:	41 54                	push   %r12
+  8033d0:	53                   	push   %rbx
+  8033d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d5:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033d8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033dc:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8033e3:	00 00 00 
+  8033e6:	ff d0                	call   *%rax
+  8033e8:	85 c0                	test   %eax,%eax
+  8033ea:	78 63                	js     80344f <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033ec:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8033f0:	41 8b 3c 24          	mov    (%r12),%edi
+  8033f4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8033f8:	48 b8 50 2e 80 00 00 	movabs $0x802e50,%rax
+  8033ff:	00 00 00 
+  803402:	ff d0                	call   *%rax
+  803404:	85 c0                	test   %eax,%eax
+  803406:	78 47                	js     80344f <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803408:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80340c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803411:	74 45                	je     803458 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803413:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803416:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80341d:	00 00 00 
+    stat->st_isdir = 0;
+  803420:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803427:	00 00 00 
+    stat->st_ino = 0;
+  80342a:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803431:	00 00 00 00 
+    stat->st_version = 0;
+  803435:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80343c:	00 00 00 
+    stat->st_dev = dev;
+  80343f:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803446:	48 89 de             	mov    %rbx,%rsi
+  803449:	4c 89 e7             	mov    %r12,%rdi
+  80344c:	ff 50 28             	call   *0x28(%rax)
+}
+  80344f:	48 83 c4 10          	add    $0x10,%rsp
+  803453:	5b                   	pop    %rbx
+  803454:	41 5c                	pop    %r12
+  803456:	5d                   	pop    %rbp
+  803457:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803458:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80345d:	eb f0                	jmp    80344f <fstat+0x85>
+
+000000000080345f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80345f:	55                   	push   %rbp
+  803460:	48 89 e5             	mov    %rsp,%rbp
+  803463:	41 54                	push   %r12
+  803465:	53                   	push   %rbx
+  803466:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803469:	be 00 00 00 00       	mov    $0x0,%esi
+  80346e:	48 b8 80 39 80 00 00 	movabs $0x803980,%rax
+  803475:	00 00 00 
+  803478:	ff d0                	call   *%rax
+  80347a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80347c:	85 c0                	test   %eax,%eax
+  80347e:	78 25                	js     8034a5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803480:	4c 89 e6             	mov    %r12,%rsi
+  803483:	89 c7                	mov    %eax,%edi
+  803485:	48 b8 ca 33 80 00 00 	movabs $0x8033ca,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+  803491:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803494:	89 df                	mov    %ebx,%edi
+  803496:	48 b8 6a 2f 80 00 00 	movabs $0x802f6a,%rax
+  80349d:	00 00 00 
+  8034a0:	ff d0                	call   *%rax
+
+    return res;
+  8034a2:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034a5:	89 d8                	mov    %ebx,%eax
+  8034a7:	5b                   	pop    %rbx
+  8034a8:	41 5c                	pop    %r12
+  8034aa:	5d                   	pop    %rbp
+  8034ab:	c3                   	ret
+
+00000000008034ac <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ac:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034b3:	00 00 00 
+  8034b6:	83 38 00             	cmpl   $0x0,(%rax)
+  8034b9:	74 0a                	je     8034c5 <fsipc_env+0x19>
+    return fsenv;
+}
+  8034bb:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034c2:	00 00 
+  8034c4:	c3                   	ret
+fsipc_env(void) {
+  8034c5:	55                   	push   %rbp
+  8034c6:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034c9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034ce:	48 b8 52 56 80 00 00 	movabs $0x805652,%rax
+  8034d5:	00 00 00 
+  8034d8:	ff d0                	call   *%rax
+  8034da:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8034e1:	00 00 
+}
+  8034e3:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034ea:	00 00 
+  8034ec:	5d                   	pop    %rbp
+  8034ed:	c3                   	ret
+
+00000000008034ee <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8034ee:	55                   	push   %rbp
+  8034ef:	48 89 e5             	mov    %rsp,%rbp
+  8034f2:	53                   	push   %rbx
+  8034f3:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8034f7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8034fe:	00 
+  8034ff:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803506:	00 
+  803507:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80350e:	00 
+  80350f:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803516:	00 
+  803517:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80351e:	00 
+
+    assert(size <= sizeof(words));
+  80351f:	48 83 fa 28          	cmp    $0x28,%rdx
+  803523:	77 38                	ja     80355d <fsipc_short+0x6f>
+  803525:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803527:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80352b:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  803532:	00 00 00 
+  803535:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803537:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  80353e:	00 00 00 
+  803541:	ff d0                	call   *%rax
+  803543:	89 c7                	mov    %eax,%edi
+  803545:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803549:	89 de                	mov    %ebx,%esi
+  80354b:	48 b8 b5 55 80 00 00 	movabs $0x8055b5,%rax
+  803552:	00 00 00 
+  803555:	ff d0                	call   *%rax
+}
+  803557:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80355b:	c9                   	leave
+  80355c:	c3                   	ret
+    assert(size <= sizeof(words));
+  80355d:	48 b9 00 62 80 00 00 	movabs $0x806200,%rcx
+  803564:	00 00 00 
+  803567:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80356e:	00 00 00 
+  803571:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803576:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80357d:	00 00 00 
+  803580:	b8 00 00 00 00       	mov    $0x0,%eax
+  803585:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  80358c:	00 00 00 
+  80358f:	41 ff d0             	call   *%r8
+
+0000000000803592 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803592:	55                   	push   %rbp
+  803593:	48 89 e5             	mov    %rsp,%rbp
+  803596:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  80359a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80359d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035a0:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035a3:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035a8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035ac:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035b1:	48 b8 ee 34 80 00 00 	movabs $0x8034ee,%rax
+  8035b8:	00 00 00 
+  8035bb:	ff d0                	call   *%rax
+}
+  8035bd:	c9                   	leave
+  8035be:	c3                   	ret
+
+00000000008035bf <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035bf:	55                   	push   %rbp
+  8035c0:	48 89 e5             	mov    %rsp,%rbp
+  8035c3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035c7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035cd:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035d2:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035d6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035db:	48 b8 ee 34 80 00 00 	movabs $0x8034ee,%rax
+  8035e2:	00 00 00 
+  8035e5:	ff d0                	call   *%rax
+}
+  8035e7:	c9                   	leave
+  8035e8:	c3                   	ret
+
+00000000008035e9 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	41 54                	push   %r12
+  8035ef:	53                   	push   %rbx
+  8035f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f4:	89 fb                	mov    %edi,%ebx
+  8035f6:	49 89 f4             	mov    %rsi,%r12
+  8035f9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8035fd:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  803604:	00 00 00 
+  803607:	ff d0                	call   *%rax
+  803609:	89 c7                	mov    %eax,%edi
+  80360b:	6a 00                	push   $0x0
+  80360d:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803611:	50                   	push   %rax
+  803612:	4d 89 e1             	mov    %r12,%r9
+  803615:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80361b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803620:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803627:	00 00 00 
+  80362a:	89 de                	mov    %ebx,%esi
+  80362c:	48 b8 50 55 80 00 00 	movabs $0x805550,%rax
+  803633:	00 00 00 
+  803636:	ff d0                	call   *%rax
+}
+  803638:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80363c:	5b                   	pop    %rbx
+  80363d:	41 5c                	pop    %r12
+  80363f:	5d                   	pop    %rbp
+  803640:	c3                   	ret
+
+0000000000803641 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803641:	55                   	push   %rbp
+  803642:	48 89 e5             	mov    %rsp,%rbp
+  803645:	41 54                	push   %r12
+  803647:	53                   	push   %rbx
+  803648:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80364b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80364e:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803655:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803657:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80365c:	be 00 00 00 00       	mov    $0x0,%esi
+  803661:	bf 05 00 00 00       	mov    $0x5,%edi
+  803666:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  80366d:	00 00 00 
+  803670:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803672:	85 c0                	test   %eax,%eax
+  803674:	78 5a                	js     8036d0 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803676:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80367d:	00 00 00 
+  803680:	4c 89 e6             	mov    %r12,%rsi
+  803683:	48 89 df             	mov    %rbx,%rdi
+  803686:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  80368d:	00 00 00 
+  803690:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803692:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803699:	00 
+  80369a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036a0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036a7:	00 
+  8036a8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036ae:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036b5:	00 
+  8036b6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036bd:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036c4:	00 
+  8036c5:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036d0:	5b                   	pop    %rbx
+  8036d1:	41 5c                	pop    %r12
+  8036d3:	5d                   	pop    %rbp
+  8036d4:	c3                   	ret
+
+00000000008036d5 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036d5:	55                   	push   %rbp
+  8036d6:	48 89 e5             	mov    %rsp,%rbp
+  8036d9:	41 57                	push   %r15
+  8036db:	41 56                	push   %r14
+  8036dd:	41 55                	push   %r13
+  8036df:	41 54                	push   %r12
+  8036e1:	53                   	push   %rbx
+  8036e2:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8036e6:	48 85 ff             	test   %rdi,%rdi
+  8036e9:	0f 84 a1 00 00 00    	je     803790 <devfile_read+0xbb>
+  8036ef:	49 89 ff             	mov    %rdi,%r15
+  8036f2:	49 89 f5             	mov    %rsi,%r13
+  8036f5:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8036f8:	48 85 f6             	test   %rsi,%rsi
+  8036fb:	0f 84 c4 00 00 00    	je     8037c5 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803701:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803708:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803709:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803710:	00 00 00 
+  803713:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803717:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80371a:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80371e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803723:	be 00 00 00 00       	mov    $0x0,%esi
+  803728:	bf 03 00 00 00       	mov    $0x3,%edi
+  80372d:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803734:	00 00 00 
+  803737:	ff d0                	call   *%rax
+        if (res < 0) {
+  803739:	85 c0                	test   %eax,%eax
+  80373b:	0f 88 b9 00 00 00    	js     8037fa <devfile_read+0x125>
+        assert(res <= n);
+  803741:	48 63 d8             	movslq %eax,%rbx
+  803744:	49 39 dc             	cmp    %rbx,%r12
+  803747:	0f 82 b1 00 00 00    	jb     8037fe <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80374d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803752:	0f 87 db 00 00 00    	ja     803833 <devfile_read+0x15e>
+        if (!res) {
+  803758:	85 c0                	test   %eax,%eax
+  80375a:	74 21                	je     80377d <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80375c:	48 89 da             	mov    %rbx,%rdx
+  80375f:	4c 89 f6             	mov    %r14,%rsi
+  803762:	4c 89 ef             	mov    %r13,%rdi
+  803765:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  80376c:	00 00 00 
+  80376f:	ff d0                	call   *%rax
+        total_read += res;
+  803771:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803775:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803778:	49 29 dc             	sub    %rbx,%r12
+  80377b:	75 96                	jne    803713 <devfile_read+0x3e>
+    return total_read;
+  80377d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803781:	48 83 c4 18          	add    $0x18,%rsp
+  803785:	5b                   	pop    %rbx
+  803786:	41 5c                	pop    %r12
+  803788:	41 5d                	pop    %r13
+  80378a:	41 5e                	pop    %r14
+  80378c:	41 5f                	pop    %r15
+  80378e:	5d                   	pop    %rbp
+  80378f:	c3                   	ret
+    assert(fd);
+  803790:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  803797:	00 00 00 
+  80379a:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037a1:	00 00 00 
+  8037a4:	be 91 00 00 00       	mov    $0x91,%esi
+  8037a9:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037b0:	00 00 00 
+  8037b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b8:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  8037bf:	00 00 00 
+  8037c2:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037c5:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  8037cc:	00 00 00 
+  8037cf:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  8037d6:	00 00 00 
+  8037d9:	be 92 00 00 00       	mov    $0x92,%esi
+  8037de:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  8037e5:	00 00 00 
+  8037e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ed:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  8037f4:	00 00 00 
+  8037f7:	41 ff d0             	call   *%r8
+            return res;
+  8037fa:	48 98                	cltq
+  8037fc:	eb 83                	jmp    803781 <devfile_read+0xac>
+        assert(res <= n);
+  8037fe:	48 b9 3d 62 80 00 00 	movabs $0x80623d,%rcx
+  803805:	00 00 00 
+  803808:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80380f:	00 00 00 
+  803812:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803817:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80381e:	00 00 00 
+  803821:	b8 00 00 00 00       	mov    $0x0,%eax
+  803826:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  80382d:	00 00 00 
+  803830:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803833:	48 b9 48 62 80 00 00 	movabs $0x806248,%rcx
+  80383a:	00 00 00 
+  80383d:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803844:	00 00 00 
+  803847:	be 9f 00 00 00       	mov    $0x9f,%esi
+  80384c:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803853:	00 00 00 
+  803856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385b:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  803862:	00 00 00 
+  803865:	41 ff d0             	call   *%r8
+
+0000000000803868 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803868:	55                   	push   %rbp
+  803869:	48 89 e5             	mov    %rsp,%rbp
+  80386c:	41 57                	push   %r15
+  80386e:	41 56                	push   %r14
+  803870:	41 55                	push   %r13
+  803872:	41 54                	push   %r12
+  803874:	53                   	push   %rbx
+  803875:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803879:	48 85 ff             	test   %rdi,%rdi
+  80387c:	0f 84 83 00 00 00    	je     803905 <devfile_write+0x9d>
+  803882:	49 89 ff             	mov    %rdi,%r15
+  803885:	49 89 f4             	mov    %rsi,%r12
+  803888:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  80388b:	48 85 f6             	test   %rsi,%rsi
+  80388e:	0f 84 a6 00 00 00    	je     80393a <devfile_write+0xd2>
+    size_t total_written = 0;
+  803894:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80389a:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038a1:	00 00 00 
+  8038a4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038a8:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038ab:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038af:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038b4:	48 39 d3             	cmp    %rdx,%rbx
+  8038b7:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038bb:	4c 89 e6             	mov    %r12,%rsi
+  8038be:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038c5:	00 00 00 
+  8038c8:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8038cf:	00 00 00 
+  8038d2:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8038de:	bf 04 00 00 00       	mov    $0x4,%edi
+  8038e3:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8038ea:	00 00 00 
+  8038ed:	ff d0                	call   *%rax
+        if (res < 0) {
+  8038ef:	85 c0                	test   %eax,%eax
+  8038f1:	78 7c                	js     80396f <devfile_write+0x107>
+        total_written += res;
+  8038f3:	48 98                	cltq
+  8038f5:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8038f8:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8038fb:	48 29 c3             	sub    %rax,%rbx
+  8038fe:	75 a4                	jne    8038a4 <devfile_write+0x3c>
+    return total_written;
+  803900:	4c 89 e8             	mov    %r13,%rax
+  803903:	eb 6c                	jmp    803971 <devfile_write+0x109>
+    assert(fd);
+  803905:	48 b9 36 62 80 00 00 	movabs $0x806236,%rcx
+  80390c:	00 00 00 
+  80390f:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  803916:	00 00 00 
+  803919:	be bd 00 00 00       	mov    $0xbd,%esi
+  80391e:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  803925:	00 00 00 
+  803928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392d:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  803934:	00 00 00 
+  803937:	41 ff d0             	call   *%r8
+    assert(buf);
+  80393a:	48 b9 39 62 80 00 00 	movabs $0x806239,%rcx
+  803941:	00 00 00 
+  803944:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80394b:	00 00 00 
+  80394e:	be be 00 00 00       	mov    $0xbe,%esi
+  803953:	48 bf 2b 62 80 00 00 	movabs $0x80622b,%rdi
+  80395a:	00 00 00 
+  80395d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803962:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  803969:	00 00 00 
+  80396c:	41 ff d0             	call   *%r8
+            return res;
+  80396f:	48 98                	cltq
+}
+  803971:	48 83 c4 08          	add    $0x8,%rsp
+  803975:	5b                   	pop    %rbx
+  803976:	41 5c                	pop    %r12
+  803978:	41 5d                	pop    %r13
+  80397a:	41 5e                	pop    %r14
+  80397c:	41 5f                	pop    %r15
+  80397e:	5d                   	pop    %rbp
+  80397f:	c3                   	ret
+
+0000000000803980 <open>:
+open(const char *path, int mode) {
+  803980:	55                   	push   %rbp
+  803981:	48 89 e5             	mov    %rsp,%rbp
+  803984:	41 55                	push   %r13
+  803986:	41 54                	push   %r12
+  803988:	53                   	push   %rbx
+  803989:	48 83 ec 18          	sub    $0x18,%rsp
+  80398d:	49 89 fc             	mov    %rdi,%r12
+  803990:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803993:	48 b8 76 1f 80 00 00 	movabs $0x801f76,%rax
+  80399a:	00 00 00 
+  80399d:	ff d0                	call   *%rax
+  80399f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039a5:	0f 87 8f 00 00 00    	ja     803a3a <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039ab:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039af:	48 b8 a5 2d 80 00 00 	movabs $0x802da5,%rax
+  8039b6:	00 00 00 
+  8039b9:	ff d0                	call   *%rax
+  8039bb:	89 c3                	mov    %eax,%ebx
+  8039bd:	85 c0                	test   %eax,%eax
+  8039bf:	78 55                	js     803a16 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039c1:	4c 89 e6             	mov    %r12,%rsi
+  8039c4:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039cb:	00 00 00 
+  8039ce:	48 89 df             	mov    %rbx,%rdi
+  8039d1:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8039dd:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039e9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8039ed:	bf 01 00 00 00       	mov    $0x1,%edi
+  8039f2:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8039f9:	00 00 00 
+  8039fc:	ff d0                	call   *%rax
+  8039fe:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a00:	85 c0                	test   %eax,%eax
+  803a02:	78 1f                	js     803a23 <open+0xa3>
+    return fd2num(fd);
+  803a04:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a08:	48 b8 77 2d 80 00 00 	movabs $0x802d77,%rax
+  803a0f:	00 00 00 
+  803a12:	ff d0                	call   *%rax
+  803a14:	89 c3                	mov    %eax,%ebx
+}
+  803a16:	89 d8                	mov    %ebx,%eax
+  803a18:	48 83 c4 18          	add    $0x18,%rsp
+  803a1c:	5b                   	pop    %rbx
+  803a1d:	41 5c                	pop    %r12
+  803a1f:	41 5d                	pop    %r13
+  803a21:	5d                   	pop    %rbp
+  803a22:	c3                   	ret
+        fd_close(fd, 0);
+  803a23:	be 00 00 00 00       	mov    $0x0,%esi
+  803a28:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a2c:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  803a33:	00 00 00 
+  803a36:	ff d0                	call   *%rax
+        return res;
+  803a38:	eb dc                	jmp    803a16 <open+0x96>
+        return -E_BAD_PATH;
+  803a3a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a3f:	eb d5                	jmp    803a16 <open+0x96>
+
+0000000000803a41 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a41:	55                   	push   %rbp
+  803a42:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a45:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a4a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a54:	48 b8 ee 34 80 00 00 	movabs $0x8034ee,%rax
+  803a5b:	00 00 00 
+  803a5e:	ff d0                	call   *%rax
+}
+  803a60:	5d                   	pop    %rbp
+  803a61:	c3                   	ret
+
+0000000000803a62 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a62:	55                   	push   %rbp
+  803a63:	48 89 e5             	mov    %rsp,%rbp
+  803a66:	41 56                	push   %r14
+  803a68:	41 55                	push   %r13
+  803a6a:	41 54                	push   %r12
+  803a6c:	53                   	push   %rbx
+  803a6d:	48 83 ec 10          	sub    $0x10,%rsp
+  803a71:	41 89 f6             	mov    %esi,%r14d
+  803a74:	49 89 d4             	mov    %rdx,%r12
+  803a77:	48 89 cb             	mov    %rcx,%rbx
+  803a7a:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a7d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a81:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  803a88:	00 00 00 
+  803a8b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a8d:	85 c0                	test   %eax,%eax
+  803a8f:	78 46                	js     803ad7 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803a91:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a95:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803a9c:	00 00 00 
+  803a9f:	8b 00                	mov    (%rax),%eax
+  803aa1:	39 02                	cmp    %eax,(%rdx)
+  803aa3:	75 3f                	jne    803ae4 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803aa5:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803aac:	00 00 00 
+  803aaf:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ab2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ab4:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ab8:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803abc:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ac0:	48 89 da             	mov    %rbx,%rdx
+  803ac3:	4c 89 e6             	mov    %r12,%rsi
+  803ac6:	bf 09 00 00 00       	mov    $0x9,%edi
+  803acb:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803ad2:	00 00 00 
+  803ad5:	ff d0                	call   *%rax
+}
+  803ad7:	48 83 c4 10          	add    $0x10,%rsp
+  803adb:	5b                   	pop    %rbx
+  803adc:	41 5c                	pop    %r12
+  803ade:	41 5d                	pop    %r13
+  803ae0:	41 5e                	pop    %r14
+  803ae2:	5d                   	pop    %rbp
+  803ae3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ae4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ae9:	eb ec                	jmp    803ad7 <file_map+0x75>
+
+0000000000803aeb <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803aeb:	55                   	push   %rbp
+  803aec:	48 89 e5             	mov    %rsp,%rbp
+  803aef:	41 54                	push   %r12
+  803af1:	53                   	push   %rbx
+  803af2:	48 83 ec 20          	sub    $0x20,%rsp
+  803af6:	41 89 f4             	mov    %esi,%r12d
+  803af9:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803afc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b00:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  803b07:	00 00 00 
+  803b0a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b0c:	85 c0                	test   %eax,%eax
+  803b0e:	78 3c                	js     803b4c <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b14:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b1b:	00 00 00 
+  803b1e:	8b 0a                	mov    (%rdx),%ecx
+  803b20:	39 08                	cmp    %ecx,(%rax)
+  803b22:	75 31                	jne    803b55 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b24:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b27:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b2a:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b2e:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b32:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b37:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b3b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b40:	48 b8 ee 34 80 00 00 	movabs $0x8034ee,%rax
+  803b47:	00 00 00 
+  803b4a:	ff d0                	call   *%rax
+}
+  803b4c:	48 83 c4 20          	add    $0x20,%rsp
+  803b50:	5b                   	pop    %rbx
+  803b51:	41 5c                	pop    %r12
+  803b53:	5d                   	pop    %rbp
+  803b54:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b55:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b5a:	eb f0                	jmp    803b4c <file_msync+0x61>
+
+0000000000803b5c <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b5c:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b60:	7f 01                	jg     803b63 <writebuf+0x7>
+  803b62:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b63:	55                   	push   %rbp
+  803b64:	48 89 e5             	mov    %rsp,%rbp
+  803b67:	53                   	push   %rbx
+  803b68:	48 83 ec 08          	sub    $0x8,%rsp
+  803b6c:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b6f:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b73:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b77:	8b 3f                	mov    (%rdi),%edi
+  803b79:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  803b80:	00 00 00 
+  803b83:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803b85:	48 85 c0             	test   %rax,%rax
+  803b88:	7e 04                	jle    803b8e <writebuf+0x32>
+  803b8a:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803b8e:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803b92:	48 39 c2             	cmp    %rax,%rdx
+  803b95:	74 0f                	je     803ba6 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803b97:	48 85 c0             	test   %rax,%rax
+  803b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b9f:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803ba3:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803ba6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803baa:	c9                   	leave
+  803bab:	c3                   	ret
+
+0000000000803bac <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bac:	8b 46 04             	mov    0x4(%rsi),%eax
+  803baf:	8d 50 01             	lea    0x1(%rax),%edx
+  803bb2:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bb5:	48 98                	cltq
+  803bb7:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bbc:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bc2:	74 01                	je     803bc5 <putch+0x19>
+  803bc4:	c3                   	ret
+putch(int ch, void *arg) {
+  803bc5:	55                   	push   %rbp
+  803bc6:	48 89 e5             	mov    %rsp,%rbp
+  803bc9:	53                   	push   %rbx
+  803bca:	48 83 ec 08          	sub    $0x8,%rsp
+  803bce:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bd1:	48 89 f7             	mov    %rsi,%rdi
+  803bd4:	48 b8 5c 3b 80 00 00 	movabs $0x803b5c,%rax
+  803bdb:	00 00 00 
+  803bde:	ff d0                	call   *%rax
+        state->offset = 0;
+  803be0:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803be7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803beb:	c9                   	leave
+  803bec:	c3                   	ret
+
+0000000000803bed <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803bed:	55                   	push   %rbp
+  803bee:	48 89 e5             	mov    %rsp,%rbp
+  803bf1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803bf8:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803bfb:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c01:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c08:	00 00 00 
+    state.result = 0;
+  803c0b:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c12:	00 00 00 00 
+    state.error = 1;
+  803c16:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c1d:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c20:	48 89 f2             	mov    %rsi,%rdx
+  803c23:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c2a:	48 bf ac 3b 80 00 00 	movabs $0x803bac,%rdi
+  803c31:	00 00 00 
+  803c34:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  803c3b:	00 00 00 
+  803c3e:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c40:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c47:	7f 14                	jg     803c5d <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c49:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c50:	48 85 c0             	test   %rax,%rax
+  803c53:	75 06                	jne    803c5b <vfprintf+0x6e>
+  803c55:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c5b:	c9                   	leave
+  803c5c:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c5d:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c64:	48 b8 5c 3b 80 00 00 	movabs $0x803b5c,%rax
+  803c6b:	00 00 00 
+  803c6e:	ff d0                	call   *%rax
+  803c70:	eb d7                	jmp    803c49 <vfprintf+0x5c>
+
+0000000000803c72 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c72:	55                   	push   %rbp
+  803c73:	48 89 e5             	mov    %rsp,%rbp
+  803c76:	48 83 ec 50          	sub    $0x50,%rsp
+  803c7a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c7e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803c82:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c86:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803c8a:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803c91:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c99:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803c9d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ca1:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ca5:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  803cac:	00 00 00 
+  803caf:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cb1:	c9                   	leave
+  803cb2:	c3                   	ret
+
+0000000000803cb3 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cb3:	55                   	push   %rbp
+  803cb4:	48 89 e5             	mov    %rsp,%rbp
+  803cb7:	48 83 ec 50          	sub    $0x50,%rsp
+  803cbb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cbf:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cc3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cc7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ccb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ccf:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cd6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cde:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ce2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803ce6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cea:	48 89 fe             	mov    %rdi,%rsi
+  803ced:	bf 01 00 00 00       	mov    $0x1,%edi
+  803cf2:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  803cf9:	00 00 00 
+  803cfc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cfe:	c9                   	leave
+  803cff:	c3                   	ret
+
+0000000000803d00 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d00:	55                   	push   %rbp
+  803d01:	48 89 e5             	mov    %rsp,%rbp
+  803d04:	41 54                	push   %r12
+  803d06:	53                   	push   %rbx
+  803d07:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d0a:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  803d11:	00 00 00 
+  803d14:	ff d0                	call   *%rax
+  803d16:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d19:	48 be 70 62 80 00 00 	movabs $0x806270,%rsi
+  803d20:	00 00 00 
+  803d23:	48 89 df             	mov    %rbx,%rdi
+  803d26:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  803d2d:	00 00 00 
+  803d30:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d32:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d37:	41 2b 04 24          	sub    (%r12),%eax
+  803d3b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d41:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d48:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d4b:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d52:	00 00 00 
+  803d55:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d61:	5b                   	pop    %rbx
+  803d62:	41 5c                	pop    %r12
+  803d64:	5d                   	pop    %rbp
+  803d65:	c3                   	ret
+
+0000000000803d66 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d66:	55                   	push   %rbp
+  803d67:	48 89 e5             	mov    %rsp,%rbp
+  803d6a:	41 54                	push   %r12
+  803d6c:	53                   	push   %rbx
+  803d6d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d75:	48 89 fe             	mov    %rdi,%rsi
+  803d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7d:	49 bc f1 27 80 00 00 	movabs $0x8027f1,%r12
+  803d84:	00 00 00 
+  803d87:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803d8a:	48 89 df             	mov    %rbx,%rdi
+  803d8d:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  803d94:	00 00 00 
+  803d97:	ff d0                	call   *%rax
+  803d99:	48 89 c6             	mov    %rax,%rsi
+  803d9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da6:	41 ff d4             	call   *%r12
+}
+  803da9:	5b                   	pop    %rbx
+  803daa:	41 5c                	pop    %r12
+  803dac:	5d                   	pop    %rbp
+  803dad:	c3                   	ret
+
+0000000000803dae <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dae:	55                   	push   %rbp
+  803daf:	48 89 e5             	mov    %rsp,%rbp
+  803db2:	41 57                	push   %r15
+  803db4:	41 56                	push   %r14
+  803db6:	41 55                	push   %r13
+  803db8:	41 54                	push   %r12
+  803dba:	53                   	push   %rbx
+  803dbb:	48 83 ec 18          	sub    $0x18,%rsp
+  803dbf:	49 89 fc             	mov    %rdi,%r12
+  803dc2:	49 89 f5             	mov    %rsi,%r13
+  803dc5:	49 89 d7             	mov    %rdx,%r15
+  803dc8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dcc:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  803dd3:	00 00 00 
+  803dd6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803dd8:	4d 85 ff             	test   %r15,%r15
+  803ddb:	0f 84 af 00 00 00    	je     803e90 <devpipe_write+0xe2>
+  803de1:	48 89 c3             	mov    %rax,%rbx
+  803de4:	4c 89 f8             	mov    %r15,%rax
+  803de7:	4d 89 ef             	mov    %r13,%r15
+  803dea:	4c 01 e8             	add    %r13,%rax
+  803ded:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803df1:	49 bd e7 26 80 00 00 	movabs $0x8026e7,%r13
+  803df8:	00 00 00 
+            sys_yield();
+  803dfb:	49 be 78 26 80 00 00 	movabs $0x802678,%r14
+  803e02:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e05:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e08:	48 63 ce             	movslq %esi,%rcx
+  803e0b:	48 63 03             	movslq (%rbx),%rax
+  803e0e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e14:	48 39 c1             	cmp    %rax,%rcx
+  803e17:	72 2e                	jb     803e47 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e19:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e1e:	48 89 da             	mov    %rbx,%rdx
+  803e21:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e26:	4c 89 e7             	mov    %r12,%rdi
+  803e29:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e2c:	85 c0                	test   %eax,%eax
+  803e2e:	74 66                	je     803e96 <devpipe_write+0xe8>
+            sys_yield();
+  803e30:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e33:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e36:	48 63 ce             	movslq %esi,%rcx
+  803e39:	48 63 03             	movslq (%rbx),%rax
+  803e3c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e42:	48 39 c1             	cmp    %rax,%rcx
+  803e45:	73 d2                	jae    803e19 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e47:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e4b:	48 89 ca             	mov    %rcx,%rdx
+  803e4e:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e52:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e59:	08 10 20 
+  803e5c:	48 f7 e2             	mul    %rdx
+  803e5f:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e63:	48 89 d0             	mov    %rdx,%rax
+  803e66:	48 c1 e0 09          	shl    $0x9,%rax
+  803e6a:	48 29 d0             	sub    %rdx,%rax
+  803e6d:	48 c1 e0 03          	shl    $0x3,%rax
+  803e71:	48 29 c1             	sub    %rax,%rcx
+  803e74:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e79:	83 c6 01             	add    $0x1,%esi
+  803e7c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e7f:	49 83 c7 01          	add    $0x1,%r15
+  803e83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e87:	49 39 c7             	cmp    %rax,%r15
+  803e8a:	0f 85 75 ff ff ff    	jne    803e05 <devpipe_write+0x57>
+    return n;
+  803e90:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e94:	eb 05                	jmp    803e9b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9b:	48 83 c4 18          	add    $0x18,%rsp
+  803e9f:	5b                   	pop    %rbx
+  803ea0:	41 5c                	pop    %r12
+  803ea2:	41 5d                	pop    %r13
+  803ea4:	41 5e                	pop    %r14
+  803ea6:	41 5f                	pop    %r15
+  803ea8:	5d                   	pop    %rbp
+  803ea9:	c3                   	ret
+
+0000000000803eaa <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803eaa:	55                   	push   %rbp
+  803eab:	48 89 e5             	mov    %rsp,%rbp
+  803eae:	41 57                	push   %r15
+  803eb0:	41 56                	push   %r14
+  803eb2:	41 55                	push   %r13
+  803eb4:	41 54                	push   %r12
+  803eb6:	53                   	push   %rbx
+  803eb7:	48 83 ec 18          	sub    $0x18,%rsp
+  803ebb:	49 89 fc             	mov    %rdi,%r12
+  803ebe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ec2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ec6:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  803ecd:	00 00 00 
+  803ed0:	ff d0                	call   *%rax
+  803ed2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ed5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803edb:	49 bd e7 26 80 00 00 	movabs $0x8026e7,%r13
+  803ee2:	00 00 00 
+            sys_yield();
+  803ee5:	49 be 78 26 80 00 00 	movabs $0x802678,%r14
+  803eec:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803eef:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ef4:	74 7d                	je     803f73 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803ef6:	8b 03                	mov    (%rbx),%eax
+  803ef8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803efb:	75 26                	jne    803f23 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803efd:	4d 85 ff             	test   %r15,%r15
+  803f00:	75 77                	jne    803f79 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f02:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f07:	48 89 da             	mov    %rbx,%rdx
+  803f0a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f0f:	4c 89 e7             	mov    %r12,%rdi
+  803f12:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f15:	85 c0                	test   %eax,%eax
+  803f17:	74 72                	je     803f8b <devpipe_read+0xe1>
+            sys_yield();
+  803f19:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f1c:	8b 03                	mov    (%rbx),%eax
+  803f1e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f21:	74 df                	je     803f02 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f23:	48 63 c8             	movslq %eax,%rcx
+  803f26:	48 89 ca             	mov    %rcx,%rdx
+  803f29:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f2d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f34:	08 10 20 
+  803f37:	48 89 d0             	mov    %rdx,%rax
+  803f3a:	48 f7 e6             	mul    %rsi
+  803f3d:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f41:	48 89 d0             	mov    %rdx,%rax
+  803f44:	48 c1 e0 09          	shl    $0x9,%rax
+  803f48:	48 29 d0             	sub    %rdx,%rax
+  803f4b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f52:	00 
+  803f53:	48 89 c8             	mov    %rcx,%rax
+  803f56:	48 29 d0             	sub    %rdx,%rax
+  803f59:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f5e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f62:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f66:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f69:	49 83 c7 01          	add    $0x1,%r15
+  803f6d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f71:	75 83                	jne    803ef6 <devpipe_read+0x4c>
+    return n;
+  803f73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f77:	eb 03                	jmp    803f7c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f79:	4c 89 f8             	mov    %r15,%rax
+}
+  803f7c:	48 83 c4 18          	add    $0x18,%rsp
+  803f80:	5b                   	pop    %rbx
+  803f81:	41 5c                	pop    %r12
+  803f83:	41 5d                	pop    %r13
+  803f85:	41 5e                	pop    %r14
+  803f87:	41 5f                	pop    %r15
+  803f89:	5d                   	pop    %rbp
+  803f8a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f90:	eb ea                	jmp    803f7c <devpipe_read+0xd2>
+
+0000000000803f92 <pipe>:
+pipe(int pfd[2]) {
+  803f92:	55                   	push   %rbp
+  803f93:	48 89 e5             	mov    %rsp,%rbp
+  803f96:	41 55                	push   %r13
+  803f98:	41 54                	push   %r12
+  803f9a:	53                   	push   %rbx
+  803f9b:	48 83 ec 18          	sub    $0x18,%rsp
+  803f9f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fa2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fa6:	48 b8 a5 2d 80 00 00 	movabs $0x802da5,%rax
+  803fad:	00 00 00 
+  803fb0:	ff d0                	call   *%rax
+  803fb2:	89 c3                	mov    %eax,%ebx
+  803fb4:	85 c0                	test   %eax,%eax
+  803fb6:	0f 88 a0 01 00 00    	js     80415c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fbc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fca:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fcf:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  803fd6:	00 00 00 
+  803fd9:	ff d0                	call   *%rax
+  803fdb:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fdd:	85 c0                	test   %eax,%eax
+  803fdf:	0f 88 77 01 00 00    	js     80415c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fe5:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803fe9:	48 b8 a5 2d 80 00 00 	movabs $0x802da5,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+  803ff5:	89 c3                	mov    %eax,%ebx
+  803ff7:	85 c0                	test   %eax,%eax
+  803ff9:	0f 88 43 01 00 00    	js     804142 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803fff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804004:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804009:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80400d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804012:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  804019:	00 00 00 
+  80401c:	ff d0                	call   *%rax
+  80401e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804020:	85 c0                	test   %eax,%eax
+  804022:	0f 88 1a 01 00 00    	js     804142 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804028:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80402c:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  804033:	00 00 00 
+  804036:	ff d0                	call   *%rax
+  804038:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80403b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804040:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804045:	48 89 c6             	mov    %rax,%rsi
+  804048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80404d:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  804054:	00 00 00 
+  804057:	ff d0                	call   *%rax
+  804059:	89 c3                	mov    %eax,%ebx
+  80405b:	85 c0                	test   %eax,%eax
+  80405d:	0f 88 c5 00 00 00    	js     804128 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804063:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804067:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+  804073:	48 89 c1             	mov    %rax,%rcx
+  804076:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80407c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804082:	ba 00 00 00 00       	mov    $0x0,%edx
+  804087:	4c 89 ee             	mov    %r13,%rsi
+  80408a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408f:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  804096:	00 00 00 
+  804099:	ff d0                	call   *%rax
+  80409b:	89 c3                	mov    %eax,%ebx
+  80409d:	85 c0                	test   %eax,%eax
+  80409f:	78 6e                	js     80410f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040a1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040a6:	4c 89 ef             	mov    %r13,%rdi
+  8040a9:	48 b8 af 26 80 00 00 	movabs $0x8026af,%rax
+  8040b0:	00 00 00 
+  8040b3:	ff d0                	call   *%rax
+  8040b5:	83 f8 02             	cmp    $0x2,%eax
+  8040b8:	0f 85 ab 00 00 00    	jne    804169 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040be:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040c5:	00 00 
+  8040c7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040cb:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040cd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040d1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040d8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040dc:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040e2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040ed:	48 bb 77 2d 80 00 00 	movabs $0x802d77,%rbx
+  8040f4:	00 00 00 
+  8040f7:	ff d3                	call   *%rbx
+  8040f9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8040fd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804101:	ff d3                	call   *%rbx
+  804103:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80410d:	eb 4d                	jmp    80415c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80410f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804114:	4c 89 ee             	mov    %r13,%rsi
+  804117:	bf 00 00 00 00       	mov    $0x0,%edi
+  80411c:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  804123:	00 00 00 
+  804126:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804128:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80412d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804131:	bf 00 00 00 00       	mov    $0x0,%edi
+  804136:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  80413d:	00 00 00 
+  804140:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804142:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804147:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80414b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804150:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  804157:	00 00 00 
+  80415a:	ff d0                	call   *%rax
+}
+  80415c:	89 d8                	mov    %ebx,%eax
+  80415e:	48 83 c4 18          	add    $0x18,%rsp
+  804162:	5b                   	pop    %rbx
+  804163:	41 5c                	pop    %r12
+  804165:	41 5d                	pop    %r13
+  804167:	5d                   	pop    %rbp
+  804168:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804169:	48 b9 88 62 80 00 00 	movabs $0x806288,%rcx
+  804170:	00 00 00 
+  804173:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  80417a:	00 00 00 
+  80417d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804182:	48 bf 77 62 80 00 00 	movabs $0x806277,%rdi
+  804189:	00 00 00 
+  80418c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804191:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  804198:	00 00 00 
+  80419b:	41 ff d0             	call   *%r8
+
+000000000080419e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80419e:	55                   	push   %rbp
+  80419f:	48 89 e5             	mov    %rsp,%rbp
+  8041a2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041a6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041aa:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8041b1:	00 00 00 
+  8041b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041b6:	85 c0                	test   %eax,%eax
+  8041b8:	78 35                	js     8041ef <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041ba:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041be:	48 b8 89 2d 80 00 00 	movabs $0x802d89,%rax
+  8041c5:	00 00 00 
+  8041c8:	ff d0                	call   *%rax
+  8041ca:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041cd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041d2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041d7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041db:	48 b8 e7 26 80 00 00 	movabs $0x8026e7,%rax
+  8041e2:	00 00 00 
+  8041e5:	ff d0                	call   *%rax
+  8041e7:	85 c0                	test   %eax,%eax
+  8041e9:	0f 94 c0             	sete   %al
+  8041ec:	0f b6 c0             	movzbl %al,%eax
+}
+  8041ef:	c9                   	leave
+  8041f0:	c3                   	ret
+
+00000000008041f1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8041f1:	48 89 f8             	mov    %rdi,%rax
+  8041f4:	48 c1 e8 27          	shr    $0x27,%rax
+  8041f8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8041ff:	01 00 00 
+  804202:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804206:	f6 c2 01             	test   $0x1,%dl
+  804209:	74 6d                	je     804278 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80420b:	48 89 f8             	mov    %rdi,%rax
+  80420e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804212:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804219:	01 00 00 
+  80421c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804220:	f6 c2 01             	test   $0x1,%dl
+  804223:	74 62                	je     804287 <get_uvpt_entry+0x96>
+  804225:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80422c:	01 00 00 
+  80422f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804233:	f6 c2 80             	test   $0x80,%dl
+  804236:	75 4f                	jne    804287 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804238:	48 89 f8             	mov    %rdi,%rax
+  80423b:	48 c1 e8 15          	shr    $0x15,%rax
+  80423f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804246:	01 00 00 
+  804249:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80424d:	f6 c2 01             	test   $0x1,%dl
+  804250:	74 44                	je     804296 <get_uvpt_entry+0xa5>
+  804252:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804259:	01 00 00 
+  80425c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804260:	f6 c2 80             	test   $0x80,%dl
+  804263:	75 31                	jne    804296 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804265:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804269:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804270:	01 00 00 
+  804273:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804277:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804278:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80427f:	01 00 00 
+  804282:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804286:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804287:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80428e:	01 00 00 
+  804291:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804295:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804296:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80429d:	01 00 00 
+  8042a0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042a4:	c3                   	ret
+
+00000000008042a5 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042a5:	55                   	push   %rbp
+  8042a6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042a9:	48 b8 f1 41 80 00 00 	movabs $0x8041f1,%rax
+  8042b0:	00 00 00 
+  8042b3:	ff d0                	call   *%rax
+  8042b5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042b8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042bd:	89 c1                	mov    %eax,%ecx
+  8042bf:	83 c9 04             	or     $0x4,%ecx
+  8042c2:	f6 c2 01             	test   $0x1,%dl
+  8042c5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042c8:	89 c1                	mov    %eax,%ecx
+  8042ca:	83 c9 02             	or     $0x2,%ecx
+  8042cd:	f6 c2 02             	test   $0x2,%dl
+  8042d0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042d3:	89 c1                	mov    %eax,%ecx
+  8042d5:	83 c9 01             	or     $0x1,%ecx
+  8042d8:	48 85 d2             	test   %rdx,%rdx
+  8042db:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042de:	89 c1                	mov    %eax,%ecx
+  8042e0:	83 c9 40             	or     $0x40,%ecx
+  8042e3:	f6 c6 04             	test   $0x4,%dh
+  8042e6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8042e9:	5d                   	pop    %rbp
+  8042ea:	c3                   	ret
+
+00000000008042eb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8042eb:	55                   	push   %rbp
+  8042ec:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042ef:	48 b8 f1 41 80 00 00 	movabs $0x8041f1,%rax
+  8042f6:	00 00 00 
+  8042f9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8042fb:	48 c1 e8 06          	shr    $0x6,%rax
+  8042ff:	83 e0 01             	and    $0x1,%eax
+}
+  804302:	5d                   	pop    %rbp
+  804303:	c3                   	ret
+
+0000000000804304 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804304:	55                   	push   %rbp
+  804305:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804308:	48 b8 f1 41 80 00 00 	movabs $0x8041f1,%rax
+  80430f:	00 00 00 
+  804312:	ff d0                	call   *%rax
+  804314:	83 e0 01             	and    $0x1,%eax
+}
+  804317:	5d                   	pop    %rbp
+  804318:	c3                   	ret
+
+0000000000804319 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804319:	55                   	push   %rbp
+  80431a:	48 89 e5             	mov    %rsp,%rbp
+  80431d:	41 57                	push   %r15
+  80431f:	41 56                	push   %r14
+  804321:	41 55                	push   %r13
+  804323:	41 54                	push   %r12
+  804325:	53                   	push   %rbx
+  804326:	48 83 ec 28          	sub    $0x28,%rsp
+  80432a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80432e:	48 85 ff             	test   %rdi,%rdi
+  804331:	74 1e                	je     804351 <foreach_shared_region+0x38>
+  804333:	49 89 ff             	mov    %rdi,%r15
+  804336:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80433c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804342:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804349:	01 00 00 
+  80434c:	e9 72 02 00 00       	jmp    8045c3 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804351:	48 b9 ac 62 80 00 00 	movabs $0x8062ac,%rcx
+  804358:	00 00 00 
+  80435b:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804362:	00 00 00 
+  804365:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80436a:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  804371:	00 00 00 
+  804374:	b8 00 00 00 00       	mov    $0x0,%eax
+  804379:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  804380:	00 00 00 
+  804383:	41 ff d0             	call   *%r8
+  804386:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80438d:	eb 6c                	jmp    8043fb <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80438f:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804396:	ff ff ff 
+  804399:	4c 21 e2             	and    %r12,%rdx
+  80439c:	48 89 d8             	mov    %rbx,%rax
+  80439f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043a4:	48 83 c0 01          	add    $0x1,%rax
+  8043a8:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043ac:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043b3:	00 00 00 
+  8043b6:	48 21 c8             	and    %rcx,%rax
+  8043b9:	48 09 d0             	or     %rdx,%rax
+  8043bc:	49 89 c4             	mov    %rax,%r12
+  8043bf:	eb 30                	jmp    8043f1 <foreach_shared_region+0xd8>
+  8043c1:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043c8:	ff ff ff 
+  8043cb:	4c 21 e2             	and    %r12,%rdx
+  8043ce:	48 89 d8             	mov    %rbx,%rax
+  8043d1:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043d6:	48 83 c0 01          	add    $0x1,%rax
+  8043da:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043de:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043e5:	00 00 00 
+  8043e8:	48 21 c8             	and    %rcx,%rax
+  8043eb:	48 09 d0             	or     %rdx,%rax
+  8043ee:	49 89 c4             	mov    %rax,%r12
+  8043f1:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8043f5:	0f 84 99 01 00 00    	je     804594 <foreach_shared_region+0x27b>
+  8043fb:	4c 89 e3             	mov    %r12,%rbx
+  8043fe:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804402:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804409:	01 00 00 
+  80440c:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804410:	a8 01                	test   $0x1,%al
+  804412:	0f 84 77 ff ff ff    	je     80438f <foreach_shared_region+0x76>
+  804418:	a8 80                	test   $0x80,%al
+  80441a:	74 19                	je     804435 <foreach_shared_region+0x11c>
+  80441c:	f6 c4 04             	test   $0x4,%ah
+  80441f:	74 a0                	je     8043c1 <foreach_shared_region+0xa8>
+  804421:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804428:	40 
+  804429:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80442d:	4c 89 e7             	mov    %r12,%rdi
+  804430:	41 ff d7             	call   *%r15
+  804433:	eb 8c                	jmp    8043c1 <foreach_shared_region+0xa8>
+  804435:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80443c:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804440:	eb 46                	jmp    804488 <foreach_shared_region+0x16f>
+  804442:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804449:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80444f:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804453:	48 c1 e0 15          	shl    $0x15,%rax
+  804457:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80445c:	49 09 c4             	or     %rax,%r12
+  80445f:	eb 1d                	jmp    80447e <foreach_shared_region+0x165>
+  804461:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804468:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80446e:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804472:	48 c1 e0 15          	shl    $0x15,%rax
+  804476:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80447b:	49 09 c4             	or     %rax,%r12
+  80447e:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804482:	0f 84 d3 00 00 00    	je     80455b <foreach_shared_region+0x242>
+  804488:	4c 89 e3             	mov    %r12,%rbx
+  80448b:	48 c1 eb 15          	shr    $0x15,%rbx
+  80448f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804496:	01 00 00 
+  804499:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80449d:	a8 01                	test   $0x1,%al
+  80449f:	74 a1                	je     804442 <foreach_shared_region+0x129>
+  8044a1:	a8 80                	test   $0x80,%al
+  8044a3:	74 19                	je     8044be <foreach_shared_region+0x1a5>
+  8044a5:	f6 c4 04             	test   $0x4,%ah
+  8044a8:	74 b7                	je     804461 <foreach_shared_region+0x148>
+  8044aa:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044b1:	00 
+  8044b2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044b6:	4c 89 e7             	mov    %r12,%rdi
+  8044b9:	41 ff d7             	call   *%r15
+  8044bc:	eb a3                	jmp    804461 <foreach_shared_region+0x148>
+  8044be:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044c4:	eb 3b                	jmp    804501 <foreach_shared_region+0x1e8>
+  8044c6:	f6 c4 04             	test   $0x4,%ah
+  8044c9:	74 12                	je     8044dd <foreach_shared_region+0x1c4>
+  8044cb:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044d2:	00 
+  8044d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044d7:	4c 89 e7             	mov    %r12,%rdi
+  8044da:	41 ff d7             	call   *%r15
+  8044dd:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8044e4:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8044ea:	48 83 c3 01          	add    $0x1,%rbx
+  8044ee:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8044f2:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8044f8:	49 09 dc             	or     %rbx,%r12
+  8044fb:	41 83 ed 01          	sub    $0x1,%r13d
+  8044ff:	74 2f                	je     804530 <foreach_shared_region+0x217>
+  804501:	4c 89 e3             	mov    %r12,%rbx
+  804504:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804508:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80450c:	a8 01                	test   $0x1,%al
+  80450e:	75 b6                	jne    8044c6 <foreach_shared_region+0x1ad>
+  804510:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804517:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80451d:	48 83 c3 01          	add    $0x1,%rbx
+  804521:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804525:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80452b:	49 09 dc             	or     %rbx,%r12
+  80452e:	eb cb                	jmp    8044fb <foreach_shared_region+0x1e2>
+  804530:	4c 89 e0             	mov    %r12,%rax
+  804533:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804539:	49 c1 ec 15          	shr    $0x15,%r12
+  80453d:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804544:	49 83 c4 01          	add    $0x1,%r12
+  804548:	49 c1 e4 15          	shl    $0x15,%r12
+  80454c:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804553:	49 09 c4             	or     %rax,%r12
+  804556:	e9 23 ff ff ff       	jmp    80447e <foreach_shared_region+0x165>
+  80455b:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80455f:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804566:	ff ff ff 
+  804569:	4c 21 e0             	and    %r12,%rax
+  80456c:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804570:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804577:	49 83 c4 01          	add    $0x1,%r12
+  80457b:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80457f:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804586:	00 00 00 
+  804589:	49 21 d4             	and    %rdx,%r12
+  80458c:	49 09 c4             	or     %rax,%r12
+  80458f:	e9 5d fe ff ff       	jmp    8043f1 <foreach_shared_region+0xd8>
+  804594:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80459b:	00 ff ff 
+  80459e:	4c 21 e0             	and    %r12,%rax
+  8045a1:	49 c1 ec 27          	shr    $0x27,%r12
+  8045a5:	49 83 c4 01          	add    $0x1,%r12
+  8045a9:	49 c1 e4 27          	shl    $0x27,%r12
+  8045ad:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045b4:	ff 00 00 
+  8045b7:	49 21 d4             	and    %rdx,%r12
+  8045ba:	49 09 c4             	or     %rax,%r12
+  8045bd:	41 83 ed 01          	sub    $0x1,%r13d
+  8045c1:	74 48                	je     80460b <foreach_shared_region+0x2f2>
+  8045c3:	4c 89 e0             	mov    %r12,%rax
+  8045c6:	48 c1 e8 27          	shr    $0x27,%rax
+  8045ca:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045d1:	01 00 00 
+  8045d4:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045d8:	f6 c2 01             	test   $0x1,%dl
+  8045db:	0f 85 a5 fd ff ff    	jne    804386 <foreach_shared_region+0x6d>
+  8045e1:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8045e8:	00 ff ff 
+  8045eb:	4c 21 e2             	and    %r12,%rdx
+  8045ee:	48 83 c0 01          	add    $0x1,%rax
+  8045f2:	48 c1 e0 27          	shl    $0x27,%rax
+  8045f6:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8045fd:	ff 00 00 
+  804600:	48 21 c8             	and    %rcx,%rax
+  804603:	48 09 d0             	or     %rdx,%rax
+  804606:	49 89 c4             	mov    %rax,%r12
+  804609:	eb b2                	jmp    8045bd <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80460b:	4d 85 e4             	test   %r12,%r12
+  80460e:	75 14                	jne    804624 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804610:	b8 00 00 00 00       	mov    $0x0,%eax
+  804615:	48 83 c4 28          	add    $0x28,%rsp
+  804619:	5b                   	pop    %rbx
+  80461a:	41 5c                	pop    %r12
+  80461c:	41 5d                	pop    %r13
+  80461e:	41 5e                	pop    %r14
+  804620:	41 5f                	pop    %r15
+  804622:	5d                   	pop    %rbp
+  804623:	c3                   	ret
+    assert(addr == 0);
+  804624:	48 b9 bb 62 80 00 00 	movabs $0x8062bb,%rcx
+  80462b:	00 00 00 
+  80462e:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  804635:	00 00 00 
+  804638:	be 67 00 00 00       	mov    $0x67,%esi
+  80463d:	48 bf b0 62 80 00 00 	movabs $0x8062b0,%rdi
+  804644:	00 00 00 
+  804647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464c:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  804653:	00 00 00 
+  804656:	41 ff d0             	call   *%r8
+
+0000000000804659 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804659:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804660:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804663:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804669:	eb 33                	jmp    80469e <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80466b:	48 83 c0 20          	add    $0x20,%rax
+  80466f:	4c 39 c0             	cmp    %r8,%rax
+  804672:	74 25                	je     804699 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804674:	48 8b 10             	mov    (%rax),%rdx
+  804677:	48 85 d2             	test   %rdx,%rdx
+  80467a:	74 ef                	je     80466b <mmap_place+0x12>
+  80467c:	48 89 d1             	mov    %rdx,%rcx
+  80467f:	48 03 48 08          	add    0x8(%rax),%rcx
+  804683:	48 39 cf             	cmp    %rcx,%rdi
+  804686:	73 e3                	jae    80466b <mmap_place+0x12>
+  804688:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80468c:	4c 39 ca             	cmp    %r9,%rdx
+  80468f:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804693:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804697:	eb d2                	jmp    80466b <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804699:	45 84 d2             	test   %r10b,%r10b
+  80469c:	74 12                	je     8046b0 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80469e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046a5:	00 00 00 
+        moved = 0;
+  8046a8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046ae:	eb c4                	jmp    804674 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046b0:	48 01 fe             	add    %rdi,%rsi
+  8046b3:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046ba:	00 00 00 
+  8046bd:	48 39 f0             	cmp    %rsi,%rax
+  8046c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c5:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046c9:	c3                   	ret
+
+00000000008046ca <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046ca:	55                   	push   %rbp
+  8046cb:	48 89 e5             	mov    %rsp,%rbp
+  8046ce:	41 57                	push   %r15
+  8046d0:	41 56                	push   %r14
+  8046d2:	41 55                	push   %r13
+  8046d4:	41 54                	push   %r12
+  8046d6:	53                   	push   %rbx
+  8046d7:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046db:	48 8b 1f             	mov    (%rdi),%rbx
+  8046de:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046e5:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046ec:	00 00 00 
+  8046ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046f4:	eb 12                	jmp    804708 <mmap_pgfault+0x3e>
+  8046f6:	48 83 c2 01          	add    $0x1,%rdx
+  8046fa:	48 83 c0 20          	add    $0x20,%rax
+  8046fe:	48 83 fa 20          	cmp    $0x20,%rdx
+  804702:	0f 84 04 01 00 00    	je     80480c <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804708:	48 8b 08             	mov    (%rax),%rcx
+  80470b:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80470f:	48 39 de             	cmp    %rbx,%rsi
+  804712:	73 e2                	jae    8046f6 <mmap_pgfault+0x2c>
+  804714:	48 03 48 08          	add    0x8(%rax),%rcx
+  804718:	48 39 cb             	cmp    %rcx,%rbx
+  80471b:	73 d9                	jae    8046f6 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80471d:	48 c1 e2 05          	shl    $0x5,%rdx
+  804721:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804728:	00 00 00 
+  80472b:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80472f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804733:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804737:	f6 c2 01             	test   $0x1,%dl
+  80473a:	0f 84 e0 00 00 00    	je     804820 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804740:	b8 00 00 00 00       	mov    $0x0,%eax
+  804745:	f6 c2 02             	test   $0x2,%dl
+  804748:	0f 84 c3 00 00 00    	je     804811 <mmap_pgfault+0x147>
+  80474e:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804755:	ff ff ff 
+  804758:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80475c:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804763:	00 00 00 
+  804766:	48 39 ca             	cmp    %rcx,%rdx
+  804769:	0f 85 a2 00 00 00    	jne    804811 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80476f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804774:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804779:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804780:	00 00 00 
+  804783:	bf 00 00 00 00       	mov    $0x0,%edi
+  804788:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  80478f:	00 00 00 
+  804792:	ff d0                	call   *%rax
+  804794:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479b:	85 d2                	test   %edx,%edx
+  80479d:	78 72                	js     804811 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  80479f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a4:	48 89 de             	mov    %rbx,%rsi
+  8047a7:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047ae:	00 00 00 
+  8047b1:	4c 89 e7             	mov    %r12,%rdi
+  8047b4:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8047bb:	00 00 00 
+  8047be:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047c0:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047c6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047cc:	48 89 d9             	mov    %rbx,%rcx
+  8047cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d4:	4c 89 e6             	mov    %r12,%rsi
+  8047d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047dc:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  8047e3:	00 00 00 
+  8047e6:	ff d0                	call   *%rax
+  8047e8:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8047ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ef:	4c 89 e6             	mov    %r12,%rsi
+  8047f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047f7:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  8047fe:	00 00 00 
+  804801:	ff d0                	call   *%rax
+    return res >= 0;
+  804803:	89 d8                	mov    %ebx,%eax
+  804805:	f7 d0                	not    %eax
+  804807:	c1 e8 1f             	shr    $0x1f,%eax
+  80480a:	eb 05                	jmp    804811 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80480c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804811:	48 83 c4 18          	add    $0x18,%rsp
+  804815:	5b                   	pop    %rbx
+  804816:	41 5c                	pop    %r12
+  804818:	41 5d                	pop    %r13
+  80481a:	41 5e                	pop    %r14
+  80481c:	41 5f                	pop    %r15
+  80481e:	5d                   	pop    %rbp
+  80481f:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804820:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804824:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804828:	4c 03 30             	add    (%rax),%r14
+  80482b:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804832:	49 39 c6             	cmp    %rax,%r14
+  804835:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804839:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804840:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804846:	49 bf 04 43 80 00 00 	movabs $0x804304,%r15
+  80484d:	00 00 00 
+  804850:	4d 39 f4             	cmp    %r14,%r12
+  804853:	73 1d                	jae    804872 <mmap_pgfault+0x1a8>
+  804855:	4c 89 e7             	mov    %r12,%rdi
+  804858:	41 ff d7             	call   *%r15
+  80485b:	84 c0                	test   %al,%al
+  80485d:	75 13                	jne    804872 <mmap_pgfault+0x1a8>
+  80485f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804866:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80486d:	4d 39 f4             	cmp    %r14,%r12
+  804870:	72 e3                	jb     804855 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804872:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804878:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80487c:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804880:	74 2a                	je     8048ac <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804882:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804886:	89 de                	mov    %ebx,%esi
+  804888:	2b 30                	sub    (%rax),%esi
+  80488a:	03 70 1c             	add    0x1c(%rax),%esi
+  80488d:	8b 78 18             	mov    0x18(%rax),%edi
+  804890:	4c 89 e9             	mov    %r13,%rcx
+  804893:	48 89 da             	mov    %rbx,%rdx
+  804896:	48 b8 62 3a 80 00 00 	movabs $0x803a62,%rax
+  80489d:	00 00 00 
+  8048a0:	ff d0                	call   *%rax
+    return res > 0;
+  8048a2:	85 c0                	test   %eax,%eax
+  8048a4:	0f 9f c0             	setg   %al
+  8048a7:	e9 65 ff ff ff       	jmp    804811 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048ac:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048b0:	eb d0                	jmp    804882 <mmap_pgfault+0x1b8>
+
+00000000008048b2 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048b2:	55                   	push   %rbp
+  8048b3:	48 89 e5             	mov    %rsp,%rbp
+  8048b6:	41 57                	push   %r15
+  8048b8:	41 56                	push   %r14
+  8048ba:	41 55                	push   %r13
+  8048bc:	41 54                	push   %r12
+  8048be:	53                   	push   %rbx
+  8048bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8048c3:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048c7:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048ca:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048d1:	ff ff ff 
+  8048d4:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048dd:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8048e4:	00 00 00 
+  8048e7:	48 39 ca             	cmp    %rcx,%rdx
+  8048ea:	0f 85 e5 00 00 00    	jne    8049d5 <mmap_writeback+0x123>
+  8048f0:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8048f3:	4c 39 ee             	cmp    %r13,%rsi
+  8048f6:	0f 83 e8 00 00 00    	jae    8049e4 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8048fc:	49 be 04 43 80 00 00 	movabs $0x804304,%r14
+  804903:	00 00 00 
+  804906:	49 bf eb 42 80 00 00 	movabs $0x8042eb,%r15
+  80490d:	00 00 00 
+  804910:	eb 10                	jmp    804922 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804912:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804919:	4d 39 ec             	cmp    %r13,%r12
+  80491c:	0f 83 ae 00 00 00    	jae    8049d0 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804922:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804926:	4c 89 e7             	mov    %r12,%rdi
+  804929:	41 ff d6             	call   *%r14
+  80492c:	84 c0                	test   %al,%al
+  80492e:	74 e2                	je     804912 <mmap_writeback+0x60>
+  804930:	4c 89 e7             	mov    %r12,%rdi
+  804933:	41 ff d7             	call   *%r15
+  804936:	84 c0                	test   %al,%al
+  804938:	74 d8                	je     804912 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80493a:	4c 89 e3             	mov    %r12,%rbx
+  80493d:	4d 39 ec             	cmp    %r13,%r12
+  804940:	73 20                	jae    804962 <mmap_writeback+0xb0>
+  804942:	48 89 df             	mov    %rbx,%rdi
+  804945:	41 ff d6             	call   *%r14
+  804948:	84 c0                	test   %al,%al
+  80494a:	74 16                	je     804962 <mmap_writeback+0xb0>
+  80494c:	48 89 df             	mov    %rbx,%rdi
+  80494f:	41 ff d7             	call   *%r15
+  804952:	84 c0                	test   %al,%al
+  804954:	74 0c                	je     804962 <mmap_writeback+0xb0>
+  804956:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80495d:	4c 39 eb             	cmp    %r13,%rbx
+  804960:	72 e0                	jb     804942 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804962:	48 89 d9             	mov    %rbx,%rcx
+  804965:	4c 29 e1             	sub    %r12,%rcx
+  804968:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80496c:	44 89 e6             	mov    %r12d,%esi
+  80496f:	2b 30                	sub    (%rax),%esi
+  804971:	49 89 c4             	mov    %rax,%r12
+  804974:	03 70 1c             	add    0x1c(%rax),%esi
+  804977:	8b 78 18             	mov    0x18(%rax),%edi
+  80497a:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80497e:	48 89 ca             	mov    %rcx,%rdx
+  804981:	48 b8 eb 3a 80 00 00 	movabs $0x803aeb,%rax
+  804988:	00 00 00 
+  80498b:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80498d:	85 c0                	test   %eax,%eax
+  80498f:	78 44                	js     8049d5 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804991:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804996:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804999:	41 89 c1             	mov    %eax,%r9d
+  80499c:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049a3:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049a7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049b0:	48 89 ce             	mov    %rcx,%rsi
+  8049b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049b8:	48 b8 86 27 80 00 00 	movabs $0x802786,%rax
+  8049bf:	00 00 00 
+  8049c2:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049c4:	85 c0                	test   %eax,%eax
+  8049c6:	78 0d                	js     8049d5 <mmap_writeback+0x123>
+  8049c8:	49 89 dc             	mov    %rbx,%r12
+  8049cb:	e9 49 ff ff ff       	jmp    804919 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049d5:	48 83 c4 28          	add    $0x28,%rsp
+  8049d9:	5b                   	pop    %rbx
+  8049da:	41 5c                	pop    %r12
+  8049dc:	41 5d                	pop    %r13
+  8049de:	41 5e                	pop    %r14
+  8049e0:	41 5f                	pop    %r15
+  8049e2:	5d                   	pop    %rbp
+  8049e3:	c3                   	ret
+    return 0;
+  8049e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049e9:	eb ea                	jmp    8049d5 <mmap_writeback+0x123>
+
+00000000008049eb <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8049eb:	55                   	push   %rbp
+  8049ec:	48 89 e5             	mov    %rsp,%rbp
+  8049ef:	41 57                	push   %r15
+  8049f1:	41 56                	push   %r14
+  8049f3:	41 55                	push   %r13
+  8049f5:	41 54                	push   %r12
+  8049f7:	53                   	push   %rbx
+  8049f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8049fc:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a00:	48 85 f6             	test   %rsi,%rsi
+  804a03:	0f 84 0c 02 00 00    	je     804c15 <mmap+0x22a>
+  804a09:	49 89 ff             	mov    %rdi,%r15
+  804a0c:	49 89 f4             	mov    %rsi,%r12
+  804a0f:	41 89 d5             	mov    %edx,%r13d
+  804a12:	41 89 ce             	mov    %ecx,%r14d
+  804a15:	44 89 cb             	mov    %r9d,%ebx
+  804a18:	45 85 c9             	test   %r9d,%r9d
+  804a1b:	0f 88 f4 01 00 00    	js     804c15 <mmap+0x22a>
+  804a21:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a28:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a2f:	0f 85 e7 01 00 00    	jne    804c1c <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a35:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a38:	83 fa 04             	cmp    $0x4,%edx
+  804a3b:	0f 85 db 01 00 00    	jne    804c1c <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a41:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a44:	83 fa 01             	cmp    $0x1,%edx
+  804a47:	0f 87 cf 01 00 00    	ja     804c1c <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a4d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a51:	44 89 c7             	mov    %r8d,%edi
+  804a54:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  804a5b:	00 00 00 
+  804a5e:	ff d0                	call   *%rax
+  804a60:	89 c2                	mov    %eax,%edx
+  804a62:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a69:	85 d2                	test   %edx,%edx
+  804a6b:	0f 88 ab 01 00 00    	js     804c1c <mmap+0x231>
+  804a71:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a75:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a7c:	00 00 00 
+  804a7f:	8b 09                	mov    (%rcx),%ecx
+  804a81:	39 0a                	cmp    %ecx,(%rdx)
+  804a83:	0f 85 93 01 00 00    	jne    804c1c <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804a89:	8b 52 08             	mov    0x8(%rdx),%edx
+  804a8c:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804a8f:	83 fa 01             	cmp    $0x1,%edx
+  804a92:	0f 84 84 01 00 00    	je     804c1c <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804a98:	41 83 fe 01          	cmp    $0x1,%r14d
+  804a9c:	74 42                	je     804ae0 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804a9e:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804aa5:	4c 89 e6             	mov    %r12,%rsi
+  804aa8:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804aaf:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ab3:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ab7:	4d 85 ff             	test   %r15,%r15
+  804aba:	74 67                	je     804b23 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804abc:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ac3:	75 0f                	jne    804ad4 <mmap+0xe9>
+  804ac5:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804acc:	00 00 00 
+  804acf:	49 39 c7             	cmp    %rax,%r15
+  804ad2:	77 1b                	ja     804aef <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804ad4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804adb:	e9 3c 01 00 00       	jmp    804c1c <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ae0:	41 f6 c5 02          	test   $0x2,%r13b
+  804ae4:	74 b8                	je     804a9e <mmap+0xb3>
+  804ae6:	85 d2                	test   %edx,%edx
+  804ae8:	75 b4                	jne    804a9e <mmap+0xb3>
+  804aea:	e9 2d 01 00 00       	jmp    804c1c <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804aef:	4c 89 ff             	mov    %r15,%rdi
+  804af2:	48 b8 59 46 80 00 00 	movabs $0x804659,%rax
+  804af9:	00 00 00 
+  804afc:	ff d0                	call   *%rax
+  804afe:	48 89 c2             	mov    %rax,%rdx
+  804b01:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b08:	49 39 d7             	cmp    %rdx,%r15
+  804b0b:	0f 85 0b 01 00 00    	jne    804c1c <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b11:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b18:	00 00 00 
+  804b1b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b21:	eb 44                	jmp    804b67 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b23:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b27:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b2e:	00 00 00 
+  804b31:	48 b8 59 46 80 00 00 	movabs $0x804659,%rax
+  804b38:	00 00 00 
+  804b3b:	ff d0                	call   *%rax
+  804b3d:	48 89 c7             	mov    %rax,%rdi
+  804b40:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b44:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b4b:	48 85 ff             	test   %rdi,%rdi
+  804b4e:	75 c1                	jne    804b11 <mmap+0x126>
+  804b50:	e9 c7 00 00 00       	jmp    804c1c <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b55:	49 83 c4 01          	add    $0x1,%r12
+  804b59:	48 83 c0 20          	add    $0x20,%rax
+  804b5d:	49 83 fc 20          	cmp    $0x20,%r12
+  804b61:	0f 84 a5 00 00 00    	je     804c0c <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b67:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b6b:	75 e8                	jne    804b55 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b6d:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b71:	48 b8 a5 2d 80 00 00 	movabs $0x802da5,%rax
+  804b78:	00 00 00 
+  804b7b:	ff d0                	call   *%rax
+  804b7d:	89 c2                	mov    %eax,%edx
+  804b7f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b86:	85 d2                	test   %edx,%edx
+  804b88:	0f 88 8e 00 00 00    	js     804c1c <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804b8e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804b92:	48 b8 77 2d 80 00 00 	movabs $0x802d77,%rax
+  804b99:	00 00 00 
+  804b9c:	ff d0                	call   *%rax
+  804b9e:	89 c6                	mov    %eax,%esi
+  804ba0:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804ba3:	48 b8 c5 2f 80 00 00 	movabs $0x802fc5,%rax
+  804baa:	00 00 00 
+  804bad:	ff d0                	call   *%rax
+  804baf:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bb2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bb9:	45 85 ff             	test   %r15d,%r15d
+  804bbc:	78 5e                	js     804c1c <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804bbe:	49 c1 e4 05          	shl    $0x5,%r12
+  804bc2:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bc9:	00 00 00 
+  804bcc:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bcf:	48 bf ca 46 80 00 00 	movabs $0x8046ca,%rdi
+  804bd6:	00 00 00 
+  804bd9:	48 b8 98 51 80 00 00 	movabs $0x805198,%rax
+  804be0:	00 00 00 
+  804be3:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804be5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804be9:	49 89 04 24          	mov    %rax,(%r12)
+  804bed:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804bf1:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804bf6:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804bfb:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c00:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c05:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c0a:	eb 10                	jmp    804c1c <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c0c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c13:	eb 07                	jmp    804c1c <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c15:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c1c:	48 83 c4 38          	add    $0x38,%rsp
+  804c20:	5b                   	pop    %rbx
+  804c21:	41 5c                	pop    %r12
+  804c23:	41 5d                	pop    %r13
+  804c25:	41 5e                	pop    %r14
+  804c27:	41 5f                	pop    %r15
+  804c29:	5d                   	pop    %rbp
+  804c2a:	c3                   	ret
+
+0000000000804c2b <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c2b:	55                   	push   %rbp
+  804c2c:	48 89 e5             	mov    %rsp,%rbp
+  804c2f:	41 57                	push   %r15
+  804c31:	41 56                	push   %r14
+  804c33:	41 55                	push   %r13
+  804c35:	41 54                	push   %r12
+  804c37:	53                   	push   %rbx
+  804c38:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c3c:	49 89 fe             	mov    %rdi,%r14
+  804c3f:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c46:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c4d:	00 
+  804c4e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c55:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c5c:	00 00 00 
+  804c5f:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c66:	49 bf b2 48 80 00 00 	movabs $0x8048b2,%r15
+  804c6d:	00 00 00 
+  804c70:	eb 09                	jmp    804c7b <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c72:	48 83 c3 20          	add    $0x20,%rbx
+  804c76:	4c 39 eb             	cmp    %r13,%rbx
+  804c79:	74 33                	je     804cae <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c7b:	48 89 df             	mov    %rbx,%rdi
+  804c7e:	48 8b 33             	mov    (%rbx),%rsi
+  804c81:	4c 39 e6             	cmp    %r12,%rsi
+  804c84:	73 ec                	jae    804c72 <msync+0x47>
+  804c86:	48 85 f6             	test   %rsi,%rsi
+  804c89:	74 e7                	je     804c72 <msync+0x47>
+  804c8b:	48 89 f2             	mov    %rsi,%rdx
+  804c8e:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804c92:	49 39 d6             	cmp    %rdx,%r14
+  804c95:	73 db                	jae    804c72 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c97:	4c 39 e2             	cmp    %r12,%rdx
+  804c9a:	49 0f 47 d4          	cmova  %r12,%rdx
+  804c9e:	4c 39 f6             	cmp    %r14,%rsi
+  804ca1:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804ca5:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804ca8:	85 c0                	test   %eax,%eax
+  804caa:	79 c6                	jns    804c72 <msync+0x47>
+  804cac:	eb 05                	jmp    804cb3 <msync+0x88>
+    }
+
+    return 0;
+  804cae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cb3:	48 83 c4 08          	add    $0x8,%rsp
+  804cb7:	5b                   	pop    %rbx
+  804cb8:	41 5c                	pop    %r12
+  804cba:	41 5d                	pop    %r13
+  804cbc:	41 5e                	pop    %r14
+  804cbe:	41 5f                	pop    %r15
+  804cc0:	5d                   	pop    %rbp
+  804cc1:	c3                   	ret
+
+0000000000804cc2 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804cc2:	55                   	push   %rbp
+  804cc3:	48 89 e5             	mov    %rsp,%rbp
+  804cc6:	41 57                	push   %r15
+  804cc8:	41 56                	push   %r14
+  804cca:	41 55                	push   %r13
+  804ccc:	41 54                	push   %r12
+  804cce:	53                   	push   %rbx
+  804ccf:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cd3:	49 89 ff             	mov    %rdi,%r15
+  804cd6:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cdd:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804ce4:	00 
+  804ce5:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cec:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804cf3:	00 00 00 
+  804cf6:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804cfd:	48 89 d8             	mov    %rbx,%rax
+  804d00:	eb 09                	jmp    804d0b <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d02:	48 83 c0 20          	add    $0x20,%rax
+  804d06:	4c 39 f0             	cmp    %r14,%rax
+  804d09:	74 40                	je     804d4b <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d0b:	48 8b 10             	mov    (%rax),%rdx
+  804d0e:	4c 39 e2             	cmp    %r12,%rdx
+  804d11:	73 ef                	jae    804d02 <munmap+0x40>
+  804d13:	48 85 d2             	test   %rdx,%rdx
+  804d16:	74 ea                	je     804d02 <munmap+0x40>
+  804d18:	48 89 d7             	mov    %rdx,%rdi
+  804d1b:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d1f:	49 39 ff             	cmp    %rdi,%r15
+  804d22:	73 de                	jae    804d02 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d24:	49 39 fc             	cmp    %rdi,%r12
+  804d27:	72 05                	jb     804d2e <munmap+0x6c>
+  804d29:	4c 39 fa             	cmp    %r15,%rdx
+  804d2c:	73 d4                	jae    804d02 <munmap+0x40>
+  804d2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d33:	48 83 c4 08          	add    $0x8,%rsp
+  804d37:	5b                   	pop    %rbx
+  804d38:	41 5c                	pop    %r12
+  804d3a:	41 5d                	pop    %r13
+  804d3c:	41 5e                	pop    %r14
+  804d3e:	41 5f                	pop    %r15
+  804d40:	5d                   	pop    %rbp
+  804d41:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d42:	48 83 c3 20          	add    $0x20,%rbx
+  804d46:	4c 39 f3             	cmp    %r14,%rbx
+  804d49:	74 5c                	je     804da7 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d4b:	48 8b 33             	mov    (%rbx),%rsi
+  804d4e:	4c 39 e6             	cmp    %r12,%rsi
+  804d51:	73 ef                	jae    804d42 <munmap+0x80>
+  804d53:	48 85 f6             	test   %rsi,%rsi
+  804d56:	74 ea                	je     804d42 <munmap+0x80>
+  804d58:	48 89 f2             	mov    %rsi,%rdx
+  804d5b:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d5f:	49 39 d7             	cmp    %rdx,%r15
+  804d62:	73 de                	jae    804d42 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d64:	48 89 df             	mov    %rbx,%rdi
+  804d67:	48 b8 b2 48 80 00 00 	movabs $0x8048b2,%rax
+  804d6e:	00 00 00 
+  804d71:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d73:	85 c0                	test   %eax,%eax
+  804d75:	78 bc                	js     804d33 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d77:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d7b:	48 8b 33             	mov    (%rbx),%rsi
+  804d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d83:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  804d8a:	00 00 00 
+  804d8d:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804d8f:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804d92:	48 b8 6a 2f 80 00 00 	movabs $0x802f6a,%rax
+  804d99:	00 00 00 
+  804d9c:	ff d0                	call   *%rax
+        reg->start = 0;
+  804d9e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804da5:	eb 9b                	jmp    804d42 <munmap+0x80>
+    return 0;
+  804da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dac:	eb 85                	jmp    804d33 <munmap+0x71>
+
+0000000000804dae <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db3:	c3                   	ret
+
+0000000000804db4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804db4:	55                   	push   %rbp
+  804db5:	48 89 e5             	mov    %rsp,%rbp
+  804db8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dbb:	48 be c5 62 80 00 00 	movabs $0x8062c5,%rsi
+  804dc2:	00 00 00 
+  804dc5:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  804dcc:	00 00 00 
+  804dcf:	ff d0                	call   *%rax
+    return 0;
+}
+  804dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd6:	5d                   	pop    %rbp
+  804dd7:	c3                   	ret
+
+0000000000804dd8 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804dd8:	55                   	push   %rbp
+  804dd9:	48 89 e5             	mov    %rsp,%rbp
+  804ddc:	41 57                	push   %r15
+  804dde:	41 56                	push   %r14
+  804de0:	41 55                	push   %r13
+  804de2:	41 54                	push   %r12
+  804de4:	53                   	push   %rbx
+  804de5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804dec:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804df3:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804dfa:	00 00 00 00 
+  804dfe:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e05:	00 00 00 00 
+  804e09:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e10:	00 00 00 00 
+  804e14:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e1b:	00 00 00 00 
+  804e1f:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e26:	00 00 00 00 
+  804e2a:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e31:	00 00 00 00 
+  804e35:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e3c:	00 
+  804e3d:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e44:	00 
+  804e45:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e4c:	00 
+  804e4d:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e54:	00 
+  804e55:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e5c:	00 
+  804e5d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e64:	00 
+  804e65:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e6c:	00 
+  804e6d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e74:	00 
+  804e75:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e7c:	00 
+  804e7d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804e84:	00 
+    for (res = 0; res < n; res += inc) {
+  804e85:	48 85 d2             	test   %rdx,%rdx
+  804e88:	74 7a                	je     804f04 <devcons_write+0x12c>
+  804e8a:	49 89 d6             	mov    %rdx,%r14
+  804e8d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e93:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804e98:	49 bf 04 23 80 00 00 	movabs $0x802304,%r15
+  804e9f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ea2:	4c 89 f3             	mov    %r14,%rbx
+  804ea5:	48 29 f3             	sub    %rsi,%rbx
+  804ea8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ead:	48 39 c3             	cmp    %rax,%rbx
+  804eb0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804eb4:	4c 63 eb             	movslq %ebx,%r13
+  804eb7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ebe:	48 01 c6             	add    %rax,%rsi
+  804ec1:	4c 89 ea             	mov    %r13,%rdx
+  804ec4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ecb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ece:	4c 89 ee             	mov    %r13,%rsi
+  804ed1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ed8:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  804edf:	00 00 00 
+  804ee2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804ee4:	41 01 dc             	add    %ebx,%r12d
+  804ee7:	49 63 f4             	movslq %r12d,%rsi
+  804eea:	4c 39 f6             	cmp    %r14,%rsi
+  804eed:	72 b3                	jb     804ea2 <devcons_write+0xca>
+    return res;
+  804eef:	49 63 c4             	movslq %r12d,%rax
+}
+  804ef2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804ef9:	5b                   	pop    %rbx
+  804efa:	41 5c                	pop    %r12
+  804efc:	41 5d                	pop    %r13
+  804efe:	41 5e                	pop    %r14
+  804f00:	41 5f                	pop    %r15
+  804f02:	5d                   	pop    %rbp
+  804f03:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f04:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f0a:	eb e3                	jmp    804eef <devcons_write+0x117>
+
+0000000000804f0c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f0c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f14:	48 85 c0             	test   %rax,%rax
+  804f17:	74 55                	je     804f6e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f19:	55                   	push   %rbp
+  804f1a:	48 89 e5             	mov    %rsp,%rbp
+  804f1d:	41 55                	push   %r13
+  804f1f:	41 54                	push   %r12
+  804f21:	53                   	push   %rbx
+  804f22:	48 83 ec 08          	sub    $0x8,%rsp
+  804f26:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f29:	48 bb 64 25 80 00 00 	movabs $0x802564,%rbx
+  804f30:	00 00 00 
+  804f33:	49 bc 78 26 80 00 00 	movabs $0x802678,%r12
+  804f3a:	00 00 00 
+  804f3d:	eb 03                	jmp    804f42 <devcons_read+0x36>
+  804f3f:	41 ff d4             	call   *%r12
+  804f42:	ff d3                	call   *%rbx
+  804f44:	85 c0                	test   %eax,%eax
+  804f46:	74 f7                	je     804f3f <devcons_read+0x33>
+    if (c < 0) return c;
+  804f48:	48 63 d0             	movslq %eax,%rdx
+  804f4b:	78 13                	js     804f60 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f52:	83 f8 04             	cmp    $0x4,%eax
+  804f55:	74 09                	je     804f60 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f57:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f5b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f60:	48 89 d0             	mov    %rdx,%rax
+  804f63:	48 83 c4 08          	add    $0x8,%rsp
+  804f67:	5b                   	pop    %rbx
+  804f68:	41 5c                	pop    %r12
+  804f6a:	41 5d                	pop    %r13
+  804f6c:	5d                   	pop    %rbp
+  804f6d:	c3                   	ret
+  804f6e:	48 89 d0             	mov    %rdx,%rax
+  804f71:	c3                   	ret
+
+0000000000804f72 <cputchar>:
+cputchar(int ch) {
+  804f72:	55                   	push   %rbp
+  804f73:	48 89 e5             	mov    %rsp,%rbp
+  804f76:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f7a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804f7e:	be 01 00 00 00       	mov    $0x1,%esi
+  804f83:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804f87:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  804f8e:	00 00 00 
+  804f91:	ff d0                	call   *%rax
+}
+  804f93:	c9                   	leave
+  804f94:	c3                   	ret
+
+0000000000804f95 <getchar>:
+getchar(void) {
+  804f95:	55                   	push   %rbp
+  804f96:	48 89 e5             	mov    %rsp,%rbp
+  804f99:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804f9d:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fa2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fab:	48 b8 e8 30 80 00 00 	movabs $0x8030e8,%rax
+  804fb2:	00 00 00 
+  804fb5:	ff d0                	call   *%rax
+  804fb7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fb9:	85 c0                	test   %eax,%eax
+  804fbb:	78 06                	js     804fc3 <getchar+0x2e>
+  804fbd:	74 08                	je     804fc7 <getchar+0x32>
+  804fbf:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fc3:	89 d0                	mov    %edx,%eax
+  804fc5:	c9                   	leave
+  804fc6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fc7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fcc:	eb f5                	jmp    804fc3 <getchar+0x2e>
+
+0000000000804fce <iscons>:
+iscons(int fdnum) {
+  804fce:	55                   	push   %rbp
+  804fcf:	48 89 e5             	mov    %rsp,%rbp
+  804fd2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804fd6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fda:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  804fe1:	00 00 00 
+  804fe4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fe6:	85 c0                	test   %eax,%eax
+  804fe8:	78 18                	js     805002 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804fea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804fee:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804ff5:	00 00 00 
+  804ff8:	8b 00                	mov    (%rax),%eax
+  804ffa:	39 02                	cmp    %eax,(%rdx)
+  804ffc:	0f 94 c0             	sete   %al
+  804fff:	0f b6 c0             	movzbl %al,%eax
+}
+  805002:	c9                   	leave
+  805003:	c3                   	ret
+
+0000000000805004 <opencons>:
+opencons(void) {
+  805004:	55                   	push   %rbp
+  805005:	48 89 e5             	mov    %rsp,%rbp
+  805008:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80500c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805010:	48 b8 a5 2d 80 00 00 	movabs $0x802da5,%rax
+  805017:	00 00 00 
+  80501a:	ff d0                	call   *%rax
+  80501c:	85 c0                	test   %eax,%eax
+  80501e:	78 49                	js     805069 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805020:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805025:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80502a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80502e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805033:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  80503a:	00 00 00 
+  80503d:	ff d0                	call   *%rax
+  80503f:	85 c0                	test   %eax,%eax
+  805041:	78 26                	js     805069 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805043:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805047:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80504e:	00 00 
+  805050:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805052:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805056:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80505d:	48 b8 77 2d 80 00 00 	movabs $0x802d77,%rax
+  805064:	00 00 00 
+  805067:	ff d0                	call   *%rax
+}
+  805069:	c9                   	leave
+  80506a:	c3                   	ret
+
+000000000080506b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80506b:	55                   	push   %rbp
+  80506c:	48 89 e5             	mov    %rsp,%rbp
+  80506f:	41 56                	push   %r14
+  805071:	41 55                	push   %r13
+  805073:	41 54                	push   %r12
+  805075:	53                   	push   %rbx
+  805076:	48 83 ec 50          	sub    $0x50,%rsp
+  80507a:	49 89 fc             	mov    %rdi,%r12
+  80507d:	41 89 f5             	mov    %esi,%r13d
+  805080:	48 89 d3             	mov    %rdx,%rbx
+  805083:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805087:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80508b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80508f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805096:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80509a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80509e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050a2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050a6:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050ad:	00 00 00 
+  8050b0:	4c 8b 30             	mov    (%rax),%r14
+  8050b3:	48 b8 41 26 80 00 00 	movabs $0x802641,%rax
+  8050ba:	00 00 00 
+  8050bd:	ff d0                	call   *%rax
+  8050bf:	89 c6                	mov    %eax,%esi
+  8050c1:	45 89 e8             	mov    %r13d,%r8d
+  8050c4:	4c 89 e1             	mov    %r12,%rcx
+  8050c7:	4c 89 f2             	mov    %r14,%rdx
+  8050ca:	48 bf d8 62 80 00 00 	movabs $0x8062d8,%rdi
+  8050d1:	00 00 00 
+  8050d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050d9:	49 bc 7d 16 80 00 00 	movabs $0x80167d,%r12
+  8050e0:	00 00 00 
+  8050e3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8050e6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8050ea:	48 89 df             	mov    %rbx,%rdi
+  8050ed:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  8050f4:	00 00 00 
+  8050f7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8050f9:	48 bf b3 61 80 00 00 	movabs $0x8061b3,%rdi
+  805100:	00 00 00 
+  805103:	b8 00 00 00 00       	mov    $0x0,%eax
+  805108:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80510b:	cc                   	int3
+  80510c:	eb fd                	jmp    80510b <_panic+0xa0>
+
+000000000080510e <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80510e:	55                   	push   %rbp
+  80510f:	48 89 e5             	mov    %rsp,%rbp
+  805112:	41 56                	push   %r14
+  805114:	41 55                	push   %r13
+  805116:	41 54                	push   %r12
+  805118:	53                   	push   %rbx
+  805119:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80511c:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805123:	00 00 00 
+  805126:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80512a:	74 27                	je     805153 <_handle_vectored_pagefault+0x45>
+  80512c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805131:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805138:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80513b:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80513e:	4c 89 e7             	mov    %r12,%rdi
+  805141:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805146:	84 c0                	test   %al,%al
+  805148:	75 45                	jne    80518f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80514a:	48 83 c3 01          	add    $0x1,%rbx
+  80514e:	49 3b 1e             	cmp    (%r14),%rbx
+  805151:	72 eb                	jb     80513e <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805153:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80515a:	00 
+  80515b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805160:	4d 8b 04 24          	mov    (%r12),%r8
+  805164:	48 ba 00 63 80 00 00 	movabs $0x806300,%rdx
+  80516b:	00 00 00 
+  80516e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805173:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  80517a:	00 00 00 
+  80517d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805182:	49 ba 6b 50 80 00 00 	movabs $0x80506b,%r10
+  805189:	00 00 00 
+  80518c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80518f:	5b                   	pop    %rbx
+  805190:	41 5c                	pop    %r12
+  805192:	41 5d                	pop    %r13
+  805194:	41 5e                	pop    %r14
+  805196:	5d                   	pop    %rbp
+  805197:	c3                   	ret
+
+0000000000805198 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805198:	55                   	push   %rbp
+  805199:	48 89 e5             	mov    %rsp,%rbp
+  80519c:	53                   	push   %rbx
+  80519d:	48 83 ec 08          	sub    $0x8,%rsp
+  8051a1:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051a4:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051a9:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051b0:	00 00 00 
+  8051b3:	80 38 00             	cmpb   $0x0,(%rax)
+  8051b6:	74 68                	je     805220 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051b8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051bf:	00 00 00 
+  8051c2:	48 8b 08             	mov    (%rax),%rcx
+  8051c5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051ca:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051d1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051d4:	48 85 c9             	test   %rcx,%rcx
+  8051d7:	0f 84 e0 00 00 00    	je     8052bd <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051dd:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8051e1:	0f 84 c9 00 00 00    	je     8052b0 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051e7:	48 83 c2 01          	add    $0x1,%rdx
+  8051eb:	48 39 ca             	cmp    %rcx,%rdx
+  8051ee:	75 ed                	jne    8051dd <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8051f0:	48 83 f9 08          	cmp    $0x8,%rcx
+  8051f4:	0f 84 84 00 00 00    	je     80527e <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8051fa:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8051fe:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805205:	00 00 00 
+  805208:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80520f:	00 00 00 
+  805212:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805216:	85 f6                	test   %esi,%esi
+  805218:	0f 89 97 00 00 00    	jns    8052b5 <add_pgfault_handler+0x11d>
+  80521e:	eb 63                	jmp    805283 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805220:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805225:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80522a:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805231:	00 00 00 
+  805234:	bf 00 00 00 00       	mov    $0x0,%edi
+  805239:	48 b8 19 27 80 00 00 	movabs $0x802719,%rax
+  805240:	00 00 00 
+  805243:	ff d0                	call   *%rax
+  805245:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805247:	85 c0                	test   %eax,%eax
+  805249:	78 38                	js     805283 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80524b:	48 be 99 53 80 00 00 	movabs $0x805399,%rsi
+  805252:	00 00 00 
+  805255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80525a:	48 b8 3c 29 80 00 00 	movabs $0x80293c,%rax
+  805261:	00 00 00 
+  805264:	ff d0                	call   *%rax
+  805266:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805268:	85 c0                	test   %eax,%eax
+  80526a:	78 17                	js     805283 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80526c:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805273:	00 00 00 
+  805276:	c6 00 01             	movb   $0x1,(%rax)
+  805279:	e9 3a ff ff ff       	jmp    8051b8 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80527e:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805283:	89 f1                	mov    %esi,%ecx
+  805285:	48 ba 3e 63 80 00 00 	movabs $0x80633e,%rdx
+  80528c:	00 00 00 
+  80528f:	be 42 00 00 00       	mov    $0x42,%esi
+  805294:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  80529b:	00 00 00 
+  80529e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052a3:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  8052aa:	00 00 00 
+  8052ad:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052b0:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052b5:	89 f0                	mov    %esi,%eax
+  8052b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052bb:	c9                   	leave
+  8052bc:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052bd:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052c4:	00 00 00 
+  8052c7:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052ce:	48 89 d8             	mov    %rbx,%rax
+  8052d1:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052d8:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052db:	eb d8                	jmp    8052b5 <add_pgfault_handler+0x11d>
+
+00000000008052dd <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8052dd:	55                   	push   %rbp
+  8052de:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8052e1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8052e8:	00 00 00 
+  8052eb:	80 38 00             	cmpb   $0x0,(%rax)
+  8052ee:	74 33                	je     805323 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8052f0:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8052f7:	00 00 00 
+  8052fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8052ff:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805306:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805309:	48 85 c0             	test   %rax,%rax
+  80530c:	0f 84 85 00 00 00    	je     805397 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805312:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805316:	74 40                	je     805358 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805318:	48 83 c1 01          	add    $0x1,%rcx
+  80531c:	48 39 c1             	cmp    %rax,%rcx
+  80531f:	75 f1                	jne    805312 <remove_pgfault_handler+0x35>
+  805321:	eb 74                	jmp    805397 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805323:	48 b9 56 63 80 00 00 	movabs $0x806356,%rcx
+  80532a:	00 00 00 
+  80532d:	48 ba 16 62 80 00 00 	movabs $0x806216,%rdx
+  805334:	00 00 00 
+  805337:	be 48 00 00 00       	mov    $0x48,%esi
+  80533c:	48 bf 30 63 80 00 00 	movabs $0x806330,%rdi
+  805343:	00 00 00 
+  805346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80534b:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  805352:	00 00 00 
+  805355:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805358:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80535f:	00 
+  805360:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805364:	48 29 ca             	sub    %rcx,%rdx
+  805367:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80536e:	00 00 00 
+  805371:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805375:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80537a:	48 89 ce             	mov    %rcx,%rsi
+  80537d:	48 b8 04 23 80 00 00 	movabs $0x802304,%rax
+  805384:	00 00 00 
+  805387:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805389:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805390:	00 00 00 
+  805393:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805397:	5d                   	pop    %rbp
+  805398:	c3                   	ret
+
+0000000000805399 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805399:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80539c:	48 b8 0e 51 80 00 00 	movabs $0x80510e,%rax
+  8053a3:	00 00 00 
+    call *%rax
+  8053a6:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053a8:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053af:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053b0:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053b7:	00 
+    subq $8, %rcx
+  8053b8:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053bc:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053bf:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053c6:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053c7:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053cb:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053cf:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053d4:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053d9:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8053de:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8053e3:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8053e8:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8053ed:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8053f2:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8053f7:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8053fc:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805401:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805406:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80540b:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805410:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805415:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805419:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80541d:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80541e:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80541f:	c3                   	ret
+
+0000000000805420 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805420:	85 ff                	test   %edi,%edi
+  805422:	78 58                	js     80547c <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805424:	48 85 f6             	test   %rsi,%rsi
+  805427:	74 12                	je     80543b <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805429:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805430:	00 00 00 
+  805433:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805439:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80543b:	48 85 c9             	test   %rcx,%rcx
+  80543e:	74 12                	je     805452 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805440:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805447:	00 00 00 
+  80544a:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805450:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805452:	48 85 d2             	test   %rdx,%rdx
+  805455:	74 14                	je     80546b <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805457:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80545e:	00 00 00 
+  805461:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805468:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80546b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805472:	00 00 00 
+  805475:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80547b:	c3                   	ret
+        if (from_env_store) {
+  80547c:	48 85 f6             	test   %rsi,%rsi
+  80547f:	74 06                	je     805487 <ipc_result+0x67>
+            *from_env_store = 0;
+  805481:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805487:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805489:	48 85 c9             	test   %rcx,%rcx
+  80548c:	74 ed                	je     80547b <ipc_result+0x5b>
+            *perm_store = 0;
+  80548e:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805494:	c3                   	ret
+
+0000000000805495 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805495:	55                   	push   %rbp
+  805496:	48 89 e5             	mov    %rsp,%rbp
+  805499:	41 55                	push   %r13
+  80549b:	41 54                	push   %r12
+  80549d:	53                   	push   %rbx
+  80549e:	48 83 ec 08          	sub    $0x8,%rsp
+  8054a2:	49 89 fc             	mov    %rdi,%r12
+  8054a5:	48 89 f7             	mov    %rsi,%rdi
+  8054a8:	48 89 d3             	mov    %rdx,%rbx
+  8054ab:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054ae:	48 85 f6             	test   %rsi,%rsi
+  8054b1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054b8:	00 00 00 
+  8054bb:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8054c4:	48 85 d2             	test   %rdx,%rdx
+  8054c7:	74 03                	je     8054cc <ipc_recv+0x37>
+  8054c9:	48 8b 32             	mov    (%rdx),%rsi
+  8054cc:	48 b8 65 2c 80 00 00 	movabs $0x802c65,%rax
+  8054d3:	00 00 00 
+  8054d6:	ff d0                	call   *%rax
+  8054d8:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054da:	4c 89 e9             	mov    %r13,%rcx
+  8054dd:	48 89 da             	mov    %rbx,%rdx
+  8054e0:	4c 89 e6             	mov    %r12,%rsi
+  8054e3:	48 b8 20 54 80 00 00 	movabs $0x805420,%rax
+  8054ea:	00 00 00 
+  8054ed:	ff d0                	call   *%rax
+}
+  8054ef:	48 83 c4 08          	add    $0x8,%rsp
+  8054f3:	5b                   	pop    %rbx
+  8054f4:	41 5c                	pop    %r12
+  8054f6:	41 5d                	pop    %r13
+  8054f8:	5d                   	pop    %rbp
+  8054f9:	c3                   	ret
+
+00000000008054fa <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8054fa:	55                   	push   %rbp
+  8054fb:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054fe:	48 85 d2             	test   %rdx,%rdx
+  805501:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805508:	00 00 00 
+  80550b:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80550f:	89 f6                	mov    %esi,%esi
+  805511:	48 b8 f1 2a 80 00 00 	movabs $0x802af1,%rax
+  805518:	00 00 00 
+  80551b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80551d:	85 c0                	test   %eax,%eax
+  80551f:	78 02                	js     805523 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805521:	5d                   	pop    %rbp
+  805522:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805523:	89 c1                	mov    %eax,%ecx
+  805525:	48 ba 70 63 80 00 00 	movabs $0x806370,%rdx
+  80552c:	00 00 00 
+  80552f:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805534:	48 bf 7d 63 80 00 00 	movabs $0x80637d,%rdi
+  80553b:	00 00 00 
+  80553e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805543:	49 b8 6b 50 80 00 00 	movabs $0x80506b,%r8
+  80554a:	00 00 00 
+  80554d:	41 ff d0             	call   *%r8
+
+0000000000805550 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805550:	55                   	push   %rbp
+  805551:	48 89 e5             	mov    %rsp,%rbp
+  805554:	53                   	push   %rbx
+  805555:	48 83 ec 08          	sub    $0x8,%rsp
+  805559:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80555d:	48 85 d2             	test   %rdx,%rdx
+  805560:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805567:	00 00 00 
+  80556a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80556e:	4d 85 c9             	test   %r9,%r9
+  805571:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80557a:	48 85 db             	test   %rbx,%rbx
+  80557d:	74 03                	je     805582 <ipc_call+0x32>
+  80557f:	48 8b 03             	mov    (%rbx),%rax
+  805582:	89 f6                	mov    %esi,%esi
+  805584:	48 83 ec 08          	sub    $0x8,%rsp
+  805588:	50                   	push   %rax
+  805589:	48 b8 23 2b 80 00 00 	movabs $0x802b23,%rax
+  805590:	00 00 00 
+  805593:	ff d0                	call   *%rax
+  805595:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805597:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80559b:	48 89 da             	mov    %rbx,%rdx
+  80559e:	be 00 00 00 00       	mov    $0x0,%esi
+  8055a3:	48 b8 20 54 80 00 00 	movabs $0x805420,%rax
+  8055aa:	00 00 00 
+  8055ad:	ff d0                	call   *%rax
+}
+  8055af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055b3:	c9                   	leave
+  8055b4:	c3                   	ret
+
+00000000008055b5 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055b5:	55                   	push   %rbp
+  8055b6:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055b9:	89 f6                	mov    %esi,%esi
+  8055bb:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  8055c2:	00 00 00 
+  8055c5:	ff d0                	call   *%rax
+  8055c7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8055d8:	48 b8 20 54 80 00 00 	movabs $0x805420,%rax
+  8055df:	00 00 00 
+  8055e2:	ff d0                	call   *%rax
+}
+  8055e4:	5d                   	pop    %rbp
+  8055e5:	c3                   	ret
+
+00000000008055e6 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8055e6:	55                   	push   %rbp
+  8055e7:	48 89 e5             	mov    %rsp,%rbp
+  8055ea:	41 54                	push   %r12
+  8055ec:	53                   	push   %rbx
+  8055ed:	4c 89 cb             	mov    %r9,%rbx
+  8055f0:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8055f4:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8055f8:	48 85 d2             	test   %rdx,%rdx
+  8055fb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805602:	00 00 00 
+  805605:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805609:	4d 85 c9             	test   %r9,%r9
+  80560c:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805610:	b8 00 00 00 00       	mov    $0x0,%eax
+  805615:	4d 85 e4             	test   %r12,%r12
+  805618:	74 04                	je     80561e <ipc_reply_wait+0x38>
+  80561a:	49 8b 04 24          	mov    (%r12),%rax
+  80561e:	89 f6                	mov    %esi,%esi
+  805620:	48 83 ec 08          	sub    $0x8,%rsp
+  805624:	50                   	push   %rax
+  805625:	48 b8 f9 2b 80 00 00 	movabs $0x802bf9,%rax
+  80562c:	00 00 00 
+  80562f:	ff d0                	call   *%rax
+  805631:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805633:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805637:	4c 89 e2             	mov    %r12,%rdx
+  80563a:	48 89 de             	mov    %rbx,%rsi
+  80563d:	48 b8 20 54 80 00 00 	movabs $0x805420,%rax
+  805644:	00 00 00 
+  805647:	ff d0                	call   *%rax
+}
+  805649:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80564d:	5b                   	pop    %rbx
+  80564e:	41 5c                	pop    %r12
+  805650:	5d                   	pop    %rbp
+  805651:	c3                   	ret
+
+0000000000805652 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805652:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805657:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80565e:	00 00 00 
+  805661:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805668:	48 01 ca             	add    %rcx,%rdx
+  80566b:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805671:	39 fa                	cmp    %edi,%edx
+  805673:	74 12                	je     805687 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805675:	48 83 c0 01          	add    $0x1,%rax
+  805679:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80567f:	75 e0                	jne    805661 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805681:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805686:	c3                   	ret
+            return envs[i].env_id;
+  805687:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80568e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805695:	00 00 00 
+  805698:	48 01 d0             	add    %rdx,%rax
+  80569b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056a1:	c3                   	ret
+  8056a2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008056a8 <__rodata_start>:
+  8056a8:	77 00                	ja     8056aa <__rodata_start+0x2>
+  8056aa:	72 62                	jb     80570e <__rodata_start+0x66>
+  8056ac:	00 77 62             	add    %dh,0x62(%rdi)
+  8056af:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056b2:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056b9:	00 
+  8056ba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8056c0:	b3 09                	mov    $0x9,%bl
+  8056c2:	80 00 00             	addb   $0x0,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 ed                	add    %ch,%ch
+  8056c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ce:	00 00                	add    %al,(%rax)
+  8056d0:	ed                   	in     (%dx),%eax
+  8056d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056d6:	00 00                	add    %al,(%rax)
+  8056d8:	ed                   	in     (%dx),%eax
+  8056d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056de:	00 00                	add    %al,(%rax)
+  8056e0:	ed                   	in     (%dx),%eax
+  8056e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056e6:	00 00                	add    %al,(%rax)
+  8056e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 ed                	add    %ch,%ch
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	ed                   	in     (%dx),%eax
+  805709:	0d 80 00 00 00       	or     $0x80,%eax
+  80570e:	00 00                	add    %al,(%rax)
+  805710:	ed                   	in     (%dx),%eax
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	8c 0a                	mov    %cs,(%rdx)
+  80571a:	80 00 00             	addb   $0x0,(%rax)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805726:	00 00                	add    %al,(%rax)
+  805728:	8c 0a                	mov    %cs,(%rdx)
+  80572a:	80 00 00             	addb   $0x0,(%rax)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	ed                   	in     (%dx),%eax
+  805769:	0d 80 00 00 00       	or     $0x80,%eax
+  80576e:	00 00                	add    %al,(%rax)
+  805770:	ed                   	in     (%dx),%eax
+  805771:	0d 80 00 00 00       	or     $0x80,%eax
+  805776:	00 00                	add    %al,(%rax)
+  805778:	ed                   	in     (%dx),%eax
+  805779:	0d 80 00 00 00       	or     $0x80,%eax
+  80577e:	00 00                	add    %al,(%rax)
+  805780:	ed                   	in     (%dx),%eax
+  805781:	0d 80 00 00 00       	or     $0x80,%eax
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	f4                   	hlt
+  805859:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80585f:	00 ed                	add    %ch,%ch
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	2c 0b                	sub    $0xb,%al
+  805872:	80 00 00             	addb   $0x0,(%rax)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 ed                	add    %ch,%ch
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058b3:	00 00                	add    %al,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 cb                	add    %cl,%bl
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	6a 0a                	push   $0xa
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 ed                	add    %ch,%ch
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	3c 0a                	cmp    $0xa,%al
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 ed                	add    %ch,%ch
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80590b:	00 00                	add    %al,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 29                	add    %ch,(%rcx)
+  805919:	0c 80                	or     $0x80,%al
+  80591b:	00 00                	add    %al,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805922:	80 00 00             	addb   $0x0,(%rax)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	1a 0b                	sbb    (%rbx),%cl
+  805932:	80 00 00             	addb   $0x0,(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 ed                	add    %ch,%ch
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ce                   	(bad)
+  805941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	f4                   	hlt
+  805959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80595f:	00 37                	add    %dh,(%rdi)
+  805961:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805967:	00 5f 12             	add    %bl,0x12(%rdi)
+  80596a:	80 00 00             	addb   $0x0,(%rax)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 37                	add    %dh,(%rdi)
+  805971:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805977:	00 5f 12             	add    %bl,0x12(%rdi)
+  80597a:	80 00 00             	addb   $0x0,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80598b:	00 00                	add    %al,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 d2                	add    %dl,%dl
+  805991:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805997:	00 d2                	add    %dl,%dl
+  805999:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80599f:	00 d2                	add    %dl,%dl
+  8059a1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059a7:	00 d2                	add    %dl,%dl
+  8059a9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 f6                	add    %dh,%dh
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 f6                	add    %dh,%dh
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 22                	add    %ah,(%rdx)
+  805a11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a17:	00 22                	add    %ah,(%rdx)
+  805a19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a1f:	00 22                	add    %ah,(%rdx)
+  805a21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a27:	00 22                	add    %ah,(%rdx)
+  805a29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 46 12             	add    %al,0x12(%rsi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 22                	add    %ah,(%rdx)
+  805b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b17:	00 22                	add    %ah,(%rdx)
+  805b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b1f:	00 22                	add    %ah,(%rdx)
+  805b21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b27:	00 22                	add    %ah,(%rdx)
+  805b29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 46 12             	add    %al,0x12(%rsi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805be0 <basefix.0>:
+  805be0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805bf0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c00:	10 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33     ..<unknown>.0123
+  805c10:	34 35 36 37 38 39 41 42 43 44 45 46 00 30 31 32     456789ABCDEF.012
+  805c20:	33 34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e     3456789abcdef.(n
+  805c30:	75 6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e     ull).error %d.un
+  805c40:	73 70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00     specified error.
+  805c50:	62 61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00     bad environment.
+  805c60:	69 6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65     invalid paramete
+  805c70:	72 00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00     r.out of memory.
+  805c80:	6f 75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65     out of environme
+  805c90:	6e 74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65     nts.corrupted de
+  805ca0:	62 75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74     bug info.segment
+  805cb0:	61 74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61     ation fault.inva
+  805cc0:	6c 69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f     lid ELF image.no
+  805cd0:	20 73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c      such system cal
+  805ce0:	6c 00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e     l.entry not foun
+  805cf0:	64 00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63     d.env is not rec
+  805d00:	76 69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20     ving.unexpected 
+  805d10:	65 6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66     end of file.no f
+  805d20:	72 65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73     ree space on dis
+  805d30:	6b 00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73     k.too many files
+  805d40:	20 61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f      are open.file o
+  805d50:	72 20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e     r block not foun
+  805d60:	64 00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66     d.invalid path.f
+  805d70:	69 6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73     ile already exis
+  805d80:	74 73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74     ts.operation not
+  805d90:	20 73 75 70 70 6f 72 74 65 64 00 0f 1f 44 00 00      supported...D..
+  805da0:	75 18 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     u...............
+  805db0:	bc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805dc0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805dd0:	cc 1e 80 00 00 00 00 00 94 18 80 00 00 00 00 00     ................
+  805de0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805df0:	88 18 80 00 00 00 00 00 02 19 80 00 00 00 00 00     ................
+  805e00:	cc 1e 80 00 00 00 00 00 88 18 80 00 00 00 00 00     ................
+  805e10:	ce 18 80 00 00 00 00 00 ce 18 80 00 00 00 00 00     ................
+  805e20:	ce 18 80 00 00 00 00 00 ce 18 80 00 00 00 00 00     ................
+  805e30:	ce 18 80 00 00 00 00 00 ce 18 80 00 00 00 00 00     ................
+  805e40:	ce 18 80 00 00 00 00 00 ce 18 80 00 00 00 00 00     ................
+  805e50:	ce 18 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805e60:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805e70:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805e80:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805e90:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805ea0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805eb0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805ec0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805ed0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805ee0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805ef0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f00:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f10:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f20:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f30:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f40:	cc 1e 80 00 00 00 00 00 ea 1d 80 00 00 00 00 00     ................
+  805f50:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f60:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f70:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f80:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805f90:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805fa0:	30 19 80 00 00 00 00 00 ff 1a 80 00 00 00 00 00     0...............
+  805fb0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  805fc0:	cc 1e 80 00 00 00 00 00 25 19 80 00 00 00 00 00     ........%.......
+  805fd0:	5f 19 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     _...............
+  805fe0:	cc 1e 80 00 00 00 00 00 1a 19 80 00 00 00 00 00     ................
+  805ff0:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  806000:	a8 1c 80 00 00 00 00 00 77 1d 80 00 00 00 00 00     ........w.......
+  806010:	cc 1e 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  806020:	f6 19 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  806030:	d3 1b 80 00 00 00 00 00 cc 1e 80 00 00 00 00 00     ................
+  806040:	cc 1e 80 00 00 00 00 00 ea 1d 80 00 00 00 00 00     ................
+  806050:	cc 1e 80 00 00 00 00 00 7e 18 80 00 00 00 00 00     ........~.......
+
+0000000000806060 <error_string>:
+	...
+  806068:	3e 5c 80 00 00 00 00 00 50 5c 80 00 00 00 00 00     >\......P\......
+  806078:	60 5c 80 00 00 00 00 00 72 5c 80 00 00 00 00 00     `\......r\......
+  806088:	80 5c 80 00 00 00 00 00 94 5c 80 00 00 00 00 00     .\.......\......
+  806098:	a9 5c 80 00 00 00 00 00 bc 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	ce 5c 80 00 00 00 00 00 e2 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	f2 5c 80 00 00 00 00 00 05 5d 80 00 00 00 00 00     .\.......]......
+  8060c8:	1c 5d 80 00 00 00 00 00 32 5d 80 00 00 00 00 00     .]......2]......
+  8060d8:	4a 5d 80 00 00 00 00 00 62 5d 80 00 00 00 00 00     J]......b]......
+  8060e8:	6f 5d 80 00 00 00 00 00 00 61 80 00 00 00 00 00     o].......a......
+  8060f8:	83 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806108:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806118:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806128:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806138:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806148:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806158:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806168:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806178:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806188:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806198:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008061e0 <devtab>:
+  8061e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8061f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806200:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806210:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806220:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806230:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806240:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806250:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806260:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806270:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806280:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806290:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062b0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062c0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062d0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8062e0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8062f0:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806300:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806310:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806320:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806330:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806340:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806350:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806360:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806370:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806380:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806390:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8063e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,11387 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 a0 80 00 00 	movabs 0x80a000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 a0 80 00 00 	movabs %rax,0x80a000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 a0 80 00 00 	movabs %rax,0x80a000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 a0 80 00 00 	movabs 0x80a000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 a0 80 00 00 	movabs %rax,0x80a000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 a0 80 00 00 	movabs 0x80a000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 49 27 80 00 00 	movabs $0x802749,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 89 38 80 00 00 	movabs $0x803889,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 89 38 80 00 00 	movabs $0x803889,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 8b 1c 80 00 00 	movabs $0x801c8b,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 58 25 80 00 00 	movabs $0x802558,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 58 25 80 00 00 	movabs $0x802558,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 7c 1b 80 00 00 	movabs $0x801b7c,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 7f 6a 80 00 00 	movabs $0x806a7f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 e8 26 80 00 00 	movabs $0x8026e8,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 f2 3f 80 00 00 	movabs $0x803ff2,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 48 63 80 00 00 	movabs $0x806348,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 e8 26 80 00 00 	movabs $0x8026e8,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 f2 3f 80 00 00 	movabs $0x803ff2,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 4a 63 80 00 00 	movabs $0x80634a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 e8 26 80 00 00 	movabs $0x8026e8,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 f2 3f 80 00 00 	movabs $0x803ff2,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 4d 63 80 00 00 	movabs $0x80634d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 e8 26 80 00 00 	movabs $0x8026e8,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 f2 3f 80 00 00 	movabs $0x803ff2,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 f1 59 80 00 00 	movabs $0x8059f1,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 c8 5c 80 00 00 	movabs $0x805cc8,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 3c 3a 80 00 00 	movabs $0x803a3c,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 42 39 80 00 00 	movabs $0x803942,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 42 39 80 00 00 	movabs $0x803942,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 5a 37 80 00 00 	movabs $0x80375a,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 89 38 80 00 00 	movabs $0x803889,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 f2 3f 80 00 00 	movabs $0x803ff2,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 95 28 80 00 00 	movabs $0x802895,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 60 63 80 00 00 	movabs $0x806360,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 95 28 80 00 00 	movabs $0x802895,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 c8 28 80 00 00 	movabs $0x8028c8,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 95 28 80 00 00 	movabs $0x802895,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 00 66 80 00 00 	movabs $0x806600,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 95 28 80 00 00 	movabs $0x802895,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 95 28 80 00 00 	movabs $0x802895,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 80 68 80 00 00 	movabs $0x806880,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 80 68 80 00 00 	movabs $0x806880,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 d4 05 00 00       	call   801ad3 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <sum>:
+char bss[6000];
+
+int
+sum(const char *s, int n) {
+    int i, tot = 0;
+    for (i = 0; i < n; i++)
+  801501:	85 f6                	test   %esi,%esi
+  801503:	7e 22                	jle    801527 <sum+0x26>
+  801505:	48 63 f6             	movslq %esi,%rsi
+  801508:	b8 00 00 00 00       	mov    $0x0,%eax
+    int i, tot = 0;
+  80150d:	b9 00 00 00 00       	mov    $0x0,%ecx
+        tot ^= i * s[i];
+  801512:	0f be 14 07          	movsbl (%rdi,%rax,1),%edx
+  801516:	0f af d0             	imul   %eax,%edx
+  801519:	31 d1                	xor    %edx,%ecx
+    for (i = 0; i < n; i++)
+  80151b:	48 83 c0 01          	add    $0x1,%rax
+  80151f:	48 39 f0             	cmp    %rsi,%rax
+  801522:	75 ee                	jne    801512 <sum+0x11>
+    return tot;
+}
+  801524:	89 c8                	mov    %ecx,%eax
+  801526:	c3                   	ret
+    int i, tot = 0;
+  801527:	b9 00 00 00 00       	mov    $0x0,%ecx
+    return tot;
+  80152c:	eb f6                	jmp    801524 <sum+0x23>
+
+000000000080152e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80152e:	55                   	push   %rbp
+  80152f:	48 89 e5             	mov    %rsp,%rbp
+  801532:	41 57                	push   %r15
+  801534:	41 56                	push   %r14
+  801536:	41 55                	push   %r13
+  801538:	41 54                	push   %r12
+  80153a:	53                   	push   %rbx
+  80153b:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+  801542:	41 89 fc             	mov    %edi,%r12d
+  801545:	49 89 f5             	mov    %rsi,%r13
+    int i, r, x, want;
+    char args[256];
+
+    cprintf("init: running\n");
+  801548:	48 bf a2 68 80 00 00 	movabs $0x8068a2,%rdi
+  80154f:	00 00 00 
+  801552:	b8 00 00 00 00       	mov    $0x0,%eax
+  801557:	48 ba ef 1c 80 00 00 	movabs $0x801cef,%rdx
+  80155e:	00 00 00 
+  801561:	ff d2                	call   *%rdx
+
+    want = 0xf989e;
+    if ((x = sum((char *)&data, sizeof data)) != want)
+  801563:	be 70 17 00 00       	mov    $0x1770,%esi
+  801568:	48 bf 40 80 80 00 00 	movabs $0x808040,%rdi
+  80156f:	00 00 00 
+  801572:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801579:	00 00 00 
+  80157c:	ff d0                	call   *%rax
+  80157e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  801583:	0f 84 64 01 00 00    	je     8016ed <umain+0x1bf>
+        cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  801589:	ba 9e 98 0f 00       	mov    $0xf989e,%edx
+  80158e:	89 c6                	mov    %eax,%esi
+  801590:	48 bf 70 69 80 00 00 	movabs $0x806970,%rdi
+  801597:	00 00 00 
+  80159a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159f:	48 b9 ef 1c 80 00 00 	movabs $0x801cef,%rcx
+  8015a6:	00 00 00 
+  8015a9:	ff d1                	call   *%rcx
+                x, want);
+    else
+        cprintf("init: data seems okay\n");
+    if ((x = sum(bss, sizeof bss)) != 0)
+  8015ab:	be 70 17 00 00       	mov    $0x1770,%esi
+  8015b0:	48 bf 20 a0 80 01 00 	movabs $0x180a020,%rdi
+  8015b7:	00 00 00 
+  8015ba:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015c1:	00 00 00 
+  8015c4:	ff d0                	call   *%rax
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	0f 84 3f 01 00 00    	je     80170d <umain+0x1df>
+        cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8015ce:	89 c6                	mov    %eax,%esi
+  8015d0:	48 bf b0 69 80 00 00 	movabs $0x8069b0,%rdi
+  8015d7:	00 00 00 
+  8015da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015df:	48 ba ef 1c 80 00 00 	movabs $0x801cef,%rdx
+  8015e6:	00 00 00 
+  8015e9:	ff d2                	call   *%rdx
+    else
+        cprintf("init: bss seems okay\n");
+
+    /* Output in one syscall per line to avoid output interleaving */
+    strcat(args, "init: args:");
+  8015eb:	48 be de 68 80 00 00 	movabs $0x8068de,%rsi
+  8015f2:	00 00 00 
+  8015f5:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  8015fc:	48 b8 3e 26 80 00 00 	movabs $0x80263e,%rax
+  801603:	00 00 00 
+  801606:	ff d0                	call   *%rax
+    for (i = 0; i < argc; i++) {
+  801608:	45 85 e4             	test   %r12d,%r12d
+  80160b:	7e 59                	jle    801666 <umain+0x138>
+  80160d:	4c 89 eb             	mov    %r13,%rbx
+  801610:	4d 63 e4             	movslq %r12d,%r12
+  801613:	4f 8d 7c e5 00       	lea    0x0(%r13,%r12,8),%r15
+        strcat(args, " '");
+  801618:	49 be ea 68 80 00 00 	movabs $0x8068ea,%r14
+  80161f:	00 00 00 
+  801622:	49 bc 3e 26 80 00 00 	movabs $0x80263e,%r12
+  801629:	00 00 00 
+        strcat(args, argv[i]);
+        strcat(args, "'");
+  80162c:	49 bd eb 68 80 00 00 	movabs $0x8068eb,%r13
+  801633:	00 00 00 
+        strcat(args, " '");
+  801636:	4c 89 f6             	mov    %r14,%rsi
+  801639:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  801640:	41 ff d4             	call   *%r12
+        strcat(args, argv[i]);
+  801643:	48 8b 33             	mov    (%rbx),%rsi
+  801646:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  80164d:	41 ff d4             	call   *%r12
+        strcat(args, "'");
+  801650:	4c 89 ee             	mov    %r13,%rsi
+  801653:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  80165a:	41 ff d4             	call   *%r12
+    for (i = 0; i < argc; i++) {
+  80165d:	48 83 c3 08          	add    $0x8,%rbx
+  801661:	4c 39 fb             	cmp    %r15,%rbx
+  801664:	75 d0                	jne    801636 <umain+0x108>
+    }
+    cprintf("%s\n", args);
+  801666:	48 8d b5 d0 fe ff ff 	lea    -0x130(%rbp),%rsi
+  80166d:	48 bf ed 68 80 00 00 	movabs $0x8068ed,%rdi
+  801674:	00 00 00 
+  801677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167c:	48 bb ef 1c 80 00 00 	movabs $0x801cef,%rbx
+  801683:	00 00 00 
+  801686:	ff d3                	call   *%rbx
+
+    cprintf("init: running sh\n");
+  801688:	48 bf f1 68 80 00 00 	movabs $0x8068f1,%rdi
+  80168f:	00 00 00 
+  801692:	b8 00 00 00 00       	mov    $0x0,%eax
+  801697:	ff d3                	call   *%rbx
+
+    /* Being run directly from kernel, so no file descriptors open yet */
+    close(0);
+  801699:	bf 00 00 00 00       	mov    $0x0,%edi
+  80169e:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  8016a5:	00 00 00 
+  8016a8:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  8016aa:	48 b8 6c 1a 80 00 00 	movabs $0x801a6c,%rax
+  8016b1:	00 00 00 
+  8016b4:	ff d0                	call   *%rax
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	78 73                	js     80172d <umain+0x1ff>
+        panic("opencons: %i", r);
+    if (r != 0)
+  8016ba:	0f 84 9a 00 00 00    	je     80175a <umain+0x22c>
+        panic("first opencons used fd %d", r);
+  8016c0:	89 c1                	mov    %eax,%ecx
+  8016c2:	48 ba 1c 69 80 00 00 	movabs $0x80691c,%rdx
+  8016c9:	00 00 00 
+  8016cc:	be 36 00 00 00       	mov    $0x36,%esi
+  8016d1:	48 bf 10 69 80 00 00 	movabs $0x806910,%rdi
+  8016d8:	00 00 00 
+  8016db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e0:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  8016e7:	00 00 00 
+  8016ea:	41 ff d0             	call   *%r8
+        cprintf("init: data seems okay\n");
+  8016ed:	48 bf b1 68 80 00 00 	movabs $0x8068b1,%rdi
+  8016f4:	00 00 00 
+  8016f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fc:	48 ba ef 1c 80 00 00 	movabs $0x801cef,%rdx
+  801703:	00 00 00 
+  801706:	ff d2                	call   *%rdx
+  801708:	e9 9e fe ff ff       	jmp    8015ab <umain+0x7d>
+        cprintf("init: bss seems okay\n");
+  80170d:	48 bf c8 68 80 00 00 	movabs $0x8068c8,%rdi
+  801714:	00 00 00 
+  801717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171c:	48 ba ef 1c 80 00 00 	movabs $0x801cef,%rdx
+  801723:	00 00 00 
+  801726:	ff d2                	call   *%rdx
+  801728:	e9 be fe ff ff       	jmp    8015eb <umain+0xbd>
+        panic("opencons: %i", r);
+  80172d:	89 c1                	mov    %eax,%ecx
+  80172f:	48 ba 03 69 80 00 00 	movabs $0x806903,%rdx
+  801736:	00 00 00 
+  801739:	be 34 00 00 00       	mov    $0x34,%esi
+  80173e:	48 bf 10 69 80 00 00 	movabs $0x806910,%rdi
+  801745:	00 00 00 
+  801748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174d:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  801754:	00 00 00 
+  801757:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  80175a:	be 01 00 00 00       	mov    $0x1,%esi
+  80175f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801764:	48 b8 37 36 80 00 00 	movabs $0x803637,%rax
+  80176b:	00 00 00 
+  80176e:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+    while (1) {
+        cprintf("init: starting sh\n");
+  801770:	49 be 3e 69 80 00 00 	movabs $0x80693e,%r14
+  801777:	00 00 00 
+  80177a:	48 bb ef 1c 80 00 00 	movabs $0x801cef,%rbx
+  801781:	00 00 00 
+        r = spawnl("/sh", "sh", (char *)0);
+  801784:	49 bd 52 69 80 00 00 	movabs $0x806952,%r13
+  80178b:	00 00 00 
+  80178e:	49 bc 51 69 80 00 00 	movabs $0x806951,%r12
+  801795:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	79 40                	jns    8017dc <umain+0x2ae>
+        panic("dup: %i", r);
+  80179c:	89 c1                	mov    %eax,%ecx
+  80179e:	48 ba 36 69 80 00 00 	movabs $0x806936,%rdx
+  8017a5:	00 00 00 
+  8017a8:	be 38 00 00 00       	mov    $0x38,%esi
+  8017ad:	48 bf 10 69 80 00 00 	movabs $0x806910,%rdi
+  8017b4:	00 00 00 
+  8017b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bc:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  8017c3:	00 00 00 
+  8017c6:	41 ff d0             	call   *%r8
+        if (r < 0) {
+            cprintf("init: spawn sh: %i\n", r);
+  8017c9:	89 c6                	mov    %eax,%esi
+  8017cb:	48 bf 55 69 80 00 00 	movabs $0x806955,%rdi
+  8017d2:	00 00 00 
+  8017d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017da:	ff d3                	call   *%rbx
+        cprintf("init: starting sh\n");
+  8017dc:	4c 89 f7             	mov    %r14,%rdi
+  8017df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e4:	ff d3                	call   *%rbx
+        r = spawnl("/sh", "sh", (char *)0);
+  8017e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017eb:	4c 89 ee             	mov    %r13,%rsi
+  8017ee:	4c 89 e7             	mov    %r12,%rdi
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f6:	48 b9 43 4b 80 00 00 	movabs $0x804b43,%rcx
+  8017fd:	00 00 00 
+  801800:	ff d1                	call   *%rcx
+        if (r < 0) {
+  801802:	85 c0                	test   %eax,%eax
+  801804:	78 c3                	js     8017c9 <umain+0x29b>
+            continue;
+        }
+        wait(r);
+  801806:	89 c7                	mov    %eax,%edi
+  801808:	48 b8 3e 51 80 00 00 	movabs $0x80513e,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+  801814:	eb c6                	jmp    8017dc <umain+0x2ae>
+
+0000000000801816 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181b:	c3                   	ret
+
+000000000080181c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801823:	48 be df 69 80 00 00 	movabs $0x8069df,%rsi
+  80182a:	00 00 00 
+  80182d:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  801834:	00 00 00 
+  801837:	ff d0                	call   *%rax
+    return 0;
+}
+  801839:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183e:	5d                   	pop    %rbp
+  80183f:	c3                   	ret
+
+0000000000801840 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801840:	55                   	push   %rbp
+  801841:	48 89 e5             	mov    %rsp,%rbp
+  801844:	41 57                	push   %r15
+  801846:	41 56                	push   %r14
+  801848:	41 55                	push   %r13
+  80184a:	41 54                	push   %r12
+  80184c:	53                   	push   %rbx
+  80184d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801854:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80185b:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  801862:	00 00 00 00 
+  801866:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  80186d:	00 00 00 00 
+  801871:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  801878:	00 00 00 00 
+  80187c:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  801883:	00 00 00 00 
+  801887:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  80188e:	00 00 00 00 
+  801892:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  801899:	00 00 00 00 
+  80189d:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8018a4:	00 
+  8018a5:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8018ac:	00 
+  8018ad:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8018b4:	00 
+  8018b5:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8018bc:	00 
+  8018bd:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8018c4:	00 
+  8018c5:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8018cc:	00 
+  8018cd:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8018d4:	00 
+  8018d5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8018dc:	00 
+  8018dd:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8018e4:	00 
+  8018e5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8018ec:	00 
+    for (res = 0; res < n; res += inc) {
+  8018ed:	48 85 d2             	test   %rdx,%rdx
+  8018f0:	74 7a                	je     80196c <devcons_write+0x12c>
+  8018f2:	49 89 d6             	mov    %rdx,%r14
+  8018f5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8018fb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801900:	49 bf 76 29 80 00 00 	movabs $0x802976,%r15
+  801907:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80190a:	4c 89 f3             	mov    %r14,%rbx
+  80190d:	48 29 f3             	sub    %rsi,%rbx
+  801910:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801915:	48 39 c3             	cmp    %rax,%rbx
+  801918:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80191c:	4c 63 eb             	movslq %ebx,%r13
+  80191f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801926:	48 01 c6             	add    %rax,%rsi
+  801929:	4c 89 ea             	mov    %r13,%rdx
+  80192c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801933:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801936:	4c 89 ee             	mov    %r13,%rsi
+  801939:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801940:	48 b8 a3 2b 80 00 00 	movabs $0x802ba3,%rax
+  801947:	00 00 00 
+  80194a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80194c:	41 01 dc             	add    %ebx,%r12d
+  80194f:	49 63 f4             	movslq %r12d,%rsi
+  801952:	4c 39 f6             	cmp    %r14,%rsi
+  801955:	72 b3                	jb     80190a <devcons_write+0xca>
+    return res;
+  801957:	49 63 c4             	movslq %r12d,%rax
+}
+  80195a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801961:	5b                   	pop    %rbx
+  801962:	41 5c                	pop    %r12
+  801964:	41 5d                	pop    %r13
+  801966:	41 5e                	pop    %r14
+  801968:	41 5f                	pop    %r15
+  80196a:	5d                   	pop    %rbp
+  80196b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80196c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801972:	eb e3                	jmp    801957 <devcons_write+0x117>
+
+0000000000801974 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801974:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197c:	48 85 c0             	test   %rax,%rax
+  80197f:	74 55                	je     8019d6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801981:	55                   	push   %rbp
+  801982:	48 89 e5             	mov    %rsp,%rbp
+  801985:	41 55                	push   %r13
+  801987:	41 54                	push   %r12
+  801989:	53                   	push   %rbx
+  80198a:	48 83 ec 08          	sub    $0x8,%rsp
+  80198e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801991:	48 bb d6 2b 80 00 00 	movabs $0x802bd6,%rbx
+  801998:	00 00 00 
+  80199b:	49 bc ea 2c 80 00 00 	movabs $0x802cea,%r12
+  8019a2:	00 00 00 
+  8019a5:	eb 03                	jmp    8019aa <devcons_read+0x36>
+  8019a7:	41 ff d4             	call   *%r12
+  8019aa:	ff d3                	call   *%rbx
+  8019ac:	85 c0                	test   %eax,%eax
+  8019ae:	74 f7                	je     8019a7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8019b0:	48 63 d0             	movslq %eax,%rdx
+  8019b3:	78 13                	js     8019c8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8019b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ba:	83 f8 04             	cmp    $0x4,%eax
+  8019bd:	74 09                	je     8019c8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8019bf:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8019c3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8019c8:	48 89 d0             	mov    %rdx,%rax
+  8019cb:	48 83 c4 08          	add    $0x8,%rsp
+  8019cf:	5b                   	pop    %rbx
+  8019d0:	41 5c                	pop    %r12
+  8019d2:	41 5d                	pop    %r13
+  8019d4:	5d                   	pop    %rbp
+  8019d5:	c3                   	ret
+  8019d6:	48 89 d0             	mov    %rdx,%rax
+  8019d9:	c3                   	ret
+
+00000000008019da <cputchar>:
+cputchar(int ch) {
+  8019da:	55                   	push   %rbp
+  8019db:	48 89 e5             	mov    %rsp,%rbp
+  8019de:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8019e2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8019e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8019eb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8019ef:	48 b8 a3 2b 80 00 00 	movabs $0x802ba3,%rax
+  8019f6:	00 00 00 
+  8019f9:	ff d0                	call   *%rax
+}
+  8019fb:	c9                   	leave
+  8019fc:	c3                   	ret
+
+00000000008019fd <getchar>:
+getchar(void) {
+  8019fd:	55                   	push   %rbp
+  8019fe:	48 89 e5             	mov    %rsp,%rbp
+  801a01:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801a05:	ba 01 00 00 00       	mov    $0x1,%edx
+  801a0a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a13:	48 b8 5a 37 80 00 00 	movabs $0x80375a,%rax
+  801a1a:	00 00 00 
+  801a1d:	ff d0                	call   *%rax
+  801a1f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	78 06                	js     801a2b <getchar+0x2e>
+  801a25:	74 08                	je     801a2f <getchar+0x32>
+  801a27:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801a2b:	89 d0                	mov    %edx,%eax
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801a2f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801a34:	eb f5                	jmp    801a2b <getchar+0x2e>
+
+0000000000801a36 <iscons>:
+iscons(int fdnum) {
+  801a36:	55                   	push   %rbp
+  801a37:	48 89 e5             	mov    %rsp,%rbp
+  801a3a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801a3e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a42:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  801a49:	00 00 00 
+  801a4c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	78 18                	js     801a6a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801a52:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a56:	48 b8 c0 97 80 00 00 	movabs $0x8097c0,%rax
+  801a5d:	00 00 00 
+  801a60:	8b 00                	mov    (%rax),%eax
+  801a62:	39 02                	cmp    %eax,(%rdx)
+  801a64:	0f 94 c0             	sete   %al
+  801a67:	0f b6 c0             	movzbl %al,%eax
+}
+  801a6a:	c9                   	leave
+  801a6b:	c3                   	ret
+
+0000000000801a6c <opencons>:
+opencons(void) {
+  801a6c:	55                   	push   %rbp
+  801a6d:	48 89 e5             	mov    %rsp,%rbp
+  801a70:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801a74:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801a78:	48 b8 17 34 80 00 00 	movabs $0x803417,%rax
+  801a7f:	00 00 00 
+  801a82:	ff d0                	call   *%rax
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 49                	js     801ad1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801a88:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801a8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a92:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801a96:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a9b:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  801aa2:	00 00 00 
+  801aa5:	ff d0                	call   *%rax
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	78 26                	js     801ad1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801aab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aaf:	a1 c0 97 80 00 00 00 	movabs 0x8097c0,%eax
+  801ab6:	00 00 
+  801ab8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801aba:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801abe:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801ac5:	48 b8 e9 33 80 00 00 	movabs $0x8033e9,%rax
+  801acc:	00 00 00 
+  801acf:	ff d0                	call   *%rax
+}
+  801ad1:	c9                   	leave
+  801ad2:	c3                   	ret
+
+0000000000801ad3 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801ad3:	55                   	push   %rbp
+  801ad4:	48 89 e5             	mov    %rsp,%rbp
+  801ad7:	41 56                	push   %r14
+  801ad9:	41 55                	push   %r13
+  801adb:	41 54                	push   %r12
+  801add:	53                   	push   %rbx
+  801ade:	41 89 fd             	mov    %edi,%r13d
+  801ae1:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801ae4:	48 ba 78 98 80 00 00 	movabs $0x809878,%rdx
+  801aeb:	00 00 00 
+  801aee:	48 b8 78 98 80 00 00 	movabs $0x809878,%rax
+  801af5:	00 00 00 
+  801af8:	48 39 c2             	cmp    %rax,%rdx
+  801afb:	73 17                	jae    801b14 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801afd:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801b00:	49 89 c4             	mov    %rax,%r12
+  801b03:	48 83 c3 08          	add    $0x8,%rbx
+  801b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0c:	ff 53 f8             	call   *-0x8(%rbx)
+  801b0f:	4c 39 e3             	cmp    %r12,%rbx
+  801b12:	72 ef                	jb     801b03 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801b14:	48 b8 b3 2c 80 00 00 	movabs $0x802cb3,%rax
+  801b1b:	00 00 00 
+  801b1e:	ff d0                	call   *%rax
+  801b20:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b25:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801b2c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b33:	00 00 00 
+  801b36:	48 01 d0             	add    %rdx,%rax
+  801b39:	48 a3 90 b7 80 01 00 	movabs %rax,0x180b790
+  801b40:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801b43:	45 85 ed             	test   %r13d,%r13d
+  801b46:	7e 0d                	jle    801b55 <libmain+0x82>
+  801b48:	49 8b 06             	mov    (%r14),%rax
+  801b4b:	48 a3 f8 97 80 00 00 	movabs %rax,0x8097f8
+  801b52:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801b55:	4c 89 f6             	mov    %r14,%rsi
+  801b58:	44 89 ef             	mov    %r13d,%edi
+  801b5b:	48 b8 2e 15 80 00 00 	movabs $0x80152e,%rax
+  801b62:	00 00 00 
+  801b65:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801b67:	48 b8 7c 1b 80 00 00 	movabs $0x801b7c,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+#endif
+}
+  801b73:	5b                   	pop    %rbx
+  801b74:	41 5c                	pop    %r12
+  801b76:	41 5d                	pop    %r13
+  801b78:	41 5e                	pop    %r14
+  801b7a:	5d                   	pop    %rbp
+  801b7b:	c3                   	ret
+
+0000000000801b7c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801b7c:	55                   	push   %rbp
+  801b7d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801b80:	48 b8 0f 36 80 00 00 	movabs $0x80360f,%rax
+  801b87:	00 00 00 
+  801b8a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b91:	48 b8 42 2c 80 00 00 	movabs $0x802c42,%rax
+  801b98:	00 00 00 
+  801b9b:	ff d0                	call   *%rax
+}
+  801b9d:	5d                   	pop    %rbp
+  801b9e:	c3                   	ret
+
+0000000000801b9f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801b9f:	55                   	push   %rbp
+  801ba0:	48 89 e5             	mov    %rsp,%rbp
+  801ba3:	41 56                	push   %r14
+  801ba5:	41 55                	push   %r13
+  801ba7:	41 54                	push   %r12
+  801ba9:	53                   	push   %rbx
+  801baa:	48 83 ec 50          	sub    $0x50,%rsp
+  801bae:	49 89 fc             	mov    %rdi,%r12
+  801bb1:	41 89 f5             	mov    %esi,%r13d
+  801bb4:	48 89 d3             	mov    %rdx,%rbx
+  801bb7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801bbb:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801bbf:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801bc3:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801bca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801bce:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801bd2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801bd6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801bda:	48 b8 f8 97 80 00 00 	movabs $0x8097f8,%rax
+  801be1:	00 00 00 
+  801be4:	4c 8b 30             	mov    (%rax),%r14
+  801be7:	48 b8 b3 2c 80 00 00 	movabs $0x802cb3,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+  801bf3:	89 c6                	mov    %eax,%esi
+  801bf5:	45 89 e8             	mov    %r13d,%r8d
+  801bf8:	4c 89 e1             	mov    %r12,%rcx
+  801bfb:	4c 89 f2             	mov    %r14,%rdx
+  801bfe:	48 bf f8 69 80 00 00 	movabs $0x8069f8,%rdi
+  801c05:	00 00 00 
+  801c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0d:	49 bc ef 1c 80 00 00 	movabs $0x801cef,%r12
+  801c14:	00 00 00 
+  801c17:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801c1a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801c1e:	48 89 df             	mov    %rbx,%rdi
+  801c21:	48 b8 8b 1c 80 00 00 	movabs $0x801c8b,%rax
+  801c28:	00 00 00 
+  801c2b:	ff d0                	call   *%rax
+    cprintf("\n");
+  801c2d:	48 bf d3 6f 80 00 00 	movabs $0x806fd3,%rdi
+  801c34:	00 00 00 
+  801c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3c:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801c3f:	cc                   	int3
+  801c40:	eb fd                	jmp    801c3f <_panic+0xa0>
+
+0000000000801c42 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801c42:	55                   	push   %rbp
+  801c43:	48 89 e5             	mov    %rsp,%rbp
+  801c46:	53                   	push   %rbx
+  801c47:	48 83 ec 08          	sub    $0x8,%rsp
+  801c4b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801c4e:	8b 06                	mov    (%rsi),%eax
+  801c50:	8d 50 01             	lea    0x1(%rax),%edx
+  801c53:	89 16                	mov    %edx,(%rsi)
+  801c55:	48 98                	cltq
+  801c57:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801c5c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801c62:	74 0a                	je     801c6e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801c64:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801c68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801c6e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801c72:	be ff 00 00 00       	mov    $0xff,%esi
+  801c77:	48 b8 a3 2b 80 00 00 	movabs $0x802ba3,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+        state->offset = 0;
+  801c83:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801c89:	eb d9                	jmp    801c64 <putch+0x22>
+
+0000000000801c8b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801c8b:	55                   	push   %rbp
+  801c8c:	48 89 e5             	mov    %rsp,%rbp
+  801c8f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801c96:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801c99:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801ca0:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801cad:	48 89 f1             	mov    %rsi,%rcx
+  801cb0:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801cb7:	48 bf 42 1c 80 00 00 	movabs $0x801c42,%rdi
+  801cbe:	00 00 00 
+  801cc1:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  801cc8:	00 00 00 
+  801ccb:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801ccd:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801cd4:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801cdb:	48 b8 a3 2b 80 00 00 	movabs $0x802ba3,%rax
+  801ce2:	00 00 00 
+  801ce5:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801ce7:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801ced:	c9                   	leave
+  801cee:	c3                   	ret
+
+0000000000801cef <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801cef:	55                   	push   %rbp
+  801cf0:	48 89 e5             	mov    %rsp,%rbp
+  801cf3:	48 83 ec 50          	sub    $0x50,%rsp
+  801cf7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801cfb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801cff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d03:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d07:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d0b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d12:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d1a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d1e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801d22:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801d26:	48 b8 8b 1c 80 00 00 	movabs $0x801c8b,%rax
+  801d2d:	00 00 00 
+  801d30:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801d32:	c9                   	leave
+  801d33:	c3                   	ret
+
+0000000000801d34 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801d34:	55                   	push   %rbp
+  801d35:	48 89 e5             	mov    %rsp,%rbp
+  801d38:	41 57                	push   %r15
+  801d3a:	41 56                	push   %r14
+  801d3c:	41 55                	push   %r13
+  801d3e:	41 54                	push   %r12
+  801d40:	53                   	push   %rbx
+  801d41:	48 83 ec 18          	sub    $0x18,%rsp
+  801d45:	49 89 fc             	mov    %rdi,%r12
+  801d48:	49 89 f5             	mov    %rsi,%r13
+  801d4b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d4f:	8b 45 10             	mov    0x10(%rbp),%eax
+  801d52:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801d55:	41 89 cf             	mov    %ecx,%r15d
+  801d58:	4c 39 fa             	cmp    %r15,%rdx
+  801d5b:	73 5b                	jae    801db8 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801d5d:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801d61:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801d65:	85 db                	test   %ebx,%ebx
+  801d67:	7e 0e                	jle    801d77 <print_num+0x43>
+            putch(padc, put_arg);
+  801d69:	4c 89 ee             	mov    %r13,%rsi
+  801d6c:	44 89 f7             	mov    %r14d,%edi
+  801d6f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801d72:	83 eb 01             	sub    $0x1,%ebx
+  801d75:	75 f2                	jne    801d69 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801d77:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801d7b:	48 b9 2c 6a 80 00 00 	movabs $0x806a2c,%rcx
+  801d82:	00 00 00 
+  801d85:	48 b8 1b 6a 80 00 00 	movabs $0x806a1b,%rax
+  801d8c:	00 00 00 
+  801d8f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801d93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9c:	49 f7 f7             	div    %r15
+  801d9f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801da3:	4c 89 ee             	mov    %r13,%rsi
+  801da6:	41 ff d4             	call   *%r12
+}
+  801da9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801dad:	5b                   	pop    %rbx
+  801dae:	41 5c                	pop    %r12
+  801db0:	41 5d                	pop    %r13
+  801db2:	41 5e                	pop    %r14
+  801db4:	41 5f                	pop    %r15
+  801db6:	5d                   	pop    %rbp
+  801db7:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801db8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc1:	49 f7 f7             	div    %r15
+  801dc4:	48 83 ec 08          	sub    $0x8,%rsp
+  801dc8:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801dcc:	52                   	push   %rdx
+  801dcd:	45 0f be c9          	movsbl %r9b,%r9d
+  801dd1:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801dd5:	48 89 c2             	mov    %rax,%rdx
+  801dd8:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  801ddf:	00 00 00 
+  801de2:	ff d0                	call   *%rax
+  801de4:	48 83 c4 10          	add    $0x10,%rsp
+  801de8:	eb 8d                	jmp    801d77 <print_num+0x43>
+
+0000000000801dea <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801dea:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801dee:	48 8b 06             	mov    (%rsi),%rax
+  801df1:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801df5:	73 0a                	jae    801e01 <sprintputch+0x17>
+        *state->start++ = ch;
+  801df7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801dfb:	48 89 16             	mov    %rdx,(%rsi)
+  801dfe:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e01:	c3                   	ret
+
+0000000000801e02 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e02:	55                   	push   %rbp
+  801e03:	48 89 e5             	mov    %rsp,%rbp
+  801e06:	48 83 ec 50          	sub    $0x50,%rsp
+  801e0a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e0e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e12:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e16:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801e1d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e25:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801e29:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801e2d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801e31:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  801e38:	00 00 00 
+  801e3b:	ff d0                	call   *%rax
+}
+  801e3d:	c9                   	leave
+  801e3e:	c3                   	ret
+
+0000000000801e3f <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801e3f:	55                   	push   %rbp
+  801e40:	48 89 e5             	mov    %rsp,%rbp
+  801e43:	41 57                	push   %r15
+  801e45:	41 56                	push   %r14
+  801e47:	41 55                	push   %r13
+  801e49:	41 54                	push   %r12
+  801e4b:	53                   	push   %rbx
+  801e4c:	48 83 ec 38          	sub    $0x38,%rsp
+  801e50:	49 89 fe             	mov    %rdi,%r14
+  801e53:	49 89 f5             	mov    %rsi,%r13
+  801e56:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801e59:	48 8b 01             	mov    (%rcx),%rax
+  801e5c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801e60:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801e64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e68:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801e6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801e70:	eb 0d                	jmp    801e7f <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801e72:	40 0f b6 ff          	movzbl %dil,%edi
+  801e76:	4c 89 ee             	mov    %r13,%rsi
+  801e79:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801e7c:	4c 89 e3             	mov    %r12,%rbx
+  801e7f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801e83:	0f b6 3b             	movzbl (%rbx),%edi
+  801e86:	40 80 ff 25          	cmp    $0x25,%dil
+  801e8a:	74 14                	je     801ea0 <vprintfmt+0x61>
+            if (!ch) return;
+  801e8c:	40 84 ff             	test   %dil,%dil
+  801e8f:	75 e1                	jne    801e72 <vprintfmt+0x33>
+}
+  801e91:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e95:	5b                   	pop    %rbx
+  801e96:	41 5c                	pop    %r12
+  801e98:	41 5d                	pop    %r13
+  801e9a:	41 5e                	pop    %r14
+  801e9c:	41 5f                	pop    %r15
+  801e9e:	5d                   	pop    %rbp
+  801e9f:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801ea0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ea5:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801ea9:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801eae:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801eb4:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801ebb:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801ebf:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801ec4:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801ec9:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801ecc:	83 e8 23             	sub    $0x23,%eax
+  801ecf:	3c 57                	cmp    $0x57,%al
+  801ed1:	0f 87 67 06 00 00    	ja     80253e <vprintfmt+0x6ff>
+  801ed7:	0f b6 c0             	movzbl %al,%eax
+  801eda:	48 b9 c0 6b 80 00 00 	movabs $0x806bc0,%rcx
+  801ee1:	00 00 00 
+  801ee4:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801ee7:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801eea:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801eee:	eb cf                	jmp    801ebf <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801ef0:	49 89 dc             	mov    %rbx,%r12
+  801ef3:	be 01 00 00 00       	mov    $0x1,%esi
+  801ef8:	eb c5                	jmp    801ebf <vprintfmt+0x80>
+            padc = ch;
+  801efa:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801efe:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f01:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f04:	eb b9                	jmp    801ebf <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801f06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f09:	83 f8 2f             	cmp    $0x2f,%eax
+  801f0c:	77 24                	ja     801f32 <vprintfmt+0xf3>
+  801f0e:	89 c1                	mov    %eax,%ecx
+  801f10:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f14:	83 c0 08             	add    $0x8,%eax
+  801f17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f1a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f1d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f20:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f24:	79 99                	jns    801ebf <vprintfmt+0x80>
+                width = precision;
+  801f26:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801f2a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f30:	eb 8d                	jmp    801ebf <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801f32:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f36:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801f3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f3e:	eb da                	jmp    801f1a <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801f40:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801f45:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801f49:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801f4f:	3c 39                	cmp    $0x39,%al
+  801f51:	77 1c                	ja     801f6f <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801f53:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801f57:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801f5b:	0f b6 c0             	movzbl %al,%eax
+  801f5e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801f63:	0f b6 03             	movzbl (%rbx),%eax
+  801f66:	3c 39                	cmp    $0x39,%al
+  801f68:	76 e9                	jbe    801f53 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801f6a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801f6d:	eb b1                	jmp    801f20 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801f6f:	49 89 dc             	mov    %rbx,%r12
+  801f72:	eb ac                	jmp    801f20 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801f74:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801f77:	85 c9                	test   %ecx,%ecx
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7e:	0f 49 c1             	cmovns %ecx,%eax
+  801f81:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801f84:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f87:	e9 33 ff ff ff       	jmp    801ebf <vprintfmt+0x80>
+            lflag++;
+  801f8c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801f8f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f92:	e9 28 ff ff ff       	jmp    801ebf <vprintfmt+0x80>
+            lflag--;
+  801f97:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801f9a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f9d:	e9 1d ff ff ff       	jmp    801ebf <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801fa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fa5:	83 f8 2f             	cmp    $0x2f,%eax
+  801fa8:	77 19                	ja     801fc3 <vprintfmt+0x184>
+  801faa:	89 c2                	mov    %eax,%edx
+  801fac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb0:	83 c0 08             	add    $0x8,%eax
+  801fb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fb6:	8b 3a                	mov    (%rdx),%edi
+  801fb8:	4c 89 ee             	mov    %r13,%rsi
+  801fbb:	41 ff d6             	call   *%r14
+            break;
+  801fbe:	e9 bc fe ff ff       	jmp    801e7f <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801fc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fcb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fcf:	eb e5                	jmp    801fb6 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801fd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fd4:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd7:	77 5a                	ja     802033 <vprintfmt+0x1f4>
+  801fd9:	89 c2                	mov    %eax,%edx
+  801fdb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fdf:	83 c0 08             	add    $0x8,%eax
+  801fe2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801fe5:	8b 02                	mov    (%rdx),%eax
+  801fe7:	89 c1                	mov    %eax,%ecx
+  801fe9:	f7 d9                	neg    %ecx
+  801feb:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801fee:	83 f9 13             	cmp    $0x13,%ecx
+  801ff1:	7f 4e                	jg     802041 <vprintfmt+0x202>
+  801ff3:	48 63 c1             	movslq %ecx,%rax
+  801ff6:	48 ba 80 6e 80 00 00 	movabs $0x806e80,%rdx
+  801ffd:	00 00 00 
+  802000:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802004:	48 85 c0             	test   %rax,%rax
+  802007:	74 38                	je     802041 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  802009:	48 89 c1             	mov    %rax,%rcx
+  80200c:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  802013:	00 00 00 
+  802016:	4c 89 ee             	mov    %r13,%rsi
+  802019:	4c 89 f7             	mov    %r14,%rdi
+  80201c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802021:	49 b8 02 1e 80 00 00 	movabs $0x801e02,%r8
+  802028:	00 00 00 
+  80202b:	41 ff d0             	call   *%r8
+  80202e:	e9 4c fe ff ff       	jmp    801e7f <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  802033:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80203b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80203f:	eb a4                	jmp    801fe5 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  802041:	48 ba 44 6a 80 00 00 	movabs $0x806a44,%rdx
+  802048:	00 00 00 
+  80204b:	4c 89 ee             	mov    %r13,%rsi
+  80204e:	4c 89 f7             	mov    %r14,%rdi
+  802051:	b8 00 00 00 00       	mov    $0x0,%eax
+  802056:	49 b8 02 1e 80 00 00 	movabs $0x801e02,%r8
+  80205d:	00 00 00 
+  802060:	41 ff d0             	call   *%r8
+  802063:	e9 17 fe ff ff       	jmp    801e7f <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  802068:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80206b:	83 f8 2f             	cmp    $0x2f,%eax
+  80206e:	77 6c                	ja     8020dc <vprintfmt+0x29d>
+  802070:	89 c2                	mov    %eax,%edx
+  802072:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802076:	83 c0 08             	add    $0x8,%eax
+  802079:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80207c:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80207f:	48 85 f6             	test   %rsi,%rsi
+  802082:	48 b8 3d 6a 80 00 00 	movabs $0x806a3d,%rax
+  802089:	00 00 00 
+  80208c:	48 0f 45 c6          	cmovne %rsi,%rax
+  802090:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802094:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802098:	7e 06                	jle    8020a0 <vprintfmt+0x261>
+  80209a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80209e:	75 4a                	jne    8020ea <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8020a0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020a4:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8020a8:	0f b6 00             	movzbl (%rax),%eax
+  8020ab:	84 c0                	test   %al,%al
+  8020ad:	0f 85 9a 00 00 00    	jne    80214d <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  8020b3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8020b6:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8020ba:	85 c0                	test   %eax,%eax
+  8020bc:	0f 8e bd fd ff ff    	jle    801e7f <vprintfmt+0x40>
+  8020c2:	4c 89 ee             	mov    %r13,%rsi
+  8020c5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8020ca:	41 ff d6             	call   *%r14
+  8020cd:	41 83 ec 01          	sub    $0x1,%r12d
+  8020d1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8020d5:	75 eb                	jne    8020c2 <vprintfmt+0x283>
+  8020d7:	e9 a3 fd ff ff       	jmp    801e7f <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8020dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e8:	eb 92                	jmp    80207c <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  8020ea:	49 63 f7             	movslq %r15d,%rsi
+  8020ed:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8020f1:	48 b8 03 26 80 00 00 	movabs $0x802603,%rax
+  8020f8:	00 00 00 
+  8020fb:	ff d0                	call   *%rax
+  8020fd:	48 89 c2             	mov    %rax,%rdx
+  802100:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802103:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802105:	8d 50 ff             	lea    -0x1(%rax),%edx
+  802108:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	7e 91                	jle    8020a0 <vprintfmt+0x261>
+  80210f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802114:	4c 89 ee             	mov    %r13,%rsi
+  802117:	44 89 e7             	mov    %r12d,%edi
+  80211a:	41 ff d6             	call   *%r14
+  80211d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802121:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802124:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802127:	75 eb                	jne    802114 <vprintfmt+0x2d5>
+  802129:	e9 72 ff ff ff       	jmp    8020a0 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80212e:	0f b6 f8             	movzbl %al,%edi
+  802131:	4c 89 ee             	mov    %r13,%rsi
+  802134:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802137:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80213b:	49 83 c4 01          	add    $0x1,%r12
+  80213f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802145:	84 c0                	test   %al,%al
+  802147:	0f 84 66 ff ff ff    	je     8020b3 <vprintfmt+0x274>
+  80214d:	45 85 ff             	test   %r15d,%r15d
+  802150:	78 0a                	js     80215c <vprintfmt+0x31d>
+  802152:	41 83 ef 01          	sub    $0x1,%r15d
+  802156:	0f 88 57 ff ff ff    	js     8020b3 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80215c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802160:	74 cc                	je     80212e <vprintfmt+0x2ef>
+  802162:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802165:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80216a:	80 fa 5e             	cmp    $0x5e,%dl
+  80216d:	77 c2                	ja     802131 <vprintfmt+0x2f2>
+  80216f:	eb bd                	jmp    80212e <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  802171:	40 84 f6             	test   %sil,%sil
+  802174:	75 26                	jne    80219c <vprintfmt+0x35d>
+    switch (lflag) {
+  802176:	85 d2                	test   %edx,%edx
+  802178:	74 59                	je     8021d3 <vprintfmt+0x394>
+  80217a:	83 fa 01             	cmp    $0x1,%edx
+  80217d:	74 7b                	je     8021fa <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  80217f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802182:	83 f8 2f             	cmp    $0x2f,%eax
+  802185:	0f 87 96 00 00 00    	ja     802221 <vprintfmt+0x3e2>
+  80218b:	89 c2                	mov    %eax,%edx
+  80218d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802191:	83 c0 08             	add    $0x8,%eax
+  802194:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802197:	4c 8b 22             	mov    (%rdx),%r12
+  80219a:	eb 17                	jmp    8021b3 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  80219c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80219f:	83 f8 2f             	cmp    $0x2f,%eax
+  8021a2:	77 21                	ja     8021c5 <vprintfmt+0x386>
+  8021a4:	89 c2                	mov    %eax,%edx
+  8021a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021aa:	83 c0 08             	add    $0x8,%eax
+  8021ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021b0:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8021b3:	4d 85 e4             	test   %r12,%r12
+  8021b6:	78 7a                	js     802232 <vprintfmt+0x3f3>
+            num = i;
+  8021b8:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8021bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8021c0:	e9 56 02 00 00       	jmp    80241b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8021c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021d1:	eb dd                	jmp    8021b0 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  8021d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8021d9:	77 11                	ja     8021ec <vprintfmt+0x3ad>
+  8021db:	89 c2                	mov    %eax,%edx
+  8021dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e1:	83 c0 08             	add    $0x8,%eax
+  8021e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021e7:	4c 63 22             	movslq (%rdx),%r12
+  8021ea:	eb c7                	jmp    8021b3 <vprintfmt+0x374>
+  8021ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021f8:	eb ed                	jmp    8021e7 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  8021fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021fd:	83 f8 2f             	cmp    $0x2f,%eax
+  802200:	77 11                	ja     802213 <vprintfmt+0x3d4>
+  802202:	89 c2                	mov    %eax,%edx
+  802204:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802208:	83 c0 08             	add    $0x8,%eax
+  80220b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80220e:	4c 8b 22             	mov    (%rdx),%r12
+  802211:	eb a0                	jmp    8021b3 <vprintfmt+0x374>
+  802213:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802217:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80221b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80221f:	eb ed                	jmp    80220e <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  802221:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802225:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802229:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80222d:	e9 65 ff ff ff       	jmp    802197 <vprintfmt+0x358>
+                putch('-', put_arg);
+  802232:	4c 89 ee             	mov    %r13,%rsi
+  802235:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80223a:	41 ff d6             	call   *%r14
+                i = -i;
+  80223d:	49 f7 dc             	neg    %r12
+  802240:	e9 73 ff ff ff       	jmp    8021b8 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  802245:	40 84 f6             	test   %sil,%sil
+  802248:	75 2e                	jne    802278 <vprintfmt+0x439>
+    switch (lflag) {
+  80224a:	85 d2                	test   %edx,%edx
+  80224c:	7f 59                	jg     8022a7 <vprintfmt+0x468>
+  80224e:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802251:	7d 7a                	jge    8022cd <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802253:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802256:	83 f8 2f             	cmp    $0x2f,%eax
+  802259:	0f 87 aa 00 00 00    	ja     802309 <vprintfmt+0x4ca>
+  80225f:	89 c2                	mov    %eax,%edx
+  802261:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802265:	83 c0 08             	add    $0x8,%eax
+  802268:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80226b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80226e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802273:	e9 a3 01 00 00       	jmp    80241b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802278:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80227b:	83 f8 2f             	cmp    $0x2f,%eax
+  80227e:	77 19                	ja     802299 <vprintfmt+0x45a>
+  802280:	89 c2                	mov    %eax,%edx
+  802282:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802286:	83 c0 08             	add    $0x8,%eax
+  802289:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80228c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80228f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802294:	e9 82 01 00 00       	jmp    80241b <vprintfmt+0x5dc>
+  802299:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80229d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022a5:	eb e5                	jmp    80228c <vprintfmt+0x44d>
+    switch (lflag) {
+  8022a7:	83 fa 01             	cmp    $0x1,%edx
+  8022aa:	75 a7                	jne    802253 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  8022ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022af:	83 f8 2f             	cmp    $0x2f,%eax
+  8022b2:	77 47                	ja     8022fb <vprintfmt+0x4bc>
+  8022b4:	89 c2                	mov    %eax,%edx
+  8022b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ba:	83 c0 08             	add    $0x8,%eax
+  8022bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8022c8:	e9 4e 01 00 00       	jmp    80241b <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8022cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8022d3:	77 18                	ja     8022ed <vprintfmt+0x4ae>
+  8022d5:	89 c2                	mov    %eax,%edx
+  8022d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022db:	83 c0 08             	add    $0x8,%eax
+  8022de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8022e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8022e8:	e9 2e 01 00 00       	jmp    80241b <vprintfmt+0x5dc>
+  8022ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022f9:	eb e6                	jmp    8022e1 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  8022fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802303:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802307:	eb b7                	jmp    8022c0 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802309:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80230d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802311:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802315:	e9 51 ff ff ff       	jmp    80226b <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  80231a:	40 84 f6             	test   %sil,%sil
+  80231d:	75 2e                	jne    80234d <vprintfmt+0x50e>
+    switch (lflag) {
+  80231f:	85 d2                	test   %edx,%edx
+  802321:	7f 59                	jg     80237c <vprintfmt+0x53d>
+  802323:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802326:	7d 77                	jge    80239f <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802328:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80232b:	83 f8 2f             	cmp    $0x2f,%eax
+  80232e:	0f 87 a4 00 00 00    	ja     8023d8 <vprintfmt+0x599>
+  802334:	89 c2                	mov    %eax,%edx
+  802336:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80233a:	83 c0 08             	add    $0x8,%eax
+  80233d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802340:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802343:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802348:	e9 ce 00 00 00       	jmp    80241b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80234d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802350:	83 f8 2f             	cmp    $0x2f,%eax
+  802353:	77 19                	ja     80236e <vprintfmt+0x52f>
+  802355:	89 c2                	mov    %eax,%edx
+  802357:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80235b:	83 c0 08             	add    $0x8,%eax
+  80235e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802361:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802364:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802369:	e9 ad 00 00 00       	jmp    80241b <vprintfmt+0x5dc>
+  80236e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802372:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802376:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80237a:	eb e5                	jmp    802361 <vprintfmt+0x522>
+    switch (lflag) {
+  80237c:	83 fa 01             	cmp    $0x1,%edx
+  80237f:	75 a7                	jne    802328 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802381:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802384:	83 f8 2f             	cmp    $0x2f,%eax
+  802387:	77 41                	ja     8023ca <vprintfmt+0x58b>
+  802389:	89 c2                	mov    %eax,%edx
+  80238b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80238f:	83 c0 08             	add    $0x8,%eax
+  802392:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802395:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802398:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80239d:	eb 7c                	jmp    80241b <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80239f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a5:	77 15                	ja     8023bc <vprintfmt+0x57d>
+  8023a7:	89 c2                	mov    %eax,%edx
+  8023a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ad:	83 c0 08             	add    $0x8,%eax
+  8023b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8023b5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8023ba:	eb 5f                	jmp    80241b <vprintfmt+0x5dc>
+  8023bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023c8:	eb e9                	jmp    8023b3 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  8023ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023d6:	eb bd                	jmp    802395 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  8023d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023e4:	e9 57 ff ff ff       	jmp    802340 <vprintfmt+0x501>
+            putch('0', put_arg);
+  8023e9:	4c 89 ee             	mov    %r13,%rsi
+  8023ec:	bf 30 00 00 00       	mov    $0x30,%edi
+  8023f1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8023f4:	4c 89 ee             	mov    %r13,%rsi
+  8023f7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8023fc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8023ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802402:	83 f8 2f             	cmp    $0x2f,%eax
+  802405:	77 47                	ja     80244e <vprintfmt+0x60f>
+  802407:	89 c2                	mov    %eax,%edx
+  802409:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80240d:	83 c0 08             	add    $0x8,%eax
+  802410:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802413:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802416:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80241b:	48 83 ec 08          	sub    $0x8,%rsp
+  80241f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802423:	0f 94 c0             	sete   %al
+  802426:	0f b6 c0             	movzbl %al,%eax
+  802429:	50                   	push   %rax
+  80242a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80242f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802433:	4c 89 ee             	mov    %r13,%rsi
+  802436:	4c 89 f7             	mov    %r14,%rdi
+  802439:	48 b8 34 1d 80 00 00 	movabs $0x801d34,%rax
+  802440:	00 00 00 
+  802443:	ff d0                	call   *%rax
+            break;
+  802445:	48 83 c4 10          	add    $0x10,%rsp
+  802449:	e9 31 fa ff ff       	jmp    801e7f <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80244e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802452:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802456:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80245a:	eb b7                	jmp    802413 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80245c:	40 84 f6             	test   %sil,%sil
+  80245f:	75 2b                	jne    80248c <vprintfmt+0x64d>
+    switch (lflag) {
+  802461:	85 d2                	test   %edx,%edx
+  802463:	7f 56                	jg     8024bb <vprintfmt+0x67c>
+  802465:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802468:	7d 77                	jge    8024e1 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80246a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80246d:	83 f8 2f             	cmp    $0x2f,%eax
+  802470:	0f 87 a7 00 00 00    	ja     80251d <vprintfmt+0x6de>
+  802476:	89 c2                	mov    %eax,%edx
+  802478:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80247c:	83 c0 08             	add    $0x8,%eax
+  80247f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802482:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802485:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80248a:	eb 8f                	jmp    80241b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80248c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80248f:	83 f8 2f             	cmp    $0x2f,%eax
+  802492:	77 19                	ja     8024ad <vprintfmt+0x66e>
+  802494:	89 c2                	mov    %eax,%edx
+  802496:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80249a:	83 c0 08             	add    $0x8,%eax
+  80249d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024a0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024a3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8024a8:	e9 6e ff ff ff       	jmp    80241b <vprintfmt+0x5dc>
+  8024ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024b9:	eb e5                	jmp    8024a0 <vprintfmt+0x661>
+    switch (lflag) {
+  8024bb:	83 fa 01             	cmp    $0x1,%edx
+  8024be:	75 aa                	jne    80246a <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8024c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8024c6:	77 47                	ja     80250f <vprintfmt+0x6d0>
+  8024c8:	89 c2                	mov    %eax,%edx
+  8024ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024ce:	83 c0 08             	add    $0x8,%eax
+  8024d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024d4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024d7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8024dc:	e9 3a ff ff ff       	jmp    80241b <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8024e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8024e7:	77 18                	ja     802501 <vprintfmt+0x6c2>
+  8024e9:	89 c2                	mov    %eax,%edx
+  8024eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024ef:	83 c0 08             	add    $0x8,%eax
+  8024f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024f5:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8024f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8024fc:	e9 1a ff ff ff       	jmp    80241b <vprintfmt+0x5dc>
+  802501:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802505:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802509:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80250d:	eb e6                	jmp    8024f5 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80250f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802513:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802517:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80251b:	eb b7                	jmp    8024d4 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80251d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802521:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802525:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802529:	e9 54 ff ff ff       	jmp    802482 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  80252e:	4c 89 ee             	mov    %r13,%rsi
+  802531:	bf 25 00 00 00       	mov    $0x25,%edi
+  802536:	41 ff d6             	call   *%r14
+            break;
+  802539:	e9 41 f9 ff ff       	jmp    801e7f <vprintfmt+0x40>
+            putch('%', put_arg);
+  80253e:	4c 89 ee             	mov    %r13,%rsi
+  802541:	bf 25 00 00 00       	mov    $0x25,%edi
+  802546:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802549:	48 83 eb 01          	sub    $0x1,%rbx
+  80254d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802551:	75 f6                	jne    802549 <vprintfmt+0x70a>
+  802553:	e9 27 f9 ff ff       	jmp    801e7f <vprintfmt+0x40>
+
+0000000000802558 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802558:	55                   	push   %rbp
+  802559:	48 89 e5             	mov    %rsp,%rbp
+  80255c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802560:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802564:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802569:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80256d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802574:	48 85 ff             	test   %rdi,%rdi
+  802577:	74 2b                	je     8025a4 <vsnprintf+0x4c>
+  802579:	48 85 f6             	test   %rsi,%rsi
+  80257c:	74 26                	je     8025a4 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80257e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802582:	48 bf ea 1d 80 00 00 	movabs $0x801dea,%rdi
+  802589:	00 00 00 
+  80258c:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  802593:	00 00 00 
+  802596:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802598:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80259c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80259f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8025a2:	c9                   	leave
+  8025a3:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8025a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025a9:	eb f7                	jmp    8025a2 <vsnprintf+0x4a>
+
+00000000008025ab <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8025ab:	55                   	push   %rbp
+  8025ac:	48 89 e5             	mov    %rsp,%rbp
+  8025af:	48 83 ec 50          	sub    $0x50,%rsp
+  8025b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8025b7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8025bb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8025bf:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8025c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8025ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025ce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8025d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8025d6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8025da:	48 b8 58 25 80 00 00 	movabs $0x802558,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8025e6:	c9                   	leave
+  8025e7:	c3                   	ret
+
+00000000008025e8 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8025e8:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8025eb:	74 10                	je     8025fd <strlen+0x15>
+    size_t n = 0;
+  8025ed:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8025f2:	48 83 c0 01          	add    $0x1,%rax
+  8025f6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8025fa:	75 f6                	jne    8025f2 <strlen+0xa>
+  8025fc:	c3                   	ret
+    size_t n = 0;
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802602:	c3                   	ret
+
+0000000000802603 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802603:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802606:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80260b:	48 85 f6             	test   %rsi,%rsi
+  80260e:	74 11                	je     802621 <strnlen+0x1e>
+  802610:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802614:	74 0c                	je     802622 <strnlen+0x1f>
+  802616:	48 83 c2 01          	add    $0x1,%rdx
+  80261a:	48 39 d0             	cmp    %rdx,%rax
+  80261d:	75 f1                	jne    802610 <strnlen+0xd>
+  80261f:	eb 04                	jmp    802625 <strnlen+0x22>
+  802621:	c3                   	ret
+  802622:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802625:	c3                   	ret
+
+0000000000802626 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802626:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802629:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802632:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802635:	48 83 c2 01          	add    $0x1,%rdx
+  802639:	84 c9                	test   %cl,%cl
+  80263b:	75 f1                	jne    80262e <strcpy+0x8>
+        ;
+    return res;
+}
+  80263d:	c3                   	ret
+
+000000000080263e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80263e:	55                   	push   %rbp
+  80263f:	48 89 e5             	mov    %rsp,%rbp
+  802642:	41 54                	push   %r12
+  802644:	53                   	push   %rbx
+  802645:	48 89 fb             	mov    %rdi,%rbx
+  802648:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80264b:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  802652:	00 00 00 
+  802655:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802657:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80265b:	4c 89 e6             	mov    %r12,%rsi
+  80265e:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  802665:	00 00 00 
+  802668:	ff d0                	call   *%rax
+    return dst;
+}
+  80266a:	48 89 d8             	mov    %rbx,%rax
+  80266d:	5b                   	pop    %rbx
+  80266e:	41 5c                	pop    %r12
+  802670:	5d                   	pop    %rbp
+  802671:	c3                   	ret
+
+0000000000802672 <toupper>:
+
+int
+toupper(int ch) {
+  802672:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802674:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802677:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80267a:	83 f9 1a             	cmp    $0x1a,%ecx
+  80267d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802680:	c3                   	ret
+
+0000000000802681 <tolower>:
+
+int
+tolower(int ch) {
+  802681:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802683:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802686:	8d 57 20             	lea    0x20(%rdi),%edx
+  802689:	83 f9 1a             	cmp    $0x1a,%ecx
+  80268c:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80268f:	c3                   	ret
+
+0000000000802690 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802690:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802693:	48 85 d2             	test   %rdx,%rdx
+  802696:	74 1f                	je     8026b7 <strncpy+0x27>
+  802698:	48 01 fa             	add    %rdi,%rdx
+  80269b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80269e:	48 83 c1 01          	add    $0x1,%rcx
+  8026a2:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026a6:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8026aa:	41 80 f8 01          	cmp    $0x1,%r8b
+  8026ae:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8026b2:	48 39 ca             	cmp    %rcx,%rdx
+  8026b5:	75 e7                	jne    80269e <strncpy+0xe>
+    }
+    return ret;
+}
+  8026b7:	c3                   	ret
+
+00000000008026b8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8026b8:	48 89 f8             	mov    %rdi,%rax
+  8026bb:	48 85 d2             	test   %rdx,%rdx
+  8026be:	74 24                	je     8026e4 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8026c0:	48 83 ea 01          	sub    $0x1,%rdx
+  8026c4:	74 1b                	je     8026e1 <strlcpy+0x29>
+  8026c6:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8026ca:	0f b6 16             	movzbl (%rsi),%edx
+  8026cd:	84 d2                	test   %dl,%dl
+  8026cf:	74 10                	je     8026e1 <strlcpy+0x29>
+            *dst++ = *src++;
+  8026d1:	48 83 c6 01          	add    $0x1,%rsi
+  8026d5:	48 83 c0 01          	add    $0x1,%rax
+  8026d9:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8026dc:	48 39 c8             	cmp    %rcx,%rax
+  8026df:	75 e9                	jne    8026ca <strlcpy+0x12>
+        *dst = '\0';
+  8026e1:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8026e4:	48 29 f8             	sub    %rdi,%rax
+}
+  8026e7:	c3                   	ret
+
+00000000008026e8 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8026e8:	0f b6 07             	movzbl (%rdi),%eax
+  8026eb:	84 c0                	test   %al,%al
+  8026ed:	74 13                	je     802702 <strcmp+0x1a>
+  8026ef:	38 06                	cmp    %al,(%rsi)
+  8026f1:	75 0f                	jne    802702 <strcmp+0x1a>
+  8026f3:	48 83 c7 01          	add    $0x1,%rdi
+  8026f7:	48 83 c6 01          	add    $0x1,%rsi
+  8026fb:	0f b6 07             	movzbl (%rdi),%eax
+  8026fe:	84 c0                	test   %al,%al
+  802700:	75 ed                	jne    8026ef <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802702:	0f b6 c0             	movzbl %al,%eax
+  802705:	0f b6 16             	movzbl (%rsi),%edx
+  802708:	29 d0                	sub    %edx,%eax
+}
+  80270a:	c3                   	ret
+
+000000000080270b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80270b:	48 85 d2             	test   %rdx,%rdx
+  80270e:	74 1f                	je     80272f <strncmp+0x24>
+  802710:	0f b6 07             	movzbl (%rdi),%eax
+  802713:	84 c0                	test   %al,%al
+  802715:	74 1e                	je     802735 <strncmp+0x2a>
+  802717:	3a 06                	cmp    (%rsi),%al
+  802719:	75 1a                	jne    802735 <strncmp+0x2a>
+  80271b:	48 83 c7 01          	add    $0x1,%rdi
+  80271f:	48 83 c6 01          	add    $0x1,%rsi
+  802723:	48 83 ea 01          	sub    $0x1,%rdx
+  802727:	75 e7                	jne    802710 <strncmp+0x5>
+
+    if (!n) return 0;
+  802729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272e:	c3                   	ret
+  80272f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802734:	c3                   	ret
+  802735:	48 85 d2             	test   %rdx,%rdx
+  802738:	74 09                	je     802743 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80273a:	0f b6 07             	movzbl (%rdi),%eax
+  80273d:	0f b6 16             	movzbl (%rsi),%edx
+  802740:	29 d0                	sub    %edx,%eax
+  802742:	c3                   	ret
+    if (!n) return 0;
+  802743:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802748:	c3                   	ret
+
+0000000000802749 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802749:	0f b6 17             	movzbl (%rdi),%edx
+  80274c:	84 d2                	test   %dl,%dl
+  80274e:	74 18                	je     802768 <strchr+0x1f>
+        if (*str == c) {
+  802750:	0f be d2             	movsbl %dl,%edx
+  802753:	39 f2                	cmp    %esi,%edx
+  802755:	74 17                	je     80276e <strchr+0x25>
+    for (; *str; str++) {
+  802757:	48 83 c7 01          	add    $0x1,%rdi
+  80275b:	0f b6 17             	movzbl (%rdi),%edx
+  80275e:	84 d2                	test   %dl,%dl
+  802760:	75 ee                	jne    802750 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802762:	b8 00 00 00 00       	mov    $0x0,%eax
+  802767:	c3                   	ret
+  802768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276d:	c3                   	ret
+  80276e:	48 89 f8             	mov    %rdi,%rax
+}
+  802771:	c3                   	ret
+
+0000000000802772 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802772:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802775:	0f b6 17             	movzbl (%rdi),%edx
+  802778:	84 d2                	test   %dl,%dl
+  80277a:	74 13                	je     80278f <strfind+0x1d>
+  80277c:	0f be d2             	movsbl %dl,%edx
+  80277f:	39 f2                	cmp    %esi,%edx
+  802781:	74 0b                	je     80278e <strfind+0x1c>
+  802783:	48 83 c0 01          	add    $0x1,%rax
+  802787:	0f b6 10             	movzbl (%rax),%edx
+  80278a:	84 d2                	test   %dl,%dl
+  80278c:	75 ee                	jne    80277c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80278e:	c3                   	ret
+  80278f:	c3                   	ret
+
+0000000000802790 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802790:	48 39 f7             	cmp    %rsi,%rdi
+  802793:	74 65                	je     8027fa <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802795:	55                   	push   %rbp
+  802796:	48 89 e5             	mov    %rsp,%rbp
+  802799:	41 57                	push   %r15
+  80279b:	41 56                	push   %r14
+  80279d:	41 55                	push   %r13
+  80279f:	41 54                	push   %r12
+  8027a1:	53                   	push   %rbx
+  8027a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8027a6:	48 89 fb             	mov    %rdi,%rbx
+  8027a9:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8027ac:	49 bf 81 26 80 00 00 	movabs $0x802681,%r15
+  8027b3:	00 00 00 
+  8027b6:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8027ba:	41 0f b6 fd          	movzbl %r13b,%edi
+  8027be:	41 ff d7             	call   *%r15
+  8027c1:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8027c4:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8027c9:	41 0f b6 fe          	movzbl %r14b,%edi
+  8027cd:	41 ff d7             	call   *%r15
+  8027d0:	89 c2                	mov    %eax,%edx
+  8027d2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8027d5:	29 d0                	sub    %edx,%eax
+  8027d7:	75 12                	jne    8027eb <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8027d9:	48 83 c3 01          	add    $0x1,%rbx
+  8027dd:	45 84 ed             	test   %r13b,%r13b
+  8027e0:	74 09                	je     8027eb <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8027e2:	49 83 c4 01          	add    $0x1,%r12
+  8027e6:	45 84 f6             	test   %r14b,%r14b
+  8027e9:	75 cb                	jne    8027b6 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8027eb:	48 83 c4 18          	add    $0x18,%rsp
+  8027ef:	5b                   	pop    %rbx
+  8027f0:	41 5c                	pop    %r12
+  8027f2:	41 5d                	pop    %r13
+  8027f4:	41 5e                	pop    %r14
+  8027f6:	41 5f                	pop    %r15
+  8027f8:	5d                   	pop    %rbp
+  8027f9:	c3                   	ret
+    if (p1 == p2) return 0;
+  8027fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ff:	c3                   	ret
+
+0000000000802800 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802800:	48 39 f7             	cmp    %rsi,%rdi
+  802803:	74 7d                	je     802882 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802805:	55                   	push   %rbp
+  802806:	48 89 e5             	mov    %rsp,%rbp
+  802809:	41 57                	push   %r15
+  80280b:	41 56                	push   %r14
+  80280d:	41 55                	push   %r13
+  80280f:	41 54                	push   %r12
+  802811:	53                   	push   %rbx
+  802812:	48 83 ec 18          	sub    $0x18,%rsp
+  802816:	48 89 fb             	mov    %rdi,%rbx
+  802819:	49 89 f4             	mov    %rsi,%r12
+  80281c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802820:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802824:	49 bf 81 26 80 00 00 	movabs $0x802681,%r15
+  80282b:	00 00 00 
+    while (n--) {
+  80282e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802832:	48 39 c3             	cmp    %rax,%rbx
+  802835:	74 37                	je     80286e <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802837:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80283b:	41 0f b6 fd          	movzbl %r13b,%edi
+  80283f:	41 ff d7             	call   *%r15
+  802842:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802845:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80284a:	41 0f b6 fe          	movzbl %r14b,%edi
+  80284e:	41 ff d7             	call   *%r15
+  802851:	89 c2                	mov    %eax,%edx
+  802853:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802856:	29 d0                	sub    %edx,%eax
+  802858:	75 19                	jne    802873 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80285a:	48 83 c3 01          	add    $0x1,%rbx
+  80285e:	45 84 ed             	test   %r13b,%r13b
+  802861:	74 10                	je     802873 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802863:	49 83 c4 01          	add    $0x1,%r12
+  802867:	45 84 f6             	test   %r14b,%r14b
+  80286a:	75 c2                	jne    80282e <strncasecmp+0x2e>
+  80286c:	eb 05                	jmp    802873 <strncasecmp+0x73>
+  80286e:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802873:	48 83 c4 18          	add    $0x18,%rsp
+  802877:	5b                   	pop    %rbx
+  802878:	41 5c                	pop    %r12
+  80287a:	41 5d                	pop    %r13
+  80287c:	41 5e                	pop    %r14
+  80287e:	41 5f                	pop    %r15
+  802880:	5d                   	pop    %rbp
+  802881:	c3                   	ret
+    if (p1 == p2) return 0;
+  802882:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802887:	c3                   	ret
+
+0000000000802888 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802888:	83 e7 df             	and    $0xffffffdf,%edi
+  80288b:	83 ef 41             	sub    $0x41,%edi
+  80288e:	83 ff 19             	cmp    $0x19,%edi
+  802891:	0f 96 c0             	setbe  %al
+}
+  802894:	c3                   	ret
+
+0000000000802895 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802895:	83 ff 20             	cmp    $0x20,%edi
+  802898:	0f 94 c0             	sete   %al
+  80289b:	83 ff 09             	cmp    $0x9,%edi
+  80289e:	0f 94 c2             	sete   %dl
+  8028a1:	09 d0                	or     %edx,%eax
+}
+  8028a3:	c3                   	ret
+
+00000000008028a4 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8028a4:	55                   	push   %rbp
+  8028a5:	48 89 e5             	mov    %rsp,%rbp
+  8028a8:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8028aa:	48 bf 3f 6f 80 00 00 	movabs $0x806f3f,%rdi
+  8028b1:	00 00 00 
+  8028b4:	48 b8 49 27 80 00 00 	movabs $0x802749,%rax
+  8028bb:	00 00 00 
+  8028be:	ff d0                	call   *%rax
+  8028c0:	48 85 c0             	test   %rax,%rax
+  8028c3:	0f 95 c0             	setne  %al
+}
+  8028c6:	5d                   	pop    %rbp
+  8028c7:	c3                   	ret
+
+00000000008028c8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8028c8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8028cb:	48 89 f8             	mov    %rdi,%rax
+  8028ce:	48 f7 d8             	neg    %rax
+  8028d1:	83 e0 07             	and    $0x7,%eax
+  8028d4:	49 89 d1             	mov    %rdx,%r9
+  8028d7:	49 29 c1             	sub    %rax,%r9
+  8028da:	78 36                	js     802912 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8028dc:	40 0f b6 c6          	movzbl %sil,%eax
+  8028e0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8028e7:	01 01 01 
+  8028ea:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8028ee:	40 f6 c7 07          	test   $0x7,%dil
+  8028f2:	75 38                	jne    80292c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8028f4:	4c 89 c9             	mov    %r9,%rcx
+  8028f7:	48 c1 f9 03          	sar    $0x3,%rcx
+  8028fb:	74 0c                	je     802909 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8028fd:	fc                   	cld
+  8028fe:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802901:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802905:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802909:	4d 85 c9             	test   %r9,%r9
+  80290c:	75 45                	jne    802953 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80290e:	4c 89 c0             	mov    %r8,%rax
+  802911:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802912:	48 85 d2             	test   %rdx,%rdx
+  802915:	74 f7                	je     80290e <memset+0x46>
+  802917:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80291a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80291d:	48 83 c0 01          	add    $0x1,%rax
+  802921:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802925:	48 39 c2             	cmp    %rax,%rdx
+  802928:	75 f3                	jne    80291d <memset+0x55>
+  80292a:	eb e2                	jmp    80290e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80292c:	40 f6 c7 01          	test   $0x1,%dil
+  802930:	74 06                	je     802938 <memset+0x70>
+  802932:	88 07                	mov    %al,(%rdi)
+  802934:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802938:	40 f6 c7 02          	test   $0x2,%dil
+  80293c:	74 07                	je     802945 <memset+0x7d>
+  80293e:	66 89 07             	mov    %ax,(%rdi)
+  802941:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802945:	40 f6 c7 04          	test   $0x4,%dil
+  802949:	74 a9                	je     8028f4 <memset+0x2c>
+  80294b:	89 07                	mov    %eax,(%rdi)
+  80294d:	48 83 c7 04          	add    $0x4,%rdi
+  802951:	eb a1                	jmp    8028f4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802953:	41 f6 c1 04          	test   $0x4,%r9b
+  802957:	74 06                	je     80295f <memset+0x97>
+  802959:	89 07                	mov    %eax,(%rdi)
+  80295b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80295f:	41 f6 c1 02          	test   $0x2,%r9b
+  802963:	74 07                	je     80296c <memset+0xa4>
+  802965:	66 89 07             	mov    %ax,(%rdi)
+  802968:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80296c:	41 f6 c1 01          	test   $0x1,%r9b
+  802970:	74 9c                	je     80290e <memset+0x46>
+  802972:	88 07                	mov    %al,(%rdi)
+  802974:	eb 98                	jmp    80290e <memset+0x46>
+
+0000000000802976 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802976:	48 89 f8             	mov    %rdi,%rax
+  802979:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80297c:	48 39 fe             	cmp    %rdi,%rsi
+  80297f:	73 3b                	jae    8029bc <memmove+0x46>
+  802981:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802985:	48 39 d7             	cmp    %rdx,%rdi
+  802988:	73 32                	jae    8029bc <memmove+0x46>
+        s += n;
+        d += n;
+  80298a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80298e:	48 89 d6             	mov    %rdx,%rsi
+  802991:	48 09 fe             	or     %rdi,%rsi
+  802994:	48 09 ce             	or     %rcx,%rsi
+  802997:	40 f6 c6 07          	test   $0x7,%sil
+  80299b:	75 12                	jne    8029af <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80299d:	48 83 ef 08          	sub    $0x8,%rdi
+  8029a1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8029a5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8029a9:	fd                   	std
+  8029aa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8029ad:	fc                   	cld
+  8029ae:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8029af:	48 83 ef 01          	sub    $0x1,%rdi
+  8029b3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8029b7:	fd                   	std
+  8029b8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8029ba:	eb f1                	jmp    8029ad <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8029bc:	48 89 f2             	mov    %rsi,%rdx
+  8029bf:	48 09 c2             	or     %rax,%rdx
+  8029c2:	48 09 ca             	or     %rcx,%rdx
+  8029c5:	f6 c2 07             	test   $0x7,%dl
+  8029c8:	75 0c                	jne    8029d6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8029ca:	48 c1 e9 03          	shr    $0x3,%rcx
+  8029ce:	48 89 c7             	mov    %rax,%rdi
+  8029d1:	fc                   	cld
+  8029d2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8029d5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8029d6:	48 89 c7             	mov    %rax,%rdi
+  8029d9:	fc                   	cld
+  8029da:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8029dc:	c3                   	ret
+
+00000000008029dd <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8029dd:	55                   	push   %rbp
+  8029de:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8029e1:	48 b8 76 29 80 00 00 	movabs $0x802976,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+}
+  8029ed:	5d                   	pop    %rbp
+  8029ee:	c3                   	ret
+
+00000000008029ef <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8029ef:	55                   	push   %rbp
+  8029f0:	48 89 e5             	mov    %rsp,%rbp
+  8029f3:	41 57                	push   %r15
+  8029f5:	41 56                	push   %r14
+  8029f7:	41 55                	push   %r13
+  8029f9:	41 54                	push   %r12
+  8029fb:	53                   	push   %rbx
+  8029fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802a00:	49 89 fe             	mov    %rdi,%r14
+  802a03:	49 89 f7             	mov    %rsi,%r15
+  802a06:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802a09:	48 89 f7             	mov    %rsi,%rdi
+  802a0c:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  802a13:	00 00 00 
+  802a16:	ff d0                	call   *%rax
+  802a18:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802a1b:	48 89 de             	mov    %rbx,%rsi
+  802a1e:	4c 89 f7             	mov    %r14,%rdi
+  802a21:	48 b8 03 26 80 00 00 	movabs $0x802603,%rax
+  802a28:	00 00 00 
+  802a2b:	ff d0                	call   *%rax
+  802a2d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802a30:	48 39 c3             	cmp    %rax,%rbx
+  802a33:	74 36                	je     802a6b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802a35:	48 89 d8             	mov    %rbx,%rax
+  802a38:	4c 29 e8             	sub    %r13,%rax
+  802a3b:	49 39 c4             	cmp    %rax,%r12
+  802a3e:	73 31                	jae    802a71 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802a40:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802a45:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802a49:	4c 89 fe             	mov    %r15,%rsi
+  802a4c:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  802a53:	00 00 00 
+  802a56:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802a58:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802a5c:	48 83 c4 08          	add    $0x8,%rsp
+  802a60:	5b                   	pop    %rbx
+  802a61:	41 5c                	pop    %r12
+  802a63:	41 5d                	pop    %r13
+  802a65:	41 5e                	pop    %r14
+  802a67:	41 5f                	pop    %r15
+  802a69:	5d                   	pop    %rbp
+  802a6a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802a6b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802a6f:	eb eb                	jmp    802a5c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802a71:	48 83 eb 01          	sub    $0x1,%rbx
+  802a75:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802a79:	48 89 da             	mov    %rbx,%rdx
+  802a7c:	4c 89 fe             	mov    %r15,%rsi
+  802a7f:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  802a86:	00 00 00 
+  802a89:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802a8b:	49 01 de             	add    %rbx,%r14
+  802a8e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802a93:	eb c3                	jmp    802a58 <strlcat+0x69>
+
+0000000000802a95 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802a95:	48 85 d2             	test   %rdx,%rdx
+  802a98:	74 2d                	je     802ac7 <memcmp+0x32>
+  802a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802a9f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802aa3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802aa8:	44 38 c1             	cmp    %r8b,%cl
+  802aab:	75 0f                	jne    802abc <memcmp+0x27>
+    while (n-- > 0) {
+  802aad:	48 83 c0 01          	add    $0x1,%rax
+  802ab1:	48 39 c2             	cmp    %rax,%rdx
+  802ab4:	75 e9                	jne    802a9f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802abb:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802abc:	0f b6 c1             	movzbl %cl,%eax
+  802abf:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802ac3:	44 29 c0             	sub    %r8d,%eax
+  802ac6:	c3                   	ret
+    return 0;
+  802ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802acc:	c3                   	ret
+
+0000000000802acd <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802acd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802ad1:	48 39 c7             	cmp    %rax,%rdi
+  802ad4:	73 0f                	jae    802ae5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802ad6:	40 38 37             	cmp    %sil,(%rdi)
+  802ad9:	74 0e                	je     802ae9 <memfind+0x1c>
+    for (; src < end; src++) {
+  802adb:	48 83 c7 01          	add    $0x1,%rdi
+  802adf:	48 39 f8             	cmp    %rdi,%rax
+  802ae2:	75 f2                	jne    802ad6 <memfind+0x9>
+  802ae4:	c3                   	ret
+  802ae5:	48 89 f8             	mov    %rdi,%rax
+  802ae8:	c3                   	ret
+  802ae9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802aec:	c3                   	ret
+
+0000000000802aed <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802aed:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802af0:	0f b6 37             	movzbl (%rdi),%esi
+  802af3:	40 80 fe 20          	cmp    $0x20,%sil
+  802af7:	74 06                	je     802aff <strtol+0x12>
+  802af9:	40 80 fe 09          	cmp    $0x9,%sil
+  802afd:	75 13                	jne    802b12 <strtol+0x25>
+  802aff:	48 83 c7 01          	add    $0x1,%rdi
+  802b03:	0f b6 37             	movzbl (%rdi),%esi
+  802b06:	40 80 fe 20          	cmp    $0x20,%sil
+  802b0a:	74 f3                	je     802aff <strtol+0x12>
+  802b0c:	40 80 fe 09          	cmp    $0x9,%sil
+  802b10:	74 ed                	je     802aff <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802b12:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802b15:	83 e0 fd             	and    $0xfffffffd,%eax
+  802b18:	3c 01                	cmp    $0x1,%al
+  802b1a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802b1e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802b24:	75 0f                	jne    802b35 <strtol+0x48>
+  802b26:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802b29:	74 14                	je     802b3f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802b2b:	85 d2                	test   %edx,%edx
+  802b2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b32:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802b35:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802b3a:	4c 63 ca             	movslq %edx,%r9
+  802b3d:	eb 36                	jmp    802b75 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802b3f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802b43:	74 0f                	je     802b54 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802b45:	85 d2                	test   %edx,%edx
+  802b47:	75 ec                	jne    802b35 <strtol+0x48>
+        s++;
+  802b49:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802b4d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802b52:	eb e1                	jmp    802b35 <strtol+0x48>
+        s += 2;
+  802b54:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802b58:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802b5d:	eb d6                	jmp    802b35 <strtol+0x48>
+            dig -= '0';
+  802b5f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802b62:	44 0f b6 c1          	movzbl %cl,%r8d
+  802b66:	41 39 d0             	cmp    %edx,%r8d
+  802b69:	7d 21                	jge    802b8c <strtol+0x9f>
+        val = val * base + dig;
+  802b6b:	49 0f af c1          	imul   %r9,%rax
+  802b6f:	0f b6 c9             	movzbl %cl,%ecx
+  802b72:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802b75:	48 83 c7 01          	add    $0x1,%rdi
+  802b79:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802b7d:	80 f9 39             	cmp    $0x39,%cl
+  802b80:	76 dd                	jbe    802b5f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802b82:	80 f9 7b             	cmp    $0x7b,%cl
+  802b85:	77 05                	ja     802b8c <strtol+0x9f>
+            dig -= 'a' - 10;
+  802b87:	83 e9 57             	sub    $0x57,%ecx
+  802b8a:	eb d6                	jmp    802b62 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802b8c:	4d 85 d2             	test   %r10,%r10
+  802b8f:	74 03                	je     802b94 <strtol+0xa7>
+  802b91:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802b94:	48 89 c2             	mov    %rax,%rdx
+  802b97:	48 f7 da             	neg    %rdx
+  802b9a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802b9e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802ba2:	c3                   	ret
+
+0000000000802ba3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802ba3:	55                   	push   %rbp
+  802ba4:	48 89 e5             	mov    %rsp,%rbp
+  802ba7:	53                   	push   %rbx
+  802ba8:	48 89 fa             	mov    %rdi,%rdx
+  802bab:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802bae:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bb8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bbd:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bc8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bce:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802bd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bd4:	c9                   	leave
+  802bd5:	c3                   	ret
+
+0000000000802bd6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802bd6:	55                   	push   %rbp
+  802bd7:	48 89 e5             	mov    %rsp,%rbp
+  802bda:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802bdb:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802be0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bf4:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c05:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802c07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c0b:	c9                   	leave
+  802c0c:	c3                   	ret
+
+0000000000802c0d <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802c0d:	55                   	push   %rbp
+  802c0e:	48 89 e5             	mov    %rsp,%rbp
+  802c11:	53                   	push   %rbx
+  802c12:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c15:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c24:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c29:	be 00 00 00 00       	mov    $0x0,%esi
+  802c2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c3a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802c3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c40:	c9                   	leave
+  802c41:	c3                   	ret
+
+0000000000802c42 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802c42:	55                   	push   %rbp
+  802c43:	48 89 e5             	mov    %rsp,%rbp
+  802c46:	53                   	push   %rbx
+  802c47:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802c4b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c4e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c53:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c62:	be 00 00 00 00       	mov    $0x0,%esi
+  802c67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c6d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c73:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c75:	48 85 c0             	test   %rax,%rax
+  802c78:	7f 06                	jg     802c80 <sys_env_destroy+0x3e>
+}
+  802c7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c7e:	c9                   	leave
+  802c7f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c80:	49 89 c0             	mov    %rax,%r8
+  802c83:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802c88:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  802c8f:	00 00 00 
+  802c92:	be 27 00 00 00       	mov    $0x27,%esi
+  802c97:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  802c9e:	00 00 00 
+  802ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca6:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  802cad:	00 00 00 
+  802cb0:	41 ff d1             	call   *%r9
+
+0000000000802cb3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802cb3:	55                   	push   %rbp
+  802cb4:	48 89 e5             	mov    %rsp,%rbp
+  802cb7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ccc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cd1:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cdc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ce2:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ce4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce8:	c9                   	leave
+  802ce9:	c3                   	ret
+
+0000000000802cea <sys_yield>:
+
+void
+sys_yield(void) {
+  802cea:	55                   	push   %rbp
+  802ceb:	48 89 e5             	mov    %rsp,%rbp
+  802cee:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cef:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d03:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d08:	be 00 00 00 00       	mov    $0x0,%esi
+  802d0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d13:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d19:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d1b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d1f:	c9                   	leave
+  802d20:	c3                   	ret
+
+0000000000802d21 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802d21:	55                   	push   %rbp
+  802d22:	48 89 e5             	mov    %rsp,%rbp
+  802d25:	53                   	push   %rbx
+  802d26:	48 89 fa             	mov    %rdi,%rdx
+  802d29:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d2c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d31:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802d38:	00 00 00 
+  802d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d40:	be 00 00 00 00       	mov    $0x0,%esi
+  802d45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d4b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d51:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802d53:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d57:	c9                   	leave
+  802d58:	c3                   	ret
+
+0000000000802d59 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802d59:	55                   	push   %rbp
+  802d5a:	48 89 e5             	mov    %rsp,%rbp
+  802d5d:	53                   	push   %rbx
+  802d5e:	49 89 f8             	mov    %rdi,%r8
+  802d61:	48 89 d3             	mov    %rdx,%rbx
+  802d64:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802d67:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d6c:	4c 89 c2             	mov    %r8,%rdx
+  802d6f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d72:	be 00 00 00 00       	mov    $0x0,%esi
+  802d77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d7d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d83:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802d85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d89:	c9                   	leave
+  802d8a:	c3                   	ret
+
+0000000000802d8b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802d8b:	55                   	push   %rbp
+  802d8c:	48 89 e5             	mov    %rsp,%rbp
+  802d8f:	53                   	push   %rbx
+  802d90:	48 83 ec 08          	sub    $0x8,%rsp
+  802d94:	89 f8                	mov    %edi,%eax
+  802d96:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802d99:	48 63 f9             	movslq %ecx,%rdi
+  802d9c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d9f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802da4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802da7:	be 00 00 00 00       	mov    $0x0,%esi
+  802dac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802db2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dba:	48 85 c0             	test   %rax,%rax
+  802dbd:	7f 06                	jg     802dc5 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802dbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dc5:	49 89 c0             	mov    %rax,%r8
+  802dc8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802dcd:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  802dd4:	00 00 00 
+  802dd7:	be 27 00 00 00       	mov    $0x27,%esi
+  802ddc:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  802de3:	00 00 00 
+  802de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802deb:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  802df2:	00 00 00 
+  802df5:	41 ff d1             	call   *%r9
+
+0000000000802df8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802df8:	55                   	push   %rbp
+  802df9:	48 89 e5             	mov    %rsp,%rbp
+  802dfc:	53                   	push   %rbx
+  802dfd:	48 83 ec 08          	sub    $0x8,%rsp
+  802e01:	89 f8                	mov    %edi,%eax
+  802e03:	49 89 f2             	mov    %rsi,%r10
+  802e06:	48 89 cf             	mov    %rcx,%rdi
+  802e09:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802e0c:	48 63 da             	movslq %edx,%rbx
+  802e0f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e12:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e17:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e1a:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802e1d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e25:	48 85 c0             	test   %rax,%rax
+  802e28:	7f 06                	jg     802e30 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802e2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e2e:	c9                   	leave
+  802e2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e30:	49 89 c0             	mov    %rax,%r8
+  802e33:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802e38:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  802e3f:	00 00 00 
+  802e42:	be 27 00 00 00       	mov    $0x27,%esi
+  802e47:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  802e4e:	00 00 00 
+  802e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e56:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  802e5d:	00 00 00 
+  802e60:	41 ff d1             	call   *%r9
+
+0000000000802e63 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802e63:	55                   	push   %rbp
+  802e64:	48 89 e5             	mov    %rsp,%rbp
+  802e67:	53                   	push   %rbx
+  802e68:	48 83 ec 08          	sub    $0x8,%rsp
+  802e6c:	48 89 f1             	mov    %rsi,%rcx
+  802e6f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802e72:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e75:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e7f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e90:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e92:	48 85 c0             	test   %rax,%rax
+  802e95:	7f 06                	jg     802e9d <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802e97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e9b:	c9                   	leave
+  802e9c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e9d:	49 89 c0             	mov    %rax,%r8
+  802ea0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ea5:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  802eac:	00 00 00 
+  802eaf:	be 27 00 00 00       	mov    $0x27,%esi
+  802eb4:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  802ebb:	00 00 00 
+  802ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec3:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  802eca:	00 00 00 
+  802ecd:	41 ff d1             	call   *%r9
+
+0000000000802ed0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802ed0:	55                   	push   %rbp
+  802ed1:	48 89 e5             	mov    %rsp,%rbp
+  802ed4:	53                   	push   %rbx
+  802ed5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802ed9:	48 63 ce             	movslq %esi,%rcx
+  802edc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802edf:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ee4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eee:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ef9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802eff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f01:	48 85 c0             	test   %rax,%rax
+  802f04:	7f 06                	jg     802f0c <sys_env_set_status+0x3c>
+}
+  802f06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f0a:	c9                   	leave
+  802f0b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f0c:	49 89 c0             	mov    %rax,%r8
+  802f0f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802f14:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  802f1b:	00 00 00 
+  802f1e:	be 27 00 00 00       	mov    $0x27,%esi
+  802f23:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  802f2a:	00 00 00 
+  802f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f32:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  802f39:	00 00 00 
+  802f3c:	41 ff d1             	call   *%r9
+
+0000000000802f3f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802f3f:	55                   	push   %rbp
+  802f40:	48 89 e5             	mov    %rsp,%rbp
+  802f43:	53                   	push   %rbx
+  802f44:	48 83 ec 08          	sub    $0x8,%rsp
+  802f48:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802f4b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f5d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f6e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f70:	48 85 c0             	test   %rax,%rax
+  802f73:	7f 06                	jg     802f7b <sys_env_set_trapframe+0x3c>
+}
+  802f75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f79:	c9                   	leave
+  802f7a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f7b:	49 89 c0             	mov    %rax,%r8
+  802f7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802f83:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  802f8a:	00 00 00 
+  802f8d:	be 27 00 00 00       	mov    $0x27,%esi
+  802f92:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  802f99:	00 00 00 
+  802f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa1:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  802fa8:	00 00 00 
+  802fab:	41 ff d1             	call   *%r9
+
+0000000000802fae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802fae:	55                   	push   %rbp
+  802faf:	48 89 e5             	mov    %rsp,%rbp
+  802fb2:	53                   	push   %rbx
+  802fb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802fb7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802fba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fbd:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fc7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  802fd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fd7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fdd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fdf:	48 85 c0             	test   %rax,%rax
+  802fe2:	7f 06                	jg     802fea <sys_env_set_pgfault_upcall+0x3c>
+}
+  802fe4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fe8:	c9                   	leave
+  802fe9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802fea:	49 89 c0             	mov    %rax,%r8
+  802fed:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802ff2:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  802ff9:	00 00 00 
+  802ffc:	be 27 00 00 00       	mov    $0x27,%esi
+  803001:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  803008:	00 00 00 
+  80300b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803010:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  803017:	00 00 00 
+  80301a:	41 ff d1             	call   *%r9
+
+000000000080301d <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  80301d:	55                   	push   %rbp
+  80301e:	48 89 e5             	mov    %rsp,%rbp
+  803021:	53                   	push   %rbx
+  803022:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  803026:	40 0f b6 ce          	movzbl %sil,%ecx
+  80302a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80302d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803032:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803037:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80303c:	be 00 00 00 00       	mov    $0x0,%esi
+  803041:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803047:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80304d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80304f:	48 85 c0             	test   %rax,%rax
+  803052:	7f 06                	jg     80305a <sys_env_set_reclaim+0x3d>
+}
+  803054:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803058:	c9                   	leave
+  803059:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80305a:	49 89 c0             	mov    %rax,%r8
+  80305d:	b9 16 00 00 00       	mov    $0x16,%ecx
+  803062:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  803069:	00 00 00 
+  80306c:	be 27 00 00 00       	mov    $0x27,%esi
+  803071:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  803078:	00 00 00 
+  80307b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803080:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  803087:	00 00 00 
+  80308a:	41 ff d1             	call   *%r9
+
+000000000080308d <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  80308d:	55                   	push   %rbp
+  80308e:	48 89 e5             	mov    %rsp,%rbp
+  803091:	53                   	push   %rbx
+  803092:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  803096:	48 63 ce             	movslq %esi,%rcx
+  803099:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80309c:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8030be:	48 85 c0             	test   %rax,%rax
+  8030c1:	7f 06                	jg     8030c9 <sys_env_set_nice+0x3c>
+}
+  8030c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030c7:	c9                   	leave
+  8030c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8030c9:	49 89 c0             	mov    %rax,%r8
+  8030cc:	b9 18 00 00 00       	mov    $0x18,%ecx
+  8030d1:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  8030d8:	00 00 00 
+  8030db:	be 27 00 00 00       	mov    $0x27,%esi
+  8030e0:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  8030e7:	00 00 00 
+  8030ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ef:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  8030f6:	00 00 00 
+  8030f9:	41 ff d1             	call   *%r9
+
+00000000008030fc <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  8030fc:	55                   	push   %rbp
+  8030fd:	48 89 e5             	mov    %rsp,%rbp
+  803100:	53                   	push   %rbx
+  803101:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803104:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803109:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80310e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803113:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803118:	be 00 00 00 00       	mov    $0x0,%esi
+  80311d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803123:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803129:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  80312b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80312f:	c9                   	leave
+  803130:	c3                   	ret
+
+0000000000803131 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803131:	55                   	push   %rbp
+  803132:	48 89 e5             	mov    %rsp,%rbp
+  803135:	53                   	push   %rbx
+  803136:	89 f8                	mov    %edi,%eax
+  803138:	49 89 f1             	mov    %rsi,%r9
+  80313b:	48 89 d3             	mov    %rdx,%rbx
+  80313e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803141:	49 63 f0             	movslq %r8d,%rsi
+  803144:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803147:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80314c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80314f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803155:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80315b:	cd 30                	int    $0x30
+}
+  80315d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803161:	c9                   	leave
+  803162:	c3                   	ret
+
+0000000000803163 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803163:	55                   	push   %rbp
+  803164:	48 89 e5             	mov    %rsp,%rbp
+  803167:	53                   	push   %rbx
+  803168:	89 f8                	mov    %edi,%eax
+  80316a:	49 89 f1             	mov    %rsi,%r9
+  80316d:	48 89 d3             	mov    %rdx,%rbx
+  803170:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803173:	49 63 f0             	movslq %r8d,%rsi
+  803176:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803179:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80317e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803187:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80318d:	cd 30                	int    $0x30
+}
+  80318f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803193:	c9                   	leave
+  803194:	c3                   	ret
+
+0000000000803195 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  803195:	55                   	push   %rbp
+  803196:	48 89 e5             	mov    %rsp,%rbp
+  803199:	53                   	push   %rbx
+  80319a:	48 83 ec 08          	sub    $0x8,%rsp
+  80319e:	89 f8                	mov    %edi,%eax
+  8031a0:	49 89 f2             	mov    %rsi,%r10
+  8031a3:	48 89 d3             	mov    %rdx,%rbx
+  8031a6:	48 89 cf             	mov    %rcx,%rdi
+  8031a9:	44 89 c6             	mov    %r8d,%esi
+  8031ac:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  8031af:	48 63 f6             	movslq %esi,%rsi
+  8031b2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8031b5:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8031ba:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  8031bd:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  8031c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8031c3:	48 85 c0             	test   %rax,%rax
+  8031c6:	7f 06                	jg     8031ce <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8031c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031cc:	c9                   	leave
+  8031cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8031ce:	49 89 c0             	mov    %rax,%r8
+  8031d1:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8031d6:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  8031dd:	00 00 00 
+  8031e0:	be 27 00 00 00       	mov    $0x27,%esi
+  8031e5:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  8031ec:	00 00 00 
+  8031ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f4:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  8031fb:	00 00 00 
+  8031fe:	41 ff d1             	call   *%r9
+
+0000000000803201 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  803201:	55                   	push   %rbp
+  803202:	48 89 e5             	mov    %rsp,%rbp
+  803205:	53                   	push   %rbx
+  803206:	48 83 ec 08          	sub    $0x8,%rsp
+  80320a:	48 89 f1             	mov    %rsi,%rcx
+  80320d:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  803210:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  803214:	48 8b 1a             	mov    (%rdx),%rbx
+  803217:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80321a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80321f:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803223:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  803227:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  80322b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80322d:	48 85 c0             	test   %rax,%rax
+  803230:	7f 06                	jg     803238 <sys_ipc_call_short+0x37>
+}
+  803232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803236:	c9                   	leave
+  803237:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803238:	49 89 c0             	mov    %rax,%r8
+  80323b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  803240:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  803247:	00 00 00 
+  80324a:	be 27 00 00 00       	mov    $0x27,%esi
+  80324f:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  803256:	00 00 00 
+  803259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325e:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  803265:	00 00 00 
+  803268:	41 ff d1             	call   *%r9
+
+000000000080326b <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80326b:	55                   	push   %rbp
+  80326c:	48 89 e5             	mov    %rsp,%rbp
+  80326f:	53                   	push   %rbx
+  803270:	48 83 ec 08          	sub    $0x8,%rsp
+  803274:	89 f8                	mov    %edi,%eax
+  803276:	49 89 f2             	mov    %rsi,%r10
+  803279:	48 89 d3             	mov    %rdx,%rbx
+  80327c:	48 89 cf             	mov    %rcx,%rdi
+  80327f:	44 89 c6             	mov    %r8d,%esi
+  803282:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803285:	48 63 f6             	movslq %esi,%rsi
+  803288:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80328b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803290:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803293:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803297:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803299:	48 85 c0             	test   %rax,%rax
+  80329c:	7f 06                	jg     8032a4 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80329e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032a2:	c9                   	leave
+  8032a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8032a4:	49 89 c0             	mov    %rax,%r8
+  8032a7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8032ac:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  8032b3:	00 00 00 
+  8032b6:	be 27 00 00 00       	mov    $0x27,%esi
+  8032bb:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  8032c2:	00 00 00 
+  8032c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ca:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  8032d1:	00 00 00 
+  8032d4:	41 ff d1             	call   *%r9
+
+00000000008032d7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8032d7:	55                   	push   %rbp
+  8032d8:	48 89 e5             	mov    %rsp,%rbp
+  8032db:	53                   	push   %rbx
+  8032dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8032e0:	48 89 fa             	mov    %rdi,%rdx
+  8032e3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8032e6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8032eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8032fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803300:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803306:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803308:	48 85 c0             	test   %rax,%rax
+  80330b:	7f 06                	jg     803313 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80330d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803311:	c9                   	leave
+  803312:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803313:	49 89 c0             	mov    %rax,%r8
+  803316:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80331b:	48 ba 48 6f 80 00 00 	movabs $0x806f48,%rdx
+  803322:	00 00 00 
+  803325:	be 27 00 00 00       	mov    $0x27,%esi
+  80332a:	48 bf 67 6f 80 00 00 	movabs $0x806f67,%rdi
+  803331:	00 00 00 
+  803334:	b8 00 00 00 00       	mov    $0x0,%eax
+  803339:	49 b9 9f 1b 80 00 00 	movabs $0x801b9f,%r9
+  803340:	00 00 00 
+  803343:	41 ff d1             	call   *%r9
+
+0000000000803346 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803346:	55                   	push   %rbp
+  803347:	48 89 e5             	mov    %rsp,%rbp
+  80334a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80334b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803350:	ba 00 00 00 00       	mov    $0x0,%edx
+  803355:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80335a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80335f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803364:	be 00 00 00 00       	mov    $0x0,%esi
+  803369:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80336f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803375:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803377:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80337b:	c9                   	leave
+  80337c:	c3                   	ret
+
+000000000080337d <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  80337d:	55                   	push   %rbp
+  80337e:	48 89 e5             	mov    %rsp,%rbp
+  803381:	53                   	push   %rbx
+  803382:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803385:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80338a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80338f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803394:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803399:	be 00 00 00 00       	mov    $0x0,%esi
+  80339e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033aa:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  8033ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033b0:	c9                   	leave
+  8033b1:	c3                   	ret
+
+00000000008033b2 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  8033b2:	55                   	push   %rbp
+  8033b3:	48 89 e5             	mov    %rsp,%rbp
+  8033b6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8033b7:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8033bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8033c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8033d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033e1:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8033e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033e7:	c9                   	leave
+  8033e8:	c3                   	ret
+
+00000000008033e9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033e9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8033f0:	ff ff ff 
+  8033f3:	48 01 f8             	add    %rdi,%rax
+  8033f6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8033fa:	c3                   	ret
+
+00000000008033fb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033fb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803402:	ff ff ff 
+  803405:	48 01 f8             	add    %rdi,%rax
+  803408:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80340c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803412:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803416:	c3                   	ret
+
+0000000000803417 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803417:	55                   	push   %rbp
+  803418:	48 89 e5             	mov    %rsp,%rbp
+  80341b:	41 57                	push   %r15
+  80341d:	41 56                	push   %r14
+  80341f:	41 55                	push   %r13
+  803421:	41 54                	push   %r12
+  803423:	53                   	push   %rbx
+  803424:	48 83 ec 08          	sub    $0x8,%rsp
+  803428:	49 89 ff             	mov    %rdi,%r15
+  80342b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803430:	49 bd ab 52 80 00 00 	movabs $0x8052ab,%r13
+  803437:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80343a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803440:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803443:	48 89 df             	mov    %rbx,%rdi
+  803446:	41 ff d5             	call   *%r13
+  803449:	83 e0 04             	and    $0x4,%eax
+  80344c:	74 17                	je     803465 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80344e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803455:	4c 39 f3             	cmp    %r14,%rbx
+  803458:	75 e6                	jne    803440 <fd_alloc+0x29>
+  80345a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803460:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803465:	4d 89 27             	mov    %r12,(%r15)
+}
+  803468:	48 83 c4 08          	add    $0x8,%rsp
+  80346c:	5b                   	pop    %rbx
+  80346d:	41 5c                	pop    %r12
+  80346f:	41 5d                	pop    %r13
+  803471:	41 5e                	pop    %r14
+  803473:	41 5f                	pop    %r15
+  803475:	5d                   	pop    %rbp
+  803476:	c3                   	ret
+
+0000000000803477 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803477:	83 ff 1f             	cmp    $0x1f,%edi
+  80347a:	77 39                	ja     8034b5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80347c:	55                   	push   %rbp
+  80347d:	48 89 e5             	mov    %rsp,%rbp
+  803480:	41 54                	push   %r12
+  803482:	53                   	push   %rbx
+  803483:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803486:	48 63 df             	movslq %edi,%rbx
+  803489:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803490:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803494:	48 89 df             	mov    %rbx,%rdi
+  803497:	48 b8 ab 52 80 00 00 	movabs $0x8052ab,%rax
+  80349e:	00 00 00 
+  8034a1:	ff d0                	call   *%rax
+  8034a3:	a8 04                	test   $0x4,%al
+  8034a5:	74 14                	je     8034bb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8034a7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8034ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034b0:	5b                   	pop    %rbx
+  8034b1:	41 5c                	pop    %r12
+  8034b3:	5d                   	pop    %rbp
+  8034b4:	c3                   	ret
+        return -E_INVAL;
+  8034b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8034ba:	c3                   	ret
+        return -E_INVAL;
+  8034bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c0:	eb ee                	jmp    8034b0 <fd_lookup+0x39>
+
+00000000008034c2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8034c2:	55                   	push   %rbp
+  8034c3:	48 89 e5             	mov    %rsp,%rbp
+  8034c6:	41 54                	push   %r12
+  8034c8:	53                   	push   %rbx
+  8034c9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8034cc:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8034d3:	00 00 00 
+  8034d6:	48 bb 00 98 80 00 00 	movabs $0x809800,%rbx
+  8034dd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8034e0:	39 3b                	cmp    %edi,(%rbx)
+  8034e2:	74 47                	je     80352b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8034e4:	48 83 c0 08          	add    $0x8,%rax
+  8034e8:	48 8b 18             	mov    (%rax),%rbx
+  8034eb:	48 85 db             	test   %rbx,%rbx
+  8034ee:	75 f0                	jne    8034e0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8034f0:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  8034f7:	00 00 00 
+  8034fa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803500:	89 fa                	mov    %edi,%edx
+  803502:	48 bf 78 6f 80 00 00 	movabs $0x806f78,%rdi
+  803509:	00 00 00 
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803511:	48 b9 ef 1c 80 00 00 	movabs $0x801cef,%rcx
+  803518:	00 00 00 
+  80351b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80351d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803522:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803526:	5b                   	pop    %rbx
+  803527:	41 5c                	pop    %r12
+  803529:	5d                   	pop    %rbp
+  80352a:	c3                   	ret
+            return 0;
+  80352b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803530:	eb f0                	jmp    803522 <dev_lookup+0x60>
+
+0000000000803532 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803532:	55                   	push   %rbp
+  803533:	48 89 e5             	mov    %rsp,%rbp
+  803536:	41 55                	push   %r13
+  803538:	41 54                	push   %r12
+  80353a:	53                   	push   %rbx
+  80353b:	48 83 ec 18          	sub    $0x18,%rsp
+  80353f:	48 89 fb             	mov    %rdi,%rbx
+  803542:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803545:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80354c:	ff ff ff 
+  80354f:	48 01 df             	add    %rbx,%rdi
+  803552:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803556:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80355a:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  803561:	00 00 00 
+  803564:	ff d0                	call   *%rax
+  803566:	41 89 c5             	mov    %eax,%r13d
+  803569:	85 c0                	test   %eax,%eax
+  80356b:	78 06                	js     803573 <fd_close+0x41>
+  80356d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803571:	74 1a                	je     80358d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803573:	45 84 e4             	test   %r12b,%r12b
+  803576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80357f:	44 89 e8             	mov    %r13d,%eax
+  803582:	48 83 c4 18          	add    $0x18,%rsp
+  803586:	5b                   	pop    %rbx
+  803587:	41 5c                	pop    %r12
+  803589:	41 5d                	pop    %r13
+  80358b:	5d                   	pop    %rbp
+  80358c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80358d:	8b 3b                	mov    (%rbx),%edi
+  80358f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803593:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+  80359f:	41 89 c5             	mov    %eax,%r13d
+  8035a2:	85 c0                	test   %eax,%eax
+  8035a4:	78 1b                	js     8035c1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8035a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035aa:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8035ae:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8035b4:	48 85 c0             	test   %rax,%rax
+  8035b7:	74 08                	je     8035c1 <fd_close+0x8f>
+  8035b9:	48 89 df             	mov    %rbx,%rdi
+  8035bc:	ff d0                	call   *%rax
+  8035be:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8035c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035c6:	48 89 de             	mov    %rbx,%rsi
+  8035c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ce:	48 b8 63 2e 80 00 00 	movabs $0x802e63,%rax
+  8035d5:	00 00 00 
+  8035d8:	ff d0                	call   *%rax
+    return res;
+  8035da:	eb a3                	jmp    80357f <fd_close+0x4d>
+
+00000000008035dc <close>:
+
+int
+close(int fdnum) {
+  8035dc:	55                   	push   %rbp
+  8035dd:	48 89 e5             	mov    %rsp,%rbp
+  8035e0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035e8:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  8035ef:	00 00 00 
+  8035f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035f4:	85 c0                	test   %eax,%eax
+  8035f6:	78 15                	js     80360d <close+0x31>
+
+    return fd_close(fd, 1);
+  8035f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8035fd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803601:	48 b8 32 35 80 00 00 	movabs $0x803532,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+}
+  80360d:	c9                   	leave
+  80360e:	c3                   	ret
+
+000000000080360f <close_all>:
+
+void
+close_all(void) {
+  80360f:	55                   	push   %rbp
+  803610:	48 89 e5             	mov    %rsp,%rbp
+  803613:	41 54                	push   %r12
+  803615:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803616:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80361b:	49 bc dc 35 80 00 00 	movabs $0x8035dc,%r12
+  803622:	00 00 00 
+  803625:	89 df                	mov    %ebx,%edi
+  803627:	41 ff d4             	call   *%r12
+  80362a:	83 c3 01             	add    $0x1,%ebx
+  80362d:	83 fb 20             	cmp    $0x20,%ebx
+  803630:	75 f3                	jne    803625 <close_all+0x16>
+}
+  803632:	5b                   	pop    %rbx
+  803633:	41 5c                	pop    %r12
+  803635:	5d                   	pop    %rbp
+  803636:	c3                   	ret
+
+0000000000803637 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803637:	55                   	push   %rbp
+  803638:	48 89 e5             	mov    %rsp,%rbp
+  80363b:	41 57                	push   %r15
+  80363d:	41 56                	push   %r14
+  80363f:	41 55                	push   %r13
+  803641:	41 54                	push   %r12
+  803643:	53                   	push   %rbx
+  803644:	48 83 ec 18          	sub    $0x18,%rsp
+  803648:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80364b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80364f:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  803656:	00 00 00 
+  803659:	ff d0                	call   *%rax
+  80365b:	89 c3                	mov    %eax,%ebx
+  80365d:	85 c0                	test   %eax,%eax
+  80365f:	0f 88 b8 00 00 00    	js     80371d <dup+0xe6>
+    close(newfdnum);
+  803665:	44 89 e7             	mov    %r12d,%edi
+  803668:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  80366f:	00 00 00 
+  803672:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803674:	4d 63 ec             	movslq %r12d,%r13
+  803677:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80367e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803682:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803686:	4c 89 ff             	mov    %r15,%rdi
+  803689:	49 be fb 33 80 00 00 	movabs $0x8033fb,%r14
+  803690:	00 00 00 
+  803693:	41 ff d6             	call   *%r14
+  803696:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803699:	4c 89 ef             	mov    %r13,%rdi
+  80369c:	41 ff d6             	call   *%r14
+  80369f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8036a2:	48 89 df             	mov    %rbx,%rdi
+  8036a5:	48 b8 ab 52 80 00 00 	movabs $0x8052ab,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8036b1:	a8 04                	test   $0x4,%al
+  8036b3:	74 2b                	je     8036e0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8036b5:	41 89 c1             	mov    %eax,%r9d
+  8036b8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8036be:	4c 89 f1             	mov    %r14,%rcx
+  8036c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036c6:	48 89 de             	mov    %rbx,%rsi
+  8036c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ce:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  8036d5:	00 00 00 
+  8036d8:	ff d0                	call   *%rax
+  8036da:	89 c3                	mov    %eax,%ebx
+  8036dc:	85 c0                	test   %eax,%eax
+  8036de:	78 4e                	js     80372e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8036e0:	4c 89 ff             	mov    %r15,%rdi
+  8036e3:	48 b8 ab 52 80 00 00 	movabs $0x8052ab,%rax
+  8036ea:	00 00 00 
+  8036ed:	ff d0                	call   *%rax
+  8036ef:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8036f2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8036f8:	4c 89 e9             	mov    %r13,%rcx
+  8036fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803700:	4c 89 fe             	mov    %r15,%rsi
+  803703:	bf 00 00 00 00       	mov    $0x0,%edi
+  803708:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  80370f:	00 00 00 
+  803712:	ff d0                	call   *%rax
+  803714:	89 c3                	mov    %eax,%ebx
+  803716:	85 c0                	test   %eax,%eax
+  803718:	78 14                	js     80372e <dup+0xf7>
+
+    return newfdnum;
+  80371a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80371d:	89 d8                	mov    %ebx,%eax
+  80371f:	48 83 c4 18          	add    $0x18,%rsp
+  803723:	5b                   	pop    %rbx
+  803724:	41 5c                	pop    %r12
+  803726:	41 5d                	pop    %r13
+  803728:	41 5e                	pop    %r14
+  80372a:	41 5f                	pop    %r15
+  80372c:	5d                   	pop    %rbp
+  80372d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80372e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803733:	4c 89 ee             	mov    %r13,%rsi
+  803736:	bf 00 00 00 00       	mov    $0x0,%edi
+  80373b:	49 bc 63 2e 80 00 00 	movabs $0x802e63,%r12
+  803742:	00 00 00 
+  803745:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803748:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80374d:	4c 89 f6             	mov    %r14,%rsi
+  803750:	bf 00 00 00 00       	mov    $0x0,%edi
+  803755:	41 ff d4             	call   *%r12
+    return res;
+  803758:	eb c3                	jmp    80371d <dup+0xe6>
+
+000000000080375a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80375a:	55                   	push   %rbp
+  80375b:	48 89 e5             	mov    %rsp,%rbp
+  80375e:	41 56                	push   %r14
+  803760:	41 55                	push   %r13
+  803762:	41 54                	push   %r12
+  803764:	53                   	push   %rbx
+  803765:	48 83 ec 10          	sub    $0x10,%rsp
+  803769:	89 fb                	mov    %edi,%ebx
+  80376b:	49 89 f4             	mov    %rsi,%r12
+  80376e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803771:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803775:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  80377c:	00 00 00 
+  80377f:	ff d0                	call   *%rax
+  803781:	85 c0                	test   %eax,%eax
+  803783:	78 4c                	js     8037d1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803785:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803789:	41 8b 3e             	mov    (%r14),%edi
+  80378c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803790:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  803797:	00 00 00 
+  80379a:	ff d0                	call   *%rax
+  80379c:	85 c0                	test   %eax,%eax
+  80379e:	78 35                	js     8037d5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8037a0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8037a4:	83 e0 03             	and    $0x3,%eax
+  8037a7:	83 f8 01             	cmp    $0x1,%eax
+  8037aa:	74 2d                	je     8037d9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8037ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037b0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8037b4:	48 85 c0             	test   %rax,%rax
+  8037b7:	74 56                	je     80380f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8037b9:	4c 89 ea             	mov    %r13,%rdx
+  8037bc:	4c 89 e6             	mov    %r12,%rsi
+  8037bf:	4c 89 f7             	mov    %r14,%rdi
+  8037c2:	ff d0                	call   *%rax
+}
+  8037c4:	48 83 c4 10          	add    $0x10,%rsp
+  8037c8:	5b                   	pop    %rbx
+  8037c9:	41 5c                	pop    %r12
+  8037cb:	41 5d                	pop    %r13
+  8037cd:	41 5e                	pop    %r14
+  8037cf:	5d                   	pop    %rbp
+  8037d0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037d1:	48 98                	cltq
+  8037d3:	eb ef                	jmp    8037c4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037d5:	48 98                	cltq
+  8037d7:	eb eb                	jmp    8037c4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037d9:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  8037e0:	00 00 00 
+  8037e3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8037e9:	89 da                	mov    %ebx,%edx
+  8037eb:	48 bf b9 6f 80 00 00 	movabs $0x806fb9,%rdi
+  8037f2:	00 00 00 
+  8037f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fa:	48 b9 ef 1c 80 00 00 	movabs $0x801cef,%rcx
+  803801:	00 00 00 
+  803804:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803806:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80380d:	eb b5                	jmp    8037c4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80380f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803816:	eb ac                	jmp    8037c4 <read+0x6a>
+
+0000000000803818 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803818:	55                   	push   %rbp
+  803819:	48 89 e5             	mov    %rsp,%rbp
+  80381c:	41 57                	push   %r15
+  80381e:	41 56                	push   %r14
+  803820:	41 55                	push   %r13
+  803822:	41 54                	push   %r12
+  803824:	53                   	push   %rbx
+  803825:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803829:	48 85 d2             	test   %rdx,%rdx
+  80382c:	74 54                	je     803882 <readn+0x6a>
+  80382e:	41 89 fd             	mov    %edi,%r13d
+  803831:	49 89 f6             	mov    %rsi,%r14
+  803834:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803837:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80383c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803841:	49 bf 5a 37 80 00 00 	movabs $0x80375a,%r15
+  803848:	00 00 00 
+  80384b:	4c 89 e2             	mov    %r12,%rdx
+  80384e:	48 29 f2             	sub    %rsi,%rdx
+  803851:	4c 01 f6             	add    %r14,%rsi
+  803854:	44 89 ef             	mov    %r13d,%edi
+  803857:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80385a:	85 c0                	test   %eax,%eax
+  80385c:	78 20                	js     80387e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80385e:	01 c3                	add    %eax,%ebx
+  803860:	85 c0                	test   %eax,%eax
+  803862:	74 08                	je     80386c <readn+0x54>
+  803864:	48 63 f3             	movslq %ebx,%rsi
+  803867:	4c 39 e6             	cmp    %r12,%rsi
+  80386a:	72 df                	jb     80384b <readn+0x33>
+    }
+    return res;
+  80386c:	48 63 c3             	movslq %ebx,%rax
+}
+  80386f:	48 83 c4 08          	add    $0x8,%rsp
+  803873:	5b                   	pop    %rbx
+  803874:	41 5c                	pop    %r12
+  803876:	41 5d                	pop    %r13
+  803878:	41 5e                	pop    %r14
+  80387a:	41 5f                	pop    %r15
+  80387c:	5d                   	pop    %rbp
+  80387d:	c3                   	ret
+        if (inc < 0) return inc;
+  80387e:	48 98                	cltq
+  803880:	eb ed                	jmp    80386f <readn+0x57>
+    int inc = 1, res = 0;
+  803882:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803887:	eb e3                	jmp    80386c <readn+0x54>
+
+0000000000803889 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803889:	55                   	push   %rbp
+  80388a:	48 89 e5             	mov    %rsp,%rbp
+  80388d:	41 56                	push   %r14
+  80388f:	41 55                	push   %r13
+  803891:	41 54                	push   %r12
+  803893:	53                   	push   %rbx
+  803894:	48 83 ec 10          	sub    $0x10,%rsp
+  803898:	89 fb                	mov    %edi,%ebx
+  80389a:	49 89 f4             	mov    %rsi,%r12
+  80389d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038a0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038a4:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  8038ab:	00 00 00 
+  8038ae:	ff d0                	call   *%rax
+  8038b0:	85 c0                	test   %eax,%eax
+  8038b2:	78 47                	js     8038fb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038b4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8038b8:	41 8b 3e             	mov    (%r14),%edi
+  8038bb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038bf:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  8038c6:	00 00 00 
+  8038c9:	ff d0                	call   *%rax
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	78 30                	js     8038ff <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038cf:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8038d4:	74 2d                	je     803903 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8038d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038da:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8038de:	48 85 c0             	test   %rax,%rax
+  8038e1:	74 56                	je     803939 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8038e3:	4c 89 ea             	mov    %r13,%rdx
+  8038e6:	4c 89 e6             	mov    %r12,%rsi
+  8038e9:	4c 89 f7             	mov    %r14,%rdi
+  8038ec:	ff d0                	call   *%rax
+}
+  8038ee:	48 83 c4 10          	add    $0x10,%rsp
+  8038f2:	5b                   	pop    %rbx
+  8038f3:	41 5c                	pop    %r12
+  8038f5:	41 5d                	pop    %r13
+  8038f7:	41 5e                	pop    %r14
+  8038f9:	5d                   	pop    %rbp
+  8038fa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038fb:	48 98                	cltq
+  8038fd:	eb ef                	jmp    8038ee <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038ff:	48 98                	cltq
+  803901:	eb eb                	jmp    8038ee <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803903:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  80390a:	00 00 00 
+  80390d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803913:	89 da                	mov    %ebx,%edx
+  803915:	48 bf d5 6f 80 00 00 	movabs $0x806fd5,%rdi
+  80391c:	00 00 00 
+  80391f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803924:	48 b9 ef 1c 80 00 00 	movabs $0x801cef,%rcx
+  80392b:	00 00 00 
+  80392e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803930:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803937:	eb b5                	jmp    8038ee <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803939:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803940:	eb ac                	jmp    8038ee <write+0x65>
+
+0000000000803942 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803942:	55                   	push   %rbp
+  803943:	48 89 e5             	mov    %rsp,%rbp
+  803946:	53                   	push   %rbx
+  803947:	48 83 ec 18          	sub    $0x18,%rsp
+  80394b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80394d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803951:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  803958:	00 00 00 
+  80395b:	ff d0                	call   *%rax
+  80395d:	85 c0                	test   %eax,%eax
+  80395f:	78 0c                	js     80396d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803961:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803965:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803968:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80396d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803971:	c9                   	leave
+  803972:	c3                   	ret
+
+0000000000803973 <tell>:
+
+int tell(int fdnum) {
+  803973:	55                   	push   %rbp
+  803974:	48 89 e5             	mov    %rsp,%rbp
+  803977:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80397b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80397f:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  803986:	00 00 00 
+  803989:	ff d0                	call   *%rax
+  80398b:	85 c0                	test   %eax,%eax
+  80398d:	78 07                	js     803996 <tell+0x23>
+
+    return fd->fd_offset;
+  80398f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803993:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803996:	c9                   	leave
+  803997:	c3                   	ret
+
+0000000000803998 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803998:	55                   	push   %rbp
+  803999:	48 89 e5             	mov    %rsp,%rbp
+  80399c:	41 55                	push   %r13
+  80399e:	41 54                	push   %r12
+  8039a0:	53                   	push   %rbx
+  8039a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8039a5:	89 fb                	mov    %edi,%ebx
+  8039a7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039aa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8039ae:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  8039b5:	00 00 00 
+  8039b8:	ff d0                	call   *%rax
+  8039ba:	85 c0                	test   %eax,%eax
+  8039bc:	78 38                	js     8039f6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8039be:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8039c2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8039c6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8039ca:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  8039d1:	00 00 00 
+  8039d4:	ff d0                	call   *%rax
+  8039d6:	85 c0                	test   %eax,%eax
+  8039d8:	78 1c                	js     8039f6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8039da:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8039df:	74 20                	je     803a01 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8039e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039e5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8039e9:	48 85 c0             	test   %rax,%rax
+  8039ec:	74 47                	je     803a35 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8039ee:	44 89 e6             	mov    %r12d,%esi
+  8039f1:	4c 89 ef             	mov    %r13,%rdi
+  8039f4:	ff d0                	call   *%rax
+}
+  8039f6:	48 83 c4 18          	add    $0x18,%rsp
+  8039fa:	5b                   	pop    %rbx
+  8039fb:	41 5c                	pop    %r12
+  8039fd:	41 5d                	pop    %r13
+  8039ff:	5d                   	pop    %rbp
+  803a00:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803a01:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  803a08:	00 00 00 
+  803a0b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803a11:	89 da                	mov    %ebx,%edx
+  803a13:	48 bf 98 6f 80 00 00 	movabs $0x806f98,%rdi
+  803a1a:	00 00 00 
+  803a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a22:	48 b9 ef 1c 80 00 00 	movabs $0x801cef,%rcx
+  803a29:	00 00 00 
+  803a2c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803a2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a33:	eb c1                	jmp    8039f6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803a35:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a3a:	eb ba                	jmp    8039f6 <ftruncate+0x5e>
+
+0000000000803a3c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803a3c:	55                   	push   %rbp
+  803a3d:	48 89 e5             	mov    %rsp,%rbp
+  803a40:	41 54                	push   %r12
+  803a42:	53                   	push   %rbx
+  803a43:	48 83 ec 10          	sub    $0x10,%rsp
+  803a47:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a4a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803a4e:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  803a55:	00 00 00 
+  803a58:	ff d0                	call   *%rax
+  803a5a:	85 c0                	test   %eax,%eax
+  803a5c:	78 63                	js     803ac1 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803a5e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803a62:	41 8b 3c 24          	mov    (%r12),%edi
+  803a66:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803a6a:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  803a71:	00 00 00 
+  803a74:	ff d0                	call   *%rax
+  803a76:	85 c0                	test   %eax,%eax
+  803a78:	78 47                	js     803ac1 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a7e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803a83:	74 45                	je     803aca <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803a85:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803a88:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803a8f:	00 00 00 
+    stat->st_isdir = 0;
+  803a92:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a99:	00 00 00 
+    stat->st_ino = 0;
+  803a9c:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803aa3:	00 00 00 00 
+    stat->st_version = 0;
+  803aa7:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803aae:	00 00 00 
+    stat->st_dev = dev;
+  803ab1:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803ab8:	48 89 de             	mov    %rbx,%rsi
+  803abb:	4c 89 e7             	mov    %r12,%rdi
+  803abe:	ff 50 28             	call   *0x28(%rax)
+}
+  803ac1:	48 83 c4 10          	add    $0x10,%rsp
+  803ac5:	5b                   	pop    %rbx
+  803ac6:	41 5c                	pop    %r12
+  803ac8:	5d                   	pop    %rbp
+  803ac9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803aca:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803acf:	eb f0                	jmp    803ac1 <fstat+0x85>
+
+0000000000803ad1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803ad1:	55                   	push   %rbp
+  803ad2:	48 89 e5             	mov    %rsp,%rbp
+  803ad5:	41 54                	push   %r12
+  803ad7:	53                   	push   %rbx
+  803ad8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803adb:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae0:	48 b8 f2 3f 80 00 00 	movabs $0x803ff2,%rax
+  803ae7:	00 00 00 
+  803aea:	ff d0                	call   *%rax
+  803aec:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803aee:	85 c0                	test   %eax,%eax
+  803af0:	78 25                	js     803b17 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803af2:	4c 89 e6             	mov    %r12,%rsi
+  803af5:	89 c7                	mov    %eax,%edi
+  803af7:	48 b8 3c 3a 80 00 00 	movabs $0x803a3c,%rax
+  803afe:	00 00 00 
+  803b01:	ff d0                	call   *%rax
+  803b03:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803b06:	89 df                	mov    %ebx,%edi
+  803b08:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  803b0f:	00 00 00 
+  803b12:	ff d0                	call   *%rax
+
+    return res;
+  803b14:	44 89 e3             	mov    %r12d,%ebx
+}
+  803b17:	89 d8                	mov    %ebx,%eax
+  803b19:	5b                   	pop    %rbx
+  803b1a:	41 5c                	pop    %r12
+  803b1c:	5d                   	pop    %rbp
+  803b1d:	c3                   	ret
+
+0000000000803b1e <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b1e:	48 b8 00 d0 80 01 00 	movabs $0x180d000,%rax
+  803b25:	00 00 00 
+  803b28:	83 38 00             	cmpl   $0x0,(%rax)
+  803b2b:	74 0a                	je     803b37 <fsipc_env+0x19>
+    return fsenv;
+}
+  803b2d:	a1 00 d0 80 01 00 00 	movabs 0x180d000,%eax
+  803b34:	00 00 
+  803b36:	c3                   	ret
+fsipc_env(void) {
+  803b37:	55                   	push   %rbp
+  803b38:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b3b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b40:	48 b8 f8 62 80 00 00 	movabs $0x8062f8,%rax
+  803b47:	00 00 00 
+  803b4a:	ff d0                	call   *%rax
+  803b4c:	a3 00 d0 80 01 00 00 	movabs %eax,0x180d000
+  803b53:	00 00 
+}
+  803b55:	a1 00 d0 80 01 00 00 	movabs 0x180d000,%eax
+  803b5c:	00 00 
+  803b5e:	5d                   	pop    %rbp
+  803b5f:	c3                   	ret
+
+0000000000803b60 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803b60:	55                   	push   %rbp
+  803b61:	48 89 e5             	mov    %rsp,%rbp
+  803b64:	53                   	push   %rbx
+  803b65:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803b69:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803b70:	00 
+  803b71:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803b78:	00 
+  803b79:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803b80:	00 
+  803b81:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803b88:	00 
+  803b89:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803b90:	00 
+
+    assert(size <= sizeof(words));
+  803b91:	48 83 fa 28          	cmp    $0x28,%rdx
+  803b95:	77 38                	ja     803bcf <fsipc_short+0x6f>
+  803b97:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803b99:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b9d:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  803ba4:	00 00 00 
+  803ba7:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803ba9:	48 b8 1e 3b 80 00 00 	movabs $0x803b1e,%rax
+  803bb0:	00 00 00 
+  803bb3:	ff d0                	call   *%rax
+  803bb5:	89 c7                	mov    %eax,%edi
+  803bb7:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803bbb:	89 de                	mov    %ebx,%esi
+  803bbd:	48 b8 5b 62 80 00 00 	movabs $0x80625b,%rax
+  803bc4:	00 00 00 
+  803bc7:	ff d0                	call   *%rax
+}
+  803bc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bcd:	c9                   	leave
+  803bce:	c3                   	ret
+    assert(size <= sizeof(words));
+  803bcf:	48 b9 20 70 80 00 00 	movabs $0x807020,%rcx
+  803bd6:	00 00 00 
+  803bd9:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  803be0:	00 00 00 
+  803be3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803be8:	48 bf 4b 70 80 00 00 	movabs $0x80704b,%rdi
+  803bef:	00 00 00 
+  803bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf7:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  803bfe:	00 00 00 
+  803c01:	41 ff d0             	call   *%r8
+
+0000000000803c04 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803c04:	55                   	push   %rbp
+  803c05:	48 89 e5             	mov    %rsp,%rbp
+  803c08:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803c0c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c0f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803c12:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803c15:	ba 08 00 00 00       	mov    $0x8,%edx
+  803c1a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c1e:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c23:	48 b8 60 3b 80 00 00 	movabs $0x803b60,%rax
+  803c2a:	00 00 00 
+  803c2d:	ff d0                	call   *%rax
+}
+  803c2f:	c9                   	leave
+  803c30:	c3                   	ret
+
+0000000000803c31 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803c31:	55                   	push   %rbp
+  803c32:	48 89 e5             	mov    %rsp,%rbp
+  803c35:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803c39:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c3c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803c3f:	ba 04 00 00 00       	mov    $0x4,%edx
+  803c44:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803c48:	bf 06 00 00 00       	mov    $0x6,%edi
+  803c4d:	48 b8 60 3b 80 00 00 	movabs $0x803b60,%rax
+  803c54:	00 00 00 
+  803c57:	ff d0                	call   *%rax
+}
+  803c59:	c9                   	leave
+  803c5a:	c3                   	ret
+
+0000000000803c5b <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803c5b:	55                   	push   %rbp
+  803c5c:	48 89 e5             	mov    %rsp,%rbp
+  803c5f:	41 54                	push   %r12
+  803c61:	53                   	push   %rbx
+  803c62:	48 83 ec 10          	sub    $0x10,%rsp
+  803c66:	89 fb                	mov    %edi,%ebx
+  803c68:	49 89 f4             	mov    %rsi,%r12
+  803c6b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803c6f:	48 b8 1e 3b 80 00 00 	movabs $0x803b1e,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+  803c7b:	89 c7                	mov    %eax,%edi
+  803c7d:	6a 00                	push   $0x0
+  803c7f:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803c83:	50                   	push   %rax
+  803c84:	4d 89 e1             	mov    %r12,%r9
+  803c87:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803c8d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c92:	48 ba 00 c0 80 01 00 	movabs $0x180c000,%rdx
+  803c99:	00 00 00 
+  803c9c:	89 de                	mov    %ebx,%esi
+  803c9e:	48 b8 f6 61 80 00 00 	movabs $0x8061f6,%rax
+  803ca5:	00 00 00 
+  803ca8:	ff d0                	call   *%rax
+}
+  803caa:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803cae:	5b                   	pop    %rbx
+  803caf:	41 5c                	pop    %r12
+  803cb1:	5d                   	pop    %rbp
+  803cb2:	c3                   	ret
+
+0000000000803cb3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803cb3:	55                   	push   %rbp
+  803cb4:	48 89 e5             	mov    %rsp,%rbp
+  803cb7:	41 54                	push   %r12
+  803cb9:	53                   	push   %rbx
+  803cba:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803cbd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803cc0:	a3 00 c0 80 01 00 00 	movabs %eax,0x180c000
+  803cc7:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803cc9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cce:	be 00 00 00 00       	mov    $0x0,%esi
+  803cd3:	bf 05 00 00 00       	mov    $0x5,%edi
+  803cd8:	48 b8 5b 3c 80 00 00 	movabs $0x803c5b,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ce4:	85 c0                	test   %eax,%eax
+  803ce6:	78 5a                	js     803d42 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803ce8:	49 bc 00 c0 80 01 00 	movabs $0x180c000,%r12
+  803cef:	00 00 00 
+  803cf2:	4c 89 e6             	mov    %r12,%rsi
+  803cf5:	48 89 df             	mov    %rbx,%rdi
+  803cf8:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  803cff:	00 00 00 
+  803d02:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803d04:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803d0b:	00 
+  803d0c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d12:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803d19:	00 
+  803d1a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803d20:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803d27:	00 
+  803d28:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803d2f:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803d36:	00 
+  803d37:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d42:	5b                   	pop    %rbx
+  803d43:	41 5c                	pop    %r12
+  803d45:	5d                   	pop    %rbp
+  803d46:	c3                   	ret
+
+0000000000803d47 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803d47:	55                   	push   %rbp
+  803d48:	48 89 e5             	mov    %rsp,%rbp
+  803d4b:	41 57                	push   %r15
+  803d4d:	41 56                	push   %r14
+  803d4f:	41 55                	push   %r13
+  803d51:	41 54                	push   %r12
+  803d53:	53                   	push   %rbx
+  803d54:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803d58:	48 85 ff             	test   %rdi,%rdi
+  803d5b:	0f 84 a1 00 00 00    	je     803e02 <devfile_read+0xbb>
+  803d61:	49 89 ff             	mov    %rdi,%r15
+  803d64:	49 89 f5             	mov    %rsi,%r13
+  803d67:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803d6a:	48 85 f6             	test   %rsi,%rsi
+  803d6d:	0f 84 c4 00 00 00    	je     803e37 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803d73:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803d7a:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803d7b:	49 be 00 c0 80 01 00 	movabs $0x180c000,%r14
+  803d82:	00 00 00 
+  803d85:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d89:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803d8c:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d95:	be 00 00 00 00       	mov    $0x0,%esi
+  803d9a:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d9f:	48 b8 5b 3c 80 00 00 	movabs $0x803c5b,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+        if (res < 0) {
+  803dab:	85 c0                	test   %eax,%eax
+  803dad:	0f 88 b9 00 00 00    	js     803e6c <devfile_read+0x125>
+        assert(res <= n);
+  803db3:	48 63 d8             	movslq %eax,%rbx
+  803db6:	49 39 dc             	cmp    %rbx,%r12
+  803db9:	0f 82 b1 00 00 00    	jb     803e70 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803dbf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803dc4:	0f 87 db 00 00 00    	ja     803ea5 <devfile_read+0x15e>
+        if (!res) {
+  803dca:	85 c0                	test   %eax,%eax
+  803dcc:	74 21                	je     803def <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803dce:	48 89 da             	mov    %rbx,%rdx
+  803dd1:	4c 89 f6             	mov    %r14,%rsi
+  803dd4:	4c 89 ef             	mov    %r13,%rdi
+  803dd7:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  803dde:	00 00 00 
+  803de1:	ff d0                	call   *%rax
+        total_read += res;
+  803de3:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803de7:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803dea:	49 29 dc             	sub    %rbx,%r12
+  803ded:	75 96                	jne    803d85 <devfile_read+0x3e>
+    return total_read;
+  803def:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803df3:	48 83 c4 18          	add    $0x18,%rsp
+  803df7:	5b                   	pop    %rbx
+  803df8:	41 5c                	pop    %r12
+  803dfa:	41 5d                	pop    %r13
+  803dfc:	41 5e                	pop    %r14
+  803dfe:	41 5f                	pop    %r15
+  803e00:	5d                   	pop    %rbp
+  803e01:	c3                   	ret
+    assert(fd);
+  803e02:	48 b9 56 70 80 00 00 	movabs $0x807056,%rcx
+  803e09:	00 00 00 
+  803e0c:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  803e13:	00 00 00 
+  803e16:	be 91 00 00 00       	mov    $0x91,%esi
+  803e1b:	48 bf 4b 70 80 00 00 	movabs $0x80704b,%rdi
+  803e22:	00 00 00 
+  803e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2a:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  803e31:	00 00 00 
+  803e34:	41 ff d0             	call   *%r8
+    assert(buf);
+  803e37:	48 b9 59 70 80 00 00 	movabs $0x807059,%rcx
+  803e3e:	00 00 00 
+  803e41:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  803e48:	00 00 00 
+  803e4b:	be 92 00 00 00       	mov    $0x92,%esi
+  803e50:	48 bf 4b 70 80 00 00 	movabs $0x80704b,%rdi
+  803e57:	00 00 00 
+  803e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5f:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  803e66:	00 00 00 
+  803e69:	41 ff d0             	call   *%r8
+            return res;
+  803e6c:	48 98                	cltq
+  803e6e:	eb 83                	jmp    803df3 <devfile_read+0xac>
+        assert(res <= n);
+  803e70:	48 b9 5d 70 80 00 00 	movabs $0x80705d,%rcx
+  803e77:	00 00 00 
+  803e7a:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  803e81:	00 00 00 
+  803e84:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803e89:	48 bf 4b 70 80 00 00 	movabs $0x80704b,%rdi
+  803e90:	00 00 00 
+  803e93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e98:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  803e9f:	00 00 00 
+  803ea2:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803ea5:	48 b9 68 70 80 00 00 	movabs $0x807068,%rcx
+  803eac:	00 00 00 
+  803eaf:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  803eb6:	00 00 00 
+  803eb9:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803ebe:	48 bf 4b 70 80 00 00 	movabs $0x80704b,%rdi
+  803ec5:	00 00 00 
+  803ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecd:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  803ed4:	00 00 00 
+  803ed7:	41 ff d0             	call   *%r8
+
+0000000000803eda <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803eda:	55                   	push   %rbp
+  803edb:	48 89 e5             	mov    %rsp,%rbp
+  803ede:	41 57                	push   %r15
+  803ee0:	41 56                	push   %r14
+  803ee2:	41 55                	push   %r13
+  803ee4:	41 54                	push   %r12
+  803ee6:	53                   	push   %rbx
+  803ee7:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803eeb:	48 85 ff             	test   %rdi,%rdi
+  803eee:	0f 84 83 00 00 00    	je     803f77 <devfile_write+0x9d>
+  803ef4:	49 89 ff             	mov    %rdi,%r15
+  803ef7:	49 89 f4             	mov    %rsi,%r12
+  803efa:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803efd:	48 85 f6             	test   %rsi,%rsi
+  803f00:	0f 84 a6 00 00 00    	je     803fac <devfile_write+0xd2>
+    size_t total_written = 0;
+  803f06:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803f0c:	49 be 00 c0 80 01 00 	movabs $0x180c000,%r14
+  803f13:	00 00 00 
+  803f16:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f1a:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803f1d:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803f21:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803f26:	48 39 d3             	cmp    %rdx,%rbx
+  803f29:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803f2d:	4c 89 e6             	mov    %r12,%rsi
+  803f30:	48 bf 10 c0 80 01 00 	movabs $0x180c010,%rdi
+  803f37:	00 00 00 
+  803f3a:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  803f41:	00 00 00 
+  803f44:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f4b:	be 00 00 00 00       	mov    $0x0,%esi
+  803f50:	bf 04 00 00 00       	mov    $0x4,%edi
+  803f55:	48 b8 5b 3c 80 00 00 	movabs $0x803c5b,%rax
+  803f5c:	00 00 00 
+  803f5f:	ff d0                	call   *%rax
+        if (res < 0) {
+  803f61:	85 c0                	test   %eax,%eax
+  803f63:	78 7c                	js     803fe1 <devfile_write+0x107>
+        total_written += res;
+  803f65:	48 98                	cltq
+  803f67:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803f6a:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803f6d:	48 29 c3             	sub    %rax,%rbx
+  803f70:	75 a4                	jne    803f16 <devfile_write+0x3c>
+    return total_written;
+  803f72:	4c 89 e8             	mov    %r13,%rax
+  803f75:	eb 6c                	jmp    803fe3 <devfile_write+0x109>
+    assert(fd);
+  803f77:	48 b9 56 70 80 00 00 	movabs $0x807056,%rcx
+  803f7e:	00 00 00 
+  803f81:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  803f88:	00 00 00 
+  803f8b:	be bd 00 00 00       	mov    $0xbd,%esi
+  803f90:	48 bf 4b 70 80 00 00 	movabs $0x80704b,%rdi
+  803f97:	00 00 00 
+  803f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9f:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  803fa6:	00 00 00 
+  803fa9:	41 ff d0             	call   *%r8
+    assert(buf);
+  803fac:	48 b9 59 70 80 00 00 	movabs $0x807059,%rcx
+  803fb3:	00 00 00 
+  803fb6:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  803fbd:	00 00 00 
+  803fc0:	be be 00 00 00       	mov    $0xbe,%esi
+  803fc5:	48 bf 4b 70 80 00 00 	movabs $0x80704b,%rdi
+  803fcc:	00 00 00 
+  803fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd4:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  803fdb:	00 00 00 
+  803fde:	41 ff d0             	call   *%r8
+            return res;
+  803fe1:	48 98                	cltq
+}
+  803fe3:	48 83 c4 08          	add    $0x8,%rsp
+  803fe7:	5b                   	pop    %rbx
+  803fe8:	41 5c                	pop    %r12
+  803fea:	41 5d                	pop    %r13
+  803fec:	41 5e                	pop    %r14
+  803fee:	41 5f                	pop    %r15
+  803ff0:	5d                   	pop    %rbp
+  803ff1:	c3                   	ret
+
+0000000000803ff2 <open>:
+open(const char *path, int mode) {
+  803ff2:	55                   	push   %rbp
+  803ff3:	48 89 e5             	mov    %rsp,%rbp
+  803ff6:	41 55                	push   %r13
+  803ff8:	41 54                	push   %r12
+  803ffa:	53                   	push   %rbx
+  803ffb:	48 83 ec 18          	sub    $0x18,%rsp
+  803fff:	49 89 fc             	mov    %rdi,%r12
+  804002:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  804005:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  80400c:	00 00 00 
+  80400f:	ff d0                	call   *%rax
+  804011:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804017:	0f 87 8f 00 00 00    	ja     8040ac <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80401d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804021:	48 b8 17 34 80 00 00 	movabs $0x803417,%rax
+  804028:	00 00 00 
+  80402b:	ff d0                	call   *%rax
+  80402d:	89 c3                	mov    %eax,%ebx
+  80402f:	85 c0                	test   %eax,%eax
+  804031:	78 55                	js     804088 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  804033:	4c 89 e6             	mov    %r12,%rsi
+  804036:	48 bb 00 c0 80 01 00 	movabs $0x180c000,%rbx
+  80403d:	00 00 00 
+  804040:	48 89 df             	mov    %rbx,%rdi
+  804043:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  80404a:	00 00 00 
+  80404d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80404f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804056:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80405b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80405f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804064:	48 b8 5b 3c 80 00 00 	movabs $0x803c5b,%rax
+  80406b:	00 00 00 
+  80406e:	ff d0                	call   *%rax
+  804070:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804072:	85 c0                	test   %eax,%eax
+  804074:	78 1f                	js     804095 <open+0xa3>
+    return fd2num(fd);
+  804076:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80407a:	48 b8 e9 33 80 00 00 	movabs $0x8033e9,%rax
+  804081:	00 00 00 
+  804084:	ff d0                	call   *%rax
+  804086:	89 c3                	mov    %eax,%ebx
+}
+  804088:	89 d8                	mov    %ebx,%eax
+  80408a:	48 83 c4 18          	add    $0x18,%rsp
+  80408e:	5b                   	pop    %rbx
+  80408f:	41 5c                	pop    %r12
+  804091:	41 5d                	pop    %r13
+  804093:	5d                   	pop    %rbp
+  804094:	c3                   	ret
+        fd_close(fd, 0);
+  804095:	be 00 00 00 00       	mov    $0x0,%esi
+  80409a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80409e:	48 b8 32 35 80 00 00 	movabs $0x803532,%rax
+  8040a5:	00 00 00 
+  8040a8:	ff d0                	call   *%rax
+        return res;
+  8040aa:	eb dc                	jmp    804088 <open+0x96>
+        return -E_BAD_PATH;
+  8040ac:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8040b1:	eb d5                	jmp    804088 <open+0x96>
+
+00000000008040b3 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8040b3:	55                   	push   %rbp
+  8040b4:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  8040b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8040c1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8040c6:	48 b8 60 3b 80 00 00 	movabs $0x803b60,%rax
+  8040cd:	00 00 00 
+  8040d0:	ff d0                	call   *%rax
+}
+  8040d2:	5d                   	pop    %rbp
+  8040d3:	c3                   	ret
+
+00000000008040d4 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  8040d4:	55                   	push   %rbp
+  8040d5:	48 89 e5             	mov    %rsp,%rbp
+  8040d8:	41 56                	push   %r14
+  8040da:	41 55                	push   %r13
+  8040dc:	41 54                	push   %r12
+  8040de:	53                   	push   %rbx
+  8040df:	48 83 ec 10          	sub    $0x10,%rsp
+  8040e3:	41 89 f6             	mov    %esi,%r14d
+  8040e6:	49 89 d4             	mov    %rdx,%r12
+  8040e9:	48 89 cb             	mov    %rcx,%rbx
+  8040ec:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8040ef:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040f3:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  8040fa:	00 00 00 
+  8040fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040ff:	85 c0                	test   %eax,%eax
+  804101:	78 46                	js     804149 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804103:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804107:	48 b8 00 98 80 00 00 	movabs $0x809800,%rax
+  80410e:	00 00 00 
+  804111:	8b 00                	mov    (%rax),%eax
+  804113:	39 02                	cmp    %eax,(%rdx)
+  804115:	75 3f                	jne    804156 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804117:	48 b8 00 c0 80 01 00 	movabs $0x180c000,%rax
+  80411e:	00 00 00 
+  804121:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804124:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804126:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80412a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  80412e:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804132:	48 89 da             	mov    %rbx,%rdx
+  804135:	4c 89 e6             	mov    %r12,%rsi
+  804138:	bf 09 00 00 00       	mov    $0x9,%edi
+  80413d:	48 b8 5b 3c 80 00 00 	movabs $0x803c5b,%rax
+  804144:	00 00 00 
+  804147:	ff d0                	call   *%rax
+}
+  804149:	48 83 c4 10          	add    $0x10,%rsp
+  80414d:	5b                   	pop    %rbx
+  80414e:	41 5c                	pop    %r12
+  804150:	41 5d                	pop    %r13
+  804152:	41 5e                	pop    %r14
+  804154:	5d                   	pop    %rbp
+  804155:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804156:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80415b:	eb ec                	jmp    804149 <file_map+0x75>
+
+000000000080415d <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80415d:	55                   	push   %rbp
+  80415e:	48 89 e5             	mov    %rsp,%rbp
+  804161:	41 54                	push   %r12
+  804163:	53                   	push   %rbx
+  804164:	48 83 ec 20          	sub    $0x20,%rsp
+  804168:	41 89 f4             	mov    %esi,%r12d
+  80416b:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80416e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804172:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  804179:	00 00 00 
+  80417c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80417e:	85 c0                	test   %eax,%eax
+  804180:	78 3c                	js     8041be <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804182:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804186:	48 ba 00 98 80 00 00 	movabs $0x809800,%rdx
+  80418d:	00 00 00 
+  804190:	8b 0a                	mov    (%rdx),%ecx
+  804192:	39 08                	cmp    %ecx,(%rax)
+  804194:	75 31                	jne    8041c7 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804196:	8b 40 0c             	mov    0xc(%rax),%eax
+  804199:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80419c:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8041a0:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8041a4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8041a9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8041ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8041b2:	48 b8 60 3b 80 00 00 	movabs $0x803b60,%rax
+  8041b9:	00 00 00 
+  8041bc:	ff d0                	call   *%rax
+}
+  8041be:	48 83 c4 20          	add    $0x20,%rsp
+  8041c2:	5b                   	pop    %rbx
+  8041c3:	41 5c                	pop    %r12
+  8041c5:	5d                   	pop    %rbp
+  8041c6:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8041c7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8041cc:	eb f0                	jmp    8041be <file_msync+0x61>
+
+00000000008041ce <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8041ce:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8041d2:	7f 01                	jg     8041d5 <writebuf+0x7>
+  8041d4:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8041d5:	55                   	push   %rbp
+  8041d6:	48 89 e5             	mov    %rsp,%rbp
+  8041d9:	53                   	push   %rbx
+  8041da:	48 83 ec 08          	sub    $0x8,%rsp
+  8041de:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8041e1:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8041e5:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8041e9:	8b 3f                	mov    (%rdi),%edi
+  8041eb:	48 b8 89 38 80 00 00 	movabs $0x803889,%rax
+  8041f2:	00 00 00 
+  8041f5:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8041f7:	48 85 c0             	test   %rax,%rax
+  8041fa:	7e 04                	jle    804200 <writebuf+0x32>
+  8041fc:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804200:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804204:	48 39 c2             	cmp    %rax,%rdx
+  804207:	74 0f                	je     804218 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804209:	48 85 c0             	test   %rax,%rax
+  80420c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804211:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804215:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804218:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80421c:	c9                   	leave
+  80421d:	c3                   	ret
+
+000000000080421e <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80421e:	8b 46 04             	mov    0x4(%rsi),%eax
+  804221:	8d 50 01             	lea    0x1(%rax),%edx
+  804224:	89 56 04             	mov    %edx,0x4(%rsi)
+  804227:	48 98                	cltq
+  804229:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80422e:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804234:	74 01                	je     804237 <putch+0x19>
+  804236:	c3                   	ret
+putch(int ch, void *arg) {
+  804237:	55                   	push   %rbp
+  804238:	48 89 e5             	mov    %rsp,%rbp
+  80423b:	53                   	push   %rbx
+  80423c:	48 83 ec 08          	sub    $0x8,%rsp
+  804240:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804243:	48 89 f7             	mov    %rsi,%rdi
+  804246:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  80424d:	00 00 00 
+  804250:	ff d0                	call   *%rax
+        state->offset = 0;
+  804252:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804259:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80425d:	c9                   	leave
+  80425e:	c3                   	ret
+
+000000000080425f <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80425f:	55                   	push   %rbp
+  804260:	48 89 e5             	mov    %rsp,%rbp
+  804263:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80426a:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80426d:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804273:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80427a:	00 00 00 
+    state.result = 0;
+  80427d:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804284:	00 00 00 00 
+    state.error = 1;
+  804288:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80428f:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804292:	48 89 f2             	mov    %rsi,%rdx
+  804295:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80429c:	48 bf 1e 42 80 00 00 	movabs $0x80421e,%rdi
+  8042a3:	00 00 00 
+  8042a6:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  8042ad:	00 00 00 
+  8042b0:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8042b2:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8042b9:	7f 14                	jg     8042cf <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8042bb:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8042c2:	48 85 c0             	test   %rax,%rax
+  8042c5:	75 06                	jne    8042cd <vfprintf+0x6e>
+  8042c7:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8042cd:	c9                   	leave
+  8042ce:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8042cf:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8042d6:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  8042dd:	00 00 00 
+  8042e0:	ff d0                	call   *%rax
+  8042e2:	eb d7                	jmp    8042bb <vfprintf+0x5c>
+
+00000000008042e4 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8042e4:	55                   	push   %rbp
+  8042e5:	48 89 e5             	mov    %rsp,%rbp
+  8042e8:	48 83 ec 50          	sub    $0x50,%rsp
+  8042ec:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042f4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042f8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8042fc:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804303:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804307:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80430b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80430f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804313:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804317:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  80431e:	00 00 00 
+  804321:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804323:	c9                   	leave
+  804324:	c3                   	ret
+
+0000000000804325 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804325:	55                   	push   %rbp
+  804326:	48 89 e5             	mov    %rsp,%rbp
+  804329:	48 83 ec 50          	sub    $0x50,%rsp
+  80432d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804331:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804335:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804339:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80433d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804341:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804348:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80434c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804350:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804354:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804358:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80435c:	48 89 fe             	mov    %rdi,%rsi
+  80435f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804364:	48 b8 5f 42 80 00 00 	movabs $0x80425f,%rax
+  80436b:	00 00 00 
+  80436e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804370:	c9                   	leave
+  804371:	c3                   	ret
+
+0000000000804372 <collect_shared_region>:
+    return 0;
+}
+
+/* Append shared region to SharedList arg merging adjacent regions */
+static int
+collect_shared_region(void *start, void *end, void *arg) {
+  804372:	55                   	push   %rbp
+  804373:	48 89 e5             	mov    %rsp,%rbp
+  804376:	41 55                	push   %r13
+  804378:	41 54                	push   %r12
+  80437a:	53                   	push   %rbx
+  80437b:	48 83 ec 08          	sub    $0x8,%rsp
+  80437f:	48 89 fb             	mov    %rdi,%rbx
+  804382:	49 89 f5             	mov    %rsi,%r13
+  804385:	49 89 d4             	mov    %rdx,%r12
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+  804388:	48 b8 ab 52 80 00 00 	movabs $0x8052ab,%rax
+  80438f:	00 00 00 
+  804392:	ff d0                	call   *%rax
+  804394:	89 c1                	mov    %eax,%ecx
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+  804396:	48 b8 00 00 00 00 d0 	movabs $0xffffffd000000000,%rax
+  80439d:	ff ff ff 
+  8043a0:	48 01 d8             	add    %rbx,%rax
+  8043a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043a8:	48 c1 e8 24          	shr    $0x24,%rax
+  8043ac:	74 5c                	je     80440a <collect_shared_region+0x98>
+
+    if (list->count) {
+  8043ae:	49 8b 84 24 00 18 00 	mov    0x1800(%r12),%rax
+  8043b5:	00 
+  8043b6:	48 85 c0             	test   %rax,%rax
+  8043b9:	74 20                	je     8043db <collect_shared_region+0x69>
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  8043bb:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8043bf:	49 8d 14 d4          	lea    (%r12,%rdx,8),%rdx
+  8043c3:	48 8b 72 f0          	mov    -0x10(%rdx),%rsi
+  8043c7:	48 89 f7             	mov    %rsi,%rdi
+  8043ca:	48 03 7a e8          	add    -0x18(%rdx),%rdi
+  8043ce:	48 39 fb             	cmp    %rdi,%rbx
+  8043d1:	74 44                	je     804417 <collect_shared_region+0xa5>
+            last->size += end - start;
+            return 0;
+        }
+    }
+
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  8043d3:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8043d9:	74 59                	je     804434 <collect_shared_region+0xc2>
+    list->regions[list->count++] = (struct SpawnRegion){
+  8043db:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8043df:	49 89 94 24 00 18 00 	mov    %rdx,0x1800(%r12)
+  8043e6:	00 
+  8043e7:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  8043eb:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8043ef:	49 8d 34 f4          	lea    (%r12,%rsi,8),%rsi
+  8043f3:	48 89 1e             	mov    %rbx,(%rsi)
+            .start = (uintptr_t)start,
+            .size = end - start,
+  8043f6:	49 29 dd             	sub    %rbx,%r13
+  8043f9:	4c 89 6e 08          	mov    %r13,0x8(%rsi)
+    list->regions[list->count++] = (struct SpawnRegion){
+  8043fd:	48 01 c2             	add    %rax,%rdx
+  804400:	41 89 4c d4 10       	mov    %ecx,0x10(%r12,%rdx,8)
+            .prot = prot};
+    return 0;
+  804405:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80440a:	89 d0                	mov    %edx,%eax
+  80440c:	48 83 c4 08          	add    $0x8,%rsp
+  804410:	5b                   	pop    %rbx
+  804411:	41 5c                	pop    %r12
+  804413:	41 5d                	pop    %r13
+  804415:	5d                   	pop    %rbp
+  804416:	c3                   	ret
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  804417:	48 8d 7c 40 fd       	lea    -0x3(%rax,%rax,2),%rdi
+  80441c:	41 39 4c fc 10       	cmp    %ecx,0x10(%r12,%rdi,8)
+  804421:	75 b0                	jne    8043d3 <collect_shared_region+0x61>
+            last->size += end - start;
+  804423:	49 29 dd             	sub    %rbx,%r13
+  804426:	49 01 f5             	add    %rsi,%r13
+  804429:	4c 89 6a f0          	mov    %r13,-0x10(%rdx)
+            return 0;
+  80442d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804432:	eb d6                	jmp    80440a <collect_shared_region+0x98>
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804434:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+  804439:	eb cf                	jmp    80440a <collect_shared_region+0x98>
+
+000000000080443b <spawn>:
+spawn(const char *prog, const char **argv) {
+  80443b:	55                   	push   %rbp
+  80443c:	48 89 e5             	mov    %rsp,%rbp
+  80443f:	41 57                	push   %r15
+  804441:	41 56                	push   %r14
+  804443:	41 55                	push   %r13
+  804445:	41 54                	push   %r12
+  804447:	53                   	push   %rbx
+  804448:	48 81 ec 18 05 00 00 	sub    $0x518,%rsp
+  80444f:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  804452:	be 00 00 00 00       	mov    $0x0,%esi
+  804457:	48 b8 f2 3f 80 00 00 	movabs $0x803ff2,%rax
+  80445e:	00 00 00 
+  804461:	ff d0                	call   *%rax
+  804463:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) return fd;
+  804466:	85 c0                	test   %eax,%eax
+  804468:	0f 88 8f 06 00 00    	js     804afd <spawn+0x6c2>
+    struct SpawnImage img = {
+  80446e:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  804475:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80447a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80447f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804482:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  804489:	00 00 00 
+  80448c:	48 89 85 00 fd ff ff 	mov    %rax,-0x300(%rbp)
+  804493:	48 b8 20 d0 80 01 00 	movabs $0x180d020,%rax
+  80449a:	00 00 00 
+  80449d:	48 89 85 20 fd ff ff 	mov    %rax,-0x2e0(%rbp)
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+  8044a4:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  8044ab:	44 89 f7             	mov    %r14d,%edi
+  8044ae:	48 b8 3c 3a 80 00 00 	movabs $0x803a3c,%rax
+  8044b5:	00 00 00 
+  8044b8:	ff d0                	call   *%rax
+  8044ba:	41 89 c4             	mov    %eax,%r12d
+  8044bd:	85 c0                	test   %eax,%eax
+  8044bf:	0f 88 26 06 00 00    	js     804aeb <spawn+0x6b0>
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+  8044c5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8044cc:	48 85 c0             	test   %rax,%rax
+  8044cf:	74 22                	je     8044f3 <spawn+0xb8>
+  8044d1:	48 63 95 b0 fd ff ff 	movslq -0x250(%rbp),%rdx
+  8044d8:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+  8044df:	48 89 95 e8 fc ff ff 	mov    %rdx,-0x318(%rbp)
+  8044e6:	8b 85 c0 fd ff ff    	mov    -0x240(%rbp),%eax
+  8044ec:	48 89 85 f0 fc ff ff 	mov    %rax,-0x310(%rbp)
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+  8044f3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8044f8:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8044fd:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  804504:	00 00 00 
+  804507:	bf 00 00 00 00       	mov    $0x0,%edi
+  80450c:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  804513:	00 00 00 
+  804516:	ff d0                	call   *%rax
+  804518:	41 89 c4             	mov    %eax,%r12d
+  80451b:	85 c0                	test   %eax,%eax
+  80451d:	0f 88 c8 05 00 00    	js     804aeb <spawn+0x6b0>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804523:	48 8b 3b             	mov    (%rbx),%rdi
+  804526:	48 85 ff             	test   %rdi,%rdi
+  804529:	0f 84 61 02 00 00    	je     804790 <spawn+0x355>
+  80452f:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  804535:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  80453b:	49 bf e8 25 80 00 00 	movabs $0x8025e8,%r15
+  804542:	00 00 00 
+  804545:	41 ff d7             	call   *%r15
+  804548:	4d 8d 6c 05 01       	lea    0x1(%r13,%rax,1),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  80454d:	4c 89 a5 d8 fa ff ff 	mov    %r12,-0x528(%rbp)
+  804554:	49 83 c4 01          	add    $0x1,%r12
+  804558:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  80455d:	48 85 ff             	test   %rdi,%rdi
+  804560:	75 e3                	jne    804545 <spawn+0x10a>
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  804562:	41 bc 00 00 01 00    	mov    $0x10000,%r12d
+  804568:	4d 29 ec             	sub    %r13,%r12
+  80456b:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  804572:	00 00 00 
+  804575:	49 01 c4             	add    %rax,%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804578:	4c 89 e1             	mov    %r12,%rcx
+  80457b:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  80457f:	48 89 8d d0 fa ff ff 	mov    %rcx,-0x530(%rbp)
+  804586:	48 8b b5 d8 fa ff ff 	mov    -0x528(%rbp),%rsi
+  80458d:	89 f0                	mov    %esi,%eax
+  80458f:	83 c0 01             	add    $0x1,%eax
+  804592:	48 98                	cltq
+  804594:	48 c1 e0 03          	shl    $0x3,%rax
+  804598:	48 29 c1             	sub    %rax,%rcx
+  80459b:	48 89 8d c8 fa ff ff 	mov    %rcx,-0x538(%rbp)
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  8045a2:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  8045a6:	48 ba ff ff ff ff 5f 	movabs $0x5fffffffff,%rdx
+  8045ad:	00 00 00 
+  8045b0:	48 39 c2             	cmp    %rax,%rdx
+  8045b3:	0f 83 f2 04 00 00    	jae    804aab <spawn+0x670>
+    for (i = 0; i < argc; i++) {
+  8045b9:	85 f6                	test   %esi,%esi
+  8045bb:	7e 4e                	jle    80460b <spawn+0x1d0>
+  8045bd:	49 89 cd             	mov    %rcx,%r13
+  8045c0:	48 63 c6             	movslq %esi,%rax
+  8045c3:	4c 8d 3c c1          	lea    (%rcx,%rax,8),%r15
+        argv_store[i] = STAGE2USTACK(string_store, stack);
+  8045c7:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  8045ce:	00 00 00 
+  8045d1:	4c 01 e0             	add    %r12,%rax
+  8045d4:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8045d8:	48 8b 33             	mov    (%rbx),%rsi
+  8045db:	4c 89 e7             	mov    %r12,%rdi
+  8045de:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  8045e5:	00 00 00 
+  8045e8:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8045ea:	48 8b 3b             	mov    (%rbx),%rdi
+  8045ed:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  8045f4:	00 00 00 
+  8045f7:	ff d0                	call   *%rax
+  8045f9:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  8045fe:	49 83 c5 08          	add    $0x8,%r13
+  804602:	48 83 c3 08          	add    $0x8,%rbx
+  804606:	4d 39 fd             	cmp    %r15,%r13
+  804609:	75 bc                	jne    8045c7 <spawn+0x18c>
+    argv_store[argc] = 0;
+  80460b:	48 8b 85 d0 fa ff ff 	mov    -0x530(%rbp),%rax
+  804612:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  804619:	00 
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  80461a:	48 b8 00 00 01 00 60 	movabs $0x6000010000,%rax
+  804621:	00 00 00 
+  804624:	49 39 c4             	cmp    %rax,%r12
+  804627:	0f 85 92 01 00 00    	jne    8047bf <spawn+0x384>
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
+  80462d:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804634:	00 00 00 
+  804637:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  80463e:	48 01 d0             	add    %rdx,%rax
+  804641:	48 89 42 f8          	mov    %rax,-0x8(%rdx)
+    argv_store[-2] = argc;
+  804645:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  80464c:	48 89 42 f0          	mov    %rax,-0x10(%rdx)
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+  804650:	48 b8 f0 6f fe ff 1f 	movabs $0x1ffffe6ff0,%rax
+  804657:	00 00 00 
+  80465a:	48 01 d0             	add    %rdx,%rax
+  80465d:	48 89 85 08 fd ff ff 	mov    %rax,-0x2f8(%rbp)
+    shared.count = 0;
+  804664:	48 be 20 d0 80 01 00 	movabs $0x180d020,%rsi
+  80466b:	00 00 00 
+  80466e:	48 c7 86 00 18 00 00 	movq   $0x0,0x1800(%rsi)
+  804675:	00 00 00 00 
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+  804679:	48 bf 72 43 80 00 00 	movabs $0x804372,%rdi
+  804680:	00 00 00 
+  804683:	48 b8 1f 53 80 00 00 	movabs $0x80531f,%rax
+  80468a:	00 00 00 
+  80468d:	ff d0                	call   *%rax
+  80468f:	41 89 c4             	mov    %eax,%r12d
+  804692:	85 c0                	test   %eax,%eax
+  804694:	0f 88 24 04 00 00    	js     804abe <spawn+0x683>
+    img.nshared = shared.count;
+  80469a:	48 a1 20 e8 80 01 00 	movabs 0x180e820,%rax
+  8046a1:	00 00 00 
+  8046a4:	48 89 85 28 fd ff ff 	mov    %rax,-0x2d8(%rbp)
+    if (img.key.size) {
+  8046ab:	48 83 bd e8 fc ff ff 	cmpq   $0x0,-0x318(%rbp)
+  8046b2:	00 
+  8046b3:	74 1f                	je     8046d4 <spawn+0x299>
+        res = sys_spawn(&img);
+  8046b5:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  8046bc:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  8046c3:	00 00 00 
+  8046c6:	ff d0                	call   *%rax
+  8046c8:	41 89 c4             	mov    %eax,%r12d
+        if (res != -E_NOT_FOUND) goto done;
+  8046cb:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8046ce:	0f 85 ca 03 00 00    	jne    804a9e <spawn+0x663>
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8046d4:	ba 00 02 00 00       	mov    $0x200,%edx
+  8046d9:	48 8d b5 e0 fa ff ff 	lea    -0x520(%rbp),%rsi
+  8046e0:	44 89 f7             	mov    %r14d,%edi
+  8046e3:	48 b8 18 38 80 00 00 	movabs $0x803818,%rax
+  8046ea:	00 00 00 
+  8046ed:	ff d0                	call   *%rax
+  8046ef:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8046f1:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8046f6:	0f 85 f8 00 00 00    	jne    8047f4 <spawn+0x3b9>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8046fc:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  804703:	ff ff 00 
+  804706:	48 23 85 e0 fa ff ff 	and    -0x520(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80470d:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  804714:	01 01 00 
+  804717:	48 39 d0             	cmp    %rdx,%rax
+  80471a:	0f 85 f7 00 00 00    	jne    804817 <spawn+0x3dc>
+        elf->e_type != ET_EXEC /* executable */ ||
+  804720:	81 bd f0 fa ff ff 02 	cmpl   $0x3e0002,-0x510(%rbp)
+  804727:	00 3e 00 
+  80472a:	0f 85 e7 00 00 00    	jne    804817 <spawn+0x3dc>
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
+  804730:	48 8b 95 00 fb ff ff 	mov    -0x500(%rbp),%rdx
+  804737:	44 0f b7 85 18 fb ff 	movzwl -0x4e8(%rbp),%r8d
+  80473e:	ff 
+  80473f:	4a 8d 04 c5 00 00 00 	lea    0x0(,%r8,8),%rax
+  804746:	00 
+  804747:	4c 29 c0             	sub    %r8,%rax
+  80474a:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+        elf->e_machine != 0x3E /* amd64 */ ||
+  80474e:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  804754:	0f 87 bd 00 00 00    	ja     804817 <spawn+0x3dc>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80475a:	48 8d 84 15 e0 fa ff 	lea    -0x520(%rbp,%rdx,1),%rax
+  804761:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804762:	4d 85 c0             	test   %r8,%r8
+  804765:	0f 84 1b 02 00 00    	je     804986 <spawn+0x54b>
+  80476b:	ba 00 00 00 00       	mov    $0x0,%edx
+    size_t nsegs = 0, start = *staged, end = start;
+  804770:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804777:	00 00 01 00 
+  80477b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  804781:	49 ba 00 00 00 00 60 	movabs $0x6000000000,%r10
+  804788:	00 00 00 
+  80478b:	e9 d4 00 00 00       	jmp    804864 <spawn+0x429>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804790:	48 c7 85 d8 fa ff ff 	movq   $0x0,-0x528(%rbp)
+  804797:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80479b:	48 b8 f8 ff 00 00 60 	movabs $0x600000fff8,%rax
+  8047a2:	00 00 00 
+  8047a5:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8047ac:	48 8d 40 08          	lea    0x8(%rax),%rax
+  8047b0:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  8047b7:	49 89 c4             	mov    %rax,%r12
+  8047ba:	e9 4c fe ff ff       	jmp    80460b <spawn+0x1d0>
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  8047bf:	48 b9 90 70 80 00 00 	movabs $0x807090,%rcx
+  8047c6:	00 00 00 
+  8047c9:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  8047d0:	00 00 00 
+  8047d3:	be e2 00 00 00       	mov    $0xe2,%esi
+  8047d8:	48 bf e9 70 80 00 00 	movabs $0x8070e9,%rdi
+  8047df:	00 00 00 
+  8047e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e7:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  8047ee:	00 00 00 
+  8047f1:	41 ff d0             	call   *%r8
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8047f4:	48 bf c0 70 80 00 00 	movabs $0x8070c0,%rdi
+  8047fb:	00 00 00 
+  8047fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804803:	48 ba ef 1c 80 00 00 	movabs $0x801cef,%rdx
+  80480a:	00 00 00 
+  80480d:	ff d2                	call   *%rdx
+        return -E_NOT_EXEC;
+  80480f:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804815:	eb 2c                	jmp    804843 <spawn+0x408>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804817:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80481c:	8b b5 e0 fa ff ff    	mov    -0x520(%rbp),%esi
+  804822:	48 bf f5 70 80 00 00 	movabs $0x8070f5,%rdi
+  804829:	00 00 00 
+  80482c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804831:	48 b9 ef 1c 80 00 00 	movabs $0x801cef,%rcx
+  804838:	00 00 00 
+  80483b:	ff d1                	call   *%rcx
+        return -E_NOT_EXEC;
+  80483d:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804843:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80484a:	00 00 01 00 
+  80484e:	e9 76 02 00 00       	jmp    804ac9 <spawn+0x68e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804853:	48 83 c2 01          	add    $0x1,%rdx
+  804857:	48 83 c0 38          	add    $0x38,%rax
+  80485b:	49 39 d0             	cmp    %rdx,%r8
+  80485e:	0f 84 a5 00 00 00    	je     804909 <spawn+0x4ce>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  804864:	83 38 01             	cmpl   $0x1,(%rax)
+  804867:	75 ea                	jne    804853 <spawn+0x418>
+  804869:	48 8b 70 28          	mov    0x28(%rax),%rsi
+  80486d:	48 85 f6             	test   %rsi,%rsi
+  804870:	74 e1                	je     804853 <spawn+0x418>
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804872:	49 83 ff 10          	cmp    $0x10,%r15
+  804876:	0f 84 a1 02 00 00    	je     804b1d <spawn+0x6e2>
+  80487c:	48 3b 70 20          	cmp    0x20(%rax),%rsi
+  804880:	0f 82 aa 02 00 00    	jb     804b30 <spawn+0x6f5>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+  804886:	8b 78 04             	mov    0x4(%rax),%edi
+  804889:	89 f9                	mov    %edi,%ecx
+  80488b:	83 e1 02             	and    $0x2,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+  80488e:	41 89 c9             	mov    %ecx,%r9d
+  804891:	41 83 c9 04          	or     $0x4,%r9d
+  804895:	40 f6 c7 04          	test   $0x4,%dil
+  804899:	41 0f 45 c9          	cmovne %r9d,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+  80489d:	41 89 c9             	mov    %ecx,%r9d
+  8048a0:	41 83 c9 01          	or     $0x1,%r9d
+  8048a4:	40 f6 c7 01          	test   $0x1,%dil
+  8048a8:	41 0f 45 c9          	cmovne %r9d,%ecx
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+  8048ac:	48 8b 78 10          	mov    0x10(%rax),%rdi
+  8048b0:	49 89 f9             	mov    %rdi,%r9
+  8048b3:	49 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%r9
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+  8048ba:	48 8d b4 3e ff 0f 00 	lea    0xfff(%rsi,%rdi,1),%rsi
+  8048c1:	00 
+  8048c2:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8048c9:	4c 29 ce             	sub    %r9,%rsi
+        segs[nsegs++] = (struct SpawnSegment){
+  8048cc:	4c 89 ff             	mov    %r15,%rdi
+  8048cf:	48 c1 e7 05          	shl    $0x5,%rdi
+  8048d3:	48 8d 9d d0 fd ff ff 	lea    -0x230(%rbp),%rbx
+  8048da:	48 01 df             	add    %rbx,%rdi
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  8048dd:	48 8b 9d d8 fa ff ff 	mov    -0x528(%rbp),%rbx
+  8048e4:	4e 8d 1c 13          	lea    (%rbx,%r10,1),%r11
+  8048e8:	4c 89 1f             	mov    %r11,(%rdi)
+        segs[nsegs++] = (struct SpawnSegment){
+  8048eb:	4c 89 4f 08          	mov    %r9,0x8(%rdi)
+  8048ef:	48 89 77 10          	mov    %rsi,0x10(%rdi)
+  8048f3:	89 4f 18             	mov    %ecx,0x18(%rdi)
+        end += size;
+  8048f6:	48 01 f3             	add    %rsi,%rbx
+  8048f9:	48 89 9d d8 fa ff ff 	mov    %rbx,-0x528(%rbp)
+        segs[nsegs++] = (struct SpawnSegment){
+  804900:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+  804904:	e9 4a ff ff ff       	jmp    804853 <spawn+0x418>
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804909:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  804910:	00 00 00 
+  804913:	48 8b 8d d8 fa ff ff 	mov    -0x528(%rbp),%rcx
+  80491a:	48 39 c8             	cmp    %rcx,%rax
+  80491d:	0f 82 ef 01 00 00    	jb     804b12 <spawn+0x6d7>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+  804923:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  80492a:	48 8d 90 00 00 ff ff 	lea    -0x10000(%rax),%rdx
+  804931:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804936:	48 be 00 00 01 00 60 	movabs $0x6000010000,%rsi
+  80493d:	00 00 00 
+  804940:	bf 00 00 00 00       	mov    $0x0,%edi
+  804945:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  80494c:	00 00 00 
+  80494f:	ff d0                	call   *%rax
+  804951:	41 89 c4             	mov    %eax,%r12d
+  804954:	85 c0                	test   %eax,%eax
+  804956:	0f 88 e7 fe ff ff    	js     804843 <spawn+0x408>
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80495c:	48 8b 85 00 fb ff ff 	mov    -0x500(%rbp),%rax
+  804963:	48 8d 9c 05 e0 fa ff 	lea    -0x520(%rbp,%rax,1),%rbx
+  80496a:	ff 
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  80496b:	66 83 bd 18 fb ff ff 	cmpw   $0x0,-0x4e8(%rbp)
+  804972:	00 
+  804973:	0f 84 d3 00 00 00    	je     804a4c <spawn+0x611>
+  804979:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80497f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804984:	eb 46                	jmp    8049cc <spawn+0x591>
+    size_t nsegs = 0, start = *staged, end = start;
+  804986:	4d 89 c7             	mov    %r8,%r15
+  804989:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804990:	00 00 01 00 
+  804994:	eb 8d                	jmp    804923 <spawn+0x4e8>
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  804996:	48 85 c0             	test   %rax,%rax
+  804999:	48 c7 c2 ee ff ff ff 	mov    $0xffffffffffffffee,%rdx
+  8049a0:	48 0f 49 c2          	cmovns %rdx,%rax
+  8049a4:	41 89 c4             	mov    %eax,%r12d
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+  8049a7:	85 c0                	test   %eax,%eax
+  8049a9:	0f 89 c0 00 00 00    	jns    804a6f <spawn+0x634>
+  8049af:	e9 15 01 00 00       	jmp    804ac9 <spawn+0x68e>
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  8049b4:	49 83 c5 01          	add    $0x1,%r13
+  8049b8:	48 83 c3 38          	add    $0x38,%rbx
+  8049bc:	0f b7 85 18 fb ff ff 	movzwl -0x4e8(%rbp),%eax
+  8049c3:	49 39 c5             	cmp    %rax,%r13
+  8049c6:	0f 83 80 00 00 00    	jae    804a4c <spawn+0x611>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  8049cc:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8049cf:	75 e3                	jne    8049b4 <spawn+0x579>
+  8049d1:	48 83 7b 28 00       	cmpq   $0x0,0x28(%rbx)
+  8049d6:	74 dc                	je     8049b4 <spawn+0x579>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  8049d8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8049dc:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8049e3:	48 c1 e2 05          	shl    $0x5,%rdx
+  8049e7:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8049eb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8049f0:	48 03 84 15 d0 fd ff 	add    -0x230(%rbp,%rdx,1),%rax
+  8049f7:	ff 
+  8049f8:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
+  8049ff:	8b 73 08             	mov    0x8(%rbx),%esi
+  804a02:	44 89 f7             	mov    %r14d,%edi
+  804a05:	48 ba 42 39 80 00 00 	movabs $0x803942,%rdx
+  804a0c:	00 00 00 
+  804a0f:	ff d2                	call   *%rdx
+  804a11:	41 89 c4             	mov    %eax,%r12d
+  804a14:	85 c0                	test   %eax,%eax
+  804a16:	0f 88 ad 00 00 00    	js     804ac9 <spawn+0x68e>
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+  804a1c:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  804a20:	48 8b b5 d0 fa ff ff 	mov    -0x530(%rbp),%rsi
+  804a27:	44 89 f7             	mov    %r14d,%edi
+  804a2a:	48 b8 18 38 80 00 00 	movabs $0x803818,%rax
+  804a31:	00 00 00 
+  804a34:	ff d0                	call   *%rax
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  804a36:	48 39 43 20          	cmp    %rax,0x20(%rbx)
+  804a3a:	0f 85 56 ff ff ff    	jne    804996 <spawn+0x55b>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  804a40:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  804a47:	e9 68 ff ff ff       	jmp    8049b4 <spawn+0x579>
+    img->entry = elf->e_entry;
+  804a4c:	48 8b 85 f8 fa ff ff 	mov    -0x508(%rbp),%rax
+  804a53:	48 89 85 f8 fc ff ff 	mov    %rax,-0x308(%rbp)
+    img->segments = segs;
+  804a5a:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804a61:	48 89 85 10 fd ff ff 	mov    %rax,-0x2f0(%rbp)
+    img->nsegments = nsegs;
+  804a68:	4c 89 bd 18 fd ff ff 	mov    %r15,-0x2e8(%rbp)
+    res = sys_spawn(&img);
+  804a6f:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  804a76:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  804a7d:	00 00 00 
+  804a80:	ff d0                	call   *%rax
+  804a82:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  804a85:	45 85 e4             	test   %r12d,%r12d
+  804a88:	78 3f                	js     804ac9 <spawn+0x68e>
+    close(fd);
+  804a8a:	44 89 f7             	mov    %r14d,%edi
+  804a8d:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  804a94:	00 00 00 
+  804a97:	ff d0                	call   *%rax
+    return res;
+  804a99:	45 89 e6             	mov    %r12d,%r14d
+  804a9c:	eb 5f                	jmp    804afd <spawn+0x6c2>
+    size_t staged = USER_STACK_SIZE;
+  804a9e:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804aa5:	00 00 01 00 
+  804aa9:	eb da                	jmp    804a85 <spawn+0x64a>
+  804aab:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804ab2:	00 00 01 00 
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  804ab6:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  804abc:	eb 0b                	jmp    804ac9 <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804abe:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804ac5:	00 00 01 00 
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+  804ac9:	48 8b 95 d8 fa ff ff 	mov    -0x528(%rbp),%rdx
+  804ad0:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  804ad7:	00 00 00 
+  804ada:	bf 00 00 00 00       	mov    $0x0,%edi
+  804adf:	48 b8 63 2e 80 00 00 	movabs $0x802e63,%rax
+  804ae6:	00 00 00 
+  804ae9:	ff d0                	call   *%rax
+    close(fd);
+  804aeb:	44 89 f7             	mov    %r14d,%edi
+  804aee:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  804af5:	00 00 00 
+  804af8:	ff d0                	call   *%rax
+    return res;
+  804afa:	45 89 e6             	mov    %r12d,%r14d
+}
+  804afd:	44 89 f0             	mov    %r14d,%eax
+  804b00:	48 81 c4 18 05 00 00 	add    $0x518,%rsp
+  804b07:	5b                   	pop    %rbx
+  804b08:	41 5c                	pop    %r12
+  804b0a:	41 5d                	pop    %r13
+  804b0c:	41 5e                	pop    %r14
+  804b0e:	41 5f                	pop    %r15
+  804b10:	5d                   	pop    %rbp
+  804b11:	c3                   	ret
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804b12:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  804b18:	e9 26 fd ff ff       	jmp    804843 <spawn+0x408>
+    size_t staged = USER_STACK_SIZE;
+  804b1d:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804b24:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804b28:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804b2e:	eb 99                	jmp    804ac9 <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804b30:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804b37:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804b3b:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804b41:	eb 86                	jmp    804ac9 <spawn+0x68e>
+
+0000000000804b43 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804b43:	55                   	push   %rbp
+  804b44:	48 89 e5             	mov    %rsp,%rbp
+  804b47:	48 83 ec 50          	sub    $0x50,%rsp
+  804b4b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804b4f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804b53:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804b57:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804b5b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804b62:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804b66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804b6a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804b6e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804b72:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804b77:	eb 15                	jmp    804b8e <spawnl+0x4b>
+  804b79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804b7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804b81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804b85:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804b89:	74 1c                	je     804ba7 <spawnl+0x64>
+  804b8b:	83 c1 01             	add    $0x1,%ecx
+  804b8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804b91:	83 f8 2f             	cmp    $0x2f,%eax
+  804b94:	77 e3                	ja     804b79 <spawnl+0x36>
+  804b96:	89 c2                	mov    %eax,%edx
+  804b98:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804b9c:	4c 01 d2             	add    %r10,%rdx
+  804b9f:	83 c0 08             	add    $0x8,%eax
+  804ba2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804ba5:	eb de                	jmp    804b85 <spawnl+0x42>
+    const char *argv[argc + 2];
+  804ba7:	8d 41 02             	lea    0x2(%rcx),%eax
+  804baa:	48 98                	cltq
+  804bac:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804bb3:	00 
+  804bb4:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804bb8:	48 29 c4             	sub    %rax,%rsp
+  804bbb:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804bc0:	4c 89 c0             	mov    %r8,%rax
+  804bc3:	48 c1 e8 03          	shr    $0x3,%rax
+  804bc7:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  804bcb:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804bd2:	00 
+    argv[argc + 1] = NULL;
+  804bd3:	8d 41 01             	lea    0x1(%rcx),%eax
+  804bd6:	48 98                	cltq
+  804bd8:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804bdf:	00 
+    va_start(vl, arg0);
+  804be0:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804be7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804beb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804bef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804bf3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804bf7:	85 c9                	test   %ecx,%ecx
+  804bf9:	74 41                	je     804c3c <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804bfb:	49 89 c1             	mov    %rax,%r9
+  804bfe:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804c02:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804c05:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804c0a:	eb 1b                	jmp    804c27 <spawnl+0xe4>
+  804c0c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804c10:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804c14:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804c18:	48 8b 11             	mov    (%rcx),%rdx
+  804c1b:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804c1e:	48 83 c0 08          	add    $0x8,%rax
+  804c22:	48 39 f0             	cmp    %rsi,%rax
+  804c25:	74 15                	je     804c3c <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804c27:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804c2a:	83 fa 2f             	cmp    $0x2f,%edx
+  804c2d:	77 dd                	ja     804c0c <spawnl+0xc9>
+  804c2f:	89 d1                	mov    %edx,%ecx
+  804c31:	4c 01 c9             	add    %r9,%rcx
+  804c34:	83 c2 08             	add    $0x8,%edx
+  804c37:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804c3a:	eb dc                	jmp    804c18 <spawnl+0xd5>
+    return spawn(prog, argv);
+  804c3c:	4c 89 c6             	mov    %r8,%rsi
+  804c3f:	48 b8 3b 44 80 00 00 	movabs $0x80443b,%rax
+  804c46:	00 00 00 
+  804c49:	ff d0                	call   *%rax
+}
+  804c4b:	c9                   	leave
+  804c4c:	c3                   	ret
+
+0000000000804c4d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804c4d:	55                   	push   %rbp
+  804c4e:	48 89 e5             	mov    %rsp,%rbp
+  804c51:	41 54                	push   %r12
+  804c53:	53                   	push   %rbx
+  804c54:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c57:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  804c5e:	00 00 00 
+  804c61:	ff d0                	call   *%rax
+  804c63:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804c66:	48 be 0f 71 80 00 00 	movabs $0x80710f,%rsi
+  804c6d:	00 00 00 
+  804c70:	48 89 df             	mov    %rbx,%rdi
+  804c73:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  804c7a:	00 00 00 
+  804c7d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804c7f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804c84:	41 2b 04 24          	sub    (%r12),%eax
+  804c88:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804c8e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804c95:	00 00 00 
+    stat->st_dev = &devpipe;
+  804c98:	48 b8 40 98 80 00 00 	movabs $0x809840,%rax
+  804c9f:	00 00 00 
+  804ca2:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cae:	5b                   	pop    %rbx
+  804caf:	41 5c                	pop    %r12
+  804cb1:	5d                   	pop    %rbp
+  804cb2:	c3                   	ret
+
+0000000000804cb3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804cb3:	55                   	push   %rbp
+  804cb4:	48 89 e5             	mov    %rsp,%rbp
+  804cb7:	41 54                	push   %r12
+  804cb9:	53                   	push   %rbx
+  804cba:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804cbd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cc2:	48 89 fe             	mov    %rdi,%rsi
+  804cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cca:	49 bc 63 2e 80 00 00 	movabs $0x802e63,%r12
+  804cd1:	00 00 00 
+  804cd4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804cd7:	48 89 df             	mov    %rbx,%rdi
+  804cda:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  804ce1:	00 00 00 
+  804ce4:	ff d0                	call   *%rax
+  804ce6:	48 89 c6             	mov    %rax,%rsi
+  804ce9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cee:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cf3:	41 ff d4             	call   *%r12
+}
+  804cf6:	5b                   	pop    %rbx
+  804cf7:	41 5c                	pop    %r12
+  804cf9:	5d                   	pop    %rbp
+  804cfa:	c3                   	ret
+
+0000000000804cfb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804cfb:	55                   	push   %rbp
+  804cfc:	48 89 e5             	mov    %rsp,%rbp
+  804cff:	41 57                	push   %r15
+  804d01:	41 56                	push   %r14
+  804d03:	41 55                	push   %r13
+  804d05:	41 54                	push   %r12
+  804d07:	53                   	push   %rbx
+  804d08:	48 83 ec 18          	sub    $0x18,%rsp
+  804d0c:	49 89 fc             	mov    %rdi,%r12
+  804d0f:	49 89 f5             	mov    %rsi,%r13
+  804d12:	49 89 d7             	mov    %rdx,%r15
+  804d15:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804d19:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  804d20:	00 00 00 
+  804d23:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804d25:	4d 85 ff             	test   %r15,%r15
+  804d28:	0f 84 af 00 00 00    	je     804ddd <devpipe_write+0xe2>
+  804d2e:	48 89 c3             	mov    %rax,%rbx
+  804d31:	4c 89 f8             	mov    %r15,%rax
+  804d34:	4d 89 ef             	mov    %r13,%r15
+  804d37:	4c 01 e8             	add    %r13,%rax
+  804d3a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d3e:	49 bd 59 2d 80 00 00 	movabs $0x802d59,%r13
+  804d45:	00 00 00 
+            sys_yield();
+  804d48:	49 be ea 2c 80 00 00 	movabs $0x802cea,%r14
+  804d4f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804d52:	8b 73 04             	mov    0x4(%rbx),%esi
+  804d55:	48 63 ce             	movslq %esi,%rcx
+  804d58:	48 63 03             	movslq (%rbx),%rax
+  804d5b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804d61:	48 39 c1             	cmp    %rax,%rcx
+  804d64:	72 2e                	jb     804d94 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d66:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804d6b:	48 89 da             	mov    %rbx,%rdx
+  804d6e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d73:	4c 89 e7             	mov    %r12,%rdi
+  804d76:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804d79:	85 c0                	test   %eax,%eax
+  804d7b:	74 66                	je     804de3 <devpipe_write+0xe8>
+            sys_yield();
+  804d7d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804d80:	8b 73 04             	mov    0x4(%rbx),%esi
+  804d83:	48 63 ce             	movslq %esi,%rcx
+  804d86:	48 63 03             	movslq (%rbx),%rax
+  804d89:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804d8f:	48 39 c1             	cmp    %rax,%rcx
+  804d92:	73 d2                	jae    804d66 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804d94:	41 0f b6 3f          	movzbl (%r15),%edi
+  804d98:	48 89 ca             	mov    %rcx,%rdx
+  804d9b:	48 c1 ea 03          	shr    $0x3,%rdx
+  804d9f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804da6:	08 10 20 
+  804da9:	48 f7 e2             	mul    %rdx
+  804dac:	48 c1 ea 06          	shr    $0x6,%rdx
+  804db0:	48 89 d0             	mov    %rdx,%rax
+  804db3:	48 c1 e0 09          	shl    $0x9,%rax
+  804db7:	48 29 d0             	sub    %rdx,%rax
+  804dba:	48 c1 e0 03          	shl    $0x3,%rax
+  804dbe:	48 29 c1             	sub    %rax,%rcx
+  804dc1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804dc6:	83 c6 01             	add    $0x1,%esi
+  804dc9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804dcc:	49 83 c7 01          	add    $0x1,%r15
+  804dd0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dd4:	49 39 c7             	cmp    %rax,%r15
+  804dd7:	0f 85 75 ff ff ff    	jne    804d52 <devpipe_write+0x57>
+    return n;
+  804ddd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804de1:	eb 05                	jmp    804de8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804de3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804de8:	48 83 c4 18          	add    $0x18,%rsp
+  804dec:	5b                   	pop    %rbx
+  804ded:	41 5c                	pop    %r12
+  804def:	41 5d                	pop    %r13
+  804df1:	41 5e                	pop    %r14
+  804df3:	41 5f                	pop    %r15
+  804df5:	5d                   	pop    %rbp
+  804df6:	c3                   	ret
+
+0000000000804df7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804df7:	55                   	push   %rbp
+  804df8:	48 89 e5             	mov    %rsp,%rbp
+  804dfb:	41 57                	push   %r15
+  804dfd:	41 56                	push   %r14
+  804dff:	41 55                	push   %r13
+  804e01:	41 54                	push   %r12
+  804e03:	53                   	push   %rbx
+  804e04:	48 83 ec 18          	sub    $0x18,%rsp
+  804e08:	49 89 fc             	mov    %rdi,%r12
+  804e0b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804e0f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804e13:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  804e1a:	00 00 00 
+  804e1d:	ff d0                	call   *%rax
+  804e1f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804e22:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804e28:	49 bd 59 2d 80 00 00 	movabs $0x802d59,%r13
+  804e2f:	00 00 00 
+            sys_yield();
+  804e32:	49 be ea 2c 80 00 00 	movabs $0x802cea,%r14
+  804e39:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804e3c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804e41:	74 7d                	je     804ec0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804e43:	8b 03                	mov    (%rbx),%eax
+  804e45:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804e48:	75 26                	jne    804e70 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804e4a:	4d 85 ff             	test   %r15,%r15
+  804e4d:	75 77                	jne    804ec6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804e4f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804e54:	48 89 da             	mov    %rbx,%rdx
+  804e57:	be 00 10 00 00       	mov    $0x1000,%esi
+  804e5c:	4c 89 e7             	mov    %r12,%rdi
+  804e5f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804e62:	85 c0                	test   %eax,%eax
+  804e64:	74 72                	je     804ed8 <devpipe_read+0xe1>
+            sys_yield();
+  804e66:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804e69:	8b 03                	mov    (%rbx),%eax
+  804e6b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804e6e:	74 df                	je     804e4f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804e70:	48 63 c8             	movslq %eax,%rcx
+  804e73:	48 89 ca             	mov    %rcx,%rdx
+  804e76:	48 c1 ea 03          	shr    $0x3,%rdx
+  804e7a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804e81:	08 10 20 
+  804e84:	48 89 d0             	mov    %rdx,%rax
+  804e87:	48 f7 e6             	mul    %rsi
+  804e8a:	48 c1 ea 06          	shr    $0x6,%rdx
+  804e8e:	48 89 d0             	mov    %rdx,%rax
+  804e91:	48 c1 e0 09          	shl    $0x9,%rax
+  804e95:	48 29 d0             	sub    %rdx,%rax
+  804e98:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804e9f:	00 
+  804ea0:	48 89 c8             	mov    %rcx,%rax
+  804ea3:	48 29 d0             	sub    %rdx,%rax
+  804ea6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804eab:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804eaf:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804eb3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804eb6:	49 83 c7 01          	add    $0x1,%r15
+  804eba:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804ebe:	75 83                	jne    804e43 <devpipe_read+0x4c>
+    return n;
+  804ec0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ec4:	eb 03                	jmp    804ec9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804ec6:	4c 89 f8             	mov    %r15,%rax
+}
+  804ec9:	48 83 c4 18          	add    $0x18,%rsp
+  804ecd:	5b                   	pop    %rbx
+  804ece:	41 5c                	pop    %r12
+  804ed0:	41 5d                	pop    %r13
+  804ed2:	41 5e                	pop    %r14
+  804ed4:	41 5f                	pop    %r15
+  804ed6:	5d                   	pop    %rbp
+  804ed7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804edd:	eb ea                	jmp    804ec9 <devpipe_read+0xd2>
+
+0000000000804edf <pipe>:
+pipe(int pfd[2]) {
+  804edf:	55                   	push   %rbp
+  804ee0:	48 89 e5             	mov    %rsp,%rbp
+  804ee3:	41 55                	push   %r13
+  804ee5:	41 54                	push   %r12
+  804ee7:	53                   	push   %rbx
+  804ee8:	48 83 ec 18          	sub    $0x18,%rsp
+  804eec:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804eef:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804ef3:	48 b8 17 34 80 00 00 	movabs $0x803417,%rax
+  804efa:	00 00 00 
+  804efd:	ff d0                	call   *%rax
+  804eff:	89 c3                	mov    %eax,%ebx
+  804f01:	85 c0                	test   %eax,%eax
+  804f03:	0f 88 a0 01 00 00    	js     8050a9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804f09:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804f0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f13:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804f17:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f1c:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  804f23:	00 00 00 
+  804f26:	ff d0                	call   *%rax
+  804f28:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804f2a:	85 c0                	test   %eax,%eax
+  804f2c:	0f 88 77 01 00 00    	js     8050a9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804f32:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804f36:	48 b8 17 34 80 00 00 	movabs $0x803417,%rax
+  804f3d:	00 00 00 
+  804f40:	ff d0                	call   *%rax
+  804f42:	89 c3                	mov    %eax,%ebx
+  804f44:	85 c0                	test   %eax,%eax
+  804f46:	0f 88 43 01 00 00    	js     80508f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804f4c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804f51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f56:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f5f:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  804f66:	00 00 00 
+  804f69:	ff d0                	call   *%rax
+  804f6b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804f6d:	85 c0                	test   %eax,%eax
+  804f6f:	0f 88 1a 01 00 00    	js     80508f <pipe+0x1b0>
+    va = fd2data(fd0);
+  804f75:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804f79:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  804f80:	00 00 00 
+  804f83:	ff d0                	call   *%rax
+  804f85:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804f88:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804f8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f92:	48 89 c6             	mov    %rax,%rsi
+  804f95:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f9a:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  804fa1:	00 00 00 
+  804fa4:	ff d0                	call   *%rax
+  804fa6:	89 c3                	mov    %eax,%ebx
+  804fa8:	85 c0                	test   %eax,%eax
+  804faa:	0f 88 c5 00 00 00    	js     805075 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804fb0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804fb4:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  804fbb:	00 00 00 
+  804fbe:	ff d0                	call   *%rax
+  804fc0:	48 89 c1             	mov    %rax,%rcx
+  804fc3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804fc9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fd4:	4c 89 ee             	mov    %r13,%rsi
+  804fd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fdc:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  804fe3:	00 00 00 
+  804fe6:	ff d0                	call   *%rax
+  804fe8:	89 c3                	mov    %eax,%ebx
+  804fea:	85 c0                	test   %eax,%eax
+  804fec:	78 6e                	js     80505c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804fee:	be 00 10 00 00       	mov    $0x1000,%esi
+  804ff3:	4c 89 ef             	mov    %r13,%rdi
+  804ff6:	48 b8 21 2d 80 00 00 	movabs $0x802d21,%rax
+  804ffd:	00 00 00 
+  805000:	ff d0                	call   *%rax
+  805002:	83 f8 02             	cmp    $0x2,%eax
+  805005:	0f 85 ab 00 00 00    	jne    8050b6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80500b:	a1 40 98 80 00 00 00 	movabs 0x809840,%eax
+  805012:	00 00 
+  805014:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805018:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80501a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80501e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  805025:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805029:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80502b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80502f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  805036:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80503a:	48 bb e9 33 80 00 00 	movabs $0x8033e9,%rbx
+  805041:	00 00 00 
+  805044:	ff d3                	call   *%rbx
+  805046:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80504a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80504e:	ff d3                	call   *%rbx
+  805050:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  805055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80505a:	eb 4d                	jmp    8050a9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80505c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805061:	4c 89 ee             	mov    %r13,%rsi
+  805064:	bf 00 00 00 00       	mov    $0x0,%edi
+  805069:	48 b8 63 2e 80 00 00 	movabs $0x802e63,%rax
+  805070:	00 00 00 
+  805073:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  805075:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80507a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80507e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805083:	48 b8 63 2e 80 00 00 	movabs $0x802e63,%rax
+  80508a:	00 00 00 
+  80508d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80508f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805094:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  805098:	bf 00 00 00 00       	mov    $0x0,%edi
+  80509d:	48 b8 63 2e 80 00 00 	movabs $0x802e63,%rax
+  8050a4:	00 00 00 
+  8050a7:	ff d0                	call   *%rax
+}
+  8050a9:	89 d8                	mov    %ebx,%eax
+  8050ab:	48 83 c4 18          	add    $0x18,%rsp
+  8050af:	5b                   	pop    %rbx
+  8050b0:	41 5c                	pop    %r12
+  8050b2:	41 5d                	pop    %r13
+  8050b4:	5d                   	pop    %rbp
+  8050b5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8050b6:	48 b9 28 71 80 00 00 	movabs $0x807128,%rcx
+  8050bd:	00 00 00 
+  8050c0:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  8050c7:	00 00 00 
+  8050ca:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8050cf:	48 bf 16 71 80 00 00 	movabs $0x807116,%rdi
+  8050d6:	00 00 00 
+  8050d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050de:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  8050e5:	00 00 00 
+  8050e8:	41 ff d0             	call   *%r8
+
+00000000008050eb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8050eb:	55                   	push   %rbp
+  8050ec:	48 89 e5             	mov    %rsp,%rbp
+  8050ef:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8050f3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8050f7:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  8050fe:	00 00 00 
+  805101:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805103:	85 c0                	test   %eax,%eax
+  805105:	78 35                	js     80513c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  805107:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80510b:	48 b8 fb 33 80 00 00 	movabs $0x8033fb,%rax
+  805112:	00 00 00 
+  805115:	ff d0                	call   *%rax
+  805117:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80511a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80511f:	be 00 10 00 00       	mov    $0x1000,%esi
+  805124:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805128:	48 b8 59 2d 80 00 00 	movabs $0x802d59,%rax
+  80512f:	00 00 00 
+  805132:	ff d0                	call   *%rax
+  805134:	85 c0                	test   %eax,%eax
+  805136:	0f 94 c0             	sete   %al
+  805139:	0f b6 c0             	movzbl %al,%eax
+}
+  80513c:	c9                   	leave
+  80513d:	c3                   	ret
+
+000000000080513e <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80513e:	55                   	push   %rbp
+  80513f:	48 89 e5             	mov    %rsp,%rbp
+  805142:	41 55                	push   %r13
+  805144:	41 54                	push   %r12
+  805146:	53                   	push   %rbx
+  805147:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  80514b:	85 ff                	test   %edi,%edi
+  80514d:	74 73                	je     8051c2 <wait+0x84>
+  80514f:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  805152:	89 f8                	mov    %edi,%eax
+  805154:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  805159:	89 f9                	mov    %edi,%ecx
+  80515b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  805161:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  805168:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80516f:	00 00 00 
+  805172:	48 01 ca             	add    %rcx,%rdx
+  805175:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80517b:	39 d7                	cmp    %edx,%edi
+  80517d:	75 38                	jne    8051b7 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  80517f:	48 98                	cltq
+  805181:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805188:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80518f:	00 00 00 
+  805192:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  805195:	49 bd ea 2c 80 00 00 	movabs $0x802cea,%r13
+  80519c:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80519f:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  8051a5:	85 c0                	test   %eax,%eax
+  8051a7:	74 0e                	je     8051b7 <wait+0x79>
+        sys_yield();
+  8051a9:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8051ac:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8051b2:	44 39 e0             	cmp    %r12d,%eax
+  8051b5:	74 e8                	je     80519f <wait+0x61>
+    }
+}
+  8051b7:	48 83 c4 08          	add    $0x8,%rsp
+  8051bb:	5b                   	pop    %rbx
+  8051bc:	41 5c                	pop    %r12
+  8051be:	41 5d                	pop    %r13
+  8051c0:	5d                   	pop    %rbp
+  8051c1:	c3                   	ret
+    assert(envid != 0);
+  8051c2:	48 b9 4c 71 80 00 00 	movabs $0x80714c,%rcx
+  8051c9:	00 00 00 
+  8051cc:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  8051d3:	00 00 00 
+  8051d6:	be 06 00 00 00       	mov    $0x6,%esi
+  8051db:	48 bf 57 71 80 00 00 	movabs $0x807157,%rdi
+  8051e2:	00 00 00 
+  8051e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ea:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  8051f1:	00 00 00 
+  8051f4:	41 ff d0             	call   *%r8
+
+00000000008051f7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8051f7:	48 89 f8             	mov    %rdi,%rax
+  8051fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8051fe:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805205:	01 00 00 
+  805208:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80520c:	f6 c2 01             	test   $0x1,%dl
+  80520f:	74 6d                	je     80527e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805211:	48 89 f8             	mov    %rdi,%rax
+  805214:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805218:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80521f:	01 00 00 
+  805222:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805226:	f6 c2 01             	test   $0x1,%dl
+  805229:	74 62                	je     80528d <get_uvpt_entry+0x96>
+  80522b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805232:	01 00 00 
+  805235:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805239:	f6 c2 80             	test   $0x80,%dl
+  80523c:	75 4f                	jne    80528d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80523e:	48 89 f8             	mov    %rdi,%rax
+  805241:	48 c1 e8 15          	shr    $0x15,%rax
+  805245:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80524c:	01 00 00 
+  80524f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805253:	f6 c2 01             	test   $0x1,%dl
+  805256:	74 44                	je     80529c <get_uvpt_entry+0xa5>
+  805258:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80525f:	01 00 00 
+  805262:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805266:	f6 c2 80             	test   $0x80,%dl
+  805269:	75 31                	jne    80529c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80526b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80526f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805276:	01 00 00 
+  805279:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80527d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80527e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805285:	01 00 00 
+  805288:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80528c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80528d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805294:	01 00 00 
+  805297:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80529b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80529c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8052a3:	01 00 00 
+  8052a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8052aa:	c3                   	ret
+
+00000000008052ab <get_prot>:
+
+int
+get_prot(void *va) {
+  8052ab:	55                   	push   %rbp
+  8052ac:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8052af:	48 b8 f7 51 80 00 00 	movabs $0x8051f7,%rax
+  8052b6:	00 00 00 
+  8052b9:	ff d0                	call   *%rax
+  8052bb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8052be:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8052c3:	89 c1                	mov    %eax,%ecx
+  8052c5:	83 c9 04             	or     $0x4,%ecx
+  8052c8:	f6 c2 01             	test   $0x1,%dl
+  8052cb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8052ce:	89 c1                	mov    %eax,%ecx
+  8052d0:	83 c9 02             	or     $0x2,%ecx
+  8052d3:	f6 c2 02             	test   $0x2,%dl
+  8052d6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8052d9:	89 c1                	mov    %eax,%ecx
+  8052db:	83 c9 01             	or     $0x1,%ecx
+  8052de:	48 85 d2             	test   %rdx,%rdx
+  8052e1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8052e4:	89 c1                	mov    %eax,%ecx
+  8052e6:	83 c9 40             	or     $0x40,%ecx
+  8052e9:	f6 c6 04             	test   $0x4,%dh
+  8052ec:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8052ef:	5d                   	pop    %rbp
+  8052f0:	c3                   	ret
+
+00000000008052f1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8052f1:	55                   	push   %rbp
+  8052f2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8052f5:	48 b8 f7 51 80 00 00 	movabs $0x8051f7,%rax
+  8052fc:	00 00 00 
+  8052ff:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805301:	48 c1 e8 06          	shr    $0x6,%rax
+  805305:	83 e0 01             	and    $0x1,%eax
+}
+  805308:	5d                   	pop    %rbp
+  805309:	c3                   	ret
+
+000000000080530a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80530a:	55                   	push   %rbp
+  80530b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80530e:	48 b8 f7 51 80 00 00 	movabs $0x8051f7,%rax
+  805315:	00 00 00 
+  805318:	ff d0                	call   *%rax
+  80531a:	83 e0 01             	and    $0x1,%eax
+}
+  80531d:	5d                   	pop    %rbp
+  80531e:	c3                   	ret
+
+000000000080531f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80531f:	55                   	push   %rbp
+  805320:	48 89 e5             	mov    %rsp,%rbp
+  805323:	41 57                	push   %r15
+  805325:	41 56                	push   %r14
+  805327:	41 55                	push   %r13
+  805329:	41 54                	push   %r12
+  80532b:	53                   	push   %rbx
+  80532c:	48 83 ec 28          	sub    $0x28,%rsp
+  805330:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  805334:	48 85 ff             	test   %rdi,%rdi
+  805337:	74 1e                	je     805357 <foreach_shared_region+0x38>
+  805339:	49 89 ff             	mov    %rdi,%r15
+  80533c:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  805342:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  805348:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80534f:	01 00 00 
+  805352:	e9 72 02 00 00       	jmp    8055c9 <foreach_shared_region+0x2aa>
+    assert(fun);
+  805357:	48 b9 62 71 80 00 00 	movabs $0x807162,%rcx
+  80535e:	00 00 00 
+  805361:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  805368:	00 00 00 
+  80536b:	be 2d 00 00 00       	mov    $0x2d,%esi
+  805370:	48 bf 66 71 80 00 00 	movabs $0x807166,%rdi
+  805377:	00 00 00 
+  80537a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80537f:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  805386:	00 00 00 
+  805389:	41 ff d0             	call   *%r8
+  80538c:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  805393:	eb 6c                	jmp    805401 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  805395:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80539c:	ff ff ff 
+  80539f:	4c 21 e2             	and    %r12,%rdx
+  8053a2:	48 89 d8             	mov    %rbx,%rax
+  8053a5:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8053aa:	48 83 c0 01          	add    $0x1,%rax
+  8053ae:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8053b2:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8053b9:	00 00 00 
+  8053bc:	48 21 c8             	and    %rcx,%rax
+  8053bf:	48 09 d0             	or     %rdx,%rax
+  8053c2:	49 89 c4             	mov    %rax,%r12
+  8053c5:	eb 30                	jmp    8053f7 <foreach_shared_region+0xd8>
+  8053c7:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8053ce:	ff ff ff 
+  8053d1:	4c 21 e2             	and    %r12,%rdx
+  8053d4:	48 89 d8             	mov    %rbx,%rax
+  8053d7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8053dc:	48 83 c0 01          	add    $0x1,%rax
+  8053e0:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8053e4:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8053eb:	00 00 00 
+  8053ee:	48 21 c8             	and    %rcx,%rax
+  8053f1:	48 09 d0             	or     %rdx,%rax
+  8053f4:	49 89 c4             	mov    %rax,%r12
+  8053f7:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8053fb:	0f 84 99 01 00 00    	je     80559a <foreach_shared_region+0x27b>
+  805401:	4c 89 e3             	mov    %r12,%rbx
+  805404:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  805408:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80540f:	01 00 00 
+  805412:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  805416:	a8 01                	test   $0x1,%al
+  805418:	0f 84 77 ff ff ff    	je     805395 <foreach_shared_region+0x76>
+  80541e:	a8 80                	test   $0x80,%al
+  805420:	74 19                	je     80543b <foreach_shared_region+0x11c>
+  805422:	f6 c4 04             	test   $0x4,%ah
+  805425:	74 a0                	je     8053c7 <foreach_shared_region+0xa8>
+  805427:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80542e:	40 
+  80542f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805433:	4c 89 e7             	mov    %r12,%rdi
+  805436:	41 ff d7             	call   *%r15
+  805439:	eb 8c                	jmp    8053c7 <foreach_shared_region+0xa8>
+  80543b:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  805442:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  805446:	eb 46                	jmp    80548e <foreach_shared_region+0x16f>
+  805448:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80544f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805455:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  805459:	48 c1 e0 15          	shl    $0x15,%rax
+  80545d:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805462:	49 09 c4             	or     %rax,%r12
+  805465:	eb 1d                	jmp    805484 <foreach_shared_region+0x165>
+  805467:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80546e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805474:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  805478:	48 c1 e0 15          	shl    $0x15,%rax
+  80547c:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805481:	49 09 c4             	or     %rax,%r12
+  805484:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  805488:	0f 84 d3 00 00 00    	je     805561 <foreach_shared_region+0x242>
+  80548e:	4c 89 e3             	mov    %r12,%rbx
+  805491:	48 c1 eb 15          	shr    $0x15,%rbx
+  805495:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80549c:	01 00 00 
+  80549f:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8054a3:	a8 01                	test   $0x1,%al
+  8054a5:	74 a1                	je     805448 <foreach_shared_region+0x129>
+  8054a7:	a8 80                	test   $0x80,%al
+  8054a9:	74 19                	je     8054c4 <foreach_shared_region+0x1a5>
+  8054ab:	f6 c4 04             	test   $0x4,%ah
+  8054ae:	74 b7                	je     805467 <foreach_shared_region+0x148>
+  8054b0:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8054b7:	00 
+  8054b8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8054bc:	4c 89 e7             	mov    %r12,%rdi
+  8054bf:	41 ff d7             	call   *%r15
+  8054c2:	eb a3                	jmp    805467 <foreach_shared_region+0x148>
+  8054c4:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8054ca:	eb 3b                	jmp    805507 <foreach_shared_region+0x1e8>
+  8054cc:	f6 c4 04             	test   $0x4,%ah
+  8054cf:	74 12                	je     8054e3 <foreach_shared_region+0x1c4>
+  8054d1:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8054d8:	00 
+  8054d9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8054dd:	4c 89 e7             	mov    %r12,%rdi
+  8054e0:	41 ff d7             	call   *%r15
+  8054e3:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8054ea:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8054f0:	48 83 c3 01          	add    $0x1,%rbx
+  8054f4:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8054f8:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8054fe:	49 09 dc             	or     %rbx,%r12
+  805501:	41 83 ed 01          	sub    $0x1,%r13d
+  805505:	74 2f                	je     805536 <foreach_shared_region+0x217>
+  805507:	4c 89 e3             	mov    %r12,%rbx
+  80550a:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80550e:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  805512:	a8 01                	test   $0x1,%al
+  805514:	75 b6                	jne    8054cc <foreach_shared_region+0x1ad>
+  805516:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80551d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805523:	48 83 c3 01          	add    $0x1,%rbx
+  805527:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80552b:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805531:	49 09 dc             	or     %rbx,%r12
+  805534:	eb cb                	jmp    805501 <foreach_shared_region+0x1e2>
+  805536:	4c 89 e0             	mov    %r12,%rax
+  805539:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80553f:	49 c1 ec 15          	shr    $0x15,%r12
+  805543:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80554a:	49 83 c4 01          	add    $0x1,%r12
+  80554e:	49 c1 e4 15          	shl    $0x15,%r12
+  805552:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  805559:	49 09 c4             	or     %rax,%r12
+  80555c:	e9 23 ff ff ff       	jmp    805484 <foreach_shared_region+0x165>
+  805561:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  805565:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80556c:	ff ff ff 
+  80556f:	4c 21 e0             	and    %r12,%rax
+  805572:	49 c1 ec 1e          	shr    $0x1e,%r12
+  805576:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80557d:	49 83 c4 01          	add    $0x1,%r12
+  805581:	49 c1 e4 1e          	shl    $0x1e,%r12
+  805585:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  80558c:	00 00 00 
+  80558f:	49 21 d4             	and    %rdx,%r12
+  805592:	49 09 c4             	or     %rax,%r12
+  805595:	e9 5d fe ff ff       	jmp    8053f7 <foreach_shared_region+0xd8>
+  80559a:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8055a1:	00 ff ff 
+  8055a4:	4c 21 e0             	and    %r12,%rax
+  8055a7:	49 c1 ec 27          	shr    $0x27,%r12
+  8055ab:	49 83 c4 01          	add    $0x1,%r12
+  8055af:	49 c1 e4 27          	shl    $0x27,%r12
+  8055b3:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8055ba:	ff 00 00 
+  8055bd:	49 21 d4             	and    %rdx,%r12
+  8055c0:	49 09 c4             	or     %rax,%r12
+  8055c3:	41 83 ed 01          	sub    $0x1,%r13d
+  8055c7:	74 48                	je     805611 <foreach_shared_region+0x2f2>
+  8055c9:	4c 89 e0             	mov    %r12,%rax
+  8055cc:	48 c1 e8 27          	shr    $0x27,%rax
+  8055d0:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8055d7:	01 00 00 
+  8055da:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8055de:	f6 c2 01             	test   $0x1,%dl
+  8055e1:	0f 85 a5 fd ff ff    	jne    80538c <foreach_shared_region+0x6d>
+  8055e7:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8055ee:	00 ff ff 
+  8055f1:	4c 21 e2             	and    %r12,%rdx
+  8055f4:	48 83 c0 01          	add    $0x1,%rax
+  8055f8:	48 c1 e0 27          	shl    $0x27,%rax
+  8055fc:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  805603:	ff 00 00 
+  805606:	48 21 c8             	and    %rcx,%rax
+  805609:	48 09 d0             	or     %rdx,%rax
+  80560c:	49 89 c4             	mov    %rax,%r12
+  80560f:	eb b2                	jmp    8055c3 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  805611:	4d 85 e4             	test   %r12,%r12
+  805614:	75 14                	jne    80562a <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  805616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80561b:	48 83 c4 28          	add    $0x28,%rsp
+  80561f:	5b                   	pop    %rbx
+  805620:	41 5c                	pop    %r12
+  805622:	41 5d                	pop    %r13
+  805624:	41 5e                	pop    %r14
+  805626:	41 5f                	pop    %r15
+  805628:	5d                   	pop    %rbp
+  805629:	c3                   	ret
+    assert(addr == 0);
+  80562a:	48 b9 71 71 80 00 00 	movabs $0x807171,%rcx
+  805631:	00 00 00 
+  805634:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  80563b:	00 00 00 
+  80563e:	be 67 00 00 00       	mov    $0x67,%esi
+  805643:	48 bf 66 71 80 00 00 	movabs $0x807166,%rdi
+  80564a:	00 00 00 
+  80564d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805652:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  805659:	00 00 00 
+  80565c:	41 ff d0             	call   *%r8
+
+000000000080565f <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80565f:	49 b8 40 ec 80 01 00 	movabs $0x180ec40,%r8
+  805666:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  805669:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80566f:	eb 33                	jmp    8056a4 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805671:	48 83 c0 20          	add    $0x20,%rax
+  805675:	4c 39 c0             	cmp    %r8,%rax
+  805678:	74 25                	je     80569f <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80567a:	48 8b 10             	mov    (%rax),%rdx
+  80567d:	48 85 d2             	test   %rdx,%rdx
+  805680:	74 ef                	je     805671 <mmap_place+0x12>
+  805682:	48 89 d1             	mov    %rdx,%rcx
+  805685:	48 03 48 08          	add    0x8(%rax),%rcx
+  805689:	48 39 cf             	cmp    %rcx,%rdi
+  80568c:	73 e3                	jae    805671 <mmap_place+0x12>
+  80568e:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  805692:	4c 39 ca             	cmp    %r9,%rdx
+  805695:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  805699:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  80569d:	eb d2                	jmp    805671 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  80569f:	45 84 d2             	test   %r10b,%r10b
+  8056a2:	74 12                	je     8056b6 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8056a4:	48 b8 40 e8 80 01 00 	movabs $0x180e840,%rax
+  8056ab:	00 00 00 
+        moved = 0;
+  8056ae:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8056b4:	eb c4                	jmp    80567a <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8056b6:	48 01 fe             	add    %rdi,%rsi
+  8056b9:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8056c0:	00 00 00 
+  8056c3:	48 39 f0             	cmp    %rsi,%rax
+  8056c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056cb:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8056cf:	c3                   	ret
+
+00000000008056d0 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8056d0:	55                   	push   %rbp
+  8056d1:	48 89 e5             	mov    %rsp,%rbp
+  8056d4:	41 57                	push   %r15
+  8056d6:	41 56                	push   %r14
+  8056d8:	41 55                	push   %r13
+  8056da:	41 54                	push   %r12
+  8056dc:	53                   	push   %rbx
+  8056dd:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8056e1:	48 8b 1f             	mov    (%rdi),%rbx
+  8056e4:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8056eb:	48 b8 40 e8 80 01 00 	movabs $0x180e840,%rax
+  8056f2:	00 00 00 
+  8056f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056fa:	eb 12                	jmp    80570e <mmap_pgfault+0x3e>
+  8056fc:	48 83 c2 01          	add    $0x1,%rdx
+  805700:	48 83 c0 20          	add    $0x20,%rax
+  805704:	48 83 fa 20          	cmp    $0x20,%rdx
+  805708:	0f 84 04 01 00 00    	je     805812 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80570e:	48 8b 08             	mov    (%rax),%rcx
+  805711:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  805715:	48 39 de             	cmp    %rbx,%rsi
+  805718:	73 e2                	jae    8056fc <mmap_pgfault+0x2c>
+  80571a:	48 03 48 08          	add    0x8(%rax),%rcx
+  80571e:	48 39 cb             	cmp    %rcx,%rbx
+  805721:	73 d9                	jae    8056fc <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  805723:	48 c1 e2 05          	shl    $0x5,%rdx
+  805727:	48 b8 40 e8 80 01 00 	movabs $0x180e840,%rax
+  80572e:	00 00 00 
+  805731:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  805735:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  805739:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80573d:	f6 c2 01             	test   $0x1,%dl
+  805740:	0f 84 e0 00 00 00    	je     805826 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  805746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80574b:	f6 c2 02             	test   $0x2,%dl
+  80574e:	0f 84 c3 00 00 00    	je     805817 <mmap_pgfault+0x147>
+  805754:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80575b:	ff ff ff 
+  80575e:	48 23 56 10          	and    0x10(%rsi),%rdx
+  805762:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  805769:	00 00 00 
+  80576c:	48 39 ca             	cmp    %rcx,%rdx
+  80576f:	0f 85 a2 00 00 00    	jne    805817 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  805775:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80577a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80577f:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  805786:	00 00 00 
+  805789:	bf 00 00 00 00       	mov    $0x0,%edi
+  80578e:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  805795:	00 00 00 
+  805798:	ff d0                	call   *%rax
+  80579a:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  80579c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057a1:	85 d2                	test   %edx,%edx
+  8057a3:	78 72                	js     805817 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8057a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8057aa:	48 89 de             	mov    %rbx,%rsi
+  8057ad:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8057b4:	00 00 00 
+  8057b7:	4c 89 e7             	mov    %r12,%rdi
+  8057ba:	48 b8 dd 29 80 00 00 	movabs $0x8029dd,%rax
+  8057c1:	00 00 00 
+  8057c4:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8057c6:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8057cc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8057d2:	48 89 d9             	mov    %rbx,%rcx
+  8057d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057da:	4c 89 e6             	mov    %r12,%rsi
+  8057dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057e2:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  8057e9:	00 00 00 
+  8057ec:	ff d0                	call   *%rax
+  8057ee:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8057f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8057f5:	4c 89 e6             	mov    %r12,%rsi
+  8057f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057fd:	48 b8 63 2e 80 00 00 	movabs $0x802e63,%rax
+  805804:	00 00 00 
+  805807:	ff d0                	call   *%rax
+    return res >= 0;
+  805809:	89 d8                	mov    %ebx,%eax
+  80580b:	f7 d0                	not    %eax
+  80580d:	c1 e8 1f             	shr    $0x1f,%eax
+  805810:	eb 05                	jmp    805817 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  805812:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  805817:	48 83 c4 18          	add    $0x18,%rsp
+  80581b:	5b                   	pop    %rbx
+  80581c:	41 5c                	pop    %r12
+  80581e:	41 5d                	pop    %r13
+  805820:	41 5e                	pop    %r14
+  805822:	41 5f                	pop    %r15
+  805824:	5d                   	pop    %rbp
+  805825:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  805826:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80582a:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  80582e:	4c 03 30             	add    (%rax),%r14
+  805831:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  805838:	49 39 c6             	cmp    %rax,%r14
+  80583b:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80583f:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  805846:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80584c:	49 bf 0a 53 80 00 00 	movabs $0x80530a,%r15
+  805853:	00 00 00 
+  805856:	4d 39 f4             	cmp    %r14,%r12
+  805859:	73 1d                	jae    805878 <mmap_pgfault+0x1a8>
+  80585b:	4c 89 e7             	mov    %r12,%rdi
+  80585e:	41 ff d7             	call   *%r15
+  805861:	84 c0                	test   %al,%al
+  805863:	75 13                	jne    805878 <mmap_pgfault+0x1a8>
+  805865:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80586c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  805873:	4d 39 f4             	cmp    %r14,%r12
+  805876:	72 e3                	jb     80585b <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  805878:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  80587e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805882:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  805886:	74 2a                	je     8058b2 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  805888:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80588c:	89 de                	mov    %ebx,%esi
+  80588e:	2b 30                	sub    (%rax),%esi
+  805890:	03 70 1c             	add    0x1c(%rax),%esi
+  805893:	8b 78 18             	mov    0x18(%rax),%edi
+  805896:	4c 89 e9             	mov    %r13,%rcx
+  805899:	48 89 da             	mov    %rbx,%rdx
+  80589c:	48 b8 d4 40 80 00 00 	movabs $0x8040d4,%rax
+  8058a3:	00 00 00 
+  8058a6:	ff d0                	call   *%rax
+    return res > 0;
+  8058a8:	85 c0                	test   %eax,%eax
+  8058aa:	0f 9f c0             	setg   %al
+  8058ad:	e9 65 ff ff ff       	jmp    805817 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8058b2:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8058b6:	eb d0                	jmp    805888 <mmap_pgfault+0x1b8>
+
+00000000008058b8 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8058b8:	55                   	push   %rbp
+  8058b9:	48 89 e5             	mov    %rsp,%rbp
+  8058bc:	41 57                	push   %r15
+  8058be:	41 56                	push   %r14
+  8058c0:	41 55                	push   %r13
+  8058c2:	41 54                	push   %r12
+  8058c4:	53                   	push   %rbx
+  8058c5:	48 83 ec 28          	sub    $0x28,%rsp
+  8058c9:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8058cd:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8058d0:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8058d7:	ff ff ff 
+  8058da:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8058de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058e3:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8058ea:	00 00 00 
+  8058ed:	48 39 ca             	cmp    %rcx,%rdx
+  8058f0:	0f 85 e5 00 00 00    	jne    8059db <mmap_writeback+0x123>
+  8058f6:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8058f9:	4c 39 ee             	cmp    %r13,%rsi
+  8058fc:	0f 83 e8 00 00 00    	jae    8059ea <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805902:	49 be 0a 53 80 00 00 	movabs $0x80530a,%r14
+  805909:	00 00 00 
+  80590c:	49 bf f1 52 80 00 00 	movabs $0x8052f1,%r15
+  805913:	00 00 00 
+  805916:	eb 10                	jmp    805928 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  805918:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80591f:	4d 39 ec             	cmp    %r13,%r12
+  805922:	0f 83 ae 00 00 00    	jae    8059d6 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805928:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80592c:	4c 89 e7             	mov    %r12,%rdi
+  80592f:	41 ff d6             	call   *%r14
+  805932:	84 c0                	test   %al,%al
+  805934:	74 e2                	je     805918 <mmap_writeback+0x60>
+  805936:	4c 89 e7             	mov    %r12,%rdi
+  805939:	41 ff d7             	call   *%r15
+  80593c:	84 c0                	test   %al,%al
+  80593e:	74 d8                	je     805918 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  805940:	4c 89 e3             	mov    %r12,%rbx
+  805943:	4d 39 ec             	cmp    %r13,%r12
+  805946:	73 20                	jae    805968 <mmap_writeback+0xb0>
+  805948:	48 89 df             	mov    %rbx,%rdi
+  80594b:	41 ff d6             	call   *%r14
+  80594e:	84 c0                	test   %al,%al
+  805950:	74 16                	je     805968 <mmap_writeback+0xb0>
+  805952:	48 89 df             	mov    %rbx,%rdi
+  805955:	41 ff d7             	call   *%r15
+  805958:	84 c0                	test   %al,%al
+  80595a:	74 0c                	je     805968 <mmap_writeback+0xb0>
+  80595c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805963:	4c 39 eb             	cmp    %r13,%rbx
+  805966:	72 e0                	jb     805948 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  805968:	48 89 d9             	mov    %rbx,%rcx
+  80596b:	4c 29 e1             	sub    %r12,%rcx
+  80596e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805972:	44 89 e6             	mov    %r12d,%esi
+  805975:	2b 30                	sub    (%rax),%esi
+  805977:	49 89 c4             	mov    %rax,%r12
+  80597a:	03 70 1c             	add    0x1c(%rax),%esi
+  80597d:	8b 78 18             	mov    0x18(%rax),%edi
+  805980:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  805984:	48 89 ca             	mov    %rcx,%rdx
+  805987:	48 b8 5d 41 80 00 00 	movabs $0x80415d,%rax
+  80598e:	00 00 00 
+  805991:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805993:	85 c0                	test   %eax,%eax
+  805995:	78 44                	js     8059db <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  805997:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80599c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  80599f:	41 89 c1             	mov    %eax,%r9d
+  8059a2:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8059a9:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8059ad:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8059b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8059b6:	48 89 ce             	mov    %rcx,%rsi
+  8059b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059be:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  8059c5:	00 00 00 
+  8059c8:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8059ca:	85 c0                	test   %eax,%eax
+  8059cc:	78 0d                	js     8059db <mmap_writeback+0x123>
+  8059ce:	49 89 dc             	mov    %rbx,%r12
+  8059d1:	e9 49 ff ff ff       	jmp    80591f <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8059d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059db:	48 83 c4 28          	add    $0x28,%rsp
+  8059df:	5b                   	pop    %rbx
+  8059e0:	41 5c                	pop    %r12
+  8059e2:	41 5d                	pop    %r13
+  8059e4:	41 5e                	pop    %r14
+  8059e6:	41 5f                	pop    %r15
+  8059e8:	5d                   	pop    %rbp
+  8059e9:	c3                   	ret
+    return 0;
+  8059ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059ef:	eb ea                	jmp    8059db <mmap_writeback+0x123>
+
+00000000008059f1 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8059f1:	55                   	push   %rbp
+  8059f2:	48 89 e5             	mov    %rsp,%rbp
+  8059f5:	41 57                	push   %r15
+  8059f7:	41 56                	push   %r14
+  8059f9:	41 55                	push   %r13
+  8059fb:	41 54                	push   %r12
+  8059fd:	53                   	push   %rbx
+  8059fe:	48 83 ec 38          	sub    $0x38,%rsp
+  805a02:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805a06:	48 85 f6             	test   %rsi,%rsi
+  805a09:	0f 84 0c 02 00 00    	je     805c1b <mmap+0x22a>
+  805a0f:	49 89 ff             	mov    %rdi,%r15
+  805a12:	49 89 f4             	mov    %rsi,%r12
+  805a15:	41 89 d5             	mov    %edx,%r13d
+  805a18:	41 89 ce             	mov    %ecx,%r14d
+  805a1b:	44 89 cb             	mov    %r9d,%ebx
+  805a1e:	45 85 c9             	test   %r9d,%r9d
+  805a21:	0f 88 f4 01 00 00    	js     805c1b <mmap+0x22a>
+  805a27:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805a2e:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805a35:	0f 85 e7 01 00 00    	jne    805c22 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805a3b:	83 e2 fd             	and    $0xfffffffd,%edx
+  805a3e:	83 fa 04             	cmp    $0x4,%edx
+  805a41:	0f 85 db 01 00 00    	jne    805c22 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805a47:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805a4a:	83 fa 01             	cmp    $0x1,%edx
+  805a4d:	0f 87 cf 01 00 00    	ja     805c22 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805a53:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805a57:	44 89 c7             	mov    %r8d,%edi
+  805a5a:	48 b8 77 34 80 00 00 	movabs $0x803477,%rax
+  805a61:	00 00 00 
+  805a64:	ff d0                	call   *%rax
+  805a66:	89 c2                	mov    %eax,%edx
+  805a68:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805a6f:	85 d2                	test   %edx,%edx
+  805a71:	0f 88 ab 01 00 00    	js     805c22 <mmap+0x231>
+  805a77:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a7b:	48 b9 00 98 80 00 00 	movabs $0x809800,%rcx
+  805a82:	00 00 00 
+  805a85:	8b 09                	mov    (%rcx),%ecx
+  805a87:	39 0a                	cmp    %ecx,(%rdx)
+  805a89:	0f 85 93 01 00 00    	jne    805c22 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805a8f:	8b 52 08             	mov    0x8(%rdx),%edx
+  805a92:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  805a95:	83 fa 01             	cmp    $0x1,%edx
+  805a98:	0f 84 84 01 00 00    	je     805c22 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805a9e:	41 83 fe 01          	cmp    $0x1,%r14d
+  805aa2:	74 42                	je     805ae6 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805aa4:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805aab:	4c 89 e6             	mov    %r12,%rsi
+  805aae:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  805ab5:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805ab9:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805abd:	4d 85 ff             	test   %r15,%r15
+  805ac0:	74 67                	je     805b29 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805ac2:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805ac9:	75 0f                	jne    805ada <mmap+0xe9>
+  805acb:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805ad2:	00 00 00 
+  805ad5:	49 39 c7             	cmp    %rax,%r15
+  805ad8:	77 1b                	ja     805af5 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805ada:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805ae1:	e9 3c 01 00 00       	jmp    805c22 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805ae6:	41 f6 c5 02          	test   $0x2,%r13b
+  805aea:	74 b8                	je     805aa4 <mmap+0xb3>
+  805aec:	85 d2                	test   %edx,%edx
+  805aee:	75 b4                	jne    805aa4 <mmap+0xb3>
+  805af0:	e9 2d 01 00 00       	jmp    805c22 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805af5:	4c 89 ff             	mov    %r15,%rdi
+  805af8:	48 b8 5f 56 80 00 00 	movabs $0x80565f,%rax
+  805aff:	00 00 00 
+  805b02:	ff d0                	call   *%rax
+  805b04:	48 89 c2             	mov    %rax,%rdx
+  805b07:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805b0e:	49 39 d7             	cmp    %rdx,%r15
+  805b11:	0f 85 0b 01 00 00    	jne    805c22 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805b17:	48 b8 40 e8 80 01 00 	movabs $0x180e840,%rax
+  805b1e:	00 00 00 
+  805b21:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805b27:	eb 44                	jmp    805b6d <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805b29:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805b2d:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805b34:	00 00 00 
+  805b37:	48 b8 5f 56 80 00 00 	movabs $0x80565f,%rax
+  805b3e:	00 00 00 
+  805b41:	ff d0                	call   *%rax
+  805b43:	48 89 c7             	mov    %rax,%rdi
+  805b46:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805b4a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805b51:	48 85 ff             	test   %rdi,%rdi
+  805b54:	75 c1                	jne    805b17 <mmap+0x126>
+  805b56:	e9 c7 00 00 00       	jmp    805c22 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805b5b:	49 83 c4 01          	add    $0x1,%r12
+  805b5f:	48 83 c0 20          	add    $0x20,%rax
+  805b63:	49 83 fc 20          	cmp    $0x20,%r12
+  805b67:	0f 84 a5 00 00 00    	je     805c12 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805b6d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805b71:	75 e8                	jne    805b5b <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805b73:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805b77:	48 b8 17 34 80 00 00 	movabs $0x803417,%rax
+  805b7e:	00 00 00 
+  805b81:	ff d0                	call   *%rax
+  805b83:	89 c2                	mov    %eax,%edx
+  805b85:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805b8c:	85 d2                	test   %edx,%edx
+  805b8e:	0f 88 8e 00 00 00    	js     805c22 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805b94:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805b98:	48 b8 e9 33 80 00 00 	movabs $0x8033e9,%rax
+  805b9f:	00 00 00 
+  805ba2:	ff d0                	call   *%rax
+  805ba4:	89 c6                	mov    %eax,%esi
+  805ba6:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805ba9:	48 b8 37 36 80 00 00 	movabs $0x803637,%rax
+  805bb0:	00 00 00 
+  805bb3:	ff d0                	call   *%rax
+  805bb5:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805bb8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805bbf:	45 85 ff             	test   %r15d,%r15d
+  805bc2:	78 5e                	js     805c22 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805bc4:	49 c1 e4 05          	shl    $0x5,%r12
+  805bc8:	48 b8 40 e8 80 01 00 	movabs $0x180e840,%rax
+  805bcf:	00 00 00 
+  805bd2:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805bd5:	48 bf d0 56 80 00 00 	movabs $0x8056d0,%rdi
+  805bdc:	00 00 00 
+  805bdf:	48 b8 3e 5e 80 00 00 	movabs $0x805e3e,%rax
+  805be6:	00 00 00 
+  805be9:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805beb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805bef:	49 89 04 24          	mov    %rax,(%r12)
+  805bf3:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805bf7:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805bfc:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805c01:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805c06:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805c0b:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805c10:	eb 10                	jmp    805c22 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805c12:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805c19:	eb 07                	jmp    805c22 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805c1b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805c22:	48 83 c4 38          	add    $0x38,%rsp
+  805c26:	5b                   	pop    %rbx
+  805c27:	41 5c                	pop    %r12
+  805c29:	41 5d                	pop    %r13
+  805c2b:	41 5e                	pop    %r14
+  805c2d:	41 5f                	pop    %r15
+  805c2f:	5d                   	pop    %rbp
+  805c30:	c3                   	ret
+
+0000000000805c31 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805c31:	55                   	push   %rbp
+  805c32:	48 89 e5             	mov    %rsp,%rbp
+  805c35:	41 57                	push   %r15
+  805c37:	41 56                	push   %r14
+  805c39:	41 55                	push   %r13
+  805c3b:	41 54                	push   %r12
+  805c3d:	53                   	push   %rbx
+  805c3e:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805c42:	49 89 fe             	mov    %rdi,%r14
+  805c45:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805c4c:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805c53:	00 
+  805c54:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805c5b:	48 bb 40 e8 80 01 00 	movabs $0x180e840,%rbx
+  805c62:	00 00 00 
+  805c65:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805c6c:	49 bf b8 58 80 00 00 	movabs $0x8058b8,%r15
+  805c73:	00 00 00 
+  805c76:	eb 09                	jmp    805c81 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805c78:	48 83 c3 20          	add    $0x20,%rbx
+  805c7c:	4c 39 eb             	cmp    %r13,%rbx
+  805c7f:	74 33                	je     805cb4 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805c81:	48 89 df             	mov    %rbx,%rdi
+  805c84:	48 8b 33             	mov    (%rbx),%rsi
+  805c87:	4c 39 e6             	cmp    %r12,%rsi
+  805c8a:	73 ec                	jae    805c78 <msync+0x47>
+  805c8c:	48 85 f6             	test   %rsi,%rsi
+  805c8f:	74 e7                	je     805c78 <msync+0x47>
+  805c91:	48 89 f2             	mov    %rsi,%rdx
+  805c94:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805c98:	49 39 d6             	cmp    %rdx,%r14
+  805c9b:	73 db                	jae    805c78 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805c9d:	4c 39 e2             	cmp    %r12,%rdx
+  805ca0:	49 0f 47 d4          	cmova  %r12,%rdx
+  805ca4:	4c 39 f6             	cmp    %r14,%rsi
+  805ca7:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805cab:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805cae:	85 c0                	test   %eax,%eax
+  805cb0:	79 c6                	jns    805c78 <msync+0x47>
+  805cb2:	eb 05                	jmp    805cb9 <msync+0x88>
+    }
+
+    return 0;
+  805cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805cb9:	48 83 c4 08          	add    $0x8,%rsp
+  805cbd:	5b                   	pop    %rbx
+  805cbe:	41 5c                	pop    %r12
+  805cc0:	41 5d                	pop    %r13
+  805cc2:	41 5e                	pop    %r14
+  805cc4:	41 5f                	pop    %r15
+  805cc6:	5d                   	pop    %rbp
+  805cc7:	c3                   	ret
+
+0000000000805cc8 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805cc8:	55                   	push   %rbp
+  805cc9:	48 89 e5             	mov    %rsp,%rbp
+  805ccc:	41 57                	push   %r15
+  805cce:	41 56                	push   %r14
+  805cd0:	41 55                	push   %r13
+  805cd2:	41 54                	push   %r12
+  805cd4:	53                   	push   %rbx
+  805cd5:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805cd9:	49 89 ff             	mov    %rdi,%r15
+  805cdc:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805ce3:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805cea:	00 
+  805ceb:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805cf2:	48 bb 40 e8 80 01 00 	movabs $0x180e840,%rbx
+  805cf9:	00 00 00 
+  805cfc:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805d03:	48 89 d8             	mov    %rbx,%rax
+  805d06:	eb 09                	jmp    805d11 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805d08:	48 83 c0 20          	add    $0x20,%rax
+  805d0c:	4c 39 f0             	cmp    %r14,%rax
+  805d0f:	74 40                	je     805d51 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805d11:	48 8b 10             	mov    (%rax),%rdx
+  805d14:	4c 39 e2             	cmp    %r12,%rdx
+  805d17:	73 ef                	jae    805d08 <munmap+0x40>
+  805d19:	48 85 d2             	test   %rdx,%rdx
+  805d1c:	74 ea                	je     805d08 <munmap+0x40>
+  805d1e:	48 89 d7             	mov    %rdx,%rdi
+  805d21:	48 03 78 08          	add    0x8(%rax),%rdi
+  805d25:	49 39 ff             	cmp    %rdi,%r15
+  805d28:	73 de                	jae    805d08 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805d2a:	49 39 fc             	cmp    %rdi,%r12
+  805d2d:	72 05                	jb     805d34 <munmap+0x6c>
+  805d2f:	4c 39 fa             	cmp    %r15,%rdx
+  805d32:	73 d4                	jae    805d08 <munmap+0x40>
+  805d34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805d39:	48 83 c4 08          	add    $0x8,%rsp
+  805d3d:	5b                   	pop    %rbx
+  805d3e:	41 5c                	pop    %r12
+  805d40:	41 5d                	pop    %r13
+  805d42:	41 5e                	pop    %r14
+  805d44:	41 5f                	pop    %r15
+  805d46:	5d                   	pop    %rbp
+  805d47:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805d48:	48 83 c3 20          	add    $0x20,%rbx
+  805d4c:	4c 39 f3             	cmp    %r14,%rbx
+  805d4f:	74 5c                	je     805dad <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805d51:	48 8b 33             	mov    (%rbx),%rsi
+  805d54:	4c 39 e6             	cmp    %r12,%rsi
+  805d57:	73 ef                	jae    805d48 <munmap+0x80>
+  805d59:	48 85 f6             	test   %rsi,%rsi
+  805d5c:	74 ea                	je     805d48 <munmap+0x80>
+  805d5e:	48 89 f2             	mov    %rsi,%rdx
+  805d61:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805d65:	49 39 d7             	cmp    %rdx,%r15
+  805d68:	73 de                	jae    805d48 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805d6a:	48 89 df             	mov    %rbx,%rdi
+  805d6d:	48 b8 b8 58 80 00 00 	movabs $0x8058b8,%rax
+  805d74:	00 00 00 
+  805d77:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805d79:	85 c0                	test   %eax,%eax
+  805d7b:	78 bc                	js     805d39 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805d7d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805d81:	48 8b 33             	mov    (%rbx),%rsi
+  805d84:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d89:	48 b8 63 2e 80 00 00 	movabs $0x802e63,%rax
+  805d90:	00 00 00 
+  805d93:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805d95:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805d98:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  805d9f:	00 00 00 
+  805da2:	ff d0                	call   *%rax
+        reg->start = 0;
+  805da4:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805dab:	eb 9b                	jmp    805d48 <munmap+0x80>
+    return 0;
+  805dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  805db2:	eb 85                	jmp    805d39 <munmap+0x71>
+
+0000000000805db4 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805db4:	55                   	push   %rbp
+  805db5:	48 89 e5             	mov    %rsp,%rbp
+  805db8:	41 56                	push   %r14
+  805dba:	41 55                	push   %r13
+  805dbc:	41 54                	push   %r12
+  805dbe:	53                   	push   %rbx
+  805dbf:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805dc2:	48 b8 88 ec 80 01 00 	movabs $0x180ec88,%rax
+  805dc9:	00 00 00 
+  805dcc:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805dd0:	74 27                	je     805df9 <_handle_vectored_pagefault+0x45>
+  805dd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805dd7:	49 bd 40 ec 80 01 00 	movabs $0x180ec40,%r13
+  805dde:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805de1:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805de4:	4c 89 e7             	mov    %r12,%rdi
+  805de7:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805dec:	84 c0                	test   %al,%al
+  805dee:	75 45                	jne    805e35 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805df0:	48 83 c3 01          	add    $0x1,%rbx
+  805df4:	49 3b 1e             	cmp    (%r14),%rbx
+  805df7:	72 eb                	jb     805de4 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805df9:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805e00:	00 
+  805e01:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805e06:	4d 8b 04 24          	mov    (%r12),%r8
+  805e0a:	48 ba 80 71 80 00 00 	movabs $0x807180,%rdx
+  805e11:	00 00 00 
+  805e14:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805e19:	48 bf b0 71 80 00 00 	movabs $0x8071b0,%rdi
+  805e20:	00 00 00 
+  805e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e28:	49 ba 9f 1b 80 00 00 	movabs $0x801b9f,%r10
+  805e2f:	00 00 00 
+  805e32:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805e35:	5b                   	pop    %rbx
+  805e36:	41 5c                	pop    %r12
+  805e38:	41 5d                	pop    %r13
+  805e3a:	41 5e                	pop    %r14
+  805e3c:	5d                   	pop    %rbp
+  805e3d:	c3                   	ret
+
+0000000000805e3e <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805e3e:	55                   	push   %rbp
+  805e3f:	48 89 e5             	mov    %rsp,%rbp
+  805e42:	53                   	push   %rbx
+  805e43:	48 83 ec 08          	sub    $0x8,%rsp
+  805e47:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805e4a:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805e4f:	48 b8 80 ec 80 01 00 	movabs $0x180ec80,%rax
+  805e56:	00 00 00 
+  805e59:	80 38 00             	cmpb   $0x0,(%rax)
+  805e5c:	74 68                	je     805ec6 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805e5e:	48 b8 88 ec 80 01 00 	movabs $0x180ec88,%rax
+  805e65:	00 00 00 
+  805e68:	48 8b 08             	mov    (%rax),%rcx
+  805e6b:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805e70:	48 b8 40 ec 80 01 00 	movabs $0x180ec40,%rax
+  805e77:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805e7a:	48 85 c9             	test   %rcx,%rcx
+  805e7d:	0f 84 e0 00 00 00    	je     805f63 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805e83:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805e87:	0f 84 c9 00 00 00    	je     805f56 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805e8d:	48 83 c2 01          	add    $0x1,%rdx
+  805e91:	48 39 ca             	cmp    %rcx,%rdx
+  805e94:	75 ed                	jne    805e83 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805e96:	48 83 f9 08          	cmp    $0x8,%rcx
+  805e9a:	0f 84 84 00 00 00    	je     805f24 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805ea0:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805ea4:	48 a3 88 ec 80 01 00 	movabs %rax,0x180ec88
+  805eab:	00 00 00 
+  805eae:	48 b8 40 ec 80 01 00 	movabs $0x180ec40,%rax
+  805eb5:	00 00 00 
+  805eb8:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805ebc:	85 f6                	test   %esi,%esi
+  805ebe:	0f 89 97 00 00 00    	jns    805f5b <add_pgfault_handler+0x11d>
+  805ec4:	eb 63                	jmp    805f29 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805ec6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805ecb:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805ed0:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805ed7:	00 00 00 
+  805eda:	bf 00 00 00 00       	mov    $0x0,%edi
+  805edf:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  805ee6:	00 00 00 
+  805ee9:	ff d0                	call   *%rax
+  805eeb:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805eed:	85 c0                	test   %eax,%eax
+  805eef:	78 38                	js     805f29 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805ef1:	48 be 3f 60 80 00 00 	movabs $0x80603f,%rsi
+  805ef8:	00 00 00 
+  805efb:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f00:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  805f07:	00 00 00 
+  805f0a:	ff d0                	call   *%rax
+  805f0c:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805f0e:	85 c0                	test   %eax,%eax
+  805f10:	78 17                	js     805f29 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805f12:	48 b8 80 ec 80 01 00 	movabs $0x180ec80,%rax
+  805f19:	00 00 00 
+  805f1c:	c6 00 01             	movb   $0x1,(%rax)
+  805f1f:	e9 3a ff ff ff       	jmp    805e5e <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805f24:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805f29:	89 f1                	mov    %esi,%ecx
+  805f2b:	48 ba be 71 80 00 00 	movabs $0x8071be,%rdx
+  805f32:	00 00 00 
+  805f35:	be 42 00 00 00       	mov    $0x42,%esi
+  805f3a:	48 bf b0 71 80 00 00 	movabs $0x8071b0,%rdi
+  805f41:	00 00 00 
+  805f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f49:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  805f50:	00 00 00 
+  805f53:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805f56:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805f5b:	89 f0                	mov    %esi,%eax
+  805f5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805f61:	c9                   	leave
+  805f62:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805f63:	48 b8 88 ec 80 01 00 	movabs $0x180ec88,%rax
+  805f6a:	00 00 00 
+  805f6d:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805f74:	48 89 d8             	mov    %rbx,%rax
+  805f77:	48 a3 40 ec 80 01 00 	movabs %rax,0x180ec40
+  805f7e:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805f81:	eb d8                	jmp    805f5b <add_pgfault_handler+0x11d>
+
+0000000000805f83 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805f83:	55                   	push   %rbp
+  805f84:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805f87:	48 b8 80 ec 80 01 00 	movabs $0x180ec80,%rax
+  805f8e:	00 00 00 
+  805f91:	80 38 00             	cmpb   $0x0,(%rax)
+  805f94:	74 33                	je     805fc9 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805f96:	48 a1 88 ec 80 01 00 	movabs 0x180ec88,%rax
+  805f9d:	00 00 00 
+  805fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805fa5:	48 ba 40 ec 80 01 00 	movabs $0x180ec40,%rdx
+  805fac:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805faf:	48 85 c0             	test   %rax,%rax
+  805fb2:	0f 84 85 00 00 00    	je     80603d <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805fb8:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805fbc:	74 40                	je     805ffe <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805fbe:	48 83 c1 01          	add    $0x1,%rcx
+  805fc2:	48 39 c1             	cmp    %rax,%rcx
+  805fc5:	75 f1                	jne    805fb8 <remove_pgfault_handler+0x35>
+  805fc7:	eb 74                	jmp    80603d <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805fc9:	48 b9 d6 71 80 00 00 	movabs $0x8071d6,%rcx
+  805fd0:	00 00 00 
+  805fd3:	48 ba 36 70 80 00 00 	movabs $0x807036,%rdx
+  805fda:	00 00 00 
+  805fdd:	be 48 00 00 00       	mov    $0x48,%esi
+  805fe2:	48 bf b0 71 80 00 00 	movabs $0x8071b0,%rdi
+  805fe9:	00 00 00 
+  805fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ff1:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  805ff8:	00 00 00 
+  805ffb:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805ffe:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  806005:	00 
+  806006:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80600a:	48 29 ca             	sub    %rcx,%rdx
+  80600d:	48 b8 40 ec 80 01 00 	movabs $0x180ec40,%rax
+  806014:	00 00 00 
+  806017:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80601b:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  806020:	48 89 ce             	mov    %rcx,%rsi
+  806023:	48 b8 76 29 80 00 00 	movabs $0x802976,%rax
+  80602a:	00 00 00 
+  80602d:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80602f:	48 b8 88 ec 80 01 00 	movabs $0x180ec88,%rax
+  806036:	00 00 00 
+  806039:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80603d:	5d                   	pop    %rbp
+  80603e:	c3                   	ret
+
+000000000080603f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80603f:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  806042:	48 b8 b4 5d 80 00 00 	movabs $0x805db4,%rax
+  806049:	00 00 00 
+    call *%rax
+  80604c:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  80604e:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  806055:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  806056:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  80605d:	00 
+    subq $8, %rcx
+  80605e:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  806062:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  806065:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80606c:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  80606d:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  806071:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806075:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80607a:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80607f:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806084:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806089:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80608e:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806093:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806098:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80609d:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8060a2:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8060a7:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8060ac:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8060b1:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8060b6:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8060bb:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8060bf:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8060c3:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8060c4:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8060c5:	c3                   	ret
+
+00000000008060c6 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8060c6:	85 ff                	test   %edi,%edi
+  8060c8:	78 58                	js     806122 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8060ca:	48 85 f6             	test   %rsi,%rsi
+  8060cd:	74 12                	je     8060e1 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8060cf:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  8060d6:	00 00 00 
+  8060d9:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8060df:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8060e1:	48 85 c9             	test   %rcx,%rcx
+  8060e4:	74 12                	je     8060f8 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8060e6:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  8060ed:	00 00 00 
+  8060f0:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8060f6:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8060f8:	48 85 d2             	test   %rdx,%rdx
+  8060fb:	74 14                	je     806111 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8060fd:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  806104:	00 00 00 
+  806107:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80610e:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  806111:	48 a1 90 b7 80 01 00 	movabs 0x180b790,%rax
+  806118:	00 00 00 
+  80611b:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  806121:	c3                   	ret
+        if (from_env_store) {
+  806122:	48 85 f6             	test   %rsi,%rsi
+  806125:	74 06                	je     80612d <ipc_result+0x67>
+            *from_env_store = 0;
+  806127:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80612d:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80612f:	48 85 c9             	test   %rcx,%rcx
+  806132:	74 ed                	je     806121 <ipc_result+0x5b>
+            *perm_store = 0;
+  806134:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  80613a:	c3                   	ret
+
+000000000080613b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80613b:	55                   	push   %rbp
+  80613c:	48 89 e5             	mov    %rsp,%rbp
+  80613f:	41 55                	push   %r13
+  806141:	41 54                	push   %r12
+  806143:	53                   	push   %rbx
+  806144:	48 83 ec 08          	sub    $0x8,%rsp
+  806148:	49 89 fc             	mov    %rdi,%r12
+  80614b:	48 89 f7             	mov    %rsi,%rdi
+  80614e:	48 89 d3             	mov    %rdx,%rbx
+  806151:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806154:	48 85 f6             	test   %rsi,%rsi
+  806157:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80615e:	00 00 00 
+  806161:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  806165:	be 00 00 00 00       	mov    $0x0,%esi
+  80616a:	48 85 d2             	test   %rdx,%rdx
+  80616d:	74 03                	je     806172 <ipc_recv+0x37>
+  80616f:	48 8b 32             	mov    (%rdx),%rsi
+  806172:	48 b8 d7 32 80 00 00 	movabs $0x8032d7,%rax
+  806179:	00 00 00 
+  80617c:	ff d0                	call   *%rax
+  80617e:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  806180:	4c 89 e9             	mov    %r13,%rcx
+  806183:	48 89 da             	mov    %rbx,%rdx
+  806186:	4c 89 e6             	mov    %r12,%rsi
+  806189:	48 b8 c6 60 80 00 00 	movabs $0x8060c6,%rax
+  806190:	00 00 00 
+  806193:	ff d0                	call   *%rax
+}
+  806195:	48 83 c4 08          	add    $0x8,%rsp
+  806199:	5b                   	pop    %rbx
+  80619a:	41 5c                	pop    %r12
+  80619c:	41 5d                	pop    %r13
+  80619e:	5d                   	pop    %rbp
+  80619f:	c3                   	ret
+
+00000000008061a0 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8061a0:	55                   	push   %rbp
+  8061a1:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8061a4:	48 85 d2             	test   %rdx,%rdx
+  8061a7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8061ae:	00 00 00 
+  8061b1:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8061b5:	89 f6                	mov    %esi,%esi
+  8061b7:	48 b8 63 31 80 00 00 	movabs $0x803163,%rax
+  8061be:	00 00 00 
+  8061c1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8061c3:	85 c0                	test   %eax,%eax
+  8061c5:	78 02                	js     8061c9 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8061c7:	5d                   	pop    %rbp
+  8061c8:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8061c9:	89 c1                	mov    %eax,%ecx
+  8061cb:	48 ba f0 71 80 00 00 	movabs $0x8071f0,%rdx
+  8061d2:	00 00 00 
+  8061d5:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8061da:	48 bf fd 71 80 00 00 	movabs $0x8071fd,%rdi
+  8061e1:	00 00 00 
+  8061e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061e9:	49 b8 9f 1b 80 00 00 	movabs $0x801b9f,%r8
+  8061f0:	00 00 00 
+  8061f3:	41 ff d0             	call   *%r8
+
+00000000008061f6 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8061f6:	55                   	push   %rbp
+  8061f7:	48 89 e5             	mov    %rsp,%rbp
+  8061fa:	53                   	push   %rbx
+  8061fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8061ff:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  806203:	48 85 d2             	test   %rdx,%rdx
+  806206:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80620d:	00 00 00 
+  806210:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806214:	4d 85 c9             	test   %r9,%r9
+  806217:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80621b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806220:	48 85 db             	test   %rbx,%rbx
+  806223:	74 03                	je     806228 <ipc_call+0x32>
+  806225:	48 8b 03             	mov    (%rbx),%rax
+  806228:	89 f6                	mov    %esi,%esi
+  80622a:	48 83 ec 08          	sub    $0x8,%rsp
+  80622e:	50                   	push   %rax
+  80622f:	48 b8 95 31 80 00 00 	movabs $0x803195,%rax
+  806236:	00 00 00 
+  806239:	ff d0                	call   *%rax
+  80623b:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  80623d:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  806241:	48 89 da             	mov    %rbx,%rdx
+  806244:	be 00 00 00 00       	mov    $0x0,%esi
+  806249:	48 b8 c6 60 80 00 00 	movabs $0x8060c6,%rax
+  806250:	00 00 00 
+  806253:	ff d0                	call   *%rax
+}
+  806255:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806259:	c9                   	leave
+  80625a:	c3                   	ret
+
+000000000080625b <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  80625b:	55                   	push   %rbp
+  80625c:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  80625f:	89 f6                	mov    %esi,%esi
+  806261:	48 b8 01 32 80 00 00 	movabs $0x803201,%rax
+  806268:	00 00 00 
+  80626b:	ff d0                	call   *%rax
+  80626d:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  80626f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806274:	ba 00 00 00 00       	mov    $0x0,%edx
+  806279:	be 00 00 00 00       	mov    $0x0,%esi
+  80627e:	48 b8 c6 60 80 00 00 	movabs $0x8060c6,%rax
+  806285:	00 00 00 
+  806288:	ff d0                	call   *%rax
+}
+  80628a:	5d                   	pop    %rbp
+  80628b:	c3                   	ret
+
+000000000080628c <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80628c:	55                   	push   %rbp
+  80628d:	48 89 e5             	mov    %rsp,%rbp
+  806290:	41 54                	push   %r12
+  806292:	53                   	push   %rbx
+  806293:	4c 89 cb             	mov    %r9,%rbx
+  806296:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80629a:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80629e:	48 85 d2             	test   %rdx,%rdx
+  8062a1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8062a8:	00 00 00 
+  8062ab:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8062af:	4d 85 c9             	test   %r9,%r9
+  8062b2:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8062b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062bb:	4d 85 e4             	test   %r12,%r12
+  8062be:	74 04                	je     8062c4 <ipc_reply_wait+0x38>
+  8062c0:	49 8b 04 24          	mov    (%r12),%rax
+  8062c4:	89 f6                	mov    %esi,%esi
+  8062c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8062ca:	50                   	push   %rax
+  8062cb:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  8062d2:	00 00 00 
+  8062d5:	ff d0                	call   *%rax
+  8062d7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8062d9:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8062dd:	4c 89 e2             	mov    %r12,%rdx
+  8062e0:	48 89 de             	mov    %rbx,%rsi
+  8062e3:	48 b8 c6 60 80 00 00 	movabs $0x8060c6,%rax
+  8062ea:	00 00 00 
+  8062ed:	ff d0                	call   *%rax
+}
+  8062ef:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8062f3:	5b                   	pop    %rbx
+  8062f4:	41 5c                	pop    %r12
+  8062f6:	5d                   	pop    %rbp
+  8062f7:	c3                   	ret
+
+00000000008062f8 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8062f8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8062fd:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  806304:	00 00 00 
+  806307:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80630e:	48 01 ca             	add    %rcx,%rdx
+  806311:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  806317:	39 fa                	cmp    %edi,%edx
+  806319:	74 12                	je     80632d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80631b:	48 83 c0 01          	add    $0x1,%rax
+  80631f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  806325:	75 e0                	jne    806307 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  806327:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80632c:	c3                   	ret
+            return envs[i].env_id;
+  80632d:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  806334:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80633b:	00 00 00 
+  80633e:	48 01 d0             	add    %rdx,%rax
+  806341:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  806347:	c3                   	ret
+
+0000000000806348 <__rodata_start>:
+  806348:	77 00                	ja     80634a <__rodata_start+0x2>
+  80634a:	72 62                	jb     8063ae <__rodata_start+0x66>
+  80634c:	00 77 62             	add    %dh,0x62(%rdi)
+  80634f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  806352:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  806359:	00 
+  80635a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  806360:	b3 09                	mov    $0x9,%bl
+  806362:	80 00 00             	addb   $0x0,(%rax)
+  806365:	00 00                	add    %al,(%rax)
+  806367:	00 ed                	add    %ch,%ch
+  806369:	0d 80 00 00 00       	or     $0x80,%eax
+  80636e:	00 00                	add    %al,(%rax)
+  806370:	ed                   	in     (%dx),%eax
+  806371:	0d 80 00 00 00       	or     $0x80,%eax
+  806376:	00 00                	add    %al,(%rax)
+  806378:	ed                   	in     (%dx),%eax
+  806379:	0d 80 00 00 00       	or     $0x80,%eax
+  80637e:	00 00                	add    %al,(%rax)
+  806380:	ed                   	in     (%dx),%eax
+  806381:	0d 80 00 00 00       	or     $0x80,%eax
+  806386:	00 00                	add    %al,(%rax)
+  806388:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80638d:	00 00                	add    %al,(%rax)
+  80638f:	00 ed                	add    %ch,%ch
+  806391:	0d 80 00 00 00       	or     $0x80,%eax
+  806396:	00 00                	add    %al,(%rax)
+  806398:	ed                   	in     (%dx),%eax
+  806399:	0d 80 00 00 00       	or     $0x80,%eax
+  80639e:	00 00                	add    %al,(%rax)
+  8063a0:	ed                   	in     (%dx),%eax
+  8063a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8063a6:	00 00                	add    %al,(%rax)
+  8063a8:	ed                   	in     (%dx),%eax
+  8063a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063ae:	00 00                	add    %al,(%rax)
+  8063b0:	ed                   	in     (%dx),%eax
+  8063b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8063b6:	00 00                	add    %al,(%rax)
+  8063b8:	8c 0a                	mov    %cs,(%rdx)
+  8063ba:	80 00 00             	addb   $0x0,(%rax)
+  8063bd:	00 00                	add    %al,(%rax)
+  8063bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063c6:	00 00                	add    %al,(%rax)
+  8063c8:	8c 0a                	mov    %cs,(%rdx)
+  8063ca:	80 00 00             	addb   $0x0,(%rax)
+  8063cd:	00 00                	add    %al,(%rax)
+  8063cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063d6:	00 00                	add    %al,(%rax)
+  8063d8:	8c 0a                	mov    %cs,(%rdx)
+  8063da:	80 00 00             	addb   $0x0,(%rax)
+  8063dd:	00 00                	add    %al,(%rax)
+  8063df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063e6:	00 00                	add    %al,(%rax)
+  8063e8:	8c 0a                	mov    %cs,(%rdx)
+  8063ea:	80 00 00             	addb   $0x0,(%rax)
+  8063ed:	00 00                	add    %al,(%rax)
+  8063ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8063f6:	00 00                	add    %al,(%rax)
+  8063f8:	8c 0a                	mov    %cs,(%rdx)
+  8063fa:	80 00 00             	addb   $0x0,(%rax)
+  8063fd:	00 00                	add    %al,(%rax)
+  8063ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806406:	00 00                	add    %al,(%rax)
+  806408:	ed                   	in     (%dx),%eax
+  806409:	0d 80 00 00 00       	or     $0x80,%eax
+  80640e:	00 00                	add    %al,(%rax)
+  806410:	ed                   	in     (%dx),%eax
+  806411:	0d 80 00 00 00       	or     $0x80,%eax
+  806416:	00 00                	add    %al,(%rax)
+  806418:	ed                   	in     (%dx),%eax
+  806419:	0d 80 00 00 00       	or     $0x80,%eax
+  80641e:	00 00                	add    %al,(%rax)
+  806420:	ed                   	in     (%dx),%eax
+  806421:	0d 80 00 00 00       	or     $0x80,%eax
+  806426:	00 00                	add    %al,(%rax)
+  806428:	ed                   	in     (%dx),%eax
+  806429:	0d 80 00 00 00       	or     $0x80,%eax
+  80642e:	00 00                	add    %al,(%rax)
+  806430:	ed                   	in     (%dx),%eax
+  806431:	0d 80 00 00 00       	or     $0x80,%eax
+  806436:	00 00                	add    %al,(%rax)
+  806438:	ed                   	in     (%dx),%eax
+  806439:	0d 80 00 00 00       	or     $0x80,%eax
+  80643e:	00 00                	add    %al,(%rax)
+  806440:	ed                   	in     (%dx),%eax
+  806441:	0d 80 00 00 00       	or     $0x80,%eax
+  806446:	00 00                	add    %al,(%rax)
+  806448:	ed                   	in     (%dx),%eax
+  806449:	0d 80 00 00 00       	or     $0x80,%eax
+  80644e:	00 00                	add    %al,(%rax)
+  806450:	ed                   	in     (%dx),%eax
+  806451:	0d 80 00 00 00       	or     $0x80,%eax
+  806456:	00 00                	add    %al,(%rax)
+  806458:	ed                   	in     (%dx),%eax
+  806459:	0d 80 00 00 00       	or     $0x80,%eax
+  80645e:	00 00                	add    %al,(%rax)
+  806460:	ed                   	in     (%dx),%eax
+  806461:	0d 80 00 00 00       	or     $0x80,%eax
+  806466:	00 00                	add    %al,(%rax)
+  806468:	ed                   	in     (%dx),%eax
+  806469:	0d 80 00 00 00       	or     $0x80,%eax
+  80646e:	00 00                	add    %al,(%rax)
+  806470:	ed                   	in     (%dx),%eax
+  806471:	0d 80 00 00 00       	or     $0x80,%eax
+  806476:	00 00                	add    %al,(%rax)
+  806478:	ed                   	in     (%dx),%eax
+  806479:	0d 80 00 00 00       	or     $0x80,%eax
+  80647e:	00 00                	add    %al,(%rax)
+  806480:	ed                   	in     (%dx),%eax
+  806481:	0d 80 00 00 00       	or     $0x80,%eax
+  806486:	00 00                	add    %al,(%rax)
+  806488:	ed                   	in     (%dx),%eax
+  806489:	0d 80 00 00 00       	or     $0x80,%eax
+  80648e:	00 00                	add    %al,(%rax)
+  806490:	ed                   	in     (%dx),%eax
+  806491:	0d 80 00 00 00       	or     $0x80,%eax
+  806496:	00 00                	add    %al,(%rax)
+  806498:	ed                   	in     (%dx),%eax
+  806499:	0d 80 00 00 00       	or     $0x80,%eax
+  80649e:	00 00                	add    %al,(%rax)
+  8064a0:	ed                   	in     (%dx),%eax
+  8064a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064a6:	00 00                	add    %al,(%rax)
+  8064a8:	ed                   	in     (%dx),%eax
+  8064a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064ae:	00 00                	add    %al,(%rax)
+  8064b0:	ed                   	in     (%dx),%eax
+  8064b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064b6:	00 00                	add    %al,(%rax)
+  8064b8:	ed                   	in     (%dx),%eax
+  8064b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064be:	00 00                	add    %al,(%rax)
+  8064c0:	ed                   	in     (%dx),%eax
+  8064c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064c6:	00 00                	add    %al,(%rax)
+  8064c8:	ed                   	in     (%dx),%eax
+  8064c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064ce:	00 00                	add    %al,(%rax)
+  8064d0:	ed                   	in     (%dx),%eax
+  8064d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064d6:	00 00                	add    %al,(%rax)
+  8064d8:	ed                   	in     (%dx),%eax
+  8064d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064de:	00 00                	add    %al,(%rax)
+  8064e0:	ed                   	in     (%dx),%eax
+  8064e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064e6:	00 00                	add    %al,(%rax)
+  8064e8:	ed                   	in     (%dx),%eax
+  8064e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064ee:	00 00                	add    %al,(%rax)
+  8064f0:	ed                   	in     (%dx),%eax
+  8064f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064f6:	00 00                	add    %al,(%rax)
+  8064f8:	f4                   	hlt
+  8064f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8064ff:	00 ed                	add    %ch,%ch
+  806501:	0d 80 00 00 00       	or     $0x80,%eax
+  806506:	00 00                	add    %al,(%rax)
+  806508:	ed                   	in     (%dx),%eax
+  806509:	0d 80 00 00 00       	or     $0x80,%eax
+  80650e:	00 00                	add    %al,(%rax)
+  806510:	2c 0b                	sub    $0xb,%al
+  806512:	80 00 00             	addb   $0x0,(%rax)
+  806515:	00 00                	add    %al,(%rax)
+  806517:	00 ed                	add    %ch,%ch
+  806519:	0d 80 00 00 00       	or     $0x80,%eax
+  80651e:	00 00                	add    %al,(%rax)
+  806520:	ed                   	in     (%dx),%eax
+  806521:	0d 80 00 00 00       	or     $0x80,%eax
+  806526:	00 00                	add    %al,(%rax)
+  806528:	ed                   	in     (%dx),%eax
+  806529:	0d 80 00 00 00       	or     $0x80,%eax
+  80652e:	00 00                	add    %al,(%rax)
+  806530:	ed                   	in     (%dx),%eax
+  806531:	0d 80 00 00 00       	or     $0x80,%eax
+  806536:	00 00                	add    %al,(%rax)
+  806538:	ed                   	in     (%dx),%eax
+  806539:	0d 80 00 00 00       	or     $0x80,%eax
+  80653e:	00 00                	add    %al,(%rax)
+  806540:	ed                   	in     (%dx),%eax
+  806541:	0d 80 00 00 00       	or     $0x80,%eax
+  806546:	00 00                	add    %al,(%rax)
+  806548:	ed                   	in     (%dx),%eax
+  806549:	0d 80 00 00 00       	or     $0x80,%eax
+  80654e:	00 00                	add    %al,(%rax)
+  806550:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806553:	00 00                	add    %al,(%rax)
+  806555:	00 00                	add    %al,(%rax)
+  806557:	00 cb                	add    %cl,%bl
+  806559:	0d 80 00 00 00       	or     $0x80,%eax
+  80655e:	00 00                	add    %al,(%rax)
+  806560:	ed                   	in     (%dx),%eax
+  806561:	0d 80 00 00 00       	or     $0x80,%eax
+  806566:	00 00                	add    %al,(%rax)
+  806568:	ed                   	in     (%dx),%eax
+  806569:	0d 80 00 00 00       	or     $0x80,%eax
+  80656e:	00 00                	add    %al,(%rax)
+  806570:	ed                   	in     (%dx),%eax
+  806571:	0d 80 00 00 00       	or     $0x80,%eax
+  806576:	00 00                	add    %al,(%rax)
+  806578:	6a 0a                	push   $0xa
+  80657a:	80 00 00             	addb   $0x0,(%rax)
+  80657d:	00 00                	add    %al,(%rax)
+  80657f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806585:	00 00                	add    %al,(%rax)
+  806587:	00 ed                	add    %ch,%ch
+  806589:	0d 80 00 00 00       	or     $0x80,%eax
+  80658e:	00 00                	add    %al,(%rax)
+  806590:	ed                   	in     (%dx),%eax
+  806591:	0d 80 00 00 00       	or     $0x80,%eax
+  806596:	00 00                	add    %al,(%rax)
+  806598:	3c 0a                	cmp    $0xa,%al
+  80659a:	80 00 00             	addb   $0x0,(%rax)
+  80659d:	00 00                	add    %al,(%rax)
+  80659f:	00 ed                	add    %ch,%ch
+  8065a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065a6:	00 00                	add    %al,(%rax)
+  8065a8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  8065ab:	00 00                	add    %al,(%rax)
+  8065ad:	00 00                	add    %al,(%rax)
+  8065af:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  8065b5:	00 00                	add    %al,(%rax)
+  8065b7:	00 29                	add    %ch,(%rcx)
+  8065b9:	0c 80                	or     $0x80,%al
+  8065bb:	00 00                	add    %al,(%rax)
+  8065bd:	00 00                	add    %al,(%rax)
+  8065bf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8065c2:	80 00 00             	addb   $0x0,(%rax)
+  8065c5:	00 00                	add    %al,(%rax)
+  8065c7:	00 ed                	add    %ch,%ch
+  8065c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ce:	00 00                	add    %al,(%rax)
+  8065d0:	1a 0b                	sbb    (%rbx),%cl
+  8065d2:	80 00 00             	addb   $0x0,(%rax)
+  8065d5:	00 00                	add    %al,(%rax)
+  8065d7:	00 ed                	add    %ch,%ch
+  8065d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065de:	00 00                	add    %al,(%rax)
+  8065e0:	ce                   	(bad)
+  8065e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8065e7:	00 ed                	add    %ch,%ch
+  8065e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ee:	00 00                	add    %al,(%rax)
+  8065f0:	ed                   	in     (%dx),%eax
+  8065f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065f6:	00 00                	add    %al,(%rax)
+  8065f8:	f4                   	hlt
+  8065f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8065ff:	00 37                	add    %dh,(%rdi)
+  806601:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806607:	00 5f 12             	add    %bl,0x12(%rdi)
+  80660a:	80 00 00             	addb   $0x0,(%rax)
+  80660d:	00 00                	add    %al,(%rax)
+  80660f:	00 37                	add    %dh,(%rdi)
+  806611:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806617:	00 5f 12             	add    %bl,0x12(%rdi)
+  80661a:	80 00 00             	addb   $0x0,(%rax)
+  80661d:	00 00                	add    %al,(%rax)
+  80661f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806622:	80 00 00             	addb   $0x0,(%rax)
+  806625:	00 00                	add    %al,(%rax)
+  806627:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80662b:	00 00                	add    %al,(%rax)
+  80662d:	00 00                	add    %al,(%rax)
+  80662f:	00 d2                	add    %dl,%dl
+  806631:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806637:	00 d2                	add    %dl,%dl
+  806639:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80663f:	00 d2                	add    %dl,%dl
+  806641:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806647:	00 d2                	add    %dl,%dl
+  806649:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80664f:	00 d2                	add    %dl,%dl
+  806651:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806657:	00 d2                	add    %dl,%dl
+  806659:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80665f:	00 d2                	add    %dl,%dl
+  806661:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806667:	00 f6                	add    %dh,%dh
+  806669:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80666f:	00 f6                	add    %dh,%dh
+  806671:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806677:	00 5f 12             	add    %bl,0x12(%rdi)
+  80667a:	80 00 00             	addb   $0x0,(%rax)
+  80667d:	00 00                	add    %al,(%rax)
+  80667f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806682:	80 00 00             	addb   $0x0,(%rax)
+  806685:	00 00                	add    %al,(%rax)
+  806687:	00 5f 12             	add    %bl,0x12(%rdi)
+  80668a:	80 00 00             	addb   $0x0,(%rax)
+  80668d:	00 00                	add    %al,(%rax)
+  80668f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806692:	80 00 00             	addb   $0x0,(%rax)
+  806695:	00 00                	add    %al,(%rax)
+  806697:	00 5f 12             	add    %bl,0x12(%rdi)
+  80669a:	80 00 00             	addb   $0x0,(%rax)
+  80669d:	00 00                	add    %al,(%rax)
+  80669f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066a2:	80 00 00             	addb   $0x0,(%rax)
+  8066a5:	00 00                	add    %al,(%rax)
+  8066a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066aa:	80 00 00             	addb   $0x0,(%rax)
+  8066ad:	00 00                	add    %al,(%rax)
+  8066af:	00 22                	add    %ah,(%rdx)
+  8066b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066b7:	00 22                	add    %ah,(%rdx)
+  8066b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066bf:	00 22                	add    %ah,(%rdx)
+  8066c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066c7:	00 22                	add    %ah,(%rdx)
+  8066c9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066cf:	00 22                	add    %ah,(%rdx)
+  8066d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066d7:	00 22                	add    %ah,(%rdx)
+  8066d9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066e2:	80 00 00             	addb   $0x0,(%rax)
+  8066e5:	00 00                	add    %al,(%rax)
+  8066e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066ea:	80 00 00             	addb   $0x0,(%rax)
+  8066ed:	00 00                	add    %al,(%rax)
+  8066ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066f2:	80 00 00             	addb   $0x0,(%rax)
+  8066f5:	00 00                	add    %al,(%rax)
+  8066f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066fa:	80 00 00             	addb   $0x0,(%rax)
+  8066fd:	00 00                	add    %al,(%rax)
+  8066ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806702:	80 00 00             	addb   $0x0,(%rax)
+  806705:	00 00                	add    %al,(%rax)
+  806707:	00 5f 12             	add    %bl,0x12(%rdi)
+  80670a:	80 00 00             	addb   $0x0,(%rax)
+  80670d:	00 00                	add    %al,(%rax)
+  80670f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806712:	80 00 00             	addb   $0x0,(%rax)
+  806715:	00 00                	add    %al,(%rax)
+  806717:	00 5f 12             	add    %bl,0x12(%rdi)
+  80671a:	80 00 00             	addb   $0x0,(%rax)
+  80671d:	00 00                	add    %al,(%rax)
+  80671f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806722:	80 00 00             	addb   $0x0,(%rax)
+  806725:	00 00                	add    %al,(%rax)
+  806727:	00 5f 12             	add    %bl,0x12(%rdi)
+  80672a:	80 00 00             	addb   $0x0,(%rax)
+  80672d:	00 00                	add    %al,(%rax)
+  80672f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806732:	80 00 00             	addb   $0x0,(%rax)
+  806735:	00 00                	add    %al,(%rax)
+  806737:	00 5f 12             	add    %bl,0x12(%rdi)
+  80673a:	80 00 00             	addb   $0x0,(%rax)
+  80673d:	00 00                	add    %al,(%rax)
+  80673f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806742:	80 00 00             	addb   $0x0,(%rax)
+  806745:	00 00                	add    %al,(%rax)
+  806747:	00 5f 12             	add    %bl,0x12(%rdi)
+  80674a:	80 00 00             	addb   $0x0,(%rax)
+  80674d:	00 00                	add    %al,(%rax)
+  80674f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806752:	80 00 00             	addb   $0x0,(%rax)
+  806755:	00 00                	add    %al,(%rax)
+  806757:	00 5f 12             	add    %bl,0x12(%rdi)
+  80675a:	80 00 00             	addb   $0x0,(%rax)
+  80675d:	00 00                	add    %al,(%rax)
+  80675f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806762:	80 00 00             	addb   $0x0,(%rax)
+  806765:	00 00                	add    %al,(%rax)
+  806767:	00 46 12             	add    %al,0x12(%rsi)
+  80676a:	80 00 00             	addb   $0x0,(%rax)
+  80676d:	00 00                	add    %al,(%rax)
+  80676f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806772:	80 00 00             	addb   $0x0,(%rax)
+  806775:	00 00                	add    %al,(%rax)
+  806777:	00 5f 12             	add    %bl,0x12(%rdi)
+  80677a:	80 00 00             	addb   $0x0,(%rax)
+  80677d:	00 00                	add    %al,(%rax)
+  80677f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806782:	80 00 00             	addb   $0x0,(%rax)
+  806785:	00 00                	add    %al,(%rax)
+  806787:	00 5f 12             	add    %bl,0x12(%rdi)
+  80678a:	80 00 00             	addb   $0x0,(%rax)
+  80678d:	00 00                	add    %al,(%rax)
+  80678f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806792:	80 00 00             	addb   $0x0,(%rax)
+  806795:	00 00                	add    %al,(%rax)
+  806797:	00 5f 12             	add    %bl,0x12(%rdi)
+  80679a:	80 00 00             	addb   $0x0,(%rax)
+  80679d:	00 00                	add    %al,(%rax)
+  80679f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067a2:	80 00 00             	addb   $0x0,(%rax)
+  8067a5:	00 00                	add    %al,(%rax)
+  8067a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067aa:	80 00 00             	addb   $0x0,(%rax)
+  8067ad:	00 00                	add    %al,(%rax)
+  8067af:	00 22                	add    %ah,(%rdx)
+  8067b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067b7:	00 22                	add    %ah,(%rdx)
+  8067b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067bf:	00 22                	add    %ah,(%rdx)
+  8067c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067c7:	00 22                	add    %ah,(%rdx)
+  8067c9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067cf:	00 22                	add    %ah,(%rdx)
+  8067d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067d7:	00 22                	add    %ah,(%rdx)
+  8067d9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067e2:	80 00 00             	addb   $0x0,(%rax)
+  8067e5:	00 00                	add    %al,(%rax)
+  8067e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067ea:	80 00 00             	addb   $0x0,(%rax)
+  8067ed:	00 00                	add    %al,(%rax)
+  8067ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067f2:	80 00 00             	addb   $0x0,(%rax)
+  8067f5:	00 00                	add    %al,(%rax)
+  8067f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067fa:	80 00 00             	addb   $0x0,(%rax)
+  8067fd:	00 00                	add    %al,(%rax)
+  8067ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806802:	80 00 00             	addb   $0x0,(%rax)
+  806805:	00 00                	add    %al,(%rax)
+  806807:	00 5f 12             	add    %bl,0x12(%rdi)
+  80680a:	80 00 00             	addb   $0x0,(%rax)
+  80680d:	00 00                	add    %al,(%rax)
+  80680f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806812:	80 00 00             	addb   $0x0,(%rax)
+  806815:	00 00                	add    %al,(%rax)
+  806817:	00 5f 12             	add    %bl,0x12(%rdi)
+  80681a:	80 00 00             	addb   $0x0,(%rax)
+  80681d:	00 00                	add    %al,(%rax)
+  80681f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806822:	80 00 00             	addb   $0x0,(%rax)
+  806825:	00 00                	add    %al,(%rax)
+  806827:	00 5f 12             	add    %bl,0x12(%rdi)
+  80682a:	80 00 00             	addb   $0x0,(%rax)
+  80682d:	00 00                	add    %al,(%rax)
+  80682f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806832:	80 00 00             	addb   $0x0,(%rax)
+  806835:	00 00                	add    %al,(%rax)
+  806837:	00 5f 12             	add    %bl,0x12(%rdi)
+  80683a:	80 00 00             	addb   $0x0,(%rax)
+  80683d:	00 00                	add    %al,(%rax)
+  80683f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806842:	80 00 00             	addb   $0x0,(%rax)
+  806845:	00 00                	add    %al,(%rax)
+  806847:	00 5f 12             	add    %bl,0x12(%rdi)
+  80684a:	80 00 00             	addb   $0x0,(%rax)
+  80684d:	00 00                	add    %al,(%rax)
+  80684f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806852:	80 00 00             	addb   $0x0,(%rax)
+  806855:	00 00                	add    %al,(%rax)
+  806857:	00 5f 12             	add    %bl,0x12(%rdi)
+  80685a:	80 00 00             	addb   $0x0,(%rax)
+  80685d:	00 00                	add    %al,(%rax)
+  80685f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806862:	80 00 00             	addb   $0x0,(%rax)
+  806865:	00 00                	add    %al,(%rax)
+  806867:	00 46 12             	add    %al,0x12(%rsi)
+  80686a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806880 <basefix.0>:
+  806880:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806890:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  8068a0:	10 00 69 6e 69 74 3a 20 72 75 6e 6e 69 6e 67 0a     ..init: running.
+  8068b0:	00 69 6e 69 74 3a 20 64 61 74 61 20 73 65 65 6d     .init: data seem
+  8068c0:	73 20 6f 6b 61 79 0a 00 69 6e 69 74 3a 20 62 73     s okay..init: bs
+  8068d0:	73 20 73 65 65 6d 73 20 6f 6b 61 79 0a 00 69 6e     s seems okay..in
+  8068e0:	69 74 3a 20 61 72 67 73 3a 00 20 27 00 25 73 0a     it: args:. '.%s.
+  8068f0:	00 69 6e 69 74 3a 20 72 75 6e 6e 69 6e 67 20 73     .init: running s
+  806900:	68 0a 00 6f 70 65 6e 63 6f 6e 73 3a 20 25 69 00     h..opencons: %i.
+  806910:	75 73 65 72 2f 69 6e 69 74 2e 63 00 66 69 72 73     user/init.c.firs
+  806920:	74 20 6f 70 65 6e 63 6f 6e 73 20 75 73 65 64 20     t opencons used 
+  806930:	66 64 20 25 64 00 64 75 70 3a 20 25 69 00 69 6e     fd %d.dup: %i.in
+  806940:	69 74 3a 20 73 74 61 72 74 69 6e 67 20 73 68 0a     it: starting sh.
+  806950:	00 2f 73 68 00 69 6e 69 74 3a 20 73 70 61 77 6e     ./sh.init: spawn
+  806960:	20 73 68 3a 20 25 69 0a 00 0f 1f 80 00 00 00 00      sh: %i.........
+  806970:	69 6e 69 74 3a 20 64 61 74 61 20 69 73 20 6e 6f     init: data is no
+  806980:	74 20 69 6e 69 74 69 61 6c 69 7a 65 64 3a 20 67     t initialized: g
+  806990:	6f 74 20 73 75 6d 20 25 30 38 78 20 77 61 6e 74     ot sum %08x want
+  8069a0:	65 64 20 25 30 38 78 0a 00 00 00 00 00 00 00 00     ed %08x.........
+  8069b0:	62 73 73 20 69 73 20 6e 6f 74 20 69 6e 69 74 69     bss is not initi
+  8069c0:	61 6c 69 7a 65 64 3a 20 77 61 6e 74 65 64 20 73     alized: wanted s
+  8069d0:	75 6d 20 30 20 67 6f 74 20 25 30 38 78 0a 00 3c     um 0 got %08x..<
+  8069e0:	63 6f 6e 73 3e 00 63 6f 6e 73 00 3c 75 6e 6b 6e     cons>.cons.<unkn
+  8069f0:	6f 77 6e 3e 00 0f 1f 00 5b 25 30 38 78 5d 20 75     own>....[%08x] u
+  806a00:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806a10:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  806a20:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  806a30:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  806a40:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  806a50:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  806a60:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  806a70:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  806a80:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  806a90:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  806aa0:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  806ab0:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  806ac0:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  806ad0:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  806ae0:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  806af0:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  806b00:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  806b10:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  806b20:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  806b30:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  806b40:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  806b50:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  806b60:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  806b70:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  806b80:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  806b90:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  806ba0:	73 75 70 70 6f 72 74 65 64 00 66 2e 0f 1f 84 00     supported.f.....
+  806bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  806bc0:	e7 1e 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     ........>%......
+  806bd0:	2e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     .%......>%......
+  806be0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806bf0:	3e 25 80 00 00 00 00 00 06 1f 80 00 00 00 00 00     >%..............
+  806c00:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806c10:	fa 1e 80 00 00 00 00 00 74 1f 80 00 00 00 00 00     ........t.......
+  806c20:	3e 25 80 00 00 00 00 00 fa 1e 80 00 00 00 00 00     >%..............
+  806c30:	40 1f 80 00 00 00 00 00 40 1f 80 00 00 00 00 00     @.......@.......
+  806c40:	40 1f 80 00 00 00 00 00 40 1f 80 00 00 00 00 00     @.......@.......
+  806c50:	40 1f 80 00 00 00 00 00 40 1f 80 00 00 00 00 00     @.......@.......
+  806c60:	40 1f 80 00 00 00 00 00 40 1f 80 00 00 00 00 00     @.......@.......
+  806c70:	40 1f 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     @.......>%......
+  806c80:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806c90:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806ca0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806cb0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806cc0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806cd0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806ce0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806cf0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d00:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d10:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d20:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d30:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d40:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d50:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d60:	3e 25 80 00 00 00 00 00 5c 24 80 00 00 00 00 00     >%......\$......
+  806d70:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d80:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806d90:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806da0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806db0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806dc0:	a2 1f 80 00 00 00 00 00 71 21 80 00 00 00 00 00     ........q!......
+  806dd0:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806de0:	3e 25 80 00 00 00 00 00 97 1f 80 00 00 00 00 00     >%..............
+  806df0:	d1 1f 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     ........>%......
+  806e00:	3e 25 80 00 00 00 00 00 8c 1f 80 00 00 00 00 00     >%..............
+  806e10:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806e20:	1a 23 80 00 00 00 00 00 e9 23 80 00 00 00 00 00     .#.......#......
+  806e30:	3e 25 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     >%......>%......
+  806e40:	68 20 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     h ......>%......
+  806e50:	45 22 80 00 00 00 00 00 3e 25 80 00 00 00 00 00     E"......>%......
+  806e60:	3e 25 80 00 00 00 00 00 5c 24 80 00 00 00 00 00     >%......\$......
+  806e70:	3e 25 80 00 00 00 00 00 f0 1e 80 00 00 00 00 00     >%..............
+
+0000000000806e80 <error_string>:
+	...
+  806e88:	4d 6a 80 00 00 00 00 00 5f 6a 80 00 00 00 00 00     Mj......_j......
+  806e98:	6f 6a 80 00 00 00 00 00 81 6a 80 00 00 00 00 00     oj.......j......
+  806ea8:	8f 6a 80 00 00 00 00 00 a3 6a 80 00 00 00 00 00     .j.......j......
+  806eb8:	b8 6a 80 00 00 00 00 00 cb 6a 80 00 00 00 00 00     .j.......j......
+  806ec8:	dd 6a 80 00 00 00 00 00 f1 6a 80 00 00 00 00 00     .j.......j......
+  806ed8:	01 6b 80 00 00 00 00 00 14 6b 80 00 00 00 00 00     .k.......k......
+  806ee8:	2b 6b 80 00 00 00 00 00 41 6b 80 00 00 00 00 00     +k......Ak......
+  806ef8:	59 6b 80 00 00 00 00 00 71 6b 80 00 00 00 00 00     Yk......qk......
+  806f08:	7e 6b 80 00 00 00 00 00 20 6f 80 00 00 00 00 00     ~k...... o......
+  806f18:	92 6b 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .k......file is 
+  806f28:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806f38:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806f48:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806f58:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806f68:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806f78:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806f88:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806f98:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806fa8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806fb8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806fc8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806fd8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806fe8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806ff8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000807000 <devtab>:
+  807000:	00 98 80 00 00 00 00 00 40 98 80 00 00 00 00 00     ........@.......
+  807010:	c0 97 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  807020:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  807030:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  807040:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  807050:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  807060:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  807070:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  807080:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  807090:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  8070a0:	28 63 68 61 72 20 2a 29 73 74 61 63 6b 20 2b 20     (char *)stack + 
+  8070b0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  8070c0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  8070d0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8070e0:	72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 73 70 61     ror: %i..lib/spa
+  8070f0:	77 6e 2e 63 00 45 6c 66 20 6d 61 67 69 63 20 25     wn.c.Elf magic %
+  807100:	30 38 78 20 77 61 6e 74 20 25 30 38 78 0a 00 3c     08x want %08x..<
+  807110:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  807120:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  807130:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  807140:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  807150:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  807160:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  807170:	00 61 64 64 72 20 3d 3d 20 30 00 0f 1f 44 00 00     .addr == 0...D..
+  807180:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  807190:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8071a0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8071b0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8071c0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8071d0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8071e0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8071f0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  807200:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  807210:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807220:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807230:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807240:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807250:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807260:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807270:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807280:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807290:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8072a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8072b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8072c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8072d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8072e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8072f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807300:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807310:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807320:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807330:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807340:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807350:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807360:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807370:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807380:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807390:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8073a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8073b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8073c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8073d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8073e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8073f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807400:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807410:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807420:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807430:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807440:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807450:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807460:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807470:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807480:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807490:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8074a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8074b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8074c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8074d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8074e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8074f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8075a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8075b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8075c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8075d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8075e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8075f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8076a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8076b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8076c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8076d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8076e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8076f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8077a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8077b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8077c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8077d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8077e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8077f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8078a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8078b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8078c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8078d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8078e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8078f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8079a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8079b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8079c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8079d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8079e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8079f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,10801 @@
+
+obj/user/ipcbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 7c 3a 80 00 00 	movabs $0x803a7c,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 7c 3a 80 00 00 	movabs $0x803a7c,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 52 44 80 00 00 	movabs $0x804452,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 52 44 80 00 00 	movabs $0x804452,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 3b 19 80 00 00 	movabs $0x80193b,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 0f 63 80 00 00 	movabs $0x80630f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 a7 24 80 00 00 	movabs $0x8024a7,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be b0 5c 80 00 00 	movabs $0x805cb0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 a7 24 80 00 00 	movabs $0x8024a7,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be b2 5c 80 00 00 	movabs $0x805cb2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 a7 24 80 00 00 	movabs $0x8024a7,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be b5 5c 80 00 00 	movabs $0x805cb5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 a7 24 80 00 00 	movabs $0x8024a7,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 1d 53 80 00 00 	movabs $0x80531d,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 f4 55 80 00 00 	movabs $0x8055f4,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 cf 37 80 00 00 	movabs $0x8037cf,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 66 3b 80 00 00 	movabs $0x803b66,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 2f 3c 80 00 00 	movabs $0x803c2f,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 35 3b 80 00 00 	movabs $0x803b35,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 35 3b 80 00 00 	movabs $0x803b35,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 4d 39 80 00 00 	movabs $0x80394d,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 7c 3a 80 00 00 	movabs $0x803a7c,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 cf 37 80 00 00 	movabs $0x8037cf,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 54 26 80 00 00 	movabs $0x802654,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 5c 80 00 00 	movabs $0x805cc0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 54 26 80 00 00 	movabs $0x802654,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 54 26 80 00 00 	movabs $0x802654,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 5f 80 00 00 	movabs $0x805f60,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 54 26 80 00 00 	movabs $0x802654,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 54 26 80 00 00 	movabs $0x802654,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 93 03 00 00       	call   801892 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <send>:
+    MODE_SEND,
+    MODE_CALL,
+};
+
+static void
+send(envid_t to, uint32_t val, enum Mode mode) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 08          	sub    $0x8,%rsp
+  801512:	89 fb                	mov    %edi,%ebx
+  801514:	41 89 f4             	mov    %esi,%r12d
+    while ((res = sys_ipc_try_send(to, val, (void *)MAX_USER_ADDRESS, 0, 0)) == -E_IPC_NOT_RECV)
+  801517:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+  80151e:	00 00 00 
+  801521:	49 bd f0 2e 80 00 00 	movabs $0x802ef0,%r13
+  801528:	00 00 00 
+        sys_yield();
+  80152b:	49 bf a9 2a 80 00 00 	movabs $0x802aa9,%r15
+  801532:	00 00 00 
+    if (mode == MODE_TRY_SEND)
+  801535:	85 d2                	test   %edx,%edx
+  801537:	74 2e                	je     801567 <send+0x66>
+        spin_send(to, val);
+    else
+        ipc_send(to, val, NULL, 0, 0);
+  801539:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801544:	ba 00 00 00 00       	mov    $0x0,%edx
+  801549:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  801550:	00 00 00 
+  801553:	ff d0                	call   *%rax
+}
+  801555:	48 83 c4 08          	add    $0x8,%rsp
+  801559:	5b                   	pop    %rbx
+  80155a:	41 5c                	pop    %r12
+  80155c:	41 5d                	pop    %r13
+  80155e:	41 5e                	pop    %r14
+  801560:	41 5f                	pop    %r15
+  801562:	5d                   	pop    %rbp
+  801563:	c3                   	ret
+        sys_yield();
+  801564:	41 ff d7             	call   *%r15
+    while ((res = sys_ipc_try_send(to, val, (void *)MAX_USER_ADDRESS, 0, 0)) == -E_IPC_NOT_RECV)
+  801567:	44 89 e6             	mov    %r12d,%esi
+  80156a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801575:	4c 89 f2             	mov    %r14,%rdx
+  801578:	89 df                	mov    %ebx,%edi
+  80157a:	41 ff d5             	call   *%r13
+  80157d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801580:	74 e2                	je     801564 <send+0x63>
+    if (res < 0) panic("sys_ipc_try_send: %i", res);
+  801582:	85 c0                	test   %eax,%eax
+  801584:	79 cf                	jns    801555 <send+0x54>
+  801586:	89 c1                	mov    %eax,%ecx
+  801588:	48 ba 02 62 80 00 00 	movabs $0x806202,%rdx
+  80158f:	00 00 00 
+  801592:	be 0e 00 00 00       	mov    $0xe,%esi
+  801597:	48 bf 17 62 80 00 00 	movabs $0x806217,%rdi
+  80159e:	00 00 00 
+  8015a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a6:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  8015ad:	00 00 00 
+  8015b0:	41 ff d0             	call   *%r8
+
+00000000008015b3 <bench>:
+
+static void
+bench(const char *name, long rounds, enum Mode mode) {
+  8015b3:	55                   	push   %rbp
+  8015b4:	48 89 e5             	mov    %rsp,%rbp
+  8015b7:	41 57                	push   %r15
+  8015b9:	41 56                	push   %r14
+  8015bb:	41 55                	push   %r13
+  8015bd:	41 54                	push   %r12
+  8015bf:	53                   	push   %rbx
+  8015c0:	48 83 ec 28          	sub    $0x28,%rsp
+  8015c4:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8015c8:	49 89 f5             	mov    %rsi,%r13
+  8015cb:	41 89 d4             	mov    %edx,%r12d
+    envid_t who = fork();
+  8015ce:	48 b8 a8 31 80 00 00 	movabs $0x8031a8,%rax
+  8015d5:	00 00 00 
+  8015d8:	ff d0                	call   *%rax
+  8015da:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    if (who < 0) panic("fork: %i", who);
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	78 38                	js     801619 <bench+0x66>
+
+    if (!who) {
+  8015e1:	74 63                	je     801646 <bench+0x93>
+        }
+        send(who, val, mode);
+        exit();
+    }
+
+    uint32_t start = vsys_gettimems();
+  8015e3:	48 b8 81 4f 80 00 00 	movabs $0x804f81,%rax
+  8015ea:	00 00 00 
+  8015ed:	ff d0                	call   *%rax
+  8015ef:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    for (long i = 0; i < rounds; i++) {
+  8015f2:	4d 85 ed             	test   %r13,%r13
+  8015f5:	0f 8e a8 01 00 00    	jle    8017a3 <bench+0x1f0>
+  8015fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        int32_t val;
+        if (mode == MODE_CALL) {
+            val = ipc_call(who, i, NULL, 0, 0, NULL, NULL, NULL);
+        } else {
+            send(who, i, mode);
+  801600:	49 bf 01 15 80 00 00 	movabs $0x801501,%r15
+  801607:	00 00 00 
+            val = ipc_recv(NULL, NULL, NULL, NULL);
+  80160a:	49 be cf 33 80 00 00 	movabs $0x8033cf,%r14
+  801611:	00 00 00 
+  801614:	e9 32 01 00 00       	jmp    80174b <bench+0x198>
+    if (who < 0) panic("fork: %i", who);
+  801619:	89 c1                	mov    %eax,%ecx
+  80161b:	48 ba fc 67 80 00 00 	movabs $0x8067fc,%rdx
+  801622:	00 00 00 
+  801625:	be 22 00 00 00       	mov    $0x22,%esi
+  80162a:	48 bf 17 62 80 00 00 	movabs $0x806217,%rdi
+  801631:	00 00 00 
+  801634:	b8 00 00 00 00       	mov    $0x0,%eax
+  801639:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  801640:	00 00 00 
+  801643:	41 ff d0             	call   *%r8
+        uint32_t val = ipc_recv(&who, NULL, NULL, NULL);
+  801646:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801650:	be 00 00 00 00       	mov    $0x0,%esi
+  801655:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  801659:	48 b8 cf 33 80 00 00 	movabs $0x8033cf,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+  801665:	89 c6                	mov    %eax,%esi
+        while (val + 1 < rounds) {
+  801667:	8d 40 01             	lea    0x1(%rax),%eax
+  80166a:	49 39 c5             	cmp    %rax,%r13
+  80166d:	7e 7a                	jle    8016e9 <bench+0x136>
+                send(who, val, mode);
+  80166f:	49 be 01 15 80 00 00 	movabs $0x801501,%r14
+  801676:	00 00 00 
+                val = ipc_recv(&who, NULL, NULL, NULL);
+  801679:	48 bb cf 33 80 00 00 	movabs $0x8033cf,%rbx
+  801680:	00 00 00 
+                val = ipc_reply_wait(who, val, NULL, 0, 0, &who, NULL, NULL, NULL);
+  801683:	49 bf 20 35 80 00 00 	movabs $0x803520,%r15
+  80168a:	00 00 00 
+  80168d:	eb 32                	jmp    8016c1 <bench+0x10e>
+  80168f:	48 83 ec 08          	sub    $0x8,%rsp
+  801693:	6a 00                	push   $0x0
+  801695:	6a 00                	push   $0x0
+  801697:	6a 00                	push   $0x0
+  801699:	4c 8d 4d cc          	lea    -0x34(%rbp),%r9
+  80169d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ad:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8016b0:	41 ff d7             	call   *%r15
+  8016b3:	89 c6                	mov    %eax,%esi
+  8016b5:	48 83 c4 20          	add    $0x20,%rsp
+        while (val + 1 < rounds) {
+  8016b9:	8d 46 01             	lea    0x1(%rsi),%eax
+  8016bc:	4c 39 e8             	cmp    %r13,%rax
+  8016bf:	7d 28                	jge    8016e9 <bench+0x136>
+            if (mode == MODE_CALL) {
+  8016c1:	41 83 fc 02          	cmp    $0x2,%r12d
+  8016c5:	74 c8                	je     80168f <bench+0xdc>
+                send(who, val, mode);
+  8016c7:	44 89 e2             	mov    %r12d,%edx
+  8016ca:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8016cd:	41 ff d6             	call   *%r14
+                val = ipc_recv(&who, NULL, NULL, NULL);
+  8016d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016da:	be 00 00 00 00       	mov    $0x0,%esi
+  8016df:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8016e3:	ff d3                	call   *%rbx
+  8016e5:	89 c6                	mov    %eax,%esi
+  8016e7:	eb d0                	jmp    8016b9 <bench+0x106>
+        send(who, val, mode);
+  8016e9:	44 89 e2             	mov    %r12d,%edx
+  8016ec:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8016ef:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016f6:	00 00 00 
+  8016f9:	ff d0                	call   *%rax
+        exit();
+  8016fb:	48 b8 3b 19 80 00 00 	movabs $0x80193b,%rax
+  801702:	00 00 00 
+  801705:	ff d0                	call   *%rax
+  801707:	e9 d7 fe ff ff       	jmp    8015e3 <bench+0x30>
+            val = ipc_call(who, i, NULL, 0, 0, NULL, NULL, NULL);
+  80170c:	6a 00                	push   $0x0
+  80170e:	6a 00                	push   $0x0
+  801710:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801716:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80171c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801721:	ba 00 00 00 00       	mov    $0x0,%edx
+  801726:	89 de                	mov    %ebx,%esi
+  801728:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80172b:	48 b8 8a 34 80 00 00 	movabs $0x80348a,%rax
+  801732:	00 00 00 
+  801735:	ff d0                	call   *%rax
+  801737:	48 83 c4 10          	add    $0x10,%rsp
+        }
+        if (val != i) panic("round trip %ld is lost", i);
+  80173b:	48 98                	cltq
+  80173d:	48 39 d8             	cmp    %rbx,%rax
+  801740:	75 33                	jne    801775 <bench+0x1c2>
+    for (long i = 0; i < rounds; i++) {
+  801742:	48 83 c3 01          	add    $0x1,%rbx
+  801746:	49 39 dd             	cmp    %rbx,%r13
+  801749:	74 58                	je     8017a3 <bench+0x1f0>
+        if (mode == MODE_CALL) {
+  80174b:	41 83 fc 02          	cmp    $0x2,%r12d
+  80174f:	74 bb                	je     80170c <bench+0x159>
+            send(who, i, mode);
+  801751:	44 89 e2             	mov    %r12d,%edx
+  801754:	89 de                	mov    %ebx,%esi
+  801756:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801759:	41 ff d7             	call   *%r15
+            val = ipc_recv(NULL, NULL, NULL, NULL);
+  80175c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801761:	ba 00 00 00 00       	mov    $0x0,%edx
+  801766:	be 00 00 00 00       	mov    $0x0,%esi
+  80176b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801770:	41 ff d6             	call   *%r14
+  801773:	eb c6                	jmp    80173b <bench+0x188>
+        if (val != i) panic("round trip %ld is lost", i);
+  801775:	48 89 d9             	mov    %rbx,%rcx
+  801778:	48 ba 27 62 80 00 00 	movabs $0x806227,%rdx
+  80177f:	00 00 00 
+  801782:	be 3c 00 00 00       	mov    $0x3c,%esi
+  801787:	48 bf 17 62 80 00 00 	movabs $0x806217,%rdi
+  80178e:	00 00 00 
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  80179d:	00 00 00 
+  8017a0:	41 ff d0             	call   *%r8
+    }
+    uint32_t elapsed = vsys_gettimems() - start;
+  8017a3:	48 b8 81 4f 80 00 00 	movabs $0x804f81,%rax
+  8017aa:	00 00 00 
+  8017ad:	ff d0                	call   *%rax
+  8017af:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8017b2:	29 c8                	sub    %ecx,%eax
+  8017b4:	89 c3                	mov    %eax,%ebx
+    wait(who);
+  8017b6:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8017b9:	48 b8 56 4a 80 00 00 	movabs $0x804a56,%rax
+  8017c0:	00 00 00 
+  8017c3:	ff d0                	call   *%rax
+
+    cprintf("ipcbench: %-10s %ld round trips in %u ms (%ld/s)\n",
+  8017c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017cb:	85 db                	test   %ebx,%ebx
+  8017cd:	74 11                	je     8017e0 <bench+0x22d>
+            name, rounds, elapsed, elapsed ? rounds * 1000 / elapsed : 0);
+  8017cf:	49 69 c5 e8 03 00 00 	imul   $0x3e8,%r13,%rax
+  8017d6:	89 d9                	mov    %ebx,%ecx
+    cprintf("ipcbench: %-10s %ld round trips in %u ms (%ld/s)\n",
+  8017d8:	48 99                	cqto
+  8017da:	48 f7 f9             	idiv   %rcx
+  8017dd:	49 89 c0             	mov    %rax,%r8
+  8017e0:	89 d9                	mov    %ebx,%ecx
+  8017e2:	4c 89 ea             	mov    %r13,%rdx
+  8017e5:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8017e9:	48 bf 48 62 80 00 00 	movabs $0x806248,%rdi
+  8017f0:	00 00 00 
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f8:	49 b9 ae 1a 80 00 00 	movabs $0x801aae,%r9
+  8017ff:	00 00 00 
+  801802:	41 ff d1             	call   *%r9
+}
+  801805:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801809:	5b                   	pop    %rbx
+  80180a:	41 5c                	pop    %r12
+  80180c:	41 5d                	pop    %r13
+  80180e:	41 5e                	pop    %r14
+  801810:	41 5f                	pop    %r15
+  801812:	5d                   	pop    %rbp
+  801813:	c3                   	ret
+
+0000000000801814 <umain>:
+
+void
+umain(int argc, char **argv) {
+  801814:	55                   	push   %rbp
+  801815:	48 89 e5             	mov    %rsp,%rbp
+  801818:	41 54                	push   %r12
+  80181a:	53                   	push   %rbx
+    long rounds = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ROUNDS;
+  80181b:	bb 10 27 00 00       	mov    $0x2710,%ebx
+  801820:	83 ff 01             	cmp    $0x1,%edi
+  801823:	7f 4e                	jg     801873 <umain+0x5f>
+
+    bench("try_send", rounds, MODE_TRY_SEND);
+  801825:	ba 00 00 00 00       	mov    $0x0,%edx
+  80182a:	48 89 de             	mov    %rbx,%rsi
+  80182d:	48 bf 3e 62 80 00 00 	movabs $0x80623e,%rdi
+  801834:	00 00 00 
+  801837:	49 bc b3 15 80 00 00 	movabs $0x8015b3,%r12
+  80183e:	00 00 00 
+  801841:	41 ff d4             	call   *%r12
+    bench("send", rounds, MODE_SEND);
+  801844:	ba 01 00 00 00       	mov    $0x1,%edx
+  801849:	48 89 de             	mov    %rbx,%rsi
+  80184c:	48 bf 42 62 80 00 00 	movabs $0x806242,%rdi
+  801853:	00 00 00 
+  801856:	41 ff d4             	call   *%r12
+    bench("call", rounds, MODE_CALL);
+  801859:	ba 02 00 00 00       	mov    $0x2,%edx
+  80185e:	48 89 de             	mov    %rbx,%rsi
+  801861:	48 bf 7c 63 80 00 00 	movabs $0x80637c,%rdi
+  801868:	00 00 00 
+  80186b:	41 ff d4             	call   *%r12
+}
+  80186e:	5b                   	pop    %rbx
+  80186f:	41 5c                	pop    %r12
+  801871:	5d                   	pop    %rbp
+  801872:	c3                   	ret
+    long rounds = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ROUNDS;
+  801873:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  801877:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187c:	be 00 00 00 00       	mov    $0x0,%esi
+  801881:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  801888:	00 00 00 
+  80188b:	ff d0                	call   *%rax
+  80188d:	48 89 c3             	mov    %rax,%rbx
+  801890:	eb 93                	jmp    801825 <umain+0x11>
+
+0000000000801892 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801892:	55                   	push   %rbp
+  801893:	48 89 e5             	mov    %rsp,%rbp
+  801896:	41 56                	push   %r14
+  801898:	41 55                	push   %r13
+  80189a:	41 54                	push   %r12
+  80189c:	53                   	push   %rbx
+  80189d:	41 89 fd             	mov    %edi,%r13d
+  8018a0:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8018a3:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8018aa:	00 00 00 
+  8018ad:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8018b4:	00 00 00 
+  8018b7:	48 39 c2             	cmp    %rax,%rdx
+  8018ba:	73 17                	jae    8018d3 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8018bc:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8018bf:	49 89 c4             	mov    %rax,%r12
+  8018c2:	48 83 c3 08          	add    $0x8,%rbx
+  8018c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cb:	ff 53 f8             	call   *-0x8(%rbx)
+  8018ce:	4c 39 e3             	cmp    %r12,%rbx
+  8018d1:	72 ef                	jb     8018c2 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8018d3:	48 b8 72 2a 80 00 00 	movabs $0x802a72,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+  8018df:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018e4:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8018eb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018f2:	00 00 00 
+  8018f5:	48 01 d0             	add    %rdx,%rax
+  8018f8:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8018ff:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801902:	45 85 ed             	test   %r13d,%r13d
+  801905:	7e 0d                	jle    801914 <libmain+0x82>
+  801907:	49 8b 06             	mov    (%r14),%rax
+  80190a:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801911:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801914:	4c 89 f6             	mov    %r14,%rsi
+  801917:	44 89 ef             	mov    %r13d,%edi
+  80191a:	48 b8 14 18 80 00 00 	movabs $0x801814,%rax
+  801921:	00 00 00 
+  801924:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801926:	48 b8 3b 19 80 00 00 	movabs $0x80193b,%rax
+  80192d:	00 00 00 
+  801930:	ff d0                	call   *%rax
+#endif
+}
+  801932:	5b                   	pop    %rbx
+  801933:	41 5c                	pop    %r12
+  801935:	41 5d                	pop    %r13
+  801937:	41 5e                	pop    %r14
+  801939:	5d                   	pop    %rbp
+  80193a:	c3                   	ret
+
+000000000080193b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80193b:	55                   	push   %rbp
+  80193c:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80193f:	48 b8 02 38 80 00 00 	movabs $0x803802,%rax
+  801946:	00 00 00 
+  801949:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80194b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801950:	48 b8 01 2a 80 00 00 	movabs $0x802a01,%rax
+  801957:	00 00 00 
+  80195a:	ff d0                	call   *%rax
+}
+  80195c:	5d                   	pop    %rbp
+  80195d:	c3                   	ret
+
+000000000080195e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80195e:	55                   	push   %rbp
+  80195f:	48 89 e5             	mov    %rsp,%rbp
+  801962:	41 56                	push   %r14
+  801964:	41 55                	push   %r13
+  801966:	41 54                	push   %r12
+  801968:	53                   	push   %rbx
+  801969:	48 83 ec 50          	sub    $0x50,%rsp
+  80196d:	49 89 fc             	mov    %rdi,%r12
+  801970:	41 89 f5             	mov    %esi,%r13d
+  801973:	48 89 d3             	mov    %rdx,%rbx
+  801976:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80197a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80197e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801982:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801989:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80198d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801991:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801995:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801999:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8019a0:	00 00 00 
+  8019a3:	4c 8b 30             	mov    (%rax),%r14
+  8019a6:	48 b8 72 2a 80 00 00 	movabs $0x802a72,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+  8019b2:	89 c6                	mov    %eax,%esi
+  8019b4:	45 89 e8             	mov    %r13d,%r8d
+  8019b7:	4c 89 e1             	mov    %r12,%rcx
+  8019ba:	4c 89 f2             	mov    %r14,%rdx
+  8019bd:	48 bf 88 62 80 00 00 	movabs $0x806288,%rdi
+  8019c4:	00 00 00 
+  8019c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cc:	49 bc ae 1a 80 00 00 	movabs $0x801aae,%r12
+  8019d3:	00 00 00 
+  8019d6:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8019d9:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8019dd:	48 89 df             	mov    %rbx,%rdi
+  8019e0:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  8019e7:	00 00 00 
+  8019ea:	ff d0                	call   *%rax
+    cprintf("\n");
+  8019ec:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  8019f3:	00 00 00 
+  8019f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fb:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8019fe:	cc                   	int3
+  8019ff:	eb fd                	jmp    8019fe <_panic+0xa0>
+
+0000000000801a01 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801a01:	55                   	push   %rbp
+  801a02:	48 89 e5             	mov    %rsp,%rbp
+  801a05:	53                   	push   %rbx
+  801a06:	48 83 ec 08          	sub    $0x8,%rsp
+  801a0a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801a0d:	8b 06                	mov    (%rsi),%eax
+  801a0f:	8d 50 01             	lea    0x1(%rax),%edx
+  801a12:	89 16                	mov    %edx,(%rsi)
+  801a14:	48 98                	cltq
+  801a16:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801a1b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801a21:	74 0a                	je     801a2d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801a23:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801a27:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2b:	c9                   	leave
+  801a2c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801a2d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801a31:	be ff 00 00 00       	mov    $0xff,%esi
+  801a36:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  801a3d:	00 00 00 
+  801a40:	ff d0                	call   *%rax
+        state->offset = 0;
+  801a42:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801a48:	eb d9                	jmp    801a23 <putch+0x22>
+
+0000000000801a4a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801a4a:	55                   	push   %rbp
+  801a4b:	48 89 e5             	mov    %rsp,%rbp
+  801a4e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801a55:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801a58:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801a5f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a69:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801a6c:	48 89 f1             	mov    %rsi,%rcx
+  801a6f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a76:	48 bf 01 1a 80 00 00 	movabs $0x801a01,%rdi
+  801a7d:	00 00 00 
+  801a80:	48 b8 fe 1b 80 00 00 	movabs $0x801bfe,%rax
+  801a87:	00 00 00 
+  801a8a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a8c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a93:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a9a:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  801aa1:	00 00 00 
+  801aa4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801aa6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801aac:	c9                   	leave
+  801aad:	c3                   	ret
+
+0000000000801aae <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801aae:	55                   	push   %rbp
+  801aaf:	48 89 e5             	mov    %rsp,%rbp
+  801ab2:	48 83 ec 50          	sub    $0x50,%rsp
+  801ab6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801aba:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801abe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ac2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801ac6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801aca:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801ad1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ad5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ad9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801add:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801ae1:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801ae5:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+
+0000000000801af3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801af3:	55                   	push   %rbp
+  801af4:	48 89 e5             	mov    %rsp,%rbp
+  801af7:	41 57                	push   %r15
+  801af9:	41 56                	push   %r14
+  801afb:	41 55                	push   %r13
+  801afd:	41 54                	push   %r12
+  801aff:	53                   	push   %rbx
+  801b00:	48 83 ec 18          	sub    $0x18,%rsp
+  801b04:	49 89 fc             	mov    %rdi,%r12
+  801b07:	49 89 f5             	mov    %rsi,%r13
+  801b0a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b0e:	8b 45 10             	mov    0x10(%rbp),%eax
+  801b11:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801b14:	41 89 cf             	mov    %ecx,%r15d
+  801b17:	4c 39 fa             	cmp    %r15,%rdx
+  801b1a:	73 5b                	jae    801b77 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801b1c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801b20:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801b24:	85 db                	test   %ebx,%ebx
+  801b26:	7e 0e                	jle    801b36 <print_num+0x43>
+            putch(padc, put_arg);
+  801b28:	4c 89 ee             	mov    %r13,%rsi
+  801b2b:	44 89 f7             	mov    %r14d,%edi
+  801b2e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801b31:	83 eb 01             	sub    $0x1,%ebx
+  801b34:	75 f2                	jne    801b28 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801b36:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801b3a:	48 b9 bc 62 80 00 00 	movabs $0x8062bc,%rcx
+  801b41:	00 00 00 
+  801b44:	48 b8 ab 62 80 00 00 	movabs $0x8062ab,%rax
+  801b4b:	00 00 00 
+  801b4e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801b52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5b:	49 f7 f7             	div    %r15
+  801b5e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801b62:	4c 89 ee             	mov    %r13,%rsi
+  801b65:	41 ff d4             	call   *%r12
+}
+  801b68:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b6c:	5b                   	pop    %rbx
+  801b6d:	41 5c                	pop    %r12
+  801b6f:	41 5d                	pop    %r13
+  801b71:	41 5e                	pop    %r14
+  801b73:	41 5f                	pop    %r15
+  801b75:	5d                   	pop    %rbp
+  801b76:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b80:	49 f7 f7             	div    %r15
+  801b83:	48 83 ec 08          	sub    $0x8,%rsp
+  801b87:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b8b:	52                   	push   %rdx
+  801b8c:	45 0f be c9          	movsbl %r9b,%r9d
+  801b90:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b94:	48 89 c2             	mov    %rax,%rdx
+  801b97:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+  801ba3:	48 83 c4 10          	add    $0x10,%rsp
+  801ba7:	eb 8d                	jmp    801b36 <print_num+0x43>
+
+0000000000801ba9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801ba9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801bad:	48 8b 06             	mov    (%rsi),%rax
+  801bb0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801bb4:	73 0a                	jae    801bc0 <sprintputch+0x17>
+        *state->start++ = ch;
+  801bb6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bba:	48 89 16             	mov    %rdx,(%rsi)
+  801bbd:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801bc0:	c3                   	ret
+
+0000000000801bc1 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801bc1:	55                   	push   %rbp
+  801bc2:	48 89 e5             	mov    %rsp,%rbp
+  801bc5:	48 83 ec 50          	sub    $0x50,%rsp
+  801bc9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801bcd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801bd1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801bd5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801bdc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801be0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801be8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801bec:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801bf0:	48 b8 fe 1b 80 00 00 	movabs $0x801bfe,%rax
+  801bf7:	00 00 00 
+  801bfa:	ff d0                	call   *%rax
+}
+  801bfc:	c9                   	leave
+  801bfd:	c3                   	ret
+
+0000000000801bfe <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801bfe:	55                   	push   %rbp
+  801bff:	48 89 e5             	mov    %rsp,%rbp
+  801c02:	41 57                	push   %r15
+  801c04:	41 56                	push   %r14
+  801c06:	41 55                	push   %r13
+  801c08:	41 54                	push   %r12
+  801c0a:	53                   	push   %rbx
+  801c0b:	48 83 ec 38          	sub    $0x38,%rsp
+  801c0f:	49 89 fe             	mov    %rdi,%r14
+  801c12:	49 89 f5             	mov    %rsi,%r13
+  801c15:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801c18:	48 8b 01             	mov    (%rcx),%rax
+  801c1b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801c1f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801c23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c27:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801c2b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801c2f:	eb 0d                	jmp    801c3e <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801c31:	40 0f b6 ff          	movzbl %dil,%edi
+  801c35:	4c 89 ee             	mov    %r13,%rsi
+  801c38:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801c3b:	4c 89 e3             	mov    %r12,%rbx
+  801c3e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801c42:	0f b6 3b             	movzbl (%rbx),%edi
+  801c45:	40 80 ff 25          	cmp    $0x25,%dil
+  801c49:	74 14                	je     801c5f <vprintfmt+0x61>
+            if (!ch) return;
+  801c4b:	40 84 ff             	test   %dil,%dil
+  801c4e:	75 e1                	jne    801c31 <vprintfmt+0x33>
+}
+  801c50:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801c54:	5b                   	pop    %rbx
+  801c55:	41 5c                	pop    %r12
+  801c57:	41 5d                	pop    %r13
+  801c59:	41 5e                	pop    %r14
+  801c5b:	41 5f                	pop    %r15
+  801c5d:	5d                   	pop    %rbp
+  801c5e:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801c5f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c64:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801c68:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801c6d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c73:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c7a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c7e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c83:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c88:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c8b:	83 e8 23             	sub    $0x23,%eax
+  801c8e:	3c 57                	cmp    $0x57,%al
+  801c90:	0f 87 67 06 00 00    	ja     8022fd <vprintfmt+0x6ff>
+  801c96:	0f b6 c0             	movzbl %al,%eax
+  801c99:	48 b9 40 64 80 00 00 	movabs $0x806440,%rcx
+  801ca0:	00 00 00 
+  801ca3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801ca6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801ca9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801cad:	eb cf                	jmp    801c7e <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801caf:	49 89 dc             	mov    %rbx,%r12
+  801cb2:	be 01 00 00 00       	mov    $0x1,%esi
+  801cb7:	eb c5                	jmp    801c7e <vprintfmt+0x80>
+            padc = ch;
+  801cb9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801cbd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801cc0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cc3:	eb b9                	jmp    801c7e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801cc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cc8:	83 f8 2f             	cmp    $0x2f,%eax
+  801ccb:	77 24                	ja     801cf1 <vprintfmt+0xf3>
+  801ccd:	89 c1                	mov    %eax,%ecx
+  801ccf:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801cd3:	83 c0 08             	add    $0x8,%eax
+  801cd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cd9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801cdc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801cdf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ce3:	79 99                	jns    801c7e <vprintfmt+0x80>
+                width = precision;
+  801ce5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ce9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801cef:	eb 8d                	jmp    801c7e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801cf1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801cf5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801cf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cfd:	eb da                	jmp    801cd9 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801cff:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801d04:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801d08:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801d0e:	3c 39                	cmp    $0x39,%al
+  801d10:	77 1c                	ja     801d2e <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801d12:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801d16:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801d1a:	0f b6 c0             	movzbl %al,%eax
+  801d1d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801d22:	0f b6 03             	movzbl (%rbx),%eax
+  801d25:	3c 39                	cmp    $0x39,%al
+  801d27:	76 e9                	jbe    801d12 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801d29:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801d2c:	eb b1                	jmp    801cdf <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801d2e:	49 89 dc             	mov    %rbx,%r12
+  801d31:	eb ac                	jmp    801cdf <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801d33:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801d36:	85 c9                	test   %ecx,%ecx
+  801d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3d:	0f 49 c1             	cmovns %ecx,%eax
+  801d40:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801d43:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d46:	e9 33 ff ff ff       	jmp    801c7e <vprintfmt+0x80>
+            lflag++;
+  801d4b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d4e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d51:	e9 28 ff ff ff       	jmp    801c7e <vprintfmt+0x80>
+            lflag--;
+  801d56:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d59:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d5c:	e9 1d ff ff ff       	jmp    801c7e <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801d61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d64:	83 f8 2f             	cmp    $0x2f,%eax
+  801d67:	77 19                	ja     801d82 <vprintfmt+0x184>
+  801d69:	89 c2                	mov    %eax,%edx
+  801d6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d6f:	83 c0 08             	add    $0x8,%eax
+  801d72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d75:	8b 3a                	mov    (%rdx),%edi
+  801d77:	4c 89 ee             	mov    %r13,%rsi
+  801d7a:	41 ff d6             	call   *%r14
+            break;
+  801d7d:	e9 bc fe ff ff       	jmp    801c3e <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8e:	eb e5                	jmp    801d75 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d93:	83 f8 2f             	cmp    $0x2f,%eax
+  801d96:	77 5a                	ja     801df2 <vprintfmt+0x1f4>
+  801d98:	89 c2                	mov    %eax,%edx
+  801d9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9e:	83 c0 08             	add    $0x8,%eax
+  801da1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801da4:	8b 02                	mov    (%rdx),%eax
+  801da6:	89 c1                	mov    %eax,%ecx
+  801da8:	f7 d9                	neg    %ecx
+  801daa:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801dad:	83 f9 13             	cmp    $0x13,%ecx
+  801db0:	7f 4e                	jg     801e00 <vprintfmt+0x202>
+  801db2:	48 63 c1             	movslq %ecx,%rax
+  801db5:	48 ba 00 67 80 00 00 	movabs $0x806700,%rdx
+  801dbc:	00 00 00 
+  801dbf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801dc3:	48 85 c0             	test   %rax,%rax
+  801dc6:	74 38                	je     801e00 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801dc8:	48 89 c1             	mov    %rax,%rcx
+  801dcb:	48 ba 68 69 80 00 00 	movabs $0x806968,%rdx
+  801dd2:	00 00 00 
+  801dd5:	4c 89 ee             	mov    %r13,%rsi
+  801dd8:	4c 89 f7             	mov    %r14,%rdi
+  801ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de0:	49 b8 c1 1b 80 00 00 	movabs $0x801bc1,%r8
+  801de7:	00 00 00 
+  801dea:	41 ff d0             	call   *%r8
+  801ded:	e9 4c fe ff ff       	jmp    801c3e <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801df2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801df6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dfe:	eb a4                	jmp    801da4 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801e00:	48 ba d4 62 80 00 00 	movabs $0x8062d4,%rdx
+  801e07:	00 00 00 
+  801e0a:	4c 89 ee             	mov    %r13,%rsi
+  801e0d:	4c 89 f7             	mov    %r14,%rdi
+  801e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e15:	49 b8 c1 1b 80 00 00 	movabs $0x801bc1,%r8
+  801e1c:	00 00 00 
+  801e1f:	41 ff d0             	call   *%r8
+  801e22:	e9 17 fe ff ff       	jmp    801c3e <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e2a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e2d:	77 6c                	ja     801e9b <vprintfmt+0x29d>
+  801e2f:	89 c2                	mov    %eax,%edx
+  801e31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e35:	83 c0 08             	add    $0x8,%eax
+  801e38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e3b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801e3e:	48 85 f6             	test   %rsi,%rsi
+  801e41:	48 b8 cd 62 80 00 00 	movabs $0x8062cd,%rax
+  801e48:	00 00 00 
+  801e4b:	48 0f 45 c6          	cmovne %rsi,%rax
+  801e4f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801e53:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e57:	7e 06                	jle    801e5f <vprintfmt+0x261>
+  801e59:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801e5d:	75 4a                	jne    801ea9 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e5f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e63:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801e67:	0f b6 00             	movzbl (%rax),%eax
+  801e6a:	84 c0                	test   %al,%al
+  801e6c:	0f 85 9a 00 00 00    	jne    801f0c <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e72:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e75:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	0f 8e bd fd ff ff    	jle    801c3e <vprintfmt+0x40>
+  801e81:	4c 89 ee             	mov    %r13,%rsi
+  801e84:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e89:	41 ff d6             	call   *%r14
+  801e8c:	41 83 ec 01          	sub    $0x1,%r12d
+  801e90:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e94:	75 eb                	jne    801e81 <vprintfmt+0x283>
+  801e96:	e9 a3 fd ff ff       	jmp    801c3e <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea7:	eb 92                	jmp    801e3b <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ea9:	49 63 f7             	movslq %r15d,%rsi
+  801eac:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801eb0:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  801eb7:	00 00 00 
+  801eba:	ff d0                	call   *%rax
+  801ebc:	48 89 c2             	mov    %rax,%rdx
+  801ebf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ec2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ec4:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ec7:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	7e 91                	jle    801e5f <vprintfmt+0x261>
+  801ece:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ed3:	4c 89 ee             	mov    %r13,%rsi
+  801ed6:	44 89 e7             	mov    %r12d,%edi
+  801ed9:	41 ff d6             	call   *%r14
+  801edc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ee0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ee3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ee6:	75 eb                	jne    801ed3 <vprintfmt+0x2d5>
+  801ee8:	e9 72 ff ff ff       	jmp    801e5f <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801eed:	0f b6 f8             	movzbl %al,%edi
+  801ef0:	4c 89 ee             	mov    %r13,%rsi
+  801ef3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ef6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801efa:	49 83 c4 01          	add    $0x1,%r12
+  801efe:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801f04:	84 c0                	test   %al,%al
+  801f06:	0f 84 66 ff ff ff    	je     801e72 <vprintfmt+0x274>
+  801f0c:	45 85 ff             	test   %r15d,%r15d
+  801f0f:	78 0a                	js     801f1b <vprintfmt+0x31d>
+  801f11:	41 83 ef 01          	sub    $0x1,%r15d
+  801f15:	0f 88 57 ff ff ff    	js     801e72 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801f1b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801f1f:	74 cc                	je     801eed <vprintfmt+0x2ef>
+  801f21:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801f24:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801f29:	80 fa 5e             	cmp    $0x5e,%dl
+  801f2c:	77 c2                	ja     801ef0 <vprintfmt+0x2f2>
+  801f2e:	eb bd                	jmp    801eed <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801f30:	40 84 f6             	test   %sil,%sil
+  801f33:	75 26                	jne    801f5b <vprintfmt+0x35d>
+    switch (lflag) {
+  801f35:	85 d2                	test   %edx,%edx
+  801f37:	74 59                	je     801f92 <vprintfmt+0x394>
+  801f39:	83 fa 01             	cmp    $0x1,%edx
+  801f3c:	74 7b                	je     801fb9 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801f3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f41:	83 f8 2f             	cmp    $0x2f,%eax
+  801f44:	0f 87 96 00 00 00    	ja     801fe0 <vprintfmt+0x3e2>
+  801f4a:	89 c2                	mov    %eax,%edx
+  801f4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f50:	83 c0 08             	add    $0x8,%eax
+  801f53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f56:	4c 8b 22             	mov    (%rdx),%r12
+  801f59:	eb 17                	jmp    801f72 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801f5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5e:	83 f8 2f             	cmp    $0x2f,%eax
+  801f61:	77 21                	ja     801f84 <vprintfmt+0x386>
+  801f63:	89 c2                	mov    %eax,%edx
+  801f65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f69:	83 c0 08             	add    $0x8,%eax
+  801f6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f6f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f72:	4d 85 e4             	test   %r12,%r12
+  801f75:	78 7a                	js     801ff1 <vprintfmt+0x3f3>
+            num = i;
+  801f77:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f7a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f7f:	e9 56 02 00 00       	jmp    8021da <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f90:	eb dd                	jmp    801f6f <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f95:	83 f8 2f             	cmp    $0x2f,%eax
+  801f98:	77 11                	ja     801fab <vprintfmt+0x3ad>
+  801f9a:	89 c2                	mov    %eax,%edx
+  801f9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa0:	83 c0 08             	add    $0x8,%eax
+  801fa3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa6:	4c 63 22             	movslq (%rdx),%r12
+  801fa9:	eb c7                	jmp    801f72 <vprintfmt+0x374>
+  801fab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801faf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fb7:	eb ed                	jmp    801fa6 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801fb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fbc:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbf:	77 11                	ja     801fd2 <vprintfmt+0x3d4>
+  801fc1:	89 c2                	mov    %eax,%edx
+  801fc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc7:	83 c0 08             	add    $0x8,%eax
+  801fca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fcd:	4c 8b 22             	mov    (%rdx),%r12
+  801fd0:	eb a0                	jmp    801f72 <vprintfmt+0x374>
+  801fd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fde:	eb ed                	jmp    801fcd <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801fe0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fe4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fe8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fec:	e9 65 ff ff ff       	jmp    801f56 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801ff1:	4c 89 ee             	mov    %r13,%rsi
+  801ff4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801ff9:	41 ff d6             	call   *%r14
+                i = -i;
+  801ffc:	49 f7 dc             	neg    %r12
+  801fff:	e9 73 ff ff ff       	jmp    801f77 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  802004:	40 84 f6             	test   %sil,%sil
+  802007:	75 2e                	jne    802037 <vprintfmt+0x439>
+    switch (lflag) {
+  802009:	85 d2                	test   %edx,%edx
+  80200b:	7f 59                	jg     802066 <vprintfmt+0x468>
+  80200d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802010:	7d 7a                	jge    80208c <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802012:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802015:	83 f8 2f             	cmp    $0x2f,%eax
+  802018:	0f 87 aa 00 00 00    	ja     8020c8 <vprintfmt+0x4ca>
+  80201e:	89 c2                	mov    %eax,%edx
+  802020:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802024:	83 c0 08             	add    $0x8,%eax
+  802027:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80202a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80202d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802032:	e9 a3 01 00 00       	jmp    8021da <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802037:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80203a:	83 f8 2f             	cmp    $0x2f,%eax
+  80203d:	77 19                	ja     802058 <vprintfmt+0x45a>
+  80203f:	89 c2                	mov    %eax,%edx
+  802041:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802045:	83 c0 08             	add    $0x8,%eax
+  802048:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80204b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80204e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802053:	e9 82 01 00 00       	jmp    8021da <vprintfmt+0x5dc>
+  802058:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80205c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802060:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802064:	eb e5                	jmp    80204b <vprintfmt+0x44d>
+    switch (lflag) {
+  802066:	83 fa 01             	cmp    $0x1,%edx
+  802069:	75 a7                	jne    802012 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  80206b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80206e:	83 f8 2f             	cmp    $0x2f,%eax
+  802071:	77 47                	ja     8020ba <vprintfmt+0x4bc>
+  802073:	89 c2                	mov    %eax,%edx
+  802075:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802079:	83 c0 08             	add    $0x8,%eax
+  80207c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80207f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802082:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802087:	e9 4e 01 00 00       	jmp    8021da <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80208c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80208f:	83 f8 2f             	cmp    $0x2f,%eax
+  802092:	77 18                	ja     8020ac <vprintfmt+0x4ae>
+  802094:	89 c2                	mov    %eax,%edx
+  802096:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80209a:	83 c0 08             	add    $0x8,%eax
+  80209d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020a0:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8020a2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8020a7:	e9 2e 01 00 00       	jmp    8021da <vprintfmt+0x5dc>
+  8020ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020b8:	eb e6                	jmp    8020a0 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  8020ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c6:	eb b7                	jmp    80207f <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  8020c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d4:	e9 51 ff ff ff       	jmp    80202a <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  8020d9:	40 84 f6             	test   %sil,%sil
+  8020dc:	75 2e                	jne    80210c <vprintfmt+0x50e>
+    switch (lflag) {
+  8020de:	85 d2                	test   %edx,%edx
+  8020e0:	7f 59                	jg     80213b <vprintfmt+0x53d>
+  8020e2:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8020e5:	7d 77                	jge    80215e <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  8020e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ed:	0f 87 a4 00 00 00    	ja     802197 <vprintfmt+0x599>
+  8020f3:	89 c2                	mov    %eax,%edx
+  8020f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f9:	83 c0 08             	add    $0x8,%eax
+  8020fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802102:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802107:	e9 ce 00 00 00       	jmp    8021da <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80210c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80210f:	83 f8 2f             	cmp    $0x2f,%eax
+  802112:	77 19                	ja     80212d <vprintfmt+0x52f>
+  802114:	89 c2                	mov    %eax,%edx
+  802116:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80211a:	83 c0 08             	add    $0x8,%eax
+  80211d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802120:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802123:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802128:	e9 ad 00 00 00       	jmp    8021da <vprintfmt+0x5dc>
+  80212d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802131:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802135:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802139:	eb e5                	jmp    802120 <vprintfmt+0x522>
+    switch (lflag) {
+  80213b:	83 fa 01             	cmp    $0x1,%edx
+  80213e:	75 a7                	jne    8020e7 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802140:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802143:	83 f8 2f             	cmp    $0x2f,%eax
+  802146:	77 41                	ja     802189 <vprintfmt+0x58b>
+  802148:	89 c2                	mov    %eax,%edx
+  80214a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80214e:	83 c0 08             	add    $0x8,%eax
+  802151:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802154:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802157:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80215c:	eb 7c                	jmp    8021da <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80215e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802161:	83 f8 2f             	cmp    $0x2f,%eax
+  802164:	77 15                	ja     80217b <vprintfmt+0x57d>
+  802166:	89 c2                	mov    %eax,%edx
+  802168:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80216c:	83 c0 08             	add    $0x8,%eax
+  80216f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802172:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802174:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802179:	eb 5f                	jmp    8021da <vprintfmt+0x5dc>
+  80217b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80217f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802183:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802187:	eb e9                	jmp    802172 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802189:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80218d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802191:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802195:	eb bd                	jmp    802154 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802197:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80219b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80219f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a3:	e9 57 ff ff ff       	jmp    8020ff <vprintfmt+0x501>
+            putch('0', put_arg);
+  8021a8:	4c 89 ee             	mov    %r13,%rsi
+  8021ab:	bf 30 00 00 00       	mov    $0x30,%edi
+  8021b0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8021b3:	4c 89 ee             	mov    %r13,%rsi
+  8021b6:	bf 78 00 00 00       	mov    $0x78,%edi
+  8021bb:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8021be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c4:	77 47                	ja     80220d <vprintfmt+0x60f>
+  8021c6:	89 c2                	mov    %eax,%edx
+  8021c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021cc:	83 c0 08             	add    $0x8,%eax
+  8021cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021d5:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8021da:	48 83 ec 08          	sub    $0x8,%rsp
+  8021de:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8021e2:	0f 94 c0             	sete   %al
+  8021e5:	0f b6 c0             	movzbl %al,%eax
+  8021e8:	50                   	push   %rax
+  8021e9:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8021ee:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8021f2:	4c 89 ee             	mov    %r13,%rsi
+  8021f5:	4c 89 f7             	mov    %r14,%rdi
+  8021f8:	48 b8 f3 1a 80 00 00 	movabs $0x801af3,%rax
+  8021ff:	00 00 00 
+  802202:	ff d0                	call   *%rax
+            break;
+  802204:	48 83 c4 10          	add    $0x10,%rsp
+  802208:	e9 31 fa ff ff       	jmp    801c3e <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80220d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802211:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802215:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802219:	eb b7                	jmp    8021d2 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80221b:	40 84 f6             	test   %sil,%sil
+  80221e:	75 2b                	jne    80224b <vprintfmt+0x64d>
+    switch (lflag) {
+  802220:	85 d2                	test   %edx,%edx
+  802222:	7f 56                	jg     80227a <vprintfmt+0x67c>
+  802224:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802227:	7d 77                	jge    8022a0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802229:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80222c:	83 f8 2f             	cmp    $0x2f,%eax
+  80222f:	0f 87 a7 00 00 00    	ja     8022dc <vprintfmt+0x6de>
+  802235:	89 c2                	mov    %eax,%edx
+  802237:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80223b:	83 c0 08             	add    $0x8,%eax
+  80223e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802241:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802244:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802249:	eb 8f                	jmp    8021da <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80224b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80224e:	83 f8 2f             	cmp    $0x2f,%eax
+  802251:	77 19                	ja     80226c <vprintfmt+0x66e>
+  802253:	89 c2                	mov    %eax,%edx
+  802255:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802259:	83 c0 08             	add    $0x8,%eax
+  80225c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80225f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802262:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802267:	e9 6e ff ff ff       	jmp    8021da <vprintfmt+0x5dc>
+  80226c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802270:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802274:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802278:	eb e5                	jmp    80225f <vprintfmt+0x661>
+    switch (lflag) {
+  80227a:	83 fa 01             	cmp    $0x1,%edx
+  80227d:	75 aa                	jne    802229 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80227f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802282:	83 f8 2f             	cmp    $0x2f,%eax
+  802285:	77 47                	ja     8022ce <vprintfmt+0x6d0>
+  802287:	89 c2                	mov    %eax,%edx
+  802289:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80228d:	83 c0 08             	add    $0x8,%eax
+  802290:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802293:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802296:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80229b:	e9 3a ff ff ff       	jmp    8021da <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8022a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8022a6:	77 18                	ja     8022c0 <vprintfmt+0x6c2>
+  8022a8:	89 c2                	mov    %eax,%edx
+  8022aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ae:	83 c0 08             	add    $0x8,%eax
+  8022b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022b4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8022b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8022bb:	e9 1a ff ff ff       	jmp    8021da <vprintfmt+0x5dc>
+  8022c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022cc:	eb e6                	jmp    8022b4 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8022ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022da:	eb b7                	jmp    802293 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8022dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e8:	e9 54 ff ff ff       	jmp    802241 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8022ed:	4c 89 ee             	mov    %r13,%rsi
+  8022f0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022f5:	41 ff d6             	call   *%r14
+            break;
+  8022f8:	e9 41 f9 ff ff       	jmp    801c3e <vprintfmt+0x40>
+            putch('%', put_arg);
+  8022fd:	4c 89 ee             	mov    %r13,%rsi
+  802300:	bf 25 00 00 00       	mov    $0x25,%edi
+  802305:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802308:	48 83 eb 01          	sub    $0x1,%rbx
+  80230c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802310:	75 f6                	jne    802308 <vprintfmt+0x70a>
+  802312:	e9 27 f9 ff ff       	jmp    801c3e <vprintfmt+0x40>
+
+0000000000802317 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802317:	55                   	push   %rbp
+  802318:	48 89 e5             	mov    %rsp,%rbp
+  80231b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80231f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802323:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802328:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80232c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802333:	48 85 ff             	test   %rdi,%rdi
+  802336:	74 2b                	je     802363 <vsnprintf+0x4c>
+  802338:	48 85 f6             	test   %rsi,%rsi
+  80233b:	74 26                	je     802363 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80233d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802341:	48 bf a9 1b 80 00 00 	movabs $0x801ba9,%rdi
+  802348:	00 00 00 
+  80234b:	48 b8 fe 1b 80 00 00 	movabs $0x801bfe,%rax
+  802352:	00 00 00 
+  802355:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802357:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80235b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80235e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802363:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802368:	eb f7                	jmp    802361 <vsnprintf+0x4a>
+
+000000000080236a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80236a:	55                   	push   %rbp
+  80236b:	48 89 e5             	mov    %rsp,%rbp
+  80236e:	48 83 ec 50          	sub    $0x50,%rsp
+  802372:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802376:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80237a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80237e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802385:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802389:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80238d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802391:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802395:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802399:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8023a5:	c9                   	leave
+  8023a6:	c3                   	ret
+
+00000000008023a7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8023a7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8023aa:	74 10                	je     8023bc <strlen+0x15>
+    size_t n = 0;
+  8023ac:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8023b1:	48 83 c0 01          	add    $0x1,%rax
+  8023b5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8023b9:	75 f6                	jne    8023b1 <strlen+0xa>
+  8023bb:	c3                   	ret
+    size_t n = 0;
+  8023bc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8023c1:	c3                   	ret
+
+00000000008023c2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8023c2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8023c5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8023ca:	48 85 f6             	test   %rsi,%rsi
+  8023cd:	74 11                	je     8023e0 <strnlen+0x1e>
+  8023cf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8023d3:	74 0c                	je     8023e1 <strnlen+0x1f>
+  8023d5:	48 83 c2 01          	add    $0x1,%rdx
+  8023d9:	48 39 d0             	cmp    %rdx,%rax
+  8023dc:	75 f1                	jne    8023cf <strnlen+0xd>
+  8023de:	eb 04                	jmp    8023e4 <strnlen+0x22>
+  8023e0:	c3                   	ret
+  8023e1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8023e4:	c3                   	ret
+
+00000000008023e5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8023e5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8023e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ed:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8023f1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8023f4:	48 83 c2 01          	add    $0x1,%rdx
+  8023f8:	84 c9                	test   %cl,%cl
+  8023fa:	75 f1                	jne    8023ed <strcpy+0x8>
+        ;
+    return res;
+}
+  8023fc:	c3                   	ret
+
+00000000008023fd <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8023fd:	55                   	push   %rbp
+  8023fe:	48 89 e5             	mov    %rsp,%rbp
+  802401:	41 54                	push   %r12
+  802403:	53                   	push   %rbx
+  802404:	48 89 fb             	mov    %rdi,%rbx
+  802407:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80240a:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  802411:	00 00 00 
+  802414:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802416:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80241a:	4c 89 e6             	mov    %r12,%rsi
+  80241d:	48 b8 e5 23 80 00 00 	movabs $0x8023e5,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+    return dst;
+}
+  802429:	48 89 d8             	mov    %rbx,%rax
+  80242c:	5b                   	pop    %rbx
+  80242d:	41 5c                	pop    %r12
+  80242f:	5d                   	pop    %rbp
+  802430:	c3                   	ret
+
+0000000000802431 <toupper>:
+
+int
+toupper(int ch) {
+  802431:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802433:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802436:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802439:	83 f9 1a             	cmp    $0x1a,%ecx
+  80243c:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80243f:	c3                   	ret
+
+0000000000802440 <tolower>:
+
+int
+tolower(int ch) {
+  802440:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802442:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802445:	8d 57 20             	lea    0x20(%rdi),%edx
+  802448:	83 f9 1a             	cmp    $0x1a,%ecx
+  80244b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80244e:	c3                   	ret
+
+000000000080244f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80244f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802452:	48 85 d2             	test   %rdx,%rdx
+  802455:	74 1f                	je     802476 <strncpy+0x27>
+  802457:	48 01 fa             	add    %rdi,%rdx
+  80245a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80245d:	48 83 c1 01          	add    $0x1,%rcx
+  802461:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802465:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802469:	41 80 f8 01          	cmp    $0x1,%r8b
+  80246d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802471:	48 39 ca             	cmp    %rcx,%rdx
+  802474:	75 e7                	jne    80245d <strncpy+0xe>
+    }
+    return ret;
+}
+  802476:	c3                   	ret
+
+0000000000802477 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802477:	48 89 f8             	mov    %rdi,%rax
+  80247a:	48 85 d2             	test   %rdx,%rdx
+  80247d:	74 24                	je     8024a3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80247f:	48 83 ea 01          	sub    $0x1,%rdx
+  802483:	74 1b                	je     8024a0 <strlcpy+0x29>
+  802485:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802489:	0f b6 16             	movzbl (%rsi),%edx
+  80248c:	84 d2                	test   %dl,%dl
+  80248e:	74 10                	je     8024a0 <strlcpy+0x29>
+            *dst++ = *src++;
+  802490:	48 83 c6 01          	add    $0x1,%rsi
+  802494:	48 83 c0 01          	add    $0x1,%rax
+  802498:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80249b:	48 39 c8             	cmp    %rcx,%rax
+  80249e:	75 e9                	jne    802489 <strlcpy+0x12>
+        *dst = '\0';
+  8024a0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8024a3:	48 29 f8             	sub    %rdi,%rax
+}
+  8024a6:	c3                   	ret
+
+00000000008024a7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8024a7:	0f b6 07             	movzbl (%rdi),%eax
+  8024aa:	84 c0                	test   %al,%al
+  8024ac:	74 13                	je     8024c1 <strcmp+0x1a>
+  8024ae:	38 06                	cmp    %al,(%rsi)
+  8024b0:	75 0f                	jne    8024c1 <strcmp+0x1a>
+  8024b2:	48 83 c7 01          	add    $0x1,%rdi
+  8024b6:	48 83 c6 01          	add    $0x1,%rsi
+  8024ba:	0f b6 07             	movzbl (%rdi),%eax
+  8024bd:	84 c0                	test   %al,%al
+  8024bf:	75 ed                	jne    8024ae <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8024c1:	0f b6 c0             	movzbl %al,%eax
+  8024c4:	0f b6 16             	movzbl (%rsi),%edx
+  8024c7:	29 d0                	sub    %edx,%eax
+}
+  8024c9:	c3                   	ret
+
+00000000008024ca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8024ca:	48 85 d2             	test   %rdx,%rdx
+  8024cd:	74 1f                	je     8024ee <strncmp+0x24>
+  8024cf:	0f b6 07             	movzbl (%rdi),%eax
+  8024d2:	84 c0                	test   %al,%al
+  8024d4:	74 1e                	je     8024f4 <strncmp+0x2a>
+  8024d6:	3a 06                	cmp    (%rsi),%al
+  8024d8:	75 1a                	jne    8024f4 <strncmp+0x2a>
+  8024da:	48 83 c7 01          	add    $0x1,%rdi
+  8024de:	48 83 c6 01          	add    $0x1,%rsi
+  8024e2:	48 83 ea 01          	sub    $0x1,%rdx
+  8024e6:	75 e7                	jne    8024cf <strncmp+0x5>
+
+    if (!n) return 0;
+  8024e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ed:	c3                   	ret
+  8024ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f3:	c3                   	ret
+  8024f4:	48 85 d2             	test   %rdx,%rdx
+  8024f7:	74 09                	je     802502 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8024f9:	0f b6 07             	movzbl (%rdi),%eax
+  8024fc:	0f b6 16             	movzbl (%rsi),%edx
+  8024ff:	29 d0                	sub    %edx,%eax
+  802501:	c3                   	ret
+    if (!n) return 0;
+  802502:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802507:	c3                   	ret
+
+0000000000802508 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802508:	0f b6 17             	movzbl (%rdi),%edx
+  80250b:	84 d2                	test   %dl,%dl
+  80250d:	74 18                	je     802527 <strchr+0x1f>
+        if (*str == c) {
+  80250f:	0f be d2             	movsbl %dl,%edx
+  802512:	39 f2                	cmp    %esi,%edx
+  802514:	74 17                	je     80252d <strchr+0x25>
+    for (; *str; str++) {
+  802516:	48 83 c7 01          	add    $0x1,%rdi
+  80251a:	0f b6 17             	movzbl (%rdi),%edx
+  80251d:	84 d2                	test   %dl,%dl
+  80251f:	75 ee                	jne    80250f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802521:	b8 00 00 00 00       	mov    $0x0,%eax
+  802526:	c3                   	ret
+  802527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252c:	c3                   	ret
+  80252d:	48 89 f8             	mov    %rdi,%rax
+}
+  802530:	c3                   	ret
+
+0000000000802531 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802531:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802534:	0f b6 17             	movzbl (%rdi),%edx
+  802537:	84 d2                	test   %dl,%dl
+  802539:	74 13                	je     80254e <strfind+0x1d>
+  80253b:	0f be d2             	movsbl %dl,%edx
+  80253e:	39 f2                	cmp    %esi,%edx
+  802540:	74 0b                	je     80254d <strfind+0x1c>
+  802542:	48 83 c0 01          	add    $0x1,%rax
+  802546:	0f b6 10             	movzbl (%rax),%edx
+  802549:	84 d2                	test   %dl,%dl
+  80254b:	75 ee                	jne    80253b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80254d:	c3                   	ret
+  80254e:	c3                   	ret
+
+000000000080254f <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80254f:	48 39 f7             	cmp    %rsi,%rdi
+  802552:	74 65                	je     8025b9 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802554:	55                   	push   %rbp
+  802555:	48 89 e5             	mov    %rsp,%rbp
+  802558:	41 57                	push   %r15
+  80255a:	41 56                	push   %r14
+  80255c:	41 55                	push   %r13
+  80255e:	41 54                	push   %r12
+  802560:	53                   	push   %rbx
+  802561:	48 83 ec 18          	sub    $0x18,%rsp
+  802565:	48 89 fb             	mov    %rdi,%rbx
+  802568:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80256b:	49 bf 40 24 80 00 00 	movabs $0x802440,%r15
+  802572:	00 00 00 
+  802575:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802579:	41 0f b6 fd          	movzbl %r13b,%edi
+  80257d:	41 ff d7             	call   *%r15
+  802580:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802583:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802588:	41 0f b6 fe          	movzbl %r14b,%edi
+  80258c:	41 ff d7             	call   *%r15
+  80258f:	89 c2                	mov    %eax,%edx
+  802591:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802594:	29 d0                	sub    %edx,%eax
+  802596:	75 12                	jne    8025aa <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802598:	48 83 c3 01          	add    $0x1,%rbx
+  80259c:	45 84 ed             	test   %r13b,%r13b
+  80259f:	74 09                	je     8025aa <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8025a1:	49 83 c4 01          	add    $0x1,%r12
+  8025a5:	45 84 f6             	test   %r14b,%r14b
+  8025a8:	75 cb                	jne    802575 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8025aa:	48 83 c4 18          	add    $0x18,%rsp
+  8025ae:	5b                   	pop    %rbx
+  8025af:	41 5c                	pop    %r12
+  8025b1:	41 5d                	pop    %r13
+  8025b3:	41 5e                	pop    %r14
+  8025b5:	41 5f                	pop    %r15
+  8025b7:	5d                   	pop    %rbp
+  8025b8:	c3                   	ret
+    if (p1 == p2) return 0;
+  8025b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025be:	c3                   	ret
+
+00000000008025bf <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8025bf:	48 39 f7             	cmp    %rsi,%rdi
+  8025c2:	74 7d                	je     802641 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8025c4:	55                   	push   %rbp
+  8025c5:	48 89 e5             	mov    %rsp,%rbp
+  8025c8:	41 57                	push   %r15
+  8025ca:	41 56                	push   %r14
+  8025cc:	41 55                	push   %r13
+  8025ce:	41 54                	push   %r12
+  8025d0:	53                   	push   %rbx
+  8025d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8025d5:	48 89 fb             	mov    %rdi,%rbx
+  8025d8:	49 89 f4             	mov    %rsi,%r12
+  8025db:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8025df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8025e3:	49 bf 40 24 80 00 00 	movabs $0x802440,%r15
+  8025ea:	00 00 00 
+    while (n--) {
+  8025ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025f1:	48 39 c3             	cmp    %rax,%rbx
+  8025f4:	74 37                	je     80262d <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8025f6:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8025fa:	41 0f b6 fd          	movzbl %r13b,%edi
+  8025fe:	41 ff d7             	call   *%r15
+  802601:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802604:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802609:	41 0f b6 fe          	movzbl %r14b,%edi
+  80260d:	41 ff d7             	call   *%r15
+  802610:	89 c2                	mov    %eax,%edx
+  802612:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802615:	29 d0                	sub    %edx,%eax
+  802617:	75 19                	jne    802632 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802619:	48 83 c3 01          	add    $0x1,%rbx
+  80261d:	45 84 ed             	test   %r13b,%r13b
+  802620:	74 10                	je     802632 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802622:	49 83 c4 01          	add    $0x1,%r12
+  802626:	45 84 f6             	test   %r14b,%r14b
+  802629:	75 c2                	jne    8025ed <strncasecmp+0x2e>
+  80262b:	eb 05                	jmp    802632 <strncasecmp+0x73>
+  80262d:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802632:	48 83 c4 18          	add    $0x18,%rsp
+  802636:	5b                   	pop    %rbx
+  802637:	41 5c                	pop    %r12
+  802639:	41 5d                	pop    %r13
+  80263b:	41 5e                	pop    %r14
+  80263d:	41 5f                	pop    %r15
+  80263f:	5d                   	pop    %rbp
+  802640:	c3                   	ret
+    if (p1 == p2) return 0;
+  802641:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802646:	c3                   	ret
+
+0000000000802647 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802647:	83 e7 df             	and    $0xffffffdf,%edi
+  80264a:	83 ef 41             	sub    $0x41,%edi
+  80264d:	83 ff 19             	cmp    $0x19,%edi
+  802650:	0f 96 c0             	setbe  %al
+}
+  802653:	c3                   	ret
+
+0000000000802654 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802654:	83 ff 20             	cmp    $0x20,%edi
+  802657:	0f 94 c0             	sete   %al
+  80265a:	83 ff 09             	cmp    $0x9,%edi
+  80265d:	0f 94 c2             	sete   %dl
+  802660:	09 d0                	or     %edx,%eax
+}
+  802662:	c3                   	ret
+
+0000000000802663 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802663:	55                   	push   %rbp
+  802664:	48 89 e5             	mov    %rsp,%rbp
+  802667:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802669:	48 bf bf 67 80 00 00 	movabs $0x8067bf,%rdi
+  802670:	00 00 00 
+  802673:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  80267a:	00 00 00 
+  80267d:	ff d0                	call   *%rax
+  80267f:	48 85 c0             	test   %rax,%rax
+  802682:	0f 95 c0             	setne  %al
+}
+  802685:	5d                   	pop    %rbp
+  802686:	c3                   	ret
+
+0000000000802687 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802687:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80268a:	48 89 f8             	mov    %rdi,%rax
+  80268d:	48 f7 d8             	neg    %rax
+  802690:	83 e0 07             	and    $0x7,%eax
+  802693:	49 89 d1             	mov    %rdx,%r9
+  802696:	49 29 c1             	sub    %rax,%r9
+  802699:	78 36                	js     8026d1 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80269b:	40 0f b6 c6          	movzbl %sil,%eax
+  80269f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8026a6:	01 01 01 
+  8026a9:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8026ad:	40 f6 c7 07          	test   $0x7,%dil
+  8026b1:	75 38                	jne    8026eb <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8026b3:	4c 89 c9             	mov    %r9,%rcx
+  8026b6:	48 c1 f9 03          	sar    $0x3,%rcx
+  8026ba:	74 0c                	je     8026c8 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8026bc:	fc                   	cld
+  8026bd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8026c0:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8026c4:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8026c8:	4d 85 c9             	test   %r9,%r9
+  8026cb:	75 45                	jne    802712 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8026cd:	4c 89 c0             	mov    %r8,%rax
+  8026d0:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8026d1:	48 85 d2             	test   %rdx,%rdx
+  8026d4:	74 f7                	je     8026cd <memset+0x46>
+  8026d6:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8026d9:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8026dc:	48 83 c0 01          	add    $0x1,%rax
+  8026e0:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8026e4:	48 39 c2             	cmp    %rax,%rdx
+  8026e7:	75 f3                	jne    8026dc <memset+0x55>
+  8026e9:	eb e2                	jmp    8026cd <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8026eb:	40 f6 c7 01          	test   $0x1,%dil
+  8026ef:	74 06                	je     8026f7 <memset+0x70>
+  8026f1:	88 07                	mov    %al,(%rdi)
+  8026f3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026f7:	40 f6 c7 02          	test   $0x2,%dil
+  8026fb:	74 07                	je     802704 <memset+0x7d>
+  8026fd:	66 89 07             	mov    %ax,(%rdi)
+  802700:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802704:	40 f6 c7 04          	test   $0x4,%dil
+  802708:	74 a9                	je     8026b3 <memset+0x2c>
+  80270a:	89 07                	mov    %eax,(%rdi)
+  80270c:	48 83 c7 04          	add    $0x4,%rdi
+  802710:	eb a1                	jmp    8026b3 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802712:	41 f6 c1 04          	test   $0x4,%r9b
+  802716:	74 06                	je     80271e <memset+0x97>
+  802718:	89 07                	mov    %eax,(%rdi)
+  80271a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80271e:	41 f6 c1 02          	test   $0x2,%r9b
+  802722:	74 07                	je     80272b <memset+0xa4>
+  802724:	66 89 07             	mov    %ax,(%rdi)
+  802727:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80272b:	41 f6 c1 01          	test   $0x1,%r9b
+  80272f:	74 9c                	je     8026cd <memset+0x46>
+  802731:	88 07                	mov    %al,(%rdi)
+  802733:	eb 98                	jmp    8026cd <memset+0x46>
+
+0000000000802735 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802735:	48 89 f8             	mov    %rdi,%rax
+  802738:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80273b:	48 39 fe             	cmp    %rdi,%rsi
+  80273e:	73 3b                	jae    80277b <memmove+0x46>
+  802740:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802744:	48 39 d7             	cmp    %rdx,%rdi
+  802747:	73 32                	jae    80277b <memmove+0x46>
+        s += n;
+        d += n;
+  802749:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80274d:	48 89 d6             	mov    %rdx,%rsi
+  802750:	48 09 fe             	or     %rdi,%rsi
+  802753:	48 09 ce             	or     %rcx,%rsi
+  802756:	40 f6 c6 07          	test   $0x7,%sil
+  80275a:	75 12                	jne    80276e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80275c:	48 83 ef 08          	sub    $0x8,%rdi
+  802760:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802764:	48 c1 e9 03          	shr    $0x3,%rcx
+  802768:	fd                   	std
+  802769:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80276c:	fc                   	cld
+  80276d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80276e:	48 83 ef 01          	sub    $0x1,%rdi
+  802772:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802776:	fd                   	std
+  802777:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802779:	eb f1                	jmp    80276c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80277b:	48 89 f2             	mov    %rsi,%rdx
+  80277e:	48 09 c2             	or     %rax,%rdx
+  802781:	48 09 ca             	or     %rcx,%rdx
+  802784:	f6 c2 07             	test   $0x7,%dl
+  802787:	75 0c                	jne    802795 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802789:	48 c1 e9 03          	shr    $0x3,%rcx
+  80278d:	48 89 c7             	mov    %rax,%rdi
+  802790:	fc                   	cld
+  802791:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802794:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802795:	48 89 c7             	mov    %rax,%rdi
+  802798:	fc                   	cld
+  802799:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80279b:	c3                   	ret
+
+000000000080279c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80279c:	55                   	push   %rbp
+  80279d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8027a0:	48 b8 35 27 80 00 00 	movabs $0x802735,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+}
+  8027ac:	5d                   	pop    %rbp
+  8027ad:	c3                   	ret
+
+00000000008027ae <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8027ae:	55                   	push   %rbp
+  8027af:	48 89 e5             	mov    %rsp,%rbp
+  8027b2:	41 57                	push   %r15
+  8027b4:	41 56                	push   %r14
+  8027b6:	41 55                	push   %r13
+  8027b8:	41 54                	push   %r12
+  8027ba:	53                   	push   %rbx
+  8027bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bf:	49 89 fe             	mov    %rdi,%r14
+  8027c2:	49 89 f7             	mov    %rsi,%r15
+  8027c5:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8027c8:	48 89 f7             	mov    %rsi,%rdi
+  8027cb:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  8027d2:	00 00 00 
+  8027d5:	ff d0                	call   *%rax
+  8027d7:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8027da:	48 89 de             	mov    %rbx,%rsi
+  8027dd:	4c 89 f7             	mov    %r14,%rdi
+  8027e0:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  8027e7:	00 00 00 
+  8027ea:	ff d0                	call   *%rax
+  8027ec:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027ef:	48 39 c3             	cmp    %rax,%rbx
+  8027f2:	74 36                	je     80282a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8027f4:	48 89 d8             	mov    %rbx,%rax
+  8027f7:	4c 29 e8             	sub    %r13,%rax
+  8027fa:	49 39 c4             	cmp    %rax,%r12
+  8027fd:	73 31                	jae    802830 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8027ff:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802804:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802808:	4c 89 fe             	mov    %r15,%rsi
+  80280b:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  802812:	00 00 00 
+  802815:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802817:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80281b:	48 83 c4 08          	add    $0x8,%rsp
+  80281f:	5b                   	pop    %rbx
+  802820:	41 5c                	pop    %r12
+  802822:	41 5d                	pop    %r13
+  802824:	41 5e                	pop    %r14
+  802826:	41 5f                	pop    %r15
+  802828:	5d                   	pop    %rbp
+  802829:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80282a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80282e:	eb eb                	jmp    80281b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802830:	48 83 eb 01          	sub    $0x1,%rbx
+  802834:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802838:	48 89 da             	mov    %rbx,%rdx
+  80283b:	4c 89 fe             	mov    %r15,%rsi
+  80283e:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80284a:	49 01 de             	add    %rbx,%r14
+  80284d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802852:	eb c3                	jmp    802817 <strlcat+0x69>
+
+0000000000802854 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802854:	48 85 d2             	test   %rdx,%rdx
+  802857:	74 2d                	je     802886 <memcmp+0x32>
+  802859:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80285e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802862:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802867:	44 38 c1             	cmp    %r8b,%cl
+  80286a:	75 0f                	jne    80287b <memcmp+0x27>
+    while (n-- > 0) {
+  80286c:	48 83 c0 01          	add    $0x1,%rax
+  802870:	48 39 c2             	cmp    %rax,%rdx
+  802873:	75 e9                	jne    80285e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80287b:	0f b6 c1             	movzbl %cl,%eax
+  80287e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802882:	44 29 c0             	sub    %r8d,%eax
+  802885:	c3                   	ret
+    return 0;
+  802886:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288b:	c3                   	ret
+
+000000000080288c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80288c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802890:	48 39 c7             	cmp    %rax,%rdi
+  802893:	73 0f                	jae    8028a4 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802895:	40 38 37             	cmp    %sil,(%rdi)
+  802898:	74 0e                	je     8028a8 <memfind+0x1c>
+    for (; src < end; src++) {
+  80289a:	48 83 c7 01          	add    $0x1,%rdi
+  80289e:	48 39 f8             	cmp    %rdi,%rax
+  8028a1:	75 f2                	jne    802895 <memfind+0x9>
+  8028a3:	c3                   	ret
+  8028a4:	48 89 f8             	mov    %rdi,%rax
+  8028a7:	c3                   	ret
+  8028a8:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8028ab:	c3                   	ret
+
+00000000008028ac <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8028ac:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8028af:	0f b6 37             	movzbl (%rdi),%esi
+  8028b2:	40 80 fe 20          	cmp    $0x20,%sil
+  8028b6:	74 06                	je     8028be <strtol+0x12>
+  8028b8:	40 80 fe 09          	cmp    $0x9,%sil
+  8028bc:	75 13                	jne    8028d1 <strtol+0x25>
+  8028be:	48 83 c7 01          	add    $0x1,%rdi
+  8028c2:	0f b6 37             	movzbl (%rdi),%esi
+  8028c5:	40 80 fe 20          	cmp    $0x20,%sil
+  8028c9:	74 f3                	je     8028be <strtol+0x12>
+  8028cb:	40 80 fe 09          	cmp    $0x9,%sil
+  8028cf:	74 ed                	je     8028be <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8028d1:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8028d4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8028d7:	3c 01                	cmp    $0x1,%al
+  8028d9:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028dd:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8028e3:	75 0f                	jne    8028f4 <strtol+0x48>
+  8028e5:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8028e8:	74 14                	je     8028fe <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8028ea:	85 d2                	test   %edx,%edx
+  8028ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8028f1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8028f4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8028f9:	4c 63 ca             	movslq %edx,%r9
+  8028fc:	eb 36                	jmp    802934 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028fe:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802902:	74 0f                	je     802913 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802904:	85 d2                	test   %edx,%edx
+  802906:	75 ec                	jne    8028f4 <strtol+0x48>
+        s++;
+  802908:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80290c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802911:	eb e1                	jmp    8028f4 <strtol+0x48>
+        s += 2;
+  802913:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802917:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80291c:	eb d6                	jmp    8028f4 <strtol+0x48>
+            dig -= '0';
+  80291e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802921:	44 0f b6 c1          	movzbl %cl,%r8d
+  802925:	41 39 d0             	cmp    %edx,%r8d
+  802928:	7d 21                	jge    80294b <strtol+0x9f>
+        val = val * base + dig;
+  80292a:	49 0f af c1          	imul   %r9,%rax
+  80292e:	0f b6 c9             	movzbl %cl,%ecx
+  802931:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802934:	48 83 c7 01          	add    $0x1,%rdi
+  802938:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80293c:	80 f9 39             	cmp    $0x39,%cl
+  80293f:	76 dd                	jbe    80291e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802941:	80 f9 7b             	cmp    $0x7b,%cl
+  802944:	77 05                	ja     80294b <strtol+0x9f>
+            dig -= 'a' - 10;
+  802946:	83 e9 57             	sub    $0x57,%ecx
+  802949:	eb d6                	jmp    802921 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80294b:	4d 85 d2             	test   %r10,%r10
+  80294e:	74 03                	je     802953 <strtol+0xa7>
+  802950:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802953:	48 89 c2             	mov    %rax,%rdx
+  802956:	48 f7 da             	neg    %rdx
+  802959:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80295d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802961:	c3                   	ret
+
+0000000000802962 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802962:	55                   	push   %rbp
+  802963:	48 89 e5             	mov    %rsp,%rbp
+  802966:	53                   	push   %rbx
+  802967:	48 89 fa             	mov    %rdi,%rdx
+  80296a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80296d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802972:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802977:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297c:	be 00 00 00 00       	mov    $0x0,%esi
+  802981:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802987:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80298d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80298f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802993:	c9                   	leave
+  802994:	c3                   	ret
+
+0000000000802995 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802995:	55                   	push   %rbp
+  802996:	48 89 e5             	mov    %rsp,%rbp
+  802999:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80299a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80299f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029c4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ca:	c9                   	leave
+  8029cb:	c3                   	ret
+
+00000000008029cc <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8029cc:	55                   	push   %rbp
+  8029cd:	48 89 e5             	mov    %rsp,%rbp
+  8029d0:	53                   	push   %rbx
+  8029d1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8029fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ff:	c9                   	leave
+  802a00:	c3                   	ret
+
+0000000000802a01 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802a01:	55                   	push   %rbp
+  802a02:	48 89 e5             	mov    %rsp,%rbp
+  802a05:	53                   	push   %rbx
+  802a06:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802a0a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a0d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a12:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a1c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a21:	be 00 00 00 00       	mov    $0x0,%esi
+  802a26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a32:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a34:	48 85 c0             	test   %rax,%rax
+  802a37:	7f 06                	jg     802a3f <sys_env_destroy+0x3e>
+}
+  802a39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a3d:	c9                   	leave
+  802a3e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a3f:	49 89 c0             	mov    %rax,%r8
+  802a42:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802a47:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802a4e:	00 00 00 
+  802a51:	be 27 00 00 00       	mov    $0x27,%esi
+  802a56:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802a5d:	00 00 00 
+  802a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a65:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802a6c:	00 00 00 
+  802a6f:	41 ff d1             	call   *%r9
+
+0000000000802a72 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a72:	55                   	push   %rbp
+  802a73:	48 89 e5             	mov    %rsp,%rbp
+  802a76:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a77:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a81:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a8b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a90:	be 00 00 00 00       	mov    $0x0,%esi
+  802a95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a9b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aa1:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802aa3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa7:	c9                   	leave
+  802aa8:	c3                   	ret
+
+0000000000802aa9 <sys_yield>:
+
+void
+sys_yield(void) {
+  802aa9:	55                   	push   %rbp
+  802aaa:	48 89 e5             	mov    %rsp,%rbp
+  802aad:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802aae:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ab3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802abd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac7:	be 00 00 00 00       	mov    $0x0,%esi
+  802acc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ad2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ada:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+0000000000802ae0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802ae0:	55                   	push   %rbp
+  802ae1:	48 89 e5             	mov    %rsp,%rbp
+  802ae4:	53                   	push   %rbx
+  802ae5:	48 89 fa             	mov    %rdi,%rdx
+  802ae8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802aeb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802af0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802af7:	00 00 00 
+  802afa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aff:	be 00 00 00 00       	mov    $0x0,%esi
+  802b04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b10:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802b12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b16:	c9                   	leave
+  802b17:	c3                   	ret
+
+0000000000802b18 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802b18:	55                   	push   %rbp
+  802b19:	48 89 e5             	mov    %rsp,%rbp
+  802b1c:	53                   	push   %rbx
+  802b1d:	49 89 f8             	mov    %rdi,%r8
+  802b20:	48 89 d3             	mov    %rdx,%rbx
+  802b23:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802b26:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b2b:	4c 89 c2             	mov    %r8,%rdx
+  802b2e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b31:	be 00 00 00 00       	mov    $0x0,%esi
+  802b36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b42:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802b44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b48:	c9                   	leave
+  802b49:	c3                   	ret
+
+0000000000802b4a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802b4a:	55                   	push   %rbp
+  802b4b:	48 89 e5             	mov    %rsp,%rbp
+  802b4e:	53                   	push   %rbx
+  802b4f:	48 83 ec 08          	sub    $0x8,%rsp
+  802b53:	89 f8                	mov    %edi,%eax
+  802b55:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802b58:	48 63 f9             	movslq %ecx,%rdi
+  802b5b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b5e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b63:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b66:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b71:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b77:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b79:	48 85 c0             	test   %rax,%rax
+  802b7c:	7f 06                	jg     802b84 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b84:	49 89 c0             	mov    %rax,%r8
+  802b87:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b8c:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802b93:	00 00 00 
+  802b96:	be 27 00 00 00       	mov    $0x27,%esi
+  802b9b:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802ba2:	00 00 00 
+  802ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802baa:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802bb1:	00 00 00 
+  802bb4:	41 ff d1             	call   *%r9
+
+0000000000802bb7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802bb7:	55                   	push   %rbp
+  802bb8:	48 89 e5             	mov    %rsp,%rbp
+  802bbb:	53                   	push   %rbx
+  802bbc:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc0:	89 f8                	mov    %edi,%eax
+  802bc2:	49 89 f2             	mov    %rsi,%r10
+  802bc5:	48 89 cf             	mov    %rcx,%rdi
+  802bc8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802bcb:	48 63 da             	movslq %edx,%rbx
+  802bce:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bd1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bd6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd9:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802bdc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802be2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be4:	48 85 c0             	test   %rax,%rax
+  802be7:	7f 06                	jg     802bef <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802be9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bed:	c9                   	leave
+  802bee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bef:	49 89 c0             	mov    %rax,%r8
+  802bf2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802bf7:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802bfe:	00 00 00 
+  802c01:	be 27 00 00 00       	mov    $0x27,%esi
+  802c06:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802c0d:	00 00 00 
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c15:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802c1c:	00 00 00 
+  802c1f:	41 ff d1             	call   *%r9
+
+0000000000802c22 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802c22:	55                   	push   %rbp
+  802c23:	48 89 e5             	mov    %rsp,%rbp
+  802c26:	53                   	push   %rbx
+  802c27:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2b:	48 89 f1             	mov    %rsi,%rcx
+  802c2e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802c31:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c34:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c39:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c3e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c49:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c4f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c51:	48 85 c0             	test   %rax,%rax
+  802c54:	7f 06                	jg     802c5c <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802c56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c5a:	c9                   	leave
+  802c5b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5c:	49 89 c0             	mov    %rax,%r8
+  802c5f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c64:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802c6b:	00 00 00 
+  802c6e:	be 27 00 00 00       	mov    $0x27,%esi
+  802c73:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802c7a:	00 00 00 
+  802c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c82:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802c89:	00 00 00 
+  802c8c:	41 ff d1             	call   *%r9
+
+0000000000802c8f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	53                   	push   %rbx
+  802c94:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c98:	48 63 ce             	movslq %esi,%rcx
+  802c9b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c9e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cad:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cc0:	48 85 c0             	test   %rax,%rax
+  802cc3:	7f 06                	jg     802ccb <sys_env_set_status+0x3c>
+}
+  802cc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc9:	c9                   	leave
+  802cca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ccb:	49 89 c0             	mov    %rax,%r8
+  802cce:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802cd3:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802cda:	00 00 00 
+  802cdd:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce2:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802ce9:	00 00 00 
+  802cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf1:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802cf8:	00 00 00 
+  802cfb:	41 ff d1             	call   *%r9
+
+0000000000802cfe <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802cfe:	55                   	push   %rbp
+  802cff:	48 89 e5             	mov    %rsp,%rbp
+  802d02:	53                   	push   %rbx
+  802d03:	48 83 ec 08          	sub    $0x8,%rsp
+  802d07:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802d0a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d17:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d1c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d2f:	48 85 c0             	test   %rax,%rax
+  802d32:	7f 06                	jg     802d3a <sys_env_set_trapframe+0x3c>
+}
+  802d34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d38:	c9                   	leave
+  802d39:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d3a:	49 89 c0             	mov    %rax,%r8
+  802d3d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802d42:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802d49:	00 00 00 
+  802d4c:	be 27 00 00 00       	mov    $0x27,%esi
+  802d51:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802d58:	00 00 00 
+  802d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d60:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802d67:	00 00 00 
+  802d6a:	41 ff d1             	call   *%r9
+
+0000000000802d6d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802d6d:	55                   	push   %rbp
+  802d6e:	48 89 e5             	mov    %rsp,%rbp
+  802d71:	53                   	push   %rbx
+  802d72:	48 83 ec 08          	sub    $0x8,%rsp
+  802d76:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d79:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d86:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d8b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d9c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d9e:	48 85 c0             	test   %rax,%rax
+  802da1:	7f 06                	jg     802da9 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802da3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da7:	c9                   	leave
+  802da8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802da9:	49 89 c0             	mov    %rax,%r8
+  802dac:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802db1:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802db8:	00 00 00 
+  802dbb:	be 27 00 00 00       	mov    $0x27,%esi
+  802dc0:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802dc7:	00 00 00 
+  802dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcf:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802dd6:	00 00 00 
+  802dd9:	41 ff d1             	call   *%r9
+
+0000000000802ddc <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802ddc:	55                   	push   %rbp
+  802ddd:	48 89 e5             	mov    %rsp,%rbp
+  802de0:	53                   	push   %rbx
+  802de1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802de5:	40 0f b6 ce          	movzbl %sil,%ecx
+  802de9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dec:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dfb:	be 00 00 00 00       	mov    $0x0,%esi
+  802e00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e0c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e0e:	48 85 c0             	test   %rax,%rax
+  802e11:	7f 06                	jg     802e19 <sys_env_set_reclaim+0x3d>
+}
+  802e13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e17:	c9                   	leave
+  802e18:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e19:	49 89 c0             	mov    %rax,%r8
+  802e1c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802e21:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802e28:	00 00 00 
+  802e2b:	be 27 00 00 00       	mov    $0x27,%esi
+  802e30:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802e37:	00 00 00 
+  802e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3f:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802e46:	00 00 00 
+  802e49:	41 ff d1             	call   *%r9
+
+0000000000802e4c <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802e4c:	55                   	push   %rbp
+  802e4d:	48 89 e5             	mov    %rsp,%rbp
+  802e50:	53                   	push   %rbx
+  802e51:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802e55:	48 63 ce             	movslq %esi,%rcx
+  802e58:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e5b:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e65:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e6a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e75:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e7b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e7d:	48 85 c0             	test   %rax,%rax
+  802e80:	7f 06                	jg     802e88 <sys_env_set_nice+0x3c>
+}
+  802e82:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e86:	c9                   	leave
+  802e87:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e88:	49 89 c0             	mov    %rax,%r8
+  802e8b:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e90:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802e97:	00 00 00 
+  802e9a:	be 27 00 00 00       	mov    $0x27,%esi
+  802e9f:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802ea6:	00 00 00 
+  802ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eae:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802eb5:	00 00 00 
+  802eb8:	41 ff d1             	call   *%r9
+
+0000000000802ebb <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ebb:	55                   	push   %rbp
+  802ebc:	48 89 e5             	mov    %rsp,%rbp
+  802ebf:	53                   	push   %rbx
+  802ec0:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ec3:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ec8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ecd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ed2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  802edc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ee2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ee8:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802eea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eee:	c9                   	leave
+  802eef:	c3                   	ret
+
+0000000000802ef0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ef0:	55                   	push   %rbp
+  802ef1:	48 89 e5             	mov    %rsp,%rbp
+  802ef4:	53                   	push   %rbx
+  802ef5:	89 f8                	mov    %edi,%eax
+  802ef7:	49 89 f1             	mov    %rsi,%r9
+  802efa:	48 89 d3             	mov    %rdx,%rbx
+  802efd:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802f00:	49 63 f0             	movslq %r8d,%rsi
+  802f03:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f06:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f0b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f14:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f1a:	cd 30                	int    $0x30
+}
+  802f1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f20:	c9                   	leave
+  802f21:	c3                   	ret
+
+0000000000802f22 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802f22:	55                   	push   %rbp
+  802f23:	48 89 e5             	mov    %rsp,%rbp
+  802f26:	53                   	push   %rbx
+  802f27:	89 f8                	mov    %edi,%eax
+  802f29:	49 89 f1             	mov    %rsi,%r9
+  802f2c:	48 89 d3             	mov    %rdx,%rbx
+  802f2f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802f32:	49 63 f0             	movslq %r8d,%rsi
+  802f35:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f38:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f3d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f46:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f4c:	cd 30                	int    $0x30
+}
+  802f4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f52:	c9                   	leave
+  802f53:	c3                   	ret
+
+0000000000802f54 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f54:	55                   	push   %rbp
+  802f55:	48 89 e5             	mov    %rsp,%rbp
+  802f58:	53                   	push   %rbx
+  802f59:	48 83 ec 08          	sub    $0x8,%rsp
+  802f5d:	89 f8                	mov    %edi,%eax
+  802f5f:	49 89 f2             	mov    %rsi,%r10
+  802f62:	48 89 d3             	mov    %rdx,%rbx
+  802f65:	48 89 cf             	mov    %rcx,%rdi
+  802f68:	44 89 c6             	mov    %r8d,%esi
+  802f6b:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f6e:	48 63 f6             	movslq %esi,%rsi
+  802f71:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f74:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f79:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f7c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f80:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f82:	48 85 c0             	test   %rax,%rax
+  802f85:	7f 06                	jg     802f8d <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f8b:	c9                   	leave
+  802f8c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f8d:	49 89 c0             	mov    %rax,%r8
+  802f90:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f95:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  802f9c:	00 00 00 
+  802f9f:	be 27 00 00 00       	mov    $0x27,%esi
+  802fa4:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  802fab:	00 00 00 
+  802fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb3:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  802fba:	00 00 00 
+  802fbd:	41 ff d1             	call   *%r9
+
+0000000000802fc0 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802fc0:	55                   	push   %rbp
+  802fc1:	48 89 e5             	mov    %rsp,%rbp
+  802fc4:	53                   	push   %rbx
+  802fc5:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc9:	48 89 f1             	mov    %rsi,%rcx
+  802fcc:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802fcf:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802fd3:	48 8b 1a             	mov    (%rdx),%rbx
+  802fd6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fd9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fde:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fe2:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802fe6:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802fea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fec:	48 85 c0             	test   %rax,%rax
+  802fef:	7f 06                	jg     802ff7 <sys_ipc_call_short+0x37>
+}
+  802ff1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff5:	c9                   	leave
+  802ff6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ff7:	49 89 c0             	mov    %rax,%r8
+  802ffa:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802fff:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  803006:	00 00 00 
+  803009:	be 27 00 00 00       	mov    $0x27,%esi
+  80300e:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  803015:	00 00 00 
+  803018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301d:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  803024:	00 00 00 
+  803027:	41 ff d1             	call   *%r9
+
+000000000080302a <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80302a:	55                   	push   %rbp
+  80302b:	48 89 e5             	mov    %rsp,%rbp
+  80302e:	53                   	push   %rbx
+  80302f:	48 83 ec 08          	sub    $0x8,%rsp
+  803033:	89 f8                	mov    %edi,%eax
+  803035:	49 89 f2             	mov    %rsi,%r10
+  803038:	48 89 d3             	mov    %rdx,%rbx
+  80303b:	48 89 cf             	mov    %rcx,%rdi
+  80303e:	44 89 c6             	mov    %r8d,%esi
+  803041:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803044:	48 63 f6             	movslq %esi,%rsi
+  803047:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80304a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80304f:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803052:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803056:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803058:	48 85 c0             	test   %rax,%rax
+  80305b:	7f 06                	jg     803063 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80305d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803061:	c9                   	leave
+  803062:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803063:	49 89 c0             	mov    %rax,%r8
+  803066:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80306b:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  803072:	00 00 00 
+  803075:	be 27 00 00 00       	mov    $0x27,%esi
+  80307a:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  803081:	00 00 00 
+  803084:	b8 00 00 00 00       	mov    $0x0,%eax
+  803089:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  803090:	00 00 00 
+  803093:	41 ff d1             	call   *%r9
+
+0000000000803096 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803096:	55                   	push   %rbp
+  803097:	48 89 e5             	mov    %rsp,%rbp
+  80309a:	53                   	push   %rbx
+  80309b:	48 83 ec 08          	sub    $0x8,%rsp
+  80309f:	48 89 fa             	mov    %rdi,%rdx
+  8030a2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8030a5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8030c7:	48 85 c0             	test   %rax,%rax
+  8030ca:	7f 06                	jg     8030d2 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8030cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030d0:	c9                   	leave
+  8030d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8030d2:	49 89 c0             	mov    %rax,%r8
+  8030d5:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8030da:	48 ba c8 67 80 00 00 	movabs $0x8067c8,%rdx
+  8030e1:	00 00 00 
+  8030e4:	be 27 00 00 00       	mov    $0x27,%esi
+  8030e9:	48 bf e7 67 80 00 00 	movabs $0x8067e7,%rdi
+  8030f0:	00 00 00 
+  8030f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f8:	49 b9 5e 19 80 00 00 	movabs $0x80195e,%r9
+  8030ff:	00 00 00 
+  803102:	41 ff d1             	call   *%r9
+
+0000000000803105 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803105:	55                   	push   %rbp
+  803106:	48 89 e5             	mov    %rsp,%rbp
+  803109:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80310a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80310f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803114:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803119:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80311e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803123:	be 00 00 00 00       	mov    $0x0,%esi
+  803128:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80312e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803134:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803136:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80313a:	c9                   	leave
+  80313b:	c3                   	ret
+
+000000000080313c <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  80313c:	55                   	push   %rbp
+  80313d:	48 89 e5             	mov    %rsp,%rbp
+  803140:	53                   	push   %rbx
+  803141:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803144:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803149:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80314e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803153:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803158:	be 00 00 00 00       	mov    $0x0,%esi
+  80315d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803163:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803169:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  80316b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80316f:	c9                   	leave
+  803170:	c3                   	ret
+
+0000000000803171 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803171:	55                   	push   %rbp
+  803172:	48 89 e5             	mov    %rsp,%rbp
+  803175:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803176:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80317b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803180:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803185:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80318a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80318f:	be 00 00 00 00       	mov    $0x0,%esi
+  803194:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80319a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8031a0:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8031a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031a6:	c9                   	leave
+  8031a7:	c3                   	ret
+
+00000000008031a8 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8031a8:	55                   	push   %rbp
+  8031a9:	48 89 e5             	mov    %rsp,%rbp
+  8031ac:	53                   	push   %rbx
+  8031ad:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8031b1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8031b6:	cd 30                	int    $0x30
+  8031b8:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  8031ba:	85 c0                	test   %eax,%eax
+  8031bc:	0f 88 85 00 00 00    	js     803247 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  8031c2:	0f 84 ac 00 00 00    	je     803274 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  8031c8:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8031ce:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8031d5:	00 00 00 
+  8031d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031dd:	89 c2                	mov    %eax,%edx
+  8031df:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031e9:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  8031f0:	00 00 00 
+  8031f3:	ff d0                	call   *%rax
+  8031f5:	85 c0                	test   %eax,%eax
+  8031f7:	0f 88 a8 00 00 00    	js     8032a5 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8031fd:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803204:	00 00 00 
+  803207:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  80320e:	89 df                	mov    %ebx,%edi
+  803210:	48 b8 6d 2d 80 00 00 	movabs $0x802d6d,%rax
+  803217:	00 00 00 
+  80321a:	ff d0                	call   *%rax
+  80321c:	85 c0                	test   %eax,%eax
+  80321e:	0f 88 ae 00 00 00    	js     8032d2 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  803224:	be 02 00 00 00       	mov    $0x2,%esi
+  803229:	89 df                	mov    %ebx,%edi
+  80322b:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  803232:	00 00 00 
+  803235:	ff d0                	call   *%rax
+  803237:	85 c0                	test   %eax,%eax
+  803239:	0f 88 c0 00 00 00    	js     8032ff <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  80323f:	89 d8                	mov    %ebx,%eax
+  803241:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803245:	c9                   	leave
+  803246:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803247:	89 c1                	mov    %eax,%ecx
+  803249:	48 ba f5 67 80 00 00 	movabs $0x8067f5,%rdx
+  803250:	00 00 00 
+  803253:	be 20 00 00 00       	mov    $0x20,%esi
+  803258:	48 bf 05 68 80 00 00 	movabs $0x806805,%rdi
+  80325f:	00 00 00 
+  803262:	b8 00 00 00 00       	mov    $0x0,%eax
+  803267:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  80326e:	00 00 00 
+  803271:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803274:	48 b8 72 2a 80 00 00 	movabs $0x802a72,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+  803280:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803285:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80328c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803293:	00 00 00 
+  803296:	48 01 d0             	add    %rdx,%rax
+  803299:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8032a0:	00 00 00 
+        return 0;
+  8032a3:	eb 9a                	jmp    80323f <fork+0x97>
+        panic("sys_map_region: %i", res);
+  8032a5:	89 c1                	mov    %eax,%ecx
+  8032a7:	48 ba 10 68 80 00 00 	movabs $0x806810,%rdx
+  8032ae:	00 00 00 
+  8032b1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8032b6:	48 bf 05 68 80 00 00 	movabs $0x806805,%rdi
+  8032bd:	00 00 00 
+  8032c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c5:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  8032cc:	00 00 00 
+  8032cf:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  8032d2:	89 c1                	mov    %eax,%ecx
+  8032d4:	48 ba 58 68 80 00 00 	movabs $0x806858,%rdx
+  8032db:	00 00 00 
+  8032de:	be 32 00 00 00       	mov    $0x32,%esi
+  8032e3:	48 bf 05 68 80 00 00 	movabs $0x806805,%rdi
+  8032ea:	00 00 00 
+  8032ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f2:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  8032f9:	00 00 00 
+  8032fc:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8032ff:	89 c1                	mov    %eax,%ecx
+  803301:	48 ba 23 68 80 00 00 	movabs $0x806823,%rdx
+  803308:	00 00 00 
+  80330b:	be 37 00 00 00       	mov    $0x37,%esi
+  803310:	48 bf 05 68 80 00 00 	movabs $0x806805,%rdi
+  803317:	00 00 00 
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331f:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  803326:	00 00 00 
+  803329:	41 ff d0             	call   *%r8
+
+000000000080332c <sfork>:
+
+envid_t
+sfork() {
+  80332c:	55                   	push   %rbp
+  80332d:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  803330:	48 ba 3a 68 80 00 00 	movabs $0x80683a,%rdx
+  803337:	00 00 00 
+  80333a:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80333f:	48 bf 05 68 80 00 00 	movabs $0x806805,%rdi
+  803346:	00 00 00 
+  803349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334e:	48 b9 5e 19 80 00 00 	movabs $0x80195e,%rcx
+  803355:	00 00 00 
+  803358:	ff d1                	call   *%rcx
+
+000000000080335a <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80335a:	85 ff                	test   %edi,%edi
+  80335c:	78 58                	js     8033b6 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80335e:	48 85 f6             	test   %rsi,%rsi
+  803361:	74 12                	je     803375 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  803363:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80336a:	00 00 00 
+  80336d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803373:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  803375:	48 85 c9             	test   %rcx,%rcx
+  803378:	74 12                	je     80338c <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80337a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803381:	00 00 00 
+  803384:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80338a:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80338c:	48 85 d2             	test   %rdx,%rdx
+  80338f:	74 14                	je     8033a5 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  803391:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803398:	00 00 00 
+  80339b:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8033a2:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8033a5:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033ac:	00 00 00 
+  8033af:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8033b5:	c3                   	ret
+        if (from_env_store) {
+  8033b6:	48 85 f6             	test   %rsi,%rsi
+  8033b9:	74 06                	je     8033c1 <ipc_result+0x67>
+            *from_env_store = 0;
+  8033bb:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8033c1:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8033c3:	48 85 c9             	test   %rcx,%rcx
+  8033c6:	74 ed                	je     8033b5 <ipc_result+0x5b>
+            *perm_store = 0;
+  8033c8:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8033ce:	c3                   	ret
+
+00000000008033cf <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8033cf:	55                   	push   %rbp
+  8033d0:	48 89 e5             	mov    %rsp,%rbp
+  8033d3:	41 55                	push   %r13
+  8033d5:	41 54                	push   %r12
+  8033d7:	53                   	push   %rbx
+  8033d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8033dc:	49 89 fc             	mov    %rdi,%r12
+  8033df:	48 89 f7             	mov    %rsi,%rdi
+  8033e2:	48 89 d3             	mov    %rdx,%rbx
+  8033e5:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8033e8:	48 85 f6             	test   %rsi,%rsi
+  8033eb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8033f2:	00 00 00 
+  8033f5:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8033f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8033fe:	48 85 d2             	test   %rdx,%rdx
+  803401:	74 03                	je     803406 <ipc_recv+0x37>
+  803403:	48 8b 32             	mov    (%rdx),%rsi
+  803406:	48 b8 96 30 80 00 00 	movabs $0x803096,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+  803412:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  803414:	4c 89 e9             	mov    %r13,%rcx
+  803417:	48 89 da             	mov    %rbx,%rdx
+  80341a:	4c 89 e6             	mov    %r12,%rsi
+  80341d:	48 b8 5a 33 80 00 00 	movabs $0x80335a,%rax
+  803424:	00 00 00 
+  803427:	ff d0                	call   *%rax
+}
+  803429:	48 83 c4 08          	add    $0x8,%rsp
+  80342d:	5b                   	pop    %rbx
+  80342e:	41 5c                	pop    %r12
+  803430:	41 5d                	pop    %r13
+  803432:	5d                   	pop    %rbp
+  803433:	c3                   	ret
+
+0000000000803434 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803434:	55                   	push   %rbp
+  803435:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803438:	48 85 d2             	test   %rdx,%rdx
+  80343b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803442:	00 00 00 
+  803445:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  803449:	89 f6                	mov    %esi,%esi
+  80344b:	48 b8 22 2f 80 00 00 	movabs $0x802f22,%rax
+  803452:	00 00 00 
+  803455:	ff d0                	call   *%rax
+    if (res < 0) {
+  803457:	85 c0                	test   %eax,%eax
+  803459:	78 02                	js     80345d <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80345b:	5d                   	pop    %rbp
+  80345c:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80345d:	89 c1                	mov    %eax,%ecx
+  80345f:	48 ba 77 68 80 00 00 	movabs $0x806877,%rdx
+  803466:	00 00 00 
+  803469:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80346e:	48 bf 84 68 80 00 00 	movabs $0x806884,%rdi
+  803475:	00 00 00 
+  803478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347d:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  803484:	00 00 00 
+  803487:	41 ff d0             	call   *%r8
+
+000000000080348a <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80348a:	55                   	push   %rbp
+  80348b:	48 89 e5             	mov    %rsp,%rbp
+  80348e:	53                   	push   %rbx
+  80348f:	48 83 ec 08          	sub    $0x8,%rsp
+  803493:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803497:	48 85 d2             	test   %rdx,%rdx
+  80349a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034a1:	00 00 00 
+  8034a4:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8034a8:	4d 85 c9             	test   %r9,%r9
+  8034ab:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8034af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b4:	48 85 db             	test   %rbx,%rbx
+  8034b7:	74 03                	je     8034bc <ipc_call+0x32>
+  8034b9:	48 8b 03             	mov    (%rbx),%rax
+  8034bc:	89 f6                	mov    %esi,%esi
+  8034be:	48 83 ec 08          	sub    $0x8,%rsp
+  8034c2:	50                   	push   %rax
+  8034c3:	48 b8 54 2f 80 00 00 	movabs $0x802f54,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+  8034cf:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8034d1:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8034d5:	48 89 da             	mov    %rbx,%rdx
+  8034d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8034dd:	48 b8 5a 33 80 00 00 	movabs $0x80335a,%rax
+  8034e4:	00 00 00 
+  8034e7:	ff d0                	call   *%rax
+}
+  8034e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034ed:	c9                   	leave
+  8034ee:	c3                   	ret
+
+00000000008034ef <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8034f3:	89 f6                	mov    %esi,%esi
+  8034f5:	48 b8 c0 2f 80 00 00 	movabs $0x802fc0,%rax
+  8034fc:	00 00 00 
+  8034ff:	ff d0                	call   *%rax
+  803501:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  803503:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80350d:	be 00 00 00 00       	mov    $0x0,%esi
+  803512:	48 b8 5a 33 80 00 00 	movabs $0x80335a,%rax
+  803519:	00 00 00 
+  80351c:	ff d0                	call   *%rax
+}
+  80351e:	5d                   	pop    %rbp
+  80351f:	c3                   	ret
+
+0000000000803520 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	41 54                	push   %r12
+  803526:	53                   	push   %rbx
+  803527:	4c 89 cb             	mov    %r9,%rbx
+  80352a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80352e:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803532:	48 85 d2             	test   %rdx,%rdx
+  803535:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80353c:	00 00 00 
+  80353f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803543:	4d 85 c9             	test   %r9,%r9
+  803546:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80354a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354f:	4d 85 e4             	test   %r12,%r12
+  803552:	74 04                	je     803558 <ipc_reply_wait+0x38>
+  803554:	49 8b 04 24          	mov    (%r12),%rax
+  803558:	89 f6                	mov    %esi,%esi
+  80355a:	48 83 ec 08          	sub    $0x8,%rsp
+  80355e:	50                   	push   %rax
+  80355f:	48 b8 2a 30 80 00 00 	movabs $0x80302a,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+  80356b:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80356d:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  803571:	4c 89 e2             	mov    %r12,%rdx
+  803574:	48 89 de             	mov    %rbx,%rsi
+  803577:	48 b8 5a 33 80 00 00 	movabs $0x80335a,%rax
+  80357e:	00 00 00 
+  803581:	ff d0                	call   *%rax
+}
+  803583:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803587:	5b                   	pop    %rbx
+  803588:	41 5c                	pop    %r12
+  80358a:	5d                   	pop    %rbp
+  80358b:	c3                   	ret
+
+000000000080358c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80358c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803591:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803598:	00 00 00 
+  80359b:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8035a2:	48 01 ca             	add    %rcx,%rdx
+  8035a5:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8035ab:	39 fa                	cmp    %edi,%edx
+  8035ad:	74 12                	je     8035c1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8035af:	48 83 c0 01          	add    $0x1,%rax
+  8035b3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8035b9:	75 e0                	jne    80359b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8035bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035c0:	c3                   	ret
+            return envs[i].env_id;
+  8035c1:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8035c8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8035cf:	00 00 00 
+  8035d2:	48 01 d0             	add    %rdx,%rax
+  8035d5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8035db:	c3                   	ret
+
+00000000008035dc <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8035dc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8035e3:	ff ff ff 
+  8035e6:	48 01 f8             	add    %rdi,%rax
+  8035e9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8035ed:	c3                   	ret
+
+00000000008035ee <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8035ee:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8035f5:	ff ff ff 
+  8035f8:	48 01 f8             	add    %rdi,%rax
+  8035fb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8035ff:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803605:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803609:	c3                   	ret
+
+000000000080360a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80360a:	55                   	push   %rbp
+  80360b:	48 89 e5             	mov    %rsp,%rbp
+  80360e:	41 57                	push   %r15
+  803610:	41 56                	push   %r14
+  803612:	41 55                	push   %r13
+  803614:	41 54                	push   %r12
+  803616:	53                   	push   %rbx
+  803617:	48 83 ec 08          	sub    $0x8,%rsp
+  80361b:	49 89 ff             	mov    %rdi,%r15
+  80361e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803623:	49 bd c3 4b 80 00 00 	movabs $0x804bc3,%r13
+  80362a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80362d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803633:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803636:	48 89 df             	mov    %rbx,%rdi
+  803639:	41 ff d5             	call   *%r13
+  80363c:	83 e0 04             	and    $0x4,%eax
+  80363f:	74 17                	je     803658 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803641:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803648:	4c 39 f3             	cmp    %r14,%rbx
+  80364b:	75 e6                	jne    803633 <fd_alloc+0x29>
+  80364d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803653:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803658:	4d 89 27             	mov    %r12,(%r15)
+}
+  80365b:	48 83 c4 08          	add    $0x8,%rsp
+  80365f:	5b                   	pop    %rbx
+  803660:	41 5c                	pop    %r12
+  803662:	41 5d                	pop    %r13
+  803664:	41 5e                	pop    %r14
+  803666:	41 5f                	pop    %r15
+  803668:	5d                   	pop    %rbp
+  803669:	c3                   	ret
+
+000000000080366a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80366a:	83 ff 1f             	cmp    $0x1f,%edi
+  80366d:	77 39                	ja     8036a8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80366f:	55                   	push   %rbp
+  803670:	48 89 e5             	mov    %rsp,%rbp
+  803673:	41 54                	push   %r12
+  803675:	53                   	push   %rbx
+  803676:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803679:	48 63 df             	movslq %edi,%rbx
+  80367c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803683:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803687:	48 89 df             	mov    %rbx,%rdi
+  80368a:	48 b8 c3 4b 80 00 00 	movabs $0x804bc3,%rax
+  803691:	00 00 00 
+  803694:	ff d0                	call   *%rax
+  803696:	a8 04                	test   $0x4,%al
+  803698:	74 14                	je     8036ae <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80369a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036a3:	5b                   	pop    %rbx
+  8036a4:	41 5c                	pop    %r12
+  8036a6:	5d                   	pop    %rbp
+  8036a7:	c3                   	ret
+        return -E_INVAL;
+  8036a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8036ad:	c3                   	ret
+        return -E_INVAL;
+  8036ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036b3:	eb ee                	jmp    8036a3 <fd_lookup+0x39>
+
+00000000008036b5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8036b5:	55                   	push   %rbp
+  8036b6:	48 89 e5             	mov    %rsp,%rbp
+  8036b9:	41 54                	push   %r12
+  8036bb:	53                   	push   %rbx
+  8036bc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8036bf:	48 b8 20 69 80 00 00 	movabs $0x806920,%rax
+  8036c6:	00 00 00 
+  8036c9:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8036d0:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8036d3:	39 3b                	cmp    %edi,(%rbx)
+  8036d5:	74 47                	je     80371e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8036d7:	48 83 c0 08          	add    $0x8,%rax
+  8036db:	48 8b 18             	mov    (%rax),%rbx
+  8036de:	48 85 db             	test   %rbx,%rbx
+  8036e1:	75 f0                	jne    8036d3 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8036e3:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8036ea:	00 00 00 
+  8036ed:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8036f3:	89 fa                	mov    %edi,%edx
+  8036f5:	48 bf 90 68 80 00 00 	movabs $0x806890,%rdi
+  8036fc:	00 00 00 
+  8036ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803704:	48 b9 ae 1a 80 00 00 	movabs $0x801aae,%rcx
+  80370b:	00 00 00 
+  80370e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803710:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803715:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803719:	5b                   	pop    %rbx
+  80371a:	41 5c                	pop    %r12
+  80371c:	5d                   	pop    %rbp
+  80371d:	c3                   	ret
+            return 0;
+  80371e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803723:	eb f0                	jmp    803715 <dev_lookup+0x60>
+
+0000000000803725 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803725:	55                   	push   %rbp
+  803726:	48 89 e5             	mov    %rsp,%rbp
+  803729:	41 55                	push   %r13
+  80372b:	41 54                	push   %r12
+  80372d:	53                   	push   %rbx
+  80372e:	48 83 ec 18          	sub    $0x18,%rsp
+  803732:	48 89 fb             	mov    %rdi,%rbx
+  803735:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803738:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80373f:	ff ff ff 
+  803742:	48 01 df             	add    %rbx,%rdi
+  803745:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803749:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80374d:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  803754:	00 00 00 
+  803757:	ff d0                	call   *%rax
+  803759:	41 89 c5             	mov    %eax,%r13d
+  80375c:	85 c0                	test   %eax,%eax
+  80375e:	78 06                	js     803766 <fd_close+0x41>
+  803760:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803764:	74 1a                	je     803780 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803766:	45 84 e4             	test   %r12b,%r12b
+  803769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803772:	44 89 e8             	mov    %r13d,%eax
+  803775:	48 83 c4 18          	add    $0x18,%rsp
+  803779:	5b                   	pop    %rbx
+  80377a:	41 5c                	pop    %r12
+  80377c:	41 5d                	pop    %r13
+  80377e:	5d                   	pop    %rbp
+  80377f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803780:	8b 3b                	mov    (%rbx),%edi
+  803782:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803786:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+  803792:	41 89 c5             	mov    %eax,%r13d
+  803795:	85 c0                	test   %eax,%eax
+  803797:	78 1b                	js     8037b4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803799:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80379d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8037a1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8037a7:	48 85 c0             	test   %rax,%rax
+  8037aa:	74 08                	je     8037b4 <fd_close+0x8f>
+  8037ac:	48 89 df             	mov    %rbx,%rdi
+  8037af:	ff d0                	call   *%rax
+  8037b1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037b9:	48 89 de             	mov    %rbx,%rsi
+  8037bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037c1:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  8037c8:	00 00 00 
+  8037cb:	ff d0                	call   *%rax
+    return res;
+  8037cd:	eb a3                	jmp    803772 <fd_close+0x4d>
+
+00000000008037cf <close>:
+
+int
+close(int fdnum) {
+  8037cf:	55                   	push   %rbp
+  8037d0:	48 89 e5             	mov    %rsp,%rbp
+  8037d3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8037d7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037db:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  8037e2:	00 00 00 
+  8037e5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037e7:	85 c0                	test   %eax,%eax
+  8037e9:	78 15                	js     803800 <close+0x31>
+
+    return fd_close(fd, 1);
+  8037eb:	be 01 00 00 00       	mov    $0x1,%esi
+  8037f0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037f4:	48 b8 25 37 80 00 00 	movabs $0x803725,%rax
+  8037fb:	00 00 00 
+  8037fe:	ff d0                	call   *%rax
+}
+  803800:	c9                   	leave
+  803801:	c3                   	ret
+
+0000000000803802 <close_all>:
+
+void
+close_all(void) {
+  803802:	55                   	push   %rbp
+  803803:	48 89 e5             	mov    %rsp,%rbp
+  803806:	41 54                	push   %r12
+  803808:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803809:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80380e:	49 bc cf 37 80 00 00 	movabs $0x8037cf,%r12
+  803815:	00 00 00 
+  803818:	89 df                	mov    %ebx,%edi
+  80381a:	41 ff d4             	call   *%r12
+  80381d:	83 c3 01             	add    $0x1,%ebx
+  803820:	83 fb 20             	cmp    $0x20,%ebx
+  803823:	75 f3                	jne    803818 <close_all+0x16>
+}
+  803825:	5b                   	pop    %rbx
+  803826:	41 5c                	pop    %r12
+  803828:	5d                   	pop    %rbp
+  803829:	c3                   	ret
+
+000000000080382a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80382a:	55                   	push   %rbp
+  80382b:	48 89 e5             	mov    %rsp,%rbp
+  80382e:	41 57                	push   %r15
+  803830:	41 56                	push   %r14
+  803832:	41 55                	push   %r13
+  803834:	41 54                	push   %r12
+  803836:	53                   	push   %rbx
+  803837:	48 83 ec 18          	sub    $0x18,%rsp
+  80383b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80383e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803842:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  803849:	00 00 00 
+  80384c:	ff d0                	call   *%rax
+  80384e:	89 c3                	mov    %eax,%ebx
+  803850:	85 c0                	test   %eax,%eax
+  803852:	0f 88 b8 00 00 00    	js     803910 <dup+0xe6>
+    close(newfdnum);
+  803858:	44 89 e7             	mov    %r12d,%edi
+  80385b:	48 b8 cf 37 80 00 00 	movabs $0x8037cf,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803867:	4d 63 ec             	movslq %r12d,%r13
+  80386a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803871:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803875:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803879:	4c 89 ff             	mov    %r15,%rdi
+  80387c:	49 be ee 35 80 00 00 	movabs $0x8035ee,%r14
+  803883:	00 00 00 
+  803886:	41 ff d6             	call   *%r14
+  803889:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80388c:	4c 89 ef             	mov    %r13,%rdi
+  80388f:	41 ff d6             	call   *%r14
+  803892:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803895:	48 89 df             	mov    %rbx,%rdi
+  803898:	48 b8 c3 4b 80 00 00 	movabs $0x804bc3,%rax
+  80389f:	00 00 00 
+  8038a2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8038a4:	a8 04                	test   $0x4,%al
+  8038a6:	74 2b                	je     8038d3 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8038a8:	41 89 c1             	mov    %eax,%r9d
+  8038ab:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8038b1:	4c 89 f1             	mov    %r14,%rcx
+  8038b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038b9:	48 89 de             	mov    %rbx,%rsi
+  8038bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038c1:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  8038c8:	00 00 00 
+  8038cb:	ff d0                	call   *%rax
+  8038cd:	89 c3                	mov    %eax,%ebx
+  8038cf:	85 c0                	test   %eax,%eax
+  8038d1:	78 4e                	js     803921 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8038d3:	4c 89 ff             	mov    %r15,%rdi
+  8038d6:	48 b8 c3 4b 80 00 00 	movabs $0x804bc3,%rax
+  8038dd:	00 00 00 
+  8038e0:	ff d0                	call   *%rax
+  8038e2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8038e5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8038eb:	4c 89 e9             	mov    %r13,%rcx
+  8038ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038f3:	4c 89 fe             	mov    %r15,%rsi
+  8038f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038fb:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+  803907:	89 c3                	mov    %eax,%ebx
+  803909:	85 c0                	test   %eax,%eax
+  80390b:	78 14                	js     803921 <dup+0xf7>
+
+    return newfdnum;
+  80390d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803910:	89 d8                	mov    %ebx,%eax
+  803912:	48 83 c4 18          	add    $0x18,%rsp
+  803916:	5b                   	pop    %rbx
+  803917:	41 5c                	pop    %r12
+  803919:	41 5d                	pop    %r13
+  80391b:	41 5e                	pop    %r14
+  80391d:	41 5f                	pop    %r15
+  80391f:	5d                   	pop    %rbp
+  803920:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803921:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803926:	4c 89 ee             	mov    %r13,%rsi
+  803929:	bf 00 00 00 00       	mov    $0x0,%edi
+  80392e:	49 bc 22 2c 80 00 00 	movabs $0x802c22,%r12
+  803935:	00 00 00 
+  803938:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80393b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803940:	4c 89 f6             	mov    %r14,%rsi
+  803943:	bf 00 00 00 00       	mov    $0x0,%edi
+  803948:	41 ff d4             	call   *%r12
+    return res;
+  80394b:	eb c3                	jmp    803910 <dup+0xe6>
+
+000000000080394d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80394d:	55                   	push   %rbp
+  80394e:	48 89 e5             	mov    %rsp,%rbp
+  803951:	41 56                	push   %r14
+  803953:	41 55                	push   %r13
+  803955:	41 54                	push   %r12
+  803957:	53                   	push   %rbx
+  803958:	48 83 ec 10          	sub    $0x10,%rsp
+  80395c:	89 fb                	mov    %edi,%ebx
+  80395e:	49 89 f4             	mov    %rsi,%r12
+  803961:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803964:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803968:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  80396f:	00 00 00 
+  803972:	ff d0                	call   *%rax
+  803974:	85 c0                	test   %eax,%eax
+  803976:	78 4c                	js     8039c4 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803978:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80397c:	41 8b 3e             	mov    (%r14),%edi
+  80397f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803983:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  80398a:	00 00 00 
+  80398d:	ff d0                	call   *%rax
+  80398f:	85 c0                	test   %eax,%eax
+  803991:	78 35                	js     8039c8 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803993:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803997:	83 e0 03             	and    $0x3,%eax
+  80399a:	83 f8 01             	cmp    $0x1,%eax
+  80399d:	74 2d                	je     8039cc <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80399f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039a3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8039a7:	48 85 c0             	test   %rax,%rax
+  8039aa:	74 56                	je     803a02 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8039ac:	4c 89 ea             	mov    %r13,%rdx
+  8039af:	4c 89 e6             	mov    %r12,%rsi
+  8039b2:	4c 89 f7             	mov    %r14,%rdi
+  8039b5:	ff d0                	call   *%rax
+}
+  8039b7:	48 83 c4 10          	add    $0x10,%rsp
+  8039bb:	5b                   	pop    %rbx
+  8039bc:	41 5c                	pop    %r12
+  8039be:	41 5d                	pop    %r13
+  8039c0:	41 5e                	pop    %r14
+  8039c2:	5d                   	pop    %rbp
+  8039c3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039c4:	48 98                	cltq
+  8039c6:	eb ef                	jmp    8039b7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8039c8:	48 98                	cltq
+  8039ca:	eb eb                	jmp    8039b7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8039cc:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8039d3:	00 00 00 
+  8039d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8039dc:	89 da                	mov    %ebx,%edx
+  8039de:	48 bf d1 68 80 00 00 	movabs $0x8068d1,%rdi
+  8039e5:	00 00 00 
+  8039e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ed:	48 b9 ae 1a 80 00 00 	movabs $0x801aae,%rcx
+  8039f4:	00 00 00 
+  8039f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8039f9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a00:	eb b5                	jmp    8039b7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803a02:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803a09:	eb ac                	jmp    8039b7 <read+0x6a>
+
+0000000000803a0b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803a0b:	55                   	push   %rbp
+  803a0c:	48 89 e5             	mov    %rsp,%rbp
+  803a0f:	41 57                	push   %r15
+  803a11:	41 56                	push   %r14
+  803a13:	41 55                	push   %r13
+  803a15:	41 54                	push   %r12
+  803a17:	53                   	push   %rbx
+  803a18:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803a1c:	48 85 d2             	test   %rdx,%rdx
+  803a1f:	74 54                	je     803a75 <readn+0x6a>
+  803a21:	41 89 fd             	mov    %edi,%r13d
+  803a24:	49 89 f6             	mov    %rsi,%r14
+  803a27:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803a2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803a2f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803a34:	49 bf 4d 39 80 00 00 	movabs $0x80394d,%r15
+  803a3b:	00 00 00 
+  803a3e:	4c 89 e2             	mov    %r12,%rdx
+  803a41:	48 29 f2             	sub    %rsi,%rdx
+  803a44:	4c 01 f6             	add    %r14,%rsi
+  803a47:	44 89 ef             	mov    %r13d,%edi
+  803a4a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803a4d:	85 c0                	test   %eax,%eax
+  803a4f:	78 20                	js     803a71 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803a51:	01 c3                	add    %eax,%ebx
+  803a53:	85 c0                	test   %eax,%eax
+  803a55:	74 08                	je     803a5f <readn+0x54>
+  803a57:	48 63 f3             	movslq %ebx,%rsi
+  803a5a:	4c 39 e6             	cmp    %r12,%rsi
+  803a5d:	72 df                	jb     803a3e <readn+0x33>
+    }
+    return res;
+  803a5f:	48 63 c3             	movslq %ebx,%rax
+}
+  803a62:	48 83 c4 08          	add    $0x8,%rsp
+  803a66:	5b                   	pop    %rbx
+  803a67:	41 5c                	pop    %r12
+  803a69:	41 5d                	pop    %r13
+  803a6b:	41 5e                	pop    %r14
+  803a6d:	41 5f                	pop    %r15
+  803a6f:	5d                   	pop    %rbp
+  803a70:	c3                   	ret
+        if (inc < 0) return inc;
+  803a71:	48 98                	cltq
+  803a73:	eb ed                	jmp    803a62 <readn+0x57>
+    int inc = 1, res = 0;
+  803a75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a7a:	eb e3                	jmp    803a5f <readn+0x54>
+
+0000000000803a7c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803a7c:	55                   	push   %rbp
+  803a7d:	48 89 e5             	mov    %rsp,%rbp
+  803a80:	41 56                	push   %r14
+  803a82:	41 55                	push   %r13
+  803a84:	41 54                	push   %r12
+  803a86:	53                   	push   %rbx
+  803a87:	48 83 ec 10          	sub    $0x10,%rsp
+  803a8b:	89 fb                	mov    %edi,%ebx
+  803a8d:	49 89 f4             	mov    %rsi,%r12
+  803a90:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a93:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a97:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  803a9e:	00 00 00 
+  803aa1:	ff d0                	call   *%rax
+  803aa3:	85 c0                	test   %eax,%eax
+  803aa5:	78 47                	js     803aee <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803aa7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803aab:	41 8b 3e             	mov    (%r14),%edi
+  803aae:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803ab2:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  803ab9:	00 00 00 
+  803abc:	ff d0                	call   *%rax
+  803abe:	85 c0                	test   %eax,%eax
+  803ac0:	78 30                	js     803af2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ac2:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803ac7:	74 2d                	je     803af6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803ac9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803acd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803ad1:	48 85 c0             	test   %rax,%rax
+  803ad4:	74 56                	je     803b2c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803ad6:	4c 89 ea             	mov    %r13,%rdx
+  803ad9:	4c 89 e6             	mov    %r12,%rsi
+  803adc:	4c 89 f7             	mov    %r14,%rdi
+  803adf:	ff d0                	call   *%rax
+}
+  803ae1:	48 83 c4 10          	add    $0x10,%rsp
+  803ae5:	5b                   	pop    %rbx
+  803ae6:	41 5c                	pop    %r12
+  803ae8:	41 5d                	pop    %r13
+  803aea:	41 5e                	pop    %r14
+  803aec:	5d                   	pop    %rbp
+  803aed:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803aee:	48 98                	cltq
+  803af0:	eb ef                	jmp    803ae1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803af2:	48 98                	cltq
+  803af4:	eb eb                	jmp    803ae1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803af6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803afd:	00 00 00 
+  803b00:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803b06:	89 da                	mov    %ebx,%edx
+  803b08:	48 bf ed 68 80 00 00 	movabs $0x8068ed,%rdi
+  803b0f:	00 00 00 
+  803b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b17:	48 b9 ae 1a 80 00 00 	movabs $0x801aae,%rcx
+  803b1e:	00 00 00 
+  803b21:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803b23:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b2a:	eb b5                	jmp    803ae1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803b2c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803b33:	eb ac                	jmp    803ae1 <write+0x65>
+
+0000000000803b35 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803b35:	55                   	push   %rbp
+  803b36:	48 89 e5             	mov    %rsp,%rbp
+  803b39:	53                   	push   %rbx
+  803b3a:	48 83 ec 18          	sub    $0x18,%rsp
+  803b3e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b40:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b44:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  803b4b:	00 00 00 
+  803b4e:	ff d0                	call   *%rax
+  803b50:	85 c0                	test   %eax,%eax
+  803b52:	78 0c                	js     803b60 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803b54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b58:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b64:	c9                   	leave
+  803b65:	c3                   	ret
+
+0000000000803b66 <tell>:
+
+int tell(int fdnum) {
+  803b66:	55                   	push   %rbp
+  803b67:	48 89 e5             	mov    %rsp,%rbp
+  803b6a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b6e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b72:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  803b79:	00 00 00 
+  803b7c:	ff d0                	call   *%rax
+  803b7e:	85 c0                	test   %eax,%eax
+  803b80:	78 07                	js     803b89 <tell+0x23>
+
+    return fd->fd_offset;
+  803b82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b86:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803b89:	c9                   	leave
+  803b8a:	c3                   	ret
+
+0000000000803b8b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803b8b:	55                   	push   %rbp
+  803b8c:	48 89 e5             	mov    %rsp,%rbp
+  803b8f:	41 55                	push   %r13
+  803b91:	41 54                	push   %r12
+  803b93:	53                   	push   %rbx
+  803b94:	48 83 ec 18          	sub    $0x18,%rsp
+  803b98:	89 fb                	mov    %edi,%ebx
+  803b9a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b9d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ba1:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  803ba8:	00 00 00 
+  803bab:	ff d0                	call   *%rax
+  803bad:	85 c0                	test   %eax,%eax
+  803baf:	78 38                	js     803be9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803bb1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803bb5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803bb9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803bbd:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  803bc4:	00 00 00 
+  803bc7:	ff d0                	call   *%rax
+  803bc9:	85 c0                	test   %eax,%eax
+  803bcb:	78 1c                	js     803be9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803bcd:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803bd2:	74 20                	je     803bf4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803bd4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bd8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803bdc:	48 85 c0             	test   %rax,%rax
+  803bdf:	74 47                	je     803c28 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803be1:	44 89 e6             	mov    %r12d,%esi
+  803be4:	4c 89 ef             	mov    %r13,%rdi
+  803be7:	ff d0                	call   *%rax
+}
+  803be9:	48 83 c4 18          	add    $0x18,%rsp
+  803bed:	5b                   	pop    %rbx
+  803bee:	41 5c                	pop    %r12
+  803bf0:	41 5d                	pop    %r13
+  803bf2:	5d                   	pop    %rbp
+  803bf3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803bf4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803bfb:	00 00 00 
+  803bfe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c04:	89 da                	mov    %ebx,%edx
+  803c06:	48 bf b0 68 80 00 00 	movabs $0x8068b0,%rdi
+  803c0d:	00 00 00 
+  803c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c15:	48 b9 ae 1a 80 00 00 	movabs $0x801aae,%rcx
+  803c1c:	00 00 00 
+  803c1f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803c21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c26:	eb c1                	jmp    803be9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803c28:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c2d:	eb ba                	jmp    803be9 <ftruncate+0x5e>
+
+0000000000803c2f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803c2f:	55                   	push   %rbp
+  803c30:	48 89 e5             	mov    %rsp,%rbp
+  803c33:	41 54                	push   %r12
+  803c35:	53                   	push   %rbx
+  803c36:	48 83 ec 10          	sub    $0x10,%rsp
+  803c3a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803c3d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803c41:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  803c48:	00 00 00 
+  803c4b:	ff d0                	call   *%rax
+  803c4d:	85 c0                	test   %eax,%eax
+  803c4f:	78 63                	js     803cb4 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803c51:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803c55:	41 8b 3c 24          	mov    (%r12),%edi
+  803c59:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803c5d:	48 b8 b5 36 80 00 00 	movabs $0x8036b5,%rax
+  803c64:	00 00 00 
+  803c67:	ff d0                	call   *%rax
+  803c69:	85 c0                	test   %eax,%eax
+  803c6b:	78 47                	js     803cb4 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803c6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c71:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803c76:	74 45                	je     803cbd <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803c78:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803c7b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803c82:	00 00 00 
+    stat->st_isdir = 0;
+  803c85:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803c8c:	00 00 00 
+    stat->st_ino = 0;
+  803c8f:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803c96:	00 00 00 00 
+    stat->st_version = 0;
+  803c9a:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803ca1:	00 00 00 
+    stat->st_dev = dev;
+  803ca4:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803cab:	48 89 de             	mov    %rbx,%rsi
+  803cae:	4c 89 e7             	mov    %r12,%rdi
+  803cb1:	ff 50 28             	call   *0x28(%rax)
+}
+  803cb4:	48 83 c4 10          	add    $0x10,%rsp
+  803cb8:	5b                   	pop    %rbx
+  803cb9:	41 5c                	pop    %r12
+  803cbb:	5d                   	pop    %rbp
+  803cbc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803cbd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803cc2:	eb f0                	jmp    803cb4 <fstat+0x85>
+
+0000000000803cc4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803cc4:	55                   	push   %rbp
+  803cc5:	48 89 e5             	mov    %rsp,%rbp
+  803cc8:	41 54                	push   %r12
+  803cca:	53                   	push   %rbx
+  803ccb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803cce:	be 00 00 00 00       	mov    $0x0,%esi
+  803cd3:	48 b8 e5 41 80 00 00 	movabs $0x8041e5,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+  803cdf:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803ce1:	85 c0                	test   %eax,%eax
+  803ce3:	78 25                	js     803d0a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803ce5:	4c 89 e6             	mov    %r12,%rsi
+  803ce8:	89 c7                	mov    %eax,%edi
+  803cea:	48 b8 2f 3c 80 00 00 	movabs $0x803c2f,%rax
+  803cf1:	00 00 00 
+  803cf4:	ff d0                	call   *%rax
+  803cf6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803cf9:	89 df                	mov    %ebx,%edi
+  803cfb:	48 b8 cf 37 80 00 00 	movabs $0x8037cf,%rax
+  803d02:	00 00 00 
+  803d05:	ff d0                	call   *%rax
+
+    return res;
+  803d07:	44 89 e3             	mov    %r12d,%ebx
+}
+  803d0a:	89 d8                	mov    %ebx,%eax
+  803d0c:	5b                   	pop    %rbx
+  803d0d:	41 5c                	pop    %r12
+  803d0f:	5d                   	pop    %rbp
+  803d10:	c3                   	ret
+
+0000000000803d11 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803d11:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803d18:	00 00 00 
+  803d1b:	83 38 00             	cmpl   $0x0,(%rax)
+  803d1e:	74 0a                	je     803d2a <fsipc_env+0x19>
+    return fsenv;
+}
+  803d20:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803d27:	00 00 
+  803d29:	c3                   	ret
+fsipc_env(void) {
+  803d2a:	55                   	push   %rbp
+  803d2b:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803d2e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d33:	48 b8 8c 35 80 00 00 	movabs $0x80358c,%rax
+  803d3a:	00 00 00 
+  803d3d:	ff d0                	call   *%rax
+  803d3f:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803d46:	00 00 
+}
+  803d48:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803d4f:	00 00 
+  803d51:	5d                   	pop    %rbp
+  803d52:	c3                   	ret
+
+0000000000803d53 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803d53:	55                   	push   %rbp
+  803d54:	48 89 e5             	mov    %rsp,%rbp
+  803d57:	53                   	push   %rbx
+  803d58:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803d5c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803d63:	00 
+  803d64:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803d6b:	00 
+  803d6c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803d73:	00 
+  803d74:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803d7b:	00 
+  803d7c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803d83:	00 
+
+    assert(size <= sizeof(words));
+  803d84:	48 83 fa 28          	cmp    $0x28,%rdx
+  803d88:	77 38                	ja     803dc2 <fsipc_short+0x6f>
+  803d8a:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803d8c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803d90:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  803d97:	00 00 00 
+  803d9a:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803d9c:	48 b8 11 3d 80 00 00 	movabs $0x803d11,%rax
+  803da3:	00 00 00 
+  803da6:	ff d0                	call   *%rax
+  803da8:	89 c7                	mov    %eax,%edi
+  803daa:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803dae:	89 de                	mov    %ebx,%esi
+  803db0:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  803db7:	00 00 00 
+  803dba:	ff d0                	call   *%rax
+}
+  803dbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dc0:	c9                   	leave
+  803dc1:	c3                   	ret
+    assert(size <= sizeof(words));
+  803dc2:	48 b9 40 69 80 00 00 	movabs $0x806940,%rcx
+  803dc9:	00 00 00 
+  803dcc:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  803dd3:	00 00 00 
+  803dd6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803ddb:	48 bf 6b 69 80 00 00 	movabs $0x80696b,%rdi
+  803de2:	00 00 00 
+  803de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dea:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  803df1:	00 00 00 
+  803df4:	41 ff d0             	call   *%r8
+
+0000000000803df7 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803df7:	55                   	push   %rbp
+  803df8:	48 89 e5             	mov    %rsp,%rbp
+  803dfb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803dff:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803e02:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803e05:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803e08:	ba 08 00 00 00       	mov    $0x8,%edx
+  803e0d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e11:	bf 02 00 00 00       	mov    $0x2,%edi
+  803e16:	48 b8 53 3d 80 00 00 	movabs $0x803d53,%rax
+  803e1d:	00 00 00 
+  803e20:	ff d0                	call   *%rax
+}
+  803e22:	c9                   	leave
+  803e23:	c3                   	ret
+
+0000000000803e24 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803e24:	55                   	push   %rbp
+  803e25:	48 89 e5             	mov    %rsp,%rbp
+  803e28:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803e2c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803e2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803e32:	ba 04 00 00 00       	mov    $0x4,%edx
+  803e37:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803e3b:	bf 06 00 00 00       	mov    $0x6,%edi
+  803e40:	48 b8 53 3d 80 00 00 	movabs $0x803d53,%rax
+  803e47:	00 00 00 
+  803e4a:	ff d0                	call   *%rax
+}
+  803e4c:	c9                   	leave
+  803e4d:	c3                   	ret
+
+0000000000803e4e <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803e4e:	55                   	push   %rbp
+  803e4f:	48 89 e5             	mov    %rsp,%rbp
+  803e52:	41 54                	push   %r12
+  803e54:	53                   	push   %rbx
+  803e55:	48 83 ec 10          	sub    $0x10,%rsp
+  803e59:	89 fb                	mov    %edi,%ebx
+  803e5b:	49 89 f4             	mov    %rsi,%r12
+  803e5e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803e62:	48 b8 11 3d 80 00 00 	movabs $0x803d11,%rax
+  803e69:	00 00 00 
+  803e6c:	ff d0                	call   *%rax
+  803e6e:	89 c7                	mov    %eax,%edi
+  803e70:	6a 00                	push   $0x0
+  803e72:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803e76:	50                   	push   %rax
+  803e77:	4d 89 e1             	mov    %r12,%r9
+  803e7a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803e80:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e85:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803e8c:	00 00 00 
+  803e8f:	89 de                	mov    %ebx,%esi
+  803e91:	48 b8 8a 34 80 00 00 	movabs $0x80348a,%rax
+  803e98:	00 00 00 
+  803e9b:	ff d0                	call   *%rax
+}
+  803e9d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803ea1:	5b                   	pop    %rbx
+  803ea2:	41 5c                	pop    %r12
+  803ea4:	5d                   	pop    %rbp
+  803ea5:	c3                   	ret
+
+0000000000803ea6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803ea6:	55                   	push   %rbp
+  803ea7:	48 89 e5             	mov    %rsp,%rbp
+  803eaa:	41 54                	push   %r12
+  803eac:	53                   	push   %rbx
+  803ead:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803eb0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803eb3:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803eba:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803ebc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ec1:	be 00 00 00 00       	mov    $0x0,%esi
+  803ec6:	bf 05 00 00 00       	mov    $0x5,%edi
+  803ecb:	48 b8 4e 3e 80 00 00 	movabs $0x803e4e,%rax
+  803ed2:	00 00 00 
+  803ed5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ed7:	85 c0                	test   %eax,%eax
+  803ed9:	78 5a                	js     803f35 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803edb:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803ee2:	00 00 00 
+  803ee5:	4c 89 e6             	mov    %r12,%rsi
+  803ee8:	48 89 df             	mov    %rbx,%rdi
+  803eeb:	48 b8 e5 23 80 00 00 	movabs $0x8023e5,%rax
+  803ef2:	00 00 00 
+  803ef5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803ef7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803efe:	00 
+  803eff:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803f05:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803f0c:	00 
+  803f0d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803f13:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803f1a:	00 
+  803f1b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803f22:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803f29:	00 
+  803f2a:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803f30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f35:	5b                   	pop    %rbx
+  803f36:	41 5c                	pop    %r12
+  803f38:	5d                   	pop    %rbp
+  803f39:	c3                   	ret
+
+0000000000803f3a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803f3a:	55                   	push   %rbp
+  803f3b:	48 89 e5             	mov    %rsp,%rbp
+  803f3e:	41 57                	push   %r15
+  803f40:	41 56                	push   %r14
+  803f42:	41 55                	push   %r13
+  803f44:	41 54                	push   %r12
+  803f46:	53                   	push   %rbx
+  803f47:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803f4b:	48 85 ff             	test   %rdi,%rdi
+  803f4e:	0f 84 a1 00 00 00    	je     803ff5 <devfile_read+0xbb>
+  803f54:	49 89 ff             	mov    %rdi,%r15
+  803f57:	49 89 f5             	mov    %rsi,%r13
+  803f5a:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803f5d:	48 85 f6             	test   %rsi,%rsi
+  803f60:	0f 84 c4 00 00 00    	je     80402a <devfile_read+0xf0>
+    size_t total_read = 0;
+  803f66:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803f6d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803f6e:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803f75:	00 00 00 
+  803f78:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f7c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803f7f:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f88:	be 00 00 00 00       	mov    $0x0,%esi
+  803f8d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803f92:	48 b8 4e 3e 80 00 00 	movabs $0x803e4e,%rax
+  803f99:	00 00 00 
+  803f9c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803f9e:	85 c0                	test   %eax,%eax
+  803fa0:	0f 88 b9 00 00 00    	js     80405f <devfile_read+0x125>
+        assert(res <= n);
+  803fa6:	48 63 d8             	movslq %eax,%rbx
+  803fa9:	49 39 dc             	cmp    %rbx,%r12
+  803fac:	0f 82 b1 00 00 00    	jb     804063 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803fb2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803fb7:	0f 87 db 00 00 00    	ja     804098 <devfile_read+0x15e>
+        if (!res) {
+  803fbd:	85 c0                	test   %eax,%eax
+  803fbf:	74 21                	je     803fe2 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803fc1:	48 89 da             	mov    %rbx,%rdx
+  803fc4:	4c 89 f6             	mov    %r14,%rsi
+  803fc7:	4c 89 ef             	mov    %r13,%rdi
+  803fca:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  803fd1:	00 00 00 
+  803fd4:	ff d0                	call   *%rax
+        total_read += res;
+  803fd6:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803fda:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803fdd:	49 29 dc             	sub    %rbx,%r12
+  803fe0:	75 96                	jne    803f78 <devfile_read+0x3e>
+    return total_read;
+  803fe2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803fe6:	48 83 c4 18          	add    $0x18,%rsp
+  803fea:	5b                   	pop    %rbx
+  803feb:	41 5c                	pop    %r12
+  803fed:	41 5d                	pop    %r13
+  803fef:	41 5e                	pop    %r14
+  803ff1:	41 5f                	pop    %r15
+  803ff3:	5d                   	pop    %rbp
+  803ff4:	c3                   	ret
+    assert(fd);
+  803ff5:	48 b9 76 69 80 00 00 	movabs $0x806976,%rcx
+  803ffc:	00 00 00 
+  803fff:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  804006:	00 00 00 
+  804009:	be 91 00 00 00       	mov    $0x91,%esi
+  80400e:	48 bf 6b 69 80 00 00 	movabs $0x80696b,%rdi
+  804015:	00 00 00 
+  804018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80401d:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  804024:	00 00 00 
+  804027:	41 ff d0             	call   *%r8
+    assert(buf);
+  80402a:	48 b9 79 69 80 00 00 	movabs $0x806979,%rcx
+  804031:	00 00 00 
+  804034:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  80403b:	00 00 00 
+  80403e:	be 92 00 00 00       	mov    $0x92,%esi
+  804043:	48 bf 6b 69 80 00 00 	movabs $0x80696b,%rdi
+  80404a:	00 00 00 
+  80404d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804052:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  804059:	00 00 00 
+  80405c:	41 ff d0             	call   *%r8
+            return res;
+  80405f:	48 98                	cltq
+  804061:	eb 83                	jmp    803fe6 <devfile_read+0xac>
+        assert(res <= n);
+  804063:	48 b9 7d 69 80 00 00 	movabs $0x80697d,%rcx
+  80406a:	00 00 00 
+  80406d:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  804074:	00 00 00 
+  804077:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80407c:	48 bf 6b 69 80 00 00 	movabs $0x80696b,%rdi
+  804083:	00 00 00 
+  804086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408b:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  804092:	00 00 00 
+  804095:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  804098:	48 b9 88 69 80 00 00 	movabs $0x806988,%rcx
+  80409f:	00 00 00 
+  8040a2:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  8040a9:	00 00 00 
+  8040ac:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8040b1:	48 bf 6b 69 80 00 00 	movabs $0x80696b,%rdi
+  8040b8:	00 00 00 
+  8040bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c0:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  8040c7:	00 00 00 
+  8040ca:	41 ff d0             	call   *%r8
+
+00000000008040cd <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8040cd:	55                   	push   %rbp
+  8040ce:	48 89 e5             	mov    %rsp,%rbp
+  8040d1:	41 57                	push   %r15
+  8040d3:	41 56                	push   %r14
+  8040d5:	41 55                	push   %r13
+  8040d7:	41 54                	push   %r12
+  8040d9:	53                   	push   %rbx
+  8040da:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8040de:	48 85 ff             	test   %rdi,%rdi
+  8040e1:	0f 84 83 00 00 00    	je     80416a <devfile_write+0x9d>
+  8040e7:	49 89 ff             	mov    %rdi,%r15
+  8040ea:	49 89 f4             	mov    %rsi,%r12
+  8040ed:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8040f0:	48 85 f6             	test   %rsi,%rsi
+  8040f3:	0f 84 a6 00 00 00    	je     80419f <devfile_write+0xd2>
+    size_t total_written = 0;
+  8040f9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8040ff:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  804106:	00 00 00 
+  804109:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80410d:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  804110:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  804114:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  804119:	48 39 d3             	cmp    %rdx,%rbx
+  80411c:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  804120:	4c 89 e6             	mov    %r12,%rsi
+  804123:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  80412a:	00 00 00 
+  80412d:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  804134:	00 00 00 
+  804137:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804139:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80413e:	be 00 00 00 00       	mov    $0x0,%esi
+  804143:	bf 04 00 00 00       	mov    $0x4,%edi
+  804148:	48 b8 4e 3e 80 00 00 	movabs $0x803e4e,%rax
+  80414f:	00 00 00 
+  804152:	ff d0                	call   *%rax
+        if (res < 0) {
+  804154:	85 c0                	test   %eax,%eax
+  804156:	78 7c                	js     8041d4 <devfile_write+0x107>
+        total_written += res;
+  804158:	48 98                	cltq
+  80415a:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  80415d:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  804160:	48 29 c3             	sub    %rax,%rbx
+  804163:	75 a4                	jne    804109 <devfile_write+0x3c>
+    return total_written;
+  804165:	4c 89 e8             	mov    %r13,%rax
+  804168:	eb 6c                	jmp    8041d6 <devfile_write+0x109>
+    assert(fd);
+  80416a:	48 b9 76 69 80 00 00 	movabs $0x806976,%rcx
+  804171:	00 00 00 
+  804174:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  80417b:	00 00 00 
+  80417e:	be bd 00 00 00       	mov    $0xbd,%esi
+  804183:	48 bf 6b 69 80 00 00 	movabs $0x80696b,%rdi
+  80418a:	00 00 00 
+  80418d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804192:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  804199:	00 00 00 
+  80419c:	41 ff d0             	call   *%r8
+    assert(buf);
+  80419f:	48 b9 79 69 80 00 00 	movabs $0x806979,%rcx
+  8041a6:	00 00 00 
+  8041a9:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  8041b0:	00 00 00 
+  8041b3:	be be 00 00 00       	mov    $0xbe,%esi
+  8041b8:	48 bf 6b 69 80 00 00 	movabs $0x80696b,%rdi
+  8041bf:	00 00 00 
+  8041c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c7:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  8041ce:	00 00 00 
+  8041d1:	41 ff d0             	call   *%r8
+            return res;
+  8041d4:	48 98                	cltq
+}
+  8041d6:	48 83 c4 08          	add    $0x8,%rsp
+  8041da:	5b                   	pop    %rbx
+  8041db:	41 5c                	pop    %r12
+  8041dd:	41 5d                	pop    %r13
+  8041df:	41 5e                	pop    %r14
+  8041e1:	41 5f                	pop    %r15
+  8041e3:	5d                   	pop    %rbp
+  8041e4:	c3                   	ret
+
+00000000008041e5 <open>:
+open(const char *path, int mode) {
+  8041e5:	55                   	push   %rbp
+  8041e6:	48 89 e5             	mov    %rsp,%rbp
+  8041e9:	41 55                	push   %r13
+  8041eb:	41 54                	push   %r12
+  8041ed:	53                   	push   %rbx
+  8041ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8041f2:	49 89 fc             	mov    %rdi,%r12
+  8041f5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8041f8:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  8041ff:	00 00 00 
+  804202:	ff d0                	call   *%rax
+  804204:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80420a:	0f 87 8f 00 00 00    	ja     80429f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804210:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804214:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  80421b:	00 00 00 
+  80421e:	ff d0                	call   *%rax
+  804220:	89 c3                	mov    %eax,%ebx
+  804222:	85 c0                	test   %eax,%eax
+  804224:	78 55                	js     80427b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  804226:	4c 89 e6             	mov    %r12,%rsi
+  804229:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  804230:	00 00 00 
+  804233:	48 89 df             	mov    %rbx,%rdi
+  804236:	48 b8 e5 23 80 00 00 	movabs $0x8023e5,%rax
+  80423d:	00 00 00 
+  804240:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804242:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804249:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80424e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804252:	bf 01 00 00 00       	mov    $0x1,%edi
+  804257:	48 b8 4e 3e 80 00 00 	movabs $0x803e4e,%rax
+  80425e:	00 00 00 
+  804261:	ff d0                	call   *%rax
+  804263:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804265:	85 c0                	test   %eax,%eax
+  804267:	78 1f                	js     804288 <open+0xa3>
+    return fd2num(fd);
+  804269:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80426d:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  804274:	00 00 00 
+  804277:	ff d0                	call   *%rax
+  804279:	89 c3                	mov    %eax,%ebx
+}
+  80427b:	89 d8                	mov    %ebx,%eax
+  80427d:	48 83 c4 18          	add    $0x18,%rsp
+  804281:	5b                   	pop    %rbx
+  804282:	41 5c                	pop    %r12
+  804284:	41 5d                	pop    %r13
+  804286:	5d                   	pop    %rbp
+  804287:	c3                   	ret
+        fd_close(fd, 0);
+  804288:	be 00 00 00 00       	mov    $0x0,%esi
+  80428d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804291:	48 b8 25 37 80 00 00 	movabs $0x803725,%rax
+  804298:	00 00 00 
+  80429b:	ff d0                	call   *%rax
+        return res;
+  80429d:	eb dc                	jmp    80427b <open+0x96>
+        return -E_BAD_PATH;
+  80429f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8042a4:	eb d5                	jmp    80427b <open+0x96>
+
+00000000008042a6 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8042a6:	55                   	push   %rbp
+  8042a7:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  8042aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042af:	be 00 00 00 00       	mov    $0x0,%esi
+  8042b4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8042b9:	48 b8 53 3d 80 00 00 	movabs $0x803d53,%rax
+  8042c0:	00 00 00 
+  8042c3:	ff d0                	call   *%rax
+}
+  8042c5:	5d                   	pop    %rbp
+  8042c6:	c3                   	ret
+
+00000000008042c7 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  8042c7:	55                   	push   %rbp
+  8042c8:	48 89 e5             	mov    %rsp,%rbp
+  8042cb:	41 56                	push   %r14
+  8042cd:	41 55                	push   %r13
+  8042cf:	41 54                	push   %r12
+  8042d1:	53                   	push   %rbx
+  8042d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8042d6:	41 89 f6             	mov    %esi,%r14d
+  8042d9:	49 89 d4             	mov    %rdx,%r12
+  8042dc:	48 89 cb             	mov    %rcx,%rbx
+  8042df:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8042e2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8042e6:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  8042ed:	00 00 00 
+  8042f0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042f2:	85 c0                	test   %eax,%eax
+  8042f4:	78 46                	js     80433c <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8042f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042fa:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  804301:	00 00 00 
+  804304:	8b 00                	mov    (%rax),%eax
+  804306:	39 02                	cmp    %eax,(%rdx)
+  804308:	75 3f                	jne    804349 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80430a:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  804311:	00 00 00 
+  804314:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804317:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804319:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80431d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804321:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804325:	48 89 da             	mov    %rbx,%rdx
+  804328:	4c 89 e6             	mov    %r12,%rsi
+  80432b:	bf 09 00 00 00       	mov    $0x9,%edi
+  804330:	48 b8 4e 3e 80 00 00 	movabs $0x803e4e,%rax
+  804337:	00 00 00 
+  80433a:	ff d0                	call   *%rax
+}
+  80433c:	48 83 c4 10          	add    $0x10,%rsp
+  804340:	5b                   	pop    %rbx
+  804341:	41 5c                	pop    %r12
+  804343:	41 5d                	pop    %r13
+  804345:	41 5e                	pop    %r14
+  804347:	5d                   	pop    %rbp
+  804348:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804349:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80434e:	eb ec                	jmp    80433c <file_map+0x75>
+
+0000000000804350 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804350:	55                   	push   %rbp
+  804351:	48 89 e5             	mov    %rsp,%rbp
+  804354:	41 54                	push   %r12
+  804356:	53                   	push   %rbx
+  804357:	48 83 ec 20          	sub    $0x20,%rsp
+  80435b:	41 89 f4             	mov    %esi,%r12d
+  80435e:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804361:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804365:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  80436c:	00 00 00 
+  80436f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804371:	85 c0                	test   %eax,%eax
+  804373:	78 3c                	js     8043b1 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804375:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804379:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  804380:	00 00 00 
+  804383:	8b 0a                	mov    (%rdx),%ecx
+  804385:	39 08                	cmp    %ecx,(%rax)
+  804387:	75 31                	jne    8043ba <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804389:	8b 40 0c             	mov    0xc(%rax),%eax
+  80438c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80438f:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804393:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804397:	ba 10 00 00 00       	mov    $0x10,%edx
+  80439c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8043a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8043a5:	48 b8 53 3d 80 00 00 	movabs $0x803d53,%rax
+  8043ac:	00 00 00 
+  8043af:	ff d0                	call   *%rax
+}
+  8043b1:	48 83 c4 20          	add    $0x20,%rsp
+  8043b5:	5b                   	pop    %rbx
+  8043b6:	41 5c                	pop    %r12
+  8043b8:	5d                   	pop    %rbp
+  8043b9:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8043ba:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8043bf:	eb f0                	jmp    8043b1 <file_msync+0x61>
+
+00000000008043c1 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8043c1:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8043c5:	7f 01                	jg     8043c8 <writebuf+0x7>
+  8043c7:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8043c8:	55                   	push   %rbp
+  8043c9:	48 89 e5             	mov    %rsp,%rbp
+  8043cc:	53                   	push   %rbx
+  8043cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8043d1:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8043d4:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8043d8:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8043dc:	8b 3f                	mov    (%rdi),%edi
+  8043de:	48 b8 7c 3a 80 00 00 	movabs $0x803a7c,%rax
+  8043e5:	00 00 00 
+  8043e8:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8043ea:	48 85 c0             	test   %rax,%rax
+  8043ed:	7e 04                	jle    8043f3 <writebuf+0x32>
+  8043ef:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8043f3:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8043f7:	48 39 c2             	cmp    %rax,%rdx
+  8043fa:	74 0f                	je     80440b <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8043fc:	48 85 c0             	test   %rax,%rax
+  8043ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  804404:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804408:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80440b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80440f:	c9                   	leave
+  804410:	c3                   	ret
+
+0000000000804411 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804411:	8b 46 04             	mov    0x4(%rsi),%eax
+  804414:	8d 50 01             	lea    0x1(%rax),%edx
+  804417:	89 56 04             	mov    %edx,0x4(%rsi)
+  80441a:	48 98                	cltq
+  80441c:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804421:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804427:	74 01                	je     80442a <putch+0x19>
+  804429:	c3                   	ret
+putch(int ch, void *arg) {
+  80442a:	55                   	push   %rbp
+  80442b:	48 89 e5             	mov    %rsp,%rbp
+  80442e:	53                   	push   %rbx
+  80442f:	48 83 ec 08          	sub    $0x8,%rsp
+  804433:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804436:	48 89 f7             	mov    %rsi,%rdi
+  804439:	48 b8 c1 43 80 00 00 	movabs $0x8043c1,%rax
+  804440:	00 00 00 
+  804443:	ff d0                	call   *%rax
+        state->offset = 0;
+  804445:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80444c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804450:	c9                   	leave
+  804451:	c3                   	ret
+
+0000000000804452 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804452:	55                   	push   %rbp
+  804453:	48 89 e5             	mov    %rsp,%rbp
+  804456:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80445d:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804460:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804466:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80446d:	00 00 00 
+    state.result = 0;
+  804470:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804477:	00 00 00 00 
+    state.error = 1;
+  80447b:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804482:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804485:	48 89 f2             	mov    %rsi,%rdx
+  804488:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80448f:	48 bf 11 44 80 00 00 	movabs $0x804411,%rdi
+  804496:	00 00 00 
+  804499:	48 b8 fe 1b 80 00 00 	movabs $0x801bfe,%rax
+  8044a0:	00 00 00 
+  8044a3:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8044a5:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8044ac:	7f 14                	jg     8044c2 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8044ae:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8044b5:	48 85 c0             	test   %rax,%rax
+  8044b8:	75 06                	jne    8044c0 <vfprintf+0x6e>
+  8044ba:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8044c0:	c9                   	leave
+  8044c1:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8044c2:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8044c9:	48 b8 c1 43 80 00 00 	movabs $0x8043c1,%rax
+  8044d0:	00 00 00 
+  8044d3:	ff d0                	call   *%rax
+  8044d5:	eb d7                	jmp    8044ae <vfprintf+0x5c>
+
+00000000008044d7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8044d7:	55                   	push   %rbp
+  8044d8:	48 89 e5             	mov    %rsp,%rbp
+  8044db:	48 83 ec 50          	sub    $0x50,%rsp
+  8044df:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8044e3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8044e7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8044eb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8044ef:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8044f6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044fe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804502:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804506:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80450a:	48 b8 52 44 80 00 00 	movabs $0x804452,%rax
+  804511:	00 00 00 
+  804514:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804516:	c9                   	leave
+  804517:	c3                   	ret
+
+0000000000804518 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804518:	55                   	push   %rbp
+  804519:	48 89 e5             	mov    %rsp,%rbp
+  80451c:	48 83 ec 50          	sub    $0x50,%rsp
+  804520:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804524:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804528:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80452c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804530:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804534:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80453b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80453f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804543:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804547:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80454b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80454f:	48 89 fe             	mov    %rdi,%rsi
+  804552:	bf 01 00 00 00       	mov    $0x1,%edi
+  804557:	48 b8 52 44 80 00 00 	movabs $0x804452,%rax
+  80455e:	00 00 00 
+  804561:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804563:	c9                   	leave
+  804564:	c3                   	ret
+
+0000000000804565 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804565:	55                   	push   %rbp
+  804566:	48 89 e5             	mov    %rsp,%rbp
+  804569:	41 54                	push   %r12
+  80456b:	53                   	push   %rbx
+  80456c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80456f:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  804576:	00 00 00 
+  804579:	ff d0                	call   *%rax
+  80457b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80457e:	48 be b0 69 80 00 00 	movabs $0x8069b0,%rsi
+  804585:	00 00 00 
+  804588:	48 89 df             	mov    %rbx,%rdi
+  80458b:	48 b8 e5 23 80 00 00 	movabs $0x8023e5,%rax
+  804592:	00 00 00 
+  804595:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804597:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80459c:	41 2b 04 24          	sub    (%r12),%eax
+  8045a0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8045a6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8045ad:	00 00 00 
+    stat->st_dev = &devpipe;
+  8045b0:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8045b7:	00 00 00 
+  8045ba:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8045c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c6:	5b                   	pop    %rbx
+  8045c7:	41 5c                	pop    %r12
+  8045c9:	5d                   	pop    %rbp
+  8045ca:	c3                   	ret
+
+00000000008045cb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8045cb:	55                   	push   %rbp
+  8045cc:	48 89 e5             	mov    %rsp,%rbp
+  8045cf:	41 54                	push   %r12
+  8045d1:	53                   	push   %rbx
+  8045d2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8045d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045da:	48 89 fe             	mov    %rdi,%rsi
+  8045dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045e2:	49 bc 22 2c 80 00 00 	movabs $0x802c22,%r12
+  8045e9:	00 00 00 
+  8045ec:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8045ef:	48 89 df             	mov    %rbx,%rdi
+  8045f2:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  8045f9:	00 00 00 
+  8045fc:	ff d0                	call   *%rax
+  8045fe:	48 89 c6             	mov    %rax,%rsi
+  804601:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80460b:	41 ff d4             	call   *%r12
+}
+  80460e:	5b                   	pop    %rbx
+  80460f:	41 5c                	pop    %r12
+  804611:	5d                   	pop    %rbp
+  804612:	c3                   	ret
+
+0000000000804613 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804613:	55                   	push   %rbp
+  804614:	48 89 e5             	mov    %rsp,%rbp
+  804617:	41 57                	push   %r15
+  804619:	41 56                	push   %r14
+  80461b:	41 55                	push   %r13
+  80461d:	41 54                	push   %r12
+  80461f:	53                   	push   %rbx
+  804620:	48 83 ec 18          	sub    $0x18,%rsp
+  804624:	49 89 fc             	mov    %rdi,%r12
+  804627:	49 89 f5             	mov    %rsi,%r13
+  80462a:	49 89 d7             	mov    %rdx,%r15
+  80462d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804631:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  804638:	00 00 00 
+  80463b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80463d:	4d 85 ff             	test   %r15,%r15
+  804640:	0f 84 af 00 00 00    	je     8046f5 <devpipe_write+0xe2>
+  804646:	48 89 c3             	mov    %rax,%rbx
+  804649:	4c 89 f8             	mov    %r15,%rax
+  80464c:	4d 89 ef             	mov    %r13,%r15
+  80464f:	4c 01 e8             	add    %r13,%rax
+  804652:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804656:	49 bd 18 2b 80 00 00 	movabs $0x802b18,%r13
+  80465d:	00 00 00 
+            sys_yield();
+  804660:	49 be a9 2a 80 00 00 	movabs $0x802aa9,%r14
+  804667:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80466a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80466d:	48 63 ce             	movslq %esi,%rcx
+  804670:	48 63 03             	movslq (%rbx),%rax
+  804673:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804679:	48 39 c1             	cmp    %rax,%rcx
+  80467c:	72 2e                	jb     8046ac <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80467e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804683:	48 89 da             	mov    %rbx,%rdx
+  804686:	be 00 10 00 00       	mov    $0x1000,%esi
+  80468b:	4c 89 e7             	mov    %r12,%rdi
+  80468e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804691:	85 c0                	test   %eax,%eax
+  804693:	74 66                	je     8046fb <devpipe_write+0xe8>
+            sys_yield();
+  804695:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804698:	8b 73 04             	mov    0x4(%rbx),%esi
+  80469b:	48 63 ce             	movslq %esi,%rcx
+  80469e:	48 63 03             	movslq (%rbx),%rax
+  8046a1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8046a7:	48 39 c1             	cmp    %rax,%rcx
+  8046aa:	73 d2                	jae    80467e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8046ac:	41 0f b6 3f          	movzbl (%r15),%edi
+  8046b0:	48 89 ca             	mov    %rcx,%rdx
+  8046b3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8046b7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8046be:	08 10 20 
+  8046c1:	48 f7 e2             	mul    %rdx
+  8046c4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8046c8:	48 89 d0             	mov    %rdx,%rax
+  8046cb:	48 c1 e0 09          	shl    $0x9,%rax
+  8046cf:	48 29 d0             	sub    %rdx,%rax
+  8046d2:	48 c1 e0 03          	shl    $0x3,%rax
+  8046d6:	48 29 c1             	sub    %rax,%rcx
+  8046d9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8046de:	83 c6 01             	add    $0x1,%esi
+  8046e1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8046e4:	49 83 c7 01          	add    $0x1,%r15
+  8046e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ec:	49 39 c7             	cmp    %rax,%r15
+  8046ef:	0f 85 75 ff ff ff    	jne    80466a <devpipe_write+0x57>
+    return n;
+  8046f5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046f9:	eb 05                	jmp    804700 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8046fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804700:	48 83 c4 18          	add    $0x18,%rsp
+  804704:	5b                   	pop    %rbx
+  804705:	41 5c                	pop    %r12
+  804707:	41 5d                	pop    %r13
+  804709:	41 5e                	pop    %r14
+  80470b:	41 5f                	pop    %r15
+  80470d:	5d                   	pop    %rbp
+  80470e:	c3                   	ret
+
+000000000080470f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80470f:	55                   	push   %rbp
+  804710:	48 89 e5             	mov    %rsp,%rbp
+  804713:	41 57                	push   %r15
+  804715:	41 56                	push   %r14
+  804717:	41 55                	push   %r13
+  804719:	41 54                	push   %r12
+  80471b:	53                   	push   %rbx
+  80471c:	48 83 ec 18          	sub    $0x18,%rsp
+  804720:	49 89 fc             	mov    %rdi,%r12
+  804723:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804727:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80472b:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  804732:	00 00 00 
+  804735:	ff d0                	call   *%rax
+  804737:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80473a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804740:	49 bd 18 2b 80 00 00 	movabs $0x802b18,%r13
+  804747:	00 00 00 
+            sys_yield();
+  80474a:	49 be a9 2a 80 00 00 	movabs $0x802aa9,%r14
+  804751:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804754:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804759:	74 7d                	je     8047d8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80475b:	8b 03                	mov    (%rbx),%eax
+  80475d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804760:	75 26                	jne    804788 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804762:	4d 85 ff             	test   %r15,%r15
+  804765:	75 77                	jne    8047de <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804767:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80476c:	48 89 da             	mov    %rbx,%rdx
+  80476f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804774:	4c 89 e7             	mov    %r12,%rdi
+  804777:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80477a:	85 c0                	test   %eax,%eax
+  80477c:	74 72                	je     8047f0 <devpipe_read+0xe1>
+            sys_yield();
+  80477e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804781:	8b 03                	mov    (%rbx),%eax
+  804783:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804786:	74 df                	je     804767 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804788:	48 63 c8             	movslq %eax,%rcx
+  80478b:	48 89 ca             	mov    %rcx,%rdx
+  80478e:	48 c1 ea 03          	shr    $0x3,%rdx
+  804792:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804799:	08 10 20 
+  80479c:	48 89 d0             	mov    %rdx,%rax
+  80479f:	48 f7 e6             	mul    %rsi
+  8047a2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8047a6:	48 89 d0             	mov    %rdx,%rax
+  8047a9:	48 c1 e0 09          	shl    $0x9,%rax
+  8047ad:	48 29 d0             	sub    %rdx,%rax
+  8047b0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8047b7:	00 
+  8047b8:	48 89 c8             	mov    %rcx,%rax
+  8047bb:	48 29 d0             	sub    %rdx,%rax
+  8047be:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8047c3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8047c7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8047cb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8047ce:	49 83 c7 01          	add    $0x1,%r15
+  8047d2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8047d6:	75 83                	jne    80475b <devpipe_read+0x4c>
+    return n;
+  8047d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047dc:	eb 03                	jmp    8047e1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8047de:	4c 89 f8             	mov    %r15,%rax
+}
+  8047e1:	48 83 c4 18          	add    $0x18,%rsp
+  8047e5:	5b                   	pop    %rbx
+  8047e6:	41 5c                	pop    %r12
+  8047e8:	41 5d                	pop    %r13
+  8047ea:	41 5e                	pop    %r14
+  8047ec:	41 5f                	pop    %r15
+  8047ee:	5d                   	pop    %rbp
+  8047ef:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8047f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f5:	eb ea                	jmp    8047e1 <devpipe_read+0xd2>
+
+00000000008047f7 <pipe>:
+pipe(int pfd[2]) {
+  8047f7:	55                   	push   %rbp
+  8047f8:	48 89 e5             	mov    %rsp,%rbp
+  8047fb:	41 55                	push   %r13
+  8047fd:	41 54                	push   %r12
+  8047ff:	53                   	push   %rbx
+  804800:	48 83 ec 18          	sub    $0x18,%rsp
+  804804:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804807:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80480b:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  804812:	00 00 00 
+  804815:	ff d0                	call   *%rax
+  804817:	89 c3                	mov    %eax,%ebx
+  804819:	85 c0                	test   %eax,%eax
+  80481b:	0f 88 a0 01 00 00    	js     8049c1 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804821:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804826:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80482b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80482f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804834:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  80483b:	00 00 00 
+  80483e:	ff d0                	call   *%rax
+  804840:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804842:	85 c0                	test   %eax,%eax
+  804844:	0f 88 77 01 00 00    	js     8049c1 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80484a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80484e:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  804855:	00 00 00 
+  804858:	ff d0                	call   *%rax
+  80485a:	89 c3                	mov    %eax,%ebx
+  80485c:	85 c0                	test   %eax,%eax
+  80485e:	0f 88 43 01 00 00    	js     8049a7 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804864:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804869:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80486e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804872:	bf 00 00 00 00       	mov    $0x0,%edi
+  804877:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  80487e:	00 00 00 
+  804881:	ff d0                	call   *%rax
+  804883:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804885:	85 c0                	test   %eax,%eax
+  804887:	0f 88 1a 01 00 00    	js     8049a7 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80488d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804891:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  804898:	00 00 00 
+  80489b:	ff d0                	call   *%rax
+  80489d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8048a0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8048a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048aa:	48 89 c6             	mov    %rax,%rsi
+  8048ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b2:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  8048b9:	00 00 00 
+  8048bc:	ff d0                	call   *%rax
+  8048be:	89 c3                	mov    %eax,%ebx
+  8048c0:	85 c0                	test   %eax,%eax
+  8048c2:	0f 88 c5 00 00 00    	js     80498d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8048c8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8048cc:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  8048d3:	00 00 00 
+  8048d6:	ff d0                	call   *%rax
+  8048d8:	48 89 c1             	mov    %rax,%rcx
+  8048db:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8048e1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8048e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048ec:	4c 89 ee             	mov    %r13,%rsi
+  8048ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048f4:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  8048fb:	00 00 00 
+  8048fe:	ff d0                	call   *%rax
+  804900:	89 c3                	mov    %eax,%ebx
+  804902:	85 c0                	test   %eax,%eax
+  804904:	78 6e                	js     804974 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804906:	be 00 10 00 00       	mov    $0x1000,%esi
+  80490b:	4c 89 ef             	mov    %r13,%rdi
+  80490e:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  804915:	00 00 00 
+  804918:	ff d0                	call   *%rax
+  80491a:	83 f8 02             	cmp    $0x2,%eax
+  80491d:	0f 85 ab 00 00 00    	jne    8049ce <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804923:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80492a:	00 00 
+  80492c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804930:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804932:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804936:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80493d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804941:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804943:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804947:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80494e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804952:	48 bb dc 35 80 00 00 	movabs $0x8035dc,%rbx
+  804959:	00 00 00 
+  80495c:	ff d3                	call   *%rbx
+  80495e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804962:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804966:	ff d3                	call   *%rbx
+  804968:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80496d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804972:	eb 4d                	jmp    8049c1 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804974:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804979:	4c 89 ee             	mov    %r13,%rsi
+  80497c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804981:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  804988:	00 00 00 
+  80498b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80498d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804992:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804996:	bf 00 00 00 00       	mov    $0x0,%edi
+  80499b:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  8049a2:	00 00 00 
+  8049a5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8049a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049ac:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8049b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049b5:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  8049bc:	00 00 00 
+  8049bf:	ff d0                	call   *%rax
+}
+  8049c1:	89 d8                	mov    %ebx,%eax
+  8049c3:	48 83 c4 18          	add    $0x18,%rsp
+  8049c7:	5b                   	pop    %rbx
+  8049c8:	41 5c                	pop    %r12
+  8049ca:	41 5d                	pop    %r13
+  8049cc:	5d                   	pop    %rbp
+  8049cd:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8049ce:	48 b9 c8 69 80 00 00 	movabs $0x8069c8,%rcx
+  8049d5:	00 00 00 
+  8049d8:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  8049df:	00 00 00 
+  8049e2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8049e7:	48 bf b7 69 80 00 00 	movabs $0x8069b7,%rdi
+  8049ee:	00 00 00 
+  8049f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f6:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  8049fd:	00 00 00 
+  804a00:	41 ff d0             	call   *%r8
+
+0000000000804a03 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804a03:	55                   	push   %rbp
+  804a04:	48 89 e5             	mov    %rsp,%rbp
+  804a07:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804a0b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804a0f:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  804a16:	00 00 00 
+  804a19:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804a1b:	85 c0                	test   %eax,%eax
+  804a1d:	78 35                	js     804a54 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804a1f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a23:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  804a2a:	00 00 00 
+  804a2d:	ff d0                	call   *%rax
+  804a2f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804a32:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804a37:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a3c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a40:	48 b8 18 2b 80 00 00 	movabs $0x802b18,%rax
+  804a47:	00 00 00 
+  804a4a:	ff d0                	call   *%rax
+  804a4c:	85 c0                	test   %eax,%eax
+  804a4e:	0f 94 c0             	sete   %al
+  804a51:	0f b6 c0             	movzbl %al,%eax
+}
+  804a54:	c9                   	leave
+  804a55:	c3                   	ret
+
+0000000000804a56 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804a56:	55                   	push   %rbp
+  804a57:	48 89 e5             	mov    %rsp,%rbp
+  804a5a:	41 55                	push   %r13
+  804a5c:	41 54                	push   %r12
+  804a5e:	53                   	push   %rbx
+  804a5f:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  804a63:	85 ff                	test   %edi,%edi
+  804a65:	74 73                	je     804ada <wait+0x84>
+  804a67:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804a6a:	89 f8                	mov    %edi,%eax
+  804a6c:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  804a71:	89 f9                	mov    %edi,%ecx
+  804a73:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804a79:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  804a80:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804a87:	00 00 00 
+  804a8a:	48 01 ca             	add    %rcx,%rdx
+  804a8d:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804a93:	39 d7                	cmp    %edx,%edi
+  804a95:	75 38                	jne    804acf <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804a97:	48 98                	cltq
+  804a99:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  804aa0:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804aa7:	00 00 00 
+  804aaa:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804aad:	49 bd a9 2a 80 00 00 	movabs $0x802aa9,%r13
+  804ab4:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804ab7:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  804abd:	85 c0                	test   %eax,%eax
+  804abf:	74 0e                	je     804acf <wait+0x79>
+        sys_yield();
+  804ac1:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804ac4:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804aca:	44 39 e0             	cmp    %r12d,%eax
+  804acd:	74 e8                	je     804ab7 <wait+0x61>
+    }
+}
+  804acf:	48 83 c4 08          	add    $0x8,%rsp
+  804ad3:	5b                   	pop    %rbx
+  804ad4:	41 5c                	pop    %r12
+  804ad6:	41 5d                	pop    %r13
+  804ad8:	5d                   	pop    %rbp
+  804ad9:	c3                   	ret
+    assert(envid != 0);
+  804ada:	48 b9 ec 69 80 00 00 	movabs $0x8069ec,%rcx
+  804ae1:	00 00 00 
+  804ae4:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  804aeb:	00 00 00 
+  804aee:	be 06 00 00 00       	mov    $0x6,%esi
+  804af3:	48 bf f7 69 80 00 00 	movabs $0x8069f7,%rdi
+  804afa:	00 00 00 
+  804afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b02:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  804b09:	00 00 00 
+  804b0c:	41 ff d0             	call   *%r8
+
+0000000000804b0f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b0f:	48 89 f8             	mov    %rdi,%rax
+  804b12:	48 c1 e8 27          	shr    $0x27,%rax
+  804b16:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b1d:	01 00 00 
+  804b20:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b24:	f6 c2 01             	test   $0x1,%dl
+  804b27:	74 6d                	je     804b96 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804b29:	48 89 f8             	mov    %rdi,%rax
+  804b2c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804b30:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b37:	01 00 00 
+  804b3a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b3e:	f6 c2 01             	test   $0x1,%dl
+  804b41:	74 62                	je     804ba5 <get_uvpt_entry+0x96>
+  804b43:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b4a:	01 00 00 
+  804b4d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b51:	f6 c2 80             	test   $0x80,%dl
+  804b54:	75 4f                	jne    804ba5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804b56:	48 89 f8             	mov    %rdi,%rax
+  804b59:	48 c1 e8 15          	shr    $0x15,%rax
+  804b5d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804b64:	01 00 00 
+  804b67:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b6b:	f6 c2 01             	test   $0x1,%dl
+  804b6e:	74 44                	je     804bb4 <get_uvpt_entry+0xa5>
+  804b70:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804b77:	01 00 00 
+  804b7a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b7e:	f6 c2 80             	test   $0x80,%dl
+  804b81:	75 31                	jne    804bb4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804b83:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804b87:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804b8e:	01 00 00 
+  804b91:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804b95:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b96:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b9d:	01 00 00 
+  804ba0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ba4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804ba5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804bac:	01 00 00 
+  804baf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bb3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804bb4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804bbb:	01 00 00 
+  804bbe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bc2:	c3                   	ret
+
+0000000000804bc3 <get_prot>:
+
+int
+get_prot(void *va) {
+  804bc3:	55                   	push   %rbp
+  804bc4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804bc7:	48 b8 0f 4b 80 00 00 	movabs $0x804b0f,%rax
+  804bce:	00 00 00 
+  804bd1:	ff d0                	call   *%rax
+  804bd3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804bd6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804bdb:	89 c1                	mov    %eax,%ecx
+  804bdd:	83 c9 04             	or     $0x4,%ecx
+  804be0:	f6 c2 01             	test   $0x1,%dl
+  804be3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804be6:	89 c1                	mov    %eax,%ecx
+  804be8:	83 c9 02             	or     $0x2,%ecx
+  804beb:	f6 c2 02             	test   $0x2,%dl
+  804bee:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804bf1:	89 c1                	mov    %eax,%ecx
+  804bf3:	83 c9 01             	or     $0x1,%ecx
+  804bf6:	48 85 d2             	test   %rdx,%rdx
+  804bf9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804bfc:	89 c1                	mov    %eax,%ecx
+  804bfe:	83 c9 40             	or     $0x40,%ecx
+  804c01:	f6 c6 04             	test   $0x4,%dh
+  804c04:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804c07:	5d                   	pop    %rbp
+  804c08:	c3                   	ret
+
+0000000000804c09 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804c09:	55                   	push   %rbp
+  804c0a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c0d:	48 b8 0f 4b 80 00 00 	movabs $0x804b0f,%rax
+  804c14:	00 00 00 
+  804c17:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804c19:	48 c1 e8 06          	shr    $0x6,%rax
+  804c1d:	83 e0 01             	and    $0x1,%eax
+}
+  804c20:	5d                   	pop    %rbp
+  804c21:	c3                   	ret
+
+0000000000804c22 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804c22:	55                   	push   %rbp
+  804c23:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804c26:	48 b8 0f 4b 80 00 00 	movabs $0x804b0f,%rax
+  804c2d:	00 00 00 
+  804c30:	ff d0                	call   *%rax
+  804c32:	83 e0 01             	and    $0x1,%eax
+}
+  804c35:	5d                   	pop    %rbp
+  804c36:	c3                   	ret
+
+0000000000804c37 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804c37:	55                   	push   %rbp
+  804c38:	48 89 e5             	mov    %rsp,%rbp
+  804c3b:	41 57                	push   %r15
+  804c3d:	41 56                	push   %r14
+  804c3f:	41 55                	push   %r13
+  804c41:	41 54                	push   %r12
+  804c43:	53                   	push   %rbx
+  804c44:	48 83 ec 28          	sub    $0x28,%rsp
+  804c48:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804c4c:	48 85 ff             	test   %rdi,%rdi
+  804c4f:	74 1e                	je     804c6f <foreach_shared_region+0x38>
+  804c51:	49 89 ff             	mov    %rdi,%r15
+  804c54:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804c5a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804c60:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804c67:	01 00 00 
+  804c6a:	e9 72 02 00 00       	jmp    804ee1 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804c6f:	48 b9 02 6a 80 00 00 	movabs $0x806a02,%rcx
+  804c76:	00 00 00 
+  804c79:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  804c80:	00 00 00 
+  804c83:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804c88:	48 bf 06 6a 80 00 00 	movabs $0x806a06,%rdi
+  804c8f:	00 00 00 
+  804c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c97:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  804c9e:	00 00 00 
+  804ca1:	41 ff d0             	call   *%r8
+  804ca4:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804cab:	eb 6c                	jmp    804d19 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804cad:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804cb4:	ff ff ff 
+  804cb7:	4c 21 e2             	and    %r12,%rdx
+  804cba:	48 89 d8             	mov    %rbx,%rax
+  804cbd:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804cc2:	48 83 c0 01          	add    $0x1,%rax
+  804cc6:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804cca:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804cd1:	00 00 00 
+  804cd4:	48 21 c8             	and    %rcx,%rax
+  804cd7:	48 09 d0             	or     %rdx,%rax
+  804cda:	49 89 c4             	mov    %rax,%r12
+  804cdd:	eb 30                	jmp    804d0f <foreach_shared_region+0xd8>
+  804cdf:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804ce6:	ff ff ff 
+  804ce9:	4c 21 e2             	and    %r12,%rdx
+  804cec:	48 89 d8             	mov    %rbx,%rax
+  804cef:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804cf4:	48 83 c0 01          	add    $0x1,%rax
+  804cf8:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804cfc:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804d03:	00 00 00 
+  804d06:	48 21 c8             	and    %rcx,%rax
+  804d09:	48 09 d0             	or     %rdx,%rax
+  804d0c:	49 89 c4             	mov    %rax,%r12
+  804d0f:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804d13:	0f 84 99 01 00 00    	je     804eb2 <foreach_shared_region+0x27b>
+  804d19:	4c 89 e3             	mov    %r12,%rbx
+  804d1c:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804d20:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804d27:	01 00 00 
+  804d2a:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804d2e:	a8 01                	test   $0x1,%al
+  804d30:	0f 84 77 ff ff ff    	je     804cad <foreach_shared_region+0x76>
+  804d36:	a8 80                	test   $0x80,%al
+  804d38:	74 19                	je     804d53 <foreach_shared_region+0x11c>
+  804d3a:	f6 c4 04             	test   $0x4,%ah
+  804d3d:	74 a0                	je     804cdf <foreach_shared_region+0xa8>
+  804d3f:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804d46:	40 
+  804d47:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d4b:	4c 89 e7             	mov    %r12,%rdi
+  804d4e:	41 ff d7             	call   *%r15
+  804d51:	eb 8c                	jmp    804cdf <foreach_shared_region+0xa8>
+  804d53:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804d5a:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804d5e:	eb 46                	jmp    804da6 <foreach_shared_region+0x16f>
+  804d60:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804d67:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804d6d:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804d71:	48 c1 e0 15          	shl    $0x15,%rax
+  804d75:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804d7a:	49 09 c4             	or     %rax,%r12
+  804d7d:	eb 1d                	jmp    804d9c <foreach_shared_region+0x165>
+  804d7f:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804d86:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804d8c:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804d90:	48 c1 e0 15          	shl    $0x15,%rax
+  804d94:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804d99:	49 09 c4             	or     %rax,%r12
+  804d9c:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804da0:	0f 84 d3 00 00 00    	je     804e79 <foreach_shared_region+0x242>
+  804da6:	4c 89 e3             	mov    %r12,%rbx
+  804da9:	48 c1 eb 15          	shr    $0x15,%rbx
+  804dad:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804db4:	01 00 00 
+  804db7:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804dbb:	a8 01                	test   $0x1,%al
+  804dbd:	74 a1                	je     804d60 <foreach_shared_region+0x129>
+  804dbf:	a8 80                	test   $0x80,%al
+  804dc1:	74 19                	je     804ddc <foreach_shared_region+0x1a5>
+  804dc3:	f6 c4 04             	test   $0x4,%ah
+  804dc6:	74 b7                	je     804d7f <foreach_shared_region+0x148>
+  804dc8:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804dcf:	00 
+  804dd0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804dd4:	4c 89 e7             	mov    %r12,%rdi
+  804dd7:	41 ff d7             	call   *%r15
+  804dda:	eb a3                	jmp    804d7f <foreach_shared_region+0x148>
+  804ddc:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804de2:	eb 3b                	jmp    804e1f <foreach_shared_region+0x1e8>
+  804de4:	f6 c4 04             	test   $0x4,%ah
+  804de7:	74 12                	je     804dfb <foreach_shared_region+0x1c4>
+  804de9:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804df0:	00 
+  804df1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804df5:	4c 89 e7             	mov    %r12,%rdi
+  804df8:	41 ff d7             	call   *%r15
+  804dfb:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804e02:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804e08:	48 83 c3 01          	add    $0x1,%rbx
+  804e0c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804e10:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804e16:	49 09 dc             	or     %rbx,%r12
+  804e19:	41 83 ed 01          	sub    $0x1,%r13d
+  804e1d:	74 2f                	je     804e4e <foreach_shared_region+0x217>
+  804e1f:	4c 89 e3             	mov    %r12,%rbx
+  804e22:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804e26:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804e2a:	a8 01                	test   $0x1,%al
+  804e2c:	75 b6                	jne    804de4 <foreach_shared_region+0x1ad>
+  804e2e:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804e35:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804e3b:	48 83 c3 01          	add    $0x1,%rbx
+  804e3f:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804e43:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804e49:	49 09 dc             	or     %rbx,%r12
+  804e4c:	eb cb                	jmp    804e19 <foreach_shared_region+0x1e2>
+  804e4e:	4c 89 e0             	mov    %r12,%rax
+  804e51:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804e57:	49 c1 ec 15          	shr    $0x15,%r12
+  804e5b:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804e62:	49 83 c4 01          	add    $0x1,%r12
+  804e66:	49 c1 e4 15          	shl    $0x15,%r12
+  804e6a:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804e71:	49 09 c4             	or     %rax,%r12
+  804e74:	e9 23 ff ff ff       	jmp    804d9c <foreach_shared_region+0x165>
+  804e79:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804e7d:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804e84:	ff ff ff 
+  804e87:	4c 21 e0             	and    %r12,%rax
+  804e8a:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804e8e:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804e95:	49 83 c4 01          	add    $0x1,%r12
+  804e99:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804e9d:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804ea4:	00 00 00 
+  804ea7:	49 21 d4             	and    %rdx,%r12
+  804eaa:	49 09 c4             	or     %rax,%r12
+  804ead:	e9 5d fe ff ff       	jmp    804d0f <foreach_shared_region+0xd8>
+  804eb2:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804eb9:	00 ff ff 
+  804ebc:	4c 21 e0             	and    %r12,%rax
+  804ebf:	49 c1 ec 27          	shr    $0x27,%r12
+  804ec3:	49 83 c4 01          	add    $0x1,%r12
+  804ec7:	49 c1 e4 27          	shl    $0x27,%r12
+  804ecb:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804ed2:	ff 00 00 
+  804ed5:	49 21 d4             	and    %rdx,%r12
+  804ed8:	49 09 c4             	or     %rax,%r12
+  804edb:	41 83 ed 01          	sub    $0x1,%r13d
+  804edf:	74 48                	je     804f29 <foreach_shared_region+0x2f2>
+  804ee1:	4c 89 e0             	mov    %r12,%rax
+  804ee4:	48 c1 e8 27          	shr    $0x27,%rax
+  804ee8:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804eef:	01 00 00 
+  804ef2:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804ef6:	f6 c2 01             	test   $0x1,%dl
+  804ef9:	0f 85 a5 fd ff ff    	jne    804ca4 <foreach_shared_region+0x6d>
+  804eff:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804f06:	00 ff ff 
+  804f09:	4c 21 e2             	and    %r12,%rdx
+  804f0c:	48 83 c0 01          	add    $0x1,%rax
+  804f10:	48 c1 e0 27          	shl    $0x27,%rax
+  804f14:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804f1b:	ff 00 00 
+  804f1e:	48 21 c8             	and    %rcx,%rax
+  804f21:	48 09 d0             	or     %rdx,%rax
+  804f24:	49 89 c4             	mov    %rax,%r12
+  804f27:	eb b2                	jmp    804edb <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804f29:	4d 85 e4             	test   %r12,%r12
+  804f2c:	75 14                	jne    804f42 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f33:	48 83 c4 28          	add    $0x28,%rsp
+  804f37:	5b                   	pop    %rbx
+  804f38:	41 5c                	pop    %r12
+  804f3a:	41 5d                	pop    %r13
+  804f3c:	41 5e                	pop    %r14
+  804f3e:	41 5f                	pop    %r15
+  804f40:	5d                   	pop    %rbp
+  804f41:	c3                   	ret
+    assert(addr == 0);
+  804f42:	48 b9 11 6a 80 00 00 	movabs $0x806a11,%rcx
+  804f49:	00 00 00 
+  804f4c:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  804f53:	00 00 00 
+  804f56:	be 67 00 00 00       	mov    $0x67,%esi
+  804f5b:	48 bf 06 6a 80 00 00 	movabs $0x806a06,%rdi
+  804f62:	00 00 00 
+  804f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6a:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  804f71:	00 00 00 
+  804f74:	41 ff d0             	call   *%r8
+
+0000000000804f77 <vsys_gettime>:
+    // LAB 12: Your code here DONE
+    if (num < 0 || num >= NVSYSCALLS) {
+        return -E_NO_SYS;
+    }
+
+    return vsys[num];
+  804f77:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  804f7e:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  804f80:	c3                   	ret
+
+0000000000804f81 <vsys_gettimems>:
+    return vsys[num];
+  804f81:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  804f88:	00 00 
+
+uint32_t
+vsys_gettimems() {
+    return (uint32_t)vsyscall(VSYS_gettimems);
+}
+  804f8a:	c3                   	ret
+
+0000000000804f8b <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804f8b:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804f92:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804f95:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804f9b:	eb 33                	jmp    804fd0 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f9d:	48 83 c0 20          	add    $0x20,%rax
+  804fa1:	4c 39 c0             	cmp    %r8,%rax
+  804fa4:	74 25                	je     804fcb <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804fa6:	48 8b 10             	mov    (%rax),%rdx
+  804fa9:	48 85 d2             	test   %rdx,%rdx
+  804fac:	74 ef                	je     804f9d <mmap_place+0x12>
+  804fae:	48 89 d1             	mov    %rdx,%rcx
+  804fb1:	48 03 48 08          	add    0x8(%rax),%rcx
+  804fb5:	48 39 cf             	cmp    %rcx,%rdi
+  804fb8:	73 e3                	jae    804f9d <mmap_place+0x12>
+  804fba:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804fbe:	4c 39 ca             	cmp    %r9,%rdx
+  804fc1:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804fc5:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804fc9:	eb d2                	jmp    804f9d <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804fcb:	45 84 d2             	test   %r10b,%r10b
+  804fce:	74 12                	je     804fe2 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fd0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804fd7:	00 00 00 
+        moved = 0;
+  804fda:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804fe0:	eb c4                	jmp    804fa6 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804fe2:	48 01 fe             	add    %rdi,%rsi
+  804fe5:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804fec:	00 00 00 
+  804fef:	48 39 f0             	cmp    %rsi,%rax
+  804ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff7:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804ffb:	c3                   	ret
+
+0000000000804ffc <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804ffc:	55                   	push   %rbp
+  804ffd:	48 89 e5             	mov    %rsp,%rbp
+  805000:	41 57                	push   %r15
+  805002:	41 56                	push   %r14
+  805004:	41 55                	push   %r13
+  805006:	41 54                	push   %r12
+  805008:	53                   	push   %rbx
+  805009:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80500d:	48 8b 1f             	mov    (%rdi),%rbx
+  805010:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805017:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80501e:	00 00 00 
+  805021:	ba 00 00 00 00       	mov    $0x0,%edx
+  805026:	eb 12                	jmp    80503a <mmap_pgfault+0x3e>
+  805028:	48 83 c2 01          	add    $0x1,%rdx
+  80502c:	48 83 c0 20          	add    $0x20,%rax
+  805030:	48 83 fa 20          	cmp    $0x20,%rdx
+  805034:	0f 84 04 01 00 00    	je     80513e <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80503a:	48 8b 08             	mov    (%rax),%rcx
+  80503d:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  805041:	48 39 de             	cmp    %rbx,%rsi
+  805044:	73 e2                	jae    805028 <mmap_pgfault+0x2c>
+  805046:	48 03 48 08          	add    0x8(%rax),%rcx
+  80504a:	48 39 cb             	cmp    %rcx,%rbx
+  80504d:	73 d9                	jae    805028 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80504f:	48 c1 e2 05          	shl    $0x5,%rdx
+  805053:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80505a:	00 00 00 
+  80505d:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  805061:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  805065:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  805069:	f6 c2 01             	test   $0x1,%dl
+  80506c:	0f 84 e0 00 00 00    	je     805152 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  805072:	b8 00 00 00 00       	mov    $0x0,%eax
+  805077:	f6 c2 02             	test   $0x2,%dl
+  80507a:	0f 84 c3 00 00 00    	je     805143 <mmap_pgfault+0x147>
+  805080:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805087:	ff ff ff 
+  80508a:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80508e:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  805095:	00 00 00 
+  805098:	48 39 ca             	cmp    %rcx,%rdx
+  80509b:	0f 85 a2 00 00 00    	jne    805143 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8050a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8050a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050ab:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8050b2:	00 00 00 
+  8050b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050ba:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  8050c1:	00 00 00 
+  8050c4:	ff d0                	call   *%rax
+  8050c6:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8050c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050cd:	85 d2                	test   %edx,%edx
+  8050cf:	78 72                	js     805143 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8050d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050d6:	48 89 de             	mov    %rbx,%rsi
+  8050d9:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8050e0:	00 00 00 
+  8050e3:	4c 89 e7             	mov    %r12,%rdi
+  8050e6:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  8050ed:	00 00 00 
+  8050f0:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8050f2:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8050f8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8050fe:	48 89 d9             	mov    %rbx,%rcx
+  805101:	ba 00 00 00 00       	mov    $0x0,%edx
+  805106:	4c 89 e6             	mov    %r12,%rsi
+  805109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80510e:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  805115:	00 00 00 
+  805118:	ff d0                	call   *%rax
+  80511a:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  80511c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805121:	4c 89 e6             	mov    %r12,%rsi
+  805124:	bf 00 00 00 00       	mov    $0x0,%edi
+  805129:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  805130:	00 00 00 
+  805133:	ff d0                	call   *%rax
+    return res >= 0;
+  805135:	89 d8                	mov    %ebx,%eax
+  805137:	f7 d0                	not    %eax
+  805139:	c1 e8 1f             	shr    $0x1f,%eax
+  80513c:	eb 05                	jmp    805143 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80513e:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  805143:	48 83 c4 18          	add    $0x18,%rsp
+  805147:	5b                   	pop    %rbx
+  805148:	41 5c                	pop    %r12
+  80514a:	41 5d                	pop    %r13
+  80514c:	41 5e                	pop    %r14
+  80514e:	41 5f                	pop    %r15
+  805150:	5d                   	pop    %rbp
+  805151:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  805152:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805156:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  80515a:	4c 03 30             	add    (%rax),%r14
+  80515d:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  805164:	49 39 c6             	cmp    %rax,%r14
+  805167:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80516b:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  805172:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805178:	49 bf 22 4c 80 00 00 	movabs $0x804c22,%r15
+  80517f:	00 00 00 
+  805182:	4d 39 f4             	cmp    %r14,%r12
+  805185:	73 1d                	jae    8051a4 <mmap_pgfault+0x1a8>
+  805187:	4c 89 e7             	mov    %r12,%rdi
+  80518a:	41 ff d7             	call   *%r15
+  80518d:	84 c0                	test   %al,%al
+  80518f:	75 13                	jne    8051a4 <mmap_pgfault+0x1a8>
+  805191:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805198:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80519f:	4d 39 f4             	cmp    %r14,%r12
+  8051a2:	72 e3                	jb     805187 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8051a4:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8051aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051ae:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8051b2:	74 2a                	je     8051de <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8051b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051b8:	89 de                	mov    %ebx,%esi
+  8051ba:	2b 30                	sub    (%rax),%esi
+  8051bc:	03 70 1c             	add    0x1c(%rax),%esi
+  8051bf:	8b 78 18             	mov    0x18(%rax),%edi
+  8051c2:	4c 89 e9             	mov    %r13,%rcx
+  8051c5:	48 89 da             	mov    %rbx,%rdx
+  8051c8:	48 b8 c7 42 80 00 00 	movabs $0x8042c7,%rax
+  8051cf:	00 00 00 
+  8051d2:	ff d0                	call   *%rax
+    return res > 0;
+  8051d4:	85 c0                	test   %eax,%eax
+  8051d6:	0f 9f c0             	setg   %al
+  8051d9:	e9 65 ff ff ff       	jmp    805143 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8051de:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8051e2:	eb d0                	jmp    8051b4 <mmap_pgfault+0x1b8>
+
+00000000008051e4 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8051e4:	55                   	push   %rbp
+  8051e5:	48 89 e5             	mov    %rsp,%rbp
+  8051e8:	41 57                	push   %r15
+  8051ea:	41 56                	push   %r14
+  8051ec:	41 55                	push   %r13
+  8051ee:	41 54                	push   %r12
+  8051f0:	53                   	push   %rbx
+  8051f1:	48 83 ec 28          	sub    $0x28,%rsp
+  8051f5:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8051f9:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8051fc:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805203:	ff ff ff 
+  805206:	48 23 57 10          	and    0x10(%rdi),%rdx
+  80520a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80520f:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  805216:	00 00 00 
+  805219:	48 39 ca             	cmp    %rcx,%rdx
+  80521c:	0f 85 e5 00 00 00    	jne    805307 <mmap_writeback+0x123>
+  805222:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  805225:	4c 39 ee             	cmp    %r13,%rsi
+  805228:	0f 83 e8 00 00 00    	jae    805316 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80522e:	49 be 22 4c 80 00 00 	movabs $0x804c22,%r14
+  805235:	00 00 00 
+  805238:	49 bf 09 4c 80 00 00 	movabs $0x804c09,%r15
+  80523f:	00 00 00 
+  805242:	eb 10                	jmp    805254 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  805244:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80524b:	4d 39 ec             	cmp    %r13,%r12
+  80524e:	0f 83 ae 00 00 00    	jae    805302 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805254:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805258:	4c 89 e7             	mov    %r12,%rdi
+  80525b:	41 ff d6             	call   *%r14
+  80525e:	84 c0                	test   %al,%al
+  805260:	74 e2                	je     805244 <mmap_writeback+0x60>
+  805262:	4c 89 e7             	mov    %r12,%rdi
+  805265:	41 ff d7             	call   *%r15
+  805268:	84 c0                	test   %al,%al
+  80526a:	74 d8                	je     805244 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80526c:	4c 89 e3             	mov    %r12,%rbx
+  80526f:	4d 39 ec             	cmp    %r13,%r12
+  805272:	73 20                	jae    805294 <mmap_writeback+0xb0>
+  805274:	48 89 df             	mov    %rbx,%rdi
+  805277:	41 ff d6             	call   *%r14
+  80527a:	84 c0                	test   %al,%al
+  80527c:	74 16                	je     805294 <mmap_writeback+0xb0>
+  80527e:	48 89 df             	mov    %rbx,%rdi
+  805281:	41 ff d7             	call   *%r15
+  805284:	84 c0                	test   %al,%al
+  805286:	74 0c                	je     805294 <mmap_writeback+0xb0>
+  805288:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80528f:	4c 39 eb             	cmp    %r13,%rbx
+  805292:	72 e0                	jb     805274 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  805294:	48 89 d9             	mov    %rbx,%rcx
+  805297:	4c 29 e1             	sub    %r12,%rcx
+  80529a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80529e:	44 89 e6             	mov    %r12d,%esi
+  8052a1:	2b 30                	sub    (%rax),%esi
+  8052a3:	49 89 c4             	mov    %rax,%r12
+  8052a6:	03 70 1c             	add    0x1c(%rax),%esi
+  8052a9:	8b 78 18             	mov    0x18(%rax),%edi
+  8052ac:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8052b0:	48 89 ca             	mov    %rcx,%rdx
+  8052b3:	48 b8 50 43 80 00 00 	movabs $0x804350,%rax
+  8052ba:	00 00 00 
+  8052bd:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8052bf:	85 c0                	test   %eax,%eax
+  8052c1:	78 44                	js     805307 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8052c3:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8052c8:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8052cb:	41 89 c1             	mov    %eax,%r9d
+  8052ce:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8052d5:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8052d9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8052dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052e2:	48 89 ce             	mov    %rcx,%rsi
+  8052e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ea:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  8052f1:	00 00 00 
+  8052f4:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8052f6:	85 c0                	test   %eax,%eax
+  8052f8:	78 0d                	js     805307 <mmap_writeback+0x123>
+  8052fa:	49 89 dc             	mov    %rbx,%r12
+  8052fd:	e9 49 ff ff ff       	jmp    80524b <mmap_writeback+0x67>
+    }
+
+    return 0;
+  805302:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805307:	48 83 c4 28          	add    $0x28,%rsp
+  80530b:	5b                   	pop    %rbx
+  80530c:	41 5c                	pop    %r12
+  80530e:	41 5d                	pop    %r13
+  805310:	41 5e                	pop    %r14
+  805312:	41 5f                	pop    %r15
+  805314:	5d                   	pop    %rbp
+  805315:	c3                   	ret
+    return 0;
+  805316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80531b:	eb ea                	jmp    805307 <mmap_writeback+0x123>
+
+000000000080531d <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80531d:	55                   	push   %rbp
+  80531e:	48 89 e5             	mov    %rsp,%rbp
+  805321:	41 57                	push   %r15
+  805323:	41 56                	push   %r14
+  805325:	41 55                	push   %r13
+  805327:	41 54                	push   %r12
+  805329:	53                   	push   %rbx
+  80532a:	48 83 ec 38          	sub    $0x38,%rsp
+  80532e:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805332:	48 85 f6             	test   %rsi,%rsi
+  805335:	0f 84 0c 02 00 00    	je     805547 <mmap+0x22a>
+  80533b:	49 89 ff             	mov    %rdi,%r15
+  80533e:	49 89 f4             	mov    %rsi,%r12
+  805341:	41 89 d5             	mov    %edx,%r13d
+  805344:	41 89 ce             	mov    %ecx,%r14d
+  805347:	44 89 cb             	mov    %r9d,%ebx
+  80534a:	45 85 c9             	test   %r9d,%r9d
+  80534d:	0f 88 f4 01 00 00    	js     805547 <mmap+0x22a>
+  805353:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80535a:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805361:	0f 85 e7 01 00 00    	jne    80554e <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805367:	83 e2 fd             	and    $0xfffffffd,%edx
+  80536a:	83 fa 04             	cmp    $0x4,%edx
+  80536d:	0f 85 db 01 00 00    	jne    80554e <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805373:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805376:	83 fa 01             	cmp    $0x1,%edx
+  805379:	0f 87 cf 01 00 00    	ja     80554e <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  80537f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805383:	44 89 c7             	mov    %r8d,%edi
+  805386:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  80538d:	00 00 00 
+  805390:	ff d0                	call   *%rax
+  805392:	89 c2                	mov    %eax,%edx
+  805394:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80539b:	85 d2                	test   %edx,%edx
+  80539d:	0f 88 ab 01 00 00    	js     80554e <mmap+0x231>
+  8053a3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8053a7:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8053ae:	00 00 00 
+  8053b1:	8b 09                	mov    (%rcx),%ecx
+  8053b3:	39 0a                	cmp    %ecx,(%rdx)
+  8053b5:	0f 85 93 01 00 00    	jne    80554e <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8053bb:	8b 52 08             	mov    0x8(%rdx),%edx
+  8053be:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8053c1:	83 fa 01             	cmp    $0x1,%edx
+  8053c4:	0f 84 84 01 00 00    	je     80554e <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8053ca:	41 83 fe 01          	cmp    $0x1,%r14d
+  8053ce:	74 42                	je     805412 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8053d0:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8053d7:	4c 89 e6             	mov    %r12,%rsi
+  8053da:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8053e1:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8053e5:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8053e9:	4d 85 ff             	test   %r15,%r15
+  8053ec:	74 67                	je     805455 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8053ee:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8053f5:	75 0f                	jne    805406 <mmap+0xe9>
+  8053f7:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8053fe:	00 00 00 
+  805401:	49 39 c7             	cmp    %rax,%r15
+  805404:	77 1b                	ja     805421 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805406:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80540d:	e9 3c 01 00 00       	jmp    80554e <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805412:	41 f6 c5 02          	test   $0x2,%r13b
+  805416:	74 b8                	je     8053d0 <mmap+0xb3>
+  805418:	85 d2                	test   %edx,%edx
+  80541a:	75 b4                	jne    8053d0 <mmap+0xb3>
+  80541c:	e9 2d 01 00 00       	jmp    80554e <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805421:	4c 89 ff             	mov    %r15,%rdi
+  805424:	48 b8 8b 4f 80 00 00 	movabs $0x804f8b,%rax
+  80542b:	00 00 00 
+  80542e:	ff d0                	call   *%rax
+  805430:	48 89 c2             	mov    %rax,%rdx
+  805433:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80543a:	49 39 d7             	cmp    %rdx,%r15
+  80543d:	0f 85 0b 01 00 00    	jne    80554e <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805443:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80544a:	00 00 00 
+  80544d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805453:	eb 44                	jmp    805499 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805455:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805459:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805460:	00 00 00 
+  805463:	48 b8 8b 4f 80 00 00 	movabs $0x804f8b,%rax
+  80546a:	00 00 00 
+  80546d:	ff d0                	call   *%rax
+  80546f:	48 89 c7             	mov    %rax,%rdi
+  805472:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805476:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80547d:	48 85 ff             	test   %rdi,%rdi
+  805480:	75 c1                	jne    805443 <mmap+0x126>
+  805482:	e9 c7 00 00 00       	jmp    80554e <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805487:	49 83 c4 01          	add    $0x1,%r12
+  80548b:	48 83 c0 20          	add    $0x20,%rax
+  80548f:	49 83 fc 20          	cmp    $0x20,%r12
+  805493:	0f 84 a5 00 00 00    	je     80553e <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805499:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80549d:	75 e8                	jne    805487 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  80549f:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8054a3:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  8054aa:	00 00 00 
+  8054ad:	ff d0                	call   *%rax
+  8054af:	89 c2                	mov    %eax,%edx
+  8054b1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8054b8:	85 d2                	test   %edx,%edx
+  8054ba:	0f 88 8e 00 00 00    	js     80554e <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8054c0:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8054c4:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  8054cb:	00 00 00 
+  8054ce:	ff d0                	call   *%rax
+  8054d0:	89 c6                	mov    %eax,%esi
+  8054d2:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8054d5:	48 b8 2a 38 80 00 00 	movabs $0x80382a,%rax
+  8054dc:	00 00 00 
+  8054df:	ff d0                	call   *%rax
+  8054e1:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8054e4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8054eb:	45 85 ff             	test   %r15d,%r15d
+  8054ee:	78 5e                	js     80554e <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8054f0:	49 c1 e4 05          	shl    $0x5,%r12
+  8054f4:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8054fb:	00 00 00 
+  8054fe:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805501:	48 bf fc 4f 80 00 00 	movabs $0x804ffc,%rdi
+  805508:	00 00 00 
+  80550b:	48 b8 27 5a 80 00 00 	movabs $0x805a27,%rax
+  805512:	00 00 00 
+  805515:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805517:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80551b:	49 89 04 24          	mov    %rax,(%r12)
+  80551f:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805523:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805528:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  80552d:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805532:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805537:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  80553c:	eb 10                	jmp    80554e <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  80553e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805545:	eb 07                	jmp    80554e <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805547:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  80554e:	48 83 c4 38          	add    $0x38,%rsp
+  805552:	5b                   	pop    %rbx
+  805553:	41 5c                	pop    %r12
+  805555:	41 5d                	pop    %r13
+  805557:	41 5e                	pop    %r14
+  805559:	41 5f                	pop    %r15
+  80555b:	5d                   	pop    %rbp
+  80555c:	c3                   	ret
+
+000000000080555d <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  80555d:	55                   	push   %rbp
+  80555e:	48 89 e5             	mov    %rsp,%rbp
+  805561:	41 57                	push   %r15
+  805563:	41 56                	push   %r14
+  805565:	41 55                	push   %r13
+  805567:	41 54                	push   %r12
+  805569:	53                   	push   %rbx
+  80556a:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80556e:	49 89 fe             	mov    %rdi,%r14
+  805571:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805578:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80557f:	00 
+  805580:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805587:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80558e:	00 00 00 
+  805591:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805598:	49 bf e4 51 80 00 00 	movabs $0x8051e4,%r15
+  80559f:	00 00 00 
+  8055a2:	eb 09                	jmp    8055ad <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8055a4:	48 83 c3 20          	add    $0x20,%rbx
+  8055a8:	4c 39 eb             	cmp    %r13,%rbx
+  8055ab:	74 33                	je     8055e0 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8055ad:	48 89 df             	mov    %rbx,%rdi
+  8055b0:	48 8b 33             	mov    (%rbx),%rsi
+  8055b3:	4c 39 e6             	cmp    %r12,%rsi
+  8055b6:	73 ec                	jae    8055a4 <msync+0x47>
+  8055b8:	48 85 f6             	test   %rsi,%rsi
+  8055bb:	74 e7                	je     8055a4 <msync+0x47>
+  8055bd:	48 89 f2             	mov    %rsi,%rdx
+  8055c0:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8055c4:	49 39 d6             	cmp    %rdx,%r14
+  8055c7:	73 db                	jae    8055a4 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8055c9:	4c 39 e2             	cmp    %r12,%rdx
+  8055cc:	49 0f 47 d4          	cmova  %r12,%rdx
+  8055d0:	4c 39 f6             	cmp    %r14,%rsi
+  8055d3:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8055d7:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8055da:	85 c0                	test   %eax,%eax
+  8055dc:	79 c6                	jns    8055a4 <msync+0x47>
+  8055de:	eb 05                	jmp    8055e5 <msync+0x88>
+    }
+
+    return 0;
+  8055e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055e5:	48 83 c4 08          	add    $0x8,%rsp
+  8055e9:	5b                   	pop    %rbx
+  8055ea:	41 5c                	pop    %r12
+  8055ec:	41 5d                	pop    %r13
+  8055ee:	41 5e                	pop    %r14
+  8055f0:	41 5f                	pop    %r15
+  8055f2:	5d                   	pop    %rbp
+  8055f3:	c3                   	ret
+
+00000000008055f4 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8055f4:	55                   	push   %rbp
+  8055f5:	48 89 e5             	mov    %rsp,%rbp
+  8055f8:	41 57                	push   %r15
+  8055fa:	41 56                	push   %r14
+  8055fc:	41 55                	push   %r13
+  8055fe:	41 54                	push   %r12
+  805600:	53                   	push   %rbx
+  805601:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805605:	49 89 ff             	mov    %rdi,%r15
+  805608:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80560f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805616:	00 
+  805617:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80561e:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805625:	00 00 00 
+  805628:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80562f:	48 89 d8             	mov    %rbx,%rax
+  805632:	eb 09                	jmp    80563d <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805634:	48 83 c0 20          	add    $0x20,%rax
+  805638:	4c 39 f0             	cmp    %r14,%rax
+  80563b:	74 40                	je     80567d <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80563d:	48 8b 10             	mov    (%rax),%rdx
+  805640:	4c 39 e2             	cmp    %r12,%rdx
+  805643:	73 ef                	jae    805634 <munmap+0x40>
+  805645:	48 85 d2             	test   %rdx,%rdx
+  805648:	74 ea                	je     805634 <munmap+0x40>
+  80564a:	48 89 d7             	mov    %rdx,%rdi
+  80564d:	48 03 78 08          	add    0x8(%rax),%rdi
+  805651:	49 39 ff             	cmp    %rdi,%r15
+  805654:	73 de                	jae    805634 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805656:	49 39 fc             	cmp    %rdi,%r12
+  805659:	72 05                	jb     805660 <munmap+0x6c>
+  80565b:	4c 39 fa             	cmp    %r15,%rdx
+  80565e:	73 d4                	jae    805634 <munmap+0x40>
+  805660:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805665:	48 83 c4 08          	add    $0x8,%rsp
+  805669:	5b                   	pop    %rbx
+  80566a:	41 5c                	pop    %r12
+  80566c:	41 5d                	pop    %r13
+  80566e:	41 5e                	pop    %r14
+  805670:	41 5f                	pop    %r15
+  805672:	5d                   	pop    %rbp
+  805673:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805674:	48 83 c3 20          	add    $0x20,%rbx
+  805678:	4c 39 f3             	cmp    %r14,%rbx
+  80567b:	74 5c                	je     8056d9 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80567d:	48 8b 33             	mov    (%rbx),%rsi
+  805680:	4c 39 e6             	cmp    %r12,%rsi
+  805683:	73 ef                	jae    805674 <munmap+0x80>
+  805685:	48 85 f6             	test   %rsi,%rsi
+  805688:	74 ea                	je     805674 <munmap+0x80>
+  80568a:	48 89 f2             	mov    %rsi,%rdx
+  80568d:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805691:	49 39 d7             	cmp    %rdx,%r15
+  805694:	73 de                	jae    805674 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805696:	48 89 df             	mov    %rbx,%rdi
+  805699:	48 b8 e4 51 80 00 00 	movabs $0x8051e4,%rax
+  8056a0:	00 00 00 
+  8056a3:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8056a5:	85 c0                	test   %eax,%eax
+  8056a7:	78 bc                	js     805665 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8056a9:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8056ad:	48 8b 33             	mov    (%rbx),%rsi
+  8056b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056b5:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  8056bc:	00 00 00 
+  8056bf:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8056c1:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8056c4:	48 b8 cf 37 80 00 00 	movabs $0x8037cf,%rax
+  8056cb:	00 00 00 
+  8056ce:	ff d0                	call   *%rax
+        reg->start = 0;
+  8056d0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8056d7:	eb 9b                	jmp    805674 <munmap+0x80>
+    return 0;
+  8056d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056de:	eb 85                	jmp    805665 <munmap+0x71>
+
+00000000008056e0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8056e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056e5:	c3                   	ret
+
+00000000008056e6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8056e6:	55                   	push   %rbp
+  8056e7:	48 89 e5             	mov    %rsp,%rbp
+  8056ea:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8056ed:	48 be 1b 6a 80 00 00 	movabs $0x806a1b,%rsi
+  8056f4:	00 00 00 
+  8056f7:	48 b8 e5 23 80 00 00 	movabs $0x8023e5,%rax
+  8056fe:	00 00 00 
+  805701:	ff d0                	call   *%rax
+    return 0;
+}
+  805703:	b8 00 00 00 00       	mov    $0x0,%eax
+  805708:	5d                   	pop    %rbp
+  805709:	c3                   	ret
+
+000000000080570a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80570a:	55                   	push   %rbp
+  80570b:	48 89 e5             	mov    %rsp,%rbp
+  80570e:	41 57                	push   %r15
+  805710:	41 56                	push   %r14
+  805712:	41 55                	push   %r13
+  805714:	41 54                	push   %r12
+  805716:	53                   	push   %rbx
+  805717:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80571e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805725:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80572c:	00 00 00 00 
+  805730:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805737:	00 00 00 00 
+  80573b:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805742:	00 00 00 00 
+  805746:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80574d:	00 00 00 00 
+  805751:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805758:	00 00 00 00 
+  80575c:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805763:	00 00 00 00 
+  805767:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80576e:	00 
+  80576f:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805776:	00 
+  805777:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80577e:	00 
+  80577f:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805786:	00 
+  805787:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80578e:	00 
+  80578f:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805796:	00 
+  805797:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80579e:	00 
+  80579f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8057a6:	00 
+  8057a7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8057ae:	00 
+  8057af:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8057b6:	00 
+    for (res = 0; res < n; res += inc) {
+  8057b7:	48 85 d2             	test   %rdx,%rdx
+  8057ba:	74 7a                	je     805836 <devcons_write+0x12c>
+  8057bc:	49 89 d6             	mov    %rdx,%r14
+  8057bf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8057c5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8057ca:	49 bf 35 27 80 00 00 	movabs $0x802735,%r15
+  8057d1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8057d4:	4c 89 f3             	mov    %r14,%rbx
+  8057d7:	48 29 f3             	sub    %rsi,%rbx
+  8057da:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8057df:	48 39 c3             	cmp    %rax,%rbx
+  8057e2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8057e6:	4c 63 eb             	movslq %ebx,%r13
+  8057e9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8057f0:	48 01 c6             	add    %rax,%rsi
+  8057f3:	4c 89 ea             	mov    %r13,%rdx
+  8057f6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8057fd:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805800:	4c 89 ee             	mov    %r13,%rsi
+  805803:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80580a:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  805811:	00 00 00 
+  805814:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805816:	41 01 dc             	add    %ebx,%r12d
+  805819:	49 63 f4             	movslq %r12d,%rsi
+  80581c:	4c 39 f6             	cmp    %r14,%rsi
+  80581f:	72 b3                	jb     8057d4 <devcons_write+0xca>
+    return res;
+  805821:	49 63 c4             	movslq %r12d,%rax
+}
+  805824:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80582b:	5b                   	pop    %rbx
+  80582c:	41 5c                	pop    %r12
+  80582e:	41 5d                	pop    %r13
+  805830:	41 5e                	pop    %r14
+  805832:	41 5f                	pop    %r15
+  805834:	5d                   	pop    %rbp
+  805835:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805836:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80583c:	eb e3                	jmp    805821 <devcons_write+0x117>
+
+000000000080583e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80583e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805841:	ba 00 00 00 00       	mov    $0x0,%edx
+  805846:	48 85 c0             	test   %rax,%rax
+  805849:	74 55                	je     8058a0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80584b:	55                   	push   %rbp
+  80584c:	48 89 e5             	mov    %rsp,%rbp
+  80584f:	41 55                	push   %r13
+  805851:	41 54                	push   %r12
+  805853:	53                   	push   %rbx
+  805854:	48 83 ec 08          	sub    $0x8,%rsp
+  805858:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80585b:	48 bb 95 29 80 00 00 	movabs $0x802995,%rbx
+  805862:	00 00 00 
+  805865:	49 bc a9 2a 80 00 00 	movabs $0x802aa9,%r12
+  80586c:	00 00 00 
+  80586f:	eb 03                	jmp    805874 <devcons_read+0x36>
+  805871:	41 ff d4             	call   *%r12
+  805874:	ff d3                	call   *%rbx
+  805876:	85 c0                	test   %eax,%eax
+  805878:	74 f7                	je     805871 <devcons_read+0x33>
+    if (c < 0) return c;
+  80587a:	48 63 d0             	movslq %eax,%rdx
+  80587d:	78 13                	js     805892 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80587f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805884:	83 f8 04             	cmp    $0x4,%eax
+  805887:	74 09                	je     805892 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805889:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80588d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805892:	48 89 d0             	mov    %rdx,%rax
+  805895:	48 83 c4 08          	add    $0x8,%rsp
+  805899:	5b                   	pop    %rbx
+  80589a:	41 5c                	pop    %r12
+  80589c:	41 5d                	pop    %r13
+  80589e:	5d                   	pop    %rbp
+  80589f:	c3                   	ret
+  8058a0:	48 89 d0             	mov    %rdx,%rax
+  8058a3:	c3                   	ret
+
+00000000008058a4 <cputchar>:
+cputchar(int ch) {
+  8058a4:	55                   	push   %rbp
+  8058a5:	48 89 e5             	mov    %rsp,%rbp
+  8058a8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8058ac:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8058b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8058b5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8058b9:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  8058c0:	00 00 00 
+  8058c3:	ff d0                	call   *%rax
+}
+  8058c5:	c9                   	leave
+  8058c6:	c3                   	ret
+
+00000000008058c7 <getchar>:
+getchar(void) {
+  8058c7:	55                   	push   %rbp
+  8058c8:	48 89 e5             	mov    %rsp,%rbp
+  8058cb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8058cf:	ba 01 00 00 00       	mov    $0x1,%edx
+  8058d4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8058d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058dd:	48 b8 4d 39 80 00 00 	movabs $0x80394d,%rax
+  8058e4:	00 00 00 
+  8058e7:	ff d0                	call   *%rax
+  8058e9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8058eb:	85 c0                	test   %eax,%eax
+  8058ed:	78 06                	js     8058f5 <getchar+0x2e>
+  8058ef:	74 08                	je     8058f9 <getchar+0x32>
+  8058f1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8058f5:	89 d0                	mov    %edx,%eax
+  8058f7:	c9                   	leave
+  8058f8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8058f9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8058fe:	eb f5                	jmp    8058f5 <getchar+0x2e>
+
+0000000000805900 <iscons>:
+iscons(int fdnum) {
+  805900:	55                   	push   %rbp
+  805901:	48 89 e5             	mov    %rsp,%rbp
+  805904:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805908:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80590c:	48 b8 6a 36 80 00 00 	movabs $0x80366a,%rax
+  805913:	00 00 00 
+  805916:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805918:	85 c0                	test   %eax,%eax
+  80591a:	78 18                	js     805934 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80591c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805920:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805927:	00 00 00 
+  80592a:	8b 00                	mov    (%rax),%eax
+  80592c:	39 02                	cmp    %eax,(%rdx)
+  80592e:	0f 94 c0             	sete   %al
+  805931:	0f b6 c0             	movzbl %al,%eax
+}
+  805934:	c9                   	leave
+  805935:	c3                   	ret
+
+0000000000805936 <opencons>:
+opencons(void) {
+  805936:	55                   	push   %rbp
+  805937:	48 89 e5             	mov    %rsp,%rbp
+  80593a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80593e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805942:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  805949:	00 00 00 
+  80594c:	ff d0                	call   *%rax
+  80594e:	85 c0                	test   %eax,%eax
+  805950:	78 49                	js     80599b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805952:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805957:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80595c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805960:	bf 00 00 00 00       	mov    $0x0,%edi
+  805965:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  80596c:	00 00 00 
+  80596f:	ff d0                	call   *%rax
+  805971:	85 c0                	test   %eax,%eax
+  805973:	78 26                	js     80599b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805975:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805979:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805980:	00 00 
+  805982:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805984:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805988:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80598f:	48 b8 dc 35 80 00 00 	movabs $0x8035dc,%rax
+  805996:	00 00 00 
+  805999:	ff d0                	call   *%rax
+}
+  80599b:	c9                   	leave
+  80599c:	c3                   	ret
+
+000000000080599d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80599d:	55                   	push   %rbp
+  80599e:	48 89 e5             	mov    %rsp,%rbp
+  8059a1:	41 56                	push   %r14
+  8059a3:	41 55                	push   %r13
+  8059a5:	41 54                	push   %r12
+  8059a7:	53                   	push   %rbx
+  8059a8:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8059ab:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8059b2:	00 00 00 
+  8059b5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8059b9:	74 27                	je     8059e2 <_handle_vectored_pagefault+0x45>
+  8059bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8059c0:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8059c7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8059ca:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8059cd:	4c 89 e7             	mov    %r12,%rdi
+  8059d0:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8059d5:	84 c0                	test   %al,%al
+  8059d7:	75 45                	jne    805a1e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8059d9:	48 83 c3 01          	add    $0x1,%rbx
+  8059dd:	49 3b 1e             	cmp    (%r14),%rbx
+  8059e0:	72 eb                	jb     8059cd <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8059e2:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8059e9:	00 
+  8059ea:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8059ef:	4d 8b 04 24          	mov    (%r12),%r8
+  8059f3:	48 ba 28 6a 80 00 00 	movabs $0x806a28,%rdx
+  8059fa:	00 00 00 
+  8059fd:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805a02:	48 bf 58 6a 80 00 00 	movabs $0x806a58,%rdi
+  805a09:	00 00 00 
+  805a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a11:	49 ba 5e 19 80 00 00 	movabs $0x80195e,%r10
+  805a18:	00 00 00 
+  805a1b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805a1e:	5b                   	pop    %rbx
+  805a1f:	41 5c                	pop    %r12
+  805a21:	41 5d                	pop    %r13
+  805a23:	41 5e                	pop    %r14
+  805a25:	5d                   	pop    %rbp
+  805a26:	c3                   	ret
+
+0000000000805a27 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805a27:	55                   	push   %rbp
+  805a28:	48 89 e5             	mov    %rsp,%rbp
+  805a2b:	53                   	push   %rbx
+  805a2c:	48 83 ec 08          	sub    $0x8,%rsp
+  805a30:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805a33:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805a38:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805a3f:	00 00 00 
+  805a42:	80 38 00             	cmpb   $0x0,(%rax)
+  805a45:	74 68                	je     805aaf <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a47:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805a4e:	00 00 00 
+  805a51:	48 8b 08             	mov    (%rax),%rcx
+  805a54:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805a59:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805a60:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a63:	48 85 c9             	test   %rcx,%rcx
+  805a66:	0f 84 e0 00 00 00    	je     805b4c <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805a6c:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805a70:	0f 84 c9 00 00 00    	je     805b3f <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a76:	48 83 c2 01          	add    $0x1,%rdx
+  805a7a:	48 39 ca             	cmp    %rcx,%rdx
+  805a7d:	75 ed                	jne    805a6c <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805a7f:	48 83 f9 08          	cmp    $0x8,%rcx
+  805a83:	0f 84 84 00 00 00    	je     805b0d <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805a89:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805a8d:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805a94:	00 00 00 
+  805a97:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805a9e:	00 00 00 
+  805aa1:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805aa5:	85 f6                	test   %esi,%esi
+  805aa7:	0f 89 97 00 00 00    	jns    805b44 <add_pgfault_handler+0x11d>
+  805aad:	eb 63                	jmp    805b12 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805aaf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805ab4:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805ab9:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805ac0:	00 00 00 
+  805ac3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ac8:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  805acf:	00 00 00 
+  805ad2:	ff d0                	call   *%rax
+  805ad4:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805ad6:	85 c0                	test   %eax,%eax
+  805ad8:	78 38                	js     805b12 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805ada:	48 be 28 5c 80 00 00 	movabs $0x805c28,%rsi
+  805ae1:	00 00 00 
+  805ae4:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ae9:	48 b8 6d 2d 80 00 00 	movabs $0x802d6d,%rax
+  805af0:	00 00 00 
+  805af3:	ff d0                	call   *%rax
+  805af5:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805af7:	85 c0                	test   %eax,%eax
+  805af9:	78 17                	js     805b12 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805afb:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805b02:	00 00 00 
+  805b05:	c6 00 01             	movb   $0x1,(%rax)
+  805b08:	e9 3a ff ff ff       	jmp    805a47 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805b0d:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805b12:	89 f1                	mov    %esi,%ecx
+  805b14:	48 ba 66 6a 80 00 00 	movabs $0x806a66,%rdx
+  805b1b:	00 00 00 
+  805b1e:	be 42 00 00 00       	mov    $0x42,%esi
+  805b23:	48 bf 58 6a 80 00 00 	movabs $0x806a58,%rdi
+  805b2a:	00 00 00 
+  805b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b32:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  805b39:	00 00 00 
+  805b3c:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805b3f:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805b44:	89 f0                	mov    %esi,%eax
+  805b46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805b4a:	c9                   	leave
+  805b4b:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805b4c:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805b53:	00 00 00 
+  805b56:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805b5d:	48 89 d8             	mov    %rbx,%rax
+  805b60:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805b67:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805b6a:	eb d8                	jmp    805b44 <add_pgfault_handler+0x11d>
+
+0000000000805b6c <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805b6c:	55                   	push   %rbp
+  805b6d:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805b70:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805b77:	00 00 00 
+  805b7a:	80 38 00             	cmpb   $0x0,(%rax)
+  805b7d:	74 33                	je     805bb2 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805b7f:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805b86:	00 00 00 
+  805b89:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805b8e:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805b95:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805b98:	48 85 c0             	test   %rax,%rax
+  805b9b:	0f 84 85 00 00 00    	je     805c26 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805ba1:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805ba5:	74 40                	je     805be7 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805ba7:	48 83 c1 01          	add    $0x1,%rcx
+  805bab:	48 39 c1             	cmp    %rax,%rcx
+  805bae:	75 f1                	jne    805ba1 <remove_pgfault_handler+0x35>
+  805bb0:	eb 74                	jmp    805c26 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805bb2:	48 b9 7e 6a 80 00 00 	movabs $0x806a7e,%rcx
+  805bb9:	00 00 00 
+  805bbc:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  805bc3:	00 00 00 
+  805bc6:	be 48 00 00 00       	mov    $0x48,%esi
+  805bcb:	48 bf 58 6a 80 00 00 	movabs $0x806a58,%rdi
+  805bd2:	00 00 00 
+  805bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bda:	49 b8 5e 19 80 00 00 	movabs $0x80195e,%r8
+  805be1:	00 00 00 
+  805be4:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805be7:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805bee:	00 
+  805bef:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805bf3:	48 29 ca             	sub    %rcx,%rdx
+  805bf6:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805bfd:	00 00 00 
+  805c00:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805c04:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805c09:	48 89 ce             	mov    %rcx,%rsi
+  805c0c:	48 b8 35 27 80 00 00 	movabs $0x802735,%rax
+  805c13:	00 00 00 
+  805c16:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805c18:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805c1f:	00 00 00 
+  805c22:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805c26:	5d                   	pop    %rbp
+  805c27:	c3                   	ret
+
+0000000000805c28 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805c28:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805c2b:	48 b8 9d 59 80 00 00 	movabs $0x80599d,%rax
+  805c32:	00 00 00 
+    call *%rax
+  805c35:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805c37:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805c3e:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805c3f:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805c46:	00 
+    subq $8, %rcx
+  805c47:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805c4b:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805c4e:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805c55:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805c56:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805c5a:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805c5e:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805c63:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805c68:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805c6d:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805c72:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805c77:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805c7c:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805c81:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805c86:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805c8b:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805c90:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805c95:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805c9a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805c9f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805ca4:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805ca8:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805cac:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805cad:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805cae:	c3                   	ret
+  805caf:	90                   	nop
+
+0000000000805cb0 <__rodata_start>:
+  805cb0:	77 00                	ja     805cb2 <__rodata_start+0x2>
+  805cb2:	72 62                	jb     805d16 <__rodata_start+0x66>
+  805cb4:	00 77 62             	add    %dh,0x62(%rdi)
+  805cb7:	00 0f                	add    %cl,(%rdi)
+  805cb9:	1f                   	(bad)
+  805cba:	84 00                	test   %al,(%rax)
+  805cbc:	00 00                	add    %al,(%rax)
+  805cbe:	00 00                	add    %al,(%rax)
+  805cc0:	b3 09                	mov    $0x9,%bl
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 ed                	add    %ch,%ch
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	ed                   	in     (%dx),%eax
+  805cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	ed                   	in     (%dx),%eax
+  805cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cde:	00 00                	add    %al,(%rax)
+  805ce0:	ed                   	in     (%dx),%eax
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 ed                	add    %ch,%ch
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	8c 0a                	mov    %cs,(%rdx)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	8c 0a                	mov    %cs,(%rdx)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	8c 0a                	mov    %cs,(%rdx)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	8c 0a                	mov    %cs,(%rdx)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	8c 0a                	mov    %cs,(%rdx)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	ed                   	in     (%dx),%eax
+  805d71:	0d 80 00 00 00       	or     $0x80,%eax
+  805d76:	00 00                	add    %al,(%rax)
+  805d78:	ed                   	in     (%dx),%eax
+  805d79:	0d 80 00 00 00       	or     $0x80,%eax
+  805d7e:	00 00                	add    %al,(%rax)
+  805d80:	ed                   	in     (%dx),%eax
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	ed                   	in     (%dx),%eax
+  805d91:	0d 80 00 00 00       	or     $0x80,%eax
+  805d96:	00 00                	add    %al,(%rax)
+  805d98:	ed                   	in     (%dx),%eax
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ed                   	in     (%dx),%eax
+  805da1:	0d 80 00 00 00       	or     $0x80,%eax
+  805da6:	00 00                	add    %al,(%rax)
+  805da8:	ed                   	in     (%dx),%eax
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	ed                   	in     (%dx),%eax
+  805db9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dbe:	00 00                	add    %al,(%rax)
+  805dc0:	ed                   	in     (%dx),%eax
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	ed                   	in     (%dx),%eax
+  805dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dce:	00 00                	add    %al,(%rax)
+  805dd0:	ed                   	in     (%dx),%eax
+  805dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dd6:	00 00                	add    %al,(%rax)
+  805dd8:	ed                   	in     (%dx),%eax
+  805dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dde:	00 00                	add    %al,(%rax)
+  805de0:	ed                   	in     (%dx),%eax
+  805de1:	0d 80 00 00 00       	or     $0x80,%eax
+  805de6:	00 00                	add    %al,(%rax)
+  805de8:	ed                   	in     (%dx),%eax
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	ed                   	in     (%dx),%eax
+  805df1:	0d 80 00 00 00       	or     $0x80,%eax
+  805df6:	00 00                	add    %al,(%rax)
+  805df8:	ed                   	in     (%dx),%eax
+  805df9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dfe:	00 00                	add    %al,(%rax)
+  805e00:	ed                   	in     (%dx),%eax
+  805e01:	0d 80 00 00 00       	or     $0x80,%eax
+  805e06:	00 00                	add    %al,(%rax)
+  805e08:	ed                   	in     (%dx),%eax
+  805e09:	0d 80 00 00 00       	or     $0x80,%eax
+  805e0e:	00 00                	add    %al,(%rax)
+  805e10:	ed                   	in     (%dx),%eax
+  805e11:	0d 80 00 00 00       	or     $0x80,%eax
+  805e16:	00 00                	add    %al,(%rax)
+  805e18:	ed                   	in     (%dx),%eax
+  805e19:	0d 80 00 00 00       	or     $0x80,%eax
+  805e1e:	00 00                	add    %al,(%rax)
+  805e20:	ed                   	in     (%dx),%eax
+  805e21:	0d 80 00 00 00       	or     $0x80,%eax
+  805e26:	00 00                	add    %al,(%rax)
+  805e28:	ed                   	in     (%dx),%eax
+  805e29:	0d 80 00 00 00       	or     $0x80,%eax
+  805e2e:	00 00                	add    %al,(%rax)
+  805e30:	ed                   	in     (%dx),%eax
+  805e31:	0d 80 00 00 00       	or     $0x80,%eax
+  805e36:	00 00                	add    %al,(%rax)
+  805e38:	ed                   	in     (%dx),%eax
+  805e39:	0d 80 00 00 00       	or     $0x80,%eax
+  805e3e:	00 00                	add    %al,(%rax)
+  805e40:	ed                   	in     (%dx),%eax
+  805e41:	0d 80 00 00 00       	or     $0x80,%eax
+  805e46:	00 00                	add    %al,(%rax)
+  805e48:	ed                   	in     (%dx),%eax
+  805e49:	0d 80 00 00 00       	or     $0x80,%eax
+  805e4e:	00 00                	add    %al,(%rax)
+  805e50:	ed                   	in     (%dx),%eax
+  805e51:	0d 80 00 00 00       	or     $0x80,%eax
+  805e56:	00 00                	add    %al,(%rax)
+  805e58:	f4                   	hlt
+  805e59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e5f:	00 ed                	add    %ch,%ch
+  805e61:	0d 80 00 00 00       	or     $0x80,%eax
+  805e66:	00 00                	add    %al,(%rax)
+  805e68:	ed                   	in     (%dx),%eax
+  805e69:	0d 80 00 00 00       	or     $0x80,%eax
+  805e6e:	00 00                	add    %al,(%rax)
+  805e70:	2c 0b                	sub    $0xb,%al
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 ed                	add    %ch,%ch
+  805e79:	0d 80 00 00 00       	or     $0x80,%eax
+  805e7e:	00 00                	add    %al,(%rax)
+  805e80:	ed                   	in     (%dx),%eax
+  805e81:	0d 80 00 00 00       	or     $0x80,%eax
+  805e86:	00 00                	add    %al,(%rax)
+  805e88:	ed                   	in     (%dx),%eax
+  805e89:	0d 80 00 00 00       	or     $0x80,%eax
+  805e8e:	00 00                	add    %al,(%rax)
+  805e90:	ed                   	in     (%dx),%eax
+  805e91:	0d 80 00 00 00       	or     $0x80,%eax
+  805e96:	00 00                	add    %al,(%rax)
+  805e98:	ed                   	in     (%dx),%eax
+  805e99:	0d 80 00 00 00       	or     $0x80,%eax
+  805e9e:	00 00                	add    %al,(%rax)
+  805ea0:	ed                   	in     (%dx),%eax
+  805ea1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ea6:	00 00                	add    %al,(%rax)
+  805ea8:	ed                   	in     (%dx),%eax
+  805ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eae:	00 00                	add    %al,(%rax)
+  805eb0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805eb3:	00 00                	add    %al,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 cb                	add    %cl,%bl
+  805eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ebe:	00 00                	add    %al,(%rax)
+  805ec0:	ed                   	in     (%dx),%eax
+  805ec1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ec6:	00 00                	add    %al,(%rax)
+  805ec8:	ed                   	in     (%dx),%eax
+  805ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ece:	00 00                	add    %al,(%rax)
+  805ed0:	ed                   	in     (%dx),%eax
+  805ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ed6:	00 00                	add    %al,(%rax)
+  805ed8:	6a 0a                	push   $0xa
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 ed                	add    %ch,%ch
+  805ee9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eee:	00 00                	add    %al,(%rax)
+  805ef0:	ed                   	in     (%dx),%eax
+  805ef1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ef6:	00 00                	add    %al,(%rax)
+  805ef8:	3c 0a                	cmp    $0xa,%al
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 ed                	add    %ch,%ch
+  805f01:	0d 80 00 00 00       	or     $0x80,%eax
+  805f06:	00 00                	add    %al,(%rax)
+  805f08:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805f0b:	00 00                	add    %al,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805f15:	00 00                	add    %al,(%rax)
+  805f17:	00 29                	add    %ch,(%rcx)
+  805f19:	0c 80                	or     $0x80,%al
+  805f1b:	00 00                	add    %al,(%rax)
+  805f1d:	00 00                	add    %al,(%rax)
+  805f1f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 ed                	add    %ch,%ch
+  805f29:	0d 80 00 00 00       	or     $0x80,%eax
+  805f2e:	00 00                	add    %al,(%rax)
+  805f30:	1a 0b                	sbb    (%rbx),%cl
+  805f32:	80 00 00             	addb   $0x0,(%rax)
+  805f35:	00 00                	add    %al,(%rax)
+  805f37:	00 ed                	add    %ch,%ch
+  805f39:	0d 80 00 00 00       	or     $0x80,%eax
+  805f3e:	00 00                	add    %al,(%rax)
+  805f40:	ce                   	(bad)
+  805f41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805f47:	00 ed                	add    %ch,%ch
+  805f49:	0d 80 00 00 00       	or     $0x80,%eax
+  805f4e:	00 00                	add    %al,(%rax)
+  805f50:	ed                   	in     (%dx),%eax
+  805f51:	0d 80 00 00 00       	or     $0x80,%eax
+  805f56:	00 00                	add    %al,(%rax)
+  805f58:	f4                   	hlt
+  805f59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805f5f:	00 37                	add    %dh,(%rdi)
+  805f61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 37                	add    %dh,(%rdi)
+  805f71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805f8b:	00 00                	add    %al,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 d2                	add    %dl,%dl
+  805f91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f97:	00 d2                	add    %dl,%dl
+  805f99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f9f:	00 d2                	add    %dl,%dl
+  805fa1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fa7:	00 d2                	add    %dl,%dl
+  805fa9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805faf:	00 d2                	add    %dl,%dl
+  805fb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fb7:	00 d2                	add    %dl,%dl
+  805fb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fbf:	00 d2                	add    %dl,%dl
+  805fc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fc7:	00 f6                	add    %dh,%dh
+  805fc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fcf:	00 f6                	add    %dh,%dh
+  805fd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ffa:	80 00 00             	addb   $0x0,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 22                	add    %ah,(%rdx)
+  806011:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806017:	00 22                	add    %ah,(%rdx)
+  806019:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80601f:	00 22                	add    %ah,(%rdx)
+  806021:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806027:	00 22                	add    %ah,(%rdx)
+  806029:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80602f:	00 22                	add    %ah,(%rdx)
+  806031:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806037:	00 22                	add    %ah,(%rdx)
+  806039:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80603f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806042:	80 00 00             	addb   $0x0,(%rax)
+  806045:	00 00                	add    %al,(%rax)
+  806047:	00 5f 12             	add    %bl,0x12(%rdi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806052:	80 00 00             	addb   $0x0,(%rax)
+  806055:	00 00                	add    %al,(%rax)
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 5f 12             	add    %bl,0x12(%rdi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806092:	80 00 00             	addb   $0x0,(%rax)
+  806095:	00 00                	add    %al,(%rax)
+  806097:	00 5f 12             	add    %bl,0x12(%rdi)
+  80609a:	80 00 00             	addb   $0x0,(%rax)
+  80609d:	00 00                	add    %al,(%rax)
+  80609f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060a2:	80 00 00             	addb   $0x0,(%rax)
+  8060a5:	00 00                	add    %al,(%rax)
+  8060a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060aa:	80 00 00             	addb   $0x0,(%rax)
+  8060ad:	00 00                	add    %al,(%rax)
+  8060af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060b2:	80 00 00             	addb   $0x0,(%rax)
+  8060b5:	00 00                	add    %al,(%rax)
+  8060b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ba:	80 00 00             	addb   $0x0,(%rax)
+  8060bd:	00 00                	add    %al,(%rax)
+  8060bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060c2:	80 00 00             	addb   $0x0,(%rax)
+  8060c5:	00 00                	add    %al,(%rax)
+  8060c7:	00 46 12             	add    %al,0x12(%rsi)
+  8060ca:	80 00 00             	addb   $0x0,(%rax)
+  8060cd:	00 00                	add    %al,(%rax)
+  8060cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060d2:	80 00 00             	addb   $0x0,(%rax)
+  8060d5:	00 00                	add    %al,(%rax)
+  8060d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060da:	80 00 00             	addb   $0x0,(%rax)
+  8060dd:	00 00                	add    %al,(%rax)
+  8060df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060e2:	80 00 00             	addb   $0x0,(%rax)
+  8060e5:	00 00                	add    %al,(%rax)
+  8060e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ea:	80 00 00             	addb   $0x0,(%rax)
+  8060ed:	00 00                	add    %al,(%rax)
+  8060ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060f2:	80 00 00             	addb   $0x0,(%rax)
+  8060f5:	00 00                	add    %al,(%rax)
+  8060f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060fa:	80 00 00             	addb   $0x0,(%rax)
+  8060fd:	00 00                	add    %al,(%rax)
+  8060ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806102:	80 00 00             	addb   $0x0,(%rax)
+  806105:	00 00                	add    %al,(%rax)
+  806107:	00 5f 12             	add    %bl,0x12(%rdi)
+  80610a:	80 00 00             	addb   $0x0,(%rax)
+  80610d:	00 00                	add    %al,(%rax)
+  80610f:	00 22                	add    %ah,(%rdx)
+  806111:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806117:	00 22                	add    %ah,(%rdx)
+  806119:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80611f:	00 22                	add    %ah,(%rdx)
+  806121:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806127:	00 22                	add    %ah,(%rdx)
+  806129:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80612f:	00 22                	add    %ah,(%rdx)
+  806131:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806137:	00 22                	add    %ah,(%rdx)
+  806139:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80613f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806142:	80 00 00             	addb   $0x0,(%rax)
+  806145:	00 00                	add    %al,(%rax)
+  806147:	00 5f 12             	add    %bl,0x12(%rdi)
+  80614a:	80 00 00             	addb   $0x0,(%rax)
+  80614d:	00 00                	add    %al,(%rax)
+  80614f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806152:	80 00 00             	addb   $0x0,(%rax)
+  806155:	00 00                	add    %al,(%rax)
+  806157:	00 5f 12             	add    %bl,0x12(%rdi)
+  80615a:	80 00 00             	addb   $0x0,(%rax)
+  80615d:	00 00                	add    %al,(%rax)
+  80615f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806162:	80 00 00             	addb   $0x0,(%rax)
+  806165:	00 00                	add    %al,(%rax)
+  806167:	00 5f 12             	add    %bl,0x12(%rdi)
+  80616a:	80 00 00             	addb   $0x0,(%rax)
+  80616d:	00 00                	add    %al,(%rax)
+  80616f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806172:	80 00 00             	addb   $0x0,(%rax)
+  806175:	00 00                	add    %al,(%rax)
+  806177:	00 5f 12             	add    %bl,0x12(%rdi)
+  80617a:	80 00 00             	addb   $0x0,(%rax)
+  80617d:	00 00                	add    %al,(%rax)
+  80617f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806182:	80 00 00             	addb   $0x0,(%rax)
+  806185:	00 00                	add    %al,(%rax)
+  806187:	00 5f 12             	add    %bl,0x12(%rdi)
+  80618a:	80 00 00             	addb   $0x0,(%rax)
+  80618d:	00 00                	add    %al,(%rax)
+  80618f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806192:	80 00 00             	addb   $0x0,(%rax)
+  806195:	00 00                	add    %al,(%rax)
+  806197:	00 5f 12             	add    %bl,0x12(%rdi)
+  80619a:	80 00 00             	addb   $0x0,(%rax)
+  80619d:	00 00                	add    %al,(%rax)
+  80619f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061a2:	80 00 00             	addb   $0x0,(%rax)
+  8061a5:	00 00                	add    %al,(%rax)
+  8061a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061aa:	80 00 00             	addb   $0x0,(%rax)
+  8061ad:	00 00                	add    %al,(%rax)
+  8061af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061b2:	80 00 00             	addb   $0x0,(%rax)
+  8061b5:	00 00                	add    %al,(%rax)
+  8061b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061ba:	80 00 00             	addb   $0x0,(%rax)
+  8061bd:	00 00                	add    %al,(%rax)
+  8061bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061c2:	80 00 00             	addb   $0x0,(%rax)
+  8061c5:	00 00                	add    %al,(%rax)
+  8061c7:	00 46 12             	add    %al,0x12(%rsi)
+  8061ca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+00000000008061e0 <basefix.0>:
+  8061e0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  8061f0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806200:	10 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65     ..sys_ipc_try_se
+  806210:	6e 64 3a 20 25 69 00 75 73 65 72 2f 69 70 63 62     nd: %i.user/ipcb
+  806220:	65 6e 63 68 2e 63 00 72 6f 75 6e 64 20 74 72 69     ench.c.round tri
+  806230:	70 20 25 6c 64 20 69 73 20 6c 6f 73 74 00 74 72     p %ld is lost.tr
+  806240:	79 5f 73 65 6e 64 00 90 69 70 63 62 65 6e 63 68     y_send..ipcbench
+  806250:	3a 20 25 2d 31 30 73 20 25 6c 64 20 72 6f 75 6e     : %-10s %ld roun
+  806260:	64 20 74 72 69 70 73 20 69 6e 20 25 75 20 6d 73     d trips in %u ms
+  806270:	20 28 25 6c 64 2f 73 29 0a 00 3c 75 6e 6b 6e 6f      (%ld/s)..<unkno
+  806280:	77 6e 3e 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75     wn>...@.[%08x] u
+  806290:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8062a0:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  8062b0:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  8062c0:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  8062d0:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  8062e0:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  8062f0:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  806300:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  806310:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  806320:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  806330:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  806340:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  806350:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  806360:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  806370:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  806380:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  806390:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  8063a0:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  8063b0:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  8063c0:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  8063d0:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  8063e0:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  8063f0:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  806400:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  806410:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  806420:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  806430:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  806440:	a6 1c 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ........."......
+  806450:	ed 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806460:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806470:	fd 22 80 00 00 00 00 00 c5 1c 80 00 00 00 00 00     ."..............
+  806480:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806490:	b9 1c 80 00 00 00 00 00 33 1d 80 00 00 00 00 00     ........3.......
+  8064a0:	fd 22 80 00 00 00 00 00 b9 1c 80 00 00 00 00 00     ."..............
+  8064b0:	ff 1c 80 00 00 00 00 00 ff 1c 80 00 00 00 00 00     ................
+  8064c0:	ff 1c 80 00 00 00 00 00 ff 1c 80 00 00 00 00 00     ................
+  8064d0:	ff 1c 80 00 00 00 00 00 ff 1c 80 00 00 00 00 00     ................
+  8064e0:	ff 1c 80 00 00 00 00 00 ff 1c 80 00 00 00 00 00     ................
+  8064f0:	ff 1c 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ........."......
+  806500:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806510:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806520:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806530:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806540:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806550:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806560:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806570:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806580:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806590:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  8065a0:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  8065b0:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  8065c0:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  8065d0:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  8065e0:	fd 22 80 00 00 00 00 00 1b 22 80 00 00 00 00 00     ."......."......
+  8065f0:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806600:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806610:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806620:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806630:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806640:	61 1d 80 00 00 00 00 00 30 1f 80 00 00 00 00 00     a.......0.......
+  806650:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  806660:	fd 22 80 00 00 00 00 00 56 1d 80 00 00 00 00 00     ."......V.......
+  806670:	90 1d 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ........."......
+  806680:	fd 22 80 00 00 00 00 00 4b 1d 80 00 00 00 00 00     ."......K.......
+  806690:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  8066a0:	d9 20 80 00 00 00 00 00 a8 21 80 00 00 00 00 00     . .......!......
+  8066b0:	fd 22 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     ."......."......
+  8066c0:	27 1e 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     '........"......
+  8066d0:	04 20 80 00 00 00 00 00 fd 22 80 00 00 00 00 00     . ......."......
+  8066e0:	fd 22 80 00 00 00 00 00 1b 22 80 00 00 00 00 00     ."......."......
+  8066f0:	fd 22 80 00 00 00 00 00 af 1c 80 00 00 00 00 00     ."..............
+
+0000000000806700 <error_string>:
+	...
+  806708:	dd 62 80 00 00 00 00 00 ef 62 80 00 00 00 00 00     .b.......b......
+  806718:	ff 62 80 00 00 00 00 00 11 63 80 00 00 00 00 00     .b.......c......
+  806728:	1f 63 80 00 00 00 00 00 33 63 80 00 00 00 00 00     .c......3c......
+  806738:	48 63 80 00 00 00 00 00 5b 63 80 00 00 00 00 00     Hc......[c......
+  806748:	6d 63 80 00 00 00 00 00 81 63 80 00 00 00 00 00     mc.......c......
+  806758:	91 63 80 00 00 00 00 00 a4 63 80 00 00 00 00 00     .c.......c......
+  806768:	bb 63 80 00 00 00 00 00 d1 63 80 00 00 00 00 00     .c.......c......
+  806778:	e9 63 80 00 00 00 00 00 01 64 80 00 00 00 00 00     .c.......d......
+  806788:	0e 64 80 00 00 00 00 00 a0 67 80 00 00 00 00 00     .d.......g......
+  806798:	22 64 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     "d......file is 
+  8067a8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8067b8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8067c8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8067d8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8067e8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8067f8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806808:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806818:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806828:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806838:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806848:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806858:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806868:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 69     ult_upcall: %i.i
+  806878:	70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f     pc_send: %i.lib/
+  806888:	69 70 63 2e 63 00 66 90 5b 25 30 38 78 5d 20 75     ipc.c.f.[%08x] u
+  806898:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8068a8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8068b8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8068c8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8068d8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8068e8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8068f8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  806908:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806918:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806920 <devtab>:
+  806920:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806930:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806940:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806950:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806960:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806970:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806980:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806990:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8069a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8069b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8069c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8069d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8069e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  8069f0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  806a00:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  806a10:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  806a20:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  806a30:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806a40:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806a50:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806a60:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806a70:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806a80:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806a90:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  806aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
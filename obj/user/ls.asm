@@ -0,0 +1,10807 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 0b 27 80 00 00 	movabs $0x80270b,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 8c 25 80 00 00 	movabs $0x80258c,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 ce 1a 80 00 00 	movabs $0x801ace,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 1c 42 80 00 00 	movabs $0x80421c,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 9b 23 80 00 00 	movabs $0x80239b,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 1c 42 80 00 00 	movabs $0x80421c,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 9b 23 80 00 00 	movabs $0x80239b,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 bf 19 80 00 00 	movabs $0x8019bf,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be a7 62 80 00 00 	movabs $0x8062a7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 30 5c 80 00 00 	movabs $0x805c30,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 32 5c 80 00 00 	movabs $0x805c32,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 35 5c 80 00 00 	movabs $0x805c35,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 1a 50 80 00 00 	movabs $0x80501a,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 f1 52 80 00 00 	movabs $0x8052f1,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 99 35 80 00 00 	movabs $0x803599,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 30 39 80 00 00 	movabs $0x803930,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 f9 39 80 00 00 	movabs $0x8039f9,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 ff 38 80 00 00 	movabs $0x8038ff,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 ff 38 80 00 00 	movabs $0x8038ff,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 17 37 80 00 00 	movabs $0x803717,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 99 35 80 00 00 	movabs $0x803599,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb d8 26 80 00 00 	movabs $0x8026d8,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 5c 80 00 00 	movabs $0x805c40,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 0b 27 80 00 00 	movabs $0x80270b,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc d8 26 80 00 00 	movabs $0x8026d8,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 5e 80 00 00 	movabs $0x805ee0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf d8 26 80 00 00 	movabs $0x8026d8,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf d8 26 80 00 00 	movabs $0x8026d8,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 30 29 80 00 00 	movabs $0x802930,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 17 04 00 00       	call   801916 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <ls1>:
+    if (n < 0)
+        panic("error reading directory %s: %i", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 55                	push   %r13
+  801507:	41 54                	push   %r12
+  801509:	53                   	push   %rbx
+  80150a:	48 83 ec 08          	sub    $0x8,%rsp
+  80150e:	48 89 fb             	mov    %rdi,%rbx
+  801511:	41 89 f4             	mov    %esi,%r12d
+  801514:	49 89 cd             	mov    %rcx,%r13
+    const char *sep;
+
+    if (flag['l'])
+  801517:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  80151e:	00 00 00 
+  801521:	83 b8 b0 01 00 00 00 	cmpl   $0x0,0x1b0(%rax)
+  801528:	74 29                	je     801553 <ls1+0x52>
+  80152a:	89 d6                	mov    %edx,%esi
+        printf("%11d %c ", size, isdir ? 'd' : '-');
+  80152c:	41 80 fc 01          	cmp    $0x1,%r12b
+  801530:	19 d2                	sbb    %edx,%edx
+  801532:	83 e2 c9             	and    $0xffffffc9,%edx
+  801535:	83 c2 64             	add    $0x64,%edx
+  801538:	48 bf 84 61 80 00 00 	movabs $0x806184,%rdi
+  80153f:	00 00 00 
+  801542:	b8 00 00 00 00       	mov    $0x0,%eax
+  801547:	48 b9 e2 42 80 00 00 	movabs $0x8042e2,%rcx
+  80154e:	00 00 00 
+  801551:	ff d1                	call   *%rcx
+    if (prefix) {
+  801553:	48 85 db             	test   %rbx,%rbx
+  801556:	74 2d                	je     801585 <ls1+0x84>
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+            sep = "/";
+        else
+            sep = "";
+  801558:	48 ba ea 61 80 00 00 	movabs $0x8061ea,%rdx
+  80155f:	00 00 00 
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  801562:	80 3b 00             	cmpb   $0x0,(%rbx)
+  801565:	75 7a                	jne    8015e1 <ls1+0xe0>
+        printf("%s%s", prefix, sep);
+  801567:	48 89 de             	mov    %rbx,%rsi
+  80156a:	48 bf 8d 61 80 00 00 	movabs $0x80618d,%rdi
+  801571:	00 00 00 
+  801574:	b8 00 00 00 00       	mov    $0x0,%eax
+  801579:	48 b9 e2 42 80 00 00 	movabs $0x8042e2,%rcx
+  801580:	00 00 00 
+  801583:	ff d1                	call   *%rcx
+    }
+    printf("%s", name);
+  801585:	4c 89 ee             	mov    %r13,%rsi
+  801588:	48 bf 68 68 80 00 00 	movabs $0x806868,%rdi
+  80158f:	00 00 00 
+  801592:	b8 00 00 00 00       	mov    $0x0,%eax
+  801597:	48 ba e2 42 80 00 00 	movabs $0x8042e2,%rdx
+  80159e:	00 00 00 
+  8015a1:	ff d2                	call   *%rdx
+    if (flag['F'] && isdir)
+  8015a3:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  8015aa:	00 00 00 
+  8015ad:	83 b8 18 01 00 00 00 	cmpl   $0x0,0x118(%rax)
+  8015b4:	74 05                	je     8015bb <ls1+0xba>
+  8015b6:	45 84 e4             	test   %r12b,%r12b
+  8015b9:	75 57                	jne    801612 <ls1+0x111>
+        printf("/");
+    printf("\n");
+  8015bb:	48 bf e9 61 80 00 00 	movabs $0x8061e9,%rdi
+  8015c2:	00 00 00 
+  8015c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ca:	48 ba e2 42 80 00 00 	movabs $0x8042e2,%rdx
+  8015d1:	00 00 00 
+  8015d4:	ff d2                	call   *%rdx
+}
+  8015d6:	48 83 c4 08          	add    $0x8,%rsp
+  8015da:	5b                   	pop    %rbx
+  8015db:	41 5c                	pop    %r12
+  8015dd:	41 5d                	pop    %r13
+  8015df:	5d                   	pop    %rbp
+  8015e0:	c3                   	ret
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  8015e1:	48 89 df             	mov    %rbx,%rdi
+  8015e4:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  8015eb:	00 00 00 
+  8015ee:	ff d0                	call   *%rax
+            sep = "/";
+  8015f0:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%rbx,%rax,1)
+  8015f5:	48 ba ea 61 80 00 00 	movabs $0x8061ea,%rdx
+  8015fc:	00 00 00 
+  8015ff:	48 b8 82 61 80 00 00 	movabs $0x806182,%rax
+  801606:	00 00 00 
+  801609:	48 0f 45 d0          	cmovne %rax,%rdx
+  80160d:	e9 55 ff ff ff       	jmp    801567 <ls1+0x66>
+        printf("/");
+  801612:	48 bf 82 61 80 00 00 	movabs $0x806182,%rdi
+  801619:	00 00 00 
+  80161c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801621:	48 ba e2 42 80 00 00 	movabs $0x8042e2,%rdx
+  801628:	00 00 00 
+  80162b:	ff d2                	call   *%rdx
+  80162d:	eb 8c                	jmp    8015bb <ls1+0xba>
+
+000000000080162f <lsdir>:
+lsdir(const char *path, const char *prefix) {
+  80162f:	55                   	push   %rbp
+  801630:	48 89 e5             	mov    %rsp,%rbp
+  801633:	41 56                	push   %r14
+  801635:	41 55                	push   %r13
+  801637:	41 54                	push   %r12
+  801639:	53                   	push   %rbx
+  80163a:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  801641:	49 89 fd             	mov    %rdi,%r13
+  801644:	49 89 f6             	mov    %rsi,%r14
+    if ((fd = open(path, O_RDONLY)) < 0)
+  801647:	be 00 00 00 00       	mov    $0x0,%esi
+  80164c:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  801653:	00 00 00 
+  801656:	ff d0                	call   *%rax
+  801658:	89 c3                	mov    %eax,%ebx
+  80165a:	85 c0                	test   %eax,%eax
+  80165c:	78 58                	js     8016b6 <lsdir+0x87>
+    while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  80165e:	49 bc d5 37 80 00 00 	movabs $0x8037d5,%r12
+  801665:	00 00 00 
+  801668:	ba 00 01 00 00       	mov    $0x100,%edx
+  80166d:	48 8d b5 e0 fe ff ff 	lea    -0x120(%rbp),%rsi
+  801674:	89 df                	mov    %ebx,%edi
+  801676:	41 ff d4             	call   *%r12
+  801679:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80167e:	75 67                	jne    8016e7 <lsdir+0xb8>
+        if (f.f_name[0])
+  801680:	80 bd e0 fe ff ff 00 	cmpb   $0x0,-0x120(%rbp)
+  801687:	74 df                	je     801668 <lsdir+0x39>
+            ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  801689:	83 bd 64 ff ff ff 01 	cmpl   $0x1,-0x9c(%rbp)
+  801690:	40 0f 94 c6          	sete   %sil
+  801694:	40 0f b6 f6          	movzbl %sil,%esi
+  801698:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  80169f:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+  8016a5:	4c 89 f7             	mov    %r14,%rdi
+  8016a8:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016af:	00 00 00 
+  8016b2:	ff d0                	call   *%rax
+  8016b4:	eb b2                	jmp    801668 <lsdir+0x39>
+        panic("open %s: %i", path, fd);
+  8016b6:	41 89 c0             	mov    %eax,%r8d
+  8016b9:	4c 89 e9             	mov    %r13,%rcx
+  8016bc:	48 ba 92 61 80 00 00 	movabs $0x806192,%rdx
+  8016c3:	00 00 00 
+  8016c6:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8016cb:	48 bf 9e 61 80 00 00 	movabs $0x80619e,%rdi
+  8016d2:	00 00 00 
+  8016d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016da:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  8016e1:	00 00 00 
+  8016e4:	41 ff d1             	call   *%r9
+    if (n > 0)
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	7f 12                	jg     8016fd <lsdir+0xce>
+    if (n < 0)
+  8016eb:	78 3e                	js     80172b <lsdir+0xfc>
+}
+  8016ed:	48 81 c4 00 01 00 00 	add    $0x100,%rsp
+  8016f4:	5b                   	pop    %rbx
+  8016f5:	41 5c                	pop    %r12
+  8016f7:	41 5d                	pop    %r13
+  8016f9:	41 5e                	pop    %r14
+  8016fb:	5d                   	pop    %rbp
+  8016fc:	c3                   	ret
+        panic("short read in directory %s", path);
+  8016fd:	4c 89 e9             	mov    %r13,%rcx
+  801700:	48 ba a8 61 80 00 00 	movabs $0x8061a8,%rdx
+  801707:	00 00 00 
+  80170a:	be 20 00 00 00       	mov    $0x20,%esi
+  80170f:	48 bf 9e 61 80 00 00 	movabs $0x80619e,%rdi
+  801716:	00 00 00 
+  801719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171e:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  801725:	00 00 00 
+  801728:	41 ff d0             	call   *%r8
+        panic("error reading directory %s: %i", path, n);
+  80172b:	41 89 c0             	mov    %eax,%r8d
+  80172e:	4c 89 e9             	mov    %r13,%rcx
+  801731:	48 ba f0 61 80 00 00 	movabs $0x8061f0,%rdx
+  801738:	00 00 00 
+  80173b:	be 22 00 00 00       	mov    $0x22,%esi
+  801740:	48 bf 9e 61 80 00 00 	movabs $0x80619e,%rdi
+  801747:	00 00 00 
+  80174a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174f:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  801756:	00 00 00 
+  801759:	41 ff d1             	call   *%r9
+
+000000000080175c <ls>:
+ls(const char *path, const char *prefix) {
+  80175c:	55                   	push   %rbp
+  80175d:	48 89 e5             	mov    %rsp,%rbp
+  801760:	41 54                	push   %r12
+  801762:	53                   	push   %rbx
+  801763:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80176a:	48 89 fb             	mov    %rdi,%rbx
+  80176d:	49 89 f4             	mov    %rsi,%r12
+    if ((r = stat(path, &st)) < 0)
+  801770:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  801777:	48 b8 8e 3a 80 00 00 	movabs $0x803a8e,%rax
+  80177e:	00 00 00 
+  801781:	ff d0                	call   *%rax
+  801783:	85 c0                	test   %eax,%eax
+  801785:	78 47                	js     8017ce <ls+0x72>
+    if (st.st_isdir && !flag['d'])
+  801787:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	74 13                	je     8017a1 <ls+0x45>
+  80178e:	48 ba 20 80 80 01 00 	movabs $0x1808020,%rdx
+  801795:	00 00 00 
+  801798:	83 ba 90 01 00 00 00 	cmpl   $0x0,0x190(%rdx)
+  80179f:	74 5e                	je     8017ff <ls+0xa3>
+        ls1(0, st.st_isdir, st.st_size, path);
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	40 0f 95 c6          	setne  %sil
+  8017a7:	40 0f b6 f6          	movzbl %sil,%esi
+  8017ab:	48 89 d9             	mov    %rbx,%rcx
+  8017ae:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8017b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017b6:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+}
+  8017c2:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8017c9:	5b                   	pop    %rbx
+  8017ca:	41 5c                	pop    %r12
+  8017cc:	5d                   	pop    %rbp
+  8017cd:	c3                   	ret
+        panic("stat %s: %i", path, r);
+  8017ce:	41 89 c0             	mov    %eax,%r8d
+  8017d1:	48 89 d9             	mov    %rbx,%rcx
+  8017d4:	48 ba c3 61 80 00 00 	movabs $0x8061c3,%rdx
+  8017db:	00 00 00 
+  8017de:	be 0e 00 00 00       	mov    $0xe,%esi
+  8017e3:	48 bf 9e 61 80 00 00 	movabs $0x80619e,%rdi
+  8017ea:	00 00 00 
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f2:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  8017f9:	00 00 00 
+  8017fc:	41 ff d1             	call   *%r9
+        lsdir(path, prefix);
+  8017ff:	4c 89 e6             	mov    %r12,%rsi
+  801802:	48 89 df             	mov    %rbx,%rdi
+  801805:	48 b8 2f 16 80 00 00 	movabs $0x80162f,%rax
+  80180c:	00 00 00 
+  80180f:	ff d0                	call   *%rax
+  801811:	eb af                	jmp    8017c2 <ls+0x66>
+
+0000000000801813 <usage>:
+
+void
+usage(void) {
+  801813:	55                   	push   %rbp
+  801814:	48 89 e5             	mov    %rsp,%rbp
+    printf("usage: ls [-dFl] [file...]\n");
+  801817:	48 bf cf 61 80 00 00 	movabs $0x8061cf,%rdi
+  80181e:	00 00 00 
+  801821:	b8 00 00 00 00       	mov    $0x0,%eax
+  801826:	48 ba e2 42 80 00 00 	movabs $0x8042e2,%rdx
+  80182d:	00 00 00 
+  801830:	ff d2                	call   *%rdx
+    exit();
+  801832:	48 b8 bf 19 80 00 00 	movabs $0x8019bf,%rax
+  801839:	00 00 00 
+  80183c:	ff d0                	call   *%rax
+}
+  80183e:	5d                   	pop    %rbp
+  80183f:	c3                   	ret
+
+0000000000801840 <umain>:
+
+void
+umain(int argc, char **argv) {
+  801840:	55                   	push   %rbp
+  801841:	48 89 e5             	mov    %rsp,%rbp
+  801844:	41 57                	push   %r15
+  801846:	41 56                	push   %r14
+  801848:	41 55                	push   %r13
+  80184a:	41 54                	push   %r12
+  80184c:	53                   	push   %rbx
+  80184d:	48 83 ec 38          	sub    $0x38,%rsp
+  801851:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  801854:	49 89 f4             	mov    %rsi,%r12
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  801857:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80185b:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  80185f:	48 b8 2c 32 80 00 00 	movabs $0x80322c,%rax
+  801866:	00 00 00 
+  801869:	ff d0                	call   *%rax
+    while ((i = argnext(&args)) >= 0)
+  80186b:	49 bd 59 32 80 00 00 	movabs $0x803259,%r13
+  801872:	00 00 00 
+        case 'F':
+        case 'l':
+            flag[i]++;
+            break;
+        default:
+            usage();
+  801875:	49 bf 13 18 80 00 00 	movabs $0x801813,%r15
+  80187c:	00 00 00 
+        switch (i) {
+  80187f:	49 be 01 00 00 40 40 	movabs $0x4040000001,%r14
+  801886:	00 00 00 
+            flag[i]++;
+  801889:	48 bb 20 80 80 01 00 	movabs $0x1808020,%rbx
+  801890:	00 00 00 
+    while ((i = argnext(&args)) >= 0)
+  801893:	eb 06                	jmp    80189b <umain+0x5b>
+            flag[i]++;
+  801895:	48 98                	cltq
+  801897:	83 04 83 01          	addl   $0x1,(%rbx,%rax,4)
+    while ((i = argnext(&args)) >= 0)
+  80189b:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  80189f:	41 ff d5             	call   *%r13
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	78 13                	js     8018b9 <umain+0x79>
+        switch (i) {
+  8018a6:	8d 50 ba             	lea    -0x46(%rax),%edx
+  8018a9:	83 fa 26             	cmp    $0x26,%edx
+  8018ac:	77 06                	ja     8018b4 <umain+0x74>
+  8018ae:	49 0f a3 d6          	bt     %rdx,%r14
+  8018b2:	72 e1                	jb     801895 <umain+0x55>
+            usage();
+  8018b4:	41 ff d7             	call   *%r15
+  8018b7:	eb e2                	jmp    80189b <umain+0x5b>
+        }
+
+    if (argc == 1)
+  8018b9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8018bc:	83 f8 01             	cmp    $0x1,%eax
+  8018bf:	74 33                	je     8018f4 <umain+0xb4>
+        ls("/", "");
+    else {
+        for (i = 1; i < argc; i++)
+  8018c1:	bb 01 00 00 00       	mov    $0x1,%ebx
+            ls(argv[i], argv[i]);
+  8018c6:	49 bd 5c 17 80 00 00 	movabs $0x80175c,%r13
+  8018cd:	00 00 00 
+        for (i = 1; i < argc; i++)
+  8018d0:	7e 13                	jle    8018e5 <umain+0xa5>
+            ls(argv[i], argv[i]);
+  8018d2:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8018d6:	48 89 fe             	mov    %rdi,%rsi
+  8018d9:	41 ff d5             	call   *%r13
+        for (i = 1; i < argc; i++)
+  8018dc:	48 83 c3 01          	add    $0x1,%rbx
+  8018e0:	39 5d ac             	cmp    %ebx,-0x54(%rbp)
+  8018e3:	7f ed                	jg     8018d2 <umain+0x92>
+    }
+}
+  8018e5:	48 83 c4 38          	add    $0x38,%rsp
+  8018e9:	5b                   	pop    %rbx
+  8018ea:	41 5c                	pop    %r12
+  8018ec:	41 5d                	pop    %r13
+  8018ee:	41 5e                	pop    %r14
+  8018f0:	41 5f                	pop    %r15
+  8018f2:	5d                   	pop    %rbp
+  8018f3:	c3                   	ret
+        ls("/", "");
+  8018f4:	48 be ea 61 80 00 00 	movabs $0x8061ea,%rsi
+  8018fb:	00 00 00 
+  8018fe:	48 bf 82 61 80 00 00 	movabs $0x806182,%rdi
+  801905:	00 00 00 
+  801908:	48 b8 5c 17 80 00 00 	movabs $0x80175c,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+  801914:	eb cf                	jmp    8018e5 <umain+0xa5>
+
+0000000000801916 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801916:	55                   	push   %rbp
+  801917:	48 89 e5             	mov    %rsp,%rbp
+  80191a:	41 56                	push   %r14
+  80191c:	41 55                	push   %r13
+  80191e:	41 54                	push   %r12
+  801920:	53                   	push   %rbx
+  801921:	41 89 fd             	mov    %edi,%r13d
+  801924:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801927:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80192e:	00 00 00 
+  801931:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801938:	00 00 00 
+  80193b:	48 39 c2             	cmp    %rax,%rdx
+  80193e:	73 17                	jae    801957 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801940:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801943:	49 89 c4             	mov    %rax,%r12
+  801946:	48 83 c3 08          	add    $0x8,%rbx
+  80194a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194f:	ff 53 f8             	call   *-0x8(%rbx)
+  801952:	4c 39 e3             	cmp    %r12,%rbx
+  801955:	72 ef                	jb     801946 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801957:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  80195e:	00 00 00 
+  801961:	ff d0                	call   *%rax
+  801963:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801968:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80196f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801976:	00 00 00 
+  801979:	48 01 d0             	add    %rdx,%rax
+  80197c:	48 a3 20 84 80 01 00 	movabs %rax,0x1808420
+  801983:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801986:	45 85 ed             	test   %r13d,%r13d
+  801989:	7e 0d                	jle    801998 <libmain+0x82>
+  80198b:	49 8b 06             	mov    (%r14),%rax
+  80198e:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801995:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801998:	4c 89 f6             	mov    %r14,%rsi
+  80199b:	44 89 ef             	mov    %r13d,%edi
+  80199e:	48 b8 40 18 80 00 00 	movabs $0x801840,%rax
+  8019a5:	00 00 00 
+  8019a8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8019aa:	48 b8 bf 19 80 00 00 	movabs $0x8019bf,%rax
+  8019b1:	00 00 00 
+  8019b4:	ff d0                	call   *%rax
+#endif
+}
+  8019b6:	5b                   	pop    %rbx
+  8019b7:	41 5c                	pop    %r12
+  8019b9:	41 5d                	pop    %r13
+  8019bb:	41 5e                	pop    %r14
+  8019bd:	5d                   	pop    %rbp
+  8019be:	c3                   	ret
+
+00000000008019bf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8019bf:	55                   	push   %rbp
+  8019c0:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8019c3:	48 b8 cc 35 80 00 00 	movabs $0x8035cc,%rax
+  8019ca:	00 00 00 
+  8019cd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8019cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019d4:	48 b8 85 2a 80 00 00 	movabs $0x802a85,%rax
+  8019db:	00 00 00 
+  8019de:	ff d0                	call   *%rax
+}
+  8019e0:	5d                   	pop    %rbp
+  8019e1:	c3                   	ret
+
+00000000008019e2 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	41 56                	push   %r14
+  8019e8:	41 55                	push   %r13
+  8019ea:	41 54                	push   %r12
+  8019ec:	53                   	push   %rbx
+  8019ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8019f1:	49 89 fc             	mov    %rdi,%r12
+  8019f4:	41 89 f5             	mov    %esi,%r13d
+  8019f7:	48 89 d3             	mov    %rdx,%rbx
+  8019fa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019fe:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801a02:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801a06:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801a0d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a11:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801a15:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801a19:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801a1d:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801a24:	00 00 00 
+  801a27:	4c 8b 30             	mov    (%rax),%r14
+  801a2a:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+  801a36:	89 c6                	mov    %eax,%esi
+  801a38:	45 89 e8             	mov    %r13d,%r8d
+  801a3b:	4c 89 e1             	mov    %r12,%rcx
+  801a3e:	4c 89 f2             	mov    %r14,%rdx
+  801a41:	48 bf 20 62 80 00 00 	movabs $0x806220,%rdi
+  801a48:	00 00 00 
+  801a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a50:	49 bc 32 1b 80 00 00 	movabs $0x801b32,%r12
+  801a57:	00 00 00 
+  801a5a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801a5d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801a61:	48 89 df             	mov    %rbx,%rdi
+  801a64:	48 b8 ce 1a 80 00 00 	movabs $0x801ace,%rax
+  801a6b:	00 00 00 
+  801a6e:	ff d0                	call   *%rax
+    cprintf("\n");
+  801a70:	48 bf e9 61 80 00 00 	movabs $0x8061e9,%rdi
+  801a77:	00 00 00 
+  801a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801a82:	cc                   	int3
+  801a83:	eb fd                	jmp    801a82 <_panic+0xa0>
+
+0000000000801a85 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801a85:	55                   	push   %rbp
+  801a86:	48 89 e5             	mov    %rsp,%rbp
+  801a89:	53                   	push   %rbx
+  801a8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801a8e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801a91:	8b 06                	mov    (%rsi),%eax
+  801a93:	8d 50 01             	lea    0x1(%rax),%edx
+  801a96:	89 16                	mov    %edx,(%rsi)
+  801a98:	48 98                	cltq
+  801a9a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801a9f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801aa5:	74 0a                	je     801ab1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801aa7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801aab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aaf:	c9                   	leave
+  801ab0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801ab1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801ab5:	be ff 00 00 00       	mov    $0xff,%esi
+  801aba:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  801ac1:	00 00 00 
+  801ac4:	ff d0                	call   *%rax
+        state->offset = 0;
+  801ac6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801acc:	eb d9                	jmp    801aa7 <putch+0x22>
+
+0000000000801ace <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801ace:	55                   	push   %rbp
+  801acf:	48 89 e5             	mov    %rsp,%rbp
+  801ad2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801ad9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801adc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801ae3:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801af0:	48 89 f1             	mov    %rsi,%rcx
+  801af3:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801afa:	48 bf 85 1a 80 00 00 	movabs $0x801a85,%rdi
+  801b01:	00 00 00 
+  801b04:	48 b8 82 1c 80 00 00 	movabs $0x801c82,%rax
+  801b0b:	00 00 00 
+  801b0e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801b10:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801b17:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801b1e:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  801b25:	00 00 00 
+  801b28:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801b2a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801b30:	c9                   	leave
+  801b31:	c3                   	ret
+
+0000000000801b32 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801b32:	55                   	push   %rbp
+  801b33:	48 89 e5             	mov    %rsp,%rbp
+  801b36:	48 83 ec 50          	sub    $0x50,%rsp
+  801b3a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801b3e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801b42:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b46:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b4a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801b4e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801b55:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b5d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b61:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801b65:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801b69:	48 b8 ce 1a 80 00 00 	movabs $0x801ace,%rax
+  801b70:	00 00 00 
+  801b73:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801b75:	c9                   	leave
+  801b76:	c3                   	ret
+
+0000000000801b77 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801b77:	55                   	push   %rbp
+  801b78:	48 89 e5             	mov    %rsp,%rbp
+  801b7b:	41 57                	push   %r15
+  801b7d:	41 56                	push   %r14
+  801b7f:	41 55                	push   %r13
+  801b81:	41 54                	push   %r12
+  801b83:	53                   	push   %rbx
+  801b84:	48 83 ec 18          	sub    $0x18,%rsp
+  801b88:	49 89 fc             	mov    %rdi,%r12
+  801b8b:	49 89 f5             	mov    %rsi,%r13
+  801b8e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b92:	8b 45 10             	mov    0x10(%rbp),%eax
+  801b95:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801b98:	41 89 cf             	mov    %ecx,%r15d
+  801b9b:	4c 39 fa             	cmp    %r15,%rdx
+  801b9e:	73 5b                	jae    801bfb <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801ba0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801ba4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ba8:	85 db                	test   %ebx,%ebx
+  801baa:	7e 0e                	jle    801bba <print_num+0x43>
+            putch(padc, put_arg);
+  801bac:	4c 89 ee             	mov    %r13,%rsi
+  801baf:	44 89 f7             	mov    %r14d,%edi
+  801bb2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801bb5:	83 eb 01             	sub    $0x1,%ebx
+  801bb8:	75 f2                	jne    801bac <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801bba:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801bbe:	48 b9 54 62 80 00 00 	movabs $0x806254,%rcx
+  801bc5:	00 00 00 
+  801bc8:	48 b8 43 62 80 00 00 	movabs $0x806243,%rax
+  801bcf:	00 00 00 
+  801bd2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801bd6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdf:	49 f7 f7             	div    %r15
+  801be2:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801be6:	4c 89 ee             	mov    %r13,%rsi
+  801be9:	41 ff d4             	call   *%r12
+}
+  801bec:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801bf0:	5b                   	pop    %rbx
+  801bf1:	41 5c                	pop    %r12
+  801bf3:	41 5d                	pop    %r13
+  801bf5:	41 5e                	pop    %r14
+  801bf7:	41 5f                	pop    %r15
+  801bf9:	5d                   	pop    %rbp
+  801bfa:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801bfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c04:	49 f7 f7             	div    %r15
+  801c07:	48 83 ec 08          	sub    $0x8,%rsp
+  801c0b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801c0f:	52                   	push   %rdx
+  801c10:	45 0f be c9          	movsbl %r9b,%r9d
+  801c14:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801c18:	48 89 c2             	mov    %rax,%rdx
+  801c1b:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+  801c27:	48 83 c4 10          	add    $0x10,%rsp
+  801c2b:	eb 8d                	jmp    801bba <print_num+0x43>
+
+0000000000801c2d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801c2d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801c31:	48 8b 06             	mov    (%rsi),%rax
+  801c34:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801c38:	73 0a                	jae    801c44 <sprintputch+0x17>
+        *state->start++ = ch;
+  801c3a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c3e:	48 89 16             	mov    %rdx,(%rsi)
+  801c41:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801c44:	c3                   	ret
+
+0000000000801c45 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801c45:	55                   	push   %rbp
+  801c46:	48 89 e5             	mov    %rsp,%rbp
+  801c49:	48 83 ec 50          	sub    $0x50,%rsp
+  801c4d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c51:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c55:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801c59:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801c60:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c68:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801c70:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801c74:	48 b8 82 1c 80 00 00 	movabs $0x801c82,%rax
+  801c7b:	00 00 00 
+  801c7e:	ff d0                	call   *%rax
+}
+  801c80:	c9                   	leave
+  801c81:	c3                   	ret
+
+0000000000801c82 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801c82:	55                   	push   %rbp
+  801c83:	48 89 e5             	mov    %rsp,%rbp
+  801c86:	41 57                	push   %r15
+  801c88:	41 56                	push   %r14
+  801c8a:	41 55                	push   %r13
+  801c8c:	41 54                	push   %r12
+  801c8e:	53                   	push   %rbx
+  801c8f:	48 83 ec 38          	sub    $0x38,%rsp
+  801c93:	49 89 fe             	mov    %rdi,%r14
+  801c96:	49 89 f5             	mov    %rsi,%r13
+  801c99:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801c9c:	48 8b 01             	mov    (%rcx),%rax
+  801c9f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ca3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ca7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cab:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801caf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801cb3:	eb 0d                	jmp    801cc2 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801cb5:	40 0f b6 ff          	movzbl %dil,%edi
+  801cb9:	4c 89 ee             	mov    %r13,%rsi
+  801cbc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801cbf:	4c 89 e3             	mov    %r12,%rbx
+  801cc2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801cc6:	0f b6 3b             	movzbl (%rbx),%edi
+  801cc9:	40 80 ff 25          	cmp    $0x25,%dil
+  801ccd:	74 14                	je     801ce3 <vprintfmt+0x61>
+            if (!ch) return;
+  801ccf:	40 84 ff             	test   %dil,%dil
+  801cd2:	75 e1                	jne    801cb5 <vprintfmt+0x33>
+}
+  801cd4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801cd8:	5b                   	pop    %rbx
+  801cd9:	41 5c                	pop    %r12
+  801cdb:	41 5d                	pop    %r13
+  801cdd:	41 5e                	pop    %r14
+  801cdf:	41 5f                	pop    %r15
+  801ce1:	5d                   	pop    %rbp
+  801ce2:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801ce3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801cec:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801cf1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801cf7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801cfe:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801d02:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801d07:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801d0c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801d0f:	83 e8 23             	sub    $0x23,%eax
+  801d12:	3c 57                	cmp    $0x57,%al
+  801d14:	0f 87 67 06 00 00    	ja     802381 <vprintfmt+0x6ff>
+  801d1a:	0f b6 c0             	movzbl %al,%eax
+  801d1d:	48 b9 e0 63 80 00 00 	movabs $0x8063e0,%rcx
+  801d24:	00 00 00 
+  801d27:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801d2a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801d2d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801d31:	eb cf                	jmp    801d02 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801d33:	49 89 dc             	mov    %rbx,%r12
+  801d36:	be 01 00 00 00       	mov    $0x1,%esi
+  801d3b:	eb c5                	jmp    801d02 <vprintfmt+0x80>
+            padc = ch;
+  801d3d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801d41:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801d44:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d47:	eb b9                	jmp    801d02 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4f:	77 24                	ja     801d75 <vprintfmt+0xf3>
+  801d51:	89 c1                	mov    %eax,%ecx
+  801d53:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801d57:	83 c0 08             	add    $0x8,%eax
+  801d5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801d60:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801d63:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801d67:	79 99                	jns    801d02 <vprintfmt+0x80>
+                width = precision;
+  801d69:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801d6d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801d73:	eb 8d                	jmp    801d02 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801d75:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d79:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801d7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d81:	eb da                	jmp    801d5d <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801d83:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801d88:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801d8c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801d92:	3c 39                	cmp    $0x39,%al
+  801d94:	77 1c                	ja     801db2 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801d96:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801d9a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801d9e:	0f b6 c0             	movzbl %al,%eax
+  801da1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801da6:	0f b6 03             	movzbl (%rbx),%eax
+  801da9:	3c 39                	cmp    $0x39,%al
+  801dab:	76 e9                	jbe    801d96 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801dad:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801db0:	eb b1                	jmp    801d63 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801db2:	49 89 dc             	mov    %rbx,%r12
+  801db5:	eb ac                	jmp    801d63 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801db7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801dba:	85 c9                	test   %ecx,%ecx
+  801dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc1:	0f 49 c1             	cmovns %ecx,%eax
+  801dc4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801dc7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801dca:	e9 33 ff ff ff       	jmp    801d02 <vprintfmt+0x80>
+            lflag++;
+  801dcf:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801dd2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801dd5:	e9 28 ff ff ff       	jmp    801d02 <vprintfmt+0x80>
+            lflag--;
+  801dda:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ddd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801de0:	e9 1d ff ff ff       	jmp    801d02 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801de5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801de8:	83 f8 2f             	cmp    $0x2f,%eax
+  801deb:	77 19                	ja     801e06 <vprintfmt+0x184>
+  801ded:	89 c2                	mov    %eax,%edx
+  801def:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df3:	83 c0 08             	add    $0x8,%eax
+  801df6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801df9:	8b 3a                	mov    (%rdx),%edi
+  801dfb:	4c 89 ee             	mov    %r13,%rsi
+  801dfe:	41 ff d6             	call   *%r14
+            break;
+  801e01:	e9 bc fe ff ff       	jmp    801cc2 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801e06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e12:	eb e5                	jmp    801df9 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801e14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e17:	83 f8 2f             	cmp    $0x2f,%eax
+  801e1a:	77 5a                	ja     801e76 <vprintfmt+0x1f4>
+  801e1c:	89 c2                	mov    %eax,%edx
+  801e1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e22:	83 c0 08             	add    $0x8,%eax
+  801e25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801e28:	8b 02                	mov    (%rdx),%eax
+  801e2a:	89 c1                	mov    %eax,%ecx
+  801e2c:	f7 d9                	neg    %ecx
+  801e2e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801e31:	83 f9 13             	cmp    $0x13,%ecx
+  801e34:	7f 4e                	jg     801e84 <vprintfmt+0x202>
+  801e36:	48 63 c1             	movslq %ecx,%rax
+  801e39:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801e40:	00 00 00 
+  801e43:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801e47:	48 85 c0             	test   %rax,%rax
+  801e4a:	74 38                	je     801e84 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801e4c:	48 89 c1             	mov    %rax,%rcx
+  801e4f:	48 ba 68 68 80 00 00 	movabs $0x806868,%rdx
+  801e56:	00 00 00 
+  801e59:	4c 89 ee             	mov    %r13,%rsi
+  801e5c:	4c 89 f7             	mov    %r14,%rdi
+  801e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e64:	49 b8 45 1c 80 00 00 	movabs $0x801c45,%r8
+  801e6b:	00 00 00 
+  801e6e:	41 ff d0             	call   *%r8
+  801e71:	e9 4c fe ff ff       	jmp    801cc2 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801e76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e82:	eb a4                	jmp    801e28 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801e84:	48 ba 6c 62 80 00 00 	movabs $0x80626c,%rdx
+  801e8b:	00 00 00 
+  801e8e:	4c 89 ee             	mov    %r13,%rsi
+  801e91:	4c 89 f7             	mov    %r14,%rdi
+  801e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e99:	49 b8 45 1c 80 00 00 	movabs $0x801c45,%r8
+  801ea0:	00 00 00 
+  801ea3:	41 ff d0             	call   *%r8
+  801ea6:	e9 17 fe ff ff       	jmp    801cc2 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801eab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eae:	83 f8 2f             	cmp    $0x2f,%eax
+  801eb1:	77 6c                	ja     801f1f <vprintfmt+0x29d>
+  801eb3:	89 c2                	mov    %eax,%edx
+  801eb5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eb9:	83 c0 08             	add    $0x8,%eax
+  801ebc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ebf:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801ec2:	48 85 f6             	test   %rsi,%rsi
+  801ec5:	48 b8 65 62 80 00 00 	movabs $0x806265,%rax
+  801ecc:	00 00 00 
+  801ecf:	48 0f 45 c6          	cmovne %rsi,%rax
+  801ed3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801ed7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801edb:	7e 06                	jle    801ee3 <vprintfmt+0x261>
+  801edd:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ee1:	75 4a                	jne    801f2d <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ee3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ee7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801eeb:	0f b6 00             	movzbl (%rax),%eax
+  801eee:	84 c0                	test   %al,%al
+  801ef0:	0f 85 9a 00 00 00    	jne    801f90 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801ef6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ef9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	0f 8e bd fd ff ff    	jle    801cc2 <vprintfmt+0x40>
+  801f05:	4c 89 ee             	mov    %r13,%rsi
+  801f08:	bf 20 00 00 00       	mov    $0x20,%edi
+  801f0d:	41 ff d6             	call   *%r14
+  801f10:	41 83 ec 01          	sub    $0x1,%r12d
+  801f14:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801f18:	75 eb                	jne    801f05 <vprintfmt+0x283>
+  801f1a:	e9 a3 fd ff ff       	jmp    801cc2 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801f1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f2b:	eb 92                	jmp    801ebf <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801f2d:	49 63 f7             	movslq %r15d,%rsi
+  801f30:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801f34:	48 b8 46 24 80 00 00 	movabs $0x802446,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	48 89 c2             	mov    %rax,%rdx
+  801f43:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801f46:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801f48:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801f4b:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	7e 91                	jle    801ee3 <vprintfmt+0x261>
+  801f52:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801f57:	4c 89 ee             	mov    %r13,%rsi
+  801f5a:	44 89 e7             	mov    %r12d,%edi
+  801f5d:	41 ff d6             	call   *%r14
+  801f60:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801f64:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801f67:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801f6a:	75 eb                	jne    801f57 <vprintfmt+0x2d5>
+  801f6c:	e9 72 ff ff ff       	jmp    801ee3 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801f71:	0f b6 f8             	movzbl %al,%edi
+  801f74:	4c 89 ee             	mov    %r13,%rsi
+  801f77:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801f7a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801f7e:	49 83 c4 01          	add    $0x1,%r12
+  801f82:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801f88:	84 c0                	test   %al,%al
+  801f8a:	0f 84 66 ff ff ff    	je     801ef6 <vprintfmt+0x274>
+  801f90:	45 85 ff             	test   %r15d,%r15d
+  801f93:	78 0a                	js     801f9f <vprintfmt+0x31d>
+  801f95:	41 83 ef 01          	sub    $0x1,%r15d
+  801f99:	0f 88 57 ff ff ff    	js     801ef6 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801f9f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801fa3:	74 cc                	je     801f71 <vprintfmt+0x2ef>
+  801fa5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801fa8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801fad:	80 fa 5e             	cmp    $0x5e,%dl
+  801fb0:	77 c2                	ja     801f74 <vprintfmt+0x2f2>
+  801fb2:	eb bd                	jmp    801f71 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801fb4:	40 84 f6             	test   %sil,%sil
+  801fb7:	75 26                	jne    801fdf <vprintfmt+0x35d>
+    switch (lflag) {
+  801fb9:	85 d2                	test   %edx,%edx
+  801fbb:	74 59                	je     802016 <vprintfmt+0x394>
+  801fbd:	83 fa 01             	cmp    $0x1,%edx
+  801fc0:	74 7b                	je     80203d <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801fc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fc5:	83 f8 2f             	cmp    $0x2f,%eax
+  801fc8:	0f 87 96 00 00 00    	ja     802064 <vprintfmt+0x3e2>
+  801fce:	89 c2                	mov    %eax,%edx
+  801fd0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd4:	83 c0 08             	add    $0x8,%eax
+  801fd7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fda:	4c 8b 22             	mov    (%rdx),%r12
+  801fdd:	eb 17                	jmp    801ff6 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801fdf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fe2:	83 f8 2f             	cmp    $0x2f,%eax
+  801fe5:	77 21                	ja     802008 <vprintfmt+0x386>
+  801fe7:	89 c2                	mov    %eax,%edx
+  801fe9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fed:	83 c0 08             	add    $0x8,%eax
+  801ff0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ff3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801ff6:	4d 85 e4             	test   %r12,%r12
+  801ff9:	78 7a                	js     802075 <vprintfmt+0x3f3>
+            num = i;
+  801ffb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801ffe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802003:	e9 56 02 00 00       	jmp    80225e <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802008:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80200c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802010:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802014:	eb dd                	jmp    801ff3 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  802016:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802019:	83 f8 2f             	cmp    $0x2f,%eax
+  80201c:	77 11                	ja     80202f <vprintfmt+0x3ad>
+  80201e:	89 c2                	mov    %eax,%edx
+  802020:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802024:	83 c0 08             	add    $0x8,%eax
+  802027:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80202a:	4c 63 22             	movslq (%rdx),%r12
+  80202d:	eb c7                	jmp    801ff6 <vprintfmt+0x374>
+  80202f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802033:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802037:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80203b:	eb ed                	jmp    80202a <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  80203d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802040:	83 f8 2f             	cmp    $0x2f,%eax
+  802043:	77 11                	ja     802056 <vprintfmt+0x3d4>
+  802045:	89 c2                	mov    %eax,%edx
+  802047:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80204b:	83 c0 08             	add    $0x8,%eax
+  80204e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802051:	4c 8b 22             	mov    (%rdx),%r12
+  802054:	eb a0                	jmp    801ff6 <vprintfmt+0x374>
+  802056:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80205a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80205e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802062:	eb ed                	jmp    802051 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  802064:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802068:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80206c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802070:	e9 65 ff ff ff       	jmp    801fda <vprintfmt+0x358>
+                putch('-', put_arg);
+  802075:	4c 89 ee             	mov    %r13,%rsi
+  802078:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80207d:	41 ff d6             	call   *%r14
+                i = -i;
+  802080:	49 f7 dc             	neg    %r12
+  802083:	e9 73 ff ff ff       	jmp    801ffb <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  802088:	40 84 f6             	test   %sil,%sil
+  80208b:	75 2e                	jne    8020bb <vprintfmt+0x439>
+    switch (lflag) {
+  80208d:	85 d2                	test   %edx,%edx
+  80208f:	7f 59                	jg     8020ea <vprintfmt+0x468>
+  802091:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802094:	7d 7a                	jge    802110 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802096:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802099:	83 f8 2f             	cmp    $0x2f,%eax
+  80209c:	0f 87 aa 00 00 00    	ja     80214c <vprintfmt+0x4ca>
+  8020a2:	89 c2                	mov    %eax,%edx
+  8020a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020a8:	83 c0 08             	add    $0x8,%eax
+  8020ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ae:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8020b1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8020b6:	e9 a3 01 00 00       	jmp    80225e <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020be:	83 f8 2f             	cmp    $0x2f,%eax
+  8020c1:	77 19                	ja     8020dc <vprintfmt+0x45a>
+  8020c3:	89 c2                	mov    %eax,%edx
+  8020c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020c9:	83 c0 08             	add    $0x8,%eax
+  8020cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020cf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8020d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020d7:	e9 82 01 00 00       	jmp    80225e <vprintfmt+0x5dc>
+  8020dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e8:	eb e5                	jmp    8020cf <vprintfmt+0x44d>
+    switch (lflag) {
+  8020ea:	83 fa 01             	cmp    $0x1,%edx
+  8020ed:	75 a7                	jne    802096 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  8020ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8020f5:	77 47                	ja     80213e <vprintfmt+0x4bc>
+  8020f7:	89 c2                	mov    %eax,%edx
+  8020f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020fd:	83 c0 08             	add    $0x8,%eax
+  802100:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802103:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802106:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80210b:	e9 4e 01 00 00       	jmp    80225e <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802110:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802113:	83 f8 2f             	cmp    $0x2f,%eax
+  802116:	77 18                	ja     802130 <vprintfmt+0x4ae>
+  802118:	89 c2                	mov    %eax,%edx
+  80211a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80211e:	83 c0 08             	add    $0x8,%eax
+  802121:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802124:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802126:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80212b:	e9 2e 01 00 00       	jmp    80225e <vprintfmt+0x5dc>
+  802130:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802134:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802138:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80213c:	eb e6                	jmp    802124 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  80213e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802142:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802146:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80214a:	eb b7                	jmp    802103 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  80214c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802150:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802154:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802158:	e9 51 ff ff ff       	jmp    8020ae <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  80215d:	40 84 f6             	test   %sil,%sil
+  802160:	75 2e                	jne    802190 <vprintfmt+0x50e>
+    switch (lflag) {
+  802162:	85 d2                	test   %edx,%edx
+  802164:	7f 59                	jg     8021bf <vprintfmt+0x53d>
+  802166:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802169:	7d 77                	jge    8021e2 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  80216b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80216e:	83 f8 2f             	cmp    $0x2f,%eax
+  802171:	0f 87 a4 00 00 00    	ja     80221b <vprintfmt+0x599>
+  802177:	89 c2                	mov    %eax,%edx
+  802179:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80217d:	83 c0 08             	add    $0x8,%eax
+  802180:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802183:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802186:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80218b:	e9 ce 00 00 00       	jmp    80225e <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802190:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802193:	83 f8 2f             	cmp    $0x2f,%eax
+  802196:	77 19                	ja     8021b1 <vprintfmt+0x52f>
+  802198:	89 c2                	mov    %eax,%edx
+  80219a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80219e:	83 c0 08             	add    $0x8,%eax
+  8021a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021a4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8021a7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021ac:	e9 ad 00 00 00       	jmp    80225e <vprintfmt+0x5dc>
+  8021b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021bd:	eb e5                	jmp    8021a4 <vprintfmt+0x522>
+    switch (lflag) {
+  8021bf:	83 fa 01             	cmp    $0x1,%edx
+  8021c2:	75 a7                	jne    80216b <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8021c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ca:	77 41                	ja     80220d <vprintfmt+0x58b>
+  8021cc:	89 c2                	mov    %eax,%edx
+  8021ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021d2:	83 c0 08             	add    $0x8,%eax
+  8021d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8021db:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8021e0:	eb 7c                	jmp    80225e <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8021e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e8:	77 15                	ja     8021ff <vprintfmt+0x57d>
+  8021ea:	89 c2                	mov    %eax,%edx
+  8021ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f0:	83 c0 08             	add    $0x8,%eax
+  8021f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8021f8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8021fd:	eb 5f                	jmp    80225e <vprintfmt+0x5dc>
+  8021ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802203:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802207:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80220b:	eb e9                	jmp    8021f6 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80220d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802211:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802215:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802219:	eb bd                	jmp    8021d8 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80221b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80221f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802223:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802227:	e9 57 ff ff ff       	jmp    802183 <vprintfmt+0x501>
+            putch('0', put_arg);
+  80222c:	4c 89 ee             	mov    %r13,%rsi
+  80222f:	bf 30 00 00 00       	mov    $0x30,%edi
+  802234:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802237:	4c 89 ee             	mov    %r13,%rsi
+  80223a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80223f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802242:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802245:	83 f8 2f             	cmp    $0x2f,%eax
+  802248:	77 47                	ja     802291 <vprintfmt+0x60f>
+  80224a:	89 c2                	mov    %eax,%edx
+  80224c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802250:	83 c0 08             	add    $0x8,%eax
+  802253:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802256:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802259:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80225e:	48 83 ec 08          	sub    $0x8,%rsp
+  802262:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802266:	0f 94 c0             	sete   %al
+  802269:	0f b6 c0             	movzbl %al,%eax
+  80226c:	50                   	push   %rax
+  80226d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802272:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802276:	4c 89 ee             	mov    %r13,%rsi
+  802279:	4c 89 f7             	mov    %r14,%rdi
+  80227c:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  802283:	00 00 00 
+  802286:	ff d0                	call   *%rax
+            break;
+  802288:	48 83 c4 10          	add    $0x10,%rsp
+  80228c:	e9 31 fa ff ff       	jmp    801cc2 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802291:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802295:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802299:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80229d:	eb b7                	jmp    802256 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80229f:	40 84 f6             	test   %sil,%sil
+  8022a2:	75 2b                	jne    8022cf <vprintfmt+0x64d>
+    switch (lflag) {
+  8022a4:	85 d2                	test   %edx,%edx
+  8022a6:	7f 56                	jg     8022fe <vprintfmt+0x67c>
+  8022a8:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8022ab:	7d 77                	jge    802324 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8022ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8022b3:	0f 87 a7 00 00 00    	ja     802360 <vprintfmt+0x6de>
+  8022b9:	89 c2                	mov    %eax,%edx
+  8022bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022bf:	83 c0 08             	add    $0x8,%eax
+  8022c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8022c8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022cd:	eb 8f                	jmp    80225e <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8022cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8022d5:	77 19                	ja     8022f0 <vprintfmt+0x66e>
+  8022d7:	89 c2                	mov    %eax,%edx
+  8022d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022dd:	83 c0 08             	add    $0x8,%eax
+  8022e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8022e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022eb:	e9 6e ff ff ff       	jmp    80225e <vprintfmt+0x5dc>
+  8022f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022fc:	eb e5                	jmp    8022e3 <vprintfmt+0x661>
+    switch (lflag) {
+  8022fe:	83 fa 01             	cmp    $0x1,%edx
+  802301:	75 aa                	jne    8022ad <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802303:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802306:	83 f8 2f             	cmp    $0x2f,%eax
+  802309:	77 47                	ja     802352 <vprintfmt+0x6d0>
+  80230b:	89 c2                	mov    %eax,%edx
+  80230d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802311:	83 c0 08             	add    $0x8,%eax
+  802314:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802317:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80231a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80231f:	e9 3a ff ff ff       	jmp    80225e <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802324:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802327:	83 f8 2f             	cmp    $0x2f,%eax
+  80232a:	77 18                	ja     802344 <vprintfmt+0x6c2>
+  80232c:	89 c2                	mov    %eax,%edx
+  80232e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802332:	83 c0 08             	add    $0x8,%eax
+  802335:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802338:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80233a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80233f:	e9 1a ff ff ff       	jmp    80225e <vprintfmt+0x5dc>
+  802344:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802348:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80234c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802350:	eb e6                	jmp    802338 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802352:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802356:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80235a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80235e:	eb b7                	jmp    802317 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802360:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802364:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802368:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80236c:	e9 54 ff ff ff       	jmp    8022c5 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802371:	4c 89 ee             	mov    %r13,%rsi
+  802374:	bf 25 00 00 00       	mov    $0x25,%edi
+  802379:	41 ff d6             	call   *%r14
+            break;
+  80237c:	e9 41 f9 ff ff       	jmp    801cc2 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802381:	4c 89 ee             	mov    %r13,%rsi
+  802384:	bf 25 00 00 00       	mov    $0x25,%edi
+  802389:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80238c:	48 83 eb 01          	sub    $0x1,%rbx
+  802390:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802394:	75 f6                	jne    80238c <vprintfmt+0x70a>
+  802396:	e9 27 f9 ff ff       	jmp    801cc2 <vprintfmt+0x40>
+
+000000000080239b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80239b:	55                   	push   %rbp
+  80239c:	48 89 e5             	mov    %rsp,%rbp
+  80239f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8023a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8023a7:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8023ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8023b0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8023b7:	48 85 ff             	test   %rdi,%rdi
+  8023ba:	74 2b                	je     8023e7 <vsnprintf+0x4c>
+  8023bc:	48 85 f6             	test   %rsi,%rsi
+  8023bf:	74 26                	je     8023e7 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8023c1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023c5:	48 bf 2d 1c 80 00 00 	movabs $0x801c2d,%rdi
+  8023cc:	00 00 00 
+  8023cf:	48 b8 82 1c 80 00 00 	movabs $0x801c82,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8023db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023df:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8023e2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8023e5:	c9                   	leave
+  8023e6:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8023e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ec:	eb f7                	jmp    8023e5 <vsnprintf+0x4a>
+
+00000000008023ee <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8023ee:	55                   	push   %rbp
+  8023ef:	48 89 e5             	mov    %rsp,%rbp
+  8023f2:	48 83 ec 50          	sub    $0x50,%rsp
+  8023f6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023fa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8023fe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802402:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802409:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80240d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802411:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802415:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802419:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80241d:	48 b8 9b 23 80 00 00 	movabs $0x80239b,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802429:	c9                   	leave
+  80242a:	c3                   	ret
+
+000000000080242b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80242b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80242e:	74 10                	je     802440 <strlen+0x15>
+    size_t n = 0;
+  802430:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802435:	48 83 c0 01          	add    $0x1,%rax
+  802439:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80243d:	75 f6                	jne    802435 <strlen+0xa>
+  80243f:	c3                   	ret
+    size_t n = 0;
+  802440:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802445:	c3                   	ret
+
+0000000000802446 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802446:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802449:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80244e:	48 85 f6             	test   %rsi,%rsi
+  802451:	74 11                	je     802464 <strnlen+0x1e>
+  802453:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802457:	74 0c                	je     802465 <strnlen+0x1f>
+  802459:	48 83 c2 01          	add    $0x1,%rdx
+  80245d:	48 39 d0             	cmp    %rdx,%rax
+  802460:	75 f1                	jne    802453 <strnlen+0xd>
+  802462:	eb 04                	jmp    802468 <strnlen+0x22>
+  802464:	c3                   	ret
+  802465:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802468:	c3                   	ret
+
+0000000000802469 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802469:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80246c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802471:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802475:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802478:	48 83 c2 01          	add    $0x1,%rdx
+  80247c:	84 c9                	test   %cl,%cl
+  80247e:	75 f1                	jne    802471 <strcpy+0x8>
+        ;
+    return res;
+}
+  802480:	c3                   	ret
+
+0000000000802481 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802481:	55                   	push   %rbp
+  802482:	48 89 e5             	mov    %rsp,%rbp
+  802485:	41 54                	push   %r12
+  802487:	53                   	push   %rbx
+  802488:	48 89 fb             	mov    %rdi,%rbx
+  80248b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80248e:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  802495:	00 00 00 
+  802498:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80249a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80249e:	4c 89 e6             	mov    %r12,%rsi
+  8024a1:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  8024a8:	00 00 00 
+  8024ab:	ff d0                	call   *%rax
+    return dst;
+}
+  8024ad:	48 89 d8             	mov    %rbx,%rax
+  8024b0:	5b                   	pop    %rbx
+  8024b1:	41 5c                	pop    %r12
+  8024b3:	5d                   	pop    %rbp
+  8024b4:	c3                   	ret
+
+00000000008024b5 <toupper>:
+
+int
+toupper(int ch) {
+  8024b5:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8024b7:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8024ba:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8024bd:	83 f9 1a             	cmp    $0x1a,%ecx
+  8024c0:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8024c3:	c3                   	ret
+
+00000000008024c4 <tolower>:
+
+int
+tolower(int ch) {
+  8024c4:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8024c6:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8024c9:	8d 57 20             	lea    0x20(%rdi),%edx
+  8024cc:	83 f9 1a             	cmp    $0x1a,%ecx
+  8024cf:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8024d2:	c3                   	ret
+
+00000000008024d3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8024d3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8024d6:	48 85 d2             	test   %rdx,%rdx
+  8024d9:	74 1f                	je     8024fa <strncpy+0x27>
+  8024db:	48 01 fa             	add    %rdi,%rdx
+  8024de:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8024e1:	48 83 c1 01          	add    $0x1,%rcx
+  8024e5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8024e9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8024ed:	41 80 f8 01          	cmp    $0x1,%r8b
+  8024f1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8024f5:	48 39 ca             	cmp    %rcx,%rdx
+  8024f8:	75 e7                	jne    8024e1 <strncpy+0xe>
+    }
+    return ret;
+}
+  8024fa:	c3                   	ret
+
+00000000008024fb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8024fb:	48 89 f8             	mov    %rdi,%rax
+  8024fe:	48 85 d2             	test   %rdx,%rdx
+  802501:	74 24                	je     802527 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802503:	48 83 ea 01          	sub    $0x1,%rdx
+  802507:	74 1b                	je     802524 <strlcpy+0x29>
+  802509:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80250d:	0f b6 16             	movzbl (%rsi),%edx
+  802510:	84 d2                	test   %dl,%dl
+  802512:	74 10                	je     802524 <strlcpy+0x29>
+            *dst++ = *src++;
+  802514:	48 83 c6 01          	add    $0x1,%rsi
+  802518:	48 83 c0 01          	add    $0x1,%rax
+  80251c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80251f:	48 39 c8             	cmp    %rcx,%rax
+  802522:	75 e9                	jne    80250d <strlcpy+0x12>
+        *dst = '\0';
+  802524:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802527:	48 29 f8             	sub    %rdi,%rax
+}
+  80252a:	c3                   	ret
+
+000000000080252b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80252b:	0f b6 07             	movzbl (%rdi),%eax
+  80252e:	84 c0                	test   %al,%al
+  802530:	74 13                	je     802545 <strcmp+0x1a>
+  802532:	38 06                	cmp    %al,(%rsi)
+  802534:	75 0f                	jne    802545 <strcmp+0x1a>
+  802536:	48 83 c7 01          	add    $0x1,%rdi
+  80253a:	48 83 c6 01          	add    $0x1,%rsi
+  80253e:	0f b6 07             	movzbl (%rdi),%eax
+  802541:	84 c0                	test   %al,%al
+  802543:	75 ed                	jne    802532 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802545:	0f b6 c0             	movzbl %al,%eax
+  802548:	0f b6 16             	movzbl (%rsi),%edx
+  80254b:	29 d0                	sub    %edx,%eax
+}
+  80254d:	c3                   	ret
+
+000000000080254e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80254e:	48 85 d2             	test   %rdx,%rdx
+  802551:	74 1f                	je     802572 <strncmp+0x24>
+  802553:	0f b6 07             	movzbl (%rdi),%eax
+  802556:	84 c0                	test   %al,%al
+  802558:	74 1e                	je     802578 <strncmp+0x2a>
+  80255a:	3a 06                	cmp    (%rsi),%al
+  80255c:	75 1a                	jne    802578 <strncmp+0x2a>
+  80255e:	48 83 c7 01          	add    $0x1,%rdi
+  802562:	48 83 c6 01          	add    $0x1,%rsi
+  802566:	48 83 ea 01          	sub    $0x1,%rdx
+  80256a:	75 e7                	jne    802553 <strncmp+0x5>
+
+    if (!n) return 0;
+  80256c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802571:	c3                   	ret
+  802572:	b8 00 00 00 00       	mov    $0x0,%eax
+  802577:	c3                   	ret
+  802578:	48 85 d2             	test   %rdx,%rdx
+  80257b:	74 09                	je     802586 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80257d:	0f b6 07             	movzbl (%rdi),%eax
+  802580:	0f b6 16             	movzbl (%rsi),%edx
+  802583:	29 d0                	sub    %edx,%eax
+  802585:	c3                   	ret
+    if (!n) return 0;
+  802586:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80258b:	c3                   	ret
+
+000000000080258c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80258c:	0f b6 17             	movzbl (%rdi),%edx
+  80258f:	84 d2                	test   %dl,%dl
+  802591:	74 18                	je     8025ab <strchr+0x1f>
+        if (*str == c) {
+  802593:	0f be d2             	movsbl %dl,%edx
+  802596:	39 f2                	cmp    %esi,%edx
+  802598:	74 17                	je     8025b1 <strchr+0x25>
+    for (; *str; str++) {
+  80259a:	48 83 c7 01          	add    $0x1,%rdi
+  80259e:	0f b6 17             	movzbl (%rdi),%edx
+  8025a1:	84 d2                	test   %dl,%dl
+  8025a3:	75 ee                	jne    802593 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8025a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025aa:	c3                   	ret
+  8025ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b0:	c3                   	ret
+  8025b1:	48 89 f8             	mov    %rdi,%rax
+}
+  8025b4:	c3                   	ret
+
+00000000008025b5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8025b5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8025b8:	0f b6 17             	movzbl (%rdi),%edx
+  8025bb:	84 d2                	test   %dl,%dl
+  8025bd:	74 13                	je     8025d2 <strfind+0x1d>
+  8025bf:	0f be d2             	movsbl %dl,%edx
+  8025c2:	39 f2                	cmp    %esi,%edx
+  8025c4:	74 0b                	je     8025d1 <strfind+0x1c>
+  8025c6:	48 83 c0 01          	add    $0x1,%rax
+  8025ca:	0f b6 10             	movzbl (%rax),%edx
+  8025cd:	84 d2                	test   %dl,%dl
+  8025cf:	75 ee                	jne    8025bf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8025d1:	c3                   	ret
+  8025d2:	c3                   	ret
+
+00000000008025d3 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8025d3:	48 39 f7             	cmp    %rsi,%rdi
+  8025d6:	74 65                	je     80263d <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8025d8:	55                   	push   %rbp
+  8025d9:	48 89 e5             	mov    %rsp,%rbp
+  8025dc:	41 57                	push   %r15
+  8025de:	41 56                	push   %r14
+  8025e0:	41 55                	push   %r13
+  8025e2:	41 54                	push   %r12
+  8025e4:	53                   	push   %rbx
+  8025e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8025e9:	48 89 fb             	mov    %rdi,%rbx
+  8025ec:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8025ef:	49 bf c4 24 80 00 00 	movabs $0x8024c4,%r15
+  8025f6:	00 00 00 
+  8025f9:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8025fd:	41 0f b6 fd          	movzbl %r13b,%edi
+  802601:	41 ff d7             	call   *%r15
+  802604:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802607:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80260c:	41 0f b6 fe          	movzbl %r14b,%edi
+  802610:	41 ff d7             	call   *%r15
+  802613:	89 c2                	mov    %eax,%edx
+  802615:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802618:	29 d0                	sub    %edx,%eax
+  80261a:	75 12                	jne    80262e <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80261c:	48 83 c3 01          	add    $0x1,%rbx
+  802620:	45 84 ed             	test   %r13b,%r13b
+  802623:	74 09                	je     80262e <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802625:	49 83 c4 01          	add    $0x1,%r12
+  802629:	45 84 f6             	test   %r14b,%r14b
+  80262c:	75 cb                	jne    8025f9 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80262e:	48 83 c4 18          	add    $0x18,%rsp
+  802632:	5b                   	pop    %rbx
+  802633:	41 5c                	pop    %r12
+  802635:	41 5d                	pop    %r13
+  802637:	41 5e                	pop    %r14
+  802639:	41 5f                	pop    %r15
+  80263b:	5d                   	pop    %rbp
+  80263c:	c3                   	ret
+    if (p1 == p2) return 0;
+  80263d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802642:	c3                   	ret
+
+0000000000802643 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802643:	48 39 f7             	cmp    %rsi,%rdi
+  802646:	74 7d                	je     8026c5 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802648:	55                   	push   %rbp
+  802649:	48 89 e5             	mov    %rsp,%rbp
+  80264c:	41 57                	push   %r15
+  80264e:	41 56                	push   %r14
+  802650:	41 55                	push   %r13
+  802652:	41 54                	push   %r12
+  802654:	53                   	push   %rbx
+  802655:	48 83 ec 18          	sub    $0x18,%rsp
+  802659:	48 89 fb             	mov    %rdi,%rbx
+  80265c:	49 89 f4             	mov    %rsi,%r12
+  80265f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802663:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802667:	49 bf c4 24 80 00 00 	movabs $0x8024c4,%r15
+  80266e:	00 00 00 
+    while (n--) {
+  802671:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802675:	48 39 c3             	cmp    %rax,%rbx
+  802678:	74 37                	je     8026b1 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80267a:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80267e:	41 0f b6 fd          	movzbl %r13b,%edi
+  802682:	41 ff d7             	call   *%r15
+  802685:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802688:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80268d:	41 0f b6 fe          	movzbl %r14b,%edi
+  802691:	41 ff d7             	call   *%r15
+  802694:	89 c2                	mov    %eax,%edx
+  802696:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802699:	29 d0                	sub    %edx,%eax
+  80269b:	75 19                	jne    8026b6 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80269d:	48 83 c3 01          	add    $0x1,%rbx
+  8026a1:	45 84 ed             	test   %r13b,%r13b
+  8026a4:	74 10                	je     8026b6 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8026a6:	49 83 c4 01          	add    $0x1,%r12
+  8026aa:	45 84 f6             	test   %r14b,%r14b
+  8026ad:	75 c2                	jne    802671 <strncasecmp+0x2e>
+  8026af:	eb 05                	jmp    8026b6 <strncasecmp+0x73>
+  8026b1:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8026b6:	48 83 c4 18          	add    $0x18,%rsp
+  8026ba:	5b                   	pop    %rbx
+  8026bb:	41 5c                	pop    %r12
+  8026bd:	41 5d                	pop    %r13
+  8026bf:	41 5e                	pop    %r14
+  8026c1:	41 5f                	pop    %r15
+  8026c3:	5d                   	pop    %rbp
+  8026c4:	c3                   	ret
+    if (p1 == p2) return 0;
+  8026c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026ca:	c3                   	ret
+
+00000000008026cb <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8026cb:	83 e7 df             	and    $0xffffffdf,%edi
+  8026ce:	83 ef 41             	sub    $0x41,%edi
+  8026d1:	83 ff 19             	cmp    $0x19,%edi
+  8026d4:	0f 96 c0             	setbe  %al
+}
+  8026d7:	c3                   	ret
+
+00000000008026d8 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8026d8:	83 ff 20             	cmp    $0x20,%edi
+  8026db:	0f 94 c0             	sete   %al
+  8026de:	83 ff 09             	cmp    $0x9,%edi
+  8026e1:	0f 94 c2             	sete   %dl
+  8026e4:	09 d0                	or     %edx,%eax
+}
+  8026e6:	c3                   	ret
+
+00000000008026e7 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8026e7:	55                   	push   %rbp
+  8026e8:	48 89 e5             	mov    %rsp,%rbp
+  8026eb:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8026ed:	48 bf 5f 67 80 00 00 	movabs $0x80675f,%rdi
+  8026f4:	00 00 00 
+  8026f7:	48 b8 8c 25 80 00 00 	movabs $0x80258c,%rax
+  8026fe:	00 00 00 
+  802701:	ff d0                	call   *%rax
+  802703:	48 85 c0             	test   %rax,%rax
+  802706:	0f 95 c0             	setne  %al
+}
+  802709:	5d                   	pop    %rbp
+  80270a:	c3                   	ret
+
+000000000080270b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80270b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80270e:	48 89 f8             	mov    %rdi,%rax
+  802711:	48 f7 d8             	neg    %rax
+  802714:	83 e0 07             	and    $0x7,%eax
+  802717:	49 89 d1             	mov    %rdx,%r9
+  80271a:	49 29 c1             	sub    %rax,%r9
+  80271d:	78 36                	js     802755 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80271f:	40 0f b6 c6          	movzbl %sil,%eax
+  802723:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80272a:	01 01 01 
+  80272d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802731:	40 f6 c7 07          	test   $0x7,%dil
+  802735:	75 38                	jne    80276f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802737:	4c 89 c9             	mov    %r9,%rcx
+  80273a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80273e:	74 0c                	je     80274c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802740:	fc                   	cld
+  802741:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802744:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802748:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80274c:	4d 85 c9             	test   %r9,%r9
+  80274f:	75 45                	jne    802796 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802751:	4c 89 c0             	mov    %r8,%rax
+  802754:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802755:	48 85 d2             	test   %rdx,%rdx
+  802758:	74 f7                	je     802751 <memset+0x46>
+  80275a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80275d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802760:	48 83 c0 01          	add    $0x1,%rax
+  802764:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802768:	48 39 c2             	cmp    %rax,%rdx
+  80276b:	75 f3                	jne    802760 <memset+0x55>
+  80276d:	eb e2                	jmp    802751 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80276f:	40 f6 c7 01          	test   $0x1,%dil
+  802773:	74 06                	je     80277b <memset+0x70>
+  802775:	88 07                	mov    %al,(%rdi)
+  802777:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80277b:	40 f6 c7 02          	test   $0x2,%dil
+  80277f:	74 07                	je     802788 <memset+0x7d>
+  802781:	66 89 07             	mov    %ax,(%rdi)
+  802784:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802788:	40 f6 c7 04          	test   $0x4,%dil
+  80278c:	74 a9                	je     802737 <memset+0x2c>
+  80278e:	89 07                	mov    %eax,(%rdi)
+  802790:	48 83 c7 04          	add    $0x4,%rdi
+  802794:	eb a1                	jmp    802737 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802796:	41 f6 c1 04          	test   $0x4,%r9b
+  80279a:	74 06                	je     8027a2 <memset+0x97>
+  80279c:	89 07                	mov    %eax,(%rdi)
+  80279e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8027a2:	41 f6 c1 02          	test   $0x2,%r9b
+  8027a6:	74 07                	je     8027af <memset+0xa4>
+  8027a8:	66 89 07             	mov    %ax,(%rdi)
+  8027ab:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8027af:	41 f6 c1 01          	test   $0x1,%r9b
+  8027b3:	74 9c                	je     802751 <memset+0x46>
+  8027b5:	88 07                	mov    %al,(%rdi)
+  8027b7:	eb 98                	jmp    802751 <memset+0x46>
+
+00000000008027b9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8027b9:	48 89 f8             	mov    %rdi,%rax
+  8027bc:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8027bf:	48 39 fe             	cmp    %rdi,%rsi
+  8027c2:	73 3b                	jae    8027ff <memmove+0x46>
+  8027c4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8027c8:	48 39 d7             	cmp    %rdx,%rdi
+  8027cb:	73 32                	jae    8027ff <memmove+0x46>
+        s += n;
+        d += n;
+  8027cd:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027d1:	48 89 d6             	mov    %rdx,%rsi
+  8027d4:	48 09 fe             	or     %rdi,%rsi
+  8027d7:	48 09 ce             	or     %rcx,%rsi
+  8027da:	40 f6 c6 07          	test   $0x7,%sil
+  8027de:	75 12                	jne    8027f2 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8027e0:	48 83 ef 08          	sub    $0x8,%rdi
+  8027e4:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8027e8:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027ec:	fd                   	std
+  8027ed:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027f0:	fc                   	cld
+  8027f1:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027f2:	48 83 ef 01          	sub    $0x1,%rdi
+  8027f6:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027fa:	fd                   	std
+  8027fb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027fd:	eb f1                	jmp    8027f0 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027ff:	48 89 f2             	mov    %rsi,%rdx
+  802802:	48 09 c2             	or     %rax,%rdx
+  802805:	48 09 ca             	or     %rcx,%rdx
+  802808:	f6 c2 07             	test   $0x7,%dl
+  80280b:	75 0c                	jne    802819 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80280d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802811:	48 89 c7             	mov    %rax,%rdi
+  802814:	fc                   	cld
+  802815:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802818:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802819:	48 89 c7             	mov    %rax,%rdi
+  80281c:	fc                   	cld
+  80281d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80281f:	c3                   	ret
+
+0000000000802820 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802820:	55                   	push   %rbp
+  802821:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802824:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  80282b:	00 00 00 
+  80282e:	ff d0                	call   *%rax
+}
+  802830:	5d                   	pop    %rbp
+  802831:	c3                   	ret
+
+0000000000802832 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802832:	55                   	push   %rbp
+  802833:	48 89 e5             	mov    %rsp,%rbp
+  802836:	41 57                	push   %r15
+  802838:	41 56                	push   %r14
+  80283a:	41 55                	push   %r13
+  80283c:	41 54                	push   %r12
+  80283e:	53                   	push   %rbx
+  80283f:	48 83 ec 08          	sub    $0x8,%rsp
+  802843:	49 89 fe             	mov    %rdi,%r14
+  802846:	49 89 f7             	mov    %rsi,%r15
+  802849:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80284c:	48 89 f7             	mov    %rsi,%rdi
+  80284f:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  802856:	00 00 00 
+  802859:	ff d0                	call   *%rax
+  80285b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80285e:	48 89 de             	mov    %rbx,%rsi
+  802861:	4c 89 f7             	mov    %r14,%rdi
+  802864:	48 b8 46 24 80 00 00 	movabs $0x802446,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+  802870:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802873:	48 39 c3             	cmp    %rax,%rbx
+  802876:	74 36                	je     8028ae <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802878:	48 89 d8             	mov    %rbx,%rax
+  80287b:	4c 29 e8             	sub    %r13,%rax
+  80287e:	49 39 c4             	cmp    %rax,%r12
+  802881:	73 31                	jae    8028b4 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802883:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802888:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80288c:	4c 89 fe             	mov    %r15,%rsi
+  80288f:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  802896:	00 00 00 
+  802899:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80289b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80289f:	48 83 c4 08          	add    $0x8,%rsp
+  8028a3:	5b                   	pop    %rbx
+  8028a4:	41 5c                	pop    %r12
+  8028a6:	41 5d                	pop    %r13
+  8028a8:	41 5e                	pop    %r14
+  8028aa:	41 5f                	pop    %r15
+  8028ac:	5d                   	pop    %rbp
+  8028ad:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8028ae:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8028b2:	eb eb                	jmp    80289f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8028b4:	48 83 eb 01          	sub    $0x1,%rbx
+  8028b8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8028bc:	48 89 da             	mov    %rbx,%rdx
+  8028bf:	4c 89 fe             	mov    %r15,%rsi
+  8028c2:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  8028c9:	00 00 00 
+  8028cc:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8028ce:	49 01 de             	add    %rbx,%r14
+  8028d1:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8028d6:	eb c3                	jmp    80289b <strlcat+0x69>
+
+00000000008028d8 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8028d8:	48 85 d2             	test   %rdx,%rdx
+  8028db:	74 2d                	je     80290a <memcmp+0x32>
+  8028dd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8028e2:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8028e6:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8028eb:	44 38 c1             	cmp    %r8b,%cl
+  8028ee:	75 0f                	jne    8028ff <memcmp+0x27>
+    while (n-- > 0) {
+  8028f0:	48 83 c0 01          	add    $0x1,%rax
+  8028f4:	48 39 c2             	cmp    %rax,%rdx
+  8028f7:	75 e9                	jne    8028e2 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fe:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028ff:	0f b6 c1             	movzbl %cl,%eax
+  802902:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802906:	44 29 c0             	sub    %r8d,%eax
+  802909:	c3                   	ret
+    return 0;
+  80290a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80290f:	c3                   	ret
+
+0000000000802910 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802910:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802914:	48 39 c7             	cmp    %rax,%rdi
+  802917:	73 0f                	jae    802928 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802919:	40 38 37             	cmp    %sil,(%rdi)
+  80291c:	74 0e                	je     80292c <memfind+0x1c>
+    for (; src < end; src++) {
+  80291e:	48 83 c7 01          	add    $0x1,%rdi
+  802922:	48 39 f8             	cmp    %rdi,%rax
+  802925:	75 f2                	jne    802919 <memfind+0x9>
+  802927:	c3                   	ret
+  802928:	48 89 f8             	mov    %rdi,%rax
+  80292b:	c3                   	ret
+  80292c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80292f:	c3                   	ret
+
+0000000000802930 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802930:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802933:	0f b6 37             	movzbl (%rdi),%esi
+  802936:	40 80 fe 20          	cmp    $0x20,%sil
+  80293a:	74 06                	je     802942 <strtol+0x12>
+  80293c:	40 80 fe 09          	cmp    $0x9,%sil
+  802940:	75 13                	jne    802955 <strtol+0x25>
+  802942:	48 83 c7 01          	add    $0x1,%rdi
+  802946:	0f b6 37             	movzbl (%rdi),%esi
+  802949:	40 80 fe 20          	cmp    $0x20,%sil
+  80294d:	74 f3                	je     802942 <strtol+0x12>
+  80294f:	40 80 fe 09          	cmp    $0x9,%sil
+  802953:	74 ed                	je     802942 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802955:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802958:	83 e0 fd             	and    $0xfffffffd,%eax
+  80295b:	3c 01                	cmp    $0x1,%al
+  80295d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802961:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802967:	75 0f                	jne    802978 <strtol+0x48>
+  802969:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80296c:	74 14                	je     802982 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80296e:	85 d2                	test   %edx,%edx
+  802970:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802975:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802978:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80297d:	4c 63 ca             	movslq %edx,%r9
+  802980:	eb 36                	jmp    8029b8 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802982:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802986:	74 0f                	je     802997 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802988:	85 d2                	test   %edx,%edx
+  80298a:	75 ec                	jne    802978 <strtol+0x48>
+        s++;
+  80298c:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802990:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802995:	eb e1                	jmp    802978 <strtol+0x48>
+        s += 2;
+  802997:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80299b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8029a0:	eb d6                	jmp    802978 <strtol+0x48>
+            dig -= '0';
+  8029a2:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8029a5:	44 0f b6 c1          	movzbl %cl,%r8d
+  8029a9:	41 39 d0             	cmp    %edx,%r8d
+  8029ac:	7d 21                	jge    8029cf <strtol+0x9f>
+        val = val * base + dig;
+  8029ae:	49 0f af c1          	imul   %r9,%rax
+  8029b2:	0f b6 c9             	movzbl %cl,%ecx
+  8029b5:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8029b8:	48 83 c7 01          	add    $0x1,%rdi
+  8029bc:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8029c0:	80 f9 39             	cmp    $0x39,%cl
+  8029c3:	76 dd                	jbe    8029a2 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8029c5:	80 f9 7b             	cmp    $0x7b,%cl
+  8029c8:	77 05                	ja     8029cf <strtol+0x9f>
+            dig -= 'a' - 10;
+  8029ca:	83 e9 57             	sub    $0x57,%ecx
+  8029cd:	eb d6                	jmp    8029a5 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8029cf:	4d 85 d2             	test   %r10,%r10
+  8029d2:	74 03                	je     8029d7 <strtol+0xa7>
+  8029d4:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8029d7:	48 89 c2             	mov    %rax,%rdx
+  8029da:	48 f7 da             	neg    %rdx
+  8029dd:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8029e1:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8029e5:	c3                   	ret
+
+00000000008029e6 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	53                   	push   %rbx
+  8029eb:	48 89 fa             	mov    %rdi,%rdx
+  8029ee:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8029f1:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a00:	be 00 00 00 00       	mov    $0x0,%esi
+  802a05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a11:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802a13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a17:	c9                   	leave
+  802a18:	c3                   	ret
+
+0000000000802a19 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802a19:	55                   	push   %rbp
+  802a1a:	48 89 e5             	mov    %rsp,%rbp
+  802a1d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a1e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a23:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a28:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a32:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a37:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a42:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a48:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4e:	c9                   	leave
+  802a4f:	c3                   	ret
+
+0000000000802a50 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802a50:	55                   	push   %rbp
+  802a51:	48 89 e5             	mov    %rsp,%rbp
+  802a54:	53                   	push   %rbx
+  802a55:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a58:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a67:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a7d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802a7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+0000000000802a85 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802a85:	55                   	push   %rbp
+  802a86:	48 89 e5             	mov    %rsp,%rbp
+  802a89:	53                   	push   %rbx
+  802a8a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802a8e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a91:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aaa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ab8:	48 85 c0             	test   %rax,%rax
+  802abb:	7f 06                	jg     802ac3 <sys_env_destroy+0x3e>
+}
+  802abd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac1:	c9                   	leave
+  802ac2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ac3:	49 89 c0             	mov    %rax,%r8
+  802ac6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802acb:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802ad2:	00 00 00 
+  802ad5:	be 27 00 00 00       	mov    $0x27,%esi
+  802ada:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802ae1:	00 00 00 
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae9:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802af0:	00 00 00 
+  802af3:	41 ff d1             	call   *%r9
+
+0000000000802af6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802af6:	55                   	push   %rbp
+  802af7:	48 89 e5             	mov    %rsp,%rbp
+  802afa:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802afb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b00:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b05:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b0f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b14:	be 00 00 00 00       	mov    $0x0,%esi
+  802b19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b1f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b25:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802b27:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b2b:	c9                   	leave
+  802b2c:	c3                   	ret
+
+0000000000802b2d <sys_yield>:
+
+void
+sys_yield(void) {
+  802b2d:	55                   	push   %rbp
+  802b2e:	48 89 e5             	mov    %rsp,%rbp
+  802b31:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802b32:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b46:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b4b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b56:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b5c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802b5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b62:	c9                   	leave
+  802b63:	c3                   	ret
+
+0000000000802b64 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802b64:	55                   	push   %rbp
+  802b65:	48 89 e5             	mov    %rsp,%rbp
+  802b68:	53                   	push   %rbx
+  802b69:	48 89 fa             	mov    %rdi,%rdx
+  802b6c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802b6f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b74:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802b7b:	00 00 00 
+  802b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b83:	be 00 00 00 00       	mov    $0x0,%esi
+  802b88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b8e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b94:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802b96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b9a:	c9                   	leave
+  802b9b:	c3                   	ret
+
+0000000000802b9c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802b9c:	55                   	push   %rbp
+  802b9d:	48 89 e5             	mov    %rsp,%rbp
+  802ba0:	53                   	push   %rbx
+  802ba1:	49 89 f8             	mov    %rdi,%r8
+  802ba4:	48 89 d3             	mov    %rdx,%rbx
+  802ba7:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802baa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802baf:	4c 89 c2             	mov    %r8,%rdx
+  802bb2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bb5:	be 00 00 00 00       	mov    $0x0,%esi
+  802bba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bc0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bc6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802bc8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bcc:	c9                   	leave
+  802bcd:	c3                   	ret
+
+0000000000802bce <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802bce:	55                   	push   %rbp
+  802bcf:	48 89 e5             	mov    %rsp,%rbp
+  802bd2:	53                   	push   %rbx
+  802bd3:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd7:	89 f8                	mov    %edi,%eax
+  802bd9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802bdc:	48 63 f9             	movslq %ecx,%rdi
+  802bdf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802be2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802be7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bea:	be 00 00 00 00       	mov    $0x0,%esi
+  802bef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bf5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bfb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bfd:	48 85 c0             	test   %rax,%rax
+  802c00:	7f 06                	jg     802c08 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802c02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c06:	c9                   	leave
+  802c07:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c08:	49 89 c0             	mov    %rax,%r8
+  802c0b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802c10:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802c17:	00 00 00 
+  802c1a:	be 27 00 00 00       	mov    $0x27,%esi
+  802c1f:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802c26:	00 00 00 
+  802c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2e:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802c35:	00 00 00 
+  802c38:	41 ff d1             	call   *%r9
+
+0000000000802c3b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802c3b:	55                   	push   %rbp
+  802c3c:	48 89 e5             	mov    %rsp,%rbp
+  802c3f:	53                   	push   %rbx
+  802c40:	48 83 ec 08          	sub    $0x8,%rsp
+  802c44:	89 f8                	mov    %edi,%eax
+  802c46:	49 89 f2             	mov    %rsi,%r10
+  802c49:	48 89 cf             	mov    %rcx,%rdi
+  802c4c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802c4f:	48 63 da             	movslq %edx,%rbx
+  802c52:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c55:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c5a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c5d:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802c60:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c66:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c68:	48 85 c0             	test   %rax,%rax
+  802c6b:	7f 06                	jg     802c73 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802c6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c71:	c9                   	leave
+  802c72:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c73:	49 89 c0             	mov    %rax,%r8
+  802c76:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802c7b:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802c82:	00 00 00 
+  802c85:	be 27 00 00 00       	mov    $0x27,%esi
+  802c8a:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802c91:	00 00 00 
+  802c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c99:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802ca0:	00 00 00 
+  802ca3:	41 ff d1             	call   *%r9
+
+0000000000802ca6 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802ca6:	55                   	push   %rbp
+  802ca7:	48 89 e5             	mov    %rsp,%rbp
+  802caa:	53                   	push   %rbx
+  802cab:	48 83 ec 08          	sub    $0x8,%rsp
+  802caf:	48 89 f1             	mov    %rsi,%rcx
+  802cb2:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802cb5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ccd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cd3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cd5:	48 85 c0             	test   %rax,%rax
+  802cd8:	7f 06                	jg     802ce0 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802cda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cde:	c9                   	leave
+  802cdf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ce0:	49 89 c0             	mov    %rax,%r8
+  802ce3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ce8:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802cef:	00 00 00 
+  802cf2:	be 27 00 00 00       	mov    $0x27,%esi
+  802cf7:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802cfe:	00 00 00 
+  802d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d06:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802d0d:	00 00 00 
+  802d10:	41 ff d1             	call   *%r9
+
+0000000000802d13 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802d13:	55                   	push   %rbp
+  802d14:	48 89 e5             	mov    %rsp,%rbp
+  802d17:	53                   	push   %rbx
+  802d18:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802d1c:	48 63 ce             	movslq %esi,%rcx
+  802d1f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d22:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d2c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d31:	be 00 00 00 00       	mov    $0x0,%esi
+  802d36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d3c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d42:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d44:	48 85 c0             	test   %rax,%rax
+  802d47:	7f 06                	jg     802d4f <sys_env_set_status+0x3c>
+}
+  802d49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4d:	c9                   	leave
+  802d4e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d4f:	49 89 c0             	mov    %rax,%r8
+  802d52:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802d57:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802d5e:	00 00 00 
+  802d61:	be 27 00 00 00       	mov    $0x27,%esi
+  802d66:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802d6d:	00 00 00 
+  802d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d75:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802d7c:	00 00 00 
+  802d7f:	41 ff d1             	call   *%r9
+
+0000000000802d82 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802d82:	55                   	push   %rbp
+  802d83:	48 89 e5             	mov    %rsp,%rbp
+  802d86:	53                   	push   %rbx
+  802d87:	48 83 ec 08          	sub    $0x8,%rsp
+  802d8b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802d8e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d91:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d9b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802da0:	be 00 00 00 00       	mov    $0x0,%esi
+  802da5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802db3:	48 85 c0             	test   %rax,%rax
+  802db6:	7f 06                	jg     802dbe <sys_env_set_trapframe+0x3c>
+}
+  802db8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dbc:	c9                   	leave
+  802dbd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dbe:	49 89 c0             	mov    %rax,%r8
+  802dc1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802dc6:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802dcd:	00 00 00 
+  802dd0:	be 27 00 00 00       	mov    $0x27,%esi
+  802dd5:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802ddc:	00 00 00 
+  802ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de4:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802deb:	00 00 00 
+  802dee:	41 ff d1             	call   *%r9
+
+0000000000802df1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802df1:	55                   	push   %rbp
+  802df2:	48 89 e5             	mov    %rsp,%rbp
+  802df5:	53                   	push   %rbx
+  802df6:	48 83 ec 08          	sub    $0x8,%rsp
+  802dfa:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802dfd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e00:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e0a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e1a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e20:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e22:	48 85 c0             	test   %rax,%rax
+  802e25:	7f 06                	jg     802e2d <sys_env_set_pgfault_upcall+0x3c>
+}
+  802e27:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e2b:	c9                   	leave
+  802e2c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e2d:	49 89 c0             	mov    %rax,%r8
+  802e30:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802e35:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802e3c:	00 00 00 
+  802e3f:	be 27 00 00 00       	mov    $0x27,%esi
+  802e44:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802e4b:	00 00 00 
+  802e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e53:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802e5a:	00 00 00 
+  802e5d:	41 ff d1             	call   *%r9
+
+0000000000802e60 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802e60:	55                   	push   %rbp
+  802e61:	48 89 e5             	mov    %rsp,%rbp
+  802e64:	53                   	push   %rbx
+  802e65:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802e69:	40 0f b6 ce          	movzbl %sil,%ecx
+  802e6d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e70:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e7f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e90:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e92:	48 85 c0             	test   %rax,%rax
+  802e95:	7f 06                	jg     802e9d <sys_env_set_reclaim+0x3d>
+}
+  802e97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e9b:	c9                   	leave
+  802e9c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e9d:	49 89 c0             	mov    %rax,%r8
+  802ea0:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802ea5:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802eac:	00 00 00 
+  802eaf:	be 27 00 00 00       	mov    $0x27,%esi
+  802eb4:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802ebb:	00 00 00 
+  802ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec3:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802eca:	00 00 00 
+  802ecd:	41 ff d1             	call   *%r9
+
+0000000000802ed0 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802ed0:	55                   	push   %rbp
+  802ed1:	48 89 e5             	mov    %rsp,%rbp
+  802ed4:	53                   	push   %rbx
+  802ed5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802ed9:	48 63 ce             	movslq %esi,%rcx
+  802edc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802edf:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ee4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eee:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ef9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802eff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f01:	48 85 c0             	test   %rax,%rax
+  802f04:	7f 06                	jg     802f0c <sys_env_set_nice+0x3c>
+}
+  802f06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f0a:	c9                   	leave
+  802f0b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f0c:	49 89 c0             	mov    %rax,%r8
+  802f0f:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802f14:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802f1b:	00 00 00 
+  802f1e:	be 27 00 00 00       	mov    $0x27,%esi
+  802f23:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802f2a:	00 00 00 
+  802f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f32:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  802f39:	00 00 00 
+  802f3c:	41 ff d1             	call   *%r9
+
+0000000000802f3f <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802f3f:	55                   	push   %rbp
+  802f40:	48 89 e5             	mov    %rsp,%rbp
+  802f43:	53                   	push   %rbx
+  802f44:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f47:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f66:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f6c:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802f6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f72:	c9                   	leave
+  802f73:	c3                   	ret
+
+0000000000802f74 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802f74:	55                   	push   %rbp
+  802f75:	48 89 e5             	mov    %rsp,%rbp
+  802f78:	53                   	push   %rbx
+  802f79:	89 f8                	mov    %edi,%eax
+  802f7b:	49 89 f1             	mov    %rsi,%r9
+  802f7e:	48 89 d3             	mov    %rdx,%rbx
+  802f81:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802f84:	49 63 f0             	movslq %r8d,%rsi
+  802f87:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f8a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f8f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f9e:	cd 30                	int    $0x30
+}
+  802fa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fa4:	c9                   	leave
+  802fa5:	c3                   	ret
+
+0000000000802fa6 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802fa6:	55                   	push   %rbp
+  802fa7:	48 89 e5             	mov    %rsp,%rbp
+  802faa:	53                   	push   %rbx
+  802fab:	89 f8                	mov    %edi,%eax
+  802fad:	49 89 f1             	mov    %rsi,%r9
+  802fb0:	48 89 d3             	mov    %rdx,%rbx
+  802fb3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802fb6:	49 63 f0             	movslq %r8d,%rsi
+  802fb9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fbc:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fc1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fd0:	cd 30                	int    $0x30
+}
+  802fd2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fd6:	c9                   	leave
+  802fd7:	c3                   	ret
+
+0000000000802fd8 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802fd8:	55                   	push   %rbp
+  802fd9:	48 89 e5             	mov    %rsp,%rbp
+  802fdc:	53                   	push   %rbx
+  802fdd:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe1:	89 f8                	mov    %edi,%eax
+  802fe3:	49 89 f2             	mov    %rsi,%r10
+  802fe6:	48 89 d3             	mov    %rdx,%rbx
+  802fe9:	48 89 cf             	mov    %rcx,%rdi
+  802fec:	44 89 c6             	mov    %r8d,%esi
+  802fef:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802ff2:	48 63 f6             	movslq %esi,%rsi
+  802ff5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ff8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ffd:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803000:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803004:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803006:	48 85 c0             	test   %rax,%rax
+  803009:	7f 06                	jg     803011 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80300b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80300f:	c9                   	leave
+  803010:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803011:	49 89 c0             	mov    %rax,%r8
+  803014:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  803019:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  803020:	00 00 00 
+  803023:	be 27 00 00 00       	mov    $0x27,%esi
+  803028:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  80302f:	00 00 00 
+  803032:	b8 00 00 00 00       	mov    $0x0,%eax
+  803037:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  80303e:	00 00 00 
+  803041:	41 ff d1             	call   *%r9
+
+0000000000803044 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  803044:	55                   	push   %rbp
+  803045:	48 89 e5             	mov    %rsp,%rbp
+  803048:	53                   	push   %rbx
+  803049:	48 83 ec 08          	sub    $0x8,%rsp
+  80304d:	48 89 f1             	mov    %rsi,%rcx
+  803050:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  803053:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  803057:	48 8b 1a             	mov    (%rdx),%rbx
+  80305a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80305d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803062:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803066:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  80306a:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  80306e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803070:	48 85 c0             	test   %rax,%rax
+  803073:	7f 06                	jg     80307b <sys_ipc_call_short+0x37>
+}
+  803075:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803079:	c9                   	leave
+  80307a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80307b:	49 89 c0             	mov    %rax,%r8
+  80307e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  803083:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  80308a:	00 00 00 
+  80308d:	be 27 00 00 00       	mov    $0x27,%esi
+  803092:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  803099:	00 00 00 
+  80309c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a1:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  8030a8:	00 00 00 
+  8030ab:	41 ff d1             	call   *%r9
+
+00000000008030ae <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  8030ae:	55                   	push   %rbp
+  8030af:	48 89 e5             	mov    %rsp,%rbp
+  8030b2:	53                   	push   %rbx
+  8030b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8030b7:	89 f8                	mov    %edi,%eax
+  8030b9:	49 89 f2             	mov    %rsi,%r10
+  8030bc:	48 89 d3             	mov    %rdx,%rbx
+  8030bf:	48 89 cf             	mov    %rcx,%rdi
+  8030c2:	44 89 c6             	mov    %r8d,%esi
+  8030c5:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  8030c8:	48 63 f6             	movslq %esi,%rsi
+  8030cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030ce:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030d3:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  8030d6:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  8030da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8030dc:	48 85 c0             	test   %rax,%rax
+  8030df:	7f 06                	jg     8030e7 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8030e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030e5:	c9                   	leave
+  8030e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8030e7:	49 89 c0             	mov    %rax,%r8
+  8030ea:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8030ef:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  8030f6:	00 00 00 
+  8030f9:	be 27 00 00 00       	mov    $0x27,%esi
+  8030fe:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  803105:	00 00 00 
+  803108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310d:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  803114:	00 00 00 
+  803117:	41 ff d1             	call   *%r9
+
+000000000080311a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80311a:	55                   	push   %rbp
+  80311b:	48 89 e5             	mov    %rsp,%rbp
+  80311e:	53                   	push   %rbx
+  80311f:	48 83 ec 08          	sub    $0x8,%rsp
+  803123:	48 89 fa             	mov    %rdi,%rdx
+  803126:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803129:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80312e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803133:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803138:	be 00 00 00 00       	mov    $0x0,%esi
+  80313d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803143:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803149:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80314b:	48 85 c0             	test   %rax,%rax
+  80314e:	7f 06                	jg     803156 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803154:	c9                   	leave
+  803155:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803156:	49 89 c0             	mov    %rax,%r8
+  803159:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80315e:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  803165:	00 00 00 
+  803168:	be 27 00 00 00       	mov    $0x27,%esi
+  80316d:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  803174:	00 00 00 
+  803177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317c:	49 b9 e2 19 80 00 00 	movabs $0x8019e2,%r9
+  803183:	00 00 00 
+  803186:	41 ff d1             	call   *%r9
+
+0000000000803189 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803189:	55                   	push   %rbp
+  80318a:	48 89 e5             	mov    %rsp,%rbp
+  80318d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80318e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803193:	ba 00 00 00 00       	mov    $0x0,%edx
+  803198:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80319d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8031a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8031b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8031b8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8031ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031be:	c9                   	leave
+  8031bf:	c3                   	ret
+
+00000000008031c0 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8031c0:	55                   	push   %rbp
+  8031c1:	48 89 e5             	mov    %rsp,%rbp
+  8031c4:	53                   	push   %rbx
+  8031c5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8031c8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8031cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8031d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8031dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8031e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8031ed:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  8031ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031f3:	c9                   	leave
+  8031f4:	c3                   	ret
+
+00000000008031f5 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  8031f5:	55                   	push   %rbp
+  8031f6:	48 89 e5             	mov    %rsp,%rbp
+  8031f9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8031fa:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8031ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  803204:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803209:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80320e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803213:	be 00 00 00 00       	mov    $0x0,%esi
+  803218:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80321e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803224:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803226:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80322a:	c9                   	leave
+  80322b:	c3                   	ret
+
+000000000080322c <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  80322c:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  80322f:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  803233:	83 3f 01             	cmpl   $0x1,(%rdi)
+  803236:	7e 0f                	jle    803247 <argstart+0x1b>
+  803238:	48 b8 ea 61 80 00 00 	movabs $0x8061ea,%rax
+  80323f:	00 00 00 
+  803242:	48 85 f6             	test   %rsi,%rsi
+  803245:	75 05                	jne    80324c <argstart+0x20>
+  803247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324c:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  803250:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  803257:	00 
+}
+  803258:	c3                   	ret
+
+0000000000803259 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  803259:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  803260:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  803261:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  803265:	48 85 c0             	test   %rax,%rax
+  803268:	0f 84 8f 00 00 00    	je     8032fd <argnext+0xa4>
+argnext(struct Argstate *args) {
+  80326e:	55                   	push   %rbp
+  80326f:	48 89 e5             	mov    %rsp,%rbp
+  803272:	53                   	push   %rbx
+  803273:	48 83 ec 08          	sub    $0x8,%rsp
+  803277:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  80327a:	80 38 00             	cmpb   $0x0,(%rax)
+  80327d:	75 52                	jne    8032d1 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  80327f:	48 8b 17             	mov    (%rdi),%rdx
+  803282:	83 3a 01             	cmpl   $0x1,(%rdx)
+  803285:	74 67                	je     8032ee <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  803287:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  80328b:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  80328f:	80 38 2d             	cmpb   $0x2d,(%rax)
+  803292:	75 5a                	jne    8032ee <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  803294:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  803298:	74 54                	je     8032ee <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  80329a:	48 83 c0 01          	add    $0x1,%rax
+  80329e:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8032a2:	8b 12                	mov    (%rdx),%edx
+  8032a4:	83 ea 01             	sub    $0x1,%edx
+  8032a7:	48 63 d2             	movslq %edx,%rdx
+  8032aa:	48 c1 e2 03          	shl    $0x3,%rdx
+  8032ae:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8032b2:	48 83 c7 08          	add    $0x8,%rdi
+  8032b6:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  8032bd:	00 00 00 
+  8032c0:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  8032c2:	48 8b 03             	mov    (%rbx),%rax
+  8032c5:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  8032c8:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8032cc:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8032cf:	74 17                	je     8032e8 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  8032d1:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8032d5:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  8032d8:	48 83 c0 01          	add    $0x1,%rax
+  8032dc:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  8032e0:	89 d0                	mov    %edx,%eax
+  8032e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032e6:	c9                   	leave
+  8032e7:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  8032e8:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8032ec:	75 e3                	jne    8032d1 <argnext+0x78>
+    args->curarg = 0;
+  8032ee:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8032f5:	00 
+    return -1;
+  8032f6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8032fb:	eb e3                	jmp    8032e0 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  8032fd:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  803302:	89 d0                	mov    %edx,%eax
+  803304:	c3                   	ret
+
+0000000000803305 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  803305:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  803309:	48 85 c0             	test   %rax,%rax
+  80330c:	74 7b                	je     803389 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  80330e:	55                   	push   %rbp
+  80330f:	48 89 e5             	mov    %rsp,%rbp
+  803312:	53                   	push   %rbx
+  803313:	48 83 ec 08          	sub    $0x8,%rsp
+  803317:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  80331a:	80 38 00             	cmpb   $0x0,(%rax)
+  80331d:	74 1c                	je     80333b <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  80331f:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  803323:	48 b8 ea 61 80 00 00 	movabs $0x8061ea,%rax
+  80332a:	00 00 00 
+  80332d:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  803331:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  803335:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803339:	c9                   	leave
+  80333a:	c3                   	ret
+    } else if (*args->argc > 1) {
+  80333b:	48 8b 07             	mov    (%rdi),%rax
+  80333e:	83 38 01             	cmpl   $0x1,(%rax)
+  803341:	7f 12                	jg     803355 <argnextvalue+0x50>
+        args->argvalue = 0;
+  803343:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  80334a:	00 
+        args->curarg = 0;
+  80334b:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  803352:	00 
+  803353:	eb dc                	jmp    803331 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  803355:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  803359:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80335d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  803361:	8b 10                	mov    (%rax),%edx
+  803363:	83 ea 01             	sub    $0x1,%edx
+  803366:	48 63 d2             	movslq %edx,%rdx
+  803369:	48 c1 e2 03          	shl    $0x3,%rdx
+  80336d:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  803371:	48 83 c7 08          	add    $0x8,%rdi
+  803375:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+        (*args->argc)--;
+  803381:	48 8b 03             	mov    (%rbx),%rax
+  803384:	83 28 01             	subl   $0x1,(%rax)
+  803387:	eb a8                	jmp    803331 <argnextvalue+0x2c>
+}
+  803389:	c3                   	ret
+
+000000000080338a <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  80338a:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  80338e:	48 85 c0             	test   %rax,%rax
+  803391:	74 01                	je     803394 <argvalue+0xa>
+}
+  803393:	c3                   	ret
+argvalue(struct Argstate *args) {
+  803394:	55                   	push   %rbp
+  803395:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  803398:	48 b8 05 33 80 00 00 	movabs $0x803305,%rax
+  80339f:	00 00 00 
+  8033a2:	ff d0                	call   *%rax
+}
+  8033a4:	5d                   	pop    %rbp
+  8033a5:	c3                   	ret
+
+00000000008033a6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033a6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8033ad:	ff ff ff 
+  8033b0:	48 01 f8             	add    %rdi,%rax
+  8033b3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8033b7:	c3                   	ret
+
+00000000008033b8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033b8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8033bf:	ff ff ff 
+  8033c2:	48 01 f8             	add    %rdi,%rax
+  8033c5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8033c9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8033cf:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8033d3:	c3                   	ret
+
+00000000008033d4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8033d4:	55                   	push   %rbp
+  8033d5:	48 89 e5             	mov    %rsp,%rbp
+  8033d8:	41 57                	push   %r15
+  8033da:	41 56                	push   %r14
+  8033dc:	41 55                	push   %r13
+  8033de:	41 54                	push   %r12
+  8033e0:	53                   	push   %rbx
+  8033e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8033e5:	49 89 ff             	mov    %rdi,%r15
+  8033e8:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8033ed:	49 bd d4 48 80 00 00 	movabs $0x8048d4,%r13
+  8033f4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8033f7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8033fd:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803400:	48 89 df             	mov    %rbx,%rdi
+  803403:	41 ff d5             	call   *%r13
+  803406:	83 e0 04             	and    $0x4,%eax
+  803409:	74 17                	je     803422 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80340b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803412:	4c 39 f3             	cmp    %r14,%rbx
+  803415:	75 e6                	jne    8033fd <fd_alloc+0x29>
+  803417:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80341d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803422:	4d 89 27             	mov    %r12,(%r15)
+}
+  803425:	48 83 c4 08          	add    $0x8,%rsp
+  803429:	5b                   	pop    %rbx
+  80342a:	41 5c                	pop    %r12
+  80342c:	41 5d                	pop    %r13
+  80342e:	41 5e                	pop    %r14
+  803430:	41 5f                	pop    %r15
+  803432:	5d                   	pop    %rbp
+  803433:	c3                   	ret
+
+0000000000803434 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803434:	83 ff 1f             	cmp    $0x1f,%edi
+  803437:	77 39                	ja     803472 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803439:	55                   	push   %rbp
+  80343a:	48 89 e5             	mov    %rsp,%rbp
+  80343d:	41 54                	push   %r12
+  80343f:	53                   	push   %rbx
+  803440:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803443:	48 63 df             	movslq %edi,%rbx
+  803446:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80344d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803451:	48 89 df             	mov    %rbx,%rdi
+  803454:	48 b8 d4 48 80 00 00 	movabs $0x8048d4,%rax
+  80345b:	00 00 00 
+  80345e:	ff d0                	call   *%rax
+  803460:	a8 04                	test   $0x4,%al
+  803462:	74 14                	je     803478 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803464:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80346d:	5b                   	pop    %rbx
+  80346e:	41 5c                	pop    %r12
+  803470:	5d                   	pop    %rbp
+  803471:	c3                   	ret
+        return -E_INVAL;
+  803472:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803477:	c3                   	ret
+        return -E_INVAL;
+  803478:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80347d:	eb ee                	jmp    80346d <fd_lookup+0x39>
+
+000000000080347f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80347f:	55                   	push   %rbp
+  803480:	48 89 e5             	mov    %rsp,%rbp
+  803483:	41 54                	push   %r12
+  803485:	53                   	push   %rbx
+  803486:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803489:	48 b8 20 68 80 00 00 	movabs $0x806820,%rax
+  803490:	00 00 00 
+  803493:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  80349a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80349d:	39 3b                	cmp    %edi,(%rbx)
+  80349f:	74 47                	je     8034e8 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8034a1:	48 83 c0 08          	add    $0x8,%rax
+  8034a5:	48 8b 18             	mov    (%rax),%rbx
+  8034a8:	48 85 db             	test   %rbx,%rbx
+  8034ab:	75 f0                	jne    80349d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8034ad:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8034b4:	00 00 00 
+  8034b7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034bd:	89 fa                	mov    %edi,%edx
+  8034bf:	48 bf 98 67 80 00 00 	movabs $0x806798,%rdi
+  8034c6:	00 00 00 
+  8034c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ce:	48 b9 32 1b 80 00 00 	movabs $0x801b32,%rcx
+  8034d5:	00 00 00 
+  8034d8:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8034da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8034df:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8034e3:	5b                   	pop    %rbx
+  8034e4:	41 5c                	pop    %r12
+  8034e6:	5d                   	pop    %rbp
+  8034e7:	c3                   	ret
+            return 0;
+  8034e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ed:	eb f0                	jmp    8034df <dev_lookup+0x60>
+
+00000000008034ef <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+  8034f3:	41 55                	push   %r13
+  8034f5:	41 54                	push   %r12
+  8034f7:	53                   	push   %rbx
+  8034f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8034fc:	48 89 fb             	mov    %rdi,%rbx
+  8034ff:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803502:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803509:	ff ff ff 
+  80350c:	48 01 df             	add    %rbx,%rdi
+  80350f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803513:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803517:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  80351e:	00 00 00 
+  803521:	ff d0                	call   *%rax
+  803523:	41 89 c5             	mov    %eax,%r13d
+  803526:	85 c0                	test   %eax,%eax
+  803528:	78 06                	js     803530 <fd_close+0x41>
+  80352a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80352e:	74 1a                	je     80354a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803530:	45 84 e4             	test   %r12b,%r12b
+  803533:	b8 00 00 00 00       	mov    $0x0,%eax
+  803538:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80353c:	44 89 e8             	mov    %r13d,%eax
+  80353f:	48 83 c4 18          	add    $0x18,%rsp
+  803543:	5b                   	pop    %rbx
+  803544:	41 5c                	pop    %r12
+  803546:	41 5d                	pop    %r13
+  803548:	5d                   	pop    %rbp
+  803549:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80354a:	8b 3b                	mov    (%rbx),%edi
+  80354c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803550:	48 b8 7f 34 80 00 00 	movabs $0x80347f,%rax
+  803557:	00 00 00 
+  80355a:	ff d0                	call   *%rax
+  80355c:	41 89 c5             	mov    %eax,%r13d
+  80355f:	85 c0                	test   %eax,%eax
+  803561:	78 1b                	js     80357e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803563:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803567:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80356b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803571:	48 85 c0             	test   %rax,%rax
+  803574:	74 08                	je     80357e <fd_close+0x8f>
+  803576:	48 89 df             	mov    %rbx,%rdi
+  803579:	ff d0                	call   *%rax
+  80357b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80357e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803583:	48 89 de             	mov    %rbx,%rsi
+  803586:	bf 00 00 00 00       	mov    $0x0,%edi
+  80358b:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  803592:	00 00 00 
+  803595:	ff d0                	call   *%rax
+    return res;
+  803597:	eb a3                	jmp    80353c <fd_close+0x4d>
+
+0000000000803599 <close>:
+
+int
+close(int fdnum) {
+  803599:	55                   	push   %rbp
+  80359a:	48 89 e5             	mov    %rsp,%rbp
+  80359d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035a1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035a5:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  8035ac:	00 00 00 
+  8035af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035b1:	85 c0                	test   %eax,%eax
+  8035b3:	78 15                	js     8035ca <close+0x31>
+
+    return fd_close(fd, 1);
+  8035b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8035ba:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035be:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+}
+  8035ca:	c9                   	leave
+  8035cb:	c3                   	ret
+
+00000000008035cc <close_all>:
+
+void
+close_all(void) {
+  8035cc:	55                   	push   %rbp
+  8035cd:	48 89 e5             	mov    %rsp,%rbp
+  8035d0:	41 54                	push   %r12
+  8035d2:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8035d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035d8:	49 bc 99 35 80 00 00 	movabs $0x803599,%r12
+  8035df:	00 00 00 
+  8035e2:	89 df                	mov    %ebx,%edi
+  8035e4:	41 ff d4             	call   *%r12
+  8035e7:	83 c3 01             	add    $0x1,%ebx
+  8035ea:	83 fb 20             	cmp    $0x20,%ebx
+  8035ed:	75 f3                	jne    8035e2 <close_all+0x16>
+}
+  8035ef:	5b                   	pop    %rbx
+  8035f0:	41 5c                	pop    %r12
+  8035f2:	5d                   	pop    %rbp
+  8035f3:	c3                   	ret
+
+00000000008035f4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8035f4:	55                   	push   %rbp
+  8035f5:	48 89 e5             	mov    %rsp,%rbp
+  8035f8:	41 57                	push   %r15
+  8035fa:	41 56                	push   %r14
+  8035fc:	41 55                	push   %r13
+  8035fe:	41 54                	push   %r12
+  803600:	53                   	push   %rbx
+  803601:	48 83 ec 18          	sub    $0x18,%rsp
+  803605:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803608:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80360c:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  803613:	00 00 00 
+  803616:	ff d0                	call   *%rax
+  803618:	89 c3                	mov    %eax,%ebx
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	0f 88 b8 00 00 00    	js     8036da <dup+0xe6>
+    close(newfdnum);
+  803622:	44 89 e7             	mov    %r12d,%edi
+  803625:	48 b8 99 35 80 00 00 	movabs $0x803599,%rax
+  80362c:	00 00 00 
+  80362f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803631:	4d 63 ec             	movslq %r12d,%r13
+  803634:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80363b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80363f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803643:	4c 89 ff             	mov    %r15,%rdi
+  803646:	49 be b8 33 80 00 00 	movabs $0x8033b8,%r14
+  80364d:	00 00 00 
+  803650:	41 ff d6             	call   *%r14
+  803653:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803656:	4c 89 ef             	mov    %r13,%rdi
+  803659:	41 ff d6             	call   *%r14
+  80365c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80365f:	48 89 df             	mov    %rbx,%rdi
+  803662:	48 b8 d4 48 80 00 00 	movabs $0x8048d4,%rax
+  803669:	00 00 00 
+  80366c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80366e:	a8 04                	test   $0x4,%al
+  803670:	74 2b                	je     80369d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803672:	41 89 c1             	mov    %eax,%r9d
+  803675:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80367b:	4c 89 f1             	mov    %r14,%rcx
+  80367e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803683:	48 89 de             	mov    %rbx,%rsi
+  803686:	bf 00 00 00 00       	mov    $0x0,%edi
+  80368b:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+  803697:	89 c3                	mov    %eax,%ebx
+  803699:	85 c0                	test   %eax,%eax
+  80369b:	78 4e                	js     8036eb <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80369d:	4c 89 ff             	mov    %r15,%rdi
+  8036a0:	48 b8 d4 48 80 00 00 	movabs $0x8048d4,%rax
+  8036a7:	00 00 00 
+  8036aa:	ff d0                	call   *%rax
+  8036ac:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8036af:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8036b5:	4c 89 e9             	mov    %r13,%rcx
+  8036b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036bd:	4c 89 fe             	mov    %r15,%rsi
+  8036c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c5:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  8036cc:	00 00 00 
+  8036cf:	ff d0                	call   *%rax
+  8036d1:	89 c3                	mov    %eax,%ebx
+  8036d3:	85 c0                	test   %eax,%eax
+  8036d5:	78 14                	js     8036eb <dup+0xf7>
+
+    return newfdnum;
+  8036d7:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8036da:	89 d8                	mov    %ebx,%eax
+  8036dc:	48 83 c4 18          	add    $0x18,%rsp
+  8036e0:	5b                   	pop    %rbx
+  8036e1:	41 5c                	pop    %r12
+  8036e3:	41 5d                	pop    %r13
+  8036e5:	41 5e                	pop    %r14
+  8036e7:	41 5f                	pop    %r15
+  8036e9:	5d                   	pop    %rbp
+  8036ea:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8036eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036f0:	4c 89 ee             	mov    %r13,%rsi
+  8036f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f8:	49 bc a6 2c 80 00 00 	movabs $0x802ca6,%r12
+  8036ff:	00 00 00 
+  803702:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803705:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80370a:	4c 89 f6             	mov    %r14,%rsi
+  80370d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803712:	41 ff d4             	call   *%r12
+    return res;
+  803715:	eb c3                	jmp    8036da <dup+0xe6>
+
+0000000000803717 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803717:	55                   	push   %rbp
+  803718:	48 89 e5             	mov    %rsp,%rbp
+  80371b:	41 56                	push   %r14
+  80371d:	41 55                	push   %r13
+  80371f:	41 54                	push   %r12
+  803721:	53                   	push   %rbx
+  803722:	48 83 ec 10          	sub    $0x10,%rsp
+  803726:	89 fb                	mov    %edi,%ebx
+  803728:	49 89 f4             	mov    %rsi,%r12
+  80372b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80372e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803732:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  803739:	00 00 00 
+  80373c:	ff d0                	call   *%rax
+  80373e:	85 c0                	test   %eax,%eax
+  803740:	78 4c                	js     80378e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803742:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803746:	41 8b 3e             	mov    (%r14),%edi
+  803749:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80374d:	48 b8 7f 34 80 00 00 	movabs $0x80347f,%rax
+  803754:	00 00 00 
+  803757:	ff d0                	call   *%rax
+  803759:	85 c0                	test   %eax,%eax
+  80375b:	78 35                	js     803792 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80375d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803761:	83 e0 03             	and    $0x3,%eax
+  803764:	83 f8 01             	cmp    $0x1,%eax
+  803767:	74 2d                	je     803796 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803769:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80376d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803771:	48 85 c0             	test   %rax,%rax
+  803774:	74 56                	je     8037cc <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803776:	4c 89 ea             	mov    %r13,%rdx
+  803779:	4c 89 e6             	mov    %r12,%rsi
+  80377c:	4c 89 f7             	mov    %r14,%rdi
+  80377f:	ff d0                	call   *%rax
+}
+  803781:	48 83 c4 10          	add    $0x10,%rsp
+  803785:	5b                   	pop    %rbx
+  803786:	41 5c                	pop    %r12
+  803788:	41 5d                	pop    %r13
+  80378a:	41 5e                	pop    %r14
+  80378c:	5d                   	pop    %rbp
+  80378d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80378e:	48 98                	cltq
+  803790:	eb ef                	jmp    803781 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803792:	48 98                	cltq
+  803794:	eb eb                	jmp    803781 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803796:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  80379d:	00 00 00 
+  8037a0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8037a6:	89 da                	mov    %ebx,%edx
+  8037a8:	48 bf d9 67 80 00 00 	movabs $0x8067d9,%rdi
+  8037af:	00 00 00 
+  8037b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b7:	48 b9 32 1b 80 00 00 	movabs $0x801b32,%rcx
+  8037be:	00 00 00 
+  8037c1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8037c3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037ca:	eb b5                	jmp    803781 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8037cc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8037d3:	eb ac                	jmp    803781 <read+0x6a>
+
+00000000008037d5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8037d5:	55                   	push   %rbp
+  8037d6:	48 89 e5             	mov    %rsp,%rbp
+  8037d9:	41 57                	push   %r15
+  8037db:	41 56                	push   %r14
+  8037dd:	41 55                	push   %r13
+  8037df:	41 54                	push   %r12
+  8037e1:	53                   	push   %rbx
+  8037e2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8037e6:	48 85 d2             	test   %rdx,%rdx
+  8037e9:	74 54                	je     80383f <readn+0x6a>
+  8037eb:	41 89 fd             	mov    %edi,%r13d
+  8037ee:	49 89 f6             	mov    %rsi,%r14
+  8037f1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8037f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8037f9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8037fe:	49 bf 17 37 80 00 00 	movabs $0x803717,%r15
+  803805:	00 00 00 
+  803808:	4c 89 e2             	mov    %r12,%rdx
+  80380b:	48 29 f2             	sub    %rsi,%rdx
+  80380e:	4c 01 f6             	add    %r14,%rsi
+  803811:	44 89 ef             	mov    %r13d,%edi
+  803814:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803817:	85 c0                	test   %eax,%eax
+  803819:	78 20                	js     80383b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80381b:	01 c3                	add    %eax,%ebx
+  80381d:	85 c0                	test   %eax,%eax
+  80381f:	74 08                	je     803829 <readn+0x54>
+  803821:	48 63 f3             	movslq %ebx,%rsi
+  803824:	4c 39 e6             	cmp    %r12,%rsi
+  803827:	72 df                	jb     803808 <readn+0x33>
+    }
+    return res;
+  803829:	48 63 c3             	movslq %ebx,%rax
+}
+  80382c:	48 83 c4 08          	add    $0x8,%rsp
+  803830:	5b                   	pop    %rbx
+  803831:	41 5c                	pop    %r12
+  803833:	41 5d                	pop    %r13
+  803835:	41 5e                	pop    %r14
+  803837:	41 5f                	pop    %r15
+  803839:	5d                   	pop    %rbp
+  80383a:	c3                   	ret
+        if (inc < 0) return inc;
+  80383b:	48 98                	cltq
+  80383d:	eb ed                	jmp    80382c <readn+0x57>
+    int inc = 1, res = 0;
+  80383f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803844:	eb e3                	jmp    803829 <readn+0x54>
+
+0000000000803846 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803846:	55                   	push   %rbp
+  803847:	48 89 e5             	mov    %rsp,%rbp
+  80384a:	41 56                	push   %r14
+  80384c:	41 55                	push   %r13
+  80384e:	41 54                	push   %r12
+  803850:	53                   	push   %rbx
+  803851:	48 83 ec 10          	sub    $0x10,%rsp
+  803855:	89 fb                	mov    %edi,%ebx
+  803857:	49 89 f4             	mov    %rsi,%r12
+  80385a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80385d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803861:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+  80386d:	85 c0                	test   %eax,%eax
+  80386f:	78 47                	js     8038b8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803871:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803875:	41 8b 3e             	mov    (%r14),%edi
+  803878:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80387c:	48 b8 7f 34 80 00 00 	movabs $0x80347f,%rax
+  803883:	00 00 00 
+  803886:	ff d0                	call   *%rax
+  803888:	85 c0                	test   %eax,%eax
+  80388a:	78 30                	js     8038bc <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80388c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803891:	74 2d                	je     8038c0 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803893:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803897:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80389b:	48 85 c0             	test   %rax,%rax
+  80389e:	74 56                	je     8038f6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8038a0:	4c 89 ea             	mov    %r13,%rdx
+  8038a3:	4c 89 e6             	mov    %r12,%rsi
+  8038a6:	4c 89 f7             	mov    %r14,%rdi
+  8038a9:	ff d0                	call   *%rax
+}
+  8038ab:	48 83 c4 10          	add    $0x10,%rsp
+  8038af:	5b                   	pop    %rbx
+  8038b0:	41 5c                	pop    %r12
+  8038b2:	41 5d                	pop    %r13
+  8038b4:	41 5e                	pop    %r14
+  8038b6:	5d                   	pop    %rbp
+  8038b7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038b8:	48 98                	cltq
+  8038ba:	eb ef                	jmp    8038ab <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038bc:	48 98                	cltq
+  8038be:	eb eb                	jmp    8038ab <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8038c0:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8038c7:	00 00 00 
+  8038ca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8038d0:	89 da                	mov    %ebx,%edx
+  8038d2:	48 bf f5 67 80 00 00 	movabs $0x8067f5,%rdi
+  8038d9:	00 00 00 
+  8038dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e1:	48 b9 32 1b 80 00 00 	movabs $0x801b32,%rcx
+  8038e8:	00 00 00 
+  8038eb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8038ed:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8038f4:	eb b5                	jmp    8038ab <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8038f6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8038fd:	eb ac                	jmp    8038ab <write+0x65>
+
+00000000008038ff <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8038ff:	55                   	push   %rbp
+  803900:	48 89 e5             	mov    %rsp,%rbp
+  803903:	53                   	push   %rbx
+  803904:	48 83 ec 18          	sub    $0x18,%rsp
+  803908:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80390a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80390e:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  803915:	00 00 00 
+  803918:	ff d0                	call   *%rax
+  80391a:	85 c0                	test   %eax,%eax
+  80391c:	78 0c                	js     80392a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80391e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803922:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803925:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80392a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80392e:	c9                   	leave
+  80392f:	c3                   	ret
+
+0000000000803930 <tell>:
+
+int tell(int fdnum) {
+  803930:	55                   	push   %rbp
+  803931:	48 89 e5             	mov    %rsp,%rbp
+  803934:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803938:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80393c:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  803943:	00 00 00 
+  803946:	ff d0                	call   *%rax
+  803948:	85 c0                	test   %eax,%eax
+  80394a:	78 07                	js     803953 <tell+0x23>
+
+    return fd->fd_offset;
+  80394c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803950:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803953:	c9                   	leave
+  803954:	c3                   	ret
+
+0000000000803955 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803955:	55                   	push   %rbp
+  803956:	48 89 e5             	mov    %rsp,%rbp
+  803959:	41 55                	push   %r13
+  80395b:	41 54                	push   %r12
+  80395d:	53                   	push   %rbx
+  80395e:	48 83 ec 18          	sub    $0x18,%rsp
+  803962:	89 fb                	mov    %edi,%ebx
+  803964:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803967:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80396b:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  803972:	00 00 00 
+  803975:	ff d0                	call   *%rax
+  803977:	85 c0                	test   %eax,%eax
+  803979:	78 38                	js     8039b3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80397b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80397f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803983:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803987:	48 b8 7f 34 80 00 00 	movabs $0x80347f,%rax
+  80398e:	00 00 00 
+  803991:	ff d0                	call   *%rax
+  803993:	85 c0                	test   %eax,%eax
+  803995:	78 1c                	js     8039b3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803997:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80399c:	74 20                	je     8039be <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80399e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039a2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8039a6:	48 85 c0             	test   %rax,%rax
+  8039a9:	74 47                	je     8039f2 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8039ab:	44 89 e6             	mov    %r12d,%esi
+  8039ae:	4c 89 ef             	mov    %r13,%rdi
+  8039b1:	ff d0                	call   *%rax
+}
+  8039b3:	48 83 c4 18          	add    $0x18,%rsp
+  8039b7:	5b                   	pop    %rbx
+  8039b8:	41 5c                	pop    %r12
+  8039ba:	41 5d                	pop    %r13
+  8039bc:	5d                   	pop    %rbp
+  8039bd:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8039be:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8039c5:	00 00 00 
+  8039c8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8039ce:	89 da                	mov    %ebx,%edx
+  8039d0:	48 bf b8 67 80 00 00 	movabs $0x8067b8,%rdi
+  8039d7:	00 00 00 
+  8039da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039df:	48 b9 32 1b 80 00 00 	movabs $0x801b32,%rcx
+  8039e6:	00 00 00 
+  8039e9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8039eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039f0:	eb c1                	jmp    8039b3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8039f2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039f7:	eb ba                	jmp    8039b3 <ftruncate+0x5e>
+
+00000000008039f9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8039f9:	55                   	push   %rbp
+  8039fa:	48 89 e5             	mov    %rsp,%rbp
+  8039fd:	41 54                	push   %r12
+  8039ff:	53                   	push   %rbx
+  803a00:	48 83 ec 10          	sub    $0x10,%rsp
+  803a04:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a07:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803a0b:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  803a12:	00 00 00 
+  803a15:	ff d0                	call   *%rax
+  803a17:	85 c0                	test   %eax,%eax
+  803a19:	78 63                	js     803a7e <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803a1b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803a1f:	41 8b 3c 24          	mov    (%r12),%edi
+  803a23:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803a27:	48 b8 7f 34 80 00 00 	movabs $0x80347f,%rax
+  803a2e:	00 00 00 
+  803a31:	ff d0                	call   *%rax
+  803a33:	85 c0                	test   %eax,%eax
+  803a35:	78 47                	js     803a7e <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a3b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803a40:	74 45                	je     803a87 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803a42:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803a45:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803a4c:	00 00 00 
+    stat->st_isdir = 0;
+  803a4f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a56:	00 00 00 
+    stat->st_ino = 0;
+  803a59:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803a60:	00 00 00 00 
+    stat->st_version = 0;
+  803a64:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803a6b:	00 00 00 
+    stat->st_dev = dev;
+  803a6e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803a75:	48 89 de             	mov    %rbx,%rsi
+  803a78:	4c 89 e7             	mov    %r12,%rdi
+  803a7b:	ff 50 28             	call   *0x28(%rax)
+}
+  803a7e:	48 83 c4 10          	add    $0x10,%rsp
+  803a82:	5b                   	pop    %rbx
+  803a83:	41 5c                	pop    %r12
+  803a85:	5d                   	pop    %rbp
+  803a86:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a87:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a8c:	eb f0                	jmp    803a7e <fstat+0x85>
+
+0000000000803a8e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803a8e:	55                   	push   %rbp
+  803a8f:	48 89 e5             	mov    %rsp,%rbp
+  803a92:	41 54                	push   %r12
+  803a94:	53                   	push   %rbx
+  803a95:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803a98:	be 00 00 00 00       	mov    $0x0,%esi
+  803a9d:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  803aa4:	00 00 00 
+  803aa7:	ff d0                	call   *%rax
+  803aa9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803aab:	85 c0                	test   %eax,%eax
+  803aad:	78 25                	js     803ad4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803aaf:	4c 89 e6             	mov    %r12,%rsi
+  803ab2:	89 c7                	mov    %eax,%edi
+  803ab4:	48 b8 f9 39 80 00 00 	movabs $0x8039f9,%rax
+  803abb:	00 00 00 
+  803abe:	ff d0                	call   *%rax
+  803ac0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803ac3:	89 df                	mov    %ebx,%edi
+  803ac5:	48 b8 99 35 80 00 00 	movabs $0x803599,%rax
+  803acc:	00 00 00 
+  803acf:	ff d0                	call   *%rax
+
+    return res;
+  803ad1:	44 89 e3             	mov    %r12d,%ebx
+}
+  803ad4:	89 d8                	mov    %ebx,%eax
+  803ad6:	5b                   	pop    %rbx
+  803ad7:	41 5c                	pop    %r12
+  803ad9:	5d                   	pop    %rbp
+  803ada:	c3                   	ret
+
+0000000000803adb <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803adb:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803ae2:	00 00 00 
+  803ae5:	83 38 00             	cmpl   $0x0,(%rax)
+  803ae8:	74 0a                	je     803af4 <fsipc_env+0x19>
+    return fsenv;
+}
+  803aea:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803af1:	00 00 
+  803af3:	c3                   	ret
+fsipc_env(void) {
+  803af4:	55                   	push   %rbp
+  803af5:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803af8:	bf 03 00 00 00       	mov    $0x3,%edi
+  803afd:	48 b8 de 5b 80 00 00 	movabs $0x805bde,%rax
+  803b04:	00 00 00 
+  803b07:	ff d0                	call   *%rax
+  803b09:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803b10:	00 00 
+}
+  803b12:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803b19:	00 00 
+  803b1b:	5d                   	pop    %rbp
+  803b1c:	c3                   	ret
+
+0000000000803b1d <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803b1d:	55                   	push   %rbp
+  803b1e:	48 89 e5             	mov    %rsp,%rbp
+  803b21:	53                   	push   %rbx
+  803b22:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803b26:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803b2d:	00 
+  803b2e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803b35:	00 
+  803b36:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803b3d:	00 
+  803b3e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803b45:	00 
+  803b46:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803b4d:	00 
+
+    assert(size <= sizeof(words));
+  803b4e:	48 83 fa 28          	cmp    $0x28,%rdx
+  803b52:	77 38                	ja     803b8c <fsipc_short+0x6f>
+  803b54:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803b56:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b5a:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  803b61:	00 00 00 
+  803b64:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803b66:	48 b8 db 3a 80 00 00 	movabs $0x803adb,%rax
+  803b6d:	00 00 00 
+  803b70:	ff d0                	call   *%rax
+  803b72:	89 c7                	mov    %eax,%edi
+  803b74:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803b78:	89 de                	mov    %ebx,%esi
+  803b7a:	48 b8 41 5b 80 00 00 	movabs $0x805b41,%rax
+  803b81:	00 00 00 
+  803b84:	ff d0                	call   *%rax
+}
+  803b86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b8a:	c9                   	leave
+  803b8b:	c3                   	ret
+    assert(size <= sizeof(words));
+  803b8c:	48 b9 40 68 80 00 00 	movabs $0x806840,%rcx
+  803b93:	00 00 00 
+  803b96:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803b9d:	00 00 00 
+  803ba0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803ba5:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803bac:	00 00 00 
+  803baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb4:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  803bbb:	00 00 00 
+  803bbe:	41 ff d0             	call   *%r8
+
+0000000000803bc1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803bc1:	55                   	push   %rbp
+  803bc2:	48 89 e5             	mov    %rsp,%rbp
+  803bc5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803bc9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bcc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803bcf:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803bd2:	ba 08 00 00 00       	mov    $0x8,%edx
+  803bd7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803bdb:	bf 02 00 00 00       	mov    $0x2,%edi
+  803be0:	48 b8 1d 3b 80 00 00 	movabs $0x803b1d,%rax
+  803be7:	00 00 00 
+  803bea:	ff d0                	call   *%rax
+}
+  803bec:	c9                   	leave
+  803bed:	c3                   	ret
+
+0000000000803bee <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803bee:	55                   	push   %rbp
+  803bef:	48 89 e5             	mov    %rsp,%rbp
+  803bf2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803bf6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bf9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803bfc:	ba 04 00 00 00       	mov    $0x4,%edx
+  803c01:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803c05:	bf 06 00 00 00       	mov    $0x6,%edi
+  803c0a:	48 b8 1d 3b 80 00 00 	movabs $0x803b1d,%rax
+  803c11:	00 00 00 
+  803c14:	ff d0                	call   *%rax
+}
+  803c16:	c9                   	leave
+  803c17:	c3                   	ret
+
+0000000000803c18 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803c18:	55                   	push   %rbp
+  803c19:	48 89 e5             	mov    %rsp,%rbp
+  803c1c:	41 54                	push   %r12
+  803c1e:	53                   	push   %rbx
+  803c1f:	48 83 ec 10          	sub    $0x10,%rsp
+  803c23:	89 fb                	mov    %edi,%ebx
+  803c25:	49 89 f4             	mov    %rsi,%r12
+  803c28:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803c2c:	48 b8 db 3a 80 00 00 	movabs $0x803adb,%rax
+  803c33:	00 00 00 
+  803c36:	ff d0                	call   *%rax
+  803c38:	89 c7                	mov    %eax,%edi
+  803c3a:	6a 00                	push   $0x0
+  803c3c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803c40:	50                   	push   %rax
+  803c41:	4d 89 e1             	mov    %r12,%r9
+  803c44:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803c4a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c4f:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803c56:	00 00 00 
+  803c59:	89 de                	mov    %ebx,%esi
+  803c5b:	48 b8 dc 5a 80 00 00 	movabs $0x805adc,%rax
+  803c62:	00 00 00 
+  803c65:	ff d0                	call   *%rax
+}
+  803c67:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c6b:	5b                   	pop    %rbx
+  803c6c:	41 5c                	pop    %r12
+  803c6e:	5d                   	pop    %rbp
+  803c6f:	c3                   	ret
+
+0000000000803c70 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803c70:	55                   	push   %rbp
+  803c71:	48 89 e5             	mov    %rsp,%rbp
+  803c74:	41 54                	push   %r12
+  803c76:	53                   	push   %rbx
+  803c77:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c7a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c7d:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803c84:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c86:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c8b:	be 00 00 00 00       	mov    $0x0,%esi
+  803c90:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c95:	48 b8 18 3c 80 00 00 	movabs $0x803c18,%rax
+  803c9c:	00 00 00 
+  803c9f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ca1:	85 c0                	test   %eax,%eax
+  803ca3:	78 5a                	js     803cff <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803ca5:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803cac:	00 00 00 
+  803caf:	4c 89 e6             	mov    %r12,%rsi
+  803cb2:	48 89 df             	mov    %rbx,%rdi
+  803cb5:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  803cbc:	00 00 00 
+  803cbf:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803cc1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803cc8:	00 
+  803cc9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ccf:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803cd6:	00 
+  803cd7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803cdd:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803ce4:	00 
+  803ce5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803cec:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803cf3:	00 
+  803cf4:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cff:	5b                   	pop    %rbx
+  803d00:	41 5c                	pop    %r12
+  803d02:	5d                   	pop    %rbp
+  803d03:	c3                   	ret
+
+0000000000803d04 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803d04:	55                   	push   %rbp
+  803d05:	48 89 e5             	mov    %rsp,%rbp
+  803d08:	41 57                	push   %r15
+  803d0a:	41 56                	push   %r14
+  803d0c:	41 55                	push   %r13
+  803d0e:	41 54                	push   %r12
+  803d10:	53                   	push   %rbx
+  803d11:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803d15:	48 85 ff             	test   %rdi,%rdi
+  803d18:	0f 84 a1 00 00 00    	je     803dbf <devfile_read+0xbb>
+  803d1e:	49 89 ff             	mov    %rdi,%r15
+  803d21:	49 89 f5             	mov    %rsi,%r13
+  803d24:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803d27:	48 85 f6             	test   %rsi,%rsi
+  803d2a:	0f 84 c4 00 00 00    	je     803df4 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803d30:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803d37:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803d38:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803d3f:	00 00 00 
+  803d42:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d46:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803d49:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d4d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d52:	be 00 00 00 00       	mov    $0x0,%esi
+  803d57:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d5c:	48 b8 18 3c 80 00 00 	movabs $0x803c18,%rax
+  803d63:	00 00 00 
+  803d66:	ff d0                	call   *%rax
+        if (res < 0) {
+  803d68:	85 c0                	test   %eax,%eax
+  803d6a:	0f 88 b9 00 00 00    	js     803e29 <devfile_read+0x125>
+        assert(res <= n);
+  803d70:	48 63 d8             	movslq %eax,%rbx
+  803d73:	49 39 dc             	cmp    %rbx,%r12
+  803d76:	0f 82 b1 00 00 00    	jb     803e2d <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803d7c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803d81:	0f 87 db 00 00 00    	ja     803e62 <devfile_read+0x15e>
+        if (!res) {
+  803d87:	85 c0                	test   %eax,%eax
+  803d89:	74 21                	je     803dac <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803d8b:	48 89 da             	mov    %rbx,%rdx
+  803d8e:	4c 89 f6             	mov    %r14,%rsi
+  803d91:	4c 89 ef             	mov    %r13,%rdi
+  803d94:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  803d9b:	00 00 00 
+  803d9e:	ff d0                	call   *%rax
+        total_read += res;
+  803da0:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803da4:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803da7:	49 29 dc             	sub    %rbx,%r12
+  803daa:	75 96                	jne    803d42 <devfile_read+0x3e>
+    return total_read;
+  803dac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803db0:	48 83 c4 18          	add    $0x18,%rsp
+  803db4:	5b                   	pop    %rbx
+  803db5:	41 5c                	pop    %r12
+  803db7:	41 5d                	pop    %r13
+  803db9:	41 5e                	pop    %r14
+  803dbb:	41 5f                	pop    %r15
+  803dbd:	5d                   	pop    %rbp
+  803dbe:	c3                   	ret
+    assert(fd);
+  803dbf:	48 b9 76 68 80 00 00 	movabs $0x806876,%rcx
+  803dc6:	00 00 00 
+  803dc9:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803dd0:	00 00 00 
+  803dd3:	be 91 00 00 00       	mov    $0x91,%esi
+  803dd8:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803ddf:	00 00 00 
+  803de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de7:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  803dee:	00 00 00 
+  803df1:	41 ff d0             	call   *%r8
+    assert(buf);
+  803df4:	48 b9 79 68 80 00 00 	movabs $0x806879,%rcx
+  803dfb:	00 00 00 
+  803dfe:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803e05:	00 00 00 
+  803e08:	be 92 00 00 00       	mov    $0x92,%esi
+  803e0d:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803e14:	00 00 00 
+  803e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1c:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  803e23:	00 00 00 
+  803e26:	41 ff d0             	call   *%r8
+            return res;
+  803e29:	48 98                	cltq
+  803e2b:	eb 83                	jmp    803db0 <devfile_read+0xac>
+        assert(res <= n);
+  803e2d:	48 b9 7d 68 80 00 00 	movabs $0x80687d,%rcx
+  803e34:	00 00 00 
+  803e37:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803e3e:	00 00 00 
+  803e41:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803e46:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803e4d:	00 00 00 
+  803e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e55:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  803e5c:	00 00 00 
+  803e5f:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803e62:	48 b9 88 68 80 00 00 	movabs $0x806888,%rcx
+  803e69:	00 00 00 
+  803e6c:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803e73:	00 00 00 
+  803e76:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803e7b:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803e82:	00 00 00 
+  803e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e8a:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  803e91:	00 00 00 
+  803e94:	41 ff d0             	call   *%r8
+
+0000000000803e97 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803e97:	55                   	push   %rbp
+  803e98:	48 89 e5             	mov    %rsp,%rbp
+  803e9b:	41 57                	push   %r15
+  803e9d:	41 56                	push   %r14
+  803e9f:	41 55                	push   %r13
+  803ea1:	41 54                	push   %r12
+  803ea3:	53                   	push   %rbx
+  803ea4:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803ea8:	48 85 ff             	test   %rdi,%rdi
+  803eab:	0f 84 83 00 00 00    	je     803f34 <devfile_write+0x9d>
+  803eb1:	49 89 ff             	mov    %rdi,%r15
+  803eb4:	49 89 f4             	mov    %rsi,%r12
+  803eb7:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803eba:	48 85 f6             	test   %rsi,%rsi
+  803ebd:	0f 84 a6 00 00 00    	je     803f69 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803ec3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ec9:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803ed0:	00 00 00 
+  803ed3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803ed7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803eda:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803ede:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803ee3:	48 39 d3             	cmp    %rdx,%rbx
+  803ee6:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803eea:	4c 89 e6             	mov    %r12,%rsi
+  803eed:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803ef4:	00 00 00 
+  803ef7:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  803efe:	00 00 00 
+  803f01:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f08:	be 00 00 00 00       	mov    $0x0,%esi
+  803f0d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803f12:	48 b8 18 3c 80 00 00 	movabs $0x803c18,%rax
+  803f19:	00 00 00 
+  803f1c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803f1e:	85 c0                	test   %eax,%eax
+  803f20:	78 7c                	js     803f9e <devfile_write+0x107>
+        total_written += res;
+  803f22:	48 98                	cltq
+  803f24:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803f27:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803f2a:	48 29 c3             	sub    %rax,%rbx
+  803f2d:	75 a4                	jne    803ed3 <devfile_write+0x3c>
+    return total_written;
+  803f2f:	4c 89 e8             	mov    %r13,%rax
+  803f32:	eb 6c                	jmp    803fa0 <devfile_write+0x109>
+    assert(fd);
+  803f34:	48 b9 76 68 80 00 00 	movabs $0x806876,%rcx
+  803f3b:	00 00 00 
+  803f3e:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803f45:	00 00 00 
+  803f48:	be bd 00 00 00       	mov    $0xbd,%esi
+  803f4d:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803f54:	00 00 00 
+  803f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5c:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  803f63:	00 00 00 
+  803f66:	41 ff d0             	call   *%r8
+    assert(buf);
+  803f69:	48 b9 79 68 80 00 00 	movabs $0x806879,%rcx
+  803f70:	00 00 00 
+  803f73:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803f7a:	00 00 00 
+  803f7d:	be be 00 00 00       	mov    $0xbe,%esi
+  803f82:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803f89:	00 00 00 
+  803f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f91:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  803f98:	00 00 00 
+  803f9b:	41 ff d0             	call   *%r8
+            return res;
+  803f9e:	48 98                	cltq
+}
+  803fa0:	48 83 c4 08          	add    $0x8,%rsp
+  803fa4:	5b                   	pop    %rbx
+  803fa5:	41 5c                	pop    %r12
+  803fa7:	41 5d                	pop    %r13
+  803fa9:	41 5e                	pop    %r14
+  803fab:	41 5f                	pop    %r15
+  803fad:	5d                   	pop    %rbp
+  803fae:	c3                   	ret
+
+0000000000803faf <open>:
+open(const char *path, int mode) {
+  803faf:	55                   	push   %rbp
+  803fb0:	48 89 e5             	mov    %rsp,%rbp
+  803fb3:	41 55                	push   %r13
+  803fb5:	41 54                	push   %r12
+  803fb7:	53                   	push   %rbx
+  803fb8:	48 83 ec 18          	sub    $0x18,%rsp
+  803fbc:	49 89 fc             	mov    %rdi,%r12
+  803fbf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803fc2:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  803fc9:	00 00 00 
+  803fcc:	ff d0                	call   *%rax
+  803fce:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803fd4:	0f 87 8f 00 00 00    	ja     804069 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803fda:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fde:	48 b8 d4 33 80 00 00 	movabs $0x8033d4,%rax
+  803fe5:	00 00 00 
+  803fe8:	ff d0                	call   *%rax
+  803fea:	89 c3                	mov    %eax,%ebx
+  803fec:	85 c0                	test   %eax,%eax
+  803fee:	78 55                	js     804045 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803ff0:	4c 89 e6             	mov    %r12,%rsi
+  803ff3:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803ffa:	00 00 00 
+  803ffd:	48 89 df             	mov    %rbx,%rdi
+  804000:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  804007:	00 00 00 
+  80400a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80400c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804013:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804018:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80401c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804021:	48 b8 18 3c 80 00 00 	movabs $0x803c18,%rax
+  804028:	00 00 00 
+  80402b:	ff d0                	call   *%rax
+  80402d:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80402f:	85 c0                	test   %eax,%eax
+  804031:	78 1f                	js     804052 <open+0xa3>
+    return fd2num(fd);
+  804033:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804037:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+  804043:	89 c3                	mov    %eax,%ebx
+}
+  804045:	89 d8                	mov    %ebx,%eax
+  804047:	48 83 c4 18          	add    $0x18,%rsp
+  80404b:	5b                   	pop    %rbx
+  80404c:	41 5c                	pop    %r12
+  80404e:	41 5d                	pop    %r13
+  804050:	5d                   	pop    %rbp
+  804051:	c3                   	ret
+        fd_close(fd, 0);
+  804052:	be 00 00 00 00       	mov    $0x0,%esi
+  804057:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80405b:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  804062:	00 00 00 
+  804065:	ff d0                	call   *%rax
+        return res;
+  804067:	eb dc                	jmp    804045 <open+0x96>
+        return -E_BAD_PATH;
+  804069:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80406e:	eb d5                	jmp    804045 <open+0x96>
+
+0000000000804070 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804070:	55                   	push   %rbp
+  804071:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  804074:	ba 00 00 00 00       	mov    $0x0,%edx
+  804079:	be 00 00 00 00       	mov    $0x0,%esi
+  80407e:	bf 08 00 00 00       	mov    $0x8,%edi
+  804083:	48 b8 1d 3b 80 00 00 	movabs $0x803b1d,%rax
+  80408a:	00 00 00 
+  80408d:	ff d0                	call   *%rax
+}
+  80408f:	5d                   	pop    %rbp
+  804090:	c3                   	ret
+
+0000000000804091 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  804091:	55                   	push   %rbp
+  804092:	48 89 e5             	mov    %rsp,%rbp
+  804095:	41 56                	push   %r14
+  804097:	41 55                	push   %r13
+  804099:	41 54                	push   %r12
+  80409b:	53                   	push   %rbx
+  80409c:	48 83 ec 10          	sub    $0x10,%rsp
+  8040a0:	41 89 f6             	mov    %esi,%r14d
+  8040a3:	49 89 d4             	mov    %rdx,%r12
+  8040a6:	48 89 cb             	mov    %rcx,%rbx
+  8040a9:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8040ac:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040b0:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  8040b7:	00 00 00 
+  8040ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040bc:	85 c0                	test   %eax,%eax
+  8040be:	78 46                	js     804106 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040c0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040c4:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8040cb:	00 00 00 
+  8040ce:	8b 00                	mov    (%rax),%eax
+  8040d0:	39 02                	cmp    %eax,(%rdx)
+  8040d2:	75 3f                	jne    804113 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8040d4:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  8040db:	00 00 00 
+  8040de:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8040e1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  8040e3:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  8040e7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  8040eb:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  8040ef:	48 89 da             	mov    %rbx,%rdx
+  8040f2:	4c 89 e6             	mov    %r12,%rsi
+  8040f5:	bf 09 00 00 00       	mov    $0x9,%edi
+  8040fa:	48 b8 18 3c 80 00 00 	movabs $0x803c18,%rax
+  804101:	00 00 00 
+  804104:	ff d0                	call   *%rax
+}
+  804106:	48 83 c4 10          	add    $0x10,%rsp
+  80410a:	5b                   	pop    %rbx
+  80410b:	41 5c                	pop    %r12
+  80410d:	41 5d                	pop    %r13
+  80410f:	41 5e                	pop    %r14
+  804111:	5d                   	pop    %rbp
+  804112:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804113:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804118:	eb ec                	jmp    804106 <file_map+0x75>
+
+000000000080411a <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80411a:	55                   	push   %rbp
+  80411b:	48 89 e5             	mov    %rsp,%rbp
+  80411e:	41 54                	push   %r12
+  804120:	53                   	push   %rbx
+  804121:	48 83 ec 20          	sub    $0x20,%rsp
+  804125:	41 89 f4             	mov    %esi,%r12d
+  804128:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80412b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80412f:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  804136:	00 00 00 
+  804139:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80413b:	85 c0                	test   %eax,%eax
+  80413d:	78 3c                	js     80417b <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80413f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804143:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80414a:	00 00 00 
+  80414d:	8b 0a                	mov    (%rdx),%ecx
+  80414f:	39 08                	cmp    %ecx,(%rax)
+  804151:	75 31                	jne    804184 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804153:	8b 40 0c             	mov    0xc(%rax),%eax
+  804156:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804159:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  80415d:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804161:	ba 10 00 00 00       	mov    $0x10,%edx
+  804166:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80416a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80416f:	48 b8 1d 3b 80 00 00 	movabs $0x803b1d,%rax
+  804176:	00 00 00 
+  804179:	ff d0                	call   *%rax
+}
+  80417b:	48 83 c4 20          	add    $0x20,%rsp
+  80417f:	5b                   	pop    %rbx
+  804180:	41 5c                	pop    %r12
+  804182:	5d                   	pop    %rbp
+  804183:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804184:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804189:	eb f0                	jmp    80417b <file_msync+0x61>
+
+000000000080418b <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80418b:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80418f:	7f 01                	jg     804192 <writebuf+0x7>
+  804191:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804192:	55                   	push   %rbp
+  804193:	48 89 e5             	mov    %rsp,%rbp
+  804196:	53                   	push   %rbx
+  804197:	48 83 ec 08          	sub    $0x8,%rsp
+  80419b:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80419e:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8041a2:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8041a6:	8b 3f                	mov    (%rdi),%edi
+  8041a8:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  8041af:	00 00 00 
+  8041b2:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8041b4:	48 85 c0             	test   %rax,%rax
+  8041b7:	7e 04                	jle    8041bd <writebuf+0x32>
+  8041b9:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8041bd:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8041c1:	48 39 c2             	cmp    %rax,%rdx
+  8041c4:	74 0f                	je     8041d5 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8041c6:	48 85 c0             	test   %rax,%rax
+  8041c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041ce:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8041d2:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8041d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041d9:	c9                   	leave
+  8041da:	c3                   	ret
+
+00000000008041db <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8041db:	8b 46 04             	mov    0x4(%rsi),%eax
+  8041de:	8d 50 01             	lea    0x1(%rax),%edx
+  8041e1:	89 56 04             	mov    %edx,0x4(%rsi)
+  8041e4:	48 98                	cltq
+  8041e6:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8041eb:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8041f1:	74 01                	je     8041f4 <putch+0x19>
+  8041f3:	c3                   	ret
+putch(int ch, void *arg) {
+  8041f4:	55                   	push   %rbp
+  8041f5:	48 89 e5             	mov    %rsp,%rbp
+  8041f8:	53                   	push   %rbx
+  8041f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8041fd:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804200:	48 89 f7             	mov    %rsi,%rdi
+  804203:	48 b8 8b 41 80 00 00 	movabs $0x80418b,%rax
+  80420a:	00 00 00 
+  80420d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80420f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804216:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80421a:	c9                   	leave
+  80421b:	c3                   	ret
+
+000000000080421c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80421c:	55                   	push   %rbp
+  80421d:	48 89 e5             	mov    %rsp,%rbp
+  804220:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804227:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80422a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804230:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804237:	00 00 00 
+    state.result = 0;
+  80423a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804241:	00 00 00 00 
+    state.error = 1;
+  804245:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80424c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80424f:	48 89 f2             	mov    %rsi,%rdx
+  804252:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804259:	48 bf db 41 80 00 00 	movabs $0x8041db,%rdi
+  804260:	00 00 00 
+  804263:	48 b8 82 1c 80 00 00 	movabs $0x801c82,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80426f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804276:	7f 14                	jg     80428c <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804278:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80427f:	48 85 c0             	test   %rax,%rax
+  804282:	75 06                	jne    80428a <vfprintf+0x6e>
+  804284:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80428a:	c9                   	leave
+  80428b:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80428c:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804293:	48 b8 8b 41 80 00 00 	movabs $0x80418b,%rax
+  80429a:	00 00 00 
+  80429d:	ff d0                	call   *%rax
+  80429f:	eb d7                	jmp    804278 <vfprintf+0x5c>
+
+00000000008042a1 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8042a1:	55                   	push   %rbp
+  8042a2:	48 89 e5             	mov    %rsp,%rbp
+  8042a5:	48 83 ec 50          	sub    $0x50,%rsp
+  8042a9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042ad:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042b1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042b5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8042b9:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8042c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042c8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8042cc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8042d0:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8042d4:	48 b8 1c 42 80 00 00 	movabs $0x80421c,%rax
+  8042db:	00 00 00 
+  8042de:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8042e0:	c9                   	leave
+  8042e1:	c3                   	ret
+
+00000000008042e2 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8042e2:	55                   	push   %rbp
+  8042e3:	48 89 e5             	mov    %rsp,%rbp
+  8042e6:	48 83 ec 50          	sub    $0x50,%rsp
+  8042ea:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8042ee:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042f6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042fa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8042fe:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804305:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804309:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80430d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804311:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804315:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804319:	48 89 fe             	mov    %rdi,%rsi
+  80431c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804321:	48 b8 1c 42 80 00 00 	movabs $0x80421c,%rax
+  804328:	00 00 00 
+  80432b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80432d:	c9                   	leave
+  80432e:	c3                   	ret
+
+000000000080432f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80432f:	55                   	push   %rbp
+  804330:	48 89 e5             	mov    %rsp,%rbp
+  804333:	41 54                	push   %r12
+  804335:	53                   	push   %rbx
+  804336:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804339:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+  804345:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804348:	48 be b0 68 80 00 00 	movabs $0x8068b0,%rsi
+  80434f:	00 00 00 
+  804352:	48 89 df             	mov    %rbx,%rdi
+  804355:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  80435c:	00 00 00 
+  80435f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804361:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804366:	41 2b 04 24          	sub    (%r12),%eax
+  80436a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804370:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804377:	00 00 00 
+    stat->st_dev = &devpipe;
+  80437a:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804381:	00 00 00 
+  804384:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80438b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804390:	5b                   	pop    %rbx
+  804391:	41 5c                	pop    %r12
+  804393:	5d                   	pop    %rbp
+  804394:	c3                   	ret
+
+0000000000804395 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804395:	55                   	push   %rbp
+  804396:	48 89 e5             	mov    %rsp,%rbp
+  804399:	41 54                	push   %r12
+  80439b:	53                   	push   %rbx
+  80439c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80439f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043a4:	48 89 fe             	mov    %rdi,%rsi
+  8043a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043ac:	49 bc a6 2c 80 00 00 	movabs $0x802ca6,%r12
+  8043b3:	00 00 00 
+  8043b6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8043b9:	48 89 df             	mov    %rbx,%rdi
+  8043bc:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  8043c3:	00 00 00 
+  8043c6:	ff d0                	call   *%rax
+  8043c8:	48 89 c6             	mov    %rax,%rsi
+  8043cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043d5:	41 ff d4             	call   *%r12
+}
+  8043d8:	5b                   	pop    %rbx
+  8043d9:	41 5c                	pop    %r12
+  8043db:	5d                   	pop    %rbp
+  8043dc:	c3                   	ret
+
+00000000008043dd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043dd:	55                   	push   %rbp
+  8043de:	48 89 e5             	mov    %rsp,%rbp
+  8043e1:	41 57                	push   %r15
+  8043e3:	41 56                	push   %r14
+  8043e5:	41 55                	push   %r13
+  8043e7:	41 54                	push   %r12
+  8043e9:	53                   	push   %rbx
+  8043ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8043ee:	49 89 fc             	mov    %rdi,%r12
+  8043f1:	49 89 f5             	mov    %rsi,%r13
+  8043f4:	49 89 d7             	mov    %rdx,%r15
+  8043f7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8043fb:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  804402:	00 00 00 
+  804405:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804407:	4d 85 ff             	test   %r15,%r15
+  80440a:	0f 84 af 00 00 00    	je     8044bf <devpipe_write+0xe2>
+  804410:	48 89 c3             	mov    %rax,%rbx
+  804413:	4c 89 f8             	mov    %r15,%rax
+  804416:	4d 89 ef             	mov    %r13,%r15
+  804419:	4c 01 e8             	add    %r13,%rax
+  80441c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804420:	49 bd 9c 2b 80 00 00 	movabs $0x802b9c,%r13
+  804427:	00 00 00 
+            sys_yield();
+  80442a:	49 be 2d 2b 80 00 00 	movabs $0x802b2d,%r14
+  804431:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804434:	8b 73 04             	mov    0x4(%rbx),%esi
+  804437:	48 63 ce             	movslq %esi,%rcx
+  80443a:	48 63 03             	movslq (%rbx),%rax
+  80443d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804443:	48 39 c1             	cmp    %rax,%rcx
+  804446:	72 2e                	jb     804476 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804448:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80444d:	48 89 da             	mov    %rbx,%rdx
+  804450:	be 00 10 00 00       	mov    $0x1000,%esi
+  804455:	4c 89 e7             	mov    %r12,%rdi
+  804458:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80445b:	85 c0                	test   %eax,%eax
+  80445d:	74 66                	je     8044c5 <devpipe_write+0xe8>
+            sys_yield();
+  80445f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804462:	8b 73 04             	mov    0x4(%rbx),%esi
+  804465:	48 63 ce             	movslq %esi,%rcx
+  804468:	48 63 03             	movslq (%rbx),%rax
+  80446b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804471:	48 39 c1             	cmp    %rax,%rcx
+  804474:	73 d2                	jae    804448 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804476:	41 0f b6 3f          	movzbl (%r15),%edi
+  80447a:	48 89 ca             	mov    %rcx,%rdx
+  80447d:	48 c1 ea 03          	shr    $0x3,%rdx
+  804481:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804488:	08 10 20 
+  80448b:	48 f7 e2             	mul    %rdx
+  80448e:	48 c1 ea 06          	shr    $0x6,%rdx
+  804492:	48 89 d0             	mov    %rdx,%rax
+  804495:	48 c1 e0 09          	shl    $0x9,%rax
+  804499:	48 29 d0             	sub    %rdx,%rax
+  80449c:	48 c1 e0 03          	shl    $0x3,%rax
+  8044a0:	48 29 c1             	sub    %rax,%rcx
+  8044a3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8044a8:	83 c6 01             	add    $0x1,%esi
+  8044ab:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8044ae:	49 83 c7 01          	add    $0x1,%r15
+  8044b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044b6:	49 39 c7             	cmp    %rax,%r15
+  8044b9:	0f 85 75 ff ff ff    	jne    804434 <devpipe_write+0x57>
+    return n;
+  8044bf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044c3:	eb 05                	jmp    8044ca <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8044c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044ca:	48 83 c4 18          	add    $0x18,%rsp
+  8044ce:	5b                   	pop    %rbx
+  8044cf:	41 5c                	pop    %r12
+  8044d1:	41 5d                	pop    %r13
+  8044d3:	41 5e                	pop    %r14
+  8044d5:	41 5f                	pop    %r15
+  8044d7:	5d                   	pop    %rbp
+  8044d8:	c3                   	ret
+
+00000000008044d9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044d9:	55                   	push   %rbp
+  8044da:	48 89 e5             	mov    %rsp,%rbp
+  8044dd:	41 57                	push   %r15
+  8044df:	41 56                	push   %r14
+  8044e1:	41 55                	push   %r13
+  8044e3:	41 54                	push   %r12
+  8044e5:	53                   	push   %rbx
+  8044e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8044ea:	49 89 fc             	mov    %rdi,%r12
+  8044ed:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044f1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044f5:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  8044fc:	00 00 00 
+  8044ff:	ff d0                	call   *%rax
+  804501:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804504:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80450a:	49 bd 9c 2b 80 00 00 	movabs $0x802b9c,%r13
+  804511:	00 00 00 
+            sys_yield();
+  804514:	49 be 2d 2b 80 00 00 	movabs $0x802b2d,%r14
+  80451b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80451e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804523:	74 7d                	je     8045a2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804525:	8b 03                	mov    (%rbx),%eax
+  804527:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80452a:	75 26                	jne    804552 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80452c:	4d 85 ff             	test   %r15,%r15
+  80452f:	75 77                	jne    8045a8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804531:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804536:	48 89 da             	mov    %rbx,%rdx
+  804539:	be 00 10 00 00       	mov    $0x1000,%esi
+  80453e:	4c 89 e7             	mov    %r12,%rdi
+  804541:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804544:	85 c0                	test   %eax,%eax
+  804546:	74 72                	je     8045ba <devpipe_read+0xe1>
+            sys_yield();
+  804548:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80454b:	8b 03                	mov    (%rbx),%eax
+  80454d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804550:	74 df                	je     804531 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804552:	48 63 c8             	movslq %eax,%rcx
+  804555:	48 89 ca             	mov    %rcx,%rdx
+  804558:	48 c1 ea 03          	shr    $0x3,%rdx
+  80455c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804563:	08 10 20 
+  804566:	48 89 d0             	mov    %rdx,%rax
+  804569:	48 f7 e6             	mul    %rsi
+  80456c:	48 c1 ea 06          	shr    $0x6,%rdx
+  804570:	48 89 d0             	mov    %rdx,%rax
+  804573:	48 c1 e0 09          	shl    $0x9,%rax
+  804577:	48 29 d0             	sub    %rdx,%rax
+  80457a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804581:	00 
+  804582:	48 89 c8             	mov    %rcx,%rax
+  804585:	48 29 d0             	sub    %rdx,%rax
+  804588:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80458d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804591:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804595:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804598:	49 83 c7 01          	add    $0x1,%r15
+  80459c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8045a0:	75 83                	jne    804525 <devpipe_read+0x4c>
+    return n;
+  8045a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045a6:	eb 03                	jmp    8045ab <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8045a8:	4c 89 f8             	mov    %r15,%rax
+}
+  8045ab:	48 83 c4 18          	add    $0x18,%rsp
+  8045af:	5b                   	pop    %rbx
+  8045b0:	41 5c                	pop    %r12
+  8045b2:	41 5d                	pop    %r13
+  8045b4:	41 5e                	pop    %r14
+  8045b6:	41 5f                	pop    %r15
+  8045b8:	5d                   	pop    %rbp
+  8045b9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8045ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045bf:	eb ea                	jmp    8045ab <devpipe_read+0xd2>
+
+00000000008045c1 <pipe>:
+pipe(int pfd[2]) {
+  8045c1:	55                   	push   %rbp
+  8045c2:	48 89 e5             	mov    %rsp,%rbp
+  8045c5:	41 55                	push   %r13
+  8045c7:	41 54                	push   %r12
+  8045c9:	53                   	push   %rbx
+  8045ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8045ce:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8045d1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8045d5:	48 b8 d4 33 80 00 00 	movabs $0x8033d4,%rax
+  8045dc:	00 00 00 
+  8045df:	ff d0                	call   *%rax
+  8045e1:	89 c3                	mov    %eax,%ebx
+  8045e3:	85 c0                	test   %eax,%eax
+  8045e5:	0f 88 a0 01 00 00    	js     80478b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8045eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045f5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8045f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045fe:	48 b8 ce 2b 80 00 00 	movabs $0x802bce,%rax
+  804605:	00 00 00 
+  804608:	ff d0                	call   *%rax
+  80460a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80460c:	85 c0                	test   %eax,%eax
+  80460e:	0f 88 77 01 00 00    	js     80478b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804614:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804618:	48 b8 d4 33 80 00 00 	movabs $0x8033d4,%rax
+  80461f:	00 00 00 
+  804622:	ff d0                	call   *%rax
+  804624:	89 c3                	mov    %eax,%ebx
+  804626:	85 c0                	test   %eax,%eax
+  804628:	0f 88 43 01 00 00    	js     804771 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80462e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804633:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804638:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80463c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804641:	48 b8 ce 2b 80 00 00 	movabs $0x802bce,%rax
+  804648:	00 00 00 
+  80464b:	ff d0                	call   *%rax
+  80464d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80464f:	85 c0                	test   %eax,%eax
+  804651:	0f 88 1a 01 00 00    	js     804771 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804657:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80465b:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  804662:	00 00 00 
+  804665:	ff d0                	call   *%rax
+  804667:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80466a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80466f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804674:	48 89 c6             	mov    %rax,%rsi
+  804677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80467c:	48 b8 ce 2b 80 00 00 	movabs $0x802bce,%rax
+  804683:	00 00 00 
+  804686:	ff d0                	call   *%rax
+  804688:	89 c3                	mov    %eax,%ebx
+  80468a:	85 c0                	test   %eax,%eax
+  80468c:	0f 88 c5 00 00 00    	js     804757 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804692:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804696:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  80469d:	00 00 00 
+  8046a0:	ff d0                	call   *%rax
+  8046a2:	48 89 c1             	mov    %rax,%rcx
+  8046a5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8046ab:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8046b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046b6:	4c 89 ee             	mov    %r13,%rsi
+  8046b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046be:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  8046c5:	00 00 00 
+  8046c8:	ff d0                	call   *%rax
+  8046ca:	89 c3                	mov    %eax,%ebx
+  8046cc:	85 c0                	test   %eax,%eax
+  8046ce:	78 6e                	js     80473e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046d5:	4c 89 ef             	mov    %r13,%rdi
+  8046d8:	48 b8 64 2b 80 00 00 	movabs $0x802b64,%rax
+  8046df:	00 00 00 
+  8046e2:	ff d0                	call   *%rax
+  8046e4:	83 f8 02             	cmp    $0x2,%eax
+  8046e7:	0f 85 ab 00 00 00    	jne    804798 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8046ed:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8046f4:	00 00 
+  8046f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8046fa:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8046fc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804700:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804707:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80470b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80470d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804711:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804718:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80471c:	48 bb a6 33 80 00 00 	movabs $0x8033a6,%rbx
+  804723:	00 00 00 
+  804726:	ff d3                	call   *%rbx
+  804728:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80472c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804730:	ff d3                	call   *%rbx
+  804732:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804737:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80473c:	eb 4d                	jmp    80478b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80473e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804743:	4c 89 ee             	mov    %r13,%rsi
+  804746:	bf 00 00 00 00       	mov    $0x0,%edi
+  80474b:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  804752:	00 00 00 
+  804755:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804757:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80475c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804760:	bf 00 00 00 00       	mov    $0x0,%edi
+  804765:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  80476c:	00 00 00 
+  80476f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804771:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804776:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80477a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80477f:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  804786:	00 00 00 
+  804789:	ff d0                	call   *%rax
+}
+  80478b:	89 d8                	mov    %ebx,%eax
+  80478d:	48 83 c4 18          	add    $0x18,%rsp
+  804791:	5b                   	pop    %rbx
+  804792:	41 5c                	pop    %r12
+  804794:	41 5d                	pop    %r13
+  804796:	5d                   	pop    %rbp
+  804797:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804798:	48 b9 c8 68 80 00 00 	movabs $0x8068c8,%rcx
+  80479f:	00 00 00 
+  8047a2:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  8047a9:	00 00 00 
+  8047ac:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8047b1:	48 bf b7 68 80 00 00 	movabs $0x8068b7,%rdi
+  8047b8:	00 00 00 
+  8047bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c0:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  8047c7:	00 00 00 
+  8047ca:	41 ff d0             	call   *%r8
+
+00000000008047cd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8047cd:	55                   	push   %rbp
+  8047ce:	48 89 e5             	mov    %rsp,%rbp
+  8047d1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8047d5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8047d9:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  8047e0:	00 00 00 
+  8047e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8047e5:	85 c0                	test   %eax,%eax
+  8047e7:	78 35                	js     80481e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8047e9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047ed:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  8047f4:	00 00 00 
+  8047f7:	ff d0                	call   *%rax
+  8047f9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8047fc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804801:	be 00 10 00 00       	mov    $0x1000,%esi
+  804806:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80480a:	48 b8 9c 2b 80 00 00 	movabs $0x802b9c,%rax
+  804811:	00 00 00 
+  804814:	ff d0                	call   *%rax
+  804816:	85 c0                	test   %eax,%eax
+  804818:	0f 94 c0             	sete   %al
+  80481b:	0f b6 c0             	movzbl %al,%eax
+}
+  80481e:	c9                   	leave
+  80481f:	c3                   	ret
+
+0000000000804820 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804820:	48 89 f8             	mov    %rdi,%rax
+  804823:	48 c1 e8 27          	shr    $0x27,%rax
+  804827:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80482e:	01 00 00 
+  804831:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804835:	f6 c2 01             	test   $0x1,%dl
+  804838:	74 6d                	je     8048a7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80483a:	48 89 f8             	mov    %rdi,%rax
+  80483d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804841:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804848:	01 00 00 
+  80484b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80484f:	f6 c2 01             	test   $0x1,%dl
+  804852:	74 62                	je     8048b6 <get_uvpt_entry+0x96>
+  804854:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80485b:	01 00 00 
+  80485e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804862:	f6 c2 80             	test   $0x80,%dl
+  804865:	75 4f                	jne    8048b6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804867:	48 89 f8             	mov    %rdi,%rax
+  80486a:	48 c1 e8 15          	shr    $0x15,%rax
+  80486e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804875:	01 00 00 
+  804878:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80487c:	f6 c2 01             	test   $0x1,%dl
+  80487f:	74 44                	je     8048c5 <get_uvpt_entry+0xa5>
+  804881:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804888:	01 00 00 
+  80488b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80488f:	f6 c2 80             	test   $0x80,%dl
+  804892:	75 31                	jne    8048c5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804894:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804898:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80489f:	01 00 00 
+  8048a2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8048a6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8048a7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8048ae:	01 00 00 
+  8048b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048b5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8048b6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8048bd:	01 00 00 
+  8048c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048c4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8048c5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048cc:	01 00 00 
+  8048cf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048d3:	c3                   	ret
+
+00000000008048d4 <get_prot>:
+
+int
+get_prot(void *va) {
+  8048d4:	55                   	push   %rbp
+  8048d5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8048d8:	48 b8 20 48 80 00 00 	movabs $0x804820,%rax
+  8048df:	00 00 00 
+  8048e2:	ff d0                	call   *%rax
+  8048e4:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8048e7:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8048ec:	89 c1                	mov    %eax,%ecx
+  8048ee:	83 c9 04             	or     $0x4,%ecx
+  8048f1:	f6 c2 01             	test   $0x1,%dl
+  8048f4:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8048f7:	89 c1                	mov    %eax,%ecx
+  8048f9:	83 c9 02             	or     $0x2,%ecx
+  8048fc:	f6 c2 02             	test   $0x2,%dl
+  8048ff:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804902:	89 c1                	mov    %eax,%ecx
+  804904:	83 c9 01             	or     $0x1,%ecx
+  804907:	48 85 d2             	test   %rdx,%rdx
+  80490a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80490d:	89 c1                	mov    %eax,%ecx
+  80490f:	83 c9 40             	or     $0x40,%ecx
+  804912:	f6 c6 04             	test   $0x4,%dh
+  804915:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804918:	5d                   	pop    %rbp
+  804919:	c3                   	ret
+
+000000000080491a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80491a:	55                   	push   %rbp
+  80491b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80491e:	48 b8 20 48 80 00 00 	movabs $0x804820,%rax
+  804925:	00 00 00 
+  804928:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80492a:	48 c1 e8 06          	shr    $0x6,%rax
+  80492e:	83 e0 01             	and    $0x1,%eax
+}
+  804931:	5d                   	pop    %rbp
+  804932:	c3                   	ret
+
+0000000000804933 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804933:	55                   	push   %rbp
+  804934:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804937:	48 b8 20 48 80 00 00 	movabs $0x804820,%rax
+  80493e:	00 00 00 
+  804941:	ff d0                	call   *%rax
+  804943:	83 e0 01             	and    $0x1,%eax
+}
+  804946:	5d                   	pop    %rbp
+  804947:	c3                   	ret
+
+0000000000804948 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804948:	55                   	push   %rbp
+  804949:	48 89 e5             	mov    %rsp,%rbp
+  80494c:	41 57                	push   %r15
+  80494e:	41 56                	push   %r14
+  804950:	41 55                	push   %r13
+  804952:	41 54                	push   %r12
+  804954:	53                   	push   %rbx
+  804955:	48 83 ec 28          	sub    $0x28,%rsp
+  804959:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80495d:	48 85 ff             	test   %rdi,%rdi
+  804960:	74 1e                	je     804980 <foreach_shared_region+0x38>
+  804962:	49 89 ff             	mov    %rdi,%r15
+  804965:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80496b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804971:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804978:	01 00 00 
+  80497b:	e9 72 02 00 00       	jmp    804bf2 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804980:	48 b9 ec 68 80 00 00 	movabs $0x8068ec,%rcx
+  804987:	00 00 00 
+  80498a:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  804991:	00 00 00 
+  804994:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804999:	48 bf f0 68 80 00 00 	movabs $0x8068f0,%rdi
+  8049a0:	00 00 00 
+  8049a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049a8:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  8049af:	00 00 00 
+  8049b2:	41 ff d0             	call   *%r8
+  8049b5:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8049bc:	eb 6c                	jmp    804a2a <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8049be:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049c5:	ff ff ff 
+  8049c8:	4c 21 e2             	and    %r12,%rdx
+  8049cb:	48 89 d8             	mov    %rbx,%rax
+  8049ce:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8049d3:	48 83 c0 01          	add    $0x1,%rax
+  8049d7:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8049db:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8049e2:	00 00 00 
+  8049e5:	48 21 c8             	and    %rcx,%rax
+  8049e8:	48 09 d0             	or     %rdx,%rax
+  8049eb:	49 89 c4             	mov    %rax,%r12
+  8049ee:	eb 30                	jmp    804a20 <foreach_shared_region+0xd8>
+  8049f0:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049f7:	ff ff ff 
+  8049fa:	4c 21 e2             	and    %r12,%rdx
+  8049fd:	48 89 d8             	mov    %rbx,%rax
+  804a00:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a05:	48 83 c0 01          	add    $0x1,%rax
+  804a09:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804a0d:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804a14:	00 00 00 
+  804a17:	48 21 c8             	and    %rcx,%rax
+  804a1a:	48 09 d0             	or     %rdx,%rax
+  804a1d:	49 89 c4             	mov    %rax,%r12
+  804a20:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804a24:	0f 84 99 01 00 00    	je     804bc3 <foreach_shared_region+0x27b>
+  804a2a:	4c 89 e3             	mov    %r12,%rbx
+  804a2d:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804a31:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804a38:	01 00 00 
+  804a3b:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a3f:	a8 01                	test   $0x1,%al
+  804a41:	0f 84 77 ff ff ff    	je     8049be <foreach_shared_region+0x76>
+  804a47:	a8 80                	test   $0x80,%al
+  804a49:	74 19                	je     804a64 <foreach_shared_region+0x11c>
+  804a4b:	f6 c4 04             	test   $0x4,%ah
+  804a4e:	74 a0                	je     8049f0 <foreach_shared_region+0xa8>
+  804a50:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804a57:	40 
+  804a58:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a5c:	4c 89 e7             	mov    %r12,%rdi
+  804a5f:	41 ff d7             	call   *%r15
+  804a62:	eb 8c                	jmp    8049f0 <foreach_shared_region+0xa8>
+  804a64:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804a6b:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804a6f:	eb 46                	jmp    804ab7 <foreach_shared_region+0x16f>
+  804a71:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a78:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a7e:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a82:	48 c1 e0 15          	shl    $0x15,%rax
+  804a86:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a8b:	49 09 c4             	or     %rax,%r12
+  804a8e:	eb 1d                	jmp    804aad <foreach_shared_region+0x165>
+  804a90:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a97:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a9d:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804aa1:	48 c1 e0 15          	shl    $0x15,%rax
+  804aa5:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804aaa:	49 09 c4             	or     %rax,%r12
+  804aad:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804ab1:	0f 84 d3 00 00 00    	je     804b8a <foreach_shared_region+0x242>
+  804ab7:	4c 89 e3             	mov    %r12,%rbx
+  804aba:	48 c1 eb 15          	shr    $0x15,%rbx
+  804abe:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804ac5:	01 00 00 
+  804ac8:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804acc:	a8 01                	test   $0x1,%al
+  804ace:	74 a1                	je     804a71 <foreach_shared_region+0x129>
+  804ad0:	a8 80                	test   $0x80,%al
+  804ad2:	74 19                	je     804aed <foreach_shared_region+0x1a5>
+  804ad4:	f6 c4 04             	test   $0x4,%ah
+  804ad7:	74 b7                	je     804a90 <foreach_shared_region+0x148>
+  804ad9:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804ae0:	00 
+  804ae1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ae5:	4c 89 e7             	mov    %r12,%rdi
+  804ae8:	41 ff d7             	call   *%r15
+  804aeb:	eb a3                	jmp    804a90 <foreach_shared_region+0x148>
+  804aed:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804af3:	eb 3b                	jmp    804b30 <foreach_shared_region+0x1e8>
+  804af5:	f6 c4 04             	test   $0x4,%ah
+  804af8:	74 12                	je     804b0c <foreach_shared_region+0x1c4>
+  804afa:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804b01:	00 
+  804b02:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b06:	4c 89 e7             	mov    %r12,%rdi
+  804b09:	41 ff d7             	call   *%r15
+  804b0c:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b13:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b19:	48 83 c3 01          	add    $0x1,%rbx
+  804b1d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b21:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b27:	49 09 dc             	or     %rbx,%r12
+  804b2a:	41 83 ed 01          	sub    $0x1,%r13d
+  804b2e:	74 2f                	je     804b5f <foreach_shared_region+0x217>
+  804b30:	4c 89 e3             	mov    %r12,%rbx
+  804b33:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804b37:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804b3b:	a8 01                	test   $0x1,%al
+  804b3d:	75 b6                	jne    804af5 <foreach_shared_region+0x1ad>
+  804b3f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b46:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b4c:	48 83 c3 01          	add    $0x1,%rbx
+  804b50:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b54:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b5a:	49 09 dc             	or     %rbx,%r12
+  804b5d:	eb cb                	jmp    804b2a <foreach_shared_region+0x1e2>
+  804b5f:	4c 89 e0             	mov    %r12,%rax
+  804b62:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804b68:	49 c1 ec 15          	shr    $0x15,%r12
+  804b6c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b73:	49 83 c4 01          	add    $0x1,%r12
+  804b77:	49 c1 e4 15          	shl    $0x15,%r12
+  804b7b:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804b82:	49 09 c4             	or     %rax,%r12
+  804b85:	e9 23 ff ff ff       	jmp    804aad <foreach_shared_region+0x165>
+  804b8a:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804b8e:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804b95:	ff ff ff 
+  804b98:	4c 21 e0             	and    %r12,%rax
+  804b9b:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804b9f:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804ba6:	49 83 c4 01          	add    $0x1,%r12
+  804baa:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804bae:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804bb5:	00 00 00 
+  804bb8:	49 21 d4             	and    %rdx,%r12
+  804bbb:	49 09 c4             	or     %rax,%r12
+  804bbe:	e9 5d fe ff ff       	jmp    804a20 <foreach_shared_region+0xd8>
+  804bc3:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804bca:	00 ff ff 
+  804bcd:	4c 21 e0             	and    %r12,%rax
+  804bd0:	49 c1 ec 27          	shr    $0x27,%r12
+  804bd4:	49 83 c4 01          	add    $0x1,%r12
+  804bd8:	49 c1 e4 27          	shl    $0x27,%r12
+  804bdc:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804be3:	ff 00 00 
+  804be6:	49 21 d4             	and    %rdx,%r12
+  804be9:	49 09 c4             	or     %rax,%r12
+  804bec:	41 83 ed 01          	sub    $0x1,%r13d
+  804bf0:	74 48                	je     804c3a <foreach_shared_region+0x2f2>
+  804bf2:	4c 89 e0             	mov    %r12,%rax
+  804bf5:	48 c1 e8 27          	shr    $0x27,%rax
+  804bf9:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804c00:	01 00 00 
+  804c03:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804c07:	f6 c2 01             	test   $0x1,%dl
+  804c0a:	0f 85 a5 fd ff ff    	jne    8049b5 <foreach_shared_region+0x6d>
+  804c10:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804c17:	00 ff ff 
+  804c1a:	4c 21 e2             	and    %r12,%rdx
+  804c1d:	48 83 c0 01          	add    $0x1,%rax
+  804c21:	48 c1 e0 27          	shl    $0x27,%rax
+  804c25:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804c2c:	ff 00 00 
+  804c2f:	48 21 c8             	and    %rcx,%rax
+  804c32:	48 09 d0             	or     %rdx,%rax
+  804c35:	49 89 c4             	mov    %rax,%r12
+  804c38:	eb b2                	jmp    804bec <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804c3a:	4d 85 e4             	test   %r12,%r12
+  804c3d:	75 14                	jne    804c53 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c44:	48 83 c4 28          	add    $0x28,%rsp
+  804c48:	5b                   	pop    %rbx
+  804c49:	41 5c                	pop    %r12
+  804c4b:	41 5d                	pop    %r13
+  804c4d:	41 5e                	pop    %r14
+  804c4f:	41 5f                	pop    %r15
+  804c51:	5d                   	pop    %rbp
+  804c52:	c3                   	ret
+    assert(addr == 0);
+  804c53:	48 b9 fb 68 80 00 00 	movabs $0x8068fb,%rcx
+  804c5a:	00 00 00 
+  804c5d:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  804c64:	00 00 00 
+  804c67:	be 67 00 00 00       	mov    $0x67,%esi
+  804c6c:	48 bf f0 68 80 00 00 	movabs $0x8068f0,%rdi
+  804c73:	00 00 00 
+  804c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7b:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  804c82:	00 00 00 
+  804c85:	41 ff d0             	call   *%r8
+
+0000000000804c88 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804c88:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804c8f:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804c92:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804c98:	eb 33                	jmp    804ccd <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c9a:	48 83 c0 20          	add    $0x20,%rax
+  804c9e:	4c 39 c0             	cmp    %r8,%rax
+  804ca1:	74 25                	je     804cc8 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804ca3:	48 8b 10             	mov    (%rax),%rdx
+  804ca6:	48 85 d2             	test   %rdx,%rdx
+  804ca9:	74 ef                	je     804c9a <mmap_place+0x12>
+  804cab:	48 89 d1             	mov    %rdx,%rcx
+  804cae:	48 03 48 08          	add    0x8(%rax),%rcx
+  804cb2:	48 39 cf             	cmp    %rcx,%rdi
+  804cb5:	73 e3                	jae    804c9a <mmap_place+0x12>
+  804cb7:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804cbb:	4c 39 ca             	cmp    %r9,%rdx
+  804cbe:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804cc2:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804cc6:	eb d2                	jmp    804c9a <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804cc8:	45 84 d2             	test   %r10b,%r10b
+  804ccb:	74 12                	je     804cdf <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ccd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cd4:	00 00 00 
+        moved = 0;
+  804cd7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804cdd:	eb c4                	jmp    804ca3 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804cdf:	48 01 fe             	add    %rdi,%rsi
+  804ce2:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804ce9:	00 00 00 
+  804cec:	48 39 f0             	cmp    %rsi,%rax
+  804cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf4:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804cf8:	c3                   	ret
+
+0000000000804cf9 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804cf9:	55                   	push   %rbp
+  804cfa:	48 89 e5             	mov    %rsp,%rbp
+  804cfd:	41 57                	push   %r15
+  804cff:	41 56                	push   %r14
+  804d01:	41 55                	push   %r13
+  804d03:	41 54                	push   %r12
+  804d05:	53                   	push   %rbx
+  804d06:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804d0a:	48 8b 1f             	mov    (%rdi),%rbx
+  804d0d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d14:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d1b:	00 00 00 
+  804d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d23:	eb 12                	jmp    804d37 <mmap_pgfault+0x3e>
+  804d25:	48 83 c2 01          	add    $0x1,%rdx
+  804d29:	48 83 c0 20          	add    $0x20,%rax
+  804d2d:	48 83 fa 20          	cmp    $0x20,%rdx
+  804d31:	0f 84 04 01 00 00    	je     804e3b <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804d37:	48 8b 08             	mov    (%rax),%rcx
+  804d3a:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804d3e:	48 39 de             	cmp    %rbx,%rsi
+  804d41:	73 e2                	jae    804d25 <mmap_pgfault+0x2c>
+  804d43:	48 03 48 08          	add    0x8(%rax),%rcx
+  804d47:	48 39 cb             	cmp    %rcx,%rbx
+  804d4a:	73 d9                	jae    804d25 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804d4c:	48 c1 e2 05          	shl    $0x5,%rdx
+  804d50:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d57:	00 00 00 
+  804d5a:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804d5e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804d62:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804d66:	f6 c2 01             	test   $0x1,%dl
+  804d69:	0f 84 e0 00 00 00    	je     804e4f <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d74:	f6 c2 02             	test   $0x2,%dl
+  804d77:	0f 84 c3 00 00 00    	je     804e40 <mmap_pgfault+0x147>
+  804d7d:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804d84:	ff ff ff 
+  804d87:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804d8b:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804d92:	00 00 00 
+  804d95:	48 39 ca             	cmp    %rcx,%rdx
+  804d98:	0f 85 a2 00 00 00    	jne    804e40 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804d9e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804da3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804da8:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804daf:	00 00 00 
+  804db2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804db7:	48 b8 ce 2b 80 00 00 	movabs $0x802bce,%rax
+  804dbe:	00 00 00 
+  804dc1:	ff d0                	call   *%rax
+  804dc3:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dca:	85 d2                	test   %edx,%edx
+  804dcc:	78 72                	js     804e40 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804dce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dd3:	48 89 de             	mov    %rbx,%rsi
+  804dd6:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804ddd:	00 00 00 
+  804de0:	4c 89 e7             	mov    %r12,%rdi
+  804de3:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  804dea:	00 00 00 
+  804ded:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804def:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804df5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804dfb:	48 89 d9             	mov    %rbx,%rcx
+  804dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e03:	4c 89 e6             	mov    %r12,%rsi
+  804e06:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e0b:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  804e12:	00 00 00 
+  804e15:	ff d0                	call   *%rax
+  804e17:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804e19:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e1e:	4c 89 e6             	mov    %r12,%rsi
+  804e21:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e26:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  804e2d:	00 00 00 
+  804e30:	ff d0                	call   *%rax
+    return res >= 0;
+  804e32:	89 d8                	mov    %ebx,%eax
+  804e34:	f7 d0                	not    %eax
+  804e36:	c1 e8 1f             	shr    $0x1f,%eax
+  804e39:	eb 05                	jmp    804e40 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804e40:	48 83 c4 18          	add    $0x18,%rsp
+  804e44:	5b                   	pop    %rbx
+  804e45:	41 5c                	pop    %r12
+  804e47:	41 5d                	pop    %r13
+  804e49:	41 5e                	pop    %r14
+  804e4b:	41 5f                	pop    %r15
+  804e4d:	5d                   	pop    %rbp
+  804e4e:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804e4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e53:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804e57:	4c 03 30             	add    (%rax),%r14
+  804e5a:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804e61:	49 39 c6             	cmp    %rax,%r14
+  804e64:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e68:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804e6f:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e75:	49 bf 33 49 80 00 00 	movabs $0x804933,%r15
+  804e7c:	00 00 00 
+  804e7f:	4d 39 f4             	cmp    %r14,%r12
+  804e82:	73 1d                	jae    804ea1 <mmap_pgfault+0x1a8>
+  804e84:	4c 89 e7             	mov    %r12,%rdi
+  804e87:	41 ff d7             	call   *%r15
+  804e8a:	84 c0                	test   %al,%al
+  804e8c:	75 13                	jne    804ea1 <mmap_pgfault+0x1a8>
+  804e8e:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804e95:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804e9c:	4d 39 f4             	cmp    %r14,%r12
+  804e9f:	72 e3                	jb     804e84 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804ea1:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804ea7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804eab:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804eaf:	74 2a                	je     804edb <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804eb1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804eb5:	89 de                	mov    %ebx,%esi
+  804eb7:	2b 30                	sub    (%rax),%esi
+  804eb9:	03 70 1c             	add    0x1c(%rax),%esi
+  804ebc:	8b 78 18             	mov    0x18(%rax),%edi
+  804ebf:	4c 89 e9             	mov    %r13,%rcx
+  804ec2:	48 89 da             	mov    %rbx,%rdx
+  804ec5:	48 b8 91 40 80 00 00 	movabs $0x804091,%rax
+  804ecc:	00 00 00 
+  804ecf:	ff d0                	call   *%rax
+    return res > 0;
+  804ed1:	85 c0                	test   %eax,%eax
+  804ed3:	0f 9f c0             	setg   %al
+  804ed6:	e9 65 ff ff ff       	jmp    804e40 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804edb:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804edf:	eb d0                	jmp    804eb1 <mmap_pgfault+0x1b8>
+
+0000000000804ee1 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804ee1:	55                   	push   %rbp
+  804ee2:	48 89 e5             	mov    %rsp,%rbp
+  804ee5:	41 57                	push   %r15
+  804ee7:	41 56                	push   %r14
+  804ee9:	41 55                	push   %r13
+  804eeb:	41 54                	push   %r12
+  804eed:	53                   	push   %rbx
+  804eee:	48 83 ec 28          	sub    $0x28,%rsp
+  804ef2:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804ef6:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804ef9:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804f00:	ff ff ff 
+  804f03:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804f07:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f0c:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804f13:	00 00 00 
+  804f16:	48 39 ca             	cmp    %rcx,%rdx
+  804f19:	0f 85 e5 00 00 00    	jne    805004 <mmap_writeback+0x123>
+  804f1f:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804f22:	4c 39 ee             	cmp    %r13,%rsi
+  804f25:	0f 83 e8 00 00 00    	jae    805013 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f2b:	49 be 33 49 80 00 00 	movabs $0x804933,%r14
+  804f32:	00 00 00 
+  804f35:	49 bf 1a 49 80 00 00 	movabs $0x80491a,%r15
+  804f3c:	00 00 00 
+  804f3f:	eb 10                	jmp    804f51 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804f41:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804f48:	4d 39 ec             	cmp    %r13,%r12
+  804f4b:	0f 83 ae 00 00 00    	jae    804fff <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f51:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804f55:	4c 89 e7             	mov    %r12,%rdi
+  804f58:	41 ff d6             	call   *%r14
+  804f5b:	84 c0                	test   %al,%al
+  804f5d:	74 e2                	je     804f41 <mmap_writeback+0x60>
+  804f5f:	4c 89 e7             	mov    %r12,%rdi
+  804f62:	41 ff d7             	call   *%r15
+  804f65:	84 c0                	test   %al,%al
+  804f67:	74 d8                	je     804f41 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804f69:	4c 89 e3             	mov    %r12,%rbx
+  804f6c:	4d 39 ec             	cmp    %r13,%r12
+  804f6f:	73 20                	jae    804f91 <mmap_writeback+0xb0>
+  804f71:	48 89 df             	mov    %rbx,%rdi
+  804f74:	41 ff d6             	call   *%r14
+  804f77:	84 c0                	test   %al,%al
+  804f79:	74 16                	je     804f91 <mmap_writeback+0xb0>
+  804f7b:	48 89 df             	mov    %rbx,%rdi
+  804f7e:	41 ff d7             	call   *%r15
+  804f81:	84 c0                	test   %al,%al
+  804f83:	74 0c                	je     804f91 <mmap_writeback+0xb0>
+  804f85:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804f8c:	4c 39 eb             	cmp    %r13,%rbx
+  804f8f:	72 e0                	jb     804f71 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804f91:	48 89 d9             	mov    %rbx,%rcx
+  804f94:	4c 29 e1             	sub    %r12,%rcx
+  804f97:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f9b:	44 89 e6             	mov    %r12d,%esi
+  804f9e:	2b 30                	sub    (%rax),%esi
+  804fa0:	49 89 c4             	mov    %rax,%r12
+  804fa3:	03 70 1c             	add    0x1c(%rax),%esi
+  804fa6:	8b 78 18             	mov    0x18(%rax),%edi
+  804fa9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804fad:	48 89 ca             	mov    %rcx,%rdx
+  804fb0:	48 b8 1a 41 80 00 00 	movabs $0x80411a,%rax
+  804fb7:	00 00 00 
+  804fba:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804fbc:	85 c0                	test   %eax,%eax
+  804fbe:	78 44                	js     805004 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804fc0:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804fc5:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804fc8:	41 89 c1             	mov    %eax,%r9d
+  804fcb:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804fd2:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804fd6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804fda:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fdf:	48 89 ce             	mov    %rcx,%rsi
+  804fe2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fe7:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  804fee:	00 00 00 
+  804ff1:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804ff3:	85 c0                	test   %eax,%eax
+  804ff5:	78 0d                	js     805004 <mmap_writeback+0x123>
+  804ff7:	49 89 dc             	mov    %rbx,%r12
+  804ffa:	e9 49 ff ff ff       	jmp    804f48 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804fff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805004:	48 83 c4 28          	add    $0x28,%rsp
+  805008:	5b                   	pop    %rbx
+  805009:	41 5c                	pop    %r12
+  80500b:	41 5d                	pop    %r13
+  80500d:	41 5e                	pop    %r14
+  80500f:	41 5f                	pop    %r15
+  805011:	5d                   	pop    %rbp
+  805012:	c3                   	ret
+    return 0;
+  805013:	b8 00 00 00 00       	mov    $0x0,%eax
+  805018:	eb ea                	jmp    805004 <mmap_writeback+0x123>
+
+000000000080501a <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80501a:	55                   	push   %rbp
+  80501b:	48 89 e5             	mov    %rsp,%rbp
+  80501e:	41 57                	push   %r15
+  805020:	41 56                	push   %r14
+  805022:	41 55                	push   %r13
+  805024:	41 54                	push   %r12
+  805026:	53                   	push   %rbx
+  805027:	48 83 ec 38          	sub    $0x38,%rsp
+  80502b:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80502f:	48 85 f6             	test   %rsi,%rsi
+  805032:	0f 84 0c 02 00 00    	je     805244 <mmap+0x22a>
+  805038:	49 89 ff             	mov    %rdi,%r15
+  80503b:	49 89 f4             	mov    %rsi,%r12
+  80503e:	41 89 d5             	mov    %edx,%r13d
+  805041:	41 89 ce             	mov    %ecx,%r14d
+  805044:	44 89 cb             	mov    %r9d,%ebx
+  805047:	45 85 c9             	test   %r9d,%r9d
+  80504a:	0f 88 f4 01 00 00    	js     805244 <mmap+0x22a>
+  805050:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805057:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80505e:	0f 85 e7 01 00 00    	jne    80524b <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805064:	83 e2 fd             	and    $0xfffffffd,%edx
+  805067:	83 fa 04             	cmp    $0x4,%edx
+  80506a:	0f 85 db 01 00 00    	jne    80524b <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805070:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805073:	83 fa 01             	cmp    $0x1,%edx
+  805076:	0f 87 cf 01 00 00    	ja     80524b <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  80507c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805080:	44 89 c7             	mov    %r8d,%edi
+  805083:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  80508a:	00 00 00 
+  80508d:	ff d0                	call   *%rax
+  80508f:	89 c2                	mov    %eax,%edx
+  805091:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805098:	85 d2                	test   %edx,%edx
+  80509a:	0f 88 ab 01 00 00    	js     80524b <mmap+0x231>
+  8050a0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8050a4:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8050ab:	00 00 00 
+  8050ae:	8b 09                	mov    (%rcx),%ecx
+  8050b0:	39 0a                	cmp    %ecx,(%rdx)
+  8050b2:	0f 85 93 01 00 00    	jne    80524b <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8050b8:	8b 52 08             	mov    0x8(%rdx),%edx
+  8050bb:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8050be:	83 fa 01             	cmp    $0x1,%edx
+  8050c1:	0f 84 84 01 00 00    	je     80524b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8050c7:	41 83 fe 01          	cmp    $0x1,%r14d
+  8050cb:	74 42                	je     80510f <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8050cd:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8050d4:	4c 89 e6             	mov    %r12,%rsi
+  8050d7:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8050de:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8050e2:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8050e6:	4d 85 ff             	test   %r15,%r15
+  8050e9:	74 67                	je     805152 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050eb:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8050f2:	75 0f                	jne    805103 <mmap+0xe9>
+  8050f4:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8050fb:	00 00 00 
+  8050fe:	49 39 c7             	cmp    %rax,%r15
+  805101:	77 1b                	ja     80511e <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805103:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80510a:	e9 3c 01 00 00       	jmp    80524b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80510f:	41 f6 c5 02          	test   $0x2,%r13b
+  805113:	74 b8                	je     8050cd <mmap+0xb3>
+  805115:	85 d2                	test   %edx,%edx
+  805117:	75 b4                	jne    8050cd <mmap+0xb3>
+  805119:	e9 2d 01 00 00       	jmp    80524b <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80511e:	4c 89 ff             	mov    %r15,%rdi
+  805121:	48 b8 88 4c 80 00 00 	movabs $0x804c88,%rax
+  805128:	00 00 00 
+  80512b:	ff d0                	call   *%rax
+  80512d:	48 89 c2             	mov    %rax,%rdx
+  805130:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805137:	49 39 d7             	cmp    %rdx,%r15
+  80513a:	0f 85 0b 01 00 00    	jne    80524b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805140:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805147:	00 00 00 
+  80514a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805150:	eb 44                	jmp    805196 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805152:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805156:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  80515d:	00 00 00 
+  805160:	48 b8 88 4c 80 00 00 	movabs $0x804c88,%rax
+  805167:	00 00 00 
+  80516a:	ff d0                	call   *%rax
+  80516c:	48 89 c7             	mov    %rax,%rdi
+  80516f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805173:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80517a:	48 85 ff             	test   %rdi,%rdi
+  80517d:	75 c1                	jne    805140 <mmap+0x126>
+  80517f:	e9 c7 00 00 00       	jmp    80524b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805184:	49 83 c4 01          	add    $0x1,%r12
+  805188:	48 83 c0 20          	add    $0x20,%rax
+  80518c:	49 83 fc 20          	cmp    $0x20,%r12
+  805190:	0f 84 a5 00 00 00    	je     80523b <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805196:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80519a:	75 e8                	jne    805184 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  80519c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8051a0:	48 b8 d4 33 80 00 00 	movabs $0x8033d4,%rax
+  8051a7:	00 00 00 
+  8051aa:	ff d0                	call   *%rax
+  8051ac:	89 c2                	mov    %eax,%edx
+  8051ae:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051b5:	85 d2                	test   %edx,%edx
+  8051b7:	0f 88 8e 00 00 00    	js     80524b <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8051bd:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8051c1:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  8051c8:	00 00 00 
+  8051cb:	ff d0                	call   *%rax
+  8051cd:	89 c6                	mov    %eax,%esi
+  8051cf:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8051d2:	48 b8 f4 35 80 00 00 	movabs $0x8035f4,%rax
+  8051d9:	00 00 00 
+  8051dc:	ff d0                	call   *%rax
+  8051de:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8051e1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051e8:	45 85 ff             	test   %r15d,%r15d
+  8051eb:	78 5e                	js     80524b <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8051ed:	49 c1 e4 05          	shl    $0x5,%r12
+  8051f1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8051f8:	00 00 00 
+  8051fb:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8051fe:	48 bf f9 4c 80 00 00 	movabs $0x804cf9,%rdi
+  805205:	00 00 00 
+  805208:	48 b8 24 57 80 00 00 	movabs $0x805724,%rax
+  80520f:	00 00 00 
+  805212:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805214:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805218:	49 89 04 24          	mov    %rax,(%r12)
+  80521c:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805220:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805225:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  80522a:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80522f:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805234:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805239:	eb 10                	jmp    80524b <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  80523b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805242:	eb 07                	jmp    80524b <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805244:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  80524b:	48 83 c4 38          	add    $0x38,%rsp
+  80524f:	5b                   	pop    %rbx
+  805250:	41 5c                	pop    %r12
+  805252:	41 5d                	pop    %r13
+  805254:	41 5e                	pop    %r14
+  805256:	41 5f                	pop    %r15
+  805258:	5d                   	pop    %rbp
+  805259:	c3                   	ret
+
+000000000080525a <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  80525a:	55                   	push   %rbp
+  80525b:	48 89 e5             	mov    %rsp,%rbp
+  80525e:	41 57                	push   %r15
+  805260:	41 56                	push   %r14
+  805262:	41 55                	push   %r13
+  805264:	41 54                	push   %r12
+  805266:	53                   	push   %rbx
+  805267:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80526b:	49 89 fe             	mov    %rdi,%r14
+  80526e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805275:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80527c:	00 
+  80527d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805284:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80528b:	00 00 00 
+  80528e:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805295:	49 bf e1 4e 80 00 00 	movabs $0x804ee1,%r15
+  80529c:	00 00 00 
+  80529f:	eb 09                	jmp    8052aa <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052a1:	48 83 c3 20          	add    $0x20,%rbx
+  8052a5:	4c 39 eb             	cmp    %r13,%rbx
+  8052a8:	74 33                	je     8052dd <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052aa:	48 89 df             	mov    %rbx,%rdi
+  8052ad:	48 8b 33             	mov    (%rbx),%rsi
+  8052b0:	4c 39 e6             	cmp    %r12,%rsi
+  8052b3:	73 ec                	jae    8052a1 <msync+0x47>
+  8052b5:	48 85 f6             	test   %rsi,%rsi
+  8052b8:	74 e7                	je     8052a1 <msync+0x47>
+  8052ba:	48 89 f2             	mov    %rsi,%rdx
+  8052bd:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8052c1:	49 39 d6             	cmp    %rdx,%r14
+  8052c4:	73 db                	jae    8052a1 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8052c6:	4c 39 e2             	cmp    %r12,%rdx
+  8052c9:	49 0f 47 d4          	cmova  %r12,%rdx
+  8052cd:	4c 39 f6             	cmp    %r14,%rsi
+  8052d0:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8052d4:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8052d7:	85 c0                	test   %eax,%eax
+  8052d9:	79 c6                	jns    8052a1 <msync+0x47>
+  8052db:	eb 05                	jmp    8052e2 <msync+0x88>
+    }
+
+    return 0;
+  8052dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052e2:	48 83 c4 08          	add    $0x8,%rsp
+  8052e6:	5b                   	pop    %rbx
+  8052e7:	41 5c                	pop    %r12
+  8052e9:	41 5d                	pop    %r13
+  8052eb:	41 5e                	pop    %r14
+  8052ed:	41 5f                	pop    %r15
+  8052ef:	5d                   	pop    %rbp
+  8052f0:	c3                   	ret
+
+00000000008052f1 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8052f1:	55                   	push   %rbp
+  8052f2:	48 89 e5             	mov    %rsp,%rbp
+  8052f5:	41 57                	push   %r15
+  8052f7:	41 56                	push   %r14
+  8052f9:	41 55                	push   %r13
+  8052fb:	41 54                	push   %r12
+  8052fd:	53                   	push   %rbx
+  8052fe:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805302:	49 89 ff             	mov    %rdi,%r15
+  805305:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80530c:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805313:	00 
+  805314:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80531b:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805322:	00 00 00 
+  805325:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80532c:	48 89 d8             	mov    %rbx,%rax
+  80532f:	eb 09                	jmp    80533a <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805331:	48 83 c0 20          	add    $0x20,%rax
+  805335:	4c 39 f0             	cmp    %r14,%rax
+  805338:	74 40                	je     80537a <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80533a:	48 8b 10             	mov    (%rax),%rdx
+  80533d:	4c 39 e2             	cmp    %r12,%rdx
+  805340:	73 ef                	jae    805331 <munmap+0x40>
+  805342:	48 85 d2             	test   %rdx,%rdx
+  805345:	74 ea                	je     805331 <munmap+0x40>
+  805347:	48 89 d7             	mov    %rdx,%rdi
+  80534a:	48 03 78 08          	add    0x8(%rax),%rdi
+  80534e:	49 39 ff             	cmp    %rdi,%r15
+  805351:	73 de                	jae    805331 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805353:	49 39 fc             	cmp    %rdi,%r12
+  805356:	72 05                	jb     80535d <munmap+0x6c>
+  805358:	4c 39 fa             	cmp    %r15,%rdx
+  80535b:	73 d4                	jae    805331 <munmap+0x40>
+  80535d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805362:	48 83 c4 08          	add    $0x8,%rsp
+  805366:	5b                   	pop    %rbx
+  805367:	41 5c                	pop    %r12
+  805369:	41 5d                	pop    %r13
+  80536b:	41 5e                	pop    %r14
+  80536d:	41 5f                	pop    %r15
+  80536f:	5d                   	pop    %rbp
+  805370:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805371:	48 83 c3 20          	add    $0x20,%rbx
+  805375:	4c 39 f3             	cmp    %r14,%rbx
+  805378:	74 5c                	je     8053d6 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80537a:	48 8b 33             	mov    (%rbx),%rsi
+  80537d:	4c 39 e6             	cmp    %r12,%rsi
+  805380:	73 ef                	jae    805371 <munmap+0x80>
+  805382:	48 85 f6             	test   %rsi,%rsi
+  805385:	74 ea                	je     805371 <munmap+0x80>
+  805387:	48 89 f2             	mov    %rsi,%rdx
+  80538a:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80538e:	49 39 d7             	cmp    %rdx,%r15
+  805391:	73 de                	jae    805371 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805393:	48 89 df             	mov    %rbx,%rdi
+  805396:	48 b8 e1 4e 80 00 00 	movabs $0x804ee1,%rax
+  80539d:	00 00 00 
+  8053a0:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8053a2:	85 c0                	test   %eax,%eax
+  8053a4:	78 bc                	js     805362 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8053a6:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8053aa:	48 8b 33             	mov    (%rbx),%rsi
+  8053ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053b2:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  8053b9:	00 00 00 
+  8053bc:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8053be:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8053c1:	48 b8 99 35 80 00 00 	movabs $0x803599,%rax
+  8053c8:	00 00 00 
+  8053cb:	ff d0                	call   *%rax
+        reg->start = 0;
+  8053cd:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8053d4:	eb 9b                	jmp    805371 <munmap+0x80>
+    return 0;
+  8053d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053db:	eb 85                	jmp    805362 <munmap+0x71>
+
+00000000008053dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8053dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053e2:	c3                   	ret
+
+00000000008053e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8053e3:	55                   	push   %rbp
+  8053e4:	48 89 e5             	mov    %rsp,%rbp
+  8053e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8053ea:	48 be 05 69 80 00 00 	movabs $0x806905,%rsi
+  8053f1:	00 00 00 
+  8053f4:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  8053fb:	00 00 00 
+  8053fe:	ff d0                	call   *%rax
+    return 0;
+}
+  805400:	b8 00 00 00 00       	mov    $0x0,%eax
+  805405:	5d                   	pop    %rbp
+  805406:	c3                   	ret
+
+0000000000805407 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805407:	55                   	push   %rbp
+  805408:	48 89 e5             	mov    %rsp,%rbp
+  80540b:	41 57                	push   %r15
+  80540d:	41 56                	push   %r14
+  80540f:	41 55                	push   %r13
+  805411:	41 54                	push   %r12
+  805413:	53                   	push   %rbx
+  805414:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80541b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805422:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805429:	00 00 00 00 
+  80542d:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805434:	00 00 00 00 
+  805438:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80543f:	00 00 00 00 
+  805443:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80544a:	00 00 00 00 
+  80544e:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805455:	00 00 00 00 
+  805459:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805460:	00 00 00 00 
+  805464:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80546b:	00 
+  80546c:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805473:	00 
+  805474:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80547b:	00 
+  80547c:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805483:	00 
+  805484:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80548b:	00 
+  80548c:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805493:	00 
+  805494:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80549b:	00 
+  80549c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8054a3:	00 
+  8054a4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8054ab:	00 
+  8054ac:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8054b3:	00 
+    for (res = 0; res < n; res += inc) {
+  8054b4:	48 85 d2             	test   %rdx,%rdx
+  8054b7:	74 7a                	je     805533 <devcons_write+0x12c>
+  8054b9:	49 89 d6             	mov    %rdx,%r14
+  8054bc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054c2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8054c7:	49 bf b9 27 80 00 00 	movabs $0x8027b9,%r15
+  8054ce:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8054d1:	4c 89 f3             	mov    %r14,%rbx
+  8054d4:	48 29 f3             	sub    %rsi,%rbx
+  8054d7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8054dc:	48 39 c3             	cmp    %rax,%rbx
+  8054df:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8054e3:	4c 63 eb             	movslq %ebx,%r13
+  8054e6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8054ed:	48 01 c6             	add    %rax,%rsi
+  8054f0:	4c 89 ea             	mov    %r13,%rdx
+  8054f3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8054fa:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8054fd:	4c 89 ee             	mov    %r13,%rsi
+  805500:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805507:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  80550e:	00 00 00 
+  805511:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805513:	41 01 dc             	add    %ebx,%r12d
+  805516:	49 63 f4             	movslq %r12d,%rsi
+  805519:	4c 39 f6             	cmp    %r14,%rsi
+  80551c:	72 b3                	jb     8054d1 <devcons_write+0xca>
+    return res;
+  80551e:	49 63 c4             	movslq %r12d,%rax
+}
+  805521:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805528:	5b                   	pop    %rbx
+  805529:	41 5c                	pop    %r12
+  80552b:	41 5d                	pop    %r13
+  80552d:	41 5e                	pop    %r14
+  80552f:	41 5f                	pop    %r15
+  805531:	5d                   	pop    %rbp
+  805532:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805533:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805539:	eb e3                	jmp    80551e <devcons_write+0x117>
+
+000000000080553b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80553b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80553e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805543:	48 85 c0             	test   %rax,%rax
+  805546:	74 55                	je     80559d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805548:	55                   	push   %rbp
+  805549:	48 89 e5             	mov    %rsp,%rbp
+  80554c:	41 55                	push   %r13
+  80554e:	41 54                	push   %r12
+  805550:	53                   	push   %rbx
+  805551:	48 83 ec 08          	sub    $0x8,%rsp
+  805555:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805558:	48 bb 19 2a 80 00 00 	movabs $0x802a19,%rbx
+  80555f:	00 00 00 
+  805562:	49 bc 2d 2b 80 00 00 	movabs $0x802b2d,%r12
+  805569:	00 00 00 
+  80556c:	eb 03                	jmp    805571 <devcons_read+0x36>
+  80556e:	41 ff d4             	call   *%r12
+  805571:	ff d3                	call   *%rbx
+  805573:	85 c0                	test   %eax,%eax
+  805575:	74 f7                	je     80556e <devcons_read+0x33>
+    if (c < 0) return c;
+  805577:	48 63 d0             	movslq %eax,%rdx
+  80557a:	78 13                	js     80558f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80557c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805581:	83 f8 04             	cmp    $0x4,%eax
+  805584:	74 09                	je     80558f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805586:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80558a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80558f:	48 89 d0             	mov    %rdx,%rax
+  805592:	48 83 c4 08          	add    $0x8,%rsp
+  805596:	5b                   	pop    %rbx
+  805597:	41 5c                	pop    %r12
+  805599:	41 5d                	pop    %r13
+  80559b:	5d                   	pop    %rbp
+  80559c:	c3                   	ret
+  80559d:	48 89 d0             	mov    %rdx,%rax
+  8055a0:	c3                   	ret
+
+00000000008055a1 <cputchar>:
+cputchar(int ch) {
+  8055a1:	55                   	push   %rbp
+  8055a2:	48 89 e5             	mov    %rsp,%rbp
+  8055a5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8055a9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8055ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8055b2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8055b6:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  8055bd:	00 00 00 
+  8055c0:	ff d0                	call   *%rax
+}
+  8055c2:	c9                   	leave
+  8055c3:	c3                   	ret
+
+00000000008055c4 <getchar>:
+getchar(void) {
+  8055c4:	55                   	push   %rbp
+  8055c5:	48 89 e5             	mov    %rsp,%rbp
+  8055c8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8055cc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8055d1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8055d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055da:	48 b8 17 37 80 00 00 	movabs $0x803717,%rax
+  8055e1:	00 00 00 
+  8055e4:	ff d0                	call   *%rax
+  8055e6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8055e8:	85 c0                	test   %eax,%eax
+  8055ea:	78 06                	js     8055f2 <getchar+0x2e>
+  8055ec:	74 08                	je     8055f6 <getchar+0x32>
+  8055ee:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8055f2:	89 d0                	mov    %edx,%eax
+  8055f4:	c9                   	leave
+  8055f5:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8055f6:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8055fb:	eb f5                	jmp    8055f2 <getchar+0x2e>
+
+00000000008055fd <iscons>:
+iscons(int fdnum) {
+  8055fd:	55                   	push   %rbp
+  8055fe:	48 89 e5             	mov    %rsp,%rbp
+  805601:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805605:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805609:	48 b8 34 34 80 00 00 	movabs $0x803434,%rax
+  805610:	00 00 00 
+  805613:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805615:	85 c0                	test   %eax,%eax
+  805617:	78 18                	js     805631 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805619:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80561d:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805624:	00 00 00 
+  805627:	8b 00                	mov    (%rax),%eax
+  805629:	39 02                	cmp    %eax,(%rdx)
+  80562b:	0f 94 c0             	sete   %al
+  80562e:	0f b6 c0             	movzbl %al,%eax
+}
+  805631:	c9                   	leave
+  805632:	c3                   	ret
+
+0000000000805633 <opencons>:
+opencons(void) {
+  805633:	55                   	push   %rbp
+  805634:	48 89 e5             	mov    %rsp,%rbp
+  805637:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80563b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80563f:	48 b8 d4 33 80 00 00 	movabs $0x8033d4,%rax
+  805646:	00 00 00 
+  805649:	ff d0                	call   *%rax
+  80564b:	85 c0                	test   %eax,%eax
+  80564d:	78 49                	js     805698 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80564f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805654:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805659:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80565d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805662:	48 b8 ce 2b 80 00 00 	movabs $0x802bce,%rax
+  805669:	00 00 00 
+  80566c:	ff d0                	call   *%rax
+  80566e:	85 c0                	test   %eax,%eax
+  805670:	78 26                	js     805698 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805672:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805676:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80567d:	00 00 
+  80567f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805681:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805685:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80568c:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  805693:	00 00 00 
+  805696:	ff d0                	call   *%rax
+}
+  805698:	c9                   	leave
+  805699:	c3                   	ret
+
+000000000080569a <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80569a:	55                   	push   %rbp
+  80569b:	48 89 e5             	mov    %rsp,%rbp
+  80569e:	41 56                	push   %r14
+  8056a0:	41 55                	push   %r13
+  8056a2:	41 54                	push   %r12
+  8056a4:	53                   	push   %rbx
+  8056a5:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056a8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056af:	00 00 00 
+  8056b2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8056b6:	74 27                	je     8056df <_handle_vectored_pagefault+0x45>
+  8056b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8056bd:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8056c4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056c7:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8056ca:	4c 89 e7             	mov    %r12,%rdi
+  8056cd:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8056d2:	84 c0                	test   %al,%al
+  8056d4:	75 45                	jne    80571b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056d6:	48 83 c3 01          	add    $0x1,%rbx
+  8056da:	49 3b 1e             	cmp    (%r14),%rbx
+  8056dd:	72 eb                	jb     8056ca <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8056df:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8056e6:	00 
+  8056e7:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8056ec:	4d 8b 04 24          	mov    (%r12),%r8
+  8056f0:	48 ba 18 69 80 00 00 	movabs $0x806918,%rdx
+  8056f7:	00 00 00 
+  8056fa:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8056ff:	48 bf 48 69 80 00 00 	movabs $0x806948,%rdi
+  805706:	00 00 00 
+  805709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80570e:	49 ba e2 19 80 00 00 	movabs $0x8019e2,%r10
+  805715:	00 00 00 
+  805718:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80571b:	5b                   	pop    %rbx
+  80571c:	41 5c                	pop    %r12
+  80571e:	41 5d                	pop    %r13
+  805720:	41 5e                	pop    %r14
+  805722:	5d                   	pop    %rbp
+  805723:	c3                   	ret
+
+0000000000805724 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805724:	55                   	push   %rbp
+  805725:	48 89 e5             	mov    %rsp,%rbp
+  805728:	53                   	push   %rbx
+  805729:	48 83 ec 08          	sub    $0x8,%rsp
+  80572d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805730:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805735:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80573c:	00 00 00 
+  80573f:	80 38 00             	cmpb   $0x0,(%rax)
+  805742:	74 68                	je     8057ac <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805744:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80574b:	00 00 00 
+  80574e:	48 8b 08             	mov    (%rax),%rcx
+  805751:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805756:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80575d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805760:	48 85 c9             	test   %rcx,%rcx
+  805763:	0f 84 e0 00 00 00    	je     805849 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805769:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80576d:	0f 84 c9 00 00 00    	je     80583c <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805773:	48 83 c2 01          	add    $0x1,%rdx
+  805777:	48 39 ca             	cmp    %rcx,%rdx
+  80577a:	75 ed                	jne    805769 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80577c:	48 83 f9 08          	cmp    $0x8,%rcx
+  805780:	0f 84 84 00 00 00    	je     80580a <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805786:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80578a:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805791:	00 00 00 
+  805794:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80579b:	00 00 00 
+  80579e:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8057a2:	85 f6                	test   %esi,%esi
+  8057a4:	0f 89 97 00 00 00    	jns    805841 <add_pgfault_handler+0x11d>
+  8057aa:	eb 63                	jmp    80580f <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8057ac:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8057b1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8057b6:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8057bd:	00 00 00 
+  8057c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057c5:	48 b8 ce 2b 80 00 00 	movabs $0x802bce,%rax
+  8057cc:	00 00 00 
+  8057cf:	ff d0                	call   *%rax
+  8057d1:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057d3:	85 c0                	test   %eax,%eax
+  8057d5:	78 38                	js     80580f <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8057d7:	48 be 25 59 80 00 00 	movabs $0x805925,%rsi
+  8057de:	00 00 00 
+  8057e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057e6:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  8057ed:	00 00 00 
+  8057f0:	ff d0                	call   *%rax
+  8057f2:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057f4:	85 c0                	test   %eax,%eax
+  8057f6:	78 17                	js     80580f <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8057f8:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8057ff:	00 00 00 
+  805802:	c6 00 01             	movb   $0x1,(%rax)
+  805805:	e9 3a ff ff ff       	jmp    805744 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80580a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80580f:	89 f1                	mov    %esi,%ecx
+  805811:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  805818:	00 00 00 
+  80581b:	be 42 00 00 00       	mov    $0x42,%esi
+  805820:	48 bf 48 69 80 00 00 	movabs $0x806948,%rdi
+  805827:	00 00 00 
+  80582a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80582f:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  805836:	00 00 00 
+  805839:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80583c:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805841:	89 f0                	mov    %esi,%eax
+  805843:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805847:	c9                   	leave
+  805848:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805849:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805850:	00 00 00 
+  805853:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80585a:	48 89 d8             	mov    %rbx,%rax
+  80585d:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805864:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805867:	eb d8                	jmp    805841 <add_pgfault_handler+0x11d>
+
+0000000000805869 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805869:	55                   	push   %rbp
+  80586a:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80586d:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805874:	00 00 00 
+  805877:	80 38 00             	cmpb   $0x0,(%rax)
+  80587a:	74 33                	je     8058af <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80587c:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805883:	00 00 00 
+  805886:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80588b:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805892:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805895:	48 85 c0             	test   %rax,%rax
+  805898:	0f 84 85 00 00 00    	je     805923 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80589e:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8058a2:	74 40                	je     8058e4 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8058a4:	48 83 c1 01          	add    $0x1,%rcx
+  8058a8:	48 39 c1             	cmp    %rax,%rcx
+  8058ab:	75 f1                	jne    80589e <remove_pgfault_handler+0x35>
+  8058ad:	eb 74                	jmp    805923 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8058af:	48 b9 6e 69 80 00 00 	movabs $0x80696e,%rcx
+  8058b6:	00 00 00 
+  8058b9:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  8058c0:	00 00 00 
+  8058c3:	be 48 00 00 00       	mov    $0x48,%esi
+  8058c8:	48 bf 48 69 80 00 00 	movabs $0x806948,%rdi
+  8058cf:	00 00 00 
+  8058d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058d7:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  8058de:	00 00 00 
+  8058e1:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8058e4:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8058eb:	00 
+  8058ec:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8058f0:	48 29 ca             	sub    %rcx,%rdx
+  8058f3:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8058fa:	00 00 00 
+  8058fd:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805901:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805906:	48 89 ce             	mov    %rcx,%rsi
+  805909:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  805910:	00 00 00 
+  805913:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805915:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80591c:	00 00 00 
+  80591f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805923:	5d                   	pop    %rbp
+  805924:	c3                   	ret
+
+0000000000805925 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805925:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805928:	48 b8 9a 56 80 00 00 	movabs $0x80569a,%rax
+  80592f:	00 00 00 
+    call *%rax
+  805932:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805934:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80593b:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80593c:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805943:	00 
+    subq $8, %rcx
+  805944:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805948:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80594b:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805952:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805953:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805957:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80595b:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805960:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805965:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80596a:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80596f:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805974:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805979:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80597e:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805983:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805988:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80598d:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805992:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805997:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80599c:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8059a1:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8059a5:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8059a9:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8059aa:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8059ab:	c3                   	ret
+
+00000000008059ac <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8059ac:	85 ff                	test   %edi,%edi
+  8059ae:	78 58                	js     805a08 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8059b0:	48 85 f6             	test   %rsi,%rsi
+  8059b3:	74 12                	je     8059c7 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8059b5:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8059bc:	00 00 00 
+  8059bf:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8059c5:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8059c7:	48 85 c9             	test   %rcx,%rcx
+  8059ca:	74 12                	je     8059de <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8059cc:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8059d3:	00 00 00 
+  8059d6:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8059dc:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8059de:	48 85 d2             	test   %rdx,%rdx
+  8059e1:	74 14                	je     8059f7 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8059e3:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8059ea:	00 00 00 
+  8059ed:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8059f4:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8059f7:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8059fe:	00 00 00 
+  805a01:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805a07:	c3                   	ret
+        if (from_env_store) {
+  805a08:	48 85 f6             	test   %rsi,%rsi
+  805a0b:	74 06                	je     805a13 <ipc_result+0x67>
+            *from_env_store = 0;
+  805a0d:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805a13:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805a15:	48 85 c9             	test   %rcx,%rcx
+  805a18:	74 ed                	je     805a07 <ipc_result+0x5b>
+            *perm_store = 0;
+  805a1a:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805a20:	c3                   	ret
+
+0000000000805a21 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805a21:	55                   	push   %rbp
+  805a22:	48 89 e5             	mov    %rsp,%rbp
+  805a25:	41 55                	push   %r13
+  805a27:	41 54                	push   %r12
+  805a29:	53                   	push   %rbx
+  805a2a:	48 83 ec 08          	sub    $0x8,%rsp
+  805a2e:	49 89 fc             	mov    %rdi,%r12
+  805a31:	48 89 f7             	mov    %rsi,%rdi
+  805a34:	48 89 d3             	mov    %rdx,%rbx
+  805a37:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805a3a:	48 85 f6             	test   %rsi,%rsi
+  805a3d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a44:	00 00 00 
+  805a47:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805a4b:	be 00 00 00 00       	mov    $0x0,%esi
+  805a50:	48 85 d2             	test   %rdx,%rdx
+  805a53:	74 03                	je     805a58 <ipc_recv+0x37>
+  805a55:	48 8b 32             	mov    (%rdx),%rsi
+  805a58:	48 b8 1a 31 80 00 00 	movabs $0x80311a,%rax
+  805a5f:	00 00 00 
+  805a62:	ff d0                	call   *%rax
+  805a64:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805a66:	4c 89 e9             	mov    %r13,%rcx
+  805a69:	48 89 da             	mov    %rbx,%rdx
+  805a6c:	4c 89 e6             	mov    %r12,%rsi
+  805a6f:	48 b8 ac 59 80 00 00 	movabs $0x8059ac,%rax
+  805a76:	00 00 00 
+  805a79:	ff d0                	call   *%rax
+}
+  805a7b:	48 83 c4 08          	add    $0x8,%rsp
+  805a7f:	5b                   	pop    %rbx
+  805a80:	41 5c                	pop    %r12
+  805a82:	41 5d                	pop    %r13
+  805a84:	5d                   	pop    %rbp
+  805a85:	c3                   	ret
+
+0000000000805a86 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805a86:	55                   	push   %rbp
+  805a87:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805a8a:	48 85 d2             	test   %rdx,%rdx
+  805a8d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a94:	00 00 00 
+  805a97:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805a9b:	89 f6                	mov    %esi,%esi
+  805a9d:	48 b8 a6 2f 80 00 00 	movabs $0x802fa6,%rax
+  805aa4:	00 00 00 
+  805aa7:	ff d0                	call   *%rax
+    if (res < 0) {
+  805aa9:	85 c0                	test   %eax,%eax
+  805aab:	78 02                	js     805aaf <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805aad:	5d                   	pop    %rbp
+  805aae:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805aaf:	89 c1                	mov    %eax,%ecx
+  805ab1:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  805ab8:	00 00 00 
+  805abb:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805ac0:	48 bf 95 69 80 00 00 	movabs $0x806995,%rdi
+  805ac7:	00 00 00 
+  805aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  805acf:	49 b8 e2 19 80 00 00 	movabs $0x8019e2,%r8
+  805ad6:	00 00 00 
+  805ad9:	41 ff d0             	call   *%r8
+
+0000000000805adc <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805adc:	55                   	push   %rbp
+  805add:	48 89 e5             	mov    %rsp,%rbp
+  805ae0:	53                   	push   %rbx
+  805ae1:	48 83 ec 08          	sub    $0x8,%rsp
+  805ae5:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805ae9:	48 85 d2             	test   %rdx,%rdx
+  805aec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805af3:	00 00 00 
+  805af6:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805afa:	4d 85 c9             	test   %r9,%r9
+  805afd:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b06:	48 85 db             	test   %rbx,%rbx
+  805b09:	74 03                	je     805b0e <ipc_call+0x32>
+  805b0b:	48 8b 03             	mov    (%rbx),%rax
+  805b0e:	89 f6                	mov    %esi,%esi
+  805b10:	48 83 ec 08          	sub    $0x8,%rsp
+  805b14:	50                   	push   %rax
+  805b15:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  805b1c:	00 00 00 
+  805b1f:	ff d0                	call   *%rax
+  805b21:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805b23:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805b27:	48 89 da             	mov    %rbx,%rdx
+  805b2a:	be 00 00 00 00       	mov    $0x0,%esi
+  805b2f:	48 b8 ac 59 80 00 00 	movabs $0x8059ac,%rax
+  805b36:	00 00 00 
+  805b39:	ff d0                	call   *%rax
+}
+  805b3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805b3f:	c9                   	leave
+  805b40:	c3                   	ret
+
+0000000000805b41 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805b41:	55                   	push   %rbp
+  805b42:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805b45:	89 f6                	mov    %esi,%esi
+  805b47:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  805b4e:	00 00 00 
+  805b51:	ff d0                	call   *%rax
+  805b53:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805b55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b5f:	be 00 00 00 00       	mov    $0x0,%esi
+  805b64:	48 b8 ac 59 80 00 00 	movabs $0x8059ac,%rax
+  805b6b:	00 00 00 
+  805b6e:	ff d0                	call   *%rax
+}
+  805b70:	5d                   	pop    %rbp
+  805b71:	c3                   	ret
+
+0000000000805b72 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805b72:	55                   	push   %rbp
+  805b73:	48 89 e5             	mov    %rsp,%rbp
+  805b76:	41 54                	push   %r12
+  805b78:	53                   	push   %rbx
+  805b79:	4c 89 cb             	mov    %r9,%rbx
+  805b7c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805b80:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805b84:	48 85 d2             	test   %rdx,%rdx
+  805b87:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b8e:	00 00 00 
+  805b91:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805b95:	4d 85 c9             	test   %r9,%r9
+  805b98:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ba1:	4d 85 e4             	test   %r12,%r12
+  805ba4:	74 04                	je     805baa <ipc_reply_wait+0x38>
+  805ba6:	49 8b 04 24          	mov    (%r12),%rax
+  805baa:	89 f6                	mov    %esi,%esi
+  805bac:	48 83 ec 08          	sub    $0x8,%rsp
+  805bb0:	50                   	push   %rax
+  805bb1:	48 b8 ae 30 80 00 00 	movabs $0x8030ae,%rax
+  805bb8:	00 00 00 
+  805bbb:	ff d0                	call   *%rax
+  805bbd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805bbf:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805bc3:	4c 89 e2             	mov    %r12,%rdx
+  805bc6:	48 89 de             	mov    %rbx,%rsi
+  805bc9:	48 b8 ac 59 80 00 00 	movabs $0x8059ac,%rax
+  805bd0:	00 00 00 
+  805bd3:	ff d0                	call   *%rax
+}
+  805bd5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805bd9:	5b                   	pop    %rbx
+  805bda:	41 5c                	pop    %r12
+  805bdc:	5d                   	pop    %rbp
+  805bdd:	c3                   	ret
+
+0000000000805bde <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805bde:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805be3:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805bea:	00 00 00 
+  805bed:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805bf4:	48 01 ca             	add    %rcx,%rdx
+  805bf7:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805bfd:	39 fa                	cmp    %edi,%edx
+  805bff:	74 12                	je     805c13 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805c01:	48 83 c0 01          	add    $0x1,%rax
+  805c05:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805c0b:	75 e0                	jne    805bed <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c12:	c3                   	ret
+            return envs[i].env_id;
+  805c13:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805c1a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805c21:	00 00 00 
+  805c24:	48 01 d0             	add    %rdx,%rax
+  805c27:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805c2d:	c3                   	ret
+  805c2e:	66 90                	xchg   %ax,%ax
+
+0000000000805c30 <__rodata_start>:
+  805c30:	77 00                	ja     805c32 <__rodata_start+0x2>
+  805c32:	72 62                	jb     805c96 <__rodata_start+0x66>
+  805c34:	00 77 62             	add    %dh,0x62(%rdi)
+  805c37:	00 0f                	add    %cl,(%rdi)
+  805c39:	1f                   	(bad)
+  805c3a:	84 00                	test   %al,(%rax)
+  805c3c:	00 00                	add    %al,(%rax)
+  805c3e:	00 00                	add    %al,(%rax)
+  805c40:	b3 09                	mov    $0x9,%bl
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 ed                	add    %ch,%ch
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	ed                   	in     (%dx),%eax
+  805c59:	0d 80 00 00 00       	or     $0x80,%eax
+  805c5e:	00 00                	add    %al,(%rax)
+  805c60:	ed                   	in     (%dx),%eax
+  805c61:	0d 80 00 00 00       	or     $0x80,%eax
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 ed                	add    %ch,%ch
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	ed                   	in     (%dx),%eax
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ed                   	in     (%dx),%eax
+  805c81:	0d 80 00 00 00       	or     $0x80,%eax
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	8c 0a                	mov    %cs,(%rdx)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	8c 0a                	mov    %cs,(%rdx)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	8c 0a                	mov    %cs,(%rdx)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805cc6:	00 00                	add    %al,(%rax)
+  805cc8:	8c 0a                	mov    %cs,(%rdx)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	8c 0a                	mov    %cs,(%rdx)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	ed                   	in     (%dx),%eax
+  805ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cee:	00 00                	add    %al,(%rax)
+  805cf0:	ed                   	in     (%dx),%eax
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	ed                   	in     (%dx),%eax
+  805d19:	0d 80 00 00 00       	or     $0x80,%eax
+  805d1e:	00 00                	add    %al,(%rax)
+  805d20:	ed                   	in     (%dx),%eax
+  805d21:	0d 80 00 00 00       	or     $0x80,%eax
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	ed                   	in     (%dx),%eax
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	ed                   	in     (%dx),%eax
+  805d31:	0d 80 00 00 00       	or     $0x80,%eax
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	ed                   	in     (%dx),%eax
+  805d39:	0d 80 00 00 00       	or     $0x80,%eax
+  805d3e:	00 00                	add    %al,(%rax)
+  805d40:	ed                   	in     (%dx),%eax
+  805d41:	0d 80 00 00 00       	or     $0x80,%eax
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	ed                   	in     (%dx),%eax
+  805d49:	0d 80 00 00 00       	or     $0x80,%eax
+  805d4e:	00 00                	add    %al,(%rax)
+  805d50:	ed                   	in     (%dx),%eax
+  805d51:	0d 80 00 00 00       	or     $0x80,%eax
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	ed                   	in     (%dx),%eax
+  805d59:	0d 80 00 00 00       	or     $0x80,%eax
+  805d5e:	00 00                	add    %al,(%rax)
+  805d60:	ed                   	in     (%dx),%eax
+  805d61:	0d 80 00 00 00       	or     $0x80,%eax
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	ed                   	in     (%dx),%eax
+  805d71:	0d 80 00 00 00       	or     $0x80,%eax
+  805d76:	00 00                	add    %al,(%rax)
+  805d78:	ed                   	in     (%dx),%eax
+  805d79:	0d 80 00 00 00       	or     $0x80,%eax
+  805d7e:	00 00                	add    %al,(%rax)
+  805d80:	ed                   	in     (%dx),%eax
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	ed                   	in     (%dx),%eax
+  805d91:	0d 80 00 00 00       	or     $0x80,%eax
+  805d96:	00 00                	add    %al,(%rax)
+  805d98:	ed                   	in     (%dx),%eax
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ed                   	in     (%dx),%eax
+  805da1:	0d 80 00 00 00       	or     $0x80,%eax
+  805da6:	00 00                	add    %al,(%rax)
+  805da8:	ed                   	in     (%dx),%eax
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	ed                   	in     (%dx),%eax
+  805db9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dbe:	00 00                	add    %al,(%rax)
+  805dc0:	ed                   	in     (%dx),%eax
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	ed                   	in     (%dx),%eax
+  805dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dce:	00 00                	add    %al,(%rax)
+  805dd0:	ed                   	in     (%dx),%eax
+  805dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dd6:	00 00                	add    %al,(%rax)
+  805dd8:	f4                   	hlt
+  805dd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ddf:	00 ed                	add    %ch,%ch
+  805de1:	0d 80 00 00 00       	or     $0x80,%eax
+  805de6:	00 00                	add    %al,(%rax)
+  805de8:	ed                   	in     (%dx),%eax
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	2c 0b                	sub    $0xb,%al
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 ed                	add    %ch,%ch
+  805df9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dfe:	00 00                	add    %al,(%rax)
+  805e00:	ed                   	in     (%dx),%eax
+  805e01:	0d 80 00 00 00       	or     $0x80,%eax
+  805e06:	00 00                	add    %al,(%rax)
+  805e08:	ed                   	in     (%dx),%eax
+  805e09:	0d 80 00 00 00       	or     $0x80,%eax
+  805e0e:	00 00                	add    %al,(%rax)
+  805e10:	ed                   	in     (%dx),%eax
+  805e11:	0d 80 00 00 00       	or     $0x80,%eax
+  805e16:	00 00                	add    %al,(%rax)
+  805e18:	ed                   	in     (%dx),%eax
+  805e19:	0d 80 00 00 00       	or     $0x80,%eax
+  805e1e:	00 00                	add    %al,(%rax)
+  805e20:	ed                   	in     (%dx),%eax
+  805e21:	0d 80 00 00 00       	or     $0x80,%eax
+  805e26:	00 00                	add    %al,(%rax)
+  805e28:	ed                   	in     (%dx),%eax
+  805e29:	0d 80 00 00 00       	or     $0x80,%eax
+  805e2e:	00 00                	add    %al,(%rax)
+  805e30:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805e33:	00 00                	add    %al,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 cb                	add    %cl,%bl
+  805e39:	0d 80 00 00 00       	or     $0x80,%eax
+  805e3e:	00 00                	add    %al,(%rax)
+  805e40:	ed                   	in     (%dx),%eax
+  805e41:	0d 80 00 00 00       	or     $0x80,%eax
+  805e46:	00 00                	add    %al,(%rax)
+  805e48:	ed                   	in     (%dx),%eax
+  805e49:	0d 80 00 00 00       	or     $0x80,%eax
+  805e4e:	00 00                	add    %al,(%rax)
+  805e50:	ed                   	in     (%dx),%eax
+  805e51:	0d 80 00 00 00       	or     $0x80,%eax
+  805e56:	00 00                	add    %al,(%rax)
+  805e58:	6a 0a                	push   $0xa
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 ed                	add    %ch,%ch
+  805e69:	0d 80 00 00 00       	or     $0x80,%eax
+  805e6e:	00 00                	add    %al,(%rax)
+  805e70:	ed                   	in     (%dx),%eax
+  805e71:	0d 80 00 00 00       	or     $0x80,%eax
+  805e76:	00 00                	add    %al,(%rax)
+  805e78:	3c 0a                	cmp    $0xa,%al
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 ed                	add    %ch,%ch
+  805e81:	0d 80 00 00 00       	or     $0x80,%eax
+  805e86:	00 00                	add    %al,(%rax)
+  805e88:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805e8b:	00 00                	add    %al,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 29                	add    %ch,(%rcx)
+  805e99:	0c 80                	or     $0x80,%al
+  805e9b:	00 00                	add    %al,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 ed                	add    %ch,%ch
+  805ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eae:	00 00                	add    %al,(%rax)
+  805eb0:	1a 0b                	sbb    (%rbx),%cl
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 ed                	add    %ch,%ch
+  805eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ebe:	00 00                	add    %al,(%rax)
+  805ec0:	ce                   	(bad)
+  805ec1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ec7:	00 ed                	add    %ch,%ch
+  805ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ece:	00 00                	add    %al,(%rax)
+  805ed0:	ed                   	in     (%dx),%eax
+  805ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ed6:	00 00                	add    %al,(%rax)
+  805ed8:	f4                   	hlt
+  805ed9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805edf:	00 37                	add    %dh,(%rdi)
+  805ee1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 37                	add    %dh,(%rdi)
+  805ef1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ef7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805f0b:	00 00                	add    %al,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 d2                	add    %dl,%dl
+  805f11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f17:	00 d2                	add    %dl,%dl
+  805f19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f1f:	00 d2                	add    %dl,%dl
+  805f21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f27:	00 d2                	add    %dl,%dl
+  805f29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f2f:	00 d2                	add    %dl,%dl
+  805f31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f37:	00 d2                	add    %dl,%dl
+  805f39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f3f:	00 d2                	add    %dl,%dl
+  805f41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f47:	00 f6                	add    %dh,%dh
+  805f49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f4f:	00 f6                	add    %dh,%dh
+  805f51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f5a:	80 00 00             	addb   $0x0,(%rax)
+  805f5d:	00 00                	add    %al,(%rax)
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f72:	80 00 00             	addb   $0x0,(%rax)
+  805f75:	00 00                	add    %al,(%rax)
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f8a:	80 00 00             	addb   $0x0,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 22                	add    %ah,(%rdx)
+  805f91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f97:	00 22                	add    %ah,(%rdx)
+  805f99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f9f:	00 22                	add    %ah,(%rdx)
+  805fa1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fa7:	00 22                	add    %ah,(%rdx)
+  805fa9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805faf:	00 22                	add    %ah,(%rdx)
+  805fb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fb7:	00 22                	add    %ah,(%rdx)
+  805fb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fc2:	80 00 00             	addb   $0x0,(%rax)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fd2:	80 00 00             	addb   $0x0,(%rax)
+  805fd5:	00 00                	add    %al,(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ffa:	80 00 00             	addb   $0x0,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806012:	80 00 00             	addb   $0x0,(%rax)
+  806015:	00 00                	add    %al,(%rax)
+  806017:	00 5f 12             	add    %bl,0x12(%rdi)
+  80601a:	80 00 00             	addb   $0x0,(%rax)
+  80601d:	00 00                	add    %al,(%rax)
+  80601f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 5f 12             	add    %bl,0x12(%rdi)
+  80602a:	80 00 00             	addb   $0x0,(%rax)
+  80602d:	00 00                	add    %al,(%rax)
+  80602f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806032:	80 00 00             	addb   $0x0,(%rax)
+  806035:	00 00                	add    %al,(%rax)
+  806037:	00 5f 12             	add    %bl,0x12(%rdi)
+  80603a:	80 00 00             	addb   $0x0,(%rax)
+  80603d:	00 00                	add    %al,(%rax)
+  80603f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806042:	80 00 00             	addb   $0x0,(%rax)
+  806045:	00 00                	add    %al,(%rax)
+  806047:	00 46 12             	add    %al,0x12(%rsi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806052:	80 00 00             	addb   $0x0,(%rax)
+  806055:	00 00                	add    %al,(%rax)
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 5f 12             	add    %bl,0x12(%rdi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 22                	add    %ah,(%rdx)
+  806091:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806097:	00 22                	add    %ah,(%rdx)
+  806099:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80609f:	00 22                	add    %ah,(%rdx)
+  8060a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060a7:	00 22                	add    %ah,(%rdx)
+  8060a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060af:	00 22                	add    %ah,(%rdx)
+  8060b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060b7:	00 22                	add    %ah,(%rdx)
+  8060b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060c2:	80 00 00             	addb   $0x0,(%rax)
+  8060c5:	00 00                	add    %al,(%rax)
+  8060c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ca:	80 00 00             	addb   $0x0,(%rax)
+  8060cd:	00 00                	add    %al,(%rax)
+  8060cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060d2:	80 00 00             	addb   $0x0,(%rax)
+  8060d5:	00 00                	add    %al,(%rax)
+  8060d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060da:	80 00 00             	addb   $0x0,(%rax)
+  8060dd:	00 00                	add    %al,(%rax)
+  8060df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060e2:	80 00 00             	addb   $0x0,(%rax)
+  8060e5:	00 00                	add    %al,(%rax)
+  8060e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ea:	80 00 00             	addb   $0x0,(%rax)
+  8060ed:	00 00                	add    %al,(%rax)
+  8060ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060f2:	80 00 00             	addb   $0x0,(%rax)
+  8060f5:	00 00                	add    %al,(%rax)
+  8060f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060fa:	80 00 00             	addb   $0x0,(%rax)
+  8060fd:	00 00                	add    %al,(%rax)
+  8060ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806102:	80 00 00             	addb   $0x0,(%rax)
+  806105:	00 00                	add    %al,(%rax)
+  806107:	00 5f 12             	add    %bl,0x12(%rdi)
+  80610a:	80 00 00             	addb   $0x0,(%rax)
+  80610d:	00 00                	add    %al,(%rax)
+  80610f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806112:	80 00 00             	addb   $0x0,(%rax)
+  806115:	00 00                	add    %al,(%rax)
+  806117:	00 5f 12             	add    %bl,0x12(%rdi)
+  80611a:	80 00 00             	addb   $0x0,(%rax)
+  80611d:	00 00                	add    %al,(%rax)
+  80611f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806122:	80 00 00             	addb   $0x0,(%rax)
+  806125:	00 00                	add    %al,(%rax)
+  806127:	00 5f 12             	add    %bl,0x12(%rdi)
+  80612a:	80 00 00             	addb   $0x0,(%rax)
+  80612d:	00 00                	add    %al,(%rax)
+  80612f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806132:	80 00 00             	addb   $0x0,(%rax)
+  806135:	00 00                	add    %al,(%rax)
+  806137:	00 5f 12             	add    %bl,0x12(%rdi)
+  80613a:	80 00 00             	addb   $0x0,(%rax)
+  80613d:	00 00                	add    %al,(%rax)
+  80613f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806142:	80 00 00             	addb   $0x0,(%rax)
+  806145:	00 00                	add    %al,(%rax)
+  806147:	00 46 12             	add    %al,0x12(%rsi)
+  80614a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806160 <basefix.0>:
+  806160:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806170:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806180:	10 00 2f 00 25 31 31 64 20 25 63 20 00 25 73 25     ../.%11d %c .%s%
+  806190:	73 00 6f 70 65 6e 20 25 73 3a 20 25 69 00 75 73     s.open %s: %i.us
+  8061a0:	65 72 2f 6c 73 2e 63 00 73 68 6f 72 74 20 72 65     er/ls.c.short re
+  8061b0:	61 64 20 69 6e 20 64 69 72 65 63 74 6f 72 79 20     ad in directory 
+  8061c0:	25 73 00 73 74 61 74 20 25 73 3a 20 25 69 00 75     %s.stat %s: %i.u
+  8061d0:	73 61 67 65 3a 20 6c 73 20 5b 2d 64 46 6c 5d 20     sage: ls [-dFl] 
+  8061e0:	5b 66 69 6c 65 2e 2e 2e 5d 0a 00 0f 1f 44 00 00     [file...]....D..
+  8061f0:	65 72 72 6f 72 20 72 65 61 64 69 6e 67 20 64 69     error reading di
+  806200:	72 65 63 74 6f 72 79 20 25 73 3a 20 25 69 00 3c     rectory %s: %i.<
+  806210:	75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 80 00 00 00 00     unknown>........
+  806220:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806230:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806240:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806250:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806260:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806270:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806280:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806290:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  8062a0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  8062b0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8062c0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8062d0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8062e0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8062f0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806300:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806310:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806320:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806330:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806340:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806350:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806360:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806370:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806380:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806390:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  8063a0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8063b0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8063c0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8063d0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  8063e0:	2a 1d 80 00 00 00 00 00 81 23 80 00 00 00 00 00     *........#......
+  8063f0:	71 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     q#.......#......
+  806400:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806410:	81 23 80 00 00 00 00 00 49 1d 80 00 00 00 00 00     .#......I.......
+  806420:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806430:	3d 1d 80 00 00 00 00 00 b7 1d 80 00 00 00 00 00     =...............
+  806440:	81 23 80 00 00 00 00 00 3d 1d 80 00 00 00 00 00     .#......=.......
+  806450:	83 1d 80 00 00 00 00 00 83 1d 80 00 00 00 00 00     ................
+  806460:	83 1d 80 00 00 00 00 00 83 1d 80 00 00 00 00 00     ................
+  806470:	83 1d 80 00 00 00 00 00 83 1d 80 00 00 00 00 00     ................
+  806480:	83 1d 80 00 00 00 00 00 83 1d 80 00 00 00 00 00     ................
+  806490:	83 1d 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .........#......
+  8064a0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8064b0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8064c0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8064d0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8064e0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8064f0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806500:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806510:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806520:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806530:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806540:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806550:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806560:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806570:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806580:	81 23 80 00 00 00 00 00 9f 22 80 00 00 00 00 00     .#......."......
+  806590:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8065a0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8065b0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8065c0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8065d0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  8065e0:	e5 1d 80 00 00 00 00 00 b4 1f 80 00 00 00 00 00     ................
+  8065f0:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806600:	81 23 80 00 00 00 00 00 da 1d 80 00 00 00 00 00     .#..............
+  806610:	14 1e 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .........#......
+  806620:	81 23 80 00 00 00 00 00 cf 1d 80 00 00 00 00 00     .#..............
+  806630:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806640:	5d 21 80 00 00 00 00 00 2c 22 80 00 00 00 00 00     ]!......,"......
+  806650:	81 23 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .#.......#......
+  806660:	ab 1e 80 00 00 00 00 00 81 23 80 00 00 00 00 00     .........#......
+  806670:	88 20 80 00 00 00 00 00 81 23 80 00 00 00 00 00     . .......#......
+  806680:	81 23 80 00 00 00 00 00 9f 22 80 00 00 00 00 00     .#......."......
+  806690:	81 23 80 00 00 00 00 00 33 1d 80 00 00 00 00 00     .#......3.......
+
+00000000008066a0 <error_string>:
+	...
+  8066a8:	75 62 80 00 00 00 00 00 87 62 80 00 00 00 00 00     ub.......b......
+  8066b8:	97 62 80 00 00 00 00 00 a9 62 80 00 00 00 00 00     .b.......b......
+  8066c8:	b7 62 80 00 00 00 00 00 cb 62 80 00 00 00 00 00     .b.......b......
+  8066d8:	e0 62 80 00 00 00 00 00 f3 62 80 00 00 00 00 00     .b.......b......
+  8066e8:	05 63 80 00 00 00 00 00 19 63 80 00 00 00 00 00     .c.......c......
+  8066f8:	29 63 80 00 00 00 00 00 3c 63 80 00 00 00 00 00     )c......<c......
+  806708:	53 63 80 00 00 00 00 00 69 63 80 00 00 00 00 00     Sc......ic......
+  806718:	81 63 80 00 00 00 00 00 99 63 80 00 00 00 00 00     .c.......c......
+  806728:	a6 63 80 00 00 00 00 00 40 67 80 00 00 00 00 00     .c......@g......
+  806738:	ba 63 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .c......file is 
+  806748:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806758:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806768:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806778:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806788:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806798:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8067a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8067b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8067c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8067d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8067e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8067f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806808:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806818:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806820 <devtab>:
+  806820:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806830:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806840:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806850:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806860:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806870:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806880:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806890:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8068a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8068b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8068c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8068d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8068e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8068f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806900:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806910:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806920:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806930:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806940:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806950:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806960:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806970:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806980:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806990:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,10605 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 9c 23 80 00 00 	movabs $0x80239c,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 bc 20 80 00 00 	movabs $0x8020bc,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 1d 22 80 00 00 	movabs $0x80221d,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 d7 34 80 00 00 	movabs $0x8034d7,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 bc 20 80 00 00 	movabs $0x8020bc,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 d7 34 80 00 00 	movabs $0x8034d7,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 5f 17 80 00 00 	movabs $0x80175f,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 ad 3e 80 00 00 	movabs $0x803ead,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 2c 20 80 00 00 	movabs $0x80202c,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 ad 3e 80 00 00 	movabs $0x803ead,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 2c 20 80 00 00 	movabs $0x80202c,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 6e 5f 80 00 00 	movabs $0x805f6e,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 40 3c 80 00 00 	movabs $0x803c40,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 68 59 80 00 00 	movabs $0x805968,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 40 3c 80 00 00 	movabs $0x803c40,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 6a 59 80 00 00 	movabs $0x80596a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 40 3c 80 00 00 	movabs $0x803c40,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 6d 59 80 00 00 	movabs $0x80596d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 40 3c 80 00 00 	movabs $0x803c40,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 ab 4c 80 00 00 	movabs $0x804cab,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 82 4f 80 00 00 	movabs $0x804f82,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 2a 32 80 00 00 	movabs $0x80322a,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 c1 35 80 00 00 	movabs $0x8035c1,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 8a 36 80 00 00 	movabs $0x80368a,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 90 35 80 00 00 	movabs $0x803590,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 90 35 80 00 00 	movabs $0x803590,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 a8 33 80 00 00 	movabs $0x8033a8,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 d7 34 80 00 00 	movabs $0x8034d7,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 40 3c 80 00 00 	movabs $0x803c40,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 2a 32 80 00 00 	movabs $0x80322a,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 bc 20 80 00 00 	movabs $0x8020bc,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 69 23 80 00 00 	movabs $0x802369,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 69 23 80 00 00 	movabs $0x802369,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 9c 23 80 00 00 	movabs $0x80239c,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 69 23 80 00 00 	movabs $0x802369,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 20 5c 80 00 00 	movabs $0x805c20,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 69 23 80 00 00 	movabs $0x802369,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 69 23 80 00 00 	movabs $0x802369,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 4b 01 00 00       	call   80164a <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: lsfd [-1]\n");
+  801505:	48 bf c2 5e 80 00 00 	movabs $0x805ec2,%rdi
+  80150c:	00 00 00 
+  80150f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801514:	48 ba c3 17 80 00 00 	movabs $0x8017c3,%rdx
+  80151b:	00 00 00 
+  80151e:	ff d2                	call   *%rdx
+    exit();
+  801520:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  801527:	00 00 00 
+  80152a:	ff d0                	call   *%rax
+}
+  80152c:	5d                   	pop    %rbp
+  80152d:	c3                   	ret
+
+000000000080152e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80152e:	55                   	push   %rbp
+  80152f:	48 89 e5             	mov    %rsp,%rbp
+  801532:	41 57                	push   %r15
+  801534:	41 56                	push   %r14
+  801536:	41 55                	push   %r13
+  801538:	41 54                	push   %r12
+  80153a:	53                   	push   %rbx
+  80153b:	48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+  801542:	89 bd 0c ff ff ff    	mov    %edi,-0xf4(%rbp)
+    int i, usefprint = 0;
+    struct Stat st;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  801548:	48 8d 95 10 ff ff ff 	lea    -0xf0(%rbp),%rdx
+  80154f:	48 8d bd 0c ff ff ff 	lea    -0xf4(%rbp),%rdi
+  801556:	48 b8 bd 2e 80 00 00 	movabs $0x802ebd,%rax
+  80155d:	00 00 00 
+  801560:	ff d0                	call   *%rax
+    int i, usefprint = 0;
+  801562:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((i = argnext(&args)) >= 0) {
+  801568:	48 bb ea 2e 80 00 00 	movabs $0x802eea,%rbx
+  80156f:	00 00 00 
+  801572:	48 8d bd 10 ff ff ff 	lea    -0xf0(%rbp),%rdi
+  801579:	ff d3                	call   *%rbx
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	78 1b                	js     80159a <umain+0x6c>
+        if (i == '1')
+  80157f:	83 f8 31             	cmp    $0x31,%eax
+  801582:	75 08                	jne    80158c <umain+0x5e>
+            usefprint = 1;
+  801584:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  80158a:	eb e6                	jmp    801572 <umain+0x44>
+        else
+            usage();
+  80158c:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801593:	00 00 00 
+  801596:	ff d0                	call   *%rax
+  801598:	eb d8                	jmp    801572 <umain+0x44>
+    }
+
+    for (i = 0; i < 32; i++) {
+  80159a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fstat(i, &st) >= 0) {
+  80159f:	49 bd 8a 36 80 00 00 	movabs $0x80368a,%r13
+  8015a6:	00 00 00 
+            if (usefprint) {
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            } else {
+                cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8015a9:	49 be d8 5e 80 00 00 	movabs $0x805ed8,%r14
+  8015b0:	00 00 00 
+  8015b3:	49 bf c3 17 80 00 00 	movabs $0x8017c3,%r15
+  8015ba:	00 00 00 
+  8015bd:	eb 2b                	jmp    8015ea <umain+0xbc>
+  8015bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015c3:	4c 8b 48 08          	mov    0x8(%rax),%r9
+  8015c7:	44 8b 45 b0          	mov    -0x50(%rbp),%r8d
+  8015cb:	8b 4d b4             	mov    -0x4c(%rbp),%ecx
+  8015ce:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8015d5:	89 de                	mov    %ebx,%esi
+  8015d7:	4c 89 f7             	mov    %r14,%rdi
+  8015da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015df:	41 ff d7             	call   *%r15
+    for (i = 0; i < 32; i++) {
+  8015e2:	83 c3 01             	add    $0x1,%ebx
+  8015e5:	83 fb 20             	cmp    $0x20,%ebx
+  8015e8:	74 51                	je     80163b <umain+0x10d>
+        if (fstat(i, &st) >= 0) {
+  8015ea:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8015f1:	89 df                	mov    %ebx,%edi
+  8015f3:	41 ff d5             	call   *%r13
+  8015f6:	85 c0                	test   %eax,%eax
+  8015f8:	78 e8                	js     8015e2 <umain+0xb4>
+            if (usefprint) {
+  8015fa:	45 85 e4             	test   %r12d,%r12d
+  8015fd:	74 c0                	je     8015bf <umain+0x91>
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8015ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801603:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801607:	ff 70 08             	push   0x8(%rax)
+  80160a:	44 8b 4d b0          	mov    -0x50(%rbp),%r9d
+  80160e:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  801612:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801619:	89 da                	mov    %ebx,%edx
+  80161b:	4c 89 f6             	mov    %r14,%rsi
+  80161e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801623:	b8 00 00 00 00       	mov    $0x0,%eax
+  801628:	49 ba 32 3f 80 00 00 	movabs $0x803f32,%r10
+  80162f:	00 00 00 
+  801632:	41 ff d2             	call   *%r10
+  801635:	48 83 c4 10          	add    $0x10,%rsp
+  801639:	eb a7                	jmp    8015e2 <umain+0xb4>
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            }
+        }
+    }
+}
+  80163b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80163f:	5b                   	pop    %rbx
+  801640:	41 5c                	pop    %r12
+  801642:	41 5d                	pop    %r13
+  801644:	41 5e                	pop    %r14
+  801646:	41 5f                	pop    %r15
+  801648:	5d                   	pop    %rbp
+  801649:	c3                   	ret
+
+000000000080164a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80164a:	55                   	push   %rbp
+  80164b:	48 89 e5             	mov    %rsp,%rbp
+  80164e:	41 56                	push   %r14
+  801650:	41 55                	push   %r13
+  801652:	41 54                	push   %r12
+  801654:	53                   	push   %rbx
+  801655:	41 89 fd             	mov    %edi,%r13d
+  801658:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80165b:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801662:	00 00 00 
+  801665:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80166c:	00 00 00 
+  80166f:	48 39 c2             	cmp    %rax,%rdx
+  801672:	73 17                	jae    80168b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801674:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801677:	49 89 c4             	mov    %rax,%r12
+  80167a:	48 83 c3 08          	add    $0x8,%rbx
+  80167e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801683:	ff 53 f8             	call   *-0x8(%rbx)
+  801686:	4c 39 e3             	cmp    %r12,%rbx
+  801689:	72 ef                	jb     80167a <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80168b:	48 b8 87 27 80 00 00 	movabs $0x802787,%rax
+  801692:	00 00 00 
+  801695:	ff d0                	call   *%rax
+  801697:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80169c:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8016a3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016aa:	00 00 00 
+  8016ad:	48 01 d0             	add    %rdx,%rax
+  8016b0:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8016b7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8016ba:	45 85 ed             	test   %r13d,%r13d
+  8016bd:	7e 0d                	jle    8016cc <libmain+0x82>
+  8016bf:	49 8b 06             	mov    (%r14),%rax
+  8016c2:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8016c9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8016cc:	4c 89 f6             	mov    %r14,%rsi
+  8016cf:	44 89 ef             	mov    %r13d,%edi
+  8016d2:	48 b8 2e 15 80 00 00 	movabs $0x80152e,%rax
+  8016d9:	00 00 00 
+  8016dc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8016de:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  8016e5:	00 00 00 
+  8016e8:	ff d0                	call   *%rax
+#endif
+}
+  8016ea:	5b                   	pop    %rbx
+  8016eb:	41 5c                	pop    %r12
+  8016ed:	41 5d                	pop    %r13
+  8016ef:	41 5e                	pop    %r14
+  8016f1:	5d                   	pop    %rbp
+  8016f2:	c3                   	ret
+
+00000000008016f3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8016f3:	55                   	push   %rbp
+  8016f4:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8016f7:	48 b8 5d 32 80 00 00 	movabs $0x80325d,%rax
+  8016fe:	00 00 00 
+  801701:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801703:	bf 00 00 00 00       	mov    $0x0,%edi
+  801708:	48 b8 16 27 80 00 00 	movabs $0x802716,%rax
+  80170f:	00 00 00 
+  801712:	ff d0                	call   *%rax
+}
+  801714:	5d                   	pop    %rbp
+  801715:	c3                   	ret
+
+0000000000801716 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801716:	55                   	push   %rbp
+  801717:	48 89 e5             	mov    %rsp,%rbp
+  80171a:	53                   	push   %rbx
+  80171b:	48 83 ec 08          	sub    $0x8,%rsp
+  80171f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801722:	8b 06                	mov    (%rsi),%eax
+  801724:	8d 50 01             	lea    0x1(%rax),%edx
+  801727:	89 16                	mov    %edx,(%rsi)
+  801729:	48 98                	cltq
+  80172b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801730:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801736:	74 0a                	je     801742 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801738:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80173c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801740:	c9                   	leave
+  801741:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801742:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801746:	be ff 00 00 00       	mov    $0xff,%esi
+  80174b:	48 b8 77 26 80 00 00 	movabs $0x802677,%rax
+  801752:	00 00 00 
+  801755:	ff d0                	call   *%rax
+        state->offset = 0;
+  801757:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80175d:	eb d9                	jmp    801738 <putch+0x22>
+
+000000000080175f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80175f:	55                   	push   %rbp
+  801760:	48 89 e5             	mov    %rsp,%rbp
+  801763:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80176a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80176d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801774:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801781:	48 89 f1             	mov    %rsi,%rcx
+  801784:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80178b:	48 bf 16 17 80 00 00 	movabs $0x801716,%rdi
+  801792:	00 00 00 
+  801795:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  80179c:	00 00 00 
+  80179f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8017a1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8017a8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8017af:	48 b8 77 26 80 00 00 	movabs $0x802677,%rax
+  8017b6:	00 00 00 
+  8017b9:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8017bb:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8017c1:	c9                   	leave
+  8017c2:	c3                   	ret
+
+00000000008017c3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8017c3:	55                   	push   %rbp
+  8017c4:	48 89 e5             	mov    %rsp,%rbp
+  8017c7:	48 83 ec 50          	sub    $0x50,%rsp
+  8017cb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8017cf:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8017d3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017d7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017db:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8017df:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8017e6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017ee:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8017f6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8017fa:	48 b8 5f 17 80 00 00 	movabs $0x80175f,%rax
+  801801:	00 00 00 
+  801804:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801806:	c9                   	leave
+  801807:	c3                   	ret
+
+0000000000801808 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801808:	55                   	push   %rbp
+  801809:	48 89 e5             	mov    %rsp,%rbp
+  80180c:	41 57                	push   %r15
+  80180e:	41 56                	push   %r14
+  801810:	41 55                	push   %r13
+  801812:	41 54                	push   %r12
+  801814:	53                   	push   %rbx
+  801815:	48 83 ec 18          	sub    $0x18,%rsp
+  801819:	49 89 fc             	mov    %rdi,%r12
+  80181c:	49 89 f5             	mov    %rsi,%r13
+  80181f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801823:	8b 45 10             	mov    0x10(%rbp),%eax
+  801826:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801829:	41 89 cf             	mov    %ecx,%r15d
+  80182c:	4c 39 fa             	cmp    %r15,%rdx
+  80182f:	73 5b                	jae    80188c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801831:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801835:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801839:	85 db                	test   %ebx,%ebx
+  80183b:	7e 0e                	jle    80184b <print_num+0x43>
+            putch(padc, put_arg);
+  80183d:	4c 89 ee             	mov    %r13,%rsi
+  801840:	44 89 f7             	mov    %r14d,%edi
+  801843:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801846:	83 eb 01             	sub    $0x1,%ebx
+  801849:	75 f2                	jne    80183d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80184b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80184f:	48 b9 1b 5f 80 00 00 	movabs $0x805f1b,%rcx
+  801856:	00 00 00 
+  801859:	48 b8 0a 5f 80 00 00 	movabs $0x805f0a,%rax
+  801860:	00 00 00 
+  801863:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801867:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80186b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801870:	49 f7 f7             	div    %r15
+  801873:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801877:	4c 89 ee             	mov    %r13,%rsi
+  80187a:	41 ff d4             	call   *%r12
+}
+  80187d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801881:	5b                   	pop    %rbx
+  801882:	41 5c                	pop    %r12
+  801884:	41 5d                	pop    %r13
+  801886:	41 5e                	pop    %r14
+  801888:	41 5f                	pop    %r15
+  80188a:	5d                   	pop    %rbp
+  80188b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80188c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801890:	ba 00 00 00 00       	mov    $0x0,%edx
+  801895:	49 f7 f7             	div    %r15
+  801898:	48 83 ec 08          	sub    $0x8,%rsp
+  80189c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8018a0:	52                   	push   %rdx
+  8018a1:	45 0f be c9          	movsbl %r9b,%r9d
+  8018a5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8018a9:	48 89 c2             	mov    %rax,%rdx
+  8018ac:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  8018b3:	00 00 00 
+  8018b6:	ff d0                	call   *%rax
+  8018b8:	48 83 c4 10          	add    $0x10,%rsp
+  8018bc:	eb 8d                	jmp    80184b <print_num+0x43>
+
+00000000008018be <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8018be:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8018c2:	48 8b 06             	mov    (%rsi),%rax
+  8018c5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8018c9:	73 0a                	jae    8018d5 <sprintputch+0x17>
+        *state->start++ = ch;
+  8018cb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018cf:	48 89 16             	mov    %rdx,(%rsi)
+  8018d2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8018d5:	c3                   	ret
+
+00000000008018d6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8018d6:	55                   	push   %rbp
+  8018d7:	48 89 e5             	mov    %rsp,%rbp
+  8018da:	48 83 ec 50          	sub    $0x50,%rsp
+  8018de:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018e2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018e6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8018ea:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8018f1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018fd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801901:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801905:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  80190c:	00 00 00 
+  80190f:	ff d0                	call   *%rax
+}
+  801911:	c9                   	leave
+  801912:	c3                   	ret
+
+0000000000801913 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801913:	55                   	push   %rbp
+  801914:	48 89 e5             	mov    %rsp,%rbp
+  801917:	41 57                	push   %r15
+  801919:	41 56                	push   %r14
+  80191b:	41 55                	push   %r13
+  80191d:	41 54                	push   %r12
+  80191f:	53                   	push   %rbx
+  801920:	48 83 ec 38          	sub    $0x38,%rsp
+  801924:	49 89 fe             	mov    %rdi,%r14
+  801927:	49 89 f5             	mov    %rsi,%r13
+  80192a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80192d:	48 8b 01             	mov    (%rcx),%rax
+  801930:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801934:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801938:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80193c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801940:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801944:	eb 0d                	jmp    801953 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801946:	40 0f b6 ff          	movzbl %dil,%edi
+  80194a:	4c 89 ee             	mov    %r13,%rsi
+  80194d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801950:	4c 89 e3             	mov    %r12,%rbx
+  801953:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801957:	0f b6 3b             	movzbl (%rbx),%edi
+  80195a:	40 80 ff 25          	cmp    $0x25,%dil
+  80195e:	74 14                	je     801974 <vprintfmt+0x61>
+            if (!ch) return;
+  801960:	40 84 ff             	test   %dil,%dil
+  801963:	75 e1                	jne    801946 <vprintfmt+0x33>
+}
+  801965:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801969:	5b                   	pop    %rbx
+  80196a:	41 5c                	pop    %r12
+  80196c:	41 5d                	pop    %r13
+  80196e:	41 5e                	pop    %r14
+  801970:	41 5f                	pop    %r15
+  801972:	5d                   	pop    %rbp
+  801973:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801974:	be 00 00 00 00       	mov    $0x0,%esi
+  801979:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80197d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801982:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801988:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80198f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801993:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801998:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80199d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8019a0:	83 e8 23             	sub    $0x23,%eax
+  8019a3:	3c 57                	cmp    $0x57,%al
+  8019a5:	0f 87 67 06 00 00    	ja     802012 <vprintfmt+0x6ff>
+  8019ab:	0f b6 c0             	movzbl %al,%eax
+  8019ae:	48 b9 a0 60 80 00 00 	movabs $0x8060a0,%rcx
+  8019b5:	00 00 00 
+  8019b8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8019bb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8019be:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8019c2:	eb cf                	jmp    801993 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8019c4:	49 89 dc             	mov    %rbx,%r12
+  8019c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8019cc:	eb c5                	jmp    801993 <vprintfmt+0x80>
+            padc = ch;
+  8019ce:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8019d2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8019d5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019d8:	eb b9                	jmp    801993 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8019e0:	77 24                	ja     801a06 <vprintfmt+0xf3>
+  8019e2:	89 c1                	mov    %eax,%ecx
+  8019e4:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8019e8:	83 c0 08             	add    $0x8,%eax
+  8019eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8019ee:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8019f1:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8019f4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8019f8:	79 99                	jns    801993 <vprintfmt+0x80>
+                width = precision;
+  8019fa:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8019fe:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a04:	eb 8d                	jmp    801993 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a06:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a0a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801a0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a12:	eb da                	jmp    8019ee <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801a14:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801a19:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a1d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801a23:	3c 39                	cmp    $0x39,%al
+  801a25:	77 1c                	ja     801a43 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801a27:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801a2b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801a2f:	0f b6 c0             	movzbl %al,%eax
+  801a32:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a37:	0f b6 03             	movzbl (%rbx),%eax
+  801a3a:	3c 39                	cmp    $0x39,%al
+  801a3c:	76 e9                	jbe    801a27 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801a3e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801a41:	eb b1                	jmp    8019f4 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801a43:	49 89 dc             	mov    %rbx,%r12
+  801a46:	eb ac                	jmp    8019f4 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801a48:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801a4b:	85 c9                	test   %ecx,%ecx
+  801a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a52:	0f 49 c1             	cmovns %ecx,%eax
+  801a55:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801a58:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a5b:	e9 33 ff ff ff       	jmp    801993 <vprintfmt+0x80>
+            lflag++;
+  801a60:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a63:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a66:	e9 28 ff ff ff       	jmp    801993 <vprintfmt+0x80>
+            lflag--;
+  801a6b:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a6e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a71:	e9 1d ff ff ff       	jmp    801993 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801a76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a79:	83 f8 2f             	cmp    $0x2f,%eax
+  801a7c:	77 19                	ja     801a97 <vprintfmt+0x184>
+  801a7e:	89 c2                	mov    %eax,%edx
+  801a80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a84:	83 c0 08             	add    $0x8,%eax
+  801a87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a8a:	8b 3a                	mov    (%rdx),%edi
+  801a8c:	4c 89 ee             	mov    %r13,%rsi
+  801a8f:	41 ff d6             	call   *%r14
+            break;
+  801a92:	e9 bc fe ff ff       	jmp    801953 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aa3:	eb e5                	jmp    801a8a <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801aa8:	83 f8 2f             	cmp    $0x2f,%eax
+  801aab:	77 5a                	ja     801b07 <vprintfmt+0x1f4>
+  801aad:	89 c2                	mov    %eax,%edx
+  801aaf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ab3:	83 c0 08             	add    $0x8,%eax
+  801ab6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801ab9:	8b 02                	mov    (%rdx),%eax
+  801abb:	89 c1                	mov    %eax,%ecx
+  801abd:	f7 d9                	neg    %ecx
+  801abf:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801ac2:	83 f9 13             	cmp    $0x13,%ecx
+  801ac5:	7f 4e                	jg     801b15 <vprintfmt+0x202>
+  801ac7:	48 63 c1             	movslq %ecx,%rax
+  801aca:	48 ba 60 63 80 00 00 	movabs $0x806360,%rdx
+  801ad1:	00 00 00 
+  801ad4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801ad8:	48 85 c0             	test   %rax,%rax
+  801adb:	74 38                	je     801b15 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801add:	48 89 c1             	mov    %rax,%rcx
+  801ae0:	48 ba 28 65 80 00 00 	movabs $0x806528,%rdx
+  801ae7:	00 00 00 
+  801aea:	4c 89 ee             	mov    %r13,%rsi
+  801aed:	4c 89 f7             	mov    %r14,%rdi
+  801af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af5:	49 b8 d6 18 80 00 00 	movabs $0x8018d6,%r8
+  801afc:	00 00 00 
+  801aff:	41 ff d0             	call   *%r8
+  801b02:	e9 4c fe ff ff       	jmp    801953 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801b07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b13:	eb a4                	jmp    801ab9 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801b15:	48 ba 33 5f 80 00 00 	movabs $0x805f33,%rdx
+  801b1c:	00 00 00 
+  801b1f:	4c 89 ee             	mov    %r13,%rsi
+  801b22:	4c 89 f7             	mov    %r14,%rdi
+  801b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2a:	49 b8 d6 18 80 00 00 	movabs $0x8018d6,%r8
+  801b31:	00 00 00 
+  801b34:	41 ff d0             	call   *%r8
+  801b37:	e9 17 fe ff ff       	jmp    801953 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b3f:	83 f8 2f             	cmp    $0x2f,%eax
+  801b42:	77 6c                	ja     801bb0 <vprintfmt+0x29d>
+  801b44:	89 c2                	mov    %eax,%edx
+  801b46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b4a:	83 c0 08             	add    $0x8,%eax
+  801b4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b50:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801b53:	48 85 f6             	test   %rsi,%rsi
+  801b56:	48 b8 2c 5f 80 00 00 	movabs $0x805f2c,%rax
+  801b5d:	00 00 00 
+  801b60:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b64:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801b68:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b6c:	7e 06                	jle    801b74 <vprintfmt+0x261>
+  801b6e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801b72:	75 4a                	jne    801bbe <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b74:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801b78:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801b7c:	0f b6 00             	movzbl (%rax),%eax
+  801b7f:	84 c0                	test   %al,%al
+  801b81:	0f 85 9a 00 00 00    	jne    801c21 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801b87:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b8a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	0f 8e bd fd ff ff    	jle    801953 <vprintfmt+0x40>
+  801b96:	4c 89 ee             	mov    %r13,%rsi
+  801b99:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b9e:	41 ff d6             	call   *%r14
+  801ba1:	41 83 ec 01          	sub    $0x1,%r12d
+  801ba5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801ba9:	75 eb                	jne    801b96 <vprintfmt+0x283>
+  801bab:	e9 a3 fd ff ff       	jmp    801953 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801bb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbc:	eb 92                	jmp    801b50 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801bbe:	49 63 f7             	movslq %r15d,%rsi
+  801bc1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801bc5:	48 b8 d7 20 80 00 00 	movabs $0x8020d7,%rax
+  801bcc:	00 00 00 
+  801bcf:	ff d0                	call   *%rax
+  801bd1:	48 89 c2             	mov    %rax,%rdx
+  801bd4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bd7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801bd9:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801bdc:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	7e 91                	jle    801b74 <vprintfmt+0x261>
+  801be3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801be8:	4c 89 ee             	mov    %r13,%rsi
+  801beb:	44 89 e7             	mov    %r12d,%edi
+  801bee:	41 ff d6             	call   *%r14
+  801bf1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801bf5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bf8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801bfb:	75 eb                	jne    801be8 <vprintfmt+0x2d5>
+  801bfd:	e9 72 ff ff ff       	jmp    801b74 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c02:	0f b6 f8             	movzbl %al,%edi
+  801c05:	4c 89 ee             	mov    %r13,%rsi
+  801c08:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c0b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c0f:	49 83 c4 01          	add    $0x1,%r12
+  801c13:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801c19:	84 c0                	test   %al,%al
+  801c1b:	0f 84 66 ff ff ff    	je     801b87 <vprintfmt+0x274>
+  801c21:	45 85 ff             	test   %r15d,%r15d
+  801c24:	78 0a                	js     801c30 <vprintfmt+0x31d>
+  801c26:	41 83 ef 01          	sub    $0x1,%r15d
+  801c2a:	0f 88 57 ff ff ff    	js     801b87 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c30:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801c34:	74 cc                	je     801c02 <vprintfmt+0x2ef>
+  801c36:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801c39:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801c3e:	80 fa 5e             	cmp    $0x5e,%dl
+  801c41:	77 c2                	ja     801c05 <vprintfmt+0x2f2>
+  801c43:	eb bd                	jmp    801c02 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801c45:	40 84 f6             	test   %sil,%sil
+  801c48:	75 26                	jne    801c70 <vprintfmt+0x35d>
+    switch (lflag) {
+  801c4a:	85 d2                	test   %edx,%edx
+  801c4c:	74 59                	je     801ca7 <vprintfmt+0x394>
+  801c4e:	83 fa 01             	cmp    $0x1,%edx
+  801c51:	74 7b                	je     801cce <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801c53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c56:	83 f8 2f             	cmp    $0x2f,%eax
+  801c59:	0f 87 96 00 00 00    	ja     801cf5 <vprintfmt+0x3e2>
+  801c5f:	89 c2                	mov    %eax,%edx
+  801c61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c65:	83 c0 08             	add    $0x8,%eax
+  801c68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c6b:	4c 8b 22             	mov    (%rdx),%r12
+  801c6e:	eb 17                	jmp    801c87 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801c70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c73:	83 f8 2f             	cmp    $0x2f,%eax
+  801c76:	77 21                	ja     801c99 <vprintfmt+0x386>
+  801c78:	89 c2                	mov    %eax,%edx
+  801c7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c7e:	83 c0 08             	add    $0x8,%eax
+  801c81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c84:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801c87:	4d 85 e4             	test   %r12,%r12
+  801c8a:	78 7a                	js     801d06 <vprintfmt+0x3f3>
+            num = i;
+  801c8c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c8f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c94:	e9 56 02 00 00       	jmp    801eef <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca5:	eb dd                	jmp    801c84 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801ca7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801caa:	83 f8 2f             	cmp    $0x2f,%eax
+  801cad:	77 11                	ja     801cc0 <vprintfmt+0x3ad>
+  801caf:	89 c2                	mov    %eax,%edx
+  801cb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cb5:	83 c0 08             	add    $0x8,%eax
+  801cb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cbb:	4c 63 22             	movslq (%rdx),%r12
+  801cbe:	eb c7                	jmp    801c87 <vprintfmt+0x374>
+  801cc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ccc:	eb ed                	jmp    801cbb <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801cce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cd1:	83 f8 2f             	cmp    $0x2f,%eax
+  801cd4:	77 11                	ja     801ce7 <vprintfmt+0x3d4>
+  801cd6:	89 c2                	mov    %eax,%edx
+  801cd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cdc:	83 c0 08             	add    $0x8,%eax
+  801cdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ce2:	4c 8b 22             	mov    (%rdx),%r12
+  801ce5:	eb a0                	jmp    801c87 <vprintfmt+0x374>
+  801ce7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ceb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cf3:	eb ed                	jmp    801ce2 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801cf5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cf9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d01:	e9 65 ff ff ff       	jmp    801c6b <vprintfmt+0x358>
+                putch('-', put_arg);
+  801d06:	4c 89 ee             	mov    %r13,%rsi
+  801d09:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801d0e:	41 ff d6             	call   *%r14
+                i = -i;
+  801d11:	49 f7 dc             	neg    %r12
+  801d14:	e9 73 ff ff ff       	jmp    801c8c <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801d19:	40 84 f6             	test   %sil,%sil
+  801d1c:	75 2e                	jne    801d4c <vprintfmt+0x439>
+    switch (lflag) {
+  801d1e:	85 d2                	test   %edx,%edx
+  801d20:	7f 59                	jg     801d7b <vprintfmt+0x468>
+  801d22:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d25:	7d 7a                	jge    801da1 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801d27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d2a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d2d:	0f 87 aa 00 00 00    	ja     801ddd <vprintfmt+0x4ca>
+  801d33:	89 c2                	mov    %eax,%edx
+  801d35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d39:	83 c0 08             	add    $0x8,%eax
+  801d3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d3f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d47:	e9 a3 01 00 00       	jmp    801eef <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d52:	77 19                	ja     801d6d <vprintfmt+0x45a>
+  801d54:	89 c2                	mov    %eax,%edx
+  801d56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d5a:	83 c0 08             	add    $0x8,%eax
+  801d5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d60:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d63:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d68:	e9 82 01 00 00       	jmp    801eef <vprintfmt+0x5dc>
+  801d6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d79:	eb e5                	jmp    801d60 <vprintfmt+0x44d>
+    switch (lflag) {
+  801d7b:	83 fa 01             	cmp    $0x1,%edx
+  801d7e:	75 a7                	jne    801d27 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801d80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d83:	83 f8 2f             	cmp    $0x2f,%eax
+  801d86:	77 47                	ja     801dcf <vprintfmt+0x4bc>
+  801d88:	89 c2                	mov    %eax,%edx
+  801d8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d8e:	83 c0 08             	add    $0x8,%eax
+  801d91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d94:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d97:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d9c:	e9 4e 01 00 00       	jmp    801eef <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801da1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801da4:	83 f8 2f             	cmp    $0x2f,%eax
+  801da7:	77 18                	ja     801dc1 <vprintfmt+0x4ae>
+  801da9:	89 c2                	mov    %eax,%edx
+  801dab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801daf:	83 c0 08             	add    $0x8,%eax
+  801db2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801db5:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801db7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801dbc:	e9 2e 01 00 00       	jmp    801eef <vprintfmt+0x5dc>
+  801dc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dcd:	eb e6                	jmp    801db5 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801dcf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ddb:	eb b7                	jmp    801d94 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ddd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801de1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801de5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801de9:	e9 51 ff ff ff       	jmp    801d3f <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801dee:	40 84 f6             	test   %sil,%sil
+  801df1:	75 2e                	jne    801e21 <vprintfmt+0x50e>
+    switch (lflag) {
+  801df3:	85 d2                	test   %edx,%edx
+  801df5:	7f 59                	jg     801e50 <vprintfmt+0x53d>
+  801df7:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801dfa:	7d 77                	jge    801e73 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801dfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dff:	83 f8 2f             	cmp    $0x2f,%eax
+  801e02:	0f 87 a4 00 00 00    	ja     801eac <vprintfmt+0x599>
+  801e08:	89 c2                	mov    %eax,%edx
+  801e0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e0e:	83 c0 08             	add    $0x8,%eax
+  801e11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e17:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e1c:	e9 ce 00 00 00       	jmp    801eef <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e24:	83 f8 2f             	cmp    $0x2f,%eax
+  801e27:	77 19                	ja     801e42 <vprintfmt+0x52f>
+  801e29:	89 c2                	mov    %eax,%edx
+  801e2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2f:	83 c0 08             	add    $0x8,%eax
+  801e32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e35:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e38:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e3d:	e9 ad 00 00 00       	jmp    801eef <vprintfmt+0x5dc>
+  801e42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e4e:	eb e5                	jmp    801e35 <vprintfmt+0x522>
+    switch (lflag) {
+  801e50:	83 fa 01             	cmp    $0x1,%edx
+  801e53:	75 a7                	jne    801dfc <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801e55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e58:	83 f8 2f             	cmp    $0x2f,%eax
+  801e5b:	77 41                	ja     801e9e <vprintfmt+0x58b>
+  801e5d:	89 c2                	mov    %eax,%edx
+  801e5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e63:	83 c0 08             	add    $0x8,%eax
+  801e66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e69:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e6c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801e71:	eb 7c                	jmp    801eef <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e76:	83 f8 2f             	cmp    $0x2f,%eax
+  801e79:	77 15                	ja     801e90 <vprintfmt+0x57d>
+  801e7b:	89 c2                	mov    %eax,%edx
+  801e7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e81:	83 c0 08             	add    $0x8,%eax
+  801e84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e87:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e89:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e8e:	eb 5f                	jmp    801eef <vprintfmt+0x5dc>
+  801e90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9c:	eb e9                	jmp    801e87 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eaa:	eb bd                	jmp    801e69 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801eac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb8:	e9 57 ff ff ff       	jmp    801e14 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801ebd:	4c 89 ee             	mov    %r13,%rsi
+  801ec0:	bf 30 00 00 00       	mov    $0x30,%edi
+  801ec5:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801ec8:	4c 89 ee             	mov    %r13,%rsi
+  801ecb:	bf 78 00 00 00       	mov    $0x78,%edi
+  801ed0:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801ed3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ed9:	77 47                	ja     801f22 <vprintfmt+0x60f>
+  801edb:	89 c2                	mov    %eax,%edx
+  801edd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee1:	83 c0 08             	add    $0x8,%eax
+  801ee4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ee7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801eea:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801eef:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801ef7:	0f 94 c0             	sete   %al
+  801efa:	0f b6 c0             	movzbl %al,%eax
+  801efd:	50                   	push   %rax
+  801efe:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801f03:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801f07:	4c 89 ee             	mov    %r13,%rsi
+  801f0a:	4c 89 f7             	mov    %r14,%rdi
+  801f0d:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+            break;
+  801f19:	48 83 c4 10          	add    $0x10,%rsp
+  801f1d:	e9 31 fa ff ff       	jmp    801953 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801f22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f2e:	eb b7                	jmp    801ee7 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801f30:	40 84 f6             	test   %sil,%sil
+  801f33:	75 2b                	jne    801f60 <vprintfmt+0x64d>
+    switch (lflag) {
+  801f35:	85 d2                	test   %edx,%edx
+  801f37:	7f 56                	jg     801f8f <vprintfmt+0x67c>
+  801f39:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f3c:	7d 77                	jge    801fb5 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801f3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f41:	83 f8 2f             	cmp    $0x2f,%eax
+  801f44:	0f 87 a7 00 00 00    	ja     801ff1 <vprintfmt+0x6de>
+  801f4a:	89 c2                	mov    %eax,%edx
+  801f4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f50:	83 c0 08             	add    $0x8,%eax
+  801f53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f56:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f59:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f5e:	eb 8f                	jmp    801eef <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f63:	83 f8 2f             	cmp    $0x2f,%eax
+  801f66:	77 19                	ja     801f81 <vprintfmt+0x66e>
+  801f68:	89 c2                	mov    %eax,%edx
+  801f6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f6e:	83 c0 08             	add    $0x8,%eax
+  801f71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f74:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f77:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f7c:	e9 6e ff ff ff       	jmp    801eef <vprintfmt+0x5dc>
+  801f81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f8d:	eb e5                	jmp    801f74 <vprintfmt+0x661>
+    switch (lflag) {
+  801f8f:	83 fa 01             	cmp    $0x1,%edx
+  801f92:	75 aa                	jne    801f3e <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f97:	83 f8 2f             	cmp    $0x2f,%eax
+  801f9a:	77 47                	ja     801fe3 <vprintfmt+0x6d0>
+  801f9c:	89 c2                	mov    %eax,%edx
+  801f9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa2:	83 c0 08             	add    $0x8,%eax
+  801fa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fab:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801fb0:	e9 3a ff ff ff       	jmp    801eef <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801fb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb8:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbb:	77 18                	ja     801fd5 <vprintfmt+0x6c2>
+  801fbd:	89 c2                	mov    %eax,%edx
+  801fbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc3:	83 c0 08             	add    $0x8,%eax
+  801fc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc9:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801fcb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801fd0:	e9 1a ff ff ff       	jmp    801eef <vprintfmt+0x5dc>
+  801fd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fdd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fe1:	eb e6                	jmp    801fc9 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801fe3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fe7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801feb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fef:	eb b7                	jmp    801fa8 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ff1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ff5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ff9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ffd:	e9 54 ff ff ff       	jmp    801f56 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802002:	4c 89 ee             	mov    %r13,%rsi
+  802005:	bf 25 00 00 00       	mov    $0x25,%edi
+  80200a:	41 ff d6             	call   *%r14
+            break;
+  80200d:	e9 41 f9 ff ff       	jmp    801953 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802012:	4c 89 ee             	mov    %r13,%rsi
+  802015:	bf 25 00 00 00       	mov    $0x25,%edi
+  80201a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80201d:	48 83 eb 01          	sub    $0x1,%rbx
+  802021:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802025:	75 f6                	jne    80201d <vprintfmt+0x70a>
+  802027:	e9 27 f9 ff ff       	jmp    801953 <vprintfmt+0x40>
+
+000000000080202c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80202c:	55                   	push   %rbp
+  80202d:	48 89 e5             	mov    %rsp,%rbp
+  802030:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802034:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802038:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80203d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802041:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802048:	48 85 ff             	test   %rdi,%rdi
+  80204b:	74 2b                	je     802078 <vsnprintf+0x4c>
+  80204d:	48 85 f6             	test   %rsi,%rsi
+  802050:	74 26                	je     802078 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802052:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802056:	48 bf be 18 80 00 00 	movabs $0x8018be,%rdi
+  80205d:	00 00 00 
+  802060:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  802067:	00 00 00 
+  80206a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80206c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802070:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802073:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802076:	c9                   	leave
+  802077:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802078:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80207d:	eb f7                	jmp    802076 <vsnprintf+0x4a>
+
+000000000080207f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80207f:	55                   	push   %rbp
+  802080:	48 89 e5             	mov    %rsp,%rbp
+  802083:	48 83 ec 50          	sub    $0x50,%rsp
+  802087:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80208b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80208f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802093:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80209a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80209e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8020a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8020aa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8020ae:	48 b8 2c 20 80 00 00 	movabs $0x80202c,%rax
+  8020b5:	00 00 00 
+  8020b8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8020ba:	c9                   	leave
+  8020bb:	c3                   	ret
+
+00000000008020bc <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8020bc:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8020bf:	74 10                	je     8020d1 <strlen+0x15>
+    size_t n = 0;
+  8020c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8020c6:	48 83 c0 01          	add    $0x1,%rax
+  8020ca:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8020ce:	75 f6                	jne    8020c6 <strlen+0xa>
+  8020d0:	c3                   	ret
+    size_t n = 0;
+  8020d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8020d6:	c3                   	ret
+
+00000000008020d7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8020d7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8020da:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8020df:	48 85 f6             	test   %rsi,%rsi
+  8020e2:	74 11                	je     8020f5 <strnlen+0x1e>
+  8020e4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8020e8:	74 0c                	je     8020f6 <strnlen+0x1f>
+  8020ea:	48 83 c2 01          	add    $0x1,%rdx
+  8020ee:	48 39 d0             	cmp    %rdx,%rax
+  8020f1:	75 f1                	jne    8020e4 <strnlen+0xd>
+  8020f3:	eb 04                	jmp    8020f9 <strnlen+0x22>
+  8020f5:	c3                   	ret
+  8020f6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8020f9:	c3                   	ret
+
+00000000008020fa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8020fa:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8020fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802102:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802106:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802109:	48 83 c2 01          	add    $0x1,%rdx
+  80210d:	84 c9                	test   %cl,%cl
+  80210f:	75 f1                	jne    802102 <strcpy+0x8>
+        ;
+    return res;
+}
+  802111:	c3                   	ret
+
+0000000000802112 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	41 54                	push   %r12
+  802118:	53                   	push   %rbx
+  802119:	48 89 fb             	mov    %rdi,%rbx
+  80211c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80211f:	48 b8 bc 20 80 00 00 	movabs $0x8020bc,%rax
+  802126:	00 00 00 
+  802129:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80212b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80212f:	4c 89 e6             	mov    %r12,%rsi
+  802132:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  802139:	00 00 00 
+  80213c:	ff d0                	call   *%rax
+    return dst;
+}
+  80213e:	48 89 d8             	mov    %rbx,%rax
+  802141:	5b                   	pop    %rbx
+  802142:	41 5c                	pop    %r12
+  802144:	5d                   	pop    %rbp
+  802145:	c3                   	ret
+
+0000000000802146 <toupper>:
+
+int
+toupper(int ch) {
+  802146:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802148:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80214b:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80214e:	83 f9 1a             	cmp    $0x1a,%ecx
+  802151:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802154:	c3                   	ret
+
+0000000000802155 <tolower>:
+
+int
+tolower(int ch) {
+  802155:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802157:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80215a:	8d 57 20             	lea    0x20(%rdi),%edx
+  80215d:	83 f9 1a             	cmp    $0x1a,%ecx
+  802160:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802163:	c3                   	ret
+
+0000000000802164 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802164:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802167:	48 85 d2             	test   %rdx,%rdx
+  80216a:	74 1f                	je     80218b <strncpy+0x27>
+  80216c:	48 01 fa             	add    %rdi,%rdx
+  80216f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802172:	48 83 c1 01          	add    $0x1,%rcx
+  802176:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80217a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80217e:	41 80 f8 01          	cmp    $0x1,%r8b
+  802182:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802186:	48 39 ca             	cmp    %rcx,%rdx
+  802189:	75 e7                	jne    802172 <strncpy+0xe>
+    }
+    return ret;
+}
+  80218b:	c3                   	ret
+
+000000000080218c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80218c:	48 89 f8             	mov    %rdi,%rax
+  80218f:	48 85 d2             	test   %rdx,%rdx
+  802192:	74 24                	je     8021b8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802194:	48 83 ea 01          	sub    $0x1,%rdx
+  802198:	74 1b                	je     8021b5 <strlcpy+0x29>
+  80219a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80219e:	0f b6 16             	movzbl (%rsi),%edx
+  8021a1:	84 d2                	test   %dl,%dl
+  8021a3:	74 10                	je     8021b5 <strlcpy+0x29>
+            *dst++ = *src++;
+  8021a5:	48 83 c6 01          	add    $0x1,%rsi
+  8021a9:	48 83 c0 01          	add    $0x1,%rax
+  8021ad:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8021b0:	48 39 c8             	cmp    %rcx,%rax
+  8021b3:	75 e9                	jne    80219e <strlcpy+0x12>
+        *dst = '\0';
+  8021b5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8021b8:	48 29 f8             	sub    %rdi,%rax
+}
+  8021bb:	c3                   	ret
+
+00000000008021bc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8021bc:	0f b6 07             	movzbl (%rdi),%eax
+  8021bf:	84 c0                	test   %al,%al
+  8021c1:	74 13                	je     8021d6 <strcmp+0x1a>
+  8021c3:	38 06                	cmp    %al,(%rsi)
+  8021c5:	75 0f                	jne    8021d6 <strcmp+0x1a>
+  8021c7:	48 83 c7 01          	add    $0x1,%rdi
+  8021cb:	48 83 c6 01          	add    $0x1,%rsi
+  8021cf:	0f b6 07             	movzbl (%rdi),%eax
+  8021d2:	84 c0                	test   %al,%al
+  8021d4:	75 ed                	jne    8021c3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8021d6:	0f b6 c0             	movzbl %al,%eax
+  8021d9:	0f b6 16             	movzbl (%rsi),%edx
+  8021dc:	29 d0                	sub    %edx,%eax
+}
+  8021de:	c3                   	ret
+
+00000000008021df <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8021df:	48 85 d2             	test   %rdx,%rdx
+  8021e2:	74 1f                	je     802203 <strncmp+0x24>
+  8021e4:	0f b6 07             	movzbl (%rdi),%eax
+  8021e7:	84 c0                	test   %al,%al
+  8021e9:	74 1e                	je     802209 <strncmp+0x2a>
+  8021eb:	3a 06                	cmp    (%rsi),%al
+  8021ed:	75 1a                	jne    802209 <strncmp+0x2a>
+  8021ef:	48 83 c7 01          	add    $0x1,%rdi
+  8021f3:	48 83 c6 01          	add    $0x1,%rsi
+  8021f7:	48 83 ea 01          	sub    $0x1,%rdx
+  8021fb:	75 e7                	jne    8021e4 <strncmp+0x5>
+
+    if (!n) return 0;
+  8021fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802202:	c3                   	ret
+  802203:	b8 00 00 00 00       	mov    $0x0,%eax
+  802208:	c3                   	ret
+  802209:	48 85 d2             	test   %rdx,%rdx
+  80220c:	74 09                	je     802217 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80220e:	0f b6 07             	movzbl (%rdi),%eax
+  802211:	0f b6 16             	movzbl (%rsi),%edx
+  802214:	29 d0                	sub    %edx,%eax
+  802216:	c3                   	ret
+    if (!n) return 0;
+  802217:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221c:	c3                   	ret
+
+000000000080221d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80221d:	0f b6 17             	movzbl (%rdi),%edx
+  802220:	84 d2                	test   %dl,%dl
+  802222:	74 18                	je     80223c <strchr+0x1f>
+        if (*str == c) {
+  802224:	0f be d2             	movsbl %dl,%edx
+  802227:	39 f2                	cmp    %esi,%edx
+  802229:	74 17                	je     802242 <strchr+0x25>
+    for (; *str; str++) {
+  80222b:	48 83 c7 01          	add    $0x1,%rdi
+  80222f:	0f b6 17             	movzbl (%rdi),%edx
+  802232:	84 d2                	test   %dl,%dl
+  802234:	75 ee                	jne    802224 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223b:	c3                   	ret
+  80223c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802241:	c3                   	ret
+  802242:	48 89 f8             	mov    %rdi,%rax
+}
+  802245:	c3                   	ret
+
+0000000000802246 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802246:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802249:	0f b6 17             	movzbl (%rdi),%edx
+  80224c:	84 d2                	test   %dl,%dl
+  80224e:	74 13                	je     802263 <strfind+0x1d>
+  802250:	0f be d2             	movsbl %dl,%edx
+  802253:	39 f2                	cmp    %esi,%edx
+  802255:	74 0b                	je     802262 <strfind+0x1c>
+  802257:	48 83 c0 01          	add    $0x1,%rax
+  80225b:	0f b6 10             	movzbl (%rax),%edx
+  80225e:	84 d2                	test   %dl,%dl
+  802260:	75 ee                	jne    802250 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802262:	c3                   	ret
+  802263:	c3                   	ret
+
+0000000000802264 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802264:	48 39 f7             	cmp    %rsi,%rdi
+  802267:	74 65                	je     8022ce <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802269:	55                   	push   %rbp
+  80226a:	48 89 e5             	mov    %rsp,%rbp
+  80226d:	41 57                	push   %r15
+  80226f:	41 56                	push   %r14
+  802271:	41 55                	push   %r13
+  802273:	41 54                	push   %r12
+  802275:	53                   	push   %rbx
+  802276:	48 83 ec 18          	sub    $0x18,%rsp
+  80227a:	48 89 fb             	mov    %rdi,%rbx
+  80227d:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802280:	49 bf 55 21 80 00 00 	movabs $0x802155,%r15
+  802287:	00 00 00 
+  80228a:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80228e:	41 0f b6 fd          	movzbl %r13b,%edi
+  802292:	41 ff d7             	call   *%r15
+  802295:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802298:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80229d:	41 0f b6 fe          	movzbl %r14b,%edi
+  8022a1:	41 ff d7             	call   *%r15
+  8022a4:	89 c2                	mov    %eax,%edx
+  8022a6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022a9:	29 d0                	sub    %edx,%eax
+  8022ab:	75 12                	jne    8022bf <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8022ad:	48 83 c3 01          	add    $0x1,%rbx
+  8022b1:	45 84 ed             	test   %r13b,%r13b
+  8022b4:	74 09                	je     8022bf <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8022b6:	49 83 c4 01          	add    $0x1,%r12
+  8022ba:	45 84 f6             	test   %r14b,%r14b
+  8022bd:	75 cb                	jne    80228a <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8022bf:	48 83 c4 18          	add    $0x18,%rsp
+  8022c3:	5b                   	pop    %rbx
+  8022c4:	41 5c                	pop    %r12
+  8022c6:	41 5d                	pop    %r13
+  8022c8:	41 5e                	pop    %r14
+  8022ca:	41 5f                	pop    %r15
+  8022cc:	5d                   	pop    %rbp
+  8022cd:	c3                   	ret
+    if (p1 == p2) return 0;
+  8022ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022d3:	c3                   	ret
+
+00000000008022d4 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8022d4:	48 39 f7             	cmp    %rsi,%rdi
+  8022d7:	74 7d                	je     802356 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8022d9:	55                   	push   %rbp
+  8022da:	48 89 e5             	mov    %rsp,%rbp
+  8022dd:	41 57                	push   %r15
+  8022df:	41 56                	push   %r14
+  8022e1:	41 55                	push   %r13
+  8022e3:	41 54                	push   %r12
+  8022e5:	53                   	push   %rbx
+  8022e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8022ea:	48 89 fb             	mov    %rdi,%rbx
+  8022ed:	49 89 f4             	mov    %rsi,%r12
+  8022f0:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8022f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022f8:	49 bf 55 21 80 00 00 	movabs $0x802155,%r15
+  8022ff:	00 00 00 
+    while (n--) {
+  802302:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802306:	48 39 c3             	cmp    %rax,%rbx
+  802309:	74 37                	je     802342 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80230b:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80230f:	41 0f b6 fd          	movzbl %r13b,%edi
+  802313:	41 ff d7             	call   *%r15
+  802316:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802319:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80231e:	41 0f b6 fe          	movzbl %r14b,%edi
+  802322:	41 ff d7             	call   *%r15
+  802325:	89 c2                	mov    %eax,%edx
+  802327:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80232a:	29 d0                	sub    %edx,%eax
+  80232c:	75 19                	jne    802347 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80232e:	48 83 c3 01          	add    $0x1,%rbx
+  802332:	45 84 ed             	test   %r13b,%r13b
+  802335:	74 10                	je     802347 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802337:	49 83 c4 01          	add    $0x1,%r12
+  80233b:	45 84 f6             	test   %r14b,%r14b
+  80233e:	75 c2                	jne    802302 <strncasecmp+0x2e>
+  802340:	eb 05                	jmp    802347 <strncasecmp+0x73>
+  802342:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802347:	48 83 c4 18          	add    $0x18,%rsp
+  80234b:	5b                   	pop    %rbx
+  80234c:	41 5c                	pop    %r12
+  80234e:	41 5d                	pop    %r13
+  802350:	41 5e                	pop    %r14
+  802352:	41 5f                	pop    %r15
+  802354:	5d                   	pop    %rbp
+  802355:	c3                   	ret
+    if (p1 == p2) return 0;
+  802356:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80235b:	c3                   	ret
+
+000000000080235c <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80235c:	83 e7 df             	and    $0xffffffdf,%edi
+  80235f:	83 ef 41             	sub    $0x41,%edi
+  802362:	83 ff 19             	cmp    $0x19,%edi
+  802365:	0f 96 c0             	setbe  %al
+}
+  802368:	c3                   	ret
+
+0000000000802369 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802369:	83 ff 20             	cmp    $0x20,%edi
+  80236c:	0f 94 c0             	sete   %al
+  80236f:	83 ff 09             	cmp    $0x9,%edi
+  802372:	0f 94 c2             	sete   %dl
+  802375:	09 d0                	or     %edx,%eax
+}
+  802377:	c3                   	ret
+
+0000000000802378 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802378:	55                   	push   %rbp
+  802379:	48 89 e5             	mov    %rsp,%rbp
+  80237c:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80237e:	48 bf 1f 64 80 00 00 	movabs $0x80641f,%rdi
+  802385:	00 00 00 
+  802388:	48 b8 1d 22 80 00 00 	movabs $0x80221d,%rax
+  80238f:	00 00 00 
+  802392:	ff d0                	call   *%rax
+  802394:	48 85 c0             	test   %rax,%rax
+  802397:	0f 95 c0             	setne  %al
+}
+  80239a:	5d                   	pop    %rbp
+  80239b:	c3                   	ret
+
+000000000080239c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80239c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80239f:	48 89 f8             	mov    %rdi,%rax
+  8023a2:	48 f7 d8             	neg    %rax
+  8023a5:	83 e0 07             	and    $0x7,%eax
+  8023a8:	49 89 d1             	mov    %rdx,%r9
+  8023ab:	49 29 c1             	sub    %rax,%r9
+  8023ae:	78 36                	js     8023e6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8023b0:	40 0f b6 c6          	movzbl %sil,%eax
+  8023b4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8023bb:	01 01 01 
+  8023be:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8023c2:	40 f6 c7 07          	test   $0x7,%dil
+  8023c6:	75 38                	jne    802400 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8023c8:	4c 89 c9             	mov    %r9,%rcx
+  8023cb:	48 c1 f9 03          	sar    $0x3,%rcx
+  8023cf:	74 0c                	je     8023dd <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8023d1:	fc                   	cld
+  8023d2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8023d5:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8023d9:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8023dd:	4d 85 c9             	test   %r9,%r9
+  8023e0:	75 45                	jne    802427 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8023e2:	4c 89 c0             	mov    %r8,%rax
+  8023e5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8023e6:	48 85 d2             	test   %rdx,%rdx
+  8023e9:	74 f7                	je     8023e2 <memset+0x46>
+  8023eb:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8023ee:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8023f1:	48 83 c0 01          	add    $0x1,%rax
+  8023f5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8023f9:	48 39 c2             	cmp    %rax,%rdx
+  8023fc:	75 f3                	jne    8023f1 <memset+0x55>
+  8023fe:	eb e2                	jmp    8023e2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802400:	40 f6 c7 01          	test   $0x1,%dil
+  802404:	74 06                	je     80240c <memset+0x70>
+  802406:	88 07                	mov    %al,(%rdi)
+  802408:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80240c:	40 f6 c7 02          	test   $0x2,%dil
+  802410:	74 07                	je     802419 <memset+0x7d>
+  802412:	66 89 07             	mov    %ax,(%rdi)
+  802415:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802419:	40 f6 c7 04          	test   $0x4,%dil
+  80241d:	74 a9                	je     8023c8 <memset+0x2c>
+  80241f:	89 07                	mov    %eax,(%rdi)
+  802421:	48 83 c7 04          	add    $0x4,%rdi
+  802425:	eb a1                	jmp    8023c8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802427:	41 f6 c1 04          	test   $0x4,%r9b
+  80242b:	74 06                	je     802433 <memset+0x97>
+  80242d:	89 07                	mov    %eax,(%rdi)
+  80242f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802433:	41 f6 c1 02          	test   $0x2,%r9b
+  802437:	74 07                	je     802440 <memset+0xa4>
+  802439:	66 89 07             	mov    %ax,(%rdi)
+  80243c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802440:	41 f6 c1 01          	test   $0x1,%r9b
+  802444:	74 9c                	je     8023e2 <memset+0x46>
+  802446:	88 07                	mov    %al,(%rdi)
+  802448:	eb 98                	jmp    8023e2 <memset+0x46>
+
+000000000080244a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80244a:	48 89 f8             	mov    %rdi,%rax
+  80244d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802450:	48 39 fe             	cmp    %rdi,%rsi
+  802453:	73 3b                	jae    802490 <memmove+0x46>
+  802455:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802459:	48 39 d7             	cmp    %rdx,%rdi
+  80245c:	73 32                	jae    802490 <memmove+0x46>
+        s += n;
+        d += n;
+  80245e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802462:	48 89 d6             	mov    %rdx,%rsi
+  802465:	48 09 fe             	or     %rdi,%rsi
+  802468:	48 09 ce             	or     %rcx,%rsi
+  80246b:	40 f6 c6 07          	test   $0x7,%sil
+  80246f:	75 12                	jne    802483 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802471:	48 83 ef 08          	sub    $0x8,%rdi
+  802475:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802479:	48 c1 e9 03          	shr    $0x3,%rcx
+  80247d:	fd                   	std
+  80247e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802481:	fc                   	cld
+  802482:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802483:	48 83 ef 01          	sub    $0x1,%rdi
+  802487:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80248b:	fd                   	std
+  80248c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80248e:	eb f1                	jmp    802481 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802490:	48 89 f2             	mov    %rsi,%rdx
+  802493:	48 09 c2             	or     %rax,%rdx
+  802496:	48 09 ca             	or     %rcx,%rdx
+  802499:	f6 c2 07             	test   $0x7,%dl
+  80249c:	75 0c                	jne    8024aa <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80249e:	48 c1 e9 03          	shr    $0x3,%rcx
+  8024a2:	48 89 c7             	mov    %rax,%rdi
+  8024a5:	fc                   	cld
+  8024a6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8024a9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8024aa:	48 89 c7             	mov    %rax,%rdi
+  8024ad:	fc                   	cld
+  8024ae:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8024b0:	c3                   	ret
+
+00000000008024b1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8024b5:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  8024bc:	00 00 00 
+  8024bf:	ff d0                	call   *%rax
+}
+  8024c1:	5d                   	pop    %rbp
+  8024c2:	c3                   	ret
+
+00000000008024c3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8024c3:	55                   	push   %rbp
+  8024c4:	48 89 e5             	mov    %rsp,%rbp
+  8024c7:	41 57                	push   %r15
+  8024c9:	41 56                	push   %r14
+  8024cb:	41 55                	push   %r13
+  8024cd:	41 54                	push   %r12
+  8024cf:	53                   	push   %rbx
+  8024d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d4:	49 89 fe             	mov    %rdi,%r14
+  8024d7:	49 89 f7             	mov    %rsi,%r15
+  8024da:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8024dd:	48 89 f7             	mov    %rsi,%rdi
+  8024e0:	48 b8 bc 20 80 00 00 	movabs $0x8020bc,%rax
+  8024e7:	00 00 00 
+  8024ea:	ff d0                	call   *%rax
+  8024ec:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8024ef:	48 89 de             	mov    %rbx,%rsi
+  8024f2:	4c 89 f7             	mov    %r14,%rdi
+  8024f5:	48 b8 d7 20 80 00 00 	movabs $0x8020d7,%rax
+  8024fc:	00 00 00 
+  8024ff:	ff d0                	call   *%rax
+  802501:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802504:	48 39 c3             	cmp    %rax,%rbx
+  802507:	74 36                	je     80253f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802509:	48 89 d8             	mov    %rbx,%rax
+  80250c:	4c 29 e8             	sub    %r13,%rax
+  80250f:	49 39 c4             	cmp    %rax,%r12
+  802512:	73 31                	jae    802545 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802514:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802519:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80251d:	4c 89 fe             	mov    %r15,%rsi
+  802520:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802527:	00 00 00 
+  80252a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80252c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802530:	48 83 c4 08          	add    $0x8,%rsp
+  802534:	5b                   	pop    %rbx
+  802535:	41 5c                	pop    %r12
+  802537:	41 5d                	pop    %r13
+  802539:	41 5e                	pop    %r14
+  80253b:	41 5f                	pop    %r15
+  80253d:	5d                   	pop    %rbp
+  80253e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80253f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802543:	eb eb                	jmp    802530 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802545:	48 83 eb 01          	sub    $0x1,%rbx
+  802549:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80254d:	48 89 da             	mov    %rbx,%rdx
+  802550:	4c 89 fe             	mov    %r15,%rsi
+  802553:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  80255a:	00 00 00 
+  80255d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80255f:	49 01 de             	add    %rbx,%r14
+  802562:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802567:	eb c3                	jmp    80252c <strlcat+0x69>
+
+0000000000802569 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802569:	48 85 d2             	test   %rdx,%rdx
+  80256c:	74 2d                	je     80259b <memcmp+0x32>
+  80256e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802573:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802577:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80257c:	44 38 c1             	cmp    %r8b,%cl
+  80257f:	75 0f                	jne    802590 <memcmp+0x27>
+    while (n-- > 0) {
+  802581:	48 83 c0 01          	add    $0x1,%rax
+  802585:	48 39 c2             	cmp    %rax,%rdx
+  802588:	75 e9                	jne    802573 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80258a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802590:	0f b6 c1             	movzbl %cl,%eax
+  802593:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802597:	44 29 c0             	sub    %r8d,%eax
+  80259a:	c3                   	ret
+    return 0;
+  80259b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a0:	c3                   	ret
+
+00000000008025a1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8025a1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8025a5:	48 39 c7             	cmp    %rax,%rdi
+  8025a8:	73 0f                	jae    8025b9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8025aa:	40 38 37             	cmp    %sil,(%rdi)
+  8025ad:	74 0e                	je     8025bd <memfind+0x1c>
+    for (; src < end; src++) {
+  8025af:	48 83 c7 01          	add    $0x1,%rdi
+  8025b3:	48 39 f8             	cmp    %rdi,%rax
+  8025b6:	75 f2                	jne    8025aa <memfind+0x9>
+  8025b8:	c3                   	ret
+  8025b9:	48 89 f8             	mov    %rdi,%rax
+  8025bc:	c3                   	ret
+  8025bd:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8025c0:	c3                   	ret
+
+00000000008025c1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8025c1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8025c4:	0f b6 37             	movzbl (%rdi),%esi
+  8025c7:	40 80 fe 20          	cmp    $0x20,%sil
+  8025cb:	74 06                	je     8025d3 <strtol+0x12>
+  8025cd:	40 80 fe 09          	cmp    $0x9,%sil
+  8025d1:	75 13                	jne    8025e6 <strtol+0x25>
+  8025d3:	48 83 c7 01          	add    $0x1,%rdi
+  8025d7:	0f b6 37             	movzbl (%rdi),%esi
+  8025da:	40 80 fe 20          	cmp    $0x20,%sil
+  8025de:	74 f3                	je     8025d3 <strtol+0x12>
+  8025e0:	40 80 fe 09          	cmp    $0x9,%sil
+  8025e4:	74 ed                	je     8025d3 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8025e6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8025e9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8025ec:	3c 01                	cmp    $0x1,%al
+  8025ee:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025f2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8025f8:	75 0f                	jne    802609 <strtol+0x48>
+  8025fa:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8025fd:	74 14                	je     802613 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8025ff:	85 d2                	test   %edx,%edx
+  802601:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802606:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802609:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80260e:	4c 63 ca             	movslq %edx,%r9
+  802611:	eb 36                	jmp    802649 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802613:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802617:	74 0f                	je     802628 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802619:	85 d2                	test   %edx,%edx
+  80261b:	75 ec                	jne    802609 <strtol+0x48>
+        s++;
+  80261d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802621:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802626:	eb e1                	jmp    802609 <strtol+0x48>
+        s += 2;
+  802628:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80262c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802631:	eb d6                	jmp    802609 <strtol+0x48>
+            dig -= '0';
+  802633:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802636:	44 0f b6 c1          	movzbl %cl,%r8d
+  80263a:	41 39 d0             	cmp    %edx,%r8d
+  80263d:	7d 21                	jge    802660 <strtol+0x9f>
+        val = val * base + dig;
+  80263f:	49 0f af c1          	imul   %r9,%rax
+  802643:	0f b6 c9             	movzbl %cl,%ecx
+  802646:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802649:	48 83 c7 01          	add    $0x1,%rdi
+  80264d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802651:	80 f9 39             	cmp    $0x39,%cl
+  802654:	76 dd                	jbe    802633 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802656:	80 f9 7b             	cmp    $0x7b,%cl
+  802659:	77 05                	ja     802660 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80265b:	83 e9 57             	sub    $0x57,%ecx
+  80265e:	eb d6                	jmp    802636 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802660:	4d 85 d2             	test   %r10,%r10
+  802663:	74 03                	je     802668 <strtol+0xa7>
+  802665:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802668:	48 89 c2             	mov    %rax,%rdx
+  80266b:	48 f7 da             	neg    %rdx
+  80266e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802672:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802676:	c3                   	ret
+
+0000000000802677 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802677:	55                   	push   %rbp
+  802678:	48 89 e5             	mov    %rsp,%rbp
+  80267b:	53                   	push   %rbx
+  80267c:	48 89 fa             	mov    %rdi,%rdx
+  80267f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802682:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802687:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80268c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802691:	be 00 00 00 00       	mov    $0x0,%esi
+  802696:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80269c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026a2:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8026a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026a8:	c9                   	leave
+  8026a9:	c3                   	ret
+
+00000000008026aa <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8026aa:	55                   	push   %rbp
+  8026ab:	48 89 e5             	mov    %rsp,%rbp
+  8026ae:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026af:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026d9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026df:	c9                   	leave
+  8026e0:	c3                   	ret
+
+00000000008026e1 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8026e1:	55                   	push   %rbp
+  8026e2:	48 89 e5             	mov    %rsp,%rbp
+  8026e5:	53                   	push   %rbx
+  8026e6:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8026e9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802702:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802708:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80270e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802710:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802714:	c9                   	leave
+  802715:	c3                   	ret
+
+0000000000802716 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802716:	55                   	push   %rbp
+  802717:	48 89 e5             	mov    %rsp,%rbp
+  80271a:	53                   	push   %rbx
+  80271b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  80271f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802722:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802727:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80272c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802731:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802736:	be 00 00 00 00       	mov    $0x0,%esi
+  80273b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802741:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802747:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802749:	48 85 c0             	test   %rax,%rax
+  80274c:	7f 06                	jg     802754 <sys_env_destroy+0x3e>
+}
+  80274e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802752:	c9                   	leave
+  802753:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802754:	49 89 c0             	mov    %rax,%r8
+  802757:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80275c:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802763:	00 00 00 
+  802766:	be 27 00 00 00       	mov    $0x27,%esi
+  80276b:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802772:	00 00 00 
+  802775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277a:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802781:	00 00 00 
+  802784:	41 ff d1             	call   *%r9
+
+0000000000802787 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802787:	55                   	push   %rbp
+  802788:	48 89 e5             	mov    %rsp,%rbp
+  80278b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80278c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802791:	ba 00 00 00 00       	mov    $0x0,%edx
+  802796:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80279b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027bc:	c9                   	leave
+  8027bd:	c3                   	ret
+
+00000000008027be <sys_yield>:
+
+void
+sys_yield(void) {
+  8027be:	55                   	push   %rbp
+  8027bf:	48 89 e5             	mov    %rsp,%rbp
+  8027c2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ed:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f3:	c9                   	leave
+  8027f4:	c3                   	ret
+
+00000000008027f5 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8027f5:	55                   	push   %rbp
+  8027f6:	48 89 e5             	mov    %rsp,%rbp
+  8027f9:	53                   	push   %rbx
+  8027fa:	48 89 fa             	mov    %rdi,%rdx
+  8027fd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802800:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802805:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80280c:	00 00 00 
+  80280f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802814:	be 00 00 00 00       	mov    $0x0,%esi
+  802819:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80281f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802825:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802827:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80282b:	c9                   	leave
+  80282c:	c3                   	ret
+
+000000000080282d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80282d:	55                   	push   %rbp
+  80282e:	48 89 e5             	mov    %rsp,%rbp
+  802831:	53                   	push   %rbx
+  802832:	49 89 f8             	mov    %rdi,%r8
+  802835:	48 89 d3             	mov    %rdx,%rbx
+  802838:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80283b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802840:	4c 89 c2             	mov    %r8,%rdx
+  802843:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802846:	be 00 00 00 00       	mov    $0x0,%esi
+  80284b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802851:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802857:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802859:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80285d:	c9                   	leave
+  80285e:	c3                   	ret
+
+000000000080285f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80285f:	55                   	push   %rbp
+  802860:	48 89 e5             	mov    %rsp,%rbp
+  802863:	53                   	push   %rbx
+  802864:	48 83 ec 08          	sub    $0x8,%rsp
+  802868:	89 f8                	mov    %edi,%eax
+  80286a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80286d:	48 63 f9             	movslq %ecx,%rdi
+  802870:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802873:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802878:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80287b:	be 00 00 00 00       	mov    $0x0,%esi
+  802880:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802886:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80288c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80288e:	48 85 c0             	test   %rax,%rax
+  802891:	7f 06                	jg     802899 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802893:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802897:	c9                   	leave
+  802898:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802899:	49 89 c0             	mov    %rax,%r8
+  80289c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8028a1:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  8028a8:	00 00 00 
+  8028ab:	be 27 00 00 00       	mov    $0x27,%esi
+  8028b0:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  8028b7:	00 00 00 
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bf:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  8028c6:	00 00 00 
+  8028c9:	41 ff d1             	call   *%r9
+
+00000000008028cc <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8028cc:	55                   	push   %rbp
+  8028cd:	48 89 e5             	mov    %rsp,%rbp
+  8028d0:	53                   	push   %rbx
+  8028d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d5:	89 f8                	mov    %edi,%eax
+  8028d7:	49 89 f2             	mov    %rsi,%r10
+  8028da:	48 89 cf             	mov    %rcx,%rdi
+  8028dd:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8028e0:	48 63 da             	movslq %edx,%rbx
+  8028e3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028e6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028eb:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028ee:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8028f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028f9:	48 85 c0             	test   %rax,%rax
+  8028fc:	7f 06                	jg     802904 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8028fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802902:	c9                   	leave
+  802903:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802904:	49 89 c0             	mov    %rax,%r8
+  802907:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80290c:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802913:	00 00 00 
+  802916:	be 27 00 00 00       	mov    $0x27,%esi
+  80291b:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802922:	00 00 00 
+  802925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292a:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802931:	00 00 00 
+  802934:	41 ff d1             	call   *%r9
+
+0000000000802937 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802937:	55                   	push   %rbp
+  802938:	48 89 e5             	mov    %rsp,%rbp
+  80293b:	53                   	push   %rbx
+  80293c:	48 83 ec 08          	sub    $0x8,%rsp
+  802940:	48 89 f1             	mov    %rsi,%rcx
+  802943:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802946:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802949:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80294e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802953:	be 00 00 00 00       	mov    $0x0,%esi
+  802958:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80295e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802964:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802966:	48 85 c0             	test   %rax,%rax
+  802969:	7f 06                	jg     802971 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80296b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80296f:	c9                   	leave
+  802970:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802971:	49 89 c0             	mov    %rax,%r8
+  802974:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802979:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802980:	00 00 00 
+  802983:	be 27 00 00 00       	mov    $0x27,%esi
+  802988:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  80298f:	00 00 00 
+  802992:	b8 00 00 00 00       	mov    $0x0,%eax
+  802997:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  80299e:	00 00 00 
+  8029a1:	41 ff d1             	call   *%r9
+
+00000000008029a4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8029a4:	55                   	push   %rbp
+  8029a5:	48 89 e5             	mov    %rsp,%rbp
+  8029a8:	53                   	push   %rbx
+  8029a9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  8029ad:	48 63 ce             	movslq %esi,%rcx
+  8029b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029b3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029d5:	48 85 c0             	test   %rax,%rax
+  8029d8:	7f 06                	jg     8029e0 <sys_env_set_status+0x3c>
+}
+  8029da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029de:	c9                   	leave
+  8029df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e0:	49 89 c0             	mov    %rax,%r8
+  8029e3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8029e8:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  8029ef:	00 00 00 
+  8029f2:	be 27 00 00 00       	mov    $0x27,%esi
+  8029f7:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  8029fe:	00 00 00 
+  802a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a06:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802a0d:	00 00 00 
+  802a10:	41 ff d1             	call   *%r9
+
+0000000000802a13 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802a13:	55                   	push   %rbp
+  802a14:	48 89 e5             	mov    %rsp,%rbp
+  802a17:	53                   	push   %rbx
+  802a18:	48 83 ec 08          	sub    $0x8,%rsp
+  802a1c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802a1f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a22:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a2c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a31:	be 00 00 00 00       	mov    $0x0,%esi
+  802a36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a3c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a42:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a44:	48 85 c0             	test   %rax,%rax
+  802a47:	7f 06                	jg     802a4f <sys_env_set_trapframe+0x3c>
+}
+  802a49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4d:	c9                   	leave
+  802a4e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a4f:	49 89 c0             	mov    %rax,%r8
+  802a52:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802a57:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802a5e:	00 00 00 
+  802a61:	be 27 00 00 00       	mov    $0x27,%esi
+  802a66:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802a6d:	00 00 00 
+  802a70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a75:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802a7c:	00 00 00 
+  802a7f:	41 ff d1             	call   *%r9
+
+0000000000802a82 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802a82:	55                   	push   %rbp
+  802a83:	48 89 e5             	mov    %rsp,%rbp
+  802a86:	53                   	push   %rbx
+  802a87:	48 83 ec 08          	sub    $0x8,%rsp
+  802a8b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a8e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a91:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a9b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa0:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ab3:	48 85 c0             	test   %rax,%rax
+  802ab6:	7f 06                	jg     802abe <sys_env_set_pgfault_upcall+0x3c>
+}
+  802ab8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802abc:	c9                   	leave
+  802abd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802abe:	49 89 c0             	mov    %rax,%r8
+  802ac1:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802ac6:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802acd:	00 00 00 
+  802ad0:	be 27 00 00 00       	mov    $0x27,%esi
+  802ad5:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802adc:	00 00 00 
+  802adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae4:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802aeb:	00 00 00 
+  802aee:	41 ff d1             	call   *%r9
+
+0000000000802af1 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802af1:	55                   	push   %rbp
+  802af2:	48 89 e5             	mov    %rsp,%rbp
+  802af5:	53                   	push   %rbx
+  802af6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802afa:	40 0f b6 ce          	movzbl %sil,%ecx
+  802afe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b01:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b10:	be 00 00 00 00       	mov    $0x0,%esi
+  802b15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b21:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b23:	48 85 c0             	test   %rax,%rax
+  802b26:	7f 06                	jg     802b2e <sys_env_set_reclaim+0x3d>
+}
+  802b28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b2e:	49 89 c0             	mov    %rax,%r8
+  802b31:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802b36:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802b3d:	00 00 00 
+  802b40:	be 27 00 00 00       	mov    $0x27,%esi
+  802b45:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802b4c:	00 00 00 
+  802b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b54:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802b5b:	00 00 00 
+  802b5e:	41 ff d1             	call   *%r9
+
+0000000000802b61 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802b61:	55                   	push   %rbp
+  802b62:	48 89 e5             	mov    %rsp,%rbp
+  802b65:	53                   	push   %rbx
+  802b66:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802b6a:	48 63 ce             	movslq %esi,%rcx
+  802b6d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b70:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b7f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b90:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b92:	48 85 c0             	test   %rax,%rax
+  802b95:	7f 06                	jg     802b9d <sys_env_set_nice+0x3c>
+}
+  802b97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b9d:	49 89 c0             	mov    %rax,%r8
+  802ba0:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802ba5:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802bac:	00 00 00 
+  802baf:	be 27 00 00 00       	mov    $0x27,%esi
+  802bb4:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802bbb:	00 00 00 
+  802bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc3:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802bca:	00 00 00 
+  802bcd:	41 ff d1             	call   *%r9
+
+0000000000802bd0 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802bd0:	55                   	push   %rbp
+  802bd1:	48 89 e5             	mov    %rsp,%rbp
+  802bd4:	53                   	push   %rbx
+  802bd5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bd8:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802be2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802be7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bec:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bf7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bfd:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802bff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c03:	c9                   	leave
+  802c04:	c3                   	ret
+
+0000000000802c05 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c05:	55                   	push   %rbp
+  802c06:	48 89 e5             	mov    %rsp,%rbp
+  802c09:	53                   	push   %rbx
+  802c0a:	89 f8                	mov    %edi,%eax
+  802c0c:	49 89 f1             	mov    %rsi,%r9
+  802c0f:	48 89 d3             	mov    %rdx,%rbx
+  802c12:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c15:	49 63 f0             	movslq %r8d,%rsi
+  802c18:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c1b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c20:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c23:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c29:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c2f:	cd 30                	int    $0x30
+}
+  802c31:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c35:	c9                   	leave
+  802c36:	c3                   	ret
+
+0000000000802c37 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c37:	55                   	push   %rbp
+  802c38:	48 89 e5             	mov    %rsp,%rbp
+  802c3b:	53                   	push   %rbx
+  802c3c:	89 f8                	mov    %edi,%eax
+  802c3e:	49 89 f1             	mov    %rsi,%r9
+  802c41:	48 89 d3             	mov    %rdx,%rbx
+  802c44:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c47:	49 63 f0             	movslq %r8d,%rsi
+  802c4a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c4d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c52:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c61:	cd 30                	int    $0x30
+}
+  802c63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c67:	c9                   	leave
+  802c68:	c3                   	ret
+
+0000000000802c69 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c69:	55                   	push   %rbp
+  802c6a:	48 89 e5             	mov    %rsp,%rbp
+  802c6d:	53                   	push   %rbx
+  802c6e:	48 83 ec 08          	sub    $0x8,%rsp
+  802c72:	89 f8                	mov    %edi,%eax
+  802c74:	49 89 f2             	mov    %rsi,%r10
+  802c77:	48 89 d3             	mov    %rdx,%rbx
+  802c7a:	48 89 cf             	mov    %rcx,%rdi
+  802c7d:	44 89 c6             	mov    %r8d,%esi
+  802c80:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c83:	48 63 f6             	movslq %esi,%rsi
+  802c86:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c89:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c8e:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c91:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c95:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c97:	48 85 c0             	test   %rax,%rax
+  802c9a:	7f 06                	jg     802ca2 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca0:	c9                   	leave
+  802ca1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ca2:	49 89 c0             	mov    %rax,%r8
+  802ca5:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802caa:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802cb1:	00 00 00 
+  802cb4:	be 27 00 00 00       	mov    $0x27,%esi
+  802cb9:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802cc0:	00 00 00 
+  802cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc8:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802ccf:	00 00 00 
+  802cd2:	41 ff d1             	call   *%r9
+
+0000000000802cd5 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802cd5:	55                   	push   %rbp
+  802cd6:	48 89 e5             	mov    %rsp,%rbp
+  802cd9:	53                   	push   %rbx
+  802cda:	48 83 ec 08          	sub    $0x8,%rsp
+  802cde:	48 89 f1             	mov    %rsi,%rcx
+  802ce1:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802ce4:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802ce8:	48 8b 1a             	mov    (%rdx),%rbx
+  802ceb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cee:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cf3:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cf7:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802cfb:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802cff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d01:	48 85 c0             	test   %rax,%rax
+  802d04:	7f 06                	jg     802d0c <sys_ipc_call_short+0x37>
+}
+  802d06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d0a:	c9                   	leave
+  802d0b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d0c:	49 89 c0             	mov    %rax,%r8
+  802d0f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802d14:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802d1b:	00 00 00 
+  802d1e:	be 27 00 00 00       	mov    $0x27,%esi
+  802d23:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802d2a:	00 00 00 
+  802d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d32:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802d39:	00 00 00 
+  802d3c:	41 ff d1             	call   *%r9
+
+0000000000802d3f <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d3f:	55                   	push   %rbp
+  802d40:	48 89 e5             	mov    %rsp,%rbp
+  802d43:	53                   	push   %rbx
+  802d44:	48 83 ec 08          	sub    $0x8,%rsp
+  802d48:	89 f8                	mov    %edi,%eax
+  802d4a:	49 89 f2             	mov    %rsi,%r10
+  802d4d:	48 89 d3             	mov    %rdx,%rbx
+  802d50:	48 89 cf             	mov    %rcx,%rdi
+  802d53:	44 89 c6             	mov    %r8d,%esi
+  802d56:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d59:	48 63 f6             	movslq %esi,%rsi
+  802d5c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d5f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d64:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d67:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d6b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d6d:	48 85 c0             	test   %rax,%rax
+  802d70:	7f 06                	jg     802d78 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d76:	c9                   	leave
+  802d77:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d78:	49 89 c0             	mov    %rax,%r8
+  802d7b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802d80:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802d87:	00 00 00 
+  802d8a:	be 27 00 00 00       	mov    $0x27,%esi
+  802d8f:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802d96:	00 00 00 
+  802d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9e:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802da5:	00 00 00 
+  802da8:	41 ff d1             	call   *%r9
+
+0000000000802dab <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802dab:	55                   	push   %rbp
+  802dac:	48 89 e5             	mov    %rsp,%rbp
+  802daf:	53                   	push   %rbx
+  802db0:	48 83 ec 08          	sub    $0x8,%rsp
+  802db4:	48 89 fa             	mov    %rdi,%rdx
+  802db7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802dba:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dc4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dc9:	be 00 00 00 00       	mov    $0x0,%esi
+  802dce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dda:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ddc:	48 85 c0             	test   %rax,%rax
+  802ddf:	7f 06                	jg     802de7 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802de1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de5:	c9                   	leave
+  802de6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802de7:	49 89 c0             	mov    %rax,%r8
+  802dea:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802def:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802df6:	00 00 00 
+  802df9:	be 27 00 00 00       	mov    $0x27,%esi
+  802dfe:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802e05:	00 00 00 
+  802e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0d:	49 b9 2b 53 80 00 00 	movabs $0x80532b,%r9
+  802e14:	00 00 00 
+  802e17:	41 ff d1             	call   *%r9
+
+0000000000802e1a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802e1a:	55                   	push   %rbp
+  802e1b:	48 89 e5             	mov    %rsp,%rbp
+  802e1e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e1f:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e24:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e29:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e33:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e38:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e43:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e49:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e4f:	c9                   	leave
+  802e50:	c3                   	ret
+
+0000000000802e51 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802e51:	55                   	push   %rbp
+  802e52:	48 89 e5             	mov    %rsp,%rbp
+  802e55:	53                   	push   %rbx
+  802e56:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e59:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e78:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e7e:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802e80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e84:	c9                   	leave
+  802e85:	c3                   	ret
+
+0000000000802e86 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802e86:	55                   	push   %rbp
+  802e87:	48 89 e5             	mov    %rsp,%rbp
+  802e8a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e8b:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e90:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e95:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e9f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ea4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eaf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802eb5:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802eb7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ebb:	c9                   	leave
+  802ebc:	c3                   	ret
+
+0000000000802ebd <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  802ebd:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  802ec0:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  802ec4:	83 3f 01             	cmpl   $0x1,(%rdi)
+  802ec7:	7e 0f                	jle    802ed8 <argstart+0x1b>
+  802ec9:	48 b8 d3 5e 80 00 00 	movabs $0x805ed3,%rax
+  802ed0:	00 00 00 
+  802ed3:	48 85 f6             	test   %rsi,%rsi
+  802ed6:	75 05                	jne    802edd <argstart+0x20>
+  802ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edd:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  802ee1:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  802ee8:	00 
+}
+  802ee9:	c3                   	ret
+
+0000000000802eea <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  802eea:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802ef1:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  802ef2:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802ef6:	48 85 c0             	test   %rax,%rax
+  802ef9:	0f 84 8f 00 00 00    	je     802f8e <argnext+0xa4>
+argnext(struct Argstate *args) {
+  802eff:	55                   	push   %rbp
+  802f00:	48 89 e5             	mov    %rsp,%rbp
+  802f03:	53                   	push   %rbx
+  802f04:	48 83 ec 08          	sub    $0x8,%rsp
+  802f08:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  802f0b:	80 38 00             	cmpb   $0x0,(%rax)
+  802f0e:	75 52                	jne    802f62 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  802f10:	48 8b 17             	mov    (%rdi),%rdx
+  802f13:	83 3a 01             	cmpl   $0x1,(%rdx)
+  802f16:	74 67                	je     802f7f <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802f18:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802f1c:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  802f20:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802f23:	75 5a                	jne    802f7f <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802f25:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802f29:	74 54                	je     802f7f <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  802f2b:	48 83 c0 01          	add    $0x1,%rax
+  802f2f:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802f33:	8b 12                	mov    (%rdx),%edx
+  802f35:	83 ea 01             	sub    $0x1,%edx
+  802f38:	48 63 d2             	movslq %edx,%rdx
+  802f3b:	48 c1 e2 03          	shl    $0x3,%rdx
+  802f3f:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802f43:	48 83 c7 08          	add    $0x8,%rdi
+  802f47:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  802f53:	48 8b 03             	mov    (%rbx),%rax
+  802f56:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  802f59:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802f5d:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802f60:	74 17                	je     802f79 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  802f62:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802f66:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  802f69:	48 83 c0 01          	add    $0x1,%rax
+  802f6d:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  802f71:	89 d0                	mov    %edx,%eax
+  802f73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f77:	c9                   	leave
+  802f78:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802f79:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802f7d:	75 e3                	jne    802f62 <argnext+0x78>
+    args->curarg = 0;
+  802f7f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802f86:	00 
+    return -1;
+  802f87:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802f8c:	eb e3                	jmp    802f71 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  802f8e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  802f93:	89 d0                	mov    %edx,%eax
+  802f95:	c3                   	ret
+
+0000000000802f96 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  802f96:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802f9a:	48 85 c0             	test   %rax,%rax
+  802f9d:	74 7b                	je     80301a <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  802f9f:	55                   	push   %rbp
+  802fa0:	48 89 e5             	mov    %rsp,%rbp
+  802fa3:	53                   	push   %rbx
+  802fa4:	48 83 ec 08          	sub    $0x8,%rsp
+  802fa8:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802fab:	80 38 00             	cmpb   $0x0,(%rax)
+  802fae:	74 1c                	je     802fcc <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  802fb0:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  802fb4:	48 b8 d3 5e 80 00 00 	movabs $0x805ed3,%rax
+  802fbb:	00 00 00 
+  802fbe:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  802fc2:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  802fc6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fca:	c9                   	leave
+  802fcb:	c3                   	ret
+    } else if (*args->argc > 1) {
+  802fcc:	48 8b 07             	mov    (%rdi),%rax
+  802fcf:	83 38 01             	cmpl   $0x1,(%rax)
+  802fd2:	7f 12                	jg     802fe6 <argnextvalue+0x50>
+        args->argvalue = 0;
+  802fd4:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802fdb:	00 
+        args->curarg = 0;
+  802fdc:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  802fe3:	00 
+  802fe4:	eb dc                	jmp    802fc2 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  802fe6:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802fea:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802fee:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802ff2:	8b 10                	mov    (%rax),%edx
+  802ff4:	83 ea 01             	sub    $0x1,%edx
+  802ff7:	48 63 d2             	movslq %edx,%rdx
+  802ffa:	48 c1 e2 03          	shl    $0x3,%rdx
+  802ffe:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  803002:	48 83 c7 08          	add    $0x8,%rdi
+  803006:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+        (*args->argc)--;
+  803012:	48 8b 03             	mov    (%rbx),%rax
+  803015:	83 28 01             	subl   $0x1,(%rax)
+  803018:	eb a8                	jmp    802fc2 <argnextvalue+0x2c>
+}
+  80301a:	c3                   	ret
+
+000000000080301b <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  80301b:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  80301f:	48 85 c0             	test   %rax,%rax
+  803022:	74 01                	je     803025 <argvalue+0xa>
+}
+  803024:	c3                   	ret
+argvalue(struct Argstate *args) {
+  803025:	55                   	push   %rbp
+  803026:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  803029:	48 b8 96 2f 80 00 00 	movabs $0x802f96,%rax
+  803030:	00 00 00 
+  803033:	ff d0                	call   *%rax
+}
+  803035:	5d                   	pop    %rbp
+  803036:	c3                   	ret
+
+0000000000803037 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803037:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80303e:	ff ff ff 
+  803041:	48 01 f8             	add    %rdi,%rax
+  803044:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803048:	c3                   	ret
+
+0000000000803049 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803049:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803050:	ff ff ff 
+  803053:	48 01 f8             	add    %rdi,%rax
+  803056:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80305a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803060:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803064:	c3                   	ret
+
+0000000000803065 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803065:	55                   	push   %rbp
+  803066:	48 89 e5             	mov    %rsp,%rbp
+  803069:	41 57                	push   %r15
+  80306b:	41 56                	push   %r14
+  80306d:	41 55                	push   %r13
+  80306f:	41 54                	push   %r12
+  803071:	53                   	push   %rbx
+  803072:	48 83 ec 08          	sub    $0x8,%rsp
+  803076:	49 89 ff             	mov    %rdi,%r15
+  803079:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80307e:	49 bd 65 45 80 00 00 	movabs $0x804565,%r13
+  803085:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803088:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80308e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803091:	48 89 df             	mov    %rbx,%rdi
+  803094:	41 ff d5             	call   *%r13
+  803097:	83 e0 04             	and    $0x4,%eax
+  80309a:	74 17                	je     8030b3 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80309c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8030a3:	4c 39 f3             	cmp    %r14,%rbx
+  8030a6:	75 e6                	jne    80308e <fd_alloc+0x29>
+  8030a8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8030ae:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8030b3:	4d 89 27             	mov    %r12,(%r15)
+}
+  8030b6:	48 83 c4 08          	add    $0x8,%rsp
+  8030ba:	5b                   	pop    %rbx
+  8030bb:	41 5c                	pop    %r12
+  8030bd:	41 5d                	pop    %r13
+  8030bf:	41 5e                	pop    %r14
+  8030c1:	41 5f                	pop    %r15
+  8030c3:	5d                   	pop    %rbp
+  8030c4:	c3                   	ret
+
+00000000008030c5 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8030c5:	83 ff 1f             	cmp    $0x1f,%edi
+  8030c8:	77 39                	ja     803103 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8030ca:	55                   	push   %rbp
+  8030cb:	48 89 e5             	mov    %rsp,%rbp
+  8030ce:	41 54                	push   %r12
+  8030d0:	53                   	push   %rbx
+  8030d1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8030d4:	48 63 df             	movslq %edi,%rbx
+  8030d7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8030de:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8030e2:	48 89 df             	mov    %rbx,%rdi
+  8030e5:	48 b8 65 45 80 00 00 	movabs $0x804565,%rax
+  8030ec:	00 00 00 
+  8030ef:	ff d0                	call   *%rax
+  8030f1:	a8 04                	test   $0x4,%al
+  8030f3:	74 14                	je     803109 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8030f5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8030f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030fe:	5b                   	pop    %rbx
+  8030ff:	41 5c                	pop    %r12
+  803101:	5d                   	pop    %rbp
+  803102:	c3                   	ret
+        return -E_INVAL;
+  803103:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803108:	c3                   	ret
+        return -E_INVAL;
+  803109:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80310e:	eb ee                	jmp    8030fe <fd_lookup+0x39>
+
+0000000000803110 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803110:	55                   	push   %rbp
+  803111:	48 89 e5             	mov    %rsp,%rbp
+  803114:	41 54                	push   %r12
+  803116:	53                   	push   %rbx
+  803117:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80311a:	48 b8 e0 64 80 00 00 	movabs $0x8064e0,%rax
+  803121:	00 00 00 
+  803124:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  80312b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80312e:	39 3b                	cmp    %edi,(%rbx)
+  803130:	74 47                	je     803179 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803132:	48 83 c0 08          	add    $0x8,%rax
+  803136:	48 8b 18             	mov    (%rax),%rbx
+  803139:	48 85 db             	test   %rbx,%rbx
+  80313c:	75 f0                	jne    80312e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80313e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803145:	00 00 00 
+  803148:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80314e:	89 fa                	mov    %edi,%edx
+  803150:	48 bf 58 64 80 00 00 	movabs $0x806458,%rdi
+  803157:	00 00 00 
+  80315a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315f:	48 b9 c3 17 80 00 00 	movabs $0x8017c3,%rcx
+  803166:	00 00 00 
+  803169:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80316b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803170:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803174:	5b                   	pop    %rbx
+  803175:	41 5c                	pop    %r12
+  803177:	5d                   	pop    %rbp
+  803178:	c3                   	ret
+            return 0;
+  803179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317e:	eb f0                	jmp    803170 <dev_lookup+0x60>
+
+0000000000803180 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803180:	55                   	push   %rbp
+  803181:	48 89 e5             	mov    %rsp,%rbp
+  803184:	41 55                	push   %r13
+  803186:	41 54                	push   %r12
+  803188:	53                   	push   %rbx
+  803189:	48 83 ec 18          	sub    $0x18,%rsp
+  80318d:	48 89 fb             	mov    %rdi,%rbx
+  803190:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803193:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80319a:	ff ff ff 
+  80319d:	48 01 df             	add    %rbx,%rdi
+  8031a0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8031a4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031a8:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8031af:	00 00 00 
+  8031b2:	ff d0                	call   *%rax
+  8031b4:	41 89 c5             	mov    %eax,%r13d
+  8031b7:	85 c0                	test   %eax,%eax
+  8031b9:	78 06                	js     8031c1 <fd_close+0x41>
+  8031bb:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8031bf:	74 1a                	je     8031db <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8031c1:	45 84 e4             	test   %r12b,%r12b
+  8031c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c9:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8031cd:	44 89 e8             	mov    %r13d,%eax
+  8031d0:	48 83 c4 18          	add    $0x18,%rsp
+  8031d4:	5b                   	pop    %rbx
+  8031d5:	41 5c                	pop    %r12
+  8031d7:	41 5d                	pop    %r13
+  8031d9:	5d                   	pop    %rbp
+  8031da:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8031db:	8b 3b                	mov    (%rbx),%edi
+  8031dd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8031e1:	48 b8 10 31 80 00 00 	movabs $0x803110,%rax
+  8031e8:	00 00 00 
+  8031eb:	ff d0                	call   *%rax
+  8031ed:	41 89 c5             	mov    %eax,%r13d
+  8031f0:	85 c0                	test   %eax,%eax
+  8031f2:	78 1b                	js     80320f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8031f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031f8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031fc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803202:	48 85 c0             	test   %rax,%rax
+  803205:	74 08                	je     80320f <fd_close+0x8f>
+  803207:	48 89 df             	mov    %rbx,%rdi
+  80320a:	ff d0                	call   *%rax
+  80320c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80320f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803214:	48 89 de             	mov    %rbx,%rsi
+  803217:	bf 00 00 00 00       	mov    $0x0,%edi
+  80321c:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  803223:	00 00 00 
+  803226:	ff d0                	call   *%rax
+    return res;
+  803228:	eb a3                	jmp    8031cd <fd_close+0x4d>
+
+000000000080322a <close>:
+
+int
+close(int fdnum) {
+  80322a:	55                   	push   %rbp
+  80322b:	48 89 e5             	mov    %rsp,%rbp
+  80322e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803232:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803236:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803242:	85 c0                	test   %eax,%eax
+  803244:	78 15                	js     80325b <close+0x31>
+
+    return fd_close(fd, 1);
+  803246:	be 01 00 00 00       	mov    $0x1,%esi
+  80324b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80324f:	48 b8 80 31 80 00 00 	movabs $0x803180,%rax
+  803256:	00 00 00 
+  803259:	ff d0                	call   *%rax
+}
+  80325b:	c9                   	leave
+  80325c:	c3                   	ret
+
+000000000080325d <close_all>:
+
+void
+close_all(void) {
+  80325d:	55                   	push   %rbp
+  80325e:	48 89 e5             	mov    %rsp,%rbp
+  803261:	41 54                	push   %r12
+  803263:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803269:	49 bc 2a 32 80 00 00 	movabs $0x80322a,%r12
+  803270:	00 00 00 
+  803273:	89 df                	mov    %ebx,%edi
+  803275:	41 ff d4             	call   *%r12
+  803278:	83 c3 01             	add    $0x1,%ebx
+  80327b:	83 fb 20             	cmp    $0x20,%ebx
+  80327e:	75 f3                	jne    803273 <close_all+0x16>
+}
+  803280:	5b                   	pop    %rbx
+  803281:	41 5c                	pop    %r12
+  803283:	5d                   	pop    %rbp
+  803284:	c3                   	ret
+
+0000000000803285 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803285:	55                   	push   %rbp
+  803286:	48 89 e5             	mov    %rsp,%rbp
+  803289:	41 57                	push   %r15
+  80328b:	41 56                	push   %r14
+  80328d:	41 55                	push   %r13
+  80328f:	41 54                	push   %r12
+  803291:	53                   	push   %rbx
+  803292:	48 83 ec 18          	sub    $0x18,%rsp
+  803296:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803299:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80329d:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+  8032a9:	89 c3                	mov    %eax,%ebx
+  8032ab:	85 c0                	test   %eax,%eax
+  8032ad:	0f 88 b8 00 00 00    	js     80336b <dup+0xe6>
+    close(newfdnum);
+  8032b3:	44 89 e7             	mov    %r12d,%edi
+  8032b6:	48 b8 2a 32 80 00 00 	movabs $0x80322a,%rax
+  8032bd:	00 00 00 
+  8032c0:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8032c2:	4d 63 ec             	movslq %r12d,%r13
+  8032c5:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8032cc:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8032d0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8032d4:	4c 89 ff             	mov    %r15,%rdi
+  8032d7:	49 be 49 30 80 00 00 	movabs $0x803049,%r14
+  8032de:	00 00 00 
+  8032e1:	41 ff d6             	call   *%r14
+  8032e4:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8032e7:	4c 89 ef             	mov    %r13,%rdi
+  8032ea:	41 ff d6             	call   *%r14
+  8032ed:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8032f0:	48 89 df             	mov    %rbx,%rdi
+  8032f3:	48 b8 65 45 80 00 00 	movabs $0x804565,%rax
+  8032fa:	00 00 00 
+  8032fd:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8032ff:	a8 04                	test   $0x4,%al
+  803301:	74 2b                	je     80332e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803303:	41 89 c1             	mov    %eax,%r9d
+  803306:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80330c:	4c 89 f1             	mov    %r14,%rcx
+  80330f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803314:	48 89 de             	mov    %rbx,%rsi
+  803317:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331c:	48 b8 cc 28 80 00 00 	movabs $0x8028cc,%rax
+  803323:	00 00 00 
+  803326:	ff d0                	call   *%rax
+  803328:	89 c3                	mov    %eax,%ebx
+  80332a:	85 c0                	test   %eax,%eax
+  80332c:	78 4e                	js     80337c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80332e:	4c 89 ff             	mov    %r15,%rdi
+  803331:	48 b8 65 45 80 00 00 	movabs $0x804565,%rax
+  803338:	00 00 00 
+  80333b:	ff d0                	call   *%rax
+  80333d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803340:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803346:	4c 89 e9             	mov    %r13,%rcx
+  803349:	ba 00 00 00 00       	mov    $0x0,%edx
+  80334e:	4c 89 fe             	mov    %r15,%rsi
+  803351:	bf 00 00 00 00       	mov    $0x0,%edi
+  803356:	48 b8 cc 28 80 00 00 	movabs $0x8028cc,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+  803362:	89 c3                	mov    %eax,%ebx
+  803364:	85 c0                	test   %eax,%eax
+  803366:	78 14                	js     80337c <dup+0xf7>
+
+    return newfdnum;
+  803368:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80336b:	89 d8                	mov    %ebx,%eax
+  80336d:	48 83 c4 18          	add    $0x18,%rsp
+  803371:	5b                   	pop    %rbx
+  803372:	41 5c                	pop    %r12
+  803374:	41 5d                	pop    %r13
+  803376:	41 5e                	pop    %r14
+  803378:	41 5f                	pop    %r15
+  80337a:	5d                   	pop    %rbp
+  80337b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80337c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803381:	4c 89 ee             	mov    %r13,%rsi
+  803384:	bf 00 00 00 00       	mov    $0x0,%edi
+  803389:	49 bc 37 29 80 00 00 	movabs $0x802937,%r12
+  803390:	00 00 00 
+  803393:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803396:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80339b:	4c 89 f6             	mov    %r14,%rsi
+  80339e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a3:	41 ff d4             	call   *%r12
+    return res;
+  8033a6:	eb c3                	jmp    80336b <dup+0xe6>
+
+00000000008033a8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8033a8:	55                   	push   %rbp
+  8033a9:	48 89 e5             	mov    %rsp,%rbp
+  8033ac:	41 56                	push   %r14
+  8033ae:	41 55                	push   %r13
+  8033b0:	41 54                	push   %r12
+  8033b2:	53                   	push   %rbx
+  8033b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8033b7:	89 fb                	mov    %edi,%ebx
+  8033b9:	49 89 f4             	mov    %rsi,%r12
+  8033bc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033bf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033c3:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8033ca:	00 00 00 
+  8033cd:	ff d0                	call   *%rax
+  8033cf:	85 c0                	test   %eax,%eax
+  8033d1:	78 4c                	js     80341f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033d3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8033d7:	41 8b 3e             	mov    (%r14),%edi
+  8033da:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033de:	48 b8 10 31 80 00 00 	movabs $0x803110,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	85 c0                	test   %eax,%eax
+  8033ec:	78 35                	js     803423 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8033ee:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8033f2:	83 e0 03             	and    $0x3,%eax
+  8033f5:	83 f8 01             	cmp    $0x1,%eax
+  8033f8:	74 2d                	je     803427 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033fe:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803402:	48 85 c0             	test   %rax,%rax
+  803405:	74 56                	je     80345d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803407:	4c 89 ea             	mov    %r13,%rdx
+  80340a:	4c 89 e6             	mov    %r12,%rsi
+  80340d:	4c 89 f7             	mov    %r14,%rdi
+  803410:	ff d0                	call   *%rax
+}
+  803412:	48 83 c4 10          	add    $0x10,%rsp
+  803416:	5b                   	pop    %rbx
+  803417:	41 5c                	pop    %r12
+  803419:	41 5d                	pop    %r13
+  80341b:	41 5e                	pop    %r14
+  80341d:	5d                   	pop    %rbp
+  80341e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80341f:	48 98                	cltq
+  803421:	eb ef                	jmp    803412 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803423:	48 98                	cltq
+  803425:	eb eb                	jmp    803412 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803427:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80342e:	00 00 00 
+  803431:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803437:	89 da                	mov    %ebx,%edx
+  803439:	48 bf 99 64 80 00 00 	movabs $0x806499,%rdi
+  803440:	00 00 00 
+  803443:	b8 00 00 00 00       	mov    $0x0,%eax
+  803448:	48 b9 c3 17 80 00 00 	movabs $0x8017c3,%rcx
+  80344f:	00 00 00 
+  803452:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803454:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80345b:	eb b5                	jmp    803412 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80345d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803464:	eb ac                	jmp    803412 <read+0x6a>
+
+0000000000803466 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803466:	55                   	push   %rbp
+  803467:	48 89 e5             	mov    %rsp,%rbp
+  80346a:	41 57                	push   %r15
+  80346c:	41 56                	push   %r14
+  80346e:	41 55                	push   %r13
+  803470:	41 54                	push   %r12
+  803472:	53                   	push   %rbx
+  803473:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803477:	48 85 d2             	test   %rdx,%rdx
+  80347a:	74 54                	je     8034d0 <readn+0x6a>
+  80347c:	41 89 fd             	mov    %edi,%r13d
+  80347f:	49 89 f6             	mov    %rsi,%r14
+  803482:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803485:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80348a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80348f:	49 bf a8 33 80 00 00 	movabs $0x8033a8,%r15
+  803496:	00 00 00 
+  803499:	4c 89 e2             	mov    %r12,%rdx
+  80349c:	48 29 f2             	sub    %rsi,%rdx
+  80349f:	4c 01 f6             	add    %r14,%rsi
+  8034a2:	44 89 ef             	mov    %r13d,%edi
+  8034a5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8034a8:	85 c0                	test   %eax,%eax
+  8034aa:	78 20                	js     8034cc <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8034ac:	01 c3                	add    %eax,%ebx
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	74 08                	je     8034ba <readn+0x54>
+  8034b2:	48 63 f3             	movslq %ebx,%rsi
+  8034b5:	4c 39 e6             	cmp    %r12,%rsi
+  8034b8:	72 df                	jb     803499 <readn+0x33>
+    }
+    return res;
+  8034ba:	48 63 c3             	movslq %ebx,%rax
+}
+  8034bd:	48 83 c4 08          	add    $0x8,%rsp
+  8034c1:	5b                   	pop    %rbx
+  8034c2:	41 5c                	pop    %r12
+  8034c4:	41 5d                	pop    %r13
+  8034c6:	41 5e                	pop    %r14
+  8034c8:	41 5f                	pop    %r15
+  8034ca:	5d                   	pop    %rbp
+  8034cb:	c3                   	ret
+        if (inc < 0) return inc;
+  8034cc:	48 98                	cltq
+  8034ce:	eb ed                	jmp    8034bd <readn+0x57>
+    int inc = 1, res = 0;
+  8034d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034d5:	eb e3                	jmp    8034ba <readn+0x54>
+
+00000000008034d7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8034d7:	55                   	push   %rbp
+  8034d8:	48 89 e5             	mov    %rsp,%rbp
+  8034db:	41 56                	push   %r14
+  8034dd:	41 55                	push   %r13
+  8034df:	41 54                	push   %r12
+  8034e1:	53                   	push   %rbx
+  8034e2:	48 83 ec 10          	sub    $0x10,%rsp
+  8034e6:	89 fb                	mov    %edi,%ebx
+  8034e8:	49 89 f4             	mov    %rsi,%r12
+  8034eb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034ee:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034f2:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8034f9:	00 00 00 
+  8034fc:	ff d0                	call   *%rax
+  8034fe:	85 c0                	test   %eax,%eax
+  803500:	78 47                	js     803549 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803502:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803506:	41 8b 3e             	mov    (%r14),%edi
+  803509:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80350d:	48 b8 10 31 80 00 00 	movabs $0x803110,%rax
+  803514:	00 00 00 
+  803517:	ff d0                	call   *%rax
+  803519:	85 c0                	test   %eax,%eax
+  80351b:	78 30                	js     80354d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80351d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803522:	74 2d                	je     803551 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803524:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803528:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80352c:	48 85 c0             	test   %rax,%rax
+  80352f:	74 56                	je     803587 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803531:	4c 89 ea             	mov    %r13,%rdx
+  803534:	4c 89 e6             	mov    %r12,%rsi
+  803537:	4c 89 f7             	mov    %r14,%rdi
+  80353a:	ff d0                	call   *%rax
+}
+  80353c:	48 83 c4 10          	add    $0x10,%rsp
+  803540:	5b                   	pop    %rbx
+  803541:	41 5c                	pop    %r12
+  803543:	41 5d                	pop    %r13
+  803545:	41 5e                	pop    %r14
+  803547:	5d                   	pop    %rbp
+  803548:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803549:	48 98                	cltq
+  80354b:	eb ef                	jmp    80353c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80354d:	48 98                	cltq
+  80354f:	eb eb                	jmp    80353c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803551:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803558:	00 00 00 
+  80355b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803561:	89 da                	mov    %ebx,%edx
+  803563:	48 bf b5 64 80 00 00 	movabs $0x8064b5,%rdi
+  80356a:	00 00 00 
+  80356d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803572:	48 b9 c3 17 80 00 00 	movabs $0x8017c3,%rcx
+  803579:	00 00 00 
+  80357c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80357e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803585:	eb b5                	jmp    80353c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803587:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80358e:	eb ac                	jmp    80353c <write+0x65>
+
+0000000000803590 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803590:	55                   	push   %rbp
+  803591:	48 89 e5             	mov    %rsp,%rbp
+  803594:	53                   	push   %rbx
+  803595:	48 83 ec 18          	sub    $0x18,%rsp
+  803599:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80359b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80359f:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8035a6:	00 00 00 
+  8035a9:	ff d0                	call   *%rax
+  8035ab:	85 c0                	test   %eax,%eax
+  8035ad:	78 0c                	js     8035bb <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8035af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035b3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8035b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035bf:	c9                   	leave
+  8035c0:	c3                   	ret
+
+00000000008035c1 <tell>:
+
+int tell(int fdnum) {
+  8035c1:	55                   	push   %rbp
+  8035c2:	48 89 e5             	mov    %rsp,%rbp
+  8035c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035c9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035cd:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8035d4:	00 00 00 
+  8035d7:	ff d0                	call   *%rax
+  8035d9:	85 c0                	test   %eax,%eax
+  8035db:	78 07                	js     8035e4 <tell+0x23>
+
+    return fd->fd_offset;
+  8035dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035e1:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8035e4:	c9                   	leave
+  8035e5:	c3                   	ret
+
+00000000008035e6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8035e6:	55                   	push   %rbp
+  8035e7:	48 89 e5             	mov    %rsp,%rbp
+  8035ea:	41 55                	push   %r13
+  8035ec:	41 54                	push   %r12
+  8035ee:	53                   	push   %rbx
+  8035ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8035f3:	89 fb                	mov    %edi,%ebx
+  8035f5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035f8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035fc:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	78 38                	js     803644 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80360c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803610:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803614:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803618:	48 b8 10 31 80 00 00 	movabs $0x803110,%rax
+  80361f:	00 00 00 
+  803622:	ff d0                	call   *%rax
+  803624:	85 c0                	test   %eax,%eax
+  803626:	78 1c                	js     803644 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803628:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80362d:	74 20                	je     80364f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80362f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803633:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803637:	48 85 c0             	test   %rax,%rax
+  80363a:	74 47                	je     803683 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80363c:	44 89 e6             	mov    %r12d,%esi
+  80363f:	4c 89 ef             	mov    %r13,%rdi
+  803642:	ff d0                	call   *%rax
+}
+  803644:	48 83 c4 18          	add    $0x18,%rsp
+  803648:	5b                   	pop    %rbx
+  803649:	41 5c                	pop    %r12
+  80364b:	41 5d                	pop    %r13
+  80364d:	5d                   	pop    %rbp
+  80364e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80364f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803656:	00 00 00 
+  803659:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80365f:	89 da                	mov    %ebx,%edx
+  803661:	48 bf 78 64 80 00 00 	movabs $0x806478,%rdi
+  803668:	00 00 00 
+  80366b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803670:	48 b9 c3 17 80 00 00 	movabs $0x8017c3,%rcx
+  803677:	00 00 00 
+  80367a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80367c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803681:	eb c1                	jmp    803644 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803683:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803688:	eb ba                	jmp    803644 <ftruncate+0x5e>
+
+000000000080368a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	41 54                	push   %r12
+  803690:	53                   	push   %rbx
+  803691:	48 83 ec 10          	sub    $0x10,%rsp
+  803695:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803698:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80369c:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8036a3:	00 00 00 
+  8036a6:	ff d0                	call   *%rax
+  8036a8:	85 c0                	test   %eax,%eax
+  8036aa:	78 63                	js     80370f <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036ac:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8036b0:	41 8b 3c 24          	mov    (%r12),%edi
+  8036b4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8036b8:	48 b8 10 31 80 00 00 	movabs $0x803110,%rax
+  8036bf:	00 00 00 
+  8036c2:	ff d0                	call   *%rax
+  8036c4:	85 c0                	test   %eax,%eax
+  8036c6:	78 47                	js     80370f <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8036c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036cc:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8036d1:	74 45                	je     803718 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8036d3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8036d6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8036dd:	00 00 00 
+    stat->st_isdir = 0;
+  8036e0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036e7:	00 00 00 
+    stat->st_ino = 0;
+  8036ea:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8036f1:	00 00 00 00 
+    stat->st_version = 0;
+  8036f5:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8036fc:	00 00 00 
+    stat->st_dev = dev;
+  8036ff:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803706:	48 89 de             	mov    %rbx,%rsi
+  803709:	4c 89 e7             	mov    %r12,%rdi
+  80370c:	ff 50 28             	call   *0x28(%rax)
+}
+  80370f:	48 83 c4 10          	add    $0x10,%rsp
+  803713:	5b                   	pop    %rbx
+  803714:	41 5c                	pop    %r12
+  803716:	5d                   	pop    %rbp
+  803717:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803718:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80371d:	eb f0                	jmp    80370f <fstat+0x85>
+
+000000000080371f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80371f:	55                   	push   %rbp
+  803720:	48 89 e5             	mov    %rsp,%rbp
+  803723:	41 54                	push   %r12
+  803725:	53                   	push   %rbx
+  803726:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803729:	be 00 00 00 00       	mov    $0x0,%esi
+  80372e:	48 b8 40 3c 80 00 00 	movabs $0x803c40,%rax
+  803735:	00 00 00 
+  803738:	ff d0                	call   *%rax
+  80373a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80373c:	85 c0                	test   %eax,%eax
+  80373e:	78 25                	js     803765 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803740:	4c 89 e6             	mov    %r12,%rsi
+  803743:	89 c7                	mov    %eax,%edi
+  803745:	48 b8 8a 36 80 00 00 	movabs $0x80368a,%rax
+  80374c:	00 00 00 
+  80374f:	ff d0                	call   *%rax
+  803751:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803754:	89 df                	mov    %ebx,%edi
+  803756:	48 b8 2a 32 80 00 00 	movabs $0x80322a,%rax
+  80375d:	00 00 00 
+  803760:	ff d0                	call   *%rax
+
+    return res;
+  803762:	44 89 e3             	mov    %r12d,%ebx
+}
+  803765:	89 d8                	mov    %ebx,%eax
+  803767:	5b                   	pop    %rbx
+  803768:	41 5c                	pop    %r12
+  80376a:	5d                   	pop    %rbp
+  80376b:	c3                   	ret
+
+000000000080376c <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80376c:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803773:	00 00 00 
+  803776:	83 38 00             	cmpl   $0x0,(%rax)
+  803779:	74 0a                	je     803785 <fsipc_env+0x19>
+    return fsenv;
+}
+  80377b:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803782:	00 00 
+  803784:	c3                   	ret
+fsipc_env(void) {
+  803785:	55                   	push   %rbp
+  803786:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803789:	bf 03 00 00 00       	mov    $0x3,%edi
+  80378e:	48 b8 12 59 80 00 00 	movabs $0x805912,%rax
+  803795:	00 00 00 
+  803798:	ff d0                	call   *%rax
+  80379a:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8037a1:	00 00 
+}
+  8037a3:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8037aa:	00 00 
+  8037ac:	5d                   	pop    %rbp
+  8037ad:	c3                   	ret
+
+00000000008037ae <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8037ae:	55                   	push   %rbp
+  8037af:	48 89 e5             	mov    %rsp,%rbp
+  8037b2:	53                   	push   %rbx
+  8037b3:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8037b7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8037be:	00 
+  8037bf:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8037c6:	00 
+  8037c7:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8037ce:	00 
+  8037cf:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8037d6:	00 
+  8037d7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8037de:	00 
+
+    assert(size <= sizeof(words));
+  8037df:	48 83 fa 28          	cmp    $0x28,%rdx
+  8037e3:	77 38                	ja     80381d <fsipc_short+0x6f>
+  8037e5:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8037e7:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8037eb:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  8037f2:	00 00 00 
+  8037f5:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8037f7:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  8037fe:	00 00 00 
+  803801:	ff d0                	call   *%rax
+  803803:	89 c7                	mov    %eax,%edi
+  803805:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803809:	89 de                	mov    %ebx,%esi
+  80380b:	48 b8 75 58 80 00 00 	movabs $0x805875,%rax
+  803812:	00 00 00 
+  803815:	ff d0                	call   *%rax
+}
+  803817:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80381b:	c9                   	leave
+  80381c:	c3                   	ret
+    assert(size <= sizeof(words));
+  80381d:	48 b9 00 65 80 00 00 	movabs $0x806500,%rcx
+  803824:	00 00 00 
+  803827:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  80382e:	00 00 00 
+  803831:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803836:	48 bf 2b 65 80 00 00 	movabs $0x80652b,%rdi
+  80383d:	00 00 00 
+  803840:	b8 00 00 00 00       	mov    $0x0,%eax
+  803845:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  80384c:	00 00 00 
+  80384f:	41 ff d0             	call   *%r8
+
+0000000000803852 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803852:	55                   	push   %rbp
+  803853:	48 89 e5             	mov    %rsp,%rbp
+  803856:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  80385a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80385d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803860:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803863:	ba 08 00 00 00       	mov    $0x8,%edx
+  803868:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80386c:	bf 02 00 00 00       	mov    $0x2,%edi
+  803871:	48 b8 ae 37 80 00 00 	movabs $0x8037ae,%rax
+  803878:	00 00 00 
+  80387b:	ff d0                	call   *%rax
+}
+  80387d:	c9                   	leave
+  80387e:	c3                   	ret
+
+000000000080387f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80387f:	55                   	push   %rbp
+  803880:	48 89 e5             	mov    %rsp,%rbp
+  803883:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803887:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80388a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  80388d:	ba 04 00 00 00       	mov    $0x4,%edx
+  803892:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803896:	bf 06 00 00 00       	mov    $0x6,%edi
+  80389b:	48 b8 ae 37 80 00 00 	movabs $0x8037ae,%rax
+  8038a2:	00 00 00 
+  8038a5:	ff d0                	call   *%rax
+}
+  8038a7:	c9                   	leave
+  8038a8:	c3                   	ret
+
+00000000008038a9 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8038a9:	55                   	push   %rbp
+  8038aa:	48 89 e5             	mov    %rsp,%rbp
+  8038ad:	41 54                	push   %r12
+  8038af:	53                   	push   %rbx
+  8038b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8038b4:	89 fb                	mov    %edi,%ebx
+  8038b6:	49 89 f4             	mov    %rsi,%r12
+  8038b9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8038bd:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  8038c4:	00 00 00 
+  8038c7:	ff d0                	call   *%rax
+  8038c9:	89 c7                	mov    %eax,%edi
+  8038cb:	6a 00                	push   $0x0
+  8038cd:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8038d1:	50                   	push   %rax
+  8038d2:	4d 89 e1             	mov    %r12,%r9
+  8038d5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8038db:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038e0:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  8038e7:	00 00 00 
+  8038ea:	89 de                	mov    %ebx,%esi
+  8038ec:	48 b8 10 58 80 00 00 	movabs $0x805810,%rax
+  8038f3:	00 00 00 
+  8038f6:	ff d0                	call   *%rax
+}
+  8038f8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8038fc:	5b                   	pop    %rbx
+  8038fd:	41 5c                	pop    %r12
+  8038ff:	5d                   	pop    %rbp
+  803900:	c3                   	ret
+
+0000000000803901 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803901:	55                   	push   %rbp
+  803902:	48 89 e5             	mov    %rsp,%rbp
+  803905:	41 54                	push   %r12
+  803907:	53                   	push   %rbx
+  803908:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80390b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80390e:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803915:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803917:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80391c:	be 00 00 00 00       	mov    $0x0,%esi
+  803921:	bf 05 00 00 00       	mov    $0x5,%edi
+  803926:	48 b8 a9 38 80 00 00 	movabs $0x8038a9,%rax
+  80392d:	00 00 00 
+  803930:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803932:	85 c0                	test   %eax,%eax
+  803934:	78 5a                	js     803990 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803936:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80393d:	00 00 00 
+  803940:	4c 89 e6             	mov    %r12,%rsi
+  803943:	48 89 df             	mov    %rbx,%rdi
+  803946:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  80394d:	00 00 00 
+  803950:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803952:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803959:	00 
+  80395a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803960:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803967:	00 
+  803968:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  80396e:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803975:	00 
+  803976:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  80397d:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803984:	00 
+  803985:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  80398b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803990:	5b                   	pop    %rbx
+  803991:	41 5c                	pop    %r12
+  803993:	5d                   	pop    %rbp
+  803994:	c3                   	ret
+
+0000000000803995 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803995:	55                   	push   %rbp
+  803996:	48 89 e5             	mov    %rsp,%rbp
+  803999:	41 57                	push   %r15
+  80399b:	41 56                	push   %r14
+  80399d:	41 55                	push   %r13
+  80399f:	41 54                	push   %r12
+  8039a1:	53                   	push   %rbx
+  8039a2:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8039a6:	48 85 ff             	test   %rdi,%rdi
+  8039a9:	0f 84 a1 00 00 00    	je     803a50 <devfile_read+0xbb>
+  8039af:	49 89 ff             	mov    %rdi,%r15
+  8039b2:	49 89 f5             	mov    %rsi,%r13
+  8039b5:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8039b8:	48 85 f6             	test   %rsi,%rsi
+  8039bb:	0f 84 c4 00 00 00    	je     803a85 <devfile_read+0xf0>
+    size_t total_read = 0;
+  8039c1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8039c8:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8039c9:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8039d0:	00 00 00 
+  8039d3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8039d7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8039da:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8039e8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039ed:	48 b8 a9 38 80 00 00 	movabs $0x8038a9,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039f9:	85 c0                	test   %eax,%eax
+  8039fb:	0f 88 b9 00 00 00    	js     803aba <devfile_read+0x125>
+        assert(res <= n);
+  803a01:	48 63 d8             	movslq %eax,%rbx
+  803a04:	49 39 dc             	cmp    %rbx,%r12
+  803a07:	0f 82 b1 00 00 00    	jb     803abe <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803a0d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803a12:	0f 87 db 00 00 00    	ja     803af3 <devfile_read+0x15e>
+        if (!res) {
+  803a18:	85 c0                	test   %eax,%eax
+  803a1a:	74 21                	je     803a3d <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803a1c:	48 89 da             	mov    %rbx,%rdx
+  803a1f:	4c 89 f6             	mov    %r14,%rsi
+  803a22:	4c 89 ef             	mov    %r13,%rdi
+  803a25:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  803a2c:	00 00 00 
+  803a2f:	ff d0                	call   *%rax
+        total_read += res;
+  803a31:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803a35:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803a38:	49 29 dc             	sub    %rbx,%r12
+  803a3b:	75 96                	jne    8039d3 <devfile_read+0x3e>
+    return total_read;
+  803a3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803a41:	48 83 c4 18          	add    $0x18,%rsp
+  803a45:	5b                   	pop    %rbx
+  803a46:	41 5c                	pop    %r12
+  803a48:	41 5d                	pop    %r13
+  803a4a:	41 5e                	pop    %r14
+  803a4c:	41 5f                	pop    %r15
+  803a4e:	5d                   	pop    %rbp
+  803a4f:	c3                   	ret
+    assert(fd);
+  803a50:	48 b9 36 65 80 00 00 	movabs $0x806536,%rcx
+  803a57:	00 00 00 
+  803a5a:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  803a61:	00 00 00 
+  803a64:	be 91 00 00 00       	mov    $0x91,%esi
+  803a69:	48 bf 2b 65 80 00 00 	movabs $0x80652b,%rdi
+  803a70:	00 00 00 
+  803a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a78:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  803a7f:	00 00 00 
+  803a82:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a85:	48 b9 39 65 80 00 00 	movabs $0x806539,%rcx
+  803a8c:	00 00 00 
+  803a8f:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  803a96:	00 00 00 
+  803a99:	be 92 00 00 00       	mov    $0x92,%esi
+  803a9e:	48 bf 2b 65 80 00 00 	movabs $0x80652b,%rdi
+  803aa5:	00 00 00 
+  803aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aad:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  803ab4:	00 00 00 
+  803ab7:	41 ff d0             	call   *%r8
+            return res;
+  803aba:	48 98                	cltq
+  803abc:	eb 83                	jmp    803a41 <devfile_read+0xac>
+        assert(res <= n);
+  803abe:	48 b9 3d 65 80 00 00 	movabs $0x80653d,%rcx
+  803ac5:	00 00 00 
+  803ac8:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  803acf:	00 00 00 
+  803ad2:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803ad7:	48 bf 2b 65 80 00 00 	movabs $0x80652b,%rdi
+  803ade:	00 00 00 
+  803ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae6:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  803aed:	00 00 00 
+  803af0:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803af3:	48 b9 48 65 80 00 00 	movabs $0x806548,%rcx
+  803afa:	00 00 00 
+  803afd:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  803b04:	00 00 00 
+  803b07:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803b0c:	48 bf 2b 65 80 00 00 	movabs $0x80652b,%rdi
+  803b13:	00 00 00 
+  803b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b1b:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  803b22:	00 00 00 
+  803b25:	41 ff d0             	call   *%r8
+
+0000000000803b28 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803b28:	55                   	push   %rbp
+  803b29:	48 89 e5             	mov    %rsp,%rbp
+  803b2c:	41 57                	push   %r15
+  803b2e:	41 56                	push   %r14
+  803b30:	41 55                	push   %r13
+  803b32:	41 54                	push   %r12
+  803b34:	53                   	push   %rbx
+  803b35:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803b39:	48 85 ff             	test   %rdi,%rdi
+  803b3c:	0f 84 83 00 00 00    	je     803bc5 <devfile_write+0x9d>
+  803b42:	49 89 ff             	mov    %rdi,%r15
+  803b45:	49 89 f4             	mov    %rsi,%r12
+  803b48:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803b4b:	48 85 f6             	test   %rsi,%rsi
+  803b4e:	0f 84 a6 00 00 00    	je     803bfa <devfile_write+0xd2>
+    size_t total_written = 0;
+  803b54:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803b5a:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803b61:	00 00 00 
+  803b64:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803b68:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803b6b:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803b6f:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803b74:	48 39 d3             	cmp    %rdx,%rbx
+  803b77:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803b7b:	4c 89 e6             	mov    %r12,%rsi
+  803b7e:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803b85:	00 00 00 
+  803b88:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  803b8f:	00 00 00 
+  803b92:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b99:	be 00 00 00 00       	mov    $0x0,%esi
+  803b9e:	bf 04 00 00 00       	mov    $0x4,%edi
+  803ba3:	48 b8 a9 38 80 00 00 	movabs $0x8038a9,%rax
+  803baa:	00 00 00 
+  803bad:	ff d0                	call   *%rax
+        if (res < 0) {
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	78 7c                	js     803c2f <devfile_write+0x107>
+        total_written += res;
+  803bb3:	48 98                	cltq
+  803bb5:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803bb8:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803bbb:	48 29 c3             	sub    %rax,%rbx
+  803bbe:	75 a4                	jne    803b64 <devfile_write+0x3c>
+    return total_written;
+  803bc0:	4c 89 e8             	mov    %r13,%rax
+  803bc3:	eb 6c                	jmp    803c31 <devfile_write+0x109>
+    assert(fd);
+  803bc5:	48 b9 36 65 80 00 00 	movabs $0x806536,%rcx
+  803bcc:	00 00 00 
+  803bcf:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  803bd6:	00 00 00 
+  803bd9:	be bd 00 00 00       	mov    $0xbd,%esi
+  803bde:	48 bf 2b 65 80 00 00 	movabs $0x80652b,%rdi
+  803be5:	00 00 00 
+  803be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bed:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  803bf4:	00 00 00 
+  803bf7:	41 ff d0             	call   *%r8
+    assert(buf);
+  803bfa:	48 b9 39 65 80 00 00 	movabs $0x806539,%rcx
+  803c01:	00 00 00 
+  803c04:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  803c0b:	00 00 00 
+  803c0e:	be be 00 00 00       	mov    $0xbe,%esi
+  803c13:	48 bf 2b 65 80 00 00 	movabs $0x80652b,%rdi
+  803c1a:	00 00 00 
+  803c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c22:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  803c29:	00 00 00 
+  803c2c:	41 ff d0             	call   *%r8
+            return res;
+  803c2f:	48 98                	cltq
+}
+  803c31:	48 83 c4 08          	add    $0x8,%rsp
+  803c35:	5b                   	pop    %rbx
+  803c36:	41 5c                	pop    %r12
+  803c38:	41 5d                	pop    %r13
+  803c3a:	41 5e                	pop    %r14
+  803c3c:	41 5f                	pop    %r15
+  803c3e:	5d                   	pop    %rbp
+  803c3f:	c3                   	ret
+
+0000000000803c40 <open>:
+open(const char *path, int mode) {
+  803c40:	55                   	push   %rbp
+  803c41:	48 89 e5             	mov    %rsp,%rbp
+  803c44:	41 55                	push   %r13
+  803c46:	41 54                	push   %r12
+  803c48:	53                   	push   %rbx
+  803c49:	48 83 ec 18          	sub    $0x18,%rsp
+  803c4d:	49 89 fc             	mov    %rdi,%r12
+  803c50:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803c53:	48 b8 bc 20 80 00 00 	movabs $0x8020bc,%rax
+  803c5a:	00 00 00 
+  803c5d:	ff d0                	call   *%rax
+  803c5f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803c65:	0f 87 8f 00 00 00    	ja     803cfa <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803c6b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c6f:	48 b8 65 30 80 00 00 	movabs $0x803065,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+  803c7b:	89 c3                	mov    %eax,%ebx
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	78 55                	js     803cd6 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803c81:	4c 89 e6             	mov    %r12,%rsi
+  803c84:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803c8b:	00 00 00 
+  803c8e:	48 89 df             	mov    %rbx,%rdi
+  803c91:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  803c98:	00 00 00 
+  803c9b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803c9d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803ca4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ca9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803cad:	bf 01 00 00 00       	mov    $0x1,%edi
+  803cb2:	48 b8 a9 38 80 00 00 	movabs $0x8038a9,%rax
+  803cb9:	00 00 00 
+  803cbc:	ff d0                	call   *%rax
+  803cbe:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803cc0:	85 c0                	test   %eax,%eax
+  803cc2:	78 1f                	js     803ce3 <open+0xa3>
+    return fd2num(fd);
+  803cc4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cc8:	48 b8 37 30 80 00 00 	movabs $0x803037,%rax
+  803ccf:	00 00 00 
+  803cd2:	ff d0                	call   *%rax
+  803cd4:	89 c3                	mov    %eax,%ebx
+}
+  803cd6:	89 d8                	mov    %ebx,%eax
+  803cd8:	48 83 c4 18          	add    $0x18,%rsp
+  803cdc:	5b                   	pop    %rbx
+  803cdd:	41 5c                	pop    %r12
+  803cdf:	41 5d                	pop    %r13
+  803ce1:	5d                   	pop    %rbp
+  803ce2:	c3                   	ret
+        fd_close(fd, 0);
+  803ce3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ce8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cec:	48 b8 80 31 80 00 00 	movabs $0x803180,%rax
+  803cf3:	00 00 00 
+  803cf6:	ff d0                	call   *%rax
+        return res;
+  803cf8:	eb dc                	jmp    803cd6 <open+0x96>
+        return -E_BAD_PATH;
+  803cfa:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803cff:	eb d5                	jmp    803cd6 <open+0x96>
+
+0000000000803d01 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803d01:	55                   	push   %rbp
+  803d02:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803d05:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d0a:	be 00 00 00 00       	mov    $0x0,%esi
+  803d0f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d14:	48 b8 ae 37 80 00 00 	movabs $0x8037ae,%rax
+  803d1b:	00 00 00 
+  803d1e:	ff d0                	call   *%rax
+}
+  803d20:	5d                   	pop    %rbp
+  803d21:	c3                   	ret
+
+0000000000803d22 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803d22:	55                   	push   %rbp
+  803d23:	48 89 e5             	mov    %rsp,%rbp
+  803d26:	41 56                	push   %r14
+  803d28:	41 55                	push   %r13
+  803d2a:	41 54                	push   %r12
+  803d2c:	53                   	push   %rbx
+  803d2d:	48 83 ec 10          	sub    $0x10,%rsp
+  803d31:	41 89 f6             	mov    %esi,%r14d
+  803d34:	49 89 d4             	mov    %rdx,%r12
+  803d37:	48 89 cb             	mov    %rcx,%rbx
+  803d3a:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d3d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d41:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  803d48:	00 00 00 
+  803d4b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d4d:	85 c0                	test   %eax,%eax
+  803d4f:	78 46                	js     803d97 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d51:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d55:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803d5c:	00 00 00 
+  803d5f:	8b 00                	mov    (%rax),%eax
+  803d61:	39 02                	cmp    %eax,(%rdx)
+  803d63:	75 3f                	jne    803da4 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803d65:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803d6c:	00 00 00 
+  803d6f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803d72:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803d74:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803d78:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803d7c:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803d80:	48 89 da             	mov    %rbx,%rdx
+  803d83:	4c 89 e6             	mov    %r12,%rsi
+  803d86:	bf 09 00 00 00       	mov    $0x9,%edi
+  803d8b:	48 b8 a9 38 80 00 00 	movabs $0x8038a9,%rax
+  803d92:	00 00 00 
+  803d95:	ff d0                	call   *%rax
+}
+  803d97:	48 83 c4 10          	add    $0x10,%rsp
+  803d9b:	5b                   	pop    %rbx
+  803d9c:	41 5c                	pop    %r12
+  803d9e:	41 5d                	pop    %r13
+  803da0:	41 5e                	pop    %r14
+  803da2:	5d                   	pop    %rbp
+  803da3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803da4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803da9:	eb ec                	jmp    803d97 <file_map+0x75>
+
+0000000000803dab <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803dab:	55                   	push   %rbp
+  803dac:	48 89 e5             	mov    %rsp,%rbp
+  803daf:	41 54                	push   %r12
+  803db1:	53                   	push   %rbx
+  803db2:	48 83 ec 20          	sub    $0x20,%rsp
+  803db6:	41 89 f4             	mov    %esi,%r12d
+  803db9:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803dbc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803dc0:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  803dc7:	00 00 00 
+  803dca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dcc:	85 c0                	test   %eax,%eax
+  803dce:	78 3c                	js     803e0c <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dd4:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803ddb:	00 00 00 
+  803dde:	8b 0a                	mov    (%rdx),%ecx
+  803de0:	39 08                	cmp    %ecx,(%rax)
+  803de2:	75 31                	jne    803e15 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803de4:	8b 40 0c             	mov    0xc(%rax),%eax
+  803de7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803dea:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803dee:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803df2:	ba 10 00 00 00       	mov    $0x10,%edx
+  803df7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803dfb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803e00:	48 b8 ae 37 80 00 00 	movabs $0x8037ae,%rax
+  803e07:	00 00 00 
+  803e0a:	ff d0                	call   *%rax
+}
+  803e0c:	48 83 c4 20          	add    $0x20,%rsp
+  803e10:	5b                   	pop    %rbx
+  803e11:	41 5c                	pop    %r12
+  803e13:	5d                   	pop    %rbp
+  803e14:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e15:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e1a:	eb f0                	jmp    803e0c <file_msync+0x61>
+
+0000000000803e1c <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803e1c:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803e20:	7f 01                	jg     803e23 <writebuf+0x7>
+  803e22:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803e23:	55                   	push   %rbp
+  803e24:	48 89 e5             	mov    %rsp,%rbp
+  803e27:	53                   	push   %rbx
+  803e28:	48 83 ec 08          	sub    $0x8,%rsp
+  803e2c:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803e2f:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803e33:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803e37:	8b 3f                	mov    (%rdi),%edi
+  803e39:	48 b8 d7 34 80 00 00 	movabs $0x8034d7,%rax
+  803e40:	00 00 00 
+  803e43:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803e45:	48 85 c0             	test   %rax,%rax
+  803e48:	7e 04                	jle    803e4e <writebuf+0x32>
+  803e4a:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803e4e:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803e52:	48 39 c2             	cmp    %rax,%rdx
+  803e55:	74 0f                	je     803e66 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803e57:	48 85 c0             	test   %rax,%rax
+  803e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e5f:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803e63:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803e66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e6a:	c9                   	leave
+  803e6b:	c3                   	ret
+
+0000000000803e6c <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803e6c:	8b 46 04             	mov    0x4(%rsi),%eax
+  803e6f:	8d 50 01             	lea    0x1(%rax),%edx
+  803e72:	89 56 04             	mov    %edx,0x4(%rsi)
+  803e75:	48 98                	cltq
+  803e77:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803e7c:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e82:	74 01                	je     803e85 <putch+0x19>
+  803e84:	c3                   	ret
+putch(int ch, void *arg) {
+  803e85:	55                   	push   %rbp
+  803e86:	48 89 e5             	mov    %rsp,%rbp
+  803e89:	53                   	push   %rbx
+  803e8a:	48 83 ec 08          	sub    $0x8,%rsp
+  803e8e:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e91:	48 89 f7             	mov    %rsi,%rdi
+  803e94:	48 b8 1c 3e 80 00 00 	movabs $0x803e1c,%rax
+  803e9b:	00 00 00 
+  803e9e:	ff d0                	call   *%rax
+        state->offset = 0;
+  803ea0:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803ea7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803eab:	c9                   	leave
+  803eac:	c3                   	ret
+
+0000000000803ead <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803ead:	55                   	push   %rbp
+  803eae:	48 89 e5             	mov    %rsp,%rbp
+  803eb1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803eb8:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803ebb:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803ec1:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803ec8:	00 00 00 
+    state.result = 0;
+  803ecb:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803ed2:	00 00 00 00 
+    state.error = 1;
+  803ed6:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803edd:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803ee0:	48 89 f2             	mov    %rsi,%rdx
+  803ee3:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803eea:	48 bf 6c 3e 80 00 00 	movabs $0x803e6c,%rdi
+  803ef1:	00 00 00 
+  803ef4:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  803efb:	00 00 00 
+  803efe:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803f00:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803f07:	7f 14                	jg     803f1d <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803f09:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803f10:	48 85 c0             	test   %rax,%rax
+  803f13:	75 06                	jne    803f1b <vfprintf+0x6e>
+  803f15:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803f1b:	c9                   	leave
+  803f1c:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803f1d:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803f24:	48 b8 1c 3e 80 00 00 	movabs $0x803e1c,%rax
+  803f2b:	00 00 00 
+  803f2e:	ff d0                	call   *%rax
+  803f30:	eb d7                	jmp    803f09 <vfprintf+0x5c>
+
+0000000000803f32 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803f32:	55                   	push   %rbp
+  803f33:	48 89 e5             	mov    %rsp,%rbp
+  803f36:	48 83 ec 50          	sub    $0x50,%rsp
+  803f3a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f3e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f42:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f46:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f4a:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f51:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f59:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f5d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803f61:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f65:	48 b8 ad 3e 80 00 00 	movabs $0x803ead,%rax
+  803f6c:	00 00 00 
+  803f6f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f71:	c9                   	leave
+  803f72:	c3                   	ret
+
+0000000000803f73 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803f73:	55                   	push   %rbp
+  803f74:	48 89 e5             	mov    %rsp,%rbp
+  803f77:	48 83 ec 50          	sub    $0x50,%rsp
+  803f7b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f7f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f83:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f87:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f8b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f8f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f96:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f9e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803fa2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803fa6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803faa:	48 89 fe             	mov    %rdi,%rsi
+  803fad:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fb2:	48 b8 ad 3e 80 00 00 	movabs $0x803ead,%rax
+  803fb9:	00 00 00 
+  803fbc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803fbe:	c9                   	leave
+  803fbf:	c3                   	ret
+
+0000000000803fc0 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803fc0:	55                   	push   %rbp
+  803fc1:	48 89 e5             	mov    %rsp,%rbp
+  803fc4:	41 54                	push   %r12
+  803fc6:	53                   	push   %rbx
+  803fc7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fca:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  803fd1:	00 00 00 
+  803fd4:	ff d0                	call   *%rax
+  803fd6:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803fd9:	48 be 70 65 80 00 00 	movabs $0x806570,%rsi
+  803fe0:	00 00 00 
+  803fe3:	48 89 df             	mov    %rbx,%rdi
+  803fe6:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  803fed:	00 00 00 
+  803ff0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803ff2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803ff7:	41 2b 04 24          	sub    (%r12),%eax
+  803ffb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804001:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804008:	00 00 00 
+    stat->st_dev = &devpipe;
+  80400b:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804012:	00 00 00 
+  804015:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80401c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804021:	5b                   	pop    %rbx
+  804022:	41 5c                	pop    %r12
+  804024:	5d                   	pop    %rbp
+  804025:	c3                   	ret
+
+0000000000804026 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804026:	55                   	push   %rbp
+  804027:	48 89 e5             	mov    %rsp,%rbp
+  80402a:	41 54                	push   %r12
+  80402c:	53                   	push   %rbx
+  80402d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804030:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804035:	48 89 fe             	mov    %rdi,%rsi
+  804038:	bf 00 00 00 00       	mov    $0x0,%edi
+  80403d:	49 bc 37 29 80 00 00 	movabs $0x802937,%r12
+  804044:	00 00 00 
+  804047:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80404a:	48 89 df             	mov    %rbx,%rdi
+  80404d:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  804054:	00 00 00 
+  804057:	ff d0                	call   *%rax
+  804059:	48 89 c6             	mov    %rax,%rsi
+  80405c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804061:	bf 00 00 00 00       	mov    $0x0,%edi
+  804066:	41 ff d4             	call   *%r12
+}
+  804069:	5b                   	pop    %rbx
+  80406a:	41 5c                	pop    %r12
+  80406c:	5d                   	pop    %rbp
+  80406d:	c3                   	ret
+
+000000000080406e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80406e:	55                   	push   %rbp
+  80406f:	48 89 e5             	mov    %rsp,%rbp
+  804072:	41 57                	push   %r15
+  804074:	41 56                	push   %r14
+  804076:	41 55                	push   %r13
+  804078:	41 54                	push   %r12
+  80407a:	53                   	push   %rbx
+  80407b:	48 83 ec 18          	sub    $0x18,%rsp
+  80407f:	49 89 fc             	mov    %rdi,%r12
+  804082:	49 89 f5             	mov    %rsi,%r13
+  804085:	49 89 d7             	mov    %rdx,%r15
+  804088:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80408c:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  804093:	00 00 00 
+  804096:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804098:	4d 85 ff             	test   %r15,%r15
+  80409b:	0f 84 af 00 00 00    	je     804150 <devpipe_write+0xe2>
+  8040a1:	48 89 c3             	mov    %rax,%rbx
+  8040a4:	4c 89 f8             	mov    %r15,%rax
+  8040a7:	4d 89 ef             	mov    %r13,%r15
+  8040aa:	4c 01 e8             	add    %r13,%rax
+  8040ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040b1:	49 bd 2d 28 80 00 00 	movabs $0x80282d,%r13
+  8040b8:	00 00 00 
+            sys_yield();
+  8040bb:	49 be be 27 80 00 00 	movabs $0x8027be,%r14
+  8040c2:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040c5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040c8:	48 63 ce             	movslq %esi,%rcx
+  8040cb:	48 63 03             	movslq (%rbx),%rax
+  8040ce:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040d4:	48 39 c1             	cmp    %rax,%rcx
+  8040d7:	72 2e                	jb     804107 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040de:	48 89 da             	mov    %rbx,%rdx
+  8040e1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040e6:	4c 89 e7             	mov    %r12,%rdi
+  8040e9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8040ec:	85 c0                	test   %eax,%eax
+  8040ee:	74 66                	je     804156 <devpipe_write+0xe8>
+            sys_yield();
+  8040f0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040f3:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040f6:	48 63 ce             	movslq %esi,%rcx
+  8040f9:	48 63 03             	movslq (%rbx),%rax
+  8040fc:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804102:	48 39 c1             	cmp    %rax,%rcx
+  804105:	73 d2                	jae    8040d9 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804107:	41 0f b6 3f          	movzbl (%r15),%edi
+  80410b:	48 89 ca             	mov    %rcx,%rdx
+  80410e:	48 c1 ea 03          	shr    $0x3,%rdx
+  804112:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804119:	08 10 20 
+  80411c:	48 f7 e2             	mul    %rdx
+  80411f:	48 c1 ea 06          	shr    $0x6,%rdx
+  804123:	48 89 d0             	mov    %rdx,%rax
+  804126:	48 c1 e0 09          	shl    $0x9,%rax
+  80412a:	48 29 d0             	sub    %rdx,%rax
+  80412d:	48 c1 e0 03          	shl    $0x3,%rax
+  804131:	48 29 c1             	sub    %rax,%rcx
+  804134:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804139:	83 c6 01             	add    $0x1,%esi
+  80413c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80413f:	49 83 c7 01          	add    $0x1,%r15
+  804143:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804147:	49 39 c7             	cmp    %rax,%r15
+  80414a:	0f 85 75 ff ff ff    	jne    8040c5 <devpipe_write+0x57>
+    return n;
+  804150:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804154:	eb 05                	jmp    80415b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804156:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80415b:	48 83 c4 18          	add    $0x18,%rsp
+  80415f:	5b                   	pop    %rbx
+  804160:	41 5c                	pop    %r12
+  804162:	41 5d                	pop    %r13
+  804164:	41 5e                	pop    %r14
+  804166:	41 5f                	pop    %r15
+  804168:	5d                   	pop    %rbp
+  804169:	c3                   	ret
+
+000000000080416a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80416a:	55                   	push   %rbp
+  80416b:	48 89 e5             	mov    %rsp,%rbp
+  80416e:	41 57                	push   %r15
+  804170:	41 56                	push   %r14
+  804172:	41 55                	push   %r13
+  804174:	41 54                	push   %r12
+  804176:	53                   	push   %rbx
+  804177:	48 83 ec 18          	sub    $0x18,%rsp
+  80417b:	49 89 fc             	mov    %rdi,%r12
+  80417e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804182:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804186:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  80418d:	00 00 00 
+  804190:	ff d0                	call   *%rax
+  804192:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804195:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80419b:	49 bd 2d 28 80 00 00 	movabs $0x80282d,%r13
+  8041a2:	00 00 00 
+            sys_yield();
+  8041a5:	49 be be 27 80 00 00 	movabs $0x8027be,%r14
+  8041ac:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8041af:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8041b4:	74 7d                	je     804233 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041b6:	8b 03                	mov    (%rbx),%eax
+  8041b8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041bb:	75 26                	jne    8041e3 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8041bd:	4d 85 ff             	test   %r15,%r15
+  8041c0:	75 77                	jne    804239 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041c2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041c7:	48 89 da             	mov    %rbx,%rdx
+  8041ca:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041cf:	4c 89 e7             	mov    %r12,%rdi
+  8041d2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8041d5:	85 c0                	test   %eax,%eax
+  8041d7:	74 72                	je     80424b <devpipe_read+0xe1>
+            sys_yield();
+  8041d9:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041dc:	8b 03                	mov    (%rbx),%eax
+  8041de:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041e1:	74 df                	je     8041c2 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8041e3:	48 63 c8             	movslq %eax,%rcx
+  8041e6:	48 89 ca             	mov    %rcx,%rdx
+  8041e9:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041ed:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8041f4:	08 10 20 
+  8041f7:	48 89 d0             	mov    %rdx,%rax
+  8041fa:	48 f7 e6             	mul    %rsi
+  8041fd:	48 c1 ea 06          	shr    $0x6,%rdx
+  804201:	48 89 d0             	mov    %rdx,%rax
+  804204:	48 c1 e0 09          	shl    $0x9,%rax
+  804208:	48 29 d0             	sub    %rdx,%rax
+  80420b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804212:	00 
+  804213:	48 89 c8             	mov    %rcx,%rax
+  804216:	48 29 d0             	sub    %rdx,%rax
+  804219:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80421e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804222:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804226:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804229:	49 83 c7 01          	add    $0x1,%r15
+  80422d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804231:	75 83                	jne    8041b6 <devpipe_read+0x4c>
+    return n;
+  804233:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804237:	eb 03                	jmp    80423c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804239:	4c 89 f8             	mov    %r15,%rax
+}
+  80423c:	48 83 c4 18          	add    $0x18,%rsp
+  804240:	5b                   	pop    %rbx
+  804241:	41 5c                	pop    %r12
+  804243:	41 5d                	pop    %r13
+  804245:	41 5e                	pop    %r14
+  804247:	41 5f                	pop    %r15
+  804249:	5d                   	pop    %rbp
+  80424a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80424b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804250:	eb ea                	jmp    80423c <devpipe_read+0xd2>
+
+0000000000804252 <pipe>:
+pipe(int pfd[2]) {
+  804252:	55                   	push   %rbp
+  804253:	48 89 e5             	mov    %rsp,%rbp
+  804256:	41 55                	push   %r13
+  804258:	41 54                	push   %r12
+  80425a:	53                   	push   %rbx
+  80425b:	48 83 ec 18          	sub    $0x18,%rsp
+  80425f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804262:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804266:	48 b8 65 30 80 00 00 	movabs $0x803065,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+  804272:	89 c3                	mov    %eax,%ebx
+  804274:	85 c0                	test   %eax,%eax
+  804276:	0f 88 a0 01 00 00    	js     80441c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80427c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804281:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804286:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80428a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80428f:	48 b8 5f 28 80 00 00 	movabs $0x80285f,%rax
+  804296:	00 00 00 
+  804299:	ff d0                	call   *%rax
+  80429b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80429d:	85 c0                	test   %eax,%eax
+  80429f:	0f 88 77 01 00 00    	js     80441c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8042a5:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8042a9:	48 b8 65 30 80 00 00 	movabs $0x803065,%rax
+  8042b0:	00 00 00 
+  8042b3:	ff d0                	call   *%rax
+  8042b5:	89 c3                	mov    %eax,%ebx
+  8042b7:	85 c0                	test   %eax,%eax
+  8042b9:	0f 88 43 01 00 00    	js     804402 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8042bf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042c9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8042cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042d2:	48 b8 5f 28 80 00 00 	movabs $0x80285f,%rax
+  8042d9:	00 00 00 
+  8042dc:	ff d0                	call   *%rax
+  8042de:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8042e0:	85 c0                	test   %eax,%eax
+  8042e2:	0f 88 1a 01 00 00    	js     804402 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8042e8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8042ec:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  8042f3:	00 00 00 
+  8042f6:	ff d0                	call   *%rax
+  8042f8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8042fb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804300:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804305:	48 89 c6             	mov    %rax,%rsi
+  804308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80430d:	48 b8 5f 28 80 00 00 	movabs $0x80285f,%rax
+  804314:	00 00 00 
+  804317:	ff d0                	call   *%rax
+  804319:	89 c3                	mov    %eax,%ebx
+  80431b:	85 c0                	test   %eax,%eax
+  80431d:	0f 88 c5 00 00 00    	js     8043e8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804323:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804327:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  80432e:	00 00 00 
+  804331:	ff d0                	call   *%rax
+  804333:	48 89 c1             	mov    %rax,%rcx
+  804336:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80433c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804342:	ba 00 00 00 00       	mov    $0x0,%edx
+  804347:	4c 89 ee             	mov    %r13,%rsi
+  80434a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80434f:	48 b8 cc 28 80 00 00 	movabs $0x8028cc,%rax
+  804356:	00 00 00 
+  804359:	ff d0                	call   *%rax
+  80435b:	89 c3                	mov    %eax,%ebx
+  80435d:	85 c0                	test   %eax,%eax
+  80435f:	78 6e                	js     8043cf <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804361:	be 00 10 00 00       	mov    $0x1000,%esi
+  804366:	4c 89 ef             	mov    %r13,%rdi
+  804369:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  804370:	00 00 00 
+  804373:	ff d0                	call   *%rax
+  804375:	83 f8 02             	cmp    $0x2,%eax
+  804378:	0f 85 ab 00 00 00    	jne    804429 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80437e:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804385:	00 00 
+  804387:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80438b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80438d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804391:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804398:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80439c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80439e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043a2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8043a9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043ad:	48 bb 37 30 80 00 00 	movabs $0x803037,%rbx
+  8043b4:	00 00 00 
+  8043b7:	ff d3                	call   *%rbx
+  8043b9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8043bd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043c1:	ff d3                	call   *%rbx
+  8043c3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8043c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043cd:	eb 4d                	jmp    80441c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8043cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d4:	4c 89 ee             	mov    %r13,%rsi
+  8043d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043dc:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  8043e3:	00 00 00 
+  8043e6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8043e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043ed:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8043f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043f6:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  8043fd:	00 00 00 
+  804400:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804402:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804407:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80440b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804410:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  804417:	00 00 00 
+  80441a:	ff d0                	call   *%rax
+}
+  80441c:	89 d8                	mov    %ebx,%eax
+  80441e:	48 83 c4 18          	add    $0x18,%rsp
+  804422:	5b                   	pop    %rbx
+  804423:	41 5c                	pop    %r12
+  804425:	41 5d                	pop    %r13
+  804427:	5d                   	pop    %rbp
+  804428:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804429:	48 b9 88 65 80 00 00 	movabs $0x806588,%rcx
+  804430:	00 00 00 
+  804433:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  80443a:	00 00 00 
+  80443d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804442:	48 bf 77 65 80 00 00 	movabs $0x806577,%rdi
+  804449:	00 00 00 
+  80444c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804451:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  804458:	00 00 00 
+  80445b:	41 ff d0             	call   *%r8
+
+000000000080445e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80445e:	55                   	push   %rbp
+  80445f:	48 89 e5             	mov    %rsp,%rbp
+  804462:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804466:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80446a:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  804471:	00 00 00 
+  804474:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804476:	85 c0                	test   %eax,%eax
+  804478:	78 35                	js     8044af <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80447a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80447e:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  804485:	00 00 00 
+  804488:	ff d0                	call   *%rax
+  80448a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80448d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804492:	be 00 10 00 00       	mov    $0x1000,%esi
+  804497:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80449b:	48 b8 2d 28 80 00 00 	movabs $0x80282d,%rax
+  8044a2:	00 00 00 
+  8044a5:	ff d0                	call   *%rax
+  8044a7:	85 c0                	test   %eax,%eax
+  8044a9:	0f 94 c0             	sete   %al
+  8044ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8044af:	c9                   	leave
+  8044b0:	c3                   	ret
+
+00000000008044b1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8044b1:	48 89 f8             	mov    %rdi,%rax
+  8044b4:	48 c1 e8 27          	shr    $0x27,%rax
+  8044b8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8044bf:	01 00 00 
+  8044c2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044c6:	f6 c2 01             	test   $0x1,%dl
+  8044c9:	74 6d                	je     804538 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044cb:	48 89 f8             	mov    %rdi,%rax
+  8044ce:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8044d2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044d9:	01 00 00 
+  8044dc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044e0:	f6 c2 01             	test   $0x1,%dl
+  8044e3:	74 62                	je     804547 <get_uvpt_entry+0x96>
+  8044e5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044ec:	01 00 00 
+  8044ef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044f3:	f6 c2 80             	test   $0x80,%dl
+  8044f6:	75 4f                	jne    804547 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044f8:	48 89 f8             	mov    %rdi,%rax
+  8044fb:	48 c1 e8 15          	shr    $0x15,%rax
+  8044ff:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804506:	01 00 00 
+  804509:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80450d:	f6 c2 01             	test   $0x1,%dl
+  804510:	74 44                	je     804556 <get_uvpt_entry+0xa5>
+  804512:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804519:	01 00 00 
+  80451c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804520:	f6 c2 80             	test   $0x80,%dl
+  804523:	75 31                	jne    804556 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804525:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804529:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804530:	01 00 00 
+  804533:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804537:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804538:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80453f:	01 00 00 
+  804542:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804546:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804547:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80454e:	01 00 00 
+  804551:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804555:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804556:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80455d:	01 00 00 
+  804560:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804564:	c3                   	ret
+
+0000000000804565 <get_prot>:
+
+int
+get_prot(void *va) {
+  804565:	55                   	push   %rbp
+  804566:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804569:	48 b8 b1 44 80 00 00 	movabs $0x8044b1,%rax
+  804570:	00 00 00 
+  804573:	ff d0                	call   *%rax
+  804575:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804578:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80457d:	89 c1                	mov    %eax,%ecx
+  80457f:	83 c9 04             	or     $0x4,%ecx
+  804582:	f6 c2 01             	test   $0x1,%dl
+  804585:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804588:	89 c1                	mov    %eax,%ecx
+  80458a:	83 c9 02             	or     $0x2,%ecx
+  80458d:	f6 c2 02             	test   $0x2,%dl
+  804590:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804593:	89 c1                	mov    %eax,%ecx
+  804595:	83 c9 01             	or     $0x1,%ecx
+  804598:	48 85 d2             	test   %rdx,%rdx
+  80459b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80459e:	89 c1                	mov    %eax,%ecx
+  8045a0:	83 c9 40             	or     $0x40,%ecx
+  8045a3:	f6 c6 04             	test   $0x4,%dh
+  8045a6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8045a9:	5d                   	pop    %rbp
+  8045aa:	c3                   	ret
+
+00000000008045ab <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8045ab:	55                   	push   %rbp
+  8045ac:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8045af:	48 b8 b1 44 80 00 00 	movabs $0x8044b1,%rax
+  8045b6:	00 00 00 
+  8045b9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8045bb:	48 c1 e8 06          	shr    $0x6,%rax
+  8045bf:	83 e0 01             	and    $0x1,%eax
+}
+  8045c2:	5d                   	pop    %rbp
+  8045c3:	c3                   	ret
+
+00000000008045c4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8045c4:	55                   	push   %rbp
+  8045c5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8045c8:	48 b8 b1 44 80 00 00 	movabs $0x8044b1,%rax
+  8045cf:	00 00 00 
+  8045d2:	ff d0                	call   *%rax
+  8045d4:	83 e0 01             	and    $0x1,%eax
+}
+  8045d7:	5d                   	pop    %rbp
+  8045d8:	c3                   	ret
+
+00000000008045d9 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8045d9:	55                   	push   %rbp
+  8045da:	48 89 e5             	mov    %rsp,%rbp
+  8045dd:	41 57                	push   %r15
+  8045df:	41 56                	push   %r14
+  8045e1:	41 55                	push   %r13
+  8045e3:	41 54                	push   %r12
+  8045e5:	53                   	push   %rbx
+  8045e6:	48 83 ec 28          	sub    $0x28,%rsp
+  8045ea:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8045ee:	48 85 ff             	test   %rdi,%rdi
+  8045f1:	74 1e                	je     804611 <foreach_shared_region+0x38>
+  8045f3:	49 89 ff             	mov    %rdi,%r15
+  8045f6:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8045fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804602:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804609:	01 00 00 
+  80460c:	e9 72 02 00 00       	jmp    804883 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804611:	48 b9 ac 65 80 00 00 	movabs $0x8065ac,%rcx
+  804618:	00 00 00 
+  80461b:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  804622:	00 00 00 
+  804625:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80462a:	48 bf b0 65 80 00 00 	movabs $0x8065b0,%rdi
+  804631:	00 00 00 
+  804634:	b8 00 00 00 00       	mov    $0x0,%eax
+  804639:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  804640:	00 00 00 
+  804643:	41 ff d0             	call   *%r8
+  804646:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80464d:	eb 6c                	jmp    8046bb <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80464f:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804656:	ff ff ff 
+  804659:	4c 21 e2             	and    %r12,%rdx
+  80465c:	48 89 d8             	mov    %rbx,%rax
+  80465f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804664:	48 83 c0 01          	add    $0x1,%rax
+  804668:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80466c:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804673:	00 00 00 
+  804676:	48 21 c8             	and    %rcx,%rax
+  804679:	48 09 d0             	or     %rdx,%rax
+  80467c:	49 89 c4             	mov    %rax,%r12
+  80467f:	eb 30                	jmp    8046b1 <foreach_shared_region+0xd8>
+  804681:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804688:	ff ff ff 
+  80468b:	4c 21 e2             	and    %r12,%rdx
+  80468e:	48 89 d8             	mov    %rbx,%rax
+  804691:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804696:	48 83 c0 01          	add    $0x1,%rax
+  80469a:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80469e:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8046a5:	00 00 00 
+  8046a8:	48 21 c8             	and    %rcx,%rax
+  8046ab:	48 09 d0             	or     %rdx,%rax
+  8046ae:	49 89 c4             	mov    %rax,%r12
+  8046b1:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8046b5:	0f 84 99 01 00 00    	je     804854 <foreach_shared_region+0x27b>
+  8046bb:	4c 89 e3             	mov    %r12,%rbx
+  8046be:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8046c2:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8046c9:	01 00 00 
+  8046cc:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8046d0:	a8 01                	test   $0x1,%al
+  8046d2:	0f 84 77 ff ff ff    	je     80464f <foreach_shared_region+0x76>
+  8046d8:	a8 80                	test   $0x80,%al
+  8046da:	74 19                	je     8046f5 <foreach_shared_region+0x11c>
+  8046dc:	f6 c4 04             	test   $0x4,%ah
+  8046df:	74 a0                	je     804681 <foreach_shared_region+0xa8>
+  8046e1:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8046e8:	40 
+  8046e9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046ed:	4c 89 e7             	mov    %r12,%rdi
+  8046f0:	41 ff d7             	call   *%r15
+  8046f3:	eb 8c                	jmp    804681 <foreach_shared_region+0xa8>
+  8046f5:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8046fc:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804700:	eb 46                	jmp    804748 <foreach_shared_region+0x16f>
+  804702:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804709:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80470f:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804713:	48 c1 e0 15          	shl    $0x15,%rax
+  804717:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80471c:	49 09 c4             	or     %rax,%r12
+  80471f:	eb 1d                	jmp    80473e <foreach_shared_region+0x165>
+  804721:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804728:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80472e:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804732:	48 c1 e0 15          	shl    $0x15,%rax
+  804736:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80473b:	49 09 c4             	or     %rax,%r12
+  80473e:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804742:	0f 84 d3 00 00 00    	je     80481b <foreach_shared_region+0x242>
+  804748:	4c 89 e3             	mov    %r12,%rbx
+  80474b:	48 c1 eb 15          	shr    $0x15,%rbx
+  80474f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804756:	01 00 00 
+  804759:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80475d:	a8 01                	test   $0x1,%al
+  80475f:	74 a1                	je     804702 <foreach_shared_region+0x129>
+  804761:	a8 80                	test   $0x80,%al
+  804763:	74 19                	je     80477e <foreach_shared_region+0x1a5>
+  804765:	f6 c4 04             	test   $0x4,%ah
+  804768:	74 b7                	je     804721 <foreach_shared_region+0x148>
+  80476a:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804771:	00 
+  804772:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804776:	4c 89 e7             	mov    %r12,%rdi
+  804779:	41 ff d7             	call   *%r15
+  80477c:	eb a3                	jmp    804721 <foreach_shared_region+0x148>
+  80477e:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804784:	eb 3b                	jmp    8047c1 <foreach_shared_region+0x1e8>
+  804786:	f6 c4 04             	test   $0x4,%ah
+  804789:	74 12                	je     80479d <foreach_shared_region+0x1c4>
+  80478b:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804792:	00 
+  804793:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804797:	4c 89 e7             	mov    %r12,%rdi
+  80479a:	41 ff d7             	call   *%r15
+  80479d:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8047a4:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047aa:	48 83 c3 01          	add    $0x1,%rbx
+  8047ae:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8047b2:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8047b8:	49 09 dc             	or     %rbx,%r12
+  8047bb:	41 83 ed 01          	sub    $0x1,%r13d
+  8047bf:	74 2f                	je     8047f0 <foreach_shared_region+0x217>
+  8047c1:	4c 89 e3             	mov    %r12,%rbx
+  8047c4:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8047c8:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8047cc:	a8 01                	test   $0x1,%al
+  8047ce:	75 b6                	jne    804786 <foreach_shared_region+0x1ad>
+  8047d0:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8047d7:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047dd:	48 83 c3 01          	add    $0x1,%rbx
+  8047e1:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8047e5:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8047eb:	49 09 dc             	or     %rbx,%r12
+  8047ee:	eb cb                	jmp    8047bb <foreach_shared_region+0x1e2>
+  8047f0:	4c 89 e0             	mov    %r12,%rax
+  8047f3:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8047f9:	49 c1 ec 15          	shr    $0x15,%r12
+  8047fd:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804804:	49 83 c4 01          	add    $0x1,%r12
+  804808:	49 c1 e4 15          	shl    $0x15,%r12
+  80480c:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804813:	49 09 c4             	or     %rax,%r12
+  804816:	e9 23 ff ff ff       	jmp    80473e <foreach_shared_region+0x165>
+  80481b:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80481f:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804826:	ff ff ff 
+  804829:	4c 21 e0             	and    %r12,%rax
+  80482c:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804830:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804837:	49 83 c4 01          	add    $0x1,%r12
+  80483b:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80483f:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804846:	00 00 00 
+  804849:	49 21 d4             	and    %rdx,%r12
+  80484c:	49 09 c4             	or     %rax,%r12
+  80484f:	e9 5d fe ff ff       	jmp    8046b1 <foreach_shared_region+0xd8>
+  804854:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80485b:	00 ff ff 
+  80485e:	4c 21 e0             	and    %r12,%rax
+  804861:	49 c1 ec 27          	shr    $0x27,%r12
+  804865:	49 83 c4 01          	add    $0x1,%r12
+  804869:	49 c1 e4 27          	shl    $0x27,%r12
+  80486d:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804874:	ff 00 00 
+  804877:	49 21 d4             	and    %rdx,%r12
+  80487a:	49 09 c4             	or     %rax,%r12
+  80487d:	41 83 ed 01          	sub    $0x1,%r13d
+  804881:	74 48                	je     8048cb <foreach_shared_region+0x2f2>
+  804883:	4c 89 e0             	mov    %r12,%rax
+  804886:	48 c1 e8 27          	shr    $0x27,%rax
+  80488a:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804891:	01 00 00 
+  804894:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804898:	f6 c2 01             	test   $0x1,%dl
+  80489b:	0f 85 a5 fd ff ff    	jne    804646 <foreach_shared_region+0x6d>
+  8048a1:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8048a8:	00 ff ff 
+  8048ab:	4c 21 e2             	and    %r12,%rdx
+  8048ae:	48 83 c0 01          	add    $0x1,%rax
+  8048b2:	48 c1 e0 27          	shl    $0x27,%rax
+  8048b6:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8048bd:	ff 00 00 
+  8048c0:	48 21 c8             	and    %rcx,%rax
+  8048c3:	48 09 d0             	or     %rdx,%rax
+  8048c6:	49 89 c4             	mov    %rax,%r12
+  8048c9:	eb b2                	jmp    80487d <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8048cb:	4d 85 e4             	test   %r12,%r12
+  8048ce:	75 14                	jne    8048e4 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8048d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048d5:	48 83 c4 28          	add    $0x28,%rsp
+  8048d9:	5b                   	pop    %rbx
+  8048da:	41 5c                	pop    %r12
+  8048dc:	41 5d                	pop    %r13
+  8048de:	41 5e                	pop    %r14
+  8048e0:	41 5f                	pop    %r15
+  8048e2:	5d                   	pop    %rbp
+  8048e3:	c3                   	ret
+    assert(addr == 0);
+  8048e4:	48 b9 bb 65 80 00 00 	movabs $0x8065bb,%rcx
+  8048eb:	00 00 00 
+  8048ee:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  8048f5:	00 00 00 
+  8048f8:	be 67 00 00 00       	mov    $0x67,%esi
+  8048fd:	48 bf b0 65 80 00 00 	movabs $0x8065b0,%rdi
+  804904:	00 00 00 
+  804907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80490c:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  804913:	00 00 00 
+  804916:	41 ff d0             	call   *%r8
+
+0000000000804919 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804919:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804920:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804923:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804929:	eb 33                	jmp    80495e <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80492b:	48 83 c0 20          	add    $0x20,%rax
+  80492f:	4c 39 c0             	cmp    %r8,%rax
+  804932:	74 25                	je     804959 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804934:	48 8b 10             	mov    (%rax),%rdx
+  804937:	48 85 d2             	test   %rdx,%rdx
+  80493a:	74 ef                	je     80492b <mmap_place+0x12>
+  80493c:	48 89 d1             	mov    %rdx,%rcx
+  80493f:	48 03 48 08          	add    0x8(%rax),%rcx
+  804943:	48 39 cf             	cmp    %rcx,%rdi
+  804946:	73 e3                	jae    80492b <mmap_place+0x12>
+  804948:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80494c:	4c 39 ca             	cmp    %r9,%rdx
+  80494f:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804953:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804957:	eb d2                	jmp    80492b <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804959:	45 84 d2             	test   %r10b,%r10b
+  80495c:	74 12                	je     804970 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80495e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804965:	00 00 00 
+        moved = 0;
+  804968:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  80496e:	eb c4                	jmp    804934 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804970:	48 01 fe             	add    %rdi,%rsi
+  804973:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  80497a:	00 00 00 
+  80497d:	48 39 f0             	cmp    %rsi,%rax
+  804980:	b8 00 00 00 00       	mov    $0x0,%eax
+  804985:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804989:	c3                   	ret
+
+000000000080498a <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  80498a:	55                   	push   %rbp
+  80498b:	48 89 e5             	mov    %rsp,%rbp
+  80498e:	41 57                	push   %r15
+  804990:	41 56                	push   %r14
+  804992:	41 55                	push   %r13
+  804994:	41 54                	push   %r12
+  804996:	53                   	push   %rbx
+  804997:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80499b:	48 8b 1f             	mov    (%rdi),%rbx
+  80499e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8049a5:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8049ac:	00 00 00 
+  8049af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049b4:	eb 12                	jmp    8049c8 <mmap_pgfault+0x3e>
+  8049b6:	48 83 c2 01          	add    $0x1,%rdx
+  8049ba:	48 83 c0 20          	add    $0x20,%rax
+  8049be:	48 83 fa 20          	cmp    $0x20,%rdx
+  8049c2:	0f 84 04 01 00 00    	je     804acc <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8049c8:	48 8b 08             	mov    (%rax),%rcx
+  8049cb:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8049cf:	48 39 de             	cmp    %rbx,%rsi
+  8049d2:	73 e2                	jae    8049b6 <mmap_pgfault+0x2c>
+  8049d4:	48 03 48 08          	add    0x8(%rax),%rcx
+  8049d8:	48 39 cb             	cmp    %rcx,%rbx
+  8049db:	73 d9                	jae    8049b6 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8049dd:	48 c1 e2 05          	shl    $0x5,%rdx
+  8049e1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8049e8:	00 00 00 
+  8049eb:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8049ef:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8049f3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8049f7:	f6 c2 01             	test   $0x1,%dl
+  8049fa:	0f 84 e0 00 00 00    	je     804ae0 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804a00:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a05:	f6 c2 02             	test   $0x2,%dl
+  804a08:	0f 84 c3 00 00 00    	je     804ad1 <mmap_pgfault+0x147>
+  804a0e:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804a15:	ff ff ff 
+  804a18:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804a1c:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804a23:	00 00 00 
+  804a26:	48 39 ca             	cmp    %rcx,%rdx
+  804a29:	0f 85 a2 00 00 00    	jne    804ad1 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804a2f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804a34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a39:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804a40:	00 00 00 
+  804a43:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a48:	48 b8 5f 28 80 00 00 	movabs $0x80285f,%rax
+  804a4f:	00 00 00 
+  804a52:	ff d0                	call   *%rax
+  804a54:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a5b:	85 d2                	test   %edx,%edx
+  804a5d:	78 72                	js     804ad1 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804a5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a64:	48 89 de             	mov    %rbx,%rsi
+  804a67:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804a6e:	00 00 00 
+  804a71:	4c 89 e7             	mov    %r12,%rdi
+  804a74:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  804a7b:	00 00 00 
+  804a7e:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804a80:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804a86:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a8c:	48 89 d9             	mov    %rbx,%rcx
+  804a8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a94:	4c 89 e6             	mov    %r12,%rsi
+  804a97:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a9c:	48 b8 cc 28 80 00 00 	movabs $0x8028cc,%rax
+  804aa3:	00 00 00 
+  804aa6:	ff d0                	call   *%rax
+  804aa8:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804aaa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804aaf:	4c 89 e6             	mov    %r12,%rsi
+  804ab2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ab7:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  804abe:	00 00 00 
+  804ac1:	ff d0                	call   *%rax
+    return res >= 0;
+  804ac3:	89 d8                	mov    %ebx,%eax
+  804ac5:	f7 d0                	not    %eax
+  804ac7:	c1 e8 1f             	shr    $0x1f,%eax
+  804aca:	eb 05                	jmp    804ad1 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804acc:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804ad1:	48 83 c4 18          	add    $0x18,%rsp
+  804ad5:	5b                   	pop    %rbx
+  804ad6:	41 5c                	pop    %r12
+  804ad8:	41 5d                	pop    %r13
+  804ada:	41 5e                	pop    %r14
+  804adc:	41 5f                	pop    %r15
+  804ade:	5d                   	pop    %rbp
+  804adf:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804ae0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ae4:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804ae8:	4c 03 30             	add    (%rax),%r14
+  804aeb:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804af2:	49 39 c6             	cmp    %rax,%r14
+  804af5:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804af9:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804b00:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804b06:	49 bf c4 45 80 00 00 	movabs $0x8045c4,%r15
+  804b0d:	00 00 00 
+  804b10:	4d 39 f4             	cmp    %r14,%r12
+  804b13:	73 1d                	jae    804b32 <mmap_pgfault+0x1a8>
+  804b15:	4c 89 e7             	mov    %r12,%rdi
+  804b18:	41 ff d7             	call   *%r15
+  804b1b:	84 c0                	test   %al,%al
+  804b1d:	75 13                	jne    804b32 <mmap_pgfault+0x1a8>
+  804b1f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804b26:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804b2d:	4d 39 f4             	cmp    %r14,%r12
+  804b30:	72 e3                	jb     804b15 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804b32:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804b38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b3c:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804b40:	74 2a                	je     804b6c <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804b42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b46:	89 de                	mov    %ebx,%esi
+  804b48:	2b 30                	sub    (%rax),%esi
+  804b4a:	03 70 1c             	add    0x1c(%rax),%esi
+  804b4d:	8b 78 18             	mov    0x18(%rax),%edi
+  804b50:	4c 89 e9             	mov    %r13,%rcx
+  804b53:	48 89 da             	mov    %rbx,%rdx
+  804b56:	48 b8 22 3d 80 00 00 	movabs $0x803d22,%rax
+  804b5d:	00 00 00 
+  804b60:	ff d0                	call   *%rax
+    return res > 0;
+  804b62:	85 c0                	test   %eax,%eax
+  804b64:	0f 9f c0             	setg   %al
+  804b67:	e9 65 ff ff ff       	jmp    804ad1 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804b6c:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804b70:	eb d0                	jmp    804b42 <mmap_pgfault+0x1b8>
+
+0000000000804b72 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804b72:	55                   	push   %rbp
+  804b73:	48 89 e5             	mov    %rsp,%rbp
+  804b76:	41 57                	push   %r15
+  804b78:	41 56                	push   %r14
+  804b7a:	41 55                	push   %r13
+  804b7c:	41 54                	push   %r12
+  804b7e:	53                   	push   %rbx
+  804b7f:	48 83 ec 28          	sub    $0x28,%rsp
+  804b83:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804b87:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804b8a:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804b91:	ff ff ff 
+  804b94:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b9d:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804ba4:	00 00 00 
+  804ba7:	48 39 ca             	cmp    %rcx,%rdx
+  804baa:	0f 85 e5 00 00 00    	jne    804c95 <mmap_writeback+0x123>
+  804bb0:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804bb3:	4c 39 ee             	cmp    %r13,%rsi
+  804bb6:	0f 83 e8 00 00 00    	jae    804ca4 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804bbc:	49 be c4 45 80 00 00 	movabs $0x8045c4,%r14
+  804bc3:	00 00 00 
+  804bc6:	49 bf ab 45 80 00 00 	movabs $0x8045ab,%r15
+  804bcd:	00 00 00 
+  804bd0:	eb 10                	jmp    804be2 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804bd2:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804bd9:	4d 39 ec             	cmp    %r13,%r12
+  804bdc:	0f 83 ae 00 00 00    	jae    804c90 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804be2:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804be6:	4c 89 e7             	mov    %r12,%rdi
+  804be9:	41 ff d6             	call   *%r14
+  804bec:	84 c0                	test   %al,%al
+  804bee:	74 e2                	je     804bd2 <mmap_writeback+0x60>
+  804bf0:	4c 89 e7             	mov    %r12,%rdi
+  804bf3:	41 ff d7             	call   *%r15
+  804bf6:	84 c0                	test   %al,%al
+  804bf8:	74 d8                	je     804bd2 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804bfa:	4c 89 e3             	mov    %r12,%rbx
+  804bfd:	4d 39 ec             	cmp    %r13,%r12
+  804c00:	73 20                	jae    804c22 <mmap_writeback+0xb0>
+  804c02:	48 89 df             	mov    %rbx,%rdi
+  804c05:	41 ff d6             	call   *%r14
+  804c08:	84 c0                	test   %al,%al
+  804c0a:	74 16                	je     804c22 <mmap_writeback+0xb0>
+  804c0c:	48 89 df             	mov    %rbx,%rdi
+  804c0f:	41 ff d7             	call   *%r15
+  804c12:	84 c0                	test   %al,%al
+  804c14:	74 0c                	je     804c22 <mmap_writeback+0xb0>
+  804c16:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804c1d:	4c 39 eb             	cmp    %r13,%rbx
+  804c20:	72 e0                	jb     804c02 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804c22:	48 89 d9             	mov    %rbx,%rcx
+  804c25:	4c 29 e1             	sub    %r12,%rcx
+  804c28:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c2c:	44 89 e6             	mov    %r12d,%esi
+  804c2f:	2b 30                	sub    (%rax),%esi
+  804c31:	49 89 c4             	mov    %rax,%r12
+  804c34:	03 70 1c             	add    0x1c(%rax),%esi
+  804c37:	8b 78 18             	mov    0x18(%rax),%edi
+  804c3a:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804c3e:	48 89 ca             	mov    %rcx,%rdx
+  804c41:	48 b8 ab 3d 80 00 00 	movabs $0x803dab,%rax
+  804c48:	00 00 00 
+  804c4b:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804c4d:	85 c0                	test   %eax,%eax
+  804c4f:	78 44                	js     804c95 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804c51:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804c56:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804c59:	41 89 c1             	mov    %eax,%r9d
+  804c5c:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804c63:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804c67:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804c6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c70:	48 89 ce             	mov    %rcx,%rsi
+  804c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c78:	48 b8 cc 28 80 00 00 	movabs $0x8028cc,%rax
+  804c7f:	00 00 00 
+  804c82:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804c84:	85 c0                	test   %eax,%eax
+  804c86:	78 0d                	js     804c95 <mmap_writeback+0x123>
+  804c88:	49 89 dc             	mov    %rbx,%r12
+  804c8b:	e9 49 ff ff ff       	jmp    804bd9 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804c90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c95:	48 83 c4 28          	add    $0x28,%rsp
+  804c99:	5b                   	pop    %rbx
+  804c9a:	41 5c                	pop    %r12
+  804c9c:	41 5d                	pop    %r13
+  804c9e:	41 5e                	pop    %r14
+  804ca0:	41 5f                	pop    %r15
+  804ca2:	5d                   	pop    %rbp
+  804ca3:	c3                   	ret
+    return 0;
+  804ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ca9:	eb ea                	jmp    804c95 <mmap_writeback+0x123>
+
+0000000000804cab <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804cab:	55                   	push   %rbp
+  804cac:	48 89 e5             	mov    %rsp,%rbp
+  804caf:	41 57                	push   %r15
+  804cb1:	41 56                	push   %r14
+  804cb3:	41 55                	push   %r13
+  804cb5:	41 54                	push   %r12
+  804cb7:	53                   	push   %rbx
+  804cb8:	48 83 ec 38          	sub    $0x38,%rsp
+  804cbc:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804cc0:	48 85 f6             	test   %rsi,%rsi
+  804cc3:	0f 84 0c 02 00 00    	je     804ed5 <mmap+0x22a>
+  804cc9:	49 89 ff             	mov    %rdi,%r15
+  804ccc:	49 89 f4             	mov    %rsi,%r12
+  804ccf:	41 89 d5             	mov    %edx,%r13d
+  804cd2:	41 89 ce             	mov    %ecx,%r14d
+  804cd5:	44 89 cb             	mov    %r9d,%ebx
+  804cd8:	45 85 c9             	test   %r9d,%r9d
+  804cdb:	0f 88 f4 01 00 00    	js     804ed5 <mmap+0x22a>
+  804ce1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ce8:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804cef:	0f 85 e7 01 00 00    	jne    804edc <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804cf5:	83 e2 fd             	and    $0xfffffffd,%edx
+  804cf8:	83 fa 04             	cmp    $0x4,%edx
+  804cfb:	0f 85 db 01 00 00    	jne    804edc <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804d01:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804d04:	83 fa 01             	cmp    $0x1,%edx
+  804d07:	0f 87 cf 01 00 00    	ja     804edc <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804d0d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804d11:	44 89 c7             	mov    %r8d,%edi
+  804d14:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  804d1b:	00 00 00 
+  804d1e:	ff d0                	call   *%rax
+  804d20:	89 c2                	mov    %eax,%edx
+  804d22:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d29:	85 d2                	test   %edx,%edx
+  804d2b:	0f 88 ab 01 00 00    	js     804edc <mmap+0x231>
+  804d31:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d35:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804d3c:	00 00 00 
+  804d3f:	8b 09                	mov    (%rcx),%ecx
+  804d41:	39 0a                	cmp    %ecx,(%rdx)
+  804d43:	0f 85 93 01 00 00    	jne    804edc <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804d49:	8b 52 08             	mov    0x8(%rdx),%edx
+  804d4c:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804d4f:	83 fa 01             	cmp    $0x1,%edx
+  804d52:	0f 84 84 01 00 00    	je     804edc <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d58:	41 83 fe 01          	cmp    $0x1,%r14d
+  804d5c:	74 42                	je     804da0 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804d5e:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804d65:	4c 89 e6             	mov    %r12,%rsi
+  804d68:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804d6f:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804d73:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804d77:	4d 85 ff             	test   %r15,%r15
+  804d7a:	74 67                	je     804de3 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d7c:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804d83:	75 0f                	jne    804d94 <mmap+0xe9>
+  804d85:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804d8c:	00 00 00 
+  804d8f:	49 39 c7             	cmp    %rax,%r15
+  804d92:	77 1b                	ja     804daf <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d94:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d9b:	e9 3c 01 00 00       	jmp    804edc <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804da0:	41 f6 c5 02          	test   $0x2,%r13b
+  804da4:	74 b8                	je     804d5e <mmap+0xb3>
+  804da6:	85 d2                	test   %edx,%edx
+  804da8:	75 b4                	jne    804d5e <mmap+0xb3>
+  804daa:	e9 2d 01 00 00       	jmp    804edc <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804daf:	4c 89 ff             	mov    %r15,%rdi
+  804db2:	48 b8 19 49 80 00 00 	movabs $0x804919,%rax
+  804db9:	00 00 00 
+  804dbc:	ff d0                	call   *%rax
+  804dbe:	48 89 c2             	mov    %rax,%rdx
+  804dc1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804dc8:	49 39 d7             	cmp    %rdx,%r15
+  804dcb:	0f 85 0b 01 00 00    	jne    804edc <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804dd1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804dd8:	00 00 00 
+  804ddb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804de1:	eb 44                	jmp    804e27 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804de3:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804de7:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804dee:	00 00 00 
+  804df1:	48 b8 19 49 80 00 00 	movabs $0x804919,%rax
+  804df8:	00 00 00 
+  804dfb:	ff d0                	call   *%rax
+  804dfd:	48 89 c7             	mov    %rax,%rdi
+  804e00:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804e04:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804e0b:	48 85 ff             	test   %rdi,%rdi
+  804e0e:	75 c1                	jne    804dd1 <mmap+0x126>
+  804e10:	e9 c7 00 00 00       	jmp    804edc <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804e15:	49 83 c4 01          	add    $0x1,%r12
+  804e19:	48 83 c0 20          	add    $0x20,%rax
+  804e1d:	49 83 fc 20          	cmp    $0x20,%r12
+  804e21:	0f 84 a5 00 00 00    	je     804ecc <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e27:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804e2b:	75 e8                	jne    804e15 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804e2d:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804e31:	48 b8 65 30 80 00 00 	movabs $0x803065,%rax
+  804e38:	00 00 00 
+  804e3b:	ff d0                	call   *%rax
+  804e3d:	89 c2                	mov    %eax,%edx
+  804e3f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e46:	85 d2                	test   %edx,%edx
+  804e48:	0f 88 8e 00 00 00    	js     804edc <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804e4e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804e52:	48 b8 37 30 80 00 00 	movabs $0x803037,%rax
+  804e59:	00 00 00 
+  804e5c:	ff d0                	call   *%rax
+  804e5e:	89 c6                	mov    %eax,%esi
+  804e60:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804e63:	48 b8 85 32 80 00 00 	movabs $0x803285,%rax
+  804e6a:	00 00 00 
+  804e6d:	ff d0                	call   *%rax
+  804e6f:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804e72:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e79:	45 85 ff             	test   %r15d,%r15d
+  804e7c:	78 5e                	js     804edc <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e7e:	49 c1 e4 05          	shl    $0x5,%r12
+  804e82:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e89:	00 00 00 
+  804e8c:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804e8f:	48 bf 8a 49 80 00 00 	movabs $0x80498a,%rdi
+  804e96:	00 00 00 
+  804e99:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  804ea0:	00 00 00 
+  804ea3:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804ea5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804ea9:	49 89 04 24          	mov    %rax,(%r12)
+  804ead:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804eb1:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804eb6:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804ebb:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804ec0:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804ec5:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804eca:	eb 10                	jmp    804edc <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804ecc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ed3:	eb 07                	jmp    804edc <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804ed5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804edc:	48 83 c4 38          	add    $0x38,%rsp
+  804ee0:	5b                   	pop    %rbx
+  804ee1:	41 5c                	pop    %r12
+  804ee3:	41 5d                	pop    %r13
+  804ee5:	41 5e                	pop    %r14
+  804ee7:	41 5f                	pop    %r15
+  804ee9:	5d                   	pop    %rbp
+  804eea:	c3                   	ret
+
+0000000000804eeb <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804eeb:	55                   	push   %rbp
+  804eec:	48 89 e5             	mov    %rsp,%rbp
+  804eef:	41 57                	push   %r15
+  804ef1:	41 56                	push   %r14
+  804ef3:	41 55                	push   %r13
+  804ef5:	41 54                	push   %r12
+  804ef7:	53                   	push   %rbx
+  804ef8:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804efc:	49 89 fe             	mov    %rdi,%r14
+  804eff:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f06:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f0d:	00 
+  804f0e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f15:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804f1c:	00 00 00 
+  804f1f:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804f26:	49 bf 72 4b 80 00 00 	movabs $0x804b72,%r15
+  804f2d:	00 00 00 
+  804f30:	eb 09                	jmp    804f3b <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f32:	48 83 c3 20          	add    $0x20,%rbx
+  804f36:	4c 39 eb             	cmp    %r13,%rbx
+  804f39:	74 33                	je     804f6e <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f3b:	48 89 df             	mov    %rbx,%rdi
+  804f3e:	48 8b 33             	mov    (%rbx),%rsi
+  804f41:	4c 39 e6             	cmp    %r12,%rsi
+  804f44:	73 ec                	jae    804f32 <msync+0x47>
+  804f46:	48 85 f6             	test   %rsi,%rsi
+  804f49:	74 e7                	je     804f32 <msync+0x47>
+  804f4b:	48 89 f2             	mov    %rsi,%rdx
+  804f4e:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804f52:	49 39 d6             	cmp    %rdx,%r14
+  804f55:	73 db                	jae    804f32 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804f57:	4c 39 e2             	cmp    %r12,%rdx
+  804f5a:	49 0f 47 d4          	cmova  %r12,%rdx
+  804f5e:	4c 39 f6             	cmp    %r14,%rsi
+  804f61:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804f65:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804f68:	85 c0                	test   %eax,%eax
+  804f6a:	79 c6                	jns    804f32 <msync+0x47>
+  804f6c:	eb 05                	jmp    804f73 <msync+0x88>
+    }
+
+    return 0;
+  804f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f73:	48 83 c4 08          	add    $0x8,%rsp
+  804f77:	5b                   	pop    %rbx
+  804f78:	41 5c                	pop    %r12
+  804f7a:	41 5d                	pop    %r13
+  804f7c:	41 5e                	pop    %r14
+  804f7e:	41 5f                	pop    %r15
+  804f80:	5d                   	pop    %rbp
+  804f81:	c3                   	ret
+
+0000000000804f82 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804f82:	55                   	push   %rbp
+  804f83:	48 89 e5             	mov    %rsp,%rbp
+  804f86:	41 57                	push   %r15
+  804f88:	41 56                	push   %r14
+  804f8a:	41 55                	push   %r13
+  804f8c:	41 54                	push   %r12
+  804f8e:	53                   	push   %rbx
+  804f8f:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804f93:	49 89 ff             	mov    %rdi,%r15
+  804f96:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f9d:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804fa4:	00 
+  804fa5:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fac:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804fb3:	00 00 00 
+  804fb6:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804fbd:	48 89 d8             	mov    %rbx,%rax
+  804fc0:	eb 09                	jmp    804fcb <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fc2:	48 83 c0 20          	add    $0x20,%rax
+  804fc6:	4c 39 f0             	cmp    %r14,%rax
+  804fc9:	74 40                	je     80500b <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804fcb:	48 8b 10             	mov    (%rax),%rdx
+  804fce:	4c 39 e2             	cmp    %r12,%rdx
+  804fd1:	73 ef                	jae    804fc2 <munmap+0x40>
+  804fd3:	48 85 d2             	test   %rdx,%rdx
+  804fd6:	74 ea                	je     804fc2 <munmap+0x40>
+  804fd8:	48 89 d7             	mov    %rdx,%rdi
+  804fdb:	48 03 78 08          	add    0x8(%rax),%rdi
+  804fdf:	49 39 ff             	cmp    %rdi,%r15
+  804fe2:	73 de                	jae    804fc2 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804fe4:	49 39 fc             	cmp    %rdi,%r12
+  804fe7:	72 05                	jb     804fee <munmap+0x6c>
+  804fe9:	4c 39 fa             	cmp    %r15,%rdx
+  804fec:	73 d4                	jae    804fc2 <munmap+0x40>
+  804fee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804ff3:	48 83 c4 08          	add    $0x8,%rsp
+  804ff7:	5b                   	pop    %rbx
+  804ff8:	41 5c                	pop    %r12
+  804ffa:	41 5d                	pop    %r13
+  804ffc:	41 5e                	pop    %r14
+  804ffe:	41 5f                	pop    %r15
+  805000:	5d                   	pop    %rbp
+  805001:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805002:	48 83 c3 20          	add    $0x20,%rbx
+  805006:	4c 39 f3             	cmp    %r14,%rbx
+  805009:	74 5c                	je     805067 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80500b:	48 8b 33             	mov    (%rbx),%rsi
+  80500e:	4c 39 e6             	cmp    %r12,%rsi
+  805011:	73 ef                	jae    805002 <munmap+0x80>
+  805013:	48 85 f6             	test   %rsi,%rsi
+  805016:	74 ea                	je     805002 <munmap+0x80>
+  805018:	48 89 f2             	mov    %rsi,%rdx
+  80501b:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80501f:	49 39 d7             	cmp    %rdx,%r15
+  805022:	73 de                	jae    805002 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805024:	48 89 df             	mov    %rbx,%rdi
+  805027:	48 b8 72 4b 80 00 00 	movabs $0x804b72,%rax
+  80502e:	00 00 00 
+  805031:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805033:	85 c0                	test   %eax,%eax
+  805035:	78 bc                	js     804ff3 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805037:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80503b:	48 8b 33             	mov    (%rbx),%rsi
+  80503e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805043:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  80504a:	00 00 00 
+  80504d:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80504f:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805052:	48 b8 2a 32 80 00 00 	movabs $0x80322a,%rax
+  805059:	00 00 00 
+  80505c:	ff d0                	call   *%rax
+        reg->start = 0;
+  80505e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805065:	eb 9b                	jmp    805002 <munmap+0x80>
+    return 0;
+  805067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80506c:	eb 85                	jmp    804ff3 <munmap+0x71>
+
+000000000080506e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80506e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805073:	c3                   	ret
+
+0000000000805074 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805074:	55                   	push   %rbp
+  805075:	48 89 e5             	mov    %rsp,%rbp
+  805078:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80507b:	48 be c5 65 80 00 00 	movabs $0x8065c5,%rsi
+  805082:	00 00 00 
+  805085:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  80508c:	00 00 00 
+  80508f:	ff d0                	call   *%rax
+    return 0;
+}
+  805091:	b8 00 00 00 00       	mov    $0x0,%eax
+  805096:	5d                   	pop    %rbp
+  805097:	c3                   	ret
+
+0000000000805098 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805098:	55                   	push   %rbp
+  805099:	48 89 e5             	mov    %rsp,%rbp
+  80509c:	41 57                	push   %r15
+  80509e:	41 56                	push   %r14
+  8050a0:	41 55                	push   %r13
+  8050a2:	41 54                	push   %r12
+  8050a4:	53                   	push   %rbx
+  8050a5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8050ac:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8050b3:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8050ba:	00 00 00 00 
+  8050be:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8050c5:	00 00 00 00 
+  8050c9:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8050d0:	00 00 00 00 
+  8050d4:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8050db:	00 00 00 00 
+  8050df:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8050e6:	00 00 00 00 
+  8050ea:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8050f1:	00 00 00 00 
+  8050f5:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8050fc:	00 
+  8050fd:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805104:	00 
+  805105:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80510c:	00 
+  80510d:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805114:	00 
+  805115:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80511c:	00 
+  80511d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805124:	00 
+  805125:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80512c:	00 
+  80512d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805134:	00 
+  805135:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80513c:	00 
+  80513d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805144:	00 
+    for (res = 0; res < n; res += inc) {
+  805145:	48 85 d2             	test   %rdx,%rdx
+  805148:	74 7a                	je     8051c4 <devcons_write+0x12c>
+  80514a:	49 89 d6             	mov    %rdx,%r14
+  80514d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805153:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805158:	49 bf 4a 24 80 00 00 	movabs $0x80244a,%r15
+  80515f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805162:	4c 89 f3             	mov    %r14,%rbx
+  805165:	48 29 f3             	sub    %rsi,%rbx
+  805168:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80516d:	48 39 c3             	cmp    %rax,%rbx
+  805170:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805174:	4c 63 eb             	movslq %ebx,%r13
+  805177:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80517e:	48 01 c6             	add    %rax,%rsi
+  805181:	4c 89 ea             	mov    %r13,%rdx
+  805184:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80518b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80518e:	4c 89 ee             	mov    %r13,%rsi
+  805191:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805198:	48 b8 77 26 80 00 00 	movabs $0x802677,%rax
+  80519f:	00 00 00 
+  8051a2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8051a4:	41 01 dc             	add    %ebx,%r12d
+  8051a7:	49 63 f4             	movslq %r12d,%rsi
+  8051aa:	4c 39 f6             	cmp    %r14,%rsi
+  8051ad:	72 b3                	jb     805162 <devcons_write+0xca>
+    return res;
+  8051af:	49 63 c4             	movslq %r12d,%rax
+}
+  8051b2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8051b9:	5b                   	pop    %rbx
+  8051ba:	41 5c                	pop    %r12
+  8051bc:	41 5d                	pop    %r13
+  8051be:	41 5e                	pop    %r14
+  8051c0:	41 5f                	pop    %r15
+  8051c2:	5d                   	pop    %rbp
+  8051c3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8051c4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8051ca:	eb e3                	jmp    8051af <devcons_write+0x117>
+
+00000000008051cc <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8051cc:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8051cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051d4:	48 85 c0             	test   %rax,%rax
+  8051d7:	74 55                	je     80522e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8051d9:	55                   	push   %rbp
+  8051da:	48 89 e5             	mov    %rsp,%rbp
+  8051dd:	41 55                	push   %r13
+  8051df:	41 54                	push   %r12
+  8051e1:	53                   	push   %rbx
+  8051e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8051e6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8051e9:	48 bb aa 26 80 00 00 	movabs $0x8026aa,%rbx
+  8051f0:	00 00 00 
+  8051f3:	49 bc be 27 80 00 00 	movabs $0x8027be,%r12
+  8051fa:	00 00 00 
+  8051fd:	eb 03                	jmp    805202 <devcons_read+0x36>
+  8051ff:	41 ff d4             	call   *%r12
+  805202:	ff d3                	call   *%rbx
+  805204:	85 c0                	test   %eax,%eax
+  805206:	74 f7                	je     8051ff <devcons_read+0x33>
+    if (c < 0) return c;
+  805208:	48 63 d0             	movslq %eax,%rdx
+  80520b:	78 13                	js     805220 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80520d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805212:	83 f8 04             	cmp    $0x4,%eax
+  805215:	74 09                	je     805220 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805217:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80521b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805220:	48 89 d0             	mov    %rdx,%rax
+  805223:	48 83 c4 08          	add    $0x8,%rsp
+  805227:	5b                   	pop    %rbx
+  805228:	41 5c                	pop    %r12
+  80522a:	41 5d                	pop    %r13
+  80522c:	5d                   	pop    %rbp
+  80522d:	c3                   	ret
+  80522e:	48 89 d0             	mov    %rdx,%rax
+  805231:	c3                   	ret
+
+0000000000805232 <cputchar>:
+cputchar(int ch) {
+  805232:	55                   	push   %rbp
+  805233:	48 89 e5             	mov    %rsp,%rbp
+  805236:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80523a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80523e:	be 01 00 00 00       	mov    $0x1,%esi
+  805243:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805247:	48 b8 77 26 80 00 00 	movabs $0x802677,%rax
+  80524e:	00 00 00 
+  805251:	ff d0                	call   *%rax
+}
+  805253:	c9                   	leave
+  805254:	c3                   	ret
+
+0000000000805255 <getchar>:
+getchar(void) {
+  805255:	55                   	push   %rbp
+  805256:	48 89 e5             	mov    %rsp,%rbp
+  805259:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80525d:	ba 01 00 00 00       	mov    $0x1,%edx
+  805262:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805266:	bf 00 00 00 00       	mov    $0x0,%edi
+  80526b:	48 b8 a8 33 80 00 00 	movabs $0x8033a8,%rax
+  805272:	00 00 00 
+  805275:	ff d0                	call   *%rax
+  805277:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805279:	85 c0                	test   %eax,%eax
+  80527b:	78 06                	js     805283 <getchar+0x2e>
+  80527d:	74 08                	je     805287 <getchar+0x32>
+  80527f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805283:	89 d0                	mov    %edx,%eax
+  805285:	c9                   	leave
+  805286:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805287:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80528c:	eb f5                	jmp    805283 <getchar+0x2e>
+
+000000000080528e <iscons>:
+iscons(int fdnum) {
+  80528e:	55                   	push   %rbp
+  80528f:	48 89 e5             	mov    %rsp,%rbp
+  805292:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805296:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80529a:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8052a1:	00 00 00 
+  8052a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8052a6:	85 c0                	test   %eax,%eax
+  8052a8:	78 18                	js     8052c2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8052aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052ae:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8052b5:	00 00 00 
+  8052b8:	8b 00                	mov    (%rax),%eax
+  8052ba:	39 02                	cmp    %eax,(%rdx)
+  8052bc:	0f 94 c0             	sete   %al
+  8052bf:	0f b6 c0             	movzbl %al,%eax
+}
+  8052c2:	c9                   	leave
+  8052c3:	c3                   	ret
+
+00000000008052c4 <opencons>:
+opencons(void) {
+  8052c4:	55                   	push   %rbp
+  8052c5:	48 89 e5             	mov    %rsp,%rbp
+  8052c8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8052cc:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8052d0:	48 b8 65 30 80 00 00 	movabs $0x803065,%rax
+  8052d7:	00 00 00 
+  8052da:	ff d0                	call   *%rax
+  8052dc:	85 c0                	test   %eax,%eax
+  8052de:	78 49                	js     805329 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8052e0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8052e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052ea:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8052ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052f3:	48 b8 5f 28 80 00 00 	movabs $0x80285f,%rax
+  8052fa:	00 00 00 
+  8052fd:	ff d0                	call   *%rax
+  8052ff:	85 c0                	test   %eax,%eax
+  805301:	78 26                	js     805329 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805303:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805307:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80530e:	00 00 
+  805310:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805312:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805316:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80531d:	48 b8 37 30 80 00 00 	movabs $0x803037,%rax
+  805324:	00 00 00 
+  805327:	ff d0                	call   *%rax
+}
+  805329:	c9                   	leave
+  80532a:	c3                   	ret
+
+000000000080532b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80532b:	55                   	push   %rbp
+  80532c:	48 89 e5             	mov    %rsp,%rbp
+  80532f:	41 56                	push   %r14
+  805331:	41 55                	push   %r13
+  805333:	41 54                	push   %r12
+  805335:	53                   	push   %rbx
+  805336:	48 83 ec 50          	sub    $0x50,%rsp
+  80533a:	49 89 fc             	mov    %rdi,%r12
+  80533d:	41 89 f5             	mov    %esi,%r13d
+  805340:	48 89 d3             	mov    %rdx,%rbx
+  805343:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805347:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80534b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80534f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805356:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80535a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80535e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805362:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805366:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80536d:	00 00 00 
+  805370:	4c 8b 30             	mov    (%rax),%r14
+  805373:	48 b8 87 27 80 00 00 	movabs $0x802787,%rax
+  80537a:	00 00 00 
+  80537d:	ff d0                	call   *%rax
+  80537f:	89 c6                	mov    %eax,%esi
+  805381:	45 89 e8             	mov    %r13d,%r8d
+  805384:	4c 89 e1             	mov    %r12,%rcx
+  805387:	4c 89 f2             	mov    %r14,%rdx
+  80538a:	48 bf d8 65 80 00 00 	movabs $0x8065d8,%rdi
+  805391:	00 00 00 
+  805394:	b8 00 00 00 00       	mov    $0x0,%eax
+  805399:	49 bc c3 17 80 00 00 	movabs $0x8017c3,%r12
+  8053a0:	00 00 00 
+  8053a3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8053a6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8053aa:	48 89 df             	mov    %rbx,%rdi
+  8053ad:	48 b8 5f 17 80 00 00 	movabs $0x80175f,%rax
+  8053b4:	00 00 00 
+  8053b7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8053b9:	48 bf d2 5e 80 00 00 	movabs $0x805ed2,%rdi
+  8053c0:	00 00 00 
+  8053c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053c8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8053cb:	cc                   	int3
+  8053cc:	eb fd                	jmp    8053cb <_panic+0xa0>
+
+00000000008053ce <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8053ce:	55                   	push   %rbp
+  8053cf:	48 89 e5             	mov    %rsp,%rbp
+  8053d2:	41 56                	push   %r14
+  8053d4:	41 55                	push   %r13
+  8053d6:	41 54                	push   %r12
+  8053d8:	53                   	push   %rbx
+  8053d9:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053dc:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053e3:	00 00 00 
+  8053e6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8053ea:	74 27                	je     805413 <_handle_vectored_pagefault+0x45>
+  8053ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8053f1:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8053f8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053fb:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8053fe:	4c 89 e7             	mov    %r12,%rdi
+  805401:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805406:	84 c0                	test   %al,%al
+  805408:	75 45                	jne    80544f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80540a:	48 83 c3 01          	add    $0x1,%rbx
+  80540e:	49 3b 1e             	cmp    (%r14),%rbx
+  805411:	72 eb                	jb     8053fe <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805413:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80541a:	00 
+  80541b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805420:	4d 8b 04 24          	mov    (%r12),%r8
+  805424:	48 ba 00 66 80 00 00 	movabs $0x806600,%rdx
+  80542b:	00 00 00 
+  80542e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805433:	48 bf 30 66 80 00 00 	movabs $0x806630,%rdi
+  80543a:	00 00 00 
+  80543d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805442:	49 ba 2b 53 80 00 00 	movabs $0x80532b,%r10
+  805449:	00 00 00 
+  80544c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80544f:	5b                   	pop    %rbx
+  805450:	41 5c                	pop    %r12
+  805452:	41 5d                	pop    %r13
+  805454:	41 5e                	pop    %r14
+  805456:	5d                   	pop    %rbp
+  805457:	c3                   	ret
+
+0000000000805458 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805458:	55                   	push   %rbp
+  805459:	48 89 e5             	mov    %rsp,%rbp
+  80545c:	53                   	push   %rbx
+  80545d:	48 83 ec 08          	sub    $0x8,%rsp
+  805461:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805464:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805469:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805470:	00 00 00 
+  805473:	80 38 00             	cmpb   $0x0,(%rax)
+  805476:	74 68                	je     8054e0 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805478:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80547f:	00 00 00 
+  805482:	48 8b 08             	mov    (%rax),%rcx
+  805485:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80548a:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805491:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805494:	48 85 c9             	test   %rcx,%rcx
+  805497:	0f 84 e0 00 00 00    	je     80557d <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80549d:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8054a1:	0f 84 c9 00 00 00    	je     805570 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054a7:	48 83 c2 01          	add    $0x1,%rdx
+  8054ab:	48 39 ca             	cmp    %rcx,%rdx
+  8054ae:	75 ed                	jne    80549d <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8054b0:	48 83 f9 08          	cmp    $0x8,%rcx
+  8054b4:	0f 84 84 00 00 00    	je     80553e <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8054ba:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8054be:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8054c5:	00 00 00 
+  8054c8:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8054cf:	00 00 00 
+  8054d2:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8054d6:	85 f6                	test   %esi,%esi
+  8054d8:	0f 89 97 00 00 00    	jns    805575 <add_pgfault_handler+0x11d>
+  8054de:	eb 63                	jmp    805543 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8054e0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8054e5:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8054ea:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8054f1:	00 00 00 
+  8054f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054f9:	48 b8 5f 28 80 00 00 	movabs $0x80285f,%rax
+  805500:	00 00 00 
+  805503:	ff d0                	call   *%rax
+  805505:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805507:	85 c0                	test   %eax,%eax
+  805509:	78 38                	js     805543 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80550b:	48 be 59 56 80 00 00 	movabs $0x805659,%rsi
+  805512:	00 00 00 
+  805515:	bf 00 00 00 00       	mov    $0x0,%edi
+  80551a:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  805521:	00 00 00 
+  805524:	ff d0                	call   *%rax
+  805526:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805528:	85 c0                	test   %eax,%eax
+  80552a:	78 17                	js     805543 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80552c:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805533:	00 00 00 
+  805536:	c6 00 01             	movb   $0x1,(%rax)
+  805539:	e9 3a ff ff ff       	jmp    805478 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80553e:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805543:	89 f1                	mov    %esi,%ecx
+  805545:	48 ba 3e 66 80 00 00 	movabs $0x80663e,%rdx
+  80554c:	00 00 00 
+  80554f:	be 42 00 00 00       	mov    $0x42,%esi
+  805554:	48 bf 30 66 80 00 00 	movabs $0x806630,%rdi
+  80555b:	00 00 00 
+  80555e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805563:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  80556a:	00 00 00 
+  80556d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805570:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805575:	89 f0                	mov    %esi,%eax
+  805577:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80557b:	c9                   	leave
+  80557c:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80557d:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805584:	00 00 00 
+  805587:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80558e:	48 89 d8             	mov    %rbx,%rax
+  805591:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805598:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80559b:	eb d8                	jmp    805575 <add_pgfault_handler+0x11d>
+
+000000000080559d <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80559d:	55                   	push   %rbp
+  80559e:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8055a1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8055a8:	00 00 00 
+  8055ab:	80 38 00             	cmpb   $0x0,(%rax)
+  8055ae:	74 33                	je     8055e3 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055b0:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8055b7:	00 00 00 
+  8055ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8055bf:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8055c6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055c9:	48 85 c0             	test   %rax,%rax
+  8055cc:	0f 84 85 00 00 00    	je     805657 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8055d2:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8055d6:	74 40                	je     805618 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055d8:	48 83 c1 01          	add    $0x1,%rcx
+  8055dc:	48 39 c1             	cmp    %rax,%rcx
+  8055df:	75 f1                	jne    8055d2 <remove_pgfault_handler+0x35>
+  8055e1:	eb 74                	jmp    805657 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8055e3:	48 b9 56 66 80 00 00 	movabs $0x806656,%rcx
+  8055ea:	00 00 00 
+  8055ed:	48 ba 16 65 80 00 00 	movabs $0x806516,%rdx
+  8055f4:	00 00 00 
+  8055f7:	be 48 00 00 00       	mov    $0x48,%esi
+  8055fc:	48 bf 30 66 80 00 00 	movabs $0x806630,%rdi
+  805603:	00 00 00 
+  805606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80560b:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  805612:	00 00 00 
+  805615:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805618:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80561f:	00 
+  805620:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805624:	48 29 ca             	sub    %rcx,%rdx
+  805627:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80562e:	00 00 00 
+  805631:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805635:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80563a:	48 89 ce             	mov    %rcx,%rsi
+  80563d:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  805644:	00 00 00 
+  805647:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805649:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805650:	00 00 00 
+  805653:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805657:	5d                   	pop    %rbp
+  805658:	c3                   	ret
+
+0000000000805659 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805659:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80565c:	48 b8 ce 53 80 00 00 	movabs $0x8053ce,%rax
+  805663:	00 00 00 
+    call *%rax
+  805666:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805668:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80566f:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805670:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805677:	00 
+    subq $8, %rcx
+  805678:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80567c:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80567f:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805686:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805687:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  80568b:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80568f:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805694:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805699:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80569e:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8056a3:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8056a8:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8056ad:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8056b2:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8056b7:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8056bc:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8056c1:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8056c6:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8056cb:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8056d0:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8056d5:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8056d9:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8056dd:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8056de:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8056df:	c3                   	ret
+
+00000000008056e0 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8056e0:	85 ff                	test   %edi,%edi
+  8056e2:	78 58                	js     80573c <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8056e4:	48 85 f6             	test   %rsi,%rsi
+  8056e7:	74 12                	je     8056fb <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8056e9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056f0:	00 00 00 
+  8056f3:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8056f9:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8056fb:	48 85 c9             	test   %rcx,%rcx
+  8056fe:	74 12                	je     805712 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805700:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805707:	00 00 00 
+  80570a:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805710:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805712:	48 85 d2             	test   %rdx,%rdx
+  805715:	74 14                	je     80572b <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805717:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80571e:	00 00 00 
+  805721:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805728:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80572b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805732:	00 00 00 
+  805735:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80573b:	c3                   	ret
+        if (from_env_store) {
+  80573c:	48 85 f6             	test   %rsi,%rsi
+  80573f:	74 06                	je     805747 <ipc_result+0x67>
+            *from_env_store = 0;
+  805741:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805747:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805749:	48 85 c9             	test   %rcx,%rcx
+  80574c:	74 ed                	je     80573b <ipc_result+0x5b>
+            *perm_store = 0;
+  80574e:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805754:	c3                   	ret
+
+0000000000805755 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805755:	55                   	push   %rbp
+  805756:	48 89 e5             	mov    %rsp,%rbp
+  805759:	41 55                	push   %r13
+  80575b:	41 54                	push   %r12
+  80575d:	53                   	push   %rbx
+  80575e:	48 83 ec 08          	sub    $0x8,%rsp
+  805762:	49 89 fc             	mov    %rdi,%r12
+  805765:	48 89 f7             	mov    %rsi,%rdi
+  805768:	48 89 d3             	mov    %rdx,%rbx
+  80576b:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80576e:	48 85 f6             	test   %rsi,%rsi
+  805771:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805778:	00 00 00 
+  80577b:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80577f:	be 00 00 00 00       	mov    $0x0,%esi
+  805784:	48 85 d2             	test   %rdx,%rdx
+  805787:	74 03                	je     80578c <ipc_recv+0x37>
+  805789:	48 8b 32             	mov    (%rdx),%rsi
+  80578c:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  805793:	00 00 00 
+  805796:	ff d0                	call   *%rax
+  805798:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80579a:	4c 89 e9             	mov    %r13,%rcx
+  80579d:	48 89 da             	mov    %rbx,%rdx
+  8057a0:	4c 89 e6             	mov    %r12,%rsi
+  8057a3:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  8057aa:	00 00 00 
+  8057ad:	ff d0                	call   *%rax
+}
+  8057af:	48 83 c4 08          	add    $0x8,%rsp
+  8057b3:	5b                   	pop    %rbx
+  8057b4:	41 5c                	pop    %r12
+  8057b6:	41 5d                	pop    %r13
+  8057b8:	5d                   	pop    %rbp
+  8057b9:	c3                   	ret
+
+00000000008057ba <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8057ba:	55                   	push   %rbp
+  8057bb:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057be:	48 85 d2             	test   %rdx,%rdx
+  8057c1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057c8:	00 00 00 
+  8057cb:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8057cf:	89 f6                	mov    %esi,%esi
+  8057d1:	48 b8 37 2c 80 00 00 	movabs $0x802c37,%rax
+  8057d8:	00 00 00 
+  8057db:	ff d0                	call   *%rax
+    if (res < 0) {
+  8057dd:	85 c0                	test   %eax,%eax
+  8057df:	78 02                	js     8057e3 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8057e1:	5d                   	pop    %rbp
+  8057e2:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8057e3:	89 c1                	mov    %eax,%ecx
+  8057e5:	48 ba 70 66 80 00 00 	movabs $0x806670,%rdx
+  8057ec:	00 00 00 
+  8057ef:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8057f4:	48 bf 7d 66 80 00 00 	movabs $0x80667d,%rdi
+  8057fb:	00 00 00 
+  8057fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805803:	49 b8 2b 53 80 00 00 	movabs $0x80532b,%r8
+  80580a:	00 00 00 
+  80580d:	41 ff d0             	call   *%r8
+
+0000000000805810 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805810:	55                   	push   %rbp
+  805811:	48 89 e5             	mov    %rsp,%rbp
+  805814:	53                   	push   %rbx
+  805815:	48 83 ec 08          	sub    $0x8,%rsp
+  805819:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80581d:	48 85 d2             	test   %rdx,%rdx
+  805820:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805827:	00 00 00 
+  80582a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80582e:	4d 85 c9             	test   %r9,%r9
+  805831:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80583a:	48 85 db             	test   %rbx,%rbx
+  80583d:	74 03                	je     805842 <ipc_call+0x32>
+  80583f:	48 8b 03             	mov    (%rbx),%rax
+  805842:	89 f6                	mov    %esi,%esi
+  805844:	48 83 ec 08          	sub    $0x8,%rsp
+  805848:	50                   	push   %rax
+  805849:	48 b8 69 2c 80 00 00 	movabs $0x802c69,%rax
+  805850:	00 00 00 
+  805853:	ff d0                	call   *%rax
+  805855:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805857:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80585b:	48 89 da             	mov    %rbx,%rdx
+  80585e:	be 00 00 00 00       	mov    $0x0,%esi
+  805863:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  80586a:	00 00 00 
+  80586d:	ff d0                	call   *%rax
+}
+  80586f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805873:	c9                   	leave
+  805874:	c3                   	ret
+
+0000000000805875 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805875:	55                   	push   %rbp
+  805876:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805879:	89 f6                	mov    %esi,%esi
+  80587b:	48 b8 d5 2c 80 00 00 	movabs $0x802cd5,%rax
+  805882:	00 00 00 
+  805885:	ff d0                	call   *%rax
+  805887:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805889:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80588e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805893:	be 00 00 00 00       	mov    $0x0,%esi
+  805898:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  80589f:	00 00 00 
+  8058a2:	ff d0                	call   *%rax
+}
+  8058a4:	5d                   	pop    %rbp
+  8058a5:	c3                   	ret
+
+00000000008058a6 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8058a6:	55                   	push   %rbp
+  8058a7:	48 89 e5             	mov    %rsp,%rbp
+  8058aa:	41 54                	push   %r12
+  8058ac:	53                   	push   %rbx
+  8058ad:	4c 89 cb             	mov    %r9,%rbx
+  8058b0:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8058b4:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8058b8:	48 85 d2             	test   %rdx,%rdx
+  8058bb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058c2:	00 00 00 
+  8058c5:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8058c9:	4d 85 c9             	test   %r9,%r9
+  8058cc:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8058d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058d5:	4d 85 e4             	test   %r12,%r12
+  8058d8:	74 04                	je     8058de <ipc_reply_wait+0x38>
+  8058da:	49 8b 04 24          	mov    (%r12),%rax
+  8058de:	89 f6                	mov    %esi,%esi
+  8058e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8058e4:	50                   	push   %rax
+  8058e5:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  8058ec:	00 00 00 
+  8058ef:	ff d0                	call   *%rax
+  8058f1:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8058f3:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8058f7:	4c 89 e2             	mov    %r12,%rdx
+  8058fa:	48 89 de             	mov    %rbx,%rsi
+  8058fd:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  805904:	00 00 00 
+  805907:	ff d0                	call   *%rax
+}
+  805909:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80590d:	5b                   	pop    %rbx
+  80590e:	41 5c                	pop    %r12
+  805910:	5d                   	pop    %rbp
+  805911:	c3                   	ret
+
+0000000000805912 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805912:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805917:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80591e:	00 00 00 
+  805921:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805928:	48 01 ca             	add    %rcx,%rdx
+  80592b:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805931:	39 fa                	cmp    %edi,%edx
+  805933:	74 12                	je     805947 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805935:	48 83 c0 01          	add    $0x1,%rax
+  805939:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80593f:	75 e0                	jne    805921 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805941:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805946:	c3                   	ret
+            return envs[i].env_id;
+  805947:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80594e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805955:	00 00 00 
+  805958:	48 01 d0             	add    %rdx,%rax
+  80595b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805961:	c3                   	ret
+  805962:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000805968 <__rodata_start>:
+  805968:	77 00                	ja     80596a <__rodata_start+0x2>
+  80596a:	72 62                	jb     8059ce <__rodata_start+0x66>
+  80596c:	00 77 62             	add    %dh,0x62(%rdi)
+  80596f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805972:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805979:	00 
+  80597a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  805980:	b3 09                	mov    $0x9,%bl
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 ed                	add    %ch,%ch
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 ed                	add    %ch,%ch
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	8c 0a                	mov    %cs,(%rdx)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	8c 0a                	mov    %cs,(%rdx)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	8c 0a                	mov    %cs,(%rdx)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	8c 0a                	mov    %cs,(%rdx)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	8c 0a                	mov    %cs,(%rdx)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	ed                   	in     (%dx),%eax
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	f4                   	hlt
+  805b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b1f:	00 ed                	add    %ch,%ch
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	2c 0b                	sub    $0xb,%al
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 ed                	add    %ch,%ch
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805b73:	00 00                	add    %al,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 cb                	add    %cl,%bl
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	6a 0a                	push   $0xa
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 ed                	add    %ch,%ch
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	3c 0a                	cmp    $0xa,%al
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 ed                	add    %ch,%ch
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805bcb:	00 00                	add    %al,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 29                	add    %ch,(%rcx)
+  805bd9:	0c 80                	or     $0x80,%al
+  805bdb:	00 00                	add    %al,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 ed                	add    %ch,%ch
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	1a 0b                	sbb    (%rbx),%cl
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 ed                	add    %ch,%ch
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ce                   	(bad)
+  805c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c07:	00 ed                	add    %ch,%ch
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	f4                   	hlt
+  805c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c1f:	00 37                	add    %dh,(%rdi)
+  805c21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 37                	add    %dh,(%rdi)
+  805c31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805c4b:	00 00                	add    %al,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 d2                	add    %dl,%dl
+  805c51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c57:	00 d2                	add    %dl,%dl
+  805c59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c5f:	00 d2                	add    %dl,%dl
+  805c61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c67:	00 d2                	add    %dl,%dl
+  805c69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c6f:	00 d2                	add    %dl,%dl
+  805c71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c77:	00 d2                	add    %dl,%dl
+  805c79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c7f:	00 d2                	add    %dl,%dl
+  805c81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c87:	00 f6                	add    %dh,%dh
+  805c89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c8f:	00 f6                	add    %dh,%dh
+  805c91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 22                	add    %ah,(%rdx)
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 22                	add    %ah,(%rdx)
+  805cd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cdf:	00 22                	add    %ah,(%rdx)
+  805ce1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ce7:	00 22                	add    %ah,(%rdx)
+  805ce9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cef:	00 22                	add    %ah,(%rdx)
+  805cf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cf7:	00 22                	add    %ah,(%rdx)
+  805cf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 46 12             	add    %al,0x12(%rsi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 22                	add    %ah,(%rdx)
+  805dd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dd7:	00 22                	add    %ah,(%rdx)
+  805dd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ddf:	00 22                	add    %ah,(%rdx)
+  805de1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805de7:	00 22                	add    %ah,(%rdx)
+  805de9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805def:	00 22                	add    %ah,(%rdx)
+  805df1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805df7:	00 22                	add    %ah,(%rdx)
+  805df9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 46 12             	add    %al,0x12(%rsi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805ea0 <basefix.0>:
+  805ea0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805eb0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805ec0:	10 00 75 73 61 67 65 3a 20 6c 73 66 64 20 5b 2d     ..usage: lsfd [-
+  805ed0:	31 5d 0a 00 0f 1f 40 00 66 64 20 25 64 3a 20 6e     1]....@.fd %d: n
+  805ee0:	61 6d 65 20 25 73 20 69 73 64 69 72 20 25 64 20     ame %s isdir %d 
+  805ef0:	73 69 7a 65 20 25 64 20 64 65 76 20 25 73 0a 00     size %d dev %s..
+  805f00:	3c 75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35     <unknown>.012345
+  805f10:	36 37 38 39 41 42 43 44 45 46 00 30 31 32 33 34     6789ABCDEF.01234
+  805f20:	35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75 6c     56789abcdef.(nul
+  805f30:	6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73 70     l).error %d.unsp
+  805f40:	65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62 61     ecified error.ba
+  805f50:	64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e     d environment.in
+  805f60:	76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72 00     valid parameter.
+  805f70:	6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75     out of memory.ou
+  805f80:	74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74     t of environment
+  805f90:	73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62 75     s.corrupted debu
+  805fa0:	67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74     g info.segmentat
+  805fb0:	69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69     ion fault.invali
+  805fc0:	64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73     d ELF image.no s
+  805fd0:	75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00     uch system call.
+  805fe0:	65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00     entry not found.
+  805ff0:	65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76 69     env is not recvi
+  806000:	6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65 6e     ng.unexpected en
+  806010:	64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65     d of file.no fre
+  806020:	65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00     e space on disk.
+  806030:	74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61     too many files a
+  806040:	72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20     re open.file or 
+  806050:	62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00     block not found.
+  806060:	69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69 6c     invalid path.fil
+  806070:	65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74 73     e already exists
+  806080:	00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73     .operation not s
+  806090:	75 70 70 6f 72 74 65 64 00 0f 1f 80 00 00 00 00     upported........
+  8060a0:	bb 19 80 00 00 00 00 00 12 20 80 00 00 00 00 00     ......... ......
+  8060b0:	02 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8060c0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8060d0:	12 20 80 00 00 00 00 00 da 19 80 00 00 00 00 00     . ..............
+  8060e0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8060f0:	ce 19 80 00 00 00 00 00 48 1a 80 00 00 00 00 00     ........H.......
+  806100:	12 20 80 00 00 00 00 00 ce 19 80 00 00 00 00 00     . ..............
+  806110:	14 1a 80 00 00 00 00 00 14 1a 80 00 00 00 00 00     ................
+  806120:	14 1a 80 00 00 00 00 00 14 1a 80 00 00 00 00 00     ................
+  806130:	14 1a 80 00 00 00 00 00 14 1a 80 00 00 00 00 00     ................
+  806140:	14 1a 80 00 00 00 00 00 14 1a 80 00 00 00 00 00     ................
+  806150:	14 1a 80 00 00 00 00 00 12 20 80 00 00 00 00 00     ......... ......
+  806160:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806170:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806180:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806190:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8061a0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8061b0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8061c0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8061d0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8061e0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8061f0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806200:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806210:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806220:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806230:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806240:	12 20 80 00 00 00 00 00 30 1f 80 00 00 00 00 00     . ......0.......
+  806250:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806260:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806270:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806280:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806290:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8062a0:	76 1a 80 00 00 00 00 00 45 1c 80 00 00 00 00 00     v.......E.......
+  8062b0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  8062c0:	12 20 80 00 00 00 00 00 6b 1a 80 00 00 00 00 00     . ......k.......
+  8062d0:	a5 1a 80 00 00 00 00 00 12 20 80 00 00 00 00 00     ......... ......
+  8062e0:	12 20 80 00 00 00 00 00 60 1a 80 00 00 00 00 00     . ......`.......
+  8062f0:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806300:	ee 1d 80 00 00 00 00 00 bd 1e 80 00 00 00 00 00     ................
+  806310:	12 20 80 00 00 00 00 00 12 20 80 00 00 00 00 00     . ....... ......
+  806320:	3c 1b 80 00 00 00 00 00 12 20 80 00 00 00 00 00     <........ ......
+  806330:	19 1d 80 00 00 00 00 00 12 20 80 00 00 00 00 00     ......... ......
+  806340:	12 20 80 00 00 00 00 00 30 1f 80 00 00 00 00 00     . ......0.......
+  806350:	12 20 80 00 00 00 00 00 c4 19 80 00 00 00 00 00     . ..............
+
+0000000000806360 <error_string>:
+	...
+  806368:	3c 5f 80 00 00 00 00 00 4e 5f 80 00 00 00 00 00     <_......N_......
+  806378:	5e 5f 80 00 00 00 00 00 70 5f 80 00 00 00 00 00     ^_......p_......
+  806388:	7e 5f 80 00 00 00 00 00 92 5f 80 00 00 00 00 00     ~_......._......
+  806398:	a7 5f 80 00 00 00 00 00 ba 5f 80 00 00 00 00 00     ._......._......
+  8063a8:	cc 5f 80 00 00 00 00 00 e0 5f 80 00 00 00 00 00     ._......._......
+  8063b8:	f0 5f 80 00 00 00 00 00 03 60 80 00 00 00 00 00     ._.......`......
+  8063c8:	1a 60 80 00 00 00 00 00 30 60 80 00 00 00 00 00     .`......0`......
+  8063d8:	48 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00     H`......``......
+  8063e8:	6d 60 80 00 00 00 00 00 00 64 80 00 00 00 00 00     m`.......d......
+  8063f8:	81 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .`......file is 
+  806408:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806418:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806428:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806438:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806448:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806458:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806468:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806478:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806488:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806498:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8064a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8064b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8064c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8064d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008064e0 <devtab>:
+  8064e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8064f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806500:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806510:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806520:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806530:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806540:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806550:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806560:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806570:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806580:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806590:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8065a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8065b0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8065c0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8065d0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8065e0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8065f0:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806600:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806610:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806620:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806630:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806640:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806650:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806660:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806670:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806680:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,10674 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 46 26 80 00 00 	movabs $0x802646,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 66 23 80 00 00 	movabs $0x802366,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 b9 37 80 00 00 	movabs $0x8037b9,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 66 23 80 00 00 	movabs $0x802366,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 b9 37 80 00 00 	movabs $0x8037b9,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 8f 41 80 00 00 	movabs $0x80418f,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 8f 41 80 00 00 	movabs $0x80418f,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 fa 18 80 00 00 	movabs $0x8018fa,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be a7 62 80 00 00 	movabs $0x8062a7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 66 24 80 00 00 	movabs $0x802466,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be a8 5b 80 00 00 	movabs $0x805ba8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 66 24 80 00 00 	movabs $0x802466,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be aa 5b 80 00 00 	movabs $0x805baa,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 66 24 80 00 00 	movabs $0x802466,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be ad 5b 80 00 00 	movabs $0x805bad,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 66 24 80 00 00 	movabs $0x802466,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 8d 4f 80 00 00 	movabs $0x804f8d,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 64 52 80 00 00 	movabs $0x805264,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 a3 38 80 00 00 	movabs $0x8038a3,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 6c 39 80 00 00 	movabs $0x80396c,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 72 38 80 00 00 	movabs $0x803872,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 72 38 80 00 00 	movabs $0x803872,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 8a 36 80 00 00 	movabs $0x80368a,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 b9 37 80 00 00 	movabs $0x8037b9,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 66 23 80 00 00 	movabs $0x802366,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 13 26 80 00 00 	movabs $0x802613,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 5b 80 00 00 	movabs $0x805bc0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 13 26 80 00 00 	movabs $0x802613,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 46 26 80 00 00 	movabs $0x802646,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 13 26 80 00 00 	movabs $0x802613,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 5e 80 00 00 	movabs $0x805e60,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 13 26 80 00 00 	movabs $0x802613,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 13 26 80 00 00 	movabs $0x802613,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 6b 28 80 00 00 	movabs $0x80286b,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 6b 28 80 00 00 	movabs $0x80286b,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 52 03 00 00       	call   801851 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <memlayout>:
+#ifndef PROT_SHARE
+#define PROT_SHARE 0x400
+#endif
+
+void
+memlayout(void) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 48          	sub    $0x48,%rsp
+    size_t total_p = 0;
+    size_t total_u = 0;
+    size_t total_w = 0;
+    size_t total_cow = 0;
+
+    cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  801512:	49 bc 20 80 80 01 00 	movabs $0x1808020,%r12
+  801519:	00 00 00 
+  80151c:	49 8b 04 24          	mov    (%r12),%rax
+  801520:	8b 90 cc 00 00 00    	mov    0xcc(%rax),%edx
+  801526:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80152c:	48 bf 0e 61 80 00 00 	movabs $0x80610e,%rdi
+  801533:	00 00 00 
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153b:	48 bb 6d 1a 80 00 00 	movabs $0x801a6d,%rbx
+  801542:	00 00 00 
+  801545:	ff d3                	call   *%rbx
+    cprintf("pml4=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space.pml4,
+  801547:	49 8b 04 24          	mov    (%r12),%rax
+  80154b:	48 8b b0 20 01 00 00 	mov    0x120(%rax),%rsi
+  801552:	49 b9 00 00 00 80 00 	movabs $0x10080000000,%r9
+  801559:	01 00 00 
+  80155c:	49 b8 00 00 00 00 00 	movabs $0x10000000000,%r8
+  801563:	01 00 00 
+  801566:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80156d:	01 00 00 
+  801570:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801577:	01 00 00 
+  80157a:	48 bf c0 61 80 00 00 	movabs $0x8061c0,%rdi
+  801581:	00 00 00 
+  801584:	b8 00 00 00 00       	mov    $0x0,%eax
+  801589:	ff d3                	call   *%rbx
+    size_t total_cow = 0;
+  80158b:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  801592:	00 
+    size_t total_w = 0;
+  801593:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  80159a:	00 
+    size_t total_u = 0;
+  80159b:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8015a2:	00 
+    size_t total_p = 0;
+  8015a3:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8015aa:	00 
+            (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
+
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  8015ab:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        pte_t ent = get_uvpt_entry((void *)addr);
+  8015b1:	49 bd 93 47 80 00 00 	movabs $0x804793,%r13
+  8015b8:	00 00 00 
+        if (ent) {
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8015bb:	49 bc 37 61 80 00 00 	movabs $0x806137,%r12
+  8015c2:	00 00 00 
+  8015c5:	eb 5f                	jmp    801626 <memlayout+0x125>
+                    (void *)get_uvpt_entry((void *)addr), (unsigned long)addr, (unsigned long)ent,
+  8015c7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8015cb:	41 ff d5             	call   *%r13
+  8015ce:	48 89 c6             	mov    %rax,%rsi
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8015d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d5:	41 57                	push   %r15
+  8015d7:	ff 75 c0             	push   -0x40(%rbp)
+  8015da:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8015dd:	50                   	push   %rax
+  8015de:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  8015e2:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  8015e6:	48 89 d9             	mov    %rbx,%rcx
+  8015e9:	4c 89 f2             	mov    %r14,%rdx
+  8015ec:	48 bf f0 61 80 00 00 	movabs $0x8061f0,%rdi
+  8015f3:	00 00 00 
+  8015f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fb:	49 ba 6d 1a 80 00 00 	movabs $0x801a6d,%r10
+  801602:	00 00 00 
+  801605:	41 ff d2             	call   *%r10
+  801608:	48 83 c4 20          	add    $0x20,%rsp
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  80160c:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  801613:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80161a:	00 00 00 
+  80161d:	49 39 c6             	cmp    %rax,%r14
+  801620:	0f 84 8f 00 00 00    	je     8016b5 <memlayout+0x1b4>
+        pte_t ent = get_uvpt_entry((void *)addr);
+  801626:	4c 89 75 c8          	mov    %r14,-0x38(%rbp)
+  80162a:	4c 89 f7             	mov    %r14,%rdi
+  80162d:	41 ff d5             	call   *%r13
+  801630:	48 89 c3             	mov    %rax,%rbx
+        if (ent) {
+  801633:	48 85 c0             	test   %rax,%rax
+  801636:	74 d4                	je     80160c <memlayout+0x10b>
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  801638:	a8 40                	test   $0x40,%al
+  80163a:	49 bf 02 61 80 00 00 	movabs $0x806102,%r15
+  801641:	00 00 00 
+  801644:	4d 0f 44 fc          	cmove  %r12,%r15
+  801648:	4c 89 65 c0          	mov    %r12,-0x40(%rbp)
+  80164c:	f6 c4 08             	test   $0x8,%ah
+  80164f:	74 13                	je     801664 <memlayout+0x163>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+                    (ent & PROT_COW) ? total_cow++, " COW" : "",
+  801651:	48 83 45 90 01       	addq   $0x1,-0x70(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  801656:	48 b8 09 61 80 00 00 	movabs $0x806109,%rax
+  80165d:	00 00 00 
+  801660:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801664:	c7 45 bc 2d 00 00 00 	movl   $0x2d,-0x44(%rbp)
+  80166b:	f6 c3 02             	test   $0x2,%bl
+  80166e:	74 0c                	je     80167c <memlayout+0x17b>
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+  801670:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  801675:	c7 45 bc 57 00 00 00 	movl   $0x57,-0x44(%rbp)
+  80167c:	c7 45 b8 2d 00 00 00 	movl   $0x2d,-0x48(%rbp)
+  801683:	f6 c3 04             	test   $0x4,%bl
+  801686:	74 0c                	je     801694 <memlayout+0x193>
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+  801688:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80168d:	c7 45 b8 55 00 00 00 	movl   $0x55,-0x48(%rbp)
+  801694:	c7 45 b4 2d 00 00 00 	movl   $0x2d,-0x4c(%rbp)
+  80169b:	f6 c3 01             	test   $0x1,%bl
+  80169e:	0f 84 23 ff ff ff    	je     8015c7 <memlayout+0xc6>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+  8016a4:	48 83 45 a8 01       	addq   $0x1,-0x58(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8016a9:	c7 45 b4 50 00 00 00 	movl   $0x50,-0x4c(%rbp)
+  8016b0:	e9 12 ff ff ff       	jmp    8015c7 <memlayout+0xc6>
+                    (ent & PROT_SHARE) ? " SHARE" : "");
+        }
+    }
+
+    cprintf("Memory usage summary:\n");
+  8016b5:	48 bf 21 61 80 00 00 	movabs $0x806121,%rdi
+  8016bc:	00 00 00 
+  8016bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c4:	48 bb 6d 1a 80 00 00 	movabs $0x801a6d,%rbx
+  8016cb:	00 00 00 
+  8016ce:	ff d3                	call   *%rbx
+    cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  8016d0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8016d4:	48 bf 38 61 80 00 00 	movabs $0x806138,%rdi
+  8016db:	00 00 00 
+  8016de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e3:	ff d3                	call   *%rbx
+    cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  8016e5:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8016e9:	48 bf 46 61 80 00 00 	movabs $0x806146,%rdi
+  8016f0:	00 00 00 
+  8016f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f8:	ff d3                	call   *%rbx
+    cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  8016fa:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  8016fe:	48 bf 54 61 80 00 00 	movabs $0x806154,%rdi
+  801705:	00 00 00 
+  801708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170d:	ff d3                	call   *%rbx
+    cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  80170f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801713:	48 bf 62 61 80 00 00 	movabs $0x806162,%rdi
+  80171a:	00 00 00 
+  80171d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801722:	ff d3                	call   *%rbx
+}
+  801724:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801728:	5b                   	pop    %rbx
+  801729:	41 5c                	pop    %r12
+  80172b:	41 5d                	pop    %r13
+  80172d:	41 5e                	pop    %r14
+  80172f:	41 5f                	pop    %r15
+  801731:	5d                   	pop    %rbp
+  801732:	c3                   	ret
+
+0000000000801733 <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  801733:	55                   	push   %rbp
+  801734:	48 89 e5             	mov    %rsp,%rbp
+  801737:	41 54                	push   %r12
+  801739:	53                   	push   %rbx
+  80173a:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t ceid;
+    int pipefd[2];
+    int res;
+
+    memlayout();
+  80173e:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+
+    res = pipe(pipefd);
+  80174a:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  80174e:	48 b8 34 45 80 00 00 	movabs $0x804534,%rax
+  801755:	00 00 00 
+  801758:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe() failed\n");
+  80175a:	85 c0                	test   %eax,%eax
+  80175c:	78 46                	js     8017a4 <umain+0x71>
+    ceid = fork();
+  80175e:	48 b8 67 31 80 00 00 	movabs $0x803167,%rax
+  801765:	00 00 00 
+  801768:	ff d0                	call   *%rax
+    if (ceid < 0) panic("fork() failed\n");
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	78 60                	js     8017ce <umain+0x9b>
+
+    if (!ceid) {
+  80176e:	0f 84 84 00 00 00    	je     8017f8 <umain+0xc5>
+        cprintf("==== Child\n");
+        memlayout();
+        return;
+    }
+
+    cprintf("==== Parent\n");
+  801774:	48 bf ad 61 80 00 00 	movabs $0x8061ad,%rdi
+  80177b:	00 00 00 
+  80177e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801783:	48 ba 6d 1a 80 00 00 	movabs $0x801a6d,%rdx
+  80178a:	00 00 00 
+  80178d:	ff d2                	call   *%rdx
+    memlayout();
+  80178f:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801796:	00 00 00 
+  801799:	ff d0                	call   *%rax
+}
+  80179b:	48 83 c4 10          	add    $0x10,%rsp
+  80179f:	5b                   	pop    %rbx
+  8017a0:	41 5c                	pop    %r12
+  8017a2:	5d                   	pop    %rbp
+  8017a3:	c3                   	ret
+    if (res < 0) panic("pipe() failed\n");
+  8017a4:	48 ba 72 61 80 00 00 	movabs $0x806172,%rdx
+  8017ab:	00 00 00 
+  8017ae:	be 33 00 00 00       	mov    $0x33,%esi
+  8017b3:	48 bf 81 61 80 00 00 	movabs $0x806181,%rdi
+  8017ba:	00 00 00 
+  8017bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c2:	48 b9 1d 19 80 00 00 	movabs $0x80191d,%rcx
+  8017c9:	00 00 00 
+  8017cc:	ff d1                	call   *%rcx
+    if (ceid < 0) panic("fork() failed\n");
+  8017ce:	48 ba 92 61 80 00 00 	movabs $0x806192,%rdx
+  8017d5:	00 00 00 
+  8017d8:	be 35 00 00 00       	mov    $0x35,%esi
+  8017dd:	48 bf 81 61 80 00 00 	movabs $0x806181,%rdi
+  8017e4:	00 00 00 
+  8017e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ec:	48 b9 1d 19 80 00 00 	movabs $0x80191d,%rcx
+  8017f3:	00 00 00 
+  8017f6:	ff d1                	call   *%rcx
+        cprintf("\n");
+  8017f8:	48 bf 36 61 80 00 00 	movabs $0x806136,%rdi
+  8017ff:	00 00 00 
+  801802:	48 ba 6d 1a 80 00 00 	movabs $0x801a6d,%rdx
+  801809:	00 00 00 
+  80180c:	ff d2                	call   *%rdx
+  80180e:	bb 00 90 01 00       	mov    $0x19000,%ebx
+            sys_yield();
+  801813:	49 bc 68 2a 80 00 00 	movabs $0x802a68,%r12
+  80181a:	00 00 00 
+  80181d:	41 ff d4             	call   *%r12
+        for (i = 0; i < 102400; i++)
+  801820:	83 eb 01             	sub    $0x1,%ebx
+  801823:	75 f8                	jne    80181d <umain+0xea>
+        cprintf("==== Child\n");
+  801825:	48 bf a1 61 80 00 00 	movabs $0x8061a1,%rdi
+  80182c:	00 00 00 
+  80182f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801834:	48 ba 6d 1a 80 00 00 	movabs $0x801a6d,%rdx
+  80183b:	00 00 00 
+  80183e:	ff d2                	call   *%rdx
+        memlayout();
+  801840:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801847:	00 00 00 
+  80184a:	ff d0                	call   *%rax
+        return;
+  80184c:	e9 4a ff ff ff       	jmp    80179b <umain+0x68>
+
+0000000000801851 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801851:	55                   	push   %rbp
+  801852:	48 89 e5             	mov    %rsp,%rbp
+  801855:	41 56                	push   %r14
+  801857:	41 55                	push   %r13
+  801859:	41 54                	push   %r12
+  80185b:	53                   	push   %rbx
+  80185c:	41 89 fd             	mov    %edi,%r13d
+  80185f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801862:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801869:	00 00 00 
+  80186c:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801873:	00 00 00 
+  801876:	48 39 c2             	cmp    %rax,%rdx
+  801879:	73 17                	jae    801892 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80187b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80187e:	49 89 c4             	mov    %rax,%r12
+  801881:	48 83 c3 08          	add    $0x8,%rbx
+  801885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188a:	ff 53 f8             	call   *-0x8(%rbx)
+  80188d:	4c 39 e3             	cmp    %r12,%rbx
+  801890:	72 ef                	jb     801881 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801892:	48 b8 31 2a 80 00 00 	movabs $0x802a31,%rax
+  801899:	00 00 00 
+  80189c:	ff d0                	call   *%rax
+  80189e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018a3:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8018aa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018b1:	00 00 00 
+  8018b4:	48 01 d0             	add    %rdx,%rax
+  8018b7:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8018be:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8018c1:	45 85 ed             	test   %r13d,%r13d
+  8018c4:	7e 0d                	jle    8018d3 <libmain+0x82>
+  8018c6:	49 8b 06             	mov    (%r14),%rax
+  8018c9:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8018d0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8018d3:	4c 89 f6             	mov    %r14,%rsi
+  8018d6:	44 89 ef             	mov    %r13d,%edi
+  8018d9:	48 b8 33 17 80 00 00 	movabs $0x801733,%rax
+  8018e0:	00 00 00 
+  8018e3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8018e5:	48 b8 fa 18 80 00 00 	movabs $0x8018fa,%rax
+  8018ec:	00 00 00 
+  8018ef:	ff d0                	call   *%rax
+#endif
+}
+  8018f1:	5b                   	pop    %rbx
+  8018f2:	41 5c                	pop    %r12
+  8018f4:	41 5d                	pop    %r13
+  8018f6:	41 5e                	pop    %r14
+  8018f8:	5d                   	pop    %rbp
+  8018f9:	c3                   	ret
+
+00000000008018fa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8018fa:	55                   	push   %rbp
+  8018fb:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8018fe:	48 b8 3f 35 80 00 00 	movabs $0x80353f,%rax
+  801905:	00 00 00 
+  801908:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80190a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80190f:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+}
+  80191b:	5d                   	pop    %rbp
+  80191c:	c3                   	ret
+
+000000000080191d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+  801921:	41 56                	push   %r14
+  801923:	41 55                	push   %r13
+  801925:	41 54                	push   %r12
+  801927:	53                   	push   %rbx
+  801928:	48 83 ec 50          	sub    $0x50,%rsp
+  80192c:	49 89 fc             	mov    %rdi,%r12
+  80192f:	41 89 f5             	mov    %esi,%r13d
+  801932:	48 89 d3             	mov    %rdx,%rbx
+  801935:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801939:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80193d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801941:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801948:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80194c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801950:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801954:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801958:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80195f:	00 00 00 
+  801962:	4c 8b 30             	mov    (%rax),%r14
+  801965:	48 b8 31 2a 80 00 00 	movabs $0x802a31,%rax
+  80196c:	00 00 00 
+  80196f:	ff d0                	call   *%rax
+  801971:	89 c6                	mov    %eax,%esi
+  801973:	45 89 e8             	mov    %r13d,%r8d
+  801976:	4c 89 e1             	mov    %r12,%rcx
+  801979:	4c 89 f2             	mov    %r14,%rdx
+  80197c:	48 bf 20 62 80 00 00 	movabs $0x806220,%rdi
+  801983:	00 00 00 
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198b:	49 bc 6d 1a 80 00 00 	movabs $0x801a6d,%r12
+  801992:	00 00 00 
+  801995:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801998:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80199c:	48 89 df             	mov    %rbx,%rdi
+  80199f:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  8019a6:	00 00 00 
+  8019a9:	ff d0                	call   *%rax
+    cprintf("\n");
+  8019ab:	48 bf 36 61 80 00 00 	movabs $0x806136,%rdi
+  8019b2:	00 00 00 
+  8019b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ba:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8019bd:	cc                   	int3
+  8019be:	eb fd                	jmp    8019bd <_panic+0xa0>
+
+00000000008019c0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8019c0:	55                   	push   %rbp
+  8019c1:	48 89 e5             	mov    %rsp,%rbp
+  8019c4:	53                   	push   %rbx
+  8019c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8019cc:	8b 06                	mov    (%rsi),%eax
+  8019ce:	8d 50 01             	lea    0x1(%rax),%edx
+  8019d1:	89 16                	mov    %edx,(%rsi)
+  8019d3:	48 98                	cltq
+  8019d5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8019da:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8019e0:	74 0a                	je     8019ec <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8019e2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8019e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ea:	c9                   	leave
+  8019eb:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8019ec:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8019f0:	be ff 00 00 00       	mov    $0xff,%esi
+  8019f5:	48 b8 21 29 80 00 00 	movabs $0x802921,%rax
+  8019fc:	00 00 00 
+  8019ff:	ff d0                	call   *%rax
+        state->offset = 0;
+  801a01:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801a07:	eb d9                	jmp    8019e2 <putch+0x22>
+
+0000000000801a09 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801a09:	55                   	push   %rbp
+  801a0a:	48 89 e5             	mov    %rsp,%rbp
+  801a0d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801a14:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801a17:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801a1e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801a23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a28:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801a2b:	48 89 f1             	mov    %rsi,%rcx
+  801a2e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a35:	48 bf c0 19 80 00 00 	movabs $0x8019c0,%rdi
+  801a3c:	00 00 00 
+  801a3f:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  801a46:	00 00 00 
+  801a49:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a4b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a52:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a59:	48 b8 21 29 80 00 00 	movabs $0x802921,%rax
+  801a60:	00 00 00 
+  801a63:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801a65:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801a6b:	c9                   	leave
+  801a6c:	c3                   	ret
+
+0000000000801a6d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801a6d:	55                   	push   %rbp
+  801a6e:	48 89 e5             	mov    %rsp,%rbp
+  801a71:	48 83 ec 50          	sub    $0x50,%rsp
+  801a75:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801a79:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801a7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a89:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801aa0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801aa4:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  801aab:	00 00 00 
+  801aae:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801ab0:	c9                   	leave
+  801ab1:	c3                   	ret
+
+0000000000801ab2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801ab2:	55                   	push   %rbp
+  801ab3:	48 89 e5             	mov    %rsp,%rbp
+  801ab6:	41 57                	push   %r15
+  801ab8:	41 56                	push   %r14
+  801aba:	41 55                	push   %r13
+  801abc:	41 54                	push   %r12
+  801abe:	53                   	push   %rbx
+  801abf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac3:	49 89 fc             	mov    %rdi,%r12
+  801ac6:	49 89 f5             	mov    %rsi,%r13
+  801ac9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801acd:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ad0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801ad3:	41 89 cf             	mov    %ecx,%r15d
+  801ad6:	4c 39 fa             	cmp    %r15,%rdx
+  801ad9:	73 5b                	jae    801b36 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801adb:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801adf:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ae3:	85 db                	test   %ebx,%ebx
+  801ae5:	7e 0e                	jle    801af5 <print_num+0x43>
+            putch(padc, put_arg);
+  801ae7:	4c 89 ee             	mov    %r13,%rsi
+  801aea:	44 89 f7             	mov    %r14d,%edi
+  801aed:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801af0:	83 eb 01             	sub    $0x1,%ebx
+  801af3:	75 f2                	jne    801ae7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801af5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801af9:	48 b9 54 62 80 00 00 	movabs $0x806254,%rcx
+  801b00:	00 00 00 
+  801b03:	48 b8 43 62 80 00 00 	movabs $0x806243,%rax
+  801b0a:	00 00 00 
+  801b0d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801b11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b15:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1a:	49 f7 f7             	div    %r15
+  801b1d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801b21:	4c 89 ee             	mov    %r13,%rsi
+  801b24:	41 ff d4             	call   *%r12
+}
+  801b27:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b2b:	5b                   	pop    %rbx
+  801b2c:	41 5c                	pop    %r12
+  801b2e:	41 5d                	pop    %r13
+  801b30:	41 5e                	pop    %r14
+  801b32:	41 5f                	pop    %r15
+  801b34:	5d                   	pop    %rbp
+  801b35:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3f:	49 f7 f7             	div    %r15
+  801b42:	48 83 ec 08          	sub    $0x8,%rsp
+  801b46:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b4a:	52                   	push   %rdx
+  801b4b:	45 0f be c9          	movsbl %r9b,%r9d
+  801b4f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b53:	48 89 c2             	mov    %rax,%rdx
+  801b56:	48 b8 b2 1a 80 00 00 	movabs $0x801ab2,%rax
+  801b5d:	00 00 00 
+  801b60:	ff d0                	call   *%rax
+  801b62:	48 83 c4 10          	add    $0x10,%rsp
+  801b66:	eb 8d                	jmp    801af5 <print_num+0x43>
+
+0000000000801b68 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801b68:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801b6c:	48 8b 06             	mov    (%rsi),%rax
+  801b6f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801b73:	73 0a                	jae    801b7f <sprintputch+0x17>
+        *state->start++ = ch;
+  801b75:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b79:	48 89 16             	mov    %rdx,(%rsi)
+  801b7c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801b7f:	c3                   	ret
+
+0000000000801b80 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801b80:	55                   	push   %rbp
+  801b81:	48 89 e5             	mov    %rsp,%rbp
+  801b84:	48 83 ec 50          	sub    $0x50,%rsp
+  801b88:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b8c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b90:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b94:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b9b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801ba7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801bab:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801baf:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  801bb6:	00 00 00 
+  801bb9:	ff d0                	call   *%rax
+}
+  801bbb:	c9                   	leave
+  801bbc:	c3                   	ret
+
+0000000000801bbd <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801bbd:	55                   	push   %rbp
+  801bbe:	48 89 e5             	mov    %rsp,%rbp
+  801bc1:	41 57                	push   %r15
+  801bc3:	41 56                	push   %r14
+  801bc5:	41 55                	push   %r13
+  801bc7:	41 54                	push   %r12
+  801bc9:	53                   	push   %rbx
+  801bca:	48 83 ec 38          	sub    $0x38,%rsp
+  801bce:	49 89 fe             	mov    %rdi,%r14
+  801bd1:	49 89 f5             	mov    %rsi,%r13
+  801bd4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801bd7:	48 8b 01             	mov    (%rcx),%rax
+  801bda:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801bde:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801be2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801bea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801bee:	eb 0d                	jmp    801bfd <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801bf0:	40 0f b6 ff          	movzbl %dil,%edi
+  801bf4:	4c 89 ee             	mov    %r13,%rsi
+  801bf7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801bfa:	4c 89 e3             	mov    %r12,%rbx
+  801bfd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801c01:	0f b6 3b             	movzbl (%rbx),%edi
+  801c04:	40 80 ff 25          	cmp    $0x25,%dil
+  801c08:	74 14                	je     801c1e <vprintfmt+0x61>
+            if (!ch) return;
+  801c0a:	40 84 ff             	test   %dil,%dil
+  801c0d:	75 e1                	jne    801bf0 <vprintfmt+0x33>
+}
+  801c0f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801c13:	5b                   	pop    %rbx
+  801c14:	41 5c                	pop    %r12
+  801c16:	41 5d                	pop    %r13
+  801c18:	41 5e                	pop    %r14
+  801c1a:	41 5f                	pop    %r15
+  801c1c:	5d                   	pop    %rbp
+  801c1d:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801c1e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c23:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801c27:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801c2c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c32:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c39:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c3d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c42:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c47:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c4a:	83 e8 23             	sub    $0x23,%eax
+  801c4d:	3c 57                	cmp    $0x57,%al
+  801c4f:	0f 87 67 06 00 00    	ja     8022bc <vprintfmt+0x6ff>
+  801c55:	0f b6 c0             	movzbl %al,%eax
+  801c58:	48 b9 e0 63 80 00 00 	movabs $0x8063e0,%rcx
+  801c5f:	00 00 00 
+  801c62:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801c65:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801c68:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801c6c:	eb cf                	jmp    801c3d <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801c6e:	49 89 dc             	mov    %rbx,%r12
+  801c71:	be 01 00 00 00       	mov    $0x1,%esi
+  801c76:	eb c5                	jmp    801c3d <vprintfmt+0x80>
+            padc = ch;
+  801c78:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801c7c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c7f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c82:	eb b9                	jmp    801c3d <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c87:	83 f8 2f             	cmp    $0x2f,%eax
+  801c8a:	77 24                	ja     801cb0 <vprintfmt+0xf3>
+  801c8c:	89 c1                	mov    %eax,%ecx
+  801c8e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c92:	83 c0 08             	add    $0x8,%eax
+  801c95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c98:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c9b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c9e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ca2:	79 99                	jns    801c3d <vprintfmt+0x80>
+                width = precision;
+  801ca4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ca8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801cae:	eb 8d                	jmp    801c3d <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801cb0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801cb4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbc:	eb da                	jmp    801c98 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801cbe:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801cc3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cc7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ccd:	3c 39                	cmp    $0x39,%al
+  801ccf:	77 1c                	ja     801ced <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801cd1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801cd5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801cd9:	0f b6 c0             	movzbl %al,%eax
+  801cdc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ce1:	0f b6 03             	movzbl (%rbx),%eax
+  801ce4:	3c 39                	cmp    $0x39,%al
+  801ce6:	76 e9                	jbe    801cd1 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801ce8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ceb:	eb b1                	jmp    801c9e <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801ced:	49 89 dc             	mov    %rbx,%r12
+  801cf0:	eb ac                	jmp    801c9e <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801cf2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801cf5:	85 c9                	test   %ecx,%ecx
+  801cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfc:	0f 49 c1             	cmovns %ecx,%eax
+  801cff:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801d02:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d05:	e9 33 ff ff ff       	jmp    801c3d <vprintfmt+0x80>
+            lflag++;
+  801d0a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d0d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d10:	e9 28 ff ff ff       	jmp    801c3d <vprintfmt+0x80>
+            lflag--;
+  801d15:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d18:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d1b:	e9 1d ff ff ff       	jmp    801c3d <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801d20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d23:	83 f8 2f             	cmp    $0x2f,%eax
+  801d26:	77 19                	ja     801d41 <vprintfmt+0x184>
+  801d28:	89 c2                	mov    %eax,%edx
+  801d2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d2e:	83 c0 08             	add    $0x8,%eax
+  801d31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d34:	8b 3a                	mov    (%rdx),%edi
+  801d36:	4c 89 ee             	mov    %r13,%rsi
+  801d39:	41 ff d6             	call   *%r14
+            break;
+  801d3c:	e9 bc fe ff ff       	jmp    801bfd <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d4d:	eb e5                	jmp    801d34 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d52:	83 f8 2f             	cmp    $0x2f,%eax
+  801d55:	77 5a                	ja     801db1 <vprintfmt+0x1f4>
+  801d57:	89 c2                	mov    %eax,%edx
+  801d59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d5d:	83 c0 08             	add    $0x8,%eax
+  801d60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801d63:	8b 02                	mov    (%rdx),%eax
+  801d65:	89 c1                	mov    %eax,%ecx
+  801d67:	f7 d9                	neg    %ecx
+  801d69:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801d6c:	83 f9 13             	cmp    $0x13,%ecx
+  801d6f:	7f 4e                	jg     801dbf <vprintfmt+0x202>
+  801d71:	48 63 c1             	movslq %ecx,%rax
+  801d74:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  801d7b:	00 00 00 
+  801d7e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d82:	48 85 c0             	test   %rax,%rax
+  801d85:	74 38                	je     801dbf <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d87:	48 89 c1             	mov    %rax,%rcx
+  801d8a:	48 ba e8 68 80 00 00 	movabs $0x8068e8,%rdx
+  801d91:	00 00 00 
+  801d94:	4c 89 ee             	mov    %r13,%rsi
+  801d97:	4c 89 f7             	mov    %r14,%rdi
+  801d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9f:	49 b8 80 1b 80 00 00 	movabs $0x801b80,%r8
+  801da6:	00 00 00 
+  801da9:	41 ff d0             	call   *%r8
+  801dac:	e9 4c fe ff ff       	jmp    801bfd <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801db1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801db5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801db9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dbd:	eb a4                	jmp    801d63 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801dbf:	48 ba 6c 62 80 00 00 	movabs $0x80626c,%rdx
+  801dc6:	00 00 00 
+  801dc9:	4c 89 ee             	mov    %r13,%rsi
+  801dcc:	4c 89 f7             	mov    %r14,%rdi
+  801dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd4:	49 b8 80 1b 80 00 00 	movabs $0x801b80,%r8
+  801ddb:	00 00 00 
+  801dde:	41 ff d0             	call   *%r8
+  801de1:	e9 17 fe ff ff       	jmp    801bfd <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801de6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801de9:	83 f8 2f             	cmp    $0x2f,%eax
+  801dec:	77 6c                	ja     801e5a <vprintfmt+0x29d>
+  801dee:	89 c2                	mov    %eax,%edx
+  801df0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df4:	83 c0 08             	add    $0x8,%eax
+  801df7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dfa:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801dfd:	48 85 f6             	test   %rsi,%rsi
+  801e00:	48 b8 65 62 80 00 00 	movabs $0x806265,%rax
+  801e07:	00 00 00 
+  801e0a:	48 0f 45 c6          	cmovne %rsi,%rax
+  801e0e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801e12:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e16:	7e 06                	jle    801e1e <vprintfmt+0x261>
+  801e18:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801e1c:	75 4a                	jne    801e68 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e1e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e22:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801e26:	0f b6 00             	movzbl (%rax),%eax
+  801e29:	84 c0                	test   %al,%al
+  801e2b:	0f 85 9a 00 00 00    	jne    801ecb <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e31:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e34:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	0f 8e bd fd ff ff    	jle    801bfd <vprintfmt+0x40>
+  801e40:	4c 89 ee             	mov    %r13,%rsi
+  801e43:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e48:	41 ff d6             	call   *%r14
+  801e4b:	41 83 ec 01          	sub    $0x1,%r12d
+  801e4f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e53:	75 eb                	jne    801e40 <vprintfmt+0x283>
+  801e55:	e9 a3 fd ff ff       	jmp    801bfd <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e66:	eb 92                	jmp    801dfa <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801e68:	49 63 f7             	movslq %r15d,%rsi
+  801e6b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801e6f:	48 b8 81 23 80 00 00 	movabs $0x802381,%rax
+  801e76:	00 00 00 
+  801e79:	ff d0                	call   *%rax
+  801e7b:	48 89 c2             	mov    %rax,%rdx
+  801e7e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e81:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e83:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e86:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	7e 91                	jle    801e1e <vprintfmt+0x261>
+  801e8d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e92:	4c 89 ee             	mov    %r13,%rsi
+  801e95:	44 89 e7             	mov    %r12d,%edi
+  801e98:	41 ff d6             	call   *%r14
+  801e9b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e9f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ea2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ea5:	75 eb                	jne    801e92 <vprintfmt+0x2d5>
+  801ea7:	e9 72 ff ff ff       	jmp    801e1e <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801eac:	0f b6 f8             	movzbl %al,%edi
+  801eaf:	4c 89 ee             	mov    %r13,%rsi
+  801eb2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801eb5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801eb9:	49 83 c4 01          	add    $0x1,%r12
+  801ebd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ec3:	84 c0                	test   %al,%al
+  801ec5:	0f 84 66 ff ff ff    	je     801e31 <vprintfmt+0x274>
+  801ecb:	45 85 ff             	test   %r15d,%r15d
+  801ece:	78 0a                	js     801eda <vprintfmt+0x31d>
+  801ed0:	41 83 ef 01          	sub    $0x1,%r15d
+  801ed4:	0f 88 57 ff ff ff    	js     801e31 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801eda:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801ede:	74 cc                	je     801eac <vprintfmt+0x2ef>
+  801ee0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801ee3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ee8:	80 fa 5e             	cmp    $0x5e,%dl
+  801eeb:	77 c2                	ja     801eaf <vprintfmt+0x2f2>
+  801eed:	eb bd                	jmp    801eac <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801eef:	40 84 f6             	test   %sil,%sil
+  801ef2:	75 26                	jne    801f1a <vprintfmt+0x35d>
+    switch (lflag) {
+  801ef4:	85 d2                	test   %edx,%edx
+  801ef6:	74 59                	je     801f51 <vprintfmt+0x394>
+  801ef8:	83 fa 01             	cmp    $0x1,%edx
+  801efb:	74 7b                	je     801f78 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801efd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f00:	83 f8 2f             	cmp    $0x2f,%eax
+  801f03:	0f 87 96 00 00 00    	ja     801f9f <vprintfmt+0x3e2>
+  801f09:	89 c2                	mov    %eax,%edx
+  801f0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f0f:	83 c0 08             	add    $0x8,%eax
+  801f12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f15:	4c 8b 22             	mov    (%rdx),%r12
+  801f18:	eb 17                	jmp    801f31 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801f1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f1d:	83 f8 2f             	cmp    $0x2f,%eax
+  801f20:	77 21                	ja     801f43 <vprintfmt+0x386>
+  801f22:	89 c2                	mov    %eax,%edx
+  801f24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f28:	83 c0 08             	add    $0x8,%eax
+  801f2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f2e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f31:	4d 85 e4             	test   %r12,%r12
+  801f34:	78 7a                	js     801fb0 <vprintfmt+0x3f3>
+            num = i;
+  801f36:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f39:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f3e:	e9 56 02 00 00       	jmp    802199 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f4f:	eb dd                	jmp    801f2e <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f54:	83 f8 2f             	cmp    $0x2f,%eax
+  801f57:	77 11                	ja     801f6a <vprintfmt+0x3ad>
+  801f59:	89 c2                	mov    %eax,%edx
+  801f5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f5f:	83 c0 08             	add    $0x8,%eax
+  801f62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f65:	4c 63 22             	movslq (%rdx),%r12
+  801f68:	eb c7                	jmp    801f31 <vprintfmt+0x374>
+  801f6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f76:	eb ed                	jmp    801f65 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801f78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f7b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f7e:	77 11                	ja     801f91 <vprintfmt+0x3d4>
+  801f80:	89 c2                	mov    %eax,%edx
+  801f82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f86:	83 c0 08             	add    $0x8,%eax
+  801f89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f8c:	4c 8b 22             	mov    (%rdx),%r12
+  801f8f:	eb a0                	jmp    801f31 <vprintfmt+0x374>
+  801f91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f9d:	eb ed                	jmp    801f8c <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fab:	e9 65 ff ff ff       	jmp    801f15 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801fb0:	4c 89 ee             	mov    %r13,%rsi
+  801fb3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801fb8:	41 ff d6             	call   *%r14
+                i = -i;
+  801fbb:	49 f7 dc             	neg    %r12
+  801fbe:	e9 73 ff ff ff       	jmp    801f36 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801fc3:	40 84 f6             	test   %sil,%sil
+  801fc6:	75 2e                	jne    801ff6 <vprintfmt+0x439>
+    switch (lflag) {
+  801fc8:	85 d2                	test   %edx,%edx
+  801fca:	7f 59                	jg     802025 <vprintfmt+0x468>
+  801fcc:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fcf:	7d 7a                	jge    80204b <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801fd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fd4:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd7:	0f 87 aa 00 00 00    	ja     802087 <vprintfmt+0x4ca>
+  801fdd:	89 c2                	mov    %eax,%edx
+  801fdf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fe3:	83 c0 08             	add    $0x8,%eax
+  801fe6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fe9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801ff1:	e9 a3 01 00 00       	jmp    802199 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ff6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ff9:	83 f8 2f             	cmp    $0x2f,%eax
+  801ffc:	77 19                	ja     802017 <vprintfmt+0x45a>
+  801ffe:	89 c2                	mov    %eax,%edx
+  802000:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802004:	83 c0 08             	add    $0x8,%eax
+  802007:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80200a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80200d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802012:	e9 82 01 00 00       	jmp    802199 <vprintfmt+0x5dc>
+  802017:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80201f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802023:	eb e5                	jmp    80200a <vprintfmt+0x44d>
+    switch (lflag) {
+  802025:	83 fa 01             	cmp    $0x1,%edx
+  802028:	75 a7                	jne    801fd1 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  80202a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80202d:	83 f8 2f             	cmp    $0x2f,%eax
+  802030:	77 47                	ja     802079 <vprintfmt+0x4bc>
+  802032:	89 c2                	mov    %eax,%edx
+  802034:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802038:	83 c0 08             	add    $0x8,%eax
+  80203b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80203e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802041:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802046:	e9 4e 01 00 00       	jmp    802199 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80204b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80204e:	83 f8 2f             	cmp    $0x2f,%eax
+  802051:	77 18                	ja     80206b <vprintfmt+0x4ae>
+  802053:	89 c2                	mov    %eax,%edx
+  802055:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802059:	83 c0 08             	add    $0x8,%eax
+  80205c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80205f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802061:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802066:	e9 2e 01 00 00       	jmp    802199 <vprintfmt+0x5dc>
+  80206b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80206f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802073:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802077:	eb e6                	jmp    80205f <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  802079:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80207d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802081:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802085:	eb b7                	jmp    80203e <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802087:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80208b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80208f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802093:	e9 51 ff ff ff       	jmp    801fe9 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802098:	40 84 f6             	test   %sil,%sil
+  80209b:	75 2e                	jne    8020cb <vprintfmt+0x50e>
+    switch (lflag) {
+  80209d:	85 d2                	test   %edx,%edx
+  80209f:	7f 59                	jg     8020fa <vprintfmt+0x53d>
+  8020a1:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8020a4:	7d 77                	jge    80211d <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  8020a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ac:	0f 87 a4 00 00 00    	ja     802156 <vprintfmt+0x599>
+  8020b2:	89 c2                	mov    %eax,%edx
+  8020b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020b8:	83 c0 08             	add    $0x8,%eax
+  8020bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020be:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020c1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8020c6:	e9 ce 00 00 00       	jmp    802199 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8020d1:	77 19                	ja     8020ec <vprintfmt+0x52f>
+  8020d3:	89 c2                	mov    %eax,%edx
+  8020d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020d9:	83 c0 08             	add    $0x8,%eax
+  8020dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020e2:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020e7:	e9 ad 00 00 00       	jmp    802199 <vprintfmt+0x5dc>
+  8020ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020f8:	eb e5                	jmp    8020df <vprintfmt+0x522>
+    switch (lflag) {
+  8020fa:	83 fa 01             	cmp    $0x1,%edx
+  8020fd:	75 a7                	jne    8020a6 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8020ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802102:	83 f8 2f             	cmp    $0x2f,%eax
+  802105:	77 41                	ja     802148 <vprintfmt+0x58b>
+  802107:	89 c2                	mov    %eax,%edx
+  802109:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80210d:	83 c0 08             	add    $0x8,%eax
+  802110:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802113:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802116:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80211b:	eb 7c                	jmp    802199 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80211d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802120:	83 f8 2f             	cmp    $0x2f,%eax
+  802123:	77 15                	ja     80213a <vprintfmt+0x57d>
+  802125:	89 c2                	mov    %eax,%edx
+  802127:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80212b:	83 c0 08             	add    $0x8,%eax
+  80212e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802131:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802133:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802138:	eb 5f                	jmp    802199 <vprintfmt+0x5dc>
+  80213a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80213e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802142:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802146:	eb e9                	jmp    802131 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802148:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80214c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802150:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802154:	eb bd                	jmp    802113 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802156:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80215a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802162:	e9 57 ff ff ff       	jmp    8020be <vprintfmt+0x501>
+            putch('0', put_arg);
+  802167:	4c 89 ee             	mov    %r13,%rsi
+  80216a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80216f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802172:	4c 89 ee             	mov    %r13,%rsi
+  802175:	bf 78 00 00 00       	mov    $0x78,%edi
+  80217a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80217d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802180:	83 f8 2f             	cmp    $0x2f,%eax
+  802183:	77 47                	ja     8021cc <vprintfmt+0x60f>
+  802185:	89 c2                	mov    %eax,%edx
+  802187:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80218b:	83 c0 08             	add    $0x8,%eax
+  80218e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802191:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802194:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802199:	48 83 ec 08          	sub    $0x8,%rsp
+  80219d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8021a1:	0f 94 c0             	sete   %al
+  8021a4:	0f b6 c0             	movzbl %al,%eax
+  8021a7:	50                   	push   %rax
+  8021a8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8021ad:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8021b1:	4c 89 ee             	mov    %r13,%rsi
+  8021b4:	4c 89 f7             	mov    %r14,%rdi
+  8021b7:	48 b8 b2 1a 80 00 00 	movabs $0x801ab2,%rax
+  8021be:	00 00 00 
+  8021c1:	ff d0                	call   *%rax
+            break;
+  8021c3:	48 83 c4 10          	add    $0x10,%rsp
+  8021c7:	e9 31 fa ff ff       	jmp    801bfd <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8021cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021d8:	eb b7                	jmp    802191 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8021da:	40 84 f6             	test   %sil,%sil
+  8021dd:	75 2b                	jne    80220a <vprintfmt+0x64d>
+    switch (lflag) {
+  8021df:	85 d2                	test   %edx,%edx
+  8021e1:	7f 56                	jg     802239 <vprintfmt+0x67c>
+  8021e3:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8021e6:	7d 77                	jge    80225f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8021e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ee:	0f 87 a7 00 00 00    	ja     80229b <vprintfmt+0x6de>
+  8021f4:	89 c2                	mov    %eax,%edx
+  8021f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021fa:	83 c0 08             	add    $0x8,%eax
+  8021fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802200:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802203:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802208:	eb 8f                	jmp    802199 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80220a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80220d:	83 f8 2f             	cmp    $0x2f,%eax
+  802210:	77 19                	ja     80222b <vprintfmt+0x66e>
+  802212:	89 c2                	mov    %eax,%edx
+  802214:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802218:	83 c0 08             	add    $0x8,%eax
+  80221b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80221e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802221:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802226:	e9 6e ff ff ff       	jmp    802199 <vprintfmt+0x5dc>
+  80222b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80222f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802233:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802237:	eb e5                	jmp    80221e <vprintfmt+0x661>
+    switch (lflag) {
+  802239:	83 fa 01             	cmp    $0x1,%edx
+  80223c:	75 aa                	jne    8021e8 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80223e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802241:	83 f8 2f             	cmp    $0x2f,%eax
+  802244:	77 47                	ja     80228d <vprintfmt+0x6d0>
+  802246:	89 c2                	mov    %eax,%edx
+  802248:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80224c:	83 c0 08             	add    $0x8,%eax
+  80224f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802252:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802255:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80225a:	e9 3a ff ff ff       	jmp    802199 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80225f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802262:	83 f8 2f             	cmp    $0x2f,%eax
+  802265:	77 18                	ja     80227f <vprintfmt+0x6c2>
+  802267:	89 c2                	mov    %eax,%edx
+  802269:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80226d:	83 c0 08             	add    $0x8,%eax
+  802270:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802273:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802275:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80227a:	e9 1a ff ff ff       	jmp    802199 <vprintfmt+0x5dc>
+  80227f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802283:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802287:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228b:	eb e6                	jmp    802273 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80228d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802291:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802295:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802299:	eb b7                	jmp    802252 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80229b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80229f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022a7:	e9 54 ff ff ff       	jmp    802200 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8022ac:	4c 89 ee             	mov    %r13,%rsi
+  8022af:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022b4:	41 ff d6             	call   *%r14
+            break;
+  8022b7:	e9 41 f9 ff ff       	jmp    801bfd <vprintfmt+0x40>
+            putch('%', put_arg);
+  8022bc:	4c 89 ee             	mov    %r13,%rsi
+  8022bf:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022c4:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8022c7:	48 83 eb 01          	sub    $0x1,%rbx
+  8022cb:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8022cf:	75 f6                	jne    8022c7 <vprintfmt+0x70a>
+  8022d1:	e9 27 f9 ff ff       	jmp    801bfd <vprintfmt+0x40>
+
+00000000008022d6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8022d6:	55                   	push   %rbp
+  8022d7:	48 89 e5             	mov    %rsp,%rbp
+  8022da:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8022de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022e2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8022e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8022eb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8022f2:	48 85 ff             	test   %rdi,%rdi
+  8022f5:	74 2b                	je     802322 <vsnprintf+0x4c>
+  8022f7:	48 85 f6             	test   %rsi,%rsi
+  8022fa:	74 26                	je     802322 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8022fc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802300:	48 bf 68 1b 80 00 00 	movabs $0x801b68,%rdi
+  802307:	00 00 00 
+  80230a:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  802311:	00 00 00 
+  802314:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802316:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80231a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80231d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802322:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802327:	eb f7                	jmp    802320 <vsnprintf+0x4a>
+
+0000000000802329 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802329:	55                   	push   %rbp
+  80232a:	48 89 e5             	mov    %rsp,%rbp
+  80232d:	48 83 ec 50          	sub    $0x50,%rsp
+  802331:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802335:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802339:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80233d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802344:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802348:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80234c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802350:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802354:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802358:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+
+0000000000802366 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802366:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802369:	74 10                	je     80237b <strlen+0x15>
+    size_t n = 0;
+  80236b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802370:	48 83 c0 01          	add    $0x1,%rax
+  802374:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802378:	75 f6                	jne    802370 <strlen+0xa>
+  80237a:	c3                   	ret
+    size_t n = 0;
+  80237b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802380:	c3                   	ret
+
+0000000000802381 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802381:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802384:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802389:	48 85 f6             	test   %rsi,%rsi
+  80238c:	74 11                	je     80239f <strnlen+0x1e>
+  80238e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802392:	74 0c                	je     8023a0 <strnlen+0x1f>
+  802394:	48 83 c2 01          	add    $0x1,%rdx
+  802398:	48 39 d0             	cmp    %rdx,%rax
+  80239b:	75 f1                	jne    80238e <strnlen+0xd>
+  80239d:	eb 04                	jmp    8023a3 <strnlen+0x22>
+  80239f:	c3                   	ret
+  8023a0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8023a3:	c3                   	ret
+
+00000000008023a4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8023a4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8023a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ac:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8023b0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8023b3:	48 83 c2 01          	add    $0x1,%rdx
+  8023b7:	84 c9                	test   %cl,%cl
+  8023b9:	75 f1                	jne    8023ac <strcpy+0x8>
+        ;
+    return res;
+}
+  8023bb:	c3                   	ret
+
+00000000008023bc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8023bc:	55                   	push   %rbp
+  8023bd:	48 89 e5             	mov    %rsp,%rbp
+  8023c0:	41 54                	push   %r12
+  8023c2:	53                   	push   %rbx
+  8023c3:	48 89 fb             	mov    %rdi,%rbx
+  8023c6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8023c9:	48 b8 66 23 80 00 00 	movabs $0x802366,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8023d5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8023d9:	4c 89 e6             	mov    %r12,%rsi
+  8023dc:	48 b8 a4 23 80 00 00 	movabs $0x8023a4,%rax
+  8023e3:	00 00 00 
+  8023e6:	ff d0                	call   *%rax
+    return dst;
+}
+  8023e8:	48 89 d8             	mov    %rbx,%rax
+  8023eb:	5b                   	pop    %rbx
+  8023ec:	41 5c                	pop    %r12
+  8023ee:	5d                   	pop    %rbp
+  8023ef:	c3                   	ret
+
+00000000008023f0 <toupper>:
+
+int
+toupper(int ch) {
+  8023f0:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8023f2:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8023f5:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8023f8:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023fb:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023fe:	c3                   	ret
+
+00000000008023ff <tolower>:
+
+int
+tolower(int ch) {
+  8023ff:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802401:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802404:	8d 57 20             	lea    0x20(%rdi),%edx
+  802407:	83 f9 1a             	cmp    $0x1a,%ecx
+  80240a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80240d:	c3                   	ret
+
+000000000080240e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80240e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802411:	48 85 d2             	test   %rdx,%rdx
+  802414:	74 1f                	je     802435 <strncpy+0x27>
+  802416:	48 01 fa             	add    %rdi,%rdx
+  802419:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80241c:	48 83 c1 01          	add    $0x1,%rcx
+  802420:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802424:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802428:	41 80 f8 01          	cmp    $0x1,%r8b
+  80242c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802430:	48 39 ca             	cmp    %rcx,%rdx
+  802433:	75 e7                	jne    80241c <strncpy+0xe>
+    }
+    return ret;
+}
+  802435:	c3                   	ret
+
+0000000000802436 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802436:	48 89 f8             	mov    %rdi,%rax
+  802439:	48 85 d2             	test   %rdx,%rdx
+  80243c:	74 24                	je     802462 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80243e:	48 83 ea 01          	sub    $0x1,%rdx
+  802442:	74 1b                	je     80245f <strlcpy+0x29>
+  802444:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802448:	0f b6 16             	movzbl (%rsi),%edx
+  80244b:	84 d2                	test   %dl,%dl
+  80244d:	74 10                	je     80245f <strlcpy+0x29>
+            *dst++ = *src++;
+  80244f:	48 83 c6 01          	add    $0x1,%rsi
+  802453:	48 83 c0 01          	add    $0x1,%rax
+  802457:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80245a:	48 39 c8             	cmp    %rcx,%rax
+  80245d:	75 e9                	jne    802448 <strlcpy+0x12>
+        *dst = '\0';
+  80245f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802462:	48 29 f8             	sub    %rdi,%rax
+}
+  802465:	c3                   	ret
+
+0000000000802466 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802466:	0f b6 07             	movzbl (%rdi),%eax
+  802469:	84 c0                	test   %al,%al
+  80246b:	74 13                	je     802480 <strcmp+0x1a>
+  80246d:	38 06                	cmp    %al,(%rsi)
+  80246f:	75 0f                	jne    802480 <strcmp+0x1a>
+  802471:	48 83 c7 01          	add    $0x1,%rdi
+  802475:	48 83 c6 01          	add    $0x1,%rsi
+  802479:	0f b6 07             	movzbl (%rdi),%eax
+  80247c:	84 c0                	test   %al,%al
+  80247e:	75 ed                	jne    80246d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802480:	0f b6 c0             	movzbl %al,%eax
+  802483:	0f b6 16             	movzbl (%rsi),%edx
+  802486:	29 d0                	sub    %edx,%eax
+}
+  802488:	c3                   	ret
+
+0000000000802489 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802489:	48 85 d2             	test   %rdx,%rdx
+  80248c:	74 1f                	je     8024ad <strncmp+0x24>
+  80248e:	0f b6 07             	movzbl (%rdi),%eax
+  802491:	84 c0                	test   %al,%al
+  802493:	74 1e                	je     8024b3 <strncmp+0x2a>
+  802495:	3a 06                	cmp    (%rsi),%al
+  802497:	75 1a                	jne    8024b3 <strncmp+0x2a>
+  802499:	48 83 c7 01          	add    $0x1,%rdi
+  80249d:	48 83 c6 01          	add    $0x1,%rsi
+  8024a1:	48 83 ea 01          	sub    $0x1,%rdx
+  8024a5:	75 e7                	jne    80248e <strncmp+0x5>
+
+    if (!n) return 0;
+  8024a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ac:	c3                   	ret
+  8024ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b2:	c3                   	ret
+  8024b3:	48 85 d2             	test   %rdx,%rdx
+  8024b6:	74 09                	je     8024c1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8024b8:	0f b6 07             	movzbl (%rdi),%eax
+  8024bb:	0f b6 16             	movzbl (%rsi),%edx
+  8024be:	29 d0                	sub    %edx,%eax
+  8024c0:	c3                   	ret
+    if (!n) return 0;
+  8024c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024c6:	c3                   	ret
+
+00000000008024c7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8024c7:	0f b6 17             	movzbl (%rdi),%edx
+  8024ca:	84 d2                	test   %dl,%dl
+  8024cc:	74 18                	je     8024e6 <strchr+0x1f>
+        if (*str == c) {
+  8024ce:	0f be d2             	movsbl %dl,%edx
+  8024d1:	39 f2                	cmp    %esi,%edx
+  8024d3:	74 17                	je     8024ec <strchr+0x25>
+    for (; *str; str++) {
+  8024d5:	48 83 c7 01          	add    $0x1,%rdi
+  8024d9:	0f b6 17             	movzbl (%rdi),%edx
+  8024dc:	84 d2                	test   %dl,%dl
+  8024de:	75 ee                	jne    8024ce <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8024e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e5:	c3                   	ret
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024eb:	c3                   	ret
+  8024ec:	48 89 f8             	mov    %rdi,%rax
+}
+  8024ef:	c3                   	ret
+
+00000000008024f0 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8024f0:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8024f3:	0f b6 17             	movzbl (%rdi),%edx
+  8024f6:	84 d2                	test   %dl,%dl
+  8024f8:	74 13                	je     80250d <strfind+0x1d>
+  8024fa:	0f be d2             	movsbl %dl,%edx
+  8024fd:	39 f2                	cmp    %esi,%edx
+  8024ff:	74 0b                	je     80250c <strfind+0x1c>
+  802501:	48 83 c0 01          	add    $0x1,%rax
+  802505:	0f b6 10             	movzbl (%rax),%edx
+  802508:	84 d2                	test   %dl,%dl
+  80250a:	75 ee                	jne    8024fa <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80250c:	c3                   	ret
+  80250d:	c3                   	ret
+
+000000000080250e <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80250e:	48 39 f7             	cmp    %rsi,%rdi
+  802511:	74 65                	je     802578 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802513:	55                   	push   %rbp
+  802514:	48 89 e5             	mov    %rsp,%rbp
+  802517:	41 57                	push   %r15
+  802519:	41 56                	push   %r14
+  80251b:	41 55                	push   %r13
+  80251d:	41 54                	push   %r12
+  80251f:	53                   	push   %rbx
+  802520:	48 83 ec 18          	sub    $0x18,%rsp
+  802524:	48 89 fb             	mov    %rdi,%rbx
+  802527:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80252a:	49 bf ff 23 80 00 00 	movabs $0x8023ff,%r15
+  802531:	00 00 00 
+  802534:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802538:	41 0f b6 fd          	movzbl %r13b,%edi
+  80253c:	41 ff d7             	call   *%r15
+  80253f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802542:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802547:	41 0f b6 fe          	movzbl %r14b,%edi
+  80254b:	41 ff d7             	call   *%r15
+  80254e:	89 c2                	mov    %eax,%edx
+  802550:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802553:	29 d0                	sub    %edx,%eax
+  802555:	75 12                	jne    802569 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802557:	48 83 c3 01          	add    $0x1,%rbx
+  80255b:	45 84 ed             	test   %r13b,%r13b
+  80255e:	74 09                	je     802569 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802560:	49 83 c4 01          	add    $0x1,%r12
+  802564:	45 84 f6             	test   %r14b,%r14b
+  802567:	75 cb                	jne    802534 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802569:	48 83 c4 18          	add    $0x18,%rsp
+  80256d:	5b                   	pop    %rbx
+  80256e:	41 5c                	pop    %r12
+  802570:	41 5d                	pop    %r13
+  802572:	41 5e                	pop    %r14
+  802574:	41 5f                	pop    %r15
+  802576:	5d                   	pop    %rbp
+  802577:	c3                   	ret
+    if (p1 == p2) return 0;
+  802578:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257d:	c3                   	ret
+
+000000000080257e <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80257e:	48 39 f7             	cmp    %rsi,%rdi
+  802581:	74 7d                	je     802600 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802583:	55                   	push   %rbp
+  802584:	48 89 e5             	mov    %rsp,%rbp
+  802587:	41 57                	push   %r15
+  802589:	41 56                	push   %r14
+  80258b:	41 55                	push   %r13
+  80258d:	41 54                	push   %r12
+  80258f:	53                   	push   %rbx
+  802590:	48 83 ec 18          	sub    $0x18,%rsp
+  802594:	48 89 fb             	mov    %rdi,%rbx
+  802597:	49 89 f4             	mov    %rsi,%r12
+  80259a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80259e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8025a2:	49 bf ff 23 80 00 00 	movabs $0x8023ff,%r15
+  8025a9:	00 00 00 
+    while (n--) {
+  8025ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025b0:	48 39 c3             	cmp    %rax,%rbx
+  8025b3:	74 37                	je     8025ec <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8025b5:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8025b9:	41 0f b6 fd          	movzbl %r13b,%edi
+  8025bd:	41 ff d7             	call   *%r15
+  8025c0:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8025c3:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8025c8:	41 0f b6 fe          	movzbl %r14b,%edi
+  8025cc:	41 ff d7             	call   *%r15
+  8025cf:	89 c2                	mov    %eax,%edx
+  8025d1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8025d4:	29 d0                	sub    %edx,%eax
+  8025d6:	75 19                	jne    8025f1 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8025d8:	48 83 c3 01          	add    $0x1,%rbx
+  8025dc:	45 84 ed             	test   %r13b,%r13b
+  8025df:	74 10                	je     8025f1 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8025e1:	49 83 c4 01          	add    $0x1,%r12
+  8025e5:	45 84 f6             	test   %r14b,%r14b
+  8025e8:	75 c2                	jne    8025ac <strncasecmp+0x2e>
+  8025ea:	eb 05                	jmp    8025f1 <strncasecmp+0x73>
+  8025ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8025f1:	48 83 c4 18          	add    $0x18,%rsp
+  8025f5:	5b                   	pop    %rbx
+  8025f6:	41 5c                	pop    %r12
+  8025f8:	41 5d                	pop    %r13
+  8025fa:	41 5e                	pop    %r14
+  8025fc:	41 5f                	pop    %r15
+  8025fe:	5d                   	pop    %rbp
+  8025ff:	c3                   	ret
+    if (p1 == p2) return 0;
+  802600:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802605:	c3                   	ret
+
+0000000000802606 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802606:	83 e7 df             	and    $0xffffffdf,%edi
+  802609:	83 ef 41             	sub    $0x41,%edi
+  80260c:	83 ff 19             	cmp    $0x19,%edi
+  80260f:	0f 96 c0             	setbe  %al
+}
+  802612:	c3                   	ret
+
+0000000000802613 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802613:	83 ff 20             	cmp    $0x20,%edi
+  802616:	0f 94 c0             	sete   %al
+  802619:	83 ff 09             	cmp    $0x9,%edi
+  80261c:	0f 94 c2             	sete   %dl
+  80261f:	09 d0                	or     %edx,%eax
+}
+  802621:	c3                   	ret
+
+0000000000802622 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802622:	55                   	push   %rbp
+  802623:	48 89 e5             	mov    %rsp,%rbp
+  802626:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802628:	48 bf 5f 67 80 00 00 	movabs $0x80675f,%rdi
+  80262f:	00 00 00 
+  802632:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+  80263e:	48 85 c0             	test   %rax,%rax
+  802641:	0f 95 c0             	setne  %al
+}
+  802644:	5d                   	pop    %rbp
+  802645:	c3                   	ret
+
+0000000000802646 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802646:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802649:	48 89 f8             	mov    %rdi,%rax
+  80264c:	48 f7 d8             	neg    %rax
+  80264f:	83 e0 07             	and    $0x7,%eax
+  802652:	49 89 d1             	mov    %rdx,%r9
+  802655:	49 29 c1             	sub    %rax,%r9
+  802658:	78 36                	js     802690 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80265a:	40 0f b6 c6          	movzbl %sil,%eax
+  80265e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802665:	01 01 01 
+  802668:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80266c:	40 f6 c7 07          	test   $0x7,%dil
+  802670:	75 38                	jne    8026aa <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802672:	4c 89 c9             	mov    %r9,%rcx
+  802675:	48 c1 f9 03          	sar    $0x3,%rcx
+  802679:	74 0c                	je     802687 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80267b:	fc                   	cld
+  80267c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80267f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802683:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802687:	4d 85 c9             	test   %r9,%r9
+  80268a:	75 45                	jne    8026d1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80268c:	4c 89 c0             	mov    %r8,%rax
+  80268f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802690:	48 85 d2             	test   %rdx,%rdx
+  802693:	74 f7                	je     80268c <memset+0x46>
+  802695:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802698:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80269b:	48 83 c0 01          	add    $0x1,%rax
+  80269f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8026a3:	48 39 c2             	cmp    %rax,%rdx
+  8026a6:	75 f3                	jne    80269b <memset+0x55>
+  8026a8:	eb e2                	jmp    80268c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8026aa:	40 f6 c7 01          	test   $0x1,%dil
+  8026ae:	74 06                	je     8026b6 <memset+0x70>
+  8026b0:	88 07                	mov    %al,(%rdi)
+  8026b2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026b6:	40 f6 c7 02          	test   $0x2,%dil
+  8026ba:	74 07                	je     8026c3 <memset+0x7d>
+  8026bc:	66 89 07             	mov    %ax,(%rdi)
+  8026bf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026c3:	40 f6 c7 04          	test   $0x4,%dil
+  8026c7:	74 a9                	je     802672 <memset+0x2c>
+  8026c9:	89 07                	mov    %eax,(%rdi)
+  8026cb:	48 83 c7 04          	add    $0x4,%rdi
+  8026cf:	eb a1                	jmp    802672 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026d1:	41 f6 c1 04          	test   $0x4,%r9b
+  8026d5:	74 06                	je     8026dd <memset+0x97>
+  8026d7:	89 07                	mov    %eax,(%rdi)
+  8026d9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026dd:	41 f6 c1 02          	test   $0x2,%r9b
+  8026e1:	74 07                	je     8026ea <memset+0xa4>
+  8026e3:	66 89 07             	mov    %ax,(%rdi)
+  8026e6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8026ea:	41 f6 c1 01          	test   $0x1,%r9b
+  8026ee:	74 9c                	je     80268c <memset+0x46>
+  8026f0:	88 07                	mov    %al,(%rdi)
+  8026f2:	eb 98                	jmp    80268c <memset+0x46>
+
+00000000008026f4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8026f4:	48 89 f8             	mov    %rdi,%rax
+  8026f7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8026fa:	48 39 fe             	cmp    %rdi,%rsi
+  8026fd:	73 3b                	jae    80273a <memmove+0x46>
+  8026ff:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802703:	48 39 d7             	cmp    %rdx,%rdi
+  802706:	73 32                	jae    80273a <memmove+0x46>
+        s += n;
+        d += n;
+  802708:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80270c:	48 89 d6             	mov    %rdx,%rsi
+  80270f:	48 09 fe             	or     %rdi,%rsi
+  802712:	48 09 ce             	or     %rcx,%rsi
+  802715:	40 f6 c6 07          	test   $0x7,%sil
+  802719:	75 12                	jne    80272d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80271b:	48 83 ef 08          	sub    $0x8,%rdi
+  80271f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802723:	48 c1 e9 03          	shr    $0x3,%rcx
+  802727:	fd                   	std
+  802728:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80272b:	fc                   	cld
+  80272c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80272d:	48 83 ef 01          	sub    $0x1,%rdi
+  802731:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802735:	fd                   	std
+  802736:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802738:	eb f1                	jmp    80272b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80273a:	48 89 f2             	mov    %rsi,%rdx
+  80273d:	48 09 c2             	or     %rax,%rdx
+  802740:	48 09 ca             	or     %rcx,%rdx
+  802743:	f6 c2 07             	test   $0x7,%dl
+  802746:	75 0c                	jne    802754 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802748:	48 c1 e9 03          	shr    $0x3,%rcx
+  80274c:	48 89 c7             	mov    %rax,%rdi
+  80274f:	fc                   	cld
+  802750:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802753:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802754:	48 89 c7             	mov    %rax,%rdi
+  802757:	fc                   	cld
+  802758:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80275a:	c3                   	ret
+
+000000000080275b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80275b:	55                   	push   %rbp
+  80275c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80275f:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  802766:	00 00 00 
+  802769:	ff d0                	call   *%rax
+}
+  80276b:	5d                   	pop    %rbp
+  80276c:	c3                   	ret
+
+000000000080276d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80276d:	55                   	push   %rbp
+  80276e:	48 89 e5             	mov    %rsp,%rbp
+  802771:	41 57                	push   %r15
+  802773:	41 56                	push   %r14
+  802775:	41 55                	push   %r13
+  802777:	41 54                	push   %r12
+  802779:	53                   	push   %rbx
+  80277a:	48 83 ec 08          	sub    $0x8,%rsp
+  80277e:	49 89 fe             	mov    %rdi,%r14
+  802781:	49 89 f7             	mov    %rsi,%r15
+  802784:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802787:	48 89 f7             	mov    %rsi,%rdi
+  80278a:	48 b8 66 23 80 00 00 	movabs $0x802366,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+  802796:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802799:	48 89 de             	mov    %rbx,%rsi
+  80279c:	4c 89 f7             	mov    %r14,%rdi
+  80279f:	48 b8 81 23 80 00 00 	movabs $0x802381,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027ae:	48 39 c3             	cmp    %rax,%rbx
+  8027b1:	74 36                	je     8027e9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8027b3:	48 89 d8             	mov    %rbx,%rax
+  8027b6:	4c 29 e8             	sub    %r13,%rax
+  8027b9:	49 39 c4             	cmp    %rax,%r12
+  8027bc:	73 31                	jae    8027ef <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8027be:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8027c3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027c7:	4c 89 fe             	mov    %r15,%rsi
+  8027ca:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  8027d1:	00 00 00 
+  8027d4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8027d6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8027da:	48 83 c4 08          	add    $0x8,%rsp
+  8027de:	5b                   	pop    %rbx
+  8027df:	41 5c                	pop    %r12
+  8027e1:	41 5d                	pop    %r13
+  8027e3:	41 5e                	pop    %r14
+  8027e5:	41 5f                	pop    %r15
+  8027e7:	5d                   	pop    %rbp
+  8027e8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027e9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8027ed:	eb eb                	jmp    8027da <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8027ef:	48 83 eb 01          	sub    $0x1,%rbx
+  8027f3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027f7:	48 89 da             	mov    %rbx,%rdx
+  8027fa:	4c 89 fe             	mov    %r15,%rsi
+  8027fd:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802809:	49 01 de             	add    %rbx,%r14
+  80280c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802811:	eb c3                	jmp    8027d6 <strlcat+0x69>
+
+0000000000802813 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802813:	48 85 d2             	test   %rdx,%rdx
+  802816:	74 2d                	je     802845 <memcmp+0x32>
+  802818:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80281d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802821:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802826:	44 38 c1             	cmp    %r8b,%cl
+  802829:	75 0f                	jne    80283a <memcmp+0x27>
+    while (n-- > 0) {
+  80282b:	48 83 c0 01          	add    $0x1,%rax
+  80282f:	48 39 c2             	cmp    %rax,%rdx
+  802832:	75 e9                	jne    80281d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802834:	b8 00 00 00 00       	mov    $0x0,%eax
+  802839:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80283a:	0f b6 c1             	movzbl %cl,%eax
+  80283d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802841:	44 29 c0             	sub    %r8d,%eax
+  802844:	c3                   	ret
+    return 0;
+  802845:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80284a:	c3                   	ret
+
+000000000080284b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80284b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80284f:	48 39 c7             	cmp    %rax,%rdi
+  802852:	73 0f                	jae    802863 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802854:	40 38 37             	cmp    %sil,(%rdi)
+  802857:	74 0e                	je     802867 <memfind+0x1c>
+    for (; src < end; src++) {
+  802859:	48 83 c7 01          	add    $0x1,%rdi
+  80285d:	48 39 f8             	cmp    %rdi,%rax
+  802860:	75 f2                	jne    802854 <memfind+0x9>
+  802862:	c3                   	ret
+  802863:	48 89 f8             	mov    %rdi,%rax
+  802866:	c3                   	ret
+  802867:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80286a:	c3                   	ret
+
+000000000080286b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80286b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80286e:	0f b6 37             	movzbl (%rdi),%esi
+  802871:	40 80 fe 20          	cmp    $0x20,%sil
+  802875:	74 06                	je     80287d <strtol+0x12>
+  802877:	40 80 fe 09          	cmp    $0x9,%sil
+  80287b:	75 13                	jne    802890 <strtol+0x25>
+  80287d:	48 83 c7 01          	add    $0x1,%rdi
+  802881:	0f b6 37             	movzbl (%rdi),%esi
+  802884:	40 80 fe 20          	cmp    $0x20,%sil
+  802888:	74 f3                	je     80287d <strtol+0x12>
+  80288a:	40 80 fe 09          	cmp    $0x9,%sil
+  80288e:	74 ed                	je     80287d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802890:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802893:	83 e0 fd             	and    $0xfffffffd,%eax
+  802896:	3c 01                	cmp    $0x1,%al
+  802898:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80289c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8028a2:	75 0f                	jne    8028b3 <strtol+0x48>
+  8028a4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8028a7:	74 14                	je     8028bd <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8028a9:	85 d2                	test   %edx,%edx
+  8028ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8028b0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8028b3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8028b8:	4c 63 ca             	movslq %edx,%r9
+  8028bb:	eb 36                	jmp    8028f3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028bd:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8028c1:	74 0f                	je     8028d2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8028c3:	85 d2                	test   %edx,%edx
+  8028c5:	75 ec                	jne    8028b3 <strtol+0x48>
+        s++;
+  8028c7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8028cb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8028d0:	eb e1                	jmp    8028b3 <strtol+0x48>
+        s += 2;
+  8028d2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8028d6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8028db:	eb d6                	jmp    8028b3 <strtol+0x48>
+            dig -= '0';
+  8028dd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8028e0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8028e4:	41 39 d0             	cmp    %edx,%r8d
+  8028e7:	7d 21                	jge    80290a <strtol+0x9f>
+        val = val * base + dig;
+  8028e9:	49 0f af c1          	imul   %r9,%rax
+  8028ed:	0f b6 c9             	movzbl %cl,%ecx
+  8028f0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8028f3:	48 83 c7 01          	add    $0x1,%rdi
+  8028f7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8028fb:	80 f9 39             	cmp    $0x39,%cl
+  8028fe:	76 dd                	jbe    8028dd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802900:	80 f9 7b             	cmp    $0x7b,%cl
+  802903:	77 05                	ja     80290a <strtol+0x9f>
+            dig -= 'a' - 10;
+  802905:	83 e9 57             	sub    $0x57,%ecx
+  802908:	eb d6                	jmp    8028e0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80290a:	4d 85 d2             	test   %r10,%r10
+  80290d:	74 03                	je     802912 <strtol+0xa7>
+  80290f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802912:	48 89 c2             	mov    %rax,%rdx
+  802915:	48 f7 da             	neg    %rdx
+  802918:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80291c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802920:	c3                   	ret
+
+0000000000802921 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802921:	55                   	push   %rbp
+  802922:	48 89 e5             	mov    %rsp,%rbp
+  802925:	53                   	push   %rbx
+  802926:	48 89 fa             	mov    %rdi,%rdx
+  802929:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80292c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802931:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802936:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80293b:	be 00 00 00 00       	mov    $0x0,%esi
+  802940:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802946:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80294c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80294e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802952:	c9                   	leave
+  802953:	c3                   	ret
+
+0000000000802954 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802954:	55                   	push   %rbp
+  802955:	48 89 e5             	mov    %rsp,%rbp
+  802958:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802959:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80295e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802963:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802968:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80296d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802972:	be 00 00 00 00       	mov    $0x0,%esi
+  802977:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80297d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802983:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802985:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802989:	c9                   	leave
+  80298a:	c3                   	ret
+
+000000000080298b <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80298b:	55                   	push   %rbp
+  80298c:	48 89 e5             	mov    %rsp,%rbp
+  80298f:	53                   	push   %rbx
+  802990:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802993:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802998:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80299d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029b8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8029ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+
+00000000008029c0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	53                   	push   %rbx
+  8029c5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8029c9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029cc:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029f3:	48 85 c0             	test   %rax,%rax
+  8029f6:	7f 06                	jg     8029fe <sys_env_destroy+0x3e>
+}
+  8029f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029fc:	c9                   	leave
+  8029fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029fe:	49 89 c0             	mov    %rax,%r8
+  802a01:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802a06:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802a0d:	00 00 00 
+  802a10:	be 27 00 00 00       	mov    $0x27,%esi
+  802a15:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802a1c:	00 00 00 
+  802a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a24:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802a2b:	00 00 00 
+  802a2e:	41 ff d1             	call   *%r9
+
+0000000000802a31 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a31:	55                   	push   %rbp
+  802a32:	48 89 e5             	mov    %rsp,%rbp
+  802a35:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a36:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a40:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a4a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a5a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a60:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a66:	c9                   	leave
+  802a67:	c3                   	ret
+
+0000000000802a68 <sys_yield>:
+
+void
+sys_yield(void) {
+  802a68:	55                   	push   %rbp
+  802a69:	48 89 e5             	mov    %rsp,%rbp
+  802a6c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a6d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a77:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a81:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a86:	be 00 00 00 00       	mov    $0x0,%esi
+  802a8b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a91:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a97:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a9d:	c9                   	leave
+  802a9e:	c3                   	ret
+
+0000000000802a9f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a9f:	55                   	push   %rbp
+  802aa0:	48 89 e5             	mov    %rsp,%rbp
+  802aa3:	53                   	push   %rbx
+  802aa4:	48 89 fa             	mov    %rdi,%rdx
+  802aa7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802aaa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aaf:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802ab6:	00 00 00 
+  802ab9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802abe:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ac9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802acf:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802ad1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ad5:	c9                   	leave
+  802ad6:	c3                   	ret
+
+0000000000802ad7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802ad7:	55                   	push   %rbp
+  802ad8:	48 89 e5             	mov    %rsp,%rbp
+  802adb:	53                   	push   %rbx
+  802adc:	49 89 f8             	mov    %rdi,%r8
+  802adf:	48 89 d3             	mov    %rdx,%rbx
+  802ae2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802ae5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802aea:	4c 89 c2             	mov    %r8,%rdx
+  802aed:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802af0:	be 00 00 00 00       	mov    $0x0,%esi
+  802af5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802afb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b01:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802b03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b07:	c9                   	leave
+  802b08:	c3                   	ret
+
+0000000000802b09 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802b09:	55                   	push   %rbp
+  802b0a:	48 89 e5             	mov    %rsp,%rbp
+  802b0d:	53                   	push   %rbx
+  802b0e:	48 83 ec 08          	sub    $0x8,%rsp
+  802b12:	89 f8                	mov    %edi,%eax
+  802b14:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802b17:	48 63 f9             	movslq %ecx,%rdi
+  802b1a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b1d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b22:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b25:	be 00 00 00 00       	mov    $0x0,%esi
+  802b2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b30:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b36:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b38:	48 85 c0             	test   %rax,%rax
+  802b3b:	7f 06                	jg     802b43 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b43:	49 89 c0             	mov    %rax,%r8
+  802b46:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b4b:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802b52:	00 00 00 
+  802b55:	be 27 00 00 00       	mov    $0x27,%esi
+  802b5a:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802b61:	00 00 00 
+  802b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b69:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802b70:	00 00 00 
+  802b73:	41 ff d1             	call   *%r9
+
+0000000000802b76 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802b76:	55                   	push   %rbp
+  802b77:	48 89 e5             	mov    %rsp,%rbp
+  802b7a:	53                   	push   %rbx
+  802b7b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b7f:	89 f8                	mov    %edi,%eax
+  802b81:	49 89 f2             	mov    %rsi,%r10
+  802b84:	48 89 cf             	mov    %rcx,%rdi
+  802b87:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b8a:	48 63 da             	movslq %edx,%rbx
+  802b8d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b90:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b95:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b98:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b9b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ba1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ba3:	48 85 c0             	test   %rax,%rax
+  802ba6:	7f 06                	jg     802bae <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802ba8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bac:	c9                   	leave
+  802bad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bae:	49 89 c0             	mov    %rax,%r8
+  802bb1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802bb6:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802bbd:	00 00 00 
+  802bc0:	be 27 00 00 00       	mov    $0x27,%esi
+  802bc5:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802bcc:	00 00 00 
+  802bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd4:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802bdb:	00 00 00 
+  802bde:	41 ff d1             	call   *%r9
+
+0000000000802be1 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802be1:	55                   	push   %rbp
+  802be2:	48 89 e5             	mov    %rsp,%rbp
+  802be5:	53                   	push   %rbx
+  802be6:	48 83 ec 08          	sub    $0x8,%rsp
+  802bea:	48 89 f1             	mov    %rsi,%rcx
+  802bed:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802bf0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bf3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bf8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bfd:	be 00 00 00 00       	mov    $0x0,%esi
+  802c02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c0e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c10:	48 85 c0             	test   %rax,%rax
+  802c13:	7f 06                	jg     802c1b <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802c15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c19:	c9                   	leave
+  802c1a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c1b:	49 89 c0             	mov    %rax,%r8
+  802c1e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c23:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802c2a:	00 00 00 
+  802c2d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c32:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802c39:	00 00 00 
+  802c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c41:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802c48:	00 00 00 
+  802c4b:	41 ff d1             	call   *%r9
+
+0000000000802c4e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c4e:	55                   	push   %rbp
+  802c4f:	48 89 e5             	mov    %rsp,%rbp
+  802c52:	53                   	push   %rbx
+  802c53:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c57:	48 63 ce             	movslq %esi,%rcx
+  802c5a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c5d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c67:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c7d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c7f:	48 85 c0             	test   %rax,%rax
+  802c82:	7f 06                	jg     802c8a <sys_env_set_status+0x3c>
+}
+  802c84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c88:	c9                   	leave
+  802c89:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c8a:	49 89 c0             	mov    %rax,%r8
+  802c8d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c92:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802c99:	00 00 00 
+  802c9c:	be 27 00 00 00       	mov    $0x27,%esi
+  802ca1:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802ca8:	00 00 00 
+  802cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb0:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802cb7:	00 00 00 
+  802cba:	41 ff d1             	call   *%r9
+
+0000000000802cbd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802cbd:	55                   	push   %rbp
+  802cbe:	48 89 e5             	mov    %rsp,%rbp
+  802cc1:	53                   	push   %rbx
+  802cc2:	48 83 ec 08          	sub    $0x8,%rsp
+  802cc6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802cc9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ccc:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cd6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cdb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ce6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cee:	48 85 c0             	test   %rax,%rax
+  802cf1:	7f 06                	jg     802cf9 <sys_env_set_trapframe+0x3c>
+}
+  802cf3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cf7:	c9                   	leave
+  802cf8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cf9:	49 89 c0             	mov    %rax,%r8
+  802cfc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802d01:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802d08:	00 00 00 
+  802d0b:	be 27 00 00 00       	mov    $0x27,%esi
+  802d10:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802d17:	00 00 00 
+  802d1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1f:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802d26:	00 00 00 
+  802d29:	41 ff d1             	call   *%r9
+
+0000000000802d2c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802d2c:	55                   	push   %rbp
+  802d2d:	48 89 e5             	mov    %rsp,%rbp
+  802d30:	53                   	push   %rbx
+  802d31:	48 83 ec 08          	sub    $0x8,%rsp
+  802d35:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d38:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d3b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d5b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d5d:	48 85 c0             	test   %rax,%rax
+  802d60:	7f 06                	jg     802d68 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802d62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d66:	c9                   	leave
+  802d67:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d68:	49 89 c0             	mov    %rax,%r8
+  802d6b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802d70:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802d77:	00 00 00 
+  802d7a:	be 27 00 00 00       	mov    $0x27,%esi
+  802d7f:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802d86:	00 00 00 
+  802d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8e:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802d95:	00 00 00 
+  802d98:	41 ff d1             	call   *%r9
+
+0000000000802d9b <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d9b:	55                   	push   %rbp
+  802d9c:	48 89 e5             	mov    %rsp,%rbp
+  802d9f:	53                   	push   %rbx
+  802da0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802da4:	40 0f b6 ce          	movzbl %sil,%ecx
+  802da8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dab:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802db0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802db5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dba:	be 00 00 00 00       	mov    $0x0,%esi
+  802dbf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dc5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dcb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dcd:	48 85 c0             	test   %rax,%rax
+  802dd0:	7f 06                	jg     802dd8 <sys_env_set_reclaim+0x3d>
+}
+  802dd2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dd6:	c9                   	leave
+  802dd7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dd8:	49 89 c0             	mov    %rax,%r8
+  802ddb:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802de0:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802de7:	00 00 00 
+  802dea:	be 27 00 00 00       	mov    $0x27,%esi
+  802def:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802df6:	00 00 00 
+  802df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfe:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802e05:	00 00 00 
+  802e08:	41 ff d1             	call   *%r9
+
+0000000000802e0b <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802e0b:	55                   	push   %rbp
+  802e0c:	48 89 e5             	mov    %rsp,%rbp
+  802e0f:	53                   	push   %rbx
+  802e10:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802e14:	48 63 ce             	movslq %esi,%rcx
+  802e17:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e1a:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e24:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e29:	be 00 00 00 00       	mov    $0x0,%esi
+  802e2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e3a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e3c:	48 85 c0             	test   %rax,%rax
+  802e3f:	7f 06                	jg     802e47 <sys_env_set_nice+0x3c>
+}
+  802e41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e45:	c9                   	leave
+  802e46:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e47:	49 89 c0             	mov    %rax,%r8
+  802e4a:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e4f:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802e56:	00 00 00 
+  802e59:	be 27 00 00 00       	mov    $0x27,%esi
+  802e5e:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802e65:	00 00 00 
+  802e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6d:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802e74:	00 00 00 
+  802e77:	41 ff d1             	call   *%r9
+
+0000000000802e7a <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802e7a:	55                   	push   %rbp
+  802e7b:	48 89 e5             	mov    %rsp,%rbp
+  802e7e:	53                   	push   %rbx
+  802e7f:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e82:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e87:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e91:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e96:	be 00 00 00 00       	mov    $0x0,%esi
+  802e9b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ea1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ea7:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ea9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ead:	c9                   	leave
+  802eae:	c3                   	ret
+
+0000000000802eaf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802eaf:	55                   	push   %rbp
+  802eb0:	48 89 e5             	mov    %rsp,%rbp
+  802eb3:	53                   	push   %rbx
+  802eb4:	89 f8                	mov    %edi,%eax
+  802eb6:	49 89 f1             	mov    %rsi,%r9
+  802eb9:	48 89 d3             	mov    %rdx,%rbx
+  802ebc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ebf:	49 63 f0             	movslq %r8d,%rsi
+  802ec2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ec5:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802eca:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ecd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ed3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ed9:	cd 30                	int    $0x30
+}
+  802edb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802edf:	c9                   	leave
+  802ee0:	c3                   	ret
+
+0000000000802ee1 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ee1:	55                   	push   %rbp
+  802ee2:	48 89 e5             	mov    %rsp,%rbp
+  802ee5:	53                   	push   %rbx
+  802ee6:	89 f8                	mov    %edi,%eax
+  802ee8:	49 89 f1             	mov    %rsi,%r9
+  802eeb:	48 89 d3             	mov    %rdx,%rbx
+  802eee:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ef1:	49 63 f0             	movslq %r8d,%rsi
+  802ef4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ef7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802efc:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f0b:	cd 30                	int    $0x30
+}
+  802f0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f11:	c9                   	leave
+  802f12:	c3                   	ret
+
+0000000000802f13 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f13:	55                   	push   %rbp
+  802f14:	48 89 e5             	mov    %rsp,%rbp
+  802f17:	53                   	push   %rbx
+  802f18:	48 83 ec 08          	sub    $0x8,%rsp
+  802f1c:	89 f8                	mov    %edi,%eax
+  802f1e:	49 89 f2             	mov    %rsi,%r10
+  802f21:	48 89 d3             	mov    %rdx,%rbx
+  802f24:	48 89 cf             	mov    %rcx,%rdi
+  802f27:	44 89 c6             	mov    %r8d,%esi
+  802f2a:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f2d:	48 63 f6             	movslq %esi,%rsi
+  802f30:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f33:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f38:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f3b:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f3f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f41:	48 85 c0             	test   %rax,%rax
+  802f44:	7f 06                	jg     802f4c <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f4a:	c9                   	leave
+  802f4b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f4c:	49 89 c0             	mov    %rax,%r8
+  802f4f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f54:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802f5b:	00 00 00 
+  802f5e:	be 27 00 00 00       	mov    $0x27,%esi
+  802f63:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802f6a:	00 00 00 
+  802f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f72:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802f79:	00 00 00 
+  802f7c:	41 ff d1             	call   *%r9
+
+0000000000802f7f <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802f7f:	55                   	push   %rbp
+  802f80:	48 89 e5             	mov    %rsp,%rbp
+  802f83:	53                   	push   %rbx
+  802f84:	48 83 ec 08          	sub    $0x8,%rsp
+  802f88:	48 89 f1             	mov    %rsi,%rcx
+  802f8b:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f8e:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f92:	48 8b 1a             	mov    (%rdx),%rbx
+  802f95:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f98:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f9d:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fa1:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802fa5:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802fa9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fab:	48 85 c0             	test   %rax,%rax
+  802fae:	7f 06                	jg     802fb6 <sys_ipc_call_short+0x37>
+}
+  802fb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fb4:	c9                   	leave
+  802fb5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802fb6:	49 89 c0             	mov    %rax,%r8
+  802fb9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802fbe:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  802fc5:	00 00 00 
+  802fc8:	be 27 00 00 00       	mov    $0x27,%esi
+  802fcd:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  802fd4:	00 00 00 
+  802fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdc:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  802fe3:	00 00 00 
+  802fe6:	41 ff d1             	call   *%r9
+
+0000000000802fe9 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802fe9:	55                   	push   %rbp
+  802fea:	48 89 e5             	mov    %rsp,%rbp
+  802fed:	53                   	push   %rbx
+  802fee:	48 83 ec 08          	sub    $0x8,%rsp
+  802ff2:	89 f8                	mov    %edi,%eax
+  802ff4:	49 89 f2             	mov    %rsi,%r10
+  802ff7:	48 89 d3             	mov    %rdx,%rbx
+  802ffa:	48 89 cf             	mov    %rcx,%rdi
+  802ffd:	44 89 c6             	mov    %r8d,%esi
+  803000:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803003:	48 63 f6             	movslq %esi,%rsi
+  803006:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803009:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80300e:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803011:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803015:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803017:	48 85 c0             	test   %rax,%rax
+  80301a:	7f 06                	jg     803022 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80301c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803020:	c9                   	leave
+  803021:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803022:	49 89 c0             	mov    %rax,%r8
+  803025:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80302a:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  803031:	00 00 00 
+  803034:	be 27 00 00 00       	mov    $0x27,%esi
+  803039:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  803040:	00 00 00 
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  80304f:	00 00 00 
+  803052:	41 ff d1             	call   *%r9
+
+0000000000803055 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803055:	55                   	push   %rbp
+  803056:	48 89 e5             	mov    %rsp,%rbp
+  803059:	53                   	push   %rbx
+  80305a:	48 83 ec 08          	sub    $0x8,%rsp
+  80305e:	48 89 fa             	mov    %rdi,%rdx
+  803061:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803064:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803069:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80306e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803073:	be 00 00 00 00       	mov    $0x0,%esi
+  803078:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80307e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803084:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803086:	48 85 c0             	test   %rax,%rax
+  803089:	7f 06                	jg     803091 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80308b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80308f:	c9                   	leave
+  803090:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803091:	49 89 c0             	mov    %rax,%r8
+  803094:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803099:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  8030a0:	00 00 00 
+  8030a3:	be 27 00 00 00       	mov    $0x27,%esi
+  8030a8:	48 bf 87 67 80 00 00 	movabs $0x806787,%rdi
+  8030af:	00 00 00 
+  8030b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b7:	49 b9 1d 19 80 00 00 	movabs $0x80191d,%r9
+  8030be:	00 00 00 
+  8030c1:	41 ff d1             	call   *%r9
+
+00000000008030c4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8030c4:	55                   	push   %rbp
+  8030c5:	48 89 e5             	mov    %rsp,%rbp
+  8030c8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030c9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030f3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030f9:	c9                   	leave
+  8030fa:	c3                   	ret
+
+00000000008030fb <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8030fb:	55                   	push   %rbp
+  8030fc:	48 89 e5             	mov    %rsp,%rbp
+  8030ff:	53                   	push   %rbx
+  803100:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803103:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803108:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80310d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803112:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803117:	be 00 00 00 00       	mov    $0x0,%esi
+  80311c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803122:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803128:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  80312a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80312e:	c9                   	leave
+  80312f:	c3                   	ret
+
+0000000000803130 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803130:	55                   	push   %rbp
+  803131:	48 89 e5             	mov    %rsp,%rbp
+  803134:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803135:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80313a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803144:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803149:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80314e:	be 00 00 00 00       	mov    $0x0,%esi
+  803153:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803159:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80315f:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803161:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803165:	c9                   	leave
+  803166:	c3                   	ret
+
+0000000000803167 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  803167:	55                   	push   %rbp
+  803168:	48 89 e5             	mov    %rsp,%rbp
+  80316b:	53                   	push   %rbx
+  80316c:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803170:	b8 08 00 00 00       	mov    $0x8,%eax
+  803175:	cd 30                	int    $0x30
+  803177:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  803179:	85 c0                	test   %eax,%eax
+  80317b:	0f 88 85 00 00 00    	js     803206 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803181:	0f 84 ac 00 00 00    	je     803233 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  803187:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80318d:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  803194:	00 00 00 
+  803197:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80319c:	89 c2                	mov    %eax,%edx
+  80319e:	be 00 00 00 00       	mov    $0x0,%esi
+  8031a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a8:	48 b8 76 2b 80 00 00 	movabs $0x802b76,%rax
+  8031af:	00 00 00 
+  8031b2:	ff d0                	call   *%rax
+  8031b4:	85 c0                	test   %eax,%eax
+  8031b6:	0f 88 a8 00 00 00    	js     803264 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8031bc:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031c3:	00 00 00 
+  8031c6:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  8031cd:	89 df                	mov    %ebx,%edi
+  8031cf:	48 b8 2c 2d 80 00 00 	movabs $0x802d2c,%rax
+  8031d6:	00 00 00 
+  8031d9:	ff d0                	call   *%rax
+  8031db:	85 c0                	test   %eax,%eax
+  8031dd:	0f 88 ae 00 00 00    	js     803291 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8031e3:	be 02 00 00 00       	mov    $0x2,%esi
+  8031e8:	89 df                	mov    %ebx,%edi
+  8031ea:	48 b8 4e 2c 80 00 00 	movabs $0x802c4e,%rax
+  8031f1:	00 00 00 
+  8031f4:	ff d0                	call   *%rax
+  8031f6:	85 c0                	test   %eax,%eax
+  8031f8:	0f 88 c0 00 00 00    	js     8032be <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  8031fe:	89 d8                	mov    %ebx,%eax
+  803200:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803204:	c9                   	leave
+  803205:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803206:	89 c1                	mov    %eax,%ecx
+  803208:	48 ba 95 67 80 00 00 	movabs $0x806795,%rdx
+  80320f:	00 00 00 
+  803212:	be 20 00 00 00       	mov    $0x20,%esi
+  803217:	48 bf a5 67 80 00 00 	movabs $0x8067a5,%rdi
+  80321e:	00 00 00 
+  803221:	b8 00 00 00 00       	mov    $0x0,%eax
+  803226:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  80322d:	00 00 00 
+  803230:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803233:	48 b8 31 2a 80 00 00 	movabs $0x802a31,%rax
+  80323a:	00 00 00 
+  80323d:	ff d0                	call   *%rax
+  80323f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803244:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80324b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803252:	00 00 00 
+  803255:	48 01 d0             	add    %rdx,%rax
+  803258:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80325f:	00 00 00 
+        return 0;
+  803262:	eb 9a                	jmp    8031fe <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803264:	89 c1                	mov    %eax,%ecx
+  803266:	48 ba b0 67 80 00 00 	movabs $0x8067b0,%rdx
+  80326d:	00 00 00 
+  803270:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803275:	48 bf a5 67 80 00 00 	movabs $0x8067a5,%rdi
+  80327c:	00 00 00 
+  80327f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803284:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  80328b:	00 00 00 
+  80328e:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803291:	89 c1                	mov    %eax,%ecx
+  803293:	48 ba f8 67 80 00 00 	movabs $0x8067f8,%rdx
+  80329a:	00 00 00 
+  80329d:	be 32 00 00 00       	mov    $0x32,%esi
+  8032a2:	48 bf a5 67 80 00 00 	movabs $0x8067a5,%rdi
+  8032a9:	00 00 00 
+  8032ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b1:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  8032b8:	00 00 00 
+  8032bb:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8032be:	89 c1                	mov    %eax,%ecx
+  8032c0:	48 ba c3 67 80 00 00 	movabs $0x8067c3,%rdx
+  8032c7:	00 00 00 
+  8032ca:	be 37 00 00 00       	mov    $0x37,%esi
+  8032cf:	48 bf a5 67 80 00 00 	movabs $0x8067a5,%rdi
+  8032d6:	00 00 00 
+  8032d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032de:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  8032e5:	00 00 00 
+  8032e8:	41 ff d0             	call   *%r8
+
+00000000008032eb <sfork>:
+
+envid_t
+sfork() {
+  8032eb:	55                   	push   %rbp
+  8032ec:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8032ef:	48 ba da 67 80 00 00 	movabs $0x8067da,%rdx
+  8032f6:	00 00 00 
+  8032f9:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8032fe:	48 bf a5 67 80 00 00 	movabs $0x8067a5,%rdi
+  803305:	00 00 00 
+  803308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330d:	48 b9 1d 19 80 00 00 	movabs $0x80191d,%rcx
+  803314:	00 00 00 
+  803317:	ff d1                	call   *%rcx
+
+0000000000803319 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803319:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803320:	ff ff ff 
+  803323:	48 01 f8             	add    %rdi,%rax
+  803326:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80332a:	c3                   	ret
+
+000000000080332b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80332b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803332:	ff ff ff 
+  803335:	48 01 f8             	add    %rdi,%rax
+  803338:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80333c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803342:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803346:	c3                   	ret
+
+0000000000803347 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803347:	55                   	push   %rbp
+  803348:	48 89 e5             	mov    %rsp,%rbp
+  80334b:	41 57                	push   %r15
+  80334d:	41 56                	push   %r14
+  80334f:	41 55                	push   %r13
+  803351:	41 54                	push   %r12
+  803353:	53                   	push   %rbx
+  803354:	48 83 ec 08          	sub    $0x8,%rsp
+  803358:	49 89 ff             	mov    %rdi,%r15
+  80335b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803360:	49 bd 47 48 80 00 00 	movabs $0x804847,%r13
+  803367:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80336a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803370:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803373:	48 89 df             	mov    %rbx,%rdi
+  803376:	41 ff d5             	call   *%r13
+  803379:	83 e0 04             	and    $0x4,%eax
+  80337c:	74 17                	je     803395 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80337e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803385:	4c 39 f3             	cmp    %r14,%rbx
+  803388:	75 e6                	jne    803370 <fd_alloc+0x29>
+  80338a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803390:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803395:	4d 89 27             	mov    %r12,(%r15)
+}
+  803398:	48 83 c4 08          	add    $0x8,%rsp
+  80339c:	5b                   	pop    %rbx
+  80339d:	41 5c                	pop    %r12
+  80339f:	41 5d                	pop    %r13
+  8033a1:	41 5e                	pop    %r14
+  8033a3:	41 5f                	pop    %r15
+  8033a5:	5d                   	pop    %rbp
+  8033a6:	c3                   	ret
+
+00000000008033a7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8033a7:	83 ff 1f             	cmp    $0x1f,%edi
+  8033aa:	77 39                	ja     8033e5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8033ac:	55                   	push   %rbp
+  8033ad:	48 89 e5             	mov    %rsp,%rbp
+  8033b0:	41 54                	push   %r12
+  8033b2:	53                   	push   %rbx
+  8033b3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8033b6:	48 63 df             	movslq %edi,%rbx
+  8033b9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8033c0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8033c4:	48 89 df             	mov    %rbx,%rdi
+  8033c7:	48 b8 47 48 80 00 00 	movabs $0x804847,%rax
+  8033ce:	00 00 00 
+  8033d1:	ff d0                	call   *%rax
+  8033d3:	a8 04                	test   $0x4,%al
+  8033d5:	74 14                	je     8033eb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8033d7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8033db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033e0:	5b                   	pop    %rbx
+  8033e1:	41 5c                	pop    %r12
+  8033e3:	5d                   	pop    %rbp
+  8033e4:	c3                   	ret
+        return -E_INVAL;
+  8033e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8033ea:	c3                   	ret
+        return -E_INVAL;
+  8033eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033f0:	eb ee                	jmp    8033e0 <fd_lookup+0x39>
+
+00000000008033f2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8033f2:	55                   	push   %rbp
+  8033f3:	48 89 e5             	mov    %rsp,%rbp
+  8033f6:	41 54                	push   %r12
+  8033f8:	53                   	push   %rbx
+  8033f9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8033fc:	48 b8 a0 68 80 00 00 	movabs $0x8068a0,%rax
+  803403:	00 00 00 
+  803406:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  80340d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803410:	39 3b                	cmp    %edi,(%rbx)
+  803412:	74 47                	je     80345b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803414:	48 83 c0 08          	add    $0x8,%rax
+  803418:	48 8b 18             	mov    (%rax),%rbx
+  80341b:	48 85 db             	test   %rbx,%rbx
+  80341e:	75 f0                	jne    803410 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803420:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803427:	00 00 00 
+  80342a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803430:	89 fa                	mov    %edi,%edx
+  803432:	48 bf 18 68 80 00 00 	movabs $0x806818,%rdi
+  803439:	00 00 00 
+  80343c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803441:	48 b9 6d 1a 80 00 00 	movabs $0x801a6d,%rcx
+  803448:	00 00 00 
+  80344b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80344d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803452:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803456:	5b                   	pop    %rbx
+  803457:	41 5c                	pop    %r12
+  803459:	5d                   	pop    %rbp
+  80345a:	c3                   	ret
+            return 0;
+  80345b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803460:	eb f0                	jmp    803452 <dev_lookup+0x60>
+
+0000000000803462 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803462:	55                   	push   %rbp
+  803463:	48 89 e5             	mov    %rsp,%rbp
+  803466:	41 55                	push   %r13
+  803468:	41 54                	push   %r12
+  80346a:	53                   	push   %rbx
+  80346b:	48 83 ec 18          	sub    $0x18,%rsp
+  80346f:	48 89 fb             	mov    %rdi,%rbx
+  803472:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803475:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80347c:	ff ff ff 
+  80347f:	48 01 df             	add    %rbx,%rdi
+  803482:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803486:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80348a:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  803491:	00 00 00 
+  803494:	ff d0                	call   *%rax
+  803496:	41 89 c5             	mov    %eax,%r13d
+  803499:	85 c0                	test   %eax,%eax
+  80349b:	78 06                	js     8034a3 <fd_close+0x41>
+  80349d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8034a1:	74 1a                	je     8034bd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8034a3:	45 84 e4             	test   %r12b,%r12b
+  8034a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ab:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8034af:	44 89 e8             	mov    %r13d,%eax
+  8034b2:	48 83 c4 18          	add    $0x18,%rsp
+  8034b6:	5b                   	pop    %rbx
+  8034b7:	41 5c                	pop    %r12
+  8034b9:	41 5d                	pop    %r13
+  8034bb:	5d                   	pop    %rbp
+  8034bc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034bd:	8b 3b                	mov    (%rbx),%edi
+  8034bf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034c3:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+  8034cf:	41 89 c5             	mov    %eax,%r13d
+  8034d2:	85 c0                	test   %eax,%eax
+  8034d4:	78 1b                	js     8034f1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8034d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034da:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034de:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8034e4:	48 85 c0             	test   %rax,%rax
+  8034e7:	74 08                	je     8034f1 <fd_close+0x8f>
+  8034e9:	48 89 df             	mov    %rbx,%rdi
+  8034ec:	ff d0                	call   *%rax
+  8034ee:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8034f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034f6:	48 89 de             	mov    %rbx,%rsi
+  8034f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034fe:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  803505:	00 00 00 
+  803508:	ff d0                	call   *%rax
+    return res;
+  80350a:	eb a3                	jmp    8034af <fd_close+0x4d>
+
+000000000080350c <close>:
+
+int
+close(int fdnum) {
+  80350c:	55                   	push   %rbp
+  80350d:	48 89 e5             	mov    %rsp,%rbp
+  803510:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803514:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803518:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803524:	85 c0                	test   %eax,%eax
+  803526:	78 15                	js     80353d <close+0x31>
+
+    return fd_close(fd, 1);
+  803528:	be 01 00 00 00       	mov    $0x1,%esi
+  80352d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803531:	48 b8 62 34 80 00 00 	movabs $0x803462,%rax
+  803538:	00 00 00 
+  80353b:	ff d0                	call   *%rax
+}
+  80353d:	c9                   	leave
+  80353e:	c3                   	ret
+
+000000000080353f <close_all>:
+
+void
+close_all(void) {
+  80353f:	55                   	push   %rbp
+  803540:	48 89 e5             	mov    %rsp,%rbp
+  803543:	41 54                	push   %r12
+  803545:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803546:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80354b:	49 bc 0c 35 80 00 00 	movabs $0x80350c,%r12
+  803552:	00 00 00 
+  803555:	89 df                	mov    %ebx,%edi
+  803557:	41 ff d4             	call   *%r12
+  80355a:	83 c3 01             	add    $0x1,%ebx
+  80355d:	83 fb 20             	cmp    $0x20,%ebx
+  803560:	75 f3                	jne    803555 <close_all+0x16>
+}
+  803562:	5b                   	pop    %rbx
+  803563:	41 5c                	pop    %r12
+  803565:	5d                   	pop    %rbp
+  803566:	c3                   	ret
+
+0000000000803567 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803567:	55                   	push   %rbp
+  803568:	48 89 e5             	mov    %rsp,%rbp
+  80356b:	41 57                	push   %r15
+  80356d:	41 56                	push   %r14
+  80356f:	41 55                	push   %r13
+  803571:	41 54                	push   %r12
+  803573:	53                   	push   %rbx
+  803574:	48 83 ec 18          	sub    $0x18,%rsp
+  803578:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80357b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80357f:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  803586:	00 00 00 
+  803589:	ff d0                	call   *%rax
+  80358b:	89 c3                	mov    %eax,%ebx
+  80358d:	85 c0                	test   %eax,%eax
+  80358f:	0f 88 b8 00 00 00    	js     80364d <dup+0xe6>
+    close(newfdnum);
+  803595:	44 89 e7             	mov    %r12d,%edi
+  803598:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  80359f:	00 00 00 
+  8035a2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8035a4:	4d 63 ec             	movslq %r12d,%r13
+  8035a7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8035ae:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8035b2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8035b6:	4c 89 ff             	mov    %r15,%rdi
+  8035b9:	49 be 2b 33 80 00 00 	movabs $0x80332b,%r14
+  8035c0:	00 00 00 
+  8035c3:	41 ff d6             	call   *%r14
+  8035c6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8035c9:	4c 89 ef             	mov    %r13,%rdi
+  8035cc:	41 ff d6             	call   *%r14
+  8035cf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8035d2:	48 89 df             	mov    %rbx,%rdi
+  8035d5:	48 b8 47 48 80 00 00 	movabs $0x804847,%rax
+  8035dc:	00 00 00 
+  8035df:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8035e1:	a8 04                	test   $0x4,%al
+  8035e3:	74 2b                	je     803610 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8035e5:	41 89 c1             	mov    %eax,%r9d
+  8035e8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035ee:	4c 89 f1             	mov    %r14,%rcx
+  8035f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f6:	48 89 de             	mov    %rbx,%rsi
+  8035f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035fe:	48 b8 76 2b 80 00 00 	movabs $0x802b76,%rax
+  803605:	00 00 00 
+  803608:	ff d0                	call   *%rax
+  80360a:	89 c3                	mov    %eax,%ebx
+  80360c:	85 c0                	test   %eax,%eax
+  80360e:	78 4e                	js     80365e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803610:	4c 89 ff             	mov    %r15,%rdi
+  803613:	48 b8 47 48 80 00 00 	movabs $0x804847,%rax
+  80361a:	00 00 00 
+  80361d:	ff d0                	call   *%rax
+  80361f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803622:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803628:	4c 89 e9             	mov    %r13,%rcx
+  80362b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803630:	4c 89 fe             	mov    %r15,%rsi
+  803633:	bf 00 00 00 00       	mov    $0x0,%edi
+  803638:	48 b8 76 2b 80 00 00 	movabs $0x802b76,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+  803644:	89 c3                	mov    %eax,%ebx
+  803646:	85 c0                	test   %eax,%eax
+  803648:	78 14                	js     80365e <dup+0xf7>
+
+    return newfdnum;
+  80364a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80364d:	89 d8                	mov    %ebx,%eax
+  80364f:	48 83 c4 18          	add    $0x18,%rsp
+  803653:	5b                   	pop    %rbx
+  803654:	41 5c                	pop    %r12
+  803656:	41 5d                	pop    %r13
+  803658:	41 5e                	pop    %r14
+  80365a:	41 5f                	pop    %r15
+  80365c:	5d                   	pop    %rbp
+  80365d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80365e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803663:	4c 89 ee             	mov    %r13,%rsi
+  803666:	bf 00 00 00 00       	mov    $0x0,%edi
+  80366b:	49 bc e1 2b 80 00 00 	movabs $0x802be1,%r12
+  803672:	00 00 00 
+  803675:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803678:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80367d:	4c 89 f6             	mov    %r14,%rsi
+  803680:	bf 00 00 00 00       	mov    $0x0,%edi
+  803685:	41 ff d4             	call   *%r12
+    return res;
+  803688:	eb c3                	jmp    80364d <dup+0xe6>
+
+000000000080368a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	41 56                	push   %r14
+  803690:	41 55                	push   %r13
+  803692:	41 54                	push   %r12
+  803694:	53                   	push   %rbx
+  803695:	48 83 ec 10          	sub    $0x10,%rsp
+  803699:	89 fb                	mov    %edi,%ebx
+  80369b:	49 89 f4             	mov    %rsi,%r12
+  80369e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036a1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036a5:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	85 c0                	test   %eax,%eax
+  8036b3:	78 4c                	js     803701 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036b5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8036b9:	41 8b 3e             	mov    (%r14),%edi
+  8036bc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036c0:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  8036c7:	00 00 00 
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	85 c0                	test   %eax,%eax
+  8036ce:	78 35                	js     803705 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8036d0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8036d4:	83 e0 03             	and    $0x3,%eax
+  8036d7:	83 f8 01             	cmp    $0x1,%eax
+  8036da:	74 2d                	je     803709 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036e0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8036e4:	48 85 c0             	test   %rax,%rax
+  8036e7:	74 56                	je     80373f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8036e9:	4c 89 ea             	mov    %r13,%rdx
+  8036ec:	4c 89 e6             	mov    %r12,%rsi
+  8036ef:	4c 89 f7             	mov    %r14,%rdi
+  8036f2:	ff d0                	call   *%rax
+}
+  8036f4:	48 83 c4 10          	add    $0x10,%rsp
+  8036f8:	5b                   	pop    %rbx
+  8036f9:	41 5c                	pop    %r12
+  8036fb:	41 5d                	pop    %r13
+  8036fd:	41 5e                	pop    %r14
+  8036ff:	5d                   	pop    %rbp
+  803700:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803701:	48 98                	cltq
+  803703:	eb ef                	jmp    8036f4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803705:	48 98                	cltq
+  803707:	eb eb                	jmp    8036f4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803709:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803710:	00 00 00 
+  803713:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803719:	89 da                	mov    %ebx,%edx
+  80371b:	48 bf 59 68 80 00 00 	movabs $0x806859,%rdi
+  803722:	00 00 00 
+  803725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372a:	48 b9 6d 1a 80 00 00 	movabs $0x801a6d,%rcx
+  803731:	00 00 00 
+  803734:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803736:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80373d:	eb b5                	jmp    8036f4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80373f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803746:	eb ac                	jmp    8036f4 <read+0x6a>
+
+0000000000803748 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803748:	55                   	push   %rbp
+  803749:	48 89 e5             	mov    %rsp,%rbp
+  80374c:	41 57                	push   %r15
+  80374e:	41 56                	push   %r14
+  803750:	41 55                	push   %r13
+  803752:	41 54                	push   %r12
+  803754:	53                   	push   %rbx
+  803755:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803759:	48 85 d2             	test   %rdx,%rdx
+  80375c:	74 54                	je     8037b2 <readn+0x6a>
+  80375e:	41 89 fd             	mov    %edi,%r13d
+  803761:	49 89 f6             	mov    %rsi,%r14
+  803764:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803767:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80376c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803771:	49 bf 8a 36 80 00 00 	movabs $0x80368a,%r15
+  803778:	00 00 00 
+  80377b:	4c 89 e2             	mov    %r12,%rdx
+  80377e:	48 29 f2             	sub    %rsi,%rdx
+  803781:	4c 01 f6             	add    %r14,%rsi
+  803784:	44 89 ef             	mov    %r13d,%edi
+  803787:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80378a:	85 c0                	test   %eax,%eax
+  80378c:	78 20                	js     8037ae <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80378e:	01 c3                	add    %eax,%ebx
+  803790:	85 c0                	test   %eax,%eax
+  803792:	74 08                	je     80379c <readn+0x54>
+  803794:	48 63 f3             	movslq %ebx,%rsi
+  803797:	4c 39 e6             	cmp    %r12,%rsi
+  80379a:	72 df                	jb     80377b <readn+0x33>
+    }
+    return res;
+  80379c:	48 63 c3             	movslq %ebx,%rax
+}
+  80379f:	48 83 c4 08          	add    $0x8,%rsp
+  8037a3:	5b                   	pop    %rbx
+  8037a4:	41 5c                	pop    %r12
+  8037a6:	41 5d                	pop    %r13
+  8037a8:	41 5e                	pop    %r14
+  8037aa:	41 5f                	pop    %r15
+  8037ac:	5d                   	pop    %rbp
+  8037ad:	c3                   	ret
+        if (inc < 0) return inc;
+  8037ae:	48 98                	cltq
+  8037b0:	eb ed                	jmp    80379f <readn+0x57>
+    int inc = 1, res = 0;
+  8037b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037b7:	eb e3                	jmp    80379c <readn+0x54>
+
+00000000008037b9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8037b9:	55                   	push   %rbp
+  8037ba:	48 89 e5             	mov    %rsp,%rbp
+  8037bd:	41 56                	push   %r14
+  8037bf:	41 55                	push   %r13
+  8037c1:	41 54                	push   %r12
+  8037c3:	53                   	push   %rbx
+  8037c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8037c8:	89 fb                	mov    %edi,%ebx
+  8037ca:	49 89 f4             	mov    %rsi,%r12
+  8037cd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037d0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037d4:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  8037db:	00 00 00 
+  8037de:	ff d0                	call   *%rax
+  8037e0:	85 c0                	test   %eax,%eax
+  8037e2:	78 47                	js     80382b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037e4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8037e8:	41 8b 3e             	mov    (%r14),%edi
+  8037eb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037ef:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  8037f6:	00 00 00 
+  8037f9:	ff d0                	call   *%rax
+  8037fb:	85 c0                	test   %eax,%eax
+  8037fd:	78 30                	js     80382f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037ff:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803804:	74 2d                	je     803833 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803806:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80380a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80380e:	48 85 c0             	test   %rax,%rax
+  803811:	74 56                	je     803869 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803813:	4c 89 ea             	mov    %r13,%rdx
+  803816:	4c 89 e6             	mov    %r12,%rsi
+  803819:	4c 89 f7             	mov    %r14,%rdi
+  80381c:	ff d0                	call   *%rax
+}
+  80381e:	48 83 c4 10          	add    $0x10,%rsp
+  803822:	5b                   	pop    %rbx
+  803823:	41 5c                	pop    %r12
+  803825:	41 5d                	pop    %r13
+  803827:	41 5e                	pop    %r14
+  803829:	5d                   	pop    %rbp
+  80382a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80382b:	48 98                	cltq
+  80382d:	eb ef                	jmp    80381e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80382f:	48 98                	cltq
+  803831:	eb eb                	jmp    80381e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803833:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80383a:	00 00 00 
+  80383d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803843:	89 da                	mov    %ebx,%edx
+  803845:	48 bf 75 68 80 00 00 	movabs $0x806875,%rdi
+  80384c:	00 00 00 
+  80384f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803854:	48 b9 6d 1a 80 00 00 	movabs $0x801a6d,%rcx
+  80385b:	00 00 00 
+  80385e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803860:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803867:	eb b5                	jmp    80381e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803869:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803870:	eb ac                	jmp    80381e <write+0x65>
+
+0000000000803872 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803872:	55                   	push   %rbp
+  803873:	48 89 e5             	mov    %rsp,%rbp
+  803876:	53                   	push   %rbx
+  803877:	48 83 ec 18          	sub    $0x18,%rsp
+  80387b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80387d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803881:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  803888:	00 00 00 
+  80388b:	ff d0                	call   *%rax
+  80388d:	85 c0                	test   %eax,%eax
+  80388f:	78 0c                	js     80389d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803891:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803895:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803898:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80389d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038a1:	c9                   	leave
+  8038a2:	c3                   	ret
+
+00000000008038a3 <tell>:
+
+int tell(int fdnum) {
+  8038a3:	55                   	push   %rbp
+  8038a4:	48 89 e5             	mov    %rsp,%rbp
+  8038a7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038ab:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038af:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  8038b6:	00 00 00 
+  8038b9:	ff d0                	call   *%rax
+  8038bb:	85 c0                	test   %eax,%eax
+  8038bd:	78 07                	js     8038c6 <tell+0x23>
+
+    return fd->fd_offset;
+  8038bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038c3:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8038c6:	c9                   	leave
+  8038c7:	c3                   	ret
+
+00000000008038c8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8038c8:	55                   	push   %rbp
+  8038c9:	48 89 e5             	mov    %rsp,%rbp
+  8038cc:	41 55                	push   %r13
+  8038ce:	41 54                	push   %r12
+  8038d0:	53                   	push   %rbx
+  8038d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8038d5:	89 fb                	mov    %edi,%ebx
+  8038d7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038da:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038de:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  8038e5:	00 00 00 
+  8038e8:	ff d0                	call   *%rax
+  8038ea:	85 c0                	test   %eax,%eax
+  8038ec:	78 38                	js     803926 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038ee:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8038f2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8038f6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038fa:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+  803906:	85 c0                	test   %eax,%eax
+  803908:	78 1c                	js     803926 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80390a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80390f:	74 20                	je     803931 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803911:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803915:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803919:	48 85 c0             	test   %rax,%rax
+  80391c:	74 47                	je     803965 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80391e:	44 89 e6             	mov    %r12d,%esi
+  803921:	4c 89 ef             	mov    %r13,%rdi
+  803924:	ff d0                	call   *%rax
+}
+  803926:	48 83 c4 18          	add    $0x18,%rsp
+  80392a:	5b                   	pop    %rbx
+  80392b:	41 5c                	pop    %r12
+  80392d:	41 5d                	pop    %r13
+  80392f:	5d                   	pop    %rbp
+  803930:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803931:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803938:	00 00 00 
+  80393b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803941:	89 da                	mov    %ebx,%edx
+  803943:	48 bf 38 68 80 00 00 	movabs $0x806838,%rdi
+  80394a:	00 00 00 
+  80394d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803952:	48 b9 6d 1a 80 00 00 	movabs $0x801a6d,%rcx
+  803959:	00 00 00 
+  80395c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80395e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803963:	eb c1                	jmp    803926 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803965:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80396a:	eb ba                	jmp    803926 <ftruncate+0x5e>
+
+000000000080396c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80396c:	55                   	push   %rbp
+  80396d:	48 89 e5             	mov    %rsp,%rbp
+  803970:	41 54                	push   %r12
+  803972:	53                   	push   %rbx
+  803973:	48 83 ec 10          	sub    $0x10,%rsp
+  803977:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80397a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80397e:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  803985:	00 00 00 
+  803988:	ff d0                	call   *%rax
+  80398a:	85 c0                	test   %eax,%eax
+  80398c:	78 63                	js     8039f1 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80398e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803992:	41 8b 3c 24          	mov    (%r12),%edi
+  803996:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80399a:	48 b8 f2 33 80 00 00 	movabs $0x8033f2,%rax
+  8039a1:	00 00 00 
+  8039a4:	ff d0                	call   *%rax
+  8039a6:	85 c0                	test   %eax,%eax
+  8039a8:	78 47                	js     8039f1 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ae:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8039b3:	74 45                	je     8039fa <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8039b5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8039b8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8039bf:	00 00 00 
+    stat->st_isdir = 0;
+  8039c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039c9:	00 00 00 
+    stat->st_ino = 0;
+  8039cc:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8039d3:	00 00 00 00 
+    stat->st_version = 0;
+  8039d7:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8039de:	00 00 00 
+    stat->st_dev = dev;
+  8039e1:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8039e8:	48 89 de             	mov    %rbx,%rsi
+  8039eb:	4c 89 e7             	mov    %r12,%rdi
+  8039ee:	ff 50 28             	call   *0x28(%rax)
+}
+  8039f1:	48 83 c4 10          	add    $0x10,%rsp
+  8039f5:	5b                   	pop    %rbx
+  8039f6:	41 5c                	pop    %r12
+  8039f8:	5d                   	pop    %rbp
+  8039f9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039fa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039ff:	eb f0                	jmp    8039f1 <fstat+0x85>
+
+0000000000803a01 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803a01:	55                   	push   %rbp
+  803a02:	48 89 e5             	mov    %rsp,%rbp
+  803a05:	41 54                	push   %r12
+  803a07:	53                   	push   %rbx
+  803a08:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803a0b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a10:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  803a17:	00 00 00 
+  803a1a:	ff d0                	call   *%rax
+  803a1c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803a1e:	85 c0                	test   %eax,%eax
+  803a20:	78 25                	js     803a47 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803a22:	4c 89 e6             	mov    %r12,%rsi
+  803a25:	89 c7                	mov    %eax,%edi
+  803a27:	48 b8 6c 39 80 00 00 	movabs $0x80396c,%rax
+  803a2e:	00 00 00 
+  803a31:	ff d0                	call   *%rax
+  803a33:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803a36:	89 df                	mov    %ebx,%edi
+  803a38:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  803a3f:	00 00 00 
+  803a42:	ff d0                	call   *%rax
+
+    return res;
+  803a44:	44 89 e3             	mov    %r12d,%ebx
+}
+  803a47:	89 d8                	mov    %ebx,%eax
+  803a49:	5b                   	pop    %rbx
+  803a4a:	41 5c                	pop    %r12
+  803a4c:	5d                   	pop    %rbp
+  803a4d:	c3                   	ret
+
+0000000000803a4e <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a4e:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803a55:	00 00 00 
+  803a58:	83 38 00             	cmpl   $0x0,(%rax)
+  803a5b:	74 0a                	je     803a67 <fsipc_env+0x19>
+    return fsenv;
+}
+  803a5d:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a64:	00 00 
+  803a66:	c3                   	ret
+fsipc_env(void) {
+  803a67:	55                   	push   %rbp
+  803a68:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a6b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a70:	48 b8 51 5b 80 00 00 	movabs $0x805b51,%rax
+  803a77:	00 00 00 
+  803a7a:	ff d0                	call   *%rax
+  803a7c:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803a83:	00 00 
+}
+  803a85:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a8c:	00 00 
+  803a8e:	5d                   	pop    %rbp
+  803a8f:	c3                   	ret
+
+0000000000803a90 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803a90:	55                   	push   %rbp
+  803a91:	48 89 e5             	mov    %rsp,%rbp
+  803a94:	53                   	push   %rbx
+  803a95:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803a99:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803aa0:	00 
+  803aa1:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803aa8:	00 
+  803aa9:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803ab0:	00 
+  803ab1:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803ab8:	00 
+  803ab9:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803ac0:	00 
+
+    assert(size <= sizeof(words));
+  803ac1:	48 83 fa 28          	cmp    $0x28,%rdx
+  803ac5:	77 38                	ja     803aff <fsipc_short+0x6f>
+  803ac7:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803ac9:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803acd:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  803ad4:	00 00 00 
+  803ad7:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803ad9:	48 b8 4e 3a 80 00 00 	movabs $0x803a4e,%rax
+  803ae0:	00 00 00 
+  803ae3:	ff d0                	call   *%rax
+  803ae5:	89 c7                	mov    %eax,%edi
+  803ae7:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803aeb:	89 de                	mov    %ebx,%esi
+  803aed:	48 b8 b4 5a 80 00 00 	movabs $0x805ab4,%rax
+  803af4:	00 00 00 
+  803af7:	ff d0                	call   *%rax
+}
+  803af9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803afd:	c9                   	leave
+  803afe:	c3                   	ret
+    assert(size <= sizeof(words));
+  803aff:	48 b9 c0 68 80 00 00 	movabs $0x8068c0,%rcx
+  803b06:	00 00 00 
+  803b09:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  803b10:	00 00 00 
+  803b13:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803b18:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  803b1f:	00 00 00 
+  803b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b27:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  803b2e:	00 00 00 
+  803b31:	41 ff d0             	call   *%r8
+
+0000000000803b34 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803b34:	55                   	push   %rbp
+  803b35:	48 89 e5             	mov    %rsp,%rbp
+  803b38:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803b3c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b3f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803b42:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b45:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b4a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b4e:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b53:	48 b8 90 3a 80 00 00 	movabs $0x803a90,%rax
+  803b5a:	00 00 00 
+  803b5d:	ff d0                	call   *%rax
+}
+  803b5f:	c9                   	leave
+  803b60:	c3                   	ret
+
+0000000000803b61 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803b61:	55                   	push   %rbp
+  803b62:	48 89 e5             	mov    %rsp,%rbp
+  803b65:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803b69:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b6c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803b6f:	ba 04 00 00 00       	mov    $0x4,%edx
+  803b74:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803b78:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b7d:	48 b8 90 3a 80 00 00 	movabs $0x803a90,%rax
+  803b84:	00 00 00 
+  803b87:	ff d0                	call   *%rax
+}
+  803b89:	c9                   	leave
+  803b8a:	c3                   	ret
+
+0000000000803b8b <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803b8b:	55                   	push   %rbp
+  803b8c:	48 89 e5             	mov    %rsp,%rbp
+  803b8f:	41 54                	push   %r12
+  803b91:	53                   	push   %rbx
+  803b92:	48 83 ec 10          	sub    $0x10,%rsp
+  803b96:	89 fb                	mov    %edi,%ebx
+  803b98:	49 89 f4             	mov    %rsi,%r12
+  803b9b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b9f:	48 b8 4e 3a 80 00 00 	movabs $0x803a4e,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+  803bab:	89 c7                	mov    %eax,%edi
+  803bad:	6a 00                	push   $0x0
+  803baf:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803bb3:	50                   	push   %rax
+  803bb4:	4d 89 e1             	mov    %r12,%r9
+  803bb7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803bbd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803bc2:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803bc9:	00 00 00 
+  803bcc:	89 de                	mov    %ebx,%esi
+  803bce:	48 b8 4f 5a 80 00 00 	movabs $0x805a4f,%rax
+  803bd5:	00 00 00 
+  803bd8:	ff d0                	call   *%rax
+}
+  803bda:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803bde:	5b                   	pop    %rbx
+  803bdf:	41 5c                	pop    %r12
+  803be1:	5d                   	pop    %rbp
+  803be2:	c3                   	ret
+
+0000000000803be3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803be3:	55                   	push   %rbp
+  803be4:	48 89 e5             	mov    %rsp,%rbp
+  803be7:	41 54                	push   %r12
+  803be9:	53                   	push   %rbx
+  803bea:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803bed:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bf0:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803bf7:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bfe:	be 00 00 00 00       	mov    $0x0,%esi
+  803c03:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c08:	48 b8 8b 3b 80 00 00 	movabs $0x803b8b,%rax
+  803c0f:	00 00 00 
+  803c12:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c14:	85 c0                	test   %eax,%eax
+  803c16:	78 5a                	js     803c72 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c18:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803c1f:	00 00 00 
+  803c22:	4c 89 e6             	mov    %r12,%rsi
+  803c25:	48 89 df             	mov    %rbx,%rdi
+  803c28:	48 b8 a4 23 80 00 00 	movabs $0x8023a4,%rax
+  803c2f:	00 00 00 
+  803c32:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803c34:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803c3b:	00 
+  803c3c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c42:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803c49:	00 
+  803c4a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803c50:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803c57:	00 
+  803c58:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803c5f:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803c66:	00 
+  803c67:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c72:	5b                   	pop    %rbx
+  803c73:	41 5c                	pop    %r12
+  803c75:	5d                   	pop    %rbp
+  803c76:	c3                   	ret
+
+0000000000803c77 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c77:	55                   	push   %rbp
+  803c78:	48 89 e5             	mov    %rsp,%rbp
+  803c7b:	41 57                	push   %r15
+  803c7d:	41 56                	push   %r14
+  803c7f:	41 55                	push   %r13
+  803c81:	41 54                	push   %r12
+  803c83:	53                   	push   %rbx
+  803c84:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803c88:	48 85 ff             	test   %rdi,%rdi
+  803c8b:	0f 84 a1 00 00 00    	je     803d32 <devfile_read+0xbb>
+  803c91:	49 89 ff             	mov    %rdi,%r15
+  803c94:	49 89 f5             	mov    %rsi,%r13
+  803c97:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803c9a:	48 85 f6             	test   %rsi,%rsi
+  803c9d:	0f 84 c4 00 00 00    	je     803d67 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803ca3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803caa:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803cab:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803cb2:	00 00 00 
+  803cb5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803cb9:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803cbc:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803cc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc5:	be 00 00 00 00       	mov    $0x0,%esi
+  803cca:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ccf:	48 b8 8b 3b 80 00 00 	movabs $0x803b8b,%rax
+  803cd6:	00 00 00 
+  803cd9:	ff d0                	call   *%rax
+        if (res < 0) {
+  803cdb:	85 c0                	test   %eax,%eax
+  803cdd:	0f 88 b9 00 00 00    	js     803d9c <devfile_read+0x125>
+        assert(res <= n);
+  803ce3:	48 63 d8             	movslq %eax,%rbx
+  803ce6:	49 39 dc             	cmp    %rbx,%r12
+  803ce9:	0f 82 b1 00 00 00    	jb     803da0 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803cef:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803cf4:	0f 87 db 00 00 00    	ja     803dd5 <devfile_read+0x15e>
+        if (!res) {
+  803cfa:	85 c0                	test   %eax,%eax
+  803cfc:	74 21                	je     803d1f <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803cfe:	48 89 da             	mov    %rbx,%rdx
+  803d01:	4c 89 f6             	mov    %r14,%rsi
+  803d04:	4c 89 ef             	mov    %r13,%rdi
+  803d07:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  803d0e:	00 00 00 
+  803d11:	ff d0                	call   *%rax
+        total_read += res;
+  803d13:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803d17:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803d1a:	49 29 dc             	sub    %rbx,%r12
+  803d1d:	75 96                	jne    803cb5 <devfile_read+0x3e>
+    return total_read;
+  803d1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803d23:	48 83 c4 18          	add    $0x18,%rsp
+  803d27:	5b                   	pop    %rbx
+  803d28:	41 5c                	pop    %r12
+  803d2a:	41 5d                	pop    %r13
+  803d2c:	41 5e                	pop    %r14
+  803d2e:	41 5f                	pop    %r15
+  803d30:	5d                   	pop    %rbp
+  803d31:	c3                   	ret
+    assert(fd);
+  803d32:	48 b9 f6 68 80 00 00 	movabs $0x8068f6,%rcx
+  803d39:	00 00 00 
+  803d3c:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  803d43:	00 00 00 
+  803d46:	be 91 00 00 00       	mov    $0x91,%esi
+  803d4b:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  803d52:	00 00 00 
+  803d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d5a:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  803d61:	00 00 00 
+  803d64:	41 ff d0             	call   *%r8
+    assert(buf);
+  803d67:	48 b9 f9 68 80 00 00 	movabs $0x8068f9,%rcx
+  803d6e:	00 00 00 
+  803d71:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  803d78:	00 00 00 
+  803d7b:	be 92 00 00 00       	mov    $0x92,%esi
+  803d80:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  803d87:	00 00 00 
+  803d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d8f:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  803d96:	00 00 00 
+  803d99:	41 ff d0             	call   *%r8
+            return res;
+  803d9c:	48 98                	cltq
+  803d9e:	eb 83                	jmp    803d23 <devfile_read+0xac>
+        assert(res <= n);
+  803da0:	48 b9 fd 68 80 00 00 	movabs $0x8068fd,%rcx
+  803da7:	00 00 00 
+  803daa:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  803db1:	00 00 00 
+  803db4:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803db9:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  803dc0:	00 00 00 
+  803dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc8:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  803dcf:	00 00 00 
+  803dd2:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803dd5:	48 b9 08 69 80 00 00 	movabs $0x806908,%rcx
+  803ddc:	00 00 00 
+  803ddf:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  803de6:	00 00 00 
+  803de9:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803dee:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  803df5:	00 00 00 
+  803df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dfd:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  803e04:	00 00 00 
+  803e07:	41 ff d0             	call   *%r8
+
+0000000000803e0a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803e0a:	55                   	push   %rbp
+  803e0b:	48 89 e5             	mov    %rsp,%rbp
+  803e0e:	41 57                	push   %r15
+  803e10:	41 56                	push   %r14
+  803e12:	41 55                	push   %r13
+  803e14:	41 54                	push   %r12
+  803e16:	53                   	push   %rbx
+  803e17:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803e1b:	48 85 ff             	test   %rdi,%rdi
+  803e1e:	0f 84 83 00 00 00    	je     803ea7 <devfile_write+0x9d>
+  803e24:	49 89 ff             	mov    %rdi,%r15
+  803e27:	49 89 f4             	mov    %rsi,%r12
+  803e2a:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803e2d:	48 85 f6             	test   %rsi,%rsi
+  803e30:	0f 84 a6 00 00 00    	je     803edc <devfile_write+0xd2>
+    size_t total_written = 0;
+  803e36:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803e3c:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803e43:	00 00 00 
+  803e46:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e4a:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803e4d:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803e51:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803e56:	48 39 d3             	cmp    %rdx,%rbx
+  803e59:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803e5d:	4c 89 e6             	mov    %r12,%rsi
+  803e60:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803e67:	00 00 00 
+  803e6a:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  803e71:	00 00 00 
+  803e74:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e76:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e7b:	be 00 00 00 00       	mov    $0x0,%esi
+  803e80:	bf 04 00 00 00       	mov    $0x4,%edi
+  803e85:	48 b8 8b 3b 80 00 00 	movabs $0x803b8b,%rax
+  803e8c:	00 00 00 
+  803e8f:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e91:	85 c0                	test   %eax,%eax
+  803e93:	78 7c                	js     803f11 <devfile_write+0x107>
+        total_written += res;
+  803e95:	48 98                	cltq
+  803e97:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803e9a:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e9d:	48 29 c3             	sub    %rax,%rbx
+  803ea0:	75 a4                	jne    803e46 <devfile_write+0x3c>
+    return total_written;
+  803ea2:	4c 89 e8             	mov    %r13,%rax
+  803ea5:	eb 6c                	jmp    803f13 <devfile_write+0x109>
+    assert(fd);
+  803ea7:	48 b9 f6 68 80 00 00 	movabs $0x8068f6,%rcx
+  803eae:	00 00 00 
+  803eb1:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  803eb8:	00 00 00 
+  803ebb:	be bd 00 00 00       	mov    $0xbd,%esi
+  803ec0:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  803ec7:	00 00 00 
+  803eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecf:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  803ed6:	00 00 00 
+  803ed9:	41 ff d0             	call   *%r8
+    assert(buf);
+  803edc:	48 b9 f9 68 80 00 00 	movabs $0x8068f9,%rcx
+  803ee3:	00 00 00 
+  803ee6:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  803eed:	00 00 00 
+  803ef0:	be be 00 00 00       	mov    $0xbe,%esi
+  803ef5:	48 bf eb 68 80 00 00 	movabs $0x8068eb,%rdi
+  803efc:	00 00 00 
+  803eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f04:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  803f0b:	00 00 00 
+  803f0e:	41 ff d0             	call   *%r8
+            return res;
+  803f11:	48 98                	cltq
+}
+  803f13:	48 83 c4 08          	add    $0x8,%rsp
+  803f17:	5b                   	pop    %rbx
+  803f18:	41 5c                	pop    %r12
+  803f1a:	41 5d                	pop    %r13
+  803f1c:	41 5e                	pop    %r14
+  803f1e:	41 5f                	pop    %r15
+  803f20:	5d                   	pop    %rbp
+  803f21:	c3                   	ret
+
+0000000000803f22 <open>:
+open(const char *path, int mode) {
+  803f22:	55                   	push   %rbp
+  803f23:	48 89 e5             	mov    %rsp,%rbp
+  803f26:	41 55                	push   %r13
+  803f28:	41 54                	push   %r12
+  803f2a:	53                   	push   %rbx
+  803f2b:	48 83 ec 18          	sub    $0x18,%rsp
+  803f2f:	49 89 fc             	mov    %rdi,%r12
+  803f32:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f35:	48 b8 66 23 80 00 00 	movabs $0x802366,%rax
+  803f3c:	00 00 00 
+  803f3f:	ff d0                	call   *%rax
+  803f41:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f47:	0f 87 8f 00 00 00    	ja     803fdc <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f4d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f51:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803f58:	00 00 00 
+  803f5b:	ff d0                	call   *%rax
+  803f5d:	89 c3                	mov    %eax,%ebx
+  803f5f:	85 c0                	test   %eax,%eax
+  803f61:	78 55                	js     803fb8 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f63:	4c 89 e6             	mov    %r12,%rsi
+  803f66:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803f6d:	00 00 00 
+  803f70:	48 89 df             	mov    %rbx,%rdi
+  803f73:	48 b8 a4 23 80 00 00 	movabs $0x8023a4,%rax
+  803f7a:	00 00 00 
+  803f7d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f7f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f86:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f8b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f8f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f94:	48 b8 8b 3b 80 00 00 	movabs $0x803b8b,%rax
+  803f9b:	00 00 00 
+  803f9e:	ff d0                	call   *%rax
+  803fa0:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803fa2:	85 c0                	test   %eax,%eax
+  803fa4:	78 1f                	js     803fc5 <open+0xa3>
+    return fd2num(fd);
+  803fa6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803faa:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  803fb1:	00 00 00 
+  803fb4:	ff d0                	call   *%rax
+  803fb6:	89 c3                	mov    %eax,%ebx
+}
+  803fb8:	89 d8                	mov    %ebx,%eax
+  803fba:	48 83 c4 18          	add    $0x18,%rsp
+  803fbe:	5b                   	pop    %rbx
+  803fbf:	41 5c                	pop    %r12
+  803fc1:	41 5d                	pop    %r13
+  803fc3:	5d                   	pop    %rbp
+  803fc4:	c3                   	ret
+        fd_close(fd, 0);
+  803fc5:	be 00 00 00 00       	mov    $0x0,%esi
+  803fca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fce:	48 b8 62 34 80 00 00 	movabs $0x803462,%rax
+  803fd5:	00 00 00 
+  803fd8:	ff d0                	call   *%rax
+        return res;
+  803fda:	eb dc                	jmp    803fb8 <open+0x96>
+        return -E_BAD_PATH;
+  803fdc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803fe1:	eb d5                	jmp    803fb8 <open+0x96>
+
+0000000000803fe3 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803fe3:	55                   	push   %rbp
+  803fe4:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803fe7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fec:	be 00 00 00 00       	mov    $0x0,%esi
+  803ff1:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ff6:	48 b8 90 3a 80 00 00 	movabs $0x803a90,%rax
+  803ffd:	00 00 00 
+  804000:	ff d0                	call   *%rax
+}
+  804002:	5d                   	pop    %rbp
+  804003:	c3                   	ret
+
+0000000000804004 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  804004:	55                   	push   %rbp
+  804005:	48 89 e5             	mov    %rsp,%rbp
+  804008:	41 56                	push   %r14
+  80400a:	41 55                	push   %r13
+  80400c:	41 54                	push   %r12
+  80400e:	53                   	push   %rbx
+  80400f:	48 83 ec 10          	sub    $0x10,%rsp
+  804013:	41 89 f6             	mov    %esi,%r14d
+  804016:	49 89 d4             	mov    %rdx,%r12
+  804019:	48 89 cb             	mov    %rcx,%rbx
+  80401c:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80401f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804023:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  80402a:	00 00 00 
+  80402d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80402f:	85 c0                	test   %eax,%eax
+  804031:	78 46                	js     804079 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804033:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804037:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80403e:	00 00 00 
+  804041:	8b 00                	mov    (%rax),%eax
+  804043:	39 02                	cmp    %eax,(%rdx)
+  804045:	75 3f                	jne    804086 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804047:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  80404e:	00 00 00 
+  804051:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804054:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804056:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80405a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  80405e:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804062:	48 89 da             	mov    %rbx,%rdx
+  804065:	4c 89 e6             	mov    %r12,%rsi
+  804068:	bf 09 00 00 00       	mov    $0x9,%edi
+  80406d:	48 b8 8b 3b 80 00 00 	movabs $0x803b8b,%rax
+  804074:	00 00 00 
+  804077:	ff d0                	call   *%rax
+}
+  804079:	48 83 c4 10          	add    $0x10,%rsp
+  80407d:	5b                   	pop    %rbx
+  80407e:	41 5c                	pop    %r12
+  804080:	41 5d                	pop    %r13
+  804082:	41 5e                	pop    %r14
+  804084:	5d                   	pop    %rbp
+  804085:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804086:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80408b:	eb ec                	jmp    804079 <file_map+0x75>
+
+000000000080408d <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80408d:	55                   	push   %rbp
+  80408e:	48 89 e5             	mov    %rsp,%rbp
+  804091:	41 54                	push   %r12
+  804093:	53                   	push   %rbx
+  804094:	48 83 ec 20          	sub    $0x20,%rsp
+  804098:	41 89 f4             	mov    %esi,%r12d
+  80409b:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80409e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8040a2:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  8040a9:	00 00 00 
+  8040ac:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040ae:	85 c0                	test   %eax,%eax
+  8040b0:	78 3c                	js     8040ee <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040b6:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8040bd:	00 00 00 
+  8040c0:	8b 0a                	mov    (%rdx),%ecx
+  8040c2:	39 08                	cmp    %ecx,(%rax)
+  8040c4:	75 31                	jne    8040f7 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  8040c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040c9:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8040cc:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8040d0:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8040d4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040d9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8040e2:	48 b8 90 3a 80 00 00 	movabs $0x803a90,%rax
+  8040e9:	00 00 00 
+  8040ec:	ff d0                	call   *%rax
+}
+  8040ee:	48 83 c4 20          	add    $0x20,%rsp
+  8040f2:	5b                   	pop    %rbx
+  8040f3:	41 5c                	pop    %r12
+  8040f5:	5d                   	pop    %rbp
+  8040f6:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040f7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8040fc:	eb f0                	jmp    8040ee <file_msync+0x61>
+
+00000000008040fe <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8040fe:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804102:	7f 01                	jg     804105 <writebuf+0x7>
+  804104:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804105:	55                   	push   %rbp
+  804106:	48 89 e5             	mov    %rsp,%rbp
+  804109:	53                   	push   %rbx
+  80410a:	48 83 ec 08          	sub    $0x8,%rsp
+  80410e:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804111:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804115:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804119:	8b 3f                	mov    (%rdi),%edi
+  80411b:	48 b8 b9 37 80 00 00 	movabs $0x8037b9,%rax
+  804122:	00 00 00 
+  804125:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804127:	48 85 c0             	test   %rax,%rax
+  80412a:	7e 04                	jle    804130 <writebuf+0x32>
+  80412c:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804130:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804134:	48 39 c2             	cmp    %rax,%rdx
+  804137:	74 0f                	je     804148 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804139:	48 85 c0             	test   %rax,%rax
+  80413c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804141:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804145:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804148:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80414c:	c9                   	leave
+  80414d:	c3                   	ret
+
+000000000080414e <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80414e:	8b 46 04             	mov    0x4(%rsi),%eax
+  804151:	8d 50 01             	lea    0x1(%rax),%edx
+  804154:	89 56 04             	mov    %edx,0x4(%rsi)
+  804157:	48 98                	cltq
+  804159:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80415e:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804164:	74 01                	je     804167 <putch+0x19>
+  804166:	c3                   	ret
+putch(int ch, void *arg) {
+  804167:	55                   	push   %rbp
+  804168:	48 89 e5             	mov    %rsp,%rbp
+  80416b:	53                   	push   %rbx
+  80416c:	48 83 ec 08          	sub    $0x8,%rsp
+  804170:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804173:	48 89 f7             	mov    %rsi,%rdi
+  804176:	48 b8 fe 40 80 00 00 	movabs $0x8040fe,%rax
+  80417d:	00 00 00 
+  804180:	ff d0                	call   *%rax
+        state->offset = 0;
+  804182:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804189:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80418d:	c9                   	leave
+  80418e:	c3                   	ret
+
+000000000080418f <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80418f:	55                   	push   %rbp
+  804190:	48 89 e5             	mov    %rsp,%rbp
+  804193:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80419a:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80419d:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8041a3:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8041aa:	00 00 00 
+    state.result = 0;
+  8041ad:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8041b4:	00 00 00 00 
+    state.error = 1;
+  8041b8:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8041bf:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8041c2:	48 89 f2             	mov    %rsi,%rdx
+  8041c5:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8041cc:	48 bf 4e 41 80 00 00 	movabs $0x80414e,%rdi
+  8041d3:	00 00 00 
+  8041d6:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  8041dd:	00 00 00 
+  8041e0:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8041e2:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8041e9:	7f 14                	jg     8041ff <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8041eb:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8041f2:	48 85 c0             	test   %rax,%rax
+  8041f5:	75 06                	jne    8041fd <vfprintf+0x6e>
+  8041f7:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8041fd:	c9                   	leave
+  8041fe:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8041ff:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804206:	48 b8 fe 40 80 00 00 	movabs $0x8040fe,%rax
+  80420d:	00 00 00 
+  804210:	ff d0                	call   *%rax
+  804212:	eb d7                	jmp    8041eb <vfprintf+0x5c>
+
+0000000000804214 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804214:	55                   	push   %rbp
+  804215:	48 89 e5             	mov    %rsp,%rbp
+  804218:	48 83 ec 50          	sub    $0x50,%rsp
+  80421c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804220:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804224:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804228:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80422c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804233:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804237:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80423b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80423f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804243:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804247:	48 b8 8f 41 80 00 00 	movabs $0x80418f,%rax
+  80424e:	00 00 00 
+  804251:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804253:	c9                   	leave
+  804254:	c3                   	ret
+
+0000000000804255 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804255:	55                   	push   %rbp
+  804256:	48 89 e5             	mov    %rsp,%rbp
+  804259:	48 83 ec 50          	sub    $0x50,%rsp
+  80425d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804261:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804265:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804269:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80426d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804271:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804278:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80427c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804280:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804284:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804288:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80428c:	48 89 fe             	mov    %rdi,%rsi
+  80428f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804294:	48 b8 8f 41 80 00 00 	movabs $0x80418f,%rax
+  80429b:	00 00 00 
+  80429e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8042a0:	c9                   	leave
+  8042a1:	c3                   	ret
+
+00000000008042a2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8042a2:	55                   	push   %rbp
+  8042a3:	48 89 e5             	mov    %rsp,%rbp
+  8042a6:	41 54                	push   %r12
+  8042a8:	53                   	push   %rbx
+  8042a9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042ac:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  8042b3:	00 00 00 
+  8042b6:	ff d0                	call   *%rax
+  8042b8:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8042bb:	48 be 30 69 80 00 00 	movabs $0x806930,%rsi
+  8042c2:	00 00 00 
+  8042c5:	48 89 df             	mov    %rbx,%rdi
+  8042c8:	48 b8 a4 23 80 00 00 	movabs $0x8023a4,%rax
+  8042cf:	00 00 00 
+  8042d2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8042d4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8042d9:	41 2b 04 24          	sub    (%r12),%eax
+  8042dd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8042e3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8042ea:	00 00 00 
+    stat->st_dev = &devpipe;
+  8042ed:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8042f4:	00 00 00 
+  8042f7:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8042fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804303:	5b                   	pop    %rbx
+  804304:	41 5c                	pop    %r12
+  804306:	5d                   	pop    %rbp
+  804307:	c3                   	ret
+
+0000000000804308 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804308:	55                   	push   %rbp
+  804309:	48 89 e5             	mov    %rsp,%rbp
+  80430c:	41 54                	push   %r12
+  80430e:	53                   	push   %rbx
+  80430f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804312:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804317:	48 89 fe             	mov    %rdi,%rsi
+  80431a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80431f:	49 bc e1 2b 80 00 00 	movabs $0x802be1,%r12
+  804326:	00 00 00 
+  804329:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80432c:	48 89 df             	mov    %rbx,%rdi
+  80432f:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  804336:	00 00 00 
+  804339:	ff d0                	call   *%rax
+  80433b:	48 89 c6             	mov    %rax,%rsi
+  80433e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804343:	bf 00 00 00 00       	mov    $0x0,%edi
+  804348:	41 ff d4             	call   *%r12
+}
+  80434b:	5b                   	pop    %rbx
+  80434c:	41 5c                	pop    %r12
+  80434e:	5d                   	pop    %rbp
+  80434f:	c3                   	ret
+
+0000000000804350 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804350:	55                   	push   %rbp
+  804351:	48 89 e5             	mov    %rsp,%rbp
+  804354:	41 57                	push   %r15
+  804356:	41 56                	push   %r14
+  804358:	41 55                	push   %r13
+  80435a:	41 54                	push   %r12
+  80435c:	53                   	push   %rbx
+  80435d:	48 83 ec 18          	sub    $0x18,%rsp
+  804361:	49 89 fc             	mov    %rdi,%r12
+  804364:	49 89 f5             	mov    %rsi,%r13
+  804367:	49 89 d7             	mov    %rdx,%r15
+  80436a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80436e:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  804375:	00 00 00 
+  804378:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80437a:	4d 85 ff             	test   %r15,%r15
+  80437d:	0f 84 af 00 00 00    	je     804432 <devpipe_write+0xe2>
+  804383:	48 89 c3             	mov    %rax,%rbx
+  804386:	4c 89 f8             	mov    %r15,%rax
+  804389:	4d 89 ef             	mov    %r13,%r15
+  80438c:	4c 01 e8             	add    %r13,%rax
+  80438f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804393:	49 bd d7 2a 80 00 00 	movabs $0x802ad7,%r13
+  80439a:	00 00 00 
+            sys_yield();
+  80439d:	49 be 68 2a 80 00 00 	movabs $0x802a68,%r14
+  8043a4:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043a7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043aa:	48 63 ce             	movslq %esi,%rcx
+  8043ad:	48 63 03             	movslq (%rbx),%rax
+  8043b0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043b6:	48 39 c1             	cmp    %rax,%rcx
+  8043b9:	72 2e                	jb     8043e9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043bb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043c0:	48 89 da             	mov    %rbx,%rdx
+  8043c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043c8:	4c 89 e7             	mov    %r12,%rdi
+  8043cb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8043ce:	85 c0                	test   %eax,%eax
+  8043d0:	74 66                	je     804438 <devpipe_write+0xe8>
+            sys_yield();
+  8043d2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043d5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043d8:	48 63 ce             	movslq %esi,%rcx
+  8043db:	48 63 03             	movslq (%rbx),%rax
+  8043de:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043e4:	48 39 c1             	cmp    %rax,%rcx
+  8043e7:	73 d2                	jae    8043bb <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8043e9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8043ed:	48 89 ca             	mov    %rcx,%rdx
+  8043f0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8043f4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8043fb:	08 10 20 
+  8043fe:	48 f7 e2             	mul    %rdx
+  804401:	48 c1 ea 06          	shr    $0x6,%rdx
+  804405:	48 89 d0             	mov    %rdx,%rax
+  804408:	48 c1 e0 09          	shl    $0x9,%rax
+  80440c:	48 29 d0             	sub    %rdx,%rax
+  80440f:	48 c1 e0 03          	shl    $0x3,%rax
+  804413:	48 29 c1             	sub    %rax,%rcx
+  804416:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80441b:	83 c6 01             	add    $0x1,%esi
+  80441e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804421:	49 83 c7 01          	add    $0x1,%r15
+  804425:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804429:	49 39 c7             	cmp    %rax,%r15
+  80442c:	0f 85 75 ff ff ff    	jne    8043a7 <devpipe_write+0x57>
+    return n;
+  804432:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804436:	eb 05                	jmp    80443d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804438:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80443d:	48 83 c4 18          	add    $0x18,%rsp
+  804441:	5b                   	pop    %rbx
+  804442:	41 5c                	pop    %r12
+  804444:	41 5d                	pop    %r13
+  804446:	41 5e                	pop    %r14
+  804448:	41 5f                	pop    %r15
+  80444a:	5d                   	pop    %rbp
+  80444b:	c3                   	ret
+
+000000000080444c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80444c:	55                   	push   %rbp
+  80444d:	48 89 e5             	mov    %rsp,%rbp
+  804450:	41 57                	push   %r15
+  804452:	41 56                	push   %r14
+  804454:	41 55                	push   %r13
+  804456:	41 54                	push   %r12
+  804458:	53                   	push   %rbx
+  804459:	48 83 ec 18          	sub    $0x18,%rsp
+  80445d:	49 89 fc             	mov    %rdi,%r12
+  804460:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804464:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804468:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  80446f:	00 00 00 
+  804472:	ff d0                	call   *%rax
+  804474:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804477:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80447d:	49 bd d7 2a 80 00 00 	movabs $0x802ad7,%r13
+  804484:	00 00 00 
+            sys_yield();
+  804487:	49 be 68 2a 80 00 00 	movabs $0x802a68,%r14
+  80448e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804491:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804496:	74 7d                	je     804515 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804498:	8b 03                	mov    (%rbx),%eax
+  80449a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80449d:	75 26                	jne    8044c5 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80449f:	4d 85 ff             	test   %r15,%r15
+  8044a2:	75 77                	jne    80451b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044a4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8044a9:	48 89 da             	mov    %rbx,%rdx
+  8044ac:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044b1:	4c 89 e7             	mov    %r12,%rdi
+  8044b4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8044b7:	85 c0                	test   %eax,%eax
+  8044b9:	74 72                	je     80452d <devpipe_read+0xe1>
+            sys_yield();
+  8044bb:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8044be:	8b 03                	mov    (%rbx),%eax
+  8044c0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8044c3:	74 df                	je     8044a4 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8044c5:	48 63 c8             	movslq %eax,%rcx
+  8044c8:	48 89 ca             	mov    %rcx,%rdx
+  8044cb:	48 c1 ea 03          	shr    $0x3,%rdx
+  8044cf:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8044d6:	08 10 20 
+  8044d9:	48 89 d0             	mov    %rdx,%rax
+  8044dc:	48 f7 e6             	mul    %rsi
+  8044df:	48 c1 ea 06          	shr    $0x6,%rdx
+  8044e3:	48 89 d0             	mov    %rdx,%rax
+  8044e6:	48 c1 e0 09          	shl    $0x9,%rax
+  8044ea:	48 29 d0             	sub    %rdx,%rax
+  8044ed:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8044f4:	00 
+  8044f5:	48 89 c8             	mov    %rcx,%rax
+  8044f8:	48 29 d0             	sub    %rdx,%rax
+  8044fb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804500:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804504:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804508:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80450b:	49 83 c7 01          	add    $0x1,%r15
+  80450f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804513:	75 83                	jne    804498 <devpipe_read+0x4c>
+    return n;
+  804515:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804519:	eb 03                	jmp    80451e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80451b:	4c 89 f8             	mov    %r15,%rax
+}
+  80451e:	48 83 c4 18          	add    $0x18,%rsp
+  804522:	5b                   	pop    %rbx
+  804523:	41 5c                	pop    %r12
+  804525:	41 5d                	pop    %r13
+  804527:	41 5e                	pop    %r14
+  804529:	41 5f                	pop    %r15
+  80452b:	5d                   	pop    %rbp
+  80452c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80452d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804532:	eb ea                	jmp    80451e <devpipe_read+0xd2>
+
+0000000000804534 <pipe>:
+pipe(int pfd[2]) {
+  804534:	55                   	push   %rbp
+  804535:	48 89 e5             	mov    %rsp,%rbp
+  804538:	41 55                	push   %r13
+  80453a:	41 54                	push   %r12
+  80453c:	53                   	push   %rbx
+  80453d:	48 83 ec 18          	sub    $0x18,%rsp
+  804541:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804544:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804548:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  80454f:	00 00 00 
+  804552:	ff d0                	call   *%rax
+  804554:	89 c3                	mov    %eax,%ebx
+  804556:	85 c0                	test   %eax,%eax
+  804558:	0f 88 a0 01 00 00    	js     8046fe <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80455e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804563:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804568:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80456c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804571:	48 b8 09 2b 80 00 00 	movabs $0x802b09,%rax
+  804578:	00 00 00 
+  80457b:	ff d0                	call   *%rax
+  80457d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80457f:	85 c0                	test   %eax,%eax
+  804581:	0f 88 77 01 00 00    	js     8046fe <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804587:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80458b:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  804592:	00 00 00 
+  804595:	ff d0                	call   *%rax
+  804597:	89 c3                	mov    %eax,%ebx
+  804599:	85 c0                	test   %eax,%eax
+  80459b:	0f 88 43 01 00 00    	js     8046e4 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8045a1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045ab:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8045af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045b4:	48 b8 09 2b 80 00 00 	movabs $0x802b09,%rax
+  8045bb:	00 00 00 
+  8045be:	ff d0                	call   *%rax
+  8045c0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8045c2:	85 c0                	test   %eax,%eax
+  8045c4:	0f 88 1a 01 00 00    	js     8046e4 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8045ca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8045ce:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  8045d5:	00 00 00 
+  8045d8:	ff d0                	call   *%rax
+  8045da:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8045dd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045e7:	48 89 c6             	mov    %rax,%rsi
+  8045ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ef:	48 b8 09 2b 80 00 00 	movabs $0x802b09,%rax
+  8045f6:	00 00 00 
+  8045f9:	ff d0                	call   *%rax
+  8045fb:	89 c3                	mov    %eax,%ebx
+  8045fd:	85 c0                	test   %eax,%eax
+  8045ff:	0f 88 c5 00 00 00    	js     8046ca <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804605:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804609:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+  804615:	48 89 c1             	mov    %rax,%rcx
+  804618:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80461e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804624:	ba 00 00 00 00       	mov    $0x0,%edx
+  804629:	4c 89 ee             	mov    %r13,%rsi
+  80462c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804631:	48 b8 76 2b 80 00 00 	movabs $0x802b76,%rax
+  804638:	00 00 00 
+  80463b:	ff d0                	call   *%rax
+  80463d:	89 c3                	mov    %eax,%ebx
+  80463f:	85 c0                	test   %eax,%eax
+  804641:	78 6e                	js     8046b1 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804643:	be 00 10 00 00       	mov    $0x1000,%esi
+  804648:	4c 89 ef             	mov    %r13,%rdi
+  80464b:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  804652:	00 00 00 
+  804655:	ff d0                	call   *%rax
+  804657:	83 f8 02             	cmp    $0x2,%eax
+  80465a:	0f 85 ab 00 00 00    	jne    80470b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804660:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804667:	00 00 
+  804669:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80466d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80466f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804673:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80467a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80467e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804680:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804684:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80468b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80468f:	48 bb 19 33 80 00 00 	movabs $0x803319,%rbx
+  804696:	00 00 00 
+  804699:	ff d3                	call   *%rbx
+  80469b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80469f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8046a3:	ff d3                	call   *%rbx
+  8046a5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8046aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046af:	eb 4d                	jmp    8046fe <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8046b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046b6:	4c 89 ee             	mov    %r13,%rsi
+  8046b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046be:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  8046c5:	00 00 00 
+  8046c8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8046ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046cf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8046d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046d8:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  8046df:	00 00 00 
+  8046e2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8046e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046e9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8046ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046f2:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  8046f9:	00 00 00 
+  8046fc:	ff d0                	call   *%rax
+}
+  8046fe:	89 d8                	mov    %ebx,%eax
+  804700:	48 83 c4 18          	add    $0x18,%rsp
+  804704:	5b                   	pop    %rbx
+  804705:	41 5c                	pop    %r12
+  804707:	41 5d                	pop    %r13
+  804709:	5d                   	pop    %rbp
+  80470a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80470b:	48 b9 48 69 80 00 00 	movabs $0x806948,%rcx
+  804712:	00 00 00 
+  804715:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  80471c:	00 00 00 
+  80471f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804724:	48 bf 37 69 80 00 00 	movabs $0x806937,%rdi
+  80472b:	00 00 00 
+  80472e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804733:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  80473a:	00 00 00 
+  80473d:	41 ff d0             	call   *%r8
+
+0000000000804740 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804740:	55                   	push   %rbp
+  804741:	48 89 e5             	mov    %rsp,%rbp
+  804744:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804748:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80474c:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  804753:	00 00 00 
+  804756:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804758:	85 c0                	test   %eax,%eax
+  80475a:	78 35                	js     804791 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80475c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804760:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  804767:	00 00 00 
+  80476a:	ff d0                	call   *%rax
+  80476c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80476f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804774:	be 00 10 00 00       	mov    $0x1000,%esi
+  804779:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80477d:	48 b8 d7 2a 80 00 00 	movabs $0x802ad7,%rax
+  804784:	00 00 00 
+  804787:	ff d0                	call   *%rax
+  804789:	85 c0                	test   %eax,%eax
+  80478b:	0f 94 c0             	sete   %al
+  80478e:	0f b6 c0             	movzbl %al,%eax
+}
+  804791:	c9                   	leave
+  804792:	c3                   	ret
+
+0000000000804793 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804793:	48 89 f8             	mov    %rdi,%rax
+  804796:	48 c1 e8 27          	shr    $0x27,%rax
+  80479a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8047a1:	01 00 00 
+  8047a4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047a8:	f6 c2 01             	test   $0x1,%dl
+  8047ab:	74 6d                	je     80481a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8047ad:	48 89 f8             	mov    %rdi,%rax
+  8047b0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8047b4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8047bb:	01 00 00 
+  8047be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047c2:	f6 c2 01             	test   $0x1,%dl
+  8047c5:	74 62                	je     804829 <get_uvpt_entry+0x96>
+  8047c7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8047ce:	01 00 00 
+  8047d1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047d5:	f6 c2 80             	test   $0x80,%dl
+  8047d8:	75 4f                	jne    804829 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8047da:	48 89 f8             	mov    %rdi,%rax
+  8047dd:	48 c1 e8 15          	shr    $0x15,%rax
+  8047e1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047e8:	01 00 00 
+  8047eb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047ef:	f6 c2 01             	test   $0x1,%dl
+  8047f2:	74 44                	je     804838 <get_uvpt_entry+0xa5>
+  8047f4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047fb:	01 00 00 
+  8047fe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804802:	f6 c2 80             	test   $0x80,%dl
+  804805:	75 31                	jne    804838 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804807:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80480b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804812:	01 00 00 
+  804815:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804819:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80481a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804821:	01 00 00 
+  804824:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804828:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804829:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804830:	01 00 00 
+  804833:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804837:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804838:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80483f:	01 00 00 
+  804842:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804846:	c3                   	ret
+
+0000000000804847 <get_prot>:
+
+int
+get_prot(void *va) {
+  804847:	55                   	push   %rbp
+  804848:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80484b:	48 b8 93 47 80 00 00 	movabs $0x804793,%rax
+  804852:	00 00 00 
+  804855:	ff d0                	call   *%rax
+  804857:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80485a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80485f:	89 c1                	mov    %eax,%ecx
+  804861:	83 c9 04             	or     $0x4,%ecx
+  804864:	f6 c2 01             	test   $0x1,%dl
+  804867:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80486a:	89 c1                	mov    %eax,%ecx
+  80486c:	83 c9 02             	or     $0x2,%ecx
+  80486f:	f6 c2 02             	test   $0x2,%dl
+  804872:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804875:	89 c1                	mov    %eax,%ecx
+  804877:	83 c9 01             	or     $0x1,%ecx
+  80487a:	48 85 d2             	test   %rdx,%rdx
+  80487d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804880:	89 c1                	mov    %eax,%ecx
+  804882:	83 c9 40             	or     $0x40,%ecx
+  804885:	f6 c6 04             	test   $0x4,%dh
+  804888:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80488b:	5d                   	pop    %rbp
+  80488c:	c3                   	ret
+
+000000000080488d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80488d:	55                   	push   %rbp
+  80488e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804891:	48 b8 93 47 80 00 00 	movabs $0x804793,%rax
+  804898:	00 00 00 
+  80489b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80489d:	48 c1 e8 06          	shr    $0x6,%rax
+  8048a1:	83 e0 01             	and    $0x1,%eax
+}
+  8048a4:	5d                   	pop    %rbp
+  8048a5:	c3                   	ret
+
+00000000008048a6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8048a6:	55                   	push   %rbp
+  8048a7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8048aa:	48 b8 93 47 80 00 00 	movabs $0x804793,%rax
+  8048b1:	00 00 00 
+  8048b4:	ff d0                	call   *%rax
+  8048b6:	83 e0 01             	and    $0x1,%eax
+}
+  8048b9:	5d                   	pop    %rbp
+  8048ba:	c3                   	ret
+
+00000000008048bb <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8048bb:	55                   	push   %rbp
+  8048bc:	48 89 e5             	mov    %rsp,%rbp
+  8048bf:	41 57                	push   %r15
+  8048c1:	41 56                	push   %r14
+  8048c3:	41 55                	push   %r13
+  8048c5:	41 54                	push   %r12
+  8048c7:	53                   	push   %rbx
+  8048c8:	48 83 ec 28          	sub    $0x28,%rsp
+  8048cc:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8048d0:	48 85 ff             	test   %rdi,%rdi
+  8048d3:	74 1e                	je     8048f3 <foreach_shared_region+0x38>
+  8048d5:	49 89 ff             	mov    %rdi,%r15
+  8048d8:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8048de:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8048e4:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8048eb:	01 00 00 
+  8048ee:	e9 72 02 00 00       	jmp    804b65 <foreach_shared_region+0x2aa>
+    assert(fun);
+  8048f3:	48 b9 6c 69 80 00 00 	movabs $0x80696c,%rcx
+  8048fa:	00 00 00 
+  8048fd:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  804904:	00 00 00 
+  804907:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80490c:	48 bf 70 69 80 00 00 	movabs $0x806970,%rdi
+  804913:	00 00 00 
+  804916:	b8 00 00 00 00       	mov    $0x0,%eax
+  80491b:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  804922:	00 00 00 
+  804925:	41 ff d0             	call   *%r8
+  804928:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80492f:	eb 6c                	jmp    80499d <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804931:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804938:	ff ff ff 
+  80493b:	4c 21 e2             	and    %r12,%rdx
+  80493e:	48 89 d8             	mov    %rbx,%rax
+  804941:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804946:	48 83 c0 01          	add    $0x1,%rax
+  80494a:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80494e:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804955:	00 00 00 
+  804958:	48 21 c8             	and    %rcx,%rax
+  80495b:	48 09 d0             	or     %rdx,%rax
+  80495e:	49 89 c4             	mov    %rax,%r12
+  804961:	eb 30                	jmp    804993 <foreach_shared_region+0xd8>
+  804963:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80496a:	ff ff ff 
+  80496d:	4c 21 e2             	and    %r12,%rdx
+  804970:	48 89 d8             	mov    %rbx,%rax
+  804973:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804978:	48 83 c0 01          	add    $0x1,%rax
+  80497c:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804980:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804987:	00 00 00 
+  80498a:	48 21 c8             	and    %rcx,%rax
+  80498d:	48 09 d0             	or     %rdx,%rax
+  804990:	49 89 c4             	mov    %rax,%r12
+  804993:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804997:	0f 84 99 01 00 00    	je     804b36 <foreach_shared_region+0x27b>
+  80499d:	4c 89 e3             	mov    %r12,%rbx
+  8049a0:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8049a4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8049ab:	01 00 00 
+  8049ae:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8049b2:	a8 01                	test   $0x1,%al
+  8049b4:	0f 84 77 ff ff ff    	je     804931 <foreach_shared_region+0x76>
+  8049ba:	a8 80                	test   $0x80,%al
+  8049bc:	74 19                	je     8049d7 <foreach_shared_region+0x11c>
+  8049be:	f6 c4 04             	test   $0x4,%ah
+  8049c1:	74 a0                	je     804963 <foreach_shared_region+0xa8>
+  8049c3:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8049ca:	40 
+  8049cb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049cf:	4c 89 e7             	mov    %r12,%rdi
+  8049d2:	41 ff d7             	call   *%r15
+  8049d5:	eb 8c                	jmp    804963 <foreach_shared_region+0xa8>
+  8049d7:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8049de:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8049e2:	eb 46                	jmp    804a2a <foreach_shared_region+0x16f>
+  8049e4:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8049eb:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049f1:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8049f5:	48 c1 e0 15          	shl    $0x15,%rax
+  8049f9:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8049fe:	49 09 c4             	or     %rax,%r12
+  804a01:	eb 1d                	jmp    804a20 <foreach_shared_region+0x165>
+  804a03:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a0a:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a10:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a14:	48 c1 e0 15          	shl    $0x15,%rax
+  804a18:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a1d:	49 09 c4             	or     %rax,%r12
+  804a20:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804a24:	0f 84 d3 00 00 00    	je     804afd <foreach_shared_region+0x242>
+  804a2a:	4c 89 e3             	mov    %r12,%rbx
+  804a2d:	48 c1 eb 15          	shr    $0x15,%rbx
+  804a31:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804a38:	01 00 00 
+  804a3b:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a3f:	a8 01                	test   $0x1,%al
+  804a41:	74 a1                	je     8049e4 <foreach_shared_region+0x129>
+  804a43:	a8 80                	test   $0x80,%al
+  804a45:	74 19                	je     804a60 <foreach_shared_region+0x1a5>
+  804a47:	f6 c4 04             	test   $0x4,%ah
+  804a4a:	74 b7                	je     804a03 <foreach_shared_region+0x148>
+  804a4c:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804a53:	00 
+  804a54:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a58:	4c 89 e7             	mov    %r12,%rdi
+  804a5b:	41 ff d7             	call   *%r15
+  804a5e:	eb a3                	jmp    804a03 <foreach_shared_region+0x148>
+  804a60:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804a66:	eb 3b                	jmp    804aa3 <foreach_shared_region+0x1e8>
+  804a68:	f6 c4 04             	test   $0x4,%ah
+  804a6b:	74 12                	je     804a7f <foreach_shared_region+0x1c4>
+  804a6d:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804a74:	00 
+  804a75:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a79:	4c 89 e7             	mov    %r12,%rdi
+  804a7c:	41 ff d7             	call   *%r15
+  804a7f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804a86:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a8c:	48 83 c3 01          	add    $0x1,%rbx
+  804a90:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804a94:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804a9a:	49 09 dc             	or     %rbx,%r12
+  804a9d:	41 83 ed 01          	sub    $0x1,%r13d
+  804aa1:	74 2f                	je     804ad2 <foreach_shared_region+0x217>
+  804aa3:	4c 89 e3             	mov    %r12,%rbx
+  804aa6:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804aaa:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804aae:	a8 01                	test   $0x1,%al
+  804ab0:	75 b6                	jne    804a68 <foreach_shared_region+0x1ad>
+  804ab2:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804ab9:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804abf:	48 83 c3 01          	add    $0x1,%rbx
+  804ac3:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804ac7:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804acd:	49 09 dc             	or     %rbx,%r12
+  804ad0:	eb cb                	jmp    804a9d <foreach_shared_region+0x1e2>
+  804ad2:	4c 89 e0             	mov    %r12,%rax
+  804ad5:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804adb:	49 c1 ec 15          	shr    $0x15,%r12
+  804adf:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804ae6:	49 83 c4 01          	add    $0x1,%r12
+  804aea:	49 c1 e4 15          	shl    $0x15,%r12
+  804aee:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804af5:	49 09 c4             	or     %rax,%r12
+  804af8:	e9 23 ff ff ff       	jmp    804a20 <foreach_shared_region+0x165>
+  804afd:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804b01:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804b08:	ff ff ff 
+  804b0b:	4c 21 e0             	and    %r12,%rax
+  804b0e:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804b12:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b19:	49 83 c4 01          	add    $0x1,%r12
+  804b1d:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804b21:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804b28:	00 00 00 
+  804b2b:	49 21 d4             	and    %rdx,%r12
+  804b2e:	49 09 c4             	or     %rax,%r12
+  804b31:	e9 5d fe ff ff       	jmp    804993 <foreach_shared_region+0xd8>
+  804b36:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804b3d:	00 ff ff 
+  804b40:	4c 21 e0             	and    %r12,%rax
+  804b43:	49 c1 ec 27          	shr    $0x27,%r12
+  804b47:	49 83 c4 01          	add    $0x1,%r12
+  804b4b:	49 c1 e4 27          	shl    $0x27,%r12
+  804b4f:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804b56:	ff 00 00 
+  804b59:	49 21 d4             	and    %rdx,%r12
+  804b5c:	49 09 c4             	or     %rax,%r12
+  804b5f:	41 83 ed 01          	sub    $0x1,%r13d
+  804b63:	74 48                	je     804bad <foreach_shared_region+0x2f2>
+  804b65:	4c 89 e0             	mov    %r12,%rax
+  804b68:	48 c1 e8 27          	shr    $0x27,%rax
+  804b6c:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804b73:	01 00 00 
+  804b76:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804b7a:	f6 c2 01             	test   $0x1,%dl
+  804b7d:	0f 85 a5 fd ff ff    	jne    804928 <foreach_shared_region+0x6d>
+  804b83:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804b8a:	00 ff ff 
+  804b8d:	4c 21 e2             	and    %r12,%rdx
+  804b90:	48 83 c0 01          	add    $0x1,%rax
+  804b94:	48 c1 e0 27          	shl    $0x27,%rax
+  804b98:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804b9f:	ff 00 00 
+  804ba2:	48 21 c8             	and    %rcx,%rax
+  804ba5:	48 09 d0             	or     %rdx,%rax
+  804ba8:	49 89 c4             	mov    %rax,%r12
+  804bab:	eb b2                	jmp    804b5f <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804bad:	4d 85 e4             	test   %r12,%r12
+  804bb0:	75 14                	jne    804bc6 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bb7:	48 83 c4 28          	add    $0x28,%rsp
+  804bbb:	5b                   	pop    %rbx
+  804bbc:	41 5c                	pop    %r12
+  804bbe:	41 5d                	pop    %r13
+  804bc0:	41 5e                	pop    %r14
+  804bc2:	41 5f                	pop    %r15
+  804bc4:	5d                   	pop    %rbp
+  804bc5:	c3                   	ret
+    assert(addr == 0);
+  804bc6:	48 b9 7b 69 80 00 00 	movabs $0x80697b,%rcx
+  804bcd:	00 00 00 
+  804bd0:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  804bd7:	00 00 00 
+  804bda:	be 67 00 00 00       	mov    $0x67,%esi
+  804bdf:	48 bf 70 69 80 00 00 	movabs $0x806970,%rdi
+  804be6:	00 00 00 
+  804be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bee:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  804bf5:	00 00 00 
+  804bf8:	41 ff d0             	call   *%r8
+
+0000000000804bfb <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804bfb:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804c02:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804c05:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804c0b:	eb 33                	jmp    804c40 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c0d:	48 83 c0 20          	add    $0x20,%rax
+  804c11:	4c 39 c0             	cmp    %r8,%rax
+  804c14:	74 25                	je     804c3b <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804c16:	48 8b 10             	mov    (%rax),%rdx
+  804c19:	48 85 d2             	test   %rdx,%rdx
+  804c1c:	74 ef                	je     804c0d <mmap_place+0x12>
+  804c1e:	48 89 d1             	mov    %rdx,%rcx
+  804c21:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c25:	48 39 cf             	cmp    %rcx,%rdi
+  804c28:	73 e3                	jae    804c0d <mmap_place+0x12>
+  804c2a:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804c2e:	4c 39 ca             	cmp    %r9,%rdx
+  804c31:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804c35:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804c39:	eb d2                	jmp    804c0d <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804c3b:	45 84 d2             	test   %r10b,%r10b
+  804c3e:	74 12                	je     804c52 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c40:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c47:	00 00 00 
+        moved = 0;
+  804c4a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804c50:	eb c4                	jmp    804c16 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804c52:	48 01 fe             	add    %rdi,%rsi
+  804c55:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804c5c:	00 00 00 
+  804c5f:	48 39 f0             	cmp    %rsi,%rax
+  804c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c67:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804c6b:	c3                   	ret
+
+0000000000804c6c <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804c6c:	55                   	push   %rbp
+  804c6d:	48 89 e5             	mov    %rsp,%rbp
+  804c70:	41 57                	push   %r15
+  804c72:	41 56                	push   %r14
+  804c74:	41 55                	push   %r13
+  804c76:	41 54                	push   %r12
+  804c78:	53                   	push   %rbx
+  804c79:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804c7d:	48 8b 1f             	mov    (%rdi),%rbx
+  804c80:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c87:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c8e:	00 00 00 
+  804c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c96:	eb 12                	jmp    804caa <mmap_pgfault+0x3e>
+  804c98:	48 83 c2 01          	add    $0x1,%rdx
+  804c9c:	48 83 c0 20          	add    $0x20,%rax
+  804ca0:	48 83 fa 20          	cmp    $0x20,%rdx
+  804ca4:	0f 84 04 01 00 00    	je     804dae <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804caa:	48 8b 08             	mov    (%rax),%rcx
+  804cad:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804cb1:	48 39 de             	cmp    %rbx,%rsi
+  804cb4:	73 e2                	jae    804c98 <mmap_pgfault+0x2c>
+  804cb6:	48 03 48 08          	add    0x8(%rax),%rcx
+  804cba:	48 39 cb             	cmp    %rcx,%rbx
+  804cbd:	73 d9                	jae    804c98 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804cbf:	48 c1 e2 05          	shl    $0x5,%rdx
+  804cc3:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cca:	00 00 00 
+  804ccd:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804cd1:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804cd5:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804cd9:	f6 c2 01             	test   $0x1,%dl
+  804cdc:	0f 84 e0 00 00 00    	je     804dc2 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ce7:	f6 c2 02             	test   $0x2,%dl
+  804cea:	0f 84 c3 00 00 00    	je     804db3 <mmap_pgfault+0x147>
+  804cf0:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804cf7:	ff ff ff 
+  804cfa:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804cfe:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804d05:	00 00 00 
+  804d08:	48 39 ca             	cmp    %rcx,%rdx
+  804d0b:	0f 85 a2 00 00 00    	jne    804db3 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804d11:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804d16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d1b:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804d22:	00 00 00 
+  804d25:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d2a:	48 b8 09 2b 80 00 00 	movabs $0x802b09,%rax
+  804d31:	00 00 00 
+  804d34:	ff d0                	call   *%rax
+  804d36:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3d:	85 d2                	test   %edx,%edx
+  804d3f:	78 72                	js     804db3 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804d41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d46:	48 89 de             	mov    %rbx,%rsi
+  804d49:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804d50:	00 00 00 
+  804d53:	4c 89 e7             	mov    %r12,%rdi
+  804d56:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  804d5d:	00 00 00 
+  804d60:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804d62:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804d68:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804d6e:	48 89 d9             	mov    %rbx,%rcx
+  804d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d76:	4c 89 e6             	mov    %r12,%rsi
+  804d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d7e:	48 b8 76 2b 80 00 00 	movabs $0x802b76,%rax
+  804d85:	00 00 00 
+  804d88:	ff d0                	call   *%rax
+  804d8a:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804d8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d91:	4c 89 e6             	mov    %r12,%rsi
+  804d94:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d99:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  804da0:	00 00 00 
+  804da3:	ff d0                	call   *%rax
+    return res >= 0;
+  804da5:	89 d8                	mov    %ebx,%eax
+  804da7:	f7 d0                	not    %eax
+  804da9:	c1 e8 1f             	shr    $0x1f,%eax
+  804dac:	eb 05                	jmp    804db3 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804dae:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804db3:	48 83 c4 18          	add    $0x18,%rsp
+  804db7:	5b                   	pop    %rbx
+  804db8:	41 5c                	pop    %r12
+  804dba:	41 5d                	pop    %r13
+  804dbc:	41 5e                	pop    %r14
+  804dbe:	41 5f                	pop    %r15
+  804dc0:	5d                   	pop    %rbp
+  804dc1:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804dc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dc6:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804dca:	4c 03 30             	add    (%rax),%r14
+  804dcd:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804dd4:	49 39 c6             	cmp    %rax,%r14
+  804dd7:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ddb:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804de2:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804de8:	49 bf a6 48 80 00 00 	movabs $0x8048a6,%r15
+  804def:	00 00 00 
+  804df2:	4d 39 f4             	cmp    %r14,%r12
+  804df5:	73 1d                	jae    804e14 <mmap_pgfault+0x1a8>
+  804df7:	4c 89 e7             	mov    %r12,%rdi
+  804dfa:	41 ff d7             	call   *%r15
+  804dfd:	84 c0                	test   %al,%al
+  804dff:	75 13                	jne    804e14 <mmap_pgfault+0x1a8>
+  804e01:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804e08:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804e0f:	4d 39 f4             	cmp    %r14,%r12
+  804e12:	72 e3                	jb     804df7 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e14:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804e1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e1e:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804e22:	74 2a                	je     804e4e <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804e24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e28:	89 de                	mov    %ebx,%esi
+  804e2a:	2b 30                	sub    (%rax),%esi
+  804e2c:	03 70 1c             	add    0x1c(%rax),%esi
+  804e2f:	8b 78 18             	mov    0x18(%rax),%edi
+  804e32:	4c 89 e9             	mov    %r13,%rcx
+  804e35:	48 89 da             	mov    %rbx,%rdx
+  804e38:	48 b8 04 40 80 00 00 	movabs $0x804004,%rax
+  804e3f:	00 00 00 
+  804e42:	ff d0                	call   *%rax
+    return res > 0;
+  804e44:	85 c0                	test   %eax,%eax
+  804e46:	0f 9f c0             	setg   %al
+  804e49:	e9 65 ff ff ff       	jmp    804db3 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e4e:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804e52:	eb d0                	jmp    804e24 <mmap_pgfault+0x1b8>
+
+0000000000804e54 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804e54:	55                   	push   %rbp
+  804e55:	48 89 e5             	mov    %rsp,%rbp
+  804e58:	41 57                	push   %r15
+  804e5a:	41 56                	push   %r14
+  804e5c:	41 55                	push   %r13
+  804e5e:	41 54                	push   %r12
+  804e60:	53                   	push   %rbx
+  804e61:	48 83 ec 28          	sub    $0x28,%rsp
+  804e65:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804e69:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804e6c:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804e73:	ff ff ff 
+  804e76:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e7f:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804e86:	00 00 00 
+  804e89:	48 39 ca             	cmp    %rcx,%rdx
+  804e8c:	0f 85 e5 00 00 00    	jne    804f77 <mmap_writeback+0x123>
+  804e92:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804e95:	4c 39 ee             	cmp    %r13,%rsi
+  804e98:	0f 83 e8 00 00 00    	jae    804f86 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804e9e:	49 be a6 48 80 00 00 	movabs $0x8048a6,%r14
+  804ea5:	00 00 00 
+  804ea8:	49 bf 8d 48 80 00 00 	movabs $0x80488d,%r15
+  804eaf:	00 00 00 
+  804eb2:	eb 10                	jmp    804ec4 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804eb4:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804ebb:	4d 39 ec             	cmp    %r13,%r12
+  804ebe:	0f 83 ae 00 00 00    	jae    804f72 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ec4:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804ec8:	4c 89 e7             	mov    %r12,%rdi
+  804ecb:	41 ff d6             	call   *%r14
+  804ece:	84 c0                	test   %al,%al
+  804ed0:	74 e2                	je     804eb4 <mmap_writeback+0x60>
+  804ed2:	4c 89 e7             	mov    %r12,%rdi
+  804ed5:	41 ff d7             	call   *%r15
+  804ed8:	84 c0                	test   %al,%al
+  804eda:	74 d8                	je     804eb4 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804edc:	4c 89 e3             	mov    %r12,%rbx
+  804edf:	4d 39 ec             	cmp    %r13,%r12
+  804ee2:	73 20                	jae    804f04 <mmap_writeback+0xb0>
+  804ee4:	48 89 df             	mov    %rbx,%rdi
+  804ee7:	41 ff d6             	call   *%r14
+  804eea:	84 c0                	test   %al,%al
+  804eec:	74 16                	je     804f04 <mmap_writeback+0xb0>
+  804eee:	48 89 df             	mov    %rbx,%rdi
+  804ef1:	41 ff d7             	call   *%r15
+  804ef4:	84 c0                	test   %al,%al
+  804ef6:	74 0c                	je     804f04 <mmap_writeback+0xb0>
+  804ef8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804eff:	4c 39 eb             	cmp    %r13,%rbx
+  804f02:	72 e0                	jb     804ee4 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804f04:	48 89 d9             	mov    %rbx,%rcx
+  804f07:	4c 29 e1             	sub    %r12,%rcx
+  804f0a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f0e:	44 89 e6             	mov    %r12d,%esi
+  804f11:	2b 30                	sub    (%rax),%esi
+  804f13:	49 89 c4             	mov    %rax,%r12
+  804f16:	03 70 1c             	add    0x1c(%rax),%esi
+  804f19:	8b 78 18             	mov    0x18(%rax),%edi
+  804f1c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804f20:	48 89 ca             	mov    %rcx,%rdx
+  804f23:	48 b8 8d 40 80 00 00 	movabs $0x80408d,%rax
+  804f2a:	00 00 00 
+  804f2d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804f2f:	85 c0                	test   %eax,%eax
+  804f31:	78 44                	js     804f77 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804f33:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804f38:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804f3b:	41 89 c1             	mov    %eax,%r9d
+  804f3e:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804f45:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804f49:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f52:	48 89 ce             	mov    %rcx,%rsi
+  804f55:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f5a:	48 b8 76 2b 80 00 00 	movabs $0x802b76,%rax
+  804f61:	00 00 00 
+  804f64:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804f66:	85 c0                	test   %eax,%eax
+  804f68:	78 0d                	js     804f77 <mmap_writeback+0x123>
+  804f6a:	49 89 dc             	mov    %rbx,%r12
+  804f6d:	e9 49 ff ff ff       	jmp    804ebb <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804f72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f77:	48 83 c4 28          	add    $0x28,%rsp
+  804f7b:	5b                   	pop    %rbx
+  804f7c:	41 5c                	pop    %r12
+  804f7e:	41 5d                	pop    %r13
+  804f80:	41 5e                	pop    %r14
+  804f82:	41 5f                	pop    %r15
+  804f84:	5d                   	pop    %rbp
+  804f85:	c3                   	ret
+    return 0;
+  804f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f8b:	eb ea                	jmp    804f77 <mmap_writeback+0x123>
+
+0000000000804f8d <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804f8d:	55                   	push   %rbp
+  804f8e:	48 89 e5             	mov    %rsp,%rbp
+  804f91:	41 57                	push   %r15
+  804f93:	41 56                	push   %r14
+  804f95:	41 55                	push   %r13
+  804f97:	41 54                	push   %r12
+  804f99:	53                   	push   %rbx
+  804f9a:	48 83 ec 38          	sub    $0x38,%rsp
+  804f9e:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804fa2:	48 85 f6             	test   %rsi,%rsi
+  804fa5:	0f 84 0c 02 00 00    	je     8051b7 <mmap+0x22a>
+  804fab:	49 89 ff             	mov    %rdi,%r15
+  804fae:	49 89 f4             	mov    %rsi,%r12
+  804fb1:	41 89 d5             	mov    %edx,%r13d
+  804fb4:	41 89 ce             	mov    %ecx,%r14d
+  804fb7:	44 89 cb             	mov    %r9d,%ebx
+  804fba:	45 85 c9             	test   %r9d,%r9d
+  804fbd:	0f 88 f4 01 00 00    	js     8051b7 <mmap+0x22a>
+  804fc3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fca:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804fd1:	0f 85 e7 01 00 00    	jne    8051be <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804fd7:	83 e2 fd             	and    $0xfffffffd,%edx
+  804fda:	83 fa 04             	cmp    $0x4,%edx
+  804fdd:	0f 85 db 01 00 00    	jne    8051be <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804fe3:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804fe6:	83 fa 01             	cmp    $0x1,%edx
+  804fe9:	0f 87 cf 01 00 00    	ja     8051be <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804fef:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804ff3:	44 89 c7             	mov    %r8d,%edi
+  804ff6:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  804ffd:	00 00 00 
+  805000:	ff d0                	call   *%rax
+  805002:	89 c2                	mov    %eax,%edx
+  805004:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80500b:	85 d2                	test   %edx,%edx
+  80500d:	0f 88 ab 01 00 00    	js     8051be <mmap+0x231>
+  805013:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805017:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80501e:	00 00 00 
+  805021:	8b 09                	mov    (%rcx),%ecx
+  805023:	39 0a                	cmp    %ecx,(%rdx)
+  805025:	0f 85 93 01 00 00    	jne    8051be <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  80502b:	8b 52 08             	mov    0x8(%rdx),%edx
+  80502e:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  805031:	83 fa 01             	cmp    $0x1,%edx
+  805034:	0f 84 84 01 00 00    	je     8051be <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80503a:	41 83 fe 01          	cmp    $0x1,%r14d
+  80503e:	74 42                	je     805082 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805040:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805047:	4c 89 e6             	mov    %r12,%rsi
+  80504a:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  805051:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805055:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805059:	4d 85 ff             	test   %r15,%r15
+  80505c:	74 67                	je     8050c5 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80505e:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805065:	75 0f                	jne    805076 <mmap+0xe9>
+  805067:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  80506e:	00 00 00 
+  805071:	49 39 c7             	cmp    %rax,%r15
+  805074:	77 1b                	ja     805091 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805076:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80507d:	e9 3c 01 00 00       	jmp    8051be <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805082:	41 f6 c5 02          	test   $0x2,%r13b
+  805086:	74 b8                	je     805040 <mmap+0xb3>
+  805088:	85 d2                	test   %edx,%edx
+  80508a:	75 b4                	jne    805040 <mmap+0xb3>
+  80508c:	e9 2d 01 00 00       	jmp    8051be <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805091:	4c 89 ff             	mov    %r15,%rdi
+  805094:	48 b8 fb 4b 80 00 00 	movabs $0x804bfb,%rax
+  80509b:	00 00 00 
+  80509e:	ff d0                	call   *%rax
+  8050a0:	48 89 c2             	mov    %rax,%rdx
+  8050a3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050aa:	49 39 d7             	cmp    %rdx,%r15
+  8050ad:	0f 85 0b 01 00 00    	jne    8051be <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8050b3:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8050ba:	00 00 00 
+  8050bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050c3:	eb 44                	jmp    805109 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8050c5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8050c9:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  8050d0:	00 00 00 
+  8050d3:	48 b8 fb 4b 80 00 00 	movabs $0x804bfb,%rax
+  8050da:	00 00 00 
+  8050dd:	ff d0                	call   *%rax
+  8050df:	48 89 c7             	mov    %rax,%rdi
+  8050e2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  8050e6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8050ed:	48 85 ff             	test   %rdi,%rdi
+  8050f0:	75 c1                	jne    8050b3 <mmap+0x126>
+  8050f2:	e9 c7 00 00 00       	jmp    8051be <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8050f7:	49 83 c4 01          	add    $0x1,%r12
+  8050fb:	48 83 c0 20          	add    $0x20,%rax
+  8050ff:	49 83 fc 20          	cmp    $0x20,%r12
+  805103:	0f 84 a5 00 00 00    	je     8051ae <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805109:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80510d:	75 e8                	jne    8050f7 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  80510f:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805113:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  80511a:	00 00 00 
+  80511d:	ff d0                	call   *%rax
+  80511f:	89 c2                	mov    %eax,%edx
+  805121:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805128:	85 d2                	test   %edx,%edx
+  80512a:	0f 88 8e 00 00 00    	js     8051be <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805130:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805134:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  80513b:	00 00 00 
+  80513e:	ff d0                	call   *%rax
+  805140:	89 c6                	mov    %eax,%esi
+  805142:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805145:	48 b8 67 35 80 00 00 	movabs $0x803567,%rax
+  80514c:	00 00 00 
+  80514f:	ff d0                	call   *%rax
+  805151:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805154:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80515b:	45 85 ff             	test   %r15d,%r15d
+  80515e:	78 5e                	js     8051be <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805160:	49 c1 e4 05          	shl    $0x5,%r12
+  805164:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80516b:	00 00 00 
+  80516e:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805171:	48 bf 6c 4c 80 00 00 	movabs $0x804c6c,%rdi
+  805178:	00 00 00 
+  80517b:	48 b8 97 56 80 00 00 	movabs $0x805697,%rax
+  805182:	00 00 00 
+  805185:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805187:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80518b:	49 89 04 24          	mov    %rax,(%r12)
+  80518f:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805193:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805198:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  80519d:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8051a2:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8051a7:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8051ac:	eb 10                	jmp    8051be <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8051ae:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051b5:	eb 07                	jmp    8051be <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8051b7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8051be:	48 83 c4 38          	add    $0x38,%rsp
+  8051c2:	5b                   	pop    %rbx
+  8051c3:	41 5c                	pop    %r12
+  8051c5:	41 5d                	pop    %r13
+  8051c7:	41 5e                	pop    %r14
+  8051c9:	41 5f                	pop    %r15
+  8051cb:	5d                   	pop    %rbp
+  8051cc:	c3                   	ret
+
+00000000008051cd <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8051cd:	55                   	push   %rbp
+  8051ce:	48 89 e5             	mov    %rsp,%rbp
+  8051d1:	41 57                	push   %r15
+  8051d3:	41 56                	push   %r14
+  8051d5:	41 55                	push   %r13
+  8051d7:	41 54                	push   %r12
+  8051d9:	53                   	push   %rbx
+  8051da:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8051de:	49 89 fe             	mov    %rdi,%r14
+  8051e1:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8051e8:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8051ef:	00 
+  8051f0:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051f7:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8051fe:	00 00 00 
+  805201:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805208:	49 bf 54 4e 80 00 00 	movabs $0x804e54,%r15
+  80520f:	00 00 00 
+  805212:	eb 09                	jmp    80521d <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805214:	48 83 c3 20          	add    $0x20,%rbx
+  805218:	4c 39 eb             	cmp    %r13,%rbx
+  80521b:	74 33                	je     805250 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80521d:	48 89 df             	mov    %rbx,%rdi
+  805220:	48 8b 33             	mov    (%rbx),%rsi
+  805223:	4c 39 e6             	cmp    %r12,%rsi
+  805226:	73 ec                	jae    805214 <msync+0x47>
+  805228:	48 85 f6             	test   %rsi,%rsi
+  80522b:	74 e7                	je     805214 <msync+0x47>
+  80522d:	48 89 f2             	mov    %rsi,%rdx
+  805230:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805234:	49 39 d6             	cmp    %rdx,%r14
+  805237:	73 db                	jae    805214 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805239:	4c 39 e2             	cmp    %r12,%rdx
+  80523c:	49 0f 47 d4          	cmova  %r12,%rdx
+  805240:	4c 39 f6             	cmp    %r14,%rsi
+  805243:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805247:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  80524a:	85 c0                	test   %eax,%eax
+  80524c:	79 c6                	jns    805214 <msync+0x47>
+  80524e:	eb 05                	jmp    805255 <msync+0x88>
+    }
+
+    return 0;
+  805250:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805255:	48 83 c4 08          	add    $0x8,%rsp
+  805259:	5b                   	pop    %rbx
+  80525a:	41 5c                	pop    %r12
+  80525c:	41 5d                	pop    %r13
+  80525e:	41 5e                	pop    %r14
+  805260:	41 5f                	pop    %r15
+  805262:	5d                   	pop    %rbp
+  805263:	c3                   	ret
+
+0000000000805264 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805264:	55                   	push   %rbp
+  805265:	48 89 e5             	mov    %rsp,%rbp
+  805268:	41 57                	push   %r15
+  80526a:	41 56                	push   %r14
+  80526c:	41 55                	push   %r13
+  80526e:	41 54                	push   %r12
+  805270:	53                   	push   %rbx
+  805271:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805275:	49 89 ff             	mov    %rdi,%r15
+  805278:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80527f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805286:	00 
+  805287:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80528e:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805295:	00 00 00 
+  805298:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80529f:	48 89 d8             	mov    %rbx,%rax
+  8052a2:	eb 09                	jmp    8052ad <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052a4:	48 83 c0 20          	add    $0x20,%rax
+  8052a8:	4c 39 f0             	cmp    %r14,%rax
+  8052ab:	74 40                	je     8052ed <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052ad:	48 8b 10             	mov    (%rax),%rdx
+  8052b0:	4c 39 e2             	cmp    %r12,%rdx
+  8052b3:	73 ef                	jae    8052a4 <munmap+0x40>
+  8052b5:	48 85 d2             	test   %rdx,%rdx
+  8052b8:	74 ea                	je     8052a4 <munmap+0x40>
+  8052ba:	48 89 d7             	mov    %rdx,%rdi
+  8052bd:	48 03 78 08          	add    0x8(%rax),%rdi
+  8052c1:	49 39 ff             	cmp    %rdi,%r15
+  8052c4:	73 de                	jae    8052a4 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8052c6:	49 39 fc             	cmp    %rdi,%r12
+  8052c9:	72 05                	jb     8052d0 <munmap+0x6c>
+  8052cb:	4c 39 fa             	cmp    %r15,%rdx
+  8052ce:	73 d4                	jae    8052a4 <munmap+0x40>
+  8052d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8052d5:	48 83 c4 08          	add    $0x8,%rsp
+  8052d9:	5b                   	pop    %rbx
+  8052da:	41 5c                	pop    %r12
+  8052dc:	41 5d                	pop    %r13
+  8052de:	41 5e                	pop    %r14
+  8052e0:	41 5f                	pop    %r15
+  8052e2:	5d                   	pop    %rbp
+  8052e3:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052e4:	48 83 c3 20          	add    $0x20,%rbx
+  8052e8:	4c 39 f3             	cmp    %r14,%rbx
+  8052eb:	74 5c                	je     805349 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052ed:	48 8b 33             	mov    (%rbx),%rsi
+  8052f0:	4c 39 e6             	cmp    %r12,%rsi
+  8052f3:	73 ef                	jae    8052e4 <munmap+0x80>
+  8052f5:	48 85 f6             	test   %rsi,%rsi
+  8052f8:	74 ea                	je     8052e4 <munmap+0x80>
+  8052fa:	48 89 f2             	mov    %rsi,%rdx
+  8052fd:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805301:	49 39 d7             	cmp    %rdx,%r15
+  805304:	73 de                	jae    8052e4 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805306:	48 89 df             	mov    %rbx,%rdi
+  805309:	48 b8 54 4e 80 00 00 	movabs $0x804e54,%rax
+  805310:	00 00 00 
+  805313:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805315:	85 c0                	test   %eax,%eax
+  805317:	78 bc                	js     8052d5 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805319:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80531d:	48 8b 33             	mov    (%rbx),%rsi
+  805320:	bf 00 00 00 00       	mov    $0x0,%edi
+  805325:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  80532c:	00 00 00 
+  80532f:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805331:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805334:	48 b8 0c 35 80 00 00 	movabs $0x80350c,%rax
+  80533b:	00 00 00 
+  80533e:	ff d0                	call   *%rax
+        reg->start = 0;
+  805340:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805347:	eb 9b                	jmp    8052e4 <munmap+0x80>
+    return 0;
+  805349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80534e:	eb 85                	jmp    8052d5 <munmap+0x71>
+
+0000000000805350 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805350:	b8 00 00 00 00       	mov    $0x0,%eax
+  805355:	c3                   	ret
+
+0000000000805356 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805356:	55                   	push   %rbp
+  805357:	48 89 e5             	mov    %rsp,%rbp
+  80535a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80535d:	48 be 85 69 80 00 00 	movabs $0x806985,%rsi
+  805364:	00 00 00 
+  805367:	48 b8 a4 23 80 00 00 	movabs $0x8023a4,%rax
+  80536e:	00 00 00 
+  805371:	ff d0                	call   *%rax
+    return 0;
+}
+  805373:	b8 00 00 00 00       	mov    $0x0,%eax
+  805378:	5d                   	pop    %rbp
+  805379:	c3                   	ret
+
+000000000080537a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80537a:	55                   	push   %rbp
+  80537b:	48 89 e5             	mov    %rsp,%rbp
+  80537e:	41 57                	push   %r15
+  805380:	41 56                	push   %r14
+  805382:	41 55                	push   %r13
+  805384:	41 54                	push   %r12
+  805386:	53                   	push   %rbx
+  805387:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80538e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805395:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80539c:	00 00 00 00 
+  8053a0:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8053a7:	00 00 00 00 
+  8053ab:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8053b2:	00 00 00 00 
+  8053b6:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8053bd:	00 00 00 00 
+  8053c1:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8053c8:	00 00 00 00 
+  8053cc:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8053d3:	00 00 00 00 
+  8053d7:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8053de:	00 
+  8053df:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8053e6:	00 
+  8053e7:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8053ee:	00 
+  8053ef:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8053f6:	00 
+  8053f7:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8053fe:	00 
+  8053ff:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805406:	00 
+  805407:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80540e:	00 
+  80540f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805416:	00 
+  805417:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80541e:	00 
+  80541f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805426:	00 
+    for (res = 0; res < n; res += inc) {
+  805427:	48 85 d2             	test   %rdx,%rdx
+  80542a:	74 7a                	je     8054a6 <devcons_write+0x12c>
+  80542c:	49 89 d6             	mov    %rdx,%r14
+  80542f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805435:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80543a:	49 bf f4 26 80 00 00 	movabs $0x8026f4,%r15
+  805441:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805444:	4c 89 f3             	mov    %r14,%rbx
+  805447:	48 29 f3             	sub    %rsi,%rbx
+  80544a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80544f:	48 39 c3             	cmp    %rax,%rbx
+  805452:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805456:	4c 63 eb             	movslq %ebx,%r13
+  805459:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805460:	48 01 c6             	add    %rax,%rsi
+  805463:	4c 89 ea             	mov    %r13,%rdx
+  805466:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80546d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805470:	4c 89 ee             	mov    %r13,%rsi
+  805473:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80547a:	48 b8 21 29 80 00 00 	movabs $0x802921,%rax
+  805481:	00 00 00 
+  805484:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805486:	41 01 dc             	add    %ebx,%r12d
+  805489:	49 63 f4             	movslq %r12d,%rsi
+  80548c:	4c 39 f6             	cmp    %r14,%rsi
+  80548f:	72 b3                	jb     805444 <devcons_write+0xca>
+    return res;
+  805491:	49 63 c4             	movslq %r12d,%rax
+}
+  805494:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80549b:	5b                   	pop    %rbx
+  80549c:	41 5c                	pop    %r12
+  80549e:	41 5d                	pop    %r13
+  8054a0:	41 5e                	pop    %r14
+  8054a2:	41 5f                	pop    %r15
+  8054a4:	5d                   	pop    %rbp
+  8054a5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8054a6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054ac:	eb e3                	jmp    805491 <devcons_write+0x117>
+
+00000000008054ae <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054ae:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8054b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054b6:	48 85 c0             	test   %rax,%rax
+  8054b9:	74 55                	je     805510 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054bb:	55                   	push   %rbp
+  8054bc:	48 89 e5             	mov    %rsp,%rbp
+  8054bf:	41 55                	push   %r13
+  8054c1:	41 54                	push   %r12
+  8054c3:	53                   	push   %rbx
+  8054c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8054c8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8054cb:	48 bb 54 29 80 00 00 	movabs $0x802954,%rbx
+  8054d2:	00 00 00 
+  8054d5:	49 bc 68 2a 80 00 00 	movabs $0x802a68,%r12
+  8054dc:	00 00 00 
+  8054df:	eb 03                	jmp    8054e4 <devcons_read+0x36>
+  8054e1:	41 ff d4             	call   *%r12
+  8054e4:	ff d3                	call   *%rbx
+  8054e6:	85 c0                	test   %eax,%eax
+  8054e8:	74 f7                	je     8054e1 <devcons_read+0x33>
+    if (c < 0) return c;
+  8054ea:	48 63 d0             	movslq %eax,%rdx
+  8054ed:	78 13                	js     805502 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8054ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054f4:	83 f8 04             	cmp    $0x4,%eax
+  8054f7:	74 09                	je     805502 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8054f9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8054fd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805502:	48 89 d0             	mov    %rdx,%rax
+  805505:	48 83 c4 08          	add    $0x8,%rsp
+  805509:	5b                   	pop    %rbx
+  80550a:	41 5c                	pop    %r12
+  80550c:	41 5d                	pop    %r13
+  80550e:	5d                   	pop    %rbp
+  80550f:	c3                   	ret
+  805510:	48 89 d0             	mov    %rdx,%rax
+  805513:	c3                   	ret
+
+0000000000805514 <cputchar>:
+cputchar(int ch) {
+  805514:	55                   	push   %rbp
+  805515:	48 89 e5             	mov    %rsp,%rbp
+  805518:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80551c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805520:	be 01 00 00 00       	mov    $0x1,%esi
+  805525:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805529:	48 b8 21 29 80 00 00 	movabs $0x802921,%rax
+  805530:	00 00 00 
+  805533:	ff d0                	call   *%rax
+}
+  805535:	c9                   	leave
+  805536:	c3                   	ret
+
+0000000000805537 <getchar>:
+getchar(void) {
+  805537:	55                   	push   %rbp
+  805538:	48 89 e5             	mov    %rsp,%rbp
+  80553b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80553f:	ba 01 00 00 00       	mov    $0x1,%edx
+  805544:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805548:	bf 00 00 00 00       	mov    $0x0,%edi
+  80554d:	48 b8 8a 36 80 00 00 	movabs $0x80368a,%rax
+  805554:	00 00 00 
+  805557:	ff d0                	call   *%rax
+  805559:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80555b:	85 c0                	test   %eax,%eax
+  80555d:	78 06                	js     805565 <getchar+0x2e>
+  80555f:	74 08                	je     805569 <getchar+0x32>
+  805561:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805565:	89 d0                	mov    %edx,%eax
+  805567:	c9                   	leave
+  805568:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805569:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80556e:	eb f5                	jmp    805565 <getchar+0x2e>
+
+0000000000805570 <iscons>:
+iscons(int fdnum) {
+  805570:	55                   	push   %rbp
+  805571:	48 89 e5             	mov    %rsp,%rbp
+  805574:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805578:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80557c:	48 b8 a7 33 80 00 00 	movabs $0x8033a7,%rax
+  805583:	00 00 00 
+  805586:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805588:	85 c0                	test   %eax,%eax
+  80558a:	78 18                	js     8055a4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80558c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805590:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805597:	00 00 00 
+  80559a:	8b 00                	mov    (%rax),%eax
+  80559c:	39 02                	cmp    %eax,(%rdx)
+  80559e:	0f 94 c0             	sete   %al
+  8055a1:	0f b6 c0             	movzbl %al,%eax
+}
+  8055a4:	c9                   	leave
+  8055a5:	c3                   	ret
+
+00000000008055a6 <opencons>:
+opencons(void) {
+  8055a6:	55                   	push   %rbp
+  8055a7:	48 89 e5             	mov    %rsp,%rbp
+  8055aa:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8055ae:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8055b2:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  8055b9:	00 00 00 
+  8055bc:	ff d0                	call   *%rax
+  8055be:	85 c0                	test   %eax,%eax
+  8055c0:	78 49                	js     80560b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8055c2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8055c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055cc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8055d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055d5:	48 b8 09 2b 80 00 00 	movabs $0x802b09,%rax
+  8055dc:	00 00 00 
+  8055df:	ff d0                	call   *%rax
+  8055e1:	85 c0                	test   %eax,%eax
+  8055e3:	78 26                	js     80560b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8055e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8055e9:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8055f0:	00 00 
+  8055f2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8055f4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8055f8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8055ff:	48 b8 19 33 80 00 00 	movabs $0x803319,%rax
+  805606:	00 00 00 
+  805609:	ff d0                	call   *%rax
+}
+  80560b:	c9                   	leave
+  80560c:	c3                   	ret
+
+000000000080560d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80560d:	55                   	push   %rbp
+  80560e:	48 89 e5             	mov    %rsp,%rbp
+  805611:	41 56                	push   %r14
+  805613:	41 55                	push   %r13
+  805615:	41 54                	push   %r12
+  805617:	53                   	push   %rbx
+  805618:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80561b:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805622:	00 00 00 
+  805625:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805629:	74 27                	je     805652 <_handle_vectored_pagefault+0x45>
+  80562b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805630:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805637:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80563a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80563d:	4c 89 e7             	mov    %r12,%rdi
+  805640:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805645:	84 c0                	test   %al,%al
+  805647:	75 45                	jne    80568e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805649:	48 83 c3 01          	add    $0x1,%rbx
+  80564d:	49 3b 1e             	cmp    (%r14),%rbx
+  805650:	72 eb                	jb     80563d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805652:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805659:	00 
+  80565a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80565f:	4d 8b 04 24          	mov    (%r12),%r8
+  805663:	48 ba 98 69 80 00 00 	movabs $0x806998,%rdx
+  80566a:	00 00 00 
+  80566d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805672:	48 bf c8 69 80 00 00 	movabs $0x8069c8,%rdi
+  805679:	00 00 00 
+  80567c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805681:	49 ba 1d 19 80 00 00 	movabs $0x80191d,%r10
+  805688:	00 00 00 
+  80568b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80568e:	5b                   	pop    %rbx
+  80568f:	41 5c                	pop    %r12
+  805691:	41 5d                	pop    %r13
+  805693:	41 5e                	pop    %r14
+  805695:	5d                   	pop    %rbp
+  805696:	c3                   	ret
+
+0000000000805697 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805697:	55                   	push   %rbp
+  805698:	48 89 e5             	mov    %rsp,%rbp
+  80569b:	53                   	push   %rbx
+  80569c:	48 83 ec 08          	sub    $0x8,%rsp
+  8056a0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8056a3:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8056a8:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8056af:	00 00 00 
+  8056b2:	80 38 00             	cmpb   $0x0,(%rax)
+  8056b5:	74 68                	je     80571f <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056b7:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056be:	00 00 00 
+  8056c1:	48 8b 08             	mov    (%rax),%rcx
+  8056c4:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8056c9:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8056d0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056d3:	48 85 c9             	test   %rcx,%rcx
+  8056d6:	0f 84 e0 00 00 00    	je     8057bc <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8056dc:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8056e0:	0f 84 c9 00 00 00    	je     8057af <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056e6:	48 83 c2 01          	add    $0x1,%rdx
+  8056ea:	48 39 ca             	cmp    %rcx,%rdx
+  8056ed:	75 ed                	jne    8056dc <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8056ef:	48 83 f9 08          	cmp    $0x8,%rcx
+  8056f3:	0f 84 84 00 00 00    	je     80577d <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8056f9:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8056fd:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805704:	00 00 00 
+  805707:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80570e:	00 00 00 
+  805711:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805715:	85 f6                	test   %esi,%esi
+  805717:	0f 89 97 00 00 00    	jns    8057b4 <add_pgfault_handler+0x11d>
+  80571d:	eb 63                	jmp    805782 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80571f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805724:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805729:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805730:	00 00 00 
+  805733:	bf 00 00 00 00       	mov    $0x0,%edi
+  805738:	48 b8 09 2b 80 00 00 	movabs $0x802b09,%rax
+  80573f:	00 00 00 
+  805742:	ff d0                	call   *%rax
+  805744:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805746:	85 c0                	test   %eax,%eax
+  805748:	78 38                	js     805782 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80574a:	48 be 98 58 80 00 00 	movabs $0x805898,%rsi
+  805751:	00 00 00 
+  805754:	bf 00 00 00 00       	mov    $0x0,%edi
+  805759:	48 b8 2c 2d 80 00 00 	movabs $0x802d2c,%rax
+  805760:	00 00 00 
+  805763:	ff d0                	call   *%rax
+  805765:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805767:	85 c0                	test   %eax,%eax
+  805769:	78 17                	js     805782 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80576b:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805772:	00 00 00 
+  805775:	c6 00 01             	movb   $0x1,(%rax)
+  805778:	e9 3a ff ff ff       	jmp    8056b7 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80577d:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805782:	89 f1                	mov    %esi,%ecx
+  805784:	48 ba d6 69 80 00 00 	movabs $0x8069d6,%rdx
+  80578b:	00 00 00 
+  80578e:	be 42 00 00 00       	mov    $0x42,%esi
+  805793:	48 bf c8 69 80 00 00 	movabs $0x8069c8,%rdi
+  80579a:	00 00 00 
+  80579d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057a2:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  8057a9:	00 00 00 
+  8057ac:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8057af:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8057b4:	89 f0                	mov    %esi,%eax
+  8057b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8057ba:	c9                   	leave
+  8057bb:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8057bc:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8057c3:	00 00 00 
+  8057c6:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8057cd:	48 89 d8             	mov    %rbx,%rax
+  8057d0:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8057d7:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8057da:	eb d8                	jmp    8057b4 <add_pgfault_handler+0x11d>
+
+00000000008057dc <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8057dc:	55                   	push   %rbp
+  8057dd:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8057e0:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8057e7:	00 00 00 
+  8057ea:	80 38 00             	cmpb   $0x0,(%rax)
+  8057ed:	74 33                	je     805822 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8057ef:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8057f6:	00 00 00 
+  8057f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8057fe:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805805:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805808:	48 85 c0             	test   %rax,%rax
+  80580b:	0f 84 85 00 00 00    	je     805896 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805811:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805815:	74 40                	je     805857 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805817:	48 83 c1 01          	add    $0x1,%rcx
+  80581b:	48 39 c1             	cmp    %rax,%rcx
+  80581e:	75 f1                	jne    805811 <remove_pgfault_handler+0x35>
+  805820:	eb 74                	jmp    805896 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805822:	48 b9 ee 69 80 00 00 	movabs $0x8069ee,%rcx
+  805829:	00 00 00 
+  80582c:	48 ba d6 68 80 00 00 	movabs $0x8068d6,%rdx
+  805833:	00 00 00 
+  805836:	be 48 00 00 00       	mov    $0x48,%esi
+  80583b:	48 bf c8 69 80 00 00 	movabs $0x8069c8,%rdi
+  805842:	00 00 00 
+  805845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80584a:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  805851:	00 00 00 
+  805854:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805857:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80585e:	00 
+  80585f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805863:	48 29 ca             	sub    %rcx,%rdx
+  805866:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80586d:	00 00 00 
+  805870:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805874:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805879:	48 89 ce             	mov    %rcx,%rsi
+  80587c:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  805883:	00 00 00 
+  805886:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805888:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80588f:	00 00 00 
+  805892:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805896:	5d                   	pop    %rbp
+  805897:	c3                   	ret
+
+0000000000805898 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805898:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80589b:	48 b8 0d 56 80 00 00 	movabs $0x80560d,%rax
+  8058a2:	00 00 00 
+    call *%rax
+  8058a5:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8058a7:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8058ae:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8058af:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8058b6:	00 
+    subq $8, %rcx
+  8058b7:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8058bb:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8058be:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8058c5:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8058c6:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8058ca:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8058ce:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8058d3:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8058d8:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8058dd:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8058e2:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8058e7:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8058ec:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8058f1:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8058f6:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8058fb:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805900:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805905:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80590a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80590f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805914:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805918:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80591c:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80591d:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80591e:	c3                   	ret
+
+000000000080591f <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80591f:	85 ff                	test   %edi,%edi
+  805921:	78 58                	js     80597b <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805923:	48 85 f6             	test   %rsi,%rsi
+  805926:	74 12                	je     80593a <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805928:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80592f:	00 00 00 
+  805932:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805938:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80593a:	48 85 c9             	test   %rcx,%rcx
+  80593d:	74 12                	je     805951 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80593f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805946:	00 00 00 
+  805949:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80594f:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805951:	48 85 d2             	test   %rdx,%rdx
+  805954:	74 14                	je     80596a <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805956:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80595d:	00 00 00 
+  805960:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805967:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80596a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805971:	00 00 00 
+  805974:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80597a:	c3                   	ret
+        if (from_env_store) {
+  80597b:	48 85 f6             	test   %rsi,%rsi
+  80597e:	74 06                	je     805986 <ipc_result+0x67>
+            *from_env_store = 0;
+  805980:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805986:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805988:	48 85 c9             	test   %rcx,%rcx
+  80598b:	74 ed                	je     80597a <ipc_result+0x5b>
+            *perm_store = 0;
+  80598d:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805993:	c3                   	ret
+
+0000000000805994 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805994:	55                   	push   %rbp
+  805995:	48 89 e5             	mov    %rsp,%rbp
+  805998:	41 55                	push   %r13
+  80599a:	41 54                	push   %r12
+  80599c:	53                   	push   %rbx
+  80599d:	48 83 ec 08          	sub    $0x8,%rsp
+  8059a1:	49 89 fc             	mov    %rdi,%r12
+  8059a4:	48 89 f7             	mov    %rsi,%rdi
+  8059a7:	48 89 d3             	mov    %rdx,%rbx
+  8059aa:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8059ad:	48 85 f6             	test   %rsi,%rsi
+  8059b0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8059b7:	00 00 00 
+  8059ba:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8059be:	be 00 00 00 00       	mov    $0x0,%esi
+  8059c3:	48 85 d2             	test   %rdx,%rdx
+  8059c6:	74 03                	je     8059cb <ipc_recv+0x37>
+  8059c8:	48 8b 32             	mov    (%rdx),%rsi
+  8059cb:	48 b8 55 30 80 00 00 	movabs $0x803055,%rax
+  8059d2:	00 00 00 
+  8059d5:	ff d0                	call   *%rax
+  8059d7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8059d9:	4c 89 e9             	mov    %r13,%rcx
+  8059dc:	48 89 da             	mov    %rbx,%rdx
+  8059df:	4c 89 e6             	mov    %r12,%rsi
+  8059e2:	48 b8 1f 59 80 00 00 	movabs $0x80591f,%rax
+  8059e9:	00 00 00 
+  8059ec:	ff d0                	call   *%rax
+}
+  8059ee:	48 83 c4 08          	add    $0x8,%rsp
+  8059f2:	5b                   	pop    %rbx
+  8059f3:	41 5c                	pop    %r12
+  8059f5:	41 5d                	pop    %r13
+  8059f7:	5d                   	pop    %rbp
+  8059f8:	c3                   	ret
+
+00000000008059f9 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8059f9:	55                   	push   %rbp
+  8059fa:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8059fd:	48 85 d2             	test   %rdx,%rdx
+  805a00:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a07:	00 00 00 
+  805a0a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805a0e:	89 f6                	mov    %esi,%esi
+  805a10:	48 b8 e1 2e 80 00 00 	movabs $0x802ee1,%rax
+  805a17:	00 00 00 
+  805a1a:	ff d0                	call   *%rax
+    if (res < 0) {
+  805a1c:	85 c0                	test   %eax,%eax
+  805a1e:	78 02                	js     805a22 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805a20:	5d                   	pop    %rbp
+  805a21:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805a22:	89 c1                	mov    %eax,%ecx
+  805a24:	48 ba 08 6a 80 00 00 	movabs $0x806a08,%rdx
+  805a2b:	00 00 00 
+  805a2e:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805a33:	48 bf 15 6a 80 00 00 	movabs $0x806a15,%rdi
+  805a3a:	00 00 00 
+  805a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a42:	49 b8 1d 19 80 00 00 	movabs $0x80191d,%r8
+  805a49:	00 00 00 
+  805a4c:	41 ff d0             	call   *%r8
+
+0000000000805a4f <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805a4f:	55                   	push   %rbp
+  805a50:	48 89 e5             	mov    %rsp,%rbp
+  805a53:	53                   	push   %rbx
+  805a54:	48 83 ec 08          	sub    $0x8,%rsp
+  805a58:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805a5c:	48 85 d2             	test   %rdx,%rdx
+  805a5f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a66:	00 00 00 
+  805a69:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805a6d:	4d 85 c9             	test   %r9,%r9
+  805a70:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a79:	48 85 db             	test   %rbx,%rbx
+  805a7c:	74 03                	je     805a81 <ipc_call+0x32>
+  805a7e:	48 8b 03             	mov    (%rbx),%rax
+  805a81:	89 f6                	mov    %esi,%esi
+  805a83:	48 83 ec 08          	sub    $0x8,%rsp
+  805a87:	50                   	push   %rax
+  805a88:	48 b8 13 2f 80 00 00 	movabs $0x802f13,%rax
+  805a8f:	00 00 00 
+  805a92:	ff d0                	call   *%rax
+  805a94:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805a96:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805a9a:	48 89 da             	mov    %rbx,%rdx
+  805a9d:	be 00 00 00 00       	mov    $0x0,%esi
+  805aa2:	48 b8 1f 59 80 00 00 	movabs $0x80591f,%rax
+  805aa9:	00 00 00 
+  805aac:	ff d0                	call   *%rax
+}
+  805aae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805ab2:	c9                   	leave
+  805ab3:	c3                   	ret
+
+0000000000805ab4 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805ab4:	55                   	push   %rbp
+  805ab5:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805ab8:	89 f6                	mov    %esi,%esi
+  805aba:	48 b8 7f 2f 80 00 00 	movabs $0x802f7f,%rax
+  805ac1:	00 00 00 
+  805ac4:	ff d0                	call   *%rax
+  805ac6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805ac8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805acd:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ad2:	be 00 00 00 00       	mov    $0x0,%esi
+  805ad7:	48 b8 1f 59 80 00 00 	movabs $0x80591f,%rax
+  805ade:	00 00 00 
+  805ae1:	ff d0                	call   *%rax
+}
+  805ae3:	5d                   	pop    %rbp
+  805ae4:	c3                   	ret
+
+0000000000805ae5 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805ae5:	55                   	push   %rbp
+  805ae6:	48 89 e5             	mov    %rsp,%rbp
+  805ae9:	41 54                	push   %r12
+  805aeb:	53                   	push   %rbx
+  805aec:	4c 89 cb             	mov    %r9,%rbx
+  805aef:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805af3:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805af7:	48 85 d2             	test   %rdx,%rdx
+  805afa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b01:	00 00 00 
+  805b04:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805b08:	4d 85 c9             	test   %r9,%r9
+  805b0b:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b14:	4d 85 e4             	test   %r12,%r12
+  805b17:	74 04                	je     805b1d <ipc_reply_wait+0x38>
+  805b19:	49 8b 04 24          	mov    (%r12),%rax
+  805b1d:	89 f6                	mov    %esi,%esi
+  805b1f:	48 83 ec 08          	sub    $0x8,%rsp
+  805b23:	50                   	push   %rax
+  805b24:	48 b8 e9 2f 80 00 00 	movabs $0x802fe9,%rax
+  805b2b:	00 00 00 
+  805b2e:	ff d0                	call   *%rax
+  805b30:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805b32:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805b36:	4c 89 e2             	mov    %r12,%rdx
+  805b39:	48 89 de             	mov    %rbx,%rsi
+  805b3c:	48 b8 1f 59 80 00 00 	movabs $0x80591f,%rax
+  805b43:	00 00 00 
+  805b46:	ff d0                	call   *%rax
+}
+  805b48:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805b4c:	5b                   	pop    %rbx
+  805b4d:	41 5c                	pop    %r12
+  805b4f:	5d                   	pop    %rbp
+  805b50:	c3                   	ret
+
+0000000000805b51 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805b51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805b56:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805b5d:	00 00 00 
+  805b60:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805b67:	48 01 ca             	add    %rcx,%rdx
+  805b6a:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805b70:	39 fa                	cmp    %edi,%edx
+  805b72:	74 12                	je     805b86 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805b74:	48 83 c0 01          	add    $0x1,%rax
+  805b78:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805b7e:	75 e0                	jne    805b60 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805b80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b85:	c3                   	ret
+            return envs[i].env_id;
+  805b86:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805b8d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805b94:	00 00 00 
+  805b97:	48 01 d0             	add    %rdx,%rax
+  805b9a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805ba0:	c3                   	ret
+  805ba1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000805ba8 <__rodata_start>:
+  805ba8:	77 00                	ja     805baa <__rodata_start+0x2>
+  805baa:	72 62                	jb     805c0e <__rodata_start+0x66>
+  805bac:	00 77 62             	add    %dh,0x62(%rdi)
+  805baf:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805bb2:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805bb9:	00 
+  805bba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  805bc0:	b3 09                	mov    $0x9,%bl
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 ed                	add    %ch,%ch
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	ed                   	in     (%dx),%eax
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ed                   	in     (%dx),%eax
+  805be1:	0d 80 00 00 00       	or     $0x80,%eax
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 ed                	add    %ch,%ch
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	ed                   	in     (%dx),%eax
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ed                   	in     (%dx),%eax
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	ed                   	in     (%dx),%eax
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	8c 0a                	mov    %cs,(%rdx)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	8c 0a                	mov    %cs,(%rdx)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	8c 0a                	mov    %cs,(%rdx)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c46:	00 00                	add    %al,(%rax)
+  805c48:	8c 0a                	mov    %cs,(%rdx)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	8c 0a                	mov    %cs,(%rdx)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	ed                   	in     (%dx),%eax
+  805c69:	0d 80 00 00 00       	or     $0x80,%eax
+  805c6e:	00 00                	add    %al,(%rax)
+  805c70:	ed                   	in     (%dx),%eax
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	ed                   	in     (%dx),%eax
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ed                   	in     (%dx),%eax
+  805c81:	0d 80 00 00 00       	or     $0x80,%eax
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	ed                   	in     (%dx),%eax
+  805c99:	0d 80 00 00 00       	or     $0x80,%eax
+  805c9e:	00 00                	add    %al,(%rax)
+  805ca0:	ed                   	in     (%dx),%eax
+  805ca1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	ed                   	in     (%dx),%eax
+  805ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cae:	00 00                	add    %al,(%rax)
+  805cb0:	ed                   	in     (%dx),%eax
+  805cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	ed                   	in     (%dx),%eax
+  805cb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cbe:	00 00                	add    %al,(%rax)
+  805cc0:	ed                   	in     (%dx),%eax
+  805cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cc6:	00 00                	add    %al,(%rax)
+  805cc8:	ed                   	in     (%dx),%eax
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	ed                   	in     (%dx),%eax
+  805cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	ed                   	in     (%dx),%eax
+  805cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cde:	00 00                	add    %al,(%rax)
+  805ce0:	ed                   	in     (%dx),%eax
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	ed                   	in     (%dx),%eax
+  805ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cee:	00 00                	add    %al,(%rax)
+  805cf0:	ed                   	in     (%dx),%eax
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	ed                   	in     (%dx),%eax
+  805d19:	0d 80 00 00 00       	or     $0x80,%eax
+  805d1e:	00 00                	add    %al,(%rax)
+  805d20:	ed                   	in     (%dx),%eax
+  805d21:	0d 80 00 00 00       	or     $0x80,%eax
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	ed                   	in     (%dx),%eax
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	ed                   	in     (%dx),%eax
+  805d31:	0d 80 00 00 00       	or     $0x80,%eax
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	ed                   	in     (%dx),%eax
+  805d39:	0d 80 00 00 00       	or     $0x80,%eax
+  805d3e:	00 00                	add    %al,(%rax)
+  805d40:	ed                   	in     (%dx),%eax
+  805d41:	0d 80 00 00 00       	or     $0x80,%eax
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	ed                   	in     (%dx),%eax
+  805d49:	0d 80 00 00 00       	or     $0x80,%eax
+  805d4e:	00 00                	add    %al,(%rax)
+  805d50:	ed                   	in     (%dx),%eax
+  805d51:	0d 80 00 00 00       	or     $0x80,%eax
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	f4                   	hlt
+  805d59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d5f:	00 ed                	add    %ch,%ch
+  805d61:	0d 80 00 00 00       	or     $0x80,%eax
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	2c 0b                	sub    $0xb,%al
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 ed                	add    %ch,%ch
+  805d79:	0d 80 00 00 00       	or     $0x80,%eax
+  805d7e:	00 00                	add    %al,(%rax)
+  805d80:	ed                   	in     (%dx),%eax
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	ed                   	in     (%dx),%eax
+  805d91:	0d 80 00 00 00       	or     $0x80,%eax
+  805d96:	00 00                	add    %al,(%rax)
+  805d98:	ed                   	in     (%dx),%eax
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ed                   	in     (%dx),%eax
+  805da1:	0d 80 00 00 00       	or     $0x80,%eax
+  805da6:	00 00                	add    %al,(%rax)
+  805da8:	ed                   	in     (%dx),%eax
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805db3:	00 00                	add    %al,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 cb                	add    %cl,%bl
+  805db9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dbe:	00 00                	add    %al,(%rax)
+  805dc0:	ed                   	in     (%dx),%eax
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	ed                   	in     (%dx),%eax
+  805dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dce:	00 00                	add    %al,(%rax)
+  805dd0:	ed                   	in     (%dx),%eax
+  805dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dd6:	00 00                	add    %al,(%rax)
+  805dd8:	6a 0a                	push   $0xa
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 ed                	add    %ch,%ch
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	ed                   	in     (%dx),%eax
+  805df1:	0d 80 00 00 00       	or     $0x80,%eax
+  805df6:	00 00                	add    %al,(%rax)
+  805df8:	3c 0a                	cmp    $0xa,%al
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 ed                	add    %ch,%ch
+  805e01:	0d 80 00 00 00       	or     $0x80,%eax
+  805e06:	00 00                	add    %al,(%rax)
+  805e08:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805e0b:	00 00                	add    %al,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 29                	add    %ch,(%rcx)
+  805e19:	0c 80                	or     $0x80,%al
+  805e1b:	00 00                	add    %al,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 ed                	add    %ch,%ch
+  805e29:	0d 80 00 00 00       	or     $0x80,%eax
+  805e2e:	00 00                	add    %al,(%rax)
+  805e30:	1a 0b                	sbb    (%rbx),%cl
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 ed                	add    %ch,%ch
+  805e39:	0d 80 00 00 00       	or     $0x80,%eax
+  805e3e:	00 00                	add    %al,(%rax)
+  805e40:	ce                   	(bad)
+  805e41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e47:	00 ed                	add    %ch,%ch
+  805e49:	0d 80 00 00 00       	or     $0x80,%eax
+  805e4e:	00 00                	add    %al,(%rax)
+  805e50:	ed                   	in     (%dx),%eax
+  805e51:	0d 80 00 00 00       	or     $0x80,%eax
+  805e56:	00 00                	add    %al,(%rax)
+  805e58:	f4                   	hlt
+  805e59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e5f:	00 37                	add    %dh,(%rdi)
+  805e61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 37                	add    %dh,(%rdi)
+  805e71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805e8b:	00 00                	add    %al,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 d2                	add    %dl,%dl
+  805e91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e97:	00 d2                	add    %dl,%dl
+  805e99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e9f:	00 d2                	add    %dl,%dl
+  805ea1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ea7:	00 d2                	add    %dl,%dl
+  805ea9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eaf:	00 d2                	add    %dl,%dl
+  805eb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eb7:	00 d2                	add    %dl,%dl
+  805eb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ebf:	00 d2                	add    %dl,%dl
+  805ec1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ec7:	00 f6                	add    %dh,%dh
+  805ec9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ecf:	00 f6                	add    %dh,%dh
+  805ed1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ed7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ef2:	80 00 00             	addb   $0x0,(%rax)
+  805ef5:	00 00                	add    %al,(%rax)
+  805ef7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f0a:	80 00 00             	addb   $0x0,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 22                	add    %ah,(%rdx)
+  805f11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f17:	00 22                	add    %ah,(%rdx)
+  805f19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f1f:	00 22                	add    %ah,(%rdx)
+  805f21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f27:	00 22                	add    %ah,(%rdx)
+  805f29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f2f:	00 22                	add    %ah,(%rdx)
+  805f31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f37:	00 22                	add    %ah,(%rdx)
+  805f39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f42:	80 00 00             	addb   $0x0,(%rax)
+  805f45:	00 00                	add    %al,(%rax)
+  805f47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f4a:	80 00 00             	addb   $0x0,(%rax)
+  805f4d:	00 00                	add    %al,(%rax)
+  805f4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f52:	80 00 00             	addb   $0x0,(%rax)
+  805f55:	00 00                	add    %al,(%rax)
+  805f57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f5a:	80 00 00             	addb   $0x0,(%rax)
+  805f5d:	00 00                	add    %al,(%rax)
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f72:	80 00 00             	addb   $0x0,(%rax)
+  805f75:	00 00                	add    %al,(%rax)
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f8a:	80 00 00             	addb   $0x0,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f92:	80 00 00             	addb   $0x0,(%rax)
+  805f95:	00 00                	add    %al,(%rax)
+  805f97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f9a:	80 00 00             	addb   $0x0,(%rax)
+  805f9d:	00 00                	add    %al,(%rax)
+  805f9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fa2:	80 00 00             	addb   $0x0,(%rax)
+  805fa5:	00 00                	add    %al,(%rax)
+  805fa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fb2:	80 00 00             	addb   $0x0,(%rax)
+  805fb5:	00 00                	add    %al,(%rax)
+  805fb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fba:	80 00 00             	addb   $0x0,(%rax)
+  805fbd:	00 00                	add    %al,(%rax)
+  805fbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fc2:	80 00 00             	addb   $0x0,(%rax)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 46 12             	add    %al,0x12(%rsi)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fd2:	80 00 00             	addb   $0x0,(%rax)
+  805fd5:	00 00                	add    %al,(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ffa:	80 00 00             	addb   $0x0,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 22                	add    %ah,(%rdx)
+  806011:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806017:	00 22                	add    %ah,(%rdx)
+  806019:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80601f:	00 22                	add    %ah,(%rdx)
+  806021:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806027:	00 22                	add    %ah,(%rdx)
+  806029:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80602f:	00 22                	add    %ah,(%rdx)
+  806031:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806037:	00 22                	add    %ah,(%rdx)
+  806039:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80603f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806042:	80 00 00             	addb   $0x0,(%rax)
+  806045:	00 00                	add    %al,(%rax)
+  806047:	00 5f 12             	add    %bl,0x12(%rdi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806052:	80 00 00             	addb   $0x0,(%rax)
+  806055:	00 00                	add    %al,(%rax)
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 5f 12             	add    %bl,0x12(%rdi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806092:	80 00 00             	addb   $0x0,(%rax)
+  806095:	00 00                	add    %al,(%rax)
+  806097:	00 5f 12             	add    %bl,0x12(%rdi)
+  80609a:	80 00 00             	addb   $0x0,(%rax)
+  80609d:	00 00                	add    %al,(%rax)
+  80609f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060a2:	80 00 00             	addb   $0x0,(%rax)
+  8060a5:	00 00                	add    %al,(%rax)
+  8060a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060aa:	80 00 00             	addb   $0x0,(%rax)
+  8060ad:	00 00                	add    %al,(%rax)
+  8060af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060b2:	80 00 00             	addb   $0x0,(%rax)
+  8060b5:	00 00                	add    %al,(%rax)
+  8060b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ba:	80 00 00             	addb   $0x0,(%rax)
+  8060bd:	00 00                	add    %al,(%rax)
+  8060bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060c2:	80 00 00             	addb   $0x0,(%rax)
+  8060c5:	00 00                	add    %al,(%rax)
+  8060c7:	00 46 12             	add    %al,0x12(%rsi)
+  8060ca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+00000000008060e0 <basefix.0>:
+  8060e0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  8060f0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806100:	10 00 20 53 48 41 52 45 00 20 43 4f 57 00 45 49     .. SHARE. COW.EI
+  806110:	44 3a 20 25 64 2c 20 50 45 49 44 3a 20 25 64 0a     D: %d, PEID: %d.
+  806120:	00 4d 65 6d 6f 72 79 20 75 73 61 67 65 20 73 75     .Memory usage su
+  806130:	6d 6d 61 72 79 3a 0a 00 20 20 50 54 45 5f 50 3a     mmary:..  PTE_P:
+  806140:	20 25 6c 75 0a 00 20 20 50 54 45 5f 55 3a 20 25      %lu..  PTE_U: %
+  806150:	6c 75 0a 00 20 20 50 54 45 5f 57 3a 20 25 6c 75     lu..  PTE_W: %lu
+  806160:	0a 00 20 20 50 54 45 5f 43 4f 57 3a 20 25 6c 75     ..  PTE_COW: %lu
+  806170:	0a 00 70 69 70 65 28 29 20 66 61 69 6c 65 64 0a     ..pipe() failed.
+  806180:	00 75 73 65 72 2f 6d 65 6d 6c 61 79 6f 75 74 2e     .user/memlayout.
+  806190:	63 00 66 6f 72 6b 28 29 20 66 61 69 6c 65 64 0a     c.fork() failed.
+  8061a0:	00 3d 3d 3d 3d 20 43 68 69 6c 64 0a 00 3d 3d 3d     .==== Child..===
+  8061b0:	3d 20 50 61 72 65 6e 74 0a 00 66 0f 1f 44 00 00     = Parent..f..D..
+  8061c0:	70 6d 6c 34 3d 25 70 20 75 76 70 6d 6c 34 3d 25     pml4=%p uvpml4=%
+  8061d0:	70 20 75 76 70 64 70 3d 25 70 20 75 76 70 64 3d     p uvpdp=%p uvpd=
+  8061e0:	25 70 20 75 76 70 74 3d 25 70 0a 00 00 00 00 00     %p uvpt=%p......
+  8061f0:	5b 25 70 5d 20 25 6c 78 20 2d 3e 20 25 30 38 6c     [%p] %lx -> %08l
+  806200:	78 3a 20 25 63 20 25 63 20 25 63 20 7c 25 73 25     x: %c %c %c |%s%
+  806210:	73 0a 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 00     s..<unknown>....
+  806220:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806230:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806240:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806250:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806260:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806270:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806280:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806290:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  8062a0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  8062b0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8062c0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8062d0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8062e0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8062f0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806300:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806310:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806320:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806330:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806340:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806350:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806360:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806370:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806380:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806390:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  8063a0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8063b0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8063c0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8063d0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  8063e0:	65 1c 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     e........"......
+  8063f0:	ac 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806400:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806410:	bc 22 80 00 00 00 00 00 84 1c 80 00 00 00 00 00     ."..............
+  806420:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806430:	78 1c 80 00 00 00 00 00 f2 1c 80 00 00 00 00 00     x...............
+  806440:	bc 22 80 00 00 00 00 00 78 1c 80 00 00 00 00 00     ."......x.......
+  806450:	be 1c 80 00 00 00 00 00 be 1c 80 00 00 00 00 00     ................
+  806460:	be 1c 80 00 00 00 00 00 be 1c 80 00 00 00 00 00     ................
+  806470:	be 1c 80 00 00 00 00 00 be 1c 80 00 00 00 00 00     ................
+  806480:	be 1c 80 00 00 00 00 00 be 1c 80 00 00 00 00 00     ................
+  806490:	be 1c 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ........."......
+  8064a0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8064b0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8064c0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8064d0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8064e0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8064f0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806500:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806510:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806520:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806530:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806540:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806550:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806560:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806570:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806580:	bc 22 80 00 00 00 00 00 da 21 80 00 00 00 00 00     .".......!......
+  806590:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8065a0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8065b0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8065c0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8065d0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  8065e0:	20 1d 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00      ...............
+  8065f0:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806600:	bc 22 80 00 00 00 00 00 15 1d 80 00 00 00 00 00     ."..............
+  806610:	4f 1d 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     O........"......
+  806620:	bc 22 80 00 00 00 00 00 0a 1d 80 00 00 00 00 00     ."..............
+  806630:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806640:	98 20 80 00 00 00 00 00 67 21 80 00 00 00 00 00     . ......g!......
+  806650:	bc 22 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ."......."......
+  806660:	e6 1d 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ........."......
+  806670:	c3 1f 80 00 00 00 00 00 bc 22 80 00 00 00 00 00     ........."......
+  806680:	bc 22 80 00 00 00 00 00 da 21 80 00 00 00 00 00     .".......!......
+  806690:	bc 22 80 00 00 00 00 00 6e 1c 80 00 00 00 00 00     ."......n.......
+
+00000000008066a0 <error_string>:
+	...
+  8066a8:	75 62 80 00 00 00 00 00 87 62 80 00 00 00 00 00     ub.......b......
+  8066b8:	97 62 80 00 00 00 00 00 a9 62 80 00 00 00 00 00     .b.......b......
+  8066c8:	b7 62 80 00 00 00 00 00 cb 62 80 00 00 00 00 00     .b.......b......
+  8066d8:	e0 62 80 00 00 00 00 00 f3 62 80 00 00 00 00 00     .b.......b......
+  8066e8:	05 63 80 00 00 00 00 00 19 63 80 00 00 00 00 00     .c.......c......
+  8066f8:	29 63 80 00 00 00 00 00 3c 63 80 00 00 00 00 00     )c......<c......
+  806708:	53 63 80 00 00 00 00 00 69 63 80 00 00 00 00 00     Sc......ic......
+  806718:	81 63 80 00 00 00 00 00 99 63 80 00 00 00 00 00     .c.......c......
+  806728:	a6 63 80 00 00 00 00 00 40 67 80 00 00 00 00 00     .c......@g......
+  806738:	ba 63 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .c......file is 
+  806748:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806758:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806768:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806778:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806788:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806798:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8067a8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8067b8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8067c8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8067d8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8067e8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8067f8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806808:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806818:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806828:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806838:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806848:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806858:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806868:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806878:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806888:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806898:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008068a0 <devtab>:
+  8068a0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8068b0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8068c0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8068d0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8068e0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8068f0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806900:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806910:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806920:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806930:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806940:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806950:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806960:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806970:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806980:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806990:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  8069a0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8069b0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8069c0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8069d0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8069e0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8069f0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806a00:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806a10:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,10852 @@
+
+obj/user/mmaptest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 07 29 80 00 00 	movabs $0x802907,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 27 26 80 00 00 	movabs $0x802627,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 88 27 80 00 00 	movabs $0x802788,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 7a 3a 80 00 00 	movabs $0x803a7a,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 27 26 80 00 00 	movabs $0x802627,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 7a 3a 80 00 00 	movabs $0x803a7a,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 ca 1c 80 00 00 	movabs $0x801cca,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 50 44 80 00 00 	movabs $0x804450,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 50 44 80 00 00 	movabs $0x804450,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 bb 1b 80 00 00 	movabs $0x801bbb,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 2f 66 80 00 00 	movabs $0x80662f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 20 5f 80 00 00 	movabs $0x805f20,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 22 5f 80 00 00 	movabs $0x805f22,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 25 5f 80 00 00 	movabs $0x805f25,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 27 27 80 00 00 	movabs $0x802727,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 07 53 80 00 00 	movabs $0x805307,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 de 55 80 00 00 	movabs $0x8055de,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 cd 37 80 00 00 	movabs $0x8037cd,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 64 3b 80 00 00 	movabs $0x803b64,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 2d 3c 80 00 00 	movabs $0x803c2d,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 33 3b 80 00 00 	movabs $0x803b33,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 33 3b 80 00 00 	movabs $0x803b33,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 4b 39 80 00 00 	movabs $0x80394b,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 7a 3a 80 00 00 	movabs $0x803a7a,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 cd 37 80 00 00 	movabs $0x8037cd,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 27 26 80 00 00 	movabs $0x802627,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb d4 28 80 00 00 	movabs $0x8028d4,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 5f 80 00 00 	movabs $0x805f40,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 d4 28 80 00 00 	movabs $0x8028d4,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 07 29 80 00 00 	movabs $0x802907,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc d4 28 80 00 00 	movabs $0x8028d4,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 61 80 00 00 	movabs $0x8061e0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf d4 28 80 00 00 	movabs $0x8028d4,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf d4 28 80 00 00 	movabs $0x8028d4,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 64 80 00 00 	movabs $0x806460,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 64 80 00 00 	movabs $0x806460,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 2c 2b 80 00 00 	movabs $0x802b2c,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 2c 2b 80 00 00 	movabs $0x802b2c,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 13 06 00 00       	call   801b12 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <check_file>:
+        if (write(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("write failed");
+    }
+}
+
+static void
+check_file(int fd, int page, char expect) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 55                	push   %r13
+  801507:	41 54                	push   %r12
+  801509:	53                   	push   %rbx
+  80150a:	48 83 ec 08          	sub    $0x8,%rsp
+  80150e:	89 fb                	mov    %edi,%ebx
+  801510:	41 89 f5             	mov    %esi,%r13d
+  801513:	41 89 d4             	mov    %edx,%r12d
+    seek(fd, page * PAGE_SIZE);
+  801516:	c1 e6 0c             	shl    $0xc,%esi
+  801519:	48 b8 33 3b 80 00 00 	movabs $0x803b33,%rax
+  801520:	00 00 00 
+  801523:	ff d0                	call   *%rax
+    if (readn(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("read failed");
+  801525:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80152a:	48 be 20 80 80 01 00 	movabs $0x1808020,%rsi
+  801531:	00 00 00 
+  801534:	89 df                	mov    %ebx,%edi
+  801536:	48 b8 09 3a 80 00 00 	movabs $0x803a09,%rax
+  80153d:	00 00 00 
+  801540:	ff d0                	call   *%rax
+  801542:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801548:	75 2c                	jne    801576 <check_file+0x75>
+    if (buf[0] != expect || buf[PAGE_SIZE - 1] != expect)
+  80154a:	a0 20 80 80 01 00 00 	movabs 0x1808020,%al
+  801551:	00 00 
+  801553:	44 38 e0             	cmp    %r12b,%al
+  801556:	75 48                	jne    8015a0 <check_file+0x9f>
+  801558:	48 ba 20 80 80 01 00 	movabs $0x1808020,%rdx
+  80155f:	00 00 00 
+  801562:	44 38 a2 ff 0f 00 00 	cmp    %r12b,0xfff(%rdx)
+  801569:	75 35                	jne    8015a0 <check_file+0x9f>
+        panic("page %d of file is %02x, expected %02x", page, buf[0], expect);
+}
+  80156b:	48 83 c4 08          	add    $0x8,%rsp
+  80156f:	5b                   	pop    %rbx
+  801570:	41 5c                	pop    %r12
+  801572:	41 5d                	pop    %r13
+  801574:	5d                   	pop    %rbp
+  801575:	c3                   	ret
+    if (readn(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("read failed");
+  801576:	48 ba 82 64 80 00 00 	movabs $0x806482,%rdx
+  80157d:	00 00 00 
+  801580:	be 17 00 00 00       	mov    $0x17,%esi
+  801585:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  80158c:	00 00 00 
+  80158f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801594:	48 b9 de 1b 80 00 00 	movabs $0x801bde,%rcx
+  80159b:	00 00 00 
+  80159e:	ff d1                	call   *%rcx
+        panic("page %d of file is %02x, expected %02x", page, buf[0], expect);
+  8015a0:	45 0f be cc          	movsbl %r12b,%r9d
+  8015a4:	44 0f be c0          	movsbl %al,%r8d
+  8015a8:	44 89 e9             	mov    %r13d,%ecx
+  8015ab:	48 ba 70 65 80 00 00 	movabs $0x806570,%rdx
+  8015b2:	00 00 00 
+  8015b5:	be 19 00 00 00       	mov    $0x19,%esi
+  8015ba:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  8015c1:	00 00 00 
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	49 ba de 1b 80 00 00 	movabs $0x801bde,%r10
+  8015d0:	00 00 00 
+  8015d3:	41 ff d2             	call   *%r10
+
+00000000008015d6 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8015d6:	55                   	push   %rbp
+  8015d7:	48 89 e5             	mov    %rsp,%rbp
+  8015da:	41 57                	push   %r15
+  8015dc:	41 56                	push   %r14
+  8015de:	41 55                	push   %r13
+  8015e0:	41 54                	push   %r12
+  8015e2:	53                   	push   %rbx
+  8015e3:	48 83 ec 08          	sub    $0x8,%rsp
+    int fd, res;
+
+    if ((fd = open(TEST_FILE, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  8015e7:	be 02 03 00 00       	mov    $0x302,%esi
+  8015ec:	48 bf 9e 64 80 00 00 	movabs $0x80649e,%rdi
+  8015f3:	00 00 00 
+  8015f6:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8015fd:	00 00 00 
+  801600:	ff d0                	call   *%rax
+  801602:	41 89 c5             	mov    %eax,%r13d
+  801605:	85 c0                	test   %eax,%eax
+  801607:	0f 88 b0 01 00 00    	js     8017bd <umain+0x1e7>
+    seek(fd, 0);
+  80160d:	be 00 00 00 00       	mov    $0x0,%esi
+  801612:	89 c7                	mov    %eax,%edi
+  801614:	48 b8 33 3b 80 00 00 	movabs $0x803b33,%rax
+  80161b:	00 00 00 
+  80161e:	ff d0                	call   *%rax
+  801620:	bb 41 00 00 00       	mov    $0x41,%ebx
+        memset(buf, tag + i, PAGE_SIZE);
+  801625:	49 bc 20 80 80 01 00 	movabs $0x1808020,%r12
+  80162c:	00 00 00 
+  80162f:	49 bf 07 29 80 00 00 	movabs $0x802907,%r15
+  801636:	00 00 00 
+        if (write(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("write failed");
+  801639:	49 be 7a 3a 80 00 00 	movabs $0x803a7a,%r14
+  801640:	00 00 00 
+        memset(buf, tag + i, PAGE_SIZE);
+  801643:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801648:	89 de                	mov    %ebx,%esi
+  80164a:	4c 89 e7             	mov    %r12,%rdi
+  80164d:	41 ff d7             	call   *%r15
+        if (write(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("write failed");
+  801650:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801655:	4c 89 e6             	mov    %r12,%rsi
+  801658:	44 89 ef             	mov    %r13d,%edi
+  80165b:	41 ff d6             	call   *%r14
+  80165e:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801664:	0f 85 8b 01 00 00    	jne    8017f5 <umain+0x21f>
+    for (int i = 0; i < TEST_PAGES; i++) {
+  80166a:	83 c3 01             	add    $0x1,%ebx
+  80166d:	83 fb 69             	cmp    $0x69,%ebx
+  801670:	75 d1                	jne    801643 <umain+0x6d>
+        panic("open %s: %i", TEST_FILE, fd);
+    fill(fd, 'A');
+
+    /* Private mapping */
+    char *p = mmap(NULL, TEST_PAGES * PAGE_SIZE, PROT_RW, MAP_PRIVATE, fd, 0);
+  801672:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801678:	45 89 e8             	mov    %r13d,%r8d
+  80167b:	b9 02 00 00 00       	mov    $0x2,%ecx
+  801680:	ba 06 00 00 00       	mov    $0x6,%edx
+  801685:	be 00 80 02 00       	mov    $0x28000,%esi
+  80168a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80168f:	48 b8 07 53 80 00 00 	movabs $0x805307,%rax
+  801696:	00 00 00 
+  801699:	ff d0                	call   *%rax
+  80169b:	48 89 c7             	mov    %rax,%rdi
+    if (p == MAP_FAILED) panic("mmap private failed");
+  80169e:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  8016a2:	0f 84 77 01 00 00    	je     80181f <umain+0x249>
+  8016a8:	48 89 c2             	mov    %rax,%rdx
+    for (int i = 0; i < TEST_PAGES; i++)
+  8016ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (p[i * PAGE_SIZE] != 'A' + i) panic("private page %d is %02x", i, p[i * PAGE_SIZE]);
+  8016b0:	44 0f be 02          	movsbl (%rdx),%r8d
+  8016b4:	8d 71 41             	lea    0x41(%rcx),%esi
+  8016b7:	41 39 f0             	cmp    %esi,%r8d
+  8016ba:	0f 85 89 01 00 00    	jne    801849 <umain+0x273>
+    for (int i = 0; i < TEST_PAGES; i++)
+  8016c0:	83 c1 01             	add    $0x1,%ecx
+  8016c3:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8016ca:	83 f9 28             	cmp    $0x28,%ecx
+  8016cd:	75 e1                	jne    8016b0 <umain+0xda>
+    p[3 * PAGE_SIZE] = 'z';
+  8016cf:	c6 87 00 30 00 00 7a 	movb   $0x7a,0x3000(%rdi)
+    if ((res = munmap(p, TEST_PAGES * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+  8016d6:	be 00 80 02 00       	mov    $0x28000,%esi
+  8016db:	48 b8 de 55 80 00 00 	movabs $0x8055de,%rax
+  8016e2:	00 00 00 
+  8016e5:	ff d0                	call   *%rax
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	0f 88 85 01 00 00    	js     801874 <umain+0x29e>
+    check_file(fd, 3, 'A' + 3);
+  8016ef:	ba 44 00 00 00       	mov    $0x44,%edx
+  8016f4:	be 03 00 00 00       	mov    $0x3,%esi
+  8016f9:	44 89 ef             	mov    %r13d,%edi
+  8016fc:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801703:	00 00 00 
+  801706:	ff d0                	call   *%rax
+
+    /* Shared mapping, file can be closed while it is mapped */
+    char *s = mmap(NULL, TEST_PAGES * PAGE_SIZE, PROT_RW, MAP_SHARED, fd, PAGE_SIZE);
+  801708:	41 b9 00 10 00 00    	mov    $0x1000,%r9d
+  80170e:	45 89 e8             	mov    %r13d,%r8d
+  801711:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801716:	ba 06 00 00 00       	mov    $0x6,%edx
+  80171b:	be 00 80 02 00       	mov    $0x28000,%esi
+  801720:	bf 00 00 00 00       	mov    $0x0,%edi
+  801725:	48 b8 07 53 80 00 00 	movabs $0x805307,%rax
+  80172c:	00 00 00 
+  80172f:	ff d0                	call   *%rax
+  801731:	48 89 c3             	mov    %rax,%rbx
+    if (s == MAP_FAILED) panic("mmap shared failed");
+  801734:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  801738:	0f 84 63 01 00 00    	je     8018a1 <umain+0x2cb>
+    close(fd);
+  80173e:	44 89 ef             	mov    %r13d,%edi
+  801741:	48 b8 cd 37 80 00 00 	movabs $0x8037cd,%rax
+  801748:	00 00 00 
+  80174b:	ff d0                	call   *%rax
+    if (s[0] != 'A' + 1) panic("shared page 0 is %02x", s[0]);
+  80174d:	0f b6 03             	movzbl (%rbx),%eax
+  801750:	3c 42                	cmp    $0x42,%al
+  801752:	0f 85 73 01 00 00    	jne    8018cb <umain+0x2f5>
+
+    /* Changes are visible to children sharing the mapping */
+    envid_t child = fork();
+  801758:	48 b8 28 34 80 00 00 	movabs $0x803428,%rax
+  80175f:	00 00 00 
+  801762:	ff d0                	call   *%rax
+    if (child < 0) panic("fork: %i", child);
+  801764:	85 c0                	test   %eax,%eax
+  801766:	0f 88 8d 01 00 00    	js     8018f9 <umain+0x323>
+    if (!child) {
+  80176c:	0f 85 e1 01 00 00    	jne    801953 <umain+0x37d>
+        memset(s + 2 * PAGE_SIZE, 'x', PAGE_SIZE);
+  801772:	48 81 c3 00 20 00 00 	add    $0x2000,%rbx
+  801779:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80177e:	be 78 00 00 00       	mov    $0x78,%esi
+  801783:	48 89 df             	mov    %rbx,%rdi
+  801786:	48 b8 07 29 80 00 00 	movabs $0x802907,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+        /* Only the writer knows its pages are dirty */
+        if ((res = msync(s + 2 * PAGE_SIZE, PAGE_SIZE)) < 0) panic("msync: %i", res);
+  801792:	be 00 10 00 00       	mov    $0x1000,%esi
+  801797:	48 89 df             	mov    %rbx,%rdi
+  80179a:	48 b8 47 55 80 00 00 	movabs $0x805547,%rax
+  8017a1:	00 00 00 
+  8017a4:	ff d0                	call   *%rax
+  8017a6:	85 c0                	test   %eax,%eax
+  8017a8:	0f 88 78 01 00 00    	js     801926 <umain+0x350>
+    seek(fd, 6 * PAGE_SIZE);
+    if (readn(fd, buf, 1) != 1 || buf[0] != 'y') panic("shared write is lost");
+    close(fd);
+
+    cprintf("mmaptest: OK\n");
+}
+  8017ae:	48 83 c4 08          	add    $0x8,%rsp
+  8017b2:	5b                   	pop    %rbx
+  8017b3:	41 5c                	pop    %r12
+  8017b5:	41 5d                	pop    %r13
+  8017b7:	41 5e                	pop    %r14
+  8017b9:	41 5f                	pop    %r15
+  8017bb:	5d                   	pop    %rbp
+  8017bc:	c3                   	ret
+        panic("open %s: %i", TEST_FILE, fd);
+  8017bd:	41 89 c0             	mov    %eax,%r8d
+  8017c0:	48 b9 9e 64 80 00 00 	movabs $0x80649e,%rcx
+  8017c7:	00 00 00 
+  8017ca:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  8017d1:	00 00 00 
+  8017d4:	be 21 00 00 00       	mov    $0x21,%esi
+  8017d9:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  8017e0:	00 00 00 
+  8017e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e8:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  8017ef:	00 00 00 
+  8017f2:	41 ff d1             	call   *%r9
+        if (write(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("write failed");
+  8017f5:	48 ba b4 64 80 00 00 	movabs $0x8064b4,%rdx
+  8017fc:	00 00 00 
+  8017ff:	be 10 00 00 00       	mov    $0x10,%esi
+  801804:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  80180b:	00 00 00 
+  80180e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801813:	48 b9 de 1b 80 00 00 	movabs $0x801bde,%rcx
+  80181a:	00 00 00 
+  80181d:	ff d1                	call   *%rcx
+    if (p == MAP_FAILED) panic("mmap private failed");
+  80181f:	48 ba c1 64 80 00 00 	movabs $0x8064c1,%rdx
+  801826:	00 00 00 
+  801829:	be 26 00 00 00       	mov    $0x26,%esi
+  80182e:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  801835:	00 00 00 
+  801838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183d:	48 b9 de 1b 80 00 00 	movabs $0x801bde,%rcx
+  801844:	00 00 00 
+  801847:	ff d1                	call   *%rcx
+        if (p[i * PAGE_SIZE] != 'A' + i) panic("private page %d is %02x", i, p[i * PAGE_SIZE]);
+  801849:	48 ba d5 64 80 00 00 	movabs $0x8064d5,%rdx
+  801850:	00 00 00 
+  801853:	be 28 00 00 00       	mov    $0x28,%esi
+  801858:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  80185f:	00 00 00 
+  801862:	b8 00 00 00 00       	mov    $0x0,%eax
+  801867:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  80186e:	00 00 00 
+  801871:	41 ff d1             	call   *%r9
+    if ((res = munmap(p, TEST_PAGES * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+  801874:	89 c1                	mov    %eax,%ecx
+  801876:	48 ba ed 64 80 00 00 	movabs $0x8064ed,%rdx
+  80187d:	00 00 00 
+  801880:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801885:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  80188c:	00 00 00 
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801894:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  80189b:	00 00 00 
+  80189e:	41 ff d0             	call   *%r8
+    if (s == MAP_FAILED) panic("mmap shared failed");
+  8018a1:	48 ba f8 64 80 00 00 	movabs $0x8064f8,%rdx
+  8018a8:	00 00 00 
+  8018ab:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018b0:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  8018b7:	00 00 00 
+  8018ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bf:	48 b9 de 1b 80 00 00 	movabs $0x801bde,%rcx
+  8018c6:	00 00 00 
+  8018c9:	ff d1                	call   *%rcx
+    if (s[0] != 'A' + 1) panic("shared page 0 is %02x", s[0]);
+  8018cb:	0f be c8             	movsbl %al,%ecx
+  8018ce:	48 ba 0b 65 80 00 00 	movabs $0x80650b,%rdx
+  8018d5:	00 00 00 
+  8018d8:	be 31 00 00 00       	mov    $0x31,%esi
+  8018dd:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  8018e4:	00 00 00 
+  8018e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ec:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  8018f3:	00 00 00 
+  8018f6:	41 ff d0             	call   *%r8
+    if (child < 0) panic("fork: %i", child);
+  8018f9:	89 c1                	mov    %eax,%ecx
+  8018fb:	48 ba 1c 6b 80 00 00 	movabs $0x806b1c,%rdx
+  801902:	00 00 00 
+  801905:	be 35 00 00 00       	mov    $0x35,%esi
+  80190a:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  801911:	00 00 00 
+  801914:	b8 00 00 00 00       	mov    $0x0,%eax
+  801919:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  801920:	00 00 00 
+  801923:	41 ff d0             	call   *%r8
+        if ((res = msync(s + 2 * PAGE_SIZE, PAGE_SIZE)) < 0) panic("msync: %i", res);
+  801926:	89 c1                	mov    %eax,%ecx
+  801928:	48 ba 21 65 80 00 00 	movabs $0x806521,%rdx
+  80192f:	00 00 00 
+  801932:	be 39 00 00 00       	mov    $0x39,%esi
+  801937:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  80193e:	00 00 00 
+  801941:	b8 00 00 00 00       	mov    $0x0,%eax
+  801946:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  80194d:	00 00 00 
+  801950:	41 ff d0             	call   *%r8
+    wait(child);
+  801953:	89 c7                	mov    %eax,%edi
+  801955:	48 b8 54 4a 80 00 00 	movabs $0x804a54,%rax
+  80195c:	00 00 00 
+  80195f:	ff d0                	call   *%rax
+    if (s[2 * PAGE_SIZE] != 'x') panic("shared write is not visible");
+  801961:	80 bb 00 20 00 00 78 	cmpb   $0x78,0x2000(%rbx)
+  801968:	0f 85 eb 00 00 00    	jne    801a59 <umain+0x483>
+    s[5 * PAGE_SIZE] = 'y';
+  80196e:	c6 83 00 50 00 00 79 	movb   $0x79,0x5000(%rbx)
+    if ((res = munmap(s, TEST_PAGES * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+  801975:	be 00 80 02 00       	mov    $0x28000,%esi
+  80197a:	48 89 df             	mov    %rbx,%rdi
+  80197d:	48 b8 de 55 80 00 00 	movabs $0x8055de,%rax
+  801984:	00 00 00 
+  801987:	ff d0                	call   *%rax
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	0f 88 f2 00 00 00    	js     801a83 <umain+0x4ad>
+    if ((fd = open(TEST_FILE, O_RDONLY)) < 0) panic("open %s: %i", TEST_FILE, fd);
+  801991:	be 00 00 00 00       	mov    $0x0,%esi
+  801996:	48 bf 9e 64 80 00 00 	movabs $0x80649e,%rdi
+  80199d:	00 00 00 
+  8019a0:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8019a7:	00 00 00 
+  8019aa:	ff d0                	call   *%rax
+  8019ac:	89 c3                	mov    %eax,%ebx
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	0f 88 fa 00 00 00    	js     801ab0 <umain+0x4da>
+    check_file(fd, 3, 'x');
+  8019b6:	ba 78 00 00 00       	mov    $0x78,%edx
+  8019bb:	be 03 00 00 00       	mov    $0x3,%esi
+  8019c0:	89 c7                	mov    %eax,%edi
+  8019c2:	49 bc 01 15 80 00 00 	movabs $0x801501,%r12
+  8019c9:	00 00 00 
+  8019cc:	41 ff d4             	call   *%r12
+    check_file(fd, 4, 'A' + 4);
+  8019cf:	ba 45 00 00 00       	mov    $0x45,%edx
+  8019d4:	be 04 00 00 00       	mov    $0x4,%esi
+  8019d9:	89 df                	mov    %ebx,%edi
+  8019db:	41 ff d4             	call   *%r12
+    seek(fd, 6 * PAGE_SIZE);
+  8019de:	be 00 60 00 00       	mov    $0x6000,%esi
+  8019e3:	89 df                	mov    %ebx,%edi
+  8019e5:	48 b8 33 3b 80 00 00 	movabs $0x803b33,%rax
+  8019ec:	00 00 00 
+  8019ef:	ff d0                	call   *%rax
+    if (readn(fd, buf, 1) != 1 || buf[0] != 'y') panic("shared write is lost");
+  8019f1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8019f6:	48 be 20 80 80 01 00 	movabs $0x1808020,%rsi
+  8019fd:	00 00 00 
+  801a00:	89 df                	mov    %ebx,%edi
+  801a02:	48 b8 09 3a 80 00 00 	movabs $0x803a09,%rax
+  801a09:	00 00 00 
+  801a0c:	ff d0                	call   *%rax
+  801a0e:	48 83 f8 01          	cmp    $0x1,%rax
+  801a12:	0f 85 d0 00 00 00    	jne    801ae8 <umain+0x512>
+  801a18:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  801a1f:	00 00 00 
+  801a22:	80 38 79             	cmpb   $0x79,(%rax)
+  801a25:	0f 85 bd 00 00 00    	jne    801ae8 <umain+0x512>
+    close(fd);
+  801a2b:	89 df                	mov    %ebx,%edi
+  801a2d:	48 b8 cd 37 80 00 00 	movabs $0x8037cd,%rax
+  801a34:	00 00 00 
+  801a37:	ff d0                	call   *%rax
+    cprintf("mmaptest: OK\n");
+  801a39:	48 bf 5c 65 80 00 00 	movabs $0x80655c,%rdi
+  801a40:	00 00 00 
+  801a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a48:	48 ba 2e 1d 80 00 00 	movabs $0x801d2e,%rdx
+  801a4f:	00 00 00 
+  801a52:	ff d2                	call   *%rdx
+  801a54:	e9 55 fd ff ff       	jmp    8017ae <umain+0x1d8>
+    if (s[2 * PAGE_SIZE] != 'x') panic("shared write is not visible");
+  801a59:	48 ba 2b 65 80 00 00 	movabs $0x80652b,%rdx
+  801a60:	00 00 00 
+  801a63:	be 3d 00 00 00       	mov    $0x3d,%esi
+  801a68:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  801a6f:	00 00 00 
+  801a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a77:	48 b9 de 1b 80 00 00 	movabs $0x801bde,%rcx
+  801a7e:	00 00 00 
+  801a81:	ff d1                	call   *%rcx
+    if ((res = munmap(s, TEST_PAGES * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+  801a83:	89 c1                	mov    %eax,%ecx
+  801a85:	48 ba ed 64 80 00 00 	movabs $0x8064ed,%rdx
+  801a8c:	00 00 00 
+  801a8f:	be 3f 00 00 00       	mov    $0x3f,%esi
+  801a94:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  801a9b:	00 00 00 
+  801a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa3:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  801aaa:	00 00 00 
+  801aad:	41 ff d0             	call   *%r8
+    if ((fd = open(TEST_FILE, O_RDONLY)) < 0) panic("open %s: %i", TEST_FILE, fd);
+  801ab0:	41 89 c0             	mov    %eax,%r8d
+  801ab3:	48 b9 9e 64 80 00 00 	movabs $0x80649e,%rcx
+  801aba:	00 00 00 
+  801abd:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  801ac4:	00 00 00 
+  801ac7:	be 42 00 00 00       	mov    $0x42,%esi
+  801acc:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  801ad3:	00 00 00 
+  801ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801adb:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  801ae2:	00 00 00 
+  801ae5:	41 ff d1             	call   *%r9
+    if (readn(fd, buf, 1) != 1 || buf[0] != 'y') panic("shared write is lost");
+  801ae8:	48 ba 47 65 80 00 00 	movabs $0x806547,%rdx
+  801aef:	00 00 00 
+  801af2:	be 46 00 00 00       	mov    $0x46,%esi
+  801af7:	48 bf 8e 64 80 00 00 	movabs $0x80648e,%rdi
+  801afe:	00 00 00 
+  801b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b06:	48 b9 de 1b 80 00 00 	movabs $0x801bde,%rcx
+  801b0d:	00 00 00 
+  801b10:	ff d1                	call   *%rcx
+
+0000000000801b12 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801b12:	55                   	push   %rbp
+  801b13:	48 89 e5             	mov    %rsp,%rbp
+  801b16:	41 56                	push   %r14
+  801b18:	41 55                	push   %r13
+  801b1a:	41 54                	push   %r12
+  801b1c:	53                   	push   %rbx
+  801b1d:	41 89 fd             	mov    %edi,%r13d
+  801b20:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801b23:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801b2a:	00 00 00 
+  801b2d:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801b34:	00 00 00 
+  801b37:	48 39 c2             	cmp    %rax,%rdx
+  801b3a:	73 17                	jae    801b53 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801b3c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801b3f:	49 89 c4             	mov    %rax,%r12
+  801b42:	48 83 c3 08          	add    $0x8,%rbx
+  801b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4b:	ff 53 f8             	call   *-0x8(%rbx)
+  801b4e:	4c 39 e3             	cmp    %r12,%rbx
+  801b51:	72 ef                	jb     801b42 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801b53:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b64:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801b6b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b72:	00 00 00 
+  801b75:	48 01 d0             	add    %rdx,%rax
+  801b78:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  801b7f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801b82:	45 85 ed             	test   %r13d,%r13d
+  801b85:	7e 0d                	jle    801b94 <libmain+0x82>
+  801b87:	49 8b 06             	mov    (%r14),%rax
+  801b8a:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801b91:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801b94:	4c 89 f6             	mov    %r14,%rsi
+  801b97:	44 89 ef             	mov    %r13d,%edi
+  801b9a:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801ba6:	48 b8 bb 1b 80 00 00 	movabs $0x801bbb,%rax
+  801bad:	00 00 00 
+  801bb0:	ff d0                	call   *%rax
+#endif
+}
+  801bb2:	5b                   	pop    %rbx
+  801bb3:	41 5c                	pop    %r12
+  801bb5:	41 5d                	pop    %r13
+  801bb7:	41 5e                	pop    %r14
+  801bb9:	5d                   	pop    %rbp
+  801bba:	c3                   	ret
+
+0000000000801bbb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801bbb:	55                   	push   %rbp
+  801bbc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801bbf:	48 b8 00 38 80 00 00 	movabs $0x803800,%rax
+  801bc6:	00 00 00 
+  801bc9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801bcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd0:	48 b8 81 2c 80 00 00 	movabs $0x802c81,%rax
+  801bd7:	00 00 00 
+  801bda:	ff d0                	call   *%rax
+}
+  801bdc:	5d                   	pop    %rbp
+  801bdd:	c3                   	ret
+
+0000000000801bde <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801bde:	55                   	push   %rbp
+  801bdf:	48 89 e5             	mov    %rsp,%rbp
+  801be2:	41 56                	push   %r14
+  801be4:	41 55                	push   %r13
+  801be6:	41 54                	push   %r12
+  801be8:	53                   	push   %rbx
+  801be9:	48 83 ec 50          	sub    $0x50,%rsp
+  801bed:	49 89 fc             	mov    %rdi,%r12
+  801bf0:	41 89 f5             	mov    %esi,%r13d
+  801bf3:	48 89 d3             	mov    %rdx,%rbx
+  801bf6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801bfa:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801bfe:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c02:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c09:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c0d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c11:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c15:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c19:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801c20:	00 00 00 
+  801c23:	4c 8b 30             	mov    (%rax),%r14
+  801c26:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  801c2d:	00 00 00 
+  801c30:	ff d0                	call   *%rax
+  801c32:	89 c6                	mov    %eax,%esi
+  801c34:	45 89 e8             	mov    %r13d,%r8d
+  801c37:	4c 89 e1             	mov    %r12,%rcx
+  801c3a:	4c 89 f2             	mov    %r14,%rdx
+  801c3d:	48 bf a8 65 80 00 00 	movabs $0x8065a8,%rdi
+  801c44:	00 00 00 
+  801c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4c:	49 bc 2e 1d 80 00 00 	movabs $0x801d2e,%r12
+  801c53:	00 00 00 
+  801c56:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801c59:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801c5d:	48 89 df             	mov    %rbx,%rdi
+  801c60:	48 b8 ca 1c 80 00 00 	movabs $0x801cca,%rax
+  801c67:	00 00 00 
+  801c6a:	ff d0                	call   *%rax
+    cprintf("\n");
+  801c6c:	48 bf 68 65 80 00 00 	movabs $0x806568,%rdi
+  801c73:	00 00 00 
+  801c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801c7e:	cc                   	int3
+  801c7f:	eb fd                	jmp    801c7e <_panic+0xa0>
+
+0000000000801c81 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801c81:	55                   	push   %rbp
+  801c82:	48 89 e5             	mov    %rsp,%rbp
+  801c85:	53                   	push   %rbx
+  801c86:	48 83 ec 08          	sub    $0x8,%rsp
+  801c8a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801c8d:	8b 06                	mov    (%rsi),%eax
+  801c8f:	8d 50 01             	lea    0x1(%rax),%edx
+  801c92:	89 16                	mov    %edx,(%rsi)
+  801c94:	48 98                	cltq
+  801c96:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801c9b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801ca1:	74 0a                	je     801cad <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801ca3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801ca7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cab:	c9                   	leave
+  801cac:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801cad:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801cb1:	be ff 00 00 00       	mov    $0xff,%esi
+  801cb6:	48 b8 e2 2b 80 00 00 	movabs $0x802be2,%rax
+  801cbd:	00 00 00 
+  801cc0:	ff d0                	call   *%rax
+        state->offset = 0;
+  801cc2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801cc8:	eb d9                	jmp    801ca3 <putch+0x22>
+
+0000000000801cca <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801cca:	55                   	push   %rbp
+  801ccb:	48 89 e5             	mov    %rsp,%rbp
+  801cce:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801cd5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801cd8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801cdf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801cec:	48 89 f1             	mov    %rsi,%rcx
+  801cef:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801cf6:	48 bf 81 1c 80 00 00 	movabs $0x801c81,%rdi
+  801cfd:	00 00 00 
+  801d00:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  801d07:	00 00 00 
+  801d0a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d0c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d13:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d1a:	48 b8 e2 2b 80 00 00 	movabs $0x802be2,%rax
+  801d21:	00 00 00 
+  801d24:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d26:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d2c:	c9                   	leave
+  801d2d:	c3                   	ret
+
+0000000000801d2e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d2e:	55                   	push   %rbp
+  801d2f:	48 89 e5             	mov    %rsp,%rbp
+  801d32:	48 83 ec 50          	sub    $0x50,%rsp
+  801d36:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d3a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d3e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d42:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d46:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d4a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d51:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d59:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d5d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801d61:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801d65:	48 b8 ca 1c 80 00 00 	movabs $0x801cca,%rax
+  801d6c:	00 00 00 
+  801d6f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+
+0000000000801d73 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801d73:	55                   	push   %rbp
+  801d74:	48 89 e5             	mov    %rsp,%rbp
+  801d77:	41 57                	push   %r15
+  801d79:	41 56                	push   %r14
+  801d7b:	41 55                	push   %r13
+  801d7d:	41 54                	push   %r12
+  801d7f:	53                   	push   %rbx
+  801d80:	48 83 ec 18          	sub    $0x18,%rsp
+  801d84:	49 89 fc             	mov    %rdi,%r12
+  801d87:	49 89 f5             	mov    %rsi,%r13
+  801d8a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d8e:	8b 45 10             	mov    0x10(%rbp),%eax
+  801d91:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801d94:	41 89 cf             	mov    %ecx,%r15d
+  801d97:	4c 39 fa             	cmp    %r15,%rdx
+  801d9a:	73 5b                	jae    801df7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801d9c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801da0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801da4:	85 db                	test   %ebx,%ebx
+  801da6:	7e 0e                	jle    801db6 <print_num+0x43>
+            putch(padc, put_arg);
+  801da8:	4c 89 ee             	mov    %r13,%rsi
+  801dab:	44 89 f7             	mov    %r14d,%edi
+  801dae:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801db1:	83 eb 01             	sub    $0x1,%ebx
+  801db4:	75 f2                	jne    801da8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801db6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801dba:	48 b9 dc 65 80 00 00 	movabs $0x8065dc,%rcx
+  801dc1:	00 00 00 
+  801dc4:	48 b8 cb 65 80 00 00 	movabs $0x8065cb,%rax
+  801dcb:	00 00 00 
+  801dce:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801dd2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ddb:	49 f7 f7             	div    %r15
+  801dde:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801de2:	4c 89 ee             	mov    %r13,%rsi
+  801de5:	41 ff d4             	call   *%r12
+}
+  801de8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801dec:	5b                   	pop    %rbx
+  801ded:	41 5c                	pop    %r12
+  801def:	41 5d                	pop    %r13
+  801df1:	41 5e                	pop    %r14
+  801df3:	41 5f                	pop    %r15
+  801df5:	5d                   	pop    %rbp
+  801df6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801df7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e00:	49 f7 f7             	div    %r15
+  801e03:	48 83 ec 08          	sub    $0x8,%rsp
+  801e07:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e0b:	52                   	push   %rdx
+  801e0c:	45 0f be c9          	movsbl %r9b,%r9d
+  801e10:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e14:	48 89 c2             	mov    %rax,%rdx
+  801e17:	48 b8 73 1d 80 00 00 	movabs $0x801d73,%rax
+  801e1e:	00 00 00 
+  801e21:	ff d0                	call   *%rax
+  801e23:	48 83 c4 10          	add    $0x10,%rsp
+  801e27:	eb 8d                	jmp    801db6 <print_num+0x43>
+
+0000000000801e29 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e29:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e2d:	48 8b 06             	mov    (%rsi),%rax
+  801e30:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e34:	73 0a                	jae    801e40 <sprintputch+0x17>
+        *state->start++ = ch;
+  801e36:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e3a:	48 89 16             	mov    %rdx,(%rsi)
+  801e3d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e40:	c3                   	ret
+
+0000000000801e41 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e41:	55                   	push   %rbp
+  801e42:	48 89 e5             	mov    %rsp,%rbp
+  801e45:	48 83 ec 50          	sub    $0x50,%rsp
+  801e49:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e4d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e51:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e55:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801e5c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e64:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801e68:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801e6c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801e70:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+}
+  801e7c:	c9                   	leave
+  801e7d:	c3                   	ret
+
+0000000000801e7e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801e7e:	55                   	push   %rbp
+  801e7f:	48 89 e5             	mov    %rsp,%rbp
+  801e82:	41 57                	push   %r15
+  801e84:	41 56                	push   %r14
+  801e86:	41 55                	push   %r13
+  801e88:	41 54                	push   %r12
+  801e8a:	53                   	push   %rbx
+  801e8b:	48 83 ec 38          	sub    $0x38,%rsp
+  801e8f:	49 89 fe             	mov    %rdi,%r14
+  801e92:	49 89 f5             	mov    %rsi,%r13
+  801e95:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801e98:	48 8b 01             	mov    (%rcx),%rax
+  801e9b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801e9f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ea3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801eab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801eaf:	eb 0d                	jmp    801ebe <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801eb1:	40 0f b6 ff          	movzbl %dil,%edi
+  801eb5:	4c 89 ee             	mov    %r13,%rsi
+  801eb8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801ebb:	4c 89 e3             	mov    %r12,%rbx
+  801ebe:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801ec2:	0f b6 3b             	movzbl (%rbx),%edi
+  801ec5:	40 80 ff 25          	cmp    $0x25,%dil
+  801ec9:	74 14                	je     801edf <vprintfmt+0x61>
+            if (!ch) return;
+  801ecb:	40 84 ff             	test   %dil,%dil
+  801ece:	75 e1                	jne    801eb1 <vprintfmt+0x33>
+}
+  801ed0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801ed4:	5b                   	pop    %rbx
+  801ed5:	41 5c                	pop    %r12
+  801ed7:	41 5d                	pop    %r13
+  801ed9:	41 5e                	pop    %r14
+  801edb:	41 5f                	pop    %r15
+  801edd:	5d                   	pop    %rbp
+  801ede:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801edf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801ee8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801eed:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801ef3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801efa:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801efe:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f03:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f08:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f0b:	83 e8 23             	sub    $0x23,%eax
+  801f0e:	3c 57                	cmp    $0x57,%al
+  801f10:	0f 87 67 06 00 00    	ja     80257d <vprintfmt+0x6ff>
+  801f16:	0f b6 c0             	movzbl %al,%eax
+  801f19:	48 b9 60 67 80 00 00 	movabs $0x806760,%rcx
+  801f20:	00 00 00 
+  801f23:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f26:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f29:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f2d:	eb cf                	jmp    801efe <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801f2f:	49 89 dc             	mov    %rbx,%r12
+  801f32:	be 01 00 00 00       	mov    $0x1,%esi
+  801f37:	eb c5                	jmp    801efe <vprintfmt+0x80>
+            padc = ch;
+  801f39:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f3d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f40:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f43:	eb b9                	jmp    801efe <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801f45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f48:	83 f8 2f             	cmp    $0x2f,%eax
+  801f4b:	77 24                	ja     801f71 <vprintfmt+0xf3>
+  801f4d:	89 c1                	mov    %eax,%ecx
+  801f4f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f53:	83 c0 08             	add    $0x8,%eax
+  801f56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f59:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f5c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f5f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f63:	79 99                	jns    801efe <vprintfmt+0x80>
+                width = precision;
+  801f65:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801f69:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f6f:	eb 8d                	jmp    801efe <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801f71:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f75:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801f79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7d:	eb da                	jmp    801f59 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801f7f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801f84:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801f88:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801f8e:	3c 39                	cmp    $0x39,%al
+  801f90:	77 1c                	ja     801fae <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801f92:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801f96:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801f9a:	0f b6 c0             	movzbl %al,%eax
+  801f9d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fa2:	0f b6 03             	movzbl (%rbx),%eax
+  801fa5:	3c 39                	cmp    $0x39,%al
+  801fa7:	76 e9                	jbe    801f92 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801fa9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fac:	eb b1                	jmp    801f5f <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801fae:	49 89 dc             	mov    %rbx,%r12
+  801fb1:	eb ac                	jmp    801f5f <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801fb3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801fb6:	85 c9                	test   %ecx,%ecx
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbd:	0f 49 c1             	cmovns %ecx,%eax
+  801fc0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801fc3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fc6:	e9 33 ff ff ff       	jmp    801efe <vprintfmt+0x80>
+            lflag++;
+  801fcb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801fce:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fd1:	e9 28 ff ff ff       	jmp    801efe <vprintfmt+0x80>
+            lflag--;
+  801fd6:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801fd9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fdc:	e9 1d ff ff ff       	jmp    801efe <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801fe1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fe4:	83 f8 2f             	cmp    $0x2f,%eax
+  801fe7:	77 19                	ja     802002 <vprintfmt+0x184>
+  801fe9:	89 c2                	mov    %eax,%edx
+  801feb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fef:	83 c0 08             	add    $0x8,%eax
+  801ff2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ff5:	8b 3a                	mov    (%rdx),%edi
+  801ff7:	4c 89 ee             	mov    %r13,%rsi
+  801ffa:	41 ff d6             	call   *%r14
+            break;
+  801ffd:	e9 bc fe ff ff       	jmp    801ebe <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  802002:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802006:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80200a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80200e:	eb e5                	jmp    801ff5 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  802010:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802013:	83 f8 2f             	cmp    $0x2f,%eax
+  802016:	77 5a                	ja     802072 <vprintfmt+0x1f4>
+  802018:	89 c2                	mov    %eax,%edx
+  80201a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80201e:	83 c0 08             	add    $0x8,%eax
+  802021:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802024:	8b 02                	mov    (%rdx),%eax
+  802026:	89 c1                	mov    %eax,%ecx
+  802028:	f7 d9                	neg    %ecx
+  80202a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80202d:	83 f9 13             	cmp    $0x13,%ecx
+  802030:	7f 4e                	jg     802080 <vprintfmt+0x202>
+  802032:	48 63 c1             	movslq %ecx,%rax
+  802035:	48 ba 20 6a 80 00 00 	movabs $0x806a20,%rdx
+  80203c:	00 00 00 
+  80203f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802043:	48 85 c0             	test   %rax,%rax
+  802046:	74 38                	je     802080 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  802048:	48 89 c1             	mov    %rax,%rcx
+  80204b:	48 ba 68 6c 80 00 00 	movabs $0x806c68,%rdx
+  802052:	00 00 00 
+  802055:	4c 89 ee             	mov    %r13,%rsi
+  802058:	4c 89 f7             	mov    %r14,%rdi
+  80205b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802060:	49 b8 41 1e 80 00 00 	movabs $0x801e41,%r8
+  802067:	00 00 00 
+  80206a:	41 ff d0             	call   *%r8
+  80206d:	e9 4c fe ff ff       	jmp    801ebe <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  802072:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802076:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80207a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80207e:	eb a4                	jmp    802024 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  802080:	48 ba f4 65 80 00 00 	movabs $0x8065f4,%rdx
+  802087:	00 00 00 
+  80208a:	4c 89 ee             	mov    %r13,%rsi
+  80208d:	4c 89 f7             	mov    %r14,%rdi
+  802090:	b8 00 00 00 00       	mov    $0x0,%eax
+  802095:	49 b8 41 1e 80 00 00 	movabs $0x801e41,%r8
+  80209c:	00 00 00 
+  80209f:	41 ff d0             	call   *%r8
+  8020a2:	e9 17 fe ff ff       	jmp    801ebe <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8020a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ad:	77 6c                	ja     80211b <vprintfmt+0x29d>
+  8020af:	89 c2                	mov    %eax,%edx
+  8020b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020b5:	83 c0 08             	add    $0x8,%eax
+  8020b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020bb:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8020be:	48 85 f6             	test   %rsi,%rsi
+  8020c1:	48 b8 ed 65 80 00 00 	movabs $0x8065ed,%rax
+  8020c8:	00 00 00 
+  8020cb:	48 0f 45 c6          	cmovne %rsi,%rax
+  8020cf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8020d3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8020d7:	7e 06                	jle    8020df <vprintfmt+0x261>
+  8020d9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8020dd:	75 4a                	jne    802129 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8020df:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020e3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8020e7:	0f b6 00             	movzbl (%rax),%eax
+  8020ea:	84 c0                	test   %al,%al
+  8020ec:	0f 85 9a 00 00 00    	jne    80218c <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  8020f2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8020f5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	0f 8e bd fd ff ff    	jle    801ebe <vprintfmt+0x40>
+  802101:	4c 89 ee             	mov    %r13,%rsi
+  802104:	bf 20 00 00 00       	mov    $0x20,%edi
+  802109:	41 ff d6             	call   *%r14
+  80210c:	41 83 ec 01          	sub    $0x1,%r12d
+  802110:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802114:	75 eb                	jne    802101 <vprintfmt+0x283>
+  802116:	e9 a3 fd ff ff       	jmp    801ebe <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  80211b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80211f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802123:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802127:	eb 92                	jmp    8020bb <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  802129:	49 63 f7             	movslq %r15d,%rsi
+  80212c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802130:	48 b8 42 26 80 00 00 	movabs $0x802642,%rax
+  802137:	00 00 00 
+  80213a:	ff d0                	call   *%rax
+  80213c:	48 89 c2             	mov    %rax,%rdx
+  80213f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802142:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802144:	8d 50 ff             	lea    -0x1(%rax),%edx
+  802147:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	7e 91                	jle    8020df <vprintfmt+0x261>
+  80214e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802153:	4c 89 ee             	mov    %r13,%rsi
+  802156:	44 89 e7             	mov    %r12d,%edi
+  802159:	41 ff d6             	call   *%r14
+  80215c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802160:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802163:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802166:	75 eb                	jne    802153 <vprintfmt+0x2d5>
+  802168:	e9 72 ff ff ff       	jmp    8020df <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80216d:	0f b6 f8             	movzbl %al,%edi
+  802170:	4c 89 ee             	mov    %r13,%rsi
+  802173:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802176:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80217a:	49 83 c4 01          	add    $0x1,%r12
+  80217e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802184:	84 c0                	test   %al,%al
+  802186:	0f 84 66 ff ff ff    	je     8020f2 <vprintfmt+0x274>
+  80218c:	45 85 ff             	test   %r15d,%r15d
+  80218f:	78 0a                	js     80219b <vprintfmt+0x31d>
+  802191:	41 83 ef 01          	sub    $0x1,%r15d
+  802195:	0f 88 57 ff ff ff    	js     8020f2 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80219b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80219f:	74 cc                	je     80216d <vprintfmt+0x2ef>
+  8021a1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021a4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021a9:	80 fa 5e             	cmp    $0x5e,%dl
+  8021ac:	77 c2                	ja     802170 <vprintfmt+0x2f2>
+  8021ae:	eb bd                	jmp    80216d <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  8021b0:	40 84 f6             	test   %sil,%sil
+  8021b3:	75 26                	jne    8021db <vprintfmt+0x35d>
+    switch (lflag) {
+  8021b5:	85 d2                	test   %edx,%edx
+  8021b7:	74 59                	je     802212 <vprintfmt+0x394>
+  8021b9:	83 fa 01             	cmp    $0x1,%edx
+  8021bc:	74 7b                	je     802239 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  8021be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c4:	0f 87 96 00 00 00    	ja     802260 <vprintfmt+0x3e2>
+  8021ca:	89 c2                	mov    %eax,%edx
+  8021cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021d0:	83 c0 08             	add    $0x8,%eax
+  8021d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d6:	4c 8b 22             	mov    (%rdx),%r12
+  8021d9:	eb 17                	jmp    8021f2 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  8021db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021de:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e1:	77 21                	ja     802204 <vprintfmt+0x386>
+  8021e3:	89 c2                	mov    %eax,%edx
+  8021e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e9:	83 c0 08             	add    $0x8,%eax
+  8021ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021ef:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8021f2:	4d 85 e4             	test   %r12,%r12
+  8021f5:	78 7a                	js     802271 <vprintfmt+0x3f3>
+            num = i;
+  8021f7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8021fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8021ff:	e9 56 02 00 00       	jmp    80245a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802204:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802208:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80220c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802210:	eb dd                	jmp    8021ef <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  802212:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802215:	83 f8 2f             	cmp    $0x2f,%eax
+  802218:	77 11                	ja     80222b <vprintfmt+0x3ad>
+  80221a:	89 c2                	mov    %eax,%edx
+  80221c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802220:	83 c0 08             	add    $0x8,%eax
+  802223:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802226:	4c 63 22             	movslq (%rdx),%r12
+  802229:	eb c7                	jmp    8021f2 <vprintfmt+0x374>
+  80222b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80222f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802233:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802237:	eb ed                	jmp    802226 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  802239:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80223c:	83 f8 2f             	cmp    $0x2f,%eax
+  80223f:	77 11                	ja     802252 <vprintfmt+0x3d4>
+  802241:	89 c2                	mov    %eax,%edx
+  802243:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802247:	83 c0 08             	add    $0x8,%eax
+  80224a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80224d:	4c 8b 22             	mov    (%rdx),%r12
+  802250:	eb a0                	jmp    8021f2 <vprintfmt+0x374>
+  802252:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802256:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80225a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225e:	eb ed                	jmp    80224d <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  802260:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802264:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802268:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80226c:	e9 65 ff ff ff       	jmp    8021d6 <vprintfmt+0x358>
+                putch('-', put_arg);
+  802271:	4c 89 ee             	mov    %r13,%rsi
+  802274:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802279:	41 ff d6             	call   *%r14
+                i = -i;
+  80227c:	49 f7 dc             	neg    %r12
+  80227f:	e9 73 ff ff ff       	jmp    8021f7 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  802284:	40 84 f6             	test   %sil,%sil
+  802287:	75 2e                	jne    8022b7 <vprintfmt+0x439>
+    switch (lflag) {
+  802289:	85 d2                	test   %edx,%edx
+  80228b:	7f 59                	jg     8022e6 <vprintfmt+0x468>
+  80228d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802290:	7d 7a                	jge    80230c <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802292:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802295:	83 f8 2f             	cmp    $0x2f,%eax
+  802298:	0f 87 aa 00 00 00    	ja     802348 <vprintfmt+0x4ca>
+  80229e:	89 c2                	mov    %eax,%edx
+  8022a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022a4:	83 c0 08             	add    $0x8,%eax
+  8022a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022aa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022b2:	e9 a3 01 00 00       	jmp    80245a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8022b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8022bd:	77 19                	ja     8022d8 <vprintfmt+0x45a>
+  8022bf:	89 c2                	mov    %eax,%edx
+  8022c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c5:	83 c0 08             	add    $0x8,%eax
+  8022c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022cb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022d3:	e9 82 01 00 00       	jmp    80245a <vprintfmt+0x5dc>
+  8022d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e4:	eb e5                	jmp    8022cb <vprintfmt+0x44d>
+    switch (lflag) {
+  8022e6:	83 fa 01             	cmp    $0x1,%edx
+  8022e9:	75 a7                	jne    802292 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  8022eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8022f1:	77 47                	ja     80233a <vprintfmt+0x4bc>
+  8022f3:	89 c2                	mov    %eax,%edx
+  8022f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022f9:	83 c0 08             	add    $0x8,%eax
+  8022fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022ff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802302:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802307:	e9 4e 01 00 00       	jmp    80245a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80230c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80230f:	83 f8 2f             	cmp    $0x2f,%eax
+  802312:	77 18                	ja     80232c <vprintfmt+0x4ae>
+  802314:	89 c2                	mov    %eax,%edx
+  802316:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80231a:	83 c0 08             	add    $0x8,%eax
+  80231d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802320:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802322:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802327:	e9 2e 01 00 00       	jmp    80245a <vprintfmt+0x5dc>
+  80232c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802330:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802334:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802338:	eb e6                	jmp    802320 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  80233a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80233e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802342:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802346:	eb b7                	jmp    8022ff <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802348:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80234c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802354:	e9 51 ff ff ff       	jmp    8022aa <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802359:	40 84 f6             	test   %sil,%sil
+  80235c:	75 2e                	jne    80238c <vprintfmt+0x50e>
+    switch (lflag) {
+  80235e:	85 d2                	test   %edx,%edx
+  802360:	7f 59                	jg     8023bb <vprintfmt+0x53d>
+  802362:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802365:	7d 77                	jge    8023de <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802367:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80236a:	83 f8 2f             	cmp    $0x2f,%eax
+  80236d:	0f 87 a4 00 00 00    	ja     802417 <vprintfmt+0x599>
+  802373:	89 c2                	mov    %eax,%edx
+  802375:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802379:	83 c0 08             	add    $0x8,%eax
+  80237c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80237f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802382:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802387:	e9 ce 00 00 00       	jmp    80245a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80238c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80238f:	83 f8 2f             	cmp    $0x2f,%eax
+  802392:	77 19                	ja     8023ad <vprintfmt+0x52f>
+  802394:	89 c2                	mov    %eax,%edx
+  802396:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80239a:	83 c0 08             	add    $0x8,%eax
+  80239d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023a0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023a3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023a8:	e9 ad 00 00 00       	jmp    80245a <vprintfmt+0x5dc>
+  8023ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023b9:	eb e5                	jmp    8023a0 <vprintfmt+0x522>
+    switch (lflag) {
+  8023bb:	83 fa 01             	cmp    $0x1,%edx
+  8023be:	75 a7                	jne    802367 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8023c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c6:	77 41                	ja     802409 <vprintfmt+0x58b>
+  8023c8:	89 c2                	mov    %eax,%edx
+  8023ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ce:	83 c0 08             	add    $0x8,%eax
+  8023d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023d7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8023dc:	eb 7c                	jmp    80245a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8023de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8023e4:	77 15                	ja     8023fb <vprintfmt+0x57d>
+  8023e6:	89 c2                	mov    %eax,%edx
+  8023e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ec:	83 c0 08             	add    $0x8,%eax
+  8023ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023f2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8023f4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8023f9:	eb 5f                	jmp    80245a <vprintfmt+0x5dc>
+  8023fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802403:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802407:	eb e9                	jmp    8023f2 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802409:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80240d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802411:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802415:	eb bd                	jmp    8023d4 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802417:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80241b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80241f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802423:	e9 57 ff ff ff       	jmp    80237f <vprintfmt+0x501>
+            putch('0', put_arg);
+  802428:	4c 89 ee             	mov    %r13,%rsi
+  80242b:	bf 30 00 00 00       	mov    $0x30,%edi
+  802430:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802433:	4c 89 ee             	mov    %r13,%rsi
+  802436:	bf 78 00 00 00       	mov    $0x78,%edi
+  80243b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80243e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802441:	83 f8 2f             	cmp    $0x2f,%eax
+  802444:	77 47                	ja     80248d <vprintfmt+0x60f>
+  802446:	89 c2                	mov    %eax,%edx
+  802448:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80244c:	83 c0 08             	add    $0x8,%eax
+  80244f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802452:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802455:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80245a:	48 83 ec 08          	sub    $0x8,%rsp
+  80245e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802462:	0f 94 c0             	sete   %al
+  802465:	0f b6 c0             	movzbl %al,%eax
+  802468:	50                   	push   %rax
+  802469:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80246e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802472:	4c 89 ee             	mov    %r13,%rsi
+  802475:	4c 89 f7             	mov    %r14,%rdi
+  802478:	48 b8 73 1d 80 00 00 	movabs $0x801d73,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+            break;
+  802484:	48 83 c4 10          	add    $0x10,%rsp
+  802488:	e9 31 fa ff ff       	jmp    801ebe <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80248d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802491:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802495:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802499:	eb b7                	jmp    802452 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80249b:	40 84 f6             	test   %sil,%sil
+  80249e:	75 2b                	jne    8024cb <vprintfmt+0x64d>
+    switch (lflag) {
+  8024a0:	85 d2                	test   %edx,%edx
+  8024a2:	7f 56                	jg     8024fa <vprintfmt+0x67c>
+  8024a4:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8024a7:	7d 77                	jge    802520 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8024a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8024af:	0f 87 a7 00 00 00    	ja     80255c <vprintfmt+0x6de>
+  8024b5:	89 c2                	mov    %eax,%edx
+  8024b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024bb:	83 c0 08             	add    $0x8,%eax
+  8024be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024c1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024c9:	eb 8f                	jmp    80245a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8024cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8024d1:	77 19                	ja     8024ec <vprintfmt+0x66e>
+  8024d3:	89 c2                	mov    %eax,%edx
+  8024d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024d9:	83 c0 08             	add    $0x8,%eax
+  8024dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024e2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8024e7:	e9 6e ff ff ff       	jmp    80245a <vprintfmt+0x5dc>
+  8024ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024f8:	eb e5                	jmp    8024df <vprintfmt+0x661>
+    switch (lflag) {
+  8024fa:	83 fa 01             	cmp    $0x1,%edx
+  8024fd:	75 aa                	jne    8024a9 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8024ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802502:	83 f8 2f             	cmp    $0x2f,%eax
+  802505:	77 47                	ja     80254e <vprintfmt+0x6d0>
+  802507:	89 c2                	mov    %eax,%edx
+  802509:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80250d:	83 c0 08             	add    $0x8,%eax
+  802510:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802513:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802516:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80251b:	e9 3a ff ff ff       	jmp    80245a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802520:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802523:	83 f8 2f             	cmp    $0x2f,%eax
+  802526:	77 18                	ja     802540 <vprintfmt+0x6c2>
+  802528:	89 c2                	mov    %eax,%edx
+  80252a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80252e:	83 c0 08             	add    $0x8,%eax
+  802531:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802534:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802536:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80253b:	e9 1a ff ff ff       	jmp    80245a <vprintfmt+0x5dc>
+  802540:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802544:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802548:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80254c:	eb e6                	jmp    802534 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80254e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802552:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802556:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80255a:	eb b7                	jmp    802513 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80255c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802560:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802564:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802568:	e9 54 ff ff ff       	jmp    8024c1 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  80256d:	4c 89 ee             	mov    %r13,%rsi
+  802570:	bf 25 00 00 00       	mov    $0x25,%edi
+  802575:	41 ff d6             	call   *%r14
+            break;
+  802578:	e9 41 f9 ff ff       	jmp    801ebe <vprintfmt+0x40>
+            putch('%', put_arg);
+  80257d:	4c 89 ee             	mov    %r13,%rsi
+  802580:	bf 25 00 00 00       	mov    $0x25,%edi
+  802585:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802588:	48 83 eb 01          	sub    $0x1,%rbx
+  80258c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802590:	75 f6                	jne    802588 <vprintfmt+0x70a>
+  802592:	e9 27 f9 ff ff       	jmp    801ebe <vprintfmt+0x40>
+
+0000000000802597 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802597:	55                   	push   %rbp
+  802598:	48 89 e5             	mov    %rsp,%rbp
+  80259b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80259f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025a3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025a8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025ac:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025b3:	48 85 ff             	test   %rdi,%rdi
+  8025b6:	74 2b                	je     8025e3 <vsnprintf+0x4c>
+  8025b8:	48 85 f6             	test   %rsi,%rsi
+  8025bb:	74 26                	je     8025e3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025bd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025c1:	48 bf 29 1e 80 00 00 	movabs $0x801e29,%rdi
+  8025c8:	00 00 00 
+  8025cb:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8025d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025db:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8025de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8025e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025e8:	eb f7                	jmp    8025e1 <vsnprintf+0x4a>
+
+00000000008025ea <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8025ea:	55                   	push   %rbp
+  8025eb:	48 89 e5             	mov    %rsp,%rbp
+  8025ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8025f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8025f6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8025fa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8025fe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802605:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802609:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80260d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802611:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802615:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802619:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  802620:	00 00 00 
+  802623:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802625:	c9                   	leave
+  802626:	c3                   	ret
+
+0000000000802627 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802627:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80262a:	74 10                	je     80263c <strlen+0x15>
+    size_t n = 0;
+  80262c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802631:	48 83 c0 01          	add    $0x1,%rax
+  802635:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802639:	75 f6                	jne    802631 <strlen+0xa>
+  80263b:	c3                   	ret
+    size_t n = 0;
+  80263c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802641:	c3                   	ret
+
+0000000000802642 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802642:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802645:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80264a:	48 85 f6             	test   %rsi,%rsi
+  80264d:	74 11                	je     802660 <strnlen+0x1e>
+  80264f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802653:	74 0c                	je     802661 <strnlen+0x1f>
+  802655:	48 83 c2 01          	add    $0x1,%rdx
+  802659:	48 39 d0             	cmp    %rdx,%rax
+  80265c:	75 f1                	jne    80264f <strnlen+0xd>
+  80265e:	eb 04                	jmp    802664 <strnlen+0x22>
+  802660:	c3                   	ret
+  802661:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802664:	c3                   	ret
+
+0000000000802665 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802665:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802671:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802674:	48 83 c2 01          	add    $0x1,%rdx
+  802678:	84 c9                	test   %cl,%cl
+  80267a:	75 f1                	jne    80266d <strcpy+0x8>
+        ;
+    return res;
+}
+  80267c:	c3                   	ret
+
+000000000080267d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80267d:	55                   	push   %rbp
+  80267e:	48 89 e5             	mov    %rsp,%rbp
+  802681:	41 54                	push   %r12
+  802683:	53                   	push   %rbx
+  802684:	48 89 fb             	mov    %rdi,%rbx
+  802687:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80268a:	48 b8 27 26 80 00 00 	movabs $0x802627,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802696:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80269a:	4c 89 e6             	mov    %r12,%rsi
+  80269d:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  8026a4:	00 00 00 
+  8026a7:	ff d0                	call   *%rax
+    return dst;
+}
+  8026a9:	48 89 d8             	mov    %rbx,%rax
+  8026ac:	5b                   	pop    %rbx
+  8026ad:	41 5c                	pop    %r12
+  8026af:	5d                   	pop    %rbp
+  8026b0:	c3                   	ret
+
+00000000008026b1 <toupper>:
+
+int
+toupper(int ch) {
+  8026b1:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8026b3:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8026b6:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8026b9:	83 f9 1a             	cmp    $0x1a,%ecx
+  8026bc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8026bf:	c3                   	ret
+
+00000000008026c0 <tolower>:
+
+int
+tolower(int ch) {
+  8026c0:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8026c2:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8026c5:	8d 57 20             	lea    0x20(%rdi),%edx
+  8026c8:	83 f9 1a             	cmp    $0x1a,%ecx
+  8026cb:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8026ce:	c3                   	ret
+
+00000000008026cf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026cf:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026d2:	48 85 d2             	test   %rdx,%rdx
+  8026d5:	74 1f                	je     8026f6 <strncpy+0x27>
+  8026d7:	48 01 fa             	add    %rdi,%rdx
+  8026da:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026dd:	48 83 c1 01          	add    $0x1,%rcx
+  8026e1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026e5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8026e9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8026ed:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8026f1:	48 39 ca             	cmp    %rcx,%rdx
+  8026f4:	75 e7                	jne    8026dd <strncpy+0xe>
+    }
+    return ret;
+}
+  8026f6:	c3                   	ret
+
+00000000008026f7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8026f7:	48 89 f8             	mov    %rdi,%rax
+  8026fa:	48 85 d2             	test   %rdx,%rdx
+  8026fd:	74 24                	je     802723 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8026ff:	48 83 ea 01          	sub    $0x1,%rdx
+  802703:	74 1b                	je     802720 <strlcpy+0x29>
+  802705:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802709:	0f b6 16             	movzbl (%rsi),%edx
+  80270c:	84 d2                	test   %dl,%dl
+  80270e:	74 10                	je     802720 <strlcpy+0x29>
+            *dst++ = *src++;
+  802710:	48 83 c6 01          	add    $0x1,%rsi
+  802714:	48 83 c0 01          	add    $0x1,%rax
+  802718:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80271b:	48 39 c8             	cmp    %rcx,%rax
+  80271e:	75 e9                	jne    802709 <strlcpy+0x12>
+        *dst = '\0';
+  802720:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802723:	48 29 f8             	sub    %rdi,%rax
+}
+  802726:	c3                   	ret
+
+0000000000802727 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802727:	0f b6 07             	movzbl (%rdi),%eax
+  80272a:	84 c0                	test   %al,%al
+  80272c:	74 13                	je     802741 <strcmp+0x1a>
+  80272e:	38 06                	cmp    %al,(%rsi)
+  802730:	75 0f                	jne    802741 <strcmp+0x1a>
+  802732:	48 83 c7 01          	add    $0x1,%rdi
+  802736:	48 83 c6 01          	add    $0x1,%rsi
+  80273a:	0f b6 07             	movzbl (%rdi),%eax
+  80273d:	84 c0                	test   %al,%al
+  80273f:	75 ed                	jne    80272e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802741:	0f b6 c0             	movzbl %al,%eax
+  802744:	0f b6 16             	movzbl (%rsi),%edx
+  802747:	29 d0                	sub    %edx,%eax
+}
+  802749:	c3                   	ret
+
+000000000080274a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80274a:	48 85 d2             	test   %rdx,%rdx
+  80274d:	74 1f                	je     80276e <strncmp+0x24>
+  80274f:	0f b6 07             	movzbl (%rdi),%eax
+  802752:	84 c0                	test   %al,%al
+  802754:	74 1e                	je     802774 <strncmp+0x2a>
+  802756:	3a 06                	cmp    (%rsi),%al
+  802758:	75 1a                	jne    802774 <strncmp+0x2a>
+  80275a:	48 83 c7 01          	add    $0x1,%rdi
+  80275e:	48 83 c6 01          	add    $0x1,%rsi
+  802762:	48 83 ea 01          	sub    $0x1,%rdx
+  802766:	75 e7                	jne    80274f <strncmp+0x5>
+
+    if (!n) return 0;
+  802768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276d:	c3                   	ret
+  80276e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802773:	c3                   	ret
+  802774:	48 85 d2             	test   %rdx,%rdx
+  802777:	74 09                	je     802782 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802779:	0f b6 07             	movzbl (%rdi),%eax
+  80277c:	0f b6 16             	movzbl (%rsi),%edx
+  80277f:	29 d0                	sub    %edx,%eax
+  802781:	c3                   	ret
+    if (!n) return 0;
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802787:	c3                   	ret
+
+0000000000802788 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802788:	0f b6 17             	movzbl (%rdi),%edx
+  80278b:	84 d2                	test   %dl,%dl
+  80278d:	74 18                	je     8027a7 <strchr+0x1f>
+        if (*str == c) {
+  80278f:	0f be d2             	movsbl %dl,%edx
+  802792:	39 f2                	cmp    %esi,%edx
+  802794:	74 17                	je     8027ad <strchr+0x25>
+    for (; *str; str++) {
+  802796:	48 83 c7 01          	add    $0x1,%rdi
+  80279a:	0f b6 17             	movzbl (%rdi),%edx
+  80279d:	84 d2                	test   %dl,%dl
+  80279f:	75 ee                	jne    80278f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a6:	c3                   	ret
+  8027a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ac:	c3                   	ret
+  8027ad:	48 89 f8             	mov    %rdi,%rax
+}
+  8027b0:	c3                   	ret
+
+00000000008027b1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027b1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027b4:	0f b6 17             	movzbl (%rdi),%edx
+  8027b7:	84 d2                	test   %dl,%dl
+  8027b9:	74 13                	je     8027ce <strfind+0x1d>
+  8027bb:	0f be d2             	movsbl %dl,%edx
+  8027be:	39 f2                	cmp    %esi,%edx
+  8027c0:	74 0b                	je     8027cd <strfind+0x1c>
+  8027c2:	48 83 c0 01          	add    $0x1,%rax
+  8027c6:	0f b6 10             	movzbl (%rax),%edx
+  8027c9:	84 d2                	test   %dl,%dl
+  8027cb:	75 ee                	jne    8027bb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027cd:	c3                   	ret
+  8027ce:	c3                   	ret
+
+00000000008027cf <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8027cf:	48 39 f7             	cmp    %rsi,%rdi
+  8027d2:	74 65                	je     802839 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8027d4:	55                   	push   %rbp
+  8027d5:	48 89 e5             	mov    %rsp,%rbp
+  8027d8:	41 57                	push   %r15
+  8027da:	41 56                	push   %r14
+  8027dc:	41 55                	push   %r13
+  8027de:	41 54                	push   %r12
+  8027e0:	53                   	push   %rbx
+  8027e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8027e5:	48 89 fb             	mov    %rdi,%rbx
+  8027e8:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8027eb:	49 bf c0 26 80 00 00 	movabs $0x8026c0,%r15
+  8027f2:	00 00 00 
+  8027f5:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8027f9:	41 0f b6 fd          	movzbl %r13b,%edi
+  8027fd:	41 ff d7             	call   *%r15
+  802800:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802803:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802808:	41 0f b6 fe          	movzbl %r14b,%edi
+  80280c:	41 ff d7             	call   *%r15
+  80280f:	89 c2                	mov    %eax,%edx
+  802811:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802814:	29 d0                	sub    %edx,%eax
+  802816:	75 12                	jne    80282a <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802818:	48 83 c3 01          	add    $0x1,%rbx
+  80281c:	45 84 ed             	test   %r13b,%r13b
+  80281f:	74 09                	je     80282a <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802821:	49 83 c4 01          	add    $0x1,%r12
+  802825:	45 84 f6             	test   %r14b,%r14b
+  802828:	75 cb                	jne    8027f5 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80282a:	48 83 c4 18          	add    $0x18,%rsp
+  80282e:	5b                   	pop    %rbx
+  80282f:	41 5c                	pop    %r12
+  802831:	41 5d                	pop    %r13
+  802833:	41 5e                	pop    %r14
+  802835:	41 5f                	pop    %r15
+  802837:	5d                   	pop    %rbp
+  802838:	c3                   	ret
+    if (p1 == p2) return 0;
+  802839:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80283e:	c3                   	ret
+
+000000000080283f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80283f:	48 39 f7             	cmp    %rsi,%rdi
+  802842:	74 7d                	je     8028c1 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802844:	55                   	push   %rbp
+  802845:	48 89 e5             	mov    %rsp,%rbp
+  802848:	41 57                	push   %r15
+  80284a:	41 56                	push   %r14
+  80284c:	41 55                	push   %r13
+  80284e:	41 54                	push   %r12
+  802850:	53                   	push   %rbx
+  802851:	48 83 ec 18          	sub    $0x18,%rsp
+  802855:	48 89 fb             	mov    %rdi,%rbx
+  802858:	49 89 f4             	mov    %rsi,%r12
+  80285b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80285f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802863:	49 bf c0 26 80 00 00 	movabs $0x8026c0,%r15
+  80286a:	00 00 00 
+    while (n--) {
+  80286d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802871:	48 39 c3             	cmp    %rax,%rbx
+  802874:	74 37                	je     8028ad <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802876:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80287a:	41 0f b6 fd          	movzbl %r13b,%edi
+  80287e:	41 ff d7             	call   *%r15
+  802881:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802884:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802889:	41 0f b6 fe          	movzbl %r14b,%edi
+  80288d:	41 ff d7             	call   *%r15
+  802890:	89 c2                	mov    %eax,%edx
+  802892:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802895:	29 d0                	sub    %edx,%eax
+  802897:	75 19                	jne    8028b2 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802899:	48 83 c3 01          	add    $0x1,%rbx
+  80289d:	45 84 ed             	test   %r13b,%r13b
+  8028a0:	74 10                	je     8028b2 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8028a2:	49 83 c4 01          	add    $0x1,%r12
+  8028a6:	45 84 f6             	test   %r14b,%r14b
+  8028a9:	75 c2                	jne    80286d <strncasecmp+0x2e>
+  8028ab:	eb 05                	jmp    8028b2 <strncasecmp+0x73>
+  8028ad:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8028b2:	48 83 c4 18          	add    $0x18,%rsp
+  8028b6:	5b                   	pop    %rbx
+  8028b7:	41 5c                	pop    %r12
+  8028b9:	41 5d                	pop    %r13
+  8028bb:	41 5e                	pop    %r14
+  8028bd:	41 5f                	pop    %r15
+  8028bf:	5d                   	pop    %rbp
+  8028c0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8028c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028c6:	c3                   	ret
+
+00000000008028c7 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8028c7:	83 e7 df             	and    $0xffffffdf,%edi
+  8028ca:	83 ef 41             	sub    $0x41,%edi
+  8028cd:	83 ff 19             	cmp    $0x19,%edi
+  8028d0:	0f 96 c0             	setbe  %al
+}
+  8028d3:	c3                   	ret
+
+00000000008028d4 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8028d4:	83 ff 20             	cmp    $0x20,%edi
+  8028d7:	0f 94 c0             	sete   %al
+  8028da:	83 ff 09             	cmp    $0x9,%edi
+  8028dd:	0f 94 c2             	sete   %dl
+  8028e0:	09 d0                	or     %edx,%eax
+}
+  8028e2:	c3                   	ret
+
+00000000008028e3 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8028e3:	55                   	push   %rbp
+  8028e4:	48 89 e5             	mov    %rsp,%rbp
+  8028e7:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8028e9:	48 bf df 6a 80 00 00 	movabs $0x806adf,%rdi
+  8028f0:	00 00 00 
+  8028f3:	48 b8 88 27 80 00 00 	movabs $0x802788,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+  8028ff:	48 85 c0             	test   %rax,%rax
+  802902:	0f 95 c0             	setne  %al
+}
+  802905:	5d                   	pop    %rbp
+  802906:	c3                   	ret
+
+0000000000802907 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802907:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80290a:	48 89 f8             	mov    %rdi,%rax
+  80290d:	48 f7 d8             	neg    %rax
+  802910:	83 e0 07             	and    $0x7,%eax
+  802913:	49 89 d1             	mov    %rdx,%r9
+  802916:	49 29 c1             	sub    %rax,%r9
+  802919:	78 36                	js     802951 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80291b:	40 0f b6 c6          	movzbl %sil,%eax
+  80291f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802926:	01 01 01 
+  802929:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80292d:	40 f6 c7 07          	test   $0x7,%dil
+  802931:	75 38                	jne    80296b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802933:	4c 89 c9             	mov    %r9,%rcx
+  802936:	48 c1 f9 03          	sar    $0x3,%rcx
+  80293a:	74 0c                	je     802948 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80293c:	fc                   	cld
+  80293d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802940:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802944:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802948:	4d 85 c9             	test   %r9,%r9
+  80294b:	75 45                	jne    802992 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80294d:	4c 89 c0             	mov    %r8,%rax
+  802950:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802951:	48 85 d2             	test   %rdx,%rdx
+  802954:	74 f7                	je     80294d <memset+0x46>
+  802956:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802959:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80295c:	48 83 c0 01          	add    $0x1,%rax
+  802960:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802964:	48 39 c2             	cmp    %rax,%rdx
+  802967:	75 f3                	jne    80295c <memset+0x55>
+  802969:	eb e2                	jmp    80294d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80296b:	40 f6 c7 01          	test   $0x1,%dil
+  80296f:	74 06                	je     802977 <memset+0x70>
+  802971:	88 07                	mov    %al,(%rdi)
+  802973:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802977:	40 f6 c7 02          	test   $0x2,%dil
+  80297b:	74 07                	je     802984 <memset+0x7d>
+  80297d:	66 89 07             	mov    %ax,(%rdi)
+  802980:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802984:	40 f6 c7 04          	test   $0x4,%dil
+  802988:	74 a9                	je     802933 <memset+0x2c>
+  80298a:	89 07                	mov    %eax,(%rdi)
+  80298c:	48 83 c7 04          	add    $0x4,%rdi
+  802990:	eb a1                	jmp    802933 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802992:	41 f6 c1 04          	test   $0x4,%r9b
+  802996:	74 06                	je     80299e <memset+0x97>
+  802998:	89 07                	mov    %eax,(%rdi)
+  80299a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80299e:	41 f6 c1 02          	test   $0x2,%r9b
+  8029a2:	74 07                	je     8029ab <memset+0xa4>
+  8029a4:	66 89 07             	mov    %ax,(%rdi)
+  8029a7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8029ab:	41 f6 c1 01          	test   $0x1,%r9b
+  8029af:	74 9c                	je     80294d <memset+0x46>
+  8029b1:	88 07                	mov    %al,(%rdi)
+  8029b3:	eb 98                	jmp    80294d <memset+0x46>
+
+00000000008029b5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8029b5:	48 89 f8             	mov    %rdi,%rax
+  8029b8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8029bb:	48 39 fe             	cmp    %rdi,%rsi
+  8029be:	73 3b                	jae    8029fb <memmove+0x46>
+  8029c0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8029c4:	48 39 d7             	cmp    %rdx,%rdi
+  8029c7:	73 32                	jae    8029fb <memmove+0x46>
+        s += n;
+        d += n;
+  8029c9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8029cd:	48 89 d6             	mov    %rdx,%rsi
+  8029d0:	48 09 fe             	or     %rdi,%rsi
+  8029d3:	48 09 ce             	or     %rcx,%rsi
+  8029d6:	40 f6 c6 07          	test   $0x7,%sil
+  8029da:	75 12                	jne    8029ee <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8029dc:	48 83 ef 08          	sub    $0x8,%rdi
+  8029e0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8029e4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8029e8:	fd                   	std
+  8029e9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8029ec:	fc                   	cld
+  8029ed:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8029ee:	48 83 ef 01          	sub    $0x1,%rdi
+  8029f2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8029f6:	fd                   	std
+  8029f7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8029f9:	eb f1                	jmp    8029ec <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8029fb:	48 89 f2             	mov    %rsi,%rdx
+  8029fe:	48 09 c2             	or     %rax,%rdx
+  802a01:	48 09 ca             	or     %rcx,%rdx
+  802a04:	f6 c2 07             	test   $0x7,%dl
+  802a07:	75 0c                	jne    802a15 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802a09:	48 c1 e9 03          	shr    $0x3,%rcx
+  802a0d:	48 89 c7             	mov    %rax,%rdi
+  802a10:	fc                   	cld
+  802a11:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802a14:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802a15:	48 89 c7             	mov    %rax,%rdi
+  802a18:	fc                   	cld
+  802a19:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802a1b:	c3                   	ret
+
+0000000000802a1c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802a20:	48 b8 b5 29 80 00 00 	movabs $0x8029b5,%rax
+  802a27:	00 00 00 
+  802a2a:	ff d0                	call   *%rax
+}
+  802a2c:	5d                   	pop    %rbp
+  802a2d:	c3                   	ret
+
+0000000000802a2e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802a2e:	55                   	push   %rbp
+  802a2f:	48 89 e5             	mov    %rsp,%rbp
+  802a32:	41 57                	push   %r15
+  802a34:	41 56                	push   %r14
+  802a36:	41 55                	push   %r13
+  802a38:	41 54                	push   %r12
+  802a3a:	53                   	push   %rbx
+  802a3b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3f:	49 89 fe             	mov    %rdi,%r14
+  802a42:	49 89 f7             	mov    %rsi,%r15
+  802a45:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802a48:	48 89 f7             	mov    %rsi,%rdi
+  802a4b:	48 b8 27 26 80 00 00 	movabs $0x802627,%rax
+  802a52:	00 00 00 
+  802a55:	ff d0                	call   *%rax
+  802a57:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802a5a:	48 89 de             	mov    %rbx,%rsi
+  802a5d:	4c 89 f7             	mov    %r14,%rdi
+  802a60:	48 b8 42 26 80 00 00 	movabs $0x802642,%rax
+  802a67:	00 00 00 
+  802a6a:	ff d0                	call   *%rax
+  802a6c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802a6f:	48 39 c3             	cmp    %rax,%rbx
+  802a72:	74 36                	je     802aaa <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802a74:	48 89 d8             	mov    %rbx,%rax
+  802a77:	4c 29 e8             	sub    %r13,%rax
+  802a7a:	49 39 c4             	cmp    %rax,%r12
+  802a7d:	73 31                	jae    802ab0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802a7f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802a84:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802a88:	4c 89 fe             	mov    %r15,%rsi
+  802a8b:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  802a92:	00 00 00 
+  802a95:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802a97:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802a9b:	48 83 c4 08          	add    $0x8,%rsp
+  802a9f:	5b                   	pop    %rbx
+  802aa0:	41 5c                	pop    %r12
+  802aa2:	41 5d                	pop    %r13
+  802aa4:	41 5e                	pop    %r14
+  802aa6:	41 5f                	pop    %r15
+  802aa8:	5d                   	pop    %rbp
+  802aa9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802aaa:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802aae:	eb eb                	jmp    802a9b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802ab0:	48 83 eb 01          	sub    $0x1,%rbx
+  802ab4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802ab8:	48 89 da             	mov    %rbx,%rdx
+  802abb:	4c 89 fe             	mov    %r15,%rsi
+  802abe:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802aca:	49 01 de             	add    %rbx,%r14
+  802acd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802ad2:	eb c3                	jmp    802a97 <strlcat+0x69>
+
+0000000000802ad4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802ad4:	48 85 d2             	test   %rdx,%rdx
+  802ad7:	74 2d                	je     802b06 <memcmp+0x32>
+  802ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802ade:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802ae2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802ae7:	44 38 c1             	cmp    %r8b,%cl
+  802aea:	75 0f                	jne    802afb <memcmp+0x27>
+    while (n-- > 0) {
+  802aec:	48 83 c0 01          	add    $0x1,%rax
+  802af0:	48 39 c2             	cmp    %rax,%rdx
+  802af3:	75 e9                	jne    802ade <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afa:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802afb:	0f b6 c1             	movzbl %cl,%eax
+  802afe:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802b02:	44 29 c0             	sub    %r8d,%eax
+  802b05:	c3                   	ret
+    return 0;
+  802b06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b0b:	c3                   	ret
+
+0000000000802b0c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802b0c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802b10:	48 39 c7             	cmp    %rax,%rdi
+  802b13:	73 0f                	jae    802b24 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802b15:	40 38 37             	cmp    %sil,(%rdi)
+  802b18:	74 0e                	je     802b28 <memfind+0x1c>
+    for (; src < end; src++) {
+  802b1a:	48 83 c7 01          	add    $0x1,%rdi
+  802b1e:	48 39 f8             	cmp    %rdi,%rax
+  802b21:	75 f2                	jne    802b15 <memfind+0x9>
+  802b23:	c3                   	ret
+  802b24:	48 89 f8             	mov    %rdi,%rax
+  802b27:	c3                   	ret
+  802b28:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802b2b:	c3                   	ret
+
+0000000000802b2c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802b2c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802b2f:	0f b6 37             	movzbl (%rdi),%esi
+  802b32:	40 80 fe 20          	cmp    $0x20,%sil
+  802b36:	74 06                	je     802b3e <strtol+0x12>
+  802b38:	40 80 fe 09          	cmp    $0x9,%sil
+  802b3c:	75 13                	jne    802b51 <strtol+0x25>
+  802b3e:	48 83 c7 01          	add    $0x1,%rdi
+  802b42:	0f b6 37             	movzbl (%rdi),%esi
+  802b45:	40 80 fe 20          	cmp    $0x20,%sil
+  802b49:	74 f3                	je     802b3e <strtol+0x12>
+  802b4b:	40 80 fe 09          	cmp    $0x9,%sil
+  802b4f:	74 ed                	je     802b3e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802b51:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802b54:	83 e0 fd             	and    $0xfffffffd,%eax
+  802b57:	3c 01                	cmp    $0x1,%al
+  802b59:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802b5d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802b63:	75 0f                	jne    802b74 <strtol+0x48>
+  802b65:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802b68:	74 14                	je     802b7e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802b6a:	85 d2                	test   %edx,%edx
+  802b6c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b71:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802b74:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802b79:	4c 63 ca             	movslq %edx,%r9
+  802b7c:	eb 36                	jmp    802bb4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802b7e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802b82:	74 0f                	je     802b93 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802b84:	85 d2                	test   %edx,%edx
+  802b86:	75 ec                	jne    802b74 <strtol+0x48>
+        s++;
+  802b88:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802b8c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802b91:	eb e1                	jmp    802b74 <strtol+0x48>
+        s += 2;
+  802b93:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802b97:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802b9c:	eb d6                	jmp    802b74 <strtol+0x48>
+            dig -= '0';
+  802b9e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802ba1:	44 0f b6 c1          	movzbl %cl,%r8d
+  802ba5:	41 39 d0             	cmp    %edx,%r8d
+  802ba8:	7d 21                	jge    802bcb <strtol+0x9f>
+        val = val * base + dig;
+  802baa:	49 0f af c1          	imul   %r9,%rax
+  802bae:	0f b6 c9             	movzbl %cl,%ecx
+  802bb1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802bb4:	48 83 c7 01          	add    $0x1,%rdi
+  802bb8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802bbc:	80 f9 39             	cmp    $0x39,%cl
+  802bbf:	76 dd                	jbe    802b9e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802bc1:	80 f9 7b             	cmp    $0x7b,%cl
+  802bc4:	77 05                	ja     802bcb <strtol+0x9f>
+            dig -= 'a' - 10;
+  802bc6:	83 e9 57             	sub    $0x57,%ecx
+  802bc9:	eb d6                	jmp    802ba1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802bcb:	4d 85 d2             	test   %r10,%r10
+  802bce:	74 03                	je     802bd3 <strtol+0xa7>
+  802bd0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802bd3:	48 89 c2             	mov    %rax,%rdx
+  802bd6:	48 f7 da             	neg    %rdx
+  802bd9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802bdd:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802be1:	c3                   	ret
+
+0000000000802be2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802be2:	55                   	push   %rbp
+  802be3:	48 89 e5             	mov    %rsp,%rbp
+  802be6:	53                   	push   %rbx
+  802be7:	48 89 fa             	mov    %rdi,%rdx
+  802bea:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802bed:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bf2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bf7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bfc:	be 00 00 00 00       	mov    $0x0,%esi
+  802c01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c0d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802c0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c13:	c9                   	leave
+  802c14:	c3                   	ret
+
+0000000000802c15 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802c15:	55                   	push   %rbp
+  802c16:	48 89 e5             	mov    %rsp,%rbp
+  802c19:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c24:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c33:	be 00 00 00 00       	mov    $0x0,%esi
+  802c38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c44:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802c46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c4a:	c9                   	leave
+  802c4b:	c3                   	ret
+
+0000000000802c4c <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802c4c:	55                   	push   %rbp
+  802c4d:	48 89 e5             	mov    %rsp,%rbp
+  802c50:	53                   	push   %rbx
+  802c51:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c54:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c59:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c63:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c68:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c73:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c79:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802c7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c7f:	c9                   	leave
+  802c80:	c3                   	ret
+
+0000000000802c81 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802c81:	55                   	push   %rbp
+  802c82:	48 89 e5             	mov    %rsp,%rbp
+  802c85:	53                   	push   %rbx
+  802c86:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802c8a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c8d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c92:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ca1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cb2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cb4:	48 85 c0             	test   %rax,%rax
+  802cb7:	7f 06                	jg     802cbf <sys_env_destroy+0x3e>
+}
+  802cb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cbd:	c9                   	leave
+  802cbe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cbf:	49 89 c0             	mov    %rax,%r8
+  802cc2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802cc7:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802cce:	00 00 00 
+  802cd1:	be 27 00 00 00       	mov    $0x27,%esi
+  802cd6:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802cdd:	00 00 00 
+  802ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce5:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  802cec:	00 00 00 
+  802cef:	41 ff d1             	call   *%r9
+
+0000000000802cf2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802cf2:	55                   	push   %rbp
+  802cf3:	48 89 e5             	mov    %rsp,%rbp
+  802cf6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cf7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d01:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d10:	be 00 00 00 00       	mov    $0x0,%esi
+  802d15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d21:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+0000000000802d29 <sys_yield>:
+
+void
+sys_yield(void) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d2e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d33:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d38:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d47:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d58:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d5e:	c9                   	leave
+  802d5f:	c3                   	ret
+
+0000000000802d60 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802d60:	55                   	push   %rbp
+  802d61:	48 89 e5             	mov    %rsp,%rbp
+  802d64:	53                   	push   %rbx
+  802d65:	48 89 fa             	mov    %rdi,%rdx
+  802d68:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d70:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802d77:	00 00 00 
+  802d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d7f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d90:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802d92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+
+0000000000802d98 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802d98:	55                   	push   %rbp
+  802d99:	48 89 e5             	mov    %rsp,%rbp
+  802d9c:	53                   	push   %rbx
+  802d9d:	49 89 f8             	mov    %rdi,%r8
+  802da0:	48 89 d3             	mov    %rdx,%rbx
+  802da3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802da6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dab:	4c 89 c2             	mov    %r8,%rdx
+  802dae:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802db1:	be 00 00 00 00       	mov    $0x0,%esi
+  802db6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dbc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dc2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802dc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc8:	c9                   	leave
+  802dc9:	c3                   	ret
+
+0000000000802dca <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+  802dce:	53                   	push   %rbx
+  802dcf:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd3:	89 f8                	mov    %edi,%eax
+  802dd5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802dd8:	48 63 f9             	movslq %ecx,%rdi
+  802ddb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dde:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802de3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802de6:	be 00 00 00 00       	mov    $0x0,%esi
+  802deb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802df1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802df7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802df9:	48 85 c0             	test   %rax,%rax
+  802dfc:	7f 06                	jg     802e04 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802dfe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e02:	c9                   	leave
+  802e03:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e04:	49 89 c0             	mov    %rax,%r8
+  802e07:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802e0c:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802e13:	00 00 00 
+  802e16:	be 27 00 00 00       	mov    $0x27,%esi
+  802e1b:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802e22:	00 00 00 
+  802e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e2a:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  802e31:	00 00 00 
+  802e34:	41 ff d1             	call   *%r9
+
+0000000000802e37 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802e37:	55                   	push   %rbp
+  802e38:	48 89 e5             	mov    %rsp,%rbp
+  802e3b:	53                   	push   %rbx
+  802e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  802e40:	89 f8                	mov    %edi,%eax
+  802e42:	49 89 f2             	mov    %rsi,%r10
+  802e45:	48 89 cf             	mov    %rcx,%rdi
+  802e48:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802e4b:	48 63 da             	movslq %edx,%rbx
+  802e4e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e51:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e56:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e59:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802e5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e62:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e64:	48 85 c0             	test   %rax,%rax
+  802e67:	7f 06                	jg     802e6f <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802e69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e6d:	c9                   	leave
+  802e6e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e6f:	49 89 c0             	mov    %rax,%r8
+  802e72:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802e77:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802e7e:	00 00 00 
+  802e81:	be 27 00 00 00       	mov    $0x27,%esi
+  802e86:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802e8d:	00 00 00 
+  802e90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e95:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  802e9c:	00 00 00 
+  802e9f:	41 ff d1             	call   *%r9
+
+0000000000802ea2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802ea2:	55                   	push   %rbp
+  802ea3:	48 89 e5             	mov    %rsp,%rbp
+  802ea6:	53                   	push   %rbx
+  802ea7:	48 83 ec 08          	sub    $0x8,%rsp
+  802eab:	48 89 f1             	mov    %rsi,%rcx
+  802eae:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802eb1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802eb4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802eb9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ebe:	be 00 00 00 00       	mov    $0x0,%esi
+  802ec3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ec9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ecf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ed1:	48 85 c0             	test   %rax,%rax
+  802ed4:	7f 06                	jg     802edc <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802ed6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eda:	c9                   	leave
+  802edb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802edc:	49 89 c0             	mov    %rax,%r8
+  802edf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ee4:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802eeb:	00 00 00 
+  802eee:	be 27 00 00 00       	mov    $0x27,%esi
+  802ef3:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802efa:	00 00 00 
+  802efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f02:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  802f09:	00 00 00 
+  802f0c:	41 ff d1             	call   *%r9
+
+0000000000802f0f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802f0f:	55                   	push   %rbp
+  802f10:	48 89 e5             	mov    %rsp,%rbp
+  802f13:	53                   	push   %rbx
+  802f14:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802f18:	48 63 ce             	movslq %esi,%rcx
+  802f1b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f1e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f28:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f38:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f3e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f40:	48 85 c0             	test   %rax,%rax
+  802f43:	7f 06                	jg     802f4b <sys_env_set_status+0x3c>
+}
+  802f45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f49:	c9                   	leave
+  802f4a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f4b:	49 89 c0             	mov    %rax,%r8
+  802f4e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802f53:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802f5a:	00 00 00 
+  802f5d:	be 27 00 00 00       	mov    $0x27,%esi
+  802f62:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802f69:	00 00 00 
+  802f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f71:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  802f78:	00 00 00 
+  802f7b:	41 ff d1             	call   *%r9
+
+0000000000802f7e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802f7e:	55                   	push   %rbp
+  802f7f:	48 89 e5             	mov    %rsp,%rbp
+  802f82:	53                   	push   %rbx
+  802f83:	48 83 ec 08          	sub    $0x8,%rsp
+  802f87:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802f8a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f8d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f97:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f9c:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fa7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802faf:	48 85 c0             	test   %rax,%rax
+  802fb2:	7f 06                	jg     802fba <sys_env_set_trapframe+0x3c>
+}
+  802fb4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fb8:	c9                   	leave
+  802fb9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802fba:	49 89 c0             	mov    %rax,%r8
+  802fbd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802fc2:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802fc9:	00 00 00 
+  802fcc:	be 27 00 00 00       	mov    $0x27,%esi
+  802fd1:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802fd8:	00 00 00 
+  802fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe0:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  802fe7:	00 00 00 
+  802fea:	41 ff d1             	call   *%r9
+
+0000000000802fed <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802fed:	55                   	push   %rbp
+  802fee:	48 89 e5             	mov    %rsp,%rbp
+  802ff1:	53                   	push   %rbx
+  802ff2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ff6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802ff9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ffc:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803006:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80300b:	be 00 00 00 00       	mov    $0x0,%esi
+  803010:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803016:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80301c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80301e:	48 85 c0             	test   %rax,%rax
+  803021:	7f 06                	jg     803029 <sys_env_set_pgfault_upcall+0x3c>
+}
+  803023:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803027:	c9                   	leave
+  803028:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803029:	49 89 c0             	mov    %rax,%r8
+  80302c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  803031:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  803038:	00 00 00 
+  80303b:	be 27 00 00 00       	mov    $0x27,%esi
+  803040:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  803047:	00 00 00 
+  80304a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304f:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  803056:	00 00 00 
+  803059:	41 ff d1             	call   *%r9
+
+000000000080305c <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  80305c:	55                   	push   %rbp
+  80305d:	48 89 e5             	mov    %rsp,%rbp
+  803060:	53                   	push   %rbx
+  803061:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  803065:	40 0f b6 ce          	movzbl %sil,%ecx
+  803069:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80306c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803071:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803076:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80307b:	be 00 00 00 00       	mov    $0x0,%esi
+  803080:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803086:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80308c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80308e:	48 85 c0             	test   %rax,%rax
+  803091:	7f 06                	jg     803099 <sys_env_set_reclaim+0x3d>
+}
+  803093:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803097:	c9                   	leave
+  803098:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803099:	49 89 c0             	mov    %rax,%r8
+  80309c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8030a1:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  8030a8:	00 00 00 
+  8030ab:	be 27 00 00 00       	mov    $0x27,%esi
+  8030b0:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  8030b7:	00 00 00 
+  8030ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bf:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  8030c6:	00 00 00 
+  8030c9:	41 ff d1             	call   *%r9
+
+00000000008030cc <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  8030cc:	55                   	push   %rbp
+  8030cd:	48 89 e5             	mov    %rsp,%rbp
+  8030d0:	53                   	push   %rbx
+  8030d1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  8030d5:	48 63 ce             	movslq %esi,%rcx
+  8030d8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030db:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8030fd:	48 85 c0             	test   %rax,%rax
+  803100:	7f 06                	jg     803108 <sys_env_set_nice+0x3c>
+}
+  803102:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803106:	c9                   	leave
+  803107:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803108:	49 89 c0             	mov    %rax,%r8
+  80310b:	b9 18 00 00 00       	mov    $0x18,%ecx
+  803110:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  803117:	00 00 00 
+  80311a:	be 27 00 00 00       	mov    $0x27,%esi
+  80311f:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  803126:	00 00 00 
+  803129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312e:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  803135:	00 00 00 
+  803138:	41 ff d1             	call   *%r9
+
+000000000080313b <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  80313b:	55                   	push   %rbp
+  80313c:	48 89 e5             	mov    %rsp,%rbp
+  80313f:	53                   	push   %rbx
+  803140:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803143:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803148:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80314d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803152:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803157:	be 00 00 00 00       	mov    $0x0,%esi
+  80315c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803162:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803168:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  80316a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80316e:	c9                   	leave
+  80316f:	c3                   	ret
+
+0000000000803170 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803170:	55                   	push   %rbp
+  803171:	48 89 e5             	mov    %rsp,%rbp
+  803174:	53                   	push   %rbx
+  803175:	89 f8                	mov    %edi,%eax
+  803177:	49 89 f1             	mov    %rsi,%r9
+  80317a:	48 89 d3             	mov    %rdx,%rbx
+  80317d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803180:	49 63 f0             	movslq %r8d,%rsi
+  803183:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803186:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80318b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80318e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803194:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80319a:	cd 30                	int    $0x30
+}
+  80319c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031a0:	c9                   	leave
+  8031a1:	c3                   	ret
+
+00000000008031a2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8031a2:	55                   	push   %rbp
+  8031a3:	48 89 e5             	mov    %rsp,%rbp
+  8031a6:	53                   	push   %rbx
+  8031a7:	89 f8                	mov    %edi,%eax
+  8031a9:	49 89 f1             	mov    %rsi,%r9
+  8031ac:	48 89 d3             	mov    %rdx,%rbx
+  8031af:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8031b2:	49 63 f0             	movslq %r8d,%rsi
+  8031b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8031b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8031bd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8031c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8031c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8031cc:	cd 30                	int    $0x30
+}
+  8031ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031d2:	c9                   	leave
+  8031d3:	c3                   	ret
+
+00000000008031d4 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  8031d4:	55                   	push   %rbp
+  8031d5:	48 89 e5             	mov    %rsp,%rbp
+  8031d8:	53                   	push   %rbx
+  8031d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8031dd:	89 f8                	mov    %edi,%eax
+  8031df:	49 89 f2             	mov    %rsi,%r10
+  8031e2:	48 89 d3             	mov    %rdx,%rbx
+  8031e5:	48 89 cf             	mov    %rcx,%rdi
+  8031e8:	44 89 c6             	mov    %r8d,%esi
+  8031eb:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  8031ee:	48 63 f6             	movslq %esi,%rsi
+  8031f1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8031f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8031f9:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  8031fc:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803200:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803202:	48 85 c0             	test   %rax,%rax
+  803205:	7f 06                	jg     80320d <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803207:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80320b:	c9                   	leave
+  80320c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80320d:	49 89 c0             	mov    %rax,%r8
+  803210:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  803215:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  80321c:	00 00 00 
+  80321f:	be 27 00 00 00       	mov    $0x27,%esi
+  803224:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  80322b:	00 00 00 
+  80322e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803233:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  80323a:	00 00 00 
+  80323d:	41 ff d1             	call   *%r9
+
+0000000000803240 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  803240:	55                   	push   %rbp
+  803241:	48 89 e5             	mov    %rsp,%rbp
+  803244:	53                   	push   %rbx
+  803245:	48 83 ec 08          	sub    $0x8,%rsp
+  803249:	48 89 f1             	mov    %rsi,%rcx
+  80324c:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  80324f:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  803253:	48 8b 1a             	mov    (%rdx),%rbx
+  803256:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803259:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80325e:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803262:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  803266:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  80326a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80326c:	48 85 c0             	test   %rax,%rax
+  80326f:	7f 06                	jg     803277 <sys_ipc_call_short+0x37>
+}
+  803271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803275:	c9                   	leave
+  803276:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803277:	49 89 c0             	mov    %rax,%r8
+  80327a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80327f:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  803286:	00 00 00 
+  803289:	be 27 00 00 00       	mov    $0x27,%esi
+  80328e:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  803295:	00 00 00 
+  803298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80329d:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  8032a4:	00 00 00 
+  8032a7:	41 ff d1             	call   *%r9
+
+00000000008032aa <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  8032aa:	55                   	push   %rbp
+  8032ab:	48 89 e5             	mov    %rsp,%rbp
+  8032ae:	53                   	push   %rbx
+  8032af:	48 83 ec 08          	sub    $0x8,%rsp
+  8032b3:	89 f8                	mov    %edi,%eax
+  8032b5:	49 89 f2             	mov    %rsi,%r10
+  8032b8:	48 89 d3             	mov    %rdx,%rbx
+  8032bb:	48 89 cf             	mov    %rcx,%rdi
+  8032be:	44 89 c6             	mov    %r8d,%esi
+  8032c1:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  8032c4:	48 63 f6             	movslq %esi,%rsi
+  8032c7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032ca:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032cf:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  8032d2:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  8032d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8032d8:	48 85 c0             	test   %rax,%rax
+  8032db:	7f 06                	jg     8032e3 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8032dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032e1:	c9                   	leave
+  8032e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8032e3:	49 89 c0             	mov    %rax,%r8
+  8032e6:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8032eb:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  8032f2:	00 00 00 
+  8032f5:	be 27 00 00 00       	mov    $0x27,%esi
+  8032fa:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  803301:	00 00 00 
+  803304:	b8 00 00 00 00       	mov    $0x0,%eax
+  803309:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  803310:	00 00 00 
+  803313:	41 ff d1             	call   *%r9
+
+0000000000803316 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803316:	55                   	push   %rbp
+  803317:	48 89 e5             	mov    %rsp,%rbp
+  80331a:	53                   	push   %rbx
+  80331b:	48 83 ec 08          	sub    $0x8,%rsp
+  80331f:	48 89 fa             	mov    %rdi,%rdx
+  803322:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803325:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80332a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80332f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803334:	be 00 00 00 00       	mov    $0x0,%esi
+  803339:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80333f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803345:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803347:	48 85 c0             	test   %rax,%rax
+  80334a:	7f 06                	jg     803352 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80334c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803350:	c9                   	leave
+  803351:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803352:	49 89 c0             	mov    %rax,%r8
+  803355:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80335a:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  803361:	00 00 00 
+  803364:	be 27 00 00 00       	mov    $0x27,%esi
+  803369:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  803370:	00 00 00 
+  803373:	b8 00 00 00 00       	mov    $0x0,%eax
+  803378:	49 b9 de 1b 80 00 00 	movabs $0x801bde,%r9
+  80337f:	00 00 00 
+  803382:	41 ff d1             	call   *%r9
+
+0000000000803385 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803385:	55                   	push   %rbp
+  803386:	48 89 e5             	mov    %rsp,%rbp
+  803389:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80338a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80338f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803394:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803399:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80339e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8033a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033b4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8033b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ba:	c9                   	leave
+  8033bb:	c3                   	ret
+
+00000000008033bc <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8033bc:	55                   	push   %rbp
+  8033bd:	48 89 e5             	mov    %rsp,%rbp
+  8033c0:	53                   	push   %rbx
+  8033c1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8033c4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8033c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8033ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8033dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033e9:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  8033eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ef:	c9                   	leave
+  8033f0:	c3                   	ret
+
+00000000008033f1 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  8033f1:	55                   	push   %rbp
+  8033f2:	48 89 e5             	mov    %rsp,%rbp
+  8033f5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8033f6:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8033fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803400:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803405:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80340a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80340f:	be 00 00 00 00       	mov    $0x0,%esi
+  803414:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80341a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803420:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803422:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803426:	c9                   	leave
+  803427:	c3                   	ret
+
+0000000000803428 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  803428:	55                   	push   %rbp
+  803429:	48 89 e5             	mov    %rsp,%rbp
+  80342c:	53                   	push   %rbx
+  80342d:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803431:	b8 08 00 00 00       	mov    $0x8,%eax
+  803436:	cd 30                	int    $0x30
+  803438:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  80343a:	85 c0                	test   %eax,%eax
+  80343c:	0f 88 85 00 00 00    	js     8034c7 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803442:	0f 84 ac 00 00 00    	je     8034f4 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  803448:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80344e:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  803455:	00 00 00 
+  803458:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80345d:	89 c2                	mov    %eax,%edx
+  80345f:	be 00 00 00 00       	mov    $0x0,%esi
+  803464:	bf 00 00 00 00       	mov    $0x0,%edi
+  803469:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  803470:	00 00 00 
+  803473:	ff d0                	call   *%rax
+  803475:	85 c0                	test   %eax,%eax
+  803477:	0f 88 a8 00 00 00    	js     803525 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  80347d:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803484:	00 00 00 
+  803487:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  80348e:	89 df                	mov    %ebx,%edi
+  803490:	48 b8 ed 2f 80 00 00 	movabs $0x802fed,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	0f 88 ae 00 00 00    	js     803552 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8034a4:	be 02 00 00 00       	mov    $0x2,%esi
+  8034a9:	89 df                	mov    %ebx,%edi
+  8034ab:	48 b8 0f 2f 80 00 00 	movabs $0x802f0f,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+  8034b7:	85 c0                	test   %eax,%eax
+  8034b9:	0f 88 c0 00 00 00    	js     80357f <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  8034bf:	89 d8                	mov    %ebx,%eax
+  8034c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034c5:	c9                   	leave
+  8034c6:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  8034c7:	89 c1                	mov    %eax,%ecx
+  8034c9:	48 ba 15 6b 80 00 00 	movabs $0x806b15,%rdx
+  8034d0:	00 00 00 
+  8034d3:	be 20 00 00 00       	mov    $0x20,%esi
+  8034d8:	48 bf 25 6b 80 00 00 	movabs $0x806b25,%rdi
+  8034df:	00 00 00 
+  8034e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e7:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  8034ee:	00 00 00 
+  8034f1:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8034f4:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  8034fb:	00 00 00 
+  8034fe:	ff d0                	call   *%rax
+  803500:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803505:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80350c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803513:	00 00 00 
+  803516:	48 01 d0             	add    %rdx,%rax
+  803519:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  803520:	00 00 00 
+        return 0;
+  803523:	eb 9a                	jmp    8034bf <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803525:	89 c1                	mov    %eax,%ecx
+  803527:	48 ba 30 6b 80 00 00 	movabs $0x806b30,%rdx
+  80352e:	00 00 00 
+  803531:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803536:	48 bf 25 6b 80 00 00 	movabs $0x806b25,%rdi
+  80353d:	00 00 00 
+  803540:	b8 00 00 00 00       	mov    $0x0,%eax
+  803545:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  80354c:	00 00 00 
+  80354f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803552:	89 c1                	mov    %eax,%ecx
+  803554:	48 ba 78 6b 80 00 00 	movabs $0x806b78,%rdx
+  80355b:	00 00 00 
+  80355e:	be 32 00 00 00       	mov    $0x32,%esi
+  803563:	48 bf 25 6b 80 00 00 	movabs $0x806b25,%rdi
+  80356a:	00 00 00 
+  80356d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803572:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  803579:	00 00 00 
+  80357c:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  80357f:	89 c1                	mov    %eax,%ecx
+  803581:	48 ba 43 6b 80 00 00 	movabs $0x806b43,%rdx
+  803588:	00 00 00 
+  80358b:	be 37 00 00 00       	mov    $0x37,%esi
+  803590:	48 bf 25 6b 80 00 00 	movabs $0x806b25,%rdi
+  803597:	00 00 00 
+  80359a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359f:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  8035a6:	00 00 00 
+  8035a9:	41 ff d0             	call   *%r8
+
+00000000008035ac <sfork>:
+
+envid_t
+sfork() {
+  8035ac:	55                   	push   %rbp
+  8035ad:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8035b0:	48 ba 5a 6b 80 00 00 	movabs $0x806b5a,%rdx
+  8035b7:	00 00 00 
+  8035ba:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8035bf:	48 bf 25 6b 80 00 00 	movabs $0x806b25,%rdi
+  8035c6:	00 00 00 
+  8035c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ce:	48 b9 de 1b 80 00 00 	movabs $0x801bde,%rcx
+  8035d5:	00 00 00 
+  8035d8:	ff d1                	call   *%rcx
+
+00000000008035da <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8035da:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8035e1:	ff ff ff 
+  8035e4:	48 01 f8             	add    %rdi,%rax
+  8035e7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8035eb:	c3                   	ret
+
+00000000008035ec <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8035ec:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8035f3:	ff ff ff 
+  8035f6:	48 01 f8             	add    %rdi,%rax
+  8035f9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8035fd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803603:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803607:	c3                   	ret
+
+0000000000803608 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803608:	55                   	push   %rbp
+  803609:	48 89 e5             	mov    %rsp,%rbp
+  80360c:	41 57                	push   %r15
+  80360e:	41 56                	push   %r14
+  803610:	41 55                	push   %r13
+  803612:	41 54                	push   %r12
+  803614:	53                   	push   %rbx
+  803615:	48 83 ec 08          	sub    $0x8,%rsp
+  803619:	49 89 ff             	mov    %rdi,%r15
+  80361c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803621:	49 bd c1 4b 80 00 00 	movabs $0x804bc1,%r13
+  803628:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80362b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803631:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803634:	48 89 df             	mov    %rbx,%rdi
+  803637:	41 ff d5             	call   *%r13
+  80363a:	83 e0 04             	and    $0x4,%eax
+  80363d:	74 17                	je     803656 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80363f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803646:	4c 39 f3             	cmp    %r14,%rbx
+  803649:	75 e6                	jne    803631 <fd_alloc+0x29>
+  80364b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803651:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803656:	4d 89 27             	mov    %r12,(%r15)
+}
+  803659:	48 83 c4 08          	add    $0x8,%rsp
+  80365d:	5b                   	pop    %rbx
+  80365e:	41 5c                	pop    %r12
+  803660:	41 5d                	pop    %r13
+  803662:	41 5e                	pop    %r14
+  803664:	41 5f                	pop    %r15
+  803666:	5d                   	pop    %rbp
+  803667:	c3                   	ret
+
+0000000000803668 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803668:	83 ff 1f             	cmp    $0x1f,%edi
+  80366b:	77 39                	ja     8036a6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80366d:	55                   	push   %rbp
+  80366e:	48 89 e5             	mov    %rsp,%rbp
+  803671:	41 54                	push   %r12
+  803673:	53                   	push   %rbx
+  803674:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803677:	48 63 df             	movslq %edi,%rbx
+  80367a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803681:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803685:	48 89 df             	mov    %rbx,%rdi
+  803688:	48 b8 c1 4b 80 00 00 	movabs $0x804bc1,%rax
+  80368f:	00 00 00 
+  803692:	ff d0                	call   *%rax
+  803694:	a8 04                	test   $0x4,%al
+  803696:	74 14                	je     8036ac <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803698:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80369c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036a1:	5b                   	pop    %rbx
+  8036a2:	41 5c                	pop    %r12
+  8036a4:	5d                   	pop    %rbp
+  8036a5:	c3                   	ret
+        return -E_INVAL;
+  8036a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8036ab:	c3                   	ret
+        return -E_INVAL;
+  8036ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036b1:	eb ee                	jmp    8036a1 <fd_lookup+0x39>
+
+00000000008036b3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8036b3:	55                   	push   %rbp
+  8036b4:	48 89 e5             	mov    %rsp,%rbp
+  8036b7:	41 54                	push   %r12
+  8036b9:	53                   	push   %rbx
+  8036ba:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8036bd:	48 b8 20 6c 80 00 00 	movabs $0x806c20,%rax
+  8036c4:	00 00 00 
+  8036c7:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8036ce:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8036d1:	39 3b                	cmp    %edi,(%rbx)
+  8036d3:	74 47                	je     80371c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8036d5:	48 83 c0 08          	add    $0x8,%rax
+  8036d9:	48 8b 18             	mov    (%rax),%rbx
+  8036dc:	48 85 db             	test   %rbx,%rbx
+  8036df:	75 f0                	jne    8036d1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8036e1:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8036e8:	00 00 00 
+  8036eb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8036f1:	89 fa                	mov    %edi,%edx
+  8036f3:	48 bf 98 6b 80 00 00 	movabs $0x806b98,%rdi
+  8036fa:	00 00 00 
+  8036fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803702:	48 b9 2e 1d 80 00 00 	movabs $0x801d2e,%rcx
+  803709:	00 00 00 
+  80370c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80370e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803713:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803717:	5b                   	pop    %rbx
+  803718:	41 5c                	pop    %r12
+  80371a:	5d                   	pop    %rbp
+  80371b:	c3                   	ret
+            return 0;
+  80371c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803721:	eb f0                	jmp    803713 <dev_lookup+0x60>
+
+0000000000803723 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803723:	55                   	push   %rbp
+  803724:	48 89 e5             	mov    %rsp,%rbp
+  803727:	41 55                	push   %r13
+  803729:	41 54                	push   %r12
+  80372b:	53                   	push   %rbx
+  80372c:	48 83 ec 18          	sub    $0x18,%rsp
+  803730:	48 89 fb             	mov    %rdi,%rbx
+  803733:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803736:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80373d:	ff ff ff 
+  803740:	48 01 df             	add    %rbx,%rdi
+  803743:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803747:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80374b:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+  803757:	41 89 c5             	mov    %eax,%r13d
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	78 06                	js     803764 <fd_close+0x41>
+  80375e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803762:	74 1a                	je     80377e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803764:	45 84 e4             	test   %r12b,%r12b
+  803767:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803770:	44 89 e8             	mov    %r13d,%eax
+  803773:	48 83 c4 18          	add    $0x18,%rsp
+  803777:	5b                   	pop    %rbx
+  803778:	41 5c                	pop    %r12
+  80377a:	41 5d                	pop    %r13
+  80377c:	5d                   	pop    %rbp
+  80377d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80377e:	8b 3b                	mov    (%rbx),%edi
+  803780:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803784:	48 b8 b3 36 80 00 00 	movabs $0x8036b3,%rax
+  80378b:	00 00 00 
+  80378e:	ff d0                	call   *%rax
+  803790:	41 89 c5             	mov    %eax,%r13d
+  803793:	85 c0                	test   %eax,%eax
+  803795:	78 1b                	js     8037b2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803797:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80379b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80379f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8037a5:	48 85 c0             	test   %rax,%rax
+  8037a8:	74 08                	je     8037b2 <fd_close+0x8f>
+  8037aa:	48 89 df             	mov    %rbx,%rdi
+  8037ad:	ff d0                	call   *%rax
+  8037af:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037b7:	48 89 de             	mov    %rbx,%rsi
+  8037ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037bf:	48 b8 a2 2e 80 00 00 	movabs $0x802ea2,%rax
+  8037c6:	00 00 00 
+  8037c9:	ff d0                	call   *%rax
+    return res;
+  8037cb:	eb a3                	jmp    803770 <fd_close+0x4d>
+
+00000000008037cd <close>:
+
+int
+close(int fdnum) {
+  8037cd:	55                   	push   %rbp
+  8037ce:	48 89 e5             	mov    %rsp,%rbp
+  8037d1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8037d5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037d9:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  8037e0:	00 00 00 
+  8037e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037e5:	85 c0                	test   %eax,%eax
+  8037e7:	78 15                	js     8037fe <close+0x31>
+
+    return fd_close(fd, 1);
+  8037e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8037ee:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037f2:	48 b8 23 37 80 00 00 	movabs $0x803723,%rax
+  8037f9:	00 00 00 
+  8037fc:	ff d0                	call   *%rax
+}
+  8037fe:	c9                   	leave
+  8037ff:	c3                   	ret
+
+0000000000803800 <close_all>:
+
+void
+close_all(void) {
+  803800:	55                   	push   %rbp
+  803801:	48 89 e5             	mov    %rsp,%rbp
+  803804:	41 54                	push   %r12
+  803806:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803807:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80380c:	49 bc cd 37 80 00 00 	movabs $0x8037cd,%r12
+  803813:	00 00 00 
+  803816:	89 df                	mov    %ebx,%edi
+  803818:	41 ff d4             	call   *%r12
+  80381b:	83 c3 01             	add    $0x1,%ebx
+  80381e:	83 fb 20             	cmp    $0x20,%ebx
+  803821:	75 f3                	jne    803816 <close_all+0x16>
+}
+  803823:	5b                   	pop    %rbx
+  803824:	41 5c                	pop    %r12
+  803826:	5d                   	pop    %rbp
+  803827:	c3                   	ret
+
+0000000000803828 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803828:	55                   	push   %rbp
+  803829:	48 89 e5             	mov    %rsp,%rbp
+  80382c:	41 57                	push   %r15
+  80382e:	41 56                	push   %r14
+  803830:	41 55                	push   %r13
+  803832:	41 54                	push   %r12
+  803834:	53                   	push   %rbx
+  803835:	48 83 ec 18          	sub    $0x18,%rsp
+  803839:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80383c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803840:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803847:	00 00 00 
+  80384a:	ff d0                	call   *%rax
+  80384c:	89 c3                	mov    %eax,%ebx
+  80384e:	85 c0                	test   %eax,%eax
+  803850:	0f 88 b8 00 00 00    	js     80390e <dup+0xe6>
+    close(newfdnum);
+  803856:	44 89 e7             	mov    %r12d,%edi
+  803859:	48 b8 cd 37 80 00 00 	movabs $0x8037cd,%rax
+  803860:	00 00 00 
+  803863:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803865:	4d 63 ec             	movslq %r12d,%r13
+  803868:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80386f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803873:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803877:	4c 89 ff             	mov    %r15,%rdi
+  80387a:	49 be ec 35 80 00 00 	movabs $0x8035ec,%r14
+  803881:	00 00 00 
+  803884:	41 ff d6             	call   *%r14
+  803887:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80388a:	4c 89 ef             	mov    %r13,%rdi
+  80388d:	41 ff d6             	call   *%r14
+  803890:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803893:	48 89 df             	mov    %rbx,%rdi
+  803896:	48 b8 c1 4b 80 00 00 	movabs $0x804bc1,%rax
+  80389d:	00 00 00 
+  8038a0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8038a2:	a8 04                	test   $0x4,%al
+  8038a4:	74 2b                	je     8038d1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8038a6:	41 89 c1             	mov    %eax,%r9d
+  8038a9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8038af:	4c 89 f1             	mov    %r14,%rcx
+  8038b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038b7:	48 89 de             	mov    %rbx,%rsi
+  8038ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038bf:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  8038c6:	00 00 00 
+  8038c9:	ff d0                	call   *%rax
+  8038cb:	89 c3                	mov    %eax,%ebx
+  8038cd:	85 c0                	test   %eax,%eax
+  8038cf:	78 4e                	js     80391f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8038d1:	4c 89 ff             	mov    %r15,%rdi
+  8038d4:	48 b8 c1 4b 80 00 00 	movabs $0x804bc1,%rax
+  8038db:	00 00 00 
+  8038de:	ff d0                	call   *%rax
+  8038e0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8038e3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8038e9:	4c 89 e9             	mov    %r13,%rcx
+  8038ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038f1:	4c 89 fe             	mov    %r15,%rsi
+  8038f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038f9:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  803900:	00 00 00 
+  803903:	ff d0                	call   *%rax
+  803905:	89 c3                	mov    %eax,%ebx
+  803907:	85 c0                	test   %eax,%eax
+  803909:	78 14                	js     80391f <dup+0xf7>
+
+    return newfdnum;
+  80390b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80390e:	89 d8                	mov    %ebx,%eax
+  803910:	48 83 c4 18          	add    $0x18,%rsp
+  803914:	5b                   	pop    %rbx
+  803915:	41 5c                	pop    %r12
+  803917:	41 5d                	pop    %r13
+  803919:	41 5e                	pop    %r14
+  80391b:	41 5f                	pop    %r15
+  80391d:	5d                   	pop    %rbp
+  80391e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80391f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803924:	4c 89 ee             	mov    %r13,%rsi
+  803927:	bf 00 00 00 00       	mov    $0x0,%edi
+  80392c:	49 bc a2 2e 80 00 00 	movabs $0x802ea2,%r12
+  803933:	00 00 00 
+  803936:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803939:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80393e:	4c 89 f6             	mov    %r14,%rsi
+  803941:	bf 00 00 00 00       	mov    $0x0,%edi
+  803946:	41 ff d4             	call   *%r12
+    return res;
+  803949:	eb c3                	jmp    80390e <dup+0xe6>
+
+000000000080394b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80394b:	55                   	push   %rbp
+  80394c:	48 89 e5             	mov    %rsp,%rbp
+  80394f:	41 56                	push   %r14
+  803951:	41 55                	push   %r13
+  803953:	41 54                	push   %r12
+  803955:	53                   	push   %rbx
+  803956:	48 83 ec 10          	sub    $0x10,%rsp
+  80395a:	89 fb                	mov    %edi,%ebx
+  80395c:	49 89 f4             	mov    %rsi,%r12
+  80395f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803962:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803966:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  80396d:	00 00 00 
+  803970:	ff d0                	call   *%rax
+  803972:	85 c0                	test   %eax,%eax
+  803974:	78 4c                	js     8039c2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803976:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80397a:	41 8b 3e             	mov    (%r14),%edi
+  80397d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803981:	48 b8 b3 36 80 00 00 	movabs $0x8036b3,%rax
+  803988:	00 00 00 
+  80398b:	ff d0                	call   *%rax
+  80398d:	85 c0                	test   %eax,%eax
+  80398f:	78 35                	js     8039c6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803991:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803995:	83 e0 03             	and    $0x3,%eax
+  803998:	83 f8 01             	cmp    $0x1,%eax
+  80399b:	74 2d                	je     8039ca <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80399d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039a1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8039a5:	48 85 c0             	test   %rax,%rax
+  8039a8:	74 56                	je     803a00 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8039aa:	4c 89 ea             	mov    %r13,%rdx
+  8039ad:	4c 89 e6             	mov    %r12,%rsi
+  8039b0:	4c 89 f7             	mov    %r14,%rdi
+  8039b3:	ff d0                	call   *%rax
+}
+  8039b5:	48 83 c4 10          	add    $0x10,%rsp
+  8039b9:	5b                   	pop    %rbx
+  8039ba:	41 5c                	pop    %r12
+  8039bc:	41 5d                	pop    %r13
+  8039be:	41 5e                	pop    %r14
+  8039c0:	5d                   	pop    %rbp
+  8039c1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039c2:	48 98                	cltq
+  8039c4:	eb ef                	jmp    8039b5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8039c6:	48 98                	cltq
+  8039c8:	eb eb                	jmp    8039b5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8039ca:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8039d1:	00 00 00 
+  8039d4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8039da:	89 da                	mov    %ebx,%edx
+  8039dc:	48 bf d9 6b 80 00 00 	movabs $0x806bd9,%rdi
+  8039e3:	00 00 00 
+  8039e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039eb:	48 b9 2e 1d 80 00 00 	movabs $0x801d2e,%rcx
+  8039f2:	00 00 00 
+  8039f5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8039f7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8039fe:	eb b5                	jmp    8039b5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803a00:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803a07:	eb ac                	jmp    8039b5 <read+0x6a>
+
+0000000000803a09 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803a09:	55                   	push   %rbp
+  803a0a:	48 89 e5             	mov    %rsp,%rbp
+  803a0d:	41 57                	push   %r15
+  803a0f:	41 56                	push   %r14
+  803a11:	41 55                	push   %r13
+  803a13:	41 54                	push   %r12
+  803a15:	53                   	push   %rbx
+  803a16:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803a1a:	48 85 d2             	test   %rdx,%rdx
+  803a1d:	74 54                	je     803a73 <readn+0x6a>
+  803a1f:	41 89 fd             	mov    %edi,%r13d
+  803a22:	49 89 f6             	mov    %rsi,%r14
+  803a25:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803a28:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803a2d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803a32:	49 bf 4b 39 80 00 00 	movabs $0x80394b,%r15
+  803a39:	00 00 00 
+  803a3c:	4c 89 e2             	mov    %r12,%rdx
+  803a3f:	48 29 f2             	sub    %rsi,%rdx
+  803a42:	4c 01 f6             	add    %r14,%rsi
+  803a45:	44 89 ef             	mov    %r13d,%edi
+  803a48:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803a4b:	85 c0                	test   %eax,%eax
+  803a4d:	78 20                	js     803a6f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803a4f:	01 c3                	add    %eax,%ebx
+  803a51:	85 c0                	test   %eax,%eax
+  803a53:	74 08                	je     803a5d <readn+0x54>
+  803a55:	48 63 f3             	movslq %ebx,%rsi
+  803a58:	4c 39 e6             	cmp    %r12,%rsi
+  803a5b:	72 df                	jb     803a3c <readn+0x33>
+    }
+    return res;
+  803a5d:	48 63 c3             	movslq %ebx,%rax
+}
+  803a60:	48 83 c4 08          	add    $0x8,%rsp
+  803a64:	5b                   	pop    %rbx
+  803a65:	41 5c                	pop    %r12
+  803a67:	41 5d                	pop    %r13
+  803a69:	41 5e                	pop    %r14
+  803a6b:	41 5f                	pop    %r15
+  803a6d:	5d                   	pop    %rbp
+  803a6e:	c3                   	ret
+        if (inc < 0) return inc;
+  803a6f:	48 98                	cltq
+  803a71:	eb ed                	jmp    803a60 <readn+0x57>
+    int inc = 1, res = 0;
+  803a73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a78:	eb e3                	jmp    803a5d <readn+0x54>
+
+0000000000803a7a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803a7a:	55                   	push   %rbp
+  803a7b:	48 89 e5             	mov    %rsp,%rbp
+  803a7e:	41 56                	push   %r14
+  803a80:	41 55                	push   %r13
+  803a82:	41 54                	push   %r12
+  803a84:	53                   	push   %rbx
+  803a85:	48 83 ec 10          	sub    $0x10,%rsp
+  803a89:	89 fb                	mov    %edi,%ebx
+  803a8b:	49 89 f4             	mov    %rsi,%r12
+  803a8e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a95:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803a9c:	00 00 00 
+  803a9f:	ff d0                	call   *%rax
+  803aa1:	85 c0                	test   %eax,%eax
+  803aa3:	78 47                	js     803aec <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803aa5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803aa9:	41 8b 3e             	mov    (%r14),%edi
+  803aac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803ab0:	48 b8 b3 36 80 00 00 	movabs $0x8036b3,%rax
+  803ab7:	00 00 00 
+  803aba:	ff d0                	call   *%rax
+  803abc:	85 c0                	test   %eax,%eax
+  803abe:	78 30                	js     803af0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ac0:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803ac5:	74 2d                	je     803af4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803ac7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803acb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803acf:	48 85 c0             	test   %rax,%rax
+  803ad2:	74 56                	je     803b2a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803ad4:	4c 89 ea             	mov    %r13,%rdx
+  803ad7:	4c 89 e6             	mov    %r12,%rsi
+  803ada:	4c 89 f7             	mov    %r14,%rdi
+  803add:	ff d0                	call   *%rax
+}
+  803adf:	48 83 c4 10          	add    $0x10,%rsp
+  803ae3:	5b                   	pop    %rbx
+  803ae4:	41 5c                	pop    %r12
+  803ae6:	41 5d                	pop    %r13
+  803ae8:	41 5e                	pop    %r14
+  803aea:	5d                   	pop    %rbp
+  803aeb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803aec:	48 98                	cltq
+  803aee:	eb ef                	jmp    803adf <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803af0:	48 98                	cltq
+  803af2:	eb eb                	jmp    803adf <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803af4:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803afb:	00 00 00 
+  803afe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803b04:	89 da                	mov    %ebx,%edx
+  803b06:	48 bf f5 6b 80 00 00 	movabs $0x806bf5,%rdi
+  803b0d:	00 00 00 
+  803b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b15:	48 b9 2e 1d 80 00 00 	movabs $0x801d2e,%rcx
+  803b1c:	00 00 00 
+  803b1f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803b21:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b28:	eb b5                	jmp    803adf <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803b2a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803b31:	eb ac                	jmp    803adf <write+0x65>
+
+0000000000803b33 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803b33:	55                   	push   %rbp
+  803b34:	48 89 e5             	mov    %rsp,%rbp
+  803b37:	53                   	push   %rbx
+  803b38:	48 83 ec 18          	sub    $0x18,%rsp
+  803b3c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b3e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b42:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803b49:	00 00 00 
+  803b4c:	ff d0                	call   *%rax
+  803b4e:	85 c0                	test   %eax,%eax
+  803b50:	78 0c                	js     803b5e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803b52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b56:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803b59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b62:	c9                   	leave
+  803b63:	c3                   	ret
+
+0000000000803b64 <tell>:
+
+int tell(int fdnum) {
+  803b64:	55                   	push   %rbp
+  803b65:	48 89 e5             	mov    %rsp,%rbp
+  803b68:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b6c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b70:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803b77:	00 00 00 
+  803b7a:	ff d0                	call   *%rax
+  803b7c:	85 c0                	test   %eax,%eax
+  803b7e:	78 07                	js     803b87 <tell+0x23>
+
+    return fd->fd_offset;
+  803b80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b84:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803b87:	c9                   	leave
+  803b88:	c3                   	ret
+
+0000000000803b89 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803b89:	55                   	push   %rbp
+  803b8a:	48 89 e5             	mov    %rsp,%rbp
+  803b8d:	41 55                	push   %r13
+  803b8f:	41 54                	push   %r12
+  803b91:	53                   	push   %rbx
+  803b92:	48 83 ec 18          	sub    $0x18,%rsp
+  803b96:	89 fb                	mov    %edi,%ebx
+  803b98:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b9b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b9f:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+  803bab:	85 c0                	test   %eax,%eax
+  803bad:	78 38                	js     803be7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803baf:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803bb3:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803bb7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803bbb:	48 b8 b3 36 80 00 00 	movabs $0x8036b3,%rax
+  803bc2:	00 00 00 
+  803bc5:	ff d0                	call   *%rax
+  803bc7:	85 c0                	test   %eax,%eax
+  803bc9:	78 1c                	js     803be7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803bcb:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803bd0:	74 20                	je     803bf2 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803bd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bd6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803bda:	48 85 c0             	test   %rax,%rax
+  803bdd:	74 47                	je     803c26 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803bdf:	44 89 e6             	mov    %r12d,%esi
+  803be2:	4c 89 ef             	mov    %r13,%rdi
+  803be5:	ff d0                	call   *%rax
+}
+  803be7:	48 83 c4 18          	add    $0x18,%rsp
+  803beb:	5b                   	pop    %rbx
+  803bec:	41 5c                	pop    %r12
+  803bee:	41 5d                	pop    %r13
+  803bf0:	5d                   	pop    %rbp
+  803bf1:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803bf2:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803bf9:	00 00 00 
+  803bfc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c02:	89 da                	mov    %ebx,%edx
+  803c04:	48 bf b8 6b 80 00 00 	movabs $0x806bb8,%rdi
+  803c0b:	00 00 00 
+  803c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c13:	48 b9 2e 1d 80 00 00 	movabs $0x801d2e,%rcx
+  803c1a:	00 00 00 
+  803c1d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803c1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c24:	eb c1                	jmp    803be7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803c26:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c2b:	eb ba                	jmp    803be7 <ftruncate+0x5e>
+
+0000000000803c2d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803c2d:	55                   	push   %rbp
+  803c2e:	48 89 e5             	mov    %rsp,%rbp
+  803c31:	41 54                	push   %r12
+  803c33:	53                   	push   %rbx
+  803c34:	48 83 ec 10          	sub    $0x10,%rsp
+  803c38:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803c3b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803c3f:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803c46:	00 00 00 
+  803c49:	ff d0                	call   *%rax
+  803c4b:	85 c0                	test   %eax,%eax
+  803c4d:	78 63                	js     803cb2 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803c4f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803c53:	41 8b 3c 24          	mov    (%r12),%edi
+  803c57:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803c5b:	48 b8 b3 36 80 00 00 	movabs $0x8036b3,%rax
+  803c62:	00 00 00 
+  803c65:	ff d0                	call   *%rax
+  803c67:	85 c0                	test   %eax,%eax
+  803c69:	78 47                	js     803cb2 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803c6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c6f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803c74:	74 45                	je     803cbb <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803c76:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803c79:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803c80:	00 00 00 
+    stat->st_isdir = 0;
+  803c83:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803c8a:	00 00 00 
+    stat->st_ino = 0;
+  803c8d:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803c94:	00 00 00 00 
+    stat->st_version = 0;
+  803c98:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803c9f:	00 00 00 
+    stat->st_dev = dev;
+  803ca2:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803ca9:	48 89 de             	mov    %rbx,%rsi
+  803cac:	4c 89 e7             	mov    %r12,%rdi
+  803caf:	ff 50 28             	call   *0x28(%rax)
+}
+  803cb2:	48 83 c4 10          	add    $0x10,%rsp
+  803cb6:	5b                   	pop    %rbx
+  803cb7:	41 5c                	pop    %r12
+  803cb9:	5d                   	pop    %rbp
+  803cba:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803cbb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803cc0:	eb f0                	jmp    803cb2 <fstat+0x85>
+
+0000000000803cc2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803cc2:	55                   	push   %rbp
+  803cc3:	48 89 e5             	mov    %rsp,%rbp
+  803cc6:	41 54                	push   %r12
+  803cc8:	53                   	push   %rbx
+  803cc9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803ccc:	be 00 00 00 00       	mov    $0x0,%esi
+  803cd1:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  803cd8:	00 00 00 
+  803cdb:	ff d0                	call   *%rax
+  803cdd:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803cdf:	85 c0                	test   %eax,%eax
+  803ce1:	78 25                	js     803d08 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803ce3:	4c 89 e6             	mov    %r12,%rsi
+  803ce6:	89 c7                	mov    %eax,%edi
+  803ce8:	48 b8 2d 3c 80 00 00 	movabs $0x803c2d,%rax
+  803cef:	00 00 00 
+  803cf2:	ff d0                	call   *%rax
+  803cf4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803cf7:	89 df                	mov    %ebx,%edi
+  803cf9:	48 b8 cd 37 80 00 00 	movabs $0x8037cd,%rax
+  803d00:	00 00 00 
+  803d03:	ff d0                	call   *%rax
+
+    return res;
+  803d05:	44 89 e3             	mov    %r12d,%ebx
+}
+  803d08:	89 d8                	mov    %ebx,%eax
+  803d0a:	5b                   	pop    %rbx
+  803d0b:	41 5c                	pop    %r12
+  803d0d:	5d                   	pop    %rbp
+  803d0e:	c3                   	ret
+
+0000000000803d0f <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803d0f:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  803d16:	00 00 00 
+  803d19:	83 38 00             	cmpl   $0x0,(%rax)
+  803d1c:	74 0a                	je     803d28 <fsipc_env+0x19>
+    return fsenv;
+}
+  803d1e:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  803d25:	00 00 
+  803d27:	c3                   	ret
+fsipc_env(void) {
+  803d28:	55                   	push   %rbp
+  803d29:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803d2c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d31:	48 b8 cb 5e 80 00 00 	movabs $0x805ecb,%rax
+  803d38:	00 00 00 
+  803d3b:	ff d0                	call   *%rax
+  803d3d:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  803d44:	00 00 
+}
+  803d46:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  803d4d:	00 00 
+  803d4f:	5d                   	pop    %rbp
+  803d50:	c3                   	ret
+
+0000000000803d51 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803d51:	55                   	push   %rbp
+  803d52:	48 89 e5             	mov    %rsp,%rbp
+  803d55:	53                   	push   %rbx
+  803d56:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803d5a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803d61:	00 
+  803d62:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803d69:	00 
+  803d6a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803d71:	00 
+  803d72:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803d79:	00 
+  803d7a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803d81:	00 
+
+    assert(size <= sizeof(words));
+  803d82:	48 83 fa 28          	cmp    $0x28,%rdx
+  803d86:	77 38                	ja     803dc0 <fsipc_short+0x6f>
+  803d88:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803d8a:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803d8e:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803d9a:	48 b8 0f 3d 80 00 00 	movabs $0x803d0f,%rax
+  803da1:	00 00 00 
+  803da4:	ff d0                	call   *%rax
+  803da6:	89 c7                	mov    %eax,%edi
+  803da8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803dac:	89 de                	mov    %ebx,%esi
+  803dae:	48 b8 2e 5e 80 00 00 	movabs $0x805e2e,%rax
+  803db5:	00 00 00 
+  803db8:	ff d0                	call   *%rax
+}
+  803dba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dbe:	c9                   	leave
+  803dbf:	c3                   	ret
+    assert(size <= sizeof(words));
+  803dc0:	48 b9 40 6c 80 00 00 	movabs $0x806c40,%rcx
+  803dc7:	00 00 00 
+  803dca:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  803dd1:	00 00 00 
+  803dd4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803dd9:	48 bf 6b 6c 80 00 00 	movabs $0x806c6b,%rdi
+  803de0:	00 00 00 
+  803de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de8:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  803def:	00 00 00 
+  803df2:	41 ff d0             	call   *%r8
+
+0000000000803df5 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803df5:	55                   	push   %rbp
+  803df6:	48 89 e5             	mov    %rsp,%rbp
+  803df9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803dfd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803e00:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803e03:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803e06:	ba 08 00 00 00       	mov    $0x8,%edx
+  803e0b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e0f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803e14:	48 b8 51 3d 80 00 00 	movabs $0x803d51,%rax
+  803e1b:	00 00 00 
+  803e1e:	ff d0                	call   *%rax
+}
+  803e20:	c9                   	leave
+  803e21:	c3                   	ret
+
+0000000000803e22 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803e22:	55                   	push   %rbp
+  803e23:	48 89 e5             	mov    %rsp,%rbp
+  803e26:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803e2a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803e2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803e30:	ba 04 00 00 00       	mov    $0x4,%edx
+  803e35:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803e39:	bf 06 00 00 00       	mov    $0x6,%edi
+  803e3e:	48 b8 51 3d 80 00 00 	movabs $0x803d51,%rax
+  803e45:	00 00 00 
+  803e48:	ff d0                	call   *%rax
+}
+  803e4a:	c9                   	leave
+  803e4b:	c3                   	ret
+
+0000000000803e4c <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803e4c:	55                   	push   %rbp
+  803e4d:	48 89 e5             	mov    %rsp,%rbp
+  803e50:	41 54                	push   %r12
+  803e52:	53                   	push   %rbx
+  803e53:	48 83 ec 10          	sub    $0x10,%rsp
+  803e57:	89 fb                	mov    %edi,%ebx
+  803e59:	49 89 f4             	mov    %rsi,%r12
+  803e5c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803e60:	48 b8 0f 3d 80 00 00 	movabs $0x803d0f,%rax
+  803e67:	00 00 00 
+  803e6a:	ff d0                	call   *%rax
+  803e6c:	89 c7                	mov    %eax,%edi
+  803e6e:	6a 00                	push   $0x0
+  803e70:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803e74:	50                   	push   %rax
+  803e75:	4d 89 e1             	mov    %r12,%r9
+  803e78:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803e7e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e83:	48 ba 00 a0 80 01 00 	movabs $0x180a000,%rdx
+  803e8a:	00 00 00 
+  803e8d:	89 de                	mov    %ebx,%esi
+  803e8f:	48 b8 c9 5d 80 00 00 	movabs $0x805dc9,%rax
+  803e96:	00 00 00 
+  803e99:	ff d0                	call   *%rax
+}
+  803e9b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803e9f:	5b                   	pop    %rbx
+  803ea0:	41 5c                	pop    %r12
+  803ea2:	5d                   	pop    %rbp
+  803ea3:	c3                   	ret
+
+0000000000803ea4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803ea4:	55                   	push   %rbp
+  803ea5:	48 89 e5             	mov    %rsp,%rbp
+  803ea8:	41 54                	push   %r12
+  803eaa:	53                   	push   %rbx
+  803eab:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803eae:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803eb1:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803eb8:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803eba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ebf:	be 00 00 00 00       	mov    $0x0,%esi
+  803ec4:	bf 05 00 00 00       	mov    $0x5,%edi
+  803ec9:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  803ed0:	00 00 00 
+  803ed3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ed5:	85 c0                	test   %eax,%eax
+  803ed7:	78 5a                	js     803f33 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803ed9:	49 bc 00 a0 80 01 00 	movabs $0x180a000,%r12
+  803ee0:	00 00 00 
+  803ee3:	4c 89 e6             	mov    %r12,%rsi
+  803ee6:	48 89 df             	mov    %rbx,%rdi
+  803ee9:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803ef5:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803efc:	00 
+  803efd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803f03:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803f0a:	00 
+  803f0b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803f11:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803f18:	00 
+  803f19:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803f20:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803f27:	00 
+  803f28:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f33:	5b                   	pop    %rbx
+  803f34:	41 5c                	pop    %r12
+  803f36:	5d                   	pop    %rbp
+  803f37:	c3                   	ret
+
+0000000000803f38 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803f38:	55                   	push   %rbp
+  803f39:	48 89 e5             	mov    %rsp,%rbp
+  803f3c:	41 57                	push   %r15
+  803f3e:	41 56                	push   %r14
+  803f40:	41 55                	push   %r13
+  803f42:	41 54                	push   %r12
+  803f44:	53                   	push   %rbx
+  803f45:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803f49:	48 85 ff             	test   %rdi,%rdi
+  803f4c:	0f 84 a1 00 00 00    	je     803ff3 <devfile_read+0xbb>
+  803f52:	49 89 ff             	mov    %rdi,%r15
+  803f55:	49 89 f5             	mov    %rsi,%r13
+  803f58:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803f5b:	48 85 f6             	test   %rsi,%rsi
+  803f5e:	0f 84 c4 00 00 00    	je     804028 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803f64:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803f6b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803f6c:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  803f73:	00 00 00 
+  803f76:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f7a:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803f7d:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f81:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f86:	be 00 00 00 00       	mov    $0x0,%esi
+  803f8b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803f90:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  803f97:	00 00 00 
+  803f9a:	ff d0                	call   *%rax
+        if (res < 0) {
+  803f9c:	85 c0                	test   %eax,%eax
+  803f9e:	0f 88 b9 00 00 00    	js     80405d <devfile_read+0x125>
+        assert(res <= n);
+  803fa4:	48 63 d8             	movslq %eax,%rbx
+  803fa7:	49 39 dc             	cmp    %rbx,%r12
+  803faa:	0f 82 b1 00 00 00    	jb     804061 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803fb0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803fb5:	0f 87 db 00 00 00    	ja     804096 <devfile_read+0x15e>
+        if (!res) {
+  803fbb:	85 c0                	test   %eax,%eax
+  803fbd:	74 21                	je     803fe0 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803fbf:	48 89 da             	mov    %rbx,%rdx
+  803fc2:	4c 89 f6             	mov    %r14,%rsi
+  803fc5:	4c 89 ef             	mov    %r13,%rdi
+  803fc8:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  803fcf:	00 00 00 
+  803fd2:	ff d0                	call   *%rax
+        total_read += res;
+  803fd4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803fd8:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803fdb:	49 29 dc             	sub    %rbx,%r12
+  803fde:	75 96                	jne    803f76 <devfile_read+0x3e>
+    return total_read;
+  803fe0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803fe4:	48 83 c4 18          	add    $0x18,%rsp
+  803fe8:	5b                   	pop    %rbx
+  803fe9:	41 5c                	pop    %r12
+  803feb:	41 5d                	pop    %r13
+  803fed:	41 5e                	pop    %r14
+  803fef:	41 5f                	pop    %r15
+  803ff1:	5d                   	pop    %rbp
+  803ff2:	c3                   	ret
+    assert(fd);
+  803ff3:	48 b9 76 6c 80 00 00 	movabs $0x806c76,%rcx
+  803ffa:	00 00 00 
+  803ffd:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  804004:	00 00 00 
+  804007:	be 91 00 00 00       	mov    $0x91,%esi
+  80400c:	48 bf 6b 6c 80 00 00 	movabs $0x806c6b,%rdi
+  804013:	00 00 00 
+  804016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80401b:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  804022:	00 00 00 
+  804025:	41 ff d0             	call   *%r8
+    assert(buf);
+  804028:	48 b9 79 6c 80 00 00 	movabs $0x806c79,%rcx
+  80402f:	00 00 00 
+  804032:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  804039:	00 00 00 
+  80403c:	be 92 00 00 00       	mov    $0x92,%esi
+  804041:	48 bf 6b 6c 80 00 00 	movabs $0x806c6b,%rdi
+  804048:	00 00 00 
+  80404b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804050:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  804057:	00 00 00 
+  80405a:	41 ff d0             	call   *%r8
+            return res;
+  80405d:	48 98                	cltq
+  80405f:	eb 83                	jmp    803fe4 <devfile_read+0xac>
+        assert(res <= n);
+  804061:	48 b9 7d 6c 80 00 00 	movabs $0x806c7d,%rcx
+  804068:	00 00 00 
+  80406b:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  804072:	00 00 00 
+  804075:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80407a:	48 bf 6b 6c 80 00 00 	movabs $0x806c6b,%rdi
+  804081:	00 00 00 
+  804084:	b8 00 00 00 00       	mov    $0x0,%eax
+  804089:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  804090:	00 00 00 
+  804093:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  804096:	48 b9 88 6c 80 00 00 	movabs $0x806c88,%rcx
+  80409d:	00 00 00 
+  8040a0:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  8040a7:	00 00 00 
+  8040aa:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8040af:	48 bf 6b 6c 80 00 00 	movabs $0x806c6b,%rdi
+  8040b6:	00 00 00 
+  8040b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040be:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  8040c5:	00 00 00 
+  8040c8:	41 ff d0             	call   *%r8
+
+00000000008040cb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8040cb:	55                   	push   %rbp
+  8040cc:	48 89 e5             	mov    %rsp,%rbp
+  8040cf:	41 57                	push   %r15
+  8040d1:	41 56                	push   %r14
+  8040d3:	41 55                	push   %r13
+  8040d5:	41 54                	push   %r12
+  8040d7:	53                   	push   %rbx
+  8040d8:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8040dc:	48 85 ff             	test   %rdi,%rdi
+  8040df:	0f 84 83 00 00 00    	je     804168 <devfile_write+0x9d>
+  8040e5:	49 89 ff             	mov    %rdi,%r15
+  8040e8:	49 89 f4             	mov    %rsi,%r12
+  8040eb:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8040ee:	48 85 f6             	test   %rsi,%rsi
+  8040f1:	0f 84 a6 00 00 00    	je     80419d <devfile_write+0xd2>
+    size_t total_written = 0;
+  8040f7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8040fd:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  804104:	00 00 00 
+  804107:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80410b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  80410e:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  804112:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  804117:	48 39 d3             	cmp    %rdx,%rbx
+  80411a:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  80411e:	4c 89 e6             	mov    %r12,%rsi
+  804121:	48 bf 10 a0 80 01 00 	movabs $0x180a010,%rdi
+  804128:	00 00 00 
+  80412b:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  804132:	00 00 00 
+  804135:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804137:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80413c:	be 00 00 00 00       	mov    $0x0,%esi
+  804141:	bf 04 00 00 00       	mov    $0x4,%edi
+  804146:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  80414d:	00 00 00 
+  804150:	ff d0                	call   *%rax
+        if (res < 0) {
+  804152:	85 c0                	test   %eax,%eax
+  804154:	78 7c                	js     8041d2 <devfile_write+0x107>
+        total_written += res;
+  804156:	48 98                	cltq
+  804158:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  80415b:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  80415e:	48 29 c3             	sub    %rax,%rbx
+  804161:	75 a4                	jne    804107 <devfile_write+0x3c>
+    return total_written;
+  804163:	4c 89 e8             	mov    %r13,%rax
+  804166:	eb 6c                	jmp    8041d4 <devfile_write+0x109>
+    assert(fd);
+  804168:	48 b9 76 6c 80 00 00 	movabs $0x806c76,%rcx
+  80416f:	00 00 00 
+  804172:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  804179:	00 00 00 
+  80417c:	be bd 00 00 00       	mov    $0xbd,%esi
+  804181:	48 bf 6b 6c 80 00 00 	movabs $0x806c6b,%rdi
+  804188:	00 00 00 
+  80418b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804190:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  804197:	00 00 00 
+  80419a:	41 ff d0             	call   *%r8
+    assert(buf);
+  80419d:	48 b9 79 6c 80 00 00 	movabs $0x806c79,%rcx
+  8041a4:	00 00 00 
+  8041a7:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  8041ae:	00 00 00 
+  8041b1:	be be 00 00 00       	mov    $0xbe,%esi
+  8041b6:	48 bf 6b 6c 80 00 00 	movabs $0x806c6b,%rdi
+  8041bd:	00 00 00 
+  8041c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c5:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  8041cc:	00 00 00 
+  8041cf:	41 ff d0             	call   *%r8
+            return res;
+  8041d2:	48 98                	cltq
+}
+  8041d4:	48 83 c4 08          	add    $0x8,%rsp
+  8041d8:	5b                   	pop    %rbx
+  8041d9:	41 5c                	pop    %r12
+  8041db:	41 5d                	pop    %r13
+  8041dd:	41 5e                	pop    %r14
+  8041df:	41 5f                	pop    %r15
+  8041e1:	5d                   	pop    %rbp
+  8041e2:	c3                   	ret
+
+00000000008041e3 <open>:
+open(const char *path, int mode) {
+  8041e3:	55                   	push   %rbp
+  8041e4:	48 89 e5             	mov    %rsp,%rbp
+  8041e7:	41 55                	push   %r13
+  8041e9:	41 54                	push   %r12
+  8041eb:	53                   	push   %rbx
+  8041ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8041f0:	49 89 fc             	mov    %rdi,%r12
+  8041f3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8041f6:	48 b8 27 26 80 00 00 	movabs $0x802627,%rax
+  8041fd:	00 00 00 
+  804200:	ff d0                	call   *%rax
+  804202:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804208:	0f 87 8f 00 00 00    	ja     80429d <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80420e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804212:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  804219:	00 00 00 
+  80421c:	ff d0                	call   *%rax
+  80421e:	89 c3                	mov    %eax,%ebx
+  804220:	85 c0                	test   %eax,%eax
+  804222:	78 55                	js     804279 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  804224:	4c 89 e6             	mov    %r12,%rsi
+  804227:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  80422e:	00 00 00 
+  804231:	48 89 df             	mov    %rbx,%rdi
+  804234:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  80423b:	00 00 00 
+  80423e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804240:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804247:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80424c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804250:	bf 01 00 00 00       	mov    $0x1,%edi
+  804255:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  80425c:	00 00 00 
+  80425f:	ff d0                	call   *%rax
+  804261:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804263:	85 c0                	test   %eax,%eax
+  804265:	78 1f                	js     804286 <open+0xa3>
+    return fd2num(fd);
+  804267:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80426b:	48 b8 da 35 80 00 00 	movabs $0x8035da,%rax
+  804272:	00 00 00 
+  804275:	ff d0                	call   *%rax
+  804277:	89 c3                	mov    %eax,%ebx
+}
+  804279:	89 d8                	mov    %ebx,%eax
+  80427b:	48 83 c4 18          	add    $0x18,%rsp
+  80427f:	5b                   	pop    %rbx
+  804280:	41 5c                	pop    %r12
+  804282:	41 5d                	pop    %r13
+  804284:	5d                   	pop    %rbp
+  804285:	c3                   	ret
+        fd_close(fd, 0);
+  804286:	be 00 00 00 00       	mov    $0x0,%esi
+  80428b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80428f:	48 b8 23 37 80 00 00 	movabs $0x803723,%rax
+  804296:	00 00 00 
+  804299:	ff d0                	call   *%rax
+        return res;
+  80429b:	eb dc                	jmp    804279 <open+0x96>
+        return -E_BAD_PATH;
+  80429d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8042a2:	eb d5                	jmp    804279 <open+0x96>
+
+00000000008042a4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8042a4:	55                   	push   %rbp
+  8042a5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  8042a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8042b2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8042b7:	48 b8 51 3d 80 00 00 	movabs $0x803d51,%rax
+  8042be:	00 00 00 
+  8042c1:	ff d0                	call   *%rax
+}
+  8042c3:	5d                   	pop    %rbp
+  8042c4:	c3                   	ret
+
+00000000008042c5 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  8042c5:	55                   	push   %rbp
+  8042c6:	48 89 e5             	mov    %rsp,%rbp
+  8042c9:	41 56                	push   %r14
+  8042cb:	41 55                	push   %r13
+  8042cd:	41 54                	push   %r12
+  8042cf:	53                   	push   %rbx
+  8042d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8042d4:	41 89 f6             	mov    %esi,%r14d
+  8042d7:	49 89 d4             	mov    %rdx,%r12
+  8042da:	48 89 cb             	mov    %rcx,%rbx
+  8042dd:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8042e0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8042e4:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  8042eb:	00 00 00 
+  8042ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042f0:	85 c0                	test   %eax,%eax
+  8042f2:	78 46                	js     80433a <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8042f4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042f8:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8042ff:	00 00 00 
+  804302:	8b 00                	mov    (%rax),%eax
+  804304:	39 02                	cmp    %eax,(%rdx)
+  804306:	75 3f                	jne    804347 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804308:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80430f:	00 00 00 
+  804312:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804315:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804317:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80431b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  80431f:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804323:	48 89 da             	mov    %rbx,%rdx
+  804326:	4c 89 e6             	mov    %r12,%rsi
+  804329:	bf 09 00 00 00       	mov    $0x9,%edi
+  80432e:	48 b8 4c 3e 80 00 00 	movabs $0x803e4c,%rax
+  804335:	00 00 00 
+  804338:	ff d0                	call   *%rax
+}
+  80433a:	48 83 c4 10          	add    $0x10,%rsp
+  80433e:	5b                   	pop    %rbx
+  80433f:	41 5c                	pop    %r12
+  804341:	41 5d                	pop    %r13
+  804343:	41 5e                	pop    %r14
+  804345:	5d                   	pop    %rbp
+  804346:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804347:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80434c:	eb ec                	jmp    80433a <file_map+0x75>
+
+000000000080434e <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80434e:	55                   	push   %rbp
+  80434f:	48 89 e5             	mov    %rsp,%rbp
+  804352:	41 54                	push   %r12
+  804354:	53                   	push   %rbx
+  804355:	48 83 ec 20          	sub    $0x20,%rsp
+  804359:	41 89 f4             	mov    %esi,%r12d
+  80435c:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80435f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804363:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  80436a:	00 00 00 
+  80436d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80436f:	85 c0                	test   %eax,%eax
+  804371:	78 3c                	js     8043af <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804373:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804377:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80437e:	00 00 00 
+  804381:	8b 0a                	mov    (%rdx),%ecx
+  804383:	39 08                	cmp    %ecx,(%rax)
+  804385:	75 31                	jne    8043b8 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804387:	8b 40 0c             	mov    0xc(%rax),%eax
+  80438a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80438d:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804391:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804395:	ba 10 00 00 00       	mov    $0x10,%edx
+  80439a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80439e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8043a3:	48 b8 51 3d 80 00 00 	movabs $0x803d51,%rax
+  8043aa:	00 00 00 
+  8043ad:	ff d0                	call   *%rax
+}
+  8043af:	48 83 c4 20          	add    $0x20,%rsp
+  8043b3:	5b                   	pop    %rbx
+  8043b4:	41 5c                	pop    %r12
+  8043b6:	5d                   	pop    %rbp
+  8043b7:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8043b8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8043bd:	eb f0                	jmp    8043af <file_msync+0x61>
+
+00000000008043bf <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8043bf:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8043c3:	7f 01                	jg     8043c6 <writebuf+0x7>
+  8043c5:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8043c6:	55                   	push   %rbp
+  8043c7:	48 89 e5             	mov    %rsp,%rbp
+  8043ca:	53                   	push   %rbx
+  8043cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8043cf:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8043d2:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8043d6:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8043da:	8b 3f                	mov    (%rdi),%edi
+  8043dc:	48 b8 7a 3a 80 00 00 	movabs $0x803a7a,%rax
+  8043e3:	00 00 00 
+  8043e6:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8043e8:	48 85 c0             	test   %rax,%rax
+  8043eb:	7e 04                	jle    8043f1 <writebuf+0x32>
+  8043ed:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8043f1:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8043f5:	48 39 c2             	cmp    %rax,%rdx
+  8043f8:	74 0f                	je     804409 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8043fa:	48 85 c0             	test   %rax,%rax
+  8043fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804402:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804406:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804409:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80440d:	c9                   	leave
+  80440e:	c3                   	ret
+
+000000000080440f <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80440f:	8b 46 04             	mov    0x4(%rsi),%eax
+  804412:	8d 50 01             	lea    0x1(%rax),%edx
+  804415:	89 56 04             	mov    %edx,0x4(%rsi)
+  804418:	48 98                	cltq
+  80441a:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80441f:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804425:	74 01                	je     804428 <putch+0x19>
+  804427:	c3                   	ret
+putch(int ch, void *arg) {
+  804428:	55                   	push   %rbp
+  804429:	48 89 e5             	mov    %rsp,%rbp
+  80442c:	53                   	push   %rbx
+  80442d:	48 83 ec 08          	sub    $0x8,%rsp
+  804431:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804434:	48 89 f7             	mov    %rsi,%rdi
+  804437:	48 b8 bf 43 80 00 00 	movabs $0x8043bf,%rax
+  80443e:	00 00 00 
+  804441:	ff d0                	call   *%rax
+        state->offset = 0;
+  804443:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80444a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80444e:	c9                   	leave
+  80444f:	c3                   	ret
+
+0000000000804450 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804450:	55                   	push   %rbp
+  804451:	48 89 e5             	mov    %rsp,%rbp
+  804454:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80445b:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80445e:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804464:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80446b:	00 00 00 
+    state.result = 0;
+  80446e:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804475:	00 00 00 00 
+    state.error = 1;
+  804479:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804480:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804483:	48 89 f2             	mov    %rsi,%rdx
+  804486:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80448d:	48 bf 0f 44 80 00 00 	movabs $0x80440f,%rdi
+  804494:	00 00 00 
+  804497:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  80449e:	00 00 00 
+  8044a1:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8044a3:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8044aa:	7f 14                	jg     8044c0 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8044ac:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8044b3:	48 85 c0             	test   %rax,%rax
+  8044b6:	75 06                	jne    8044be <vfprintf+0x6e>
+  8044b8:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8044be:	c9                   	leave
+  8044bf:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8044c0:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8044c7:	48 b8 bf 43 80 00 00 	movabs $0x8043bf,%rax
+  8044ce:	00 00 00 
+  8044d1:	ff d0                	call   *%rax
+  8044d3:	eb d7                	jmp    8044ac <vfprintf+0x5c>
+
+00000000008044d5 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8044d5:	55                   	push   %rbp
+  8044d6:	48 89 e5             	mov    %rsp,%rbp
+  8044d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8044dd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8044e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8044e5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8044e9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8044ed:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8044f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044fc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804500:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804504:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804508:	48 b8 50 44 80 00 00 	movabs $0x804450,%rax
+  80450f:	00 00 00 
+  804512:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804514:	c9                   	leave
+  804515:	c3                   	ret
+
+0000000000804516 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804516:	55                   	push   %rbp
+  804517:	48 89 e5             	mov    %rsp,%rbp
+  80451a:	48 83 ec 50          	sub    $0x50,%rsp
+  80451e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804522:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804526:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80452a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80452e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804532:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804539:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80453d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804541:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804545:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804549:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80454d:	48 89 fe             	mov    %rdi,%rsi
+  804550:	bf 01 00 00 00       	mov    $0x1,%edi
+  804555:	48 b8 50 44 80 00 00 	movabs $0x804450,%rax
+  80455c:	00 00 00 
+  80455f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804561:	c9                   	leave
+  804562:	c3                   	ret
+
+0000000000804563 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804563:	55                   	push   %rbp
+  804564:	48 89 e5             	mov    %rsp,%rbp
+  804567:	41 54                	push   %r12
+  804569:	53                   	push   %rbx
+  80456a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80456d:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  804574:	00 00 00 
+  804577:	ff d0                	call   *%rax
+  804579:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80457c:	48 be b0 6c 80 00 00 	movabs $0x806cb0,%rsi
+  804583:	00 00 00 
+  804586:	48 89 df             	mov    %rbx,%rdi
+  804589:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  804590:	00 00 00 
+  804593:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804595:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80459a:	41 2b 04 24          	sub    (%r12),%eax
+  80459e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8045a4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8045ab:	00 00 00 
+    stat->st_dev = &devpipe;
+  8045ae:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8045b5:	00 00 00 
+  8045b8:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8045bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c4:	5b                   	pop    %rbx
+  8045c5:	41 5c                	pop    %r12
+  8045c7:	5d                   	pop    %rbp
+  8045c8:	c3                   	ret
+
+00000000008045c9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8045c9:	55                   	push   %rbp
+  8045ca:	48 89 e5             	mov    %rsp,%rbp
+  8045cd:	41 54                	push   %r12
+  8045cf:	53                   	push   %rbx
+  8045d0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8045d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045d8:	48 89 fe             	mov    %rdi,%rsi
+  8045db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045e0:	49 bc a2 2e 80 00 00 	movabs $0x802ea2,%r12
+  8045e7:	00 00 00 
+  8045ea:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8045ed:	48 89 df             	mov    %rbx,%rdi
+  8045f0:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  8045f7:	00 00 00 
+  8045fa:	ff d0                	call   *%rax
+  8045fc:	48 89 c6             	mov    %rax,%rsi
+  8045ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804604:	bf 00 00 00 00       	mov    $0x0,%edi
+  804609:	41 ff d4             	call   *%r12
+}
+  80460c:	5b                   	pop    %rbx
+  80460d:	41 5c                	pop    %r12
+  80460f:	5d                   	pop    %rbp
+  804610:	c3                   	ret
+
+0000000000804611 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804611:	55                   	push   %rbp
+  804612:	48 89 e5             	mov    %rsp,%rbp
+  804615:	41 57                	push   %r15
+  804617:	41 56                	push   %r14
+  804619:	41 55                	push   %r13
+  80461b:	41 54                	push   %r12
+  80461d:	53                   	push   %rbx
+  80461e:	48 83 ec 18          	sub    $0x18,%rsp
+  804622:	49 89 fc             	mov    %rdi,%r12
+  804625:	49 89 f5             	mov    %rsi,%r13
+  804628:	49 89 d7             	mov    %rdx,%r15
+  80462b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80462f:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  804636:	00 00 00 
+  804639:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80463b:	4d 85 ff             	test   %r15,%r15
+  80463e:	0f 84 af 00 00 00    	je     8046f3 <devpipe_write+0xe2>
+  804644:	48 89 c3             	mov    %rax,%rbx
+  804647:	4c 89 f8             	mov    %r15,%rax
+  80464a:	4d 89 ef             	mov    %r13,%r15
+  80464d:	4c 01 e8             	add    %r13,%rax
+  804650:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804654:	49 bd 98 2d 80 00 00 	movabs $0x802d98,%r13
+  80465b:	00 00 00 
+            sys_yield();
+  80465e:	49 be 29 2d 80 00 00 	movabs $0x802d29,%r14
+  804665:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804668:	8b 73 04             	mov    0x4(%rbx),%esi
+  80466b:	48 63 ce             	movslq %esi,%rcx
+  80466e:	48 63 03             	movslq (%rbx),%rax
+  804671:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804677:	48 39 c1             	cmp    %rax,%rcx
+  80467a:	72 2e                	jb     8046aa <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80467c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804681:	48 89 da             	mov    %rbx,%rdx
+  804684:	be 00 10 00 00       	mov    $0x1000,%esi
+  804689:	4c 89 e7             	mov    %r12,%rdi
+  80468c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80468f:	85 c0                	test   %eax,%eax
+  804691:	74 66                	je     8046f9 <devpipe_write+0xe8>
+            sys_yield();
+  804693:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804696:	8b 73 04             	mov    0x4(%rbx),%esi
+  804699:	48 63 ce             	movslq %esi,%rcx
+  80469c:	48 63 03             	movslq (%rbx),%rax
+  80469f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8046a5:	48 39 c1             	cmp    %rax,%rcx
+  8046a8:	73 d2                	jae    80467c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8046aa:	41 0f b6 3f          	movzbl (%r15),%edi
+  8046ae:	48 89 ca             	mov    %rcx,%rdx
+  8046b1:	48 c1 ea 03          	shr    $0x3,%rdx
+  8046b5:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8046bc:	08 10 20 
+  8046bf:	48 f7 e2             	mul    %rdx
+  8046c2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8046c6:	48 89 d0             	mov    %rdx,%rax
+  8046c9:	48 c1 e0 09          	shl    $0x9,%rax
+  8046cd:	48 29 d0             	sub    %rdx,%rax
+  8046d0:	48 c1 e0 03          	shl    $0x3,%rax
+  8046d4:	48 29 c1             	sub    %rax,%rcx
+  8046d7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8046dc:	83 c6 01             	add    $0x1,%esi
+  8046df:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8046e2:	49 83 c7 01          	add    $0x1,%r15
+  8046e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ea:	49 39 c7             	cmp    %rax,%r15
+  8046ed:	0f 85 75 ff ff ff    	jne    804668 <devpipe_write+0x57>
+    return n;
+  8046f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046f7:	eb 05                	jmp    8046fe <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8046f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046fe:	48 83 c4 18          	add    $0x18,%rsp
+  804702:	5b                   	pop    %rbx
+  804703:	41 5c                	pop    %r12
+  804705:	41 5d                	pop    %r13
+  804707:	41 5e                	pop    %r14
+  804709:	41 5f                	pop    %r15
+  80470b:	5d                   	pop    %rbp
+  80470c:	c3                   	ret
+
+000000000080470d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80470d:	55                   	push   %rbp
+  80470e:	48 89 e5             	mov    %rsp,%rbp
+  804711:	41 57                	push   %r15
+  804713:	41 56                	push   %r14
+  804715:	41 55                	push   %r13
+  804717:	41 54                	push   %r12
+  804719:	53                   	push   %rbx
+  80471a:	48 83 ec 18          	sub    $0x18,%rsp
+  80471e:	49 89 fc             	mov    %rdi,%r12
+  804721:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804725:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804729:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  804730:	00 00 00 
+  804733:	ff d0                	call   *%rax
+  804735:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804738:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80473e:	49 bd 98 2d 80 00 00 	movabs $0x802d98,%r13
+  804745:	00 00 00 
+            sys_yield();
+  804748:	49 be 29 2d 80 00 00 	movabs $0x802d29,%r14
+  80474f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804752:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804757:	74 7d                	je     8047d6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804759:	8b 03                	mov    (%rbx),%eax
+  80475b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80475e:	75 26                	jne    804786 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804760:	4d 85 ff             	test   %r15,%r15
+  804763:	75 77                	jne    8047dc <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804765:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80476a:	48 89 da             	mov    %rbx,%rdx
+  80476d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804772:	4c 89 e7             	mov    %r12,%rdi
+  804775:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804778:	85 c0                	test   %eax,%eax
+  80477a:	74 72                	je     8047ee <devpipe_read+0xe1>
+            sys_yield();
+  80477c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80477f:	8b 03                	mov    (%rbx),%eax
+  804781:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804784:	74 df                	je     804765 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804786:	48 63 c8             	movslq %eax,%rcx
+  804789:	48 89 ca             	mov    %rcx,%rdx
+  80478c:	48 c1 ea 03          	shr    $0x3,%rdx
+  804790:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804797:	08 10 20 
+  80479a:	48 89 d0             	mov    %rdx,%rax
+  80479d:	48 f7 e6             	mul    %rsi
+  8047a0:	48 c1 ea 06          	shr    $0x6,%rdx
+  8047a4:	48 89 d0             	mov    %rdx,%rax
+  8047a7:	48 c1 e0 09          	shl    $0x9,%rax
+  8047ab:	48 29 d0             	sub    %rdx,%rax
+  8047ae:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8047b5:	00 
+  8047b6:	48 89 c8             	mov    %rcx,%rax
+  8047b9:	48 29 d0             	sub    %rdx,%rax
+  8047bc:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8047c1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8047c5:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8047c9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8047cc:	49 83 c7 01          	add    $0x1,%r15
+  8047d0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8047d4:	75 83                	jne    804759 <devpipe_read+0x4c>
+    return n;
+  8047d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047da:	eb 03                	jmp    8047df <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8047dc:	4c 89 f8             	mov    %r15,%rax
+}
+  8047df:	48 83 c4 18          	add    $0x18,%rsp
+  8047e3:	5b                   	pop    %rbx
+  8047e4:	41 5c                	pop    %r12
+  8047e6:	41 5d                	pop    %r13
+  8047e8:	41 5e                	pop    %r14
+  8047ea:	41 5f                	pop    %r15
+  8047ec:	5d                   	pop    %rbp
+  8047ed:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8047ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f3:	eb ea                	jmp    8047df <devpipe_read+0xd2>
+
+00000000008047f5 <pipe>:
+pipe(int pfd[2]) {
+  8047f5:	55                   	push   %rbp
+  8047f6:	48 89 e5             	mov    %rsp,%rbp
+  8047f9:	41 55                	push   %r13
+  8047fb:	41 54                	push   %r12
+  8047fd:	53                   	push   %rbx
+  8047fe:	48 83 ec 18          	sub    $0x18,%rsp
+  804802:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804805:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804809:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  804810:	00 00 00 
+  804813:	ff d0                	call   *%rax
+  804815:	89 c3                	mov    %eax,%ebx
+  804817:	85 c0                	test   %eax,%eax
+  804819:	0f 88 a0 01 00 00    	js     8049bf <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80481f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804824:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804829:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80482d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804832:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  804839:	00 00 00 
+  80483c:	ff d0                	call   *%rax
+  80483e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804840:	85 c0                	test   %eax,%eax
+  804842:	0f 88 77 01 00 00    	js     8049bf <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804848:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80484c:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  804853:	00 00 00 
+  804856:	ff d0                	call   *%rax
+  804858:	89 c3                	mov    %eax,%ebx
+  80485a:	85 c0                	test   %eax,%eax
+  80485c:	0f 88 43 01 00 00    	js     8049a5 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804862:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804867:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80486c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804870:	bf 00 00 00 00       	mov    $0x0,%edi
+  804875:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  80487c:	00 00 00 
+  80487f:	ff d0                	call   *%rax
+  804881:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804883:	85 c0                	test   %eax,%eax
+  804885:	0f 88 1a 01 00 00    	js     8049a5 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80488b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80488f:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  804896:	00 00 00 
+  804899:	ff d0                	call   *%rax
+  80489b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80489e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8048a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048a8:	48 89 c6             	mov    %rax,%rsi
+  8048ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b0:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  8048b7:	00 00 00 
+  8048ba:	ff d0                	call   *%rax
+  8048bc:	89 c3                	mov    %eax,%ebx
+  8048be:	85 c0                	test   %eax,%eax
+  8048c0:	0f 88 c5 00 00 00    	js     80498b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8048c6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8048ca:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  8048d1:	00 00 00 
+  8048d4:	ff d0                	call   *%rax
+  8048d6:	48 89 c1             	mov    %rax,%rcx
+  8048d9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8048df:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8048e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048ea:	4c 89 ee             	mov    %r13,%rsi
+  8048ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048f2:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  8048f9:	00 00 00 
+  8048fc:	ff d0                	call   *%rax
+  8048fe:	89 c3                	mov    %eax,%ebx
+  804900:	85 c0                	test   %eax,%eax
+  804902:	78 6e                	js     804972 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804904:	be 00 10 00 00       	mov    $0x1000,%esi
+  804909:	4c 89 ef             	mov    %r13,%rdi
+  80490c:	48 b8 60 2d 80 00 00 	movabs $0x802d60,%rax
+  804913:	00 00 00 
+  804916:	ff d0                	call   *%rax
+  804918:	83 f8 02             	cmp    $0x2,%eax
+  80491b:	0f 85 ab 00 00 00    	jne    8049cc <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804921:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804928:	00 00 
+  80492a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80492e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804930:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804934:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80493b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80493f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804941:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804945:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80494c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804950:	48 bb da 35 80 00 00 	movabs $0x8035da,%rbx
+  804957:	00 00 00 
+  80495a:	ff d3                	call   *%rbx
+  80495c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804960:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804964:	ff d3                	call   *%rbx
+  804966:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80496b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804970:	eb 4d                	jmp    8049bf <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804972:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804977:	4c 89 ee             	mov    %r13,%rsi
+  80497a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80497f:	48 b8 a2 2e 80 00 00 	movabs $0x802ea2,%rax
+  804986:	00 00 00 
+  804989:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80498b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804990:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804994:	bf 00 00 00 00       	mov    $0x0,%edi
+  804999:	48 b8 a2 2e 80 00 00 	movabs $0x802ea2,%rax
+  8049a0:	00 00 00 
+  8049a3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8049a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049aa:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8049ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049b3:	48 b8 a2 2e 80 00 00 	movabs $0x802ea2,%rax
+  8049ba:	00 00 00 
+  8049bd:	ff d0                	call   *%rax
+}
+  8049bf:	89 d8                	mov    %ebx,%eax
+  8049c1:	48 83 c4 18          	add    $0x18,%rsp
+  8049c5:	5b                   	pop    %rbx
+  8049c6:	41 5c                	pop    %r12
+  8049c8:	41 5d                	pop    %r13
+  8049ca:	5d                   	pop    %rbp
+  8049cb:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8049cc:	48 b9 c8 6c 80 00 00 	movabs $0x806cc8,%rcx
+  8049d3:	00 00 00 
+  8049d6:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  8049dd:	00 00 00 
+  8049e0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8049e5:	48 bf b7 6c 80 00 00 	movabs $0x806cb7,%rdi
+  8049ec:	00 00 00 
+  8049ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f4:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  8049fb:	00 00 00 
+  8049fe:	41 ff d0             	call   *%r8
+
+0000000000804a01 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804a01:	55                   	push   %rbp
+  804a02:	48 89 e5             	mov    %rsp,%rbp
+  804a05:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804a09:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804a0d:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  804a14:	00 00 00 
+  804a17:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804a19:	85 c0                	test   %eax,%eax
+  804a1b:	78 35                	js     804a52 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804a1d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a21:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  804a28:	00 00 00 
+  804a2b:	ff d0                	call   *%rax
+  804a2d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804a30:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804a35:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a3a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a3e:	48 b8 98 2d 80 00 00 	movabs $0x802d98,%rax
+  804a45:	00 00 00 
+  804a48:	ff d0                	call   *%rax
+  804a4a:	85 c0                	test   %eax,%eax
+  804a4c:	0f 94 c0             	sete   %al
+  804a4f:	0f b6 c0             	movzbl %al,%eax
+}
+  804a52:	c9                   	leave
+  804a53:	c3                   	ret
+
+0000000000804a54 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804a54:	55                   	push   %rbp
+  804a55:	48 89 e5             	mov    %rsp,%rbp
+  804a58:	41 55                	push   %r13
+  804a5a:	41 54                	push   %r12
+  804a5c:	53                   	push   %rbx
+  804a5d:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  804a61:	85 ff                	test   %edi,%edi
+  804a63:	74 73                	je     804ad8 <wait+0x84>
+  804a65:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804a68:	89 f8                	mov    %edi,%eax
+  804a6a:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  804a6f:	89 f9                	mov    %edi,%ecx
+  804a71:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804a77:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  804a7e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804a85:	00 00 00 
+  804a88:	48 01 ca             	add    %rcx,%rdx
+  804a8b:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804a91:	39 d7                	cmp    %edx,%edi
+  804a93:	75 38                	jne    804acd <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804a95:	48 98                	cltq
+  804a97:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  804a9e:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804aa5:	00 00 00 
+  804aa8:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804aab:	49 bd 29 2d 80 00 00 	movabs $0x802d29,%r13
+  804ab2:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804ab5:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  804abb:	85 c0                	test   %eax,%eax
+  804abd:	74 0e                	je     804acd <wait+0x79>
+        sys_yield();
+  804abf:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804ac2:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804ac8:	44 39 e0             	cmp    %r12d,%eax
+  804acb:	74 e8                	je     804ab5 <wait+0x61>
+    }
+}
+  804acd:	48 83 c4 08          	add    $0x8,%rsp
+  804ad1:	5b                   	pop    %rbx
+  804ad2:	41 5c                	pop    %r12
+  804ad4:	41 5d                	pop    %r13
+  804ad6:	5d                   	pop    %rbp
+  804ad7:	c3                   	ret
+    assert(envid != 0);
+  804ad8:	48 b9 ec 6c 80 00 00 	movabs $0x806cec,%rcx
+  804adf:	00 00 00 
+  804ae2:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  804ae9:	00 00 00 
+  804aec:	be 06 00 00 00       	mov    $0x6,%esi
+  804af1:	48 bf f7 6c 80 00 00 	movabs $0x806cf7,%rdi
+  804af8:	00 00 00 
+  804afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b00:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  804b07:	00 00 00 
+  804b0a:	41 ff d0             	call   *%r8
+
+0000000000804b0d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b0d:	48 89 f8             	mov    %rdi,%rax
+  804b10:	48 c1 e8 27          	shr    $0x27,%rax
+  804b14:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b1b:	01 00 00 
+  804b1e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b22:	f6 c2 01             	test   $0x1,%dl
+  804b25:	74 6d                	je     804b94 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804b27:	48 89 f8             	mov    %rdi,%rax
+  804b2a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804b2e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b35:	01 00 00 
+  804b38:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b3c:	f6 c2 01             	test   $0x1,%dl
+  804b3f:	74 62                	je     804ba3 <get_uvpt_entry+0x96>
+  804b41:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b48:	01 00 00 
+  804b4b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b4f:	f6 c2 80             	test   $0x80,%dl
+  804b52:	75 4f                	jne    804ba3 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804b54:	48 89 f8             	mov    %rdi,%rax
+  804b57:	48 c1 e8 15          	shr    $0x15,%rax
+  804b5b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804b62:	01 00 00 
+  804b65:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b69:	f6 c2 01             	test   $0x1,%dl
+  804b6c:	74 44                	je     804bb2 <get_uvpt_entry+0xa5>
+  804b6e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804b75:	01 00 00 
+  804b78:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b7c:	f6 c2 80             	test   $0x80,%dl
+  804b7f:	75 31                	jne    804bb2 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804b81:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804b85:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804b8c:	01 00 00 
+  804b8f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804b93:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b94:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b9b:	01 00 00 
+  804b9e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ba2:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804ba3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804baa:	01 00 00 
+  804bad:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bb1:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804bb2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804bb9:	01 00 00 
+  804bbc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bc0:	c3                   	ret
+
+0000000000804bc1 <get_prot>:
+
+int
+get_prot(void *va) {
+  804bc1:	55                   	push   %rbp
+  804bc2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804bc5:	48 b8 0d 4b 80 00 00 	movabs $0x804b0d,%rax
+  804bcc:	00 00 00 
+  804bcf:	ff d0                	call   *%rax
+  804bd1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804bd4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804bd9:	89 c1                	mov    %eax,%ecx
+  804bdb:	83 c9 04             	or     $0x4,%ecx
+  804bde:	f6 c2 01             	test   $0x1,%dl
+  804be1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804be4:	89 c1                	mov    %eax,%ecx
+  804be6:	83 c9 02             	or     $0x2,%ecx
+  804be9:	f6 c2 02             	test   $0x2,%dl
+  804bec:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804bef:	89 c1                	mov    %eax,%ecx
+  804bf1:	83 c9 01             	or     $0x1,%ecx
+  804bf4:	48 85 d2             	test   %rdx,%rdx
+  804bf7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804bfa:	89 c1                	mov    %eax,%ecx
+  804bfc:	83 c9 40             	or     $0x40,%ecx
+  804bff:	f6 c6 04             	test   $0x4,%dh
+  804c02:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804c05:	5d                   	pop    %rbp
+  804c06:	c3                   	ret
+
+0000000000804c07 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804c07:	55                   	push   %rbp
+  804c08:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c0b:	48 b8 0d 4b 80 00 00 	movabs $0x804b0d,%rax
+  804c12:	00 00 00 
+  804c15:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804c17:	48 c1 e8 06          	shr    $0x6,%rax
+  804c1b:	83 e0 01             	and    $0x1,%eax
+}
+  804c1e:	5d                   	pop    %rbp
+  804c1f:	c3                   	ret
+
+0000000000804c20 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804c20:	55                   	push   %rbp
+  804c21:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804c24:	48 b8 0d 4b 80 00 00 	movabs $0x804b0d,%rax
+  804c2b:	00 00 00 
+  804c2e:	ff d0                	call   *%rax
+  804c30:	83 e0 01             	and    $0x1,%eax
+}
+  804c33:	5d                   	pop    %rbp
+  804c34:	c3                   	ret
+
+0000000000804c35 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804c35:	55                   	push   %rbp
+  804c36:	48 89 e5             	mov    %rsp,%rbp
+  804c39:	41 57                	push   %r15
+  804c3b:	41 56                	push   %r14
+  804c3d:	41 55                	push   %r13
+  804c3f:	41 54                	push   %r12
+  804c41:	53                   	push   %rbx
+  804c42:	48 83 ec 28          	sub    $0x28,%rsp
+  804c46:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804c4a:	48 85 ff             	test   %rdi,%rdi
+  804c4d:	74 1e                	je     804c6d <foreach_shared_region+0x38>
+  804c4f:	49 89 ff             	mov    %rdi,%r15
+  804c52:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804c58:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804c5e:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804c65:	01 00 00 
+  804c68:	e9 72 02 00 00       	jmp    804edf <foreach_shared_region+0x2aa>
+    assert(fun);
+  804c6d:	48 b9 02 6d 80 00 00 	movabs $0x806d02,%rcx
+  804c74:	00 00 00 
+  804c77:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  804c7e:	00 00 00 
+  804c81:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804c86:	48 bf 06 6d 80 00 00 	movabs $0x806d06,%rdi
+  804c8d:	00 00 00 
+  804c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c95:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  804c9c:	00 00 00 
+  804c9f:	41 ff d0             	call   *%r8
+  804ca2:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804ca9:	eb 6c                	jmp    804d17 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804cab:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804cb2:	ff ff ff 
+  804cb5:	4c 21 e2             	and    %r12,%rdx
+  804cb8:	48 89 d8             	mov    %rbx,%rax
+  804cbb:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804cc0:	48 83 c0 01          	add    $0x1,%rax
+  804cc4:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804cc8:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804ccf:	00 00 00 
+  804cd2:	48 21 c8             	and    %rcx,%rax
+  804cd5:	48 09 d0             	or     %rdx,%rax
+  804cd8:	49 89 c4             	mov    %rax,%r12
+  804cdb:	eb 30                	jmp    804d0d <foreach_shared_region+0xd8>
+  804cdd:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804ce4:	ff ff ff 
+  804ce7:	4c 21 e2             	and    %r12,%rdx
+  804cea:	48 89 d8             	mov    %rbx,%rax
+  804ced:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804cf2:	48 83 c0 01          	add    $0x1,%rax
+  804cf6:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804cfa:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804d01:	00 00 00 
+  804d04:	48 21 c8             	and    %rcx,%rax
+  804d07:	48 09 d0             	or     %rdx,%rax
+  804d0a:	49 89 c4             	mov    %rax,%r12
+  804d0d:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804d11:	0f 84 99 01 00 00    	je     804eb0 <foreach_shared_region+0x27b>
+  804d17:	4c 89 e3             	mov    %r12,%rbx
+  804d1a:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804d1e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804d25:	01 00 00 
+  804d28:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804d2c:	a8 01                	test   $0x1,%al
+  804d2e:	0f 84 77 ff ff ff    	je     804cab <foreach_shared_region+0x76>
+  804d34:	a8 80                	test   $0x80,%al
+  804d36:	74 19                	je     804d51 <foreach_shared_region+0x11c>
+  804d38:	f6 c4 04             	test   $0x4,%ah
+  804d3b:	74 a0                	je     804cdd <foreach_shared_region+0xa8>
+  804d3d:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804d44:	40 
+  804d45:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d49:	4c 89 e7             	mov    %r12,%rdi
+  804d4c:	41 ff d7             	call   *%r15
+  804d4f:	eb 8c                	jmp    804cdd <foreach_shared_region+0xa8>
+  804d51:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804d58:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804d5c:	eb 46                	jmp    804da4 <foreach_shared_region+0x16f>
+  804d5e:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804d65:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804d6b:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804d6f:	48 c1 e0 15          	shl    $0x15,%rax
+  804d73:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804d78:	49 09 c4             	or     %rax,%r12
+  804d7b:	eb 1d                	jmp    804d9a <foreach_shared_region+0x165>
+  804d7d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804d84:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804d8a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804d8e:	48 c1 e0 15          	shl    $0x15,%rax
+  804d92:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804d97:	49 09 c4             	or     %rax,%r12
+  804d9a:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804d9e:	0f 84 d3 00 00 00    	je     804e77 <foreach_shared_region+0x242>
+  804da4:	4c 89 e3             	mov    %r12,%rbx
+  804da7:	48 c1 eb 15          	shr    $0x15,%rbx
+  804dab:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804db2:	01 00 00 
+  804db5:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804db9:	a8 01                	test   $0x1,%al
+  804dbb:	74 a1                	je     804d5e <foreach_shared_region+0x129>
+  804dbd:	a8 80                	test   $0x80,%al
+  804dbf:	74 19                	je     804dda <foreach_shared_region+0x1a5>
+  804dc1:	f6 c4 04             	test   $0x4,%ah
+  804dc4:	74 b7                	je     804d7d <foreach_shared_region+0x148>
+  804dc6:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804dcd:	00 
+  804dce:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804dd2:	4c 89 e7             	mov    %r12,%rdi
+  804dd5:	41 ff d7             	call   *%r15
+  804dd8:	eb a3                	jmp    804d7d <foreach_shared_region+0x148>
+  804dda:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804de0:	eb 3b                	jmp    804e1d <foreach_shared_region+0x1e8>
+  804de2:	f6 c4 04             	test   $0x4,%ah
+  804de5:	74 12                	je     804df9 <foreach_shared_region+0x1c4>
+  804de7:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804dee:	00 
+  804def:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804df3:	4c 89 e7             	mov    %r12,%rdi
+  804df6:	41 ff d7             	call   *%r15
+  804df9:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804e00:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804e06:	48 83 c3 01          	add    $0x1,%rbx
+  804e0a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804e0e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804e14:	49 09 dc             	or     %rbx,%r12
+  804e17:	41 83 ed 01          	sub    $0x1,%r13d
+  804e1b:	74 2f                	je     804e4c <foreach_shared_region+0x217>
+  804e1d:	4c 89 e3             	mov    %r12,%rbx
+  804e20:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804e24:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804e28:	a8 01                	test   $0x1,%al
+  804e2a:	75 b6                	jne    804de2 <foreach_shared_region+0x1ad>
+  804e2c:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804e33:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804e39:	48 83 c3 01          	add    $0x1,%rbx
+  804e3d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804e41:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804e47:	49 09 dc             	or     %rbx,%r12
+  804e4a:	eb cb                	jmp    804e17 <foreach_shared_region+0x1e2>
+  804e4c:	4c 89 e0             	mov    %r12,%rax
+  804e4f:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804e55:	49 c1 ec 15          	shr    $0x15,%r12
+  804e59:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804e60:	49 83 c4 01          	add    $0x1,%r12
+  804e64:	49 c1 e4 15          	shl    $0x15,%r12
+  804e68:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804e6f:	49 09 c4             	or     %rax,%r12
+  804e72:	e9 23 ff ff ff       	jmp    804d9a <foreach_shared_region+0x165>
+  804e77:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804e7b:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804e82:	ff ff ff 
+  804e85:	4c 21 e0             	and    %r12,%rax
+  804e88:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804e8c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804e93:	49 83 c4 01          	add    $0x1,%r12
+  804e97:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804e9b:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804ea2:	00 00 00 
+  804ea5:	49 21 d4             	and    %rdx,%r12
+  804ea8:	49 09 c4             	or     %rax,%r12
+  804eab:	e9 5d fe ff ff       	jmp    804d0d <foreach_shared_region+0xd8>
+  804eb0:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804eb7:	00 ff ff 
+  804eba:	4c 21 e0             	and    %r12,%rax
+  804ebd:	49 c1 ec 27          	shr    $0x27,%r12
+  804ec1:	49 83 c4 01          	add    $0x1,%r12
+  804ec5:	49 c1 e4 27          	shl    $0x27,%r12
+  804ec9:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804ed0:	ff 00 00 
+  804ed3:	49 21 d4             	and    %rdx,%r12
+  804ed6:	49 09 c4             	or     %rax,%r12
+  804ed9:	41 83 ed 01          	sub    $0x1,%r13d
+  804edd:	74 48                	je     804f27 <foreach_shared_region+0x2f2>
+  804edf:	4c 89 e0             	mov    %r12,%rax
+  804ee2:	48 c1 e8 27          	shr    $0x27,%rax
+  804ee6:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804eed:	01 00 00 
+  804ef0:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804ef4:	f6 c2 01             	test   $0x1,%dl
+  804ef7:	0f 85 a5 fd ff ff    	jne    804ca2 <foreach_shared_region+0x6d>
+  804efd:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804f04:	00 ff ff 
+  804f07:	4c 21 e2             	and    %r12,%rdx
+  804f0a:	48 83 c0 01          	add    $0x1,%rax
+  804f0e:	48 c1 e0 27          	shl    $0x27,%rax
+  804f12:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804f19:	ff 00 00 
+  804f1c:	48 21 c8             	and    %rcx,%rax
+  804f1f:	48 09 d0             	or     %rdx,%rax
+  804f22:	49 89 c4             	mov    %rax,%r12
+  804f25:	eb b2                	jmp    804ed9 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804f27:	4d 85 e4             	test   %r12,%r12
+  804f2a:	75 14                	jne    804f40 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f31:	48 83 c4 28          	add    $0x28,%rsp
+  804f35:	5b                   	pop    %rbx
+  804f36:	41 5c                	pop    %r12
+  804f38:	41 5d                	pop    %r13
+  804f3a:	41 5e                	pop    %r14
+  804f3c:	41 5f                	pop    %r15
+  804f3e:	5d                   	pop    %rbp
+  804f3f:	c3                   	ret
+    assert(addr == 0);
+  804f40:	48 b9 11 6d 80 00 00 	movabs $0x806d11,%rcx
+  804f47:	00 00 00 
+  804f4a:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  804f51:	00 00 00 
+  804f54:	be 67 00 00 00       	mov    $0x67,%esi
+  804f59:	48 bf 06 6d 80 00 00 	movabs $0x806d06,%rdi
+  804f60:	00 00 00 
+  804f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f68:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  804f6f:	00 00 00 
+  804f72:	41 ff d0             	call   *%r8
+
+0000000000804f75 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804f75:	49 b8 20 b4 80 01 00 	movabs $0x180b420,%r8
+  804f7c:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804f7f:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804f85:	eb 33                	jmp    804fba <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f87:	48 83 c0 20          	add    $0x20,%rax
+  804f8b:	4c 39 c0             	cmp    %r8,%rax
+  804f8e:	74 25                	je     804fb5 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804f90:	48 8b 10             	mov    (%rax),%rdx
+  804f93:	48 85 d2             	test   %rdx,%rdx
+  804f96:	74 ef                	je     804f87 <mmap_place+0x12>
+  804f98:	48 89 d1             	mov    %rdx,%rcx
+  804f9b:	48 03 48 08          	add    0x8(%rax),%rcx
+  804f9f:	48 39 cf             	cmp    %rcx,%rdi
+  804fa2:	73 e3                	jae    804f87 <mmap_place+0x12>
+  804fa4:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804fa8:	4c 39 ca             	cmp    %r9,%rdx
+  804fab:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804faf:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804fb3:	eb d2                	jmp    804f87 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804fb5:	45 84 d2             	test   %r10b,%r10b
+  804fb8:	74 12                	je     804fcc <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fba:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  804fc1:	00 00 00 
+        moved = 0;
+  804fc4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804fca:	eb c4                	jmp    804f90 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804fcc:	48 01 fe             	add    %rdi,%rsi
+  804fcf:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804fd6:	00 00 00 
+  804fd9:	48 39 f0             	cmp    %rsi,%rax
+  804fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe1:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804fe5:	c3                   	ret
+
+0000000000804fe6 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804fe6:	55                   	push   %rbp
+  804fe7:	48 89 e5             	mov    %rsp,%rbp
+  804fea:	41 57                	push   %r15
+  804fec:	41 56                	push   %r14
+  804fee:	41 55                	push   %r13
+  804ff0:	41 54                	push   %r12
+  804ff2:	53                   	push   %rbx
+  804ff3:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804ff7:	48 8b 1f             	mov    (%rdi),%rbx
+  804ffa:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805001:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805008:	00 00 00 
+  80500b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805010:	eb 12                	jmp    805024 <mmap_pgfault+0x3e>
+  805012:	48 83 c2 01          	add    $0x1,%rdx
+  805016:	48 83 c0 20          	add    $0x20,%rax
+  80501a:	48 83 fa 20          	cmp    $0x20,%rdx
+  80501e:	0f 84 04 01 00 00    	je     805128 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  805024:	48 8b 08             	mov    (%rax),%rcx
+  805027:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80502b:	48 39 de             	cmp    %rbx,%rsi
+  80502e:	73 e2                	jae    805012 <mmap_pgfault+0x2c>
+  805030:	48 03 48 08          	add    0x8(%rax),%rcx
+  805034:	48 39 cb             	cmp    %rcx,%rbx
+  805037:	73 d9                	jae    805012 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  805039:	48 c1 e2 05          	shl    $0x5,%rdx
+  80503d:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805044:	00 00 00 
+  805047:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80504b:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80504f:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  805053:	f6 c2 01             	test   $0x1,%dl
+  805056:	0f 84 e0 00 00 00    	je     80513c <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80505c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805061:	f6 c2 02             	test   $0x2,%dl
+  805064:	0f 84 c3 00 00 00    	je     80512d <mmap_pgfault+0x147>
+  80506a:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805071:	ff ff ff 
+  805074:	48 23 56 10          	and    0x10(%rsi),%rdx
+  805078:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80507f:	00 00 00 
+  805082:	48 39 ca             	cmp    %rcx,%rdx
+  805085:	0f 85 a2 00 00 00    	jne    80512d <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80508b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805090:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805095:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80509c:	00 00 00 
+  80509f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050a4:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  8050ab:	00 00 00 
+  8050ae:	ff d0                	call   *%rax
+  8050b0:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8050b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050b7:	85 d2                	test   %edx,%edx
+  8050b9:	78 72                	js     80512d <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8050bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050c0:	48 89 de             	mov    %rbx,%rsi
+  8050c3:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8050ca:	00 00 00 
+  8050cd:	4c 89 e7             	mov    %r12,%rdi
+  8050d0:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  8050d7:	00 00 00 
+  8050da:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8050dc:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8050e2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8050e8:	48 89 d9             	mov    %rbx,%rcx
+  8050eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050f0:	4c 89 e6             	mov    %r12,%rsi
+  8050f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050f8:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  8050ff:	00 00 00 
+  805102:	ff d0                	call   *%rax
+  805104:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  805106:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80510b:	4c 89 e6             	mov    %r12,%rsi
+  80510e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805113:	48 b8 a2 2e 80 00 00 	movabs $0x802ea2,%rax
+  80511a:	00 00 00 
+  80511d:	ff d0                	call   *%rax
+    return res >= 0;
+  80511f:	89 d8                	mov    %ebx,%eax
+  805121:	f7 d0                	not    %eax
+  805123:	c1 e8 1f             	shr    $0x1f,%eax
+  805126:	eb 05                	jmp    80512d <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  805128:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80512d:	48 83 c4 18          	add    $0x18,%rsp
+  805131:	5b                   	pop    %rbx
+  805132:	41 5c                	pop    %r12
+  805134:	41 5d                	pop    %r13
+  805136:	41 5e                	pop    %r14
+  805138:	41 5f                	pop    %r15
+  80513a:	5d                   	pop    %rbp
+  80513b:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80513c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805140:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  805144:	4c 03 30             	add    (%rax),%r14
+  805147:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80514e:	49 39 c6             	cmp    %rax,%r14
+  805151:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805155:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80515c:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805162:	49 bf 20 4c 80 00 00 	movabs $0x804c20,%r15
+  805169:	00 00 00 
+  80516c:	4d 39 f4             	cmp    %r14,%r12
+  80516f:	73 1d                	jae    80518e <mmap_pgfault+0x1a8>
+  805171:	4c 89 e7             	mov    %r12,%rdi
+  805174:	41 ff d7             	call   *%r15
+  805177:	84 c0                	test   %al,%al
+  805179:	75 13                	jne    80518e <mmap_pgfault+0x1a8>
+  80517b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805182:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  805189:	4d 39 f4             	cmp    %r14,%r12
+  80518c:	72 e3                	jb     805171 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80518e:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  805194:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805198:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80519c:	74 2a                	je     8051c8 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80519e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051a2:	89 de                	mov    %ebx,%esi
+  8051a4:	2b 30                	sub    (%rax),%esi
+  8051a6:	03 70 1c             	add    0x1c(%rax),%esi
+  8051a9:	8b 78 18             	mov    0x18(%rax),%edi
+  8051ac:	4c 89 e9             	mov    %r13,%rcx
+  8051af:	48 89 da             	mov    %rbx,%rdx
+  8051b2:	48 b8 c5 42 80 00 00 	movabs $0x8042c5,%rax
+  8051b9:	00 00 00 
+  8051bc:	ff d0                	call   *%rax
+    return res > 0;
+  8051be:	85 c0                	test   %eax,%eax
+  8051c0:	0f 9f c0             	setg   %al
+  8051c3:	e9 65 ff ff ff       	jmp    80512d <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8051c8:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8051cc:	eb d0                	jmp    80519e <mmap_pgfault+0x1b8>
+
+00000000008051ce <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8051ce:	55                   	push   %rbp
+  8051cf:	48 89 e5             	mov    %rsp,%rbp
+  8051d2:	41 57                	push   %r15
+  8051d4:	41 56                	push   %r14
+  8051d6:	41 55                	push   %r13
+  8051d8:	41 54                	push   %r12
+  8051da:	53                   	push   %rbx
+  8051db:	48 83 ec 28          	sub    $0x28,%rsp
+  8051df:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8051e3:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8051e6:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8051ed:	ff ff ff 
+  8051f0:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8051f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f9:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  805200:	00 00 00 
+  805203:	48 39 ca             	cmp    %rcx,%rdx
+  805206:	0f 85 e5 00 00 00    	jne    8052f1 <mmap_writeback+0x123>
+  80520c:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80520f:	4c 39 ee             	cmp    %r13,%rsi
+  805212:	0f 83 e8 00 00 00    	jae    805300 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805218:	49 be 20 4c 80 00 00 	movabs $0x804c20,%r14
+  80521f:	00 00 00 
+  805222:	49 bf 07 4c 80 00 00 	movabs $0x804c07,%r15
+  805229:	00 00 00 
+  80522c:	eb 10                	jmp    80523e <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80522e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  805235:	4d 39 ec             	cmp    %r13,%r12
+  805238:	0f 83 ae 00 00 00    	jae    8052ec <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80523e:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805242:	4c 89 e7             	mov    %r12,%rdi
+  805245:	41 ff d6             	call   *%r14
+  805248:	84 c0                	test   %al,%al
+  80524a:	74 e2                	je     80522e <mmap_writeback+0x60>
+  80524c:	4c 89 e7             	mov    %r12,%rdi
+  80524f:	41 ff d7             	call   *%r15
+  805252:	84 c0                	test   %al,%al
+  805254:	74 d8                	je     80522e <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  805256:	4c 89 e3             	mov    %r12,%rbx
+  805259:	4d 39 ec             	cmp    %r13,%r12
+  80525c:	73 20                	jae    80527e <mmap_writeback+0xb0>
+  80525e:	48 89 df             	mov    %rbx,%rdi
+  805261:	41 ff d6             	call   *%r14
+  805264:	84 c0                	test   %al,%al
+  805266:	74 16                	je     80527e <mmap_writeback+0xb0>
+  805268:	48 89 df             	mov    %rbx,%rdi
+  80526b:	41 ff d7             	call   *%r15
+  80526e:	84 c0                	test   %al,%al
+  805270:	74 0c                	je     80527e <mmap_writeback+0xb0>
+  805272:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805279:	4c 39 eb             	cmp    %r13,%rbx
+  80527c:	72 e0                	jb     80525e <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80527e:	48 89 d9             	mov    %rbx,%rcx
+  805281:	4c 29 e1             	sub    %r12,%rcx
+  805284:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805288:	44 89 e6             	mov    %r12d,%esi
+  80528b:	2b 30                	sub    (%rax),%esi
+  80528d:	49 89 c4             	mov    %rax,%r12
+  805290:	03 70 1c             	add    0x1c(%rax),%esi
+  805293:	8b 78 18             	mov    0x18(%rax),%edi
+  805296:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80529a:	48 89 ca             	mov    %rcx,%rdx
+  80529d:	48 b8 4e 43 80 00 00 	movabs $0x80434e,%rax
+  8052a4:	00 00 00 
+  8052a7:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8052a9:	85 c0                	test   %eax,%eax
+  8052ab:	78 44                	js     8052f1 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8052ad:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8052b2:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8052b5:	41 89 c1             	mov    %eax,%r9d
+  8052b8:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8052bf:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8052c3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8052c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052cc:	48 89 ce             	mov    %rcx,%rsi
+  8052cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052d4:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  8052db:	00 00 00 
+  8052de:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8052e0:	85 c0                	test   %eax,%eax
+  8052e2:	78 0d                	js     8052f1 <mmap_writeback+0x123>
+  8052e4:	49 89 dc             	mov    %rbx,%r12
+  8052e7:	e9 49 ff ff ff       	jmp    805235 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8052ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052f1:	48 83 c4 28          	add    $0x28,%rsp
+  8052f5:	5b                   	pop    %rbx
+  8052f6:	41 5c                	pop    %r12
+  8052f8:	41 5d                	pop    %r13
+  8052fa:	41 5e                	pop    %r14
+  8052fc:	41 5f                	pop    %r15
+  8052fe:	5d                   	pop    %rbp
+  8052ff:	c3                   	ret
+    return 0;
+  805300:	b8 00 00 00 00       	mov    $0x0,%eax
+  805305:	eb ea                	jmp    8052f1 <mmap_writeback+0x123>
+
+0000000000805307 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805307:	55                   	push   %rbp
+  805308:	48 89 e5             	mov    %rsp,%rbp
+  80530b:	41 57                	push   %r15
+  80530d:	41 56                	push   %r14
+  80530f:	41 55                	push   %r13
+  805311:	41 54                	push   %r12
+  805313:	53                   	push   %rbx
+  805314:	48 83 ec 38          	sub    $0x38,%rsp
+  805318:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80531c:	48 85 f6             	test   %rsi,%rsi
+  80531f:	0f 84 0c 02 00 00    	je     805531 <mmap+0x22a>
+  805325:	49 89 ff             	mov    %rdi,%r15
+  805328:	49 89 f4             	mov    %rsi,%r12
+  80532b:	41 89 d5             	mov    %edx,%r13d
+  80532e:	41 89 ce             	mov    %ecx,%r14d
+  805331:	44 89 cb             	mov    %r9d,%ebx
+  805334:	45 85 c9             	test   %r9d,%r9d
+  805337:	0f 88 f4 01 00 00    	js     805531 <mmap+0x22a>
+  80533d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805344:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80534b:	0f 85 e7 01 00 00    	jne    805538 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805351:	83 e2 fd             	and    $0xfffffffd,%edx
+  805354:	83 fa 04             	cmp    $0x4,%edx
+  805357:	0f 85 db 01 00 00    	jne    805538 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  80535d:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805360:	83 fa 01             	cmp    $0x1,%edx
+  805363:	0f 87 cf 01 00 00    	ja     805538 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805369:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80536d:	44 89 c7             	mov    %r8d,%edi
+  805370:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  805377:	00 00 00 
+  80537a:	ff d0                	call   *%rax
+  80537c:	89 c2                	mov    %eax,%edx
+  80537e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805385:	85 d2                	test   %edx,%edx
+  805387:	0f 88 ab 01 00 00    	js     805538 <mmap+0x231>
+  80538d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805391:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  805398:	00 00 00 
+  80539b:	8b 09                	mov    (%rcx),%ecx
+  80539d:	39 0a                	cmp    %ecx,(%rdx)
+  80539f:	0f 85 93 01 00 00    	jne    805538 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8053a5:	8b 52 08             	mov    0x8(%rdx),%edx
+  8053a8:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8053ab:	83 fa 01             	cmp    $0x1,%edx
+  8053ae:	0f 84 84 01 00 00    	je     805538 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8053b4:	41 83 fe 01          	cmp    $0x1,%r14d
+  8053b8:	74 42                	je     8053fc <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8053ba:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8053c1:	4c 89 e6             	mov    %r12,%rsi
+  8053c4:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8053cb:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8053cf:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8053d3:	4d 85 ff             	test   %r15,%r15
+  8053d6:	74 67                	je     80543f <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8053d8:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8053df:	75 0f                	jne    8053f0 <mmap+0xe9>
+  8053e1:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8053e8:	00 00 00 
+  8053eb:	49 39 c7             	cmp    %rax,%r15
+  8053ee:	77 1b                	ja     80540b <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8053f0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8053f7:	e9 3c 01 00 00       	jmp    805538 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8053fc:	41 f6 c5 02          	test   $0x2,%r13b
+  805400:	74 b8                	je     8053ba <mmap+0xb3>
+  805402:	85 d2                	test   %edx,%edx
+  805404:	75 b4                	jne    8053ba <mmap+0xb3>
+  805406:	e9 2d 01 00 00       	jmp    805538 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80540b:	4c 89 ff             	mov    %r15,%rdi
+  80540e:	48 b8 75 4f 80 00 00 	movabs $0x804f75,%rax
+  805415:	00 00 00 
+  805418:	ff d0                	call   *%rax
+  80541a:	48 89 c2             	mov    %rax,%rdx
+  80541d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805424:	49 39 d7             	cmp    %rdx,%r15
+  805427:	0f 85 0b 01 00 00    	jne    805538 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80542d:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805434:	00 00 00 
+  805437:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80543d:	eb 44                	jmp    805483 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80543f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805443:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  80544a:	00 00 00 
+  80544d:	48 b8 75 4f 80 00 00 	movabs $0x804f75,%rax
+  805454:	00 00 00 
+  805457:	ff d0                	call   *%rax
+  805459:	48 89 c7             	mov    %rax,%rdi
+  80545c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805460:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805467:	48 85 ff             	test   %rdi,%rdi
+  80546a:	75 c1                	jne    80542d <mmap+0x126>
+  80546c:	e9 c7 00 00 00       	jmp    805538 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805471:	49 83 c4 01          	add    $0x1,%r12
+  805475:	48 83 c0 20          	add    $0x20,%rax
+  805479:	49 83 fc 20          	cmp    $0x20,%r12
+  80547d:	0f 84 a5 00 00 00    	je     805528 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805483:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805487:	75 e8                	jne    805471 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805489:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80548d:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  805494:	00 00 00 
+  805497:	ff d0                	call   *%rax
+  805499:	89 c2                	mov    %eax,%edx
+  80549b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8054a2:	85 d2                	test   %edx,%edx
+  8054a4:	0f 88 8e 00 00 00    	js     805538 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8054aa:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8054ae:	48 b8 da 35 80 00 00 	movabs $0x8035da,%rax
+  8054b5:	00 00 00 
+  8054b8:	ff d0                	call   *%rax
+  8054ba:	89 c6                	mov    %eax,%esi
+  8054bc:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8054bf:	48 b8 28 38 80 00 00 	movabs $0x803828,%rax
+  8054c6:	00 00 00 
+  8054c9:	ff d0                	call   *%rax
+  8054cb:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8054ce:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8054d5:	45 85 ff             	test   %r15d,%r15d
+  8054d8:	78 5e                	js     805538 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8054da:	49 c1 e4 05          	shl    $0x5,%r12
+  8054de:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  8054e5:	00 00 00 
+  8054e8:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8054eb:	48 bf e6 4f 80 00 00 	movabs $0x804fe6,%rdi
+  8054f2:	00 00 00 
+  8054f5:	48 b8 11 5a 80 00 00 	movabs $0x805a11,%rax
+  8054fc:	00 00 00 
+  8054ff:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805501:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805505:	49 89 04 24          	mov    %rax,(%r12)
+  805509:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80550d:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805512:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805517:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80551c:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805521:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805526:	eb 10                	jmp    805538 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805528:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80552f:	eb 07                	jmp    805538 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805531:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805538:	48 83 c4 38          	add    $0x38,%rsp
+  80553c:	5b                   	pop    %rbx
+  80553d:	41 5c                	pop    %r12
+  80553f:	41 5d                	pop    %r13
+  805541:	41 5e                	pop    %r14
+  805543:	41 5f                	pop    %r15
+  805545:	5d                   	pop    %rbp
+  805546:	c3                   	ret
+
+0000000000805547 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805547:	55                   	push   %rbp
+  805548:	48 89 e5             	mov    %rsp,%rbp
+  80554b:	41 57                	push   %r15
+  80554d:	41 56                	push   %r14
+  80554f:	41 55                	push   %r13
+  805551:	41 54                	push   %r12
+  805553:	53                   	push   %rbx
+  805554:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805558:	49 89 fe             	mov    %rdi,%r14
+  80555b:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805562:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805569:	00 
+  80556a:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805571:	48 bb 20 b0 80 01 00 	movabs $0x180b020,%rbx
+  805578:	00 00 00 
+  80557b:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805582:	49 bf ce 51 80 00 00 	movabs $0x8051ce,%r15
+  805589:	00 00 00 
+  80558c:	eb 09                	jmp    805597 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80558e:	48 83 c3 20          	add    $0x20,%rbx
+  805592:	4c 39 eb             	cmp    %r13,%rbx
+  805595:	74 33                	je     8055ca <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805597:	48 89 df             	mov    %rbx,%rdi
+  80559a:	48 8b 33             	mov    (%rbx),%rsi
+  80559d:	4c 39 e6             	cmp    %r12,%rsi
+  8055a0:	73 ec                	jae    80558e <msync+0x47>
+  8055a2:	48 85 f6             	test   %rsi,%rsi
+  8055a5:	74 e7                	je     80558e <msync+0x47>
+  8055a7:	48 89 f2             	mov    %rsi,%rdx
+  8055aa:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8055ae:	49 39 d6             	cmp    %rdx,%r14
+  8055b1:	73 db                	jae    80558e <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8055b3:	4c 39 e2             	cmp    %r12,%rdx
+  8055b6:	49 0f 47 d4          	cmova  %r12,%rdx
+  8055ba:	4c 39 f6             	cmp    %r14,%rsi
+  8055bd:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8055c1:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8055c4:	85 c0                	test   %eax,%eax
+  8055c6:	79 c6                	jns    80558e <msync+0x47>
+  8055c8:	eb 05                	jmp    8055cf <msync+0x88>
+    }
+
+    return 0;
+  8055ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055cf:	48 83 c4 08          	add    $0x8,%rsp
+  8055d3:	5b                   	pop    %rbx
+  8055d4:	41 5c                	pop    %r12
+  8055d6:	41 5d                	pop    %r13
+  8055d8:	41 5e                	pop    %r14
+  8055da:	41 5f                	pop    %r15
+  8055dc:	5d                   	pop    %rbp
+  8055dd:	c3                   	ret
+
+00000000008055de <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8055de:	55                   	push   %rbp
+  8055df:	48 89 e5             	mov    %rsp,%rbp
+  8055e2:	41 57                	push   %r15
+  8055e4:	41 56                	push   %r14
+  8055e6:	41 55                	push   %r13
+  8055e8:	41 54                	push   %r12
+  8055ea:	53                   	push   %rbx
+  8055eb:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8055ef:	49 89 ff             	mov    %rdi,%r15
+  8055f2:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8055f9:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805600:	00 
+  805601:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805608:	48 bb 20 b0 80 01 00 	movabs $0x180b020,%rbx
+  80560f:	00 00 00 
+  805612:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805619:	48 89 d8             	mov    %rbx,%rax
+  80561c:	eb 09                	jmp    805627 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80561e:	48 83 c0 20          	add    $0x20,%rax
+  805622:	4c 39 f0             	cmp    %r14,%rax
+  805625:	74 40                	je     805667 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805627:	48 8b 10             	mov    (%rax),%rdx
+  80562a:	4c 39 e2             	cmp    %r12,%rdx
+  80562d:	73 ef                	jae    80561e <munmap+0x40>
+  80562f:	48 85 d2             	test   %rdx,%rdx
+  805632:	74 ea                	je     80561e <munmap+0x40>
+  805634:	48 89 d7             	mov    %rdx,%rdi
+  805637:	48 03 78 08          	add    0x8(%rax),%rdi
+  80563b:	49 39 ff             	cmp    %rdi,%r15
+  80563e:	73 de                	jae    80561e <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805640:	49 39 fc             	cmp    %rdi,%r12
+  805643:	72 05                	jb     80564a <munmap+0x6c>
+  805645:	4c 39 fa             	cmp    %r15,%rdx
+  805648:	73 d4                	jae    80561e <munmap+0x40>
+  80564a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80564f:	48 83 c4 08          	add    $0x8,%rsp
+  805653:	5b                   	pop    %rbx
+  805654:	41 5c                	pop    %r12
+  805656:	41 5d                	pop    %r13
+  805658:	41 5e                	pop    %r14
+  80565a:	41 5f                	pop    %r15
+  80565c:	5d                   	pop    %rbp
+  80565d:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80565e:	48 83 c3 20          	add    $0x20,%rbx
+  805662:	4c 39 f3             	cmp    %r14,%rbx
+  805665:	74 5c                	je     8056c3 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805667:	48 8b 33             	mov    (%rbx),%rsi
+  80566a:	4c 39 e6             	cmp    %r12,%rsi
+  80566d:	73 ef                	jae    80565e <munmap+0x80>
+  80566f:	48 85 f6             	test   %rsi,%rsi
+  805672:	74 ea                	je     80565e <munmap+0x80>
+  805674:	48 89 f2             	mov    %rsi,%rdx
+  805677:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80567b:	49 39 d7             	cmp    %rdx,%r15
+  80567e:	73 de                	jae    80565e <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805680:	48 89 df             	mov    %rbx,%rdi
+  805683:	48 b8 ce 51 80 00 00 	movabs $0x8051ce,%rax
+  80568a:	00 00 00 
+  80568d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80568f:	85 c0                	test   %eax,%eax
+  805691:	78 bc                	js     80564f <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805693:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805697:	48 8b 33             	mov    (%rbx),%rsi
+  80569a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80569f:	48 b8 a2 2e 80 00 00 	movabs $0x802ea2,%rax
+  8056a6:	00 00 00 
+  8056a9:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8056ab:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8056ae:	48 b8 cd 37 80 00 00 	movabs $0x8037cd,%rax
+  8056b5:	00 00 00 
+  8056b8:	ff d0                	call   *%rax
+        reg->start = 0;
+  8056ba:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8056c1:	eb 9b                	jmp    80565e <munmap+0x80>
+    return 0;
+  8056c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056c8:	eb 85                	jmp    80564f <munmap+0x71>
+
+00000000008056ca <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8056ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056cf:	c3                   	ret
+
+00000000008056d0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8056d0:	55                   	push   %rbp
+  8056d1:	48 89 e5             	mov    %rsp,%rbp
+  8056d4:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8056d7:	48 be 1b 6d 80 00 00 	movabs $0x806d1b,%rsi
+  8056de:	00 00 00 
+  8056e1:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  8056e8:	00 00 00 
+  8056eb:	ff d0                	call   *%rax
+    return 0;
+}
+  8056ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056f2:	5d                   	pop    %rbp
+  8056f3:	c3                   	ret
+
+00000000008056f4 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8056f4:	55                   	push   %rbp
+  8056f5:	48 89 e5             	mov    %rsp,%rbp
+  8056f8:	41 57                	push   %r15
+  8056fa:	41 56                	push   %r14
+  8056fc:	41 55                	push   %r13
+  8056fe:	41 54                	push   %r12
+  805700:	53                   	push   %rbx
+  805701:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805708:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80570f:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805716:	00 00 00 00 
+  80571a:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805721:	00 00 00 00 
+  805725:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80572c:	00 00 00 00 
+  805730:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805737:	00 00 00 00 
+  80573b:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805742:	00 00 00 00 
+  805746:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  80574d:	00 00 00 00 
+  805751:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805758:	00 
+  805759:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805760:	00 
+  805761:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805768:	00 
+  805769:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805770:	00 
+  805771:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805778:	00 
+  805779:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805780:	00 
+  805781:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805788:	00 
+  805789:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805790:	00 
+  805791:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805798:	00 
+  805799:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8057a0:	00 
+    for (res = 0; res < n; res += inc) {
+  8057a1:	48 85 d2             	test   %rdx,%rdx
+  8057a4:	74 7a                	je     805820 <devcons_write+0x12c>
+  8057a6:	49 89 d6             	mov    %rdx,%r14
+  8057a9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8057af:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8057b4:	49 bf b5 29 80 00 00 	movabs $0x8029b5,%r15
+  8057bb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8057be:	4c 89 f3             	mov    %r14,%rbx
+  8057c1:	48 29 f3             	sub    %rsi,%rbx
+  8057c4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8057c9:	48 39 c3             	cmp    %rax,%rbx
+  8057cc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8057d0:	4c 63 eb             	movslq %ebx,%r13
+  8057d3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8057da:	48 01 c6             	add    %rax,%rsi
+  8057dd:	4c 89 ea             	mov    %r13,%rdx
+  8057e0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8057e7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8057ea:	4c 89 ee             	mov    %r13,%rsi
+  8057ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8057f4:	48 b8 e2 2b 80 00 00 	movabs $0x802be2,%rax
+  8057fb:	00 00 00 
+  8057fe:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805800:	41 01 dc             	add    %ebx,%r12d
+  805803:	49 63 f4             	movslq %r12d,%rsi
+  805806:	4c 39 f6             	cmp    %r14,%rsi
+  805809:	72 b3                	jb     8057be <devcons_write+0xca>
+    return res;
+  80580b:	49 63 c4             	movslq %r12d,%rax
+}
+  80580e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805815:	5b                   	pop    %rbx
+  805816:	41 5c                	pop    %r12
+  805818:	41 5d                	pop    %r13
+  80581a:	41 5e                	pop    %r14
+  80581c:	41 5f                	pop    %r15
+  80581e:	5d                   	pop    %rbp
+  80581f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805820:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805826:	eb e3                	jmp    80580b <devcons_write+0x117>
+
+0000000000805828 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805828:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80582b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805830:	48 85 c0             	test   %rax,%rax
+  805833:	74 55                	je     80588a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805835:	55                   	push   %rbp
+  805836:	48 89 e5             	mov    %rsp,%rbp
+  805839:	41 55                	push   %r13
+  80583b:	41 54                	push   %r12
+  80583d:	53                   	push   %rbx
+  80583e:	48 83 ec 08          	sub    $0x8,%rsp
+  805842:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805845:	48 bb 15 2c 80 00 00 	movabs $0x802c15,%rbx
+  80584c:	00 00 00 
+  80584f:	49 bc 29 2d 80 00 00 	movabs $0x802d29,%r12
+  805856:	00 00 00 
+  805859:	eb 03                	jmp    80585e <devcons_read+0x36>
+  80585b:	41 ff d4             	call   *%r12
+  80585e:	ff d3                	call   *%rbx
+  805860:	85 c0                	test   %eax,%eax
+  805862:	74 f7                	je     80585b <devcons_read+0x33>
+    if (c < 0) return c;
+  805864:	48 63 d0             	movslq %eax,%rdx
+  805867:	78 13                	js     80587c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805869:	ba 00 00 00 00       	mov    $0x0,%edx
+  80586e:	83 f8 04             	cmp    $0x4,%eax
+  805871:	74 09                	je     80587c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805873:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805877:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80587c:	48 89 d0             	mov    %rdx,%rax
+  80587f:	48 83 c4 08          	add    $0x8,%rsp
+  805883:	5b                   	pop    %rbx
+  805884:	41 5c                	pop    %r12
+  805886:	41 5d                	pop    %r13
+  805888:	5d                   	pop    %rbp
+  805889:	c3                   	ret
+  80588a:	48 89 d0             	mov    %rdx,%rax
+  80588d:	c3                   	ret
+
+000000000080588e <cputchar>:
+cputchar(int ch) {
+  80588e:	55                   	push   %rbp
+  80588f:	48 89 e5             	mov    %rsp,%rbp
+  805892:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805896:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80589a:	be 01 00 00 00       	mov    $0x1,%esi
+  80589f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8058a3:	48 b8 e2 2b 80 00 00 	movabs $0x802be2,%rax
+  8058aa:	00 00 00 
+  8058ad:	ff d0                	call   *%rax
+}
+  8058af:	c9                   	leave
+  8058b0:	c3                   	ret
+
+00000000008058b1 <getchar>:
+getchar(void) {
+  8058b1:	55                   	push   %rbp
+  8058b2:	48 89 e5             	mov    %rsp,%rbp
+  8058b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8058b9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8058be:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8058c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058c7:	48 b8 4b 39 80 00 00 	movabs $0x80394b,%rax
+  8058ce:	00 00 00 
+  8058d1:	ff d0                	call   *%rax
+  8058d3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8058d5:	85 c0                	test   %eax,%eax
+  8058d7:	78 06                	js     8058df <getchar+0x2e>
+  8058d9:	74 08                	je     8058e3 <getchar+0x32>
+  8058db:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8058df:	89 d0                	mov    %edx,%eax
+  8058e1:	c9                   	leave
+  8058e2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8058e3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8058e8:	eb f5                	jmp    8058df <getchar+0x2e>
+
+00000000008058ea <iscons>:
+iscons(int fdnum) {
+  8058ea:	55                   	push   %rbp
+  8058eb:	48 89 e5             	mov    %rsp,%rbp
+  8058ee:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8058f2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8058f6:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  8058fd:	00 00 00 
+  805900:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805902:	85 c0                	test   %eax,%eax
+  805904:	78 18                	js     80591e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805906:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80590a:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805911:	00 00 00 
+  805914:	8b 00                	mov    (%rax),%eax
+  805916:	39 02                	cmp    %eax,(%rdx)
+  805918:	0f 94 c0             	sete   %al
+  80591b:	0f b6 c0             	movzbl %al,%eax
+}
+  80591e:	c9                   	leave
+  80591f:	c3                   	ret
+
+0000000000805920 <opencons>:
+opencons(void) {
+  805920:	55                   	push   %rbp
+  805921:	48 89 e5             	mov    %rsp,%rbp
+  805924:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805928:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80592c:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  805933:	00 00 00 
+  805936:	ff d0                	call   *%rax
+  805938:	85 c0                	test   %eax,%eax
+  80593a:	78 49                	js     805985 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80593c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805941:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805946:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80594a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80594f:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  805956:	00 00 00 
+  805959:	ff d0                	call   *%rax
+  80595b:	85 c0                	test   %eax,%eax
+  80595d:	78 26                	js     805985 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80595f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805963:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80596a:	00 00 
+  80596c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80596e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805972:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805979:	48 b8 da 35 80 00 00 	movabs $0x8035da,%rax
+  805980:	00 00 00 
+  805983:	ff d0                	call   *%rax
+}
+  805985:	c9                   	leave
+  805986:	c3                   	ret
+
+0000000000805987 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805987:	55                   	push   %rbp
+  805988:	48 89 e5             	mov    %rsp,%rbp
+  80598b:	41 56                	push   %r14
+  80598d:	41 55                	push   %r13
+  80598f:	41 54                	push   %r12
+  805991:	53                   	push   %rbx
+  805992:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805995:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  80599c:	00 00 00 
+  80599f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8059a3:	74 27                	je     8059cc <_handle_vectored_pagefault+0x45>
+  8059a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8059aa:	49 bd 20 b4 80 01 00 	movabs $0x180b420,%r13
+  8059b1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8059b4:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8059b7:	4c 89 e7             	mov    %r12,%rdi
+  8059ba:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8059bf:	84 c0                	test   %al,%al
+  8059c1:	75 45                	jne    805a08 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8059c3:	48 83 c3 01          	add    $0x1,%rbx
+  8059c7:	49 3b 1e             	cmp    (%r14),%rbx
+  8059ca:	72 eb                	jb     8059b7 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8059cc:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8059d3:	00 
+  8059d4:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8059d9:	4d 8b 04 24          	mov    (%r12),%r8
+  8059dd:	48 ba 28 6d 80 00 00 	movabs $0x806d28,%rdx
+  8059e4:	00 00 00 
+  8059e7:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8059ec:	48 bf 58 6d 80 00 00 	movabs $0x806d58,%rdi
+  8059f3:	00 00 00 
+  8059f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059fb:	49 ba de 1b 80 00 00 	movabs $0x801bde,%r10
+  805a02:	00 00 00 
+  805a05:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805a08:	5b                   	pop    %rbx
+  805a09:	41 5c                	pop    %r12
+  805a0b:	41 5d                	pop    %r13
+  805a0d:	41 5e                	pop    %r14
+  805a0f:	5d                   	pop    %rbp
+  805a10:	c3                   	ret
+
+0000000000805a11 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805a11:	55                   	push   %rbp
+  805a12:	48 89 e5             	mov    %rsp,%rbp
+  805a15:	53                   	push   %rbx
+  805a16:	48 83 ec 08          	sub    $0x8,%rsp
+  805a1a:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805a1d:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805a22:	48 b8 60 b4 80 01 00 	movabs $0x180b460,%rax
+  805a29:	00 00 00 
+  805a2c:	80 38 00             	cmpb   $0x0,(%rax)
+  805a2f:	74 68                	je     805a99 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a31:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  805a38:	00 00 00 
+  805a3b:	48 8b 08             	mov    (%rax),%rcx
+  805a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805a43:	48 b8 20 b4 80 01 00 	movabs $0x180b420,%rax
+  805a4a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a4d:	48 85 c9             	test   %rcx,%rcx
+  805a50:	0f 84 e0 00 00 00    	je     805b36 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805a56:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805a5a:	0f 84 c9 00 00 00    	je     805b29 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a60:	48 83 c2 01          	add    $0x1,%rdx
+  805a64:	48 39 ca             	cmp    %rcx,%rdx
+  805a67:	75 ed                	jne    805a56 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805a69:	48 83 f9 08          	cmp    $0x8,%rcx
+  805a6d:	0f 84 84 00 00 00    	je     805af7 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805a73:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805a77:	48 a3 68 b4 80 01 00 	movabs %rax,0x180b468
+  805a7e:	00 00 00 
+  805a81:	48 b8 20 b4 80 01 00 	movabs $0x180b420,%rax
+  805a88:	00 00 00 
+  805a8b:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805a8f:	85 f6                	test   %esi,%esi
+  805a91:	0f 89 97 00 00 00    	jns    805b2e <add_pgfault_handler+0x11d>
+  805a97:	eb 63                	jmp    805afc <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805a99:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805a9e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805aa3:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805aaa:	00 00 00 
+  805aad:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ab2:	48 b8 ca 2d 80 00 00 	movabs $0x802dca,%rax
+  805ab9:	00 00 00 
+  805abc:	ff d0                	call   *%rax
+  805abe:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805ac0:	85 c0                	test   %eax,%eax
+  805ac2:	78 38                	js     805afc <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805ac4:	48 be 12 5c 80 00 00 	movabs $0x805c12,%rsi
+  805acb:	00 00 00 
+  805ace:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ad3:	48 b8 ed 2f 80 00 00 	movabs $0x802fed,%rax
+  805ada:	00 00 00 
+  805add:	ff d0                	call   *%rax
+  805adf:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805ae1:	85 c0                	test   %eax,%eax
+  805ae3:	78 17                	js     805afc <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805ae5:	48 b8 60 b4 80 01 00 	movabs $0x180b460,%rax
+  805aec:	00 00 00 
+  805aef:	c6 00 01             	movb   $0x1,(%rax)
+  805af2:	e9 3a ff ff ff       	jmp    805a31 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805af7:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805afc:	89 f1                	mov    %esi,%ecx
+  805afe:	48 ba 66 6d 80 00 00 	movabs $0x806d66,%rdx
+  805b05:	00 00 00 
+  805b08:	be 42 00 00 00       	mov    $0x42,%esi
+  805b0d:	48 bf 58 6d 80 00 00 	movabs $0x806d58,%rdi
+  805b14:	00 00 00 
+  805b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b1c:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  805b23:	00 00 00 
+  805b26:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805b29:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805b2e:	89 f0                	mov    %esi,%eax
+  805b30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805b34:	c9                   	leave
+  805b35:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805b36:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  805b3d:	00 00 00 
+  805b40:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805b47:	48 89 d8             	mov    %rbx,%rax
+  805b4a:	48 a3 20 b4 80 01 00 	movabs %rax,0x180b420
+  805b51:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805b54:	eb d8                	jmp    805b2e <add_pgfault_handler+0x11d>
+
+0000000000805b56 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805b56:	55                   	push   %rbp
+  805b57:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805b5a:	48 b8 60 b4 80 01 00 	movabs $0x180b460,%rax
+  805b61:	00 00 00 
+  805b64:	80 38 00             	cmpb   $0x0,(%rax)
+  805b67:	74 33                	je     805b9c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805b69:	48 a1 68 b4 80 01 00 	movabs 0x180b468,%rax
+  805b70:	00 00 00 
+  805b73:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805b78:	48 ba 20 b4 80 01 00 	movabs $0x180b420,%rdx
+  805b7f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805b82:	48 85 c0             	test   %rax,%rax
+  805b85:	0f 84 85 00 00 00    	je     805c10 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805b8b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805b8f:	74 40                	je     805bd1 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805b91:	48 83 c1 01          	add    $0x1,%rcx
+  805b95:	48 39 c1             	cmp    %rax,%rcx
+  805b98:	75 f1                	jne    805b8b <remove_pgfault_handler+0x35>
+  805b9a:	eb 74                	jmp    805c10 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805b9c:	48 b9 7e 6d 80 00 00 	movabs $0x806d7e,%rcx
+  805ba3:	00 00 00 
+  805ba6:	48 ba 56 6c 80 00 00 	movabs $0x806c56,%rdx
+  805bad:	00 00 00 
+  805bb0:	be 48 00 00 00       	mov    $0x48,%esi
+  805bb5:	48 bf 58 6d 80 00 00 	movabs $0x806d58,%rdi
+  805bbc:	00 00 00 
+  805bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bc4:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  805bcb:	00 00 00 
+  805bce:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805bd1:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805bd8:	00 
+  805bd9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805bdd:	48 29 ca             	sub    %rcx,%rdx
+  805be0:	48 b8 20 b4 80 01 00 	movabs $0x180b420,%rax
+  805be7:	00 00 00 
+  805bea:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805bee:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805bf3:	48 89 ce             	mov    %rcx,%rsi
+  805bf6:	48 b8 b5 29 80 00 00 	movabs $0x8029b5,%rax
+  805bfd:	00 00 00 
+  805c00:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805c02:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  805c09:	00 00 00 
+  805c0c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805c10:	5d                   	pop    %rbp
+  805c11:	c3                   	ret
+
+0000000000805c12 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805c12:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805c15:	48 b8 87 59 80 00 00 	movabs $0x805987,%rax
+  805c1c:	00 00 00 
+    call *%rax
+  805c1f:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805c21:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805c28:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805c29:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805c30:	00 
+    subq $8, %rcx
+  805c31:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805c35:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805c38:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805c3f:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805c40:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805c44:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805c48:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805c4d:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805c52:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805c57:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805c5c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805c61:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805c66:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805c6b:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805c70:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805c75:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805c7a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805c7f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805c84:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805c89:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805c8e:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805c92:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805c96:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805c97:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805c98:	c3                   	ret
+
+0000000000805c99 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805c99:	85 ff                	test   %edi,%edi
+  805c9b:	78 58                	js     805cf5 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805c9d:	48 85 f6             	test   %rsi,%rsi
+  805ca0:	74 12                	je     805cb4 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805ca2:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  805ca9:	00 00 00 
+  805cac:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805cb2:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805cb4:	48 85 c9             	test   %rcx,%rcx
+  805cb7:	74 12                	je     805ccb <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805cb9:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  805cc0:	00 00 00 
+  805cc3:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805cc9:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805ccb:	48 85 d2             	test   %rdx,%rdx
+  805cce:	74 14                	je     805ce4 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805cd0:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  805cd7:	00 00 00 
+  805cda:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805ce1:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805ce4:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  805ceb:	00 00 00 
+  805cee:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805cf4:	c3                   	ret
+        if (from_env_store) {
+  805cf5:	48 85 f6             	test   %rsi,%rsi
+  805cf8:	74 06                	je     805d00 <ipc_result+0x67>
+            *from_env_store = 0;
+  805cfa:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805d00:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805d02:	48 85 c9             	test   %rcx,%rcx
+  805d05:	74 ed                	je     805cf4 <ipc_result+0x5b>
+            *perm_store = 0;
+  805d07:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805d0d:	c3                   	ret
+
+0000000000805d0e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805d0e:	55                   	push   %rbp
+  805d0f:	48 89 e5             	mov    %rsp,%rbp
+  805d12:	41 55                	push   %r13
+  805d14:	41 54                	push   %r12
+  805d16:	53                   	push   %rbx
+  805d17:	48 83 ec 08          	sub    $0x8,%rsp
+  805d1b:	49 89 fc             	mov    %rdi,%r12
+  805d1e:	48 89 f7             	mov    %rsi,%rdi
+  805d21:	48 89 d3             	mov    %rdx,%rbx
+  805d24:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805d27:	48 85 f6             	test   %rsi,%rsi
+  805d2a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805d31:	00 00 00 
+  805d34:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805d38:	be 00 00 00 00       	mov    $0x0,%esi
+  805d3d:	48 85 d2             	test   %rdx,%rdx
+  805d40:	74 03                	je     805d45 <ipc_recv+0x37>
+  805d42:	48 8b 32             	mov    (%rdx),%rsi
+  805d45:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  805d4c:	00 00 00 
+  805d4f:	ff d0                	call   *%rax
+  805d51:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805d53:	4c 89 e9             	mov    %r13,%rcx
+  805d56:	48 89 da             	mov    %rbx,%rdx
+  805d59:	4c 89 e6             	mov    %r12,%rsi
+  805d5c:	48 b8 99 5c 80 00 00 	movabs $0x805c99,%rax
+  805d63:	00 00 00 
+  805d66:	ff d0                	call   *%rax
+}
+  805d68:	48 83 c4 08          	add    $0x8,%rsp
+  805d6c:	5b                   	pop    %rbx
+  805d6d:	41 5c                	pop    %r12
+  805d6f:	41 5d                	pop    %r13
+  805d71:	5d                   	pop    %rbp
+  805d72:	c3                   	ret
+
+0000000000805d73 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805d73:	55                   	push   %rbp
+  805d74:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805d77:	48 85 d2             	test   %rdx,%rdx
+  805d7a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805d81:	00 00 00 
+  805d84:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805d88:	89 f6                	mov    %esi,%esi
+  805d8a:	48 b8 a2 31 80 00 00 	movabs $0x8031a2,%rax
+  805d91:	00 00 00 
+  805d94:	ff d0                	call   *%rax
+    if (res < 0) {
+  805d96:	85 c0                	test   %eax,%eax
+  805d98:	78 02                	js     805d9c <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805d9a:	5d                   	pop    %rbp
+  805d9b:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805d9c:	89 c1                	mov    %eax,%ecx
+  805d9e:	48 ba 98 6d 80 00 00 	movabs $0x806d98,%rdx
+  805da5:	00 00 00 
+  805da8:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805dad:	48 bf a5 6d 80 00 00 	movabs $0x806da5,%rdi
+  805db4:	00 00 00 
+  805db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dbc:	49 b8 de 1b 80 00 00 	movabs $0x801bde,%r8
+  805dc3:	00 00 00 
+  805dc6:	41 ff d0             	call   *%r8
+
+0000000000805dc9 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805dc9:	55                   	push   %rbp
+  805dca:	48 89 e5             	mov    %rsp,%rbp
+  805dcd:	53                   	push   %rbx
+  805dce:	48 83 ec 08          	sub    $0x8,%rsp
+  805dd2:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805dd6:	48 85 d2             	test   %rdx,%rdx
+  805dd9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805de0:	00 00 00 
+  805de3:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805de7:	4d 85 c9             	test   %r9,%r9
+  805dea:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805dee:	b8 00 00 00 00       	mov    $0x0,%eax
+  805df3:	48 85 db             	test   %rbx,%rbx
+  805df6:	74 03                	je     805dfb <ipc_call+0x32>
+  805df8:	48 8b 03             	mov    (%rbx),%rax
+  805dfb:	89 f6                	mov    %esi,%esi
+  805dfd:	48 83 ec 08          	sub    $0x8,%rsp
+  805e01:	50                   	push   %rax
+  805e02:	48 b8 d4 31 80 00 00 	movabs $0x8031d4,%rax
+  805e09:	00 00 00 
+  805e0c:	ff d0                	call   *%rax
+  805e0e:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805e10:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805e14:	48 89 da             	mov    %rbx,%rdx
+  805e17:	be 00 00 00 00       	mov    $0x0,%esi
+  805e1c:	48 b8 99 5c 80 00 00 	movabs $0x805c99,%rax
+  805e23:	00 00 00 
+  805e26:	ff d0                	call   *%rax
+}
+  805e28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805e2c:	c9                   	leave
+  805e2d:	c3                   	ret
+
+0000000000805e2e <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805e2e:	55                   	push   %rbp
+  805e2f:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805e32:	89 f6                	mov    %esi,%esi
+  805e34:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  805e3b:	00 00 00 
+  805e3e:	ff d0                	call   *%rax
+  805e40:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805e42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  805e51:	48 b8 99 5c 80 00 00 	movabs $0x805c99,%rax
+  805e58:	00 00 00 
+  805e5b:	ff d0                	call   *%rax
+}
+  805e5d:	5d                   	pop    %rbp
+  805e5e:	c3                   	ret
+
+0000000000805e5f <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805e5f:	55                   	push   %rbp
+  805e60:	48 89 e5             	mov    %rsp,%rbp
+  805e63:	41 54                	push   %r12
+  805e65:	53                   	push   %rbx
+  805e66:	4c 89 cb             	mov    %r9,%rbx
+  805e69:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805e6d:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805e71:	48 85 d2             	test   %rdx,%rdx
+  805e74:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805e7b:	00 00 00 
+  805e7e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805e82:	4d 85 c9             	test   %r9,%r9
+  805e85:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805e89:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e8e:	4d 85 e4             	test   %r12,%r12
+  805e91:	74 04                	je     805e97 <ipc_reply_wait+0x38>
+  805e93:	49 8b 04 24          	mov    (%r12),%rax
+  805e97:	89 f6                	mov    %esi,%esi
+  805e99:	48 83 ec 08          	sub    $0x8,%rsp
+  805e9d:	50                   	push   %rax
+  805e9e:	48 b8 aa 32 80 00 00 	movabs $0x8032aa,%rax
+  805ea5:	00 00 00 
+  805ea8:	ff d0                	call   *%rax
+  805eaa:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805eac:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805eb0:	4c 89 e2             	mov    %r12,%rdx
+  805eb3:	48 89 de             	mov    %rbx,%rsi
+  805eb6:	48 b8 99 5c 80 00 00 	movabs $0x805c99,%rax
+  805ebd:	00 00 00 
+  805ec0:	ff d0                	call   *%rax
+}
+  805ec2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805ec6:	5b                   	pop    %rbx
+  805ec7:	41 5c                	pop    %r12
+  805ec9:	5d                   	pop    %rbp
+  805eca:	c3                   	ret
+
+0000000000805ecb <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805ed0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805ed7:	00 00 00 
+  805eda:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805ee1:	48 01 ca             	add    %rcx,%rdx
+  805ee4:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805eea:	39 fa                	cmp    %edi,%edx
+  805eec:	74 12                	je     805f00 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805eee:	48 83 c0 01          	add    $0x1,%rax
+  805ef2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805ef8:	75 e0                	jne    805eda <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805efa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805eff:	c3                   	ret
+            return envs[i].env_id;
+  805f00:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805f07:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805f0e:	00 00 00 
+  805f11:	48 01 d0             	add    %rdx,%rax
+  805f14:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805f1a:	c3                   	ret
+  805f1b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805f20 <__rodata_start>:
+  805f20:	77 00                	ja     805f22 <__rodata_start+0x2>
+  805f22:	72 62                	jb     805f86 <__rodata_start+0x66>
+  805f24:	00 77 62             	add    %dh,0x62(%rdi)
+  805f27:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805f2a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805f31:	00 
+  805f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f39:	00 00 00 
+  805f3c:	0f 1f 40 00          	nopl   0x0(%rax)
+  805f40:	b3 09                	mov    $0x9,%bl
+  805f42:	80 00 00             	addb   $0x0,(%rax)
+  805f45:	00 00                	add    %al,(%rax)
+  805f47:	00 ed                	add    %ch,%ch
+  805f49:	0d 80 00 00 00       	or     $0x80,%eax
+  805f4e:	00 00                	add    %al,(%rax)
+  805f50:	ed                   	in     (%dx),%eax
+  805f51:	0d 80 00 00 00       	or     $0x80,%eax
+  805f56:	00 00                	add    %al,(%rax)
+  805f58:	ed                   	in     (%dx),%eax
+  805f59:	0d 80 00 00 00       	or     $0x80,%eax
+  805f5e:	00 00                	add    %al,(%rax)
+  805f60:	ed                   	in     (%dx),%eax
+  805f61:	0d 80 00 00 00       	or     $0x80,%eax
+  805f66:	00 00                	add    %al,(%rax)
+  805f68:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 ed                	add    %ch,%ch
+  805f71:	0d 80 00 00 00       	or     $0x80,%eax
+  805f76:	00 00                	add    %al,(%rax)
+  805f78:	ed                   	in     (%dx),%eax
+  805f79:	0d 80 00 00 00       	or     $0x80,%eax
+  805f7e:	00 00                	add    %al,(%rax)
+  805f80:	ed                   	in     (%dx),%eax
+  805f81:	0d 80 00 00 00       	or     $0x80,%eax
+  805f86:	00 00                	add    %al,(%rax)
+  805f88:	ed                   	in     (%dx),%eax
+  805f89:	0d 80 00 00 00       	or     $0x80,%eax
+  805f8e:	00 00                	add    %al,(%rax)
+  805f90:	ed                   	in     (%dx),%eax
+  805f91:	0d 80 00 00 00       	or     $0x80,%eax
+  805f96:	00 00                	add    %al,(%rax)
+  805f98:	8c 0a                	mov    %cs,(%rdx)
+  805f9a:	80 00 00             	addb   $0x0,(%rax)
+  805f9d:	00 00                	add    %al,(%rax)
+  805f9f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805fa6:	00 00                	add    %al,(%rax)
+  805fa8:	8c 0a                	mov    %cs,(%rdx)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805fb6:	00 00                	add    %al,(%rax)
+  805fb8:	8c 0a                	mov    %cs,(%rdx)
+  805fba:	80 00 00             	addb   $0x0,(%rax)
+  805fbd:	00 00                	add    %al,(%rax)
+  805fbf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805fc6:	00 00                	add    %al,(%rax)
+  805fc8:	8c 0a                	mov    %cs,(%rdx)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805fd6:	00 00                	add    %al,(%rax)
+  805fd8:	8c 0a                	mov    %cs,(%rdx)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805fe6:	00 00                	add    %al,(%rax)
+  805fe8:	ed                   	in     (%dx),%eax
+  805fe9:	0d 80 00 00 00       	or     $0x80,%eax
+  805fee:	00 00                	add    %al,(%rax)
+  805ff0:	ed                   	in     (%dx),%eax
+  805ff1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ff6:	00 00                	add    %al,(%rax)
+  805ff8:	ed                   	in     (%dx),%eax
+  805ff9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ffe:	00 00                	add    %al,(%rax)
+  806000:	ed                   	in     (%dx),%eax
+  806001:	0d 80 00 00 00       	or     $0x80,%eax
+  806006:	00 00                	add    %al,(%rax)
+  806008:	ed                   	in     (%dx),%eax
+  806009:	0d 80 00 00 00       	or     $0x80,%eax
+  80600e:	00 00                	add    %al,(%rax)
+  806010:	ed                   	in     (%dx),%eax
+  806011:	0d 80 00 00 00       	or     $0x80,%eax
+  806016:	00 00                	add    %al,(%rax)
+  806018:	ed                   	in     (%dx),%eax
+  806019:	0d 80 00 00 00       	or     $0x80,%eax
+  80601e:	00 00                	add    %al,(%rax)
+  806020:	ed                   	in     (%dx),%eax
+  806021:	0d 80 00 00 00       	or     $0x80,%eax
+  806026:	00 00                	add    %al,(%rax)
+  806028:	ed                   	in     (%dx),%eax
+  806029:	0d 80 00 00 00       	or     $0x80,%eax
+  80602e:	00 00                	add    %al,(%rax)
+  806030:	ed                   	in     (%dx),%eax
+  806031:	0d 80 00 00 00       	or     $0x80,%eax
+  806036:	00 00                	add    %al,(%rax)
+  806038:	ed                   	in     (%dx),%eax
+  806039:	0d 80 00 00 00       	or     $0x80,%eax
+  80603e:	00 00                	add    %al,(%rax)
+  806040:	ed                   	in     (%dx),%eax
+  806041:	0d 80 00 00 00       	or     $0x80,%eax
+  806046:	00 00                	add    %al,(%rax)
+  806048:	ed                   	in     (%dx),%eax
+  806049:	0d 80 00 00 00       	or     $0x80,%eax
+  80604e:	00 00                	add    %al,(%rax)
+  806050:	ed                   	in     (%dx),%eax
+  806051:	0d 80 00 00 00       	or     $0x80,%eax
+  806056:	00 00                	add    %al,(%rax)
+  806058:	ed                   	in     (%dx),%eax
+  806059:	0d 80 00 00 00       	or     $0x80,%eax
+  80605e:	00 00                	add    %al,(%rax)
+  806060:	ed                   	in     (%dx),%eax
+  806061:	0d 80 00 00 00       	or     $0x80,%eax
+  806066:	00 00                	add    %al,(%rax)
+  806068:	ed                   	in     (%dx),%eax
+  806069:	0d 80 00 00 00       	or     $0x80,%eax
+  80606e:	00 00                	add    %al,(%rax)
+  806070:	ed                   	in     (%dx),%eax
+  806071:	0d 80 00 00 00       	or     $0x80,%eax
+  806076:	00 00                	add    %al,(%rax)
+  806078:	ed                   	in     (%dx),%eax
+  806079:	0d 80 00 00 00       	or     $0x80,%eax
+  80607e:	00 00                	add    %al,(%rax)
+  806080:	ed                   	in     (%dx),%eax
+  806081:	0d 80 00 00 00       	or     $0x80,%eax
+  806086:	00 00                	add    %al,(%rax)
+  806088:	ed                   	in     (%dx),%eax
+  806089:	0d 80 00 00 00       	or     $0x80,%eax
+  80608e:	00 00                	add    %al,(%rax)
+  806090:	ed                   	in     (%dx),%eax
+  806091:	0d 80 00 00 00       	or     $0x80,%eax
+  806096:	00 00                	add    %al,(%rax)
+  806098:	ed                   	in     (%dx),%eax
+  806099:	0d 80 00 00 00       	or     $0x80,%eax
+  80609e:	00 00                	add    %al,(%rax)
+  8060a0:	ed                   	in     (%dx),%eax
+  8060a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060a6:	00 00                	add    %al,(%rax)
+  8060a8:	ed                   	in     (%dx),%eax
+  8060a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060ae:	00 00                	add    %al,(%rax)
+  8060b0:	ed                   	in     (%dx),%eax
+  8060b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060b6:	00 00                	add    %al,(%rax)
+  8060b8:	ed                   	in     (%dx),%eax
+  8060b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060be:	00 00                	add    %al,(%rax)
+  8060c0:	ed                   	in     (%dx),%eax
+  8060c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060c6:	00 00                	add    %al,(%rax)
+  8060c8:	ed                   	in     (%dx),%eax
+  8060c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060ce:	00 00                	add    %al,(%rax)
+  8060d0:	ed                   	in     (%dx),%eax
+  8060d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060d6:	00 00                	add    %al,(%rax)
+  8060d8:	f4                   	hlt
+  8060d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8060df:	00 ed                	add    %ch,%ch
+  8060e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060e6:	00 00                	add    %al,(%rax)
+  8060e8:	ed                   	in     (%dx),%eax
+  8060e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060ee:	00 00                	add    %al,(%rax)
+  8060f0:	2c 0b                	sub    $0xb,%al
+  8060f2:	80 00 00             	addb   $0x0,(%rax)
+  8060f5:	00 00                	add    %al,(%rax)
+  8060f7:	00 ed                	add    %ch,%ch
+  8060f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060fe:	00 00                	add    %al,(%rax)
+  806100:	ed                   	in     (%dx),%eax
+  806101:	0d 80 00 00 00       	or     $0x80,%eax
+  806106:	00 00                	add    %al,(%rax)
+  806108:	ed                   	in     (%dx),%eax
+  806109:	0d 80 00 00 00       	or     $0x80,%eax
+  80610e:	00 00                	add    %al,(%rax)
+  806110:	ed                   	in     (%dx),%eax
+  806111:	0d 80 00 00 00       	or     $0x80,%eax
+  806116:	00 00                	add    %al,(%rax)
+  806118:	ed                   	in     (%dx),%eax
+  806119:	0d 80 00 00 00       	or     $0x80,%eax
+  80611e:	00 00                	add    %al,(%rax)
+  806120:	ed                   	in     (%dx),%eax
+  806121:	0d 80 00 00 00       	or     $0x80,%eax
+  806126:	00 00                	add    %al,(%rax)
+  806128:	ed                   	in     (%dx),%eax
+  806129:	0d 80 00 00 00       	or     $0x80,%eax
+  80612e:	00 00                	add    %al,(%rax)
+  806130:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806133:	00 00                	add    %al,(%rax)
+  806135:	00 00                	add    %al,(%rax)
+  806137:	00 cb                	add    %cl,%bl
+  806139:	0d 80 00 00 00       	or     $0x80,%eax
+  80613e:	00 00                	add    %al,(%rax)
+  806140:	ed                   	in     (%dx),%eax
+  806141:	0d 80 00 00 00       	or     $0x80,%eax
+  806146:	00 00                	add    %al,(%rax)
+  806148:	ed                   	in     (%dx),%eax
+  806149:	0d 80 00 00 00       	or     $0x80,%eax
+  80614e:	00 00                	add    %al,(%rax)
+  806150:	ed                   	in     (%dx),%eax
+  806151:	0d 80 00 00 00       	or     $0x80,%eax
+  806156:	00 00                	add    %al,(%rax)
+  806158:	6a 0a                	push   $0xa
+  80615a:	80 00 00             	addb   $0x0,(%rax)
+  80615d:	00 00                	add    %al,(%rax)
+  80615f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806165:	00 00                	add    %al,(%rax)
+  806167:	00 ed                	add    %ch,%ch
+  806169:	0d 80 00 00 00       	or     $0x80,%eax
+  80616e:	00 00                	add    %al,(%rax)
+  806170:	ed                   	in     (%dx),%eax
+  806171:	0d 80 00 00 00       	or     $0x80,%eax
+  806176:	00 00                	add    %al,(%rax)
+  806178:	3c 0a                	cmp    $0xa,%al
+  80617a:	80 00 00             	addb   $0x0,(%rax)
+  80617d:	00 00                	add    %al,(%rax)
+  80617f:	00 ed                	add    %ch,%ch
+  806181:	0d 80 00 00 00       	or     $0x80,%eax
+  806186:	00 00                	add    %al,(%rax)
+  806188:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80618b:	00 00                	add    %al,(%rax)
+  80618d:	00 00                	add    %al,(%rax)
+  80618f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  806195:	00 00                	add    %al,(%rax)
+  806197:	00 29                	add    %ch,(%rcx)
+  806199:	0c 80                	or     $0x80,%al
+  80619b:	00 00                	add    %al,(%rax)
+  80619d:	00 00                	add    %al,(%rax)
+  80619f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8061a2:	80 00 00             	addb   $0x0,(%rax)
+  8061a5:	00 00                	add    %al,(%rax)
+  8061a7:	00 ed                	add    %ch,%ch
+  8061a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061ae:	00 00                	add    %al,(%rax)
+  8061b0:	1a 0b                	sbb    (%rbx),%cl
+  8061b2:	80 00 00             	addb   $0x0,(%rax)
+  8061b5:	00 00                	add    %al,(%rax)
+  8061b7:	00 ed                	add    %ch,%ch
+  8061b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061be:	00 00                	add    %al,(%rax)
+  8061c0:	ce                   	(bad)
+  8061c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8061c7:	00 ed                	add    %ch,%ch
+  8061c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061ce:	00 00                	add    %al,(%rax)
+  8061d0:	ed                   	in     (%dx),%eax
+  8061d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061d6:	00 00                	add    %al,(%rax)
+  8061d8:	f4                   	hlt
+  8061d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8061df:	00 37                	add    %dh,(%rdi)
+  8061e1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8061e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061ea:	80 00 00             	addb   $0x0,(%rax)
+  8061ed:	00 00                	add    %al,(%rax)
+  8061ef:	00 37                	add    %dh,(%rdi)
+  8061f1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8061f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061fa:	80 00 00             	addb   $0x0,(%rax)
+  8061fd:	00 00                	add    %al,(%rax)
+  8061ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806202:	80 00 00             	addb   $0x0,(%rax)
+  806205:	00 00                	add    %al,(%rax)
+  806207:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80620b:	00 00                	add    %al,(%rax)
+  80620d:	00 00                	add    %al,(%rax)
+  80620f:	00 d2                	add    %dl,%dl
+  806211:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806217:	00 d2                	add    %dl,%dl
+  806219:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80621f:	00 d2                	add    %dl,%dl
+  806221:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806227:	00 d2                	add    %dl,%dl
+  806229:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80622f:	00 d2                	add    %dl,%dl
+  806231:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806237:	00 d2                	add    %dl,%dl
+  806239:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80623f:	00 d2                	add    %dl,%dl
+  806241:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806247:	00 f6                	add    %dh,%dh
+  806249:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80624f:	00 f6                	add    %dh,%dh
+  806251:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806257:	00 5f 12             	add    %bl,0x12(%rdi)
+  80625a:	80 00 00             	addb   $0x0,(%rax)
+  80625d:	00 00                	add    %al,(%rax)
+  80625f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806262:	80 00 00             	addb   $0x0,(%rax)
+  806265:	00 00                	add    %al,(%rax)
+  806267:	00 5f 12             	add    %bl,0x12(%rdi)
+  80626a:	80 00 00             	addb   $0x0,(%rax)
+  80626d:	00 00                	add    %al,(%rax)
+  80626f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806272:	80 00 00             	addb   $0x0,(%rax)
+  806275:	00 00                	add    %al,(%rax)
+  806277:	00 5f 12             	add    %bl,0x12(%rdi)
+  80627a:	80 00 00             	addb   $0x0,(%rax)
+  80627d:	00 00                	add    %al,(%rax)
+  80627f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806282:	80 00 00             	addb   $0x0,(%rax)
+  806285:	00 00                	add    %al,(%rax)
+  806287:	00 5f 12             	add    %bl,0x12(%rdi)
+  80628a:	80 00 00             	addb   $0x0,(%rax)
+  80628d:	00 00                	add    %al,(%rax)
+  80628f:	00 22                	add    %ah,(%rdx)
+  806291:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806297:	00 22                	add    %ah,(%rdx)
+  806299:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80629f:	00 22                	add    %ah,(%rdx)
+  8062a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8062a7:	00 22                	add    %ah,(%rdx)
+  8062a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8062af:	00 22                	add    %ah,(%rdx)
+  8062b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8062b7:	00 22                	add    %ah,(%rdx)
+  8062b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8062bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062c2:	80 00 00             	addb   $0x0,(%rax)
+  8062c5:	00 00                	add    %al,(%rax)
+  8062c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062ca:	80 00 00             	addb   $0x0,(%rax)
+  8062cd:	00 00                	add    %al,(%rax)
+  8062cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062d2:	80 00 00             	addb   $0x0,(%rax)
+  8062d5:	00 00                	add    %al,(%rax)
+  8062d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062da:	80 00 00             	addb   $0x0,(%rax)
+  8062dd:	00 00                	add    %al,(%rax)
+  8062df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062e2:	80 00 00             	addb   $0x0,(%rax)
+  8062e5:	00 00                	add    %al,(%rax)
+  8062e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062ea:	80 00 00             	addb   $0x0,(%rax)
+  8062ed:	00 00                	add    %al,(%rax)
+  8062ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062f2:	80 00 00             	addb   $0x0,(%rax)
+  8062f5:	00 00                	add    %al,(%rax)
+  8062f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062fa:	80 00 00             	addb   $0x0,(%rax)
+  8062fd:	00 00                	add    %al,(%rax)
+  8062ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806302:	80 00 00             	addb   $0x0,(%rax)
+  806305:	00 00                	add    %al,(%rax)
+  806307:	00 5f 12             	add    %bl,0x12(%rdi)
+  80630a:	80 00 00             	addb   $0x0,(%rax)
+  80630d:	00 00                	add    %al,(%rax)
+  80630f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806312:	80 00 00             	addb   $0x0,(%rax)
+  806315:	00 00                	add    %al,(%rax)
+  806317:	00 5f 12             	add    %bl,0x12(%rdi)
+  80631a:	80 00 00             	addb   $0x0,(%rax)
+  80631d:	00 00                	add    %al,(%rax)
+  80631f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806322:	80 00 00             	addb   $0x0,(%rax)
+  806325:	00 00                	add    %al,(%rax)
+  806327:	00 5f 12             	add    %bl,0x12(%rdi)
+  80632a:	80 00 00             	addb   $0x0,(%rax)
+  80632d:	00 00                	add    %al,(%rax)
+  80632f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806332:	80 00 00             	addb   $0x0,(%rax)
+  806335:	00 00                	add    %al,(%rax)
+  806337:	00 5f 12             	add    %bl,0x12(%rdi)
+  80633a:	80 00 00             	addb   $0x0,(%rax)
+  80633d:	00 00                	add    %al,(%rax)
+  80633f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806342:	80 00 00             	addb   $0x0,(%rax)
+  806345:	00 00                	add    %al,(%rax)
+  806347:	00 46 12             	add    %al,0x12(%rsi)
+  80634a:	80 00 00             	addb   $0x0,(%rax)
+  80634d:	00 00                	add    %al,(%rax)
+  80634f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806352:	80 00 00             	addb   $0x0,(%rax)
+  806355:	00 00                	add    %al,(%rax)
+  806357:	00 5f 12             	add    %bl,0x12(%rdi)
+  80635a:	80 00 00             	addb   $0x0,(%rax)
+  80635d:	00 00                	add    %al,(%rax)
+  80635f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806362:	80 00 00             	addb   $0x0,(%rax)
+  806365:	00 00                	add    %al,(%rax)
+  806367:	00 5f 12             	add    %bl,0x12(%rdi)
+  80636a:	80 00 00             	addb   $0x0,(%rax)
+  80636d:	00 00                	add    %al,(%rax)
+  80636f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806372:	80 00 00             	addb   $0x0,(%rax)
+  806375:	00 00                	add    %al,(%rax)
+  806377:	00 5f 12             	add    %bl,0x12(%rdi)
+  80637a:	80 00 00             	addb   $0x0,(%rax)
+  80637d:	00 00                	add    %al,(%rax)
+  80637f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806382:	80 00 00             	addb   $0x0,(%rax)
+  806385:	00 00                	add    %al,(%rax)
+  806387:	00 5f 12             	add    %bl,0x12(%rdi)
+  80638a:	80 00 00             	addb   $0x0,(%rax)
+  80638d:	00 00                	add    %al,(%rax)
+  80638f:	00 22                	add    %ah,(%rdx)
+  806391:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806397:	00 22                	add    %ah,(%rdx)
+  806399:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80639f:	00 22                	add    %ah,(%rdx)
+  8063a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8063a7:	00 22                	add    %ah,(%rdx)
+  8063a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8063af:	00 22                	add    %ah,(%rdx)
+  8063b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8063b7:	00 22                	add    %ah,(%rdx)
+  8063b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8063bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063c2:	80 00 00             	addb   $0x0,(%rax)
+  8063c5:	00 00                	add    %al,(%rax)
+  8063c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063ca:	80 00 00             	addb   $0x0,(%rax)
+  8063cd:	00 00                	add    %al,(%rax)
+  8063cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063d2:	80 00 00             	addb   $0x0,(%rax)
+  8063d5:	00 00                	add    %al,(%rax)
+  8063d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063da:	80 00 00             	addb   $0x0,(%rax)
+  8063dd:	00 00                	add    %al,(%rax)
+  8063df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063e2:	80 00 00             	addb   $0x0,(%rax)
+  8063e5:	00 00                	add    %al,(%rax)
+  8063e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063ea:	80 00 00             	addb   $0x0,(%rax)
+  8063ed:	00 00                	add    %al,(%rax)
+  8063ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063f2:	80 00 00             	addb   $0x0,(%rax)
+  8063f5:	00 00                	add    %al,(%rax)
+  8063f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063fa:	80 00 00             	addb   $0x0,(%rax)
+  8063fd:	00 00                	add    %al,(%rax)
+  8063ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806402:	80 00 00             	addb   $0x0,(%rax)
+  806405:	00 00                	add    %al,(%rax)
+  806407:	00 5f 12             	add    %bl,0x12(%rdi)
+  80640a:	80 00 00             	addb   $0x0,(%rax)
+  80640d:	00 00                	add    %al,(%rax)
+  80640f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806412:	80 00 00             	addb   $0x0,(%rax)
+  806415:	00 00                	add    %al,(%rax)
+  806417:	00 5f 12             	add    %bl,0x12(%rdi)
+  80641a:	80 00 00             	addb   $0x0,(%rax)
+  80641d:	00 00                	add    %al,(%rax)
+  80641f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806422:	80 00 00             	addb   $0x0,(%rax)
+  806425:	00 00                	add    %al,(%rax)
+  806427:	00 5f 12             	add    %bl,0x12(%rdi)
+  80642a:	80 00 00             	addb   $0x0,(%rax)
+  80642d:	00 00                	add    %al,(%rax)
+  80642f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806432:	80 00 00             	addb   $0x0,(%rax)
+  806435:	00 00                	add    %al,(%rax)
+  806437:	00 5f 12             	add    %bl,0x12(%rdi)
+  80643a:	80 00 00             	addb   $0x0,(%rax)
+  80643d:	00 00                	add    %al,(%rax)
+  80643f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806442:	80 00 00             	addb   $0x0,(%rax)
+  806445:	00 00                	add    %al,(%rax)
+  806447:	00 46 12             	add    %al,0x12(%rsi)
+  80644a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806460 <basefix.0>:
+  806460:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806470:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806480:	10 00 72 65 61 64 20 66 61 69 6c 65 64 00 75 73     ..read failed.us
+  806490:	65 72 2f 6d 6d 61 70 74 65 73 74 2e 63 00 2f 6d     er/mmaptest.c./m
+  8064a0:	6d 61 70 74 65 73 74 00 6f 70 65 6e 20 25 73 3a     maptest.open %s:
+  8064b0:	20 25 69 00 77 72 69 74 65 20 66 61 69 6c 65 64      %i.write failed
+  8064c0:	00 6d 6d 61 70 20 70 72 69 76 61 74 65 20 66 61     .mmap private fa
+  8064d0:	69 6c 65 64 00 70 72 69 76 61 74 65 20 70 61 67     iled.private pag
+  8064e0:	65 20 25 64 20 69 73 20 25 30 32 78 00 6d 75 6e     e %d is %02x.mun
+  8064f0:	6d 61 70 3a 20 25 69 00 6d 6d 61 70 20 73 68 61     map: %i.mmap sha
+  806500:	72 65 64 20 66 61 69 6c 65 64 00 73 68 61 72 65     red failed.share
+  806510:	64 20 70 61 67 65 20 30 20 69 73 20 25 30 32 78     d page 0 is %02x
+  806520:	00 6d 73 79 6e 63 3a 20 25 69 00 73 68 61 72 65     .msync: %i.share
+  806530:	64 20 77 72 69 74 65 20 69 73 20 6e 6f 74 20 76     d write is not v
+  806540:	69 73 69 62 6c 65 00 73 68 61 72 65 64 20 77 72     isible.shared wr
+  806550:	69 74 65 20 69 73 20 6c 6f 73 74 00 6d 6d 61 70     ite is lost.mmap
+  806560:	74 65 73 74 3a 20 4f 4b 0a 00 66 0f 1f 44 00 00     test: OK..f..D..
+  806570:	70 61 67 65 20 25 64 20 6f 66 20 66 69 6c 65 20     page %d of file 
+  806580:	69 73 20 25 30 32 78 2c 20 65 78 70 65 63 74 65     is %02x, expecte
+  806590:	64 20 25 30 32 78 00 3c 75 6e 6b 6e 6f 77 6e 3e     d %02x.<unknown>
+  8065a0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8065b0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8065c0:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  8065d0:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  8065e0:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  8065f0:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  806600:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  806610:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  806620:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  806630:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  806640:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  806650:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  806660:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  806670:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  806680:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  806690:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  8066a0:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  8066b0:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  8066c0:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  8066d0:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  8066e0:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  8066f0:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  806700:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  806710:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  806720:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  806730:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  806740:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  806750:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  806760:	26 1f 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     &.......}%......
+  806770:	6d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     m%......}%......
+  806780:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806790:	7d 25 80 00 00 00 00 00 45 1f 80 00 00 00 00 00     }%......E.......
+  8067a0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8067b0:	39 1f 80 00 00 00 00 00 b3 1f 80 00 00 00 00 00     9...............
+  8067c0:	7d 25 80 00 00 00 00 00 39 1f 80 00 00 00 00 00     }%......9.......
+  8067d0:	7f 1f 80 00 00 00 00 00 7f 1f 80 00 00 00 00 00     ................
+  8067e0:	7f 1f 80 00 00 00 00 00 7f 1f 80 00 00 00 00 00     ................
+  8067f0:	7f 1f 80 00 00 00 00 00 7f 1f 80 00 00 00 00 00     ................
+  806800:	7f 1f 80 00 00 00 00 00 7f 1f 80 00 00 00 00 00     ................
+  806810:	7f 1f 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     ........}%......
+  806820:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806830:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806840:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806850:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806860:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806870:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806880:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806890:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8068a0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8068b0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8068c0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8068d0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8068e0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8068f0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806900:	7d 25 80 00 00 00 00 00 9b 24 80 00 00 00 00 00     }%.......$......
+  806910:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806920:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806930:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806940:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806950:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806960:	e1 1f 80 00 00 00 00 00 b0 21 80 00 00 00 00 00     .........!......
+  806970:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  806980:	7d 25 80 00 00 00 00 00 d6 1f 80 00 00 00 00 00     }%..............
+  806990:	10 20 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     . ......}%......
+  8069a0:	7d 25 80 00 00 00 00 00 cb 1f 80 00 00 00 00 00     }%..............
+  8069b0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8069c0:	59 23 80 00 00 00 00 00 28 24 80 00 00 00 00 00     Y#......($......
+  8069d0:	7d 25 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     }%......}%......
+  8069e0:	a7 20 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     . ......}%......
+  8069f0:	84 22 80 00 00 00 00 00 7d 25 80 00 00 00 00 00     ."......}%......
+  806a00:	7d 25 80 00 00 00 00 00 9b 24 80 00 00 00 00 00     }%.......$......
+  806a10:	7d 25 80 00 00 00 00 00 2f 1f 80 00 00 00 00 00     }%....../.......
+
+0000000000806a20 <error_string>:
+	...
+  806a28:	fd 65 80 00 00 00 00 00 0f 66 80 00 00 00 00 00     .e.......f......
+  806a38:	1f 66 80 00 00 00 00 00 31 66 80 00 00 00 00 00     .f......1f......
+  806a48:	3f 66 80 00 00 00 00 00 53 66 80 00 00 00 00 00     ?f......Sf......
+  806a58:	68 66 80 00 00 00 00 00 7b 66 80 00 00 00 00 00     hf......{f......
+  806a68:	8d 66 80 00 00 00 00 00 a1 66 80 00 00 00 00 00     .f.......f......
+  806a78:	b1 66 80 00 00 00 00 00 c4 66 80 00 00 00 00 00     .f.......f......
+  806a88:	db 66 80 00 00 00 00 00 f1 66 80 00 00 00 00 00     .f.......f......
+  806a98:	09 67 80 00 00 00 00 00 21 67 80 00 00 00 00 00     .g......!g......
+  806aa8:	2e 67 80 00 00 00 00 00 c0 6a 80 00 00 00 00 00     .g.......j......
+  806ab8:	42 67 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     Bg......file is 
+  806ac8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806ad8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806ae8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806af8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806b08:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806b18:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806b28:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806b38:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806b48:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806b58:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806b68:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806b78:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806b88:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806b98:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806ba8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806bb8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806bc8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806bd8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806be8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806bf8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806c08:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806c18:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806c20 <devtab>:
+  806c20:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806c30:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806c40:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806c50:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806c60:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806c70:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806c80:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806c90:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806ca0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806cb0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806cc0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806cd0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806ce0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  806cf0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  806d00:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  806d10:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  806d20:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  806d30:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806d40:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806d50:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806d60:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806d70:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806d80:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806d90:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806da0:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,10469 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 0d 25 80 00 00 	movabs $0x80250d,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 ce 34 80 00 00 	movabs $0x8034ce,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 ce 34 80 00 00 	movabs $0x8034ce,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 a4 3e 80 00 00 	movabs $0x803ea4,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 a4 3e 80 00 00 	movabs $0x803ea4,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 c1 17 80 00 00 	movabs $0x8017c1,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be f7 5e 80 00 00 	movabs $0x805ef7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 37 3c 80 00 00 	movabs $0x803c37,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be b8 58 80 00 00 	movabs $0x8058b8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 37 3c 80 00 00 	movabs $0x803c37,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be ba 58 80 00 00 	movabs $0x8058ba,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 37 3c 80 00 00 	movabs $0x803c37,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be bd 58 80 00 00 	movabs $0x8058bd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 37 3c 80 00 00 	movabs $0x803c37,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 a2 4c 80 00 00 	movabs $0x804ca2,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 79 4f 80 00 00 	movabs $0x804f79,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 21 32 80 00 00 	movabs $0x803221,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 b8 35 80 00 00 	movabs $0x8035b8,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 87 35 80 00 00 	movabs $0x803587,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 87 35 80 00 00 	movabs $0x803587,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 9f 33 80 00 00 	movabs $0x80339f,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 ce 34 80 00 00 	movabs $0x8034ce,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 37 3c 80 00 00 	movabs $0x803c37,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 21 32 80 00 00 	movabs $0x803221,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb da 24 80 00 00 	movabs $0x8024da,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 58 80 00 00 	movabs $0x8058c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 da 24 80 00 00 	movabs $0x8024da,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 0d 25 80 00 00 	movabs $0x80250d,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc da 24 80 00 00 	movabs $0x8024da,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 5b 80 00 00 	movabs $0x805b60,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf da 24 80 00 00 	movabs $0x8024da,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf da 24 80 00 00 	movabs $0x8024da,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5d 80 00 00 	movabs $0x805de0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5d 80 00 00 	movabs $0x805de0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 19 02 00 00       	call   801718 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <num>:
+
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 28          	sub    $0x28,%rsp
+  801512:	41 89 fc             	mov    %edi,%r12d
+  801515:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    long n;
+    int r;
+    char c;
+
+    while ((n = read(f, &c, 1)) > 0) {
+  801519:	49 bd 9f 33 80 00 00 	movabs $0x80339f,%r13
+  801520:	00 00 00 
+        if (bol) {
+  801523:	48 bb 34 70 80 00 00 	movabs $0x807034,%rbx
+  80152a:	00 00 00 
+            printf("%5d ", ++line);
+  80152d:	49 be 20 80 80 01 00 	movabs $0x1808020,%r14
+  801534:	00 00 00 
+  801537:	49 bf 02 5e 80 00 00 	movabs $0x805e02,%r15
+  80153e:	00 00 00 
+  801541:	eb 25                	jmp    801568 <num+0x67>
+            bol = 0;
+        }
+        if ((r = write(1, &c, 1)) != 1)
+  801543:	ba 01 00 00 00       	mov    $0x1,%edx
+  801548:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80154c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801551:	48 b8 ce 34 80 00 00 	movabs $0x8034ce,%rax
+  801558:	00 00 00 
+  80155b:	ff d0                	call   *%rax
+  80155d:	83 f8 01             	cmp    $0x1,%eax
+  801560:	75 44                	jne    8015a6 <num+0xa5>
+            panic("write error copying %s: %i", s, r);
+        if (c == '\n')
+  801562:	80 7d cf 0a          	cmpb   $0xa,-0x31(%rbp)
+  801566:	74 70                	je     8015d8 <num+0xd7>
+    while ((n = read(f, &c, 1)) > 0) {
+  801568:	ba 01 00 00 00       	mov    $0x1,%edx
+  80156d:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  801571:	44 89 e7             	mov    %r12d,%edi
+  801574:	41 ff d5             	call   *%r13
+  801577:	48 85 c0             	test   %rax,%rax
+  80157a:	7e 71                	jle    8015ed <num+0xec>
+        if (bol) {
+  80157c:	83 3b 00             	cmpl   $0x0,(%rbx)
+  80157f:	74 c2                	je     801543 <num+0x42>
+            printf("%5d ", ++line);
+  801581:	41 8b 06             	mov    (%r14),%eax
+  801584:	8d 70 01             	lea    0x1(%rax),%esi
+  801587:	41 89 36             	mov    %esi,(%r14)
+  80158a:	4c 89 ff             	mov    %r15,%rdi
+  80158d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801592:	48 ba 6a 3f 80 00 00 	movabs $0x803f6a,%rdx
+  801599:	00 00 00 
+  80159c:	ff d2                	call   *%rdx
+            bol = 0;
+  80159e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8015a4:	eb 9d                	jmp    801543 <num+0x42>
+            panic("write error copying %s: %i", s, r);
+  8015a6:	41 89 c0             	mov    %eax,%r8d
+  8015a9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8015ad:	48 ba 07 5e 80 00 00 	movabs $0x805e07,%rdx
+  8015b4:	00 00 00 
+  8015b7:	be 12 00 00 00       	mov    $0x12,%esi
+  8015bc:	48 bf 22 5e 80 00 00 	movabs $0x805e22,%rdi
+  8015c3:	00 00 00 
+  8015c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cb:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  8015d2:	00 00 00 
+  8015d5:	41 ff d1             	call   *%r9
+            bol = 1;
+  8015d8:	48 b8 34 70 80 00 00 	movabs $0x807034,%rax
+  8015df:	00 00 00 
+  8015e2:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  8015e8:	e9 4a ff ff ff       	jmp    801537 <num+0x36>
+    }
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  8015ed:	78 0f                	js     8015fe <num+0xfd>
+}
+  8015ef:	48 83 c4 28          	add    $0x28,%rsp
+  8015f3:	5b                   	pop    %rbx
+  8015f4:	41 5c                	pop    %r12
+  8015f6:	41 5d                	pop    %r13
+  8015f8:	41 5e                	pop    %r14
+  8015fa:	41 5f                	pop    %r15
+  8015fc:	5d                   	pop    %rbp
+  8015fd:	c3                   	ret
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  8015fe:	41 89 c0             	mov    %eax,%r8d
+  801601:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801605:	48 ba 2d 5e 80 00 00 	movabs $0x805e2d,%rdx
+  80160c:	00 00 00 
+  80160f:	be 16 00 00 00       	mov    $0x16,%esi
+  801614:	48 bf 22 5e 80 00 00 	movabs $0x805e22,%rdi
+  80161b:	00 00 00 
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801623:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  80162a:	00 00 00 
+  80162d:	41 ff d1             	call   *%r9
+
+0000000000801630 <umain>:
+
+void
+umain(int argc, char **argv) {
+  801630:	55                   	push   %rbp
+  801631:	48 89 e5             	mov    %rsp,%rbp
+  801634:	41 57                	push   %r15
+  801636:	41 56                	push   %r14
+  801638:	41 55                	push   %r13
+  80163a:	41 54                	push   %r12
+  80163c:	53                   	push   %rbx
+  80163d:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "num";
+  801641:	48 b8 42 5e 80 00 00 	movabs $0x805e42,%rax
+  801648:	00 00 00 
+  80164b:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801652:	00 00 00 
+    if (argc == 1)
+  801655:	83 ff 01             	cmp    $0x1,%edi
+  801658:	74 6f                	je     8016c9 <umain+0x99>
+        num(0, "<stdin>");
+    else {
+        for (int i = 1; i < argc; i++) {
+  80165a:	7e 52                	jle    8016ae <umain+0x7e>
+  80165c:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  801660:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  801663:	4c 8d 7c c6 10       	lea    0x10(%rsi,%rax,8),%r15
+            int f = open(argv[i], O_RDONLY);
+  801668:	49 bd 37 3c 80 00 00 	movabs $0x803c37,%r13
+  80166f:	00 00 00 
+            if (f < 0)
+                panic("can't open %s: %i", argv[i], f);
+            else {
+                num(f, argv[i]);
+  801672:	49 be 01 15 80 00 00 	movabs $0x801501,%r14
+  801679:	00 00 00 
+            int f = open(argv[i], O_RDONLY);
+  80167c:	49 8b 3c 24          	mov    (%r12),%rdi
+  801680:	be 00 00 00 00       	mov    $0x0,%esi
+  801685:	41 ff d5             	call   *%r13
+  801688:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	78 58                	js     8016e6 <umain+0xb6>
+                num(f, argv[i]);
+  80168e:	49 8b 34 24          	mov    (%r12),%rsi
+  801692:	89 c7                	mov    %eax,%edi
+  801694:	41 ff d6             	call   *%r14
+                close(f);
+  801697:	89 df                	mov    %ebx,%edi
+  801699:	48 b8 21 32 80 00 00 	movabs $0x803221,%rax
+  8016a0:	00 00 00 
+  8016a3:	ff d0                	call   *%rax
+        for (int i = 1; i < argc; i++) {
+  8016a5:	49 83 c4 08          	add    $0x8,%r12
+  8016a9:	4d 39 fc             	cmp    %r15,%r12
+  8016ac:	75 ce                	jne    80167c <umain+0x4c>
+            }
+        }
+    }
+    exit();
+  8016ae:	48 b8 c1 17 80 00 00 	movabs $0x8017c1,%rax
+  8016b5:	00 00 00 
+  8016b8:	ff d0                	call   *%rax
+}
+  8016ba:	48 83 c4 08          	add    $0x8,%rsp
+  8016be:	5b                   	pop    %rbx
+  8016bf:	41 5c                	pop    %r12
+  8016c1:	41 5d                	pop    %r13
+  8016c3:	41 5e                	pop    %r14
+  8016c5:	41 5f                	pop    %r15
+  8016c7:	5d                   	pop    %rbp
+  8016c8:	c3                   	ret
+        num(0, "<stdin>");
+  8016c9:	48 be 46 5e 80 00 00 	movabs $0x805e46,%rsi
+  8016d0:	00 00 00 
+  8016d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d8:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016df:	00 00 00 
+  8016e2:	ff d0                	call   *%rax
+  8016e4:	eb c8                	jmp    8016ae <umain+0x7e>
+                panic("can't open %s: %i", argv[i], f);
+  8016e6:	49 8b 0c 24          	mov    (%r12),%rcx
+  8016ea:	41 89 c0             	mov    %eax,%r8d
+  8016ed:	48 ba 4e 5e 80 00 00 	movabs $0x805e4e,%rdx
+  8016f4:	00 00 00 
+  8016f7:	be 22 00 00 00       	mov    $0x22,%esi
+  8016fc:	48 bf 22 5e 80 00 00 	movabs $0x805e22,%rdi
+  801703:	00 00 00 
+  801706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170b:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  801712:	00 00 00 
+  801715:	41 ff d1             	call   *%r9
+
+0000000000801718 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801718:	55                   	push   %rbp
+  801719:	48 89 e5             	mov    %rsp,%rbp
+  80171c:	41 56                	push   %r14
+  80171e:	41 55                	push   %r13
+  801720:	41 54                	push   %r12
+  801722:	53                   	push   %rbx
+  801723:	41 89 fd             	mov    %edi,%r13d
+  801726:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801729:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801730:	00 00 00 
+  801733:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80173a:	00 00 00 
+  80173d:	48 39 c2             	cmp    %rax,%rdx
+  801740:	73 17                	jae    801759 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801742:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801745:	49 89 c4             	mov    %rax,%r12
+  801748:	48 83 c3 08          	add    $0x8,%rbx
+  80174c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801751:	ff 53 f8             	call   *-0x8(%rbx)
+  801754:	4c 39 e3             	cmp    %r12,%rbx
+  801757:	72 ef                	jb     801748 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801759:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  801760:	00 00 00 
+  801763:	ff d0                	call   *%rax
+  801765:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80176a:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801771:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801778:	00 00 00 
+  80177b:	48 01 d0             	add    %rdx,%rax
+  80177e:	48 a3 28 80 80 01 00 	movabs %rax,0x1808028
+  801785:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801788:	45 85 ed             	test   %r13d,%r13d
+  80178b:	7e 0d                	jle    80179a <libmain+0x82>
+  80178d:	49 8b 06             	mov    (%r14),%rax
+  801790:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801797:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80179a:	4c 89 f6             	mov    %r14,%rsi
+  80179d:	44 89 ef             	mov    %r13d,%edi
+  8017a0:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  8017a7:	00 00 00 
+  8017aa:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8017ac:	48 b8 c1 17 80 00 00 	movabs $0x8017c1,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+#endif
+}
+  8017b8:	5b                   	pop    %rbx
+  8017b9:	41 5c                	pop    %r12
+  8017bb:	41 5d                	pop    %r13
+  8017bd:	41 5e                	pop    %r14
+  8017bf:	5d                   	pop    %rbp
+  8017c0:	c3                   	ret
+
+00000000008017c1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8017c1:	55                   	push   %rbp
+  8017c2:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8017c5:	48 b8 54 32 80 00 00 	movabs $0x803254,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8017d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017d6:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  8017dd:	00 00 00 
+  8017e0:	ff d0                	call   *%rax
+}
+  8017e2:	5d                   	pop    %rbp
+  8017e3:	c3                   	ret
+
+00000000008017e4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8017e4:	55                   	push   %rbp
+  8017e5:	48 89 e5             	mov    %rsp,%rbp
+  8017e8:	41 56                	push   %r14
+  8017ea:	41 55                	push   %r13
+  8017ec:	41 54                	push   %r12
+  8017ee:	53                   	push   %rbx
+  8017ef:	48 83 ec 50          	sub    $0x50,%rsp
+  8017f3:	49 89 fc             	mov    %rdi,%r12
+  8017f6:	41 89 f5             	mov    %esi,%r13d
+  8017f9:	48 89 d3             	mov    %rdx,%rbx
+  8017fc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801800:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801804:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801808:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80180f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801813:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801817:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80181b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80181f:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801826:	00 00 00 
+  801829:	4c 8b 30             	mov    (%rax),%r14
+  80182c:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  801833:	00 00 00 
+  801836:	ff d0                	call   *%rax
+  801838:	89 c6                	mov    %eax,%esi
+  80183a:	45 89 e8             	mov    %r13d,%r8d
+  80183d:	4c 89 e1             	mov    %r12,%rcx
+  801840:	4c 89 f2             	mov    %r14,%rdx
+  801843:	48 bf 70 5e 80 00 00 	movabs $0x805e70,%rdi
+  80184a:	00 00 00 
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801852:	49 bc 34 19 80 00 00 	movabs $0x801934,%r12
+  801859:	00 00 00 
+  80185c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80185f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801863:	48 89 df             	mov    %rbx,%rdi
+  801866:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  80186d:	00 00 00 
+  801870:	ff d0                	call   *%rax
+    cprintf("\n");
+  801872:	48 bf 53 64 80 00 00 	movabs $0x806453,%rdi
+  801879:	00 00 00 
+  80187c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801881:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801884:	cc                   	int3
+  801885:	eb fd                	jmp    801884 <_panic+0xa0>
+
+0000000000801887 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801887:	55                   	push   %rbp
+  801888:	48 89 e5             	mov    %rsp,%rbp
+  80188b:	53                   	push   %rbx
+  80188c:	48 83 ec 08          	sub    $0x8,%rsp
+  801890:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801893:	8b 06                	mov    (%rsi),%eax
+  801895:	8d 50 01             	lea    0x1(%rax),%edx
+  801898:	89 16                	mov    %edx,(%rsi)
+  80189a:	48 98                	cltq
+  80189c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8018a1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8018a7:	74 0a                	je     8018b3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8018a9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8018ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b1:	c9                   	leave
+  8018b2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8018b3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8018b7:	be ff 00 00 00       	mov    $0xff,%esi
+  8018bc:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  8018c3:	00 00 00 
+  8018c6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8018c8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8018ce:	eb d9                	jmp    8018a9 <putch+0x22>
+
+00000000008018d0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8018d0:	55                   	push   %rbp
+  8018d1:	48 89 e5             	mov    %rsp,%rbp
+  8018d4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8018db:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8018de:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8018e5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8018ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ef:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8018f2:	48 89 f1             	mov    %rsi,%rcx
+  8018f5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8018fc:	48 bf 87 18 80 00 00 	movabs $0x801887,%rdi
+  801903:	00 00 00 
+  801906:	48 b8 84 1a 80 00 00 	movabs $0x801a84,%rax
+  80190d:	00 00 00 
+  801910:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801912:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801919:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801920:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  801927:	00 00 00 
+  80192a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80192c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801932:	c9                   	leave
+  801933:	c3                   	ret
+
+0000000000801934 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801934:	55                   	push   %rbp
+  801935:	48 89 e5             	mov    %rsp,%rbp
+  801938:	48 83 ec 50          	sub    $0x50,%rsp
+  80193c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801940:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801944:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801948:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80194c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801950:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801957:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80195b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80195f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801963:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801967:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80196b:	48 b8 d0 18 80 00 00 	movabs $0x8018d0,%rax
+  801972:	00 00 00 
+  801975:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801977:	c9                   	leave
+  801978:	c3                   	ret
+
+0000000000801979 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801979:	55                   	push   %rbp
+  80197a:	48 89 e5             	mov    %rsp,%rbp
+  80197d:	41 57                	push   %r15
+  80197f:	41 56                	push   %r14
+  801981:	41 55                	push   %r13
+  801983:	41 54                	push   %r12
+  801985:	53                   	push   %rbx
+  801986:	48 83 ec 18          	sub    $0x18,%rsp
+  80198a:	49 89 fc             	mov    %rdi,%r12
+  80198d:	49 89 f5             	mov    %rsi,%r13
+  801990:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801994:	8b 45 10             	mov    0x10(%rbp),%eax
+  801997:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80199a:	41 89 cf             	mov    %ecx,%r15d
+  80199d:	4c 39 fa             	cmp    %r15,%rdx
+  8019a0:	73 5b                	jae    8019fd <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8019a2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8019a6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8019aa:	85 db                	test   %ebx,%ebx
+  8019ac:	7e 0e                	jle    8019bc <print_num+0x43>
+            putch(padc, put_arg);
+  8019ae:	4c 89 ee             	mov    %r13,%rsi
+  8019b1:	44 89 f7             	mov    %r14d,%edi
+  8019b4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8019b7:	83 eb 01             	sub    $0x1,%ebx
+  8019ba:	75 f2                	jne    8019ae <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8019bc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8019c0:	48 b9 a4 5e 80 00 00 	movabs $0x805ea4,%rcx
+  8019c7:	00 00 00 
+  8019ca:	48 b8 93 5e 80 00 00 	movabs $0x805e93,%rax
+  8019d1:	00 00 00 
+  8019d4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8019d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e1:	49 f7 f7             	div    %r15
+  8019e4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8019e8:	4c 89 ee             	mov    %r13,%rsi
+  8019eb:	41 ff d4             	call   *%r12
+}
+  8019ee:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019f2:	5b                   	pop    %rbx
+  8019f3:	41 5c                	pop    %r12
+  8019f5:	41 5d                	pop    %r13
+  8019f7:	41 5e                	pop    %r14
+  8019f9:	41 5f                	pop    %r15
+  8019fb:	5d                   	pop    %rbp
+  8019fc:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8019fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a01:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a06:	49 f7 f7             	div    %r15
+  801a09:	48 83 ec 08          	sub    $0x8,%rsp
+  801a0d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801a11:	52                   	push   %rdx
+  801a12:	45 0f be c9          	movsbl %r9b,%r9d
+  801a16:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801a1a:	48 89 c2             	mov    %rax,%rdx
+  801a1d:	48 b8 79 19 80 00 00 	movabs $0x801979,%rax
+  801a24:	00 00 00 
+  801a27:	ff d0                	call   *%rax
+  801a29:	48 83 c4 10          	add    $0x10,%rsp
+  801a2d:	eb 8d                	jmp    8019bc <print_num+0x43>
+
+0000000000801a2f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801a2f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801a33:	48 8b 06             	mov    (%rsi),%rax
+  801a36:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801a3a:	73 0a                	jae    801a46 <sprintputch+0x17>
+        *state->start++ = ch;
+  801a3c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a40:	48 89 16             	mov    %rdx,(%rsi)
+  801a43:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801a46:	c3                   	ret
+
+0000000000801a47 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801a47:	55                   	push   %rbp
+  801a48:	48 89 e5             	mov    %rsp,%rbp
+  801a4b:	48 83 ec 50          	sub    $0x50,%rsp
+  801a4f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a53:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a57:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801a5b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801a62:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a6a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a6e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801a72:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801a76:	48 b8 84 1a 80 00 00 	movabs $0x801a84,%rax
+  801a7d:	00 00 00 
+  801a80:	ff d0                	call   *%rax
+}
+  801a82:	c9                   	leave
+  801a83:	c3                   	ret
+
+0000000000801a84 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801a84:	55                   	push   %rbp
+  801a85:	48 89 e5             	mov    %rsp,%rbp
+  801a88:	41 57                	push   %r15
+  801a8a:	41 56                	push   %r14
+  801a8c:	41 55                	push   %r13
+  801a8e:	41 54                	push   %r12
+  801a90:	53                   	push   %rbx
+  801a91:	48 83 ec 38          	sub    $0x38,%rsp
+  801a95:	49 89 fe             	mov    %rdi,%r14
+  801a98:	49 89 f5             	mov    %rsi,%r13
+  801a9b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801a9e:	48 8b 01             	mov    (%rcx),%rax
+  801aa1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801aa5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aad:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801ab1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801ab5:	eb 0d                	jmp    801ac4 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801ab7:	40 0f b6 ff          	movzbl %dil,%edi
+  801abb:	4c 89 ee             	mov    %r13,%rsi
+  801abe:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801ac1:	4c 89 e3             	mov    %r12,%rbx
+  801ac4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801ac8:	0f b6 3b             	movzbl (%rbx),%edi
+  801acb:	40 80 ff 25          	cmp    $0x25,%dil
+  801acf:	74 14                	je     801ae5 <vprintfmt+0x61>
+            if (!ch) return;
+  801ad1:	40 84 ff             	test   %dil,%dil
+  801ad4:	75 e1                	jne    801ab7 <vprintfmt+0x33>
+}
+  801ad6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801ada:	5b                   	pop    %rbx
+  801adb:	41 5c                	pop    %r12
+  801add:	41 5d                	pop    %r13
+  801adf:	41 5e                	pop    %r14
+  801ae1:	41 5f                	pop    %r15
+  801ae3:	5d                   	pop    %rbp
+  801ae4:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801ae5:	be 00 00 00 00       	mov    $0x0,%esi
+  801aea:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801aee:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801af3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801af9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801b00:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801b04:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801b09:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801b0e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801b11:	83 e8 23             	sub    $0x23,%eax
+  801b14:	3c 57                	cmp    $0x57,%al
+  801b16:	0f 87 67 06 00 00    	ja     802183 <vprintfmt+0x6ff>
+  801b1c:	0f b6 c0             	movzbl %al,%eax
+  801b1f:	48 b9 40 60 80 00 00 	movabs $0x806040,%rcx
+  801b26:	00 00 00 
+  801b29:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801b2c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801b2f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801b33:	eb cf                	jmp    801b04 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801b35:	49 89 dc             	mov    %rbx,%r12
+  801b38:	be 01 00 00 00       	mov    $0x1,%esi
+  801b3d:	eb c5                	jmp    801b04 <vprintfmt+0x80>
+            padc = ch;
+  801b3f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801b43:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801b46:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b49:	eb b9                	jmp    801b04 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801b4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b4e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b51:	77 24                	ja     801b77 <vprintfmt+0xf3>
+  801b53:	89 c1                	mov    %eax,%ecx
+  801b55:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801b59:	83 c0 08             	add    $0x8,%eax
+  801b5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b5f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801b62:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801b65:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b69:	79 99                	jns    801b04 <vprintfmt+0x80>
+                width = precision;
+  801b6b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801b6f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801b75:	eb 8d                	jmp    801b04 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801b77:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801b7b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801b7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b83:	eb da                	jmp    801b5f <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801b85:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801b8a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b8e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801b94:	3c 39                	cmp    $0x39,%al
+  801b96:	77 1c                	ja     801bb4 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801b98:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801b9c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801ba0:	0f b6 c0             	movzbl %al,%eax
+  801ba3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ba8:	0f b6 03             	movzbl (%rbx),%eax
+  801bab:	3c 39                	cmp    $0x39,%al
+  801bad:	76 e9                	jbe    801b98 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801baf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801bb2:	eb b1                	jmp    801b65 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801bb4:	49 89 dc             	mov    %rbx,%r12
+  801bb7:	eb ac                	jmp    801b65 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801bb9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801bbc:	85 c9                	test   %ecx,%ecx
+  801bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc3:	0f 49 c1             	cmovns %ecx,%eax
+  801bc6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801bc9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801bcc:	e9 33 ff ff ff       	jmp    801b04 <vprintfmt+0x80>
+            lflag++;
+  801bd1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801bd4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801bd7:	e9 28 ff ff ff       	jmp    801b04 <vprintfmt+0x80>
+            lflag--;
+  801bdc:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801bdf:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801be2:	e9 1d ff ff ff       	jmp    801b04 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801be7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bea:	83 f8 2f             	cmp    $0x2f,%eax
+  801bed:	77 19                	ja     801c08 <vprintfmt+0x184>
+  801bef:	89 c2                	mov    %eax,%edx
+  801bf1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bf5:	83 c0 08             	add    $0x8,%eax
+  801bf8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bfb:	8b 3a                	mov    (%rdx),%edi
+  801bfd:	4c 89 ee             	mov    %r13,%rsi
+  801c00:	41 ff d6             	call   *%r14
+            break;
+  801c03:	e9 bc fe ff ff       	jmp    801ac4 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801c08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c14:	eb e5                	jmp    801bfb <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801c16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c19:	83 f8 2f             	cmp    $0x2f,%eax
+  801c1c:	77 5a                	ja     801c78 <vprintfmt+0x1f4>
+  801c1e:	89 c2                	mov    %eax,%edx
+  801c20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c24:	83 c0 08             	add    $0x8,%eax
+  801c27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801c2a:	8b 02                	mov    (%rdx),%eax
+  801c2c:	89 c1                	mov    %eax,%ecx
+  801c2e:	f7 d9                	neg    %ecx
+  801c30:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801c33:	83 f9 13             	cmp    $0x13,%ecx
+  801c36:	7f 4e                	jg     801c86 <vprintfmt+0x202>
+  801c38:	48 63 c1             	movslq %ecx,%rax
+  801c3b:	48 ba 00 63 80 00 00 	movabs $0x806300,%rdx
+  801c42:	00 00 00 
+  801c45:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801c49:	48 85 c0             	test   %rax,%rax
+  801c4c:	74 38                	je     801c86 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801c4e:	48 89 c1             	mov    %rax,%rcx
+  801c51:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  801c58:	00 00 00 
+  801c5b:	4c 89 ee             	mov    %r13,%rsi
+  801c5e:	4c 89 f7             	mov    %r14,%rdi
+  801c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c66:	49 b8 47 1a 80 00 00 	movabs $0x801a47,%r8
+  801c6d:	00 00 00 
+  801c70:	41 ff d0             	call   *%r8
+  801c73:	e9 4c fe ff ff       	jmp    801ac4 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801c78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c84:	eb a4                	jmp    801c2a <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801c86:	48 ba bc 5e 80 00 00 	movabs $0x805ebc,%rdx
+  801c8d:	00 00 00 
+  801c90:	4c 89 ee             	mov    %r13,%rsi
+  801c93:	4c 89 f7             	mov    %r14,%rdi
+  801c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9b:	49 b8 47 1a 80 00 00 	movabs $0x801a47,%r8
+  801ca2:	00 00 00 
+  801ca5:	41 ff d0             	call   *%r8
+  801ca8:	e9 17 fe ff ff       	jmp    801ac4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801cad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb0:	83 f8 2f             	cmp    $0x2f,%eax
+  801cb3:	77 6c                	ja     801d21 <vprintfmt+0x29d>
+  801cb5:	89 c2                	mov    %eax,%edx
+  801cb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cbb:	83 c0 08             	add    $0x8,%eax
+  801cbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cc1:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801cc4:	48 85 f6             	test   %rsi,%rsi
+  801cc7:	48 b8 b5 5e 80 00 00 	movabs $0x805eb5,%rax
+  801cce:	00 00 00 
+  801cd1:	48 0f 45 c6          	cmovne %rsi,%rax
+  801cd5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801cd9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801cdd:	7e 06                	jle    801ce5 <vprintfmt+0x261>
+  801cdf:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ce3:	75 4a                	jne    801d2f <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ce5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ce9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801ced:	0f b6 00             	movzbl (%rax),%eax
+  801cf0:	84 c0                	test   %al,%al
+  801cf2:	0f 85 9a 00 00 00    	jne    801d92 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801cf8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cfb:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	0f 8e bd fd ff ff    	jle    801ac4 <vprintfmt+0x40>
+  801d07:	4c 89 ee             	mov    %r13,%rsi
+  801d0a:	bf 20 00 00 00       	mov    $0x20,%edi
+  801d0f:	41 ff d6             	call   *%r14
+  801d12:	41 83 ec 01          	sub    $0x1,%r12d
+  801d16:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801d1a:	75 eb                	jne    801d07 <vprintfmt+0x283>
+  801d1c:	e9 a3 fd ff ff       	jmp    801ac4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801d21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d2d:	eb 92                	jmp    801cc1 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801d2f:	49 63 f7             	movslq %r15d,%rsi
+  801d32:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801d36:	48 b8 48 22 80 00 00 	movabs $0x802248,%rax
+  801d3d:	00 00 00 
+  801d40:	ff d0                	call   *%rax
+  801d42:	48 89 c2             	mov    %rax,%rdx
+  801d45:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801d48:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801d4a:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801d4d:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	7e 91                	jle    801ce5 <vprintfmt+0x261>
+  801d54:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801d59:	4c 89 ee             	mov    %r13,%rsi
+  801d5c:	44 89 e7             	mov    %r12d,%edi
+  801d5f:	41 ff d6             	call   *%r14
+  801d62:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801d66:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801d69:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801d6c:	75 eb                	jne    801d59 <vprintfmt+0x2d5>
+  801d6e:	e9 72 ff ff ff       	jmp    801ce5 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d73:	0f b6 f8             	movzbl %al,%edi
+  801d76:	4c 89 ee             	mov    %r13,%rsi
+  801d79:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801d7c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801d80:	49 83 c4 01          	add    $0x1,%r12
+  801d84:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801d8a:	84 c0                	test   %al,%al
+  801d8c:	0f 84 66 ff ff ff    	je     801cf8 <vprintfmt+0x274>
+  801d92:	45 85 ff             	test   %r15d,%r15d
+  801d95:	78 0a                	js     801da1 <vprintfmt+0x31d>
+  801d97:	41 83 ef 01          	sub    $0x1,%r15d
+  801d9b:	0f 88 57 ff ff ff    	js     801cf8 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801da1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801da5:	74 cc                	je     801d73 <vprintfmt+0x2ef>
+  801da7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801daa:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801daf:	80 fa 5e             	cmp    $0x5e,%dl
+  801db2:	77 c2                	ja     801d76 <vprintfmt+0x2f2>
+  801db4:	eb bd                	jmp    801d73 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801db6:	40 84 f6             	test   %sil,%sil
+  801db9:	75 26                	jne    801de1 <vprintfmt+0x35d>
+    switch (lflag) {
+  801dbb:	85 d2                	test   %edx,%edx
+  801dbd:	74 59                	je     801e18 <vprintfmt+0x394>
+  801dbf:	83 fa 01             	cmp    $0x1,%edx
+  801dc2:	74 7b                	je     801e3f <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801dc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc7:	83 f8 2f             	cmp    $0x2f,%eax
+  801dca:	0f 87 96 00 00 00    	ja     801e66 <vprintfmt+0x3e2>
+  801dd0:	89 c2                	mov    %eax,%edx
+  801dd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd6:	83 c0 08             	add    $0x8,%eax
+  801dd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ddc:	4c 8b 22             	mov    (%rdx),%r12
+  801ddf:	eb 17                	jmp    801df8 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801de1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801de4:	83 f8 2f             	cmp    $0x2f,%eax
+  801de7:	77 21                	ja     801e0a <vprintfmt+0x386>
+  801de9:	89 c2                	mov    %eax,%edx
+  801deb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801def:	83 c0 08             	add    $0x8,%eax
+  801df2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801df5:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801df8:	4d 85 e4             	test   %r12,%r12
+  801dfb:	78 7a                	js     801e77 <vprintfmt+0x3f3>
+            num = i;
+  801dfd:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801e00:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801e05:	e9 56 02 00 00       	jmp    802060 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e16:	eb dd                	jmp    801df5 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801e18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e1e:	77 11                	ja     801e31 <vprintfmt+0x3ad>
+  801e20:	89 c2                	mov    %eax,%edx
+  801e22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e26:	83 c0 08             	add    $0x8,%eax
+  801e29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e2c:	4c 63 22             	movslq (%rdx),%r12
+  801e2f:	eb c7                	jmp    801df8 <vprintfmt+0x374>
+  801e31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e3d:	eb ed                	jmp    801e2c <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801e3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e42:	83 f8 2f             	cmp    $0x2f,%eax
+  801e45:	77 11                	ja     801e58 <vprintfmt+0x3d4>
+  801e47:	89 c2                	mov    %eax,%edx
+  801e49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e4d:	83 c0 08             	add    $0x8,%eax
+  801e50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e53:	4c 8b 22             	mov    (%rdx),%r12
+  801e56:	eb a0                	jmp    801df8 <vprintfmt+0x374>
+  801e58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e64:	eb ed                	jmp    801e53 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801e66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e72:	e9 65 ff ff ff       	jmp    801ddc <vprintfmt+0x358>
+                putch('-', put_arg);
+  801e77:	4c 89 ee             	mov    %r13,%rsi
+  801e7a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801e7f:	41 ff d6             	call   *%r14
+                i = -i;
+  801e82:	49 f7 dc             	neg    %r12
+  801e85:	e9 73 ff ff ff       	jmp    801dfd <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801e8a:	40 84 f6             	test   %sil,%sil
+  801e8d:	75 2e                	jne    801ebd <vprintfmt+0x439>
+    switch (lflag) {
+  801e8f:	85 d2                	test   %edx,%edx
+  801e91:	7f 59                	jg     801eec <vprintfmt+0x468>
+  801e93:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e96:	7d 7a                	jge    801f12 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801e98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9b:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9e:	0f 87 aa 00 00 00    	ja     801f4e <vprintfmt+0x4ca>
+  801ea4:	89 c2                	mov    %eax,%edx
+  801ea6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eaa:	83 c0 08             	add    $0x8,%eax
+  801ead:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eb0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801eb3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801eb8:	e9 a3 01 00 00       	jmp    802060 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ebd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ec0:	83 f8 2f             	cmp    $0x2f,%eax
+  801ec3:	77 19                	ja     801ede <vprintfmt+0x45a>
+  801ec5:	89 c2                	mov    %eax,%edx
+  801ec7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ecb:	83 c0 08             	add    $0x8,%eax
+  801ece:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ed1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801ed4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ed9:	e9 82 01 00 00       	jmp    802060 <vprintfmt+0x5dc>
+  801ede:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ee6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eea:	eb e5                	jmp    801ed1 <vprintfmt+0x44d>
+    switch (lflag) {
+  801eec:	83 fa 01             	cmp    $0x1,%edx
+  801eef:	75 a7                	jne    801e98 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801ef1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef7:	77 47                	ja     801f40 <vprintfmt+0x4bc>
+  801ef9:	89 c2                	mov    %eax,%edx
+  801efb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eff:	83 c0 08             	add    $0x8,%eax
+  801f02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801f0d:	e9 4e 01 00 00       	jmp    802060 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f15:	83 f8 2f             	cmp    $0x2f,%eax
+  801f18:	77 18                	ja     801f32 <vprintfmt+0x4ae>
+  801f1a:	89 c2                	mov    %eax,%edx
+  801f1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f20:	83 c0 08             	add    $0x8,%eax
+  801f23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f26:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801f28:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801f2d:	e9 2e 01 00 00       	jmp    802060 <vprintfmt+0x5dc>
+  801f32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f3e:	eb e6                	jmp    801f26 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801f40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f4c:	eb b7                	jmp    801f05 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801f4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f5a:	e9 51 ff ff ff       	jmp    801eb0 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801f5f:	40 84 f6             	test   %sil,%sil
+  801f62:	75 2e                	jne    801f92 <vprintfmt+0x50e>
+    switch (lflag) {
+  801f64:	85 d2                	test   %edx,%edx
+  801f66:	7f 59                	jg     801fc1 <vprintfmt+0x53d>
+  801f68:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f6b:	7d 77                	jge    801fe4 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801f6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f70:	83 f8 2f             	cmp    $0x2f,%eax
+  801f73:	0f 87 a4 00 00 00    	ja     80201d <vprintfmt+0x599>
+  801f79:	89 c2                	mov    %eax,%edx
+  801f7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f7f:	83 c0 08             	add    $0x8,%eax
+  801f82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f88:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f8d:	e9 ce 00 00 00       	jmp    802060 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f95:	83 f8 2f             	cmp    $0x2f,%eax
+  801f98:	77 19                	ja     801fb3 <vprintfmt+0x52f>
+  801f9a:	89 c2                	mov    %eax,%edx
+  801f9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa0:	83 c0 08             	add    $0x8,%eax
+  801fa3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801fa9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801fae:	e9 ad 00 00 00       	jmp    802060 <vprintfmt+0x5dc>
+  801fb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fbf:	eb e5                	jmp    801fa6 <vprintfmt+0x522>
+    switch (lflag) {
+  801fc1:	83 fa 01             	cmp    $0x1,%edx
+  801fc4:	75 a7                	jne    801f6d <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801fc6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fc9:	83 f8 2f             	cmp    $0x2f,%eax
+  801fcc:	77 41                	ja     80200f <vprintfmt+0x58b>
+  801fce:	89 c2                	mov    %eax,%edx
+  801fd0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd4:	83 c0 08             	add    $0x8,%eax
+  801fd7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fda:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801fdd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801fe2:	eb 7c                	jmp    802060 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801fe4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fe7:	83 f8 2f             	cmp    $0x2f,%eax
+  801fea:	77 15                	ja     802001 <vprintfmt+0x57d>
+  801fec:	89 c2                	mov    %eax,%edx
+  801fee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ff2:	83 c0 08             	add    $0x8,%eax
+  801ff5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ff8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801ffa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801fff:	eb 5f                	jmp    802060 <vprintfmt+0x5dc>
+  802001:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802005:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802009:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80200d:	eb e9                	jmp    801ff8 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80200f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802013:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802017:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80201b:	eb bd                	jmp    801fda <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80201d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802021:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802025:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802029:	e9 57 ff ff ff       	jmp    801f85 <vprintfmt+0x501>
+            putch('0', put_arg);
+  80202e:	4c 89 ee             	mov    %r13,%rsi
+  802031:	bf 30 00 00 00       	mov    $0x30,%edi
+  802036:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802039:	4c 89 ee             	mov    %r13,%rsi
+  80203c:	bf 78 00 00 00       	mov    $0x78,%edi
+  802041:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802044:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802047:	83 f8 2f             	cmp    $0x2f,%eax
+  80204a:	77 47                	ja     802093 <vprintfmt+0x60f>
+  80204c:	89 c2                	mov    %eax,%edx
+  80204e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802052:	83 c0 08             	add    $0x8,%eax
+  802055:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802058:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80205b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802060:	48 83 ec 08          	sub    $0x8,%rsp
+  802064:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802068:	0f 94 c0             	sete   %al
+  80206b:	0f b6 c0             	movzbl %al,%eax
+  80206e:	50                   	push   %rax
+  80206f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802074:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802078:	4c 89 ee             	mov    %r13,%rsi
+  80207b:	4c 89 f7             	mov    %r14,%rdi
+  80207e:	48 b8 79 19 80 00 00 	movabs $0x801979,%rax
+  802085:	00 00 00 
+  802088:	ff d0                	call   *%rax
+            break;
+  80208a:	48 83 c4 10          	add    $0x10,%rsp
+  80208e:	e9 31 fa ff ff       	jmp    801ac4 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802093:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802097:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80209b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80209f:	eb b7                	jmp    802058 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8020a1:	40 84 f6             	test   %sil,%sil
+  8020a4:	75 2b                	jne    8020d1 <vprintfmt+0x64d>
+    switch (lflag) {
+  8020a6:	85 d2                	test   %edx,%edx
+  8020a8:	7f 56                	jg     802100 <vprintfmt+0x67c>
+  8020aa:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8020ad:	7d 77                	jge    802126 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8020af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8020b5:	0f 87 a7 00 00 00    	ja     802162 <vprintfmt+0x6de>
+  8020bb:	89 c2                	mov    %eax,%edx
+  8020bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020c1:	83 c0 08             	add    $0x8,%eax
+  8020c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020c7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8020ca:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8020cf:	eb 8f                	jmp    802060 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8020d7:	77 19                	ja     8020f2 <vprintfmt+0x66e>
+  8020d9:	89 c2                	mov    %eax,%edx
+  8020db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020df:	83 c0 08             	add    $0x8,%eax
+  8020e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020e5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8020e8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020ed:	e9 6e ff ff ff       	jmp    802060 <vprintfmt+0x5dc>
+  8020f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020fe:	eb e5                	jmp    8020e5 <vprintfmt+0x661>
+    switch (lflag) {
+  802100:	83 fa 01             	cmp    $0x1,%edx
+  802103:	75 aa                	jne    8020af <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802105:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802108:	83 f8 2f             	cmp    $0x2f,%eax
+  80210b:	77 47                	ja     802154 <vprintfmt+0x6d0>
+  80210d:	89 c2                	mov    %eax,%edx
+  80210f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802113:	83 c0 08             	add    $0x8,%eax
+  802116:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802119:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80211c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802121:	e9 3a ff ff ff       	jmp    802060 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802126:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802129:	83 f8 2f             	cmp    $0x2f,%eax
+  80212c:	77 18                	ja     802146 <vprintfmt+0x6c2>
+  80212e:	89 c2                	mov    %eax,%edx
+  802130:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802134:	83 c0 08             	add    $0x8,%eax
+  802137:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80213a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80213c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802141:	e9 1a ff ff ff       	jmp    802060 <vprintfmt+0x5dc>
+  802146:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80214a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80214e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802152:	eb e6                	jmp    80213a <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802154:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802158:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802160:	eb b7                	jmp    802119 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802162:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802166:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80216a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80216e:	e9 54 ff ff ff       	jmp    8020c7 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802173:	4c 89 ee             	mov    %r13,%rsi
+  802176:	bf 25 00 00 00       	mov    $0x25,%edi
+  80217b:	41 ff d6             	call   *%r14
+            break;
+  80217e:	e9 41 f9 ff ff       	jmp    801ac4 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802183:	4c 89 ee             	mov    %r13,%rsi
+  802186:	bf 25 00 00 00       	mov    $0x25,%edi
+  80218b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80218e:	48 83 eb 01          	sub    $0x1,%rbx
+  802192:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802196:	75 f6                	jne    80218e <vprintfmt+0x70a>
+  802198:	e9 27 f9 ff ff       	jmp    801ac4 <vprintfmt+0x40>
+
+000000000080219d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8021a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021a9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8021ae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8021b2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8021b9:	48 85 ff             	test   %rdi,%rdi
+  8021bc:	74 2b                	je     8021e9 <vsnprintf+0x4c>
+  8021be:	48 85 f6             	test   %rsi,%rsi
+  8021c1:	74 26                	je     8021e9 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8021c3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021c7:	48 bf 2f 1a 80 00 00 	movabs $0x801a2f,%rdi
+  8021ce:	00 00 00 
+  8021d1:	48 b8 84 1a 80 00 00 	movabs $0x801a84,%rax
+  8021d8:	00 00 00 
+  8021db:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8021dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021e1:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8021e4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8021e7:	c9                   	leave
+  8021e8:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8021e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ee:	eb f7                	jmp    8021e7 <vsnprintf+0x4a>
+
+00000000008021f0 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+  8021f4:	48 83 ec 50          	sub    $0x50,%rsp
+  8021f8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021fc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802200:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802204:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80220b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80220f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802213:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802217:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80221b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80221f:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80222b:	c9                   	leave
+  80222c:	c3                   	ret
+
+000000000080222d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80222d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802230:	74 10                	je     802242 <strlen+0x15>
+    size_t n = 0;
+  802232:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802237:	48 83 c0 01          	add    $0x1,%rax
+  80223b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80223f:	75 f6                	jne    802237 <strlen+0xa>
+  802241:	c3                   	ret
+    size_t n = 0;
+  802242:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802247:	c3                   	ret
+
+0000000000802248 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802248:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80224b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802250:	48 85 f6             	test   %rsi,%rsi
+  802253:	74 11                	je     802266 <strnlen+0x1e>
+  802255:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802259:	74 0c                	je     802267 <strnlen+0x1f>
+  80225b:	48 83 c2 01          	add    $0x1,%rdx
+  80225f:	48 39 d0             	cmp    %rdx,%rax
+  802262:	75 f1                	jne    802255 <strnlen+0xd>
+  802264:	eb 04                	jmp    80226a <strnlen+0x22>
+  802266:	c3                   	ret
+  802267:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80226a:	c3                   	ret
+
+000000000080226b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80226b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80226e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802273:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802277:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80227a:	48 83 c2 01          	add    $0x1,%rdx
+  80227e:	84 c9                	test   %cl,%cl
+  802280:	75 f1                	jne    802273 <strcpy+0x8>
+        ;
+    return res;
+}
+  802282:	c3                   	ret
+
+0000000000802283 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802283:	55                   	push   %rbp
+  802284:	48 89 e5             	mov    %rsp,%rbp
+  802287:	41 54                	push   %r12
+  802289:	53                   	push   %rbx
+  80228a:	48 89 fb             	mov    %rdi,%rbx
+  80228d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802290:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  802297:	00 00 00 
+  80229a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80229c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8022a0:	4c 89 e6             	mov    %r12,%rsi
+  8022a3:	48 b8 6b 22 80 00 00 	movabs $0x80226b,%rax
+  8022aa:	00 00 00 
+  8022ad:	ff d0                	call   *%rax
+    return dst;
+}
+  8022af:	48 89 d8             	mov    %rbx,%rax
+  8022b2:	5b                   	pop    %rbx
+  8022b3:	41 5c                	pop    %r12
+  8022b5:	5d                   	pop    %rbp
+  8022b6:	c3                   	ret
+
+00000000008022b7 <toupper>:
+
+int
+toupper(int ch) {
+  8022b7:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8022b9:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8022bc:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8022bf:	83 f9 1a             	cmp    $0x1a,%ecx
+  8022c2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8022c5:	c3                   	ret
+
+00000000008022c6 <tolower>:
+
+int
+tolower(int ch) {
+  8022c6:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8022c8:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8022cb:	8d 57 20             	lea    0x20(%rdi),%edx
+  8022ce:	83 f9 1a             	cmp    $0x1a,%ecx
+  8022d1:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8022d4:	c3                   	ret
+
+00000000008022d5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022d5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8022d8:	48 85 d2             	test   %rdx,%rdx
+  8022db:	74 1f                	je     8022fc <strncpy+0x27>
+  8022dd:	48 01 fa             	add    %rdi,%rdx
+  8022e0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8022e3:	48 83 c1 01          	add    $0x1,%rcx
+  8022e7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8022eb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8022ef:	41 80 f8 01          	cmp    $0x1,%r8b
+  8022f3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8022f7:	48 39 ca             	cmp    %rcx,%rdx
+  8022fa:	75 e7                	jne    8022e3 <strncpy+0xe>
+    }
+    return ret;
+}
+  8022fc:	c3                   	ret
+
+00000000008022fd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8022fd:	48 89 f8             	mov    %rdi,%rax
+  802300:	48 85 d2             	test   %rdx,%rdx
+  802303:	74 24                	je     802329 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802305:	48 83 ea 01          	sub    $0x1,%rdx
+  802309:	74 1b                	je     802326 <strlcpy+0x29>
+  80230b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80230f:	0f b6 16             	movzbl (%rsi),%edx
+  802312:	84 d2                	test   %dl,%dl
+  802314:	74 10                	je     802326 <strlcpy+0x29>
+            *dst++ = *src++;
+  802316:	48 83 c6 01          	add    $0x1,%rsi
+  80231a:	48 83 c0 01          	add    $0x1,%rax
+  80231e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802321:	48 39 c8             	cmp    %rcx,%rax
+  802324:	75 e9                	jne    80230f <strlcpy+0x12>
+        *dst = '\0';
+  802326:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802329:	48 29 f8             	sub    %rdi,%rax
+}
+  80232c:	c3                   	ret
+
+000000000080232d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80232d:	0f b6 07             	movzbl (%rdi),%eax
+  802330:	84 c0                	test   %al,%al
+  802332:	74 13                	je     802347 <strcmp+0x1a>
+  802334:	38 06                	cmp    %al,(%rsi)
+  802336:	75 0f                	jne    802347 <strcmp+0x1a>
+  802338:	48 83 c7 01          	add    $0x1,%rdi
+  80233c:	48 83 c6 01          	add    $0x1,%rsi
+  802340:	0f b6 07             	movzbl (%rdi),%eax
+  802343:	84 c0                	test   %al,%al
+  802345:	75 ed                	jne    802334 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802347:	0f b6 c0             	movzbl %al,%eax
+  80234a:	0f b6 16             	movzbl (%rsi),%edx
+  80234d:	29 d0                	sub    %edx,%eax
+}
+  80234f:	c3                   	ret
+
+0000000000802350 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802350:	48 85 d2             	test   %rdx,%rdx
+  802353:	74 1f                	je     802374 <strncmp+0x24>
+  802355:	0f b6 07             	movzbl (%rdi),%eax
+  802358:	84 c0                	test   %al,%al
+  80235a:	74 1e                	je     80237a <strncmp+0x2a>
+  80235c:	3a 06                	cmp    (%rsi),%al
+  80235e:	75 1a                	jne    80237a <strncmp+0x2a>
+  802360:	48 83 c7 01          	add    $0x1,%rdi
+  802364:	48 83 c6 01          	add    $0x1,%rsi
+  802368:	48 83 ea 01          	sub    $0x1,%rdx
+  80236c:	75 e7                	jne    802355 <strncmp+0x5>
+
+    if (!n) return 0;
+  80236e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802373:	c3                   	ret
+  802374:	b8 00 00 00 00       	mov    $0x0,%eax
+  802379:	c3                   	ret
+  80237a:	48 85 d2             	test   %rdx,%rdx
+  80237d:	74 09                	je     802388 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80237f:	0f b6 07             	movzbl (%rdi),%eax
+  802382:	0f b6 16             	movzbl (%rsi),%edx
+  802385:	29 d0                	sub    %edx,%eax
+  802387:	c3                   	ret
+    if (!n) return 0;
+  802388:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80238d:	c3                   	ret
+
+000000000080238e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80238e:	0f b6 17             	movzbl (%rdi),%edx
+  802391:	84 d2                	test   %dl,%dl
+  802393:	74 18                	je     8023ad <strchr+0x1f>
+        if (*str == c) {
+  802395:	0f be d2             	movsbl %dl,%edx
+  802398:	39 f2                	cmp    %esi,%edx
+  80239a:	74 17                	je     8023b3 <strchr+0x25>
+    for (; *str; str++) {
+  80239c:	48 83 c7 01          	add    $0x1,%rdi
+  8023a0:	0f b6 17             	movzbl (%rdi),%edx
+  8023a3:	84 d2                	test   %dl,%dl
+  8023a5:	75 ee                	jne    802395 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8023a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ac:	c3                   	ret
+  8023ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b2:	c3                   	ret
+  8023b3:	48 89 f8             	mov    %rdi,%rax
+}
+  8023b6:	c3                   	ret
+
+00000000008023b7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8023b7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8023ba:	0f b6 17             	movzbl (%rdi),%edx
+  8023bd:	84 d2                	test   %dl,%dl
+  8023bf:	74 13                	je     8023d4 <strfind+0x1d>
+  8023c1:	0f be d2             	movsbl %dl,%edx
+  8023c4:	39 f2                	cmp    %esi,%edx
+  8023c6:	74 0b                	je     8023d3 <strfind+0x1c>
+  8023c8:	48 83 c0 01          	add    $0x1,%rax
+  8023cc:	0f b6 10             	movzbl (%rax),%edx
+  8023cf:	84 d2                	test   %dl,%dl
+  8023d1:	75 ee                	jne    8023c1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8023d3:	c3                   	ret
+  8023d4:	c3                   	ret
+
+00000000008023d5 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8023d5:	48 39 f7             	cmp    %rsi,%rdi
+  8023d8:	74 65                	je     80243f <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8023da:	55                   	push   %rbp
+  8023db:	48 89 e5             	mov    %rsp,%rbp
+  8023de:	41 57                	push   %r15
+  8023e0:	41 56                	push   %r14
+  8023e2:	41 55                	push   %r13
+  8023e4:	41 54                	push   %r12
+  8023e6:	53                   	push   %rbx
+  8023e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023eb:	48 89 fb             	mov    %rdi,%rbx
+  8023ee:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8023f1:	49 bf c6 22 80 00 00 	movabs $0x8022c6,%r15
+  8023f8:	00 00 00 
+  8023fb:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8023ff:	41 0f b6 fd          	movzbl %r13b,%edi
+  802403:	41 ff d7             	call   *%r15
+  802406:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802409:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80240e:	41 0f b6 fe          	movzbl %r14b,%edi
+  802412:	41 ff d7             	call   *%r15
+  802415:	89 c2                	mov    %eax,%edx
+  802417:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80241a:	29 d0                	sub    %edx,%eax
+  80241c:	75 12                	jne    802430 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80241e:	48 83 c3 01          	add    $0x1,%rbx
+  802422:	45 84 ed             	test   %r13b,%r13b
+  802425:	74 09                	je     802430 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802427:	49 83 c4 01          	add    $0x1,%r12
+  80242b:	45 84 f6             	test   %r14b,%r14b
+  80242e:	75 cb                	jne    8023fb <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802430:	48 83 c4 18          	add    $0x18,%rsp
+  802434:	5b                   	pop    %rbx
+  802435:	41 5c                	pop    %r12
+  802437:	41 5d                	pop    %r13
+  802439:	41 5e                	pop    %r14
+  80243b:	41 5f                	pop    %r15
+  80243d:	5d                   	pop    %rbp
+  80243e:	c3                   	ret
+    if (p1 == p2) return 0;
+  80243f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802444:	c3                   	ret
+
+0000000000802445 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802445:	48 39 f7             	cmp    %rsi,%rdi
+  802448:	74 7d                	je     8024c7 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80244a:	55                   	push   %rbp
+  80244b:	48 89 e5             	mov    %rsp,%rbp
+  80244e:	41 57                	push   %r15
+  802450:	41 56                	push   %r14
+  802452:	41 55                	push   %r13
+  802454:	41 54                	push   %r12
+  802456:	53                   	push   %rbx
+  802457:	48 83 ec 18          	sub    $0x18,%rsp
+  80245b:	48 89 fb             	mov    %rdi,%rbx
+  80245e:	49 89 f4             	mov    %rsi,%r12
+  802461:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802465:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802469:	49 bf c6 22 80 00 00 	movabs $0x8022c6,%r15
+  802470:	00 00 00 
+    while (n--) {
+  802473:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802477:	48 39 c3             	cmp    %rax,%rbx
+  80247a:	74 37                	je     8024b3 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80247c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802480:	41 0f b6 fd          	movzbl %r13b,%edi
+  802484:	41 ff d7             	call   *%r15
+  802487:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80248a:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80248f:	41 0f b6 fe          	movzbl %r14b,%edi
+  802493:	41 ff d7             	call   *%r15
+  802496:	89 c2                	mov    %eax,%edx
+  802498:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80249b:	29 d0                	sub    %edx,%eax
+  80249d:	75 19                	jne    8024b8 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80249f:	48 83 c3 01          	add    $0x1,%rbx
+  8024a3:	45 84 ed             	test   %r13b,%r13b
+  8024a6:	74 10                	je     8024b8 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8024a8:	49 83 c4 01          	add    $0x1,%r12
+  8024ac:	45 84 f6             	test   %r14b,%r14b
+  8024af:	75 c2                	jne    802473 <strncasecmp+0x2e>
+  8024b1:	eb 05                	jmp    8024b8 <strncasecmp+0x73>
+  8024b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8024b8:	48 83 c4 18          	add    $0x18,%rsp
+  8024bc:	5b                   	pop    %rbx
+  8024bd:	41 5c                	pop    %r12
+  8024bf:	41 5d                	pop    %r13
+  8024c1:	41 5e                	pop    %r14
+  8024c3:	41 5f                	pop    %r15
+  8024c5:	5d                   	pop    %rbp
+  8024c6:	c3                   	ret
+    if (p1 == p2) return 0;
+  8024c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024cc:	c3                   	ret
+
+00000000008024cd <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8024cd:	83 e7 df             	and    $0xffffffdf,%edi
+  8024d0:	83 ef 41             	sub    $0x41,%edi
+  8024d3:	83 ff 19             	cmp    $0x19,%edi
+  8024d6:	0f 96 c0             	setbe  %al
+}
+  8024d9:	c3                   	ret
+
+00000000008024da <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8024da:	83 ff 20             	cmp    $0x20,%edi
+  8024dd:	0f 94 c0             	sete   %al
+  8024e0:	83 ff 09             	cmp    $0x9,%edi
+  8024e3:	0f 94 c2             	sete   %dl
+  8024e6:	09 d0                	or     %edx,%eax
+}
+  8024e8:	c3                   	ret
+
+00000000008024e9 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8024e9:	55                   	push   %rbp
+  8024ea:	48 89 e5             	mov    %rsp,%rbp
+  8024ed:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8024ef:	48 bf bf 63 80 00 00 	movabs $0x8063bf,%rdi
+  8024f6:	00 00 00 
+  8024f9:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  802500:	00 00 00 
+  802503:	ff d0                	call   *%rax
+  802505:	48 85 c0             	test   %rax,%rax
+  802508:	0f 95 c0             	setne  %al
+}
+  80250b:	5d                   	pop    %rbp
+  80250c:	c3                   	ret
+
+000000000080250d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80250d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802510:	48 89 f8             	mov    %rdi,%rax
+  802513:	48 f7 d8             	neg    %rax
+  802516:	83 e0 07             	and    $0x7,%eax
+  802519:	49 89 d1             	mov    %rdx,%r9
+  80251c:	49 29 c1             	sub    %rax,%r9
+  80251f:	78 36                	js     802557 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802521:	40 0f b6 c6          	movzbl %sil,%eax
+  802525:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80252c:	01 01 01 
+  80252f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802533:	40 f6 c7 07          	test   $0x7,%dil
+  802537:	75 38                	jne    802571 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802539:	4c 89 c9             	mov    %r9,%rcx
+  80253c:	48 c1 f9 03          	sar    $0x3,%rcx
+  802540:	74 0c                	je     80254e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802542:	fc                   	cld
+  802543:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802546:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80254a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80254e:	4d 85 c9             	test   %r9,%r9
+  802551:	75 45                	jne    802598 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802553:	4c 89 c0             	mov    %r8,%rax
+  802556:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802557:	48 85 d2             	test   %rdx,%rdx
+  80255a:	74 f7                	je     802553 <memset+0x46>
+  80255c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80255f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802562:	48 83 c0 01          	add    $0x1,%rax
+  802566:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80256a:	48 39 c2             	cmp    %rax,%rdx
+  80256d:	75 f3                	jne    802562 <memset+0x55>
+  80256f:	eb e2                	jmp    802553 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802571:	40 f6 c7 01          	test   $0x1,%dil
+  802575:	74 06                	je     80257d <memset+0x70>
+  802577:	88 07                	mov    %al,(%rdi)
+  802579:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80257d:	40 f6 c7 02          	test   $0x2,%dil
+  802581:	74 07                	je     80258a <memset+0x7d>
+  802583:	66 89 07             	mov    %ax,(%rdi)
+  802586:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80258a:	40 f6 c7 04          	test   $0x4,%dil
+  80258e:	74 a9                	je     802539 <memset+0x2c>
+  802590:	89 07                	mov    %eax,(%rdi)
+  802592:	48 83 c7 04          	add    $0x4,%rdi
+  802596:	eb a1                	jmp    802539 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802598:	41 f6 c1 04          	test   $0x4,%r9b
+  80259c:	74 06                	je     8025a4 <memset+0x97>
+  80259e:	89 07                	mov    %eax,(%rdi)
+  8025a0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8025a4:	41 f6 c1 02          	test   $0x2,%r9b
+  8025a8:	74 07                	je     8025b1 <memset+0xa4>
+  8025aa:	66 89 07             	mov    %ax,(%rdi)
+  8025ad:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8025b1:	41 f6 c1 01          	test   $0x1,%r9b
+  8025b5:	74 9c                	je     802553 <memset+0x46>
+  8025b7:	88 07                	mov    %al,(%rdi)
+  8025b9:	eb 98                	jmp    802553 <memset+0x46>
+
+00000000008025bb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8025bb:	48 89 f8             	mov    %rdi,%rax
+  8025be:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8025c1:	48 39 fe             	cmp    %rdi,%rsi
+  8025c4:	73 3b                	jae    802601 <memmove+0x46>
+  8025c6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8025ca:	48 39 d7             	cmp    %rdx,%rdi
+  8025cd:	73 32                	jae    802601 <memmove+0x46>
+        s += n;
+        d += n;
+  8025cf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8025d3:	48 89 d6             	mov    %rdx,%rsi
+  8025d6:	48 09 fe             	or     %rdi,%rsi
+  8025d9:	48 09 ce             	or     %rcx,%rsi
+  8025dc:	40 f6 c6 07          	test   $0x7,%sil
+  8025e0:	75 12                	jne    8025f4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8025e2:	48 83 ef 08          	sub    $0x8,%rdi
+  8025e6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8025ea:	48 c1 e9 03          	shr    $0x3,%rcx
+  8025ee:	fd                   	std
+  8025ef:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8025f2:	fc                   	cld
+  8025f3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8025f4:	48 83 ef 01          	sub    $0x1,%rdi
+  8025f8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8025fc:	fd                   	std
+  8025fd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8025ff:	eb f1                	jmp    8025f2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802601:	48 89 f2             	mov    %rsi,%rdx
+  802604:	48 09 c2             	or     %rax,%rdx
+  802607:	48 09 ca             	or     %rcx,%rdx
+  80260a:	f6 c2 07             	test   $0x7,%dl
+  80260d:	75 0c                	jne    80261b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80260f:	48 c1 e9 03          	shr    $0x3,%rcx
+  802613:	48 89 c7             	mov    %rax,%rdi
+  802616:	fc                   	cld
+  802617:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80261a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80261b:	48 89 c7             	mov    %rax,%rdi
+  80261e:	fc                   	cld
+  80261f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802621:	c3                   	ret
+
+0000000000802622 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802622:	55                   	push   %rbp
+  802623:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802626:	48 b8 bb 25 80 00 00 	movabs $0x8025bb,%rax
+  80262d:	00 00 00 
+  802630:	ff d0                	call   *%rax
+}
+  802632:	5d                   	pop    %rbp
+  802633:	c3                   	ret
+
+0000000000802634 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802634:	55                   	push   %rbp
+  802635:	48 89 e5             	mov    %rsp,%rbp
+  802638:	41 57                	push   %r15
+  80263a:	41 56                	push   %r14
+  80263c:	41 55                	push   %r13
+  80263e:	41 54                	push   %r12
+  802640:	53                   	push   %rbx
+  802641:	48 83 ec 08          	sub    $0x8,%rsp
+  802645:	49 89 fe             	mov    %rdi,%r14
+  802648:	49 89 f7             	mov    %rsi,%r15
+  80264b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80264e:	48 89 f7             	mov    %rsi,%rdi
+  802651:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  802658:	00 00 00 
+  80265b:	ff d0                	call   *%rax
+  80265d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802660:	48 89 de             	mov    %rbx,%rsi
+  802663:	4c 89 f7             	mov    %r14,%rdi
+  802666:	48 b8 48 22 80 00 00 	movabs $0x802248,%rax
+  80266d:	00 00 00 
+  802670:	ff d0                	call   *%rax
+  802672:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802675:	48 39 c3             	cmp    %rax,%rbx
+  802678:	74 36                	je     8026b0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80267a:	48 89 d8             	mov    %rbx,%rax
+  80267d:	4c 29 e8             	sub    %r13,%rax
+  802680:	49 39 c4             	cmp    %rax,%r12
+  802683:	73 31                	jae    8026b6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802685:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80268a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80268e:	4c 89 fe             	mov    %r15,%rsi
+  802691:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  802698:	00 00 00 
+  80269b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80269d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8026a1:	48 83 c4 08          	add    $0x8,%rsp
+  8026a5:	5b                   	pop    %rbx
+  8026a6:	41 5c                	pop    %r12
+  8026a8:	41 5d                	pop    %r13
+  8026aa:	41 5e                	pop    %r14
+  8026ac:	41 5f                	pop    %r15
+  8026ae:	5d                   	pop    %rbp
+  8026af:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8026b0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8026b4:	eb eb                	jmp    8026a1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8026b6:	48 83 eb 01          	sub    $0x1,%rbx
+  8026ba:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8026be:	48 89 da             	mov    %rbx,%rdx
+  8026c1:	4c 89 fe             	mov    %r15,%rsi
+  8026c4:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8026d0:	49 01 de             	add    %rbx,%r14
+  8026d3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8026d8:	eb c3                	jmp    80269d <strlcat+0x69>
+
+00000000008026da <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8026da:	48 85 d2             	test   %rdx,%rdx
+  8026dd:	74 2d                	je     80270c <memcmp+0x32>
+  8026df:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8026e4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8026e8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8026ed:	44 38 c1             	cmp    %r8b,%cl
+  8026f0:	75 0f                	jne    802701 <memcmp+0x27>
+    while (n-- > 0) {
+  8026f2:	48 83 c0 01          	add    $0x1,%rax
+  8026f6:	48 39 c2             	cmp    %rax,%rdx
+  8026f9:	75 e9                	jne    8026e4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8026fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802700:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802701:	0f b6 c1             	movzbl %cl,%eax
+  802704:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802708:	44 29 c0             	sub    %r8d,%eax
+  80270b:	c3                   	ret
+    return 0;
+  80270c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802711:	c3                   	ret
+
+0000000000802712 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802712:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802716:	48 39 c7             	cmp    %rax,%rdi
+  802719:	73 0f                	jae    80272a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80271b:	40 38 37             	cmp    %sil,(%rdi)
+  80271e:	74 0e                	je     80272e <memfind+0x1c>
+    for (; src < end; src++) {
+  802720:	48 83 c7 01          	add    $0x1,%rdi
+  802724:	48 39 f8             	cmp    %rdi,%rax
+  802727:	75 f2                	jne    80271b <memfind+0x9>
+  802729:	c3                   	ret
+  80272a:	48 89 f8             	mov    %rdi,%rax
+  80272d:	c3                   	ret
+  80272e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802731:	c3                   	ret
+
+0000000000802732 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802732:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802735:	0f b6 37             	movzbl (%rdi),%esi
+  802738:	40 80 fe 20          	cmp    $0x20,%sil
+  80273c:	74 06                	je     802744 <strtol+0x12>
+  80273e:	40 80 fe 09          	cmp    $0x9,%sil
+  802742:	75 13                	jne    802757 <strtol+0x25>
+  802744:	48 83 c7 01          	add    $0x1,%rdi
+  802748:	0f b6 37             	movzbl (%rdi),%esi
+  80274b:	40 80 fe 20          	cmp    $0x20,%sil
+  80274f:	74 f3                	je     802744 <strtol+0x12>
+  802751:	40 80 fe 09          	cmp    $0x9,%sil
+  802755:	74 ed                	je     802744 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802757:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80275a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80275d:	3c 01                	cmp    $0x1,%al
+  80275f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802763:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802769:	75 0f                	jne    80277a <strtol+0x48>
+  80276b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80276e:	74 14                	je     802784 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802770:	85 d2                	test   %edx,%edx
+  802772:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802777:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80277a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80277f:	4c 63 ca             	movslq %edx,%r9
+  802782:	eb 36                	jmp    8027ba <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802784:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802788:	74 0f                	je     802799 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80278a:	85 d2                	test   %edx,%edx
+  80278c:	75 ec                	jne    80277a <strtol+0x48>
+        s++;
+  80278e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802792:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802797:	eb e1                	jmp    80277a <strtol+0x48>
+        s += 2;
+  802799:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80279d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8027a2:	eb d6                	jmp    80277a <strtol+0x48>
+            dig -= '0';
+  8027a4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8027a7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8027ab:	41 39 d0             	cmp    %edx,%r8d
+  8027ae:	7d 21                	jge    8027d1 <strtol+0x9f>
+        val = val * base + dig;
+  8027b0:	49 0f af c1          	imul   %r9,%rax
+  8027b4:	0f b6 c9             	movzbl %cl,%ecx
+  8027b7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8027ba:	48 83 c7 01          	add    $0x1,%rdi
+  8027be:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8027c2:	80 f9 39             	cmp    $0x39,%cl
+  8027c5:	76 dd                	jbe    8027a4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8027c7:	80 f9 7b             	cmp    $0x7b,%cl
+  8027ca:	77 05                	ja     8027d1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8027cc:	83 e9 57             	sub    $0x57,%ecx
+  8027cf:	eb d6                	jmp    8027a7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8027d1:	4d 85 d2             	test   %r10,%r10
+  8027d4:	74 03                	je     8027d9 <strtol+0xa7>
+  8027d6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8027d9:	48 89 c2             	mov    %rax,%rdx
+  8027dc:	48 f7 da             	neg    %rdx
+  8027df:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8027e3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8027e7:	c3                   	ret
+
+00000000008027e8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8027e8:	55                   	push   %rbp
+  8027e9:	48 89 e5             	mov    %rsp,%rbp
+  8027ec:	53                   	push   %rbx
+  8027ed:	48 89 fa             	mov    %rdi,%rdx
+  8027f0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8027f3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802802:	be 00 00 00 00       	mov    $0x0,%esi
+  802807:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80280d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802813:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802815:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802819:	c9                   	leave
+  80281a:	c3                   	ret
+
+000000000080281b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80281b:	55                   	push   %rbp
+  80281c:	48 89 e5             	mov    %rsp,%rbp
+  80281f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802820:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802825:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80282f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802834:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802839:	be 00 00 00 00       	mov    $0x0,%esi
+  80283e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802844:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80284a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80284c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802850:	c9                   	leave
+  802851:	c3                   	ret
+
+0000000000802852 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802852:	55                   	push   %rbp
+  802853:	48 89 e5             	mov    %rsp,%rbp
+  802856:	53                   	push   %rbx
+  802857:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80285a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80285f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802864:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802869:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80286e:	be 00 00 00 00       	mov    $0x0,%esi
+  802873:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802879:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80287f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802881:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+0000000000802887 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	53                   	push   %rbx
+  80288c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802890:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802893:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802898:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80289d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028ba:	48 85 c0             	test   %rax,%rax
+  8028bd:	7f 06                	jg     8028c5 <sys_env_destroy+0x3e>
+}
+  8028bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c3:	c9                   	leave
+  8028c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028c5:	49 89 c0             	mov    %rax,%r8
+  8028c8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8028cd:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  8028d4:	00 00 00 
+  8028d7:	be 27 00 00 00       	mov    $0x27,%esi
+  8028dc:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  8028e3:	00 00 00 
+  8028e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028eb:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  8028f2:	00 00 00 
+  8028f5:	41 ff d1             	call   *%r9
+
+00000000008028f8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8028f8:	55                   	push   %rbp
+  8028f9:	48 89 e5             	mov    %rsp,%rbp
+  8028fc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028fd:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802902:	ba 00 00 00 00       	mov    $0x0,%edx
+  802907:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80290c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802911:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802916:	be 00 00 00 00       	mov    $0x0,%esi
+  80291b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802921:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802927:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802929:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80292d:	c9                   	leave
+  80292e:	c3                   	ret
+
+000000000080292f <sys_yield>:
+
+void
+sys_yield(void) {
+  80292f:	55                   	push   %rbp
+  802930:	48 89 e5             	mov    %rsp,%rbp
+  802933:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802934:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802939:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802943:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802948:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80294d:	be 00 00 00 00       	mov    $0x0,%esi
+  802952:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802958:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80295e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802960:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802964:	c9                   	leave
+  802965:	c3                   	ret
+
+0000000000802966 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802966:	55                   	push   %rbp
+  802967:	48 89 e5             	mov    %rsp,%rbp
+  80296a:	53                   	push   %rbx
+  80296b:	48 89 fa             	mov    %rdi,%rdx
+  80296e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802971:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802976:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80297d:	00 00 00 
+  802980:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802985:	be 00 00 00 00       	mov    $0x0,%esi
+  80298a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802990:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802996:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802998:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80299c:	c9                   	leave
+  80299d:	c3                   	ret
+
+000000000080299e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80299e:	55                   	push   %rbp
+  80299f:	48 89 e5             	mov    %rsp,%rbp
+  8029a2:	53                   	push   %rbx
+  8029a3:	49 89 f8             	mov    %rdi,%r8
+  8029a6:	48 89 d3             	mov    %rdx,%rbx
+  8029a9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8029ac:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029b1:	4c 89 c2             	mov    %r8,%rdx
+  8029b4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029c8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8029ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ce:	c9                   	leave
+  8029cf:	c3                   	ret
+
+00000000008029d0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8029d0:	55                   	push   %rbp
+  8029d1:	48 89 e5             	mov    %rsp,%rbp
+  8029d4:	53                   	push   %rbx
+  8029d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d9:	89 f8                	mov    %edi,%eax
+  8029db:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8029de:	48 63 f9             	movslq %ecx,%rdi
+  8029e1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029e4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029e9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029ff:	48 85 c0             	test   %rax,%rax
+  802a02:	7f 06                	jg     802a0a <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802a04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a08:	c9                   	leave
+  802a09:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a0a:	49 89 c0             	mov    %rax,%r8
+  802a0d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802a12:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802a19:	00 00 00 
+  802a1c:	be 27 00 00 00       	mov    $0x27,%esi
+  802a21:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802a28:	00 00 00 
+  802a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a30:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802a37:	00 00 00 
+  802a3a:	41 ff d1             	call   *%r9
+
+0000000000802a3d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802a3d:	55                   	push   %rbp
+  802a3e:	48 89 e5             	mov    %rsp,%rbp
+  802a41:	53                   	push   %rbx
+  802a42:	48 83 ec 08          	sub    $0x8,%rsp
+  802a46:	89 f8                	mov    %edi,%eax
+  802a48:	49 89 f2             	mov    %rsi,%r10
+  802a4b:	48 89 cf             	mov    %rcx,%rdi
+  802a4e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802a51:	48 63 da             	movslq %edx,%rbx
+  802a54:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a57:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a5c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a5f:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802a62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a68:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a6a:	48 85 c0             	test   %rax,%rax
+  802a6d:	7f 06                	jg     802a75 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802a6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a73:	c9                   	leave
+  802a74:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a75:	49 89 c0             	mov    %rax,%r8
+  802a78:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802a7d:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802a84:	00 00 00 
+  802a87:	be 27 00 00 00       	mov    $0x27,%esi
+  802a8c:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802a93:	00 00 00 
+  802a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9b:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802aa2:	00 00 00 
+  802aa5:	41 ff d1             	call   *%r9
+
+0000000000802aa8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	53                   	push   %rbx
+  802aad:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab1:	48 89 f1             	mov    %rsi,%rcx
+  802ab4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802ab7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aba:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802abf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802acf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ad7:	48 85 c0             	test   %rax,%rax
+  802ada:	7f 06                	jg     802ae2 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802adc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ae0:	c9                   	leave
+  802ae1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ae2:	49 89 c0             	mov    %rax,%r8
+  802ae5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802aea:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802af1:	00 00 00 
+  802af4:	be 27 00 00 00       	mov    $0x27,%esi
+  802af9:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802b00:	00 00 00 
+  802b03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b08:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802b0f:	00 00 00 
+  802b12:	41 ff d1             	call   *%r9
+
+0000000000802b15 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802b15:	55                   	push   %rbp
+  802b16:	48 89 e5             	mov    %rsp,%rbp
+  802b19:	53                   	push   %rbx
+  802b1a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802b1e:	48 63 ce             	movslq %esi,%rcx
+  802b21:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b24:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b2e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b33:	be 00 00 00 00       	mov    $0x0,%esi
+  802b38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b44:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b46:	48 85 c0             	test   %rax,%rax
+  802b49:	7f 06                	jg     802b51 <sys_env_set_status+0x3c>
+}
+  802b4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4f:	c9                   	leave
+  802b50:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b51:	49 89 c0             	mov    %rax,%r8
+  802b54:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802b59:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802b60:	00 00 00 
+  802b63:	be 27 00 00 00       	mov    $0x27,%esi
+  802b68:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802b6f:	00 00 00 
+  802b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b77:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802b7e:	00 00 00 
+  802b81:	41 ff d1             	call   *%r9
+
+0000000000802b84 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802b84:	55                   	push   %rbp
+  802b85:	48 89 e5             	mov    %rsp,%rbp
+  802b88:	53                   	push   %rbx
+  802b89:	48 83 ec 08          	sub    $0x8,%rsp
+  802b8d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802b90:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b93:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ba2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bb3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bb5:	48 85 c0             	test   %rax,%rax
+  802bb8:	7f 06                	jg     802bc0 <sys_env_set_trapframe+0x3c>
+}
+  802bba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bbe:	c9                   	leave
+  802bbf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bc0:	49 89 c0             	mov    %rax,%r8
+  802bc3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802bc8:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802bcf:	00 00 00 
+  802bd2:	be 27 00 00 00       	mov    $0x27,%esi
+  802bd7:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802bde:	00 00 00 
+  802be1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be6:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802bed:	00 00 00 
+  802bf0:	41 ff d1             	call   *%r9
+
+0000000000802bf3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802bf3:	55                   	push   %rbp
+  802bf4:	48 89 e5             	mov    %rsp,%rbp
+  802bf7:	53                   	push   %rbx
+  802bf8:	48 83 ec 08          	sub    $0x8,%rsp
+  802bfc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802bff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c02:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c0c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c11:	be 00 00 00 00       	mov    $0x0,%esi
+  802c16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c22:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c24:	48 85 c0             	test   %rax,%rax
+  802c27:	7f 06                	jg     802c2f <sys_env_set_pgfault_upcall+0x3c>
+}
+  802c29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c2f:	49 89 c0             	mov    %rax,%r8
+  802c32:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802c37:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802c3e:	00 00 00 
+  802c41:	be 27 00 00 00       	mov    $0x27,%esi
+  802c46:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802c4d:	00 00 00 
+  802c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c55:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802c5c:	00 00 00 
+  802c5f:	41 ff d1             	call   *%r9
+
+0000000000802c62 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802c62:	55                   	push   %rbp
+  802c63:	48 89 e5             	mov    %rsp,%rbp
+  802c66:	53                   	push   %rbx
+  802c67:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802c6b:	40 0f b6 ce          	movzbl %sil,%ecx
+  802c6f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c72:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c7c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c81:	be 00 00 00 00       	mov    $0x0,%esi
+  802c86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c8c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c94:	48 85 c0             	test   %rax,%rax
+  802c97:	7f 06                	jg     802c9f <sys_env_set_reclaim+0x3d>
+}
+  802c99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c9d:	c9                   	leave
+  802c9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c9f:	49 89 c0             	mov    %rax,%r8
+  802ca2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802ca7:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802cae:	00 00 00 
+  802cb1:	be 27 00 00 00       	mov    $0x27,%esi
+  802cb6:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802cbd:	00 00 00 
+  802cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc5:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802ccc:	00 00 00 
+  802ccf:	41 ff d1             	call   *%r9
+
+0000000000802cd2 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802cd2:	55                   	push   %rbp
+  802cd3:	48 89 e5             	mov    %rsp,%rbp
+  802cd6:	53                   	push   %rbx
+  802cd7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802cdb:	48 63 ce             	movslq %esi,%rcx
+  802cde:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ce1:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ce6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ceb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cf0:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cfb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d01:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d03:	48 85 c0             	test   %rax,%rax
+  802d06:	7f 06                	jg     802d0e <sys_env_set_nice+0x3c>
+}
+  802d08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d0c:	c9                   	leave
+  802d0d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d0e:	49 89 c0             	mov    %rax,%r8
+  802d11:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802d16:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802d1d:	00 00 00 
+  802d20:	be 27 00 00 00       	mov    $0x27,%esi
+  802d25:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802d2c:	00 00 00 
+  802d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d34:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802d3b:	00 00 00 
+  802d3e:	41 ff d1             	call   *%r9
+
+0000000000802d41 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802d41:	55                   	push   %rbp
+  802d42:	48 89 e5             	mov    %rsp,%rbp
+  802d45:	53                   	push   %rbx
+  802d46:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d49:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d5d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d6e:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802d70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+0000000000802d76 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d76:	55                   	push   %rbp
+  802d77:	48 89 e5             	mov    %rsp,%rbp
+  802d7a:	53                   	push   %rbx
+  802d7b:	89 f8                	mov    %edi,%eax
+  802d7d:	49 89 f1             	mov    %rsi,%r9
+  802d80:	48 89 d3             	mov    %rdx,%rbx
+  802d83:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d86:	49 63 f0             	movslq %r8d,%rsi
+  802d89:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d8c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d91:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da0:	cd 30                	int    $0x30
+}
+  802da2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da6:	c9                   	leave
+  802da7:	c3                   	ret
+
+0000000000802da8 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802da8:	55                   	push   %rbp
+  802da9:	48 89 e5             	mov    %rsp,%rbp
+  802dac:	53                   	push   %rbx
+  802dad:	89 f8                	mov    %edi,%eax
+  802daf:	49 89 f1             	mov    %rsi,%r9
+  802db2:	48 89 d3             	mov    %rdx,%rbx
+  802db5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802db8:	49 63 f0             	movslq %r8d,%rsi
+  802dbb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dbe:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dc3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dcc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dd2:	cd 30                	int    $0x30
+}
+  802dd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dd8:	c9                   	leave
+  802dd9:	c3                   	ret
+
+0000000000802dda <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	53                   	push   %rbx
+  802ddf:	48 83 ec 08          	sub    $0x8,%rsp
+  802de3:	89 f8                	mov    %edi,%eax
+  802de5:	49 89 f2             	mov    %rsi,%r10
+  802de8:	48 89 d3             	mov    %rdx,%rbx
+  802deb:	48 89 cf             	mov    %rcx,%rdi
+  802dee:	44 89 c6             	mov    %r8d,%esi
+  802df1:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802df4:	48 63 f6             	movslq %esi,%rsi
+  802df7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dfa:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dff:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e02:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e06:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e08:	48 85 c0             	test   %rax,%rax
+  802e0b:	7f 06                	jg     802e13 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e11:	c9                   	leave
+  802e12:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e13:	49 89 c0             	mov    %rax,%r8
+  802e16:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802e1b:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802e22:	00 00 00 
+  802e25:	be 27 00 00 00       	mov    $0x27,%esi
+  802e2a:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802e31:	00 00 00 
+  802e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e39:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802e40:	00 00 00 
+  802e43:	41 ff d1             	call   *%r9
+
+0000000000802e46 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802e46:	55                   	push   %rbp
+  802e47:	48 89 e5             	mov    %rsp,%rbp
+  802e4a:	53                   	push   %rbx
+  802e4b:	48 83 ec 08          	sub    $0x8,%rsp
+  802e4f:	48 89 f1             	mov    %rsi,%rcx
+  802e52:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802e55:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802e59:	48 8b 1a             	mov    (%rdx),%rbx
+  802e5c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e5f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e64:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e68:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802e6c:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802e70:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e72:	48 85 c0             	test   %rax,%rax
+  802e75:	7f 06                	jg     802e7d <sys_ipc_call_short+0x37>
+}
+  802e77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e7b:	c9                   	leave
+  802e7c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e7d:	49 89 c0             	mov    %rax,%r8
+  802e80:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802e85:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802e8c:	00 00 00 
+  802e8f:	be 27 00 00 00       	mov    $0x27,%esi
+  802e94:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802e9b:	00 00 00 
+  802e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea3:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802eaa:	00 00 00 
+  802ead:	41 ff d1             	call   *%r9
+
+0000000000802eb0 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802eb0:	55                   	push   %rbp
+  802eb1:	48 89 e5             	mov    %rsp,%rbp
+  802eb4:	53                   	push   %rbx
+  802eb5:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb9:	89 f8                	mov    %edi,%eax
+  802ebb:	49 89 f2             	mov    %rsi,%r10
+  802ebe:	48 89 d3             	mov    %rdx,%rbx
+  802ec1:	48 89 cf             	mov    %rcx,%rdi
+  802ec4:	44 89 c6             	mov    %r8d,%esi
+  802ec7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802eca:	48 63 f6             	movslq %esi,%rsi
+  802ecd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ed0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ed5:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802ed8:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802edc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ede:	48 85 c0             	test   %rax,%rax
+  802ee1:	7f 06                	jg     802ee9 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ee3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ee7:	c9                   	leave
+  802ee8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ee9:	49 89 c0             	mov    %rax,%r8
+  802eec:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802ef1:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802ef8:	00 00 00 
+  802efb:	be 27 00 00 00       	mov    $0x27,%esi
+  802f00:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802f07:	00 00 00 
+  802f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0f:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802f16:	00 00 00 
+  802f19:	41 ff d1             	call   *%r9
+
+0000000000802f1c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802f1c:	55                   	push   %rbp
+  802f1d:	48 89 e5             	mov    %rsp,%rbp
+  802f20:	53                   	push   %rbx
+  802f21:	48 83 ec 08          	sub    $0x8,%rsp
+  802f25:	48 89 fa             	mov    %rdi,%rdx
+  802f28:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802f2b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f35:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f3a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f45:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f4b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f4d:	48 85 c0             	test   %rax,%rax
+  802f50:	7f 06                	jg     802f58 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f56:	c9                   	leave
+  802f57:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f58:	49 89 c0             	mov    %rax,%r8
+  802f5b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802f60:	48 ba c8 63 80 00 00 	movabs $0x8063c8,%rdx
+  802f67:	00 00 00 
+  802f6a:	be 27 00 00 00       	mov    $0x27,%esi
+  802f6f:	48 bf e7 63 80 00 00 	movabs $0x8063e7,%rdi
+  802f76:	00 00 00 
+  802f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7e:	49 b9 e4 17 80 00 00 	movabs $0x8017e4,%r9
+  802f85:	00 00 00 
+  802f88:	41 ff d1             	call   *%r9
+
+0000000000802f8b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802f8b:	55                   	push   %rbp
+  802f8c:	48 89 e5             	mov    %rsp,%rbp
+  802f8f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f90:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fa9:	be 00 00 00 00       	mov    $0x0,%esi
+  802fae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fb4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fba:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802fbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fc0:	c9                   	leave
+  802fc1:	c3                   	ret
+
+0000000000802fc2 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802fc2:	55                   	push   %rbp
+  802fc3:	48 89 e5             	mov    %rsp,%rbp
+  802fc6:	53                   	push   %rbx
+  802fc7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fca:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fcf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fde:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fe9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fef:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802ff1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff5:	c9                   	leave
+  802ff6:	c3                   	ret
+
+0000000000802ff7 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802ff7:	55                   	push   %rbp
+  802ff8:	48 89 e5             	mov    %rsp,%rbp
+  802ffb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802ffc:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803001:	ba 00 00 00 00       	mov    $0x0,%edx
+  803006:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80300b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803010:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803015:	be 00 00 00 00       	mov    $0x0,%esi
+  80301a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803020:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803026:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803028:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80302c:	c9                   	leave
+  80302d:	c3                   	ret
+
+000000000080302e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80302e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803035:	ff ff ff 
+  803038:	48 01 f8             	add    %rdi,%rax
+  80303b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80303f:	c3                   	ret
+
+0000000000803040 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803040:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803047:	ff ff ff 
+  80304a:	48 01 f8             	add    %rdi,%rax
+  80304d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803051:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803057:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80305b:	c3                   	ret
+
+000000000080305c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80305c:	55                   	push   %rbp
+  80305d:	48 89 e5             	mov    %rsp,%rbp
+  803060:	41 57                	push   %r15
+  803062:	41 56                	push   %r14
+  803064:	41 55                	push   %r13
+  803066:	41 54                	push   %r12
+  803068:	53                   	push   %rbx
+  803069:	48 83 ec 08          	sub    $0x8,%rsp
+  80306d:	49 89 ff             	mov    %rdi,%r15
+  803070:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803075:	49 bd 5c 45 80 00 00 	movabs $0x80455c,%r13
+  80307c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80307f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803085:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803088:	48 89 df             	mov    %rbx,%rdi
+  80308b:	41 ff d5             	call   *%r13
+  80308e:	83 e0 04             	and    $0x4,%eax
+  803091:	74 17                	je     8030aa <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803093:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80309a:	4c 39 f3             	cmp    %r14,%rbx
+  80309d:	75 e6                	jne    803085 <fd_alloc+0x29>
+  80309f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8030a5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8030aa:	4d 89 27             	mov    %r12,(%r15)
+}
+  8030ad:	48 83 c4 08          	add    $0x8,%rsp
+  8030b1:	5b                   	pop    %rbx
+  8030b2:	41 5c                	pop    %r12
+  8030b4:	41 5d                	pop    %r13
+  8030b6:	41 5e                	pop    %r14
+  8030b8:	41 5f                	pop    %r15
+  8030ba:	5d                   	pop    %rbp
+  8030bb:	c3                   	ret
+
+00000000008030bc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8030bc:	83 ff 1f             	cmp    $0x1f,%edi
+  8030bf:	77 39                	ja     8030fa <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8030c1:	55                   	push   %rbp
+  8030c2:	48 89 e5             	mov    %rsp,%rbp
+  8030c5:	41 54                	push   %r12
+  8030c7:	53                   	push   %rbx
+  8030c8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8030cb:	48 63 df             	movslq %edi,%rbx
+  8030ce:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8030d5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8030d9:	48 89 df             	mov    %rbx,%rdi
+  8030dc:	48 b8 5c 45 80 00 00 	movabs $0x80455c,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+  8030e8:	a8 04                	test   $0x4,%al
+  8030ea:	74 14                	je     803100 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8030ec:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8030f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030f5:	5b                   	pop    %rbx
+  8030f6:	41 5c                	pop    %r12
+  8030f8:	5d                   	pop    %rbp
+  8030f9:	c3                   	ret
+        return -E_INVAL;
+  8030fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8030ff:	c3                   	ret
+        return -E_INVAL;
+  803100:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803105:	eb ee                	jmp    8030f5 <fd_lookup+0x39>
+
+0000000000803107 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803107:	55                   	push   %rbp
+  803108:	48 89 e5             	mov    %rsp,%rbp
+  80310b:	41 54                	push   %r12
+  80310d:	53                   	push   %rbx
+  80310e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803111:	48 b8 80 64 80 00 00 	movabs $0x806480,%rax
+  803118:	00 00 00 
+  80311b:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803122:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803125:	39 3b                	cmp    %edi,(%rbx)
+  803127:	74 47                	je     803170 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803129:	48 83 c0 08          	add    $0x8,%rax
+  80312d:	48 8b 18             	mov    (%rax),%rbx
+  803130:	48 85 db             	test   %rbx,%rbx
+  803133:	75 f0                	jne    803125 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803135:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80313c:	00 00 00 
+  80313f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803145:	89 fa                	mov    %edi,%edx
+  803147:	48 bf f8 63 80 00 00 	movabs $0x8063f8,%rdi
+  80314e:	00 00 00 
+  803151:	b8 00 00 00 00       	mov    $0x0,%eax
+  803156:	48 b9 34 19 80 00 00 	movabs $0x801934,%rcx
+  80315d:	00 00 00 
+  803160:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803162:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803167:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80316b:	5b                   	pop    %rbx
+  80316c:	41 5c                	pop    %r12
+  80316e:	5d                   	pop    %rbp
+  80316f:	c3                   	ret
+            return 0;
+  803170:	b8 00 00 00 00       	mov    $0x0,%eax
+  803175:	eb f0                	jmp    803167 <dev_lookup+0x60>
+
+0000000000803177 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803177:	55                   	push   %rbp
+  803178:	48 89 e5             	mov    %rsp,%rbp
+  80317b:	41 55                	push   %r13
+  80317d:	41 54                	push   %r12
+  80317f:	53                   	push   %rbx
+  803180:	48 83 ec 18          	sub    $0x18,%rsp
+  803184:	48 89 fb             	mov    %rdi,%rbx
+  803187:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80318a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803191:	ff ff ff 
+  803194:	48 01 df             	add    %rbx,%rdi
+  803197:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80319b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80319f:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  8031a6:	00 00 00 
+  8031a9:	ff d0                	call   *%rax
+  8031ab:	41 89 c5             	mov    %eax,%r13d
+  8031ae:	85 c0                	test   %eax,%eax
+  8031b0:	78 06                	js     8031b8 <fd_close+0x41>
+  8031b2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8031b6:	74 1a                	je     8031d2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8031b8:	45 84 e4             	test   %r12b,%r12b
+  8031bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8031c4:	44 89 e8             	mov    %r13d,%eax
+  8031c7:	48 83 c4 18          	add    $0x18,%rsp
+  8031cb:	5b                   	pop    %rbx
+  8031cc:	41 5c                	pop    %r12
+  8031ce:	41 5d                	pop    %r13
+  8031d0:	5d                   	pop    %rbp
+  8031d1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8031d2:	8b 3b                	mov    (%rbx),%edi
+  8031d4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8031d8:	48 b8 07 31 80 00 00 	movabs $0x803107,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+  8031e4:	41 89 c5             	mov    %eax,%r13d
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	78 1b                	js     803206 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8031eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031ef:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031f3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8031f9:	48 85 c0             	test   %rax,%rax
+  8031fc:	74 08                	je     803206 <fd_close+0x8f>
+  8031fe:	48 89 df             	mov    %rbx,%rdi
+  803201:	ff d0                	call   *%rax
+  803203:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803206:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80320b:	48 89 de             	mov    %rbx,%rsi
+  80320e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803213:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  80321a:	00 00 00 
+  80321d:	ff d0                	call   *%rax
+    return res;
+  80321f:	eb a3                	jmp    8031c4 <fd_close+0x4d>
+
+0000000000803221 <close>:
+
+int
+close(int fdnum) {
+  803221:	55                   	push   %rbp
+  803222:	48 89 e5             	mov    %rsp,%rbp
+  803225:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803229:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80322d:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  803234:	00 00 00 
+  803237:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803239:	85 c0                	test   %eax,%eax
+  80323b:	78 15                	js     803252 <close+0x31>
+
+    return fd_close(fd, 1);
+  80323d:	be 01 00 00 00       	mov    $0x1,%esi
+  803242:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803246:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  80324d:	00 00 00 
+  803250:	ff d0                	call   *%rax
+}
+  803252:	c9                   	leave
+  803253:	c3                   	ret
+
+0000000000803254 <close_all>:
+
+void
+close_all(void) {
+  803254:	55                   	push   %rbp
+  803255:	48 89 e5             	mov    %rsp,%rbp
+  803258:	41 54                	push   %r12
+  80325a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80325b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803260:	49 bc 21 32 80 00 00 	movabs $0x803221,%r12
+  803267:	00 00 00 
+  80326a:	89 df                	mov    %ebx,%edi
+  80326c:	41 ff d4             	call   *%r12
+  80326f:	83 c3 01             	add    $0x1,%ebx
+  803272:	83 fb 20             	cmp    $0x20,%ebx
+  803275:	75 f3                	jne    80326a <close_all+0x16>
+}
+  803277:	5b                   	pop    %rbx
+  803278:	41 5c                	pop    %r12
+  80327a:	5d                   	pop    %rbp
+  80327b:	c3                   	ret
+
+000000000080327c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80327c:	55                   	push   %rbp
+  80327d:	48 89 e5             	mov    %rsp,%rbp
+  803280:	41 57                	push   %r15
+  803282:	41 56                	push   %r14
+  803284:	41 55                	push   %r13
+  803286:	41 54                	push   %r12
+  803288:	53                   	push   %rbx
+  803289:	48 83 ec 18          	sub    $0x18,%rsp
+  80328d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803290:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803294:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+  8032a0:	89 c3                	mov    %eax,%ebx
+  8032a2:	85 c0                	test   %eax,%eax
+  8032a4:	0f 88 b8 00 00 00    	js     803362 <dup+0xe6>
+    close(newfdnum);
+  8032aa:	44 89 e7             	mov    %r12d,%edi
+  8032ad:	48 b8 21 32 80 00 00 	movabs $0x803221,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8032b9:	4d 63 ec             	movslq %r12d,%r13
+  8032bc:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8032c3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8032c7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8032cb:	4c 89 ff             	mov    %r15,%rdi
+  8032ce:	49 be 40 30 80 00 00 	movabs $0x803040,%r14
+  8032d5:	00 00 00 
+  8032d8:	41 ff d6             	call   *%r14
+  8032db:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8032de:	4c 89 ef             	mov    %r13,%rdi
+  8032e1:	41 ff d6             	call   *%r14
+  8032e4:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8032e7:	48 89 df             	mov    %rbx,%rdi
+  8032ea:	48 b8 5c 45 80 00 00 	movabs $0x80455c,%rax
+  8032f1:	00 00 00 
+  8032f4:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8032f6:	a8 04                	test   $0x4,%al
+  8032f8:	74 2b                	je     803325 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8032fa:	41 89 c1             	mov    %eax,%r9d
+  8032fd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803303:	4c 89 f1             	mov    %r14,%rcx
+  803306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80330b:	48 89 de             	mov    %rbx,%rsi
+  80330e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803313:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  80331a:	00 00 00 
+  80331d:	ff d0                	call   *%rax
+  80331f:	89 c3                	mov    %eax,%ebx
+  803321:	85 c0                	test   %eax,%eax
+  803323:	78 4e                	js     803373 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803325:	4c 89 ff             	mov    %r15,%rdi
+  803328:	48 b8 5c 45 80 00 00 	movabs $0x80455c,%rax
+  80332f:	00 00 00 
+  803332:	ff d0                	call   *%rax
+  803334:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803337:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80333d:	4c 89 e9             	mov    %r13,%rcx
+  803340:	ba 00 00 00 00       	mov    $0x0,%edx
+  803345:	4c 89 fe             	mov    %r15,%rsi
+  803348:	bf 00 00 00 00       	mov    $0x0,%edi
+  80334d:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  803354:	00 00 00 
+  803357:	ff d0                	call   *%rax
+  803359:	89 c3                	mov    %eax,%ebx
+  80335b:	85 c0                	test   %eax,%eax
+  80335d:	78 14                	js     803373 <dup+0xf7>
+
+    return newfdnum;
+  80335f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803362:	89 d8                	mov    %ebx,%eax
+  803364:	48 83 c4 18          	add    $0x18,%rsp
+  803368:	5b                   	pop    %rbx
+  803369:	41 5c                	pop    %r12
+  80336b:	41 5d                	pop    %r13
+  80336d:	41 5e                	pop    %r14
+  80336f:	41 5f                	pop    %r15
+  803371:	5d                   	pop    %rbp
+  803372:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803373:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803378:	4c 89 ee             	mov    %r13,%rsi
+  80337b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803380:	49 bc a8 2a 80 00 00 	movabs $0x802aa8,%r12
+  803387:	00 00 00 
+  80338a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80338d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803392:	4c 89 f6             	mov    %r14,%rsi
+  803395:	bf 00 00 00 00       	mov    $0x0,%edi
+  80339a:	41 ff d4             	call   *%r12
+    return res;
+  80339d:	eb c3                	jmp    803362 <dup+0xe6>
+
+000000000080339f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80339f:	55                   	push   %rbp
+  8033a0:	48 89 e5             	mov    %rsp,%rbp
+  8033a3:	41 56                	push   %r14
+  8033a5:	41 55                	push   %r13
+  8033a7:	41 54                	push   %r12
+  8033a9:	53                   	push   %rbx
+  8033aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8033ae:	89 fb                	mov    %edi,%ebx
+  8033b0:	49 89 f4             	mov    %rsi,%r12
+  8033b3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033b6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033ba:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  8033c1:	00 00 00 
+  8033c4:	ff d0                	call   *%rax
+  8033c6:	85 c0                	test   %eax,%eax
+  8033c8:	78 4c                	js     803416 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033ca:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8033ce:	41 8b 3e             	mov    (%r14),%edi
+  8033d1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033d5:	48 b8 07 31 80 00 00 	movabs $0x803107,%rax
+  8033dc:	00 00 00 
+  8033df:	ff d0                	call   *%rax
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	78 35                	js     80341a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8033e5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8033e9:	83 e0 03             	and    $0x3,%eax
+  8033ec:	83 f8 01             	cmp    $0x1,%eax
+  8033ef:	74 2d                	je     80341e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033f5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8033f9:	48 85 c0             	test   %rax,%rax
+  8033fc:	74 56                	je     803454 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8033fe:	4c 89 ea             	mov    %r13,%rdx
+  803401:	4c 89 e6             	mov    %r12,%rsi
+  803404:	4c 89 f7             	mov    %r14,%rdi
+  803407:	ff d0                	call   *%rax
+}
+  803409:	48 83 c4 10          	add    $0x10,%rsp
+  80340d:	5b                   	pop    %rbx
+  80340e:	41 5c                	pop    %r12
+  803410:	41 5d                	pop    %r13
+  803412:	41 5e                	pop    %r14
+  803414:	5d                   	pop    %rbp
+  803415:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803416:	48 98                	cltq
+  803418:	eb ef                	jmp    803409 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80341a:	48 98                	cltq
+  80341c:	eb eb                	jmp    803409 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80341e:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803425:	00 00 00 
+  803428:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80342e:	89 da                	mov    %ebx,%edx
+  803430:	48 bf 39 64 80 00 00 	movabs $0x806439,%rdi
+  803437:	00 00 00 
+  80343a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80343f:	48 b9 34 19 80 00 00 	movabs $0x801934,%rcx
+  803446:	00 00 00 
+  803449:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80344b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803452:	eb b5                	jmp    803409 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803454:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80345b:	eb ac                	jmp    803409 <read+0x6a>
+
+000000000080345d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80345d:	55                   	push   %rbp
+  80345e:	48 89 e5             	mov    %rsp,%rbp
+  803461:	41 57                	push   %r15
+  803463:	41 56                	push   %r14
+  803465:	41 55                	push   %r13
+  803467:	41 54                	push   %r12
+  803469:	53                   	push   %rbx
+  80346a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80346e:	48 85 d2             	test   %rdx,%rdx
+  803471:	74 54                	je     8034c7 <readn+0x6a>
+  803473:	41 89 fd             	mov    %edi,%r13d
+  803476:	49 89 f6             	mov    %rsi,%r14
+  803479:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80347c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803481:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803486:	49 bf 9f 33 80 00 00 	movabs $0x80339f,%r15
+  80348d:	00 00 00 
+  803490:	4c 89 e2             	mov    %r12,%rdx
+  803493:	48 29 f2             	sub    %rsi,%rdx
+  803496:	4c 01 f6             	add    %r14,%rsi
+  803499:	44 89 ef             	mov    %r13d,%edi
+  80349c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80349f:	85 c0                	test   %eax,%eax
+  8034a1:	78 20                	js     8034c3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8034a3:	01 c3                	add    %eax,%ebx
+  8034a5:	85 c0                	test   %eax,%eax
+  8034a7:	74 08                	je     8034b1 <readn+0x54>
+  8034a9:	48 63 f3             	movslq %ebx,%rsi
+  8034ac:	4c 39 e6             	cmp    %r12,%rsi
+  8034af:	72 df                	jb     803490 <readn+0x33>
+    }
+    return res;
+  8034b1:	48 63 c3             	movslq %ebx,%rax
+}
+  8034b4:	48 83 c4 08          	add    $0x8,%rsp
+  8034b8:	5b                   	pop    %rbx
+  8034b9:	41 5c                	pop    %r12
+  8034bb:	41 5d                	pop    %r13
+  8034bd:	41 5e                	pop    %r14
+  8034bf:	41 5f                	pop    %r15
+  8034c1:	5d                   	pop    %rbp
+  8034c2:	c3                   	ret
+        if (inc < 0) return inc;
+  8034c3:	48 98                	cltq
+  8034c5:	eb ed                	jmp    8034b4 <readn+0x57>
+    int inc = 1, res = 0;
+  8034c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034cc:	eb e3                	jmp    8034b1 <readn+0x54>
+
+00000000008034ce <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8034ce:	55                   	push   %rbp
+  8034cf:	48 89 e5             	mov    %rsp,%rbp
+  8034d2:	41 56                	push   %r14
+  8034d4:	41 55                	push   %r13
+  8034d6:	41 54                	push   %r12
+  8034d8:	53                   	push   %rbx
+  8034d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8034dd:	89 fb                	mov    %edi,%ebx
+  8034df:	49 89 f4             	mov    %rsi,%r12
+  8034e2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034e5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034e9:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  8034f0:	00 00 00 
+  8034f3:	ff d0                	call   *%rax
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	78 47                	js     803540 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034f9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8034fd:	41 8b 3e             	mov    (%r14),%edi
+  803500:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803504:	48 b8 07 31 80 00 00 	movabs $0x803107,%rax
+  80350b:	00 00 00 
+  80350e:	ff d0                	call   *%rax
+  803510:	85 c0                	test   %eax,%eax
+  803512:	78 30                	js     803544 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803514:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803519:	74 2d                	je     803548 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80351b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80351f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803523:	48 85 c0             	test   %rax,%rax
+  803526:	74 56                	je     80357e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803528:	4c 89 ea             	mov    %r13,%rdx
+  80352b:	4c 89 e6             	mov    %r12,%rsi
+  80352e:	4c 89 f7             	mov    %r14,%rdi
+  803531:	ff d0                	call   *%rax
+}
+  803533:	48 83 c4 10          	add    $0x10,%rsp
+  803537:	5b                   	pop    %rbx
+  803538:	41 5c                	pop    %r12
+  80353a:	41 5d                	pop    %r13
+  80353c:	41 5e                	pop    %r14
+  80353e:	5d                   	pop    %rbp
+  80353f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803540:	48 98                	cltq
+  803542:	eb ef                	jmp    803533 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803544:	48 98                	cltq
+  803546:	eb eb                	jmp    803533 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803548:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80354f:	00 00 00 
+  803552:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803558:	89 da                	mov    %ebx,%edx
+  80355a:	48 bf 55 64 80 00 00 	movabs $0x806455,%rdi
+  803561:	00 00 00 
+  803564:	b8 00 00 00 00       	mov    $0x0,%eax
+  803569:	48 b9 34 19 80 00 00 	movabs $0x801934,%rcx
+  803570:	00 00 00 
+  803573:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803575:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80357c:	eb b5                	jmp    803533 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80357e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803585:	eb ac                	jmp    803533 <write+0x65>
+
+0000000000803587 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803587:	55                   	push   %rbp
+  803588:	48 89 e5             	mov    %rsp,%rbp
+  80358b:	53                   	push   %rbx
+  80358c:	48 83 ec 18          	sub    $0x18,%rsp
+  803590:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803592:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803596:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  80359d:	00 00 00 
+  8035a0:	ff d0                	call   *%rax
+  8035a2:	85 c0                	test   %eax,%eax
+  8035a4:	78 0c                	js     8035b2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8035a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035aa:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8035ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035b6:	c9                   	leave
+  8035b7:	c3                   	ret
+
+00000000008035b8 <tell>:
+
+int tell(int fdnum) {
+  8035b8:	55                   	push   %rbp
+  8035b9:	48 89 e5             	mov    %rsp,%rbp
+  8035bc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035c0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035c4:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  8035cb:	00 00 00 
+  8035ce:	ff d0                	call   *%rax
+  8035d0:	85 c0                	test   %eax,%eax
+  8035d2:	78 07                	js     8035db <tell+0x23>
+
+    return fd->fd_offset;
+  8035d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035d8:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8035db:	c9                   	leave
+  8035dc:	c3                   	ret
+
+00000000008035dd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8035dd:	55                   	push   %rbp
+  8035de:	48 89 e5             	mov    %rsp,%rbp
+  8035e1:	41 55                	push   %r13
+  8035e3:	41 54                	push   %r12
+  8035e5:	53                   	push   %rbx
+  8035e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8035ea:	89 fb                	mov    %edi,%ebx
+  8035ec:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035ef:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035f3:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  8035fa:	00 00 00 
+  8035fd:	ff d0                	call   *%rax
+  8035ff:	85 c0                	test   %eax,%eax
+  803601:	78 38                	js     80363b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803603:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803607:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80360b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80360f:	48 b8 07 31 80 00 00 	movabs $0x803107,%rax
+  803616:	00 00 00 
+  803619:	ff d0                	call   *%rax
+  80361b:	85 c0                	test   %eax,%eax
+  80361d:	78 1c                	js     80363b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80361f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803624:	74 20                	je     803646 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803626:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80362a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80362e:	48 85 c0             	test   %rax,%rax
+  803631:	74 47                	je     80367a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803633:	44 89 e6             	mov    %r12d,%esi
+  803636:	4c 89 ef             	mov    %r13,%rdi
+  803639:	ff d0                	call   *%rax
+}
+  80363b:	48 83 c4 18          	add    $0x18,%rsp
+  80363f:	5b                   	pop    %rbx
+  803640:	41 5c                	pop    %r12
+  803642:	41 5d                	pop    %r13
+  803644:	5d                   	pop    %rbp
+  803645:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803646:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80364d:	00 00 00 
+  803650:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803656:	89 da                	mov    %ebx,%edx
+  803658:	48 bf 18 64 80 00 00 	movabs $0x806418,%rdi
+  80365f:	00 00 00 
+  803662:	b8 00 00 00 00       	mov    $0x0,%eax
+  803667:	48 b9 34 19 80 00 00 	movabs $0x801934,%rcx
+  80366e:	00 00 00 
+  803671:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803673:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803678:	eb c1                	jmp    80363b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80367a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80367f:	eb ba                	jmp    80363b <ftruncate+0x5e>
+
+0000000000803681 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803681:	55                   	push   %rbp
+  803682:	48 89 e5             	mov    %rsp,%rbp
+  803685:	41 54                	push   %r12
+  803687:	53                   	push   %rbx
+  803688:	48 83 ec 10          	sub    $0x10,%rsp
+  80368c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80368f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803693:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  80369a:	00 00 00 
+  80369d:	ff d0                	call   *%rax
+  80369f:	85 c0                	test   %eax,%eax
+  8036a1:	78 63                	js     803706 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036a3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8036a7:	41 8b 3c 24          	mov    (%r12),%edi
+  8036ab:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8036af:	48 b8 07 31 80 00 00 	movabs $0x803107,%rax
+  8036b6:	00 00 00 
+  8036b9:	ff d0                	call   *%rax
+  8036bb:	85 c0                	test   %eax,%eax
+  8036bd:	78 47                	js     803706 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8036bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036c3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8036c8:	74 45                	je     80370f <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8036ca:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8036cd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8036d4:	00 00 00 
+    stat->st_isdir = 0;
+  8036d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036de:	00 00 00 
+    stat->st_ino = 0;
+  8036e1:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8036e8:	00 00 00 00 
+    stat->st_version = 0;
+  8036ec:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8036f3:	00 00 00 
+    stat->st_dev = dev;
+  8036f6:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8036fd:	48 89 de             	mov    %rbx,%rsi
+  803700:	4c 89 e7             	mov    %r12,%rdi
+  803703:	ff 50 28             	call   *0x28(%rax)
+}
+  803706:	48 83 c4 10          	add    $0x10,%rsp
+  80370a:	5b                   	pop    %rbx
+  80370b:	41 5c                	pop    %r12
+  80370d:	5d                   	pop    %rbp
+  80370e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80370f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803714:	eb f0                	jmp    803706 <fstat+0x85>
+
+0000000000803716 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803716:	55                   	push   %rbp
+  803717:	48 89 e5             	mov    %rsp,%rbp
+  80371a:	41 54                	push   %r12
+  80371c:	53                   	push   %rbx
+  80371d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803720:	be 00 00 00 00       	mov    $0x0,%esi
+  803725:	48 b8 37 3c 80 00 00 	movabs $0x803c37,%rax
+  80372c:	00 00 00 
+  80372f:	ff d0                	call   *%rax
+  803731:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803733:	85 c0                	test   %eax,%eax
+  803735:	78 25                	js     80375c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803737:	4c 89 e6             	mov    %r12,%rsi
+  80373a:	89 c7                	mov    %eax,%edi
+  80373c:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  803743:	00 00 00 
+  803746:	ff d0                	call   *%rax
+  803748:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80374b:	89 df                	mov    %ebx,%edi
+  80374d:	48 b8 21 32 80 00 00 	movabs $0x803221,%rax
+  803754:	00 00 00 
+  803757:	ff d0                	call   *%rax
+
+    return res;
+  803759:	44 89 e3             	mov    %r12d,%ebx
+}
+  80375c:	89 d8                	mov    %ebx,%eax
+  80375e:	5b                   	pop    %rbx
+  80375f:	41 5c                	pop    %r12
+  803761:	5d                   	pop    %rbp
+  803762:	c3                   	ret
+
+0000000000803763 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803763:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80376a:	00 00 00 
+  80376d:	83 38 00             	cmpl   $0x0,(%rax)
+  803770:	74 0a                	je     80377c <fsipc_env+0x19>
+    return fsenv;
+}
+  803772:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803779:	00 00 
+  80377b:	c3                   	ret
+fsipc_env(void) {
+  80377c:	55                   	push   %rbp
+  80377d:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803780:	bf 03 00 00 00       	mov    $0x3,%edi
+  803785:	48 b8 66 58 80 00 00 	movabs $0x805866,%rax
+  80378c:	00 00 00 
+  80378f:	ff d0                	call   *%rax
+  803791:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803798:	00 00 
+}
+  80379a:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8037a1:	00 00 
+  8037a3:	5d                   	pop    %rbp
+  8037a4:	c3                   	ret
+
+00000000008037a5 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8037a5:	55                   	push   %rbp
+  8037a6:	48 89 e5             	mov    %rsp,%rbp
+  8037a9:	53                   	push   %rbx
+  8037aa:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8037ae:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8037b5:	00 
+  8037b6:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8037bd:	00 
+  8037be:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8037c5:	00 
+  8037c6:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8037cd:	00 
+  8037ce:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8037d5:	00 
+
+    assert(size <= sizeof(words));
+  8037d6:	48 83 fa 28          	cmp    $0x28,%rdx
+  8037da:	77 38                	ja     803814 <fsipc_short+0x6f>
+  8037dc:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8037de:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8037e2:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  8037e9:	00 00 00 
+  8037ec:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8037ee:	48 b8 63 37 80 00 00 	movabs $0x803763,%rax
+  8037f5:	00 00 00 
+  8037f8:	ff d0                	call   *%rax
+  8037fa:	89 c7                	mov    %eax,%edi
+  8037fc:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803800:	89 de                	mov    %ebx,%esi
+  803802:	48 b8 c9 57 80 00 00 	movabs $0x8057c9,%rax
+  803809:	00 00 00 
+  80380c:	ff d0                	call   *%rax
+}
+  80380e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803812:	c9                   	leave
+  803813:	c3                   	ret
+    assert(size <= sizeof(words));
+  803814:	48 b9 a0 64 80 00 00 	movabs $0x8064a0,%rcx
+  80381b:	00 00 00 
+  80381e:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  803825:	00 00 00 
+  803828:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80382d:	48 bf cb 64 80 00 00 	movabs $0x8064cb,%rdi
+  803834:	00 00 00 
+  803837:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383c:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  803843:	00 00 00 
+  803846:	41 ff d0             	call   *%r8
+
+0000000000803849 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803849:	55                   	push   %rbp
+  80384a:	48 89 e5             	mov    %rsp,%rbp
+  80384d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803851:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803854:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803857:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  80385a:	ba 08 00 00 00       	mov    $0x8,%edx
+  80385f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803863:	bf 02 00 00 00       	mov    $0x2,%edi
+  803868:	48 b8 a5 37 80 00 00 	movabs $0x8037a5,%rax
+  80386f:	00 00 00 
+  803872:	ff d0                	call   *%rax
+}
+  803874:	c9                   	leave
+  803875:	c3                   	ret
+
+0000000000803876 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803876:	55                   	push   %rbp
+  803877:	48 89 e5             	mov    %rsp,%rbp
+  80387a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  80387e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803881:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803884:	ba 04 00 00 00       	mov    $0x4,%edx
+  803889:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80388d:	bf 06 00 00 00       	mov    $0x6,%edi
+  803892:	48 b8 a5 37 80 00 00 	movabs $0x8037a5,%rax
+  803899:	00 00 00 
+  80389c:	ff d0                	call   *%rax
+}
+  80389e:	c9                   	leave
+  80389f:	c3                   	ret
+
+00000000008038a0 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8038a0:	55                   	push   %rbp
+  8038a1:	48 89 e5             	mov    %rsp,%rbp
+  8038a4:	41 54                	push   %r12
+  8038a6:	53                   	push   %rbx
+  8038a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8038ab:	89 fb                	mov    %edi,%ebx
+  8038ad:	49 89 f4             	mov    %rsi,%r12
+  8038b0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8038b4:	48 b8 63 37 80 00 00 	movabs $0x803763,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+  8038c0:	89 c7                	mov    %eax,%edi
+  8038c2:	6a 00                	push   $0x0
+  8038c4:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8038c8:	50                   	push   %rax
+  8038c9:	4d 89 e1             	mov    %r12,%r9
+  8038cc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8038d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038d7:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  8038de:	00 00 00 
+  8038e1:	89 de                	mov    %ebx,%esi
+  8038e3:	48 b8 64 57 80 00 00 	movabs $0x805764,%rax
+  8038ea:	00 00 00 
+  8038ed:	ff d0                	call   *%rax
+}
+  8038ef:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8038f3:	5b                   	pop    %rbx
+  8038f4:	41 5c                	pop    %r12
+  8038f6:	5d                   	pop    %rbp
+  8038f7:	c3                   	ret
+
+00000000008038f8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8038f8:	55                   	push   %rbp
+  8038f9:	48 89 e5             	mov    %rsp,%rbp
+  8038fc:	41 54                	push   %r12
+  8038fe:	53                   	push   %rbx
+  8038ff:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803902:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803905:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80390c:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80390e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803913:	be 00 00 00 00       	mov    $0x0,%esi
+  803918:	bf 05 00 00 00       	mov    $0x5,%edi
+  80391d:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803929:	85 c0                	test   %eax,%eax
+  80392b:	78 5a                	js     803987 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80392d:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803934:	00 00 00 
+  803937:	4c 89 e6             	mov    %r12,%rsi
+  80393a:	48 89 df             	mov    %rbx,%rdi
+  80393d:	48 b8 6b 22 80 00 00 	movabs $0x80226b,%rax
+  803944:	00 00 00 
+  803947:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803949:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803950:	00 
+  803951:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803957:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80395e:	00 
+  80395f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803965:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  80396c:	00 
+  80396d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803974:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  80397b:	00 
+  80397c:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803982:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803987:	5b                   	pop    %rbx
+  803988:	41 5c                	pop    %r12
+  80398a:	5d                   	pop    %rbp
+  80398b:	c3                   	ret
+
+000000000080398c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80398c:	55                   	push   %rbp
+  80398d:	48 89 e5             	mov    %rsp,%rbp
+  803990:	41 57                	push   %r15
+  803992:	41 56                	push   %r14
+  803994:	41 55                	push   %r13
+  803996:	41 54                	push   %r12
+  803998:	53                   	push   %rbx
+  803999:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80399d:	48 85 ff             	test   %rdi,%rdi
+  8039a0:	0f 84 a1 00 00 00    	je     803a47 <devfile_read+0xbb>
+  8039a6:	49 89 ff             	mov    %rdi,%r15
+  8039a9:	49 89 f5             	mov    %rsi,%r13
+  8039ac:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8039af:	48 85 f6             	test   %rsi,%rsi
+  8039b2:	0f 84 c4 00 00 00    	je     803a7c <devfile_read+0xf0>
+    size_t total_read = 0;
+  8039b8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8039bf:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8039c0:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8039c7:	00 00 00 
+  8039ca:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8039ce:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8039d1:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039da:	be 00 00 00 00       	mov    $0x0,%esi
+  8039df:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039e4:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  8039eb:	00 00 00 
+  8039ee:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039f0:	85 c0                	test   %eax,%eax
+  8039f2:	0f 88 b9 00 00 00    	js     803ab1 <devfile_read+0x125>
+        assert(res <= n);
+  8039f8:	48 63 d8             	movslq %eax,%rbx
+  8039fb:	49 39 dc             	cmp    %rbx,%r12
+  8039fe:	0f 82 b1 00 00 00    	jb     803ab5 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803a04:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803a09:	0f 87 db 00 00 00    	ja     803aea <devfile_read+0x15e>
+        if (!res) {
+  803a0f:	85 c0                	test   %eax,%eax
+  803a11:	74 21                	je     803a34 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803a13:	48 89 da             	mov    %rbx,%rdx
+  803a16:	4c 89 f6             	mov    %r14,%rsi
+  803a19:	4c 89 ef             	mov    %r13,%rdi
+  803a1c:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+        total_read += res;
+  803a28:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803a2c:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803a2f:	49 29 dc             	sub    %rbx,%r12
+  803a32:	75 96                	jne    8039ca <devfile_read+0x3e>
+    return total_read;
+  803a34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803a38:	48 83 c4 18          	add    $0x18,%rsp
+  803a3c:	5b                   	pop    %rbx
+  803a3d:	41 5c                	pop    %r12
+  803a3f:	41 5d                	pop    %r13
+  803a41:	41 5e                	pop    %r14
+  803a43:	41 5f                	pop    %r15
+  803a45:	5d                   	pop    %rbp
+  803a46:	c3                   	ret
+    assert(fd);
+  803a47:	48 b9 d6 64 80 00 00 	movabs $0x8064d6,%rcx
+  803a4e:	00 00 00 
+  803a51:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  803a58:	00 00 00 
+  803a5b:	be 91 00 00 00       	mov    $0x91,%esi
+  803a60:	48 bf cb 64 80 00 00 	movabs $0x8064cb,%rdi
+  803a67:	00 00 00 
+  803a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6f:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  803a76:	00 00 00 
+  803a79:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a7c:	48 b9 d9 64 80 00 00 	movabs $0x8064d9,%rcx
+  803a83:	00 00 00 
+  803a86:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  803a8d:	00 00 00 
+  803a90:	be 92 00 00 00       	mov    $0x92,%esi
+  803a95:	48 bf cb 64 80 00 00 	movabs $0x8064cb,%rdi
+  803a9c:	00 00 00 
+  803a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa4:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  803aab:	00 00 00 
+  803aae:	41 ff d0             	call   *%r8
+            return res;
+  803ab1:	48 98                	cltq
+  803ab3:	eb 83                	jmp    803a38 <devfile_read+0xac>
+        assert(res <= n);
+  803ab5:	48 b9 dd 64 80 00 00 	movabs $0x8064dd,%rcx
+  803abc:	00 00 00 
+  803abf:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  803ac6:	00 00 00 
+  803ac9:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803ace:	48 bf cb 64 80 00 00 	movabs $0x8064cb,%rdi
+  803ad5:	00 00 00 
+  803ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803add:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  803ae4:	00 00 00 
+  803ae7:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803aea:	48 b9 e8 64 80 00 00 	movabs $0x8064e8,%rcx
+  803af1:	00 00 00 
+  803af4:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  803afb:	00 00 00 
+  803afe:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803b03:	48 bf cb 64 80 00 00 	movabs $0x8064cb,%rdi
+  803b0a:	00 00 00 
+  803b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b12:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  803b19:	00 00 00 
+  803b1c:	41 ff d0             	call   *%r8
+
+0000000000803b1f <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803b1f:	55                   	push   %rbp
+  803b20:	48 89 e5             	mov    %rsp,%rbp
+  803b23:	41 57                	push   %r15
+  803b25:	41 56                	push   %r14
+  803b27:	41 55                	push   %r13
+  803b29:	41 54                	push   %r12
+  803b2b:	53                   	push   %rbx
+  803b2c:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803b30:	48 85 ff             	test   %rdi,%rdi
+  803b33:	0f 84 83 00 00 00    	je     803bbc <devfile_write+0x9d>
+  803b39:	49 89 ff             	mov    %rdi,%r15
+  803b3c:	49 89 f4             	mov    %rsi,%r12
+  803b3f:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803b42:	48 85 f6             	test   %rsi,%rsi
+  803b45:	0f 84 a6 00 00 00    	je     803bf1 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803b4b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803b51:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803b58:	00 00 00 
+  803b5b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803b5f:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803b62:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803b66:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803b6b:	48 39 d3             	cmp    %rdx,%rbx
+  803b6e:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803b72:	4c 89 e6             	mov    %r12,%rsi
+  803b75:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803b7c:	00 00 00 
+  803b7f:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  803b86:	00 00 00 
+  803b89:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b8b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b90:	be 00 00 00 00       	mov    $0x0,%esi
+  803b95:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b9a:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+        if (res < 0) {
+  803ba6:	85 c0                	test   %eax,%eax
+  803ba8:	78 7c                	js     803c26 <devfile_write+0x107>
+        total_written += res;
+  803baa:	48 98                	cltq
+  803bac:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803baf:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803bb2:	48 29 c3             	sub    %rax,%rbx
+  803bb5:	75 a4                	jne    803b5b <devfile_write+0x3c>
+    return total_written;
+  803bb7:	4c 89 e8             	mov    %r13,%rax
+  803bba:	eb 6c                	jmp    803c28 <devfile_write+0x109>
+    assert(fd);
+  803bbc:	48 b9 d6 64 80 00 00 	movabs $0x8064d6,%rcx
+  803bc3:	00 00 00 
+  803bc6:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  803bcd:	00 00 00 
+  803bd0:	be bd 00 00 00       	mov    $0xbd,%esi
+  803bd5:	48 bf cb 64 80 00 00 	movabs $0x8064cb,%rdi
+  803bdc:	00 00 00 
+  803bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be4:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  803beb:	00 00 00 
+  803bee:	41 ff d0             	call   *%r8
+    assert(buf);
+  803bf1:	48 b9 d9 64 80 00 00 	movabs $0x8064d9,%rcx
+  803bf8:	00 00 00 
+  803bfb:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  803c02:	00 00 00 
+  803c05:	be be 00 00 00       	mov    $0xbe,%esi
+  803c0a:	48 bf cb 64 80 00 00 	movabs $0x8064cb,%rdi
+  803c11:	00 00 00 
+  803c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c19:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  803c20:	00 00 00 
+  803c23:	41 ff d0             	call   *%r8
+            return res;
+  803c26:	48 98                	cltq
+}
+  803c28:	48 83 c4 08          	add    $0x8,%rsp
+  803c2c:	5b                   	pop    %rbx
+  803c2d:	41 5c                	pop    %r12
+  803c2f:	41 5d                	pop    %r13
+  803c31:	41 5e                	pop    %r14
+  803c33:	41 5f                	pop    %r15
+  803c35:	5d                   	pop    %rbp
+  803c36:	c3                   	ret
+
+0000000000803c37 <open>:
+open(const char *path, int mode) {
+  803c37:	55                   	push   %rbp
+  803c38:	48 89 e5             	mov    %rsp,%rbp
+  803c3b:	41 55                	push   %r13
+  803c3d:	41 54                	push   %r12
+  803c3f:	53                   	push   %rbx
+  803c40:	48 83 ec 18          	sub    $0x18,%rsp
+  803c44:	49 89 fc             	mov    %rdi,%r12
+  803c47:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803c4a:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+  803c56:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803c5c:	0f 87 8f 00 00 00    	ja     803cf1 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803c62:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c66:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  803c6d:	00 00 00 
+  803c70:	ff d0                	call   *%rax
+  803c72:	89 c3                	mov    %eax,%ebx
+  803c74:	85 c0                	test   %eax,%eax
+  803c76:	78 55                	js     803ccd <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803c78:	4c 89 e6             	mov    %r12,%rsi
+  803c7b:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803c82:	00 00 00 
+  803c85:	48 89 df             	mov    %rbx,%rdi
+  803c88:	48 b8 6b 22 80 00 00 	movabs $0x80226b,%rax
+  803c8f:	00 00 00 
+  803c92:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803c94:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ca0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ca4:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ca9:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+  803cb5:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803cb7:	85 c0                	test   %eax,%eax
+  803cb9:	78 1f                	js     803cda <open+0xa3>
+    return fd2num(fd);
+  803cbb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cbf:	48 b8 2e 30 80 00 00 	movabs $0x80302e,%rax
+  803cc6:	00 00 00 
+  803cc9:	ff d0                	call   *%rax
+  803ccb:	89 c3                	mov    %eax,%ebx
+}
+  803ccd:	89 d8                	mov    %ebx,%eax
+  803ccf:	48 83 c4 18          	add    $0x18,%rsp
+  803cd3:	5b                   	pop    %rbx
+  803cd4:	41 5c                	pop    %r12
+  803cd6:	41 5d                	pop    %r13
+  803cd8:	5d                   	pop    %rbp
+  803cd9:	c3                   	ret
+        fd_close(fd, 0);
+  803cda:	be 00 00 00 00       	mov    $0x0,%esi
+  803cdf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ce3:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  803cea:	00 00 00 
+  803ced:	ff d0                	call   *%rax
+        return res;
+  803cef:	eb dc                	jmp    803ccd <open+0x96>
+        return -E_BAD_PATH;
+  803cf1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803cf6:	eb d5                	jmp    803ccd <open+0x96>
+
+0000000000803cf8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803cf8:	55                   	push   %rbp
+  803cf9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d01:	be 00 00 00 00       	mov    $0x0,%esi
+  803d06:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d0b:	48 b8 a5 37 80 00 00 	movabs $0x8037a5,%rax
+  803d12:	00 00 00 
+  803d15:	ff d0                	call   *%rax
+}
+  803d17:	5d                   	pop    %rbp
+  803d18:	c3                   	ret
+
+0000000000803d19 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803d19:	55                   	push   %rbp
+  803d1a:	48 89 e5             	mov    %rsp,%rbp
+  803d1d:	41 56                	push   %r14
+  803d1f:	41 55                	push   %r13
+  803d21:	41 54                	push   %r12
+  803d23:	53                   	push   %rbx
+  803d24:	48 83 ec 10          	sub    $0x10,%rsp
+  803d28:	41 89 f6             	mov    %esi,%r14d
+  803d2b:	49 89 d4             	mov    %rdx,%r12
+  803d2e:	48 89 cb             	mov    %rcx,%rbx
+  803d31:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d34:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d38:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  803d3f:	00 00 00 
+  803d42:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d44:	85 c0                	test   %eax,%eax
+  803d46:	78 46                	js     803d8e <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d48:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d4c:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803d53:	00 00 00 
+  803d56:	8b 00                	mov    (%rax),%eax
+  803d58:	39 02                	cmp    %eax,(%rdx)
+  803d5a:	75 3f                	jne    803d9b <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803d5c:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803d63:	00 00 00 
+  803d66:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803d69:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803d6b:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803d6f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803d73:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803d77:	48 89 da             	mov    %rbx,%rdx
+  803d7a:	4c 89 e6             	mov    %r12,%rsi
+  803d7d:	bf 09 00 00 00       	mov    $0x9,%edi
+  803d82:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  803d89:	00 00 00 
+  803d8c:	ff d0                	call   *%rax
+}
+  803d8e:	48 83 c4 10          	add    $0x10,%rsp
+  803d92:	5b                   	pop    %rbx
+  803d93:	41 5c                	pop    %r12
+  803d95:	41 5d                	pop    %r13
+  803d97:	41 5e                	pop    %r14
+  803d99:	5d                   	pop    %rbp
+  803d9a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d9b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803da0:	eb ec                	jmp    803d8e <file_map+0x75>
+
+0000000000803da2 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803da2:	55                   	push   %rbp
+  803da3:	48 89 e5             	mov    %rsp,%rbp
+  803da6:	41 54                	push   %r12
+  803da8:	53                   	push   %rbx
+  803da9:	48 83 ec 20          	sub    $0x20,%rsp
+  803dad:	41 89 f4             	mov    %esi,%r12d
+  803db0:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803db3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803db7:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  803dbe:	00 00 00 
+  803dc1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dc3:	85 c0                	test   %eax,%eax
+  803dc5:	78 3c                	js     803e03 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803dc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dcb:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803dd2:	00 00 00 
+  803dd5:	8b 0a                	mov    (%rdx),%ecx
+  803dd7:	39 08                	cmp    %ecx,(%rax)
+  803dd9:	75 31                	jne    803e0c <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803ddb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803dde:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803de1:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803de5:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803de9:	ba 10 00 00 00       	mov    $0x10,%edx
+  803dee:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803df2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803df7:	48 b8 a5 37 80 00 00 	movabs $0x8037a5,%rax
+  803dfe:	00 00 00 
+  803e01:	ff d0                	call   *%rax
+}
+  803e03:	48 83 c4 20          	add    $0x20,%rsp
+  803e07:	5b                   	pop    %rbx
+  803e08:	41 5c                	pop    %r12
+  803e0a:	5d                   	pop    %rbp
+  803e0b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e0c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e11:	eb f0                	jmp    803e03 <file_msync+0x61>
+
+0000000000803e13 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803e13:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803e17:	7f 01                	jg     803e1a <writebuf+0x7>
+  803e19:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803e1a:	55                   	push   %rbp
+  803e1b:	48 89 e5             	mov    %rsp,%rbp
+  803e1e:	53                   	push   %rbx
+  803e1f:	48 83 ec 08          	sub    $0x8,%rsp
+  803e23:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803e26:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803e2a:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803e2e:	8b 3f                	mov    (%rdi),%edi
+  803e30:	48 b8 ce 34 80 00 00 	movabs $0x8034ce,%rax
+  803e37:	00 00 00 
+  803e3a:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803e3c:	48 85 c0             	test   %rax,%rax
+  803e3f:	7e 04                	jle    803e45 <writebuf+0x32>
+  803e41:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803e45:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803e49:	48 39 c2             	cmp    %rax,%rdx
+  803e4c:	74 0f                	je     803e5d <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803e4e:	48 85 c0             	test   %rax,%rax
+  803e51:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e56:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803e5a:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803e5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e61:	c9                   	leave
+  803e62:	c3                   	ret
+
+0000000000803e63 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803e63:	8b 46 04             	mov    0x4(%rsi),%eax
+  803e66:	8d 50 01             	lea    0x1(%rax),%edx
+  803e69:	89 56 04             	mov    %edx,0x4(%rsi)
+  803e6c:	48 98                	cltq
+  803e6e:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803e73:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e79:	74 01                	je     803e7c <putch+0x19>
+  803e7b:	c3                   	ret
+putch(int ch, void *arg) {
+  803e7c:	55                   	push   %rbp
+  803e7d:	48 89 e5             	mov    %rsp,%rbp
+  803e80:	53                   	push   %rbx
+  803e81:	48 83 ec 08          	sub    $0x8,%rsp
+  803e85:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e88:	48 89 f7             	mov    %rsi,%rdi
+  803e8b:	48 b8 13 3e 80 00 00 	movabs $0x803e13,%rax
+  803e92:	00 00 00 
+  803e95:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e97:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ea2:	c9                   	leave
+  803ea3:	c3                   	ret
+
+0000000000803ea4 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803ea4:	55                   	push   %rbp
+  803ea5:	48 89 e5             	mov    %rsp,%rbp
+  803ea8:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803eaf:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803eb2:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803eb8:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803ebf:	00 00 00 
+    state.result = 0;
+  803ec2:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803ec9:	00 00 00 00 
+    state.error = 1;
+  803ecd:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803ed4:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803ed7:	48 89 f2             	mov    %rsi,%rdx
+  803eda:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803ee1:	48 bf 63 3e 80 00 00 	movabs $0x803e63,%rdi
+  803ee8:	00 00 00 
+  803eeb:	48 b8 84 1a 80 00 00 	movabs $0x801a84,%rax
+  803ef2:	00 00 00 
+  803ef5:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803ef7:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803efe:	7f 14                	jg     803f14 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803f00:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803f07:	48 85 c0             	test   %rax,%rax
+  803f0a:	75 06                	jne    803f12 <vfprintf+0x6e>
+  803f0c:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803f12:	c9                   	leave
+  803f13:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803f14:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803f1b:	48 b8 13 3e 80 00 00 	movabs $0x803e13,%rax
+  803f22:	00 00 00 
+  803f25:	ff d0                	call   *%rax
+  803f27:	eb d7                	jmp    803f00 <vfprintf+0x5c>
+
+0000000000803f29 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803f29:	55                   	push   %rbp
+  803f2a:	48 89 e5             	mov    %rsp,%rbp
+  803f2d:	48 83 ec 50          	sub    $0x50,%rsp
+  803f31:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f35:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f39:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f3d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f41:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f48:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f50:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f54:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803f58:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f5c:	48 b8 a4 3e 80 00 00 	movabs $0x803ea4,%rax
+  803f63:	00 00 00 
+  803f66:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f68:	c9                   	leave
+  803f69:	c3                   	ret
+
+0000000000803f6a <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803f6a:	55                   	push   %rbp
+  803f6b:	48 89 e5             	mov    %rsp,%rbp
+  803f6e:	48 83 ec 50          	sub    $0x50,%rsp
+  803f72:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f76:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f7a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f7e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f82:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f86:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f8d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f95:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f99:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f9d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803fa1:	48 89 fe             	mov    %rdi,%rsi
+  803fa4:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fa9:	48 b8 a4 3e 80 00 00 	movabs $0x803ea4,%rax
+  803fb0:	00 00 00 
+  803fb3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803fb5:	c9                   	leave
+  803fb6:	c3                   	ret
+
+0000000000803fb7 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803fb7:	55                   	push   %rbp
+  803fb8:	48 89 e5             	mov    %rsp,%rbp
+  803fbb:	41 54                	push   %r12
+  803fbd:	53                   	push   %rbx
+  803fbe:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fc1:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  803fc8:	00 00 00 
+  803fcb:	ff d0                	call   *%rax
+  803fcd:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803fd0:	48 be 10 65 80 00 00 	movabs $0x806510,%rsi
+  803fd7:	00 00 00 
+  803fda:	48 89 df             	mov    %rbx,%rdi
+  803fdd:	48 b8 6b 22 80 00 00 	movabs $0x80226b,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803fe9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803fee:	41 2b 04 24          	sub    (%r12),%eax
+  803ff2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803ff8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803fff:	00 00 00 
+    stat->st_dev = &devpipe;
+  804002:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804009:	00 00 00 
+  80400c:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804013:	b8 00 00 00 00       	mov    $0x0,%eax
+  804018:	5b                   	pop    %rbx
+  804019:	41 5c                	pop    %r12
+  80401b:	5d                   	pop    %rbp
+  80401c:	c3                   	ret
+
+000000000080401d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80401d:	55                   	push   %rbp
+  80401e:	48 89 e5             	mov    %rsp,%rbp
+  804021:	41 54                	push   %r12
+  804023:	53                   	push   %rbx
+  804024:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804027:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80402c:	48 89 fe             	mov    %rdi,%rsi
+  80402f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804034:	49 bc a8 2a 80 00 00 	movabs $0x802aa8,%r12
+  80403b:	00 00 00 
+  80403e:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804041:	48 89 df             	mov    %rbx,%rdi
+  804044:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  80404b:	00 00 00 
+  80404e:	ff d0                	call   *%rax
+  804050:	48 89 c6             	mov    %rax,%rsi
+  804053:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804058:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405d:	41 ff d4             	call   *%r12
+}
+  804060:	5b                   	pop    %rbx
+  804061:	41 5c                	pop    %r12
+  804063:	5d                   	pop    %rbp
+  804064:	c3                   	ret
+
+0000000000804065 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804065:	55                   	push   %rbp
+  804066:	48 89 e5             	mov    %rsp,%rbp
+  804069:	41 57                	push   %r15
+  80406b:	41 56                	push   %r14
+  80406d:	41 55                	push   %r13
+  80406f:	41 54                	push   %r12
+  804071:	53                   	push   %rbx
+  804072:	48 83 ec 18          	sub    $0x18,%rsp
+  804076:	49 89 fc             	mov    %rdi,%r12
+  804079:	49 89 f5             	mov    %rsi,%r13
+  80407c:	49 89 d7             	mov    %rdx,%r15
+  80407f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804083:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  80408a:	00 00 00 
+  80408d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80408f:	4d 85 ff             	test   %r15,%r15
+  804092:	0f 84 af 00 00 00    	je     804147 <devpipe_write+0xe2>
+  804098:	48 89 c3             	mov    %rax,%rbx
+  80409b:	4c 89 f8             	mov    %r15,%rax
+  80409e:	4d 89 ef             	mov    %r13,%r15
+  8040a1:	4c 01 e8             	add    %r13,%rax
+  8040a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040a8:	49 bd 9e 29 80 00 00 	movabs $0x80299e,%r13
+  8040af:	00 00 00 
+            sys_yield();
+  8040b2:	49 be 2f 29 80 00 00 	movabs $0x80292f,%r14
+  8040b9:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040bc:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040bf:	48 63 ce             	movslq %esi,%rcx
+  8040c2:	48 63 03             	movslq (%rbx),%rax
+  8040c5:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040cb:	48 39 c1             	cmp    %rax,%rcx
+  8040ce:	72 2e                	jb     8040fe <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040d5:	48 89 da             	mov    %rbx,%rdx
+  8040d8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040dd:	4c 89 e7             	mov    %r12,%rdi
+  8040e0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8040e3:	85 c0                	test   %eax,%eax
+  8040e5:	74 66                	je     80414d <devpipe_write+0xe8>
+            sys_yield();
+  8040e7:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040ea:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040ed:	48 63 ce             	movslq %esi,%rcx
+  8040f0:	48 63 03             	movslq (%rbx),%rax
+  8040f3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040f9:	48 39 c1             	cmp    %rax,%rcx
+  8040fc:	73 d2                	jae    8040d0 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8040fe:	41 0f b6 3f          	movzbl (%r15),%edi
+  804102:	48 89 ca             	mov    %rcx,%rdx
+  804105:	48 c1 ea 03          	shr    $0x3,%rdx
+  804109:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804110:	08 10 20 
+  804113:	48 f7 e2             	mul    %rdx
+  804116:	48 c1 ea 06          	shr    $0x6,%rdx
+  80411a:	48 89 d0             	mov    %rdx,%rax
+  80411d:	48 c1 e0 09          	shl    $0x9,%rax
+  804121:	48 29 d0             	sub    %rdx,%rax
+  804124:	48 c1 e0 03          	shl    $0x3,%rax
+  804128:	48 29 c1             	sub    %rax,%rcx
+  80412b:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804130:	83 c6 01             	add    $0x1,%esi
+  804133:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804136:	49 83 c7 01          	add    $0x1,%r15
+  80413a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80413e:	49 39 c7             	cmp    %rax,%r15
+  804141:	0f 85 75 ff ff ff    	jne    8040bc <devpipe_write+0x57>
+    return n;
+  804147:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80414b:	eb 05                	jmp    804152 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80414d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804152:	48 83 c4 18          	add    $0x18,%rsp
+  804156:	5b                   	pop    %rbx
+  804157:	41 5c                	pop    %r12
+  804159:	41 5d                	pop    %r13
+  80415b:	41 5e                	pop    %r14
+  80415d:	41 5f                	pop    %r15
+  80415f:	5d                   	pop    %rbp
+  804160:	c3                   	ret
+
+0000000000804161 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804161:	55                   	push   %rbp
+  804162:	48 89 e5             	mov    %rsp,%rbp
+  804165:	41 57                	push   %r15
+  804167:	41 56                	push   %r14
+  804169:	41 55                	push   %r13
+  80416b:	41 54                	push   %r12
+  80416d:	53                   	push   %rbx
+  80416e:	48 83 ec 18          	sub    $0x18,%rsp
+  804172:	49 89 fc             	mov    %rdi,%r12
+  804175:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804179:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80417d:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  804184:	00 00 00 
+  804187:	ff d0                	call   *%rax
+  804189:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80418c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804192:	49 bd 9e 29 80 00 00 	movabs $0x80299e,%r13
+  804199:	00 00 00 
+            sys_yield();
+  80419c:	49 be 2f 29 80 00 00 	movabs $0x80292f,%r14
+  8041a3:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8041a6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8041ab:	74 7d                	je     80422a <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041ad:	8b 03                	mov    (%rbx),%eax
+  8041af:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041b2:	75 26                	jne    8041da <devpipe_read+0x79>
+            if (i > 0) return i;
+  8041b4:	4d 85 ff             	test   %r15,%r15
+  8041b7:	75 77                	jne    804230 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041b9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041be:	48 89 da             	mov    %rbx,%rdx
+  8041c1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041c6:	4c 89 e7             	mov    %r12,%rdi
+  8041c9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8041cc:	85 c0                	test   %eax,%eax
+  8041ce:	74 72                	je     804242 <devpipe_read+0xe1>
+            sys_yield();
+  8041d0:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041d3:	8b 03                	mov    (%rbx),%eax
+  8041d5:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041d8:	74 df                	je     8041b9 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8041da:	48 63 c8             	movslq %eax,%rcx
+  8041dd:	48 89 ca             	mov    %rcx,%rdx
+  8041e0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041e4:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8041eb:	08 10 20 
+  8041ee:	48 89 d0             	mov    %rdx,%rax
+  8041f1:	48 f7 e6             	mul    %rsi
+  8041f4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041f8:	48 89 d0             	mov    %rdx,%rax
+  8041fb:	48 c1 e0 09          	shl    $0x9,%rax
+  8041ff:	48 29 d0             	sub    %rdx,%rax
+  804202:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804209:	00 
+  80420a:	48 89 c8             	mov    %rcx,%rax
+  80420d:	48 29 d0             	sub    %rdx,%rax
+  804210:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804215:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804219:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80421d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804220:	49 83 c7 01          	add    $0x1,%r15
+  804224:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804228:	75 83                	jne    8041ad <devpipe_read+0x4c>
+    return n;
+  80422a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80422e:	eb 03                	jmp    804233 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804230:	4c 89 f8             	mov    %r15,%rax
+}
+  804233:	48 83 c4 18          	add    $0x18,%rsp
+  804237:	5b                   	pop    %rbx
+  804238:	41 5c                	pop    %r12
+  80423a:	41 5d                	pop    %r13
+  80423c:	41 5e                	pop    %r14
+  80423e:	41 5f                	pop    %r15
+  804240:	5d                   	pop    %rbp
+  804241:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804242:	b8 00 00 00 00       	mov    $0x0,%eax
+  804247:	eb ea                	jmp    804233 <devpipe_read+0xd2>
+
+0000000000804249 <pipe>:
+pipe(int pfd[2]) {
+  804249:	55                   	push   %rbp
+  80424a:	48 89 e5             	mov    %rsp,%rbp
+  80424d:	41 55                	push   %r13
+  80424f:	41 54                	push   %r12
+  804251:	53                   	push   %rbx
+  804252:	48 83 ec 18          	sub    $0x18,%rsp
+  804256:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804259:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80425d:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  804264:	00 00 00 
+  804267:	ff d0                	call   *%rax
+  804269:	89 c3                	mov    %eax,%ebx
+  80426b:	85 c0                	test   %eax,%eax
+  80426d:	0f 88 a0 01 00 00    	js     804413 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804273:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804278:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80427d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804281:	bf 00 00 00 00       	mov    $0x0,%edi
+  804286:	48 b8 d0 29 80 00 00 	movabs $0x8029d0,%rax
+  80428d:	00 00 00 
+  804290:	ff d0                	call   *%rax
+  804292:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804294:	85 c0                	test   %eax,%eax
+  804296:	0f 88 77 01 00 00    	js     804413 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80429c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8042a0:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  8042a7:	00 00 00 
+  8042aa:	ff d0                	call   *%rax
+  8042ac:	89 c3                	mov    %eax,%ebx
+  8042ae:	85 c0                	test   %eax,%eax
+  8042b0:	0f 88 43 01 00 00    	js     8043f9 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8042b6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042c0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8042c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042c9:	48 b8 d0 29 80 00 00 	movabs $0x8029d0,%rax
+  8042d0:	00 00 00 
+  8042d3:	ff d0                	call   *%rax
+  8042d5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8042d7:	85 c0                	test   %eax,%eax
+  8042d9:	0f 88 1a 01 00 00    	js     8043f9 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8042df:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8042e3:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  8042ea:	00 00 00 
+  8042ed:	ff d0                	call   *%rax
+  8042ef:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8042f2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042fc:	48 89 c6             	mov    %rax,%rsi
+  8042ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  804304:	48 b8 d0 29 80 00 00 	movabs $0x8029d0,%rax
+  80430b:	00 00 00 
+  80430e:	ff d0                	call   *%rax
+  804310:	89 c3                	mov    %eax,%ebx
+  804312:	85 c0                	test   %eax,%eax
+  804314:	0f 88 c5 00 00 00    	js     8043df <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80431a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80431e:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  804325:	00 00 00 
+  804328:	ff d0                	call   *%rax
+  80432a:	48 89 c1             	mov    %rax,%rcx
+  80432d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804333:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804339:	ba 00 00 00 00       	mov    $0x0,%edx
+  80433e:	4c 89 ee             	mov    %r13,%rsi
+  804341:	bf 00 00 00 00       	mov    $0x0,%edi
+  804346:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  80434d:	00 00 00 
+  804350:	ff d0                	call   *%rax
+  804352:	89 c3                	mov    %eax,%ebx
+  804354:	85 c0                	test   %eax,%eax
+  804356:	78 6e                	js     8043c6 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804358:	be 00 10 00 00       	mov    $0x1000,%esi
+  80435d:	4c 89 ef             	mov    %r13,%rdi
+  804360:	48 b8 66 29 80 00 00 	movabs $0x802966,%rax
+  804367:	00 00 00 
+  80436a:	ff d0                	call   *%rax
+  80436c:	83 f8 02             	cmp    $0x2,%eax
+  80436f:	0f 85 ab 00 00 00    	jne    804420 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804375:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80437c:	00 00 
+  80437e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804382:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804384:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804388:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80438f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804393:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804395:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804399:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8043a0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043a4:	48 bb 2e 30 80 00 00 	movabs $0x80302e,%rbx
+  8043ab:	00 00 00 
+  8043ae:	ff d3                	call   *%rbx
+  8043b0:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8043b4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043b8:	ff d3                	call   *%rbx
+  8043ba:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8043bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043c4:	eb 4d                	jmp    804413 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8043c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043cb:	4c 89 ee             	mov    %r13,%rsi
+  8043ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043d3:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  8043da:	00 00 00 
+  8043dd:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8043df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043e4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8043e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043ed:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  8043f4:	00 00 00 
+  8043f7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8043f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043fe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804402:	bf 00 00 00 00       	mov    $0x0,%edi
+  804407:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  80440e:	00 00 00 
+  804411:	ff d0                	call   *%rax
+}
+  804413:	89 d8                	mov    %ebx,%eax
+  804415:	48 83 c4 18          	add    $0x18,%rsp
+  804419:	5b                   	pop    %rbx
+  80441a:	41 5c                	pop    %r12
+  80441c:	41 5d                	pop    %r13
+  80441e:	5d                   	pop    %rbp
+  80441f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804420:	48 b9 28 65 80 00 00 	movabs $0x806528,%rcx
+  804427:	00 00 00 
+  80442a:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  804431:	00 00 00 
+  804434:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804439:	48 bf 17 65 80 00 00 	movabs $0x806517,%rdi
+  804440:	00 00 00 
+  804443:	b8 00 00 00 00       	mov    $0x0,%eax
+  804448:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  80444f:	00 00 00 
+  804452:	41 ff d0             	call   *%r8
+
+0000000000804455 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804455:	55                   	push   %rbp
+  804456:	48 89 e5             	mov    %rsp,%rbp
+  804459:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80445d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804461:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  804468:	00 00 00 
+  80446b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80446d:	85 c0                	test   %eax,%eax
+  80446f:	78 35                	js     8044a6 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804471:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804475:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  80447c:	00 00 00 
+  80447f:	ff d0                	call   *%rax
+  804481:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804484:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804489:	be 00 10 00 00       	mov    $0x1000,%esi
+  80448e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804492:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  804499:	00 00 00 
+  80449c:	ff d0                	call   *%rax
+  80449e:	85 c0                	test   %eax,%eax
+  8044a0:	0f 94 c0             	sete   %al
+  8044a3:	0f b6 c0             	movzbl %al,%eax
+}
+  8044a6:	c9                   	leave
+  8044a7:	c3                   	ret
+
+00000000008044a8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8044a8:	48 89 f8             	mov    %rdi,%rax
+  8044ab:	48 c1 e8 27          	shr    $0x27,%rax
+  8044af:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8044b6:	01 00 00 
+  8044b9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044bd:	f6 c2 01             	test   $0x1,%dl
+  8044c0:	74 6d                	je     80452f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044c2:	48 89 f8             	mov    %rdi,%rax
+  8044c5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8044c9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044d0:	01 00 00 
+  8044d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044d7:	f6 c2 01             	test   $0x1,%dl
+  8044da:	74 62                	je     80453e <get_uvpt_entry+0x96>
+  8044dc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044e3:	01 00 00 
+  8044e6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044ea:	f6 c2 80             	test   $0x80,%dl
+  8044ed:	75 4f                	jne    80453e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044ef:	48 89 f8             	mov    %rdi,%rax
+  8044f2:	48 c1 e8 15          	shr    $0x15,%rax
+  8044f6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044fd:	01 00 00 
+  804500:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804504:	f6 c2 01             	test   $0x1,%dl
+  804507:	74 44                	je     80454d <get_uvpt_entry+0xa5>
+  804509:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804510:	01 00 00 
+  804513:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804517:	f6 c2 80             	test   $0x80,%dl
+  80451a:	75 31                	jne    80454d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80451c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804520:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804527:	01 00 00 
+  80452a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80452e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80452f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804536:	01 00 00 
+  804539:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80453d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80453e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804545:	01 00 00 
+  804548:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80454c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80454d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804554:	01 00 00 
+  804557:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80455b:	c3                   	ret
+
+000000000080455c <get_prot>:
+
+int
+get_prot(void *va) {
+  80455c:	55                   	push   %rbp
+  80455d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804560:	48 b8 a8 44 80 00 00 	movabs $0x8044a8,%rax
+  804567:	00 00 00 
+  80456a:	ff d0                	call   *%rax
+  80456c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80456f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804574:	89 c1                	mov    %eax,%ecx
+  804576:	83 c9 04             	or     $0x4,%ecx
+  804579:	f6 c2 01             	test   $0x1,%dl
+  80457c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80457f:	89 c1                	mov    %eax,%ecx
+  804581:	83 c9 02             	or     $0x2,%ecx
+  804584:	f6 c2 02             	test   $0x2,%dl
+  804587:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80458a:	89 c1                	mov    %eax,%ecx
+  80458c:	83 c9 01             	or     $0x1,%ecx
+  80458f:	48 85 d2             	test   %rdx,%rdx
+  804592:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804595:	89 c1                	mov    %eax,%ecx
+  804597:	83 c9 40             	or     $0x40,%ecx
+  80459a:	f6 c6 04             	test   $0x4,%dh
+  80459d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8045a0:	5d                   	pop    %rbp
+  8045a1:	c3                   	ret
+
+00000000008045a2 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8045a2:	55                   	push   %rbp
+  8045a3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8045a6:	48 b8 a8 44 80 00 00 	movabs $0x8044a8,%rax
+  8045ad:	00 00 00 
+  8045b0:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8045b2:	48 c1 e8 06          	shr    $0x6,%rax
+  8045b6:	83 e0 01             	and    $0x1,%eax
+}
+  8045b9:	5d                   	pop    %rbp
+  8045ba:	c3                   	ret
+
+00000000008045bb <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8045bb:	55                   	push   %rbp
+  8045bc:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8045bf:	48 b8 a8 44 80 00 00 	movabs $0x8044a8,%rax
+  8045c6:	00 00 00 
+  8045c9:	ff d0                	call   *%rax
+  8045cb:	83 e0 01             	and    $0x1,%eax
+}
+  8045ce:	5d                   	pop    %rbp
+  8045cf:	c3                   	ret
+
+00000000008045d0 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8045d0:	55                   	push   %rbp
+  8045d1:	48 89 e5             	mov    %rsp,%rbp
+  8045d4:	41 57                	push   %r15
+  8045d6:	41 56                	push   %r14
+  8045d8:	41 55                	push   %r13
+  8045da:	41 54                	push   %r12
+  8045dc:	53                   	push   %rbx
+  8045dd:	48 83 ec 28          	sub    $0x28,%rsp
+  8045e1:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8045e5:	48 85 ff             	test   %rdi,%rdi
+  8045e8:	74 1e                	je     804608 <foreach_shared_region+0x38>
+  8045ea:	49 89 ff             	mov    %rdi,%r15
+  8045ed:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8045f3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8045f9:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804600:	01 00 00 
+  804603:	e9 72 02 00 00       	jmp    80487a <foreach_shared_region+0x2aa>
+    assert(fun);
+  804608:	48 b9 4c 65 80 00 00 	movabs $0x80654c,%rcx
+  80460f:	00 00 00 
+  804612:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  804619:	00 00 00 
+  80461c:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804621:	48 bf 50 65 80 00 00 	movabs $0x806550,%rdi
+  804628:	00 00 00 
+  80462b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804630:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  804637:	00 00 00 
+  80463a:	41 ff d0             	call   *%r8
+  80463d:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804644:	eb 6c                	jmp    8046b2 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804646:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80464d:	ff ff ff 
+  804650:	4c 21 e2             	and    %r12,%rdx
+  804653:	48 89 d8             	mov    %rbx,%rax
+  804656:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80465b:	48 83 c0 01          	add    $0x1,%rax
+  80465f:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804663:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80466a:	00 00 00 
+  80466d:	48 21 c8             	and    %rcx,%rax
+  804670:	48 09 d0             	or     %rdx,%rax
+  804673:	49 89 c4             	mov    %rax,%r12
+  804676:	eb 30                	jmp    8046a8 <foreach_shared_region+0xd8>
+  804678:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80467f:	ff ff ff 
+  804682:	4c 21 e2             	and    %r12,%rdx
+  804685:	48 89 d8             	mov    %rbx,%rax
+  804688:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80468d:	48 83 c0 01          	add    $0x1,%rax
+  804691:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804695:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80469c:	00 00 00 
+  80469f:	48 21 c8             	and    %rcx,%rax
+  8046a2:	48 09 d0             	or     %rdx,%rax
+  8046a5:	49 89 c4             	mov    %rax,%r12
+  8046a8:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8046ac:	0f 84 99 01 00 00    	je     80484b <foreach_shared_region+0x27b>
+  8046b2:	4c 89 e3             	mov    %r12,%rbx
+  8046b5:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8046b9:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8046c0:	01 00 00 
+  8046c3:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8046c7:	a8 01                	test   $0x1,%al
+  8046c9:	0f 84 77 ff ff ff    	je     804646 <foreach_shared_region+0x76>
+  8046cf:	a8 80                	test   $0x80,%al
+  8046d1:	74 19                	je     8046ec <foreach_shared_region+0x11c>
+  8046d3:	f6 c4 04             	test   $0x4,%ah
+  8046d6:	74 a0                	je     804678 <foreach_shared_region+0xa8>
+  8046d8:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8046df:	40 
+  8046e0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046e4:	4c 89 e7             	mov    %r12,%rdi
+  8046e7:	41 ff d7             	call   *%r15
+  8046ea:	eb 8c                	jmp    804678 <foreach_shared_region+0xa8>
+  8046ec:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8046f3:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8046f7:	eb 46                	jmp    80473f <foreach_shared_region+0x16f>
+  8046f9:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804700:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804706:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80470a:	48 c1 e0 15          	shl    $0x15,%rax
+  80470e:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804713:	49 09 c4             	or     %rax,%r12
+  804716:	eb 1d                	jmp    804735 <foreach_shared_region+0x165>
+  804718:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80471f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804725:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804729:	48 c1 e0 15          	shl    $0x15,%rax
+  80472d:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804732:	49 09 c4             	or     %rax,%r12
+  804735:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804739:	0f 84 d3 00 00 00    	je     804812 <foreach_shared_region+0x242>
+  80473f:	4c 89 e3             	mov    %r12,%rbx
+  804742:	48 c1 eb 15          	shr    $0x15,%rbx
+  804746:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80474d:	01 00 00 
+  804750:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804754:	a8 01                	test   $0x1,%al
+  804756:	74 a1                	je     8046f9 <foreach_shared_region+0x129>
+  804758:	a8 80                	test   $0x80,%al
+  80475a:	74 19                	je     804775 <foreach_shared_region+0x1a5>
+  80475c:	f6 c4 04             	test   $0x4,%ah
+  80475f:	74 b7                	je     804718 <foreach_shared_region+0x148>
+  804761:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804768:	00 
+  804769:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80476d:	4c 89 e7             	mov    %r12,%rdi
+  804770:	41 ff d7             	call   *%r15
+  804773:	eb a3                	jmp    804718 <foreach_shared_region+0x148>
+  804775:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80477b:	eb 3b                	jmp    8047b8 <foreach_shared_region+0x1e8>
+  80477d:	f6 c4 04             	test   $0x4,%ah
+  804780:	74 12                	je     804794 <foreach_shared_region+0x1c4>
+  804782:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804789:	00 
+  80478a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80478e:	4c 89 e7             	mov    %r12,%rdi
+  804791:	41 ff d7             	call   *%r15
+  804794:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80479b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047a1:	48 83 c3 01          	add    $0x1,%rbx
+  8047a5:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8047a9:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8047af:	49 09 dc             	or     %rbx,%r12
+  8047b2:	41 83 ed 01          	sub    $0x1,%r13d
+  8047b6:	74 2f                	je     8047e7 <foreach_shared_region+0x217>
+  8047b8:	4c 89 e3             	mov    %r12,%rbx
+  8047bb:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8047bf:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8047c3:	a8 01                	test   $0x1,%al
+  8047c5:	75 b6                	jne    80477d <foreach_shared_region+0x1ad>
+  8047c7:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8047ce:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047d4:	48 83 c3 01          	add    $0x1,%rbx
+  8047d8:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8047dc:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8047e2:	49 09 dc             	or     %rbx,%r12
+  8047e5:	eb cb                	jmp    8047b2 <foreach_shared_region+0x1e2>
+  8047e7:	4c 89 e0             	mov    %r12,%rax
+  8047ea:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8047f0:	49 c1 ec 15          	shr    $0x15,%r12
+  8047f4:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8047fb:	49 83 c4 01          	add    $0x1,%r12
+  8047ff:	49 c1 e4 15          	shl    $0x15,%r12
+  804803:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80480a:	49 09 c4             	or     %rax,%r12
+  80480d:	e9 23 ff ff ff       	jmp    804735 <foreach_shared_region+0x165>
+  804812:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804816:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80481d:	ff ff ff 
+  804820:	4c 21 e0             	and    %r12,%rax
+  804823:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804827:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80482e:	49 83 c4 01          	add    $0x1,%r12
+  804832:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804836:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  80483d:	00 00 00 
+  804840:	49 21 d4             	and    %rdx,%r12
+  804843:	49 09 c4             	or     %rax,%r12
+  804846:	e9 5d fe ff ff       	jmp    8046a8 <foreach_shared_region+0xd8>
+  80484b:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804852:	00 ff ff 
+  804855:	4c 21 e0             	and    %r12,%rax
+  804858:	49 c1 ec 27          	shr    $0x27,%r12
+  80485c:	49 83 c4 01          	add    $0x1,%r12
+  804860:	49 c1 e4 27          	shl    $0x27,%r12
+  804864:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80486b:	ff 00 00 
+  80486e:	49 21 d4             	and    %rdx,%r12
+  804871:	49 09 c4             	or     %rax,%r12
+  804874:	41 83 ed 01          	sub    $0x1,%r13d
+  804878:	74 48                	je     8048c2 <foreach_shared_region+0x2f2>
+  80487a:	4c 89 e0             	mov    %r12,%rax
+  80487d:	48 c1 e8 27          	shr    $0x27,%rax
+  804881:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804888:	01 00 00 
+  80488b:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  80488f:	f6 c2 01             	test   $0x1,%dl
+  804892:	0f 85 a5 fd ff ff    	jne    80463d <foreach_shared_region+0x6d>
+  804898:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  80489f:	00 ff ff 
+  8048a2:	4c 21 e2             	and    %r12,%rdx
+  8048a5:	48 83 c0 01          	add    $0x1,%rax
+  8048a9:	48 c1 e0 27          	shl    $0x27,%rax
+  8048ad:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8048b4:	ff 00 00 
+  8048b7:	48 21 c8             	and    %rcx,%rax
+  8048ba:	48 09 d0             	or     %rdx,%rax
+  8048bd:	49 89 c4             	mov    %rax,%r12
+  8048c0:	eb b2                	jmp    804874 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8048c2:	4d 85 e4             	test   %r12,%r12
+  8048c5:	75 14                	jne    8048db <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8048c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048cc:	48 83 c4 28          	add    $0x28,%rsp
+  8048d0:	5b                   	pop    %rbx
+  8048d1:	41 5c                	pop    %r12
+  8048d3:	41 5d                	pop    %r13
+  8048d5:	41 5e                	pop    %r14
+  8048d7:	41 5f                	pop    %r15
+  8048d9:	5d                   	pop    %rbp
+  8048da:	c3                   	ret
+    assert(addr == 0);
+  8048db:	48 b9 5b 65 80 00 00 	movabs $0x80655b,%rcx
+  8048e2:	00 00 00 
+  8048e5:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  8048ec:	00 00 00 
+  8048ef:	be 67 00 00 00       	mov    $0x67,%esi
+  8048f4:	48 bf 50 65 80 00 00 	movabs $0x806550,%rdi
+  8048fb:	00 00 00 
+  8048fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804903:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  80490a:	00 00 00 
+  80490d:	41 ff d0             	call   *%r8
+
+0000000000804910 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804910:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804917:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80491a:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804920:	eb 33                	jmp    804955 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804922:	48 83 c0 20          	add    $0x20,%rax
+  804926:	4c 39 c0             	cmp    %r8,%rax
+  804929:	74 25                	je     804950 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80492b:	48 8b 10             	mov    (%rax),%rdx
+  80492e:	48 85 d2             	test   %rdx,%rdx
+  804931:	74 ef                	je     804922 <mmap_place+0x12>
+  804933:	48 89 d1             	mov    %rdx,%rcx
+  804936:	48 03 48 08          	add    0x8(%rax),%rcx
+  80493a:	48 39 cf             	cmp    %rcx,%rdi
+  80493d:	73 e3                	jae    804922 <mmap_place+0x12>
+  80493f:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804943:	4c 39 ca             	cmp    %r9,%rdx
+  804946:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  80494a:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  80494e:	eb d2                	jmp    804922 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804950:	45 84 d2             	test   %r10b,%r10b
+  804953:	74 12                	je     804967 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804955:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80495c:	00 00 00 
+        moved = 0;
+  80495f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804965:	eb c4                	jmp    80492b <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804967:	48 01 fe             	add    %rdi,%rsi
+  80496a:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804971:	00 00 00 
+  804974:	48 39 f0             	cmp    %rsi,%rax
+  804977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80497c:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804980:	c3                   	ret
+
+0000000000804981 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804981:	55                   	push   %rbp
+  804982:	48 89 e5             	mov    %rsp,%rbp
+  804985:	41 57                	push   %r15
+  804987:	41 56                	push   %r14
+  804989:	41 55                	push   %r13
+  80498b:	41 54                	push   %r12
+  80498d:	53                   	push   %rbx
+  80498e:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804992:	48 8b 1f             	mov    (%rdi),%rbx
+  804995:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80499c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8049a3:	00 00 00 
+  8049a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ab:	eb 12                	jmp    8049bf <mmap_pgfault+0x3e>
+  8049ad:	48 83 c2 01          	add    $0x1,%rdx
+  8049b1:	48 83 c0 20          	add    $0x20,%rax
+  8049b5:	48 83 fa 20          	cmp    $0x20,%rdx
+  8049b9:	0f 84 04 01 00 00    	je     804ac3 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8049bf:	48 8b 08             	mov    (%rax),%rcx
+  8049c2:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8049c6:	48 39 de             	cmp    %rbx,%rsi
+  8049c9:	73 e2                	jae    8049ad <mmap_pgfault+0x2c>
+  8049cb:	48 03 48 08          	add    0x8(%rax),%rcx
+  8049cf:	48 39 cb             	cmp    %rcx,%rbx
+  8049d2:	73 d9                	jae    8049ad <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8049d4:	48 c1 e2 05          	shl    $0x5,%rdx
+  8049d8:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8049df:	00 00 00 
+  8049e2:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8049e6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8049ea:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8049ee:	f6 c2 01             	test   $0x1,%dl
+  8049f1:	0f 84 e0 00 00 00    	je     804ad7 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  8049f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049fc:	f6 c2 02             	test   $0x2,%dl
+  8049ff:	0f 84 c3 00 00 00    	je     804ac8 <mmap_pgfault+0x147>
+  804a05:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804a0c:	ff ff ff 
+  804a0f:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804a13:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804a1a:	00 00 00 
+  804a1d:	48 39 ca             	cmp    %rcx,%rdx
+  804a20:	0f 85 a2 00 00 00    	jne    804ac8 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804a26:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804a2b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a30:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804a37:	00 00 00 
+  804a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a3f:	48 b8 d0 29 80 00 00 	movabs $0x8029d0,%rax
+  804a46:	00 00 00 
+  804a49:	ff d0                	call   *%rax
+  804a4b:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a52:	85 d2                	test   %edx,%edx
+  804a54:	78 72                	js     804ac8 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804a56:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a5b:	48 89 de             	mov    %rbx,%rsi
+  804a5e:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804a65:	00 00 00 
+  804a68:	4c 89 e7             	mov    %r12,%rdi
+  804a6b:	48 b8 22 26 80 00 00 	movabs $0x802622,%rax
+  804a72:	00 00 00 
+  804a75:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804a77:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804a7d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a83:	48 89 d9             	mov    %rbx,%rcx
+  804a86:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a8b:	4c 89 e6             	mov    %r12,%rsi
+  804a8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a93:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  804a9a:	00 00 00 
+  804a9d:	ff d0                	call   *%rax
+  804a9f:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804aa1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804aa6:	4c 89 e6             	mov    %r12,%rsi
+  804aa9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aae:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  804ab5:	00 00 00 
+  804ab8:	ff d0                	call   *%rax
+    return res >= 0;
+  804aba:	89 d8                	mov    %ebx,%eax
+  804abc:	f7 d0                	not    %eax
+  804abe:	c1 e8 1f             	shr    $0x1f,%eax
+  804ac1:	eb 05                	jmp    804ac8 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804ac8:	48 83 c4 18          	add    $0x18,%rsp
+  804acc:	5b                   	pop    %rbx
+  804acd:	41 5c                	pop    %r12
+  804acf:	41 5d                	pop    %r13
+  804ad1:	41 5e                	pop    %r14
+  804ad3:	41 5f                	pop    %r15
+  804ad5:	5d                   	pop    %rbp
+  804ad6:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804ad7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804adb:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804adf:	4c 03 30             	add    (%rax),%r14
+  804ae2:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804ae9:	49 39 c6             	cmp    %rax,%r14
+  804aec:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804af0:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804af7:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804afd:	49 bf bb 45 80 00 00 	movabs $0x8045bb,%r15
+  804b04:	00 00 00 
+  804b07:	4d 39 f4             	cmp    %r14,%r12
+  804b0a:	73 1d                	jae    804b29 <mmap_pgfault+0x1a8>
+  804b0c:	4c 89 e7             	mov    %r12,%rdi
+  804b0f:	41 ff d7             	call   *%r15
+  804b12:	84 c0                	test   %al,%al
+  804b14:	75 13                	jne    804b29 <mmap_pgfault+0x1a8>
+  804b16:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804b1d:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804b24:	4d 39 f4             	cmp    %r14,%r12
+  804b27:	72 e3                	jb     804b0c <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804b29:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804b2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b33:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804b37:	74 2a                	je     804b63 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804b39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b3d:	89 de                	mov    %ebx,%esi
+  804b3f:	2b 30                	sub    (%rax),%esi
+  804b41:	03 70 1c             	add    0x1c(%rax),%esi
+  804b44:	8b 78 18             	mov    0x18(%rax),%edi
+  804b47:	4c 89 e9             	mov    %r13,%rcx
+  804b4a:	48 89 da             	mov    %rbx,%rdx
+  804b4d:	48 b8 19 3d 80 00 00 	movabs $0x803d19,%rax
+  804b54:	00 00 00 
+  804b57:	ff d0                	call   *%rax
+    return res > 0;
+  804b59:	85 c0                	test   %eax,%eax
+  804b5b:	0f 9f c0             	setg   %al
+  804b5e:	e9 65 ff ff ff       	jmp    804ac8 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804b63:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804b67:	eb d0                	jmp    804b39 <mmap_pgfault+0x1b8>
+
+0000000000804b69 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804b69:	55                   	push   %rbp
+  804b6a:	48 89 e5             	mov    %rsp,%rbp
+  804b6d:	41 57                	push   %r15
+  804b6f:	41 56                	push   %r14
+  804b71:	41 55                	push   %r13
+  804b73:	41 54                	push   %r12
+  804b75:	53                   	push   %rbx
+  804b76:	48 83 ec 28          	sub    $0x28,%rsp
+  804b7a:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804b7e:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804b81:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804b88:	ff ff ff 
+  804b8b:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b94:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804b9b:	00 00 00 
+  804b9e:	48 39 ca             	cmp    %rcx,%rdx
+  804ba1:	0f 85 e5 00 00 00    	jne    804c8c <mmap_writeback+0x123>
+  804ba7:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804baa:	4c 39 ee             	cmp    %r13,%rsi
+  804bad:	0f 83 e8 00 00 00    	jae    804c9b <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804bb3:	49 be bb 45 80 00 00 	movabs $0x8045bb,%r14
+  804bba:	00 00 00 
+  804bbd:	49 bf a2 45 80 00 00 	movabs $0x8045a2,%r15
+  804bc4:	00 00 00 
+  804bc7:	eb 10                	jmp    804bd9 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804bc9:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804bd0:	4d 39 ec             	cmp    %r13,%r12
+  804bd3:	0f 83 ae 00 00 00    	jae    804c87 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804bd9:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804bdd:	4c 89 e7             	mov    %r12,%rdi
+  804be0:	41 ff d6             	call   *%r14
+  804be3:	84 c0                	test   %al,%al
+  804be5:	74 e2                	je     804bc9 <mmap_writeback+0x60>
+  804be7:	4c 89 e7             	mov    %r12,%rdi
+  804bea:	41 ff d7             	call   *%r15
+  804bed:	84 c0                	test   %al,%al
+  804bef:	74 d8                	je     804bc9 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804bf1:	4c 89 e3             	mov    %r12,%rbx
+  804bf4:	4d 39 ec             	cmp    %r13,%r12
+  804bf7:	73 20                	jae    804c19 <mmap_writeback+0xb0>
+  804bf9:	48 89 df             	mov    %rbx,%rdi
+  804bfc:	41 ff d6             	call   *%r14
+  804bff:	84 c0                	test   %al,%al
+  804c01:	74 16                	je     804c19 <mmap_writeback+0xb0>
+  804c03:	48 89 df             	mov    %rbx,%rdi
+  804c06:	41 ff d7             	call   *%r15
+  804c09:	84 c0                	test   %al,%al
+  804c0b:	74 0c                	je     804c19 <mmap_writeback+0xb0>
+  804c0d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804c14:	4c 39 eb             	cmp    %r13,%rbx
+  804c17:	72 e0                	jb     804bf9 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804c19:	48 89 d9             	mov    %rbx,%rcx
+  804c1c:	4c 29 e1             	sub    %r12,%rcx
+  804c1f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c23:	44 89 e6             	mov    %r12d,%esi
+  804c26:	2b 30                	sub    (%rax),%esi
+  804c28:	49 89 c4             	mov    %rax,%r12
+  804c2b:	03 70 1c             	add    0x1c(%rax),%esi
+  804c2e:	8b 78 18             	mov    0x18(%rax),%edi
+  804c31:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804c35:	48 89 ca             	mov    %rcx,%rdx
+  804c38:	48 b8 a2 3d 80 00 00 	movabs $0x803da2,%rax
+  804c3f:	00 00 00 
+  804c42:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804c44:	85 c0                	test   %eax,%eax
+  804c46:	78 44                	js     804c8c <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804c48:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804c4d:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804c50:	41 89 c1             	mov    %eax,%r9d
+  804c53:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804c5a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804c5e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804c62:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c67:	48 89 ce             	mov    %rcx,%rsi
+  804c6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c6f:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  804c76:	00 00 00 
+  804c79:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804c7b:	85 c0                	test   %eax,%eax
+  804c7d:	78 0d                	js     804c8c <mmap_writeback+0x123>
+  804c7f:	49 89 dc             	mov    %rbx,%r12
+  804c82:	e9 49 ff ff ff       	jmp    804bd0 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804c87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c8c:	48 83 c4 28          	add    $0x28,%rsp
+  804c90:	5b                   	pop    %rbx
+  804c91:	41 5c                	pop    %r12
+  804c93:	41 5d                	pop    %r13
+  804c95:	41 5e                	pop    %r14
+  804c97:	41 5f                	pop    %r15
+  804c99:	5d                   	pop    %rbp
+  804c9a:	c3                   	ret
+    return 0;
+  804c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ca0:	eb ea                	jmp    804c8c <mmap_writeback+0x123>
+
+0000000000804ca2 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804ca2:	55                   	push   %rbp
+  804ca3:	48 89 e5             	mov    %rsp,%rbp
+  804ca6:	41 57                	push   %r15
+  804ca8:	41 56                	push   %r14
+  804caa:	41 55                	push   %r13
+  804cac:	41 54                	push   %r12
+  804cae:	53                   	push   %rbx
+  804caf:	48 83 ec 38          	sub    $0x38,%rsp
+  804cb3:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804cb7:	48 85 f6             	test   %rsi,%rsi
+  804cba:	0f 84 0c 02 00 00    	je     804ecc <mmap+0x22a>
+  804cc0:	49 89 ff             	mov    %rdi,%r15
+  804cc3:	49 89 f4             	mov    %rsi,%r12
+  804cc6:	41 89 d5             	mov    %edx,%r13d
+  804cc9:	41 89 ce             	mov    %ecx,%r14d
+  804ccc:	44 89 cb             	mov    %r9d,%ebx
+  804ccf:	45 85 c9             	test   %r9d,%r9d
+  804cd2:	0f 88 f4 01 00 00    	js     804ecc <mmap+0x22a>
+  804cd8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cdf:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804ce6:	0f 85 e7 01 00 00    	jne    804ed3 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804cec:	83 e2 fd             	and    $0xfffffffd,%edx
+  804cef:	83 fa 04             	cmp    $0x4,%edx
+  804cf2:	0f 85 db 01 00 00    	jne    804ed3 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804cf8:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804cfb:	83 fa 01             	cmp    $0x1,%edx
+  804cfe:	0f 87 cf 01 00 00    	ja     804ed3 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804d04:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804d08:	44 89 c7             	mov    %r8d,%edi
+  804d0b:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  804d12:	00 00 00 
+  804d15:	ff d0                	call   *%rax
+  804d17:	89 c2                	mov    %eax,%edx
+  804d19:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d20:	85 d2                	test   %edx,%edx
+  804d22:	0f 88 ab 01 00 00    	js     804ed3 <mmap+0x231>
+  804d28:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d2c:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804d33:	00 00 00 
+  804d36:	8b 09                	mov    (%rcx),%ecx
+  804d38:	39 0a                	cmp    %ecx,(%rdx)
+  804d3a:	0f 85 93 01 00 00    	jne    804ed3 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804d40:	8b 52 08             	mov    0x8(%rdx),%edx
+  804d43:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804d46:	83 fa 01             	cmp    $0x1,%edx
+  804d49:	0f 84 84 01 00 00    	je     804ed3 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d4f:	41 83 fe 01          	cmp    $0x1,%r14d
+  804d53:	74 42                	je     804d97 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804d55:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804d5c:	4c 89 e6             	mov    %r12,%rsi
+  804d5f:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804d66:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804d6a:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804d6e:	4d 85 ff             	test   %r15,%r15
+  804d71:	74 67                	je     804dda <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d73:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804d7a:	75 0f                	jne    804d8b <mmap+0xe9>
+  804d7c:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804d83:	00 00 00 
+  804d86:	49 39 c7             	cmp    %rax,%r15
+  804d89:	77 1b                	ja     804da6 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d8b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d92:	e9 3c 01 00 00       	jmp    804ed3 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d97:	41 f6 c5 02          	test   $0x2,%r13b
+  804d9b:	74 b8                	je     804d55 <mmap+0xb3>
+  804d9d:	85 d2                	test   %edx,%edx
+  804d9f:	75 b4                	jne    804d55 <mmap+0xb3>
+  804da1:	e9 2d 01 00 00       	jmp    804ed3 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804da6:	4c 89 ff             	mov    %r15,%rdi
+  804da9:	48 b8 10 49 80 00 00 	movabs $0x804910,%rax
+  804db0:	00 00 00 
+  804db3:	ff d0                	call   *%rax
+  804db5:	48 89 c2             	mov    %rax,%rdx
+  804db8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804dbf:	49 39 d7             	cmp    %rdx,%r15
+  804dc2:	0f 85 0b 01 00 00    	jne    804ed3 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804dc8:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804dcf:	00 00 00 
+  804dd2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804dd8:	eb 44                	jmp    804e1e <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804dda:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804dde:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804de5:	00 00 00 
+  804de8:	48 b8 10 49 80 00 00 	movabs $0x804910,%rax
+  804def:	00 00 00 
+  804df2:	ff d0                	call   *%rax
+  804df4:	48 89 c7             	mov    %rax,%rdi
+  804df7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804dfb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804e02:	48 85 ff             	test   %rdi,%rdi
+  804e05:	75 c1                	jne    804dc8 <mmap+0x126>
+  804e07:	e9 c7 00 00 00       	jmp    804ed3 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804e0c:	49 83 c4 01          	add    $0x1,%r12
+  804e10:	48 83 c0 20          	add    $0x20,%rax
+  804e14:	49 83 fc 20          	cmp    $0x20,%r12
+  804e18:	0f 84 a5 00 00 00    	je     804ec3 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e1e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804e22:	75 e8                	jne    804e0c <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804e24:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804e28:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  804e2f:	00 00 00 
+  804e32:	ff d0                	call   *%rax
+  804e34:	89 c2                	mov    %eax,%edx
+  804e36:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e3d:	85 d2                	test   %edx,%edx
+  804e3f:	0f 88 8e 00 00 00    	js     804ed3 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804e45:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804e49:	48 b8 2e 30 80 00 00 	movabs $0x80302e,%rax
+  804e50:	00 00 00 
+  804e53:	ff d0                	call   *%rax
+  804e55:	89 c6                	mov    %eax,%esi
+  804e57:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804e5a:	48 b8 7c 32 80 00 00 	movabs $0x80327c,%rax
+  804e61:	00 00 00 
+  804e64:	ff d0                	call   *%rax
+  804e66:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804e69:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e70:	45 85 ff             	test   %r15d,%r15d
+  804e73:	78 5e                	js     804ed3 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e75:	49 c1 e4 05          	shl    $0x5,%r12
+  804e79:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e80:	00 00 00 
+  804e83:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804e86:	48 bf 81 49 80 00 00 	movabs $0x804981,%rdi
+  804e8d:	00 00 00 
+  804e90:	48 b8 ac 53 80 00 00 	movabs $0x8053ac,%rax
+  804e97:	00 00 00 
+  804e9a:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804e9c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804ea0:	49 89 04 24          	mov    %rax,(%r12)
+  804ea4:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804ea8:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804ead:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804eb2:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804eb7:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804ebc:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804ec1:	eb 10                	jmp    804ed3 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804ec3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804eca:	eb 07                	jmp    804ed3 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804ecc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804ed3:	48 83 c4 38          	add    $0x38,%rsp
+  804ed7:	5b                   	pop    %rbx
+  804ed8:	41 5c                	pop    %r12
+  804eda:	41 5d                	pop    %r13
+  804edc:	41 5e                	pop    %r14
+  804ede:	41 5f                	pop    %r15
+  804ee0:	5d                   	pop    %rbp
+  804ee1:	c3                   	ret
+
+0000000000804ee2 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804ee2:	55                   	push   %rbp
+  804ee3:	48 89 e5             	mov    %rsp,%rbp
+  804ee6:	41 57                	push   %r15
+  804ee8:	41 56                	push   %r14
+  804eea:	41 55                	push   %r13
+  804eec:	41 54                	push   %r12
+  804eee:	53                   	push   %rbx
+  804eef:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804ef3:	49 89 fe             	mov    %rdi,%r14
+  804ef6:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804efd:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f04:	00 
+  804f05:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f0c:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804f13:	00 00 00 
+  804f16:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804f1d:	49 bf 69 4b 80 00 00 	movabs $0x804b69,%r15
+  804f24:	00 00 00 
+  804f27:	eb 09                	jmp    804f32 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f29:	48 83 c3 20          	add    $0x20,%rbx
+  804f2d:	4c 39 eb             	cmp    %r13,%rbx
+  804f30:	74 33                	je     804f65 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f32:	48 89 df             	mov    %rbx,%rdi
+  804f35:	48 8b 33             	mov    (%rbx),%rsi
+  804f38:	4c 39 e6             	cmp    %r12,%rsi
+  804f3b:	73 ec                	jae    804f29 <msync+0x47>
+  804f3d:	48 85 f6             	test   %rsi,%rsi
+  804f40:	74 e7                	je     804f29 <msync+0x47>
+  804f42:	48 89 f2             	mov    %rsi,%rdx
+  804f45:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804f49:	49 39 d6             	cmp    %rdx,%r14
+  804f4c:	73 db                	jae    804f29 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804f4e:	4c 39 e2             	cmp    %r12,%rdx
+  804f51:	49 0f 47 d4          	cmova  %r12,%rdx
+  804f55:	4c 39 f6             	cmp    %r14,%rsi
+  804f58:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804f5c:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804f5f:	85 c0                	test   %eax,%eax
+  804f61:	79 c6                	jns    804f29 <msync+0x47>
+  804f63:	eb 05                	jmp    804f6a <msync+0x88>
+    }
+
+    return 0;
+  804f65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f6a:	48 83 c4 08          	add    $0x8,%rsp
+  804f6e:	5b                   	pop    %rbx
+  804f6f:	41 5c                	pop    %r12
+  804f71:	41 5d                	pop    %r13
+  804f73:	41 5e                	pop    %r14
+  804f75:	41 5f                	pop    %r15
+  804f77:	5d                   	pop    %rbp
+  804f78:	c3                   	ret
+
+0000000000804f79 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804f79:	55                   	push   %rbp
+  804f7a:	48 89 e5             	mov    %rsp,%rbp
+  804f7d:	41 57                	push   %r15
+  804f7f:	41 56                	push   %r14
+  804f81:	41 55                	push   %r13
+  804f83:	41 54                	push   %r12
+  804f85:	53                   	push   %rbx
+  804f86:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804f8a:	49 89 ff             	mov    %rdi,%r15
+  804f8d:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f94:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f9b:	00 
+  804f9c:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fa3:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804faa:	00 00 00 
+  804fad:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804fb4:	48 89 d8             	mov    %rbx,%rax
+  804fb7:	eb 09                	jmp    804fc2 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fb9:	48 83 c0 20          	add    $0x20,%rax
+  804fbd:	4c 39 f0             	cmp    %r14,%rax
+  804fc0:	74 40                	je     805002 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804fc2:	48 8b 10             	mov    (%rax),%rdx
+  804fc5:	4c 39 e2             	cmp    %r12,%rdx
+  804fc8:	73 ef                	jae    804fb9 <munmap+0x40>
+  804fca:	48 85 d2             	test   %rdx,%rdx
+  804fcd:	74 ea                	je     804fb9 <munmap+0x40>
+  804fcf:	48 89 d7             	mov    %rdx,%rdi
+  804fd2:	48 03 78 08          	add    0x8(%rax),%rdi
+  804fd6:	49 39 ff             	cmp    %rdi,%r15
+  804fd9:	73 de                	jae    804fb9 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804fdb:	49 39 fc             	cmp    %rdi,%r12
+  804fde:	72 05                	jb     804fe5 <munmap+0x6c>
+  804fe0:	4c 39 fa             	cmp    %r15,%rdx
+  804fe3:	73 d4                	jae    804fb9 <munmap+0x40>
+  804fe5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804fea:	48 83 c4 08          	add    $0x8,%rsp
+  804fee:	5b                   	pop    %rbx
+  804fef:	41 5c                	pop    %r12
+  804ff1:	41 5d                	pop    %r13
+  804ff3:	41 5e                	pop    %r14
+  804ff5:	41 5f                	pop    %r15
+  804ff7:	5d                   	pop    %rbp
+  804ff8:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ff9:	48 83 c3 20          	add    $0x20,%rbx
+  804ffd:	4c 39 f3             	cmp    %r14,%rbx
+  805000:	74 5c                	je     80505e <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805002:	48 8b 33             	mov    (%rbx),%rsi
+  805005:	4c 39 e6             	cmp    %r12,%rsi
+  805008:	73 ef                	jae    804ff9 <munmap+0x80>
+  80500a:	48 85 f6             	test   %rsi,%rsi
+  80500d:	74 ea                	je     804ff9 <munmap+0x80>
+  80500f:	48 89 f2             	mov    %rsi,%rdx
+  805012:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805016:	49 39 d7             	cmp    %rdx,%r15
+  805019:	73 de                	jae    804ff9 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  80501b:	48 89 df             	mov    %rbx,%rdi
+  80501e:	48 b8 69 4b 80 00 00 	movabs $0x804b69,%rax
+  805025:	00 00 00 
+  805028:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80502a:	85 c0                	test   %eax,%eax
+  80502c:	78 bc                	js     804fea <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  80502e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805032:	48 8b 33             	mov    (%rbx),%rsi
+  805035:	bf 00 00 00 00       	mov    $0x0,%edi
+  80503a:	48 b8 a8 2a 80 00 00 	movabs $0x802aa8,%rax
+  805041:	00 00 00 
+  805044:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805046:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805049:	48 b8 21 32 80 00 00 	movabs $0x803221,%rax
+  805050:	00 00 00 
+  805053:	ff d0                	call   *%rax
+        reg->start = 0;
+  805055:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80505c:	eb 9b                	jmp    804ff9 <munmap+0x80>
+    return 0;
+  80505e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805063:	eb 85                	jmp    804fea <munmap+0x71>
+
+0000000000805065 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80506a:	c3                   	ret
+
+000000000080506b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80506b:	55                   	push   %rbp
+  80506c:	48 89 e5             	mov    %rsp,%rbp
+  80506f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805072:	48 be 65 65 80 00 00 	movabs $0x806565,%rsi
+  805079:	00 00 00 
+  80507c:	48 b8 6b 22 80 00 00 	movabs $0x80226b,%rax
+  805083:	00 00 00 
+  805086:	ff d0                	call   *%rax
+    return 0;
+}
+  805088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80508d:	5d                   	pop    %rbp
+  80508e:	c3                   	ret
+
+000000000080508f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80508f:	55                   	push   %rbp
+  805090:	48 89 e5             	mov    %rsp,%rbp
+  805093:	41 57                	push   %r15
+  805095:	41 56                	push   %r14
+  805097:	41 55                	push   %r13
+  805099:	41 54                	push   %r12
+  80509b:	53                   	push   %rbx
+  80509c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8050a3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8050aa:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8050b1:	00 00 00 00 
+  8050b5:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8050bc:	00 00 00 00 
+  8050c0:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8050c7:	00 00 00 00 
+  8050cb:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8050d2:	00 00 00 00 
+  8050d6:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8050dd:	00 00 00 00 
+  8050e1:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8050e8:	00 00 00 00 
+  8050ec:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8050f3:	00 
+  8050f4:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8050fb:	00 
+  8050fc:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805103:	00 
+  805104:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  80510b:	00 
+  80510c:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805113:	00 
+  805114:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  80511b:	00 
+  80511c:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805123:	00 
+  805124:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80512b:	00 
+  80512c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805133:	00 
+  805134:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80513b:	00 
+    for (res = 0; res < n; res += inc) {
+  80513c:	48 85 d2             	test   %rdx,%rdx
+  80513f:	74 7a                	je     8051bb <devcons_write+0x12c>
+  805141:	49 89 d6             	mov    %rdx,%r14
+  805144:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80514a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80514f:	49 bf bb 25 80 00 00 	movabs $0x8025bb,%r15
+  805156:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805159:	4c 89 f3             	mov    %r14,%rbx
+  80515c:	48 29 f3             	sub    %rsi,%rbx
+  80515f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805164:	48 39 c3             	cmp    %rax,%rbx
+  805167:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80516b:	4c 63 eb             	movslq %ebx,%r13
+  80516e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805175:	48 01 c6             	add    %rax,%rsi
+  805178:	4c 89 ea             	mov    %r13,%rdx
+  80517b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805182:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805185:	4c 89 ee             	mov    %r13,%rsi
+  805188:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80518f:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  805196:	00 00 00 
+  805199:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80519b:	41 01 dc             	add    %ebx,%r12d
+  80519e:	49 63 f4             	movslq %r12d,%rsi
+  8051a1:	4c 39 f6             	cmp    %r14,%rsi
+  8051a4:	72 b3                	jb     805159 <devcons_write+0xca>
+    return res;
+  8051a6:	49 63 c4             	movslq %r12d,%rax
+}
+  8051a9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8051b0:	5b                   	pop    %rbx
+  8051b1:	41 5c                	pop    %r12
+  8051b3:	41 5d                	pop    %r13
+  8051b5:	41 5e                	pop    %r14
+  8051b7:	41 5f                	pop    %r15
+  8051b9:	5d                   	pop    %rbp
+  8051ba:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8051bb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8051c1:	eb e3                	jmp    8051a6 <devcons_write+0x117>
+
+00000000008051c3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8051c3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8051c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051cb:	48 85 c0             	test   %rax,%rax
+  8051ce:	74 55                	je     805225 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8051d0:	55                   	push   %rbp
+  8051d1:	48 89 e5             	mov    %rsp,%rbp
+  8051d4:	41 55                	push   %r13
+  8051d6:	41 54                	push   %r12
+  8051d8:	53                   	push   %rbx
+  8051d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8051dd:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8051e0:	48 bb 1b 28 80 00 00 	movabs $0x80281b,%rbx
+  8051e7:	00 00 00 
+  8051ea:	49 bc 2f 29 80 00 00 	movabs $0x80292f,%r12
+  8051f1:	00 00 00 
+  8051f4:	eb 03                	jmp    8051f9 <devcons_read+0x36>
+  8051f6:	41 ff d4             	call   *%r12
+  8051f9:	ff d3                	call   *%rbx
+  8051fb:	85 c0                	test   %eax,%eax
+  8051fd:	74 f7                	je     8051f6 <devcons_read+0x33>
+    if (c < 0) return c;
+  8051ff:	48 63 d0             	movslq %eax,%rdx
+  805202:	78 13                	js     805217 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805204:	ba 00 00 00 00       	mov    $0x0,%edx
+  805209:	83 f8 04             	cmp    $0x4,%eax
+  80520c:	74 09                	je     805217 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80520e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805212:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805217:	48 89 d0             	mov    %rdx,%rax
+  80521a:	48 83 c4 08          	add    $0x8,%rsp
+  80521e:	5b                   	pop    %rbx
+  80521f:	41 5c                	pop    %r12
+  805221:	41 5d                	pop    %r13
+  805223:	5d                   	pop    %rbp
+  805224:	c3                   	ret
+  805225:	48 89 d0             	mov    %rdx,%rax
+  805228:	c3                   	ret
+
+0000000000805229 <cputchar>:
+cputchar(int ch) {
+  805229:	55                   	push   %rbp
+  80522a:	48 89 e5             	mov    %rsp,%rbp
+  80522d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805231:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805235:	be 01 00 00 00       	mov    $0x1,%esi
+  80523a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80523e:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  805245:	00 00 00 
+  805248:	ff d0                	call   *%rax
+}
+  80524a:	c9                   	leave
+  80524b:	c3                   	ret
+
+000000000080524c <getchar>:
+getchar(void) {
+  80524c:	55                   	push   %rbp
+  80524d:	48 89 e5             	mov    %rsp,%rbp
+  805250:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805254:	ba 01 00 00 00       	mov    $0x1,%edx
+  805259:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80525d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805262:	48 b8 9f 33 80 00 00 	movabs $0x80339f,%rax
+  805269:	00 00 00 
+  80526c:	ff d0                	call   *%rax
+  80526e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805270:	85 c0                	test   %eax,%eax
+  805272:	78 06                	js     80527a <getchar+0x2e>
+  805274:	74 08                	je     80527e <getchar+0x32>
+  805276:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80527a:	89 d0                	mov    %edx,%eax
+  80527c:	c9                   	leave
+  80527d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80527e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805283:	eb f5                	jmp    80527a <getchar+0x2e>
+
+0000000000805285 <iscons>:
+iscons(int fdnum) {
+  805285:	55                   	push   %rbp
+  805286:	48 89 e5             	mov    %rsp,%rbp
+  805289:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80528d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805291:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  805298:	00 00 00 
+  80529b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80529d:	85 c0                	test   %eax,%eax
+  80529f:	78 18                	js     8052b9 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8052a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052a5:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8052ac:	00 00 00 
+  8052af:	8b 00                	mov    (%rax),%eax
+  8052b1:	39 02                	cmp    %eax,(%rdx)
+  8052b3:	0f 94 c0             	sete   %al
+  8052b6:	0f b6 c0             	movzbl %al,%eax
+}
+  8052b9:	c9                   	leave
+  8052ba:	c3                   	ret
+
+00000000008052bb <opencons>:
+opencons(void) {
+  8052bb:	55                   	push   %rbp
+  8052bc:	48 89 e5             	mov    %rsp,%rbp
+  8052bf:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8052c3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8052c7:	48 b8 5c 30 80 00 00 	movabs $0x80305c,%rax
+  8052ce:	00 00 00 
+  8052d1:	ff d0                	call   *%rax
+  8052d3:	85 c0                	test   %eax,%eax
+  8052d5:	78 49                	js     805320 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8052d7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8052dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052e1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8052e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ea:	48 b8 d0 29 80 00 00 	movabs $0x8029d0,%rax
+  8052f1:	00 00 00 
+  8052f4:	ff d0                	call   *%rax
+  8052f6:	85 c0                	test   %eax,%eax
+  8052f8:	78 26                	js     805320 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8052fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052fe:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805305:	00 00 
+  805307:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805309:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80530d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805314:	48 b8 2e 30 80 00 00 	movabs $0x80302e,%rax
+  80531b:	00 00 00 
+  80531e:	ff d0                	call   *%rax
+}
+  805320:	c9                   	leave
+  805321:	c3                   	ret
+
+0000000000805322 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805322:	55                   	push   %rbp
+  805323:	48 89 e5             	mov    %rsp,%rbp
+  805326:	41 56                	push   %r14
+  805328:	41 55                	push   %r13
+  80532a:	41 54                	push   %r12
+  80532c:	53                   	push   %rbx
+  80532d:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805330:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805337:	00 00 00 
+  80533a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80533e:	74 27                	je     805367 <_handle_vectored_pagefault+0x45>
+  805340:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805345:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80534c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80534f:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805352:	4c 89 e7             	mov    %r12,%rdi
+  805355:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80535a:	84 c0                	test   %al,%al
+  80535c:	75 45                	jne    8053a3 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80535e:	48 83 c3 01          	add    $0x1,%rbx
+  805362:	49 3b 1e             	cmp    (%r14),%rbx
+  805365:	72 eb                	jb     805352 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805367:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80536e:	00 
+  80536f:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805374:	4d 8b 04 24          	mov    (%r12),%r8
+  805378:	48 ba 78 65 80 00 00 	movabs $0x806578,%rdx
+  80537f:	00 00 00 
+  805382:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805387:	48 bf a8 65 80 00 00 	movabs $0x8065a8,%rdi
+  80538e:	00 00 00 
+  805391:	b8 00 00 00 00       	mov    $0x0,%eax
+  805396:	49 ba e4 17 80 00 00 	movabs $0x8017e4,%r10
+  80539d:	00 00 00 
+  8053a0:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8053a3:	5b                   	pop    %rbx
+  8053a4:	41 5c                	pop    %r12
+  8053a6:	41 5d                	pop    %r13
+  8053a8:	41 5e                	pop    %r14
+  8053aa:	5d                   	pop    %rbp
+  8053ab:	c3                   	ret
+
+00000000008053ac <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8053ac:	55                   	push   %rbp
+  8053ad:	48 89 e5             	mov    %rsp,%rbp
+  8053b0:	53                   	push   %rbx
+  8053b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8053b5:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8053b8:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8053bd:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8053c4:	00 00 00 
+  8053c7:	80 38 00             	cmpb   $0x0,(%rax)
+  8053ca:	74 68                	je     805434 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053cc:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053d3:	00 00 00 
+  8053d6:	48 8b 08             	mov    (%rax),%rcx
+  8053d9:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8053de:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8053e5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053e8:	48 85 c9             	test   %rcx,%rcx
+  8053eb:	0f 84 e0 00 00 00    	je     8054d1 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8053f1:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8053f5:	0f 84 c9 00 00 00    	je     8054c4 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053fb:	48 83 c2 01          	add    $0x1,%rdx
+  8053ff:	48 39 ca             	cmp    %rcx,%rdx
+  805402:	75 ed                	jne    8053f1 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805404:	48 83 f9 08          	cmp    $0x8,%rcx
+  805408:	0f 84 84 00 00 00    	je     805492 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80540e:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805412:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805419:	00 00 00 
+  80541c:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805423:	00 00 00 
+  805426:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80542a:	85 f6                	test   %esi,%esi
+  80542c:	0f 89 97 00 00 00    	jns    8054c9 <add_pgfault_handler+0x11d>
+  805432:	eb 63                	jmp    805497 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805434:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805439:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80543e:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805445:	00 00 00 
+  805448:	bf 00 00 00 00       	mov    $0x0,%edi
+  80544d:	48 b8 d0 29 80 00 00 	movabs $0x8029d0,%rax
+  805454:	00 00 00 
+  805457:	ff d0                	call   *%rax
+  805459:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80545b:	85 c0                	test   %eax,%eax
+  80545d:	78 38                	js     805497 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80545f:	48 be ad 55 80 00 00 	movabs $0x8055ad,%rsi
+  805466:	00 00 00 
+  805469:	bf 00 00 00 00       	mov    $0x0,%edi
+  80546e:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  805475:	00 00 00 
+  805478:	ff d0                	call   *%rax
+  80547a:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80547c:	85 c0                	test   %eax,%eax
+  80547e:	78 17                	js     805497 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805480:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805487:	00 00 00 
+  80548a:	c6 00 01             	movb   $0x1,(%rax)
+  80548d:	e9 3a ff ff ff       	jmp    8053cc <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805492:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805497:	89 f1                	mov    %esi,%ecx
+  805499:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  8054a0:	00 00 00 
+  8054a3:	be 42 00 00 00       	mov    $0x42,%esi
+  8054a8:	48 bf a8 65 80 00 00 	movabs $0x8065a8,%rdi
+  8054af:	00 00 00 
+  8054b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054b7:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  8054be:	00 00 00 
+  8054c1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8054c4:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8054c9:	89 f0                	mov    %esi,%eax
+  8054cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8054cf:	c9                   	leave
+  8054d0:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8054d1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8054d8:	00 00 00 
+  8054db:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8054e2:	48 89 d8             	mov    %rbx,%rax
+  8054e5:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8054ec:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8054ef:	eb d8                	jmp    8054c9 <add_pgfault_handler+0x11d>
+
+00000000008054f1 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8054f1:	55                   	push   %rbp
+  8054f2:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8054f5:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8054fc:	00 00 00 
+  8054ff:	80 38 00             	cmpb   $0x0,(%rax)
+  805502:	74 33                	je     805537 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805504:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80550b:	00 00 00 
+  80550e:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805513:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80551a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80551d:	48 85 c0             	test   %rax,%rax
+  805520:	0f 84 85 00 00 00    	je     8055ab <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805526:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80552a:	74 40                	je     80556c <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80552c:	48 83 c1 01          	add    $0x1,%rcx
+  805530:	48 39 c1             	cmp    %rax,%rcx
+  805533:	75 f1                	jne    805526 <remove_pgfault_handler+0x35>
+  805535:	eb 74                	jmp    8055ab <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805537:	48 b9 ce 65 80 00 00 	movabs $0x8065ce,%rcx
+  80553e:	00 00 00 
+  805541:	48 ba b6 64 80 00 00 	movabs $0x8064b6,%rdx
+  805548:	00 00 00 
+  80554b:	be 48 00 00 00       	mov    $0x48,%esi
+  805550:	48 bf a8 65 80 00 00 	movabs $0x8065a8,%rdi
+  805557:	00 00 00 
+  80555a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80555f:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  805566:	00 00 00 
+  805569:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80556c:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805573:	00 
+  805574:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805578:	48 29 ca             	sub    %rcx,%rdx
+  80557b:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805582:	00 00 00 
+  805585:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805589:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80558e:	48 89 ce             	mov    %rcx,%rsi
+  805591:	48 b8 bb 25 80 00 00 	movabs $0x8025bb,%rax
+  805598:	00 00 00 
+  80559b:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80559d:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8055a4:	00 00 00 
+  8055a7:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8055ab:	5d                   	pop    %rbp
+  8055ac:	c3                   	ret
+
+00000000008055ad <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8055ad:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8055b0:	48 b8 22 53 80 00 00 	movabs $0x805322,%rax
+  8055b7:	00 00 00 
+    call *%rax
+  8055ba:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8055bc:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8055c3:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8055c4:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8055cb:	00 
+    subq $8, %rcx
+  8055cc:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8055d0:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8055d3:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8055da:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8055db:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8055df:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8055e3:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8055e8:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8055ed:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8055f2:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8055f7:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8055fc:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805601:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805606:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80560b:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805610:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805615:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80561a:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80561f:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805624:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805629:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80562d:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805631:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805632:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805633:	c3                   	ret
+
+0000000000805634 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805634:	85 ff                	test   %edi,%edi
+  805636:	78 58                	js     805690 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805638:	48 85 f6             	test   %rsi,%rsi
+  80563b:	74 12                	je     80564f <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80563d:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805644:	00 00 00 
+  805647:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80564d:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80564f:	48 85 c9             	test   %rcx,%rcx
+  805652:	74 12                	je     805666 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805654:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80565b:	00 00 00 
+  80565e:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805664:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805666:	48 85 d2             	test   %rdx,%rdx
+  805669:	74 14                	je     80567f <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80566b:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805672:	00 00 00 
+  805675:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80567c:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80567f:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805686:	00 00 00 
+  805689:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80568f:	c3                   	ret
+        if (from_env_store) {
+  805690:	48 85 f6             	test   %rsi,%rsi
+  805693:	74 06                	je     80569b <ipc_result+0x67>
+            *from_env_store = 0;
+  805695:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80569b:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80569d:	48 85 c9             	test   %rcx,%rcx
+  8056a0:	74 ed                	je     80568f <ipc_result+0x5b>
+            *perm_store = 0;
+  8056a2:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8056a8:	c3                   	ret
+
+00000000008056a9 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8056a9:	55                   	push   %rbp
+  8056aa:	48 89 e5             	mov    %rsp,%rbp
+  8056ad:	41 55                	push   %r13
+  8056af:	41 54                	push   %r12
+  8056b1:	53                   	push   %rbx
+  8056b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8056b6:	49 89 fc             	mov    %rdi,%r12
+  8056b9:	48 89 f7             	mov    %rsi,%rdi
+  8056bc:	48 89 d3             	mov    %rdx,%rbx
+  8056bf:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8056c2:	48 85 f6             	test   %rsi,%rsi
+  8056c5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056cc:	00 00 00 
+  8056cf:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8056d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8056d8:	48 85 d2             	test   %rdx,%rdx
+  8056db:	74 03                	je     8056e0 <ipc_recv+0x37>
+  8056dd:	48 8b 32             	mov    (%rdx),%rsi
+  8056e0:	48 b8 1c 2f 80 00 00 	movabs $0x802f1c,%rax
+  8056e7:	00 00 00 
+  8056ea:	ff d0                	call   *%rax
+  8056ec:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8056ee:	4c 89 e9             	mov    %r13,%rcx
+  8056f1:	48 89 da             	mov    %rbx,%rdx
+  8056f4:	4c 89 e6             	mov    %r12,%rsi
+  8056f7:	48 b8 34 56 80 00 00 	movabs $0x805634,%rax
+  8056fe:	00 00 00 
+  805701:	ff d0                	call   *%rax
+}
+  805703:	48 83 c4 08          	add    $0x8,%rsp
+  805707:	5b                   	pop    %rbx
+  805708:	41 5c                	pop    %r12
+  80570a:	41 5d                	pop    %r13
+  80570c:	5d                   	pop    %rbp
+  80570d:	c3                   	ret
+
+000000000080570e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80570e:	55                   	push   %rbp
+  80570f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805712:	48 85 d2             	test   %rdx,%rdx
+  805715:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80571c:	00 00 00 
+  80571f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805723:	89 f6                	mov    %esi,%esi
+  805725:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  80572c:	00 00 00 
+  80572f:	ff d0                	call   *%rax
+    if (res < 0) {
+  805731:	85 c0                	test   %eax,%eax
+  805733:	78 02                	js     805737 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805735:	5d                   	pop    %rbp
+  805736:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805737:	89 c1                	mov    %eax,%ecx
+  805739:	48 ba e8 65 80 00 00 	movabs $0x8065e8,%rdx
+  805740:	00 00 00 
+  805743:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805748:	48 bf f5 65 80 00 00 	movabs $0x8065f5,%rdi
+  80574f:	00 00 00 
+  805752:	b8 00 00 00 00       	mov    $0x0,%eax
+  805757:	49 b8 e4 17 80 00 00 	movabs $0x8017e4,%r8
+  80575e:	00 00 00 
+  805761:	41 ff d0             	call   *%r8
+
+0000000000805764 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805764:	55                   	push   %rbp
+  805765:	48 89 e5             	mov    %rsp,%rbp
+  805768:	53                   	push   %rbx
+  805769:	48 83 ec 08          	sub    $0x8,%rsp
+  80576d:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805771:	48 85 d2             	test   %rdx,%rdx
+  805774:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80577b:	00 00 00 
+  80577e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805782:	4d 85 c9             	test   %r9,%r9
+  805785:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80578e:	48 85 db             	test   %rbx,%rbx
+  805791:	74 03                	je     805796 <ipc_call+0x32>
+  805793:	48 8b 03             	mov    (%rbx),%rax
+  805796:	89 f6                	mov    %esi,%esi
+  805798:	48 83 ec 08          	sub    $0x8,%rsp
+  80579c:	50                   	push   %rax
+  80579d:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  8057a4:	00 00 00 
+  8057a7:	ff d0                	call   *%rax
+  8057a9:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8057ab:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8057af:	48 89 da             	mov    %rbx,%rdx
+  8057b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8057b7:	48 b8 34 56 80 00 00 	movabs $0x805634,%rax
+  8057be:	00 00 00 
+  8057c1:	ff d0                	call   *%rax
+}
+  8057c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8057c7:	c9                   	leave
+  8057c8:	c3                   	ret
+
+00000000008057c9 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8057c9:	55                   	push   %rbp
+  8057ca:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8057cd:	89 f6                	mov    %esi,%esi
+  8057cf:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  8057d6:	00 00 00 
+  8057d9:	ff d0                	call   *%rax
+  8057db:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8057dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8057e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8057ec:	48 b8 34 56 80 00 00 	movabs $0x805634,%rax
+  8057f3:	00 00 00 
+  8057f6:	ff d0                	call   *%rax
+}
+  8057f8:	5d                   	pop    %rbp
+  8057f9:	c3                   	ret
+
+00000000008057fa <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8057fa:	55                   	push   %rbp
+  8057fb:	48 89 e5             	mov    %rsp,%rbp
+  8057fe:	41 54                	push   %r12
+  805800:	53                   	push   %rbx
+  805801:	4c 89 cb             	mov    %r9,%rbx
+  805804:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805808:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80580c:	48 85 d2             	test   %rdx,%rdx
+  80580f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805816:	00 00 00 
+  805819:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80581d:	4d 85 c9             	test   %r9,%r9
+  805820:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805824:	b8 00 00 00 00       	mov    $0x0,%eax
+  805829:	4d 85 e4             	test   %r12,%r12
+  80582c:	74 04                	je     805832 <ipc_reply_wait+0x38>
+  80582e:	49 8b 04 24          	mov    (%r12),%rax
+  805832:	89 f6                	mov    %esi,%esi
+  805834:	48 83 ec 08          	sub    $0x8,%rsp
+  805838:	50                   	push   %rax
+  805839:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  805840:	00 00 00 
+  805843:	ff d0                	call   *%rax
+  805845:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805847:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80584b:	4c 89 e2             	mov    %r12,%rdx
+  80584e:	48 89 de             	mov    %rbx,%rsi
+  805851:	48 b8 34 56 80 00 00 	movabs $0x805634,%rax
+  805858:	00 00 00 
+  80585b:	ff d0                	call   *%rax
+}
+  80585d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805861:	5b                   	pop    %rbx
+  805862:	41 5c                	pop    %r12
+  805864:	5d                   	pop    %rbp
+  805865:	c3                   	ret
+
+0000000000805866 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805866:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80586b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805872:	00 00 00 
+  805875:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80587c:	48 01 ca             	add    %rcx,%rdx
+  80587f:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805885:	39 fa                	cmp    %edi,%edx
+  805887:	74 12                	je     80589b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805889:	48 83 c0 01          	add    $0x1,%rax
+  80588d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805893:	75 e0                	jne    805875 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805895:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80589a:	c3                   	ret
+            return envs[i].env_id;
+  80589b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8058a2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8058a9:	00 00 00 
+  8058ac:	48 01 d0             	add    %rdx,%rax
+  8058af:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8058b5:	c3                   	ret
+  8058b6:	66 90                	xchg   %ax,%ax
+
+00000000008058b8 <__rodata_start>:
+  8058b8:	77 00                	ja     8058ba <__rodata_start+0x2>
+  8058ba:	72 62                	jb     80591e <__rodata_start+0x66>
+  8058bc:	00 77 62             	add    %dh,0x62(%rdi)
+  8058bf:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  8058c5:	00 00                	add    %al,(%rax)
+  8058c7:	00 ed                	add    %ch,%ch
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8058ed:	00 00                	add    %al,(%rax)
+  8058ef:	00 ed                	add    %ch,%ch
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	8c 0a                	mov    %cs,(%rdx)
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805926:	00 00                	add    %al,(%rax)
+  805928:	8c 0a                	mov    %cs,(%rdx)
+  80592a:	80 00 00             	addb   $0x0,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805936:	00 00                	add    %al,(%rax)
+  805938:	8c 0a                	mov    %cs,(%rdx)
+  80593a:	80 00 00             	addb   $0x0,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805946:	00 00                	add    %al,(%rax)
+  805948:	8c 0a                	mov    %cs,(%rdx)
+  80594a:	80 00 00             	addb   $0x0,(%rax)
+  80594d:	00 00                	add    %al,(%rax)
+  80594f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805956:	00 00                	add    %al,(%rax)
+  805958:	8c 0a                	mov    %cs,(%rdx)
+  80595a:	80 00 00             	addb   $0x0,(%rax)
+  80595d:	00 00                	add    %al,(%rax)
+  80595f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	ed                   	in     (%dx),%eax
+  8059d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059de:	00 00                	add    %al,(%rax)
+  8059e0:	ed                   	in     (%dx),%eax
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	ed                   	in     (%dx),%eax
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	ed                   	in     (%dx),%eax
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ed                   	in     (%dx),%eax
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	ed                   	in     (%dx),%eax
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	f4                   	hlt
+  805a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a5f:	00 ed                	add    %ch,%ch
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	2c 0b                	sub    $0xb,%al
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 ed                	add    %ch,%ch
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805ab3:	00 00                	add    %al,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 cb                	add    %cl,%bl
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	6a 0a                	push   $0xa
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 ed                	add    %ch,%ch
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	3c 0a                	cmp    $0xa,%al
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 ed                	add    %ch,%ch
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805b0b:	00 00                	add    %al,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 29                	add    %ch,(%rcx)
+  805b19:	0c 80                	or     $0x80,%al
+  805b1b:	00 00                	add    %al,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 ed                	add    %ch,%ch
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	1a 0b                	sbb    (%rbx),%cl
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 ed                	add    %ch,%ch
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ce                   	(bad)
+  805b41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b47:	00 ed                	add    %ch,%ch
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	f4                   	hlt
+  805b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b5f:	00 37                	add    %dh,(%rdi)
+  805b61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 37                	add    %dh,(%rdi)
+  805b71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805b8b:	00 00                	add    %al,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 d2                	add    %dl,%dl
+  805b91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b97:	00 d2                	add    %dl,%dl
+  805b99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805b9f:	00 d2                	add    %dl,%dl
+  805ba1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ba7:	00 d2                	add    %dl,%dl
+  805ba9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805baf:	00 d2                	add    %dl,%dl
+  805bb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805bb7:	00 d2                	add    %dl,%dl
+  805bb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805bbf:	00 d2                	add    %dl,%dl
+  805bc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805bc7:	00 f6                	add    %dh,%dh
+  805bc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805bcf:	00 f6                	add    %dh,%dh
+  805bd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 22                	add    %ah,(%rdx)
+  805c11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c17:	00 22                	add    %ah,(%rdx)
+  805c19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c1f:	00 22                	add    %ah,(%rdx)
+  805c21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c27:	00 22                	add    %ah,(%rdx)
+  805c29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c2f:	00 22                	add    %ah,(%rdx)
+  805c31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c37:	00 22                	add    %ah,(%rdx)
+  805c39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 46 12             	add    %al,0x12(%rsi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cd2:	80 00 00             	addb   $0x0,(%rax)
+  805cd5:	00 00                	add    %al,(%rax)
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 22                	add    %ah,(%rdx)
+  805d11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d17:	00 22                	add    %ah,(%rdx)
+  805d19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d1f:	00 22                	add    %ah,(%rdx)
+  805d21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d27:	00 22                	add    %ah,(%rdx)
+  805d29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d2f:	00 22                	add    %ah,(%rdx)
+  805d31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d37:	00 22                	add    %ah,(%rdx)
+  805d39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 46 12             	add    %al,0x12(%rsi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805de0 <basefix.0>:
+  805de0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805df0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805e00:	10 00 25 35 64 20 00 77 72 69 74 65 20 65 72 72     ..%5d .write err
+  805e10:	6f 72 20 63 6f 70 79 69 6e 67 20 25 73 3a 20 25     or copying %s: %
+  805e20:	69 00 75 73 65 72 2f 6e 75 6d 2e 63 00 65 72 72     i.user/num.c.err
+  805e30:	6f 72 20 72 65 61 64 69 6e 67 20 25 73 3a 20 25     or reading %s: %
+  805e40:	69 00 6e 75 6d 00 3c 73 74 64 69 6e 3e 00 63 61     i.num.<stdin>.ca
+  805e50:	6e 27 74 20 6f 70 65 6e 20 25 73 3a 20 25 69 00     n't open %s: %i.
+  805e60:	3c 75 6e 6b 6e 6f 77 6e 3e 00 66 0f 1f 44 00 00     <unknown>.f..D..
+  805e70:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805e80:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805e90:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  805ea0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  805eb0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  805ec0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  805ed0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  805ee0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  805ef0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  805f00:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  805f10:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  805f20:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  805f30:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  805f40:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  805f50:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  805f60:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  805f70:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  805f80:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  805f90:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  805fa0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  805fb0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  805fc0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  805fd0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  805fe0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  805ff0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806000:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806010:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806020:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  806030:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806040:	2c 1b 80 00 00 00 00 00 83 21 80 00 00 00 00 00     ,........!......
+  806050:	73 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     s!.......!......
+  806060:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806070:	83 21 80 00 00 00 00 00 4b 1b 80 00 00 00 00 00     .!......K.......
+  806080:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806090:	3f 1b 80 00 00 00 00 00 b9 1b 80 00 00 00 00 00     ?...............
+  8060a0:	83 21 80 00 00 00 00 00 3f 1b 80 00 00 00 00 00     .!......?.......
+  8060b0:	85 1b 80 00 00 00 00 00 85 1b 80 00 00 00 00 00     ................
+  8060c0:	85 1b 80 00 00 00 00 00 85 1b 80 00 00 00 00 00     ................
+  8060d0:	85 1b 80 00 00 00 00 00 85 1b 80 00 00 00 00 00     ................
+  8060e0:	85 1b 80 00 00 00 00 00 85 1b 80 00 00 00 00 00     ................
+  8060f0:	85 1b 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .........!......
+  806100:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806110:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806120:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806130:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806140:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806150:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806160:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806170:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806180:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806190:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  8061a0:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  8061b0:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  8061c0:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  8061d0:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  8061e0:	83 21 80 00 00 00 00 00 a1 20 80 00 00 00 00 00     .!....... ......
+  8061f0:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806200:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806210:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806220:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806230:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806240:	e7 1b 80 00 00 00 00 00 b6 1d 80 00 00 00 00 00     ................
+  806250:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  806260:	83 21 80 00 00 00 00 00 dc 1b 80 00 00 00 00 00     .!..............
+  806270:	16 1c 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .........!......
+  806280:	83 21 80 00 00 00 00 00 d1 1b 80 00 00 00 00 00     .!..............
+  806290:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  8062a0:	5f 1f 80 00 00 00 00 00 2e 20 80 00 00 00 00 00     _........ ......
+  8062b0:	83 21 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .!.......!......
+  8062c0:	ad 1c 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .........!......
+  8062d0:	8a 1e 80 00 00 00 00 00 83 21 80 00 00 00 00 00     .........!......
+  8062e0:	83 21 80 00 00 00 00 00 a1 20 80 00 00 00 00 00     .!....... ......
+  8062f0:	83 21 80 00 00 00 00 00 35 1b 80 00 00 00 00 00     .!......5.......
+
+0000000000806300 <error_string>:
+	...
+  806308:	c5 5e 80 00 00 00 00 00 d7 5e 80 00 00 00 00 00     .^.......^......
+  806318:	e7 5e 80 00 00 00 00 00 f9 5e 80 00 00 00 00 00     .^.......^......
+  806328:	07 5f 80 00 00 00 00 00 1b 5f 80 00 00 00 00 00     ._......._......
+  806338:	30 5f 80 00 00 00 00 00 43 5f 80 00 00 00 00 00     0_......C_......
+  806348:	55 5f 80 00 00 00 00 00 69 5f 80 00 00 00 00 00     U_......i_......
+  806358:	79 5f 80 00 00 00 00 00 8c 5f 80 00 00 00 00 00     y_......._......
+  806368:	a3 5f 80 00 00 00 00 00 b9 5f 80 00 00 00 00 00     ._......._......
+  806378:	d1 5f 80 00 00 00 00 00 e9 5f 80 00 00 00 00 00     ._......._......
+  806388:	f6 5f 80 00 00 00 00 00 a0 63 80 00 00 00 00 00     ._.......c......
+  806398:	0a 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .`......file is 
+  8063a8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8063b8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8063c8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8063d8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8063e8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8063f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806408:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806418:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806428:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806438:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806448:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806458:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806468:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806478:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806480 <devtab>:
+  806480:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806490:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8064a0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8064b0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8064c0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8064d0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8064e0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8064f0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806500:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806510:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806520:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806530:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806540:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806550:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806560:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806570:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806580:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806590:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8065a0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8065b0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8065c0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8065d0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8065e0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  8065f0:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,10519 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 59 37 80 00 00 	movabs $0x803759,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 59 37 80 00 00 	movabs $0x803759,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 f4 1f 80 00 00 	movabs $0x801ff4,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 f4 1f 80 00 00 	movabs $0x801ff4,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 59 5f 80 00 00 	movabs $0x805f59,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 68 59 80 00 00 	movabs $0x805968,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 6a 59 80 00 00 	movabs $0x80596a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 6d 59 80 00 00 	movabs $0x80596d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 2d 4f 80 00 00 	movabs $0x804f2d,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 04 52 80 00 00 	movabs $0x805204,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 43 38 80 00 00 	movabs $0x803843,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 0c 39 80 00 00 	movabs $0x80390c,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 12 38 80 00 00 	movabs $0x803812,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 12 38 80 00 00 	movabs $0x803812,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 2a 36 80 00 00 	movabs $0x80362a,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 59 37 80 00 00 	movabs $0x803759,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 31 23 80 00 00 	movabs $0x802331,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 31 23 80 00 00 	movabs $0x802331,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 20 5c 80 00 00 	movabs $0x805c20,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 31 23 80 00 00 	movabs $0x802331,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 31 23 80 00 00 	movabs $0x802331,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 89 25 80 00 00 	movabs $0x802589,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 89 25 80 00 00 	movabs $0x802589,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 13 01 00 00       	call   801612 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+ * Only need to start one of these -- splits into two with fork. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  801512:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  801519:	00 00 00 
+  80151c:	ff d0                	call   *%rax
+  80151e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  801521:	85 c0                	test   %eax,%eax
+  801523:	0f 85 93 00 00 00    	jne    8015bc <umain+0xbb>
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  801529:	49 bf ac 30 80 00 00 	movabs $0x8030ac,%r15
+  801530:	00 00 00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  801533:	49 be 4f 27 80 00 00 	movabs $0x80274f,%r14
+  80153a:	00 00 00 
+  80153d:	49 bd 8b 17 80 00 00 	movabs $0x80178b,%r13
+  801544:	00 00 00 
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  801547:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80154c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801551:	be 00 00 00 00       	mov    $0x0,%esi
+  801556:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80155a:	41 ff d7             	call   *%r15
+  80155d:	89 c3                	mov    %eax,%ebx
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80155f:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+  801563:	41 ff d6             	call   *%r14
+  801566:	89 c6                	mov    %eax,%esi
+  801568:	44 89 e1             	mov    %r12d,%ecx
+  80156b:	89 da                	mov    %ebx,%edx
+  80156d:	48 bf d8 5e 80 00 00 	movabs $0x805ed8,%rdi
+  801574:	00 00 00 
+  801577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157c:	41 ff d5             	call   *%r13
+        if (i == 10) return;
+  80157f:	83 fb 0a             	cmp    $0xa,%ebx
+  801582:	74 29                	je     8015ad <umain+0xac>
+        i++;
+  801584:	83 c3 01             	add    $0x1,%ebx
+        ipc_send(who, i, 0, 0, 0);
+  801587:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80158d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801592:	ba 00 00 00 00       	mov    $0x0,%edx
+  801597:	89 de                	mov    %ebx,%esi
+  801599:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80159c:	48 b8 11 31 80 00 00 	movabs $0x803111,%rax
+  8015a3:	00 00 00 
+  8015a6:	ff d0                	call   *%rax
+        if (i == 10) return;
+  8015a8:	83 fb 0a             	cmp    $0xa,%ebx
+  8015ab:	75 9a                	jne    801547 <umain+0x46>
+    }
+}
+  8015ad:	48 83 c4 18          	add    $0x18,%rsp
+  8015b1:	5b                   	pop    %rbx
+  8015b2:	41 5c                	pop    %r12
+  8015b4:	41 5d                	pop    %r13
+  8015b6:	41 5e                	pop    %r14
+  8015b8:	41 5f                	pop    %r15
+  8015ba:	5d                   	pop    %rbp
+  8015bb:	c3                   	ret
+  8015bc:	89 c3                	mov    %eax,%ebx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8015be:	48 b8 4f 27 80 00 00 	movabs $0x80274f,%rax
+  8015c5:	00 00 00 
+  8015c8:	ff d0                	call   *%rax
+  8015ca:	89 c6                	mov    %eax,%esi
+  8015cc:	89 da                	mov    %ebx,%edx
+  8015ce:	48 bf c2 5e 80 00 00 	movabs $0x805ec2,%rdi
+  8015d5:	00 00 00 
+  8015d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dd:	48 b9 8b 17 80 00 00 	movabs $0x80178b,%rcx
+  8015e4:	00 00 00 
+  8015e7:	ff d1                	call   *%rcx
+        ipc_send(who, 0, 0, 0, 0);
+  8015e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fe:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801601:	48 b8 11 31 80 00 00 	movabs $0x803111,%rax
+  801608:	00 00 00 
+  80160b:	ff d0                	call   *%rax
+  80160d:	e9 17 ff ff ff       	jmp    801529 <umain+0x28>
+
+0000000000801612 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801612:	55                   	push   %rbp
+  801613:	48 89 e5             	mov    %rsp,%rbp
+  801616:	41 56                	push   %r14
+  801618:	41 55                	push   %r13
+  80161a:	41 54                	push   %r12
+  80161c:	53                   	push   %rbx
+  80161d:	41 89 fd             	mov    %edi,%r13d
+  801620:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801623:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80162a:	00 00 00 
+  80162d:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801634:	00 00 00 
+  801637:	48 39 c2             	cmp    %rax,%rdx
+  80163a:	73 17                	jae    801653 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80163c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80163f:	49 89 c4             	mov    %rax,%r12
+  801642:	48 83 c3 08          	add    $0x8,%rbx
+  801646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164b:	ff 53 f8             	call   *-0x8(%rbx)
+  80164e:	4c 39 e3             	cmp    %r12,%rbx
+  801651:	72 ef                	jb     801642 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801653:	48 b8 4f 27 80 00 00 	movabs $0x80274f,%rax
+  80165a:	00 00 00 
+  80165d:	ff d0                	call   *%rax
+  80165f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801664:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80166b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801672:	00 00 00 
+  801675:	48 01 d0             	add    %rdx,%rax
+  801678:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80167f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801682:	45 85 ed             	test   %r13d,%r13d
+  801685:	7e 0d                	jle    801694 <libmain+0x82>
+  801687:	49 8b 06             	mov    (%r14),%rax
+  80168a:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801691:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801694:	4c 89 f6             	mov    %r14,%rsi
+  801697:	44 89 ef             	mov    %r13d,%edi
+  80169a:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016a1:	00 00 00 
+  8016a4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8016a6:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  8016ad:	00 00 00 
+  8016b0:	ff d0                	call   *%rax
+#endif
+}
+  8016b2:	5b                   	pop    %rbx
+  8016b3:	41 5c                	pop    %r12
+  8016b5:	41 5d                	pop    %r13
+  8016b7:	41 5e                	pop    %r14
+  8016b9:	5d                   	pop    %rbp
+  8016ba:	c3                   	ret
+
+00000000008016bb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8016bb:	55                   	push   %rbp
+  8016bc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8016bf:	48 b8 df 34 80 00 00 	movabs $0x8034df,%rax
+  8016c6:	00 00 00 
+  8016c9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8016cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d0:	48 b8 de 26 80 00 00 	movabs $0x8026de,%rax
+  8016d7:	00 00 00 
+  8016da:	ff d0                	call   *%rax
+}
+  8016dc:	5d                   	pop    %rbp
+  8016dd:	c3                   	ret
+
+00000000008016de <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8016de:	55                   	push   %rbp
+  8016df:	48 89 e5             	mov    %rsp,%rbp
+  8016e2:	53                   	push   %rbx
+  8016e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8016ea:	8b 06                	mov    (%rsi),%eax
+  8016ec:	8d 50 01             	lea    0x1(%rax),%edx
+  8016ef:	89 16                	mov    %edx,(%rsi)
+  8016f1:	48 98                	cltq
+  8016f3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8016f8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8016fe:	74 0a                	je     80170a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801700:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80170a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80170e:	be ff 00 00 00       	mov    $0xff,%esi
+  801713:	48 b8 3f 26 80 00 00 	movabs $0x80263f,%rax
+  80171a:	00 00 00 
+  80171d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80171f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801725:	eb d9                	jmp    801700 <putch+0x22>
+
+0000000000801727 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801727:	55                   	push   %rbp
+  801728:	48 89 e5             	mov    %rsp,%rbp
+  80172b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801732:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801735:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80173c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801741:	b8 00 00 00 00       	mov    $0x0,%eax
+  801746:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801749:	48 89 f1             	mov    %rsi,%rcx
+  80174c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801753:	48 bf de 16 80 00 00 	movabs $0x8016de,%rdi
+  80175a:	00 00 00 
+  80175d:	48 b8 db 18 80 00 00 	movabs $0x8018db,%rax
+  801764:	00 00 00 
+  801767:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801769:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801770:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801777:	48 b8 3f 26 80 00 00 	movabs $0x80263f,%rax
+  80177e:	00 00 00 
+  801781:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801783:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801789:	c9                   	leave
+  80178a:	c3                   	ret
+
+000000000080178b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80178b:	55                   	push   %rbp
+  80178c:	48 89 e5             	mov    %rsp,%rbp
+  80178f:	48 83 ec 50          	sub    $0x50,%rsp
+  801793:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801797:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80179b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80179f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017a3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8017a7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8017ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017b6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8017be:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8017c2:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+
+00000000008017d0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8017d0:	55                   	push   %rbp
+  8017d1:	48 89 e5             	mov    %rsp,%rbp
+  8017d4:	41 57                	push   %r15
+  8017d6:	41 56                	push   %r14
+  8017d8:	41 55                	push   %r13
+  8017da:	41 54                	push   %r12
+  8017dc:	53                   	push   %rbx
+  8017dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8017e1:	49 89 fc             	mov    %rdi,%r12
+  8017e4:	49 89 f5             	mov    %rsi,%r13
+  8017e7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017eb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8017ee:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8017f1:	41 89 cf             	mov    %ecx,%r15d
+  8017f4:	4c 39 fa             	cmp    %r15,%rdx
+  8017f7:	73 5b                	jae    801854 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8017f9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8017fd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801801:	85 db                	test   %ebx,%ebx
+  801803:	7e 0e                	jle    801813 <print_num+0x43>
+            putch(padc, put_arg);
+  801805:	4c 89 ee             	mov    %r13,%rsi
+  801808:	44 89 f7             	mov    %r14d,%edi
+  80180b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80180e:	83 eb 01             	sub    $0x1,%ebx
+  801811:	75 f2                	jne    801805 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801813:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801817:	48 b9 06 5f 80 00 00 	movabs $0x805f06,%rcx
+  80181e:	00 00 00 
+  801821:	48 b8 f5 5e 80 00 00 	movabs $0x805ef5,%rax
+  801828:	00 00 00 
+  80182b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80182f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801833:	ba 00 00 00 00       	mov    $0x0,%edx
+  801838:	49 f7 f7             	div    %r15
+  80183b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80183f:	4c 89 ee             	mov    %r13,%rsi
+  801842:	41 ff d4             	call   *%r12
+}
+  801845:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801849:	5b                   	pop    %rbx
+  80184a:	41 5c                	pop    %r12
+  80184c:	41 5d                	pop    %r13
+  80184e:	41 5e                	pop    %r14
+  801850:	41 5f                	pop    %r15
+  801852:	5d                   	pop    %rbp
+  801853:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801854:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185d:	49 f7 f7             	div    %r15
+  801860:	48 83 ec 08          	sub    $0x8,%rsp
+  801864:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801868:	52                   	push   %rdx
+  801869:	45 0f be c9          	movsbl %r9b,%r9d
+  80186d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801871:	48 89 c2             	mov    %rax,%rdx
+  801874:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  80187b:	00 00 00 
+  80187e:	ff d0                	call   *%rax
+  801880:	48 83 c4 10          	add    $0x10,%rsp
+  801884:	eb 8d                	jmp    801813 <print_num+0x43>
+
+0000000000801886 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801886:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80188a:	48 8b 06             	mov    (%rsi),%rax
+  80188d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801891:	73 0a                	jae    80189d <sprintputch+0x17>
+        *state->start++ = ch;
+  801893:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801897:	48 89 16             	mov    %rdx,(%rsi)
+  80189a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80189d:	c3                   	ret
+
+000000000080189e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80189e:	55                   	push   %rbp
+  80189f:	48 89 e5             	mov    %rsp,%rbp
+  8018a2:	48 83 ec 50          	sub    $0x50,%rsp
+  8018a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018aa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018ae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8018b2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8018b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018c1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8018c9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8018cd:	48 b8 db 18 80 00 00 	movabs $0x8018db,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+}
+  8018d9:	c9                   	leave
+  8018da:	c3                   	ret
+
+00000000008018db <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8018db:	55                   	push   %rbp
+  8018dc:	48 89 e5             	mov    %rsp,%rbp
+  8018df:	41 57                	push   %r15
+  8018e1:	41 56                	push   %r14
+  8018e3:	41 55                	push   %r13
+  8018e5:	41 54                	push   %r12
+  8018e7:	53                   	push   %rbx
+  8018e8:	48 83 ec 38          	sub    $0x38,%rsp
+  8018ec:	49 89 fe             	mov    %rdi,%r14
+  8018ef:	49 89 f5             	mov    %rsi,%r13
+  8018f2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8018f5:	48 8b 01             	mov    (%rcx),%rax
+  8018f8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8018fc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801900:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801904:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801908:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80190c:	eb 0d                	jmp    80191b <vprintfmt+0x40>
+            putch(ch, put_arg);
+  80190e:	40 0f b6 ff          	movzbl %dil,%edi
+  801912:	4c 89 ee             	mov    %r13,%rsi
+  801915:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801918:	4c 89 e3             	mov    %r12,%rbx
+  80191b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80191f:	0f b6 3b             	movzbl (%rbx),%edi
+  801922:	40 80 ff 25          	cmp    $0x25,%dil
+  801926:	74 14                	je     80193c <vprintfmt+0x61>
+            if (!ch) return;
+  801928:	40 84 ff             	test   %dil,%dil
+  80192b:	75 e1                	jne    80190e <vprintfmt+0x33>
+}
+  80192d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801931:	5b                   	pop    %rbx
+  801932:	41 5c                	pop    %r12
+  801934:	41 5d                	pop    %r13
+  801936:	41 5e                	pop    %r14
+  801938:	41 5f                	pop    %r15
+  80193a:	5d                   	pop    %rbp
+  80193b:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  80193c:	be 00 00 00 00       	mov    $0x0,%esi
+  801941:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801945:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80194a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801950:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801957:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80195b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801960:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801965:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801968:	83 e8 23             	sub    $0x23,%eax
+  80196b:	3c 57                	cmp    $0x57,%al
+  80196d:	0f 87 67 06 00 00    	ja     801fda <vprintfmt+0x6ff>
+  801973:	0f b6 c0             	movzbl %al,%eax
+  801976:	48 b9 a0 60 80 00 00 	movabs $0x8060a0,%rcx
+  80197d:	00 00 00 
+  801980:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801983:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801986:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80198a:	eb cf                	jmp    80195b <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80198c:	49 89 dc             	mov    %rbx,%r12
+  80198f:	be 01 00 00 00       	mov    $0x1,%esi
+  801994:	eb c5                	jmp    80195b <vprintfmt+0x80>
+            padc = ch;
+  801996:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80199a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80199d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019a0:	eb b9                	jmp    80195b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8019a8:	77 24                	ja     8019ce <vprintfmt+0xf3>
+  8019aa:	89 c1                	mov    %eax,%ecx
+  8019ac:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8019b0:	83 c0 08             	add    $0x8,%eax
+  8019b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8019b6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8019b9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8019bc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8019c0:	79 99                	jns    80195b <vprintfmt+0x80>
+                width = precision;
+  8019c2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8019c6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8019cc:	eb 8d                	jmp    80195b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019ce:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8019d2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8019d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019da:	eb da                	jmp    8019b6 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8019dc:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8019e1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019e5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8019eb:	3c 39                	cmp    $0x39,%al
+  8019ed:	77 1c                	ja     801a0b <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8019ef:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8019f3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8019f7:	0f b6 c0             	movzbl %al,%eax
+  8019fa:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019ff:	0f b6 03             	movzbl (%rbx),%eax
+  801a02:	3c 39                	cmp    $0x39,%al
+  801a04:	76 e9                	jbe    8019ef <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801a06:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801a09:	eb b1                	jmp    8019bc <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801a0b:	49 89 dc             	mov    %rbx,%r12
+  801a0e:	eb ac                	jmp    8019bc <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801a10:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801a13:	85 c9                	test   %ecx,%ecx
+  801a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1a:	0f 49 c1             	cmovns %ecx,%eax
+  801a1d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801a20:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a23:	e9 33 ff ff ff       	jmp    80195b <vprintfmt+0x80>
+            lflag++;
+  801a28:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a2b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a2e:	e9 28 ff ff ff       	jmp    80195b <vprintfmt+0x80>
+            lflag--;
+  801a33:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a36:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a39:	e9 1d ff ff ff       	jmp    80195b <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801a3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a41:	83 f8 2f             	cmp    $0x2f,%eax
+  801a44:	77 19                	ja     801a5f <vprintfmt+0x184>
+  801a46:	89 c2                	mov    %eax,%edx
+  801a48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a4c:	83 c0 08             	add    $0x8,%eax
+  801a4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a52:	8b 3a                	mov    (%rdx),%edi
+  801a54:	4c 89 ee             	mov    %r13,%rsi
+  801a57:	41 ff d6             	call   *%r14
+            break;
+  801a5a:	e9 bc fe ff ff       	jmp    80191b <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a6b:	eb e5                	jmp    801a52 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a70:	83 f8 2f             	cmp    $0x2f,%eax
+  801a73:	77 5a                	ja     801acf <vprintfmt+0x1f4>
+  801a75:	89 c2                	mov    %eax,%edx
+  801a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a7b:	83 c0 08             	add    $0x8,%eax
+  801a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801a81:	8b 02                	mov    (%rdx),%eax
+  801a83:	89 c1                	mov    %eax,%ecx
+  801a85:	f7 d9                	neg    %ecx
+  801a87:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801a8a:	83 f9 13             	cmp    $0x13,%ecx
+  801a8d:	7f 4e                	jg     801add <vprintfmt+0x202>
+  801a8f:	48 63 c1             	movslq %ecx,%rax
+  801a92:	48 ba 60 63 80 00 00 	movabs $0x806360,%rdx
+  801a99:	00 00 00 
+  801a9c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801aa0:	48 85 c0             	test   %rax,%rax
+  801aa3:	74 38                	je     801add <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801aa5:	48 89 c1             	mov    %rax,%rcx
+  801aa8:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  801aaf:	00 00 00 
+  801ab2:	4c 89 ee             	mov    %r13,%rsi
+  801ab5:	4c 89 f7             	mov    %r14,%rdi
+  801ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abd:	49 b8 9e 18 80 00 00 	movabs $0x80189e,%r8
+  801ac4:	00 00 00 
+  801ac7:	41 ff d0             	call   *%r8
+  801aca:	e9 4c fe ff ff       	jmp    80191b <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801acf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ad3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ad7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801adb:	eb a4                	jmp    801a81 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801add:	48 ba 1e 5f 80 00 00 	movabs $0x805f1e,%rdx
+  801ae4:	00 00 00 
+  801ae7:	4c 89 ee             	mov    %r13,%rsi
+  801aea:	4c 89 f7             	mov    %r14,%rdi
+  801aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af2:	49 b8 9e 18 80 00 00 	movabs $0x80189e,%r8
+  801af9:	00 00 00 
+  801afc:	41 ff d0             	call   *%r8
+  801aff:	e9 17 fe ff ff       	jmp    80191b <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b07:	83 f8 2f             	cmp    $0x2f,%eax
+  801b0a:	77 6c                	ja     801b78 <vprintfmt+0x29d>
+  801b0c:	89 c2                	mov    %eax,%edx
+  801b0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b12:	83 c0 08             	add    $0x8,%eax
+  801b15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b18:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801b1b:	48 85 f6             	test   %rsi,%rsi
+  801b1e:	48 b8 17 5f 80 00 00 	movabs $0x805f17,%rax
+  801b25:	00 00 00 
+  801b28:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b2c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801b30:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b34:	7e 06                	jle    801b3c <vprintfmt+0x261>
+  801b36:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801b3a:	75 4a                	jne    801b86 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801b40:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801b44:	0f b6 00             	movzbl (%rax),%eax
+  801b47:	84 c0                	test   %al,%al
+  801b49:	0f 85 9a 00 00 00    	jne    801be9 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801b4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b52:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	0f 8e bd fd ff ff    	jle    80191b <vprintfmt+0x40>
+  801b5e:	4c 89 ee             	mov    %r13,%rsi
+  801b61:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b66:	41 ff d6             	call   *%r14
+  801b69:	41 83 ec 01          	sub    $0x1,%r12d
+  801b6d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b71:	75 eb                	jne    801b5e <vprintfmt+0x283>
+  801b73:	e9 a3 fd ff ff       	jmp    80191b <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b84:	eb 92                	jmp    801b18 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801b86:	49 63 f7             	movslq %r15d,%rsi
+  801b89:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801b8d:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  801b94:	00 00 00 
+  801b97:	ff d0                	call   *%rax
+  801b99:	48 89 c2             	mov    %rax,%rdx
+  801b9c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b9f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ba1:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ba4:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801ba7:	85 c0                	test   %eax,%eax
+  801ba9:	7e 91                	jle    801b3c <vprintfmt+0x261>
+  801bab:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801bb0:	4c 89 ee             	mov    %r13,%rsi
+  801bb3:	44 89 e7             	mov    %r12d,%edi
+  801bb6:	41 ff d6             	call   *%r14
+  801bb9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801bbd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bc0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801bc3:	75 eb                	jne    801bb0 <vprintfmt+0x2d5>
+  801bc5:	e9 72 ff ff ff       	jmp    801b3c <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801bca:	0f b6 f8             	movzbl %al,%edi
+  801bcd:	4c 89 ee             	mov    %r13,%rsi
+  801bd0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801bd3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801bd7:	49 83 c4 01          	add    $0x1,%r12
+  801bdb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801be1:	84 c0                	test   %al,%al
+  801be3:	0f 84 66 ff ff ff    	je     801b4f <vprintfmt+0x274>
+  801be9:	45 85 ff             	test   %r15d,%r15d
+  801bec:	78 0a                	js     801bf8 <vprintfmt+0x31d>
+  801bee:	41 83 ef 01          	sub    $0x1,%r15d
+  801bf2:	0f 88 57 ff ff ff    	js     801b4f <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801bf8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801bfc:	74 cc                	je     801bca <vprintfmt+0x2ef>
+  801bfe:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801c01:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801c06:	80 fa 5e             	cmp    $0x5e,%dl
+  801c09:	77 c2                	ja     801bcd <vprintfmt+0x2f2>
+  801c0b:	eb bd                	jmp    801bca <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801c0d:	40 84 f6             	test   %sil,%sil
+  801c10:	75 26                	jne    801c38 <vprintfmt+0x35d>
+    switch (lflag) {
+  801c12:	85 d2                	test   %edx,%edx
+  801c14:	74 59                	je     801c6f <vprintfmt+0x394>
+  801c16:	83 fa 01             	cmp    $0x1,%edx
+  801c19:	74 7b                	je     801c96 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801c1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c1e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c21:	0f 87 96 00 00 00    	ja     801cbd <vprintfmt+0x3e2>
+  801c27:	89 c2                	mov    %eax,%edx
+  801c29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c2d:	83 c0 08             	add    $0x8,%eax
+  801c30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c33:	4c 8b 22             	mov    (%rdx),%r12
+  801c36:	eb 17                	jmp    801c4f <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801c38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801c3e:	77 21                	ja     801c61 <vprintfmt+0x386>
+  801c40:	89 c2                	mov    %eax,%edx
+  801c42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c46:	83 c0 08             	add    $0x8,%eax
+  801c49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c4c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801c4f:	4d 85 e4             	test   %r12,%r12
+  801c52:	78 7a                	js     801cce <vprintfmt+0x3f3>
+            num = i;
+  801c54:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c5c:	e9 56 02 00 00       	jmp    801eb7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c6d:	eb dd                	jmp    801c4c <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801c6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c72:	83 f8 2f             	cmp    $0x2f,%eax
+  801c75:	77 11                	ja     801c88 <vprintfmt+0x3ad>
+  801c77:	89 c2                	mov    %eax,%edx
+  801c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c7d:	83 c0 08             	add    $0x8,%eax
+  801c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c83:	4c 63 22             	movslq (%rdx),%r12
+  801c86:	eb c7                	jmp    801c4f <vprintfmt+0x374>
+  801c88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c94:	eb ed                	jmp    801c83 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801c96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c99:	83 f8 2f             	cmp    $0x2f,%eax
+  801c9c:	77 11                	ja     801caf <vprintfmt+0x3d4>
+  801c9e:	89 c2                	mov    %eax,%edx
+  801ca0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ca4:	83 c0 08             	add    $0x8,%eax
+  801ca7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801caa:	4c 8b 22             	mov    (%rdx),%r12
+  801cad:	eb a0                	jmp    801c4f <vprintfmt+0x374>
+  801caf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbb:	eb ed                	jmp    801caa <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801cbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cc9:	e9 65 ff ff ff       	jmp    801c33 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801cce:	4c 89 ee             	mov    %r13,%rsi
+  801cd1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801cd6:	41 ff d6             	call   *%r14
+                i = -i;
+  801cd9:	49 f7 dc             	neg    %r12
+  801cdc:	e9 73 ff ff ff       	jmp    801c54 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801ce1:	40 84 f6             	test   %sil,%sil
+  801ce4:	75 2e                	jne    801d14 <vprintfmt+0x439>
+    switch (lflag) {
+  801ce6:	85 d2                	test   %edx,%edx
+  801ce8:	7f 59                	jg     801d43 <vprintfmt+0x468>
+  801cea:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ced:	7d 7a                	jge    801d69 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801cef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cf2:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf5:	0f 87 aa 00 00 00    	ja     801da5 <vprintfmt+0x4ca>
+  801cfb:	89 c2                	mov    %eax,%edx
+  801cfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d01:	83 c0 08             	add    $0x8,%eax
+  801d04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d07:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d0f:	e9 a3 01 00 00       	jmp    801eb7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d17:	83 f8 2f             	cmp    $0x2f,%eax
+  801d1a:	77 19                	ja     801d35 <vprintfmt+0x45a>
+  801d1c:	89 c2                	mov    %eax,%edx
+  801d1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d22:	83 c0 08             	add    $0x8,%eax
+  801d25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d28:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d2b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d30:	e9 82 01 00 00       	jmp    801eb7 <vprintfmt+0x5dc>
+  801d35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d41:	eb e5                	jmp    801d28 <vprintfmt+0x44d>
+    switch (lflag) {
+  801d43:	83 fa 01             	cmp    $0x1,%edx
+  801d46:	75 a7                	jne    801cef <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801d48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4e:	77 47                	ja     801d97 <vprintfmt+0x4bc>
+  801d50:	89 c2                	mov    %eax,%edx
+  801d52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d56:	83 c0 08             	add    $0x8,%eax
+  801d59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d64:	e9 4e 01 00 00       	jmp    801eb7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d6c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d6f:	77 18                	ja     801d89 <vprintfmt+0x4ae>
+  801d71:	89 c2                	mov    %eax,%edx
+  801d73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d77:	83 c0 08             	add    $0x8,%eax
+  801d7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d7d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801d7f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801d84:	e9 2e 01 00 00       	jmp    801eb7 <vprintfmt+0x5dc>
+  801d89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d95:	eb e6                	jmp    801d7d <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801d97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da3:	eb b7                	jmp    801d5c <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801da5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801da9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801db1:	e9 51 ff ff ff       	jmp    801d07 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801db6:	40 84 f6             	test   %sil,%sil
+  801db9:	75 2e                	jne    801de9 <vprintfmt+0x50e>
+    switch (lflag) {
+  801dbb:	85 d2                	test   %edx,%edx
+  801dbd:	7f 59                	jg     801e18 <vprintfmt+0x53d>
+  801dbf:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801dc2:	7d 77                	jge    801e3b <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801dc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc7:	83 f8 2f             	cmp    $0x2f,%eax
+  801dca:	0f 87 a4 00 00 00    	ja     801e74 <vprintfmt+0x599>
+  801dd0:	89 c2                	mov    %eax,%edx
+  801dd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd6:	83 c0 08             	add    $0x8,%eax
+  801dd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ddc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ddf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801de4:	e9 ce 00 00 00       	jmp    801eb7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801de9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dec:	83 f8 2f             	cmp    $0x2f,%eax
+  801def:	77 19                	ja     801e0a <vprintfmt+0x52f>
+  801df1:	89 c2                	mov    %eax,%edx
+  801df3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df7:	83 c0 08             	add    $0x8,%eax
+  801dfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dfd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e00:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e05:	e9 ad 00 00 00       	jmp    801eb7 <vprintfmt+0x5dc>
+  801e0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e16:	eb e5                	jmp    801dfd <vprintfmt+0x522>
+    switch (lflag) {
+  801e18:	83 fa 01             	cmp    $0x1,%edx
+  801e1b:	75 a7                	jne    801dc4 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801e1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e20:	83 f8 2f             	cmp    $0x2f,%eax
+  801e23:	77 41                	ja     801e66 <vprintfmt+0x58b>
+  801e25:	89 c2                	mov    %eax,%edx
+  801e27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2b:	83 c0 08             	add    $0x8,%eax
+  801e2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e34:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801e39:	eb 7c                	jmp    801eb7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e3e:	83 f8 2f             	cmp    $0x2f,%eax
+  801e41:	77 15                	ja     801e58 <vprintfmt+0x57d>
+  801e43:	89 c2                	mov    %eax,%edx
+  801e45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e49:	83 c0 08             	add    $0x8,%eax
+  801e4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e4f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e51:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e56:	eb 5f                	jmp    801eb7 <vprintfmt+0x5dc>
+  801e58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e64:	eb e9                	jmp    801e4f <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e72:	eb bd                	jmp    801e31 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801e74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e80:	e9 57 ff ff ff       	jmp    801ddc <vprintfmt+0x501>
+            putch('0', put_arg);
+  801e85:	4c 89 ee             	mov    %r13,%rsi
+  801e88:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e8d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801e90:	4c 89 ee             	mov    %r13,%rsi
+  801e93:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e98:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801e9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9e:	83 f8 2f             	cmp    $0x2f,%eax
+  801ea1:	77 47                	ja     801eea <vprintfmt+0x60f>
+  801ea3:	89 c2                	mov    %eax,%edx
+  801ea5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea9:	83 c0 08             	add    $0x8,%eax
+  801eac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eaf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801eb2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801eb7:	48 83 ec 08          	sub    $0x8,%rsp
+  801ebb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801ebf:	0f 94 c0             	sete   %al
+  801ec2:	0f b6 c0             	movzbl %al,%eax
+  801ec5:	50                   	push   %rax
+  801ec6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801ecb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801ecf:	4c 89 ee             	mov    %r13,%rsi
+  801ed2:	4c 89 f7             	mov    %r14,%rdi
+  801ed5:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801edc:	00 00 00 
+  801edf:	ff d0                	call   *%rax
+            break;
+  801ee1:	48 83 c4 10          	add    $0x10,%rsp
+  801ee5:	e9 31 fa ff ff       	jmp    80191b <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801eea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ef2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef6:	eb b7                	jmp    801eaf <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801ef8:	40 84 f6             	test   %sil,%sil
+  801efb:	75 2b                	jne    801f28 <vprintfmt+0x64d>
+    switch (lflag) {
+  801efd:	85 d2                	test   %edx,%edx
+  801eff:	7f 56                	jg     801f57 <vprintfmt+0x67c>
+  801f01:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f04:	7d 77                	jge    801f7d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801f06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f09:	83 f8 2f             	cmp    $0x2f,%eax
+  801f0c:	0f 87 a7 00 00 00    	ja     801fb9 <vprintfmt+0x6de>
+  801f12:	89 c2                	mov    %eax,%edx
+  801f14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f18:	83 c0 08             	add    $0x8,%eax
+  801f1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f1e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f26:	eb 8f                	jmp    801eb7 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f2b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f2e:	77 19                	ja     801f49 <vprintfmt+0x66e>
+  801f30:	89 c2                	mov    %eax,%edx
+  801f32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f36:	83 c0 08             	add    $0x8,%eax
+  801f39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f44:	e9 6e ff ff ff       	jmp    801eb7 <vprintfmt+0x5dc>
+  801f49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f55:	eb e5                	jmp    801f3c <vprintfmt+0x661>
+    switch (lflag) {
+  801f57:	83 fa 01             	cmp    $0x1,%edx
+  801f5a:	75 aa                	jne    801f06 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5f:	83 f8 2f             	cmp    $0x2f,%eax
+  801f62:	77 47                	ja     801fab <vprintfmt+0x6d0>
+  801f64:	89 c2                	mov    %eax,%edx
+  801f66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f6a:	83 c0 08             	add    $0x8,%eax
+  801f6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f70:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f73:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801f78:	e9 3a ff ff ff       	jmp    801eb7 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f80:	83 f8 2f             	cmp    $0x2f,%eax
+  801f83:	77 18                	ja     801f9d <vprintfmt+0x6c2>
+  801f85:	89 c2                	mov    %eax,%edx
+  801f87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f8b:	83 c0 08             	add    $0x8,%eax
+  801f8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f91:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801f93:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801f98:	e9 1a ff ff ff       	jmp    801eb7 <vprintfmt+0x5dc>
+  801f9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa9:	eb e6                	jmp    801f91 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801fab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801faf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fb7:	eb b7                	jmp    801f70 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801fb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc5:	e9 54 ff ff ff       	jmp    801f1e <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801fca:	4c 89 ee             	mov    %r13,%rsi
+  801fcd:	bf 25 00 00 00       	mov    $0x25,%edi
+  801fd2:	41 ff d6             	call   *%r14
+            break;
+  801fd5:	e9 41 f9 ff ff       	jmp    80191b <vprintfmt+0x40>
+            putch('%', put_arg);
+  801fda:	4c 89 ee             	mov    %r13,%rsi
+  801fdd:	bf 25 00 00 00       	mov    $0x25,%edi
+  801fe2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801fe5:	48 83 eb 01          	sub    $0x1,%rbx
+  801fe9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801fed:	75 f6                	jne    801fe5 <vprintfmt+0x70a>
+  801fef:	e9 27 f9 ff ff       	jmp    80191b <vprintfmt+0x40>
+
+0000000000801ff4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801ff4:	55                   	push   %rbp
+  801ff5:	48 89 e5             	mov    %rsp,%rbp
+  801ff8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801ffc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802000:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802005:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802009:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802010:	48 85 ff             	test   %rdi,%rdi
+  802013:	74 2b                	je     802040 <vsnprintf+0x4c>
+  802015:	48 85 f6             	test   %rsi,%rsi
+  802018:	74 26                	je     802040 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80201a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80201e:	48 bf 86 18 80 00 00 	movabs $0x801886,%rdi
+  802025:	00 00 00 
+  802028:	48 b8 db 18 80 00 00 	movabs $0x8018db,%rax
+  80202f:	00 00 00 
+  802032:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802034:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802038:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80203b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80203e:	c9                   	leave
+  80203f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802040:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802045:	eb f7                	jmp    80203e <vsnprintf+0x4a>
+
+0000000000802047 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802047:	55                   	push   %rbp
+  802048:	48 89 e5             	mov    %rsp,%rbp
+  80204b:	48 83 ec 50          	sub    $0x50,%rsp
+  80204f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802053:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802057:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80205b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802062:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802066:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80206a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80206e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802072:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802076:	48 b8 f4 1f 80 00 00 	movabs $0x801ff4,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802082:	c9                   	leave
+  802083:	c3                   	ret
+
+0000000000802084 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802084:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802087:	74 10                	je     802099 <strlen+0x15>
+    size_t n = 0;
+  802089:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80208e:	48 83 c0 01          	add    $0x1,%rax
+  802092:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802096:	75 f6                	jne    80208e <strlen+0xa>
+  802098:	c3                   	ret
+    size_t n = 0;
+  802099:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80209e:	c3                   	ret
+
+000000000080209f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80209f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8020a2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8020a7:	48 85 f6             	test   %rsi,%rsi
+  8020aa:	74 11                	je     8020bd <strnlen+0x1e>
+  8020ac:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8020b0:	74 0c                	je     8020be <strnlen+0x1f>
+  8020b2:	48 83 c2 01          	add    $0x1,%rdx
+  8020b6:	48 39 d0             	cmp    %rdx,%rax
+  8020b9:	75 f1                	jne    8020ac <strnlen+0xd>
+  8020bb:	eb 04                	jmp    8020c1 <strnlen+0x22>
+  8020bd:	c3                   	ret
+  8020be:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8020c1:	c3                   	ret
+
+00000000008020c2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8020c2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8020c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ca:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8020ce:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8020d1:	48 83 c2 01          	add    $0x1,%rdx
+  8020d5:	84 c9                	test   %cl,%cl
+  8020d7:	75 f1                	jne    8020ca <strcpy+0x8>
+        ;
+    return res;
+}
+  8020d9:	c3                   	ret
+
+00000000008020da <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8020da:	55                   	push   %rbp
+  8020db:	48 89 e5             	mov    %rsp,%rbp
+  8020de:	41 54                	push   %r12
+  8020e0:	53                   	push   %rbx
+  8020e1:	48 89 fb             	mov    %rdi,%rbx
+  8020e4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8020e7:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8020f3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8020f7:	4c 89 e6             	mov    %r12,%rsi
+  8020fa:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+    return dst;
+}
+  802106:	48 89 d8             	mov    %rbx,%rax
+  802109:	5b                   	pop    %rbx
+  80210a:	41 5c                	pop    %r12
+  80210c:	5d                   	pop    %rbp
+  80210d:	c3                   	ret
+
+000000000080210e <toupper>:
+
+int
+toupper(int ch) {
+  80210e:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802110:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802113:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802116:	83 f9 1a             	cmp    $0x1a,%ecx
+  802119:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80211c:	c3                   	ret
+
+000000000080211d <tolower>:
+
+int
+tolower(int ch) {
+  80211d:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80211f:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802122:	8d 57 20             	lea    0x20(%rdi),%edx
+  802125:	83 f9 1a             	cmp    $0x1a,%ecx
+  802128:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80212b:	c3                   	ret
+
+000000000080212c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80212c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80212f:	48 85 d2             	test   %rdx,%rdx
+  802132:	74 1f                	je     802153 <strncpy+0x27>
+  802134:	48 01 fa             	add    %rdi,%rdx
+  802137:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80213a:	48 83 c1 01          	add    $0x1,%rcx
+  80213e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802142:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802146:	41 80 f8 01          	cmp    $0x1,%r8b
+  80214a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80214e:	48 39 ca             	cmp    %rcx,%rdx
+  802151:	75 e7                	jne    80213a <strncpy+0xe>
+    }
+    return ret;
+}
+  802153:	c3                   	ret
+
+0000000000802154 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802154:	48 89 f8             	mov    %rdi,%rax
+  802157:	48 85 d2             	test   %rdx,%rdx
+  80215a:	74 24                	je     802180 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80215c:	48 83 ea 01          	sub    $0x1,%rdx
+  802160:	74 1b                	je     80217d <strlcpy+0x29>
+  802162:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802166:	0f b6 16             	movzbl (%rsi),%edx
+  802169:	84 d2                	test   %dl,%dl
+  80216b:	74 10                	je     80217d <strlcpy+0x29>
+            *dst++ = *src++;
+  80216d:	48 83 c6 01          	add    $0x1,%rsi
+  802171:	48 83 c0 01          	add    $0x1,%rax
+  802175:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802178:	48 39 c8             	cmp    %rcx,%rax
+  80217b:	75 e9                	jne    802166 <strlcpy+0x12>
+        *dst = '\0';
+  80217d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802180:	48 29 f8             	sub    %rdi,%rax
+}
+  802183:	c3                   	ret
+
+0000000000802184 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802184:	0f b6 07             	movzbl (%rdi),%eax
+  802187:	84 c0                	test   %al,%al
+  802189:	74 13                	je     80219e <strcmp+0x1a>
+  80218b:	38 06                	cmp    %al,(%rsi)
+  80218d:	75 0f                	jne    80219e <strcmp+0x1a>
+  80218f:	48 83 c7 01          	add    $0x1,%rdi
+  802193:	48 83 c6 01          	add    $0x1,%rsi
+  802197:	0f b6 07             	movzbl (%rdi),%eax
+  80219a:	84 c0                	test   %al,%al
+  80219c:	75 ed                	jne    80218b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80219e:	0f b6 c0             	movzbl %al,%eax
+  8021a1:	0f b6 16             	movzbl (%rsi),%edx
+  8021a4:	29 d0                	sub    %edx,%eax
+}
+  8021a6:	c3                   	ret
+
+00000000008021a7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8021a7:	48 85 d2             	test   %rdx,%rdx
+  8021aa:	74 1f                	je     8021cb <strncmp+0x24>
+  8021ac:	0f b6 07             	movzbl (%rdi),%eax
+  8021af:	84 c0                	test   %al,%al
+  8021b1:	74 1e                	je     8021d1 <strncmp+0x2a>
+  8021b3:	3a 06                	cmp    (%rsi),%al
+  8021b5:	75 1a                	jne    8021d1 <strncmp+0x2a>
+  8021b7:	48 83 c7 01          	add    $0x1,%rdi
+  8021bb:	48 83 c6 01          	add    $0x1,%rsi
+  8021bf:	48 83 ea 01          	sub    $0x1,%rdx
+  8021c3:	75 e7                	jne    8021ac <strncmp+0x5>
+
+    if (!n) return 0;
+  8021c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ca:	c3                   	ret
+  8021cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d0:	c3                   	ret
+  8021d1:	48 85 d2             	test   %rdx,%rdx
+  8021d4:	74 09                	je     8021df <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8021d6:	0f b6 07             	movzbl (%rdi),%eax
+  8021d9:	0f b6 16             	movzbl (%rsi),%edx
+  8021dc:	29 d0                	sub    %edx,%eax
+  8021de:	c3                   	ret
+    if (!n) return 0;
+  8021df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021e4:	c3                   	ret
+
+00000000008021e5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8021e5:	0f b6 17             	movzbl (%rdi),%edx
+  8021e8:	84 d2                	test   %dl,%dl
+  8021ea:	74 18                	je     802204 <strchr+0x1f>
+        if (*str == c) {
+  8021ec:	0f be d2             	movsbl %dl,%edx
+  8021ef:	39 f2                	cmp    %esi,%edx
+  8021f1:	74 17                	je     80220a <strchr+0x25>
+    for (; *str; str++) {
+  8021f3:	48 83 c7 01          	add    $0x1,%rdi
+  8021f7:	0f b6 17             	movzbl (%rdi),%edx
+  8021fa:	84 d2                	test   %dl,%dl
+  8021fc:	75 ee                	jne    8021ec <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8021fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802203:	c3                   	ret
+  802204:	b8 00 00 00 00       	mov    $0x0,%eax
+  802209:	c3                   	ret
+  80220a:	48 89 f8             	mov    %rdi,%rax
+}
+  80220d:	c3                   	ret
+
+000000000080220e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80220e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802211:	0f b6 17             	movzbl (%rdi),%edx
+  802214:	84 d2                	test   %dl,%dl
+  802216:	74 13                	je     80222b <strfind+0x1d>
+  802218:	0f be d2             	movsbl %dl,%edx
+  80221b:	39 f2                	cmp    %esi,%edx
+  80221d:	74 0b                	je     80222a <strfind+0x1c>
+  80221f:	48 83 c0 01          	add    $0x1,%rax
+  802223:	0f b6 10             	movzbl (%rax),%edx
+  802226:	84 d2                	test   %dl,%dl
+  802228:	75 ee                	jne    802218 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80222a:	c3                   	ret
+  80222b:	c3                   	ret
+
+000000000080222c <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80222c:	48 39 f7             	cmp    %rsi,%rdi
+  80222f:	74 65                	je     802296 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802231:	55                   	push   %rbp
+  802232:	48 89 e5             	mov    %rsp,%rbp
+  802235:	41 57                	push   %r15
+  802237:	41 56                	push   %r14
+  802239:	41 55                	push   %r13
+  80223b:	41 54                	push   %r12
+  80223d:	53                   	push   %rbx
+  80223e:	48 83 ec 18          	sub    $0x18,%rsp
+  802242:	48 89 fb             	mov    %rdi,%rbx
+  802245:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802248:	49 bf 1d 21 80 00 00 	movabs $0x80211d,%r15
+  80224f:	00 00 00 
+  802252:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802256:	41 0f b6 fd          	movzbl %r13b,%edi
+  80225a:	41 ff d7             	call   *%r15
+  80225d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802260:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802265:	41 0f b6 fe          	movzbl %r14b,%edi
+  802269:	41 ff d7             	call   *%r15
+  80226c:	89 c2                	mov    %eax,%edx
+  80226e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802271:	29 d0                	sub    %edx,%eax
+  802273:	75 12                	jne    802287 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802275:	48 83 c3 01          	add    $0x1,%rbx
+  802279:	45 84 ed             	test   %r13b,%r13b
+  80227c:	74 09                	je     802287 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80227e:	49 83 c4 01          	add    $0x1,%r12
+  802282:	45 84 f6             	test   %r14b,%r14b
+  802285:	75 cb                	jne    802252 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802287:	48 83 c4 18          	add    $0x18,%rsp
+  80228b:	5b                   	pop    %rbx
+  80228c:	41 5c                	pop    %r12
+  80228e:	41 5d                	pop    %r13
+  802290:	41 5e                	pop    %r14
+  802292:	41 5f                	pop    %r15
+  802294:	5d                   	pop    %rbp
+  802295:	c3                   	ret
+    if (p1 == p2) return 0;
+  802296:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80229b:	c3                   	ret
+
+000000000080229c <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80229c:	48 39 f7             	cmp    %rsi,%rdi
+  80229f:	74 7d                	je     80231e <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8022a1:	55                   	push   %rbp
+  8022a2:	48 89 e5             	mov    %rsp,%rbp
+  8022a5:	41 57                	push   %r15
+  8022a7:	41 56                	push   %r14
+  8022a9:	41 55                	push   %r13
+  8022ab:	41 54                	push   %r12
+  8022ad:	53                   	push   %rbx
+  8022ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8022b2:	48 89 fb             	mov    %rdi,%rbx
+  8022b5:	49 89 f4             	mov    %rsi,%r12
+  8022b8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8022bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022c0:	49 bf 1d 21 80 00 00 	movabs $0x80211d,%r15
+  8022c7:	00 00 00 
+    while (n--) {
+  8022ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022ce:	48 39 c3             	cmp    %rax,%rbx
+  8022d1:	74 37                	je     80230a <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022d3:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022d7:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022db:	41 ff d7             	call   *%r15
+  8022de:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022e1:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8022e6:	41 0f b6 fe          	movzbl %r14b,%edi
+  8022ea:	41 ff d7             	call   *%r15
+  8022ed:	89 c2                	mov    %eax,%edx
+  8022ef:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022f2:	29 d0                	sub    %edx,%eax
+  8022f4:	75 19                	jne    80230f <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8022f6:	48 83 c3 01          	add    $0x1,%rbx
+  8022fa:	45 84 ed             	test   %r13b,%r13b
+  8022fd:	74 10                	je     80230f <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8022ff:	49 83 c4 01          	add    $0x1,%r12
+  802303:	45 84 f6             	test   %r14b,%r14b
+  802306:	75 c2                	jne    8022ca <strncasecmp+0x2e>
+  802308:	eb 05                	jmp    80230f <strncasecmp+0x73>
+  80230a:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80230f:	48 83 c4 18          	add    $0x18,%rsp
+  802313:	5b                   	pop    %rbx
+  802314:	41 5c                	pop    %r12
+  802316:	41 5d                	pop    %r13
+  802318:	41 5e                	pop    %r14
+  80231a:	41 5f                	pop    %r15
+  80231c:	5d                   	pop    %rbp
+  80231d:	c3                   	ret
+    if (p1 == p2) return 0;
+  80231e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802323:	c3                   	ret
+
+0000000000802324 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802324:	83 e7 df             	and    $0xffffffdf,%edi
+  802327:	83 ef 41             	sub    $0x41,%edi
+  80232a:	83 ff 19             	cmp    $0x19,%edi
+  80232d:	0f 96 c0             	setbe  %al
+}
+  802330:	c3                   	ret
+
+0000000000802331 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802331:	83 ff 20             	cmp    $0x20,%edi
+  802334:	0f 94 c0             	sete   %al
+  802337:	83 ff 09             	cmp    $0x9,%edi
+  80233a:	0f 94 c2             	sete   %dl
+  80233d:	09 d0                	or     %edx,%eax
+}
+  80233f:	c3                   	ret
+
+0000000000802340 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802340:	55                   	push   %rbp
+  802341:	48 89 e5             	mov    %rsp,%rbp
+  802344:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802346:	48 bf 1f 64 80 00 00 	movabs $0x80641f,%rdi
+  80234d:	00 00 00 
+  802350:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+  80235c:	48 85 c0             	test   %rax,%rax
+  80235f:	0f 95 c0             	setne  %al
+}
+  802362:	5d                   	pop    %rbp
+  802363:	c3                   	ret
+
+0000000000802364 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802364:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802367:	48 89 f8             	mov    %rdi,%rax
+  80236a:	48 f7 d8             	neg    %rax
+  80236d:	83 e0 07             	and    $0x7,%eax
+  802370:	49 89 d1             	mov    %rdx,%r9
+  802373:	49 29 c1             	sub    %rax,%r9
+  802376:	78 36                	js     8023ae <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802378:	40 0f b6 c6          	movzbl %sil,%eax
+  80237c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802383:	01 01 01 
+  802386:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80238a:	40 f6 c7 07          	test   $0x7,%dil
+  80238e:	75 38                	jne    8023c8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802390:	4c 89 c9             	mov    %r9,%rcx
+  802393:	48 c1 f9 03          	sar    $0x3,%rcx
+  802397:	74 0c                	je     8023a5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802399:	fc                   	cld
+  80239a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80239d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8023a1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8023a5:	4d 85 c9             	test   %r9,%r9
+  8023a8:	75 45                	jne    8023ef <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8023aa:	4c 89 c0             	mov    %r8,%rax
+  8023ad:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8023ae:	48 85 d2             	test   %rdx,%rdx
+  8023b1:	74 f7                	je     8023aa <memset+0x46>
+  8023b3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8023b6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8023b9:	48 83 c0 01          	add    $0x1,%rax
+  8023bd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8023c1:	48 39 c2             	cmp    %rax,%rdx
+  8023c4:	75 f3                	jne    8023b9 <memset+0x55>
+  8023c6:	eb e2                	jmp    8023aa <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8023c8:	40 f6 c7 01          	test   $0x1,%dil
+  8023cc:	74 06                	je     8023d4 <memset+0x70>
+  8023ce:	88 07                	mov    %al,(%rdi)
+  8023d0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023d4:	40 f6 c7 02          	test   $0x2,%dil
+  8023d8:	74 07                	je     8023e1 <memset+0x7d>
+  8023da:	66 89 07             	mov    %ax,(%rdi)
+  8023dd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023e1:	40 f6 c7 04          	test   $0x4,%dil
+  8023e5:	74 a9                	je     802390 <memset+0x2c>
+  8023e7:	89 07                	mov    %eax,(%rdi)
+  8023e9:	48 83 c7 04          	add    $0x4,%rdi
+  8023ed:	eb a1                	jmp    802390 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023ef:	41 f6 c1 04          	test   $0x4,%r9b
+  8023f3:	74 06                	je     8023fb <memset+0x97>
+  8023f5:	89 07                	mov    %eax,(%rdi)
+  8023f7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023fb:	41 f6 c1 02          	test   $0x2,%r9b
+  8023ff:	74 07                	je     802408 <memset+0xa4>
+  802401:	66 89 07             	mov    %ax,(%rdi)
+  802404:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802408:	41 f6 c1 01          	test   $0x1,%r9b
+  80240c:	74 9c                	je     8023aa <memset+0x46>
+  80240e:	88 07                	mov    %al,(%rdi)
+  802410:	eb 98                	jmp    8023aa <memset+0x46>
+
+0000000000802412 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802412:	48 89 f8             	mov    %rdi,%rax
+  802415:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802418:	48 39 fe             	cmp    %rdi,%rsi
+  80241b:	73 3b                	jae    802458 <memmove+0x46>
+  80241d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802421:	48 39 d7             	cmp    %rdx,%rdi
+  802424:	73 32                	jae    802458 <memmove+0x46>
+        s += n;
+        d += n;
+  802426:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80242a:	48 89 d6             	mov    %rdx,%rsi
+  80242d:	48 09 fe             	or     %rdi,%rsi
+  802430:	48 09 ce             	or     %rcx,%rsi
+  802433:	40 f6 c6 07          	test   $0x7,%sil
+  802437:	75 12                	jne    80244b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802439:	48 83 ef 08          	sub    $0x8,%rdi
+  80243d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802441:	48 c1 e9 03          	shr    $0x3,%rcx
+  802445:	fd                   	std
+  802446:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802449:	fc                   	cld
+  80244a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80244b:	48 83 ef 01          	sub    $0x1,%rdi
+  80244f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802453:	fd                   	std
+  802454:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802456:	eb f1                	jmp    802449 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802458:	48 89 f2             	mov    %rsi,%rdx
+  80245b:	48 09 c2             	or     %rax,%rdx
+  80245e:	48 09 ca             	or     %rcx,%rdx
+  802461:	f6 c2 07             	test   $0x7,%dl
+  802464:	75 0c                	jne    802472 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802466:	48 c1 e9 03          	shr    $0x3,%rcx
+  80246a:	48 89 c7             	mov    %rax,%rdi
+  80246d:	fc                   	cld
+  80246e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802471:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802472:	48 89 c7             	mov    %rax,%rdi
+  802475:	fc                   	cld
+  802476:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802478:	c3                   	ret
+
+0000000000802479 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802479:	55                   	push   %rbp
+  80247a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80247d:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  802484:	00 00 00 
+  802487:	ff d0                	call   *%rax
+}
+  802489:	5d                   	pop    %rbp
+  80248a:	c3                   	ret
+
+000000000080248b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80248b:	55                   	push   %rbp
+  80248c:	48 89 e5             	mov    %rsp,%rbp
+  80248f:	41 57                	push   %r15
+  802491:	41 56                	push   %r14
+  802493:	41 55                	push   %r13
+  802495:	41 54                	push   %r12
+  802497:	53                   	push   %rbx
+  802498:	48 83 ec 08          	sub    $0x8,%rsp
+  80249c:	49 89 fe             	mov    %rdi,%r14
+  80249f:	49 89 f7             	mov    %rsi,%r15
+  8024a2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8024a5:	48 89 f7             	mov    %rsi,%rdi
+  8024a8:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  8024af:	00 00 00 
+  8024b2:	ff d0                	call   *%rax
+  8024b4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8024b7:	48 89 de             	mov    %rbx,%rsi
+  8024ba:	4c 89 f7             	mov    %r14,%rdi
+  8024bd:	48 b8 9f 20 80 00 00 	movabs $0x80209f,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+  8024c9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024cc:	48 39 c3             	cmp    %rax,%rbx
+  8024cf:	74 36                	je     802507 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8024d1:	48 89 d8             	mov    %rbx,%rax
+  8024d4:	4c 29 e8             	sub    %r13,%rax
+  8024d7:	49 39 c4             	cmp    %rax,%r12
+  8024da:	73 31                	jae    80250d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8024dc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8024e1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024e5:	4c 89 fe             	mov    %r15,%rsi
+  8024e8:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  8024ef:	00 00 00 
+  8024f2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8024f4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8024f8:	48 83 c4 08          	add    $0x8,%rsp
+  8024fc:	5b                   	pop    %rbx
+  8024fd:	41 5c                	pop    %r12
+  8024ff:	41 5d                	pop    %r13
+  802501:	41 5e                	pop    %r14
+  802503:	41 5f                	pop    %r15
+  802505:	5d                   	pop    %rbp
+  802506:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802507:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80250b:	eb eb                	jmp    8024f8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80250d:	48 83 eb 01          	sub    $0x1,%rbx
+  802511:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802515:	48 89 da             	mov    %rbx,%rdx
+  802518:	4c 89 fe             	mov    %r15,%rsi
+  80251b:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802527:	49 01 de             	add    %rbx,%r14
+  80252a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80252f:	eb c3                	jmp    8024f4 <strlcat+0x69>
+
+0000000000802531 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802531:	48 85 d2             	test   %rdx,%rdx
+  802534:	74 2d                	je     802563 <memcmp+0x32>
+  802536:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80253b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80253f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802544:	44 38 c1             	cmp    %r8b,%cl
+  802547:	75 0f                	jne    802558 <memcmp+0x27>
+    while (n-- > 0) {
+  802549:	48 83 c0 01          	add    $0x1,%rax
+  80254d:	48 39 c2             	cmp    %rax,%rdx
+  802550:	75 e9                	jne    80253b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802552:	b8 00 00 00 00       	mov    $0x0,%eax
+  802557:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802558:	0f b6 c1             	movzbl %cl,%eax
+  80255b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80255f:	44 29 c0             	sub    %r8d,%eax
+  802562:	c3                   	ret
+    return 0;
+  802563:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802568:	c3                   	ret
+
+0000000000802569 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802569:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80256d:	48 39 c7             	cmp    %rax,%rdi
+  802570:	73 0f                	jae    802581 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802572:	40 38 37             	cmp    %sil,(%rdi)
+  802575:	74 0e                	je     802585 <memfind+0x1c>
+    for (; src < end; src++) {
+  802577:	48 83 c7 01          	add    $0x1,%rdi
+  80257b:	48 39 f8             	cmp    %rdi,%rax
+  80257e:	75 f2                	jne    802572 <memfind+0x9>
+  802580:	c3                   	ret
+  802581:	48 89 f8             	mov    %rdi,%rax
+  802584:	c3                   	ret
+  802585:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802588:	c3                   	ret
+
+0000000000802589 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802589:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80258c:	0f b6 37             	movzbl (%rdi),%esi
+  80258f:	40 80 fe 20          	cmp    $0x20,%sil
+  802593:	74 06                	je     80259b <strtol+0x12>
+  802595:	40 80 fe 09          	cmp    $0x9,%sil
+  802599:	75 13                	jne    8025ae <strtol+0x25>
+  80259b:	48 83 c7 01          	add    $0x1,%rdi
+  80259f:	0f b6 37             	movzbl (%rdi),%esi
+  8025a2:	40 80 fe 20          	cmp    $0x20,%sil
+  8025a6:	74 f3                	je     80259b <strtol+0x12>
+  8025a8:	40 80 fe 09          	cmp    $0x9,%sil
+  8025ac:	74 ed                	je     80259b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8025ae:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8025b1:	83 e0 fd             	and    $0xfffffffd,%eax
+  8025b4:	3c 01                	cmp    $0x1,%al
+  8025b6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025ba:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8025c0:	75 0f                	jne    8025d1 <strtol+0x48>
+  8025c2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8025c5:	74 14                	je     8025db <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8025c7:	85 d2                	test   %edx,%edx
+  8025c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025ce:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8025d1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8025d6:	4c 63 ca             	movslq %edx,%r9
+  8025d9:	eb 36                	jmp    802611 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025db:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8025df:	74 0f                	je     8025f0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8025e1:	85 d2                	test   %edx,%edx
+  8025e3:	75 ec                	jne    8025d1 <strtol+0x48>
+        s++;
+  8025e5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8025e9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8025ee:	eb e1                	jmp    8025d1 <strtol+0x48>
+        s += 2;
+  8025f0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8025f4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8025f9:	eb d6                	jmp    8025d1 <strtol+0x48>
+            dig -= '0';
+  8025fb:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8025fe:	44 0f b6 c1          	movzbl %cl,%r8d
+  802602:	41 39 d0             	cmp    %edx,%r8d
+  802605:	7d 21                	jge    802628 <strtol+0x9f>
+        val = val * base + dig;
+  802607:	49 0f af c1          	imul   %r9,%rax
+  80260b:	0f b6 c9             	movzbl %cl,%ecx
+  80260e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802611:	48 83 c7 01          	add    $0x1,%rdi
+  802615:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802619:	80 f9 39             	cmp    $0x39,%cl
+  80261c:	76 dd                	jbe    8025fb <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80261e:	80 f9 7b             	cmp    $0x7b,%cl
+  802621:	77 05                	ja     802628 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802623:	83 e9 57             	sub    $0x57,%ecx
+  802626:	eb d6                	jmp    8025fe <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802628:	4d 85 d2             	test   %r10,%r10
+  80262b:	74 03                	je     802630 <strtol+0xa7>
+  80262d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802630:	48 89 c2             	mov    %rax,%rdx
+  802633:	48 f7 da             	neg    %rdx
+  802636:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80263a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80263e:	c3                   	ret
+
+000000000080263f <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80263f:	55                   	push   %rbp
+  802640:	48 89 e5             	mov    %rsp,%rbp
+  802643:	53                   	push   %rbx
+  802644:	48 89 fa             	mov    %rdi,%rdx
+  802647:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80264f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802654:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802659:	be 00 00 00 00       	mov    $0x0,%esi
+  80265e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802664:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80266a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80266c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802670:	c9                   	leave
+  802671:	c3                   	ret
+
+0000000000802672 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802672:	55                   	push   %rbp
+  802673:	48 89 e5             	mov    %rsp,%rbp
+  802676:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802677:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80267c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802681:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802686:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80268b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802690:	be 00 00 00 00       	mov    $0x0,%esi
+  802695:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80269b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026a1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026a7:	c9                   	leave
+  8026a8:	c3                   	ret
+
+00000000008026a9 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8026a9:	55                   	push   %rbp
+  8026aa:	48 89 e5             	mov    %rsp,%rbp
+  8026ad:	53                   	push   %rbx
+  8026ae:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8026b1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026d6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8026d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026dc:	c9                   	leave
+  8026dd:	c3                   	ret
+
+00000000008026de <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8026de:	55                   	push   %rbp
+  8026df:	48 89 e5             	mov    %rsp,%rbp
+  8026e2:	53                   	push   %rbx
+  8026e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8026e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8026ea:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802703:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802709:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80270f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802711:	48 85 c0             	test   %rax,%rax
+  802714:	7f 06                	jg     80271c <sys_env_destroy+0x3e>
+}
+  802716:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80271a:	c9                   	leave
+  80271b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80271c:	49 89 c0             	mov    %rax,%r8
+  80271f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802724:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  80272b:	00 00 00 
+  80272e:	be 27 00 00 00       	mov    $0x27,%esi
+  802733:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  80273a:	00 00 00 
+  80273d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802742:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802749:	00 00 00 
+  80274c:	41 ff d1             	call   *%r9
+
+000000000080274f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80274f:	55                   	push   %rbp
+  802750:	48 89 e5             	mov    %rsp,%rbp
+  802753:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802754:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802763:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802768:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80276d:	be 00 00 00 00       	mov    $0x0,%esi
+  802772:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802778:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80277e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802780:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802784:	c9                   	leave
+  802785:	c3                   	ret
+
+0000000000802786 <sys_yield>:
+
+void
+sys_yield(void) {
+  802786:	55                   	push   %rbp
+  802787:	48 89 e5             	mov    %rsp,%rbp
+  80278a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80278b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802790:	ba 00 00 00 00       	mov    $0x0,%edx
+  802795:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80279a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80279f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027b5:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027bb:	c9                   	leave
+  8027bc:	c3                   	ret
+
+00000000008027bd <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8027bd:	55                   	push   %rbp
+  8027be:	48 89 e5             	mov    %rsp,%rbp
+  8027c1:	53                   	push   %rbx
+  8027c2:	48 89 fa             	mov    %rdi,%rdx
+  8027c5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027cd:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027d4:	00 00 00 
+  8027d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ed:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8027ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f3:	c9                   	leave
+  8027f4:	c3                   	ret
+
+00000000008027f5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8027f5:	55                   	push   %rbp
+  8027f6:	48 89 e5             	mov    %rsp,%rbp
+  8027f9:	53                   	push   %rbx
+  8027fa:	49 89 f8             	mov    %rdi,%r8
+  8027fd:	48 89 d3             	mov    %rdx,%rbx
+  802800:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802803:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802808:	4c 89 c2             	mov    %r8,%rdx
+  80280b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80280e:	be 00 00 00 00       	mov    $0x0,%esi
+  802813:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802819:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80281f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802821:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802825:	c9                   	leave
+  802826:	c3                   	ret
+
+0000000000802827 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802827:	55                   	push   %rbp
+  802828:	48 89 e5             	mov    %rsp,%rbp
+  80282b:	53                   	push   %rbx
+  80282c:	48 83 ec 08          	sub    $0x8,%rsp
+  802830:	89 f8                	mov    %edi,%eax
+  802832:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802835:	48 63 f9             	movslq %ecx,%rdi
+  802838:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80283b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802840:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802843:	be 00 00 00 00       	mov    $0x0,%esi
+  802848:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80284e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802854:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802856:	48 85 c0             	test   %rax,%rax
+  802859:	7f 06                	jg     802861 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80285b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80285f:	c9                   	leave
+  802860:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802861:	49 89 c0             	mov    %rax,%r8
+  802864:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802869:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802870:	00 00 00 
+  802873:	be 27 00 00 00       	mov    $0x27,%esi
+  802878:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  80287f:	00 00 00 
+  802882:	b8 00 00 00 00       	mov    $0x0,%eax
+  802887:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  80288e:	00 00 00 
+  802891:	41 ff d1             	call   *%r9
+
+0000000000802894 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802894:	55                   	push   %rbp
+  802895:	48 89 e5             	mov    %rsp,%rbp
+  802898:	53                   	push   %rbx
+  802899:	48 83 ec 08          	sub    $0x8,%rsp
+  80289d:	89 f8                	mov    %edi,%eax
+  80289f:	49 89 f2             	mov    %rsi,%r10
+  8028a2:	48 89 cf             	mov    %rcx,%rdi
+  8028a5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8028a8:	48 63 da             	movslq %edx,%rbx
+  8028ab:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028ae:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028b3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028b6:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8028b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028c1:	48 85 c0             	test   %rax,%rax
+  8028c4:	7f 06                	jg     8028cc <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8028c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ca:	c9                   	leave
+  8028cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028cc:	49 89 c0             	mov    %rax,%r8
+  8028cf:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8028d4:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  8028db:	00 00 00 
+  8028de:	be 27 00 00 00       	mov    $0x27,%esi
+  8028e3:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  8028ea:	00 00 00 
+  8028ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f2:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  8028f9:	00 00 00 
+  8028fc:	41 ff d1             	call   *%r9
+
+00000000008028ff <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8028ff:	55                   	push   %rbp
+  802900:	48 89 e5             	mov    %rsp,%rbp
+  802903:	53                   	push   %rbx
+  802904:	48 83 ec 08          	sub    $0x8,%rsp
+  802908:	48 89 f1             	mov    %rsi,%rcx
+  80290b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  80290e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802911:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802916:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80291b:	be 00 00 00 00       	mov    $0x0,%esi
+  802920:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802926:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80292c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80292e:	48 85 c0             	test   %rax,%rax
+  802931:	7f 06                	jg     802939 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802933:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802937:	c9                   	leave
+  802938:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802939:	49 89 c0             	mov    %rax,%r8
+  80293c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802941:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802948:	00 00 00 
+  80294b:	be 27 00 00 00       	mov    $0x27,%esi
+  802950:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802957:	00 00 00 
+  80295a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295f:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802966:	00 00 00 
+  802969:	41 ff d1             	call   *%r9
+
+000000000080296c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80296c:	55                   	push   %rbp
+  80296d:	48 89 e5             	mov    %rsp,%rbp
+  802970:	53                   	push   %rbx
+  802971:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802975:	48 63 ce             	movslq %esi,%rcx
+  802978:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80297b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802980:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802985:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80298a:	be 00 00 00 00       	mov    $0x0,%esi
+  80298f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802995:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80299b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80299d:	48 85 c0             	test   %rax,%rax
+  8029a0:	7f 06                	jg     8029a8 <sys_env_set_status+0x3c>
+}
+  8029a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029a8:	49 89 c0             	mov    %rax,%r8
+  8029ab:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8029b0:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  8029b7:	00 00 00 
+  8029ba:	be 27 00 00 00       	mov    $0x27,%esi
+  8029bf:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  8029c6:	00 00 00 
+  8029c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ce:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  8029d5:	00 00 00 
+  8029d8:	41 ff d1             	call   *%r9
+
+00000000008029db <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8029db:	55                   	push   %rbp
+  8029dc:	48 89 e5             	mov    %rsp,%rbp
+  8029df:	53                   	push   %rbx
+  8029e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8029e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a04:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a0a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a0c:	48 85 c0             	test   %rax,%rax
+  802a0f:	7f 06                	jg     802a17 <sys_env_set_trapframe+0x3c>
+}
+  802a11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a15:	c9                   	leave
+  802a16:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a17:	49 89 c0             	mov    %rax,%r8
+  802a1a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802a1f:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802a26:	00 00 00 
+  802a29:	be 27 00 00 00       	mov    $0x27,%esi
+  802a2e:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802a35:	00 00 00 
+  802a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3d:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802a44:	00 00 00 
+  802a47:	41 ff d1             	call   *%r9
+
+0000000000802a4a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802a4a:	55                   	push   %rbp
+  802a4b:	48 89 e5             	mov    %rsp,%rbp
+  802a4e:	53                   	push   %rbx
+  802a4f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a53:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a56:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a59:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a63:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a68:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a73:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a79:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a7b:	48 85 c0             	test   %rax,%rax
+  802a7e:	7f 06                	jg     802a86 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802a80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a84:	c9                   	leave
+  802a85:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a86:	49 89 c0             	mov    %rax,%r8
+  802a89:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802a8e:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802a95:	00 00 00 
+  802a98:	be 27 00 00 00       	mov    $0x27,%esi
+  802a9d:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802aa4:	00 00 00 
+  802aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aac:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802ab3:	00 00 00 
+  802ab6:	41 ff d1             	call   *%r9
+
+0000000000802ab9 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802ab9:	55                   	push   %rbp
+  802aba:	48 89 e5             	mov    %rsp,%rbp
+  802abd:	53                   	push   %rbx
+  802abe:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802ac2:	40 0f b6 ce          	movzbl %sil,%ecx
+  802ac6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ac9:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ace:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ad8:	be 00 00 00 00       	mov    $0x0,%esi
+  802add:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ae9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802aeb:	48 85 c0             	test   %rax,%rax
+  802aee:	7f 06                	jg     802af6 <sys_env_set_reclaim+0x3d>
+}
+  802af0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802af4:	c9                   	leave
+  802af5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802af6:	49 89 c0             	mov    %rax,%r8
+  802af9:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802afe:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802b05:	00 00 00 
+  802b08:	be 27 00 00 00       	mov    $0x27,%esi
+  802b0d:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802b14:	00 00 00 
+  802b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1c:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802b23:	00 00 00 
+  802b26:	41 ff d1             	call   *%r9
+
+0000000000802b29 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802b29:	55                   	push   %rbp
+  802b2a:	48 89 e5             	mov    %rsp,%rbp
+  802b2d:	53                   	push   %rbx
+  802b2e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802b32:	48 63 ce             	movslq %esi,%rcx
+  802b35:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b38:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b47:	be 00 00 00 00       	mov    $0x0,%esi
+  802b4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b58:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b5a:	48 85 c0             	test   %rax,%rax
+  802b5d:	7f 06                	jg     802b65 <sys_env_set_nice+0x3c>
+}
+  802b5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b65:	49 89 c0             	mov    %rax,%r8
+  802b68:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802b6d:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802b74:	00 00 00 
+  802b77:	be 27 00 00 00       	mov    $0x27,%esi
+  802b7c:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802b83:	00 00 00 
+  802b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8b:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802b92:	00 00 00 
+  802b95:	41 ff d1             	call   *%r9
+
+0000000000802b98 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802b98:	55                   	push   %rbp
+  802b99:	48 89 e5             	mov    %rsp,%rbp
+  802b9c:	53                   	push   %rbx
+  802b9d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ba0:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ba5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802baa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802baf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bb4:	be 00 00 00 00       	mov    $0x0,%esi
+  802bb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bbf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bc5:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802bc7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bcb:	c9                   	leave
+  802bcc:	c3                   	ret
+
+0000000000802bcd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802bcd:	55                   	push   %rbp
+  802bce:	48 89 e5             	mov    %rsp,%rbp
+  802bd1:	53                   	push   %rbx
+  802bd2:	89 f8                	mov    %edi,%eax
+  802bd4:	49 89 f1             	mov    %rsi,%r9
+  802bd7:	48 89 d3             	mov    %rdx,%rbx
+  802bda:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bdd:	49 63 f0             	movslq %r8d,%rsi
+  802be0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802be3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802be8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802beb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bf1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bf7:	cd 30                	int    $0x30
+}
+  802bf9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bfd:	c9                   	leave
+  802bfe:	c3                   	ret
+
+0000000000802bff <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802bff:	55                   	push   %rbp
+  802c00:	48 89 e5             	mov    %rsp,%rbp
+  802c03:	53                   	push   %rbx
+  802c04:	89 f8                	mov    %edi,%eax
+  802c06:	49 89 f1             	mov    %rsi,%r9
+  802c09:	48 89 d3             	mov    %rdx,%rbx
+  802c0c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c0f:	49 63 f0             	movslq %r8d,%rsi
+  802c12:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c15:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c23:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c29:	cd 30                	int    $0x30
+}
+  802c2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c2f:	c9                   	leave
+  802c30:	c3                   	ret
+
+0000000000802c31 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c31:	55                   	push   %rbp
+  802c32:	48 89 e5             	mov    %rsp,%rbp
+  802c35:	53                   	push   %rbx
+  802c36:	48 83 ec 08          	sub    $0x8,%rsp
+  802c3a:	89 f8                	mov    %edi,%eax
+  802c3c:	49 89 f2             	mov    %rsi,%r10
+  802c3f:	48 89 d3             	mov    %rdx,%rbx
+  802c42:	48 89 cf             	mov    %rcx,%rdi
+  802c45:	44 89 c6             	mov    %r8d,%esi
+  802c48:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c4b:	48 63 f6             	movslq %esi,%rsi
+  802c4e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c51:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c56:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c59:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c5d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c5f:	48 85 c0             	test   %rax,%rax
+  802c62:	7f 06                	jg     802c6a <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c6a:	49 89 c0             	mov    %rax,%r8
+  802c6d:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802c72:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802c79:	00 00 00 
+  802c7c:	be 27 00 00 00       	mov    $0x27,%esi
+  802c81:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802c88:	00 00 00 
+  802c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c90:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802c97:	00 00 00 
+  802c9a:	41 ff d1             	call   *%r9
+
+0000000000802c9d <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802c9d:	55                   	push   %rbp
+  802c9e:	48 89 e5             	mov    %rsp,%rbp
+  802ca1:	53                   	push   %rbx
+  802ca2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca6:	48 89 f1             	mov    %rsi,%rcx
+  802ca9:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802cac:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802cb0:	48 8b 1a             	mov    (%rdx),%rbx
+  802cb3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cbb:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cbf:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802cc3:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802cc7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cc9:	48 85 c0             	test   %rax,%rax
+  802ccc:	7f 06                	jg     802cd4 <sys_ipc_call_short+0x37>
+}
+  802cce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd2:	c9                   	leave
+  802cd3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cd4:	49 89 c0             	mov    %rax,%r8
+  802cd7:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802cdc:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802ce3:	00 00 00 
+  802ce6:	be 27 00 00 00       	mov    $0x27,%esi
+  802ceb:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802cf2:	00 00 00 
+  802cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfa:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802d01:	00 00 00 
+  802d04:	41 ff d1             	call   *%r9
+
+0000000000802d07 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d07:	55                   	push   %rbp
+  802d08:	48 89 e5             	mov    %rsp,%rbp
+  802d0b:	53                   	push   %rbx
+  802d0c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d10:	89 f8                	mov    %edi,%eax
+  802d12:	49 89 f2             	mov    %rsi,%r10
+  802d15:	48 89 d3             	mov    %rdx,%rbx
+  802d18:	48 89 cf             	mov    %rcx,%rdi
+  802d1b:	44 89 c6             	mov    %r8d,%esi
+  802d1e:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d21:	48 63 f6             	movslq %esi,%rsi
+  802d24:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d27:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d2c:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d2f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d33:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d35:	48 85 c0             	test   %rax,%rax
+  802d38:	7f 06                	jg     802d40 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3e:	c9                   	leave
+  802d3f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d40:	49 89 c0             	mov    %rax,%r8
+  802d43:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802d48:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802d4f:	00 00 00 
+  802d52:	be 27 00 00 00       	mov    $0x27,%esi
+  802d57:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802d5e:	00 00 00 
+  802d61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d66:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802d6d:	00 00 00 
+  802d70:	41 ff d1             	call   *%r9
+
+0000000000802d73 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802d73:	55                   	push   %rbp
+  802d74:	48 89 e5             	mov    %rsp,%rbp
+  802d77:	53                   	push   %rbx
+  802d78:	48 83 ec 08          	sub    $0x8,%rsp
+  802d7c:	48 89 fa             	mov    %rdi,%rdx
+  802d7f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d82:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d8c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d91:	be 00 00 00 00       	mov    $0x0,%esi
+  802d96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d9c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802da4:	48 85 c0             	test   %rax,%rax
+  802da7:	7f 06                	jg     802daf <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802da9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dad:	c9                   	leave
+  802dae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802daf:	49 89 c0             	mov    %rax,%r8
+  802db2:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802db7:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802dbe:	00 00 00 
+  802dc1:	be 27 00 00 00       	mov    $0x27,%esi
+  802dc6:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802dcd:	00 00 00 
+  802dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd5:	49 b9 ad 55 80 00 00 	movabs $0x8055ad,%r9
+  802ddc:	00 00 00 
+  802ddf:	41 ff d1             	call   *%r9
+
+0000000000802de2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802de2:	55                   	push   %rbp
+  802de3:	48 89 e5             	mov    %rsp,%rbp
+  802de6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802de7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dfb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e00:	be 00 00 00 00       	mov    $0x0,%esi
+  802e05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e11:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e17:	c9                   	leave
+  802e18:	c3                   	ret
+
+0000000000802e19 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802e19:	55                   	push   %rbp
+  802e1a:	48 89 e5             	mov    %rsp,%rbp
+  802e1d:	53                   	push   %rbx
+  802e1e:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e21:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e26:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e30:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e35:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e46:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802e48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e4c:	c9                   	leave
+  802e4d:	c3                   	ret
+
+0000000000802e4e <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802e4e:	55                   	push   %rbp
+  802e4f:	48 89 e5             	mov    %rsp,%rbp
+  802e52:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e53:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e58:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e67:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802e71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e7d:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e83:	c9                   	leave
+  802e84:	c3                   	ret
+
+0000000000802e85 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	53                   	push   %rbx
+  802e8a:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802e8e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e93:	cd 30                	int    $0x30
+  802e95:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  802e97:	85 c0                	test   %eax,%eax
+  802e99:	0f 88 85 00 00 00    	js     802f24 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  802e9f:	0f 84 ac 00 00 00    	je     802f51 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  802ea5:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802eab:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802eb2:	00 00 00 
+  802eb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eba:	89 c2                	mov    %eax,%edx
+  802ebc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ec1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec6:	48 b8 94 28 80 00 00 	movabs $0x802894,%rax
+  802ecd:	00 00 00 
+  802ed0:	ff d0                	call   *%rax
+  802ed2:	85 c0                	test   %eax,%eax
+  802ed4:	0f 88 a8 00 00 00    	js     802f82 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  802eda:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ee1:	00 00 00 
+  802ee4:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  802eeb:	89 df                	mov    %ebx,%edi
+  802eed:	48 b8 4a 2a 80 00 00 	movabs $0x802a4a,%rax
+  802ef4:	00 00 00 
+  802ef7:	ff d0                	call   *%rax
+  802ef9:	85 c0                	test   %eax,%eax
+  802efb:	0f 88 ae 00 00 00    	js     802faf <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802f01:	be 02 00 00 00       	mov    $0x2,%esi
+  802f06:	89 df                	mov    %ebx,%edi
+  802f08:	48 b8 6c 29 80 00 00 	movabs $0x80296c,%rax
+  802f0f:	00 00 00 
+  802f12:	ff d0                	call   *%rax
+  802f14:	85 c0                	test   %eax,%eax
+  802f16:	0f 88 c0 00 00 00    	js     802fdc <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  802f1c:	89 d8                	mov    %ebx,%eax
+  802f1e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f22:	c9                   	leave
+  802f23:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  802f24:	89 c1                	mov    %eax,%ecx
+  802f26:	48 ba 55 64 80 00 00 	movabs $0x806455,%rdx
+  802f2d:	00 00 00 
+  802f30:	be 20 00 00 00       	mov    $0x20,%esi
+  802f35:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802f3c:	00 00 00 
+  802f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f44:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  802f4b:	00 00 00 
+  802f4e:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802f51:	48 b8 4f 27 80 00 00 	movabs $0x80274f,%rax
+  802f58:	00 00 00 
+  802f5b:	ff d0                	call   *%rax
+  802f5d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f62:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  802f69:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f70:	00 00 00 
+  802f73:	48 01 d0             	add    %rdx,%rax
+  802f76:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  802f7d:	00 00 00 
+        return 0;
+  802f80:	eb 9a                	jmp    802f1c <fork+0x97>
+        panic("sys_map_region: %i", res);
+  802f82:	89 c1                	mov    %eax,%ecx
+  802f84:	48 ba 70 64 80 00 00 	movabs $0x806470,%rdx
+  802f8b:	00 00 00 
+  802f8e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f93:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802f9a:	00 00 00 
+  802f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa2:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  802fa9:	00 00 00 
+  802fac:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  802faf:	89 c1                	mov    %eax,%ecx
+  802fb1:	48 ba b8 64 80 00 00 	movabs $0x8064b8,%rdx
+  802fb8:	00 00 00 
+  802fbb:	be 32 00 00 00       	mov    $0x32,%esi
+  802fc0:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802fc7:	00 00 00 
+  802fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcf:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  802fd6:	00 00 00 
+  802fd9:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802fdc:	89 c1                	mov    %eax,%ecx
+  802fde:	48 ba 83 64 80 00 00 	movabs $0x806483,%rdx
+  802fe5:	00 00 00 
+  802fe8:	be 37 00 00 00       	mov    $0x37,%esi
+  802fed:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802ff4:	00 00 00 
+  802ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffc:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803003:	00 00 00 
+  803006:	41 ff d0             	call   *%r8
+
+0000000000803009 <sfork>:
+
+envid_t
+sfork() {
+  803009:	55                   	push   %rbp
+  80300a:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80300d:	48 ba 9a 64 80 00 00 	movabs $0x80649a,%rdx
+  803014:	00 00 00 
+  803017:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80301c:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  803023:	00 00 00 
+  803026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302b:	48 b9 ad 55 80 00 00 	movabs $0x8055ad,%rcx
+  803032:	00 00 00 
+  803035:	ff d1                	call   *%rcx
+
+0000000000803037 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  803037:	85 ff                	test   %edi,%edi
+  803039:	78 58                	js     803093 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80303b:	48 85 f6             	test   %rsi,%rsi
+  80303e:	74 12                	je     803052 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  803040:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803047:	00 00 00 
+  80304a:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803050:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  803052:	48 85 c9             	test   %rcx,%rcx
+  803055:	74 12                	je     803069 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  803057:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80305e:	00 00 00 
+  803061:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  803067:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  803069:	48 85 d2             	test   %rdx,%rdx
+  80306c:	74 14                	je     803082 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80306e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803075:	00 00 00 
+  803078:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80307f:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  803082:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803089:	00 00 00 
+  80308c:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  803092:	c3                   	ret
+        if (from_env_store) {
+  803093:	48 85 f6             	test   %rsi,%rsi
+  803096:	74 06                	je     80309e <ipc_result+0x67>
+            *from_env_store = 0;
+  803098:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80309e:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8030a0:	48 85 c9             	test   %rcx,%rcx
+  8030a3:	74 ed                	je     803092 <ipc_result+0x5b>
+            *perm_store = 0;
+  8030a5:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8030ab:	c3                   	ret
+
+00000000008030ac <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8030ac:	55                   	push   %rbp
+  8030ad:	48 89 e5             	mov    %rsp,%rbp
+  8030b0:	41 55                	push   %r13
+  8030b2:	41 54                	push   %r12
+  8030b4:	53                   	push   %rbx
+  8030b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8030b9:	49 89 fc             	mov    %rdi,%r12
+  8030bc:	48 89 f7             	mov    %rsi,%rdi
+  8030bf:	48 89 d3             	mov    %rdx,%rbx
+  8030c2:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8030c5:	48 85 f6             	test   %rsi,%rsi
+  8030c8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8030cf:	00 00 00 
+  8030d2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8030d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8030db:	48 85 d2             	test   %rdx,%rdx
+  8030de:	74 03                	je     8030e3 <ipc_recv+0x37>
+  8030e0:	48 8b 32             	mov    (%rdx),%rsi
+  8030e3:	48 b8 73 2d 80 00 00 	movabs $0x802d73,%rax
+  8030ea:	00 00 00 
+  8030ed:	ff d0                	call   *%rax
+  8030ef:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8030f1:	4c 89 e9             	mov    %r13,%rcx
+  8030f4:	48 89 da             	mov    %rbx,%rdx
+  8030f7:	4c 89 e6             	mov    %r12,%rsi
+  8030fa:	48 b8 37 30 80 00 00 	movabs $0x803037,%rax
+  803101:	00 00 00 
+  803104:	ff d0                	call   *%rax
+}
+  803106:	48 83 c4 08          	add    $0x8,%rsp
+  80310a:	5b                   	pop    %rbx
+  80310b:	41 5c                	pop    %r12
+  80310d:	41 5d                	pop    %r13
+  80310f:	5d                   	pop    %rbp
+  803110:	c3                   	ret
+
+0000000000803111 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803111:	55                   	push   %rbp
+  803112:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803115:	48 85 d2             	test   %rdx,%rdx
+  803118:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80311f:	00 00 00 
+  803122:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  803126:	89 f6                	mov    %esi,%esi
+  803128:	48 b8 ff 2b 80 00 00 	movabs $0x802bff,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+    if (res < 0) {
+  803134:	85 c0                	test   %eax,%eax
+  803136:	78 02                	js     80313a <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  803138:	5d                   	pop    %rbp
+  803139:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80313a:	89 c1                	mov    %eax,%ecx
+  80313c:	48 ba d7 64 80 00 00 	movabs $0x8064d7,%rdx
+  803143:	00 00 00 
+  803146:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80314b:	48 bf e4 64 80 00 00 	movabs $0x8064e4,%rdi
+  803152:	00 00 00 
+  803155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315a:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803161:	00 00 00 
+  803164:	41 ff d0             	call   *%r8
+
+0000000000803167 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  803167:	55                   	push   %rbp
+  803168:	48 89 e5             	mov    %rsp,%rbp
+  80316b:	53                   	push   %rbx
+  80316c:	48 83 ec 08          	sub    $0x8,%rsp
+  803170:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803174:	48 85 d2             	test   %rdx,%rdx
+  803177:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80317e:	00 00 00 
+  803181:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803185:	4d 85 c9             	test   %r9,%r9
+  803188:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80318c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803191:	48 85 db             	test   %rbx,%rbx
+  803194:	74 03                	je     803199 <ipc_call+0x32>
+  803196:	48 8b 03             	mov    (%rbx),%rax
+  803199:	89 f6                	mov    %esi,%esi
+  80319b:	48 83 ec 08          	sub    $0x8,%rsp
+  80319f:	50                   	push   %rax
+  8031a0:	48 b8 31 2c 80 00 00 	movabs $0x802c31,%rax
+  8031a7:	00 00 00 
+  8031aa:	ff d0                	call   *%rax
+  8031ac:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8031ae:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8031b2:	48 89 da             	mov    %rbx,%rdx
+  8031b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ba:	48 b8 37 30 80 00 00 	movabs $0x803037,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+}
+  8031c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031ca:	c9                   	leave
+  8031cb:	c3                   	ret
+
+00000000008031cc <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8031cc:	55                   	push   %rbp
+  8031cd:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8031d0:	89 f6                	mov    %esi,%esi
+  8031d2:	48 b8 9d 2c 80 00 00 	movabs $0x802c9d,%rax
+  8031d9:	00 00 00 
+  8031dc:	ff d0                	call   *%rax
+  8031de:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8031e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ef:	48 b8 37 30 80 00 00 	movabs $0x803037,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+}
+  8031fb:	5d                   	pop    %rbp
+  8031fc:	c3                   	ret
+
+00000000008031fd <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8031fd:	55                   	push   %rbp
+  8031fe:	48 89 e5             	mov    %rsp,%rbp
+  803201:	41 54                	push   %r12
+  803203:	53                   	push   %rbx
+  803204:	4c 89 cb             	mov    %r9,%rbx
+  803207:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80320b:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80320f:	48 85 d2             	test   %rdx,%rdx
+  803212:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803219:	00 00 00 
+  80321c:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803220:	4d 85 c9             	test   %r9,%r9
+  803223:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  803227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322c:	4d 85 e4             	test   %r12,%r12
+  80322f:	74 04                	je     803235 <ipc_reply_wait+0x38>
+  803231:	49 8b 04 24          	mov    (%r12),%rax
+  803235:	89 f6                	mov    %esi,%esi
+  803237:	48 83 ec 08          	sub    $0x8,%rsp
+  80323b:	50                   	push   %rax
+  80323c:	48 b8 07 2d 80 00 00 	movabs $0x802d07,%rax
+  803243:	00 00 00 
+  803246:	ff d0                	call   *%rax
+  803248:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80324a:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80324e:	4c 89 e2             	mov    %r12,%rdx
+  803251:	48 89 de             	mov    %rbx,%rsi
+  803254:	48 b8 37 30 80 00 00 	movabs $0x803037,%rax
+  80325b:	00 00 00 
+  80325e:	ff d0                	call   *%rax
+}
+  803260:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803264:	5b                   	pop    %rbx
+  803265:	41 5c                	pop    %r12
+  803267:	5d                   	pop    %rbp
+  803268:	c3                   	ret
+
+0000000000803269 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803269:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80326e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803275:	00 00 00 
+  803278:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80327f:	48 01 ca             	add    %rcx,%rdx
+  803282:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  803288:	39 fa                	cmp    %edi,%edx
+  80328a:	74 12                	je     80329e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80328c:	48 83 c0 01          	add    $0x1,%rax
+  803290:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803296:	75 e0                	jne    803278 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803298:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80329d:	c3                   	ret
+            return envs[i].env_id;
+  80329e:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8032a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8032ac:	00 00 00 
+  8032af:	48 01 d0             	add    %rdx,%rax
+  8032b2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8032b8:	c3                   	ret
+
+00000000008032b9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8032b9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8032c0:	ff ff ff 
+  8032c3:	48 01 f8             	add    %rdi,%rax
+  8032c6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8032ca:	c3                   	ret
+
+00000000008032cb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8032cb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8032d2:	ff ff ff 
+  8032d5:	48 01 f8             	add    %rdi,%rax
+  8032d8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8032dc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8032e2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8032e6:	c3                   	ret
+
+00000000008032e7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8032e7:	55                   	push   %rbp
+  8032e8:	48 89 e5             	mov    %rsp,%rbp
+  8032eb:	41 57                	push   %r15
+  8032ed:	41 56                	push   %r14
+  8032ef:	41 55                	push   %r13
+  8032f1:	41 54                	push   %r12
+  8032f3:	53                   	push   %rbx
+  8032f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8032f8:	49 89 ff             	mov    %rdi,%r15
+  8032fb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803300:	49 bd e7 47 80 00 00 	movabs $0x8047e7,%r13
+  803307:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80330a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803310:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803313:	48 89 df             	mov    %rbx,%rdi
+  803316:	41 ff d5             	call   *%r13
+  803319:	83 e0 04             	and    $0x4,%eax
+  80331c:	74 17                	je     803335 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80331e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803325:	4c 39 f3             	cmp    %r14,%rbx
+  803328:	75 e6                	jne    803310 <fd_alloc+0x29>
+  80332a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803330:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803335:	4d 89 27             	mov    %r12,(%r15)
+}
+  803338:	48 83 c4 08          	add    $0x8,%rsp
+  80333c:	5b                   	pop    %rbx
+  80333d:	41 5c                	pop    %r12
+  80333f:	41 5d                	pop    %r13
+  803341:	41 5e                	pop    %r14
+  803343:	41 5f                	pop    %r15
+  803345:	5d                   	pop    %rbp
+  803346:	c3                   	ret
+
+0000000000803347 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803347:	83 ff 1f             	cmp    $0x1f,%edi
+  80334a:	77 39                	ja     803385 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80334c:	55                   	push   %rbp
+  80334d:	48 89 e5             	mov    %rsp,%rbp
+  803350:	41 54                	push   %r12
+  803352:	53                   	push   %rbx
+  803353:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803356:	48 63 df             	movslq %edi,%rbx
+  803359:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803360:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803364:	48 89 df             	mov    %rbx,%rdi
+  803367:	48 b8 e7 47 80 00 00 	movabs $0x8047e7,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+  803373:	a8 04                	test   $0x4,%al
+  803375:	74 14                	je     80338b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803377:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80337b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803380:	5b                   	pop    %rbx
+  803381:	41 5c                	pop    %r12
+  803383:	5d                   	pop    %rbp
+  803384:	c3                   	ret
+        return -E_INVAL;
+  803385:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80338a:	c3                   	ret
+        return -E_INVAL;
+  80338b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803390:	eb ee                	jmp    803380 <fd_lookup+0x39>
+
+0000000000803392 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803392:	55                   	push   %rbp
+  803393:	48 89 e5             	mov    %rsp,%rbp
+  803396:	41 54                	push   %r12
+  803398:	53                   	push   %rbx
+  803399:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80339c:	48 b8 80 65 80 00 00 	movabs $0x806580,%rax
+  8033a3:	00 00 00 
+  8033a6:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8033ad:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8033b0:	39 3b                	cmp    %edi,(%rbx)
+  8033b2:	74 47                	je     8033fb <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8033b4:	48 83 c0 08          	add    $0x8,%rax
+  8033b8:	48 8b 18             	mov    (%rax),%rbx
+  8033bb:	48 85 db             	test   %rbx,%rbx
+  8033be:	75 f0                	jne    8033b0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8033c0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033c7:	00 00 00 
+  8033ca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8033d0:	89 fa                	mov    %edi,%edx
+  8033d2:	48 bf f0 64 80 00 00 	movabs $0x8064f0,%rdi
+  8033d9:	00 00 00 
+  8033dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e1:	48 b9 8b 17 80 00 00 	movabs $0x80178b,%rcx
+  8033e8:	00 00 00 
+  8033eb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8033ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8033f2:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8033f6:	5b                   	pop    %rbx
+  8033f7:	41 5c                	pop    %r12
+  8033f9:	5d                   	pop    %rbp
+  8033fa:	c3                   	ret
+            return 0;
+  8033fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803400:	eb f0                	jmp    8033f2 <dev_lookup+0x60>
+
+0000000000803402 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803402:	55                   	push   %rbp
+  803403:	48 89 e5             	mov    %rsp,%rbp
+  803406:	41 55                	push   %r13
+  803408:	41 54                	push   %r12
+  80340a:	53                   	push   %rbx
+  80340b:	48 83 ec 18          	sub    $0x18,%rsp
+  80340f:	48 89 fb             	mov    %rdi,%rbx
+  803412:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803415:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80341c:	ff ff ff 
+  80341f:	48 01 df             	add    %rbx,%rdi
+  803422:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803426:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80342a:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+  803436:	41 89 c5             	mov    %eax,%r13d
+  803439:	85 c0                	test   %eax,%eax
+  80343b:	78 06                	js     803443 <fd_close+0x41>
+  80343d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803441:	74 1a                	je     80345d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803443:	45 84 e4             	test   %r12b,%r12b
+  803446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80344f:	44 89 e8             	mov    %r13d,%eax
+  803452:	48 83 c4 18          	add    $0x18,%rsp
+  803456:	5b                   	pop    %rbx
+  803457:	41 5c                	pop    %r12
+  803459:	41 5d                	pop    %r13
+  80345b:	5d                   	pop    %rbp
+  80345c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80345d:	8b 3b                	mov    (%rbx),%edi
+  80345f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803463:	48 b8 92 33 80 00 00 	movabs $0x803392,%rax
+  80346a:	00 00 00 
+  80346d:	ff d0                	call   *%rax
+  80346f:	41 89 c5             	mov    %eax,%r13d
+  803472:	85 c0                	test   %eax,%eax
+  803474:	78 1b                	js     803491 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803476:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80347a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80347e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803484:	48 85 c0             	test   %rax,%rax
+  803487:	74 08                	je     803491 <fd_close+0x8f>
+  803489:	48 89 df             	mov    %rbx,%rdi
+  80348c:	ff d0                	call   *%rax
+  80348e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803491:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803496:	48 89 de             	mov    %rbx,%rsi
+  803499:	bf 00 00 00 00       	mov    $0x0,%edi
+  80349e:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+    return res;
+  8034aa:	eb a3                	jmp    80344f <fd_close+0x4d>
+
+00000000008034ac <close>:
+
+int
+close(int fdnum) {
+  8034ac:	55                   	push   %rbp
+  8034ad:	48 89 e5             	mov    %rsp,%rbp
+  8034b0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034b4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034b8:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  8034bf:	00 00 00 
+  8034c2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034c4:	85 c0                	test   %eax,%eax
+  8034c6:	78 15                	js     8034dd <close+0x31>
+
+    return fd_close(fd, 1);
+  8034c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8034cd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034d1:	48 b8 02 34 80 00 00 	movabs $0x803402,%rax
+  8034d8:	00 00 00 
+  8034db:	ff d0                	call   *%rax
+}
+  8034dd:	c9                   	leave
+  8034de:	c3                   	ret
+
+00000000008034df <close_all>:
+
+void
+close_all(void) {
+  8034df:	55                   	push   %rbp
+  8034e0:	48 89 e5             	mov    %rsp,%rbp
+  8034e3:	41 54                	push   %r12
+  8034e5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8034e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034eb:	49 bc ac 34 80 00 00 	movabs $0x8034ac,%r12
+  8034f2:	00 00 00 
+  8034f5:	89 df                	mov    %ebx,%edi
+  8034f7:	41 ff d4             	call   *%r12
+  8034fa:	83 c3 01             	add    $0x1,%ebx
+  8034fd:	83 fb 20             	cmp    $0x20,%ebx
+  803500:	75 f3                	jne    8034f5 <close_all+0x16>
+}
+  803502:	5b                   	pop    %rbx
+  803503:	41 5c                	pop    %r12
+  803505:	5d                   	pop    %rbp
+  803506:	c3                   	ret
+
+0000000000803507 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803507:	55                   	push   %rbp
+  803508:	48 89 e5             	mov    %rsp,%rbp
+  80350b:	41 57                	push   %r15
+  80350d:	41 56                	push   %r14
+  80350f:	41 55                	push   %r13
+  803511:	41 54                	push   %r12
+  803513:	53                   	push   %rbx
+  803514:	48 83 ec 18          	sub    $0x18,%rsp
+  803518:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80351b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80351f:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803526:	00 00 00 
+  803529:	ff d0                	call   *%rax
+  80352b:	89 c3                	mov    %eax,%ebx
+  80352d:	85 c0                	test   %eax,%eax
+  80352f:	0f 88 b8 00 00 00    	js     8035ed <dup+0xe6>
+    close(newfdnum);
+  803535:	44 89 e7             	mov    %r12d,%edi
+  803538:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803544:	4d 63 ec             	movslq %r12d,%r13
+  803547:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80354e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803552:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803556:	4c 89 ff             	mov    %r15,%rdi
+  803559:	49 be cb 32 80 00 00 	movabs $0x8032cb,%r14
+  803560:	00 00 00 
+  803563:	41 ff d6             	call   *%r14
+  803566:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803569:	4c 89 ef             	mov    %r13,%rdi
+  80356c:	41 ff d6             	call   *%r14
+  80356f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803572:	48 89 df             	mov    %rbx,%rdi
+  803575:	48 b8 e7 47 80 00 00 	movabs $0x8047e7,%rax
+  80357c:	00 00 00 
+  80357f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803581:	a8 04                	test   $0x4,%al
+  803583:	74 2b                	je     8035b0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803585:	41 89 c1             	mov    %eax,%r9d
+  803588:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80358e:	4c 89 f1             	mov    %r14,%rcx
+  803591:	ba 00 00 00 00       	mov    $0x0,%edx
+  803596:	48 89 de             	mov    %rbx,%rsi
+  803599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80359e:	48 b8 94 28 80 00 00 	movabs $0x802894,%rax
+  8035a5:	00 00 00 
+  8035a8:	ff d0                	call   *%rax
+  8035aa:	89 c3                	mov    %eax,%ebx
+  8035ac:	85 c0                	test   %eax,%eax
+  8035ae:	78 4e                	js     8035fe <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8035b0:	4c 89 ff             	mov    %r15,%rdi
+  8035b3:	48 b8 e7 47 80 00 00 	movabs $0x8047e7,%rax
+  8035ba:	00 00 00 
+  8035bd:	ff d0                	call   *%rax
+  8035bf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8035c2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035c8:	4c 89 e9             	mov    %r13,%rcx
+  8035cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d0:	4c 89 fe             	mov    %r15,%rsi
+  8035d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d8:	48 b8 94 28 80 00 00 	movabs $0x802894,%rax
+  8035df:	00 00 00 
+  8035e2:	ff d0                	call   *%rax
+  8035e4:	89 c3                	mov    %eax,%ebx
+  8035e6:	85 c0                	test   %eax,%eax
+  8035e8:	78 14                	js     8035fe <dup+0xf7>
+
+    return newfdnum;
+  8035ea:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8035ed:	89 d8                	mov    %ebx,%eax
+  8035ef:	48 83 c4 18          	add    $0x18,%rsp
+  8035f3:	5b                   	pop    %rbx
+  8035f4:	41 5c                	pop    %r12
+  8035f6:	41 5d                	pop    %r13
+  8035f8:	41 5e                	pop    %r14
+  8035fa:	41 5f                	pop    %r15
+  8035fc:	5d                   	pop    %rbp
+  8035fd:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8035fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803603:	4c 89 ee             	mov    %r13,%rsi
+  803606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80360b:	49 bc ff 28 80 00 00 	movabs $0x8028ff,%r12
+  803612:	00 00 00 
+  803615:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803618:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80361d:	4c 89 f6             	mov    %r14,%rsi
+  803620:	bf 00 00 00 00       	mov    $0x0,%edi
+  803625:	41 ff d4             	call   *%r12
+    return res;
+  803628:	eb c3                	jmp    8035ed <dup+0xe6>
+
+000000000080362a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80362a:	55                   	push   %rbp
+  80362b:	48 89 e5             	mov    %rsp,%rbp
+  80362e:	41 56                	push   %r14
+  803630:	41 55                	push   %r13
+  803632:	41 54                	push   %r12
+  803634:	53                   	push   %rbx
+  803635:	48 83 ec 10          	sub    $0x10,%rsp
+  803639:	89 fb                	mov    %edi,%ebx
+  80363b:	49 89 f4             	mov    %rsi,%r12
+  80363e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803641:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803645:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  80364c:	00 00 00 
+  80364f:	ff d0                	call   *%rax
+  803651:	85 c0                	test   %eax,%eax
+  803653:	78 4c                	js     8036a1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803655:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803659:	41 8b 3e             	mov    (%r14),%edi
+  80365c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803660:	48 b8 92 33 80 00 00 	movabs $0x803392,%rax
+  803667:	00 00 00 
+  80366a:	ff d0                	call   *%rax
+  80366c:	85 c0                	test   %eax,%eax
+  80366e:	78 35                	js     8036a5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803670:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803674:	83 e0 03             	and    $0x3,%eax
+  803677:	83 f8 01             	cmp    $0x1,%eax
+  80367a:	74 2d                	je     8036a9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80367c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803680:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803684:	48 85 c0             	test   %rax,%rax
+  803687:	74 56                	je     8036df <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803689:	4c 89 ea             	mov    %r13,%rdx
+  80368c:	4c 89 e6             	mov    %r12,%rsi
+  80368f:	4c 89 f7             	mov    %r14,%rdi
+  803692:	ff d0                	call   *%rax
+}
+  803694:	48 83 c4 10          	add    $0x10,%rsp
+  803698:	5b                   	pop    %rbx
+  803699:	41 5c                	pop    %r12
+  80369b:	41 5d                	pop    %r13
+  80369d:	41 5e                	pop    %r14
+  80369f:	5d                   	pop    %rbp
+  8036a0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036a1:	48 98                	cltq
+  8036a3:	eb ef                	jmp    803694 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036a5:	48 98                	cltq
+  8036a7:	eb eb                	jmp    803694 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8036a9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8036b0:	00 00 00 
+  8036b3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8036b9:	89 da                	mov    %ebx,%edx
+  8036bb:	48 bf 31 65 80 00 00 	movabs $0x806531,%rdi
+  8036c2:	00 00 00 
+  8036c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ca:	48 b9 8b 17 80 00 00 	movabs $0x80178b,%rcx
+  8036d1:	00 00 00 
+  8036d4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8036d6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036dd:	eb b5                	jmp    803694 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036df:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8036e6:	eb ac                	jmp    803694 <read+0x6a>
+
+00000000008036e8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8036e8:	55                   	push   %rbp
+  8036e9:	48 89 e5             	mov    %rsp,%rbp
+  8036ec:	41 57                	push   %r15
+  8036ee:	41 56                	push   %r14
+  8036f0:	41 55                	push   %r13
+  8036f2:	41 54                	push   %r12
+  8036f4:	53                   	push   %rbx
+  8036f5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8036f9:	48 85 d2             	test   %rdx,%rdx
+  8036fc:	74 54                	je     803752 <readn+0x6a>
+  8036fe:	41 89 fd             	mov    %edi,%r13d
+  803701:	49 89 f6             	mov    %rsi,%r14
+  803704:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803707:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80370c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803711:	49 bf 2a 36 80 00 00 	movabs $0x80362a,%r15
+  803718:	00 00 00 
+  80371b:	4c 89 e2             	mov    %r12,%rdx
+  80371e:	48 29 f2             	sub    %rsi,%rdx
+  803721:	4c 01 f6             	add    %r14,%rsi
+  803724:	44 89 ef             	mov    %r13d,%edi
+  803727:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80372a:	85 c0                	test   %eax,%eax
+  80372c:	78 20                	js     80374e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80372e:	01 c3                	add    %eax,%ebx
+  803730:	85 c0                	test   %eax,%eax
+  803732:	74 08                	je     80373c <readn+0x54>
+  803734:	48 63 f3             	movslq %ebx,%rsi
+  803737:	4c 39 e6             	cmp    %r12,%rsi
+  80373a:	72 df                	jb     80371b <readn+0x33>
+    }
+    return res;
+  80373c:	48 63 c3             	movslq %ebx,%rax
+}
+  80373f:	48 83 c4 08          	add    $0x8,%rsp
+  803743:	5b                   	pop    %rbx
+  803744:	41 5c                	pop    %r12
+  803746:	41 5d                	pop    %r13
+  803748:	41 5e                	pop    %r14
+  80374a:	41 5f                	pop    %r15
+  80374c:	5d                   	pop    %rbp
+  80374d:	c3                   	ret
+        if (inc < 0) return inc;
+  80374e:	48 98                	cltq
+  803750:	eb ed                	jmp    80373f <readn+0x57>
+    int inc = 1, res = 0;
+  803752:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803757:	eb e3                	jmp    80373c <readn+0x54>
+
+0000000000803759 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803759:	55                   	push   %rbp
+  80375a:	48 89 e5             	mov    %rsp,%rbp
+  80375d:	41 56                	push   %r14
+  80375f:	41 55                	push   %r13
+  803761:	41 54                	push   %r12
+  803763:	53                   	push   %rbx
+  803764:	48 83 ec 10          	sub    $0x10,%rsp
+  803768:	89 fb                	mov    %edi,%ebx
+  80376a:	49 89 f4             	mov    %rsi,%r12
+  80376d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803770:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803774:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  80377b:	00 00 00 
+  80377e:	ff d0                	call   *%rax
+  803780:	85 c0                	test   %eax,%eax
+  803782:	78 47                	js     8037cb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803784:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803788:	41 8b 3e             	mov    (%r14),%edi
+  80378b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80378f:	48 b8 92 33 80 00 00 	movabs $0x803392,%rax
+  803796:	00 00 00 
+  803799:	ff d0                	call   *%rax
+  80379b:	85 c0                	test   %eax,%eax
+  80379d:	78 30                	js     8037cf <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80379f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8037a4:	74 2d                	je     8037d3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8037a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037aa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8037ae:	48 85 c0             	test   %rax,%rax
+  8037b1:	74 56                	je     803809 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8037b3:	4c 89 ea             	mov    %r13,%rdx
+  8037b6:	4c 89 e6             	mov    %r12,%rsi
+  8037b9:	4c 89 f7             	mov    %r14,%rdi
+  8037bc:	ff d0                	call   *%rax
+}
+  8037be:	48 83 c4 10          	add    $0x10,%rsp
+  8037c2:	5b                   	pop    %rbx
+  8037c3:	41 5c                	pop    %r12
+  8037c5:	41 5d                	pop    %r13
+  8037c7:	41 5e                	pop    %r14
+  8037c9:	5d                   	pop    %rbp
+  8037ca:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037cb:	48 98                	cltq
+  8037cd:	eb ef                	jmp    8037be <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037cf:	48 98                	cltq
+  8037d1:	eb eb                	jmp    8037be <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037d3:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8037da:	00 00 00 
+  8037dd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8037e3:	89 da                	mov    %ebx,%edx
+  8037e5:	48 bf 4d 65 80 00 00 	movabs $0x80654d,%rdi
+  8037ec:	00 00 00 
+  8037ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f4:	48 b9 8b 17 80 00 00 	movabs $0x80178b,%rcx
+  8037fb:	00 00 00 
+  8037fe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803800:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803807:	eb b5                	jmp    8037be <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803809:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803810:	eb ac                	jmp    8037be <write+0x65>
+
+0000000000803812 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803812:	55                   	push   %rbp
+  803813:	48 89 e5             	mov    %rsp,%rbp
+  803816:	53                   	push   %rbx
+  803817:	48 83 ec 18          	sub    $0x18,%rsp
+  80381b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80381d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803821:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803828:	00 00 00 
+  80382b:	ff d0                	call   *%rax
+  80382d:	85 c0                	test   %eax,%eax
+  80382f:	78 0c                	js     80383d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803831:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803835:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803838:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80383d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803841:	c9                   	leave
+  803842:	c3                   	ret
+
+0000000000803843 <tell>:
+
+int tell(int fdnum) {
+  803843:	55                   	push   %rbp
+  803844:	48 89 e5             	mov    %rsp,%rbp
+  803847:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80384b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80384f:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803856:	00 00 00 
+  803859:	ff d0                	call   *%rax
+  80385b:	85 c0                	test   %eax,%eax
+  80385d:	78 07                	js     803866 <tell+0x23>
+
+    return fd->fd_offset;
+  80385f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803863:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803866:	c9                   	leave
+  803867:	c3                   	ret
+
+0000000000803868 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803868:	55                   	push   %rbp
+  803869:	48 89 e5             	mov    %rsp,%rbp
+  80386c:	41 55                	push   %r13
+  80386e:	41 54                	push   %r12
+  803870:	53                   	push   %rbx
+  803871:	48 83 ec 18          	sub    $0x18,%rsp
+  803875:	89 fb                	mov    %edi,%ebx
+  803877:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80387a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80387e:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803885:	00 00 00 
+  803888:	ff d0                	call   *%rax
+  80388a:	85 c0                	test   %eax,%eax
+  80388c:	78 38                	js     8038c6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80388e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803892:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803896:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80389a:	48 b8 92 33 80 00 00 	movabs $0x803392,%rax
+  8038a1:	00 00 00 
+  8038a4:	ff d0                	call   *%rax
+  8038a6:	85 c0                	test   %eax,%eax
+  8038a8:	78 1c                	js     8038c6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038aa:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8038af:	74 20                	je     8038d1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8038b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038b5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8038b9:	48 85 c0             	test   %rax,%rax
+  8038bc:	74 47                	je     803905 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8038be:	44 89 e6             	mov    %r12d,%esi
+  8038c1:	4c 89 ef             	mov    %r13,%rdi
+  8038c4:	ff d0                	call   *%rax
+}
+  8038c6:	48 83 c4 18          	add    $0x18,%rsp
+  8038ca:	5b                   	pop    %rbx
+  8038cb:	41 5c                	pop    %r12
+  8038cd:	41 5d                	pop    %r13
+  8038cf:	5d                   	pop    %rbp
+  8038d0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8038d1:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8038d8:	00 00 00 
+  8038db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8038e1:	89 da                	mov    %ebx,%edx
+  8038e3:	48 bf 10 65 80 00 00 	movabs $0x806510,%rdi
+  8038ea:	00 00 00 
+  8038ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f2:	48 b9 8b 17 80 00 00 	movabs $0x80178b,%rcx
+  8038f9:	00 00 00 
+  8038fc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8038fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803903:	eb c1                	jmp    8038c6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803905:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80390a:	eb ba                	jmp    8038c6 <ftruncate+0x5e>
+
+000000000080390c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80390c:	55                   	push   %rbp
+  80390d:	48 89 e5             	mov    %rsp,%rbp
+  803910:	41 54                	push   %r12
+  803912:	53                   	push   %rbx
+  803913:	48 83 ec 10          	sub    $0x10,%rsp
+  803917:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80391a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80391e:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803925:	00 00 00 
+  803928:	ff d0                	call   *%rax
+  80392a:	85 c0                	test   %eax,%eax
+  80392c:	78 63                	js     803991 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80392e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803932:	41 8b 3c 24          	mov    (%r12),%edi
+  803936:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80393a:	48 b8 92 33 80 00 00 	movabs $0x803392,%rax
+  803941:	00 00 00 
+  803944:	ff d0                	call   *%rax
+  803946:	85 c0                	test   %eax,%eax
+  803948:	78 47                	js     803991 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80394a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80394e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803953:	74 45                	je     80399a <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803955:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803958:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80395f:	00 00 00 
+    stat->st_isdir = 0;
+  803962:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803969:	00 00 00 
+    stat->st_ino = 0;
+  80396c:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803973:	00 00 00 00 
+    stat->st_version = 0;
+  803977:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80397e:	00 00 00 
+    stat->st_dev = dev;
+  803981:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803988:	48 89 de             	mov    %rbx,%rsi
+  80398b:	4c 89 e7             	mov    %r12,%rdi
+  80398e:	ff 50 28             	call   *0x28(%rax)
+}
+  803991:	48 83 c4 10          	add    $0x10,%rsp
+  803995:	5b                   	pop    %rbx
+  803996:	41 5c                	pop    %r12
+  803998:	5d                   	pop    %rbp
+  803999:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80399a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80399f:	eb f0                	jmp    803991 <fstat+0x85>
+
+00000000008039a1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8039a1:	55                   	push   %rbp
+  8039a2:	48 89 e5             	mov    %rsp,%rbp
+  8039a5:	41 54                	push   %r12
+  8039a7:	53                   	push   %rbx
+  8039a8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8039ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8039b0:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8039b7:	00 00 00 
+  8039ba:	ff d0                	call   *%rax
+  8039bc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8039be:	85 c0                	test   %eax,%eax
+  8039c0:	78 25                	js     8039e7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8039c2:	4c 89 e6             	mov    %r12,%rsi
+  8039c5:	89 c7                	mov    %eax,%edi
+  8039c7:	48 b8 0c 39 80 00 00 	movabs $0x80390c,%rax
+  8039ce:	00 00 00 
+  8039d1:	ff d0                	call   *%rax
+  8039d3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8039d6:	89 df                	mov    %ebx,%edi
+  8039d8:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  8039df:	00 00 00 
+  8039e2:	ff d0                	call   *%rax
+
+    return res;
+  8039e4:	44 89 e3             	mov    %r12d,%ebx
+}
+  8039e7:	89 d8                	mov    %ebx,%eax
+  8039e9:	5b                   	pop    %rbx
+  8039ea:	41 5c                	pop    %r12
+  8039ec:	5d                   	pop    %rbp
+  8039ed:	c3                   	ret
+
+00000000008039ee <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039ee:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8039f5:	00 00 00 
+  8039f8:	83 38 00             	cmpl   $0x0,(%rax)
+  8039fb:	74 0a                	je     803a07 <fsipc_env+0x19>
+    return fsenv;
+}
+  8039fd:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a04:	00 00 
+  803a06:	c3                   	ret
+fsipc_env(void) {
+  803a07:	55                   	push   %rbp
+  803a08:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a0b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a10:	48 b8 69 32 80 00 00 	movabs $0x803269,%rax
+  803a17:	00 00 00 
+  803a1a:	ff d0                	call   *%rax
+  803a1c:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803a23:	00 00 
+}
+  803a25:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a2c:	00 00 
+  803a2e:	5d                   	pop    %rbp
+  803a2f:	c3                   	ret
+
+0000000000803a30 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803a30:	55                   	push   %rbp
+  803a31:	48 89 e5             	mov    %rsp,%rbp
+  803a34:	53                   	push   %rbx
+  803a35:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803a39:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a40:	00 
+  803a41:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803a48:	00 
+  803a49:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803a50:	00 
+  803a51:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803a58:	00 
+  803a59:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803a60:	00 
+
+    assert(size <= sizeof(words));
+  803a61:	48 83 fa 28          	cmp    $0x28,%rdx
+  803a65:	77 38                	ja     803a9f <fsipc_short+0x6f>
+  803a67:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803a69:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803a6d:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  803a74:	00 00 00 
+  803a77:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803a79:	48 b8 ee 39 80 00 00 	movabs $0x8039ee,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+  803a85:	89 c7                	mov    %eax,%edi
+  803a87:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803a8b:	89 de                	mov    %ebx,%esi
+  803a8d:	48 b8 cc 31 80 00 00 	movabs $0x8031cc,%rax
+  803a94:	00 00 00 
+  803a97:	ff d0                	call   *%rax
+}
+  803a99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a9d:	c9                   	leave
+  803a9e:	c3                   	ret
+    assert(size <= sizeof(words));
+  803a9f:	48 b9 a0 65 80 00 00 	movabs $0x8065a0,%rcx
+  803aa6:	00 00 00 
+  803aa9:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803ab0:	00 00 00 
+  803ab3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803ab8:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803abf:	00 00 00 
+  803ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac7:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803ace:	00 00 00 
+  803ad1:	41 ff d0             	call   *%r8
+
+0000000000803ad4 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803ad4:	55                   	push   %rbp
+  803ad5:	48 89 e5             	mov    %rsp,%rbp
+  803ad8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803adc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803adf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803ae2:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803ae5:	ba 08 00 00 00       	mov    $0x8,%edx
+  803aea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803aee:	bf 02 00 00 00       	mov    $0x2,%edi
+  803af3:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  803afa:	00 00 00 
+  803afd:	ff d0                	call   *%rax
+}
+  803aff:	c9                   	leave
+  803b00:	c3                   	ret
+
+0000000000803b01 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803b01:	55                   	push   %rbp
+  803b02:	48 89 e5             	mov    %rsp,%rbp
+  803b05:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803b09:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b0c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803b0f:	ba 04 00 00 00       	mov    $0x4,%edx
+  803b14:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803b18:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b1d:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  803b24:	00 00 00 
+  803b27:	ff d0                	call   *%rax
+}
+  803b29:	c9                   	leave
+  803b2a:	c3                   	ret
+
+0000000000803b2b <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803b2b:	55                   	push   %rbp
+  803b2c:	48 89 e5             	mov    %rsp,%rbp
+  803b2f:	41 54                	push   %r12
+  803b31:	53                   	push   %rbx
+  803b32:	48 83 ec 10          	sub    $0x10,%rsp
+  803b36:	89 fb                	mov    %edi,%ebx
+  803b38:	49 89 f4             	mov    %rsi,%r12
+  803b3b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b3f:	48 b8 ee 39 80 00 00 	movabs $0x8039ee,%rax
+  803b46:	00 00 00 
+  803b49:	ff d0                	call   *%rax
+  803b4b:	89 c7                	mov    %eax,%edi
+  803b4d:	6a 00                	push   $0x0
+  803b4f:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803b53:	50                   	push   %rax
+  803b54:	4d 89 e1             	mov    %r12,%r9
+  803b57:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803b5d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b62:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803b69:	00 00 00 
+  803b6c:	89 de                	mov    %ebx,%esi
+  803b6e:	48 b8 67 31 80 00 00 	movabs $0x803167,%rax
+  803b75:	00 00 00 
+  803b78:	ff d0                	call   *%rax
+}
+  803b7a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803b7e:	5b                   	pop    %rbx
+  803b7f:	41 5c                	pop    %r12
+  803b81:	5d                   	pop    %rbp
+  803b82:	c3                   	ret
+
+0000000000803b83 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803b83:	55                   	push   %rbp
+  803b84:	48 89 e5             	mov    %rsp,%rbp
+  803b87:	41 54                	push   %r12
+  803b89:	53                   	push   %rbx
+  803b8a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b8d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b90:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803b97:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b9e:	be 00 00 00 00       	mov    $0x0,%esi
+  803ba3:	bf 05 00 00 00       	mov    $0x5,%edi
+  803ba8:	48 b8 2b 3b 80 00 00 	movabs $0x803b2b,%rax
+  803baf:	00 00 00 
+  803bb2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bb4:	85 c0                	test   %eax,%eax
+  803bb6:	78 5a                	js     803c12 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803bb8:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803bbf:	00 00 00 
+  803bc2:	4c 89 e6             	mov    %r12,%rsi
+  803bc5:	48 89 df             	mov    %rbx,%rdi
+  803bc8:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  803bcf:	00 00 00 
+  803bd2:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803bd4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803bdb:	00 
+  803bdc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803be2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803be9:	00 
+  803bea:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803bf0:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803bf7:	00 
+  803bf8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803bff:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803c06:	00 
+  803c07:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c12:	5b                   	pop    %rbx
+  803c13:	41 5c                	pop    %r12
+  803c15:	5d                   	pop    %rbp
+  803c16:	c3                   	ret
+
+0000000000803c17 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c17:	55                   	push   %rbp
+  803c18:	48 89 e5             	mov    %rsp,%rbp
+  803c1b:	41 57                	push   %r15
+  803c1d:	41 56                	push   %r14
+  803c1f:	41 55                	push   %r13
+  803c21:	41 54                	push   %r12
+  803c23:	53                   	push   %rbx
+  803c24:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803c28:	48 85 ff             	test   %rdi,%rdi
+  803c2b:	0f 84 a1 00 00 00    	je     803cd2 <devfile_read+0xbb>
+  803c31:	49 89 ff             	mov    %rdi,%r15
+  803c34:	49 89 f5             	mov    %rsi,%r13
+  803c37:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803c3a:	48 85 f6             	test   %rsi,%rsi
+  803c3d:	0f 84 c4 00 00 00    	je     803d07 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803c43:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803c4a:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803c4b:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c52:	00 00 00 
+  803c55:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c59:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803c5c:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c65:	be 00 00 00 00       	mov    $0x0,%esi
+  803c6a:	bf 03 00 00 00       	mov    $0x3,%edi
+  803c6f:	48 b8 2b 3b 80 00 00 	movabs $0x803b2b,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c7b:	85 c0                	test   %eax,%eax
+  803c7d:	0f 88 b9 00 00 00    	js     803d3c <devfile_read+0x125>
+        assert(res <= n);
+  803c83:	48 63 d8             	movslq %eax,%rbx
+  803c86:	49 39 dc             	cmp    %rbx,%r12
+  803c89:	0f 82 b1 00 00 00    	jb     803d40 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803c8f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803c94:	0f 87 db 00 00 00    	ja     803d75 <devfile_read+0x15e>
+        if (!res) {
+  803c9a:	85 c0                	test   %eax,%eax
+  803c9c:	74 21                	je     803cbf <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803c9e:	48 89 da             	mov    %rbx,%rdx
+  803ca1:	4c 89 f6             	mov    %r14,%rsi
+  803ca4:	4c 89 ef             	mov    %r13,%rdi
+  803ca7:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  803cae:	00 00 00 
+  803cb1:	ff d0                	call   *%rax
+        total_read += res;
+  803cb3:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803cb7:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803cba:	49 29 dc             	sub    %rbx,%r12
+  803cbd:	75 96                	jne    803c55 <devfile_read+0x3e>
+    return total_read;
+  803cbf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803cc3:	48 83 c4 18          	add    $0x18,%rsp
+  803cc7:	5b                   	pop    %rbx
+  803cc8:	41 5c                	pop    %r12
+  803cca:	41 5d                	pop    %r13
+  803ccc:	41 5e                	pop    %r14
+  803cce:	41 5f                	pop    %r15
+  803cd0:	5d                   	pop    %rbp
+  803cd1:	c3                   	ret
+    assert(fd);
+  803cd2:	48 b9 d6 65 80 00 00 	movabs $0x8065d6,%rcx
+  803cd9:	00 00 00 
+  803cdc:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803ce3:	00 00 00 
+  803ce6:	be 91 00 00 00       	mov    $0x91,%esi
+  803ceb:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803cf2:	00 00 00 
+  803cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cfa:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803d01:	00 00 00 
+  803d04:	41 ff d0             	call   *%r8
+    assert(buf);
+  803d07:	48 b9 d9 65 80 00 00 	movabs $0x8065d9,%rcx
+  803d0e:	00 00 00 
+  803d11:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803d18:	00 00 00 
+  803d1b:	be 92 00 00 00       	mov    $0x92,%esi
+  803d20:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803d27:	00 00 00 
+  803d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d2f:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803d36:	00 00 00 
+  803d39:	41 ff d0             	call   *%r8
+            return res;
+  803d3c:	48 98                	cltq
+  803d3e:	eb 83                	jmp    803cc3 <devfile_read+0xac>
+        assert(res <= n);
+  803d40:	48 b9 dd 65 80 00 00 	movabs $0x8065dd,%rcx
+  803d47:	00 00 00 
+  803d4a:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803d51:	00 00 00 
+  803d54:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803d59:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803d60:	00 00 00 
+  803d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d68:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803d6f:	00 00 00 
+  803d72:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803d75:	48 b9 e8 65 80 00 00 	movabs $0x8065e8,%rcx
+  803d7c:	00 00 00 
+  803d7f:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803d86:	00 00 00 
+  803d89:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803d8e:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803d95:	00 00 00 
+  803d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9d:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803da4:	00 00 00 
+  803da7:	41 ff d0             	call   *%r8
+
+0000000000803daa <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803daa:	55                   	push   %rbp
+  803dab:	48 89 e5             	mov    %rsp,%rbp
+  803dae:	41 57                	push   %r15
+  803db0:	41 56                	push   %r14
+  803db2:	41 55                	push   %r13
+  803db4:	41 54                	push   %r12
+  803db6:	53                   	push   %rbx
+  803db7:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803dbb:	48 85 ff             	test   %rdi,%rdi
+  803dbe:	0f 84 83 00 00 00    	je     803e47 <devfile_write+0x9d>
+  803dc4:	49 89 ff             	mov    %rdi,%r15
+  803dc7:	49 89 f4             	mov    %rsi,%r12
+  803dca:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803dcd:	48 85 f6             	test   %rsi,%rsi
+  803dd0:	0f 84 a6 00 00 00    	je     803e7c <devfile_write+0xd2>
+    size_t total_written = 0;
+  803dd6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ddc:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803de3:	00 00 00 
+  803de6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803dea:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803ded:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803df1:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803df6:	48 39 d3             	cmp    %rdx,%rbx
+  803df9:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803dfd:	4c 89 e6             	mov    %r12,%rsi
+  803e00:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803e07:	00 00 00 
+  803e0a:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  803e11:	00 00 00 
+  803e14:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e1b:	be 00 00 00 00       	mov    $0x0,%esi
+  803e20:	bf 04 00 00 00       	mov    $0x4,%edi
+  803e25:	48 b8 2b 3b 80 00 00 	movabs $0x803b2b,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e31:	85 c0                	test   %eax,%eax
+  803e33:	78 7c                	js     803eb1 <devfile_write+0x107>
+        total_written += res;
+  803e35:	48 98                	cltq
+  803e37:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803e3a:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e3d:	48 29 c3             	sub    %rax,%rbx
+  803e40:	75 a4                	jne    803de6 <devfile_write+0x3c>
+    return total_written;
+  803e42:	4c 89 e8             	mov    %r13,%rax
+  803e45:	eb 6c                	jmp    803eb3 <devfile_write+0x109>
+    assert(fd);
+  803e47:	48 b9 d6 65 80 00 00 	movabs $0x8065d6,%rcx
+  803e4e:	00 00 00 
+  803e51:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803e58:	00 00 00 
+  803e5b:	be bd 00 00 00       	mov    $0xbd,%esi
+  803e60:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803e67:	00 00 00 
+  803e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6f:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803e76:	00 00 00 
+  803e79:	41 ff d0             	call   *%r8
+    assert(buf);
+  803e7c:	48 b9 d9 65 80 00 00 	movabs $0x8065d9,%rcx
+  803e83:	00 00 00 
+  803e86:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803e8d:	00 00 00 
+  803e90:	be be 00 00 00       	mov    $0xbe,%esi
+  803e95:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803e9c:	00 00 00 
+  803e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea4:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  803eab:	00 00 00 
+  803eae:	41 ff d0             	call   *%r8
+            return res;
+  803eb1:	48 98                	cltq
+}
+  803eb3:	48 83 c4 08          	add    $0x8,%rsp
+  803eb7:	5b                   	pop    %rbx
+  803eb8:	41 5c                	pop    %r12
+  803eba:	41 5d                	pop    %r13
+  803ebc:	41 5e                	pop    %r14
+  803ebe:	41 5f                	pop    %r15
+  803ec0:	5d                   	pop    %rbp
+  803ec1:	c3                   	ret
+
+0000000000803ec2 <open>:
+open(const char *path, int mode) {
+  803ec2:	55                   	push   %rbp
+  803ec3:	48 89 e5             	mov    %rsp,%rbp
+  803ec6:	41 55                	push   %r13
+  803ec8:	41 54                	push   %r12
+  803eca:	53                   	push   %rbx
+  803ecb:	48 83 ec 18          	sub    $0x18,%rsp
+  803ecf:	49 89 fc             	mov    %rdi,%r12
+  803ed2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803ed5:	48 b8 84 20 80 00 00 	movabs $0x802084,%rax
+  803edc:	00 00 00 
+  803edf:	ff d0                	call   *%rax
+  803ee1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803ee7:	0f 87 8f 00 00 00    	ja     803f7c <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803eed:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ef1:	48 b8 e7 32 80 00 00 	movabs $0x8032e7,%rax
+  803ef8:	00 00 00 
+  803efb:	ff d0                	call   *%rax
+  803efd:	89 c3                	mov    %eax,%ebx
+  803eff:	85 c0                	test   %eax,%eax
+  803f01:	78 55                	js     803f58 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f03:	4c 89 e6             	mov    %r12,%rsi
+  803f06:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803f0d:	00 00 00 
+  803f10:	48 89 df             	mov    %rbx,%rdi
+  803f13:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  803f1a:	00 00 00 
+  803f1d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f1f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f26:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f2b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f2f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f34:	48 b8 2b 3b 80 00 00 	movabs $0x803b2b,%rax
+  803f3b:	00 00 00 
+  803f3e:	ff d0                	call   *%rax
+  803f40:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	78 1f                	js     803f65 <open+0xa3>
+    return fd2num(fd);
+  803f46:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f4a:	48 b8 b9 32 80 00 00 	movabs $0x8032b9,%rax
+  803f51:	00 00 00 
+  803f54:	ff d0                	call   *%rax
+  803f56:	89 c3                	mov    %eax,%ebx
+}
+  803f58:	89 d8                	mov    %ebx,%eax
+  803f5a:	48 83 c4 18          	add    $0x18,%rsp
+  803f5e:	5b                   	pop    %rbx
+  803f5f:	41 5c                	pop    %r12
+  803f61:	41 5d                	pop    %r13
+  803f63:	5d                   	pop    %rbp
+  803f64:	c3                   	ret
+        fd_close(fd, 0);
+  803f65:	be 00 00 00 00       	mov    $0x0,%esi
+  803f6a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f6e:	48 b8 02 34 80 00 00 	movabs $0x803402,%rax
+  803f75:	00 00 00 
+  803f78:	ff d0                	call   *%rax
+        return res;
+  803f7a:	eb dc                	jmp    803f58 <open+0x96>
+        return -E_BAD_PATH;
+  803f7c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803f81:	eb d5                	jmp    803f58 <open+0x96>
+
+0000000000803f83 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803f83:	55                   	push   %rbp
+  803f84:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  803f91:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f96:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  803f9d:	00 00 00 
+  803fa0:	ff d0                	call   *%rax
+}
+  803fa2:	5d                   	pop    %rbp
+  803fa3:	c3                   	ret
+
+0000000000803fa4 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803fa4:	55                   	push   %rbp
+  803fa5:	48 89 e5             	mov    %rsp,%rbp
+  803fa8:	41 56                	push   %r14
+  803faa:	41 55                	push   %r13
+  803fac:	41 54                	push   %r12
+  803fae:	53                   	push   %rbx
+  803faf:	48 83 ec 10          	sub    $0x10,%rsp
+  803fb3:	41 89 f6             	mov    %esi,%r14d
+  803fb6:	49 89 d4             	mov    %rdx,%r12
+  803fb9:	48 89 cb             	mov    %rcx,%rbx
+  803fbc:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803fbf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803fc3:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  803fca:	00 00 00 
+  803fcd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fcf:	85 c0                	test   %eax,%eax
+  803fd1:	78 46                	js     804019 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fd3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fd7:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803fde:	00 00 00 
+  803fe1:	8b 00                	mov    (%rax),%eax
+  803fe3:	39 02                	cmp    %eax,(%rdx)
+  803fe5:	75 3f                	jne    804026 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803fe7:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803fee:	00 00 00 
+  803ff1:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ff4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ff6:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ffa:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ffe:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804002:	48 89 da             	mov    %rbx,%rdx
+  804005:	4c 89 e6             	mov    %r12,%rsi
+  804008:	bf 09 00 00 00       	mov    $0x9,%edi
+  80400d:	48 b8 2b 3b 80 00 00 	movabs $0x803b2b,%rax
+  804014:	00 00 00 
+  804017:	ff d0                	call   *%rax
+}
+  804019:	48 83 c4 10          	add    $0x10,%rsp
+  80401d:	5b                   	pop    %rbx
+  80401e:	41 5c                	pop    %r12
+  804020:	41 5d                	pop    %r13
+  804022:	41 5e                	pop    %r14
+  804024:	5d                   	pop    %rbp
+  804025:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804026:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80402b:	eb ec                	jmp    804019 <file_map+0x75>
+
+000000000080402d <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80402d:	55                   	push   %rbp
+  80402e:	48 89 e5             	mov    %rsp,%rbp
+  804031:	41 54                	push   %r12
+  804033:	53                   	push   %rbx
+  804034:	48 83 ec 20          	sub    $0x20,%rsp
+  804038:	41 89 f4             	mov    %esi,%r12d
+  80403b:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80403e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804042:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  804049:	00 00 00 
+  80404c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80404e:	85 c0                	test   %eax,%eax
+  804050:	78 3c                	js     80408e <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804052:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804056:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80405d:	00 00 00 
+  804060:	8b 0a                	mov    (%rdx),%ecx
+  804062:	39 08                	cmp    %ecx,(%rax)
+  804064:	75 31                	jne    804097 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804066:	8b 40 0c             	mov    0xc(%rax),%eax
+  804069:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80406c:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804070:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804074:	ba 10 00 00 00       	mov    $0x10,%edx
+  804079:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80407d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804082:	48 b8 30 3a 80 00 00 	movabs $0x803a30,%rax
+  804089:	00 00 00 
+  80408c:	ff d0                	call   *%rax
+}
+  80408e:	48 83 c4 20          	add    $0x20,%rsp
+  804092:	5b                   	pop    %rbx
+  804093:	41 5c                	pop    %r12
+  804095:	5d                   	pop    %rbp
+  804096:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804097:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80409c:	eb f0                	jmp    80408e <file_msync+0x61>
+
+000000000080409e <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80409e:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8040a2:	7f 01                	jg     8040a5 <writebuf+0x7>
+  8040a4:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8040a5:	55                   	push   %rbp
+  8040a6:	48 89 e5             	mov    %rsp,%rbp
+  8040a9:	53                   	push   %rbx
+  8040aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8040ae:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8040b1:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8040b5:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8040b9:	8b 3f                	mov    (%rdi),%edi
+  8040bb:	48 b8 59 37 80 00 00 	movabs $0x803759,%rax
+  8040c2:	00 00 00 
+  8040c5:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8040c7:	48 85 c0             	test   %rax,%rax
+  8040ca:	7e 04                	jle    8040d0 <writebuf+0x32>
+  8040cc:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8040d0:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8040d4:	48 39 c2             	cmp    %rax,%rdx
+  8040d7:	74 0f                	je     8040e8 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8040d9:	48 85 c0             	test   %rax,%rax
+  8040dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040e1:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8040e5:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8040e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040ec:	c9                   	leave
+  8040ed:	c3                   	ret
+
+00000000008040ee <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8040ee:	8b 46 04             	mov    0x4(%rsi),%eax
+  8040f1:	8d 50 01             	lea    0x1(%rax),%edx
+  8040f4:	89 56 04             	mov    %edx,0x4(%rsi)
+  8040f7:	48 98                	cltq
+  8040f9:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8040fe:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804104:	74 01                	je     804107 <putch+0x19>
+  804106:	c3                   	ret
+putch(int ch, void *arg) {
+  804107:	55                   	push   %rbp
+  804108:	48 89 e5             	mov    %rsp,%rbp
+  80410b:	53                   	push   %rbx
+  80410c:	48 83 ec 08          	sub    $0x8,%rsp
+  804110:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804113:	48 89 f7             	mov    %rsi,%rdi
+  804116:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  80411d:	00 00 00 
+  804120:	ff d0                	call   *%rax
+        state->offset = 0;
+  804122:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804129:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80412d:	c9                   	leave
+  80412e:	c3                   	ret
+
+000000000080412f <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80412f:	55                   	push   %rbp
+  804130:	48 89 e5             	mov    %rsp,%rbp
+  804133:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80413a:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80413d:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804143:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80414a:	00 00 00 
+    state.result = 0;
+  80414d:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804154:	00 00 00 00 
+    state.error = 1;
+  804158:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80415f:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804162:	48 89 f2             	mov    %rsi,%rdx
+  804165:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80416c:	48 bf ee 40 80 00 00 	movabs $0x8040ee,%rdi
+  804173:	00 00 00 
+  804176:	48 b8 db 18 80 00 00 	movabs $0x8018db,%rax
+  80417d:	00 00 00 
+  804180:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804182:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804189:	7f 14                	jg     80419f <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80418b:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804192:	48 85 c0             	test   %rax,%rax
+  804195:	75 06                	jne    80419d <vfprintf+0x6e>
+  804197:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80419d:	c9                   	leave
+  80419e:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80419f:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8041a6:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  8041ad:	00 00 00 
+  8041b0:	ff d0                	call   *%rax
+  8041b2:	eb d7                	jmp    80418b <vfprintf+0x5c>
+
+00000000008041b4 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8041b4:	55                   	push   %rbp
+  8041b5:	48 89 e5             	mov    %rsp,%rbp
+  8041b8:	48 83 ec 50          	sub    $0x50,%rsp
+  8041bc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8041c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8041c4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8041c8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8041cc:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8041d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041db:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8041df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8041e3:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8041e7:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  8041ee:	00 00 00 
+  8041f1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8041f3:	c9                   	leave
+  8041f4:	c3                   	ret
+
+00000000008041f5 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8041f5:	55                   	push   %rbp
+  8041f6:	48 89 e5             	mov    %rsp,%rbp
+  8041f9:	48 83 ec 50          	sub    $0x50,%rsp
+  8041fd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804201:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804205:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804209:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80420d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804211:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804218:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80421c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804220:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804224:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804228:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80422c:	48 89 fe             	mov    %rdi,%rsi
+  80422f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804234:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  80423b:	00 00 00 
+  80423e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804240:	c9                   	leave
+  804241:	c3                   	ret
+
+0000000000804242 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804242:	55                   	push   %rbp
+  804243:	48 89 e5             	mov    %rsp,%rbp
+  804246:	41 54                	push   %r12
+  804248:	53                   	push   %rbx
+  804249:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80424c:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  804253:	00 00 00 
+  804256:	ff d0                	call   *%rax
+  804258:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80425b:	48 be 10 66 80 00 00 	movabs $0x806610,%rsi
+  804262:	00 00 00 
+  804265:	48 89 df             	mov    %rbx,%rdi
+  804268:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  80426f:	00 00 00 
+  804272:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804274:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804279:	41 2b 04 24          	sub    (%r12),%eax
+  80427d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804283:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80428a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80428d:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804294:	00 00 00 
+  804297:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80429e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a3:	5b                   	pop    %rbx
+  8042a4:	41 5c                	pop    %r12
+  8042a6:	5d                   	pop    %rbp
+  8042a7:	c3                   	ret
+
+00000000008042a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8042a8:	55                   	push   %rbp
+  8042a9:	48 89 e5             	mov    %rsp,%rbp
+  8042ac:	41 54                	push   %r12
+  8042ae:	53                   	push   %rbx
+  8042af:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8042b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042b7:	48 89 fe             	mov    %rdi,%rsi
+  8042ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042bf:	49 bc ff 28 80 00 00 	movabs $0x8028ff,%r12
+  8042c6:	00 00 00 
+  8042c9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8042cc:	48 89 df             	mov    %rbx,%rdi
+  8042cf:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  8042d6:	00 00 00 
+  8042d9:	ff d0                	call   *%rax
+  8042db:	48 89 c6             	mov    %rax,%rsi
+  8042de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042e8:	41 ff d4             	call   *%r12
+}
+  8042eb:	5b                   	pop    %rbx
+  8042ec:	41 5c                	pop    %r12
+  8042ee:	5d                   	pop    %rbp
+  8042ef:	c3                   	ret
+
+00000000008042f0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042f0:	55                   	push   %rbp
+  8042f1:	48 89 e5             	mov    %rsp,%rbp
+  8042f4:	41 57                	push   %r15
+  8042f6:	41 56                	push   %r14
+  8042f8:	41 55                	push   %r13
+  8042fa:	41 54                	push   %r12
+  8042fc:	53                   	push   %rbx
+  8042fd:	48 83 ec 18          	sub    $0x18,%rsp
+  804301:	49 89 fc             	mov    %rdi,%r12
+  804304:	49 89 f5             	mov    %rsi,%r13
+  804307:	49 89 d7             	mov    %rdx,%r15
+  80430a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80430e:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  804315:	00 00 00 
+  804318:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80431a:	4d 85 ff             	test   %r15,%r15
+  80431d:	0f 84 af 00 00 00    	je     8043d2 <devpipe_write+0xe2>
+  804323:	48 89 c3             	mov    %rax,%rbx
+  804326:	4c 89 f8             	mov    %r15,%rax
+  804329:	4d 89 ef             	mov    %r13,%r15
+  80432c:	4c 01 e8             	add    %r13,%rax
+  80432f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804333:	49 bd f5 27 80 00 00 	movabs $0x8027f5,%r13
+  80433a:	00 00 00 
+            sys_yield();
+  80433d:	49 be 86 27 80 00 00 	movabs $0x802786,%r14
+  804344:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804347:	8b 73 04             	mov    0x4(%rbx),%esi
+  80434a:	48 63 ce             	movslq %esi,%rcx
+  80434d:	48 63 03             	movslq (%rbx),%rax
+  804350:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804356:	48 39 c1             	cmp    %rax,%rcx
+  804359:	72 2e                	jb     804389 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80435b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804360:	48 89 da             	mov    %rbx,%rdx
+  804363:	be 00 10 00 00       	mov    $0x1000,%esi
+  804368:	4c 89 e7             	mov    %r12,%rdi
+  80436b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80436e:	85 c0                	test   %eax,%eax
+  804370:	74 66                	je     8043d8 <devpipe_write+0xe8>
+            sys_yield();
+  804372:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804375:	8b 73 04             	mov    0x4(%rbx),%esi
+  804378:	48 63 ce             	movslq %esi,%rcx
+  80437b:	48 63 03             	movslq (%rbx),%rax
+  80437e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804384:	48 39 c1             	cmp    %rax,%rcx
+  804387:	73 d2                	jae    80435b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804389:	41 0f b6 3f          	movzbl (%r15),%edi
+  80438d:	48 89 ca             	mov    %rcx,%rdx
+  804390:	48 c1 ea 03          	shr    $0x3,%rdx
+  804394:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80439b:	08 10 20 
+  80439e:	48 f7 e2             	mul    %rdx
+  8043a1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8043a5:	48 89 d0             	mov    %rdx,%rax
+  8043a8:	48 c1 e0 09          	shl    $0x9,%rax
+  8043ac:	48 29 d0             	sub    %rdx,%rax
+  8043af:	48 c1 e0 03          	shl    $0x3,%rax
+  8043b3:	48 29 c1             	sub    %rax,%rcx
+  8043b6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8043bb:	83 c6 01             	add    $0x1,%esi
+  8043be:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8043c1:	49 83 c7 01          	add    $0x1,%r15
+  8043c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c9:	49 39 c7             	cmp    %rax,%r15
+  8043cc:	0f 85 75 ff ff ff    	jne    804347 <devpipe_write+0x57>
+    return n;
+  8043d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043d6:	eb 05                	jmp    8043dd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8043d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043dd:	48 83 c4 18          	add    $0x18,%rsp
+  8043e1:	5b                   	pop    %rbx
+  8043e2:	41 5c                	pop    %r12
+  8043e4:	41 5d                	pop    %r13
+  8043e6:	41 5e                	pop    %r14
+  8043e8:	41 5f                	pop    %r15
+  8043ea:	5d                   	pop    %rbp
+  8043eb:	c3                   	ret
+
+00000000008043ec <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043ec:	55                   	push   %rbp
+  8043ed:	48 89 e5             	mov    %rsp,%rbp
+  8043f0:	41 57                	push   %r15
+  8043f2:	41 56                	push   %r14
+  8043f4:	41 55                	push   %r13
+  8043f6:	41 54                	push   %r12
+  8043f8:	53                   	push   %rbx
+  8043f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8043fd:	49 89 fc             	mov    %rdi,%r12
+  804400:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804404:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804408:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  80440f:	00 00 00 
+  804412:	ff d0                	call   *%rax
+  804414:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804417:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80441d:	49 bd f5 27 80 00 00 	movabs $0x8027f5,%r13
+  804424:	00 00 00 
+            sys_yield();
+  804427:	49 be 86 27 80 00 00 	movabs $0x802786,%r14
+  80442e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804431:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804436:	74 7d                	je     8044b5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804438:	8b 03                	mov    (%rbx),%eax
+  80443a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80443d:	75 26                	jne    804465 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80443f:	4d 85 ff             	test   %r15,%r15
+  804442:	75 77                	jne    8044bb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804444:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804449:	48 89 da             	mov    %rbx,%rdx
+  80444c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804451:	4c 89 e7             	mov    %r12,%rdi
+  804454:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804457:	85 c0                	test   %eax,%eax
+  804459:	74 72                	je     8044cd <devpipe_read+0xe1>
+            sys_yield();
+  80445b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80445e:	8b 03                	mov    (%rbx),%eax
+  804460:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804463:	74 df                	je     804444 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804465:	48 63 c8             	movslq %eax,%rcx
+  804468:	48 89 ca             	mov    %rcx,%rdx
+  80446b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80446f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804476:	08 10 20 
+  804479:	48 89 d0             	mov    %rdx,%rax
+  80447c:	48 f7 e6             	mul    %rsi
+  80447f:	48 c1 ea 06          	shr    $0x6,%rdx
+  804483:	48 89 d0             	mov    %rdx,%rax
+  804486:	48 c1 e0 09          	shl    $0x9,%rax
+  80448a:	48 29 d0             	sub    %rdx,%rax
+  80448d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804494:	00 
+  804495:	48 89 c8             	mov    %rcx,%rax
+  804498:	48 29 d0             	sub    %rdx,%rax
+  80449b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8044a0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8044a4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8044a8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8044ab:	49 83 c7 01          	add    $0x1,%r15
+  8044af:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8044b3:	75 83                	jne    804438 <devpipe_read+0x4c>
+    return n;
+  8044b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044b9:	eb 03                	jmp    8044be <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8044bb:	4c 89 f8             	mov    %r15,%rax
+}
+  8044be:	48 83 c4 18          	add    $0x18,%rsp
+  8044c2:	5b                   	pop    %rbx
+  8044c3:	41 5c                	pop    %r12
+  8044c5:	41 5d                	pop    %r13
+  8044c7:	41 5e                	pop    %r14
+  8044c9:	41 5f                	pop    %r15
+  8044cb:	5d                   	pop    %rbp
+  8044cc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8044cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d2:	eb ea                	jmp    8044be <devpipe_read+0xd2>
+
+00000000008044d4 <pipe>:
+pipe(int pfd[2]) {
+  8044d4:	55                   	push   %rbp
+  8044d5:	48 89 e5             	mov    %rsp,%rbp
+  8044d8:	41 55                	push   %r13
+  8044da:	41 54                	push   %r12
+  8044dc:	53                   	push   %rbx
+  8044dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8044e1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8044e4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8044e8:	48 b8 e7 32 80 00 00 	movabs $0x8032e7,%rax
+  8044ef:	00 00 00 
+  8044f2:	ff d0                	call   *%rax
+  8044f4:	89 c3                	mov    %eax,%ebx
+  8044f6:	85 c0                	test   %eax,%eax
+  8044f8:	0f 88 a0 01 00 00    	js     80469e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8044fe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804503:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804508:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80450c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804511:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  804518:	00 00 00 
+  80451b:	ff d0                	call   *%rax
+  80451d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80451f:	85 c0                	test   %eax,%eax
+  804521:	0f 88 77 01 00 00    	js     80469e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804527:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80452b:	48 b8 e7 32 80 00 00 	movabs $0x8032e7,%rax
+  804532:	00 00 00 
+  804535:	ff d0                	call   *%rax
+  804537:	89 c3                	mov    %eax,%ebx
+  804539:	85 c0                	test   %eax,%eax
+  80453b:	0f 88 43 01 00 00    	js     804684 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804541:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804546:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80454b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80454f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804554:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  80455b:	00 00 00 
+  80455e:	ff d0                	call   *%rax
+  804560:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804562:	85 c0                	test   %eax,%eax
+  804564:	0f 88 1a 01 00 00    	js     804684 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80456a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80456e:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  804575:	00 00 00 
+  804578:	ff d0                	call   *%rax
+  80457a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80457d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804582:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804587:	48 89 c6             	mov    %rax,%rsi
+  80458a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80458f:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  804596:	00 00 00 
+  804599:	ff d0                	call   *%rax
+  80459b:	89 c3                	mov    %eax,%ebx
+  80459d:	85 c0                	test   %eax,%eax
+  80459f:	0f 88 c5 00 00 00    	js     80466a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8045a5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8045a9:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  8045b0:	00 00 00 
+  8045b3:	ff d0                	call   *%rax
+  8045b5:	48 89 c1             	mov    %rax,%rcx
+  8045b8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8045be:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8045c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045c9:	4c 89 ee             	mov    %r13,%rsi
+  8045cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045d1:	48 b8 94 28 80 00 00 	movabs $0x802894,%rax
+  8045d8:	00 00 00 
+  8045db:	ff d0                	call   *%rax
+  8045dd:	89 c3                	mov    %eax,%ebx
+  8045df:	85 c0                	test   %eax,%eax
+  8045e1:	78 6e                	js     804651 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8045e3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045e8:	4c 89 ef             	mov    %r13,%rdi
+  8045eb:	48 b8 bd 27 80 00 00 	movabs $0x8027bd,%rax
+  8045f2:	00 00 00 
+  8045f5:	ff d0                	call   *%rax
+  8045f7:	83 f8 02             	cmp    $0x2,%eax
+  8045fa:	0f 85 ab 00 00 00    	jne    8046ab <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804600:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804607:	00 00 
+  804609:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80460d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80460f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804613:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80461a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80461e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804620:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804624:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80462b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80462f:	48 bb b9 32 80 00 00 	movabs $0x8032b9,%rbx
+  804636:	00 00 00 
+  804639:	ff d3                	call   *%rbx
+  80463b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80463f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804643:	ff d3                	call   *%rbx
+  804645:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80464a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80464f:	eb 4d                	jmp    80469e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804651:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804656:	4c 89 ee             	mov    %r13,%rsi
+  804659:	bf 00 00 00 00       	mov    $0x0,%edi
+  80465e:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  804665:	00 00 00 
+  804668:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80466a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80466f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804673:	bf 00 00 00 00       	mov    $0x0,%edi
+  804678:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  80467f:	00 00 00 
+  804682:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804684:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804689:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80468d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804692:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  804699:	00 00 00 
+  80469c:	ff d0                	call   *%rax
+}
+  80469e:	89 d8                	mov    %ebx,%eax
+  8046a0:	48 83 c4 18          	add    $0x18,%rsp
+  8046a4:	5b                   	pop    %rbx
+  8046a5:	41 5c                	pop    %r12
+  8046a7:	41 5d                	pop    %r13
+  8046a9:	5d                   	pop    %rbp
+  8046aa:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046ab:	48 b9 28 66 80 00 00 	movabs $0x806628,%rcx
+  8046b2:	00 00 00 
+  8046b5:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  8046bc:	00 00 00 
+  8046bf:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8046c4:	48 bf 17 66 80 00 00 	movabs $0x806617,%rdi
+  8046cb:	00 00 00 
+  8046ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d3:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  8046da:	00 00 00 
+  8046dd:	41 ff d0             	call   *%r8
+
+00000000008046e0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8046e0:	55                   	push   %rbp
+  8046e1:	48 89 e5             	mov    %rsp,%rbp
+  8046e4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8046e8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8046ec:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  8046f3:	00 00 00 
+  8046f6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8046f8:	85 c0                	test   %eax,%eax
+  8046fa:	78 35                	js     804731 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8046fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804700:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  804707:	00 00 00 
+  80470a:	ff d0                	call   *%rax
+  80470c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80470f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804714:	be 00 10 00 00       	mov    $0x1000,%esi
+  804719:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80471d:	48 b8 f5 27 80 00 00 	movabs $0x8027f5,%rax
+  804724:	00 00 00 
+  804727:	ff d0                	call   *%rax
+  804729:	85 c0                	test   %eax,%eax
+  80472b:	0f 94 c0             	sete   %al
+  80472e:	0f b6 c0             	movzbl %al,%eax
+}
+  804731:	c9                   	leave
+  804732:	c3                   	ret
+
+0000000000804733 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804733:	48 89 f8             	mov    %rdi,%rax
+  804736:	48 c1 e8 27          	shr    $0x27,%rax
+  80473a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804741:	01 00 00 
+  804744:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804748:	f6 c2 01             	test   $0x1,%dl
+  80474b:	74 6d                	je     8047ba <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80474d:	48 89 f8             	mov    %rdi,%rax
+  804750:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804754:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80475b:	01 00 00 
+  80475e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804762:	f6 c2 01             	test   $0x1,%dl
+  804765:	74 62                	je     8047c9 <get_uvpt_entry+0x96>
+  804767:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80476e:	01 00 00 
+  804771:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804775:	f6 c2 80             	test   $0x80,%dl
+  804778:	75 4f                	jne    8047c9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80477a:	48 89 f8             	mov    %rdi,%rax
+  80477d:	48 c1 e8 15          	shr    $0x15,%rax
+  804781:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804788:	01 00 00 
+  80478b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80478f:	f6 c2 01             	test   $0x1,%dl
+  804792:	74 44                	je     8047d8 <get_uvpt_entry+0xa5>
+  804794:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80479b:	01 00 00 
+  80479e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047a2:	f6 c2 80             	test   $0x80,%dl
+  8047a5:	75 31                	jne    8047d8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8047a7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8047ab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8047b2:	01 00 00 
+  8047b5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8047b9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8047ba:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8047c1:	01 00 00 
+  8047c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8047c8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8047c9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8047d0:	01 00 00 
+  8047d3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8047d7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8047d8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047df:	01 00 00 
+  8047e2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8047e6:	c3                   	ret
+
+00000000008047e7 <get_prot>:
+
+int
+get_prot(void *va) {
+  8047e7:	55                   	push   %rbp
+  8047e8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8047eb:	48 b8 33 47 80 00 00 	movabs $0x804733,%rax
+  8047f2:	00 00 00 
+  8047f5:	ff d0                	call   *%rax
+  8047f7:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8047fa:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8047ff:	89 c1                	mov    %eax,%ecx
+  804801:	83 c9 04             	or     $0x4,%ecx
+  804804:	f6 c2 01             	test   $0x1,%dl
+  804807:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80480a:	89 c1                	mov    %eax,%ecx
+  80480c:	83 c9 02             	or     $0x2,%ecx
+  80480f:	f6 c2 02             	test   $0x2,%dl
+  804812:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804815:	89 c1                	mov    %eax,%ecx
+  804817:	83 c9 01             	or     $0x1,%ecx
+  80481a:	48 85 d2             	test   %rdx,%rdx
+  80481d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804820:	89 c1                	mov    %eax,%ecx
+  804822:	83 c9 40             	or     $0x40,%ecx
+  804825:	f6 c6 04             	test   $0x4,%dh
+  804828:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80482b:	5d                   	pop    %rbp
+  80482c:	c3                   	ret
+
+000000000080482d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80482d:	55                   	push   %rbp
+  80482e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804831:	48 b8 33 47 80 00 00 	movabs $0x804733,%rax
+  804838:	00 00 00 
+  80483b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80483d:	48 c1 e8 06          	shr    $0x6,%rax
+  804841:	83 e0 01             	and    $0x1,%eax
+}
+  804844:	5d                   	pop    %rbp
+  804845:	c3                   	ret
+
+0000000000804846 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804846:	55                   	push   %rbp
+  804847:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80484a:	48 b8 33 47 80 00 00 	movabs $0x804733,%rax
+  804851:	00 00 00 
+  804854:	ff d0                	call   *%rax
+  804856:	83 e0 01             	and    $0x1,%eax
+}
+  804859:	5d                   	pop    %rbp
+  80485a:	c3                   	ret
+
+000000000080485b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80485b:	55                   	push   %rbp
+  80485c:	48 89 e5             	mov    %rsp,%rbp
+  80485f:	41 57                	push   %r15
+  804861:	41 56                	push   %r14
+  804863:	41 55                	push   %r13
+  804865:	41 54                	push   %r12
+  804867:	53                   	push   %rbx
+  804868:	48 83 ec 28          	sub    $0x28,%rsp
+  80486c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804870:	48 85 ff             	test   %rdi,%rdi
+  804873:	74 1e                	je     804893 <foreach_shared_region+0x38>
+  804875:	49 89 ff             	mov    %rdi,%r15
+  804878:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80487e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804884:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80488b:	01 00 00 
+  80488e:	e9 72 02 00 00       	jmp    804b05 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804893:	48 b9 4c 66 80 00 00 	movabs $0x80664c,%rcx
+  80489a:	00 00 00 
+  80489d:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  8048a4:	00 00 00 
+  8048a7:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8048ac:	48 bf 50 66 80 00 00 	movabs $0x806650,%rdi
+  8048b3:	00 00 00 
+  8048b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bb:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  8048c2:	00 00 00 
+  8048c5:	41 ff d0             	call   *%r8
+  8048c8:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8048cf:	eb 6c                	jmp    80493d <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8048d1:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8048d8:	ff ff ff 
+  8048db:	4c 21 e2             	and    %r12,%rdx
+  8048de:	48 89 d8             	mov    %rbx,%rax
+  8048e1:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8048e6:	48 83 c0 01          	add    $0x1,%rax
+  8048ea:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8048ee:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8048f5:	00 00 00 
+  8048f8:	48 21 c8             	and    %rcx,%rax
+  8048fb:	48 09 d0             	or     %rdx,%rax
+  8048fe:	49 89 c4             	mov    %rax,%r12
+  804901:	eb 30                	jmp    804933 <foreach_shared_region+0xd8>
+  804903:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80490a:	ff ff ff 
+  80490d:	4c 21 e2             	and    %r12,%rdx
+  804910:	48 89 d8             	mov    %rbx,%rax
+  804913:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804918:	48 83 c0 01          	add    $0x1,%rax
+  80491c:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804920:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804927:	00 00 00 
+  80492a:	48 21 c8             	and    %rcx,%rax
+  80492d:	48 09 d0             	or     %rdx,%rax
+  804930:	49 89 c4             	mov    %rax,%r12
+  804933:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804937:	0f 84 99 01 00 00    	je     804ad6 <foreach_shared_region+0x27b>
+  80493d:	4c 89 e3             	mov    %r12,%rbx
+  804940:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804944:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80494b:	01 00 00 
+  80494e:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804952:	a8 01                	test   $0x1,%al
+  804954:	0f 84 77 ff ff ff    	je     8048d1 <foreach_shared_region+0x76>
+  80495a:	a8 80                	test   $0x80,%al
+  80495c:	74 19                	je     804977 <foreach_shared_region+0x11c>
+  80495e:	f6 c4 04             	test   $0x4,%ah
+  804961:	74 a0                	je     804903 <foreach_shared_region+0xa8>
+  804963:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80496a:	40 
+  80496b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80496f:	4c 89 e7             	mov    %r12,%rdi
+  804972:	41 ff d7             	call   *%r15
+  804975:	eb 8c                	jmp    804903 <foreach_shared_region+0xa8>
+  804977:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80497e:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804982:	eb 46                	jmp    8049ca <foreach_shared_region+0x16f>
+  804984:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80498b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804991:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804995:	48 c1 e0 15          	shl    $0x15,%rax
+  804999:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80499e:	49 09 c4             	or     %rax,%r12
+  8049a1:	eb 1d                	jmp    8049c0 <foreach_shared_region+0x165>
+  8049a3:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8049aa:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049b0:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8049b4:	48 c1 e0 15          	shl    $0x15,%rax
+  8049b8:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8049bd:	49 09 c4             	or     %rax,%r12
+  8049c0:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8049c4:	0f 84 d3 00 00 00    	je     804a9d <foreach_shared_region+0x242>
+  8049ca:	4c 89 e3             	mov    %r12,%rbx
+  8049cd:	48 c1 eb 15          	shr    $0x15,%rbx
+  8049d1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8049d8:	01 00 00 
+  8049db:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8049df:	a8 01                	test   $0x1,%al
+  8049e1:	74 a1                	je     804984 <foreach_shared_region+0x129>
+  8049e3:	a8 80                	test   $0x80,%al
+  8049e5:	74 19                	je     804a00 <foreach_shared_region+0x1a5>
+  8049e7:	f6 c4 04             	test   $0x4,%ah
+  8049ea:	74 b7                	je     8049a3 <foreach_shared_region+0x148>
+  8049ec:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8049f3:	00 
+  8049f4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049f8:	4c 89 e7             	mov    %r12,%rdi
+  8049fb:	41 ff d7             	call   *%r15
+  8049fe:	eb a3                	jmp    8049a3 <foreach_shared_region+0x148>
+  804a00:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804a06:	eb 3b                	jmp    804a43 <foreach_shared_region+0x1e8>
+  804a08:	f6 c4 04             	test   $0x4,%ah
+  804a0b:	74 12                	je     804a1f <foreach_shared_region+0x1c4>
+  804a0d:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804a14:	00 
+  804a15:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a19:	4c 89 e7             	mov    %r12,%rdi
+  804a1c:	41 ff d7             	call   *%r15
+  804a1f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804a26:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a2c:	48 83 c3 01          	add    $0x1,%rbx
+  804a30:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804a34:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804a3a:	49 09 dc             	or     %rbx,%r12
+  804a3d:	41 83 ed 01          	sub    $0x1,%r13d
+  804a41:	74 2f                	je     804a72 <foreach_shared_region+0x217>
+  804a43:	4c 89 e3             	mov    %r12,%rbx
+  804a46:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804a4a:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804a4e:	a8 01                	test   $0x1,%al
+  804a50:	75 b6                	jne    804a08 <foreach_shared_region+0x1ad>
+  804a52:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804a59:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a5f:	48 83 c3 01          	add    $0x1,%rbx
+  804a63:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804a67:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804a6d:	49 09 dc             	or     %rbx,%r12
+  804a70:	eb cb                	jmp    804a3d <foreach_shared_region+0x1e2>
+  804a72:	4c 89 e0             	mov    %r12,%rax
+  804a75:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804a7b:	49 c1 ec 15          	shr    $0x15,%r12
+  804a7f:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804a86:	49 83 c4 01          	add    $0x1,%r12
+  804a8a:	49 c1 e4 15          	shl    $0x15,%r12
+  804a8e:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804a95:	49 09 c4             	or     %rax,%r12
+  804a98:	e9 23 ff ff ff       	jmp    8049c0 <foreach_shared_region+0x165>
+  804a9d:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804aa1:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804aa8:	ff ff ff 
+  804aab:	4c 21 e0             	and    %r12,%rax
+  804aae:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804ab2:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804ab9:	49 83 c4 01          	add    $0x1,%r12
+  804abd:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804ac1:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804ac8:	00 00 00 
+  804acb:	49 21 d4             	and    %rdx,%r12
+  804ace:	49 09 c4             	or     %rax,%r12
+  804ad1:	e9 5d fe ff ff       	jmp    804933 <foreach_shared_region+0xd8>
+  804ad6:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804add:	00 ff ff 
+  804ae0:	4c 21 e0             	and    %r12,%rax
+  804ae3:	49 c1 ec 27          	shr    $0x27,%r12
+  804ae7:	49 83 c4 01          	add    $0x1,%r12
+  804aeb:	49 c1 e4 27          	shl    $0x27,%r12
+  804aef:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804af6:	ff 00 00 
+  804af9:	49 21 d4             	and    %rdx,%r12
+  804afc:	49 09 c4             	or     %rax,%r12
+  804aff:	41 83 ed 01          	sub    $0x1,%r13d
+  804b03:	74 48                	je     804b4d <foreach_shared_region+0x2f2>
+  804b05:	4c 89 e0             	mov    %r12,%rax
+  804b08:	48 c1 e8 27          	shr    $0x27,%rax
+  804b0c:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804b13:	01 00 00 
+  804b16:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804b1a:	f6 c2 01             	test   $0x1,%dl
+  804b1d:	0f 85 a5 fd ff ff    	jne    8048c8 <foreach_shared_region+0x6d>
+  804b23:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804b2a:	00 ff ff 
+  804b2d:	4c 21 e2             	and    %r12,%rdx
+  804b30:	48 83 c0 01          	add    $0x1,%rax
+  804b34:	48 c1 e0 27          	shl    $0x27,%rax
+  804b38:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804b3f:	ff 00 00 
+  804b42:	48 21 c8             	and    %rcx,%rax
+  804b45:	48 09 d0             	or     %rdx,%rax
+  804b48:	49 89 c4             	mov    %rax,%r12
+  804b4b:	eb b2                	jmp    804aff <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804b4d:	4d 85 e4             	test   %r12,%r12
+  804b50:	75 14                	jne    804b66 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b57:	48 83 c4 28          	add    $0x28,%rsp
+  804b5b:	5b                   	pop    %rbx
+  804b5c:	41 5c                	pop    %r12
+  804b5e:	41 5d                	pop    %r13
+  804b60:	41 5e                	pop    %r14
+  804b62:	41 5f                	pop    %r15
+  804b64:	5d                   	pop    %rbp
+  804b65:	c3                   	ret
+    assert(addr == 0);
+  804b66:	48 b9 5b 66 80 00 00 	movabs $0x80665b,%rcx
+  804b6d:	00 00 00 
+  804b70:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  804b77:	00 00 00 
+  804b7a:	be 67 00 00 00       	mov    $0x67,%esi
+  804b7f:	48 bf 50 66 80 00 00 	movabs $0x806650,%rdi
+  804b86:	00 00 00 
+  804b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b8e:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  804b95:	00 00 00 
+  804b98:	41 ff d0             	call   *%r8
+
+0000000000804b9b <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804b9b:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804ba2:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804ba5:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804bab:	eb 33                	jmp    804be0 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804bad:	48 83 c0 20          	add    $0x20,%rax
+  804bb1:	4c 39 c0             	cmp    %r8,%rax
+  804bb4:	74 25                	je     804bdb <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804bb6:	48 8b 10             	mov    (%rax),%rdx
+  804bb9:	48 85 d2             	test   %rdx,%rdx
+  804bbc:	74 ef                	je     804bad <mmap_place+0x12>
+  804bbe:	48 89 d1             	mov    %rdx,%rcx
+  804bc1:	48 03 48 08          	add    0x8(%rax),%rcx
+  804bc5:	48 39 cf             	cmp    %rcx,%rdi
+  804bc8:	73 e3                	jae    804bad <mmap_place+0x12>
+  804bca:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804bce:	4c 39 ca             	cmp    %r9,%rdx
+  804bd1:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804bd5:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804bd9:	eb d2                	jmp    804bad <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804bdb:	45 84 d2             	test   %r10b,%r10b
+  804bde:	74 12                	je     804bf2 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804be0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804be7:	00 00 00 
+        moved = 0;
+  804bea:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804bf0:	eb c4                	jmp    804bb6 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804bf2:	48 01 fe             	add    %rdi,%rsi
+  804bf5:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804bfc:	00 00 00 
+  804bff:	48 39 f0             	cmp    %rsi,%rax
+  804c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c07:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804c0b:	c3                   	ret
+
+0000000000804c0c <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804c0c:	55                   	push   %rbp
+  804c0d:	48 89 e5             	mov    %rsp,%rbp
+  804c10:	41 57                	push   %r15
+  804c12:	41 56                	push   %r14
+  804c14:	41 55                	push   %r13
+  804c16:	41 54                	push   %r12
+  804c18:	53                   	push   %rbx
+  804c19:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804c1d:	48 8b 1f             	mov    (%rdi),%rbx
+  804c20:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c27:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c2e:	00 00 00 
+  804c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c36:	eb 12                	jmp    804c4a <mmap_pgfault+0x3e>
+  804c38:	48 83 c2 01          	add    $0x1,%rdx
+  804c3c:	48 83 c0 20          	add    $0x20,%rax
+  804c40:	48 83 fa 20          	cmp    $0x20,%rdx
+  804c44:	0f 84 04 01 00 00    	je     804d4e <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804c4a:	48 8b 08             	mov    (%rax),%rcx
+  804c4d:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804c51:	48 39 de             	cmp    %rbx,%rsi
+  804c54:	73 e2                	jae    804c38 <mmap_pgfault+0x2c>
+  804c56:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c5a:	48 39 cb             	cmp    %rcx,%rbx
+  804c5d:	73 d9                	jae    804c38 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804c5f:	48 c1 e2 05          	shl    $0x5,%rdx
+  804c63:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c6a:	00 00 00 
+  804c6d:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804c71:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804c75:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804c79:	f6 c2 01             	test   $0x1,%dl
+  804c7c:	0f 84 e0 00 00 00    	je     804d62 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c87:	f6 c2 02             	test   $0x2,%dl
+  804c8a:	0f 84 c3 00 00 00    	je     804d53 <mmap_pgfault+0x147>
+  804c90:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c97:	ff ff ff 
+  804c9a:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804c9e:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804ca5:	00 00 00 
+  804ca8:	48 39 ca             	cmp    %rcx,%rdx
+  804cab:	0f 85 a2 00 00 00    	jne    804d53 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804cb1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804cb6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cbb:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804cc2:	00 00 00 
+  804cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cca:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  804cd1:	00 00 00 
+  804cd4:	ff d0                	call   *%rax
+  804cd6:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cdd:	85 d2                	test   %edx,%edx
+  804cdf:	78 72                	js     804d53 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804ce1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ce6:	48 89 de             	mov    %rbx,%rsi
+  804ce9:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804cf0:	00 00 00 
+  804cf3:	4c 89 e7             	mov    %r12,%rdi
+  804cf6:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  804cfd:	00 00 00 
+  804d00:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804d02:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804d08:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804d0e:	48 89 d9             	mov    %rbx,%rcx
+  804d11:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d16:	4c 89 e6             	mov    %r12,%rsi
+  804d19:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d1e:	48 b8 94 28 80 00 00 	movabs $0x802894,%rax
+  804d25:	00 00 00 
+  804d28:	ff d0                	call   *%rax
+  804d2a:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804d2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d31:	4c 89 e6             	mov    %r12,%rsi
+  804d34:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d39:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  804d40:	00 00 00 
+  804d43:	ff d0                	call   *%rax
+    return res >= 0;
+  804d45:	89 d8                	mov    %ebx,%eax
+  804d47:	f7 d0                	not    %eax
+  804d49:	c1 e8 1f             	shr    $0x1f,%eax
+  804d4c:	eb 05                	jmp    804d53 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804d53:	48 83 c4 18          	add    $0x18,%rsp
+  804d57:	5b                   	pop    %rbx
+  804d58:	41 5c                	pop    %r12
+  804d5a:	41 5d                	pop    %r13
+  804d5c:	41 5e                	pop    %r14
+  804d5e:	41 5f                	pop    %r15
+  804d60:	5d                   	pop    %rbp
+  804d61:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804d62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d66:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804d6a:	4c 03 30             	add    (%rax),%r14
+  804d6d:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804d74:	49 39 c6             	cmp    %rax,%r14
+  804d77:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804d7b:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804d82:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804d88:	49 bf 46 48 80 00 00 	movabs $0x804846,%r15
+  804d8f:	00 00 00 
+  804d92:	4d 39 f4             	cmp    %r14,%r12
+  804d95:	73 1d                	jae    804db4 <mmap_pgfault+0x1a8>
+  804d97:	4c 89 e7             	mov    %r12,%rdi
+  804d9a:	41 ff d7             	call   *%r15
+  804d9d:	84 c0                	test   %al,%al
+  804d9f:	75 13                	jne    804db4 <mmap_pgfault+0x1a8>
+  804da1:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804da8:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804daf:	4d 39 f4             	cmp    %r14,%r12
+  804db2:	72 e3                	jb     804d97 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804db4:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804dba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dbe:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804dc2:	74 2a                	je     804dee <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804dc4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dc8:	89 de                	mov    %ebx,%esi
+  804dca:	2b 30                	sub    (%rax),%esi
+  804dcc:	03 70 1c             	add    0x1c(%rax),%esi
+  804dcf:	8b 78 18             	mov    0x18(%rax),%edi
+  804dd2:	4c 89 e9             	mov    %r13,%rcx
+  804dd5:	48 89 da             	mov    %rbx,%rdx
+  804dd8:	48 b8 a4 3f 80 00 00 	movabs $0x803fa4,%rax
+  804ddf:	00 00 00 
+  804de2:	ff d0                	call   *%rax
+    return res > 0;
+  804de4:	85 c0                	test   %eax,%eax
+  804de6:	0f 9f c0             	setg   %al
+  804de9:	e9 65 ff ff ff       	jmp    804d53 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804dee:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804df2:	eb d0                	jmp    804dc4 <mmap_pgfault+0x1b8>
+
+0000000000804df4 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804df4:	55                   	push   %rbp
+  804df5:	48 89 e5             	mov    %rsp,%rbp
+  804df8:	41 57                	push   %r15
+  804dfa:	41 56                	push   %r14
+  804dfc:	41 55                	push   %r13
+  804dfe:	41 54                	push   %r12
+  804e00:	53                   	push   %rbx
+  804e01:	48 83 ec 28          	sub    $0x28,%rsp
+  804e05:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804e09:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804e0c:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804e13:	ff ff ff 
+  804e16:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e1f:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804e26:	00 00 00 
+  804e29:	48 39 ca             	cmp    %rcx,%rdx
+  804e2c:	0f 85 e5 00 00 00    	jne    804f17 <mmap_writeback+0x123>
+  804e32:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804e35:	4c 39 ee             	cmp    %r13,%rsi
+  804e38:	0f 83 e8 00 00 00    	jae    804f26 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804e3e:	49 be 46 48 80 00 00 	movabs $0x804846,%r14
+  804e45:	00 00 00 
+  804e48:	49 bf 2d 48 80 00 00 	movabs $0x80482d,%r15
+  804e4f:	00 00 00 
+  804e52:	eb 10                	jmp    804e64 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804e54:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804e5b:	4d 39 ec             	cmp    %r13,%r12
+  804e5e:	0f 83 ae 00 00 00    	jae    804f12 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804e64:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804e68:	4c 89 e7             	mov    %r12,%rdi
+  804e6b:	41 ff d6             	call   *%r14
+  804e6e:	84 c0                	test   %al,%al
+  804e70:	74 e2                	je     804e54 <mmap_writeback+0x60>
+  804e72:	4c 89 e7             	mov    %r12,%rdi
+  804e75:	41 ff d7             	call   *%r15
+  804e78:	84 c0                	test   %al,%al
+  804e7a:	74 d8                	je     804e54 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804e7c:	4c 89 e3             	mov    %r12,%rbx
+  804e7f:	4d 39 ec             	cmp    %r13,%r12
+  804e82:	73 20                	jae    804ea4 <mmap_writeback+0xb0>
+  804e84:	48 89 df             	mov    %rbx,%rdi
+  804e87:	41 ff d6             	call   *%r14
+  804e8a:	84 c0                	test   %al,%al
+  804e8c:	74 16                	je     804ea4 <mmap_writeback+0xb0>
+  804e8e:	48 89 df             	mov    %rbx,%rdi
+  804e91:	41 ff d7             	call   *%r15
+  804e94:	84 c0                	test   %al,%al
+  804e96:	74 0c                	je     804ea4 <mmap_writeback+0xb0>
+  804e98:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804e9f:	4c 39 eb             	cmp    %r13,%rbx
+  804ea2:	72 e0                	jb     804e84 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804ea4:	48 89 d9             	mov    %rbx,%rcx
+  804ea7:	4c 29 e1             	sub    %r12,%rcx
+  804eaa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804eae:	44 89 e6             	mov    %r12d,%esi
+  804eb1:	2b 30                	sub    (%rax),%esi
+  804eb3:	49 89 c4             	mov    %rax,%r12
+  804eb6:	03 70 1c             	add    0x1c(%rax),%esi
+  804eb9:	8b 78 18             	mov    0x18(%rax),%edi
+  804ebc:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804ec0:	48 89 ca             	mov    %rcx,%rdx
+  804ec3:	48 b8 2d 40 80 00 00 	movabs $0x80402d,%rax
+  804eca:	00 00 00 
+  804ecd:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804ecf:	85 c0                	test   %eax,%eax
+  804ed1:	78 44                	js     804f17 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804ed3:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804ed8:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804edb:	41 89 c1             	mov    %eax,%r9d
+  804ede:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804ee5:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804ee9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804eed:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ef2:	48 89 ce             	mov    %rcx,%rsi
+  804ef5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804efa:	48 b8 94 28 80 00 00 	movabs $0x802894,%rax
+  804f01:	00 00 00 
+  804f04:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804f06:	85 c0                	test   %eax,%eax
+  804f08:	78 0d                	js     804f17 <mmap_writeback+0x123>
+  804f0a:	49 89 dc             	mov    %rbx,%r12
+  804f0d:	e9 49 ff ff ff       	jmp    804e5b <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804f12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f17:	48 83 c4 28          	add    $0x28,%rsp
+  804f1b:	5b                   	pop    %rbx
+  804f1c:	41 5c                	pop    %r12
+  804f1e:	41 5d                	pop    %r13
+  804f20:	41 5e                	pop    %r14
+  804f22:	41 5f                	pop    %r15
+  804f24:	5d                   	pop    %rbp
+  804f25:	c3                   	ret
+    return 0;
+  804f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f2b:	eb ea                	jmp    804f17 <mmap_writeback+0x123>
+
+0000000000804f2d <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804f2d:	55                   	push   %rbp
+  804f2e:	48 89 e5             	mov    %rsp,%rbp
+  804f31:	41 57                	push   %r15
+  804f33:	41 56                	push   %r14
+  804f35:	41 55                	push   %r13
+  804f37:	41 54                	push   %r12
+  804f39:	53                   	push   %rbx
+  804f3a:	48 83 ec 38          	sub    $0x38,%rsp
+  804f3e:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f42:	48 85 f6             	test   %rsi,%rsi
+  804f45:	0f 84 0c 02 00 00    	je     805157 <mmap+0x22a>
+  804f4b:	49 89 ff             	mov    %rdi,%r15
+  804f4e:	49 89 f4             	mov    %rsi,%r12
+  804f51:	41 89 d5             	mov    %edx,%r13d
+  804f54:	41 89 ce             	mov    %ecx,%r14d
+  804f57:	44 89 cb             	mov    %r9d,%ebx
+  804f5a:	45 85 c9             	test   %r9d,%r9d
+  804f5d:	0f 88 f4 01 00 00    	js     805157 <mmap+0x22a>
+  804f63:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f6a:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804f71:	0f 85 e7 01 00 00    	jne    80515e <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804f77:	83 e2 fd             	and    $0xfffffffd,%edx
+  804f7a:	83 fa 04             	cmp    $0x4,%edx
+  804f7d:	0f 85 db 01 00 00    	jne    80515e <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804f83:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804f86:	83 fa 01             	cmp    $0x1,%edx
+  804f89:	0f 87 cf 01 00 00    	ja     80515e <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804f8f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804f93:	44 89 c7             	mov    %r8d,%edi
+  804f96:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  804f9d:	00 00 00 
+  804fa0:	ff d0                	call   *%rax
+  804fa2:	89 c2                	mov    %eax,%edx
+  804fa4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fab:	85 d2                	test   %edx,%edx
+  804fad:	0f 88 ab 01 00 00    	js     80515e <mmap+0x231>
+  804fb3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804fb7:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804fbe:	00 00 00 
+  804fc1:	8b 09                	mov    (%rcx),%ecx
+  804fc3:	39 0a                	cmp    %ecx,(%rdx)
+  804fc5:	0f 85 93 01 00 00    	jne    80515e <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804fcb:	8b 52 08             	mov    0x8(%rdx),%edx
+  804fce:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804fd1:	83 fa 01             	cmp    $0x1,%edx
+  804fd4:	0f 84 84 01 00 00    	je     80515e <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804fda:	41 83 fe 01          	cmp    $0x1,%r14d
+  804fde:	74 42                	je     805022 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804fe0:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804fe7:	4c 89 e6             	mov    %r12,%rsi
+  804fea:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ff1:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ff5:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ff9:	4d 85 ff             	test   %r15,%r15
+  804ffc:	74 67                	je     805065 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ffe:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805005:	75 0f                	jne    805016 <mmap+0xe9>
+  805007:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  80500e:	00 00 00 
+  805011:	49 39 c7             	cmp    %rax,%r15
+  805014:	77 1b                	ja     805031 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805016:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80501d:	e9 3c 01 00 00       	jmp    80515e <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805022:	41 f6 c5 02          	test   $0x2,%r13b
+  805026:	74 b8                	je     804fe0 <mmap+0xb3>
+  805028:	85 d2                	test   %edx,%edx
+  80502a:	75 b4                	jne    804fe0 <mmap+0xb3>
+  80502c:	e9 2d 01 00 00       	jmp    80515e <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805031:	4c 89 ff             	mov    %r15,%rdi
+  805034:	48 b8 9b 4b 80 00 00 	movabs $0x804b9b,%rax
+  80503b:	00 00 00 
+  80503e:	ff d0                	call   *%rax
+  805040:	48 89 c2             	mov    %rax,%rdx
+  805043:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80504a:	49 39 d7             	cmp    %rdx,%r15
+  80504d:	0f 85 0b 01 00 00    	jne    80515e <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805053:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80505a:	00 00 00 
+  80505d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805063:	eb 44                	jmp    8050a9 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805065:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805069:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805070:	00 00 00 
+  805073:	48 b8 9b 4b 80 00 00 	movabs $0x804b9b,%rax
+  80507a:	00 00 00 
+  80507d:	ff d0                	call   *%rax
+  80507f:	48 89 c7             	mov    %rax,%rdi
+  805082:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805086:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80508d:	48 85 ff             	test   %rdi,%rdi
+  805090:	75 c1                	jne    805053 <mmap+0x126>
+  805092:	e9 c7 00 00 00       	jmp    80515e <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805097:	49 83 c4 01          	add    $0x1,%r12
+  80509b:	48 83 c0 20          	add    $0x20,%rax
+  80509f:	49 83 fc 20          	cmp    $0x20,%r12
+  8050a3:	0f 84 a5 00 00 00    	je     80514e <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8050a9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8050ad:	75 e8                	jne    805097 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  8050af:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8050b3:	48 b8 e7 32 80 00 00 	movabs $0x8032e7,%rax
+  8050ba:	00 00 00 
+  8050bd:	ff d0                	call   *%rax
+  8050bf:	89 c2                	mov    %eax,%edx
+  8050c1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050c8:	85 d2                	test   %edx,%edx
+  8050ca:	0f 88 8e 00 00 00    	js     80515e <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8050d0:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8050d4:	48 b8 b9 32 80 00 00 	movabs $0x8032b9,%rax
+  8050db:	00 00 00 
+  8050de:	ff d0                	call   *%rax
+  8050e0:	89 c6                	mov    %eax,%esi
+  8050e2:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8050e5:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  8050ec:	00 00 00 
+  8050ef:	ff d0                	call   *%rax
+  8050f1:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8050f4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050fb:	45 85 ff             	test   %r15d,%r15d
+  8050fe:	78 5e                	js     80515e <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805100:	49 c1 e4 05          	shl    $0x5,%r12
+  805104:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80510b:	00 00 00 
+  80510e:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805111:	48 bf 0c 4c 80 00 00 	movabs $0x804c0c,%rdi
+  805118:	00 00 00 
+  80511b:	48 b8 da 56 80 00 00 	movabs $0x8056da,%rax
+  805122:	00 00 00 
+  805125:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805127:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80512b:	49 89 04 24          	mov    %rax,(%r12)
+  80512f:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805133:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805138:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  80513d:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805142:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805147:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  80514c:	eb 10                	jmp    80515e <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  80514e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805155:	eb 07                	jmp    80515e <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805157:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  80515e:	48 83 c4 38          	add    $0x38,%rsp
+  805162:	5b                   	pop    %rbx
+  805163:	41 5c                	pop    %r12
+  805165:	41 5d                	pop    %r13
+  805167:	41 5e                	pop    %r14
+  805169:	41 5f                	pop    %r15
+  80516b:	5d                   	pop    %rbp
+  80516c:	c3                   	ret
+
+000000000080516d <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  80516d:	55                   	push   %rbp
+  80516e:	48 89 e5             	mov    %rsp,%rbp
+  805171:	41 57                	push   %r15
+  805173:	41 56                	push   %r14
+  805175:	41 55                	push   %r13
+  805177:	41 54                	push   %r12
+  805179:	53                   	push   %rbx
+  80517a:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80517e:	49 89 fe             	mov    %rdi,%r14
+  805181:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805188:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80518f:	00 
+  805190:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805197:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80519e:	00 00 00 
+  8051a1:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8051a8:	49 bf f4 4d 80 00 00 	movabs $0x804df4,%r15
+  8051af:	00 00 00 
+  8051b2:	eb 09                	jmp    8051bd <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051b4:	48 83 c3 20          	add    $0x20,%rbx
+  8051b8:	4c 39 eb             	cmp    %r13,%rbx
+  8051bb:	74 33                	je     8051f0 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8051bd:	48 89 df             	mov    %rbx,%rdi
+  8051c0:	48 8b 33             	mov    (%rbx),%rsi
+  8051c3:	4c 39 e6             	cmp    %r12,%rsi
+  8051c6:	73 ec                	jae    8051b4 <msync+0x47>
+  8051c8:	48 85 f6             	test   %rsi,%rsi
+  8051cb:	74 e7                	je     8051b4 <msync+0x47>
+  8051cd:	48 89 f2             	mov    %rsi,%rdx
+  8051d0:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8051d4:	49 39 d6             	cmp    %rdx,%r14
+  8051d7:	73 db                	jae    8051b4 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8051d9:	4c 39 e2             	cmp    %r12,%rdx
+  8051dc:	49 0f 47 d4          	cmova  %r12,%rdx
+  8051e0:	4c 39 f6             	cmp    %r14,%rsi
+  8051e3:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8051e7:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8051ea:	85 c0                	test   %eax,%eax
+  8051ec:	79 c6                	jns    8051b4 <msync+0x47>
+  8051ee:	eb 05                	jmp    8051f5 <msync+0x88>
+    }
+
+    return 0;
+  8051f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051f5:	48 83 c4 08          	add    $0x8,%rsp
+  8051f9:	5b                   	pop    %rbx
+  8051fa:	41 5c                	pop    %r12
+  8051fc:	41 5d                	pop    %r13
+  8051fe:	41 5e                	pop    %r14
+  805200:	41 5f                	pop    %r15
+  805202:	5d                   	pop    %rbp
+  805203:	c3                   	ret
+
+0000000000805204 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805204:	55                   	push   %rbp
+  805205:	48 89 e5             	mov    %rsp,%rbp
+  805208:	41 57                	push   %r15
+  80520a:	41 56                	push   %r14
+  80520c:	41 55                	push   %r13
+  80520e:	41 54                	push   %r12
+  805210:	53                   	push   %rbx
+  805211:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805215:	49 89 ff             	mov    %rdi,%r15
+  805218:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80521f:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805226:	00 
+  805227:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80522e:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805235:	00 00 00 
+  805238:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80523f:	48 89 d8             	mov    %rbx,%rax
+  805242:	eb 09                	jmp    80524d <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805244:	48 83 c0 20          	add    $0x20,%rax
+  805248:	4c 39 f0             	cmp    %r14,%rax
+  80524b:	74 40                	je     80528d <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80524d:	48 8b 10             	mov    (%rax),%rdx
+  805250:	4c 39 e2             	cmp    %r12,%rdx
+  805253:	73 ef                	jae    805244 <munmap+0x40>
+  805255:	48 85 d2             	test   %rdx,%rdx
+  805258:	74 ea                	je     805244 <munmap+0x40>
+  80525a:	48 89 d7             	mov    %rdx,%rdi
+  80525d:	48 03 78 08          	add    0x8(%rax),%rdi
+  805261:	49 39 ff             	cmp    %rdi,%r15
+  805264:	73 de                	jae    805244 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805266:	49 39 fc             	cmp    %rdi,%r12
+  805269:	72 05                	jb     805270 <munmap+0x6c>
+  80526b:	4c 39 fa             	cmp    %r15,%rdx
+  80526e:	73 d4                	jae    805244 <munmap+0x40>
+  805270:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805275:	48 83 c4 08          	add    $0x8,%rsp
+  805279:	5b                   	pop    %rbx
+  80527a:	41 5c                	pop    %r12
+  80527c:	41 5d                	pop    %r13
+  80527e:	41 5e                	pop    %r14
+  805280:	41 5f                	pop    %r15
+  805282:	5d                   	pop    %rbp
+  805283:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805284:	48 83 c3 20          	add    $0x20,%rbx
+  805288:	4c 39 f3             	cmp    %r14,%rbx
+  80528b:	74 5c                	je     8052e9 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80528d:	48 8b 33             	mov    (%rbx),%rsi
+  805290:	4c 39 e6             	cmp    %r12,%rsi
+  805293:	73 ef                	jae    805284 <munmap+0x80>
+  805295:	48 85 f6             	test   %rsi,%rsi
+  805298:	74 ea                	je     805284 <munmap+0x80>
+  80529a:	48 89 f2             	mov    %rsi,%rdx
+  80529d:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8052a1:	49 39 d7             	cmp    %rdx,%r15
+  8052a4:	73 de                	jae    805284 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8052a6:	48 89 df             	mov    %rbx,%rdi
+  8052a9:	48 b8 f4 4d 80 00 00 	movabs $0x804df4,%rax
+  8052b0:	00 00 00 
+  8052b3:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8052b5:	85 c0                	test   %eax,%eax
+  8052b7:	78 bc                	js     805275 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8052b9:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8052bd:	48 8b 33             	mov    (%rbx),%rsi
+  8052c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052c5:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  8052cc:	00 00 00 
+  8052cf:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8052d1:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8052d4:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  8052db:	00 00 00 
+  8052de:	ff d0                	call   *%rax
+        reg->start = 0;
+  8052e0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8052e7:	eb 9b                	jmp    805284 <munmap+0x80>
+    return 0;
+  8052e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ee:	eb 85                	jmp    805275 <munmap+0x71>
+
+00000000008052f0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8052f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052f5:	c3                   	ret
+
+00000000008052f6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8052f6:	55                   	push   %rbp
+  8052f7:	48 89 e5             	mov    %rsp,%rbp
+  8052fa:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8052fd:	48 be 65 66 80 00 00 	movabs $0x806665,%rsi
+  805304:	00 00 00 
+  805307:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  80530e:	00 00 00 
+  805311:	ff d0                	call   *%rax
+    return 0;
+}
+  805313:	b8 00 00 00 00       	mov    $0x0,%eax
+  805318:	5d                   	pop    %rbp
+  805319:	c3                   	ret
+
+000000000080531a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80531a:	55                   	push   %rbp
+  80531b:	48 89 e5             	mov    %rsp,%rbp
+  80531e:	41 57                	push   %r15
+  805320:	41 56                	push   %r14
+  805322:	41 55                	push   %r13
+  805324:	41 54                	push   %r12
+  805326:	53                   	push   %rbx
+  805327:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80532e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805335:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80533c:	00 00 00 00 
+  805340:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805347:	00 00 00 00 
+  80534b:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805352:	00 00 00 00 
+  805356:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80535d:	00 00 00 00 
+  805361:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805368:	00 00 00 00 
+  80536c:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805373:	00 00 00 00 
+  805377:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80537e:	00 
+  80537f:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805386:	00 
+  805387:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80538e:	00 
+  80538f:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805396:	00 
+  805397:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80539e:	00 
+  80539f:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8053a6:	00 
+  8053a7:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8053ae:	00 
+  8053af:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8053b6:	00 
+  8053b7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8053be:	00 
+  8053bf:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8053c6:	00 
+    for (res = 0; res < n; res += inc) {
+  8053c7:	48 85 d2             	test   %rdx,%rdx
+  8053ca:	74 7a                	je     805446 <devcons_write+0x12c>
+  8053cc:	49 89 d6             	mov    %rdx,%r14
+  8053cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8053d5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8053da:	49 bf 12 24 80 00 00 	movabs $0x802412,%r15
+  8053e1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8053e4:	4c 89 f3             	mov    %r14,%rbx
+  8053e7:	48 29 f3             	sub    %rsi,%rbx
+  8053ea:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8053ef:	48 39 c3             	cmp    %rax,%rbx
+  8053f2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8053f6:	4c 63 eb             	movslq %ebx,%r13
+  8053f9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805400:	48 01 c6             	add    %rax,%rsi
+  805403:	4c 89 ea             	mov    %r13,%rdx
+  805406:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80540d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805410:	4c 89 ee             	mov    %r13,%rsi
+  805413:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80541a:	48 b8 3f 26 80 00 00 	movabs $0x80263f,%rax
+  805421:	00 00 00 
+  805424:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805426:	41 01 dc             	add    %ebx,%r12d
+  805429:	49 63 f4             	movslq %r12d,%rsi
+  80542c:	4c 39 f6             	cmp    %r14,%rsi
+  80542f:	72 b3                	jb     8053e4 <devcons_write+0xca>
+    return res;
+  805431:	49 63 c4             	movslq %r12d,%rax
+}
+  805434:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80543b:	5b                   	pop    %rbx
+  80543c:	41 5c                	pop    %r12
+  80543e:	41 5d                	pop    %r13
+  805440:	41 5e                	pop    %r14
+  805442:	41 5f                	pop    %r15
+  805444:	5d                   	pop    %rbp
+  805445:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805446:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80544c:	eb e3                	jmp    805431 <devcons_write+0x117>
+
+000000000080544e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80544e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805451:	ba 00 00 00 00       	mov    $0x0,%edx
+  805456:	48 85 c0             	test   %rax,%rax
+  805459:	74 55                	je     8054b0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80545b:	55                   	push   %rbp
+  80545c:	48 89 e5             	mov    %rsp,%rbp
+  80545f:	41 55                	push   %r13
+  805461:	41 54                	push   %r12
+  805463:	53                   	push   %rbx
+  805464:	48 83 ec 08          	sub    $0x8,%rsp
+  805468:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80546b:	48 bb 72 26 80 00 00 	movabs $0x802672,%rbx
+  805472:	00 00 00 
+  805475:	49 bc 86 27 80 00 00 	movabs $0x802786,%r12
+  80547c:	00 00 00 
+  80547f:	eb 03                	jmp    805484 <devcons_read+0x36>
+  805481:	41 ff d4             	call   *%r12
+  805484:	ff d3                	call   *%rbx
+  805486:	85 c0                	test   %eax,%eax
+  805488:	74 f7                	je     805481 <devcons_read+0x33>
+    if (c < 0) return c;
+  80548a:	48 63 d0             	movslq %eax,%rdx
+  80548d:	78 13                	js     8054a2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80548f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805494:	83 f8 04             	cmp    $0x4,%eax
+  805497:	74 09                	je     8054a2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805499:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80549d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8054a2:	48 89 d0             	mov    %rdx,%rax
+  8054a5:	48 83 c4 08          	add    $0x8,%rsp
+  8054a9:	5b                   	pop    %rbx
+  8054aa:	41 5c                	pop    %r12
+  8054ac:	41 5d                	pop    %r13
+  8054ae:	5d                   	pop    %rbp
+  8054af:	c3                   	ret
+  8054b0:	48 89 d0             	mov    %rdx,%rax
+  8054b3:	c3                   	ret
+
+00000000008054b4 <cputchar>:
+cputchar(int ch) {
+  8054b4:	55                   	push   %rbp
+  8054b5:	48 89 e5             	mov    %rsp,%rbp
+  8054b8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8054bc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8054c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8054c5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8054c9:	48 b8 3f 26 80 00 00 	movabs $0x80263f,%rax
+  8054d0:	00 00 00 
+  8054d3:	ff d0                	call   *%rax
+}
+  8054d5:	c9                   	leave
+  8054d6:	c3                   	ret
+
+00000000008054d7 <getchar>:
+getchar(void) {
+  8054d7:	55                   	push   %rbp
+  8054d8:	48 89 e5             	mov    %rsp,%rbp
+  8054db:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8054df:	ba 01 00 00 00       	mov    $0x1,%edx
+  8054e4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8054e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054ed:	48 b8 2a 36 80 00 00 	movabs $0x80362a,%rax
+  8054f4:	00 00 00 
+  8054f7:	ff d0                	call   *%rax
+  8054f9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8054fb:	85 c0                	test   %eax,%eax
+  8054fd:	78 06                	js     805505 <getchar+0x2e>
+  8054ff:	74 08                	je     805509 <getchar+0x32>
+  805501:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805505:	89 d0                	mov    %edx,%eax
+  805507:	c9                   	leave
+  805508:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805509:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80550e:	eb f5                	jmp    805505 <getchar+0x2e>
+
+0000000000805510 <iscons>:
+iscons(int fdnum) {
+  805510:	55                   	push   %rbp
+  805511:	48 89 e5             	mov    %rsp,%rbp
+  805514:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805518:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80551c:	48 b8 47 33 80 00 00 	movabs $0x803347,%rax
+  805523:	00 00 00 
+  805526:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805528:	85 c0                	test   %eax,%eax
+  80552a:	78 18                	js     805544 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80552c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805530:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805537:	00 00 00 
+  80553a:	8b 00                	mov    (%rax),%eax
+  80553c:	39 02                	cmp    %eax,(%rdx)
+  80553e:	0f 94 c0             	sete   %al
+  805541:	0f b6 c0             	movzbl %al,%eax
+}
+  805544:	c9                   	leave
+  805545:	c3                   	ret
+
+0000000000805546 <opencons>:
+opencons(void) {
+  805546:	55                   	push   %rbp
+  805547:	48 89 e5             	mov    %rsp,%rbp
+  80554a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80554e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805552:	48 b8 e7 32 80 00 00 	movabs $0x8032e7,%rax
+  805559:	00 00 00 
+  80555c:	ff d0                	call   *%rax
+  80555e:	85 c0                	test   %eax,%eax
+  805560:	78 49                	js     8055ab <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805562:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805567:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80556c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805570:	bf 00 00 00 00       	mov    $0x0,%edi
+  805575:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  80557c:	00 00 00 
+  80557f:	ff d0                	call   *%rax
+  805581:	85 c0                	test   %eax,%eax
+  805583:	78 26                	js     8055ab <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805585:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805589:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805590:	00 00 
+  805592:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805594:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805598:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80559f:	48 b8 b9 32 80 00 00 	movabs $0x8032b9,%rax
+  8055a6:	00 00 00 
+  8055a9:	ff d0                	call   *%rax
+}
+  8055ab:	c9                   	leave
+  8055ac:	c3                   	ret
+
+00000000008055ad <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8055ad:	55                   	push   %rbp
+  8055ae:	48 89 e5             	mov    %rsp,%rbp
+  8055b1:	41 56                	push   %r14
+  8055b3:	41 55                	push   %r13
+  8055b5:	41 54                	push   %r12
+  8055b7:	53                   	push   %rbx
+  8055b8:	48 83 ec 50          	sub    $0x50,%rsp
+  8055bc:	49 89 fc             	mov    %rdi,%r12
+  8055bf:	41 89 f5             	mov    %esi,%r13d
+  8055c2:	48 89 d3             	mov    %rdx,%rbx
+  8055c5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8055c9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8055cd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8055d1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8055d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8055dc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8055e0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8055e4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8055e8:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8055ef:	00 00 00 
+  8055f2:	4c 8b 30             	mov    (%rax),%r14
+  8055f5:	48 b8 4f 27 80 00 00 	movabs $0x80274f,%rax
+  8055fc:	00 00 00 
+  8055ff:	ff d0                	call   *%rax
+  805601:	89 c6                	mov    %eax,%esi
+  805603:	45 89 e8             	mov    %r13d,%r8d
+  805606:	4c 89 e1             	mov    %r12,%rcx
+  805609:	4c 89 f2             	mov    %r14,%rdx
+  80560c:	48 bf 78 66 80 00 00 	movabs $0x806678,%rdi
+  805613:	00 00 00 
+  805616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80561b:	49 bc 8b 17 80 00 00 	movabs $0x80178b,%r12
+  805622:	00 00 00 
+  805625:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805628:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80562c:	48 89 df             	mov    %rbx,%rdi
+  80562f:	48 b8 27 17 80 00 00 	movabs $0x801727,%rax
+  805636:	00 00 00 
+  805639:	ff d0                	call   *%rax
+    cprintf("\n");
+  80563b:	48 bf 4b 65 80 00 00 	movabs $0x80654b,%rdi
+  805642:	00 00 00 
+  805645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80564a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80564d:	cc                   	int3
+  80564e:	eb fd                	jmp    80564d <_panic+0xa0>
+
+0000000000805650 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805650:	55                   	push   %rbp
+  805651:	48 89 e5             	mov    %rsp,%rbp
+  805654:	41 56                	push   %r14
+  805656:	41 55                	push   %r13
+  805658:	41 54                	push   %r12
+  80565a:	53                   	push   %rbx
+  80565b:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80565e:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805665:	00 00 00 
+  805668:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80566c:	74 27                	je     805695 <_handle_vectored_pagefault+0x45>
+  80566e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805673:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80567a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80567d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805680:	4c 89 e7             	mov    %r12,%rdi
+  805683:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805688:	84 c0                	test   %al,%al
+  80568a:	75 45                	jne    8056d1 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80568c:	48 83 c3 01          	add    $0x1,%rbx
+  805690:	49 3b 1e             	cmp    (%r14),%rbx
+  805693:	72 eb                	jb     805680 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805695:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80569c:	00 
+  80569d:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8056a2:	4d 8b 04 24          	mov    (%r12),%r8
+  8056a6:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  8056ad:	00 00 00 
+  8056b0:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8056b5:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  8056bc:	00 00 00 
+  8056bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056c4:	49 ba ad 55 80 00 00 	movabs $0x8055ad,%r10
+  8056cb:	00 00 00 
+  8056ce:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8056d1:	5b                   	pop    %rbx
+  8056d2:	41 5c                	pop    %r12
+  8056d4:	41 5d                	pop    %r13
+  8056d6:	41 5e                	pop    %r14
+  8056d8:	5d                   	pop    %rbp
+  8056d9:	c3                   	ret
+
+00000000008056da <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8056da:	55                   	push   %rbp
+  8056db:	48 89 e5             	mov    %rsp,%rbp
+  8056de:	53                   	push   %rbx
+  8056df:	48 83 ec 08          	sub    $0x8,%rsp
+  8056e3:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8056e6:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8056eb:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8056f2:	00 00 00 
+  8056f5:	80 38 00             	cmpb   $0x0,(%rax)
+  8056f8:	74 68                	je     805762 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056fa:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805701:	00 00 00 
+  805704:	48 8b 08             	mov    (%rax),%rcx
+  805707:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80570c:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805713:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805716:	48 85 c9             	test   %rcx,%rcx
+  805719:	0f 84 e0 00 00 00    	je     8057ff <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80571f:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805723:	0f 84 c9 00 00 00    	je     8057f2 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805729:	48 83 c2 01          	add    $0x1,%rdx
+  80572d:	48 39 ca             	cmp    %rcx,%rdx
+  805730:	75 ed                	jne    80571f <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805732:	48 83 f9 08          	cmp    $0x8,%rcx
+  805736:	0f 84 84 00 00 00    	je     8057c0 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80573c:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805740:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805747:	00 00 00 
+  80574a:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805751:	00 00 00 
+  805754:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805758:	85 f6                	test   %esi,%esi
+  80575a:	0f 89 97 00 00 00    	jns    8057f7 <add_pgfault_handler+0x11d>
+  805760:	eb 63                	jmp    8057c5 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805762:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805767:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80576c:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805773:	00 00 00 
+  805776:	bf 00 00 00 00       	mov    $0x0,%edi
+  80577b:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  805782:	00 00 00 
+  805785:	ff d0                	call   *%rax
+  805787:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805789:	85 c0                	test   %eax,%eax
+  80578b:	78 38                	js     8057c5 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80578d:	48 be db 58 80 00 00 	movabs $0x8058db,%rsi
+  805794:	00 00 00 
+  805797:	bf 00 00 00 00       	mov    $0x0,%edi
+  80579c:	48 b8 4a 2a 80 00 00 	movabs $0x802a4a,%rax
+  8057a3:	00 00 00 
+  8057a6:	ff d0                	call   *%rax
+  8057a8:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057aa:	85 c0                	test   %eax,%eax
+  8057ac:	78 17                	js     8057c5 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8057ae:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8057b5:	00 00 00 
+  8057b8:	c6 00 01             	movb   $0x1,(%rax)
+  8057bb:	e9 3a ff ff ff       	jmp    8056fa <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8057c0:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8057c5:	89 f1                	mov    %esi,%ecx
+  8057c7:	48 ba de 66 80 00 00 	movabs $0x8066de,%rdx
+  8057ce:	00 00 00 
+  8057d1:	be 42 00 00 00       	mov    $0x42,%esi
+  8057d6:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  8057dd:	00 00 00 
+  8057e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057e5:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  8057ec:	00 00 00 
+  8057ef:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8057f2:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8057f7:	89 f0                	mov    %esi,%eax
+  8057f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8057fd:	c9                   	leave
+  8057fe:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8057ff:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805806:	00 00 00 
+  805809:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805810:	48 89 d8             	mov    %rbx,%rax
+  805813:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  80581a:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80581d:	eb d8                	jmp    8057f7 <add_pgfault_handler+0x11d>
+
+000000000080581f <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80581f:	55                   	push   %rbp
+  805820:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805823:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80582a:	00 00 00 
+  80582d:	80 38 00             	cmpb   $0x0,(%rax)
+  805830:	74 33                	je     805865 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805832:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805839:	00 00 00 
+  80583c:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805841:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805848:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80584b:	48 85 c0             	test   %rax,%rax
+  80584e:	0f 84 85 00 00 00    	je     8058d9 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805854:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805858:	74 40                	je     80589a <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80585a:	48 83 c1 01          	add    $0x1,%rcx
+  80585e:	48 39 c1             	cmp    %rax,%rcx
+  805861:	75 f1                	jne    805854 <remove_pgfault_handler+0x35>
+  805863:	eb 74                	jmp    8058d9 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805865:	48 b9 f6 66 80 00 00 	movabs $0x8066f6,%rcx
+  80586c:	00 00 00 
+  80586f:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  805876:	00 00 00 
+  805879:	be 48 00 00 00       	mov    $0x48,%esi
+  80587e:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  805885:	00 00 00 
+  805888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80588d:	49 b8 ad 55 80 00 00 	movabs $0x8055ad,%r8
+  805894:	00 00 00 
+  805897:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80589a:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8058a1:	00 
+  8058a2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8058a6:	48 29 ca             	sub    %rcx,%rdx
+  8058a9:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8058b0:	00 00 00 
+  8058b3:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8058b7:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8058bc:	48 89 ce             	mov    %rcx,%rsi
+  8058bf:	48 b8 12 24 80 00 00 	movabs $0x802412,%rax
+  8058c6:	00 00 00 
+  8058c9:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8058cb:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8058d2:	00 00 00 
+  8058d5:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8058d9:	5d                   	pop    %rbp
+  8058da:	c3                   	ret
+
+00000000008058db <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8058db:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8058de:	48 b8 50 56 80 00 00 	movabs $0x805650,%rax
+  8058e5:	00 00 00 
+    call *%rax
+  8058e8:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8058ea:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8058f1:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8058f2:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8058f9:	00 
+    subq $8, %rcx
+  8058fa:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8058fe:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805901:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805908:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805909:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  80590d:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805911:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805916:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80591b:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805920:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805925:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80592a:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80592f:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805934:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805939:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80593e:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805943:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805948:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80594d:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805952:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805957:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80595b:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80595f:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805960:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805961:	c3                   	ret
+  805962:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000805968 <__rodata_start>:
+  805968:	77 00                	ja     80596a <__rodata_start+0x2>
+  80596a:	72 62                	jb     8059ce <__rodata_start+0x66>
+  80596c:	00 77 62             	add    %dh,0x62(%rdi)
+  80596f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805972:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805979:	00 
+  80597a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  805980:	b3 09                	mov    $0x9,%bl
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 ed                	add    %ch,%ch
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 ed                	add    %ch,%ch
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	8c 0a                	mov    %cs,(%rdx)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	8c 0a                	mov    %cs,(%rdx)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	8c 0a                	mov    %cs,(%rdx)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	8c 0a                	mov    %cs,(%rdx)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	8c 0a                	mov    %cs,(%rdx)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	ed                   	in     (%dx),%eax
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	f4                   	hlt
+  805b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b1f:	00 ed                	add    %ch,%ch
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	2c 0b                	sub    $0xb,%al
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 ed                	add    %ch,%ch
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805b73:	00 00                	add    %al,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 cb                	add    %cl,%bl
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	6a 0a                	push   $0xa
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 ed                	add    %ch,%ch
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	3c 0a                	cmp    $0xa,%al
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 ed                	add    %ch,%ch
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805bcb:	00 00                	add    %al,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 29                	add    %ch,(%rcx)
+  805bd9:	0c 80                	or     $0x80,%al
+  805bdb:	00 00                	add    %al,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 ed                	add    %ch,%ch
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	1a 0b                	sbb    (%rbx),%cl
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 ed                	add    %ch,%ch
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ce                   	(bad)
+  805c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c07:	00 ed                	add    %ch,%ch
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	f4                   	hlt
+  805c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c1f:	00 37                	add    %dh,(%rdi)
+  805c21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 37                	add    %dh,(%rdi)
+  805c31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805c4b:	00 00                	add    %al,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 d2                	add    %dl,%dl
+  805c51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c57:	00 d2                	add    %dl,%dl
+  805c59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c5f:	00 d2                	add    %dl,%dl
+  805c61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c67:	00 d2                	add    %dl,%dl
+  805c69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c6f:	00 d2                	add    %dl,%dl
+  805c71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c77:	00 d2                	add    %dl,%dl
+  805c79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c7f:	00 d2                	add    %dl,%dl
+  805c81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c87:	00 f6                	add    %dh,%dh
+  805c89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c8f:	00 f6                	add    %dh,%dh
+  805c91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 22                	add    %ah,(%rdx)
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 22                	add    %ah,(%rdx)
+  805cd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cdf:	00 22                	add    %ah,(%rdx)
+  805ce1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ce7:	00 22                	add    %ah,(%rdx)
+  805ce9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cef:	00 22                	add    %ah,(%rdx)
+  805cf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cf7:	00 22                	add    %ah,(%rdx)
+  805cf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 46 12             	add    %al,0x12(%rsi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 22                	add    %ah,(%rdx)
+  805dd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dd7:	00 22                	add    %ah,(%rdx)
+  805dd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ddf:	00 22                	add    %ah,(%rdx)
+  805de1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805de7:	00 22                	add    %ah,(%rdx)
+  805de9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805def:	00 22                	add    %ah,(%rdx)
+  805df1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805df7:	00 22                	add    %ah,(%rdx)
+  805df9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 46 12             	add    %al,0x12(%rsi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805ea0 <basefix.0>:
+  805ea0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805eb0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805ec0:	10 00 73 65 6e 64 20 30 20 66 72 6f 6d 20 25 78     ..send 0 from %x
+  805ed0:	20 74 6f 20 25 78 0a 00 25 78 20 67 6f 74 20 25      to %x..%x got %
+  805ee0:	64 20 66 72 6f 6d 20 25 78 0a 00 3c 75 6e 6b 6e     d from %x..<unkn
+  805ef0:	6f 77 6e 3e 00 30 31 32 33 34 35 36 37 38 39 41     own>.0123456789A
+  805f00:	42 43 44 45 46 00 30 31 32 33 34 35 36 37 38 39     BCDEF.0123456789
+  805f10:	61 62 63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72     abcdef.(null).er
+  805f20:	72 6f 72 20 25 64 00 75 6e 73 70 65 63 69 66 69     ror %d.unspecifi
+  805f30:	65 64 20 65 72 72 6f 72 00 62 61 64 20 65 6e 76     ed error.bad env
+  805f40:	69 72 6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64     ironment.invalid
+  805f50:	20 70 61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f      parameter.out o
+  805f60:	66 20 6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20     f memory.out of 
+  805f70:	65 6e 76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72     environments.cor
+  805f80:	72 75 70 74 65 64 20 64 65 62 75 67 20 69 6e 66     rupted debug inf
+  805f90:	6f 00 73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66     o.segmentation f
+  805fa0:	61 75 6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46     ault.invalid ELF
+  805fb0:	20 69 6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73      image.no such s
+  805fc0:	79 73 74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79     ystem call.entry
+  805fd0:	20 6e 6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69      not found.env i
+  805fe0:	73 20 6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e     s not recving.un
+  805ff0:	65 78 70 65 63 74 65 64 20 65 6e 64 20 6f 66 20     expected end of 
+  806000:	66 69 6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61     file.no free spa
+  806010:	63 65 20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d     ce on disk.too m
+  806020:	61 6e 79 20 66 69 6c 65 73 20 61 72 65 20 6f 70     any files are op
+  806030:	65 6e 00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b     en.file or block
+  806040:	20 6e 6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c      not found.inval
+  806050:	69 64 20 70 61 74 68 00 66 69 6c 65 20 61 6c 72     id path.file alr
+  806060:	65 61 64 79 20 65 78 69 73 74 73 00 6f 70 65 72     eady exists.oper
+  806070:	61 74 69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72     ation not suppor
+  806080:	74 65 64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ted.f.........f.
+  806090:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
+  8060a0:	83 19 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8060b0:	ca 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8060c0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8060d0:	da 1f 80 00 00 00 00 00 a2 19 80 00 00 00 00 00     ................
+  8060e0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8060f0:	96 19 80 00 00 00 00 00 10 1a 80 00 00 00 00 00     ................
+  806100:	da 1f 80 00 00 00 00 00 96 19 80 00 00 00 00 00     ................
+  806110:	dc 19 80 00 00 00 00 00 dc 19 80 00 00 00 00 00     ................
+  806120:	dc 19 80 00 00 00 00 00 dc 19 80 00 00 00 00 00     ................
+  806130:	dc 19 80 00 00 00 00 00 dc 19 80 00 00 00 00 00     ................
+  806140:	dc 19 80 00 00 00 00 00 dc 19 80 00 00 00 00 00     ................
+  806150:	dc 19 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806160:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806170:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806180:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806190:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8061a0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8061b0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8061c0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8061d0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8061e0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8061f0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806200:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806210:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806220:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806230:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806240:	da 1f 80 00 00 00 00 00 f8 1e 80 00 00 00 00 00     ................
+  806250:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806260:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806270:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806280:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806290:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8062a0:	3e 1a 80 00 00 00 00 00 0d 1c 80 00 00 00 00 00     >...............
+  8062b0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  8062c0:	da 1f 80 00 00 00 00 00 33 1a 80 00 00 00 00 00     ........3.......
+  8062d0:	6d 1a 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     m...............
+  8062e0:	da 1f 80 00 00 00 00 00 28 1a 80 00 00 00 00 00     ........(.......
+  8062f0:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806300:	b6 1d 80 00 00 00 00 00 85 1e 80 00 00 00 00 00     ................
+  806310:	da 1f 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806320:	04 1b 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806330:	e1 1c 80 00 00 00 00 00 da 1f 80 00 00 00 00 00     ................
+  806340:	da 1f 80 00 00 00 00 00 f8 1e 80 00 00 00 00 00     ................
+  806350:	da 1f 80 00 00 00 00 00 8c 19 80 00 00 00 00 00     ................
+
+0000000000806360 <error_string>:
+	...
+  806368:	27 5f 80 00 00 00 00 00 39 5f 80 00 00 00 00 00     '_......9_......
+  806378:	49 5f 80 00 00 00 00 00 5b 5f 80 00 00 00 00 00     I_......[_......
+  806388:	69 5f 80 00 00 00 00 00 7d 5f 80 00 00 00 00 00     i_......}_......
+  806398:	92 5f 80 00 00 00 00 00 a5 5f 80 00 00 00 00 00     ._......._......
+  8063a8:	b7 5f 80 00 00 00 00 00 cb 5f 80 00 00 00 00 00     ._......._......
+  8063b8:	db 5f 80 00 00 00 00 00 ee 5f 80 00 00 00 00 00     ._......._......
+  8063c8:	05 60 80 00 00 00 00 00 1b 60 80 00 00 00 00 00     .`.......`......
+  8063d8:	33 60 80 00 00 00 00 00 4b 60 80 00 00 00 00 00     3`......K`......
+  8063e8:	58 60 80 00 00 00 00 00 00 64 80 00 00 00 00 00     X`.......d......
+  8063f8:	6c 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     l`......file is 
+  806408:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806418:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806428:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806438:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806448:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806458:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806468:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806478:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806488:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806498:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8064a8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8064b8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  8064c8:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 69     ult_upcall: %i.i
+  8064d8:	70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f     pc_send: %i.lib/
+  8064e8:	69 70 63 2e 63 00 66 90 5b 25 30 38 78 5d 20 75     ipc.c.f.[%08x] u
+  8064f8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806508:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806518:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806528:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  806538:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  806548:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  806558:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  806568:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806578:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806580 <devtab>:
+  806580:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806590:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8065a0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8065b0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8065c0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8065d0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8065e0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8065f0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806600:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806610:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806620:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806630:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806640:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806650:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806660:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806670:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806680:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806690:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  8066a0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8066b0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8066c0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8066d0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8066e0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8066f0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806700:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,10536 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 be 23 80 00 00 	movabs $0x8023be,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 de 20 80 00 00 	movabs $0x8020de,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 3f 22 80 00 00 	movabs $0x80223f,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 b3 37 80 00 00 	movabs $0x8037b3,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 de 20 80 00 00 	movabs $0x8020de,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 b3 37 80 00 00 	movabs $0x8037b3,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 4e 20 80 00 00 	movabs $0x80204e,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 4e 20 80 00 00 	movabs $0x80204e,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 15 17 80 00 00 	movabs $0x801715,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be ec 5f 80 00 00 	movabs $0x805fec,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be c0 59 80 00 00 	movabs $0x8059c0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be c2 59 80 00 00 	movabs $0x8059c2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be c5 59 80 00 00 	movabs $0x8059c5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 87 4f 80 00 00 	movabs $0x804f87,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 5e 52 80 00 00 	movabs $0x80525e,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 06 35 80 00 00 	movabs $0x803506,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 9d 38 80 00 00 	movabs $0x80389d,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 66 39 80 00 00 	movabs $0x803966,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 6c 38 80 00 00 	movabs $0x80386c,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 6c 38 80 00 00 	movabs $0x80386c,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 84 36 80 00 00 	movabs $0x803684,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 b3 37 80 00 00 	movabs $0x8037b3,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 06 35 80 00 00 	movabs $0x803506,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 de 20 80 00 00 	movabs $0x8020de,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 8b 23 80 00 00 	movabs $0x80238b,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 59 80 00 00 	movabs $0x8059e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 be 23 80 00 00 	movabs $0x8023be,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 8b 23 80 00 00 	movabs $0x80238b,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 5c 80 00 00 	movabs $0x805c80,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 8b 23 80 00 00 	movabs $0x80238b,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 8b 23 80 00 00 	movabs $0x80238b,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5f 80 00 00 	movabs $0x805f00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5f 80 00 00 	movabs $0x805f00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 e3 25 80 00 00 	movabs $0x8025e3,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 e3 25 80 00 00 	movabs $0x8025e3,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 6d 01 00 00       	call   80166c <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = sfork()) != 0) {
+  801512:	48 b8 63 30 80 00 00 	movabs $0x803063,%rax
+  801519:	00 00 00 
+  80151c:	ff d0                	call   *%rax
+  80151e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  801521:	85 c0                	test   %eax,%eax
+  801523:	0f 85 c3 00 00 00    	jne    8015ec <umain+0xeb>
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        ipc_recv(&who, 0, 0, 0);
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  801529:	48 bb 20 80 80 01 00 	movabs $0x1808020,%rbx
+  801530:	00 00 00 
+        ipc_recv(&who, 0, 0, 0);
+  801533:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801538:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153d:	be 00 00 00 00       	mov    $0x0,%esi
+  801542:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  801546:	48 b8 06 31 80 00 00 	movabs $0x803106,%rax
+  80154d:	00 00 00 
+  801550:	ff d0                	call   *%rax
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  801552:	48 b8 28 80 80 01 00 	movabs $0x1808028,%rax
+  801559:	00 00 00 
+  80155c:	4c 8b 20             	mov    (%rax),%r12
+  80155f:	45 8b bc 24 c8 00 00 	mov    0xc8(%r12),%r15d
+  801566:	00 
+  801567:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  80156b:	44 8b 2b             	mov    (%rbx),%r13d
+  80156e:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  801575:	00 00 00 
+  801578:	ff d0                	call   *%rax
+  80157a:	89 c6                	mov    %eax,%esi
+  80157c:	45 89 f9             	mov    %r15d,%r9d
+  80157f:	4d 89 e0             	mov    %r12,%r8
+  801582:	44 89 f1             	mov    %r14d,%ecx
+  801585:	44 89 ea             	mov    %r13d,%edx
+  801588:	48 bf 58 5f 80 00 00 	movabs $0x805f58,%rdi
+  80158f:	00 00 00 
+  801592:	b8 00 00 00 00       	mov    $0x0,%eax
+  801597:	49 ba e5 17 80 00 00 	movabs $0x8017e5,%r10
+  80159e:	00 00 00 
+  8015a1:	41 ff d2             	call   *%r10
+        if (val == 10) return;
+  8015a4:	8b 03                	mov    (%rbx),%eax
+  8015a6:	83 f8 0a             	cmp    $0xa,%eax
+  8015a9:	74 32                	je     8015dd <umain+0xdc>
+        ++val;
+  8015ab:	83 c0 01             	add    $0x1,%eax
+  8015ae:	89 03                	mov    %eax,(%rbx)
+        ipc_send(who, 0, 0, 0, 0);
+  8015b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8015c8:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  8015cf:	00 00 00 
+  8015d2:	ff d0                	call   *%rax
+        if (val == 10) return;
+  8015d4:	83 3b 0a             	cmpl   $0xa,(%rbx)
+  8015d7:	0f 85 56 ff ff ff    	jne    801533 <umain+0x32>
+    }
+}
+  8015dd:	48 83 c4 18          	add    $0x18,%rsp
+  8015e1:	5b                   	pop    %rbx
+  8015e2:	41 5c                	pop    %r12
+  8015e4:	41 5d                	pop    %r13
+  8015e6:	41 5e                	pop    %r14
+  8015e8:	41 5f                	pop    %r15
+  8015ea:	5d                   	pop    %rbp
+  8015eb:	c3                   	ret
+        cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8015ec:	48 b8 28 80 80 01 00 	movabs $0x1808028,%rax
+  8015f3:	00 00 00 
+  8015f6:	48 8b 18             	mov    (%rax),%rbx
+  8015f9:	49 bc a9 27 80 00 00 	movabs $0x8027a9,%r12
+  801600:	00 00 00 
+  801603:	41 ff d4             	call   *%r12
+  801606:	89 c6                	mov    %eax,%esi
+  801608:	48 89 da             	mov    %rbx,%rdx
+  80160b:	48 bf 22 5f 80 00 00 	movabs $0x805f22,%rdi
+  801612:	00 00 00 
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161a:	48 bb e5 17 80 00 00 	movabs $0x8017e5,%rbx
+  801621:	00 00 00 
+  801624:	ff d3                	call   *%rbx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  801626:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  80162a:	41 ff d4             	call   *%r12
+  80162d:	89 c6                	mov    %eax,%esi
+  80162f:	44 89 ea             	mov    %r13d,%edx
+  801632:	48 bf 3c 5f 80 00 00 	movabs $0x805f3c,%rdi
+  801639:	00 00 00 
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	ff d3                	call   *%rbx
+        ipc_send(who, 0, 0, 0, 0);
+  801643:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801649:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801653:	be 00 00 00 00       	mov    $0x0,%esi
+  801658:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80165b:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  801662:	00 00 00 
+  801665:	ff d0                	call   *%rax
+  801667:	e9 bd fe ff ff       	jmp    801529 <umain+0x28>
+
+000000000080166c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+  801670:	41 56                	push   %r14
+  801672:	41 55                	push   %r13
+  801674:	41 54                	push   %r12
+  801676:	53                   	push   %rbx
+  801677:	41 89 fd             	mov    %edi,%r13d
+  80167a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80167d:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801684:	00 00 00 
+  801687:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80168e:	00 00 00 
+  801691:	48 39 c2             	cmp    %rax,%rdx
+  801694:	73 17                	jae    8016ad <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801696:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801699:	49 89 c4             	mov    %rax,%r12
+  80169c:	48 83 c3 08          	add    $0x8,%rbx
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	ff 53 f8             	call   *-0x8(%rbx)
+  8016a8:	4c 39 e3             	cmp    %r12,%rbx
+  8016ab:	72 ef                	jb     80169c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8016ad:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  8016b4:	00 00 00 
+  8016b7:	ff d0                	call   *%rax
+  8016b9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016be:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8016c5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016cc:	00 00 00 
+  8016cf:	48 01 d0             	add    %rdx,%rax
+  8016d2:	48 a3 28 80 80 01 00 	movabs %rax,0x1808028
+  8016d9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8016dc:	45 85 ed             	test   %r13d,%r13d
+  8016df:	7e 0d                	jle    8016ee <libmain+0x82>
+  8016e1:	49 8b 06             	mov    (%r14),%rax
+  8016e4:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8016eb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8016ee:	4c 89 f6             	mov    %r14,%rsi
+  8016f1:	44 89 ef             	mov    %r13d,%edi
+  8016f4:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016fb:	00 00 00 
+  8016fe:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801700:	48 b8 15 17 80 00 00 	movabs $0x801715,%rax
+  801707:	00 00 00 
+  80170a:	ff d0                	call   *%rax
+#endif
+}
+  80170c:	5b                   	pop    %rbx
+  80170d:	41 5c                	pop    %r12
+  80170f:	41 5d                	pop    %r13
+  801711:	41 5e                	pop    %r14
+  801713:	5d                   	pop    %rbp
+  801714:	c3                   	ret
+
+0000000000801715 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801715:	55                   	push   %rbp
+  801716:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801719:	48 b8 39 35 80 00 00 	movabs $0x803539,%rax
+  801720:	00 00 00 
+  801723:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80172a:	48 b8 38 27 80 00 00 	movabs $0x802738,%rax
+  801731:	00 00 00 
+  801734:	ff d0                	call   *%rax
+}
+  801736:	5d                   	pop    %rbp
+  801737:	c3                   	ret
+
+0000000000801738 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801738:	55                   	push   %rbp
+  801739:	48 89 e5             	mov    %rsp,%rbp
+  80173c:	53                   	push   %rbx
+  80173d:	48 83 ec 08          	sub    $0x8,%rsp
+  801741:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801744:	8b 06                	mov    (%rsi),%eax
+  801746:	8d 50 01             	lea    0x1(%rax),%edx
+  801749:	89 16                	mov    %edx,(%rsi)
+  80174b:	48 98                	cltq
+  80174d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801752:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801758:	74 0a                	je     801764 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80175a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80175e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801762:	c9                   	leave
+  801763:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801764:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801768:	be ff 00 00 00       	mov    $0xff,%esi
+  80176d:	48 b8 99 26 80 00 00 	movabs $0x802699,%rax
+  801774:	00 00 00 
+  801777:	ff d0                	call   *%rax
+        state->offset = 0;
+  801779:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80177f:	eb d9                	jmp    80175a <putch+0x22>
+
+0000000000801781 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801781:	55                   	push   %rbp
+  801782:	48 89 e5             	mov    %rsp,%rbp
+  801785:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80178c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80178f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801796:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80179b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8017a3:	48 89 f1             	mov    %rsi,%rcx
+  8017a6:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8017ad:	48 bf 38 17 80 00 00 	movabs $0x801738,%rdi
+  8017b4:	00 00 00 
+  8017b7:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  8017be:	00 00 00 
+  8017c1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8017c3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8017ca:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8017d1:	48 b8 99 26 80 00 00 	movabs $0x802699,%rax
+  8017d8:	00 00 00 
+  8017db:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8017dd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+00000000008017e5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8017e5:	55                   	push   %rbp
+  8017e6:	48 89 e5             	mov    %rsp,%rbp
+  8017e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8017ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8017f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8017f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801801:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801808:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80180c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801810:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801814:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801818:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80181c:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  801823:	00 00 00 
+  801826:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801828:	c9                   	leave
+  801829:	c3                   	ret
+
+000000000080182a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80182a:	55                   	push   %rbp
+  80182b:	48 89 e5             	mov    %rsp,%rbp
+  80182e:	41 57                	push   %r15
+  801830:	41 56                	push   %r14
+  801832:	41 55                	push   %r13
+  801834:	41 54                	push   %r12
+  801836:	53                   	push   %rbx
+  801837:	48 83 ec 18          	sub    $0x18,%rsp
+  80183b:	49 89 fc             	mov    %rdi,%r12
+  80183e:	49 89 f5             	mov    %rsi,%r13
+  801841:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801845:	8b 45 10             	mov    0x10(%rbp),%eax
+  801848:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80184b:	41 89 cf             	mov    %ecx,%r15d
+  80184e:	4c 39 fa             	cmp    %r15,%rdx
+  801851:	73 5b                	jae    8018ae <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801853:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801857:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80185b:	85 db                	test   %ebx,%ebx
+  80185d:	7e 0e                	jle    80186d <print_num+0x43>
+            putch(padc, put_arg);
+  80185f:	4c 89 ee             	mov    %r13,%rsi
+  801862:	44 89 f7             	mov    %r14d,%edi
+  801865:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801868:	83 eb 01             	sub    $0x1,%ebx
+  80186b:	75 f2                	jne    80185f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80186d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801871:	48 b9 99 5f 80 00 00 	movabs $0x805f99,%rcx
+  801878:	00 00 00 
+  80187b:	48 b8 88 5f 80 00 00 	movabs $0x805f88,%rax
+  801882:	00 00 00 
+  801885:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801889:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80188d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801892:	49 f7 f7             	div    %r15
+  801895:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801899:	4c 89 ee             	mov    %r13,%rsi
+  80189c:	41 ff d4             	call   *%r12
+}
+  80189f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8018a3:	5b                   	pop    %rbx
+  8018a4:	41 5c                	pop    %r12
+  8018a6:	41 5d                	pop    %r13
+  8018a8:	41 5e                	pop    %r14
+  8018aa:	41 5f                	pop    %r15
+  8018ac:	5d                   	pop    %rbp
+  8018ad:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8018ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b7:	49 f7 f7             	div    %r15
+  8018ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8018be:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8018c2:	52                   	push   %rdx
+  8018c3:	45 0f be c9          	movsbl %r9b,%r9d
+  8018c7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8018cb:	48 89 c2             	mov    %rax,%rdx
+  8018ce:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  8018d5:	00 00 00 
+  8018d8:	ff d0                	call   *%rax
+  8018da:	48 83 c4 10          	add    $0x10,%rsp
+  8018de:	eb 8d                	jmp    80186d <print_num+0x43>
+
+00000000008018e0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8018e0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8018e4:	48 8b 06             	mov    (%rsi),%rax
+  8018e7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8018eb:	73 0a                	jae    8018f7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8018ed:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018f1:	48 89 16             	mov    %rdx,(%rsi)
+  8018f4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8018f7:	c3                   	ret
+
+00000000008018f8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8018f8:	55                   	push   %rbp
+  8018f9:	48 89 e5             	mov    %rsp,%rbp
+  8018fc:	48 83 ec 50          	sub    $0x50,%rsp
+  801900:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801904:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801908:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80190c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801913:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801917:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80191b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80191f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801923:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801927:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  80192e:	00 00 00 
+  801931:	ff d0                	call   *%rax
+}
+  801933:	c9                   	leave
+  801934:	c3                   	ret
+
+0000000000801935 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801935:	55                   	push   %rbp
+  801936:	48 89 e5             	mov    %rsp,%rbp
+  801939:	41 57                	push   %r15
+  80193b:	41 56                	push   %r14
+  80193d:	41 55                	push   %r13
+  80193f:	41 54                	push   %r12
+  801941:	53                   	push   %rbx
+  801942:	48 83 ec 38          	sub    $0x38,%rsp
+  801946:	49 89 fe             	mov    %rdi,%r14
+  801949:	49 89 f5             	mov    %rsi,%r13
+  80194c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80194f:	48 8b 01             	mov    (%rcx),%rax
+  801952:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801956:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80195a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80195e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801962:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801966:	eb 0d                	jmp    801975 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801968:	40 0f b6 ff          	movzbl %dil,%edi
+  80196c:	4c 89 ee             	mov    %r13,%rsi
+  80196f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801972:	4c 89 e3             	mov    %r12,%rbx
+  801975:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801979:	0f b6 3b             	movzbl (%rbx),%edi
+  80197c:	40 80 ff 25          	cmp    $0x25,%dil
+  801980:	74 14                	je     801996 <vprintfmt+0x61>
+            if (!ch) return;
+  801982:	40 84 ff             	test   %dil,%dil
+  801985:	75 e1                	jne    801968 <vprintfmt+0x33>
+}
+  801987:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80198b:	5b                   	pop    %rbx
+  80198c:	41 5c                	pop    %r12
+  80198e:	41 5d                	pop    %r13
+  801990:	41 5e                	pop    %r14
+  801992:	41 5f                	pop    %r15
+  801994:	5d                   	pop    %rbp
+  801995:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801996:	be 00 00 00 00       	mov    $0x0,%esi
+  80199b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80199f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8019a4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8019aa:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8019b1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8019b5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8019ba:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8019bf:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8019c2:	83 e8 23             	sub    $0x23,%eax
+  8019c5:	3c 57                	cmp    $0x57,%al
+  8019c7:	0f 87 67 06 00 00    	ja     802034 <vprintfmt+0x6ff>
+  8019cd:	0f b6 c0             	movzbl %al,%eax
+  8019d0:	48 b9 20 61 80 00 00 	movabs $0x806120,%rcx
+  8019d7:	00 00 00 
+  8019da:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8019dd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8019e0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8019e4:	eb cf                	jmp    8019b5 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8019e6:	49 89 dc             	mov    %rbx,%r12
+  8019e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8019ee:	eb c5                	jmp    8019b5 <vprintfmt+0x80>
+            padc = ch;
+  8019f0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8019f4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8019f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019fa:	eb b9                	jmp    8019b5 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019ff:	83 f8 2f             	cmp    $0x2f,%eax
+  801a02:	77 24                	ja     801a28 <vprintfmt+0xf3>
+  801a04:	89 c1                	mov    %eax,%ecx
+  801a06:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801a0a:	83 c0 08             	add    $0x8,%eax
+  801a0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a10:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801a13:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801a16:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a1a:	79 99                	jns    8019b5 <vprintfmt+0x80>
+                width = precision;
+  801a1c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801a20:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a26:	eb 8d                	jmp    8019b5 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a28:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a2c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a34:	eb da                	jmp    801a10 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801a36:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801a3b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a3f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801a45:	3c 39                	cmp    $0x39,%al
+  801a47:	77 1c                	ja     801a65 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801a49:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801a4d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801a51:	0f b6 c0             	movzbl %al,%eax
+  801a54:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a59:	0f b6 03             	movzbl (%rbx),%eax
+  801a5c:	3c 39                	cmp    $0x39,%al
+  801a5e:	76 e9                	jbe    801a49 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801a60:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801a63:	eb b1                	jmp    801a16 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801a65:	49 89 dc             	mov    %rbx,%r12
+  801a68:	eb ac                	jmp    801a16 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801a6a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801a6d:	85 c9                	test   %ecx,%ecx
+  801a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a74:	0f 49 c1             	cmovns %ecx,%eax
+  801a77:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801a7a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a7d:	e9 33 ff ff ff       	jmp    8019b5 <vprintfmt+0x80>
+            lflag++;
+  801a82:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a85:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a88:	e9 28 ff ff ff       	jmp    8019b5 <vprintfmt+0x80>
+            lflag--;
+  801a8d:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a90:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a93:	e9 1d ff ff ff       	jmp    8019b5 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801a98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a9b:	83 f8 2f             	cmp    $0x2f,%eax
+  801a9e:	77 19                	ja     801ab9 <vprintfmt+0x184>
+  801aa0:	89 c2                	mov    %eax,%edx
+  801aa2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801aa6:	83 c0 08             	add    $0x8,%eax
+  801aa9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801aac:	8b 3a                	mov    (%rdx),%edi
+  801aae:	4c 89 ee             	mov    %r13,%rsi
+  801ab1:	41 ff d6             	call   *%r14
+            break;
+  801ab4:	e9 bc fe ff ff       	jmp    801975 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801ab9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801abd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ac1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ac5:	eb e5                	jmp    801aac <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801ac7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801aca:	83 f8 2f             	cmp    $0x2f,%eax
+  801acd:	77 5a                	ja     801b29 <vprintfmt+0x1f4>
+  801acf:	89 c2                	mov    %eax,%edx
+  801ad1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ad5:	83 c0 08             	add    $0x8,%eax
+  801ad8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801adb:	8b 02                	mov    (%rdx),%eax
+  801add:	89 c1                	mov    %eax,%ecx
+  801adf:	f7 d9                	neg    %ecx
+  801ae1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801ae4:	83 f9 13             	cmp    $0x13,%ecx
+  801ae7:	7f 4e                	jg     801b37 <vprintfmt+0x202>
+  801ae9:	48 63 c1             	movslq %ecx,%rax
+  801aec:	48 ba e0 63 80 00 00 	movabs $0x8063e0,%rdx
+  801af3:	00 00 00 
+  801af6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801afa:	48 85 c0             	test   %rax,%rax
+  801afd:	74 38                	je     801b37 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801aff:	48 89 c1             	mov    %rax,%rcx
+  801b02:	48 ba 48 66 80 00 00 	movabs $0x806648,%rdx
+  801b09:	00 00 00 
+  801b0c:	4c 89 ee             	mov    %r13,%rsi
+  801b0f:	4c 89 f7             	mov    %r14,%rdi
+  801b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b17:	49 b8 f8 18 80 00 00 	movabs $0x8018f8,%r8
+  801b1e:	00 00 00 
+  801b21:	41 ff d0             	call   *%r8
+  801b24:	e9 4c fe ff ff       	jmp    801975 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801b29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b35:	eb a4                	jmp    801adb <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801b37:	48 ba b1 5f 80 00 00 	movabs $0x805fb1,%rdx
+  801b3e:	00 00 00 
+  801b41:	4c 89 ee             	mov    %r13,%rsi
+  801b44:	4c 89 f7             	mov    %r14,%rdi
+  801b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4c:	49 b8 f8 18 80 00 00 	movabs $0x8018f8,%r8
+  801b53:	00 00 00 
+  801b56:	41 ff d0             	call   *%r8
+  801b59:	e9 17 fe ff ff       	jmp    801975 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b61:	83 f8 2f             	cmp    $0x2f,%eax
+  801b64:	77 6c                	ja     801bd2 <vprintfmt+0x29d>
+  801b66:	89 c2                	mov    %eax,%edx
+  801b68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b6c:	83 c0 08             	add    $0x8,%eax
+  801b6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b72:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801b75:	48 85 f6             	test   %rsi,%rsi
+  801b78:	48 b8 aa 5f 80 00 00 	movabs $0x805faa,%rax
+  801b7f:	00 00 00 
+  801b82:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b86:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801b8a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b8e:	7e 06                	jle    801b96 <vprintfmt+0x261>
+  801b90:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801b94:	75 4a                	jne    801be0 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b96:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801b9a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801b9e:	0f b6 00             	movzbl (%rax),%eax
+  801ba1:	84 c0                	test   %al,%al
+  801ba3:	0f 85 9a 00 00 00    	jne    801c43 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801ba9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bac:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	0f 8e bd fd ff ff    	jle    801975 <vprintfmt+0x40>
+  801bb8:	4c 89 ee             	mov    %r13,%rsi
+  801bbb:	bf 20 00 00 00       	mov    $0x20,%edi
+  801bc0:	41 ff d6             	call   *%r14
+  801bc3:	41 83 ec 01          	sub    $0x1,%r12d
+  801bc7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801bcb:	75 eb                	jne    801bb8 <vprintfmt+0x283>
+  801bcd:	e9 a3 fd ff ff       	jmp    801975 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801bd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bde:	eb 92                	jmp    801b72 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801be0:	49 63 f7             	movslq %r15d,%rsi
+  801be3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801be7:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+  801bf3:	48 89 c2             	mov    %rax,%rdx
+  801bf6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bf9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801bfb:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801bfe:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	7e 91                	jle    801b96 <vprintfmt+0x261>
+  801c05:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801c0a:	4c 89 ee             	mov    %r13,%rsi
+  801c0d:	44 89 e7             	mov    %r12d,%edi
+  801c10:	41 ff d6             	call   *%r14
+  801c13:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c17:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c1a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801c1d:	75 eb                	jne    801c0a <vprintfmt+0x2d5>
+  801c1f:	e9 72 ff ff ff       	jmp    801b96 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c24:	0f b6 f8             	movzbl %al,%edi
+  801c27:	4c 89 ee             	mov    %r13,%rsi
+  801c2a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c2d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c31:	49 83 c4 01          	add    $0x1,%r12
+  801c35:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801c3b:	84 c0                	test   %al,%al
+  801c3d:	0f 84 66 ff ff ff    	je     801ba9 <vprintfmt+0x274>
+  801c43:	45 85 ff             	test   %r15d,%r15d
+  801c46:	78 0a                	js     801c52 <vprintfmt+0x31d>
+  801c48:	41 83 ef 01          	sub    $0x1,%r15d
+  801c4c:	0f 88 57 ff ff ff    	js     801ba9 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c52:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801c56:	74 cc                	je     801c24 <vprintfmt+0x2ef>
+  801c58:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801c5b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801c60:	80 fa 5e             	cmp    $0x5e,%dl
+  801c63:	77 c2                	ja     801c27 <vprintfmt+0x2f2>
+  801c65:	eb bd                	jmp    801c24 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801c67:	40 84 f6             	test   %sil,%sil
+  801c6a:	75 26                	jne    801c92 <vprintfmt+0x35d>
+    switch (lflag) {
+  801c6c:	85 d2                	test   %edx,%edx
+  801c6e:	74 59                	je     801cc9 <vprintfmt+0x394>
+  801c70:	83 fa 01             	cmp    $0x1,%edx
+  801c73:	74 7b                	je     801cf0 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801c75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c78:	83 f8 2f             	cmp    $0x2f,%eax
+  801c7b:	0f 87 96 00 00 00    	ja     801d17 <vprintfmt+0x3e2>
+  801c81:	89 c2                	mov    %eax,%edx
+  801c83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c87:	83 c0 08             	add    $0x8,%eax
+  801c8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c8d:	4c 8b 22             	mov    (%rdx),%r12
+  801c90:	eb 17                	jmp    801ca9 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801c92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c95:	83 f8 2f             	cmp    $0x2f,%eax
+  801c98:	77 21                	ja     801cbb <vprintfmt+0x386>
+  801c9a:	89 c2                	mov    %eax,%edx
+  801c9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ca0:	83 c0 08             	add    $0x8,%eax
+  801ca3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ca6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801ca9:	4d 85 e4             	test   %r12,%r12
+  801cac:	78 7a                	js     801d28 <vprintfmt+0x3f3>
+            num = i;
+  801cae:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801cb1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801cb6:	e9 56 02 00 00       	jmp    801f11 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cbb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cbf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cc7:	eb dd                	jmp    801ca6 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801cc9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ccc:	83 f8 2f             	cmp    $0x2f,%eax
+  801ccf:	77 11                	ja     801ce2 <vprintfmt+0x3ad>
+  801cd1:	89 c2                	mov    %eax,%edx
+  801cd3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cd7:	83 c0 08             	add    $0x8,%eax
+  801cda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cdd:	4c 63 22             	movslq (%rdx),%r12
+  801ce0:	eb c7                	jmp    801ca9 <vprintfmt+0x374>
+  801ce2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ce6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cee:	eb ed                	jmp    801cdd <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801cf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cf3:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf6:	77 11                	ja     801d09 <vprintfmt+0x3d4>
+  801cf8:	89 c2                	mov    %eax,%edx
+  801cfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cfe:	83 c0 08             	add    $0x8,%eax
+  801d01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d04:	4c 8b 22             	mov    (%rdx),%r12
+  801d07:	eb a0                	jmp    801ca9 <vprintfmt+0x374>
+  801d09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d15:	eb ed                	jmp    801d04 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801d17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d23:	e9 65 ff ff ff       	jmp    801c8d <vprintfmt+0x358>
+                putch('-', put_arg);
+  801d28:	4c 89 ee             	mov    %r13,%rsi
+  801d2b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801d30:	41 ff d6             	call   *%r14
+                i = -i;
+  801d33:	49 f7 dc             	neg    %r12
+  801d36:	e9 73 ff ff ff       	jmp    801cae <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801d3b:	40 84 f6             	test   %sil,%sil
+  801d3e:	75 2e                	jne    801d6e <vprintfmt+0x439>
+    switch (lflag) {
+  801d40:	85 d2                	test   %edx,%edx
+  801d42:	7f 59                	jg     801d9d <vprintfmt+0x468>
+  801d44:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d47:	7d 7a                	jge    801dc3 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4f:	0f 87 aa 00 00 00    	ja     801dff <vprintfmt+0x4ca>
+  801d55:	89 c2                	mov    %eax,%edx
+  801d57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d5b:	83 c0 08             	add    $0x8,%eax
+  801d5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d61:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d64:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d69:	e9 a3 01 00 00       	jmp    801f11 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d71:	83 f8 2f             	cmp    $0x2f,%eax
+  801d74:	77 19                	ja     801d8f <vprintfmt+0x45a>
+  801d76:	89 c2                	mov    %eax,%edx
+  801d78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d7c:	83 c0 08             	add    $0x8,%eax
+  801d7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d82:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d85:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d8a:	e9 82 01 00 00       	jmp    801f11 <vprintfmt+0x5dc>
+  801d8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d9b:	eb e5                	jmp    801d82 <vprintfmt+0x44d>
+    switch (lflag) {
+  801d9d:	83 fa 01             	cmp    $0x1,%edx
+  801da0:	75 a7                	jne    801d49 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801da2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801da5:	83 f8 2f             	cmp    $0x2f,%eax
+  801da8:	77 47                	ja     801df1 <vprintfmt+0x4bc>
+  801daa:	89 c2                	mov    %eax,%edx
+  801dac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801db0:	83 c0 08             	add    $0x8,%eax
+  801db3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801db6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801db9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801dbe:	e9 4e 01 00 00       	jmp    801f11 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801dc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc6:	83 f8 2f             	cmp    $0x2f,%eax
+  801dc9:	77 18                	ja     801de3 <vprintfmt+0x4ae>
+  801dcb:	89 c2                	mov    %eax,%edx
+  801dcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd1:	83 c0 08             	add    $0x8,%eax
+  801dd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dd7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801dd9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801dde:	e9 2e 01 00 00       	jmp    801f11 <vprintfmt+0x5dc>
+  801de3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801de7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801def:	eb e6                	jmp    801dd7 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801df1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801df5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801df9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dfd:	eb b7                	jmp    801db6 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801dff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e0b:	e9 51 ff ff ff       	jmp    801d61 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801e10:	40 84 f6             	test   %sil,%sil
+  801e13:	75 2e                	jne    801e43 <vprintfmt+0x50e>
+    switch (lflag) {
+  801e15:	85 d2                	test   %edx,%edx
+  801e17:	7f 59                	jg     801e72 <vprintfmt+0x53d>
+  801e19:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e1c:	7d 77                	jge    801e95 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801e1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e21:	83 f8 2f             	cmp    $0x2f,%eax
+  801e24:	0f 87 a4 00 00 00    	ja     801ece <vprintfmt+0x599>
+  801e2a:	89 c2                	mov    %eax,%edx
+  801e2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e30:	83 c0 08             	add    $0x8,%eax
+  801e33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e36:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e39:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e3e:	e9 ce 00 00 00       	jmp    801f11 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e46:	83 f8 2f             	cmp    $0x2f,%eax
+  801e49:	77 19                	ja     801e64 <vprintfmt+0x52f>
+  801e4b:	89 c2                	mov    %eax,%edx
+  801e4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e51:	83 c0 08             	add    $0x8,%eax
+  801e54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e57:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e5a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e5f:	e9 ad 00 00 00       	jmp    801f11 <vprintfmt+0x5dc>
+  801e64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e70:	eb e5                	jmp    801e57 <vprintfmt+0x522>
+    switch (lflag) {
+  801e72:	83 fa 01             	cmp    $0x1,%edx
+  801e75:	75 a7                	jne    801e1e <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801e77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7d:	77 41                	ja     801ec0 <vprintfmt+0x58b>
+  801e7f:	89 c2                	mov    %eax,%edx
+  801e81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e85:	83 c0 08             	add    $0x8,%eax
+  801e88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e8e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801e93:	eb 7c                	jmp    801f11 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e98:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9b:	77 15                	ja     801eb2 <vprintfmt+0x57d>
+  801e9d:	89 c2                	mov    %eax,%edx
+  801e9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea3:	83 c0 08             	add    $0x8,%eax
+  801ea6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ea9:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801eab:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801eb0:	eb 5f                	jmp    801f11 <vprintfmt+0x5dc>
+  801eb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ebe:	eb e9                	jmp    801ea9 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801ec0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ecc:	eb bd                	jmp    801e8b <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801ece:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eda:	e9 57 ff ff ff       	jmp    801e36 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801edf:	4c 89 ee             	mov    %r13,%rsi
+  801ee2:	bf 30 00 00 00       	mov    $0x30,%edi
+  801ee7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801eea:	4c 89 ee             	mov    %r13,%rsi
+  801eed:	bf 78 00 00 00       	mov    $0x78,%edi
+  801ef2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801ef5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef8:	83 f8 2f             	cmp    $0x2f,%eax
+  801efb:	77 47                	ja     801f44 <vprintfmt+0x60f>
+  801efd:	89 c2                	mov    %eax,%edx
+  801eff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f03:	83 c0 08             	add    $0x8,%eax
+  801f06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f0c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801f11:	48 83 ec 08          	sub    $0x8,%rsp
+  801f15:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801f19:	0f 94 c0             	sete   %al
+  801f1c:	0f b6 c0             	movzbl %al,%eax
+  801f1f:	50                   	push   %rax
+  801f20:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801f25:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801f29:	4c 89 ee             	mov    %r13,%rsi
+  801f2c:	4c 89 f7             	mov    %r14,%rdi
+  801f2f:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+            break;
+  801f3b:	48 83 c4 10          	add    $0x10,%rsp
+  801f3f:	e9 31 fa ff ff       	jmp    801975 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801f44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f50:	eb b7                	jmp    801f09 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801f52:	40 84 f6             	test   %sil,%sil
+  801f55:	75 2b                	jne    801f82 <vprintfmt+0x64d>
+    switch (lflag) {
+  801f57:	85 d2                	test   %edx,%edx
+  801f59:	7f 56                	jg     801fb1 <vprintfmt+0x67c>
+  801f5b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f5e:	7d 77                	jge    801fd7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801f60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f63:	83 f8 2f             	cmp    $0x2f,%eax
+  801f66:	0f 87 a7 00 00 00    	ja     802013 <vprintfmt+0x6de>
+  801f6c:	89 c2                	mov    %eax,%edx
+  801f6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f72:	83 c0 08             	add    $0x8,%eax
+  801f75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f78:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f80:	eb 8f                	jmp    801f11 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f85:	83 f8 2f             	cmp    $0x2f,%eax
+  801f88:	77 19                	ja     801fa3 <vprintfmt+0x66e>
+  801f8a:	89 c2                	mov    %eax,%edx
+  801f8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f90:	83 c0 08             	add    $0x8,%eax
+  801f93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f96:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f99:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f9e:	e9 6e ff ff ff       	jmp    801f11 <vprintfmt+0x5dc>
+  801fa3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fa7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801faf:	eb e5                	jmp    801f96 <vprintfmt+0x661>
+    switch (lflag) {
+  801fb1:	83 fa 01             	cmp    $0x1,%edx
+  801fb4:	75 aa                	jne    801f60 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801fb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb9:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbc:	77 47                	ja     802005 <vprintfmt+0x6d0>
+  801fbe:	89 c2                	mov    %eax,%edx
+  801fc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc4:	83 c0 08             	add    $0x8,%eax
+  801fc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801fd2:	e9 3a ff ff ff       	jmp    801f11 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801fd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fda:	83 f8 2f             	cmp    $0x2f,%eax
+  801fdd:	77 18                	ja     801ff7 <vprintfmt+0x6c2>
+  801fdf:	89 c2                	mov    %eax,%edx
+  801fe1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fe5:	83 c0 08             	add    $0x8,%eax
+  801fe8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801feb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801fed:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ff2:	e9 1a ff ff ff       	jmp    801f11 <vprintfmt+0x5dc>
+  801ff7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ffb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802003:	eb e6                	jmp    801feb <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802005:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802009:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80200d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802011:	eb b7                	jmp    801fca <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802013:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802017:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80201b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80201f:	e9 54 ff ff ff       	jmp    801f78 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802024:	4c 89 ee             	mov    %r13,%rsi
+  802027:	bf 25 00 00 00       	mov    $0x25,%edi
+  80202c:	41 ff d6             	call   *%r14
+            break;
+  80202f:	e9 41 f9 ff ff       	jmp    801975 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802034:	4c 89 ee             	mov    %r13,%rsi
+  802037:	bf 25 00 00 00       	mov    $0x25,%edi
+  80203c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80203f:	48 83 eb 01          	sub    $0x1,%rbx
+  802043:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802047:	75 f6                	jne    80203f <vprintfmt+0x70a>
+  802049:	e9 27 f9 ff ff       	jmp    801975 <vprintfmt+0x40>
+
+000000000080204e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80204e:	55                   	push   %rbp
+  80204f:	48 89 e5             	mov    %rsp,%rbp
+  802052:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802056:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80205a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80205f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802063:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80206a:	48 85 ff             	test   %rdi,%rdi
+  80206d:	74 2b                	je     80209a <vsnprintf+0x4c>
+  80206f:	48 85 f6             	test   %rsi,%rsi
+  802072:	74 26                	je     80209a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802074:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802078:	48 bf e0 18 80 00 00 	movabs $0x8018e0,%rdi
+  80207f:	00 00 00 
+  802082:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80208e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802092:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802095:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802098:	c9                   	leave
+  802099:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80209a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80209f:	eb f7                	jmp    802098 <vsnprintf+0x4a>
+
+00000000008020a1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+  8020a5:	48 83 ec 50          	sub    $0x50,%rsp
+  8020a9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020ad:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8020b1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8020b5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8020bc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8020c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8020c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8020cc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8020d0:	48 b8 4e 20 80 00 00 	movabs $0x80204e,%rax
+  8020d7:	00 00 00 
+  8020da:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8020dc:	c9                   	leave
+  8020dd:	c3                   	ret
+
+00000000008020de <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8020de:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8020e1:	74 10                	je     8020f3 <strlen+0x15>
+    size_t n = 0;
+  8020e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8020e8:	48 83 c0 01          	add    $0x1,%rax
+  8020ec:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8020f0:	75 f6                	jne    8020e8 <strlen+0xa>
+  8020f2:	c3                   	ret
+    size_t n = 0;
+  8020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8020f8:	c3                   	ret
+
+00000000008020f9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8020f9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8020fc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802101:	48 85 f6             	test   %rsi,%rsi
+  802104:	74 11                	je     802117 <strnlen+0x1e>
+  802106:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80210a:	74 0c                	je     802118 <strnlen+0x1f>
+  80210c:	48 83 c2 01          	add    $0x1,%rdx
+  802110:	48 39 d0             	cmp    %rdx,%rax
+  802113:	75 f1                	jne    802106 <strnlen+0xd>
+  802115:	eb 04                	jmp    80211b <strnlen+0x22>
+  802117:	c3                   	ret
+  802118:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80211b:	c3                   	ret
+
+000000000080211c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80211c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80211f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802124:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802128:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80212b:	48 83 c2 01          	add    $0x1,%rdx
+  80212f:	84 c9                	test   %cl,%cl
+  802131:	75 f1                	jne    802124 <strcpy+0x8>
+        ;
+    return res;
+}
+  802133:	c3                   	ret
+
+0000000000802134 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802134:	55                   	push   %rbp
+  802135:	48 89 e5             	mov    %rsp,%rbp
+  802138:	41 54                	push   %r12
+  80213a:	53                   	push   %rbx
+  80213b:	48 89 fb             	mov    %rdi,%rbx
+  80213e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802141:	48 b8 de 20 80 00 00 	movabs $0x8020de,%rax
+  802148:	00 00 00 
+  80214b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80214d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802151:	4c 89 e6             	mov    %r12,%rsi
+  802154:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+    return dst;
+}
+  802160:	48 89 d8             	mov    %rbx,%rax
+  802163:	5b                   	pop    %rbx
+  802164:	41 5c                	pop    %r12
+  802166:	5d                   	pop    %rbp
+  802167:	c3                   	ret
+
+0000000000802168 <toupper>:
+
+int
+toupper(int ch) {
+  802168:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80216a:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80216d:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802170:	83 f9 1a             	cmp    $0x1a,%ecx
+  802173:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802176:	c3                   	ret
+
+0000000000802177 <tolower>:
+
+int
+tolower(int ch) {
+  802177:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802179:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80217c:	8d 57 20             	lea    0x20(%rdi),%edx
+  80217f:	83 f9 1a             	cmp    $0x1a,%ecx
+  802182:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802185:	c3                   	ret
+
+0000000000802186 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802186:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802189:	48 85 d2             	test   %rdx,%rdx
+  80218c:	74 1f                	je     8021ad <strncpy+0x27>
+  80218e:	48 01 fa             	add    %rdi,%rdx
+  802191:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802194:	48 83 c1 01          	add    $0x1,%rcx
+  802198:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80219c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8021a0:	41 80 f8 01          	cmp    $0x1,%r8b
+  8021a4:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8021a8:	48 39 ca             	cmp    %rcx,%rdx
+  8021ab:	75 e7                	jne    802194 <strncpy+0xe>
+    }
+    return ret;
+}
+  8021ad:	c3                   	ret
+
+00000000008021ae <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8021ae:	48 89 f8             	mov    %rdi,%rax
+  8021b1:	48 85 d2             	test   %rdx,%rdx
+  8021b4:	74 24                	je     8021da <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8021b6:	48 83 ea 01          	sub    $0x1,%rdx
+  8021ba:	74 1b                	je     8021d7 <strlcpy+0x29>
+  8021bc:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8021c0:	0f b6 16             	movzbl (%rsi),%edx
+  8021c3:	84 d2                	test   %dl,%dl
+  8021c5:	74 10                	je     8021d7 <strlcpy+0x29>
+            *dst++ = *src++;
+  8021c7:	48 83 c6 01          	add    $0x1,%rsi
+  8021cb:	48 83 c0 01          	add    $0x1,%rax
+  8021cf:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8021d2:	48 39 c8             	cmp    %rcx,%rax
+  8021d5:	75 e9                	jne    8021c0 <strlcpy+0x12>
+        *dst = '\0';
+  8021d7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8021da:	48 29 f8             	sub    %rdi,%rax
+}
+  8021dd:	c3                   	ret
+
+00000000008021de <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8021de:	0f b6 07             	movzbl (%rdi),%eax
+  8021e1:	84 c0                	test   %al,%al
+  8021e3:	74 13                	je     8021f8 <strcmp+0x1a>
+  8021e5:	38 06                	cmp    %al,(%rsi)
+  8021e7:	75 0f                	jne    8021f8 <strcmp+0x1a>
+  8021e9:	48 83 c7 01          	add    $0x1,%rdi
+  8021ed:	48 83 c6 01          	add    $0x1,%rsi
+  8021f1:	0f b6 07             	movzbl (%rdi),%eax
+  8021f4:	84 c0                	test   %al,%al
+  8021f6:	75 ed                	jne    8021e5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8021f8:	0f b6 c0             	movzbl %al,%eax
+  8021fb:	0f b6 16             	movzbl (%rsi),%edx
+  8021fe:	29 d0                	sub    %edx,%eax
+}
+  802200:	c3                   	ret
+
+0000000000802201 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802201:	48 85 d2             	test   %rdx,%rdx
+  802204:	74 1f                	je     802225 <strncmp+0x24>
+  802206:	0f b6 07             	movzbl (%rdi),%eax
+  802209:	84 c0                	test   %al,%al
+  80220b:	74 1e                	je     80222b <strncmp+0x2a>
+  80220d:	3a 06                	cmp    (%rsi),%al
+  80220f:	75 1a                	jne    80222b <strncmp+0x2a>
+  802211:	48 83 c7 01          	add    $0x1,%rdi
+  802215:	48 83 c6 01          	add    $0x1,%rsi
+  802219:	48 83 ea 01          	sub    $0x1,%rdx
+  80221d:	75 e7                	jne    802206 <strncmp+0x5>
+
+    if (!n) return 0;
+  80221f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802224:	c3                   	ret
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222a:	c3                   	ret
+  80222b:	48 85 d2             	test   %rdx,%rdx
+  80222e:	74 09                	je     802239 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802230:	0f b6 07             	movzbl (%rdi),%eax
+  802233:	0f b6 16             	movzbl (%rsi),%edx
+  802236:	29 d0                	sub    %edx,%eax
+  802238:	c3                   	ret
+    if (!n) return 0;
+  802239:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223e:	c3                   	ret
+
+000000000080223f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80223f:	0f b6 17             	movzbl (%rdi),%edx
+  802242:	84 d2                	test   %dl,%dl
+  802244:	74 18                	je     80225e <strchr+0x1f>
+        if (*str == c) {
+  802246:	0f be d2             	movsbl %dl,%edx
+  802249:	39 f2                	cmp    %esi,%edx
+  80224b:	74 17                	je     802264 <strchr+0x25>
+    for (; *str; str++) {
+  80224d:	48 83 c7 01          	add    $0x1,%rdi
+  802251:	0f b6 17             	movzbl (%rdi),%edx
+  802254:	84 d2                	test   %dl,%dl
+  802256:	75 ee                	jne    802246 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225d:	c3                   	ret
+  80225e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802263:	c3                   	ret
+  802264:	48 89 f8             	mov    %rdi,%rax
+}
+  802267:	c3                   	ret
+
+0000000000802268 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802268:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80226b:	0f b6 17             	movzbl (%rdi),%edx
+  80226e:	84 d2                	test   %dl,%dl
+  802270:	74 13                	je     802285 <strfind+0x1d>
+  802272:	0f be d2             	movsbl %dl,%edx
+  802275:	39 f2                	cmp    %esi,%edx
+  802277:	74 0b                	je     802284 <strfind+0x1c>
+  802279:	48 83 c0 01          	add    $0x1,%rax
+  80227d:	0f b6 10             	movzbl (%rax),%edx
+  802280:	84 d2                	test   %dl,%dl
+  802282:	75 ee                	jne    802272 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802284:	c3                   	ret
+  802285:	c3                   	ret
+
+0000000000802286 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802286:	48 39 f7             	cmp    %rsi,%rdi
+  802289:	74 65                	je     8022f0 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80228b:	55                   	push   %rbp
+  80228c:	48 89 e5             	mov    %rsp,%rbp
+  80228f:	41 57                	push   %r15
+  802291:	41 56                	push   %r14
+  802293:	41 55                	push   %r13
+  802295:	41 54                	push   %r12
+  802297:	53                   	push   %rbx
+  802298:	48 83 ec 18          	sub    $0x18,%rsp
+  80229c:	48 89 fb             	mov    %rdi,%rbx
+  80229f:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8022a2:	49 bf 77 21 80 00 00 	movabs $0x802177,%r15
+  8022a9:	00 00 00 
+  8022ac:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022b0:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022b4:	41 ff d7             	call   *%r15
+  8022b7:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022ba:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8022bf:	41 0f b6 fe          	movzbl %r14b,%edi
+  8022c3:	41 ff d7             	call   *%r15
+  8022c6:	89 c2                	mov    %eax,%edx
+  8022c8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022cb:	29 d0                	sub    %edx,%eax
+  8022cd:	75 12                	jne    8022e1 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8022cf:	48 83 c3 01          	add    $0x1,%rbx
+  8022d3:	45 84 ed             	test   %r13b,%r13b
+  8022d6:	74 09                	je     8022e1 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8022d8:	49 83 c4 01          	add    $0x1,%r12
+  8022dc:	45 84 f6             	test   %r14b,%r14b
+  8022df:	75 cb                	jne    8022ac <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8022e1:	48 83 c4 18          	add    $0x18,%rsp
+  8022e5:	5b                   	pop    %rbx
+  8022e6:	41 5c                	pop    %r12
+  8022e8:	41 5d                	pop    %r13
+  8022ea:	41 5e                	pop    %r14
+  8022ec:	41 5f                	pop    %r15
+  8022ee:	5d                   	pop    %rbp
+  8022ef:	c3                   	ret
+    if (p1 == p2) return 0;
+  8022f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f5:	c3                   	ret
+
+00000000008022f6 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8022f6:	48 39 f7             	cmp    %rsi,%rdi
+  8022f9:	74 7d                	je     802378 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8022fb:	55                   	push   %rbp
+  8022fc:	48 89 e5             	mov    %rsp,%rbp
+  8022ff:	41 57                	push   %r15
+  802301:	41 56                	push   %r14
+  802303:	41 55                	push   %r13
+  802305:	41 54                	push   %r12
+  802307:	53                   	push   %rbx
+  802308:	48 83 ec 18          	sub    $0x18,%rsp
+  80230c:	48 89 fb             	mov    %rdi,%rbx
+  80230f:	49 89 f4             	mov    %rsi,%r12
+  802312:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802316:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80231a:	49 bf 77 21 80 00 00 	movabs $0x802177,%r15
+  802321:	00 00 00 
+    while (n--) {
+  802324:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802328:	48 39 c3             	cmp    %rax,%rbx
+  80232b:	74 37                	je     802364 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80232d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802331:	41 0f b6 fd          	movzbl %r13b,%edi
+  802335:	41 ff d7             	call   *%r15
+  802338:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80233b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802340:	41 0f b6 fe          	movzbl %r14b,%edi
+  802344:	41 ff d7             	call   *%r15
+  802347:	89 c2                	mov    %eax,%edx
+  802349:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80234c:	29 d0                	sub    %edx,%eax
+  80234e:	75 19                	jne    802369 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802350:	48 83 c3 01          	add    $0x1,%rbx
+  802354:	45 84 ed             	test   %r13b,%r13b
+  802357:	74 10                	je     802369 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802359:	49 83 c4 01          	add    $0x1,%r12
+  80235d:	45 84 f6             	test   %r14b,%r14b
+  802360:	75 c2                	jne    802324 <strncasecmp+0x2e>
+  802362:	eb 05                	jmp    802369 <strncasecmp+0x73>
+  802364:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802369:	48 83 c4 18          	add    $0x18,%rsp
+  80236d:	5b                   	pop    %rbx
+  80236e:	41 5c                	pop    %r12
+  802370:	41 5d                	pop    %r13
+  802372:	41 5e                	pop    %r14
+  802374:	41 5f                	pop    %r15
+  802376:	5d                   	pop    %rbp
+  802377:	c3                   	ret
+    if (p1 == p2) return 0;
+  802378:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80237d:	c3                   	ret
+
+000000000080237e <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80237e:	83 e7 df             	and    $0xffffffdf,%edi
+  802381:	83 ef 41             	sub    $0x41,%edi
+  802384:	83 ff 19             	cmp    $0x19,%edi
+  802387:	0f 96 c0             	setbe  %al
+}
+  80238a:	c3                   	ret
+
+000000000080238b <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80238b:	83 ff 20             	cmp    $0x20,%edi
+  80238e:	0f 94 c0             	sete   %al
+  802391:	83 ff 09             	cmp    $0x9,%edi
+  802394:	0f 94 c2             	sete   %dl
+  802397:	09 d0                	or     %edx,%eax
+}
+  802399:	c3                   	ret
+
+000000000080239a <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80239a:	55                   	push   %rbp
+  80239b:	48 89 e5             	mov    %rsp,%rbp
+  80239e:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8023a0:	48 bf 9f 64 80 00 00 	movabs $0x80649f,%rdi
+  8023a7:	00 00 00 
+  8023aa:	48 b8 3f 22 80 00 00 	movabs $0x80223f,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+  8023b6:	48 85 c0             	test   %rax,%rax
+  8023b9:	0f 95 c0             	setne  %al
+}
+  8023bc:	5d                   	pop    %rbp
+  8023bd:	c3                   	ret
+
+00000000008023be <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8023be:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8023c1:	48 89 f8             	mov    %rdi,%rax
+  8023c4:	48 f7 d8             	neg    %rax
+  8023c7:	83 e0 07             	and    $0x7,%eax
+  8023ca:	49 89 d1             	mov    %rdx,%r9
+  8023cd:	49 29 c1             	sub    %rax,%r9
+  8023d0:	78 36                	js     802408 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8023d2:	40 0f b6 c6          	movzbl %sil,%eax
+  8023d6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8023dd:	01 01 01 
+  8023e0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8023e4:	40 f6 c7 07          	test   $0x7,%dil
+  8023e8:	75 38                	jne    802422 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8023ea:	4c 89 c9             	mov    %r9,%rcx
+  8023ed:	48 c1 f9 03          	sar    $0x3,%rcx
+  8023f1:	74 0c                	je     8023ff <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8023f3:	fc                   	cld
+  8023f4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8023f7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8023fb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8023ff:	4d 85 c9             	test   %r9,%r9
+  802402:	75 45                	jne    802449 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802404:	4c 89 c0             	mov    %r8,%rax
+  802407:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802408:	48 85 d2             	test   %rdx,%rdx
+  80240b:	74 f7                	je     802404 <memset+0x46>
+  80240d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802410:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802413:	48 83 c0 01          	add    $0x1,%rax
+  802417:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80241b:	48 39 c2             	cmp    %rax,%rdx
+  80241e:	75 f3                	jne    802413 <memset+0x55>
+  802420:	eb e2                	jmp    802404 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802422:	40 f6 c7 01          	test   $0x1,%dil
+  802426:	74 06                	je     80242e <memset+0x70>
+  802428:	88 07                	mov    %al,(%rdi)
+  80242a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80242e:	40 f6 c7 02          	test   $0x2,%dil
+  802432:	74 07                	je     80243b <memset+0x7d>
+  802434:	66 89 07             	mov    %ax,(%rdi)
+  802437:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80243b:	40 f6 c7 04          	test   $0x4,%dil
+  80243f:	74 a9                	je     8023ea <memset+0x2c>
+  802441:	89 07                	mov    %eax,(%rdi)
+  802443:	48 83 c7 04          	add    $0x4,%rdi
+  802447:	eb a1                	jmp    8023ea <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802449:	41 f6 c1 04          	test   $0x4,%r9b
+  80244d:	74 06                	je     802455 <memset+0x97>
+  80244f:	89 07                	mov    %eax,(%rdi)
+  802451:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802455:	41 f6 c1 02          	test   $0x2,%r9b
+  802459:	74 07                	je     802462 <memset+0xa4>
+  80245b:	66 89 07             	mov    %ax,(%rdi)
+  80245e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802462:	41 f6 c1 01          	test   $0x1,%r9b
+  802466:	74 9c                	je     802404 <memset+0x46>
+  802468:	88 07                	mov    %al,(%rdi)
+  80246a:	eb 98                	jmp    802404 <memset+0x46>
+
+000000000080246c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80246c:	48 89 f8             	mov    %rdi,%rax
+  80246f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802472:	48 39 fe             	cmp    %rdi,%rsi
+  802475:	73 3b                	jae    8024b2 <memmove+0x46>
+  802477:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80247b:	48 39 d7             	cmp    %rdx,%rdi
+  80247e:	73 32                	jae    8024b2 <memmove+0x46>
+        s += n;
+        d += n;
+  802480:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802484:	48 89 d6             	mov    %rdx,%rsi
+  802487:	48 09 fe             	or     %rdi,%rsi
+  80248a:	48 09 ce             	or     %rcx,%rsi
+  80248d:	40 f6 c6 07          	test   $0x7,%sil
+  802491:	75 12                	jne    8024a5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802493:	48 83 ef 08          	sub    $0x8,%rdi
+  802497:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80249b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80249f:	fd                   	std
+  8024a0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8024a3:	fc                   	cld
+  8024a4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8024a5:	48 83 ef 01          	sub    $0x1,%rdi
+  8024a9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8024ad:	fd                   	std
+  8024ae:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8024b0:	eb f1                	jmp    8024a3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8024b2:	48 89 f2             	mov    %rsi,%rdx
+  8024b5:	48 09 c2             	or     %rax,%rdx
+  8024b8:	48 09 ca             	or     %rcx,%rdx
+  8024bb:	f6 c2 07             	test   $0x7,%dl
+  8024be:	75 0c                	jne    8024cc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8024c0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8024c4:	48 89 c7             	mov    %rax,%rdi
+  8024c7:	fc                   	cld
+  8024c8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8024cb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8024cc:	48 89 c7             	mov    %rax,%rdi
+  8024cf:	fc                   	cld
+  8024d0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8024d2:	c3                   	ret
+
+00000000008024d3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8024d7:	48 b8 6c 24 80 00 00 	movabs $0x80246c,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+}
+  8024e3:	5d                   	pop    %rbp
+  8024e4:	c3                   	ret
+
+00000000008024e5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	41 57                	push   %r15
+  8024eb:	41 56                	push   %r14
+  8024ed:	41 55                	push   %r13
+  8024ef:	41 54                	push   %r12
+  8024f1:	53                   	push   %rbx
+  8024f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f6:	49 89 fe             	mov    %rdi,%r14
+  8024f9:	49 89 f7             	mov    %rsi,%r15
+  8024fc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8024ff:	48 89 f7             	mov    %rsi,%rdi
+  802502:	48 b8 de 20 80 00 00 	movabs $0x8020de,%rax
+  802509:	00 00 00 
+  80250c:	ff d0                	call   *%rax
+  80250e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802511:	48 89 de             	mov    %rbx,%rsi
+  802514:	4c 89 f7             	mov    %r14,%rdi
+  802517:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+  802523:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802526:	48 39 c3             	cmp    %rax,%rbx
+  802529:	74 36                	je     802561 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80252b:	48 89 d8             	mov    %rbx,%rax
+  80252e:	4c 29 e8             	sub    %r13,%rax
+  802531:	49 39 c4             	cmp    %rax,%r12
+  802534:	73 31                	jae    802567 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802536:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80253b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80253f:	4c 89 fe             	mov    %r15,%rsi
+  802542:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802549:	00 00 00 
+  80254c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80254e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802552:	48 83 c4 08          	add    $0x8,%rsp
+  802556:	5b                   	pop    %rbx
+  802557:	41 5c                	pop    %r12
+  802559:	41 5d                	pop    %r13
+  80255b:	41 5e                	pop    %r14
+  80255d:	41 5f                	pop    %r15
+  80255f:	5d                   	pop    %rbp
+  802560:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802561:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802565:	eb eb                	jmp    802552 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802567:	48 83 eb 01          	sub    $0x1,%rbx
+  80256b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80256f:	48 89 da             	mov    %rbx,%rdx
+  802572:	4c 89 fe             	mov    %r15,%rsi
+  802575:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802581:	49 01 de             	add    %rbx,%r14
+  802584:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802589:	eb c3                	jmp    80254e <strlcat+0x69>
+
+000000000080258b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80258b:	48 85 d2             	test   %rdx,%rdx
+  80258e:	74 2d                	je     8025bd <memcmp+0x32>
+  802590:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802595:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802599:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80259e:	44 38 c1             	cmp    %r8b,%cl
+  8025a1:	75 0f                	jne    8025b2 <memcmp+0x27>
+    while (n-- > 0) {
+  8025a3:	48 83 c0 01          	add    $0x1,%rax
+  8025a7:	48 39 c2             	cmp    %rax,%rdx
+  8025aa:	75 e9                	jne    802595 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8025ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8025b2:	0f b6 c1             	movzbl %cl,%eax
+  8025b5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8025b9:	44 29 c0             	sub    %r8d,%eax
+  8025bc:	c3                   	ret
+    return 0;
+  8025bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c2:	c3                   	ret
+
+00000000008025c3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8025c3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8025c7:	48 39 c7             	cmp    %rax,%rdi
+  8025ca:	73 0f                	jae    8025db <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8025cc:	40 38 37             	cmp    %sil,(%rdi)
+  8025cf:	74 0e                	je     8025df <memfind+0x1c>
+    for (; src < end; src++) {
+  8025d1:	48 83 c7 01          	add    $0x1,%rdi
+  8025d5:	48 39 f8             	cmp    %rdi,%rax
+  8025d8:	75 f2                	jne    8025cc <memfind+0x9>
+  8025da:	c3                   	ret
+  8025db:	48 89 f8             	mov    %rdi,%rax
+  8025de:	c3                   	ret
+  8025df:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8025e2:	c3                   	ret
+
+00000000008025e3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8025e3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8025e6:	0f b6 37             	movzbl (%rdi),%esi
+  8025e9:	40 80 fe 20          	cmp    $0x20,%sil
+  8025ed:	74 06                	je     8025f5 <strtol+0x12>
+  8025ef:	40 80 fe 09          	cmp    $0x9,%sil
+  8025f3:	75 13                	jne    802608 <strtol+0x25>
+  8025f5:	48 83 c7 01          	add    $0x1,%rdi
+  8025f9:	0f b6 37             	movzbl (%rdi),%esi
+  8025fc:	40 80 fe 20          	cmp    $0x20,%sil
+  802600:	74 f3                	je     8025f5 <strtol+0x12>
+  802602:	40 80 fe 09          	cmp    $0x9,%sil
+  802606:	74 ed                	je     8025f5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802608:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80260b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80260e:	3c 01                	cmp    $0x1,%al
+  802610:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802614:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80261a:	75 0f                	jne    80262b <strtol+0x48>
+  80261c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80261f:	74 14                	je     802635 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802621:	85 d2                	test   %edx,%edx
+  802623:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802628:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80262b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802630:	4c 63 ca             	movslq %edx,%r9
+  802633:	eb 36                	jmp    80266b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802635:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802639:	74 0f                	je     80264a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80263b:	85 d2                	test   %edx,%edx
+  80263d:	75 ec                	jne    80262b <strtol+0x48>
+        s++;
+  80263f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802643:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802648:	eb e1                	jmp    80262b <strtol+0x48>
+        s += 2;
+  80264a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80264e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802653:	eb d6                	jmp    80262b <strtol+0x48>
+            dig -= '0';
+  802655:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802658:	44 0f b6 c1          	movzbl %cl,%r8d
+  80265c:	41 39 d0             	cmp    %edx,%r8d
+  80265f:	7d 21                	jge    802682 <strtol+0x9f>
+        val = val * base + dig;
+  802661:	49 0f af c1          	imul   %r9,%rax
+  802665:	0f b6 c9             	movzbl %cl,%ecx
+  802668:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80266b:	48 83 c7 01          	add    $0x1,%rdi
+  80266f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802673:	80 f9 39             	cmp    $0x39,%cl
+  802676:	76 dd                	jbe    802655 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802678:	80 f9 7b             	cmp    $0x7b,%cl
+  80267b:	77 05                	ja     802682 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80267d:	83 e9 57             	sub    $0x57,%ecx
+  802680:	eb d6                	jmp    802658 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802682:	4d 85 d2             	test   %r10,%r10
+  802685:	74 03                	je     80268a <strtol+0xa7>
+  802687:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80268a:	48 89 c2             	mov    %rax,%rdx
+  80268d:	48 f7 da             	neg    %rdx
+  802690:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802694:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802698:	c3                   	ret
+
+0000000000802699 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802699:	55                   	push   %rbp
+  80269a:	48 89 e5             	mov    %rsp,%rbp
+  80269d:	53                   	push   %rbx
+  80269e:	48 89 fa             	mov    %rdi,%rdx
+  8026a1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026a4:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026c4:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8026c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ca:	c9                   	leave
+  8026cb:	c3                   	ret
+
+00000000008026cc <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8026cc:	55                   	push   %rbp
+  8026cd:	48 89 e5             	mov    %rsp,%rbp
+  8026d0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026d1:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026db:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026fb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802701:	c9                   	leave
+  802702:	c3                   	ret
+
+0000000000802703 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802703:	55                   	push   %rbp
+  802704:	48 89 e5             	mov    %rsp,%rbp
+  802707:	53                   	push   %rbx
+  802708:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80270b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802710:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802715:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80271a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80271f:	be 00 00 00 00       	mov    $0x0,%esi
+  802724:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80272a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802730:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802732:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802736:	c9                   	leave
+  802737:	c3                   	ret
+
+0000000000802738 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802738:	55                   	push   %rbp
+  802739:	48 89 e5             	mov    %rsp,%rbp
+  80273c:	53                   	push   %rbx
+  80273d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802741:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802744:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802749:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80274e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802753:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802758:	be 00 00 00 00       	mov    $0x0,%esi
+  80275d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802763:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802769:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80276b:	48 85 c0             	test   %rax,%rax
+  80276e:	7f 06                	jg     802776 <sys_env_destroy+0x3e>
+}
+  802770:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802774:	c9                   	leave
+  802775:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802776:	49 89 c0             	mov    %rax,%r8
+  802779:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80277e:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802785:	00 00 00 
+  802788:	be 27 00 00 00       	mov    $0x27,%esi
+  80278d:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802794:	00 00 00 
+  802797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279c:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  8027a3:	00 00 00 
+  8027a6:	41 ff d1             	call   *%r9
+
+00000000008027a9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8027a9:	55                   	push   %rbp
+  8027aa:	48 89 e5             	mov    %rsp,%rbp
+  8027ad:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ae:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027de:	c9                   	leave
+  8027df:	c3                   	ret
+
+00000000008027e0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8027e0:	55                   	push   %rbp
+  8027e1:	48 89 e5             	mov    %rsp,%rbp
+  8027e4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027e5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802803:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802809:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80280f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802811:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802815:	c9                   	leave
+  802816:	c3                   	ret
+
+0000000000802817 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802817:	55                   	push   %rbp
+  802818:	48 89 e5             	mov    %rsp,%rbp
+  80281b:	53                   	push   %rbx
+  80281c:	48 89 fa             	mov    %rdi,%rdx
+  80281f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802822:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802827:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80282e:	00 00 00 
+  802831:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802836:	be 00 00 00 00       	mov    $0x0,%esi
+  80283b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802841:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802847:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802849:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80284d:	c9                   	leave
+  80284e:	c3                   	ret
+
+000000000080284f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80284f:	55                   	push   %rbp
+  802850:	48 89 e5             	mov    %rsp,%rbp
+  802853:	53                   	push   %rbx
+  802854:	49 89 f8             	mov    %rdi,%r8
+  802857:	48 89 d3             	mov    %rdx,%rbx
+  80285a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80285d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802862:	4c 89 c2             	mov    %r8,%rdx
+  802865:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802868:	be 00 00 00 00       	mov    $0x0,%esi
+  80286d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802873:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802879:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80287b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80287f:	c9                   	leave
+  802880:	c3                   	ret
+
+0000000000802881 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802881:	55                   	push   %rbp
+  802882:	48 89 e5             	mov    %rsp,%rbp
+  802885:	53                   	push   %rbx
+  802886:	48 83 ec 08          	sub    $0x8,%rsp
+  80288a:	89 f8                	mov    %edi,%eax
+  80288c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80288f:	48 63 f9             	movslq %ecx,%rdi
+  802892:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802895:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80289a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80289d:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028b0:	48 85 c0             	test   %rax,%rax
+  8028b3:	7f 06                	jg     8028bb <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8028b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b9:	c9                   	leave
+  8028ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028bb:	49 89 c0             	mov    %rax,%r8
+  8028be:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8028c3:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  8028ca:	00 00 00 
+  8028cd:	be 27 00 00 00       	mov    $0x27,%esi
+  8028d2:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  8028d9:	00 00 00 
+  8028dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e1:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  8028e8:	00 00 00 
+  8028eb:	41 ff d1             	call   *%r9
+
+00000000008028ee <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8028ee:	55                   	push   %rbp
+  8028ef:	48 89 e5             	mov    %rsp,%rbp
+  8028f2:	53                   	push   %rbx
+  8028f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f7:	89 f8                	mov    %edi,%eax
+  8028f9:	49 89 f2             	mov    %rsi,%r10
+  8028fc:	48 89 cf             	mov    %rcx,%rdi
+  8028ff:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802902:	48 63 da             	movslq %edx,%rbx
+  802905:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802908:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80290d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802910:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802913:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802919:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80291b:	48 85 c0             	test   %rax,%rax
+  80291e:	7f 06                	jg     802926 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802920:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802924:	c9                   	leave
+  802925:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802926:	49 89 c0             	mov    %rax,%r8
+  802929:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80292e:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802935:	00 00 00 
+  802938:	be 27 00 00 00       	mov    $0x27,%esi
+  80293d:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802944:	00 00 00 
+  802947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294c:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802953:	00 00 00 
+  802956:	41 ff d1             	call   *%r9
+
+0000000000802959 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802959:	55                   	push   %rbp
+  80295a:	48 89 e5             	mov    %rsp,%rbp
+  80295d:	53                   	push   %rbx
+  80295e:	48 83 ec 08          	sub    $0x8,%rsp
+  802962:	48 89 f1             	mov    %rsi,%rcx
+  802965:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802968:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80296b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802970:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802975:	be 00 00 00 00       	mov    $0x0,%esi
+  80297a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802980:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802986:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802988:	48 85 c0             	test   %rax,%rax
+  80298b:	7f 06                	jg     802993 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80298d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802993:	49 89 c0             	mov    %rax,%r8
+  802996:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80299b:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  8029a2:	00 00 00 
+  8029a5:	be 27 00 00 00       	mov    $0x27,%esi
+  8029aa:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  8029b1:	00 00 00 
+  8029b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b9:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  8029c0:	00 00 00 
+  8029c3:	41 ff d1             	call   *%r9
+
+00000000008029c6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8029c6:	55                   	push   %rbp
+  8029c7:	48 89 e5             	mov    %rsp,%rbp
+  8029ca:	53                   	push   %rbx
+  8029cb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  8029cf:	48 63 ce             	movslq %esi,%rcx
+  8029d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029f7:	48 85 c0             	test   %rax,%rax
+  8029fa:	7f 06                	jg     802a02 <sys_env_set_status+0x3c>
+}
+  8029fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a02:	49 89 c0             	mov    %rax,%r8
+  802a05:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802a0a:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802a11:	00 00 00 
+  802a14:	be 27 00 00 00       	mov    $0x27,%esi
+  802a19:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802a20:	00 00 00 
+  802a23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a28:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802a2f:	00 00 00 
+  802a32:	41 ff d1             	call   *%r9
+
+0000000000802a35 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802a35:	55                   	push   %rbp
+  802a36:	48 89 e5             	mov    %rsp,%rbp
+  802a39:	53                   	push   %rbx
+  802a3a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802a41:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a44:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a4e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a53:	be 00 00 00 00       	mov    $0x0,%esi
+  802a58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a64:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a66:	48 85 c0             	test   %rax,%rax
+  802a69:	7f 06                	jg     802a71 <sys_env_set_trapframe+0x3c>
+}
+  802a6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a71:	49 89 c0             	mov    %rax,%r8
+  802a74:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802a79:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802a80:	00 00 00 
+  802a83:	be 27 00 00 00       	mov    $0x27,%esi
+  802a88:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802a8f:	00 00 00 
+  802a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a97:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802a9e:	00 00 00 
+  802aa1:	41 ff d1             	call   *%r9
+
+0000000000802aa4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802aa4:	55                   	push   %rbp
+  802aa5:	48 89 e5             	mov    %rsp,%rbp
+  802aa8:	53                   	push   %rbx
+  802aa9:	48 83 ec 08          	sub    $0x8,%rsp
+  802aad:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802ab0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ab3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ab8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802abd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802acd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ad5:	48 85 c0             	test   %rax,%rax
+  802ad8:	7f 06                	jg     802ae0 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802ada:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ae0:	49 89 c0             	mov    %rax,%r8
+  802ae3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802ae8:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802aef:	00 00 00 
+  802af2:	be 27 00 00 00       	mov    $0x27,%esi
+  802af7:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802afe:	00 00 00 
+  802b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b06:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802b0d:	00 00 00 
+  802b10:	41 ff d1             	call   *%r9
+
+0000000000802b13 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	53                   	push   %rbx
+  802b18:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802b1c:	40 0f b6 ce          	movzbl %sil,%ecx
+  802b20:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b23:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b2d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b32:	be 00 00 00 00       	mov    $0x0,%esi
+  802b37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b3d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b43:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b45:	48 85 c0             	test   %rax,%rax
+  802b48:	7f 06                	jg     802b50 <sys_env_set_reclaim+0x3d>
+}
+  802b4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4e:	c9                   	leave
+  802b4f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b50:	49 89 c0             	mov    %rax,%r8
+  802b53:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802b58:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802b5f:	00 00 00 
+  802b62:	be 27 00 00 00       	mov    $0x27,%esi
+  802b67:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802b6e:	00 00 00 
+  802b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b76:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802b7d:	00 00 00 
+  802b80:	41 ff d1             	call   *%r9
+
+0000000000802b83 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+  802b87:	53                   	push   %rbx
+  802b88:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802b8c:	48 63 ce             	movslq %esi,%rcx
+  802b8f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b92:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ba1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bb2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bb4:	48 85 c0             	test   %rax,%rax
+  802bb7:	7f 06                	jg     802bbf <sys_env_set_nice+0x3c>
+}
+  802bb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bbf:	49 89 c0             	mov    %rax,%r8
+  802bc2:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802bc7:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802bce:	00 00 00 
+  802bd1:	be 27 00 00 00       	mov    $0x27,%esi
+  802bd6:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802bdd:	00 00 00 
+  802be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be5:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802bec:	00 00 00 
+  802bef:	41 ff d1             	call   *%r9
+
+0000000000802bf2 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802bf2:	55                   	push   %rbp
+  802bf3:	48 89 e5             	mov    %rsp,%rbp
+  802bf6:	53                   	push   %rbx
+  802bf7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bfa:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c09:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c0e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c1f:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802c21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c25:	c9                   	leave
+  802c26:	c3                   	ret
+
+0000000000802c27 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c27:	55                   	push   %rbp
+  802c28:	48 89 e5             	mov    %rsp,%rbp
+  802c2b:	53                   	push   %rbx
+  802c2c:	89 f8                	mov    %edi,%eax
+  802c2e:	49 89 f1             	mov    %rsi,%r9
+  802c31:	48 89 d3             	mov    %rdx,%rbx
+  802c34:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c37:	49 63 f0             	movslq %r8d,%rsi
+  802c3a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c3d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c42:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c4b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c51:	cd 30                	int    $0x30
+}
+  802c53:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c57:	c9                   	leave
+  802c58:	c3                   	ret
+
+0000000000802c59 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c59:	55                   	push   %rbp
+  802c5a:	48 89 e5             	mov    %rsp,%rbp
+  802c5d:	53                   	push   %rbx
+  802c5e:	89 f8                	mov    %edi,%eax
+  802c60:	49 89 f1             	mov    %rsi,%r9
+  802c63:	48 89 d3             	mov    %rdx,%rbx
+  802c66:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c69:	49 63 f0             	movslq %r8d,%rsi
+  802c6c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c6f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c74:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c7d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c83:	cd 30                	int    $0x30
+}
+  802c85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c89:	c9                   	leave
+  802c8a:	c3                   	ret
+
+0000000000802c8b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c8b:	55                   	push   %rbp
+  802c8c:	48 89 e5             	mov    %rsp,%rbp
+  802c8f:	53                   	push   %rbx
+  802c90:	48 83 ec 08          	sub    $0x8,%rsp
+  802c94:	89 f8                	mov    %edi,%eax
+  802c96:	49 89 f2             	mov    %rsi,%r10
+  802c99:	48 89 d3             	mov    %rdx,%rbx
+  802c9c:	48 89 cf             	mov    %rcx,%rdi
+  802c9f:	44 89 c6             	mov    %r8d,%esi
+  802ca2:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802ca5:	48 63 f6             	movslq %esi,%rsi
+  802ca8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cab:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cb0:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802cb3:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802cb7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cb9:	48 85 c0             	test   %rax,%rax
+  802cbc:	7f 06                	jg     802cc4 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc2:	c9                   	leave
+  802cc3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cc4:	49 89 c0             	mov    %rax,%r8
+  802cc7:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802ccc:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802cd3:	00 00 00 
+  802cd6:	be 27 00 00 00       	mov    $0x27,%esi
+  802cdb:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802ce2:	00 00 00 
+  802ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cea:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802cf1:	00 00 00 
+  802cf4:	41 ff d1             	call   *%r9
+
+0000000000802cf7 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802cf7:	55                   	push   %rbp
+  802cf8:	48 89 e5             	mov    %rsp,%rbp
+  802cfb:	53                   	push   %rbx
+  802cfc:	48 83 ec 08          	sub    $0x8,%rsp
+  802d00:	48 89 f1             	mov    %rsi,%rcx
+  802d03:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802d06:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802d0a:	48 8b 1a             	mov    (%rdx),%rbx
+  802d0d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d10:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d15:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d19:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802d1d:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802d21:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d23:	48 85 c0             	test   %rax,%rax
+  802d26:	7f 06                	jg     802d2e <sys_ipc_call_short+0x37>
+}
+  802d28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d2c:	c9                   	leave
+  802d2d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d2e:	49 89 c0             	mov    %rax,%r8
+  802d31:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802d36:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802d3d:	00 00 00 
+  802d40:	be 27 00 00 00       	mov    $0x27,%esi
+  802d45:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802d4c:	00 00 00 
+  802d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d54:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802d5b:	00 00 00 
+  802d5e:	41 ff d1             	call   *%r9
+
+0000000000802d61 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d61:	55                   	push   %rbp
+  802d62:	48 89 e5             	mov    %rsp,%rbp
+  802d65:	53                   	push   %rbx
+  802d66:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6a:	89 f8                	mov    %edi,%eax
+  802d6c:	49 89 f2             	mov    %rsi,%r10
+  802d6f:	48 89 d3             	mov    %rdx,%rbx
+  802d72:	48 89 cf             	mov    %rcx,%rdi
+  802d75:	44 89 c6             	mov    %r8d,%esi
+  802d78:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d7b:	48 63 f6             	movslq %esi,%rsi
+  802d7e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d81:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d86:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d89:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d8d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d8f:	48 85 c0             	test   %rax,%rax
+  802d92:	7f 06                	jg     802d9a <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d98:	c9                   	leave
+  802d99:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d9a:	49 89 c0             	mov    %rax,%r8
+  802d9d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802da2:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802da9:	00 00 00 
+  802dac:	be 27 00 00 00       	mov    $0x27,%esi
+  802db1:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802db8:	00 00 00 
+  802dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc0:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802dc7:	00 00 00 
+  802dca:	41 ff d1             	call   *%r9
+
+0000000000802dcd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802dcd:	55                   	push   %rbp
+  802dce:	48 89 e5             	mov    %rsp,%rbp
+  802dd1:	53                   	push   %rbx
+  802dd2:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd6:	48 89 fa             	mov    %rdi,%rdx
+  802dd9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802ddc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802de1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802de6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802deb:	be 00 00 00 00       	mov    $0x0,%esi
+  802df0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802df6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dfc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dfe:	48 85 c0             	test   %rax,%rax
+  802e01:	7f 06                	jg     802e09 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e07:	c9                   	leave
+  802e08:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e09:	49 89 c0             	mov    %rax,%r8
+  802e0c:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802e11:	48 ba a8 64 80 00 00 	movabs $0x8064a8,%rdx
+  802e18:	00 00 00 
+  802e1b:	be 27 00 00 00       	mov    $0x27,%esi
+  802e20:	48 bf c7 64 80 00 00 	movabs $0x8064c7,%rdi
+  802e27:	00 00 00 
+  802e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e2f:	49 b9 07 56 80 00 00 	movabs $0x805607,%r9
+  802e36:	00 00 00 
+  802e39:	41 ff d1             	call   *%r9
+
+0000000000802e3c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802e3c:	55                   	push   %rbp
+  802e3d:	48 89 e5             	mov    %rsp,%rbp
+  802e40:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e41:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e55:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e65:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e6b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e71:	c9                   	leave
+  802e72:	c3                   	ret
+
+0000000000802e73 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802e73:	55                   	push   %rbp
+  802e74:	48 89 e5             	mov    %rsp,%rbp
+  802e77:	53                   	push   %rbx
+  802e78:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e7b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e80:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ea0:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802ea2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ea6:	c9                   	leave
+  802ea7:	c3                   	ret
+
+0000000000802ea8 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802ea8:	55                   	push   %rbp
+  802ea9:	48 89 e5             	mov    %rsp,%rbp
+  802eac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802ead:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802eb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ec6:	be 00 00 00 00       	mov    $0x0,%esi
+  802ecb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ed1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ed7:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ed9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802edd:	c9                   	leave
+  802ede:	c3                   	ret
+
+0000000000802edf <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802edf:	55                   	push   %rbp
+  802ee0:	48 89 e5             	mov    %rsp,%rbp
+  802ee3:	53                   	push   %rbx
+  802ee4:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802ee8:	b8 08 00 00 00       	mov    $0x8,%eax
+  802eed:	cd 30                	int    $0x30
+  802eef:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  802ef1:	85 c0                	test   %eax,%eax
+  802ef3:	0f 88 85 00 00 00    	js     802f7e <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  802ef9:	0f 84 ac 00 00 00    	je     802fab <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  802eff:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802f05:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802f0c:	00 00 00 
+  802f0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f14:	89 c2                	mov    %eax,%edx
+  802f16:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f20:	48 b8 ee 28 80 00 00 	movabs $0x8028ee,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+  802f2c:	85 c0                	test   %eax,%eax
+  802f2e:	0f 88 a8 00 00 00    	js     802fdc <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  802f34:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  802f3b:	00 00 00 
+  802f3e:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  802f45:	89 df                	mov    %ebx,%edi
+  802f47:	48 b8 a4 2a 80 00 00 	movabs $0x802aa4,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	0f 88 ae 00 00 00    	js     803009 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802f5b:	be 02 00 00 00       	mov    $0x2,%esi
+  802f60:	89 df                	mov    %ebx,%edi
+  802f62:	48 b8 c6 29 80 00 00 	movabs $0x8029c6,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+  802f6e:	85 c0                	test   %eax,%eax
+  802f70:	0f 88 c0 00 00 00    	js     803036 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  802f76:	89 d8                	mov    %ebx,%eax
+  802f78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f7c:	c9                   	leave
+  802f7d:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  802f7e:	89 c1                	mov    %eax,%ecx
+  802f80:	48 ba d5 64 80 00 00 	movabs $0x8064d5,%rdx
+  802f87:	00 00 00 
+  802f8a:	be 20 00 00 00       	mov    $0x20,%esi
+  802f8f:	48 bf e5 64 80 00 00 	movabs $0x8064e5,%rdi
+  802f96:	00 00 00 
+  802f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9e:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  802fa5:	00 00 00 
+  802fa8:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802fab:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  802fb2:	00 00 00 
+  802fb5:	ff d0                	call   *%rax
+  802fb7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802fbc:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  802fc3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802fca:	00 00 00 
+  802fcd:	48 01 d0             	add    %rdx,%rax
+  802fd0:	48 a3 28 80 80 01 00 	movabs %rax,0x1808028
+  802fd7:	00 00 00 
+        return 0;
+  802fda:	eb 9a                	jmp    802f76 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  802fdc:	89 c1                	mov    %eax,%ecx
+  802fde:	48 ba f0 64 80 00 00 	movabs $0x8064f0,%rdx
+  802fe5:	00 00 00 
+  802fe8:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802fed:	48 bf e5 64 80 00 00 	movabs $0x8064e5,%rdi
+  802ff4:	00 00 00 
+  802ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffc:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803003:	00 00 00 
+  803006:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803009:	89 c1                	mov    %eax,%ecx
+  80300b:	48 ba 38 65 80 00 00 	movabs $0x806538,%rdx
+  803012:	00 00 00 
+  803015:	be 32 00 00 00       	mov    $0x32,%esi
+  80301a:	48 bf e5 64 80 00 00 	movabs $0x8064e5,%rdi
+  803021:	00 00 00 
+  803024:	b8 00 00 00 00       	mov    $0x0,%eax
+  803029:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803030:	00 00 00 
+  803033:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803036:	89 c1                	mov    %eax,%ecx
+  803038:	48 ba 03 65 80 00 00 	movabs $0x806503,%rdx
+  80303f:	00 00 00 
+  803042:	be 37 00 00 00       	mov    $0x37,%esi
+  803047:	48 bf e5 64 80 00 00 	movabs $0x8064e5,%rdi
+  80304e:	00 00 00 
+  803051:	b8 00 00 00 00       	mov    $0x0,%eax
+  803056:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  80305d:	00 00 00 
+  803060:	41 ff d0             	call   *%r8
+
+0000000000803063 <sfork>:
+
+envid_t
+sfork() {
+  803063:	55                   	push   %rbp
+  803064:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  803067:	48 ba 1a 65 80 00 00 	movabs $0x80651a,%rdx
+  80306e:	00 00 00 
+  803071:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803076:	48 bf e5 64 80 00 00 	movabs $0x8064e5,%rdi
+  80307d:	00 00 00 
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+  803085:	48 b9 07 56 80 00 00 	movabs $0x805607,%rcx
+  80308c:	00 00 00 
+  80308f:	ff d1                	call   *%rcx
+
+0000000000803091 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  803091:	85 ff                	test   %edi,%edi
+  803093:	78 58                	js     8030ed <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  803095:	48 85 f6             	test   %rsi,%rsi
+  803098:	74 12                	je     8030ac <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80309a:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8030a1:	00 00 00 
+  8030a4:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8030aa:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8030ac:	48 85 c9             	test   %rcx,%rcx
+  8030af:	74 12                	je     8030c3 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8030b1:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8030b8:	00 00 00 
+  8030bb:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8030c1:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8030c3:	48 85 d2             	test   %rdx,%rdx
+  8030c6:	74 14                	je     8030dc <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8030c8:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8030cf:	00 00 00 
+  8030d2:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8030d9:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8030dc:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8030e3:	00 00 00 
+  8030e6:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8030ec:	c3                   	ret
+        if (from_env_store) {
+  8030ed:	48 85 f6             	test   %rsi,%rsi
+  8030f0:	74 06                	je     8030f8 <ipc_result+0x67>
+            *from_env_store = 0;
+  8030f2:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8030f8:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8030fa:	48 85 c9             	test   %rcx,%rcx
+  8030fd:	74 ed                	je     8030ec <ipc_result+0x5b>
+            *perm_store = 0;
+  8030ff:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  803105:	c3                   	ret
+
+0000000000803106 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803106:	55                   	push   %rbp
+  803107:	48 89 e5             	mov    %rsp,%rbp
+  80310a:	41 55                	push   %r13
+  80310c:	41 54                	push   %r12
+  80310e:	53                   	push   %rbx
+  80310f:	48 83 ec 08          	sub    $0x8,%rsp
+  803113:	49 89 fc             	mov    %rdi,%r12
+  803116:	48 89 f7             	mov    %rsi,%rdi
+  803119:	48 89 d3             	mov    %rdx,%rbx
+  80311c:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80311f:	48 85 f6             	test   %rsi,%rsi
+  803122:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803129:	00 00 00 
+  80312c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  803130:	be 00 00 00 00       	mov    $0x0,%esi
+  803135:	48 85 d2             	test   %rdx,%rdx
+  803138:	74 03                	je     80313d <ipc_recv+0x37>
+  80313a:	48 8b 32             	mov    (%rdx),%rsi
+  80313d:	48 b8 cd 2d 80 00 00 	movabs $0x802dcd,%rax
+  803144:	00 00 00 
+  803147:	ff d0                	call   *%rax
+  803149:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80314b:	4c 89 e9             	mov    %r13,%rcx
+  80314e:	48 89 da             	mov    %rbx,%rdx
+  803151:	4c 89 e6             	mov    %r12,%rsi
+  803154:	48 b8 91 30 80 00 00 	movabs $0x803091,%rax
+  80315b:	00 00 00 
+  80315e:	ff d0                	call   *%rax
+}
+  803160:	48 83 c4 08          	add    $0x8,%rsp
+  803164:	5b                   	pop    %rbx
+  803165:	41 5c                	pop    %r12
+  803167:	41 5d                	pop    %r13
+  803169:	5d                   	pop    %rbp
+  80316a:	c3                   	ret
+
+000000000080316b <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80316b:	55                   	push   %rbp
+  80316c:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80316f:	48 85 d2             	test   %rdx,%rdx
+  803172:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803179:	00 00 00 
+  80317c:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  803180:	89 f6                	mov    %esi,%esi
+  803182:	48 b8 59 2c 80 00 00 	movabs $0x802c59,%rax
+  803189:	00 00 00 
+  80318c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80318e:	85 c0                	test   %eax,%eax
+  803190:	78 02                	js     803194 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  803192:	5d                   	pop    %rbp
+  803193:	c3                   	ret
+        panic("ipc_send: %i", res);
+  803194:	89 c1                	mov    %eax,%ecx
+  803196:	48 ba 57 65 80 00 00 	movabs $0x806557,%rdx
+  80319d:	00 00 00 
+  8031a0:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8031a5:	48 bf 64 65 80 00 00 	movabs $0x806564,%rdi
+  8031ac:	00 00 00 
+  8031af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b4:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  8031bb:	00 00 00 
+  8031be:	41 ff d0             	call   *%r8
+
+00000000008031c1 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8031c1:	55                   	push   %rbp
+  8031c2:	48 89 e5             	mov    %rsp,%rbp
+  8031c5:	53                   	push   %rbx
+  8031c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ca:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8031ce:	48 85 d2             	test   %rdx,%rdx
+  8031d1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8031d8:	00 00 00 
+  8031db:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8031df:	4d 85 c9             	test   %r9,%r9
+  8031e2:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8031e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031eb:	48 85 db             	test   %rbx,%rbx
+  8031ee:	74 03                	je     8031f3 <ipc_call+0x32>
+  8031f0:	48 8b 03             	mov    (%rbx),%rax
+  8031f3:	89 f6                	mov    %esi,%esi
+  8031f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8031f9:	50                   	push   %rax
+  8031fa:	48 b8 8b 2c 80 00 00 	movabs $0x802c8b,%rax
+  803201:	00 00 00 
+  803204:	ff d0                	call   *%rax
+  803206:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  803208:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80320c:	48 89 da             	mov    %rbx,%rdx
+  80320f:	be 00 00 00 00       	mov    $0x0,%esi
+  803214:	48 b8 91 30 80 00 00 	movabs $0x803091,%rax
+  80321b:	00 00 00 
+  80321e:	ff d0                	call   *%rax
+}
+  803220:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+
+0000000000803226 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  803226:	55                   	push   %rbp
+  803227:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  80322a:	89 f6                	mov    %esi,%esi
+  80322c:	48 b8 f7 2c 80 00 00 	movabs $0x802cf7,%rax
+  803233:	00 00 00 
+  803236:	ff d0                	call   *%rax
+  803238:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  80323a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80323f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803244:	be 00 00 00 00       	mov    $0x0,%esi
+  803249:	48 b8 91 30 80 00 00 	movabs $0x803091,%rax
+  803250:	00 00 00 
+  803253:	ff d0                	call   *%rax
+}
+  803255:	5d                   	pop    %rbp
+  803256:	c3                   	ret
+
+0000000000803257 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  803257:	55                   	push   %rbp
+  803258:	48 89 e5             	mov    %rsp,%rbp
+  80325b:	41 54                	push   %r12
+  80325d:	53                   	push   %rbx
+  80325e:	4c 89 cb             	mov    %r9,%rbx
+  803261:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  803265:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803269:	48 85 d2             	test   %rdx,%rdx
+  80326c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803273:	00 00 00 
+  803276:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80327a:	4d 85 c9             	test   %r9,%r9
+  80327d:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  803281:	b8 00 00 00 00       	mov    $0x0,%eax
+  803286:	4d 85 e4             	test   %r12,%r12
+  803289:	74 04                	je     80328f <ipc_reply_wait+0x38>
+  80328b:	49 8b 04 24          	mov    (%r12),%rax
+  80328f:	89 f6                	mov    %esi,%esi
+  803291:	48 83 ec 08          	sub    $0x8,%rsp
+  803295:	50                   	push   %rax
+  803296:	48 b8 61 2d 80 00 00 	movabs $0x802d61,%rax
+  80329d:	00 00 00 
+  8032a0:	ff d0                	call   *%rax
+  8032a2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8032a4:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8032a8:	4c 89 e2             	mov    %r12,%rdx
+  8032ab:	48 89 de             	mov    %rbx,%rsi
+  8032ae:	48 b8 91 30 80 00 00 	movabs $0x803091,%rax
+  8032b5:	00 00 00 
+  8032b8:	ff d0                	call   *%rax
+}
+  8032ba:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8032be:	5b                   	pop    %rbx
+  8032bf:	41 5c                	pop    %r12
+  8032c1:	5d                   	pop    %rbp
+  8032c2:	c3                   	ret
+
+00000000008032c3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8032c3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8032c8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8032cf:	00 00 00 
+  8032d2:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8032d9:	48 01 ca             	add    %rcx,%rdx
+  8032dc:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8032e2:	39 fa                	cmp    %edi,%edx
+  8032e4:	74 12                	je     8032f8 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8032e6:	48 83 c0 01          	add    $0x1,%rax
+  8032ea:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8032f0:	75 e0                	jne    8032d2 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8032f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f7:	c3                   	ret
+            return envs[i].env_id;
+  8032f8:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8032ff:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803306:	00 00 00 
+  803309:	48 01 d0             	add    %rdx,%rax
+  80330c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803312:	c3                   	ret
+
+0000000000803313 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803313:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80331a:	ff ff ff 
+  80331d:	48 01 f8             	add    %rdi,%rax
+  803320:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803324:	c3                   	ret
+
+0000000000803325 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803325:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80332c:	ff ff ff 
+  80332f:	48 01 f8             	add    %rdi,%rax
+  803332:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803336:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80333c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803340:	c3                   	ret
+
+0000000000803341 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803341:	55                   	push   %rbp
+  803342:	48 89 e5             	mov    %rsp,%rbp
+  803345:	41 57                	push   %r15
+  803347:	41 56                	push   %r14
+  803349:	41 55                	push   %r13
+  80334b:	41 54                	push   %r12
+  80334d:	53                   	push   %rbx
+  80334e:	48 83 ec 08          	sub    $0x8,%rsp
+  803352:	49 89 ff             	mov    %rdi,%r15
+  803355:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80335a:	49 bd 41 48 80 00 00 	movabs $0x804841,%r13
+  803361:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803364:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80336a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80336d:	48 89 df             	mov    %rbx,%rdi
+  803370:	41 ff d5             	call   *%r13
+  803373:	83 e0 04             	and    $0x4,%eax
+  803376:	74 17                	je     80338f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803378:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80337f:	4c 39 f3             	cmp    %r14,%rbx
+  803382:	75 e6                	jne    80336a <fd_alloc+0x29>
+  803384:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80338a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80338f:	4d 89 27             	mov    %r12,(%r15)
+}
+  803392:	48 83 c4 08          	add    $0x8,%rsp
+  803396:	5b                   	pop    %rbx
+  803397:	41 5c                	pop    %r12
+  803399:	41 5d                	pop    %r13
+  80339b:	41 5e                	pop    %r14
+  80339d:	41 5f                	pop    %r15
+  80339f:	5d                   	pop    %rbp
+  8033a0:	c3                   	ret
+
+00000000008033a1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8033a1:	83 ff 1f             	cmp    $0x1f,%edi
+  8033a4:	77 39                	ja     8033df <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8033a6:	55                   	push   %rbp
+  8033a7:	48 89 e5             	mov    %rsp,%rbp
+  8033aa:	41 54                	push   %r12
+  8033ac:	53                   	push   %rbx
+  8033ad:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8033b0:	48 63 df             	movslq %edi,%rbx
+  8033b3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8033ba:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8033be:	48 89 df             	mov    %rbx,%rdi
+  8033c1:	48 b8 41 48 80 00 00 	movabs $0x804841,%rax
+  8033c8:	00 00 00 
+  8033cb:	ff d0                	call   *%rax
+  8033cd:	a8 04                	test   $0x4,%al
+  8033cf:	74 14                	je     8033e5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8033d1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8033d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033da:	5b                   	pop    %rbx
+  8033db:	41 5c                	pop    %r12
+  8033dd:	5d                   	pop    %rbp
+  8033de:	c3                   	ret
+        return -E_INVAL;
+  8033df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8033e4:	c3                   	ret
+        return -E_INVAL;
+  8033e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033ea:	eb ee                	jmp    8033da <fd_lookup+0x39>
+
+00000000008033ec <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8033ec:	55                   	push   %rbp
+  8033ed:	48 89 e5             	mov    %rsp,%rbp
+  8033f0:	41 54                	push   %r12
+  8033f2:	53                   	push   %rbx
+  8033f3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8033f6:	48 b8 00 66 80 00 00 	movabs $0x806600,%rax
+  8033fd:	00 00 00 
+  803400:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803407:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80340a:	39 3b                	cmp    %edi,(%rbx)
+  80340c:	74 47                	je     803455 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80340e:	48 83 c0 08          	add    $0x8,%rax
+  803412:	48 8b 18             	mov    (%rax),%rbx
+  803415:	48 85 db             	test   %rbx,%rbx
+  803418:	75 f0                	jne    80340a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80341a:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803421:	00 00 00 
+  803424:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80342a:	89 fa                	mov    %edi,%edx
+  80342c:	48 bf 70 65 80 00 00 	movabs $0x806570,%rdi
+  803433:	00 00 00 
+  803436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80343b:	48 b9 e5 17 80 00 00 	movabs $0x8017e5,%rcx
+  803442:	00 00 00 
+  803445:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803447:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80344c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803450:	5b                   	pop    %rbx
+  803451:	41 5c                	pop    %r12
+  803453:	5d                   	pop    %rbp
+  803454:	c3                   	ret
+            return 0;
+  803455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345a:	eb f0                	jmp    80344c <dev_lookup+0x60>
+
+000000000080345c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80345c:	55                   	push   %rbp
+  80345d:	48 89 e5             	mov    %rsp,%rbp
+  803460:	41 55                	push   %r13
+  803462:	41 54                	push   %r12
+  803464:	53                   	push   %rbx
+  803465:	48 83 ec 18          	sub    $0x18,%rsp
+  803469:	48 89 fb             	mov    %rdi,%rbx
+  80346c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80346f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803476:	ff ff ff 
+  803479:	48 01 df             	add    %rbx,%rdi
+  80347c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803480:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803484:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+  803490:	41 89 c5             	mov    %eax,%r13d
+  803493:	85 c0                	test   %eax,%eax
+  803495:	78 06                	js     80349d <fd_close+0x41>
+  803497:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80349b:	74 1a                	je     8034b7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80349d:	45 84 e4             	test   %r12b,%r12b
+  8034a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8034a9:	44 89 e8             	mov    %r13d,%eax
+  8034ac:	48 83 c4 18          	add    $0x18,%rsp
+  8034b0:	5b                   	pop    %rbx
+  8034b1:	41 5c                	pop    %r12
+  8034b3:	41 5d                	pop    %r13
+  8034b5:	5d                   	pop    %rbp
+  8034b6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034b7:	8b 3b                	mov    (%rbx),%edi
+  8034b9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034bd:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  8034c4:	00 00 00 
+  8034c7:	ff d0                	call   *%rax
+  8034c9:	41 89 c5             	mov    %eax,%r13d
+  8034cc:	85 c0                	test   %eax,%eax
+  8034ce:	78 1b                	js     8034eb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8034d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034d4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034d8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8034de:	48 85 c0             	test   %rax,%rax
+  8034e1:	74 08                	je     8034eb <fd_close+0x8f>
+  8034e3:	48 89 df             	mov    %rbx,%rdi
+  8034e6:	ff d0                	call   *%rax
+  8034e8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8034eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034f0:	48 89 de             	mov    %rbx,%rsi
+  8034f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f8:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  8034ff:	00 00 00 
+  803502:	ff d0                	call   *%rax
+    return res;
+  803504:	eb a3                	jmp    8034a9 <fd_close+0x4d>
+
+0000000000803506 <close>:
+
+int
+close(int fdnum) {
+  803506:	55                   	push   %rbp
+  803507:	48 89 e5             	mov    %rsp,%rbp
+  80350a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80350e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803512:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  803519:	00 00 00 
+  80351c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80351e:	85 c0                	test   %eax,%eax
+  803520:	78 15                	js     803537 <close+0x31>
+
+    return fd_close(fd, 1);
+  803522:	be 01 00 00 00       	mov    $0x1,%esi
+  803527:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80352b:	48 b8 5c 34 80 00 00 	movabs $0x80345c,%rax
+  803532:	00 00 00 
+  803535:	ff d0                	call   *%rax
+}
+  803537:	c9                   	leave
+  803538:	c3                   	ret
+
+0000000000803539 <close_all>:
+
+void
+close_all(void) {
+  803539:	55                   	push   %rbp
+  80353a:	48 89 e5             	mov    %rsp,%rbp
+  80353d:	41 54                	push   %r12
+  80353f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803540:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803545:	49 bc 06 35 80 00 00 	movabs $0x803506,%r12
+  80354c:	00 00 00 
+  80354f:	89 df                	mov    %ebx,%edi
+  803551:	41 ff d4             	call   *%r12
+  803554:	83 c3 01             	add    $0x1,%ebx
+  803557:	83 fb 20             	cmp    $0x20,%ebx
+  80355a:	75 f3                	jne    80354f <close_all+0x16>
+}
+  80355c:	5b                   	pop    %rbx
+  80355d:	41 5c                	pop    %r12
+  80355f:	5d                   	pop    %rbp
+  803560:	c3                   	ret
+
+0000000000803561 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803561:	55                   	push   %rbp
+  803562:	48 89 e5             	mov    %rsp,%rbp
+  803565:	41 57                	push   %r15
+  803567:	41 56                	push   %r14
+  803569:	41 55                	push   %r13
+  80356b:	41 54                	push   %r12
+  80356d:	53                   	push   %rbx
+  80356e:	48 83 ec 18          	sub    $0x18,%rsp
+  803572:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803575:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803579:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  803580:	00 00 00 
+  803583:	ff d0                	call   *%rax
+  803585:	89 c3                	mov    %eax,%ebx
+  803587:	85 c0                	test   %eax,%eax
+  803589:	0f 88 b8 00 00 00    	js     803647 <dup+0xe6>
+    close(newfdnum);
+  80358f:	44 89 e7             	mov    %r12d,%edi
+  803592:	48 b8 06 35 80 00 00 	movabs $0x803506,%rax
+  803599:	00 00 00 
+  80359c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80359e:	4d 63 ec             	movslq %r12d,%r13
+  8035a1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8035a8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8035ac:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8035b0:	4c 89 ff             	mov    %r15,%rdi
+  8035b3:	49 be 25 33 80 00 00 	movabs $0x803325,%r14
+  8035ba:	00 00 00 
+  8035bd:	41 ff d6             	call   *%r14
+  8035c0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8035c3:	4c 89 ef             	mov    %r13,%rdi
+  8035c6:	41 ff d6             	call   *%r14
+  8035c9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8035cc:	48 89 df             	mov    %rbx,%rdi
+  8035cf:	48 b8 41 48 80 00 00 	movabs $0x804841,%rax
+  8035d6:	00 00 00 
+  8035d9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8035db:	a8 04                	test   $0x4,%al
+  8035dd:	74 2b                	je     80360a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8035df:	41 89 c1             	mov    %eax,%r9d
+  8035e2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035e8:	4c 89 f1             	mov    %r14,%rcx
+  8035eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f0:	48 89 de             	mov    %rbx,%rsi
+  8035f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035f8:	48 b8 ee 28 80 00 00 	movabs $0x8028ee,%rax
+  8035ff:	00 00 00 
+  803602:	ff d0                	call   *%rax
+  803604:	89 c3                	mov    %eax,%ebx
+  803606:	85 c0                	test   %eax,%eax
+  803608:	78 4e                	js     803658 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80360a:	4c 89 ff             	mov    %r15,%rdi
+  80360d:	48 b8 41 48 80 00 00 	movabs $0x804841,%rax
+  803614:	00 00 00 
+  803617:	ff d0                	call   *%rax
+  803619:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80361c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803622:	4c 89 e9             	mov    %r13,%rcx
+  803625:	ba 00 00 00 00       	mov    $0x0,%edx
+  80362a:	4c 89 fe             	mov    %r15,%rsi
+  80362d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803632:	48 b8 ee 28 80 00 00 	movabs $0x8028ee,%rax
+  803639:	00 00 00 
+  80363c:	ff d0                	call   *%rax
+  80363e:	89 c3                	mov    %eax,%ebx
+  803640:	85 c0                	test   %eax,%eax
+  803642:	78 14                	js     803658 <dup+0xf7>
+
+    return newfdnum;
+  803644:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803647:	89 d8                	mov    %ebx,%eax
+  803649:	48 83 c4 18          	add    $0x18,%rsp
+  80364d:	5b                   	pop    %rbx
+  80364e:	41 5c                	pop    %r12
+  803650:	41 5d                	pop    %r13
+  803652:	41 5e                	pop    %r14
+  803654:	41 5f                	pop    %r15
+  803656:	5d                   	pop    %rbp
+  803657:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803658:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80365d:	4c 89 ee             	mov    %r13,%rsi
+  803660:	bf 00 00 00 00       	mov    $0x0,%edi
+  803665:	49 bc 59 29 80 00 00 	movabs $0x802959,%r12
+  80366c:	00 00 00 
+  80366f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803672:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803677:	4c 89 f6             	mov    %r14,%rsi
+  80367a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367f:	41 ff d4             	call   *%r12
+    return res;
+  803682:	eb c3                	jmp    803647 <dup+0xe6>
+
+0000000000803684 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803684:	55                   	push   %rbp
+  803685:	48 89 e5             	mov    %rsp,%rbp
+  803688:	41 56                	push   %r14
+  80368a:	41 55                	push   %r13
+  80368c:	41 54                	push   %r12
+  80368e:	53                   	push   %rbx
+  80368f:	48 83 ec 10          	sub    $0x10,%rsp
+  803693:	89 fb                	mov    %edi,%ebx
+  803695:	49 89 f4             	mov    %rsi,%r12
+  803698:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80369b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80369f:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  8036a6:	00 00 00 
+  8036a9:	ff d0                	call   *%rax
+  8036ab:	85 c0                	test   %eax,%eax
+  8036ad:	78 4c                	js     8036fb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036af:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8036b3:	41 8b 3e             	mov    (%r14),%edi
+  8036b6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036ba:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  8036c1:	00 00 00 
+  8036c4:	ff d0                	call   *%rax
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	78 35                	js     8036ff <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8036ca:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8036ce:	83 e0 03             	and    $0x3,%eax
+  8036d1:	83 f8 01             	cmp    $0x1,%eax
+  8036d4:	74 2d                	je     803703 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036da:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8036de:	48 85 c0             	test   %rax,%rax
+  8036e1:	74 56                	je     803739 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8036e3:	4c 89 ea             	mov    %r13,%rdx
+  8036e6:	4c 89 e6             	mov    %r12,%rsi
+  8036e9:	4c 89 f7             	mov    %r14,%rdi
+  8036ec:	ff d0                	call   *%rax
+}
+  8036ee:	48 83 c4 10          	add    $0x10,%rsp
+  8036f2:	5b                   	pop    %rbx
+  8036f3:	41 5c                	pop    %r12
+  8036f5:	41 5d                	pop    %r13
+  8036f7:	41 5e                	pop    %r14
+  8036f9:	5d                   	pop    %rbp
+  8036fa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036fb:	48 98                	cltq
+  8036fd:	eb ef                	jmp    8036ee <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036ff:	48 98                	cltq
+  803701:	eb eb                	jmp    8036ee <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803703:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80370a:	00 00 00 
+  80370d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803713:	89 da                	mov    %ebx,%edx
+  803715:	48 bf b1 65 80 00 00 	movabs $0x8065b1,%rdi
+  80371c:	00 00 00 
+  80371f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803724:	48 b9 e5 17 80 00 00 	movabs $0x8017e5,%rcx
+  80372b:	00 00 00 
+  80372e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803730:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803737:	eb b5                	jmp    8036ee <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803739:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803740:	eb ac                	jmp    8036ee <read+0x6a>
+
+0000000000803742 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803742:	55                   	push   %rbp
+  803743:	48 89 e5             	mov    %rsp,%rbp
+  803746:	41 57                	push   %r15
+  803748:	41 56                	push   %r14
+  80374a:	41 55                	push   %r13
+  80374c:	41 54                	push   %r12
+  80374e:	53                   	push   %rbx
+  80374f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803753:	48 85 d2             	test   %rdx,%rdx
+  803756:	74 54                	je     8037ac <readn+0x6a>
+  803758:	41 89 fd             	mov    %edi,%r13d
+  80375b:	49 89 f6             	mov    %rsi,%r14
+  80375e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803761:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803766:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80376b:	49 bf 84 36 80 00 00 	movabs $0x803684,%r15
+  803772:	00 00 00 
+  803775:	4c 89 e2             	mov    %r12,%rdx
+  803778:	48 29 f2             	sub    %rsi,%rdx
+  80377b:	4c 01 f6             	add    %r14,%rsi
+  80377e:	44 89 ef             	mov    %r13d,%edi
+  803781:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803784:	85 c0                	test   %eax,%eax
+  803786:	78 20                	js     8037a8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803788:	01 c3                	add    %eax,%ebx
+  80378a:	85 c0                	test   %eax,%eax
+  80378c:	74 08                	je     803796 <readn+0x54>
+  80378e:	48 63 f3             	movslq %ebx,%rsi
+  803791:	4c 39 e6             	cmp    %r12,%rsi
+  803794:	72 df                	jb     803775 <readn+0x33>
+    }
+    return res;
+  803796:	48 63 c3             	movslq %ebx,%rax
+}
+  803799:	48 83 c4 08          	add    $0x8,%rsp
+  80379d:	5b                   	pop    %rbx
+  80379e:	41 5c                	pop    %r12
+  8037a0:	41 5d                	pop    %r13
+  8037a2:	41 5e                	pop    %r14
+  8037a4:	41 5f                	pop    %r15
+  8037a6:	5d                   	pop    %rbp
+  8037a7:	c3                   	ret
+        if (inc < 0) return inc;
+  8037a8:	48 98                	cltq
+  8037aa:	eb ed                	jmp    803799 <readn+0x57>
+    int inc = 1, res = 0;
+  8037ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037b1:	eb e3                	jmp    803796 <readn+0x54>
+
+00000000008037b3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8037b3:	55                   	push   %rbp
+  8037b4:	48 89 e5             	mov    %rsp,%rbp
+  8037b7:	41 56                	push   %r14
+  8037b9:	41 55                	push   %r13
+  8037bb:	41 54                	push   %r12
+  8037bd:	53                   	push   %rbx
+  8037be:	48 83 ec 10          	sub    $0x10,%rsp
+  8037c2:	89 fb                	mov    %edi,%ebx
+  8037c4:	49 89 f4             	mov    %rsi,%r12
+  8037c7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037ca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037ce:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  8037d5:	00 00 00 
+  8037d8:	ff d0                	call   *%rax
+  8037da:	85 c0                	test   %eax,%eax
+  8037dc:	78 47                	js     803825 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037de:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8037e2:	41 8b 3e             	mov    (%r14),%edi
+  8037e5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037e9:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  8037f0:	00 00 00 
+  8037f3:	ff d0                	call   *%rax
+  8037f5:	85 c0                	test   %eax,%eax
+  8037f7:	78 30                	js     803829 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037f9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8037fe:	74 2d                	je     80382d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803800:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803804:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803808:	48 85 c0             	test   %rax,%rax
+  80380b:	74 56                	je     803863 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80380d:	4c 89 ea             	mov    %r13,%rdx
+  803810:	4c 89 e6             	mov    %r12,%rsi
+  803813:	4c 89 f7             	mov    %r14,%rdi
+  803816:	ff d0                	call   *%rax
+}
+  803818:	48 83 c4 10          	add    $0x10,%rsp
+  80381c:	5b                   	pop    %rbx
+  80381d:	41 5c                	pop    %r12
+  80381f:	41 5d                	pop    %r13
+  803821:	41 5e                	pop    %r14
+  803823:	5d                   	pop    %rbp
+  803824:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803825:	48 98                	cltq
+  803827:	eb ef                	jmp    803818 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803829:	48 98                	cltq
+  80382b:	eb eb                	jmp    803818 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80382d:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803834:	00 00 00 
+  803837:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80383d:	89 da                	mov    %ebx,%edx
+  80383f:	48 bf cd 65 80 00 00 	movabs $0x8065cd,%rdi
+  803846:	00 00 00 
+  803849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384e:	48 b9 e5 17 80 00 00 	movabs $0x8017e5,%rcx
+  803855:	00 00 00 
+  803858:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80385a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803861:	eb b5                	jmp    803818 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803863:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80386a:	eb ac                	jmp    803818 <write+0x65>
+
+000000000080386c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80386c:	55                   	push   %rbp
+  80386d:	48 89 e5             	mov    %rsp,%rbp
+  803870:	53                   	push   %rbx
+  803871:	48 83 ec 18          	sub    $0x18,%rsp
+  803875:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803877:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80387b:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  803882:	00 00 00 
+  803885:	ff d0                	call   *%rax
+  803887:	85 c0                	test   %eax,%eax
+  803889:	78 0c                	js     803897 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80388b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80388f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803892:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803897:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80389b:	c9                   	leave
+  80389c:	c3                   	ret
+
+000000000080389d <tell>:
+
+int tell(int fdnum) {
+  80389d:	55                   	push   %rbp
+  80389e:	48 89 e5             	mov    %rsp,%rbp
+  8038a1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038a5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038a9:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+  8038b5:	85 c0                	test   %eax,%eax
+  8038b7:	78 07                	js     8038c0 <tell+0x23>
+
+    return fd->fd_offset;
+  8038b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038bd:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8038c0:	c9                   	leave
+  8038c1:	c3                   	ret
+
+00000000008038c2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8038c2:	55                   	push   %rbp
+  8038c3:	48 89 e5             	mov    %rsp,%rbp
+  8038c6:	41 55                	push   %r13
+  8038c8:	41 54                	push   %r12
+  8038ca:	53                   	push   %rbx
+  8038cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8038cf:	89 fb                	mov    %edi,%ebx
+  8038d1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038d4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038d8:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  8038df:	00 00 00 
+  8038e2:	ff d0                	call   *%rax
+  8038e4:	85 c0                	test   %eax,%eax
+  8038e6:	78 38                	js     803920 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038e8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8038ec:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8038f0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038f4:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  8038fb:	00 00 00 
+  8038fe:	ff d0                	call   *%rax
+  803900:	85 c0                	test   %eax,%eax
+  803902:	78 1c                	js     803920 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803904:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803909:	74 20                	je     80392b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80390b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80390f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803913:	48 85 c0             	test   %rax,%rax
+  803916:	74 47                	je     80395f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803918:	44 89 e6             	mov    %r12d,%esi
+  80391b:	4c 89 ef             	mov    %r13,%rdi
+  80391e:	ff d0                	call   *%rax
+}
+  803920:	48 83 c4 18          	add    $0x18,%rsp
+  803924:	5b                   	pop    %rbx
+  803925:	41 5c                	pop    %r12
+  803927:	41 5d                	pop    %r13
+  803929:	5d                   	pop    %rbp
+  80392a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80392b:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803932:	00 00 00 
+  803935:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80393b:	89 da                	mov    %ebx,%edx
+  80393d:	48 bf 90 65 80 00 00 	movabs $0x806590,%rdi
+  803944:	00 00 00 
+  803947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394c:	48 b9 e5 17 80 00 00 	movabs $0x8017e5,%rcx
+  803953:	00 00 00 
+  803956:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803958:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80395d:	eb c1                	jmp    803920 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80395f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803964:	eb ba                	jmp    803920 <ftruncate+0x5e>
+
+0000000000803966 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803966:	55                   	push   %rbp
+  803967:	48 89 e5             	mov    %rsp,%rbp
+  80396a:	41 54                	push   %r12
+  80396c:	53                   	push   %rbx
+  80396d:	48 83 ec 10          	sub    $0x10,%rsp
+  803971:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803974:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803978:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  80397f:	00 00 00 
+  803982:	ff d0                	call   *%rax
+  803984:	85 c0                	test   %eax,%eax
+  803986:	78 63                	js     8039eb <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803988:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80398c:	41 8b 3c 24          	mov    (%r12),%edi
+  803990:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803994:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  80399b:	00 00 00 
+  80399e:	ff d0                	call   *%rax
+  8039a0:	85 c0                	test   %eax,%eax
+  8039a2:	78 47                	js     8039eb <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039a8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8039ad:	74 45                	je     8039f4 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8039af:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8039b2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8039b9:	00 00 00 
+    stat->st_isdir = 0;
+  8039bc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039c3:	00 00 00 
+    stat->st_ino = 0;
+  8039c6:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8039cd:	00 00 00 00 
+    stat->st_version = 0;
+  8039d1:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8039d8:	00 00 00 
+    stat->st_dev = dev;
+  8039db:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8039e2:	48 89 de             	mov    %rbx,%rsi
+  8039e5:	4c 89 e7             	mov    %r12,%rdi
+  8039e8:	ff 50 28             	call   *0x28(%rax)
+}
+  8039eb:	48 83 c4 10          	add    $0x10,%rsp
+  8039ef:	5b                   	pop    %rbx
+  8039f0:	41 5c                	pop    %r12
+  8039f2:	5d                   	pop    %rbp
+  8039f3:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039f4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039f9:	eb f0                	jmp    8039eb <fstat+0x85>
+
+00000000008039fb <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8039fb:	55                   	push   %rbp
+  8039fc:	48 89 e5             	mov    %rsp,%rbp
+  8039ff:	41 54                	push   %r12
+  803a01:	53                   	push   %rbx
+  803a02:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803a05:	be 00 00 00 00       	mov    $0x0,%esi
+  803a0a:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  803a11:	00 00 00 
+  803a14:	ff d0                	call   *%rax
+  803a16:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803a18:	85 c0                	test   %eax,%eax
+  803a1a:	78 25                	js     803a41 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803a1c:	4c 89 e6             	mov    %r12,%rsi
+  803a1f:	89 c7                	mov    %eax,%edi
+  803a21:	48 b8 66 39 80 00 00 	movabs $0x803966,%rax
+  803a28:	00 00 00 
+  803a2b:	ff d0                	call   *%rax
+  803a2d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803a30:	89 df                	mov    %ebx,%edi
+  803a32:	48 b8 06 35 80 00 00 	movabs $0x803506,%rax
+  803a39:	00 00 00 
+  803a3c:	ff d0                	call   *%rax
+
+    return res;
+  803a3e:	44 89 e3             	mov    %r12d,%ebx
+}
+  803a41:	89 d8                	mov    %ebx,%eax
+  803a43:	5b                   	pop    %rbx
+  803a44:	41 5c                	pop    %r12
+  803a46:	5d                   	pop    %rbp
+  803a47:	c3                   	ret
+
+0000000000803a48 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a48:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803a4f:	00 00 00 
+  803a52:	83 38 00             	cmpl   $0x0,(%rax)
+  803a55:	74 0a                	je     803a61 <fsipc_env+0x19>
+    return fsenv;
+}
+  803a57:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a5e:	00 00 
+  803a60:	c3                   	ret
+fsipc_env(void) {
+  803a61:	55                   	push   %rbp
+  803a62:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a65:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a6a:	48 b8 c3 32 80 00 00 	movabs $0x8032c3,%rax
+  803a71:	00 00 00 
+  803a74:	ff d0                	call   *%rax
+  803a76:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803a7d:	00 00 
+}
+  803a7f:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a86:	00 00 
+  803a88:	5d                   	pop    %rbp
+  803a89:	c3                   	ret
+
+0000000000803a8a <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803a8a:	55                   	push   %rbp
+  803a8b:	48 89 e5             	mov    %rsp,%rbp
+  803a8e:	53                   	push   %rbx
+  803a8f:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803a93:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a9a:	00 
+  803a9b:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803aa2:	00 
+  803aa3:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803aaa:	00 
+  803aab:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803ab2:	00 
+  803ab3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803aba:	00 
+
+    assert(size <= sizeof(words));
+  803abb:	48 83 fa 28          	cmp    $0x28,%rdx
+  803abf:	77 38                	ja     803af9 <fsipc_short+0x6f>
+  803ac1:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803ac3:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803ac7:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  803ace:	00 00 00 
+  803ad1:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803ad3:	48 b8 48 3a 80 00 00 	movabs $0x803a48,%rax
+  803ada:	00 00 00 
+  803add:	ff d0                	call   *%rax
+  803adf:	89 c7                	mov    %eax,%edi
+  803ae1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803ae5:	89 de                	mov    %ebx,%esi
+  803ae7:	48 b8 26 32 80 00 00 	movabs $0x803226,%rax
+  803aee:	00 00 00 
+  803af1:	ff d0                	call   *%rax
+}
+  803af3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803af7:	c9                   	leave
+  803af8:	c3                   	ret
+    assert(size <= sizeof(words));
+  803af9:	48 b9 20 66 80 00 00 	movabs $0x806620,%rcx
+  803b00:	00 00 00 
+  803b03:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  803b0a:	00 00 00 
+  803b0d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803b12:	48 bf 4b 66 80 00 00 	movabs $0x80664b,%rdi
+  803b19:	00 00 00 
+  803b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b21:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803b28:	00 00 00 
+  803b2b:	41 ff d0             	call   *%r8
+
+0000000000803b2e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803b2e:	55                   	push   %rbp
+  803b2f:	48 89 e5             	mov    %rsp,%rbp
+  803b32:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803b36:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b39:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803b3c:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b3f:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b44:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b48:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b4d:	48 b8 8a 3a 80 00 00 	movabs $0x803a8a,%rax
+  803b54:	00 00 00 
+  803b57:	ff d0                	call   *%rax
+}
+  803b59:	c9                   	leave
+  803b5a:	c3                   	ret
+
+0000000000803b5b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803b5b:	55                   	push   %rbp
+  803b5c:	48 89 e5             	mov    %rsp,%rbp
+  803b5f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803b63:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b66:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803b69:	ba 04 00 00 00       	mov    $0x4,%edx
+  803b6e:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803b72:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b77:	48 b8 8a 3a 80 00 00 	movabs $0x803a8a,%rax
+  803b7e:	00 00 00 
+  803b81:	ff d0                	call   *%rax
+}
+  803b83:	c9                   	leave
+  803b84:	c3                   	ret
+
+0000000000803b85 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803b85:	55                   	push   %rbp
+  803b86:	48 89 e5             	mov    %rsp,%rbp
+  803b89:	41 54                	push   %r12
+  803b8b:	53                   	push   %rbx
+  803b8c:	48 83 ec 10          	sub    $0x10,%rsp
+  803b90:	89 fb                	mov    %edi,%ebx
+  803b92:	49 89 f4             	mov    %rsi,%r12
+  803b95:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b99:	48 b8 48 3a 80 00 00 	movabs $0x803a48,%rax
+  803ba0:	00 00 00 
+  803ba3:	ff d0                	call   *%rax
+  803ba5:	89 c7                	mov    %eax,%edi
+  803ba7:	6a 00                	push   $0x0
+  803ba9:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803bad:	50                   	push   %rax
+  803bae:	4d 89 e1             	mov    %r12,%r9
+  803bb1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803bb7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803bbc:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803bc3:	00 00 00 
+  803bc6:	89 de                	mov    %ebx,%esi
+  803bc8:	48 b8 c1 31 80 00 00 	movabs $0x8031c1,%rax
+  803bcf:	00 00 00 
+  803bd2:	ff d0                	call   *%rax
+}
+  803bd4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803bd8:	5b                   	pop    %rbx
+  803bd9:	41 5c                	pop    %r12
+  803bdb:	5d                   	pop    %rbp
+  803bdc:	c3                   	ret
+
+0000000000803bdd <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803bdd:	55                   	push   %rbp
+  803bde:	48 89 e5             	mov    %rsp,%rbp
+  803be1:	41 54                	push   %r12
+  803be3:	53                   	push   %rbx
+  803be4:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803be7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bea:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803bf1:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bf3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bf8:	be 00 00 00 00       	mov    $0x0,%esi
+  803bfd:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c02:	48 b8 85 3b 80 00 00 	movabs $0x803b85,%rax
+  803c09:	00 00 00 
+  803c0c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c0e:	85 c0                	test   %eax,%eax
+  803c10:	78 5a                	js     803c6c <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c12:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803c19:	00 00 00 
+  803c1c:	4c 89 e6             	mov    %r12,%rsi
+  803c1f:	48 89 df             	mov    %rbx,%rdi
+  803c22:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803c29:	00 00 00 
+  803c2c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803c2e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803c35:	00 
+  803c36:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c3c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803c43:	00 
+  803c44:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803c4a:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803c51:	00 
+  803c52:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803c59:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803c60:	00 
+  803c61:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803c67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c6c:	5b                   	pop    %rbx
+  803c6d:	41 5c                	pop    %r12
+  803c6f:	5d                   	pop    %rbp
+  803c70:	c3                   	ret
+
+0000000000803c71 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c71:	55                   	push   %rbp
+  803c72:	48 89 e5             	mov    %rsp,%rbp
+  803c75:	41 57                	push   %r15
+  803c77:	41 56                	push   %r14
+  803c79:	41 55                	push   %r13
+  803c7b:	41 54                	push   %r12
+  803c7d:	53                   	push   %rbx
+  803c7e:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803c82:	48 85 ff             	test   %rdi,%rdi
+  803c85:	0f 84 a1 00 00 00    	je     803d2c <devfile_read+0xbb>
+  803c8b:	49 89 ff             	mov    %rdi,%r15
+  803c8e:	49 89 f5             	mov    %rsi,%r13
+  803c91:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803c94:	48 85 f6             	test   %rsi,%rsi
+  803c97:	0f 84 c4 00 00 00    	je     803d61 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803c9d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803ca4:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803ca5:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803cac:	00 00 00 
+  803caf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803cb3:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803cb6:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803cba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cbf:	be 00 00 00 00       	mov    $0x0,%esi
+  803cc4:	bf 03 00 00 00       	mov    $0x3,%edi
+  803cc9:	48 b8 85 3b 80 00 00 	movabs $0x803b85,%rax
+  803cd0:	00 00 00 
+  803cd3:	ff d0                	call   *%rax
+        if (res < 0) {
+  803cd5:	85 c0                	test   %eax,%eax
+  803cd7:	0f 88 b9 00 00 00    	js     803d96 <devfile_read+0x125>
+        assert(res <= n);
+  803cdd:	48 63 d8             	movslq %eax,%rbx
+  803ce0:	49 39 dc             	cmp    %rbx,%r12
+  803ce3:	0f 82 b1 00 00 00    	jb     803d9a <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803ce9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803cee:	0f 87 db 00 00 00    	ja     803dcf <devfile_read+0x15e>
+        if (!res) {
+  803cf4:	85 c0                	test   %eax,%eax
+  803cf6:	74 21                	je     803d19 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803cf8:	48 89 da             	mov    %rbx,%rdx
+  803cfb:	4c 89 f6             	mov    %r14,%rsi
+  803cfe:	4c 89 ef             	mov    %r13,%rdi
+  803d01:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  803d08:	00 00 00 
+  803d0b:	ff d0                	call   *%rax
+        total_read += res;
+  803d0d:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803d11:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803d14:	49 29 dc             	sub    %rbx,%r12
+  803d17:	75 96                	jne    803caf <devfile_read+0x3e>
+    return total_read;
+  803d19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803d1d:	48 83 c4 18          	add    $0x18,%rsp
+  803d21:	5b                   	pop    %rbx
+  803d22:	41 5c                	pop    %r12
+  803d24:	41 5d                	pop    %r13
+  803d26:	41 5e                	pop    %r14
+  803d28:	41 5f                	pop    %r15
+  803d2a:	5d                   	pop    %rbp
+  803d2b:	c3                   	ret
+    assert(fd);
+  803d2c:	48 b9 56 66 80 00 00 	movabs $0x806656,%rcx
+  803d33:	00 00 00 
+  803d36:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  803d3d:	00 00 00 
+  803d40:	be 91 00 00 00       	mov    $0x91,%esi
+  803d45:	48 bf 4b 66 80 00 00 	movabs $0x80664b,%rdi
+  803d4c:	00 00 00 
+  803d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d54:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803d5b:	00 00 00 
+  803d5e:	41 ff d0             	call   *%r8
+    assert(buf);
+  803d61:	48 b9 59 66 80 00 00 	movabs $0x806659,%rcx
+  803d68:	00 00 00 
+  803d6b:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  803d72:	00 00 00 
+  803d75:	be 92 00 00 00       	mov    $0x92,%esi
+  803d7a:	48 bf 4b 66 80 00 00 	movabs $0x80664b,%rdi
+  803d81:	00 00 00 
+  803d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d89:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803d90:	00 00 00 
+  803d93:	41 ff d0             	call   *%r8
+            return res;
+  803d96:	48 98                	cltq
+  803d98:	eb 83                	jmp    803d1d <devfile_read+0xac>
+        assert(res <= n);
+  803d9a:	48 b9 5d 66 80 00 00 	movabs $0x80665d,%rcx
+  803da1:	00 00 00 
+  803da4:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  803dab:	00 00 00 
+  803dae:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803db3:	48 bf 4b 66 80 00 00 	movabs $0x80664b,%rdi
+  803dba:	00 00 00 
+  803dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc2:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803dc9:	00 00 00 
+  803dcc:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803dcf:	48 b9 68 66 80 00 00 	movabs $0x806668,%rcx
+  803dd6:	00 00 00 
+  803dd9:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  803de0:	00 00 00 
+  803de3:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803de8:	48 bf 4b 66 80 00 00 	movabs $0x80664b,%rdi
+  803def:	00 00 00 
+  803df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df7:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803dfe:	00 00 00 
+  803e01:	41 ff d0             	call   *%r8
+
+0000000000803e04 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803e04:	55                   	push   %rbp
+  803e05:	48 89 e5             	mov    %rsp,%rbp
+  803e08:	41 57                	push   %r15
+  803e0a:	41 56                	push   %r14
+  803e0c:	41 55                	push   %r13
+  803e0e:	41 54                	push   %r12
+  803e10:	53                   	push   %rbx
+  803e11:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803e15:	48 85 ff             	test   %rdi,%rdi
+  803e18:	0f 84 83 00 00 00    	je     803ea1 <devfile_write+0x9d>
+  803e1e:	49 89 ff             	mov    %rdi,%r15
+  803e21:	49 89 f4             	mov    %rsi,%r12
+  803e24:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803e27:	48 85 f6             	test   %rsi,%rsi
+  803e2a:	0f 84 a6 00 00 00    	je     803ed6 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803e30:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803e36:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803e3d:	00 00 00 
+  803e40:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e44:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803e47:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803e4b:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803e50:	48 39 d3             	cmp    %rdx,%rbx
+  803e53:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803e57:	4c 89 e6             	mov    %r12,%rsi
+  803e5a:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803e61:	00 00 00 
+  803e64:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  803e6b:	00 00 00 
+  803e6e:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e75:	be 00 00 00 00       	mov    $0x0,%esi
+  803e7a:	bf 04 00 00 00       	mov    $0x4,%edi
+  803e7f:	48 b8 85 3b 80 00 00 	movabs $0x803b85,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e8b:	85 c0                	test   %eax,%eax
+  803e8d:	78 7c                	js     803f0b <devfile_write+0x107>
+        total_written += res;
+  803e8f:	48 98                	cltq
+  803e91:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803e94:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e97:	48 29 c3             	sub    %rax,%rbx
+  803e9a:	75 a4                	jne    803e40 <devfile_write+0x3c>
+    return total_written;
+  803e9c:	4c 89 e8             	mov    %r13,%rax
+  803e9f:	eb 6c                	jmp    803f0d <devfile_write+0x109>
+    assert(fd);
+  803ea1:	48 b9 56 66 80 00 00 	movabs $0x806656,%rcx
+  803ea8:	00 00 00 
+  803eab:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  803eb2:	00 00 00 
+  803eb5:	be bd 00 00 00       	mov    $0xbd,%esi
+  803eba:	48 bf 4b 66 80 00 00 	movabs $0x80664b,%rdi
+  803ec1:	00 00 00 
+  803ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec9:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803ed0:	00 00 00 
+  803ed3:	41 ff d0             	call   *%r8
+    assert(buf);
+  803ed6:	48 b9 59 66 80 00 00 	movabs $0x806659,%rcx
+  803edd:	00 00 00 
+  803ee0:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  803ee7:	00 00 00 
+  803eea:	be be 00 00 00       	mov    $0xbe,%esi
+  803eef:	48 bf 4b 66 80 00 00 	movabs $0x80664b,%rdi
+  803ef6:	00 00 00 
+  803ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efe:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  803f05:	00 00 00 
+  803f08:	41 ff d0             	call   *%r8
+            return res;
+  803f0b:	48 98                	cltq
+}
+  803f0d:	48 83 c4 08          	add    $0x8,%rsp
+  803f11:	5b                   	pop    %rbx
+  803f12:	41 5c                	pop    %r12
+  803f14:	41 5d                	pop    %r13
+  803f16:	41 5e                	pop    %r14
+  803f18:	41 5f                	pop    %r15
+  803f1a:	5d                   	pop    %rbp
+  803f1b:	c3                   	ret
+
+0000000000803f1c <open>:
+open(const char *path, int mode) {
+  803f1c:	55                   	push   %rbp
+  803f1d:	48 89 e5             	mov    %rsp,%rbp
+  803f20:	41 55                	push   %r13
+  803f22:	41 54                	push   %r12
+  803f24:	53                   	push   %rbx
+  803f25:	48 83 ec 18          	sub    $0x18,%rsp
+  803f29:	49 89 fc             	mov    %rdi,%r12
+  803f2c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f2f:	48 b8 de 20 80 00 00 	movabs $0x8020de,%rax
+  803f36:	00 00 00 
+  803f39:	ff d0                	call   *%rax
+  803f3b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f41:	0f 87 8f 00 00 00    	ja     803fd6 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f47:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f4b:	48 b8 41 33 80 00 00 	movabs $0x803341,%rax
+  803f52:	00 00 00 
+  803f55:	ff d0                	call   *%rax
+  803f57:	89 c3                	mov    %eax,%ebx
+  803f59:	85 c0                	test   %eax,%eax
+  803f5b:	78 55                	js     803fb2 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f5d:	4c 89 e6             	mov    %r12,%rsi
+  803f60:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803f67:	00 00 00 
+  803f6a:	48 89 df             	mov    %rbx,%rdi
+  803f6d:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803f74:	00 00 00 
+  803f77:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f79:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f85:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f89:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f8e:	48 b8 85 3b 80 00 00 	movabs $0x803b85,%rax
+  803f95:	00 00 00 
+  803f98:	ff d0                	call   *%rax
+  803f9a:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f9c:	85 c0                	test   %eax,%eax
+  803f9e:	78 1f                	js     803fbf <open+0xa3>
+    return fd2num(fd);
+  803fa0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fa4:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  803fab:	00 00 00 
+  803fae:	ff d0                	call   *%rax
+  803fb0:	89 c3                	mov    %eax,%ebx
+}
+  803fb2:	89 d8                	mov    %ebx,%eax
+  803fb4:	48 83 c4 18          	add    $0x18,%rsp
+  803fb8:	5b                   	pop    %rbx
+  803fb9:	41 5c                	pop    %r12
+  803fbb:	41 5d                	pop    %r13
+  803fbd:	5d                   	pop    %rbp
+  803fbe:	c3                   	ret
+        fd_close(fd, 0);
+  803fbf:	be 00 00 00 00       	mov    $0x0,%esi
+  803fc4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fc8:	48 b8 5c 34 80 00 00 	movabs $0x80345c,%rax
+  803fcf:	00 00 00 
+  803fd2:	ff d0                	call   *%rax
+        return res;
+  803fd4:	eb dc                	jmp    803fb2 <open+0x96>
+        return -E_BAD_PATH;
+  803fd6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803fdb:	eb d5                	jmp    803fb2 <open+0x96>
+
+0000000000803fdd <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803fdd:	55                   	push   %rbp
+  803fde:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fe6:	be 00 00 00 00       	mov    $0x0,%esi
+  803feb:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ff0:	48 b8 8a 3a 80 00 00 	movabs $0x803a8a,%rax
+  803ff7:	00 00 00 
+  803ffa:	ff d0                	call   *%rax
+}
+  803ffc:	5d                   	pop    %rbp
+  803ffd:	c3                   	ret
+
+0000000000803ffe <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803ffe:	55                   	push   %rbp
+  803fff:	48 89 e5             	mov    %rsp,%rbp
+  804002:	41 56                	push   %r14
+  804004:	41 55                	push   %r13
+  804006:	41 54                	push   %r12
+  804008:	53                   	push   %rbx
+  804009:	48 83 ec 10          	sub    $0x10,%rsp
+  80400d:	41 89 f6             	mov    %esi,%r14d
+  804010:	49 89 d4             	mov    %rdx,%r12
+  804013:	48 89 cb             	mov    %rcx,%rbx
+  804016:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804019:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80401d:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  804024:	00 00 00 
+  804027:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804029:	85 c0                	test   %eax,%eax
+  80402b:	78 46                	js     804073 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80402d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804031:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  804038:	00 00 00 
+  80403b:	8b 00                	mov    (%rax),%eax
+  80403d:	39 02                	cmp    %eax,(%rdx)
+  80403f:	75 3f                	jne    804080 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804041:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  804048:	00 00 00 
+  80404b:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80404e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804050:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  804054:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804058:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  80405c:	48 89 da             	mov    %rbx,%rdx
+  80405f:	4c 89 e6             	mov    %r12,%rsi
+  804062:	bf 09 00 00 00       	mov    $0x9,%edi
+  804067:	48 b8 85 3b 80 00 00 	movabs $0x803b85,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+}
+  804073:	48 83 c4 10          	add    $0x10,%rsp
+  804077:	5b                   	pop    %rbx
+  804078:	41 5c                	pop    %r12
+  80407a:	41 5d                	pop    %r13
+  80407c:	41 5e                	pop    %r14
+  80407e:	5d                   	pop    %rbp
+  80407f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804080:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804085:	eb ec                	jmp    804073 <file_map+0x75>
+
+0000000000804087 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804087:	55                   	push   %rbp
+  804088:	48 89 e5             	mov    %rsp,%rbp
+  80408b:	41 54                	push   %r12
+  80408d:	53                   	push   %rbx
+  80408e:	48 83 ec 20          	sub    $0x20,%rsp
+  804092:	41 89 f4             	mov    %esi,%r12d
+  804095:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804098:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80409c:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  8040a3:	00 00 00 
+  8040a6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040a8:	85 c0                	test   %eax,%eax
+  8040aa:	78 3c                	js     8040e8 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040b0:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8040b7:	00 00 00 
+  8040ba:	8b 0a                	mov    (%rdx),%ecx
+  8040bc:	39 08                	cmp    %ecx,(%rax)
+  8040be:	75 31                	jne    8040f1 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  8040c0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040c3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8040c6:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8040ca:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8040ce:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040d3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8040dc:	48 b8 8a 3a 80 00 00 	movabs $0x803a8a,%rax
+  8040e3:	00 00 00 
+  8040e6:	ff d0                	call   *%rax
+}
+  8040e8:	48 83 c4 20          	add    $0x20,%rsp
+  8040ec:	5b                   	pop    %rbx
+  8040ed:	41 5c                	pop    %r12
+  8040ef:	5d                   	pop    %rbp
+  8040f0:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040f1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8040f6:	eb f0                	jmp    8040e8 <file_msync+0x61>
+
+00000000008040f8 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8040f8:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8040fc:	7f 01                	jg     8040ff <writebuf+0x7>
+  8040fe:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8040ff:	55                   	push   %rbp
+  804100:	48 89 e5             	mov    %rsp,%rbp
+  804103:	53                   	push   %rbx
+  804104:	48 83 ec 08          	sub    $0x8,%rsp
+  804108:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80410b:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80410f:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804113:	8b 3f                	mov    (%rdi),%edi
+  804115:	48 b8 b3 37 80 00 00 	movabs $0x8037b3,%rax
+  80411c:	00 00 00 
+  80411f:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804121:	48 85 c0             	test   %rax,%rax
+  804124:	7e 04                	jle    80412a <writebuf+0x32>
+  804126:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80412a:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80412e:	48 39 c2             	cmp    %rax,%rdx
+  804131:	74 0f                	je     804142 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804133:	48 85 c0             	test   %rax,%rax
+  804136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80413b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80413f:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804142:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804146:	c9                   	leave
+  804147:	c3                   	ret
+
+0000000000804148 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804148:	8b 46 04             	mov    0x4(%rsi),%eax
+  80414b:	8d 50 01             	lea    0x1(%rax),%edx
+  80414e:	89 56 04             	mov    %edx,0x4(%rsi)
+  804151:	48 98                	cltq
+  804153:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804158:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80415e:	74 01                	je     804161 <putch+0x19>
+  804160:	c3                   	ret
+putch(int ch, void *arg) {
+  804161:	55                   	push   %rbp
+  804162:	48 89 e5             	mov    %rsp,%rbp
+  804165:	53                   	push   %rbx
+  804166:	48 83 ec 08          	sub    $0x8,%rsp
+  80416a:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80416d:	48 89 f7             	mov    %rsi,%rdi
+  804170:	48 b8 f8 40 80 00 00 	movabs $0x8040f8,%rax
+  804177:	00 00 00 
+  80417a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80417c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804187:	c9                   	leave
+  804188:	c3                   	ret
+
+0000000000804189 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804189:	55                   	push   %rbp
+  80418a:	48 89 e5             	mov    %rsp,%rbp
+  80418d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804194:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804197:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80419d:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8041a4:	00 00 00 
+    state.result = 0;
+  8041a7:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8041ae:	00 00 00 00 
+    state.error = 1;
+  8041b2:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8041b9:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8041bc:	48 89 f2             	mov    %rsi,%rdx
+  8041bf:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8041c6:	48 bf 48 41 80 00 00 	movabs $0x804148,%rdi
+  8041cd:	00 00 00 
+  8041d0:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  8041d7:	00 00 00 
+  8041da:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8041dc:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8041e3:	7f 14                	jg     8041f9 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8041e5:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8041ec:	48 85 c0             	test   %rax,%rax
+  8041ef:	75 06                	jne    8041f7 <vfprintf+0x6e>
+  8041f1:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8041f7:	c9                   	leave
+  8041f8:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8041f9:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804200:	48 b8 f8 40 80 00 00 	movabs $0x8040f8,%rax
+  804207:	00 00 00 
+  80420a:	ff d0                	call   *%rax
+  80420c:	eb d7                	jmp    8041e5 <vfprintf+0x5c>
+
+000000000080420e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80420e:	55                   	push   %rbp
+  80420f:	48 89 e5             	mov    %rsp,%rbp
+  804212:	48 83 ec 50          	sub    $0x50,%rsp
+  804216:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80421a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80421e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804222:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804226:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80422d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804231:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804235:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804239:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80423d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804241:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  804248:	00 00 00 
+  80424b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80424d:	c9                   	leave
+  80424e:	c3                   	ret
+
+000000000080424f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80424f:	55                   	push   %rbp
+  804250:	48 89 e5             	mov    %rsp,%rbp
+  804253:	48 83 ec 50          	sub    $0x50,%rsp
+  804257:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80425b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80425f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804263:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804267:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80426b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804272:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804276:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80427a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80427e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804282:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804286:	48 89 fe             	mov    %rdi,%rsi
+  804289:	bf 01 00 00 00       	mov    $0x1,%edi
+  80428e:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  804295:	00 00 00 
+  804298:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80429a:	c9                   	leave
+  80429b:	c3                   	ret
+
+000000000080429c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80429c:	55                   	push   %rbp
+  80429d:	48 89 e5             	mov    %rsp,%rbp
+  8042a0:	41 54                	push   %r12
+  8042a2:	53                   	push   %rbx
+  8042a3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042a6:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  8042ad:	00 00 00 
+  8042b0:	ff d0                	call   *%rax
+  8042b2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8042b5:	48 be 90 66 80 00 00 	movabs $0x806690,%rsi
+  8042bc:	00 00 00 
+  8042bf:	48 89 df             	mov    %rbx,%rdi
+  8042c2:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  8042c9:	00 00 00 
+  8042cc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8042ce:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8042d3:	41 2b 04 24          	sub    (%r12),%eax
+  8042d7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8042dd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8042e4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8042e7:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8042ee:	00 00 00 
+  8042f1:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8042f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042fd:	5b                   	pop    %rbx
+  8042fe:	41 5c                	pop    %r12
+  804300:	5d                   	pop    %rbp
+  804301:	c3                   	ret
+
+0000000000804302 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804302:	55                   	push   %rbp
+  804303:	48 89 e5             	mov    %rsp,%rbp
+  804306:	41 54                	push   %r12
+  804308:	53                   	push   %rbx
+  804309:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80430c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804311:	48 89 fe             	mov    %rdi,%rsi
+  804314:	bf 00 00 00 00       	mov    $0x0,%edi
+  804319:	49 bc 59 29 80 00 00 	movabs $0x802959,%r12
+  804320:	00 00 00 
+  804323:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804326:	48 89 df             	mov    %rbx,%rdi
+  804329:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  804330:	00 00 00 
+  804333:	ff d0                	call   *%rax
+  804335:	48 89 c6             	mov    %rax,%rsi
+  804338:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80433d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804342:	41 ff d4             	call   *%r12
+}
+  804345:	5b                   	pop    %rbx
+  804346:	41 5c                	pop    %r12
+  804348:	5d                   	pop    %rbp
+  804349:	c3                   	ret
+
+000000000080434a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80434a:	55                   	push   %rbp
+  80434b:	48 89 e5             	mov    %rsp,%rbp
+  80434e:	41 57                	push   %r15
+  804350:	41 56                	push   %r14
+  804352:	41 55                	push   %r13
+  804354:	41 54                	push   %r12
+  804356:	53                   	push   %rbx
+  804357:	48 83 ec 18          	sub    $0x18,%rsp
+  80435b:	49 89 fc             	mov    %rdi,%r12
+  80435e:	49 89 f5             	mov    %rsi,%r13
+  804361:	49 89 d7             	mov    %rdx,%r15
+  804364:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804368:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804374:	4d 85 ff             	test   %r15,%r15
+  804377:	0f 84 af 00 00 00    	je     80442c <devpipe_write+0xe2>
+  80437d:	48 89 c3             	mov    %rax,%rbx
+  804380:	4c 89 f8             	mov    %r15,%rax
+  804383:	4d 89 ef             	mov    %r13,%r15
+  804386:	4c 01 e8             	add    %r13,%rax
+  804389:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80438d:	49 bd 4f 28 80 00 00 	movabs $0x80284f,%r13
+  804394:	00 00 00 
+            sys_yield();
+  804397:	49 be e0 27 80 00 00 	movabs $0x8027e0,%r14
+  80439e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043a1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043a4:	48 63 ce             	movslq %esi,%rcx
+  8043a7:	48 63 03             	movslq (%rbx),%rax
+  8043aa:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043b0:	48 39 c1             	cmp    %rax,%rcx
+  8043b3:	72 2e                	jb     8043e3 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043b5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043ba:	48 89 da             	mov    %rbx,%rdx
+  8043bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043c2:	4c 89 e7             	mov    %r12,%rdi
+  8043c5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8043c8:	85 c0                	test   %eax,%eax
+  8043ca:	74 66                	je     804432 <devpipe_write+0xe8>
+            sys_yield();
+  8043cc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043cf:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043d2:	48 63 ce             	movslq %esi,%rcx
+  8043d5:	48 63 03             	movslq (%rbx),%rax
+  8043d8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043de:	48 39 c1             	cmp    %rax,%rcx
+  8043e1:	73 d2                	jae    8043b5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8043e3:	41 0f b6 3f          	movzbl (%r15),%edi
+  8043e7:	48 89 ca             	mov    %rcx,%rdx
+  8043ea:	48 c1 ea 03          	shr    $0x3,%rdx
+  8043ee:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8043f5:	08 10 20 
+  8043f8:	48 f7 e2             	mul    %rdx
+  8043fb:	48 c1 ea 06          	shr    $0x6,%rdx
+  8043ff:	48 89 d0             	mov    %rdx,%rax
+  804402:	48 c1 e0 09          	shl    $0x9,%rax
+  804406:	48 29 d0             	sub    %rdx,%rax
+  804409:	48 c1 e0 03          	shl    $0x3,%rax
+  80440d:	48 29 c1             	sub    %rax,%rcx
+  804410:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804415:	83 c6 01             	add    $0x1,%esi
+  804418:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80441b:	49 83 c7 01          	add    $0x1,%r15
+  80441f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804423:	49 39 c7             	cmp    %rax,%r15
+  804426:	0f 85 75 ff ff ff    	jne    8043a1 <devpipe_write+0x57>
+    return n;
+  80442c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804430:	eb 05                	jmp    804437 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804432:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804437:	48 83 c4 18          	add    $0x18,%rsp
+  80443b:	5b                   	pop    %rbx
+  80443c:	41 5c                	pop    %r12
+  80443e:	41 5d                	pop    %r13
+  804440:	41 5e                	pop    %r14
+  804442:	41 5f                	pop    %r15
+  804444:	5d                   	pop    %rbp
+  804445:	c3                   	ret
+
+0000000000804446 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804446:	55                   	push   %rbp
+  804447:	48 89 e5             	mov    %rsp,%rbp
+  80444a:	41 57                	push   %r15
+  80444c:	41 56                	push   %r14
+  80444e:	41 55                	push   %r13
+  804450:	41 54                	push   %r12
+  804452:	53                   	push   %rbx
+  804453:	48 83 ec 18          	sub    $0x18,%rsp
+  804457:	49 89 fc             	mov    %rdi,%r12
+  80445a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80445e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804462:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  804469:	00 00 00 
+  80446c:	ff d0                	call   *%rax
+  80446e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804471:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804477:	49 bd 4f 28 80 00 00 	movabs $0x80284f,%r13
+  80447e:	00 00 00 
+            sys_yield();
+  804481:	49 be e0 27 80 00 00 	movabs $0x8027e0,%r14
+  804488:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80448b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804490:	74 7d                	je     80450f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804492:	8b 03                	mov    (%rbx),%eax
+  804494:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804497:	75 26                	jne    8044bf <devpipe_read+0x79>
+            if (i > 0) return i;
+  804499:	4d 85 ff             	test   %r15,%r15
+  80449c:	75 77                	jne    804515 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80449e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8044a3:	48 89 da             	mov    %rbx,%rdx
+  8044a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044ab:	4c 89 e7             	mov    %r12,%rdi
+  8044ae:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8044b1:	85 c0                	test   %eax,%eax
+  8044b3:	74 72                	je     804527 <devpipe_read+0xe1>
+            sys_yield();
+  8044b5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8044b8:	8b 03                	mov    (%rbx),%eax
+  8044ba:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8044bd:	74 df                	je     80449e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8044bf:	48 63 c8             	movslq %eax,%rcx
+  8044c2:	48 89 ca             	mov    %rcx,%rdx
+  8044c5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8044c9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8044d0:	08 10 20 
+  8044d3:	48 89 d0             	mov    %rdx,%rax
+  8044d6:	48 f7 e6             	mul    %rsi
+  8044d9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8044dd:	48 89 d0             	mov    %rdx,%rax
+  8044e0:	48 c1 e0 09          	shl    $0x9,%rax
+  8044e4:	48 29 d0             	sub    %rdx,%rax
+  8044e7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8044ee:	00 
+  8044ef:	48 89 c8             	mov    %rcx,%rax
+  8044f2:	48 29 d0             	sub    %rdx,%rax
+  8044f5:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8044fa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8044fe:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804502:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804505:	49 83 c7 01          	add    $0x1,%r15
+  804509:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80450d:	75 83                	jne    804492 <devpipe_read+0x4c>
+    return n;
+  80450f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804513:	eb 03                	jmp    804518 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804515:	4c 89 f8             	mov    %r15,%rax
+}
+  804518:	48 83 c4 18          	add    $0x18,%rsp
+  80451c:	5b                   	pop    %rbx
+  80451d:	41 5c                	pop    %r12
+  80451f:	41 5d                	pop    %r13
+  804521:	41 5e                	pop    %r14
+  804523:	41 5f                	pop    %r15
+  804525:	5d                   	pop    %rbp
+  804526:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80452c:	eb ea                	jmp    804518 <devpipe_read+0xd2>
+
+000000000080452e <pipe>:
+pipe(int pfd[2]) {
+  80452e:	55                   	push   %rbp
+  80452f:	48 89 e5             	mov    %rsp,%rbp
+  804532:	41 55                	push   %r13
+  804534:	41 54                	push   %r12
+  804536:	53                   	push   %rbx
+  804537:	48 83 ec 18          	sub    $0x18,%rsp
+  80453b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80453e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804542:	48 b8 41 33 80 00 00 	movabs $0x803341,%rax
+  804549:	00 00 00 
+  80454c:	ff d0                	call   *%rax
+  80454e:	89 c3                	mov    %eax,%ebx
+  804550:	85 c0                	test   %eax,%eax
+  804552:	0f 88 a0 01 00 00    	js     8046f8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804558:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80455d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804562:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804566:	bf 00 00 00 00       	mov    $0x0,%edi
+  80456b:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  804572:	00 00 00 
+  804575:	ff d0                	call   *%rax
+  804577:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804579:	85 c0                	test   %eax,%eax
+  80457b:	0f 88 77 01 00 00    	js     8046f8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804581:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804585:	48 b8 41 33 80 00 00 	movabs $0x803341,%rax
+  80458c:	00 00 00 
+  80458f:	ff d0                	call   *%rax
+  804591:	89 c3                	mov    %eax,%ebx
+  804593:	85 c0                	test   %eax,%eax
+  804595:	0f 88 43 01 00 00    	js     8046de <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80459b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045a5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8045a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ae:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  8045b5:	00 00 00 
+  8045b8:	ff d0                	call   *%rax
+  8045ba:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8045bc:	85 c0                	test   %eax,%eax
+  8045be:	0f 88 1a 01 00 00    	js     8046de <pipe+0x1b0>
+    va = fd2data(fd0);
+  8045c4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8045c8:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  8045cf:	00 00 00 
+  8045d2:	ff d0                	call   *%rax
+  8045d4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8045d7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045e1:	48 89 c6             	mov    %rax,%rsi
+  8045e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045e9:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  8045f0:	00 00 00 
+  8045f3:	ff d0                	call   *%rax
+  8045f5:	89 c3                	mov    %eax,%ebx
+  8045f7:	85 c0                	test   %eax,%eax
+  8045f9:	0f 88 c5 00 00 00    	js     8046c4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8045ff:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804603:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  80460a:	00 00 00 
+  80460d:	ff d0                	call   *%rax
+  80460f:	48 89 c1             	mov    %rax,%rcx
+  804612:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804618:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80461e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804623:	4c 89 ee             	mov    %r13,%rsi
+  804626:	bf 00 00 00 00       	mov    $0x0,%edi
+  80462b:	48 b8 ee 28 80 00 00 	movabs $0x8028ee,%rax
+  804632:	00 00 00 
+  804635:	ff d0                	call   *%rax
+  804637:	89 c3                	mov    %eax,%ebx
+  804639:	85 c0                	test   %eax,%eax
+  80463b:	78 6e                	js     8046ab <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80463d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804642:	4c 89 ef             	mov    %r13,%rdi
+  804645:	48 b8 17 28 80 00 00 	movabs $0x802817,%rax
+  80464c:	00 00 00 
+  80464f:	ff d0                	call   *%rax
+  804651:	83 f8 02             	cmp    $0x2,%eax
+  804654:	0f 85 ab 00 00 00    	jne    804705 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80465a:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804661:	00 00 
+  804663:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804667:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804669:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80466d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804674:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804678:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80467a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80467e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804685:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804689:	48 bb 13 33 80 00 00 	movabs $0x803313,%rbx
+  804690:	00 00 00 
+  804693:	ff d3                	call   *%rbx
+  804695:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804699:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80469d:	ff d3                	call   *%rbx
+  80469f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8046a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046a9:	eb 4d                	jmp    8046f8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8046ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046b0:	4c 89 ee             	mov    %r13,%rsi
+  8046b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046b8:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  8046bf:	00 00 00 
+  8046c2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8046c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046c9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8046cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046d2:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  8046d9:	00 00 00 
+  8046dc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8046de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046e3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8046e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046ec:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  8046f3:	00 00 00 
+  8046f6:	ff d0                	call   *%rax
+}
+  8046f8:	89 d8                	mov    %ebx,%eax
+  8046fa:	48 83 c4 18          	add    $0x18,%rsp
+  8046fe:	5b                   	pop    %rbx
+  8046ff:	41 5c                	pop    %r12
+  804701:	41 5d                	pop    %r13
+  804703:	5d                   	pop    %rbp
+  804704:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804705:	48 b9 a8 66 80 00 00 	movabs $0x8066a8,%rcx
+  80470c:	00 00 00 
+  80470f:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  804716:	00 00 00 
+  804719:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80471e:	48 bf 97 66 80 00 00 	movabs $0x806697,%rdi
+  804725:	00 00 00 
+  804728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80472d:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  804734:	00 00 00 
+  804737:	41 ff d0             	call   *%r8
+
+000000000080473a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80473a:	55                   	push   %rbp
+  80473b:	48 89 e5             	mov    %rsp,%rbp
+  80473e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804742:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804746:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  80474d:	00 00 00 
+  804750:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804752:	85 c0                	test   %eax,%eax
+  804754:	78 35                	js     80478b <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804756:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80475a:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  804761:	00 00 00 
+  804764:	ff d0                	call   *%rax
+  804766:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804769:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80476e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804773:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804777:	48 b8 4f 28 80 00 00 	movabs $0x80284f,%rax
+  80477e:	00 00 00 
+  804781:	ff d0                	call   *%rax
+  804783:	85 c0                	test   %eax,%eax
+  804785:	0f 94 c0             	sete   %al
+  804788:	0f b6 c0             	movzbl %al,%eax
+}
+  80478b:	c9                   	leave
+  80478c:	c3                   	ret
+
+000000000080478d <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80478d:	48 89 f8             	mov    %rdi,%rax
+  804790:	48 c1 e8 27          	shr    $0x27,%rax
+  804794:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80479b:	01 00 00 
+  80479e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047a2:	f6 c2 01             	test   $0x1,%dl
+  8047a5:	74 6d                	je     804814 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8047a7:	48 89 f8             	mov    %rdi,%rax
+  8047aa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8047ae:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8047b5:	01 00 00 
+  8047b8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047bc:	f6 c2 01             	test   $0x1,%dl
+  8047bf:	74 62                	je     804823 <get_uvpt_entry+0x96>
+  8047c1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8047c8:	01 00 00 
+  8047cb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047cf:	f6 c2 80             	test   $0x80,%dl
+  8047d2:	75 4f                	jne    804823 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8047d4:	48 89 f8             	mov    %rdi,%rax
+  8047d7:	48 c1 e8 15          	shr    $0x15,%rax
+  8047db:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047e2:	01 00 00 
+  8047e5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047e9:	f6 c2 01             	test   $0x1,%dl
+  8047ec:	74 44                	je     804832 <get_uvpt_entry+0xa5>
+  8047ee:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047f5:	01 00 00 
+  8047f8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047fc:	f6 c2 80             	test   $0x80,%dl
+  8047ff:	75 31                	jne    804832 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804801:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804805:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80480c:	01 00 00 
+  80480f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804813:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804814:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80481b:	01 00 00 
+  80481e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804822:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804823:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80482a:	01 00 00 
+  80482d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804831:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804832:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804839:	01 00 00 
+  80483c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804840:	c3                   	ret
+
+0000000000804841 <get_prot>:
+
+int
+get_prot(void *va) {
+  804841:	55                   	push   %rbp
+  804842:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804845:	48 b8 8d 47 80 00 00 	movabs $0x80478d,%rax
+  80484c:	00 00 00 
+  80484f:	ff d0                	call   *%rax
+  804851:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804854:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804859:	89 c1                	mov    %eax,%ecx
+  80485b:	83 c9 04             	or     $0x4,%ecx
+  80485e:	f6 c2 01             	test   $0x1,%dl
+  804861:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804864:	89 c1                	mov    %eax,%ecx
+  804866:	83 c9 02             	or     $0x2,%ecx
+  804869:	f6 c2 02             	test   $0x2,%dl
+  80486c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80486f:	89 c1                	mov    %eax,%ecx
+  804871:	83 c9 01             	or     $0x1,%ecx
+  804874:	48 85 d2             	test   %rdx,%rdx
+  804877:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80487a:	89 c1                	mov    %eax,%ecx
+  80487c:	83 c9 40             	or     $0x40,%ecx
+  80487f:	f6 c6 04             	test   $0x4,%dh
+  804882:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804885:	5d                   	pop    %rbp
+  804886:	c3                   	ret
+
+0000000000804887 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804887:	55                   	push   %rbp
+  804888:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80488b:	48 b8 8d 47 80 00 00 	movabs $0x80478d,%rax
+  804892:	00 00 00 
+  804895:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804897:	48 c1 e8 06          	shr    $0x6,%rax
+  80489b:	83 e0 01             	and    $0x1,%eax
+}
+  80489e:	5d                   	pop    %rbp
+  80489f:	c3                   	ret
+
+00000000008048a0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8048a0:	55                   	push   %rbp
+  8048a1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8048a4:	48 b8 8d 47 80 00 00 	movabs $0x80478d,%rax
+  8048ab:	00 00 00 
+  8048ae:	ff d0                	call   *%rax
+  8048b0:	83 e0 01             	and    $0x1,%eax
+}
+  8048b3:	5d                   	pop    %rbp
+  8048b4:	c3                   	ret
+
+00000000008048b5 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8048b5:	55                   	push   %rbp
+  8048b6:	48 89 e5             	mov    %rsp,%rbp
+  8048b9:	41 57                	push   %r15
+  8048bb:	41 56                	push   %r14
+  8048bd:	41 55                	push   %r13
+  8048bf:	41 54                	push   %r12
+  8048c1:	53                   	push   %rbx
+  8048c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8048c6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8048ca:	48 85 ff             	test   %rdi,%rdi
+  8048cd:	74 1e                	je     8048ed <foreach_shared_region+0x38>
+  8048cf:	49 89 ff             	mov    %rdi,%r15
+  8048d2:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8048d8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8048de:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8048e5:	01 00 00 
+  8048e8:	e9 72 02 00 00       	jmp    804b5f <foreach_shared_region+0x2aa>
+    assert(fun);
+  8048ed:	48 b9 cc 66 80 00 00 	movabs $0x8066cc,%rcx
+  8048f4:	00 00 00 
+  8048f7:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  8048fe:	00 00 00 
+  804901:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804906:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  80490d:	00 00 00 
+  804910:	b8 00 00 00 00       	mov    $0x0,%eax
+  804915:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  80491c:	00 00 00 
+  80491f:	41 ff d0             	call   *%r8
+  804922:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804929:	eb 6c                	jmp    804997 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80492b:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804932:	ff ff ff 
+  804935:	4c 21 e2             	and    %r12,%rdx
+  804938:	48 89 d8             	mov    %rbx,%rax
+  80493b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804940:	48 83 c0 01          	add    $0x1,%rax
+  804944:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804948:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80494f:	00 00 00 
+  804952:	48 21 c8             	and    %rcx,%rax
+  804955:	48 09 d0             	or     %rdx,%rax
+  804958:	49 89 c4             	mov    %rax,%r12
+  80495b:	eb 30                	jmp    80498d <foreach_shared_region+0xd8>
+  80495d:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804964:	ff ff ff 
+  804967:	4c 21 e2             	and    %r12,%rdx
+  80496a:	48 89 d8             	mov    %rbx,%rax
+  80496d:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804972:	48 83 c0 01          	add    $0x1,%rax
+  804976:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80497a:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804981:	00 00 00 
+  804984:	48 21 c8             	and    %rcx,%rax
+  804987:	48 09 d0             	or     %rdx,%rax
+  80498a:	49 89 c4             	mov    %rax,%r12
+  80498d:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804991:	0f 84 99 01 00 00    	je     804b30 <foreach_shared_region+0x27b>
+  804997:	4c 89 e3             	mov    %r12,%rbx
+  80499a:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80499e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8049a5:	01 00 00 
+  8049a8:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8049ac:	a8 01                	test   $0x1,%al
+  8049ae:	0f 84 77 ff ff ff    	je     80492b <foreach_shared_region+0x76>
+  8049b4:	a8 80                	test   $0x80,%al
+  8049b6:	74 19                	je     8049d1 <foreach_shared_region+0x11c>
+  8049b8:	f6 c4 04             	test   $0x4,%ah
+  8049bb:	74 a0                	je     80495d <foreach_shared_region+0xa8>
+  8049bd:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8049c4:	40 
+  8049c5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049c9:	4c 89 e7             	mov    %r12,%rdi
+  8049cc:	41 ff d7             	call   *%r15
+  8049cf:	eb 8c                	jmp    80495d <foreach_shared_region+0xa8>
+  8049d1:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8049d8:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8049dc:	eb 46                	jmp    804a24 <foreach_shared_region+0x16f>
+  8049de:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8049e5:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049eb:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8049ef:	48 c1 e0 15          	shl    $0x15,%rax
+  8049f3:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8049f8:	49 09 c4             	or     %rax,%r12
+  8049fb:	eb 1d                	jmp    804a1a <foreach_shared_region+0x165>
+  8049fd:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a04:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a0a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a0e:	48 c1 e0 15          	shl    $0x15,%rax
+  804a12:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a17:	49 09 c4             	or     %rax,%r12
+  804a1a:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804a1e:	0f 84 d3 00 00 00    	je     804af7 <foreach_shared_region+0x242>
+  804a24:	4c 89 e3             	mov    %r12,%rbx
+  804a27:	48 c1 eb 15          	shr    $0x15,%rbx
+  804a2b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804a32:	01 00 00 
+  804a35:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a39:	a8 01                	test   $0x1,%al
+  804a3b:	74 a1                	je     8049de <foreach_shared_region+0x129>
+  804a3d:	a8 80                	test   $0x80,%al
+  804a3f:	74 19                	je     804a5a <foreach_shared_region+0x1a5>
+  804a41:	f6 c4 04             	test   $0x4,%ah
+  804a44:	74 b7                	je     8049fd <foreach_shared_region+0x148>
+  804a46:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804a4d:	00 
+  804a4e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a52:	4c 89 e7             	mov    %r12,%rdi
+  804a55:	41 ff d7             	call   *%r15
+  804a58:	eb a3                	jmp    8049fd <foreach_shared_region+0x148>
+  804a5a:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804a60:	eb 3b                	jmp    804a9d <foreach_shared_region+0x1e8>
+  804a62:	f6 c4 04             	test   $0x4,%ah
+  804a65:	74 12                	je     804a79 <foreach_shared_region+0x1c4>
+  804a67:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804a6e:	00 
+  804a6f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a73:	4c 89 e7             	mov    %r12,%rdi
+  804a76:	41 ff d7             	call   *%r15
+  804a79:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804a80:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a86:	48 83 c3 01          	add    $0x1,%rbx
+  804a8a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804a8e:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804a94:	49 09 dc             	or     %rbx,%r12
+  804a97:	41 83 ed 01          	sub    $0x1,%r13d
+  804a9b:	74 2f                	je     804acc <foreach_shared_region+0x217>
+  804a9d:	4c 89 e3             	mov    %r12,%rbx
+  804aa0:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804aa4:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804aa8:	a8 01                	test   $0x1,%al
+  804aaa:	75 b6                	jne    804a62 <foreach_shared_region+0x1ad>
+  804aac:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804ab3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804ab9:	48 83 c3 01          	add    $0x1,%rbx
+  804abd:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804ac1:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804ac7:	49 09 dc             	or     %rbx,%r12
+  804aca:	eb cb                	jmp    804a97 <foreach_shared_region+0x1e2>
+  804acc:	4c 89 e0             	mov    %r12,%rax
+  804acf:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804ad5:	49 c1 ec 15          	shr    $0x15,%r12
+  804ad9:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804ae0:	49 83 c4 01          	add    $0x1,%r12
+  804ae4:	49 c1 e4 15          	shl    $0x15,%r12
+  804ae8:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804aef:	49 09 c4             	or     %rax,%r12
+  804af2:	e9 23 ff ff ff       	jmp    804a1a <foreach_shared_region+0x165>
+  804af7:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804afb:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804b02:	ff ff ff 
+  804b05:	4c 21 e0             	and    %r12,%rax
+  804b08:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804b0c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b13:	49 83 c4 01          	add    $0x1,%r12
+  804b17:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804b1b:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804b22:	00 00 00 
+  804b25:	49 21 d4             	and    %rdx,%r12
+  804b28:	49 09 c4             	or     %rax,%r12
+  804b2b:	e9 5d fe ff ff       	jmp    80498d <foreach_shared_region+0xd8>
+  804b30:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804b37:	00 ff ff 
+  804b3a:	4c 21 e0             	and    %r12,%rax
+  804b3d:	49 c1 ec 27          	shr    $0x27,%r12
+  804b41:	49 83 c4 01          	add    $0x1,%r12
+  804b45:	49 c1 e4 27          	shl    $0x27,%r12
+  804b49:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804b50:	ff 00 00 
+  804b53:	49 21 d4             	and    %rdx,%r12
+  804b56:	49 09 c4             	or     %rax,%r12
+  804b59:	41 83 ed 01          	sub    $0x1,%r13d
+  804b5d:	74 48                	je     804ba7 <foreach_shared_region+0x2f2>
+  804b5f:	4c 89 e0             	mov    %r12,%rax
+  804b62:	48 c1 e8 27          	shr    $0x27,%rax
+  804b66:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804b6d:	01 00 00 
+  804b70:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804b74:	f6 c2 01             	test   $0x1,%dl
+  804b77:	0f 85 a5 fd ff ff    	jne    804922 <foreach_shared_region+0x6d>
+  804b7d:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804b84:	00 ff ff 
+  804b87:	4c 21 e2             	and    %r12,%rdx
+  804b8a:	48 83 c0 01          	add    $0x1,%rax
+  804b8e:	48 c1 e0 27          	shl    $0x27,%rax
+  804b92:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804b99:	ff 00 00 
+  804b9c:	48 21 c8             	and    %rcx,%rax
+  804b9f:	48 09 d0             	or     %rdx,%rax
+  804ba2:	49 89 c4             	mov    %rax,%r12
+  804ba5:	eb b2                	jmp    804b59 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804ba7:	4d 85 e4             	test   %r12,%r12
+  804baa:	75 14                	jne    804bc0 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bb1:	48 83 c4 28          	add    $0x28,%rsp
+  804bb5:	5b                   	pop    %rbx
+  804bb6:	41 5c                	pop    %r12
+  804bb8:	41 5d                	pop    %r13
+  804bba:	41 5e                	pop    %r14
+  804bbc:	41 5f                	pop    %r15
+  804bbe:	5d                   	pop    %rbp
+  804bbf:	c3                   	ret
+    assert(addr == 0);
+  804bc0:	48 b9 db 66 80 00 00 	movabs $0x8066db,%rcx
+  804bc7:	00 00 00 
+  804bca:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  804bd1:	00 00 00 
+  804bd4:	be 67 00 00 00       	mov    $0x67,%esi
+  804bd9:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  804be0:	00 00 00 
+  804be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804be8:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  804bef:	00 00 00 
+  804bf2:	41 ff d0             	call   *%r8
+
+0000000000804bf5 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804bf5:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804bfc:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804bff:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804c05:	eb 33                	jmp    804c3a <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c07:	48 83 c0 20          	add    $0x20,%rax
+  804c0b:	4c 39 c0             	cmp    %r8,%rax
+  804c0e:	74 25                	je     804c35 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804c10:	48 8b 10             	mov    (%rax),%rdx
+  804c13:	48 85 d2             	test   %rdx,%rdx
+  804c16:	74 ef                	je     804c07 <mmap_place+0x12>
+  804c18:	48 89 d1             	mov    %rdx,%rcx
+  804c1b:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c1f:	48 39 cf             	cmp    %rcx,%rdi
+  804c22:	73 e3                	jae    804c07 <mmap_place+0x12>
+  804c24:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804c28:	4c 39 ca             	cmp    %r9,%rdx
+  804c2b:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804c2f:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804c33:	eb d2                	jmp    804c07 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804c35:	45 84 d2             	test   %r10b,%r10b
+  804c38:	74 12                	je     804c4c <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c3a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c41:	00 00 00 
+        moved = 0;
+  804c44:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804c4a:	eb c4                	jmp    804c10 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804c4c:	48 01 fe             	add    %rdi,%rsi
+  804c4f:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804c56:	00 00 00 
+  804c59:	48 39 f0             	cmp    %rsi,%rax
+  804c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c61:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804c65:	c3                   	ret
+
+0000000000804c66 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804c66:	55                   	push   %rbp
+  804c67:	48 89 e5             	mov    %rsp,%rbp
+  804c6a:	41 57                	push   %r15
+  804c6c:	41 56                	push   %r14
+  804c6e:	41 55                	push   %r13
+  804c70:	41 54                	push   %r12
+  804c72:	53                   	push   %rbx
+  804c73:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804c77:	48 8b 1f             	mov    (%rdi),%rbx
+  804c7a:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c81:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c88:	00 00 00 
+  804c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c90:	eb 12                	jmp    804ca4 <mmap_pgfault+0x3e>
+  804c92:	48 83 c2 01          	add    $0x1,%rdx
+  804c96:	48 83 c0 20          	add    $0x20,%rax
+  804c9a:	48 83 fa 20          	cmp    $0x20,%rdx
+  804c9e:	0f 84 04 01 00 00    	je     804da8 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804ca4:	48 8b 08             	mov    (%rax),%rcx
+  804ca7:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804cab:	48 39 de             	cmp    %rbx,%rsi
+  804cae:	73 e2                	jae    804c92 <mmap_pgfault+0x2c>
+  804cb0:	48 03 48 08          	add    0x8(%rax),%rcx
+  804cb4:	48 39 cb             	cmp    %rcx,%rbx
+  804cb7:	73 d9                	jae    804c92 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804cb9:	48 c1 e2 05          	shl    $0x5,%rdx
+  804cbd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cc4:	00 00 00 
+  804cc7:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804ccb:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804ccf:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804cd3:	f6 c2 01             	test   $0x1,%dl
+  804cd6:	0f 84 e0 00 00 00    	je     804dbc <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ce1:	f6 c2 02             	test   $0x2,%dl
+  804ce4:	0f 84 c3 00 00 00    	je     804dad <mmap_pgfault+0x147>
+  804cea:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804cf1:	ff ff ff 
+  804cf4:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804cf8:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804cff:	00 00 00 
+  804d02:	48 39 ca             	cmp    %rcx,%rdx
+  804d05:	0f 85 a2 00 00 00    	jne    804dad <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804d0b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804d10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d15:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804d1c:	00 00 00 
+  804d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d24:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  804d2b:	00 00 00 
+  804d2e:	ff d0                	call   *%rax
+  804d30:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d37:	85 d2                	test   %edx,%edx
+  804d39:	78 72                	js     804dad <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804d3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d40:	48 89 de             	mov    %rbx,%rsi
+  804d43:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804d4a:	00 00 00 
+  804d4d:	4c 89 e7             	mov    %r12,%rdi
+  804d50:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  804d57:	00 00 00 
+  804d5a:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804d5c:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804d62:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804d68:	48 89 d9             	mov    %rbx,%rcx
+  804d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d70:	4c 89 e6             	mov    %r12,%rsi
+  804d73:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d78:	48 b8 ee 28 80 00 00 	movabs $0x8028ee,%rax
+  804d7f:	00 00 00 
+  804d82:	ff d0                	call   *%rax
+  804d84:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804d86:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d8b:	4c 89 e6             	mov    %r12,%rsi
+  804d8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d93:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  804d9a:	00 00 00 
+  804d9d:	ff d0                	call   *%rax
+    return res >= 0;
+  804d9f:	89 d8                	mov    %ebx,%eax
+  804da1:	f7 d0                	not    %eax
+  804da3:	c1 e8 1f             	shr    $0x1f,%eax
+  804da6:	eb 05                	jmp    804dad <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804da8:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804dad:	48 83 c4 18          	add    $0x18,%rsp
+  804db1:	5b                   	pop    %rbx
+  804db2:	41 5c                	pop    %r12
+  804db4:	41 5d                	pop    %r13
+  804db6:	41 5e                	pop    %r14
+  804db8:	41 5f                	pop    %r15
+  804dba:	5d                   	pop    %rbp
+  804dbb:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804dbc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dc0:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804dc4:	4c 03 30             	add    (%rax),%r14
+  804dc7:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804dce:	49 39 c6             	cmp    %rax,%r14
+  804dd1:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804dd5:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804ddc:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804de2:	49 bf a0 48 80 00 00 	movabs $0x8048a0,%r15
+  804de9:	00 00 00 
+  804dec:	4d 39 f4             	cmp    %r14,%r12
+  804def:	73 1d                	jae    804e0e <mmap_pgfault+0x1a8>
+  804df1:	4c 89 e7             	mov    %r12,%rdi
+  804df4:	41 ff d7             	call   *%r15
+  804df7:	84 c0                	test   %al,%al
+  804df9:	75 13                	jne    804e0e <mmap_pgfault+0x1a8>
+  804dfb:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804e02:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804e09:	4d 39 f4             	cmp    %r14,%r12
+  804e0c:	72 e3                	jb     804df1 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e0e:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804e14:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e18:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804e1c:	74 2a                	je     804e48 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804e1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e22:	89 de                	mov    %ebx,%esi
+  804e24:	2b 30                	sub    (%rax),%esi
+  804e26:	03 70 1c             	add    0x1c(%rax),%esi
+  804e29:	8b 78 18             	mov    0x18(%rax),%edi
+  804e2c:	4c 89 e9             	mov    %r13,%rcx
+  804e2f:	48 89 da             	mov    %rbx,%rdx
+  804e32:	48 b8 fe 3f 80 00 00 	movabs $0x803ffe,%rax
+  804e39:	00 00 00 
+  804e3c:	ff d0                	call   *%rax
+    return res > 0;
+  804e3e:	85 c0                	test   %eax,%eax
+  804e40:	0f 9f c0             	setg   %al
+  804e43:	e9 65 ff ff ff       	jmp    804dad <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e48:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804e4c:	eb d0                	jmp    804e1e <mmap_pgfault+0x1b8>
+
+0000000000804e4e <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804e4e:	55                   	push   %rbp
+  804e4f:	48 89 e5             	mov    %rsp,%rbp
+  804e52:	41 57                	push   %r15
+  804e54:	41 56                	push   %r14
+  804e56:	41 55                	push   %r13
+  804e58:	41 54                	push   %r12
+  804e5a:	53                   	push   %rbx
+  804e5b:	48 83 ec 28          	sub    $0x28,%rsp
+  804e5f:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804e63:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804e66:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804e6d:	ff ff ff 
+  804e70:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e79:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804e80:	00 00 00 
+  804e83:	48 39 ca             	cmp    %rcx,%rdx
+  804e86:	0f 85 e5 00 00 00    	jne    804f71 <mmap_writeback+0x123>
+  804e8c:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804e8f:	4c 39 ee             	cmp    %r13,%rsi
+  804e92:	0f 83 e8 00 00 00    	jae    804f80 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804e98:	49 be a0 48 80 00 00 	movabs $0x8048a0,%r14
+  804e9f:	00 00 00 
+  804ea2:	49 bf 87 48 80 00 00 	movabs $0x804887,%r15
+  804ea9:	00 00 00 
+  804eac:	eb 10                	jmp    804ebe <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804eae:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804eb5:	4d 39 ec             	cmp    %r13,%r12
+  804eb8:	0f 83 ae 00 00 00    	jae    804f6c <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ebe:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804ec2:	4c 89 e7             	mov    %r12,%rdi
+  804ec5:	41 ff d6             	call   *%r14
+  804ec8:	84 c0                	test   %al,%al
+  804eca:	74 e2                	je     804eae <mmap_writeback+0x60>
+  804ecc:	4c 89 e7             	mov    %r12,%rdi
+  804ecf:	41 ff d7             	call   *%r15
+  804ed2:	84 c0                	test   %al,%al
+  804ed4:	74 d8                	je     804eae <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804ed6:	4c 89 e3             	mov    %r12,%rbx
+  804ed9:	4d 39 ec             	cmp    %r13,%r12
+  804edc:	73 20                	jae    804efe <mmap_writeback+0xb0>
+  804ede:	48 89 df             	mov    %rbx,%rdi
+  804ee1:	41 ff d6             	call   *%r14
+  804ee4:	84 c0                	test   %al,%al
+  804ee6:	74 16                	je     804efe <mmap_writeback+0xb0>
+  804ee8:	48 89 df             	mov    %rbx,%rdi
+  804eeb:	41 ff d7             	call   *%r15
+  804eee:	84 c0                	test   %al,%al
+  804ef0:	74 0c                	je     804efe <mmap_writeback+0xb0>
+  804ef2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804ef9:	4c 39 eb             	cmp    %r13,%rbx
+  804efc:	72 e0                	jb     804ede <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804efe:	48 89 d9             	mov    %rbx,%rcx
+  804f01:	4c 29 e1             	sub    %r12,%rcx
+  804f04:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f08:	44 89 e6             	mov    %r12d,%esi
+  804f0b:	2b 30                	sub    (%rax),%esi
+  804f0d:	49 89 c4             	mov    %rax,%r12
+  804f10:	03 70 1c             	add    0x1c(%rax),%esi
+  804f13:	8b 78 18             	mov    0x18(%rax),%edi
+  804f16:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804f1a:	48 89 ca             	mov    %rcx,%rdx
+  804f1d:	48 b8 87 40 80 00 00 	movabs $0x804087,%rax
+  804f24:	00 00 00 
+  804f27:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804f29:	85 c0                	test   %eax,%eax
+  804f2b:	78 44                	js     804f71 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804f2d:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804f32:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804f35:	41 89 c1             	mov    %eax,%r9d
+  804f38:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804f3f:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804f43:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804f47:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f4c:	48 89 ce             	mov    %rcx,%rsi
+  804f4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f54:	48 b8 ee 28 80 00 00 	movabs $0x8028ee,%rax
+  804f5b:	00 00 00 
+  804f5e:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804f60:	85 c0                	test   %eax,%eax
+  804f62:	78 0d                	js     804f71 <mmap_writeback+0x123>
+  804f64:	49 89 dc             	mov    %rbx,%r12
+  804f67:	e9 49 ff ff ff       	jmp    804eb5 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f71:	48 83 c4 28          	add    $0x28,%rsp
+  804f75:	5b                   	pop    %rbx
+  804f76:	41 5c                	pop    %r12
+  804f78:	41 5d                	pop    %r13
+  804f7a:	41 5e                	pop    %r14
+  804f7c:	41 5f                	pop    %r15
+  804f7e:	5d                   	pop    %rbp
+  804f7f:	c3                   	ret
+    return 0;
+  804f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f85:	eb ea                	jmp    804f71 <mmap_writeback+0x123>
+
+0000000000804f87 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804f87:	55                   	push   %rbp
+  804f88:	48 89 e5             	mov    %rsp,%rbp
+  804f8b:	41 57                	push   %r15
+  804f8d:	41 56                	push   %r14
+  804f8f:	41 55                	push   %r13
+  804f91:	41 54                	push   %r12
+  804f93:	53                   	push   %rbx
+  804f94:	48 83 ec 38          	sub    $0x38,%rsp
+  804f98:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f9c:	48 85 f6             	test   %rsi,%rsi
+  804f9f:	0f 84 0c 02 00 00    	je     8051b1 <mmap+0x22a>
+  804fa5:	49 89 ff             	mov    %rdi,%r15
+  804fa8:	49 89 f4             	mov    %rsi,%r12
+  804fab:	41 89 d5             	mov    %edx,%r13d
+  804fae:	41 89 ce             	mov    %ecx,%r14d
+  804fb1:	44 89 cb             	mov    %r9d,%ebx
+  804fb4:	45 85 c9             	test   %r9d,%r9d
+  804fb7:	0f 88 f4 01 00 00    	js     8051b1 <mmap+0x22a>
+  804fbd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fc4:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804fcb:	0f 85 e7 01 00 00    	jne    8051b8 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804fd1:	83 e2 fd             	and    $0xfffffffd,%edx
+  804fd4:	83 fa 04             	cmp    $0x4,%edx
+  804fd7:	0f 85 db 01 00 00    	jne    8051b8 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804fdd:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804fe0:	83 fa 01             	cmp    $0x1,%edx
+  804fe3:	0f 87 cf 01 00 00    	ja     8051b8 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804fe9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804fed:	44 89 c7             	mov    %r8d,%edi
+  804ff0:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  804ff7:	00 00 00 
+  804ffa:	ff d0                	call   *%rax
+  804ffc:	89 c2                	mov    %eax,%edx
+  804ffe:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805005:	85 d2                	test   %edx,%edx
+  805007:	0f 88 ab 01 00 00    	js     8051b8 <mmap+0x231>
+  80500d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805011:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  805018:	00 00 00 
+  80501b:	8b 09                	mov    (%rcx),%ecx
+  80501d:	39 0a                	cmp    %ecx,(%rdx)
+  80501f:	0f 85 93 01 00 00    	jne    8051b8 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805025:	8b 52 08             	mov    0x8(%rdx),%edx
+  805028:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  80502b:	83 fa 01             	cmp    $0x1,%edx
+  80502e:	0f 84 84 01 00 00    	je     8051b8 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805034:	41 83 fe 01          	cmp    $0x1,%r14d
+  805038:	74 42                	je     80507c <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  80503a:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805041:	4c 89 e6             	mov    %r12,%rsi
+  805044:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80504b:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  80504f:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805053:	4d 85 ff             	test   %r15,%r15
+  805056:	74 67                	je     8050bf <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805058:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  80505f:	75 0f                	jne    805070 <mmap+0xe9>
+  805061:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805068:	00 00 00 
+  80506b:	49 39 c7             	cmp    %rax,%r15
+  80506e:	77 1b                	ja     80508b <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805070:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805077:	e9 3c 01 00 00       	jmp    8051b8 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80507c:	41 f6 c5 02          	test   $0x2,%r13b
+  805080:	74 b8                	je     80503a <mmap+0xb3>
+  805082:	85 d2                	test   %edx,%edx
+  805084:	75 b4                	jne    80503a <mmap+0xb3>
+  805086:	e9 2d 01 00 00       	jmp    8051b8 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80508b:	4c 89 ff             	mov    %r15,%rdi
+  80508e:	48 b8 f5 4b 80 00 00 	movabs $0x804bf5,%rax
+  805095:	00 00 00 
+  805098:	ff d0                	call   *%rax
+  80509a:	48 89 c2             	mov    %rax,%rdx
+  80509d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050a4:	49 39 d7             	cmp    %rdx,%r15
+  8050a7:	0f 85 0b 01 00 00    	jne    8051b8 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8050ad:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8050b4:	00 00 00 
+  8050b7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050bd:	eb 44                	jmp    805103 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8050bf:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8050c3:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  8050ca:	00 00 00 
+  8050cd:	48 b8 f5 4b 80 00 00 	movabs $0x804bf5,%rax
+  8050d4:	00 00 00 
+  8050d7:	ff d0                	call   *%rax
+  8050d9:	48 89 c7             	mov    %rax,%rdi
+  8050dc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  8050e0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8050e7:	48 85 ff             	test   %rdi,%rdi
+  8050ea:	75 c1                	jne    8050ad <mmap+0x126>
+  8050ec:	e9 c7 00 00 00       	jmp    8051b8 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8050f1:	49 83 c4 01          	add    $0x1,%r12
+  8050f5:	48 83 c0 20          	add    $0x20,%rax
+  8050f9:	49 83 fc 20          	cmp    $0x20,%r12
+  8050fd:	0f 84 a5 00 00 00    	je     8051a8 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805103:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805107:	75 e8                	jne    8050f1 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805109:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80510d:	48 b8 41 33 80 00 00 	movabs $0x803341,%rax
+  805114:	00 00 00 
+  805117:	ff d0                	call   *%rax
+  805119:	89 c2                	mov    %eax,%edx
+  80511b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805122:	85 d2                	test   %edx,%edx
+  805124:	0f 88 8e 00 00 00    	js     8051b8 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  80512a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80512e:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  805135:	00 00 00 
+  805138:	ff d0                	call   *%rax
+  80513a:	89 c6                	mov    %eax,%esi
+  80513c:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80513f:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  805146:	00 00 00 
+  805149:	ff d0                	call   *%rax
+  80514b:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  80514e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805155:	45 85 ff             	test   %r15d,%r15d
+  805158:	78 5e                	js     8051b8 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80515a:	49 c1 e4 05          	shl    $0x5,%r12
+  80515e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805165:	00 00 00 
+  805168:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  80516b:	48 bf 66 4c 80 00 00 	movabs $0x804c66,%rdi
+  805172:	00 00 00 
+  805175:	48 b8 34 57 80 00 00 	movabs $0x805734,%rax
+  80517c:	00 00 00 
+  80517f:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805181:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805185:	49 89 04 24          	mov    %rax,(%r12)
+  805189:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80518d:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805192:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805197:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80519c:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8051a1:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8051a6:	eb 10                	jmp    8051b8 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8051a8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051af:	eb 07                	jmp    8051b8 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8051b1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8051b8:	48 83 c4 38          	add    $0x38,%rsp
+  8051bc:	5b                   	pop    %rbx
+  8051bd:	41 5c                	pop    %r12
+  8051bf:	41 5d                	pop    %r13
+  8051c1:	41 5e                	pop    %r14
+  8051c3:	41 5f                	pop    %r15
+  8051c5:	5d                   	pop    %rbp
+  8051c6:	c3                   	ret
+
+00000000008051c7 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8051c7:	55                   	push   %rbp
+  8051c8:	48 89 e5             	mov    %rsp,%rbp
+  8051cb:	41 57                	push   %r15
+  8051cd:	41 56                	push   %r14
+  8051cf:	41 55                	push   %r13
+  8051d1:	41 54                	push   %r12
+  8051d3:	53                   	push   %rbx
+  8051d4:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8051d8:	49 89 fe             	mov    %rdi,%r14
+  8051db:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8051e2:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8051e9:	00 
+  8051ea:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051f1:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8051f8:	00 00 00 
+  8051fb:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805202:	49 bf 4e 4e 80 00 00 	movabs $0x804e4e,%r15
+  805209:	00 00 00 
+  80520c:	eb 09                	jmp    805217 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80520e:	48 83 c3 20          	add    $0x20,%rbx
+  805212:	4c 39 eb             	cmp    %r13,%rbx
+  805215:	74 33                	je     80524a <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805217:	48 89 df             	mov    %rbx,%rdi
+  80521a:	48 8b 33             	mov    (%rbx),%rsi
+  80521d:	4c 39 e6             	cmp    %r12,%rsi
+  805220:	73 ec                	jae    80520e <msync+0x47>
+  805222:	48 85 f6             	test   %rsi,%rsi
+  805225:	74 e7                	je     80520e <msync+0x47>
+  805227:	48 89 f2             	mov    %rsi,%rdx
+  80522a:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80522e:	49 39 d6             	cmp    %rdx,%r14
+  805231:	73 db                	jae    80520e <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805233:	4c 39 e2             	cmp    %r12,%rdx
+  805236:	49 0f 47 d4          	cmova  %r12,%rdx
+  80523a:	4c 39 f6             	cmp    %r14,%rsi
+  80523d:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805241:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805244:	85 c0                	test   %eax,%eax
+  805246:	79 c6                	jns    80520e <msync+0x47>
+  805248:	eb 05                	jmp    80524f <msync+0x88>
+    }
+
+    return 0;
+  80524a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80524f:	48 83 c4 08          	add    $0x8,%rsp
+  805253:	5b                   	pop    %rbx
+  805254:	41 5c                	pop    %r12
+  805256:	41 5d                	pop    %r13
+  805258:	41 5e                	pop    %r14
+  80525a:	41 5f                	pop    %r15
+  80525c:	5d                   	pop    %rbp
+  80525d:	c3                   	ret
+
+000000000080525e <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  80525e:	55                   	push   %rbp
+  80525f:	48 89 e5             	mov    %rsp,%rbp
+  805262:	41 57                	push   %r15
+  805264:	41 56                	push   %r14
+  805266:	41 55                	push   %r13
+  805268:	41 54                	push   %r12
+  80526a:	53                   	push   %rbx
+  80526b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80526f:	49 89 ff             	mov    %rdi,%r15
+  805272:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805279:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805280:	00 
+  805281:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805288:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80528f:	00 00 00 
+  805292:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805299:	48 89 d8             	mov    %rbx,%rax
+  80529c:	eb 09                	jmp    8052a7 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80529e:	48 83 c0 20          	add    $0x20,%rax
+  8052a2:	4c 39 f0             	cmp    %r14,%rax
+  8052a5:	74 40                	je     8052e7 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052a7:	48 8b 10             	mov    (%rax),%rdx
+  8052aa:	4c 39 e2             	cmp    %r12,%rdx
+  8052ad:	73 ef                	jae    80529e <munmap+0x40>
+  8052af:	48 85 d2             	test   %rdx,%rdx
+  8052b2:	74 ea                	je     80529e <munmap+0x40>
+  8052b4:	48 89 d7             	mov    %rdx,%rdi
+  8052b7:	48 03 78 08          	add    0x8(%rax),%rdi
+  8052bb:	49 39 ff             	cmp    %rdi,%r15
+  8052be:	73 de                	jae    80529e <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8052c0:	49 39 fc             	cmp    %rdi,%r12
+  8052c3:	72 05                	jb     8052ca <munmap+0x6c>
+  8052c5:	4c 39 fa             	cmp    %r15,%rdx
+  8052c8:	73 d4                	jae    80529e <munmap+0x40>
+  8052ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8052cf:	48 83 c4 08          	add    $0x8,%rsp
+  8052d3:	5b                   	pop    %rbx
+  8052d4:	41 5c                	pop    %r12
+  8052d6:	41 5d                	pop    %r13
+  8052d8:	41 5e                	pop    %r14
+  8052da:	41 5f                	pop    %r15
+  8052dc:	5d                   	pop    %rbp
+  8052dd:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052de:	48 83 c3 20          	add    $0x20,%rbx
+  8052e2:	4c 39 f3             	cmp    %r14,%rbx
+  8052e5:	74 5c                	je     805343 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052e7:	48 8b 33             	mov    (%rbx),%rsi
+  8052ea:	4c 39 e6             	cmp    %r12,%rsi
+  8052ed:	73 ef                	jae    8052de <munmap+0x80>
+  8052ef:	48 85 f6             	test   %rsi,%rsi
+  8052f2:	74 ea                	je     8052de <munmap+0x80>
+  8052f4:	48 89 f2             	mov    %rsi,%rdx
+  8052f7:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8052fb:	49 39 d7             	cmp    %rdx,%r15
+  8052fe:	73 de                	jae    8052de <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805300:	48 89 df             	mov    %rbx,%rdi
+  805303:	48 b8 4e 4e 80 00 00 	movabs $0x804e4e,%rax
+  80530a:	00 00 00 
+  80530d:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80530f:	85 c0                	test   %eax,%eax
+  805311:	78 bc                	js     8052cf <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805313:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805317:	48 8b 33             	mov    (%rbx),%rsi
+  80531a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80531f:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  805326:	00 00 00 
+  805329:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80532b:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80532e:	48 b8 06 35 80 00 00 	movabs $0x803506,%rax
+  805335:	00 00 00 
+  805338:	ff d0                	call   *%rax
+        reg->start = 0;
+  80533a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805341:	eb 9b                	jmp    8052de <munmap+0x80>
+    return 0;
+  805343:	b8 00 00 00 00       	mov    $0x0,%eax
+  805348:	eb 85                	jmp    8052cf <munmap+0x71>
+
+000000000080534a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80534a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80534f:	c3                   	ret
+
+0000000000805350 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805350:	55                   	push   %rbp
+  805351:	48 89 e5             	mov    %rsp,%rbp
+  805354:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805357:	48 be e5 66 80 00 00 	movabs $0x8066e5,%rsi
+  80535e:	00 00 00 
+  805361:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  805368:	00 00 00 
+  80536b:	ff d0                	call   *%rax
+    return 0;
+}
+  80536d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805372:	5d                   	pop    %rbp
+  805373:	c3                   	ret
+
+0000000000805374 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805374:	55                   	push   %rbp
+  805375:	48 89 e5             	mov    %rsp,%rbp
+  805378:	41 57                	push   %r15
+  80537a:	41 56                	push   %r14
+  80537c:	41 55                	push   %r13
+  80537e:	41 54                	push   %r12
+  805380:	53                   	push   %rbx
+  805381:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805388:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80538f:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805396:	00 00 00 00 
+  80539a:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8053a1:	00 00 00 00 
+  8053a5:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8053ac:	00 00 00 00 
+  8053b0:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8053b7:	00 00 00 00 
+  8053bb:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8053c2:	00 00 00 00 
+  8053c6:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8053cd:	00 00 00 00 
+  8053d1:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8053d8:	00 
+  8053d9:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8053e0:	00 
+  8053e1:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8053e8:	00 
+  8053e9:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8053f0:	00 
+  8053f1:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8053f8:	00 
+  8053f9:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805400:	00 
+  805401:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805408:	00 
+  805409:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805410:	00 
+  805411:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805418:	00 
+  805419:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805420:	00 
+    for (res = 0; res < n; res += inc) {
+  805421:	48 85 d2             	test   %rdx,%rdx
+  805424:	74 7a                	je     8054a0 <devcons_write+0x12c>
+  805426:	49 89 d6             	mov    %rdx,%r14
+  805429:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80542f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805434:	49 bf 6c 24 80 00 00 	movabs $0x80246c,%r15
+  80543b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80543e:	4c 89 f3             	mov    %r14,%rbx
+  805441:	48 29 f3             	sub    %rsi,%rbx
+  805444:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805449:	48 39 c3             	cmp    %rax,%rbx
+  80544c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805450:	4c 63 eb             	movslq %ebx,%r13
+  805453:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80545a:	48 01 c6             	add    %rax,%rsi
+  80545d:	4c 89 ea             	mov    %r13,%rdx
+  805460:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805467:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80546a:	4c 89 ee             	mov    %r13,%rsi
+  80546d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805474:	48 b8 99 26 80 00 00 	movabs $0x802699,%rax
+  80547b:	00 00 00 
+  80547e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805480:	41 01 dc             	add    %ebx,%r12d
+  805483:	49 63 f4             	movslq %r12d,%rsi
+  805486:	4c 39 f6             	cmp    %r14,%rsi
+  805489:	72 b3                	jb     80543e <devcons_write+0xca>
+    return res;
+  80548b:	49 63 c4             	movslq %r12d,%rax
+}
+  80548e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805495:	5b                   	pop    %rbx
+  805496:	41 5c                	pop    %r12
+  805498:	41 5d                	pop    %r13
+  80549a:	41 5e                	pop    %r14
+  80549c:	41 5f                	pop    %r15
+  80549e:	5d                   	pop    %rbp
+  80549f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8054a0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054a6:	eb e3                	jmp    80548b <devcons_write+0x117>
+
+00000000008054a8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054a8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8054ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054b0:	48 85 c0             	test   %rax,%rax
+  8054b3:	74 55                	je     80550a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054b5:	55                   	push   %rbp
+  8054b6:	48 89 e5             	mov    %rsp,%rbp
+  8054b9:	41 55                	push   %r13
+  8054bb:	41 54                	push   %r12
+  8054bd:	53                   	push   %rbx
+  8054be:	48 83 ec 08          	sub    $0x8,%rsp
+  8054c2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8054c5:	48 bb cc 26 80 00 00 	movabs $0x8026cc,%rbx
+  8054cc:	00 00 00 
+  8054cf:	49 bc e0 27 80 00 00 	movabs $0x8027e0,%r12
+  8054d6:	00 00 00 
+  8054d9:	eb 03                	jmp    8054de <devcons_read+0x36>
+  8054db:	41 ff d4             	call   *%r12
+  8054de:	ff d3                	call   *%rbx
+  8054e0:	85 c0                	test   %eax,%eax
+  8054e2:	74 f7                	je     8054db <devcons_read+0x33>
+    if (c < 0) return c;
+  8054e4:	48 63 d0             	movslq %eax,%rdx
+  8054e7:	78 13                	js     8054fc <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8054e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054ee:	83 f8 04             	cmp    $0x4,%eax
+  8054f1:	74 09                	je     8054fc <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8054f3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8054f7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8054fc:	48 89 d0             	mov    %rdx,%rax
+  8054ff:	48 83 c4 08          	add    $0x8,%rsp
+  805503:	5b                   	pop    %rbx
+  805504:	41 5c                	pop    %r12
+  805506:	41 5d                	pop    %r13
+  805508:	5d                   	pop    %rbp
+  805509:	c3                   	ret
+  80550a:	48 89 d0             	mov    %rdx,%rax
+  80550d:	c3                   	ret
+
+000000000080550e <cputchar>:
+cputchar(int ch) {
+  80550e:	55                   	push   %rbp
+  80550f:	48 89 e5             	mov    %rsp,%rbp
+  805512:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805516:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80551a:	be 01 00 00 00       	mov    $0x1,%esi
+  80551f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805523:	48 b8 99 26 80 00 00 	movabs $0x802699,%rax
+  80552a:	00 00 00 
+  80552d:	ff d0                	call   *%rax
+}
+  80552f:	c9                   	leave
+  805530:	c3                   	ret
+
+0000000000805531 <getchar>:
+getchar(void) {
+  805531:	55                   	push   %rbp
+  805532:	48 89 e5             	mov    %rsp,%rbp
+  805535:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805539:	ba 01 00 00 00       	mov    $0x1,%edx
+  80553e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805542:	bf 00 00 00 00       	mov    $0x0,%edi
+  805547:	48 b8 84 36 80 00 00 	movabs $0x803684,%rax
+  80554e:	00 00 00 
+  805551:	ff d0                	call   *%rax
+  805553:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805555:	85 c0                	test   %eax,%eax
+  805557:	78 06                	js     80555f <getchar+0x2e>
+  805559:	74 08                	je     805563 <getchar+0x32>
+  80555b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80555f:	89 d0                	mov    %edx,%eax
+  805561:	c9                   	leave
+  805562:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805563:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805568:	eb f5                	jmp    80555f <getchar+0x2e>
+
+000000000080556a <iscons>:
+iscons(int fdnum) {
+  80556a:	55                   	push   %rbp
+  80556b:	48 89 e5             	mov    %rsp,%rbp
+  80556e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805572:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805576:	48 b8 a1 33 80 00 00 	movabs $0x8033a1,%rax
+  80557d:	00 00 00 
+  805580:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805582:	85 c0                	test   %eax,%eax
+  805584:	78 18                	js     80559e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805586:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80558a:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805591:	00 00 00 
+  805594:	8b 00                	mov    (%rax),%eax
+  805596:	39 02                	cmp    %eax,(%rdx)
+  805598:	0f 94 c0             	sete   %al
+  80559b:	0f b6 c0             	movzbl %al,%eax
+}
+  80559e:	c9                   	leave
+  80559f:	c3                   	ret
+
+00000000008055a0 <opencons>:
+opencons(void) {
+  8055a0:	55                   	push   %rbp
+  8055a1:	48 89 e5             	mov    %rsp,%rbp
+  8055a4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8055a8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8055ac:	48 b8 41 33 80 00 00 	movabs $0x803341,%rax
+  8055b3:	00 00 00 
+  8055b6:	ff d0                	call   *%rax
+  8055b8:	85 c0                	test   %eax,%eax
+  8055ba:	78 49                	js     805605 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8055bc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8055c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055c6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8055ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055cf:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  8055d6:	00 00 00 
+  8055d9:	ff d0                	call   *%rax
+  8055db:	85 c0                	test   %eax,%eax
+  8055dd:	78 26                	js     805605 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8055df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8055e3:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8055ea:	00 00 
+  8055ec:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8055ee:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8055f2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8055f9:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  805600:	00 00 00 
+  805603:	ff d0                	call   *%rax
+}
+  805605:	c9                   	leave
+  805606:	c3                   	ret
+
+0000000000805607 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805607:	55                   	push   %rbp
+  805608:	48 89 e5             	mov    %rsp,%rbp
+  80560b:	41 56                	push   %r14
+  80560d:	41 55                	push   %r13
+  80560f:	41 54                	push   %r12
+  805611:	53                   	push   %rbx
+  805612:	48 83 ec 50          	sub    $0x50,%rsp
+  805616:	49 89 fc             	mov    %rdi,%r12
+  805619:	41 89 f5             	mov    %esi,%r13d
+  80561c:	48 89 d3             	mov    %rdx,%rbx
+  80561f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805623:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  805627:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80562b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805632:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805636:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80563a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80563e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805642:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  805649:	00 00 00 
+  80564c:	4c 8b 30             	mov    (%rax),%r14
+  80564f:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  805656:	00 00 00 
+  805659:	ff d0                	call   *%rax
+  80565b:	89 c6                	mov    %eax,%esi
+  80565d:	45 89 e8             	mov    %r13d,%r8d
+  805660:	4c 89 e1             	mov    %r12,%rcx
+  805663:	4c 89 f2             	mov    %r14,%rdx
+  805666:	48 bf f8 66 80 00 00 	movabs $0x8066f8,%rdi
+  80566d:	00 00 00 
+  805670:	b8 00 00 00 00       	mov    $0x0,%eax
+  805675:	49 bc e5 17 80 00 00 	movabs $0x8017e5,%r12
+  80567c:	00 00 00 
+  80567f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805682:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805686:	48 89 df             	mov    %rbx,%rdi
+  805689:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  805690:	00 00 00 
+  805693:	ff d0                	call   *%rax
+    cprintf("\n");
+  805695:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  80569c:	00 00 00 
+  80569f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056a4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8056a7:	cc                   	int3
+  8056a8:	eb fd                	jmp    8056a7 <_panic+0xa0>
+
+00000000008056aa <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8056aa:	55                   	push   %rbp
+  8056ab:	48 89 e5             	mov    %rsp,%rbp
+  8056ae:	41 56                	push   %r14
+  8056b0:	41 55                	push   %r13
+  8056b2:	41 54                	push   %r12
+  8056b4:	53                   	push   %rbx
+  8056b5:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056b8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056bf:	00 00 00 
+  8056c2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8056c6:	74 27                	je     8056ef <_handle_vectored_pagefault+0x45>
+  8056c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8056cd:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8056d4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056d7:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8056da:	4c 89 e7             	mov    %r12,%rdi
+  8056dd:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8056e2:	84 c0                	test   %al,%al
+  8056e4:	75 45                	jne    80572b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056e6:	48 83 c3 01          	add    $0x1,%rbx
+  8056ea:	49 3b 1e             	cmp    (%r14),%rbx
+  8056ed:	72 eb                	jb     8056da <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8056ef:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8056f6:	00 
+  8056f7:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8056fc:	4d 8b 04 24          	mov    (%r12),%r8
+  805700:	48 ba 20 67 80 00 00 	movabs $0x806720,%rdx
+  805707:	00 00 00 
+  80570a:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80570f:	48 bf 50 67 80 00 00 	movabs $0x806750,%rdi
+  805716:	00 00 00 
+  805719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80571e:	49 ba 07 56 80 00 00 	movabs $0x805607,%r10
+  805725:	00 00 00 
+  805728:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80572b:	5b                   	pop    %rbx
+  80572c:	41 5c                	pop    %r12
+  80572e:	41 5d                	pop    %r13
+  805730:	41 5e                	pop    %r14
+  805732:	5d                   	pop    %rbp
+  805733:	c3                   	ret
+
+0000000000805734 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805734:	55                   	push   %rbp
+  805735:	48 89 e5             	mov    %rsp,%rbp
+  805738:	53                   	push   %rbx
+  805739:	48 83 ec 08          	sub    $0x8,%rsp
+  80573d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805740:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805745:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80574c:	00 00 00 
+  80574f:	80 38 00             	cmpb   $0x0,(%rax)
+  805752:	74 68                	je     8057bc <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805754:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80575b:	00 00 00 
+  80575e:	48 8b 08             	mov    (%rax),%rcx
+  805761:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805766:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80576d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805770:	48 85 c9             	test   %rcx,%rcx
+  805773:	0f 84 e0 00 00 00    	je     805859 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805779:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80577d:	0f 84 c9 00 00 00    	je     80584c <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805783:	48 83 c2 01          	add    $0x1,%rdx
+  805787:	48 39 ca             	cmp    %rcx,%rdx
+  80578a:	75 ed                	jne    805779 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80578c:	48 83 f9 08          	cmp    $0x8,%rcx
+  805790:	0f 84 84 00 00 00    	je     80581a <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805796:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80579a:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8057a1:	00 00 00 
+  8057a4:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8057ab:	00 00 00 
+  8057ae:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8057b2:	85 f6                	test   %esi,%esi
+  8057b4:	0f 89 97 00 00 00    	jns    805851 <add_pgfault_handler+0x11d>
+  8057ba:	eb 63                	jmp    80581f <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8057bc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8057c1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8057c6:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8057cd:	00 00 00 
+  8057d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057d5:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  8057dc:	00 00 00 
+  8057df:	ff d0                	call   *%rax
+  8057e1:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057e3:	85 c0                	test   %eax,%eax
+  8057e5:	78 38                	js     80581f <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8057e7:	48 be 35 59 80 00 00 	movabs $0x805935,%rsi
+  8057ee:	00 00 00 
+  8057f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057f6:	48 b8 a4 2a 80 00 00 	movabs $0x802aa4,%rax
+  8057fd:	00 00 00 
+  805800:	ff d0                	call   *%rax
+  805802:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805804:	85 c0                	test   %eax,%eax
+  805806:	78 17                	js     80581f <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805808:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80580f:	00 00 00 
+  805812:	c6 00 01             	movb   $0x1,(%rax)
+  805815:	e9 3a ff ff ff       	jmp    805754 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80581a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80581f:	89 f1                	mov    %esi,%ecx
+  805821:	48 ba 5e 67 80 00 00 	movabs $0x80675e,%rdx
+  805828:	00 00 00 
+  80582b:	be 42 00 00 00       	mov    $0x42,%esi
+  805830:	48 bf 50 67 80 00 00 	movabs $0x806750,%rdi
+  805837:	00 00 00 
+  80583a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80583f:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  805846:	00 00 00 
+  805849:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80584c:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805851:	89 f0                	mov    %esi,%eax
+  805853:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805857:	c9                   	leave
+  805858:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805859:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805860:	00 00 00 
+  805863:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80586a:	48 89 d8             	mov    %rbx,%rax
+  80586d:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805874:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805877:	eb d8                	jmp    805851 <add_pgfault_handler+0x11d>
+
+0000000000805879 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805879:	55                   	push   %rbp
+  80587a:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80587d:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805884:	00 00 00 
+  805887:	80 38 00             	cmpb   $0x0,(%rax)
+  80588a:	74 33                	je     8058bf <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80588c:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805893:	00 00 00 
+  805896:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80589b:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8058a2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8058a5:	48 85 c0             	test   %rax,%rax
+  8058a8:	0f 84 85 00 00 00    	je     805933 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8058ae:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8058b2:	74 40                	je     8058f4 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8058b4:	48 83 c1 01          	add    $0x1,%rcx
+  8058b8:	48 39 c1             	cmp    %rax,%rcx
+  8058bb:	75 f1                	jne    8058ae <remove_pgfault_handler+0x35>
+  8058bd:	eb 74                	jmp    805933 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8058bf:	48 b9 76 67 80 00 00 	movabs $0x806776,%rcx
+  8058c6:	00 00 00 
+  8058c9:	48 ba 36 66 80 00 00 	movabs $0x806636,%rdx
+  8058d0:	00 00 00 
+  8058d3:	be 48 00 00 00       	mov    $0x48,%esi
+  8058d8:	48 bf 50 67 80 00 00 	movabs $0x806750,%rdi
+  8058df:	00 00 00 
+  8058e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058e7:	49 b8 07 56 80 00 00 	movabs $0x805607,%r8
+  8058ee:	00 00 00 
+  8058f1:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8058f4:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8058fb:	00 
+  8058fc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805900:	48 29 ca             	sub    %rcx,%rdx
+  805903:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80590a:	00 00 00 
+  80590d:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805911:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805916:	48 89 ce             	mov    %rcx,%rsi
+  805919:	48 b8 6c 24 80 00 00 	movabs $0x80246c,%rax
+  805920:	00 00 00 
+  805923:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805925:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80592c:	00 00 00 
+  80592f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805933:	5d                   	pop    %rbp
+  805934:	c3                   	ret
+
+0000000000805935 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805935:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805938:	48 b8 aa 56 80 00 00 	movabs $0x8056aa,%rax
+  80593f:	00 00 00 
+    call *%rax
+  805942:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805944:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80594b:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80594c:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805953:	00 
+    subq $8, %rcx
+  805954:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805958:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80595b:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805962:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805963:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805967:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80596b:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805970:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805975:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80597a:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80597f:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805984:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805989:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80598e:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805993:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805998:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80599d:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8059a2:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8059a7:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8059ac:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8059b1:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8059b5:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8059b9:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8059ba:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8059bb:	c3                   	ret
+  8059bc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008059c0 <__rodata_start>:
+  8059c0:	77 00                	ja     8059c2 <__rodata_start+0x2>
+  8059c2:	72 62                	jb     805a26 <__rodata_start+0x66>
+  8059c4:	00 77 62             	add    %dh,0x62(%rdi)
+  8059c7:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8059ca:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8059d1:	00 
+  8059d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059d9:	00 00 00 
+  8059dc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8059e0:	b3 09                	mov    $0x9,%bl
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 ed                	add    %ch,%ch
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	ed                   	in     (%dx),%eax
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ed                   	in     (%dx),%eax
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 ed                	add    %ch,%ch
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	ed                   	in     (%dx),%eax
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	8c 0a                	mov    %cs,(%rdx)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	8c 0a                	mov    %cs,(%rdx)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	8c 0a                	mov    %cs,(%rdx)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	8c 0a                	mov    %cs,(%rdx)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	8c 0a                	mov    %cs,(%rdx)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	ed                   	in     (%dx),%eax
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	ed                   	in     (%dx),%eax
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	ed                   	in     (%dx),%eax
+  805b71:	0d 80 00 00 00       	or     $0x80,%eax
+  805b76:	00 00                	add    %al,(%rax)
+  805b78:	f4                   	hlt
+  805b79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b7f:	00 ed                	add    %ch,%ch
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	2c 0b                	sub    $0xb,%al
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 ed                	add    %ch,%ch
+  805b99:	0d 80 00 00 00       	or     $0x80,%eax
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	ed                   	in     (%dx),%eax
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	ed                   	in     (%dx),%eax
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	ed                   	in     (%dx),%eax
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ed                   	in     (%dx),%eax
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805bd3:	00 00                	add    %al,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 cb                	add    %cl,%bl
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ed                   	in     (%dx),%eax
+  805be1:	0d 80 00 00 00       	or     $0x80,%eax
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	ed                   	in     (%dx),%eax
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	6a 0a                	push   $0xa
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 ed                	add    %ch,%ch
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	3c 0a                	cmp    $0xa,%al
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 ed                	add    %ch,%ch
+  805c21:	0d 80 00 00 00       	or     $0x80,%eax
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805c2b:	00 00                	add    %al,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 29                	add    %ch,(%rcx)
+  805c39:	0c 80                	or     $0x80,%al
+  805c3b:	00 00                	add    %al,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 ed                	add    %ch,%ch
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	1a 0b                	sbb    (%rbx),%cl
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 ed                	add    %ch,%ch
+  805c59:	0d 80 00 00 00       	or     $0x80,%eax
+  805c5e:	00 00                	add    %al,(%rax)
+  805c60:	ce                   	(bad)
+  805c61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c67:	00 ed                	add    %ch,%ch
+  805c69:	0d 80 00 00 00       	or     $0x80,%eax
+  805c6e:	00 00                	add    %al,(%rax)
+  805c70:	ed                   	in     (%dx),%eax
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	f4                   	hlt
+  805c79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c7f:	00 37                	add    %dh,(%rdi)
+  805c81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 37                	add    %dh,(%rdi)
+  805c91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805cab:	00 00                	add    %al,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 d2                	add    %dl,%dl
+  805cb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cb7:	00 d2                	add    %dl,%dl
+  805cb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cbf:	00 d2                	add    %dl,%dl
+  805cc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cc7:	00 d2                	add    %dl,%dl
+  805cc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ccf:	00 d2                	add    %dl,%dl
+  805cd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cd7:	00 d2                	add    %dl,%dl
+  805cd9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cdf:	00 d2                	add    %dl,%dl
+  805ce1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ce7:	00 f6                	add    %dh,%dh
+  805ce9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cef:	00 f6                	add    %dh,%dh
+  805cf1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 22                	add    %ah,(%rdx)
+  805d31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d37:	00 22                	add    %ah,(%rdx)
+  805d39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d3f:	00 22                	add    %ah,(%rdx)
+  805d41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d47:	00 22                	add    %ah,(%rdx)
+  805d49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d4f:	00 22                	add    %ah,(%rdx)
+  805d51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d57:	00 22                	add    %ah,(%rdx)
+  805d59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 46 12             	add    %al,0x12(%rsi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 22                	add    %ah,(%rdx)
+  805e31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e37:	00 22                	add    %ah,(%rdx)
+  805e39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e3f:	00 22                	add    %ah,(%rdx)
+  805e41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e47:	00 22                	add    %ah,(%rdx)
+  805e49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e4f:	00 22                	add    %ah,(%rdx)
+  805e51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e57:	00 22                	add    %ah,(%rdx)
+  805e59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e92:	80 00 00             	addb   $0x0,(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ed2:	80 00 00             	addb   $0x0,(%rax)
+  805ed5:	00 00                	add    %al,(%rax)
+  805ed7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 46 12             	add    %al,0x12(%rsi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805f00 <basefix.0>:
+  805f00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805f10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805f20:	10 00 69 20 61 6d 20 25 30 38 78 3b 20 74 68 69     ..i am %08x; thi
+  805f30:	73 65 6e 76 20 69 73 20 25 70 0a 00 73 65 6e 64     senv is %p..send
+  805f40:	20 30 20 66 72 6f 6d 20 25 78 20 74 6f 20 25 78      0 from %x to %x
+  805f50:	0a 00 66 0f 1f 44 00 00 25 78 20 67 6f 74 20 25     ..f..D..%x got %
+  805f60:	64 20 66 72 6f 6d 20 25 78 20 28 74 68 69 73 65     d from %x (thise
+  805f70:	6e 76 20 69 73 20 25 70 20 25 78 29 0a 00 3c 75     nv is %p %x)..<u
+  805f80:	6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35 36 37     nknown>.01234567
+  805f90:	38 39 41 42 43 44 45 46 00 30 31 32 33 34 35 36     89ABCDEF.0123456
+  805fa0:	37 38 39 61 62 63 64 65 66 00 28 6e 75 6c 6c 29     789abcdef.(null)
+  805fb0:	00 65 72 72 6f 72 20 25 64 00 75 6e 73 70 65 63     .error %d.unspec
+  805fc0:	69 66 69 65 64 20 65 72 72 6f 72 00 62 61 64 20     ified error.bad 
+  805fd0:	65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e 76 61     environment.inva
+  805fe0:	6c 69 64 20 70 61 72 61 6d 65 74 65 72 00 6f 75     lid parameter.ou
+  805ff0:	74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75 74 20     t of memory.out 
+  806000:	6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 73 00     of environments.
+  806010:	63 6f 72 72 75 70 74 65 64 20 64 65 62 75 67 20     corrupted debug 
+  806020:	69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74 69 6f     info.segmentatio
+  806030:	6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69 64 20     n fault.invalid 
+  806040:	45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73 75 63     ELF image.no suc
+  806050:	68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00 65 6e     h system call.en
+  806060:	74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00 65 6e     try not found.en
+  806070:	76 20 69 73 20 6e 6f 74 20 72 65 63 76 69 6e 67     v is not recving
+  806080:	00 75 6e 65 78 70 65 63 74 65 64 20 65 6e 64 20     .unexpected end 
+  806090:	6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65 65 20     of file.no free 
+  8060a0:	73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00 74 6f     space on disk.to
+  8060b0:	6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61 72 65     o many files are
+  8060c0:	20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20 62 6c      open.file or bl
+  8060d0:	6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00 69 6e     ock not found.in
+  8060e0:	76 61 6c 69 64 20 70 61 74 68 00 66 69 6c 65 20     valid path.file 
+  8060f0:	61 6c 72 65 61 64 79 20 65 78 69 73 74 73 00 6f     already exists.o
+  806100:	70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73 75 70     peration not sup
+  806110:	70 6f 72 74 65 64 00 66 0f 1f 84 00 00 00 00 00     ported.f........
+  806120:	dd 19 80 00 00 00 00 00 34 20 80 00 00 00 00 00     ........4 ......
+  806130:	24 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     $ ......4 ......
+  806140:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806150:	34 20 80 00 00 00 00 00 fc 19 80 00 00 00 00 00     4 ..............
+  806160:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806170:	f0 19 80 00 00 00 00 00 6a 1a 80 00 00 00 00 00     ........j.......
+  806180:	34 20 80 00 00 00 00 00 f0 19 80 00 00 00 00 00     4 ..............
+  806190:	36 1a 80 00 00 00 00 00 36 1a 80 00 00 00 00 00     6.......6.......
+  8061a0:	36 1a 80 00 00 00 00 00 36 1a 80 00 00 00 00 00     6.......6.......
+  8061b0:	36 1a 80 00 00 00 00 00 36 1a 80 00 00 00 00 00     6.......6.......
+  8061c0:	36 1a 80 00 00 00 00 00 36 1a 80 00 00 00 00 00     6.......6.......
+  8061d0:	36 1a 80 00 00 00 00 00 34 20 80 00 00 00 00 00     6.......4 ......
+  8061e0:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  8061f0:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806200:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806210:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806220:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806230:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806240:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806250:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806260:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806270:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806280:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806290:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  8062a0:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  8062b0:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  8062c0:	34 20 80 00 00 00 00 00 52 1f 80 00 00 00 00 00     4 ......R.......
+  8062d0:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  8062e0:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  8062f0:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806300:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806310:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806320:	98 1a 80 00 00 00 00 00 67 1c 80 00 00 00 00 00     ........g.......
+  806330:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806340:	34 20 80 00 00 00 00 00 8d 1a 80 00 00 00 00 00     4 ..............
+  806350:	c7 1a 80 00 00 00 00 00 34 20 80 00 00 00 00 00     ........4 ......
+  806360:	34 20 80 00 00 00 00 00 82 1a 80 00 00 00 00 00     4 ..............
+  806370:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  806380:	10 1e 80 00 00 00 00 00 df 1e 80 00 00 00 00 00     ................
+  806390:	34 20 80 00 00 00 00 00 34 20 80 00 00 00 00 00     4 ......4 ......
+  8063a0:	5e 1b 80 00 00 00 00 00 34 20 80 00 00 00 00 00     ^.......4 ......
+  8063b0:	3b 1d 80 00 00 00 00 00 34 20 80 00 00 00 00 00     ;.......4 ......
+  8063c0:	34 20 80 00 00 00 00 00 52 1f 80 00 00 00 00 00     4 ......R.......
+  8063d0:	34 20 80 00 00 00 00 00 e6 19 80 00 00 00 00 00     4 ..............
+
+00000000008063e0 <error_string>:
+	...
+  8063e8:	ba 5f 80 00 00 00 00 00 cc 5f 80 00 00 00 00 00     ._......._......
+  8063f8:	dc 5f 80 00 00 00 00 00 ee 5f 80 00 00 00 00 00     ._......._......
+  806408:	fc 5f 80 00 00 00 00 00 10 60 80 00 00 00 00 00     ._.......`......
+  806418:	25 60 80 00 00 00 00 00 38 60 80 00 00 00 00 00     %`......8`......
+  806428:	4a 60 80 00 00 00 00 00 5e 60 80 00 00 00 00 00     J`......^`......
+  806438:	6e 60 80 00 00 00 00 00 81 60 80 00 00 00 00 00     n`.......`......
+  806448:	98 60 80 00 00 00 00 00 ae 60 80 00 00 00 00 00     .`.......`......
+  806458:	c6 60 80 00 00 00 00 00 de 60 80 00 00 00 00 00     .`.......`......
+  806468:	eb 60 80 00 00 00 00 00 80 64 80 00 00 00 00 00     .`.......d......
+  806478:	ff 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .`......file is 
+  806488:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806498:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8064a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8064b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8064c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8064d8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8064e8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8064f8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806508:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806518:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806528:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806538:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806548:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 69     ult_upcall: %i.i
+  806558:	70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f     pc_send: %i.lib/
+  806568:	69 70 63 2e 63 00 66 90 5b 25 30 38 78 5d 20 75     ipc.c.f.[%08x] u
+  806578:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806588:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806598:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8065a8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8065b8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8065c8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8065d8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8065e8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065f8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806600 <devtab>:
+  806600:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806610:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806620:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806630:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806640:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806650:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806660:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806670:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806680:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806690:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8066a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8066b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8066c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8066d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8066e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8066f0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806700:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806710:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806720:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806730:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806740:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806750:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806760:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806770:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806780:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
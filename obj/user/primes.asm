@@ -0,0 +1,10559 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 5c 24 80 00 00 	movabs $0x80245c,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 51 38 80 00 00 	movabs $0x803851,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 51 38 80 00 00 	movabs $0x803851,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 27 42 80 00 00 	movabs $0x804227,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 ec 20 80 00 00 	movabs $0x8020ec,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 27 42 80 00 00 	movabs $0x804227,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 ec 20 80 00 00 	movabs $0x8020ec,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be a7 5f 80 00 00 	movabs $0x805fa7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be b8 59 80 00 00 	movabs $0x8059b8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be ba 59 80 00 00 	movabs $0x8059ba,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be bd 59 80 00 00 	movabs $0x8059bd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 25 50 80 00 00 	movabs $0x805025,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 fc 52 80 00 00 	movabs $0x8052fc,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 3b 39 80 00 00 	movabs $0x80393b,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 04 3a 80 00 00 	movabs $0x803a04,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 0a 39 80 00 00 	movabs $0x80390a,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 0a 39 80 00 00 	movabs $0x80390a,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 22 37 80 00 00 	movabs $0x803722,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 51 38 80 00 00 	movabs $0x803851,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 29 24 80 00 00 	movabs $0x802429,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 59 80 00 00 	movabs $0x8059c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 5c 24 80 00 00 	movabs $0x80245c,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 29 24 80 00 00 	movabs $0x802429,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 5c 80 00 00 	movabs $0x805c60,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 29 24 80 00 00 	movabs $0x802429,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 29 24 80 00 00 	movabs $0x802429,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5e 80 00 00 	movabs $0x805ee0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5e 80 00 00 	movabs $0x805ee0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 68 01 00 00       	call   801667 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = ipc_recv(&envid, 0, 0, 0);
+  801512:	49 bf a4 31 80 00 00 	movabs $0x8031a4,%r15
+  801519:	00 00 00 
+    cprintf("%d ", p);
+  80151c:	49 be 83 18 80 00 00 	movabs $0x801883,%r14
+  801523:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  801526:	49 bd 7d 2f 80 00 00 	movabs $0x802f7d,%r13
+  80152d:	00 00 00 
+    p = ipc_recv(&envid, 0, 0, 0);
+  801530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153a:	be 00 00 00 00       	mov    $0x0,%esi
+  80153f:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  801543:	41 ff d7             	call   *%r15
+  801546:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  801548:	89 c6                	mov    %eax,%esi
+  80154a:	48 bf 02 5f 80 00 00 	movabs $0x805f02,%rdi
+  801551:	00 00 00 
+  801554:	b8 00 00 00 00       	mov    $0x0,%eax
+  801559:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  80155c:	41 ff d5             	call   *%r13
+  80155f:	41 89 c4             	mov    %eax,%r12d
+  801562:	85 c0                	test   %eax,%eax
+  801564:	78 4d                	js     8015b3 <primeproc+0xb2>
+        panic("fork: %i", id);
+    if (id == 0)
+  801566:	74 c8                	je     801530 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = ipc_recv(&envid, 0, 0, 0);
+  801568:	49 bd a4 31 80 00 00 	movabs $0x8031a4,%r13
+  80156f:	00 00 00 
+        if (i % p)
+            ipc_send(id, i, 0, 0, 0);
+  801572:	49 be 09 32 80 00 00 	movabs $0x803209,%r14
+  801579:	00 00 00 
+        i = ipc_recv(&envid, 0, 0, 0);
+  80157c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801581:	ba 00 00 00 00       	mov    $0x0,%edx
+  801586:	be 00 00 00 00       	mov    $0x0,%esi
+  80158b:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80158f:	41 ff d5             	call   *%r13
+  801592:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  801594:	99                   	cltd
+  801595:	f7 fb                	idiv   %ebx
+  801597:	85 d2                	test   %edx,%edx
+  801599:	74 e1                	je     80157c <primeproc+0x7b>
+            ipc_send(id, i, 0, 0, 0);
+  80159b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ab:	44 89 e7             	mov    %r12d,%edi
+  8015ae:	41 ff d6             	call   *%r14
+  8015b1:	eb c9                	jmp    80157c <primeproc+0x7b>
+        panic("fork: %i", id);
+  8015b3:	89 c1                	mov    %eax,%ecx
+  8015b5:	48 ba 9c 64 80 00 00 	movabs $0x80649c,%rdx
+  8015bc:	00 00 00 
+  8015bf:	be 19 00 00 00       	mov    $0x19,%esi
+  8015c4:	48 bf 06 5f 80 00 00 	movabs $0x805f06,%rdi
+  8015cb:	00 00 00 
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d3:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  8015da:	00 00 00 
+  8015dd:	41 ff d0             	call   *%r8
+
+00000000008015e0 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  8015e0:	55                   	push   %rbp
+  8015e1:	48 89 e5             	mov    %rsp,%rbp
+  8015e4:	41 55                	push   %r13
+  8015e6:	41 54                	push   %r12
+  8015e8:	53                   	push   %rbx
+  8015e9:	48 83 ec 08          	sub    $0x8,%rsp
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  8015ed:	48 b8 7d 2f 80 00 00 	movabs $0x802f7d,%rax
+  8015f4:	00 00 00 
+  8015f7:	ff d0                	call   *%rax
+  8015f9:	41 89 c4             	mov    %eax,%r12d
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 2e                	js     80162e <umain+0x4e>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  801600:	bb 02 00 00 00       	mov    $0x2,%ebx
+        ipc_send(id, i, 0, 0, 0);
+  801605:	49 bd 09 32 80 00 00 	movabs $0x803209,%r13
+  80160c:	00 00 00 
+    if (id == 0)
+  80160f:	74 4a                	je     80165b <umain+0x7b>
+        ipc_send(id, i, 0, 0, 0);
+  801611:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801617:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80161c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801621:	89 de                	mov    %ebx,%esi
+  801623:	44 89 e7             	mov    %r12d,%edi
+  801626:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  801629:	83 c3 01             	add    $0x1,%ebx
+  80162c:	eb e3                	jmp    801611 <umain+0x31>
+        panic("fork: %i", id);
+  80162e:	89 c1                	mov    %eax,%ecx
+  801630:	48 ba 9c 64 80 00 00 	movabs $0x80649c,%rdx
+  801637:	00 00 00 
+  80163a:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80163f:	48 bf 06 5f 80 00 00 	movabs $0x805f06,%rdi
+  801646:	00 00 00 
+  801649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164e:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  801655:	00 00 00 
+  801658:	41 ff d0             	call   *%r8
+        primeproc();
+  80165b:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801662:	00 00 00 
+  801665:	ff d0                	call   *%rax
+
+0000000000801667 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801667:	55                   	push   %rbp
+  801668:	48 89 e5             	mov    %rsp,%rbp
+  80166b:	41 56                	push   %r14
+  80166d:	41 55                	push   %r13
+  80166f:	41 54                	push   %r12
+  801671:	53                   	push   %rbx
+  801672:	41 89 fd             	mov    %edi,%r13d
+  801675:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801678:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80167f:	00 00 00 
+  801682:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801689:	00 00 00 
+  80168c:	48 39 c2             	cmp    %rax,%rdx
+  80168f:	73 17                	jae    8016a8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801691:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801694:	49 89 c4             	mov    %rax,%r12
+  801697:	48 83 c3 08          	add    $0x8,%rbx
+  80169b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a0:	ff 53 f8             	call   *-0x8(%rbx)
+  8016a3:	4c 39 e3             	cmp    %r12,%rbx
+  8016a6:	72 ef                	jb     801697 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8016a8:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  8016af:	00 00 00 
+  8016b2:	ff d0                	call   *%rax
+  8016b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016b9:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8016c0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016c7:	00 00 00 
+  8016ca:	48 01 d0             	add    %rdx,%rax
+  8016cd:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8016d4:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8016d7:	45 85 ed             	test   %r13d,%r13d
+  8016da:	7e 0d                	jle    8016e9 <libmain+0x82>
+  8016dc:	49 8b 06             	mov    (%r14),%rax
+  8016df:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8016e6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8016e9:	4c 89 f6             	mov    %r14,%rsi
+  8016ec:	44 89 ef             	mov    %r13d,%edi
+  8016ef:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  8016f6:	00 00 00 
+  8016f9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8016fb:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  801702:	00 00 00 
+  801705:	ff d0                	call   *%rax
+#endif
+}
+  801707:	5b                   	pop    %rbx
+  801708:	41 5c                	pop    %r12
+  80170a:	41 5d                	pop    %r13
+  80170c:	41 5e                	pop    %r14
+  80170e:	5d                   	pop    %rbp
+  80170f:	c3                   	ret
+
+0000000000801710 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801714:	48 b8 d7 35 80 00 00 	movabs $0x8035d7,%rax
+  80171b:	00 00 00 
+  80171e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801720:	bf 00 00 00 00       	mov    $0x0,%edi
+  801725:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  80172c:	00 00 00 
+  80172f:	ff d0                	call   *%rax
+}
+  801731:	5d                   	pop    %rbp
+  801732:	c3                   	ret
+
+0000000000801733 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801733:	55                   	push   %rbp
+  801734:	48 89 e5             	mov    %rsp,%rbp
+  801737:	41 56                	push   %r14
+  801739:	41 55                	push   %r13
+  80173b:	41 54                	push   %r12
+  80173d:	53                   	push   %rbx
+  80173e:	48 83 ec 50          	sub    $0x50,%rsp
+  801742:	49 89 fc             	mov    %rdi,%r12
+  801745:	41 89 f5             	mov    %esi,%r13d
+  801748:	48 89 d3             	mov    %rdx,%rbx
+  80174b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80174f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801753:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801757:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80175e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801762:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801766:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80176a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80176e:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801775:	00 00 00 
+  801778:	4c 8b 30             	mov    (%rax),%r14
+  80177b:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  801782:	00 00 00 
+  801785:	ff d0                	call   *%rax
+  801787:	89 c6                	mov    %eax,%esi
+  801789:	45 89 e8             	mov    %r13d,%r8d
+  80178c:	4c 89 e1             	mov    %r12,%rcx
+  80178f:	4c 89 f2             	mov    %r14,%rdx
+  801792:	48 bf 20 5f 80 00 00 	movabs $0x805f20,%rdi
+  801799:	00 00 00 
+  80179c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a1:	49 bc 83 18 80 00 00 	movabs $0x801883,%r12
+  8017a8:	00 00 00 
+  8017ab:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8017ae:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8017b2:	48 89 df             	mov    %rbx,%rdi
+  8017b5:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  8017bc:	00 00 00 
+  8017bf:	ff d0                	call   *%rax
+    cprintf("\n");
+  8017c1:	48 bf 8b 65 80 00 00 	movabs $0x80658b,%rdi
+  8017c8:	00 00 00 
+  8017cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8017d3:	cc                   	int3
+  8017d4:	eb fd                	jmp    8017d3 <_panic+0xa0>
+
+00000000008017d6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8017d6:	55                   	push   %rbp
+  8017d7:	48 89 e5             	mov    %rsp,%rbp
+  8017da:	53                   	push   %rbx
+  8017db:	48 83 ec 08          	sub    $0x8,%rsp
+  8017df:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8017e2:	8b 06                	mov    (%rsi),%eax
+  8017e4:	8d 50 01             	lea    0x1(%rax),%edx
+  8017e7:	89 16                	mov    %edx,(%rsi)
+  8017e9:	48 98                	cltq
+  8017eb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8017f0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8017f6:	74 0a                	je     801802 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8017f8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8017fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801800:	c9                   	leave
+  801801:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801802:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801806:	be ff 00 00 00       	mov    $0xff,%esi
+  80180b:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  801812:	00 00 00 
+  801815:	ff d0                	call   *%rax
+        state->offset = 0;
+  801817:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80181d:	eb d9                	jmp    8017f8 <putch+0x22>
+
+000000000080181f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80181f:	55                   	push   %rbp
+  801820:	48 89 e5             	mov    %rsp,%rbp
+  801823:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80182a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80182d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801834:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801839:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801841:	48 89 f1             	mov    %rsi,%rcx
+  801844:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80184b:	48 bf d6 17 80 00 00 	movabs $0x8017d6,%rdi
+  801852:	00 00 00 
+  801855:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  80185c:	00 00 00 
+  80185f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801861:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801868:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80186f:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  801876:	00 00 00 
+  801879:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80187b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801881:	c9                   	leave
+  801882:	c3                   	ret
+
+0000000000801883 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801883:	55                   	push   %rbp
+  801884:	48 89 e5             	mov    %rsp,%rbp
+  801887:	48 83 ec 50          	sub    $0x50,%rsp
+  80188b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80188f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801893:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801897:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80189b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80189f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8018a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018ae:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8018b6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8018ba:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  8018c1:	00 00 00 
+  8018c4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8018c6:	c9                   	leave
+  8018c7:	c3                   	ret
+
+00000000008018c8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8018c8:	55                   	push   %rbp
+  8018c9:	48 89 e5             	mov    %rsp,%rbp
+  8018cc:	41 57                	push   %r15
+  8018ce:	41 56                	push   %r14
+  8018d0:	41 55                	push   %r13
+  8018d2:	41 54                	push   %r12
+  8018d4:	53                   	push   %rbx
+  8018d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8018d9:	49 89 fc             	mov    %rdi,%r12
+  8018dc:	49 89 f5             	mov    %rsi,%r13
+  8018df:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018e3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8018e6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8018e9:	41 89 cf             	mov    %ecx,%r15d
+  8018ec:	4c 39 fa             	cmp    %r15,%rdx
+  8018ef:	73 5b                	jae    80194c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8018f1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8018f5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8018f9:	85 db                	test   %ebx,%ebx
+  8018fb:	7e 0e                	jle    80190b <print_num+0x43>
+            putch(padc, put_arg);
+  8018fd:	4c 89 ee             	mov    %r13,%rsi
+  801900:	44 89 f7             	mov    %r14d,%edi
+  801903:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801906:	83 eb 01             	sub    $0x1,%ebx
+  801909:	75 f2                	jne    8018fd <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80190b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80190f:	48 b9 54 5f 80 00 00 	movabs $0x805f54,%rcx
+  801916:	00 00 00 
+  801919:	48 b8 43 5f 80 00 00 	movabs $0x805f43,%rax
+  801920:	00 00 00 
+  801923:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801927:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80192b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801930:	49 f7 f7             	div    %r15
+  801933:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801937:	4c 89 ee             	mov    %r13,%rsi
+  80193a:	41 ff d4             	call   *%r12
+}
+  80193d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801941:	5b                   	pop    %rbx
+  801942:	41 5c                	pop    %r12
+  801944:	41 5d                	pop    %r13
+  801946:	41 5e                	pop    %r14
+  801948:	41 5f                	pop    %r15
+  80194a:	5d                   	pop    %rbp
+  80194b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80194c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801950:	ba 00 00 00 00       	mov    $0x0,%edx
+  801955:	49 f7 f7             	div    %r15
+  801958:	48 83 ec 08          	sub    $0x8,%rsp
+  80195c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801960:	52                   	push   %rdx
+  801961:	45 0f be c9          	movsbl %r9b,%r9d
+  801965:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801969:	48 89 c2             	mov    %rax,%rdx
+  80196c:	48 b8 c8 18 80 00 00 	movabs $0x8018c8,%rax
+  801973:	00 00 00 
+  801976:	ff d0                	call   *%rax
+  801978:	48 83 c4 10          	add    $0x10,%rsp
+  80197c:	eb 8d                	jmp    80190b <print_num+0x43>
+
+000000000080197e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80197e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801982:	48 8b 06             	mov    (%rsi),%rax
+  801985:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801989:	73 0a                	jae    801995 <sprintputch+0x17>
+        *state->start++ = ch;
+  80198b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80198f:	48 89 16             	mov    %rdx,(%rsi)
+  801992:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801995:	c3                   	ret
+
+0000000000801996 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801996:	55                   	push   %rbp
+  801997:	48 89 e5             	mov    %rsp,%rbp
+  80199a:	48 83 ec 50          	sub    $0x50,%rsp
+  80199e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019a2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019a6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8019aa:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8019b1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019b9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019bd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8019c1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8019c5:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  8019cc:	00 00 00 
+  8019cf:	ff d0                	call   *%rax
+}
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+
+00000000008019d3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8019d3:	55                   	push   %rbp
+  8019d4:	48 89 e5             	mov    %rsp,%rbp
+  8019d7:	41 57                	push   %r15
+  8019d9:	41 56                	push   %r14
+  8019db:	41 55                	push   %r13
+  8019dd:	41 54                	push   %r12
+  8019df:	53                   	push   %rbx
+  8019e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e4:	49 89 fe             	mov    %rdi,%r14
+  8019e7:	49 89 f5             	mov    %rsi,%r13
+  8019ea:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8019ed:	48 8b 01             	mov    (%rcx),%rax
+  8019f0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019f4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8019f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019fc:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801a00:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801a04:	eb 0d                	jmp    801a13 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801a06:	40 0f b6 ff          	movzbl %dil,%edi
+  801a0a:	4c 89 ee             	mov    %r13,%rsi
+  801a0d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801a10:	4c 89 e3             	mov    %r12,%rbx
+  801a13:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801a17:	0f b6 3b             	movzbl (%rbx),%edi
+  801a1a:	40 80 ff 25          	cmp    $0x25,%dil
+  801a1e:	74 14                	je     801a34 <vprintfmt+0x61>
+            if (!ch) return;
+  801a20:	40 84 ff             	test   %dil,%dil
+  801a23:	75 e1                	jne    801a06 <vprintfmt+0x33>
+}
+  801a25:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a29:	5b                   	pop    %rbx
+  801a2a:	41 5c                	pop    %r12
+  801a2c:	41 5d                	pop    %r13
+  801a2e:	41 5e                	pop    %r14
+  801a30:	41 5f                	pop    %r15
+  801a32:	5d                   	pop    %rbp
+  801a33:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801a34:	be 00 00 00 00       	mov    $0x0,%esi
+  801a39:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801a42:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a48:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801a4f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a53:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801a58:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a5d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a60:	83 e8 23             	sub    $0x23,%eax
+  801a63:	3c 57                	cmp    $0x57,%al
+  801a65:	0f 87 67 06 00 00    	ja     8020d2 <vprintfmt+0x6ff>
+  801a6b:	0f b6 c0             	movzbl %al,%eax
+  801a6e:	48 b9 e0 60 80 00 00 	movabs $0x8060e0,%rcx
+  801a75:	00 00 00 
+  801a78:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801a7b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801a7e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801a82:	eb cf                	jmp    801a53 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801a84:	49 89 dc             	mov    %rbx,%r12
+  801a87:	be 01 00 00 00       	mov    $0x1,%esi
+  801a8c:	eb c5                	jmp    801a53 <vprintfmt+0x80>
+            padc = ch;
+  801a8e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801a92:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a95:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a98:	eb b9                	jmp    801a53 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a9d:	83 f8 2f             	cmp    $0x2f,%eax
+  801aa0:	77 24                	ja     801ac6 <vprintfmt+0xf3>
+  801aa2:	89 c1                	mov    %eax,%ecx
+  801aa4:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801aa8:	83 c0 08             	add    $0x8,%eax
+  801aab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801aae:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801ab1:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801ab4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ab8:	79 99                	jns    801a53 <vprintfmt+0x80>
+                width = precision;
+  801aba:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801abe:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801ac4:	eb 8d                	jmp    801a53 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801ac6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801aca:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801ace:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ad2:	eb da                	jmp    801aae <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801ad4:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801ad9:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801add:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ae3:	3c 39                	cmp    $0x39,%al
+  801ae5:	77 1c                	ja     801b03 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801ae7:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801aeb:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801aef:	0f b6 c0             	movzbl %al,%eax
+  801af2:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801af7:	0f b6 03             	movzbl (%rbx),%eax
+  801afa:	3c 39                	cmp    $0x39,%al
+  801afc:	76 e9                	jbe    801ae7 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801afe:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801b01:	eb b1                	jmp    801ab4 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801b03:	49 89 dc             	mov    %rbx,%r12
+  801b06:	eb ac                	jmp    801ab4 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801b08:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801b0b:	85 c9                	test   %ecx,%ecx
+  801b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b12:	0f 49 c1             	cmovns %ecx,%eax
+  801b15:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801b18:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b1b:	e9 33 ff ff ff       	jmp    801a53 <vprintfmt+0x80>
+            lflag++;
+  801b20:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b23:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b26:	e9 28 ff ff ff       	jmp    801a53 <vprintfmt+0x80>
+            lflag--;
+  801b2b:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b2e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b31:	e9 1d ff ff ff       	jmp    801a53 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801b36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b39:	83 f8 2f             	cmp    $0x2f,%eax
+  801b3c:	77 19                	ja     801b57 <vprintfmt+0x184>
+  801b3e:	89 c2                	mov    %eax,%edx
+  801b40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b44:	83 c0 08             	add    $0x8,%eax
+  801b47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b4a:	8b 3a                	mov    (%rdx),%edi
+  801b4c:	4c 89 ee             	mov    %r13,%rsi
+  801b4f:	41 ff d6             	call   *%r14
+            break;
+  801b52:	e9 bc fe ff ff       	jmp    801a13 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801b57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b63:	eb e5                	jmp    801b4a <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801b65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b68:	83 f8 2f             	cmp    $0x2f,%eax
+  801b6b:	77 5a                	ja     801bc7 <vprintfmt+0x1f4>
+  801b6d:	89 c2                	mov    %eax,%edx
+  801b6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b73:	83 c0 08             	add    $0x8,%eax
+  801b76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801b79:	8b 02                	mov    (%rdx),%eax
+  801b7b:	89 c1                	mov    %eax,%ecx
+  801b7d:	f7 d9                	neg    %ecx
+  801b7f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801b82:	83 f9 13             	cmp    $0x13,%ecx
+  801b85:	7f 4e                	jg     801bd5 <vprintfmt+0x202>
+  801b87:	48 63 c1             	movslq %ecx,%rax
+  801b8a:	48 ba a0 63 80 00 00 	movabs $0x8063a0,%rdx
+  801b91:	00 00 00 
+  801b94:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b98:	48 85 c0             	test   %rax,%rax
+  801b9b:	74 38                	je     801bd5 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801b9d:	48 89 c1             	mov    %rax,%rcx
+  801ba0:	48 ba 08 66 80 00 00 	movabs $0x806608,%rdx
+  801ba7:	00 00 00 
+  801baa:	4c 89 ee             	mov    %r13,%rsi
+  801bad:	4c 89 f7             	mov    %r14,%rdi
+  801bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb5:	49 b8 96 19 80 00 00 	movabs $0x801996,%r8
+  801bbc:	00 00 00 
+  801bbf:	41 ff d0             	call   *%r8
+  801bc2:	e9 4c fe ff ff       	jmp    801a13 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801bc7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bcb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bcf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd3:	eb a4                	jmp    801b79 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801bd5:	48 ba 6c 5f 80 00 00 	movabs $0x805f6c,%rdx
+  801bdc:	00 00 00 
+  801bdf:	4c 89 ee             	mov    %r13,%rsi
+  801be2:	4c 89 f7             	mov    %r14,%rdi
+  801be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bea:	49 b8 96 19 80 00 00 	movabs $0x801996,%r8
+  801bf1:	00 00 00 
+  801bf4:	41 ff d0             	call   *%r8
+  801bf7:	e9 17 fe ff ff       	jmp    801a13 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bff:	83 f8 2f             	cmp    $0x2f,%eax
+  801c02:	77 6c                	ja     801c70 <vprintfmt+0x29d>
+  801c04:	89 c2                	mov    %eax,%edx
+  801c06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c0a:	83 c0 08             	add    $0x8,%eax
+  801c0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c10:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801c13:	48 85 f6             	test   %rsi,%rsi
+  801c16:	48 b8 65 5f 80 00 00 	movabs $0x805f65,%rax
+  801c1d:	00 00 00 
+  801c20:	48 0f 45 c6          	cmovne %rsi,%rax
+  801c24:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801c28:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c2c:	7e 06                	jle    801c34 <vprintfmt+0x261>
+  801c2e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801c32:	75 4a                	jne    801c7e <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c34:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c38:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801c3c:	0f b6 00             	movzbl (%rax),%eax
+  801c3f:	84 c0                	test   %al,%al
+  801c41:	0f 85 9a 00 00 00    	jne    801ce1 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801c47:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c4a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801c4e:	85 c0                	test   %eax,%eax
+  801c50:	0f 8e bd fd ff ff    	jle    801a13 <vprintfmt+0x40>
+  801c56:	4c 89 ee             	mov    %r13,%rsi
+  801c59:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c5e:	41 ff d6             	call   *%r14
+  801c61:	41 83 ec 01          	sub    $0x1,%r12d
+  801c65:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801c69:	75 eb                	jne    801c56 <vprintfmt+0x283>
+  801c6b:	e9 a3 fd ff ff       	jmp    801a13 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c7c:	eb 92                	jmp    801c10 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801c7e:	49 63 f7             	movslq %r15d,%rsi
+  801c81:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801c85:	48 b8 97 21 80 00 00 	movabs $0x802197,%rax
+  801c8c:	00 00 00 
+  801c8f:	ff d0                	call   *%rax
+  801c91:	48 89 c2             	mov    %rax,%rdx
+  801c94:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c97:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801c99:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801c9c:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	7e 91                	jle    801c34 <vprintfmt+0x261>
+  801ca3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ca8:	4c 89 ee             	mov    %r13,%rsi
+  801cab:	44 89 e7             	mov    %r12d,%edi
+  801cae:	41 ff d6             	call   *%r14
+  801cb1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801cb5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cb8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801cbb:	75 eb                	jne    801ca8 <vprintfmt+0x2d5>
+  801cbd:	e9 72 ff ff ff       	jmp    801c34 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801cc2:	0f b6 f8             	movzbl %al,%edi
+  801cc5:	4c 89 ee             	mov    %r13,%rsi
+  801cc8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ccb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ccf:	49 83 c4 01          	add    $0x1,%r12
+  801cd3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801cd9:	84 c0                	test   %al,%al
+  801cdb:	0f 84 66 ff ff ff    	je     801c47 <vprintfmt+0x274>
+  801ce1:	45 85 ff             	test   %r15d,%r15d
+  801ce4:	78 0a                	js     801cf0 <vprintfmt+0x31d>
+  801ce6:	41 83 ef 01          	sub    $0x1,%r15d
+  801cea:	0f 88 57 ff ff ff    	js     801c47 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801cf0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801cf4:	74 cc                	je     801cc2 <vprintfmt+0x2ef>
+  801cf6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801cf9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801cfe:	80 fa 5e             	cmp    $0x5e,%dl
+  801d01:	77 c2                	ja     801cc5 <vprintfmt+0x2f2>
+  801d03:	eb bd                	jmp    801cc2 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801d05:	40 84 f6             	test   %sil,%sil
+  801d08:	75 26                	jne    801d30 <vprintfmt+0x35d>
+    switch (lflag) {
+  801d0a:	85 d2                	test   %edx,%edx
+  801d0c:	74 59                	je     801d67 <vprintfmt+0x394>
+  801d0e:	83 fa 01             	cmp    $0x1,%edx
+  801d11:	74 7b                	je     801d8e <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801d13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d16:	83 f8 2f             	cmp    $0x2f,%eax
+  801d19:	0f 87 96 00 00 00    	ja     801db5 <vprintfmt+0x3e2>
+  801d1f:	89 c2                	mov    %eax,%edx
+  801d21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d25:	83 c0 08             	add    $0x8,%eax
+  801d28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d2b:	4c 8b 22             	mov    (%rdx),%r12
+  801d2e:	eb 17                	jmp    801d47 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801d30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d33:	83 f8 2f             	cmp    $0x2f,%eax
+  801d36:	77 21                	ja     801d59 <vprintfmt+0x386>
+  801d38:	89 c2                	mov    %eax,%edx
+  801d3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d3e:	83 c0 08             	add    $0x8,%eax
+  801d41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d44:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801d47:	4d 85 e4             	test   %r12,%r12
+  801d4a:	78 7a                	js     801dc6 <vprintfmt+0x3f3>
+            num = i;
+  801d4c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801d4f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801d54:	e9 56 02 00 00       	jmp    801faf <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d65:	eb dd                	jmp    801d44 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801d67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d6a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d6d:	77 11                	ja     801d80 <vprintfmt+0x3ad>
+  801d6f:	89 c2                	mov    %eax,%edx
+  801d71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d75:	83 c0 08             	add    $0x8,%eax
+  801d78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d7b:	4c 63 22             	movslq (%rdx),%r12
+  801d7e:	eb c7                	jmp    801d47 <vprintfmt+0x374>
+  801d80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8c:	eb ed                	jmp    801d7b <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801d8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d91:	83 f8 2f             	cmp    $0x2f,%eax
+  801d94:	77 11                	ja     801da7 <vprintfmt+0x3d4>
+  801d96:	89 c2                	mov    %eax,%edx
+  801d98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9c:	83 c0 08             	add    $0x8,%eax
+  801d9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da2:	4c 8b 22             	mov    (%rdx),%r12
+  801da5:	eb a0                	jmp    801d47 <vprintfmt+0x374>
+  801da7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801daf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801db3:	eb ed                	jmp    801da2 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801db5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801db9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc1:	e9 65 ff ff ff       	jmp    801d2b <vprintfmt+0x358>
+                putch('-', put_arg);
+  801dc6:	4c 89 ee             	mov    %r13,%rsi
+  801dc9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801dce:	41 ff d6             	call   *%r14
+                i = -i;
+  801dd1:	49 f7 dc             	neg    %r12
+  801dd4:	e9 73 ff ff ff       	jmp    801d4c <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801dd9:	40 84 f6             	test   %sil,%sil
+  801ddc:	75 2e                	jne    801e0c <vprintfmt+0x439>
+    switch (lflag) {
+  801dde:	85 d2                	test   %edx,%edx
+  801de0:	7f 59                	jg     801e3b <vprintfmt+0x468>
+  801de2:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801de5:	7d 7a                	jge    801e61 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801de7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dea:	83 f8 2f             	cmp    $0x2f,%eax
+  801ded:	0f 87 aa 00 00 00    	ja     801e9d <vprintfmt+0x4ca>
+  801df3:	89 c2                	mov    %eax,%edx
+  801df5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df9:	83 c0 08             	add    $0x8,%eax
+  801dfc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e02:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e07:	e9 a3 01 00 00       	jmp    801faf <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e0f:	83 f8 2f             	cmp    $0x2f,%eax
+  801e12:	77 19                	ja     801e2d <vprintfmt+0x45a>
+  801e14:	89 c2                	mov    %eax,%edx
+  801e16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e1a:	83 c0 08             	add    $0x8,%eax
+  801e1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e20:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e23:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e28:	e9 82 01 00 00       	jmp    801faf <vprintfmt+0x5dc>
+  801e2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e39:	eb e5                	jmp    801e20 <vprintfmt+0x44d>
+    switch (lflag) {
+  801e3b:	83 fa 01             	cmp    $0x1,%edx
+  801e3e:	75 a7                	jne    801de7 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801e40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e43:	83 f8 2f             	cmp    $0x2f,%eax
+  801e46:	77 47                	ja     801e8f <vprintfmt+0x4bc>
+  801e48:	89 c2                	mov    %eax,%edx
+  801e4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e4e:	83 c0 08             	add    $0x8,%eax
+  801e51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e54:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e5c:	e9 4e 01 00 00       	jmp    801faf <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e64:	83 f8 2f             	cmp    $0x2f,%eax
+  801e67:	77 18                	ja     801e81 <vprintfmt+0x4ae>
+  801e69:	89 c2                	mov    %eax,%edx
+  801e6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e6f:	83 c0 08             	add    $0x8,%eax
+  801e72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e75:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801e77:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801e7c:	e9 2e 01 00 00       	jmp    801faf <vprintfmt+0x5dc>
+  801e81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e8d:	eb e6                	jmp    801e75 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801e8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9b:	eb b7                	jmp    801e54 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801e9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea9:	e9 51 ff ff ff       	jmp    801dff <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801eae:	40 84 f6             	test   %sil,%sil
+  801eb1:	75 2e                	jne    801ee1 <vprintfmt+0x50e>
+    switch (lflag) {
+  801eb3:	85 d2                	test   %edx,%edx
+  801eb5:	7f 59                	jg     801f10 <vprintfmt+0x53d>
+  801eb7:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801eba:	7d 77                	jge    801f33 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ebc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ebf:	83 f8 2f             	cmp    $0x2f,%eax
+  801ec2:	0f 87 a4 00 00 00    	ja     801f6c <vprintfmt+0x599>
+  801ec8:	89 c2                	mov    %eax,%edx
+  801eca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ece:	83 c0 08             	add    $0x8,%eax
+  801ed1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ed4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ed7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801edc:	e9 ce 00 00 00       	jmp    801faf <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ee1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee7:	77 19                	ja     801f02 <vprintfmt+0x52f>
+  801ee9:	89 c2                	mov    %eax,%edx
+  801eeb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eef:	83 c0 08             	add    $0x8,%eax
+  801ef2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ef8:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801efd:	e9 ad 00 00 00       	jmp    801faf <vprintfmt+0x5dc>
+  801f02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f0e:	eb e5                	jmp    801ef5 <vprintfmt+0x522>
+    switch (lflag) {
+  801f10:	83 fa 01             	cmp    $0x1,%edx
+  801f13:	75 a7                	jne    801ebc <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801f15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f18:	83 f8 2f             	cmp    $0x2f,%eax
+  801f1b:	77 41                	ja     801f5e <vprintfmt+0x58b>
+  801f1d:	89 c2                	mov    %eax,%edx
+  801f1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f23:	83 c0 08             	add    $0x8,%eax
+  801f26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f2c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801f31:	eb 7c                	jmp    801faf <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f36:	83 f8 2f             	cmp    $0x2f,%eax
+  801f39:	77 15                	ja     801f50 <vprintfmt+0x57d>
+  801f3b:	89 c2                	mov    %eax,%edx
+  801f3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f41:	83 c0 08             	add    $0x8,%eax
+  801f44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f47:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801f49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801f4e:	eb 5f                	jmp    801faf <vprintfmt+0x5dc>
+  801f50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f5c:	eb e9                	jmp    801f47 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f6a:	eb bd                	jmp    801f29 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801f6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f78:	e9 57 ff ff ff       	jmp    801ed4 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801f7d:	4c 89 ee             	mov    %r13,%rsi
+  801f80:	bf 30 00 00 00       	mov    $0x30,%edi
+  801f85:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801f88:	4c 89 ee             	mov    %r13,%rsi
+  801f8b:	bf 78 00 00 00       	mov    $0x78,%edi
+  801f90:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801f93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f96:	83 f8 2f             	cmp    $0x2f,%eax
+  801f99:	77 47                	ja     801fe2 <vprintfmt+0x60f>
+  801f9b:	89 c2                	mov    %eax,%edx
+  801f9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa1:	83 c0 08             	add    $0x8,%eax
+  801fa4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801faa:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801faf:	48 83 ec 08          	sub    $0x8,%rsp
+  801fb3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801fb7:	0f 94 c0             	sete   %al
+  801fba:	0f b6 c0             	movzbl %al,%eax
+  801fbd:	50                   	push   %rax
+  801fbe:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801fc3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801fc7:	4c 89 ee             	mov    %r13,%rsi
+  801fca:	4c 89 f7             	mov    %r14,%rdi
+  801fcd:	48 b8 c8 18 80 00 00 	movabs $0x8018c8,%rax
+  801fd4:	00 00 00 
+  801fd7:	ff d0                	call   *%rax
+            break;
+  801fd9:	48 83 c4 10          	add    $0x10,%rsp
+  801fdd:	e9 31 fa ff ff       	jmp    801a13 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801fe2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fe6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fee:	eb b7                	jmp    801fa7 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801ff0:	40 84 f6             	test   %sil,%sil
+  801ff3:	75 2b                	jne    802020 <vprintfmt+0x64d>
+    switch (lflag) {
+  801ff5:	85 d2                	test   %edx,%edx
+  801ff7:	7f 56                	jg     80204f <vprintfmt+0x67c>
+  801ff9:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ffc:	7d 77                	jge    802075 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801ffe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802001:	83 f8 2f             	cmp    $0x2f,%eax
+  802004:	0f 87 a7 00 00 00    	ja     8020b1 <vprintfmt+0x6de>
+  80200a:	89 c2                	mov    %eax,%edx
+  80200c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802010:	83 c0 08             	add    $0x8,%eax
+  802013:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802016:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802019:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80201e:	eb 8f                	jmp    801faf <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802020:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802023:	83 f8 2f             	cmp    $0x2f,%eax
+  802026:	77 19                	ja     802041 <vprintfmt+0x66e>
+  802028:	89 c2                	mov    %eax,%edx
+  80202a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80202e:	83 c0 08             	add    $0x8,%eax
+  802031:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802034:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802037:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80203c:	e9 6e ff ff ff       	jmp    801faf <vprintfmt+0x5dc>
+  802041:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802045:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802049:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80204d:	eb e5                	jmp    802034 <vprintfmt+0x661>
+    switch (lflag) {
+  80204f:	83 fa 01             	cmp    $0x1,%edx
+  802052:	75 aa                	jne    801ffe <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802054:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802057:	83 f8 2f             	cmp    $0x2f,%eax
+  80205a:	77 47                	ja     8020a3 <vprintfmt+0x6d0>
+  80205c:	89 c2                	mov    %eax,%edx
+  80205e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802062:	83 c0 08             	add    $0x8,%eax
+  802065:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802068:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80206b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802070:	e9 3a ff ff ff       	jmp    801faf <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802075:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802078:	83 f8 2f             	cmp    $0x2f,%eax
+  80207b:	77 18                	ja     802095 <vprintfmt+0x6c2>
+  80207d:	89 c2                	mov    %eax,%edx
+  80207f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802083:	83 c0 08             	add    $0x8,%eax
+  802086:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802089:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80208b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802090:	e9 1a ff ff ff       	jmp    801faf <vprintfmt+0x5dc>
+  802095:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802099:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80209d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020a1:	eb e6                	jmp    802089 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8020a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020af:	eb b7                	jmp    802068 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8020b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020bd:	e9 54 ff ff ff       	jmp    802016 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8020c2:	4c 89 ee             	mov    %r13,%rsi
+  8020c5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020ca:	41 ff d6             	call   *%r14
+            break;
+  8020cd:	e9 41 f9 ff ff       	jmp    801a13 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8020d2:	4c 89 ee             	mov    %r13,%rsi
+  8020d5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020da:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8020dd:	48 83 eb 01          	sub    $0x1,%rbx
+  8020e1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8020e5:	75 f6                	jne    8020dd <vprintfmt+0x70a>
+  8020e7:	e9 27 f9 ff ff       	jmp    801a13 <vprintfmt+0x40>
+
+00000000008020ec <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8020ec:	55                   	push   %rbp
+  8020ed:	48 89 e5             	mov    %rsp,%rbp
+  8020f0:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8020f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020f8:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8020fd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802101:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802108:	48 85 ff             	test   %rdi,%rdi
+  80210b:	74 2b                	je     802138 <vsnprintf+0x4c>
+  80210d:	48 85 f6             	test   %rsi,%rsi
+  802110:	74 26                	je     802138 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802112:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802116:	48 bf 7e 19 80 00 00 	movabs $0x80197e,%rdi
+  80211d:	00 00 00 
+  802120:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80212c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802130:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802133:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802138:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80213d:	eb f7                	jmp    802136 <vsnprintf+0x4a>
+
+000000000080213f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80213f:	55                   	push   %rbp
+  802140:	48 89 e5             	mov    %rsp,%rbp
+  802143:	48 83 ec 50          	sub    $0x50,%rsp
+  802147:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80214b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80214f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802153:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80215a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80215e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802162:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802166:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80216a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80216e:	48 b8 ec 20 80 00 00 	movabs $0x8020ec,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80217a:	c9                   	leave
+  80217b:	c3                   	ret
+
+000000000080217c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80217c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80217f:	74 10                	je     802191 <strlen+0x15>
+    size_t n = 0;
+  802181:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802186:	48 83 c0 01          	add    $0x1,%rax
+  80218a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80218e:	75 f6                	jne    802186 <strlen+0xa>
+  802190:	c3                   	ret
+    size_t n = 0;
+  802191:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802196:	c3                   	ret
+
+0000000000802197 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802197:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80219a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80219f:	48 85 f6             	test   %rsi,%rsi
+  8021a2:	74 11                	je     8021b5 <strnlen+0x1e>
+  8021a4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8021a8:	74 0c                	je     8021b6 <strnlen+0x1f>
+  8021aa:	48 83 c2 01          	add    $0x1,%rdx
+  8021ae:	48 39 d0             	cmp    %rdx,%rax
+  8021b1:	75 f1                	jne    8021a4 <strnlen+0xd>
+  8021b3:	eb 04                	jmp    8021b9 <strnlen+0x22>
+  8021b5:	c3                   	ret
+  8021b6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8021b9:	c3                   	ret
+
+00000000008021ba <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8021ba:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8021bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8021c6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8021c9:	48 83 c2 01          	add    $0x1,%rdx
+  8021cd:	84 c9                	test   %cl,%cl
+  8021cf:	75 f1                	jne    8021c2 <strcpy+0x8>
+        ;
+    return res;
+}
+  8021d1:	c3                   	ret
+
+00000000008021d2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8021d2:	55                   	push   %rbp
+  8021d3:	48 89 e5             	mov    %rsp,%rbp
+  8021d6:	41 54                	push   %r12
+  8021d8:	53                   	push   %rbx
+  8021d9:	48 89 fb             	mov    %rdi,%rbx
+  8021dc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8021df:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  8021e6:	00 00 00 
+  8021e9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8021eb:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8021ef:	4c 89 e6             	mov    %r12,%rsi
+  8021f2:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+    return dst;
+}
+  8021fe:	48 89 d8             	mov    %rbx,%rax
+  802201:	5b                   	pop    %rbx
+  802202:	41 5c                	pop    %r12
+  802204:	5d                   	pop    %rbp
+  802205:	c3                   	ret
+
+0000000000802206 <toupper>:
+
+int
+toupper(int ch) {
+  802206:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802208:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80220b:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80220e:	83 f9 1a             	cmp    $0x1a,%ecx
+  802211:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802214:	c3                   	ret
+
+0000000000802215 <tolower>:
+
+int
+tolower(int ch) {
+  802215:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802217:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80221a:	8d 57 20             	lea    0x20(%rdi),%edx
+  80221d:	83 f9 1a             	cmp    $0x1a,%ecx
+  802220:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802223:	c3                   	ret
+
+0000000000802224 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802224:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802227:	48 85 d2             	test   %rdx,%rdx
+  80222a:	74 1f                	je     80224b <strncpy+0x27>
+  80222c:	48 01 fa             	add    %rdi,%rdx
+  80222f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802232:	48 83 c1 01          	add    $0x1,%rcx
+  802236:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80223a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80223e:	41 80 f8 01          	cmp    $0x1,%r8b
+  802242:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802246:	48 39 ca             	cmp    %rcx,%rdx
+  802249:	75 e7                	jne    802232 <strncpy+0xe>
+    }
+    return ret;
+}
+  80224b:	c3                   	ret
+
+000000000080224c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80224c:	48 89 f8             	mov    %rdi,%rax
+  80224f:	48 85 d2             	test   %rdx,%rdx
+  802252:	74 24                	je     802278 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802254:	48 83 ea 01          	sub    $0x1,%rdx
+  802258:	74 1b                	je     802275 <strlcpy+0x29>
+  80225a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80225e:	0f b6 16             	movzbl (%rsi),%edx
+  802261:	84 d2                	test   %dl,%dl
+  802263:	74 10                	je     802275 <strlcpy+0x29>
+            *dst++ = *src++;
+  802265:	48 83 c6 01          	add    $0x1,%rsi
+  802269:	48 83 c0 01          	add    $0x1,%rax
+  80226d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802270:	48 39 c8             	cmp    %rcx,%rax
+  802273:	75 e9                	jne    80225e <strlcpy+0x12>
+        *dst = '\0';
+  802275:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802278:	48 29 f8             	sub    %rdi,%rax
+}
+  80227b:	c3                   	ret
+
+000000000080227c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80227c:	0f b6 07             	movzbl (%rdi),%eax
+  80227f:	84 c0                	test   %al,%al
+  802281:	74 13                	je     802296 <strcmp+0x1a>
+  802283:	38 06                	cmp    %al,(%rsi)
+  802285:	75 0f                	jne    802296 <strcmp+0x1a>
+  802287:	48 83 c7 01          	add    $0x1,%rdi
+  80228b:	48 83 c6 01          	add    $0x1,%rsi
+  80228f:	0f b6 07             	movzbl (%rdi),%eax
+  802292:	84 c0                	test   %al,%al
+  802294:	75 ed                	jne    802283 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802296:	0f b6 c0             	movzbl %al,%eax
+  802299:	0f b6 16             	movzbl (%rsi),%edx
+  80229c:	29 d0                	sub    %edx,%eax
+}
+  80229e:	c3                   	ret
+
+000000000080229f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80229f:	48 85 d2             	test   %rdx,%rdx
+  8022a2:	74 1f                	je     8022c3 <strncmp+0x24>
+  8022a4:	0f b6 07             	movzbl (%rdi),%eax
+  8022a7:	84 c0                	test   %al,%al
+  8022a9:	74 1e                	je     8022c9 <strncmp+0x2a>
+  8022ab:	3a 06                	cmp    (%rsi),%al
+  8022ad:	75 1a                	jne    8022c9 <strncmp+0x2a>
+  8022af:	48 83 c7 01          	add    $0x1,%rdi
+  8022b3:	48 83 c6 01          	add    $0x1,%rsi
+  8022b7:	48 83 ea 01          	sub    $0x1,%rdx
+  8022bb:	75 e7                	jne    8022a4 <strncmp+0x5>
+
+    if (!n) return 0;
+  8022bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c2:	c3                   	ret
+  8022c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c8:	c3                   	ret
+  8022c9:	48 85 d2             	test   %rdx,%rdx
+  8022cc:	74 09                	je     8022d7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022ce:	0f b6 07             	movzbl (%rdi),%eax
+  8022d1:	0f b6 16             	movzbl (%rsi),%edx
+  8022d4:	29 d0                	sub    %edx,%eax
+  8022d6:	c3                   	ret
+    if (!n) return 0;
+  8022d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022dc:	c3                   	ret
+
+00000000008022dd <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8022dd:	0f b6 17             	movzbl (%rdi),%edx
+  8022e0:	84 d2                	test   %dl,%dl
+  8022e2:	74 18                	je     8022fc <strchr+0x1f>
+        if (*str == c) {
+  8022e4:	0f be d2             	movsbl %dl,%edx
+  8022e7:	39 f2                	cmp    %esi,%edx
+  8022e9:	74 17                	je     802302 <strchr+0x25>
+    for (; *str; str++) {
+  8022eb:	48 83 c7 01          	add    $0x1,%rdi
+  8022ef:	0f b6 17             	movzbl (%rdi),%edx
+  8022f2:	84 d2                	test   %dl,%dl
+  8022f4:	75 ee                	jne    8022e4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8022f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fb:	c3                   	ret
+  8022fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802301:	c3                   	ret
+  802302:	48 89 f8             	mov    %rdi,%rax
+}
+  802305:	c3                   	ret
+
+0000000000802306 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802306:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802309:	0f b6 17             	movzbl (%rdi),%edx
+  80230c:	84 d2                	test   %dl,%dl
+  80230e:	74 13                	je     802323 <strfind+0x1d>
+  802310:	0f be d2             	movsbl %dl,%edx
+  802313:	39 f2                	cmp    %esi,%edx
+  802315:	74 0b                	je     802322 <strfind+0x1c>
+  802317:	48 83 c0 01          	add    $0x1,%rax
+  80231b:	0f b6 10             	movzbl (%rax),%edx
+  80231e:	84 d2                	test   %dl,%dl
+  802320:	75 ee                	jne    802310 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802322:	c3                   	ret
+  802323:	c3                   	ret
+
+0000000000802324 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802324:	48 39 f7             	cmp    %rsi,%rdi
+  802327:	74 65                	je     80238e <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802329:	55                   	push   %rbp
+  80232a:	48 89 e5             	mov    %rsp,%rbp
+  80232d:	41 57                	push   %r15
+  80232f:	41 56                	push   %r14
+  802331:	41 55                	push   %r13
+  802333:	41 54                	push   %r12
+  802335:	53                   	push   %rbx
+  802336:	48 83 ec 18          	sub    $0x18,%rsp
+  80233a:	48 89 fb             	mov    %rdi,%rbx
+  80233d:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802340:	49 bf 15 22 80 00 00 	movabs $0x802215,%r15
+  802347:	00 00 00 
+  80234a:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80234e:	41 0f b6 fd          	movzbl %r13b,%edi
+  802352:	41 ff d7             	call   *%r15
+  802355:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802358:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80235d:	41 0f b6 fe          	movzbl %r14b,%edi
+  802361:	41 ff d7             	call   *%r15
+  802364:	89 c2                	mov    %eax,%edx
+  802366:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802369:	29 d0                	sub    %edx,%eax
+  80236b:	75 12                	jne    80237f <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80236d:	48 83 c3 01          	add    $0x1,%rbx
+  802371:	45 84 ed             	test   %r13b,%r13b
+  802374:	74 09                	je     80237f <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802376:	49 83 c4 01          	add    $0x1,%r12
+  80237a:	45 84 f6             	test   %r14b,%r14b
+  80237d:	75 cb                	jne    80234a <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80237f:	48 83 c4 18          	add    $0x18,%rsp
+  802383:	5b                   	pop    %rbx
+  802384:	41 5c                	pop    %r12
+  802386:	41 5d                	pop    %r13
+  802388:	41 5e                	pop    %r14
+  80238a:	41 5f                	pop    %r15
+  80238c:	5d                   	pop    %rbp
+  80238d:	c3                   	ret
+    if (p1 == p2) return 0;
+  80238e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802393:	c3                   	ret
+
+0000000000802394 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802394:	48 39 f7             	cmp    %rsi,%rdi
+  802397:	74 7d                	je     802416 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802399:	55                   	push   %rbp
+  80239a:	48 89 e5             	mov    %rsp,%rbp
+  80239d:	41 57                	push   %r15
+  80239f:	41 56                	push   %r14
+  8023a1:	41 55                	push   %r13
+  8023a3:	41 54                	push   %r12
+  8023a5:	53                   	push   %rbx
+  8023a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8023aa:	48 89 fb             	mov    %rdi,%rbx
+  8023ad:	49 89 f4             	mov    %rsi,%r12
+  8023b0:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8023b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023b8:	49 bf 15 22 80 00 00 	movabs $0x802215,%r15
+  8023bf:	00 00 00 
+    while (n--) {
+  8023c2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023c6:	48 39 c3             	cmp    %rax,%rbx
+  8023c9:	74 37                	je     802402 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023cb:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8023cf:	41 0f b6 fd          	movzbl %r13b,%edi
+  8023d3:	41 ff d7             	call   *%r15
+  8023d6:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8023d9:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8023de:	41 0f b6 fe          	movzbl %r14b,%edi
+  8023e2:	41 ff d7             	call   *%r15
+  8023e5:	89 c2                	mov    %eax,%edx
+  8023e7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8023ea:	29 d0                	sub    %edx,%eax
+  8023ec:	75 19                	jne    802407 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8023ee:	48 83 c3 01          	add    $0x1,%rbx
+  8023f2:	45 84 ed             	test   %r13b,%r13b
+  8023f5:	74 10                	je     802407 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8023f7:	49 83 c4 01          	add    $0x1,%r12
+  8023fb:	45 84 f6             	test   %r14b,%r14b
+  8023fe:	75 c2                	jne    8023c2 <strncasecmp+0x2e>
+  802400:	eb 05                	jmp    802407 <strncasecmp+0x73>
+  802402:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802407:	48 83 c4 18          	add    $0x18,%rsp
+  80240b:	5b                   	pop    %rbx
+  80240c:	41 5c                	pop    %r12
+  80240e:	41 5d                	pop    %r13
+  802410:	41 5e                	pop    %r14
+  802412:	41 5f                	pop    %r15
+  802414:	5d                   	pop    %rbp
+  802415:	c3                   	ret
+    if (p1 == p2) return 0;
+  802416:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80241b:	c3                   	ret
+
+000000000080241c <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80241c:	83 e7 df             	and    $0xffffffdf,%edi
+  80241f:	83 ef 41             	sub    $0x41,%edi
+  802422:	83 ff 19             	cmp    $0x19,%edi
+  802425:	0f 96 c0             	setbe  %al
+}
+  802428:	c3                   	ret
+
+0000000000802429 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802429:	83 ff 20             	cmp    $0x20,%edi
+  80242c:	0f 94 c0             	sete   %al
+  80242f:	83 ff 09             	cmp    $0x9,%edi
+  802432:	0f 94 c2             	sete   %dl
+  802435:	09 d0                	or     %edx,%eax
+}
+  802437:	c3                   	ret
+
+0000000000802438 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802438:	55                   	push   %rbp
+  802439:	48 89 e5             	mov    %rsp,%rbp
+  80243c:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80243e:	48 bf 5f 64 80 00 00 	movabs $0x80645f,%rdi
+  802445:	00 00 00 
+  802448:	48 b8 dd 22 80 00 00 	movabs $0x8022dd,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	48 85 c0             	test   %rax,%rax
+  802457:	0f 95 c0             	setne  %al
+}
+  80245a:	5d                   	pop    %rbp
+  80245b:	c3                   	ret
+
+000000000080245c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80245c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80245f:	48 89 f8             	mov    %rdi,%rax
+  802462:	48 f7 d8             	neg    %rax
+  802465:	83 e0 07             	and    $0x7,%eax
+  802468:	49 89 d1             	mov    %rdx,%r9
+  80246b:	49 29 c1             	sub    %rax,%r9
+  80246e:	78 36                	js     8024a6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802470:	40 0f b6 c6          	movzbl %sil,%eax
+  802474:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80247b:	01 01 01 
+  80247e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802482:	40 f6 c7 07          	test   $0x7,%dil
+  802486:	75 38                	jne    8024c0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802488:	4c 89 c9             	mov    %r9,%rcx
+  80248b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80248f:	74 0c                	je     80249d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802491:	fc                   	cld
+  802492:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802495:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802499:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80249d:	4d 85 c9             	test   %r9,%r9
+  8024a0:	75 45                	jne    8024e7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8024a2:	4c 89 c0             	mov    %r8,%rax
+  8024a5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8024a6:	48 85 d2             	test   %rdx,%rdx
+  8024a9:	74 f7                	je     8024a2 <memset+0x46>
+  8024ab:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8024ae:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8024b1:	48 83 c0 01          	add    $0x1,%rax
+  8024b5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8024b9:	48 39 c2             	cmp    %rax,%rdx
+  8024bc:	75 f3                	jne    8024b1 <memset+0x55>
+  8024be:	eb e2                	jmp    8024a2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8024c0:	40 f6 c7 01          	test   $0x1,%dil
+  8024c4:	74 06                	je     8024cc <memset+0x70>
+  8024c6:	88 07                	mov    %al,(%rdi)
+  8024c8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8024cc:	40 f6 c7 02          	test   $0x2,%dil
+  8024d0:	74 07                	je     8024d9 <memset+0x7d>
+  8024d2:	66 89 07             	mov    %ax,(%rdi)
+  8024d5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024d9:	40 f6 c7 04          	test   $0x4,%dil
+  8024dd:	74 a9                	je     802488 <memset+0x2c>
+  8024df:	89 07                	mov    %eax,(%rdi)
+  8024e1:	48 83 c7 04          	add    $0x4,%rdi
+  8024e5:	eb a1                	jmp    802488 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024e7:	41 f6 c1 04          	test   $0x4,%r9b
+  8024eb:	74 06                	je     8024f3 <memset+0x97>
+  8024ed:	89 07                	mov    %eax,(%rdi)
+  8024ef:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8024f3:	41 f6 c1 02          	test   $0x2,%r9b
+  8024f7:	74 07                	je     802500 <memset+0xa4>
+  8024f9:	66 89 07             	mov    %ax,(%rdi)
+  8024fc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802500:	41 f6 c1 01          	test   $0x1,%r9b
+  802504:	74 9c                	je     8024a2 <memset+0x46>
+  802506:	88 07                	mov    %al,(%rdi)
+  802508:	eb 98                	jmp    8024a2 <memset+0x46>
+
+000000000080250a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80250a:	48 89 f8             	mov    %rdi,%rax
+  80250d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802510:	48 39 fe             	cmp    %rdi,%rsi
+  802513:	73 3b                	jae    802550 <memmove+0x46>
+  802515:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802519:	48 39 d7             	cmp    %rdx,%rdi
+  80251c:	73 32                	jae    802550 <memmove+0x46>
+        s += n;
+        d += n;
+  80251e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802522:	48 89 d6             	mov    %rdx,%rsi
+  802525:	48 09 fe             	or     %rdi,%rsi
+  802528:	48 09 ce             	or     %rcx,%rsi
+  80252b:	40 f6 c6 07          	test   $0x7,%sil
+  80252f:	75 12                	jne    802543 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802531:	48 83 ef 08          	sub    $0x8,%rdi
+  802535:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802539:	48 c1 e9 03          	shr    $0x3,%rcx
+  80253d:	fd                   	std
+  80253e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802541:	fc                   	cld
+  802542:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802543:	48 83 ef 01          	sub    $0x1,%rdi
+  802547:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80254b:	fd                   	std
+  80254c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80254e:	eb f1                	jmp    802541 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802550:	48 89 f2             	mov    %rsi,%rdx
+  802553:	48 09 c2             	or     %rax,%rdx
+  802556:	48 09 ca             	or     %rcx,%rdx
+  802559:	f6 c2 07             	test   $0x7,%dl
+  80255c:	75 0c                	jne    80256a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80255e:	48 c1 e9 03          	shr    $0x3,%rcx
+  802562:	48 89 c7             	mov    %rax,%rdi
+  802565:	fc                   	cld
+  802566:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802569:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80256a:	48 89 c7             	mov    %rax,%rdi
+  80256d:	fc                   	cld
+  80256e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802570:	c3                   	ret
+
+0000000000802571 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802571:	55                   	push   %rbp
+  802572:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802575:	48 b8 0a 25 80 00 00 	movabs $0x80250a,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+}
+  802581:	5d                   	pop    %rbp
+  802582:	c3                   	ret
+
+0000000000802583 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802583:	55                   	push   %rbp
+  802584:	48 89 e5             	mov    %rsp,%rbp
+  802587:	41 57                	push   %r15
+  802589:	41 56                	push   %r14
+  80258b:	41 55                	push   %r13
+  80258d:	41 54                	push   %r12
+  80258f:	53                   	push   %rbx
+  802590:	48 83 ec 08          	sub    $0x8,%rsp
+  802594:	49 89 fe             	mov    %rdi,%r14
+  802597:	49 89 f7             	mov    %rsi,%r15
+  80259a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80259d:	48 89 f7             	mov    %rsi,%rdi
+  8025a0:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  8025a7:	00 00 00 
+  8025aa:	ff d0                	call   *%rax
+  8025ac:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8025af:	48 89 de             	mov    %rbx,%rsi
+  8025b2:	4c 89 f7             	mov    %r14,%rdi
+  8025b5:	48 b8 97 21 80 00 00 	movabs $0x802197,%rax
+  8025bc:	00 00 00 
+  8025bf:	ff d0                	call   *%rax
+  8025c1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025c4:	48 39 c3             	cmp    %rax,%rbx
+  8025c7:	74 36                	je     8025ff <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8025c9:	48 89 d8             	mov    %rbx,%rax
+  8025cc:	4c 29 e8             	sub    %r13,%rax
+  8025cf:	49 39 c4             	cmp    %rax,%r12
+  8025d2:	73 31                	jae    802605 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8025d4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8025d9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8025dd:	4c 89 fe             	mov    %r15,%rsi
+  8025e0:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  8025e7:	00 00 00 
+  8025ea:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8025ec:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8025f0:	48 83 c4 08          	add    $0x8,%rsp
+  8025f4:	5b                   	pop    %rbx
+  8025f5:	41 5c                	pop    %r12
+  8025f7:	41 5d                	pop    %r13
+  8025f9:	41 5e                	pop    %r14
+  8025fb:	41 5f                	pop    %r15
+  8025fd:	5d                   	pop    %rbp
+  8025fe:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025ff:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802603:	eb eb                	jmp    8025f0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802605:	48 83 eb 01          	sub    $0x1,%rbx
+  802609:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80260d:	48 89 da             	mov    %rbx,%rdx
+  802610:	4c 89 fe             	mov    %r15,%rsi
+  802613:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  80261a:	00 00 00 
+  80261d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80261f:	49 01 de             	add    %rbx,%r14
+  802622:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802627:	eb c3                	jmp    8025ec <strlcat+0x69>
+
+0000000000802629 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802629:	48 85 d2             	test   %rdx,%rdx
+  80262c:	74 2d                	je     80265b <memcmp+0x32>
+  80262e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802633:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802637:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80263c:	44 38 c1             	cmp    %r8b,%cl
+  80263f:	75 0f                	jne    802650 <memcmp+0x27>
+    while (n-- > 0) {
+  802641:	48 83 c0 01          	add    $0x1,%rax
+  802645:	48 39 c2             	cmp    %rax,%rdx
+  802648:	75 e9                	jne    802633 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802650:	0f b6 c1             	movzbl %cl,%eax
+  802653:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802657:	44 29 c0             	sub    %r8d,%eax
+  80265a:	c3                   	ret
+    return 0;
+  80265b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802660:	c3                   	ret
+
+0000000000802661 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802661:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802665:	48 39 c7             	cmp    %rax,%rdi
+  802668:	73 0f                	jae    802679 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80266a:	40 38 37             	cmp    %sil,(%rdi)
+  80266d:	74 0e                	je     80267d <memfind+0x1c>
+    for (; src < end; src++) {
+  80266f:	48 83 c7 01          	add    $0x1,%rdi
+  802673:	48 39 f8             	cmp    %rdi,%rax
+  802676:	75 f2                	jne    80266a <memfind+0x9>
+  802678:	c3                   	ret
+  802679:	48 89 f8             	mov    %rdi,%rax
+  80267c:	c3                   	ret
+  80267d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802680:	c3                   	ret
+
+0000000000802681 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802681:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802684:	0f b6 37             	movzbl (%rdi),%esi
+  802687:	40 80 fe 20          	cmp    $0x20,%sil
+  80268b:	74 06                	je     802693 <strtol+0x12>
+  80268d:	40 80 fe 09          	cmp    $0x9,%sil
+  802691:	75 13                	jne    8026a6 <strtol+0x25>
+  802693:	48 83 c7 01          	add    $0x1,%rdi
+  802697:	0f b6 37             	movzbl (%rdi),%esi
+  80269a:	40 80 fe 20          	cmp    $0x20,%sil
+  80269e:	74 f3                	je     802693 <strtol+0x12>
+  8026a0:	40 80 fe 09          	cmp    $0x9,%sil
+  8026a4:	74 ed                	je     802693 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8026a6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8026a9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8026ac:	3c 01                	cmp    $0x1,%al
+  8026ae:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026b2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8026b8:	75 0f                	jne    8026c9 <strtol+0x48>
+  8026ba:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8026bd:	74 14                	je     8026d3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8026bf:	85 d2                	test   %edx,%edx
+  8026c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026c6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8026c9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8026ce:	4c 63 ca             	movslq %edx,%r9
+  8026d1:	eb 36                	jmp    802709 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026d3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8026d7:	74 0f                	je     8026e8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8026d9:	85 d2                	test   %edx,%edx
+  8026db:	75 ec                	jne    8026c9 <strtol+0x48>
+        s++;
+  8026dd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8026e1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8026e6:	eb e1                	jmp    8026c9 <strtol+0x48>
+        s += 2;
+  8026e8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8026ec:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8026f1:	eb d6                	jmp    8026c9 <strtol+0x48>
+            dig -= '0';
+  8026f3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8026f6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8026fa:	41 39 d0             	cmp    %edx,%r8d
+  8026fd:	7d 21                	jge    802720 <strtol+0x9f>
+        val = val * base + dig;
+  8026ff:	49 0f af c1          	imul   %r9,%rax
+  802703:	0f b6 c9             	movzbl %cl,%ecx
+  802706:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802709:	48 83 c7 01          	add    $0x1,%rdi
+  80270d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802711:	80 f9 39             	cmp    $0x39,%cl
+  802714:	76 dd                	jbe    8026f3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802716:	80 f9 7b             	cmp    $0x7b,%cl
+  802719:	77 05                	ja     802720 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80271b:	83 e9 57             	sub    $0x57,%ecx
+  80271e:	eb d6                	jmp    8026f6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802720:	4d 85 d2             	test   %r10,%r10
+  802723:	74 03                	je     802728 <strtol+0xa7>
+  802725:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802728:	48 89 c2             	mov    %rax,%rdx
+  80272b:	48 f7 da             	neg    %rdx
+  80272e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802732:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802736:	c3                   	ret
+
+0000000000802737 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802737:	55                   	push   %rbp
+  802738:	48 89 e5             	mov    %rsp,%rbp
+  80273b:	53                   	push   %rbx
+  80273c:	48 89 fa             	mov    %rdi,%rdx
+  80273f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802742:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802747:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80274c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802751:	be 00 00 00 00       	mov    $0x0,%esi
+  802756:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80275c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802762:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802764:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802768:	c9                   	leave
+  802769:	c3                   	ret
+
+000000000080276a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80276a:	55                   	push   %rbp
+  80276b:	48 89 e5             	mov    %rsp,%rbp
+  80276e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80276f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802774:	ba 00 00 00 00       	mov    $0x0,%edx
+  802779:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80277e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802783:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802788:	be 00 00 00 00       	mov    $0x0,%esi
+  80278d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802793:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802799:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80279b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80279f:	c9                   	leave
+  8027a0:	c3                   	ret
+
+00000000008027a1 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8027a1:	55                   	push   %rbp
+  8027a2:	48 89 e5             	mov    %rsp,%rbp
+  8027a5:	53                   	push   %rbx
+  8027a6:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ce:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8027d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+
+00000000008027d6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8027d6:	55                   	push   %rbp
+  8027d7:	48 89 e5             	mov    %rsp,%rbp
+  8027da:	53                   	push   %rbx
+  8027db:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8027df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027e2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802801:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802807:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802809:	48 85 c0             	test   %rax,%rax
+  80280c:	7f 06                	jg     802814 <sys_env_destroy+0x3e>
+}
+  80280e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802814:	49 89 c0             	mov    %rax,%r8
+  802817:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80281c:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802823:	00 00 00 
+  802826:	be 27 00 00 00       	mov    $0x27,%esi
+  80282b:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802832:	00 00 00 
+  802835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283a:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802841:	00 00 00 
+  802844:	41 ff d1             	call   *%r9
+
+0000000000802847 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802847:	55                   	push   %rbp
+  802848:	48 89 e5             	mov    %rsp,%rbp
+  80284b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80284c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802851:	ba 00 00 00 00       	mov    $0x0,%edx
+  802856:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80285b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802860:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802865:	be 00 00 00 00       	mov    $0x0,%esi
+  80286a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802870:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802876:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802878:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80287c:	c9                   	leave
+  80287d:	c3                   	ret
+
+000000000080287e <sys_yield>:
+
+void
+sys_yield(void) {
+  80287e:	55                   	push   %rbp
+  80287f:	48 89 e5             	mov    %rsp,%rbp
+  802882:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802883:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802888:	ba 00 00 00 00       	mov    $0x0,%edx
+  80288d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802892:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802897:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80289c:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ad:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+00000000008028b5 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8028b5:	55                   	push   %rbp
+  8028b6:	48 89 e5             	mov    %rsp,%rbp
+  8028b9:	53                   	push   %rbx
+  8028ba:	48 89 fa             	mov    %rdi,%rdx
+  8028bd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028c0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028c5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8028cc:	00 00 00 
+  8028cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028e5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8028e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028eb:	c9                   	leave
+  8028ec:	c3                   	ret
+
+00000000008028ed <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8028ed:	55                   	push   %rbp
+  8028ee:	48 89 e5             	mov    %rsp,%rbp
+  8028f1:	53                   	push   %rbx
+  8028f2:	49 89 f8             	mov    %rdi,%r8
+  8028f5:	48 89 d3             	mov    %rdx,%rbx
+  8028f8:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8028fb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802900:	4c 89 c2             	mov    %r8,%rdx
+  802903:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802906:	be 00 00 00 00       	mov    $0x0,%esi
+  80290b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802911:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802917:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802919:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80291d:	c9                   	leave
+  80291e:	c3                   	ret
+
+000000000080291f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80291f:	55                   	push   %rbp
+  802920:	48 89 e5             	mov    %rsp,%rbp
+  802923:	53                   	push   %rbx
+  802924:	48 83 ec 08          	sub    $0x8,%rsp
+  802928:	89 f8                	mov    %edi,%eax
+  80292a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80292d:	48 63 f9             	movslq %ecx,%rdi
+  802930:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802933:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802938:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80293b:	be 00 00 00 00       	mov    $0x0,%esi
+  802940:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802946:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80294c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80294e:	48 85 c0             	test   %rax,%rax
+  802951:	7f 06                	jg     802959 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802953:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802957:	c9                   	leave
+  802958:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802959:	49 89 c0             	mov    %rax,%r8
+  80295c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802961:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802968:	00 00 00 
+  80296b:	be 27 00 00 00       	mov    $0x27,%esi
+  802970:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802977:	00 00 00 
+  80297a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297f:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802986:	00 00 00 
+  802989:	41 ff d1             	call   *%r9
+
+000000000080298c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80298c:	55                   	push   %rbp
+  80298d:	48 89 e5             	mov    %rsp,%rbp
+  802990:	53                   	push   %rbx
+  802991:	48 83 ec 08          	sub    $0x8,%rsp
+  802995:	89 f8                	mov    %edi,%eax
+  802997:	49 89 f2             	mov    %rsi,%r10
+  80299a:	48 89 cf             	mov    %rcx,%rdi
+  80299d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8029a0:	48 63 da             	movslq %edx,%rbx
+  8029a3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029a6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029ab:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ae:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8029b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029b9:	48 85 c0             	test   %rax,%rax
+  8029bc:	7f 06                	jg     8029c4 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8029be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029c4:	49 89 c0             	mov    %rax,%r8
+  8029c7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8029cc:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  8029d3:	00 00 00 
+  8029d6:	be 27 00 00 00       	mov    $0x27,%esi
+  8029db:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  8029e2:	00 00 00 
+  8029e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ea:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  8029f1:	00 00 00 
+  8029f4:	41 ff d1             	call   *%r9
+
+00000000008029f7 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8029f7:	55                   	push   %rbp
+  8029f8:	48 89 e5             	mov    %rsp,%rbp
+  8029fb:	53                   	push   %rbx
+  8029fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802a00:	48 89 f1             	mov    %rsi,%rcx
+  802a03:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802a06:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a09:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a13:	be 00 00 00 00       	mov    $0x0,%esi
+  802a18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a24:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a26:	48 85 c0             	test   %rax,%rax
+  802a29:	7f 06                	jg     802a31 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802a2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a2f:	c9                   	leave
+  802a30:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a31:	49 89 c0             	mov    %rax,%r8
+  802a34:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a39:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802a40:	00 00 00 
+  802a43:	be 27 00 00 00       	mov    $0x27,%esi
+  802a48:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802a4f:	00 00 00 
+  802a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a57:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802a5e:	00 00 00 
+  802a61:	41 ff d1             	call   *%r9
+
+0000000000802a64 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a64:	55                   	push   %rbp
+  802a65:	48 89 e5             	mov    %rsp,%rbp
+  802a68:	53                   	push   %rbx
+  802a69:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802a6d:	48 63 ce             	movslq %esi,%rcx
+  802a70:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a73:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a7d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a82:	be 00 00 00 00       	mov    $0x0,%esi
+  802a87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a93:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a95:	48 85 c0             	test   %rax,%rax
+  802a98:	7f 06                	jg     802aa0 <sys_env_set_status+0x3c>
+}
+  802a9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a9e:	c9                   	leave
+  802a9f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802aa0:	49 89 c0             	mov    %rax,%r8
+  802aa3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802aa8:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802aaf:	00 00 00 
+  802ab2:	be 27 00 00 00       	mov    $0x27,%esi
+  802ab7:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802abe:	00 00 00 
+  802ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac6:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802acd:	00 00 00 
+  802ad0:	41 ff d1             	call   *%r9
+
+0000000000802ad3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802ad3:	55                   	push   %rbp
+  802ad4:	48 89 e5             	mov    %rsp,%rbp
+  802ad7:	53                   	push   %rbx
+  802ad8:	48 83 ec 08          	sub    $0x8,%rsp
+  802adc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802adf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ae2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ae7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802af1:	be 00 00 00 00       	mov    $0x0,%esi
+  802af6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802afc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b02:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b04:	48 85 c0             	test   %rax,%rax
+  802b07:	7f 06                	jg     802b0f <sys_env_set_trapframe+0x3c>
+}
+  802b09:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b0d:	c9                   	leave
+  802b0e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b0f:	49 89 c0             	mov    %rax,%r8
+  802b12:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802b17:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802b1e:	00 00 00 
+  802b21:	be 27 00 00 00       	mov    $0x27,%esi
+  802b26:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802b2d:	00 00 00 
+  802b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b35:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802b3c:	00 00 00 
+  802b3f:	41 ff d1             	call   *%r9
+
+0000000000802b42 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802b42:	55                   	push   %rbp
+  802b43:	48 89 e5             	mov    %rsp,%rbp
+  802b46:	53                   	push   %rbx
+  802b47:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802b4e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b51:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b60:	be 00 00 00 00       	mov    $0x0,%esi
+  802b65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b71:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b73:	48 85 c0             	test   %rax,%rax
+  802b76:	7f 06                	jg     802b7e <sys_env_set_pgfault_upcall+0x3c>
+}
+  802b78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7c:	c9                   	leave
+  802b7d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b7e:	49 89 c0             	mov    %rax,%r8
+  802b81:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802b86:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802b8d:	00 00 00 
+  802b90:	be 27 00 00 00       	mov    $0x27,%esi
+  802b95:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802b9c:	00 00 00 
+  802b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba4:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802bab:	00 00 00 
+  802bae:	41 ff d1             	call   *%r9
+
+0000000000802bb1 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802bb1:	55                   	push   %rbp
+  802bb2:	48 89 e5             	mov    %rsp,%rbp
+  802bb5:	53                   	push   %rbx
+  802bb6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802bba:	40 0f b6 ce          	movzbl %sil,%ecx
+  802bbe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc1:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bcb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd0:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bdb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802be1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be3:	48 85 c0             	test   %rax,%rax
+  802be6:	7f 06                	jg     802bee <sys_env_set_reclaim+0x3d>
+}
+  802be8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bec:	c9                   	leave
+  802bed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bee:	49 89 c0             	mov    %rax,%r8
+  802bf1:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802bf6:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802bfd:	00 00 00 
+  802c00:	be 27 00 00 00       	mov    $0x27,%esi
+  802c05:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802c0c:	00 00 00 
+  802c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c14:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802c1b:	00 00 00 
+  802c1e:	41 ff d1             	call   *%r9
+
+0000000000802c21 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802c21:	55                   	push   %rbp
+  802c22:	48 89 e5             	mov    %rsp,%rbp
+  802c25:	53                   	push   %rbx
+  802c26:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802c2a:	48 63 ce             	movslq %esi,%rcx
+  802c2d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c30:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c3a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c3f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c4a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c50:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c52:	48 85 c0             	test   %rax,%rax
+  802c55:	7f 06                	jg     802c5d <sys_env_set_nice+0x3c>
+}
+  802c57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c5b:	c9                   	leave
+  802c5c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5d:	49 89 c0             	mov    %rax,%r8
+  802c60:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802c65:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802c6c:	00 00 00 
+  802c6f:	be 27 00 00 00       	mov    $0x27,%esi
+  802c74:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802c7b:	00 00 00 
+  802c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c83:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802c8a:	00 00 00 
+  802c8d:	41 ff d1             	call   *%r9
+
+0000000000802c90 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802c90:	55                   	push   %rbp
+  802c91:	48 89 e5             	mov    %rsp,%rbp
+  802c94:	53                   	push   %rbx
+  802c95:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c98:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cac:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbd:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802cbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+
+0000000000802cc5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802cc5:	55                   	push   %rbp
+  802cc6:	48 89 e5             	mov    %rsp,%rbp
+  802cc9:	53                   	push   %rbx
+  802cca:	89 f8                	mov    %edi,%eax
+  802ccc:	49 89 f1             	mov    %rsi,%r9
+  802ccf:	48 89 d3             	mov    %rdx,%rbx
+  802cd2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802cd5:	49 63 f0             	movslq %r8d,%rsi
+  802cd8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cdb:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ce0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ce3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ce9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cef:	cd 30                	int    $0x30
+}
+  802cf1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cf5:	c9                   	leave
+  802cf6:	c3                   	ret
+
+0000000000802cf7 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802cf7:	55                   	push   %rbp
+  802cf8:	48 89 e5             	mov    %rsp,%rbp
+  802cfb:	53                   	push   %rbx
+  802cfc:	89 f8                	mov    %edi,%eax
+  802cfe:	49 89 f1             	mov    %rsi,%r9
+  802d01:	48 89 d3             	mov    %rdx,%rbx
+  802d04:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d07:	49 63 f0             	movslq %r8d,%rsi
+  802d0a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d0d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d12:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d21:	cd 30                	int    $0x30
+}
+  802d23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+0000000000802d29 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	53                   	push   %rbx
+  802d2e:	48 83 ec 08          	sub    $0x8,%rsp
+  802d32:	89 f8                	mov    %edi,%eax
+  802d34:	49 89 f2             	mov    %rsi,%r10
+  802d37:	48 89 d3             	mov    %rdx,%rbx
+  802d3a:	48 89 cf             	mov    %rcx,%rdi
+  802d3d:	44 89 c6             	mov    %r8d,%esi
+  802d40:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d43:	48 63 f6             	movslq %esi,%rsi
+  802d46:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d49:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d4e:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d51:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d55:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d57:	48 85 c0             	test   %rax,%rax
+  802d5a:	7f 06                	jg     802d62 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d60:	c9                   	leave
+  802d61:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d62:	49 89 c0             	mov    %rax,%r8
+  802d65:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802d6a:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802d71:	00 00 00 
+  802d74:	be 27 00 00 00       	mov    $0x27,%esi
+  802d79:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802d80:	00 00 00 
+  802d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d88:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802d8f:	00 00 00 
+  802d92:	41 ff d1             	call   *%r9
+
+0000000000802d95 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802d95:	55                   	push   %rbp
+  802d96:	48 89 e5             	mov    %rsp,%rbp
+  802d99:	53                   	push   %rbx
+  802d9a:	48 83 ec 08          	sub    $0x8,%rsp
+  802d9e:	48 89 f1             	mov    %rsi,%rcx
+  802da1:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802da4:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802da8:	48 8b 1a             	mov    (%rdx),%rbx
+  802dab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dae:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802db3:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802db7:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802dbb:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802dbf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dc1:	48 85 c0             	test   %rax,%rax
+  802dc4:	7f 06                	jg     802dcc <sys_ipc_call_short+0x37>
+}
+  802dc6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dca:	c9                   	leave
+  802dcb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dcc:	49 89 c0             	mov    %rax,%r8
+  802dcf:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802dd4:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802ddb:	00 00 00 
+  802dde:	be 27 00 00 00       	mov    $0x27,%esi
+  802de3:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802dea:	00 00 00 
+  802ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df2:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802df9:	00 00 00 
+  802dfc:	41 ff d1             	call   *%r9
+
+0000000000802dff <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802dff:	55                   	push   %rbp
+  802e00:	48 89 e5             	mov    %rsp,%rbp
+  802e03:	53                   	push   %rbx
+  802e04:	48 83 ec 08          	sub    $0x8,%rsp
+  802e08:	89 f8                	mov    %edi,%eax
+  802e0a:	49 89 f2             	mov    %rsi,%r10
+  802e0d:	48 89 d3             	mov    %rdx,%rbx
+  802e10:	48 89 cf             	mov    %rcx,%rdi
+  802e13:	44 89 c6             	mov    %r8d,%esi
+  802e16:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e19:	48 63 f6             	movslq %esi,%rsi
+  802e1c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e1f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e24:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e27:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e2b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e2d:	48 85 c0             	test   %rax,%rax
+  802e30:	7f 06                	jg     802e38 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e36:	c9                   	leave
+  802e37:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e38:	49 89 c0             	mov    %rax,%r8
+  802e3b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802e40:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802e47:	00 00 00 
+  802e4a:	be 27 00 00 00       	mov    $0x27,%esi
+  802e4f:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802e56:	00 00 00 
+  802e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5e:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802e65:	00 00 00 
+  802e68:	41 ff d1             	call   *%r9
+
+0000000000802e6b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802e6b:	55                   	push   %rbp
+  802e6c:	48 89 e5             	mov    %rsp,%rbp
+  802e6f:	53                   	push   %rbx
+  802e70:	48 83 ec 08          	sub    $0x8,%rsp
+  802e74:	48 89 fa             	mov    %rdi,%rdx
+  802e77:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802e7a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e84:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e89:	be 00 00 00 00       	mov    $0x0,%esi
+  802e8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e94:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e9a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e9c:	48 85 c0             	test   %rax,%rax
+  802e9f:	7f 06                	jg     802ea7 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ea1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ea5:	c9                   	leave
+  802ea6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ea7:	49 89 c0             	mov    %rax,%r8
+  802eaa:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802eaf:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802eb6:	00 00 00 
+  802eb9:	be 27 00 00 00       	mov    $0x27,%esi
+  802ebe:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802ec5:	00 00 00 
+  802ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ecd:	49 b9 33 17 80 00 00 	movabs $0x801733,%r9
+  802ed4:	00 00 00 
+  802ed7:	41 ff d1             	call   *%r9
+
+0000000000802eda <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802eda:	55                   	push   %rbp
+  802edb:	48 89 e5             	mov    %rsp,%rbp
+  802ede:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802edf:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ee4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ee9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802eee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ef3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ef8:	be 00 00 00 00       	mov    $0x0,%esi
+  802efd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f03:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f09:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f0b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f0f:	c9                   	leave
+  802f10:	c3                   	ret
+
+0000000000802f11 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802f11:	55                   	push   %rbp
+  802f12:	48 89 e5             	mov    %rsp,%rbp
+  802f15:	53                   	push   %rbx
+  802f16:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f19:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f28:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f38:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f3e:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802f40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f44:	c9                   	leave
+  802f45:	c3                   	ret
+
+0000000000802f46 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802f46:	55                   	push   %rbp
+  802f47:	48 89 e5             	mov    %rsp,%rbp
+  802f4a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f4b:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f55:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f5f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f64:	be 00 00 00 00       	mov    $0x0,%esi
+  802f69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f75:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f7b:	c9                   	leave
+  802f7c:	c3                   	ret
+
+0000000000802f7d <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802f7d:	55                   	push   %rbp
+  802f7e:	48 89 e5             	mov    %rsp,%rbp
+  802f81:	53                   	push   %rbx
+  802f82:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802f86:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f8b:	cd 30                	int    $0x30
+  802f8d:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	0f 88 85 00 00 00    	js     80301c <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  802f97:	0f 84 ac 00 00 00    	je     803049 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  802f9d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802fa3:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802faa:	00 00 00 
+  802fad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fb2:	89 c2                	mov    %eax,%edx
+  802fb4:	be 00 00 00 00       	mov    $0x0,%esi
+  802fb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fbe:	48 b8 8c 29 80 00 00 	movabs $0x80298c,%rax
+  802fc5:	00 00 00 
+  802fc8:	ff d0                	call   *%rax
+  802fca:	85 c0                	test   %eax,%eax
+  802fcc:	0f 88 a8 00 00 00    	js     80307a <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  802fd2:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802fd9:	00 00 00 
+  802fdc:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  802fe3:	89 df                	mov    %ebx,%edi
+  802fe5:	48 b8 42 2b 80 00 00 	movabs $0x802b42,%rax
+  802fec:	00 00 00 
+  802fef:	ff d0                	call   *%rax
+  802ff1:	85 c0                	test   %eax,%eax
+  802ff3:	0f 88 ae 00 00 00    	js     8030a7 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802ff9:	be 02 00 00 00       	mov    $0x2,%esi
+  802ffe:	89 df                	mov    %ebx,%edi
+  803000:	48 b8 64 2a 80 00 00 	movabs $0x802a64,%rax
+  803007:	00 00 00 
+  80300a:	ff d0                	call   *%rax
+  80300c:	85 c0                	test   %eax,%eax
+  80300e:	0f 88 c0 00 00 00    	js     8030d4 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  803014:	89 d8                	mov    %ebx,%eax
+  803016:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80301a:	c9                   	leave
+  80301b:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  80301c:	89 c1                	mov    %eax,%ecx
+  80301e:	48 ba 95 64 80 00 00 	movabs $0x806495,%rdx
+  803025:	00 00 00 
+  803028:	be 20 00 00 00       	mov    $0x20,%esi
+  80302d:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  803034:	00 00 00 
+  803037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303c:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803043:	00 00 00 
+  803046:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803049:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  803050:	00 00 00 
+  803053:	ff d0                	call   *%rax
+  803055:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80305a:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  803061:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803068:	00 00 00 
+  80306b:	48 01 d0             	add    %rdx,%rax
+  80306e:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  803075:	00 00 00 
+        return 0;
+  803078:	eb 9a                	jmp    803014 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  80307a:	89 c1                	mov    %eax,%ecx
+  80307c:	48 ba b0 64 80 00 00 	movabs $0x8064b0,%rdx
+  803083:	00 00 00 
+  803086:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80308b:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  803092:	00 00 00 
+  803095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309a:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  8030a1:	00 00 00 
+  8030a4:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  8030a7:	89 c1                	mov    %eax,%ecx
+  8030a9:	48 ba f8 64 80 00 00 	movabs $0x8064f8,%rdx
+  8030b0:	00 00 00 
+  8030b3:	be 32 00 00 00       	mov    $0x32,%esi
+  8030b8:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  8030bf:	00 00 00 
+  8030c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c7:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  8030ce:	00 00 00 
+  8030d1:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8030d4:	89 c1                	mov    %eax,%ecx
+  8030d6:	48 ba c3 64 80 00 00 	movabs $0x8064c3,%rdx
+  8030dd:	00 00 00 
+  8030e0:	be 37 00 00 00       	mov    $0x37,%esi
+  8030e5:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  8030ec:	00 00 00 
+  8030ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f4:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  8030fb:	00 00 00 
+  8030fe:	41 ff d0             	call   *%r8
+
+0000000000803101 <sfork>:
+
+envid_t
+sfork() {
+  803101:	55                   	push   %rbp
+  803102:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  803105:	48 ba da 64 80 00 00 	movabs $0x8064da,%rdx
+  80310c:	00 00 00 
+  80310f:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803114:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  80311b:	00 00 00 
+  80311e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803123:	48 b9 33 17 80 00 00 	movabs $0x801733,%rcx
+  80312a:	00 00 00 
+  80312d:	ff d1                	call   *%rcx
+
+000000000080312f <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80312f:	85 ff                	test   %edi,%edi
+  803131:	78 58                	js     80318b <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  803133:	48 85 f6             	test   %rsi,%rsi
+  803136:	74 12                	je     80314a <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  803138:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80313f:	00 00 00 
+  803142:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803148:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80314a:	48 85 c9             	test   %rcx,%rcx
+  80314d:	74 12                	je     803161 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80314f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803156:	00 00 00 
+  803159:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80315f:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  803161:	48 85 d2             	test   %rdx,%rdx
+  803164:	74 14                	je     80317a <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  803166:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80316d:	00 00 00 
+  803170:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  803177:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80317a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803181:	00 00 00 
+  803184:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80318a:	c3                   	ret
+        if (from_env_store) {
+  80318b:	48 85 f6             	test   %rsi,%rsi
+  80318e:	74 06                	je     803196 <ipc_result+0x67>
+            *from_env_store = 0;
+  803190:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  803196:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  803198:	48 85 c9             	test   %rcx,%rcx
+  80319b:	74 ed                	je     80318a <ipc_result+0x5b>
+            *perm_store = 0;
+  80319d:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8031a3:	c3                   	ret
+
+00000000008031a4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8031a4:	55                   	push   %rbp
+  8031a5:	48 89 e5             	mov    %rsp,%rbp
+  8031a8:	41 55                	push   %r13
+  8031aa:	41 54                	push   %r12
+  8031ac:	53                   	push   %rbx
+  8031ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8031b1:	49 89 fc             	mov    %rdi,%r12
+  8031b4:	48 89 f7             	mov    %rsi,%rdi
+  8031b7:	48 89 d3             	mov    %rdx,%rbx
+  8031ba:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8031bd:	48 85 f6             	test   %rsi,%rsi
+  8031c0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8031c7:	00 00 00 
+  8031ca:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8031ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8031d3:	48 85 d2             	test   %rdx,%rdx
+  8031d6:	74 03                	je     8031db <ipc_recv+0x37>
+  8031d8:	48 8b 32             	mov    (%rdx),%rsi
+  8031db:	48 b8 6b 2e 80 00 00 	movabs $0x802e6b,%rax
+  8031e2:	00 00 00 
+  8031e5:	ff d0                	call   *%rax
+  8031e7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8031e9:	4c 89 e9             	mov    %r13,%rcx
+  8031ec:	48 89 da             	mov    %rbx,%rdx
+  8031ef:	4c 89 e6             	mov    %r12,%rsi
+  8031f2:	48 b8 2f 31 80 00 00 	movabs $0x80312f,%rax
+  8031f9:	00 00 00 
+  8031fc:	ff d0                	call   *%rax
+}
+  8031fe:	48 83 c4 08          	add    $0x8,%rsp
+  803202:	5b                   	pop    %rbx
+  803203:	41 5c                	pop    %r12
+  803205:	41 5d                	pop    %r13
+  803207:	5d                   	pop    %rbp
+  803208:	c3                   	ret
+
+0000000000803209 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803209:	55                   	push   %rbp
+  80320a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80320d:	48 85 d2             	test   %rdx,%rdx
+  803210:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803217:	00 00 00 
+  80321a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80321e:	89 f6                	mov    %esi,%esi
+  803220:	48 b8 f7 2c 80 00 00 	movabs $0x802cf7,%rax
+  803227:	00 00 00 
+  80322a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80322c:	85 c0                	test   %eax,%eax
+  80322e:	78 02                	js     803232 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  803230:	5d                   	pop    %rbp
+  803231:	c3                   	ret
+        panic("ipc_send: %i", res);
+  803232:	89 c1                	mov    %eax,%ecx
+  803234:	48 ba 17 65 80 00 00 	movabs $0x806517,%rdx
+  80323b:	00 00 00 
+  80323e:	be 4f 00 00 00       	mov    $0x4f,%esi
+  803243:	48 bf 24 65 80 00 00 	movabs $0x806524,%rdi
+  80324a:	00 00 00 
+  80324d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803252:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803259:	00 00 00 
+  80325c:	41 ff d0             	call   *%r8
+
+000000000080325f <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+  803263:	53                   	push   %rbx
+  803264:	48 83 ec 08          	sub    $0x8,%rsp
+  803268:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80326c:	48 85 d2             	test   %rdx,%rdx
+  80326f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803276:	00 00 00 
+  803279:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80327d:	4d 85 c9             	test   %r9,%r9
+  803280:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  803284:	b8 00 00 00 00       	mov    $0x0,%eax
+  803289:	48 85 db             	test   %rbx,%rbx
+  80328c:	74 03                	je     803291 <ipc_call+0x32>
+  80328e:	48 8b 03             	mov    (%rbx),%rax
+  803291:	89 f6                	mov    %esi,%esi
+  803293:	48 83 ec 08          	sub    $0x8,%rsp
+  803297:	50                   	push   %rax
+  803298:	48 b8 29 2d 80 00 00 	movabs $0x802d29,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+  8032a4:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8032a6:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8032aa:	48 89 da             	mov    %rbx,%rdx
+  8032ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8032b2:	48 b8 2f 31 80 00 00 	movabs $0x80312f,%rax
+  8032b9:	00 00 00 
+  8032bc:	ff d0                	call   *%rax
+}
+  8032be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032c2:	c9                   	leave
+  8032c3:	c3                   	ret
+
+00000000008032c4 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8032c4:	55                   	push   %rbp
+  8032c5:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8032c8:	89 f6                	mov    %esi,%esi
+  8032ca:	48 b8 95 2d 80 00 00 	movabs $0x802d95,%rax
+  8032d1:	00 00 00 
+  8032d4:	ff d0                	call   *%rax
+  8032d6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8032d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8032e7:	48 b8 2f 31 80 00 00 	movabs $0x80312f,%rax
+  8032ee:	00 00 00 
+  8032f1:	ff d0                	call   *%rax
+}
+  8032f3:	5d                   	pop    %rbp
+  8032f4:	c3                   	ret
+
+00000000008032f5 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8032f5:	55                   	push   %rbp
+  8032f6:	48 89 e5             	mov    %rsp,%rbp
+  8032f9:	41 54                	push   %r12
+  8032fb:	53                   	push   %rbx
+  8032fc:	4c 89 cb             	mov    %r9,%rbx
+  8032ff:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  803303:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803307:	48 85 d2             	test   %rdx,%rdx
+  80330a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803311:	00 00 00 
+  803314:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803318:	4d 85 c9             	test   %r9,%r9
+  80331b:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80331f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803324:	4d 85 e4             	test   %r12,%r12
+  803327:	74 04                	je     80332d <ipc_reply_wait+0x38>
+  803329:	49 8b 04 24          	mov    (%r12),%rax
+  80332d:	89 f6                	mov    %esi,%esi
+  80332f:	48 83 ec 08          	sub    $0x8,%rsp
+  803333:	50                   	push   %rax
+  803334:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  80333b:	00 00 00 
+  80333e:	ff d0                	call   *%rax
+  803340:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  803342:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  803346:	4c 89 e2             	mov    %r12,%rdx
+  803349:	48 89 de             	mov    %rbx,%rsi
+  80334c:	48 b8 2f 31 80 00 00 	movabs $0x80312f,%rax
+  803353:	00 00 00 
+  803356:	ff d0                	call   *%rax
+}
+  803358:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80335c:	5b                   	pop    %rbx
+  80335d:	41 5c                	pop    %r12
+  80335f:	5d                   	pop    %rbp
+  803360:	c3                   	ret
+
+0000000000803361 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803361:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803366:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80336d:	00 00 00 
+  803370:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  803377:	48 01 ca             	add    %rcx,%rdx
+  80337a:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  803380:	39 fa                	cmp    %edi,%edx
+  803382:	74 12                	je     803396 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803384:	48 83 c0 01          	add    $0x1,%rax
+  803388:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80338e:	75 e0                	jne    803370 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803390:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803395:	c3                   	ret
+            return envs[i].env_id;
+  803396:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80339d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8033a4:	00 00 00 
+  8033a7:	48 01 d0             	add    %rdx,%rax
+  8033aa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8033b0:	c3                   	ret
+
+00000000008033b1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033b1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8033b8:	ff ff ff 
+  8033bb:	48 01 f8             	add    %rdi,%rax
+  8033be:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8033c2:	c3                   	ret
+
+00000000008033c3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033c3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8033ca:	ff ff ff 
+  8033cd:	48 01 f8             	add    %rdi,%rax
+  8033d0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8033d4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8033da:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8033de:	c3                   	ret
+
+00000000008033df <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8033df:	55                   	push   %rbp
+  8033e0:	48 89 e5             	mov    %rsp,%rbp
+  8033e3:	41 57                	push   %r15
+  8033e5:	41 56                	push   %r14
+  8033e7:	41 55                	push   %r13
+  8033e9:	41 54                	push   %r12
+  8033eb:	53                   	push   %rbx
+  8033ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f0:	49 89 ff             	mov    %rdi,%r15
+  8033f3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8033f8:	49 bd df 48 80 00 00 	movabs $0x8048df,%r13
+  8033ff:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803402:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803408:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80340b:	48 89 df             	mov    %rbx,%rdi
+  80340e:	41 ff d5             	call   *%r13
+  803411:	83 e0 04             	and    $0x4,%eax
+  803414:	74 17                	je     80342d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803416:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80341d:	4c 39 f3             	cmp    %r14,%rbx
+  803420:	75 e6                	jne    803408 <fd_alloc+0x29>
+  803422:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803428:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80342d:	4d 89 27             	mov    %r12,(%r15)
+}
+  803430:	48 83 c4 08          	add    $0x8,%rsp
+  803434:	5b                   	pop    %rbx
+  803435:	41 5c                	pop    %r12
+  803437:	41 5d                	pop    %r13
+  803439:	41 5e                	pop    %r14
+  80343b:	41 5f                	pop    %r15
+  80343d:	5d                   	pop    %rbp
+  80343e:	c3                   	ret
+
+000000000080343f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80343f:	83 ff 1f             	cmp    $0x1f,%edi
+  803442:	77 39                	ja     80347d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803444:	55                   	push   %rbp
+  803445:	48 89 e5             	mov    %rsp,%rbp
+  803448:	41 54                	push   %r12
+  80344a:	53                   	push   %rbx
+  80344b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80344e:	48 63 df             	movslq %edi,%rbx
+  803451:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803458:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80345c:	48 89 df             	mov    %rbx,%rdi
+  80345f:	48 b8 df 48 80 00 00 	movabs $0x8048df,%rax
+  803466:	00 00 00 
+  803469:	ff d0                	call   *%rax
+  80346b:	a8 04                	test   $0x4,%al
+  80346d:	74 14                	je     803483 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80346f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803473:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803478:	5b                   	pop    %rbx
+  803479:	41 5c                	pop    %r12
+  80347b:	5d                   	pop    %rbp
+  80347c:	c3                   	ret
+        return -E_INVAL;
+  80347d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803482:	c3                   	ret
+        return -E_INVAL;
+  803483:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803488:	eb ee                	jmp    803478 <fd_lookup+0x39>
+
+000000000080348a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80348a:	55                   	push   %rbp
+  80348b:	48 89 e5             	mov    %rsp,%rbp
+  80348e:	41 54                	push   %r12
+  803490:	53                   	push   %rbx
+  803491:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803494:	48 b8 c0 65 80 00 00 	movabs $0x8065c0,%rax
+  80349b:	00 00 00 
+  80349e:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8034a5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8034a8:	39 3b                	cmp    %edi,(%rbx)
+  8034aa:	74 47                	je     8034f3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8034ac:	48 83 c0 08          	add    $0x8,%rax
+  8034b0:	48 8b 18             	mov    (%rax),%rbx
+  8034b3:	48 85 db             	test   %rbx,%rbx
+  8034b6:	75 f0                	jne    8034a8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8034b8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034bf:	00 00 00 
+  8034c2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034c8:	89 fa                	mov    %edi,%edx
+  8034ca:	48 bf 30 65 80 00 00 	movabs $0x806530,%rdi
+  8034d1:	00 00 00 
+  8034d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d9:	48 b9 83 18 80 00 00 	movabs $0x801883,%rcx
+  8034e0:	00 00 00 
+  8034e3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8034e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8034ea:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8034ee:	5b                   	pop    %rbx
+  8034ef:	41 5c                	pop    %r12
+  8034f1:	5d                   	pop    %rbp
+  8034f2:	c3                   	ret
+            return 0;
+  8034f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f8:	eb f0                	jmp    8034ea <dev_lookup+0x60>
+
+00000000008034fa <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8034fa:	55                   	push   %rbp
+  8034fb:	48 89 e5             	mov    %rsp,%rbp
+  8034fe:	41 55                	push   %r13
+  803500:	41 54                	push   %r12
+  803502:	53                   	push   %rbx
+  803503:	48 83 ec 18          	sub    $0x18,%rsp
+  803507:	48 89 fb             	mov    %rdi,%rbx
+  80350a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80350d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803514:	ff ff ff 
+  803517:	48 01 df             	add    %rbx,%rdi
+  80351a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80351e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803522:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  803529:	00 00 00 
+  80352c:	ff d0                	call   *%rax
+  80352e:	41 89 c5             	mov    %eax,%r13d
+  803531:	85 c0                	test   %eax,%eax
+  803533:	78 06                	js     80353b <fd_close+0x41>
+  803535:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803539:	74 1a                	je     803555 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80353b:	45 84 e4             	test   %r12b,%r12b
+  80353e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803543:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803547:	44 89 e8             	mov    %r13d,%eax
+  80354a:	48 83 c4 18          	add    $0x18,%rsp
+  80354e:	5b                   	pop    %rbx
+  80354f:	41 5c                	pop    %r12
+  803551:	41 5d                	pop    %r13
+  803553:	5d                   	pop    %rbp
+  803554:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803555:	8b 3b                	mov    (%rbx),%edi
+  803557:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80355b:	48 b8 8a 34 80 00 00 	movabs $0x80348a,%rax
+  803562:	00 00 00 
+  803565:	ff d0                	call   *%rax
+  803567:	41 89 c5             	mov    %eax,%r13d
+  80356a:	85 c0                	test   %eax,%eax
+  80356c:	78 1b                	js     803589 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80356e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803572:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803576:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80357c:	48 85 c0             	test   %rax,%rax
+  80357f:	74 08                	je     803589 <fd_close+0x8f>
+  803581:	48 89 df             	mov    %rbx,%rdi
+  803584:	ff d0                	call   *%rax
+  803586:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803589:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80358e:	48 89 de             	mov    %rbx,%rsi
+  803591:	bf 00 00 00 00       	mov    $0x0,%edi
+  803596:	48 b8 f7 29 80 00 00 	movabs $0x8029f7,%rax
+  80359d:	00 00 00 
+  8035a0:	ff d0                	call   *%rax
+    return res;
+  8035a2:	eb a3                	jmp    803547 <fd_close+0x4d>
+
+00000000008035a4 <close>:
+
+int
+close(int fdnum) {
+  8035a4:	55                   	push   %rbp
+  8035a5:	48 89 e5             	mov    %rsp,%rbp
+  8035a8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035ac:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035b0:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  8035b7:	00 00 00 
+  8035ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035bc:	85 c0                	test   %eax,%eax
+  8035be:	78 15                	js     8035d5 <close+0x31>
+
+    return fd_close(fd, 1);
+  8035c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8035c5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035c9:	48 b8 fa 34 80 00 00 	movabs $0x8034fa,%rax
+  8035d0:	00 00 00 
+  8035d3:	ff d0                	call   *%rax
+}
+  8035d5:	c9                   	leave
+  8035d6:	c3                   	ret
+
+00000000008035d7 <close_all>:
+
+void
+close_all(void) {
+  8035d7:	55                   	push   %rbp
+  8035d8:	48 89 e5             	mov    %rsp,%rbp
+  8035db:	41 54                	push   %r12
+  8035dd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8035de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035e3:	49 bc a4 35 80 00 00 	movabs $0x8035a4,%r12
+  8035ea:	00 00 00 
+  8035ed:	89 df                	mov    %ebx,%edi
+  8035ef:	41 ff d4             	call   *%r12
+  8035f2:	83 c3 01             	add    $0x1,%ebx
+  8035f5:	83 fb 20             	cmp    $0x20,%ebx
+  8035f8:	75 f3                	jne    8035ed <close_all+0x16>
+}
+  8035fa:	5b                   	pop    %rbx
+  8035fb:	41 5c                	pop    %r12
+  8035fd:	5d                   	pop    %rbp
+  8035fe:	c3                   	ret
+
+00000000008035ff <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8035ff:	55                   	push   %rbp
+  803600:	48 89 e5             	mov    %rsp,%rbp
+  803603:	41 57                	push   %r15
+  803605:	41 56                	push   %r14
+  803607:	41 55                	push   %r13
+  803609:	41 54                	push   %r12
+  80360b:	53                   	push   %rbx
+  80360c:	48 83 ec 18          	sub    $0x18,%rsp
+  803610:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803613:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803617:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  80361e:	00 00 00 
+  803621:	ff d0                	call   *%rax
+  803623:	89 c3                	mov    %eax,%ebx
+  803625:	85 c0                	test   %eax,%eax
+  803627:	0f 88 b8 00 00 00    	js     8036e5 <dup+0xe6>
+    close(newfdnum);
+  80362d:	44 89 e7             	mov    %r12d,%edi
+  803630:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  803637:	00 00 00 
+  80363a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80363c:	4d 63 ec             	movslq %r12d,%r13
+  80363f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803646:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80364a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80364e:	4c 89 ff             	mov    %r15,%rdi
+  803651:	49 be c3 33 80 00 00 	movabs $0x8033c3,%r14
+  803658:	00 00 00 
+  80365b:	41 ff d6             	call   *%r14
+  80365e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803661:	4c 89 ef             	mov    %r13,%rdi
+  803664:	41 ff d6             	call   *%r14
+  803667:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80366a:	48 89 df             	mov    %rbx,%rdi
+  80366d:	48 b8 df 48 80 00 00 	movabs $0x8048df,%rax
+  803674:	00 00 00 
+  803677:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803679:	a8 04                	test   $0x4,%al
+  80367b:	74 2b                	je     8036a8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80367d:	41 89 c1             	mov    %eax,%r9d
+  803680:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803686:	4c 89 f1             	mov    %r14,%rcx
+  803689:	ba 00 00 00 00       	mov    $0x0,%edx
+  80368e:	48 89 de             	mov    %rbx,%rsi
+  803691:	bf 00 00 00 00       	mov    $0x0,%edi
+  803696:	48 b8 8c 29 80 00 00 	movabs $0x80298c,%rax
+  80369d:	00 00 00 
+  8036a0:	ff d0                	call   *%rax
+  8036a2:	89 c3                	mov    %eax,%ebx
+  8036a4:	85 c0                	test   %eax,%eax
+  8036a6:	78 4e                	js     8036f6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8036a8:	4c 89 ff             	mov    %r15,%rdi
+  8036ab:	48 b8 df 48 80 00 00 	movabs $0x8048df,%rax
+  8036b2:	00 00 00 
+  8036b5:	ff d0                	call   *%rax
+  8036b7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8036ba:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8036c0:	4c 89 e9             	mov    %r13,%rcx
+  8036c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036c8:	4c 89 fe             	mov    %r15,%rsi
+  8036cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036d0:	48 b8 8c 29 80 00 00 	movabs $0x80298c,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+  8036dc:	89 c3                	mov    %eax,%ebx
+  8036de:	85 c0                	test   %eax,%eax
+  8036e0:	78 14                	js     8036f6 <dup+0xf7>
+
+    return newfdnum;
+  8036e2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8036e5:	89 d8                	mov    %ebx,%eax
+  8036e7:	48 83 c4 18          	add    $0x18,%rsp
+  8036eb:	5b                   	pop    %rbx
+  8036ec:	41 5c                	pop    %r12
+  8036ee:	41 5d                	pop    %r13
+  8036f0:	41 5e                	pop    %r14
+  8036f2:	41 5f                	pop    %r15
+  8036f4:	5d                   	pop    %rbp
+  8036f5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8036f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036fb:	4c 89 ee             	mov    %r13,%rsi
+  8036fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803703:	49 bc f7 29 80 00 00 	movabs $0x8029f7,%r12
+  80370a:	00 00 00 
+  80370d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803710:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803715:	4c 89 f6             	mov    %r14,%rsi
+  803718:	bf 00 00 00 00       	mov    $0x0,%edi
+  80371d:	41 ff d4             	call   *%r12
+    return res;
+  803720:	eb c3                	jmp    8036e5 <dup+0xe6>
+
+0000000000803722 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803722:	55                   	push   %rbp
+  803723:	48 89 e5             	mov    %rsp,%rbp
+  803726:	41 56                	push   %r14
+  803728:	41 55                	push   %r13
+  80372a:	41 54                	push   %r12
+  80372c:	53                   	push   %rbx
+  80372d:	48 83 ec 10          	sub    $0x10,%rsp
+  803731:	89 fb                	mov    %edi,%ebx
+  803733:	49 89 f4             	mov    %rsi,%r12
+  803736:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803739:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80373d:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  803744:	00 00 00 
+  803747:	ff d0                	call   *%rax
+  803749:	85 c0                	test   %eax,%eax
+  80374b:	78 4c                	js     803799 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80374d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803751:	41 8b 3e             	mov    (%r14),%edi
+  803754:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803758:	48 b8 8a 34 80 00 00 	movabs $0x80348a,%rax
+  80375f:	00 00 00 
+  803762:	ff d0                	call   *%rax
+  803764:	85 c0                	test   %eax,%eax
+  803766:	78 35                	js     80379d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803768:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80376c:	83 e0 03             	and    $0x3,%eax
+  80376f:	83 f8 01             	cmp    $0x1,%eax
+  803772:	74 2d                	je     8037a1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803774:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803778:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80377c:	48 85 c0             	test   %rax,%rax
+  80377f:	74 56                	je     8037d7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803781:	4c 89 ea             	mov    %r13,%rdx
+  803784:	4c 89 e6             	mov    %r12,%rsi
+  803787:	4c 89 f7             	mov    %r14,%rdi
+  80378a:	ff d0                	call   *%rax
+}
+  80378c:	48 83 c4 10          	add    $0x10,%rsp
+  803790:	5b                   	pop    %rbx
+  803791:	41 5c                	pop    %r12
+  803793:	41 5d                	pop    %r13
+  803795:	41 5e                	pop    %r14
+  803797:	5d                   	pop    %rbp
+  803798:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803799:	48 98                	cltq
+  80379b:	eb ef                	jmp    80378c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80379d:	48 98                	cltq
+  80379f:	eb eb                	jmp    80378c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037a1:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8037a8:	00 00 00 
+  8037ab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8037b1:	89 da                	mov    %ebx,%edx
+  8037b3:	48 bf 71 65 80 00 00 	movabs $0x806571,%rdi
+  8037ba:	00 00 00 
+  8037bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c2:	48 b9 83 18 80 00 00 	movabs $0x801883,%rcx
+  8037c9:	00 00 00 
+  8037cc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8037ce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037d5:	eb b5                	jmp    80378c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8037d7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8037de:	eb ac                	jmp    80378c <read+0x6a>
+
+00000000008037e0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8037e0:	55                   	push   %rbp
+  8037e1:	48 89 e5             	mov    %rsp,%rbp
+  8037e4:	41 57                	push   %r15
+  8037e6:	41 56                	push   %r14
+  8037e8:	41 55                	push   %r13
+  8037ea:	41 54                	push   %r12
+  8037ec:	53                   	push   %rbx
+  8037ed:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8037f1:	48 85 d2             	test   %rdx,%rdx
+  8037f4:	74 54                	je     80384a <readn+0x6a>
+  8037f6:	41 89 fd             	mov    %edi,%r13d
+  8037f9:	49 89 f6             	mov    %rsi,%r14
+  8037fc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8037ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803804:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803809:	49 bf 22 37 80 00 00 	movabs $0x803722,%r15
+  803810:	00 00 00 
+  803813:	4c 89 e2             	mov    %r12,%rdx
+  803816:	48 29 f2             	sub    %rsi,%rdx
+  803819:	4c 01 f6             	add    %r14,%rsi
+  80381c:	44 89 ef             	mov    %r13d,%edi
+  80381f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803822:	85 c0                	test   %eax,%eax
+  803824:	78 20                	js     803846 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803826:	01 c3                	add    %eax,%ebx
+  803828:	85 c0                	test   %eax,%eax
+  80382a:	74 08                	je     803834 <readn+0x54>
+  80382c:	48 63 f3             	movslq %ebx,%rsi
+  80382f:	4c 39 e6             	cmp    %r12,%rsi
+  803832:	72 df                	jb     803813 <readn+0x33>
+    }
+    return res;
+  803834:	48 63 c3             	movslq %ebx,%rax
+}
+  803837:	48 83 c4 08          	add    $0x8,%rsp
+  80383b:	5b                   	pop    %rbx
+  80383c:	41 5c                	pop    %r12
+  80383e:	41 5d                	pop    %r13
+  803840:	41 5e                	pop    %r14
+  803842:	41 5f                	pop    %r15
+  803844:	5d                   	pop    %rbp
+  803845:	c3                   	ret
+        if (inc < 0) return inc;
+  803846:	48 98                	cltq
+  803848:	eb ed                	jmp    803837 <readn+0x57>
+    int inc = 1, res = 0;
+  80384a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80384f:	eb e3                	jmp    803834 <readn+0x54>
+
+0000000000803851 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803851:	55                   	push   %rbp
+  803852:	48 89 e5             	mov    %rsp,%rbp
+  803855:	41 56                	push   %r14
+  803857:	41 55                	push   %r13
+  803859:	41 54                	push   %r12
+  80385b:	53                   	push   %rbx
+  80385c:	48 83 ec 10          	sub    $0x10,%rsp
+  803860:	89 fb                	mov    %edi,%ebx
+  803862:	49 89 f4             	mov    %rsi,%r12
+  803865:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803868:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80386c:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  803873:	00 00 00 
+  803876:	ff d0                	call   *%rax
+  803878:	85 c0                	test   %eax,%eax
+  80387a:	78 47                	js     8038c3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80387c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803880:	41 8b 3e             	mov    (%r14),%edi
+  803883:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803887:	48 b8 8a 34 80 00 00 	movabs $0x80348a,%rax
+  80388e:	00 00 00 
+  803891:	ff d0                	call   *%rax
+  803893:	85 c0                	test   %eax,%eax
+  803895:	78 30                	js     8038c7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803897:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80389c:	74 2d                	je     8038cb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80389e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038a2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8038a6:	48 85 c0             	test   %rax,%rax
+  8038a9:	74 56                	je     803901 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8038ab:	4c 89 ea             	mov    %r13,%rdx
+  8038ae:	4c 89 e6             	mov    %r12,%rsi
+  8038b1:	4c 89 f7             	mov    %r14,%rdi
+  8038b4:	ff d0                	call   *%rax
+}
+  8038b6:	48 83 c4 10          	add    $0x10,%rsp
+  8038ba:	5b                   	pop    %rbx
+  8038bb:	41 5c                	pop    %r12
+  8038bd:	41 5d                	pop    %r13
+  8038bf:	41 5e                	pop    %r14
+  8038c1:	5d                   	pop    %rbp
+  8038c2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038c3:	48 98                	cltq
+  8038c5:	eb ef                	jmp    8038b6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038c7:	48 98                	cltq
+  8038c9:	eb eb                	jmp    8038b6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8038cb:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8038d2:	00 00 00 
+  8038d5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8038db:	89 da                	mov    %ebx,%edx
+  8038dd:	48 bf 8d 65 80 00 00 	movabs $0x80658d,%rdi
+  8038e4:	00 00 00 
+  8038e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ec:	48 b9 83 18 80 00 00 	movabs $0x801883,%rcx
+  8038f3:	00 00 00 
+  8038f6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8038f8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8038ff:	eb b5                	jmp    8038b6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803901:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803908:	eb ac                	jmp    8038b6 <write+0x65>
+
+000000000080390a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80390a:	55                   	push   %rbp
+  80390b:	48 89 e5             	mov    %rsp,%rbp
+  80390e:	53                   	push   %rbx
+  80390f:	48 83 ec 18          	sub    $0x18,%rsp
+  803913:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803915:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803919:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  803920:	00 00 00 
+  803923:	ff d0                	call   *%rax
+  803925:	85 c0                	test   %eax,%eax
+  803927:	78 0c                	js     803935 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803929:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80392d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803930:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803935:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803939:	c9                   	leave
+  80393a:	c3                   	ret
+
+000000000080393b <tell>:
+
+int tell(int fdnum) {
+  80393b:	55                   	push   %rbp
+  80393c:	48 89 e5             	mov    %rsp,%rbp
+  80393f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803943:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803947:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  80394e:	00 00 00 
+  803951:	ff d0                	call   *%rax
+  803953:	85 c0                	test   %eax,%eax
+  803955:	78 07                	js     80395e <tell+0x23>
+
+    return fd->fd_offset;
+  803957:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80395b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80395e:	c9                   	leave
+  80395f:	c3                   	ret
+
+0000000000803960 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803960:	55                   	push   %rbp
+  803961:	48 89 e5             	mov    %rsp,%rbp
+  803964:	41 55                	push   %r13
+  803966:	41 54                	push   %r12
+  803968:	53                   	push   %rbx
+  803969:	48 83 ec 18          	sub    $0x18,%rsp
+  80396d:	89 fb                	mov    %edi,%ebx
+  80396f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803972:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803976:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  80397d:	00 00 00 
+  803980:	ff d0                	call   *%rax
+  803982:	85 c0                	test   %eax,%eax
+  803984:	78 38                	js     8039be <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803986:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80398a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80398e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803992:	48 b8 8a 34 80 00 00 	movabs $0x80348a,%rax
+  803999:	00 00 00 
+  80399c:	ff d0                	call   *%rax
+  80399e:	85 c0                	test   %eax,%eax
+  8039a0:	78 1c                	js     8039be <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8039a2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8039a7:	74 20                	je     8039c9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8039a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039ad:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8039b1:	48 85 c0             	test   %rax,%rax
+  8039b4:	74 47                	je     8039fd <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8039b6:	44 89 e6             	mov    %r12d,%esi
+  8039b9:	4c 89 ef             	mov    %r13,%rdi
+  8039bc:	ff d0                	call   *%rax
+}
+  8039be:	48 83 c4 18          	add    $0x18,%rsp
+  8039c2:	5b                   	pop    %rbx
+  8039c3:	41 5c                	pop    %r12
+  8039c5:	41 5d                	pop    %r13
+  8039c7:	5d                   	pop    %rbp
+  8039c8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8039c9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8039d0:	00 00 00 
+  8039d3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8039d9:	89 da                	mov    %ebx,%edx
+  8039db:	48 bf 50 65 80 00 00 	movabs $0x806550,%rdi
+  8039e2:	00 00 00 
+  8039e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ea:	48 b9 83 18 80 00 00 	movabs $0x801883,%rcx
+  8039f1:	00 00 00 
+  8039f4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8039f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039fb:	eb c1                	jmp    8039be <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8039fd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a02:	eb ba                	jmp    8039be <ftruncate+0x5e>
+
+0000000000803a04 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803a04:	55                   	push   %rbp
+  803a05:	48 89 e5             	mov    %rsp,%rbp
+  803a08:	41 54                	push   %r12
+  803a0a:	53                   	push   %rbx
+  803a0b:	48 83 ec 10          	sub    $0x10,%rsp
+  803a0f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a12:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803a16:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  803a1d:	00 00 00 
+  803a20:	ff d0                	call   *%rax
+  803a22:	85 c0                	test   %eax,%eax
+  803a24:	78 63                	js     803a89 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803a26:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803a2a:	41 8b 3c 24          	mov    (%r12),%edi
+  803a2e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803a32:	48 b8 8a 34 80 00 00 	movabs $0x80348a,%rax
+  803a39:	00 00 00 
+  803a3c:	ff d0                	call   *%rax
+  803a3e:	85 c0                	test   %eax,%eax
+  803a40:	78 47                	js     803a89 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a46:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803a4b:	74 45                	je     803a92 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803a4d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803a50:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803a57:	00 00 00 
+    stat->st_isdir = 0;
+  803a5a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a61:	00 00 00 
+    stat->st_ino = 0;
+  803a64:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803a6b:	00 00 00 00 
+    stat->st_version = 0;
+  803a6f:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803a76:	00 00 00 
+    stat->st_dev = dev;
+  803a79:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803a80:	48 89 de             	mov    %rbx,%rsi
+  803a83:	4c 89 e7             	mov    %r12,%rdi
+  803a86:	ff 50 28             	call   *0x28(%rax)
+}
+  803a89:	48 83 c4 10          	add    $0x10,%rsp
+  803a8d:	5b                   	pop    %rbx
+  803a8e:	41 5c                	pop    %r12
+  803a90:	5d                   	pop    %rbp
+  803a91:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a92:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a97:	eb f0                	jmp    803a89 <fstat+0x85>
+
+0000000000803a99 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803a99:	55                   	push   %rbp
+  803a9a:	48 89 e5             	mov    %rsp,%rbp
+  803a9d:	41 54                	push   %r12
+  803a9f:	53                   	push   %rbx
+  803aa0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803aa3:	be 00 00 00 00       	mov    $0x0,%esi
+  803aa8:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  803aaf:	00 00 00 
+  803ab2:	ff d0                	call   *%rax
+  803ab4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803ab6:	85 c0                	test   %eax,%eax
+  803ab8:	78 25                	js     803adf <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803aba:	4c 89 e6             	mov    %r12,%rsi
+  803abd:	89 c7                	mov    %eax,%edi
+  803abf:	48 b8 04 3a 80 00 00 	movabs $0x803a04,%rax
+  803ac6:	00 00 00 
+  803ac9:	ff d0                	call   *%rax
+  803acb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803ace:	89 df                	mov    %ebx,%edi
+  803ad0:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  803ad7:	00 00 00 
+  803ada:	ff d0                	call   *%rax
+
+    return res;
+  803adc:	44 89 e3             	mov    %r12d,%ebx
+}
+  803adf:	89 d8                	mov    %ebx,%eax
+  803ae1:	5b                   	pop    %rbx
+  803ae2:	41 5c                	pop    %r12
+  803ae4:	5d                   	pop    %rbp
+  803ae5:	c3                   	ret
+
+0000000000803ae6 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ae6:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803aed:	00 00 00 
+  803af0:	83 38 00             	cmpl   $0x0,(%rax)
+  803af3:	74 0a                	je     803aff <fsipc_env+0x19>
+    return fsenv;
+}
+  803af5:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803afc:	00 00 
+  803afe:	c3                   	ret
+fsipc_env(void) {
+  803aff:	55                   	push   %rbp
+  803b00:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b03:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b08:	48 b8 61 33 80 00 00 	movabs $0x803361,%rax
+  803b0f:	00 00 00 
+  803b12:	ff d0                	call   *%rax
+  803b14:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803b1b:	00 00 
+}
+  803b1d:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803b24:	00 00 
+  803b26:	5d                   	pop    %rbp
+  803b27:	c3                   	ret
+
+0000000000803b28 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803b28:	55                   	push   %rbp
+  803b29:	48 89 e5             	mov    %rsp,%rbp
+  803b2c:	53                   	push   %rbx
+  803b2d:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803b31:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803b38:	00 
+  803b39:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803b40:	00 
+  803b41:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803b48:	00 
+  803b49:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803b50:	00 
+  803b51:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803b58:	00 
+
+    assert(size <= sizeof(words));
+  803b59:	48 83 fa 28          	cmp    $0x28,%rdx
+  803b5d:	77 38                	ja     803b97 <fsipc_short+0x6f>
+  803b5f:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803b61:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b65:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803b71:	48 b8 e6 3a 80 00 00 	movabs $0x803ae6,%rax
+  803b78:	00 00 00 
+  803b7b:	ff d0                	call   *%rax
+  803b7d:	89 c7                	mov    %eax,%edi
+  803b7f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803b83:	89 de                	mov    %ebx,%esi
+  803b85:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  803b8c:	00 00 00 
+  803b8f:	ff d0                	call   *%rax
+}
+  803b91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b95:	c9                   	leave
+  803b96:	c3                   	ret
+    assert(size <= sizeof(words));
+  803b97:	48 b9 e0 65 80 00 00 	movabs $0x8065e0,%rcx
+  803b9e:	00 00 00 
+  803ba1:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803ba8:	00 00 00 
+  803bab:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803bb0:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803bb7:	00 00 00 
+  803bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbf:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803bc6:	00 00 00 
+  803bc9:	41 ff d0             	call   *%r8
+
+0000000000803bcc <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803bcc:	55                   	push   %rbp
+  803bcd:	48 89 e5             	mov    %rsp,%rbp
+  803bd0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803bd4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bd7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803bda:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803bdd:	ba 08 00 00 00       	mov    $0x8,%edx
+  803be2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803be6:	bf 02 00 00 00       	mov    $0x2,%edi
+  803beb:	48 b8 28 3b 80 00 00 	movabs $0x803b28,%rax
+  803bf2:	00 00 00 
+  803bf5:	ff d0                	call   *%rax
+}
+  803bf7:	c9                   	leave
+  803bf8:	c3                   	ret
+
+0000000000803bf9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803bf9:	55                   	push   %rbp
+  803bfa:	48 89 e5             	mov    %rsp,%rbp
+  803bfd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803c01:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803c07:	ba 04 00 00 00       	mov    $0x4,%edx
+  803c0c:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803c10:	bf 06 00 00 00       	mov    $0x6,%edi
+  803c15:	48 b8 28 3b 80 00 00 	movabs $0x803b28,%rax
+  803c1c:	00 00 00 
+  803c1f:	ff d0                	call   *%rax
+}
+  803c21:	c9                   	leave
+  803c22:	c3                   	ret
+
+0000000000803c23 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803c23:	55                   	push   %rbp
+  803c24:	48 89 e5             	mov    %rsp,%rbp
+  803c27:	41 54                	push   %r12
+  803c29:	53                   	push   %rbx
+  803c2a:	48 83 ec 10          	sub    $0x10,%rsp
+  803c2e:	89 fb                	mov    %edi,%ebx
+  803c30:	49 89 f4             	mov    %rsi,%r12
+  803c33:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803c37:	48 b8 e6 3a 80 00 00 	movabs $0x803ae6,%rax
+  803c3e:	00 00 00 
+  803c41:	ff d0                	call   *%rax
+  803c43:	89 c7                	mov    %eax,%edi
+  803c45:	6a 00                	push   $0x0
+  803c47:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803c4b:	50                   	push   %rax
+  803c4c:	4d 89 e1             	mov    %r12,%r9
+  803c4f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803c55:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c5a:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803c61:	00 00 00 
+  803c64:	89 de                	mov    %ebx,%esi
+  803c66:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  803c6d:	00 00 00 
+  803c70:	ff d0                	call   *%rax
+}
+  803c72:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c76:	5b                   	pop    %rbx
+  803c77:	41 5c                	pop    %r12
+  803c79:	5d                   	pop    %rbp
+  803c7a:	c3                   	ret
+
+0000000000803c7b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803c7b:	55                   	push   %rbp
+  803c7c:	48 89 e5             	mov    %rsp,%rbp
+  803c7f:	41 54                	push   %r12
+  803c81:	53                   	push   %rbx
+  803c82:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c85:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c88:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803c8f:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c96:	be 00 00 00 00       	mov    $0x0,%esi
+  803c9b:	bf 05 00 00 00       	mov    $0x5,%edi
+  803ca0:	48 b8 23 3c 80 00 00 	movabs $0x803c23,%rax
+  803ca7:	00 00 00 
+  803caa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cac:	85 c0                	test   %eax,%eax
+  803cae:	78 5a                	js     803d0a <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803cb0:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803cb7:	00 00 00 
+  803cba:	4c 89 e6             	mov    %r12,%rsi
+  803cbd:	48 89 df             	mov    %rbx,%rdi
+  803cc0:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803cc7:	00 00 00 
+  803cca:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803ccc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803cd3:	00 
+  803cd4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803cda:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803ce1:	00 
+  803ce2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803ce8:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803cef:	00 
+  803cf0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803cf7:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803cfe:	00 
+  803cff:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803d05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d0a:	5b                   	pop    %rbx
+  803d0b:	41 5c                	pop    %r12
+  803d0d:	5d                   	pop    %rbp
+  803d0e:	c3                   	ret
+
+0000000000803d0f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803d0f:	55                   	push   %rbp
+  803d10:	48 89 e5             	mov    %rsp,%rbp
+  803d13:	41 57                	push   %r15
+  803d15:	41 56                	push   %r14
+  803d17:	41 55                	push   %r13
+  803d19:	41 54                	push   %r12
+  803d1b:	53                   	push   %rbx
+  803d1c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803d20:	48 85 ff             	test   %rdi,%rdi
+  803d23:	0f 84 a1 00 00 00    	je     803dca <devfile_read+0xbb>
+  803d29:	49 89 ff             	mov    %rdi,%r15
+  803d2c:	49 89 f5             	mov    %rsi,%r13
+  803d2f:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803d32:	48 85 f6             	test   %rsi,%rsi
+  803d35:	0f 84 c4 00 00 00    	je     803dff <devfile_read+0xf0>
+    size_t total_read = 0;
+  803d3b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803d42:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803d43:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803d4a:	00 00 00 
+  803d4d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d51:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803d54:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d5d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d62:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d67:	48 b8 23 3c 80 00 00 	movabs $0x803c23,%rax
+  803d6e:	00 00 00 
+  803d71:	ff d0                	call   *%rax
+        if (res < 0) {
+  803d73:	85 c0                	test   %eax,%eax
+  803d75:	0f 88 b9 00 00 00    	js     803e34 <devfile_read+0x125>
+        assert(res <= n);
+  803d7b:	48 63 d8             	movslq %eax,%rbx
+  803d7e:	49 39 dc             	cmp    %rbx,%r12
+  803d81:	0f 82 b1 00 00 00    	jb     803e38 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803d87:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803d8c:	0f 87 db 00 00 00    	ja     803e6d <devfile_read+0x15e>
+        if (!res) {
+  803d92:	85 c0                	test   %eax,%eax
+  803d94:	74 21                	je     803db7 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803d96:	48 89 da             	mov    %rbx,%rdx
+  803d99:	4c 89 f6             	mov    %r14,%rsi
+  803d9c:	4c 89 ef             	mov    %r13,%rdi
+  803d9f:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+        total_read += res;
+  803dab:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803daf:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803db2:	49 29 dc             	sub    %rbx,%r12
+  803db5:	75 96                	jne    803d4d <devfile_read+0x3e>
+    return total_read;
+  803db7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803dbb:	48 83 c4 18          	add    $0x18,%rsp
+  803dbf:	5b                   	pop    %rbx
+  803dc0:	41 5c                	pop    %r12
+  803dc2:	41 5d                	pop    %r13
+  803dc4:	41 5e                	pop    %r14
+  803dc6:	41 5f                	pop    %r15
+  803dc8:	5d                   	pop    %rbp
+  803dc9:	c3                   	ret
+    assert(fd);
+  803dca:	48 b9 16 66 80 00 00 	movabs $0x806616,%rcx
+  803dd1:	00 00 00 
+  803dd4:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803ddb:	00 00 00 
+  803dde:	be 91 00 00 00       	mov    $0x91,%esi
+  803de3:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803dea:	00 00 00 
+  803ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df2:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803df9:	00 00 00 
+  803dfc:	41 ff d0             	call   *%r8
+    assert(buf);
+  803dff:	48 b9 19 66 80 00 00 	movabs $0x806619,%rcx
+  803e06:	00 00 00 
+  803e09:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803e10:	00 00 00 
+  803e13:	be 92 00 00 00       	mov    $0x92,%esi
+  803e18:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803e1f:	00 00 00 
+  803e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e27:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803e2e:	00 00 00 
+  803e31:	41 ff d0             	call   *%r8
+            return res;
+  803e34:	48 98                	cltq
+  803e36:	eb 83                	jmp    803dbb <devfile_read+0xac>
+        assert(res <= n);
+  803e38:	48 b9 1d 66 80 00 00 	movabs $0x80661d,%rcx
+  803e3f:	00 00 00 
+  803e42:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803e49:	00 00 00 
+  803e4c:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803e51:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803e58:	00 00 00 
+  803e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e60:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803e67:	00 00 00 
+  803e6a:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803e6d:	48 b9 28 66 80 00 00 	movabs $0x806628,%rcx
+  803e74:	00 00 00 
+  803e77:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803e7e:	00 00 00 
+  803e81:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803e86:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803e8d:	00 00 00 
+  803e90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e95:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803e9c:	00 00 00 
+  803e9f:	41 ff d0             	call   *%r8
+
+0000000000803ea2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803ea2:	55                   	push   %rbp
+  803ea3:	48 89 e5             	mov    %rsp,%rbp
+  803ea6:	41 57                	push   %r15
+  803ea8:	41 56                	push   %r14
+  803eaa:	41 55                	push   %r13
+  803eac:	41 54                	push   %r12
+  803eae:	53                   	push   %rbx
+  803eaf:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803eb3:	48 85 ff             	test   %rdi,%rdi
+  803eb6:	0f 84 83 00 00 00    	je     803f3f <devfile_write+0x9d>
+  803ebc:	49 89 ff             	mov    %rdi,%r15
+  803ebf:	49 89 f4             	mov    %rsi,%r12
+  803ec2:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803ec5:	48 85 f6             	test   %rsi,%rsi
+  803ec8:	0f 84 a6 00 00 00    	je     803f74 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803ece:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ed4:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803edb:	00 00 00 
+  803ede:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803ee2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803ee5:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803ee9:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803eee:	48 39 d3             	cmp    %rdx,%rbx
+  803ef1:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803ef5:	4c 89 e6             	mov    %r12,%rsi
+  803ef8:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803eff:	00 00 00 
+  803f02:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  803f09:	00 00 00 
+  803f0c:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f13:	be 00 00 00 00       	mov    $0x0,%esi
+  803f18:	bf 04 00 00 00       	mov    $0x4,%edi
+  803f1d:	48 b8 23 3c 80 00 00 	movabs $0x803c23,%rax
+  803f24:	00 00 00 
+  803f27:	ff d0                	call   *%rax
+        if (res < 0) {
+  803f29:	85 c0                	test   %eax,%eax
+  803f2b:	78 7c                	js     803fa9 <devfile_write+0x107>
+        total_written += res;
+  803f2d:	48 98                	cltq
+  803f2f:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803f32:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803f35:	48 29 c3             	sub    %rax,%rbx
+  803f38:	75 a4                	jne    803ede <devfile_write+0x3c>
+    return total_written;
+  803f3a:	4c 89 e8             	mov    %r13,%rax
+  803f3d:	eb 6c                	jmp    803fab <devfile_write+0x109>
+    assert(fd);
+  803f3f:	48 b9 16 66 80 00 00 	movabs $0x806616,%rcx
+  803f46:	00 00 00 
+  803f49:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803f50:	00 00 00 
+  803f53:	be bd 00 00 00       	mov    $0xbd,%esi
+  803f58:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803f5f:	00 00 00 
+  803f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f67:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803f6e:	00 00 00 
+  803f71:	41 ff d0             	call   *%r8
+    assert(buf);
+  803f74:	48 b9 19 66 80 00 00 	movabs $0x806619,%rcx
+  803f7b:	00 00 00 
+  803f7e:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803f85:	00 00 00 
+  803f88:	be be 00 00 00       	mov    $0xbe,%esi
+  803f8d:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803f94:	00 00 00 
+  803f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9c:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  803fa3:	00 00 00 
+  803fa6:	41 ff d0             	call   *%r8
+            return res;
+  803fa9:	48 98                	cltq
+}
+  803fab:	48 83 c4 08          	add    $0x8,%rsp
+  803faf:	5b                   	pop    %rbx
+  803fb0:	41 5c                	pop    %r12
+  803fb2:	41 5d                	pop    %r13
+  803fb4:	41 5e                	pop    %r14
+  803fb6:	41 5f                	pop    %r15
+  803fb8:	5d                   	pop    %rbp
+  803fb9:	c3                   	ret
+
+0000000000803fba <open>:
+open(const char *path, int mode) {
+  803fba:	55                   	push   %rbp
+  803fbb:	48 89 e5             	mov    %rsp,%rbp
+  803fbe:	41 55                	push   %r13
+  803fc0:	41 54                	push   %r12
+  803fc2:	53                   	push   %rbx
+  803fc3:	48 83 ec 18          	sub    $0x18,%rsp
+  803fc7:	49 89 fc             	mov    %rdi,%r12
+  803fca:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803fcd:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  803fd4:	00 00 00 
+  803fd7:	ff d0                	call   *%rax
+  803fd9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803fdf:	0f 87 8f 00 00 00    	ja     804074 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803fe5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fe9:	48 b8 df 33 80 00 00 	movabs $0x8033df,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+  803ff5:	89 c3                	mov    %eax,%ebx
+  803ff7:	85 c0                	test   %eax,%eax
+  803ff9:	78 55                	js     804050 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803ffb:	4c 89 e6             	mov    %r12,%rsi
+  803ffe:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  804005:	00 00 00 
+  804008:	48 89 df             	mov    %rbx,%rdi
+  80400b:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  804012:	00 00 00 
+  804015:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804017:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80401e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804023:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804027:	bf 01 00 00 00       	mov    $0x1,%edi
+  80402c:	48 b8 23 3c 80 00 00 	movabs $0x803c23,%rax
+  804033:	00 00 00 
+  804036:	ff d0                	call   *%rax
+  804038:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80403a:	85 c0                	test   %eax,%eax
+  80403c:	78 1f                	js     80405d <open+0xa3>
+    return fd2num(fd);
+  80403e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804042:	48 b8 b1 33 80 00 00 	movabs $0x8033b1,%rax
+  804049:	00 00 00 
+  80404c:	ff d0                	call   *%rax
+  80404e:	89 c3                	mov    %eax,%ebx
+}
+  804050:	89 d8                	mov    %ebx,%eax
+  804052:	48 83 c4 18          	add    $0x18,%rsp
+  804056:	5b                   	pop    %rbx
+  804057:	41 5c                	pop    %r12
+  804059:	41 5d                	pop    %r13
+  80405b:	5d                   	pop    %rbp
+  80405c:	c3                   	ret
+        fd_close(fd, 0);
+  80405d:	be 00 00 00 00       	mov    $0x0,%esi
+  804062:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804066:	48 b8 fa 34 80 00 00 	movabs $0x8034fa,%rax
+  80406d:	00 00 00 
+  804070:	ff d0                	call   *%rax
+        return res;
+  804072:	eb dc                	jmp    804050 <open+0x96>
+        return -E_BAD_PATH;
+  804074:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804079:	eb d5                	jmp    804050 <open+0x96>
+
+000000000080407b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80407b:	55                   	push   %rbp
+  80407c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  80407f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804084:	be 00 00 00 00       	mov    $0x0,%esi
+  804089:	bf 08 00 00 00       	mov    $0x8,%edi
+  80408e:	48 b8 28 3b 80 00 00 	movabs $0x803b28,%rax
+  804095:	00 00 00 
+  804098:	ff d0                	call   *%rax
+}
+  80409a:	5d                   	pop    %rbp
+  80409b:	c3                   	ret
+
+000000000080409c <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	41 56                	push   %r14
+  8040a2:	41 55                	push   %r13
+  8040a4:	41 54                	push   %r12
+  8040a6:	53                   	push   %rbx
+  8040a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8040ab:	41 89 f6             	mov    %esi,%r14d
+  8040ae:	49 89 d4             	mov    %rdx,%r12
+  8040b1:	48 89 cb             	mov    %rcx,%rbx
+  8040b4:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8040b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040bb:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  8040c2:	00 00 00 
+  8040c5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040c7:	85 c0                	test   %eax,%eax
+  8040c9:	78 46                	js     804111 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040cb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040cf:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8040d6:	00 00 00 
+  8040d9:	8b 00                	mov    (%rax),%eax
+  8040db:	39 02                	cmp    %eax,(%rdx)
+  8040dd:	75 3f                	jne    80411e <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8040df:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  8040e6:	00 00 00 
+  8040e9:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8040ec:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  8040ee:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  8040f2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  8040f6:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  8040fa:	48 89 da             	mov    %rbx,%rdx
+  8040fd:	4c 89 e6             	mov    %r12,%rsi
+  804100:	bf 09 00 00 00       	mov    $0x9,%edi
+  804105:	48 b8 23 3c 80 00 00 	movabs $0x803c23,%rax
+  80410c:	00 00 00 
+  80410f:	ff d0                	call   *%rax
+}
+  804111:	48 83 c4 10          	add    $0x10,%rsp
+  804115:	5b                   	pop    %rbx
+  804116:	41 5c                	pop    %r12
+  804118:	41 5d                	pop    %r13
+  80411a:	41 5e                	pop    %r14
+  80411c:	5d                   	pop    %rbp
+  80411d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80411e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804123:	eb ec                	jmp    804111 <file_map+0x75>
+
+0000000000804125 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804125:	55                   	push   %rbp
+  804126:	48 89 e5             	mov    %rsp,%rbp
+  804129:	41 54                	push   %r12
+  80412b:	53                   	push   %rbx
+  80412c:	48 83 ec 20          	sub    $0x20,%rsp
+  804130:	41 89 f4             	mov    %esi,%r12d
+  804133:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804136:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80413a:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  804141:	00 00 00 
+  804144:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804146:	85 c0                	test   %eax,%eax
+  804148:	78 3c                	js     804186 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80414a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80414e:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  804155:	00 00 00 
+  804158:	8b 0a                	mov    (%rdx),%ecx
+  80415a:	39 08                	cmp    %ecx,(%rax)
+  80415c:	75 31                	jne    80418f <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  80415e:	8b 40 0c             	mov    0xc(%rax),%eax
+  804161:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804164:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804168:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  80416c:	ba 10 00 00 00       	mov    $0x10,%edx
+  804171:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804175:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80417a:	48 b8 28 3b 80 00 00 	movabs $0x803b28,%rax
+  804181:	00 00 00 
+  804184:	ff d0                	call   *%rax
+}
+  804186:	48 83 c4 20          	add    $0x20,%rsp
+  80418a:	5b                   	pop    %rbx
+  80418b:	41 5c                	pop    %r12
+  80418d:	5d                   	pop    %rbp
+  80418e:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80418f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804194:	eb f0                	jmp    804186 <file_msync+0x61>
+
+0000000000804196 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804196:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80419a:	7f 01                	jg     80419d <writebuf+0x7>
+  80419c:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80419d:	55                   	push   %rbp
+  80419e:	48 89 e5             	mov    %rsp,%rbp
+  8041a1:	53                   	push   %rbx
+  8041a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8041a6:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8041a9:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8041ad:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8041b1:	8b 3f                	mov    (%rdi),%edi
+  8041b3:	48 b8 51 38 80 00 00 	movabs $0x803851,%rax
+  8041ba:	00 00 00 
+  8041bd:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8041bf:	48 85 c0             	test   %rax,%rax
+  8041c2:	7e 04                	jle    8041c8 <writebuf+0x32>
+  8041c4:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8041c8:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8041cc:	48 39 c2             	cmp    %rax,%rdx
+  8041cf:	74 0f                	je     8041e0 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8041d1:	48 85 c0             	test   %rax,%rax
+  8041d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041d9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8041dd:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8041e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041e4:	c9                   	leave
+  8041e5:	c3                   	ret
+
+00000000008041e6 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8041e6:	8b 46 04             	mov    0x4(%rsi),%eax
+  8041e9:	8d 50 01             	lea    0x1(%rax),%edx
+  8041ec:	89 56 04             	mov    %edx,0x4(%rsi)
+  8041ef:	48 98                	cltq
+  8041f1:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8041f6:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8041fc:	74 01                	je     8041ff <putch+0x19>
+  8041fe:	c3                   	ret
+putch(int ch, void *arg) {
+  8041ff:	55                   	push   %rbp
+  804200:	48 89 e5             	mov    %rsp,%rbp
+  804203:	53                   	push   %rbx
+  804204:	48 83 ec 08          	sub    $0x8,%rsp
+  804208:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80420b:	48 89 f7             	mov    %rsi,%rdi
+  80420e:	48 b8 96 41 80 00 00 	movabs $0x804196,%rax
+  804215:	00 00 00 
+  804218:	ff d0                	call   *%rax
+        state->offset = 0;
+  80421a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804221:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804225:	c9                   	leave
+  804226:	c3                   	ret
+
+0000000000804227 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804227:	55                   	push   %rbp
+  804228:	48 89 e5             	mov    %rsp,%rbp
+  80422b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804232:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804235:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80423b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804242:	00 00 00 
+    state.result = 0;
+  804245:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80424c:	00 00 00 00 
+    state.error = 1;
+  804250:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804257:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80425a:	48 89 f2             	mov    %rsi,%rdx
+  80425d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804264:	48 bf e6 41 80 00 00 	movabs $0x8041e6,%rdi
+  80426b:	00 00 00 
+  80426e:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  804275:	00 00 00 
+  804278:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80427a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804281:	7f 14                	jg     804297 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804283:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80428a:	48 85 c0             	test   %rax,%rax
+  80428d:	75 06                	jne    804295 <vfprintf+0x6e>
+  80428f:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804295:	c9                   	leave
+  804296:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804297:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80429e:	48 b8 96 41 80 00 00 	movabs $0x804196,%rax
+  8042a5:	00 00 00 
+  8042a8:	ff d0                	call   *%rax
+  8042aa:	eb d7                	jmp    804283 <vfprintf+0x5c>
+
+00000000008042ac <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8042ac:	55                   	push   %rbp
+  8042ad:	48 89 e5             	mov    %rsp,%rbp
+  8042b0:	48 83 ec 50          	sub    $0x50,%rsp
+  8042b4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042bc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042c0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8042c4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8042cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042d3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8042d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8042db:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8042df:	48 b8 27 42 80 00 00 	movabs $0x804227,%rax
+  8042e6:	00 00 00 
+  8042e9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8042eb:	c9                   	leave
+  8042ec:	c3                   	ret
+
+00000000008042ed <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8042ed:	55                   	push   %rbp
+  8042ee:	48 89 e5             	mov    %rsp,%rbp
+  8042f1:	48 83 ec 50          	sub    $0x50,%rsp
+  8042f5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8042f9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042fd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804301:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804305:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804309:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804310:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804314:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804318:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80431c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804320:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804324:	48 89 fe             	mov    %rdi,%rsi
+  804327:	bf 01 00 00 00       	mov    $0x1,%edi
+  80432c:	48 b8 27 42 80 00 00 	movabs $0x804227,%rax
+  804333:	00 00 00 
+  804336:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804338:	c9                   	leave
+  804339:	c3                   	ret
+
+000000000080433a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80433a:	55                   	push   %rbp
+  80433b:	48 89 e5             	mov    %rsp,%rbp
+  80433e:	41 54                	push   %r12
+  804340:	53                   	push   %rbx
+  804341:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804344:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  80434b:	00 00 00 
+  80434e:	ff d0                	call   *%rax
+  804350:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804353:	48 be 50 66 80 00 00 	movabs $0x806650,%rsi
+  80435a:	00 00 00 
+  80435d:	48 89 df             	mov    %rbx,%rdi
+  804360:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  804367:	00 00 00 
+  80436a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80436c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804371:	41 2b 04 24          	sub    (%r12),%eax
+  804375:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80437b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804382:	00 00 00 
+    stat->st_dev = &devpipe;
+  804385:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80438c:	00 00 00 
+  80438f:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439b:	5b                   	pop    %rbx
+  80439c:	41 5c                	pop    %r12
+  80439e:	5d                   	pop    %rbp
+  80439f:	c3                   	ret
+
+00000000008043a0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8043a0:	55                   	push   %rbp
+  8043a1:	48 89 e5             	mov    %rsp,%rbp
+  8043a4:	41 54                	push   %r12
+  8043a6:	53                   	push   %rbx
+  8043a7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8043aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043af:	48 89 fe             	mov    %rdi,%rsi
+  8043b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043b7:	49 bc f7 29 80 00 00 	movabs $0x8029f7,%r12
+  8043be:	00 00 00 
+  8043c1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8043c4:	48 89 df             	mov    %rbx,%rdi
+  8043c7:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8043ce:	00 00 00 
+  8043d1:	ff d0                	call   *%rax
+  8043d3:	48 89 c6             	mov    %rax,%rsi
+  8043d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e0:	41 ff d4             	call   *%r12
+}
+  8043e3:	5b                   	pop    %rbx
+  8043e4:	41 5c                	pop    %r12
+  8043e6:	5d                   	pop    %rbp
+  8043e7:	c3                   	ret
+
+00000000008043e8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043e8:	55                   	push   %rbp
+  8043e9:	48 89 e5             	mov    %rsp,%rbp
+  8043ec:	41 57                	push   %r15
+  8043ee:	41 56                	push   %r14
+  8043f0:	41 55                	push   %r13
+  8043f2:	41 54                	push   %r12
+  8043f4:	53                   	push   %rbx
+  8043f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8043f9:	49 89 fc             	mov    %rdi,%r12
+  8043fc:	49 89 f5             	mov    %rsi,%r13
+  8043ff:	49 89 d7             	mov    %rdx,%r15
+  804402:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804406:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  80440d:	00 00 00 
+  804410:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804412:	4d 85 ff             	test   %r15,%r15
+  804415:	0f 84 af 00 00 00    	je     8044ca <devpipe_write+0xe2>
+  80441b:	48 89 c3             	mov    %rax,%rbx
+  80441e:	4c 89 f8             	mov    %r15,%rax
+  804421:	4d 89 ef             	mov    %r13,%r15
+  804424:	4c 01 e8             	add    %r13,%rax
+  804427:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80442b:	49 bd ed 28 80 00 00 	movabs $0x8028ed,%r13
+  804432:	00 00 00 
+            sys_yield();
+  804435:	49 be 7e 28 80 00 00 	movabs $0x80287e,%r14
+  80443c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80443f:	8b 73 04             	mov    0x4(%rbx),%esi
+  804442:	48 63 ce             	movslq %esi,%rcx
+  804445:	48 63 03             	movslq (%rbx),%rax
+  804448:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80444e:	48 39 c1             	cmp    %rax,%rcx
+  804451:	72 2e                	jb     804481 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804453:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804458:	48 89 da             	mov    %rbx,%rdx
+  80445b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804460:	4c 89 e7             	mov    %r12,%rdi
+  804463:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804466:	85 c0                	test   %eax,%eax
+  804468:	74 66                	je     8044d0 <devpipe_write+0xe8>
+            sys_yield();
+  80446a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80446d:	8b 73 04             	mov    0x4(%rbx),%esi
+  804470:	48 63 ce             	movslq %esi,%rcx
+  804473:	48 63 03             	movslq (%rbx),%rax
+  804476:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80447c:	48 39 c1             	cmp    %rax,%rcx
+  80447f:	73 d2                	jae    804453 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804481:	41 0f b6 3f          	movzbl (%r15),%edi
+  804485:	48 89 ca             	mov    %rcx,%rdx
+  804488:	48 c1 ea 03          	shr    $0x3,%rdx
+  80448c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804493:	08 10 20 
+  804496:	48 f7 e2             	mul    %rdx
+  804499:	48 c1 ea 06          	shr    $0x6,%rdx
+  80449d:	48 89 d0             	mov    %rdx,%rax
+  8044a0:	48 c1 e0 09          	shl    $0x9,%rax
+  8044a4:	48 29 d0             	sub    %rdx,%rax
+  8044a7:	48 c1 e0 03          	shl    $0x3,%rax
+  8044ab:	48 29 c1             	sub    %rax,%rcx
+  8044ae:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8044b3:	83 c6 01             	add    $0x1,%esi
+  8044b6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8044b9:	49 83 c7 01          	add    $0x1,%r15
+  8044bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044c1:	49 39 c7             	cmp    %rax,%r15
+  8044c4:	0f 85 75 ff ff ff    	jne    80443f <devpipe_write+0x57>
+    return n;
+  8044ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044ce:	eb 05                	jmp    8044d5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8044d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044d5:	48 83 c4 18          	add    $0x18,%rsp
+  8044d9:	5b                   	pop    %rbx
+  8044da:	41 5c                	pop    %r12
+  8044dc:	41 5d                	pop    %r13
+  8044de:	41 5e                	pop    %r14
+  8044e0:	41 5f                	pop    %r15
+  8044e2:	5d                   	pop    %rbp
+  8044e3:	c3                   	ret
+
+00000000008044e4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044e4:	55                   	push   %rbp
+  8044e5:	48 89 e5             	mov    %rsp,%rbp
+  8044e8:	41 57                	push   %r15
+  8044ea:	41 56                	push   %r14
+  8044ec:	41 55                	push   %r13
+  8044ee:	41 54                	push   %r12
+  8044f0:	53                   	push   %rbx
+  8044f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8044f5:	49 89 fc             	mov    %rdi,%r12
+  8044f8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804500:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  804507:	00 00 00 
+  80450a:	ff d0                	call   *%rax
+  80450c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80450f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804515:	49 bd ed 28 80 00 00 	movabs $0x8028ed,%r13
+  80451c:	00 00 00 
+            sys_yield();
+  80451f:	49 be 7e 28 80 00 00 	movabs $0x80287e,%r14
+  804526:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804529:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80452e:	74 7d                	je     8045ad <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804530:	8b 03                	mov    (%rbx),%eax
+  804532:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804535:	75 26                	jne    80455d <devpipe_read+0x79>
+            if (i > 0) return i;
+  804537:	4d 85 ff             	test   %r15,%r15
+  80453a:	75 77                	jne    8045b3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80453c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804541:	48 89 da             	mov    %rbx,%rdx
+  804544:	be 00 10 00 00       	mov    $0x1000,%esi
+  804549:	4c 89 e7             	mov    %r12,%rdi
+  80454c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80454f:	85 c0                	test   %eax,%eax
+  804551:	74 72                	je     8045c5 <devpipe_read+0xe1>
+            sys_yield();
+  804553:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804556:	8b 03                	mov    (%rbx),%eax
+  804558:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80455b:	74 df                	je     80453c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80455d:	48 63 c8             	movslq %eax,%rcx
+  804560:	48 89 ca             	mov    %rcx,%rdx
+  804563:	48 c1 ea 03          	shr    $0x3,%rdx
+  804567:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80456e:	08 10 20 
+  804571:	48 89 d0             	mov    %rdx,%rax
+  804574:	48 f7 e6             	mul    %rsi
+  804577:	48 c1 ea 06          	shr    $0x6,%rdx
+  80457b:	48 89 d0             	mov    %rdx,%rax
+  80457e:	48 c1 e0 09          	shl    $0x9,%rax
+  804582:	48 29 d0             	sub    %rdx,%rax
+  804585:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80458c:	00 
+  80458d:	48 89 c8             	mov    %rcx,%rax
+  804590:	48 29 d0             	sub    %rdx,%rax
+  804593:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804598:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80459c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8045a0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8045a3:	49 83 c7 01          	add    $0x1,%r15
+  8045a7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8045ab:	75 83                	jne    804530 <devpipe_read+0x4c>
+    return n;
+  8045ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045b1:	eb 03                	jmp    8045b6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8045b3:	4c 89 f8             	mov    %r15,%rax
+}
+  8045b6:	48 83 c4 18          	add    $0x18,%rsp
+  8045ba:	5b                   	pop    %rbx
+  8045bb:	41 5c                	pop    %r12
+  8045bd:	41 5d                	pop    %r13
+  8045bf:	41 5e                	pop    %r14
+  8045c1:	41 5f                	pop    %r15
+  8045c3:	5d                   	pop    %rbp
+  8045c4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8045c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ca:	eb ea                	jmp    8045b6 <devpipe_read+0xd2>
+
+00000000008045cc <pipe>:
+pipe(int pfd[2]) {
+  8045cc:	55                   	push   %rbp
+  8045cd:	48 89 e5             	mov    %rsp,%rbp
+  8045d0:	41 55                	push   %r13
+  8045d2:	41 54                	push   %r12
+  8045d4:	53                   	push   %rbx
+  8045d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8045d9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8045dc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8045e0:	48 b8 df 33 80 00 00 	movabs $0x8033df,%rax
+  8045e7:	00 00 00 
+  8045ea:	ff d0                	call   *%rax
+  8045ec:	89 c3                	mov    %eax,%ebx
+  8045ee:	85 c0                	test   %eax,%eax
+  8045f0:	0f 88 a0 01 00 00    	js     804796 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8045f6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804600:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804604:	bf 00 00 00 00       	mov    $0x0,%edi
+  804609:	48 b8 1f 29 80 00 00 	movabs $0x80291f,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+  804615:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804617:	85 c0                	test   %eax,%eax
+  804619:	0f 88 77 01 00 00    	js     804796 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80461f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804623:	48 b8 df 33 80 00 00 	movabs $0x8033df,%rax
+  80462a:	00 00 00 
+  80462d:	ff d0                	call   *%rax
+  80462f:	89 c3                	mov    %eax,%ebx
+  804631:	85 c0                	test   %eax,%eax
+  804633:	0f 88 43 01 00 00    	js     80477c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804639:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80463e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804643:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804647:	bf 00 00 00 00       	mov    $0x0,%edi
+  80464c:	48 b8 1f 29 80 00 00 	movabs $0x80291f,%rax
+  804653:	00 00 00 
+  804656:	ff d0                	call   *%rax
+  804658:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80465a:	85 c0                	test   %eax,%eax
+  80465c:	0f 88 1a 01 00 00    	js     80477c <pipe+0x1b0>
+    va = fd2data(fd0);
+  804662:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804666:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  80466d:	00 00 00 
+  804670:	ff d0                	call   *%rax
+  804672:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804675:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80467a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80467f:	48 89 c6             	mov    %rax,%rsi
+  804682:	bf 00 00 00 00       	mov    $0x0,%edi
+  804687:	48 b8 1f 29 80 00 00 	movabs $0x80291f,%rax
+  80468e:	00 00 00 
+  804691:	ff d0                	call   *%rax
+  804693:	89 c3                	mov    %eax,%ebx
+  804695:	85 c0                	test   %eax,%eax
+  804697:	0f 88 c5 00 00 00    	js     804762 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80469d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8046a1:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8046a8:	00 00 00 
+  8046ab:	ff d0                	call   *%rax
+  8046ad:	48 89 c1             	mov    %rax,%rcx
+  8046b0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8046b6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8046bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046c1:	4c 89 ee             	mov    %r13,%rsi
+  8046c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c9:	48 b8 8c 29 80 00 00 	movabs $0x80298c,%rax
+  8046d0:	00 00 00 
+  8046d3:	ff d0                	call   *%rax
+  8046d5:	89 c3                	mov    %eax,%ebx
+  8046d7:	85 c0                	test   %eax,%eax
+  8046d9:	78 6e                	js     804749 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046e0:	4c 89 ef             	mov    %r13,%rdi
+  8046e3:	48 b8 b5 28 80 00 00 	movabs $0x8028b5,%rax
+  8046ea:	00 00 00 
+  8046ed:	ff d0                	call   *%rax
+  8046ef:	83 f8 02             	cmp    $0x2,%eax
+  8046f2:	0f 85 ab 00 00 00    	jne    8047a3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8046f8:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8046ff:	00 00 
+  804701:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804705:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804707:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80470b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804712:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804716:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804718:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80471c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804723:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804727:	48 bb b1 33 80 00 00 	movabs $0x8033b1,%rbx
+  80472e:	00 00 00 
+  804731:	ff d3                	call   *%rbx
+  804733:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804737:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80473b:	ff d3                	call   *%rbx
+  80473d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804747:	eb 4d                	jmp    804796 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804749:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80474e:	4c 89 ee             	mov    %r13,%rsi
+  804751:	bf 00 00 00 00       	mov    $0x0,%edi
+  804756:	48 b8 f7 29 80 00 00 	movabs $0x8029f7,%rax
+  80475d:	00 00 00 
+  804760:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804762:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804767:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80476b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804770:	48 b8 f7 29 80 00 00 	movabs $0x8029f7,%rax
+  804777:	00 00 00 
+  80477a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80477c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804781:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804785:	bf 00 00 00 00       	mov    $0x0,%edi
+  80478a:	48 b8 f7 29 80 00 00 	movabs $0x8029f7,%rax
+  804791:	00 00 00 
+  804794:	ff d0                	call   *%rax
+}
+  804796:	89 d8                	mov    %ebx,%eax
+  804798:	48 83 c4 18          	add    $0x18,%rsp
+  80479c:	5b                   	pop    %rbx
+  80479d:	41 5c                	pop    %r12
+  80479f:	41 5d                	pop    %r13
+  8047a1:	5d                   	pop    %rbp
+  8047a2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8047a3:	48 b9 68 66 80 00 00 	movabs $0x806668,%rcx
+  8047aa:	00 00 00 
+  8047ad:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  8047b4:	00 00 00 
+  8047b7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8047bc:	48 bf 57 66 80 00 00 	movabs $0x806657,%rdi
+  8047c3:	00 00 00 
+  8047c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047cb:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  8047d2:	00 00 00 
+  8047d5:	41 ff d0             	call   *%r8
+
+00000000008047d8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8047d8:	55                   	push   %rbp
+  8047d9:	48 89 e5             	mov    %rsp,%rbp
+  8047dc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8047e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8047e4:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  8047eb:	00 00 00 
+  8047ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8047f0:	85 c0                	test   %eax,%eax
+  8047f2:	78 35                	js     804829 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8047f4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047f8:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8047ff:	00 00 00 
+  804802:	ff d0                	call   *%rax
+  804804:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804807:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80480c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804811:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804815:	48 b8 ed 28 80 00 00 	movabs $0x8028ed,%rax
+  80481c:	00 00 00 
+  80481f:	ff d0                	call   *%rax
+  804821:	85 c0                	test   %eax,%eax
+  804823:	0f 94 c0             	sete   %al
+  804826:	0f b6 c0             	movzbl %al,%eax
+}
+  804829:	c9                   	leave
+  80482a:	c3                   	ret
+
+000000000080482b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80482b:	48 89 f8             	mov    %rdi,%rax
+  80482e:	48 c1 e8 27          	shr    $0x27,%rax
+  804832:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804839:	01 00 00 
+  80483c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804840:	f6 c2 01             	test   $0x1,%dl
+  804843:	74 6d                	je     8048b2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804845:	48 89 f8             	mov    %rdi,%rax
+  804848:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80484c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804853:	01 00 00 
+  804856:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80485a:	f6 c2 01             	test   $0x1,%dl
+  80485d:	74 62                	je     8048c1 <get_uvpt_entry+0x96>
+  80485f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804866:	01 00 00 
+  804869:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80486d:	f6 c2 80             	test   $0x80,%dl
+  804870:	75 4f                	jne    8048c1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804872:	48 89 f8             	mov    %rdi,%rax
+  804875:	48 c1 e8 15          	shr    $0x15,%rax
+  804879:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804880:	01 00 00 
+  804883:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804887:	f6 c2 01             	test   $0x1,%dl
+  80488a:	74 44                	je     8048d0 <get_uvpt_entry+0xa5>
+  80488c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804893:	01 00 00 
+  804896:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80489a:	f6 c2 80             	test   $0x80,%dl
+  80489d:	75 31                	jne    8048d0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80489f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8048a3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8048aa:	01 00 00 
+  8048ad:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8048b1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8048b2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8048b9:	01 00 00 
+  8048bc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048c0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8048c1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8048c8:	01 00 00 
+  8048cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048cf:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8048d0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048d7:	01 00 00 
+  8048da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048de:	c3                   	ret
+
+00000000008048df <get_prot>:
+
+int
+get_prot(void *va) {
+  8048df:	55                   	push   %rbp
+  8048e0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8048e3:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  8048ea:	00 00 00 
+  8048ed:	ff d0                	call   *%rax
+  8048ef:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8048f2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8048f7:	89 c1                	mov    %eax,%ecx
+  8048f9:	83 c9 04             	or     $0x4,%ecx
+  8048fc:	f6 c2 01             	test   $0x1,%dl
+  8048ff:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804902:	89 c1                	mov    %eax,%ecx
+  804904:	83 c9 02             	or     $0x2,%ecx
+  804907:	f6 c2 02             	test   $0x2,%dl
+  80490a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80490d:	89 c1                	mov    %eax,%ecx
+  80490f:	83 c9 01             	or     $0x1,%ecx
+  804912:	48 85 d2             	test   %rdx,%rdx
+  804915:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804918:	89 c1                	mov    %eax,%ecx
+  80491a:	83 c9 40             	or     $0x40,%ecx
+  80491d:	f6 c6 04             	test   $0x4,%dh
+  804920:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804923:	5d                   	pop    %rbp
+  804924:	c3                   	ret
+
+0000000000804925 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804925:	55                   	push   %rbp
+  804926:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804929:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  804930:	00 00 00 
+  804933:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804935:	48 c1 e8 06          	shr    $0x6,%rax
+  804939:	83 e0 01             	and    $0x1,%eax
+}
+  80493c:	5d                   	pop    %rbp
+  80493d:	c3                   	ret
+
+000000000080493e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80493e:	55                   	push   %rbp
+  80493f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804942:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  804949:	00 00 00 
+  80494c:	ff d0                	call   *%rax
+  80494e:	83 e0 01             	and    $0x1,%eax
+}
+  804951:	5d                   	pop    %rbp
+  804952:	c3                   	ret
+
+0000000000804953 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804953:	55                   	push   %rbp
+  804954:	48 89 e5             	mov    %rsp,%rbp
+  804957:	41 57                	push   %r15
+  804959:	41 56                	push   %r14
+  80495b:	41 55                	push   %r13
+  80495d:	41 54                	push   %r12
+  80495f:	53                   	push   %rbx
+  804960:	48 83 ec 28          	sub    $0x28,%rsp
+  804964:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804968:	48 85 ff             	test   %rdi,%rdi
+  80496b:	74 1e                	je     80498b <foreach_shared_region+0x38>
+  80496d:	49 89 ff             	mov    %rdi,%r15
+  804970:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804976:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80497c:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804983:	01 00 00 
+  804986:	e9 72 02 00 00       	jmp    804bfd <foreach_shared_region+0x2aa>
+    assert(fun);
+  80498b:	48 b9 8c 66 80 00 00 	movabs $0x80668c,%rcx
+  804992:	00 00 00 
+  804995:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  80499c:	00 00 00 
+  80499f:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8049a4:	48 bf 90 66 80 00 00 	movabs $0x806690,%rdi
+  8049ab:	00 00 00 
+  8049ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b3:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  8049ba:	00 00 00 
+  8049bd:	41 ff d0             	call   *%r8
+  8049c0:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8049c7:	eb 6c                	jmp    804a35 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8049c9:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049d0:	ff ff ff 
+  8049d3:	4c 21 e2             	and    %r12,%rdx
+  8049d6:	48 89 d8             	mov    %rbx,%rax
+  8049d9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8049de:	48 83 c0 01          	add    $0x1,%rax
+  8049e2:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8049e6:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8049ed:	00 00 00 
+  8049f0:	48 21 c8             	and    %rcx,%rax
+  8049f3:	48 09 d0             	or     %rdx,%rax
+  8049f6:	49 89 c4             	mov    %rax,%r12
+  8049f9:	eb 30                	jmp    804a2b <foreach_shared_region+0xd8>
+  8049fb:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804a02:	ff ff ff 
+  804a05:	4c 21 e2             	and    %r12,%rdx
+  804a08:	48 89 d8             	mov    %rbx,%rax
+  804a0b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a10:	48 83 c0 01          	add    $0x1,%rax
+  804a14:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804a18:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804a1f:	00 00 00 
+  804a22:	48 21 c8             	and    %rcx,%rax
+  804a25:	48 09 d0             	or     %rdx,%rax
+  804a28:	49 89 c4             	mov    %rax,%r12
+  804a2b:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804a2f:	0f 84 99 01 00 00    	je     804bce <foreach_shared_region+0x27b>
+  804a35:	4c 89 e3             	mov    %r12,%rbx
+  804a38:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804a3c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804a43:	01 00 00 
+  804a46:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a4a:	a8 01                	test   $0x1,%al
+  804a4c:	0f 84 77 ff ff ff    	je     8049c9 <foreach_shared_region+0x76>
+  804a52:	a8 80                	test   $0x80,%al
+  804a54:	74 19                	je     804a6f <foreach_shared_region+0x11c>
+  804a56:	f6 c4 04             	test   $0x4,%ah
+  804a59:	74 a0                	je     8049fb <foreach_shared_region+0xa8>
+  804a5b:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804a62:	40 
+  804a63:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a67:	4c 89 e7             	mov    %r12,%rdi
+  804a6a:	41 ff d7             	call   *%r15
+  804a6d:	eb 8c                	jmp    8049fb <foreach_shared_region+0xa8>
+  804a6f:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804a76:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804a7a:	eb 46                	jmp    804ac2 <foreach_shared_region+0x16f>
+  804a7c:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a83:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a89:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a8d:	48 c1 e0 15          	shl    $0x15,%rax
+  804a91:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a96:	49 09 c4             	or     %rax,%r12
+  804a99:	eb 1d                	jmp    804ab8 <foreach_shared_region+0x165>
+  804a9b:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804aa2:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804aa8:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804aac:	48 c1 e0 15          	shl    $0x15,%rax
+  804ab0:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804ab5:	49 09 c4             	or     %rax,%r12
+  804ab8:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804abc:	0f 84 d3 00 00 00    	je     804b95 <foreach_shared_region+0x242>
+  804ac2:	4c 89 e3             	mov    %r12,%rbx
+  804ac5:	48 c1 eb 15          	shr    $0x15,%rbx
+  804ac9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804ad0:	01 00 00 
+  804ad3:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804ad7:	a8 01                	test   $0x1,%al
+  804ad9:	74 a1                	je     804a7c <foreach_shared_region+0x129>
+  804adb:	a8 80                	test   $0x80,%al
+  804add:	74 19                	je     804af8 <foreach_shared_region+0x1a5>
+  804adf:	f6 c4 04             	test   $0x4,%ah
+  804ae2:	74 b7                	je     804a9b <foreach_shared_region+0x148>
+  804ae4:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804aeb:	00 
+  804aec:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804af0:	4c 89 e7             	mov    %r12,%rdi
+  804af3:	41 ff d7             	call   *%r15
+  804af6:	eb a3                	jmp    804a9b <foreach_shared_region+0x148>
+  804af8:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804afe:	eb 3b                	jmp    804b3b <foreach_shared_region+0x1e8>
+  804b00:	f6 c4 04             	test   $0x4,%ah
+  804b03:	74 12                	je     804b17 <foreach_shared_region+0x1c4>
+  804b05:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804b0c:	00 
+  804b0d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b11:	4c 89 e7             	mov    %r12,%rdi
+  804b14:	41 ff d7             	call   *%r15
+  804b17:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b1e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b24:	48 83 c3 01          	add    $0x1,%rbx
+  804b28:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b2c:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b32:	49 09 dc             	or     %rbx,%r12
+  804b35:	41 83 ed 01          	sub    $0x1,%r13d
+  804b39:	74 2f                	je     804b6a <foreach_shared_region+0x217>
+  804b3b:	4c 89 e3             	mov    %r12,%rbx
+  804b3e:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804b42:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804b46:	a8 01                	test   $0x1,%al
+  804b48:	75 b6                	jne    804b00 <foreach_shared_region+0x1ad>
+  804b4a:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b51:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b57:	48 83 c3 01          	add    $0x1,%rbx
+  804b5b:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b5f:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b65:	49 09 dc             	or     %rbx,%r12
+  804b68:	eb cb                	jmp    804b35 <foreach_shared_region+0x1e2>
+  804b6a:	4c 89 e0             	mov    %r12,%rax
+  804b6d:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804b73:	49 c1 ec 15          	shr    $0x15,%r12
+  804b77:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b7e:	49 83 c4 01          	add    $0x1,%r12
+  804b82:	49 c1 e4 15          	shl    $0x15,%r12
+  804b86:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804b8d:	49 09 c4             	or     %rax,%r12
+  804b90:	e9 23 ff ff ff       	jmp    804ab8 <foreach_shared_region+0x165>
+  804b95:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804b99:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804ba0:	ff ff ff 
+  804ba3:	4c 21 e0             	and    %r12,%rax
+  804ba6:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804baa:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804bb1:	49 83 c4 01          	add    $0x1,%r12
+  804bb5:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804bb9:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804bc0:	00 00 00 
+  804bc3:	49 21 d4             	and    %rdx,%r12
+  804bc6:	49 09 c4             	or     %rax,%r12
+  804bc9:	e9 5d fe ff ff       	jmp    804a2b <foreach_shared_region+0xd8>
+  804bce:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804bd5:	00 ff ff 
+  804bd8:	4c 21 e0             	and    %r12,%rax
+  804bdb:	49 c1 ec 27          	shr    $0x27,%r12
+  804bdf:	49 83 c4 01          	add    $0x1,%r12
+  804be3:	49 c1 e4 27          	shl    $0x27,%r12
+  804be7:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804bee:	ff 00 00 
+  804bf1:	49 21 d4             	and    %rdx,%r12
+  804bf4:	49 09 c4             	or     %rax,%r12
+  804bf7:	41 83 ed 01          	sub    $0x1,%r13d
+  804bfb:	74 48                	je     804c45 <foreach_shared_region+0x2f2>
+  804bfd:	4c 89 e0             	mov    %r12,%rax
+  804c00:	48 c1 e8 27          	shr    $0x27,%rax
+  804c04:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804c0b:	01 00 00 
+  804c0e:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804c12:	f6 c2 01             	test   $0x1,%dl
+  804c15:	0f 85 a5 fd ff ff    	jne    8049c0 <foreach_shared_region+0x6d>
+  804c1b:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804c22:	00 ff ff 
+  804c25:	4c 21 e2             	and    %r12,%rdx
+  804c28:	48 83 c0 01          	add    $0x1,%rax
+  804c2c:	48 c1 e0 27          	shl    $0x27,%rax
+  804c30:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804c37:	ff 00 00 
+  804c3a:	48 21 c8             	and    %rcx,%rax
+  804c3d:	48 09 d0             	or     %rdx,%rax
+  804c40:	49 89 c4             	mov    %rax,%r12
+  804c43:	eb b2                	jmp    804bf7 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804c45:	4d 85 e4             	test   %r12,%r12
+  804c48:	75 14                	jne    804c5e <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c4f:	48 83 c4 28          	add    $0x28,%rsp
+  804c53:	5b                   	pop    %rbx
+  804c54:	41 5c                	pop    %r12
+  804c56:	41 5d                	pop    %r13
+  804c58:	41 5e                	pop    %r14
+  804c5a:	41 5f                	pop    %r15
+  804c5c:	5d                   	pop    %rbp
+  804c5d:	c3                   	ret
+    assert(addr == 0);
+  804c5e:	48 b9 9b 66 80 00 00 	movabs $0x80669b,%rcx
+  804c65:	00 00 00 
+  804c68:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  804c6f:	00 00 00 
+  804c72:	be 67 00 00 00       	mov    $0x67,%esi
+  804c77:	48 bf 90 66 80 00 00 	movabs $0x806690,%rdi
+  804c7e:	00 00 00 
+  804c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c86:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  804c8d:	00 00 00 
+  804c90:	41 ff d0             	call   *%r8
+
+0000000000804c93 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804c93:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804c9a:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804c9d:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804ca3:	eb 33                	jmp    804cd8 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ca5:	48 83 c0 20          	add    $0x20,%rax
+  804ca9:	4c 39 c0             	cmp    %r8,%rax
+  804cac:	74 25                	je     804cd3 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804cae:	48 8b 10             	mov    (%rax),%rdx
+  804cb1:	48 85 d2             	test   %rdx,%rdx
+  804cb4:	74 ef                	je     804ca5 <mmap_place+0x12>
+  804cb6:	48 89 d1             	mov    %rdx,%rcx
+  804cb9:	48 03 48 08          	add    0x8(%rax),%rcx
+  804cbd:	48 39 cf             	cmp    %rcx,%rdi
+  804cc0:	73 e3                	jae    804ca5 <mmap_place+0x12>
+  804cc2:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804cc6:	4c 39 ca             	cmp    %r9,%rdx
+  804cc9:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804ccd:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804cd1:	eb d2                	jmp    804ca5 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804cd3:	45 84 d2             	test   %r10b,%r10b
+  804cd6:	74 12                	je     804cea <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cd8:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cdf:	00 00 00 
+        moved = 0;
+  804ce2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804ce8:	eb c4                	jmp    804cae <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804cea:	48 01 fe             	add    %rdi,%rsi
+  804ced:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804cf4:	00 00 00 
+  804cf7:	48 39 f0             	cmp    %rsi,%rax
+  804cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cff:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804d03:	c3                   	ret
+
+0000000000804d04 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804d04:	55                   	push   %rbp
+  804d05:	48 89 e5             	mov    %rsp,%rbp
+  804d08:	41 57                	push   %r15
+  804d0a:	41 56                	push   %r14
+  804d0c:	41 55                	push   %r13
+  804d0e:	41 54                	push   %r12
+  804d10:	53                   	push   %rbx
+  804d11:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804d15:	48 8b 1f             	mov    (%rdi),%rbx
+  804d18:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d1f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d26:	00 00 00 
+  804d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d2e:	eb 12                	jmp    804d42 <mmap_pgfault+0x3e>
+  804d30:	48 83 c2 01          	add    $0x1,%rdx
+  804d34:	48 83 c0 20          	add    $0x20,%rax
+  804d38:	48 83 fa 20          	cmp    $0x20,%rdx
+  804d3c:	0f 84 04 01 00 00    	je     804e46 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804d42:	48 8b 08             	mov    (%rax),%rcx
+  804d45:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804d49:	48 39 de             	cmp    %rbx,%rsi
+  804d4c:	73 e2                	jae    804d30 <mmap_pgfault+0x2c>
+  804d4e:	48 03 48 08          	add    0x8(%rax),%rcx
+  804d52:	48 39 cb             	cmp    %rcx,%rbx
+  804d55:	73 d9                	jae    804d30 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804d57:	48 c1 e2 05          	shl    $0x5,%rdx
+  804d5b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d62:	00 00 00 
+  804d65:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804d69:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804d6d:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804d71:	f6 c2 01             	test   $0x1,%dl
+  804d74:	0f 84 e0 00 00 00    	je     804e5a <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d7f:	f6 c2 02             	test   $0x2,%dl
+  804d82:	0f 84 c3 00 00 00    	je     804e4b <mmap_pgfault+0x147>
+  804d88:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804d8f:	ff ff ff 
+  804d92:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804d96:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804d9d:	00 00 00 
+  804da0:	48 39 ca             	cmp    %rcx,%rdx
+  804da3:	0f 85 a2 00 00 00    	jne    804e4b <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804da9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804dae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804db3:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804dba:	00 00 00 
+  804dbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dc2:	48 b8 1f 29 80 00 00 	movabs $0x80291f,%rax
+  804dc9:	00 00 00 
+  804dcc:	ff d0                	call   *%rax
+  804dce:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd5:	85 d2                	test   %edx,%edx
+  804dd7:	78 72                	js     804e4b <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804dd9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dde:	48 89 de             	mov    %rbx,%rsi
+  804de1:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804de8:	00 00 00 
+  804deb:	4c 89 e7             	mov    %r12,%rdi
+  804dee:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  804df5:	00 00 00 
+  804df8:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804dfa:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804e00:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804e06:	48 89 d9             	mov    %rbx,%rcx
+  804e09:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e0e:	4c 89 e6             	mov    %r12,%rsi
+  804e11:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e16:	48 b8 8c 29 80 00 00 	movabs $0x80298c,%rax
+  804e1d:	00 00 00 
+  804e20:	ff d0                	call   *%rax
+  804e22:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804e24:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e29:	4c 89 e6             	mov    %r12,%rsi
+  804e2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e31:	48 b8 f7 29 80 00 00 	movabs $0x8029f7,%rax
+  804e38:	00 00 00 
+  804e3b:	ff d0                	call   *%rax
+    return res >= 0;
+  804e3d:	89 d8                	mov    %ebx,%eax
+  804e3f:	f7 d0                	not    %eax
+  804e41:	c1 e8 1f             	shr    $0x1f,%eax
+  804e44:	eb 05                	jmp    804e4b <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804e46:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804e4b:	48 83 c4 18          	add    $0x18,%rsp
+  804e4f:	5b                   	pop    %rbx
+  804e50:	41 5c                	pop    %r12
+  804e52:	41 5d                	pop    %r13
+  804e54:	41 5e                	pop    %r14
+  804e56:	41 5f                	pop    %r15
+  804e58:	5d                   	pop    %rbp
+  804e59:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804e5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e5e:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804e62:	4c 03 30             	add    (%rax),%r14
+  804e65:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804e6c:	49 39 c6             	cmp    %rax,%r14
+  804e6f:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e73:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804e7a:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e80:	49 bf 3e 49 80 00 00 	movabs $0x80493e,%r15
+  804e87:	00 00 00 
+  804e8a:	4d 39 f4             	cmp    %r14,%r12
+  804e8d:	73 1d                	jae    804eac <mmap_pgfault+0x1a8>
+  804e8f:	4c 89 e7             	mov    %r12,%rdi
+  804e92:	41 ff d7             	call   *%r15
+  804e95:	84 c0                	test   %al,%al
+  804e97:	75 13                	jne    804eac <mmap_pgfault+0x1a8>
+  804e99:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804ea0:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804ea7:	4d 39 f4             	cmp    %r14,%r12
+  804eaa:	72 e3                	jb     804e8f <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804eac:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804eb2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804eb6:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804eba:	74 2a                	je     804ee6 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804ebc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ec0:	89 de                	mov    %ebx,%esi
+  804ec2:	2b 30                	sub    (%rax),%esi
+  804ec4:	03 70 1c             	add    0x1c(%rax),%esi
+  804ec7:	8b 78 18             	mov    0x18(%rax),%edi
+  804eca:	4c 89 e9             	mov    %r13,%rcx
+  804ecd:	48 89 da             	mov    %rbx,%rdx
+  804ed0:	48 b8 9c 40 80 00 00 	movabs $0x80409c,%rax
+  804ed7:	00 00 00 
+  804eda:	ff d0                	call   *%rax
+    return res > 0;
+  804edc:	85 c0                	test   %eax,%eax
+  804ede:	0f 9f c0             	setg   %al
+  804ee1:	e9 65 ff ff ff       	jmp    804e4b <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804ee6:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804eea:	eb d0                	jmp    804ebc <mmap_pgfault+0x1b8>
+
+0000000000804eec <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804eec:	55                   	push   %rbp
+  804eed:	48 89 e5             	mov    %rsp,%rbp
+  804ef0:	41 57                	push   %r15
+  804ef2:	41 56                	push   %r14
+  804ef4:	41 55                	push   %r13
+  804ef6:	41 54                	push   %r12
+  804ef8:	53                   	push   %rbx
+  804ef9:	48 83 ec 28          	sub    $0x28,%rsp
+  804efd:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804f01:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804f04:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804f0b:	ff ff ff 
+  804f0e:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f17:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804f1e:	00 00 00 
+  804f21:	48 39 ca             	cmp    %rcx,%rdx
+  804f24:	0f 85 e5 00 00 00    	jne    80500f <mmap_writeback+0x123>
+  804f2a:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804f2d:	4c 39 ee             	cmp    %r13,%rsi
+  804f30:	0f 83 e8 00 00 00    	jae    80501e <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f36:	49 be 3e 49 80 00 00 	movabs $0x80493e,%r14
+  804f3d:	00 00 00 
+  804f40:	49 bf 25 49 80 00 00 	movabs $0x804925,%r15
+  804f47:	00 00 00 
+  804f4a:	eb 10                	jmp    804f5c <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804f4c:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804f53:	4d 39 ec             	cmp    %r13,%r12
+  804f56:	0f 83 ae 00 00 00    	jae    80500a <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f5c:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804f60:	4c 89 e7             	mov    %r12,%rdi
+  804f63:	41 ff d6             	call   *%r14
+  804f66:	84 c0                	test   %al,%al
+  804f68:	74 e2                	je     804f4c <mmap_writeback+0x60>
+  804f6a:	4c 89 e7             	mov    %r12,%rdi
+  804f6d:	41 ff d7             	call   *%r15
+  804f70:	84 c0                	test   %al,%al
+  804f72:	74 d8                	je     804f4c <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804f74:	4c 89 e3             	mov    %r12,%rbx
+  804f77:	4d 39 ec             	cmp    %r13,%r12
+  804f7a:	73 20                	jae    804f9c <mmap_writeback+0xb0>
+  804f7c:	48 89 df             	mov    %rbx,%rdi
+  804f7f:	41 ff d6             	call   *%r14
+  804f82:	84 c0                	test   %al,%al
+  804f84:	74 16                	je     804f9c <mmap_writeback+0xb0>
+  804f86:	48 89 df             	mov    %rbx,%rdi
+  804f89:	41 ff d7             	call   *%r15
+  804f8c:	84 c0                	test   %al,%al
+  804f8e:	74 0c                	je     804f9c <mmap_writeback+0xb0>
+  804f90:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804f97:	4c 39 eb             	cmp    %r13,%rbx
+  804f9a:	72 e0                	jb     804f7c <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804f9c:	48 89 d9             	mov    %rbx,%rcx
+  804f9f:	4c 29 e1             	sub    %r12,%rcx
+  804fa2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804fa6:	44 89 e6             	mov    %r12d,%esi
+  804fa9:	2b 30                	sub    (%rax),%esi
+  804fab:	49 89 c4             	mov    %rax,%r12
+  804fae:	03 70 1c             	add    0x1c(%rax),%esi
+  804fb1:	8b 78 18             	mov    0x18(%rax),%edi
+  804fb4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804fb8:	48 89 ca             	mov    %rcx,%rdx
+  804fbb:	48 b8 25 41 80 00 00 	movabs $0x804125,%rax
+  804fc2:	00 00 00 
+  804fc5:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804fc7:	85 c0                	test   %eax,%eax
+  804fc9:	78 44                	js     80500f <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804fcb:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804fd0:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804fd3:	41 89 c1             	mov    %eax,%r9d
+  804fd6:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804fdd:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804fe1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fea:	48 89 ce             	mov    %rcx,%rsi
+  804fed:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ff2:	48 b8 8c 29 80 00 00 	movabs $0x80298c,%rax
+  804ff9:	00 00 00 
+  804ffc:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804ffe:	85 c0                	test   %eax,%eax
+  805000:	78 0d                	js     80500f <mmap_writeback+0x123>
+  805002:	49 89 dc             	mov    %rbx,%r12
+  805005:	e9 49 ff ff ff       	jmp    804f53 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  80500a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80500f:	48 83 c4 28          	add    $0x28,%rsp
+  805013:	5b                   	pop    %rbx
+  805014:	41 5c                	pop    %r12
+  805016:	41 5d                	pop    %r13
+  805018:	41 5e                	pop    %r14
+  80501a:	41 5f                	pop    %r15
+  80501c:	5d                   	pop    %rbp
+  80501d:	c3                   	ret
+    return 0;
+  80501e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805023:	eb ea                	jmp    80500f <mmap_writeback+0x123>
+
+0000000000805025 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805025:	55                   	push   %rbp
+  805026:	48 89 e5             	mov    %rsp,%rbp
+  805029:	41 57                	push   %r15
+  80502b:	41 56                	push   %r14
+  80502d:	41 55                	push   %r13
+  80502f:	41 54                	push   %r12
+  805031:	53                   	push   %rbx
+  805032:	48 83 ec 38          	sub    $0x38,%rsp
+  805036:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80503a:	48 85 f6             	test   %rsi,%rsi
+  80503d:	0f 84 0c 02 00 00    	je     80524f <mmap+0x22a>
+  805043:	49 89 ff             	mov    %rdi,%r15
+  805046:	49 89 f4             	mov    %rsi,%r12
+  805049:	41 89 d5             	mov    %edx,%r13d
+  80504c:	41 89 ce             	mov    %ecx,%r14d
+  80504f:	44 89 cb             	mov    %r9d,%ebx
+  805052:	45 85 c9             	test   %r9d,%r9d
+  805055:	0f 88 f4 01 00 00    	js     80524f <mmap+0x22a>
+  80505b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805062:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805069:	0f 85 e7 01 00 00    	jne    805256 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  80506f:	83 e2 fd             	and    $0xfffffffd,%edx
+  805072:	83 fa 04             	cmp    $0x4,%edx
+  805075:	0f 85 db 01 00 00    	jne    805256 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  80507b:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80507e:	83 fa 01             	cmp    $0x1,%edx
+  805081:	0f 87 cf 01 00 00    	ja     805256 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805087:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80508b:	44 89 c7             	mov    %r8d,%edi
+  80508e:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  805095:	00 00 00 
+  805098:	ff d0                	call   *%rax
+  80509a:	89 c2                	mov    %eax,%edx
+  80509c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050a3:	85 d2                	test   %edx,%edx
+  8050a5:	0f 88 ab 01 00 00    	js     805256 <mmap+0x231>
+  8050ab:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8050af:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8050b6:	00 00 00 
+  8050b9:	8b 09                	mov    (%rcx),%ecx
+  8050bb:	39 0a                	cmp    %ecx,(%rdx)
+  8050bd:	0f 85 93 01 00 00    	jne    805256 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8050c3:	8b 52 08             	mov    0x8(%rdx),%edx
+  8050c6:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8050c9:	83 fa 01             	cmp    $0x1,%edx
+  8050cc:	0f 84 84 01 00 00    	je     805256 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8050d2:	41 83 fe 01          	cmp    $0x1,%r14d
+  8050d6:	74 42                	je     80511a <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8050d8:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8050df:	4c 89 e6             	mov    %r12,%rsi
+  8050e2:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8050e9:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8050ed:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8050f1:	4d 85 ff             	test   %r15,%r15
+  8050f4:	74 67                	je     80515d <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050f6:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8050fd:	75 0f                	jne    80510e <mmap+0xe9>
+  8050ff:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805106:	00 00 00 
+  805109:	49 39 c7             	cmp    %rax,%r15
+  80510c:	77 1b                	ja     805129 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80510e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805115:	e9 3c 01 00 00       	jmp    805256 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80511a:	41 f6 c5 02          	test   $0x2,%r13b
+  80511e:	74 b8                	je     8050d8 <mmap+0xb3>
+  805120:	85 d2                	test   %edx,%edx
+  805122:	75 b4                	jne    8050d8 <mmap+0xb3>
+  805124:	e9 2d 01 00 00       	jmp    805256 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805129:	4c 89 ff             	mov    %r15,%rdi
+  80512c:	48 b8 93 4c 80 00 00 	movabs $0x804c93,%rax
+  805133:	00 00 00 
+  805136:	ff d0                	call   *%rax
+  805138:	48 89 c2             	mov    %rax,%rdx
+  80513b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805142:	49 39 d7             	cmp    %rdx,%r15
+  805145:	0f 85 0b 01 00 00    	jne    805256 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80514b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805152:	00 00 00 
+  805155:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80515b:	eb 44                	jmp    8051a1 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80515d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805161:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805168:	00 00 00 
+  80516b:	48 b8 93 4c 80 00 00 	movabs $0x804c93,%rax
+  805172:	00 00 00 
+  805175:	ff d0                	call   *%rax
+  805177:	48 89 c7             	mov    %rax,%rdi
+  80517a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  80517e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805185:	48 85 ff             	test   %rdi,%rdi
+  805188:	75 c1                	jne    80514b <mmap+0x126>
+  80518a:	e9 c7 00 00 00       	jmp    805256 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80518f:	49 83 c4 01          	add    $0x1,%r12
+  805193:	48 83 c0 20          	add    $0x20,%rax
+  805197:	49 83 fc 20          	cmp    $0x20,%r12
+  80519b:	0f 84 a5 00 00 00    	je     805246 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8051a1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8051a5:	75 e8                	jne    80518f <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  8051a7:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8051ab:	48 b8 df 33 80 00 00 	movabs $0x8033df,%rax
+  8051b2:	00 00 00 
+  8051b5:	ff d0                	call   *%rax
+  8051b7:	89 c2                	mov    %eax,%edx
+  8051b9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051c0:	85 d2                	test   %edx,%edx
+  8051c2:	0f 88 8e 00 00 00    	js     805256 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8051c8:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8051cc:	48 b8 b1 33 80 00 00 	movabs $0x8033b1,%rax
+  8051d3:	00 00 00 
+  8051d6:	ff d0                	call   *%rax
+  8051d8:	89 c6                	mov    %eax,%esi
+  8051da:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8051dd:	48 b8 ff 35 80 00 00 	movabs $0x8035ff,%rax
+  8051e4:	00 00 00 
+  8051e7:	ff d0                	call   *%rax
+  8051e9:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8051ec:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051f3:	45 85 ff             	test   %r15d,%r15d
+  8051f6:	78 5e                	js     805256 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8051f8:	49 c1 e4 05          	shl    $0x5,%r12
+  8051fc:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805203:	00 00 00 
+  805206:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805209:	48 bf 04 4d 80 00 00 	movabs $0x804d04,%rdi
+  805210:	00 00 00 
+  805213:	48 b8 2f 57 80 00 00 	movabs $0x80572f,%rax
+  80521a:	00 00 00 
+  80521d:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  80521f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805223:	49 89 04 24          	mov    %rax,(%r12)
+  805227:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80522b:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805230:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805235:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80523a:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  80523f:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805244:	eb 10                	jmp    805256 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805246:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80524d:	eb 07                	jmp    805256 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80524f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805256:	48 83 c4 38          	add    $0x38,%rsp
+  80525a:	5b                   	pop    %rbx
+  80525b:	41 5c                	pop    %r12
+  80525d:	41 5d                	pop    %r13
+  80525f:	41 5e                	pop    %r14
+  805261:	41 5f                	pop    %r15
+  805263:	5d                   	pop    %rbp
+  805264:	c3                   	ret
+
+0000000000805265 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805265:	55                   	push   %rbp
+  805266:	48 89 e5             	mov    %rsp,%rbp
+  805269:	41 57                	push   %r15
+  80526b:	41 56                	push   %r14
+  80526d:	41 55                	push   %r13
+  80526f:	41 54                	push   %r12
+  805271:	53                   	push   %rbx
+  805272:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805276:	49 89 fe             	mov    %rdi,%r14
+  805279:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805280:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805287:	00 
+  805288:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80528f:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805296:	00 00 00 
+  805299:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8052a0:	49 bf ec 4e 80 00 00 	movabs $0x804eec,%r15
+  8052a7:	00 00 00 
+  8052aa:	eb 09                	jmp    8052b5 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052ac:	48 83 c3 20          	add    $0x20,%rbx
+  8052b0:	4c 39 eb             	cmp    %r13,%rbx
+  8052b3:	74 33                	je     8052e8 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052b5:	48 89 df             	mov    %rbx,%rdi
+  8052b8:	48 8b 33             	mov    (%rbx),%rsi
+  8052bb:	4c 39 e6             	cmp    %r12,%rsi
+  8052be:	73 ec                	jae    8052ac <msync+0x47>
+  8052c0:	48 85 f6             	test   %rsi,%rsi
+  8052c3:	74 e7                	je     8052ac <msync+0x47>
+  8052c5:	48 89 f2             	mov    %rsi,%rdx
+  8052c8:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8052cc:	49 39 d6             	cmp    %rdx,%r14
+  8052cf:	73 db                	jae    8052ac <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8052d1:	4c 39 e2             	cmp    %r12,%rdx
+  8052d4:	49 0f 47 d4          	cmova  %r12,%rdx
+  8052d8:	4c 39 f6             	cmp    %r14,%rsi
+  8052db:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8052df:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8052e2:	85 c0                	test   %eax,%eax
+  8052e4:	79 c6                	jns    8052ac <msync+0x47>
+  8052e6:	eb 05                	jmp    8052ed <msync+0x88>
+    }
+
+    return 0;
+  8052e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052ed:	48 83 c4 08          	add    $0x8,%rsp
+  8052f1:	5b                   	pop    %rbx
+  8052f2:	41 5c                	pop    %r12
+  8052f4:	41 5d                	pop    %r13
+  8052f6:	41 5e                	pop    %r14
+  8052f8:	41 5f                	pop    %r15
+  8052fa:	5d                   	pop    %rbp
+  8052fb:	c3                   	ret
+
+00000000008052fc <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8052fc:	55                   	push   %rbp
+  8052fd:	48 89 e5             	mov    %rsp,%rbp
+  805300:	41 57                	push   %r15
+  805302:	41 56                	push   %r14
+  805304:	41 55                	push   %r13
+  805306:	41 54                	push   %r12
+  805308:	53                   	push   %rbx
+  805309:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80530d:	49 89 ff             	mov    %rdi,%r15
+  805310:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805317:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80531e:	00 
+  80531f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805326:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  80532d:	00 00 00 
+  805330:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805337:	48 89 d8             	mov    %rbx,%rax
+  80533a:	eb 09                	jmp    805345 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80533c:	48 83 c0 20          	add    $0x20,%rax
+  805340:	4c 39 f0             	cmp    %r14,%rax
+  805343:	74 40                	je     805385 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805345:	48 8b 10             	mov    (%rax),%rdx
+  805348:	4c 39 e2             	cmp    %r12,%rdx
+  80534b:	73 ef                	jae    80533c <munmap+0x40>
+  80534d:	48 85 d2             	test   %rdx,%rdx
+  805350:	74 ea                	je     80533c <munmap+0x40>
+  805352:	48 89 d7             	mov    %rdx,%rdi
+  805355:	48 03 78 08          	add    0x8(%rax),%rdi
+  805359:	49 39 ff             	cmp    %rdi,%r15
+  80535c:	73 de                	jae    80533c <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  80535e:	49 39 fc             	cmp    %rdi,%r12
+  805361:	72 05                	jb     805368 <munmap+0x6c>
+  805363:	4c 39 fa             	cmp    %r15,%rdx
+  805366:	73 d4                	jae    80533c <munmap+0x40>
+  805368:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80536d:	48 83 c4 08          	add    $0x8,%rsp
+  805371:	5b                   	pop    %rbx
+  805372:	41 5c                	pop    %r12
+  805374:	41 5d                	pop    %r13
+  805376:	41 5e                	pop    %r14
+  805378:	41 5f                	pop    %r15
+  80537a:	5d                   	pop    %rbp
+  80537b:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80537c:	48 83 c3 20          	add    $0x20,%rbx
+  805380:	4c 39 f3             	cmp    %r14,%rbx
+  805383:	74 5c                	je     8053e1 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805385:	48 8b 33             	mov    (%rbx),%rsi
+  805388:	4c 39 e6             	cmp    %r12,%rsi
+  80538b:	73 ef                	jae    80537c <munmap+0x80>
+  80538d:	48 85 f6             	test   %rsi,%rsi
+  805390:	74 ea                	je     80537c <munmap+0x80>
+  805392:	48 89 f2             	mov    %rsi,%rdx
+  805395:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805399:	49 39 d7             	cmp    %rdx,%r15
+  80539c:	73 de                	jae    80537c <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  80539e:	48 89 df             	mov    %rbx,%rdi
+  8053a1:	48 b8 ec 4e 80 00 00 	movabs $0x804eec,%rax
+  8053a8:	00 00 00 
+  8053ab:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8053ad:	85 c0                	test   %eax,%eax
+  8053af:	78 bc                	js     80536d <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8053b1:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8053b5:	48 8b 33             	mov    (%rbx),%rsi
+  8053b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053bd:	48 b8 f7 29 80 00 00 	movabs $0x8029f7,%rax
+  8053c4:	00 00 00 
+  8053c7:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8053c9:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8053cc:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  8053d3:	00 00 00 
+  8053d6:	ff d0                	call   *%rax
+        reg->start = 0;
+  8053d8:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8053df:	eb 9b                	jmp    80537c <munmap+0x80>
+    return 0;
+  8053e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053e6:	eb 85                	jmp    80536d <munmap+0x71>
+
+00000000008053e8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8053e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053ed:	c3                   	ret
+
+00000000008053ee <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8053ee:	55                   	push   %rbp
+  8053ef:	48 89 e5             	mov    %rsp,%rbp
+  8053f2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8053f5:	48 be a5 66 80 00 00 	movabs $0x8066a5,%rsi
+  8053fc:	00 00 00 
+  8053ff:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  805406:	00 00 00 
+  805409:	ff d0                	call   *%rax
+    return 0;
+}
+  80540b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805410:	5d                   	pop    %rbp
+  805411:	c3                   	ret
+
+0000000000805412 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805412:	55                   	push   %rbp
+  805413:	48 89 e5             	mov    %rsp,%rbp
+  805416:	41 57                	push   %r15
+  805418:	41 56                	push   %r14
+  80541a:	41 55                	push   %r13
+  80541c:	41 54                	push   %r12
+  80541e:	53                   	push   %rbx
+  80541f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805426:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80542d:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805434:	00 00 00 00 
+  805438:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  80543f:	00 00 00 00 
+  805443:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80544a:	00 00 00 00 
+  80544e:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805455:	00 00 00 00 
+  805459:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805460:	00 00 00 00 
+  805464:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  80546b:	00 00 00 00 
+  80546f:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805476:	00 
+  805477:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  80547e:	00 
+  80547f:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805486:	00 
+  805487:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  80548e:	00 
+  80548f:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805496:	00 
+  805497:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  80549e:	00 
+  80549f:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8054a6:	00 
+  8054a7:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8054ae:	00 
+  8054af:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8054b6:	00 
+  8054b7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8054be:	00 
+    for (res = 0; res < n; res += inc) {
+  8054bf:	48 85 d2             	test   %rdx,%rdx
+  8054c2:	74 7a                	je     80553e <devcons_write+0x12c>
+  8054c4:	49 89 d6             	mov    %rdx,%r14
+  8054c7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054cd:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8054d2:	49 bf 0a 25 80 00 00 	movabs $0x80250a,%r15
+  8054d9:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8054dc:	4c 89 f3             	mov    %r14,%rbx
+  8054df:	48 29 f3             	sub    %rsi,%rbx
+  8054e2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8054e7:	48 39 c3             	cmp    %rax,%rbx
+  8054ea:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8054ee:	4c 63 eb             	movslq %ebx,%r13
+  8054f1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8054f8:	48 01 c6             	add    %rax,%rsi
+  8054fb:	4c 89 ea             	mov    %r13,%rdx
+  8054fe:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805505:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805508:	4c 89 ee             	mov    %r13,%rsi
+  80550b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805512:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  805519:	00 00 00 
+  80551c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80551e:	41 01 dc             	add    %ebx,%r12d
+  805521:	49 63 f4             	movslq %r12d,%rsi
+  805524:	4c 39 f6             	cmp    %r14,%rsi
+  805527:	72 b3                	jb     8054dc <devcons_write+0xca>
+    return res;
+  805529:	49 63 c4             	movslq %r12d,%rax
+}
+  80552c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805533:	5b                   	pop    %rbx
+  805534:	41 5c                	pop    %r12
+  805536:	41 5d                	pop    %r13
+  805538:	41 5e                	pop    %r14
+  80553a:	41 5f                	pop    %r15
+  80553c:	5d                   	pop    %rbp
+  80553d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80553e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805544:	eb e3                	jmp    805529 <devcons_write+0x117>
+
+0000000000805546 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805546:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80554e:	48 85 c0             	test   %rax,%rax
+  805551:	74 55                	je     8055a8 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805553:	55                   	push   %rbp
+  805554:	48 89 e5             	mov    %rsp,%rbp
+  805557:	41 55                	push   %r13
+  805559:	41 54                	push   %r12
+  80555b:	53                   	push   %rbx
+  80555c:	48 83 ec 08          	sub    $0x8,%rsp
+  805560:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805563:	48 bb 6a 27 80 00 00 	movabs $0x80276a,%rbx
+  80556a:	00 00 00 
+  80556d:	49 bc 7e 28 80 00 00 	movabs $0x80287e,%r12
+  805574:	00 00 00 
+  805577:	eb 03                	jmp    80557c <devcons_read+0x36>
+  805579:	41 ff d4             	call   *%r12
+  80557c:	ff d3                	call   *%rbx
+  80557e:	85 c0                	test   %eax,%eax
+  805580:	74 f7                	je     805579 <devcons_read+0x33>
+    if (c < 0) return c;
+  805582:	48 63 d0             	movslq %eax,%rdx
+  805585:	78 13                	js     80559a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80558c:	83 f8 04             	cmp    $0x4,%eax
+  80558f:	74 09                	je     80559a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805591:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805595:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80559a:	48 89 d0             	mov    %rdx,%rax
+  80559d:	48 83 c4 08          	add    $0x8,%rsp
+  8055a1:	5b                   	pop    %rbx
+  8055a2:	41 5c                	pop    %r12
+  8055a4:	41 5d                	pop    %r13
+  8055a6:	5d                   	pop    %rbp
+  8055a7:	c3                   	ret
+  8055a8:	48 89 d0             	mov    %rdx,%rax
+  8055ab:	c3                   	ret
+
+00000000008055ac <cputchar>:
+cputchar(int ch) {
+  8055ac:	55                   	push   %rbp
+  8055ad:	48 89 e5             	mov    %rsp,%rbp
+  8055b0:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8055b4:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8055b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8055bd:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8055c1:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  8055c8:	00 00 00 
+  8055cb:	ff d0                	call   *%rax
+}
+  8055cd:	c9                   	leave
+  8055ce:	c3                   	ret
+
+00000000008055cf <getchar>:
+getchar(void) {
+  8055cf:	55                   	push   %rbp
+  8055d0:	48 89 e5             	mov    %rsp,%rbp
+  8055d3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8055d7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8055dc:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8055e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055e5:	48 b8 22 37 80 00 00 	movabs $0x803722,%rax
+  8055ec:	00 00 00 
+  8055ef:	ff d0                	call   *%rax
+  8055f1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8055f3:	85 c0                	test   %eax,%eax
+  8055f5:	78 06                	js     8055fd <getchar+0x2e>
+  8055f7:	74 08                	je     805601 <getchar+0x32>
+  8055f9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8055fd:	89 d0                	mov    %edx,%eax
+  8055ff:	c9                   	leave
+  805600:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805601:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805606:	eb f5                	jmp    8055fd <getchar+0x2e>
+
+0000000000805608 <iscons>:
+iscons(int fdnum) {
+  805608:	55                   	push   %rbp
+  805609:	48 89 e5             	mov    %rsp,%rbp
+  80560c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805610:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805614:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  80561b:	00 00 00 
+  80561e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805620:	85 c0                	test   %eax,%eax
+  805622:	78 18                	js     80563c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805624:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805628:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80562f:	00 00 00 
+  805632:	8b 00                	mov    (%rax),%eax
+  805634:	39 02                	cmp    %eax,(%rdx)
+  805636:	0f 94 c0             	sete   %al
+  805639:	0f b6 c0             	movzbl %al,%eax
+}
+  80563c:	c9                   	leave
+  80563d:	c3                   	ret
+
+000000000080563e <opencons>:
+opencons(void) {
+  80563e:	55                   	push   %rbp
+  80563f:	48 89 e5             	mov    %rsp,%rbp
+  805642:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805646:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80564a:	48 b8 df 33 80 00 00 	movabs $0x8033df,%rax
+  805651:	00 00 00 
+  805654:	ff d0                	call   *%rax
+  805656:	85 c0                	test   %eax,%eax
+  805658:	78 49                	js     8056a3 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80565a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80565f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805664:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805668:	bf 00 00 00 00       	mov    $0x0,%edi
+  80566d:	48 b8 1f 29 80 00 00 	movabs $0x80291f,%rax
+  805674:	00 00 00 
+  805677:	ff d0                	call   *%rax
+  805679:	85 c0                	test   %eax,%eax
+  80567b:	78 26                	js     8056a3 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80567d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805681:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805688:	00 00 
+  80568a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80568c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805690:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805697:	48 b8 b1 33 80 00 00 	movabs $0x8033b1,%rax
+  80569e:	00 00 00 
+  8056a1:	ff d0                	call   *%rax
+}
+  8056a3:	c9                   	leave
+  8056a4:	c3                   	ret
+
+00000000008056a5 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8056a5:	55                   	push   %rbp
+  8056a6:	48 89 e5             	mov    %rsp,%rbp
+  8056a9:	41 56                	push   %r14
+  8056ab:	41 55                	push   %r13
+  8056ad:	41 54                	push   %r12
+  8056af:	53                   	push   %rbx
+  8056b0:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056b3:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056ba:	00 00 00 
+  8056bd:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8056c1:	74 27                	je     8056ea <_handle_vectored_pagefault+0x45>
+  8056c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8056c8:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8056cf:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056d2:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8056d5:	4c 89 e7             	mov    %r12,%rdi
+  8056d8:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8056dd:	84 c0                	test   %al,%al
+  8056df:	75 45                	jne    805726 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056e1:	48 83 c3 01          	add    $0x1,%rbx
+  8056e5:	49 3b 1e             	cmp    (%r14),%rbx
+  8056e8:	72 eb                	jb     8056d5 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8056ea:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8056f1:	00 
+  8056f2:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8056f7:	4d 8b 04 24          	mov    (%r12),%r8
+  8056fb:	48 ba b8 66 80 00 00 	movabs $0x8066b8,%rdx
+  805702:	00 00 00 
+  805705:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80570a:	48 bf e8 66 80 00 00 	movabs $0x8066e8,%rdi
+  805711:	00 00 00 
+  805714:	b8 00 00 00 00       	mov    $0x0,%eax
+  805719:	49 ba 33 17 80 00 00 	movabs $0x801733,%r10
+  805720:	00 00 00 
+  805723:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805726:	5b                   	pop    %rbx
+  805727:	41 5c                	pop    %r12
+  805729:	41 5d                	pop    %r13
+  80572b:	41 5e                	pop    %r14
+  80572d:	5d                   	pop    %rbp
+  80572e:	c3                   	ret
+
+000000000080572f <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80572f:	55                   	push   %rbp
+  805730:	48 89 e5             	mov    %rsp,%rbp
+  805733:	53                   	push   %rbx
+  805734:	48 83 ec 08          	sub    $0x8,%rsp
+  805738:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80573b:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805740:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805747:	00 00 00 
+  80574a:	80 38 00             	cmpb   $0x0,(%rax)
+  80574d:	74 68                	je     8057b7 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80574f:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805756:	00 00 00 
+  805759:	48 8b 08             	mov    (%rax),%rcx
+  80575c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805761:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805768:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80576b:	48 85 c9             	test   %rcx,%rcx
+  80576e:	0f 84 e0 00 00 00    	je     805854 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805774:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805778:	0f 84 c9 00 00 00    	je     805847 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80577e:	48 83 c2 01          	add    $0x1,%rdx
+  805782:	48 39 ca             	cmp    %rcx,%rdx
+  805785:	75 ed                	jne    805774 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805787:	48 83 f9 08          	cmp    $0x8,%rcx
+  80578b:	0f 84 84 00 00 00    	je     805815 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805791:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805795:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80579c:	00 00 00 
+  80579f:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8057a6:	00 00 00 
+  8057a9:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8057ad:	85 f6                	test   %esi,%esi
+  8057af:	0f 89 97 00 00 00    	jns    80584c <add_pgfault_handler+0x11d>
+  8057b5:	eb 63                	jmp    80581a <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8057b7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8057bc:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8057c1:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8057c8:	00 00 00 
+  8057cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057d0:	48 b8 1f 29 80 00 00 	movabs $0x80291f,%rax
+  8057d7:	00 00 00 
+  8057da:	ff d0                	call   *%rax
+  8057dc:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057de:	85 c0                	test   %eax,%eax
+  8057e0:	78 38                	js     80581a <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8057e2:	48 be 30 59 80 00 00 	movabs $0x805930,%rsi
+  8057e9:	00 00 00 
+  8057ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057f1:	48 b8 42 2b 80 00 00 	movabs $0x802b42,%rax
+  8057f8:	00 00 00 
+  8057fb:	ff d0                	call   *%rax
+  8057fd:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8057ff:	85 c0                	test   %eax,%eax
+  805801:	78 17                	js     80581a <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805803:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80580a:	00 00 00 
+  80580d:	c6 00 01             	movb   $0x1,(%rax)
+  805810:	e9 3a ff ff ff       	jmp    80574f <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805815:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80581a:	89 f1                	mov    %esi,%ecx
+  80581c:	48 ba f6 66 80 00 00 	movabs $0x8066f6,%rdx
+  805823:	00 00 00 
+  805826:	be 42 00 00 00       	mov    $0x42,%esi
+  80582b:	48 bf e8 66 80 00 00 	movabs $0x8066e8,%rdi
+  805832:	00 00 00 
+  805835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80583a:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  805841:	00 00 00 
+  805844:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805847:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  80584c:	89 f0                	mov    %esi,%eax
+  80584e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805852:	c9                   	leave
+  805853:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805854:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80585b:	00 00 00 
+  80585e:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805865:	48 89 d8             	mov    %rbx,%rax
+  805868:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  80586f:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805872:	eb d8                	jmp    80584c <add_pgfault_handler+0x11d>
+
+0000000000805874 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805874:	55                   	push   %rbp
+  805875:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805878:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80587f:	00 00 00 
+  805882:	80 38 00             	cmpb   $0x0,(%rax)
+  805885:	74 33                	je     8058ba <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805887:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80588e:	00 00 00 
+  805891:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805896:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80589d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8058a0:	48 85 c0             	test   %rax,%rax
+  8058a3:	0f 84 85 00 00 00    	je     80592e <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8058a9:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8058ad:	74 40                	je     8058ef <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8058af:	48 83 c1 01          	add    $0x1,%rcx
+  8058b3:	48 39 c1             	cmp    %rax,%rcx
+  8058b6:	75 f1                	jne    8058a9 <remove_pgfault_handler+0x35>
+  8058b8:	eb 74                	jmp    80592e <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8058ba:	48 b9 0e 67 80 00 00 	movabs $0x80670e,%rcx
+  8058c1:	00 00 00 
+  8058c4:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  8058cb:	00 00 00 
+  8058ce:	be 48 00 00 00       	mov    $0x48,%esi
+  8058d3:	48 bf e8 66 80 00 00 	movabs $0x8066e8,%rdi
+  8058da:	00 00 00 
+  8058dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058e2:	49 b8 33 17 80 00 00 	movabs $0x801733,%r8
+  8058e9:	00 00 00 
+  8058ec:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8058ef:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8058f6:	00 
+  8058f7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8058fb:	48 29 ca             	sub    %rcx,%rdx
+  8058fe:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805905:	00 00 00 
+  805908:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80590c:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805911:	48 89 ce             	mov    %rcx,%rsi
+  805914:	48 b8 0a 25 80 00 00 	movabs $0x80250a,%rax
+  80591b:	00 00 00 
+  80591e:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805920:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805927:	00 00 00 
+  80592a:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80592e:	5d                   	pop    %rbp
+  80592f:	c3                   	ret
+
+0000000000805930 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805930:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805933:	48 b8 a5 56 80 00 00 	movabs $0x8056a5,%rax
+  80593a:	00 00 00 
+    call *%rax
+  80593d:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  80593f:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805946:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805947:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  80594e:	00 
+    subq $8, %rcx
+  80594f:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805953:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805956:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80595d:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  80595e:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805962:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805966:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80596b:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805970:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805975:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80597a:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80597f:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805984:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805989:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80598e:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805993:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805998:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80599d:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8059a2:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8059a7:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8059ac:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8059b0:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8059b4:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8059b5:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8059b6:	c3                   	ret
+  8059b7:	90                   	nop
+
+00000000008059b8 <__rodata_start>:
+  8059b8:	77 00                	ja     8059ba <__rodata_start+0x2>
+  8059ba:	72 62                	jb     805a1e <__rodata_start+0x66>
+  8059bc:	00 77 62             	add    %dh,0x62(%rdi)
+  8059bf:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 ed                	add    %ch,%ch
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	ed                   	in     (%dx),%eax
+  8059d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059de:	00 00                	add    %al,(%rax)
+  8059e0:	ed                   	in     (%dx),%eax
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 ed                	add    %ch,%ch
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	ed                   	in     (%dx),%eax
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ed                   	in     (%dx),%eax
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	8c 0a                	mov    %cs,(%rdx)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	8c 0a                	mov    %cs,(%rdx)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	8c 0a                	mov    %cs,(%rdx)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	8c 0a                	mov    %cs,(%rdx)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	8c 0a                	mov    %cs,(%rdx)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	ed                   	in     (%dx),%eax
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	ed                   	in     (%dx),%eax
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	f4                   	hlt
+  805b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b5f:	00 ed                	add    %ch,%ch
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	2c 0b                	sub    $0xb,%al
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 ed                	add    %ch,%ch
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	ed                   	in     (%dx),%eax
+  805b99:	0d 80 00 00 00       	or     $0x80,%eax
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	ed                   	in     (%dx),%eax
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	ed                   	in     (%dx),%eax
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805bb3:	00 00                	add    %al,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 cb                	add    %cl,%bl
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ed                   	in     (%dx),%eax
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	6a 0a                	push   $0xa
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 ed                	add    %ch,%ch
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	3c 0a                	cmp    $0xa,%al
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 ed                	add    %ch,%ch
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805c0b:	00 00                	add    %al,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 29                	add    %ch,(%rcx)
+  805c19:	0c 80                	or     $0x80,%al
+  805c1b:	00 00                	add    %al,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 ed                	add    %ch,%ch
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	1a 0b                	sbb    (%rbx),%cl
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 ed                	add    %ch,%ch
+  805c39:	0d 80 00 00 00       	or     $0x80,%eax
+  805c3e:	00 00                	add    %al,(%rax)
+  805c40:	ce                   	(bad)
+  805c41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c47:	00 ed                	add    %ch,%ch
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	f4                   	hlt
+  805c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c5f:	00 37                	add    %dh,(%rdi)
+  805c61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 37                	add    %dh,(%rdi)
+  805c71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805c8b:	00 00                	add    %al,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 d2                	add    %dl,%dl
+  805c91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c97:	00 d2                	add    %dl,%dl
+  805c99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c9f:	00 d2                	add    %dl,%dl
+  805ca1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ca7:	00 d2                	add    %dl,%dl
+  805ca9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805caf:	00 d2                	add    %dl,%dl
+  805cb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cb7:	00 d2                	add    %dl,%dl
+  805cb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cbf:	00 d2                	add    %dl,%dl
+  805cc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cc7:	00 f6                	add    %dh,%dh
+  805cc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ccf:	00 f6                	add    %dh,%dh
+  805cd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 22                	add    %ah,(%rdx)
+  805d11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d17:	00 22                	add    %ah,(%rdx)
+  805d19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d1f:	00 22                	add    %ah,(%rdx)
+  805d21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d27:	00 22                	add    %ah,(%rdx)
+  805d29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d2f:	00 22                	add    %ah,(%rdx)
+  805d31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d37:	00 22                	add    %ah,(%rdx)
+  805d39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 46 12             	add    %al,0x12(%rsi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 22                	add    %ah,(%rdx)
+  805e11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e17:	00 22                	add    %ah,(%rdx)
+  805e19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e1f:	00 22                	add    %ah,(%rdx)
+  805e21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e27:	00 22                	add    %ah,(%rdx)
+  805e29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e2f:	00 22                	add    %ah,(%rdx)
+  805e31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e37:	00 22                	add    %ah,(%rdx)
+  805e39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e92:	80 00 00             	addb   $0x0,(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 46 12             	add    %al,0x12(%rsi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805ee0 <basefix.0>:
+  805ee0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805ef0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805f00:	10 00 25 64 20 00 75 73 65 72 2f 70 72 69 6d 65     ..%d .user/prime
+  805f10:	73 2e 63 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 66 90     s.c.<unknown>.f.
+  805f20:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805f30:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805f40:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  805f50:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  805f60:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  805f70:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  805f80:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  805f90:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  805fa0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  805fb0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  805fc0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  805fd0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  805fe0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  805ff0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806000:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806010:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806020:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806030:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806040:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806050:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806060:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806070:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806080:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806090:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  8060a0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8060b0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8060c0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8060d0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  8060e0:	7b 1a 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     {........ ......
+  8060f0:	c2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806100:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806110:	d2 20 80 00 00 00 00 00 9a 1a 80 00 00 00 00 00     . ..............
+  806120:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806130:	8e 1a 80 00 00 00 00 00 08 1b 80 00 00 00 00 00     ................
+  806140:	d2 20 80 00 00 00 00 00 8e 1a 80 00 00 00 00 00     . ..............
+  806150:	d4 1a 80 00 00 00 00 00 d4 1a 80 00 00 00 00 00     ................
+  806160:	d4 1a 80 00 00 00 00 00 d4 1a 80 00 00 00 00 00     ................
+  806170:	d4 1a 80 00 00 00 00 00 d4 1a 80 00 00 00 00 00     ................
+  806180:	d4 1a 80 00 00 00 00 00 d4 1a 80 00 00 00 00 00     ................
+  806190:	d4 1a 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     ......... ......
+  8061a0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8061b0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8061c0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8061d0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8061e0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8061f0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806200:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806210:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806220:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806230:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806240:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806250:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806260:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806270:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806280:	d2 20 80 00 00 00 00 00 f0 1f 80 00 00 00 00 00     . ..............
+  806290:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8062a0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8062b0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8062c0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8062d0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  8062e0:	36 1b 80 00 00 00 00 00 05 1d 80 00 00 00 00 00     6...............
+  8062f0:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806300:	d2 20 80 00 00 00 00 00 2b 1b 80 00 00 00 00 00     . ......+.......
+  806310:	65 1b 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     e........ ......
+  806320:	d2 20 80 00 00 00 00 00 20 1b 80 00 00 00 00 00     . ...... .......
+  806330:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806340:	ae 1e 80 00 00 00 00 00 7d 1f 80 00 00 00 00 00     ........}.......
+  806350:	d2 20 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     . ....... ......
+  806360:	fc 1b 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     ......... ......
+  806370:	d9 1d 80 00 00 00 00 00 d2 20 80 00 00 00 00 00     ......... ......
+  806380:	d2 20 80 00 00 00 00 00 f0 1f 80 00 00 00 00 00     . ..............
+  806390:	d2 20 80 00 00 00 00 00 84 1a 80 00 00 00 00 00     . ..............
+
+00000000008063a0 <error_string>:
+	...
+  8063a8:	75 5f 80 00 00 00 00 00 87 5f 80 00 00 00 00 00     u_......._......
+  8063b8:	97 5f 80 00 00 00 00 00 a9 5f 80 00 00 00 00 00     ._......._......
+  8063c8:	b7 5f 80 00 00 00 00 00 cb 5f 80 00 00 00 00 00     ._......._......
+  8063d8:	e0 5f 80 00 00 00 00 00 f3 5f 80 00 00 00 00 00     ._......._......
+  8063e8:	05 60 80 00 00 00 00 00 19 60 80 00 00 00 00 00     .`.......`......
+  8063f8:	29 60 80 00 00 00 00 00 3c 60 80 00 00 00 00 00     )`......<`......
+  806408:	53 60 80 00 00 00 00 00 69 60 80 00 00 00 00 00     S`......i`......
+  806418:	81 60 80 00 00 00 00 00 99 60 80 00 00 00 00 00     .`.......`......
+  806428:	a6 60 80 00 00 00 00 00 40 64 80 00 00 00 00 00     .`......@d......
+  806438:	ba 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .`......file is 
+  806448:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806458:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806468:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806478:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806488:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806498:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8064a8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8064b8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8064c8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8064d8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8064e8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8064f8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806508:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 69     ult_upcall: %i.i
+  806518:	70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f     pc_send: %i.lib/
+  806528:	69 70 63 2e 63 00 66 90 5b 25 30 38 78 5d 20 75     ipc.c.f.[%08x] u
+  806538:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806548:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806558:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806568:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  806578:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  806588:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  806598:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8065a8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065b8:	84 00 00 00 00 00 66 90                             ......f.
+
+00000000008065c0 <devtab>:
+  8065c0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8065d0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8065e0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8065f0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806600:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806610:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806620:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806630:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806640:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806650:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806660:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806670:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806680:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806690:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8066a0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8066b0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  8066c0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8066d0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8066e0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8066f0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806700:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806710:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806720:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  806730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
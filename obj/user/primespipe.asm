@@ -0,0 +1,10672 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 2a 26 80 00 00 	movabs $0x80262a,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 9d 37 80 00 00 	movabs $0x80379d,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 9d 37 80 00 00 	movabs $0x80379d,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 ed 19 80 00 00 	movabs $0x8019ed,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 73 41 80 00 00 	movabs $0x804173,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 73 41 80 00 00 	movabs $0x804173,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 de 18 80 00 00 	movabs $0x8018de,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 27 62 80 00 00 	movabs $0x806227,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 88 5b 80 00 00 	movabs $0x805b88,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 8a 5b 80 00 00 	movabs $0x805b8a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 8d 5b 80 00 00 	movabs $0x805b8d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 4a 24 80 00 00 	movabs $0x80244a,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 71 4f 80 00 00 	movabs $0x804f71,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 48 52 80 00 00 	movabs $0x805248,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 87 38 80 00 00 	movabs $0x803887,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 50 39 80 00 00 	movabs $0x803950,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 56 38 80 00 00 	movabs $0x803856,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 56 38 80 00 00 	movabs $0x803856,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 6e 36 80 00 00 	movabs $0x80366e,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 9d 37 80 00 00 	movabs $0x80379d,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb f7 25 80 00 00 	movabs $0x8025f7,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be a0 5b 80 00 00 	movabs $0x805ba0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 2a 26 80 00 00 	movabs $0x80262a,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc f7 25 80 00 00 	movabs $0x8025f7,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 40 5e 80 00 00 	movabs $0x805e40,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf f7 25 80 00 00 	movabs $0x8025f7,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf f7 25 80 00 00 	movabs $0x8025f7,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 4f 28 80 00 00 	movabs $0x80284f,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 4f 28 80 00 00 	movabs $0x80284f,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 36 03 00 00       	call   801835 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 18          	sub    $0x18,%rsp
+  801512:	89 fb                	mov    %edi,%ebx
+    int id, p, pfd[2], wfd, r;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    if ((r = readn(fd, &p, 4)) != 4)
+  801514:	49 bc 2c 37 80 00 00 	movabs $0x80372c,%r12
+  80151b:	00 00 00 
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+
+    cprintf("%d\n", p);
+  80151e:	49 bf 29 61 80 00 00 	movabs $0x806129,%r15
+  801525:	00 00 00 
+  801528:	49 be 51 1a 80 00 00 	movabs $0x801a51,%r14
+  80152f:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((r = pipe(pfd)) < 0)
+  801532:	49 bd 18 45 80 00 00 	movabs $0x804518,%r13
+  801539:	00 00 00 
+    if ((r = readn(fd, &p, 4)) != 4)
+  80153c:	ba 04 00 00 00       	mov    $0x4,%edx
+  801541:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  801545:	89 df                	mov    %ebx,%edi
+  801547:	41 ff d4             	call   *%r12
+  80154a:	89 c1                	mov    %eax,%ecx
+  80154c:	83 f8 04             	cmp    $0x4,%eax
+  80154f:	75 4b                	jne    80159c <primeproc+0x9b>
+    cprintf("%d\n", p);
+  801551:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801554:	4c 89 ff             	mov    %r15,%rdi
+  801557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155c:	41 ff d6             	call   *%r14
+    if ((r = pipe(pfd)) < 0)
+  80155f:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  801563:	41 ff d5             	call   *%r13
+  801566:	85 c0                	test   %eax,%eax
+  801568:	78 69                	js     8015d3 <primeproc+0xd2>
+        panic("pipe: %i", r);
+    if ((id = fork()) < 0)
+  80156a:	48 b8 4b 31 80 00 00 	movabs $0x80314b,%rax
+  801571:	00 00 00 
+  801574:	ff d0                	call   *%rax
+  801576:	85 c0                	test   %eax,%eax
+  801578:	0f 88 82 00 00 00    	js     801600 <primeproc+0xff>
+        panic("fork: %i", id);
+    if (id == 0) {
+  80157e:	0f 85 a9 00 00 00    	jne    80162d <primeproc+0x12c>
+        close(fd);
+  801584:	89 df                	mov    %ebx,%edi
+  801586:	48 bb f0 34 80 00 00 	movabs $0x8034f0,%rbx
+  80158d:	00 00 00 
+  801590:	ff d3                	call   *%rbx
+        close(pfd[1]);
+  801592:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  801595:	ff d3                	call   *%rbx
+        fd = pfd[0];
+  801597:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+        goto top;
+  80159a:	eb a0                	jmp    80153c <primeproc+0x3b>
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  80159c:	85 c0                	test   %eax,%eax
+  80159e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a4:	44 0f 4e c0          	cmovle %eax,%r8d
+  8015a8:	48 ba e8 60 80 00 00 	movabs $0x8060e8,%rdx
+  8015af:	00 00 00 
+  8015b2:	be 14 00 00 00       	mov    $0x14,%esi
+  8015b7:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  8015be:	00 00 00 
+  8015c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c6:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  8015cd:	00 00 00 
+  8015d0:	41 ff d1             	call   *%r9
+        panic("pipe: %i", r);
+  8015d3:	89 c1                	mov    %eax,%ecx
+  8015d5:	48 ba 2d 61 80 00 00 	movabs $0x80612d,%rdx
+  8015dc:	00 00 00 
+  8015df:	be 1a 00 00 00       	mov    $0x1a,%esi
+  8015e4:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  8015eb:	00 00 00 
+  8015ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f3:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  8015fa:	00 00 00 
+  8015fd:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  801600:	89 c1                	mov    %eax,%ecx
+  801602:	48 ba 1c 67 80 00 00 	movabs $0x80671c,%rdx
+  801609:	00 00 00 
+  80160c:	be 1c 00 00 00       	mov    $0x1c,%esi
+  801611:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  801618:	00 00 00 
+  80161b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801620:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  801627:	00 00 00 
+  80162a:	41 ff d0             	call   *%r8
+    }
+
+    close(pfd[0]);
+  80162d:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  801630:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  801637:	00 00 00 
+  80163a:	ff d0                	call   *%rax
+    wfd = pfd[1];
+  80163c:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+
+    /* Filter out multiples of our prime */
+    for (int i;;) {
+        if ((r = readn(fd, &i, 4)) != 4)
+  801640:	49 bc 2c 37 80 00 00 	movabs $0x80372c,%r12
+  801647:	00 00 00 
+  80164a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80164f:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801653:	89 df                	mov    %ebx,%edi
+  801655:	41 ff d4             	call   *%r12
+  801658:	83 f8 04             	cmp    $0x4,%eax
+  80165b:	75 65                	jne    8016c2 <primeproc+0x1c1>
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+        if (i % p)
+  80165d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801660:	99                   	cltd
+  801661:	f7 7d cc             	idivl  -0x34(%rbp)
+  801664:	85 d2                	test   %edx,%edx
+  801666:	74 e2                	je     80164a <primeproc+0x149>
+            if ((r = write(wfd, &i, 4)) != 4)
+  801668:	ba 04 00 00 00       	mov    $0x4,%edx
+  80166d:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801671:	44 89 ef             	mov    %r13d,%edi
+  801674:	48 b8 9d 37 80 00 00 	movabs $0x80379d,%rax
+  80167b:	00 00 00 
+  80167e:	ff d0                	call   *%rax
+  801680:	83 f8 04             	cmp    $0x4,%eax
+  801683:	74 c5                	je     80164a <primeproc+0x149>
+                panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  801685:	85 c0                	test   %eax,%eax
+  801687:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80168d:	44 0f 4e c8          	cmovle %eax,%r9d
+  801691:	41 89 c0             	mov    %eax,%r8d
+  801694:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  801697:	48 ba 52 61 80 00 00 	movabs $0x806152,%rdx
+  80169e:	00 00 00 
+  8016a1:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8016a6:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  8016ad:	00 00 00 
+  8016b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b5:	49 ba 01 19 80 00 00 	movabs $0x801901,%r10
+  8016bc:	00 00 00 
+  8016bf:	41 ff d2             	call   *%r10
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8016c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c6:	85 c0                	test   %eax,%eax
+  8016c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016cd:	0f 4e d0             	cmovle %eax,%edx
+  8016d0:	52                   	push   %rdx
+  8016d1:	41 89 c1             	mov    %eax,%r9d
+  8016d4:	41 89 d8             	mov    %ebx,%r8d
+  8016d7:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8016da:	48 ba 36 61 80 00 00 	movabs $0x806136,%rdx
+  8016e1:	00 00 00 
+  8016e4:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8016e9:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  8016f0:	00 00 00 
+  8016f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f8:	49 ba 01 19 80 00 00 	movabs $0x801901,%r10
+  8016ff:	00 00 00 
+  801702:	41 ff d2             	call   *%r10
+
+0000000000801705 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  801705:	55                   	push   %rbp
+  801706:	48 89 e5             	mov    %rsp,%rbp
+  801709:	53                   	push   %rbx
+  80170a:	48 83 ec 18          	sub    $0x18,%rsp
+    int id, p[2], r;
+
+    binaryname = "primespipe";
+  80170e:	48 b8 6c 61 80 00 00 	movabs $0x80616c,%rax
+  801715:	00 00 00 
+  801718:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80171f:	00 00 00 
+
+    if ((r = pipe(p)) < 0)
+  801722:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  801726:	48 b8 18 45 80 00 00 	movabs $0x804518,%rax
+  80172d:	00 00 00 
+  801730:	ff d0                	call   *%rax
+  801732:	85 c0                	test   %eax,%eax
+  801734:	78 30                	js     801766 <umain+0x61>
+        panic("pipe: %i", r);
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  801736:	48 b8 4b 31 80 00 00 	movabs $0x80314b,%rax
+  80173d:	00 00 00 
+  801740:	ff d0                	call   *%rax
+  801742:	85 c0                	test   %eax,%eax
+  801744:	78 4d                	js     801793 <umain+0x8e>
+        panic("fork: %i", id);
+
+    if (id == 0) {
+  801746:	75 78                	jne    8017c0 <umain+0xbb>
+        close(p[1]);
+  801748:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80174b:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  801752:	00 00 00 
+  801755:	ff d0                	call   *%rax
+        primeproc(p[0]);
+  801757:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  80175a:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801761:	00 00 00 
+  801764:	ff d0                	call   *%rax
+        panic("pipe: %i", r);
+  801766:	89 c1                	mov    %eax,%ecx
+  801768:	48 ba 2d 61 80 00 00 	movabs $0x80612d,%rdx
+  80176f:	00 00 00 
+  801772:	be 38 00 00 00       	mov    $0x38,%esi
+  801777:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  80177e:	00 00 00 
+  801781:	b8 00 00 00 00       	mov    $0x0,%eax
+  801786:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  80178d:	00 00 00 
+  801790:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  801793:	89 c1                	mov    %eax,%ecx
+  801795:	48 ba 1c 67 80 00 00 	movabs $0x80671c,%rdx
+  80179c:	00 00 00 
+  80179f:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8017a4:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  8017ab:	00 00 00 
+  8017ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b3:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  8017ba:	00 00 00 
+  8017bd:	41 ff d0             	call   *%r8
+    }
+
+    close(p[0]);
+  8017c0:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  8017c3:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  8017ca:	00 00 00 
+  8017cd:	ff d0                	call   *%rax
+  8017cf:	b8 02 00 00 00       	mov    $0x2,%eax
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8017d4:	48 bb 9d 37 80 00 00 	movabs $0x80379d,%rbx
+  8017db:	00 00 00 
+  8017de:	eb 06                	jmp    8017e6 <umain+0xe1>
+    for (int i = 2;; i++)
+  8017e0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8017e3:	83 c0 01             	add    $0x1,%eax
+  8017e6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8017e9:	ba 04 00 00 00       	mov    $0x4,%edx
+  8017ee:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+  8017f2:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  8017f5:	ff d3                	call   *%rbx
+  8017f7:	89 c1                	mov    %eax,%ecx
+  8017f9:	83 f8 04             	cmp    $0x4,%eax
+  8017fc:	74 e2                	je     8017e0 <umain+0xdb>
+            panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801806:	44 0f 4e c0          	cmovle %eax,%r8d
+  80180a:	48 ba 77 61 80 00 00 	movabs $0x806177,%rdx
+  801811:	00 00 00 
+  801814:	be 48 00 00 00       	mov    $0x48,%esi
+  801819:	48 bf 17 61 80 00 00 	movabs $0x806117,%rdi
+  801820:	00 00 00 
+  801823:	b8 00 00 00 00       	mov    $0x0,%eax
+  801828:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  80182f:	00 00 00 
+  801832:	41 ff d1             	call   *%r9
+
+0000000000801835 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801835:	55                   	push   %rbp
+  801836:	48 89 e5             	mov    %rsp,%rbp
+  801839:	41 56                	push   %r14
+  80183b:	41 55                	push   %r13
+  80183d:	41 54                	push   %r12
+  80183f:	53                   	push   %rbx
+  801840:	41 89 fd             	mov    %edi,%r13d
+  801843:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801846:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80184d:	00 00 00 
+  801850:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801857:	00 00 00 
+  80185a:	48 39 c2             	cmp    %rax,%rdx
+  80185d:	73 17                	jae    801876 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80185f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801862:	49 89 c4             	mov    %rax,%r12
+  801865:	48 83 c3 08          	add    $0x8,%rbx
+  801869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186e:	ff 53 f8             	call   *-0x8(%rbx)
+  801871:	4c 39 e3             	cmp    %r12,%rbx
+  801874:	72 ef                	jb     801865 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801876:	48 b8 15 2a 80 00 00 	movabs $0x802a15,%rax
+  80187d:	00 00 00 
+  801880:	ff d0                	call   *%rax
+  801882:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801887:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80188e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801895:	00 00 00 
+  801898:	48 01 d0             	add    %rdx,%rax
+  80189b:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8018a2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8018a5:	45 85 ed             	test   %r13d,%r13d
+  8018a8:	7e 0d                	jle    8018b7 <libmain+0x82>
+  8018aa:	49 8b 06             	mov    (%r14),%rax
+  8018ad:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8018b4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8018b7:	4c 89 f6             	mov    %r14,%rsi
+  8018ba:	44 89 ef             	mov    %r13d,%edi
+  8018bd:	48 b8 05 17 80 00 00 	movabs $0x801705,%rax
+  8018c4:	00 00 00 
+  8018c7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8018c9:	48 b8 de 18 80 00 00 	movabs $0x8018de,%rax
+  8018d0:	00 00 00 
+  8018d3:	ff d0                	call   *%rax
+#endif
+}
+  8018d5:	5b                   	pop    %rbx
+  8018d6:	41 5c                	pop    %r12
+  8018d8:	41 5d                	pop    %r13
+  8018da:	41 5e                	pop    %r14
+  8018dc:	5d                   	pop    %rbp
+  8018dd:	c3                   	ret
+
+00000000008018de <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8018de:	55                   	push   %rbp
+  8018df:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8018e2:	48 b8 23 35 80 00 00 	movabs $0x803523,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8018ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018f3:	48 b8 a4 29 80 00 00 	movabs $0x8029a4,%rax
+  8018fa:	00 00 00 
+  8018fd:	ff d0                	call   *%rax
+}
+  8018ff:	5d                   	pop    %rbp
+  801900:	c3                   	ret
+
+0000000000801901 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801901:	55                   	push   %rbp
+  801902:	48 89 e5             	mov    %rsp,%rbp
+  801905:	41 56                	push   %r14
+  801907:	41 55                	push   %r13
+  801909:	41 54                	push   %r12
+  80190b:	53                   	push   %rbx
+  80190c:	48 83 ec 50          	sub    $0x50,%rsp
+  801910:	49 89 fc             	mov    %rdi,%r12
+  801913:	41 89 f5             	mov    %esi,%r13d
+  801916:	48 89 d3             	mov    %rdx,%rbx
+  801919:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80191d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801921:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801925:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80192c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801930:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801934:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801938:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80193c:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801943:	00 00 00 
+  801946:	4c 8b 30             	mov    (%rax),%r14
+  801949:	48 b8 15 2a 80 00 00 	movabs $0x802a15,%rax
+  801950:	00 00 00 
+  801953:	ff d0                	call   *%rax
+  801955:	89 c6                	mov    %eax,%esi
+  801957:	45 89 e8             	mov    %r13d,%r8d
+  80195a:	4c 89 e1             	mov    %r12,%rcx
+  80195d:	4c 89 f2             	mov    %r14,%rdx
+  801960:	48 bf a0 61 80 00 00 	movabs $0x8061a0,%rdi
+  801967:	00 00 00 
+  80196a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196f:	49 bc 51 1a 80 00 00 	movabs $0x801a51,%r12
+  801976:	00 00 00 
+  801979:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80197c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801980:	48 89 df             	mov    %rbx,%rdi
+  801983:	48 b8 ed 19 80 00 00 	movabs $0x8019ed,%rax
+  80198a:	00 00 00 
+  80198d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80198f:	48 bf 2b 61 80 00 00 	movabs $0x80612b,%rdi
+  801996:	00 00 00 
+  801999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8019a1:	cc                   	int3
+  8019a2:	eb fd                	jmp    8019a1 <_panic+0xa0>
+
+00000000008019a4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8019a4:	55                   	push   %rbp
+  8019a5:	48 89 e5             	mov    %rsp,%rbp
+  8019a8:	53                   	push   %rbx
+  8019a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ad:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8019b0:	8b 06                	mov    (%rsi),%eax
+  8019b2:	8d 50 01             	lea    0x1(%rax),%edx
+  8019b5:	89 16                	mov    %edx,(%rsi)
+  8019b7:	48 98                	cltq
+  8019b9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8019be:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8019c4:	74 0a                	je     8019d0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8019c6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8019ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8019d0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8019d4:	be ff 00 00 00       	mov    $0xff,%esi
+  8019d9:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  8019e0:	00 00 00 
+  8019e3:	ff d0                	call   *%rax
+        state->offset = 0;
+  8019e5:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8019eb:	eb d9                	jmp    8019c6 <putch+0x22>
+
+00000000008019ed <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8019ed:	55                   	push   %rbp
+  8019ee:	48 89 e5             	mov    %rsp,%rbp
+  8019f1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8019f8:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8019fb:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801a02:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801a0f:	48 89 f1             	mov    %rsi,%rcx
+  801a12:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a19:	48 bf a4 19 80 00 00 	movabs $0x8019a4,%rdi
+  801a20:	00 00 00 
+  801a23:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  801a2a:	00 00 00 
+  801a2d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a2f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a36:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a3d:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  801a44:	00 00 00 
+  801a47:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801a49:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801a4f:	c9                   	leave
+  801a50:	c3                   	ret
+
+0000000000801a51 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801a51:	55                   	push   %rbp
+  801a52:	48 89 e5             	mov    %rsp,%rbp
+  801a55:	48 83 ec 50          	sub    $0x50,%rsp
+  801a59:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801a5d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801a61:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a65:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a69:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a6d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a74:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a7c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a80:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a84:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a88:	48 b8 ed 19 80 00 00 	movabs $0x8019ed,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a94:	c9                   	leave
+  801a95:	c3                   	ret
+
+0000000000801a96 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a96:	55                   	push   %rbp
+  801a97:	48 89 e5             	mov    %rsp,%rbp
+  801a9a:	41 57                	push   %r15
+  801a9c:	41 56                	push   %r14
+  801a9e:	41 55                	push   %r13
+  801aa0:	41 54                	push   %r12
+  801aa2:	53                   	push   %rbx
+  801aa3:	48 83 ec 18          	sub    $0x18,%rsp
+  801aa7:	49 89 fc             	mov    %rdi,%r12
+  801aaa:	49 89 f5             	mov    %rsi,%r13
+  801aad:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ab1:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ab4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801ab7:	41 89 cf             	mov    %ecx,%r15d
+  801aba:	4c 39 fa             	cmp    %r15,%rdx
+  801abd:	73 5b                	jae    801b1a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801abf:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801ac3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ac7:	85 db                	test   %ebx,%ebx
+  801ac9:	7e 0e                	jle    801ad9 <print_num+0x43>
+            putch(padc, put_arg);
+  801acb:	4c 89 ee             	mov    %r13,%rsi
+  801ace:	44 89 f7             	mov    %r14d,%edi
+  801ad1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ad4:	83 eb 01             	sub    $0x1,%ebx
+  801ad7:	75 f2                	jne    801acb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801ad9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801add:	48 b9 d4 61 80 00 00 	movabs $0x8061d4,%rcx
+  801ae4:	00 00 00 
+  801ae7:	48 b8 c3 61 80 00 00 	movabs $0x8061c3,%rax
+  801aee:	00 00 00 
+  801af1:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801af5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afe:	49 f7 f7             	div    %r15
+  801b01:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801b05:	4c 89 ee             	mov    %r13,%rsi
+  801b08:	41 ff d4             	call   *%r12
+}
+  801b0b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b0f:	5b                   	pop    %rbx
+  801b10:	41 5c                	pop    %r12
+  801b12:	41 5d                	pop    %r13
+  801b14:	41 5e                	pop    %r14
+  801b16:	41 5f                	pop    %r15
+  801b18:	5d                   	pop    %rbp
+  801b19:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b23:	49 f7 f7             	div    %r15
+  801b26:	48 83 ec 08          	sub    $0x8,%rsp
+  801b2a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b2e:	52                   	push   %rdx
+  801b2f:	45 0f be c9          	movsbl %r9b,%r9d
+  801b33:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b37:	48 89 c2             	mov    %rax,%rdx
+  801b3a:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  801b41:	00 00 00 
+  801b44:	ff d0                	call   *%rax
+  801b46:	48 83 c4 10          	add    $0x10,%rsp
+  801b4a:	eb 8d                	jmp    801ad9 <print_num+0x43>
+
+0000000000801b4c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801b4c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801b50:	48 8b 06             	mov    (%rsi),%rax
+  801b53:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801b57:	73 0a                	jae    801b63 <sprintputch+0x17>
+        *state->start++ = ch;
+  801b59:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b5d:	48 89 16             	mov    %rdx,(%rsi)
+  801b60:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801b63:	c3                   	ret
+
+0000000000801b64 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801b64:	55                   	push   %rbp
+  801b65:	48 89 e5             	mov    %rsp,%rbp
+  801b68:	48 83 ec 50          	sub    $0x50,%rsp
+  801b6c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b70:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b74:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b78:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b7f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b87:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b8b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b8f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b93:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  801b9a:	00 00 00 
+  801b9d:	ff d0                	call   *%rax
+}
+  801b9f:	c9                   	leave
+  801ba0:	c3                   	ret
+
+0000000000801ba1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ba1:	55                   	push   %rbp
+  801ba2:	48 89 e5             	mov    %rsp,%rbp
+  801ba5:	41 57                	push   %r15
+  801ba7:	41 56                	push   %r14
+  801ba9:	41 55                	push   %r13
+  801bab:	41 54                	push   %r12
+  801bad:	53                   	push   %rbx
+  801bae:	48 83 ec 38          	sub    $0x38,%rsp
+  801bb2:	49 89 fe             	mov    %rdi,%r14
+  801bb5:	49 89 f5             	mov    %rsi,%r13
+  801bb8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801bbb:	48 8b 01             	mov    (%rcx),%rax
+  801bbe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801bc2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801bc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bca:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801bce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801bd2:	eb 0d                	jmp    801be1 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801bd4:	40 0f b6 ff          	movzbl %dil,%edi
+  801bd8:	4c 89 ee             	mov    %r13,%rsi
+  801bdb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801bde:	4c 89 e3             	mov    %r12,%rbx
+  801be1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801be5:	0f b6 3b             	movzbl (%rbx),%edi
+  801be8:	40 80 ff 25          	cmp    $0x25,%dil
+  801bec:	74 14                	je     801c02 <vprintfmt+0x61>
+            if (!ch) return;
+  801bee:	40 84 ff             	test   %dil,%dil
+  801bf1:	75 e1                	jne    801bd4 <vprintfmt+0x33>
+}
+  801bf3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801bf7:	5b                   	pop    %rbx
+  801bf8:	41 5c                	pop    %r12
+  801bfa:	41 5d                	pop    %r13
+  801bfc:	41 5e                	pop    %r14
+  801bfe:	41 5f                	pop    %r15
+  801c00:	5d                   	pop    %rbp
+  801c01:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801c02:	be 00 00 00 00       	mov    $0x0,%esi
+  801c07:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801c10:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c16:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c1d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c21:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c26:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c2b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c2e:	83 e8 23             	sub    $0x23,%eax
+  801c31:	3c 57                	cmp    $0x57,%al
+  801c33:	0f 87 67 06 00 00    	ja     8022a0 <vprintfmt+0x6ff>
+  801c39:	0f b6 c0             	movzbl %al,%eax
+  801c3c:	48 b9 60 63 80 00 00 	movabs $0x806360,%rcx
+  801c43:	00 00 00 
+  801c46:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801c49:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801c4c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801c50:	eb cf                	jmp    801c21 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801c52:	49 89 dc             	mov    %rbx,%r12
+  801c55:	be 01 00 00 00       	mov    $0x1,%esi
+  801c5a:	eb c5                	jmp    801c21 <vprintfmt+0x80>
+            padc = ch;
+  801c5c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801c60:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c63:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c66:	eb b9                	jmp    801c21 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c6b:	83 f8 2f             	cmp    $0x2f,%eax
+  801c6e:	77 24                	ja     801c94 <vprintfmt+0xf3>
+  801c70:	89 c1                	mov    %eax,%ecx
+  801c72:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c76:	83 c0 08             	add    $0x8,%eax
+  801c79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c7c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c7f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c82:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c86:	79 99                	jns    801c21 <vprintfmt+0x80>
+                width = precision;
+  801c88:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c8c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c92:	eb 8d                	jmp    801c21 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c94:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c98:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca0:	eb da                	jmp    801c7c <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801ca2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801ca7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cab:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801cb1:	3c 39                	cmp    $0x39,%al
+  801cb3:	77 1c                	ja     801cd1 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801cb5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801cb9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801cbd:	0f b6 c0             	movzbl %al,%eax
+  801cc0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cc5:	0f b6 03             	movzbl (%rbx),%eax
+  801cc8:	3c 39                	cmp    $0x39,%al
+  801cca:	76 e9                	jbe    801cb5 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801ccc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ccf:	eb b1                	jmp    801c82 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801cd1:	49 89 dc             	mov    %rbx,%r12
+  801cd4:	eb ac                	jmp    801c82 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801cd6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801cd9:	85 c9                	test   %ecx,%ecx
+  801cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce0:	0f 49 c1             	cmovns %ecx,%eax
+  801ce3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ce6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ce9:	e9 33 ff ff ff       	jmp    801c21 <vprintfmt+0x80>
+            lflag++;
+  801cee:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801cf1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cf4:	e9 28 ff ff ff       	jmp    801c21 <vprintfmt+0x80>
+            lflag--;
+  801cf9:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801cfc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cff:	e9 1d ff ff ff       	jmp    801c21 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801d04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d07:	83 f8 2f             	cmp    $0x2f,%eax
+  801d0a:	77 19                	ja     801d25 <vprintfmt+0x184>
+  801d0c:	89 c2                	mov    %eax,%edx
+  801d0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d12:	83 c0 08             	add    $0x8,%eax
+  801d15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d18:	8b 3a                	mov    (%rdx),%edi
+  801d1a:	4c 89 ee             	mov    %r13,%rsi
+  801d1d:	41 ff d6             	call   *%r14
+            break;
+  801d20:	e9 bc fe ff ff       	jmp    801be1 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d31:	eb e5                	jmp    801d18 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d36:	83 f8 2f             	cmp    $0x2f,%eax
+  801d39:	77 5a                	ja     801d95 <vprintfmt+0x1f4>
+  801d3b:	89 c2                	mov    %eax,%edx
+  801d3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d41:	83 c0 08             	add    $0x8,%eax
+  801d44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801d47:	8b 02                	mov    (%rdx),%eax
+  801d49:	89 c1                	mov    %eax,%ecx
+  801d4b:	f7 d9                	neg    %ecx
+  801d4d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801d50:	83 f9 13             	cmp    $0x13,%ecx
+  801d53:	7f 4e                	jg     801da3 <vprintfmt+0x202>
+  801d55:	48 63 c1             	movslq %ecx,%rax
+  801d58:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  801d5f:	00 00 00 
+  801d62:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d66:	48 85 c0             	test   %rax,%rax
+  801d69:	74 38                	je     801da3 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d6b:	48 89 c1             	mov    %rax,%rcx
+  801d6e:	48 ba 68 68 80 00 00 	movabs $0x806868,%rdx
+  801d75:	00 00 00 
+  801d78:	4c 89 ee             	mov    %r13,%rsi
+  801d7b:	4c 89 f7             	mov    %r14,%rdi
+  801d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d83:	49 b8 64 1b 80 00 00 	movabs $0x801b64,%r8
+  801d8a:	00 00 00 
+  801d8d:	41 ff d0             	call   *%r8
+  801d90:	e9 4c fe ff ff       	jmp    801be1 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da1:	eb a4                	jmp    801d47 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801da3:	48 ba ec 61 80 00 00 	movabs $0x8061ec,%rdx
+  801daa:	00 00 00 
+  801dad:	4c 89 ee             	mov    %r13,%rsi
+  801db0:	4c 89 f7             	mov    %r14,%rdi
+  801db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db8:	49 b8 64 1b 80 00 00 	movabs $0x801b64,%r8
+  801dbf:	00 00 00 
+  801dc2:	41 ff d0             	call   *%r8
+  801dc5:	e9 17 fe ff ff       	jmp    801be1 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801dca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dcd:	83 f8 2f             	cmp    $0x2f,%eax
+  801dd0:	77 6c                	ja     801e3e <vprintfmt+0x29d>
+  801dd2:	89 c2                	mov    %eax,%edx
+  801dd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd8:	83 c0 08             	add    $0x8,%eax
+  801ddb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dde:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801de1:	48 85 f6             	test   %rsi,%rsi
+  801de4:	48 b8 e5 61 80 00 00 	movabs $0x8061e5,%rax
+  801deb:	00 00 00 
+  801dee:	48 0f 45 c6          	cmovne %rsi,%rax
+  801df2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801df6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801dfa:	7e 06                	jle    801e02 <vprintfmt+0x261>
+  801dfc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801e00:	75 4a                	jne    801e4c <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e02:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e06:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801e0a:	0f b6 00             	movzbl (%rax),%eax
+  801e0d:	84 c0                	test   %al,%al
+  801e0f:	0f 85 9a 00 00 00    	jne    801eaf <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e15:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e18:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	0f 8e bd fd ff ff    	jle    801be1 <vprintfmt+0x40>
+  801e24:	4c 89 ee             	mov    %r13,%rsi
+  801e27:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e2c:	41 ff d6             	call   *%r14
+  801e2f:	41 83 ec 01          	sub    $0x1,%r12d
+  801e33:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e37:	75 eb                	jne    801e24 <vprintfmt+0x283>
+  801e39:	e9 a3 fd ff ff       	jmp    801be1 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e4a:	eb 92                	jmp    801dde <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801e4c:	49 63 f7             	movslq %r15d,%rsi
+  801e4f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801e53:	48 b8 65 23 80 00 00 	movabs $0x802365,%rax
+  801e5a:	00 00 00 
+  801e5d:	ff d0                	call   *%rax
+  801e5f:	48 89 c2             	mov    %rax,%rdx
+  801e62:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e65:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e67:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e6a:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e6d:	85 c0                	test   %eax,%eax
+  801e6f:	7e 91                	jle    801e02 <vprintfmt+0x261>
+  801e71:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e76:	4c 89 ee             	mov    %r13,%rsi
+  801e79:	44 89 e7             	mov    %r12d,%edi
+  801e7c:	41 ff d6             	call   *%r14
+  801e7f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e83:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e86:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e89:	75 eb                	jne    801e76 <vprintfmt+0x2d5>
+  801e8b:	e9 72 ff ff ff       	jmp    801e02 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e90:	0f b6 f8             	movzbl %al,%edi
+  801e93:	4c 89 ee             	mov    %r13,%rsi
+  801e96:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e99:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e9d:	49 83 c4 01          	add    $0x1,%r12
+  801ea1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ea7:	84 c0                	test   %al,%al
+  801ea9:	0f 84 66 ff ff ff    	je     801e15 <vprintfmt+0x274>
+  801eaf:	45 85 ff             	test   %r15d,%r15d
+  801eb2:	78 0a                	js     801ebe <vprintfmt+0x31d>
+  801eb4:	41 83 ef 01          	sub    $0x1,%r15d
+  801eb8:	0f 88 57 ff ff ff    	js     801e15 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ebe:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801ec2:	74 cc                	je     801e90 <vprintfmt+0x2ef>
+  801ec4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801ec7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ecc:	80 fa 5e             	cmp    $0x5e,%dl
+  801ecf:	77 c2                	ja     801e93 <vprintfmt+0x2f2>
+  801ed1:	eb bd                	jmp    801e90 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801ed3:	40 84 f6             	test   %sil,%sil
+  801ed6:	75 26                	jne    801efe <vprintfmt+0x35d>
+    switch (lflag) {
+  801ed8:	85 d2                	test   %edx,%edx
+  801eda:	74 59                	je     801f35 <vprintfmt+0x394>
+  801edc:	83 fa 01             	cmp    $0x1,%edx
+  801edf:	74 7b                	je     801f5c <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801ee1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee7:	0f 87 96 00 00 00    	ja     801f83 <vprintfmt+0x3e2>
+  801eed:	89 c2                	mov    %eax,%edx
+  801eef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef3:	83 c0 08             	add    $0x8,%eax
+  801ef6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef9:	4c 8b 22             	mov    (%rdx),%r12
+  801efc:	eb 17                	jmp    801f15 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801efe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f01:	83 f8 2f             	cmp    $0x2f,%eax
+  801f04:	77 21                	ja     801f27 <vprintfmt+0x386>
+  801f06:	89 c2                	mov    %eax,%edx
+  801f08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f0c:	83 c0 08             	add    $0x8,%eax
+  801f0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f12:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f15:	4d 85 e4             	test   %r12,%r12
+  801f18:	78 7a                	js     801f94 <vprintfmt+0x3f3>
+            num = i;
+  801f1a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f1d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f22:	e9 56 02 00 00       	jmp    80217d <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f33:	eb dd                	jmp    801f12 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f38:	83 f8 2f             	cmp    $0x2f,%eax
+  801f3b:	77 11                	ja     801f4e <vprintfmt+0x3ad>
+  801f3d:	89 c2                	mov    %eax,%edx
+  801f3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f43:	83 c0 08             	add    $0x8,%eax
+  801f46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f49:	4c 63 22             	movslq (%rdx),%r12
+  801f4c:	eb c7                	jmp    801f15 <vprintfmt+0x374>
+  801f4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f5a:	eb ed                	jmp    801f49 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801f5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5f:	83 f8 2f             	cmp    $0x2f,%eax
+  801f62:	77 11                	ja     801f75 <vprintfmt+0x3d4>
+  801f64:	89 c2                	mov    %eax,%edx
+  801f66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f6a:	83 c0 08             	add    $0x8,%eax
+  801f6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f70:	4c 8b 22             	mov    (%rdx),%r12
+  801f73:	eb a0                	jmp    801f15 <vprintfmt+0x374>
+  801f75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f81:	eb ed                	jmp    801f70 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f8f:	e9 65 ff ff ff       	jmp    801ef9 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f94:	4c 89 ee             	mov    %r13,%rsi
+  801f97:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f9c:	41 ff d6             	call   *%r14
+                i = -i;
+  801f9f:	49 f7 dc             	neg    %r12
+  801fa2:	e9 73 ff ff ff       	jmp    801f1a <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801fa7:	40 84 f6             	test   %sil,%sil
+  801faa:	75 2e                	jne    801fda <vprintfmt+0x439>
+    switch (lflag) {
+  801fac:	85 d2                	test   %edx,%edx
+  801fae:	7f 59                	jg     802009 <vprintfmt+0x468>
+  801fb0:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fb3:	7d 7a                	jge    80202f <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801fb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb8:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbb:	0f 87 aa 00 00 00    	ja     80206b <vprintfmt+0x4ca>
+  801fc1:	89 c2                	mov    %eax,%edx
+  801fc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc7:	83 c0 08             	add    $0x8,%eax
+  801fca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fcd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fd0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fd5:	e9 a3 01 00 00       	jmp    80217d <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fdd:	83 f8 2f             	cmp    $0x2f,%eax
+  801fe0:	77 19                	ja     801ffb <vprintfmt+0x45a>
+  801fe2:	89 c2                	mov    %eax,%edx
+  801fe4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fe8:	83 c0 08             	add    $0x8,%eax
+  801feb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fee:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801ff1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ff6:	e9 82 01 00 00       	jmp    80217d <vprintfmt+0x5dc>
+  801ffb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802003:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802007:	eb e5                	jmp    801fee <vprintfmt+0x44d>
+    switch (lflag) {
+  802009:	83 fa 01             	cmp    $0x1,%edx
+  80200c:	75 a7                	jne    801fb5 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  80200e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802011:	83 f8 2f             	cmp    $0x2f,%eax
+  802014:	77 47                	ja     80205d <vprintfmt+0x4bc>
+  802016:	89 c2                	mov    %eax,%edx
+  802018:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80201c:	83 c0 08             	add    $0x8,%eax
+  80201f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802022:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802025:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80202a:	e9 4e 01 00 00       	jmp    80217d <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80202f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802032:	83 f8 2f             	cmp    $0x2f,%eax
+  802035:	77 18                	ja     80204f <vprintfmt+0x4ae>
+  802037:	89 c2                	mov    %eax,%edx
+  802039:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80203d:	83 c0 08             	add    $0x8,%eax
+  802040:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802043:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802045:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80204a:	e9 2e 01 00 00       	jmp    80217d <vprintfmt+0x5dc>
+  80204f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802053:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802057:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80205b:	eb e6                	jmp    802043 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  80205d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802061:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802065:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802069:	eb b7                	jmp    802022 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  80206b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80206f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802073:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802077:	e9 51 ff ff ff       	jmp    801fcd <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  80207c:	40 84 f6             	test   %sil,%sil
+  80207f:	75 2e                	jne    8020af <vprintfmt+0x50e>
+    switch (lflag) {
+  802081:	85 d2                	test   %edx,%edx
+  802083:	7f 59                	jg     8020de <vprintfmt+0x53d>
+  802085:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802088:	7d 77                	jge    802101 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  80208a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80208d:	83 f8 2f             	cmp    $0x2f,%eax
+  802090:	0f 87 a4 00 00 00    	ja     80213a <vprintfmt+0x599>
+  802096:	89 c2                	mov    %eax,%edx
+  802098:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80209c:	83 c0 08             	add    $0x8,%eax
+  80209f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020a2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020a5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8020aa:	e9 ce 00 00 00       	jmp    80217d <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8020b5:	77 19                	ja     8020d0 <vprintfmt+0x52f>
+  8020b7:	89 c2                	mov    %eax,%edx
+  8020b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020bd:	83 c0 08             	add    $0x8,%eax
+  8020c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020c6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020cb:	e9 ad 00 00 00       	jmp    80217d <vprintfmt+0x5dc>
+  8020d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020dc:	eb e5                	jmp    8020c3 <vprintfmt+0x522>
+    switch (lflag) {
+  8020de:	83 fa 01             	cmp    $0x1,%edx
+  8020e1:	75 a7                	jne    80208a <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8020e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e9:	77 41                	ja     80212c <vprintfmt+0x58b>
+  8020eb:	89 c2                	mov    %eax,%edx
+  8020ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f1:	83 c0 08             	add    $0x8,%eax
+  8020f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020fa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8020ff:	eb 7c                	jmp    80217d <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802101:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802104:	83 f8 2f             	cmp    $0x2f,%eax
+  802107:	77 15                	ja     80211e <vprintfmt+0x57d>
+  802109:	89 c2                	mov    %eax,%edx
+  80210b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80210f:	83 c0 08             	add    $0x8,%eax
+  802112:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802115:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802117:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80211c:	eb 5f                	jmp    80217d <vprintfmt+0x5dc>
+  80211e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802122:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802126:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80212a:	eb e9                	jmp    802115 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80212c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802130:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802134:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802138:	eb bd                	jmp    8020f7 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80213a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80213e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802142:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802146:	e9 57 ff ff ff       	jmp    8020a2 <vprintfmt+0x501>
+            putch('0', put_arg);
+  80214b:	4c 89 ee             	mov    %r13,%rsi
+  80214e:	bf 30 00 00 00       	mov    $0x30,%edi
+  802153:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802156:	4c 89 ee             	mov    %r13,%rsi
+  802159:	bf 78 00 00 00       	mov    $0x78,%edi
+  80215e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802161:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802164:	83 f8 2f             	cmp    $0x2f,%eax
+  802167:	77 47                	ja     8021b0 <vprintfmt+0x60f>
+  802169:	89 c2                	mov    %eax,%edx
+  80216b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80216f:	83 c0 08             	add    $0x8,%eax
+  802172:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802175:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802178:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80217d:	48 83 ec 08          	sub    $0x8,%rsp
+  802181:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802185:	0f 94 c0             	sete   %al
+  802188:	0f b6 c0             	movzbl %al,%eax
+  80218b:	50                   	push   %rax
+  80218c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802191:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802195:	4c 89 ee             	mov    %r13,%rsi
+  802198:	4c 89 f7             	mov    %r14,%rdi
+  80219b:	48 b8 96 1a 80 00 00 	movabs $0x801a96,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+            break;
+  8021a7:	48 83 c4 10          	add    $0x10,%rsp
+  8021ab:	e9 31 fa ff ff       	jmp    801be1 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8021b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021bc:	eb b7                	jmp    802175 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8021be:	40 84 f6             	test   %sil,%sil
+  8021c1:	75 2b                	jne    8021ee <vprintfmt+0x64d>
+    switch (lflag) {
+  8021c3:	85 d2                	test   %edx,%edx
+  8021c5:	7f 56                	jg     80221d <vprintfmt+0x67c>
+  8021c7:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8021ca:	7d 77                	jge    802243 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8021cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8021d2:	0f 87 a7 00 00 00    	ja     80227f <vprintfmt+0x6de>
+  8021d8:	89 c2                	mov    %eax,%edx
+  8021da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021de:	83 c0 08             	add    $0x8,%eax
+  8021e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021e4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021e7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021ec:	eb 8f                	jmp    80217d <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8021ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8021f4:	77 19                	ja     80220f <vprintfmt+0x66e>
+  8021f6:	89 c2                	mov    %eax,%edx
+  8021f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021fc:	83 c0 08             	add    $0x8,%eax
+  8021ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802202:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802205:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80220a:	e9 6e ff ff ff       	jmp    80217d <vprintfmt+0x5dc>
+  80220f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802213:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802217:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80221b:	eb e5                	jmp    802202 <vprintfmt+0x661>
+    switch (lflag) {
+  80221d:	83 fa 01             	cmp    $0x1,%edx
+  802220:	75 aa                	jne    8021cc <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802222:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802225:	83 f8 2f             	cmp    $0x2f,%eax
+  802228:	77 47                	ja     802271 <vprintfmt+0x6d0>
+  80222a:	89 c2                	mov    %eax,%edx
+  80222c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802230:	83 c0 08             	add    $0x8,%eax
+  802233:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802236:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802239:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80223e:	e9 3a ff ff ff       	jmp    80217d <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802243:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802246:	83 f8 2f             	cmp    $0x2f,%eax
+  802249:	77 18                	ja     802263 <vprintfmt+0x6c2>
+  80224b:	89 c2                	mov    %eax,%edx
+  80224d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802251:	83 c0 08             	add    $0x8,%eax
+  802254:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802257:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802259:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80225e:	e9 1a ff ff ff       	jmp    80217d <vprintfmt+0x5dc>
+  802263:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802267:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80226b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80226f:	eb e6                	jmp    802257 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802271:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802275:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802279:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80227d:	eb b7                	jmp    802236 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80227f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802283:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802287:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228b:	e9 54 ff ff ff       	jmp    8021e4 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802290:	4c 89 ee             	mov    %r13,%rsi
+  802293:	bf 25 00 00 00       	mov    $0x25,%edi
+  802298:	41 ff d6             	call   *%r14
+            break;
+  80229b:	e9 41 f9 ff ff       	jmp    801be1 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8022a0:	4c 89 ee             	mov    %r13,%rsi
+  8022a3:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022a8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8022ab:	48 83 eb 01          	sub    $0x1,%rbx
+  8022af:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8022b3:	75 f6                	jne    8022ab <vprintfmt+0x70a>
+  8022b5:	e9 27 f9 ff ff       	jmp    801be1 <vprintfmt+0x40>
+
+00000000008022ba <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8022ba:	55                   	push   %rbp
+  8022bb:	48 89 e5             	mov    %rsp,%rbp
+  8022be:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8022c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022c6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8022cb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8022cf:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8022d6:	48 85 ff             	test   %rdi,%rdi
+  8022d9:	74 2b                	je     802306 <vsnprintf+0x4c>
+  8022db:	48 85 f6             	test   %rsi,%rsi
+  8022de:	74 26                	je     802306 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8022e0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022e4:	48 bf 4c 1b 80 00 00 	movabs $0x801b4c,%rdi
+  8022eb:	00 00 00 
+  8022ee:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  8022f5:	00 00 00 
+  8022f8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8022fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022fe:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802301:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802306:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80230b:	eb f7                	jmp    802304 <vsnprintf+0x4a>
+
+000000000080230d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80230d:	55                   	push   %rbp
+  80230e:	48 89 e5             	mov    %rsp,%rbp
+  802311:	48 83 ec 50          	sub    $0x50,%rsp
+  802315:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802319:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80231d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802321:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802328:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80232c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802330:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802334:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802338:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80233c:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  802343:	00 00 00 
+  802346:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802348:	c9                   	leave
+  802349:	c3                   	ret
+
+000000000080234a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80234a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80234d:	74 10                	je     80235f <strlen+0x15>
+    size_t n = 0;
+  80234f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802354:	48 83 c0 01          	add    $0x1,%rax
+  802358:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80235c:	75 f6                	jne    802354 <strlen+0xa>
+  80235e:	c3                   	ret
+    size_t n = 0;
+  80235f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802364:	c3                   	ret
+
+0000000000802365 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802365:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802368:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80236d:	48 85 f6             	test   %rsi,%rsi
+  802370:	74 11                	je     802383 <strnlen+0x1e>
+  802372:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802376:	74 0c                	je     802384 <strnlen+0x1f>
+  802378:	48 83 c2 01          	add    $0x1,%rdx
+  80237c:	48 39 d0             	cmp    %rdx,%rax
+  80237f:	75 f1                	jne    802372 <strnlen+0xd>
+  802381:	eb 04                	jmp    802387 <strnlen+0x22>
+  802383:	c3                   	ret
+  802384:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802387:	c3                   	ret
+
+0000000000802388 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802388:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80238b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802390:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802394:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802397:	48 83 c2 01          	add    $0x1,%rdx
+  80239b:	84 c9                	test   %cl,%cl
+  80239d:	75 f1                	jne    802390 <strcpy+0x8>
+        ;
+    return res;
+}
+  80239f:	c3                   	ret
+
+00000000008023a0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8023a0:	55                   	push   %rbp
+  8023a1:	48 89 e5             	mov    %rsp,%rbp
+  8023a4:	41 54                	push   %r12
+  8023a6:	53                   	push   %rbx
+  8023a7:	48 89 fb             	mov    %rdi,%rbx
+  8023aa:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8023ad:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8023b9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8023bd:	4c 89 e6             	mov    %r12,%rsi
+  8023c0:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+    return dst;
+}
+  8023cc:	48 89 d8             	mov    %rbx,%rax
+  8023cf:	5b                   	pop    %rbx
+  8023d0:	41 5c                	pop    %r12
+  8023d2:	5d                   	pop    %rbp
+  8023d3:	c3                   	ret
+
+00000000008023d4 <toupper>:
+
+int
+toupper(int ch) {
+  8023d4:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8023d6:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8023d9:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8023dc:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023df:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023e2:	c3                   	ret
+
+00000000008023e3 <tolower>:
+
+int
+tolower(int ch) {
+  8023e3:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8023e5:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8023e8:	8d 57 20             	lea    0x20(%rdi),%edx
+  8023eb:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023ee:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023f1:	c3                   	ret
+
+00000000008023f2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8023f2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8023f5:	48 85 d2             	test   %rdx,%rdx
+  8023f8:	74 1f                	je     802419 <strncpy+0x27>
+  8023fa:	48 01 fa             	add    %rdi,%rdx
+  8023fd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802400:	48 83 c1 01          	add    $0x1,%rcx
+  802404:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802408:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80240c:	41 80 f8 01          	cmp    $0x1,%r8b
+  802410:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802414:	48 39 ca             	cmp    %rcx,%rdx
+  802417:	75 e7                	jne    802400 <strncpy+0xe>
+    }
+    return ret;
+}
+  802419:	c3                   	ret
+
+000000000080241a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80241a:	48 89 f8             	mov    %rdi,%rax
+  80241d:	48 85 d2             	test   %rdx,%rdx
+  802420:	74 24                	je     802446 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802422:	48 83 ea 01          	sub    $0x1,%rdx
+  802426:	74 1b                	je     802443 <strlcpy+0x29>
+  802428:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80242c:	0f b6 16             	movzbl (%rsi),%edx
+  80242f:	84 d2                	test   %dl,%dl
+  802431:	74 10                	je     802443 <strlcpy+0x29>
+            *dst++ = *src++;
+  802433:	48 83 c6 01          	add    $0x1,%rsi
+  802437:	48 83 c0 01          	add    $0x1,%rax
+  80243b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80243e:	48 39 c8             	cmp    %rcx,%rax
+  802441:	75 e9                	jne    80242c <strlcpy+0x12>
+        *dst = '\0';
+  802443:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802446:	48 29 f8             	sub    %rdi,%rax
+}
+  802449:	c3                   	ret
+
+000000000080244a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80244a:	0f b6 07             	movzbl (%rdi),%eax
+  80244d:	84 c0                	test   %al,%al
+  80244f:	74 13                	je     802464 <strcmp+0x1a>
+  802451:	38 06                	cmp    %al,(%rsi)
+  802453:	75 0f                	jne    802464 <strcmp+0x1a>
+  802455:	48 83 c7 01          	add    $0x1,%rdi
+  802459:	48 83 c6 01          	add    $0x1,%rsi
+  80245d:	0f b6 07             	movzbl (%rdi),%eax
+  802460:	84 c0                	test   %al,%al
+  802462:	75 ed                	jne    802451 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802464:	0f b6 c0             	movzbl %al,%eax
+  802467:	0f b6 16             	movzbl (%rsi),%edx
+  80246a:	29 d0                	sub    %edx,%eax
+}
+  80246c:	c3                   	ret
+
+000000000080246d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80246d:	48 85 d2             	test   %rdx,%rdx
+  802470:	74 1f                	je     802491 <strncmp+0x24>
+  802472:	0f b6 07             	movzbl (%rdi),%eax
+  802475:	84 c0                	test   %al,%al
+  802477:	74 1e                	je     802497 <strncmp+0x2a>
+  802479:	3a 06                	cmp    (%rsi),%al
+  80247b:	75 1a                	jne    802497 <strncmp+0x2a>
+  80247d:	48 83 c7 01          	add    $0x1,%rdi
+  802481:	48 83 c6 01          	add    $0x1,%rsi
+  802485:	48 83 ea 01          	sub    $0x1,%rdx
+  802489:	75 e7                	jne    802472 <strncmp+0x5>
+
+    if (!n) return 0;
+  80248b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802490:	c3                   	ret
+  802491:	b8 00 00 00 00       	mov    $0x0,%eax
+  802496:	c3                   	ret
+  802497:	48 85 d2             	test   %rdx,%rdx
+  80249a:	74 09                	je     8024a5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80249c:	0f b6 07             	movzbl (%rdi),%eax
+  80249f:	0f b6 16             	movzbl (%rsi),%edx
+  8024a2:	29 d0                	sub    %edx,%eax
+  8024a4:	c3                   	ret
+    if (!n) return 0;
+  8024a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024aa:	c3                   	ret
+
+00000000008024ab <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8024ab:	0f b6 17             	movzbl (%rdi),%edx
+  8024ae:	84 d2                	test   %dl,%dl
+  8024b0:	74 18                	je     8024ca <strchr+0x1f>
+        if (*str == c) {
+  8024b2:	0f be d2             	movsbl %dl,%edx
+  8024b5:	39 f2                	cmp    %esi,%edx
+  8024b7:	74 17                	je     8024d0 <strchr+0x25>
+    for (; *str; str++) {
+  8024b9:	48 83 c7 01          	add    $0x1,%rdi
+  8024bd:	0f b6 17             	movzbl (%rdi),%edx
+  8024c0:	84 d2                	test   %dl,%dl
+  8024c2:	75 ee                	jne    8024b2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8024c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c9:	c3                   	ret
+  8024ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cf:	c3                   	ret
+  8024d0:	48 89 f8             	mov    %rdi,%rax
+}
+  8024d3:	c3                   	ret
+
+00000000008024d4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8024d4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8024d7:	0f b6 17             	movzbl (%rdi),%edx
+  8024da:	84 d2                	test   %dl,%dl
+  8024dc:	74 13                	je     8024f1 <strfind+0x1d>
+  8024de:	0f be d2             	movsbl %dl,%edx
+  8024e1:	39 f2                	cmp    %esi,%edx
+  8024e3:	74 0b                	je     8024f0 <strfind+0x1c>
+  8024e5:	48 83 c0 01          	add    $0x1,%rax
+  8024e9:	0f b6 10             	movzbl (%rax),%edx
+  8024ec:	84 d2                	test   %dl,%dl
+  8024ee:	75 ee                	jne    8024de <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8024f0:	c3                   	ret
+  8024f1:	c3                   	ret
+
+00000000008024f2 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024f2:	48 39 f7             	cmp    %rsi,%rdi
+  8024f5:	74 65                	je     80255c <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8024f7:	55                   	push   %rbp
+  8024f8:	48 89 e5             	mov    %rsp,%rbp
+  8024fb:	41 57                	push   %r15
+  8024fd:	41 56                	push   %r14
+  8024ff:	41 55                	push   %r13
+  802501:	41 54                	push   %r12
+  802503:	53                   	push   %rbx
+  802504:	48 83 ec 18          	sub    $0x18,%rsp
+  802508:	48 89 fb             	mov    %rdi,%rbx
+  80250b:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80250e:	49 bf e3 23 80 00 00 	movabs $0x8023e3,%r15
+  802515:	00 00 00 
+  802518:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80251c:	41 0f b6 fd          	movzbl %r13b,%edi
+  802520:	41 ff d7             	call   *%r15
+  802523:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802526:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80252b:	41 0f b6 fe          	movzbl %r14b,%edi
+  80252f:	41 ff d7             	call   *%r15
+  802532:	89 c2                	mov    %eax,%edx
+  802534:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802537:	29 d0                	sub    %edx,%eax
+  802539:	75 12                	jne    80254d <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80253b:	48 83 c3 01          	add    $0x1,%rbx
+  80253f:	45 84 ed             	test   %r13b,%r13b
+  802542:	74 09                	je     80254d <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802544:	49 83 c4 01          	add    $0x1,%r12
+  802548:	45 84 f6             	test   %r14b,%r14b
+  80254b:	75 cb                	jne    802518 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80254d:	48 83 c4 18          	add    $0x18,%rsp
+  802551:	5b                   	pop    %rbx
+  802552:	41 5c                	pop    %r12
+  802554:	41 5d                	pop    %r13
+  802556:	41 5e                	pop    %r14
+  802558:	41 5f                	pop    %r15
+  80255a:	5d                   	pop    %rbp
+  80255b:	c3                   	ret
+    if (p1 == p2) return 0;
+  80255c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802561:	c3                   	ret
+
+0000000000802562 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802562:	48 39 f7             	cmp    %rsi,%rdi
+  802565:	74 7d                	je     8025e4 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802567:	55                   	push   %rbp
+  802568:	48 89 e5             	mov    %rsp,%rbp
+  80256b:	41 57                	push   %r15
+  80256d:	41 56                	push   %r14
+  80256f:	41 55                	push   %r13
+  802571:	41 54                	push   %r12
+  802573:	53                   	push   %rbx
+  802574:	48 83 ec 18          	sub    $0x18,%rsp
+  802578:	48 89 fb             	mov    %rdi,%rbx
+  80257b:	49 89 f4             	mov    %rsi,%r12
+  80257e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802582:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802586:	49 bf e3 23 80 00 00 	movabs $0x8023e3,%r15
+  80258d:	00 00 00 
+    while (n--) {
+  802590:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802594:	48 39 c3             	cmp    %rax,%rbx
+  802597:	74 37                	je     8025d0 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802599:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80259d:	41 0f b6 fd          	movzbl %r13b,%edi
+  8025a1:	41 ff d7             	call   *%r15
+  8025a4:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8025a7:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8025ac:	41 0f b6 fe          	movzbl %r14b,%edi
+  8025b0:	41 ff d7             	call   *%r15
+  8025b3:	89 c2                	mov    %eax,%edx
+  8025b5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8025b8:	29 d0                	sub    %edx,%eax
+  8025ba:	75 19                	jne    8025d5 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8025bc:	48 83 c3 01          	add    $0x1,%rbx
+  8025c0:	45 84 ed             	test   %r13b,%r13b
+  8025c3:	74 10                	je     8025d5 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8025c5:	49 83 c4 01          	add    $0x1,%r12
+  8025c9:	45 84 f6             	test   %r14b,%r14b
+  8025cc:	75 c2                	jne    802590 <strncasecmp+0x2e>
+  8025ce:	eb 05                	jmp    8025d5 <strncasecmp+0x73>
+  8025d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8025d5:	48 83 c4 18          	add    $0x18,%rsp
+  8025d9:	5b                   	pop    %rbx
+  8025da:	41 5c                	pop    %r12
+  8025dc:	41 5d                	pop    %r13
+  8025de:	41 5e                	pop    %r14
+  8025e0:	41 5f                	pop    %r15
+  8025e2:	5d                   	pop    %rbp
+  8025e3:	c3                   	ret
+    if (p1 == p2) return 0;
+  8025e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e9:	c3                   	ret
+
+00000000008025ea <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8025ea:	83 e7 df             	and    $0xffffffdf,%edi
+  8025ed:	83 ef 41             	sub    $0x41,%edi
+  8025f0:	83 ff 19             	cmp    $0x19,%edi
+  8025f3:	0f 96 c0             	setbe  %al
+}
+  8025f6:	c3                   	ret
+
+00000000008025f7 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8025f7:	83 ff 20             	cmp    $0x20,%edi
+  8025fa:	0f 94 c0             	sete   %al
+  8025fd:	83 ff 09             	cmp    $0x9,%edi
+  802600:	0f 94 c2             	sete   %dl
+  802603:	09 d0                	or     %edx,%eax
+}
+  802605:	c3                   	ret
+
+0000000000802606 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802606:	55                   	push   %rbp
+  802607:	48 89 e5             	mov    %rsp,%rbp
+  80260a:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80260c:	48 bf df 66 80 00 00 	movabs $0x8066df,%rdi
+  802613:	00 00 00 
+  802616:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  80261d:	00 00 00 
+  802620:	ff d0                	call   *%rax
+  802622:	48 85 c0             	test   %rax,%rax
+  802625:	0f 95 c0             	setne  %al
+}
+  802628:	5d                   	pop    %rbp
+  802629:	c3                   	ret
+
+000000000080262a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80262a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80262d:	48 89 f8             	mov    %rdi,%rax
+  802630:	48 f7 d8             	neg    %rax
+  802633:	83 e0 07             	and    $0x7,%eax
+  802636:	49 89 d1             	mov    %rdx,%r9
+  802639:	49 29 c1             	sub    %rax,%r9
+  80263c:	78 36                	js     802674 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80263e:	40 0f b6 c6          	movzbl %sil,%eax
+  802642:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802649:	01 01 01 
+  80264c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802650:	40 f6 c7 07          	test   $0x7,%dil
+  802654:	75 38                	jne    80268e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802656:	4c 89 c9             	mov    %r9,%rcx
+  802659:	48 c1 f9 03          	sar    $0x3,%rcx
+  80265d:	74 0c                	je     80266b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80265f:	fc                   	cld
+  802660:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802663:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802667:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80266b:	4d 85 c9             	test   %r9,%r9
+  80266e:	75 45                	jne    8026b5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802670:	4c 89 c0             	mov    %r8,%rax
+  802673:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802674:	48 85 d2             	test   %rdx,%rdx
+  802677:	74 f7                	je     802670 <memset+0x46>
+  802679:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80267c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80267f:	48 83 c0 01          	add    $0x1,%rax
+  802683:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802687:	48 39 c2             	cmp    %rax,%rdx
+  80268a:	75 f3                	jne    80267f <memset+0x55>
+  80268c:	eb e2                	jmp    802670 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80268e:	40 f6 c7 01          	test   $0x1,%dil
+  802692:	74 06                	je     80269a <memset+0x70>
+  802694:	88 07                	mov    %al,(%rdi)
+  802696:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80269a:	40 f6 c7 02          	test   $0x2,%dil
+  80269e:	74 07                	je     8026a7 <memset+0x7d>
+  8026a0:	66 89 07             	mov    %ax,(%rdi)
+  8026a3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026a7:	40 f6 c7 04          	test   $0x4,%dil
+  8026ab:	74 a9                	je     802656 <memset+0x2c>
+  8026ad:	89 07                	mov    %eax,(%rdi)
+  8026af:	48 83 c7 04          	add    $0x4,%rdi
+  8026b3:	eb a1                	jmp    802656 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026b5:	41 f6 c1 04          	test   $0x4,%r9b
+  8026b9:	74 06                	je     8026c1 <memset+0x97>
+  8026bb:	89 07                	mov    %eax,(%rdi)
+  8026bd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026c1:	41 f6 c1 02          	test   $0x2,%r9b
+  8026c5:	74 07                	je     8026ce <memset+0xa4>
+  8026c7:	66 89 07             	mov    %ax,(%rdi)
+  8026ca:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8026ce:	41 f6 c1 01          	test   $0x1,%r9b
+  8026d2:	74 9c                	je     802670 <memset+0x46>
+  8026d4:	88 07                	mov    %al,(%rdi)
+  8026d6:	eb 98                	jmp    802670 <memset+0x46>
+
+00000000008026d8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8026d8:	48 89 f8             	mov    %rdi,%rax
+  8026db:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8026de:	48 39 fe             	cmp    %rdi,%rsi
+  8026e1:	73 3b                	jae    80271e <memmove+0x46>
+  8026e3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8026e7:	48 39 d7             	cmp    %rdx,%rdi
+  8026ea:	73 32                	jae    80271e <memmove+0x46>
+        s += n;
+        d += n;
+  8026ec:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026f0:	48 89 d6             	mov    %rdx,%rsi
+  8026f3:	48 09 fe             	or     %rdi,%rsi
+  8026f6:	48 09 ce             	or     %rcx,%rsi
+  8026f9:	40 f6 c6 07          	test   $0x7,%sil
+  8026fd:	75 12                	jne    802711 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8026ff:	48 83 ef 08          	sub    $0x8,%rdi
+  802703:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802707:	48 c1 e9 03          	shr    $0x3,%rcx
+  80270b:	fd                   	std
+  80270c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80270f:	fc                   	cld
+  802710:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802711:	48 83 ef 01          	sub    $0x1,%rdi
+  802715:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802719:	fd                   	std
+  80271a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80271c:	eb f1                	jmp    80270f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80271e:	48 89 f2             	mov    %rsi,%rdx
+  802721:	48 09 c2             	or     %rax,%rdx
+  802724:	48 09 ca             	or     %rcx,%rdx
+  802727:	f6 c2 07             	test   $0x7,%dl
+  80272a:	75 0c                	jne    802738 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80272c:	48 c1 e9 03          	shr    $0x3,%rcx
+  802730:	48 89 c7             	mov    %rax,%rdi
+  802733:	fc                   	cld
+  802734:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802737:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802738:	48 89 c7             	mov    %rax,%rdi
+  80273b:	fc                   	cld
+  80273c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80273e:	c3                   	ret
+
+000000000080273f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80273f:	55                   	push   %rbp
+  802740:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802743:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  80274a:	00 00 00 
+  80274d:	ff d0                	call   *%rax
+}
+  80274f:	5d                   	pop    %rbp
+  802750:	c3                   	ret
+
+0000000000802751 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802751:	55                   	push   %rbp
+  802752:	48 89 e5             	mov    %rsp,%rbp
+  802755:	41 57                	push   %r15
+  802757:	41 56                	push   %r14
+  802759:	41 55                	push   %r13
+  80275b:	41 54                	push   %r12
+  80275d:	53                   	push   %rbx
+  80275e:	48 83 ec 08          	sub    $0x8,%rsp
+  802762:	49 89 fe             	mov    %rdi,%r14
+  802765:	49 89 f7             	mov    %rsi,%r15
+  802768:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80276b:	48 89 f7             	mov    %rsi,%rdi
+  80276e:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+  80277a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80277d:	48 89 de             	mov    %rbx,%rsi
+  802780:	4c 89 f7             	mov    %r14,%rdi
+  802783:	48 b8 65 23 80 00 00 	movabs $0x802365,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+  80278f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802792:	48 39 c3             	cmp    %rax,%rbx
+  802795:	74 36                	je     8027cd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802797:	48 89 d8             	mov    %rbx,%rax
+  80279a:	4c 29 e8             	sub    %r13,%rax
+  80279d:	49 39 c4             	cmp    %rax,%r12
+  8027a0:	73 31                	jae    8027d3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8027a2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8027a7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027ab:	4c 89 fe             	mov    %r15,%rsi
+  8027ae:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  8027b5:	00 00 00 
+  8027b8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8027ba:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8027be:	48 83 c4 08          	add    $0x8,%rsp
+  8027c2:	5b                   	pop    %rbx
+  8027c3:	41 5c                	pop    %r12
+  8027c5:	41 5d                	pop    %r13
+  8027c7:	41 5e                	pop    %r14
+  8027c9:	41 5f                	pop    %r15
+  8027cb:	5d                   	pop    %rbp
+  8027cc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027cd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8027d1:	eb eb                	jmp    8027be <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8027d3:	48 83 eb 01          	sub    $0x1,%rbx
+  8027d7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027db:	48 89 da             	mov    %rbx,%rdx
+  8027de:	4c 89 fe             	mov    %r15,%rsi
+  8027e1:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  8027e8:	00 00 00 
+  8027eb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8027ed:	49 01 de             	add    %rbx,%r14
+  8027f0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8027f5:	eb c3                	jmp    8027ba <strlcat+0x69>
+
+00000000008027f7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8027f7:	48 85 d2             	test   %rdx,%rdx
+  8027fa:	74 2d                	je     802829 <memcmp+0x32>
+  8027fc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802801:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802805:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80280a:	44 38 c1             	cmp    %r8b,%cl
+  80280d:	75 0f                	jne    80281e <memcmp+0x27>
+    while (n-- > 0) {
+  80280f:	48 83 c0 01          	add    $0x1,%rax
+  802813:	48 39 c2             	cmp    %rax,%rdx
+  802816:	75 e9                	jne    802801 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80281e:	0f b6 c1             	movzbl %cl,%eax
+  802821:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802825:	44 29 c0             	sub    %r8d,%eax
+  802828:	c3                   	ret
+    return 0;
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80282e:	c3                   	ret
+
+000000000080282f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80282f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802833:	48 39 c7             	cmp    %rax,%rdi
+  802836:	73 0f                	jae    802847 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802838:	40 38 37             	cmp    %sil,(%rdi)
+  80283b:	74 0e                	je     80284b <memfind+0x1c>
+    for (; src < end; src++) {
+  80283d:	48 83 c7 01          	add    $0x1,%rdi
+  802841:	48 39 f8             	cmp    %rdi,%rax
+  802844:	75 f2                	jne    802838 <memfind+0x9>
+  802846:	c3                   	ret
+  802847:	48 89 f8             	mov    %rdi,%rax
+  80284a:	c3                   	ret
+  80284b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80284e:	c3                   	ret
+
+000000000080284f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80284f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802852:	0f b6 37             	movzbl (%rdi),%esi
+  802855:	40 80 fe 20          	cmp    $0x20,%sil
+  802859:	74 06                	je     802861 <strtol+0x12>
+  80285b:	40 80 fe 09          	cmp    $0x9,%sil
+  80285f:	75 13                	jne    802874 <strtol+0x25>
+  802861:	48 83 c7 01          	add    $0x1,%rdi
+  802865:	0f b6 37             	movzbl (%rdi),%esi
+  802868:	40 80 fe 20          	cmp    $0x20,%sil
+  80286c:	74 f3                	je     802861 <strtol+0x12>
+  80286e:	40 80 fe 09          	cmp    $0x9,%sil
+  802872:	74 ed                	je     802861 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802874:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802877:	83 e0 fd             	and    $0xfffffffd,%eax
+  80287a:	3c 01                	cmp    $0x1,%al
+  80287c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802880:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802886:	75 0f                	jne    802897 <strtol+0x48>
+  802888:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80288b:	74 14                	je     8028a1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80288d:	85 d2                	test   %edx,%edx
+  80288f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802894:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802897:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80289c:	4c 63 ca             	movslq %edx,%r9
+  80289f:	eb 36                	jmp    8028d7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028a1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8028a5:	74 0f                	je     8028b6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8028a7:	85 d2                	test   %edx,%edx
+  8028a9:	75 ec                	jne    802897 <strtol+0x48>
+        s++;
+  8028ab:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8028af:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8028b4:	eb e1                	jmp    802897 <strtol+0x48>
+        s += 2;
+  8028b6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8028ba:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8028bf:	eb d6                	jmp    802897 <strtol+0x48>
+            dig -= '0';
+  8028c1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8028c4:	44 0f b6 c1          	movzbl %cl,%r8d
+  8028c8:	41 39 d0             	cmp    %edx,%r8d
+  8028cb:	7d 21                	jge    8028ee <strtol+0x9f>
+        val = val * base + dig;
+  8028cd:	49 0f af c1          	imul   %r9,%rax
+  8028d1:	0f b6 c9             	movzbl %cl,%ecx
+  8028d4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8028d7:	48 83 c7 01          	add    $0x1,%rdi
+  8028db:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8028df:	80 f9 39             	cmp    $0x39,%cl
+  8028e2:	76 dd                	jbe    8028c1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8028e4:	80 f9 7b             	cmp    $0x7b,%cl
+  8028e7:	77 05                	ja     8028ee <strtol+0x9f>
+            dig -= 'a' - 10;
+  8028e9:	83 e9 57             	sub    $0x57,%ecx
+  8028ec:	eb d6                	jmp    8028c4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8028ee:	4d 85 d2             	test   %r10,%r10
+  8028f1:	74 03                	je     8028f6 <strtol+0xa7>
+  8028f3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8028f6:	48 89 c2             	mov    %rax,%rdx
+  8028f9:	48 f7 da             	neg    %rdx
+  8028fc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802900:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802904:	c3                   	ret
+
+0000000000802905 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+  802909:	53                   	push   %rbx
+  80290a:	48 89 fa             	mov    %rdi,%rdx
+  80290d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802910:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80291f:	be 00 00 00 00       	mov    $0x0,%esi
+  802924:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80292a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802930:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802932:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802936:	c9                   	leave
+  802937:	c3                   	ret
+
+0000000000802938 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802938:	55                   	push   %rbp
+  802939:	48 89 e5             	mov    %rsp,%rbp
+  80293c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80293d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802942:	ba 00 00 00 00       	mov    $0x0,%edx
+  802947:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80294c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802951:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802956:	be 00 00 00 00       	mov    $0x0,%esi
+  80295b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802961:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802967:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802969:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80296d:	c9                   	leave
+  80296e:	c3                   	ret
+
+000000000080296f <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80296f:	55                   	push   %rbp
+  802970:	48 89 e5             	mov    %rsp,%rbp
+  802973:	53                   	push   %rbx
+  802974:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802977:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80297c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802981:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802986:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80298b:	be 00 00 00 00       	mov    $0x0,%esi
+  802990:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802996:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80299c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  80299e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029a2:	c9                   	leave
+  8029a3:	c3                   	ret
+
+00000000008029a4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8029a4:	55                   	push   %rbp
+  8029a5:	48 89 e5             	mov    %rsp,%rbp
+  8029a8:	53                   	push   %rbx
+  8029a9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8029ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029b0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029d7:	48 85 c0             	test   %rax,%rax
+  8029da:	7f 06                	jg     8029e2 <sys_env_destroy+0x3e>
+}
+  8029dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e0:	c9                   	leave
+  8029e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e2:	49 89 c0             	mov    %rax,%r8
+  8029e5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8029ea:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  8029f1:	00 00 00 
+  8029f4:	be 27 00 00 00       	mov    $0x27,%esi
+  8029f9:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802a00:	00 00 00 
+  802a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a08:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802a0f:	00 00 00 
+  802a12:	41 ff d1             	call   *%r9
+
+0000000000802a15 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a15:	55                   	push   %rbp
+  802a16:	48 89 e5             	mov    %rsp,%rbp
+  802a19:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a1a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a24:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a2e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a33:	be 00 00 00 00       	mov    $0x0,%esi
+  802a38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a44:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4a:	c9                   	leave
+  802a4b:	c3                   	ret
+
+0000000000802a4c <sys_yield>:
+
+void
+sys_yield(void) {
+  802a4c:	55                   	push   %rbp
+  802a4d:	48 89 e5             	mov    %rsp,%rbp
+  802a50:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a51:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a56:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a65:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a6a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a75:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a7b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a81:	c9                   	leave
+  802a82:	c3                   	ret
+
+0000000000802a83 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a83:	55                   	push   %rbp
+  802a84:	48 89 e5             	mov    %rsp,%rbp
+  802a87:	53                   	push   %rbx
+  802a88:	48 89 fa             	mov    %rdi,%rdx
+  802a8b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a8e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a93:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a9a:	00 00 00 
+  802a9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa2:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802ab5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ab9:	c9                   	leave
+  802aba:	c3                   	ret
+
+0000000000802abb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802abb:	55                   	push   %rbp
+  802abc:	48 89 e5             	mov    %rsp,%rbp
+  802abf:	53                   	push   %rbx
+  802ac0:	49 89 f8             	mov    %rdi,%r8
+  802ac3:	48 89 d3             	mov    %rdx,%rbx
+  802ac6:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802ac9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ace:	4c 89 c2             	mov    %r8,%rdx
+  802ad1:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ad4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802adf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ae5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802ae7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aeb:	c9                   	leave
+  802aec:	c3                   	ret
+
+0000000000802aed <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802aed:	55                   	push   %rbp
+  802aee:	48 89 e5             	mov    %rsp,%rbp
+  802af1:	53                   	push   %rbx
+  802af2:	48 83 ec 08          	sub    $0x8,%rsp
+  802af6:	89 f8                	mov    %edi,%eax
+  802af8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802afb:	48 63 f9             	movslq %ecx,%rdi
+  802afe:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b01:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b06:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b09:	be 00 00 00 00       	mov    $0x0,%esi
+  802b0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b14:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b1c:	48 85 c0             	test   %rax,%rax
+  802b1f:	7f 06                	jg     802b27 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b27:	49 89 c0             	mov    %rax,%r8
+  802b2a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b2f:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802b36:	00 00 00 
+  802b39:	be 27 00 00 00       	mov    $0x27,%esi
+  802b3e:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802b45:	00 00 00 
+  802b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4d:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802b54:	00 00 00 
+  802b57:	41 ff d1             	call   *%r9
+
+0000000000802b5a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802b5a:	55                   	push   %rbp
+  802b5b:	48 89 e5             	mov    %rsp,%rbp
+  802b5e:	53                   	push   %rbx
+  802b5f:	48 83 ec 08          	sub    $0x8,%rsp
+  802b63:	89 f8                	mov    %edi,%eax
+  802b65:	49 89 f2             	mov    %rsi,%r10
+  802b68:	48 89 cf             	mov    %rcx,%rdi
+  802b6b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b6e:	48 63 da             	movslq %edx,%rbx
+  802b71:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b74:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b79:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b7c:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b85:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b87:	48 85 c0             	test   %rax,%rax
+  802b8a:	7f 06                	jg     802b92 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b92:	49 89 c0             	mov    %rax,%r8
+  802b95:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b9a:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802ba1:	00 00 00 
+  802ba4:	be 27 00 00 00       	mov    $0x27,%esi
+  802ba9:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802bb0:	00 00 00 
+  802bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb8:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802bbf:	00 00 00 
+  802bc2:	41 ff d1             	call   *%r9
+
+0000000000802bc5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802bc5:	55                   	push   %rbp
+  802bc6:	48 89 e5             	mov    %rsp,%rbp
+  802bc9:	53                   	push   %rbx
+  802bca:	48 83 ec 08          	sub    $0x8,%rsp
+  802bce:	48 89 f1             	mov    %rsi,%rcx
+  802bd1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802bd4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bd7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bdc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be1:	be 00 00 00 00       	mov    $0x0,%esi
+  802be6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bf2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bf4:	48 85 c0             	test   %rax,%rax
+  802bf7:	7f 06                	jg     802bff <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802bf9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bfd:	c9                   	leave
+  802bfe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bff:	49 89 c0             	mov    %rax,%r8
+  802c02:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c07:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802c0e:	00 00 00 
+  802c11:	be 27 00 00 00       	mov    $0x27,%esi
+  802c16:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802c1d:	00 00 00 
+  802c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c25:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802c2c:	00 00 00 
+  802c2f:	41 ff d1             	call   *%r9
+
+0000000000802c32 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c32:	55                   	push   %rbp
+  802c33:	48 89 e5             	mov    %rsp,%rbp
+  802c36:	53                   	push   %rbx
+  802c37:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c3b:	48 63 ce             	movslq %esi,%rcx
+  802c3e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c41:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c4b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c50:	be 00 00 00 00       	mov    $0x0,%esi
+  802c55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c61:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c63:	48 85 c0             	test   %rax,%rax
+  802c66:	7f 06                	jg     802c6e <sys_env_set_status+0x3c>
+}
+  802c68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c6c:	c9                   	leave
+  802c6d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c6e:	49 89 c0             	mov    %rax,%r8
+  802c71:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c76:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802c7d:	00 00 00 
+  802c80:	be 27 00 00 00       	mov    $0x27,%esi
+  802c85:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802c8c:	00 00 00 
+  802c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c94:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802c9b:	00 00 00 
+  802c9e:	41 ff d1             	call   *%r9
+
+0000000000802ca1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802ca1:	55                   	push   %rbp
+  802ca2:	48 89 e5             	mov    %rsp,%rbp
+  802ca5:	53                   	push   %rbx
+  802ca6:	48 83 ec 08          	sub    $0x8,%rsp
+  802caa:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802cad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cbf:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cd0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cd2:	48 85 c0             	test   %rax,%rax
+  802cd5:	7f 06                	jg     802cdd <sys_env_set_trapframe+0x3c>
+}
+  802cd7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cdb:	c9                   	leave
+  802cdc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cdd:	49 89 c0             	mov    %rax,%r8
+  802ce0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802ce5:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802cec:	00 00 00 
+  802cef:	be 27 00 00 00       	mov    $0x27,%esi
+  802cf4:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802cfb:	00 00 00 
+  802cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d03:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802d0a:	00 00 00 
+  802d0d:	41 ff d1             	call   *%r9
+
+0000000000802d10 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802d10:	55                   	push   %rbp
+  802d11:	48 89 e5             	mov    %rsp,%rbp
+  802d14:	53                   	push   %rbx
+  802d15:	48 83 ec 08          	sub    $0x8,%rsp
+  802d19:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d1c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d1f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d29:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d2e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d39:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d3f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d41:	48 85 c0             	test   %rax,%rax
+  802d44:	7f 06                	jg     802d4c <sys_env_set_pgfault_upcall+0x3c>
+}
+  802d46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4a:	c9                   	leave
+  802d4b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d4c:	49 89 c0             	mov    %rax,%r8
+  802d4f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802d54:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802d5b:	00 00 00 
+  802d5e:	be 27 00 00 00       	mov    $0x27,%esi
+  802d63:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802d6a:	00 00 00 
+  802d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d72:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802d79:	00 00 00 
+  802d7c:	41 ff d1             	call   *%r9
+
+0000000000802d7f <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d7f:	55                   	push   %rbp
+  802d80:	48 89 e5             	mov    %rsp,%rbp
+  802d83:	53                   	push   %rbx
+  802d84:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d88:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d8c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d8f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d99:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d9e:	be 00 00 00 00       	mov    $0x0,%esi
+  802da3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802da9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802daf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802db1:	48 85 c0             	test   %rax,%rax
+  802db4:	7f 06                	jg     802dbc <sys_env_set_reclaim+0x3d>
+}
+  802db6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dba:	c9                   	leave
+  802dbb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dbc:	49 89 c0             	mov    %rax,%r8
+  802dbf:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802dc4:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802dcb:	00 00 00 
+  802dce:	be 27 00 00 00       	mov    $0x27,%esi
+  802dd3:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802dda:	00 00 00 
+  802ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de2:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802de9:	00 00 00 
+  802dec:	41 ff d1             	call   *%r9
+
+0000000000802def <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802def:	55                   	push   %rbp
+  802df0:	48 89 e5             	mov    %rsp,%rbp
+  802df3:	53                   	push   %rbx
+  802df4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802df8:	48 63 ce             	movslq %esi,%rcx
+  802dfb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dfe:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e08:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e1e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e20:	48 85 c0             	test   %rax,%rax
+  802e23:	7f 06                	jg     802e2b <sys_env_set_nice+0x3c>
+}
+  802e25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e29:	c9                   	leave
+  802e2a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e2b:	49 89 c0             	mov    %rax,%r8
+  802e2e:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e33:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802e3a:	00 00 00 
+  802e3d:	be 27 00 00 00       	mov    $0x27,%esi
+  802e42:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802e49:	00 00 00 
+  802e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e51:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802e58:	00 00 00 
+  802e5b:	41 ff d1             	call   *%r9
+
+0000000000802e5e <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802e5e:	55                   	push   %rbp
+  802e5f:	48 89 e5             	mov    %rsp,%rbp
+  802e62:	53                   	push   %rbx
+  802e63:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e66:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e85:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e8b:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e91:	c9                   	leave
+  802e92:	c3                   	ret
+
+0000000000802e93 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e93:	55                   	push   %rbp
+  802e94:	48 89 e5             	mov    %rsp,%rbp
+  802e97:	53                   	push   %rbx
+  802e98:	89 f8                	mov    %edi,%eax
+  802e9a:	49 89 f1             	mov    %rsi,%r9
+  802e9d:	48 89 d3             	mov    %rdx,%rbx
+  802ea0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ea3:	49 63 f0             	movslq %r8d,%rsi
+  802ea6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ea9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802eae:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eb1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ebd:	cd 30                	int    $0x30
+}
+  802ebf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ec3:	c9                   	leave
+  802ec4:	c3                   	ret
+
+0000000000802ec5 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ec5:	55                   	push   %rbp
+  802ec6:	48 89 e5             	mov    %rsp,%rbp
+  802ec9:	53                   	push   %rbx
+  802eca:	89 f8                	mov    %edi,%eax
+  802ecc:	49 89 f1             	mov    %rsi,%r9
+  802ecf:	48 89 d3             	mov    %rdx,%rbx
+  802ed2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ed5:	49 63 f0             	movslq %r8d,%rsi
+  802ed8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802edb:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ee0:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ee3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ee9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802eef:	cd 30                	int    $0x30
+}
+  802ef1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ef5:	c9                   	leave
+  802ef6:	c3                   	ret
+
+0000000000802ef7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802ef7:	55                   	push   %rbp
+  802ef8:	48 89 e5             	mov    %rsp,%rbp
+  802efb:	53                   	push   %rbx
+  802efc:	48 83 ec 08          	sub    $0x8,%rsp
+  802f00:	89 f8                	mov    %edi,%eax
+  802f02:	49 89 f2             	mov    %rsi,%r10
+  802f05:	48 89 d3             	mov    %rdx,%rbx
+  802f08:	48 89 cf             	mov    %rcx,%rdi
+  802f0b:	44 89 c6             	mov    %r8d,%esi
+  802f0e:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f11:	48 63 f6             	movslq %esi,%rsi
+  802f14:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f17:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f1c:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f1f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f25:	48 85 c0             	test   %rax,%rax
+  802f28:	7f 06                	jg     802f30 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f2e:	c9                   	leave
+  802f2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f30:	49 89 c0             	mov    %rax,%r8
+  802f33:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f38:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802f3f:	00 00 00 
+  802f42:	be 27 00 00 00       	mov    $0x27,%esi
+  802f47:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802f4e:	00 00 00 
+  802f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f56:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802f5d:	00 00 00 
+  802f60:	41 ff d1             	call   *%r9
+
+0000000000802f63 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802f63:	55                   	push   %rbp
+  802f64:	48 89 e5             	mov    %rsp,%rbp
+  802f67:	53                   	push   %rbx
+  802f68:	48 83 ec 08          	sub    $0x8,%rsp
+  802f6c:	48 89 f1             	mov    %rsi,%rcx
+  802f6f:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f72:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f76:	48 8b 1a             	mov    (%rdx),%rbx
+  802f79:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f7c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f81:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f85:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f89:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f8d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f8f:	48 85 c0             	test   %rax,%rax
+  802f92:	7f 06                	jg     802f9a <sys_ipc_call_short+0x37>
+}
+  802f94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f98:	c9                   	leave
+  802f99:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f9a:	49 89 c0             	mov    %rax,%r8
+  802f9d:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802fa2:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  802fa9:	00 00 00 
+  802fac:	be 27 00 00 00       	mov    $0x27,%esi
+  802fb1:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  802fb8:	00 00 00 
+  802fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc0:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  802fc7:	00 00 00 
+  802fca:	41 ff d1             	call   *%r9
+
+0000000000802fcd <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802fcd:	55                   	push   %rbp
+  802fce:	48 89 e5             	mov    %rsp,%rbp
+  802fd1:	53                   	push   %rbx
+  802fd2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fd6:	89 f8                	mov    %edi,%eax
+  802fd8:	49 89 f2             	mov    %rsi,%r10
+  802fdb:	48 89 d3             	mov    %rdx,%rbx
+  802fde:	48 89 cf             	mov    %rcx,%rdi
+  802fe1:	44 89 c6             	mov    %r8d,%esi
+  802fe4:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802fe7:	48 63 f6             	movslq %esi,%rsi
+  802fea:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fed:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ff2:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802ff5:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802ff9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ffb:	48 85 c0             	test   %rax,%rax
+  802ffe:	7f 06                	jg     803006 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803000:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803004:	c9                   	leave
+  803005:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803006:	49 89 c0             	mov    %rax,%r8
+  803009:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80300e:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  803015:	00 00 00 
+  803018:	be 27 00 00 00       	mov    $0x27,%esi
+  80301d:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  803024:	00 00 00 
+  803027:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302c:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  803033:	00 00 00 
+  803036:	41 ff d1             	call   *%r9
+
+0000000000803039 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803039:	55                   	push   %rbp
+  80303a:	48 89 e5             	mov    %rsp,%rbp
+  80303d:	53                   	push   %rbx
+  80303e:	48 83 ec 08          	sub    $0x8,%rsp
+  803042:	48 89 fa             	mov    %rdi,%rdx
+  803045:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803048:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80304d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803052:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803057:	be 00 00 00 00       	mov    $0x0,%esi
+  80305c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803062:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803068:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80306a:	48 85 c0             	test   %rax,%rax
+  80306d:	7f 06                	jg     803075 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80306f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803073:	c9                   	leave
+  803074:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803075:	49 89 c0             	mov    %rax,%r8
+  803078:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80307d:	48 ba e8 66 80 00 00 	movabs $0x8066e8,%rdx
+  803084:	00 00 00 
+  803087:	be 27 00 00 00       	mov    $0x27,%esi
+  80308c:	48 bf 07 67 80 00 00 	movabs $0x806707,%rdi
+  803093:	00 00 00 
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309b:	49 b9 01 19 80 00 00 	movabs $0x801901,%r9
+  8030a2:	00 00 00 
+  8030a5:	41 ff d1             	call   *%r9
+
+00000000008030a8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8030a8:	55                   	push   %rbp
+  8030a9:	48 89 e5             	mov    %rsp,%rbp
+  8030ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030ad:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8030cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030d7:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030dd:	c9                   	leave
+  8030de:	c3                   	ret
+
+00000000008030df <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8030df:	55                   	push   %rbp
+  8030e0:	48 89 e5             	mov    %rsp,%rbp
+  8030e3:	53                   	push   %rbx
+  8030e4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030e7:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030fb:	be 00 00 00 00       	mov    $0x0,%esi
+  803100:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803106:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80310c:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  80310e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803112:	c9                   	leave
+  803113:	c3                   	ret
+
+0000000000803114 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803114:	55                   	push   %rbp
+  803115:	48 89 e5             	mov    %rsp,%rbp
+  803118:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803119:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80311e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803123:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803128:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80312d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803132:	be 00 00 00 00       	mov    $0x0,%esi
+  803137:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80313d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803143:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803145:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803149:	c9                   	leave
+  80314a:	c3                   	ret
+
+000000000080314b <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80314b:	55                   	push   %rbp
+  80314c:	48 89 e5             	mov    %rsp,%rbp
+  80314f:	53                   	push   %rbx
+  803150:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803154:	b8 08 00 00 00       	mov    $0x8,%eax
+  803159:	cd 30                	int    $0x30
+  80315b:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  80315d:	85 c0                	test   %eax,%eax
+  80315f:	0f 88 85 00 00 00    	js     8031ea <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803165:	0f 84 ac 00 00 00    	je     803217 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  80316b:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  803171:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  803178:	00 00 00 
+  80317b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803180:	89 c2                	mov    %eax,%edx
+  803182:	be 00 00 00 00       	mov    $0x0,%esi
+  803187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80318c:	48 b8 5a 2b 80 00 00 	movabs $0x802b5a,%rax
+  803193:	00 00 00 
+  803196:	ff d0                	call   *%rax
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	0f 88 a8 00 00 00    	js     803248 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8031a0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031a7:	00 00 00 
+  8031aa:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  8031b1:	89 df                	mov    %ebx,%edi
+  8031b3:	48 b8 10 2d 80 00 00 	movabs $0x802d10,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+  8031bf:	85 c0                	test   %eax,%eax
+  8031c1:	0f 88 ae 00 00 00    	js     803275 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8031c7:	be 02 00 00 00       	mov    $0x2,%esi
+  8031cc:	89 df                	mov    %ebx,%edi
+  8031ce:	48 b8 32 2c 80 00 00 	movabs $0x802c32,%rax
+  8031d5:	00 00 00 
+  8031d8:	ff d0                	call   *%rax
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	0f 88 c0 00 00 00    	js     8032a2 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  8031e2:	89 d8                	mov    %ebx,%eax
+  8031e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031e8:	c9                   	leave
+  8031e9:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  8031ea:	89 c1                	mov    %eax,%ecx
+  8031ec:	48 ba 15 67 80 00 00 	movabs $0x806715,%rdx
+  8031f3:	00 00 00 
+  8031f6:	be 20 00 00 00       	mov    $0x20,%esi
+  8031fb:	48 bf 25 67 80 00 00 	movabs $0x806725,%rdi
+  803202:	00 00 00 
+  803205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320a:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803211:	00 00 00 
+  803214:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803217:	48 b8 15 2a 80 00 00 	movabs $0x802a15,%rax
+  80321e:	00 00 00 
+  803221:	ff d0                	call   *%rax
+  803223:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803228:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80322f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803236:	00 00 00 
+  803239:	48 01 d0             	add    %rdx,%rax
+  80323c:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  803243:	00 00 00 
+        return 0;
+  803246:	eb 9a                	jmp    8031e2 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803248:	89 c1                	mov    %eax,%ecx
+  80324a:	48 ba 30 67 80 00 00 	movabs $0x806730,%rdx
+  803251:	00 00 00 
+  803254:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803259:	48 bf 25 67 80 00 00 	movabs $0x806725,%rdi
+  803260:	00 00 00 
+  803263:	b8 00 00 00 00       	mov    $0x0,%eax
+  803268:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  80326f:	00 00 00 
+  803272:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803275:	89 c1                	mov    %eax,%ecx
+  803277:	48 ba 78 67 80 00 00 	movabs $0x806778,%rdx
+  80327e:	00 00 00 
+  803281:	be 32 00 00 00       	mov    $0x32,%esi
+  803286:	48 bf 25 67 80 00 00 	movabs $0x806725,%rdi
+  80328d:	00 00 00 
+  803290:	b8 00 00 00 00       	mov    $0x0,%eax
+  803295:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  80329c:	00 00 00 
+  80329f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8032a2:	89 c1                	mov    %eax,%ecx
+  8032a4:	48 ba 43 67 80 00 00 	movabs $0x806743,%rdx
+  8032ab:	00 00 00 
+  8032ae:	be 37 00 00 00       	mov    $0x37,%esi
+  8032b3:	48 bf 25 67 80 00 00 	movabs $0x806725,%rdi
+  8032ba:	00 00 00 
+  8032bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c2:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  8032c9:	00 00 00 
+  8032cc:	41 ff d0             	call   *%r8
+
+00000000008032cf <sfork>:
+
+envid_t
+sfork() {
+  8032cf:	55                   	push   %rbp
+  8032d0:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8032d3:	48 ba 5a 67 80 00 00 	movabs $0x80675a,%rdx
+  8032da:	00 00 00 
+  8032dd:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8032e2:	48 bf 25 67 80 00 00 	movabs $0x806725,%rdi
+  8032e9:	00 00 00 
+  8032ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f1:	48 b9 01 19 80 00 00 	movabs $0x801901,%rcx
+  8032f8:	00 00 00 
+  8032fb:	ff d1                	call   *%rcx
+
+00000000008032fd <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8032fd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803304:	ff ff ff 
+  803307:	48 01 f8             	add    %rdi,%rax
+  80330a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80330e:	c3                   	ret
+
+000000000080330f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80330f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803316:	ff ff ff 
+  803319:	48 01 f8             	add    %rdi,%rax
+  80331c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803320:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803326:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80332a:	c3                   	ret
+
+000000000080332b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80332b:	55                   	push   %rbp
+  80332c:	48 89 e5             	mov    %rsp,%rbp
+  80332f:	41 57                	push   %r15
+  803331:	41 56                	push   %r14
+  803333:	41 55                	push   %r13
+  803335:	41 54                	push   %r12
+  803337:	53                   	push   %rbx
+  803338:	48 83 ec 08          	sub    $0x8,%rsp
+  80333c:	49 89 ff             	mov    %rdi,%r15
+  80333f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803344:	49 bd 2b 48 80 00 00 	movabs $0x80482b,%r13
+  80334b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80334e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803354:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803357:	48 89 df             	mov    %rbx,%rdi
+  80335a:	41 ff d5             	call   *%r13
+  80335d:	83 e0 04             	and    $0x4,%eax
+  803360:	74 17                	je     803379 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803362:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803369:	4c 39 f3             	cmp    %r14,%rbx
+  80336c:	75 e6                	jne    803354 <fd_alloc+0x29>
+  80336e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803374:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803379:	4d 89 27             	mov    %r12,(%r15)
+}
+  80337c:	48 83 c4 08          	add    $0x8,%rsp
+  803380:	5b                   	pop    %rbx
+  803381:	41 5c                	pop    %r12
+  803383:	41 5d                	pop    %r13
+  803385:	41 5e                	pop    %r14
+  803387:	41 5f                	pop    %r15
+  803389:	5d                   	pop    %rbp
+  80338a:	c3                   	ret
+
+000000000080338b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80338b:	83 ff 1f             	cmp    $0x1f,%edi
+  80338e:	77 39                	ja     8033c9 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803390:	55                   	push   %rbp
+  803391:	48 89 e5             	mov    %rsp,%rbp
+  803394:	41 54                	push   %r12
+  803396:	53                   	push   %rbx
+  803397:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80339a:	48 63 df             	movslq %edi,%rbx
+  80339d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8033a4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8033a8:	48 89 df             	mov    %rbx,%rdi
+  8033ab:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  8033b2:	00 00 00 
+  8033b5:	ff d0                	call   *%rax
+  8033b7:	a8 04                	test   $0x4,%al
+  8033b9:	74 14                	je     8033cf <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8033bb:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8033bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c4:	5b                   	pop    %rbx
+  8033c5:	41 5c                	pop    %r12
+  8033c7:	5d                   	pop    %rbp
+  8033c8:	c3                   	ret
+        return -E_INVAL;
+  8033c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8033ce:	c3                   	ret
+        return -E_INVAL;
+  8033cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033d4:	eb ee                	jmp    8033c4 <fd_lookup+0x39>
+
+00000000008033d6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8033d6:	55                   	push   %rbp
+  8033d7:	48 89 e5             	mov    %rsp,%rbp
+  8033da:	41 54                	push   %r12
+  8033dc:	53                   	push   %rbx
+  8033dd:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8033e0:	48 b8 20 68 80 00 00 	movabs $0x806820,%rax
+  8033e7:	00 00 00 
+  8033ea:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8033f1:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8033f4:	39 3b                	cmp    %edi,(%rbx)
+  8033f6:	74 47                	je     80343f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8033f8:	48 83 c0 08          	add    $0x8,%rax
+  8033fc:	48 8b 18             	mov    (%rax),%rbx
+  8033ff:	48 85 db             	test   %rbx,%rbx
+  803402:	75 f0                	jne    8033f4 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803404:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80340b:	00 00 00 
+  80340e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803414:	89 fa                	mov    %edi,%edx
+  803416:	48 bf 98 67 80 00 00 	movabs $0x806798,%rdi
+  80341d:	00 00 00 
+  803420:	b8 00 00 00 00       	mov    $0x0,%eax
+  803425:	48 b9 51 1a 80 00 00 	movabs $0x801a51,%rcx
+  80342c:	00 00 00 
+  80342f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803431:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803436:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80343a:	5b                   	pop    %rbx
+  80343b:	41 5c                	pop    %r12
+  80343d:	5d                   	pop    %rbp
+  80343e:	c3                   	ret
+            return 0;
+  80343f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803444:	eb f0                	jmp    803436 <dev_lookup+0x60>
+
+0000000000803446 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803446:	55                   	push   %rbp
+  803447:	48 89 e5             	mov    %rsp,%rbp
+  80344a:	41 55                	push   %r13
+  80344c:	41 54                	push   %r12
+  80344e:	53                   	push   %rbx
+  80344f:	48 83 ec 18          	sub    $0x18,%rsp
+  803453:	48 89 fb             	mov    %rdi,%rbx
+  803456:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803459:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803460:	ff ff ff 
+  803463:	48 01 df             	add    %rbx,%rdi
+  803466:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80346a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80346e:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  803475:	00 00 00 
+  803478:	ff d0                	call   *%rax
+  80347a:	41 89 c5             	mov    %eax,%r13d
+  80347d:	85 c0                	test   %eax,%eax
+  80347f:	78 06                	js     803487 <fd_close+0x41>
+  803481:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803485:	74 1a                	je     8034a1 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803487:	45 84 e4             	test   %r12b,%r12b
+  80348a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803493:	44 89 e8             	mov    %r13d,%eax
+  803496:	48 83 c4 18          	add    $0x18,%rsp
+  80349a:	5b                   	pop    %rbx
+  80349b:	41 5c                	pop    %r12
+  80349d:	41 5d                	pop    %r13
+  80349f:	5d                   	pop    %rbp
+  8034a0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034a1:	8b 3b                	mov    (%rbx),%edi
+  8034a3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034a7:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  8034ae:	00 00 00 
+  8034b1:	ff d0                	call   *%rax
+  8034b3:	41 89 c5             	mov    %eax,%r13d
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	78 1b                	js     8034d5 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8034ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034be:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034c2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8034c8:	48 85 c0             	test   %rax,%rax
+  8034cb:	74 08                	je     8034d5 <fd_close+0x8f>
+  8034cd:	48 89 df             	mov    %rbx,%rdi
+  8034d0:	ff d0                	call   *%rax
+  8034d2:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8034d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034da:	48 89 de             	mov    %rbx,%rsi
+  8034dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034e2:	48 b8 c5 2b 80 00 00 	movabs $0x802bc5,%rax
+  8034e9:	00 00 00 
+  8034ec:	ff d0                	call   *%rax
+    return res;
+  8034ee:	eb a3                	jmp    803493 <fd_close+0x4d>
+
+00000000008034f0 <close>:
+
+int
+close(int fdnum) {
+  8034f0:	55                   	push   %rbp
+  8034f1:	48 89 e5             	mov    %rsp,%rbp
+  8034f4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034fc:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  803503:	00 00 00 
+  803506:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803508:	85 c0                	test   %eax,%eax
+  80350a:	78 15                	js     803521 <close+0x31>
+
+    return fd_close(fd, 1);
+  80350c:	be 01 00 00 00       	mov    $0x1,%esi
+  803511:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803515:	48 b8 46 34 80 00 00 	movabs $0x803446,%rax
+  80351c:	00 00 00 
+  80351f:	ff d0                	call   *%rax
+}
+  803521:	c9                   	leave
+  803522:	c3                   	ret
+
+0000000000803523 <close_all>:
+
+void
+close_all(void) {
+  803523:	55                   	push   %rbp
+  803524:	48 89 e5             	mov    %rsp,%rbp
+  803527:	41 54                	push   %r12
+  803529:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80352a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80352f:	49 bc f0 34 80 00 00 	movabs $0x8034f0,%r12
+  803536:	00 00 00 
+  803539:	89 df                	mov    %ebx,%edi
+  80353b:	41 ff d4             	call   *%r12
+  80353e:	83 c3 01             	add    $0x1,%ebx
+  803541:	83 fb 20             	cmp    $0x20,%ebx
+  803544:	75 f3                	jne    803539 <close_all+0x16>
+}
+  803546:	5b                   	pop    %rbx
+  803547:	41 5c                	pop    %r12
+  803549:	5d                   	pop    %rbp
+  80354a:	c3                   	ret
+
+000000000080354b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80354b:	55                   	push   %rbp
+  80354c:	48 89 e5             	mov    %rsp,%rbp
+  80354f:	41 57                	push   %r15
+  803551:	41 56                	push   %r14
+  803553:	41 55                	push   %r13
+  803555:	41 54                	push   %r12
+  803557:	53                   	push   %rbx
+  803558:	48 83 ec 18          	sub    $0x18,%rsp
+  80355c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80355f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803563:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  80356a:	00 00 00 
+  80356d:	ff d0                	call   *%rax
+  80356f:	89 c3                	mov    %eax,%ebx
+  803571:	85 c0                	test   %eax,%eax
+  803573:	0f 88 b8 00 00 00    	js     803631 <dup+0xe6>
+    close(newfdnum);
+  803579:	44 89 e7             	mov    %r12d,%edi
+  80357c:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803588:	4d 63 ec             	movslq %r12d,%r13
+  80358b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803592:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803596:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80359a:	4c 89 ff             	mov    %r15,%rdi
+  80359d:	49 be 0f 33 80 00 00 	movabs $0x80330f,%r14
+  8035a4:	00 00 00 
+  8035a7:	41 ff d6             	call   *%r14
+  8035aa:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8035ad:	4c 89 ef             	mov    %r13,%rdi
+  8035b0:	41 ff d6             	call   *%r14
+  8035b3:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8035b6:	48 89 df             	mov    %rbx,%rdi
+  8035b9:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  8035c0:	00 00 00 
+  8035c3:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8035c5:	a8 04                	test   $0x4,%al
+  8035c7:	74 2b                	je     8035f4 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8035c9:	41 89 c1             	mov    %eax,%r9d
+  8035cc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035d2:	4c 89 f1             	mov    %r14,%rcx
+  8035d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035da:	48 89 de             	mov    %rbx,%rsi
+  8035dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e2:	48 b8 5a 2b 80 00 00 	movabs $0x802b5a,%rax
+  8035e9:	00 00 00 
+  8035ec:	ff d0                	call   *%rax
+  8035ee:	89 c3                	mov    %eax,%ebx
+  8035f0:	85 c0                	test   %eax,%eax
+  8035f2:	78 4e                	js     803642 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8035f4:	4c 89 ff             	mov    %r15,%rdi
+  8035f7:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  8035fe:	00 00 00 
+  803601:	ff d0                	call   *%rax
+  803603:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803606:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80360c:	4c 89 e9             	mov    %r13,%rcx
+  80360f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803614:	4c 89 fe             	mov    %r15,%rsi
+  803617:	bf 00 00 00 00       	mov    $0x0,%edi
+  80361c:	48 b8 5a 2b 80 00 00 	movabs $0x802b5a,%rax
+  803623:	00 00 00 
+  803626:	ff d0                	call   *%rax
+  803628:	89 c3                	mov    %eax,%ebx
+  80362a:	85 c0                	test   %eax,%eax
+  80362c:	78 14                	js     803642 <dup+0xf7>
+
+    return newfdnum;
+  80362e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803631:	89 d8                	mov    %ebx,%eax
+  803633:	48 83 c4 18          	add    $0x18,%rsp
+  803637:	5b                   	pop    %rbx
+  803638:	41 5c                	pop    %r12
+  80363a:	41 5d                	pop    %r13
+  80363c:	41 5e                	pop    %r14
+  80363e:	41 5f                	pop    %r15
+  803640:	5d                   	pop    %rbp
+  803641:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803642:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803647:	4c 89 ee             	mov    %r13,%rsi
+  80364a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80364f:	49 bc c5 2b 80 00 00 	movabs $0x802bc5,%r12
+  803656:	00 00 00 
+  803659:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80365c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803661:	4c 89 f6             	mov    %r14,%rsi
+  803664:	bf 00 00 00 00       	mov    $0x0,%edi
+  803669:	41 ff d4             	call   *%r12
+    return res;
+  80366c:	eb c3                	jmp    803631 <dup+0xe6>
+
+000000000080366e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80366e:	55                   	push   %rbp
+  80366f:	48 89 e5             	mov    %rsp,%rbp
+  803672:	41 56                	push   %r14
+  803674:	41 55                	push   %r13
+  803676:	41 54                	push   %r12
+  803678:	53                   	push   %rbx
+  803679:	48 83 ec 10          	sub    $0x10,%rsp
+  80367d:	89 fb                	mov    %edi,%ebx
+  80367f:	49 89 f4             	mov    %rsi,%r12
+  803682:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803685:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803689:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+  803695:	85 c0                	test   %eax,%eax
+  803697:	78 4c                	js     8036e5 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803699:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80369d:	41 8b 3e             	mov    (%r14),%edi
+  8036a0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036a4:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	78 35                	js     8036e9 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8036b4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8036b8:	83 e0 03             	and    $0x3,%eax
+  8036bb:	83 f8 01             	cmp    $0x1,%eax
+  8036be:	74 2d                	je     8036ed <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036c0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036c4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8036c8:	48 85 c0             	test   %rax,%rax
+  8036cb:	74 56                	je     803723 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8036cd:	4c 89 ea             	mov    %r13,%rdx
+  8036d0:	4c 89 e6             	mov    %r12,%rsi
+  8036d3:	4c 89 f7             	mov    %r14,%rdi
+  8036d6:	ff d0                	call   *%rax
+}
+  8036d8:	48 83 c4 10          	add    $0x10,%rsp
+  8036dc:	5b                   	pop    %rbx
+  8036dd:	41 5c                	pop    %r12
+  8036df:	41 5d                	pop    %r13
+  8036e1:	41 5e                	pop    %r14
+  8036e3:	5d                   	pop    %rbp
+  8036e4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036e5:	48 98                	cltq
+  8036e7:	eb ef                	jmp    8036d8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036e9:	48 98                	cltq
+  8036eb:	eb eb                	jmp    8036d8 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8036ed:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8036f4:	00 00 00 
+  8036f7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8036fd:	89 da                	mov    %ebx,%edx
+  8036ff:	48 bf d9 67 80 00 00 	movabs $0x8067d9,%rdi
+  803706:	00 00 00 
+  803709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370e:	48 b9 51 1a 80 00 00 	movabs $0x801a51,%rcx
+  803715:	00 00 00 
+  803718:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80371a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803721:	eb b5                	jmp    8036d8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803723:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80372a:	eb ac                	jmp    8036d8 <read+0x6a>
+
+000000000080372c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80372c:	55                   	push   %rbp
+  80372d:	48 89 e5             	mov    %rsp,%rbp
+  803730:	41 57                	push   %r15
+  803732:	41 56                	push   %r14
+  803734:	41 55                	push   %r13
+  803736:	41 54                	push   %r12
+  803738:	53                   	push   %rbx
+  803739:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80373d:	48 85 d2             	test   %rdx,%rdx
+  803740:	74 54                	je     803796 <readn+0x6a>
+  803742:	41 89 fd             	mov    %edi,%r13d
+  803745:	49 89 f6             	mov    %rsi,%r14
+  803748:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80374b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803750:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803755:	49 bf 6e 36 80 00 00 	movabs $0x80366e,%r15
+  80375c:	00 00 00 
+  80375f:	4c 89 e2             	mov    %r12,%rdx
+  803762:	48 29 f2             	sub    %rsi,%rdx
+  803765:	4c 01 f6             	add    %r14,%rsi
+  803768:	44 89 ef             	mov    %r13d,%edi
+  80376b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80376e:	85 c0                	test   %eax,%eax
+  803770:	78 20                	js     803792 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803772:	01 c3                	add    %eax,%ebx
+  803774:	85 c0                	test   %eax,%eax
+  803776:	74 08                	je     803780 <readn+0x54>
+  803778:	48 63 f3             	movslq %ebx,%rsi
+  80377b:	4c 39 e6             	cmp    %r12,%rsi
+  80377e:	72 df                	jb     80375f <readn+0x33>
+    }
+    return res;
+  803780:	48 63 c3             	movslq %ebx,%rax
+}
+  803783:	48 83 c4 08          	add    $0x8,%rsp
+  803787:	5b                   	pop    %rbx
+  803788:	41 5c                	pop    %r12
+  80378a:	41 5d                	pop    %r13
+  80378c:	41 5e                	pop    %r14
+  80378e:	41 5f                	pop    %r15
+  803790:	5d                   	pop    %rbp
+  803791:	c3                   	ret
+        if (inc < 0) return inc;
+  803792:	48 98                	cltq
+  803794:	eb ed                	jmp    803783 <readn+0x57>
+    int inc = 1, res = 0;
+  803796:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80379b:	eb e3                	jmp    803780 <readn+0x54>
+
+000000000080379d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80379d:	55                   	push   %rbp
+  80379e:	48 89 e5             	mov    %rsp,%rbp
+  8037a1:	41 56                	push   %r14
+  8037a3:	41 55                	push   %r13
+  8037a5:	41 54                	push   %r12
+  8037a7:	53                   	push   %rbx
+  8037a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8037ac:	89 fb                	mov    %edi,%ebx
+  8037ae:	49 89 f4             	mov    %rsi,%r12
+  8037b1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037b4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037b8:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  8037bf:	00 00 00 
+  8037c2:	ff d0                	call   *%rax
+  8037c4:	85 c0                	test   %eax,%eax
+  8037c6:	78 47                	js     80380f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037c8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8037cc:	41 8b 3e             	mov    (%r14),%edi
+  8037cf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037d3:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  8037da:	00 00 00 
+  8037dd:	ff d0                	call   *%rax
+  8037df:	85 c0                	test   %eax,%eax
+  8037e1:	78 30                	js     803813 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037e3:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8037e8:	74 2d                	je     803817 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8037ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037ee:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8037f2:	48 85 c0             	test   %rax,%rax
+  8037f5:	74 56                	je     80384d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8037f7:	4c 89 ea             	mov    %r13,%rdx
+  8037fa:	4c 89 e6             	mov    %r12,%rsi
+  8037fd:	4c 89 f7             	mov    %r14,%rdi
+  803800:	ff d0                	call   *%rax
+}
+  803802:	48 83 c4 10          	add    $0x10,%rsp
+  803806:	5b                   	pop    %rbx
+  803807:	41 5c                	pop    %r12
+  803809:	41 5d                	pop    %r13
+  80380b:	41 5e                	pop    %r14
+  80380d:	5d                   	pop    %rbp
+  80380e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80380f:	48 98                	cltq
+  803811:	eb ef                	jmp    803802 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803813:	48 98                	cltq
+  803815:	eb eb                	jmp    803802 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803817:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80381e:	00 00 00 
+  803821:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803827:	89 da                	mov    %ebx,%edx
+  803829:	48 bf f5 67 80 00 00 	movabs $0x8067f5,%rdi
+  803830:	00 00 00 
+  803833:	b8 00 00 00 00       	mov    $0x0,%eax
+  803838:	48 b9 51 1a 80 00 00 	movabs $0x801a51,%rcx
+  80383f:	00 00 00 
+  803842:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803844:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80384b:	eb b5                	jmp    803802 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80384d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803854:	eb ac                	jmp    803802 <write+0x65>
+
+0000000000803856 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803856:	55                   	push   %rbp
+  803857:	48 89 e5             	mov    %rsp,%rbp
+  80385a:	53                   	push   %rbx
+  80385b:	48 83 ec 18          	sub    $0x18,%rsp
+  80385f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803861:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803865:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  80386c:	00 00 00 
+  80386f:	ff d0                	call   *%rax
+  803871:	85 c0                	test   %eax,%eax
+  803873:	78 0c                	js     803881 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803875:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803879:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80387c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803881:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803885:	c9                   	leave
+  803886:	c3                   	ret
+
+0000000000803887 <tell>:
+
+int tell(int fdnum) {
+  803887:	55                   	push   %rbp
+  803888:	48 89 e5             	mov    %rsp,%rbp
+  80388b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80388f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803893:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  80389a:	00 00 00 
+  80389d:	ff d0                	call   *%rax
+  80389f:	85 c0                	test   %eax,%eax
+  8038a1:	78 07                	js     8038aa <tell+0x23>
+
+    return fd->fd_offset;
+  8038a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038a7:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8038aa:	c9                   	leave
+  8038ab:	c3                   	ret
+
+00000000008038ac <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8038ac:	55                   	push   %rbp
+  8038ad:	48 89 e5             	mov    %rsp,%rbp
+  8038b0:	41 55                	push   %r13
+  8038b2:	41 54                	push   %r12
+  8038b4:	53                   	push   %rbx
+  8038b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8038b9:	89 fb                	mov    %edi,%ebx
+  8038bb:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038c2:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  8038c9:	00 00 00 
+  8038cc:	ff d0                	call   *%rax
+  8038ce:	85 c0                	test   %eax,%eax
+  8038d0:	78 38                	js     80390a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038d2:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8038d6:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8038da:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038de:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  8038e5:	00 00 00 
+  8038e8:	ff d0                	call   *%rax
+  8038ea:	85 c0                	test   %eax,%eax
+  8038ec:	78 1c                	js     80390a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038ee:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8038f3:	74 20                	je     803915 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8038f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038f9:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8038fd:	48 85 c0             	test   %rax,%rax
+  803900:	74 47                	je     803949 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803902:	44 89 e6             	mov    %r12d,%esi
+  803905:	4c 89 ef             	mov    %r13,%rdi
+  803908:	ff d0                	call   *%rax
+}
+  80390a:	48 83 c4 18          	add    $0x18,%rsp
+  80390e:	5b                   	pop    %rbx
+  80390f:	41 5c                	pop    %r12
+  803911:	41 5d                	pop    %r13
+  803913:	5d                   	pop    %rbp
+  803914:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803915:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80391c:	00 00 00 
+  80391f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803925:	89 da                	mov    %ebx,%edx
+  803927:	48 bf b8 67 80 00 00 	movabs $0x8067b8,%rdi
+  80392e:	00 00 00 
+  803931:	b8 00 00 00 00       	mov    $0x0,%eax
+  803936:	48 b9 51 1a 80 00 00 	movabs $0x801a51,%rcx
+  80393d:	00 00 00 
+  803940:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803942:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803947:	eb c1                	jmp    80390a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803949:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80394e:	eb ba                	jmp    80390a <ftruncate+0x5e>
+
+0000000000803950 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803950:	55                   	push   %rbp
+  803951:	48 89 e5             	mov    %rsp,%rbp
+  803954:	41 54                	push   %r12
+  803956:	53                   	push   %rbx
+  803957:	48 83 ec 10          	sub    $0x10,%rsp
+  80395b:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80395e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803962:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  803969:	00 00 00 
+  80396c:	ff d0                	call   *%rax
+  80396e:	85 c0                	test   %eax,%eax
+  803970:	78 63                	js     8039d5 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803972:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803976:	41 8b 3c 24          	mov    (%r12),%edi
+  80397a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80397e:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  803985:	00 00 00 
+  803988:	ff d0                	call   *%rax
+  80398a:	85 c0                	test   %eax,%eax
+  80398c:	78 47                	js     8039d5 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80398e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803992:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803997:	74 45                	je     8039de <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803999:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80399c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8039a3:	00 00 00 
+    stat->st_isdir = 0;
+  8039a6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039ad:	00 00 00 
+    stat->st_ino = 0;
+  8039b0:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8039b7:	00 00 00 00 
+    stat->st_version = 0;
+  8039bb:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8039c2:	00 00 00 
+    stat->st_dev = dev;
+  8039c5:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8039cc:	48 89 de             	mov    %rbx,%rsi
+  8039cf:	4c 89 e7             	mov    %r12,%rdi
+  8039d2:	ff 50 28             	call   *0x28(%rax)
+}
+  8039d5:	48 83 c4 10          	add    $0x10,%rsp
+  8039d9:	5b                   	pop    %rbx
+  8039da:	41 5c                	pop    %r12
+  8039dc:	5d                   	pop    %rbp
+  8039dd:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039de:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039e3:	eb f0                	jmp    8039d5 <fstat+0x85>
+
+00000000008039e5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8039e5:	55                   	push   %rbp
+  8039e6:	48 89 e5             	mov    %rsp,%rbp
+  8039e9:	41 54                	push   %r12
+  8039eb:	53                   	push   %rbx
+  8039ec:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8039ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8039f4:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  8039fb:	00 00 00 
+  8039fe:	ff d0                	call   *%rax
+  803a00:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	78 25                	js     803a2b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803a06:	4c 89 e6             	mov    %r12,%rsi
+  803a09:	89 c7                	mov    %eax,%edi
+  803a0b:	48 b8 50 39 80 00 00 	movabs $0x803950,%rax
+  803a12:	00 00 00 
+  803a15:	ff d0                	call   *%rax
+  803a17:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803a1a:	89 df                	mov    %ebx,%edi
+  803a1c:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+
+    return res;
+  803a28:	44 89 e3             	mov    %r12d,%ebx
+}
+  803a2b:	89 d8                	mov    %ebx,%eax
+  803a2d:	5b                   	pop    %rbx
+  803a2e:	41 5c                	pop    %r12
+  803a30:	5d                   	pop    %rbp
+  803a31:	c3                   	ret
+
+0000000000803a32 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a32:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803a39:	00 00 00 
+  803a3c:	83 38 00             	cmpl   $0x0,(%rax)
+  803a3f:	74 0a                	je     803a4b <fsipc_env+0x19>
+    return fsenv;
+}
+  803a41:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a48:	00 00 
+  803a4a:	c3                   	ret
+fsipc_env(void) {
+  803a4b:	55                   	push   %rbp
+  803a4c:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a4f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a54:	48 b8 35 5b 80 00 00 	movabs $0x805b35,%rax
+  803a5b:	00 00 00 
+  803a5e:	ff d0                	call   *%rax
+  803a60:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803a67:	00 00 
+}
+  803a69:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a70:	00 00 
+  803a72:	5d                   	pop    %rbp
+  803a73:	c3                   	ret
+
+0000000000803a74 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803a74:	55                   	push   %rbp
+  803a75:	48 89 e5             	mov    %rsp,%rbp
+  803a78:	53                   	push   %rbx
+  803a79:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803a7d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a84:	00 
+  803a85:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803a8c:	00 
+  803a8d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803a94:	00 
+  803a95:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803a9c:	00 
+  803a9d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803aa4:	00 
+
+    assert(size <= sizeof(words));
+  803aa5:	48 83 fa 28          	cmp    $0x28,%rdx
+  803aa9:	77 38                	ja     803ae3 <fsipc_short+0x6f>
+  803aab:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803aad:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803ab1:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803abd:	48 b8 32 3a 80 00 00 	movabs $0x803a32,%rax
+  803ac4:	00 00 00 
+  803ac7:	ff d0                	call   *%rax
+  803ac9:	89 c7                	mov    %eax,%edi
+  803acb:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803acf:	89 de                	mov    %ebx,%esi
+  803ad1:	48 b8 98 5a 80 00 00 	movabs $0x805a98,%rax
+  803ad8:	00 00 00 
+  803adb:	ff d0                	call   *%rax
+}
+  803add:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ae1:	c9                   	leave
+  803ae2:	c3                   	ret
+    assert(size <= sizeof(words));
+  803ae3:	48 b9 40 68 80 00 00 	movabs $0x806840,%rcx
+  803aea:	00 00 00 
+  803aed:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803af4:	00 00 00 
+  803af7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803afc:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803b03:	00 00 00 
+  803b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0b:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803b12:	00 00 00 
+  803b15:	41 ff d0             	call   *%r8
+
+0000000000803b18 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803b18:	55                   	push   %rbp
+  803b19:	48 89 e5             	mov    %rsp,%rbp
+  803b1c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803b20:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b23:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803b26:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b29:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b2e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b32:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b37:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  803b3e:	00 00 00 
+  803b41:	ff d0                	call   *%rax
+}
+  803b43:	c9                   	leave
+  803b44:	c3                   	ret
+
+0000000000803b45 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803b45:	55                   	push   %rbp
+  803b46:	48 89 e5             	mov    %rsp,%rbp
+  803b49:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803b4d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803b53:	ba 04 00 00 00       	mov    $0x4,%edx
+  803b58:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803b5c:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b61:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  803b68:	00 00 00 
+  803b6b:	ff d0                	call   *%rax
+}
+  803b6d:	c9                   	leave
+  803b6e:	c3                   	ret
+
+0000000000803b6f <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803b6f:	55                   	push   %rbp
+  803b70:	48 89 e5             	mov    %rsp,%rbp
+  803b73:	41 54                	push   %r12
+  803b75:	53                   	push   %rbx
+  803b76:	48 83 ec 10          	sub    $0x10,%rsp
+  803b7a:	89 fb                	mov    %edi,%ebx
+  803b7c:	49 89 f4             	mov    %rsi,%r12
+  803b7f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b83:	48 b8 32 3a 80 00 00 	movabs $0x803a32,%rax
+  803b8a:	00 00 00 
+  803b8d:	ff d0                	call   *%rax
+  803b8f:	89 c7                	mov    %eax,%edi
+  803b91:	6a 00                	push   $0x0
+  803b93:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803b97:	50                   	push   %rax
+  803b98:	4d 89 e1             	mov    %r12,%r9
+  803b9b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803ba1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ba6:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803bad:	00 00 00 
+  803bb0:	89 de                	mov    %ebx,%esi
+  803bb2:	48 b8 33 5a 80 00 00 	movabs $0x805a33,%rax
+  803bb9:	00 00 00 
+  803bbc:	ff d0                	call   *%rax
+}
+  803bbe:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803bc2:	5b                   	pop    %rbx
+  803bc3:	41 5c                	pop    %r12
+  803bc5:	5d                   	pop    %rbp
+  803bc6:	c3                   	ret
+
+0000000000803bc7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803bc7:	55                   	push   %rbp
+  803bc8:	48 89 e5             	mov    %rsp,%rbp
+  803bcb:	41 54                	push   %r12
+  803bcd:	53                   	push   %rbx
+  803bce:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803bd1:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bd4:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803bdb:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bdd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803be2:	be 00 00 00 00       	mov    $0x0,%esi
+  803be7:	bf 05 00 00 00       	mov    $0x5,%edi
+  803bec:	48 b8 6f 3b 80 00 00 	movabs $0x803b6f,%rax
+  803bf3:	00 00 00 
+  803bf6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bf8:	85 c0                	test   %eax,%eax
+  803bfa:	78 5a                	js     803c56 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803bfc:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803c03:	00 00 00 
+  803c06:	4c 89 e6             	mov    %r12,%rsi
+  803c09:	48 89 df             	mov    %rbx,%rdi
+  803c0c:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  803c13:	00 00 00 
+  803c16:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803c18:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803c1f:	00 
+  803c20:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c26:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803c2d:	00 
+  803c2e:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803c34:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803c3b:	00 
+  803c3c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803c43:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803c4a:	00 
+  803c4b:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803c51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c56:	5b                   	pop    %rbx
+  803c57:	41 5c                	pop    %r12
+  803c59:	5d                   	pop    %rbp
+  803c5a:	c3                   	ret
+
+0000000000803c5b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c5b:	55                   	push   %rbp
+  803c5c:	48 89 e5             	mov    %rsp,%rbp
+  803c5f:	41 57                	push   %r15
+  803c61:	41 56                	push   %r14
+  803c63:	41 55                	push   %r13
+  803c65:	41 54                	push   %r12
+  803c67:	53                   	push   %rbx
+  803c68:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803c6c:	48 85 ff             	test   %rdi,%rdi
+  803c6f:	0f 84 a1 00 00 00    	je     803d16 <devfile_read+0xbb>
+  803c75:	49 89 ff             	mov    %rdi,%r15
+  803c78:	49 89 f5             	mov    %rsi,%r13
+  803c7b:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803c7e:	48 85 f6             	test   %rsi,%rsi
+  803c81:	0f 84 c4 00 00 00    	je     803d4b <devfile_read+0xf0>
+    size_t total_read = 0;
+  803c87:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803c8e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803c8f:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c96:	00 00 00 
+  803c99:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c9d:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803ca0:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803ca4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ca9:	be 00 00 00 00       	mov    $0x0,%esi
+  803cae:	bf 03 00 00 00       	mov    $0x3,%edi
+  803cb3:	48 b8 6f 3b 80 00 00 	movabs $0x803b6f,%rax
+  803cba:	00 00 00 
+  803cbd:	ff d0                	call   *%rax
+        if (res < 0) {
+  803cbf:	85 c0                	test   %eax,%eax
+  803cc1:	0f 88 b9 00 00 00    	js     803d80 <devfile_read+0x125>
+        assert(res <= n);
+  803cc7:	48 63 d8             	movslq %eax,%rbx
+  803cca:	49 39 dc             	cmp    %rbx,%r12
+  803ccd:	0f 82 b1 00 00 00    	jb     803d84 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803cd3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803cd8:	0f 87 db 00 00 00    	ja     803db9 <devfile_read+0x15e>
+        if (!res) {
+  803cde:	85 c0                	test   %eax,%eax
+  803ce0:	74 21                	je     803d03 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803ce2:	48 89 da             	mov    %rbx,%rdx
+  803ce5:	4c 89 f6             	mov    %r14,%rsi
+  803ce8:	4c 89 ef             	mov    %r13,%rdi
+  803ceb:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  803cf2:	00 00 00 
+  803cf5:	ff d0                	call   *%rax
+        total_read += res;
+  803cf7:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803cfb:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803cfe:	49 29 dc             	sub    %rbx,%r12
+  803d01:	75 96                	jne    803c99 <devfile_read+0x3e>
+    return total_read;
+  803d03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803d07:	48 83 c4 18          	add    $0x18,%rsp
+  803d0b:	5b                   	pop    %rbx
+  803d0c:	41 5c                	pop    %r12
+  803d0e:	41 5d                	pop    %r13
+  803d10:	41 5e                	pop    %r14
+  803d12:	41 5f                	pop    %r15
+  803d14:	5d                   	pop    %rbp
+  803d15:	c3                   	ret
+    assert(fd);
+  803d16:	48 b9 76 68 80 00 00 	movabs $0x806876,%rcx
+  803d1d:	00 00 00 
+  803d20:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803d27:	00 00 00 
+  803d2a:	be 91 00 00 00       	mov    $0x91,%esi
+  803d2f:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803d36:	00 00 00 
+  803d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3e:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803d45:	00 00 00 
+  803d48:	41 ff d0             	call   *%r8
+    assert(buf);
+  803d4b:	48 b9 79 68 80 00 00 	movabs $0x806879,%rcx
+  803d52:	00 00 00 
+  803d55:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803d5c:	00 00 00 
+  803d5f:	be 92 00 00 00       	mov    $0x92,%esi
+  803d64:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803d6b:	00 00 00 
+  803d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d73:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803d7a:	00 00 00 
+  803d7d:	41 ff d0             	call   *%r8
+            return res;
+  803d80:	48 98                	cltq
+  803d82:	eb 83                	jmp    803d07 <devfile_read+0xac>
+        assert(res <= n);
+  803d84:	48 b9 7d 68 80 00 00 	movabs $0x80687d,%rcx
+  803d8b:	00 00 00 
+  803d8e:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803d95:	00 00 00 
+  803d98:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803d9d:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803da4:	00 00 00 
+  803da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dac:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803db3:	00 00 00 
+  803db6:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803db9:	48 b9 88 68 80 00 00 	movabs $0x806888,%rcx
+  803dc0:	00 00 00 
+  803dc3:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803dca:	00 00 00 
+  803dcd:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803dd2:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803dd9:	00 00 00 
+  803ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de1:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803de8:	00 00 00 
+  803deb:	41 ff d0             	call   *%r8
+
+0000000000803dee <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803dee:	55                   	push   %rbp
+  803def:	48 89 e5             	mov    %rsp,%rbp
+  803df2:	41 57                	push   %r15
+  803df4:	41 56                	push   %r14
+  803df6:	41 55                	push   %r13
+  803df8:	41 54                	push   %r12
+  803dfa:	53                   	push   %rbx
+  803dfb:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803dff:	48 85 ff             	test   %rdi,%rdi
+  803e02:	0f 84 83 00 00 00    	je     803e8b <devfile_write+0x9d>
+  803e08:	49 89 ff             	mov    %rdi,%r15
+  803e0b:	49 89 f4             	mov    %rsi,%r12
+  803e0e:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803e11:	48 85 f6             	test   %rsi,%rsi
+  803e14:	0f 84 a6 00 00 00    	je     803ec0 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803e1a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803e20:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803e27:	00 00 00 
+  803e2a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e2e:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803e31:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803e35:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803e3a:	48 39 d3             	cmp    %rdx,%rbx
+  803e3d:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803e41:	4c 89 e6             	mov    %r12,%rsi
+  803e44:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803e4b:	00 00 00 
+  803e4e:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  803e55:	00 00 00 
+  803e58:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e5a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e5f:	be 00 00 00 00       	mov    $0x0,%esi
+  803e64:	bf 04 00 00 00       	mov    $0x4,%edi
+  803e69:	48 b8 6f 3b 80 00 00 	movabs $0x803b6f,%rax
+  803e70:	00 00 00 
+  803e73:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e75:	85 c0                	test   %eax,%eax
+  803e77:	78 7c                	js     803ef5 <devfile_write+0x107>
+        total_written += res;
+  803e79:	48 98                	cltq
+  803e7b:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803e7e:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e81:	48 29 c3             	sub    %rax,%rbx
+  803e84:	75 a4                	jne    803e2a <devfile_write+0x3c>
+    return total_written;
+  803e86:	4c 89 e8             	mov    %r13,%rax
+  803e89:	eb 6c                	jmp    803ef7 <devfile_write+0x109>
+    assert(fd);
+  803e8b:	48 b9 76 68 80 00 00 	movabs $0x806876,%rcx
+  803e92:	00 00 00 
+  803e95:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803e9c:	00 00 00 
+  803e9f:	be bd 00 00 00       	mov    $0xbd,%esi
+  803ea4:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803eab:	00 00 00 
+  803eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb3:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803eba:	00 00 00 
+  803ebd:	41 ff d0             	call   *%r8
+    assert(buf);
+  803ec0:	48 b9 79 68 80 00 00 	movabs $0x806879,%rcx
+  803ec7:	00 00 00 
+  803eca:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  803ed1:	00 00 00 
+  803ed4:	be be 00 00 00       	mov    $0xbe,%esi
+  803ed9:	48 bf 6b 68 80 00 00 	movabs $0x80686b,%rdi
+  803ee0:	00 00 00 
+  803ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee8:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  803eef:	00 00 00 
+  803ef2:	41 ff d0             	call   *%r8
+            return res;
+  803ef5:	48 98                	cltq
+}
+  803ef7:	48 83 c4 08          	add    $0x8,%rsp
+  803efb:	5b                   	pop    %rbx
+  803efc:	41 5c                	pop    %r12
+  803efe:	41 5d                	pop    %r13
+  803f00:	41 5e                	pop    %r14
+  803f02:	41 5f                	pop    %r15
+  803f04:	5d                   	pop    %rbp
+  803f05:	c3                   	ret
+
+0000000000803f06 <open>:
+open(const char *path, int mode) {
+  803f06:	55                   	push   %rbp
+  803f07:	48 89 e5             	mov    %rsp,%rbp
+  803f0a:	41 55                	push   %r13
+  803f0c:	41 54                	push   %r12
+  803f0e:	53                   	push   %rbx
+  803f0f:	48 83 ec 18          	sub    $0x18,%rsp
+  803f13:	49 89 fc             	mov    %rdi,%r12
+  803f16:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f19:	48 b8 4a 23 80 00 00 	movabs $0x80234a,%rax
+  803f20:	00 00 00 
+  803f23:	ff d0                	call   *%rax
+  803f25:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f2b:	0f 87 8f 00 00 00    	ja     803fc0 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f31:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f35:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  803f3c:	00 00 00 
+  803f3f:	ff d0                	call   *%rax
+  803f41:	89 c3                	mov    %eax,%ebx
+  803f43:	85 c0                	test   %eax,%eax
+  803f45:	78 55                	js     803f9c <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f47:	4c 89 e6             	mov    %r12,%rsi
+  803f4a:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803f51:	00 00 00 
+  803f54:	48 89 df             	mov    %rbx,%rdi
+  803f57:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  803f5e:	00 00 00 
+  803f61:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f63:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f6f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f73:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f78:	48 b8 6f 3b 80 00 00 	movabs $0x803b6f,%rax
+  803f7f:	00 00 00 
+  803f82:	ff d0                	call   *%rax
+  803f84:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f86:	85 c0                	test   %eax,%eax
+  803f88:	78 1f                	js     803fa9 <open+0xa3>
+    return fd2num(fd);
+  803f8a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f8e:	48 b8 fd 32 80 00 00 	movabs $0x8032fd,%rax
+  803f95:	00 00 00 
+  803f98:	ff d0                	call   *%rax
+  803f9a:	89 c3                	mov    %eax,%ebx
+}
+  803f9c:	89 d8                	mov    %ebx,%eax
+  803f9e:	48 83 c4 18          	add    $0x18,%rsp
+  803fa2:	5b                   	pop    %rbx
+  803fa3:	41 5c                	pop    %r12
+  803fa5:	41 5d                	pop    %r13
+  803fa7:	5d                   	pop    %rbp
+  803fa8:	c3                   	ret
+        fd_close(fd, 0);
+  803fa9:	be 00 00 00 00       	mov    $0x0,%esi
+  803fae:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fb2:	48 b8 46 34 80 00 00 	movabs $0x803446,%rax
+  803fb9:	00 00 00 
+  803fbc:	ff d0                	call   *%rax
+        return res;
+  803fbe:	eb dc                	jmp    803f9c <open+0x96>
+        return -E_BAD_PATH;
+  803fc0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803fc5:	eb d5                	jmp    803f9c <open+0x96>
+
+0000000000803fc7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803fc7:	55                   	push   %rbp
+  803fc8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fd0:	be 00 00 00 00       	mov    $0x0,%esi
+  803fd5:	bf 08 00 00 00       	mov    $0x8,%edi
+  803fda:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  803fe1:	00 00 00 
+  803fe4:	ff d0                	call   *%rax
+}
+  803fe6:	5d                   	pop    %rbp
+  803fe7:	c3                   	ret
+
+0000000000803fe8 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803fe8:	55                   	push   %rbp
+  803fe9:	48 89 e5             	mov    %rsp,%rbp
+  803fec:	41 56                	push   %r14
+  803fee:	41 55                	push   %r13
+  803ff0:	41 54                	push   %r12
+  803ff2:	53                   	push   %rbx
+  803ff3:	48 83 ec 10          	sub    $0x10,%rsp
+  803ff7:	41 89 f6             	mov    %esi,%r14d
+  803ffa:	49 89 d4             	mov    %rdx,%r12
+  803ffd:	48 89 cb             	mov    %rcx,%rbx
+  804000:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804003:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804007:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  80400e:	00 00 00 
+  804011:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804013:	85 c0                	test   %eax,%eax
+  804015:	78 46                	js     80405d <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804017:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80401b:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  804022:	00 00 00 
+  804025:	8b 00                	mov    (%rax),%eax
+  804027:	39 02                	cmp    %eax,(%rdx)
+  804029:	75 3f                	jne    80406a <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80402b:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  804032:	00 00 00 
+  804035:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804038:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  80403a:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80403e:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804042:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804046:	48 89 da             	mov    %rbx,%rdx
+  804049:	4c 89 e6             	mov    %r12,%rsi
+  80404c:	bf 09 00 00 00       	mov    $0x9,%edi
+  804051:	48 b8 6f 3b 80 00 00 	movabs $0x803b6f,%rax
+  804058:	00 00 00 
+  80405b:	ff d0                	call   *%rax
+}
+  80405d:	48 83 c4 10          	add    $0x10,%rsp
+  804061:	5b                   	pop    %rbx
+  804062:	41 5c                	pop    %r12
+  804064:	41 5d                	pop    %r13
+  804066:	41 5e                	pop    %r14
+  804068:	5d                   	pop    %rbp
+  804069:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80406a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80406f:	eb ec                	jmp    80405d <file_map+0x75>
+
+0000000000804071 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804071:	55                   	push   %rbp
+  804072:	48 89 e5             	mov    %rsp,%rbp
+  804075:	41 54                	push   %r12
+  804077:	53                   	push   %rbx
+  804078:	48 83 ec 20          	sub    $0x20,%rsp
+  80407c:	41 89 f4             	mov    %esi,%r12d
+  80407f:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804082:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804086:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  80408d:	00 00 00 
+  804090:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804092:	85 c0                	test   %eax,%eax
+  804094:	78 3c                	js     8040d2 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804096:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80409a:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8040a1:	00 00 00 
+  8040a4:	8b 0a                	mov    (%rdx),%ecx
+  8040a6:	39 08                	cmp    %ecx,(%rax)
+  8040a8:	75 31                	jne    8040db <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  8040aa:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040ad:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8040b0:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8040b4:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8040b8:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040bd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8040c6:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  8040cd:	00 00 00 
+  8040d0:	ff d0                	call   *%rax
+}
+  8040d2:	48 83 c4 20          	add    $0x20,%rsp
+  8040d6:	5b                   	pop    %rbx
+  8040d7:	41 5c                	pop    %r12
+  8040d9:	5d                   	pop    %rbp
+  8040da:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040db:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8040e0:	eb f0                	jmp    8040d2 <file_msync+0x61>
+
+00000000008040e2 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8040e2:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8040e6:	7f 01                	jg     8040e9 <writebuf+0x7>
+  8040e8:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8040e9:	55                   	push   %rbp
+  8040ea:	48 89 e5             	mov    %rsp,%rbp
+  8040ed:	53                   	push   %rbx
+  8040ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8040f2:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8040f5:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8040f9:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8040fd:	8b 3f                	mov    (%rdi),%edi
+  8040ff:	48 b8 9d 37 80 00 00 	movabs $0x80379d,%rax
+  804106:	00 00 00 
+  804109:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80410b:	48 85 c0             	test   %rax,%rax
+  80410e:	7e 04                	jle    804114 <writebuf+0x32>
+  804110:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804114:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804118:	48 39 c2             	cmp    %rax,%rdx
+  80411b:	74 0f                	je     80412c <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80411d:	48 85 c0             	test   %rax,%rax
+  804120:	ba 00 00 00 00       	mov    $0x0,%edx
+  804125:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804129:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80412c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804130:	c9                   	leave
+  804131:	c3                   	ret
+
+0000000000804132 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804132:	8b 46 04             	mov    0x4(%rsi),%eax
+  804135:	8d 50 01             	lea    0x1(%rax),%edx
+  804138:	89 56 04             	mov    %edx,0x4(%rsi)
+  80413b:	48 98                	cltq
+  80413d:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804142:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804148:	74 01                	je     80414b <putch+0x19>
+  80414a:	c3                   	ret
+putch(int ch, void *arg) {
+  80414b:	55                   	push   %rbp
+  80414c:	48 89 e5             	mov    %rsp,%rbp
+  80414f:	53                   	push   %rbx
+  804150:	48 83 ec 08          	sub    $0x8,%rsp
+  804154:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804157:	48 89 f7             	mov    %rsi,%rdi
+  80415a:	48 b8 e2 40 80 00 00 	movabs $0x8040e2,%rax
+  804161:	00 00 00 
+  804164:	ff d0                	call   *%rax
+        state->offset = 0;
+  804166:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80416d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804171:	c9                   	leave
+  804172:	c3                   	ret
+
+0000000000804173 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804173:	55                   	push   %rbp
+  804174:	48 89 e5             	mov    %rsp,%rbp
+  804177:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80417e:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804181:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804187:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80418e:	00 00 00 
+    state.result = 0;
+  804191:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804198:	00 00 00 00 
+    state.error = 1;
+  80419c:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8041a3:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8041a6:	48 89 f2             	mov    %rsi,%rdx
+  8041a9:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8041b0:	48 bf 32 41 80 00 00 	movabs $0x804132,%rdi
+  8041b7:	00 00 00 
+  8041ba:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  8041c1:	00 00 00 
+  8041c4:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8041c6:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8041cd:	7f 14                	jg     8041e3 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8041cf:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8041d6:	48 85 c0             	test   %rax,%rax
+  8041d9:	75 06                	jne    8041e1 <vfprintf+0x6e>
+  8041db:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8041e1:	c9                   	leave
+  8041e2:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8041e3:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8041ea:	48 b8 e2 40 80 00 00 	movabs $0x8040e2,%rax
+  8041f1:	00 00 00 
+  8041f4:	ff d0                	call   *%rax
+  8041f6:	eb d7                	jmp    8041cf <vfprintf+0x5c>
+
+00000000008041f8 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8041f8:	55                   	push   %rbp
+  8041f9:	48 89 e5             	mov    %rsp,%rbp
+  8041fc:	48 83 ec 50          	sub    $0x50,%rsp
+  804200:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804204:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804208:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80420c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804210:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804217:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80421b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80421f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804223:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804227:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80422b:	48 b8 73 41 80 00 00 	movabs $0x804173,%rax
+  804232:	00 00 00 
+  804235:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804237:	c9                   	leave
+  804238:	c3                   	ret
+
+0000000000804239 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804239:	55                   	push   %rbp
+  80423a:	48 89 e5             	mov    %rsp,%rbp
+  80423d:	48 83 ec 50          	sub    $0x50,%rsp
+  804241:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804245:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804249:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80424d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804251:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804255:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80425c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804260:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804264:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804268:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80426c:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804270:	48 89 fe             	mov    %rdi,%rsi
+  804273:	bf 01 00 00 00       	mov    $0x1,%edi
+  804278:	48 b8 73 41 80 00 00 	movabs $0x804173,%rax
+  80427f:	00 00 00 
+  804282:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804284:	c9                   	leave
+  804285:	c3                   	ret
+
+0000000000804286 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804286:	55                   	push   %rbp
+  804287:	48 89 e5             	mov    %rsp,%rbp
+  80428a:	41 54                	push   %r12
+  80428c:	53                   	push   %rbx
+  80428d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804290:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  804297:	00 00 00 
+  80429a:	ff d0                	call   *%rax
+  80429c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80429f:	48 be b0 68 80 00 00 	movabs $0x8068b0,%rsi
+  8042a6:	00 00 00 
+  8042a9:	48 89 df             	mov    %rbx,%rdi
+  8042ac:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  8042b3:	00 00 00 
+  8042b6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8042b8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8042bd:	41 2b 04 24          	sub    (%r12),%eax
+  8042c1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8042c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8042ce:	00 00 00 
+    stat->st_dev = &devpipe;
+  8042d1:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8042d8:	00 00 00 
+  8042db:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8042e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e7:	5b                   	pop    %rbx
+  8042e8:	41 5c                	pop    %r12
+  8042ea:	5d                   	pop    %rbp
+  8042eb:	c3                   	ret
+
+00000000008042ec <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8042ec:	55                   	push   %rbp
+  8042ed:	48 89 e5             	mov    %rsp,%rbp
+  8042f0:	41 54                	push   %r12
+  8042f2:	53                   	push   %rbx
+  8042f3:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8042f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042fb:	48 89 fe             	mov    %rdi,%rsi
+  8042fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  804303:	49 bc c5 2b 80 00 00 	movabs $0x802bc5,%r12
+  80430a:	00 00 00 
+  80430d:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804310:	48 89 df             	mov    %rbx,%rdi
+  804313:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  80431a:	00 00 00 
+  80431d:	ff d0                	call   *%rax
+  80431f:	48 89 c6             	mov    %rax,%rsi
+  804322:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804327:	bf 00 00 00 00       	mov    $0x0,%edi
+  80432c:	41 ff d4             	call   *%r12
+}
+  80432f:	5b                   	pop    %rbx
+  804330:	41 5c                	pop    %r12
+  804332:	5d                   	pop    %rbp
+  804333:	c3                   	ret
+
+0000000000804334 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804334:	55                   	push   %rbp
+  804335:	48 89 e5             	mov    %rsp,%rbp
+  804338:	41 57                	push   %r15
+  80433a:	41 56                	push   %r14
+  80433c:	41 55                	push   %r13
+  80433e:	41 54                	push   %r12
+  804340:	53                   	push   %rbx
+  804341:	48 83 ec 18          	sub    $0x18,%rsp
+  804345:	49 89 fc             	mov    %rdi,%r12
+  804348:	49 89 f5             	mov    %rsi,%r13
+  80434b:	49 89 d7             	mov    %rdx,%r15
+  80434e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804352:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  804359:	00 00 00 
+  80435c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80435e:	4d 85 ff             	test   %r15,%r15
+  804361:	0f 84 af 00 00 00    	je     804416 <devpipe_write+0xe2>
+  804367:	48 89 c3             	mov    %rax,%rbx
+  80436a:	4c 89 f8             	mov    %r15,%rax
+  80436d:	4d 89 ef             	mov    %r13,%r15
+  804370:	4c 01 e8             	add    %r13,%rax
+  804373:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804377:	49 bd bb 2a 80 00 00 	movabs $0x802abb,%r13
+  80437e:	00 00 00 
+            sys_yield();
+  804381:	49 be 4c 2a 80 00 00 	movabs $0x802a4c,%r14
+  804388:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80438b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80438e:	48 63 ce             	movslq %esi,%rcx
+  804391:	48 63 03             	movslq (%rbx),%rax
+  804394:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80439a:	48 39 c1             	cmp    %rax,%rcx
+  80439d:	72 2e                	jb     8043cd <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80439f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043a4:	48 89 da             	mov    %rbx,%rdx
+  8043a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043ac:	4c 89 e7             	mov    %r12,%rdi
+  8043af:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8043b2:	85 c0                	test   %eax,%eax
+  8043b4:	74 66                	je     80441c <devpipe_write+0xe8>
+            sys_yield();
+  8043b6:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043b9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043bc:	48 63 ce             	movslq %esi,%rcx
+  8043bf:	48 63 03             	movslq (%rbx),%rax
+  8043c2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043c8:	48 39 c1             	cmp    %rax,%rcx
+  8043cb:	73 d2                	jae    80439f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8043cd:	41 0f b6 3f          	movzbl (%r15),%edi
+  8043d1:	48 89 ca             	mov    %rcx,%rdx
+  8043d4:	48 c1 ea 03          	shr    $0x3,%rdx
+  8043d8:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8043df:	08 10 20 
+  8043e2:	48 f7 e2             	mul    %rdx
+  8043e5:	48 c1 ea 06          	shr    $0x6,%rdx
+  8043e9:	48 89 d0             	mov    %rdx,%rax
+  8043ec:	48 c1 e0 09          	shl    $0x9,%rax
+  8043f0:	48 29 d0             	sub    %rdx,%rax
+  8043f3:	48 c1 e0 03          	shl    $0x3,%rax
+  8043f7:	48 29 c1             	sub    %rax,%rcx
+  8043fa:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8043ff:	83 c6 01             	add    $0x1,%esi
+  804402:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804405:	49 83 c7 01          	add    $0x1,%r15
+  804409:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80440d:	49 39 c7             	cmp    %rax,%r15
+  804410:	0f 85 75 ff ff ff    	jne    80438b <devpipe_write+0x57>
+    return n;
+  804416:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80441a:	eb 05                	jmp    804421 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80441c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804421:	48 83 c4 18          	add    $0x18,%rsp
+  804425:	5b                   	pop    %rbx
+  804426:	41 5c                	pop    %r12
+  804428:	41 5d                	pop    %r13
+  80442a:	41 5e                	pop    %r14
+  80442c:	41 5f                	pop    %r15
+  80442e:	5d                   	pop    %rbp
+  80442f:	c3                   	ret
+
+0000000000804430 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804430:	55                   	push   %rbp
+  804431:	48 89 e5             	mov    %rsp,%rbp
+  804434:	41 57                	push   %r15
+  804436:	41 56                	push   %r14
+  804438:	41 55                	push   %r13
+  80443a:	41 54                	push   %r12
+  80443c:	53                   	push   %rbx
+  80443d:	48 83 ec 18          	sub    $0x18,%rsp
+  804441:	49 89 fc             	mov    %rdi,%r12
+  804444:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804448:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80444c:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  804453:	00 00 00 
+  804456:	ff d0                	call   *%rax
+  804458:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80445b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804461:	49 bd bb 2a 80 00 00 	movabs $0x802abb,%r13
+  804468:	00 00 00 
+            sys_yield();
+  80446b:	49 be 4c 2a 80 00 00 	movabs $0x802a4c,%r14
+  804472:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804475:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80447a:	74 7d                	je     8044f9 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80447c:	8b 03                	mov    (%rbx),%eax
+  80447e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804481:	75 26                	jne    8044a9 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804483:	4d 85 ff             	test   %r15,%r15
+  804486:	75 77                	jne    8044ff <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804488:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80448d:	48 89 da             	mov    %rbx,%rdx
+  804490:	be 00 10 00 00       	mov    $0x1000,%esi
+  804495:	4c 89 e7             	mov    %r12,%rdi
+  804498:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80449b:	85 c0                	test   %eax,%eax
+  80449d:	74 72                	je     804511 <devpipe_read+0xe1>
+            sys_yield();
+  80449f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8044a2:	8b 03                	mov    (%rbx),%eax
+  8044a4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8044a7:	74 df                	je     804488 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8044a9:	48 63 c8             	movslq %eax,%rcx
+  8044ac:	48 89 ca             	mov    %rcx,%rdx
+  8044af:	48 c1 ea 03          	shr    $0x3,%rdx
+  8044b3:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8044ba:	08 10 20 
+  8044bd:	48 89 d0             	mov    %rdx,%rax
+  8044c0:	48 f7 e6             	mul    %rsi
+  8044c3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8044c7:	48 89 d0             	mov    %rdx,%rax
+  8044ca:	48 c1 e0 09          	shl    $0x9,%rax
+  8044ce:	48 29 d0             	sub    %rdx,%rax
+  8044d1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8044d8:	00 
+  8044d9:	48 89 c8             	mov    %rcx,%rax
+  8044dc:	48 29 d0             	sub    %rdx,%rax
+  8044df:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8044e4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8044e8:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8044ec:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8044ef:	49 83 c7 01          	add    $0x1,%r15
+  8044f3:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8044f7:	75 83                	jne    80447c <devpipe_read+0x4c>
+    return n;
+  8044f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044fd:	eb 03                	jmp    804502 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8044ff:	4c 89 f8             	mov    %r15,%rax
+}
+  804502:	48 83 c4 18          	add    $0x18,%rsp
+  804506:	5b                   	pop    %rbx
+  804507:	41 5c                	pop    %r12
+  804509:	41 5d                	pop    %r13
+  80450b:	41 5e                	pop    %r14
+  80450d:	41 5f                	pop    %r15
+  80450f:	5d                   	pop    %rbp
+  804510:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804511:	b8 00 00 00 00       	mov    $0x0,%eax
+  804516:	eb ea                	jmp    804502 <devpipe_read+0xd2>
+
+0000000000804518 <pipe>:
+pipe(int pfd[2]) {
+  804518:	55                   	push   %rbp
+  804519:	48 89 e5             	mov    %rsp,%rbp
+  80451c:	41 55                	push   %r13
+  80451e:	41 54                	push   %r12
+  804520:	53                   	push   %rbx
+  804521:	48 83 ec 18          	sub    $0x18,%rsp
+  804525:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804528:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80452c:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  804533:	00 00 00 
+  804536:	ff d0                	call   *%rax
+  804538:	89 c3                	mov    %eax,%ebx
+  80453a:	85 c0                	test   %eax,%eax
+  80453c:	0f 88 a0 01 00 00    	js     8046e2 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804542:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804547:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80454c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804550:	bf 00 00 00 00       	mov    $0x0,%edi
+  804555:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  80455c:	00 00 00 
+  80455f:	ff d0                	call   *%rax
+  804561:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804563:	85 c0                	test   %eax,%eax
+  804565:	0f 88 77 01 00 00    	js     8046e2 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80456b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80456f:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  804576:	00 00 00 
+  804579:	ff d0                	call   *%rax
+  80457b:	89 c3                	mov    %eax,%ebx
+  80457d:	85 c0                	test   %eax,%eax
+  80457f:	0f 88 43 01 00 00    	js     8046c8 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804585:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80458a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80458f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804593:	bf 00 00 00 00       	mov    $0x0,%edi
+  804598:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  80459f:	00 00 00 
+  8045a2:	ff d0                	call   *%rax
+  8045a4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8045a6:	85 c0                	test   %eax,%eax
+  8045a8:	0f 88 1a 01 00 00    	js     8046c8 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8045ae:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8045b2:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  8045b9:	00 00 00 
+  8045bc:	ff d0                	call   *%rax
+  8045be:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8045c1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045cb:	48 89 c6             	mov    %rax,%rsi
+  8045ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045d3:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  8045da:	00 00 00 
+  8045dd:	ff d0                	call   *%rax
+  8045df:	89 c3                	mov    %eax,%ebx
+  8045e1:	85 c0                	test   %eax,%eax
+  8045e3:	0f 88 c5 00 00 00    	js     8046ae <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8045e9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8045ed:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  8045f4:	00 00 00 
+  8045f7:	ff d0                	call   *%rax
+  8045f9:	48 89 c1             	mov    %rax,%rcx
+  8045fc:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804602:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804608:	ba 00 00 00 00       	mov    $0x0,%edx
+  80460d:	4c 89 ee             	mov    %r13,%rsi
+  804610:	bf 00 00 00 00       	mov    $0x0,%edi
+  804615:	48 b8 5a 2b 80 00 00 	movabs $0x802b5a,%rax
+  80461c:	00 00 00 
+  80461f:	ff d0                	call   *%rax
+  804621:	89 c3                	mov    %eax,%ebx
+  804623:	85 c0                	test   %eax,%eax
+  804625:	78 6e                	js     804695 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804627:	be 00 10 00 00       	mov    $0x1000,%esi
+  80462c:	4c 89 ef             	mov    %r13,%rdi
+  80462f:	48 b8 83 2a 80 00 00 	movabs $0x802a83,%rax
+  804636:	00 00 00 
+  804639:	ff d0                	call   *%rax
+  80463b:	83 f8 02             	cmp    $0x2,%eax
+  80463e:	0f 85 ab 00 00 00    	jne    8046ef <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804644:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80464b:	00 00 
+  80464d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804651:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804653:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804657:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80465e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804662:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804664:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804668:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80466f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804673:	48 bb fd 32 80 00 00 	movabs $0x8032fd,%rbx
+  80467a:	00 00 00 
+  80467d:	ff d3                	call   *%rbx
+  80467f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804683:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804687:	ff d3                	call   *%rbx
+  804689:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80468e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804693:	eb 4d                	jmp    8046e2 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804695:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80469a:	4c 89 ee             	mov    %r13,%rsi
+  80469d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046a2:	48 b8 c5 2b 80 00 00 	movabs $0x802bc5,%rax
+  8046a9:	00 00 00 
+  8046ac:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8046ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046b3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8046b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046bc:	48 b8 c5 2b 80 00 00 	movabs $0x802bc5,%rax
+  8046c3:	00 00 00 
+  8046c6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8046c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046cd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8046d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046d6:	48 b8 c5 2b 80 00 00 	movabs $0x802bc5,%rax
+  8046dd:	00 00 00 
+  8046e0:	ff d0                	call   *%rax
+}
+  8046e2:	89 d8                	mov    %ebx,%eax
+  8046e4:	48 83 c4 18          	add    $0x18,%rsp
+  8046e8:	5b                   	pop    %rbx
+  8046e9:	41 5c                	pop    %r12
+  8046eb:	41 5d                	pop    %r13
+  8046ed:	5d                   	pop    %rbp
+  8046ee:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046ef:	48 b9 c8 68 80 00 00 	movabs $0x8068c8,%rcx
+  8046f6:	00 00 00 
+  8046f9:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  804700:	00 00 00 
+  804703:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804708:	48 bf b7 68 80 00 00 	movabs $0x8068b7,%rdi
+  80470f:	00 00 00 
+  804712:	b8 00 00 00 00       	mov    $0x0,%eax
+  804717:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  80471e:	00 00 00 
+  804721:	41 ff d0             	call   *%r8
+
+0000000000804724 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804724:	55                   	push   %rbp
+  804725:	48 89 e5             	mov    %rsp,%rbp
+  804728:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80472c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804730:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  804737:	00 00 00 
+  80473a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80473c:	85 c0                	test   %eax,%eax
+  80473e:	78 35                	js     804775 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804740:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804744:	48 b8 0f 33 80 00 00 	movabs $0x80330f,%rax
+  80474b:	00 00 00 
+  80474e:	ff d0                	call   *%rax
+  804750:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804753:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804758:	be 00 10 00 00       	mov    $0x1000,%esi
+  80475d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804761:	48 b8 bb 2a 80 00 00 	movabs $0x802abb,%rax
+  804768:	00 00 00 
+  80476b:	ff d0                	call   *%rax
+  80476d:	85 c0                	test   %eax,%eax
+  80476f:	0f 94 c0             	sete   %al
+  804772:	0f b6 c0             	movzbl %al,%eax
+}
+  804775:	c9                   	leave
+  804776:	c3                   	ret
+
+0000000000804777 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804777:	48 89 f8             	mov    %rdi,%rax
+  80477a:	48 c1 e8 27          	shr    $0x27,%rax
+  80477e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804785:	01 00 00 
+  804788:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80478c:	f6 c2 01             	test   $0x1,%dl
+  80478f:	74 6d                	je     8047fe <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804791:	48 89 f8             	mov    %rdi,%rax
+  804794:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804798:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80479f:	01 00 00 
+  8047a2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047a6:	f6 c2 01             	test   $0x1,%dl
+  8047a9:	74 62                	je     80480d <get_uvpt_entry+0x96>
+  8047ab:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8047b2:	01 00 00 
+  8047b5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047b9:	f6 c2 80             	test   $0x80,%dl
+  8047bc:	75 4f                	jne    80480d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8047be:	48 89 f8             	mov    %rdi,%rax
+  8047c1:	48 c1 e8 15          	shr    $0x15,%rax
+  8047c5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047cc:	01 00 00 
+  8047cf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047d3:	f6 c2 01             	test   $0x1,%dl
+  8047d6:	74 44                	je     80481c <get_uvpt_entry+0xa5>
+  8047d8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047df:	01 00 00 
+  8047e2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047e6:	f6 c2 80             	test   $0x80,%dl
+  8047e9:	75 31                	jne    80481c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8047eb:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8047ef:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8047f6:	01 00 00 
+  8047f9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8047fd:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8047fe:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804805:	01 00 00 
+  804808:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80480c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80480d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804814:	01 00 00 
+  804817:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80481b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80481c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804823:	01 00 00 
+  804826:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80482a:	c3                   	ret
+
+000000000080482b <get_prot>:
+
+int
+get_prot(void *va) {
+  80482b:	55                   	push   %rbp
+  80482c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80482f:	48 b8 77 47 80 00 00 	movabs $0x804777,%rax
+  804836:	00 00 00 
+  804839:	ff d0                	call   *%rax
+  80483b:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80483e:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804843:	89 c1                	mov    %eax,%ecx
+  804845:	83 c9 04             	or     $0x4,%ecx
+  804848:	f6 c2 01             	test   $0x1,%dl
+  80484b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80484e:	89 c1                	mov    %eax,%ecx
+  804850:	83 c9 02             	or     $0x2,%ecx
+  804853:	f6 c2 02             	test   $0x2,%dl
+  804856:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804859:	89 c1                	mov    %eax,%ecx
+  80485b:	83 c9 01             	or     $0x1,%ecx
+  80485e:	48 85 d2             	test   %rdx,%rdx
+  804861:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804864:	89 c1                	mov    %eax,%ecx
+  804866:	83 c9 40             	or     $0x40,%ecx
+  804869:	f6 c6 04             	test   $0x4,%dh
+  80486c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80486f:	5d                   	pop    %rbp
+  804870:	c3                   	ret
+
+0000000000804871 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804871:	55                   	push   %rbp
+  804872:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804875:	48 b8 77 47 80 00 00 	movabs $0x804777,%rax
+  80487c:	00 00 00 
+  80487f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804881:	48 c1 e8 06          	shr    $0x6,%rax
+  804885:	83 e0 01             	and    $0x1,%eax
+}
+  804888:	5d                   	pop    %rbp
+  804889:	c3                   	ret
+
+000000000080488a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80488a:	55                   	push   %rbp
+  80488b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80488e:	48 b8 77 47 80 00 00 	movabs $0x804777,%rax
+  804895:	00 00 00 
+  804898:	ff d0                	call   *%rax
+  80489a:	83 e0 01             	and    $0x1,%eax
+}
+  80489d:	5d                   	pop    %rbp
+  80489e:	c3                   	ret
+
+000000000080489f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80489f:	55                   	push   %rbp
+  8048a0:	48 89 e5             	mov    %rsp,%rbp
+  8048a3:	41 57                	push   %r15
+  8048a5:	41 56                	push   %r14
+  8048a7:	41 55                	push   %r13
+  8048a9:	41 54                	push   %r12
+  8048ab:	53                   	push   %rbx
+  8048ac:	48 83 ec 28          	sub    $0x28,%rsp
+  8048b0:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8048b4:	48 85 ff             	test   %rdi,%rdi
+  8048b7:	74 1e                	je     8048d7 <foreach_shared_region+0x38>
+  8048b9:	49 89 ff             	mov    %rdi,%r15
+  8048bc:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8048c2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8048c8:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8048cf:	01 00 00 
+  8048d2:	e9 72 02 00 00       	jmp    804b49 <foreach_shared_region+0x2aa>
+    assert(fun);
+  8048d7:	48 b9 ec 68 80 00 00 	movabs $0x8068ec,%rcx
+  8048de:	00 00 00 
+  8048e1:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  8048e8:	00 00 00 
+  8048eb:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8048f0:	48 bf f0 68 80 00 00 	movabs $0x8068f0,%rdi
+  8048f7:	00 00 00 
+  8048fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048ff:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  804906:	00 00 00 
+  804909:	41 ff d0             	call   *%r8
+  80490c:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804913:	eb 6c                	jmp    804981 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804915:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80491c:	ff ff ff 
+  80491f:	4c 21 e2             	and    %r12,%rdx
+  804922:	48 89 d8             	mov    %rbx,%rax
+  804925:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80492a:	48 83 c0 01          	add    $0x1,%rax
+  80492e:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804932:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804939:	00 00 00 
+  80493c:	48 21 c8             	and    %rcx,%rax
+  80493f:	48 09 d0             	or     %rdx,%rax
+  804942:	49 89 c4             	mov    %rax,%r12
+  804945:	eb 30                	jmp    804977 <foreach_shared_region+0xd8>
+  804947:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80494e:	ff ff ff 
+  804951:	4c 21 e2             	and    %r12,%rdx
+  804954:	48 89 d8             	mov    %rbx,%rax
+  804957:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80495c:	48 83 c0 01          	add    $0x1,%rax
+  804960:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804964:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80496b:	00 00 00 
+  80496e:	48 21 c8             	and    %rcx,%rax
+  804971:	48 09 d0             	or     %rdx,%rax
+  804974:	49 89 c4             	mov    %rax,%r12
+  804977:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80497b:	0f 84 99 01 00 00    	je     804b1a <foreach_shared_region+0x27b>
+  804981:	4c 89 e3             	mov    %r12,%rbx
+  804984:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804988:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80498f:	01 00 00 
+  804992:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804996:	a8 01                	test   $0x1,%al
+  804998:	0f 84 77 ff ff ff    	je     804915 <foreach_shared_region+0x76>
+  80499e:	a8 80                	test   $0x80,%al
+  8049a0:	74 19                	je     8049bb <foreach_shared_region+0x11c>
+  8049a2:	f6 c4 04             	test   $0x4,%ah
+  8049a5:	74 a0                	je     804947 <foreach_shared_region+0xa8>
+  8049a7:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8049ae:	40 
+  8049af:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049b3:	4c 89 e7             	mov    %r12,%rdi
+  8049b6:	41 ff d7             	call   *%r15
+  8049b9:	eb 8c                	jmp    804947 <foreach_shared_region+0xa8>
+  8049bb:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8049c2:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8049c6:	eb 46                	jmp    804a0e <foreach_shared_region+0x16f>
+  8049c8:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8049cf:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049d5:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8049d9:	48 c1 e0 15          	shl    $0x15,%rax
+  8049dd:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8049e2:	49 09 c4             	or     %rax,%r12
+  8049e5:	eb 1d                	jmp    804a04 <foreach_shared_region+0x165>
+  8049e7:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8049ee:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049f4:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8049f8:	48 c1 e0 15          	shl    $0x15,%rax
+  8049fc:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a01:	49 09 c4             	or     %rax,%r12
+  804a04:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804a08:	0f 84 d3 00 00 00    	je     804ae1 <foreach_shared_region+0x242>
+  804a0e:	4c 89 e3             	mov    %r12,%rbx
+  804a11:	48 c1 eb 15          	shr    $0x15,%rbx
+  804a15:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804a1c:	01 00 00 
+  804a1f:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a23:	a8 01                	test   $0x1,%al
+  804a25:	74 a1                	je     8049c8 <foreach_shared_region+0x129>
+  804a27:	a8 80                	test   $0x80,%al
+  804a29:	74 19                	je     804a44 <foreach_shared_region+0x1a5>
+  804a2b:	f6 c4 04             	test   $0x4,%ah
+  804a2e:	74 b7                	je     8049e7 <foreach_shared_region+0x148>
+  804a30:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804a37:	00 
+  804a38:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a3c:	4c 89 e7             	mov    %r12,%rdi
+  804a3f:	41 ff d7             	call   *%r15
+  804a42:	eb a3                	jmp    8049e7 <foreach_shared_region+0x148>
+  804a44:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804a4a:	eb 3b                	jmp    804a87 <foreach_shared_region+0x1e8>
+  804a4c:	f6 c4 04             	test   $0x4,%ah
+  804a4f:	74 12                	je     804a63 <foreach_shared_region+0x1c4>
+  804a51:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804a58:	00 
+  804a59:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a5d:	4c 89 e7             	mov    %r12,%rdi
+  804a60:	41 ff d7             	call   *%r15
+  804a63:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804a6a:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a70:	48 83 c3 01          	add    $0x1,%rbx
+  804a74:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804a78:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804a7e:	49 09 dc             	or     %rbx,%r12
+  804a81:	41 83 ed 01          	sub    $0x1,%r13d
+  804a85:	74 2f                	je     804ab6 <foreach_shared_region+0x217>
+  804a87:	4c 89 e3             	mov    %r12,%rbx
+  804a8a:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804a8e:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804a92:	a8 01                	test   $0x1,%al
+  804a94:	75 b6                	jne    804a4c <foreach_shared_region+0x1ad>
+  804a96:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804a9d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804aa3:	48 83 c3 01          	add    $0x1,%rbx
+  804aa7:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804aab:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804ab1:	49 09 dc             	or     %rbx,%r12
+  804ab4:	eb cb                	jmp    804a81 <foreach_shared_region+0x1e2>
+  804ab6:	4c 89 e0             	mov    %r12,%rax
+  804ab9:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804abf:	49 c1 ec 15          	shr    $0x15,%r12
+  804ac3:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804aca:	49 83 c4 01          	add    $0x1,%r12
+  804ace:	49 c1 e4 15          	shl    $0x15,%r12
+  804ad2:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804ad9:	49 09 c4             	or     %rax,%r12
+  804adc:	e9 23 ff ff ff       	jmp    804a04 <foreach_shared_region+0x165>
+  804ae1:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804ae5:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804aec:	ff ff ff 
+  804aef:	4c 21 e0             	and    %r12,%rax
+  804af2:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804af6:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804afd:	49 83 c4 01          	add    $0x1,%r12
+  804b01:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804b05:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804b0c:	00 00 00 
+  804b0f:	49 21 d4             	and    %rdx,%r12
+  804b12:	49 09 c4             	or     %rax,%r12
+  804b15:	e9 5d fe ff ff       	jmp    804977 <foreach_shared_region+0xd8>
+  804b1a:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804b21:	00 ff ff 
+  804b24:	4c 21 e0             	and    %r12,%rax
+  804b27:	49 c1 ec 27          	shr    $0x27,%r12
+  804b2b:	49 83 c4 01          	add    $0x1,%r12
+  804b2f:	49 c1 e4 27          	shl    $0x27,%r12
+  804b33:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804b3a:	ff 00 00 
+  804b3d:	49 21 d4             	and    %rdx,%r12
+  804b40:	49 09 c4             	or     %rax,%r12
+  804b43:	41 83 ed 01          	sub    $0x1,%r13d
+  804b47:	74 48                	je     804b91 <foreach_shared_region+0x2f2>
+  804b49:	4c 89 e0             	mov    %r12,%rax
+  804b4c:	48 c1 e8 27          	shr    $0x27,%rax
+  804b50:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804b57:	01 00 00 
+  804b5a:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804b5e:	f6 c2 01             	test   $0x1,%dl
+  804b61:	0f 85 a5 fd ff ff    	jne    80490c <foreach_shared_region+0x6d>
+  804b67:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804b6e:	00 ff ff 
+  804b71:	4c 21 e2             	and    %r12,%rdx
+  804b74:	48 83 c0 01          	add    $0x1,%rax
+  804b78:	48 c1 e0 27          	shl    $0x27,%rax
+  804b7c:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804b83:	ff 00 00 
+  804b86:	48 21 c8             	and    %rcx,%rax
+  804b89:	48 09 d0             	or     %rdx,%rax
+  804b8c:	49 89 c4             	mov    %rax,%r12
+  804b8f:	eb b2                	jmp    804b43 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804b91:	4d 85 e4             	test   %r12,%r12
+  804b94:	75 14                	jne    804baa <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b9b:	48 83 c4 28          	add    $0x28,%rsp
+  804b9f:	5b                   	pop    %rbx
+  804ba0:	41 5c                	pop    %r12
+  804ba2:	41 5d                	pop    %r13
+  804ba4:	41 5e                	pop    %r14
+  804ba6:	41 5f                	pop    %r15
+  804ba8:	5d                   	pop    %rbp
+  804ba9:	c3                   	ret
+    assert(addr == 0);
+  804baa:	48 b9 fb 68 80 00 00 	movabs $0x8068fb,%rcx
+  804bb1:	00 00 00 
+  804bb4:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  804bbb:	00 00 00 
+  804bbe:	be 67 00 00 00       	mov    $0x67,%esi
+  804bc3:	48 bf f0 68 80 00 00 	movabs $0x8068f0,%rdi
+  804bca:	00 00 00 
+  804bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd2:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  804bd9:	00 00 00 
+  804bdc:	41 ff d0             	call   *%r8
+
+0000000000804bdf <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804bdf:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804be6:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804be9:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804bef:	eb 33                	jmp    804c24 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804bf1:	48 83 c0 20          	add    $0x20,%rax
+  804bf5:	4c 39 c0             	cmp    %r8,%rax
+  804bf8:	74 25                	je     804c1f <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804bfa:	48 8b 10             	mov    (%rax),%rdx
+  804bfd:	48 85 d2             	test   %rdx,%rdx
+  804c00:	74 ef                	je     804bf1 <mmap_place+0x12>
+  804c02:	48 89 d1             	mov    %rdx,%rcx
+  804c05:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c09:	48 39 cf             	cmp    %rcx,%rdi
+  804c0c:	73 e3                	jae    804bf1 <mmap_place+0x12>
+  804c0e:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804c12:	4c 39 ca             	cmp    %r9,%rdx
+  804c15:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804c19:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804c1d:	eb d2                	jmp    804bf1 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804c1f:	45 84 d2             	test   %r10b,%r10b
+  804c22:	74 12                	je     804c36 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c24:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c2b:	00 00 00 
+        moved = 0;
+  804c2e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804c34:	eb c4                	jmp    804bfa <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804c36:	48 01 fe             	add    %rdi,%rsi
+  804c39:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804c40:	00 00 00 
+  804c43:	48 39 f0             	cmp    %rsi,%rax
+  804c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c4b:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804c4f:	c3                   	ret
+
+0000000000804c50 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804c50:	55                   	push   %rbp
+  804c51:	48 89 e5             	mov    %rsp,%rbp
+  804c54:	41 57                	push   %r15
+  804c56:	41 56                	push   %r14
+  804c58:	41 55                	push   %r13
+  804c5a:	41 54                	push   %r12
+  804c5c:	53                   	push   %rbx
+  804c5d:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804c61:	48 8b 1f             	mov    (%rdi),%rbx
+  804c64:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c6b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c72:	00 00 00 
+  804c75:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c7a:	eb 12                	jmp    804c8e <mmap_pgfault+0x3e>
+  804c7c:	48 83 c2 01          	add    $0x1,%rdx
+  804c80:	48 83 c0 20          	add    $0x20,%rax
+  804c84:	48 83 fa 20          	cmp    $0x20,%rdx
+  804c88:	0f 84 04 01 00 00    	je     804d92 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804c8e:	48 8b 08             	mov    (%rax),%rcx
+  804c91:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804c95:	48 39 de             	cmp    %rbx,%rsi
+  804c98:	73 e2                	jae    804c7c <mmap_pgfault+0x2c>
+  804c9a:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c9e:	48 39 cb             	cmp    %rcx,%rbx
+  804ca1:	73 d9                	jae    804c7c <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804ca3:	48 c1 e2 05          	shl    $0x5,%rdx
+  804ca7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cae:	00 00 00 
+  804cb1:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804cb5:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804cb9:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804cbd:	f6 c2 01             	test   $0x1,%dl
+  804cc0:	0f 84 e0 00 00 00    	je     804da6 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ccb:	f6 c2 02             	test   $0x2,%dl
+  804cce:	0f 84 c3 00 00 00    	je     804d97 <mmap_pgfault+0x147>
+  804cd4:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804cdb:	ff ff ff 
+  804cde:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804ce2:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804ce9:	00 00 00 
+  804cec:	48 39 ca             	cmp    %rcx,%rdx
+  804cef:	0f 85 a2 00 00 00    	jne    804d97 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804cf5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804cfa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cff:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804d06:	00 00 00 
+  804d09:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d0e:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  804d15:	00 00 00 
+  804d18:	ff d0                	call   *%rax
+  804d1a:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804d1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d21:	85 d2                	test   %edx,%edx
+  804d23:	78 72                	js     804d97 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804d25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d2a:	48 89 de             	mov    %rbx,%rsi
+  804d2d:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804d34:	00 00 00 
+  804d37:	4c 89 e7             	mov    %r12,%rdi
+  804d3a:	48 b8 3f 27 80 00 00 	movabs $0x80273f,%rax
+  804d41:	00 00 00 
+  804d44:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804d46:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804d4c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804d52:	48 89 d9             	mov    %rbx,%rcx
+  804d55:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d5a:	4c 89 e6             	mov    %r12,%rsi
+  804d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d62:	48 b8 5a 2b 80 00 00 	movabs $0x802b5a,%rax
+  804d69:	00 00 00 
+  804d6c:	ff d0                	call   *%rax
+  804d6e:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804d70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d75:	4c 89 e6             	mov    %r12,%rsi
+  804d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d7d:	48 b8 c5 2b 80 00 00 	movabs $0x802bc5,%rax
+  804d84:	00 00 00 
+  804d87:	ff d0                	call   *%rax
+    return res >= 0;
+  804d89:	89 d8                	mov    %ebx,%eax
+  804d8b:	f7 d0                	not    %eax
+  804d8d:	c1 e8 1f             	shr    $0x1f,%eax
+  804d90:	eb 05                	jmp    804d97 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804d92:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804d97:	48 83 c4 18          	add    $0x18,%rsp
+  804d9b:	5b                   	pop    %rbx
+  804d9c:	41 5c                	pop    %r12
+  804d9e:	41 5d                	pop    %r13
+  804da0:	41 5e                	pop    %r14
+  804da2:	41 5f                	pop    %r15
+  804da4:	5d                   	pop    %rbp
+  804da5:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804da6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804daa:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804dae:	4c 03 30             	add    (%rax),%r14
+  804db1:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804db8:	49 39 c6             	cmp    %rax,%r14
+  804dbb:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804dbf:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804dc6:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804dcc:	49 bf 8a 48 80 00 00 	movabs $0x80488a,%r15
+  804dd3:	00 00 00 
+  804dd6:	4d 39 f4             	cmp    %r14,%r12
+  804dd9:	73 1d                	jae    804df8 <mmap_pgfault+0x1a8>
+  804ddb:	4c 89 e7             	mov    %r12,%rdi
+  804dde:	41 ff d7             	call   *%r15
+  804de1:	84 c0                	test   %al,%al
+  804de3:	75 13                	jne    804df8 <mmap_pgfault+0x1a8>
+  804de5:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804dec:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804df3:	4d 39 f4             	cmp    %r14,%r12
+  804df6:	72 e3                	jb     804ddb <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804df8:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804dfe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e02:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804e06:	74 2a                	je     804e32 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804e08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e0c:	89 de                	mov    %ebx,%esi
+  804e0e:	2b 30                	sub    (%rax),%esi
+  804e10:	03 70 1c             	add    0x1c(%rax),%esi
+  804e13:	8b 78 18             	mov    0x18(%rax),%edi
+  804e16:	4c 89 e9             	mov    %r13,%rcx
+  804e19:	48 89 da             	mov    %rbx,%rdx
+  804e1c:	48 b8 e8 3f 80 00 00 	movabs $0x803fe8,%rax
+  804e23:	00 00 00 
+  804e26:	ff d0                	call   *%rax
+    return res > 0;
+  804e28:	85 c0                	test   %eax,%eax
+  804e2a:	0f 9f c0             	setg   %al
+  804e2d:	e9 65 ff ff ff       	jmp    804d97 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e32:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804e36:	eb d0                	jmp    804e08 <mmap_pgfault+0x1b8>
+
+0000000000804e38 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804e38:	55                   	push   %rbp
+  804e39:	48 89 e5             	mov    %rsp,%rbp
+  804e3c:	41 57                	push   %r15
+  804e3e:	41 56                	push   %r14
+  804e40:	41 55                	push   %r13
+  804e42:	41 54                	push   %r12
+  804e44:	53                   	push   %rbx
+  804e45:	48 83 ec 28          	sub    $0x28,%rsp
+  804e49:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804e4d:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804e50:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804e57:	ff ff ff 
+  804e5a:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e63:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804e6a:	00 00 00 
+  804e6d:	48 39 ca             	cmp    %rcx,%rdx
+  804e70:	0f 85 e5 00 00 00    	jne    804f5b <mmap_writeback+0x123>
+  804e76:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804e79:	4c 39 ee             	cmp    %r13,%rsi
+  804e7c:	0f 83 e8 00 00 00    	jae    804f6a <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804e82:	49 be 8a 48 80 00 00 	movabs $0x80488a,%r14
+  804e89:	00 00 00 
+  804e8c:	49 bf 71 48 80 00 00 	movabs $0x804871,%r15
+  804e93:	00 00 00 
+  804e96:	eb 10                	jmp    804ea8 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804e98:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804e9f:	4d 39 ec             	cmp    %r13,%r12
+  804ea2:	0f 83 ae 00 00 00    	jae    804f56 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ea8:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804eac:	4c 89 e7             	mov    %r12,%rdi
+  804eaf:	41 ff d6             	call   *%r14
+  804eb2:	84 c0                	test   %al,%al
+  804eb4:	74 e2                	je     804e98 <mmap_writeback+0x60>
+  804eb6:	4c 89 e7             	mov    %r12,%rdi
+  804eb9:	41 ff d7             	call   *%r15
+  804ebc:	84 c0                	test   %al,%al
+  804ebe:	74 d8                	je     804e98 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804ec0:	4c 89 e3             	mov    %r12,%rbx
+  804ec3:	4d 39 ec             	cmp    %r13,%r12
+  804ec6:	73 20                	jae    804ee8 <mmap_writeback+0xb0>
+  804ec8:	48 89 df             	mov    %rbx,%rdi
+  804ecb:	41 ff d6             	call   *%r14
+  804ece:	84 c0                	test   %al,%al
+  804ed0:	74 16                	je     804ee8 <mmap_writeback+0xb0>
+  804ed2:	48 89 df             	mov    %rbx,%rdi
+  804ed5:	41 ff d7             	call   *%r15
+  804ed8:	84 c0                	test   %al,%al
+  804eda:	74 0c                	je     804ee8 <mmap_writeback+0xb0>
+  804edc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804ee3:	4c 39 eb             	cmp    %r13,%rbx
+  804ee6:	72 e0                	jb     804ec8 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804ee8:	48 89 d9             	mov    %rbx,%rcx
+  804eeb:	4c 29 e1             	sub    %r12,%rcx
+  804eee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804ef2:	44 89 e6             	mov    %r12d,%esi
+  804ef5:	2b 30                	sub    (%rax),%esi
+  804ef7:	49 89 c4             	mov    %rax,%r12
+  804efa:	03 70 1c             	add    0x1c(%rax),%esi
+  804efd:	8b 78 18             	mov    0x18(%rax),%edi
+  804f00:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804f04:	48 89 ca             	mov    %rcx,%rdx
+  804f07:	48 b8 71 40 80 00 00 	movabs $0x804071,%rax
+  804f0e:	00 00 00 
+  804f11:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804f13:	85 c0                	test   %eax,%eax
+  804f15:	78 44                	js     804f5b <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804f17:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804f1c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804f1f:	41 89 c1             	mov    %eax,%r9d
+  804f22:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804f29:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804f2d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f36:	48 89 ce             	mov    %rcx,%rsi
+  804f39:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f3e:	48 b8 5a 2b 80 00 00 	movabs $0x802b5a,%rax
+  804f45:	00 00 00 
+  804f48:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804f4a:	85 c0                	test   %eax,%eax
+  804f4c:	78 0d                	js     804f5b <mmap_writeback+0x123>
+  804f4e:	49 89 dc             	mov    %rbx,%r12
+  804f51:	e9 49 ff ff ff       	jmp    804e9f <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804f56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f5b:	48 83 c4 28          	add    $0x28,%rsp
+  804f5f:	5b                   	pop    %rbx
+  804f60:	41 5c                	pop    %r12
+  804f62:	41 5d                	pop    %r13
+  804f64:	41 5e                	pop    %r14
+  804f66:	41 5f                	pop    %r15
+  804f68:	5d                   	pop    %rbp
+  804f69:	c3                   	ret
+    return 0;
+  804f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6f:	eb ea                	jmp    804f5b <mmap_writeback+0x123>
+
+0000000000804f71 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804f71:	55                   	push   %rbp
+  804f72:	48 89 e5             	mov    %rsp,%rbp
+  804f75:	41 57                	push   %r15
+  804f77:	41 56                	push   %r14
+  804f79:	41 55                	push   %r13
+  804f7b:	41 54                	push   %r12
+  804f7d:	53                   	push   %rbx
+  804f7e:	48 83 ec 38          	sub    $0x38,%rsp
+  804f82:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f86:	48 85 f6             	test   %rsi,%rsi
+  804f89:	0f 84 0c 02 00 00    	je     80519b <mmap+0x22a>
+  804f8f:	49 89 ff             	mov    %rdi,%r15
+  804f92:	49 89 f4             	mov    %rsi,%r12
+  804f95:	41 89 d5             	mov    %edx,%r13d
+  804f98:	41 89 ce             	mov    %ecx,%r14d
+  804f9b:	44 89 cb             	mov    %r9d,%ebx
+  804f9e:	45 85 c9             	test   %r9d,%r9d
+  804fa1:	0f 88 f4 01 00 00    	js     80519b <mmap+0x22a>
+  804fa7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fae:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804fb5:	0f 85 e7 01 00 00    	jne    8051a2 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804fbb:	83 e2 fd             	and    $0xfffffffd,%edx
+  804fbe:	83 fa 04             	cmp    $0x4,%edx
+  804fc1:	0f 85 db 01 00 00    	jne    8051a2 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804fc7:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804fca:	83 fa 01             	cmp    $0x1,%edx
+  804fcd:	0f 87 cf 01 00 00    	ja     8051a2 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804fd3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804fd7:	44 89 c7             	mov    %r8d,%edi
+  804fda:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  804fe1:	00 00 00 
+  804fe4:	ff d0                	call   *%rax
+  804fe6:	89 c2                	mov    %eax,%edx
+  804fe8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fef:	85 d2                	test   %edx,%edx
+  804ff1:	0f 88 ab 01 00 00    	js     8051a2 <mmap+0x231>
+  804ff7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ffb:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  805002:	00 00 00 
+  805005:	8b 09                	mov    (%rcx),%ecx
+  805007:	39 0a                	cmp    %ecx,(%rdx)
+  805009:	0f 85 93 01 00 00    	jne    8051a2 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  80500f:	8b 52 08             	mov    0x8(%rdx),%edx
+  805012:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  805015:	83 fa 01             	cmp    $0x1,%edx
+  805018:	0f 84 84 01 00 00    	je     8051a2 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80501e:	41 83 fe 01          	cmp    $0x1,%r14d
+  805022:	74 42                	je     805066 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805024:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  80502b:	4c 89 e6             	mov    %r12,%rsi
+  80502e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  805035:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805039:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  80503d:	4d 85 ff             	test   %r15,%r15
+  805040:	74 67                	je     8050a9 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805042:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805049:	75 0f                	jne    80505a <mmap+0xe9>
+  80504b:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805052:	00 00 00 
+  805055:	49 39 c7             	cmp    %rax,%r15
+  805058:	77 1b                	ja     805075 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80505a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805061:	e9 3c 01 00 00       	jmp    8051a2 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805066:	41 f6 c5 02          	test   $0x2,%r13b
+  80506a:	74 b8                	je     805024 <mmap+0xb3>
+  80506c:	85 d2                	test   %edx,%edx
+  80506e:	75 b4                	jne    805024 <mmap+0xb3>
+  805070:	e9 2d 01 00 00       	jmp    8051a2 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805075:	4c 89 ff             	mov    %r15,%rdi
+  805078:	48 b8 df 4b 80 00 00 	movabs $0x804bdf,%rax
+  80507f:	00 00 00 
+  805082:	ff d0                	call   *%rax
+  805084:	48 89 c2             	mov    %rax,%rdx
+  805087:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80508e:	49 39 d7             	cmp    %rdx,%r15
+  805091:	0f 85 0b 01 00 00    	jne    8051a2 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805097:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80509e:	00 00 00 
+  8050a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050a7:	eb 44                	jmp    8050ed <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8050a9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8050ad:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  8050b4:	00 00 00 
+  8050b7:	48 b8 df 4b 80 00 00 	movabs $0x804bdf,%rax
+  8050be:	00 00 00 
+  8050c1:	ff d0                	call   *%rax
+  8050c3:	48 89 c7             	mov    %rax,%rdi
+  8050c6:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  8050ca:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8050d1:	48 85 ff             	test   %rdi,%rdi
+  8050d4:	75 c1                	jne    805097 <mmap+0x126>
+  8050d6:	e9 c7 00 00 00       	jmp    8051a2 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8050db:	49 83 c4 01          	add    $0x1,%r12
+  8050df:	48 83 c0 20          	add    $0x20,%rax
+  8050e3:	49 83 fc 20          	cmp    $0x20,%r12
+  8050e7:	0f 84 a5 00 00 00    	je     805192 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8050ed:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8050f1:	75 e8                	jne    8050db <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  8050f3:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8050f7:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  8050fe:	00 00 00 
+  805101:	ff d0                	call   *%rax
+  805103:	89 c2                	mov    %eax,%edx
+  805105:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80510c:	85 d2                	test   %edx,%edx
+  80510e:	0f 88 8e 00 00 00    	js     8051a2 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805114:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805118:	48 b8 fd 32 80 00 00 	movabs $0x8032fd,%rax
+  80511f:	00 00 00 
+  805122:	ff d0                	call   *%rax
+  805124:	89 c6                	mov    %eax,%esi
+  805126:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805129:	48 b8 4b 35 80 00 00 	movabs $0x80354b,%rax
+  805130:	00 00 00 
+  805133:	ff d0                	call   *%rax
+  805135:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805138:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80513f:	45 85 ff             	test   %r15d,%r15d
+  805142:	78 5e                	js     8051a2 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805144:	49 c1 e4 05          	shl    $0x5,%r12
+  805148:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80514f:	00 00 00 
+  805152:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805155:	48 bf 50 4c 80 00 00 	movabs $0x804c50,%rdi
+  80515c:	00 00 00 
+  80515f:	48 b8 7b 56 80 00 00 	movabs $0x80567b,%rax
+  805166:	00 00 00 
+  805169:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  80516b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80516f:	49 89 04 24          	mov    %rax,(%r12)
+  805173:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805177:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  80517c:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805181:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805186:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  80518b:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805190:	eb 10                	jmp    8051a2 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805192:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805199:	eb 07                	jmp    8051a2 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80519b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8051a2:	48 83 c4 38          	add    $0x38,%rsp
+  8051a6:	5b                   	pop    %rbx
+  8051a7:	41 5c                	pop    %r12
+  8051a9:	41 5d                	pop    %r13
+  8051ab:	41 5e                	pop    %r14
+  8051ad:	41 5f                	pop    %r15
+  8051af:	5d                   	pop    %rbp
+  8051b0:	c3                   	ret
+
+00000000008051b1 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8051b1:	55                   	push   %rbp
+  8051b2:	48 89 e5             	mov    %rsp,%rbp
+  8051b5:	41 57                	push   %r15
+  8051b7:	41 56                	push   %r14
+  8051b9:	41 55                	push   %r13
+  8051bb:	41 54                	push   %r12
+  8051bd:	53                   	push   %rbx
+  8051be:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8051c2:	49 89 fe             	mov    %rdi,%r14
+  8051c5:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8051cc:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8051d3:	00 
+  8051d4:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051db:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8051e2:	00 00 00 
+  8051e5:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8051ec:	49 bf 38 4e 80 00 00 	movabs $0x804e38,%r15
+  8051f3:	00 00 00 
+  8051f6:	eb 09                	jmp    805201 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051f8:	48 83 c3 20          	add    $0x20,%rbx
+  8051fc:	4c 39 eb             	cmp    %r13,%rbx
+  8051ff:	74 33                	je     805234 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805201:	48 89 df             	mov    %rbx,%rdi
+  805204:	48 8b 33             	mov    (%rbx),%rsi
+  805207:	4c 39 e6             	cmp    %r12,%rsi
+  80520a:	73 ec                	jae    8051f8 <msync+0x47>
+  80520c:	48 85 f6             	test   %rsi,%rsi
+  80520f:	74 e7                	je     8051f8 <msync+0x47>
+  805211:	48 89 f2             	mov    %rsi,%rdx
+  805214:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805218:	49 39 d6             	cmp    %rdx,%r14
+  80521b:	73 db                	jae    8051f8 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80521d:	4c 39 e2             	cmp    %r12,%rdx
+  805220:	49 0f 47 d4          	cmova  %r12,%rdx
+  805224:	4c 39 f6             	cmp    %r14,%rsi
+  805227:	49 0f 42 f6          	cmovb  %r14,%rsi
+  80522b:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  80522e:	85 c0                	test   %eax,%eax
+  805230:	79 c6                	jns    8051f8 <msync+0x47>
+  805232:	eb 05                	jmp    805239 <msync+0x88>
+    }
+
+    return 0;
+  805234:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805239:	48 83 c4 08          	add    $0x8,%rsp
+  80523d:	5b                   	pop    %rbx
+  80523e:	41 5c                	pop    %r12
+  805240:	41 5d                	pop    %r13
+  805242:	41 5e                	pop    %r14
+  805244:	41 5f                	pop    %r15
+  805246:	5d                   	pop    %rbp
+  805247:	c3                   	ret
+
+0000000000805248 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805248:	55                   	push   %rbp
+  805249:	48 89 e5             	mov    %rsp,%rbp
+  80524c:	41 57                	push   %r15
+  80524e:	41 56                	push   %r14
+  805250:	41 55                	push   %r13
+  805252:	41 54                	push   %r12
+  805254:	53                   	push   %rbx
+  805255:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805259:	49 89 ff             	mov    %rdi,%r15
+  80525c:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805263:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80526a:	00 
+  80526b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805272:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805279:	00 00 00 
+  80527c:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805283:	48 89 d8             	mov    %rbx,%rax
+  805286:	eb 09                	jmp    805291 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805288:	48 83 c0 20          	add    $0x20,%rax
+  80528c:	4c 39 f0             	cmp    %r14,%rax
+  80528f:	74 40                	je     8052d1 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805291:	48 8b 10             	mov    (%rax),%rdx
+  805294:	4c 39 e2             	cmp    %r12,%rdx
+  805297:	73 ef                	jae    805288 <munmap+0x40>
+  805299:	48 85 d2             	test   %rdx,%rdx
+  80529c:	74 ea                	je     805288 <munmap+0x40>
+  80529e:	48 89 d7             	mov    %rdx,%rdi
+  8052a1:	48 03 78 08          	add    0x8(%rax),%rdi
+  8052a5:	49 39 ff             	cmp    %rdi,%r15
+  8052a8:	73 de                	jae    805288 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8052aa:	49 39 fc             	cmp    %rdi,%r12
+  8052ad:	72 05                	jb     8052b4 <munmap+0x6c>
+  8052af:	4c 39 fa             	cmp    %r15,%rdx
+  8052b2:	73 d4                	jae    805288 <munmap+0x40>
+  8052b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8052b9:	48 83 c4 08          	add    $0x8,%rsp
+  8052bd:	5b                   	pop    %rbx
+  8052be:	41 5c                	pop    %r12
+  8052c0:	41 5d                	pop    %r13
+  8052c2:	41 5e                	pop    %r14
+  8052c4:	41 5f                	pop    %r15
+  8052c6:	5d                   	pop    %rbp
+  8052c7:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052c8:	48 83 c3 20          	add    $0x20,%rbx
+  8052cc:	4c 39 f3             	cmp    %r14,%rbx
+  8052cf:	74 5c                	je     80532d <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052d1:	48 8b 33             	mov    (%rbx),%rsi
+  8052d4:	4c 39 e6             	cmp    %r12,%rsi
+  8052d7:	73 ef                	jae    8052c8 <munmap+0x80>
+  8052d9:	48 85 f6             	test   %rsi,%rsi
+  8052dc:	74 ea                	je     8052c8 <munmap+0x80>
+  8052de:	48 89 f2             	mov    %rsi,%rdx
+  8052e1:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8052e5:	49 39 d7             	cmp    %rdx,%r15
+  8052e8:	73 de                	jae    8052c8 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8052ea:	48 89 df             	mov    %rbx,%rdi
+  8052ed:	48 b8 38 4e 80 00 00 	movabs $0x804e38,%rax
+  8052f4:	00 00 00 
+  8052f7:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8052f9:	85 c0                	test   %eax,%eax
+  8052fb:	78 bc                	js     8052b9 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8052fd:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805301:	48 8b 33             	mov    (%rbx),%rsi
+  805304:	bf 00 00 00 00       	mov    $0x0,%edi
+  805309:	48 b8 c5 2b 80 00 00 	movabs $0x802bc5,%rax
+  805310:	00 00 00 
+  805313:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805315:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805318:	48 b8 f0 34 80 00 00 	movabs $0x8034f0,%rax
+  80531f:	00 00 00 
+  805322:	ff d0                	call   *%rax
+        reg->start = 0;
+  805324:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80532b:	eb 9b                	jmp    8052c8 <munmap+0x80>
+    return 0;
+  80532d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805332:	eb 85                	jmp    8052b9 <munmap+0x71>
+
+0000000000805334 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805334:	b8 00 00 00 00       	mov    $0x0,%eax
+  805339:	c3                   	ret
+
+000000000080533a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80533a:	55                   	push   %rbp
+  80533b:	48 89 e5             	mov    %rsp,%rbp
+  80533e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805341:	48 be 05 69 80 00 00 	movabs $0x806905,%rsi
+  805348:	00 00 00 
+  80534b:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  805352:	00 00 00 
+  805355:	ff d0                	call   *%rax
+    return 0;
+}
+  805357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80535c:	5d                   	pop    %rbp
+  80535d:	c3                   	ret
+
+000000000080535e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80535e:	55                   	push   %rbp
+  80535f:	48 89 e5             	mov    %rsp,%rbp
+  805362:	41 57                	push   %r15
+  805364:	41 56                	push   %r14
+  805366:	41 55                	push   %r13
+  805368:	41 54                	push   %r12
+  80536a:	53                   	push   %rbx
+  80536b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805372:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805379:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805380:	00 00 00 00 
+  805384:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  80538b:	00 00 00 00 
+  80538f:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805396:	00 00 00 00 
+  80539a:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8053a1:	00 00 00 00 
+  8053a5:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8053ac:	00 00 00 00 
+  8053b0:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8053b7:	00 00 00 00 
+  8053bb:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8053c2:	00 
+  8053c3:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8053ca:	00 
+  8053cb:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8053d2:	00 
+  8053d3:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8053da:	00 
+  8053db:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8053e2:	00 
+  8053e3:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8053ea:	00 
+  8053eb:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8053f2:	00 
+  8053f3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8053fa:	00 
+  8053fb:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805402:	00 
+  805403:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80540a:	00 
+    for (res = 0; res < n; res += inc) {
+  80540b:	48 85 d2             	test   %rdx,%rdx
+  80540e:	74 7a                	je     80548a <devcons_write+0x12c>
+  805410:	49 89 d6             	mov    %rdx,%r14
+  805413:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805419:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80541e:	49 bf d8 26 80 00 00 	movabs $0x8026d8,%r15
+  805425:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805428:	4c 89 f3             	mov    %r14,%rbx
+  80542b:	48 29 f3             	sub    %rsi,%rbx
+  80542e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805433:	48 39 c3             	cmp    %rax,%rbx
+  805436:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80543a:	4c 63 eb             	movslq %ebx,%r13
+  80543d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805444:	48 01 c6             	add    %rax,%rsi
+  805447:	4c 89 ea             	mov    %r13,%rdx
+  80544a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805451:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805454:	4c 89 ee             	mov    %r13,%rsi
+  805457:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80545e:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  805465:	00 00 00 
+  805468:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80546a:	41 01 dc             	add    %ebx,%r12d
+  80546d:	49 63 f4             	movslq %r12d,%rsi
+  805470:	4c 39 f6             	cmp    %r14,%rsi
+  805473:	72 b3                	jb     805428 <devcons_write+0xca>
+    return res;
+  805475:	49 63 c4             	movslq %r12d,%rax
+}
+  805478:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80547f:	5b                   	pop    %rbx
+  805480:	41 5c                	pop    %r12
+  805482:	41 5d                	pop    %r13
+  805484:	41 5e                	pop    %r14
+  805486:	41 5f                	pop    %r15
+  805488:	5d                   	pop    %rbp
+  805489:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80548a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805490:	eb e3                	jmp    805475 <devcons_write+0x117>
+
+0000000000805492 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805492:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80549a:	48 85 c0             	test   %rax,%rax
+  80549d:	74 55                	je     8054f4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80549f:	55                   	push   %rbp
+  8054a0:	48 89 e5             	mov    %rsp,%rbp
+  8054a3:	41 55                	push   %r13
+  8054a5:	41 54                	push   %r12
+  8054a7:	53                   	push   %rbx
+  8054a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8054ac:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8054af:	48 bb 38 29 80 00 00 	movabs $0x802938,%rbx
+  8054b6:	00 00 00 
+  8054b9:	49 bc 4c 2a 80 00 00 	movabs $0x802a4c,%r12
+  8054c0:	00 00 00 
+  8054c3:	eb 03                	jmp    8054c8 <devcons_read+0x36>
+  8054c5:	41 ff d4             	call   *%r12
+  8054c8:	ff d3                	call   *%rbx
+  8054ca:	85 c0                	test   %eax,%eax
+  8054cc:	74 f7                	je     8054c5 <devcons_read+0x33>
+    if (c < 0) return c;
+  8054ce:	48 63 d0             	movslq %eax,%rdx
+  8054d1:	78 13                	js     8054e6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8054d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054d8:	83 f8 04             	cmp    $0x4,%eax
+  8054db:	74 09                	je     8054e6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8054dd:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8054e1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8054e6:	48 89 d0             	mov    %rdx,%rax
+  8054e9:	48 83 c4 08          	add    $0x8,%rsp
+  8054ed:	5b                   	pop    %rbx
+  8054ee:	41 5c                	pop    %r12
+  8054f0:	41 5d                	pop    %r13
+  8054f2:	5d                   	pop    %rbp
+  8054f3:	c3                   	ret
+  8054f4:	48 89 d0             	mov    %rdx,%rax
+  8054f7:	c3                   	ret
+
+00000000008054f8 <cputchar>:
+cputchar(int ch) {
+  8054f8:	55                   	push   %rbp
+  8054f9:	48 89 e5             	mov    %rsp,%rbp
+  8054fc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805500:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805504:	be 01 00 00 00       	mov    $0x1,%esi
+  805509:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80550d:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  805514:	00 00 00 
+  805517:	ff d0                	call   *%rax
+}
+  805519:	c9                   	leave
+  80551a:	c3                   	ret
+
+000000000080551b <getchar>:
+getchar(void) {
+  80551b:	55                   	push   %rbp
+  80551c:	48 89 e5             	mov    %rsp,%rbp
+  80551f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805523:	ba 01 00 00 00       	mov    $0x1,%edx
+  805528:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80552c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805531:	48 b8 6e 36 80 00 00 	movabs $0x80366e,%rax
+  805538:	00 00 00 
+  80553b:	ff d0                	call   *%rax
+  80553d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80553f:	85 c0                	test   %eax,%eax
+  805541:	78 06                	js     805549 <getchar+0x2e>
+  805543:	74 08                	je     80554d <getchar+0x32>
+  805545:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805549:	89 d0                	mov    %edx,%eax
+  80554b:	c9                   	leave
+  80554c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80554d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805552:	eb f5                	jmp    805549 <getchar+0x2e>
+
+0000000000805554 <iscons>:
+iscons(int fdnum) {
+  805554:	55                   	push   %rbp
+  805555:	48 89 e5             	mov    %rsp,%rbp
+  805558:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80555c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805560:	48 b8 8b 33 80 00 00 	movabs $0x80338b,%rax
+  805567:	00 00 00 
+  80556a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80556c:	85 c0                	test   %eax,%eax
+  80556e:	78 18                	js     805588 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805570:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805574:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80557b:	00 00 00 
+  80557e:	8b 00                	mov    (%rax),%eax
+  805580:	39 02                	cmp    %eax,(%rdx)
+  805582:	0f 94 c0             	sete   %al
+  805585:	0f b6 c0             	movzbl %al,%eax
+}
+  805588:	c9                   	leave
+  805589:	c3                   	ret
+
+000000000080558a <opencons>:
+opencons(void) {
+  80558a:	55                   	push   %rbp
+  80558b:	48 89 e5             	mov    %rsp,%rbp
+  80558e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805592:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805596:	48 b8 2b 33 80 00 00 	movabs $0x80332b,%rax
+  80559d:	00 00 00 
+  8055a0:	ff d0                	call   *%rax
+  8055a2:	85 c0                	test   %eax,%eax
+  8055a4:	78 49                	js     8055ef <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8055a6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8055ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055b0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8055b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055b9:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  8055c0:	00 00 00 
+  8055c3:	ff d0                	call   *%rax
+  8055c5:	85 c0                	test   %eax,%eax
+  8055c7:	78 26                	js     8055ef <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8055c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8055cd:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8055d4:	00 00 
+  8055d6:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8055d8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8055dc:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8055e3:	48 b8 fd 32 80 00 00 	movabs $0x8032fd,%rax
+  8055ea:	00 00 00 
+  8055ed:	ff d0                	call   *%rax
+}
+  8055ef:	c9                   	leave
+  8055f0:	c3                   	ret
+
+00000000008055f1 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8055f1:	55                   	push   %rbp
+  8055f2:	48 89 e5             	mov    %rsp,%rbp
+  8055f5:	41 56                	push   %r14
+  8055f7:	41 55                	push   %r13
+  8055f9:	41 54                	push   %r12
+  8055fb:	53                   	push   %rbx
+  8055fc:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8055ff:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805606:	00 00 00 
+  805609:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80560d:	74 27                	je     805636 <_handle_vectored_pagefault+0x45>
+  80560f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805614:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80561b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80561e:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805621:	4c 89 e7             	mov    %r12,%rdi
+  805624:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805629:	84 c0                	test   %al,%al
+  80562b:	75 45                	jne    805672 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80562d:	48 83 c3 01          	add    $0x1,%rbx
+  805631:	49 3b 1e             	cmp    (%r14),%rbx
+  805634:	72 eb                	jb     805621 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805636:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80563d:	00 
+  80563e:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805643:	4d 8b 04 24          	mov    (%r12),%r8
+  805647:	48 ba 18 69 80 00 00 	movabs $0x806918,%rdx
+  80564e:	00 00 00 
+  805651:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805656:	48 bf 48 69 80 00 00 	movabs $0x806948,%rdi
+  80565d:	00 00 00 
+  805660:	b8 00 00 00 00       	mov    $0x0,%eax
+  805665:	49 ba 01 19 80 00 00 	movabs $0x801901,%r10
+  80566c:	00 00 00 
+  80566f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805672:	5b                   	pop    %rbx
+  805673:	41 5c                	pop    %r12
+  805675:	41 5d                	pop    %r13
+  805677:	41 5e                	pop    %r14
+  805679:	5d                   	pop    %rbp
+  80567a:	c3                   	ret
+
+000000000080567b <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80567b:	55                   	push   %rbp
+  80567c:	48 89 e5             	mov    %rsp,%rbp
+  80567f:	53                   	push   %rbx
+  805680:	48 83 ec 08          	sub    $0x8,%rsp
+  805684:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805687:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  80568c:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805693:	00 00 00 
+  805696:	80 38 00             	cmpb   $0x0,(%rax)
+  805699:	74 68                	je     805703 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80569b:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056a2:	00 00 00 
+  8056a5:	48 8b 08             	mov    (%rax),%rcx
+  8056a8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8056ad:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8056b4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056b7:	48 85 c9             	test   %rcx,%rcx
+  8056ba:	0f 84 e0 00 00 00    	je     8057a0 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8056c0:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8056c4:	0f 84 c9 00 00 00    	je     805793 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056ca:	48 83 c2 01          	add    $0x1,%rdx
+  8056ce:	48 39 ca             	cmp    %rcx,%rdx
+  8056d1:	75 ed                	jne    8056c0 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8056d3:	48 83 f9 08          	cmp    $0x8,%rcx
+  8056d7:	0f 84 84 00 00 00    	je     805761 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8056dd:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8056e1:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8056e8:	00 00 00 
+  8056eb:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8056f2:	00 00 00 
+  8056f5:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8056f9:	85 f6                	test   %esi,%esi
+  8056fb:	0f 89 97 00 00 00    	jns    805798 <add_pgfault_handler+0x11d>
+  805701:	eb 63                	jmp    805766 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805703:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805708:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80570d:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805714:	00 00 00 
+  805717:	bf 00 00 00 00       	mov    $0x0,%edi
+  80571c:	48 b8 ed 2a 80 00 00 	movabs $0x802aed,%rax
+  805723:	00 00 00 
+  805726:	ff d0                	call   *%rax
+  805728:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80572a:	85 c0                	test   %eax,%eax
+  80572c:	78 38                	js     805766 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80572e:	48 be 7c 58 80 00 00 	movabs $0x80587c,%rsi
+  805735:	00 00 00 
+  805738:	bf 00 00 00 00       	mov    $0x0,%edi
+  80573d:	48 b8 10 2d 80 00 00 	movabs $0x802d10,%rax
+  805744:	00 00 00 
+  805747:	ff d0                	call   *%rax
+  805749:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80574b:	85 c0                	test   %eax,%eax
+  80574d:	78 17                	js     805766 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80574f:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805756:	00 00 00 
+  805759:	c6 00 01             	movb   $0x1,(%rax)
+  80575c:	e9 3a ff ff ff       	jmp    80569b <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805761:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805766:	89 f1                	mov    %esi,%ecx
+  805768:	48 ba 56 69 80 00 00 	movabs $0x806956,%rdx
+  80576f:	00 00 00 
+  805772:	be 42 00 00 00       	mov    $0x42,%esi
+  805777:	48 bf 48 69 80 00 00 	movabs $0x806948,%rdi
+  80577e:	00 00 00 
+  805781:	b8 00 00 00 00       	mov    $0x0,%eax
+  805786:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  80578d:	00 00 00 
+  805790:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805793:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805798:	89 f0                	mov    %esi,%eax
+  80579a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80579e:	c9                   	leave
+  80579f:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8057a0:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8057a7:	00 00 00 
+  8057aa:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8057b1:	48 89 d8             	mov    %rbx,%rax
+  8057b4:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8057bb:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8057be:	eb d8                	jmp    805798 <add_pgfault_handler+0x11d>
+
+00000000008057c0 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8057c0:	55                   	push   %rbp
+  8057c1:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8057c4:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8057cb:	00 00 00 
+  8057ce:	80 38 00             	cmpb   $0x0,(%rax)
+  8057d1:	74 33                	je     805806 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8057d3:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8057da:	00 00 00 
+  8057dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8057e2:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8057e9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8057ec:	48 85 c0             	test   %rax,%rax
+  8057ef:	0f 84 85 00 00 00    	je     80587a <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8057f5:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8057f9:	74 40                	je     80583b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8057fb:	48 83 c1 01          	add    $0x1,%rcx
+  8057ff:	48 39 c1             	cmp    %rax,%rcx
+  805802:	75 f1                	jne    8057f5 <remove_pgfault_handler+0x35>
+  805804:	eb 74                	jmp    80587a <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805806:	48 b9 6e 69 80 00 00 	movabs $0x80696e,%rcx
+  80580d:	00 00 00 
+  805810:	48 ba 56 68 80 00 00 	movabs $0x806856,%rdx
+  805817:	00 00 00 
+  80581a:	be 48 00 00 00       	mov    $0x48,%esi
+  80581f:	48 bf 48 69 80 00 00 	movabs $0x806948,%rdi
+  805826:	00 00 00 
+  805829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80582e:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  805835:	00 00 00 
+  805838:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80583b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805842:	00 
+  805843:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805847:	48 29 ca             	sub    %rcx,%rdx
+  80584a:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805851:	00 00 00 
+  805854:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805858:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80585d:	48 89 ce             	mov    %rcx,%rsi
+  805860:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  805867:	00 00 00 
+  80586a:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80586c:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805873:	00 00 00 
+  805876:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80587a:	5d                   	pop    %rbp
+  80587b:	c3                   	ret
+
+000000000080587c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80587c:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80587f:	48 b8 f1 55 80 00 00 	movabs $0x8055f1,%rax
+  805886:	00 00 00 
+    call *%rax
+  805889:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  80588b:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805892:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805893:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  80589a:	00 
+    subq $8, %rcx
+  80589b:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80589f:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8058a2:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8058a9:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8058aa:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8058ae:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8058b2:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8058b7:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8058bc:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8058c1:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8058c6:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8058cb:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8058d0:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8058d5:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8058da:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8058df:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8058e4:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8058e9:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8058ee:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8058f3:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8058f8:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8058fc:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805900:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805901:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805902:	c3                   	ret
+
+0000000000805903 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805903:	85 ff                	test   %edi,%edi
+  805905:	78 58                	js     80595f <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805907:	48 85 f6             	test   %rsi,%rsi
+  80590a:	74 12                	je     80591e <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80590c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805913:	00 00 00 
+  805916:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80591c:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80591e:	48 85 c9             	test   %rcx,%rcx
+  805921:	74 12                	je     805935 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805923:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80592a:	00 00 00 
+  80592d:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805933:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805935:	48 85 d2             	test   %rdx,%rdx
+  805938:	74 14                	je     80594e <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80593a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805941:	00 00 00 
+  805944:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80594b:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80594e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805955:	00 00 00 
+  805958:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80595e:	c3                   	ret
+        if (from_env_store) {
+  80595f:	48 85 f6             	test   %rsi,%rsi
+  805962:	74 06                	je     80596a <ipc_result+0x67>
+            *from_env_store = 0;
+  805964:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80596a:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80596c:	48 85 c9             	test   %rcx,%rcx
+  80596f:	74 ed                	je     80595e <ipc_result+0x5b>
+            *perm_store = 0;
+  805971:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805977:	c3                   	ret
+
+0000000000805978 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805978:	55                   	push   %rbp
+  805979:	48 89 e5             	mov    %rsp,%rbp
+  80597c:	41 55                	push   %r13
+  80597e:	41 54                	push   %r12
+  805980:	53                   	push   %rbx
+  805981:	48 83 ec 08          	sub    $0x8,%rsp
+  805985:	49 89 fc             	mov    %rdi,%r12
+  805988:	48 89 f7             	mov    %rsi,%rdi
+  80598b:	48 89 d3             	mov    %rdx,%rbx
+  80598e:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805991:	48 85 f6             	test   %rsi,%rsi
+  805994:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80599b:	00 00 00 
+  80599e:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8059a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8059a7:	48 85 d2             	test   %rdx,%rdx
+  8059aa:	74 03                	je     8059af <ipc_recv+0x37>
+  8059ac:	48 8b 32             	mov    (%rdx),%rsi
+  8059af:	48 b8 39 30 80 00 00 	movabs $0x803039,%rax
+  8059b6:	00 00 00 
+  8059b9:	ff d0                	call   *%rax
+  8059bb:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8059bd:	4c 89 e9             	mov    %r13,%rcx
+  8059c0:	48 89 da             	mov    %rbx,%rdx
+  8059c3:	4c 89 e6             	mov    %r12,%rsi
+  8059c6:	48 b8 03 59 80 00 00 	movabs $0x805903,%rax
+  8059cd:	00 00 00 
+  8059d0:	ff d0                	call   *%rax
+}
+  8059d2:	48 83 c4 08          	add    $0x8,%rsp
+  8059d6:	5b                   	pop    %rbx
+  8059d7:	41 5c                	pop    %r12
+  8059d9:	41 5d                	pop    %r13
+  8059db:	5d                   	pop    %rbp
+  8059dc:	c3                   	ret
+
+00000000008059dd <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8059dd:	55                   	push   %rbp
+  8059de:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8059e1:	48 85 d2             	test   %rdx,%rdx
+  8059e4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8059eb:	00 00 00 
+  8059ee:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8059f2:	89 f6                	mov    %esi,%esi
+  8059f4:	48 b8 c5 2e 80 00 00 	movabs $0x802ec5,%rax
+  8059fb:	00 00 00 
+  8059fe:	ff d0                	call   *%rax
+    if (res < 0) {
+  805a00:	85 c0                	test   %eax,%eax
+  805a02:	78 02                	js     805a06 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805a04:	5d                   	pop    %rbp
+  805a05:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805a06:	89 c1                	mov    %eax,%ecx
+  805a08:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  805a0f:	00 00 00 
+  805a12:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805a17:	48 bf 95 69 80 00 00 	movabs $0x806995,%rdi
+  805a1e:	00 00 00 
+  805a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a26:	49 b8 01 19 80 00 00 	movabs $0x801901,%r8
+  805a2d:	00 00 00 
+  805a30:	41 ff d0             	call   *%r8
+
+0000000000805a33 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805a33:	55                   	push   %rbp
+  805a34:	48 89 e5             	mov    %rsp,%rbp
+  805a37:	53                   	push   %rbx
+  805a38:	48 83 ec 08          	sub    $0x8,%rsp
+  805a3c:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805a40:	48 85 d2             	test   %rdx,%rdx
+  805a43:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a4a:	00 00 00 
+  805a4d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805a51:	4d 85 c9             	test   %r9,%r9
+  805a54:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a5d:	48 85 db             	test   %rbx,%rbx
+  805a60:	74 03                	je     805a65 <ipc_call+0x32>
+  805a62:	48 8b 03             	mov    (%rbx),%rax
+  805a65:	89 f6                	mov    %esi,%esi
+  805a67:	48 83 ec 08          	sub    $0x8,%rsp
+  805a6b:	50                   	push   %rax
+  805a6c:	48 b8 f7 2e 80 00 00 	movabs $0x802ef7,%rax
+  805a73:	00 00 00 
+  805a76:	ff d0                	call   *%rax
+  805a78:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805a7a:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805a7e:	48 89 da             	mov    %rbx,%rdx
+  805a81:	be 00 00 00 00       	mov    $0x0,%esi
+  805a86:	48 b8 03 59 80 00 00 	movabs $0x805903,%rax
+  805a8d:	00 00 00 
+  805a90:	ff d0                	call   *%rax
+}
+  805a92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805a96:	c9                   	leave
+  805a97:	c3                   	ret
+
+0000000000805a98 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805a98:	55                   	push   %rbp
+  805a99:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805a9c:	89 f6                	mov    %esi,%esi
+  805a9e:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  805aa5:	00 00 00 
+  805aa8:	ff d0                	call   *%rax
+  805aaa:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805aac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805ab1:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ab6:	be 00 00 00 00       	mov    $0x0,%esi
+  805abb:	48 b8 03 59 80 00 00 	movabs $0x805903,%rax
+  805ac2:	00 00 00 
+  805ac5:	ff d0                	call   *%rax
+}
+  805ac7:	5d                   	pop    %rbp
+  805ac8:	c3                   	ret
+
+0000000000805ac9 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805ac9:	55                   	push   %rbp
+  805aca:	48 89 e5             	mov    %rsp,%rbp
+  805acd:	41 54                	push   %r12
+  805acf:	53                   	push   %rbx
+  805ad0:	4c 89 cb             	mov    %r9,%rbx
+  805ad3:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805ad7:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805adb:	48 85 d2             	test   %rdx,%rdx
+  805ade:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805ae5:	00 00 00 
+  805ae8:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805aec:	4d 85 c9             	test   %r9,%r9
+  805aef:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805af3:	b8 00 00 00 00       	mov    $0x0,%eax
+  805af8:	4d 85 e4             	test   %r12,%r12
+  805afb:	74 04                	je     805b01 <ipc_reply_wait+0x38>
+  805afd:	49 8b 04 24          	mov    (%r12),%rax
+  805b01:	89 f6                	mov    %esi,%esi
+  805b03:	48 83 ec 08          	sub    $0x8,%rsp
+  805b07:	50                   	push   %rax
+  805b08:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  805b0f:	00 00 00 
+  805b12:	ff d0                	call   *%rax
+  805b14:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805b16:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805b1a:	4c 89 e2             	mov    %r12,%rdx
+  805b1d:	48 89 de             	mov    %rbx,%rsi
+  805b20:	48 b8 03 59 80 00 00 	movabs $0x805903,%rax
+  805b27:	00 00 00 
+  805b2a:	ff d0                	call   *%rax
+}
+  805b2c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805b30:	5b                   	pop    %rbx
+  805b31:	41 5c                	pop    %r12
+  805b33:	5d                   	pop    %rbp
+  805b34:	c3                   	ret
+
+0000000000805b35 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805b35:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805b3a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805b41:	00 00 00 
+  805b44:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805b4b:	48 01 ca             	add    %rcx,%rdx
+  805b4e:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805b54:	39 fa                	cmp    %edi,%edx
+  805b56:	74 12                	je     805b6a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805b58:	48 83 c0 01          	add    $0x1,%rax
+  805b5c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805b62:	75 e0                	jne    805b44 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805b64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b69:	c3                   	ret
+            return envs[i].env_id;
+  805b6a:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805b71:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805b78:	00 00 00 
+  805b7b:	48 01 d0             	add    %rdx,%rax
+  805b7e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805b84:	c3                   	ret
+  805b85:	0f 1f 00             	nopl   (%rax)
+
+0000000000805b88 <__rodata_start>:
+  805b88:	77 00                	ja     805b8a <__rodata_start+0x2>
+  805b8a:	72 62                	jb     805bee <__rodata_start+0x66>
+  805b8c:	00 77 62             	add    %dh,0x62(%rdi)
+  805b8f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805b92:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805b99:	00 
+  805b9a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  805ba0:	b3 09                	mov    $0x9,%bl
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 ed                	add    %ch,%ch
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	ed                   	in     (%dx),%eax
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ed                   	in     (%dx),%eax
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 ed                	add    %ch,%ch
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	ed                   	in     (%dx),%eax
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ed                   	in     (%dx),%eax
+  805be1:	0d 80 00 00 00       	or     $0x80,%eax
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	ed                   	in     (%dx),%eax
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	8c 0a                	mov    %cs,(%rdx)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	8c 0a                	mov    %cs,(%rdx)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	8c 0a                	mov    %cs,(%rdx)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	8c 0a                	mov    %cs,(%rdx)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	8c 0a                	mov    %cs,(%rdx)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c46:	00 00                	add    %al,(%rax)
+  805c48:	ed                   	in     (%dx),%eax
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	ed                   	in     (%dx),%eax
+  805c59:	0d 80 00 00 00       	or     $0x80,%eax
+  805c5e:	00 00                	add    %al,(%rax)
+  805c60:	ed                   	in     (%dx),%eax
+  805c61:	0d 80 00 00 00       	or     $0x80,%eax
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	ed                   	in     (%dx),%eax
+  805c69:	0d 80 00 00 00       	or     $0x80,%eax
+  805c6e:	00 00                	add    %al,(%rax)
+  805c70:	ed                   	in     (%dx),%eax
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	ed                   	in     (%dx),%eax
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ed                   	in     (%dx),%eax
+  805c81:	0d 80 00 00 00       	or     $0x80,%eax
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	ed                   	in     (%dx),%eax
+  805c99:	0d 80 00 00 00       	or     $0x80,%eax
+  805c9e:	00 00                	add    %al,(%rax)
+  805ca0:	ed                   	in     (%dx),%eax
+  805ca1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	ed                   	in     (%dx),%eax
+  805ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cae:	00 00                	add    %al,(%rax)
+  805cb0:	ed                   	in     (%dx),%eax
+  805cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	ed                   	in     (%dx),%eax
+  805cb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cbe:	00 00                	add    %al,(%rax)
+  805cc0:	ed                   	in     (%dx),%eax
+  805cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cc6:	00 00                	add    %al,(%rax)
+  805cc8:	ed                   	in     (%dx),%eax
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	ed                   	in     (%dx),%eax
+  805cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	ed                   	in     (%dx),%eax
+  805cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cde:	00 00                	add    %al,(%rax)
+  805ce0:	ed                   	in     (%dx),%eax
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	ed                   	in     (%dx),%eax
+  805ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cee:	00 00                	add    %al,(%rax)
+  805cf0:	ed                   	in     (%dx),%eax
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	ed                   	in     (%dx),%eax
+  805d19:	0d 80 00 00 00       	or     $0x80,%eax
+  805d1e:	00 00                	add    %al,(%rax)
+  805d20:	ed                   	in     (%dx),%eax
+  805d21:	0d 80 00 00 00       	or     $0x80,%eax
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	ed                   	in     (%dx),%eax
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	ed                   	in     (%dx),%eax
+  805d31:	0d 80 00 00 00       	or     $0x80,%eax
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	f4                   	hlt
+  805d39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d3f:	00 ed                	add    %ch,%ch
+  805d41:	0d 80 00 00 00       	or     $0x80,%eax
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	ed                   	in     (%dx),%eax
+  805d49:	0d 80 00 00 00       	or     $0x80,%eax
+  805d4e:	00 00                	add    %al,(%rax)
+  805d50:	2c 0b                	sub    $0xb,%al
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 ed                	add    %ch,%ch
+  805d59:	0d 80 00 00 00       	or     $0x80,%eax
+  805d5e:	00 00                	add    %al,(%rax)
+  805d60:	ed                   	in     (%dx),%eax
+  805d61:	0d 80 00 00 00       	or     $0x80,%eax
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	ed                   	in     (%dx),%eax
+  805d71:	0d 80 00 00 00       	or     $0x80,%eax
+  805d76:	00 00                	add    %al,(%rax)
+  805d78:	ed                   	in     (%dx),%eax
+  805d79:	0d 80 00 00 00       	or     $0x80,%eax
+  805d7e:	00 00                	add    %al,(%rax)
+  805d80:	ed                   	in     (%dx),%eax
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805d93:	00 00                	add    %al,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 cb                	add    %cl,%bl
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ed                   	in     (%dx),%eax
+  805da1:	0d 80 00 00 00       	or     $0x80,%eax
+  805da6:	00 00                	add    %al,(%rax)
+  805da8:	ed                   	in     (%dx),%eax
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	6a 0a                	push   $0xa
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 ed                	add    %ch,%ch
+  805dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dce:	00 00                	add    %al,(%rax)
+  805dd0:	ed                   	in     (%dx),%eax
+  805dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dd6:	00 00                	add    %al,(%rax)
+  805dd8:	3c 0a                	cmp    $0xa,%al
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 ed                	add    %ch,%ch
+  805de1:	0d 80 00 00 00       	or     $0x80,%eax
+  805de6:	00 00                	add    %al,(%rax)
+  805de8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805deb:	00 00                	add    %al,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 29                	add    %ch,(%rcx)
+  805df9:	0c 80                	or     $0x80,%al
+  805dfb:	00 00                	add    %al,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 ed                	add    %ch,%ch
+  805e09:	0d 80 00 00 00       	or     $0x80,%eax
+  805e0e:	00 00                	add    %al,(%rax)
+  805e10:	1a 0b                	sbb    (%rbx),%cl
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 ed                	add    %ch,%ch
+  805e19:	0d 80 00 00 00       	or     $0x80,%eax
+  805e1e:	00 00                	add    %al,(%rax)
+  805e20:	ce                   	(bad)
+  805e21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e27:	00 ed                	add    %ch,%ch
+  805e29:	0d 80 00 00 00       	or     $0x80,%eax
+  805e2e:	00 00                	add    %al,(%rax)
+  805e30:	ed                   	in     (%dx),%eax
+  805e31:	0d 80 00 00 00       	or     $0x80,%eax
+  805e36:	00 00                	add    %al,(%rax)
+  805e38:	f4                   	hlt
+  805e39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e3f:	00 37                	add    %dh,(%rdi)
+  805e41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 37                	add    %dh,(%rdi)
+  805e51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805e6b:	00 00                	add    %al,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 d2                	add    %dl,%dl
+  805e71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e77:	00 d2                	add    %dl,%dl
+  805e79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e7f:	00 d2                	add    %dl,%dl
+  805e81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e87:	00 d2                	add    %dl,%dl
+  805e89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e8f:	00 d2                	add    %dl,%dl
+  805e91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e97:	00 d2                	add    %dl,%dl
+  805e99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e9f:	00 d2                	add    %dl,%dl
+  805ea1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ea7:	00 f6                	add    %dh,%dh
+  805ea9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eaf:	00 f6                	add    %dh,%dh
+  805eb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ed2:	80 00 00             	addb   $0x0,(%rax)
+  805ed5:	00 00                	add    %al,(%rax)
+  805ed7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 22                	add    %ah,(%rdx)
+  805ef1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ef7:	00 22                	add    %ah,(%rdx)
+  805ef9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805eff:	00 22                	add    %ah,(%rdx)
+  805f01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f07:	00 22                	add    %ah,(%rdx)
+  805f09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f0f:	00 22                	add    %ah,(%rdx)
+  805f11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f17:	00 22                	add    %ah,(%rdx)
+  805f19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f2a:	80 00 00             	addb   $0x0,(%rax)
+  805f2d:	00 00                	add    %al,(%rax)
+  805f2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f32:	80 00 00             	addb   $0x0,(%rax)
+  805f35:	00 00                	add    %al,(%rax)
+  805f37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f3a:	80 00 00             	addb   $0x0,(%rax)
+  805f3d:	00 00                	add    %al,(%rax)
+  805f3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f42:	80 00 00             	addb   $0x0,(%rax)
+  805f45:	00 00                	add    %al,(%rax)
+  805f47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f4a:	80 00 00             	addb   $0x0,(%rax)
+  805f4d:	00 00                	add    %al,(%rax)
+  805f4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f52:	80 00 00             	addb   $0x0,(%rax)
+  805f55:	00 00                	add    %al,(%rax)
+  805f57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f5a:	80 00 00             	addb   $0x0,(%rax)
+  805f5d:	00 00                	add    %al,(%rax)
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f72:	80 00 00             	addb   $0x0,(%rax)
+  805f75:	00 00                	add    %al,(%rax)
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f8a:	80 00 00             	addb   $0x0,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f92:	80 00 00             	addb   $0x0,(%rax)
+  805f95:	00 00                	add    %al,(%rax)
+  805f97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f9a:	80 00 00             	addb   $0x0,(%rax)
+  805f9d:	00 00                	add    %al,(%rax)
+  805f9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fa2:	80 00 00             	addb   $0x0,(%rax)
+  805fa5:	00 00                	add    %al,(%rax)
+  805fa7:	00 46 12             	add    %al,0x12(%rsi)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fb2:	80 00 00             	addb   $0x0,(%rax)
+  805fb5:	00 00                	add    %al,(%rax)
+  805fb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fba:	80 00 00             	addb   $0x0,(%rax)
+  805fbd:	00 00                	add    %al,(%rax)
+  805fbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fc2:	80 00 00             	addb   $0x0,(%rax)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fd2:	80 00 00             	addb   $0x0,(%rax)
+  805fd5:	00 00                	add    %al,(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 22                	add    %ah,(%rdx)
+  805ff1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ff7:	00 22                	add    %ah,(%rdx)
+  805ff9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fff:	00 22                	add    %ah,(%rdx)
+  806001:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806007:	00 22                	add    %ah,(%rdx)
+  806009:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80600f:	00 22                	add    %ah,(%rdx)
+  806011:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806017:	00 22                	add    %ah,(%rdx)
+  806019:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80601f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 5f 12             	add    %bl,0x12(%rdi)
+  80602a:	80 00 00             	addb   $0x0,(%rax)
+  80602d:	00 00                	add    %al,(%rax)
+  80602f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806032:	80 00 00             	addb   $0x0,(%rax)
+  806035:	00 00                	add    %al,(%rax)
+  806037:	00 5f 12             	add    %bl,0x12(%rdi)
+  80603a:	80 00 00             	addb   $0x0,(%rax)
+  80603d:	00 00                	add    %al,(%rax)
+  80603f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806042:	80 00 00             	addb   $0x0,(%rax)
+  806045:	00 00                	add    %al,(%rax)
+  806047:	00 5f 12             	add    %bl,0x12(%rdi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806052:	80 00 00             	addb   $0x0,(%rax)
+  806055:	00 00                	add    %al,(%rax)
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 5f 12             	add    %bl,0x12(%rdi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806092:	80 00 00             	addb   $0x0,(%rax)
+  806095:	00 00                	add    %al,(%rax)
+  806097:	00 5f 12             	add    %bl,0x12(%rdi)
+  80609a:	80 00 00             	addb   $0x0,(%rax)
+  80609d:	00 00                	add    %al,(%rax)
+  80609f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060a2:	80 00 00             	addb   $0x0,(%rax)
+  8060a5:	00 00                	add    %al,(%rax)
+  8060a7:	00 46 12             	add    %al,0x12(%rsi)
+  8060aa:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+00000000008060c0 <basefix.0>:
+  8060c0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  8060d0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  8060e0:	10 00 66 0f 1f 44 00 00 70 72 69 6d 65 70 72 6f     ..f..D..primepro
+  8060f0:	63 20 63 6f 75 6c 64 20 6e 6f 74 20 72 65 61 64     c could not read
+  806100:	20 69 6e 69 74 69 61 6c 20 70 72 69 6d 65 3a 20      initial prime: 
+  806110:	25 64 2c 20 25 69 00 75 73 65 72 2f 70 72 69 6d     %d, %i.user/prim
+  806120:	65 73 70 69 70 65 2e 63 00 25 64 0a 00 70 69 70     espipe.c.%d..pip
+  806130:	65 3a 20 25 69 00 70 72 69 6d 65 70 72 6f 63 20     e: %i.primeproc 
+  806140:	25 64 20 72 65 61 64 6e 20 25 64 20 25 64 20 25     %d readn %d %d %
+  806150:	69 00 70 72 69 6d 65 70 72 6f 63 20 25 64 20 77     i.primeproc %d w
+  806160:	72 69 74 65 3a 20 25 64 20 25 69 00 70 72 69 6d     rite: %d %i.prim
+  806170:	65 73 70 69 70 65 00 67 65 6e 65 72 61 74 6f 72     espipe.generator
+  806180:	20 77 72 69 74 65 3a 20 25 64 2c 20 25 69 00 3c      write: %d, %i.<
+  806190:	75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 80 00 00 00 00     unknown>........
+  8061a0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8061b0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8061c0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  8061d0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  8061e0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  8061f0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806200:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806210:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806220:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806230:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806240:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806250:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806260:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806270:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806280:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806290:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8062a0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8062b0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8062c0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8062d0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  8062e0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  8062f0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806300:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806310:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806320:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806330:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806340:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806350:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  806360:	49 1c 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     I........"......
+  806370:	90 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806380:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806390:	a0 22 80 00 00 00 00 00 68 1c 80 00 00 00 00 00     ."......h.......
+  8063a0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8063b0:	5c 1c 80 00 00 00 00 00 d6 1c 80 00 00 00 00 00     \...............
+  8063c0:	a0 22 80 00 00 00 00 00 5c 1c 80 00 00 00 00 00     ."......\.......
+  8063d0:	a2 1c 80 00 00 00 00 00 a2 1c 80 00 00 00 00 00     ................
+  8063e0:	a2 1c 80 00 00 00 00 00 a2 1c 80 00 00 00 00 00     ................
+  8063f0:	a2 1c 80 00 00 00 00 00 a2 1c 80 00 00 00 00 00     ................
+  806400:	a2 1c 80 00 00 00 00 00 a2 1c 80 00 00 00 00 00     ................
+  806410:	a2 1c 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ........."......
+  806420:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806430:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806440:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806450:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806460:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806470:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806480:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806490:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8064a0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8064b0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8064c0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8064d0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8064e0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8064f0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806500:	a0 22 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .".......!......
+  806510:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806520:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806530:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806540:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806550:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806560:	04 1d 80 00 00 00 00 00 d3 1e 80 00 00 00 00 00     ................
+  806570:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  806580:	a0 22 80 00 00 00 00 00 f9 1c 80 00 00 00 00 00     ."..............
+  806590:	33 1d 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     3........"......
+  8065a0:	a0 22 80 00 00 00 00 00 ee 1c 80 00 00 00 00 00     ."..............
+  8065b0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8065c0:	7c 20 80 00 00 00 00 00 4b 21 80 00 00 00 00 00     | ......K!......
+  8065d0:	a0 22 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ."......."......
+  8065e0:	ca 1d 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ........."......
+  8065f0:	a7 1f 80 00 00 00 00 00 a0 22 80 00 00 00 00 00     ........."......
+  806600:	a0 22 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .".......!......
+  806610:	a0 22 80 00 00 00 00 00 52 1c 80 00 00 00 00 00     ."......R.......
+
+0000000000806620 <error_string>:
+	...
+  806628:	f5 61 80 00 00 00 00 00 07 62 80 00 00 00 00 00     .a.......b......
+  806638:	17 62 80 00 00 00 00 00 29 62 80 00 00 00 00 00     .b......)b......
+  806648:	37 62 80 00 00 00 00 00 4b 62 80 00 00 00 00 00     7b......Kb......
+  806658:	60 62 80 00 00 00 00 00 73 62 80 00 00 00 00 00     `b......sb......
+  806668:	85 62 80 00 00 00 00 00 99 62 80 00 00 00 00 00     .b.......b......
+  806678:	a9 62 80 00 00 00 00 00 bc 62 80 00 00 00 00 00     .b.......b......
+  806688:	d3 62 80 00 00 00 00 00 e9 62 80 00 00 00 00 00     .b.......b......
+  806698:	01 63 80 00 00 00 00 00 19 63 80 00 00 00 00 00     .c.......c......
+  8066a8:	26 63 80 00 00 00 00 00 c0 66 80 00 00 00 00 00     &c.......f......
+  8066b8:	3a 63 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     :c......file is 
+  8066c8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8066d8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8066e8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8066f8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806708:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806718:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806728:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806738:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806748:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806758:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806768:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806778:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806788:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806798:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8067a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8067b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8067c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8067d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8067e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8067f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806808:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806818:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806820 <devtab>:
+  806820:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806830:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806840:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806850:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806860:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806870:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806880:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806890:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8068a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8068b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8068c0:	63 00 66 0f 1f 44 00 00 73 79 73 5f 72 65 67 69     c.f..D..sys_regi
+  8068d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8068e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8068f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806900:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806910:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806920:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806930:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806940:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806950:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806960:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806970:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806980:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806990:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,10572 @@
+
+obj/user/sendpage:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 02 23 80 00 00 	movabs $0x802302,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 76 38 80 00 00 	movabs $0x803876,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 76 38 80 00 00 	movabs $0x803876,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 44 18 80 00 00 	movabs $0x801844,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be fc 60 80 00 00 	movabs $0x8060fc,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 a1 22 80 00 00 	movabs $0x8022a1,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 df 3f 80 00 00 	movabs $0x803fdf,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 80 5a 80 00 00 	movabs $0x805a80,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 a1 22 80 00 00 	movabs $0x8022a1,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 df 3f 80 00 00 	movabs $0x803fdf,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 82 5a 80 00 00 	movabs $0x805a82,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 a1 22 80 00 00 	movabs $0x8022a1,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 df 3f 80 00 00 	movabs $0x803fdf,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 85 5a 80 00 00 	movabs $0x805a85,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 a1 22 80 00 00 	movabs $0x8022a1,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 df 3f 80 00 00 	movabs $0x803fdf,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 4a 50 80 00 00 	movabs $0x80504a,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 21 53 80 00 00 	movabs $0x805321,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 c9 35 80 00 00 	movabs $0x8035c9,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 60 39 80 00 00 	movabs $0x803960,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 29 3a 80 00 00 	movabs $0x803a29,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 2f 39 80 00 00 	movabs $0x80392f,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 2f 39 80 00 00 	movabs $0x80392f,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 47 37 80 00 00 	movabs $0x803747,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 76 38 80 00 00 	movabs $0x803876,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 df 3f 80 00 00 	movabs $0x803fdf,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 c9 35 80 00 00 	movabs $0x8035c9,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 4e 24 80 00 00 	movabs $0x80244e,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be a0 5a 80 00 00 	movabs $0x805aa0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 4e 24 80 00 00 	movabs $0x80244e,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 4e 24 80 00 00 	movabs $0x80244e,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 40 5d 80 00 00 	movabs $0x805d40,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 4e 24 80 00 00 	movabs $0x80244e,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 4e 24 80 00 00 	movabs $0x80244e,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 c0 5f 80 00 00 	movabs $0x805fc0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 c0 5f 80 00 00 	movabs $0x805fc0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a6 26 80 00 00 	movabs $0x8026a6,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a6 26 80 00 00 	movabs $0x8026a6,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 30 02 00 00       	call   80172f <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+
+#define TEMP_ADDR       ((char *)0xa00000)
+#define TEMP_ADDR_CHILD ((char *)0xb00000)
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 54                	push   %r12
+  801507:	53                   	push   %rbx
+  801508:	48 83 ec 20          	sub    $0x20,%rsp
+    envid_t who;
+
+    if ((who = fork()) == 0) {
+  80150c:	48 b8 a2 2f 80 00 00 	movabs $0x802fa2,%rax
+  801513:	00 00 00 
+  801516:	ff d0                	call   *%rax
+  801518:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80151b:	85 c0                	test   %eax,%eax
+  80151d:	0f 84 02 01 00 00    	je     801625 <umain+0x124>
+        ipc_send(who, 0, TEMP_ADDR_CHILD, PAGE_SIZE, PROT_RW);
+        return;
+    }
+
+    /* Parent */
+    sys_alloc_region(thisenv->env_id, TEMP_ADDR, PAGE_SIZE, PROT_RW);
+  801523:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80152a:	00 00 00 
+  80152d:	8b b8 c8 00 00 00    	mov    0xc8(%rax),%edi
+  801533:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801538:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80153d:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  801542:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  801549:	00 00 00 
+  80154c:	ff d0                	call   *%rax
+    memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  80154e:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  801555:	00 00 00 
+  801558:	48 8b 3b             	mov    (%rbx),%rdi
+  80155b:	49 bc a1 21 80 00 00 	movabs $0x8021a1,%r12
+  801562:	00 00 00 
+  801565:	41 ff d4             	call   *%r12
+  801568:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80156c:	48 8b 33             	mov    (%rbx),%rsi
+  80156f:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  801574:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  80157b:	00 00 00 
+  80157e:	ff d0                	call   *%rax
+    ipc_send(who, 0, TEMP_ADDR, PAGE_SIZE, PROT_RW);
+  801580:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801586:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80158b:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  801590:	be 00 00 00 00       	mov    $0x0,%esi
+  801595:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  801598:	48 b8 2e 32 80 00 00 	movabs $0x80322e,%rax
+  80159f:	00 00 00 
+  8015a2:	ff d0                	call   *%rax
+
+    size_t sz = PAGE_SIZE;
+  8015a4:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8015ab:	00 
+    ipc_recv(&who, TEMP_ADDR, &sz, 0);
+  8015ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8015b5:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  8015ba:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8015be:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  8015c5:	00 00 00 
+  8015c8:	ff d0                	call   *%rax
+    cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  8015ca:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  8015cf:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8015d2:	48 bf e2 5f 80 00 00 	movabs $0x805fe2,%rdi
+  8015d9:	00 00 00 
+  8015dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e1:	48 b9 a8 18 80 00 00 	movabs $0x8018a8,%rcx
+  8015e8:	00 00 00 
+  8015eb:	ff d1                	call   *%rcx
+    if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8015ed:	48 bb 38 70 80 00 00 	movabs $0x807038,%rbx
+  8015f4:	00 00 00 
+  8015f7:	48 8b 3b             	mov    (%rbx),%rdi
+  8015fa:	41 ff d4             	call   *%r12
+  8015fd:	48 89 c2             	mov    %rax,%rdx
+  801600:	48 8b 33             	mov    (%rbx),%rsi
+  801603:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  801608:	48 b8 c4 22 80 00 00 	movabs $0x8022c4,%rax
+  80160f:	00 00 00 
+  801612:	ff d0                	call   *%rax
+  801614:	85 c0                	test   %eax,%eax
+  801616:	0f 84 f8 00 00 00    	je     801714 <umain+0x213>
+        cprintf("parent received correct message\n");
+    return;
+}
+  80161c:	48 83 c4 20          	add    $0x20,%rsp
+  801620:	5b                   	pop    %rbx
+  801621:	41 5c                	pop    %r12
+  801623:	5d                   	pop    %rbp
+  801624:	c3                   	ret
+        size_t sz = PAGE_SIZE;
+  801625:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80162c:	00 
+        ipc_recv(&who, TEMP_ADDR_CHILD, &sz, 0);
+  80162d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801632:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801636:	be 00 00 b0 00       	mov    $0xb00000,%esi
+  80163b:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  80163f:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  801646:	00 00 00 
+  801649:	ff d0                	call   *%rax
+        cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  80164b:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  801650:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  801653:	48 bf e2 5f 80 00 00 	movabs $0x805fe2,%rdi
+  80165a:	00 00 00 
+  80165d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801662:	48 b9 a8 18 80 00 00 	movabs $0x8018a8,%rcx
+  801669:	00 00 00 
+  80166c:	ff d1                	call   *%rcx
+        if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  80166e:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  801675:	00 00 00 
+  801678:	48 8b 3b             	mov    (%rbx),%rdi
+  80167b:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  801682:	00 00 00 
+  801685:	ff d0                	call   *%rax
+  801687:	48 89 c2             	mov    %rax,%rdx
+  80168a:	48 8b 33             	mov    (%rbx),%rsi
+  80168d:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  801692:	48 b8 c4 22 80 00 00 	movabs $0x8022c4,%rax
+  801699:	00 00 00 
+  80169c:	ff d0                	call   *%rax
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	74 5a                	je     8016fc <umain+0x1fb>
+        memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  8016a2:	48 bb 38 70 80 00 00 	movabs $0x807038,%rbx
+  8016a9:	00 00 00 
+  8016ac:	48 8b 3b             	mov    (%rbx),%rdi
+  8016af:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8016b6:	00 00 00 
+  8016b9:	ff d0                	call   *%rax
+  8016bb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016bf:	48 8b 33             	mov    (%rbx),%rsi
+  8016c2:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  8016c7:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  8016ce:	00 00 00 
+  8016d1:	ff d0                	call   *%rax
+        ipc_send(who, 0, TEMP_ADDR_CHILD, PAGE_SIZE, PROT_RW);
+  8016d3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8016d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8016de:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  8016e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e8:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  8016eb:	48 b8 2e 32 80 00 00 	movabs $0x80322e,%rax
+  8016f2:	00 00 00 
+  8016f5:	ff d0                	call   *%rax
+        return;
+  8016f7:	e9 20 ff ff ff       	jmp    80161c <umain+0x11b>
+            cprintf("child received correct message\n");
+  8016fc:	48 bf f8 5f 80 00 00 	movabs $0x805ff8,%rdi
+  801703:	00 00 00 
+  801706:	48 ba a8 18 80 00 00 	movabs $0x8018a8,%rdx
+  80170d:	00 00 00 
+  801710:	ff d2                	call   *%rdx
+  801712:	eb 8e                	jmp    8016a2 <umain+0x1a1>
+        cprintf("parent received correct message\n");
+  801714:	48 bf 18 60 80 00 00 	movabs $0x806018,%rdi
+  80171b:	00 00 00 
+  80171e:	48 ba a8 18 80 00 00 	movabs $0x8018a8,%rdx
+  801725:	00 00 00 
+  801728:	ff d2                	call   *%rdx
+  80172a:	e9 ed fe ff ff       	jmp    80161c <umain+0x11b>
+
+000000000080172f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80172f:	55                   	push   %rbp
+  801730:	48 89 e5             	mov    %rsp,%rbp
+  801733:	41 56                	push   %r14
+  801735:	41 55                	push   %r13
+  801737:	41 54                	push   %r12
+  801739:	53                   	push   %rbx
+  80173a:	41 89 fd             	mov    %edi,%r13d
+  80173d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801740:	48 ba 18 71 80 00 00 	movabs $0x807118,%rdx
+  801747:	00 00 00 
+  80174a:	48 b8 18 71 80 00 00 	movabs $0x807118,%rax
+  801751:	00 00 00 
+  801754:	48 39 c2             	cmp    %rax,%rdx
+  801757:	73 17                	jae    801770 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801759:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80175c:	49 89 c4             	mov    %rax,%r12
+  80175f:	48 83 c3 08          	add    $0x8,%rbx
+  801763:	b8 00 00 00 00       	mov    $0x0,%eax
+  801768:	ff 53 f8             	call   *-0x8(%rbx)
+  80176b:	4c 39 e3             	cmp    %r12,%rbx
+  80176e:	72 ef                	jb     80175f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801770:	48 b8 6c 28 80 00 00 	movabs $0x80286c,%rax
+  801777:	00 00 00 
+  80177a:	ff d0                	call   *%rax
+  80177c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801781:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801788:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80178f:	00 00 00 
+  801792:	48 01 d0             	add    %rdx,%rax
+  801795:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80179c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80179f:	45 85 ed             	test   %r13d,%r13d
+  8017a2:	7e 0d                	jle    8017b1 <libmain+0x82>
+  8017a4:	49 8b 06             	mov    (%r14),%rax
+  8017a7:	48 a3 48 70 80 00 00 	movabs %rax,0x807048
+  8017ae:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8017b1:	4c 89 f6             	mov    %r14,%rsi
+  8017b4:	44 89 ef             	mov    %r13d,%edi
+  8017b7:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8017be:	00 00 00 
+  8017c1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8017c3:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  8017ca:	00 00 00 
+  8017cd:	ff d0                	call   *%rax
+#endif
+}
+  8017cf:	5b                   	pop    %rbx
+  8017d0:	41 5c                	pop    %r12
+  8017d2:	41 5d                	pop    %r13
+  8017d4:	41 5e                	pop    %r14
+  8017d6:	5d                   	pop    %rbp
+  8017d7:	c3                   	ret
+
+00000000008017d8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8017d8:	55                   	push   %rbp
+  8017d9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8017dc:	48 b8 fc 35 80 00 00 	movabs $0x8035fc,%rax
+  8017e3:	00 00 00 
+  8017e6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8017e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ed:	48 b8 fb 27 80 00 00 	movabs $0x8027fb,%rax
+  8017f4:	00 00 00 
+  8017f7:	ff d0                	call   *%rax
+}
+  8017f9:	5d                   	pop    %rbp
+  8017fa:	c3                   	ret
+
+00000000008017fb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8017fb:	55                   	push   %rbp
+  8017fc:	48 89 e5             	mov    %rsp,%rbp
+  8017ff:	53                   	push   %rbx
+  801800:	48 83 ec 08          	sub    $0x8,%rsp
+  801804:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801807:	8b 06                	mov    (%rsi),%eax
+  801809:	8d 50 01             	lea    0x1(%rax),%edx
+  80180c:	89 16                	mov    %edx,(%rsi)
+  80180e:	48 98                	cltq
+  801810:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801815:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80181b:	74 0a                	je     801827 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80181d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801821:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801827:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80182b:	be ff 00 00 00       	mov    $0xff,%esi
+  801830:	48 b8 5c 27 80 00 00 	movabs $0x80275c,%rax
+  801837:	00 00 00 
+  80183a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80183c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801842:	eb d9                	jmp    80181d <putch+0x22>
+
+0000000000801844 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801844:	55                   	push   %rbp
+  801845:	48 89 e5             	mov    %rsp,%rbp
+  801848:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80184f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801852:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801859:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80185e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801863:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801866:	48 89 f1             	mov    %rsi,%rcx
+  801869:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801870:	48 bf fb 17 80 00 00 	movabs $0x8017fb,%rdi
+  801877:	00 00 00 
+  80187a:	48 b8 f8 19 80 00 00 	movabs $0x8019f8,%rax
+  801881:	00 00 00 
+  801884:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801886:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80188d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801894:	48 b8 5c 27 80 00 00 	movabs $0x80275c,%rax
+  80189b:	00 00 00 
+  80189e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8018a0:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+
+00000000008018a8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8018a8:	55                   	push   %rbp
+  8018a9:	48 89 e5             	mov    %rsp,%rbp
+  8018ac:	48 83 ec 50          	sub    $0x50,%rsp
+  8018b0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8018b4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8018b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018bc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018c0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8018c4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8018cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018d3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8018db:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8018df:	48 b8 44 18 80 00 00 	movabs $0x801844,%rax
+  8018e6:	00 00 00 
+  8018e9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8018eb:	c9                   	leave
+  8018ec:	c3                   	ret
+
+00000000008018ed <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8018ed:	55                   	push   %rbp
+  8018ee:	48 89 e5             	mov    %rsp,%rbp
+  8018f1:	41 57                	push   %r15
+  8018f3:	41 56                	push   %r14
+  8018f5:	41 55                	push   %r13
+  8018f7:	41 54                	push   %r12
+  8018f9:	53                   	push   %rbx
+  8018fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8018fe:	49 89 fc             	mov    %rdi,%r12
+  801901:	49 89 f5             	mov    %rsi,%r13
+  801904:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801908:	8b 45 10             	mov    0x10(%rbp),%eax
+  80190b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80190e:	41 89 cf             	mov    %ecx,%r15d
+  801911:	4c 39 fa             	cmp    %r15,%rdx
+  801914:	73 5b                	jae    801971 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801916:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80191a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80191e:	85 db                	test   %ebx,%ebx
+  801920:	7e 0e                	jle    801930 <print_num+0x43>
+            putch(padc, put_arg);
+  801922:	4c 89 ee             	mov    %r13,%rsi
+  801925:	44 89 f7             	mov    %r14d,%edi
+  801928:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80192b:	83 eb 01             	sub    $0x1,%ebx
+  80192e:	75 f2                	jne    801922 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801930:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801934:	48 b9 a9 60 80 00 00 	movabs $0x8060a9,%rcx
+  80193b:	00 00 00 
+  80193e:	48 b8 98 60 80 00 00 	movabs $0x806098,%rax
+  801945:	00 00 00 
+  801948:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80194c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801950:	ba 00 00 00 00       	mov    $0x0,%edx
+  801955:	49 f7 f7             	div    %r15
+  801958:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80195c:	4c 89 ee             	mov    %r13,%rsi
+  80195f:	41 ff d4             	call   *%r12
+}
+  801962:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801966:	5b                   	pop    %rbx
+  801967:	41 5c                	pop    %r12
+  801969:	41 5d                	pop    %r13
+  80196b:	41 5e                	pop    %r14
+  80196d:	41 5f                	pop    %r15
+  80196f:	5d                   	pop    %rbp
+  801970:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801971:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801975:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197a:	49 f7 f7             	div    %r15
+  80197d:	48 83 ec 08          	sub    $0x8,%rsp
+  801981:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801985:	52                   	push   %rdx
+  801986:	45 0f be c9          	movsbl %r9b,%r9d
+  80198a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80198e:	48 89 c2             	mov    %rax,%rdx
+  801991:	48 b8 ed 18 80 00 00 	movabs $0x8018ed,%rax
+  801998:	00 00 00 
+  80199b:	ff d0                	call   *%rax
+  80199d:	48 83 c4 10          	add    $0x10,%rsp
+  8019a1:	eb 8d                	jmp    801930 <print_num+0x43>
+
+00000000008019a3 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8019a3:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8019a7:	48 8b 06             	mov    (%rsi),%rax
+  8019aa:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8019ae:	73 0a                	jae    8019ba <sprintputch+0x17>
+        *state->start++ = ch;
+  8019b0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019b4:	48 89 16             	mov    %rdx,(%rsi)
+  8019b7:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8019ba:	c3                   	ret
+
+00000000008019bb <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8019bb:	55                   	push   %rbp
+  8019bc:	48 89 e5             	mov    %rsp,%rbp
+  8019bf:	48 83 ec 50          	sub    $0x50,%rsp
+  8019c3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019c7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019cb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8019cf:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8019d6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019de:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019e2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8019e6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8019ea:	48 b8 f8 19 80 00 00 	movabs $0x8019f8,%rax
+  8019f1:	00 00 00 
+  8019f4:	ff d0                	call   *%rax
+}
+  8019f6:	c9                   	leave
+  8019f7:	c3                   	ret
+
+00000000008019f8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8019f8:	55                   	push   %rbp
+  8019f9:	48 89 e5             	mov    %rsp,%rbp
+  8019fc:	41 57                	push   %r15
+  8019fe:	41 56                	push   %r14
+  801a00:	41 55                	push   %r13
+  801a02:	41 54                	push   %r12
+  801a04:	53                   	push   %rbx
+  801a05:	48 83 ec 38          	sub    $0x38,%rsp
+  801a09:	49 89 fe             	mov    %rdi,%r14
+  801a0c:	49 89 f5             	mov    %rsi,%r13
+  801a0f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801a12:	48 8b 01             	mov    (%rcx),%rax
+  801a15:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801a19:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801a1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a21:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801a25:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801a29:	eb 0d                	jmp    801a38 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801a2b:	40 0f b6 ff          	movzbl %dil,%edi
+  801a2f:	4c 89 ee             	mov    %r13,%rsi
+  801a32:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801a35:	4c 89 e3             	mov    %r12,%rbx
+  801a38:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801a3c:	0f b6 3b             	movzbl (%rbx),%edi
+  801a3f:	40 80 ff 25          	cmp    $0x25,%dil
+  801a43:	74 14                	je     801a59 <vprintfmt+0x61>
+            if (!ch) return;
+  801a45:	40 84 ff             	test   %dil,%dil
+  801a48:	75 e1                	jne    801a2b <vprintfmt+0x33>
+}
+  801a4a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a4e:	5b                   	pop    %rbx
+  801a4f:	41 5c                	pop    %r12
+  801a51:	41 5d                	pop    %r13
+  801a53:	41 5e                	pop    %r14
+  801a55:	41 5f                	pop    %r15
+  801a57:	5d                   	pop    %rbp
+  801a58:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801a59:	be 00 00 00 00       	mov    $0x0,%esi
+  801a5e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801a62:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801a67:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a6d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801a74:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a78:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801a7d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a82:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a85:	83 e8 23             	sub    $0x23,%eax
+  801a88:	3c 57                	cmp    $0x57,%al
+  801a8a:	0f 87 67 06 00 00    	ja     8020f7 <vprintfmt+0x6ff>
+  801a90:	0f b6 c0             	movzbl %al,%eax
+  801a93:	48 b9 40 62 80 00 00 	movabs $0x806240,%rcx
+  801a9a:	00 00 00 
+  801a9d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801aa0:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801aa3:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801aa7:	eb cf                	jmp    801a78 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801aa9:	49 89 dc             	mov    %rbx,%r12
+  801aac:	be 01 00 00 00       	mov    $0x1,%esi
+  801ab1:	eb c5                	jmp    801a78 <vprintfmt+0x80>
+            padc = ch;
+  801ab3:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801ab7:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801aba:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801abd:	eb b9                	jmp    801a78 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801abf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ac2:	83 f8 2f             	cmp    $0x2f,%eax
+  801ac5:	77 24                	ja     801aeb <vprintfmt+0xf3>
+  801ac7:	89 c1                	mov    %eax,%ecx
+  801ac9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801acd:	83 c0 08             	add    $0x8,%eax
+  801ad0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ad3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801ad6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801ad9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801add:	79 99                	jns    801a78 <vprintfmt+0x80>
+                width = precision;
+  801adf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ae3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801ae9:	eb 8d                	jmp    801a78 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801aeb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801aef:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801af3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801af7:	eb da                	jmp    801ad3 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801af9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801afe:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b02:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801b08:	3c 39                	cmp    $0x39,%al
+  801b0a:	77 1c                	ja     801b28 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801b0c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801b10:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801b14:	0f b6 c0             	movzbl %al,%eax
+  801b17:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801b1c:	0f b6 03             	movzbl (%rbx),%eax
+  801b1f:	3c 39                	cmp    $0x39,%al
+  801b21:	76 e9                	jbe    801b0c <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801b23:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801b26:	eb b1                	jmp    801ad9 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801b28:	49 89 dc             	mov    %rbx,%r12
+  801b2b:	eb ac                	jmp    801ad9 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801b2d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801b30:	85 c9                	test   %ecx,%ecx
+  801b32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b37:	0f 49 c1             	cmovns %ecx,%eax
+  801b3a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801b3d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b40:	e9 33 ff ff ff       	jmp    801a78 <vprintfmt+0x80>
+            lflag++;
+  801b45:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b48:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b4b:	e9 28 ff ff ff       	jmp    801a78 <vprintfmt+0x80>
+            lflag--;
+  801b50:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801b53:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b56:	e9 1d ff ff ff       	jmp    801a78 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801b5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b5e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b61:	77 19                	ja     801b7c <vprintfmt+0x184>
+  801b63:	89 c2                	mov    %eax,%edx
+  801b65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b69:	83 c0 08             	add    $0x8,%eax
+  801b6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b6f:	8b 3a                	mov    (%rdx),%edi
+  801b71:	4c 89 ee             	mov    %r13,%rsi
+  801b74:	41 ff d6             	call   *%r14
+            break;
+  801b77:	e9 bc fe ff ff       	jmp    801a38 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801b7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b88:	eb e5                	jmp    801b6f <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  801b90:	77 5a                	ja     801bec <vprintfmt+0x1f4>
+  801b92:	89 c2                	mov    %eax,%edx
+  801b94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b98:	83 c0 08             	add    $0x8,%eax
+  801b9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801b9e:	8b 02                	mov    (%rdx),%eax
+  801ba0:	89 c1                	mov    %eax,%ecx
+  801ba2:	f7 d9                	neg    %ecx
+  801ba4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801ba7:	83 f9 13             	cmp    $0x13,%ecx
+  801baa:	7f 4e                	jg     801bfa <vprintfmt+0x202>
+  801bac:	48 63 c1             	movslq %ecx,%rax
+  801baf:	48 ba 00 65 80 00 00 	movabs $0x806500,%rdx
+  801bb6:	00 00 00 
+  801bb9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801bbd:	48 85 c0             	test   %rax,%rax
+  801bc0:	74 38                	je     801bfa <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801bc2:	48 89 c1             	mov    %rax,%rcx
+  801bc5:	48 ba 68 67 80 00 00 	movabs $0x806768,%rdx
+  801bcc:	00 00 00 
+  801bcf:	4c 89 ee             	mov    %r13,%rsi
+  801bd2:	4c 89 f7             	mov    %r14,%rdi
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bda:	49 b8 bb 19 80 00 00 	movabs $0x8019bb,%r8
+  801be1:	00 00 00 
+  801be4:	41 ff d0             	call   *%r8
+  801be7:	e9 4c fe ff ff       	jmp    801a38 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801bec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bf8:	eb a4                	jmp    801b9e <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801bfa:	48 ba c1 60 80 00 00 	movabs $0x8060c1,%rdx
+  801c01:	00 00 00 
+  801c04:	4c 89 ee             	mov    %r13,%rsi
+  801c07:	4c 89 f7             	mov    %r14,%rdi
+  801c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0f:	49 b8 bb 19 80 00 00 	movabs $0x8019bb,%r8
+  801c16:	00 00 00 
+  801c19:	41 ff d0             	call   *%r8
+  801c1c:	e9 17 fe ff ff       	jmp    801a38 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c24:	83 f8 2f             	cmp    $0x2f,%eax
+  801c27:	77 6c                	ja     801c95 <vprintfmt+0x29d>
+  801c29:	89 c2                	mov    %eax,%edx
+  801c2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c2f:	83 c0 08             	add    $0x8,%eax
+  801c32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c35:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801c38:	48 85 f6             	test   %rsi,%rsi
+  801c3b:	48 b8 ba 60 80 00 00 	movabs $0x8060ba,%rax
+  801c42:	00 00 00 
+  801c45:	48 0f 45 c6          	cmovne %rsi,%rax
+  801c49:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801c4d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c51:	7e 06                	jle    801c59 <vprintfmt+0x261>
+  801c53:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801c57:	75 4a                	jne    801ca3 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c59:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c5d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801c61:	0f b6 00             	movzbl (%rax),%eax
+  801c64:	84 c0                	test   %al,%al
+  801c66:	0f 85 9a 00 00 00    	jne    801d06 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801c6c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c6f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	0f 8e bd fd ff ff    	jle    801a38 <vprintfmt+0x40>
+  801c7b:	4c 89 ee             	mov    %r13,%rsi
+  801c7e:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c83:	41 ff d6             	call   *%r14
+  801c86:	41 83 ec 01          	sub    $0x1,%r12d
+  801c8a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801c8e:	75 eb                	jne    801c7b <vprintfmt+0x283>
+  801c90:	e9 a3 fd ff ff       	jmp    801a38 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca1:	eb 92                	jmp    801c35 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801ca3:	49 63 f7             	movslq %r15d,%rsi
+  801ca6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801caa:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	48 89 c2             	mov    %rax,%rdx
+  801cb9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cbc:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801cbe:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801cc1:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	7e 91                	jle    801c59 <vprintfmt+0x261>
+  801cc8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ccd:	4c 89 ee             	mov    %r13,%rsi
+  801cd0:	44 89 e7             	mov    %r12d,%edi
+  801cd3:	41 ff d6             	call   *%r14
+  801cd6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801cda:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801cdd:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ce0:	75 eb                	jne    801ccd <vprintfmt+0x2d5>
+  801ce2:	e9 72 ff ff ff       	jmp    801c59 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ce7:	0f b6 f8             	movzbl %al,%edi
+  801cea:	4c 89 ee             	mov    %r13,%rsi
+  801ced:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801cf0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801cf4:	49 83 c4 01          	add    $0x1,%r12
+  801cf8:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801cfe:	84 c0                	test   %al,%al
+  801d00:	0f 84 66 ff ff ff    	je     801c6c <vprintfmt+0x274>
+  801d06:	45 85 ff             	test   %r15d,%r15d
+  801d09:	78 0a                	js     801d15 <vprintfmt+0x31d>
+  801d0b:	41 83 ef 01          	sub    $0x1,%r15d
+  801d0f:	0f 88 57 ff ff ff    	js     801c6c <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801d15:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801d19:	74 cc                	je     801ce7 <vprintfmt+0x2ef>
+  801d1b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801d1e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801d23:	80 fa 5e             	cmp    $0x5e,%dl
+  801d26:	77 c2                	ja     801cea <vprintfmt+0x2f2>
+  801d28:	eb bd                	jmp    801ce7 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801d2a:	40 84 f6             	test   %sil,%sil
+  801d2d:	75 26                	jne    801d55 <vprintfmt+0x35d>
+    switch (lflag) {
+  801d2f:	85 d2                	test   %edx,%edx
+  801d31:	74 59                	je     801d8c <vprintfmt+0x394>
+  801d33:	83 fa 01             	cmp    $0x1,%edx
+  801d36:	74 7b                	je     801db3 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801d38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3e:	0f 87 96 00 00 00    	ja     801dda <vprintfmt+0x3e2>
+  801d44:	89 c2                	mov    %eax,%edx
+  801d46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d4a:	83 c0 08             	add    $0x8,%eax
+  801d4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d50:	4c 8b 22             	mov    (%rdx),%r12
+  801d53:	eb 17                	jmp    801d6c <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801d55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d58:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5b:	77 21                	ja     801d7e <vprintfmt+0x386>
+  801d5d:	89 c2                	mov    %eax,%edx
+  801d5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d63:	83 c0 08             	add    $0x8,%eax
+  801d66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d69:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801d6c:	4d 85 e4             	test   %r12,%r12
+  801d6f:	78 7a                	js     801deb <vprintfmt+0x3f3>
+            num = i;
+  801d71:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801d74:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801d79:	e9 56 02 00 00       	jmp    801fd4 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8a:	eb dd                	jmp    801d69 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801d8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d8f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d92:	77 11                	ja     801da5 <vprintfmt+0x3ad>
+  801d94:	89 c2                	mov    %eax,%edx
+  801d96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d9a:	83 c0 08             	add    $0x8,%eax
+  801d9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801da0:	4c 63 22             	movslq (%rdx),%r12
+  801da3:	eb c7                	jmp    801d6c <vprintfmt+0x374>
+  801da5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801da9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801db1:	eb ed                	jmp    801da0 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801db3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db6:	83 f8 2f             	cmp    $0x2f,%eax
+  801db9:	77 11                	ja     801dcc <vprintfmt+0x3d4>
+  801dbb:	89 c2                	mov    %eax,%edx
+  801dbd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc1:	83 c0 08             	add    $0x8,%eax
+  801dc4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc7:	4c 8b 22             	mov    (%rdx),%r12
+  801dca:	eb a0                	jmp    801d6c <vprintfmt+0x374>
+  801dcc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dd8:	eb ed                	jmp    801dc7 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801dda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dde:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801de2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801de6:	e9 65 ff ff ff       	jmp    801d50 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801deb:	4c 89 ee             	mov    %r13,%rsi
+  801dee:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801df3:	41 ff d6             	call   *%r14
+                i = -i;
+  801df6:	49 f7 dc             	neg    %r12
+  801df9:	e9 73 ff ff ff       	jmp    801d71 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801dfe:	40 84 f6             	test   %sil,%sil
+  801e01:	75 2e                	jne    801e31 <vprintfmt+0x439>
+    switch (lflag) {
+  801e03:	85 d2                	test   %edx,%edx
+  801e05:	7f 59                	jg     801e60 <vprintfmt+0x468>
+  801e07:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e0a:	7d 7a                	jge    801e86 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801e0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e0f:	83 f8 2f             	cmp    $0x2f,%eax
+  801e12:	0f 87 aa 00 00 00    	ja     801ec2 <vprintfmt+0x4ca>
+  801e18:	89 c2                	mov    %eax,%edx
+  801e1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e1e:	83 c0 08             	add    $0x8,%eax
+  801e21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e24:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e27:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e2c:	e9 a3 01 00 00       	jmp    801fd4 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e34:	83 f8 2f             	cmp    $0x2f,%eax
+  801e37:	77 19                	ja     801e52 <vprintfmt+0x45a>
+  801e39:	89 c2                	mov    %eax,%edx
+  801e3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e3f:	83 c0 08             	add    $0x8,%eax
+  801e42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e45:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e48:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e4d:	e9 82 01 00 00       	jmp    801fd4 <vprintfmt+0x5dc>
+  801e52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e5e:	eb e5                	jmp    801e45 <vprintfmt+0x44d>
+    switch (lflag) {
+  801e60:	83 fa 01             	cmp    $0x1,%edx
+  801e63:	75 a7                	jne    801e0c <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801e65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e68:	83 f8 2f             	cmp    $0x2f,%eax
+  801e6b:	77 47                	ja     801eb4 <vprintfmt+0x4bc>
+  801e6d:	89 c2                	mov    %eax,%edx
+  801e6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e73:	83 c0 08             	add    $0x8,%eax
+  801e76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e79:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e7c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e81:	e9 4e 01 00 00       	jmp    801fd4 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e89:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8c:	77 18                	ja     801ea6 <vprintfmt+0x4ae>
+  801e8e:	89 c2                	mov    %eax,%edx
+  801e90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e94:	83 c0 08             	add    $0x8,%eax
+  801e97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e9a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801e9c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801ea1:	e9 2e 01 00 00       	jmp    801fd4 <vprintfmt+0x5dc>
+  801ea6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb2:	eb e6                	jmp    801e9a <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801eb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec0:	eb b7                	jmp    801e79 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ec2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ece:	e9 51 ff ff ff       	jmp    801e24 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ed3:	40 84 f6             	test   %sil,%sil
+  801ed6:	75 2e                	jne    801f06 <vprintfmt+0x50e>
+    switch (lflag) {
+  801ed8:	85 d2                	test   %edx,%edx
+  801eda:	7f 59                	jg     801f35 <vprintfmt+0x53d>
+  801edc:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801edf:	7d 77                	jge    801f58 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ee1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee7:	0f 87 a4 00 00 00    	ja     801f91 <vprintfmt+0x599>
+  801eed:	89 c2                	mov    %eax,%edx
+  801eef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef3:	83 c0 08             	add    $0x8,%eax
+  801ef6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801efc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f01:	e9 ce 00 00 00       	jmp    801fd4 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f09:	83 f8 2f             	cmp    $0x2f,%eax
+  801f0c:	77 19                	ja     801f27 <vprintfmt+0x52f>
+  801f0e:	89 c2                	mov    %eax,%edx
+  801f10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f14:	83 c0 08             	add    $0x8,%eax
+  801f17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f1a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f1d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f22:	e9 ad 00 00 00       	jmp    801fd4 <vprintfmt+0x5dc>
+  801f27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f33:	eb e5                	jmp    801f1a <vprintfmt+0x522>
+    switch (lflag) {
+  801f35:	83 fa 01             	cmp    $0x1,%edx
+  801f38:	75 a7                	jne    801ee1 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801f3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f3d:	83 f8 2f             	cmp    $0x2f,%eax
+  801f40:	77 41                	ja     801f83 <vprintfmt+0x58b>
+  801f42:	89 c2                	mov    %eax,%edx
+  801f44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f48:	83 c0 08             	add    $0x8,%eax
+  801f4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f4e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801f51:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801f56:	eb 7c                	jmp    801fd4 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f5e:	77 15                	ja     801f75 <vprintfmt+0x57d>
+  801f60:	89 c2                	mov    %eax,%edx
+  801f62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f66:	83 c0 08             	add    $0x8,%eax
+  801f69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f6c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801f6e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801f73:	eb 5f                	jmp    801fd4 <vprintfmt+0x5dc>
+  801f75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f81:	eb e9                	jmp    801f6c <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f8f:	eb bd                	jmp    801f4e <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801f91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f9d:	e9 57 ff ff ff       	jmp    801ef9 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801fa2:	4c 89 ee             	mov    %r13,%rsi
+  801fa5:	bf 30 00 00 00       	mov    $0x30,%edi
+  801faa:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801fad:	4c 89 ee             	mov    %r13,%rsi
+  801fb0:	bf 78 00 00 00       	mov    $0x78,%edi
+  801fb5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801fb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fbb:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbe:	77 47                	ja     802007 <vprintfmt+0x60f>
+  801fc0:	89 c2                	mov    %eax,%edx
+  801fc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc6:	83 c0 08             	add    $0x8,%eax
+  801fc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fcc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fcf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801fd4:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801fdc:	0f 94 c0             	sete   %al
+  801fdf:	0f b6 c0             	movzbl %al,%eax
+  801fe2:	50                   	push   %rax
+  801fe3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801fe8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801fec:	4c 89 ee             	mov    %r13,%rsi
+  801fef:	4c 89 f7             	mov    %r14,%rdi
+  801ff2:	48 b8 ed 18 80 00 00 	movabs $0x8018ed,%rax
+  801ff9:	00 00 00 
+  801ffc:	ff d0                	call   *%rax
+            break;
+  801ffe:	48 83 c4 10          	add    $0x10,%rsp
+  802002:	e9 31 fa ff ff       	jmp    801a38 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802007:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80200b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80200f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802013:	eb b7                	jmp    801fcc <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802015:	40 84 f6             	test   %sil,%sil
+  802018:	75 2b                	jne    802045 <vprintfmt+0x64d>
+    switch (lflag) {
+  80201a:	85 d2                	test   %edx,%edx
+  80201c:	7f 56                	jg     802074 <vprintfmt+0x67c>
+  80201e:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802021:	7d 77                	jge    80209a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802023:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802026:	83 f8 2f             	cmp    $0x2f,%eax
+  802029:	0f 87 a7 00 00 00    	ja     8020d6 <vprintfmt+0x6de>
+  80202f:	89 c2                	mov    %eax,%edx
+  802031:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802035:	83 c0 08             	add    $0x8,%eax
+  802038:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80203b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80203e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802043:	eb 8f                	jmp    801fd4 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802045:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802048:	83 f8 2f             	cmp    $0x2f,%eax
+  80204b:	77 19                	ja     802066 <vprintfmt+0x66e>
+  80204d:	89 c2                	mov    %eax,%edx
+  80204f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802053:	83 c0 08             	add    $0x8,%eax
+  802056:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802059:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80205c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802061:	e9 6e ff ff ff       	jmp    801fd4 <vprintfmt+0x5dc>
+  802066:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80206a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80206e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802072:	eb e5                	jmp    802059 <vprintfmt+0x661>
+    switch (lflag) {
+  802074:	83 fa 01             	cmp    $0x1,%edx
+  802077:	75 aa                	jne    802023 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802079:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80207c:	83 f8 2f             	cmp    $0x2f,%eax
+  80207f:	77 47                	ja     8020c8 <vprintfmt+0x6d0>
+  802081:	89 c2                	mov    %eax,%edx
+  802083:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802087:	83 c0 08             	add    $0x8,%eax
+  80208a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80208d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802090:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802095:	e9 3a ff ff ff       	jmp    801fd4 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80209a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80209d:	83 f8 2f             	cmp    $0x2f,%eax
+  8020a0:	77 18                	ja     8020ba <vprintfmt+0x6c2>
+  8020a2:	89 c2                	mov    %eax,%edx
+  8020a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020a8:	83 c0 08             	add    $0x8,%eax
+  8020ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ae:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8020b0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8020b5:	e9 1a ff ff ff       	jmp    801fd4 <vprintfmt+0x5dc>
+  8020ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c6:	eb e6                	jmp    8020ae <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8020c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d4:	eb b7                	jmp    80208d <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8020d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e2:	e9 54 ff ff ff       	jmp    80203b <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8020e7:	4c 89 ee             	mov    %r13,%rsi
+  8020ea:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020ef:	41 ff d6             	call   *%r14
+            break;
+  8020f2:	e9 41 f9 ff ff       	jmp    801a38 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8020f7:	4c 89 ee             	mov    %r13,%rsi
+  8020fa:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020ff:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802102:	48 83 eb 01          	sub    $0x1,%rbx
+  802106:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80210a:	75 f6                	jne    802102 <vprintfmt+0x70a>
+  80210c:	e9 27 f9 ff ff       	jmp    801a38 <vprintfmt+0x40>
+
+0000000000802111 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802111:	55                   	push   %rbp
+  802112:	48 89 e5             	mov    %rsp,%rbp
+  802115:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802119:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80211d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802122:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802126:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80212d:	48 85 ff             	test   %rdi,%rdi
+  802130:	74 2b                	je     80215d <vsnprintf+0x4c>
+  802132:	48 85 f6             	test   %rsi,%rsi
+  802135:	74 26                	je     80215d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802137:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80213b:	48 bf a3 19 80 00 00 	movabs $0x8019a3,%rdi
+  802142:	00 00 00 
+  802145:	48 b8 f8 19 80 00 00 	movabs $0x8019f8,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802151:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802155:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802158:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80215b:	c9                   	leave
+  80215c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80215d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802162:	eb f7                	jmp    80215b <vsnprintf+0x4a>
+
+0000000000802164 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	48 83 ec 50          	sub    $0x50,%rsp
+  80216c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802170:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802174:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802178:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80217f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802183:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802187:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80218b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80218f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802193:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  80219a:	00 00 00 
+  80219d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80219f:	c9                   	leave
+  8021a0:	c3                   	ret
+
+00000000008021a1 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8021a1:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8021a4:	74 10                	je     8021b6 <strlen+0x15>
+    size_t n = 0;
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8021ab:	48 83 c0 01          	add    $0x1,%rax
+  8021af:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8021b3:	75 f6                	jne    8021ab <strlen+0xa>
+  8021b5:	c3                   	ret
+    size_t n = 0;
+  8021b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8021bb:	c3                   	ret
+
+00000000008021bc <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8021bc:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8021bf:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8021c4:	48 85 f6             	test   %rsi,%rsi
+  8021c7:	74 11                	je     8021da <strnlen+0x1e>
+  8021c9:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8021cd:	74 0c                	je     8021db <strnlen+0x1f>
+  8021cf:	48 83 c2 01          	add    $0x1,%rdx
+  8021d3:	48 39 d0             	cmp    %rdx,%rax
+  8021d6:	75 f1                	jne    8021c9 <strnlen+0xd>
+  8021d8:	eb 04                	jmp    8021de <strnlen+0x22>
+  8021da:	c3                   	ret
+  8021db:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8021de:	c3                   	ret
+
+00000000008021df <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8021df:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8021e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8021eb:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8021ee:	48 83 c2 01          	add    $0x1,%rdx
+  8021f2:	84 c9                	test   %cl,%cl
+  8021f4:	75 f1                	jne    8021e7 <strcpy+0x8>
+        ;
+    return res;
+}
+  8021f6:	c3                   	ret
+
+00000000008021f7 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8021f7:	55                   	push   %rbp
+  8021f8:	48 89 e5             	mov    %rsp,%rbp
+  8021fb:	41 54                	push   %r12
+  8021fd:	53                   	push   %rbx
+  8021fe:	48 89 fb             	mov    %rdi,%rbx
+  802201:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802204:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  80220b:	00 00 00 
+  80220e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802210:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802214:	4c 89 e6             	mov    %r12,%rsi
+  802217:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  80221e:	00 00 00 
+  802221:	ff d0                	call   *%rax
+    return dst;
+}
+  802223:	48 89 d8             	mov    %rbx,%rax
+  802226:	5b                   	pop    %rbx
+  802227:	41 5c                	pop    %r12
+  802229:	5d                   	pop    %rbp
+  80222a:	c3                   	ret
+
+000000000080222b <toupper>:
+
+int
+toupper(int ch) {
+  80222b:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80222d:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802230:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802233:	83 f9 1a             	cmp    $0x1a,%ecx
+  802236:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802239:	c3                   	ret
+
+000000000080223a <tolower>:
+
+int
+tolower(int ch) {
+  80223a:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80223c:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80223f:	8d 57 20             	lea    0x20(%rdi),%edx
+  802242:	83 f9 1a             	cmp    $0x1a,%ecx
+  802245:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802248:	c3                   	ret
+
+0000000000802249 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802249:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80224c:	48 85 d2             	test   %rdx,%rdx
+  80224f:	74 1f                	je     802270 <strncpy+0x27>
+  802251:	48 01 fa             	add    %rdi,%rdx
+  802254:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802257:	48 83 c1 01          	add    $0x1,%rcx
+  80225b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80225f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802263:	41 80 f8 01          	cmp    $0x1,%r8b
+  802267:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80226b:	48 39 ca             	cmp    %rcx,%rdx
+  80226e:	75 e7                	jne    802257 <strncpy+0xe>
+    }
+    return ret;
+}
+  802270:	c3                   	ret
+
+0000000000802271 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802271:	48 89 f8             	mov    %rdi,%rax
+  802274:	48 85 d2             	test   %rdx,%rdx
+  802277:	74 24                	je     80229d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802279:	48 83 ea 01          	sub    $0x1,%rdx
+  80227d:	74 1b                	je     80229a <strlcpy+0x29>
+  80227f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802283:	0f b6 16             	movzbl (%rsi),%edx
+  802286:	84 d2                	test   %dl,%dl
+  802288:	74 10                	je     80229a <strlcpy+0x29>
+            *dst++ = *src++;
+  80228a:	48 83 c6 01          	add    $0x1,%rsi
+  80228e:	48 83 c0 01          	add    $0x1,%rax
+  802292:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802295:	48 39 c8             	cmp    %rcx,%rax
+  802298:	75 e9                	jne    802283 <strlcpy+0x12>
+        *dst = '\0';
+  80229a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80229d:	48 29 f8             	sub    %rdi,%rax
+}
+  8022a0:	c3                   	ret
+
+00000000008022a1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8022a1:	0f b6 07             	movzbl (%rdi),%eax
+  8022a4:	84 c0                	test   %al,%al
+  8022a6:	74 13                	je     8022bb <strcmp+0x1a>
+  8022a8:	38 06                	cmp    %al,(%rsi)
+  8022aa:	75 0f                	jne    8022bb <strcmp+0x1a>
+  8022ac:	48 83 c7 01          	add    $0x1,%rdi
+  8022b0:	48 83 c6 01          	add    $0x1,%rsi
+  8022b4:	0f b6 07             	movzbl (%rdi),%eax
+  8022b7:	84 c0                	test   %al,%al
+  8022b9:	75 ed                	jne    8022a8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022bb:	0f b6 c0             	movzbl %al,%eax
+  8022be:	0f b6 16             	movzbl (%rsi),%edx
+  8022c1:	29 d0                	sub    %edx,%eax
+}
+  8022c3:	c3                   	ret
+
+00000000008022c4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8022c4:	48 85 d2             	test   %rdx,%rdx
+  8022c7:	74 1f                	je     8022e8 <strncmp+0x24>
+  8022c9:	0f b6 07             	movzbl (%rdi),%eax
+  8022cc:	84 c0                	test   %al,%al
+  8022ce:	74 1e                	je     8022ee <strncmp+0x2a>
+  8022d0:	3a 06                	cmp    (%rsi),%al
+  8022d2:	75 1a                	jne    8022ee <strncmp+0x2a>
+  8022d4:	48 83 c7 01          	add    $0x1,%rdi
+  8022d8:	48 83 c6 01          	add    $0x1,%rsi
+  8022dc:	48 83 ea 01          	sub    $0x1,%rdx
+  8022e0:	75 e7                	jne    8022c9 <strncmp+0x5>
+
+    if (!n) return 0;
+  8022e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e7:	c3                   	ret
+  8022e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ed:	c3                   	ret
+  8022ee:	48 85 d2             	test   %rdx,%rdx
+  8022f1:	74 09                	je     8022fc <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8022f3:	0f b6 07             	movzbl (%rdi),%eax
+  8022f6:	0f b6 16             	movzbl (%rsi),%edx
+  8022f9:	29 d0                	sub    %edx,%eax
+  8022fb:	c3                   	ret
+    if (!n) return 0;
+  8022fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802301:	c3                   	ret
+
+0000000000802302 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802302:	0f b6 17             	movzbl (%rdi),%edx
+  802305:	84 d2                	test   %dl,%dl
+  802307:	74 18                	je     802321 <strchr+0x1f>
+        if (*str == c) {
+  802309:	0f be d2             	movsbl %dl,%edx
+  80230c:	39 f2                	cmp    %esi,%edx
+  80230e:	74 17                	je     802327 <strchr+0x25>
+    for (; *str; str++) {
+  802310:	48 83 c7 01          	add    $0x1,%rdi
+  802314:	0f b6 17             	movzbl (%rdi),%edx
+  802317:	84 d2                	test   %dl,%dl
+  802319:	75 ee                	jne    802309 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80231b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802320:	c3                   	ret
+  802321:	b8 00 00 00 00       	mov    $0x0,%eax
+  802326:	c3                   	ret
+  802327:	48 89 f8             	mov    %rdi,%rax
+}
+  80232a:	c3                   	ret
+
+000000000080232b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80232b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80232e:	0f b6 17             	movzbl (%rdi),%edx
+  802331:	84 d2                	test   %dl,%dl
+  802333:	74 13                	je     802348 <strfind+0x1d>
+  802335:	0f be d2             	movsbl %dl,%edx
+  802338:	39 f2                	cmp    %esi,%edx
+  80233a:	74 0b                	je     802347 <strfind+0x1c>
+  80233c:	48 83 c0 01          	add    $0x1,%rax
+  802340:	0f b6 10             	movzbl (%rax),%edx
+  802343:	84 d2                	test   %dl,%dl
+  802345:	75 ee                	jne    802335 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802347:	c3                   	ret
+  802348:	c3                   	ret
+
+0000000000802349 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802349:	48 39 f7             	cmp    %rsi,%rdi
+  80234c:	74 65                	je     8023b3 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80234e:	55                   	push   %rbp
+  80234f:	48 89 e5             	mov    %rsp,%rbp
+  802352:	41 57                	push   %r15
+  802354:	41 56                	push   %r14
+  802356:	41 55                	push   %r13
+  802358:	41 54                	push   %r12
+  80235a:	53                   	push   %rbx
+  80235b:	48 83 ec 18          	sub    $0x18,%rsp
+  80235f:	48 89 fb             	mov    %rdi,%rbx
+  802362:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802365:	49 bf 3a 22 80 00 00 	movabs $0x80223a,%r15
+  80236c:	00 00 00 
+  80236f:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802373:	41 0f b6 fd          	movzbl %r13b,%edi
+  802377:	41 ff d7             	call   *%r15
+  80237a:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80237d:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802382:	41 0f b6 fe          	movzbl %r14b,%edi
+  802386:	41 ff d7             	call   *%r15
+  802389:	89 c2                	mov    %eax,%edx
+  80238b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80238e:	29 d0                	sub    %edx,%eax
+  802390:	75 12                	jne    8023a4 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802392:	48 83 c3 01          	add    $0x1,%rbx
+  802396:	45 84 ed             	test   %r13b,%r13b
+  802399:	74 09                	je     8023a4 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80239b:	49 83 c4 01          	add    $0x1,%r12
+  80239f:	45 84 f6             	test   %r14b,%r14b
+  8023a2:	75 cb                	jne    80236f <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8023a4:	48 83 c4 18          	add    $0x18,%rsp
+  8023a8:	5b                   	pop    %rbx
+  8023a9:	41 5c                	pop    %r12
+  8023ab:	41 5d                	pop    %r13
+  8023ad:	41 5e                	pop    %r14
+  8023af:	41 5f                	pop    %r15
+  8023b1:	5d                   	pop    %rbp
+  8023b2:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023b8:	c3                   	ret
+
+00000000008023b9 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8023b9:	48 39 f7             	cmp    %rsi,%rdi
+  8023bc:	74 7d                	je     80243b <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8023be:	55                   	push   %rbp
+  8023bf:	48 89 e5             	mov    %rsp,%rbp
+  8023c2:	41 57                	push   %r15
+  8023c4:	41 56                	push   %r14
+  8023c6:	41 55                	push   %r13
+  8023c8:	41 54                	push   %r12
+  8023ca:	53                   	push   %rbx
+  8023cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8023cf:	48 89 fb             	mov    %rdi,%rbx
+  8023d2:	49 89 f4             	mov    %rsi,%r12
+  8023d5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8023d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023dd:	49 bf 3a 22 80 00 00 	movabs $0x80223a,%r15
+  8023e4:	00 00 00 
+    while (n--) {
+  8023e7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023eb:	48 39 c3             	cmp    %rax,%rbx
+  8023ee:	74 37                	je     802427 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8023f0:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8023f4:	41 0f b6 fd          	movzbl %r13b,%edi
+  8023f8:	41 ff d7             	call   *%r15
+  8023fb:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8023fe:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802403:	41 0f b6 fe          	movzbl %r14b,%edi
+  802407:	41 ff d7             	call   *%r15
+  80240a:	89 c2                	mov    %eax,%edx
+  80240c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80240f:	29 d0                	sub    %edx,%eax
+  802411:	75 19                	jne    80242c <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802413:	48 83 c3 01          	add    $0x1,%rbx
+  802417:	45 84 ed             	test   %r13b,%r13b
+  80241a:	74 10                	je     80242c <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80241c:	49 83 c4 01          	add    $0x1,%r12
+  802420:	45 84 f6             	test   %r14b,%r14b
+  802423:	75 c2                	jne    8023e7 <strncasecmp+0x2e>
+  802425:	eb 05                	jmp    80242c <strncasecmp+0x73>
+  802427:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80242c:	48 83 c4 18          	add    $0x18,%rsp
+  802430:	5b                   	pop    %rbx
+  802431:	41 5c                	pop    %r12
+  802433:	41 5d                	pop    %r13
+  802435:	41 5e                	pop    %r14
+  802437:	41 5f                	pop    %r15
+  802439:	5d                   	pop    %rbp
+  80243a:	c3                   	ret
+    if (p1 == p2) return 0;
+  80243b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802440:	c3                   	ret
+
+0000000000802441 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802441:	83 e7 df             	and    $0xffffffdf,%edi
+  802444:	83 ef 41             	sub    $0x41,%edi
+  802447:	83 ff 19             	cmp    $0x19,%edi
+  80244a:	0f 96 c0             	setbe  %al
+}
+  80244d:	c3                   	ret
+
+000000000080244e <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80244e:	83 ff 20             	cmp    $0x20,%edi
+  802451:	0f 94 c0             	sete   %al
+  802454:	83 ff 09             	cmp    $0x9,%edi
+  802457:	0f 94 c2             	sete   %dl
+  80245a:	09 d0                	or     %edx,%eax
+}
+  80245c:	c3                   	ret
+
+000000000080245d <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80245d:	55                   	push   %rbp
+  80245e:	48 89 e5             	mov    %rsp,%rbp
+  802461:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802463:	48 bf bf 65 80 00 00 	movabs $0x8065bf,%rdi
+  80246a:	00 00 00 
+  80246d:	48 b8 02 23 80 00 00 	movabs $0x802302,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	48 85 c0             	test   %rax,%rax
+  80247c:	0f 95 c0             	setne  %al
+}
+  80247f:	5d                   	pop    %rbp
+  802480:	c3                   	ret
+
+0000000000802481 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802481:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802484:	48 89 f8             	mov    %rdi,%rax
+  802487:	48 f7 d8             	neg    %rax
+  80248a:	83 e0 07             	and    $0x7,%eax
+  80248d:	49 89 d1             	mov    %rdx,%r9
+  802490:	49 29 c1             	sub    %rax,%r9
+  802493:	78 36                	js     8024cb <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802495:	40 0f b6 c6          	movzbl %sil,%eax
+  802499:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8024a0:	01 01 01 
+  8024a3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8024a7:	40 f6 c7 07          	test   $0x7,%dil
+  8024ab:	75 38                	jne    8024e5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8024ad:	4c 89 c9             	mov    %r9,%rcx
+  8024b0:	48 c1 f9 03          	sar    $0x3,%rcx
+  8024b4:	74 0c                	je     8024c2 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8024b6:	fc                   	cld
+  8024b7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8024ba:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8024be:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8024c2:	4d 85 c9             	test   %r9,%r9
+  8024c5:	75 45                	jne    80250c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8024c7:	4c 89 c0             	mov    %r8,%rax
+  8024ca:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8024cb:	48 85 d2             	test   %rdx,%rdx
+  8024ce:	74 f7                	je     8024c7 <memset+0x46>
+  8024d0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8024d3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8024d6:	48 83 c0 01          	add    $0x1,%rax
+  8024da:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8024de:	48 39 c2             	cmp    %rax,%rdx
+  8024e1:	75 f3                	jne    8024d6 <memset+0x55>
+  8024e3:	eb e2                	jmp    8024c7 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8024e5:	40 f6 c7 01          	test   $0x1,%dil
+  8024e9:	74 06                	je     8024f1 <memset+0x70>
+  8024eb:	88 07                	mov    %al,(%rdi)
+  8024ed:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8024f1:	40 f6 c7 02          	test   $0x2,%dil
+  8024f5:	74 07                	je     8024fe <memset+0x7d>
+  8024f7:	66 89 07             	mov    %ax,(%rdi)
+  8024fa:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024fe:	40 f6 c7 04          	test   $0x4,%dil
+  802502:	74 a9                	je     8024ad <memset+0x2c>
+  802504:	89 07                	mov    %eax,(%rdi)
+  802506:	48 83 c7 04          	add    $0x4,%rdi
+  80250a:	eb a1                	jmp    8024ad <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80250c:	41 f6 c1 04          	test   $0x4,%r9b
+  802510:	74 06                	je     802518 <memset+0x97>
+  802512:	89 07                	mov    %eax,(%rdi)
+  802514:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802518:	41 f6 c1 02          	test   $0x2,%r9b
+  80251c:	74 07                	je     802525 <memset+0xa4>
+  80251e:	66 89 07             	mov    %ax,(%rdi)
+  802521:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802525:	41 f6 c1 01          	test   $0x1,%r9b
+  802529:	74 9c                	je     8024c7 <memset+0x46>
+  80252b:	88 07                	mov    %al,(%rdi)
+  80252d:	eb 98                	jmp    8024c7 <memset+0x46>
+
+000000000080252f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80252f:	48 89 f8             	mov    %rdi,%rax
+  802532:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802535:	48 39 fe             	cmp    %rdi,%rsi
+  802538:	73 3b                	jae    802575 <memmove+0x46>
+  80253a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80253e:	48 39 d7             	cmp    %rdx,%rdi
+  802541:	73 32                	jae    802575 <memmove+0x46>
+        s += n;
+        d += n;
+  802543:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802547:	48 89 d6             	mov    %rdx,%rsi
+  80254a:	48 09 fe             	or     %rdi,%rsi
+  80254d:	48 09 ce             	or     %rcx,%rsi
+  802550:	40 f6 c6 07          	test   $0x7,%sil
+  802554:	75 12                	jne    802568 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802556:	48 83 ef 08          	sub    $0x8,%rdi
+  80255a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80255e:	48 c1 e9 03          	shr    $0x3,%rcx
+  802562:	fd                   	std
+  802563:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802566:	fc                   	cld
+  802567:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802568:	48 83 ef 01          	sub    $0x1,%rdi
+  80256c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802570:	fd                   	std
+  802571:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802573:	eb f1                	jmp    802566 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802575:	48 89 f2             	mov    %rsi,%rdx
+  802578:	48 09 c2             	or     %rax,%rdx
+  80257b:	48 09 ca             	or     %rcx,%rdx
+  80257e:	f6 c2 07             	test   $0x7,%dl
+  802581:	75 0c                	jne    80258f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802583:	48 c1 e9 03          	shr    $0x3,%rcx
+  802587:	48 89 c7             	mov    %rax,%rdi
+  80258a:	fc                   	cld
+  80258b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80258e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80258f:	48 89 c7             	mov    %rax,%rdi
+  802592:	fc                   	cld
+  802593:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802595:	c3                   	ret
+
+0000000000802596 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802596:	55                   	push   %rbp
+  802597:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80259a:	48 b8 2f 25 80 00 00 	movabs $0x80252f,%rax
+  8025a1:	00 00 00 
+  8025a4:	ff d0                	call   *%rax
+}
+  8025a6:	5d                   	pop    %rbp
+  8025a7:	c3                   	ret
+
+00000000008025a8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8025a8:	55                   	push   %rbp
+  8025a9:	48 89 e5             	mov    %rsp,%rbp
+  8025ac:	41 57                	push   %r15
+  8025ae:	41 56                	push   %r14
+  8025b0:	41 55                	push   %r13
+  8025b2:	41 54                	push   %r12
+  8025b4:	53                   	push   %rbx
+  8025b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b9:	49 89 fe             	mov    %rdi,%r14
+  8025bc:	49 89 f7             	mov    %rsi,%r15
+  8025bf:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8025c2:	48 89 f7             	mov    %rsi,%rdi
+  8025c5:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8025cc:	00 00 00 
+  8025cf:	ff d0                	call   *%rax
+  8025d1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8025d4:	48 89 de             	mov    %rbx,%rsi
+  8025d7:	4c 89 f7             	mov    %r14,%rdi
+  8025da:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+  8025e6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025e9:	48 39 c3             	cmp    %rax,%rbx
+  8025ec:	74 36                	je     802624 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8025ee:	48 89 d8             	mov    %rbx,%rax
+  8025f1:	4c 29 e8             	sub    %r13,%rax
+  8025f4:	49 39 c4             	cmp    %rax,%r12
+  8025f7:	73 31                	jae    80262a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8025f9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8025fe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802602:	4c 89 fe             	mov    %r15,%rsi
+  802605:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802611:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802615:	48 83 c4 08          	add    $0x8,%rsp
+  802619:	5b                   	pop    %rbx
+  80261a:	41 5c                	pop    %r12
+  80261c:	41 5d                	pop    %r13
+  80261e:	41 5e                	pop    %r14
+  802620:	41 5f                	pop    %r15
+  802622:	5d                   	pop    %rbp
+  802623:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802624:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802628:	eb eb                	jmp    802615 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80262a:	48 83 eb 01          	sub    $0x1,%rbx
+  80262e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802632:	48 89 da             	mov    %rbx,%rdx
+  802635:	4c 89 fe             	mov    %r15,%rsi
+  802638:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802644:	49 01 de             	add    %rbx,%r14
+  802647:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80264c:	eb c3                	jmp    802611 <strlcat+0x69>
+
+000000000080264e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80264e:	48 85 d2             	test   %rdx,%rdx
+  802651:	74 2d                	je     802680 <memcmp+0x32>
+  802653:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802658:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80265c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802661:	44 38 c1             	cmp    %r8b,%cl
+  802664:	75 0f                	jne    802675 <memcmp+0x27>
+    while (n-- > 0) {
+  802666:	48 83 c0 01          	add    $0x1,%rax
+  80266a:	48 39 c2             	cmp    %rax,%rdx
+  80266d:	75 e9                	jne    802658 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80266f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802674:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802675:	0f b6 c1             	movzbl %cl,%eax
+  802678:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80267c:	44 29 c0             	sub    %r8d,%eax
+  80267f:	c3                   	ret
+    return 0;
+  802680:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802685:	c3                   	ret
+
+0000000000802686 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802686:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80268a:	48 39 c7             	cmp    %rax,%rdi
+  80268d:	73 0f                	jae    80269e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80268f:	40 38 37             	cmp    %sil,(%rdi)
+  802692:	74 0e                	je     8026a2 <memfind+0x1c>
+    for (; src < end; src++) {
+  802694:	48 83 c7 01          	add    $0x1,%rdi
+  802698:	48 39 f8             	cmp    %rdi,%rax
+  80269b:	75 f2                	jne    80268f <memfind+0x9>
+  80269d:	c3                   	ret
+  80269e:	48 89 f8             	mov    %rdi,%rax
+  8026a1:	c3                   	ret
+  8026a2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8026a5:	c3                   	ret
+
+00000000008026a6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8026a6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8026a9:	0f b6 37             	movzbl (%rdi),%esi
+  8026ac:	40 80 fe 20          	cmp    $0x20,%sil
+  8026b0:	74 06                	je     8026b8 <strtol+0x12>
+  8026b2:	40 80 fe 09          	cmp    $0x9,%sil
+  8026b6:	75 13                	jne    8026cb <strtol+0x25>
+  8026b8:	48 83 c7 01          	add    $0x1,%rdi
+  8026bc:	0f b6 37             	movzbl (%rdi),%esi
+  8026bf:	40 80 fe 20          	cmp    $0x20,%sil
+  8026c3:	74 f3                	je     8026b8 <strtol+0x12>
+  8026c5:	40 80 fe 09          	cmp    $0x9,%sil
+  8026c9:	74 ed                	je     8026b8 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8026cb:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8026ce:	83 e0 fd             	and    $0xfffffffd,%eax
+  8026d1:	3c 01                	cmp    $0x1,%al
+  8026d3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026d7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8026dd:	75 0f                	jne    8026ee <strtol+0x48>
+  8026df:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8026e2:	74 14                	je     8026f8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8026e4:	85 d2                	test   %edx,%edx
+  8026e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026eb:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8026ee:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8026f3:	4c 63 ca             	movslq %edx,%r9
+  8026f6:	eb 36                	jmp    80272e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026f8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8026fc:	74 0f                	je     80270d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8026fe:	85 d2                	test   %edx,%edx
+  802700:	75 ec                	jne    8026ee <strtol+0x48>
+        s++;
+  802702:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802706:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80270b:	eb e1                	jmp    8026ee <strtol+0x48>
+        s += 2;
+  80270d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802711:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802716:	eb d6                	jmp    8026ee <strtol+0x48>
+            dig -= '0';
+  802718:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80271b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80271f:	41 39 d0             	cmp    %edx,%r8d
+  802722:	7d 21                	jge    802745 <strtol+0x9f>
+        val = val * base + dig;
+  802724:	49 0f af c1          	imul   %r9,%rax
+  802728:	0f b6 c9             	movzbl %cl,%ecx
+  80272b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80272e:	48 83 c7 01          	add    $0x1,%rdi
+  802732:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802736:	80 f9 39             	cmp    $0x39,%cl
+  802739:	76 dd                	jbe    802718 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80273b:	80 f9 7b             	cmp    $0x7b,%cl
+  80273e:	77 05                	ja     802745 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802740:	83 e9 57             	sub    $0x57,%ecx
+  802743:	eb d6                	jmp    80271b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802745:	4d 85 d2             	test   %r10,%r10
+  802748:	74 03                	je     80274d <strtol+0xa7>
+  80274a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80274d:	48 89 c2             	mov    %rax,%rdx
+  802750:	48 f7 da             	neg    %rdx
+  802753:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802757:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80275b:	c3                   	ret
+
+000000000080275c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80275c:	55                   	push   %rbp
+  80275d:	48 89 e5             	mov    %rsp,%rbp
+  802760:	53                   	push   %rbx
+  802761:	48 89 fa             	mov    %rdi,%rdx
+  802764:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802767:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80276c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802771:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802776:	be 00 00 00 00       	mov    $0x0,%esi
+  80277b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802781:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802787:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802789:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80278d:	c9                   	leave
+  80278e:	c3                   	ret
+
+000000000080278f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80278f:	55                   	push   %rbp
+  802790:	48 89 e5             	mov    %rsp,%rbp
+  802793:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802794:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027be:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027c4:	c9                   	leave
+  8027c5:	c3                   	ret
+
+00000000008027c6 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8027c6:	55                   	push   %rbp
+  8027c7:	48 89 e5             	mov    %rsp,%rbp
+  8027ca:	53                   	push   %rbx
+  8027cb:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ce:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027f3:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8027f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f9:	c9                   	leave
+  8027fa:	c3                   	ret
+
+00000000008027fb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8027fb:	55                   	push   %rbp
+  8027fc:	48 89 e5             	mov    %rsp,%rbp
+  8027ff:	53                   	push   %rbx
+  802800:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802804:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802807:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80280c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802816:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80281b:	be 00 00 00 00       	mov    $0x0,%esi
+  802820:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802826:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80282c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80282e:	48 85 c0             	test   %rax,%rax
+  802831:	7f 06                	jg     802839 <sys_env_destroy+0x3e>
+}
+  802833:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802837:	c9                   	leave
+  802838:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802839:	49 89 c0             	mov    %rax,%r8
+  80283c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802841:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802848:	00 00 00 
+  80284b:	be 27 00 00 00       	mov    $0x27,%esi
+  802850:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802857:	00 00 00 
+  80285a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285f:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802866:	00 00 00 
+  802869:	41 ff d1             	call   *%r9
+
+000000000080286c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80286c:	55                   	push   %rbp
+  80286d:	48 89 e5             	mov    %rsp,%rbp
+  802870:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802871:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802880:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802885:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80288a:	be 00 00 00 00       	mov    $0x0,%esi
+  80288f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802895:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80289b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80289d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028a1:	c9                   	leave
+  8028a2:	c3                   	ret
+
+00000000008028a3 <sys_yield>:
+
+void
+sys_yield(void) {
+  8028a3:	55                   	push   %rbp
+  8028a4:	48 89 e5             	mov    %rsp,%rbp
+  8028a7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028d2:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028d8:	c9                   	leave
+  8028d9:	c3                   	ret
+
+00000000008028da <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8028da:	55                   	push   %rbp
+  8028db:	48 89 e5             	mov    %rsp,%rbp
+  8028de:	53                   	push   %rbx
+  8028df:	48 89 fa             	mov    %rdi,%rdx
+  8028e2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028e5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ea:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8028f1:	00 00 00 
+  8028f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802904:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80290a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80290c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+
+0000000000802912 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802912:	55                   	push   %rbp
+  802913:	48 89 e5             	mov    %rsp,%rbp
+  802916:	53                   	push   %rbx
+  802917:	49 89 f8             	mov    %rdi,%r8
+  80291a:	48 89 d3             	mov    %rdx,%rbx
+  80291d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802920:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802925:	4c 89 c2             	mov    %r8,%rdx
+  802928:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80292b:	be 00 00 00 00       	mov    $0x0,%esi
+  802930:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802936:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80293c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80293e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802942:	c9                   	leave
+  802943:	c3                   	ret
+
+0000000000802944 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802944:	55                   	push   %rbp
+  802945:	48 89 e5             	mov    %rsp,%rbp
+  802948:	53                   	push   %rbx
+  802949:	48 83 ec 08          	sub    $0x8,%rsp
+  80294d:	89 f8                	mov    %edi,%eax
+  80294f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802952:	48 63 f9             	movslq %ecx,%rdi
+  802955:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802958:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80295d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802960:	be 00 00 00 00       	mov    $0x0,%esi
+  802965:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80296b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802971:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802973:	48 85 c0             	test   %rax,%rax
+  802976:	7f 06                	jg     80297e <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802978:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80297c:	c9                   	leave
+  80297d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80297e:	49 89 c0             	mov    %rax,%r8
+  802981:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802986:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  80298d:	00 00 00 
+  802990:	be 27 00 00 00       	mov    $0x27,%esi
+  802995:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  80299c:	00 00 00 
+  80299f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a4:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  8029ab:	00 00 00 
+  8029ae:	41 ff d1             	call   *%r9
+
+00000000008029b1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8029b1:	55                   	push   %rbp
+  8029b2:	48 89 e5             	mov    %rsp,%rbp
+  8029b5:	53                   	push   %rbx
+  8029b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ba:	89 f8                	mov    %edi,%eax
+  8029bc:	49 89 f2             	mov    %rsi,%r10
+  8029bf:	48 89 cf             	mov    %rcx,%rdi
+  8029c2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8029c5:	48 63 da             	movslq %edx,%rbx
+  8029c8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029cb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029d3:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8029d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029de:	48 85 c0             	test   %rax,%rax
+  8029e1:	7f 06                	jg     8029e9 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8029e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e7:	c9                   	leave
+  8029e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e9:	49 89 c0             	mov    %rax,%r8
+  8029ec:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8029f1:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  8029f8:	00 00 00 
+  8029fb:	be 27 00 00 00       	mov    $0x27,%esi
+  802a00:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802a07:	00 00 00 
+  802a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0f:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802a16:	00 00 00 
+  802a19:	41 ff d1             	call   *%r9
+
+0000000000802a1c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+  802a20:	53                   	push   %rbx
+  802a21:	48 83 ec 08          	sub    $0x8,%rsp
+  802a25:	48 89 f1             	mov    %rsi,%rcx
+  802a28:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802a2b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a2e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a33:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a38:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a43:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a49:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a4b:	48 85 c0             	test   %rax,%rax
+  802a4e:	7f 06                	jg     802a56 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802a50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a54:	c9                   	leave
+  802a55:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a56:	49 89 c0             	mov    %rax,%r8
+  802a59:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a5e:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802a65:	00 00 00 
+  802a68:	be 27 00 00 00       	mov    $0x27,%esi
+  802a6d:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802a74:	00 00 00 
+  802a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7c:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802a83:	00 00 00 
+  802a86:	41 ff d1             	call   *%r9
+
+0000000000802a89 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a89:	55                   	push   %rbp
+  802a8a:	48 89 e5             	mov    %rsp,%rbp
+  802a8d:	53                   	push   %rbx
+  802a8e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802a92:	48 63 ce             	movslq %esi,%rcx
+  802a95:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a98:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa7:	be 00 00 00 00       	mov    $0x0,%esi
+  802aac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802aba:	48 85 c0             	test   %rax,%rax
+  802abd:	7f 06                	jg     802ac5 <sys_env_set_status+0x3c>
+}
+  802abf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ac5:	49 89 c0             	mov    %rax,%r8
+  802ac8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802acd:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802ad4:	00 00 00 
+  802ad7:	be 27 00 00 00       	mov    $0x27,%esi
+  802adc:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802ae3:	00 00 00 
+  802ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aeb:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802af2:	00 00 00 
+  802af5:	41 ff d1             	call   *%r9
+
+0000000000802af8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802af8:	55                   	push   %rbp
+  802af9:	48 89 e5             	mov    %rsp,%rbp
+  802afc:	53                   	push   %rbx
+  802afd:	48 83 ec 08          	sub    $0x8,%rsp
+  802b01:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802b04:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b07:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b11:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b16:	be 00 00 00 00       	mov    $0x0,%esi
+  802b1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b21:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b27:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b29:	48 85 c0             	test   %rax,%rax
+  802b2c:	7f 06                	jg     802b34 <sys_env_set_trapframe+0x3c>
+}
+  802b2e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b32:	c9                   	leave
+  802b33:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b34:	49 89 c0             	mov    %rax,%r8
+  802b37:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802b3c:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802b43:	00 00 00 
+  802b46:	be 27 00 00 00       	mov    $0x27,%esi
+  802b4b:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802b52:	00 00 00 
+  802b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5a:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802b61:	00 00 00 
+  802b64:	41 ff d1             	call   *%r9
+
+0000000000802b67 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802b67:	55                   	push   %rbp
+  802b68:	48 89 e5             	mov    %rsp,%rbp
+  802b6b:	53                   	push   %rbx
+  802b6c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b70:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802b73:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b76:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b80:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b85:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b96:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b98:	48 85 c0             	test   %rax,%rax
+  802b9b:	7f 06                	jg     802ba3 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802b9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ba1:	c9                   	leave
+  802ba2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ba3:	49 89 c0             	mov    %rax,%r8
+  802ba6:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802bab:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802bb2:	00 00 00 
+  802bb5:	be 27 00 00 00       	mov    $0x27,%esi
+  802bba:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802bc1:	00 00 00 
+  802bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc9:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802bd0:	00 00 00 
+  802bd3:	41 ff d1             	call   *%r9
+
+0000000000802bd6 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802bd6:	55                   	push   %rbp
+  802bd7:	48 89 e5             	mov    %rsp,%rbp
+  802bda:	53                   	push   %rbx
+  802bdb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802bdf:	40 0f b6 ce          	movzbl %sil,%ecx
+  802be3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802be6:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802beb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bf5:	be 00 00 00 00       	mov    $0x0,%esi
+  802bfa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c00:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c06:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c08:	48 85 c0             	test   %rax,%rax
+  802c0b:	7f 06                	jg     802c13 <sys_env_set_reclaim+0x3d>
+}
+  802c0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c11:	c9                   	leave
+  802c12:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c13:	49 89 c0             	mov    %rax,%r8
+  802c16:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802c1b:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802c22:	00 00 00 
+  802c25:	be 27 00 00 00       	mov    $0x27,%esi
+  802c2a:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802c31:	00 00 00 
+  802c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c39:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802c40:	00 00 00 
+  802c43:	41 ff d1             	call   *%r9
+
+0000000000802c46 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802c46:	55                   	push   %rbp
+  802c47:	48 89 e5             	mov    %rsp,%rbp
+  802c4a:	53                   	push   %rbx
+  802c4b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802c4f:	48 63 ce             	movslq %esi,%rcx
+  802c52:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c55:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c5f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c64:	be 00 00 00 00       	mov    $0x0,%esi
+  802c69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c75:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c77:	48 85 c0             	test   %rax,%rax
+  802c7a:	7f 06                	jg     802c82 <sys_env_set_nice+0x3c>
+}
+  802c7c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c80:	c9                   	leave
+  802c81:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c82:	49 89 c0             	mov    %rax,%r8
+  802c85:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802c8a:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802c91:	00 00 00 
+  802c94:	be 27 00 00 00       	mov    $0x27,%esi
+  802c99:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802ca0:	00 00 00 
+  802ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca8:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802caf:	00 00 00 
+  802cb2:	41 ff d1             	call   *%r9
+
+0000000000802cb5 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802cb5:	55                   	push   %rbp
+  802cb6:	48 89 e5             	mov    %rsp,%rbp
+  802cb9:	53                   	push   %rbx
+  802cba:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cbd:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ccc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cd1:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cdc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ce2:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ce4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce8:	c9                   	leave
+  802ce9:	c3                   	ret
+
+0000000000802cea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802cea:	55                   	push   %rbp
+  802ceb:	48 89 e5             	mov    %rsp,%rbp
+  802cee:	53                   	push   %rbx
+  802cef:	89 f8                	mov    %edi,%eax
+  802cf1:	49 89 f1             	mov    %rsi,%r9
+  802cf4:	48 89 d3             	mov    %rdx,%rbx
+  802cf7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802cfa:	49 63 f0             	movslq %r8d,%rsi
+  802cfd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d00:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d05:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d0e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d14:	cd 30                	int    $0x30
+}
+  802d16:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d1a:	c9                   	leave
+  802d1b:	c3                   	ret
+
+0000000000802d1c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802d1c:	55                   	push   %rbp
+  802d1d:	48 89 e5             	mov    %rsp,%rbp
+  802d20:	53                   	push   %rbx
+  802d21:	89 f8                	mov    %edi,%eax
+  802d23:	49 89 f1             	mov    %rsi,%r9
+  802d26:	48 89 d3             	mov    %rdx,%rbx
+  802d29:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802d2c:	49 63 f0             	movslq %r8d,%rsi
+  802d2f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d32:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d37:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d46:	cd 30                	int    $0x30
+}
+  802d48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4c:	c9                   	leave
+  802d4d:	c3                   	ret
+
+0000000000802d4e <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d4e:	55                   	push   %rbp
+  802d4f:	48 89 e5             	mov    %rsp,%rbp
+  802d52:	53                   	push   %rbx
+  802d53:	48 83 ec 08          	sub    $0x8,%rsp
+  802d57:	89 f8                	mov    %edi,%eax
+  802d59:	49 89 f2             	mov    %rsi,%r10
+  802d5c:	48 89 d3             	mov    %rdx,%rbx
+  802d5f:	48 89 cf             	mov    %rcx,%rdi
+  802d62:	44 89 c6             	mov    %r8d,%esi
+  802d65:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d68:	48 63 f6             	movslq %esi,%rsi
+  802d6b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d6e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d73:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d76:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d7a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d7c:	48 85 c0             	test   %rax,%rax
+  802d7f:	7f 06                	jg     802d87 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d85:	c9                   	leave
+  802d86:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d87:	49 89 c0             	mov    %rax,%r8
+  802d8a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802d8f:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802d96:	00 00 00 
+  802d99:	be 27 00 00 00       	mov    $0x27,%esi
+  802d9e:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802da5:	00 00 00 
+  802da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dad:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802db4:	00 00 00 
+  802db7:	41 ff d1             	call   *%r9
+
+0000000000802dba <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802dba:	55                   	push   %rbp
+  802dbb:	48 89 e5             	mov    %rsp,%rbp
+  802dbe:	53                   	push   %rbx
+  802dbf:	48 83 ec 08          	sub    $0x8,%rsp
+  802dc3:	48 89 f1             	mov    %rsi,%rcx
+  802dc6:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802dc9:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802dcd:	48 8b 1a             	mov    (%rdx),%rbx
+  802dd0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dd3:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dd8:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ddc:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802de0:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802de4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802de6:	48 85 c0             	test   %rax,%rax
+  802de9:	7f 06                	jg     802df1 <sys_ipc_call_short+0x37>
+}
+  802deb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802def:	c9                   	leave
+  802df0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802df1:	49 89 c0             	mov    %rax,%r8
+  802df4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802df9:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802e00:	00 00 00 
+  802e03:	be 27 00 00 00       	mov    $0x27,%esi
+  802e08:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802e0f:	00 00 00 
+  802e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e17:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802e1e:	00 00 00 
+  802e21:	41 ff d1             	call   *%r9
+
+0000000000802e24 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e24:	55                   	push   %rbp
+  802e25:	48 89 e5             	mov    %rsp,%rbp
+  802e28:	53                   	push   %rbx
+  802e29:	48 83 ec 08          	sub    $0x8,%rsp
+  802e2d:	89 f8                	mov    %edi,%eax
+  802e2f:	49 89 f2             	mov    %rsi,%r10
+  802e32:	48 89 d3             	mov    %rdx,%rbx
+  802e35:	48 89 cf             	mov    %rcx,%rdi
+  802e38:	44 89 c6             	mov    %r8d,%esi
+  802e3b:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e3e:	48 63 f6             	movslq %esi,%rsi
+  802e41:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e44:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e49:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e4c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e50:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e52:	48 85 c0             	test   %rax,%rax
+  802e55:	7f 06                	jg     802e5d <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e5b:	c9                   	leave
+  802e5c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e5d:	49 89 c0             	mov    %rax,%r8
+  802e60:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802e65:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802e6c:	00 00 00 
+  802e6f:	be 27 00 00 00       	mov    $0x27,%esi
+  802e74:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802e7b:	00 00 00 
+  802e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e83:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802e8a:	00 00 00 
+  802e8d:	41 ff d1             	call   *%r9
+
+0000000000802e90 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	53                   	push   %rbx
+  802e95:	48 83 ec 08          	sub    $0x8,%rsp
+  802e99:	48 89 fa             	mov    %rdi,%rdx
+  802e9c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802e9f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ea4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ea9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eae:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eb9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ebf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ec1:	48 85 c0             	test   %rax,%rax
+  802ec4:	7f 06                	jg     802ecc <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ec6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eca:	c9                   	leave
+  802ecb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ecc:	49 89 c0             	mov    %rax,%r8
+  802ecf:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ed4:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  802edb:	00 00 00 
+  802ede:	be 27 00 00 00       	mov    $0x27,%esi
+  802ee3:	48 bf e7 65 80 00 00 	movabs $0x8065e7,%rdi
+  802eea:	00 00 00 
+  802eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef2:	49 b9 ca 56 80 00 00 	movabs $0x8056ca,%r9
+  802ef9:	00 00 00 
+  802efc:	41 ff d1             	call   *%r9
+
+0000000000802eff <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802eff:	55                   	push   %rbp
+  802f00:	48 89 e5             	mov    %rsp,%rbp
+  802f03:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f04:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f09:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f18:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f1d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f28:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f2e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f34:	c9                   	leave
+  802f35:	c3                   	ret
+
+0000000000802f36 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802f36:	55                   	push   %rbp
+  802f37:	48 89 e5             	mov    %rsp,%rbp
+  802f3a:	53                   	push   %rbx
+  802f3b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f3e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f43:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f4d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f52:	be 00 00 00 00       	mov    $0x0,%esi
+  802f57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f63:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802f65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f69:	c9                   	leave
+  802f6a:	c3                   	ret
+
+0000000000802f6b <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802f6b:	55                   	push   %rbp
+  802f6c:	48 89 e5             	mov    %rsp,%rbp
+  802f6f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f70:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f84:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f89:	be 00 00 00 00       	mov    $0x0,%esi
+  802f8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f94:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f9a:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fa0:	c9                   	leave
+  802fa1:	c3                   	ret
+
+0000000000802fa2 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802fa2:	55                   	push   %rbp
+  802fa3:	48 89 e5             	mov    %rsp,%rbp
+  802fa6:	53                   	push   %rbx
+  802fa7:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802fab:	b8 08 00 00 00       	mov    $0x8,%eax
+  802fb0:	cd 30                	int    $0x30
+  802fb2:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  802fb4:	85 c0                	test   %eax,%eax
+  802fb6:	0f 88 85 00 00 00    	js     803041 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  802fbc:	0f 84 ac 00 00 00    	je     80306e <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  802fc2:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802fc8:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802fcf:	00 00 00 
+  802fd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fd7:	89 c2                	mov    %eax,%edx
+  802fd9:	be 00 00 00 00       	mov    $0x0,%esi
+  802fde:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe3:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  802fea:	00 00 00 
+  802fed:	ff d0                	call   *%rax
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	0f 88 a8 00 00 00    	js     80309f <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  802ff7:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ffe:	00 00 00 
+  803001:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  803008:	89 df                	mov    %ebx,%edi
+  80300a:	48 b8 67 2b 80 00 00 	movabs $0x802b67,%rax
+  803011:	00 00 00 
+  803014:	ff d0                	call   *%rax
+  803016:	85 c0                	test   %eax,%eax
+  803018:	0f 88 ae 00 00 00    	js     8030cc <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80301e:	be 02 00 00 00       	mov    $0x2,%esi
+  803023:	89 df                	mov    %ebx,%edi
+  803025:	48 b8 89 2a 80 00 00 	movabs $0x802a89,%rax
+  80302c:	00 00 00 
+  80302f:	ff d0                	call   *%rax
+  803031:	85 c0                	test   %eax,%eax
+  803033:	0f 88 c0 00 00 00    	js     8030f9 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  803039:	89 d8                	mov    %ebx,%eax
+  80303b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80303f:	c9                   	leave
+  803040:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803041:	89 c1                	mov    %eax,%ecx
+  803043:	48 ba f5 65 80 00 00 	movabs $0x8065f5,%rdx
+  80304a:	00 00 00 
+  80304d:	be 20 00 00 00       	mov    $0x20,%esi
+  803052:	48 bf 05 66 80 00 00 	movabs $0x806605,%rdi
+  803059:	00 00 00 
+  80305c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803061:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803068:	00 00 00 
+  80306b:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80306e:	48 b8 6c 28 80 00 00 	movabs $0x80286c,%rax
+  803075:	00 00 00 
+  803078:	ff d0                	call   *%rax
+  80307a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80307f:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  803086:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80308d:	00 00 00 
+  803090:	48 01 d0             	add    %rdx,%rax
+  803093:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80309a:	00 00 00 
+        return 0;
+  80309d:	eb 9a                	jmp    803039 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  80309f:	89 c1                	mov    %eax,%ecx
+  8030a1:	48 ba 10 66 80 00 00 	movabs $0x806610,%rdx
+  8030a8:	00 00 00 
+  8030ab:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8030b0:	48 bf 05 66 80 00 00 	movabs $0x806605,%rdi
+  8030b7:	00 00 00 
+  8030ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bf:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  8030c6:	00 00 00 
+  8030c9:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  8030cc:	89 c1                	mov    %eax,%ecx
+  8030ce:	48 ba 58 66 80 00 00 	movabs $0x806658,%rdx
+  8030d5:	00 00 00 
+  8030d8:	be 32 00 00 00       	mov    $0x32,%esi
+  8030dd:	48 bf 05 66 80 00 00 	movabs $0x806605,%rdi
+  8030e4:	00 00 00 
+  8030e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ec:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  8030f3:	00 00 00 
+  8030f6:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8030f9:	89 c1                	mov    %eax,%ecx
+  8030fb:	48 ba 23 66 80 00 00 	movabs $0x806623,%rdx
+  803102:	00 00 00 
+  803105:	be 37 00 00 00       	mov    $0x37,%esi
+  80310a:	48 bf 05 66 80 00 00 	movabs $0x806605,%rdi
+  803111:	00 00 00 
+  803114:	b8 00 00 00 00       	mov    $0x0,%eax
+  803119:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803120:	00 00 00 
+  803123:	41 ff d0             	call   *%r8
+
+0000000000803126 <sfork>:
+
+envid_t
+sfork() {
+  803126:	55                   	push   %rbp
+  803127:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80312a:	48 ba 3a 66 80 00 00 	movabs $0x80663a,%rdx
+  803131:	00 00 00 
+  803134:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803139:	48 bf 05 66 80 00 00 	movabs $0x806605,%rdi
+  803140:	00 00 00 
+  803143:	b8 00 00 00 00       	mov    $0x0,%eax
+  803148:	48 b9 ca 56 80 00 00 	movabs $0x8056ca,%rcx
+  80314f:	00 00 00 
+  803152:	ff d1                	call   *%rcx
+
+0000000000803154 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  803154:	85 ff                	test   %edi,%edi
+  803156:	78 58                	js     8031b0 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  803158:	48 85 f6             	test   %rsi,%rsi
+  80315b:	74 12                	je     80316f <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80315d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803164:	00 00 00 
+  803167:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80316d:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80316f:	48 85 c9             	test   %rcx,%rcx
+  803172:	74 12                	je     803186 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  803174:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80317b:	00 00 00 
+  80317e:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  803184:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  803186:	48 85 d2             	test   %rdx,%rdx
+  803189:	74 14                	je     80319f <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80318b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803192:	00 00 00 
+  803195:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80319c:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80319f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031a6:	00 00 00 
+  8031a9:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8031af:	c3                   	ret
+        if (from_env_store) {
+  8031b0:	48 85 f6             	test   %rsi,%rsi
+  8031b3:	74 06                	je     8031bb <ipc_result+0x67>
+            *from_env_store = 0;
+  8031b5:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8031bb:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8031bd:	48 85 c9             	test   %rcx,%rcx
+  8031c0:	74 ed                	je     8031af <ipc_result+0x5b>
+            *perm_store = 0;
+  8031c2:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8031c8:	c3                   	ret
+
+00000000008031c9 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8031c9:	55                   	push   %rbp
+  8031ca:	48 89 e5             	mov    %rsp,%rbp
+  8031cd:	41 55                	push   %r13
+  8031cf:	41 54                	push   %r12
+  8031d1:	53                   	push   %rbx
+  8031d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8031d6:	49 89 fc             	mov    %rdi,%r12
+  8031d9:	48 89 f7             	mov    %rsi,%rdi
+  8031dc:	48 89 d3             	mov    %rdx,%rbx
+  8031df:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8031e2:	48 85 f6             	test   %rsi,%rsi
+  8031e5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8031ec:	00 00 00 
+  8031ef:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8031f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f8:	48 85 d2             	test   %rdx,%rdx
+  8031fb:	74 03                	je     803200 <ipc_recv+0x37>
+  8031fd:	48 8b 32             	mov    (%rdx),%rsi
+  803200:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  803207:	00 00 00 
+  80320a:	ff d0                	call   *%rax
+  80320c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80320e:	4c 89 e9             	mov    %r13,%rcx
+  803211:	48 89 da             	mov    %rbx,%rdx
+  803214:	4c 89 e6             	mov    %r12,%rsi
+  803217:	48 b8 54 31 80 00 00 	movabs $0x803154,%rax
+  80321e:	00 00 00 
+  803221:	ff d0                	call   *%rax
+}
+  803223:	48 83 c4 08          	add    $0x8,%rsp
+  803227:	5b                   	pop    %rbx
+  803228:	41 5c                	pop    %r12
+  80322a:	41 5d                	pop    %r13
+  80322c:	5d                   	pop    %rbp
+  80322d:	c3                   	ret
+
+000000000080322e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80322e:	55                   	push   %rbp
+  80322f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  803232:	48 85 d2             	test   %rdx,%rdx
+  803235:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80323c:	00 00 00 
+  80323f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  803243:	89 f6                	mov    %esi,%esi
+  803245:	48 b8 1c 2d 80 00 00 	movabs $0x802d1c,%rax
+  80324c:	00 00 00 
+  80324f:	ff d0                	call   *%rax
+    if (res < 0) {
+  803251:	85 c0                	test   %eax,%eax
+  803253:	78 02                	js     803257 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  803255:	5d                   	pop    %rbp
+  803256:	c3                   	ret
+        panic("ipc_send: %i", res);
+  803257:	89 c1                	mov    %eax,%ecx
+  803259:	48 ba 77 66 80 00 00 	movabs $0x806677,%rdx
+  803260:	00 00 00 
+  803263:	be 4f 00 00 00       	mov    $0x4f,%esi
+  803268:	48 bf 84 66 80 00 00 	movabs $0x806684,%rdi
+  80326f:	00 00 00 
+  803272:	b8 00 00 00 00       	mov    $0x0,%eax
+  803277:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  80327e:	00 00 00 
+  803281:	41 ff d0             	call   *%r8
+
+0000000000803284 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  803284:	55                   	push   %rbp
+  803285:	48 89 e5             	mov    %rsp,%rbp
+  803288:	53                   	push   %rbx
+  803289:	48 83 ec 08          	sub    $0x8,%rsp
+  80328d:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803291:	48 85 d2             	test   %rdx,%rdx
+  803294:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80329b:	00 00 00 
+  80329e:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8032a2:	4d 85 c9             	test   %r9,%r9
+  8032a5:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8032a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ae:	48 85 db             	test   %rbx,%rbx
+  8032b1:	74 03                	je     8032b6 <ipc_call+0x32>
+  8032b3:	48 8b 03             	mov    (%rbx),%rax
+  8032b6:	89 f6                	mov    %esi,%esi
+  8032b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8032bc:	50                   	push   %rax
+  8032bd:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  8032c4:	00 00 00 
+  8032c7:	ff d0                	call   *%rax
+  8032c9:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8032cb:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8032cf:	48 89 da             	mov    %rbx,%rdx
+  8032d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d7:	48 b8 54 31 80 00 00 	movabs $0x803154,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+}
+  8032e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032e7:	c9                   	leave
+  8032e8:	c3                   	ret
+
+00000000008032e9 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8032e9:	55                   	push   %rbp
+  8032ea:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8032ed:	89 f6                	mov    %esi,%esi
+  8032ef:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+  8032fb:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8032fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803302:	ba 00 00 00 00       	mov    $0x0,%edx
+  803307:	be 00 00 00 00       	mov    $0x0,%esi
+  80330c:	48 b8 54 31 80 00 00 	movabs $0x803154,%rax
+  803313:	00 00 00 
+  803316:	ff d0                	call   *%rax
+}
+  803318:	5d                   	pop    %rbp
+  803319:	c3                   	ret
+
+000000000080331a <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80331a:	55                   	push   %rbp
+  80331b:	48 89 e5             	mov    %rsp,%rbp
+  80331e:	41 54                	push   %r12
+  803320:	53                   	push   %rbx
+  803321:	4c 89 cb             	mov    %r9,%rbx
+  803324:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  803328:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80332c:	48 85 d2             	test   %rdx,%rdx
+  80332f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803336:	00 00 00 
+  803339:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80333d:	4d 85 c9             	test   %r9,%r9
+  803340:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  803344:	b8 00 00 00 00       	mov    $0x0,%eax
+  803349:	4d 85 e4             	test   %r12,%r12
+  80334c:	74 04                	je     803352 <ipc_reply_wait+0x38>
+  80334e:	49 8b 04 24          	mov    (%r12),%rax
+  803352:	89 f6                	mov    %esi,%esi
+  803354:	48 83 ec 08          	sub    $0x8,%rsp
+  803358:	50                   	push   %rax
+  803359:	48 b8 24 2e 80 00 00 	movabs $0x802e24,%rax
+  803360:	00 00 00 
+  803363:	ff d0                	call   *%rax
+  803365:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  803367:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80336b:	4c 89 e2             	mov    %r12,%rdx
+  80336e:	48 89 de             	mov    %rbx,%rsi
+  803371:	48 b8 54 31 80 00 00 	movabs $0x803154,%rax
+  803378:	00 00 00 
+  80337b:	ff d0                	call   *%rax
+}
+  80337d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803381:	5b                   	pop    %rbx
+  803382:	41 5c                	pop    %r12
+  803384:	5d                   	pop    %rbp
+  803385:	c3                   	ret
+
+0000000000803386 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803386:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80338b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803392:	00 00 00 
+  803395:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80339c:	48 01 ca             	add    %rcx,%rdx
+  80339f:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8033a5:	39 fa                	cmp    %edi,%edx
+  8033a7:	74 12                	je     8033bb <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8033a9:	48 83 c0 01          	add    $0x1,%rax
+  8033ad:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8033b3:	75 e0                	jne    803395 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8033b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ba:	c3                   	ret
+            return envs[i].env_id;
+  8033bb:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8033c2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8033c9:	00 00 00 
+  8033cc:	48 01 d0             	add    %rdx,%rax
+  8033cf:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8033d5:	c3                   	ret
+
+00000000008033d6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8033dd:	ff ff ff 
+  8033e0:	48 01 f8             	add    %rdi,%rax
+  8033e3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8033e7:	c3                   	ret
+
+00000000008033e8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8033ef:	ff ff ff 
+  8033f2:	48 01 f8             	add    %rdi,%rax
+  8033f5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8033f9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8033ff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803403:	c3                   	ret
+
+0000000000803404 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803404:	55                   	push   %rbp
+  803405:	48 89 e5             	mov    %rsp,%rbp
+  803408:	41 57                	push   %r15
+  80340a:	41 56                	push   %r14
+  80340c:	41 55                	push   %r13
+  80340e:	41 54                	push   %r12
+  803410:	53                   	push   %rbx
+  803411:	48 83 ec 08          	sub    $0x8,%rsp
+  803415:	49 89 ff             	mov    %rdi,%r15
+  803418:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80341d:	49 bd 04 49 80 00 00 	movabs $0x804904,%r13
+  803424:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803427:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80342d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803430:	48 89 df             	mov    %rbx,%rdi
+  803433:	41 ff d5             	call   *%r13
+  803436:	83 e0 04             	and    $0x4,%eax
+  803439:	74 17                	je     803452 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80343b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803442:	4c 39 f3             	cmp    %r14,%rbx
+  803445:	75 e6                	jne    80342d <fd_alloc+0x29>
+  803447:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80344d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803452:	4d 89 27             	mov    %r12,(%r15)
+}
+  803455:	48 83 c4 08          	add    $0x8,%rsp
+  803459:	5b                   	pop    %rbx
+  80345a:	41 5c                	pop    %r12
+  80345c:	41 5d                	pop    %r13
+  80345e:	41 5e                	pop    %r14
+  803460:	41 5f                	pop    %r15
+  803462:	5d                   	pop    %rbp
+  803463:	c3                   	ret
+
+0000000000803464 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803464:	83 ff 1f             	cmp    $0x1f,%edi
+  803467:	77 39                	ja     8034a2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803469:	55                   	push   %rbp
+  80346a:	48 89 e5             	mov    %rsp,%rbp
+  80346d:	41 54                	push   %r12
+  80346f:	53                   	push   %rbx
+  803470:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803473:	48 63 df             	movslq %edi,%rbx
+  803476:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80347d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803481:	48 89 df             	mov    %rbx,%rdi
+  803484:	48 b8 04 49 80 00 00 	movabs $0x804904,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+  803490:	a8 04                	test   $0x4,%al
+  803492:	74 14                	je     8034a8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803494:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803498:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80349d:	5b                   	pop    %rbx
+  80349e:	41 5c                	pop    %r12
+  8034a0:	5d                   	pop    %rbp
+  8034a1:	c3                   	ret
+        return -E_INVAL;
+  8034a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8034a7:	c3                   	ret
+        return -E_INVAL;
+  8034a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034ad:	eb ee                	jmp    80349d <fd_lookup+0x39>
+
+00000000008034af <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8034af:	55                   	push   %rbp
+  8034b0:	48 89 e5             	mov    %rsp,%rbp
+  8034b3:	41 54                	push   %r12
+  8034b5:	53                   	push   %rbx
+  8034b6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8034b9:	48 b8 20 67 80 00 00 	movabs $0x806720,%rax
+  8034c0:	00 00 00 
+  8034c3:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  8034ca:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8034cd:	39 3b                	cmp    %edi,(%rbx)
+  8034cf:	74 47                	je     803518 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8034d1:	48 83 c0 08          	add    $0x8,%rax
+  8034d5:	48 8b 18             	mov    (%rax),%rbx
+  8034d8:	48 85 db             	test   %rbx,%rbx
+  8034db:	75 f0                	jne    8034cd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8034dd:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034e4:	00 00 00 
+  8034e7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034ed:	89 fa                	mov    %edi,%edx
+  8034ef:	48 bf 90 66 80 00 00 	movabs $0x806690,%rdi
+  8034f6:	00 00 00 
+  8034f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fe:	48 b9 a8 18 80 00 00 	movabs $0x8018a8,%rcx
+  803505:	00 00 00 
+  803508:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80350a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80350f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803513:	5b                   	pop    %rbx
+  803514:	41 5c                	pop    %r12
+  803516:	5d                   	pop    %rbp
+  803517:	c3                   	ret
+            return 0;
+  803518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351d:	eb f0                	jmp    80350f <dev_lookup+0x60>
+
+000000000080351f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80351f:	55                   	push   %rbp
+  803520:	48 89 e5             	mov    %rsp,%rbp
+  803523:	41 55                	push   %r13
+  803525:	41 54                	push   %r12
+  803527:	53                   	push   %rbx
+  803528:	48 83 ec 18          	sub    $0x18,%rsp
+  80352c:	48 89 fb             	mov    %rdi,%rbx
+  80352f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803532:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803539:	ff ff ff 
+  80353c:	48 01 df             	add    %rbx,%rdi
+  80353f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803543:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803547:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  80354e:	00 00 00 
+  803551:	ff d0                	call   *%rax
+  803553:	41 89 c5             	mov    %eax,%r13d
+  803556:	85 c0                	test   %eax,%eax
+  803558:	78 06                	js     803560 <fd_close+0x41>
+  80355a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80355e:	74 1a                	je     80357a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803560:	45 84 e4             	test   %r12b,%r12b
+  803563:	b8 00 00 00 00       	mov    $0x0,%eax
+  803568:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80356c:	44 89 e8             	mov    %r13d,%eax
+  80356f:	48 83 c4 18          	add    $0x18,%rsp
+  803573:	5b                   	pop    %rbx
+  803574:	41 5c                	pop    %r12
+  803576:	41 5d                	pop    %r13
+  803578:	5d                   	pop    %rbp
+  803579:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80357a:	8b 3b                	mov    (%rbx),%edi
+  80357c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803580:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  803587:	00 00 00 
+  80358a:	ff d0                	call   *%rax
+  80358c:	41 89 c5             	mov    %eax,%r13d
+  80358f:	85 c0                	test   %eax,%eax
+  803591:	78 1b                	js     8035ae <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803593:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803597:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80359b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8035a1:	48 85 c0             	test   %rax,%rax
+  8035a4:	74 08                	je     8035ae <fd_close+0x8f>
+  8035a6:	48 89 df             	mov    %rbx,%rdi
+  8035a9:	ff d0                	call   *%rax
+  8035ab:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8035ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035b3:	48 89 de             	mov    %rbx,%rsi
+  8035b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035bb:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+    return res;
+  8035c7:	eb a3                	jmp    80356c <fd_close+0x4d>
+
+00000000008035c9 <close>:
+
+int
+close(int fdnum) {
+  8035c9:	55                   	push   %rbp
+  8035ca:	48 89 e5             	mov    %rsp,%rbp
+  8035cd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035d1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035d5:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  8035dc:	00 00 00 
+  8035df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	78 15                	js     8035fa <close+0x31>
+
+    return fd_close(fd, 1);
+  8035e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8035ea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035ee:	48 b8 1f 35 80 00 00 	movabs $0x80351f,%rax
+  8035f5:	00 00 00 
+  8035f8:	ff d0                	call   *%rax
+}
+  8035fa:	c9                   	leave
+  8035fb:	c3                   	ret
+
+00000000008035fc <close_all>:
+
+void
+close_all(void) {
+  8035fc:	55                   	push   %rbp
+  8035fd:	48 89 e5             	mov    %rsp,%rbp
+  803600:	41 54                	push   %r12
+  803602:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803603:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803608:	49 bc c9 35 80 00 00 	movabs $0x8035c9,%r12
+  80360f:	00 00 00 
+  803612:	89 df                	mov    %ebx,%edi
+  803614:	41 ff d4             	call   *%r12
+  803617:	83 c3 01             	add    $0x1,%ebx
+  80361a:	83 fb 20             	cmp    $0x20,%ebx
+  80361d:	75 f3                	jne    803612 <close_all+0x16>
+}
+  80361f:	5b                   	pop    %rbx
+  803620:	41 5c                	pop    %r12
+  803622:	5d                   	pop    %rbp
+  803623:	c3                   	ret
+
+0000000000803624 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803624:	55                   	push   %rbp
+  803625:	48 89 e5             	mov    %rsp,%rbp
+  803628:	41 57                	push   %r15
+  80362a:	41 56                	push   %r14
+  80362c:	41 55                	push   %r13
+  80362e:	41 54                	push   %r12
+  803630:	53                   	push   %rbx
+  803631:	48 83 ec 18          	sub    $0x18,%rsp
+  803635:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803638:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80363c:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  803643:	00 00 00 
+  803646:	ff d0                	call   *%rax
+  803648:	89 c3                	mov    %eax,%ebx
+  80364a:	85 c0                	test   %eax,%eax
+  80364c:	0f 88 b8 00 00 00    	js     80370a <dup+0xe6>
+    close(newfdnum);
+  803652:	44 89 e7             	mov    %r12d,%edi
+  803655:	48 b8 c9 35 80 00 00 	movabs $0x8035c9,%rax
+  80365c:	00 00 00 
+  80365f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803661:	4d 63 ec             	movslq %r12d,%r13
+  803664:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80366b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80366f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803673:	4c 89 ff             	mov    %r15,%rdi
+  803676:	49 be e8 33 80 00 00 	movabs $0x8033e8,%r14
+  80367d:	00 00 00 
+  803680:	41 ff d6             	call   *%r14
+  803683:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803686:	4c 89 ef             	mov    %r13,%rdi
+  803689:	41 ff d6             	call   *%r14
+  80368c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80368f:	48 89 df             	mov    %rbx,%rdi
+  803692:	48 b8 04 49 80 00 00 	movabs $0x804904,%rax
+  803699:	00 00 00 
+  80369c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80369e:	a8 04                	test   $0x4,%al
+  8036a0:	74 2b                	je     8036cd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8036a2:	41 89 c1             	mov    %eax,%r9d
+  8036a5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8036ab:	4c 89 f1             	mov    %r14,%rcx
+  8036ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036b3:	48 89 de             	mov    %rbx,%rsi
+  8036b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036bb:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+  8036c7:	89 c3                	mov    %eax,%ebx
+  8036c9:	85 c0                	test   %eax,%eax
+  8036cb:	78 4e                	js     80371b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8036cd:	4c 89 ff             	mov    %r15,%rdi
+  8036d0:	48 b8 04 49 80 00 00 	movabs $0x804904,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+  8036dc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8036df:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8036e5:	4c 89 e9             	mov    %r13,%rcx
+  8036e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036ed:	4c 89 fe             	mov    %r15,%rsi
+  8036f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f5:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  8036fc:	00 00 00 
+  8036ff:	ff d0                	call   *%rax
+  803701:	89 c3                	mov    %eax,%ebx
+  803703:	85 c0                	test   %eax,%eax
+  803705:	78 14                	js     80371b <dup+0xf7>
+
+    return newfdnum;
+  803707:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80370a:	89 d8                	mov    %ebx,%eax
+  80370c:	48 83 c4 18          	add    $0x18,%rsp
+  803710:	5b                   	pop    %rbx
+  803711:	41 5c                	pop    %r12
+  803713:	41 5d                	pop    %r13
+  803715:	41 5e                	pop    %r14
+  803717:	41 5f                	pop    %r15
+  803719:	5d                   	pop    %rbp
+  80371a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80371b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803720:	4c 89 ee             	mov    %r13,%rsi
+  803723:	bf 00 00 00 00       	mov    $0x0,%edi
+  803728:	49 bc 1c 2a 80 00 00 	movabs $0x802a1c,%r12
+  80372f:	00 00 00 
+  803732:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803735:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80373a:	4c 89 f6             	mov    %r14,%rsi
+  80373d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803742:	41 ff d4             	call   *%r12
+    return res;
+  803745:	eb c3                	jmp    80370a <dup+0xe6>
+
+0000000000803747 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803747:	55                   	push   %rbp
+  803748:	48 89 e5             	mov    %rsp,%rbp
+  80374b:	41 56                	push   %r14
+  80374d:	41 55                	push   %r13
+  80374f:	41 54                	push   %r12
+  803751:	53                   	push   %rbx
+  803752:	48 83 ec 10          	sub    $0x10,%rsp
+  803756:	89 fb                	mov    %edi,%ebx
+  803758:	49 89 f4             	mov    %rsi,%r12
+  80375b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80375e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803762:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  803769:	00 00 00 
+  80376c:	ff d0                	call   *%rax
+  80376e:	85 c0                	test   %eax,%eax
+  803770:	78 4c                	js     8037be <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803772:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803776:	41 8b 3e             	mov    (%r14),%edi
+  803779:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80377d:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  803784:	00 00 00 
+  803787:	ff d0                	call   *%rax
+  803789:	85 c0                	test   %eax,%eax
+  80378b:	78 35                	js     8037c2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80378d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803791:	83 e0 03             	and    $0x3,%eax
+  803794:	83 f8 01             	cmp    $0x1,%eax
+  803797:	74 2d                	je     8037c6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803799:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80379d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8037a1:	48 85 c0             	test   %rax,%rax
+  8037a4:	74 56                	je     8037fc <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8037a6:	4c 89 ea             	mov    %r13,%rdx
+  8037a9:	4c 89 e6             	mov    %r12,%rsi
+  8037ac:	4c 89 f7             	mov    %r14,%rdi
+  8037af:	ff d0                	call   *%rax
+}
+  8037b1:	48 83 c4 10          	add    $0x10,%rsp
+  8037b5:	5b                   	pop    %rbx
+  8037b6:	41 5c                	pop    %r12
+  8037b8:	41 5d                	pop    %r13
+  8037ba:	41 5e                	pop    %r14
+  8037bc:	5d                   	pop    %rbp
+  8037bd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037be:	48 98                	cltq
+  8037c0:	eb ef                	jmp    8037b1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037c2:	48 98                	cltq
+  8037c4:	eb eb                	jmp    8037b1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037c6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8037cd:	00 00 00 
+  8037d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8037d6:	89 da                	mov    %ebx,%edx
+  8037d8:	48 bf d1 66 80 00 00 	movabs $0x8066d1,%rdi
+  8037df:	00 00 00 
+  8037e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e7:	48 b9 a8 18 80 00 00 	movabs $0x8018a8,%rcx
+  8037ee:	00 00 00 
+  8037f1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8037f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037fa:	eb b5                	jmp    8037b1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8037fc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803803:	eb ac                	jmp    8037b1 <read+0x6a>
+
+0000000000803805 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803805:	55                   	push   %rbp
+  803806:	48 89 e5             	mov    %rsp,%rbp
+  803809:	41 57                	push   %r15
+  80380b:	41 56                	push   %r14
+  80380d:	41 55                	push   %r13
+  80380f:	41 54                	push   %r12
+  803811:	53                   	push   %rbx
+  803812:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803816:	48 85 d2             	test   %rdx,%rdx
+  803819:	74 54                	je     80386f <readn+0x6a>
+  80381b:	41 89 fd             	mov    %edi,%r13d
+  80381e:	49 89 f6             	mov    %rsi,%r14
+  803821:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803824:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803829:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80382e:	49 bf 47 37 80 00 00 	movabs $0x803747,%r15
+  803835:	00 00 00 
+  803838:	4c 89 e2             	mov    %r12,%rdx
+  80383b:	48 29 f2             	sub    %rsi,%rdx
+  80383e:	4c 01 f6             	add    %r14,%rsi
+  803841:	44 89 ef             	mov    %r13d,%edi
+  803844:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803847:	85 c0                	test   %eax,%eax
+  803849:	78 20                	js     80386b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80384b:	01 c3                	add    %eax,%ebx
+  80384d:	85 c0                	test   %eax,%eax
+  80384f:	74 08                	je     803859 <readn+0x54>
+  803851:	48 63 f3             	movslq %ebx,%rsi
+  803854:	4c 39 e6             	cmp    %r12,%rsi
+  803857:	72 df                	jb     803838 <readn+0x33>
+    }
+    return res;
+  803859:	48 63 c3             	movslq %ebx,%rax
+}
+  80385c:	48 83 c4 08          	add    $0x8,%rsp
+  803860:	5b                   	pop    %rbx
+  803861:	41 5c                	pop    %r12
+  803863:	41 5d                	pop    %r13
+  803865:	41 5e                	pop    %r14
+  803867:	41 5f                	pop    %r15
+  803869:	5d                   	pop    %rbp
+  80386a:	c3                   	ret
+        if (inc < 0) return inc;
+  80386b:	48 98                	cltq
+  80386d:	eb ed                	jmp    80385c <readn+0x57>
+    int inc = 1, res = 0;
+  80386f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803874:	eb e3                	jmp    803859 <readn+0x54>
+
+0000000000803876 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803876:	55                   	push   %rbp
+  803877:	48 89 e5             	mov    %rsp,%rbp
+  80387a:	41 56                	push   %r14
+  80387c:	41 55                	push   %r13
+  80387e:	41 54                	push   %r12
+  803880:	53                   	push   %rbx
+  803881:	48 83 ec 10          	sub    $0x10,%rsp
+  803885:	89 fb                	mov    %edi,%ebx
+  803887:	49 89 f4             	mov    %rsi,%r12
+  80388a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80388d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803891:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  803898:	00 00 00 
+  80389b:	ff d0                	call   *%rax
+  80389d:	85 c0                	test   %eax,%eax
+  80389f:	78 47                	js     8038e8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038a1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8038a5:	41 8b 3e             	mov    (%r14),%edi
+  8038a8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038ac:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  8038b3:	00 00 00 
+  8038b6:	ff d0                	call   *%rax
+  8038b8:	85 c0                	test   %eax,%eax
+  8038ba:	78 30                	js     8038ec <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038bc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8038c1:	74 2d                	je     8038f0 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8038c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038c7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8038cb:	48 85 c0             	test   %rax,%rax
+  8038ce:	74 56                	je     803926 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8038d0:	4c 89 ea             	mov    %r13,%rdx
+  8038d3:	4c 89 e6             	mov    %r12,%rsi
+  8038d6:	4c 89 f7             	mov    %r14,%rdi
+  8038d9:	ff d0                	call   *%rax
+}
+  8038db:	48 83 c4 10          	add    $0x10,%rsp
+  8038df:	5b                   	pop    %rbx
+  8038e0:	41 5c                	pop    %r12
+  8038e2:	41 5d                	pop    %r13
+  8038e4:	41 5e                	pop    %r14
+  8038e6:	5d                   	pop    %rbp
+  8038e7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038e8:	48 98                	cltq
+  8038ea:	eb ef                	jmp    8038db <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038ec:	48 98                	cltq
+  8038ee:	eb eb                	jmp    8038db <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8038f0:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8038f7:	00 00 00 
+  8038fa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803900:	89 da                	mov    %ebx,%edx
+  803902:	48 bf ed 66 80 00 00 	movabs $0x8066ed,%rdi
+  803909:	00 00 00 
+  80390c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803911:	48 b9 a8 18 80 00 00 	movabs $0x8018a8,%rcx
+  803918:	00 00 00 
+  80391b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80391d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803924:	eb b5                	jmp    8038db <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803926:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80392d:	eb ac                	jmp    8038db <write+0x65>
+
+000000000080392f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80392f:	55                   	push   %rbp
+  803930:	48 89 e5             	mov    %rsp,%rbp
+  803933:	53                   	push   %rbx
+  803934:	48 83 ec 18          	sub    $0x18,%rsp
+  803938:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80393a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80393e:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  803945:	00 00 00 
+  803948:	ff d0                	call   *%rax
+  80394a:	85 c0                	test   %eax,%eax
+  80394c:	78 0c                	js     80395a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80394e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803952:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803955:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80395a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80395e:	c9                   	leave
+  80395f:	c3                   	ret
+
+0000000000803960 <tell>:
+
+int tell(int fdnum) {
+  803960:	55                   	push   %rbp
+  803961:	48 89 e5             	mov    %rsp,%rbp
+  803964:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803968:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80396c:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  803973:	00 00 00 
+  803976:	ff d0                	call   *%rax
+  803978:	85 c0                	test   %eax,%eax
+  80397a:	78 07                	js     803983 <tell+0x23>
+
+    return fd->fd_offset;
+  80397c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803980:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803983:	c9                   	leave
+  803984:	c3                   	ret
+
+0000000000803985 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803985:	55                   	push   %rbp
+  803986:	48 89 e5             	mov    %rsp,%rbp
+  803989:	41 55                	push   %r13
+  80398b:	41 54                	push   %r12
+  80398d:	53                   	push   %rbx
+  80398e:	48 83 ec 18          	sub    $0x18,%rsp
+  803992:	89 fb                	mov    %edi,%ebx
+  803994:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803997:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80399b:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  8039a2:	00 00 00 
+  8039a5:	ff d0                	call   *%rax
+  8039a7:	85 c0                	test   %eax,%eax
+  8039a9:	78 38                	js     8039e3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8039ab:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8039af:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8039b3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8039b7:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  8039be:	00 00 00 
+  8039c1:	ff d0                	call   *%rax
+  8039c3:	85 c0                	test   %eax,%eax
+  8039c5:	78 1c                	js     8039e3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8039c7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8039cc:	74 20                	je     8039ee <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8039ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039d2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8039d6:	48 85 c0             	test   %rax,%rax
+  8039d9:	74 47                	je     803a22 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8039db:	44 89 e6             	mov    %r12d,%esi
+  8039de:	4c 89 ef             	mov    %r13,%rdi
+  8039e1:	ff d0                	call   *%rax
+}
+  8039e3:	48 83 c4 18          	add    $0x18,%rsp
+  8039e7:	5b                   	pop    %rbx
+  8039e8:	41 5c                	pop    %r12
+  8039ea:	41 5d                	pop    %r13
+  8039ec:	5d                   	pop    %rbp
+  8039ed:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8039ee:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8039f5:	00 00 00 
+  8039f8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8039fe:	89 da                	mov    %ebx,%edx
+  803a00:	48 bf b0 66 80 00 00 	movabs $0x8066b0,%rdi
+  803a07:	00 00 00 
+  803a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a0f:	48 b9 a8 18 80 00 00 	movabs $0x8018a8,%rcx
+  803a16:	00 00 00 
+  803a19:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803a1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a20:	eb c1                	jmp    8039e3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803a22:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a27:	eb ba                	jmp    8039e3 <ftruncate+0x5e>
+
+0000000000803a29 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803a29:	55                   	push   %rbp
+  803a2a:	48 89 e5             	mov    %rsp,%rbp
+  803a2d:	41 54                	push   %r12
+  803a2f:	53                   	push   %rbx
+  803a30:	48 83 ec 10          	sub    $0x10,%rsp
+  803a34:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a37:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803a3b:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  803a42:	00 00 00 
+  803a45:	ff d0                	call   *%rax
+  803a47:	85 c0                	test   %eax,%eax
+  803a49:	78 63                	js     803aae <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803a4b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803a4f:	41 8b 3c 24          	mov    (%r12),%edi
+  803a53:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803a57:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  803a5e:	00 00 00 
+  803a61:	ff d0                	call   *%rax
+  803a63:	85 c0                	test   %eax,%eax
+  803a65:	78 47                	js     803aae <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a6b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803a70:	74 45                	je     803ab7 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803a72:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803a75:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803a7c:	00 00 00 
+    stat->st_isdir = 0;
+  803a7f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a86:	00 00 00 
+    stat->st_ino = 0;
+  803a89:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803a90:	00 00 00 00 
+    stat->st_version = 0;
+  803a94:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803a9b:	00 00 00 
+    stat->st_dev = dev;
+  803a9e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803aa5:	48 89 de             	mov    %rbx,%rsi
+  803aa8:	4c 89 e7             	mov    %r12,%rdi
+  803aab:	ff 50 28             	call   *0x28(%rax)
+}
+  803aae:	48 83 c4 10          	add    $0x10,%rsp
+  803ab2:	5b                   	pop    %rbx
+  803ab3:	41 5c                	pop    %r12
+  803ab5:	5d                   	pop    %rbp
+  803ab6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803ab7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803abc:	eb f0                	jmp    803aae <fstat+0x85>
+
+0000000000803abe <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803abe:	55                   	push   %rbp
+  803abf:	48 89 e5             	mov    %rsp,%rbp
+  803ac2:	41 54                	push   %r12
+  803ac4:	53                   	push   %rbx
+  803ac5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803ac8:	be 00 00 00 00       	mov    $0x0,%esi
+  803acd:	48 b8 df 3f 80 00 00 	movabs $0x803fdf,%rax
+  803ad4:	00 00 00 
+  803ad7:	ff d0                	call   *%rax
+  803ad9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803adb:	85 c0                	test   %eax,%eax
+  803add:	78 25                	js     803b04 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803adf:	4c 89 e6             	mov    %r12,%rsi
+  803ae2:	89 c7                	mov    %eax,%edi
+  803ae4:	48 b8 29 3a 80 00 00 	movabs $0x803a29,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+  803af0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803af3:	89 df                	mov    %ebx,%edi
+  803af5:	48 b8 c9 35 80 00 00 	movabs $0x8035c9,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+
+    return res;
+  803b01:	44 89 e3             	mov    %r12d,%ebx
+}
+  803b04:	89 d8                	mov    %ebx,%eax
+  803b06:	5b                   	pop    %rbx
+  803b07:	41 5c                	pop    %r12
+  803b09:	5d                   	pop    %rbp
+  803b0a:	c3                   	ret
+
+0000000000803b0b <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b0b:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803b12:	00 00 00 
+  803b15:	83 38 00             	cmpl   $0x0,(%rax)
+  803b18:	74 0a                	je     803b24 <fsipc_env+0x19>
+    return fsenv;
+}
+  803b1a:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803b21:	00 00 
+  803b23:	c3                   	ret
+fsipc_env(void) {
+  803b24:	55                   	push   %rbp
+  803b25:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b28:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b2d:	48 b8 86 33 80 00 00 	movabs $0x803386,%rax
+  803b34:	00 00 00 
+  803b37:	ff d0                	call   *%rax
+  803b39:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803b40:	00 00 
+}
+  803b42:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803b49:	00 00 
+  803b4b:	5d                   	pop    %rbp
+  803b4c:	c3                   	ret
+
+0000000000803b4d <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803b4d:	55                   	push   %rbp
+  803b4e:	48 89 e5             	mov    %rsp,%rbp
+  803b51:	53                   	push   %rbx
+  803b52:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803b56:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803b5d:	00 
+  803b5e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803b65:	00 
+  803b66:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803b6d:	00 
+  803b6e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803b75:	00 
+  803b76:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803b7d:	00 
+
+    assert(size <= sizeof(words));
+  803b7e:	48 83 fa 28          	cmp    $0x28,%rdx
+  803b82:	77 38                	ja     803bbc <fsipc_short+0x6f>
+  803b84:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803b86:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b8a:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  803b91:	00 00 00 
+  803b94:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803b96:	48 b8 0b 3b 80 00 00 	movabs $0x803b0b,%rax
+  803b9d:	00 00 00 
+  803ba0:	ff d0                	call   *%rax
+  803ba2:	89 c7                	mov    %eax,%edi
+  803ba4:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803ba8:	89 de                	mov    %ebx,%esi
+  803baa:	48 b8 e9 32 80 00 00 	movabs $0x8032e9,%rax
+  803bb1:	00 00 00 
+  803bb4:	ff d0                	call   *%rax
+}
+  803bb6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bba:	c9                   	leave
+  803bbb:	c3                   	ret
+    assert(size <= sizeof(words));
+  803bbc:	48 b9 40 67 80 00 00 	movabs $0x806740,%rcx
+  803bc3:	00 00 00 
+  803bc6:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  803bcd:	00 00 00 
+  803bd0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803bd5:	48 bf 6b 67 80 00 00 	movabs $0x80676b,%rdi
+  803bdc:	00 00 00 
+  803bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be4:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803beb:	00 00 00 
+  803bee:	41 ff d0             	call   *%r8
+
+0000000000803bf1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803bf1:	55                   	push   %rbp
+  803bf2:	48 89 e5             	mov    %rsp,%rbp
+  803bf5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803bf9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bfc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803bff:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803c02:	ba 08 00 00 00       	mov    $0x8,%edx
+  803c07:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c0b:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c10:	48 b8 4d 3b 80 00 00 	movabs $0x803b4d,%rax
+  803c17:	00 00 00 
+  803c1a:	ff d0                	call   *%rax
+}
+  803c1c:	c9                   	leave
+  803c1d:	c3                   	ret
+
+0000000000803c1e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803c1e:	55                   	push   %rbp
+  803c1f:	48 89 e5             	mov    %rsp,%rbp
+  803c22:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803c26:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c29:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803c2c:	ba 04 00 00 00       	mov    $0x4,%edx
+  803c31:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803c35:	bf 06 00 00 00       	mov    $0x6,%edi
+  803c3a:	48 b8 4d 3b 80 00 00 	movabs $0x803b4d,%rax
+  803c41:	00 00 00 
+  803c44:	ff d0                	call   *%rax
+}
+  803c46:	c9                   	leave
+  803c47:	c3                   	ret
+
+0000000000803c48 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803c48:	55                   	push   %rbp
+  803c49:	48 89 e5             	mov    %rsp,%rbp
+  803c4c:	41 54                	push   %r12
+  803c4e:	53                   	push   %rbx
+  803c4f:	48 83 ec 10          	sub    $0x10,%rsp
+  803c53:	89 fb                	mov    %edi,%ebx
+  803c55:	49 89 f4             	mov    %rsi,%r12
+  803c58:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803c5c:	48 b8 0b 3b 80 00 00 	movabs $0x803b0b,%rax
+  803c63:	00 00 00 
+  803c66:	ff d0                	call   *%rax
+  803c68:	89 c7                	mov    %eax,%edi
+  803c6a:	6a 00                	push   $0x0
+  803c6c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803c70:	50                   	push   %rax
+  803c71:	4d 89 e1             	mov    %r12,%r9
+  803c74:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803c7a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c7f:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803c86:	00 00 00 
+  803c89:	89 de                	mov    %ebx,%esi
+  803c8b:	48 b8 84 32 80 00 00 	movabs $0x803284,%rax
+  803c92:	00 00 00 
+  803c95:	ff d0                	call   *%rax
+}
+  803c97:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c9b:	5b                   	pop    %rbx
+  803c9c:	41 5c                	pop    %r12
+  803c9e:	5d                   	pop    %rbp
+  803c9f:	c3                   	ret
+
+0000000000803ca0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803ca0:	55                   	push   %rbp
+  803ca1:	48 89 e5             	mov    %rsp,%rbp
+  803ca4:	41 54                	push   %r12
+  803ca6:	53                   	push   %rbx
+  803ca7:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803caa:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803cad:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803cb4:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803cb6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cbb:	be 00 00 00 00       	mov    $0x0,%esi
+  803cc0:	bf 05 00 00 00       	mov    $0x5,%edi
+  803cc5:	48 b8 48 3c 80 00 00 	movabs $0x803c48,%rax
+  803ccc:	00 00 00 
+  803ccf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cd1:	85 c0                	test   %eax,%eax
+  803cd3:	78 5a                	js     803d2f <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803cd5:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803cdc:	00 00 00 
+  803cdf:	4c 89 e6             	mov    %r12,%rsi
+  803ce2:	48 89 df             	mov    %rbx,%rdi
+  803ce5:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  803cec:	00 00 00 
+  803cef:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803cf1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803cf8:	00 
+  803cf9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803cff:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803d06:	00 
+  803d07:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803d0d:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803d14:	00 
+  803d15:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803d1c:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803d23:	00 
+  803d24:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d2f:	5b                   	pop    %rbx
+  803d30:	41 5c                	pop    %r12
+  803d32:	5d                   	pop    %rbp
+  803d33:	c3                   	ret
+
+0000000000803d34 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803d34:	55                   	push   %rbp
+  803d35:	48 89 e5             	mov    %rsp,%rbp
+  803d38:	41 57                	push   %r15
+  803d3a:	41 56                	push   %r14
+  803d3c:	41 55                	push   %r13
+  803d3e:	41 54                	push   %r12
+  803d40:	53                   	push   %rbx
+  803d41:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803d45:	48 85 ff             	test   %rdi,%rdi
+  803d48:	0f 84 a1 00 00 00    	je     803def <devfile_read+0xbb>
+  803d4e:	49 89 ff             	mov    %rdi,%r15
+  803d51:	49 89 f5             	mov    %rsi,%r13
+  803d54:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803d57:	48 85 f6             	test   %rsi,%rsi
+  803d5a:	0f 84 c4 00 00 00    	je     803e24 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803d60:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803d67:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803d68:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803d6f:	00 00 00 
+  803d72:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d76:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803d79:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d82:	be 00 00 00 00       	mov    $0x0,%esi
+  803d87:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d8c:	48 b8 48 3c 80 00 00 	movabs $0x803c48,%rax
+  803d93:	00 00 00 
+  803d96:	ff d0                	call   *%rax
+        if (res < 0) {
+  803d98:	85 c0                	test   %eax,%eax
+  803d9a:	0f 88 b9 00 00 00    	js     803e59 <devfile_read+0x125>
+        assert(res <= n);
+  803da0:	48 63 d8             	movslq %eax,%rbx
+  803da3:	49 39 dc             	cmp    %rbx,%r12
+  803da6:	0f 82 b1 00 00 00    	jb     803e5d <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803dac:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803db1:	0f 87 db 00 00 00    	ja     803e92 <devfile_read+0x15e>
+        if (!res) {
+  803db7:	85 c0                	test   %eax,%eax
+  803db9:	74 21                	je     803ddc <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803dbb:	48 89 da             	mov    %rbx,%rdx
+  803dbe:	4c 89 f6             	mov    %r14,%rsi
+  803dc1:	4c 89 ef             	mov    %r13,%rdi
+  803dc4:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  803dcb:	00 00 00 
+  803dce:	ff d0                	call   *%rax
+        total_read += res;
+  803dd0:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803dd4:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803dd7:	49 29 dc             	sub    %rbx,%r12
+  803dda:	75 96                	jne    803d72 <devfile_read+0x3e>
+    return total_read;
+  803ddc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803de0:	48 83 c4 18          	add    $0x18,%rsp
+  803de4:	5b                   	pop    %rbx
+  803de5:	41 5c                	pop    %r12
+  803de7:	41 5d                	pop    %r13
+  803de9:	41 5e                	pop    %r14
+  803deb:	41 5f                	pop    %r15
+  803ded:	5d                   	pop    %rbp
+  803dee:	c3                   	ret
+    assert(fd);
+  803def:	48 b9 76 67 80 00 00 	movabs $0x806776,%rcx
+  803df6:	00 00 00 
+  803df9:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  803e00:	00 00 00 
+  803e03:	be 91 00 00 00       	mov    $0x91,%esi
+  803e08:	48 bf 6b 67 80 00 00 	movabs $0x80676b,%rdi
+  803e0f:	00 00 00 
+  803e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e17:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803e1e:	00 00 00 
+  803e21:	41 ff d0             	call   *%r8
+    assert(buf);
+  803e24:	48 b9 79 67 80 00 00 	movabs $0x806779,%rcx
+  803e2b:	00 00 00 
+  803e2e:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  803e35:	00 00 00 
+  803e38:	be 92 00 00 00       	mov    $0x92,%esi
+  803e3d:	48 bf 6b 67 80 00 00 	movabs $0x80676b,%rdi
+  803e44:	00 00 00 
+  803e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4c:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803e53:	00 00 00 
+  803e56:	41 ff d0             	call   *%r8
+            return res;
+  803e59:	48 98                	cltq
+  803e5b:	eb 83                	jmp    803de0 <devfile_read+0xac>
+        assert(res <= n);
+  803e5d:	48 b9 7d 67 80 00 00 	movabs $0x80677d,%rcx
+  803e64:	00 00 00 
+  803e67:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  803e6e:	00 00 00 
+  803e71:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803e76:	48 bf 6b 67 80 00 00 	movabs $0x80676b,%rdi
+  803e7d:	00 00 00 
+  803e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e85:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803e8c:	00 00 00 
+  803e8f:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803e92:	48 b9 88 67 80 00 00 	movabs $0x806788,%rcx
+  803e99:	00 00 00 
+  803e9c:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  803ea3:	00 00 00 
+  803ea6:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803eab:	48 bf 6b 67 80 00 00 	movabs $0x80676b,%rdi
+  803eb2:	00 00 00 
+  803eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eba:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803ec1:	00 00 00 
+  803ec4:	41 ff d0             	call   *%r8
+
+0000000000803ec7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803ec7:	55                   	push   %rbp
+  803ec8:	48 89 e5             	mov    %rsp,%rbp
+  803ecb:	41 57                	push   %r15
+  803ecd:	41 56                	push   %r14
+  803ecf:	41 55                	push   %r13
+  803ed1:	41 54                	push   %r12
+  803ed3:	53                   	push   %rbx
+  803ed4:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803ed8:	48 85 ff             	test   %rdi,%rdi
+  803edb:	0f 84 83 00 00 00    	je     803f64 <devfile_write+0x9d>
+  803ee1:	49 89 ff             	mov    %rdi,%r15
+  803ee4:	49 89 f4             	mov    %rsi,%r12
+  803ee7:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803eea:	48 85 f6             	test   %rsi,%rsi
+  803eed:	0f 84 a6 00 00 00    	je     803f99 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803ef3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ef9:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803f00:	00 00 00 
+  803f03:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f07:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803f0a:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803f0e:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803f13:	48 39 d3             	cmp    %rdx,%rbx
+  803f16:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803f1a:	4c 89 e6             	mov    %r12,%rsi
+  803f1d:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803f24:	00 00 00 
+  803f27:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  803f2e:	00 00 00 
+  803f31:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f38:	be 00 00 00 00       	mov    $0x0,%esi
+  803f3d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803f42:	48 b8 48 3c 80 00 00 	movabs $0x803c48,%rax
+  803f49:	00 00 00 
+  803f4c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803f4e:	85 c0                	test   %eax,%eax
+  803f50:	78 7c                	js     803fce <devfile_write+0x107>
+        total_written += res;
+  803f52:	48 98                	cltq
+  803f54:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803f57:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803f5a:	48 29 c3             	sub    %rax,%rbx
+  803f5d:	75 a4                	jne    803f03 <devfile_write+0x3c>
+    return total_written;
+  803f5f:	4c 89 e8             	mov    %r13,%rax
+  803f62:	eb 6c                	jmp    803fd0 <devfile_write+0x109>
+    assert(fd);
+  803f64:	48 b9 76 67 80 00 00 	movabs $0x806776,%rcx
+  803f6b:	00 00 00 
+  803f6e:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  803f75:	00 00 00 
+  803f78:	be bd 00 00 00       	mov    $0xbd,%esi
+  803f7d:	48 bf 6b 67 80 00 00 	movabs $0x80676b,%rdi
+  803f84:	00 00 00 
+  803f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f8c:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803f93:	00 00 00 
+  803f96:	41 ff d0             	call   *%r8
+    assert(buf);
+  803f99:	48 b9 79 67 80 00 00 	movabs $0x806779,%rcx
+  803fa0:	00 00 00 
+  803fa3:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  803faa:	00 00 00 
+  803fad:	be be 00 00 00       	mov    $0xbe,%esi
+  803fb2:	48 bf 6b 67 80 00 00 	movabs $0x80676b,%rdi
+  803fb9:	00 00 00 
+  803fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc1:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  803fc8:	00 00 00 
+  803fcb:	41 ff d0             	call   *%r8
+            return res;
+  803fce:	48 98                	cltq
+}
+  803fd0:	48 83 c4 08          	add    $0x8,%rsp
+  803fd4:	5b                   	pop    %rbx
+  803fd5:	41 5c                	pop    %r12
+  803fd7:	41 5d                	pop    %r13
+  803fd9:	41 5e                	pop    %r14
+  803fdb:	41 5f                	pop    %r15
+  803fdd:	5d                   	pop    %rbp
+  803fde:	c3                   	ret
+
+0000000000803fdf <open>:
+open(const char *path, int mode) {
+  803fdf:	55                   	push   %rbp
+  803fe0:	48 89 e5             	mov    %rsp,%rbp
+  803fe3:	41 55                	push   %r13
+  803fe5:	41 54                	push   %r12
+  803fe7:	53                   	push   %rbx
+  803fe8:	48 83 ec 18          	sub    $0x18,%rsp
+  803fec:	49 89 fc             	mov    %rdi,%r12
+  803fef:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803ff2:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  803ff9:	00 00 00 
+  803ffc:	ff d0                	call   *%rax
+  803ffe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804004:	0f 87 8f 00 00 00    	ja     804099 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80400a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80400e:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  804015:	00 00 00 
+  804018:	ff d0                	call   *%rax
+  80401a:	89 c3                	mov    %eax,%ebx
+  80401c:	85 c0                	test   %eax,%eax
+  80401e:	78 55                	js     804075 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  804020:	4c 89 e6             	mov    %r12,%rsi
+  804023:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  80402a:	00 00 00 
+  80402d:	48 89 df             	mov    %rbx,%rdi
+  804030:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  804037:	00 00 00 
+  80403a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80403c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804043:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804048:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80404c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804051:	48 b8 48 3c 80 00 00 	movabs $0x803c48,%rax
+  804058:	00 00 00 
+  80405b:	ff d0                	call   *%rax
+  80405d:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80405f:	85 c0                	test   %eax,%eax
+  804061:	78 1f                	js     804082 <open+0xa3>
+    return fd2num(fd);
+  804063:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804067:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+  804073:	89 c3                	mov    %eax,%ebx
+}
+  804075:	89 d8                	mov    %ebx,%eax
+  804077:	48 83 c4 18          	add    $0x18,%rsp
+  80407b:	5b                   	pop    %rbx
+  80407c:	41 5c                	pop    %r12
+  80407e:	41 5d                	pop    %r13
+  804080:	5d                   	pop    %rbp
+  804081:	c3                   	ret
+        fd_close(fd, 0);
+  804082:	be 00 00 00 00       	mov    $0x0,%esi
+  804087:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80408b:	48 b8 1f 35 80 00 00 	movabs $0x80351f,%rax
+  804092:	00 00 00 
+  804095:	ff d0                	call   *%rax
+        return res;
+  804097:	eb dc                	jmp    804075 <open+0x96>
+        return -E_BAD_PATH;
+  804099:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80409e:	eb d5                	jmp    804075 <open+0x96>
+
+00000000008040a0 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8040a0:	55                   	push   %rbp
+  8040a1:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  8040a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8040ae:	bf 08 00 00 00       	mov    $0x8,%edi
+  8040b3:	48 b8 4d 3b 80 00 00 	movabs $0x803b4d,%rax
+  8040ba:	00 00 00 
+  8040bd:	ff d0                	call   *%rax
+}
+  8040bf:	5d                   	pop    %rbp
+  8040c0:	c3                   	ret
+
+00000000008040c1 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  8040c1:	55                   	push   %rbp
+  8040c2:	48 89 e5             	mov    %rsp,%rbp
+  8040c5:	41 56                	push   %r14
+  8040c7:	41 55                	push   %r13
+  8040c9:	41 54                	push   %r12
+  8040cb:	53                   	push   %rbx
+  8040cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8040d0:	41 89 f6             	mov    %esi,%r14d
+  8040d3:	49 89 d4             	mov    %rdx,%r12
+  8040d6:	48 89 cb             	mov    %rcx,%rbx
+  8040d9:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8040dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040e0:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  8040e7:	00 00 00 
+  8040ea:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040ec:	85 c0                	test   %eax,%eax
+  8040ee:	78 46                	js     804136 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f4:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8040fb:	00 00 00 
+  8040fe:	8b 00                	mov    (%rax),%eax
+  804100:	39 02                	cmp    %eax,(%rdx)
+  804102:	75 3f                	jne    804143 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804104:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  80410b:	00 00 00 
+  80410e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804111:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804113:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  804117:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  80411b:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  80411f:	48 89 da             	mov    %rbx,%rdx
+  804122:	4c 89 e6             	mov    %r12,%rsi
+  804125:	bf 09 00 00 00       	mov    $0x9,%edi
+  80412a:	48 b8 48 3c 80 00 00 	movabs $0x803c48,%rax
+  804131:	00 00 00 
+  804134:	ff d0                	call   *%rax
+}
+  804136:	48 83 c4 10          	add    $0x10,%rsp
+  80413a:	5b                   	pop    %rbx
+  80413b:	41 5c                	pop    %r12
+  80413d:	41 5d                	pop    %r13
+  80413f:	41 5e                	pop    %r14
+  804141:	5d                   	pop    %rbp
+  804142:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804143:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804148:	eb ec                	jmp    804136 <file_map+0x75>
+
+000000000080414a <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80414a:	55                   	push   %rbp
+  80414b:	48 89 e5             	mov    %rsp,%rbp
+  80414e:	41 54                	push   %r12
+  804150:	53                   	push   %rbx
+  804151:	48 83 ec 20          	sub    $0x20,%rsp
+  804155:	41 89 f4             	mov    %esi,%r12d
+  804158:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80415b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80415f:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  804166:	00 00 00 
+  804169:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80416b:	85 c0                	test   %eax,%eax
+  80416d:	78 3c                	js     8041ab <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80416f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804173:	48 ba 60 70 80 00 00 	movabs $0x807060,%rdx
+  80417a:	00 00 00 
+  80417d:	8b 0a                	mov    (%rdx),%ecx
+  80417f:	39 08                	cmp    %ecx,(%rax)
+  804181:	75 31                	jne    8041b4 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804183:	8b 40 0c             	mov    0xc(%rax),%eax
+  804186:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804189:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  80418d:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804191:	ba 10 00 00 00       	mov    $0x10,%edx
+  804196:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80419a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80419f:	48 b8 4d 3b 80 00 00 	movabs $0x803b4d,%rax
+  8041a6:	00 00 00 
+  8041a9:	ff d0                	call   *%rax
+}
+  8041ab:	48 83 c4 20          	add    $0x20,%rsp
+  8041af:	5b                   	pop    %rbx
+  8041b0:	41 5c                	pop    %r12
+  8041b2:	5d                   	pop    %rbp
+  8041b3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8041b4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8041b9:	eb f0                	jmp    8041ab <file_msync+0x61>
+
+00000000008041bb <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8041bb:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8041bf:	7f 01                	jg     8041c2 <writebuf+0x7>
+  8041c1:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8041c2:	55                   	push   %rbp
+  8041c3:	48 89 e5             	mov    %rsp,%rbp
+  8041c6:	53                   	push   %rbx
+  8041c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8041cb:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8041ce:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8041d2:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8041d6:	8b 3f                	mov    (%rdi),%edi
+  8041d8:	48 b8 76 38 80 00 00 	movabs $0x803876,%rax
+  8041df:	00 00 00 
+  8041e2:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8041e4:	48 85 c0             	test   %rax,%rax
+  8041e7:	7e 04                	jle    8041ed <writebuf+0x32>
+  8041e9:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8041ed:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8041f1:	48 39 c2             	cmp    %rax,%rdx
+  8041f4:	74 0f                	je     804205 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8041f6:	48 85 c0             	test   %rax,%rax
+  8041f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041fe:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804202:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804205:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804209:	c9                   	leave
+  80420a:	c3                   	ret
+
+000000000080420b <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80420b:	8b 46 04             	mov    0x4(%rsi),%eax
+  80420e:	8d 50 01             	lea    0x1(%rax),%edx
+  804211:	89 56 04             	mov    %edx,0x4(%rsi)
+  804214:	48 98                	cltq
+  804216:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80421b:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804221:	74 01                	je     804224 <putch+0x19>
+  804223:	c3                   	ret
+putch(int ch, void *arg) {
+  804224:	55                   	push   %rbp
+  804225:	48 89 e5             	mov    %rsp,%rbp
+  804228:	53                   	push   %rbx
+  804229:	48 83 ec 08          	sub    $0x8,%rsp
+  80422d:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804230:	48 89 f7             	mov    %rsi,%rdi
+  804233:	48 b8 bb 41 80 00 00 	movabs $0x8041bb,%rax
+  80423a:	00 00 00 
+  80423d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80423f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80424a:	c9                   	leave
+  80424b:	c3                   	ret
+
+000000000080424c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80424c:	55                   	push   %rbp
+  80424d:	48 89 e5             	mov    %rsp,%rbp
+  804250:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804257:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80425a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804260:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804267:	00 00 00 
+    state.result = 0;
+  80426a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804271:	00 00 00 00 
+    state.error = 1;
+  804275:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80427c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80427f:	48 89 f2             	mov    %rsi,%rdx
+  804282:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804289:	48 bf 0b 42 80 00 00 	movabs $0x80420b,%rdi
+  804290:	00 00 00 
+  804293:	48 b8 f8 19 80 00 00 	movabs $0x8019f8,%rax
+  80429a:	00 00 00 
+  80429d:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80429f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8042a6:	7f 14                	jg     8042bc <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8042a8:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8042af:	48 85 c0             	test   %rax,%rax
+  8042b2:	75 06                	jne    8042ba <vfprintf+0x6e>
+  8042b4:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8042ba:	c9                   	leave
+  8042bb:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8042bc:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8042c3:	48 b8 bb 41 80 00 00 	movabs $0x8041bb,%rax
+  8042ca:	00 00 00 
+  8042cd:	ff d0                	call   *%rax
+  8042cf:	eb d7                	jmp    8042a8 <vfprintf+0x5c>
+
+00000000008042d1 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8042d1:	55                   	push   %rbp
+  8042d2:	48 89 e5             	mov    %rsp,%rbp
+  8042d5:	48 83 ec 50          	sub    $0x50,%rsp
+  8042d9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042e1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042e5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8042e9:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8042f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8042fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804300:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804304:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  80430b:	00 00 00 
+  80430e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804310:	c9                   	leave
+  804311:	c3                   	ret
+
+0000000000804312 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804312:	55                   	push   %rbp
+  804313:	48 89 e5             	mov    %rsp,%rbp
+  804316:	48 83 ec 50          	sub    $0x50,%rsp
+  80431a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80431e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804322:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804326:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80432a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80432e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804335:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804339:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80433d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804341:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804345:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804349:	48 89 fe             	mov    %rdi,%rsi
+  80434c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804351:	48 b8 4c 42 80 00 00 	movabs $0x80424c,%rax
+  804358:	00 00 00 
+  80435b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80435d:	c9                   	leave
+  80435e:	c3                   	ret
+
+000000000080435f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80435f:	55                   	push   %rbp
+  804360:	48 89 e5             	mov    %rsp,%rbp
+  804363:	41 54                	push   %r12
+  804365:	53                   	push   %rbx
+  804366:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804369:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  804370:	00 00 00 
+  804373:	ff d0                	call   *%rax
+  804375:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804378:	48 be b0 67 80 00 00 	movabs $0x8067b0,%rsi
+  80437f:	00 00 00 
+  804382:	48 89 df             	mov    %rbx,%rdi
+  804385:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  80438c:	00 00 00 
+  80438f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804391:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804396:	41 2b 04 24          	sub    (%r12),%eax
+  80439a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8043a0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8043a7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8043aa:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  8043b1:	00 00 00 
+  8043b4:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8043bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c0:	5b                   	pop    %rbx
+  8043c1:	41 5c                	pop    %r12
+  8043c3:	5d                   	pop    %rbp
+  8043c4:	c3                   	ret
+
+00000000008043c5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8043c5:	55                   	push   %rbp
+  8043c6:	48 89 e5             	mov    %rsp,%rbp
+  8043c9:	41 54                	push   %r12
+  8043cb:	53                   	push   %rbx
+  8043cc:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8043cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d4:	48 89 fe             	mov    %rdi,%rsi
+  8043d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043dc:	49 bc 1c 2a 80 00 00 	movabs $0x802a1c,%r12
+  8043e3:	00 00 00 
+  8043e6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8043e9:	48 89 df             	mov    %rbx,%rdi
+  8043ec:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  8043f3:	00 00 00 
+  8043f6:	ff d0                	call   *%rax
+  8043f8:	48 89 c6             	mov    %rax,%rsi
+  8043fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804400:	bf 00 00 00 00       	mov    $0x0,%edi
+  804405:	41 ff d4             	call   *%r12
+}
+  804408:	5b                   	pop    %rbx
+  804409:	41 5c                	pop    %r12
+  80440b:	5d                   	pop    %rbp
+  80440c:	c3                   	ret
+
+000000000080440d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80440d:	55                   	push   %rbp
+  80440e:	48 89 e5             	mov    %rsp,%rbp
+  804411:	41 57                	push   %r15
+  804413:	41 56                	push   %r14
+  804415:	41 55                	push   %r13
+  804417:	41 54                	push   %r12
+  804419:	53                   	push   %rbx
+  80441a:	48 83 ec 18          	sub    $0x18,%rsp
+  80441e:	49 89 fc             	mov    %rdi,%r12
+  804421:	49 89 f5             	mov    %rsi,%r13
+  804424:	49 89 d7             	mov    %rdx,%r15
+  804427:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80442b:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  804432:	00 00 00 
+  804435:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804437:	4d 85 ff             	test   %r15,%r15
+  80443a:	0f 84 af 00 00 00    	je     8044ef <devpipe_write+0xe2>
+  804440:	48 89 c3             	mov    %rax,%rbx
+  804443:	4c 89 f8             	mov    %r15,%rax
+  804446:	4d 89 ef             	mov    %r13,%r15
+  804449:	4c 01 e8             	add    %r13,%rax
+  80444c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804450:	49 bd 12 29 80 00 00 	movabs $0x802912,%r13
+  804457:	00 00 00 
+            sys_yield();
+  80445a:	49 be a3 28 80 00 00 	movabs $0x8028a3,%r14
+  804461:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804464:	8b 73 04             	mov    0x4(%rbx),%esi
+  804467:	48 63 ce             	movslq %esi,%rcx
+  80446a:	48 63 03             	movslq (%rbx),%rax
+  80446d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804473:	48 39 c1             	cmp    %rax,%rcx
+  804476:	72 2e                	jb     8044a6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804478:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80447d:	48 89 da             	mov    %rbx,%rdx
+  804480:	be 00 10 00 00       	mov    $0x1000,%esi
+  804485:	4c 89 e7             	mov    %r12,%rdi
+  804488:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80448b:	85 c0                	test   %eax,%eax
+  80448d:	74 66                	je     8044f5 <devpipe_write+0xe8>
+            sys_yield();
+  80448f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804492:	8b 73 04             	mov    0x4(%rbx),%esi
+  804495:	48 63 ce             	movslq %esi,%rcx
+  804498:	48 63 03             	movslq (%rbx),%rax
+  80449b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8044a1:	48 39 c1             	cmp    %rax,%rcx
+  8044a4:	73 d2                	jae    804478 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8044a6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8044aa:	48 89 ca             	mov    %rcx,%rdx
+  8044ad:	48 c1 ea 03          	shr    $0x3,%rdx
+  8044b1:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8044b8:	08 10 20 
+  8044bb:	48 f7 e2             	mul    %rdx
+  8044be:	48 c1 ea 06          	shr    $0x6,%rdx
+  8044c2:	48 89 d0             	mov    %rdx,%rax
+  8044c5:	48 c1 e0 09          	shl    $0x9,%rax
+  8044c9:	48 29 d0             	sub    %rdx,%rax
+  8044cc:	48 c1 e0 03          	shl    $0x3,%rax
+  8044d0:	48 29 c1             	sub    %rax,%rcx
+  8044d3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8044d8:	83 c6 01             	add    $0x1,%esi
+  8044db:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8044de:	49 83 c7 01          	add    $0x1,%r15
+  8044e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044e6:	49 39 c7             	cmp    %rax,%r15
+  8044e9:	0f 85 75 ff ff ff    	jne    804464 <devpipe_write+0x57>
+    return n;
+  8044ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044f3:	eb 05                	jmp    8044fa <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8044f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044fa:	48 83 c4 18          	add    $0x18,%rsp
+  8044fe:	5b                   	pop    %rbx
+  8044ff:	41 5c                	pop    %r12
+  804501:	41 5d                	pop    %r13
+  804503:	41 5e                	pop    %r14
+  804505:	41 5f                	pop    %r15
+  804507:	5d                   	pop    %rbp
+  804508:	c3                   	ret
+
+0000000000804509 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804509:	55                   	push   %rbp
+  80450a:	48 89 e5             	mov    %rsp,%rbp
+  80450d:	41 57                	push   %r15
+  80450f:	41 56                	push   %r14
+  804511:	41 55                	push   %r13
+  804513:	41 54                	push   %r12
+  804515:	53                   	push   %rbx
+  804516:	48 83 ec 18          	sub    $0x18,%rsp
+  80451a:	49 89 fc             	mov    %rdi,%r12
+  80451d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804521:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804525:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  80452c:	00 00 00 
+  80452f:	ff d0                	call   *%rax
+  804531:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804534:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80453a:	49 bd 12 29 80 00 00 	movabs $0x802912,%r13
+  804541:	00 00 00 
+            sys_yield();
+  804544:	49 be a3 28 80 00 00 	movabs $0x8028a3,%r14
+  80454b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80454e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804553:	74 7d                	je     8045d2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804555:	8b 03                	mov    (%rbx),%eax
+  804557:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80455a:	75 26                	jne    804582 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80455c:	4d 85 ff             	test   %r15,%r15
+  80455f:	75 77                	jne    8045d8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804561:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804566:	48 89 da             	mov    %rbx,%rdx
+  804569:	be 00 10 00 00       	mov    $0x1000,%esi
+  80456e:	4c 89 e7             	mov    %r12,%rdi
+  804571:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804574:	85 c0                	test   %eax,%eax
+  804576:	74 72                	je     8045ea <devpipe_read+0xe1>
+            sys_yield();
+  804578:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80457b:	8b 03                	mov    (%rbx),%eax
+  80457d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804580:	74 df                	je     804561 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804582:	48 63 c8             	movslq %eax,%rcx
+  804585:	48 89 ca             	mov    %rcx,%rdx
+  804588:	48 c1 ea 03          	shr    $0x3,%rdx
+  80458c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804593:	08 10 20 
+  804596:	48 89 d0             	mov    %rdx,%rax
+  804599:	48 f7 e6             	mul    %rsi
+  80459c:	48 c1 ea 06          	shr    $0x6,%rdx
+  8045a0:	48 89 d0             	mov    %rdx,%rax
+  8045a3:	48 c1 e0 09          	shl    $0x9,%rax
+  8045a7:	48 29 d0             	sub    %rdx,%rax
+  8045aa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8045b1:	00 
+  8045b2:	48 89 c8             	mov    %rcx,%rax
+  8045b5:	48 29 d0             	sub    %rdx,%rax
+  8045b8:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8045bd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8045c1:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8045c5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8045c8:	49 83 c7 01          	add    $0x1,%r15
+  8045cc:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8045d0:	75 83                	jne    804555 <devpipe_read+0x4c>
+    return n;
+  8045d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045d6:	eb 03                	jmp    8045db <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8045d8:	4c 89 f8             	mov    %r15,%rax
+}
+  8045db:	48 83 c4 18          	add    $0x18,%rsp
+  8045df:	5b                   	pop    %rbx
+  8045e0:	41 5c                	pop    %r12
+  8045e2:	41 5d                	pop    %r13
+  8045e4:	41 5e                	pop    %r14
+  8045e6:	41 5f                	pop    %r15
+  8045e8:	5d                   	pop    %rbp
+  8045e9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8045ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ef:	eb ea                	jmp    8045db <devpipe_read+0xd2>
+
+00000000008045f1 <pipe>:
+pipe(int pfd[2]) {
+  8045f1:	55                   	push   %rbp
+  8045f2:	48 89 e5             	mov    %rsp,%rbp
+  8045f5:	41 55                	push   %r13
+  8045f7:	41 54                	push   %r12
+  8045f9:	53                   	push   %rbx
+  8045fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8045fe:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804601:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804605:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  80460c:	00 00 00 
+  80460f:	ff d0                	call   *%rax
+  804611:	89 c3                	mov    %eax,%ebx
+  804613:	85 c0                	test   %eax,%eax
+  804615:	0f 88 a0 01 00 00    	js     8047bb <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80461b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804620:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804625:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804629:	bf 00 00 00 00       	mov    $0x0,%edi
+  80462e:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  804635:	00 00 00 
+  804638:	ff d0                	call   *%rax
+  80463a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80463c:	85 c0                	test   %eax,%eax
+  80463e:	0f 88 77 01 00 00    	js     8047bb <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804644:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804648:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+  804654:	89 c3                	mov    %eax,%ebx
+  804656:	85 c0                	test   %eax,%eax
+  804658:	0f 88 43 01 00 00    	js     8047a1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80465e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804663:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804668:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80466c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804671:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  804678:	00 00 00 
+  80467b:	ff d0                	call   *%rax
+  80467d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80467f:	85 c0                	test   %eax,%eax
+  804681:	0f 88 1a 01 00 00    	js     8047a1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804687:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80468b:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  804692:	00 00 00 
+  804695:	ff d0                	call   *%rax
+  804697:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80469a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80469f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046a4:	48 89 c6             	mov    %rax,%rsi
+  8046a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046ac:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  8046b3:	00 00 00 
+  8046b6:	ff d0                	call   *%rax
+  8046b8:	89 c3                	mov    %eax,%ebx
+  8046ba:	85 c0                	test   %eax,%eax
+  8046bc:	0f 88 c5 00 00 00    	js     804787 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8046c2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8046c6:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  8046cd:	00 00 00 
+  8046d0:	ff d0                	call   *%rax
+  8046d2:	48 89 c1             	mov    %rax,%rcx
+  8046d5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8046db:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8046e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046e6:	4c 89 ee             	mov    %r13,%rsi
+  8046e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046ee:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  8046f5:	00 00 00 
+  8046f8:	ff d0                	call   *%rax
+  8046fa:	89 c3                	mov    %eax,%ebx
+  8046fc:	85 c0                	test   %eax,%eax
+  8046fe:	78 6e                	js     80476e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804700:	be 00 10 00 00       	mov    $0x1000,%esi
+  804705:	4c 89 ef             	mov    %r13,%rdi
+  804708:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  80470f:	00 00 00 
+  804712:	ff d0                	call   *%rax
+  804714:	83 f8 02             	cmp    $0x2,%eax
+  804717:	0f 85 ab 00 00 00    	jne    8047c8 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80471d:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  804724:	00 00 
+  804726:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80472a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80472c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804730:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804737:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80473b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80473d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804741:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804748:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80474c:	48 bb d6 33 80 00 00 	movabs $0x8033d6,%rbx
+  804753:	00 00 00 
+  804756:	ff d3                	call   *%rbx
+  804758:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80475c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804760:	ff d3                	call   *%rbx
+  804762:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804767:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80476c:	eb 4d                	jmp    8047bb <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80476e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804773:	4c 89 ee             	mov    %r13,%rsi
+  804776:	bf 00 00 00 00       	mov    $0x0,%edi
+  80477b:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  804782:	00 00 00 
+  804785:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804787:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80478c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804790:	bf 00 00 00 00       	mov    $0x0,%edi
+  804795:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  80479c:	00 00 00 
+  80479f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8047a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8047aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047af:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  8047b6:	00 00 00 
+  8047b9:	ff d0                	call   *%rax
+}
+  8047bb:	89 d8                	mov    %ebx,%eax
+  8047bd:	48 83 c4 18          	add    $0x18,%rsp
+  8047c1:	5b                   	pop    %rbx
+  8047c2:	41 5c                	pop    %r12
+  8047c4:	41 5d                	pop    %r13
+  8047c6:	5d                   	pop    %rbp
+  8047c7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8047c8:	48 b9 c8 67 80 00 00 	movabs $0x8067c8,%rcx
+  8047cf:	00 00 00 
+  8047d2:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  8047d9:	00 00 00 
+  8047dc:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8047e1:	48 bf b7 67 80 00 00 	movabs $0x8067b7,%rdi
+  8047e8:	00 00 00 
+  8047eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f0:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  8047f7:	00 00 00 
+  8047fa:	41 ff d0             	call   *%r8
+
+00000000008047fd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8047fd:	55                   	push   %rbp
+  8047fe:	48 89 e5             	mov    %rsp,%rbp
+  804801:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804805:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804809:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  804810:	00 00 00 
+  804813:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804815:	85 c0                	test   %eax,%eax
+  804817:	78 35                	js     80484e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804819:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80481d:	48 b8 e8 33 80 00 00 	movabs $0x8033e8,%rax
+  804824:	00 00 00 
+  804827:	ff d0                	call   *%rax
+  804829:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80482c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804831:	be 00 10 00 00       	mov    $0x1000,%esi
+  804836:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80483a:	48 b8 12 29 80 00 00 	movabs $0x802912,%rax
+  804841:	00 00 00 
+  804844:	ff d0                	call   *%rax
+  804846:	85 c0                	test   %eax,%eax
+  804848:	0f 94 c0             	sete   %al
+  80484b:	0f b6 c0             	movzbl %al,%eax
+}
+  80484e:	c9                   	leave
+  80484f:	c3                   	ret
+
+0000000000804850 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804850:	48 89 f8             	mov    %rdi,%rax
+  804853:	48 c1 e8 27          	shr    $0x27,%rax
+  804857:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80485e:	01 00 00 
+  804861:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804865:	f6 c2 01             	test   $0x1,%dl
+  804868:	74 6d                	je     8048d7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80486a:	48 89 f8             	mov    %rdi,%rax
+  80486d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804871:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804878:	01 00 00 
+  80487b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80487f:	f6 c2 01             	test   $0x1,%dl
+  804882:	74 62                	je     8048e6 <get_uvpt_entry+0x96>
+  804884:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80488b:	01 00 00 
+  80488e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804892:	f6 c2 80             	test   $0x80,%dl
+  804895:	75 4f                	jne    8048e6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804897:	48 89 f8             	mov    %rdi,%rax
+  80489a:	48 c1 e8 15          	shr    $0x15,%rax
+  80489e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048a5:	01 00 00 
+  8048a8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048ac:	f6 c2 01             	test   $0x1,%dl
+  8048af:	74 44                	je     8048f5 <get_uvpt_entry+0xa5>
+  8048b1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048b8:	01 00 00 
+  8048bb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048bf:	f6 c2 80             	test   $0x80,%dl
+  8048c2:	75 31                	jne    8048f5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8048c4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8048c8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8048cf:	01 00 00 
+  8048d2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8048d6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8048d7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8048de:	01 00 00 
+  8048e1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048e5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8048e6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8048ed:	01 00 00 
+  8048f0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8048f4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8048f5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8048fc:	01 00 00 
+  8048ff:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804903:	c3                   	ret
+
+0000000000804904 <get_prot>:
+
+int
+get_prot(void *va) {
+  804904:	55                   	push   %rbp
+  804905:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804908:	48 b8 50 48 80 00 00 	movabs $0x804850,%rax
+  80490f:	00 00 00 
+  804912:	ff d0                	call   *%rax
+  804914:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804917:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80491c:	89 c1                	mov    %eax,%ecx
+  80491e:	83 c9 04             	or     $0x4,%ecx
+  804921:	f6 c2 01             	test   $0x1,%dl
+  804924:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804927:	89 c1                	mov    %eax,%ecx
+  804929:	83 c9 02             	or     $0x2,%ecx
+  80492c:	f6 c2 02             	test   $0x2,%dl
+  80492f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804932:	89 c1                	mov    %eax,%ecx
+  804934:	83 c9 01             	or     $0x1,%ecx
+  804937:	48 85 d2             	test   %rdx,%rdx
+  80493a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80493d:	89 c1                	mov    %eax,%ecx
+  80493f:	83 c9 40             	or     $0x40,%ecx
+  804942:	f6 c6 04             	test   $0x4,%dh
+  804945:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804948:	5d                   	pop    %rbp
+  804949:	c3                   	ret
+
+000000000080494a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80494a:	55                   	push   %rbp
+  80494b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80494e:	48 b8 50 48 80 00 00 	movabs $0x804850,%rax
+  804955:	00 00 00 
+  804958:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80495a:	48 c1 e8 06          	shr    $0x6,%rax
+  80495e:	83 e0 01             	and    $0x1,%eax
+}
+  804961:	5d                   	pop    %rbp
+  804962:	c3                   	ret
+
+0000000000804963 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804963:	55                   	push   %rbp
+  804964:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804967:	48 b8 50 48 80 00 00 	movabs $0x804850,%rax
+  80496e:	00 00 00 
+  804971:	ff d0                	call   *%rax
+  804973:	83 e0 01             	and    $0x1,%eax
+}
+  804976:	5d                   	pop    %rbp
+  804977:	c3                   	ret
+
+0000000000804978 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804978:	55                   	push   %rbp
+  804979:	48 89 e5             	mov    %rsp,%rbp
+  80497c:	41 57                	push   %r15
+  80497e:	41 56                	push   %r14
+  804980:	41 55                	push   %r13
+  804982:	41 54                	push   %r12
+  804984:	53                   	push   %rbx
+  804985:	48 83 ec 28          	sub    $0x28,%rsp
+  804989:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80498d:	48 85 ff             	test   %rdi,%rdi
+  804990:	74 1e                	je     8049b0 <foreach_shared_region+0x38>
+  804992:	49 89 ff             	mov    %rdi,%r15
+  804995:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80499b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8049a1:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8049a8:	01 00 00 
+  8049ab:	e9 72 02 00 00       	jmp    804c22 <foreach_shared_region+0x2aa>
+    assert(fun);
+  8049b0:	48 b9 ec 67 80 00 00 	movabs $0x8067ec,%rcx
+  8049b7:	00 00 00 
+  8049ba:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  8049c1:	00 00 00 
+  8049c4:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8049c9:	48 bf f0 67 80 00 00 	movabs $0x8067f0,%rdi
+  8049d0:	00 00 00 
+  8049d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049d8:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  8049df:	00 00 00 
+  8049e2:	41 ff d0             	call   *%r8
+  8049e5:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8049ec:	eb 6c                	jmp    804a5a <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8049ee:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049f5:	ff ff ff 
+  8049f8:	4c 21 e2             	and    %r12,%rdx
+  8049fb:	48 89 d8             	mov    %rbx,%rax
+  8049fe:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a03:	48 83 c0 01          	add    $0x1,%rax
+  804a07:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804a0b:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804a12:	00 00 00 
+  804a15:	48 21 c8             	and    %rcx,%rax
+  804a18:	48 09 d0             	or     %rdx,%rax
+  804a1b:	49 89 c4             	mov    %rax,%r12
+  804a1e:	eb 30                	jmp    804a50 <foreach_shared_region+0xd8>
+  804a20:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804a27:	ff ff ff 
+  804a2a:	4c 21 e2             	and    %r12,%rdx
+  804a2d:	48 89 d8             	mov    %rbx,%rax
+  804a30:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a35:	48 83 c0 01          	add    $0x1,%rax
+  804a39:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804a3d:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804a44:	00 00 00 
+  804a47:	48 21 c8             	and    %rcx,%rax
+  804a4a:	48 09 d0             	or     %rdx,%rax
+  804a4d:	49 89 c4             	mov    %rax,%r12
+  804a50:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804a54:	0f 84 99 01 00 00    	je     804bf3 <foreach_shared_region+0x27b>
+  804a5a:	4c 89 e3             	mov    %r12,%rbx
+  804a5d:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804a61:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804a68:	01 00 00 
+  804a6b:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a6f:	a8 01                	test   $0x1,%al
+  804a71:	0f 84 77 ff ff ff    	je     8049ee <foreach_shared_region+0x76>
+  804a77:	a8 80                	test   $0x80,%al
+  804a79:	74 19                	je     804a94 <foreach_shared_region+0x11c>
+  804a7b:	f6 c4 04             	test   $0x4,%ah
+  804a7e:	74 a0                	je     804a20 <foreach_shared_region+0xa8>
+  804a80:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804a87:	40 
+  804a88:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a8c:	4c 89 e7             	mov    %r12,%rdi
+  804a8f:	41 ff d7             	call   *%r15
+  804a92:	eb 8c                	jmp    804a20 <foreach_shared_region+0xa8>
+  804a94:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804a9b:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804a9f:	eb 46                	jmp    804ae7 <foreach_shared_region+0x16f>
+  804aa1:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804aa8:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804aae:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804ab2:	48 c1 e0 15          	shl    $0x15,%rax
+  804ab6:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804abb:	49 09 c4             	or     %rax,%r12
+  804abe:	eb 1d                	jmp    804add <foreach_shared_region+0x165>
+  804ac0:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804ac7:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804acd:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804ad1:	48 c1 e0 15          	shl    $0x15,%rax
+  804ad5:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804ada:	49 09 c4             	or     %rax,%r12
+  804add:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804ae1:	0f 84 d3 00 00 00    	je     804bba <foreach_shared_region+0x242>
+  804ae7:	4c 89 e3             	mov    %r12,%rbx
+  804aea:	48 c1 eb 15          	shr    $0x15,%rbx
+  804aee:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804af5:	01 00 00 
+  804af8:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804afc:	a8 01                	test   $0x1,%al
+  804afe:	74 a1                	je     804aa1 <foreach_shared_region+0x129>
+  804b00:	a8 80                	test   $0x80,%al
+  804b02:	74 19                	je     804b1d <foreach_shared_region+0x1a5>
+  804b04:	f6 c4 04             	test   $0x4,%ah
+  804b07:	74 b7                	je     804ac0 <foreach_shared_region+0x148>
+  804b09:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804b10:	00 
+  804b11:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b15:	4c 89 e7             	mov    %r12,%rdi
+  804b18:	41 ff d7             	call   *%r15
+  804b1b:	eb a3                	jmp    804ac0 <foreach_shared_region+0x148>
+  804b1d:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804b23:	eb 3b                	jmp    804b60 <foreach_shared_region+0x1e8>
+  804b25:	f6 c4 04             	test   $0x4,%ah
+  804b28:	74 12                	je     804b3c <foreach_shared_region+0x1c4>
+  804b2a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804b31:	00 
+  804b32:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b36:	4c 89 e7             	mov    %r12,%rdi
+  804b39:	41 ff d7             	call   *%r15
+  804b3c:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b43:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b49:	48 83 c3 01          	add    $0x1,%rbx
+  804b4d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b51:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b57:	49 09 dc             	or     %rbx,%r12
+  804b5a:	41 83 ed 01          	sub    $0x1,%r13d
+  804b5e:	74 2f                	je     804b8f <foreach_shared_region+0x217>
+  804b60:	4c 89 e3             	mov    %r12,%rbx
+  804b63:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804b67:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804b6b:	a8 01                	test   $0x1,%al
+  804b6d:	75 b6                	jne    804b25 <foreach_shared_region+0x1ad>
+  804b6f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b76:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b7c:	48 83 c3 01          	add    $0x1,%rbx
+  804b80:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b84:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b8a:	49 09 dc             	or     %rbx,%r12
+  804b8d:	eb cb                	jmp    804b5a <foreach_shared_region+0x1e2>
+  804b8f:	4c 89 e0             	mov    %r12,%rax
+  804b92:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804b98:	49 c1 ec 15          	shr    $0x15,%r12
+  804b9c:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804ba3:	49 83 c4 01          	add    $0x1,%r12
+  804ba7:	49 c1 e4 15          	shl    $0x15,%r12
+  804bab:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804bb2:	49 09 c4             	or     %rax,%r12
+  804bb5:	e9 23 ff ff ff       	jmp    804add <foreach_shared_region+0x165>
+  804bba:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804bbe:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804bc5:	ff ff ff 
+  804bc8:	4c 21 e0             	and    %r12,%rax
+  804bcb:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804bcf:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804bd6:	49 83 c4 01          	add    $0x1,%r12
+  804bda:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804bde:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804be5:	00 00 00 
+  804be8:	49 21 d4             	and    %rdx,%r12
+  804beb:	49 09 c4             	or     %rax,%r12
+  804bee:	e9 5d fe ff ff       	jmp    804a50 <foreach_shared_region+0xd8>
+  804bf3:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804bfa:	00 ff ff 
+  804bfd:	4c 21 e0             	and    %r12,%rax
+  804c00:	49 c1 ec 27          	shr    $0x27,%r12
+  804c04:	49 83 c4 01          	add    $0x1,%r12
+  804c08:	49 c1 e4 27          	shl    $0x27,%r12
+  804c0c:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804c13:	ff 00 00 
+  804c16:	49 21 d4             	and    %rdx,%r12
+  804c19:	49 09 c4             	or     %rax,%r12
+  804c1c:	41 83 ed 01          	sub    $0x1,%r13d
+  804c20:	74 48                	je     804c6a <foreach_shared_region+0x2f2>
+  804c22:	4c 89 e0             	mov    %r12,%rax
+  804c25:	48 c1 e8 27          	shr    $0x27,%rax
+  804c29:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804c30:	01 00 00 
+  804c33:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804c37:	f6 c2 01             	test   $0x1,%dl
+  804c3a:	0f 85 a5 fd ff ff    	jne    8049e5 <foreach_shared_region+0x6d>
+  804c40:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804c47:	00 ff ff 
+  804c4a:	4c 21 e2             	and    %r12,%rdx
+  804c4d:	48 83 c0 01          	add    $0x1,%rax
+  804c51:	48 c1 e0 27          	shl    $0x27,%rax
+  804c55:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804c5c:	ff 00 00 
+  804c5f:	48 21 c8             	and    %rcx,%rax
+  804c62:	48 09 d0             	or     %rdx,%rax
+  804c65:	49 89 c4             	mov    %rax,%r12
+  804c68:	eb b2                	jmp    804c1c <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804c6a:	4d 85 e4             	test   %r12,%r12
+  804c6d:	75 14                	jne    804c83 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c74:	48 83 c4 28          	add    $0x28,%rsp
+  804c78:	5b                   	pop    %rbx
+  804c79:	41 5c                	pop    %r12
+  804c7b:	41 5d                	pop    %r13
+  804c7d:	41 5e                	pop    %r14
+  804c7f:	41 5f                	pop    %r15
+  804c81:	5d                   	pop    %rbp
+  804c82:	c3                   	ret
+    assert(addr == 0);
+  804c83:	48 b9 fb 67 80 00 00 	movabs $0x8067fb,%rcx
+  804c8a:	00 00 00 
+  804c8d:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  804c94:	00 00 00 
+  804c97:	be 67 00 00 00       	mov    $0x67,%esi
+  804c9c:	48 bf f0 67 80 00 00 	movabs $0x8067f0,%rdi
+  804ca3:	00 00 00 
+  804ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cab:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  804cb2:	00 00 00 
+  804cb5:	41 ff d0             	call   *%r8
+
+0000000000804cb8 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804cb8:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804cbf:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804cc2:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804cc8:	eb 33                	jmp    804cfd <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cca:	48 83 c0 20          	add    $0x20,%rax
+  804cce:	4c 39 c0             	cmp    %r8,%rax
+  804cd1:	74 25                	je     804cf8 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804cd3:	48 8b 10             	mov    (%rax),%rdx
+  804cd6:	48 85 d2             	test   %rdx,%rdx
+  804cd9:	74 ef                	je     804cca <mmap_place+0x12>
+  804cdb:	48 89 d1             	mov    %rdx,%rcx
+  804cde:	48 03 48 08          	add    0x8(%rax),%rcx
+  804ce2:	48 39 cf             	cmp    %rcx,%rdi
+  804ce5:	73 e3                	jae    804cca <mmap_place+0x12>
+  804ce7:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804ceb:	4c 39 ca             	cmp    %r9,%rdx
+  804cee:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804cf2:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804cf6:	eb d2                	jmp    804cca <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804cf8:	45 84 d2             	test   %r10b,%r10b
+  804cfb:	74 12                	je     804d0f <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cfd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d04:	00 00 00 
+        moved = 0;
+  804d07:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804d0d:	eb c4                	jmp    804cd3 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804d0f:	48 01 fe             	add    %rdi,%rsi
+  804d12:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804d19:	00 00 00 
+  804d1c:	48 39 f0             	cmp    %rsi,%rax
+  804d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d24:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804d28:	c3                   	ret
+
+0000000000804d29 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804d29:	55                   	push   %rbp
+  804d2a:	48 89 e5             	mov    %rsp,%rbp
+  804d2d:	41 57                	push   %r15
+  804d2f:	41 56                	push   %r14
+  804d31:	41 55                	push   %r13
+  804d33:	41 54                	push   %r12
+  804d35:	53                   	push   %rbx
+  804d36:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804d3a:	48 8b 1f             	mov    (%rdi),%rbx
+  804d3d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d44:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d4b:	00 00 00 
+  804d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d53:	eb 12                	jmp    804d67 <mmap_pgfault+0x3e>
+  804d55:	48 83 c2 01          	add    $0x1,%rdx
+  804d59:	48 83 c0 20          	add    $0x20,%rax
+  804d5d:	48 83 fa 20          	cmp    $0x20,%rdx
+  804d61:	0f 84 04 01 00 00    	je     804e6b <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804d67:	48 8b 08             	mov    (%rax),%rcx
+  804d6a:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804d6e:	48 39 de             	cmp    %rbx,%rsi
+  804d71:	73 e2                	jae    804d55 <mmap_pgfault+0x2c>
+  804d73:	48 03 48 08          	add    0x8(%rax),%rcx
+  804d77:	48 39 cb             	cmp    %rcx,%rbx
+  804d7a:	73 d9                	jae    804d55 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804d7c:	48 c1 e2 05          	shl    $0x5,%rdx
+  804d80:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d87:	00 00 00 
+  804d8a:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804d8e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804d92:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804d96:	f6 c2 01             	test   $0x1,%dl
+  804d99:	0f 84 e0 00 00 00    	je     804e7f <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da4:	f6 c2 02             	test   $0x2,%dl
+  804da7:	0f 84 c3 00 00 00    	je     804e70 <mmap_pgfault+0x147>
+  804dad:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804db4:	ff ff ff 
+  804db7:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804dbb:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804dc2:	00 00 00 
+  804dc5:	48 39 ca             	cmp    %rcx,%rdx
+  804dc8:	0f 85 a2 00 00 00    	jne    804e70 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804dce:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804dd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dd8:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804ddf:	00 00 00 
+  804de2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804de7:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  804dee:	00 00 00 
+  804df1:	ff d0                	call   *%rax
+  804df3:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfa:	85 d2                	test   %edx,%edx
+  804dfc:	78 72                	js     804e70 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804dfe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e03:	48 89 de             	mov    %rbx,%rsi
+  804e06:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804e0d:	00 00 00 
+  804e10:	4c 89 e7             	mov    %r12,%rdi
+  804e13:	48 b8 96 25 80 00 00 	movabs $0x802596,%rax
+  804e1a:	00 00 00 
+  804e1d:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804e1f:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804e25:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804e2b:	48 89 d9             	mov    %rbx,%rcx
+  804e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e33:	4c 89 e6             	mov    %r12,%rsi
+  804e36:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e3b:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  804e42:	00 00 00 
+  804e45:	ff d0                	call   *%rax
+  804e47:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804e49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e4e:	4c 89 e6             	mov    %r12,%rsi
+  804e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e56:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  804e5d:	00 00 00 
+  804e60:	ff d0                	call   *%rax
+    return res >= 0;
+  804e62:	89 d8                	mov    %ebx,%eax
+  804e64:	f7 d0                	not    %eax
+  804e66:	c1 e8 1f             	shr    $0x1f,%eax
+  804e69:	eb 05                	jmp    804e70 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804e70:	48 83 c4 18          	add    $0x18,%rsp
+  804e74:	5b                   	pop    %rbx
+  804e75:	41 5c                	pop    %r12
+  804e77:	41 5d                	pop    %r13
+  804e79:	41 5e                	pop    %r14
+  804e7b:	41 5f                	pop    %r15
+  804e7d:	5d                   	pop    %rbp
+  804e7e:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804e7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e83:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804e87:	4c 03 30             	add    (%rax),%r14
+  804e8a:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804e91:	49 39 c6             	cmp    %rax,%r14
+  804e94:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e98:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804e9f:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ea5:	49 bf 63 49 80 00 00 	movabs $0x804963,%r15
+  804eac:	00 00 00 
+  804eaf:	4d 39 f4             	cmp    %r14,%r12
+  804eb2:	73 1d                	jae    804ed1 <mmap_pgfault+0x1a8>
+  804eb4:	4c 89 e7             	mov    %r12,%rdi
+  804eb7:	41 ff d7             	call   *%r15
+  804eba:	84 c0                	test   %al,%al
+  804ebc:	75 13                	jne    804ed1 <mmap_pgfault+0x1a8>
+  804ebe:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804ec5:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804ecc:	4d 39 f4             	cmp    %r14,%r12
+  804ecf:	72 e3                	jb     804eb4 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804ed1:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804ed7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804edb:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804edf:	74 2a                	je     804f0b <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804ee1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ee5:	89 de                	mov    %ebx,%esi
+  804ee7:	2b 30                	sub    (%rax),%esi
+  804ee9:	03 70 1c             	add    0x1c(%rax),%esi
+  804eec:	8b 78 18             	mov    0x18(%rax),%edi
+  804eef:	4c 89 e9             	mov    %r13,%rcx
+  804ef2:	48 89 da             	mov    %rbx,%rdx
+  804ef5:	48 b8 c1 40 80 00 00 	movabs $0x8040c1,%rax
+  804efc:	00 00 00 
+  804eff:	ff d0                	call   *%rax
+    return res > 0;
+  804f01:	85 c0                	test   %eax,%eax
+  804f03:	0f 9f c0             	setg   %al
+  804f06:	e9 65 ff ff ff       	jmp    804e70 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804f0b:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804f0f:	eb d0                	jmp    804ee1 <mmap_pgfault+0x1b8>
+
+0000000000804f11 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804f11:	55                   	push   %rbp
+  804f12:	48 89 e5             	mov    %rsp,%rbp
+  804f15:	41 57                	push   %r15
+  804f17:	41 56                	push   %r14
+  804f19:	41 55                	push   %r13
+  804f1b:	41 54                	push   %r12
+  804f1d:	53                   	push   %rbx
+  804f1e:	48 83 ec 28          	sub    $0x28,%rsp
+  804f22:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804f26:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804f29:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804f30:	ff ff ff 
+  804f33:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f3c:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804f43:	00 00 00 
+  804f46:	48 39 ca             	cmp    %rcx,%rdx
+  804f49:	0f 85 e5 00 00 00    	jne    805034 <mmap_writeback+0x123>
+  804f4f:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804f52:	4c 39 ee             	cmp    %r13,%rsi
+  804f55:	0f 83 e8 00 00 00    	jae    805043 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f5b:	49 be 63 49 80 00 00 	movabs $0x804963,%r14
+  804f62:	00 00 00 
+  804f65:	49 bf 4a 49 80 00 00 	movabs $0x80494a,%r15
+  804f6c:	00 00 00 
+  804f6f:	eb 10                	jmp    804f81 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804f71:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804f78:	4d 39 ec             	cmp    %r13,%r12
+  804f7b:	0f 83 ae 00 00 00    	jae    80502f <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f81:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804f85:	4c 89 e7             	mov    %r12,%rdi
+  804f88:	41 ff d6             	call   *%r14
+  804f8b:	84 c0                	test   %al,%al
+  804f8d:	74 e2                	je     804f71 <mmap_writeback+0x60>
+  804f8f:	4c 89 e7             	mov    %r12,%rdi
+  804f92:	41 ff d7             	call   *%r15
+  804f95:	84 c0                	test   %al,%al
+  804f97:	74 d8                	je     804f71 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804f99:	4c 89 e3             	mov    %r12,%rbx
+  804f9c:	4d 39 ec             	cmp    %r13,%r12
+  804f9f:	73 20                	jae    804fc1 <mmap_writeback+0xb0>
+  804fa1:	48 89 df             	mov    %rbx,%rdi
+  804fa4:	41 ff d6             	call   *%r14
+  804fa7:	84 c0                	test   %al,%al
+  804fa9:	74 16                	je     804fc1 <mmap_writeback+0xb0>
+  804fab:	48 89 df             	mov    %rbx,%rdi
+  804fae:	41 ff d7             	call   *%r15
+  804fb1:	84 c0                	test   %al,%al
+  804fb3:	74 0c                	je     804fc1 <mmap_writeback+0xb0>
+  804fb5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804fbc:	4c 39 eb             	cmp    %r13,%rbx
+  804fbf:	72 e0                	jb     804fa1 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804fc1:	48 89 d9             	mov    %rbx,%rcx
+  804fc4:	4c 29 e1             	sub    %r12,%rcx
+  804fc7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804fcb:	44 89 e6             	mov    %r12d,%esi
+  804fce:	2b 30                	sub    (%rax),%esi
+  804fd0:	49 89 c4             	mov    %rax,%r12
+  804fd3:	03 70 1c             	add    0x1c(%rax),%esi
+  804fd6:	8b 78 18             	mov    0x18(%rax),%edi
+  804fd9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804fdd:	48 89 ca             	mov    %rcx,%rdx
+  804fe0:	48 b8 4a 41 80 00 00 	movabs $0x80414a,%rax
+  804fe7:	00 00 00 
+  804fea:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804fec:	85 c0                	test   %eax,%eax
+  804fee:	78 44                	js     805034 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804ff0:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804ff5:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804ff8:	41 89 c1             	mov    %eax,%r9d
+  804ffb:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  805002:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805006:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80500a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80500f:	48 89 ce             	mov    %rcx,%rsi
+  805012:	bf 00 00 00 00       	mov    $0x0,%edi
+  805017:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  80501e:	00 00 00 
+  805021:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  805023:	85 c0                	test   %eax,%eax
+  805025:	78 0d                	js     805034 <mmap_writeback+0x123>
+  805027:	49 89 dc             	mov    %rbx,%r12
+  80502a:	e9 49 ff ff ff       	jmp    804f78 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  80502f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805034:	48 83 c4 28          	add    $0x28,%rsp
+  805038:	5b                   	pop    %rbx
+  805039:	41 5c                	pop    %r12
+  80503b:	41 5d                	pop    %r13
+  80503d:	41 5e                	pop    %r14
+  80503f:	41 5f                	pop    %r15
+  805041:	5d                   	pop    %rbp
+  805042:	c3                   	ret
+    return 0;
+  805043:	b8 00 00 00 00       	mov    $0x0,%eax
+  805048:	eb ea                	jmp    805034 <mmap_writeback+0x123>
+
+000000000080504a <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80504a:	55                   	push   %rbp
+  80504b:	48 89 e5             	mov    %rsp,%rbp
+  80504e:	41 57                	push   %r15
+  805050:	41 56                	push   %r14
+  805052:	41 55                	push   %r13
+  805054:	41 54                	push   %r12
+  805056:	53                   	push   %rbx
+  805057:	48 83 ec 38          	sub    $0x38,%rsp
+  80505b:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80505f:	48 85 f6             	test   %rsi,%rsi
+  805062:	0f 84 0c 02 00 00    	je     805274 <mmap+0x22a>
+  805068:	49 89 ff             	mov    %rdi,%r15
+  80506b:	49 89 f4             	mov    %rsi,%r12
+  80506e:	41 89 d5             	mov    %edx,%r13d
+  805071:	41 89 ce             	mov    %ecx,%r14d
+  805074:	44 89 cb             	mov    %r9d,%ebx
+  805077:	45 85 c9             	test   %r9d,%r9d
+  80507a:	0f 88 f4 01 00 00    	js     805274 <mmap+0x22a>
+  805080:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805087:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80508e:	0f 85 e7 01 00 00    	jne    80527b <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805094:	83 e2 fd             	and    $0xfffffffd,%edx
+  805097:	83 fa 04             	cmp    $0x4,%edx
+  80509a:	0f 85 db 01 00 00    	jne    80527b <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  8050a0:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8050a3:	83 fa 01             	cmp    $0x1,%edx
+  8050a6:	0f 87 cf 01 00 00    	ja     80527b <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  8050ac:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8050b0:	44 89 c7             	mov    %r8d,%edi
+  8050b3:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  8050ba:	00 00 00 
+  8050bd:	ff d0                	call   *%rax
+  8050bf:	89 c2                	mov    %eax,%edx
+  8050c1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050c8:	85 d2                	test   %edx,%edx
+  8050ca:	0f 88 ab 01 00 00    	js     80527b <mmap+0x231>
+  8050d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8050d4:	48 b9 60 70 80 00 00 	movabs $0x807060,%rcx
+  8050db:	00 00 00 
+  8050de:	8b 09                	mov    (%rcx),%ecx
+  8050e0:	39 0a                	cmp    %ecx,(%rdx)
+  8050e2:	0f 85 93 01 00 00    	jne    80527b <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8050e8:	8b 52 08             	mov    0x8(%rdx),%edx
+  8050eb:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8050ee:	83 fa 01             	cmp    $0x1,%edx
+  8050f1:	0f 84 84 01 00 00    	je     80527b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8050f7:	41 83 fe 01          	cmp    $0x1,%r14d
+  8050fb:	74 42                	je     80513f <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8050fd:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805104:	4c 89 e6             	mov    %r12,%rsi
+  805107:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80510e:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805112:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805116:	4d 85 ff             	test   %r15,%r15
+  805119:	74 67                	je     805182 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80511b:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805122:	75 0f                	jne    805133 <mmap+0xe9>
+  805124:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  80512b:	00 00 00 
+  80512e:	49 39 c7             	cmp    %rax,%r15
+  805131:	77 1b                	ja     80514e <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805133:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80513a:	e9 3c 01 00 00       	jmp    80527b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80513f:	41 f6 c5 02          	test   $0x2,%r13b
+  805143:	74 b8                	je     8050fd <mmap+0xb3>
+  805145:	85 d2                	test   %edx,%edx
+  805147:	75 b4                	jne    8050fd <mmap+0xb3>
+  805149:	e9 2d 01 00 00       	jmp    80527b <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80514e:	4c 89 ff             	mov    %r15,%rdi
+  805151:	48 b8 b8 4c 80 00 00 	movabs $0x804cb8,%rax
+  805158:	00 00 00 
+  80515b:	ff d0                	call   *%rax
+  80515d:	48 89 c2             	mov    %rax,%rdx
+  805160:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805167:	49 39 d7             	cmp    %rdx,%r15
+  80516a:	0f 85 0b 01 00 00    	jne    80527b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805170:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805177:	00 00 00 
+  80517a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805180:	eb 44                	jmp    8051c6 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805182:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805186:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  80518d:	00 00 00 
+  805190:	48 b8 b8 4c 80 00 00 	movabs $0x804cb8,%rax
+  805197:	00 00 00 
+  80519a:	ff d0                	call   *%rax
+  80519c:	48 89 c7             	mov    %rax,%rdi
+  80519f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  8051a3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8051aa:	48 85 ff             	test   %rdi,%rdi
+  8051ad:	75 c1                	jne    805170 <mmap+0x126>
+  8051af:	e9 c7 00 00 00       	jmp    80527b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8051b4:	49 83 c4 01          	add    $0x1,%r12
+  8051b8:	48 83 c0 20          	add    $0x20,%rax
+  8051bc:	49 83 fc 20          	cmp    $0x20,%r12
+  8051c0:	0f 84 a5 00 00 00    	je     80526b <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8051c6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8051ca:	75 e8                	jne    8051b4 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  8051cc:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8051d0:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  8051d7:	00 00 00 
+  8051da:	ff d0                	call   *%rax
+  8051dc:	89 c2                	mov    %eax,%edx
+  8051de:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051e5:	85 d2                	test   %edx,%edx
+  8051e7:	0f 88 8e 00 00 00    	js     80527b <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8051ed:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8051f1:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  8051f8:	00 00 00 
+  8051fb:	ff d0                	call   *%rax
+  8051fd:	89 c6                	mov    %eax,%esi
+  8051ff:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805202:	48 b8 24 36 80 00 00 	movabs $0x803624,%rax
+  805209:	00 00 00 
+  80520c:	ff d0                	call   *%rax
+  80520e:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805211:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805218:	45 85 ff             	test   %r15d,%r15d
+  80521b:	78 5e                	js     80527b <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80521d:	49 c1 e4 05          	shl    $0x5,%r12
+  805221:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805228:	00 00 00 
+  80522b:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  80522e:	48 bf 29 4d 80 00 00 	movabs $0x804d29,%rdi
+  805235:	00 00 00 
+  805238:	48 b8 f7 57 80 00 00 	movabs $0x8057f7,%rax
+  80523f:	00 00 00 
+  805242:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805244:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805248:	49 89 04 24          	mov    %rax,(%r12)
+  80524c:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805250:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805255:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  80525a:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80525f:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805264:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805269:	eb 10                	jmp    80527b <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  80526b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805272:	eb 07                	jmp    80527b <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805274:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  80527b:	48 83 c4 38          	add    $0x38,%rsp
+  80527f:	5b                   	pop    %rbx
+  805280:	41 5c                	pop    %r12
+  805282:	41 5d                	pop    %r13
+  805284:	41 5e                	pop    %r14
+  805286:	41 5f                	pop    %r15
+  805288:	5d                   	pop    %rbp
+  805289:	c3                   	ret
+
+000000000080528a <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  80528a:	55                   	push   %rbp
+  80528b:	48 89 e5             	mov    %rsp,%rbp
+  80528e:	41 57                	push   %r15
+  805290:	41 56                	push   %r14
+  805292:	41 55                	push   %r13
+  805294:	41 54                	push   %r12
+  805296:	53                   	push   %rbx
+  805297:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80529b:	49 89 fe             	mov    %rdi,%r14
+  80529e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8052a5:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8052ac:	00 
+  8052ad:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052b4:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8052bb:	00 00 00 
+  8052be:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8052c5:	49 bf 11 4f 80 00 00 	movabs $0x804f11,%r15
+  8052cc:	00 00 00 
+  8052cf:	eb 09                	jmp    8052da <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052d1:	48 83 c3 20          	add    $0x20,%rbx
+  8052d5:	4c 39 eb             	cmp    %r13,%rbx
+  8052d8:	74 33                	je     80530d <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052da:	48 89 df             	mov    %rbx,%rdi
+  8052dd:	48 8b 33             	mov    (%rbx),%rsi
+  8052e0:	4c 39 e6             	cmp    %r12,%rsi
+  8052e3:	73 ec                	jae    8052d1 <msync+0x47>
+  8052e5:	48 85 f6             	test   %rsi,%rsi
+  8052e8:	74 e7                	je     8052d1 <msync+0x47>
+  8052ea:	48 89 f2             	mov    %rsi,%rdx
+  8052ed:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8052f1:	49 39 d6             	cmp    %rdx,%r14
+  8052f4:	73 db                	jae    8052d1 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8052f6:	4c 39 e2             	cmp    %r12,%rdx
+  8052f9:	49 0f 47 d4          	cmova  %r12,%rdx
+  8052fd:	4c 39 f6             	cmp    %r14,%rsi
+  805300:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805304:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805307:	85 c0                	test   %eax,%eax
+  805309:	79 c6                	jns    8052d1 <msync+0x47>
+  80530b:	eb 05                	jmp    805312 <msync+0x88>
+    }
+
+    return 0;
+  80530d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805312:	48 83 c4 08          	add    $0x8,%rsp
+  805316:	5b                   	pop    %rbx
+  805317:	41 5c                	pop    %r12
+  805319:	41 5d                	pop    %r13
+  80531b:	41 5e                	pop    %r14
+  80531d:	41 5f                	pop    %r15
+  80531f:	5d                   	pop    %rbp
+  805320:	c3                   	ret
+
+0000000000805321 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805321:	55                   	push   %rbp
+  805322:	48 89 e5             	mov    %rsp,%rbp
+  805325:	41 57                	push   %r15
+  805327:	41 56                	push   %r14
+  805329:	41 55                	push   %r13
+  80532b:	41 54                	push   %r12
+  80532d:	53                   	push   %rbx
+  80532e:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805332:	49 89 ff             	mov    %rdi,%r15
+  805335:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80533c:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805343:	00 
+  805344:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80534b:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805352:	00 00 00 
+  805355:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80535c:	48 89 d8             	mov    %rbx,%rax
+  80535f:	eb 09                	jmp    80536a <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805361:	48 83 c0 20          	add    $0x20,%rax
+  805365:	4c 39 f0             	cmp    %r14,%rax
+  805368:	74 40                	je     8053aa <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80536a:	48 8b 10             	mov    (%rax),%rdx
+  80536d:	4c 39 e2             	cmp    %r12,%rdx
+  805370:	73 ef                	jae    805361 <munmap+0x40>
+  805372:	48 85 d2             	test   %rdx,%rdx
+  805375:	74 ea                	je     805361 <munmap+0x40>
+  805377:	48 89 d7             	mov    %rdx,%rdi
+  80537a:	48 03 78 08          	add    0x8(%rax),%rdi
+  80537e:	49 39 ff             	cmp    %rdi,%r15
+  805381:	73 de                	jae    805361 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805383:	49 39 fc             	cmp    %rdi,%r12
+  805386:	72 05                	jb     80538d <munmap+0x6c>
+  805388:	4c 39 fa             	cmp    %r15,%rdx
+  80538b:	73 d4                	jae    805361 <munmap+0x40>
+  80538d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805392:	48 83 c4 08          	add    $0x8,%rsp
+  805396:	5b                   	pop    %rbx
+  805397:	41 5c                	pop    %r12
+  805399:	41 5d                	pop    %r13
+  80539b:	41 5e                	pop    %r14
+  80539d:	41 5f                	pop    %r15
+  80539f:	5d                   	pop    %rbp
+  8053a0:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8053a1:	48 83 c3 20          	add    $0x20,%rbx
+  8053a5:	4c 39 f3             	cmp    %r14,%rbx
+  8053a8:	74 5c                	je     805406 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8053aa:	48 8b 33             	mov    (%rbx),%rsi
+  8053ad:	4c 39 e6             	cmp    %r12,%rsi
+  8053b0:	73 ef                	jae    8053a1 <munmap+0x80>
+  8053b2:	48 85 f6             	test   %rsi,%rsi
+  8053b5:	74 ea                	je     8053a1 <munmap+0x80>
+  8053b7:	48 89 f2             	mov    %rsi,%rdx
+  8053ba:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8053be:	49 39 d7             	cmp    %rdx,%r15
+  8053c1:	73 de                	jae    8053a1 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8053c3:	48 89 df             	mov    %rbx,%rdi
+  8053c6:	48 b8 11 4f 80 00 00 	movabs $0x804f11,%rax
+  8053cd:	00 00 00 
+  8053d0:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8053d2:	85 c0                	test   %eax,%eax
+  8053d4:	78 bc                	js     805392 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8053d6:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8053da:	48 8b 33             	mov    (%rbx),%rsi
+  8053dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053e2:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  8053e9:	00 00 00 
+  8053ec:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8053ee:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8053f1:	48 b8 c9 35 80 00 00 	movabs $0x8035c9,%rax
+  8053f8:	00 00 00 
+  8053fb:	ff d0                	call   *%rax
+        reg->start = 0;
+  8053fd:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805404:	eb 9b                	jmp    8053a1 <munmap+0x80>
+    return 0;
+  805406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80540b:	eb 85                	jmp    805392 <munmap+0x71>
+
+000000000080540d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80540d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805412:	c3                   	ret
+
+0000000000805413 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805413:	55                   	push   %rbp
+  805414:	48 89 e5             	mov    %rsp,%rbp
+  805417:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80541a:	48 be 05 68 80 00 00 	movabs $0x806805,%rsi
+  805421:	00 00 00 
+  805424:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  80542b:	00 00 00 
+  80542e:	ff d0                	call   *%rax
+    return 0;
+}
+  805430:	b8 00 00 00 00       	mov    $0x0,%eax
+  805435:	5d                   	pop    %rbp
+  805436:	c3                   	ret
+
+0000000000805437 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805437:	55                   	push   %rbp
+  805438:	48 89 e5             	mov    %rsp,%rbp
+  80543b:	41 57                	push   %r15
+  80543d:	41 56                	push   %r14
+  80543f:	41 55                	push   %r13
+  805441:	41 54                	push   %r12
+  805443:	53                   	push   %rbx
+  805444:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80544b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805452:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805459:	00 00 00 00 
+  80545d:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805464:	00 00 00 00 
+  805468:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80546f:	00 00 00 00 
+  805473:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80547a:	00 00 00 00 
+  80547e:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805485:	00 00 00 00 
+  805489:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805490:	00 00 00 00 
+  805494:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80549b:	00 
+  80549c:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8054a3:	00 
+  8054a4:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8054ab:	00 
+  8054ac:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8054b3:	00 
+  8054b4:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8054bb:	00 
+  8054bc:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8054c3:	00 
+  8054c4:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8054cb:	00 
+  8054cc:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8054d3:	00 
+  8054d4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8054db:	00 
+  8054dc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8054e3:	00 
+    for (res = 0; res < n; res += inc) {
+  8054e4:	48 85 d2             	test   %rdx,%rdx
+  8054e7:	74 7a                	je     805563 <devcons_write+0x12c>
+  8054e9:	49 89 d6             	mov    %rdx,%r14
+  8054ec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054f2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8054f7:	49 bf 2f 25 80 00 00 	movabs $0x80252f,%r15
+  8054fe:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805501:	4c 89 f3             	mov    %r14,%rbx
+  805504:	48 29 f3             	sub    %rsi,%rbx
+  805507:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80550c:	48 39 c3             	cmp    %rax,%rbx
+  80550f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805513:	4c 63 eb             	movslq %ebx,%r13
+  805516:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80551d:	48 01 c6             	add    %rax,%rsi
+  805520:	4c 89 ea             	mov    %r13,%rdx
+  805523:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80552a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80552d:	4c 89 ee             	mov    %r13,%rsi
+  805530:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805537:	48 b8 5c 27 80 00 00 	movabs $0x80275c,%rax
+  80553e:	00 00 00 
+  805541:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805543:	41 01 dc             	add    %ebx,%r12d
+  805546:	49 63 f4             	movslq %r12d,%rsi
+  805549:	4c 39 f6             	cmp    %r14,%rsi
+  80554c:	72 b3                	jb     805501 <devcons_write+0xca>
+    return res;
+  80554e:	49 63 c4             	movslq %r12d,%rax
+}
+  805551:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805558:	5b                   	pop    %rbx
+  805559:	41 5c                	pop    %r12
+  80555b:	41 5d                	pop    %r13
+  80555d:	41 5e                	pop    %r14
+  80555f:	41 5f                	pop    %r15
+  805561:	5d                   	pop    %rbp
+  805562:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805563:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805569:	eb e3                	jmp    80554e <devcons_write+0x117>
+
+000000000080556b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80556b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80556e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805573:	48 85 c0             	test   %rax,%rax
+  805576:	74 55                	je     8055cd <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805578:	55                   	push   %rbp
+  805579:	48 89 e5             	mov    %rsp,%rbp
+  80557c:	41 55                	push   %r13
+  80557e:	41 54                	push   %r12
+  805580:	53                   	push   %rbx
+  805581:	48 83 ec 08          	sub    $0x8,%rsp
+  805585:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805588:	48 bb 8f 27 80 00 00 	movabs $0x80278f,%rbx
+  80558f:	00 00 00 
+  805592:	49 bc a3 28 80 00 00 	movabs $0x8028a3,%r12
+  805599:	00 00 00 
+  80559c:	eb 03                	jmp    8055a1 <devcons_read+0x36>
+  80559e:	41 ff d4             	call   *%r12
+  8055a1:	ff d3                	call   *%rbx
+  8055a3:	85 c0                	test   %eax,%eax
+  8055a5:	74 f7                	je     80559e <devcons_read+0x33>
+    if (c < 0) return c;
+  8055a7:	48 63 d0             	movslq %eax,%rdx
+  8055aa:	78 13                	js     8055bf <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8055ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055b1:	83 f8 04             	cmp    $0x4,%eax
+  8055b4:	74 09                	je     8055bf <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8055b6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8055ba:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8055bf:	48 89 d0             	mov    %rdx,%rax
+  8055c2:	48 83 c4 08          	add    $0x8,%rsp
+  8055c6:	5b                   	pop    %rbx
+  8055c7:	41 5c                	pop    %r12
+  8055c9:	41 5d                	pop    %r13
+  8055cb:	5d                   	pop    %rbp
+  8055cc:	c3                   	ret
+  8055cd:	48 89 d0             	mov    %rdx,%rax
+  8055d0:	c3                   	ret
+
+00000000008055d1 <cputchar>:
+cputchar(int ch) {
+  8055d1:	55                   	push   %rbp
+  8055d2:	48 89 e5             	mov    %rsp,%rbp
+  8055d5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8055d9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8055dd:	be 01 00 00 00       	mov    $0x1,%esi
+  8055e2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8055e6:	48 b8 5c 27 80 00 00 	movabs $0x80275c,%rax
+  8055ed:	00 00 00 
+  8055f0:	ff d0                	call   *%rax
+}
+  8055f2:	c9                   	leave
+  8055f3:	c3                   	ret
+
+00000000008055f4 <getchar>:
+getchar(void) {
+  8055f4:	55                   	push   %rbp
+  8055f5:	48 89 e5             	mov    %rsp,%rbp
+  8055f8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8055fc:	ba 01 00 00 00       	mov    $0x1,%edx
+  805601:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805605:	bf 00 00 00 00       	mov    $0x0,%edi
+  80560a:	48 b8 47 37 80 00 00 	movabs $0x803747,%rax
+  805611:	00 00 00 
+  805614:	ff d0                	call   *%rax
+  805616:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805618:	85 c0                	test   %eax,%eax
+  80561a:	78 06                	js     805622 <getchar+0x2e>
+  80561c:	74 08                	je     805626 <getchar+0x32>
+  80561e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805622:	89 d0                	mov    %edx,%eax
+  805624:	c9                   	leave
+  805625:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805626:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80562b:	eb f5                	jmp    805622 <getchar+0x2e>
+
+000000000080562d <iscons>:
+iscons(int fdnum) {
+  80562d:	55                   	push   %rbp
+  80562e:	48 89 e5             	mov    %rsp,%rbp
+  805631:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805635:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805639:	48 b8 64 34 80 00 00 	movabs $0x803464,%rax
+  805640:	00 00 00 
+  805643:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805645:	85 c0                	test   %eax,%eax
+  805647:	78 18                	js     805661 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805649:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80564d:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  805654:	00 00 00 
+  805657:	8b 00                	mov    (%rax),%eax
+  805659:	39 02                	cmp    %eax,(%rdx)
+  80565b:	0f 94 c0             	sete   %al
+  80565e:	0f b6 c0             	movzbl %al,%eax
+}
+  805661:	c9                   	leave
+  805662:	c3                   	ret
+
+0000000000805663 <opencons>:
+opencons(void) {
+  805663:	55                   	push   %rbp
+  805664:	48 89 e5             	mov    %rsp,%rbp
+  805667:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80566b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80566f:	48 b8 04 34 80 00 00 	movabs $0x803404,%rax
+  805676:	00 00 00 
+  805679:	ff d0                	call   *%rax
+  80567b:	85 c0                	test   %eax,%eax
+  80567d:	78 49                	js     8056c8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80567f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805684:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805689:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80568d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805692:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  805699:	00 00 00 
+  80569c:	ff d0                	call   *%rax
+  80569e:	85 c0                	test   %eax,%eax
+  8056a0:	78 26                	js     8056c8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8056a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8056a6:	a1 e0 70 80 00 00 00 	movabs 0x8070e0,%eax
+  8056ad:	00 00 
+  8056af:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8056b1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8056b5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8056bc:	48 b8 d6 33 80 00 00 	movabs $0x8033d6,%rax
+  8056c3:	00 00 00 
+  8056c6:	ff d0                	call   *%rax
+}
+  8056c8:	c9                   	leave
+  8056c9:	c3                   	ret
+
+00000000008056ca <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8056ca:	55                   	push   %rbp
+  8056cb:	48 89 e5             	mov    %rsp,%rbp
+  8056ce:	41 56                	push   %r14
+  8056d0:	41 55                	push   %r13
+  8056d2:	41 54                	push   %r12
+  8056d4:	53                   	push   %rbx
+  8056d5:	48 83 ec 50          	sub    $0x50,%rsp
+  8056d9:	49 89 fc             	mov    %rdi,%r12
+  8056dc:	41 89 f5             	mov    %esi,%r13d
+  8056df:	48 89 d3             	mov    %rdx,%rbx
+  8056e2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8056e6:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8056ea:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8056ee:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8056f5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8056f9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8056fd:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805701:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805705:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  80570c:	00 00 00 
+  80570f:	4c 8b 30             	mov    (%rax),%r14
+  805712:	48 b8 6c 28 80 00 00 	movabs $0x80286c,%rax
+  805719:	00 00 00 
+  80571c:	ff d0                	call   *%rax
+  80571e:	89 c6                	mov    %eax,%esi
+  805720:	45 89 e8             	mov    %r13d,%r8d
+  805723:	4c 89 e1             	mov    %r12,%rcx
+  805726:	4c 89 f2             	mov    %r14,%rdx
+  805729:	48 bf 18 68 80 00 00 	movabs $0x806818,%rdi
+  805730:	00 00 00 
+  805733:	b8 00 00 00 00       	mov    $0x0,%eax
+  805738:	49 bc a8 18 80 00 00 	movabs $0x8018a8,%r12
+  80573f:	00 00 00 
+  805742:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805745:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805749:	48 89 df             	mov    %rbx,%rdi
+  80574c:	48 b8 44 18 80 00 00 	movabs $0x801844,%rax
+  805753:	00 00 00 
+  805756:	ff d0                	call   *%rax
+    cprintf("\n");
+  805758:	48 bf eb 66 80 00 00 	movabs $0x8066eb,%rdi
+  80575f:	00 00 00 
+  805762:	b8 00 00 00 00       	mov    $0x0,%eax
+  805767:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80576a:	cc                   	int3
+  80576b:	eb fd                	jmp    80576a <_panic+0xa0>
+
+000000000080576d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80576d:	55                   	push   %rbp
+  80576e:	48 89 e5             	mov    %rsp,%rbp
+  805771:	41 56                	push   %r14
+  805773:	41 55                	push   %r13
+  805775:	41 54                	push   %r12
+  805777:	53                   	push   %rbx
+  805778:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80577b:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805782:	00 00 00 
+  805785:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805789:	74 27                	je     8057b2 <_handle_vectored_pagefault+0x45>
+  80578b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805790:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805797:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80579a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80579d:	4c 89 e7             	mov    %r12,%rdi
+  8057a0:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8057a5:	84 c0                	test   %al,%al
+  8057a7:	75 45                	jne    8057ee <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8057a9:	48 83 c3 01          	add    $0x1,%rbx
+  8057ad:	49 3b 1e             	cmp    (%r14),%rbx
+  8057b0:	72 eb                	jb     80579d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8057b2:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8057b9:	00 
+  8057ba:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8057bf:	4d 8b 04 24          	mov    (%r12),%r8
+  8057c3:	48 ba 40 68 80 00 00 	movabs $0x806840,%rdx
+  8057ca:	00 00 00 
+  8057cd:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8057d2:	48 bf 70 68 80 00 00 	movabs $0x806870,%rdi
+  8057d9:	00 00 00 
+  8057dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057e1:	49 ba ca 56 80 00 00 	movabs $0x8056ca,%r10
+  8057e8:	00 00 00 
+  8057eb:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8057ee:	5b                   	pop    %rbx
+  8057ef:	41 5c                	pop    %r12
+  8057f1:	41 5d                	pop    %r13
+  8057f3:	41 5e                	pop    %r14
+  8057f5:	5d                   	pop    %rbp
+  8057f6:	c3                   	ret
+
+00000000008057f7 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8057f7:	55                   	push   %rbp
+  8057f8:	48 89 e5             	mov    %rsp,%rbp
+  8057fb:	53                   	push   %rbx
+  8057fc:	48 83 ec 08          	sub    $0x8,%rsp
+  805800:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805803:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805808:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80580f:	00 00 00 
+  805812:	80 38 00             	cmpb   $0x0,(%rax)
+  805815:	74 68                	je     80587f <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805817:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80581e:	00 00 00 
+  805821:	48 8b 08             	mov    (%rax),%rcx
+  805824:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805829:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805830:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805833:	48 85 c9             	test   %rcx,%rcx
+  805836:	0f 84 e0 00 00 00    	je     80591c <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80583c:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805840:	0f 84 c9 00 00 00    	je     80590f <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805846:	48 83 c2 01          	add    $0x1,%rdx
+  80584a:	48 39 ca             	cmp    %rcx,%rdx
+  80584d:	75 ed                	jne    80583c <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80584f:	48 83 f9 08          	cmp    $0x8,%rcx
+  805853:	0f 84 84 00 00 00    	je     8058dd <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805859:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80585d:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805864:	00 00 00 
+  805867:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80586e:	00 00 00 
+  805871:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805875:	85 f6                	test   %esi,%esi
+  805877:	0f 89 97 00 00 00    	jns    805914 <add_pgfault_handler+0x11d>
+  80587d:	eb 63                	jmp    8058e2 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80587f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805884:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805889:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805890:	00 00 00 
+  805893:	bf 00 00 00 00       	mov    $0x0,%edi
+  805898:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  80589f:	00 00 00 
+  8058a2:	ff d0                	call   *%rax
+  8058a4:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8058a6:	85 c0                	test   %eax,%eax
+  8058a8:	78 38                	js     8058e2 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8058aa:	48 be f8 59 80 00 00 	movabs $0x8059f8,%rsi
+  8058b1:	00 00 00 
+  8058b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058b9:	48 b8 67 2b 80 00 00 	movabs $0x802b67,%rax
+  8058c0:	00 00 00 
+  8058c3:	ff d0                	call   *%rax
+  8058c5:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8058c7:	85 c0                	test   %eax,%eax
+  8058c9:	78 17                	js     8058e2 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8058cb:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8058d2:	00 00 00 
+  8058d5:	c6 00 01             	movb   $0x1,(%rax)
+  8058d8:	e9 3a ff ff ff       	jmp    805817 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8058dd:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8058e2:	89 f1                	mov    %esi,%ecx
+  8058e4:	48 ba 7e 68 80 00 00 	movabs $0x80687e,%rdx
+  8058eb:	00 00 00 
+  8058ee:	be 42 00 00 00       	mov    $0x42,%esi
+  8058f3:	48 bf 70 68 80 00 00 	movabs $0x806870,%rdi
+  8058fa:	00 00 00 
+  8058fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805902:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  805909:	00 00 00 
+  80590c:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80590f:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805914:	89 f0                	mov    %esi,%eax
+  805916:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80591a:	c9                   	leave
+  80591b:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80591c:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805923:	00 00 00 
+  805926:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80592d:	48 89 d8             	mov    %rbx,%rax
+  805930:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805937:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80593a:	eb d8                	jmp    805914 <add_pgfault_handler+0x11d>
+
+000000000080593c <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80593c:	55                   	push   %rbp
+  80593d:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805940:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805947:	00 00 00 
+  80594a:	80 38 00             	cmpb   $0x0,(%rax)
+  80594d:	74 33                	je     805982 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80594f:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805956:	00 00 00 
+  805959:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80595e:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805965:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805968:	48 85 c0             	test   %rax,%rax
+  80596b:	0f 84 85 00 00 00    	je     8059f6 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805971:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805975:	74 40                	je     8059b7 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805977:	48 83 c1 01          	add    $0x1,%rcx
+  80597b:	48 39 c1             	cmp    %rax,%rcx
+  80597e:	75 f1                	jne    805971 <remove_pgfault_handler+0x35>
+  805980:	eb 74                	jmp    8059f6 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805982:	48 b9 96 68 80 00 00 	movabs $0x806896,%rcx
+  805989:	00 00 00 
+  80598c:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  805993:	00 00 00 
+  805996:	be 48 00 00 00       	mov    $0x48,%esi
+  80599b:	48 bf 70 68 80 00 00 	movabs $0x806870,%rdi
+  8059a2:	00 00 00 
+  8059a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059aa:	49 b8 ca 56 80 00 00 	movabs $0x8056ca,%r8
+  8059b1:	00 00 00 
+  8059b4:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8059b7:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8059be:	00 
+  8059bf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8059c3:	48 29 ca             	sub    %rcx,%rdx
+  8059c6:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8059cd:	00 00 00 
+  8059d0:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8059d4:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8059d9:	48 89 ce             	mov    %rcx,%rsi
+  8059dc:	48 b8 2f 25 80 00 00 	movabs $0x80252f,%rax
+  8059e3:	00 00 00 
+  8059e6:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8059e8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8059ef:	00 00 00 
+  8059f2:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8059f6:	5d                   	pop    %rbp
+  8059f7:	c3                   	ret
+
+00000000008059f8 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8059f8:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8059fb:	48 b8 6d 57 80 00 00 	movabs $0x80576d,%rax
+  805a02:	00 00 00 
+    call *%rax
+  805a05:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805a07:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805a0e:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805a0f:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805a16:	00 
+    subq $8, %rcx
+  805a17:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805a1b:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805a1e:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805a25:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805a26:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805a2a:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805a2e:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805a33:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805a38:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805a3d:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805a42:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805a47:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805a4c:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805a51:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805a56:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805a5b:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805a60:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805a65:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805a6a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805a6f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805a74:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805a78:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805a7c:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805a7d:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805a7e:	c3                   	ret
+  805a7f:	90                   	nop
+
+0000000000805a80 <__rodata_start>:
+  805a80:	77 00                	ja     805a82 <__rodata_start+0x2>
+  805a82:	72 62                	jb     805ae6 <__rodata_start+0x66>
+  805a84:	00 77 62             	add    %dh,0x62(%rdi)
+  805a87:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805a8a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805a91:	00 
+  805a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a99:	00 00 00 
+  805a9c:	0f 1f 40 00          	nopl   0x0(%rax)
+  805aa0:	b3 09                	mov    $0x9,%bl
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 ed                	add    %ch,%ch
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 ed                	add    %ch,%ch
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	8c 0a                	mov    %cs,(%rdx)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	8c 0a                	mov    %cs,(%rdx)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	8c 0a                	mov    %cs,(%rdx)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	8c 0a                	mov    %cs,(%rdx)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	8c 0a                	mov    %cs,(%rdx)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	ed                   	in     (%dx),%eax
+  805b71:	0d 80 00 00 00       	or     $0x80,%eax
+  805b76:	00 00                	add    %al,(%rax)
+  805b78:	ed                   	in     (%dx),%eax
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	ed                   	in     (%dx),%eax
+  805b99:	0d 80 00 00 00       	or     $0x80,%eax
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	ed                   	in     (%dx),%eax
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	ed                   	in     (%dx),%eax
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	ed                   	in     (%dx),%eax
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ed                   	in     (%dx),%eax
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	ed                   	in     (%dx),%eax
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ed                   	in     (%dx),%eax
+  805be1:	0d 80 00 00 00       	or     $0x80,%eax
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	ed                   	in     (%dx),%eax
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	ed                   	in     (%dx),%eax
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ed                   	in     (%dx),%eax
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	ed                   	in     (%dx),%eax
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	ed                   	in     (%dx),%eax
+  805c19:	0d 80 00 00 00       	or     $0x80,%eax
+  805c1e:	00 00                	add    %al,(%rax)
+  805c20:	ed                   	in     (%dx),%eax
+  805c21:	0d 80 00 00 00       	or     $0x80,%eax
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	ed                   	in     (%dx),%eax
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	ed                   	in     (%dx),%eax
+  805c31:	0d 80 00 00 00       	or     $0x80,%eax
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	f4                   	hlt
+  805c39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c3f:	00 ed                	add    %ch,%ch
+  805c41:	0d 80 00 00 00       	or     $0x80,%eax
+  805c46:	00 00                	add    %al,(%rax)
+  805c48:	ed                   	in     (%dx),%eax
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	2c 0b                	sub    $0xb,%al
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 ed                	add    %ch,%ch
+  805c59:	0d 80 00 00 00       	or     $0x80,%eax
+  805c5e:	00 00                	add    %al,(%rax)
+  805c60:	ed                   	in     (%dx),%eax
+  805c61:	0d 80 00 00 00       	or     $0x80,%eax
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	ed                   	in     (%dx),%eax
+  805c69:	0d 80 00 00 00       	or     $0x80,%eax
+  805c6e:	00 00                	add    %al,(%rax)
+  805c70:	ed                   	in     (%dx),%eax
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	ed                   	in     (%dx),%eax
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ed                   	in     (%dx),%eax
+  805c81:	0d 80 00 00 00       	or     $0x80,%eax
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805c93:	00 00                	add    %al,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 cb                	add    %cl,%bl
+  805c99:	0d 80 00 00 00       	or     $0x80,%eax
+  805c9e:	00 00                	add    %al,(%rax)
+  805ca0:	ed                   	in     (%dx),%eax
+  805ca1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	ed                   	in     (%dx),%eax
+  805ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cae:	00 00                	add    %al,(%rax)
+  805cb0:	ed                   	in     (%dx),%eax
+  805cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	6a 0a                	push   $0xa
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 ed                	add    %ch,%ch
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	ed                   	in     (%dx),%eax
+  805cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	3c 0a                	cmp    $0xa,%al
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 ed                	add    %ch,%ch
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805ceb:	00 00                	add    %al,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 29                	add    %ch,(%rcx)
+  805cf9:	0c 80                	or     $0x80,%al
+  805cfb:	00 00                	add    %al,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 ed                	add    %ch,%ch
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	1a 0b                	sbb    (%rbx),%cl
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 ed                	add    %ch,%ch
+  805d19:	0d 80 00 00 00       	or     $0x80,%eax
+  805d1e:	00 00                	add    %al,(%rax)
+  805d20:	ce                   	(bad)
+  805d21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d27:	00 ed                	add    %ch,%ch
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	ed                   	in     (%dx),%eax
+  805d31:	0d 80 00 00 00       	or     $0x80,%eax
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	f4                   	hlt
+  805d39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d3f:	00 37                	add    %dh,(%rdi)
+  805d41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 37                	add    %dh,(%rdi)
+  805d51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805d6b:	00 00                	add    %al,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 d2                	add    %dl,%dl
+  805d71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d77:	00 d2                	add    %dl,%dl
+  805d79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d7f:	00 d2                	add    %dl,%dl
+  805d81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d87:	00 d2                	add    %dl,%dl
+  805d89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d8f:	00 d2                	add    %dl,%dl
+  805d91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d97:	00 d2                	add    %dl,%dl
+  805d99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d9f:	00 d2                	add    %dl,%dl
+  805da1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805da7:	00 f6                	add    %dh,%dh
+  805da9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805daf:	00 f6                	add    %dh,%dh
+  805db1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 22                	add    %ah,(%rdx)
+  805df1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805df7:	00 22                	add    %ah,(%rdx)
+  805df9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dff:	00 22                	add    %ah,(%rdx)
+  805e01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e07:	00 22                	add    %ah,(%rdx)
+  805e09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e0f:	00 22                	add    %ah,(%rdx)
+  805e11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e17:	00 22                	add    %ah,(%rdx)
+  805e19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e92:	80 00 00             	addb   $0x0,(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 46 12             	add    %al,0x12(%rsi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ed2:	80 00 00             	addb   $0x0,(%rax)
+  805ed5:	00 00                	add    %al,(%rax)
+  805ed7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 22                	add    %ah,(%rdx)
+  805ef1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ef7:	00 22                	add    %ah,(%rdx)
+  805ef9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805eff:	00 22                	add    %ah,(%rdx)
+  805f01:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f07:	00 22                	add    %ah,(%rdx)
+  805f09:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f0f:	00 22                	add    %ah,(%rdx)
+  805f11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f17:	00 22                	add    %ah,(%rdx)
+  805f19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f2a:	80 00 00             	addb   $0x0,(%rax)
+  805f2d:	00 00                	add    %al,(%rax)
+  805f2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f32:	80 00 00             	addb   $0x0,(%rax)
+  805f35:	00 00                	add    %al,(%rax)
+  805f37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f3a:	80 00 00             	addb   $0x0,(%rax)
+  805f3d:	00 00                	add    %al,(%rax)
+  805f3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f42:	80 00 00             	addb   $0x0,(%rax)
+  805f45:	00 00                	add    %al,(%rax)
+  805f47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f4a:	80 00 00             	addb   $0x0,(%rax)
+  805f4d:	00 00                	add    %al,(%rax)
+  805f4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f52:	80 00 00             	addb   $0x0,(%rax)
+  805f55:	00 00                	add    %al,(%rax)
+  805f57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f5a:	80 00 00             	addb   $0x0,(%rax)
+  805f5d:	00 00                	add    %al,(%rax)
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f72:	80 00 00             	addb   $0x0,(%rax)
+  805f75:	00 00                	add    %al,(%rax)
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f8a:	80 00 00             	addb   $0x0,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f92:	80 00 00             	addb   $0x0,(%rax)
+  805f95:	00 00                	add    %al,(%rax)
+  805f97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f9a:	80 00 00             	addb   $0x0,(%rax)
+  805f9d:	00 00                	add    %al,(%rax)
+  805f9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fa2:	80 00 00             	addb   $0x0,(%rax)
+  805fa5:	00 00                	add    %al,(%rax)
+  805fa7:	00 46 12             	add    %al,0x12(%rsi)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805fc0 <basefix.0>:
+  805fc0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805fd0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805fe0:	10 00 25 78 20 67 6f 74 20 6d 65 73 73 61 67 65     ..%x got message
+  805ff0:	3a 20 25 73 0a 00 66 90 63 68 69 6c 64 20 72 65     : %s..f.child re
+  806000:	63 65 69 76 65 64 20 63 6f 72 72 65 63 74 20 6d     ceived correct m
+  806010:	65 73 73 61 67 65 0a 00 70 61 72 65 6e 74 20 72     essage..parent r
+  806020:	65 63 65 69 76 65 64 20 63 6f 72 72 65 63 74 20     eceived correct 
+  806030:	6d 65 73 73 61 67 65 0a 00 00 00 00 00 00 00 00     message.........
+  806040:	68 65 6c 6c 6f 20 70 61 72 65 6e 74 20 65 6e 76     hello parent env
+  806050:	69 72 6f 6e 6d 65 6e 74 21 20 49 27 6d 20 67 6f     ironment! I'm go
+  806060:	6f 64 2e 00 00 00 00 00 68 65 6c 6c 6f 20 63 68     od......hello ch
+  806070:	69 6c 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 21     ild environment!
+  806080:	20 68 6f 77 20 61 72 65 20 79 6f 75 3f 00 3c 75      how are you?.<u
+  806090:	6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35 36 37     nknown>.01234567
+  8060a0:	38 39 41 42 43 44 45 46 00 30 31 32 33 34 35 36     89ABCDEF.0123456
+  8060b0:	37 38 39 61 62 63 64 65 66 00 28 6e 75 6c 6c 29     789abcdef.(null)
+  8060c0:	00 65 72 72 6f 72 20 25 64 00 75 6e 73 70 65 63     .error %d.unspec
+  8060d0:	69 66 69 65 64 20 65 72 72 6f 72 00 62 61 64 20     ified error.bad 
+  8060e0:	65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e 76 61     environment.inva
+  8060f0:	6c 69 64 20 70 61 72 61 6d 65 74 65 72 00 6f 75     lid parameter.ou
+  806100:	74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75 74 20     t of memory.out 
+  806110:	6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 73 00     of environments.
+  806120:	63 6f 72 72 75 70 74 65 64 20 64 65 62 75 67 20     corrupted debug 
+  806130:	69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74 69 6f     info.segmentatio
+  806140:	6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69 64 20     n fault.invalid 
+  806150:	45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73 75 63     ELF image.no suc
+  806160:	68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00 65 6e     h system call.en
+  806170:	74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00 65 6e     try not found.en
+  806180:	76 20 69 73 20 6e 6f 74 20 72 65 63 76 69 6e 67     v is not recving
+  806190:	00 75 6e 65 78 70 65 63 74 65 64 20 65 6e 64 20     .unexpected end 
+  8061a0:	6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65 65 20     of file.no free 
+  8061b0:	73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00 74 6f     space on disk.to
+  8061c0:	6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61 72 65     o many files are
+  8061d0:	20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20 62 6c      open.file or bl
+  8061e0:	6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00 69 6e     ock not found.in
+  8061f0:	76 61 6c 69 64 20 70 61 74 68 00 66 69 6c 65 20     valid path.file 
+  806200:	61 6c 72 65 61 64 79 20 65 78 69 73 74 73 00 6f     already exists.o
+  806210:	70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73 75 70     peration not sup
+  806220:	70 6f 72 74 65 64 00 66 2e 0f 1f 84 00 00 00 00     ported.f........
+  806230:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
+  806240:	a0 1a 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     ......... ......
+  806250:	e7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806260:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806270:	f7 20 80 00 00 00 00 00 bf 1a 80 00 00 00 00 00     . ..............
+  806280:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806290:	b3 1a 80 00 00 00 00 00 2d 1b 80 00 00 00 00 00     ........-.......
+  8062a0:	f7 20 80 00 00 00 00 00 b3 1a 80 00 00 00 00 00     . ..............
+  8062b0:	f9 1a 80 00 00 00 00 00 f9 1a 80 00 00 00 00 00     ................
+  8062c0:	f9 1a 80 00 00 00 00 00 f9 1a 80 00 00 00 00 00     ................
+  8062d0:	f9 1a 80 00 00 00 00 00 f9 1a 80 00 00 00 00 00     ................
+  8062e0:	f9 1a 80 00 00 00 00 00 f9 1a 80 00 00 00 00 00     ................
+  8062f0:	f9 1a 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     ......... ......
+  806300:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806310:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806320:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806330:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806340:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806350:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806360:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806370:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806380:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806390:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  8063a0:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  8063b0:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  8063c0:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  8063d0:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  8063e0:	f7 20 80 00 00 00 00 00 15 20 80 00 00 00 00 00     . ....... ......
+  8063f0:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806400:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806410:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806420:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806430:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806440:	5b 1b 80 00 00 00 00 00 2a 1d 80 00 00 00 00 00     [.......*.......
+  806450:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  806460:	f7 20 80 00 00 00 00 00 50 1b 80 00 00 00 00 00     . ......P.......
+  806470:	8a 1b 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     ......... ......
+  806480:	f7 20 80 00 00 00 00 00 45 1b 80 00 00 00 00 00     . ......E.......
+  806490:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  8064a0:	d3 1e 80 00 00 00 00 00 a2 1f 80 00 00 00 00 00     ................
+  8064b0:	f7 20 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     . ....... ......
+  8064c0:	21 1c 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     !........ ......
+  8064d0:	fe 1d 80 00 00 00 00 00 f7 20 80 00 00 00 00 00     ......... ......
+  8064e0:	f7 20 80 00 00 00 00 00 15 20 80 00 00 00 00 00     . ....... ......
+  8064f0:	f7 20 80 00 00 00 00 00 a9 1a 80 00 00 00 00 00     . ..............
+
+0000000000806500 <error_string>:
+	...
+  806508:	ca 60 80 00 00 00 00 00 dc 60 80 00 00 00 00 00     .`.......`......
+  806518:	ec 60 80 00 00 00 00 00 fe 60 80 00 00 00 00 00     .`.......`......
+  806528:	0c 61 80 00 00 00 00 00 20 61 80 00 00 00 00 00     .a...... a......
+  806538:	35 61 80 00 00 00 00 00 48 61 80 00 00 00 00 00     5a......Ha......
+  806548:	5a 61 80 00 00 00 00 00 6e 61 80 00 00 00 00 00     Za......na......
+  806558:	7e 61 80 00 00 00 00 00 91 61 80 00 00 00 00 00     ~a.......a......
+  806568:	a8 61 80 00 00 00 00 00 be 61 80 00 00 00 00 00     .a.......a......
+  806578:	d6 61 80 00 00 00 00 00 ee 61 80 00 00 00 00 00     .a.......a......
+  806588:	fb 61 80 00 00 00 00 00 a0 65 80 00 00 00 00 00     .a.......e......
+  806598:	0f 62 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .b......file is 
+  8065a8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8065b8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8065c8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8065d8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8065e8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8065f8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806608:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806618:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806628:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806638:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806648:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806658:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806668:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 69     ult_upcall: %i.i
+  806678:	70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f     pc_send: %i.lib/
+  806688:	69 70 63 2e 63 00 66 90 5b 25 30 38 78 5d 20 75     ipc.c.f.[%08x] u
+  806698:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8066a8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8066b8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8066c8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8066d8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8066e8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8066f8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  806708:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806718:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806720 <devtab>:
+  806720:	60 70 80 00 00 00 00 00 a0 70 80 00 00 00 00 00     `p.......p......
+  806730:	e0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806740:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806750:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806760:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806770:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806780:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806790:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8067a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8067b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8067c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8067d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8067e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8067f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806800:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806810:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806820:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806830:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806840:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806850:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806860:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806870:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806880:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806890:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8068a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8068b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.